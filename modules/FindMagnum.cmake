@@ -30,6 +30,8 @@
 #   image converter plugins
 #  MAGNUM_PLUGINS_IMPORTER[|_DEBUG|_RELEASE]_DIR  - Directory with dynamic
 #   importer plugins
+#  MAGNUM_PLUGINS_MESHCONVERTER[|_DEBUG|_RELEASE]_DIR - Directory with dynamic
+#   mesh converter plugins
 #  MAGNUM_PLUGINS_AUDIOIMPORTER[|_DEBUG|_RELEASE]_DIR - Directory with dynamic
 #   audio importer plugins
 #
@@ -64,8 +66,13 @@
 #  EglContext                   - EGL context
 #  GlxContext                   - GLX context
 #  WglContext                   - WGL context
+#  CachingImporter              - Caching importer plugin
+#  DdsImporter                  - DDS importer plugin
+#  KtxImporter                  - KTX importer plugin
 #  MagnumFont                   - Magnum bitmap font plugin
 #  MagnumFontConverter          - Magnum bitmap font converter plugin
+#  MagnumMeshConverter          - Magnum binary mesh converter plugin
+#  MagnumMeshImporter           - Magnum binary mesh importer plugin
 #  ObjImporter                  - OBJ importer plugin
 #  TgaImageConverter            - TGA image converter plugin
 #  TgaImporter                  - TGA importer plugin
@@ -73,7 +80,9 @@
 #  distancefieldconverter       - magnum-distancefieldconverter executable
 #  fontconverter                - magnum-fontconverter executable
 #  imageconverter               - magnum-imageconverter executable
+#  pointcloudconverter          - magnum-pointcloudconverter executable
 #  info                         - magnum-info executable
+#  benchmark                    - magnum-benchmark executable
 #  al-info                      - magnum-al-info executable
 #
 # Example usage with specifying additional components is::
@@ -109,6 +118,8 @@
 #  MAGNUM_BUILD_STATIC          - Defined if compiled as static libraries
 #  MAGNUM_BUILD_MULTITHREADED   - Defined if compiled in a way that allows
 #   having multiple thread-local Magnum contexts
+#  MAGNUM_BUILD_SIMD            - Defined if compiled with SSE2 / NEON
+#   implementation of common math operations
 #  MAGNUM_TARGET_GLES           - Defined if compiled for OpenGL ES
 #  MAGNUM_TARGET_GLES2          - Defined if compiled for OpenGL ES 2.0
 #  MAGNUM_TARGET_GLES3          - Defined if compiled for OpenGL ES 3.0
@@ -149,6 +160,10 @@
 #   plugin binary installation directory
 #  MAGNUM_PLUGINS_IMPORTER_[DEBUG|RELEASE]_LIBRARY_INSTALL_DIR  - Importer
 #   plugin library installation directory
+#  MAGNUM_PLUGINS_MESHCONVERTER_[DEBUG|RELEASE]_BINARY_INSTALL_DIR - Mesh
+#   converter plugin binary installation directory
+#  MAGNUM_PLUGINS_MESHCONVERTER_[DEBUG|RELEASE]_LIBRARY_INSTALL_DIR - Mesh
+#   converter plugin library installation directory
 #  MAGNUM_PLUGINS_AUDIOIMPORTER_[DEBUG|RELEASE]_BINARY_INSTALL_DIR - Audio
 #   importer plugin binary installation directory
 #  MAGNUM_PLUGINS_AUDIOIMPORTER_[DEBUG|RELEASE]_LIBRARY_INSTALL_DIR - Audio
@@ -224,6 +239,7 @@ set(_magnumFlags
     BUILD_DEPRECATED
     BUILD_STATIC
     BUILD_MULTITHREADED
+    BUILD_SIMD
     TARGET_GLES
     TARGET_GLES2
     TARGET_GLES3
@@ -330,12 +346,16 @@ foreach(_component ${Magnum_FIND_COMPONENTS})
         set(_MAGNUM_${_COMPONENT}_DEPENDENCIES TextureTools)
     elseif(_component STREQUAL DebugTools)
         set(_MAGNUM_${_COMPONENT}_DEPENDENCIES MeshTools Primitives SceneGraph Shaders Shapes)
+    elseif(_component STREQUAL CachingImporter)
+        set(_MAGNUM_${_COMPONENT}_DEPENDENCIES MagnumMeshImporter MagnumMeshConverter) # and below
     elseif(_component STREQUAL MagnumFont)
         set(_MAGNUM_${_COMPONENT}_DEPENDENCIES TgaImporter) # and below
     elseif(_component STREQUAL MagnumFontConverter)
         set(_MAGNUM_${_COMPONENT}_DEPENDENCIES TgaImageConverter) # and below
     elseif(_component STREQUAL ObjImporter)
         set(_MAGNUM_${_COMPONENT}_DEPENDENCIES MeshTools)
+    elseif(_component STREQUAL Primitives)
+        set(_MAGNUM_${_COMPONENT}_DEPENDENCIES MeshTools)
     endif()
 
     if(_component MATCHES ".+AudioImporter")
@@ -365,8 +385,8 @@ endif()
 # Component distinction (listing them explicitly to avoid mistakes with finding
 # components from other repositories)
 set(_MAGNUM_LIBRARY_COMPONENTS "^(Audio|DebugTools|MeshTools|Primitives|SceneGraph|Shaders|Shapes|Text|TextureTools|AndroidApplication|GlfwApplication|GlutApplication|GlxApplication|NaClApplication|Sdl2Application|XEglApplication|WindowlessCglApplication|WindowlessEglApplication|WindowlessGlxApplication|WindowlessIosApplication|WindowlessNaClApplication|WindowlessWglApplication|WindowlessWindowsEglApplication|CglContext|EglContext|GlxContext|WglContext)$")
-set(_MAGNUM_PLUGIN_COMPONENTS "^(MagnumFont|MagnumFontConverter|ObjImporter|TgaImageConverter|TgaImporter|WavAudioImporter)$")
-set(_MAGNUM_EXECUTABLE_COMPONENTS "^(distancefieldconverter|fontconverter|imageconverter|info|al-info)$")
+set(_MAGNUM_PLUGIN_COMPONENTS "^(CachingImporter|DdsImporter|KtxImporter|MagnumFont|MagnumFontConverter|MagnumMeshConverter|MagnumMeshImporter|ObjImporter|TgaImageConverter|TgaImporter|WavAudioImporter)$")
+set(_MAGNUM_EXECUTABLE_COMPONENTS "^(distancefieldconverter|fontconverter|imageconverter|pointcloudconverter|info|benchmark|al-info)$")
 
 # Find all components
 foreach(_component ${Magnum_FIND_COMPONENTS})
@@ -421,6 +441,10 @@ foreach(_component ${Magnum_FIND_COMPONENTS})
             # FontConverter plugin specific name suffixes
             elseif(_component MATCHES ".+FontConverter$")
                 set(_MAGNUM_${_COMPONENT}_PATH_SUFFIX fontconverters)
+
+            # MeshConverter plugin specific name suffixes
+            elseif(_component MATCHES ".+MeshConverter$")
+                set(_MAGNUM_${_COMPONENT}_PATH_SUFFIX meshconverters)
             endif()
 
             # Don't override the exception for *AudioImporter plugins
@@ -530,8 +554,9 @@ foreach(_component ${Magnum_FIND_COMPONENTS})
             # Windowless EGL application dependencies
             elseif(_component STREQUAL WindowlessEglApplication)
                 find_package(EGL)
+                find_package(Threads)
                 set_property(TARGET Magnum::${_component} APPEND PROPERTY
-                    INTERFACE_LINK_LIBRARIES EGL::EGL)
+                    INTERFACE_LINK_LIBRARIES EGL::EGL ${CMAKE_THREAD_LIBS_INIT})
 
             # Windowless iOS application dependencies
             elseif(_component STREQUAL WindowlessIosApplication)
@@ -787,6 +812,10 @@ set(MAGNUM_PLUGINS_IMPORTER_DEBUG_BINARY_INSTALL_DIR ${MAGNUM_PLUGINS_DEBUG_BINA
 set(MAGNUM_PLUGINS_IMPORTER_DEBUG_LIBRARY_INSTALL_DIR ${MAGNUM_PLUGINS_DEBUG_LIBRARY_INSTALL_DIR}/importers)
 set(MAGNUM_PLUGINS_IMPORTER_RELEASE_BINARY_INSTALL_DIR ${MAGNUM_PLUGINS_RELEASE_BINARY_INSTALL_DIR}/importers)
 set(MAGNUM_PLUGINS_IMPORTER_RELEASE_LIBRARY_INSTALL_DIR ${MAGNUM_PLUGINS_RELEASE_LIBRARY_INSTALL_DIR}/importers)
+set(MAGNUM_PLUGINS_MESHCONVERTER_DEBUG_BINARY_INSTALL_DIR ${MAGNUM_PLUGINS_DEBUG_BINARY_INSTALL_DIR}/meshconverters)
+set(MAGNUM_PLUGINS_MESHCONVERTER_DEBUG_LIBRARY_INSTALL_DIR ${MAGNUM_PLUGINS_DEBUG_LIBRARY_INSTALL_DIR}/meshconverters)
+set(MAGNUM_PLUGINS_MESHCONVERTER_RELEASE_BINARY_INSTALL_DIR ${MAGNUM_PLUGINS_RELEASE_BINARY_INSTALL_DIR}/meshconverters)
+set(MAGNUM_PLUGINS_MESHCONVERTER_RELEASE_LIBRARY_INSTALL_DIR ${MAGNUM_PLUGINS_RELEASE_LIBRARY_INSTALL_DIR}/meshconverters)
 set(MAGNUM_PLUGINS_AUDIOIMPORTER_DEBUG_BINARY_INSTALL_DIR ${MAGNUM_PLUGINS_DEBUG_BINARY_INSTALL_DIR}/audioimporters)
 set(MAGNUM_PLUGINS_AUDIOIMPORTER_DEBUG_LIBRARY_INSTALL_DIR ${MAGNUM_PLUGINS_DEBUG_LIBRARY_INSTALL_DIR}/audioimporters)
 set(MAGNUM_PLUGINS_AUDIOIMPORTER_RELEASE_BINARY_INSTALL_DIR ${MAGNUM_PLUGINS_RELEASE_BINARY_INSTALL_DIR}/audioimporters)
@@ -818,6 +847,9 @@ set(MAGNUM_PLUGINS_IMAGECONVERTER_RELEASE_DIR ${MAGNUM_PLUGINS_RELEASE_DIR}/imag
 set(MAGNUM_PLUGINS_IMPORTER_DIR ${MAGNUM_PLUGINS_DIR}/importers)
 set(MAGNUM_PLUGINS_IMPORTER_DEBUG_DIR ${MAGNUM_PLUGINS_DEBUG_DIR}/importers)
 set(MAGNUM_PLUGINS_IMPORTER_RELEASE_DIR ${MAGNUM_PLUGINS_RELEASE_DIR}/importers)
+set(MAGNUM_PLUGINS_MESHCONVERTER_DIR ${MAGNUM_PLUGINS_DIR}/meshconverters)
+set(MAGNUM_PLUGINS_MESHCONVERTER_DEBUG_DIR ${MAGNUM_PLUGINS_DEBUG_DIR}/meshconverters)
+set(MAGNUM_PLUGINS_MESHCONVERTER_RELEASE_DIR ${MAGNUM_PLUGINS_RELEASE_DIR}/meshconverters)
 set(MAGNUM_PLUGINS_AUDIOIMPORTER_DIR ${MAGNUM_PLUGINS_DIR}/audioimporters)
 set(MAGNUM_PLUGINS_AUDIOIMPORTER_DEBUG_DIR ${MAGNUM_PLUGINS_DEBUG_DIR}/audioimporters)
 set(MAGNUM_PLUGINS_AUDIOIMPORTER_RELEASE_DIR ${MAGNUM_PLUGINS_RELEASE_DIR}/audioimporters)
@@ -24,8 +24,13 @@ cmake .. \
     -DWITH_SDL2APPLICATION=ON \
     -DWITH_WINDOWLESS${PLATFORM_GL_API}APPLICATION=ON \
     -DWITH_${PLATFORM_GL_API}CONTEXT=ON \
+    -DWITH_CACHINGIMPORTER=ON \
+    -DWITH_DDSIMPORTER=ON \
+    -DWITH_KTXIMPORTER=ON \
     -DWITH_MAGNUMFONT=ON \
     -DWITH_MAGNUMFONTCONVERTER=ON \
+    -DWITH_MAGNUMMESHCONVERTER=ON \
+    -DWITH_MAGNUMMESHIMPORTER=ON \
     -DWITH_OBJIMPORTER=ON \
     -DWITH_TGAIMAGECONVERTER=ON \
     -DWITH_TGAIMPORTER=ON \
@@ -0,0 +1,314 @@
+#ifndef Magnum_AbstractAsyncResourceLoader_h
+#define Magnum_AbstractAsyncResourceLoader_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+/** @file
+ * @brief Class @ref Magnum::AbstractAsyncResourceLoader
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Magnum/AbstractResourceLoader.h"
+
+namespace Magnum {
+
+/**
+@brief Base for asynchronous resource loaders
+
+Loads resources for @ref ResourceManager on a pool of worker threads. Each
+call to @ref load() (done implicitly from @ref ResourceManager::get()) sets the
+resource state to @ref ResourceState::Loading and enqueues the key. A worker
+then calls @ref doLoadAsync() to read and decode the data and hands the result
+back. The main (GL) thread picks the results up in @ref update() and passes
+them to the manager, which transitions the resource to
+@ref ResourceState::Final. Until then, @ref Resource uses the fallback, if any
+is set with @ref ResourceManager::setFallback().
+
+## Usage and subclassing
+
+Implement @ref doLoadAsync() to load the data for given key. It is called from
+the worker threads, so it shouldn't touch any OpenGL state nor the
+@ref ResourceManager. Return `nullptr` to mark the resource as not found. The
+returned data are then passed to @ref doFinish() on the thread calling
+@ref update(), which is the place for creating the GL objects. If the loaded
+type is the same as resource type, default implementation just passes the data
+to @ref set().
+
+Call @ref update() once per frame with a time budget to avoid frame hitches
+when many resources finish at once:
+@code
+class MeshResourceLoader: public AbstractAsyncResourceLoader<Mesh, Trade::MeshData3D> {
+    public:
+        explicit MeshResourceLoader(): AbstractAsyncResourceLoader{2} {}
+
+        ~MeshResourceLoader() { stop(); }
+
+    private:
+        std::unique_ptr<Trade::MeshData3D> doLoadAsync(ResourceKey key) override {
+            // Import the mesh data, return nullptr if they can't be found...
+        }
+
+        void doFinish(ResourceKey key, std::unique_ptr<Trade::MeshData3D> data) override {
+            // Create and upload the buffers and the mesh...
+            set(key, mesh, ResourceDataState::Final, ResourcePolicy::Resident);
+        }
+};
+
+MyResourceManager manager;
+MeshResourceLoader* loader = new MeshResourceLoader;
+manager.setLoader(loader);
+
+// Each frame, spend at most two milliseconds on finishing loaded meshes
+loader->update(std::chrono::milliseconds{2});
+@endcode
+
+Because the workers call a virtual function of the subclass, the subclass
+should call @ref stop() in its destructor so the workers don't call into
+already destroyed object.
+
+With zero thread count there are no workers and @ref doLoadAsync() is called
+from @ref update() on the calling thread instead, which is useful on platforms
+without thread support.
+
+Using this class requires linking to the threading library, in CMake it can be
+done with `find_package(Threads)` and linking to `${CMAKE_THREAD_LIBS_INIT}`.
+@see @ref AbstractResourceLoader
+*/
+template<class T, class U = T> class AbstractAsyncResourceLoader: public AbstractResourceLoader<T> {
+    public:
+        /**
+         * @brief Constructor
+         * @param threadCount   Worker thread count. If zero, the resources are
+         *      loaded in @ref update().
+         *
+         * Starts the worker threads.
+         */
+        explicit AbstractAsyncResourceLoader(UnsignedInt threadCount = 1);
+
+        /** @brief Copying is not allowed */
+        AbstractAsyncResourceLoader(const AbstractAsyncResourceLoader<T, U>&) = delete;
+
+        /** @brief Moving is not allowed */
+        AbstractAsyncResourceLoader(AbstractAsyncResourceLoader<T, U>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Calls @ref stop().
+         */
+        ~AbstractAsyncResourceLoader();
+
+        /** @brief Copying is not allowed */
+        AbstractAsyncResourceLoader<T, U>& operator=(const AbstractAsyncResourceLoader<T, U>&) = delete;
+
+        /** @brief Moving is not allowed */
+        AbstractAsyncResourceLoader<T, U>& operator=(AbstractAsyncResourceLoader<T, U>&&) = delete;
+
+        /** @brief Worker thread count */
+        UnsignedInt threadCount() const { return _threads.size(); }
+
+        /**
+         * @brief Count of resources not yet finished
+         *
+         * Count of resources requested by calling @ref load(), but not yet
+         * passed to @ref ResourceManager in @ref update().
+         */
+        std::size_t pendingCount() const { return _pendingCount; }
+
+        /**
+         * @brief Pass loaded resources to the manager
+         * @param budget    Time budget
+         * @return Count of processed resources
+         *
+         * Calls @ref doFinish() or @ref setNotFound() for resources loaded
+         * by the workers until there are no more or the time budget is
+         * exceeded. At least one resource is processed, if there is any. If
+         * there are no worker threads, @ref doLoadAsync() is called here as
+         * well. Expected to be called from the thread owning the GL context.
+         */
+        std::size_t update(std::chrono::nanoseconds budget = std::chrono::nanoseconds::max());
+
+        /**
+         * @brief Stop the workers
+         *
+         * Discards all resources that weren't picked up by any worker yet
+         * (leaving them in @ref ResourceState::Loading) and waits until the
+         * workers finish the resources they are currently loading and exit.
+         * Resources already loaded can still be passed to the manager using
+         * @ref update(), subsequent calls to @ref load() are ignored.
+         * Calling this function more than once has no effect.
+         */
+        void stop();
+
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    private:
+    #else
+    protected:
+    #endif
+        /**
+         * @brief Load the resource
+         *
+         * Called from a worker thread (or from @ref update() if there are no
+         * worker threads). Return `nullptr` if the resource can't be found.
+         * The implementation must be thread-safe if @ref threadCount() is
+         * larger than one.
+         */
+        virtual std::unique_ptr<U> doLoadAsync(ResourceKey key) = 0;
+
+        /**
+         * @brief Finish loading the resource
+         *
+         * Called from @ref update() with data returned from
+         * @ref doLoadAsync(). The implementation is expected to call
+         * @ref set(). Default implementation passes the data directly to
+         * @ref set() if @p U is convertible to @p T, otherwise it must be
+         * reimplemented.
+         */
+        virtual void doFinish(ResourceKey key, std::unique_ptr<U> data);
+
+    #ifdef DOXYGEN_GENERATING_OUTPUT
+    private:
+    #endif
+        void doLoad(ResourceKey key) override final;
+
+        void finish(ResourceKey key, std::unique_ptr<U>& data, std::true_type) {
+            this->set(key, data.release());
+        }
+        void finish(ResourceKey, std::unique_ptr<U>&, std::false_type) {
+            CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+        }
+
+        void work();
+
+        std::vector<std::thread> _threads;
+        std::mutex _mutex;
+        std::condition_variable _condition;
+        std::deque<ResourceKey> _queue;
+        std::deque<std::pair<ResourceKey, std::unique_ptr<U>>> _results;
+        std::size_t _pendingCount;
+        bool _stopped;
+};
+
+template<class T, class U> AbstractAsyncResourceLoader<T, U>::AbstractAsyncResourceLoader(const UnsignedInt threadCount): _pendingCount{0}, _stopped{false} {
+    _threads.reserve(threadCount);
+    for(UnsignedInt i = 0; i != threadCount; ++i)
+        _threads.emplace_back(&AbstractAsyncResourceLoader<T, U>::work, this);
+}
+
+template<class T, class U> AbstractAsyncResourceLoader<T, U>::~AbstractAsyncResourceLoader() { stop(); }
+
+template<class T, class U> void AbstractAsyncResourceLoader<T, U>::stop() {
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if(_stopped) return;
+        _stopped = true;
+        _pendingCount -= _queue.size();
+        _queue.clear();
+    }
+
+    _condition.notify_all();
+    for(std::thread& thread: _threads) thread.join();
+}
+
+template<class T, class U> void AbstractAsyncResourceLoader<T, U>::doLoad(const ResourceKey key) {
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if(_stopped) return;
+        _queue.push_back(key);
+    }
+
+    ++_pendingCount;
+    _condition.notify_one();
+}
+
+template<class T, class U> void AbstractAsyncResourceLoader<T, U>::work() {
+    for(;;) {
+        ResourceKey key;
+        {
+            std::unique_lock<std::mutex> lock{_mutex};
+            _condition.wait(lock, [this]() { return _stopped || !_queue.empty(); });
+            if(_stopped) return;
+            key = _queue.front();
+            _queue.pop_front();
+        }
+
+        /* Load outside of the lock so the workers run in parallel */
+        std::unique_ptr<U> data = doLoadAsync(key);
+
+        std::lock_guard<std::mutex> lock{_mutex};
+        _results.emplace_back(key, std::move(data));
+    }
+}
+
+template<class T, class U> std::size_t AbstractAsyncResourceLoader<T, U>::update(const std::chrono::nanoseconds budget) {
+    const auto start = std::chrono::steady_clock::now();
+    std::size_t count = 0;
+
+    do {
+        ResourceKey key;
+        std::unique_ptr<U> data;
+        bool loaded = true;
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            if(!_results.empty()) {
+                key = _results.front().first;
+                data = std::move(_results.front().second);
+                _results.pop_front();
+
+            /* No workers, load the data here */
+            } else if(_threads.empty() && !_queue.empty()) {
+                key = _queue.front();
+                _queue.pop_front();
+                loaded = false;
+            } else break;
+        }
+
+        if(!loaded) data = doLoadAsync(key);
+
+        if(data) doFinish(key, std::move(data));
+        else this->setNotFound(key);
+
+        --_pendingCount;
+        ++count;
+    } while(std::chrono::steady_clock::now() - start < budget);
+
+    return count;
+}
+
+template<class T, class U> void AbstractAsyncResourceLoader<T, U>::doFinish(const ResourceKey key, std::unique_ptr<U> data) {
+    finish(key, data, std::integral_constant<bool, std::is_convertible<U*, T*>::value>{});
+}
+
+}
+
+#endif
@@ -320,6 +320,24 @@ Image2D AbstractFramebuffer::read(const Range2Di& rectangle, Image2D&& image) {
     return std::move(image);
 }
 
+void AbstractFramebuffer::read(const Range2Di& rectangle, PixelStorage storage, const PixelFormat format, const PixelType type, const Containers::ArrayView<char> data) {
+    const ImageView2D view{storage, format, type, rectangle.size()};
+    CORRADE_ASSERT(Implementation::imageDataSizeFor(view, rectangle.size()) <= data.size(),
+        "AbstractFramebuffer::read(): bad data size, got" << data.size() << "but expected at least" << Implementation::imageDataSizeFor(view, rectangle.size()), );
+
+    bindInternal(FramebufferTarget::Read);
+
+    #ifndef MAGNUM_TARGET_GLES2
+    Buffer::unbindInternal(Buffer::TargetHint::PixelPack);
+    #endif
+    storage.applyPack();
+    (Context::current().state().framebuffer->readImplementation)(rectangle, format, type, data.size(), data
+        #ifdef MAGNUM_TARGET_GLES2
+        + Implementation::pixelStorageSkipOffsetFor(view, rectangle.size())
+        #endif
+        );
+}
+
 #ifndef MAGNUM_TARGET_GLES2
 void AbstractFramebuffer::read(const Range2Di& rectangle, BufferImage2D& image, BufferUsage usage) {
     bindInternal(FramebufferTarget::Read);
@@ -331,6 +349,10 @@ void AbstractFramebuffer::read(const Range2Di& rectangle, BufferImage2D& image,
     else
         image.setData(image.storage(), image.format(), image.type(), rectangle.size(), nullptr, usage);
 
+    /* The previous contents get overwritten, no need for the driver to keep
+       them around */
+    image.buffer().invalidateData();
+
     image.buffer().bindInternal(Buffer::TargetHint::PixelPack);
     image.storage().applyPack();
     (Context::current().state().framebuffer->readImplementation)(rectangle, image.format(), image.type(), dataSize, nullptr);
@@ -29,6 +29,7 @@
  * @brief Class @ref Magnum::AbstractFramebuffer, enum @ref Magnum::FramebufferClear, @ref Magnum::FramebufferBlit, @ref Magnum::FramebufferBlitFilter, @ref Magnum::FramebufferTarget, enum set @ref Magnum::FramebufferClearMask
  */
 
+#include <Corrade/Containers/ArrayView.h>
 #include <Corrade/Containers/EnumSet.h>
 #include <Corrade/Utility/Macros.h>
 
@@ -333,6 +334,24 @@ class MAGNUM_EXPORT AbstractFramebuffer {
          */
         Image2D read(const Range2Di& rectangle, Image2D&& image);
 
+        /**
+         * @brief Read block of pixels from framebuffer to existing memory
+         * @param rectangle         Framebuffer rectangle to read
+         * @param storage           Storage of pixel data
+         * @param format            Format of pixel data
+         * @param type              Data type of pixel data
+         * @param data              Memory where to put the data
+         *
+         * Similar to @ref read(const Range2Di&, Image2D&), but reads directly
+         * into user-provided memory, which makes it usable for repeated
+         * readbacks without any allocation. Expects that @p data is large
+         * enough to contain pixels of given @p rectangle with given
+         * @p storage, @p format and @p type.
+         * @see @fn_gl{BindFramebuffer}, then @fn_gl{PixelStore} and
+         *      @fn_gl{ReadPixels} or @fn_gl_extension{ReadnPixels,ARB,robustness}
+         */
+        void read(const Range2Di& rectangle, PixelStorage storage, PixelFormat format, PixelType type, Containers::ArrayView<char> data);
+
         #ifdef MAGNUM_BUILD_DEPRECATED
         /**
          * @copybrief read(const Range2Di&, Image2D&)
@@ -353,6 +372,8 @@ class MAGNUM_EXPORT AbstractFramebuffer {
          * See @ref read(const Vector2i&, const Vector2i&, Image2D&) for more
          * information. The storage is not reallocated if it is large enough to
          * contain the new data, which means that @p usage might get ignored.
+         * See @ref ImageReadbackQueue for a way to retrieve the data without
+         * stalling the pipeline.
          * @requires_gles30 Pixel buffer objects are not available in OpenGL ES
          *      2.0.
          * @requires_webgl20 Pixel buffer objects are not available in WebGL
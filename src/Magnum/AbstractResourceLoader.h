@@ -159,14 +159,14 @@ template<class T> class AbstractResourceLoader {
          * Also increments count of loaded resources. Parameter @p state must
          * be either @ref ResourceDataState::Mutable or
          * @ref ResourceDataState::Final. See @ref ResourceManager::set() for
-         * more information.
+         * more information, including the meaning of @p size.
          * @see @ref loadedCount()
          */
-        void set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy);
+        void set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy, std::size_t size = 0);
 
         /** @overload */
-        template<class U> void set(ResourceKey key, U&& data, ResourceDataState state, ResourcePolicy policy) {
-            set(key, new typename std::decay<U>::type(std::forward<U>(data)), state, policy);
+        template<class U> void set(ResourceKey key, U&& data, ResourceDataState state, ResourcePolicy policy, std::size_t size = 0) {
+            set(key, new typename std::decay<U>::type(std::forward<U>(data)), state, policy, size);
         }
 
         /**
@@ -233,11 +233,11 @@ template<class T> void AbstractResourceLoader<T>::load(ResourceKey key) {
     doLoad(key);
 }
 
-template<class T> void AbstractResourceLoader<T>::set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy) {
+template<class T> void AbstractResourceLoader<T>::set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy, std::size_t size) {
     CORRADE_ASSERT(state == ResourceDataState::Mutable || state == ResourceDataState::Final,
         "AbstractResourceLoader::set(): state must be either Mutable or Final", );
     ++_loadedCount;
-    manager->set(key, data, state, policy);
+    manager->set(key, data, state, policy, size);
 }
 
 template<class T> inline void AbstractResourceLoader<T>::setNotFound(ResourceKey key) {
@@ -25,11 +25,23 @@
 
 #include "AbstractShaderProgram.h"
 
+#include <algorithm>
 #include <Corrade/Containers/Array.h>
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include <chrono>
+#include <Corrade/Utility/Sha1.h>
+#endif
 
+#include "Magnum/CommandObserver.h"
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
 #include "Magnum/Shader.h"
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include "Magnum/ShaderProgramBinaryCache.h"
+#endif
+#ifndef MAGNUM_TARGET_GLES
+#include "Magnum/TextureHandle.h"
+#endif
 #include "Magnum/Math/RectangularMatrix.h"
 
 #ifndef MAGNUM_TARGET_WEBGL
@@ -49,6 +61,45 @@ namespace Implementation {
     bool isProgramLinkLogEmpty(const std::string& result);
 }
 
+namespace {
+    template<class T> void addReflectedName(std::vector<std::pair<UnsignedInt, T>>& table, const char* const name, const std::size_t size, const T value, const bool stripArraySuffix) {
+        table.emplace_back(Implementation::uniformNameHash(name, size), value);
+
+        /* Array uniforms are reported as name[0], but are commonly queried
+           without the suffix as well */
+        if(stripArraySuffix && size > 3 && name[size - 3] == '[' && name[size - 2] == '0' && name[size - 1] == ']')
+            table.emplace_back(Implementation::uniformNameHash(name, size - 3), value);
+    }
+
+    template<class T> void sortReflectedNames(std::vector<std::pair<UnsignedInt, T>>& table) {
+        std::sort(table.begin(), table.end(), [](const std::pair<UnsignedInt, T>& a, const std::pair<UnsignedInt, T>& b) {
+            return a.first < b.first;
+        });
+
+        /* Drop all names whose hashes collide, lookups of these will fall
+           back to the GL query */
+        auto out = table.begin();
+        for(auto it = table.begin(); it != table.end(); ) {
+            auto next = it + 1;
+            while(next != table.end() && next->first == it->first) ++next;
+            if(next - it == 1) *out++ = *it;
+            it = next;
+        }
+        table.erase(out, table.end());
+    }
+
+    template<class T> const std::pair<UnsignedInt, T>* findReflectedName(const std::vector<std::pair<UnsignedInt, T>>& table, const UnsignedInt hash) {
+        const auto found = std::lower_bound(table.begin(), table.end(), hash, [](const std::pair<UnsignedInt, T>& a, const UnsignedInt b) {
+            return a.first < b;
+        });
+        return found != table.end() && found->first == hash ? &*found : nullptr;
+    }
+}
+
+UnsignedLong AbstractShaderProgram::useCount() {
+    return Context::current().state().shaderProgram->useCount;
+}
+
 Int AbstractShaderProgram::maxVertexAttributes() {
     GLint& value = Context::current().state().shaderProgram->maxVertexAttributes;
 
@@ -273,11 +324,22 @@ Int AbstractShaderProgram::maxTexelOffset() {
 }
 #endif
 
-AbstractShaderProgram::AbstractShaderProgram(): _id(glCreateProgram()) {
+AbstractShaderProgram::AbstractShaderProgram(): _id(glCreateProgram())
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    , _binaryCacheLoaded{false}
+    #endif
+{
     CORRADE_INTERNAL_ASSERT(_id != Implementation::State::DisengagedBinding);
 }
 
-AbstractShaderProgram::AbstractShaderProgram(AbstractShaderProgram&& other) noexcept: _id(other._id) {
+AbstractShaderProgram::AbstractShaderProgram(AbstractShaderProgram&& other) noexcept: _id(other._id), _uniformCache{std::move(other._uniformCache)}, _uniformLocations{std::move(other._uniformLocations)}
+    #ifndef MAGNUM_TARGET_GLES2
+    , _uniformBlockIndices{std::move(other._uniformBlockIndices)}
+    #endif
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    , _binaryCacheKey{std::move(other._binaryCacheKey)}, _binaryCacheLoaded{other._binaryCacheLoaded}
+    #endif
+{
     other._id = 0;
 }
 
@@ -289,12 +351,62 @@ AbstractShaderProgram::~AbstractShaderProgram() {
     if(_id) glDeleteProgram(_id);
 }
 
+GLuint AbstractShaderProgram::release() {
+    const GLuint id = _id;
+    _id = 0;
+    return id;
+}
+
 AbstractShaderProgram& AbstractShaderProgram::operator=(AbstractShaderProgram&& other) noexcept {
     using std::swap;
     swap(_id, other._id);
+    swap(_uniformCache, other._uniformCache);
+    swap(_uniformLocations, other._uniformLocations);
+    #ifndef MAGNUM_TARGET_GLES2
+    swap(_uniformBlockIndices, other._uniformBlockIndices);
+    #endif
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    swap(_binaryCacheKey, other._binaryCacheKey);
+    swap(_binaryCacheLoaded, other._binaryCacheLoaded);
+    #endif
+    return *this;
+}
+
+AbstractShaderProgram& AbstractShaderProgram::setUniformCacheEnabled(const bool enabled) {
+    if(!enabled) _uniformCache = nullptr;
+    else if(!_uniformCache) _uniformCache.reset(new Implementation::UniformCache);
     return *this;
 }
 
+UnsignedLong AbstractShaderProgram::uniformCacheHits() const {
+    return _uniformCache ? _uniformCache->hits : 0;
+}
+
+UnsignedLong AbstractShaderProgram::uniformCacheMisses() const {
+    return _uniformCache ? _uniformCache->misses : 0;
+}
+
+bool AbstractShaderProgram::isUniformUploadNeededInternal(const Int location, const void* const data, const std::size_t size) {
+    return _uniformCache->update(location, data, size);
+}
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+ShaderProgramBinaryCache* AbstractShaderProgram::binaryCache() {
+    return Context::current().state().shaderProgram->binaryCache;
+}
+
+void AbstractShaderProgram::setBinaryCache(ShaderProgramBinaryCache* const cache) {
+    if(cache && !ShaderProgramBinaryCache::isSupported()) return;
+    Context::current().state().shaderProgram->binaryCache = cache;
+}
+
+void AbstractShaderProgram::updateBinaryCacheKey(const std::string& data) {
+    /* Don't waste time hashing if there's no cache */
+    if(!Context::current().state().shaderProgram->binaryCache) return;
+    _binaryCacheKey = Utility::Sha1::digest(_binaryCacheKey + data).hexString();
+}
+#endif
+
 #ifndef MAGNUM_TARGET_WEBGL
 std::string AbstractShaderProgram::label() const {
     #ifndef MAGNUM_TARGET_GLES
@@ -341,12 +453,34 @@ void AbstractShaderProgram::dispatchCompute(const Vector3ui& workgroupCount) {
 
 void AbstractShaderProgram::use() {
     /* Use only if the program isn't already in use */
-    GLuint& current = Context::current().state().shaderProgram->current;
-    if(current != _id) glUseProgram(current = _id);
+    Implementation::ShaderProgramState& state = *Context::current().state().shaderProgram;
+    if(CommandObserver* const observer = Context::current().state().commandObserver)
+        observer->record(CommandObserver::Command::ProgramUse, _id, 0, state.current == _id);
+    if(state.current != _id) {
+        ++state.useCount;
+        glUseProgram(state.current = _id);
+    }
 }
 
 void AbstractShaderProgram::attachShader(Shader& shader) {
     glAttachShader(_id, shader.id());
+
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    /* Don't waste time assembling the data if there's no cache */
+    if(!Context::current().state().shaderProgram->binaryCache) return;
+
+    const GLenum type = GLenum(shader.type());
+    std::string data{reinterpret_cast<const char*>(&type), sizeof(GLenum)};
+
+    /* Use precomputed digests instead of the sources where available */
+    auto digest = shader._digests.begin();
+    for(std::size_t i = 0; i != shader._sources.size(); ++i) {
+        if(digest != shader._digests.end() && digest->first == i)
+            data += (digest++)->second;
+        else data += shader._sources[i];
+    }
+    updateBinaryCacheKey(data);
+    #endif
 }
 
 void AbstractShaderProgram::attachShaders(std::initializer_list<std::reference_wrapper<Shader>> shaders) {
@@ -355,20 +489,33 @@ void AbstractShaderProgram::attachShaders(std::initializer_list<std::reference_w
 
 void AbstractShaderProgram::bindAttributeLocationInternal(const UnsignedInt location, const Containers::ArrayView<const char> name) {
     glBindAttribLocation(_id, location, name);
+
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    updateBinaryCacheKey(std::string{reinterpret_cast<const char*>(&location), sizeof(UnsignedInt)} + 'a' + std::string{name, name.size()});
+    #endif
 }
 
 #ifndef MAGNUM_TARGET_GLES
 void AbstractShaderProgram::bindFragmentDataLocationInternal(const UnsignedInt location, const Containers::ArrayView<const char> name) {
     glBindFragDataLocation(_id, location, name);
+    updateBinaryCacheKey(std::string{reinterpret_cast<const char*>(&location), sizeof(UnsignedInt)} + 'f' + std::string{name, name.size()});
 }
 void AbstractShaderProgram::bindFragmentDataLocationIndexedInternal(const UnsignedInt location, UnsignedInt index, const Containers::ArrayView<const char> name) {
     glBindFragDataLocationIndexed(_id, location, index, name);
+    updateBinaryCacheKey(std::string{reinterpret_cast<const char*>(&location), sizeof(UnsignedInt)} + std::string{reinterpret_cast<const char*>(&index), sizeof(UnsignedInt)} + 'i' + std::string{name, name.size()});
 }
 #endif
 
 #ifndef MAGNUM_TARGET_GLES2
 void AbstractShaderProgram::setTransformFeedbackOutputs(const std::initializer_list<std::string> outputs, const TransformFeedbackBufferMode bufferMode) {
     (this->*Context::current().state().shaderProgram->transformFeedbackVaryingsImplementation)({outputs.begin(), outputs.size()}, bufferMode);
+
+    #ifndef MAGNUM_TARGET_WEBGL
+    const GLenum mode = GLenum(bufferMode);
+    std::string data{reinterpret_cast<const char*>(&mode), sizeof(GLenum)};
+    for(const std::string& output: outputs) data += output + '\0';
+    updateBinaryCacheKey(data);
+    #endif
 }
 
 void AbstractShaderProgram::transformFeedbackVaryingsImplementationDefault(const Containers::ArrayView<const std::string> outputs, const TransformFeedbackBufferMode bufferMode) {
@@ -396,16 +543,63 @@ void AbstractShaderProgram::transformFeedbackVaryingsImplementationDanglingWorka
 #endif
 
 bool AbstractShaderProgram::link(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>> shaders) {
-    bool allSuccess = true;
+    submitLink(shaders);
+    return checkLink(shaders);
+}
+
+void AbstractShaderProgram::submitLink(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>> shaders) {
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    ShaderProgramBinaryCache* const binaryCache = Context::current().state().shaderProgram->binaryCache;
+    #endif
+
+    /* Invoke (possibly parallel) linking on all shaders. Linking resets all
+       uniforms to their default values, so the cached values are invalid.
+       The set of active uniforms may change as well, so discard the
+       reflected locations. If there's a binary cache, link only the shaders
+       that weren't loaded from it. */
+    for(AbstractShaderProgram& shader: shaders) {
+        if(shader._uniformCache) shader._uniformCache->values.clear();
+        shader._uniformLocations.clear();
+        #ifndef MAGNUM_TARGET_GLES2
+        shader._uniformBlockIndices.clear();
+        #endif
+
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        shader._binaryCacheLoaded = false;
+        if(binaryCache && !shader._binaryCacheKey.empty()) {
+            if((shader._binaryCacheLoaded = binaryCache->load(shader._id, shader._binaryCacheKey)))
+                continue;
+            glProgramParameteri(shader._id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        }
+        #endif
+
+        glLinkProgram(shader._id);
+    }
+}
 
-    /* Invoke (possibly parallel) linking on all shaders */
-    for(AbstractShaderProgram& shader: shaders) glLinkProgram(shader._id);
+bool AbstractShaderProgram::checkLink(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>> shaders) {
+    bool allSuccess = true;
 
-    /* After linking phase, check status of all shaders */
+    /* Check status of all shaders. As the driver might link the programs in
+       parallel, the time to link each one is only estimated as the time since
+       the previous one finished. */
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    ShaderProgramBinaryCache* const binaryCache = Context::current().state().shaderProgram->binaryCache;
+    auto previousFinished = std::chrono::high_resolution_clock::now();
+    #endif
     Int i = 1;
     for(AbstractShaderProgram& shader: shaders) {
         GLint success, logLength;
         glGetProgramiv(shader._id, GL_LINK_STATUS, &success);
+
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        if(binaryCache && !shader._binaryCacheKey.empty() && !shader._binaryCacheLoaded) {
+            const auto finished = std::chrono::high_resolution_clock::now();
+            if(success) binaryCache->save(shader._id, shader._binaryCacheKey, std::chrono::duration_cast<std::chrono::nanoseconds>(finished - previousFinished).count());
+            previousFinished = finished;
+        }
+        #endif
+
         glGetProgramiv(shader._id, GL_INFO_LOG_LENGTH, &logLength);
 
         /* Error or warning message. The string is returned null-terminated,
@@ -456,7 +650,109 @@ bool AbstractShaderProgram::link(std::initializer_list<std::reference_wrapper<Ab
     return allSuccess;
 }
 
-Int AbstractShaderProgram::uniformLocationInternal(const Containers::ArrayView<const char> name) {
+bool AbstractShaderProgram::isLinkFinished() {
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    /* Programs loaded from the binary cache are finished right away */
+    if(_binaryCacheLoaded) return true;
+    #endif
+
+    #ifndef MAGNUM_TARGET_WEBGL
+    if(Context::current().isExtensionSupported<Extensions::GL::KHR::parallel_shader_compile>()) {
+        GLint finished;
+        glGetProgramiv(_id, GL_COMPLETION_STATUS_KHR, &finished);
+        return finished == GL_TRUE;
+    }
+    #endif
+
+    return true;
+}
+
+void AbstractShaderProgram::reflectUniforms() {
+    _uniformLocations.clear();
+    #ifndef MAGNUM_TARGET_GLES2
+    _uniformBlockIndices.clear();
+    #endif
+
+    #ifndef MAGNUM_TARGET_WEBGL
+    #ifndef MAGNUM_TARGET_GLES
+    if(Context::current().isExtensionSupported<Extensions::GL::ARB::program_interface_query>())
+    #else
+    if(Context::current().isVersionSupported(Version::GLES310))
+    #endif
+    {
+        GLint count, maxNameLength;
+        glGetProgramInterfaceiv(_id, GL_UNIFORM, GL_ACTIVE_RESOURCES, &count);
+        glGetProgramInterfaceiv(_id, GL_UNIFORM, GL_MAX_NAME_LENGTH, &maxNameLength);
+        _uniformLocations.reserve(count);
+
+        Containers::Array<char> name{std::size_t(maxNameLength)};
+        const GLenum property = GL_LOCATION;
+        for(GLint i = 0; i != count; ++i) {
+            GLsizei length;
+            GLint location;
+            glGetProgramResourceName(_id, GL_UNIFORM, i, maxNameLength, &length, name);
+            glGetProgramResourceiv(_id, GL_UNIFORM, i, 1, &property, 1, nullptr, &location);
+
+            /* Uniforms in uniform blocks don't have a location */
+            if(location != -1)
+                addReflectedName(_uniformLocations, name, length, Int(location), true);
+        }
+
+        glGetProgramInterfaceiv(_id, GL_UNIFORM_BLOCK, GL_ACTIVE_RESOURCES, &count);
+        glGetProgramInterfaceiv(_id, GL_UNIFORM_BLOCK, GL_MAX_NAME_LENGTH, &maxNameLength);
+        _uniformBlockIndices.reserve(count);
+
+        name = Containers::Array<char>{std::size_t(maxNameLength)};
+        for(GLint i = 0; i != count; ++i) {
+            GLsizei length;
+            glGetProgramResourceName(_id, GL_UNIFORM_BLOCK, i, maxNameLength, &length, name);
+            addReflectedName(_uniformBlockIndices, name, length, UnsignedInt(i), false);
+        }
+    } else
+    #endif
+    {
+        GLint count, maxNameLength;
+        glGetProgramiv(_id, GL_ACTIVE_UNIFORMS, &count);
+        glGetProgramiv(_id, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+        _uniformLocations.reserve(count);
+
+        Containers::Array<char> name{std::size_t(maxNameLength)};
+        for(GLint i = 0; i != count; ++i) {
+            GLsizei length;
+            GLint size;
+            GLenum type;
+            glGetActiveUniform(_id, i, maxNameLength, &length, &size, &type, name);
+
+            /* The name is null-terminated by glGetActiveUniform() */
+            const GLint location = glGetUniformLocation(_id, name);
+            if(location != -1)
+                addReflectedName(_uniformLocations, name, length, Int(location), true);
+        }
+
+        #ifndef MAGNUM_TARGET_GLES2
+        glGetProgramiv(_id, GL_ACTIVE_UNIFORM_BLOCKS, &count);
+        glGetProgramiv(_id, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &maxNameLength);
+        _uniformBlockIndices.reserve(count);
+
+        name = Containers::Array<char>{std::size_t(maxNameLength)};
+        for(GLint i = 0; i != count; ++i) {
+            GLsizei length;
+            glGetActiveUniformBlockName(_id, i, maxNameLength, &length, name);
+            addReflectedName(_uniformBlockIndices, name, length, UnsignedInt(i), false);
+        }
+        #endif
+    }
+
+    sortReflectedNames(_uniformLocations);
+    #ifndef MAGNUM_TARGET_GLES2
+    sortReflectedNames(_uniformBlockIndices);
+    #endif
+}
+
+Int AbstractShaderProgram::uniformLocationInternal(const UnsignedInt hash, const Containers::ArrayView<const char> name) {
+    if(const std::pair<UnsignedInt, Int>* const found = findReflectedName(_uniformLocations, hash))
+        return found->second;
+
     const GLint location = glGetUniformLocation(_id, name);
     if(location == -1)
         Warning() << "AbstractShaderProgram: location of uniform \'" << Debug::nospace << std::string{name, name.size()} << Debug::nospace << "\' cannot be retrieved";
@@ -464,7 +760,10 @@ Int AbstractShaderProgram::uniformLocationInternal(const Containers::ArrayView<c
 }
 
 #ifndef MAGNUM_TARGET_GLES2
-UnsignedInt AbstractShaderProgram::uniformBlockIndexInternal(const Containers::ArrayView<const char> name) {
+UnsignedInt AbstractShaderProgram::uniformBlockIndexInternal(const UnsignedInt hash, const Containers::ArrayView<const char> name) {
+    if(const std::pair<UnsignedInt, UnsignedInt>* const found = findReflectedName(_uniformBlockIndices, hash))
+        return found->second;
+
     const GLuint index = glGetUniformBlockIndex(_id, name);
     if(index == GL_INVALID_INDEX)
         Warning() << "AbstractShaderProgram: index of uniform block \'" << Debug::nospace << std::string{name, name.size()} << Debug::nospace << "\' cannot be retrieved";
@@ -472,7 +771,16 @@ UnsignedInt AbstractShaderProgram::uniformBlockIndexInternal(const Containers::A
 }
 #endif
 
+#ifndef MAGNUM_TARGET_GLES
+void AbstractShaderProgram::setUniform(const Int location, const TextureHandle& handle) {
+    const UnsignedLong value = handle.handle();
+    if(!isUniformUploadNeeded(location, Containers::ArrayView<const UnsignedLong>{&value, 1})) return;
+    glProgramUniformHandleui64ARB(_id, location, value);
+}
+#endif
+
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Float> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniform1fvImplementation)(location, values.size(), values);
 }
 
@@ -501,6 +809,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 #endif
 
 void AbstractShaderProgram::setUniform(const Int location,  const Containers::ArrayView<const Math::Vector<2, Float>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniform2fvImplementation)(location, values.size(), values);
 }
 
@@ -529,6 +838,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 #endif
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::Vector<3, Float>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniform3fvImplementation)(location, values.size(), values);
 }
 
@@ -557,6 +867,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 #endif
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::Vector<4, Float>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniform4fvImplementation)(location, values.size(), values);
 }
 
@@ -585,6 +896,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 #endif
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Int> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniform1ivImplementation)(location, values.size(), values);
 }
 
@@ -613,6 +925,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 #endif
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::Vector<2, Int>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniform2ivImplementation)(location, values.size(), values);
 }
 
@@ -641,6 +954,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 #endif
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::Vector<3, Int>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniform3ivImplementation)(location, values.size(), values);
 }
 
@@ -669,6 +983,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 #endif
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::Vector<4, Int>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniform4ivImplementation)(location, values.size(), values);
 }
 
@@ -698,6 +1013,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 
 #ifndef MAGNUM_TARGET_GLES2
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const UnsignedInt> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniform1uivImplementation)(location, values.size(), values);
 }
 
@@ -717,6 +1033,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 #endif
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::Vector<2, UnsignedInt>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniform2uivImplementation)(location, values.size(), values);
 }
 
@@ -736,6 +1053,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 #endif
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::Vector<3, UnsignedInt>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniform3uivImplementation)(location, values.size(), values);
 }
 
@@ -755,6 +1073,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 #endif
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::Vector<4, UnsignedInt>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniform4uivImplementation)(location, values.size(), values);
 }
 
@@ -776,6 +1095,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 
 #ifndef MAGNUM_TARGET_GLES
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Double> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniform1dvImplementation)(location, values.size(), values);
 }
 
@@ -793,6 +1113,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT(const GLint location, co
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::Vector<2, Double>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniform2dvImplementation)(location, values.size(), values);
 }
 
@@ -810,6 +1131,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT(const GLint location, co
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::Vector<3, Double>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniform3dvImplementation)(location, values.size(), values);
 }
 
@@ -827,6 +1149,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT(const GLint location, co
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::Vector<4, Double>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniform4dvImplementation)(location, values.size(), values);
 }
 
@@ -845,6 +1168,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT(const GLint location, co
 #endif
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<2, 2, Float>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniformMatrix2fvImplementation)(location, values.size(), values);
 }
 
@@ -873,6 +1197,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 #endif
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<3, 3, Float>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniformMatrix3fvImplementation)(location, values.size(), values);
 }
 
@@ -901,6 +1226,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 #endif
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<4, 4, Float>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniformMatrix4fvImplementation)(location, values.size(), values);
 }
 
@@ -930,6 +1256,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 
 #ifndef MAGNUM_TARGET_GLES2
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<2, 3, Float>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniformMatrix2x3fvImplementation)(location, values.size(), values);
 }
 
@@ -949,6 +1276,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 #endif
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<3, 2, Float>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniformMatrix3x2fvImplementation)(location, values.size(), values);
 }
 
@@ -968,6 +1296,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 #endif
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<2, 4, Float>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniformMatrix2x4fvImplementation)(location, values.size(), values);
 }
 
@@ -987,6 +1316,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 #endif
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<4, 2, Float>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniformMatrix4x2fvImplementation)(location, values.size(), values);
 }
 
@@ -1006,6 +1336,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 #endif
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<3, 4, Float>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniformMatrix3x4fvImplementation)(location, values.size(), values);
 }
 
@@ -1025,6 +1356,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 #endif
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<4, 3, Float>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniformMatrix4x3fvImplementation)(location, values.size(), values);
 }
 
@@ -1046,6 +1378,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 
 #ifndef MAGNUM_TARGET_GLES
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<2, 2, Double>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniformMatrix2dvImplementation)(location, values.size(), values);
 }
 
@@ -1063,6 +1396,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT(const GLint location, co
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<3, 3, Double>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniformMatrix3dvImplementation)(location, values.size(), values);
 }
 
@@ -1080,6 +1414,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT(const GLint location, co
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<4, 4, Double>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniformMatrix4dvImplementation)(location, values.size(), values);
 }
 
@@ -1097,6 +1432,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT(const GLint location, co
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<2, 3, Double>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniformMatrix2x3dvImplementation)(location, values.size(), values);
 }
 
@@ -1114,6 +1450,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT(const GLint location, co
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<3, 2, Double>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniformMatrix3x2dvImplementation)(location, values.size(), values);
 }
 
@@ -1131,6 +1468,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT(const GLint location, co
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<2, 4, Double>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniformMatrix2x4dvImplementation)(location, values.size(), values);
 }
 
@@ -1148,6 +1486,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT(const GLint location, co
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<4, 2, Double>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniformMatrix4x2dvImplementation)(location, values.size(), values);
 }
 
@@ -1165,6 +1504,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT(const GLint location, co
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<3, 4, Double>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniformMatrix3x4dvImplementation)(location, values.size(), values);
 }
 
@@ -1182,6 +1522,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT(const GLint location, co
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const Containers::ArrayView<const Math::RectangularMatrix<4, 3, Double>> values) {
+    if(!isUniformUploadNeeded(location, values)) return;
     (this->*Context::current().state().shaderProgram->uniformMatrix4x3dvImplementation)(location, values.size(), values);
 }
 
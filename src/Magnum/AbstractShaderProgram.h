@@ -30,19 +30,28 @@
  */
 
 #include <functional>
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 #include <Corrade/Containers/ArrayView.h>
 
 #include "Magnum/AbstractObject.h"
 #include "Magnum/Attribute.h"
 
-#if defined(CORRADE_TARGET_WINDOWS) && !defined(MAGNUM_TARGET_GLES2)
-#include <vector>
-#endif
-
 namespace Magnum {
 
-namespace Implementation { struct ShaderProgramState; }
+namespace Implementation {
+    struct ShaderProgramState;
+    struct UniformCache;
+
+    /* FNV-1a hash of uniform and uniform block names. Constexpr so the
+       hash of string literals passed to uniformLocation() can be folded at
+       compile time. */
+    constexpr UnsignedInt uniformNameHash(const char* const name, const std::size_t size, const UnsignedInt hash = 2166136261u) {
+        return size ? uniformNameHash(name + 1, size - 1, (hash ^ UnsignedByte(*name))*16777619u) : hash;
+    }
+}
 
 /**
 @brief Base for shader program implementations
@@ -116,6 +125,15 @@ MyShader& setSpecularTexture(Texture2D& texture) {
     texture.bind(1);
     return *this;
 }
+@endcode
+    If the same group of textures is used for many draws, it's possible to
+    bind them all at once using a @ref TextureSet, which resolves the
+    textures only once and skips texture units that are already bound:
+@code
+MyShader& setTextures(TextureSet& textures) {
+    textures.bind();
+    return *this;
+}
 @endcode
 -   **Transform feedback setup function**, if needed, in which you bind buffers
     to particular indices using @ref TransformFeedback::attachBuffer() and
@@ -514,6 +532,16 @@ class MAGNUM_EXPORT AbstractShaderProgram: public AbstractObject {
          */
         static Int maxVertexAttributes();
 
+        /**
+         * @brief Count of program switches
+         *
+         * Count of @fn_gl{UseProgram} calls since the context creation. Using
+         * a program that is already in use is not counted, as it doesn't
+         * result in any OpenGL call.
+         * @see @ref DebugTools::FrameStatistics
+         */
+        static UnsignedLong useCount();
+
         #ifndef MAGNUM_TARGET_GLES2
         /**
          * @brief Max supported atomic counter buffer size
@@ -687,6 +715,35 @@ class MAGNUM_EXPORT AbstractShaderProgram: public AbstractObject {
         static Int maxTexelOffset();
         #endif
 
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        /**
+         * @brief Current program binary cache
+         *
+         * @see @ref setBinaryCache()
+         * @requires_gles30 Binary program representations are not supported
+         *      in OpenGL ES 2.0 in Magnum.
+         * @requires_gles Binary program representations are not supported
+         *      in WebGL.
+         */
+        static ShaderProgramBinaryCache* binaryCache();
+
+        /**
+         * @brief Set program binary cache
+         *
+         * The cache is then consulted in @ref link() for all shader programs
+         * created after this call in this context. Pass `nullptr` to disable
+         * the caching. If @ref ShaderProgramBinaryCache::isSupported()
+         * returns `false`, the function does nothing. See
+         * @ref ShaderProgramBinaryCache for more information.
+         * @requires_gl41 Extension @extension{ARB,get_program_binary}
+         * @requires_gles30 Binary program representations are not supported
+         *      in OpenGL ES 2.0 in Magnum.
+         * @requires_gles Binary program representations are not supported
+         *      in WebGL.
+         */
+        static void setBinaryCache(ShaderProgramBinaryCache* cache);
+        #endif
+
         /**
          * @brief Constructor
          *
@@ -718,6 +775,91 @@ class MAGNUM_EXPORT AbstractShaderProgram: public AbstractObject {
         /** @brief OpenGL program ID */
         GLuint id() const { return _id; }
 
+        /**
+         * @brief Release OpenGL object
+         *
+         * Releases ownership of OpenGL shader program and returns its ID so
+         * it is not deleted on destruction. The internal state is then
+         * equivalent to moved-from state.
+         * @see @ref ContextRestorer
+         */
+        GLuint release();
+
+        /**
+         * @brief Whether uniform cache is enabled
+         *
+         * @see @ref setUniformCacheEnabled()
+         */
+        bool isUniformCacheEnabled() const { return !!_uniformCache; }
+
+        /**
+         * @brief Count of reflected uniform names
+         *
+         * Count of entries in the table filled by @ref reflectUniforms(),
+         * array uniforms are counted twice (with and without the `[0]`
+         * suffix). Returns `0` if the uniforms weren't reflected since last
+         * @ref link().
+         */
+        std::size_t reflectedUniformCount() const { return _uniformLocations.size(); }
+
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Count of reflected uniform block names
+         *
+         * Returns `0` if the uniforms weren't reflected since last
+         * @ref link().
+         * @see @ref reflectedUniformCount()
+         * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES 2.0.
+         * @requires_webgl20 Uniform buffers are not available in WebGL 1.0.
+         */
+        std::size_t reflectedUniformBlockCount() const { return _uniformBlockIndices.size(); }
+        #endif
+
+        /**
+         * @brief Enable or disable uniform cache
+         * @return Reference to self (for method chaining)
+         *
+         * If enabled, the program remembers the last value uploaded to each
+         * uniform location and @ref setUniform() skips the upload if the
+         * value didn't change since. Useful for programs that get the same
+         * projection matrix or light parameters set before every draw. The
+         * cache is cleared on @ref link(), disabling the cache discards all
+         * remembered values and resets the counters. Disabled by default.
+         * @see @ref uniformCacheHits(), @ref uniformCacheMisses()
+         */
+        AbstractShaderProgram& setUniformCacheEnabled(bool enabled);
+
+        /**
+         * @brief Count of uniform uploads skipped by the cache
+         *
+         * Returns `0` if the cache is not enabled.
+         * @see @ref setUniformCacheEnabled(), @ref uniformCacheMisses()
+         */
+        UnsignedLong uniformCacheHits() const;
+
+        /**
+         * @brief Count of uniform uploads not skipped by the cache
+         *
+         * Returns `0` if the cache is not enabled.
+         * @see @ref setUniformCacheEnabled(), @ref uniformCacheHits()
+         */
+        UnsignedLong uniformCacheMisses() const;
+
+        /**
+         * @brief Whether the linking is finished
+         *
+         * If @extension{KHR,parallel_shader_compile} is supported, returns
+         * `false` while the linking submitted with @ref submitLink() is still
+         * in progress, in which case @ref checkLink() would block. If the
+         * extension is not supported or the program was loaded from a binary
+         * cache, always returns `true`.
+         * @see @fn_gl{GetProgram} with @def_gl{COMPLETION_STATUS_KHR}
+         * @requires_gles Parallel shader compilation is not available in
+         *      WebGL, always returns `true` there.
+         */
+        bool isLinkFinished();
+
         #ifndef MAGNUM_TARGET_WEBGL
         /**
          * @brief Shader program label
@@ -800,12 +942,72 @@ class MAGNUM_EXPORT AbstractShaderProgram: public AbstractObject {
          * @ref Shader::compile() before linking. The operation is batched in a
          * way that allows the driver to link multiple shaders simultaneously
          * (i.e. in multiple threads).
+         *
+         * If a program binary cache is set with @ref setBinaryCache(), the
+         * programs are loaded from the cache where possible and only the
+         * remaining ones are linked and then saved into the cache.
          * @see @fn_gl{LinkProgram}, @fn_gl{GetProgram} with
          *      @def_gl{LINK_STATUS} and @def_gl{INFO_LOG_LENGTH},
-         *      @fn_gl{GetProgramInfoLog}
+         *      @fn_gl{GetProgramInfoLog}, @fn_gl{ProgramBinary},
+         *      @fn_gl{GetProgramBinary}
          */
         static bool link(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>> shaders);
 
+        /**
+         * @brief Submit multiple shaders for linking
+         *
+         * Starts linking of all shaders, but doesn't wait for it to finish.
+         * All attached shaders must be compiled, but it's possible to call
+         * this function while their compilation submitted with
+         * @ref Shader::submitCompile() is still in progress. Use
+         * @ref isLinkFinished() to poll for the completion and
+         * @ref checkLink() to get the result. Calling this function and then
+         * @ref checkLink() is equivalent to @ref link(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>>).
+         *
+         * If @extension{KHR,parallel_shader_compile} is supported, the
+         * driver links the shaders in background threads, so for example a
+         * loading screen can be rendered while dozens of programs build:
+         * @code
+         * class MyShader: public AbstractShaderProgram {
+         *     public:
+         *         explicit MyShader(): _vert{Version::GL330, Shader::Type::Vertex}, _frag{Version::GL330, Shader::Type::Fragment} {
+         *             _vert.addFile("MyShader.vert");
+         *             _frag.addFile("MyShader.frag");
+         *             Shader::submitCompile({_vert, _frag});
+         *             attachShaders({_vert, _frag});
+         *             submitLink({*this});
+         *         }
+         *
+         *         bool finish() {
+         *             return Shader::checkCompile({_vert, _frag}) && checkLink({*this});
+         *         }
+         *
+         *     private:
+         *         Shader _vert, _frag;
+         * };
+         *
+         * MyShader a, b;
+         * while(!a.isLinkFinished() || !b.isLinkFinished()) drawLoadingScreen();
+         * a.finish();
+         * b.finish();
+         * @endcode
+         * @see @fn_gl{LinkProgram}, @fn_gl{ProgramBinary}
+         */
+        static void submitLink(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>> shaders);
+
+        /**
+         * @brief Check linking status of multiple shaders
+         *
+         * Waits until the linking submitted with @ref submitLink() finishes,
+         * returns `false` if linking of any shader failed, `true` if
+         * everything succeeded. Linker message (if any) is printed to error
+         * output.
+         * @see @fn_gl{GetProgram} with @def_gl{LINK_STATUS} and
+         *      @def_gl{INFO_LOG_LENGTH}, @fn_gl{GetProgramInfoLog},
+         *      @fn_gl{GetProgramBinary}
+         */
+        static bool checkLink(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>> shaders);
+
         #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
         /**
          * @brief Allow retrieving program binary
@@ -980,12 +1182,38 @@ class MAGNUM_EXPORT AbstractShaderProgram: public AbstractObject {
          */
         bool link() { return link({*this}); }
 
+        /**
+         * @brief Enumerate active uniforms and uniform blocks
+         *
+         * Queries names and locations of all active uniforms (and indices of
+         * all active uniform blocks) of the linked program in a single pass
+         * and stores them in a compact table sorted by name hash. Subsequent
+         * calls to @ref uniformLocation() and @ref uniformBlockIndex() are
+         * then answered from the table without any GL query, names not found
+         * in it (such as individual array elements) fall back to
+         * @fn_gl{GetUniformLocation} or @fn_gl{GetUniformBlockIndex} as
+         * usual. The table is discarded on next @ref link(). Because it's
+         * built from the linked program, it's equally valid if the program
+         * was loaded from @ref ShaderProgramBinaryCache. Call this once after
+         * a successful link and before the uniform location queries.
+         * @see @ref reflectedUniformCount(),
+         *      @fn_gl{GetProgramInterface}, @fn_gl{GetProgramResourceName},
+         *      @fn_gl{GetProgramResource} with @def_gl{LOCATION} or, if
+         *      @extension{ARB,program_interface_query} (part of OpenGL 4.3) is
+         *      not available, @fn_gl{GetProgram} with
+         *      @def_gl{ACTIVE_UNIFORMS}, @fn_gl{GetActiveUniform} and
+         *      @fn_gl{GetUniformLocation}
+         */
+        void reflectUniforms();
+
         /**
          * @brief Get uniform location
          * @param name          Uniform name
          *
          * If given uniform is not found in the linked shader, a warning is
-         * printed and `-1` is returned.
+         * printed and `-1` is returned. If @ref reflectUniforms() was called
+         * after the link, the location is looked up in the reflected table
+         * first.
          * @see @ref setUniform(), @fn_gl{GetUniformLocation}
          * @deprecated_gl Preferred usage is to specify uniform location
          *      explicitly in the shader instead of using this function. See
@@ -993,12 +1221,12 @@ class MAGNUM_EXPORT AbstractShaderProgram: public AbstractObject {
          *      for more information.
          */
         Int uniformLocation(const std::string& name) {
-            return uniformLocationInternal({name.data(), name.size()});
+            return uniformLocationInternal(Implementation::uniformNameHash(name.data(), name.size()), {name.data(), name.size()});
         }
 
         /** @overload */
         template<std::size_t size> Int uniformLocation(const char(&name)[size]) {
-            return uniformLocationInternal({name, size - 1});
+            return uniformLocationInternal(Implementation::uniformNameHash(name, size - 1), {name, size - 1});
         }
 
         #ifndef MAGNUM_TARGET_GLES2
@@ -1007,7 +1235,9 @@ class MAGNUM_EXPORT AbstractShaderProgram: public AbstractObject {
          * @param name          Uniform block name
          *
          * If given uniform block name is not found in the linked shader, a
-         * warning is printed and `0xffffffffu` is returned.
+         * warning is printed and `0xffffffffu` is returned. If
+         * @ref reflectUniforms() was called after the link, the index is
+         * looked up in the reflected table first.
          * @see @ref setUniformBlockBinding(), @fn_gl{GetUniformBlockIndex}
          * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
          * @requires_gles30 Uniform buffers are not available in OpenGL ES 2.0.
@@ -1018,12 +1248,12 @@ class MAGNUM_EXPORT AbstractShaderProgram: public AbstractObject {
          *      for more information.
          */
         UnsignedInt uniformBlockIndex(const std::string& name) {
-            return uniformBlockIndexInternal({name.data(), name.size()});
+            return uniformBlockIndexInternal(Implementation::uniformNameHash(name.data(), name.size()), {name.data(), name.size()});
         }
 
         /** @overload */
         template<std::size_t size> UnsignedInt uniformBlockIndex(const char(&name)[size]) {
-            return uniformBlockIndexInternal({name, size - 1});
+            return uniformBlockIndexInternal(Implementation::uniformNameHash(name, size - 1), {name, size - 1});
         }
         #endif
 
@@ -1161,6 +1391,25 @@ class MAGNUM_EXPORT AbstractShaderProgram: public AbstractObject {
         }
         #endif
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Set bindless texture handle uniform
+         * @param location      Uniform location
+         * @param handle        Texture handle
+         *
+         * The uniform has to be a sampler, declared with
+         * `layout(bindless_sampler)`. Unlike with @ref setUniform(Int, Int),
+         * the texture doesn't need to be bound to any texture unit. The
+         * program doesn't need to be in use.
+         * @see @ref TextureHandle,
+         *      @fn_gl_extension{ProgramUniformHandleui64,ARB,bindless_texture}
+         * @requires_extension Extension @extension{ARB,bindless_texture}
+         * @requires_gl Bindless textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        void setUniform(Int location, const TextureHandle& handle);
+        #endif
+
         #ifndef MAGNUM_TARGET_GLES2
         /**
          * @brief Set uniform block binding
@@ -1190,8 +1439,17 @@ class MAGNUM_EXPORT AbstractShaderProgram: public AbstractObject {
         void bindAttributeLocationInternal(UnsignedInt location, Containers::ArrayView<const char> name);
         void bindFragmentDataLocationIndexedInternal(UnsignedInt location, UnsignedInt index, Containers::ArrayView<const char> name);
         void bindFragmentDataLocationInternal(UnsignedInt location, Containers::ArrayView<const char> name);
-        Int uniformLocationInternal(Containers::ArrayView<const char> name);
-        UnsignedInt uniformBlockIndexInternal(Containers::ArrayView<const char> name);
+        Int uniformLocationInternal(UnsignedInt hash, Containers::ArrayView<const char> name);
+        UnsignedInt uniformBlockIndexInternal(UnsignedInt hash, Containers::ArrayView<const char> name);
+
+        template<class T> bool isUniformUploadNeeded(Int location, Containers::ArrayView<const T> values) {
+            return !_uniformCache || isUniformUploadNeededInternal(location, values.data(), values.size()*sizeof(T));
+        }
+        bool isUniformUploadNeededInternal(Int location, const void* data, std::size_t size);
+
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        void updateBinaryCacheKey(const std::string& data);
+        #endif
 
         #ifndef MAGNUM_TARGET_GLES2
         void MAGNUM_LOCAL transformFeedbackVaryingsImplementationDefault(Containers::ArrayView<const std::string> outputs, TransformFeedbackBufferMode bufferMode);
@@ -1358,6 +1616,19 @@ class MAGNUM_EXPORT AbstractShaderProgram: public AbstractObject {
         #endif
 
         GLuint _id;
+        std::unique_ptr<Implementation::UniformCache> _uniformCache;
+        /* Name hash and location / index pairs filled by reflectUniforms(),
+           sorted by the hash */
+        std::vector<std::pair<UnsignedInt, Int>> _uniformLocations;
+        #ifndef MAGNUM_TARGET_GLES2
+        std::vector<std::pair<UnsignedInt, UnsignedInt>> _uniformBlockIndices;
+        #endif
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        /* Hash of everything that affects the linked binary, empty if
+           there's no program binary cache */
+        std::string _binaryCacheKey;
+        bool _binaryCacheLoaded;
+        #endif
 
         #if defined(CORRADE_TARGET_WINDOWS) && !defined(MAGNUM_TARGET_GLES2)
         /* Needed for the nv-windows-dangling-transform-feedback-varying-names
@@ -31,6 +31,7 @@
 #include "Magnum/BufferImage.h"
 #endif
 #include "Magnum/Array.h"
+#include "Magnum/CommandObserver.h"
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
 #include "Magnum/Image.h"
@@ -42,11 +43,57 @@
 #ifndef MAGNUM_TARGET_WEBGL
 #include "Implementation/DebugState.h"
 #endif
+#include "Implementation/GpuMemoryState.h"
 #include "Implementation/State.h"
 #include "Implementation/TextureState.h"
 
 namespace Magnum {
 
+namespace {
+
+/* Estimated size of given level of an uncompressed or compressed image */
+template<std::size_t dimensions> std::size_t levelDataSize(const GLenum target, const TextureFormat internalFormat, const Math::Vector<dimensions, GLsizei>& size, const GLsizei level) {
+    /* Array texture is not scaled in "layer" dimension */
+    bool layered = false;
+    #ifndef MAGNUM_TARGET_GLES
+    if(target == GL_TEXTURE_1D_ARRAY || target == GL_TEXTURE_CUBE_MAP_ARRAY)
+        layered = true;
+    #endif
+    #ifndef MAGNUM_TARGET_GLES2
+    if(target == GL_TEXTURE_2D_ARRAY)
+        layered = true;
+    #endif
+    #ifdef MAGNUM_TARGET_GLES
+    static_cast<void>(target);
+    #endif
+
+    std::size_t pixelCount = 1;
+    for(std::size_t i = 0; i != dimensions; ++i)
+        pixelCount *= layered && i == dimensions - 1 ? size[i] : Math::max(size[i] >> level, 1);
+    return pixelCount*Implementation::textureFormatBits(GLenum(internalFormat))/8;
+}
+
+template<std::size_t dimensions> void setStorageGpuMemory(AbstractTexture& texture, const GLenum target, const GLsizei levels, const TextureFormat internalFormat, const Math::Vector<dimensions, GLsizei>& size, const GLsizei samples = 1) {
+    std::size_t dataSize = 0;
+    for(GLsizei level = 0; level != levels; ++level)
+        dataSize += levelDataSize(target, internalFormat, size, level);
+    if(target == GL_TEXTURE_CUBE_MAP) dataSize *= 6;
+
+    Context::current().state().gpuMemory->setSize(GpuMemory::Category::Texture, texture.id(), dataSize*samples);
+}
+
+void setImageGpuMemory(AbstractTexture& texture, const GLenum target, const GLint level, const std::size_t dataSize) {
+    /* Each cube map face is tracked separately */
+    const std::size_t face = target >= GL_TEXTURE_CUBE_MAP_POSITIVE_X && target <= GL_TEXTURE_CUBE_MAP_NEGATIVE_Z ? target - GL_TEXTURE_CUBE_MAP_POSITIVE_X : 0;
+    Context::current().state().gpuMemory->setSize(GpuMemory::Category::Texture, texture.id(), level*8 + face, dataSize);
+}
+
+}
+
+UnsignedLong AbstractTexture::bindCount() {
+    return Context::current().state().texture->bindCount;
+}
+
 #ifndef MAGNUM_TARGET_GLES2
 Float AbstractTexture::maxLodBias() {
     GLfloat& value = Context::current().state().texture->maxLodBias;
@@ -178,8 +225,10 @@ void AbstractTexture::bindImplementationMulti(const GLint firstTextureUnit, Cont
     /** @todo VLAs */
     Containers::Array<GLuint> ids{textures ? textures.size() : 0};
     bool different = false;
+    CommandObserver* const observer = Context::current().state().commandObserver;
     for(std::size_t i = 0; i != textures.size(); ++i) {
         const GLuint id = textures && textures[i] ? textures[i]->_id : 0;
+        if(observer) observer->record(CommandObserver::Command::TextureBind, id, firstTextureUnit + i, textureState.bindings[firstTextureUnit + i].second == id);
 
         if(textures) {
             if(textures[i]) textures[i]->createIfNotAlready();
@@ -188,6 +237,7 @@ void AbstractTexture::bindImplementationMulti(const GLint firstTextureUnit, Cont
 
         if(textureState.bindings[firstTextureUnit + i].second != id) {
             different = true;
+            ++textureState.bindCount;
             textureState.bindings[firstTextureUnit + i].second = id;
         }
     }
@@ -212,6 +262,24 @@ Int AbstractTexture::compressedBlockDataSizeImplementationBitsWorkaround(const G
     /* NVidia (358.16) reports the value in bits instead of bytes */
     return compressedBlockDataSizeImplementationDefault(target, format)/8;
 }
+
+Int AbstractTexture::virtualPageSizeCount(const GLenum target, const TextureFormat format) {
+    GLint value;
+    glGetInternalformativ(target, GLenum(format), GL_NUM_VIRTUAL_PAGE_SIZES_ARB, 1, &value);
+    return value;
+}
+
+Vector3i AbstractTexture::virtualPageSize(const GLenum target, const TextureFormat format, const Int index) {
+    const Int count = virtualPageSizeCount(target, format);
+    CORRADE_ASSERT(index < count,
+        "AbstractTexture::virtualPageSize(): index" << index << "out of range for" << count << "page sizes", {});
+
+    Containers::Array<GLint> x{std::size_t(count)}, y{std::size_t(count)}, z{std::size_t(count)};
+    glGetInternalformativ(target, GLenum(format), GL_VIRTUAL_PAGE_SIZE_X_ARB, count, x);
+    glGetInternalformativ(target, GLenum(format), GL_VIRTUAL_PAGE_SIZE_Y_ARB, count, y);
+    glGetInternalformativ(target, GLenum(format), GL_VIRTUAL_PAGE_SIZE_Z_ARB, count, z);
+    return {x[index], y[index], z[index]};
+}
 #endif
 
 AbstractTexture::AbstractTexture(GLenum target): _target{target}, _flags{ObjectFlag::DeleteOnDestruction} {
@@ -248,6 +316,7 @@ AbstractTexture::~AbstractTexture() {
     }
     #endif
 
+    Context::current().state().gpuMemory->remove(GpuMemory::Category::Texture, _id);
     glDeleteTextures(1, &_id);
 }
 
@@ -272,6 +341,7 @@ std::string AbstractTexture::label() {
 AbstractTexture& AbstractTexture::setLabelInternal(const Containers::ArrayView<const char> label) {
     createIfNotAlready();
     Context::current().state().debug->labelImplementation(GL_TEXTURE, _id, label);
+    Context::current().state().gpuMemory->setLabel(GpuMemory::Category::Texture, _id, {label.data(), label.size()});
     return *this;
 }
 #endif
@@ -335,11 +405,15 @@ void AbstractTexture::bindImageInternal(const Int imageUnit, const Int level, co
 void AbstractTexture::bind(Int textureUnit) {
     Implementation::TextureState& textureState = *Context::current().state().texture;
 
+    if(CommandObserver* const observer = Context::current().state().commandObserver)
+        observer->record(CommandObserver::Command::TextureBind, _id, textureUnit, textureState.bindings[textureUnit].second == _id);
+
     /* If already bound in given texture unit, nothing to do */
     if(textureState.bindings[textureUnit].second == _id) return;
 
     /* Update state tracker, bind the texture to the unit */
     textureState.bindings[textureUnit] = {_target, _id};
+    ++textureState.bindCount;
     (this->*textureState.bindImplementation)(textureUnit);
 }
 
@@ -372,6 +446,28 @@ void AbstractTexture::bindImplementationDSAEXT(GLint textureUnit) {
 #endif
 
 #ifndef MAGNUM_TARGET_GLES2
+#ifndef MAGNUM_TARGET_GLES
+void AbstractTexture::setSparse(const bool sparse) {
+    (this->*Context::current().state().texture->parameteriImplementation)(GL_TEXTURE_SPARSE_ARB, sparse);
+}
+
+void AbstractTexture::setVirtualPageSizeIndex(const Int index) {
+    (this->*Context::current().state().texture->parameteriImplementation)(GL_VIRTUAL_PAGE_SIZE_INDEX_ARB, index);
+}
+
+Int AbstractTexture::sparseLevelCount() {
+    bindInternal();
+    GLint value;
+    glGetTexParameteriv(_target, GL_NUM_SPARSE_LEVELS_ARB, &value);
+    return value;
+}
+
+void AbstractTexture::pageCommitmentInternal(const GLint level, const Vector3i& offset, const Vector3i& size, const bool commit) {
+    bindInternal();
+    glTexPageCommitmentARB(_target, level, offset.x(), offset.y(), offset.z(), size.x(), size.y(), size.z(), commit);
+}
+#endif
+
 void AbstractTexture::setBaseLevel(Int level) {
     (this->*Context::current().state().texture->parameteriImplementation)(GL_TEXTURE_BASE_LEVEL, level);
 }
@@ -1601,6 +1697,10 @@ template<UnsignedInt dimensions> void AbstractTexture::image(GLint level, Buffer
     else
         image.setData(image.storage(), image.format(), image.type(), size, nullptr, usage);
 
+    /* The previous contents get overwritten, no need for the driver to keep
+       them around */
+    image.buffer().invalidateData();
+
     image.buffer().bindInternal(Buffer::TargetHint::PixelPack);
     image.storage().applyPack();
     (this->*Context::current().state().texture->getImageImplementation)(level, image.format(), image.type(), dataSize, nullptr);
@@ -1610,6 +1710,20 @@ template void MAGNUM_EXPORT AbstractTexture::image<1>(GLint, BufferImage<1>&, Bu
 template void MAGNUM_EXPORT AbstractTexture::image<2>(GLint, BufferImage<2>&, BufferUsage);
 template void MAGNUM_EXPORT AbstractTexture::image<3>(GLint, BufferImage<3>&, BufferUsage);
 
+template<UnsignedInt dimensions> void AbstractTexture::image(GLint level, PixelStorage storage, const PixelFormat format, const PixelType type, const Containers::ArrayView<char> data) {
+    const Math::Vector<dimensions, Int> size = DataHelper<dimensions>::imageSize(*this, level);
+    CORRADE_ASSERT(Implementation::imageDataSizeFor(ImageView<dimensions>{storage, format, type, size}, size) <= data.size(),
+        "AbstractTexture::image(): bad data size, got" << data.size() << "but expected at least" << Implementation::imageDataSizeFor(ImageView<dimensions>{storage, format, type, size}, size), );
+
+    Buffer::unbindInternal(Buffer::TargetHint::PixelPack);
+    storage.applyPack();
+    (this->*Context::current().state().texture->getImageImplementation)(level, format, type, data.size(), data);
+}
+
+template void MAGNUM_EXPORT AbstractTexture::image<1>(GLint, PixelStorage, PixelFormat, PixelType, Containers::ArrayView<char>);
+template void MAGNUM_EXPORT AbstractTexture::image<2>(GLint, PixelStorage, PixelFormat, PixelType, Containers::ArrayView<char>);
+template void MAGNUM_EXPORT AbstractTexture::image<3>(GLint, PixelStorage, PixelFormat, PixelType, Containers::ArrayView<char>);
+
 template<UnsignedInt dimensions> void AbstractTexture::compressedImage(const GLint level, CompressedImage<dimensions>& image) {
     const Math::Vector<dimensions, Int> size = DataHelper<dimensions>::imageSize(*this, level);
     GLint textureDataSize;
@@ -1693,6 +1807,10 @@ template<UnsignedInt dimensions> void AbstractTexture::subImage(const GLint leve
     else
         image.setData(image.storage(), image.format(), image.type(), size, nullptr, usage);
 
+    /* The previous contents get overwritten, no need for the driver to keep
+       them around */
+    image.buffer().invalidateData();
+
     image.buffer().bindInternal(Buffer::TargetHint::PixelPack);
     image.storage().applyPack();
     glGetTextureSubImage(_id, level, paddedOffset.x(), paddedOffset.y(), paddedOffset.z(), paddedSize.x(), paddedSize.y(), paddedSize.z(), GLenum(image.format()), GLenum(image.type()), dataSize, nullptr);
@@ -1777,6 +1895,22 @@ Vector2i AbstractTexture::DataHelper<2>::compressedBlockSize(const GLenum target
     return value;
 }
 
+Vector2i AbstractTexture::DataHelper<2>::virtualPageSize(const GLenum target, const TextureFormat format, const Int index) {
+    return AbstractTexture::virtualPageSize(target, format, index).xy();
+}
+
+void AbstractTexture::DataHelper<2>::pageCommitment(AbstractTexture& texture, const GLint level, const Range2Di& range, const bool commit) {
+    texture.pageCommitmentInternal(level, {range.min(), 0}, {range.size(), 1}, commit);
+}
+
+Vector3i AbstractTexture::DataHelper<3>::virtualPageSize(const GLenum target, const TextureFormat format, const Int index) {
+    return AbstractTexture::virtualPageSize(target, format, index);
+}
+
+void AbstractTexture::DataHelper<3>::pageCommitment(AbstractTexture& texture, const GLint level, const Range3Di& range, const bool commit) {
+    texture.pageCommitmentInternal(level, range.min(), range.size(), commit);
+}
+
 Vector3i AbstractTexture::DataHelper<3>::compressedBlockSize(const GLenum target, const TextureFormat format) {
     /** @todo use real value when OpenGL has proper queries for 3D compression formats */
     return Vector3i{DataHelper<2>::compressedBlockSize(target, format), 1};
@@ -1815,26 +1949,31 @@ Vector3i AbstractTexture::DataHelper<3>::imageSize(AbstractTexture& texture, con
 #ifndef MAGNUM_TARGET_GLES
 void AbstractTexture::DataHelper<1>::setStorage(AbstractTexture& texture, const GLsizei levels, const TextureFormat internalFormat, const Math::Vector< 1, GLsizei >& size) {
     (texture.*Context::current().state().texture->storage1DImplementation)(levels, internalFormat, size);
+    setStorageGpuMemory(texture, texture._target, levels, internalFormat, size);
 }
 #endif
 
 void AbstractTexture::DataHelper<2>::setStorage(AbstractTexture& texture, const GLsizei levels, const TextureFormat internalFormat, const Vector2i& size) {
     (texture.*Context::current().state().texture->storage2DImplementation)(levels, internalFormat, size);
+    setStorageGpuMemory(texture, texture._target, levels, internalFormat, size);
 }
 
 #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
 void AbstractTexture::DataHelper<3>::setStorage(AbstractTexture& texture, const GLsizei levels, const TextureFormat internalFormat, const Vector3i& size) {
     (texture.*Context::current().state().texture->storage3DImplementation)(levels, internalFormat, size);
+    setStorageGpuMemory(texture, texture._target, levels, internalFormat, size);
 }
 #endif
 
 #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
 void AbstractTexture::DataHelper<2>::setStorageMultisample(AbstractTexture& texture, const GLsizei samples, const TextureFormat internalFormat, const Vector2i& size, const GLboolean fixedSampleLocations) {
     (texture.*Context::current().state().texture->storage2DMultisampleImplementation)(samples, internalFormat, size, fixedSampleLocations);
+    setStorageGpuMemory(texture, texture._target, 1, internalFormat, size, samples);
 }
 
 void AbstractTexture::DataHelper<3>::setStorageMultisample(AbstractTexture& texture, const GLsizei samples, const TextureFormat internalFormat, const Vector3i& size, const GLboolean fixedSampleLocations) {
     (texture.*Context::current().state().texture->storage3DMultisampleImplementation)(samples, internalFormat, size, fixedSampleLocations);
+    setStorageGpuMemory(texture, texture._target, 1, internalFormat, size, samples);
 }
 #endif
 
@@ -1844,6 +1983,7 @@ void AbstractTexture::DataHelper<1>::setImage(AbstractTexture& texture, const GL
     image.storage().applyUnpack();
     texture.bindInternal();
     glTexImage1D(texture._target, level, GLint(internalFormat), image.size()[0], 0, GLenum(image.format()), GLenum(image.type()), image.data());
+    setImageGpuMemory(texture, texture._target, level, levelDataSize(texture._target, internalFormat, image.size(), 0));
 }
 
 void AbstractTexture::DataHelper<1>::setCompressedImage(AbstractTexture& texture, const GLint level, const CompressedImageView1D& image) {
@@ -1851,6 +1991,7 @@ void AbstractTexture::DataHelper<1>::setCompressedImage(AbstractTexture& texture
     image.storage().applyUnpack();
     texture.bindInternal();
     glCompressedTexImage1D(texture._target, level, GLenum(image.format()), image.size()[0], 0, Implementation::occupiedCompressedImageDataSize(image, image.data().size()), image.data());
+    setImageGpuMemory(texture, texture._target, level, Implementation::occupiedCompressedImageDataSize(image, image.data().size()));
 }
 
 void AbstractTexture::DataHelper<1>::setImage(AbstractTexture& texture, const GLint level, const TextureFormat internalFormat, BufferImage1D& image) {
@@ -1858,6 +1999,7 @@ void AbstractTexture::DataHelper<1>::setImage(AbstractTexture& texture, const GL
     image.storage().applyUnpack();
     texture.bindInternal();
     glTexImage1D(texture._target, level, GLint(internalFormat), image.size()[0], 0, GLenum(image.format()), GLenum(image.type()), nullptr);
+    setImageGpuMemory(texture, texture._target, level, levelDataSize(texture._target, internalFormat, image.size(), 0));
 }
 
 void AbstractTexture::DataHelper<1>::setCompressedImage(AbstractTexture& texture, const GLint level, CompressedBufferImage1D& image) {
@@ -1865,6 +2007,7 @@ void AbstractTexture::DataHelper<1>::setCompressedImage(AbstractTexture& texture
     image.storage().applyUnpack();
     texture.bindInternal();
     glCompressedTexImage1D(texture._target, level, GLenum(image.format()), image.size()[0], 0, Implementation::occupiedCompressedImageDataSize(image, image.dataSize()), nullptr);
+    setImageGpuMemory(texture, texture._target, level, Implementation::occupiedCompressedImageDataSize(image, image.dataSize()));
 }
 
 void AbstractTexture::DataHelper<1>::setSubImage(AbstractTexture& texture, const GLint level, const Math::Vector<1, GLint>& offset, const ImageView1D& image) {
@@ -1903,6 +2046,7 @@ void AbstractTexture::DataHelper<2>::setImage(AbstractTexture& texture, const GL
         + Implementation::pixelStorageSkipOffset(image)
         #endif
         );
+    setImageGpuMemory(texture, target, level, levelDataSize(target, internalFormat, image.size(), 0));
 }
 
 void AbstractTexture::DataHelper<2>::setCompressedImage(AbstractTexture& texture, const GLenum target, const GLint level, const CompressedImageView2D& image) {
@@ -1916,6 +2060,7 @@ void AbstractTexture::DataHelper<2>::setCompressedImage(AbstractTexture& texture
     #endif
     texture.bindInternal();
     glCompressedTexImage2D(target, level, GLenum(image.format()), image.size().x(), image.size().y(), 0, Implementation::occupiedCompressedImageDataSize(image, image.data().size()), image.data());
+    setImageGpuMemory(texture, target, level, Implementation::occupiedCompressedImageDataSize(image, image.data().size()));
 }
 
 #ifndef MAGNUM_TARGET_GLES2
@@ -1924,6 +2069,7 @@ void AbstractTexture::DataHelper<2>::setImage(AbstractTexture& texture, const GL
     image.storage().applyUnpack();
     texture.bindInternal();
     glTexImage2D(target, level, GLint(internalFormat), image.size().x(), image.size().y(), 0, GLenum(image.format()), GLenum(image.type()), nullptr);
+    setImageGpuMemory(texture, target, level, levelDataSize(target, internalFormat, image.size(), 0));
 }
 
 void AbstractTexture::DataHelper<2>::setCompressedImage(AbstractTexture& texture, const GLenum target, const GLint level, CompressedBufferImage2D& image) {
@@ -1935,6 +2081,7 @@ void AbstractTexture::DataHelper<2>::setCompressedImage(AbstractTexture& texture
     #endif
     texture.bindInternal();
     glCompressedTexImage2D(target, level, GLenum(image.format()), image.size().x(), image.size().y(), 0, Implementation::occupiedCompressedImageDataSize(image, image.dataSize()), nullptr);
+    setImageGpuMemory(texture, target, level, Implementation::occupiedCompressedImageDataSize(image, image.dataSize()));
 }
 #endif
 
@@ -1997,6 +2144,7 @@ void AbstractTexture::DataHelper<3>::setImage(AbstractTexture& texture, const GL
     static_cast<void>(image);
     CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
     #endif
+    setImageGpuMemory(texture, texture._target, level, levelDataSize(texture._target, internalFormat, image.size(), 0));
 }
 
 void AbstractTexture::DataHelper<3>::setCompressedImage(AbstractTexture& texture, const GLint level, const CompressedImageView3D& image) {
@@ -2018,6 +2166,7 @@ void AbstractTexture::DataHelper<3>::setCompressedImage(AbstractTexture& texture
     static_cast<void>(image);
     CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
     #endif
+    setImageGpuMemory(texture, texture._target, level, Implementation::occupiedCompressedImageDataSize(image, image.data().size()));
 }
 #endif
 
@@ -2027,6 +2176,7 @@ void AbstractTexture::DataHelper<3>::setImage(AbstractTexture& texture, const GL
     image.storage().applyUnpack();
     texture.bindInternal();
     glTexImage3D(texture._target, level, GLint(internalFormat), image.size().x(), image.size().y(), image.size().z(), 0, GLenum(image.format()), GLenum(image.type()), nullptr);
+    setImageGpuMemory(texture, texture._target, level, levelDataSize(texture._target, internalFormat, image.size(), 0));
 }
 
 void AbstractTexture::DataHelper<3>::setCompressedImage(AbstractTexture& texture, const GLint level, CompressedBufferImage3D& image) {
@@ -2038,6 +2188,7 @@ void AbstractTexture::DataHelper<3>::setCompressedImage(AbstractTexture& texture
     #endif
     texture.bindInternal();
     glCompressedTexImage3D(texture._target, level, GLenum(image.format()), image.size().x(), image.size().y(), image.size().z(), 0, Implementation::occupiedCompressedImageDataSize(image, image.dataSize()), nullptr);
+    setImageGpuMemory(texture, texture._target, level, Implementation::occupiedCompressedImageDataSize(image, image.dataSize()));
 }
 #endif
 
@@ -135,8 +135,22 @@ class MAGNUM_EXPORT AbstractTexture: public AbstractObject {
     friend Implementation::TextureState;
     friend AbstractFramebuffer;
     friend CubeMapTexture;
+    #ifndef MAGNUM_TARGET_GLES
+    friend TextureHandle;
+    #endif
+    friend TextureSet;
 
     public:
+        /**
+         * @brief Count of texture binds
+         *
+         * Count of texture unit binding changes done by @ref bind() since the
+         * context creation. Binding a texture that is already bound in given
+         * unit is not counted, as it doesn't result in any OpenGL call.
+         * @see @ref DebugTools::FrameStatistics
+         */
+        static UnsignedLong bindCount();
+
         #ifndef MAGNUM_TARGET_GLES2
         /**
          * @brief Max level-of-detail bias
@@ -407,6 +421,8 @@ class MAGNUM_EXPORT AbstractTexture: public AbstractObject {
 
         #ifndef MAGNUM_TARGET_GLES
         static Int compressedBlockDataSize(GLenum target, TextureFormat format);
+        static Int virtualPageSizeCount(GLenum target, TextureFormat format);
+        static Vector3i virtualPageSize(GLenum target, TextureFormat format, Int index);
         #endif
 
         #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
@@ -477,9 +493,17 @@ class MAGNUM_EXPORT AbstractTexture: public AbstractObject {
         void invalidateImage(Int level);
         void generateMipmap();
 
+        #ifndef MAGNUM_TARGET_GLES
+        void setSparse(bool sparse);
+        void setVirtualPageSizeIndex(Int index);
+        Int sparseLevelCount();
+        void pageCommitmentInternal(GLint level, const Vector3i& offset, const Vector3i& size, bool commit);
+        #endif
+
         #ifndef MAGNUM_TARGET_GLES
         template<UnsignedInt dimensions> void image(GLint level, Image<dimensions>& image);
         template<UnsignedInt dimensions> void image(GLint level, BufferImage<dimensions>& image, BufferUsage usage);
+        template<UnsignedInt dimensions> void image(GLint level, PixelStorage storage, PixelFormat format, PixelType type, Containers::ArrayView<char> data);
         template<UnsignedInt dimensions> void compressedImage(GLint level, CompressedImage<dimensions>& image);
         template<UnsignedInt dimensions> void compressedImage(GLint level, CompressedBufferImage<dimensions>& image, BufferUsage usage);
         template<UnsignedInt dimensions> void subImage(GLint level, const RangeTypeFor<dimensions, Int>& range, Image<dimensions>& image);
@@ -697,6 +721,8 @@ template<> struct MAGNUM_EXPORT AbstractTexture::DataHelper<1> {
 template<> struct MAGNUM_EXPORT AbstractTexture::DataHelper<2> {
     #ifndef MAGNUM_TARGET_GLES
     static Vector2i compressedBlockSize(GLenum target, TextureFormat format);
+    static Vector2i virtualPageSize(GLenum target, TextureFormat format, Int index);
+    static void pageCommitment(AbstractTexture& texture, GLint level, const Range2Di& range, bool commit);
     #endif
     #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
     static Vector2i imageSize(AbstractTexture& texture, GLint level);
@@ -742,6 +768,8 @@ template<> struct MAGNUM_EXPORT AbstractTexture::DataHelper<3> {
     #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
     #ifndef MAGNUM_TARGET_GLES
     static Vector3i compressedBlockSize(GLenum target, TextureFormat format);
+    static Vector3i virtualPageSize(GLenum target, TextureFormat format, Int index);
+    static void pageCommitment(AbstractTexture& texture, GLint level, const Range3Di& range, bool commit);
     #endif
     #ifndef MAGNUM_TARGET_GLES2
     static Vector3i imageSize(AbstractTexture& texture, GLint level);
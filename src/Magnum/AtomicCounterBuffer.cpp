@@ -0,0 +1,145 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "AtomicCounterBuffer.h"
+
+#include <cstring>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Renderer.h"
+
+namespace Magnum {
+
+AtomicCounterBuffer::AtomicCounterBuffer(const UnsignedInt counterCount, const UnsignedInt readbackCount): _values{Containers::ValueInit, counterCount}, _buffer{Buffer::TargetHint::AtomicCounter}, _fences(readbackCount),
+    #ifndef MAGNUM_TARGET_GLES
+    _sync{Context::current().isExtensionSupported<Extensions::GL::ARB::sync>()},
+    #else
+    _sync{true},
+    #endif
+    _current{readbackCount - 1}, _pendingCount{}, _waitCount{}
+{
+    CORRADE_ASSERT(counterCount && readbackCount,
+        "AtomicCounterBuffer: expected non-zero counter and readback count", );
+
+    _buffer.setData(_values, BufferUsage::DynamicCopy);
+
+    _readbacks.reserve(readbackCount);
+    for(UnsignedInt i = 0; i != readbackCount; ++i) {
+        _readbacks.emplace_back(Buffer::TargetHint::CopyWrite);
+        _readbacks.back().setData({nullptr, counterCount*sizeof(UnsignedInt)}, BufferUsage::StreamRead);
+    }
+}
+
+AtomicCounterBuffer::~AtomicCounterBuffer() {
+    for(GLsync fence: _fences) if(fence) glDeleteSync(fence);
+}
+
+AtomicCounterBuffer& AtomicCounterBuffer::reset(const UnsignedInt value) {
+    for(UnsignedInt& i: _values) i = value;
+
+    Renderer::setMemoryBarrier(Renderer::MemoryBarrier::BufferUpdate);
+    _buffer.setSubData(0, _values);
+    return *this;
+}
+
+AtomicCounterBuffer& AtomicCounterBuffer::read() {
+    CORRADE_ASSERT(_pendingCount < _readbacks.size(),
+        "AtomicCounterBuffer::read(): all" << _readbacks.size() << "readback buffers are pending, call retrieve() first", *this);
+
+    _current = (_current + 1) % _readbacks.size();
+    ++_pendingCount;
+
+    Renderer::setMemoryBarrier(Renderer::MemoryBarrier::BufferUpdate);
+    Buffer::copy(_buffer, _readbacks[_current], 0, 0, _values.size()*sizeof(UnsignedInt));
+    if(_sync) _fences[_current] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    return *this;
+}
+
+std::optional<Containers::Array<UnsignedInt>> AtomicCounterBuffer::retrieveInternal(const bool wait) {
+    if(!_pendingCount) return std::nullopt;
+
+    const bool full = _pendingCount == _readbacks.size();
+    const std::size_t oldest = (_current + _readbacks.size() + 1 - _pendingCount) % _readbacks.size();
+
+    if(_sync) {
+        GLsync& fence = _fences[oldest];
+
+        /* Flush so the fence gets signaled eventually, wait only if there's
+           no free buffer left */
+        GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        if(result == GL_TIMEOUT_EXPIRED) {
+            if(!full && !wait) return std::nullopt;
+
+            if(!wait) ++_waitCount;
+            do result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+            while(result == GL_TIMEOUT_EXPIRED);
+        }
+
+        glDeleteSync(fence);
+        fence = nullptr;
+
+    /* Without fences assume the GL is done with the oldest buffer once all
+       of them are used, mapping the buffer waits otherwise */
+    } else if(!full && !wait) return std::nullopt;
+
+    --_pendingCount;
+
+    /* Copy the values out of the buffer */
+    Buffer& readback = _readbacks[oldest];
+    Containers::Array<UnsignedInt> values{_values.size()};
+    const UnsignedInt* const mapped = readback.map<const UnsignedInt>(0, values.size()*sizeof(UnsignedInt), Buffer::MapFlag::Read);
+    CORRADE_INTERNAL_ASSERT(mapped);
+    std::memcpy(values, mapped, values.size()*sizeof(UnsignedInt));
+    CORRADE_INTERNAL_ASSERT_OUTPUT(readback.unmap());
+
+    return std::optional<Containers::Array<UnsignedInt>>{std::move(values)};
+}
+
+AppendBuffer::AppendBuffer(const UnsignedInt elementSize, const UnsignedInt capacity, const BufferUsage usage, const UnsignedInt readbackCount): _elementSize{elementSize}, _capacity{capacity}, _buffer{Buffer::TargetHint::ShaderStorage}, _counter{1, readbackCount} {
+    CORRADE_ASSERT(elementSize && capacity,
+        "AppendBuffer: expected non-zero element size and capacity", );
+
+    _buffer.setData({nullptr, std::size_t(elementSize)*capacity}, usage);
+}
+
+AppendBuffer& AppendBuffer::bind(const UnsignedInt storageIndex, const UnsignedInt counterIndex) {
+    _buffer.bind(Buffer::Target::ShaderStorage, storageIndex);
+    _counter.bind(counterIndex);
+    return *this;
+}
+
+AppendBuffer& AppendBuffer::copyCount(Buffer& destination, const GLintptr offset) {
+    CORRADE_ASSERT(offset % 4 == 0,
+        "AppendBuffer::copyCount(): expected offset aligned to 4 bytes, got" << offset, *this);
+
+    Renderer::setMemoryBarrier(Renderer::MemoryBarrier::BufferUpdate);
+    Buffer::copy(_counter.buffer(), destination, 0, offset, sizeof(UnsignedInt));
+    return *this;
+}
+
+}
@@ -0,0 +1,343 @@
+#ifndef Magnum_AtomicCounterBuffer_h
+#define Magnum_AtomicCounterBuffer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+/** @file
+ * @brief Class @ref Magnum::AtomicCounterBuffer, @ref Magnum::AppendBuffer
+ */
+#endif
+
+#include <vector>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Buffer.h"
+#include "MagnumExternal/Optional/optional.hpp"
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+namespace Magnum {
+
+/**
+@brief Atomic counter buffer
+
+A @ref Buffer with a fixed count of @ref UnsignedInt atomic counters together
+with a queue for reading them back without stalling the pipeline. Meant for
+GPU-driven workloads such as culling or particle emission, where a shader
+counts the output and the application only needs the result a few frames
+later, if at all.
+
+## Usage
+
+Reset the counters with @ref reset() before the shader touches them, bind
+the buffer with @ref bind() and schedule a readback after the dispatch using
+@ref read(). Completed readbacks are then available through @ref retrieve():
+@code
+AtomicCounterBuffer counters{2};
+
+// each frame
+counters.reset()
+    .bind(0);
+cullingShader.dispatchCompute(...);
+counters.read();
+
+if(std::optional<Containers::Array<UnsignedInt>> values = counters.retrieve())
+    Debug() << "Visible objects:" << (*values)[0];
+@endcode
+
+## Memory barriers
+
+Shader writes to atomic counters are incoherent, so both @ref reset() and
+@ref read() call @ref Renderer::setMemoryBarrier() with
+@ref Renderer::MemoryBarrier::BufferUpdate before touching the buffer. Using
+the counters in subsequent shaders or as indirect draw parameters needs an
+appropriate barrier issued by the application.
+
+@anchor AtomicCounterBuffer-performance-optimization
+## Performance optimizations
+
+The readback copies the counters into one of a pool of small buffers and
+places a fence after it. If @extension{ARB,sync} (part of OpenGL 3.2; fences
+are always available in OpenGL ES 3.0) is available, @ref retrieve() returns
+the values only after the GL signals the fence, otherwise only after all
+readback buffers are used. The behavior is the same as in
+@ref ImageReadbackQueue, see its documentation for more information.
+@see @ref AppendBuffer
+@requires_gl42 Extension @extension{ARB,shader_atomic_counters}
+@requires_gles31 Atomic counters are not available in OpenGL ES 3.0 and
+    older.
+@requires_gles Atomic counters are not available in WebGL.
+*/
+class MAGNUM_EXPORT AtomicCounterBuffer {
+    public:
+        /**
+         * @brief Constructor
+         * @param counterCount      Count of counters in the buffer
+         * @param readbackCount     Count of readback buffers. Should be at
+         *      least the count of frames the GL is allowed to lag behind the
+         *      application.
+         *
+         * Allocates the counter buffer with all counters set to `0` and
+         * all readback buffers. Expects that both counts are non-zero.
+         */
+        explicit AtomicCounterBuffer(UnsignedInt counterCount = 1, UnsignedInt readbackCount = 3);
+
+        /** @brief Copying is not allowed */
+        AtomicCounterBuffer(const AtomicCounterBuffer&) = delete;
+
+        /** @brief Moving is not allowed */
+        AtomicCounterBuffer(AtomicCounterBuffer&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Deletes all pending fences.
+         * @see @fn_gl{DeleteSync}
+         */
+        ~AtomicCounterBuffer();
+
+        /** @brief Copying is not allowed */
+        AtomicCounterBuffer& operator=(const AtomicCounterBuffer&) = delete;
+
+        /** @brief Moving is not allowed */
+        AtomicCounterBuffer& operator=(AtomicCounterBuffer&&) = delete;
+
+        /** @brief Count of counters in the buffer */
+        UnsignedInt counterCount() const { return _values.size(); }
+
+        /** @brief Count of readback buffers */
+        UnsignedInt readbackCount() const { return _readbacks.size(); }
+
+        /** @brief Count of readbacks not yet retrieved */
+        UnsignedInt pendingCount() const { return _pendingCount; }
+
+        /** @brief Counter buffer */
+        Buffer& buffer() { return _buffer; }
+
+        /**
+         * @brief Reset all counters
+         * @return Reference to self (for method chaining)
+         *
+         * Sets all counters to @p value. Issues a
+         * @ref Renderer::MemoryBarrier::BufferUpdate barrier first, so
+         * shader writes issued before are finished.
+         * @see @ref Buffer::setSubData()
+         */
+        AtomicCounterBuffer& reset(UnsignedInt value = 0);
+
+        /**
+         * @brief Bind the counters to given atomic counter binding
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Buffer::bind(Buffer::Target, UnsignedInt),
+         *      @ref Buffer::maxAtomicCounterBindings()
+         */
+        AtomicCounterBuffer& bind(UnsignedInt index) {
+            _buffer.bind(Buffer::Target::AtomicCounter, index);
+            return *this;
+        }
+
+        /**
+         * @brief Schedule counter readback
+         * @return Reference to self (for method chaining)
+         *
+         * Issues a @ref Renderer::MemoryBarrier::BufferUpdate barrier, copies
+         * the counters into next free readback buffer and places a fence
+         * after the copy. Expects that there is a free readback buffer, i.e.
+         * that @ref pendingCount() is less than @ref readbackCount().
+         * @see @ref Buffer::copy(), @fn_gl{FenceSync}
+         */
+        AtomicCounterBuffer& read();
+
+        /**
+         * @brief Retrieve oldest completed readback
+         *
+         * If the GL finished the oldest pending readback, returns the counter
+         * values. If all readback buffers are pending, waits for the oldest
+         * one. Otherwise returns `std::nullopt`. See
+         * @ref AtomicCounterBuffer-performance-optimization "class documentation"
+         * for more information.
+         * @see @ref retrieveBlocking(), @fn_gl{ClientWaitSync},
+         *      @fn_gl{DeleteSync},
+         *      @ref Buffer::map(GLintptr, GLsizeiptr, Buffer::MapFlags)
+         */
+        std::optional<Containers::Array<UnsignedInt>> retrieve() { return retrieveInternal(false); }
+
+        /**
+         * @brief Retrieve oldest pending readback, blocking if needed
+         *
+         * Unlike @ref retrieve() waits for the oldest pending readback even if
+         * there are free buffers left. Returns `std::nullopt` only if there
+         * is no readback pending.
+         */
+        std::optional<Containers::Array<UnsignedInt>> retrieveBlocking() { return retrieveInternal(true); }
+
+        /**
+         * @brief Count of waits for the GL
+         *
+         * Count of times @ref retrieve() had to block because the GL didn't
+         * finish the oldest readback yet. Waits in @ref retrieveBlocking() are
+         * not counted. Always `0` if @extension{ARB,sync} is not available.
+         */
+        UnsignedInt waitCount() const { return _waitCount; }
+
+    private:
+        std::optional<Containers::Array<UnsignedInt>> retrieveInternal(bool wait);
+
+        Containers::Array<UnsignedInt> _values;
+        Buffer _buffer;
+        std::vector<Buffer> _readbacks;
+        std::vector<GLsync> _fences;
+        bool _sync;
+        UnsignedInt _current,
+            _pendingCount,
+            _waitCount;
+};
+
+/**
+@brief GPU append buffer
+
+A shader storage @ref Buffer with a fixed capacity of equally sized elements
+and an @ref AtomicCounterBuffer with one counter, which shaders increment to
+get an index where to write the next element. Typical use is GPU culling
+writing visible instances or particle emission writing spawned particles.
+
+## Usage
+
+The shader declares the storage array and the counter at the bindings passed
+to @ref bind():
+@code
+layout(binding = 0) uniform atomic_uint appendCount;
+layout(std430, binding = 1) writeonly buffer Output {
+    Instance instances[];
+};
+
+// ...
+uint index = atomicCounterIncrement(appendCount);
+if(index < capacity) instances[index] = instance;
+@endcode
+
+The application resets the counter, binds the buffers and after the dispatch
+either copies the count into a buffer with indirect draw commands using
+@ref copyCount() or reads it back asynchronously through @ref counter():
+@code
+AppendBuffer visible{sizeof(Instance), 16384};
+
+visible.reset()
+    .bind(1, 0);
+cullingShader.dispatchCompute(...);
+
+// instance count of a Mesh::DrawElementsIndirectCommand
+visible.copyCount(indirectBuffer, sizeof(UnsignedInt));
+Renderer::setMemoryBarrier(Renderer::MemoryBarrier::Command|
+                           Renderer::MemoryBarrier::VertexAttributeArray);
+@endcode
+
+The counter is not clamped to the capacity, so a value larger than
+@ref capacity() means the shader ran out of space.
+@see @ref TransformFeedbackCache
+@requires_gl43 Extension @extension{ARB,shader_atomic_counters} and
+    @extension{ARB,shader_storage_buffer_object}
+@requires_gles31 Atomic counters and shader storage are not available in
+    OpenGL ES 3.0 and older.
+@requires_gles Atomic counters and shader storage are not available in
+    WebGL.
+*/
+class MAGNUM_EXPORT AppendBuffer {
+    public:
+        /**
+         * @brief Constructor
+         * @param elementSize       Size of one element in bytes
+         * @param capacity          Count of elements the buffer can hold
+         * @param usage             Buffer usage
+         * @param readbackCount     Count of counter readback buffers
+         *
+         * Allocates the storage buffer, the counter is set to `0`. Expects
+         * that both @p elementSize and @p capacity are non-zero.
+         */
+        explicit AppendBuffer(UnsignedInt elementSize, UnsignedInt capacity, BufferUsage usage = BufferUsage::DynamicCopy, UnsignedInt readbackCount = 3);
+
+        /** @brief Size of one element in bytes */
+        UnsignedInt elementSize() const { return _elementSize; }
+
+        /** @brief Count of elements the buffer can hold */
+        UnsignedInt capacity() const { return _capacity; }
+
+        /** @brief Storage buffer */
+        Buffer& buffer() { return _buffer; }
+
+        /** @brief Element counter */
+        AtomicCounterBuffer& counter() { return _counter; }
+
+        /**
+         * @brief Reset the element count
+         * @return Reference to self (for method chaining)
+         *
+         * The buffer contents are not touched.
+         * @see @ref AtomicCounterBuffer::reset()
+         */
+        AppendBuffer& reset() {
+            _counter.reset();
+            return *this;
+        }
+
+        /**
+         * @brief Bind the storage buffer and the counter
+         * @param storageIndex      Shader storage binding
+         * @param counterIndex      Atomic counter binding
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Buffer::bind(Buffer::Target, UnsignedInt),
+         *      @ref Buffer::maxShaderStorageBindings(),
+         *      @ref Buffer::maxAtomicCounterBindings()
+         */
+        AppendBuffer& bind(UnsignedInt storageIndex, UnsignedInt counterIndex);
+
+        /**
+         * @brief Copy the element count into another buffer
+         * @param destination       Destination buffer
+         * @param offset            Offset in the destination buffer
+         * @return Reference to self (for method chaining)
+         *
+         * Issues a @ref Renderer::MemoryBarrier::BufferUpdate barrier and
+         * copies the counter into @p destination, e.g. into a field of an
+         * indirect draw command. The @p offset is expected to be aligned to
+         * 4 bytes.
+         * @see @ref Buffer::copy()
+         */
+        AppendBuffer& copyCount(Buffer& destination, GLintptr offset);
+
+    private:
+        UnsignedInt _elementSize, _capacity;
+        Buffer _buffer;
+        AtomicCounterBuffer _counter;
+};
+
+}
+#else
+#error this header is not available in OpenGL ES 2.0 and WebGL build
+#endif
+
+#endif
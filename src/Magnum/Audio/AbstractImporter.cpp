@@ -90,4 +90,26 @@ Containers::Array<char> AbstractImporter::data() {
     return doData();
 }
 
+std::size_t AbstractImporter::read(const Containers::ArrayView<char> data) {
+    CORRADE_ASSERT(features() & Feature::Streaming,
+        "Audio::AbstractImporter::read(): feature not supported", {});
+    CORRADE_ASSERT(isOpened(), "Audio::AbstractImporter::read(): no file opened", {});
+    return doRead(data);
+}
+
+std::size_t AbstractImporter::doRead(Containers::ArrayView<char>) {
+    CORRADE_ASSERT(false, "Audio::AbstractImporter::read(): feature advertised but not implemented", {});
+}
+
+void AbstractImporter::rewind() {
+    CORRADE_ASSERT(features() & Feature::Streaming,
+        "Audio::AbstractImporter::rewind(): feature not supported", );
+    CORRADE_ASSERT(isOpened(), "Audio::AbstractImporter::rewind(): no file opened", );
+    doRewind();
+}
+
+void AbstractImporter::doRewind() {
+    CORRADE_ASSERT(false, "Audio::AbstractImporter::rewind(): feature advertised but not implemented", );
+}
+
 }}
@@ -29,6 +29,7 @@
  * @brief Class @ref Magnum::Audio::AbstractImporter
  */
 
+#include <Corrade/Containers/EnumSet.h>
 #include <Corrade/PluginManager/AbstractManagingPlugin.h>
 
 #include "Magnum/Magnum.h"
@@ -48,6 +49,8 @@ importer plugins.
 Plugin implements function @ref doFeatures(), @ref doIsOpened(), one of or both
 @ref doOpenData() and @ref doOpenFile() functions, function @ref doClose() and
 data access functions @ref doFormat(), @ref doFrequency() and @ref doData().
+If @ref Feature::Streaming is supported, the plugin implements also
+@ref doRead() and @ref doRewind().
 
 You don't need to do most of the redundant sanity checks, these things are
 checked by the implementation:
@@ -57,6 +60,8 @@ checked by the implementation:
     is any file opened.
 -   Function @ref doOpenData() is called only if @ref Feature::OpenData is
     supported.
+-   Functions @ref doRead() and @ref doRewind() are called only if
+    @ref Feature::Streaming is supported.
 -   All `do*()` implementations working on opened file are called only if
     there is any file opened.
 
@@ -78,7 +83,13 @@ class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          */
         enum class Feature: UnsignedByte {
             /** Opening files from raw data using @ref openData() */
-            OpenData = 1 << 0
+            OpenData = 1 << 0,
+
+            /**
+             * Reading the sample data in chunks using @ref read() and
+             * @ref rewind()
+             */
+            Streaming = 1 << 1
         };
 
         /**
@@ -136,6 +147,29 @@ class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractManagi
         /** @brief Sample data */
         Containers::Array<char> data();
 
+        /**
+         * @brief Read next chunk of sample data
+         * @return Count of bytes written to @p data
+         *
+         * Reads as many whole sample frames (i.e., samples for all channels)
+         * as fit into @p data, continuing where the previous call ended.
+         * Returns less than size of @p data only at the end of the stream and
+         * `0` if the whole stream was read already. Unlike @ref data(), this
+         * doesn't need the whole sample data to be in memory. Available only
+         * if @ref Feature::Streaming is supported.
+         * @see @ref features(), @ref rewind()
+         */
+        std::size_t read(Containers::ArrayView<char> data);
+
+        /**
+         * @brief Rewind the stream to the beginning
+         *
+         * Next call to @ref read() will return data from the beginning again.
+         * Available only if @ref Feature::Streaming is supported.
+         * @see @ref features()
+         */
+        void rewind();
+
         /*@}*/
 
     #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -171,8 +205,16 @@ class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractManagi
 
         /** @brief Implementation for @ref data() */
         virtual Containers::Array<char> doData() = 0;
+
+        /** @brief Implementation for @ref read() */
+        virtual std::size_t doRead(Containers::ArrayView<char> data);
+
+        /** @brief Implementation for @ref rewind() */
+        virtual void doRewind();
 };
 
+CORRADE_ENUMSET_OPERATORS(AbstractImporter::Features)
+
 }}
 
 #endif
@@ -38,6 +38,8 @@ class AbstractImporter;
 class Buffer;
 class Context;
 class Source;
+class Stream;
+class VoicePool;
 /* Renderer used only statically */
 #endif
 
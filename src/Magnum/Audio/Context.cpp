@@ -48,9 +48,11 @@ const std::vector<Extension>& Extension::extensions() {
         _extension(AL,EXT,ALAW),
         _extension(AL,EXT,MULAW),
         _extension(AL,EXT,MCFORMATS),
+        _extension(AL,SOFT,source_latency),
         _extension(ALC,EXT,ENUMERATION),
         _extension(ALC,SOFTX,HRTF),
-        _extension(ALC,SOFT,HRTF)
+        _extension(ALC,SOFT,HRTF),
+        _extension(ALC,SOFT,device_clock)
     };
     #undef _entension
 
@@ -94,7 +96,7 @@ Context& Context::current() {
 
 Context::Context(): Context{Configuration{}} {}
 
-Context::Context(const Configuration& config) {
+Context::Context(const Configuration& config): _alGetSourcedvSOFT{}, _alcGetInteger64vSOFT{} {
     CORRADE_ASSERT(!_current, "Audio::Context: context already created", );
 
     /* Open the device */
@@ -127,6 +129,12 @@ Context::Context(const Configuration& config) {
         }
     }
 
+    /* Entry points of extensions used for latency queries */
+    if(isExtensionSupported<Extensions::AL::SOFT::source_latency>())
+        _alGetSourcedvSOFT = reinterpret_cast<LPALGETSOURCEDVSOFT>(alGetProcAddress("alGetSourcedvSOFT"));
+    if(isExtensionSupported<Extensions::ALC::SOFT::device_clock>())
+        _alcGetInteger64vSOFT = reinterpret_cast<LPALCGETINTEGER64VSOFT>(alcGetProcAddress(_device, "alcGetInteger64vSOFT"));
+
     /* Print some info */
     Debug() << "Audio Renderer:" << rendererString() << "by" << vendorString();
     Debug() << "OpenAL version:" << versionString();
@@ -139,6 +147,37 @@ Context::~Context() {
     alcCloseDevice(_device);
 }
 
+Int Context::attribute(const Int name) const {
+    Int size;
+    alcGetIntegerv(_device, ALC_ATTRIBUTES_SIZE, 1, &size);
+    if(size <= 0) return -1;
+
+    /* Zero-terminated list of name/value pairs */
+    std::vector<Int> attributes(size);
+    alcGetIntegerv(_device, ALC_ALL_ATTRIBUTES, size, attributes.data());
+    for(std::size_t i = 0; i + 1 < attributes.size() && attributes[i]; i += 2)
+        if(attributes[i] == name) return attributes[i + 1];
+
+    return -1;
+}
+
+Int Context::frequency() const { return attribute(ALC_FREQUENCY); }
+
+Int Context::refreshRate() const { return attribute(ALC_REFRESH); }
+
+Int Context::monoSourceCount() const { return attribute(ALC_MONO_SOURCES); }
+
+Int Context::stereoSourceCount() const { return attribute(ALC_STEREO_SOURCES); }
+
+Long Context::deviceLatency() const {
+    CORRADE_ASSERT(_alcGetInteger64vSOFT,
+        "Audio::Context::deviceLatency(): ALC_SOFT_device_clock is not supported", {});
+
+    ALCint64SOFT latency;
+    _alcGetInteger64vSOFT(_device, ALC_DEVICE_LATENCY_SOFT, 1, &latency);
+    return latency;
+}
+
 std::vector<std::string> Context::extensionStrings() const {
     std::vector<std::string> extensions;
 
@@ -209,6 +209,56 @@ class MAGNUM_AUDIO_EXPORT Context {
             return alcGetString(_device, ALC_HRTF_SPECIFIER_SOFT);
         }
 
+        /**
+         * @brief Output frequency in Hz
+         *
+         * Frequency the device actually mixes at, which may differ from the
+         * one requested with @ref Configuration::setFrequency(). Returns `-1`
+         * if the implementation doesn't report it.
+         * @see @fn_alc{GetIntegerv} with @def_alc{ALL_ATTRIBUTES}
+         */
+        Int frequency() const;
+
+        /**
+         * @brief Refresh rate in Hz
+         *
+         * Rate at which the device mixes new data, its inverse is the mixing
+         * period. Returns `-1` if the implementation doesn't report it.
+         * @see @ref Configuration::setRefreshRate(), @fn_alc{GetIntegerv}
+         *      with @def_alc{ALL_ATTRIBUTES}
+         */
+        Int refreshRate() const;
+
+        /**
+         * @brief Count of mono sources the device supports
+         *
+         * Returns `-1` if the implementation doesn't report it.
+         * @see @ref Configuration::setMonoSourceCount(),
+         *      @fn_alc{GetIntegerv} with @def_alc{ALL_ATTRIBUTES}
+         */
+        Int monoSourceCount() const;
+
+        /**
+         * @brief Count of stereo sources the device supports
+         *
+         * Returns `-1` if the implementation doesn't report it.
+         * @see @ref Configuration::setStereoSourceCount(),
+         *      @fn_alc{GetIntegerv} with @def_alc{ALL_ATTRIBUTES}
+         */
+        Int stereoSourceCount() const;
+
+        /**
+         * @brief Device output latency in nanoseconds
+         *
+         * Time between the device mixing a sample and the sample being heard.
+         * For latency of a particular source, which includes also the
+         * samples queued for mixing, see @ref Source::latencyInSeconds().
+         * @see @ref refreshRate(), @fn_alc{GetInteger64vSOFT} with
+         *      @def_alc{DEVICE_LATENCY_SOFT}
+         * @requires_al_extension Extension @alc_extension{SOFT,device_clock}
+         */
+        Long deviceLatency() const;
+
         /**
          * @brief Device specifier string
          *
@@ -299,8 +349,13 @@ class MAGNUM_AUDIO_EXPORT Context {
         }
 
     private:
+        friend Source;
+
         MAGNUM_AUDIO_LOCAL static Context* _current;
 
+        /* Value of given context attribute or -1 if not present */
+        MAGNUM_AUDIO_LOCAL Int attribute(Int name) const;
+
         /* Create a context with given configuration. Returns `true` on success.
          * @ref alcCreateContext(). */
         MAGNUM_AUDIO_LOCAL bool tryCreateContext(const Configuration& config);
@@ -308,6 +363,9 @@ class MAGNUM_AUDIO_EXPORT Context {
         ALCdevice* _device;
         ALCcontext* _context;
 
+        LPALGETSOURCEDVSOFT _alGetSourcedvSOFT;
+        LPALCGETINTEGER64VSOFT _alcGetInteger64vSOFT;
+
         std::bitset<64> _extensionStatus;
         std::vector<Extension> _supportedExtensions;
 };
@@ -356,6 +414,8 @@ class MAGNUM_AUDIO_EXPORT Context::Configuration {
          * @return Reference to self (for method chaining)
          *
          * If set to `-1` (the default), system OpenAL configuration is used.
+         * The value actually used by the device can be queried with
+         * @ref Context::frequency().
          */
         Configuration& setFrequency(Int hz) {
             _frequency = hz;
@@ -416,6 +476,9 @@ class MAGNUM_AUDIO_EXPORT Context::Configuration {
          * @return Reference to self (for method chaining)
          *
          * If set to `-1` (the default), system OpenAL configuration is used.
+         * Higher refresh rate means smaller mixing period and thus lower
+         * latency, at the cost of higher CPU usage. The value actually used
+         * by the device can be queried with @ref Context::refreshRate().
          */
         Configuration& setRefreshRate(Int hz) {
             _refreshRate = hz;
@@ -82,6 +82,8 @@ namespace AL {
         _extension(AL,EXT,ALAW) // #???
         _extension(AL,EXT,MULAW) // #???
         _extension(AL,EXT,MCFORMATS) // #???
+    } namespace SOFT {
+        _extension(AL,SOFT,source_latency) // #???
     }
 } namespace ALC {
     namespace EXT {
@@ -92,6 +94,7 @@ namespace AL {
     }
     namespace SOFT {
         _extension(ALC,SOFT,HRTF) // #???
+        _extension(ALC,SOFT,device_clock) // #???
     }
 }
 #undef _extension
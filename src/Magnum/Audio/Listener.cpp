@@ -89,12 +89,20 @@ template<UnsignedInt dimensions> void Listener<dimensions>::update(std::initiali
     objects.push_back(this->object());
     for(PlayableGroup<dimensions>& group : groups) {
         for(UnsignedInt i = 0; i < group.size(); ++i) {
-            objects.push_back(group[i].object());
+            if(group[i].object().isDirty())
+                objects.push_back(group[i].object());
         }
     }
 
     /* Use the more performant way to set multiple objects clean */
     AbstractObject<dimensions, Float>::setClean(objects);
+
+    /* Update voice priorities with the new listener position */
+    if(groups.size()) {
+        const Vector3 listenerPosition = Renderer::listenerPosition();
+        for(PlayableGroup<dimensions>& group : groups)
+            group.updateVoices(listenerPosition);
+    }
 }
 
 /* On non-MinGW Windows the instantiations are already marked with extern
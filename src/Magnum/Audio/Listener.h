@@ -156,7 +156,8 @@ template <UnsignedInt dimensions> class Listener: public SceneGraph::AbstractFea
          * Makes this Listener the active listener and calls
          * @ref SceneGraph::AbstractObject::setClean() on its parent object and
          * all objects of the @ref Playable s in the group. Updates listene
-         * related configuration for @ref Renderer (position, orientation, gain).
+         * related configuration for @ref Renderer (position, orientation, gain)
+         * and calls @ref PlayableGroup::updateVoices() on all groups.
          */
         void update(std::initializer_list<std::reference_wrapper<PlayableGroup<dimensions>>> groups);
 
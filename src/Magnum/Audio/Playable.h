@@ -68,7 +68,9 @@ Position of the source will be updated to the translation of `object` when
 @ref SceneGraph::Object::setClean() is called, which is done in
 @ref Audio::Listener::update() or @ref Audio::PlayableGroup::setClean() for example.
 
-To manage multiple Playables at once, use @ref PlayableGroup.
+The source position and direction are cached, OpenAL is called only if they
+actually changed since the last update. To manage multiple Playables at once,
+use @ref PlayableGroup.
 
 -   @ref Playable2D
 -   @ref Playable3D
@@ -96,7 +98,9 @@ template<UnsignedInt dimensions> class Playable: public SceneGraph::AbstractGrou
             SceneGraph::AbstractGroupedFeature<dimensions, Playable<dimensions>, Float>(object, group),
             _fwd(0.0f),
             _gain(1.0f),
-            _source()
+            _source(),
+            _virtualOffset{},
+            _virtual{}
         {
             SceneGraph::AbstractFeature<dimensions, Float>::setCachedTransformations(SceneGraph::CachedTransformation::Absolute);
             _fwd[dimensions - 1] = -1;
@@ -112,6 +116,17 @@ template<UnsignedInt dimensions> class Playable: public SceneGraph::AbstractGrou
             return _gain;
         }
 
+        /**
+         * @brief Whether the playable is virtual
+         *
+         * Virtual playable is logically playing, but its source was stopped
+         * because of the voice limit of its group. See
+         * @ref PlayableGroup::setMaxVoiceCount() for more information.
+         */
+        bool isVirtual() const {
+            return _virtual;
+        }
+
         /**
          * @brief Set gain of the playable and source respecting the PlayableGroups gain
          * @return Reference to self (for method chaining)
@@ -146,8 +161,13 @@ template<UnsignedInt dimensions> class Playable: public SceneGraph::AbstractGrou
             if(playables()) {
                 position = playables()->soundTransformation().transformVector(position);
             }
-            _source.setPosition(position);
-            _source.setDirection(Vector3::pad(absoluteTransformationMatrix.rotation()*_fwd));
+            const Vector3 direction = Vector3::pad(absoluteTransformationMatrix.rotation()*_fwd);
+
+            /* Objects are also marked dirty if the transformation of any
+               parent or the group sound transformation changes, which doesn't
+               necessarily mean that the source moved */
+            if(position != _position) _source.setPosition(_position = position);
+            if(direction != _direction) _source.setDirection(_direction = direction);
 
             /** @todo velocity */
         }
@@ -165,6 +185,14 @@ template<UnsignedInt dimensions> class Playable: public SceneGraph::AbstractGrou
         VectorTypeFor<dimensions, Float> _fwd;
         Float _gain;
         Source _source;
+
+        /* Last position and direction passed to the source, the defaults
+           match OpenAL defaults */
+        Vector3 _position, _direction;
+
+        /* Offset where to resume playback of virtual playable */
+        Float _virtualOffset;
+        bool _virtual;
 };
 
 /**
@@ -30,8 +30,10 @@
  * @brief Class @ref Magnum::Audio::PlayableGroup, typedef @ref Magnum::Audio::PlayableGroup2D, @ref Magnum::Audio::PlayableGroup3D
  */
 
+#include <algorithm>
 #include <functional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <Magnum/SceneGraph/AbstractObject.h>
@@ -40,6 +42,7 @@
 
 #include "Magnum/Audio/Audio.h"
 #include "Magnum/Audio/Playable.h"
+#include "Magnum/Audio/Renderer.h"
 #include "Magnum/Audio/Source.h"
 #include "Magnum/Audio/visibility.h"
 
@@ -72,6 +75,36 @@ For two dimensional scenes simply replace `3D` with `2D`. When using a
 @ref Listener, prefer @ref Listener::update() over
 @ref PlayableGroup::setClean().
 
+@anchor Audio-PlayableGroup-voice-limit
+## Voice limit
+
+Audio hardware and OpenAL implementations can mix only a limited count of
+sources at once, playing the sources beyond the limit fails silently. With
+@ref setMaxVoiceCount() the group keeps only given count of sources closest to
+the listener actually playing. The remaining sources are *virtualized* ---
+their playback offset is remembered and the source is stopped. When a virtual
+@ref Playable gets close enough again, its source is resumed from the
+remembered offset. The priorities are recalculated in @ref updateVoices(),
+which is called from @ref setClean() and @ref Listener::update():
+
+@code
+PlayableGroup3D group;
+group.setMaxVoiceCount(32);
+
+// ...
+
+group.play();
+
+// ... every frame, update the positions and voices:
+listener.update({group});
+@endcode
+
+Note that the time spent in virtual state isn't accounted for, the playback
+is resumed where it was stopped. Also, each @ref Playable still owns its
+source, so the count of playables is limited by the count of sources the
+OpenAL implementation can create. Use @ref VoicePool if you need more sounds
+than that or seamless resume.
+
 -   @ref PlayableGroup2D
 -   @ref PlayableGroup3D
 
@@ -85,26 +118,32 @@ template<UnsignedInt dimensions> class PlayableGroup: public SceneGraph::Feature
         /** @brief Constructor */
         explicit PlayableGroup():
             SceneGraph::FeatureGroup<dimensions, Playable<dimensions>, Float>(),
-            _gain{1.0f}
+            _gain{1.0f},
+            _maxVoiceCount{},
+            _hasVirtual{}
         {}
 
         /**
          * @brief Play all sound sources in this group
          * @return Reference to self (for method chaining)
+         *
+         * If @ref maxVoiceCount() is set, only the closest sources up to the
+         * limit are played, the others are virtualized.
          * @see @ref Source::play()
          */
-        PlayableGroup<dimensions>& play() {
-            Source::play(sources());
-            return *this;
-        }
+        PlayableGroup<dimensions>& play();
 
         /**
          * @brief Pause all sound sources in this group
          * @return Reference to self (for method chaining)
+         *
+         * Virtual playables stay stopped, but calling @ref play() resumes
+         * them from the offset where they were virtualized.
          * @see @ref Source::pause()
          */
         PlayableGroup& pause() {
-            Source::stop(sources());
+            Source::pause(sources());
+            devirtualize();
             return *this;
         }
 
@@ -115,9 +154,40 @@ template<UnsignedInt dimensions> class PlayableGroup: public SceneGraph::Feature
          */
         PlayableGroup& stop() {
             Source::stop(sources());
+            devirtualize();
+            return *this;
+        }
+
+        /** @brief Max count of sources played at once */
+        UnsignedInt maxVoiceCount() const {
+            return _maxVoiceCount;
+        }
+
+        /**
+         * @brief Set max count of sources played at once
+         * @return Reference to self (for method chaining)
+         *
+         * Default is `0`, which means no limit. Takes effect on the next
+         * call to @ref updateVoices(). See @ref Audio-PlayableGroup-voice-limit
+         * "class documentation" for more information.
+         */
+        PlayableGroup& setMaxVoiceCount(UnsignedInt count) {
+            _maxVoiceCount = count;
             return *this;
         }
 
+        /**
+         * @brief Update playing sources based on distance to listener
+         *
+         * Keeps at most @ref maxVoiceCount() playing or virtual sources
+         * closest to the @p listenerPosition playing, virtualizes the others.
+         * Positions known from the last @ref setClean() are used. If there is
+         * no voice limit and no virtual playable, the function does nothing.
+         * Sources that finished playing are not considered.
+         * @see @ref Playable::isVirtual()
+         */
+        void updateVoices(const Vector3& listenerPosition);
+
         /** @brief Gain */
         Float gain() const {
             return _gain;
@@ -154,6 +224,10 @@ template<UnsignedInt dimensions> class PlayableGroup: public SceneGraph::Feature
 
         /**
          * @brief Set all contained Playables clean
+         *
+         * Only sources of dirty objects are updated. Then, if
+         * @ref maxVoiceCount() is set, calls @ref updateVoices() with
+         * @ref Renderer::listenerPosition().
          * @see @ref AbstractObject::setClean()
          */
         void setClean();
@@ -169,8 +243,12 @@ template<UnsignedInt dimensions> class PlayableGroup: public SceneGraph::Feature
             return srcs;
         }
 
+        void devirtualize();
+
         Matrix4 _soundTransform;
         Float _gain;
+        UnsignedInt _maxVoiceCount;
+        bool _hasVirtual;
 };
 
 template<UnsignedInt dimensions> inline PlayableGroup<dimensions>& PlayableGroup<dimensions>::setSoundTransformation(const Matrix4& matrix) {
@@ -190,9 +268,94 @@ template<UnsignedInt dimensions> inline void PlayableGroup<dimensions>::setClean
     objects.reserve(this->size());
 
     for(UnsignedInt i = 0; i < this->size(); ++i)
-        objects.push_back((*this)[i].object());
+        if((*this)[i].object().isDirty()) objects.push_back((*this)[i].object());
+
+    if(!objects.empty())
+        SceneGraph::AbstractObject<dimensions, Float>::setClean(objects);
+
+    /* Don't query the listener if not needed */
+    if(_maxVoiceCount || _hasVirtual) updateVoices(Renderer::listenerPosition());
+}
+
+template<UnsignedInt dimensions> PlayableGroup<dimensions>& PlayableGroup<dimensions>::play() {
+    if(!_maxVoiceCount) {
+        Source::play(sources());
+        return *this;
+    }
+
+    /* Mark everything that's not playing as virtual and let updateVoices()
+       pick the ones that fit into the limit, so the limit is never exceeded */
+    for(UnsignedInt i = 0; i < this->size(); ++i) {
+        Playable<dimensions>& playable = (*this)[i];
+        if(playable._virtual || playable._source.state() == Source::State::Playing)
+            continue;
+
+        playable._virtualOffset = playable._source.offsetInSeconds();
+        playable._virtual = true;
+        _hasVirtual = true;
+    }
+
+    updateVoices(Renderer::listenerPosition());
+    return *this;
+}
+
+template<UnsignedInt dimensions> void PlayableGroup<dimensions>::updateVoices(const Vector3& listenerPosition) {
+    /* Nothing to do, don't waste time querying source state */
+    if(!_maxVoiceCount && !_hasVirtual) return;
+
+    /* Gather everything that's logically playing, with squared distance as
+       the priority */
+    std::vector<std::pair<Float, Playable<dimensions>*>> candidates;
+    candidates.reserve(this->size());
+    for(UnsignedInt i = 0; i < this->size(); ++i) {
+        Playable<dimensions>& playable = (*this)[i];
+        if(playable._virtual || playable._source.state() == Source::State::Playing)
+            candidates.emplace_back((playable._position - listenerPosition).dot(), &playable);
+    }
+
+    /* Put the closest ones first, the order among them doesn't matter */
+    const std::size_t voiceCount = _maxVoiceCount ? std::min(std::size_t(_maxVoiceCount), candidates.size()) : candidates.size();
+    if(voiceCount != candidates.size())
+        std::nth_element(candidates.begin(), candidates.begin() + voiceCount, candidates.end(),
+            [](const std::pair<Float, Playable<dimensions>*>& a, const std::pair<Float, Playable<dimensions>*>& b) {
+                return a.first < b.first;
+            });
+
+    /* Virtualize the far ones first to free the voices for the others */
+    _hasVirtual = false;
+    for(std::size_t i = voiceCount; i != candidates.size(); ++i) {
+        Playable<dimensions>& playable = *candidates[i].second;
+        _hasVirtual = true;
+        if(playable._virtual) continue;
+
+        playable._virtualOffset = playable._source.offsetInSeconds();
+        playable._source.stop();
+        playable._virtual = true;
+    }
+
+    for(std::size_t i = 0; i != voiceCount; ++i) {
+        Playable<dimensions>& playable = *candidates[i].second;
+        if(!playable._virtual) continue;
+
+        playable._source.setOffsetInSeconds(playable._virtualOffset);
+        playable._source.play();
+        playable._virtual = false;
+    }
+}
+
+template<UnsignedInt dimensions> void PlayableGroup<dimensions>::devirtualize() {
+    if(!_hasVirtual) return;
+
+    /* Keep the remembered offset, so the source resumes on next play() */
+    for(UnsignedInt i = 0; i < this->size(); ++i) {
+        Playable<dimensions>& playable = (*this)[i];
+        if(!playable._virtual) continue;
+
+        playable._source.setOffsetInSeconds(playable._virtualOffset);
+        playable._virtual = false;
+    }
 
-    SceneGraph::AbstractObject<dimensions, Float>::setClean(objects);
+    _hasVirtual = false;
 }
 
 /**
@@ -0,0 +1,275 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SampleConversion.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace Audio {
+
+namespace {
+
+/* Signed little-endian 24-bit sample, sign-extended to 32 bits */
+inline Int pcm24(const char* const data) {
+    const UnsignedInt value = UnsignedByte(data[0])|(UnsignedByte(data[1]) << 8)|(UnsignedByte(data[2]) << 16);
+    return Int(value ^ 0x800000u) - 0x800000;
+}
+
+}
+
+Containers::Array<char> convertPcm24ToPcm16(const Containers::ArrayView<const char> data) {
+    CORRADE_ASSERT(data.size() % 3 == 0,
+        "Audio::convertPcm24ToPcm16(): data size" << data.size() << "is not divisible by 3", {});
+
+    const std::size_t count = data.size()/3;
+    Containers::Array<char> out{count*2};
+    auto output = reinterpret_cast<Short*>(out.data());
+    for(std::size_t i = 0; i != count; ++i)
+        output[i] = Short(Math::min((pcm24(data + i*3) + 128) >> 8, 32767));
+
+    return out;
+}
+
+Containers::Array<char> convertPcm24ToFloat(const Containers::ArrayView<const char> data) {
+    CORRADE_ASSERT(data.size() % 3 == 0,
+        "Audio::convertPcm24ToFloat(): data size" << data.size() << "is not divisible by 3", {});
+
+    const std::size_t count = data.size()/3;
+    Containers::Array<char> out{count*4};
+    auto output = reinterpret_cast<Float*>(out.data());
+    for(std::size_t i = 0; i != count; ++i)
+        output[i] = pcm24(data + i*3)/8388608.0f;
+
+    return out;
+}
+
+namespace {
+
+template<class T, class U> Containers::Array<char> downmix(const Containers::ArrayView<const char> data) {
+    const std::size_t count = data.size()/(sizeof(T)*2);
+    Containers::Array<char> out{count*sizeof(T)};
+    auto input = reinterpret_cast<const T*>(data.data());
+    auto output = reinterpret_cast<T*>(out.data());
+    for(std::size_t i = 0; i != count; ++i)
+        output[i] = T((U(input[i*2]) + U(input[i*2 + 1]))/U(2));
+
+    return out;
+}
+
+}
+
+std::pair<Buffer::Format, Containers::Array<char>> downmixToMono(const Buffer::Format format, const Containers::ArrayView<const char> data) {
+    std::size_t sampleSize = 0;
+    Buffer::Format mono{};
+    switch(format) {
+        case Buffer::Format::Stereo8:
+            sampleSize = 1;
+            mono = Buffer::Format::Mono8;
+            break;
+        case Buffer::Format::Stereo16:
+            sampleSize = 2;
+            mono = Buffer::Format::Mono16;
+            break;
+        case Buffer::Format::StereoFloat:
+            sampleSize = 4;
+            mono = Buffer::Format::MonoFloat;
+            break;
+        case Buffer::Format::StereoDouble:
+            sampleSize = 8;
+            mono = Buffer::Format::MonoDouble;
+            break;
+        default: break;
+    }
+
+    CORRADE_ASSERT(sampleSize,
+        "Audio::downmixToMono(): unsupported format" << format, {});
+    CORRADE_ASSERT(data.size() % (sampleSize*2) == 0,
+        "Audio::downmixToMono(): data size" << data.size() << "is not divisible by frame size" << sampleSize*2, {});
+
+    switch(sampleSize) {
+        case 1: return {mono, downmix<UnsignedByte, UnsignedInt>(data)};
+        case 2: return {mono, downmix<Short, Int>(data)};
+        case 4: return {mono, downmix<Float, Float>(data)};
+        case 8: return {mono, downmix<Double, Double>(data)};
+    }
+
+    CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+namespace {
+
+constexpr UnsignedInt MaxPhaseCount = 1024;
+
+UnsignedInt gcd(UnsignedInt a, UnsignedInt b) {
+    while(b) {
+        const UnsignedInt t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+/* Blackman-windowed sinc low-pass, one row of tapCount coefficients for each
+   phase, each row normalized to unit DC gain */
+std::vector<Float> filterBank(const UnsignedInt phaseCount, const UnsignedInt halfTapCount, const Double cutoff) {
+    const UnsignedInt tapCount = halfTapCount*2;
+    std::vector<Float> bank(std::size_t(phaseCount)*tapCount);
+    for(UnsignedInt phase = 0; phase != phaseCount; ++phase) {
+        Float* const row = bank.data() + std::size_t(phase)*tapCount;
+        Double sum = 0.0;
+        for(UnsignedInt k = 0; k != tapCount; ++k) {
+            const Double x = Double(Int(k) - Int(halfTapCount) + 1) - Double(phase)/phaseCount;
+            const Double u = x/halfTapCount;
+            Double value = 0.0;
+            if(std::abs(u) <= 1.0) {
+                const Double y = cutoff*x*Constants::pi();
+                const Double sinc = y == 0.0 ? 1.0 : std::sin(y)/y;
+                const Double window = 0.42 + 0.5*std::cos(Constants::pi()*u) + 0.08*std::cos(2.0*Constants::pi()*u);
+                value = cutoff*sinc*window;
+            }
+            row[k] = Float(value);
+            sum += value;
+        }
+
+        for(UnsignedInt k = 0; k != tapCount; ++k) row[k] = Float(row[k]/sum);
+    }
+
+    return bank;
+}
+
+template<class T> Float toFloat(T value);
+template<> inline Float toFloat(const Short value) { return value/32768.0f; }
+template<> inline Float toFloat(const Float value) { return value; }
+
+template<class T> T fromFloat(Float value);
+template<> inline Short fromFloat(const Float value) {
+    return Short(Math::clamp(std::lround(value*32768.0f), -32768l, 32767l));
+}
+template<> inline Float fromFloat(const Float value) { return value; }
+
+template<class T> Containers::Array<char> resampleInto(const Containers::ArrayView<const char> data, const UnsignedInt channelCount, const UnsignedInt frequency, const UnsignedInt targetFrequency) {
+    const UnsignedInt divisor = gcd(frequency, targetFrequency);
+    const UnsignedInt upsample = targetFrequency/divisor;
+    const UnsignedInt downsample = frequency/divisor;
+
+    /* When downsampling, the cutoff is at the target Nyquist frequency and
+       the filter gets wider to keep the same transition band steepness */
+    const Double cutoff = Math::min(1.0, Double(upsample)/downsample);
+    const UnsignedInt halfTapCount = UnsignedInt(std::ceil(16.0/cutoff));
+    const UnsignedInt tapCount = halfTapCount*2;
+    const UnsignedInt phaseCount = Math::min(upsample, MaxPhaseCount);
+    const std::vector<Float> bank = filterBank(phaseCount, halfTapCount, cutoff);
+
+    const std::size_t frameCount = data.size()/(sizeof(T)*channelCount);
+    const std::size_t outputFrameCount = std::size_t((unsigned long long)frameCount*upsample/downsample);
+    Containers::Array<char> out{outputFrameCount*channelCount*sizeof(T)};
+    auto input = reinterpret_cast<const T*>(data.data());
+    auto output = reinterpret_cast<T*>(out.data());
+
+    /* Deinterleave each channel into a zero-padded buffer so the inner loop
+       is a contiguous dot product without any bounds checks */
+    std::vector<Float> padded(frameCount + tapCount);
+    for(UnsignedInt channel = 0; channel != channelCount; ++channel) {
+        for(std::size_t i = 0; i != frameCount; ++i)
+            padded[i + halfTapCount - 1] = toFloat(input[i*channelCount + channel]);
+
+        for(std::size_t n = 0; n != outputFrameCount; ++n) {
+            const unsigned long long position = (unsigned long long)n*downsample;
+            std::size_t i = std::size_t(position/upsample);
+            UnsignedInt phase = UnsignedInt(position % upsample);
+
+            /* Ratio with too many phases, round to the nearest one */
+            if(phaseCount != upsample) {
+                phase = UnsignedInt(((unsigned long long)phase*phaseCount + upsample/2)/upsample);
+                if(phase == phaseCount) {
+                    phase = 0;
+                    ++i;
+                }
+            }
+
+            const Float* const samples = padded.data() + i;
+            const Float* const coefficients = bank.data() + std::size_t(phase)*tapCount;
+            Float sum = 0.0f;
+            for(UnsignedInt k = 0; k != tapCount; ++k)
+                sum += samples[k]*coefficients[k];
+
+            output[n*channelCount + channel] = fromFloat<T>(sum);
+        }
+    }
+
+    return out;
+}
+
+}
+
+Containers::Array<char> resample(const Buffer::Format format, const Containers::ArrayView<const char> data, const UnsignedInt frequency, const UnsignedInt targetFrequency) {
+    CORRADE_ASSERT(frequency && targetFrequency,
+        "Audio::resample(): expected non-zero frequencies but got" << frequency << "and" << targetFrequency, {});
+
+    std::size_t sampleSize = 0;
+    UnsignedInt channelCount = 0;
+    switch(format) {
+        case Buffer::Format::Mono16:
+            sampleSize = 2;
+            channelCount = 1;
+            break;
+        case Buffer::Format::Stereo16:
+            sampleSize = 2;
+            channelCount = 2;
+            break;
+        case Buffer::Format::MonoFloat:
+            sampleSize = 4;
+            channelCount = 1;
+            break;
+        case Buffer::Format::StereoFloat:
+            sampleSize = 4;
+            channelCount = 2;
+            break;
+        default: break;
+    }
+
+    CORRADE_ASSERT(sampleSize,
+        "Audio::resample(): unsupported format" << format, {});
+    CORRADE_ASSERT(data.size() % (sampleSize*channelCount) == 0,
+        "Audio::resample(): data size" << data.size() << "is not divisible by frame size" << sampleSize*channelCount, {});
+
+    /* Nothing to do, just copy */
+    if(frequency == targetFrequency) {
+        Containers::Array<char> out{data.size()};
+        std::copy(data.begin(), data.end(), out.begin());
+        return out;
+    }
+
+    return sampleSize == 2 ?
+        resampleInto<Short>(data, channelCount, frequency, targetFrequency) :
+        resampleInto<Float>(data, channelCount, frequency, targetFrequency);
+}
+
+}}
@@ -0,0 +1,99 @@
+#ifndef Magnum_Audio_SampleConversion_h
+#define Magnum_Audio_SampleConversion_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Audio::convertPcm24ToPcm16(), @ref Magnum::Audio::convertPcm24ToFloat(), @ref Magnum::Audio::downmixToMono(), @ref Magnum::Audio::resample()
+ */
+
+#include <utility>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Audio/Buffer.h"
+#include "Magnum/Audio/visibility.h"
+
+namespace Magnum { namespace Audio {
+
+/**
+@brief Convert 24-bit PCM samples to 16-bit PCM
+
+The input is a tightly packed sequence of signed little-endian 24-bit samples,
+the output has the same sample count. The samples are rounded to nearest and
+clamped, channel interleaving is preserved, so the result can be passed to
+@ref Buffer::setData() as either @ref Buffer::Format::Mono16 or
+@ref Buffer::Format::Stereo16. Expects that the data size is divisible by
+three.
+@see @ref convertPcm24ToFloat()
+*/
+MAGNUM_AUDIO_EXPORT Containers::Array<char> convertPcm24ToPcm16(Containers::ArrayView<const char> data);
+
+/**
+@brief Convert 24-bit PCM samples to 32-bit floating-point
+
+Like @ref convertPcm24ToPcm16(), but the output samples are normalized to
+@f$ [-1.0, 1.0) @f$ and can be passed to @ref Buffer::setData() as
+@ref Buffer::Format::MonoFloat or @ref Buffer::Format::StereoFloat without
+any precision loss.
+*/
+MAGNUM_AUDIO_EXPORT Containers::Array<char> convertPcm24ToFloat(Containers::ArrayView<const char> data);
+
+/**
+@brief Downmix stereo samples to mono
+
+Averages left and right channel of each frame. Useful for positional sources,
+as OpenAL applies 3D spatialization only to mono buffers. Accepts
+@ref Buffer::Format::Stereo8, @ref Buffer::Format::Stereo16,
+@ref Buffer::Format::StereoFloat and @ref Buffer::Format::StereoDouble and
+returns the corresponding mono format together with the converted data.
+Expects that the data size is divisible by frame size.
+*/
+MAGNUM_AUDIO_EXPORT std::pair<Buffer::Format, Containers::Array<char>> downmixToMono(Buffer::Format format, Containers::ArrayView<const char> data);
+
+/**
+@brief Resample audio data to different frequency
+
+Uses a polyphase windowed-sinc filter with 32 taps per phase (widened
+accordingly when downsampling to filter out aliasing frequencies). The filter
+bank is precomputed for the reduced ratio of @p frequency and
+@p targetFrequency if it has at most 1024 phases, otherwise the phase is
+rounded to the nearest of 1024 evenly spaced ones. Samples outside of the data
+are treated as silence. Accepts @ref Buffer::Format::Mono16,
+@ref Buffer::Format::Stereo16, @ref Buffer::Format::MonoFloat and
+@ref Buffer::Format::StereoFloat, the output has the same format and
+@f$ \lfloor n \frac{f_{target}}{f} \rfloor @f$ frames, where @f$ n @f$ is
+input frame count. Expects that the data size is divisible by frame size and
+both frequencies are non-zero.
+
+The resampling is meant to be done at import time, so the buffers can be
+played back without any driver-side conversion.
+@see @ref AbstractImporter::frequency()
+*/
+MAGNUM_AUDIO_EXPORT Containers::Array<char> resample(Buffer::Format format, Containers::ArrayView<const char> data, UnsignedInt frequency, UnsignedInt targetFrequency);
+
+}}
+
+#endif
@@ -26,13 +26,26 @@
 #include "Source.h"
 
 #include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Assert.h>
 
 #include "Magnum/Audio/Buffer.h"
+#include "Magnum/Audio/Context.h"
 
 namespace Magnum { namespace Audio {
 
 /** @todo C++14: use VLA to avoid unnecessary allocations */
 
+Double Source::latencyInSeconds() const {
+    const Context& context = Context::current();
+    CORRADE_ASSERT(context._alGetSourcedvSOFT,
+        "Audio::Source::latencyInSeconds(): AL_SOFT_source_latency is not supported", {});
+
+    /* Returns the offset and latency together */
+    Double offsetLatency[2];
+    context._alGetSourcedvSOFT(_id, AL_SEC_OFFSET_LATENCY_SOFT, offsetLatency);
+    return offsetLatency[1];
+}
+
 Source& Source::setBuffer(Buffer* buffer) {
     alSourcei(_id, AL_BUFFER, buffer ? buffer->id() : 0);
     return *this;
@@ -40,6 +53,48 @@ Source& Source::setBuffer(Buffer* buffer) {
 
 namespace {
 
+template<class T> Containers::Array<ALuint> bufferIds(const T& buffers) {
+    Containers::Array<ALuint> ids(buffers.size());
+    for(auto it = buffers.begin(); it != buffers.end(); ++it)
+        ids[it-buffers.begin()] = it->get().id();
+    return ids;
+}
+
+}
+
+Source& Source::queueBuffers(std::initializer_list<std::reference_wrapper<Buffer>> buffers) {
+    const auto ids = bufferIds(buffers);
+    alSourceQueueBuffers(_id, ids.size(), ids);
+    return *this;
+}
+
+Source& Source::queueBuffers(const std::vector<std::reference_wrapper<Buffer>>& buffers) {
+    const auto ids = bufferIds(buffers);
+    alSourceQueueBuffers(_id, ids.size(), ids);
+    return *this;
+}
+
+Source& Source::unqueueBuffers(const Int count) {
+    /* The IDs are known to the caller already */
+    Containers::Array<ALuint> ids(count);
+    alSourceUnqueueBuffers(_id, count, ids);
+    return *this;
+}
+
+Int Source::queuedBufferCount() const {
+    Int count;
+    alGetSourcei(_id, AL_BUFFERS_QUEUED, &count);
+    return count;
+}
+
+Int Source::processedBufferCount() const {
+    Int count;
+    alGetSourcei(_id, AL_BUFFERS_PROCESSED, &count);
+    return count;
+}
+
+namespace {
+
 Containers::Array<ALuint> sourceIds(const std::initializer_list<std::reference_wrapper<Source>>& sources) {
     Containers::Array<ALuint> ids(sources.size());
     for(auto it = sources.begin(); it != sources.end(); ++it)
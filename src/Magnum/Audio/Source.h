@@ -45,8 +45,10 @@ namespace Magnum { namespace Audio {
 /**
 @brief Source
 
-Manages positional audio source.
-@todo Expose convenient API for buffer queuing
+Manages positional audio source. Static sounds are played by attaching a
+single buffer using @ref setBuffer(), long sounds can be streamed by queuing a
+sequence of buffers using @ref queueBuffers(). See @ref Stream for a
+convenient way to do that.
 */
 class MAGNUM_AUDIO_EXPORT Source {
     public:
@@ -486,7 +488,8 @@ class MAGNUM_AUDIO_EXPORT Source {
         /**
          * @brief Source type
          *
-         * @see @ref setBuffer(), @fn_al{GetSourcei} with @def_al{SOURCE_TYPE}
+         * @see @ref setBuffer(), @ref queueBuffers(), @fn_al{GetSourcei}
+         *      with @def_al{SOURCE_TYPE}
          */
         Type type() const;
 
@@ -502,6 +505,52 @@ class MAGNUM_AUDIO_EXPORT Source {
          */
         Source& setBuffer(Buffer* buffer);
 
+        /**
+         * @brief Queue buffers
+         * @return Reference to self (for method chaining)
+         *
+         * Appends the buffers to the end of the queue, the source plays them
+         * one after another without gaps. Changes source type to
+         * @ref Type::Streaming, all queued buffers must have the same format.
+         * The buffers must be already filled with data. Calling
+         * @ref setBuffer() with `nullptr` removes all buffers from the queue.
+         * @see @ref unqueueBuffers(), @ref queuedBufferCount(),
+         *      @fn_al{SourceQueueBuffers}
+         */
+        Source& queueBuffers(std::initializer_list<std::reference_wrapper<Buffer>> buffers);
+        Source& queueBuffers(const std::vector<std::reference_wrapper<Buffer>>& buffers); /**< @overload */
+
+        /**
+         * @brief Unqueue processed buffers
+         * @return Reference to self (for method chaining)
+         *
+         * Removes @p count buffers from the front of the queue, in the same
+         * order as they were queued. The count must not be larger than
+         * @ref processedBufferCount().
+         * @see @ref queueBuffers(), @fn_al{SourceUnqueueBuffers}
+         */
+        Source& unqueueBuffers(Int count);
+
+        /**
+         * @brief Count of queued buffers
+         *
+         * Includes also the buffers that were already processed.
+         * @see @ref processedBufferCount(), @fn_al{GetSourcei} with
+         *      @def_al{BUFFERS_QUEUED}
+         */
+        Int queuedBufferCount() const;
+
+        /**
+         * @brief Count of processed buffers
+         *
+         * Count of buffers at the front of the queue that were already played
+         * and can be removed using @ref unqueueBuffers() and filled with new
+         * data.
+         * @see @ref queuedBufferCount(), @fn_al{GetSourcei} with
+         *      @def_al{BUFFERS_PROCESSED}
+         */
+        Int processedBufferCount() const;
+
         /*@}*/
 
         /** @{ @name State management */
@@ -642,6 +691,17 @@ class MAGNUM_AUDIO_EXPORT Source {
          */
         Float offsetInSeconds() const;
 
+        /**
+         * @brief Playback latency in seconds
+         *
+         * Time until the sample at current @ref offsetInSeconds() is heard,
+         * including the samples already mixed by the device.
+         * @see @ref Context::deviceLatency(), @fn_al{GetSourcedvSOFT} with
+         *      @def_al{SEC_OFFSET_LATENCY_SOFT}
+         * @requires_al_extension Extension @al_extension{SOFT,source_latency}
+         */
+        Double latencyInSeconds() const;
+
         /**
          * @brief Set offset in seconds
          * @return Reference to self (for method chaining)
@@ -713,6 +773,12 @@ inline Source& Source::operator=(Source&& other) {
     return *this;
 }
 
+inline auto Source::type() const -> Type {
+    ALint type;
+    alGetSourcei(_id, AL_SOURCE_TYPE, &type);
+    return Type(type);
+}
+
 inline auto Source::state() const -> State {
     ALint state;
     alGetSourcei(_id, AL_SOURCE_STATE, &state);
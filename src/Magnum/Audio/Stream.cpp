@@ -0,0 +1,119 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Stream.h"
+
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Audio/AbstractImporter.h"
+#include "Magnum/Audio/Source.h"
+
+namespace Magnum { namespace Audio {
+
+Stream::Stream(Source& source, AbstractImporter& importer, const UnsignedInt bufferCount, const std::size_t bufferSize): _source(source), _importer(importer), _format{importer.format()}, _frequency{importer.frequency()}, _buffers{bufferCount}, _chunk{bufferSize}, _first{}, _queued{}, _underrunCount{}, _looping{}, _playing{} {
+    CORRADE_ASSERT(importer.features() & AbstractImporter::Feature::Streaming,
+        "Audio::Stream: the importer doesn't support streaming", );
+    CORRADE_ASSERT(bufferCount && bufferSize,
+        "Audio::Stream: buffer count and size must not be zero", );
+}
+
+Stream::~Stream() { stop(); }
+
+bool Stream::fill(Buffer& buffer) {
+    std::size_t size = _importer.read(_chunk);
+
+    /* Continue from the beginning right in the next buffer, the source plays
+       the queue without gaps */
+    if(!size && _looping) {
+        _importer.rewind();
+        size = _importer.read(_chunk);
+    }
+
+    if(!size) return false;
+
+    buffer.setData(_format, _chunk.prefix(size), _frequency);
+    return true;
+}
+
+Stream& Stream::play() {
+    stop();
+    _importer.rewind();
+
+    for(; _queued != _buffers.size(); ++_queued) {
+        Buffer& buffer = _buffers[_queued];
+        if(!fill(buffer)) break;
+        _source.queueBuffers({buffer});
+    }
+
+    _playing = _queued;
+    if(_playing) _source.play();
+    return *this;
+}
+
+Stream& Stream::stop() {
+    /* All buffers are processed after stopping, so they can be detached */
+    _source.stop();
+    _source.setBuffer(nullptr);
+    _first = _queued = 0;
+    _playing = false;
+    return *this;
+}
+
+bool Stream::update() {
+    if(!_playing) return false;
+
+    /* Take the played buffers from the front of the queue */
+    const UnsignedInt processed = _source.processedBufferCount();
+    if(processed) {
+        _source.unqueueBuffers(processed);
+        _first = (_first + processed) % _buffers.size();
+        _queued -= processed;
+    }
+
+    /* Refill them and put them at the back of the queue */
+    while(_queued != _buffers.size()) {
+        Buffer& buffer = _buffers[(_first + _queued) % _buffers.size()];
+        if(!fill(buffer)) break;
+        _source.queueBuffers({buffer});
+        ++_queued;
+    }
+
+    /* Everything played */
+    if(!_queued) {
+        _playing = false;
+        return false;
+    }
+
+    /* The source ran out of data before we managed to refill the buffers,
+       resume the playback */
+    if(_source.state() == Source::State::Stopped) {
+        ++_underrunCount;
+        _source.play();
+    }
+
+    return true;
+}
+
+}}
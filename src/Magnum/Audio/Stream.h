@@ -0,0 +1,186 @@
+#ifndef Magnum_Audio_Stream_h
+#define Magnum_Audio_Stream_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Audio::Stream
+ */
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Audio/Audio.h"
+#include "Magnum/Audio/Buffer.h"
+#include "Magnum/Audio/visibility.h"
+
+namespace Magnum { namespace Audio {
+
+/**
+@brief Streaming playback
+
+Plays long sounds without having the whole sample data in memory. The data are
+read in chunks from an importer supporting
+@ref AbstractImporter::Feature::Streaming into a rotating set of buffers
+queued on the source. Call @ref update() periodically (e.g. once each frame)
+to refill the buffers that were already played:
+@code
+std::unique_ptr<Audio::AbstractImporter> importer = manager.instance("WavAudioImporter");
+importer->openFile("music.wav");
+
+Audio::Source source;
+Audio::Stream stream{source, *importer};
+stream.setLooping(true)
+    .play();
+
+// each frame
+stream.update();
+@endcode
+
+The total size of queued data (@p bufferCount times @p bufferSize passed to the
+constructor) must be large enough to cover the time between two @ref update()
+calls, otherwise the source runs out of data. That is detected and counted in
+@ref underrunCount() and the playback is resumed with the next chunk.
+
+The source and the importer must stay alive and the importer must have the
+file opened for the whole stream lifetime. The source shouldn't be used for
+anything else in the meantime.
+*/
+class MAGNUM_AUDIO_EXPORT Stream {
+    public:
+        /**
+         * @brief Constructor
+         * @param source        Source to play the stream with
+         * @param importer      Importer with opened file
+         * @param bufferCount   Count of buffers in the rotating queue
+         * @param bufferSize    Size of each buffer in bytes
+         *
+         * The buffers are created but not filled with any data, use
+         * @ref play() to start the playback.
+         */
+        explicit Stream(Source& source, AbstractImporter& importer, UnsignedInt bufferCount = 4, std::size_t bufferSize = 32768);
+
+        /** @brief Copying is not allowed */
+        Stream(const Stream&) = delete;
+
+        /** @brief Moving is not allowed */
+        Stream(Stream&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Calls @ref stop().
+         */
+        ~Stream();
+
+        /** @brief Copying is not allowed */
+        Stream& operator=(const Stream&) = delete;
+
+        /** @brief Moving is not allowed */
+        Stream& operator=(Stream&&) = delete;
+
+        /** @brief Source the stream is played with */
+        Source& source() { return _source; }
+
+        /** @brief Importer the data are read from */
+        AbstractImporter& importer() { return _importer; }
+
+        /** @brief Whether the stream is looping */
+        bool isLooping() const { return _looping; }
+
+        /**
+         * @brief Set stream looping
+         * @return Reference to self (for method chaining)
+         *
+         * If enabled, the importer is rewound after reaching end of the
+         * stream and the data from the beginning are queued right after the
+         * end, resulting in gapless loop. Default is `false`. Note that
+         * @ref Source::setLooping() can't be used for streaming, as it would
+         * loop the queued buffers only.
+         */
+        Stream& setLooping(bool looping) {
+            _looping = looping;
+            return *this;
+        }
+
+        /** @brief Count of queued buffers that weren't played yet */
+        UnsignedInt queuedBufferCount() const { return _queued; }
+
+        /**
+         * @brief Count of buffer underruns
+         *
+         * Count of times the source ran out of queued data while the stream
+         * was still playing.
+         * @see @ref update()
+         */
+        UnsignedInt underrunCount() const { return _underrunCount; }
+
+        /**
+         * @brief Play the stream
+         * @return Reference to self (for method chaining)
+         *
+         * Stops the source, rewinds the importer, fills and queues all the
+         * buffers and starts the playback.
+         * @see @ref AbstractImporter::rewind(), @ref Source::play()
+         */
+        Stream& play();
+
+        /**
+         * @brief Stop the stream
+         * @return Reference to self (for method chaining)
+         *
+         * Stops the source and removes all buffers from its queue.
+         * @see @ref Source::stop()
+         */
+        Stream& stop();
+
+        /**
+         * @brief Update the stream
+         * @return `False` if the stream reached its end and everything was
+         *      played, `true` otherwise
+         *
+         * Removes the processed buffers from the source queue, fills them
+         * with next data and queues them again. If the source stopped
+         * because the queue ran empty, increases @ref underrunCount() and
+         * resumes the playback.
+         */
+        bool update();
+
+    private:
+        MAGNUM_AUDIO_LOCAL bool fill(Buffer& buffer);
+
+        Source& _source;
+        AbstractImporter& _importer;
+        Buffer::Format _format;
+        UnsignedInt _frequency;
+        Containers::Array<Buffer> _buffers;
+        Containers::Array<char> _chunk;
+        UnsignedInt _first, _queued, _underrunCount;
+        bool _looping, _playing;
+};
+
+}}
+
+#endif
@@ -23,6 +23,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
+#include <string>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/Utility/Directory.h>
@@ -37,10 +39,12 @@ struct AbstractImporterTest: TestSuite::Tester {
     explicit AbstractImporterTest();
 
     void openFile();
+    void stream();
 };
 
 AbstractImporterTest::AbstractImporterTest() {
-    addTests({&AbstractImporterTest::openFile});
+    addTests({&AbstractImporterTest::openFile,
+              &AbstractImporterTest::stream});
 }
 
 void AbstractImporterTest::openFile() {
@@ -71,6 +75,45 @@ void AbstractImporterTest::openFile() {
     CORRADE_VERIFY(importer.isOpened());
 }
 
+void AbstractImporterTest::stream() {
+    class StreamingImporter: public Audio::AbstractImporter {
+        public:
+            explicit StreamingImporter(): position{} {}
+
+            std::size_t position;
+
+        private:
+            Features doFeatures() const override { return Feature::Streaming; }
+            bool doIsOpened() const override { return true; }
+            void doClose() override {}
+
+            Buffer::Format doFormat() const override { return {}; }
+            UnsignedInt doFrequency() const override { return {}; }
+            Corrade::Containers::Array<char> doData() override { return nullptr; }
+
+            std::size_t doRead(Containers::ArrayView<char> data) override {
+                const std::size_t size = std::min(data.size(), 5 - position);
+                for(std::size_t i = 0; i != size; ++i)
+                    data[i] = char('a' + position++);
+                return size;
+            }
+
+            void doRewind() override { position = 0; }
+    };
+
+    StreamingImporter importer;
+    char data[3];
+    CORRADE_COMPARE(importer.read(data), 3);
+    CORRADE_COMPARE(std::string(data, 3), "abc");
+    CORRADE_COMPARE(importer.read(data), 2);
+    CORRADE_COMPARE(std::string(data, 2), "de");
+    CORRADE_COMPARE(importer.read(data), 0);
+
+    importer.rewind();
+    CORRADE_COMPARE(importer.read(data), 3);
+    CORRADE_COMPARE(std::string(data, 3), "abc");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Audio::Test::AbstractImporterTest)
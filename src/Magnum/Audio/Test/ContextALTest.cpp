@@ -36,13 +36,17 @@ struct ContextALTest: TestSuite::Tester {
 
     void extensionsString();
     void isExtensionEnabled();
+    void attributes();
+    void deviceLatency();
 
     Context _context;
 };
 
 ContextALTest::ContextALTest() {
     addTests({&ContextALTest::extensionsString,
-              &ContextALTest::isExtensionEnabled});
+              &ContextALTest::isExtensionEnabled,
+              &ContextALTest::attributes,
+              &ContextALTest::deviceLatency});
 }
 
 void ContextALTest::extensionsString() {
@@ -55,6 +59,20 @@ void ContextALTest::isExtensionEnabled() {
     CORRADE_VERIFY(Context::current().isExtensionSupported<Extensions::ALC::EXT::ENUMERATION>());
 }
 
+void ContextALTest::attributes() {
+    CORRADE_VERIFY(_context.frequency() > 0);
+    CORRADE_VERIFY(_context.refreshRate() > 0);
+    CORRADE_VERIFY(_context.monoSourceCount() > 0);
+    CORRADE_VERIFY(_context.stereoSourceCount() >= 0);
+}
+
+void ContextALTest::deviceLatency() {
+    if(!_context.isExtensionSupported<Extensions::ALC::SOFT::device_clock>())
+        CORRADE_SKIP(Extensions::ALC::SOFT::device_clock::string() + std::string(" is not supported"));
+
+    CORRADE_VERIFY(_context.deviceLatency() >= 0);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Audio::Test::ContextALTest)
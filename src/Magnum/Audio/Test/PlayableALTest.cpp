@@ -26,6 +26,7 @@
 
 #include <Corrade/TestSuite/Tester.h>
 
+#include "Magnum/Audio/Buffer.h"
 #include "Magnum/Audio/Context.h"
 #include "Magnum/Audio/Playable.h"
 #include "Magnum/SceneGraph/Scene.h"
@@ -42,13 +43,15 @@ struct PlayableALTest: TestSuite::Tester {
 
     void feature();
     void group();
+    void voiceLimit();
 
     Context _context;
 };
 
 PlayableALTest::PlayableALTest() {
     addTests({&PlayableALTest::feature,
-              &PlayableALTest::group});
+              &PlayableALTest::group,
+              &PlayableALTest::voiceLimit});
 }
 
 void PlayableALTest::feature() {
@@ -91,6 +94,48 @@ void PlayableALTest::group() {
     group.stop();
 }
 
+void PlayableALTest::voiceLimit() {
+    constexpr char data[]{'\x00', '\x7f', '\xff', '\x7f'};
+    Buffer buffer;
+    buffer.setData(Buffer::Format::Mono8, data, 22050);
+
+    Scene3D scene;
+    Object3D a{&scene}, b{&scene}, c{&scene};
+    a.translate({1.0f, 0.0f, 0.0f});
+    b.translate({0.0f, 2.0f, 0.0f});
+    c.translate({0.0f, 0.0f, 3.0f});
+
+    PlayableGroup3D group;
+    group.setMaxVoiceCount(2);
+    Playable3D pa{a, &group}, pb{b, &group}, pc{c, &group};
+    for(Playable3D* p: {&pa, &pb, &pc})
+        p->source().setBuffer(&buffer).setLooping(true);
+
+    /* The farthest one gets virtualized */
+    Renderer::setListenerPosition(Vector3{});
+    group.setClean();
+    group.play();
+    CORRADE_VERIFY(!pa.isVirtual());
+    CORRADE_VERIFY(!pb.isVirtual());
+    CORRADE_VERIFY(pc.isVirtual());
+    CORRADE_COMPARE(pa.source().state(), Source::State::Playing);
+    CORRADE_COMPARE(pb.source().state(), Source::State::Playing);
+    CORRADE_VERIFY(pc.source().state() != Source::State::Playing);
+
+    /* Moving the virtual one closer resumes it */
+    c.translate({0.0f, 0.0f, -2.5f});
+    group.setClean();
+    CORRADE_VERIFY(!pa.isVirtual());
+    CORRADE_VERIFY(pb.isVirtual());
+    CORRADE_VERIFY(!pc.isVirtual());
+    CORRADE_COMPARE(pc.source().state(), Source::State::Playing);
+
+    /* Stopping removes the virtual state */
+    group.stop();
+    CORRADE_VERIFY(!pb.isVirtual());
+    CORRADE_VERIFY(pb.source().state() != Source::State::Playing);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Audio::Test::PlayableALTest)
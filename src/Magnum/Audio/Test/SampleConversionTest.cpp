@@ -0,0 +1,202 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/Audio/SampleConversion.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace Audio { namespace Test {
+
+struct SampleConversionTest: TestSuite::Tester {
+    explicit SampleConversionTest();
+
+    void pcm24ToPcm16();
+    void pcm24ToFloat();
+
+    void downmix8();
+    void downmix16();
+    void downmixFloat();
+
+    void resampleSameFrequency();
+    void resampleConstant();
+    void resampleSine();
+    void resampleDownsampleAliasing();
+    void resampleStereo();
+};
+
+SampleConversionTest::SampleConversionTest() {
+    addTests({&SampleConversionTest::pcm24ToPcm16,
+              &SampleConversionTest::pcm24ToFloat,
+
+              &SampleConversionTest::downmix8,
+              &SampleConversionTest::downmix16,
+              &SampleConversionTest::downmixFloat,
+
+              &SampleConversionTest::resampleSameFrequency,
+              &SampleConversionTest::resampleConstant,
+              &SampleConversionTest::resampleSine,
+              &SampleConversionTest::resampleDownsampleAliasing,
+              &SampleConversionTest::resampleStereo});
+}
+
+namespace {
+
+constexpr char Pcm24[]{
+    '\x00', '\x00', '\x00',     /* 0 */
+    '\x7f', '\x01', '\x00',     /* 383, rounds down to 1 */
+    '\x80', '\x01', '\x00',     /* 384, rounds up to 2 */
+    '\x00', '\xfd', '\xff',     /* -768 */
+    '\xff', '\xff', '\x7f',     /* max, clamped */
+    '\x00', '\x00', '\x80'      /* min */
+};
+
+template<class T> Containers::ArrayView<const T> samplesOf(const Containers::Array<char>& data) {
+    return {reinterpret_cast<const T*>(data.data()), data.size()/sizeof(T)};
+}
+
+template<class T> Containers::ArrayView<const char> bytesOf(const std::vector<T>& data) {
+    return {reinterpret_cast<const char*>(data.data()), data.size()*sizeof(T)};
+}
+
+}
+
+void SampleConversionTest::pcm24ToPcm16() {
+    const Containers::Array<char> out = convertPcm24ToPcm16(Pcm24);
+    CORRADE_COMPARE_AS(samplesOf<Short>(out),
+        (Containers::Array<Short>::from(0, 1, 2, -3, 32767, -32768)),
+        TestSuite::Compare::Container);
+}
+
+void SampleConversionTest::pcm24ToFloat() {
+    const Containers::Array<char> out = convertPcm24ToFloat(Pcm24);
+    CORRADE_COMPARE_AS(samplesOf<Float>(out),
+        (Containers::Array<Float>::from(0.0f, 383.0f/8388608.0f, 384.0f/8388608.0f, -768.0f/8388608.0f, 8388607.0f/8388608.0f, -1.0f)),
+        TestSuite::Compare::Container);
+}
+
+void SampleConversionTest::downmix8() {
+    const std::vector<UnsignedByte> data{0, 255, 128, 128, 200, 100};
+    const auto out = downmixToMono(Buffer::Format::Stereo8, bytesOf(data));
+    CORRADE_COMPARE(out.first, Buffer::Format::Mono8);
+    CORRADE_COMPARE_AS(samplesOf<UnsignedByte>(out.second),
+        (Containers::Array<UnsignedByte>::from(127, 128, 150)),
+        TestSuite::Compare::Container);
+}
+
+void SampleConversionTest::downmix16() {
+    const std::vector<Short> data{32767, 32767, -32768, -32768, 1000, -3000};
+    const auto out = downmixToMono(Buffer::Format::Stereo16, bytesOf(data));
+    CORRADE_COMPARE(out.first, Buffer::Format::Mono16);
+    CORRADE_COMPARE_AS(samplesOf<Short>(out.second),
+        (Containers::Array<Short>::from(32767, -32768, -1000)),
+        TestSuite::Compare::Container);
+}
+
+void SampleConversionTest::downmixFloat() {
+    const std::vector<Float> data{1.0f, 0.0f, -0.5f, 0.25f};
+    const auto out = downmixToMono(Buffer::Format::StereoFloat, bytesOf(data));
+    CORRADE_COMPARE(out.first, Buffer::Format::MonoFloat);
+    CORRADE_COMPARE_AS(samplesOf<Float>(out.second),
+        (Containers::Array<Float>::from(0.5f, -0.125f)),
+        TestSuite::Compare::Container);
+}
+
+void SampleConversionTest::resampleSameFrequency() {
+    const std::vector<Short> data{1, -2, 3, -4};
+    const Containers::Array<char> out = resample(Buffer::Format::Mono16, bytesOf(data), 22050, 22050);
+    CORRADE_COMPARE_AS(samplesOf<Short>(out),
+        (Containers::Array<Short>::from(1, -2, 3, -4)),
+        TestSuite::Compare::Container);
+}
+
+void SampleConversionTest::resampleConstant() {
+    const std::vector<Short> data(1000, 10000);
+    const Containers::Array<char> out = resample(Buffer::Format::Mono16, bytesOf(data), 22050, 44100);
+    const Containers::ArrayView<const Short> samples = samplesOf<Short>(out);
+    CORRADE_COMPARE(samples.size(), 2000);
+
+    /* Unit DC gain away from the edges, where the data fade from silence */
+    for(std::size_t i = 64; i != samples.size() - 64; ++i)
+        CORRADE_COMPARE(samples[i], 10000);
+}
+
+void SampleConversionTest::resampleSine() {
+    /* 1 kHz sine from 44.1 kHz to 48 kHz */
+    std::vector<Float> data(4410);
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = 0.5f*std::sin(2.0f*Constants::pi()*1000.0f*i/44100.0f);
+
+    const Containers::Array<char> out = resample(Buffer::Format::MonoFloat, bytesOf(data), 44100, 48000);
+    const Containers::ArrayView<const Float> samples = samplesOf<Float>(out);
+    CORRADE_COMPARE(samples.size(), 4800);
+
+    Float maxError = 0.0f;
+    for(std::size_t i = 64; i != samples.size() - 64; ++i)
+        maxError = Math::max(maxError, std::abs(samples[i] - 0.5f*std::sin(2.0f*Constants::pi()*1000.0f*i/48000.0f)));
+    CORRADE_COMPARE_AS(maxError, 0.001f, TestSuite::Compare::Less);
+}
+
+void SampleConversionTest::resampleDownsampleAliasing() {
+    /* 6 kHz sine is above the Nyquist frequency of the 8 kHz output, so it
+       should get filtered out instead of aliasing to 2 kHz */
+    std::vector<Float> data(4800);
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = std::sin(2.0f*Constants::pi()*6000.0f*i/48000.0f);
+
+    const Containers::Array<char> out = resample(Buffer::Format::MonoFloat, bytesOf(data), 48000, 8000);
+    const Containers::ArrayView<const Float> samples = samplesOf<Float>(out);
+    CORRADE_COMPARE(samples.size(), 800);
+
+    Float maxValue = 0.0f;
+    for(std::size_t i = 32; i != samples.size() - 32; ++i)
+        maxValue = Math::max(maxValue, std::abs(samples[i]));
+    CORRADE_COMPARE_AS(maxValue, 0.01f, TestSuite::Compare::Less);
+}
+
+void SampleConversionTest::resampleStereo() {
+    /* Channels are filtered independently */
+    std::vector<Short> data(2000);
+    for(std::size_t i = 0; i != data.size()/2; ++i) {
+        data[i*2] = 8000;
+        data[i*2 + 1] = -16000;
+    }
+
+    const Containers::Array<char> out = resample(Buffer::Format::Stereo16, bytesOf(data), 44100, 32000);
+    const Containers::ArrayView<const Short> samples = samplesOf<Short>(out);
+    CORRADE_COMPARE(samples.size(), 1450);
+
+    for(std::size_t i = 64; i != samples.size()/2 - 64; ++i) {
+        CORRADE_COMPARE(samples[i*2], 8000);
+        CORRADE_COMPARE(samples[i*2 + 1], -16000);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Audio::Test::SampleConversionTest)
@@ -25,7 +25,9 @@
 
 #include <Corrade/TestSuite/Tester.h>
 
+#include "Magnum/Audio/Buffer.h"
 #include "Magnum/Audio/Context.h"
+#include "Magnum/Audio/Extensions.h"
 #include "Magnum/Audio/Source.h"
 
 namespace Magnum { namespace Audio { namespace Test {
@@ -46,6 +48,8 @@ struct SourceALTest: TestSuite::Tester {
     void minGain();
     void coneAnglesAndGain();
     void rolloffFactor();
+    void queueBuffers();
+    void latency();
 
     Context _context;
 };
@@ -63,7 +67,9 @@ SourceALTest::SourceALTest() {
               &SourceALTest::maxGain,
               &SourceALTest::minGain,
               &SourceALTest::coneAnglesAndGain,
-              &SourceALTest::rolloffFactor});
+              &SourceALTest::rolloffFactor,
+              &SourceALTest::queueBuffers,
+              &SourceALTest::latency});
 }
 
 void SourceALTest::construct() {
@@ -168,6 +174,37 @@ void SourceALTest::rolloffFactor() {
     CORRADE_COMPARE(source.rolloffFactor(), fact);
 }
 
+void SourceALTest::queueBuffers() {
+    constexpr char data[]{'\x00', '\x7f', '\xff', '\x7f'};
+    Buffer a, b;
+    a.setData(Buffer::Format::Mono8, data, 22050);
+    b.setData(Buffer::Format::Mono8, data, 22050);
+
+    Source source;
+    source.queueBuffers({a, b});
+    CORRADE_COMPARE(source.type(), Source::Type::Streaming);
+    CORRADE_COMPARE(source.queuedBufferCount(), 2);
+    CORRADE_COMPARE(source.processedBufferCount(), 0);
+
+    /* All buffers are processed after stopping */
+    source.play();
+    source.stop();
+    CORRADE_COMPARE(source.processedBufferCount(), 2);
+    source.unqueueBuffers(1);
+    CORRADE_COMPARE(source.queuedBufferCount(), 1);
+
+    source.setBuffer(nullptr);
+    CORRADE_COMPARE(source.queuedBufferCount(), 0);
+}
+
+void SourceALTest::latency() {
+    if(!_context.isExtensionSupported<Extensions::AL::SOFT::source_latency>())
+        CORRADE_SKIP(Extensions::AL::SOFT::source_latency::string() + std::string(" is not supported"));
+
+    Source source;
+    CORRADE_VERIFY(source.latencyInSeconds() >= 0.0);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Audio::Test::SourceALTest)
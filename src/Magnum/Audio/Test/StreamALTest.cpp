@@ -0,0 +1,138 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Audio/AbstractImporter.h"
+#include "Magnum/Audio/Context.h"
+#include "Magnum/Audio/Source.h"
+#include "Magnum/Audio/Stream.h"
+
+namespace Magnum { namespace Audio { namespace Test {
+
+struct StreamALTest: TestSuite::Tester {
+    explicit StreamALTest();
+
+    void play();
+    void playShort();
+    void looping();
+    void stop();
+
+    Context _context;
+};
+
+StreamALTest::StreamALTest() {
+    addTests({&StreamALTest::play,
+              &StreamALTest::playShort,
+              &StreamALTest::looping,
+              &StreamALTest::stop});
+}
+
+namespace {
+
+class SilenceImporter: public Audio::AbstractImporter {
+    public:
+        explicit SilenceImporter(std::size_t size): size{size}, position{}, rewindCount{} {}
+
+        std::size_t size, position, rewindCount;
+
+    private:
+        Features doFeatures() const override { return Feature::Streaming; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        Buffer::Format doFormat() const override { return Buffer::Format::Mono8; }
+        UnsignedInt doFrequency() const override { return 22050; }
+        Corrade::Containers::Array<char> doData() override { return nullptr; }
+
+        std::size_t doRead(Containers::ArrayView<char> data) override {
+            const std::size_t count = std::min(data.size(), size - position);
+            std::fill_n(data.begin(), count, '\x80');
+            position += count;
+            return count;
+        }
+
+        void doRewind() override {
+            position = 0;
+            ++rewindCount;
+        }
+};
+
+}
+
+void StreamALTest::play() {
+    SilenceImporter importer{4096};
+    Source source;
+    Stream stream{source, importer, 3, 1024};
+    stream.play();
+
+    CORRADE_COMPARE(source.type(), Source::Type::Streaming);
+    CORRADE_COMPARE(source.queuedBufferCount(), 3);
+    CORRADE_COMPARE(stream.queuedBufferCount(), 3);
+    CORRADE_COMPARE(importer.position, 3072);
+    CORRADE_VERIFY(stream.update());
+}
+
+void StreamALTest::playShort() {
+    SilenceImporter importer{1500};
+    Source source;
+    Stream stream{source, importer, 3, 1024};
+    stream.play();
+
+    /* Only two buffers have any data */
+    CORRADE_COMPARE(source.queuedBufferCount(), 2);
+    CORRADE_COMPARE(stream.queuedBufferCount(), 2);
+}
+
+void StreamALTest::looping() {
+    SilenceImporter importer{1500};
+    Source source;
+    Stream stream{source, importer, 3, 1024};
+    stream.setLooping(true)
+        .play();
+
+    /* The rewind in play() and one more after reaching the end */
+    CORRADE_COMPARE(source.queuedBufferCount(), 3);
+    CORRADE_COMPARE(importer.rewindCount, 2);
+    CORRADE_COMPARE(importer.position, 1024);
+}
+
+void StreamALTest::stop() {
+    SilenceImporter importer{4096};
+    Source source;
+    Stream stream{source, importer, 3, 1024};
+    stream.play();
+    stream.stop();
+
+    CORRADE_COMPARE(source.queuedBufferCount(), 0);
+    CORRADE_COMPARE(stream.queuedBufferCount(), 0);
+    CORRADE_VERIFY(!stream.update());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Audio::Test::StreamALTest)
@@ -0,0 +1,192 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Audio/Buffer.h"
+#include "Magnum/Audio/Context.h"
+#include "Magnum/Audio/VoicePool.h"
+
+namespace Magnum { namespace Audio { namespace Test {
+
+struct VoicePoolALTest: TestSuite::Tester {
+    explicit VoicePoolALTest();
+
+    void construct();
+    void play();
+    void stop();
+    void priority();
+    void virtualOffset();
+    void virtualOffsetLooping();
+    void removeVoice();
+
+    Context _context;
+    Buffer _buffer;
+};
+
+VoicePoolALTest::VoicePoolALTest() {
+    addTests({&VoicePoolALTest::construct,
+              &VoicePoolALTest::play,
+              &VoicePoolALTest::stop,
+              &VoicePoolALTest::priority,
+              &VoicePoolALTest::virtualOffset,
+              &VoicePoolALTest::virtualOffsetLooping,
+              &VoicePoolALTest::removeVoice});
+
+    /* One second of silence */
+    const std::vector<Short> data(22050);
+    _buffer.setData(Buffer::Format::Mono16, {data.data(), data.size()}, 22050);
+
+    Renderer::setDistanceModel(Renderer::DistanceModel::InverseClamped);
+}
+
+void VoicePoolALTest::construct() {
+    VoicePool pool{4};
+    CORRADE_COMPARE(pool.sourceCount(), 4);
+    CORRADE_COMPARE(pool.realVoiceCount(), 0);
+}
+
+void VoicePoolALTest::play() {
+    VoicePool pool{4};
+    const UnsignedInt voice = pool.addVoice(_buffer);
+    CORRADE_VERIFY(!pool.isPlaying(voice));
+    CORRADE_VERIFY(!pool.source(voice));
+
+    /* There's a free source, so the voice gets it immediately */
+    pool.play(voice);
+    CORRADE_VERIFY(pool.isPlaying(voice));
+    CORRADE_VERIFY(!pool.isVirtual(voice));
+    CORRADE_VERIFY(pool.source(voice));
+    CORRADE_COMPARE(pool.source(voice)->state(), Source::State::Playing);
+    CORRADE_COMPARE(pool.realVoiceCount(), 1);
+}
+
+void VoicePoolALTest::stop() {
+    VoicePool pool{4};
+    const UnsignedInt voice = pool.addVoice(_buffer);
+    pool.play(voice)
+        .stop(voice);
+    CORRADE_VERIFY(!pool.isPlaying(voice));
+    CORRADE_VERIFY(!pool.source(voice));
+    CORRADE_COMPARE(pool.realVoiceCount(), 0);
+}
+
+void VoicePoolALTest::priority() {
+    VoicePool pool{1};
+    const UnsignedInt far = pool.addVoice(_buffer);
+    const UnsignedInt near = pool.addVoice(_buffer);
+    pool.setPosition(far, {0.0f, 0.0f, -10.0f})
+        .setPosition(near, {0.0f, 0.0f, -1.0f})
+        .play(far)
+        .play(near);
+
+    /* The first one got the only source */
+    CORRADE_VERIFY(!pool.isVirtual(far));
+    CORRADE_VERIFY(pool.isVirtual(near));
+
+    /* The closer one is more audible */
+    pool.update({}, 0.0f);
+    CORRADE_VERIFY(pool.isVirtual(far));
+    CORRADE_VERIFY(!pool.isVirtual(near));
+    CORRADE_COMPARE(pool.realVoiceCount(), 1);
+
+    /* Ten times the priority outweighs ten times the distance */
+    pool.setPriority(far, 20.0f)
+        .update({}, 0.0f);
+    CORRADE_VERIFY(!pool.isVirtual(far));
+    CORRADE_VERIFY(pool.isVirtual(near));
+
+    /* Muted voice is the least audible */
+    pool.setGain(far, 0.0f)
+        .update({}, 0.0f);
+    CORRADE_VERIFY(pool.isVirtual(far));
+    CORRADE_VERIFY(!pool.isVirtual(near));
+}
+
+void VoicePoolALTest::virtualOffset() {
+    VoicePool pool{1};
+    const UnsignedInt real = pool.addVoice(_buffer);
+    const UnsignedInt virt = pool.addVoice(_buffer);
+    pool.setGain(virt, 0.5f)
+        .setLooping(real, true)
+        .play(real)
+        .play(virt);
+    CORRADE_VERIFY(pool.isVirtual(virt));
+
+    /* The virtual voice is still advancing */
+    pool.update({}, 0.25f);
+    CORRADE_VERIFY(pool.isVirtual(virt));
+    CORRADE_COMPARE(pool.offsetInSeconds(virt), 0.25f);
+
+    /* Twice the pitch, twice the speed */
+    pool.setPitch(virt, 2.0f)
+        .update({}, 0.25f);
+    CORRADE_COMPARE(pool.offsetInSeconds(virt), 0.75f);
+
+    /* And it stops at the end */
+    pool.update({}, 0.25f);
+    CORRADE_VERIFY(!pool.isPlaying(virt));
+    CORRADE_VERIFY(!pool.isVirtual(virt));
+}
+
+void VoicePoolALTest::virtualOffsetLooping() {
+    VoicePool pool{1};
+    const UnsignedInt real = pool.addVoice(_buffer);
+    const UnsignedInt virt = pool.addVoice(_buffer);
+    pool.setGain(virt, 0.5f)
+        .setLooping(real, true)
+        .setLooping(virt, true)
+        .play(real)
+        .play(virt);
+
+    pool.update({}, 1.5f);
+    CORRADE_VERIFY(pool.isVirtual(virt));
+    CORRADE_COMPARE(pool.offsetInSeconds(virt), 0.5f);
+
+    /* Gets the source once the other voice stops, resuming at the offset */
+    pool.stop(real)
+        .update({}, 0.0f);
+    CORRADE_VERIFY(!pool.isVirtual(virt));
+    CORRADE_VERIFY(pool.offsetInSeconds(virt) >= 0.5f);
+}
+
+void VoicePoolALTest::removeVoice() {
+    VoicePool pool{1};
+    const UnsignedInt a = pool.addVoice(_buffer);
+    const UnsignedInt b = pool.addVoice(_buffer);
+    pool.play(a);
+    CORRADE_COMPARE(pool.realVoiceCount(), 1);
+
+    pool.removeVoice(a);
+    CORRADE_COMPARE(pool.realVoiceCount(), 0);
+
+    /* The ID gets reused */
+    CORRADE_COMPARE(pool.addVoice(_buffer), a);
+    CORRADE_VERIFY(a != b);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Audio::Test::VoicePoolALTest)
@@ -0,0 +1,81 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <limits>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Audio/VoicePool.h"
+
+namespace Magnum { namespace Audio { namespace Test {
+
+struct VoicePoolTest: TestSuite::Tester {
+    explicit VoicePoolTest();
+
+    void attenuationNone();
+    void attenuationInverse();
+    void attenuationLinear();
+    void attenuationExponent();
+};
+
+VoicePoolTest::VoicePoolTest() {
+    addTests({&VoicePoolTest::attenuationNone,
+              &VoicePoolTest::attenuationInverse,
+              &VoicePoolTest::attenuationLinear,
+              &VoicePoolTest::attenuationExponent});
+}
+
+void VoicePoolTest::attenuationNone() {
+    CORRADE_COMPARE(VoicePool::attenuation(Renderer::DistanceModel::None, 100.0f, 1.0f, 1.0f, 10.0f), 1.0f);
+}
+
+void VoicePoolTest::attenuationInverse() {
+    constexpr Float max = std::numeric_limits<Float>::max();
+    CORRADE_COMPARE(VoicePool::attenuation(Renderer::DistanceModel::Inverse, 4.0f, 1.0f, 1.0f, max), 0.25f);
+    CORRADE_COMPARE(VoicePool::attenuation(Renderer::DistanceModel::Inverse, 5.0f, 2.0f, 0.5f, max), 2.0f/3.5f);
+
+    /* Clamped is full gain closer than reference distance and doesn't go
+       further than max distance */
+    CORRADE_COMPARE(VoicePool::attenuation(Renderer::DistanceModel::Inverse, 0.5f, 1.0f, 1.0f, max), 2.0f);
+    CORRADE_COMPARE(VoicePool::attenuation(Renderer::DistanceModel::InverseClamped, 0.5f, 1.0f, 1.0f, max), 1.0f);
+    CORRADE_COMPARE(VoicePool::attenuation(Renderer::DistanceModel::InverseClamped, 100.0f, 1.0f, 1.0f, 10.0f), 0.1f);
+}
+
+void VoicePoolTest::attenuationLinear() {
+    CORRADE_COMPARE(VoicePool::attenuation(Renderer::DistanceModel::Linear, 5.5f, 1.0f, 1.0f, 10.0f), 0.5f);
+    CORRADE_COMPARE(VoicePool::attenuation(Renderer::DistanceModel::Linear, 20.0f, 1.0f, 1.0f, 10.0f), 0.0f);
+    CORRADE_COMPARE(VoicePool::attenuation(Renderer::DistanceModel::LinearClamped, 0.0f, 1.0f, 1.0f, 10.0f), 1.0f);
+    CORRADE_COMPARE(VoicePool::attenuation(Renderer::DistanceModel::LinearClamped, 5.5f, 1.0f, 0.5f, 10.0f), 0.75f);
+}
+
+void VoicePoolTest::attenuationExponent() {
+    constexpr Float max = std::numeric_limits<Float>::max();
+    CORRADE_COMPARE(VoicePool::attenuation(Renderer::DistanceModel::Exponent, 4.0f, 1.0f, 2.0f, max), 1.0f/16.0f);
+    CORRADE_COMPARE(VoicePool::attenuation(Renderer::DistanceModel::ExponentClamped, 0.5f, 1.0f, 2.0f, max), 1.0f);
+    CORRADE_COMPARE(VoicePool::attenuation(Renderer::DistanceModel::ExponentClamped, 100.0f, 1.0f, 1.0f, 8.0f), 0.125f);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Audio::Test::VoicePoolTest)
@@ -0,0 +1,312 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "VoicePool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Audio/Buffer.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace Audio {
+
+Float VoicePool::attenuation(const Renderer::DistanceModel model, Float distance, const Float referenceDistance, const Float rolloffFactor, const Float maxDistance) {
+    switch(model) {
+        case Renderer::DistanceModel::None:
+            return 1.0f;
+
+        case Renderer::DistanceModel::InverseClamped:
+            distance = Math::clamp(distance, referenceDistance, maxDistance);
+            /* fallthrough */
+        case Renderer::DistanceModel::Inverse: {
+            const Float denominator = referenceDistance + rolloffFactor*(distance - referenceDistance);
+            return denominator > 0.0f ? referenceDistance/denominator : 1.0f;
+        }
+
+        case Renderer::DistanceModel::LinearClamped:
+            distance = Math::clamp(distance, referenceDistance, maxDistance);
+            /* fallthrough */
+        case Renderer::DistanceModel::Linear:
+            if(maxDistance <= referenceDistance) return 1.0f;
+            return Math::max(0.0f, 1.0f - rolloffFactor*(Math::min(distance, maxDistance) - referenceDistance)/(maxDistance - referenceDistance));
+
+        case Renderer::DistanceModel::ExponentClamped:
+            distance = Math::clamp(distance, referenceDistance, maxDistance);
+            /* fallthrough */
+        case Renderer::DistanceModel::Exponent:
+            if(distance <= 0.0f || referenceDistance <= 0.0f) return 1.0f;
+            return std::pow(distance/referenceDistance, -rolloffFactor);
+    }
+
+    CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+VoicePool::VoicePool(const UnsignedInt sourceCount): _sources{sourceCount} {
+    /* Handing out the sources from the back, so start with the first one */
+    _freeSources.reserve(sourceCount);
+    for(UnsignedInt i = sourceCount; i != 0; --i)
+        _freeSources.push_back(i - 1);
+}
+
+VoicePool::~VoicePool() = default;
+
+UnsignedInt VoicePool::addVoice(Buffer& buffer) {
+    Voice voice{};
+    voice.buffer = &buffer;
+    voice.gain = voice.priority = voice.pitch = 1.0f;
+    voice.referenceDistance = voice.rolloffFactor = 1.0f;
+    voice.maxDistance = std::numeric_limits<Float>::max();
+    voice.source = -1;
+    voice.used = true;
+
+    /* Duration for offset tracking of virtual voices */
+    ALint size, channels, bits, frequency;
+    alGetBufferi(buffer.id(), AL_SIZE, &size);
+    alGetBufferi(buffer.id(), AL_CHANNELS, &channels);
+    alGetBufferi(buffer.id(), AL_BITS, &bits);
+    alGetBufferi(buffer.id(), AL_FREQUENCY, &frequency);
+    if(channels > 0 && bits > 0 && frequency > 0)
+        voice.duration = Float(size)/(channels*bits/8)/frequency;
+
+    if(!_freeVoices.empty()) {
+        const UnsignedInt id = _freeVoices.back();
+        _freeVoices.pop_back();
+        _voices[id] = voice;
+        return id;
+    }
+
+    _voices.push_back(voice);
+    return _voices.size() - 1;
+}
+
+void VoicePool::removeVoice(const UnsignedInt id) {
+    CORRADE_ASSERT(id < _voices.size() && _voices[id].used,
+        "Audio::VoicePool::removeVoice(): invalid voice" << id, );
+
+    Voice& voice = _voices[id];
+    releaseSource(voice);
+    voice.used = false;
+    _freeVoices.push_back(id);
+}
+
+void VoicePool::acquireSource(Voice& voice) {
+    voice.source = _freeSources.back();
+    _freeSources.pop_back();
+
+    _sources[voice.source]
+        .setBuffer(voice.buffer)
+        .setPosition(voice.position)
+        .setGain(voice.gain)
+        .setPitch(voice.pitch)
+        .setLooping(voice.looping)
+        .setReferenceDistance(voice.referenceDistance)
+        .setRolloffFactor(voice.rolloffFactor)
+        .setMaxDistance(voice.maxDistance)
+        .setOffsetInSeconds(voice.offset);
+    _sources[voice.source].play();
+}
+
+void VoicePool::releaseSource(Voice& voice) {
+    if(voice.source == -1) return;
+
+    /* Detach the buffer so it can be deleted while the source is unused */
+    _sources[voice.source].stop();
+    _sources[voice.source].setBuffer(nullptr);
+    _freeSources.push_back(voice.source);
+    voice.source = -1;
+}
+
+VoicePool& VoicePool::play(const UnsignedInt id) {
+    CORRADE_ASSERT(id < _voices.size() && _voices[id].used,
+        "Audio::VoicePool::play(): invalid voice" << id, *this);
+
+    Voice& voice = _voices[id];
+    voice.offset = 0.0f;
+    voice.playing = true;
+    if(voice.source != -1) {
+        _sources[voice.source].setOffsetInSeconds(0.0f);
+        _sources[voice.source].play();
+    } else if(!_freeSources.empty()) acquireSource(voice);
+
+    return *this;
+}
+
+VoicePool& VoicePool::stop(const UnsignedInt id) {
+    CORRADE_ASSERT(id < _voices.size() && _voices[id].used,
+        "Audio::VoicePool::stop(): invalid voice" << id, *this);
+
+    Voice& voice = _voices[id];
+    releaseSource(voice);
+    voice.offset = 0.0f;
+    voice.playing = false;
+    return *this;
+}
+
+bool VoicePool::isPlaying(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _voices.size() && _voices[id].used,
+        "Audio::VoicePool::isPlaying(): invalid voice" << id, false);
+    return _voices[id].playing;
+}
+
+bool VoicePool::isVirtual(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _voices.size() && _voices[id].used,
+        "Audio::VoicePool::isVirtual(): invalid voice" << id, false);
+    return _voices[id].playing && _voices[id].source == -1;
+}
+
+Source* VoicePool::source(const UnsignedInt id) {
+    CORRADE_ASSERT(id < _voices.size() && _voices[id].used,
+        "Audio::VoicePool::source(): invalid voice" << id, nullptr);
+    return _voices[id].source == -1 ? nullptr : &_sources[_voices[id].source];
+}
+
+Float VoicePool::offsetInSeconds(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _voices.size() && _voices[id].used,
+        "Audio::VoicePool::offsetInSeconds(): invalid voice" << id, {});
+    const Voice& voice = _voices[id];
+    return voice.source == -1 ? voice.offset : _sources[voice.source].offsetInSeconds();
+}
+
+VoicePool& VoicePool::setPosition(const UnsignedInt id, const Vector3& position) {
+    CORRADE_ASSERT(id < _voices.size() && _voices[id].used,
+        "Audio::VoicePool::setPosition(): invalid voice" << id, *this);
+    Voice& voice = _voices[id];
+    voice.position = position;
+    if(voice.source != -1) _sources[voice.source].setPosition(position);
+    return *this;
+}
+
+VoicePool& VoicePool::setGain(const UnsignedInt id, const Float gain) {
+    CORRADE_ASSERT(id < _voices.size() && _voices[id].used,
+        "Audio::VoicePool::setGain(): invalid voice" << id, *this);
+    Voice& voice = _voices[id];
+    voice.gain = gain;
+    if(voice.source != -1) _sources[voice.source].setGain(gain);
+    return *this;
+}
+
+VoicePool& VoicePool::setPriority(const UnsignedInt id, const Float priority) {
+    CORRADE_ASSERT(id < _voices.size() && _voices[id].used,
+        "Audio::VoicePool::setPriority(): invalid voice" << id, *this);
+    _voices[id].priority = priority;
+    return *this;
+}
+
+VoicePool& VoicePool::setPitch(const UnsignedInt id, const Float pitch) {
+    CORRADE_ASSERT(id < _voices.size() && _voices[id].used,
+        "Audio::VoicePool::setPitch(): invalid voice" << id, *this);
+    Voice& voice = _voices[id];
+    voice.pitch = pitch;
+    if(voice.source != -1) _sources[voice.source].setPitch(pitch);
+    return *this;
+}
+
+VoicePool& VoicePool::setLooping(const UnsignedInt id, const bool loop) {
+    CORRADE_ASSERT(id < _voices.size() && _voices[id].used,
+        "Audio::VoicePool::setLooping(): invalid voice" << id, *this);
+    Voice& voice = _voices[id];
+    voice.looping = loop;
+    if(voice.source != -1) _sources[voice.source].setLooping(loop);
+    return *this;
+}
+
+VoicePool& VoicePool::setDistanceAttenuation(const UnsignedInt id, const Float referenceDistance, const Float rolloffFactor, const Float maxDistance) {
+    CORRADE_ASSERT(id < _voices.size() && _voices[id].used,
+        "Audio::VoicePool::setDistanceAttenuation(): invalid voice" << id, *this);
+    Voice& voice = _voices[id];
+    voice.referenceDistance = referenceDistance;
+    voice.rolloffFactor = rolloffFactor;
+    voice.maxDistance = maxDistance;
+    if(voice.source != -1) _sources[voice.source]
+        .setReferenceDistance(referenceDistance)
+        .setRolloffFactor(rolloffFactor)
+        .setMaxDistance(maxDistance);
+    return *this;
+}
+
+void VoicePool::update(const Vector3& listenerPosition, const Float timeDelta) {
+    const Renderer::DistanceModel model = Renderer::distanceModel();
+
+    /* Retire finished voices, advance the virtual ones and gather everything
+       that's still playing with its audibility */
+    std::vector<std::pair<Float, UnsignedInt>> candidates;
+    candidates.reserve(_voices.size());
+    for(std::size_t i = 0; i != _voices.size(); ++i) {
+        Voice& voice = _voices[i];
+        if(!voice.used || !voice.playing) continue;
+
+        if(voice.source != -1) {
+            if(_sources[voice.source].state() != Source::State::Playing) {
+                releaseSource(voice);
+                voice.offset = 0.0f;
+                voice.playing = false;
+                continue;
+            }
+
+        } else if(voice.duration > 0.0f) {
+            voice.offset += timeDelta*voice.pitch;
+            if(voice.offset >= voice.duration) {
+                if(voice.looping) voice.offset = std::fmod(voice.offset, voice.duration);
+                else {
+                    voice.offset = 0.0f;
+                    voice.playing = false;
+                    continue;
+                }
+            }
+        }
+
+        const Float distance = (voice.position - listenerPosition).length();
+        candidates.emplace_back(voice.gain*voice.priority*attenuation(model, distance, voice.referenceDistance, voice.rolloffFactor, voice.maxDistance), i);
+    }
+
+    /* Put the most audible ones first, the order among them doesn't matter */
+    const std::size_t realCount = std::min(_sources.size(), candidates.size());
+    if(realCount != candidates.size())
+        std::nth_element(candidates.begin(), candidates.begin() + realCount, candidates.end(),
+            [](const std::pair<Float, UnsignedInt>& a, const std::pair<Float, UnsignedInt>& b) {
+                return a.first > b.first;
+            });
+
+    /* Virtualize the inaudible ones first to free the sources for the
+       others */
+    for(std::size_t i = realCount; i != candidates.size(); ++i) {
+        Voice& voice = _voices[candidates[i].second];
+        if(voice.source == -1) continue;
+
+        voice.offset = _sources[voice.source].offsetInSeconds();
+        releaseSource(voice);
+    }
+
+    for(std::size_t i = 0; i != realCount; ++i) {
+        Voice& voice = _voices[candidates[i].second];
+        if(voice.source == -1) acquireSource(voice);
+    }
+}
+
+}}
@@ -0,0 +1,298 @@
+#ifndef Magnum_Audio_VoicePool_h
+#define Magnum_Audio_VoicePool_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Audio::VoicePool
+ */
+
+#include <vector>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Audio/Audio.h"
+#include "Magnum/Audio/Renderer.h"
+#include "Magnum/Audio/Source.h"
+#include "Magnum/Audio/visibility.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Audio {
+
+/**
+@brief Pool of sources shared by prioritized voices
+
+OpenAL implementations have a hard limit on source count (often somewhere
+between 32 and 256) and each @ref Source keeps its OpenAL source for its whole
+lifetime. The voice pool instead creates a fixed count of sources up front and
+lends them to logical *voices*, of which there can be any amount. Sources are
+never generated or deleted after construction, only rebound to different
+buffers.
+
+## Usage
+
+@code
+Audio::VoicePool pool{32};
+
+UnsignedInt explosion = pool.addVoice(explosionBuffer);
+pool.setPosition(explosion, {10.0f, 0.0f, -3.0f})
+    .setPriority(explosion, 4.0f)
+    .play(explosion);
+
+// ... every frame:
+pool.update(Renderer::listenerPosition(), frameDuration);
+@endcode
+
+@anchor Audio-VoicePool-virtualization
+## Priorities and virtualization
+
+On every @ref update() the playing voices are sorted by their
+*audibility* --- the voice gain multiplied by distance attenuation from the
+listener (calculated using @ref attenuation() with current
+@ref Renderer::distanceModel()) and by user-specified priority. The
+@ref sourceCount() most audible voices get a source, the others are
+*virtualized*: their source is stopped and returned to the pool, while
+playback offset of the voice is still advanced by the time passed to
+@ref update(). When a virtual voice becomes audible enough again, it gets a
+source that starts playing at the offset where the voice would be at that
+time, so it resumes seamlessly.
+
+Voice properties such as position or gain are stored in the pool and applied
+to the source when the voice gets one, setting them on a voice that has a
+source additionally updates the source directly.
+
+@see @ref PlayableGroup::setMaxVoiceCount()
+*/
+class MAGNUM_AUDIO_EXPORT VoicePool {
+    public:
+        /**
+         * @brief Distance attenuation
+         * @param model             Distance model
+         * @param distance          Distance from the listener
+         * @param referenceDistance Source reference distance
+         * @param rolloffFactor     Source rolloff factor
+         * @param maxDistance       Source max distance
+         *
+         * Calculates the gain factor OpenAL applies to a source in given
+         * distance, following formulas from the OpenAL specification.
+         * @see @ref Source::setReferenceDistance(),
+         *      @ref Source::setRolloffFactor(), @ref Source::setMaxDistance()
+         */
+        static Float attenuation(Renderer::DistanceModel model, Float distance, Float referenceDistance, Float rolloffFactor, Float maxDistance);
+
+        /**
+         * @brief Constructor
+         * @param sourceCount   Count of sources in the pool
+         *
+         * Creates @p sourceCount OpenAL sources, which are then reused for
+         * the whole pool lifetime. Pick a count that's safely below the
+         * limit of the OpenAL implementation, leaving space for other sources
+         * such as background music.
+         */
+        explicit VoicePool(UnsignedInt sourceCount);
+
+        /** @brief Copying is not allowed */
+        VoicePool(const VoicePool&) = delete;
+
+        /** @brief Moving is not allowed */
+        VoicePool(VoicePool&&) = delete;
+
+        /** @brief Copying is not allowed */
+        VoicePool& operator=(const VoicePool&) = delete;
+
+        /** @brief Moving is not allowed */
+        VoicePool& operator=(VoicePool&&) = delete;
+
+        ~VoicePool();
+
+        /** @brief Count of sources in the pool */
+        UnsignedInt sourceCount() const { return _sources.size(); }
+
+        /** @brief Count of voices currently having a source */
+        UnsignedInt realVoiceCount() const {
+            return _sources.size() - _freeSources.size();
+        }
+
+        /**
+         * @brief Add a voice
+         * @param buffer    Buffer to play
+         * @return Voice ID
+         *
+         * The buffer is expected to have its data already set and to stay
+         * alive until the voice is removed, its duration is queried for
+         * offset tracking of virtual voices. The voice is initially stopped,
+         * with gain, priority and pitch set to `1.0f`, position at origin,
+         * looping disabled and distance attenuation parameters matching
+         * @ref Source defaults. IDs of removed voices are reused.
+         * @see @ref removeVoice()
+         */
+        UnsignedInt addVoice(Buffer& buffer);
+
+        /**
+         * @brief Remove a voice
+         *
+         * Stops the voice and returns its source to the pool, if any.
+         */
+        void removeVoice(UnsignedInt id);
+
+        /**
+         * @brief Start playing a voice
+         * @return Reference to self (for method chaining)
+         *
+         * Plays the voice from the beginning. If there is a free source in
+         * the pool, the voice gets it immediately, otherwise it's virtual
+         * until the next @ref update() decides whether it's audible enough.
+         */
+        VoicePool& play(UnsignedInt id);
+
+        /**
+         * @brief Stop a voice
+         * @return Reference to self (for method chaining)
+         *
+         * Returns the source to the pool, if the voice had any.
+         */
+        VoicePool& stop(UnsignedInt id);
+
+        /**
+         * @brief Whether a voice is playing
+         *
+         * Virtual voices are playing too. Voices that reached the end and
+         * aren't looping get stopped in @ref update().
+         */
+        bool isPlaying(UnsignedInt id) const;
+
+        /** @brief Whether a voice is playing, but has no source */
+        bool isVirtual(UnsignedInt id) const;
+
+        /**
+         * @brief Source of a voice
+         *
+         * Returns `nullptr` if the voice doesn't currently have a source. The
+         * pointer is valid only until the next call to @ref update(),
+         * @ref stop() or @ref removeVoice().
+         */
+        Source* source(UnsignedInt id);
+
+        /**
+         * @brief Playback offset of a voice in seconds
+         *
+         * For voices with a source the offset is queried from the source,
+         * for other voices the tracked offset is returned.
+         */
+        Float offsetInSeconds(UnsignedInt id) const;
+
+        /**
+         * @brief Set voice position
+         * @return Reference to self (for method chaining)
+         *
+         * Default is @ref Vector3 "Vector3()".
+         * @see @ref Source::setPosition()
+         */
+        VoicePool& setPosition(UnsignedInt id, const Vector3& position);
+
+        /**
+         * @brief Set voice gain
+         * @return Reference to self (for method chaining)
+         *
+         * Default is `1.0f`. Affects also the audibility.
+         * @see @ref Source::setGain()
+         */
+        VoicePool& setGain(UnsignedInt id, Float gain);
+
+        /**
+         * @brief Set voice priority
+         * @return Reference to self (for method chaining)
+         *
+         * The audibility is multiplied by this value. Default is `1.0f`,
+         * values above make the voice less likely to be virtualized.
+         */
+        VoicePool& setPriority(UnsignedInt id, Float priority);
+
+        /**
+         * @brief Set voice pitch
+         * @return Reference to self (for method chaining)
+         *
+         * Default is `1.0f`. Affects also how fast is the offset of virtual
+         * voice advanced.
+         * @see @ref Source::setPitch()
+         */
+        VoicePool& setPitch(UnsignedInt id, Float pitch);
+
+        /**
+         * @brief Set voice looping
+         * @return Reference to self (for method chaining)
+         *
+         * Default is `false`.
+         * @see @ref Source::setLooping()
+         */
+        VoicePool& setLooping(UnsignedInt id, bool loop);
+
+        /**
+         * @brief Set voice distance attenuation parameters
+         * @return Reference to self (for method chaining)
+         *
+         * Defaults are `1.0f` for reference distance and rolloff factor and
+         * max representable value for max distance.
+         * @see @ref Source::setReferenceDistance(),
+         *      @ref Source::setRolloffFactor(), @ref Source::setMaxDistance()
+         */
+        VoicePool& setDistanceAttenuation(UnsignedInt id, Float referenceDistance, Float rolloffFactor, Float maxDistance);
+
+        /**
+         * @brief Update the voices
+         * @param listenerPosition  Listener position
+         * @param timeDelta         Time since last update in seconds
+         *
+         * Stops voices that finished playing, advances offset of virtual
+         * voices and redistributes the sources according to voice audibility.
+         * See @ref Audio-VoicePool-virtualization "class documentation"
+         * for more information.
+         */
+        void update(const Vector3& listenerPosition, Float timeDelta);
+
+    private:
+        struct Voice {
+            Buffer* buffer;
+            Float duration;
+            Vector3 position;
+            Float gain, priority, pitch;
+            Float referenceDistance, rolloffFactor, maxDistance;
+            Float offset;
+            Int source;
+            bool looping, playing, used;
+        };
+
+        MAGNUM_AUDIO_LOCAL void acquireSource(Voice& voice);
+        MAGNUM_AUDIO_LOCAL void releaseSource(Voice& voice);
+
+        Containers::Array<Source> _sources;
+        std::vector<UnsignedInt> _freeSources;
+        std::vector<Voice> _voices;
+        std::vector<UnsignedInt> _freeVoices;
+};
+
+}}
+
+#endif
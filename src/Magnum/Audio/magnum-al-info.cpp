@@ -27,6 +27,7 @@
 
 #include "Magnum/Magnum.h"
 #include "Magnum/Audio/Context.h"
+#include "Magnum/Audio/Extensions.h"
 
 namespace Magnum {
 
@@ -36,12 +37,25 @@ namespace Magnum {
 @section magnum-al-info-usage Usage
 
     magnum-al-info [-h|--help] [-s|--short] [--extension-strings]
+        [--frequency HZ] [--refresh-rate HZ] [--mono-sources COUNT]
+        [--stereo-sources COUNT]
 
 Arguments:
 -   `-h`,` --help` -- display this help message and exit
 -   `-s`, `--short` -- display just essential info and exit
 -   `--extension-strings` -- list all extension strings provided by the driver
     (implies `--short`)
+-   `--frequency HZ` -- request given output frequency (see
+    @ref Audio::Context::Configuration::setFrequency())
+-   `--refresh-rate HZ` -- request given refresh rate (see
+    @ref Audio::Context::Configuration::setRefreshRate())
+-   `--mono-sources COUNT` -- request given mono source count (see
+    @ref Audio::Context::Configuration::setMonoSourceCount())
+-   `--stereo-sources COUNT` -- request given stereo source count (see
+    @ref Audio::Context::Configuration::setStereoSourceCount())
+
+The device parameters reported are the ones the device actually uses, which
+may differ from the requested ones.
 
 @section magnum-al-info-example Example output
 
@@ -55,15 +69,22 @@ OpenAL version: 1.1 ALSOFT 1.17.2
 Available devices:
     OpenAL Soft
 Current device: OpenAL Soft
+Output frequency: 44100 Hz
+Refresh rate: 50 Hz
+Mono sources: 255
+Stereo sources: 1
+Device latency: 20.0 ms
 Vendor extension support:
     AL_EXT_FLOAT32                                                SUPPORTED
     AL_EXT_DOUBLE                                                 SUPPORTED
     AL_EXT_ALAW                                                   SUPPORTED
     AL_EXT_MULAW                                                  SUPPORTED
     AL_EXT_MCFORMATS                                              SUPPORTED
+    AL_SOFT_source_latency                                        SUPPORTED
     ALC_ENUMERATION_EXT                                           SUPPORTED
     ALC_SOFTX_HRTF                                                   -
     ALC_SOFT_HRTF                                                 SUPPORTED
+    ALC_SOFT_device_clock                                         SUPPORTED
 
 ```
 
@@ -77,6 +98,10 @@ int main(const int argc, const char** const argv) {
     Utility::Arguments args;
     args.addBooleanOption('s', "short").setHelp("short", "display just essential info and exit")
         .addBooleanOption("extension-strings").setHelp("extension-strings", "list all extension strings provided by the driver (implies --short)")
+        .addOption("frequency", "-1").setHelp("frequency", "request given output frequency", "HZ")
+        .addOption("refresh-rate", "-1").setHelp("refresh-rate", "request given refresh rate", "HZ")
+        .addOption("mono-sources", "-1").setHelp("mono-sources", "request given mono source count", "COUNT")
+        .addOption("stereo-sources", "-1").setHelp("stereo-sources", "request given stereo source count", "COUNT")
         .parse(argc, argv);
 
     Debug() << "";
@@ -85,11 +110,21 @@ int main(const int argc, const char** const argv) {
     Debug() << "  +---------------------------------------------------------+";
     Debug() << "";
 
-    Audio::Context c;
+    Audio::Context c{Audio::Context::Configuration{}
+        .setFrequency(args.value<Int>("frequency"))
+        .setRefreshRate(args.value<Int>("refresh-rate"))
+        .setMonoSourceCount(args.value<Int>("mono-sources"))
+        .setStereoSourceCount(args.value<Int>("stereo-sources"))};
     Debug() << "Available devices:";
     for(const auto& device: Audio::Context::deviceSpecifierStrings())
         Debug() << "   " << device;
     Debug() << "Current device:" << c.deviceSpecifierString();
+    Debug() << "Output frequency:" << c.frequency() << "Hz";
+    Debug() << "Refresh rate:" << c.refreshRate() << "Hz";
+    Debug() << "Mono sources:" << c.monoSourceCount();
+    Debug() << "Stereo sources:" << c.stereoSourceCount();
+    if(c.isExtensionSupported<Audio::Extensions::ALC::SOFT::device_clock>())
+        Debug() << "Device latency:" << c.deviceLatency()/1.0e6 << "ms";
 
     if(args.isSet("extension-strings")) {
         Debug() << "Extension strings:" << Debug::newline
@@ -25,20 +25,32 @@
 
 #include "Buffer.h"
 
+#include <cstring>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Utility/Debug.h>
 
+#include "Magnum/CommandObserver.h"
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
 
 #include "Implementation/State.h"
 #include "Implementation/BufferState.h"
+#include "Implementation/GpuMemoryState.h"
+#include "Implementation/MeshState.h"
 #ifndef MAGNUM_TARGET_WEBGL
 #include "Implementation/DebugState.h"
 #endif
 
 namespace Magnum {
 
+UnsignedLong Buffer::uploadCount() {
+    return Context::current().state().buffer->uploadCount;
+}
+
+UnsignedLong Buffer::uploadSize() {
+    return Context::current().state().buffer->uploadSize;
+}
+
 #ifndef MAGNUM_TARGET_GLES
 Int Buffer::minMapAlignment() {
     if(!Context::current().isExtensionSupported<Extensions::GL::ARB::map_buffer_alignment>())
@@ -215,6 +227,11 @@ Buffer::~Buffer() {
     for(std::size_t i = 1; i != Implementation::BufferState::TargetCount; ++i)
         if(bindings[i] == _id) bindings[i] = 0;
 
+    /* Forget cached vertex layouts referencing this buffer, as the ID can be
+       reused by another buffer */
+    Context::current().state().mesh->removeBuffer(_id);
+
+    Context::current().state().gpuMemory->remove(GpuMemory::Category::Buffer, _id);
     glDeleteBuffers(1, &_id);
 }
 
@@ -247,6 +264,7 @@ Buffer& Buffer::setLabelInternal(const Containers::ArrayView<const char> label)
     #else
     Context::current().state().debug->labelImplementation(GL_BUFFER_KHR, _id, label);
     #endif
+    Context::current().state().gpuMemory->setLabel(GpuMemory::Category::Buffer, _id, {label.data(), label.size()});
     return *this;
 }
 #endif
@@ -320,12 +338,40 @@ Int Buffer::size() {
 }
 
 Buffer& Buffer::setData(const Containers::ArrayView<const void> data, const BufferUsage usage) {
-    (this->*Context::current().state().buffer->dataImplementation)(data.size(), data, usage);
+    Implementation::BufferState& state = *Context::current().state().buffer;
+    if(data.data()) {
+        ++state.uploadCount;
+        state.uploadSize += data.size();
+        if(CommandObserver* const observer = Context::current().state().commandObserver)
+            observer->record(CommandObserver::Command::BufferUpload, _id, data.size(), false);
+    }
+    (this->*state.dataImplementation)(data.size(), data, usage);
+    Context::current().state().gpuMemory->setSize(GpuMemory::Category::Buffer, _id, data.size());
     return *this;
 }
 
+#ifndef MAGNUM_TARGET_GLES
+Buffer& Buffer::setStorage(const Containers::ArrayView<const void> data, const StorageFlags flags) {
+    Implementation::BufferState& state = *Context::current().state().buffer;
+    if(data.data()) {
+        ++state.uploadCount;
+        state.uploadSize += data.size();
+        if(CommandObserver* const observer = Context::current().state().commandObserver)
+            observer->record(CommandObserver::Command::BufferUpload, _id, data.size(), false);
+    }
+    (this->*state.storageImplementation)(data.size(), data, flags);
+    Context::current().state().gpuMemory->setSize(GpuMemory::Category::Buffer, _id, data.size());
+    return *this;
+}
+#endif
+
 Buffer& Buffer::setSubData(const GLintptr offset, const Containers::ArrayView<const void> data) {
-    (this->*Context::current().state().buffer->subDataImplementation)(offset, data.size(), data);
+    Implementation::BufferState& state = *Context::current().state().buffer;
+    ++state.uploadCount;
+    state.uploadSize += data.size();
+    if(CommandObserver* const observer = Context::current().state().commandObserver)
+        observer->record(CommandObserver::Command::BufferUpload, _id, data.size(), false);
+    (this->*state.subDataImplementation)(offset, data.size(), data);
     return *this;
 }
 
@@ -496,6 +542,21 @@ void Buffer::dataImplementationDSAEXT(GLsizeiptr size, const GLvoid* data, Buffe
 }
 #endif
 
+#ifndef MAGNUM_TARGET_GLES
+void Buffer::storageImplementationDefault(GLsizeiptr size, const GLvoid* data, StorageFlags flags) {
+    glBufferStorage(GLenum(bindSomewhereInternal(_targetHint)), size, data, GLbitfield(flags));
+}
+
+void Buffer::storageImplementationDSA(const GLsizeiptr size, const GLvoid* const data, const StorageFlags flags) {
+    glNamedBufferStorage(_id, size, data, GLbitfield(flags));
+}
+
+void Buffer::storageImplementationDSAEXT(GLsizeiptr size, const GLvoid* data, StorageFlags flags) {
+    _flags |= ObjectFlag::Created;
+    glNamedBufferStorageEXT(_id, size, data, GLbitfield(flags));
+}
+#endif
+
 void Buffer::subDataImplementationDefault(GLintptr offset, GLsizeiptr size, const GLvoid* data) {
     glBufferSubData(GLenum(bindSomewhereInternal(_targetHint)), offset, size, data);
 }
@@ -509,6 +570,16 @@ void Buffer::subDataImplementationDSAEXT(GLintptr offset, GLsizeiptr size, const
     _flags |= ObjectFlag::Created;
     glNamedBufferSubDataEXT(_id, offset, size, data);
 }
+
+void Buffer::subDataImplementationMapRange(const GLintptr offset, const GLsizeiptr size, const GLvoid* const data) {
+    /* Mapping an empty range is an error, while empty upload is not */
+    if(!size) return;
+
+    const Implementation::BufferState& state = *Context::current().state().buffer;
+    void* const mapped = (this->*state.mapRangeImplementation)(offset, size, MapFlag::Write|MapFlag::InvalidateRange);
+    if(mapped) std::memcpy(mapped, data, size);
+    (this->*state.unmapImplementation)();
+}
 #endif
 
 void Buffer::invalidateImplementationNoOp() {}
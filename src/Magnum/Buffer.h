@@ -590,9 +590,30 @@ class MAGNUM_EXPORT Buffer: public AbstractObject {
              * before mapping.
              */
             #ifndef MAGNUM_TARGET_GLES2
-            Unsynchronized = GL_MAP_UNSYNCHRONIZED_BIT
+            Unsynchronized = GL_MAP_UNSYNCHRONIZED_BIT,
             #else
-            Unsynchronized = GL_MAP_UNSYNCHRONIZED_BIT_EXT
+            Unsynchronized = GL_MAP_UNSYNCHRONIZED_BIT_EXT,
+            #endif
+
+            #ifndef MAGNUM_TARGET_GLES
+            /**
+             * The mapping may stay in place while the buffer is used by the
+             * GL. The buffer storage must be allocated with
+             * @ref setStorage() using @ref StorageFlag::MapPersistent.
+             * @requires_gl44 Extension @extension{ARB,buffer_storage}
+             * @requires_gl Persistent mapping is not available in OpenGL ES.
+             */
+            Persistent = GL_MAP_PERSISTENT_BIT,
+
+            /**
+             * Writes to persistently mapped buffer are visible to the GL
+             * without explicit flush or memory barrier. The buffer storage
+             * must be allocated with @ref setStorage() using
+             * @ref StorageFlag::MapCoherent.
+             * @requires_gl44 Extension @extension{ARB,buffer_storage}
+             * @requires_gl Coherent mapping is not available in OpenGL ES.
+             */
+            Coherent = GL_MAP_COHERENT_BIT
             #endif
         };
 
@@ -608,6 +629,68 @@ class MAGNUM_EXPORT Buffer: public AbstractObject {
         typedef Containers::EnumSet<MapFlag> MapFlags;
         #endif
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Buffer storage flag
+         *
+         * @see @ref StorageFlags, @ref setStorage()
+         * @requires_gl44 Extension @extension{ARB,buffer_storage}
+         * @requires_gl Immutable buffer storage is not available in OpenGL
+         *      ES and WebGL.
+         */
+        enum class StorageFlag: GLbitfield {
+            /** Allow mapping the buffer for reading. */
+            MapRead = GL_MAP_READ_BIT,
+
+            /** Allow mapping the buffer for writing. */
+            MapWrite = GL_MAP_WRITE_BIT,
+
+            /** Allow the buffer to stay mapped while it is used by the GL. */
+            MapPersistent = GL_MAP_PERSISTENT_BIT,
+
+            /**
+             * Allow coherent persistent mapping. Requires also
+             * @ref StorageFlag::MapPersistent.
+             */
+            MapCoherent = GL_MAP_COHERENT_BIT,
+
+            /** Allow updating the buffer contents with @ref setSubData(). */
+            DynamicStorage = GL_DYNAMIC_STORAGE_BIT,
+
+            /** Prefer storage local to the client. */
+            ClientStorage = GL_CLIENT_STORAGE_BIT
+        };
+
+        /**
+         * @brief Buffer storage flags
+         *
+         * @see @ref setStorage()
+         * @requires_gl44 Extension @extension{ARB,buffer_storage}
+         * @requires_gl Immutable buffer storage is not available in OpenGL
+         *      ES and WebGL.
+         */
+        typedef Containers::EnumSet<StorageFlag> StorageFlags;
+        #endif
+
+        /**
+         * @brief Count of data uploads
+         *
+         * Count of @ref setData(), @ref setSubData() and @ref setStorage()
+         * calls uploading data since the context creation. Calls that only
+         * allocate storage without specifying any data are not counted.
+         * @see @ref uploadSize(), @ref DebugTools::FrameStatistics
+         */
+        static UnsignedLong uploadCount();
+
+        /**
+         * @brief Total size of data uploads
+         *
+         * Size in bytes of all data uploaded with calls counted in
+         * @ref uploadCount().
+         * @see @ref DebugTools::FrameStatistics
+         */
+        static UnsignedLong uploadSize();
+
         #ifndef MAGNUM_TARGET_GLES
         /**
          * @brief Minimal supported mapping alignment
@@ -1121,6 +1204,33 @@ class MAGNUM_EXPORT Buffer: public AbstractObject {
             return *this;
         }
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Set immutable buffer storage
+         * @param data      Initial data. Pass `{nullptr, size}` to allocate
+         *      the storage without initializing it.
+         * @param flags     Storage flags
+         * @return Reference to self (for method chaining)
+         *
+         * After calling this function the buffer size can't be changed
+         * anymore and @ref setData() can't be called on it. If
+         * @ref StorageFlag::DynamicStorage isn't present in @p flags, the
+         * contents can be updated only through mapping or by copying from
+         * another buffer. If neither @extension{ARB,direct_state_access}
+         * (part of OpenGL 4.5) nor @extension{EXT,direct_state_access}
+         * desktop extension is available, the buffer is bound to hinted
+         * target before the operation (if not already).
+         * @see @ref map(GLintptr, GLsizeiptr, MapFlags), @ref BufferRing,
+         *      @ref setTargetHint(), @fn_gl2{NamedBufferStorage,BufferStorage},
+         *      @fn_gl_extension{NamedBufferStorage,EXT,direct_state_access},
+         *      eventually @fn_gl{BindBuffer} and @fn_gl{BufferStorage}
+         * @requires_gl44 Extension @extension{ARB,buffer_storage}
+         * @requires_gl Immutable buffer storage is not available in OpenGL
+         *      ES and WebGL, use @ref setData() instead.
+         */
+        Buffer& setStorage(Containers::ArrayView<const void> data, StorageFlags flags);
+        #endif
+
         /**
          * @brief Set buffer subdata
          * @param offset    Offset in the buffer
@@ -1383,10 +1493,17 @@ class MAGNUM_EXPORT Buffer: public AbstractObject {
         void MAGNUM_LOCAL dataImplementationDSAEXT(GLsizeiptr size, const GLvoid* data, BufferUsage usage);
         #endif
 
+        #ifndef MAGNUM_TARGET_GLES
+        void MAGNUM_LOCAL storageImplementationDefault(GLsizeiptr size, const GLvoid* data, StorageFlags flags);
+        void MAGNUM_LOCAL storageImplementationDSA(GLsizeiptr size, const GLvoid* data, StorageFlags flags);
+        void MAGNUM_LOCAL storageImplementationDSAEXT(GLsizeiptr size, const GLvoid* data, StorageFlags flags);
+        #endif
+
         void MAGNUM_LOCAL subDataImplementationDefault(GLintptr offset, GLsizeiptr size, const GLvoid* data);
         #ifndef MAGNUM_TARGET_GLES
         void MAGNUM_LOCAL subDataImplementationDSA(GLintptr offset, GLsizeiptr size, const GLvoid* data);
         void MAGNUM_LOCAL subDataImplementationDSAEXT(GLintptr offset, GLsizeiptr size, const GLvoid* data);
+        void MAGNUM_LOCAL subDataImplementationMapRange(GLintptr offset, GLsizeiptr size, const GLvoid* data);
         #endif
 
         void MAGNUM_LOCAL invalidateImplementationNoOp();
@@ -1437,6 +1554,10 @@ class MAGNUM_EXPORT Buffer: public AbstractObject {
 CORRADE_ENUMSET_OPERATORS(Buffer::MapFlags)
 #endif
 
+#ifndef MAGNUM_TARGET_GLES
+CORRADE_ENUMSET_OPERATORS(Buffer::StorageFlags)
+#endif
+
 /** @debugoperatorclassenum{Magnum::Buffer,Magnum::Buffer::TargetHint} */
 MAGNUM_EXPORT Debug& operator<<(Debug& debug, Buffer::TargetHint value);
 
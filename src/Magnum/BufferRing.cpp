@@ -0,0 +1,132 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BufferRing.h"
+
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+
+namespace Magnum {
+
+BufferRing::BufferRing(const GLsizeiptr sectionSize, const UnsignedInt sectionCount, const Buffer::TargetHint targetHint): _buffer{targetHint}, _sectionSize{sectionSize}, _sectionCount{sectionCount}, _section{sectionCount - 1}, _waitCount{}, _persistent{}, _pending{}, _fenceNeeded{}, _data{}, _used{}, _allocationOffset{} {
+    CORRADE_ASSERT(sectionSize && sectionCount, "BufferRing: expected non-zero section size and count", );
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(Context::current().isExtensionSupported<Extensions::GL::ARB::buffer_storage>() && Context::current().isExtensionSupported<Extensions::GL::ARB::sync>()) {
+        _persistent = true;
+        _fences.resize(sectionCount);
+        _buffer.setStorage({nullptr, std::size_t(sectionSize*sectionCount)}, Buffer::StorageFlag::MapWrite|Buffer::StorageFlag::MapPersistent|Buffer::StorageFlag::MapCoherent);
+        _data = _buffer.map<char>(0, sectionSize*sectionCount, Buffer::MapFlag::Write|Buffer::MapFlag::Persistent|Buffer::MapFlag::Coherent);
+    } else
+    #endif
+    {
+        _buffer.setData({nullptr, std::size_t(sectionSize*sectionCount)}, BufferUsage::StreamDraw);
+    }
+}
+
+BufferRing::~BufferRing() {
+    #ifndef MAGNUM_TARGET_GLES
+    for(GLsync fence: _fences) if(fence) glDeleteSync(fence);
+    #endif
+
+    /* Deleting the buffer unmaps it, nothing else to do */
+}
+
+BufferRing& BufferRing::beginSection() {
+    CORRADE_ASSERT(!_pending, "BufferRing::beginSection(): previous section not ended", *this);
+
+    #ifndef MAGNUM_TARGET_GLES
+    /* Fence the commands that used the previous section */
+    if(_persistent && _fenceNeeded)
+        _fences[_section] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    #endif
+
+    _section = (_section + 1) % _sectionCount;
+    _pending = true;
+    _fenceNeeded = false;
+    _used = 0;
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(_persistent) {
+        GLsync& fence = _fences[_section];
+        if(fence) {
+            /* Check without flushing first to find out if we need to wait at
+               all, then wait with flush so the fence gets signaled
+               eventually */
+            GLenum result = glClientWaitSync(fence, 0, 0);
+            if(result == GL_TIMEOUT_EXPIRED) {
+                ++_waitCount;
+                do result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+                while(result == GL_TIMEOUT_EXPIRED);
+            }
+
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+
+        return *this;
+    }
+    #endif
+
+    /* Orphan the whole buffer when wrapping around, the following sections
+       then get mapped from the fresh storage without any synchronization */
+    _data = _buffer.map<char>(_section*_sectionSize, _sectionSize, Buffer::MapFlag::Write|Buffer::MapFlag::Unsynchronized|(_section ? Buffer::MapFlag::InvalidateRange : Buffer::MapFlag::InvalidateBuffer));
+    return *this;
+}
+
+Containers::ArrayView<char> BufferRing::allocate(const GLsizeiptr size, const GLsizeiptr alignment) {
+    CORRADE_ASSERT(_pending, "BufferRing::allocate(): no section begun", nullptr);
+
+    /* The alignment is relative to the buffer start, not the section */
+    const GLintptr sectionOffset = _section*_sectionSize;
+    const GLintptr offset = (sectionOffset + _used + alignment - 1)/alignment*alignment;
+    CORRADE_ASSERT(offset + size <= sectionOffset + _sectionSize,
+        "BufferRing::allocate(): can't allocate" << size << "bytes, only" << sectionOffset + _sectionSize - offset << "bytes left in the section", nullptr);
+
+    _used = offset + size - sectionOffset;
+    _allocationOffset = offset;
+
+    /* Persistent mapping covers the whole buffer, otherwise only the
+       section is mapped */
+    return {_data + (_persistent ? offset : offset - sectionOffset), std::size_t(size)};
+}
+
+BufferRing& BufferRing::endSection() {
+    CORRADE_ASSERT(_pending, "BufferRing::endSection(): no section begun", *this);
+
+    if(!_persistent) {
+        _buffer.unmap();
+        _data = nullptr;
+    }
+
+    _pending = false;
+    _fenceNeeded = true;
+    return *this;
+}
+
+}
@@ -0,0 +1,221 @@
+#ifndef Magnum_BufferRing_h
+#define Magnum_BufferRing_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_WEBGL
+/** @file
+ * @brief Class @ref Magnum::BufferRing
+ */
+#endif
+
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Buffer.h"
+
+#ifndef MAGNUM_TARGET_WEBGL
+namespace Magnum {
+
+/**
+@brief Ring allocator for streamed buffer data
+
+Suballocates data that change every frame, such as particle or UI vertices or
+uniform blocks, from one @ref Buffer divided into fixed-size sections. Each
+frame uses one section and the GL can still read the previous sections while
+the application writes into the current one, so no driver synchronization is
+needed.
+
+## Usage
+
+Call @ref beginSection() at the start of the frame, get memory for the data
+with @ref allocate() and @ref allocationOffset(), finish writing with
+@ref endSection() and then issue the draws that use the data:
+@code
+BufferRing ring{256*1024};
+Mesh mesh;
+
+// each frame
+ring.beginSection();
+Containers::ArrayView<char> data = ring.allocate(vertices.size()*sizeof(Vertex), sizeof(Vertex));
+std::copy(...);
+const GLintptr offset = ring.allocationOffset();
+ring.endSection();
+
+mesh.addVertexBuffer(ring.buffer(), offset, Shaders::Flat2D::Position{})
+    .setCount(vertices.size());
+shader.draw(mesh);
+@endcode
+
+## Performance optimizations
+
+If @extension{ARB,buffer_storage} (part of OpenGL 4.4) and @extension{ARB,sync}
+(part of OpenGL 3.2) are available, the buffer storage is allocated with
+@ref Buffer::setStorage() and mapped only once with @ref Buffer::MapFlag::Persistent
+and @ref Buffer::MapFlag::Coherent. A fence is placed after commands using a
+section and @ref beginSection() waits on it only when the application wraps
+around to a section that the GL didn't finish reading yet. Count of such waits
+is available through @ref waitCount(), if it's not zero, the ring needs more or
+larger sections.
+
+Otherwise each section is mapped with @ref Buffer::MapFlag::Unsynchronized
+and the whole buffer is orphaned with @ref Buffer::MapFlag::InvalidateBuffer
+every time the ring wraps around to the first section, so the driver can
+allocate a new storage instead of waiting for the GPU.
+
+@requires_gl30 Extension @extension{ARB,map_buffer_range}
+@requires_gles30 Extension @es_extension{EXT,map_buffer_range} in OpenGL ES
+    2.0.
+@requires_gles Buffer mapping is not available in WebGL.
+*/
+class MAGNUM_EXPORT BufferRing {
+    public:
+        /**
+         * @brief Constructor
+         * @param sectionSize   Size of one section in bytes
+         * @param sectionCount  Section count. Should be at least the count of
+         *      frames the GL is allowed to lag behind the application.
+         * @param targetHint    Target hint for the underlying buffer
+         *
+         * Allocates the buffer storage and, if persistent mapping is
+         * supported, maps it.
+         * @see @ref Buffer::setStorage(), @ref Buffer::setData()
+         */
+        explicit BufferRing(GLsizeiptr sectionSize, UnsignedInt sectionCount = 3, Buffer::TargetHint targetHint = Buffer::TargetHint::Array);
+
+        /** @brief Copying is not allowed */
+        BufferRing(const BufferRing&) = delete;
+
+        /** @brief Moving is not allowed */
+        BufferRing(BufferRing&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Deletes all pending fences.
+         * @see @fn_gl{DeleteSync}
+         */
+        ~BufferRing();
+
+        /** @brief Copying is not allowed */
+        BufferRing& operator=(const BufferRing&) = delete;
+
+        /** @brief Moving is not allowed */
+        BufferRing& operator=(BufferRing&&) = delete;
+
+        /** @brief Underlying buffer */
+        Buffer& buffer() { return _buffer; }
+
+        /** @brief Size of one section in bytes */
+        GLsizeiptr sectionSize() const { return _sectionSize; }
+
+        /** @brief Section count */
+        UnsignedInt sectionCount() const { return _sectionCount; }
+
+        /**
+         * @brief Whether the buffer is persistently mapped
+         *
+         * @see @ref Buffer::MapFlag::Persistent
+         */
+        bool isPersistent() const { return _persistent; }
+
+        /**
+         * @brief Begin next section
+         * @return Reference to self (for method chaining)
+         *
+         * Places a fence after commands issued since previous
+         * @ref endSection() and advances to next section. If the GL isn't
+         * done with the section yet, waits until it is. If the buffer isn't
+         * persistently mapped, maps the section. Expects that there is no
+         * section pending.
+         * @see @ref waitCount(), @fn_gl{FenceSync}, @fn_gl{ClientWaitSync},
+         *      @fn_gl{DeleteSync}, @ref Buffer::map(GLintptr, GLsizeiptr, Buffer::MapFlags)
+         */
+        BufferRing& beginSection();
+
+        /**
+         * @brief Allocate data in current section
+         * @param size      Size in bytes
+         * @param alignment Alignment of the offset in the buffer
+         *
+         * Returns memory for writing the data, valid until @ref endSection().
+         * Use @ref allocationOffset() to get the location of the data in
+         * @ref buffer(). Use @ref Buffer::uniformOffsetAlignment() as
+         * @p alignment for uniform data. Expects that a section is pending
+         * and that there is enough space left in it.
+         */
+        Containers::ArrayView<char> allocate(GLsizeiptr size, GLsizeiptr alignment = 1);
+
+        /**
+         * @brief Offset of the last allocation in the buffer
+         *
+         * @see @ref allocate()
+         */
+        GLintptr allocationOffset() const { return _allocationOffset; }
+
+        /**
+         * @brief End current section
+         * @return Reference to self (for method chaining)
+         *
+         * Makes the data written to the section available to the GL. If the
+         * buffer isn't persistently mapped, unmaps it. Draws using the data
+         * should be issued after calling this function. Expects that a
+         * section is pending.
+         * @see @ref Buffer::unmap()
+         */
+        BufferRing& endSection();
+
+        /**
+         * @brief Count of waits for the GL
+         *
+         * Count of times @ref beginSection() had to block because the GL
+         * didn't finish using the section yet. Always `0` if the buffer
+         * isn't persistently mapped.
+         */
+        UnsignedInt waitCount() const { return _waitCount; }
+
+    private:
+        Buffer _buffer;
+        GLsizeiptr _sectionSize;
+        UnsignedInt _sectionCount,
+            _section,
+            _waitCount;
+        bool _persistent,
+            _pending,
+            _fenceNeeded;
+        char* _data;
+        GLsizeiptr _used;
+        GLintptr _allocationOffset;
+        #ifndef MAGNUM_TARGET_GLES
+        std::vector<GLsync> _fences;
+        #endif
+};
+
+}
+#else
+#error this header is not available in WebGL build
+#endif
+
+#endif
@@ -0,0 +1,132 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BufferUploadQueue.h"
+
+#include <algorithm>
+#include <cstring>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Buffer.h"
+
+namespace Magnum {
+
+BufferUploadQueue::BufferUploadQueue(): _uploadCount{} {}
+
+BufferUploadQueue::~BufferUploadQueue() {
+    CORRADE_ASSERT(_updates.empty()
+        #ifndef MAGNUM_TARGET_GLES2
+        && _copies.empty()
+        #endif
+        , "BufferUploadQueue: destroying a queue with pending operations", );
+}
+
+BufferUploadQueue& BufferUploadQueue::setSubData(Buffer& buffer, const GLintptr offset, const Containers::ArrayView<const void> data) {
+    if(!data.size()) return *this;
+
+    const std::size_t stagingOffset = _staging.size();
+    _staging.resize(stagingOffset + data.size());
+    std::memcpy(_staging.data() + stagingOffset, data.data(), data.size());
+    _updates.push_back({&buffer, offset, stagingOffset, data.size(), _updates.size()});
+    return *this;
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+BufferUploadQueue& BufferUploadQueue::copy(Buffer& read, Buffer& write, const GLintptr readOffset, const GLintptr writeOffset, const GLsizeiptr size) {
+    _copies.push_back({&read, &write, readOffset, writeOffset, size, _updates.size()});
+    return *this;
+}
+#endif
+
+BufferUploadQueue& BufferUploadQueue::flush() {
+    _uploadCount = 0;
+
+    /* Updates queued before each copy have to land before it */
+    std::size_t begin = 0;
+    #ifndef MAGNUM_TARGET_GLES2
+    for(const Copy& copy: _copies) {
+        flushUpdates(begin, copy.updateCount);
+        Buffer::copy(*copy.read, *copy.write, copy.readOffset, copy.writeOffset, copy.size);
+        begin = copy.updateCount;
+    }
+    _copies.clear();
+    #endif
+    flushUpdates(begin, _updates.size());
+
+    _updates.clear();
+    _staging.clear();
+    return *this;
+}
+
+void BufferUploadQueue::flushUpdates(const std::size_t begin, const std::size_t end) {
+    if(begin == end) return;
+
+    /* Group the updates by buffer and sort them by offset, keeping the queue
+       order for updates at the same offset */
+    const auto first = _updates.begin() + begin, last = _updates.begin() + end;
+    std::stable_sort(first, last, [](const Update& a, const Update& b) {
+        if(a.buffer != b.buffer) return std::less<Buffer*>{}(a.buffer, b.buffer);
+        return a.offset < b.offset;
+    });
+
+    for(auto it = first; it != last; ) {
+        /* Find all updates that touch or overlap the current range */
+        auto groupEnd = it + 1;
+        GLintptr rangeEnd = it->offset + it->size;
+        bool contiguous = true;
+        for(; groupEnd != last && groupEnd->buffer == it->buffer && groupEnd->offset <= rangeEnd; ++groupEnd) {
+            const Update& previous = *(groupEnd - 1);
+            if(groupEnd->offset != GLintptr(previous.offset + previous.size) ||
+               groupEnd->stagingOffset != previous.stagingOffset + previous.size)
+                contiguous = false;
+            rangeEnd = std::max(rangeEnd, GLintptr(groupEnd->offset + groupEnd->size));
+        }
+
+        const GLintptr rangeBegin = it->offset;
+        const std::size_t size = rangeEnd - rangeBegin;
+
+        /* The updates are already laid out in the staging memory in the same
+           way as in the buffer, upload directly */
+        if(contiguous) {
+            it->buffer->setSubData(rangeBegin, {_staging.data() + it->stagingOffset, size});
+
+        /* Otherwise compose them in the scratch memory in the order they were
+           queued so later updates overwrite earlier ones */
+        } else {
+            std::sort(it, groupEnd, [](const Update& a, const Update& b) {
+                return a.index < b.index;
+            });
+            _scratch.resize(size);
+            for(auto u = it; u != groupEnd; ++u)
+                std::memcpy(_scratch.data() + (u->offset - rangeBegin), _staging.data() + u->stagingOffset, u->size);
+            it->buffer->setSubData(rangeBegin, {_scratch.data(), size});
+        }
+
+        ++_uploadCount;
+        it = groupEnd;
+    }
+}
+
+}
@@ -0,0 +1,180 @@
+#ifndef Magnum_BufferUploadQueue_h
+#define Magnum_BufferUploadQueue_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::BufferUploadQueue
+ */
+
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/OpenGL.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum {
+
+/**
+@brief Coalescing queue for buffer sub-data uploads
+
+Collects many small @ref Buffer::setSubData() calls issued during a frame in
+one contiguous memory area and uploads them with as few GL calls as possible
+in @ref flush(). Destination ranges that touch or overlap in the same buffer
+are merged into a single upload, later updates overwriting earlier ones.
+
+Useful mainly in WebGL builds, where @ref Buffer::map() is not available and
+every @ref Buffer::setSubData() call crosses the boundary between compiled
+code and JavaScript and copies the data out of the heap. On other platforms
+it reduces the driver call overhead in the same way.
+
+## Usage
+
+@code
+BufferUploadQueue queue;
+
+// during the frame
+queue.setSubData(vertexBuffer, 16*sizeof(Vertex), changedVertices)
+    .setSubData(vertexBuffer, 17*sizeof(Vertex), moreChangedVertices)
+    .setSubData(indexBuffer, 0, indices);
+
+// before drawing
+queue.flush();
+@endcode
+
+Use @ref copy() to queue a copy between buffers. The copy is executed after
+all updates queued before it and before all updates queued after it, so the
+operations are always applied in the order they were queued.
+
+@see @ref BufferRing
+*/
+class MAGNUM_EXPORT BufferUploadQueue {
+    public:
+        /** @brief Constructor */
+        explicit BufferUploadQueue();
+
+        /** @brief Copying is not allowed */
+        BufferUploadQueue(const BufferUploadQueue&) = delete;
+
+        /** @brief Moving is not allowed */
+        BufferUploadQueue(BufferUploadQueue&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Expects that there are no pending operations.
+         */
+        ~BufferUploadQueue();
+
+        /** @brief Copying is not allowed */
+        BufferUploadQueue& operator=(const BufferUploadQueue&) = delete;
+
+        /** @brief Moving is not allowed */
+        BufferUploadQueue& operator=(BufferUploadQueue&&) = delete;
+
+        /**
+         * @brief Queue a buffer sub-data update
+         * @return Reference to self (for method chaining)
+         *
+         * Copies @p data into the staging memory, the data don't need to
+         * stay alive until @ref flush(). The buffer must stay alive until
+         * @ref flush().
+         * @see @ref Buffer::setSubData()
+         */
+        BufferUploadQueue& setSubData(Buffer& buffer, GLintptr offset, Containers::ArrayView<const void> data);
+
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Queue a copy between buffers
+         * @return Reference to self (for method chaining)
+         *
+         * Both buffers must stay alive until @ref flush().
+         * @see @ref Buffer::copy()
+         * @requires_gl31 Extension @extension{ARB,copy_buffer}
+         * @requires_gles30 Buffer copying is not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Buffer copying is not available in WebGL 1.0.
+         */
+        BufferUploadQueue& copy(Buffer& read, Buffer& write, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size);
+        #endif
+
+        /** @brief Count of queued sub-data updates */
+        std::size_t pendingUpdateCount() const { return _updates.size(); }
+
+        /** @brief Size of queued sub-data in bytes */
+        std::size_t pendingSize() const { return _staging.size(); }
+
+        /**
+         * @brief Execute all queued operations
+         * @return Reference to self (for method chaining)
+         *
+         * Updates of the same buffer are sorted by offset and ranges that
+         * touch or overlap are uploaded with a single
+         * @ref Buffer::setSubData() call. If the merged updates are already
+         * laid out contiguously in the staging memory, they are uploaded
+         * directly from it, otherwise they are first composed in a scratch
+         * area. The staging memory is kept allocated for the next frame.
+         * @see @ref uploadCount()
+         */
+        BufferUploadQueue& flush();
+
+        /**
+         * @brief Upload count in last flush
+         *
+         * Count of @ref Buffer::setSubData() calls done in the last
+         * @ref flush(), not including copies.
+         */
+        UnsignedInt uploadCount() const { return _uploadCount; }
+
+    private:
+        struct Update {
+            Buffer* buffer;
+            GLintptr offset;
+            std::size_t stagingOffset, size, index;
+        };
+
+        #ifndef MAGNUM_TARGET_GLES2
+        struct Copy {
+            Buffer *read, *write;
+            GLintptr readOffset, writeOffset;
+            GLsizeiptr size;
+            std::size_t updateCount;
+        };
+        #endif
+
+        void MAGNUM_LOCAL flushUpdates(std::size_t begin, std::size_t end);
+
+        std::vector<char> _staging, _scratch;
+        std::vector<Update> _updates;
+        #ifndef MAGNUM_TARGET_GLES2
+        std::vector<Copy> _copies;
+        #endif
+        UnsignedInt _uploadCount;
+};
+
+}
+
+#endif
@@ -0,0 +1,63 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "CommandObserver.h"
+
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Context.h"
+#include "Magnum/Implementation/State.h"
+#include "Magnum/Implementation/RendererState.h"
+
+namespace Magnum {
+
+CommandObserver* CommandObserver::current() {
+    return Context::current().state().commandObserver;
+}
+
+void CommandObserver::setCurrent(CommandObserver* const observer) {
+    Implementation::State& state = Context::current().state();
+    state.commandObserver = state.renderer->shadow.commandObserver = observer;
+}
+
+CommandObserver::~CommandObserver() {
+    if(Context::hasCurrent() && current() == this) setCurrent(nullptr);
+}
+
+Debug& operator<<(Debug& debug, const CommandObserver::Command value) {
+    switch(value) {
+        #define _c(value) case CommandObserver::Command::value: return debug << "CommandObserver::Command::" #value;
+        _c(Draw)
+        _c(BufferUpload)
+        _c(TextureBind)
+        _c(ProgramUse)
+        _c(RendererState)
+        #undef _c
+    }
+
+    return debug << "CommandObserver::Command(" << Debug::nospace << reinterpret_cast<void*>(UnsignedByte(value)) << Debug::nospace << ")";
+}
+
+}
@@ -0,0 +1,132 @@
+#ifndef Magnum_CommandObserver_h
+#define Magnum_CommandObserver_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::CommandObserver
+ */
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum {
+
+/**
+@brief OpenGL command observer
+
+Gets notified about commands passing through the engine's state tracker ---
+draw calls, buffer uploads, texture binds, shader program switches and
+renderer state changes --- at the same points where the counters used by
+@ref Mesh::drawCallCount(), @ref Buffer::uploadCount(),
+@ref AbstractTexture::bindCount(), @ref AbstractShaderProgram::useCount() and
+@ref Renderer::stateChangeCount() are updated. Unlike the counters, the
+observer also sees calls the state tracker filtered out as redundant. Only
+one observer can be active in a context at a time, if none is set, the
+overhead is a single pointer check per command.
+
+Subclasses implement @ref doRecord(), see @ref DebugTools::CommandCapture for
+an implementation recording the commands to a trace.
+*/
+class MAGNUM_EXPORT CommandObserver {
+    public:
+        /**
+         * @brief Command
+         *
+         * @see @ref record()
+         */
+        enum class Command: UnsignedByte {
+            /**
+             * Draw call. The object is mesh ID, size is vertex or index count
+             * multiplied by instance count. Indirect draws report draw count.
+             */
+            Draw = 1,
+
+            /** Buffer data upload. The object is buffer ID, size is byte count. */
+            BufferUpload,
+
+            /** Texture bind. The object is texture ID, size is texture unit. */
+            TextureBind,
+
+            /** Shader program switch. The object is program ID. */
+            ProgramUse,
+
+            /**
+             * Renderer state change. The object is the feature or hint enum
+             * for @ref Renderer::enable(), @ref Renderer::disable() and
+             * @ref Renderer::setHint(), @cpp 0 @ce otherwise.
+             */
+            RendererState
+        };
+
+        /**
+         * @brief Current observer
+         *
+         * Returns `nullptr` if no observer is set.
+         */
+        static CommandObserver* current();
+
+        /**
+         * @brief Set current observer
+         *
+         * Replaces previously set observer. Pass `nullptr` to disable
+         * observation.
+         */
+        static void setCurrent(CommandObserver* observer);
+
+        explicit CommandObserver() = default;
+
+        /**
+         * @brief Destructor
+         *
+         * If the observer is current, it's unset.
+         */
+        virtual ~CommandObserver();
+
+        /**
+         * @brief Record a command
+         * @param command   Command
+         * @param object    Object ID
+         * @param size      Command size, see @ref Command for details
+         * @param redundant Whether the command was filtered out by the state
+         *      tracker and didn't reach OpenGL
+         *
+         * Called by the engine, calls @ref doRecord().
+         */
+        void record(Command command, UnsignedInt object, UnsignedLong size, bool redundant) {
+            doRecord(command, object, size, redundant);
+        }
+
+    private:
+        /** @brief Implementation for @ref record() */
+        virtual void doRecord(Command command, UnsignedInt object, UnsignedLong size, bool redundant) = 0;
+};
+
+/** @debugoperatorclassenum{Magnum::CommandObserver,Magnum::CommandObserver::Command} */
+MAGNUM_EXPORT Debug& operator<<(Debug& debug, CommandObserver::Command value);
+
+}
+
+#endif
@@ -25,9 +25,10 @@
 
 #include "Context.h"
 
+#include <algorithm>
+#include <cstring>
 #include <iostream> /* for initialization log redirection */
 #include <string>
-#include <unordered_map>
 #include <Corrade/Utility/Arguments.h>
 #include <Corrade/Utility/Debug.h>
 #include <Corrade/Utility/String.h>
@@ -83,6 +84,7 @@ const std::vector<Extension>& Extension::extensions(Version version) {
         _extension(GL,ARB,sparse_buffer),
         _extension(GL,ARB,transform_feedback_overflow_query),
         _extension(GL,ATI,texture_mirror_once),
+        _extension(GL,ATI,meminfo),
         _extension(GL,EXT,texture_filter_anisotropic),
         _extension(GL,EXT,texture_compression_s3tc),
         _extension(GL,EXT,texture_mirror_clamp),
@@ -96,7 +98,9 @@ const std::vector<Extension>& Extension::extensions(Version version) {
         _extension(GL,KHR,texture_compression_astc_hdr),
         _extension(GL,KHR,blend_equation_advanced),
         _extension(GL,KHR,blend_equation_advanced_coherent),
-        _extension(GL,KHR,no_error)};
+        _extension(GL,KHR,no_error),
+        _extension(GL,KHR,parallel_shader_compile),
+        _extension(GL,NVX,gpu_memory_info)};
     static const std::vector<Extension> extensions300{
         _extension(GL,ARB,map_buffer_range),
         _extension(GL,ARB,color_buffer_float),
@@ -299,6 +303,7 @@ const std::vector<Extension>& Extension::extensions(Version version) {
         _extension(GL,KHR,robust_buffer_access_behavior),
         _extension(GL,KHR,context_flush_control),
         _extension(GL,KHR,no_error),
+        _extension(GL,KHR,parallel_shader_compile),
         _extension(GL,NV,read_buffer_front),
         _extension(GL,NV,read_depth),
         _extension(GL,NV,read_stencil),
@@ -411,6 +416,74 @@ const std::vector<Extension>& Extension::extensions(Version version) {
     CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
 }
 
+namespace {
+    /* All known extensions sorted by their string so driver extension
+       strings can be looked up with a binary search. The table doesn't
+       change during the lifetime of the process, so it's built only once. */
+    const std::vector<Extension>& sortedExtensions(const std::vector<Version>& versions) {
+        static const std::vector<Extension> extensions = [&versions]() {
+            std::vector<Extension> extensions;
+            for(const Version version: versions)
+                extensions.insert(extensions.end(), Extension::extensions(version).begin(), Extension::extensions(version).end());
+            std::sort(extensions.begin(), extensions.end(), [](const Extension& a, const Extension& b) {
+                return std::strcmp(a.string(), b.string()) < 0;
+            });
+            return extensions;
+        }();
+        return extensions;
+    }
+
+    /* The string doesn't need to be null-terminated */
+    const Extension* findExtension(const std::vector<Extension>& sorted, const char* const string, const std::size_t size) {
+        const auto found = std::lower_bound(sorted.begin(), sorted.end(), string, [size](const Extension& extension, const char* const string) {
+            return std::strncmp(extension.string(), string, size) < 0;
+        });
+        if(found == sorted.end() || std::strncmp(found->string(), string, size) != 0 || found->string()[size] != '\0')
+            return nullptr;
+        return &*found;
+    }
+
+    /* Calls given function with pointer and size of each extension string
+       reported by the driver, without copying the strings anywhere */
+    template<class F> void forEachExtensionString(const Context& context, F f) {
+        #ifndef MAGNUM_TARGET_GLES2
+        GLint extensionCount = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+        #ifndef MAGNUM_TARGET_GLES3
+        if(extensionCount || context.isVersionSupported(Version::GL300))
+        #endif
+        {
+            for(GLint i = 0; i != extensionCount; ++i) {
+                const char* const extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
+                f(extension, std::strlen(extension));
+            }
+        }
+        #ifndef MAGNUM_TARGET_GLES3
+        else
+        #endif
+        #endif
+
+        #ifndef MAGNUM_TARGET_GLES3
+        /* OpenGL 2.1 / OpenGL ES 2.0 doesn't have glGetStringi(), the
+           extensions are separated by spaces. Don't crash when glGetString()
+           returns nullptr (i.e. don't trust the old implementations). */
+        {
+            const char* e = reinterpret_cast<const char*>(glGetString(GL_EXTENSIONS));
+            while(e && *e) {
+                const char* const end = std::strchr(e, ' ');
+                const std::size_t size = end ? end - e : std::strlen(e);
+                if(size) f(e, size);
+                e = end ? end + 1 : nullptr;
+            }
+        }
+        #endif
+
+        #if defined(MAGNUM_TARGET_GLES2) || defined(MAGNUM_TARGET_GLES3)
+        static_cast<void>(context);
+        #endif
+    }
+}
+
 namespace {
     #ifdef MAGNUM_BUILD_MULTITHREADED
     #if !defined(CORRADE_GCC47_COMPATIBILITY) && !defined(CORRADE_TARGET_APPLE)
@@ -429,15 +502,21 @@ Context& Context::current() {
     return *currentContext;
 }
 
+void Context::makeCurrent(Context* const context) {
+    currentContext = context;
+}
+
 Context::Context(NoCreateT, Int argc, const char** argv, void functionLoader()): _functionLoader{functionLoader}, _version{Version::None} {
     /* Parse arguments */
     Utility::Arguments args{"magnum"};
     args.addOption("disable-workarounds")
         .setHelp("disable-workarounds", "driver workarounds to disable\n      (see src/Magnum/Implementation/driverSpecific.cpp for detailed info)", "LIST")
         .addOption("disable-extensions").setHelp("disable-extensions", "OpenGL extensions to disable", "LIST")
+        .addOption("fast-path-cache").setHelp("fast-path-cache", "probe fastest implementations on startup and cache the result in given file", "FILE")
         .addOption("log", "default").setHelp("log", "Console logging", "default|quiet")
         .setFromEnvironment("disable-workarounds")
         .setFromEnvironment("disable-extensions")
+        .setFromEnvironment("fast-path-cache")
         .setFromEnvironment("log")
         .parse(argc, argv);
 
@@ -451,6 +530,8 @@ Context::Context(NoCreateT, Int argc, const char** argv, void functionLoader()):
     /* Disable extensions */
     for(auto&& extension: Utility::String::splitWithoutEmptyParts(args.value("disable-extensions")))
         _disabledExtensions.push_back(extension);
+
+    _fastPathCache = args.value("fast-path-cache");
 }
 
 Context::Context(Context&& other): _version{std::move(other._version)},
@@ -625,31 +706,24 @@ bool Context::tryCreate() {
         for(const Extension& extension: Extension::extensions(versions[i]))
             _extensionStatus.set(extension._index);
 
-    /* List of extensions from future versions (extensions from current and
-       previous versions should be supported automatically, so we don't need
-       to check for them) */
-    std::unordered_map<std::string, Extension> futureExtensions;
-    for(std::size_t i = future; i != versions.size(); ++i)
-        for(const Extension& extension: Extension::extensions(versions[i]))
-            futureExtensions.emplace(extension._string, extension);
-
-    /* Check for presence of future and vendor extensions */
-    const std::vector<std::string> extensions = extensionStrings();
-    for(const std::string& extension: extensions) {
-        const auto found = futureExtensions.find(extension);
-        if(found != futureExtensions.end()) {
-            _supportedExtensions.push_back(found->second);
-            _extensionStatus.set(found->second._index);
+    /* Check for presence of future and vendor extensions. Extensions from
+       current and previous versions are already marked as supported, so they
+       are skipped. */
+    const std::vector<Extension>& knownExtensions = sortedExtensions(versions);
+    forEachExtensionString(*this, [this, &knownExtensions](const char* const string, const std::size_t size) {
+        const Extension* const found = findExtension(knownExtensions, string, size);
+        if(found && !_extensionStatus[found->_index]) {
+            _supportedExtensions.push_back(*found);
+            _extensionStatus.set(found->_index);
         }
-    }
+    });
 
     /* Reset minimal required version to Version::None for whole array */
     for(auto& i: _extensionRequiredVersion) i = Version::None;
 
     /* Initialize required versions from extension info */
-    for(const auto version: versions)
-        for(const Extension& extension: Extension::extensions(version))
-            _extensionRequiredVersion[extension._index] = extension._requiredVersion;
+    for(const Extension& extension: knownExtensions)
+        _extensionRequiredVersion[extension._index] = extension._requiredVersion;
 
     /* Setup driver workarounds (increase required version for particular
        extensions), see Implementation/driverWorkarounds.cpp */
@@ -671,24 +745,25 @@ bool Context::tryCreate() {
     if(!_disabledExtensions.empty()) {
         Debug{output} << "Disabling extensions:";
 
-        /* Put remaining extensions into the hashmap for faster lookup */
-        std::unordered_map<std::string, Extension> allExtensions{std::move(futureExtensions)};
-        for(std::size_t i = 0; i != future; ++i)
-            for(const Extension& extension: Extension::extensions(versions[i]))
-                allExtensions.emplace(extension._string, extension);
-
         /* Disable extensions that are known and supported and print a message
            for each */
         for(auto&& extension: _disabledExtensions) {
-            auto found = allExtensions.find(extension);
+            const Extension* const found = findExtension(knownExtensions, extension.data(), extension.size());
             /** @todo Error message here? I should not clutter the output at this point */
-            if(found == allExtensions.end()) continue;
+            if(!found) continue;
 
-            _extensionRequiredVersion[found->second._index] = Version::None;
+            _extensionRequiredVersion[found->_index] = Version::None;
             Debug{output} << "   " << extension;
         }
     }
 
+    /* Probe for fastest implementations, if requested. Done after disabling
+       extensions so the probe considers only what the state tracker will
+       see, see Implementation/fastPaths.cpp */
+    #ifndef MAGNUM_TARGET_GLES
+    if(!_fastPathCache.empty()) setupFastPaths(output);
+    #endif
+
     _state = new Implementation::State{*this, output};
 
     /* Print a list of used workarounds */
@@ -745,33 +820,9 @@ std::vector<std::string> Context::shadingLanguageVersionStrings() const {
 
 std::vector<std::string> Context::extensionStrings() const {
     std::vector<std::string> extensions;
-
-    #ifndef MAGNUM_TARGET_GLES2
-    GLint extensionCount = 0;
-    glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
-    #ifndef MAGNUM_TARGET_GLES3
-    if(extensionCount || isVersionSupported(Version::GL300))
-    #endif
-    {
-        extensions.reserve(extensionCount);
-        for(GLint i = 0; i != extensionCount; ++i)
-            extensions.push_back(reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i)));
-    }
-    #ifndef MAGNUM_TARGET_GLES3
-    else
-    #endif
-    #endif
-
-    #ifndef MAGNUM_TARGET_GLES3
-    /* OpenGL 2.1 / OpenGL ES 2.0 doesn't have glGetStringi() */
-    {
-        /* Don't crash when glGetString() returns nullptr (i.e. don't trust the
-           old implementations) */
-        const char* e = reinterpret_cast<const char*>(glGetString(GL_EXTENSIONS));
-        if(e) extensions = Utility::String::splitWithoutEmptyParts(e, ' ');
-    }
-    #endif
-
+    forEachExtensionString(*this, [&extensions](const char* const string, const std::size_t size) {
+        extensions.emplace_back(string, size);
+    });
     return extensions;
 }
 
@@ -799,6 +850,46 @@ Version Context::supportedVersion(std::initializer_list<Version> versions) const
     #endif
 }
 
+#ifndef MAGNUM_TARGET_GLES
+namespace {
+    /* Not in flextGL, as the extensions don't add any entry points */
+    enum: GLenum {
+        GpuMemoryInfoTotalAvailableMemoryNvx = 0x9048,
+        GpuMemoryInfoCurrentAvailableVidmemNvx = 0x9049,
+        TextureFreeMemoryAti = 0x87FC
+    };
+}
+
+UnsignedLong Context::totalGpuMemory() {
+    if(!isExtensionSupported<Extensions::GL::NVX::gpu_memory_info>())
+        return 0;
+
+    /* The value is in kB */
+    GLint value{};
+    glGetIntegerv(GpuMemoryInfoTotalAvailableMemoryNvx, &value);
+    return UnsignedLong(value)*1024;
+}
+
+UnsignedLong Context::availableGpuMemory() {
+    /* The values are in kB */
+    if(isExtensionSupported<Extensions::GL::NVX::gpu_memory_info>()) {
+        GLint value{};
+        glGetIntegerv(GpuMemoryInfoCurrentAvailableVidmemNvx, &value);
+        return UnsignedLong(value)*1024;
+    }
+
+    if(isExtensionSupported<Extensions::GL::ATI::meminfo>()) {
+        /* Total free memory, largest free block, total free auxiliary memory
+           and largest free auxiliary block */
+        GLint values[4]{};
+        glGetIntegerv(TextureFreeMemoryAti, values);
+        return UnsignedLong(values[0])*1024;
+    }
+
+    return 0;
+}
+#endif
+
 void Context::resetState(const States states) {
     if(states & State::Buffers)
         _state->buffer->reset();
@@ -812,7 +903,8 @@ void Context::resetState(const States states) {
         _state->renderer->packPixelStorage.reset();
     }
 
-    /* Nothing to reset for renderer yet */
+    if(states & State::Renderer)
+        _state->renderer->shadow.reset();
 
     if(states & State::Shaders) {
         /* Nothing to reset for shaders */
@@ -43,7 +43,11 @@
 
 namespace Magnum {
 
-namespace Implementation { struct State; }
+namespace Implementation {
+    struct State;
+    enum class FastPath: UnsignedByte;
+    typedef Containers::EnumSet<FastPath> FastPaths;
+}
 namespace Platform { class Context; }
 
 /**
@@ -98,7 +102,7 @@ The context is configurable through command-line options, that are passed
 either from the `Platform::*Application` classes or from the @ref Platform::Context
 class. Usage:
 
-    <application> [--magnum-help] [--magnum-disable-workarounds LIST] [--magnum-disable-extensions LIST] ...
+    <application> [--magnum-help] [--magnum-disable-workarounds LIST] [--magnum-disable-extensions LIST] [--magnum-fast-path-cache FILE] ...
 
 Arguments:
 
@@ -109,6 +113,25 @@ Arguments:
     (environment: `MAGNUM_DISABLE_WORKAROUNDS`)
 -   `--magnum-disable-extensions LIST` -- OpenGL extensions to disable
     (environment: `MAGNUM_DISABLE_EXTENSIONS`)
+-   `--magnum-fast-path-cache FILE` -- probe fastest implementations on
+    startup and cache the result in given file, see below (environment:
+    `MAGNUM_FAST_PATH_CACHE`)
+
+## Fast-path probing
+
+By default, the engine picks implementations of buffer, texture and mesh
+operations based on extension presence alone, preferring direct state access
+wherever available. Some drivers advertise @extension{ARB,direct_state_access}
+or @extension{EXT,direct_state_access}, but are slower with it than with the
+classic bind-to-edit approach. If the `--magnum-fast-path-cache` option is
+specified, the context times a handful of buffer uploads, texture binds and
+uploads and vertex attribute setups on startup using both approaches and
+selects the faster one. It also compares @fn_gl{BufferSubData} with uploading
+through @fn_gl{MapBufferRange}. The result is saved to given file, keyed by
+renderer, vendor and version string, so the probe is run only once for each
+driver. Delete the file to force the probe to run again. Extensions disabled
+using `--magnum-disable-extensions` are not considered by the probe. Available
+only on desktop OpenGL, on other platforms the option is ignored.
 
 */
 class MAGNUM_EXPORT Context {
@@ -256,10 +279,24 @@ class MAGNUM_EXPORT Context {
          * Expect that there is current context. If Magnum is built with
          * @ref MAGNUM_BUILD_MULTITHREADED, current context is thread-local
          * instead of global (the default).
-         * @see @ref hasCurrent()
+         * @see @ref hasCurrent(), @ref makeCurrent()
          */
         static Context& current();
 
+        /**
+         * @brief Make given context current
+         *
+         * Useful when a single thread alternates between more Magnum contexts,
+         * each having its own underlying GL context --- make the GL context
+         * current first and then the corresponding Magnum context. Passing
+         * `nullptr` makes no context current, which is needed for example
+         * before creating another context in the same thread. If Magnum is
+         * built with @ref MAGNUM_BUILD_MULTITHREADED, affects only current
+         * thread. Newly created context is made current implicitly.
+         * @see @ref platform-windowless-contexts-shared
+         */
+        static void makeCurrent(Context* context);
+
         /** @brief Copying is not allowed */
         Context(const Context&) = delete;
 
@@ -478,6 +515,39 @@ class MAGNUM_EXPORT Context {
             return isVersionSupported(extension._requiredVersion) && !isVersionSupported(_extensionRequiredVersion[extension._index]);
         }
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Total GPU memory
+         *
+         * Total dedicated video memory in bytes, as reported by the driver.
+         * If @extension{NVX,gpu_memory_info} is not available, returns `0`.
+         * The value is not cached, repeated queries will result in repeated
+         * OpenGL calls.
+         * @see @ref availableGpuMemory(), @ref GpuMemory::usage(),
+         *      @fn_gl{Get} with @def_gl{GPU_MEMORY_INFO_TOTAL_AVAILABLE_MEMORY_NVX}
+         * @requires_gl Video memory queries are not available in OpenGL ES
+         *      or WebGL.
+         */
+        UnsignedLong totalGpuMemory();
+
+        /**
+         * @brief Available GPU memory
+         *
+         * Currently available video memory in bytes, as reported by the
+         * driver. Queried using @extension{NVX,gpu_memory_info} or, if not
+         * available, @extension{ATI,meminfo}, in which case only free texture
+         * memory is reported. If neither extension is available, returns `0`.
+         * The value is not cached, repeated queries will result in repeated
+         * OpenGL calls.
+         * @see @ref totalGpuMemory(), @ref GpuMemory::usage(),
+         *      @fn_gl{Get} with @def_gl{GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX}
+         *      or @def_gl{TEXTURE_FREE_MEMORY_ATI}
+         * @requires_gl Video memory queries are not available in OpenGL ES
+         *      or WebGL.
+         */
+        UnsignedLong availableGpuMemory();
+        #endif
+
         /**
          * @brief Reset internal state tracker
          * @param states    Tracked states to reset. Default is all state.
@@ -502,6 +572,7 @@ class MAGNUM_EXPORT Context {
     private:
     #endif
         bool isDriverWorkaroundDisabled(const std::string& workaround);
+        Implementation::FastPaths fastPaths() const { return _fastPaths; }
         Implementation::State& state() { return *_state; }
 
     private:
@@ -514,6 +585,11 @@ class MAGNUM_EXPORT Context {
         /* Defined in Implementation/driverSpecific.cpp */
         MAGNUM_LOCAL void setupDriverWorkarounds();
 
+        #ifndef MAGNUM_TARGET_GLES
+        /* Defined in Implementation/fastPaths.cpp */
+        MAGNUM_LOCAL void setupFastPaths(std::ostream* output);
+        #endif
+
         void(*_functionLoader)();
         Version _version;
         #ifndef MAGNUM_TARGET_WEBGL
@@ -531,6 +607,8 @@ class MAGNUM_EXPORT Context {
         /* True means known and disabled, false means known */
         std::vector<std::pair<std::string, bool>> _driverWorkarounds;
         std::vector<std::string> _disabledExtensions;
+        std::string _fastPathCache;
+        Implementation::FastPaths _fastPaths;
         bool _displayInitializationLog;
 };
 
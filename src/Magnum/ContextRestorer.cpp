@@ -0,0 +1,99 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ContextRestorer.h"
+
+#include <algorithm>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Buffer.h"
+#include "Magnum/Context.h"
+
+namespace Magnum {
+
+namespace {
+
+struct BufferRecipe {
+    void operator()() const {
+        buffer = Buffer{targetHint};
+        buffer.setData({data.data(), data.size()}, usage);
+    }
+
+    Buffer& buffer;
+    Buffer::TargetHint targetHint;
+    std::vector<char> data;
+    BufferUsage usage;
+};
+
+}
+
+ContextRestorer::ContextRestorer() = default;
+
+ContextRestorer::~ContextRestorer() = default;
+
+ContextRestorer& ContextRestorer::setData(Buffer& buffer, const Containers::ArrayView<const void> data, const BufferUsage usage) {
+    buffer.setData(data, usage);
+
+    const char* const begin = static_cast<const char*>(data.data());
+    return addInternal(&buffer, [&buffer]() { buffer.release(); },
+        BufferRecipe{buffer, buffer.targetHint(), std::vector<char>(begin, begin + data.size()), usage});
+}
+
+ContextRestorer& ContextRestorer::addInternal(const void* const object, std::function<void()> release, std::function<void()> recipe) {
+    /* Replace existing registration in place to keep the order */
+    auto found = std::find_if(_entries.begin(), _entries.end(), [object](const Entry& entry) {
+        return entry.object == object;
+    });
+    if(found != _entries.end()) {
+        found->release = std::move(release);
+        found->recipe = std::move(recipe);
+    } else _entries.push_back({object, std::move(release), std::move(recipe)});
+
+    return *this;
+}
+
+ContextRestorer& ContextRestorer::remove(const void* const object) {
+    auto found = std::find_if(_entries.begin(), _entries.end(), [object](const Entry& entry) {
+        return entry.object == object;
+    });
+    CORRADE_ASSERT(found != _entries.end(),
+        "ContextRestorer::remove(): object not registered", *this);
+
+    _entries.erase(found);
+    return *this;
+}
+
+void ContextRestorer::contextLost() {
+    for(const Entry& entry: _entries) entry.release();
+}
+
+void ContextRestorer::restore() {
+    /* Nothing the state tracker remembers is valid in the new context */
+    Context::current().resetState();
+
+    for(const Entry& entry: _entries) entry.recipe();
+}
+
+}
@@ -0,0 +1,175 @@
+#ifndef Magnum_ContextRestorer_h
+#define Magnum_ContextRestorer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::ContextRestorer
+ */
+
+#include <functional>
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum {
+
+/**
+@brief Re-creation of OpenGL objects after context loss
+
+On Android, when the application goes to background, and in WebGL, when the
+browser decides so, the OpenGL context is destroyed together with all objects
+in it. Instead of tearing down the whole application and loading everything
+from disk again, the objects can be registered in a restorer together with a
+*recipe* that's able to create them again --- either from a CPU-side shadow
+copy kept by the restorer or by any other means, such as running the importer
+again or re-fetching the data from a @ref ResourceManager loader:
+@code
+ContextRestorer restorer;
+
+// Buffer with a shadow copy, uploaded right away
+Buffer vertices;
+restorer.setData(vertices, data, BufferUsage::StaticDraw);
+
+// Recipes for other objects, called in order of addition, so the mesh
+// recipe can use the already restored buffer
+Mesh mesh;
+auto meshRecipe = [&](Mesh& mesh) {
+    mesh = Mesh{};
+    mesh.setCount(3)
+        .addVertexBuffer(vertices, 0, Shaders::Flat3D::Position{});
+};
+meshRecipe(mesh);
+restorer.add(mesh, meshRecipe);
+
+Shaders::Flat3D shader;
+restorer.add(shader, [](Shaders::Flat3D& shader) { shader = Shaders::Flat3D{}; });
+@endcode
+
+When the context is lost, call @ref contextLost(), which releases the OpenGL
+names of all registered objects, so their destructors don't delete unrelated
+objects in a new context. After a new context is created and made current,
+@ref restore() resets the @ref Context state tracker and calls all recipes.
+@ref Platform::AndroidApplication does both automatically after
+@ref Platform::AndroidApplication::setContextRestorer() "setContextRestorer()"
+is called, instead of destroying the application when its window goes away.
+
+Shader programs are compiled and linked again in the recipes. With a
+@ref ShaderProgramBinaryCache set, the linking is skipped and the program is
+loaded from the previously saved binary, which makes the restore
+considerably faster.
+
+The restorer references the objects, so they need to be removed with
+@ref remove() before destruction.
+*/
+class MAGNUM_EXPORT ContextRestorer {
+    public:
+        /** @brief Constructor */
+        explicit ContextRestorer();
+
+        /** @brief Copying is not allowed */
+        ContextRestorer(const ContextRestorer&) = delete;
+
+        /** @brief Moving is not allowed */
+        ContextRestorer(ContextRestorer&&) = delete;
+
+        ~ContextRestorer();
+
+        /** @brief Copying is not allowed */
+        ContextRestorer& operator=(const ContextRestorer&) = delete;
+
+        /** @brief Moving is not allowed */
+        ContextRestorer& operator=(ContextRestorer&&) = delete;
+
+        /** @brief Count of registered objects */
+        std::size_t size() const { return _entries.size(); }
+
+        /**
+         * @brief Set buffer data and keep a shadow copy
+         * @return Reference to self (for method chaining)
+         *
+         * Calls @ref Buffer::setData() and registers the buffer with a copy of
+         * @p data, which is uploaded again on @ref restore() into a buffer
+         * with the same @ref Buffer::targetHint(). If the buffer is already
+         * registered, the previous registration is replaced.
+         */
+        ContextRestorer& setData(Buffer& buffer, Containers::ArrayView<const void> data, BufferUsage usage);
+
+        /**
+         * @brief Register an object with a recipe
+         * @return Reference to self (for method chaining)
+         *
+         * On @ref restore(), the @p recipe gets a released object and is
+         * expected to move a newly created instance into it and set it up
+         * again. The type needs to have a `release()` function, which is
+         * true for all OpenGL object wrappers. If the object is already
+         * registered, the previous registration is replaced.
+         */
+        template<class T> ContextRestorer& add(T& object, std::function<void(T&)> recipe) {
+            return addInternal(&object, [&object]() { object.release(); }, [&object, recipe]() { recipe(object); });
+        }
+
+        /**
+         * @brief Remove an object
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the object is registered.
+         */
+        ContextRestorer& remove(const void* object);
+
+        /**
+         * @brief Handle context loss
+         *
+         * Releases OpenGL names of all registered objects. Call this after
+         * the context is lost and before it's destroyed.
+         */
+        void contextLost();
+
+        /**
+         * @brief Restore the objects
+         *
+         * Expects that a new context is current. Resets the state tracker
+         * with @ref Context::resetState() and calls recipes of all
+         * registered objects in the order they were registered.
+         */
+        void restore();
+
+    private:
+        struct Entry {
+            const void* object;
+            std::function<void()> release;
+            std::function<void()> recipe;
+        };
+
+        ContextRestorer& addInternal(const void* object, std::function<void()> release, std::function<void()> recipe);
+
+        std::vector<Entry> _entries;
+};
+
+}
+
+#endif
@@ -266,40 +266,46 @@ CompressedBufferImage3D CubeMapTexture::compressedSubImage(const Int level, cons
     compressedSubImage(level, range, image, usage);
     return std::move(image);
 }
+#endif
 
 CubeMapTexture& CubeMapTexture::setSubImage(const Int level, const Vector3i& offset, const ImageView3D& image) {
-    createIfNotAlready();
-
+    #ifndef MAGNUM_TARGET_GLES2
     Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
+    #endif
     image.storage().applyUnpack();
-    glTextureSubImage3D(_id, level, offset.x(), offset.y(), offset.z(), image.size().x(), image.size().y(), image.size().z(), GLenum(image.format()), GLenum(image.type()), image.data());
+    (this->*Context::current().state().texture->cubeSubImage3DImplementation)(level, offset, image.size(), image.format(), image.type(), image.data(), image.storage());
     return *this;
 }
 
+#ifndef MAGNUM_TARGET_GLES2
 CubeMapTexture& CubeMapTexture::setSubImage(const Int level, const Vector3i& offset, BufferImage3D& image) {
-    createIfNotAlready();
-
     image.buffer().bindInternal(Buffer::TargetHint::PixelUnpack);
     image.storage().applyUnpack();
-    glTextureSubImage3D(_id, level, offset.x(), offset.y(), offset.z(), image.size().x(), image.size().y(), image.size().z(), GLenum(image.format()), GLenum(image.type()), nullptr);
+    (this->*Context::current().state().texture->cubeSubImage3DImplementation)(level, offset, image.size(), image.format(), image.type(), nullptr, image.storage());
     return *this;
 }
+#endif
 
 CubeMapTexture& CubeMapTexture::setCompressedSubImage(const Int level, const Vector3i& offset, const CompressedImageView3D& image) {
-    createIfNotAlready();
-
+    #ifndef MAGNUM_TARGET_GLES2
     Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
+    #endif
+    #ifndef MAGNUM_TARGET_GLES
+    /* Pixel storage is completely ignored for compressed images on ES, no need
+       to reset anything */
     image.storage().applyUnpack();
-    glCompressedTextureSubImage3D(_id, level, offset.x(), offset.y(), offset.z(), image.size().x(), image.size().y(), image.size().z(), GLenum(image.format()), Implementation::occupiedCompressedImageDataSize(image, image.data().size()), image.data());
+    #endif
+    (this->*Context::current().state().texture->cubeCompressedSubImage3DImplementation)(level, offset, image.size(), image.format(), image.data(), Implementation::occupiedCompressedImageDataSize(image, image.data().size()));
     return *this;
 }
 
+#ifndef MAGNUM_TARGET_GLES2
 CubeMapTexture& CubeMapTexture::setCompressedSubImage(const Int level, const Vector3i& offset, CompressedBufferImage3D& image) {
-    createIfNotAlready();
-
     image.buffer().bindInternal(Buffer::TargetHint::PixelUnpack);
+    #ifndef MAGNUM_TARGET_GLES
     image.storage().applyUnpack();
-    glCompressedTextureSubImage3D(_id, level, offset.x(), offset.y(), offset.z(), image.size().x(), image.size().y(), image.size().z(), GLenum(image.format()), Implementation::occupiedCompressedImageDataSize(image, image.dataSize()), nullptr);
+    #endif
+    (this->*Context::current().state().texture->cubeCompressedSubImage3DImplementation)(level, offset, image.size(), image.format(), nullptr, Implementation::occupiedCompressedImageDataSize(image, image.dataSize()));
     return *this;
 }
 #endif
@@ -489,6 +495,34 @@ void CubeMapTexture::compressedSubImageImplementationDefault(const CubeMapCoordi
     glCompressedTexSubImage2D(GLenum(coordinate), level, offset.x(), offset.y(), size.x(), size.y(), GLenum(format), dataSize, data);
 }
 
+void CubeMapTexture::subImage3DImplementationSliced(const GLint level, const Vector3i& offset, const Vector3i& size, const PixelFormat format, const PixelType type, const GLvoid* const data, const PixelStorage& storage) {
+    /* Each face is uploaded separately as a 2D image. GL applies the X and Y
+       skip for 2D uploads as well (except for ES2, where it had to be done
+       manually), but the Z skip and the face stride have to be applied here.
+       The data pointer is an offset into the pixel unpack buffer if any is
+       bound, so do the arithmetic on integers. */
+    const std::tuple<Math::Vector3<std::size_t>, Math::Vector3<std::size_t>, std::size_t> properties = storage.dataProperties(format, type, size);
+    const std::size_t faceStride = std::get<1>(properties).xy().product();
+    #ifndef MAGNUM_TARGET_GLES2
+    const std::uintptr_t first = reinterpret_cast<std::uintptr_t>(data) + std::get<0>(properties).z();
+    #else
+    const std::uintptr_t first = reinterpret_cast<std::uintptr_t>(data) + std::get<0>(properties).sum();
+    #endif
+
+    for(Int i = 0; i != size.z(); ++i)
+        (this->*Context::current().state().texture->cubeSubImageImplementation)(CubeMapCoordinate(GL_TEXTURE_CUBE_MAP_POSITIVE_X + offset.z() + i), level, offset.xy(), size.xy(), format, type, reinterpret_cast<const GLvoid*>(first + i*faceStride));
+}
+
+void CubeMapTexture::compressedSubImage3DImplementationSliced(const GLint level, const Vector3i& offset, const Vector3i& size, const CompressedPixelFormat format, const GLvoid* const data, const GLsizei dataSize) {
+    if(!size.z()) return;
+
+    /* Faces are expected to be tightly packed one after another, as in KTX
+       or DDS files */
+    const GLsizei faceDataSize = dataSize/size.z();
+    for(Int i = 0; i != size.z(); ++i)
+        (this->*Context::current().state().texture->cubeCompressedSubImageImplementation)(CubeMapCoordinate(GL_TEXTURE_CUBE_MAP_POSITIVE_X + offset.z() + i), level, offset.xy(), size.xy(), format, reinterpret_cast<const GLvoid*>(reinterpret_cast<std::uintptr_t>(data) + i*faceDataSize), faceDataSize);
+}
+
 #ifndef MAGNUM_TARGET_GLES
 void CubeMapTexture::subImageImplementationDSA(const CubeMapCoordinate coordinate, const GLint level, const Vector2i& offset, const Vector2i& size, const PixelFormat format, const PixelType type, const GLvoid* const data) {
     glTextureSubImage3D(_id, level, offset.x(), offset.y(), GLenum(coordinate) - GL_TEXTURE_CUBE_MAP_POSITIVE_X, size.x(), size.y(), 1, GLenum(format), GLenum(type), data);
@@ -498,6 +532,14 @@ void CubeMapTexture::compressedSubImageImplementationDSA(const CubeMapCoordinate
     glCompressedTextureSubImage3D(_id, level, offset.x(), offset.y(), GLenum(coordinate) - GL_TEXTURE_CUBE_MAP_POSITIVE_X, size.x(), size.y(), 1, GLenum(format), dataSize, data);
 }
 
+void CubeMapTexture::subImage3DImplementationDSA(const GLint level, const Vector3i& offset, const Vector3i& size, const PixelFormat format, const PixelType type, const GLvoid* const data, const PixelStorage&) {
+    glTextureSubImage3D(_id, level, offset.x(), offset.y(), offset.z(), size.x(), size.y(), size.z(), GLenum(format), GLenum(type), data);
+}
+
+void CubeMapTexture::compressedSubImage3DImplementationDSA(const GLint level, const Vector3i& offset, const Vector3i& size, const CompressedPixelFormat format, const GLvoid* const data, const GLsizei dataSize) {
+    glCompressedTextureSubImage3D(_id, level, offset.x(), offset.y(), offset.z(), size.x(), size.y(), size.z(), GLenum(format), dataSize, data);
+}
+
 void CubeMapTexture::subImageImplementationDSAEXT(const CubeMapCoordinate coordinate, const GLint level, const Vector2i& offset, const Vector2i& size, const PixelFormat format, const PixelType type, const GLvoid* const data) {
     _flags |= ObjectFlag::Created;
     glTextureSubImage2DEXT(_id, GLenum(coordinate), level, offset.x(), offset.y(), size.x(), size.y(), GLenum(format), GLenum(type), data);
@@ -83,6 +83,16 @@ texture.setMagnificationFilter(Sampler::Filter::Linear)
     // ...
 @endcode
 
+If the data for all six faces are in a single contiguous image (such as a
+mip level imported from a KTX or DDS file), they can be uploaded with a single
+@ref setSubImage(Int, const Vector3i&, const ImageView3D&) or
+@ref setCompressedSubImage(Int, const Vector3i&, const CompressedImageView3D&)
+call instead:
+@code
+ImageView3D faces{PixelFormat::RGBA, PixelType::UnsignedByte, {256, 256, 6}, data};
+texture.setSubImage(0, {}, faces);
+@endcode
+
 In shader, the texture is used via `samplerCube`, `samplerCubeShadow`,
 `isamplerCube` or `usamplerCube`. Unlike in classic textures, coordinates for
 cube map textures is signed three-part vector from the center of the cube,
@@ -910,64 +920,92 @@ class MAGNUM_EXPORT CubeMapTexture: public AbstractTexture {
         }
         #endif
 
-        #ifndef MAGNUM_TARGET_GLES
         /**
-         * @brief Set image subdata
+         * @brief Set image subdata of multiple faces
          * @param level             Mip level
-         * @param offset            Offset where to put data in the texture
+         * @param offset            Offset where to put data in the texture.
+         *      The Z coordinate is the first face, in order
+         *      @ref CubeMapCoordinate::PositiveX, @ref CubeMapCoordinate::NegativeX,
+         *      @ref CubeMapCoordinate::PositiveY etc.
          * @param image             @ref Image3D, @ref ImageView3D or
          *      @ref Trade::ImageData3D
          * @return Reference to self (for method chaining)
          *
-         * @see @ref setStorage(), @fn_gl2{TextureSubImage3D,TexSubImage3D}
-         * @requires_gl45 Extension @extension{ARB,direct_state_access}
-         * @requires_gl In OpenGL ES and WebGL you need to set image for each
-         *      face separately.
+         * Uploads `image.size().z()` consecutive faces at once, setting the
+         * whole cube map with a single call if the image has six slices. If
+         * @extension{ARB,direct_state_access} (part of OpenGL 4.5) is
+         * available, the upload is done with a single
+         * @fn_gl{TextureSubImage3D} call, otherwise the function turns into a
+         * sequence of @fn_gl{TexSubImage2D} calls, one for each face, with
+         * pixel storage parameters applied in the same way as in the
+         * single-call case.
+         * @see @ref setStorage(), @ref setSubImage(CubeMapCoordinate, Int, const Vector2i&, const ImageView2D&),
+         *      @fn_gl2{TextureSubImage3D,TexSubImage3D}, eventually
+         *      @fn_gl{ActiveTexture}, @fn_gl{BindTexture} and
+         *      @fn_gl{TexSubImage2D}
          */
         CubeMapTexture& setSubImage(Int level, const Vector3i& offset, const ImageView3D& image);
 
+        #ifndef MAGNUM_TARGET_GLES2
         /** @overload
-         * @requires_gl45 Extension @extension{ARB,direct_state_access}
-         * @requires_gl In OpenGL ES and WebGL you need to set image for each
-         *      face separately.
+         * @requires_gles30 Pixel buffer objects are not available in OpenGL
+         *      ES 2.0.
+         * @requires_webgl20 Pixel buffer objects are not available in WebGL
+         *      1.0.
          */
         CubeMapTexture& setSubImage(Int level, const Vector3i& offset, BufferImage3D& image);
 
         /** @overload
-         * @requires_gl45 Extension @extension{ARB,direct_state_access}
-         * @requires_gl In OpenGL ES and WebGL you need to set image for each
-         *      face separately.
+         * @requires_gles30 Pixel buffer objects are not available in OpenGL
+         *      ES 2.0.
+         * @requires_webgl20 Pixel buffer objects are not available in WebGL
+         *      1.0.
          */
         CubeMapTexture& setSubImage(Int level, const Vector3i& offset, BufferImage3D&& image) {
             return setSubImage(level, offset, image);
         }
+        #endif
 
         /**
-         * @brief Set compressed image subdata
+         * @brief Set compressed image subdata of multiple faces
          * @param level             Mip level
-         * @param offset            Offset where to put data in the texture
+         * @param offset            Offset where to put data in the texture.
+         *      The Z coordinate is the first face, see
+         *      @ref setSubImage(Int, const Vector3i&, const ImageView3D&) for
+         *      the face order.
          * @param image             @ref CompressedImage3D, @ref CompressedImageView3D
          *      or compressed @ref Trade::ImageData3D
          * @return Reference to self (for method chaining)
          *
-         * @see @ref setStorage(), @fn_gl2{CompressedTextureSubImage3D,CompressedTexSubImage3D}
-         * @requires_gl45 Extension @extension{ARB,direct_state_access}
-         * @requires_gl In OpenGL ES and WebGL you need to set image for each
-         *      face separately.
+         * Useful for uploading all faces of a mip level from KTX or DDS data,
+         * where the faces are stored one after another. If
+         * @extension{ARB,direct_state_access} (part of OpenGL 4.5) is
+         * available, the upload is done with a single
+         * @fn_gl{CompressedTextureSubImage3D} call, otherwise the function
+         * turns into a sequence of @fn_gl{CompressedTexSubImage2D} calls, one
+         * for each face. In that case the faces are expected to be tightly
+         * packed, i.e. each of them occupying the same amount of data.
+         * @see @ref setStorage(), @ref setCompressedSubImage(CubeMapCoordinate, Int, const Vector2i&, const CompressedImageView2D&),
+         *      @fn_gl2{CompressedTextureSubImage3D,CompressedTexSubImage3D},
+         *      eventually @fn_gl{ActiveTexture}, @fn_gl{BindTexture} and
+         *      @fn_gl{CompressedTexSubImage2D}
          */
         CubeMapTexture& setCompressedSubImage(Int level, const Vector3i& offset, const CompressedImageView3D& image);
 
+        #ifndef MAGNUM_TARGET_GLES2
         /** @overload
-         * @requires_gl45 Extension @extension{ARB,direct_state_access}
-         * @requires_gl In OpenGL ES and WebGL you need to set image for each
-         *      face separately.
+         * @requires_gles30 Pixel buffer objects are not available in OpenGL
+         *      ES 2.0.
+         * @requires_webgl20 Pixel buffer objects are not available in WebGL
+         *      1.0.
          */
         CubeMapTexture& setCompressedSubImage(Int level, const Vector3i& offset, CompressedBufferImage3D& image);
 
         /** @overload
-         * @requires_gl45 Extension @extension{ARB,direct_state_access}
-         * @requires_gl In OpenGL ES and WebGL you need to set image for each
-         *      face separately.
+         * @requires_gles30 Pixel buffer objects are not available in OpenGL
+         *      ES 2.0.
+         * @requires_webgl20 Pixel buffer objects are not available in WebGL
+         *      1.0.
          */
         CubeMapTexture& setCompressedSubImage(Int level, const Vector3i& offset, CompressedBufferImage3D&& image) {
             return setCompressedSubImage(level, offset, image);
@@ -1116,6 +1154,16 @@ class MAGNUM_EXPORT CubeMapTexture: public AbstractTexture {
         #endif
 
         void MAGNUM_LOCAL compressedSubImageImplementationDefault(CubeMapCoordinate coordinate, GLint level, const Vector2i& offset, const Vector2i& size, CompressedPixelFormat format, const GLvoid* data, GLsizei dataSize);
+
+        void MAGNUM_LOCAL subImage3DImplementationSliced(GLint level, const Vector3i& offset, const Vector3i& size, PixelFormat format, PixelType type, const GLvoid* data, const PixelStorage& storage);
+        #ifndef MAGNUM_TARGET_GLES
+        void MAGNUM_LOCAL subImage3DImplementationDSA(GLint level, const Vector3i& offset, const Vector3i& size, PixelFormat format, PixelType type, const GLvoid* data, const PixelStorage& storage);
+        #endif
+
+        void MAGNUM_LOCAL compressedSubImage3DImplementationSliced(GLint level, const Vector3i& offset, const Vector3i& size, CompressedPixelFormat format, const GLvoid* data, GLsizei dataSize);
+        #ifndef MAGNUM_TARGET_GLES
+        void MAGNUM_LOCAL compressedSubImage3DImplementationDSA(GLint level, const Vector3i& offset, const Vector3i& size, CompressedPixelFormat format, const GLvoid* data, GLsizei dataSize);
+        #endif
         #ifndef MAGNUM_TARGET_GLES
         void MAGNUM_LOCAL compressedSubImageImplementationDSA(CubeMapCoordinate coordinate, GLint level, const Vector2i& offset, const Vector2i& size, CompressedPixelFormat format, const GLvoid* data, GLsizei dataSize);
         void MAGNUM_LOCAL compressedSubImageImplementationDSAEXT(CubeMapCoordinate coordinate, GLint level, const Vector2i& offset, const Vector2i& size, CompressedPixelFormat format, const GLvoid* data, GLsizei dataSize);
@@ -69,6 +69,15 @@ for(std::size_t i = 0; i != 4; i += 6) {
 texture.generateMipmap();
 @endcode
 
+The Z coordinate of @ref setSubImage() spans all layers and faces, so if the
+data are contiguous (such as a mip level imported from a KTX or DDS file), all
+faces of one or more layers can be uploaded with a single call instead of
+face-by-face:
+@code
+ImageView3D layers{PixelFormat::RGBA, PixelType::UnsignedByte, {64, 64, 24}, data};
+texture.setSubImage(0, {}, layers);
+@endcode
+
 In shader, the texture is used via `samplerCubeArray`, `samplerCubeArrayShadow`,
 `isamplerCubeArray` or `usamplerCubeArray`. Unlike in classic textures,
 coordinates for cube map texture arrays is signed four-part vector. First three
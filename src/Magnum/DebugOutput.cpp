@@ -54,6 +54,14 @@ callbackWrapper(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei
 
 void defaultCallback(const DebugOutput::Source source, const DebugOutput::Type type, const UnsignedInt id, const DebugOutput::Severity severity, const std::string& string, const void*) {
     Debug output;
+    Implementation::printDebugOutputMessage(output, source, type, id, severity, string);
+}
+
+}
+
+namespace Implementation {
+
+void printDebugOutputMessage(Debug& output, const DebugOutput::Source source, const DebugOutput::Type type, const UnsignedInt id, const DebugOutput::Severity severity, const std::string& string) {
     output << "Debug output:";
 
     switch(severity) {
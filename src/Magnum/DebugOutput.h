@@ -75,7 +75,9 @@ control the output at even finer granularity using @ref setEnabled().
 You can gather the messages either through graphics debugger or in the
 application itself by setting up message callback using @ref setCallback() or
 @ref setDefaultCallback(). You might also want to enable
-@ref Renderer::Feature::DebugOutputSynchronous. Example usage, completely with
+@ref Renderer::Feature::DebugOutputSynchronous. For low-overhead processing
+of the messages once per frame see @ref DebugOutputQueue. Example usage,
+completely with
 @ref DebugGroup and @link DebugMessage @endlink:
 
 @code
@@ -402,6 +404,8 @@ class MAGNUM_EXPORT DebugOutput {
          * @endcode
          *
          * > Debug output: application marker (1337): Hello from OpenGL command stream!
+         *
+         * @see @ref DebugOutputQueue
          */
         static void setDefaultCallback();
 
@@ -0,0 +1,210 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DebugOutputQueue.h"
+
+#include <atomic>
+#include <cstring>
+#include <sstream>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Context.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Implementation/State.h"
+#include "Magnum/Implementation/DebugState.h"
+
+namespace Magnum {
+
+namespace {
+    enum: std::size_t { EntryCount = 256 };
+
+    /* Key of the deduplication table, zero is used for an empty entry.
+       Source and type values fit into 16 bits. */
+    UnsignedLong messageKey(const DebugOutput::Source source, const DebugOutput::Type type, const UnsignedInt id) {
+        return (UnsignedLong(GLenum(source) & 0xffff) << 48)|(UnsignedLong(GLenum(type) & 0xffff) << 32)|id;
+    }
+
+    void callback(const DebugOutput::Source source, const DebugOutput::Type type, const UnsignedInt id, const DebugOutput::Severity severity, const std::string& string, const void* userParam) {
+        static_cast<DebugOutputQueue*>(const_cast<void*>(userParam))->push(source, type, id, severity, {string.data(), string.size()});
+    }
+
+    void defaultCallback(const DebugOutput::Source source, const DebugOutput::Type type, const UnsignedInt id, const DebugOutput::Severity severity, const std::string& string, const UnsignedInt count, const void*) {
+        Debug output;
+        Implementation::printDebugOutputMessage(output, source, type, id, severity, string);
+        if(count > 1) output << "(repeated" << count << "times)";
+    }
+}
+
+/* Bounded multi-producer single-consumer queue, each slot has a sequence
+   number telling whether it's free for the producer at given position or
+   filled for the consumer */
+struct DebugOutputQueue::State {
+    struct Slot {
+        std::atomic<std::size_t> sequence;
+        DebugOutput::Source source;
+        DebugOutput::Type type;
+        UnsignedInt id;
+        DebugOutput::Severity severity;
+        std::size_t entry;
+        std::size_t length;
+        char message[MaxMessageLength];
+    };
+
+    struct Entry {
+        std::atomic<UnsignedLong> key;
+        std::atomic<UnsignedInt> count;
+    };
+
+    explicit State(std::size_t capacity);
+
+    std::unique_ptr<Slot[]> slots;
+    std::size_t mask;
+    std::atomic<std::size_t> enqueuePosition;
+    std::size_t dequeuePosition;
+
+    Entry entries[EntryCount];
+    std::atomic<UnsignedInt> dropped;
+};
+
+DebugOutputQueue::State::State(std::size_t capacity): enqueuePosition{0}, dequeuePosition{0}, dropped{0} {
+    std::size_t size = 1;
+    while(size < capacity) size <<= 1;
+    slots.reset(new Slot[size]);
+    mask = size - 1;
+    for(std::size_t i = 0; i != size; ++i)
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+    for(Entry& entry: entries) {
+        entry.key.store(0, std::memory_order_relaxed);
+        entry.count.store(0, std::memory_order_relaxed);
+    }
+}
+
+DebugOutputQueue::DebugOutputQueue(const std::size_t capacity): _state{new State{capacity}} {}
+
+DebugOutputQueue::~DebugOutputQueue() {
+    if(Context::hasCurrent() && Context::current().state().debug->messageCallback == callback)
+        DebugOutput::setCallback(nullptr);
+}
+
+std::size_t DebugOutputQueue::capacity() const { return _state->mask + 1; }
+
+void DebugOutputQueue::install() {
+    DebugOutput::setCallback(callback, this);
+}
+
+void DebugOutputQueue::push(const DebugOutput::Source source, const DebugOutput::Type type, const UnsignedInt id, const DebugOutput::Severity severity, const Containers::ArrayView<const char> message) {
+    State& state = *_state;
+
+    /* Find or claim the deduplication entry. If the message is already
+       queued, just count it. */
+    const UnsignedLong key = messageKey(source, type, id);
+    std::size_t entry = EntryCount;
+    for(std::size_t i = 0, hash = std::size_t((key*11400714819323198485ull) >> 56); i != EntryCount; ++i) {
+        State::Entry& e = state.entries[(hash + i) & (EntryCount - 1)];
+        UnsignedLong current = e.key.load(std::memory_order_acquire);
+        if(!current && e.key.compare_exchange_strong(current, key, std::memory_order_acq_rel))
+            current = key;
+        if(current != key) continue;
+
+        if(e.count.fetch_add(1, std::memory_order_acq_rel)) return;
+        entry = (hash + i) & (EntryCount - 1);
+        break;
+    }
+
+    /* Claim a free slot */
+    State::Slot* slot;
+    std::size_t position = state.enqueuePosition.load(std::memory_order_relaxed);
+    for(;;) {
+        slot = &state.slots[position & state.mask];
+        const std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        const std::ptrdiff_t difference = std::ptrdiff_t(sequence) - std::ptrdiff_t(position);
+        if(difference == 0) {
+            if(state.enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                break;
+        } else if(difference < 0) {
+            /* Full, drop the message. Reset its count so the next one gets
+               queued again. */
+            if(entry != EntryCount)
+                state.entries[entry].count.store(0, std::memory_order_release);
+            state.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else position = state.enqueuePosition.load(std::memory_order_relaxed);
+    }
+
+    slot->source = source;
+    slot->type = type;
+    slot->id = id;
+    slot->severity = severity;
+    slot->entry = entry;
+    slot->length = Math::min(message.size(), std::size_t(MaxMessageLength));
+    std::memcpy(slot->message, message.data(), slot->length);
+    slot->sequence.store(position + 1, std::memory_order_release);
+}
+
+std::size_t DebugOutputQueue::drain(const Callback callback, const void* const userParam) {
+    State& state = *_state;
+
+    std::size_t count = 0;
+    std::string message;
+    for(;; ++count) {
+        State::Slot& slot = state.slots[state.dequeuePosition & state.mask];
+        if(slot.sequence.load(std::memory_order_acquire) != state.dequeuePosition + 1)
+            break;
+
+        const DebugOutput::Source source = slot.source;
+        const DebugOutput::Type type = slot.type;
+        const UnsignedInt id = slot.id;
+        const DebugOutput::Severity severity = slot.severity;
+        message.assign(slot.message, slot.length);
+
+        /* Take the repeat count. Any later message with the same key will be
+           queued again. */
+        UnsignedInt repeated = 1;
+        if(slot.entry != EntryCount)
+            repeated = Math::max(state.entries[slot.entry].count.exchange(0, std::memory_order_acq_rel), 1u);
+
+        /* Release the slot before calling the callback, so it can be
+           refilled already */
+        slot.sequence.store(state.dequeuePosition + state.mask + 1, std::memory_order_release);
+        ++state.dequeuePosition;
+
+        callback(source, type, id, severity, message, repeated, userParam);
+    }
+
+    if(const UnsignedInt dropped = state.dropped.exchange(0, std::memory_order_relaxed)) {
+        std::ostringstream out;
+        out << "DebugOutputQueue: " << dropped << " messages dropped, queue full";
+        callback(DebugOutput::Source::Application, DebugOutput::Type::Other, 0, DebugOutput::Severity::Notification, out.str(), 1, userParam);
+        ++count;
+    }
+
+    return count;
+}
+
+std::size_t DebugOutputQueue::drain() {
+    return drain(defaultCallback);
+}
+
+}
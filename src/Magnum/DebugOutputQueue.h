@@ -0,0 +1,185 @@
+#ifndef Magnum_DebugOutputQueue_h
+#define Magnum_DebugOutputQueue_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_WEBGL
+/** @file
+ * @brief Class @ref Magnum::DebugOutputQueue
+ */
+#endif
+
+#include <memory>
+#include <string>
+
+#include "Magnum/DebugOutput.h"
+
+#ifndef MAGNUM_TARGET_WEBGL
+namespace Magnum {
+
+/**
+@brief Asynchronous debug output queue
+
+@ref DebugOutput::setDefaultCallback() prints each message right when the
+driver emits it, which is expensive for drivers flooding the output with the
+same message and practically requires
+@ref Renderer::Feature::DebugOutputSynchronous to be useful. This class
+instead installs a callback that only copies the message into a fixed-size
+lock-free ring buffer, and the messages are processed later on the
+application thread by calling @ref drain(), usually once per frame. That
+makes it cheap enough to keep debug output enabled also in production builds.
+
+## Usage
+
+@code
+Renderer::enable(Renderer::Feature::DebugOutput);
+
+DebugOutputQueue queue;
+queue.install();
+
+// each frame
+// draw the scene ...
+queue.drain();
+@endcode
+
+## Deduplication
+
+Messages with the same source, type and ID that arrive while the previous one
+is still in the queue aren't added again, only counted. @ref drain() then
+reports the message once, together with the count. Up to 256 distinct
+source/type/ID combinations are deduplicated, messages beyond that are queued
+each separately.
+
+If the queue is full, new messages are dropped and their count is reported
+by the next @ref drain(). Messages longer than @ref MaxMessageLength are
+truncated.
+
+## Thread safety
+
+The callback can be called from any thread, as is the case with asynchronous
+debug output. @ref drain() is expected to be called from a single thread
+only.
+
+@requires_gles Debug output is not available in WebGL.
+*/
+class MAGNUM_EXPORT DebugOutputQueue {
+    public:
+        /**
+         * @brief Callback for drained messages
+         *
+         * Same as @ref DebugOutput::Callback, with an additional parameter
+         * containing the count of times the message was received.
+         */
+        typedef void(*Callback)(DebugOutput::Source, DebugOutput::Type, UnsignedInt, DebugOutput::Severity, const std::string&, UnsignedInt, const void*);
+
+        enum: std::size_t {
+            /** Maximal stored message length, longer messages are truncated */
+            MaxMessageLength = 256
+        };
+
+        /**
+         * @brief Constructor
+         * @param capacity  Maximal count of queued messages, rounded up to
+         *      next power of two
+         *
+         * The callback isn't installed yet, use @ref install() for that.
+         */
+        explicit DebugOutputQueue(std::size_t capacity = 256);
+
+        /** @brief Copying is not allowed */
+        DebugOutputQueue(const DebugOutputQueue&) = delete;
+
+        /** @brief Moving is not allowed */
+        DebugOutputQueue(DebugOutputQueue&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * If the queue is installed as the current callback, resets the
+         * callback.
+         */
+        ~DebugOutputQueue();
+
+        /** @brief Copying is not allowed */
+        DebugOutputQueue& operator=(const DebugOutputQueue&) = delete;
+
+        /** @brief Moving is not allowed */
+        DebugOutputQueue& operator=(DebugOutputQueue&&) = delete;
+
+        /** @brief Queue capacity */
+        std::size_t capacity() const;
+
+        /**
+         * @brief Install the queue as debug output callback
+         *
+         * Replaces any previously set callback.
+         * @see @ref DebugOutput::setCallback()
+         */
+        void install();
+
+        /**
+         * @brief Add message to the queue
+         *
+         * Called from the installed callback, but can be also used to insert
+         * application messages without going through the GL. Doesn't
+         * allocate and doesn't block, safe to call from multiple threads at
+         * once.
+         */
+        void push(DebugOutput::Source source, DebugOutput::Type type, UnsignedInt id, DebugOutput::Severity severity, Containers::ArrayView<const char> message);
+
+        /**
+         * @brief Process queued messages
+         * @return Count of distinct messages processed
+         *
+         * Calls @p callback for each queued message in the order they
+         * arrived and empties the queue. If any messages were dropped
+         * because the queue was full, their count is added as a last message
+         * with @ref DebugOutput::Source::Application,
+         * @ref DebugOutput::Type::Other and ID @cpp 0 @ce.
+         */
+        std::size_t drain(Callback callback, const void* userParam = nullptr);
+
+        /**
+         * @brief Print queued messages
+         *
+         * Prints the messages in the same format as
+         * @ref DebugOutput::setDefaultCallback(), appending the repeat count
+         * if the message was received more than once:
+         *
+         * > Debug output: API performance note (131218): Program/shader state performance warning (repeated 120 times)
+         */
+        std::size_t drain();
+
+    private:
+        struct State;
+        std::unique_ptr<State> _state;
+};
+
+}
+#else
+#error this header is not available in WebGL build
+#endif
+
+#endif
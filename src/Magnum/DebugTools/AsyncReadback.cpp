@@ -0,0 +1,121 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "AsyncReadback.h"
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/DebugTools/TextureImage.h"
+
+namespace Magnum { namespace DebugTools {
+
+AsyncReadback::AsyncReadback():
+    #ifndef MAGNUM_TARGET_GLES
+    _sync{Context::current().isExtensionSupported<Extensions::GL::ARB::sync>()}
+    #else
+    _sync{true}
+    #endif
+    {}
+
+AsyncReadback::~AsyncReadback() {
+    for(Request& request: _requests) if(request.fence) glDeleteSync(request.fence);
+}
+
+AsyncReadback& AsyncReadback::bufferSubData(Buffer& buffer, const GLintptr offset, const GLsizeiptr size, BufferCallback callback) {
+    Buffer staging{Buffer::TargetHint::CopyWrite};
+    staging.setData({nullptr, std::size_t(size)}, BufferUsage::StreamRead);
+    Buffer::copy(buffer, staging, offset, 0, size);
+
+    _requests.emplace_back(std::move(staging), size, std::move(callback));
+    fence(_requests.back());
+    return *this;
+}
+
+AsyncReadback& AsyncReadback::textureSubImage(Texture2D& texture, const Int level, const Range2Di& range, const PixelFormat format, const PixelType type, ImageCallback callback) {
+    _requests.emplace_back(DebugTools::textureSubImage(texture, level, range, BufferImage2D{format, type}, BufferUsage::StreamRead), std::move(callback));
+    fence(_requests.back());
+    return *this;
+}
+
+AsyncReadback& AsyncReadback::textureSubImage(CubeMapTexture& texture, const CubeMapCoordinate coordinate, const Int level, const Range2Di& range, const PixelFormat format, const PixelType type, ImageCallback callback) {
+    _requests.emplace_back(DebugTools::textureSubImage(texture, coordinate, level, range, BufferImage2D{format, type}, BufferUsage::StreamRead), std::move(callback));
+    fence(_requests.back());
+    return *this;
+}
+
+void AsyncReadback::fence(Request& request) {
+    if(_sync) request.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+std::size_t AsyncReadback::deliver(const bool wait) {
+    std::size_t count = 0;
+    while(!_requests.empty()) {
+        Request& request = _requests.front();
+
+        /* Flush so the fence gets signaled eventually, stop at the first
+           unfinished transfer unless waiting. Without fences mapping the
+           buffer waits for the GL. */
+        if(request.fence) {
+            GLenum result = glClientWaitSync(request.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+            if(result == GL_TIMEOUT_EXPIRED) {
+                if(!wait) break;
+
+                do result = glClientWaitSync(request.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+                while(result == GL_TIMEOUT_EXPIRED);
+            }
+
+            glDeleteSync(request.fence);
+            request.fence = nullptr;
+        }
+
+        /* Pop the request before calling the callback so it can schedule
+           new transfers */
+        Request delivered{std::move(request)};
+        _requests.pop_front();
+
+        if(delivered.image) {
+            BufferImage2D& image = *delivered.image;
+            const std::size_t dataSize = image.dataSize();
+            const char* const data = dataSize ? image.buffer().map<const char>(0, dataSize, Buffer::MapFlag::Read) : nullptr;
+            delivered.imageCallback(ImageView2D{image.storage(), image.format(), image.type(), image.size(), {data, dataSize}});
+            if(data) CORRADE_INTERNAL_ASSERT_OUTPUT(image.buffer().unmap());
+        } else {
+            const char* const data = delivered.size ? delivered.buffer.map<const char>(0, delivered.size, Buffer::MapFlag::Read) : nullptr;
+            delivered.bufferCallback({data, delivered.size});
+            if(data) CORRADE_INTERNAL_ASSERT_OUTPUT(delivered.buffer.unmap());
+        }
+
+        ++count;
+    }
+
+    return count;
+}
+
+}}
+#endif
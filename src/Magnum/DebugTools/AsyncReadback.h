@@ -0,0 +1,212 @@
+#ifndef Magnum_DebugTools_AsyncReadback_h
+#define Magnum_DebugTools_AsyncReadback_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+/** @file
+ * @brief Class @ref Magnum::DebugTools::AsyncReadback
+ */
+#endif
+
+#include <deque>
+#include <functional>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Buffer.h"
+#include "Magnum/BufferImage.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/DebugTools/visibility.h"
+
+#include "MagnumExternal/Optional/optional.hpp"
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+namespace Magnum { namespace DebugTools {
+
+/**
+@brief Asynchronous buffer and texture readback
+
+Unlike @ref bufferSubData() and @ref textureSubImage(), which map the buffer or
+read the framebuffer right away and thus wait until the GL finishes all
+commands writing to it, this class only schedules the transfer and delivers
+the data later through a callback:
+
+-   @ref bufferSubData() and @ref bufferData() copy the data into a staging
+    buffer using @ref Buffer::copy()
+-   @ref textureSubImage() reads the texture into a @ref BufferImage2D using
+    @ref DebugTools::textureSubImage(Texture2D&, Int, const Range2Di&, BufferImage2D&, BufferUsage)
+
+A fence is placed after each transfer and @ref poll(), called for example once
+every frame, invokes callbacks of all transfers that the GL finished, in the
+order they were scheduled. The data passed to the callback are valid only
+during the call. Example usage:
+@code
+DebugTools::AsyncReadback readback;
+
+// after the draw
+readback.bufferData(transformFeedbackBuffer, [](Containers::ArrayView<const char> data) {
+    validate(Containers::arrayCast<const Vector3>(data));
+});
+
+// each frame
+readback.poll();
+@endcode
+
+If @extension{ARB,sync} (part of OpenGL 3.2) is not available, @ref poll()
+has no way to know whether a transfer is finished and delivers all pending
+transfers, possibly waiting for the GL. Fences are always available in OpenGL
+ES 3.0.
+
+@requires_gl31 Extension @extension{ARB,copy_buffer}
+@requires_gles30 Buffer copying and pixel buffer objects are not available in
+    OpenGL ES 2.0.
+@requires_gles Buffer mapping is not available in WebGL.
+*/
+class MAGNUM_DEBUGTOOLS_EXPORT AsyncReadback {
+    public:
+        /** @brief Buffer data callback */
+        typedef std::function<void(Containers::ArrayView<const char>)> BufferCallback;
+
+        /** @brief Image callback */
+        typedef std::function<void(const ImageView2D&)> ImageCallback;
+
+        explicit AsyncReadback();
+
+        /** @brief Copying is not allowed */
+        AsyncReadback(const AsyncReadback&) = delete;
+
+        /** @brief Moving is not allowed */
+        AsyncReadback(AsyncReadback&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Callbacks of pending transfers are not called.
+         * @see @ref finish(), @fn_gl{DeleteSync}
+         */
+        ~AsyncReadback();
+
+        /** @brief Copying is not allowed */
+        AsyncReadback& operator=(const AsyncReadback&) = delete;
+
+        /** @brief Moving is not allowed */
+        AsyncReadback& operator=(AsyncReadback&&) = delete;
+
+        /** @brief Count of transfers whose callbacks weren't called yet */
+        std::size_t pendingCount() const { return _requests.size(); }
+
+        /**
+         * @brief Schedule buffer subdata readback
+         * @param buffer    Buffer to read
+         * @param offset    Offset in the buffer, in bytes
+         * @param size      Data size, in bytes
+         * @param callback  Callback to which the data are passed
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Buffer::copy(), @fn_gl{FenceSync}
+         */
+        AsyncReadback& bufferSubData(Buffer& buffer, GLintptr offset, GLsizeiptr size, BufferCallback callback);
+
+        /**
+         * @brief Schedule buffer data readback
+         * @return Reference to self (for method chaining)
+         *
+         * Same as calling @ref bufferSubData() with zero offset and
+         * @ref Buffer::size() as size.
+         */
+        AsyncReadback& bufferData(Buffer& buffer, BufferCallback callback) {
+            return bufferSubData(buffer, 0, buffer.size(), std::move(callback));
+        }
+
+        /**
+         * @brief Schedule texture subimage readback
+         * @param texture   Texture to read
+         * @param level     Mip level
+         * @param range     Range to read
+         * @param format    Format of pixel data
+         * @param type      Data type of pixel data
+         * @param callback  Callback to which the image is passed
+         * @return Reference to self (for method chaining)
+         *
+         * The same restrictions on @p format and @p type as in
+         * @ref DebugTools::textureSubImage() apply.
+         * @see @fn_gl{FenceSync}
+         */
+        AsyncReadback& textureSubImage(Texture2D& texture, Int level, const Range2Di& range, PixelFormat format, PixelType type, ImageCallback callback);
+
+        /**
+         * @brief Schedule cube map texture subimage readback
+         * @return Reference to self (for method chaining)
+         *
+         * Similar to the above, but for given cube map coordinate.
+         */
+        AsyncReadback& textureSubImage(CubeMapTexture& texture, CubeMapCoordinate coordinate, Int level, const Range2Di& range, PixelFormat format, PixelType type, ImageCallback callback);
+
+        /**
+         * @brief Deliver finished transfers
+         * @return Count of delivered transfers
+         *
+         * Calls callbacks of all transfers the GL finished, in the order they
+         * were scheduled. Stops at the first unfinished transfer, never
+         * waits for the GL if fences are available.
+         * @see @fn_gl{ClientWaitSync}, @fn_gl{DeleteSync}
+         */
+        std::size_t poll() { return deliver(false); }
+
+        /**
+         * @brief Deliver all pending transfers
+         * @return Count of delivered transfers
+         *
+         * Unlike @ref poll() waits until the GL finishes all pending
+         * transfers.
+         */
+        std::size_t finish() { return deliver(true); }
+
+    private:
+        struct Request {
+            explicit Request(Buffer&& buffer, std::size_t size, BufferCallback bufferCallback): buffer{std::move(buffer)}, size{size}, bufferCallback{std::move(bufferCallback)}, fence{} {}
+            explicit Request(BufferImage2D&& image, ImageCallback imageCallback): buffer{NoCreate}, size{}, image{std::move(image)}, imageCallback{std::move(imageCallback)}, fence{} {}
+
+            Buffer buffer;
+            std::size_t size;
+            BufferCallback bufferCallback;
+            std::optional<BufferImage2D> image;
+            ImageCallback imageCallback;
+            GLsync fence;
+        };
+
+        void fence(Request& request);
+        std::size_t deliver(bool wait);
+
+        std::deque<Request> _requests;
+        bool _sync;
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 and WebGL builds
+#endif
+
+#endif
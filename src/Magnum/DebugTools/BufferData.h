@@ -47,7 +47,9 @@ namespace Implementation {
 @brief Buffer subdata
 
 Emulates @ref Buffer::subData() call on platforms that don't support it (such
-as OpenGL ES) by using @ref Buffer::map().
+as OpenGL ES) by using @ref Buffer::map(). Mapping the buffer waits until the
+GL finishes all commands writing to it, use @ref AsyncReadback to read the data
+without stalling the pipeline.
 @requires_gles30 Extension @es_extension{EXT,map_buffer_range} in OpenGL ES
     2.0.
 @requires_gles Buffer mapping is not available in WebGL.
@@ -0,0 +1,224 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "CommandCapture.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <sstream>
+#include <Corrade/Utility/Debug.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/Context.h"
+
+namespace Magnum { namespace DebugTools {
+
+namespace {
+    struct TraceHeader {
+        char magic[4];
+        UnsignedInt version;
+        UnsignedInt eventSize;
+    };
+
+    /* Padded to 24 bytes, written as-is */
+    struct TraceEvent {
+        UnsignedLong time;
+        UnsignedLong size;
+        UnsignedInt object;
+        UnsignedByte command;
+        UnsignedByte redundant;
+        UnsignedShort padding;
+    };
+
+    static_assert(sizeof(TraceEvent) == 24, "unexpected trace event size");
+
+    constexpr const char TraceMagic[] = {'M', 'G', 'C', 'T'};
+    constexpr UnsignedInt TraceVersion = 1;
+
+    constexpr const char* CommandNames[]{
+        "Draw calls",
+        "Buffer uploads",
+        "Texture binds",
+        "Program switches",
+        "State changes"
+    };
+
+    constexpr std::size_t CommandCount = 5;
+}
+
+std::optional<std::vector<CommandCapture::Event>> CommandCapture::events(const Containers::ArrayView<const char> trace) {
+    TraceHeader header;
+    if(trace.size() < sizeof(TraceHeader)) return std::nullopt;
+    std::memcpy(&header, trace.data(), sizeof(TraceHeader));
+    if(std::memcmp(header.magic, TraceMagic, sizeof(TraceMagic)) != 0 ||
+       header.version != TraceVersion || header.eventSize != sizeof(TraceEvent) ||
+       (trace.size() - sizeof(TraceHeader)) % sizeof(TraceEvent))
+        return std::nullopt;
+
+    const std::size_t count = (trace.size() - sizeof(TraceHeader))/sizeof(TraceEvent);
+    std::vector<Event> out;
+    out.reserve(count);
+    for(std::size_t i = 0; i != count; ++i) {
+        TraceEvent event;
+        std::memcpy(&event, trace.data() + sizeof(TraceHeader) + i*sizeof(TraceEvent), sizeof(TraceEvent));
+        if(event.command > CommandCount) return std::nullopt;
+        out.push_back({event.time, event.size, event.object, Command(event.command), event.redundant != 0});
+    }
+
+    return std::move(out);
+}
+
+std::optional<CommandCapture::Summary> CommandCapture::summarize(const Containers::ArrayView<const char> trace, const std::size_t hotspotCount) {
+    const std::optional<std::vector<Event>> events = CommandCapture::events(trace);
+    if(!events) return std::nullopt;
+
+    Summary summary{};
+    std::map<std::pair<UnsignedByte, UnsignedInt>, Statistics> objects;
+    for(std::size_t i = 0; i != events->size(); ++i) {
+        const Event& event = (*events)[i];
+        if(!UnsignedByte(event.command)) {
+            ++summary.frameCount;
+            continue;
+        }
+
+        /* Time until the next event, the last one has none */
+        const UnsignedLong time = i + 1 < events->size() && (*events)[i + 1].time > event.time ?
+            (*events)[i + 1].time - event.time : 0;
+
+        for(Statistics* statistics: {&summary.commands[UnsignedByte(event.command) - 1], &objects[{UnsignedByte(event.command), event.object}]}) {
+            ++statistics->count;
+            if(event.redundant) ++statistics->redundant;
+            statistics->size += event.size;
+            statistics->time += time;
+        }
+    }
+
+    if(!events->empty()) summary.duration = events->back().time - events->front().time;
+
+    summary.hotspots.reserve(objects.size());
+    for(const auto& object: objects)
+        summary.hotspots.push_back({Command(object.first.first), object.first.second, object.second});
+    std::stable_sort(summary.hotspots.begin(), summary.hotspots.end(), [](const Hotspot& a, const Hotspot& b) {
+        return a.statistics.time > b.statistics.time;
+    });
+    if(summary.hotspots.size() > hotspotCount)
+        summary.hotspots.erase(summary.hotspots.begin() + hotspotCount, summary.hotspots.end());
+
+    return std::move(summary);
+}
+
+std::string CommandCapture::Summary::text() const {
+    std::ostringstream out;
+    out << "Frames: " << frameCount << ", duration: " << duration/1000 << " us\n";
+
+    const UnsignedLong frames = std::max(frameCount, UnsignedLong(1));
+    for(std::size_t i = 0; i != CommandCount; ++i) {
+        const Statistics& statistics = commands[i];
+        out << CommandNames[i] << ": " << statistics.count
+            << " (" << statistics.count/frames << " per frame, "
+            << statistics.redundant << " redundant";
+        if(statistics.size && i == UnsignedByte(Command::BufferUpload) - 1)
+            out << ", " << statistics.size << " B";
+        out << ", " << statistics.time/1000 << " us)\n";
+    }
+
+    out << "Hotspots:";
+    for(const Hotspot& hotspot: hotspots) {
+        out << "\n  " << CommandNames[UnsignedByte(hotspot.command) - 1]
+            << ", object " << hotspot.object << ": " << hotspot.statistics.count
+            << " (" << hotspot.statistics.redundant << " redundant, "
+            << hotspot.statistics.time/1000 << " us)";
+    }
+
+    return out.str();
+}
+
+CommandCapture::CommandCapture(): _start{std::chrono::steady_clock::now()}, _frameCount{} {}
+
+CommandCapture::~CommandCapture() {
+    if(Context::hasCurrent() && isCapturing()) stop();
+}
+
+bool CommandCapture::isCapturing() const {
+    return CommandObserver::current() == this;
+}
+
+void CommandCapture::start() {
+    if(_events.empty()) _start = std::chrono::steady_clock::now();
+    CommandObserver::setCurrent(this);
+}
+
+void CommandCapture::stop() {
+    CommandObserver::setCurrent(nullptr);
+}
+
+void CommandCapture::nextFrame() {
+    _events.push_back({now(), 0, 0, Command(0), false});
+    ++_frameCount;
+}
+
+void CommandCapture::clear() {
+    _events.clear();
+    _frameCount = 0;
+    _start = std::chrono::steady_clock::now();
+}
+
+UnsignedLong CommandCapture::now() const {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start).count();
+}
+
+void CommandCapture::doRecord(const Command command, const UnsignedInt object, const UnsignedLong size, const bool redundant) {
+    _events.push_back({now(), size, object, command, redundant});
+}
+
+Containers::Array<char> CommandCapture::trace() const {
+    Containers::Array<char> data{Containers::ValueInit, sizeof(TraceHeader) + _events.size()*sizeof(TraceEvent)};
+
+    TraceHeader header;
+    std::memcpy(header.magic, TraceMagic, sizeof(TraceMagic));
+    header.version = TraceVersion;
+    header.eventSize = sizeof(TraceEvent);
+    std::memcpy(data.data(), &header, sizeof(TraceHeader));
+
+    for(std::size_t i = 0; i != _events.size(); ++i) {
+        const Event& event = _events[i];
+        const TraceEvent traceEvent{event.time, event.size, event.object, UnsignedByte(event.command), UnsignedByte(event.redundant), 0};
+        std::memcpy(data.data() + sizeof(TraceHeader) + i*sizeof(TraceEvent), &traceEvent, sizeof(TraceEvent));
+    }
+
+    return data;
+}
+
+bool CommandCapture::save(const std::string& filename) const {
+    if(!Utility::Directory::write(filename, trace())) {
+        Error() << "DebugTools::CommandCapture::save(): cannot write to" << filename;
+        return false;
+    }
+
+    return true;
+}
+
+}}
@@ -0,0 +1,233 @@
+#ifndef Magnum_DebugTools_CommandCapture_h
+#define Magnum_DebugTools_CommandCapture_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::DebugTools::CommandCapture
+ */
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/CommandObserver.h"
+#include "Magnum/DebugTools/visibility.h"
+#include "MagnumExternal/Optional/optional.hpp"
+
+namespace Magnum { namespace DebugTools {
+
+/**
+@brief OpenGL command stream capture
+
+Records the per-frame sequence of draw calls, buffer uploads, texture binds,
+shader program switches and renderer state changes going through the engine
+state tracker (see @ref CommandObserver for details), together with object
+IDs, sizes and CPU timestamps, into a compact binary trace. The trace can be
+saved on a customer machine and analyzed offline with @ref summarize() or
+the @ref magnum-commandtrace "magnum-commandtrace" utility. Example usage:
+@code
+DebugTools::CommandCapture capture;
+capture.start();
+
+// each frame
+// draw the scene ...
+capture.nextFrame();
+
+// after capturing a few frames
+capture.stop();
+capture.save("trace.bin");
+@endcode
+
+## Trace analysis
+
+The summary contains totals for each command type including count of
+commands filtered out as redundant by the state tracker, which points to
+code doing unnecessary state changes, and a list of hotspots --- object and
+command combinations that took the most time. The time of a command is
+measured on CPU from its recording to the recording of the next command, so
+it includes also the time the application spent between the two commands.
+
+## Trace format
+
+The trace starts with a 12-byte header containing `MGCT` magic, version and
+size of one event, followed by 24-byte events, each containing timestamp in
+nanoseconds, command size, object ID, command and redundancy flag. Frame
+boundaries are stored as events with command @cpp 0 @ce.
+*/
+class MAGNUM_DEBUGTOOLS_EXPORT CommandCapture: public CommandObserver {
+    public:
+        /** @brief Trace event */
+        struct Event {
+            UnsignedLong time;      /**< @brief Time since start in nanoseconds */
+            UnsignedLong size;      /**< @brief Command size */
+            UnsignedInt object;     /**< @brief Object ID */
+
+            /**
+             * @brief Command
+             *
+             * @cpp 0 @ce for frame boundaries.
+             */
+            Command command;
+
+            bool redundant;         /**< @brief Whether the command was redundant */
+        };
+
+        /** @brief Statistics of one command type or object */
+        struct Statistics {
+            UnsignedLong count;     /**< @brief Command count */
+            UnsignedLong redundant; /**< @brief Redundant command count */
+            UnsignedLong size;      /**< @brief Total command size */
+            UnsignedLong time;      /**< @brief Total time in nanoseconds */
+        };
+
+        /** @brief Trace hotspot */
+        struct Hotspot {
+            Command command;        /**< @brief Command */
+            UnsignedInt object;     /**< @brief Object ID */
+            Statistics statistics;  /**< @brief Statistics */
+        };
+
+        /**
+         * @brief Trace summary
+         *
+         * @see @ref summarize()
+         */
+        struct MAGNUM_DEBUGTOOLS_EXPORT Summary {
+            UnsignedLong frameCount;    /**< @brief Count of completed frames */
+            UnsignedLong duration;      /**< @brief Trace duration in nanoseconds */
+
+            /**
+             * @brief Statistics for each command
+             *
+             * Indexed by @ref Command value minus one.
+             */
+            Statistics commands[5];
+
+            /** @brief Hotspots, sorted by time in descending order */
+            std::vector<Hotspot> hotspots;
+
+            /** @brief Statistics for given command */
+            const Statistics& operator[](Command command) const {
+                return commands[UnsignedByte(command) - 1];
+            }
+
+            /**
+             * @brief Summary formatted as text
+             *
+             * Totals and per-frame averages for each command type followed
+             * by the hotspot list.
+             */
+            std::string text() const;
+        };
+
+        /**
+         * @brief Deserialize a trace
+         *
+         * Returns `std::nullopt` if @p trace is not a valid trace.
+         * @see @ref trace()
+         */
+        static std::optional<std::vector<Event>> events(Containers::ArrayView<const char> trace);
+
+        /**
+         * @brief Summarize a trace
+         * @param trace         Trace data
+         * @param hotspotCount  Maximal count of hotspots to list
+         *
+         * Returns `std::nullopt` if @p trace is not a valid trace. Can be
+         * used without GL context.
+         * @see @ref trace(), @ref save()
+         */
+        static std::optional<Summary> summarize(Containers::ArrayView<const char> trace, std::size_t hotspotCount = 10);
+
+        /** @brief Constructor */
+        explicit CommandCapture();
+
+        /**
+         * @brief Destructor
+         *
+         * Stops the capture, if running.
+         */
+        ~CommandCapture();
+
+        /** @brief Whether the capture is running */
+        bool isCapturing() const;
+
+        /**
+         * @brief Start the capture
+         *
+         * Sets the capture as current @ref CommandObserver, replacing any
+         * previous one. The events are appended to already recorded ones,
+         * use @ref clear() to discard them.
+         */
+        void start();
+
+        /**
+         * @brief Stop the capture
+         *
+         * Resets current @ref CommandObserver.
+         */
+        void stop();
+
+        /** @brief Mark frame boundary */
+        void nextFrame();
+
+        /** @brief Discard all recorded events */
+        void clear();
+
+        /** @brief Count of recorded events including frame boundaries */
+        std::size_t eventCount() const { return _events.size(); }
+
+        /** @brief Count of completed frames */
+        std::size_t frameCount() const { return _frameCount; }
+
+        /**
+         * @brief Serialize recorded events to a trace
+         *
+         * @see @ref summarize()
+         */
+        Containers::Array<char> trace() const;
+
+        /**
+         * @brief Save recorded events to a file
+         *
+         * Returns `false` if the file cannot be written.
+         */
+        bool save(const std::string& filename) const;
+
+    private:
+        void doRecord(Command command, UnsignedInt object, UnsignedLong size, bool redundant) override;
+
+        UnsignedLong now() const;
+
+        std::chrono::steady_clock::time_point _start;
+        std::vector<Event> _events;
+        std::size_t _frameCount;
+};
+
+}}
+
+#endif
@@ -34,6 +34,10 @@
 namespace Magnum { namespace DebugTools {
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+class AsyncReadback;
+#endif
+
 template<UnsignedInt> class ForceRenderer;
 typedef ForceRenderer<2> ForceRenderer2D;
 typedef ForceRenderer<3> ForceRenderer3D;
@@ -44,6 +48,14 @@ typedef ObjectRenderer<2> ObjectRenderer2D;
 typedef ObjectRenderer<3> ObjectRenderer3D;
 class ObjectRendererOptions;
 
+class FrameStatistics;
+
+#ifndef MAGNUM_TARGET_WEBGL
+template<UnsignedInt> class ImmediateDrawer;
+typedef ImmediateDrawer<2> ImmediateDrawer2D;
+typedef ImmediateDrawer<3> ImmediateDrawer3D;
+#endif
+
 class Profiler;
 class ResourceManager;
 
@@ -51,6 +63,8 @@ template<UnsignedInt> class ShapeRenderer;
 typedef ShapeRenderer<2> ShapeRenderer2D;
 typedef ShapeRenderer<3> ShapeRenderer3D;
 class ShapeRendererOptions;
+
+class ZoneProfiler;
 #endif
 
 }}
@@ -0,0 +1,177 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "FrameStatistics.h"
+
+#include <sstream>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/AbstractTexture.h"
+#include "Magnum/Buffer.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/Renderer.h"
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#endif
+
+namespace Magnum { namespace DebugTools {
+
+namespace {
+    FrameStatistics::Statistics currentCounters() {
+        return FrameStatistics::Statistics{
+            Mesh::drawCallCount(),
+            0,
+            Buffer::uploadCount(),
+            Buffer::uploadSize(),
+            AbstractTexture::bindCount(),
+            AbstractShaderProgram::useCount(),
+            Renderer::stateChangeCount()};
+    }
+}
+
+FrameStatistics::FrameStatistics(): _inFrame{false}, _frameCount{0}, _begin{}, _statistics{}
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    , _primitiveCountEnabled{false}, _currentQuery{0}
+    #endif
+    {}
+
+FrameStatistics::~FrameStatistics() = default;
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+void FrameStatistics::setPrimitiveCountEnabled(const bool enabled) {
+    CORRADE_ASSERT(!_inFrame, "DebugTools::FrameStatistics::setPrimitiveCountEnabled(): cannot be called during a frame", );
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(enabled && !Context::current().isExtensionSupported<Extensions::GL::EXT::transform_feedback>())
+    #else
+    if(enabled && !Context::current().isExtensionSupported<Extensions::GL::EXT::geometry_shader>())
+    #endif
+    {
+        Warning() << "DebugTools::FrameStatistics::setPrimitiveCountEnabled(): primitive queries are not supported, primitives won't be counted";
+        return;
+    }
+
+    _primitiveCountEnabled = enabled;
+
+    /* Frames waiting for the result would be never retrieved otherwise */
+    if(!enabled) {
+        while(!_pendingFrames.empty()) retrieve();
+    }
+}
+#endif
+
+void FrameStatistics::beginFrame() {
+    CORRADE_ASSERT(!_inFrame, "DebugTools::FrameStatistics::beginFrame(): frame already began", );
+    _inFrame = true;
+
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(_primitiveCountEnabled) {
+        if(!_freeQueries.empty()) {
+            _currentQuery = _freeQueries.back();
+            _freeQueries.pop_back();
+        } else {
+            _currentQuery = _queries.size();
+            _queries.emplace_back(PrimitiveQuery::Target::PrimitivesGenerated);
+        }
+
+        _queries[_currentQuery].begin();
+    }
+    #endif
+
+    /* Query the counters last so the query creation isn't counted */
+    _begin = currentCounters();
+}
+
+void FrameStatistics::endFrame() {
+    CORRADE_ASSERT(_inFrame, "DebugTools::FrameStatistics::endFrame(): no frame began", );
+    _inFrame = false;
+
+    const Statistics end = currentCounters();
+    Statistics statistics{
+        end.drawCalls - _begin.drawCalls,
+        0,
+        end.bufferUploads - _begin.bufferUploads,
+        end.bufferUploadSize - _begin.bufferUploadSize,
+        end.textureBinds - _begin.textureBinds,
+        end.programSwitches - _begin.programSwitches,
+        end.stateChanges - _begin.stateChanges};
+
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(_primitiveCountEnabled) {
+        _queries[_currentQuery].end();
+        _pendingFrames.emplace_back(statistics, _currentQuery);
+
+        /* The queries finish in order, stop at the first one that's not done
+           yet to never wait for the GPU */
+        while(!_pendingFrames.empty() && _queries[_pendingFrames.front().second].resultAvailable())
+            retrieve();
+        return;
+    }
+    #endif
+
+    _statistics = statistics;
+    ++_frameCount;
+}
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+void FrameStatistics::retrieve() {
+    std::pair<Statistics, std::size_t>& frame = _pendingFrames.front();
+    frame.first.primitives = _queries[frame.second].result<UnsignedInt>();
+    _statistics = frame.first;
+    ++_frameCount;
+
+    _freeQueries.push_back(frame.second);
+    _pendingFrames.pop_front();
+}
+#endif
+
+std::string FrameStatistics::text() const {
+    std::ostringstream out;
+    out << "Draw calls: " << _statistics.drawCalls << '\n';
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(_primitiveCountEnabled)
+        out << "Primitives: " << _statistics.primitives << '\n';
+    #endif
+    out << "Buffer uploads: " << _statistics.bufferUploads << " (" << _statistics.bufferUploadSize << " B)\n"
+        << "Texture binds: " << _statistics.textureBinds << '\n'
+        << "Program switches: " << _statistics.programSwitches << '\n'
+        << "State changes: " << _statistics.stateChanges;
+    return out.str();
+}
+
+Debug& operator<<(Debug& debug, const FrameStatistics::Statistics& value) {
+    return debug << "DebugTools::FrameStatistics::Statistics(draw calls:" << value.drawCalls
+        << Debug::nospace << ", primitives:" << value.primitives
+        << Debug::nospace << ", buffer uploads:" << value.bufferUploads
+        << Debug::nospace << ", uploaded bytes:" << value.bufferUploadSize
+        << Debug::nospace << ", texture binds:" << value.textureBinds
+        << Debug::nospace << ", program switches:" << value.programSwitches
+        << Debug::nospace << ", state changes:" << value.stateChanges << Debug::nospace << ")";
+}
+
+}}
@@ -0,0 +1,244 @@
+#ifndef Magnum_DebugTools_FrameStatistics_h
+#define Magnum_DebugTools_FrameStatistics_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::DebugTools::FrameStatistics
+ */
+
+#include <deque>
+#include <string>
+#include <vector>
+#include <Corrade/Utility/Utility.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/DebugTools/visibility.h"
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include "Magnum/PrimitiveQuery.h"
+#endif
+
+namespace Magnum { namespace DebugTools {
+
+/**
+@brief Per-frame OpenGL API statistics
+
+Counts draw calls, buffer uploads, texture binds, shader program switches and
+renderer state changes issued between @ref beginFrame() and @ref endFrame().
+The counts are taken from the counters the engine maintains in its state
+tracker (@ref Mesh::drawCallCount(), @ref Buffer::uploadCount(),
+@ref Buffer::uploadSize(), @ref AbstractTexture::bindCount(),
+@ref AbstractShaderProgram::useCount() and @ref Renderer::stateChangeCount()),
+so no GL call has to be wrapped manually. Only calls that actually reach
+OpenGL are counted, calls filtered out by the state tracker are not. Example
+usage:
+@code
+DebugTools::FrameStatistics statistics;
+
+void MyApplication::drawEvent() {
+    statistics.beginFrame();
+
+    defaultFramebuffer.clear(FramebufferClear::Color|FramebufferClear::Depth);
+    camera.draw(drawables);
+
+    statistics.endFrame();
+
+    Debug() << statistics.statistics();
+
+    swapBuffers();
+}
+@endcode
+
+The statistics are calculated as differences of the global counters, so the
+frames shouldn't overlap and @ref Renderer::resetStateChangeCount() shouldn't
+be called while a frame is being measured.
+
+@anchor DebugTools-FrameStatistics-primitive-count
+## Primitive count
+
+Call @ref setPrimitiveCountEnabled() to also count generated primitives. A
+@ref PrimitiveQuery is then active for the whole frame and the result is
+retrieved only once it's available, which is usually a couple of frames
+later, so the measurement never stalls the pipeline. Because of that,
+@ref statistics() always refers to the newest frame that has all data
+available. The queries are taken from a pool and reused. Note that only one
+primitive query can be active at a time, so it's not possible to use other
+@ref PrimitiveQuery::Target::PrimitivesGenerated queries while the frame is
+measured.
+
+## Text overlay
+
+The @ref text() function formats the statistics as a multi-line string that
+can be directly rendered with @ref Text::Renderer:
+@code
+Text::Renderer2D overlay{font, glyphCache, 0.035f};
+overlay.reserve(256, BufferUsage::DynamicDraw, BufferUsage::StaticDraw);
+
+// each frame, after endFrame()
+overlay.render(statistics.text());
+overlay.mesh().draw(vectorShader);
+@endcode
+
+Rendering the overlay itself issues some draw calls and buffer uploads, so
+it should be done outside of the measured frame.
+
+@see @ref Profiler, @ref ZoneProfiler
+*/
+class MAGNUM_DEBUGTOOLS_EXPORT FrameStatistics {
+    public:
+        /**
+         * @brief Frame statistics
+         *
+         * @see @ref statistics()
+         */
+        struct Statistics {
+            UnsignedLong drawCalls;         /**< @brief Draw call count */
+
+            /**
+             * @brief Generated primitive count
+             *
+             * Always `0` if primitive count is not enabled.
+             * @see @ref setPrimitiveCountEnabled()
+             */
+            UnsignedLong primitives;
+
+            UnsignedLong bufferUploads,     /**< @brief Buffer upload count */
+                bufferUploadSize,           /**< @brief Uploaded byte count */
+                textureBinds,               /**< @brief Texture bind count */
+                programSwitches,            /**< @brief Shader program switch count */
+                stateChanges;               /**< @brief Renderer state change count */
+        };
+
+        /** @brief Constructor */
+        explicit FrameStatistics();
+
+        /** @brief Copying is not allowed */
+        FrameStatistics(const FrameStatistics&) = delete;
+
+        /** @brief Moving is not allowed */
+        FrameStatistics(FrameStatistics&&) = delete;
+
+        ~FrameStatistics();
+
+        /** @brief Copying is not allowed */
+        FrameStatistics& operator=(const FrameStatistics&) = delete;
+
+        /** @brief Moving is not allowed */
+        FrameStatistics& operator=(FrameStatistics&&) = delete;
+
+        #if defined(DOXYGEN_GENERATING_OUTPUT) || (!defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL))
+        /**
+         * @brief Whether generated primitives are counted
+         *
+         * @see @ref setPrimitiveCountEnabled()
+         */
+        bool isPrimitiveCountEnabled() const { return _primitiveCountEnabled; }
+
+        /**
+         * @brief Enable or disable counting of generated primitives
+         *
+         * Disabled by default. See @ref DebugTools-FrameStatistics-primitive-count "class documentation"
+         * for more information. If primitive queries are not supported,
+         * prints a warning and does nothing.
+         * @attention This function cannot be called between
+         *      @ref beginFrame() and @ref endFrame().
+         * @requires_gl30 Extension @extension{EXT,transform_feedback}
+         * @requires_gles30 Primitive queries are not available in OpenGL ES
+         *      2.0.
+         * @requires_es_extension Extension @es_extension{EXT,geometry_shader}
+         * @requires_gles Primitive queries are not available in WebGL.
+         */
+        void setPrimitiveCountEnabled(bool enabled);
+        #endif
+
+        /**
+         * @brief Begin a frame
+         *
+         * Saves current values of all counters and, if enabled, starts a
+         * primitive query.
+         * @see @ref endFrame()
+         */
+        void beginFrame();
+
+        /**
+         * @brief End a frame
+         *
+         * Calculates the statistics of the frame started with
+         * @ref beginFrame(). If primitive count is not enabled, the
+         * statistics are available in @ref statistics() immediately,
+         * otherwise after the query result is available.
+         */
+        void endFrame();
+
+        /**
+         * @brief Count of frames with available statistics
+         *
+         * @see @ref statistics()
+         */
+        std::size_t frameCount() const { return _frameCount; }
+
+        /**
+         * @brief Statistics of the newest measured frame
+         *
+         * If no frame was measured yet, all fields are zero.
+         * @see @ref frameCount()
+         */
+        const Statistics& statistics() const { return _statistics; }
+
+        /**
+         * @brief Statistics formatted as text
+         *
+         * One line for each field of @ref Statistics, suitable for rendering
+         * with @ref Text::Renderer. The primitive count is included only if
+         * enabled.
+         */
+        std::string text() const;
+
+    private:
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        void retrieve();
+        #endif
+
+        bool _inFrame;
+        std::size_t _frameCount;
+        Statistics _begin, _statistics;
+
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        bool _primitiveCountEnabled;
+        std::size_t _currentQuery;
+        std::vector<PrimitiveQuery> _queries;
+        std::vector<std::size_t> _freeQueries;
+        /* Statistics and query ID of frames waiting for the query result */
+        std::deque<std::pair<Statistics, std::size_t>> _pendingFrames;
+        #endif
+};
+
+/** @debugoperator{Magnum::DebugTools::FrameStatistics} */
+MAGNUM_DEBUGTOOLS_EXPORT Debug& operator<<(Debug& debug, const FrameStatistics::Statistics& value);
+
+}}
+
+#endif
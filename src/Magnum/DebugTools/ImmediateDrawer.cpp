@@ -0,0 +1,190 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ImmediateDrawer.h"
+
+#ifndef MAGNUM_TARGET_WEBGL
+#include <algorithm>
+#include <array>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace DebugTools {
+
+namespace {
+
+constexpr UnsignedInt CircleSegmentCount = 32;
+
+/* Cosines and sines of circle segment angles, computed on first use */
+const std::array<Vector2, CircleSegmentCount + 1>& circlePoints() {
+    static const std::array<Vector2, CircleSegmentCount + 1> points = []() {
+        std::array<Vector2, CircleSegmentCount + 1> points;
+        for(UnsignedInt i = 0; i != CircleSegmentCount + 1; ++i) {
+            const Rad angle(Constants::tau()*i/CircleSegmentCount);
+            points[i] = {Math::cos(angle), Math::sin(angle)};
+        }
+        return points;
+    }();
+    return points;
+}
+
+template<UnsignedInt dimensions> void addCircle(ImmediateDrawer<dimensions>& drawer, const VectorTypeFor<dimensions, Float>& center, const VectorTypeFor<dimensions, Float>& x, const VectorTypeFor<dimensions, Float>& y, const Color4& color) {
+    const std::array<Vector2, CircleSegmentCount + 1>& points = circlePoints();
+    for(UnsignedInt i = 0; i != CircleSegmentCount; ++i)
+        drawer.addLine(center + x*points[i].x() + y*points[i].y(),
+                       center + x*points[i + 1].x() + y*points[i + 1].y(), color);
+}
+
+}
+
+template<UnsignedInt dimensions> ImmediateDrawer<dimensions>::ImmediateDrawer(const UnsignedInt capacity, const UnsignedInt frameCount): _capacity{capacity}, _ring{GLsizeiptr(capacity*sizeof(Vertex)), frameCount}, _shader{Shaders::Flat<dimensions>::Flag::VertexColor} {
+    _shader.setColor(Color4{1.0f});
+    _mesh.addVertexBuffer(_ring.buffer(), 0,
+        typename Shaders::Flat<dimensions>::Position{},
+        typename Shaders::Flat<dimensions>::Color{});
+}
+
+template<UnsignedInt dimensions> ImmediateDrawer<dimensions>::~ImmediateDrawer() = default;
+
+template<UnsignedInt dimensions> ImmediateDrawer<dimensions>& ImmediateDrawer<dimensions>::addLine(const VectorTypeFor<dimensions, Float>& a, const VectorTypeFor<dimensions, Float>& b, const Color4& color) {
+    _lines.push_back({a, color});
+    _lines.push_back({b, color});
+    return *this;
+}
+
+template<UnsignedInt dimensions> ImmediateDrawer<dimensions>& ImmediateDrawer<dimensions>::addTriangle(const VectorTypeFor<dimensions, Float>& a, const VectorTypeFor<dimensions, Float>& b, const VectorTypeFor<dimensions, Float>& c, const Color4& color) {
+    _triangles.push_back({a, color});
+    _triangles.push_back({b, color});
+    _triangles.push_back({c, color});
+    return *this;
+}
+
+template<UnsignedInt dimensions> ImmediateDrawer<dimensions>& ImmediateDrawer<dimensions>::addPoint(const VectorTypeFor<dimensions, Float>& position, const Color4& color) {
+    _points.push_back({position, color});
+    return *this;
+}
+
+template<UnsignedInt dimensions> ImmediateDrawer<dimensions>& ImmediateDrawer<dimensions>::addCross(const VectorTypeFor<dimensions, Float>& position, const Float size, const Color4& color) {
+    for(UnsignedInt i = 0; i != dimensions; ++i) {
+        VectorTypeFor<dimensions, Float> axis;
+        axis[i] = size*0.5f;
+        addLine(position - axis, position + axis, color);
+    }
+    return *this;
+}
+
+template<UnsignedInt dimensions> ImmediateDrawer<dimensions>& ImmediateDrawer<dimensions>::addBox(const MatrixTypeFor<dimensions, Float>& transformation, const Color4& color) {
+    /* Corner i has coordinate on axis j equal to 1 if bit j of i is set */
+    constexpr UnsignedInt cornerCount = 1 << dimensions;
+    VectorTypeFor<dimensions, Float> corners[cornerCount];
+    for(UnsignedInt i = 0; i != cornerCount; ++i) {
+        VectorTypeFor<dimensions, Float> corner;
+        for(UnsignedInt j = 0; j != dimensions; ++j)
+            corner[j] = (i & (1 << j)) ? 1.0f : -1.0f;
+        corners[i] = transformation.transformPoint(corner);
+    }
+
+    /* Edges connect corners differing in exactly one coordinate */
+    for(UnsignedInt i = 0; i != cornerCount; ++i)
+        for(UnsignedInt j = 0; j != dimensions; ++j)
+            if(!(i & (1 << j))) addLine(corners[i], corners[i | (1 << j)], color);
+
+    return *this;
+}
+
+template<UnsignedInt dimensions> ImmediateDrawer<dimensions>& ImmediateDrawer<dimensions>::addAxisAlignedBox(const VectorTypeFor<dimensions, Float>& min, const VectorTypeFor<dimensions, Float>& max, const Color4& color) {
+    return addBox(MatrixTypeFor<dimensions, Float>::translation((min + max)*0.5f)*
+        MatrixTypeFor<dimensions, Float>::scaling((max - min)*0.5f), color);
+}
+
+template<UnsignedInt dimensions> ImmediateDrawer<dimensions>& ImmediateDrawer<dimensions>::addSphere(const VectorTypeFor<dimensions, Float>& center, const Float radius, const Color4& color) {
+    /* One circle in each coordinate plane */
+    for(UnsignedInt i = 0; i != dimensions; ++i) {
+        for(UnsignedInt j = i + 1; j != dimensions; ++j) {
+            VectorTypeFor<dimensions, Float> x, y;
+            x[i] = radius;
+            y[j] = radius;
+            addCircle(*this, center, x, y, color);
+        }
+    }
+    return *this;
+}
+
+template<UnsignedInt dimensions> void ImmediateDrawer<dimensions>::draw(const MatrixTypeFor<dimensions, Float>& transformationProjectionMatrix) {
+    std::size_t lineCount = _lines.size();
+    std::size_t triangleCount = _triangles.size();
+    std::size_t pointCount = _points.size();
+    const std::size_t count = lineCount + triangleCount + pointCount;
+    if(!count) return;
+
+    /* Drop what doesn't fit, keeping whole primitives */
+    if(count > _capacity) {
+        lineCount = std::min<std::size_t>(lineCount, _capacity/2*2);
+        triangleCount = std::min<std::size_t>(triangleCount, (_capacity - lineCount)/3*3);
+        pointCount = std::min<std::size_t>(pointCount, _capacity - lineCount - triangleCount);
+        Warning() << "DebugTools::ImmediateDrawer::draw(): capacity of" << _capacity << "vertices exceeded, dropping" << count - lineCount - triangleCount - pointCount << "vertices";
+    }
+
+    /* Upload everything into the next section */
+    _ring.beginSection();
+    const std::size_t uploadCount = lineCount + triangleCount + pointCount;
+    Vertex* const data = reinterpret_cast<Vertex*>(_ring.allocate(uploadCount*sizeof(Vertex), sizeof(Vertex)).data());
+    std::copy(_lines.begin(), _lines.begin() + lineCount, data);
+    std::copy(_triangles.begin(), _triangles.begin() + triangleCount, data + lineCount);
+    std::copy(_points.begin(), _points.begin() + pointCount, data + lineCount + triangleCount);
+    Int baseVertex = _ring.allocationOffset()/sizeof(Vertex);
+    _ring.endSection();
+
+    /* One draw for each primitive type */
+    _shader.setTransformationProjectionMatrix(transformationProjectionMatrix);
+    for(const std::pair<MeshPrimitive, std::size_t>& primitive: {
+        std::make_pair(MeshPrimitive::Lines, lineCount),
+        std::make_pair(MeshPrimitive::Triangles, triangleCount),
+        std::make_pair(MeshPrimitive::Points, pointCount)})
+    {
+        if(!primitive.second) continue;
+
+        _mesh.setPrimitive(primitive.first)
+            .setCount(primitive.second)
+            .setBaseVertex(baseVertex)
+            .draw(_shader);
+        baseVertex += primitive.second;
+    }
+
+    clear();
+}
+
+template<UnsignedInt dimensions> void ImmediateDrawer<dimensions>::clear() {
+    _lines.clear();
+    _triangles.clear();
+    _points.clear();
+}
+
+template class ImmediateDrawer<2>;
+template class ImmediateDrawer<3>;
+
+}}
+#endif
@@ -0,0 +1,216 @@
+#ifndef Magnum_DebugTools_ImmediateDrawer_h
+#define Magnum_DebugTools_ImmediateDrawer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_WEBGL
+/** @file
+ * @brief Class @ref Magnum::DebugTools::ImmediateDrawer, typedef @ref Magnum::DebugTools::ImmediateDrawer2D, @ref Magnum::DebugTools::ImmediateDrawer3D
+ */
+#endif
+
+#include <vector>
+
+#include "Magnum/BufferRing.h"
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shaders/Flat.h"
+#include "Magnum/DebugTools/visibility.h"
+
+#ifndef MAGNUM_TARGET_WEBGL
+namespace Magnum { namespace DebugTools {
+
+/**
+@brief Immediate-mode debug drawer
+
+Accumulates lines, triangles and points added from arbitrary code during the
+frame and draws them all at once in @ref draw(), with one draw call for each
+primitive type. Compared to creating @ref ForceRenderer or @ref ShapeRenderer
+for every visualized item this has no per-item GL cost, which makes it
+suitable for drawing thousands of short-lived primitives each frame, for
+example physics contacts or bounding volumes. Example usage:
+@code
+DebugTools::ImmediateDrawer3D drawer;
+
+// anywhere during the frame
+drawer.addLine(a, b, Color3::red())
+    .addSphere(contact.position(), 0.1f, Color3::yellow())
+    .addBox(body.transformation(), Color3::green());
+
+// at the end of the frame
+drawer.draw(projectionMatrix*cameraMatrix);
+@endcode
+
+The primitives are specified in the same space as the matrix passed to
+@ref draw(), boxes, spheres and crosses are converted to lines on the CPU.
+The vertex data are streamed through a @ref BufferRing, so the upload doesn't
+wait for the GPU to finish drawing previous frames. If there are more vertices
+than the capacity passed in the constructor, the rest is not drawn and a
+warning is printed.
+
+@requires_gl30 Extension @extension{ARB,map_buffer_range}
+@requires_gles30 Extension @es_extension{EXT,map_buffer_range} in OpenGL ES
+    2.0.
+@requires_gles Buffer mapping is not available in WebGL.
+@see @ref ImmediateDrawer2D, @ref ImmediateDrawer3D
+*/
+template<UnsignedInt dimensions> class MAGNUM_DEBUGTOOLS_EXPORT ImmediateDrawer {
+    public:
+        /**
+         * @brief Constructor
+         * @param capacity      Max vertex count drawn in one frame
+         * @param frameCount    Count of frames the GL is allowed to lag
+         *      behind the application
+         *
+         * Creates the shader and allocates @p capacity times @p frameCount
+         * vertices in the streaming buffer.
+         */
+        explicit ImmediateDrawer(UnsignedInt capacity = 65536, UnsignedInt frameCount = 3);
+
+        /** @brief Copying is not allowed */
+        ImmediateDrawer(const ImmediateDrawer<dimensions>&) = delete;
+
+        /** @brief Moving is not allowed */
+        ImmediateDrawer(ImmediateDrawer<dimensions>&&) = delete;
+
+        ~ImmediateDrawer();
+
+        /** @brief Copying is not allowed */
+        ImmediateDrawer<dimensions>& operator=(const ImmediateDrawer<dimensions>&) = delete;
+
+        /** @brief Moving is not allowed */
+        ImmediateDrawer<dimensions>& operator=(ImmediateDrawer<dimensions>&&) = delete;
+
+        /** @brief Max vertex count drawn in one frame */
+        UnsignedInt capacity() const { return _capacity; }
+
+        /** @brief Count of accumulated line vertices */
+        UnsignedInt lineVertexCount() const { return _lines.size(); }
+
+        /** @brief Count of accumulated triangle vertices */
+        UnsignedInt triangleVertexCount() const { return _triangles.size(); }
+
+        /** @brief Count of accumulated point vertices */
+        UnsignedInt pointVertexCount() const { return _points.size(); }
+
+        /**
+         * @brief Add line
+         * @return Reference to self (for method chaining)
+         */
+        ImmediateDrawer<dimensions>& addLine(const VectorTypeFor<dimensions, Float>& a, const VectorTypeFor<dimensions, Float>& b, const Color4& color);
+
+        /**
+         * @brief Add filled triangle
+         * @return Reference to self (for method chaining)
+         */
+        ImmediateDrawer<dimensions>& addTriangle(const VectorTypeFor<dimensions, Float>& a, const VectorTypeFor<dimensions, Float>& b, const VectorTypeFor<dimensions, Float>& c, const Color4& color);
+
+        /**
+         * @brief Add point
+         * @return Reference to self (for method chaining)
+         *
+         * Drawn as @ref MeshPrimitive::Points, the size is controlled by
+         * @ref Renderer::setPointSize().
+         */
+        ImmediateDrawer<dimensions>& addPoint(const VectorTypeFor<dimensions, Float>& position, const Color4& color);
+
+        /**
+         * @brief Add crosshair
+         * @return Reference to self (for method chaining)
+         *
+         * Lines along all axes through @p position, @p size long.
+         */
+        ImmediateDrawer<dimensions>& addCross(const VectorTypeFor<dimensions, Float>& position, Float size, const Color4& color);
+
+        /**
+         * @brief Add wireframe box
+         * @return Reference to self (for method chaining)
+         *
+         * The box is a cube from `-1` to `1` on all axes transformed with
+         * @p transformation, i.e. the same as @ref Shapes::Box.
+         */
+        ImmediateDrawer<dimensions>& addBox(const MatrixTypeFor<dimensions, Float>& transformation, const Color4& color);
+
+        /**
+         * @brief Add wireframe axis-aligned box
+         * @return Reference to self (for method chaining)
+         */
+        ImmediateDrawer<dimensions>& addAxisAlignedBox(const VectorTypeFor<dimensions, Float>& min, const VectorTypeFor<dimensions, Float>& max, const Color4& color);
+
+        /**
+         * @brief Add wireframe sphere
+         * @return Reference to self (for method chaining)
+         *
+         * Drawn as a circle in 2D and as three circles in the coordinate
+         * planes in 3D.
+         */
+        ImmediateDrawer<dimensions>& addSphere(const VectorTypeFor<dimensions, Float>& center, Float radius, const Color4& color);
+
+        /**
+         * @brief Draw accumulated primitives
+         *
+         * Uploads all primitives added since last call to a new section of
+         * the streaming buffer, draws them with one draw call for each
+         * non-empty primitive type and clears them.
+         * @see @ref clear()
+         */
+        void draw(const MatrixTypeFor<dimensions, Float>& transformationProjectionMatrix);
+
+        /**
+         * @brief Discard accumulated primitives
+         *
+         * Clears everything added since last call to @ref draw() without
+         * drawing it.
+         */
+        void clear();
+
+    private:
+        struct Vertex {
+            VectorTypeFor<dimensions, Float> position;
+            Color4 color;
+        };
+
+        UnsignedInt _capacity;
+        std::vector<Vertex> _lines, _triangles, _points;
+        BufferRing _ring;
+        Mesh _mesh;
+        Shaders::Flat<dimensions> _shader;
+};
+
+/** @brief Two-dimensional immediate-mode debug drawer */
+typedef ImmediateDrawer<2> ImmediateDrawer2D;
+
+/** @brief Three-dimensional immediate-mode debug drawer */
+typedef ImmediateDrawer<3> ImmediateDrawer3D;
+
+}}
+#else
+#error this header is not available in WebGL build
+#endif
+
+#endif
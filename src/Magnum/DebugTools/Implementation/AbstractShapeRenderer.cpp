@@ -25,6 +25,8 @@
 
 #include "AbstractShapeRenderer.h"
 
+#include <algorithm>
+
 #include "Magnum/AbstractShaderProgram.h"
 #include "Magnum/Buffer.h"
 #include "Magnum/Mesh.h"
@@ -34,6 +36,8 @@
 #include "Magnum/Trade/MeshData2D.h"
 #include "Magnum/Trade/MeshData3D.h"
 
+#include "RendererBatch.h"
+
 namespace Magnum { namespace DebugTools { namespace Implementation {
 
 namespace {
@@ -42,90 +46,95 @@ template<UnsignedInt dimensions> ResourceKey shaderKey();
 template<> inline ResourceKey shaderKey<2>() { return ResourceKey("FlatShader2D"); }
 template<> inline ResourceKey shaderKey<3>() { return ResourceKey("FlatShader3D"); }
 
-template<UnsignedInt dimensions> void create(typename MeshData<dimensions>::Type&, Resource<Mesh>&, Resource<Buffer>&, Resource<Buffer>&);
-
-template<> void create<2>(Trade::MeshData2D& data, Resource<Mesh>& meshResource, Resource<Buffer>& vertexBufferResource, Resource<Buffer>& indexBufferResource) {
-    /* Vertex buffer */
-    Buffer* buffer = new Buffer{Buffer::TargetHint::Array};
-    buffer->setData(data.positions(0), BufferUsage::StaticDraw);
-    ResourceManager::instance().set(vertexBufferResource.key(), buffer, ResourceDataState::Final, ResourcePolicy::Manual);
-
-    /* Mesh configuration */
-    Mesh* mesh = new Mesh;
-    mesh->setPrimitive(data.primitive())
-        .addVertexBuffer(*buffer, 0, Shaders::Flat2D::Position());
-    ResourceManager::instance().set(meshResource.key(), mesh, ResourceDataState::Final, ResourcePolicy::Manual);
-
-    /* Index buffer, if needed, if not, resource key doesn't have to be set */
-    if(data.isIndexed()) {
-        CORRADE_INTERNAL_ASSERT(indexBufferResource.key() != ResourceKey());
+}
 
-        Containers::Array<char> indexData;
-        Mesh::IndexType indexType;
-        UnsignedInt indexStart, indexEnd;
-        std::tie(indexData, indexType, indexStart, indexEnd) = MeshTools::compressIndices(data.indices());
+template<UnsignedInt dimensions> void ShapeInstances<dimensions>::add(Mesh& mesh, Buffer& buffer, const MatrixTypeFor<dimensions, Float>& transformation, const Color4& color) {
+    /* There's just a handful of distinct meshes, linear search is enough */
+    auto found = std::find_if(parts.begin(), parts.end(), [&mesh](const Part& part) {
+        return part.mesh == &mesh;
+    });
+    if(found == parts.end()) {
+        parts.push_back({&mesh, &buffer, {}});
+        found = parts.end() - 1;
+    }
+
+    found->instances.push_back({transformation, color});
+}
 
-        Buffer* indexBuffer = new Buffer{Buffer::TargetHint::ElementArray};
-        indexBuffer->setData(indexData, BufferUsage::StaticDraw);
-        mesh->setCount(data.indices().size())
-            .setIndexBuffer(*indexBuffer, 0, indexType, indexStart, indexEnd);
+template<UnsignedInt dimensions> void ShapeInstances<dimensions>::clear() {
+    for(Part& part: parts) part.instances.clear();
+}
 
-        ResourceManager::instance().set(indexBufferResource.key(), indexBuffer, ResourceDataState::Final, ResourcePolicy::Manual);
+template<UnsignedInt dimensions> AbstractShapeRenderer<dimensions>::AbstractShapeRenderer(ResourceKey meshKey, ResourceKey vertexBufferKey, ResourceKey indexBufferKey, ResourceKey instancedMeshKey, ResourceKey instanceBufferKey): _indexType{} {
+    wireframeShader = ResourceManager::instance().get<AbstractShaderProgram, Shaders::Flat<dimensions>>(shaderKey<dimensions>());
+    wireframeMesh = ResourceManager::instance().get<Mesh>(meshKey);
+    instancedMesh = ResourceManager::instance().get<Mesh>(instancedMeshKey);
+    instanceBuffer = ResourceManager::instance().get<Buffer>(instanceBufferKey);
+    vertexBuffer = ResourceManager::instance().get<Buffer>(vertexBufferKey);
+    indexBuffer = ResourceManager::instance().get<Buffer>(indexBufferKey);
 
-    /* The mesh is not indexed, set proper vertex count */
-    } else mesh->setCount(data.positions(0).size());
+    if(!wireframeShader) ResourceManager::instance().set<AbstractShaderProgram>(shaderKey<dimensions>(),
+        new Shaders::Flat<dimensions>, ResourceDataState::Final, ResourcePolicy::Resident);
 }
 
-template<> void create<3>(Trade::MeshData3D& data, Resource<Mesh>& meshResource, Resource<Buffer>& vertexBufferResource, Resource<Buffer>& indexBufferResource) {
+template<UnsignedInt dimensions> AbstractShapeRenderer<dimensions>::~AbstractShapeRenderer() {}
+
+template<UnsignedInt dimensions> void AbstractShapeRenderer<dimensions>::createResources(typename MeshData<dimensions>::Type data) {
     /* Vertex buffer */
-    Buffer* vertexBuffer = new Buffer{Buffer::TargetHint::Array};
-    vertexBuffer->setData(data.positions(0), BufferUsage::StaticDraw);
-    ResourceManager::instance().set(vertexBufferResource.key(), vertexBuffer, ResourceDataState::Final, ResourcePolicy::Manual);
+    Buffer* vertices = new Buffer{Buffer::TargetHint::Array};
+    vertices->setData(data.positions(0), BufferUsage::StaticDraw);
+    ResourceManager::instance().set(vertexBuffer.key(), vertices, ResourceDataState::Final, ResourcePolicy::Manual);
 
     /* Mesh configuration */
     Mesh* mesh = new Mesh;
     mesh->setPrimitive(data.primitive())
-        .addVertexBuffer(*vertexBuffer, 0, Shaders::Flat3D::Position());
-    ResourceManager::instance().set(meshResource.key(), mesh, ResourceDataState::Final, ResourcePolicy::Manual);
+        .addVertexBuffer(*vertices, 0, typename Shaders::Flat<dimensions>::Position());
+    ResourceManager::instance().set(wireframeMesh.key(), mesh, ResourceDataState::Final, ResourcePolicy::Manual);
 
     /* Index buffer, if needed, if not, resource key doesn't have to be set */
+    UnsignedInt indexStart = 0, indexEnd = 0;
     if(data.isIndexed()) {
-        CORRADE_INTERNAL_ASSERT(indexBufferResource.key() != ResourceKey());
+        CORRADE_INTERNAL_ASSERT(indexBuffer.key() != ResourceKey());
 
         Containers::Array<char> indexData;
-        Mesh::IndexType indexType;
-        UnsignedInt indexStart, indexEnd;
-        std::tie(indexData, indexType, indexStart, indexEnd) = MeshTools::compressIndices(data.indices());
+        std::tie(indexData, _indexType, indexStart, indexEnd) = MeshTools::compressIndices(data.indices());
 
-        Buffer* indexBuffer = new Buffer{Buffer::TargetHint::ElementArray};
-        indexBuffer->setData(indexData, BufferUsage::StaticDraw);
+        Buffer* indices = new Buffer{Buffer::TargetHint::ElementArray};
+        indices->setData(indexData, BufferUsage::StaticDraw);
         mesh->setCount(data.indices().size())
-            .setIndexBuffer(*indexBuffer, 0, indexType, indexStart, indexEnd);
+            .setIndexBuffer(*indices, 0, _indexType, indexStart, indexEnd);
 
-        ResourceManager::instance().set(indexBufferResource.key(), indexBuffer, ResourceDataState::Final, ResourcePolicy::Manual);
+        ResourceManager::instance().set(indexBuffer.key(), indices, ResourceDataState::Final, ResourcePolicy::Manual);
 
     /* The mesh is not indexed, set proper vertex count */
     } else mesh->setCount(data.positions(0).size());
-}
-
-}
 
-template<UnsignedInt dimensions> AbstractShapeRenderer<dimensions>::AbstractShapeRenderer(ResourceKey meshKey, ResourceKey vertexBufferKey, ResourceKey indexBufferKey) {
-    wireframeShader = ResourceManager::instance().get<AbstractShaderProgram, Shaders::Flat<dimensions>>(shaderKey<dimensions>());
-    wireframeMesh = ResourceManager::instance().get<Mesh>(meshKey);
-    vertexBuffer = ResourceManager::instance().get<Buffer>(vertexBufferKey);
-    indexBuffer = ResourceManager::instance().get<Buffer>(indexBufferKey);
-
-    if(!wireframeShader) ResourceManager::instance().set<AbstractShaderProgram>(shaderKey<dimensions>(),
-        new Shaders::Flat<dimensions>, ResourceDataState::Final, ResourcePolicy::Resident);
+    /* Instanced variant of the whole mesh */
+    if(instancedMesh.key() != ResourceKey() && isInstancingSupported())
+        createInstancedResources(instancedMesh.key(), instanceBuffer.key(), mesh->count(), 0, indexStart, indexEnd);
 }
 
-template<UnsignedInt dimensions> AbstractShapeRenderer<dimensions>::~AbstractShapeRenderer() {}
+template<UnsignedInt dimensions> void AbstractShapeRenderer<dimensions>::createInstancedResources(ResourceKey meshKey, ResourceKey instanceBufferKey, Int count, UnsignedInt indexOffset, UnsignedInt indexStart, UnsignedInt indexEnd) {
+    /* Instance buffer, filled by the shape renderer batch */
+    Buffer* instances = new Buffer{Buffer::TargetHint::Array};
+    ResourceManager::instance().set(instanceBufferKey, instances, ResourceDataState::Final, ResourcePolicy::Manual);
 
-template<UnsignedInt dimensions> void AbstractShapeRenderer<dimensions>::createResources(typename MeshData<dimensions>::Type data) {
-    create<dimensions>(data, wireframeMesh, vertexBuffer, indexBuffer);
+    /* Share the vertex buffer with the wireframe mesh, add per-instance
+       transformation and color */
+    Mesh* mesh = new Mesh;
+    mesh->setPrimitive(wireframeMesh->primitive())
+        .setCount(count)
+        .addVertexBuffer(*vertexBuffer, 0, typename Shaders::Flat<dimensions>::Position())
+        .addVertexBufferInstanced(*instances, 1, 0,
+            typename Shaders::Flat<dimensions>::TransformationMatrix(),
+            typename Shaders::Flat<dimensions>::Color());
+    if(wireframeMesh->isIndexed())
+        mesh->setIndexBuffer(*indexBuffer, indexOffset*Mesh::indexSize(_indexType), _indexType, indexStart, indexEnd);
+    ResourceManager::instance().set(meshKey, mesh, ResourceDataState::Final, ResourcePolicy::Manual);
 }
 
+template struct ShapeInstances<2>;
+template struct ShapeInstances<3>;
 template class AbstractShapeRenderer<2>;
 template class AbstractShapeRenderer<3>;
 
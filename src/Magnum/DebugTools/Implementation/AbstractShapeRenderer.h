@@ -25,8 +25,12 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <vector>
+
 #include "Magnum/DimensionTraits.h"
+#include "Magnum/Mesh.h"
 #include "Magnum/Resource.h"
+#include "Magnum/Math/Color.h"
 #include "Magnum/DebugTools/DebugTools.h"
 #include "Magnum/SceneGraph/SceneGraph.h"
 #include "Magnum/Shaders/Shaders.h"
@@ -45,22 +49,57 @@ template<UnsignedInt> struct MeshData;
 template<> struct MeshData<2> { typedef Trade::MeshData2D Type; };
 template<> struct MeshData<3> { typedef Trade::MeshData3D Type; };
 
+/* Layout matches Shaders::Flat::TransformationMatrix and Shaders::Flat::Color
+   instanced attributes */
+template<UnsignedInt dimensions> struct ShapeInstance {
+    MatrixTypeFor<dimensions, Float> transformation;
+    Color4 color;
+};
+
+/* Per-instance data of a batch of shapes, grouped by instanced mesh */
+template<UnsignedInt dimensions> struct ShapeInstances {
+    struct Part {
+        Mesh* mesh;
+        Buffer* buffer;
+        std::vector<ShapeInstance<dimensions>> instances;
+    };
+
+    void add(Mesh& mesh, Buffer& buffer, const MatrixTypeFor<dimensions, Float>& transformation, const Color4& color);
+
+    /* Keeps the parts (and their allocations) around for next collection */
+    void clear();
+
+    std::vector<Part> parts;
+};
+
 template<UnsignedInt dimensions> class AbstractShapeRenderer {
     public:
-        AbstractShapeRenderer(ResourceKey mesh, ResourceKey vertexBuffer, ResourceKey indexBuffer);
+        AbstractShapeRenderer(ResourceKey mesh, ResourceKey vertexBuffer, ResourceKey indexBuffer, ResourceKey instancedMesh = {}, ResourceKey instanceBuffer = {});
         virtual ~AbstractShapeRenderer();
 
         virtual void draw(Resource<ShapeRendererOptions>& options, const MatrixTypeFor<dimensions, Float>& projectionMatrix) = 0;
 
+        /* World-space transformations of all mesh parts, used for batched
+           instanced drawing */
+        virtual void collect(Resource<ShapeRendererOptions>& options, ShapeInstances<dimensions>& instances) = 0;
+
     protected:
-        /* Call only if the mesh resource isn't already present */
+        /* Call only if the mesh resource isn't already present. Creates also
+           instanced mesh, if its key is set and instancing is supported. */
         void createResources(typename MeshData<dimensions>::Type data);
 
+        /* Instanced mesh sharing vertex and index buffer with the wireframe
+           mesh, drawing only given index range of it. Call only right after
+           createResources() and only if instancing is supported. */
+        void createInstancedResources(ResourceKey mesh, ResourceKey instanceBuffer, Int count, UnsignedInt indexOffset, UnsignedInt indexStart, UnsignedInt indexEnd);
+
         Resource<AbstractShaderProgram, Shaders::Flat<dimensions>> wireframeShader;
-        Resource<Mesh> wireframeMesh;
+        Resource<Mesh> wireframeMesh, instancedMesh;
+        Resource<Buffer> instanceBuffer;
 
     private:
         Resource<Buffer> indexBuffer, vertexBuffer;
+        Mesh::IndexType _indexType;
 };
 
 }}}
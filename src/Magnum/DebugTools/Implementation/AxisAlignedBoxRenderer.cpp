@@ -42,6 +42,13 @@ template<UnsignedInt dimensions> void AxisAlignedBoxRenderer<dimensions>::draw(R
     AbstractBoxRenderer<dimensions>::wireframeMesh->draw(*AbstractBoxRenderer<dimensions>::wireframeShader);
 }
 
+template<UnsignedInt dimensions> void AxisAlignedBoxRenderer<dimensions>::collect(Resource<ShapeRendererOptions>& options, ShapeInstances<dimensions>& instances) {
+    instances.add(*AbstractBoxRenderer<dimensions>::instancedMesh, *AbstractBoxRenderer<dimensions>::instanceBuffer,
+        MatrixTypeFor<dimensions, Float>::translation((axisAlignedBox.min()+axisAlignedBox.max())/2)*
+        MatrixTypeFor<dimensions, Float>::scaling(axisAlignedBox.max()-axisAlignedBox.min()),
+        options->color());
+}
+
 template class AxisAlignedBoxRenderer<2>;
 template class AxisAlignedBoxRenderer<3>;
 
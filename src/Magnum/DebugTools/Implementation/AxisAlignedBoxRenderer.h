@@ -37,6 +37,7 @@ template<UnsignedInt dimensions> class AxisAlignedBoxRenderer: public AbstractBo
         AxisAlignedBoxRenderer(Shapes::Implementation::AbstractShape<dimensions>&&) = delete;
 
         void draw(Resource<ShapeRendererOptions>& options, const MatrixTypeFor<dimensions, Float>& projectionMatrix) override;
+        void collect(Resource<ShapeRendererOptions>& options, ShapeInstances<dimensions>& instances) override;
 
     private:
         const Shapes::AxisAlignedBox<dimensions>& axisAlignedBox;
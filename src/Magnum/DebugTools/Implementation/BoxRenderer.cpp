@@ -40,6 +40,11 @@ template<UnsignedInt dimensions> void BoxRenderer<dimensions>::draw(Resource<Sha
     AbstractBoxRenderer<dimensions>::wireframeMesh->draw(*AbstractBoxRenderer<dimensions>::wireframeShader);
 }
 
+template<UnsignedInt dimensions> void BoxRenderer<dimensions>::collect(Resource<ShapeRendererOptions>& options, ShapeInstances<dimensions>& instances) {
+    instances.add(*AbstractBoxRenderer<dimensions>::instancedMesh, *AbstractBoxRenderer<dimensions>::instanceBuffer,
+        box.transformation(), options->color());
+}
+
 template class BoxRenderer<2>;
 template class BoxRenderer<3>;
 
@@ -37,6 +37,7 @@ template<UnsignedInt dimensions> class BoxRenderer: public AbstractBoxRenderer<d
         BoxRenderer(const Shapes::Implementation::AbstractShape<dimensions>&&) = delete;
 
         void draw(Resource<ShapeRendererOptions>& options, const MatrixTypeFor<dimensions, Float>& projectionMatrix) override;
+        void collect(Resource<ShapeRendererOptions>& options, ShapeInstances<dimensions>& instances) override;
 
     private:
         const Shapes::Box<dimensions>& box;
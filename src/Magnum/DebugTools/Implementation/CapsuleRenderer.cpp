@@ -25,6 +25,7 @@
 
 #include "CapsuleRenderer.h"
 
+#include "Magnum/Buffer.h"
 #include "Magnum/Mesh.h"
 #include "Magnum/MeshView.h"
 #include "Magnum/DebugTools/ResourceManager.h"
@@ -36,12 +37,22 @@
 #include "Magnum/Trade/MeshData3D.h"
 
 #include "CapsuleRendererTransformation.h"
+#include "RendererBatch.h"
 
 namespace Magnum { namespace DebugTools { namespace Implementation {
 
 AbstractCapsuleRenderer<2>::AbstractCapsuleRenderer(): AbstractShapeRenderer<2>("capsule2d", "capsule2d-vertices", "capsule2d-indices") {
     constexpr UnsignedInt rings = 10;
-    if(!wireframeMesh) createResources(Primitives::Capsule2D::wireframe(rings, 1, 1.0f));
+    if(!wireframeMesh) {
+        createResources(Primitives::Capsule2D::wireframe(rings, 1, 1.0f));
+
+        /* Instanced parts, matching the views below */
+        if(isInstancingSupported()) {
+            createInstancedResources("capsule2d-bottom-instanced", "capsule2d-bottom-instances", rings*4, 0, 0, rings*2+1);
+            createInstancedResources("capsule2d-cylinder-instanced", "capsule2d-cylinder-instances", 4, rings*4, rings*2+1, rings*2+3);
+            createInstancedResources("capsule2d-top-instanced", "capsule2d-top-instances", rings*4, rings*4+4, rings*2+3, rings*4+4);
+        }
+    }
 
     /* Bottom hemisphere */
     if(!(bottom = ResourceManager::instance().get<MeshView>("capsule2d-bottom"))) {
@@ -66,12 +77,28 @@ AbstractCapsuleRenderer<2>::AbstractCapsuleRenderer(): AbstractShapeRenderer<2>(
             .setIndexRange(rings*4+4, rings*2+3, rings*4+4);
         ResourceManager::instance().set(top.key(), view, ResourceDataState::Final, ResourcePolicy::Manual);
     }
+
+    instancedBottom = ResourceManager::instance().get<Mesh>("capsule2d-bottom-instanced");
+    instancedCylinder = ResourceManager::instance().get<Mesh>("capsule2d-cylinder-instanced");
+    instancedTop = ResourceManager::instance().get<Mesh>("capsule2d-top-instanced");
+    bottomInstances = ResourceManager::instance().get<Buffer>("capsule2d-bottom-instances");
+    cylinderInstances = ResourceManager::instance().get<Buffer>("capsule2d-cylinder-instances");
+    topInstances = ResourceManager::instance().get<Buffer>("capsule2d-top-instances");
 }
 
 AbstractCapsuleRenderer<3>::AbstractCapsuleRenderer(): AbstractShapeRenderer<3>("capsule3d", "capsule3d-vertices", "capsule3d-indices") {
     constexpr UnsignedInt rings = 10;
     constexpr UnsignedInt segments = 40;
-    if(!wireframeMesh) createResources(Primitives::Capsule3D::wireframe(rings, 1, segments, 1.0f));
+    if(!wireframeMesh) {
+        createResources(Primitives::Capsule3D::wireframe(rings, 1, segments, 1.0f));
+
+        /* Instanced parts, matching the views below */
+        if(isInstancingSupported()) {
+            createInstancedResources("capsule3d-bottom-instanced", "capsule3d-bottom-instances", rings*8, 0, 0, rings*4+1);
+            createInstancedResources("capsule3d-cylinder-instanced", "capsule3d-cylinder-instances", segments*4+8, rings*8, rings*4+1, rings*4+segments*2+5);
+            createInstancedResources("capsule3d-top-instanced", "capsule3d-top-instances", rings*8, rings*8+segments*4+8, rings*4+segments*2+5, rings*8+segments*2+6);
+        }
+    }
 
     /* Bottom hemisphere */
     if(!(bottom = ResourceManager::instance().get<MeshView>("capsule3d-bottom"))) {
@@ -96,6 +123,13 @@ AbstractCapsuleRenderer<3>::AbstractCapsuleRenderer(): AbstractShapeRenderer<3>(
             .setIndexRange(rings*8+segments*4+8, rings*4+segments*2+5, rings*8+segments*2+6);
         ResourceManager::instance().set(top.key(), view, ResourceDataState::Final, ResourcePolicy::Manual);
     }
+
+    instancedBottom = ResourceManager::instance().get<Mesh>("capsule3d-bottom-instanced");
+    instancedCylinder = ResourceManager::instance().get<Mesh>("capsule3d-cylinder-instanced");
+    instancedTop = ResourceManager::instance().get<Mesh>("capsule3d-top-instanced");
+    bottomInstances = ResourceManager::instance().get<Buffer>("capsule3d-bottom-instances");
+    cylinderInstances = ResourceManager::instance().get<Buffer>("capsule3d-cylinder-instances");
+    topInstances = ResourceManager::instance().get<Buffer>("capsule3d-top-instances");
 }
 
 AbstractCapsuleRenderer<2>::~AbstractCapsuleRenderer() = default;
@@ -121,6 +155,14 @@ template<UnsignedInt dimensions> void CapsuleRenderer<dimensions>::draw(Resource
     AbstractCapsuleRenderer<dimensions>::top->draw(*AbstractShapeRenderer<dimensions>::wireframeShader);
 }
 
+template<UnsignedInt dimensions> void CapsuleRenderer<dimensions>::collect(Resource<ShapeRendererOptions>& options, ShapeInstances<dimensions>& instances) {
+    std::array<MatrixTypeFor<dimensions, Float>, 3> transformations = Implementation::capsuleRendererTransformation<dimensions>(capsule.a(), capsule.b(), capsule.radius());
+
+    instances.add(*AbstractCapsuleRenderer<dimensions>::instancedBottom, *AbstractCapsuleRenderer<dimensions>::bottomInstances, transformations[0], options->color());
+    instances.add(*AbstractCapsuleRenderer<dimensions>::instancedCylinder, *AbstractCapsuleRenderer<dimensions>::cylinderInstances, transformations[1], options->color());
+    instances.add(*AbstractCapsuleRenderer<dimensions>::instancedTop, *AbstractCapsuleRenderer<dimensions>::topInstances, transformations[2], options->color());
+}
+
 template class CapsuleRenderer<2>;
 template class CapsuleRenderer<3>;
 
@@ -40,6 +40,8 @@ template<> class AbstractCapsuleRenderer<2>: public AbstractShapeRenderer<2> {
 
     protected:
         Resource<MeshView> bottom, cylinder, top;
+        Resource<Mesh> instancedBottom, instancedCylinder, instancedTop;
+        Resource<Buffer> bottomInstances, cylinderInstances, topInstances;
 };
 
 template<> class AbstractCapsuleRenderer<3>: public AbstractShapeRenderer<3> {
@@ -49,6 +51,8 @@ template<> class AbstractCapsuleRenderer<3>: public AbstractShapeRenderer<3> {
 
     protected:
         Resource<MeshView> bottom, cylinder, top;
+        Resource<Mesh> instancedBottom, instancedCylinder, instancedTop;
+        Resource<Buffer> bottomInstances, cylinderInstances, topInstances;
 };
 
 template<UnsignedInt dimensions> class CapsuleRenderer: public AbstractCapsuleRenderer<dimensions> {
@@ -57,6 +61,7 @@ template<UnsignedInt dimensions> class CapsuleRenderer: public AbstractCapsuleRe
         CapsuleRenderer(const Shapes::Implementation::AbstractShape<dimensions>&&) = delete;
 
         void draw(Resource<ShapeRendererOptions>& options, const MatrixTypeFor<dimensions, Float>& projectionMatrix) override;
+        void collect(Resource<ShapeRendererOptions>& options, ShapeInstances<dimensions>& instances) override;
 
     private:
         const Shapes::Capsule<dimensions>& capsule;
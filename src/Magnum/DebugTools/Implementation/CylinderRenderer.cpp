@@ -38,11 +38,11 @@
 
 namespace Magnum { namespace DebugTools { namespace Implementation {
 
-AbstractCylinderRenderer<2>::AbstractCylinderRenderer(): AbstractShapeRenderer<2>("cylinder2d", "cylinder2d-vertices", {}) {
+AbstractCylinderRenderer<2>::AbstractCylinderRenderer(): AbstractShapeRenderer<2>("cylinder2d", "cylinder2d-vertices", {}, "cylinder2d-instanced", "cylinder2d-instances") {
     if(!wireframeMesh) createResources(Primitives::Square::wireframe());
 }
 
-AbstractCylinderRenderer<3>::AbstractCylinderRenderer(): AbstractShapeRenderer<3>("cylinder3d", "cylinder3d-vertices", "cylinder3d-indices") {
+AbstractCylinderRenderer<3>::AbstractCylinderRenderer(): AbstractShapeRenderer<3>("cylinder3d", "cylinder3d-vertices", "cylinder3d-indices", "cylinder3d-instanced", "cylinder3d-instances") {
     if(!wireframeMesh) createResources(Primitives::Cylinder::wireframe(1, 40, 1.0f));
 }
 
@@ -55,6 +55,12 @@ template<UnsignedInt dimensions> void CylinderRenderer<dimensions>::draw(Resourc
     AbstractShapeRenderer<dimensions>::wireframeMesh->draw(*AbstractShapeRenderer<dimensions>::wireframeShader);
 }
 
+template<UnsignedInt dimensions> void CylinderRenderer<dimensions>::collect(Resource<ShapeRendererOptions>& options, ShapeInstances<dimensions>& instances) {
+    instances.add(*AbstractShapeRenderer<dimensions>::instancedMesh, *AbstractShapeRenderer<dimensions>::instanceBuffer,
+        Implementation::cylinderRendererTransformation<dimensions>(cylinder.a(), cylinder.b(), cylinder.radius()),
+        options->color());
+}
+
 template class CylinderRenderer<2>;
 template class CylinderRenderer<3>;
 
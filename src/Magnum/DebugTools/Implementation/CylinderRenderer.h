@@ -49,6 +49,7 @@ template<UnsignedInt dimensions> class CylinderRenderer: public AbstractCylinder
         CylinderRenderer(const Shapes::Implementation::AbstractShape<dimensions>&&) = delete;
 
         void draw(Resource<ShapeRendererOptions>& options, const MatrixTypeFor<dimensions, Float>& projectionMatrix) override;
+        void collect(Resource<ShapeRendererOptions>& options, ShapeInstances<dimensions>& instances) override;
 
     private:
         const Shapes::Cylinder<dimensions>& cylinder;
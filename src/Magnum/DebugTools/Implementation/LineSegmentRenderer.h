@@ -37,6 +37,7 @@ template<UnsignedInt dimensions> class LineSegmentRenderer: public AbstractShape
         LineSegmentRenderer(const Shapes::Implementation::AbstractShape<dimensions>&&) = delete;
 
         void draw(Resource<ShapeRendererOptions>& options, const MatrixTypeFor<dimensions, Float>& projectionMatrix) override;
+        void collect(Resource<ShapeRendererOptions>& options, ShapeInstances<dimensions>& instances) override;
 
     private:
         const Shapes::LineSegment<dimensions>& line;
@@ -44,12 +44,20 @@ namespace {
     template<> inline ResourceKey vertexBufferKey<2>() { return ResourceKey("point2d-vertices"); }
     template<> inline ResourceKey vertexBufferKey<3>() { return ResourceKey("point3d-vertices"); }
 
+    template<UnsignedInt dimensions> ResourceKey instancedMeshKey();
+    template<> inline ResourceKey instancedMeshKey<2>() { return ResourceKey("point2d-instanced"); }
+    template<> inline ResourceKey instancedMeshKey<3>() { return ResourceKey("point3d-instanced"); }
+
+    template<UnsignedInt dimensions> ResourceKey instanceBufferKey();
+    template<> inline ResourceKey instanceBufferKey<2>() { return ResourceKey("point2d-instances"); }
+    template<> inline ResourceKey instanceBufferKey<3>() { return ResourceKey("point3d-instances"); }
+
     template<UnsignedInt dimensions> typename MeshData<dimensions>::Type meshData();
     template<> inline Trade::MeshData2D meshData<2>() { return Primitives::Crosshair2D::wireframe(); }
     template<> inline Trade::MeshData3D meshData<3>() { return Primitives::Crosshair3D::wireframe(); }
 }
 
-template<UnsignedInt dimensions> PointRenderer<dimensions>::PointRenderer(const Shapes::Implementation::AbstractShape<dimensions>& point): AbstractShapeRenderer<dimensions>(meshKey<dimensions>(), vertexBufferKey<dimensions>(), {}), point(static_cast<const Shapes::Implementation::Shape<Shapes::Point<dimensions>>&>(point).shape) {
+template<UnsignedInt dimensions> PointRenderer<dimensions>::PointRenderer(const Shapes::Implementation::AbstractShape<dimensions>& point): AbstractShapeRenderer<dimensions>(meshKey<dimensions>(), vertexBufferKey<dimensions>(), {}, instancedMeshKey<dimensions>(), instanceBufferKey<dimensions>()), point(static_cast<const Shapes::Implementation::Shape<Shapes::Point<dimensions>>&>(point).shape) {
     if(!AbstractShapeRenderer<dimensions>::wireframeMesh) AbstractShapeRenderer<dimensions>::createResources(meshData<dimensions>());
 }
 
@@ -62,6 +70,13 @@ template<UnsignedInt dimensions> void PointRenderer<dimensions>::draw(Resource<S
     AbstractShapeRenderer<dimensions>::wireframeMesh->draw(*AbstractShapeRenderer<dimensions>::wireframeShader);
 }
 
+template<UnsignedInt dimensions> void PointRenderer<dimensions>::collect(Resource<ShapeRendererOptions>& options, ShapeInstances<dimensions>& instances) {
+    instances.add(*AbstractShapeRenderer<dimensions>::instancedMesh, *AbstractShapeRenderer<dimensions>::instanceBuffer,
+        MatrixTypeFor<dimensions, Float>::translation(point.position())*
+        MatrixTypeFor<dimensions, Float>::scaling(VectorTypeFor<dimensions, Float>{options->pointSize()/2}),
+        options->color());
+}
+
 template class PointRenderer<2>;
 template class PointRenderer<3>;
 
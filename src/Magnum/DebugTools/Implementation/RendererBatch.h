@@ -0,0 +1,104 @@
+#ifndef Magnum_DebugTools_Implementation_RendererBatch_h
+#define Magnum_DebugTools_Implementation_RendererBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/DebugTools/ResourceManager.h"
+#include "Magnum/Shaders/Flat.h"
+
+namespace Magnum { namespace DebugTools { namespace Implementation {
+
+/* Whether renderers in the same drawable group can be batched into instanced
+   draws. On ES2 / WebGL 1 each renderer is drawn separately. */
+inline bool isInstancingSupported() {
+    #ifndef MAGNUM_TARGET_GLES
+    return Context::current().isExtensionSupported<Extensions::GL::ARB::instanced_arrays>() &&
+        Context::current().isExtensionSupported<Extensions::GL::ARB::draw_instanced>();
+    #elif !defined(MAGNUM_TARGET_GLES2)
+    return true;
+    #else
+    return false;
+    #endif
+}
+
+template<UnsignedInt dimensions> ResourceKey instancedShaderKey();
+template<> inline ResourceKey instancedShaderKey<2>() { return ResourceKey("FlatInstancedShader2D"); }
+template<> inline ResourceKey instancedShaderKey<3>() { return ResourceKey("FlatInstancedShader3D"); }
+
+/* Flat shader taking transformation and color from instanced attributes */
+template<UnsignedInt dimensions> Resource<AbstractShaderProgram, Shaders::Flat<dimensions>> instancedShader() {
+    Resource<AbstractShaderProgram, Shaders::Flat<dimensions>> shader = ResourceManager::instance().get<AbstractShaderProgram, Shaders::Flat<dimensions>>(instancedShaderKey<dimensions>());
+    if(!shader) ResourceManager::instance().set<AbstractShaderProgram>(shader.key(),
+        new Shaders::Flat<dimensions>{typename Shaders::Flat<dimensions>::Flags{Shaders::Flat<dimensions>::Flag::VertexColor}|Shaders::Flat<dimensions>::Flag::InstancedTransformation},
+        ResourceDataState::Final, ResourcePolicy::Resident);
+    return shader;
+}
+
+/* Batches of renderers, one for each drawable group. Batch is expected to
+   have `key`, `renderers` and `dirty` members. */
+template<class Batch> std::unordered_map<const void*, std::unique_ptr<Batch>>& batches() {
+    static std::unordered_map<const void*, std::unique_ptr<Batch>> batches;
+    return batches;
+}
+
+/* Returns nullptr if the renderer can't be batched */
+template<class Batch, class Renderer> Batch* addToBatch(const void* drawables, Renderer& renderer) {
+    if(!drawables || !isInstancingSupported()) return nullptr;
+
+    std::unique_ptr<Batch>& batch = batches<Batch>()[drawables];
+    if(!batch) {
+        batch.reset(new Batch);
+        batch->key = drawables;
+    }
+    batch->renderers.push_back(&renderer);
+    batch->dirty = true;
+    return batch.get();
+}
+
+template<class Batch, class Renderer> void removeFromBatch(Batch& batch, Renderer& renderer) {
+    batch.renderers.erase(std::find(batch.renderers.begin(), batch.renderers.end(), &renderer));
+    batch.dirty = true;
+    if(batch.renderers.empty()) batches<Batch>().erase(batch.key);
+}
+
+/* Last batch which uploaded its instances to given buffer. Instance buffers
+   are shared among all batches of the same kind, so each batch has to
+   reupload its data if some other batch used the buffer in the meantime. */
+inline const void*& instanceBufferOwner(const Buffer& buffer) {
+    static std::unordered_map<const Buffer*, const void*> owners;
+    return owners[&buffer];
+}
+
+}}}
+
+#endif
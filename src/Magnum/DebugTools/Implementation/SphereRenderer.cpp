@@ -36,11 +36,11 @@
 
 namespace Magnum { namespace DebugTools { namespace Implementation {
 
-AbstractSphereRenderer<2>::AbstractSphereRenderer(): AbstractShapeRenderer<2>("sphere2d", "sphere2d-vertices", {}) {
+AbstractSphereRenderer<2>::AbstractSphereRenderer(): AbstractShapeRenderer<2>("sphere2d", "sphere2d-vertices", {}, "sphere2d-instanced", "sphere2d-instances") {
     if(!wireframeMesh) createResources(Primitives::Circle::wireframe(40));
 }
 
-AbstractSphereRenderer<3>::AbstractSphereRenderer(): AbstractShapeRenderer<3>("sphere3d", "sphere3d-vertices", "sphere3d-indices") {
+AbstractSphereRenderer<3>::AbstractSphereRenderer(): AbstractShapeRenderer<3>("sphere3d", "sphere3d-vertices", "sphere3d-indices", "sphere3d-instanced", "sphere3d-instances") {
     if(!wireframeMesh) createResources(Primitives::UVSphere::wireframe(20, 40));
 }
 
@@ -54,6 +54,13 @@ template<UnsignedInt dimensions> void SphereRenderer<dimensions>::draw(Resource<
     AbstractShapeRenderer<dimensions>::wireframeMesh->draw(*AbstractShapeRenderer<dimensions>::wireframeShader);
 }
 
+template<UnsignedInt dimensions> void SphereRenderer<dimensions>::collect(Resource<ShapeRendererOptions>& options, ShapeInstances<dimensions>& instances) {
+    instances.add(*AbstractShapeRenderer<dimensions>::instancedMesh, *AbstractShapeRenderer<dimensions>::instanceBuffer,
+        MatrixTypeFor<dimensions, Float>::translation(sphere.position())*
+        MatrixTypeFor<dimensions, Float>::scaling(VectorTypeFor<dimensions, Float>{sphere.radius()}),
+        options->color());
+}
+
 template class SphereRenderer<2>;
 template class SphereRenderer<3>;
 
@@ -32,8 +32,24 @@
 #include "Magnum/SceneGraph/Camera.h"
 #include "Magnum/Shaders/VertexColor.h"
 
+#include "Implementation/RendererBatch.h"
+
 namespace Magnum { namespace DebugTools {
 
+namespace Implementation {
+
+template<UnsignedInt dimensions> struct ObjectRendererBatch {
+    explicit ObjectRendererBatch(): key{}, dirty{true}, shader{instancedShader<dimensions>()} {}
+
+    const void* key;
+    std::vector<ObjectRenderer<dimensions>*> renderers;
+    std::vector<MatrixTypeFor<dimensions, Float>> transformations;
+    bool dirty;
+    Resource<AbstractShaderProgram, Shaders::Flat<dimensions>> shader;
+};
+
+}
+
 namespace {
 
 template<UnsignedInt> struct Renderer;
@@ -43,6 +59,8 @@ template<> struct Renderer<2> {
     static ResourceKey vertexBuffer() { return {"object2d-vertices"}; }
     static ResourceKey indexBuffer() { return {"object2d-indices"}; }
     static ResourceKey mesh() { return {"object2d"}; }
+    static ResourceKey instancedMesh() { return {"object2d-instanced"}; }
+    static ResourceKey instanceBuffer() { return {"object2d-instances"}; }
 
     static const std::array<Vector2, 8> positions;
     static const std::array<Color3, 8> colors;
@@ -88,6 +106,8 @@ template<> struct Renderer<3> {
     static ResourceKey vertexBuffer() { return {"object3d-vertices"}; }
     static ResourceKey indexBuffer() { return {"object3d-indices"}; }
     static ResourceKey mesh() { return {"object3d"}; }
+    static ResourceKey instancedMesh() { return {"object3d-instanced"}; }
+    static ResourceKey instanceBuffer() { return {"object3d-instances"}; }
 
     static const std::array<Vector3, 12> positions;
     static const std::array<Color3, 12> colors;
@@ -145,7 +165,9 @@ const std::array<UnsignedByte, 18> Renderer<3>::indices{{
 }
 
 /* MSVC 2015 can't handle {} here */
-template<UnsignedInt dimensions> ObjectRenderer<dimensions>::ObjectRenderer(SceneGraph::AbstractObject<dimensions, Float>& object, ResourceKey options, SceneGraph::DrawableGroup<dimensions, Float>* drawables): SceneGraph::Drawable<dimensions, Float>(object, drawables), _options{ResourceManager::instance().get<ObjectRendererOptions>(options)} {
+template<UnsignedInt dimensions> ObjectRenderer<dimensions>::ObjectRenderer(SceneGraph::AbstractObject<dimensions, Float>& object, ResourceKey options, SceneGraph::DrawableGroup<dimensions, Float>* drawables): SceneGraph::Drawable<dimensions, Float>(object, drawables), _options{ResourceManager::instance().get<ObjectRendererOptions>(options)}, _batchedSize{}, _dirty{true} {
+    _batch = Implementation::addToBatch<Implementation::ObjectRendererBatch<dimensions>>(drawables, *this);
+
     /* Shader */
     _shader = ResourceManager::instance().get<AbstractShaderProgram, Shaders::VertexColor<dimensions>>(Renderer<dimensions>::shader());
     if(!_shader) ResourceManager::instance().set<AbstractShaderProgram>(_shader.key(), new Shaders::VertexColor<dimensions>);
@@ -154,6 +176,8 @@ template<UnsignedInt dimensions> ObjectRenderer<dimensions>::ObjectRenderer(Scen
     _mesh = ResourceManager::instance().get<Mesh>(Renderer<dimensions>::mesh());
     _vertexBuffer = ResourceManager::instance().get<Buffer>(Renderer<dimensions>::vertexBuffer());
     _indexBuffer = ResourceManager::instance().get<Buffer>(Renderer<dimensions>::indexBuffer());
+    _instancedMesh = ResourceManager::instance().get<Mesh>(Renderer<dimensions>::instancedMesh());
+    _instanceBuffer = ResourceManager::instance().get<Buffer>(Renderer<dimensions>::instanceBuffer());
     if(_mesh) return;
 
     /* Create the mesh */
@@ -173,17 +197,87 @@ template<UnsignedInt dimensions> ObjectRenderer<dimensions>::ObjectRenderer(Scen
             typename Shaders::VertexColor<dimensions>::Position(),
             typename Shaders::VertexColor<dimensions>::Color())
         .setIndexBuffer(*indexBuffer, 0, Mesh::IndexType::UnsignedByte, 0, Renderer<dimensions>::positions.size());
-    ResourceManager::instance().set<Mesh>(_mesh.key(), _mesh, ResourceDataState::Final, ResourcePolicy::Manual);
+    ResourceManager::instance().set<Mesh>(_mesh.key(), mesh, ResourceDataState::Final, ResourcePolicy::Manual);
+
+    /* Instanced mesh sharing the buffers, with per-instance transformation */
+    if(!Implementation::isInstancingSupported()) return;
+
+    Buffer* instanceBuffer = new Buffer{Buffer::TargetHint::Array};
+    ResourceManager::instance().set(_instanceBuffer.key(), instanceBuffer, ResourceDataState::Final, ResourcePolicy::Manual);
+
+    Mesh* instancedMesh = new Mesh;
+    instancedMesh->setPrimitive(MeshPrimitive::Lines)
+        .setCount(Renderer<dimensions>::indices.size())
+        .addVertexBuffer(*vertexBuffer, 0,
+            typename Shaders::VertexColor<dimensions>::Position(),
+            typename Shaders::VertexColor<dimensions>::Color())
+        .addVertexBufferInstanced(*instanceBuffer, 1, 0,
+            typename Shaders::Flat<dimensions>::TransformationMatrix())
+        .setIndexBuffer(*indexBuffer, 0, Mesh::IndexType::UnsignedByte, 0, Renderer<dimensions>::positions.size());
+    ResourceManager::instance().set(_instancedMesh.key(), instancedMesh, ResourceDataState::Final, ResourcePolicy::Manual);
 }
 
 /* To avoid deleting pointers to incomplete type on destruction of Resource members */
-template<UnsignedInt dimensions> ObjectRenderer<dimensions>::~ObjectRenderer() = default;
+template<UnsignedInt dimensions> ObjectRenderer<dimensions>::~ObjectRenderer() {
+    if(_batch) Implementation::removeFromBatch(*_batch, *this);
+}
+
+template<UnsignedInt dimensions> void ObjectRenderer<dimensions>::markDirty() {
+    _dirty = true;
+}
 
 template<UnsignedInt dimensions> void ObjectRenderer<dimensions>::draw(const MatrixTypeFor<dimensions, Float>& transformationMatrix, SceneGraph::Camera<dimensions, Float>& camera) {
+    /* The whole batch is drawn by its first renderer */
+    if(_batch) {
+        if(_batch->renderers.front() == this)
+            drawBatch(camera.projectionMatrix()*camera.cameraMatrix());
+        return;
+    }
+
     _shader->setTransformationProjectionMatrix(camera.projectionMatrix()*transformationMatrix*MatrixTypeFor<dimensions, Float>::scaling(VectorTypeFor<dimensions, Float>{_options->size()}));
     _mesh->draw(*_shader);
 }
 
+template<UnsignedInt dimensions> void ObjectRenderer<dimensions>::drawBatch(const MatrixTypeFor<dimensions, Float>& projectionMatrix) {
+    Implementation::ObjectRendererBatch<dimensions>& batch = *_batch;
+
+    for(ObjectRenderer<dimensions>* renderer: batch.renderers) {
+        /* Clean the object so next transformation change marks the renderer
+           as dirty again */
+        if(renderer->_dirty) {
+            renderer->object().setClean();
+            renderer->_batchedTransformation = renderer->object().absoluteTransformationMatrix();
+            renderer->_dirty = false;
+            batch.dirty = true;
+        }
+
+        if(renderer->_options->size() != renderer->_batchedSize) {
+            renderer->_batchedSize = renderer->_options->size();
+            batch.dirty = true;
+        }
+    }
+
+    if(batch.dirty) {
+        batch.transformations.clear();
+        for(ObjectRenderer<dimensions>* renderer: batch.renderers)
+            batch.transformations.push_back(renderer->_batchedTransformation*MatrixTypeFor<dimensions, Float>::scaling(VectorTypeFor<dimensions, Float>{renderer->_batchedSize}));
+    }
+
+    /* The instance buffer is shared among all batches */
+    const void*& owner = Implementation::instanceBufferOwner(*_instanceBuffer);
+    if(batch.dirty || owner != &batch) {
+        _instanceBuffer->setData(batch.transformations, BufferUsage::DynamicDraw);
+        owner = &batch;
+    }
+    batch.dirty = false;
+
+    /* Colors come from the vertices */
+    batch.shader->setTransformationProjectionMatrix(projectionMatrix)
+        .setColor(Color4{1.0f});
+    _instancedMesh->setInstanceCount(batch.transformations.size())
+        .draw(*batch.shader);
+}
+
 template class ObjectRenderer<2>;
 template class ObjectRenderer<3>;
 
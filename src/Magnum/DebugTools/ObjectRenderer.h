@@ -30,12 +30,18 @@
  */
 
 #include "Magnum/Resource.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
 #include "Magnum/SceneGraph/Drawable.h"
 #include "Magnum/Shaders/Shaders.h"
 #include "Magnum/DebugTools/visibility.h"
 
 namespace Magnum { namespace DebugTools {
 
+namespace Implementation {
+    template<UnsignedInt> struct ObjectRendererBatch;
+}
+
 /**
 @brief Object renderer options
 
@@ -82,6 +88,12 @@ Object3D* object;
 new DebugTools::ObjectRenderer2D(object, "my", debugDrawables);
 @endcode
 
+If instanced rendering is supported, all object renderers added to the same
+drawable group in the constructor are drawn with a single instanced draw call,
+similarly to @ref DebugTools-ShapeRenderer-batching "batching in ShapeRenderer".
+The instance buffer is rebuilt only if some object is marked as dirty, some
+renderer is added or removed or the size in its options changes.
+
 @see @ref ObjectRenderer2D, @ref ObjectRenderer3D, @ref ObjectRendererOptions
 */
 template<UnsignedInt dimensions> class MAGNUM_DEBUGTOOLS_EXPORT ObjectRenderer: public SceneGraph::Drawable<dimensions, Float> {
@@ -101,12 +113,19 @@ template<UnsignedInt dimensions> class MAGNUM_DEBUGTOOLS_EXPORT ObjectRenderer:
         ~ObjectRenderer();
 
     private:
+        void markDirty() override;
         void draw(const MatrixTypeFor<dimensions, Float>& transformationMatrix, SceneGraph::Camera<dimensions, Float>& camera) override;
+        void drawBatch(const MatrixTypeFor<dimensions, Float>& projectionMatrix);
 
         Resource<ObjectRendererOptions> _options;
         Resource<AbstractShaderProgram, Shaders::VertexColor<dimensions>> _shader;
-        Resource<Mesh> _mesh;
-        Resource<Buffer> _vertexBuffer, _indexBuffer;
+        Resource<Mesh> _mesh, _instancedMesh;
+        Resource<Buffer> _vertexBuffer, _indexBuffer, _instanceBuffer;
+
+        Implementation::ObjectRendererBatch<dimensions>* _batch;
+        MatrixTypeFor<dimensions, Float> _batchedTransformation;
+        Float _batchedSize;
+        bool _dirty;
 };
 
 /** @brief Two-dimensional object renderer */
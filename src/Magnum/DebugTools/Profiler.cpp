@@ -31,11 +31,22 @@
 #include <Corrade/Utility/Debug.h>
 
 #include "Magnum/Magnum.h"
+#ifndef MAGNUM_TARGET_WEBGL
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#endif
 
 using namespace std::chrono;
 
 namespace Magnum { namespace DebugTools {
 
+#ifndef MAGNUM_TARGET_WEBGL
+namespace {
+    /* Marks end of measured time in GPU timestamps */
+    constexpr Profiler::Section NoSection = ~Profiler::Section{};
+}
+#endif
+
 Profiler::Section Profiler::addSection(const std::string& name) {
     CORRADE_ASSERT(!_enabled, "Profiler: cannot add section when profiling is enabled", 0);
     _sections.push_back(name);
@@ -47,11 +58,45 @@ void Profiler::setMeasureDuration(std::size_t frames) {
     _measureDuration = frames;
 }
 
+#ifndef MAGNUM_TARGET_WEBGL
+void Profiler::setGpuTimeEnabled(const bool enabled) {
+    CORRADE_ASSERT(!_enabled, "Profiler: cannot enable GPU time measurement when profiling is enabled", );
+
+    #if !defined(CORRADE_TARGET_NACL) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+    #ifndef MAGNUM_TARGET_GLES
+    if(enabled && !Context::current().isExtensionSupported<Extensions::GL::ARB::timer_query>())
+    #else
+    if(enabled && !Context::current().isExtensionSupported<Extensions::GL::EXT::disjoint_timer_query>())
+    #endif
+    #else
+    if(enabled)
+    #endif
+    {
+        Warning() << "Profiler::setGpuTimeEnabled(): timer queries are not supported, GPU time won't be measured";
+        return;
+    }
+
+    _gpuTimeEnabled = enabled;
+}
+#endif
+
 void Profiler::enable() {
     _enabled = true;
     _frameData.assign(_measureDuration*_sections.size(), high_resolution_clock::duration::zero());
     _totalData.assign(_sections.size(), high_resolution_clock::duration::zero());
     _frameCount = 0;
+
+    #ifndef MAGNUM_TARGET_WEBGL
+    /* Timestamps in flight are still retrieved so the queries get back into
+       the pool, but their results are discarded */
+    _gpuFrameData.assign(_measureDuration*_sections.size(), 0);
+    _gpuTotalData.assign(_sections.size(), 0);
+    _currentGpuFrame = 0;
+    _gpuFrameCount = 0;
+    for(const std::pair<Section, std::size_t>& timestamp: _gpuTimestamps)
+        _gpuFreeQueries.push_back(timestamp.second);
+    _gpuTimestamps.clear();
+    #endif
 }
 
 void Profiler::disable() {
@@ -65,6 +110,10 @@ void Profiler::start(Section section) {
     save();
 
     _currentSection = section;
+
+    #ifndef MAGNUM_TARGET_WEBGL
+    if(_gpuTimeEnabled) gpuTimestamp(section);
+    #endif
 }
 
 void Profiler::stop() {
@@ -73,6 +122,10 @@ void Profiler::stop() {
     save();
 
     _previousTime = high_resolution_clock::time_point();
+
+    #ifndef MAGNUM_TARGET_WEBGL
+    if(_gpuTimeEnabled) gpuTimestamp(NoSection);
+    #endif
 }
 
 void Profiler::save() {
@@ -106,8 +159,77 @@ void Profiler::nextFrame() {
     _currentFrame = nextFrame;
 
     if(_frameCount < _measureDuration) ++_frameCount;
+
+    #ifndef MAGNUM_TARGET_WEBGL
+    if(_gpuTimeEnabled) {
+        /* If a section is running, end the frame with a timestamp and start
+           the next frame with another one */
+        const bool running = _previousTime != high_resolution_clock::time_point();
+        if(running) gpuTimestamp(NoSection);
+        if(!_gpuTimestamps.empty()) {
+            _gpuPendingFrames.push_back(std::move(_gpuTimestamps));
+            _gpuTimestamps.clear();
+        }
+        if(running) gpuTimestamp(_currentSection);
+
+        gpuRetrieve();
+    }
+    #endif
 }
 
+#ifndef MAGNUM_TARGET_WEBGL
+void Profiler::gpuTimestamp(const Section section) {
+    std::size_t query;
+    if(!_gpuFreeQueries.empty()) {
+        query = _gpuFreeQueries.back();
+        _gpuFreeQueries.pop_back();
+    } else {
+        query = _gpuQueries.size();
+        _gpuQueries.emplace_back(TimeQuery::Target::Timestamp);
+    }
+
+    _gpuQueries[query].timestamp();
+    _gpuTimestamps.emplace_back(section, query);
+}
+
+void Profiler::gpuRetrieve() {
+    /* Timestamps are processed in order, so if the last one from the oldest
+       frame is available, all others from it are as well. Stop at the first
+       frame that's not done yet to never wait for the GPU. */
+    std::vector<UnsignedLong> durations(_sections.size());
+    while(!_gpuPendingFrames.empty() && _gpuQueries[_gpuPendingFrames.front().back().second].resultAvailable()) {
+        const GpuTimestamps& timestamps = _gpuPendingFrames.front();
+
+        std::fill(durations.begin(), durations.end(), 0);
+        UnsignedLong previous = _gpuQueries[timestamps.front().second].result<UnsignedLong>();
+        for(std::size_t i = 1; i < timestamps.size(); ++i) {
+            const UnsignedLong current = _gpuQueries[timestamps[i].second].result<UnsignedLong>();
+            const Section section = timestamps[i - 1].first;
+            if(section != NoSection && section < _sections.size())
+                durations[section] += current - previous;
+            previous = current;
+        }
+
+        for(const std::pair<Section, std::size_t>& timestamp: timestamps)
+            _gpuFreeQueries.push_back(timestamp.second);
+        _gpuPendingFrames.pop_front();
+
+        /* Frames queued before the profiler was (re)enabled are discarded */
+        if(!_enabled || _gpuFrameData.size() != _measureDuration*_sections.size()) continue;
+
+        /* Replace the oldest frame in the ring with this one */
+        for(std::size_t i = 0; i != _sections.size(); ++i) {
+            UnsignedLong& data = _gpuFrameData[_currentGpuFrame*_sections.size() + i];
+            _gpuTotalData[i] += durations[i] - data;
+            data = durations[i];
+        }
+
+        _currentGpuFrame = (_currentGpuFrame + 1) % _measureDuration;
+        if(_gpuFrameCount < _measureDuration) ++_gpuFrameCount;
+    }
+}
+#endif
+
 void Profiler::printStatistics() {
     if(!_enabled) return;
 
@@ -117,8 +239,17 @@ void Profiler::printStatistics() {
     std::sort(totalSorted.begin(), totalSorted.end(), [this](std::size_t i, std::size_t j){return _totalData[i] > _totalData[j];});
 
     Debug() << "Statistics for last" << _measureDuration << "frames:";
-    for(std::size_t i = 0; i != _sections.size(); ++i)
-        Debug() << " " << _sections[totalSorted[i]] << duration_cast<microseconds>(_totalData[totalSorted[i]]).count()/_frameCount << u8"µs";
+    for(std::size_t i = 0; i != _sections.size(); ++i) {
+        Debug d;
+        d << " " << _sections[totalSorted[i]] << duration_cast<microseconds>(_totalData[totalSorted[i]]).count()/_frameCount << u8"µs";
+
+        #ifndef MAGNUM_TARGET_WEBGL
+        if(_gpuTimeEnabled) {
+            if(_gpuFrameCount) d << "(GPU" << _gpuTotalData[totalSorted[i]]/1000/_gpuFrameCount << Debug::nospace << u8"µs)";
+            else d << "(GPU time not available yet)";
+        }
+        #endif
+    }
 }
 
 }}
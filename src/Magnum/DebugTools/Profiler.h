@@ -30,6 +30,7 @@
  */
 
 #include <chrono>
+#include <deque>
 #include <initializer_list>
 #include <string>
 #include <vector>
@@ -37,6 +38,10 @@
 #include "Magnum/Types.h"
 #include "Magnum/DebugTools/visibility.h"
 
+#ifndef MAGNUM_TARGET_WEBGL
+#include "Magnum/TimeQuery.h"
+#endif
+
 namespace Magnum { namespace DebugTools {
 
 /**
@@ -96,6 +101,28 @@ p.printStatistics();
 It's possible to start profiler only for certain parts of the code and then
 stop it again using @ref stop(), if you are not interested in profiling the rest.
 
+@anchor DebugTools-Profiler-gpu-time
+## GPU time
+
+CPU time of a section says only how long it took to submit the commands, not
+how long the GPU spent executing them. Call @ref setGpuTimeEnabled() before
+enabling the profiler to also measure GPU time of each section:
+@code
+DebugTools::Profiler p;
+p.setGpuTimeEnabled(true);
+p.enable();
+@endcode
+
+A @ref TimeQuery timestamp is then issued at each section boundary. The
+results are retrieved in @ref nextFrame() only when all timestamps from given
+frame are available, which is usually a couple of frames later, so the
+measurement never stalls the pipeline. The queries are taken from a pool and
+reused once their result is read, so no GL objects are created after the first
+few frames. Averaged GPU time is shown next to the CPU time in
+@ref printStatistics().
+
+For nested zones, multi-threaded use and trace export see @ref ZoneProfiler.
+
 @todo Some unit testing
 @todo More time intervals
 */
@@ -115,7 +142,11 @@ class MAGNUM_DEBUGTOOLS_EXPORT Profiler {
          */
         static const Section otherSection = 0;
 
-        explicit Profiler(): _enabled(false), _measureDuration(60), _currentFrame(0), _frameCount(0), _sections{"Other"}, _currentSection(otherSection) {}
+        explicit Profiler(): _enabled(false), _measureDuration(60), _currentFrame(0), _frameCount(0), _sections{"Other"}, _currentSection(otherSection)
+            #ifndef MAGNUM_TARGET_WEBGL
+            , _gpuTimeEnabled(false), _currentGpuFrame(0), _gpuFrameCount(0)
+            #endif
+            {}
 
         /**
          * @brief Set measure duration
@@ -134,6 +165,28 @@ class MAGNUM_DEBUGTOOLS_EXPORT Profiler {
          */
         Section addSection(const std::string& name);
 
+        #if defined(DOXYGEN_GENERATING_OUTPUT) || !defined(MAGNUM_TARGET_WEBGL)
+        /**
+         * @brief Whether GPU time is measured
+         *
+         * @see @ref setGpuTimeEnabled()
+         */
+        bool isGpuTimeEnabled() const { return _gpuTimeEnabled; }
+
+        /**
+         * @brief Enable or disable GPU time measurement
+         *
+         * Disabled by default. See @ref DebugTools-Profiler-gpu-time "class documentation"
+         * for more information. If timer queries are not supported, prints a
+         * warning and does nothing.
+         * @attention This function cannot be called if profiling is enabled.
+         * @requires_gl33 Extension @extension{ARB,timer_query}
+         * @requires_es_extension Extension @es_extension{EXT,disjoint_timer_query}
+         * @requires_gles Time query is not available in WebGL.
+         */
+        void setGpuTimeEnabled(bool enabled);
+        #endif
+
         /**
          * @brief Whether profiling is enabled
          *
@@ -193,13 +246,18 @@ class MAGNUM_DEBUGTOOLS_EXPORT Profiler {
         /**
          * @brief Print statistics
          *
-         * Prints statistics about previous frame ordered by duration.
+         * Prints statistics about previous frame ordered by duration. If
+         * GPU time is measured, it's printed next to the CPU time.
          * @note Does nothing if profiling is disabled.
          */
         void printStatistics();
 
     private:
         void save();
+        #ifndef MAGNUM_TARGET_WEBGL
+        void gpuTimestamp(Section section);
+        void gpuRetrieve();
+        #endif
 
         bool _enabled;
         std::size_t _measureDuration, _currentFrame, _frameCount;
@@ -208,6 +266,21 @@ class MAGNUM_DEBUGTOOLS_EXPORT Profiler {
         std::vector<std::chrono::high_resolution_clock::duration> _totalData;
         std::chrono::high_resolution_clock::time_point _previousTime;
         Section _currentSection;
+
+        #ifndef MAGNUM_TARGET_WEBGL
+        /* Section started at given timestamp query, the last one in a frame
+           ends the previous section */
+        typedef std::vector<std::pair<Section, std::size_t>> GpuTimestamps;
+
+        bool _gpuTimeEnabled;
+        std::vector<TimeQuery> _gpuQueries;
+        std::vector<std::size_t> _gpuFreeQueries;
+        GpuTimestamps _gpuTimestamps;
+        std::deque<GpuTimestamps> _gpuPendingFrames;
+        std::vector<UnsignedLong> _gpuFrameData;
+        std::vector<UnsignedLong> _gpuTotalData;
+        std::size_t _currentGpuFrame, _gpuFrameCount;
+        #endif
 };
 
 }}
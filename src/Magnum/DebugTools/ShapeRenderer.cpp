@@ -25,6 +25,8 @@
 
 #include "ShapeRenderer.h"
 
+#include "Magnum/Buffer.h"
+#include "Magnum/Mesh.h"
 #include "Magnum/DebugTools/ResourceManager.h"
 #include "Magnum/Shapes/Composition.h"
 #include "Magnum/Shapes/Shape.h"
@@ -37,11 +39,22 @@
 #include "Implementation/LineSegmentRenderer.h"
 #include "Implementation/PointRenderer.h"
 #include "Implementation/SphereRenderer.h"
+#include "Implementation/RendererBatch.h"
 
 namespace Magnum { namespace DebugTools {
 
 namespace Implementation {
 
+template<UnsignedInt dimensions> struct ShapeRendererBatch {
+    explicit ShapeRendererBatch(): key{}, dirty{true}, shader{instancedShader<dimensions>()} {}
+
+    const void* key;
+    std::vector<ShapeRenderer<dimensions>*> renderers;
+    ShapeInstances<dimensions> instances;
+    bool dirty;
+    Resource<AbstractShaderProgram, Shaders::Flat<dimensions>> shader;
+};
+
 template<> void createDebugMesh(ShapeRenderer<2>& renderer, const Shapes::Implementation::AbstractShape<2>& shape) {
     switch(shape.type()) {
         case Shapes::AbstractShape2D::Type::AxisAlignedBox:
@@ -114,19 +127,77 @@ template<> void createDebugMesh(ShapeRenderer<3>& renderer, const Shapes::Implem
 
 }
 
-template<UnsignedInt dimensions> ShapeRenderer<dimensions>::ShapeRenderer(Shapes::AbstractShape<dimensions>& shape, ResourceKey options, SceneGraph::DrawableGroup<dimensions, Float>* drawables): SceneGraph::Drawable<dimensions, Float>(shape.object(), drawables), _options(ResourceManager::instance().get<ShapeRendererOptions>(options)) {
+template<UnsignedInt dimensions> ShapeRenderer<dimensions>::ShapeRenderer(Shapes::AbstractShape<dimensions>& shape, ResourceKey options, SceneGraph::DrawableGroup<dimensions, Float>* drawables): SceneGraph::Drawable<dimensions, Float>(shape.object(), drawables), _options(ResourceManager::instance().get<ShapeRendererOptions>(options)), _batchedPointSize{}, _dirty{true} {
     Implementation::createDebugMesh(*this, Shapes::Implementation::getAbstractShape(shape));
+    _batch = Implementation::addToBatch<Implementation::ShapeRendererBatch<dimensions>>(drawables, *this);
 }
 
 template<UnsignedInt dimensions> ShapeRenderer<dimensions>::~ShapeRenderer() {
+    if(_batch) Implementation::removeFromBatch(*_batch, *this);
     for(auto i: _renderers) delete i;
 }
 
+template<UnsignedInt dimensions> void ShapeRenderer<dimensions>::markDirty() {
+    _dirty = true;
+}
+
 template<UnsignedInt dimensions> void ShapeRenderer<dimensions>::draw(const MatrixTypeFor<dimensions, Float>&, SceneGraph::Camera<dimensions, Float>& camera) {
     const MatrixTypeFor<dimensions, Float> projectionMatrix = camera.projectionMatrix()*camera.cameraMatrix();
+
+    /* The whole batch is drawn by its first renderer */
+    if(_batch) {
+        if(_batch->renderers.front() == this) drawBatch(projectionMatrix);
+        return;
+    }
+
     for(auto i: _renderers) i->draw(_options, projectionMatrix);
 }
 
+template<UnsignedInt dimensions> void ShapeRenderer<dimensions>::drawBatch(const MatrixTypeFor<dimensions, Float>& projectionMatrix) {
+    Implementation::ShapeRendererBatch<dimensions>& batch = *_batch;
+
+    for(ShapeRenderer<dimensions>* renderer: batch.renderers) {
+        /* Clean the object so the transformed shape is up-to-date and next
+           transformation change marks the renderer as dirty again */
+        if(renderer->_dirty) {
+            renderer->object().setClean();
+            renderer->_dirty = false;
+            batch.dirty = true;
+        }
+
+        if(renderer->_options->color() != renderer->_batchedColor || renderer->_options->pointSize() != renderer->_batchedPointSize) {
+            renderer->_batchedColor = renderer->_options->color();
+            renderer->_batchedPointSize = renderer->_options->pointSize();
+            batch.dirty = true;
+        }
+    }
+
+    /* Recollect the instances only if anything changed */
+    if(batch.dirty) {
+        batch.instances.clear();
+        for(ShapeRenderer<dimensions>* renderer: batch.renderers)
+            for(auto i: renderer->_renderers) i->collect(renderer->_options, batch.instances);
+    }
+
+    batch.shader->setTransformationProjectionMatrix(projectionMatrix)
+        .setColor(Color4{1.0f});
+    for(auto& part: batch.instances.parts) {
+        if(part.instances.empty()) continue;
+
+        /* The instance buffers are shared among all batches */
+        const void*& owner = Implementation::instanceBufferOwner(*part.buffer);
+        if(batch.dirty || owner != &batch) {
+            part.buffer->setData(part.instances, BufferUsage::DynamicDraw);
+            owner = &batch;
+        }
+
+        part.mesh->setInstanceCount(part.instances.size())
+            .draw(*batch.shader);
+    }
+
+    batch.dirty = false;
+}
+
 template class ShapeRenderer<2>;
 template class ShapeRenderer<3>;
 
@@ -42,6 +42,7 @@ template<UnsignedInt> class ShapeRenderer;
 
 namespace Implementation {
     template<UnsignedInt> class AbstractShapeRenderer;
+    template<UnsignedInt> struct ShapeRendererBatch;
 
     template<UnsignedInt dimensions> void createDebugMesh(ShapeRenderer<dimensions>& renderer, const Shapes::Implementation::AbstractShape<dimensions>& shape);
 }
@@ -134,6 +135,21 @@ Shapes::AbstractShape2D* shape;
 new DebugTools::ShapeRenderer2D(shape, "red", debugDrawables);
 @endcode
 
+@anchor DebugTools-ShapeRenderer-batching
+## Batching
+
+If instanced rendering is supported, all shape renderers added to the same
+drawable group in the constructor are batched together and drawn using one
+instanced draw call per shape type, with transformation and color of each shape
+taken from an instance buffer. The whole batch is drawn when the first
+renderer of the group is drawn, so the renderers shouldn't be moved to other
+drawable groups and the group shouldn't be culled per-drawable. The instance
+buffers are rebuilt only if some shape object is marked as dirty, some renderer
+is added or removed or the color or point size in its options changes, objects
+that are drawn are cleaned automatically. Without instancing support (i.e. on
+OpenGL ES 2.0 and WebGL 1.0) or if no drawable group is passed in the
+constructor, each shape is drawn separately.
+
 @see @ref ShapeRenderer2D, @ref ShapeRenderer3D, @ref ShapeRendererOptions
 
 @todo Different drawing style for inverted shapes? (marking the "inside" somehow)
@@ -161,10 +177,17 @@ template<UnsignedInt dimensions> class MAGNUM_DEBUGTOOLS_EXPORT ShapeRenderer: p
         ~ShapeRenderer();
 
     private:
+        void markDirty() override;
         void draw(const MatrixTypeFor<dimensions, Float>& transformationMatrix, SceneGraph::Camera<dimensions, Float>& camera) override;
+        void drawBatch(const MatrixTypeFor<dimensions, Float>& projectionMatrix);
 
         Resource<ShapeRendererOptions> _options;
         std::vector<Implementation::AbstractShapeRenderer<dimensions>*> _renderers;
+
+        Implementation::ShapeRendererBatch<dimensions>* _batch;
+        Color4 _batchedColor;
+        Float _batchedPointSize;
+        bool _dirty;
 };
 
 /** @brief Two-dimensional shape renderer */
@@ -0,0 +1,191 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Texture.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/DebugTools/AsyncReadback.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace DebugTools { namespace Test {
+
+struct AsyncReadbackGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit AsyncReadbackGLTest();
+
+    void bufferData();
+    void bufferSubData();
+    void textureSubImage();
+    void order();
+    void destroyPending();
+};
+
+AsyncReadbackGLTest::AsyncReadbackGLTest() {
+    addTests({&AsyncReadbackGLTest::bufferData,
+              &AsyncReadbackGLTest::bufferSubData,
+              &AsyncReadbackGLTest::textureSubImage,
+              &AsyncReadbackGLTest::order,
+              &AsyncReadbackGLTest::destroyPending});
+}
+
+namespace {
+    constexpr Int Data[] = {2, 7, 5, 13, 25};
+
+    constexpr UnsignedByte Data2D[] = { 0x00, 0x01, 0x02, 0x03,
+                                        0x04, 0x05, 0x06, 0x07,
+                                        0x08, 0x09, 0x0a, 0x0b,
+                                        0x0c, 0x0d, 0x0e, 0x0f };
+}
+
+void AsyncReadbackGLTest::bufferData() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::copy_buffer>())
+        CORRADE_SKIP(Extensions::GL::ARB::copy_buffer::string() + std::string(" is not supported."));
+    #endif
+
+    Buffer buffer;
+    buffer.setData(Data, BufferUsage::StaticDraw);
+
+    AsyncReadback readback;
+    std::vector<Int> contents;
+    readback.bufferData(buffer, [&contents](Containers::ArrayView<const char> data) {
+        const Int* begin = reinterpret_cast<const Int*>(data.data());
+        contents.assign(begin, begin + data.size()/sizeof(Int));
+    });
+    CORRADE_COMPARE(readback.pendingCount(), 1);
+
+    /* Overwriting the source doesn't affect the result */
+    buffer.setData({nullptr, sizeof(Data)}, BufferUsage::StaticDraw);
+
+    CORRADE_COMPARE(readback.finish(), 1);
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(readback.pendingCount(), 0);
+    CORRADE_COMPARE_AS(Containers::ArrayView<const Int>(contents.data(), contents.size()),
+        Containers::ArrayView<const Int>{Data},
+        TestSuite::Compare::Container);
+}
+
+void AsyncReadbackGLTest::bufferSubData() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::copy_buffer>())
+        CORRADE_SKIP(Extensions::GL::ARB::copy_buffer::string() + std::string(" is not supported."));
+    #endif
+
+    Buffer buffer;
+    buffer.setData(Data, BufferUsage::StaticDraw);
+
+    AsyncReadback readback;
+    std::vector<Int> contents;
+    readback.bufferSubData(buffer, 4, 12, [&contents](Containers::ArrayView<const char> data) {
+        const Int* begin = reinterpret_cast<const Int*>(data.data());
+        contents.assign(begin, begin + data.size()/sizeof(Int));
+    });
+
+    CORRADE_COMPARE(readback.finish(), 1);
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE_AS(Containers::ArrayView<const Int>(contents.data(), contents.size()),
+        Containers::ArrayView<const Int>{Data}.slice(1, 4),
+        TestSuite::Compare::Container);
+}
+
+void AsyncReadbackGLTest::textureSubImage() {
+    Texture2D texture;
+    texture.setImage(0, TextureFormat::RGBA8, ImageView2D{PixelFormat::RGBA, PixelType::UnsignedByte, Vector2i{2}, Data2D});
+
+    AsyncReadback readback;
+    Vector2i size;
+    std::vector<UnsignedByte> contents;
+    readback.textureSubImage(texture, 0, {{}, Vector2i{2}}, PixelFormat::RGBA, PixelType::UnsignedByte, [&size, &contents](const ImageView2D& image) {
+        size = image.size();
+        const UnsignedByte* begin = reinterpret_cast<const UnsignedByte*>(image.data().data());
+        contents.assign(begin, begin + image.data().size());
+    });
+
+    CORRADE_COMPARE(readback.finish(), 1);
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(size, Vector2i{2});
+    CORRADE_COMPARE_AS(Containers::ArrayView<const UnsignedByte>(contents.data(), contents.size()),
+        Containers::ArrayView<const UnsignedByte>{Data2D},
+        TestSuite::Compare::Container);
+}
+
+void AsyncReadbackGLTest::order() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::copy_buffer>())
+        CORRADE_SKIP(Extensions::GL::ARB::copy_buffer::string() + std::string(" is not supported."));
+    #endif
+
+    Buffer buffer;
+    buffer.setData(Data, BufferUsage::StaticDraw);
+
+    AsyncReadback readback;
+    std::vector<Int> values;
+    for(std::size_t i = 0; i != 5; ++i)
+        readback.bufferSubData(buffer, i*4, 4, [&values](Containers::ArrayView<const char> data) {
+            values.push_back(*reinterpret_cast<const Int*>(data.data()));
+        });
+
+    /* Polling never delivers out of order, whatever is left gets delivered
+       by finish() */
+    const std::size_t polled = readback.poll();
+    CORRADE_COMPARE(values.size(), polled);
+    CORRADE_COMPARE(readback.pendingCount(), 5 - polled);
+    CORRADE_COMPARE(readback.finish(), 5 - polled);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE_AS(Containers::ArrayView<const Int>(values.data(), values.size()),
+        Containers::ArrayView<const Int>{Data},
+        TestSuite::Compare::Container);
+}
+
+void AsyncReadbackGLTest::destroyPending() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::copy_buffer>())
+        CORRADE_SKIP(Extensions::GL::ARB::copy_buffer::string() + std::string(" is not supported."));
+    #endif
+
+    Buffer buffer;
+    buffer.setData(Data, BufferUsage::StaticDraw);
+
+    bool called = false;
+    {
+        AsyncReadback readback;
+        readback.bufferData(buffer, [&called](Containers::ArrayView<const char>) {
+            called = true;
+        });
+    }
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(!called);
+}
+
+}}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::DebugTools::Test::AsyncReadbackGLTest)
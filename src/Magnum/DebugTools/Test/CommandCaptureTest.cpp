@@ -0,0 +1,262 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <sstream>
+#include <thread>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/DebugTools/CommandCapture.h"
+
+namespace Magnum { namespace DebugTools { namespace Test {
+
+struct CommandCaptureTest: TestSuite::Tester {
+    explicit CommandCaptureTest();
+
+    void record();
+    void clear();
+    void traceRoundtrip();
+    void traceEmpty();
+    void traceInvalid();
+
+    void summarize();
+    void summarizeHotspots();
+    void summarizeHotspotCount();
+    void summarizeText();
+
+    void debugCommand();
+};
+
+typedef CommandObserver::Command Command;
+
+CommandCaptureTest::CommandCaptureTest() {
+    addTests({&CommandCaptureTest::record,
+              &CommandCaptureTest::clear,
+              &CommandCaptureTest::traceRoundtrip,
+              &CommandCaptureTest::traceEmpty,
+              &CommandCaptureTest::traceInvalid,
+
+              &CommandCaptureTest::summarize,
+              &CommandCaptureTest::summarizeHotspots,
+              &CommandCaptureTest::summarizeHotspotCount,
+              &CommandCaptureTest::summarizeText,
+
+              &CommandCaptureTest::debugCommand});
+}
+
+void CommandCaptureTest::record() {
+    CommandCapture capture;
+    CORRADE_COMPARE(capture.eventCount(), 0);
+    CORRADE_COMPARE(capture.frameCount(), 0);
+
+    capture.record(Command::ProgramUse, 3, 0, false);
+    capture.record(Command::Draw, 7, 36, false);
+    capture.nextFrame();
+    capture.record(Command::ProgramUse, 3, 0, true);
+
+    CORRADE_COMPARE(capture.eventCount(), 4);
+    CORRADE_COMPARE(capture.frameCount(), 1);
+}
+
+void CommandCaptureTest::clear() {
+    CommandCapture capture;
+    capture.record(Command::Draw, 7, 36, false);
+    capture.nextFrame();
+    capture.clear();
+
+    CORRADE_COMPARE(capture.eventCount(), 0);
+    CORRADE_COMPARE(capture.frameCount(), 0);
+}
+
+void CommandCaptureTest::traceRoundtrip() {
+    CommandCapture capture;
+    capture.record(Command::BufferUpload, 2, 1024, false);
+    capture.record(Command::TextureBind, 5, 1, true);
+    capture.nextFrame();
+    capture.record(Command::RendererState, 0x0b71, 1, false);
+
+    const Containers::Array<char> trace = capture.trace();
+    CORRADE_COMPARE(trace.size(), 12 + 4*24);
+    CORRADE_VERIFY(std::memcmp(trace.data(), "MGCT", 4) == 0);
+
+    const std::optional<std::vector<CommandCapture::Event>> events = CommandCapture::events(trace);
+    CORRADE_VERIFY(events);
+    CORRADE_COMPARE(events->size(), 4);
+
+    CORRADE_COMPARE((*events)[0].command, Command::BufferUpload);
+    CORRADE_COMPARE((*events)[0].object, 2);
+    CORRADE_COMPARE((*events)[0].size, 1024);
+    CORRADE_VERIFY(!(*events)[0].redundant);
+
+    CORRADE_COMPARE((*events)[1].command, Command::TextureBind);
+    CORRADE_COMPARE((*events)[1].object, 5);
+    CORRADE_COMPARE((*events)[1].size, 1);
+    CORRADE_VERIFY((*events)[1].redundant);
+
+    CORRADE_COMPARE(UnsignedByte((*events)[2].command), 0);
+
+    CORRADE_COMPARE((*events)[3].command, Command::RendererState);
+    CORRADE_COMPARE((*events)[3].object, 0x0b71);
+
+    /* Timestamps are monotonic */
+    for(std::size_t i = 1; i != events->size(); ++i)
+        CORRADE_VERIFY((*events)[i].time >= (*events)[i - 1].time);
+}
+
+void CommandCaptureTest::traceEmpty() {
+    const Containers::Array<char> trace = CommandCapture{}.trace();
+    CORRADE_COMPARE(trace.size(), 12);
+
+    const std::optional<std::vector<CommandCapture::Event>> events = CommandCapture::events(trace);
+    CORRADE_VERIFY(events);
+    CORRADE_VERIFY(events->empty());
+
+    const std::optional<CommandCapture::Summary> summary = CommandCapture::summarize(trace);
+    CORRADE_VERIFY(summary);
+    CORRADE_COMPARE(summary->frameCount, 0);
+    CORRADE_COMPARE(summary->duration, 0);
+    CORRADE_VERIFY(summary->hotspots.empty());
+}
+
+void CommandCaptureTest::traceInvalid() {
+    CommandCapture capture;
+    capture.record(Command::Draw, 1, 3, false);
+    Containers::Array<char> trace = capture.trace();
+
+    /* Too short for the header */
+    CORRADE_VERIFY(!CommandCapture::events(trace.prefix(8)));
+
+    /* Truncated event */
+    CORRADE_VERIFY(!CommandCapture::events(trace.prefix(trace.size() - 1)));
+
+    /* Invalid command */
+    trace[12 + 20] = 6;
+    CORRADE_VERIFY(!CommandCapture::events(trace));
+    trace[12 + 20] = UnsignedByte(Command::Draw);
+    CORRADE_VERIFY(CommandCapture::events(trace));
+
+    /* Different event size */
+    trace[8] = 16;
+    CORRADE_VERIFY(!CommandCapture::events(trace));
+    trace[8] = 24;
+
+    /* Bad magic */
+    trace[0] = 'X';
+    CORRADE_VERIFY(!CommandCapture::events(trace));
+    CORRADE_VERIFY(!CommandCapture::summarize(trace));
+}
+
+void CommandCaptureTest::summarize() {
+    CommandCapture capture;
+    for(std::size_t i = 0; i != 3; ++i) {
+        capture.record(Command::ProgramUse, 1, 0, i != 0);
+        capture.record(Command::BufferUpload, 4, 256, false);
+        capture.record(Command::Draw, 2, 36, false);
+        capture.record(Command::Draw, 3, 6, false);
+        capture.nextFrame();
+    }
+
+    const std::optional<CommandCapture::Summary> summary = CommandCapture::summarize(capture.trace());
+    CORRADE_VERIFY(summary);
+    CORRADE_COMPARE(summary->frameCount, 3);
+
+    CORRADE_COMPARE((*summary)[Command::Draw].count, 6);
+    CORRADE_COMPARE((*summary)[Command::Draw].redundant, 0);
+    CORRADE_COMPARE((*summary)[Command::Draw].size, 3*42);
+    CORRADE_COMPARE((*summary)[Command::BufferUpload].count, 3);
+    CORRADE_COMPARE((*summary)[Command::BufferUpload].size, 3*256);
+    CORRADE_COMPARE((*summary)[Command::ProgramUse].count, 3);
+    CORRADE_COMPARE((*summary)[Command::ProgramUse].redundant, 2);
+    CORRADE_COMPARE((*summary)[Command::TextureBind].count, 0);
+    CORRADE_COMPARE((*summary)[Command::RendererState].count, 0);
+
+    /* One hotspot for every command and object combination */
+    CORRADE_COMPARE(summary->hotspots.size(), 4);
+}
+
+void CommandCaptureTest::summarizeHotspots() {
+    CommandCapture capture;
+    capture.record(Command::Draw, 1, 3, false);
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    capture.record(Command::BufferUpload, 2, 1024, false);
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    capture.record(Command::Draw, 1, 3, false);
+    std::this_thread::sleep_for(std::chrono::milliseconds{5});
+    capture.nextFrame();
+
+    const std::optional<CommandCapture::Summary> summary = CommandCapture::summarize(capture.trace());
+    CORRADE_VERIFY(summary);
+    CORRADE_VERIFY(summary->duration >= 26000000);
+    CORRADE_COMPARE(summary->hotspots.size(), 2);
+
+    /* The buffer upload took longest, the draws are merged together */
+    CORRADE_COMPARE(summary->hotspots[0].command, Command::BufferUpload);
+    CORRADE_COMPARE(summary->hotspots[0].object, 2);
+    CORRADE_COMPARE(summary->hotspots[0].statistics.count, 1);
+    CORRADE_VERIFY(summary->hotspots[0].statistics.time >= 20000000);
+    CORRADE_COMPARE(summary->hotspots[1].command, Command::Draw);
+    CORRADE_COMPARE(summary->hotspots[1].object, 1);
+    CORRADE_COMPARE(summary->hotspots[1].statistics.count, 2);
+    CORRADE_VERIFY(summary->hotspots[1].statistics.time >= 6000000);
+}
+
+void CommandCaptureTest::summarizeHotspotCount() {
+    CommandCapture capture;
+    for(UnsignedInt i = 0; i != 20; ++i)
+        capture.record(Command::TextureBind, i, 0, false);
+
+    const Containers::Array<char> trace = capture.trace();
+    CORRADE_COMPARE(CommandCapture::summarize(trace)->hotspots.size(), 10);
+    CORRADE_COMPARE(CommandCapture::summarize(trace, 3)->hotspots.size(), 3);
+    CORRADE_COMPARE(CommandCapture::summarize(trace, 100)->hotspots.size(), 20);
+}
+
+void CommandCaptureTest::summarizeText() {
+    CommandCapture capture;
+    capture.record(Command::ProgramUse, 1, 0, true);
+    capture.record(Command::BufferUpload, 4, 256, false);
+    capture.record(Command::Draw, 2, 36, false);
+    capture.nextFrame();
+
+    const std::string text = CommandCapture::summarize(capture.trace())->text();
+    CORRADE_VERIFY(text.find("Frames: 1, duration: ") == 0);
+    CORRADE_VERIFY(text.find("\nDraw calls: 1 (1 per frame, 0 redundant, ") != std::string::npos);
+    CORRADE_VERIFY(text.find("\nBuffer uploads: 1 (1 per frame, 0 redundant, 256 B, ") != std::string::npos);
+    CORRADE_VERIFY(text.find("\nTexture binds: 0 (0 per frame, 0 redundant, 0 us)") != std::string::npos);
+    CORRADE_VERIFY(text.find("\nProgram switches: 1 (1 per frame, 1 redundant, ") != std::string::npos);
+    CORRADE_VERIFY(text.find("\nHotspots:\n  ") != std::string::npos);
+    CORRADE_VERIFY(text.find("\n  Buffer uploads, object 4: 1 (0 redundant, ") != std::string::npos);
+}
+
+void CommandCaptureTest::debugCommand() {
+    std::ostringstream out;
+    Debug(&out) << CommandObserver::Command::TextureBind << CommandObserver::Command(0xf0);
+    CORRADE_COMPARE(out.str(), "CommandObserver::Command::TextureBind CommandObserver::Command(0xf0)\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::DebugTools::Test::CommandCaptureTest)
@@ -0,0 +1,153 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Buffer.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/Renderer.h"
+#include "Magnum/Texture.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/DebugTools/FrameStatistics.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/Shaders/Flat.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace DebugTools { namespace Test {
+
+struct FrameStatisticsGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit FrameStatisticsGLTest();
+
+    void counts();
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    void primitiveCount();
+    #endif
+    void debug();
+};
+
+FrameStatisticsGLTest::FrameStatisticsGLTest() {
+    addTests({&FrameStatisticsGLTest::counts,
+              #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+              &FrameStatisticsGLTest::primitiveCount,
+              #endif
+              &FrameStatisticsGLTest::debug});
+}
+
+namespace {
+    constexpr Vector2 Triangle[]{{-1.0f, -1.0f}, {1.0f, -1.0f}, {0.0f, 1.0f}};
+}
+
+void FrameStatisticsGLTest::counts() {
+    Shaders::Flat2D a, b;
+    Buffer vertices;
+    vertices.setData({nullptr, sizeof(Triangle)}, BufferUsage::StaticDraw);
+    Mesh mesh;
+    mesh.setCount(3)
+        .addVertexBuffer(vertices, 0, Shaders::Flat2D::Position{});
+    Texture2D texture;
+    texture.setStorage(1, TextureFormat::RGBA8, {4, 4});
+
+    FrameStatistics statistics;
+    CORRADE_COMPARE(statistics.frameCount(), 0);
+    CORRADE_COMPARE(statistics.statistics().drawCalls, 0);
+
+    statistics.beginFrame();
+    vertices.setSubData(0, Triangle);
+    mesh.draw(a);
+    mesh.draw(a);
+    mesh.draw(b);
+    texture.bind(0);
+    texture.bind(0);
+    statistics.endFrame();
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    CORRADE_COMPARE(statistics.frameCount(), 1);
+    CORRADE_COMPARE(statistics.statistics().drawCalls, 3);
+    CORRADE_COMPARE(statistics.statistics().primitives, 0);
+    CORRADE_COMPARE(statistics.statistics().bufferUploads, 1);
+    CORRADE_COMPARE(statistics.statistics().bufferUploadSize, sizeof(Triangle));
+    CORRADE_COMPARE(statistics.statistics().textureBinds, 1);
+    CORRADE_COMPARE(statistics.statistics().programSwitches, 2);
+    CORRADE_VERIFY(statistics.text().find("Draw calls: 3\n") != std::string::npos);
+
+    /* Nothing done in the next frame */
+    statistics.beginFrame();
+    statistics.endFrame();
+    CORRADE_COMPARE(statistics.frameCount(), 2);
+    CORRADE_COMPARE(statistics.statistics().drawCalls, 0);
+    CORRADE_COMPARE(statistics.statistics().programSwitches, 0);
+}
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+void FrameStatisticsGLTest::primitiveCount() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::EXT::transform_feedback>())
+        CORRADE_SKIP(Extensions::GL::EXT::transform_feedback::string() + std::string(" is not supported."));
+    #else
+    if(!Context::current().isExtensionSupported<Extensions::GL::EXT::geometry_shader>())
+        CORRADE_SKIP(Extensions::GL::EXT::geometry_shader::string() + std::string(" is not supported."));
+    #endif
+
+    Shaders::Flat2D shader;
+    Buffer vertices;
+    vertices.setData(Triangle, BufferUsage::StaticDraw);
+    Mesh mesh;
+    mesh.setCount(3)
+        .addVertexBuffer(vertices, 0, Shaders::Flat2D::Position{});
+
+    FrameStatistics statistics;
+    statistics.setPrimitiveCountEnabled(true);
+    CORRADE_VERIFY(statistics.isPrimitiveCountEnabled());
+
+    for(std::size_t i = 0; i != 3; ++i) {
+        statistics.beginFrame();
+        mesh.draw(shader);
+        statistics.endFrame();
+    }
+
+    /* Disabling waits for all pending frames */
+    statistics.setPrimitiveCountEnabled(false);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    CORRADE_COMPARE(statistics.frameCount(), 3);
+    CORRADE_COMPARE(statistics.statistics().drawCalls, 1);
+    CORRADE_COMPARE(statistics.statistics().primitives, 1);
+}
+#endif
+
+void FrameStatisticsGLTest::debug() {
+    std::ostringstream out;
+    Debug(&out) << FrameStatistics::Statistics{3, 1, 2, 128, 4, 5, 6};
+    CORRADE_COMPARE(out.str(), "DebugTools::FrameStatistics::Statistics(draw calls: 3, primitives: 1, buffer uploads: 2, uploaded bytes: 128, texture binds: 4, program switches: 5, state changes: 6)\n");
+}
+
+}}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::DebugTools::Test::FrameStatisticsGLTest)
@@ -0,0 +1,208 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/DebugTools/FrameStatistics.h"
+#include "Magnum/DebugTools/ImmediateDrawer.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace DebugTools { namespace Test {
+
+struct ImmediateDrawerGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit ImmediateDrawerGLTest();
+
+    void add2D();
+    void add3D();
+    void draw();
+    void drawEmpty();
+    void drawOverCapacity();
+};
+
+ImmediateDrawerGLTest::ImmediateDrawerGLTest() {
+    addTests({&ImmediateDrawerGLTest::add2D,
+              &ImmediateDrawerGLTest::add3D,
+              &ImmediateDrawerGLTest::draw,
+              &ImmediateDrawerGLTest::drawEmpty,
+              &ImmediateDrawerGLTest::drawOverCapacity});
+}
+
+void ImmediateDrawerGLTest::add2D() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::ARB::map_buffer_range::string() + std::string(" is not supported"));
+    #elif defined(MAGNUM_TARGET_GLES2)
+    if(!Context::current().isExtensionSupported<Extensions::GL::EXT::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::EXT::map_buffer_range::string() + std::string(" is not supported"));
+    #endif
+
+    ImmediateDrawer2D drawer;
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(drawer.capacity(), 65536);
+
+    drawer.addLine({}, {1.0f, 0.0f}, Color4{1.0f});
+    CORRADE_COMPARE(drawer.lineVertexCount(), 2);
+
+    drawer.addCross({}, 1.0f, Color4{1.0f});
+    CORRADE_COMPARE(drawer.lineVertexCount(), 2 + 4);
+
+    drawer.addBox({}, Color4{1.0f})
+        .addAxisAlignedBox({-1.0f, -1.0f}, {1.0f, 1.0f}, Color4{1.0f});
+    CORRADE_COMPARE(drawer.lineVertexCount(), 2 + 4 + 8 + 8);
+
+    drawer.addSphere({}, 1.0f, Color4{1.0f});
+    CORRADE_COMPARE(drawer.lineVertexCount(), 2 + 4 + 8 + 8 + 64);
+
+    drawer.addTriangle({}, {1.0f, 0.0f}, {0.0f, 1.0f}, Color4{1.0f})
+        .addPoint({}, Color4{1.0f});
+    CORRADE_COMPARE(drawer.triangleVertexCount(), 3);
+    CORRADE_COMPARE(drawer.pointVertexCount(), 1);
+
+    drawer.clear();
+    CORRADE_COMPARE(drawer.lineVertexCount(), 0);
+    CORRADE_COMPARE(drawer.triangleVertexCount(), 0);
+    CORRADE_COMPARE(drawer.pointVertexCount(), 0);
+}
+
+void ImmediateDrawerGLTest::add3D() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::ARB::map_buffer_range::string() + std::string(" is not supported"));
+    #elif defined(MAGNUM_TARGET_GLES2)
+    if(!Context::current().isExtensionSupported<Extensions::GL::EXT::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::EXT::map_buffer_range::string() + std::string(" is not supported"));
+    #endif
+
+    ImmediateDrawer3D drawer;
+    MAGNUM_VERIFY_NO_ERROR();
+
+    drawer.addCross({}, 1.0f, Color4{1.0f});
+    CORRADE_COMPARE(drawer.lineVertexCount(), 6);
+
+    /* Twelve edges */
+    drawer.addBox(Matrix4::scaling(Vector3{2.0f}), Color4{1.0f});
+    CORRADE_COMPARE(drawer.lineVertexCount(), 6 + 24);
+
+    /* Three circles */
+    drawer.addSphere({}, 1.0f, Color4{1.0f});
+    CORRADE_COMPARE(drawer.lineVertexCount(), 6 + 24 + 192);
+}
+
+void ImmediateDrawerGLTest::draw() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::ARB::map_buffer_range::string() + std::string(" is not supported"));
+    #elif defined(MAGNUM_TARGET_GLES2)
+    if(!Context::current().isExtensionSupported<Extensions::GL::EXT::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::EXT::map_buffer_range::string() + std::string(" is not supported"));
+    #endif
+
+    ImmediateDrawer3D drawer;
+
+    FrameStatistics statistics;
+    /* Draw more frames than there are sections to wrap around the ring */
+    for(UnsignedInt i = 0; i != 5; ++i) {
+        for(UnsignedInt j = 0; j != 100; ++j)
+            drawer.addLine({}, {1.0f, 0.0f, 0.0f}, Color4{1.0f})
+                .addSphere({}, 0.5f, Color4{1.0f});
+        drawer.addTriangle({}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, Color4{1.0f})
+            .addPoint({}, Color4{1.0f});
+
+        statistics.beginFrame();
+        drawer.draw({});
+        statistics.endFrame();
+
+        MAGNUM_VERIFY_NO_ERROR();
+
+        /* One draw for each primitive type */
+        CORRADE_COMPARE(statistics.statistics().drawCalls, 3);
+        CORRADE_COMPARE(drawer.lineVertexCount(), 0);
+        CORRADE_COMPARE(drawer.triangleVertexCount(), 0);
+        CORRADE_COMPARE(drawer.pointVertexCount(), 0);
+    }
+}
+
+void ImmediateDrawerGLTest::drawEmpty() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::ARB::map_buffer_range::string() + std::string(" is not supported"));
+    #elif defined(MAGNUM_TARGET_GLES2)
+    if(!Context::current().isExtensionSupported<Extensions::GL::EXT::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::EXT::map_buffer_range::string() + std::string(" is not supported"));
+    #endif
+
+    ImmediateDrawer2D drawer;
+    drawer.addLine({}, {1.0f, 0.0f}, Color4{1.0f});
+
+    FrameStatistics statistics;
+    statistics.beginFrame();
+    drawer.draw({});
+    drawer.draw({});
+    statistics.endFrame();
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* The second draw has nothing to do */
+    CORRADE_COMPARE(statistics.statistics().drawCalls, 1);
+}
+
+void ImmediateDrawerGLTest::drawOverCapacity() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::ARB::map_buffer_range::string() + std::string(" is not supported"));
+    #elif defined(MAGNUM_TARGET_GLES2)
+    if(!Context::current().isExtensionSupported<Extensions::GL::EXT::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::EXT::map_buffer_range::string() + std::string(" is not supported"));
+    #endif
+
+    ImmediateDrawer2D drawer{7};
+    drawer.addLine({}, {1.0f, 0.0f}, Color4{1.0f})
+        .addLine({}, {0.0f, 1.0f}, Color4{1.0f})
+        .addTriangle({}, {1.0f, 0.0f}, {0.0f, 1.0f}, Color4{1.0f})
+        .addTriangle({}, {1.0f, 0.0f}, {0.0f, 1.0f}, Color4{1.0f})
+        .addPoint({}, Color4{1.0f});
+
+    std::ostringstream out;
+    FrameStatistics statistics;
+    {
+        Warning redirectWarning{&out};
+        statistics.beginFrame();
+        drawer.draw({});
+        statistics.endFrame();
+    }
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Both lines and one triangle fit, the rest doesn't */
+    CORRADE_COMPARE(statistics.statistics().drawCalls, 2);
+    CORRADE_COMPARE(out.str(), "DebugTools::ImmediateDrawer::draw(): capacity of 7 vertices exceeded, dropping 4 vertices\n");
+}
+
+}}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::DebugTools::Test::ImmediateDrawerGLTest)
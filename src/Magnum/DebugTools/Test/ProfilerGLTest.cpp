@@ -0,0 +1,99 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Renderer.h"
+#include "Magnum/DebugTools/Profiler.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace DebugTools { namespace Test {
+
+struct ProfilerGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit ProfilerGLTest();
+
+    void gpuTime();
+    void gpuTimeEnabledWhenProfiling();
+};
+
+ProfilerGLTest::ProfilerGLTest() {
+    addTests({&ProfilerGLTest::gpuTime,
+              &ProfilerGLTest::gpuTimeEnabledWhenProfiling});
+}
+
+void ProfilerGLTest::gpuTime() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::timer_query>())
+        CORRADE_SKIP(Extensions::GL::ARB::timer_query::string() + std::string(" is not supported."));
+    #else
+    if(!Context::current().isExtensionSupported<Extensions::GL::EXT::disjoint_timer_query>())
+        CORRADE_SKIP(Extensions::GL::EXT::disjoint_timer_query::string() + std::string(" is not supported."));
+    #endif
+
+    Profiler p;
+    const Profiler::Section clear = p.addSection("Clear");
+    p.setGpuTimeEnabled(true);
+    CORRADE_VERIFY(p.isGpuTimeEnabled());
+
+    p.enable();
+    for(std::size_t i = 0; i != 10; ++i) {
+        p.start(clear);
+        Renderer::finish();
+        p.stop();
+        p.nextFrame();
+    }
+
+    /* Make sure all queries are done so the statistics contain GPU time */
+    Renderer::finish();
+    p.nextFrame();
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    std::ostringstream out;
+    {
+        Debug redirectOutput{&out};
+        p.printStatistics();
+    }
+    CORRADE_VERIFY(out.str().find("(GPU ") != std::string::npos);
+}
+
+void ProfilerGLTest::gpuTimeEnabledWhenProfiling() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Profiler p;
+    p.enable();
+    p.setGpuTimeEnabled(true);
+
+    CORRADE_VERIFY(!p.isGpuTimeEnabled());
+    CORRADE_COMPARE(out.str(), "Profiler: cannot enable GPU time measurement when profiling is enabled\n");
+}
+
+}}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::DebugTools::Test::ProfilerGLTest)
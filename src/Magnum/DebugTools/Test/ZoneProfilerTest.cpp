@@ -0,0 +1,266 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <thread>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/DebugTools/ZoneProfiler.h"
+
+namespace Magnum { namespace DebugTools { namespace Test {
+
+struct ZoneProfilerTest: TestSuite::Tester {
+    explicit ZoneProfilerTest();
+
+    void disabled();
+    void nested();
+    void statistics();
+    void statisticsEmpty();
+    void measureDuration();
+    void endWithoutBegin();
+    void addZoneEnabled();
+
+    void trace();
+    void traceCapacity();
+    void traceNotEnabled();
+};
+
+ZoneProfilerTest::ZoneProfilerTest() {
+    addTests({&ZoneProfilerTest::disabled,
+              &ZoneProfilerTest::nested,
+              &ZoneProfilerTest::statistics,
+              &ZoneProfilerTest::statisticsEmpty,
+              &ZoneProfilerTest::measureDuration,
+              &ZoneProfilerTest::endWithoutBegin,
+              &ZoneProfilerTest::addZoneEnabled,
+
+              &ZoneProfilerTest::trace,
+              &ZoneProfilerTest::traceCapacity,
+              &ZoneProfilerTest::traceNotEnabled});
+}
+
+void ZoneProfilerTest::disabled() {
+    ZoneProfiler p;
+    const ZoneProfiler::Zone a = p.addZone("A");
+    CORRADE_VERIFY(!p.isEnabled());
+
+    {
+        ZoneProfiler::Scope scope{p, a};
+    }
+    p.nextFrame();
+
+    CORRADE_COMPARE(p.frameCount(), 0);
+    CORRADE_COMPARE(p.statistics(a).count, 0.0f);
+}
+
+void ZoneProfilerTest::nested() {
+    ZoneProfiler p;
+    const ZoneProfiler::Zone outer = p.addZone("Outer");
+    const ZoneProfiler::Zone inner = p.addZone("Inner");
+    CORRADE_COMPARE(p.zoneCount(), 2);
+    CORRADE_COMPARE(p.zoneName(inner), "Inner");
+
+    p.enable();
+    {
+        ZoneProfiler::Scope o{p, outer};
+        for(std::size_t i = 0; i != 3; ++i) {
+            ZoneProfiler::Scope s{p, inner};
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+    }
+    p.nextFrame();
+
+    CORRADE_COMPARE(p.frameCount(), 1);
+    const ZoneProfiler::Statistics o = p.statistics(outer);
+    const ZoneProfiler::Statistics i = p.statistics(inner);
+    CORRADE_COMPARE(o.count, 1.0f);
+    CORRADE_COMPARE(i.count, 3.0f);
+
+    /* Outer zone contains the inner ones */
+    CORRADE_VERIFY(i.mean >= std::chrono::milliseconds{3});
+    CORRADE_VERIFY(o.mean >= i.mean);
+}
+
+void ZoneProfilerTest::statistics() {
+    ZoneProfiler p;
+    const ZoneProfiler::Zone a = p.addZone("A");
+    p.setMeasureDuration(4);
+    p.enable();
+
+    /* Zone recorded only in two frames out of four */
+    p.nextFrame();
+    p.begin(a);
+    std::this_thread::sleep_for(std::chrono::milliseconds{2});
+    p.end();
+    p.nextFrame();
+    p.nextFrame();
+    p.begin(a);
+    p.end();
+    p.nextFrame();
+
+    CORRADE_COMPARE(p.frameCount(), 4);
+    const ZoneProfiler::Statistics s = p.statistics(a);
+    CORRADE_COMPARE(s.min, std::chrono::nanoseconds{0});
+    CORRADE_VERIFY(s.max >= std::chrono::milliseconds{2});
+    CORRADE_COMPARE(s.percentile99, s.max);
+    CORRADE_COMPARE(s.percentile95, s.max);
+    CORRADE_VERIFY(s.median <= s.percentile95);
+    CORRADE_VERIFY(s.mean >= s.max/4);
+    CORRADE_COMPARE(s.count, 0.5f);
+
+    std::ostringstream out;
+    {
+        Debug redirectOutput{&out};
+        p.printStatistics();
+    }
+    CORRADE_VERIFY(out.str().find("Statistics for last 4 frames") == 0);
+    CORRADE_VERIFY(out.str().find("\n  A ") != std::string::npos);
+}
+
+void ZoneProfilerTest::statisticsEmpty() {
+    ZoneProfiler p;
+    const ZoneProfiler::Zone a = p.addZone("A");
+    p.enable();
+
+    const ZoneProfiler::Statistics s = p.statistics(a);
+    CORRADE_COMPARE(s.max, std::chrono::nanoseconds{0});
+    CORRADE_COMPARE(s.count, 0.0f);
+
+    std::ostringstream out;
+    {
+        Debug redirectOutput{&out};
+        p.printStatistics();
+    }
+    CORRADE_COMPARE(out.str(), "");
+}
+
+void ZoneProfilerTest::measureDuration() {
+    ZoneProfiler p;
+    const ZoneProfiler::Zone a = p.addZone("A");
+    p.setMeasureDuration(2);
+    CORRADE_COMPARE(p.measureDuration(), 2);
+    p.enable();
+
+    /* The first frame falls out of the window */
+    p.begin(a);
+    p.end();
+    p.nextFrame();
+    p.nextFrame();
+    p.nextFrame();
+
+    CORRADE_COMPARE(p.frameCount(), 2);
+    CORRADE_COMPARE(p.statistics(a).count, 0.0f);
+}
+
+void ZoneProfilerTest::endWithoutBegin() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    ZoneProfiler p;
+    p.enable();
+    p.end();
+
+    CORRADE_COMPARE(out.str(), "ZoneProfiler::end(): no zone to end\n");
+}
+
+void ZoneProfilerTest::addZoneEnabled() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    ZoneProfiler p;
+    p.enable();
+    p.addZone("A");
+
+    CORRADE_COMPARE(p.zoneCount(), 0);
+    CORRADE_COMPARE(out.str(), "ZoneProfiler::addZone(): cannot add zone when profiling is enabled\n");
+}
+
+void ZoneProfilerTest::trace() {
+    ZoneProfiler p;
+    const ZoneProfiler::Zone a = p.addZone("Zone \"A\"");
+    p.setTraceEnabled(true);
+    CORRADE_VERIFY(p.isTraceEnabled());
+    p.enable();
+    p.setThreadName("Main");
+
+    p.begin(a);
+    p.end();
+    p.nextFrame();
+
+    /* Not ended before nextFrame(), not exported */
+    p.begin(a);
+
+    std::ostringstream out;
+    p.exportChromeTrace(out);
+    const std::string trace = out.str();
+
+    CORRADE_VERIFY(trace.find("{\"traceEvents\":[") == 0);
+    CORRADE_VERIFY(trace.find("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,\"args\":{\"name\":\"Main\"}}") != std::string::npos);
+    CORRADE_VERIFY(trace.find("{\"name\":\"Frame\",\"ph\":\"i\",\"s\":\"g\",\"pid\":0,\"tid\":0,\"ts\":") != std::string::npos);
+    CORRADE_VERIFY(trace.find("{\"name\":\"Zone \\\"A\\\"\",\"cat\":\"magnum\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":") != std::string::npos);
+    CORRADE_VERIFY(trace.find("\"dur\":") != std::string::npos);
+    CORRADE_VERIFY(trace.find("\"dur\":") == trace.rfind("\"dur\":"));
+    CORRADE_VERIFY(trace.find("],\"displayTimeUnit\":\"ms\"}") != std::string::npos);
+}
+
+void ZoneProfilerTest::traceCapacity() {
+    ZoneProfiler p;
+    const ZoneProfiler::Zone a = p.addZone("A");
+    p.setTraceEnabled(true, 2);
+    p.enable();
+
+    for(std::size_t i = 0; i != 5; ++i) {
+        p.begin(a);
+        p.end();
+        p.nextFrame();
+    }
+
+    std::ostringstream out;
+    p.exportChromeTrace(out);
+    const std::string trace = out.str();
+
+    std::size_t count = 0;
+    for(std::size_t pos = trace.find("\"ph\":\"X\""); pos != std::string::npos; pos = trace.find("\"ph\":\"X\"", pos + 1))
+        ++count;
+    CORRADE_COMPARE(count, 2);
+}
+
+void ZoneProfilerTest::traceNotEnabled() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    ZoneProfiler p;
+    p.enable();
+    std::ostringstream trace;
+    p.exportChromeTrace(trace);
+
+    CORRADE_COMPARE(out.str(), "ZoneProfiler::exportChromeTrace(): trace is not enabled\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::DebugTools::Test::ZoneProfilerTest)
@@ -48,6 +48,9 @@ ES 3.0, images with @ref PixelType::Float are supported -- they are
 reinterpreted as @ref PixelType::UnsignedInt using additional shader and
 `floatBitsToUint()` GLSL function and then reinterpreted back to
 @ref PixelType::Float when read to client memory.
+
+Reading the image waits until the GL finishes all commands rendering to the
+texture, use @ref AsyncReadback to read it without stalling the pipeline.
 */
 MAGNUM_DEBUGTOOLS_EXPORT void textureSubImage(Texture2D& texture, Int level, const Range2Di& range, Image2D& image);
 
@@ -0,0 +1,368 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ZoneProfiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Magnum.h"
+
+using namespace std::chrono;
+
+namespace Magnum { namespace DebugTools {
+
+struct ZoneProfiler::Event {
+    Zone zone;
+    UnsignedInt thread;
+    /* Nanoseconds since enable() */
+    Long begin, end;
+};
+
+struct ZoneProfiler::ThreadData {
+    explicit ThreadData(UnsignedInt index_): index{index_}, id{std::this_thread::get_id()} {}
+
+    const UnsignedInt index;
+    const std::thread::id id;
+
+    /* Guards everything below, contended only when the data are collected
+       by nextFrame() or exportChromeTrace() */
+    std::mutex mutex;
+    std::string name;
+    std::vector<std::pair<Zone, Long>> stack;
+    std::vector<Event> events;
+};
+
+struct ZoneProfiler::State {
+    /* Guards the thread list */
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadData>> threads;
+
+    high_resolution_clock::time_point epoch;
+    std::deque<Event> trace;
+    std::deque<Long> frames;
+
+    /* Reused in nextFrame() to avoid allocations */
+    std::vector<Event> events;
+};
+
+namespace {
+    /* Each enable() gets a new ID, so a stale cache entry from previous
+       profiling run or from a destroyed profiler is never matched */
+    std::atomic<std::size_t> profilerCounter{0};
+
+    struct ThreadCache {
+        std::size_t profiler;
+        void* data;
+    };
+
+    #ifdef MAGNUM_BUILD_MULTITHREADED
+    #if !defined(CORRADE_GCC47_COMPATIBILITY) && !defined(CORRADE_TARGET_APPLE)
+    thread_local
+    #else
+    __thread
+    #endif
+    #endif
+    ThreadCache threadCache{0, nullptr};
+
+    Long nanosecondsSince(const high_resolution_clock::time_point epoch) {
+        return duration_cast<nanoseconds>(high_resolution_clock::now() - epoch).count();
+    }
+
+    /* Chrome trace has timestamps in (fractional) microseconds */
+    void writeMicroseconds(std::ostream& out, const Long value) {
+        out << value/1000 << '.' << std::setw(3) << std::setfill('0') << value%1000 << std::setfill(' ');
+    }
+
+    void writeString(std::ostream& out, const std::string& value) {
+        out << '"';
+        for(const char c: value) {
+            if(c == '"' || c == '\\') out << '\\' << c;
+            else if(static_cast<unsigned char>(c) < 0x20)
+                out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << Int(c) << std::dec << std::setfill(' ');
+            else out << c;
+        }
+        out << '"';
+    }
+}
+
+ZoneProfiler::Scope::Scope(ZoneProfiler& profiler, const Zone zone): _profiler{profiler.isEnabled() ? &profiler : nullptr} {
+    if(_profiler) _profiler->begin(zone);
+}
+
+ZoneProfiler::Scope::~Scope() {
+    if(_profiler) _profiler->end();
+}
+
+ZoneProfiler::ZoneProfiler(): _enabled{false}, _id{0}, _measureDuration{60}, _currentFrame{0}, _frameCount{0}, _traceCapacity{0}, _state{new State} {}
+
+ZoneProfiler::~ZoneProfiler() = default;
+
+void ZoneProfiler::setMeasureDuration(const std::size_t frames) {
+    CORRADE_ASSERT(!_enabled, "ZoneProfiler::setMeasureDuration(): cannot set measure duration when profiling is enabled", );
+    CORRADE_ASSERT(frames, "ZoneProfiler::setMeasureDuration(): expected non-zero frame count", );
+    _measureDuration = frames;
+}
+
+void ZoneProfiler::setTraceEnabled(const bool enabled, const std::size_t capacity) {
+    CORRADE_ASSERT(!_enabled, "ZoneProfiler::setTraceEnabled(): cannot enable trace when profiling is enabled", );
+    _traceCapacity = enabled ? capacity : 0;
+}
+
+const std::string& ZoneProfiler::zoneName(const Zone zone) const {
+    CORRADE_ASSERT(zone < _zones.size(), "ZoneProfiler::zoneName(): index" << zone << "out of range for" << _zones.size() << "zones", _zones.front());
+    return _zones[zone];
+}
+
+ZoneProfiler::Zone ZoneProfiler::addZone(const std::string& name) {
+    CORRADE_ASSERT(!_enabled, "ZoneProfiler::addZone(): cannot add zone when profiling is enabled", 0);
+    _zones.push_back(name);
+    return _zones.size() - 1;
+}
+
+void ZoneProfiler::enable() {
+    _enabled = true;
+    _id = ++profilerCounter;
+    _currentFrame = 0;
+    _frameCount = 0;
+    _frameData.assign(_measureDuration*_zones.size(), 0);
+    _frameCounts.assign(_measureDuration*_zones.size(), 0);
+
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    _state->threads.clear();
+    _state->trace.clear();
+    _state->frames.clear();
+    _state->epoch = high_resolution_clock::now();
+}
+
+void ZoneProfiler::disable() {
+    _enabled = false;
+}
+
+auto ZoneProfiler::threadData() -> ThreadData& {
+    if(threadCache.profiler == _id)
+        return *static_cast<ThreadData*>(threadCache.data);
+
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    ThreadData* data = nullptr;
+    #ifdef MAGNUM_BUILD_MULTITHREADED
+    const std::thread::id id = std::this_thread::get_id();
+    for(const std::unique_ptr<ThreadData>& thread: _state->threads)
+        if(thread->id == id) data = thread.get();
+    #else
+    if(!_state->threads.empty()) data = _state->threads.front().get();
+    #endif
+    if(!data) {
+        _state->threads.emplace_back(new ThreadData{UnsignedInt(_state->threads.size())});
+        data = _state->threads.back().get();
+    }
+
+    threadCache.profiler = _id;
+    threadCache.data = data;
+    return *data;
+}
+
+void ZoneProfiler::setThreadName(const std::string& name) {
+    CORRADE_ASSERT(_enabled, "ZoneProfiler::setThreadName(): profiling is not enabled", );
+    ThreadData& data = threadData();
+    std::lock_guard<std::mutex> lock{data.mutex};
+    data.name = name;
+}
+
+void ZoneProfiler::begin(const Zone zone) {
+    if(!_enabled) return;
+    CORRADE_ASSERT(zone < _zones.size(), "ZoneProfiler::begin(): index" << zone << "out of range for" << _zones.size() << "zones", );
+
+    ThreadData& data = threadData();
+    const Long time = nanosecondsSince(_state->epoch);
+    std::lock_guard<std::mutex> lock{data.mutex};
+    data.stack.emplace_back(zone, time);
+}
+
+void ZoneProfiler::end() {
+    if(!_enabled) return;
+
+    const Long time = nanosecondsSince(_state->epoch);
+    ThreadData& data = threadData();
+    std::lock_guard<std::mutex> lock{data.mutex};
+    CORRADE_ASSERT(!data.stack.empty(), "ZoneProfiler::end(): no zone to end", );
+    data.events.push_back({data.stack.back().first, data.index, data.stack.back().second, time});
+    data.stack.pop_back();
+}
+
+void ZoneProfiler::nextFrame() {
+    if(!_enabled) return;
+
+    /* Collect events ended during this frame from all threads, holding each
+       thread lock only for the swap */
+    std::vector<Event>& events = _state->events;
+    events.clear();
+    {
+        std::lock_guard<std::mutex> lock{_state->mutex};
+        for(const std::unique_ptr<ThreadData>& thread: _state->threads) {
+            std::lock_guard<std::mutex> threadLock{thread->mutex};
+            events.insert(events.end(), thread->events.begin(), thread->events.end());
+            thread->events.clear();
+        }
+    }
+
+    /* Replace the oldest frame with this one */
+    UnsignedLong* const frameData = _frameData.data() + _currentFrame*_zones.size();
+    UnsignedInt* const frameCounts = _frameCounts.data() + _currentFrame*_zones.size();
+    std::fill_n(frameData, _zones.size(), 0);
+    std::fill_n(frameCounts, _zones.size(), 0);
+    for(const Event& event: events) {
+        frameData[event.zone] += event.end - event.begin;
+        ++frameCounts[event.zone];
+    }
+
+    _currentFrame = (_currentFrame + 1) % _measureDuration;
+    if(_frameCount < _measureDuration) ++_frameCount;
+
+    if(!_traceCapacity) return;
+
+    _state->trace.insert(_state->trace.end(), events.begin(), events.end());
+    _state->frames.push_back(nanosecondsSince(_state->epoch));
+    while(_state->trace.size() > _traceCapacity) _state->trace.pop_front();
+    while(_state->frames.size() > _traceCapacity) _state->frames.pop_front();
+}
+
+auto ZoneProfiler::statistics(const Zone zone) const -> Statistics {
+    CORRADE_ASSERT(zone < _zones.size(), "ZoneProfiler::statistics(): index" << zone << "out of range for" << _zones.size() << "zones", {});
+
+    if(!_frameCount) return Statistics{{}, {}, {}, {}, {}, {}, 0.0f};
+
+    std::vector<UnsignedLong> durations(_frameCount);
+    UnsignedLong count = 0;
+    for(std::size_t i = 0; i != _frameCount; ++i) {
+        durations[i] = _frameData[i*_zones.size() + zone];
+        count += _frameCounts[i*_zones.size() + zone];
+    }
+    std::sort(durations.begin(), durations.end());
+
+    /* Nearest-rank percentile */
+    auto percentile = [&durations](const Double p) {
+        const std::size_t rank = std::size_t(std::ceil(p*durations.size()));
+        return nanoseconds(durations[rank ? rank - 1 : 0]);
+    };
+
+    return Statistics{
+        nanoseconds(durations.front()),
+        nanoseconds(durations.back()),
+        nanoseconds(std::accumulate(durations.begin(), durations.end(), UnsignedLong{})/_frameCount),
+        percentile(0.50),
+        percentile(0.95),
+        percentile(0.99),
+        Float(count)/_frameCount};
+}
+
+void ZoneProfiler::printStatistics() const {
+    if(!_frameCount) return;
+
+    std::vector<Statistics> statistics;
+    statistics.reserve(_zones.size());
+    for(std::size_t i = 0; i != _zones.size(); ++i)
+        statistics.push_back(this->statistics(i));
+
+    std::vector<std::size_t> meanSorted(_zones.size());
+    std::iota(meanSorted.begin(), meanSorted.end(), 0);
+    std::sort(meanSorted.begin(), meanSorted.end(), [&statistics](std::size_t i, std::size_t j) {
+        return statistics[i].mean > statistics[j].mean;
+    });
+
+    Debug() << "Statistics for last" << _frameCount << "frames (min, mean, max, 95th percentile):";
+    for(const std::size_t i: meanSorted)
+        Debug() << " " << _zones[i]
+            << duration_cast<microseconds>(statistics[i].min).count() << Debug::nospace << u8"µs"
+            << duration_cast<microseconds>(statistics[i].mean).count() << Debug::nospace << u8"µs"
+            << duration_cast<microseconds>(statistics[i].max).count() << Debug::nospace << u8"µs"
+            << duration_cast<microseconds>(statistics[i].percentile95).count() << Debug::nospace << u8"µs";
+}
+
+void ZoneProfiler::exportChromeTrace(std::ostream& out) const {
+    CORRADE_ASSERT(_traceCapacity, "ZoneProfiler::exportChromeTrace(): trace is not enabled", );
+
+    out << "{\"traceEvents\":[";
+    bool first = true;
+    auto separator = [&out, &first]() {
+        out << (first ? "\n" : ",\n");
+        first = false;
+    };
+
+    {
+        std::lock_guard<std::mutex> lock{_state->mutex};
+        for(const std::unique_ptr<ThreadData>& thread: _state->threads) {
+            std::lock_guard<std::mutex> threadLock{thread->mutex};
+            if(thread->name.empty()) continue;
+
+            separator();
+            out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << thread->index << ",\"args\":{\"name\":";
+            writeString(out, thread->name);
+            out << "}}";
+        }
+    }
+
+    for(const Long frame: _state->frames) {
+        separator();
+        out << "{\"name\":\"Frame\",\"ph\":\"i\",\"s\":\"g\",\"pid\":0,\"tid\":0,\"ts\":";
+        writeMicroseconds(out, frame);
+        out << "}";
+    }
+
+    for(const Event& event: _state->trace) {
+        separator();
+        out << "{\"name\":";
+        writeString(out, _zones[event.zone]);
+        out << ",\"cat\":\"magnum\",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.thread << ",\"ts\":";
+        writeMicroseconds(out, event.begin);
+        out << ",\"dur\":";
+        writeMicroseconds(out, event.end - event.begin);
+        out << "}";
+    }
+
+    out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+bool ZoneProfiler::exportChromeTrace(const std::string& filename) const {
+    std::ofstream out{filename, std::ofstream::binary};
+    if(!out.good()) {
+        Error() << "ZoneProfiler::exportChromeTrace(): cannot open file" << filename;
+        return false;
+    }
+
+    exportChromeTrace(out);
+    return true;
+}
+
+}}
@@ -0,0 +1,362 @@
+#ifndef Magnum_DebugTools_ZoneProfiler_h
+#define Magnum_DebugTools_ZoneProfiler_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::DebugTools::ZoneProfiler
+ */
+
+#include <chrono>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Magnum/Types.h"
+#include "Magnum/DebugTools/visibility.h"
+
+namespace Magnum { namespace DebugTools {
+
+/**
+@brief Hierarchical multi-threaded profiler
+
+Unlike @ref Profiler, which splits each frame into a flat list of sections,
+this profiler measures arbitrarily nested zones, possibly from multiple
+threads at once. Besides averages it calculates minimum, maximum and
+percentiles of per-frame zone duration and it can export the recorded zones
+in the [Chrome trace event format](https://github.com/catapult-project/catapult/blob/master/tracing/README.md),
+which can be then inspected in `chrome://tracing` or any other compatible
+viewer. Example usage:
+@code
+DebugTools::ZoneProfiler p;
+
+// Register named zones
+struct {
+    DebugTools::ZoneProfiler::Zone frame, physics, collisions, draw;
+} zones;
+zones.frame = p.addZone("Frame");
+zones.physics = p.addZone("Physics");
+zones.collisions = p.addZone("Collisions");
+zones.draw = p.addZone("Drawing");
+
+// Enable profiling, keeping the zones also for trace export
+p.setTraceEnabled(true);
+p.enable();
+
+void MyApplication::drawEvent() {
+    DebugTools::ZoneProfiler::Scope frame{p, zones.frame};
+
+    {
+        DebugTools::ZoneProfiler::Scope physics{p, zones.physics};
+
+        // ... physics simulation
+
+        {
+            DebugTools::ZoneProfiler::Scope collisions{p, zones.collisions};
+
+            // ... collision detection, nested in "Physics"
+        }
+    }
+
+    p.begin(zones.draw);
+    camera.draw(drawables);
+    p.end();
+
+    swapBuffers();
+    p.nextFrame();
+}
+
+// Print statistics, save the trace
+p.printStatistics();
+p.exportChromeTrace("trace.json");
+@endcode
+
+Zones have to be properly nested on each thread, i.e. @ref end() always ends
+the innermost zone started with @ref begin() on the same thread. Durations of
+a zone are inclusive, containing also durations of all zones nested in it.
+
+## Multi-threaded use
+
+Each thread records into its own buffer, which is created on first
+@ref begin() from that thread. The buffer is guarded by its own lock, which is
+contended only during @ref nextFrame() and trace export, so recording a zone
+consists of just a timestamp query and an uncontended lock. Use
+@ref setThreadName() to give the thread a name in the exported trace.
+
+Zones ended during given frame are accounted to that frame in
+@ref nextFrame(), regardless of thread they were recorded on. The
+@ref addZone(), @ref enable(), @ref disable() and @ref setMeasureDuration()
+functions are not thread-safe and recording must not happen while they are
+called.
+
+If Magnum is not built with @ref MAGNUM_BUILD_MULTITHREADED, all zones are
+recorded into a single buffer, the profiler should be then used only from a
+single thread.
+
+## Trace export
+
+With @ref setTraceEnabled() the profiler keeps all zones ended after
+@ref enable() and @ref exportChromeTrace() then writes them as complete
+events, each call to @ref nextFrame() is marked with a global instant event. To avoid
+unbounded memory growth the trace is capped to a given event count, the
+oldest events are discarded first.
+
+@see @ref Timeline
+*/
+class MAGNUM_DEBUGTOOLS_EXPORT ZoneProfiler {
+    public:
+        /**
+         * @brief Zone ID
+         *
+         * @see @ref addZone(), @ref begin()
+         */
+        typedef UnsignedInt Zone;
+
+        /**
+         * @brief Zone statistics
+         *
+         * Statistics of per-frame zone duration, calculated over the last
+         * @ref measureDuration() frames. Frames in which the zone was not
+         * recorded count as zero duration.
+         * @see @ref statistics()
+         */
+        struct Statistics {
+            std::chrono::nanoseconds min,   /**< @brief Minimal duration */
+                max,                        /**< @brief Maximal duration */
+                mean,                       /**< @brief Mean duration */
+                median,                     /**< @brief 50th percentile */
+                percentile95,               /**< @brief 95th percentile */
+                percentile99;               /**< @brief 99th percentile */
+
+            /** @brief Average count of zone recordings per frame */
+            Float count;
+        };
+
+        /**
+         * @brief Scoped zone
+         *
+         * Calls @ref begin() on construction and @ref end() on destruction.
+         * Does nothing if profiling is not enabled at the time of
+         * construction.
+         */
+        class MAGNUM_DEBUGTOOLS_EXPORT Scope {
+            public:
+                /** @brief Constructor */
+                explicit Scope(ZoneProfiler& profiler, Zone zone);
+
+                /** @brief Copying is not allowed */
+                Scope(const Scope&) = delete;
+
+                /** @brief Moving is not allowed */
+                Scope(Scope&&) = delete;
+
+                /** @brief Destructor */
+                ~Scope();
+
+                /** @brief Copying is not allowed */
+                Scope& operator=(const Scope&) = delete;
+
+                /** @brief Moving is not allowed */
+                Scope& operator=(Scope&&) = delete;
+
+            private:
+                ZoneProfiler* _profiler;
+        };
+
+        /** @brief Constructor */
+        explicit ZoneProfiler();
+
+        /** @brief Copying is not allowed */
+        ZoneProfiler(const ZoneProfiler&) = delete;
+
+        /** @brief Moving is not allowed */
+        ZoneProfiler(ZoneProfiler&&) = delete;
+
+        ~ZoneProfiler();
+
+        /** @brief Copying is not allowed */
+        ZoneProfiler& operator=(const ZoneProfiler&) = delete;
+
+        /** @brief Moving is not allowed */
+        ZoneProfiler& operator=(ZoneProfiler&&) = delete;
+
+        /** @brief Measure duration */
+        std::size_t measureDuration() const { return _measureDuration; }
+
+        /**
+         * @brief Set measure duration
+         *
+         * Statistics are calculated from given frame count. Default value is
+         * 60.
+         * @attention This function cannot be called if profiling is enabled.
+         */
+        void setMeasureDuration(std::size_t frames);
+
+        /** @brief Whether zones are kept for trace export */
+        bool isTraceEnabled() const { return _traceCapacity; }
+
+        /**
+         * @brief Enable or disable keeping zones for trace export
+         *
+         * If enabled, at most @p capacity last zones are kept for
+         * @ref exportChromeTrace(). Disabled by default.
+         * @attention This function cannot be called if profiling is enabled.
+         */
+        void setTraceEnabled(bool enabled, std::size_t capacity = 1024*1024);
+
+        /** @brief Zone count */
+        std::size_t zoneCount() const { return _zones.size(); }
+
+        /** @brief Zone name */
+        const std::string& zoneName(Zone zone) const;
+
+        /**
+         * @brief Add named zone
+         *
+         * @attention This function cannot be called if profiling is enabled.
+         */
+        Zone addZone(const std::string& name);
+
+        /** @brief Whether profiling is enabled */
+        bool isEnabled() const { return _enabled; }
+
+        /**
+         * @brief Enable profiling
+         *
+         * Clears all recorded data, including zones that are not ended yet.
+         * @see @ref disable()
+         */
+        void enable();
+
+        /**
+         * @brief Disable profiling
+         *
+         * Recorded data are kept, so it's still possible to query statistics
+         * and export the trace.
+         * @see @ref enable()
+         */
+        void disable();
+
+        /**
+         * @brief Set name of current thread
+         *
+         * The name is used in exported trace. Can be called only when
+         * profiling is enabled, the name is cleared by @ref enable().
+         */
+        void setThreadName(const std::string& name);
+
+        /**
+         * @brief Begin a zone in current thread
+         *
+         * The zone is nested in all zones that were started and not yet
+         * ended on current thread. Does nothing if profiling is disabled.
+         * @see @ref Scope
+         */
+        void begin(Zone zone);
+
+        /**
+         * @brief End a zone in current thread
+         *
+         * Ends the innermost zone started with @ref begin() on current
+         * thread. Does nothing if profiling is disabled.
+         */
+        void end();
+
+        /**
+         * @brief Advance to next frame
+         *
+         * Accounts all zones ended since last call to this function to
+         * current frame and advances to next. Call at the end of each frame.
+         * Does nothing if profiling is disabled.
+         */
+        void nextFrame();
+
+        /**
+         * @brief Count of measured frames
+         *
+         * At most @ref measureDuration().
+         */
+        std::size_t frameCount() const { return _frameCount; }
+
+        /**
+         * @brief Statistics for given zone
+         *
+         * If no frames were measured yet, returns zero duration in all
+         * fields.
+         */
+        Statistics statistics(Zone zone) const;
+
+        /**
+         * @brief Print statistics
+         *
+         * Prints minimal, mean, maximal and 95th percentile duration of each
+         * zone, ordered by mean duration. Does nothing if no frames were
+         * measured yet.
+         */
+        void printStatistics() const;
+
+        /**
+         * @brief Export recorded zones as Chrome trace
+         *
+         * Writes all zones kept since @ref enable() in the JSON trace event
+         * format. Expects that trace is enabled. Zones ended after last
+         * @ref nextFrame() are not included.
+         * @see @ref setTraceEnabled()
+         */
+        void exportChromeTrace(std::ostream& out) const;
+
+        /**
+         * @brief Export recorded zones as Chrome trace to a file
+         *
+         * Returns `false` if the file can't be written, `true` otherwise.
+         * See @ref exportChromeTrace(std::ostream&) const for more
+         * information.
+         */
+        bool exportChromeTrace(const std::string& filename) const;
+
+    private:
+        struct Event;
+        struct ThreadData;
+        struct State;
+
+        ThreadData& threadData();
+
+        bool _enabled;
+        std::size_t _id;
+        std::size_t _measureDuration, _currentFrame, _frameCount, _traceCapacity;
+        std::vector<std::string> _zones;
+
+        /* Per-zone duration in nanoseconds and recording count for each frame,
+           measureDuration*zoneCount items */
+        std::vector<UnsignedLong> _frameData;
+        std::vector<UnsignedInt> _frameCounts;
+
+        std::unique_ptr<State> _state;
+};
+
+}}
+
+#endif
@@ -0,0 +1,86 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <Corrade/Utility/Arguments.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/DebugTools/CommandCapture.h"
+
+namespace Magnum {
+
+/**
+@page magnum-commandtrace Command trace analysis utility
+@brief Summarizes traces recorded with @ref DebugTools::CommandCapture
+
+@section magnum-commandtrace-usage Usage
+
+    magnum-commandtrace [-h|--help] [--hotspots N] [--] trace
+
+Arguments:
+
+-   `trace` -- trace file saved with @ref DebugTools::CommandCapture::save()
+-   `-h`, `--help` -- display this help message and exit
+-   `--hotspots N` -- count of hotspots to list (default: `10`)
+
+@section magnum-commandtrace-example Example usage
+
+    magnum-commandtrace trace.bin
+
+Prints totals and per-frame averages of draw calls, buffer uploads, texture
+binds, shader program switches and renderer state changes together with a
+count of redundant ones and the objects that took the most time:
+
+    Frames: 120, duration: 2015320 us
+    Draw calls: 96360 (803 per frame, 0 redundant, 691204 us)
+    Buffer uploads: 240 (2 per frame, 0 redundant, 1966080 B, 2130 us)
+    Texture binds: 192720 (1606 per frame, 160600 redundant, 30221 us)
+    ...
+*/
+
+}
+
+using namespace Magnum;
+
+int main(int argc, char** argv) {
+    Utility::Arguments args;
+    args.addArgument("trace").setHelp("trace", "trace file")
+        .addOption("hotspots", "10").setHelp("hotspots", "count of hotspots to list", "N")
+        .setHelp("Summarizes traces recorded with DebugTools::CommandCapture.")
+        .parse(argc, argv);
+
+    if(!Utility::Directory::fileExists(args.value("trace"))) {
+        Error() << "Cannot open file" << args.value("trace");
+        return 1;
+    }
+
+    const Containers::Array<char> data = Utility::Directory::read(args.value("trace"));
+    const std::optional<DebugTools::CommandCapture::Summary> summary = DebugTools::CommandCapture::summarize(data, args.value<std::size_t>("hotspots"));
+    if(!summary) {
+        Error() << "Invalid trace file" << args.value("trace");
+        return 1;
+    }
+
+    Debug() << summary->text();
+    return 0;
+}
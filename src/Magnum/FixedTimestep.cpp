@@ -0,0 +1,78 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "FixedTimestep.h"
+
+#include <Corrade/Utility/Assert.h>
+
+namespace Magnum {
+
+FixedTimestep::FixedTimestep(const Float step, const UnsignedInt maxStepCount): _step{step}, _maxStepCount{maxStepCount}, _accumulated{}, _time{}, _droppedTime{}, _stepCount{} {
+    CORRADE_ASSERT(step > 0.0f && maxStepCount,
+        "FixedTimestep: expected positive step and max step count, got" << step << "and" << maxStepCount, );
+}
+
+FixedTimestep& FixedTimestep::setStep(const Float step) {
+    CORRADE_ASSERT(step > 0.0f,
+        "FixedTimestep::setStep(): expected positive step, got" << step, *this);
+    _step = step;
+    return *this;
+}
+
+FixedTimestep& FixedTimestep::setMaxStepCount(const UnsignedInt count) {
+    CORRADE_ASSERT(count,
+        "FixedTimestep::setMaxStepCount(): expected positive count", *this);
+    _maxStepCount = count;
+    return *this;
+}
+
+FixedTimestep& FixedTimestep::accumulate(const Float duration) {
+    _accumulated += duration;
+
+    /* Drop what can't be simulated in this frame */
+    const Float max = _step*_maxStepCount;
+    if(_accumulated > max) {
+        _droppedTime += _accumulated - max;
+        _accumulated = max;
+    }
+
+    return *this;
+}
+
+bool FixedTimestep::nextStep() {
+    if(_accumulated < _step) return false;
+
+    _accumulated -= _step;
+    _time += _step;
+    ++_stepCount;
+    return true;
+}
+
+void FixedTimestep::reset() {
+    _accumulated = _time = _droppedTime = 0.0f;
+    _stepCount = 0;
+}
+
+}
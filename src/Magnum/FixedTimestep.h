@@ -0,0 +1,187 @@
+#ifndef Magnum_FixedTimestep_h
+#define Magnum_FixedTimestep_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::FixedTimestep
+ */
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum {
+
+/**
+@brief Fixed timestep scheduler
+
+Decouples simulation from rendering by running the simulation in steps of
+constant duration, independently of the frame rate. Frame durations are
+accumulated with @ref accumulate() and every full step is then consumed with
+@ref nextStep(). The remaining fraction of a step is available through
+@ref alpha() and can be used to interpolate object transformations between
+the last two simulation states, for example using @ref SceneGraph::Interpolable.
+That allows lowering the simulation rate on weak machines without visible
+stutter.
+
+## Basic usage
+
+@code
+FixedTimestep timestep{1.0f/30.0f};
+
+void MyApplication::drawEvent() {
+    timestep.accumulate(timeline.previousFrameDuration());
+    while(timestep.nextStep()) {
+        interpolables.capture();
+        animables.step(timestep.time(), timestep.step());
+    }
+
+    // Draw the objects with transformations interpolated using alpha()
+    for(std::size_t i = 0; i != interpolables.size(); ++i)
+        interpolables[i].transformationMatrix(timestep.alpha());
+
+    swapBuffers();
+    redraw();
+    timeline.nextFrame();
+}
+@endcode
+
+## Frame time spikes
+
+If a frame takes too long, running all the steps it accumulated would make the
+next frame take even longer and the application would never catch up. Because
+of that, at most @ref maxStepCount() steps are run per frame and the rest of
+the accumulated time is dropped, making the simulation temporarily run slower
+than real time. The total dropped time is available through
+@ref droppedTime().
+@see @ref Timeline
+*/
+class MAGNUM_EXPORT FixedTimestep {
+    public:
+        /**
+         * @brief Constructor
+         * @param step          Step duration in seconds
+         * @param maxStepCount  Max count of steps run per frame
+         *
+         * Expects that both values are positive.
+         */
+        explicit FixedTimestep(Float step, UnsignedInt maxStepCount = 8);
+
+        /** @brief Step duration in seconds */
+        Float step() const { return _step; }
+
+        /**
+         * @brief Set step duration
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the duration is positive. The time accumulated so far
+         * is kept.
+         */
+        FixedTimestep& setStep(Float step);
+
+        /** @brief Max count of steps run per frame */
+        UnsignedInt maxStepCount() const { return _maxStepCount; }
+
+        /**
+         * @brief Set max count of steps run per frame
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the count is positive.
+         */
+        FixedTimestep& setMaxStepCount(UnsignedInt count);
+
+        /**
+         * @brief Accumulate frame duration
+         * @return Reference to self (for method chaining)
+         *
+         * Adds @p duration to the time waiting to be simulated. If it
+         * exceeds @ref maxStepCount() steps, the rest is dropped and added
+         * to @ref droppedTime().
+         * @see @ref nextStep()
+         */
+        FixedTimestep& accumulate(Float duration);
+
+        /**
+         * @brief Consume next simulation step
+         *
+         * If there's at least one step accumulated, advances @ref time() by
+         * @ref step() and returns `true`, otherwise returns `false`. Call it
+         * in a loop and run one simulation step for every `true`.
+         */
+        bool nextStep();
+
+        /**
+         * @brief Simulation time
+         *
+         * Sum of all steps consumed with @ref nextStep() since construction
+         * or the last @ref reset().
+         */
+        Float time() const { return _time; }
+
+        /**
+         * @brief Count of consumed steps
+         *
+         * Count of steps consumed with @ref nextStep() since construction or
+         * the last @ref reset().
+         */
+        UnsignedLong stepCount() const { return _stepCount; }
+
+        /**
+         * @brief Interpolation factor
+         *
+         * Fraction of the next step that is already accumulated, in range
+         * @f$ [0; 1) @f$ after all steps were consumed. Rendering
+         * transformations interpolated between the previous and the current
+         * simulation state using this factor makes the motion smooth even
+         * if the simulation runs slower than the rendering.
+         */
+        Float alpha() const { return _accumulated/_step; }
+
+        /**
+         * @brief Total dropped time
+         *
+         * Time that was not simulated because the frames were too long.
+         * @see @ref maxStepCount()
+         */
+        Float droppedTime() const { return _droppedTime; }
+
+        /**
+         * @brief Reset the scheduler
+         *
+         * Sets the simulation time, step count, accumulated and dropped time
+         * to zero.
+         */
+        void reset();
+
+    private:
+        Float _step;
+        UnsignedInt _maxStepCount;
+        Float _accumulated, _time, _droppedTime;
+        UnsignedLong _stepCount;
+};
+
+}
+
+#endif
@@ -0,0 +1,85 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "FrameAllocator.h"
+
+#include <Corrade/Utility/Assert.h>
+
+namespace Magnum {
+
+namespace {
+    #if !defined(CORRADE_GCC47_COMPATIBILITY) && !defined(CORRADE_TARGET_APPLE)
+    thread_local
+    #else
+    __thread
+    #endif
+    FrameAllocator* currentAllocator = nullptr;
+}
+
+FrameAllocator* FrameAllocator::current() { return currentAllocator; }
+
+void FrameAllocator::makeCurrent(FrameAllocator* const allocator) {
+    currentAllocator = allocator;
+}
+
+FrameAllocator::FrameAllocator(const std::size_t capacity): _data{capacity}, _used{0}, _overflowSize{0} {
+    if(!currentAllocator) currentAllocator = this;
+}
+
+FrameAllocator::~FrameAllocator() {
+    if(currentAllocator == this) currentAllocator = nullptr;
+}
+
+void* FrameAllocator::allocate(const std::size_t size, const std::size_t alignment) {
+    CORRADE_ASSERT(alignment && !(alignment & (alignment - 1)) && alignment <= alignof(std::max_align_t),
+        "FrameAllocator::allocate(): invalid alignment" << alignment, nullptr);
+
+    /* The block itself is aligned to max_align_t, so it's enough to align
+       the offset */
+    const std::size_t offset = (_used + alignment - 1) & ~(alignment - 1);
+    if(offset + size <= _data.size()) {
+        _used = offset + size;
+        return _data + offset;
+    }
+
+    /* Doesn't fit, fall back to the heap. Add the worst-case padding to the
+       used size so the enlarged block fits everything next time. */
+    _overflow.emplace_back(size);
+    _overflowSize += size + alignment - 1;
+    return _overflow.back().data();
+}
+
+void FrameAllocator::reset() {
+    if(!_overflow.empty()) {
+        _data = Containers::Array<char>{_used + _overflowSize};
+        _overflow.clear();
+    }
+
+    _used = 0;
+    _overflowSize = 0;
+}
+
+}
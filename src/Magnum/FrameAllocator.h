@@ -0,0 +1,200 @@
+#ifndef Magnum_FrameAllocator_h
+#define Magnum_FrameAllocator_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::FrameAllocator
+ */
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <vector>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum {
+
+/**
+@brief Per-frame linear allocator
+
+Bump allocator for temporary data that live at most until the end of current
+frame, such as draw parameter lists. Allocation is just a pointer increment in
+a preallocated block and nothing is freed until @ref reset(), which is
+expected to be called once per frame --- either explicitly or by
+@ref Timeline::nextFrame() when set via @ref Timeline::setFrameAllocator().
+
+If the block isn't large enough, the allocation falls back to the heap and
+the block is enlarged to the peak usage on next @ref reset(), so after a few
+frames the steady state doesn't touch the heap at all.
+
+The first allocator constructed in given thread is made current for that
+thread and is used by the library itself for transient allocations, for
+example in @ref MeshView::draw(AbstractShaderProgram&, Containers::ArrayView<const std::reference_wrapper<MeshView>>).
+Without a current allocator these allocations go to the heap.
+@code
+FrameAllocator frameAllocator;
+timeline.setFrameAllocator(&frameAllocator);
+
+void MyApplication::drawEvent() {
+    Containers::ArrayView<Matrix4> matrices = frameAllocator.allocateArray<Matrix4>(objects.size());
+    // ...
+
+    swapBuffers();
+    timeline.nextFrame(); // resets the allocator
+}
+@endcode
+*/
+class MAGNUM_EXPORT FrameAllocator {
+    public:
+        /**
+         * @brief Current allocator
+         *
+         * Returns `nullptr` if there is no current allocator for this
+         * thread.
+         * @see @ref makeCurrent()
+         */
+        static FrameAllocator* current();
+
+        /**
+         * @brief Make given allocator current
+         *
+         * Affects only current thread. Passing `nullptr` makes no allocator
+         * current. Newly created allocator is made current implicitly if
+         * there isn't any current allocator yet.
+         */
+        static void makeCurrent(FrameAllocator* allocator);
+
+        /**
+         * @brief Allocate an array from current allocator
+         *
+         * If there is a @ref current() allocator, returns array pointing to
+         * memory allocated using @ref allocateArray() and having an empty
+         * deleter, otherwise allocates the array on the heap.
+         */
+        template<class T> static Containers::Array<T> currentArray(std::size_t count);
+
+        /**
+         * @brief Constructor
+         * @param capacity      Initial capacity in bytes
+         */
+        explicit FrameAllocator(std::size_t capacity = 65536);
+
+        /** @brief Copying is not allowed */
+        FrameAllocator(const FrameAllocator&) = delete;
+
+        /** @brief Moving is not allowed */
+        FrameAllocator(FrameAllocator&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * If the allocator is current, no allocator is current afterwards.
+         */
+        ~FrameAllocator();
+
+        /** @brief Copying is not allowed */
+        FrameAllocator& operator=(const FrameAllocator&) = delete;
+
+        /** @brief Moving is not allowed */
+        FrameAllocator& operator=(FrameAllocator&&) = delete;
+
+        /**
+         * @brief Capacity in bytes
+         *
+         * Size of the preallocated block.
+         */
+        std::size_t capacity() const { return _data.size(); }
+
+        /**
+         * @brief Used size in bytes
+         *
+         * Count of bytes allocated since last @ref reset(), including
+         * alignment padding and heap allocations.
+         */
+        std::size_t usedSize() const { return _used + _overflowSize; }
+
+        /**
+         * @brief Count of heap allocations
+         *
+         * Count of allocations since last @ref reset() that didn't fit into
+         * the preallocated block.
+         */
+        std::size_t overflowCount() const { return _overflow.size(); }
+
+        /**
+         * @brief Allocate memory
+         * @param size          Size in bytes
+         * @param alignment     Alignment. Expected to be a power of two not
+         *      larger than @cpp alignof(std::max_align_t) @ce.
+         *
+         * The memory is valid until next @ref reset().
+         */
+        void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+        /**
+         * @brief Allocate an array
+         *
+         * The elements are value-initialized and valid until next
+         * @ref reset(). Destructors are never called, so the type is
+         * expected to be trivially destructible.
+         */
+        template<class T> Containers::ArrayView<T> allocateArray(std::size_t count);
+
+        /**
+         * @brief Reset the allocator
+         *
+         * Invalidates all allocations. If any allocation didn't fit into the
+         * preallocated block since last reset, the block is enlarged to fit
+         * all of them.
+         * @see @ref Timeline::setFrameAllocator()
+         */
+        void reset();
+
+    private:
+        Containers::Array<char> _data;
+        std::size_t _used, _overflowSize;
+        std::vector<Containers::Array<char>> _overflow;
+};
+
+template<class T> Containers::ArrayView<T> FrameAllocator::allocateArray(const std::size_t count) {
+    static_assert(std::is_trivially_destructible<T>::value, "destructors of frame-allocated types are not called");
+    T* const data = static_cast<T*>(allocate(count*sizeof(T), alignof(T)));
+    for(std::size_t i = 0; i != count; ++i) new(data + i) T();
+    return {data, count};
+}
+
+template<class T> Containers::Array<T> FrameAllocator::currentArray(const std::size_t count) {
+    if(FrameAllocator* const allocator = current())
+        return Containers::Array<T>{allocator->allocateArray<T>(count).data(), count, [](T*, std::size_t) {}};
+    return Containers::Array<T>{count};
+}
+
+}
+
+#endif
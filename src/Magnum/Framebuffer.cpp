@@ -194,6 +194,12 @@ void Framebuffer::invalidate(std::initializer_list<InvalidationAttachment> attac
     (this->*Context::current().state().framebuffer->invalidateImplementation)(attachments.size(), _attachments);
 }
 
+Framebuffer& Framebuffer::resolve(AbstractFramebuffer& destination, const Range2Di& rectangle, const FramebufferBlitMask mask, std::initializer_list<InvalidationAttachment> attachments) {
+    blit(*this, destination, rectangle, rectangle, mask, FramebufferBlitFilter::Nearest);
+    invalidate(attachments);
+    return *this;
+}
+
 #ifndef MAGNUM_TARGET_GLES2
 void Framebuffer::invalidate(std::initializer_list<InvalidationAttachment> attachments, const Range2Di& rectangle) {
     /** @todo C++14: use VLA to avoid heap allocation */
@@ -223,6 +229,13 @@ Framebuffer& Framebuffer::attachTexture(const BufferAttachment attachment, Textu
     return *this;
 }
 
+#if defined(MAGNUM_TARGET_GLES) && !defined(MAGNUM_TARGET_WEBGL)
+Framebuffer& Framebuffer::attachTextureMultisample(const BufferAttachment attachment, Texture2D& texture, const Int level, const Int samples) {
+    glFramebufferTexture2DMultisampleEXT(GLenum(bindInternal()), GLenum(attachment), GL_TEXTURE_2D, texture.id(), level, samples);
+    return *this;
+}
+#endif
+
 #ifndef MAGNUM_TARGET_GLES
 Framebuffer& Framebuffer::attachTexture(const BufferAttachment attachment, RectangleTexture& texture) {
     (this->*Context::current().state().framebuffer->texture2DImplementation)(attachment, GL_TEXTURE_RECTANGLE, texture.id(), 0);
@@ -542,6 +542,40 @@ class MAGNUM_EXPORT Framebuffer: public AbstractFramebuffer, public AbstractObje
          *      1.0.
          */
         void invalidate(std::initializer_list<InvalidationAttachment> attachments);
+
+        /**
+         * @brief Resolve multisampled framebuffer
+         * @param destination       Single-sampled framebuffer to resolve to
+         * @param rectangle         Rectangle to resolve
+         * @param mask              Which buffers to resolve
+         * @param attachments       Attachments to invalidate after the
+         *      resolve
+         * @return Reference to self (for method chaining)
+         *
+         * Equivalent to calling @ref blit() with the same source and
+         * destination rectangle and @ref FramebufferBlitFilter::Nearest
+         * filtering (the only filter allowed for depth and stencil buffers
+         * and the fastest one for color buffers, as no scaling is done),
+         * followed by @ref invalidate(std::initializer_list<InvalidationAttachment>)
+         * with @p attachments. Invalidating the multisampled attachments
+         * (together with depth and stencil attachments that are not needed
+         * anymore) right after the resolve allows tiled GPUs to avoid
+         * writing them back to memory. Example usage:
+         * @code
+         * multisampled.resolve(defaultFramebuffer, multisampled.viewport(), FramebufferBlit::Color,
+         *     {Framebuffer::ColorAttachment{0}, Framebuffer::InvalidationAttachment::Depth});
+         * @endcode
+         *
+         * On OpenGL ES with @es_extension{EXT,multisampled_render_to_texture}
+         * the separate resolve step can be avoided entirely by attaching a
+         * single-sampled texture using @ref attachTextureMultisample(),
+         * which is resolved implicitly.
+         * @see @ref mapForRead()
+         * @requires_gles30 Extension @es_extension{ANGLE,framebuffer_blit} or
+         *      @es_extension{NV,framebuffer_blit} in OpenGL ES 2.0.
+         * @requires_webgl20 Framebuffer blit is not available in WebGL 1.0.
+         */
+        Framebuffer& resolve(AbstractFramebuffer& destination, const Range2Di& rectangle, FramebufferBlitMask mask, std::initializer_list<InvalidationAttachment> attachments);
         #endif
 
         #ifndef MAGNUM_TARGET_GLES2
@@ -628,6 +662,28 @@ class MAGNUM_EXPORT Framebuffer: public AbstractFramebuffer, public AbstractObje
          */
         Framebuffer& attachTexture(BufferAttachment attachment, Texture2D& texture, Int level);
 
+        #if defined(MAGNUM_TARGET_GLES) && !defined(MAGNUM_TARGET_WEBGL)
+        /**
+         * @brief Attach texture to given buffer with implicit multisampling
+         * @param attachment        Buffer attachment
+         * @param texture           Texture
+         * @param level             Mip level
+         * @param samples           Sample count
+         * @return Reference to self (for method chaining)
+         *
+         * Rendering is done into an implicit multisampled buffer which is
+         * resolved into @p texture when the framebuffer contents are used
+         * and then discarded, thus no explicit @ref resolve() is needed. The
+         * framebuffer is bound before the operation (if not already).
+         * @see @ref detach(), @ref attachTexture(), @fn_gl{BindFramebuffer}
+         *      and @fn_gles_extension{FramebufferTexture2DMultisample,EXT,multisampled_render_to_texture}
+         * @requires_es_extension Extension @es_extension{EXT,multisampled_render_to_texture}
+         * @requires_gles Implicitly resolved multisampling is not available in
+         *      desktop OpenGL or WebGL.
+         */
+        Framebuffer& attachTextureMultisample(BufferAttachment attachment, Texture2D& texture, Int level, Int samples);
+        #endif
+
         #ifndef MAGNUM_TARGET_GLES
         /** @overload
          * @requires_gl31 Extension @extension{ARB,texture_rectangle}
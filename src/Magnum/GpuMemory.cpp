@@ -0,0 +1,108 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GpuMemory.h"
+
+#include <algorithm>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Context.h"
+#include "Magnum/Implementation/State.h"
+#include "Magnum/Implementation/GpuMemoryState.h"
+
+namespace Magnum {
+
+std::size_t GpuMemory::usage() {
+    return Context::current().state().gpuMemory->totalUsage;
+}
+
+std::size_t GpuMemory::usage(const Category category) {
+    return Context::current().state().gpuMemory->usage[UnsignedByte(category)];
+}
+
+std::size_t GpuMemory::peakUsage() {
+    return Context::current().state().gpuMemory->totalPeakUsage;
+}
+
+std::size_t GpuMemory::peakUsage(const Category category) {
+    return Context::current().state().gpuMemory->peakUsage[UnsignedByte(category)];
+}
+
+void GpuMemory::resetPeakUsage() {
+    Implementation::GpuMemoryState& state = *Context::current().state().gpuMemory;
+    std::copy_n(state.usage, std::size_t(Implementation::GpuMemoryState::CategoryCount), state.peakUsage);
+    state.totalPeakUsage = state.totalUsage;
+}
+
+std::size_t GpuMemory::allocationCount() {
+    return Context::current().state().gpuMemory->allocations.size();
+}
+
+std::vector<GpuMemory::Allocation> GpuMemory::largestAllocations(const std::size_t count) {
+    std::vector<Allocation> allocations;
+    allocations.reserve(Context::current().state().gpuMemory->allocations.size());
+    for(const auto& allocation: Context::current().state().gpuMemory->allocations)
+        allocations.push_back({Category(allocation.first >> 32), GLuint(allocation.first & 0xffffffffu), allocation.second.label, allocation.second.size});
+
+    /* Sort by size, then by category and ID to have deterministic output */
+    const std::size_t outputCount = std::min(count, allocations.size());
+    std::partial_sort(allocations.begin(), allocations.begin() + outputCount, allocations.end(), [](const Allocation& a, const Allocation& b) {
+        if(a.size != b.size) return a.size > b.size;
+        if(a.category != b.category) return a.category < b.category;
+        return a.id < b.id;
+    });
+    allocations.resize(outputCount);
+    return allocations;
+}
+
+void GpuMemory::printLargestAllocations(const std::size_t count) {
+    Debug() << "GPU memory usage:" << usage() << "bytes, peak" << peakUsage() << "bytes";
+    for(const Category category: {Category::Buffer, Category::Texture, Category::Renderbuffer})
+        Debug() << "   " << category << Debug::nospace << ":" << usage(category) << "bytes, peak" << peakUsage(category) << "bytes";
+
+    const std::vector<Allocation> allocations = largestAllocations(count);
+    if(allocations.empty()) return;
+
+    Debug() << "Largest allocations:";
+    for(const Allocation& allocation: allocations) {
+        Debug d;
+        d << "   " << allocation.size << "bytes" << allocation.category << allocation.id;
+        if(!allocation.label.empty()) d << allocation.label;
+    }
+}
+
+Debug& operator<<(Debug& debug, const GpuMemory::Category value) {
+    switch(value) {
+        #define _c(value) case GpuMemory::Category::value: return debug << "GpuMemory::Category::" #value;
+        _c(Buffer)
+        _c(Texture)
+        _c(Renderbuffer)
+        #undef _c
+    }
+
+    return debug << "GpuMemory::Category(" << Debug::nospace << reinterpret_cast<void*>(UnsignedByte(value)) << Debug::nospace << ")";
+}
+
+}
@@ -0,0 +1,158 @@
+#ifndef Magnum_GpuMemory_h
+#define Magnum_GpuMemory_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::GpuMemory
+ */
+
+#include <string>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/OpenGL.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum {
+
+/**
+@brief GPU memory accounting
+
+Tracks estimated amount of GPU memory held by @ref Buffer, texture and
+@ref Renderbuffer objects. The tracker is updated every time data storage is
+specified with @ref Buffer::setData(), @ref Buffer::setStorage(),
+@ref Texture::setStorage(), @ref Texture::setImage(),
+@ref Renderbuffer::setStorage() and similar functions, and the object is
+removed from it on destruction. Labels set with @ref Buffer::setLabel(),
+@ref AbstractTexture::setLabel() and @ref Renderbuffer::setLabel() are
+remembered, so they are available also without @extension{KHR,debug}. Example
+usage:
+@code
+Buffer vertices;
+vertices.setLabel("Terrain vertices")
+    .setData(data, BufferUsage::StaticDraw);
+
+Debug() << GpuMemory::usage(GpuMemory::Category::Buffer) << "bytes in buffers";
+GpuMemory::printLargestAllocations(5);
+@endcode
+
+The sizes are only estimates based on the internal format and size of the
+data store, the driver may need more due to alignment, padding or internal
+copies. Memory reported by the driver itself is available through
+@ref Context::totalGpuMemory() and @ref Context::availableGpuMemory(), if
+supported. The tracker is per-context.
+
+Objects that were released using @ref Buffer::release() and similar functions
+stay in the tracker until an object with the same ID is destroyed.
+*/
+class MAGNUM_EXPORT GpuMemory {
+    public:
+        /**
+         * @brief Allocation category
+         *
+         * @see @ref usage(Category), @ref peakUsage(Category)
+         */
+        enum class Category: UnsignedByte {
+            Buffer,         /**< @ref Magnum::Buffer "Buffer" */
+            Texture,        /**< Any texture */
+            Renderbuffer    /**< @ref Magnum::Renderbuffer "Renderbuffer" */
+        };
+
+        /**
+         * @brief Allocation
+         *
+         * @see @ref largestAllocations()
+         */
+        struct Allocation {
+            Category category;  /**< @brief Object category */
+            GLuint id;          /**< @brief OpenGL object ID */
+            std::string label;  /**< @brief Object label */
+            std::size_t size;   /**< @brief Estimated size in bytes */
+        };
+
+        GpuMemory() = delete;
+
+        /**
+         * @brief Estimated memory usage
+         *
+         * Sum of sizes of all tracked objects, in bytes.
+         * @see @ref peakUsage()
+         */
+        static std::size_t usage();
+
+        /** @brief Estimated memory usage of given category */
+        static std::size_t usage(Category category);
+
+        /**
+         * @brief Peak estimated memory usage
+         *
+         * Maximal value of @ref usage() since the context creation or since
+         * last @ref resetPeakUsage().
+         */
+        static std::size_t peakUsage();
+
+        /** @brief Peak estimated memory usage of given category */
+        static std::size_t peakUsage(Category category);
+
+        /**
+         * @brief Reset peak memory usage
+         *
+         * Sets peak usage of all categories to current usage.
+         */
+        static void resetPeakUsage();
+
+        /**
+         * @brief Count of tracked objects
+         *
+         * Includes also objects that don't have any storage yet, but have a
+         * label.
+         */
+        static std::size_t allocationCount();
+
+        /**
+         * @brief Largest allocations
+         *
+         * Returns at most @p count largest allocations, sorted by size from
+         * the largest.
+         */
+        static std::vector<Allocation> largestAllocations(std::size_t count);
+
+        /**
+         * @brief Print largest allocations
+         *
+         * Prints total usage of each category followed by @p count largest
+         * allocations to debug output.
+         * @see @ref largestAllocations()
+         */
+        static void printLargestAllocations(std::size_t count = 10);
+};
+
+/** @debugoperatorclassenum{Magnum::GpuMemory,Magnum::GpuMemory::Category} */
+MAGNUM_EXPORT Debug& operator<<(Debug& debug, GpuMemory::Category value);
+
+}
+
+#endif
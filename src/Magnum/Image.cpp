@@ -25,6 +25,8 @@
 
 #include "Image.h"
 
+#include <cstring>
+
 namespace Magnum {
 
 template<UnsignedInt dimensions> Image<dimensions>::Image(PixelStorage storage, PixelFormat format, PixelType type, const VectorTypeFor<dimensions, Int>& size, Containers::Array<char>&& data) noexcept: _storage{storage}, _format{format}, _type{type}, _size{size}, _data{std::move(data)} {
@@ -54,6 +56,111 @@ template<UnsignedInt dimensions> void CompressedImage<dimensions>::setData(
     _data = std::move(data);
 }
 
+namespace {
+
+template<std::size_t dimensions, class T> inline Vector3i pad(const T& value, const Int padding) {
+    return Vector3i::pad(Math::Vector<dimensions, Int>{value}, padding);
+}
+
+template<UnsignedInt dimensions> void copyImageInternal(const ImageView<dimensions>& source, const RangeTypeFor<dimensions, Int>& range, const PixelStorage& storage, const VectorTypeFor<dimensions, Int>& size, const Containers::ArrayView<char> data, const VectorTypeFor<dimensions, Int>& offset) {
+    const Vector3i sourceMin = pad<dimensions>(range.min(), 0);
+    const Vector3i copySize = pad<dimensions>(range.size(), 1);
+    const Vector3i destinationMin = pad<dimensions>(offset, 0);
+    CORRADE_ASSERT((sourceMin >= Vector3i{}).all() && (sourceMin + copySize <= pad<dimensions>(source.size(), 1)).all(),
+        "copyImage(): range out of bounds of the source image", );
+    CORRADE_ASSERT((destinationMin >= Vector3i{}).all() && (destinationMin + copySize <= pad<dimensions>(size, 1)).all(),
+        "copyImage(): range doesn't fit into the destination image", );
+    if(!copySize.product()) return;
+
+    Math::Vector3<std::size_t> sourceOffset, sourceDataSize, destinationOffset, destinationDataSize;
+    std::size_t pixelSize;
+    std::tie(sourceOffset, sourceDataSize, pixelSize) = source.storage().dataProperties(source.format(), source.type(), pad<dimensions>(source.size(), 1));
+    std::tie(destinationOffset, destinationDataSize, std::ignore) = storage.dataProperties(source.format(), source.type(), pad<dimensions>(size, 1));
+
+    const std::size_t sourceRowStride = sourceDataSize.x();
+    const std::size_t sourceSliceStride = sourceDataSize.x()*sourceDataSize.y();
+    const std::size_t destinationRowStride = destinationDataSize.x();
+    const std::size_t destinationSliceStride = destinationDataSize.x()*destinationDataSize.y();
+    const std::size_t rowSize = copySize.x()*pixelSize;
+
+    const char* src = source.data().data() + sourceOffset.sum() + sourceMin.z()*sourceSliceStride + sourceMin.y()*sourceRowStride + sourceMin.x()*pixelSize;
+    const std::size_t destinationBegin = destinationOffset.sum() + destinationMin.z()*destinationSliceStride + destinationMin.y()*destinationRowStride + destinationMin.x()*pixelSize;
+    CORRADE_ASSERT(destinationBegin + (copySize.z() - 1)*destinationSliceStride + (copySize.y() - 1)*destinationRowStride + rowSize <= data.size(),
+        "copyImage(): destination data too small, got" << data.size() << "bytes", );
+    char* dst = data.data() + destinationBegin;
+
+    /* Whole rows (and slices) on both sides, copy everything at once */
+    if(rowSize == sourceRowStride && rowSize == destinationRowStride &&
+       (copySize.z() == 1 || (rowSize*copySize.y() == sourceSliceStride && rowSize*copySize.y() == destinationSliceStride))) {
+        std::memcpy(dst, src, rowSize*copySize.y()*copySize.z());
+        return;
+    }
+
+    /* Otherwise row by row */
+    for(Int z = 0; z != copySize.z(); ++z) {
+        const char* srcRow = src + z*sourceSliceStride;
+        char* dstRow = dst + z*destinationSliceStride;
+        for(Int y = 0; y != copySize.y(); ++y) {
+            std::memcpy(dstRow, srcRow, rowSize);
+            srcRow += sourceRowStride;
+            dstRow += destinationRowStride;
+        }
+    }
+}
+
+template<UnsignedInt dimensions> inline void copyImageInternal(const ImageView<dimensions>& source, const RangeTypeFor<dimensions, Int>& range, Image<dimensions>& destination, const VectorTypeFor<dimensions, Int>& offset) {
+    CORRADE_ASSERT(destination.format() == source.format() && destination.type() == source.type(),
+        "copyImage(): destination has different format than the source", );
+    copyImageInternal<dimensions>(source, range, destination.storage(), destination.size(), destination.data(), offset);
+}
+
+template<UnsignedInt dimensions> Image<dimensions> subImageInternal(const ImageView<dimensions>& image, const RangeTypeFor<dimensions, Int>& range, const PixelStorage& storage) {
+    const VectorTypeFor<dimensions, Int> size{range.size()};
+    Math::Vector3<std::size_t> offset, dataSize;
+    std::tie(offset, dataSize, std::ignore) = storage.dataProperties(image.format(), image.type(), pad<dimensions>(size, 1));
+    Image<dimensions> out{storage, image.format(), image.type(), size, Containers::Array<char>{Containers::ValueInit, offset.sum() + dataSize.product()}};
+    copyImageInternal<dimensions>(image, range, out, {});
+    return out;
+}
+
+}
+
+void copyImage(const ImageView1D& source, const Range1Di& range, Image1D& destination, const Int offset) {
+    copyImageInternal<1>(source, range, destination, offset);
+}
+
+void copyImage(const ImageView2D& source, const Range2Di& range, Image2D& destination, const Vector2i& offset) {
+    copyImageInternal<2>(source, range, destination, offset);
+}
+
+void copyImage(const ImageView3D& source, const Range3Di& range, Image3D& destination, const Vector3i& offset) {
+    copyImageInternal<3>(source, range, destination, offset);
+}
+
+void copyImage(const ImageView1D& source, const Range1Di& range, const PixelStorage& storage, const Int size, const Containers::ArrayView<char> data, const Int offset) {
+    copyImageInternal<1>(source, range, storage, size, data, offset);
+}
+
+void copyImage(const ImageView2D& source, const Range2Di& range, const PixelStorage& storage, const Vector2i& size, const Containers::ArrayView<char> data, const Vector2i& offset) {
+    copyImageInternal<2>(source, range, storage, size, data, offset);
+}
+
+void copyImage(const ImageView3D& source, const Range3Di& range, const PixelStorage& storage, const Vector3i& size, const Containers::ArrayView<char> data, const Vector3i& offset) {
+    copyImageInternal<3>(source, range, storage, size, data, offset);
+}
+
+Image1D subImage(const ImageView1D& image, const Range1Di& range, const PixelStorage& storage) {
+    return subImageInternal<1>(image, range, storage);
+}
+
+Image2D subImage(const ImageView2D& image, const Range2Di& range, const PixelStorage& storage) {
+    return subImageInternal<2>(image, range, storage);
+}
+
+Image3D subImage(const ImageView3D& image, const Range3Di& range, const PixelStorage& storage) {
+    return subImageInternal<3>(image, range, storage);
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template class MAGNUM_EXPORT Image<1>;
 template class MAGNUM_EXPORT Image<2>;
@@ -26,12 +26,13 @@
 */
 
 /** @file
- * @brief Class @ref Magnum::Image, @ref Magnum::CompressedImage typedef @ref Magnum::Image1D, @ref Magnum::Image2D, @ref Magnum::Image3D, @ref Magnum::CompressedImage1D, @ref Magnum::CompressedImage2D, @ref Magnum::CompressedImage3D
+ * @brief Class @ref Magnum::Image, @ref Magnum::CompressedImage, function @ref Magnum::copyImage(), @ref Magnum::subImage(), typedef @ref Magnum::Image1D, @ref Magnum::Image2D, @ref Magnum::Image3D, @ref Magnum::CompressedImage1D, @ref Magnum::CompressedImage2D, @ref Magnum::CompressedImage3D
  */
 
 #include <Corrade/Containers/Array.h>
 
 #include "Magnum/ImageView.h"
+#include "Magnum/Math/Range.h"
 
 namespace Magnum {
 
@@ -235,6 +236,71 @@ typedef Image<2> Image2D;
 /** @brief Three-dimensional image */
 typedef Image<3> Image3D;
 
+/**
+@brief Copy part of an image into another image
+@param source       Source image
+@param range        Range of the source image to copy
+@param destination  Destination image
+@param offset       Offset in the destination image
+
+The destination is expected to have the same @ref PixelFormat and
+@ref PixelType as the source and to be large enough to contain the copied
+range at given offset. The @ref PixelStorage parameters of both images are
+taken into account. If both the source and the destination rows are
+contiguous in memory, the whole range is copied at once, otherwise it's copied
+row by row. Useful for building texture atlases, filling glyph caches or
+extracting tiles for texture streaming without going through the GPU.
+@see @ref subImage()
+*/
+MAGNUM_EXPORT void copyImage(const ImageView2D& source, const Range2Di& range, Image2D& destination, const Vector2i& offset = {});
+
+/** @overload */
+MAGNUM_EXPORT void copyImage(const ImageView1D& source, const Range1Di& range, Image1D& destination, Int offset = {});
+
+/** @overload */
+MAGNUM_EXPORT void copyImage(const ImageView3D& source, const Range3Di& range, Image3D& destination, const Vector3i& offset = {});
+
+/**
+@brief Copy part of an image into memory
+@param source       Source image
+@param range        Range of the source image to copy
+@param storage      Storage of the destination data
+@param size         Size of the destination image
+@param data         Destination data
+@param offset       Offset in the destination image
+
+Similar to @ref copyImage(const ImageView2D&, const Range2Di&, Image2D&, const Vector2i&),
+but the destination is described by its storage, size and data, which are
+expected to have the same @ref PixelFormat and @ref PixelType as the source.
+Useful for writing directly into mapped buffer memory or into data that are
+not owned by an @ref Image.
+*/
+MAGNUM_EXPORT void copyImage(const ImageView2D& source, const Range2Di& range, const PixelStorage& storage, const Vector2i& size, Containers::ArrayView<char> data, const Vector2i& offset = {});
+
+/** @overload */
+MAGNUM_EXPORT void copyImage(const ImageView1D& source, const Range1Di& range, const PixelStorage& storage, Int size, Containers::ArrayView<char> data, Int offset = {});
+
+/** @overload */
+MAGNUM_EXPORT void copyImage(const ImageView3D& source, const Range3Di& range, const PixelStorage& storage, const Vector3i& size, Containers::ArrayView<char> data, const Vector3i& offset = {});
+
+/**
+@brief Extract part of an image
+@param image        Source image
+@param range        Range to extract
+@param storage      Storage of the resulting image
+
+Allocates a new image with size of @p range and copies the data into it using
+@ref copyImage(). The result has the same @ref PixelFormat and @ref PixelType
+as the source.
+*/
+MAGNUM_EXPORT Image2D subImage(const ImageView2D& image, const Range2Di& range, const PixelStorage& storage = {});
+
+/** @overload */
+MAGNUM_EXPORT Image1D subImage(const ImageView1D& image, const Range1Di& range, const PixelStorage& storage = {});
+
+/** @overload */
+MAGNUM_EXPORT Image3D subImage(const ImageView3D& image, const Range3Di& range, const PixelStorage& storage = {});
+
 /**
 @brief Compressed image
 
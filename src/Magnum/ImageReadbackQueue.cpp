@@ -0,0 +1,116 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ImageReadbackQueue.h"
+
+#include <cstring>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/PixelFormat.h"
+
+namespace Magnum {
+
+template<UnsignedInt dimensions> ImageReadbackQueue<dimensions>::ImageReadbackQueue(const PixelStorage storage, const PixelFormat format, const PixelType type, const UnsignedInt bufferCount): _fences(bufferCount),
+    #ifndef MAGNUM_TARGET_GLES
+    _sync{Context::current().isExtensionSupported<Extensions::GL::ARB::sync>()},
+    #else
+    _sync{true},
+    #endif
+    _current{bufferCount - 1}, _pendingCount{}, _waitCount{}
+{
+    CORRADE_ASSERT(bufferCount, "ImageReadbackQueue: expected non-zero buffer count", );
+
+    _images.reserve(bufferCount);
+    for(UnsignedInt i = 0; i != bufferCount; ++i)
+        _images.emplace_back(storage, format, type);
+}
+
+template<UnsignedInt dimensions> ImageReadbackQueue<dimensions>::~ImageReadbackQueue() {
+    for(GLsync fence: _fences) if(fence) glDeleteSync(fence);
+}
+
+template<UnsignedInt dimensions> BufferImage<dimensions>& ImageReadbackQueue<dimensions>::acquire() {
+    CORRADE_ASSERT(_pendingCount < _images.size(),
+        "ImageReadbackQueue: all" << _images.size() << "buffers are pending, call retrieve() first", _images[_current]);
+
+    _current = (_current + 1) % _images.size();
+    ++_pendingCount;
+    return _images[_current];
+}
+
+template<UnsignedInt dimensions> void ImageReadbackQueue<dimensions>::fence() {
+    if(_sync) _fences[_current] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+template<UnsignedInt dimensions> std::optional<Image<dimensions>> ImageReadbackQueue<dimensions>::retrieveInternal(const bool wait) {
+    if(!_pendingCount) return std::nullopt;
+
+    const bool full = _pendingCount == _images.size();
+    const std::size_t oldest = (_current + _images.size() + 1 - _pendingCount) % _images.size();
+
+    if(_sync) {
+        GLsync& fence = _fences[oldest];
+
+        /* Flush so the fence gets signaled eventually, wait only if there's
+           no free buffer left */
+        GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        if(result == GL_TIMEOUT_EXPIRED) {
+            if(!full && !wait) return std::nullopt;
+
+            if(!wait) ++_waitCount;
+            do result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+            while(result == GL_TIMEOUT_EXPIRED);
+        }
+
+        glDeleteSync(fence);
+        fence = nullptr;
+
+    /* Without fences assume the GL is done with the oldest buffer once all
+       of them are used, mapping the buffer waits otherwise */
+    } else if(!full && !wait) return std::nullopt;
+
+    --_pendingCount;
+
+    /* Copy the data out of the buffer */
+    BufferImage<dimensions>& image = _images[oldest];
+    const std::size_t dataSize = Implementation::imageDataSize(image);
+    Containers::Array<char> data{dataSize};
+    const char* const mapped = image.buffer().template map<const char>(0, dataSize, Buffer::MapFlag::Read);
+    CORRADE_INTERNAL_ASSERT(mapped);
+    std::memcpy(data, mapped, dataSize);
+    CORRADE_INTERNAL_ASSERT_OUTPUT(image.buffer().unmap());
+
+    return Image<dimensions>{image.storage(), image.format(), image.type(), image.size(), std::move(data)};
+}
+
+#ifndef MAGNUM_TARGET_GLES
+template class MAGNUM_EXPORT ImageReadbackQueue<1>;
+#endif
+template class MAGNUM_EXPORT ImageReadbackQueue<2>;
+template class MAGNUM_EXPORT ImageReadbackQueue<3>;
+
+}
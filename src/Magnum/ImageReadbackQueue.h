@@ -0,0 +1,240 @@
+#ifndef Magnum_ImageReadbackQueue_h
+#define Magnum_ImageReadbackQueue_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+/** @file
+ * @brief Class @ref Magnum::ImageReadbackQueue, typedef @ref Magnum::ImageReadbackQueue1D, @ref Magnum::ImageReadbackQueue2D, @ref Magnum::ImageReadbackQueue3D
+ */
+#endif
+
+#include <vector>
+
+#include "Magnum/BufferImage.h"
+#include "Magnum/Image.h"
+#include "MagnumExternal/Optional/optional.hpp"
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+namespace Magnum {
+
+/**
+@brief Asynchronous image readback queue
+
+Reading framebuffer or texture contents into an @ref Image makes the driver
+wait until all commands rendering to it are finished, stalling the pipeline.
+This class instead reads the data into one of a pool of @ref BufferImage
+objects and gives them back to the application when the GL finishes the
+transfer, usually a few frames later.
+
+## Usage
+
+Call @ref read() or @ref image() to schedule the readback and @ref retrieve()
+to get the oldest completed image, if any. Calling both every frame results
+in a steady stream of images delayed by at most @ref bufferCount() frames:
+@code
+ImageReadbackQueue2D queue{PixelFormat::RGBA, PixelType::UnsignedByte};
+
+// each frame
+defaultFramebuffer.clear(FramebufferClear::Color);
+// draw the scene ...
+
+queue.read(defaultFramebuffer, {{}, defaultFramebuffer.viewport().size()});
+if(std::optional<Image2D> image = queue.retrieve())
+    encoder.addFrame(*image);
+@endcode
+
+Texture contents can be downloaded the same way using @ref image(), for any
+texture type that has an @ref Texture::image(Int, BufferImage<dimensions>&, BufferUsage) "image()"
+overload taking a @ref BufferImage of matching dimension count.
+
+@anchor ImageReadbackQueue-performance-optimization
+## Performance optimizations
+
+If @extension{ARB,sync} (part of OpenGL 3.2) is available (fences are always
+available in OpenGL ES 3.0), a fence is placed after each readback and
+@ref retrieve() returns the image only after the GL signals the fence, so
+mapping the buffer never stalls. It blocks only when all buffers are used and
+the oldest one is still not done, count of such waits is available through
+@ref waitCount(). Without fences, @ref retrieve() gives back the oldest image
+only after all buffers are used, assuming the GL is done with it by then. Use
+@ref retrieveBlocking() to get the remaining images when no more readbacks are
+scheduled.
+
+@see @ref ImageReadbackQueue1D, @ref ImageReadbackQueue2D,
+    @ref ImageReadbackQueue3D, @ref TextureUploadQueue
+@requires_gles30 Pixel buffer objects are not available in OpenGL ES 2.0.
+@requires_gles Buffer mapping is not available in WebGL.
+*/
+template<UnsignedInt dimensions> class ImageReadbackQueue {
+    public:
+        enum: UnsignedInt {
+            Dimensions = dimensions /**< Image dimension count */
+        };
+
+        /**
+         * @brief Constructor
+         * @param storage       Storage of pixel data
+         * @param format        Format of pixel data
+         * @param type          Data type of pixel data
+         * @param bufferCount   Buffer count. Should be at least the count of
+         *      frames the GL is allowed to lag behind the application.
+         *
+         * The buffers are allocated on first use.
+         */
+        explicit ImageReadbackQueue(PixelStorage storage, PixelFormat format, PixelType type, UnsignedInt bufferCount = 3);
+
+        /** @overload
+         *
+         * Similar to the above, but uses default @ref PixelStorage parameters.
+         */
+        explicit ImageReadbackQueue(PixelFormat format, PixelType type, UnsignedInt bufferCount = 3): ImageReadbackQueue{{}, format, type, bufferCount} {}
+
+        /** @brief Copying is not allowed */
+        ImageReadbackQueue(const ImageReadbackQueue<dimensions>&) = delete;
+
+        /** @brief Moving is not allowed */
+        ImageReadbackQueue(ImageReadbackQueue<dimensions>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Deletes all pending fences.
+         * @see @fn_gl{DeleteSync}
+         */
+        ~ImageReadbackQueue();
+
+        /** @brief Copying is not allowed */
+        ImageReadbackQueue<dimensions>& operator=(const ImageReadbackQueue<dimensions>&) = delete;
+
+        /** @brief Moving is not allowed */
+        ImageReadbackQueue<dimensions>& operator=(ImageReadbackQueue<dimensions>&&) = delete;
+
+        /** @brief Buffer count */
+        UnsignedInt bufferCount() const { return _images.size(); }
+
+        /** @brief Count of readbacks not yet retrieved */
+        UnsignedInt pendingCount() const { return _pendingCount; }
+
+        /**
+         * @brief Read framebuffer contents
+         * @param framebuffer   Framebuffer
+         * @param rectangle     Framebuffer rectangle to read
+         * @return Reference to self (for method chaining)
+         *
+         * Calls `framebuffer.read(rectangle, buffer, BufferUsage::StreamRead)`
+         * with next free buffer. Expects that there is a free buffer, i.e.
+         * that @ref pendingCount() is less than @ref bufferCount().
+         * @see @ref AbstractFramebuffer::read(const Range2Di&, BufferImage2D&, BufferUsage),
+         *      @fn_gl{FenceSync}
+         */
+        template<class T> ImageReadbackQueue<dimensions>& read(T& framebuffer, const RangeTypeFor<dimensions, Int>& rectangle) {
+            framebuffer.read(rectangle, acquire(), BufferUsage::StreamRead);
+            fence();
+            return *this;
+        }
+
+        /**
+         * @brief Read texture contents
+         * @param texture       Texture
+         * @param level         Mip level
+         * @return Reference to self (for method chaining)
+         *
+         * Calls `texture.image(level, buffer, BufferUsage::StreamRead)` with
+         * next free buffer. Expects that there is a free buffer, i.e. that
+         * @ref pendingCount() is less than @ref bufferCount().
+         * @see @ref Texture::image(Int, BufferImage<dimensions>&, BufferUsage),
+         *      @fn_gl{FenceSync}
+         * @requires_gl Texture image queries are not available in OpenGL ES.
+         */
+        template<class T> ImageReadbackQueue<dimensions>& image(T& texture, Int level) {
+            texture.image(level, acquire(), BufferUsage::StreamRead);
+            fence();
+            return *this;
+        }
+
+        /**
+         * @brief Retrieve oldest completed image
+         *
+         * If the GL finished the oldest pending readback, maps the buffer,
+         * copies the data out and returns them. If all buffers are pending,
+         * waits for the oldest one. Otherwise returns `std::nullopt`. See
+         * @ref ImageReadbackQueue-performance-optimization "class documentation"
+         * for more information.
+         * @see @ref retrieveBlocking(), @fn_gl{ClientWaitSync},
+         *      @fn_gl{DeleteSync},
+         *      @ref Buffer::map(GLintptr, GLsizeiptr, Buffer::MapFlags)
+         */
+        std::optional<Image<dimensions>> retrieve() { return retrieveInternal(false); }
+
+        /**
+         * @brief Retrieve oldest pending image, blocking if needed
+         *
+         * Unlike @ref retrieve() waits for the oldest pending readback even if
+         * there are free buffers left, useful for getting the last images
+         * e.g. at the end of a recording. Returns `std::nullopt` only if
+         * there is no readback pending.
+         */
+        std::optional<Image<dimensions>> retrieveBlocking() { return retrieveInternal(true); }
+
+        /**
+         * @brief Count of waits for the GL
+         *
+         * Count of times @ref retrieve() had to block because the GL didn't
+         * finish the oldest readback yet. Waits in @ref retrieveBlocking() are
+         * not counted. Always `0` if @extension{ARB,sync} is not available.
+         */
+        UnsignedInt waitCount() const { return _waitCount; }
+
+    private:
+        BufferImage<dimensions>& acquire();
+        void fence();
+        std::optional<Image<dimensions>> retrieveInternal(bool wait);
+
+        std::vector<BufferImage<dimensions>> _images;
+        std::vector<GLsync> _fences;
+        bool _sync;
+        UnsignedInt _current,
+            _pendingCount,
+            _waitCount;
+};
+
+/** @brief One-dimensional image readback queue */
+#ifndef MAGNUM_TARGET_GLES
+typedef ImageReadbackQueue<1> ImageReadbackQueue1D;
+#endif
+
+/** @brief Two-dimensional image readback queue */
+typedef ImageReadbackQueue<2> ImageReadbackQueue2D;
+
+/** @brief Three-dimensional image readback queue */
+typedef ImageReadbackQueue<3> ImageReadbackQueue3D;
+
+}
+#else
+#error this header is not available in OpenGL ES 2.0 and WebGL build
+#endif
+
+#endif
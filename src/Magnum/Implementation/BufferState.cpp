@@ -31,6 +31,7 @@
 #include "Magnum/Extensions.h"
 
 #include "State.h"
+#include "fastPaths.h"
 
 namespace Magnum { namespace Implementation {
 
@@ -82,7 +83,7 @@ std::size_t BufferState::indexForTarget(Buffer::TargetHint target) {
     CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
 }
 
-BufferState::BufferState(Context& context, std::vector<std::string>& extensions): bindings()
+BufferState::BufferState(Context& context, std::vector<const char*>& extensions): bindings(), uploadCount(0), uploadSize(0)
     #ifndef MAGNUM_TARGET_GLES2
     #ifndef MAGNUM_TARGET_GLES
     , minMapAlignment(0)
@@ -105,26 +106,30 @@ BufferState::BufferState(Context& context, std::vector<std::string>& extensions)
         createImplementation = &Buffer::createImplementationDefault;
     }
 
+    /* The fast-path probe might have found the bind implementation to be
+       faster, see Implementation/fastPaths.cpp */
     #ifndef MAGNUM_TARGET_GLES
-    if(context.isExtensionSupported<Extensions::GL::ARB::direct_state_access>()) {
+    if(!(context.fastPaths() & FastPath::BufferBind) && context.isExtensionSupported<Extensions::GL::ARB::direct_state_access>()) {
         extensions.push_back(Extensions::GL::ARB::direct_state_access::string());
 
         copyImplementation = &Buffer::copyImplementationDSA;
         getParameterImplementation = &Buffer::getParameterImplementationDSA;
         getSubDataImplementation = &Buffer::getSubDataImplementationDSA;
         dataImplementation = &Buffer::dataImplementationDSA;
+        storageImplementation = &Buffer::storageImplementationDSA;
         subDataImplementation = &Buffer::subDataImplementationDSA;
         mapImplementation = &Buffer::mapImplementationDSA;
         mapRangeImplementation = &Buffer::mapRangeImplementationDSA;
         flushMappedRangeImplementation = &Buffer::flushMappedRangeImplementationDSA;
         unmapImplementation = &Buffer::unmapImplementationDSA;
-    } else if(context.isExtensionSupported<Extensions::GL::EXT::direct_state_access>()) {
+    } else if(!(context.fastPaths() & FastPath::BufferBind) && context.isExtensionSupported<Extensions::GL::EXT::direct_state_access>()) {
         extensions.push_back(Extensions::GL::EXT::direct_state_access::string());
 
         copyImplementation = &Buffer::copyImplementationDSAEXT;
         getParameterImplementation = &Buffer::getParameterImplementationDSAEXT;
         getSubDataImplementation = &Buffer::getSubDataImplementationDSAEXT;
         dataImplementation = &Buffer::dataImplementationDSAEXT;
+        storageImplementation = &Buffer::storageImplementationDSAEXT;
         subDataImplementation = &Buffer::subDataImplementationDSAEXT;
         mapImplementation = &Buffer::mapImplementationDSAEXT;
         mapRangeImplementation = &Buffer::mapRangeImplementationDSAEXT;
@@ -141,6 +146,9 @@ BufferState::BufferState(Context& context, std::vector<std::string>& extensions)
         getSubDataImplementation = &Buffer::getSubDataImplementationDefault;
         #endif
         dataImplementation = &Buffer::dataImplementationDefault;
+        #ifndef MAGNUM_TARGET_GLES
+        storageImplementation = &Buffer::storageImplementationDefault;
+        #endif
         subDataImplementation = &Buffer::subDataImplementationDefault;
         #ifndef MAGNUM_TARGET_WEBGL
         mapImplementation = &Buffer::mapImplementationDefault;
@@ -150,6 +158,11 @@ BufferState::BufferState(Context& context, std::vector<std::string>& extensions)
         #endif
     }
 
+    #ifndef MAGNUM_TARGET_GLES
+    if(context.fastPaths() & FastPath::BufferMapRange)
+        subDataImplementation = &Buffer::subDataImplementationMapRange;
+    #endif
+
     #ifndef MAGNUM_TARGET_GLES
     if(context.isExtensionSupported<Extensions::GL::ARB::invalidate_subdata>()) {
         extensions.push_back(Extensions::GL::ARB::invalidate_subdata::string());
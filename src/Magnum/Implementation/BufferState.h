@@ -46,7 +46,7 @@ struct BufferState {
     static std::size_t indexForTarget(Buffer::TargetHint target);
     static const Buffer::TargetHint targetForIndex[TargetCount-1];
 
-    explicit BufferState(Context& context, std::vector<std::string>& extensions);
+    explicit BufferState(Context& context, std::vector<const char*>& extensions);
 
     void reset();
 
@@ -61,6 +61,9 @@ struct BufferState {
     void(Buffer::*getSubDataImplementation)(GLintptr, GLsizeiptr, GLvoid*);
     #endif
     void(Buffer::*dataImplementation)(GLsizeiptr, const GLvoid*, BufferUsage);
+    #ifndef MAGNUM_TARGET_GLES
+    void(Buffer::*storageImplementation)(GLsizeiptr, const GLvoid*, Buffer::StorageFlags);
+    #endif
     void(Buffer::*subDataImplementation)(GLintptr, GLsizeiptr, const GLvoid*);
     void(Buffer::*invalidateImplementation)();
     void(Buffer::*invalidateSubImplementation)(GLintptr, GLsizeiptr);
@@ -74,6 +77,9 @@ struct BufferState {
     /* Currently bound buffer for all targets */
     GLuint bindings[TargetCount];
 
+    /* Count and total size of data uploads */
+    UnsignedLong uploadCount, uploadSize;
+
     /* Limits */
     #ifndef MAGNUM_TARGET_GLES2
     GLint
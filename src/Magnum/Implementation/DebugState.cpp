@@ -31,7 +31,7 @@
 
 namespace Magnum { namespace Implementation {
 
-DebugState::DebugState(Context& context, std::vector<std::string>& extensions):
+DebugState::DebugState(Context& context, std::vector<const char*>& extensions):
     maxLabelLength{0},
     maxLoggedMessages{0},
     maxMessageLength{0},
@@ -37,7 +37,7 @@
 namespace Magnum { namespace Implementation {
 
 struct DebugState {
-    explicit DebugState(Context& context, std::vector<std::string>& extensions);
+    explicit DebugState(Context& context, std::vector<const char*>& extensions);
 
     std::string(*getLabelImplementation)(GLenum, GLuint);
     void(*labelImplementation)(GLenum, GLuint, Containers::ArrayView<const char>);
@@ -52,6 +52,9 @@ struct DebugState {
     DebugOutput::Callback messageCallback;
 };
 
+/* Used by DebugOutput::setDefaultCallback() and DebugOutputQueue::drain() */
+void printDebugOutputMessage(Debug& output, DebugOutput::Source source, DebugOutput::Type type, UnsignedInt id, DebugOutput::Severity severity, const std::string& string);
+
 }}
 
 #endif
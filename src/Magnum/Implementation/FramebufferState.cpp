@@ -35,7 +35,7 @@ namespace Magnum { namespace Implementation {
 
 constexpr const Range2Di FramebufferState::DisengagedViewport;
 
-FramebufferState::FramebufferState(Context& context, std::vector<std::string>& extensions): readBinding{0}, drawBinding{0}, renderbufferBinding{0}, maxDrawBuffers{0}, maxColorAttachments{0}, maxRenderbufferSize{0},
+FramebufferState::FramebufferState(Context& context, std::vector<const char*>& extensions): readBinding{0}, drawBinding{0}, renderbufferBinding{0}, maxDrawBuffers{0}, maxColorAttachments{0}, maxRenderbufferSize{0},
     #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
     maxSamples{0},
     #endif
@@ -42,7 +42,7 @@ namespace Magnum { namespace Implementation {
 struct FramebufferState {
     constexpr static const Range2Di DisengagedViewport{{}, {-1, -1}};
 
-    explicit FramebufferState(Context& context, std::vector<std::string>& extensions);
+    explicit FramebufferState(Context& context, std::vector<const char*>& extensions);
 
     void reset();
 
@@ -0,0 +1,204 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GpuMemoryState.h"
+
+#include <algorithm>
+
+namespace Magnum { namespace Implementation {
+
+std::size_t textureFormatBits(const GLenum format) {
+    /* Using numeric values so all formats are handled regardless of the
+       target, as the headers for ES and WebGL don't have all of them */
+    switch(format) {
+        case 0x1903: /* GL_RED */
+        case 0x8229: /* GL_R8 */
+        case 0x8F94: /* GL_R8_SNORM */
+        case 0x8231: /* GL_R8I */
+        case 0x8232: /* GL_R8UI */
+        case 0x803C: /* GL_ALPHA8 */
+        case 0x8040: /* GL_LUMINANCE8 */
+        case 0x8D48: /* GL_STENCIL_INDEX8 */
+        case 0x2A10: /* GL_R3_G3_B2 */
+            return 8;
+
+        case 0x8227: /* GL_RG */
+        case 0x822B: /* GL_RG8 */
+        case 0x8F95: /* GL_RG8_SNORM */
+        case 0x8237: /* GL_RG8I */
+        case 0x8238: /* GL_RG8UI */
+        case 0x822A: /* GL_R16 */
+        case 0x8F98: /* GL_R16_SNORM */
+        case 0x822D: /* GL_R16F */
+        case 0x8233: /* GL_R16I */
+        case 0x8234: /* GL_R16UI */
+        case 0x8056: /* GL_RGBA4 */
+        case 0x8057: /* GL_RGB5_A1 */
+        case 0x8D62: /* GL_RGB565 */
+        case 0x81A5: /* GL_DEPTH_COMPONENT16 */
+        case 0x8045: /* GL_LUMINANCE8_ALPHA8 */
+            return 16;
+
+        case 0x8051: /* GL_RGB8 */
+        case 0x8F96: /* GL_RGB8_SNORM */
+        case 0x8C41: /* GL_SRGB8 */
+        case 0x8D8F: /* GL_RGB8I */
+        case 0x8D7D: /* GL_RGB8UI */
+        case 0x81A6: /* GL_DEPTH_COMPONENT24 */
+            return 24;
+
+        /* Unsized RGB is usually padded to four components */
+        case 0x1907: /* GL_RGB */
+        case 0x1908: /* GL_RGBA */
+        case 0x8058: /* GL_RGBA8 */
+        case 0x8F97: /* GL_RGBA8_SNORM */
+        case 0x8C43: /* GL_SRGB8_ALPHA8 */
+        case 0x8D8E: /* GL_RGBA8I */
+        case 0x8D7C: /* GL_RGBA8UI */
+        case 0x8059: /* GL_RGB10_A2 */
+        case 0x906F: /* GL_RGB10_A2UI */
+        case 0x8C3A: /* GL_R11F_G11F_B10F */
+        case 0x8C3D: /* GL_RGB9_E5 */
+        case 0x822C: /* GL_RG16 */
+        case 0x8F99: /* GL_RG16_SNORM */
+        case 0x822F: /* GL_RG16F */
+        case 0x8239: /* GL_RG16I */
+        case 0x823A: /* GL_RG16UI */
+        case 0x822E: /* GL_R32F */
+        case 0x8235: /* GL_R32I */
+        case 0x8236: /* GL_R32UI */
+        case 0x1902: /* GL_DEPTH_COMPONENT */
+        case 0x81A7: /* GL_DEPTH_COMPONENT32 */
+        case 0x8CAC: /* GL_DEPTH_COMPONENT32F */
+        case 0x84F9: /* GL_DEPTH_STENCIL */
+        case 0x88F0: /* GL_DEPTH24_STENCIL8 */
+            return 32;
+
+        case 0x8054: /* GL_RGB16 */
+        case 0x8F9A: /* GL_RGB16_SNORM */
+        case 0x881B: /* GL_RGB16F */
+        case 0x8D89: /* GL_RGB16I */
+        case 0x8D77: /* GL_RGB16UI */
+            return 48;
+
+        case 0x805B: /* GL_RGBA16 */
+        case 0x8F9B: /* GL_RGBA16_SNORM */
+        case 0x881A: /* GL_RGBA16F */
+        case 0x8D88: /* GL_RGBA16I */
+        case 0x8D76: /* GL_RGBA16UI */
+        case 0x8230: /* GL_RG32F */
+        case 0x823B: /* GL_RG32I */
+        case 0x823C: /* GL_RG32UI */
+        case 0x8CAD: /* GL_DEPTH32F_STENCIL8 */
+            return 64;
+
+        case 0x8815: /* GL_RGB32F */
+        case 0x8D83: /* GL_RGB32I */
+        case 0x8D71: /* GL_RGB32UI */
+            return 96;
+
+        case 0x8814: /* GL_RGBA32F */
+        case 0x8D82: /* GL_RGBA32I */
+        case 0x8D70: /* GL_RGBA32UI */
+            return 128;
+
+        case 0x83F0: /* GL_COMPRESSED_RGB_S3TC_DXT1_EXT */
+        case 0x83F1: /* GL_COMPRESSED_RGBA_S3TC_DXT1_EXT */
+        case 0x8DBB: /* GL_COMPRESSED_RED_RGTC1 */
+        case 0x8DBC: /* GL_COMPRESSED_SIGNED_RED_RGTC1 */
+        case 0x9274: /* GL_COMPRESSED_RGB8_ETC2 */
+        case 0x9275: /* GL_COMPRESSED_SRGB8_ETC2 */
+        case 0x9276: /* GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2 */
+        case 0x9277: /* GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2 */
+        case 0x9270: /* GL_COMPRESSED_R11_EAC */
+        case 0x9271: /* GL_COMPRESSED_SIGNED_R11_EAC */
+            return 4;
+
+        case 0x83F2: /* GL_COMPRESSED_RGBA_S3TC_DXT3_EXT */
+        case 0x83F3: /* GL_COMPRESSED_RGBA_S3TC_DXT5_EXT */
+        case 0x8DBD: /* GL_COMPRESSED_RG_RGTC2 */
+        case 0x8DBE: /* GL_COMPRESSED_SIGNED_RG_RGTC2 */
+        case 0x8E8C: /* GL_COMPRESSED_RGBA_BPTC_UNORM */
+        case 0x8E8D: /* GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM */
+        case 0x8E8E: /* GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT */
+        case 0x8E8F: /* GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT */
+        case 0x9278: /* GL_COMPRESSED_RGBA8_ETC2_EAC */
+        case 0x9279: /* GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC */
+        case 0x9272: /* GL_COMPRESSED_RG11_EAC */
+        case 0x9273: /* GL_COMPRESSED_SIGNED_RG11_EAC */
+        case 0x93B0: /* GL_COMPRESSED_RGBA_ASTC_4x4_KHR */
+        case 0x93D0: /* GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR */
+            return 8;
+    }
+
+    /* Unknown format, assume four bytes per pixel */
+    return 32;
+}
+
+GpuMemoryState::GpuMemoryState(): usage{}, peakUsage{}, totalUsage{}, totalPeakUsage{} {}
+
+namespace {
+    inline UnsignedLong key(const GpuMemory::Category category, const GLuint id) {
+        return (UnsignedLong(category) << 32)|id;
+    }
+}
+
+void GpuMemoryState::update(const GpuMemory::Category category, Allocation& allocation, const std::size_t size) {
+    const UnsignedByte index = UnsignedByte(category);
+    usage[index] = usage[index] - allocation.size + size;
+    totalUsage = totalUsage - allocation.size + size;
+    allocation.size = size;
+
+    peakUsage[index] = std::max(peakUsage[index], usage[index]);
+    totalPeakUsage = std::max(totalPeakUsage, totalUsage);
+}
+
+void GpuMemoryState::setSize(const GpuMemory::Category category, const GLuint id, const std::size_t size) {
+    Allocation& allocation = allocations[key(category, id)];
+    allocation.sizes.assign(1, size);
+    update(category, allocation, size);
+}
+
+void GpuMemoryState::setSize(const GpuMemory::Category category, const GLuint id, const std::size_t slot, const std::size_t size) {
+    Allocation& allocation = allocations[key(category, id)];
+    if(allocation.sizes.size() <= slot) allocation.sizes.resize(slot + 1);
+    const std::size_t newSize = allocation.size - allocation.sizes[slot] + size;
+    allocation.sizes[slot] = size;
+    update(category, allocation, newSize);
+}
+
+void GpuMemoryState::setLabel(const GpuMemory::Category category, const GLuint id, std::string label) {
+    allocations[key(category, id)].label = std::move(label);
+}
+
+void GpuMemoryState::remove(const GpuMemory::Category category, const GLuint id) {
+    auto found = allocations.find(key(category, id));
+    if(found == allocations.end()) return;
+
+    update(category, found->second, 0);
+    allocations.erase(found);
+}
+
+}}
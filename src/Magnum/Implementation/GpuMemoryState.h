@@ -0,0 +1,72 @@
+#ifndef Magnum_Implementation_GpuMemoryState_h
+#define Magnum_Implementation_GpuMemoryState_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Magnum/GpuMemory.h"
+
+namespace Magnum { namespace Implementation {
+
+/* Estimated bits per pixel of given internal texture or renderbuffer format */
+std::size_t textureFormatBits(GLenum format);
+
+struct GpuMemoryState {
+    enum: std::size_t { CategoryCount = 3 };
+
+    struct Allocation {
+        std::string label;
+        /* Sizes of particular texture levels/faces, a single item for buffers
+           and renderbuffers */
+        std::vector<std::size_t> sizes;
+        std::size_t size = 0;
+    };
+
+    explicit GpuMemoryState();
+
+    /* Replaces the whole storage of given object */
+    void setSize(GpuMemory::Category category, GLuint id, std::size_t size);
+
+    /* Replaces size of one texture level/face */
+    void setSize(GpuMemory::Category category, GLuint id, std::size_t slot, std::size_t size);
+
+    void setLabel(GpuMemory::Category category, GLuint id, std::string label);
+
+    void remove(GpuMemory::Category category, GLuint id);
+
+    std::unordered_map<UnsignedLong, Allocation> allocations;
+    std::size_t usage[CategoryCount], peakUsage[CategoryCount];
+    std::size_t totalUsage, totalPeakUsage;
+
+    private:
+        void update(GpuMemory::Category category, Allocation& allocation, std::size_t size);
+};
+
+}}
+
+#endif
@@ -30,10 +30,11 @@
 #include "Magnum/MeshView.h"
 
 #include "State.h"
+#include "fastPaths.h"
 
 namespace Magnum { namespace Implementation {
 
-MeshState::MeshState(Context& context, std::vector<std::string>& extensions): currentVAO(0)
+MeshState::MeshState(Context& context, std::vector<const char*>& extensions): currentVAO(0), currentLayoutValid(false), drawCount(0)
     #ifndef MAGNUM_TARGET_GLES2
     , maxElementIndex{0}, maxElementsIndices{0}, maxElementsVertices{0}
     #endif
@@ -56,8 +57,10 @@ MeshState::MeshState(Context& context, std::vector<std::string>& extensions): cu
         createImplementation = &Mesh::createImplementationVAO;
         destroyImplementation = &Mesh::destroyImplementationVAO;
 
+        /* The fast-path probe might have found the VAO bind implementation
+           to be faster, see Implementation/fastPaths.cpp */
         #ifndef MAGNUM_TARGET_GLES
-        if(context.isExtensionSupported<Extensions::GL::EXT::direct_state_access>()) {
+        if(!(context.fastPaths() & FastPath::MeshBind) && context.isExtensionSupported<Extensions::GL::EXT::direct_state_access>()) {
             extensions.push_back(Extensions::GL::EXT::direct_state_access::string());
 
             attributePointerImplementation = &Mesh::attributePointerImplementationDSAEXT;
@@ -90,6 +93,15 @@ MeshState::MeshState(Context& context, std::vector<std::string>& extensions): cu
     }
     #endif
 
+    #ifndef MAGNUM_TARGET_GLES
+    /* Multi draw indirect implementation */
+    if(context.isExtensionSupported<Extensions::GL::ARB::multi_draw_indirect>()) {
+        extensions.push_back(Extensions::GL::ARB::multi_draw_indirect::string());
+
+        multiDrawIndirectImplementation = &Mesh::multiDrawIndirectImplementationDefault;
+    } else multiDrawIndirectImplementation = &Mesh::multiDrawIndirectImplementationFallback;
+    #endif
+
     #ifdef MAGNUM_TARGET_GLES
     #ifndef MAGNUM_TARGET_WEBGL
     /* Multi draw implementation on ES */
@@ -163,6 +175,22 @@ MeshState::MeshState(Context& context, std::vector<std::string>& extensions): cu
 
 void MeshState::reset() {
     currentVAO = State::DisengagedBinding;
+    currentLayoutValid = false;
+}
+
+void MeshState::removeBuffer(const GLuint id) {
+    for(std::size_t i = 0; i < currentLayout.size(); i += LayoutAttributeSize)
+        if(GLuint(currentLayout[i]) == id) currentLayoutValid = false;
+
+    for(auto it = sharedVertexArrays.begin(); it != sharedVertexArrays.end(); ) {
+        const std::vector<GLintptr>& key = it->first;
+        bool references = GLuint(key.back()) == id;
+        for(std::size_t i = 0; !references && i + 1 < key.size(); i += LayoutAttributeSize)
+            references = GLuint(key[i]) == id;
+
+        if(references) it = sharedVertexArrays.erase(it);
+        else ++it;
+    }
 }
 
 }}
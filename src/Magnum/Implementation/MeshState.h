@@ -25,18 +25,29 @@
     DEALINGS IN THE SOFTWARE.
 */
 
-#include <vector>
+#include <map>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "Magnum/Mesh.h"
 
 namespace Magnum { namespace Implementation {
 
 struct MeshState {
-    explicit MeshState(Context& context, std::vector<std::string>& extensions);
+    /* Count of values describing one attribute in layouts flattened by
+       Mesh::layoutInto(): buffer ID, location, size, type, kind, offset,
+       stride and divisor */
+    enum: std::size_t { LayoutAttributeSize = 8 };
+
+    explicit MeshState(Context& context, std::vector<const char*>& extensions);
 
     void reset();
 
+    /* Forgets cached layouts referencing given buffer, called on its
+       deletion because its ID may get reused */
+    void removeBuffer(GLuint id);
+
     void(Mesh::*createImplementation)();
     void(Mesh::*destroyImplementation)();
     void(Mesh::*attributePointerImplementation)(Mesh::AttributeLayout&);
@@ -53,10 +64,29 @@ struct MeshState {
     #endif
 
     #ifdef MAGNUM_TARGET_GLES
-    void(*multiDrawImplementation)(std::initializer_list<std::reference_wrapper<MeshView>>);
+    void(*multiDrawImplementation)(Containers::ArrayView<const std::reference_wrapper<MeshView>>);
+    #else
+    void(Mesh::*multiDrawIndirectImplementation)(GLintptr, GLsizei, GLsizei);
     #endif
 
     GLuint currentVAO;
+
+    /* Attribute layout last specified if VAOs are not available. Locations
+       of the attributes are kept even if it's invalidated so they can be
+       disabled on next draw. */
+    std::vector<GLintptr> currentLayout;
+    bool currentLayoutValid;
+
+    /* VAOs shared using Mesh::shareVertexArray(). The lookup is keyed by
+       flattened attribute layout with index buffer ID appended, reference
+       counts are kept separately so the lookup can be pruned on buffer
+       deletion without affecting meshes already using the VAO. */
+    std::map<std::vector<GLintptr>, GLuint> sharedVertexArrays;
+    std::unordered_map<GLuint, UnsignedInt> sharedVertexArrayReferences;
+
+    /* Count of draw calls submitted to GL */
+    UnsignedLong drawCount;
+
     #ifndef MAGNUM_TARGET_GLES2
     #ifndef MAGNUM_TARGET_WEBGL
     GLint64 maxElementIndex;
@@ -31,7 +31,7 @@
 
 namespace Magnum { namespace Implementation {
 
-QueryState::QueryState(Context& context, std::vector<std::string>& extensions) {
+QueryState::QueryState(Context& context, std::vector<const char*>& extensions) {
     /* Create implementation */
     #ifndef MAGNUM_TARGET_GLES
     if(context.isExtensionSupported<Extensions::GL::ARB::direct_state_access>()) {
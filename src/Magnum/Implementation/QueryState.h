@@ -44,7 +44,7 @@
 namespace Magnum { namespace Implementation {
 
 struct QueryState {
-    explicit QueryState(Context& context, std::vector<std::string>& extensions);
+    explicit QueryState(Context& context, std::vector<const char*>& extensions);
 
     void reset();
 
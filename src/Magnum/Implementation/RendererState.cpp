@@ -25,12 +25,14 @@
 
 #include "RendererState.h"
 
+#include <algorithm>
+
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
 
 namespace Magnum { namespace Implementation {
 
-RendererState::RendererState(Context& context, std::vector<std::string>& extensions)
+RendererState::RendererState(Context& context, std::vector<const char*>& extensions)
     #ifndef MAGNUM_TARGET_WEBGL
     : resetNotificationStrategy()
     #endif
@@ -83,6 +85,12 @@ RendererState::RendererState(Context& context, std::vector<std::string>& extensi
         packPixelStorage.disengagedRowLength = 0;
     #endif
     #endif
+
+    /* The state might have been modified before the context was created,
+       start with everything unknown */
+    shadow.issued = shadow.skipped = 0;
+    shadow.commandObserver = nullptr;
+    shadow.reset();
 }
 
 RendererState::PixelStorage::PixelStorage():
@@ -124,4 +132,69 @@ void RendererState::PixelStorage::reset() {
     #endif
 }
 
+void RendererState::Shadow::reset() {
+    features.clear();
+    hints.clear();
+
+    clearColor = std::nullopt;
+    clearDepth = std::nullopt;
+    clearStencil = std::nullopt;
+    frontFace = std::nullopt;
+    faceCullingMode = std::nullopt;
+    #ifndef MAGNUM_TARGET_GLES
+    provokingVertex = std::nullopt;
+    #endif
+    #ifndef MAGNUM_TARGET_WEBGL
+    polygonMode = std::nullopt;
+    #endif
+    polygonOffset = std::nullopt;
+    lineWidth = std::nullopt;
+    #ifndef MAGNUM_TARGET_GLES
+    pointSize = std::nullopt;
+    primitiveRestartIndex = std::nullopt;
+    #endif
+    scissor = std::nullopt;
+    for(StencilFace& face: stencil) {
+        face.function = std::nullopt;
+        face.operation = std::nullopt;
+        face.mask = std::nullopt;
+    }
+    depthFunction = std::nullopt;
+    colorMask = std::nullopt;
+    depthMask = std::nullopt;
+    blendEquation = std::nullopt;
+    blendFunction = std::nullopt;
+    blendColor = std::nullopt;
+    #ifndef MAGNUM_TARGET_GLES
+    logicOperation = std::nullopt;
+    #endif
+}
+
+namespace {
+    template<class T> bool updateSorted(std::vector<std::pair<GLenum, T>>& values, const GLenum key, const T value, UnsignedLong& issued, UnsignedLong& skipped, CommandObserver* const commandObserver) {
+        auto found = std::lower_bound(values.begin(), values.end(), key, [](const std::pair<GLenum, T>& a, GLenum b) { return a.first < b; });
+        if(found != values.end() && found->first == key) {
+            if(found->second == value) {
+                ++skipped;
+                if(commandObserver) commandObserver->record(CommandObserver::Command::RendererState, key, 0, true);
+                return false;
+            }
+
+            found->second = value;
+        } else values.insert(found, {key, value});
+
+        ++issued;
+        if(commandObserver) commandObserver->record(CommandObserver::Command::RendererState, key, 0, false);
+        return true;
+    }
+}
+
+bool RendererState::Shadow::updateFeature(const GLenum feature, const bool enabled) {
+    return updateSorted(features, feature, enabled, issued, skipped, commandObserver);
+}
+
+bool RendererState::Shadow::updateHint(const GLenum target, const GLenum mode) {
+    return updateSorted(hints, target, mode, issued, skipped, commandObserver);
+}
+
 }}
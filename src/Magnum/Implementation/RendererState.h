@@ -26,16 +26,20 @@
 */
 
 #include <string>
+#include <tuple>
 #include <vector>
 
+#include "Magnum/CommandObserver.h"
 #include "Magnum/Renderer.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/Math/Vector3.h"
 #include "MagnumExternal/Optional/optional.hpp"
 
 namespace Magnum { namespace Implementation {
 
 struct RendererState {
-    explicit RendererState(Context& context, std::vector<std::string>& extensions);
+    explicit RendererState(Context& context, std::vector<const char*>& extensions);
 
     void(*clearDepthfImplementation)(GLfloat);
     #ifndef MAGNUM_TARGET_WEBGL
@@ -73,6 +77,76 @@ struct RendererState {
     };
 
     PixelStorage packPixelStorage, unpackPixelStorage;
+
+    /* Shadowed renderer state. Values that are not set are unknown and the
+       next call always goes to GL. */
+    struct Shadow {
+        struct StencilFace {
+            std::optional<std::tuple<GLenum, Int, UnsignedInt>> function;
+            std::optional<std::tuple<GLenum, GLenum, GLenum>> operation;
+            std::optional<UnsignedInt> mask;
+        };
+
+        void reset();
+
+        /* Updates the shadowed value and returns true if it differs from the
+           new one and the GL call is needed */
+        template<class T> bool update(std::optional<T>& current, const T& value) {
+            if(current && *current == value) {
+                ++skipped;
+                if(commandObserver) commandObserver->record(CommandObserver::Command::RendererState, 0, 0, true);
+                return false;
+            }
+
+            current = value;
+            ++issued;
+            if(commandObserver) commandObserver->record(CommandObserver::Command::RendererState, 0, 0, false);
+            return true;
+        }
+
+        /* Feature and hint values are stored as sorted key/value pairs,
+           there's just a few of them used at once */
+        bool updateFeature(GLenum feature, bool enabled);
+        bool updateHint(GLenum target, GLenum mode);
+
+        std::vector<std::pair<GLenum, bool>> features;
+        std::vector<std::pair<GLenum, GLenum>> hints;
+
+        std::optional<Color4> clearColor;
+        std::optional<Double> clearDepth;
+        std::optional<Int> clearStencil;
+        std::optional<GLenum> frontFace,
+            faceCullingMode;
+        #ifndef MAGNUM_TARGET_GLES
+        std::optional<GLenum> provokingVertex;
+        #endif
+        #ifndef MAGNUM_TARGET_WEBGL
+        std::optional<GLenum> polygonMode;
+        #endif
+        std::optional<Vector2> polygonOffset;
+        std::optional<Float> lineWidth;
+        #ifndef MAGNUM_TARGET_GLES
+        std::optional<Float> pointSize;
+        std::optional<UnsignedInt> primitiveRestartIndex;
+        #endif
+        std::optional<Range2Di> scissor;
+        StencilFace stencil[2]; /* front, back */
+        std::optional<GLenum> depthFunction;
+        std::optional<Math::Vector4<GLboolean>> colorMask;
+        std::optional<GLboolean> depthMask;
+        std::optional<std::pair<GLenum, GLenum>> blendEquation;
+        std::optional<std::tuple<GLenum, GLenum, GLenum, GLenum>> blendFunction;
+        std::optional<Color4> blendColor;
+        #ifndef MAGNUM_TARGET_GLES
+        std::optional<GLenum> logicOperation;
+        #endif
+
+        UnsignedLong issued, skipped;
+
+        /* Copy of State::commandObserver, as the shadow is updated without
+           access to the rest of the state */
+        CommandObserver* commandObserver;
+    } shadow;
 };
 
 }}
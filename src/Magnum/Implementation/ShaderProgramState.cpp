@@ -25,6 +25,8 @@
 
 #include "ShaderProgramState.h"
 
+#include <cstring>
+
 #include "Magnum/AbstractShaderProgram.h"
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
@@ -33,7 +35,11 @@
 
 namespace Magnum { namespace Implementation {
 
-ShaderProgramState::ShaderProgramState(Context& context, std::vector<std::string>& extensions): current(0), maxVertexAttributes(0)
+ShaderProgramState::ShaderProgramState(Context& context, std::vector<const char*>& extensions): current(0), useCount(0),
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        binaryCache(nullptr),
+        #endif
+        maxVertexAttributes(0)
         #ifndef MAGNUM_TARGET_GLES2
         #ifndef MAGNUM_TARGET_WEBGL
         , maxAtomicCounterBufferSize(0), maxComputeSharedMemorySize(0), maxComputeWorkGroupInvocations(0), maxImageUnits(0), maxCombinedShaderOutputResources(0), maxUniformLocations(0)
@@ -227,4 +233,22 @@ void ShaderProgramState::reset() {
     current = State::DisengagedBinding;
 }
 
+bool UniformCache::update(const Int location, const void* const data, const std::size_t size) {
+    /* Uploads to location -1 are ignored by GL, don't cache them */
+    if(location < 0) return true;
+
+    if(std::size_t(location) >= values.size()) values.resize(location + 1);
+
+    Containers::Array<char>& value = values[location];
+    if(value.size() == size && std::memcmp(value, data, size) == 0) {
+        ++hits;
+        return false;
+    }
+
+    ++misses;
+    if(value.size() != size) value = Containers::Array<char>{size};
+    std::memcpy(value, data, size);
+    return true;
+}
+
 }}
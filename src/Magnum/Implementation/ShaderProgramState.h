@@ -27,6 +27,7 @@
 
 #include <string>
 #include <vector>
+#include <Corrade/Containers/Array.h>
 
 #include "Magnum/Magnum.h"
 #include "Magnum/OpenGL.h"
@@ -38,8 +39,22 @@
 
 namespace Magnum { namespace Implementation {
 
+/* Per-program cache of uploaded uniform values, used by
+   AbstractShaderProgram::setUniform() to skip the uniform*Implementation
+   dispatch if the value didn't change */
+struct UniformCache {
+    explicit UniformCache(): hits{}, misses{} {}
+
+    /* Returns false if the value is the same as the cached one, otherwise
+       updates the cache and returns true */
+    bool update(Int location, const void* data, std::size_t size);
+
+    std::vector<Containers::Array<char>> values;
+    UnsignedLong hits, misses;
+};
+
 struct ShaderProgramState {
-    explicit ShaderProgramState(Context& context, std::vector<std::string>& extensions);
+    explicit ShaderProgramState(Context& context, std::vector<const char*>& extensions);
 
     void reset();
 
@@ -91,8 +106,13 @@ struct ShaderProgramState {
     void(AbstractShaderProgram::*uniformMatrix4x3dvImplementation)(GLint, GLsizei, const Math::RectangularMatrix<4, 3, GLdouble>*);
     #endif
 
-    /* Currently used program */
+    /* Currently used program and count of program switches */
     GLuint current;
+    UnsignedLong useCount;
+
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    ShaderProgramBinaryCache* binaryCache;
+    #endif
 
     GLint maxVertexAttributes;
     #ifndef MAGNUM_TARGET_GLES2
@@ -26,6 +26,7 @@
 #include "State.h"
 
 #include <algorithm>
+#include <cstring>
 
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
@@ -35,6 +36,7 @@
 #include "DebugState.h"
 #endif
 #include "FramebufferState.h"
+#include "GpuMemoryState.h"
 #include "MeshState.h"
 #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
 #include "QueryState.h"
@@ -49,10 +51,11 @@
 
 namespace Magnum { namespace Implementation {
 
-State::State(Context& context, std::ostream* const out) {
+State::State(Context& context, std::ostream* const out): commandObserver{} {
     /* List of extensions used in current context. Guesstimate count to avoid
-       unnecessary reallocations. */
-    std::vector<std::string> extensions;
+       unnecessary reallocations. The strings are all global constants, so
+       there's no need to allocate copies of them. */
+    std::vector<const char*> extensions;
     #ifndef MAGNUM_TARGET_GLES
     extensions.reserve(32);
     #else
@@ -64,6 +67,7 @@ State::State(Context& context, std::ostream* const out) {
     debug.reset(new DebugState{context, extensions});
     #endif
     framebuffer.reset(new FramebufferState{context, extensions});
+    gpuMemory.reset(new GpuMemoryState);
     mesh.reset(new MeshState{context, extensions});
     #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
     query.reset(new QueryState{context, extensions});
@@ -77,8 +81,12 @@ State::State(Context& context, std::ostream* const out) {
     #endif
 
     /* Sort the features and remove duplicates */
-    std::sort(extensions.begin(), extensions.end());
-    extensions.erase(std::unique(extensions.begin(), extensions.end()), extensions.end());
+    std::sort(extensions.begin(), extensions.end(), [](const char* a, const char* b) {
+        return std::strcmp(a, b) < 0;
+    });
+    extensions.erase(std::unique(extensions.begin(), extensions.end(), [](const char* a, const char* b) {
+        return std::strcmp(a, b) == 0;
+    }), extensions.end());
 
     Debug{out} << "Using optional features:";
     for(const auto& ext: extensions) Debug(out) << "   " << ext;
@@ -34,12 +34,14 @@
 #endif
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
+#include "Magnum/TextureSet.h"
 
 #include "State.h"
+#include "fastPaths.h"
 
 namespace Magnum { namespace Implementation {
 
-TextureState::TextureState(Context& context, std::vector<std::string>& extensions): maxSize{},
+TextureState::TextureState(Context& context, std::vector<const char*>& extensions): maxSize{},
     #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
     max3DSize{},
     #endif
@@ -54,7 +56,7 @@ TextureState::TextureState(Context& context, std::vector<std::string>& extension
     #ifndef MAGNUM_TARGET_GLES2
     maxLodBias{0.0f},
     #endif
-    maxMaxAnisotropy(0.0f), currentTextureUnit(0)
+    maxMaxAnisotropy(0.0f), currentTextureUnit(0), bindCount(0)
     #ifndef MAGNUM_TARGET_GLES2
     , maxColorSamples(0), maxDepthSamples(0), maxIntegerSamples(0)
     #endif
@@ -74,9 +76,14 @@ TextureState::TextureState(Context& context, std::vector<std::string>& extension
         createImplementation = &AbstractTexture::createImplementationDefault;
     }
 
-    /* Single bind implementation */
+    /* Single bind implementation. The fast-path probe might have found the
+       classic bind to be faster, see Implementation/fastPaths.cpp */
     #ifndef MAGNUM_TARGET_GLES
-    if(context.isExtensionSupported<Extensions::GL::ARB::direct_state_access>()) {
+    if(context.fastPaths() & FastPath::TextureBind) {
+        unbindImplementation = &AbstractTexture::unbindImplementationDefault;
+        bindImplementation = &AbstractTexture::bindImplementationDefault;
+
+    } else if(context.isExtensionSupported<Extensions::GL::ARB::direct_state_access>()) {
         /* Extension name added below */
 
         unbindImplementation = &AbstractTexture::unbindImplementationDSA;
@@ -106,16 +113,23 @@ TextureState::TextureState(Context& context, std::vector<std::string>& extension
         extensions.push_back(Extensions::GL::ARB::multi_bind::string());
 
         bindMultiImplementation = &AbstractTexture::bindImplementationMulti;
+        bindTextureSetImplementation = &TextureSet::bindImplementationMulti;
+        bindSamplersImplementation = &Sampler::bindImplementationMulti;
 
     } else
     #endif
     {
         bindMultiImplementation = &AbstractTexture::bindImplementationFallback;
+        bindTextureSetImplementation = &TextureSet::bindImplementationFallback;
+        #ifndef MAGNUM_TARGET_GLES2
+        bindSamplersImplementation = &Sampler::bindImplementationFallback;
+        #endif
     }
 
-    /* DSA/non-DSA implementation */
+    /* DSA/non-DSA implementation, unless the fast-path probe found the bind
+       implementation to be faster */
     #ifndef MAGNUM_TARGET_GLES
-    if(context.isExtensionSupported<Extensions::GL::ARB::direct_state_access>()) {
+    if(!(context.fastPaths() & FastPath::TextureUploadBind) && context.isExtensionSupported<Extensions::GL::ARB::direct_state_access>()) {
         extensions.push_back(Extensions::GL::ARB::direct_state_access::string());
 
         parameteriImplementation = &AbstractTexture::parameterImplementationDSA;
@@ -139,8 +153,10 @@ TextureState::TextureState(Context& context, std::vector<std::string>& extension
         getCubeLevelParameterivImplementation = &CubeMapTexture::getLevelParameterImplementationDSA;
         cubeSubImageImplementation = &CubeMapTexture::subImageImplementationDSA;
         cubeCompressedSubImageImplementation = &CubeMapTexture::compressedSubImageImplementationDSA;
+        cubeSubImage3DImplementation = &CubeMapTexture::subImage3DImplementationDSA;
+        cubeCompressedSubImage3DImplementation = &CubeMapTexture::compressedSubImage3DImplementationDSA;
 
-    } else if(context.isExtensionSupported<Extensions::GL::EXT::direct_state_access>()) {
+    } else if(!(context.fastPaths() & FastPath::TextureUploadBind) && context.isExtensionSupported<Extensions::GL::EXT::direct_state_access>()) {
         extensions.push_back(Extensions::GL::EXT::direct_state_access::string());
 
         parameteriImplementation = &AbstractTexture::parameterImplementationDSAEXT;
@@ -164,6 +180,8 @@ TextureState::TextureState(Context& context, std::vector<std::string>& extension
         getCubeLevelParameterivImplementation = &CubeMapTexture::getLevelParameterImplementationDSAEXT;
         cubeSubImageImplementation = &CubeMapTexture::subImageImplementationDSAEXT;
         cubeCompressedSubImageImplementation = &CubeMapTexture::compressedSubImageImplementationDSAEXT;
+        cubeSubImage3DImplementation = &CubeMapTexture::subImage3DImplementationSliced;
+        cubeCompressedSubImage3DImplementation = &CubeMapTexture::compressedSubImage3DImplementationSliced;
 
     } else
     #endif
@@ -203,6 +221,8 @@ TextureState::TextureState(Context& context, std::vector<std::string>& extension
         #endif
         cubeSubImageImplementation = &CubeMapTexture::subImageImplementationDefault;
         cubeCompressedSubImageImplementation = &CubeMapTexture::compressedSubImageImplementationDefault;
+        cubeSubImage3DImplementation = &CubeMapTexture::subImage3DImplementationSliced;
+        cubeCompressedSubImage3DImplementation = &CubeMapTexture::compressedSubImage3DImplementationSliced;
     }
 
     /* Data invalidation implementation */
@@ -388,6 +408,9 @@ TextureState::TextureState(Context& context, std::vector<std::string>& extension
     glGetIntegerv(GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS, &maxTextureUnits);
     CORRADE_INTERNAL_ASSERT(maxTextureUnits > 0);
     bindings = Containers::Array<std::pair<GLenum, GLuint>>{Containers::ValueInit, std::size_t(maxTextureUnits)};
+    #ifndef MAGNUM_TARGET_GLES2
+    samplerBindings = Containers::Array<GLuint>{Containers::ValueInit, std::size_t(maxTextureUnits)};
+    #endif
 
     #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
     /* Allocate image bindings array to hold all possible image units */
@@ -408,6 +431,9 @@ TextureState::~TextureState() = default;
 
 void TextureState::reset() {
     std::fill_n(bindings.begin(), bindings.size(), std::pair<GLenum, GLuint>{{}, State::DisengagedBinding});
+    #ifndef MAGNUM_TARGET_GLES2
+    std::fill_n(samplerBindings.begin(), samplerBindings.size(), State::DisengagedBinding);
+    #endif
     #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
     std::fill_n(imageBindings.begin(), imageBindings.size(), std::tuple<GLuint, GLint, GLboolean, GLint, GLenum>{State::DisengagedBinding, 0, false, 0, 0});
     #endif
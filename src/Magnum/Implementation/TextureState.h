@@ -43,7 +43,7 @@
 namespace Magnum { namespace Implementation {
 
 struct TextureState {
-    explicit TextureState(Context& context, std::vector<std::string>& extensions);
+    explicit TextureState(Context& context, std::vector<const char*>& extensions);
     ~TextureState();
 
     void reset();
@@ -51,6 +51,10 @@ struct TextureState {
     Int(*compressedBlockDataSizeImplementation)(GLenum, TextureFormat);
     void(*unbindImplementation)(GLint);
     void(*bindMultiImplementation)(GLint, Containers::ArrayView<AbstractTexture* const>);
+    void(*bindTextureSetImplementation)(TextureSet&);
+    #ifndef MAGNUM_TARGET_GLES2
+    void(*bindSamplersImplementation)(GLint, Containers::ArrayView<const GLuint>);
+    #endif
     void(AbstractTexture::*createImplementation)();
     void(AbstractTexture::*bindImplementation)(GLint);
     void(AbstractTexture::*parameteriImplementation)(GLenum, GLint);
@@ -112,6 +116,8 @@ struct TextureState {
     #endif
     void(CubeMapTexture::*cubeSubImageImplementation)(CubeMapCoordinate, GLint, const Vector2i&, const Vector2i&, PixelFormat, PixelType, const GLvoid*);
     void(CubeMapTexture::*cubeCompressedSubImageImplementation)(CubeMapCoordinate, GLint, const Vector2i&, const Vector2i&, CompressedPixelFormat, const GLvoid*, GLsizei);
+    void(CubeMapTexture::*cubeSubImage3DImplementation)(GLint, const Vector3i&, const Vector3i&, PixelFormat, PixelType, const GLvoid*, const PixelStorage&);
+    void(CubeMapTexture::*cubeCompressedSubImage3DImplementation)(GLint, const Vector3i&, const Vector3i&, CompressedPixelFormat, const GLvoid*, GLsizei);
 
     GLint maxSize,
         #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
@@ -133,6 +139,8 @@ struct TextureState {
     #endif
     GLfloat maxMaxAnisotropy;
     GLint currentTextureUnit;
+    /* Count of texture binds submitted to GL */
+    UnsignedLong bindCount;
     #ifndef MAGNUM_TARGET_GLES2
     GLint maxColorSamples,
         maxDepthSamples,
@@ -143,6 +151,9 @@ struct TextureState {
     #endif
 
     Containers::Array<std::pair<GLenum, GLuint>> bindings;
+    #ifndef MAGNUM_TARGET_GLES2
+    Containers::Array<GLuint> samplerBindings;
+    #endif
     #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
     /* Texture object ID, level, layered, layer, access */
     Containers::Array<std::tuple<GLuint, GLint, GLboolean, GLint, GLenum>> imageBindings;
@@ -45,7 +45,7 @@
 namespace Magnum { namespace Implementation {
 
 struct TransformFeedbackState {
-    explicit TransformFeedbackState(Context& context, std::vector<std::string>& extensions);
+    explicit TransformFeedbackState(Context& context, std::vector<const char*>& extensions);
 
     void reset();
 
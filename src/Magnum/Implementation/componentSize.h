@@ -0,0 +1,47 @@
+#ifndef Magnum_Implementation_componentSize_h
+#define Magnum_Implementation_componentSize_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+
+#include "Magnum/PixelFormat.h"
+
+namespace Magnum { namespace Implementation {
+
+/* Size of a single channel of given pixel type, zero for packed and other
+   types that aren't handled by the CPU-side conversion routines */
+inline std::size_t componentSize(const PixelType type) {
+    switch(type) {
+        case PixelType::UnsignedByte: return 1;
+        case PixelType::UnsignedShort: return 2;
+        case PixelType::Float: return 4;
+        default: return 0;
+    }
+}
+
+}}
+
+#endif
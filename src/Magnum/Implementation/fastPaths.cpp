@@ -0,0 +1,286 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Context.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <vector>
+#include <Corrade/Utility/Configuration.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Extensions.h"
+#include "Magnum/Implementation/fastPaths.h"
+
+#ifndef MAGNUM_TARGET_GLES
+namespace Magnum {
+
+namespace {
+    /* Increase when the probe changes in a way that makes previous results
+       invalid */
+    constexpr UnsignedInt FastPathCacheVersion = 1;
+
+    /* Names used in the cache file and in the initialization log, in order
+       of Implementation::FastPath bits */
+    constexpr std::size_t FastPathCount = 5;
+    constexpr const char* FastPathNames[FastPathCount]{
+        "buffer-bind",
+        "buffer-map-range",
+        "texture-bind",
+        "texture-upload-bind",
+        "mesh-bind"
+    };
+}
+
+namespace Implementation {
+
+bool isFastPathFaster(const UnsignedLong currentTime, const UnsignedLong alternativeTime) {
+    return alternativeTime*10 < currentTime*9;
+}
+
+bool fastPathsFromCache(Utility::ConfigurationGroup& cache, const std::string& renderer, const std::string& vendor, const std::string& version, FastPaths& paths) {
+    if(cache.value<UnsignedInt>("version") != FastPathCacheVersion) {
+        cache.clear();
+        cache.setValue("version", FastPathCacheVersion);
+        return false;
+    }
+
+    for(const Utility::ConfigurationGroup* const driver: cache.groups("driver")) {
+        if(driver->value("renderer") != renderer || driver->value("vendor") != vendor || driver->value("version") != version)
+            continue;
+
+        /* Names of paths removed in newer versions are ignored */
+        paths = {};
+        for(const std::string& name: driver->values("fastPath")) {
+            const auto it = std::find_if(FastPathNames, FastPathNames + FastPathCount, [&name](const char* n) { return name == n; });
+            if(it == FastPathNames + FastPathCount) continue;
+            paths |= FastPath(1 << (it - FastPathNames));
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+void fastPathsToCache(Utility::ConfigurationGroup& cache, const std::string& renderer, const std::string& vendor, const std::string& version, const FastPaths paths) {
+    Utility::ConfigurationGroup* const driver = cache.addGroup("driver");
+    driver->setValue("renderer", renderer);
+    driver->setValue("vendor", vendor);
+    driver->setValue("version", version);
+    for(std::size_t i = 0; i != FastPathCount; ++i)
+        if(paths & FastPath(1 << i))
+            driver->addValue("fastPath", FastPathNames[i]);
+}
+
+}
+
+namespace {
+
+    constexpr GLsizeiptr BufferSize = 64*1024;
+    constexpr GLsizei TextureSize = 64;
+    constexpr Int Rounds = 3;
+
+    template<class F> UnsignedLong measure(const Int iterations, F f) {
+        glFinish();
+        const auto start = std::chrono::steady_clock::now();
+        for(Int i = 0; i != iterations; ++i) f(i);
+        glFinish();
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    /* Whether the alternative is faster than the implementation that'd be
+       picked by default. Both are measured a few times interleaved and the
+       best time is taken to filter out noise. */
+    template<class F, class G> bool isFaster(const Int iterations, F current, G alternative) {
+        /* Warm-up */
+        current(0);
+        alternative(0);
+
+        UnsignedLong currentTime = ~UnsignedLong{}, alternativeTime = ~UnsignedLong{};
+        for(Int round = 0; round != Rounds; ++round) {
+            currentTime = std::min(currentTime, measure(iterations, current));
+            alternativeTime = std::min(alternativeTime, measure(iterations, alternative));
+        }
+
+        return Implementation::isFastPathFaster(currentTime, alternativeTime);
+    }
+
+    /* Raw GL calls are used, as the state tracker doesn't exist yet. The
+       default implementation in each test is the same one the corresponding
+       state tracker would pick based on extension presence. */
+    Implementation::FastPaths probeFastPaths(Context& context) {
+        using Implementation::FastPath;
+
+        Implementation::FastPaths paths;
+        const bool arbDsa = context.isExtensionSupported<Extensions::GL::ARB::direct_state_access>();
+        const bool extDsa = context.isExtensionSupported<Extensions::GL::EXT::direct_state_access>();
+        const std::vector<char> data(BufferSize);
+
+        /* Buffer uploads, alternating between two buffers so the bind
+           implementation has to rebind every time */
+        {
+            GLuint buffers[2];
+            glGenBuffers(2, buffers);
+            for(const GLuint buffer: buffers) {
+                glBindBuffer(GL_ARRAY_BUFFER, buffer);
+                glBufferData(GL_ARRAY_BUFFER, BufferSize, nullptr, GL_DYNAMIC_DRAW);
+            }
+
+            const auto subDataBind = [&](const Int i) {
+                glBindBuffer(GL_ARRAY_BUFFER, buffers[i & 1]);
+                glBufferSubData(GL_ARRAY_BUFFER, 0, BufferSize, data.data());
+            };
+
+            if(arbDsa || extDsa) {
+                const auto subDataDsa = [&](const Int i) {
+                    if(arbDsa) glNamedBufferSubData(buffers[i & 1], 0, BufferSize, data.data());
+                    else glNamedBufferSubDataEXT(buffers[i & 1], 0, BufferSize, data.data());
+                };
+                if(isFaster(16, subDataDsa, subDataBind))
+                    paths |= FastPath::BufferBind;
+            }
+
+            if(context.isExtensionSupported<Extensions::GL::ARB::map_buffer_range>()) {
+                const auto subDataMapRange = [&](const Int i) {
+                    glBindBuffer(GL_ARRAY_BUFFER, buffers[i & 1]);
+                    void* const mapped = glMapBufferRange(GL_ARRAY_BUFFER, 0, BufferSize, GL_MAP_WRITE_BIT|GL_MAP_INVALIDATE_RANGE_BIT);
+                    if(mapped) std::memcpy(mapped, data.data(), BufferSize);
+                    glUnmapBuffer(GL_ARRAY_BUFFER);
+                };
+                if(isFaster(16, subDataBind, subDataMapRange))
+                    paths |= FastPath::BufferMapRange;
+            }
+
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            glDeleteBuffers(2, buffers);
+        }
+
+        /* Texture binds and uploads, cycling through four textures and four
+           texture units so no bind is redundant */
+        {
+            GLuint textures[4];
+            glGenTextures(4, textures);
+            for(const GLuint texture: textures) {
+                glBindTexture(GL_TEXTURE_2D, texture);
+                glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, TextureSize, TextureSize, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+            }
+
+            const bool multiBind = context.isExtensionSupported<Extensions::GL::ARB::multi_bind>();
+            if(arbDsa || multiBind || extDsa) {
+                const auto bindDefault = [&](const Int i) {
+                    glActiveTexture(GL_TEXTURE0 + (i & 3));
+                    glBindTexture(GL_TEXTURE_2D, textures[(i >> 2) & 3]);
+                };
+                const auto bindDsa = [&](const Int i) {
+                    const GLuint unit = i & 3;
+                    const GLuint texture = textures[(i >> 2) & 3];
+                    if(arbDsa) glBindTextureUnit(unit, texture);
+                    else if(multiBind) glBindTextures(unit, 1, &texture);
+                    else glBindMultiTextureEXT(GL_TEXTURE0 + unit, GL_TEXTURE_2D, texture);
+                };
+                if(isFaster(256, bindDsa, bindDefault))
+                    paths |= FastPath::TextureBind;
+            }
+
+            if(arbDsa || extDsa) {
+                const auto uploadBind = [&](const Int i) {
+                    glBindTexture(GL_TEXTURE_2D, textures[i & 3]);
+                    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, TextureSize, TextureSize, GL_RGBA, GL_UNSIGNED_BYTE, data.data());
+                };
+                const auto uploadDsa = [&](const Int i) {
+                    if(arbDsa) glTextureSubImage2D(textures[i & 3], 0, 0, 0, TextureSize, TextureSize, GL_RGBA, GL_UNSIGNED_BYTE, data.data());
+                    else glTextureSubImage2DEXT(textures[i & 3], GL_TEXTURE_2D, 0, 0, 0, TextureSize, TextureSize, GL_RGBA, GL_UNSIGNED_BYTE, data.data());
+                };
+                if(isFaster(16, uploadDsa, uploadBind))
+                    paths |= FastPath::TextureUploadBind;
+            }
+
+            /* Deleting the textures unbinds them from all units, the state
+               tracker expects the first unit to be active */
+            glDeleteTextures(4, textures);
+            glActiveTexture(GL_TEXTURE0);
+        }
+
+        /* Vertex attribute setup, alternating between two VAOs */
+        if(extDsa && context.isExtensionSupported<Extensions::GL::ARB::vertex_array_object>()) {
+            GLuint buffer;
+            glGenBuffers(1, &buffer);
+            glBindBuffer(GL_ARRAY_BUFFER, buffer);
+            glBufferData(GL_ARRAY_BUFFER, 256, nullptr, GL_STATIC_DRAW);
+
+            GLuint vaos[2];
+            glGenVertexArrays(2, vaos);
+            for(const GLuint vao: vaos) glBindVertexArray(vao);
+
+            const auto attributeDsa = [&](const Int i) {
+                glVertexArrayVertexAttribOffsetEXT(vaos[i & 1], buffer, i & 7, 4, GL_FLOAT, GL_FALSE, 0, (i & 15)*16);
+            };
+            const auto attributeBind = [&](const Int i) {
+                glBindVertexArray(vaos[i & 1]);
+                glBindBuffer(GL_ARRAY_BUFFER, buffer);
+                glVertexAttribPointer(i & 7, 4, GL_FLOAT, GL_FALSE, 0, reinterpret_cast<GLvoid*>(GLintptr((i & 15)*16)));
+            };
+            if(isFaster(256, attributeDsa, attributeBind))
+                paths |= FastPath::MeshBind;
+
+            glBindVertexArray(0);
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            glDeleteVertexArrays(2, vaos);
+            glDeleteBuffers(1, &buffer);
+        }
+
+        return paths;
+    }
+}
+
+void Context::setupFastPaths(std::ostream* const output) {
+    const std::string renderer = rendererString();
+    const std::string vendor = vendorString();
+    const std::string version = versionString();
+
+    /* Look for a cached result for this driver, run the probe and save the
+       result on a miss. Cache written by a different version of the probe is
+       discarded. */
+    Utility::Configuration cache{_fastPathCache};
+    if(!Implementation::fastPathsFromCache(cache, renderer, vendor, version, _fastPaths)) {
+        _fastPaths = probeFastPaths(*this);
+        Implementation::fastPathsToCache(cache, renderer, vendor, version, _fastPaths);
+
+        if(!cache.save())
+            Warning() << "Context: cannot save fast path cache to" << _fastPathCache;
+    }
+
+    if(_fastPaths) {
+        Debug{output} << "Using probed fast paths:";
+        for(std::size_t i = 0; i != FastPathCount; ++i)
+            if(_fastPaths & Implementation::FastPath(1 << i))
+                Debug{output} << "   " << FastPathNames[i];
+    }
+}
+
+}
+#endif
@@ -0,0 +1,73 @@
+#ifndef Magnum_Implementation_fastPaths_h
+#define Magnum_Implementation_fastPaths_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Context.h"
+
+namespace Magnum { namespace Implementation {
+
+/* Implementations selected by the startup probe (see fastPaths.cpp) instead
+   of the ones the state trackers would pick based on extension presence
+   alone. Empty set means no override. The enum and the FastPaths set are
+   forward-declared in Context.h. */
+enum class FastPath: UnsignedByte {
+    /* Buffer data upload and mapping using bind instead of DSA */
+    BufferBind = 1 << 0,
+
+    /* Buffer sub-data upload through glMapBufferRange() instead of
+       glBufferSubData() */
+    BufferMapRange = 1 << 1,
+
+    /* Single texture bind using glActiveTexture() and glBindTexture()
+       instead of DSA or multi bind */
+    TextureBind = 1 << 2,
+
+    /* Texture image upload and parameters using bind instead of DSA */
+    TextureUploadBind = 1 << 3,
+
+    /* Mesh attribute setup using VAO bind instead of EXT_direct_state_access */
+    MeshBind = 1 << 4
+};
+
+CORRADE_ENUMSET_OPERATORS(FastPaths)
+
+#ifndef MAGNUM_TARGET_GLES
+/* Whether the alternative implementation is faster by enough to be selected.
+   Requires at least 10% improvement so the selection doesn't flip back and
+   forth on drivers where both are equally fast. */
+MAGNUM_EXPORT bool isFastPathFaster(UnsignedLong currentTime, UnsignedLong alternativeTime);
+
+/* Looks up probe result for given driver in the cache. Returns false if it's
+   not there. Cache written by a different version of the probe is cleared. */
+MAGNUM_EXPORT bool fastPathsFromCache(Utility::ConfigurationGroup& cache, const std::string& renderer, const std::string& vendor, const std::string& version, FastPaths& paths);
+
+/* Adds probe result for given driver to the cache */
+MAGNUM_EXPORT void fastPathsToCache(Utility::ConfigurationGroup& cache, const std::string& renderer, const std::string& vendor, const std::string& version, FastPaths paths);
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef Magnum_Implementation_parallelFor_h
+#define Magnum_Implementation_parallelFor_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Functions.h"
+
+#if !defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(CORRADE_TARGET_NACL)
+#include "Magnum/TaskScheduler.h"
+#endif
+
+namespace Magnum { namespace Implementation {
+
+/* Calls given function on consecutive ranges of the [0, count) interval.
+   Ranges have at least grainSize items and there's at most threadCount of
+   them, which are executed on the global task scheduler so this doesn't
+   oversubscribe the machine when called from multiple places at once. On
+   platforms without threads the whole range is processed at once. */
+template<class F> void parallelFor(const std::size_t count, const UnsignedInt threadCount, const std::size_t grainSize, const F& function) {
+    #if !defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(CORRADE_TARGET_NACL)
+    if(threadCount > 1) {
+        TaskScheduler::global().parallelFor(count, Math::max(grainSize, (count + threadCount - 1)/threadCount), function);
+        return;
+    }
+    #else
+    static_cast<void>(threadCount);
+    static_cast<void>(grainSize);
+    #endif
+
+    if(count) function(0, count);
+}
+
+}}
+
+#endif
@@ -99,6 +99,20 @@ Magnum contexts. Enabled by default.
 #define MAGNUM_BUILD_MULTITHREADED
 #undef MAGNUM_BUILD_MULTITHREADED
 
+/**
+@brief SIMD build
+
+Defined if the library is built with SSE2 / NEON implementation of
+@ref Math::Vector4 dot product, @ref Math::Matrix4 multiplication,
+transposition and rigid inversion and @ref Math::Quaternion multiplication
+for @ref Magnum::Float "Float" types. The instruction set needs to be enabled
+in compiler flags as well, otherwise the generic implementation is used.
+Disabled by default.
+@see @ref building, @ref cmake
+*/
+#define MAGNUM_BUILD_SIMD
+#undef MAGNUM_BUILD_SIMD
+
 /**
 @brief OpenGL ES target
 
@@ -353,6 +367,9 @@ typedef Math::Range2D<Int> Range2Di;
 /** @brief Signed integer 3D range */
 typedef Math::Range3D<Int> Range3Di;
 
+/** @brief Float frustum */
+typedef Math::Frustum<Float> Frustum;
+
 /*@}*/
 
 /** @{ @name Double-precision types
@@ -465,6 +482,9 @@ typedef Math::Range2D<Double> Range2Dd;
 /** @brief Double 3D range */
 typedef Math::Range3D<Double> Range3Dd;
 
+/** @brief Double frustum */
+typedef Math::Frustum<Double> Frustumd;
+
 /*@}*/
 
 #ifdef MAGNUM_BUILD_DEPRECATED
@@ -485,6 +505,10 @@ class AbstractQuery;
 class AbstractShaderProgram;
 class AbstractTexture;
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+class AppendBuffer;
+#endif
+
 template<UnsignedInt, class T> class Array;
 template<class T> class Array1D;
 template<class T> class Array2D;
@@ -492,9 +516,18 @@ template<class T> class Array3D;
 
 template<UnsignedInt, class> class Attribute;
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+class AtomicCounterBuffer;
+#endif
+
 enum class BufferUsage: GLenum;
 class Buffer;
 
+#ifndef MAGNUM_TARGET_WEBGL
+class BufferRing;
+#endif
+class BufferUploadQueue;
+
 #ifndef MAGNUM_TARGET_GLES2
 template<UnsignedInt> class BufferImage;
 typedef BufferImage<1> BufferImage1D;
@@ -517,7 +550,9 @@ template<class T> using BasicColor3 CORRADE_DEPRECATED_ALIAS("use Math::Color3 i
 template<class T> using BasicColor4 CORRADE_DEPRECATED_ALIAS("use Math::Color4 instead") = Math::Color4<T>;
 #endif
 
+class CommandObserver;
 class Context;
+class ContextRestorer;
 
 class CubeMapTexture;
 enum class CubeMapCoordinate: GLenum;
@@ -526,11 +561,17 @@ class CubeMapTextureArray;
 #endif
 
 /* DebugOutput, DebugMessage, DebugGroup used only statically */
+#ifndef MAGNUM_TARGET_WEBGL
+class DebugOutputQueue;
+#endif
 /* DefaultFramebuffer is available only through global instance */
 /* DimensionTraits forward declaration is not needed */
 
 class Extension;
+class FixedTimestep;
+class FrameAllocator;
 class Framebuffer;
+class GpuMemory;
 
 #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
 enum class ImageFormat: GLenum;
@@ -564,9 +605,19 @@ typedef CompressedImageView<1> CompressedImageView1D;
 typedef CompressedImageView<2> CompressedImageView2D;
 typedef CompressedImageView<3> CompressedImageView3D;
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+template<UnsignedInt> class ImageReadbackQueue;
+#ifndef MAGNUM_TARGET_GLES
+typedef ImageReadbackQueue<1> ImageReadbackQueue1D;
+#endif
+typedef ImageReadbackQueue<2> ImageReadbackQueue2D;
+typedef ImageReadbackQueue<3> ImageReadbackQueue3D;
+#endif
+
 enum class MeshPrimitive: GLenum;
 
 class Mesh;
+class MeshArena;
 class MeshView;
 
 #ifndef MAGNUM_TARGET_GLES2
@@ -592,15 +643,22 @@ class CompressedPixelStorage;
 
 /* ObjectFlag, ObjectFlags are used only in conjunction with *::wrap() function */
 
+class PointCloudStreamer;
 class PrimitiveQuery;
+template<class> class QueryPool;
 class SampleQuery;
 class TimeQuery;
 
+class RangeAllocator;
 class RectangleTexture;
 
 class Renderbuffer;
 enum class RenderbufferFormat: GLenum;
 
+class RenderGraph;
+class RenderState;
+class RenderTargetPool;
+
 enum class ResourceState: UnsignedByte;
 enum class ResourceDataState: UnsignedByte;
 enum class ResourcePolicy: UnsignedByte;
@@ -609,7 +667,23 @@ class ResourceKey;
 template<class...> class ResourceManager;
 
 class Sampler;
+#ifndef MAGNUM_TARGET_GLES2
+class SamplerRegistry;
+#endif
 class Shader;
+class ShaderSourceCache;
+
+#if !defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(CORRADE_TARGET_NACL)
+class TaskScheduler;
+#endif
+
+#ifndef MAGNUM_TARGET_GLES
+class SparseTexturePageTable;
+#endif
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+class ShaderProgramBinaryCache;
+#endif
 
 template<UnsignedInt> class Texture;
 #ifndef MAGNUM_TARGET_GLES
@@ -628,9 +702,34 @@ typedef TextureArray<2> Texture2DArray;
 
 enum class TextureFormat: GLenum;
 
+#ifndef MAGNUM_TARGET_GLES
+class TextureHandle;
+#endif
+
+class TextureSet;
+
+#ifndef MAGNUM_TARGET_GLES2
+class TextureStreamer;
+
+template<UnsignedInt> class TextureUploadQueue;
+#ifndef MAGNUM_TARGET_GLES
+typedef TextureUploadQueue<1> TextureUploadQueue1D;
+#endif
+typedef TextureUploadQueue<2> TextureUploadQueue2D;
+typedef TextureUploadQueue<3> TextureUploadQueue3D;
+#endif
+
 class TransformFeedback;
+#ifndef MAGNUM_TARGET_GLES2
+class TransformFeedbackCache;
+#endif
 class Timeline;
 
+#ifndef MAGNUM_TARGET_GLES2
+template<class...> class UniformBlock;
+template<class> class UniformBlockBuffer;
+#endif
+
 enum class Version: Int;
 #endif
 
@@ -0,0 +1,204 @@
+#ifndef Magnum_Math_Algorithms_Svd3x3_h
+#define Magnum_Math_Algorithms_Svd3x3_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Math::Algorithms::svd3x3(), @ref Magnum::Math::Algorithms::polarDecomposition()
+ */
+
+#include <limits>
+#include <tuple>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Math { namespace Algorithms {
+
+namespace Implementation {
+
+/* One-sided Jacobi rotation of columns p and q of b making them orthogonal,
+   accumulated into v. Returns false if they were orthogonal already. */
+template<class T> bool jacobiRotate(Matrix3x3<T>& b, Matrix3x3<T>& v, const std::size_t p, const std::size_t q) {
+    const T alpha = b[p].dot();
+    const T beta = b[q].dot();
+    const T gamma = Math::dot(b[p], b[q]);
+    if(std::abs(gamma) <= std::numeric_limits<T>::epsilon()*std::sqrt(alpha*beta))
+        return false;
+
+    const T zeta = (beta - alpha)/(T(2)*gamma);
+    const T t = (zeta < T(0) ? T(-1) : T(1))/(std::abs(zeta) + std::sqrt(zeta*zeta + T(1)));
+    const T c = T(1)/std::sqrt(t*t + T(1));
+    const T s = t*c;
+
+    const Vector<3, T> bp = b[p];
+    b[p] = bp*c - b[q]*s;
+    b[q] = bp*s + b[q]*c;
+
+    const Vector<3, T> vp = v[p];
+    v[p] = vp*c - v[q]*s;
+    v[q] = vp*s + v[q]*c;
+    return true;
+}
+
+template<class T> std::tuple<Matrix3x3<T>, Vector3<T>, Matrix3x3<T>> svd3x3(const Matrix3x3<T>& m) {
+    constexpr std::size_t MaxSweeps = 16;
+
+    /* Rotate columns of M until they are orthogonal, then M V = U Sigma.
+       Working on M directly instead of the eigenvalue problem of MᵀM keeps
+       full precision of small singular values. */
+    Matrix3x3<T> b = m;
+    Matrix3x3<T> v{IdentityInit};
+    for(std::size_t sweep = 0; sweep != MaxSweeps; ++sweep) {
+        bool rotated = jacobiRotate(b, v, 0, 1);
+        rotated = jacobiRotate(b, v, 0, 2) || rotated;
+        rotated = jacobiRotate(b, v, 1, 2) || rotated;
+        if(!rotated) break;
+    }
+
+    /* Sort the columns by decreasing length */
+    Vector3<T> w{b[0].length(), b[1].length(), b[2].length()};
+    for(std::size_t i = 0; i != 2; ++i)
+        for(std::size_t j = 2; j != i; --j) if(w[j] > w[j - 1]) {
+            std::swap(w[j], w[j - 1]);
+            std::swap(b[j], b[j - 1]);
+            std::swap(v[j], v[j - 1]);
+        }
+
+    /* Normalize the columns to get U, completing it to an orthogonal basis
+       if the matrix is singular */
+    const T tolerance = std::numeric_limits<T>::epsilon()*T(16)*w[0];
+    Matrix3x3<T> u{NoInit};
+    if(w[0] <= tolerance)
+        return std::make_tuple(Matrix3x3<T>{IdentityInit}, Vector3<T>{}, v);
+    u[0] = b[0]/w[0];
+
+    if(w[1] <= tolerance) {
+        /* Any vector perpendicular to the first column, derived from the
+           axis it is least aligned with */
+        const Vector3<T> u0{u[0]};
+        const Vector3<T> axis = std::abs(u0.x()) < std::abs(u0.y()) ?
+            (std::abs(u0.x()) < std::abs(u0.z()) ? Vector3<T>::xAxis() : Vector3<T>::zAxis()) :
+            (std::abs(u0.y()) < std::abs(u0.z()) ? Vector3<T>::yAxis() : Vector3<T>::zAxis());
+        u[1] = Math::cross(u0, axis).normalized();
+        u[2] = Math::cross(u0, Vector3<T>{u[1]});
+
+        /* Rank one, the remaining column is zero as well */
+        w[1] = w[2] = T(0);
+        return std::make_tuple(u, w, v);
+    }
+    u[1] = b[1]/w[1];
+
+    /* The last column is calculated with a cross product so U is orthogonal
+       even if the last singular value is zero */
+    u[2] = Math::cross(Vector3<T>{u[0]}, Vector3<T>{u[1]});
+    w[2] = Math::dot(u[2], b[2]);
+    if(w[2] < T(0)) {
+        u[2] = -u[2];
+        w[2] = -w[2];
+    }
+
+    return std::make_tuple(u, w, v);
+}
+
+}
+
+/**
+@brief Singular Value Decomposition of a 3x3 matrix
+
+Specialized version of @ref svd() for 3x3 matrices, returning @f$ U @f$,
+diagonal of @f$ \Sigma @f$ and non-transposed @f$ V @f$ such that
+@f[
+    M = U \Sigma V^T
+@f]
+Unlike @ref svd(), the singular values are sorted in decreasing order and
+both @f$ U @f$ and @f$ V @f$ are always orthogonal, even for singular
+matrices. Calculated using one-sided Jacobi rotations, which orthogonalize columns of
+@f$ M V @f$, @f$ U @f$ and @f$ \Sigma @f$ are then the normalized columns
+and their lengths. It needs only a few sweeps over three column pairs and has
+no dynamic loop bounds, which makes it significantly faster than the generic
+version.
+@see @ref polarDecomposition()
+*/
+template<class T> inline std::tuple<Matrix3x3<T>, Vector3<T>, Matrix3x3<T>> svd3x3(const Matrix3x3<T>& m) {
+    return Implementation::svd3x3(m);
+}
+
+/**
+@brief Polar decomposition of a 3x3 matrix
+
+Returns orthogonal matrix @f$ Q @f$ and symmetric positive-semidefinite
+matrix @f$ P @f$ such that @f[
+    M = Q P
+@f]
+@f$ Q @f$ is the orthogonal matrix closest to @f$ M @f$, useful for example
+for extracting rotation from a matrix containing scaling and shear. For
+matrices with negative determinant @f$ Q @f$ contains a reflection. Calculated
+from @ref svd3x3() as @f$ Q = U V^T @f$ and @f$ P = V \Sigma V^T @f$.
+*/
+template<class T> std::tuple<Matrix3x3<T>, Matrix3x3<T>> polarDecomposition(const Matrix3x3<T>& m) {
+    Matrix3x3<T> u{NoInit};
+    Vector3<T> w{NoInit};
+    Matrix3x3<T> v{NoInit};
+    std::tie(u, w, v) = Implementation::svd3x3(m);
+    return std::make_tuple(u*v.transposed(), v*Matrix3x3<T>::fromDiagonal(w)*v.transposed());
+}
+
+/**
+@brief Singular Value Decomposition of an array of 3x3 matrices
+
+Calls @ref svd3x3(const Matrix3x3<T>&) on each item of @p matrices and saves
+the results into @p u, @p w and @p v. Expects that all views have the same
+size.
+*/
+template<class T> void svd3x3(const Corrade::Containers::ArrayView<const Matrix3x3<T>> matrices, const Corrade::Containers::ArrayView<Matrix3x3<T>> u, const Corrade::Containers::ArrayView<Vector3<T>> w, const Corrade::Containers::ArrayView<Matrix3x3<T>> v) {
+    CORRADE_ASSERT(u.size() == matrices.size() && w.size() == matrices.size() && v.size() == matrices.size(),
+        "Math::Algorithms::svd3x3(): expected views of the same size", );
+
+    for(std::size_t i = 0; i != matrices.size(); ++i)
+        std::tie(u[i], w[i], v[i]) = Implementation::svd3x3(matrices[i]);
+}
+
+/**
+@brief Polar decomposition of an array of 3x3 matrices
+
+Calls @ref polarDecomposition(const Matrix3x3<T>&) on each item of
+@p matrices and saves the results into @p q and @p p. Expects that all views
+have the same size.
+*/
+template<class T> void polarDecomposition(const Corrade::Containers::ArrayView<const Matrix3x3<T>> matrices, const Corrade::Containers::ArrayView<Matrix3x3<T>> q, const Corrade::Containers::ArrayView<Matrix3x3<T>> p) {
+    CORRADE_ASSERT(q.size() == matrices.size() && p.size() == matrices.size(),
+        "Math::Algorithms::polarDecomposition(): expected views of the same size", );
+
+    for(std::size_t i = 0; i != matrices.size(); ++i)
+        std::tie(q[i], p[i]) = polarDecomposition(matrices[i]);
+}
+
+}}}
+
+#endif
@@ -0,0 +1,108 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Algorithms/Svd.h"
+#include "Magnum/Math/Algorithms/Svd3x3.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test {
+
+struct Svd3x3Benchmark: Corrade::TestSuite::Tester {
+    explicit Svd3x3Benchmark();
+
+    void svdGeneric();
+    void svd3x3();
+    void svd3x3Array();
+    void polarDecompositionArray();
+};
+
+typedef Math::Matrix3x3<Float> Matrix3x3;
+typedef Math::Vector3<Float> Vector3;
+
+namespace {
+    /* Each benchmark decomposes 10k matrices 10 times, divide the iteration
+       count by the measured time to get matrices per second */
+    constexpr std::size_t MatrixCount = 10*1024;
+
+    std::vector<Matrix3x3> matrices() {
+        std::vector<Matrix3x3> out;
+        out.reserve(MatrixCount);
+        for(std::size_t i = 0; i != MatrixCount; ++i) {
+            const Float f = Float(i%97)/97.0f;
+            out.push_back(Matrix3x3{Vector3{1.0f + f, 0.5f, -0.25f*f},
+                                    Vector3{-0.5f*f, 2.0f, 0.75f},
+                                    Vector3{0.3f, -f, 3.0f - f}});
+        }
+        return out;
+    }
+}
+
+Svd3x3Benchmark::Svd3x3Benchmark() {
+    addBenchmarks({&Svd3x3Benchmark::svdGeneric,
+                   &Svd3x3Benchmark::svd3x3,
+                   &Svd3x3Benchmark::svd3x3Array,
+                   &Svd3x3Benchmark::polarDecompositionArray}, 5, BenchmarkType::WallClock);
+}
+
+void Svd3x3Benchmark::svdGeneric() {
+    const std::vector<Matrix3x3> in = matrices();
+    Float sum{};
+    CORRADE_BENCHMARK(10)
+        for(const Matrix3x3& m: in)
+            sum += std::get<1>(Algorithms::svd(m))[0];
+    CORRADE_VERIFY(sum > 0.0f);
+}
+
+void Svd3x3Benchmark::svd3x3() {
+    const std::vector<Matrix3x3> in = matrices();
+    Float sum{};
+    CORRADE_BENCHMARK(10)
+        for(const Matrix3x3& m: in)
+            sum += std::get<1>(Algorithms::svd3x3(m))[0];
+    CORRADE_VERIFY(sum > 0.0f);
+}
+
+void Svd3x3Benchmark::svd3x3Array() {
+    const std::vector<Matrix3x3> in = matrices();
+    std::vector<Matrix3x3> u(in.size()), v(in.size());
+    std::vector<Vector3> w(in.size());
+    CORRADE_BENCHMARK(10)
+        Algorithms::svd3x3<Float>({in.data(), in.size()}, {u.data(), u.size()}, {w.data(), w.size()}, {v.data(), v.size()});
+    CORRADE_VERIFY(w[0][0] > 0.0f);
+}
+
+void Svd3x3Benchmark::polarDecompositionArray() {
+    const std::vector<Matrix3x3> in = matrices();
+    std::vector<Matrix3x3> q(in.size()), p(in.size());
+    CORRADE_BENCHMARK(10)
+        Algorithms::polarDecomposition<Float>({in.data(), in.size()}, {q.data(), q.size()}, {p.data(), p.size()});
+    CORRADE_VERIFY(p[0][0][0] > 0.0f);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::Svd3x3Benchmark)
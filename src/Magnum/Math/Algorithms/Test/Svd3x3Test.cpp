@@ -0,0 +1,207 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Algorithms/Svd.h"
+#include "Magnum/Math/Algorithms/Svd3x3.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test {
+
+struct Svd3x3Test: Corrade::TestSuite::Tester {
+    explicit Svd3x3Test();
+
+    template<class T> void svd();
+    void svdSingular();
+    void svdZero();
+    void svdArray();
+    void svdArraySizeMismatch();
+
+    template<class T> void polarDecomposition();
+    void polarDecompositionReflection();
+    void polarDecompositionArray();
+};
+
+typedef Math::Matrix3x3<Float> Matrix3x3;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Deg<Float> Deg;
+
+Svd3x3Test::Svd3x3Test() {
+    addTests<Svd3x3Test>({&Svd3x3Test::svd<Float>,
+                          &Svd3x3Test::svd<Double>,
+                          &Svd3x3Test::svdSingular,
+                          &Svd3x3Test::svdZero,
+                          &Svd3x3Test::svdArray,
+                          &Svd3x3Test::svdArraySizeMismatch,
+
+                          &Svd3x3Test::polarDecomposition<Float>,
+                          &Svd3x3Test::polarDecomposition<Double>,
+                          &Svd3x3Test::polarDecompositionReflection,
+                          &Svd3x3Test::polarDecompositionArray});
+}
+
+namespace {
+    template<class T> Math::Matrix3x3<T> data() {
+        return {Math::Vector<3, T>{T(3.0), T(-1.5), T(2.0)},
+                Math::Vector<3, T>{T(0.5), T(4.0), T(-2.0)},
+                Math::Vector<3, T>{T(-1.0), T(2.5), T(1.0)}};
+    }
+}
+
+template<class T> void Svd3x3Test::svd() {
+    setTestCaseName(std::is_same<T, Double>::value ? "svd<Double>" : "svd<Float>");
+
+    Math::Matrix3x3<T> u{NoInit};
+    Math::Vector3<T> w{NoInit};
+    Math::Matrix3x3<T> v{NoInit};
+    std::tie(u, w, v) = Algorithms::svd3x3(data<T>());
+
+    CORRADE_COMPARE(u*Math::Matrix3x3<T>::fromDiagonal(w)*v.transposed(), data<T>());
+    CORRADE_VERIFY(u.isOrthogonal());
+    CORRADE_VERIFY(v.isOrthogonal());
+
+    /* Same singular values as the generic implementation, just sorted */
+    Math::Matrix3x3<T> uGeneric{NoInit};
+    Math::Vector<3, T> wGeneric{NoInit};
+    Math::Matrix3x3<T> vGeneric{NoInit};
+    std::tie(uGeneric, wGeneric, vGeneric) = Algorithms::svd(data<T>());
+    std::sort(wGeneric.data(), wGeneric.data() + 3, [](T a, T b) { return a > b; });
+    CORRADE_COMPARE((Math::Vector<3, T>{w}), wGeneric);
+}
+
+void Svd3x3Test::svdSingular() {
+    /* Rank two and rank one matrices still give orthogonal U */
+    for(const Matrix3x3& m: {
+        Matrix3x3{Vector3{1.0f, 2.0f, 3.0f}, Vector3{2.0f, 4.0f, 6.0f}, Vector3{0.0f, 1.0f, -1.0f}},
+        Matrix3x3{Vector3{1.0f, 2.0f, 3.0f}, Vector3{2.0f, 4.0f, 6.0f}, Vector3{-1.0f, -2.0f, -3.0f}}})
+    {
+        Matrix3x3 u{NoInit};
+        Vector3 w{NoInit};
+        Matrix3x3 v{NoInit};
+        std::tie(u, w, v) = Algorithms::svd3x3(m);
+
+        CORRADE_COMPARE(u*Matrix3x3::fromDiagonal(w)*v.transposed(), m);
+        CORRADE_VERIFY(u.isOrthogonal());
+        CORRADE_VERIFY(v.isOrthogonal());
+        CORRADE_COMPARE(w[2], 0.0f);
+        CORRADE_VERIFY(w[0] >= w[1] && w[1] >= w[2]);
+    }
+}
+
+void Svd3x3Test::svdZero() {
+    Matrix3x3 u{NoInit};
+    Vector3 w{NoInit};
+    Matrix3x3 v{NoInit};
+    std::tie(u, w, v) = Algorithms::svd3x3(Matrix3x3{ZeroInit});
+
+    CORRADE_COMPARE(u, Matrix3x3{});
+    CORRADE_COMPARE(w, Vector3{});
+    CORRADE_COMPARE(v, Matrix3x3{});
+}
+
+void Svd3x3Test::svdArray() {
+    const Matrix3x3 matrices[]{
+        data<Float>(),
+        Matrix3x3{Vector3{1.0f, 2.0f, 3.0f}, Vector3{2.0f, 4.0f, 6.0f}, Vector3{0.0f, 1.0f, -1.0f}},
+        Math::Matrix4<Float>::rotation(Deg(35.0f), Vector3{1.0f, 2.0f, -1.0f}.normalized()).rotationScaling()};
+    Matrix3x3 u[3];
+    Vector3 w[3];
+    Matrix3x3 v[3];
+    Algorithms::svd3x3(Corrade::Containers::ArrayView<const Matrix3x3>{matrices}, Corrade::Containers::ArrayView<Matrix3x3>{u}, Corrade::Containers::ArrayView<Vector3>{w}, Corrade::Containers::ArrayView<Matrix3x3>{v});
+
+    for(std::size_t i = 0; i != 3; ++i) {
+        Matrix3x3 expectedU{NoInit};
+        Vector3 expectedW{NoInit};
+        Matrix3x3 expectedV{NoInit};
+        std::tie(expectedU, expectedW, expectedV) = Algorithms::svd3x3(matrices[i]);
+        CORRADE_COMPARE(u[i], expectedU);
+        CORRADE_COMPARE(w[i], expectedW);
+        CORRADE_COMPARE(v[i], expectedV);
+    }
+
+    /* Rotation has all singular values equal to one */
+    CORRADE_COMPARE(w[2], Vector3{1.0f});
+}
+
+void Svd3x3Test::svdArraySizeMismatch() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const Matrix3x3 matrices[2];
+    Matrix3x3 u[2];
+    Vector3 w[1];
+    Matrix3x3 v[2];
+    Algorithms::svd3x3(Corrade::Containers::ArrayView<const Matrix3x3>{matrices}, Corrade::Containers::ArrayView<Matrix3x3>{u}, Corrade::Containers::ArrayView<Vector3>{w}, Corrade::Containers::ArrayView<Matrix3x3>{v});
+    CORRADE_COMPARE(out.str(), "Math::Algorithms::svd3x3(): expected views of the same size\n");
+}
+
+template<class T> void Svd3x3Test::polarDecomposition() {
+    setTestCaseName(std::is_same<T, Double>::value ? "polarDecomposition<Double>" : "polarDecomposition<Float>");
+
+    /* Rotation times non-uniform scaling */
+    const Math::Matrix3x3<T> rotation = Math::Matrix4<T>::rotation(Math::Deg<T>(T(35.0)), Math::Vector3<T>{T(1.0), T(2.0), T(-1.0)}.normalized()).rotationScaling();
+    const Math::Matrix3x3<T> scaling = Math::Matrix3x3<T>::fromDiagonal({T(2.0), T(0.5), T(3.0)});
+
+    Math::Matrix3x3<T> q{NoInit};
+    Math::Matrix3x3<T> p{NoInit};
+    std::tie(q, p) = Algorithms::polarDecomposition(rotation*scaling);
+    CORRADE_COMPARE(q, rotation);
+    CORRADE_COMPARE(p, scaling);
+
+    /* Generic matrix */
+    std::tie(q, p) = Algorithms::polarDecomposition(data<T>());
+    CORRADE_COMPARE(q*p, data<T>());
+    CORRADE_VERIFY(q.isOrthogonal());
+    CORRADE_COMPARE(p, p.transposed());
+}
+
+void Svd3x3Test::polarDecompositionReflection() {
+    const Matrix3x3 m = Matrix3x3::fromDiagonal({-1.0f, 2.0f, 1.0f});
+
+    Matrix3x3 q{NoInit};
+    Matrix3x3 p{NoInit};
+    std::tie(q, p) = Algorithms::polarDecomposition(m);
+    CORRADE_COMPARE(q, Matrix3x3::fromDiagonal({-1.0f, 1.0f, 1.0f}));
+    CORRADE_COMPARE(p, Matrix3x3::fromDiagonal({1.0f, 2.0f, 1.0f}));
+}
+
+void Svd3x3Test::polarDecompositionArray() {
+    const Matrix3x3 matrices[]{data<Float>(), Matrix3x3::fromDiagonal({2.0f, 3.0f, 4.0f})};
+    Matrix3x3 q[2];
+    Matrix3x3 p[2];
+    Algorithms::polarDecomposition(Corrade::Containers::ArrayView<const Matrix3x3>{matrices}, Corrade::Containers::ArrayView<Matrix3x3>{q}, Corrade::Containers::ArrayView<Matrix3x3>{p});
+
+    CORRADE_COMPARE(q[0]*p[0], data<Float>());
+    CORRADE_COMPARE(q[1], Matrix3x3{});
+    CORRADE_COMPARE(p[1], Matrix3x3::fromDiagonal({2.0f, 3.0f, 4.0f}));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::Svd3x3Test)
@@ -30,7 +30,10 @@
  * @brief Class @ref Magnum::Math::Bezier, alias @ref Magnum::Math::QuadraticBezier, @ref Magnum::Math::QuadraticBezier2D, @ref Magnum::Math::QuadraticBezier3D, @ref Magnum::Math::CubicBezier, @ref Magnum::Math::CubicBezier2D, @ref Magnum::Math::CubicBezier3D
  */
 
+#include <algorithm>
 #include <array>
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
 
 #include "Magnum/Math/Vector.h"
 
@@ -143,6 +146,144 @@ template<UnsignedInt order, UnsignedInt dimensions, class T> class Bezier {
             return {left, right};
         }
 
+        /**
+         * @brief Interpolate the curve at uniformly distributed positions
+         *
+         * Fills @p out with points for interpolation factors uniformly
+         * distributed in range @f$ [0, 1] @f$, the first and the last point
+         * being exactly the first and the last control point. Uses forward
+         * differencing, which needs only @ref Order additions per point
+         * instead of the @f$ \mathcal{O}(n^2) @f$ operations of
+         * @ref value(). The result can be passed directly to
+         * @ref Buffer::setData():
+         * @code
+         * CubicBezier2D curve{...};
+         * std::vector<Vector2> points(64);
+         * curve.values({points.data(), points.size()});
+         * buffer.setData(points, BufferUsage::DynamicDraw);
+         * @endcode
+         * @see @ref values(Corrade::Containers::ArrayView<const Float>, Corrade::Containers::ArrayView<Vector<dimensions, T>>) const,
+         *      @ref flatten()
+         */
+        void values(Corrade::Containers::ArrayView<Vector<dimensions, T>> out) const {
+            if(out.empty()) return;
+            if(out.size() == 1) {
+                out[0] = _data[0];
+                return;
+            }
+
+            /* Initial forward differences from values at the first order + 1
+               steps. The higher differences are tiny compared to the values
+               they're calculated from and any error in them grows with
+               cube of the point count, so everything is done in double
+               precision. */
+            typedef typename std::common_type<T, Double>::type Accumulator;
+            const std::array<Vector<dimensions, Accumulator>, order + 1> coefficients = powerBasis<Accumulator>();
+            const Accumulator step = Accumulator(1)/Accumulator(out.size() - 1);
+            Vector<dimensions, Accumulator> differences[order + 1];
+            for(std::size_t i = 0; i <= order; ++i)
+                differences[i] = horner(coefficients, i*step);
+            for(std::size_t i = 1; i <= order; ++i)
+                for(std::size_t j = order; j >= i; --j)
+                    differences[j] -= differences[j - 1];
+
+            for(std::size_t i = 0; i != out.size() - 1; ++i) {
+                out[i] = Vector<dimensions, T>(differences[0]);
+                for(std::size_t j = 0; j != order; ++j)
+                    differences[j] += differences[j + 1];
+            }
+            out[out.size() - 1] = _data[order];
+        }
+
+        /**
+         * @brief Interpolate the curve at given positions
+         *
+         * Equivalent to calling @ref value() for each item of @p t and
+         * saving the results into @p out, but the curve is converted to a
+         * polynomial only once and every point is then evaluated with
+         * @ref Order multiply-add operations. Expects that both views have
+         * the same size.
+         * @see @ref values(Corrade::Containers::ArrayView<Vector<dimensions, T>>) const
+         */
+        void values(Corrade::Containers::ArrayView<const Float> t, Corrade::Containers::ArrayView<Vector<dimensions, T>> out) const {
+            CORRADE_ASSERT(out.size() == t.size(),
+                "Math::Bezier::values(): expected views of the same size", );
+
+            const std::array<Vector<dimensions, T>, order + 1> coefficients = powerBasis<T>();
+            for(std::size_t i = 0; i != t.size(); ++i)
+                out[i] = horner(coefficients, T(t[i]));
+        }
+
+        /**
+         * @brief Flatten the curve into line segments
+         * @param tolerance     Maximal distance between the curve and the
+         *      resulting polyline
+         *
+         * Recursively subdivides the curve in half until each part is
+         * closer to its chord than @p tolerance and returns the chord end
+         * points as a contiguous polyline, starting with the first and
+         * ending with the last control point. Flat parts of the curve thus
+         * produce only a few segments, while strongly curved parts are
+         * subdivided more. The distance is estimated from the control
+         * points' deviation from the chord, which bounds the distance of
+         * the curve from the chord from above. The recursion depth is
+         * limited to 16, i.e. at most 65536 segments are produced.
+         * @see @ref values()
+         */
+        std::vector<Vector<dimensions, T>> flatten(T tolerance) const {
+            std::vector<Vector<dimensions, T>> out;
+            out.push_back(_data[0]);
+            flattenInto(out, tolerance*tolerance, 0);
+            return out;
+        }
+
+        /**
+         * @brief Arc length lookup table
+         * @param segments      Count of linear segments used for the
+         *      approximation
+         *
+         * Returns @p segments + 1 cumulative lengths of the curve measured
+         * at uniformly distributed interpolation factors, the first being
+         * `0` and the last being the approximate length of the whole
+         * curve. Pass the table to @ref arcLengthParameter() to get an
+         * interpolation factor for given distance along the curve, for
+         * example to place dashes or text uniformly regardless of the curve
+         * parametrization.
+         */
+        std::vector<T> arcLengthTable(std::size_t segments) const {
+            std::vector<Vector<dimensions, T>> points(segments + 1);
+            values({points.data(), points.size()});
+
+            std::vector<T> out;
+            out.reserve(segments + 1);
+            out.push_back(T(0));
+            for(std::size_t i = 1; i <= segments; ++i)
+                out.push_back(out.back() + (points[i] - points[i - 1]).length());
+            return out;
+        }
+
+        /**
+         * @brief Interpolation factor for given arc length
+         * @param table         Table returned by @ref arcLengthTable()
+         * @param length        Distance along the curve
+         *
+         * Finds the table segment containing @p length using binary search
+         * and linearly interpolates the interpolation factor inside it.
+         * Lengths outside of the table range are clamped to @f$ [0, 1] @f$.
+         */
+        static Float arcLengthParameter(const std::vector<T>& table, T length) {
+            CORRADE_ASSERT(table.size() >= 2,
+                "Math::Bezier::arcLengthParameter(): expected at least two table entries", {});
+
+            if(length <= table.front()) return 0.0f;
+            if(length >= table.back()) return 1.0f;
+
+            const std::size_t i = std::upper_bound(table.begin(), table.end(), length) - table.begin();
+            const T segmentLength = table[i] - table[i - 1];
+            const T fraction = segmentLength == T(0) ? T(0) : (length - table[i - 1])/segmentLength;
+            return Float((T(i - 1) + fraction)/T(table.size() - 1));
+        }
+
     private:
         /* Implementation for Bezier<order, dimensions, T>::Bezier(const Bezier<order, dimensions, U>&) */
         template<class U, std::size_t ...sequence> constexpr explicit Bezier(Implementation::Sequence<sequence...>, const Bezier<order, dimensions, U>& other) noexcept: _data{Vector<dimensions, T>(other._data[sequence])...} {}
@@ -151,6 +292,54 @@ template<UnsignedInt order, UnsignedInt dimensions, class T> class Bezier {
         /* MSVC 2015 can't handle {} here */
         template<class U, std::size_t ...sequence> constexpr explicit Bezier(Implementation::Sequence<sequence...>, U): _data{Vector<dimensions, T>((static_cast<void>(sequence), U{typename U::Init{}}))...} {}
 
+        /* Coefficients of the curve converted from Bernstein to power basis,
+           i.e. the curve is equal to sum of coefficients[k]*t^k:
+           coefficients[k] = binomial(order, k)*sum_i (-1)^(k - i) binomial(k, i) P_i */
+        template<class U> std::array<Vector<dimensions, U>, order + 1> powerBasis() const {
+            std::array<Vector<dimensions, U>, order + 1> coefficients;
+            U orderBinomial = U(1);
+            for(std::size_t k = 0; k <= order; ++k) {
+                Vector<dimensions, U> sum;
+                U binomial = U(1);
+                for(std::size_t i = 0; i <= k; ++i) {
+                    sum += ((k - i) % 2 ? -binomial : binomial)*Vector<dimensions, U>(_data[i]);
+                    binomial = binomial*U(k - i)/U(i + 1);
+                }
+                coefficients[k] = orderBinomial*sum;
+                orderBinomial = orderBinomial*U(order - k)/U(k + 1);
+            }
+            return coefficients;
+        }
+
+        template<class U> static Vector<dimensions, U> horner(const std::array<Vector<dimensions, U>, order + 1>& coefficients, U t) {
+            Vector<dimensions, U> out = coefficients[order];
+            for(std::size_t k = order; k != 0; --k)
+                out = out*t + coefficients[k - 1];
+            return out;
+        }
+
+        /* The curve minus its chord is a Bézier curve with control points
+           P_i - lerp(P_0, P_n, i/n) and zero end points, so its distance
+           from the chord is at most max |P_i - lerp(P_0, P_n, i/n)| times
+           the maximum of the inner Bernstein polynomial sum, which is
+           1 - 2^(1 - n) at t = 1/2 */
+        void flattenInto(std::vector<Vector<dimensions, T>>& out, T toleranceSquared, UnsignedInt depth) const {
+            T maxDeviationSquared{};
+            for(std::size_t i = 1; i < order; ++i) {
+                const T f = T(i)/T(order);
+                maxDeviationSquared = std::max(maxDeviationSquared, (_data[i] - ((T(1) - f)*_data[0] + f*_data[order])).dot());
+            }
+            const T factor = T(1) - T(1)/T(1 << (order - 1));
+            if(depth == 16 || maxDeviationSquared*factor*factor <= toleranceSquared) {
+                out.push_back(_data[order]);
+                return;
+            }
+
+            const std::pair<Bezier<order, dimensions, T>, Bezier<order, dimensions, T>> halves = subdivide(0.5f);
+            halves.first.flattenInto(out, toleranceSquared, depth + 1);
+            halves.second.flattenInto(out, toleranceSquared, depth + 1);
+        }
+
         /* Calculates and returns all intermediate points generated when using De Casteljau's algorithm */
         std::array<Bezier<order, dimensions, T>, order + 1> calculateIntermediatePoints(Float t) const {
             std::array<Bezier<order, dimensions, T>, order + 1> iPoints;
@@ -0,0 +1,395 @@
+#ifndef Magnum_Math_BitArray_h
+#define Magnum_Math_BitArray_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Math::BitArray
+ */
+
+#include <vector>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Types.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace Magnum { namespace Math {
+
+namespace Implementation {
+    inline std::size_t popcount(UnsignedLong value) {
+        #ifdef __GNUC__
+        return __builtin_popcountll(value);
+        #else
+        value = value - ((value >> 1) & 0x5555555555555555ull);
+        value = (value & 0x3333333333333333ull) + ((value >> 2) & 0x3333333333333333ull);
+        value = (value + (value >> 4)) & 0x0f0f0f0f0f0f0f0full;
+        return (value*0x0101010101010101ull) >> 56;
+        #endif
+    }
+
+    /* Undefined for zero */
+    inline std::size_t trailingZeros(const UnsignedLong value) {
+        #ifdef __GNUC__
+        return __builtin_ctzll(value);
+        #elif defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index;
+        _BitScanForward64(&index, value);
+        return index;
+        #else
+        std::size_t count = 0;
+        for(UnsignedLong v = value; !(v & 1); v >>= 1) ++count;
+        return count;
+        #endif
+    }
+}
+
+/**
+@brief Dynamically sized bit array
+
+Unlike @ref BoolVector, which is meant for results of component-wise
+comparisons of small vectors, this class stores an arbitrary count of bits,
+for example visibility masks or culling results for thousands of objects. The
+bits are stored in contiguous array of 64-bit words and all operations work
+on whole words, so the bitwise operations, @ref count() and @ref findNext()
+process 64 bits at a time and the loops are easily vectorized by the
+compiler. Unused bits in the last word are always kept at zero.
+
+Set bits can be iterated either using @ref findNext() or in a range-for loop
+over @ref setBits(), which skips whole empty words:
+@code
+Math::BitArray visible{drawables.size()};
+// ... set bits of visible drawables
+
+for(std::size_t i: visible.setBits())
+    drawables[i].draw(...);
+@endcode
+
+@see @ref SceneGraph::Camera::draw(DrawableGroup<dimensions, T>&, const Math::BitArray&)
+*/
+class BitArray {
+    public:
+        enum: std::size_t {
+            WordBits = 64   /**< Count of bits in one storage word */
+        };
+
+        class SetBits;
+
+        /** @brief Default constructor */
+        /*implicit*/ BitArray() noexcept: _size{} {}
+
+        /**
+         * @brief Constructor
+         * @param size      Bit count
+         * @param value     Initial value of all bits
+         */
+        explicit BitArray(std::size_t size, bool value = false): _size{size}, _data((size + WordBits - 1)/WordBits, value ? ~UnsignedLong{} : UnsignedLong{}) {
+            clearUnused();
+        }
+
+        /** @brief Bit count */
+        std::size_t size() const { return _size; }
+
+        /** @brief Whether the array is empty */
+        bool isEmpty() const { return !_size; }
+
+        /** @brief Count of storage words */
+        std::size_t wordCount() const { return _data.size(); }
+
+        /**
+         * @brief Raw data
+         *
+         * Bit @cpp i @ce is stored in bit @cpp i%WordBits @ce of word
+         * @cpp i/WordBits @ce. When modifying the data directly, the unused
+         * bits of the last word have to be kept at zero.
+         */
+        UnsignedLong* data() { return _data.data(); }
+        const UnsignedLong* data() const { return _data.data(); } /**< @overload */
+
+        /** @brief Bit at given position */
+        bool operator[](std::size_t i) const {
+            return (_data[i/WordBits] >> (i%WordBits)) & 1;
+        }
+
+        /**
+         * @brief Set bit at given position
+         * @return Reference to self (for method chaining)
+         */
+        BitArray& set(std::size_t i) {
+            _data[i/WordBits] |= UnsignedLong{1} << (i%WordBits);
+            return *this;
+        }
+
+        /**
+         * @brief Set or reset bit at given position
+         * @return Reference to self (for method chaining)
+         */
+        BitArray& set(std::size_t i, bool value) {
+            return value ? set(i) : reset(i);
+        }
+
+        /**
+         * @brief Reset bit at given position
+         * @return Reference to self (for method chaining)
+         */
+        BitArray& reset(std::size_t i) {
+            _data[i/WordBits] &= ~(UnsignedLong{1} << (i%WordBits));
+            return *this;
+        }
+
+        /**
+         * @brief Set or reset all bits
+         * @return Reference to self (for method chaining)
+         */
+        BitArray& fill(bool value) {
+            for(UnsignedLong& word: _data) word = value ? ~UnsignedLong{} : UnsignedLong{};
+            clearUnused();
+            return *this;
+        }
+
+        /**
+         * @brief Resize the array
+         *
+         * Existing bits are kept, new bits are set to @p value.
+         */
+        void resize(std::size_t size, bool value = false);
+
+        /** @brief Count of set bits */
+        std::size_t count() const {
+            std::size_t out = 0;
+            for(const UnsignedLong word: _data) out += Implementation::popcount(word);
+            return out;
+        }
+
+        /** @brief Whether all bits are set */
+        bool all() const { return count() == _size; }
+
+        /** @brief Whether no bits are set */
+        bool none() const {
+            for(const UnsignedLong word: _data) if(word) return false;
+            return true;
+        }
+
+        /** @brief Whether any bit is set */
+        bool any() const { return !none(); }
+
+        /**
+         * @brief Find next set bit
+         *
+         * Returns position of first set bit at position @p i or after it. If
+         * there is no such bit, returns @ref size().
+         * @see @ref setBits()
+         */
+        std::size_t findNext(std::size_t i) const;
+
+        /**
+         * @brief Range of set bits
+         *
+         * Range-for loop over the returned value gives positions of all set
+         * bits in ascending order.
+         * @see @ref findNext()
+         */
+        SetBits setBits() const;
+
+        /** @brief Equality comparison */
+        bool operator==(const BitArray& other) const {
+            return _size == other._size && _data == other._data;
+        }
+
+        /** @brief Non-equality comparison */
+        bool operator!=(const BitArray& other) const {
+            return !operator==(other);
+        }
+
+        /** @brief Bitwise inversion */
+        BitArray operator~() const {
+            BitArray out{*this};
+            for(UnsignedLong& word: out._data) word = ~word;
+            out.clearUnused();
+            return out;
+        }
+
+        /**
+         * @brief Bitwise AND and assign
+         *
+         * Expects that both arrays have the same size.
+         */
+        BitArray& operator&=(const BitArray& other) {
+            CORRADE_ASSERT(_size == other._size, "Math::BitArray: size mismatch", *this);
+            for(std::size_t i = 0; i != _data.size(); ++i) _data[i] &= other._data[i];
+            return *this;
+        }
+
+        /**
+         * @brief Bitwise OR and assign
+         *
+         * Expects that both arrays have the same size.
+         */
+        BitArray& operator|=(const BitArray& other) {
+            CORRADE_ASSERT(_size == other._size, "Math::BitArray: size mismatch", *this);
+            for(std::size_t i = 0; i != _data.size(); ++i) _data[i] |= other._data[i];
+            return *this;
+        }
+
+        /**
+         * @brief Bitwise XOR and assign
+         *
+         * Expects that both arrays have the same size.
+         */
+        BitArray& operator^=(const BitArray& other) {
+            CORRADE_ASSERT(_size == other._size, "Math::BitArray: size mismatch", *this);
+            for(std::size_t i = 0; i != _data.size(); ++i) _data[i] ^= other._data[i];
+            return *this;
+        }
+
+        /**
+         * @brief Bitwise AND with inverted other array and assign
+         *
+         * Clears all bits that are set in @p other, equivalent to
+         * @cpp a &= ~other @ce without the temporary. Expects that both
+         * arrays have the same size.
+         */
+        BitArray& andNot(const BitArray& other) {
+            CORRADE_ASSERT(_size == other._size, "Math::BitArray: size mismatch", *this);
+            for(std::size_t i = 0; i != _data.size(); ++i) _data[i] &= ~other._data[i];
+            return *this;
+        }
+
+        /** @brief Bitwise AND */
+        BitArray operator&(const BitArray& other) const {
+            return BitArray{*this} &= other;
+        }
+
+        /** @brief Bitwise OR */
+        BitArray operator|(const BitArray& other) const {
+            return BitArray{*this} |= other;
+        }
+
+        /** @brief Bitwise XOR */
+        BitArray operator^(const BitArray& other) const {
+            return BitArray{*this} ^= other;
+        }
+
+    private:
+        void clearUnused() {
+            if(_size%WordBits) _data.back() &= (UnsignedLong{1} << (_size%WordBits)) - 1;
+        }
+
+        std::size_t _size;
+        std::vector<UnsignedLong> _data;
+};
+
+/**
+@brief Range of set bits in a bit array
+
+See @ref BitArray::setBits().
+*/
+class BitArray::SetBits {
+    public:
+        /** @brief Iterator over set bits */
+        class Iterator {
+            public:
+                #ifndef DOXYGEN_GENERATING_OUTPUT
+                explicit Iterator(const BitArray& array, std::size_t i): _array(&array), _i{i} {}
+                #endif
+
+                /** @brief Position of the bit */
+                std::size_t operator*() const { return _i; }
+
+                /** @brief Advance to next set bit */
+                Iterator& operator++() {
+                    _i = _array->findNext(_i + 1);
+                    return *this;
+                }
+
+                /** @brief Equality comparison */
+                bool operator==(const Iterator& other) const { return _i == other._i; }
+
+                /** @brief Non-equality comparison */
+                bool operator!=(const Iterator& other) const { return _i != other._i; }
+
+            private:
+                const BitArray* _array;
+                std::size_t _i;
+        };
+
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        explicit SetBits(const BitArray& array): _array(array) {}
+        #endif
+
+        /** @brief Iterator to first set bit */
+        Iterator begin() const { return Iterator{_array, _array.findNext(0)}; }
+
+        /** @brief Iterator past the last set bit */
+        Iterator end() const { return Iterator{_array, _array.size()}; }
+
+    private:
+        const BitArray& _array;
+};
+
+/** @debugoperator{Magnum::Math::BitArray} */
+inline Corrade::Utility::Debug& operator<<(Corrade::Utility::Debug& debug, const BitArray& value) {
+    debug << "BitArray(" << Corrade::Utility::Debug::nospace;
+    for(std::size_t i = 0; i != value.size(); ++i) {
+        if(!i || (i%8)) debug << Corrade::Utility::Debug::nospace;
+        debug << (value[i] ? "1" : "0");
+    }
+    return debug << Corrade::Utility::Debug::nospace << ")";
+}
+
+inline void BitArray::resize(const std::size_t size, const bool value) {
+    const std::size_t oldSize = _size;
+    _data.resize((size + WordBits - 1)/WordBits, value ? ~UnsignedLong{} : UnsignedLong{});
+    _size = size;
+
+    /* Set the previously unused bits of the original last word */
+    if(value && size > oldSize && oldSize%WordBits)
+        _data[oldSize/WordBits] |= ~((UnsignedLong{1} << (oldSize%WordBits)) - 1);
+
+    clearUnused();
+}
+
+inline std::size_t BitArray::findNext(std::size_t i) const {
+    if(i >= _size) return _size;
+
+    /* Mask out bits before i in the first word, then skip empty words */
+    std::size_t word = i/WordBits;
+    UnsignedLong bits = _data[word] & (~UnsignedLong{} << (i%WordBits));
+    while(!bits) {
+        if(++word == _data.size()) return _size;
+        bits = _data[word];
+    }
+
+    return word*WordBits + Implementation::trailingZeros(bits);
+}
+
+inline BitArray::SetBits BitArray::setBits() const { return SetBits{*this}; }
+
+}}
+
+#endif
@@ -26,10 +26,12 @@
 */
 
 /** @file
- * @brief Class @ref Magnum::Math::Color3, @ref Magnum::Math::Color4
+ * @brief Class @ref Magnum::Math::Color3, @ref Magnum::Math::Color4, function @ref Magnum::Math::srgbToLinear(), @ref Magnum::Math::linearToSrgb(), @ref Magnum::Math::srgbToLinearRgb(), @ref Magnum::Math::srgbToLinearRgba(), @ref Magnum::Math::unpackNormalizedRgb(), @ref Magnum::Math::unpackNormalizedRgba(), @ref Magnum::Math::hsvToRgb(), @ref Magnum::Math::rgbToHsv()
  */
 
+#include <cmath>
 #include <tuple>
+#include <Corrade/Containers/ArrayView.h>
 
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Vector4.h"
@@ -554,6 +556,202 @@ class Color4: public Vector4<T> {
 MAGNUM_VECTORn_OPERATOR_IMPLEMENTATION(4, Color4)
 #endif
 
+namespace Implementation {
+
+/* sRGB transfer function for a single channel, shared with the batch
+   conversion in PixelConversion */
+template<class T> inline T srgbToLinear(const T value) {
+    return value <= T(0.04045) ? value/T(12.92) : std::pow((value + T(0.055))/T(1.055), T(2.4));
+}
+template<class T> inline T linearToSrgb(const T value) {
+    return value <= T(0.0031308) ? value*T(12.92) : T(1.055)*std::pow(value, T(1)/T(2.4)) - T(0.055);
+}
+
+/* Linear values of all 8-bit sRGB values */
+inline const Float* srgbToLinearTable() {
+    static const struct Table {
+        Table() {
+            for(std::size_t i = 0; i != 256; ++i)
+                data[i] = srgbToLinear(Float(i)/255.0f);
+        }
+
+        Float data[256];
+    } table;
+    return table.data;
+}
+
+/* Branchless HSV to RGB conversion, hue in [0, 6) sextants. Used by the
+   batch conversion, the SIMD code does the same. */
+template<class T> inline Color3<T> hsvToRgbSextant(const T hue, const T saturation, const T value) {
+    Color3<T> out;
+    for(std::size_t c = 0; c != 3; ++c) {
+        T k = hue + T(5) - T(2*c);
+        if(k >= T(6)) k -= T(6);
+        out[c] = value - value*saturation*clamp(min(k, T(4) - k), T(0), T(1));
+    }
+    return out;
+}
+
+/* Hue in degrees to [0, 6) sextants */
+template<class T> inline T hueSextant(const T hue) {
+    T sextant = hue/T(60);
+    sextant -= std::floor(sextant/T(6))*T(6);
+    /* Rounding errors on negative values may result in exactly 6 */
+    return sextant < T(6) ? sextant : T(0);
+}
+
+}
+
+/**
+@brief Convert an array of sRGB values to linear
+
+Applies the sRGB transfer function on each item of @p values and saves the
+results into @p out. Expects that both views have the same size. The
+conversion is done on each component separately, so it can be used also on
+arrays of @ref Color3 by viewing them as arrays of floats, but not on
+@ref Color4 with alpha.
+@see @ref linearToSrgb(),
+    @ref srgbToLinearRgb(), @ref srgbToLinearRgba()
+*/
+inline void srgbToLinear(const Corrade::Containers::ArrayView<const Float> values, const Corrade::Containers::ArrayView<Float> out) {
+    CORRADE_ASSERT(out.size() == values.size(),
+        "Math::srgbToLinear(): expected views of the same size", );
+
+    for(std::size_t i = 0; i != values.size(); ++i)
+        out[i] = Implementation::srgbToLinear(values[i]);
+}
+
+/**
+@brief Convert an array of linear values to sRGB
+
+Inverse of @ref srgbToLinear(). Expects that both views have the same size.
+*/
+inline void linearToSrgb(const Corrade::Containers::ArrayView<const Float> values, const Corrade::Containers::ArrayView<Float> out) {
+    CORRADE_ASSERT(out.size() == values.size(),
+        "Math::linearToSrgb(): expected views of the same size", );
+
+    for(std::size_t i = 0; i != values.size(); ++i)
+        out[i] = Implementation::linearToSrgb(values[i]);
+}
+
+/**
+@brief Convert an array of 8-bit sRGB colors to linear
+
+Uses a lookup table with all 256 possible values, so it's considerably
+faster than converting each channel separately. Expects that both views have
+the same size.
+@see @ref unpackNormalizedRgb()
+*/
+inline void srgbToLinearRgb(const Corrade::Containers::ArrayView<const Color3<UnsignedByte>> colors, const Corrade::Containers::ArrayView<Color3<Float>> out) {
+    CORRADE_ASSERT(out.size() == colors.size(),
+        "Math::srgbToLinearRgb(): expected views of the same size", );
+
+    const Float* const table = Implementation::srgbToLinearTable();
+    for(std::size_t i = 0; i != colors.size(); ++i)
+        out[i] = {table[colors[i].r()], table[colors[i].g()], table[colors[i].b()]};
+}
+
+/**
+@brief Convert an array of 8-bit sRGB colors with alpha to linear
+
+Same as @ref srgbToLinearRgb(), alpha is converted to a linear value in
+range @f$ [0, 1] @f$ without applying the transfer function.
+*/
+inline void srgbToLinearRgba(const Corrade::Containers::ArrayView<const Color4<UnsignedByte>> colors, const Corrade::Containers::ArrayView<Color4<Float>> out) {
+    CORRADE_ASSERT(out.size() == colors.size(),
+        "Math::srgbToLinearRgba(): expected views of the same size", );
+
+    const Float* const table = Implementation::srgbToLinearTable();
+    for(std::size_t i = 0; i != colors.size(); ++i)
+        out[i] = {table[colors[i].r()], table[colors[i].g()], table[colors[i].b()], normalize<Float>(colors[i].a())};
+}
+
+/**
+@brief Unpack an array of 8-bit colors into floats
+
+Equivalent to calling @ref normalize() on each item of @p colors and saving
+the results into @p out. Expects that both views have the same size.
+@see @ref unpackNormalizedRgba(), @ref srgbToLinearRgb()
+*/
+inline void unpackNormalizedRgb(const Corrade::Containers::ArrayView<const Color3<UnsignedByte>> colors, const Corrade::Containers::ArrayView<Color3<Float>> out) {
+    CORRADE_ASSERT(out.size() == colors.size(),
+        "Math::unpackNormalizedRgb(): expected views of the same size", );
+
+    for(std::size_t i = 0; i != colors.size(); ++i)
+        out[i] = normalize<Color3<Float>>(colors[i]);
+}
+
+/**
+@brief Unpack an array of 8-bit colors with alpha into floats
+
+Equivalent to calling @ref normalize() on each item of @p colors and saving
+the results into @p out. If the library is built with `BUILD_SIMD` and SSE2
+or NEON instructions are enabled on the compiler command line, four colors
+are converted at once. Expects that both views have the same size.
+*/
+inline void unpackNormalizedRgba(const Corrade::Containers::ArrayView<const Color4<UnsignedByte>> colors, const Corrade::Containers::ArrayView<Color4<Float>> out) {
+    CORRADE_ASSERT(out.size() == colors.size(),
+        "Math::unpackNormalizedRgba(): expected views of the same size", );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_MATH_SIMD
+    for(; i + 4 <= colors.size(); i += 4)
+        Implementation::simdUnpackUnsignedByte16(colors[i].data(), out[i].data());
+    #endif
+    for(; i != colors.size(); ++i)
+        out[i] = normalize<Color4<Float>>(colors[i]);
+}
+
+/**
+@brief Convert an array of HSV values to RGB
+
+The @ref Vector3::x() component of each item of @p hsv is hue in degrees,
+@ref Vector3::y() is saturation and @ref Vector3::z() is value, the same
+as @ref Color3::fromHSV() takes. The results are the same as with
+@ref Color3::fromHSV(), except for rounding errors, but are computed without
+branching. If the library is built with `BUILD_SIMD` and SSE2 or NEON
+instructions are enabled on the compiler command line, four colors are
+converted at once. Expects that both views have the same size.
+@see @ref rgbToHsv()
+*/
+inline void hsvToRgb(const Corrade::Containers::ArrayView<const Vector3<Float>> hsv, const Corrade::Containers::ArrayView<Color3<Float>> out) {
+    CORRADE_ASSERT(out.size() == hsv.size(),
+        "Math::hsvToRgb(): expected views of the same size", );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_MATH_SIMD
+    for(; i + 4 <= hsv.size(); i += 4) {
+        Float h[4], s[4], v[4];
+        for(std::size_t j = 0; j != 4; ++j) {
+            h[j] = Implementation::hueSextant(hsv[i + j].x());
+            s[j] = hsv[i + j].y();
+            v[j] = hsv[i + j].z();
+        }
+        Implementation::simdHsvToRgb4(h, s, v, out[i].data());
+    }
+    #endif
+    for(; i != hsv.size(); ++i)
+        out[i] = Implementation::hsvToRgbSextant(Implementation::hueSextant(hsv[i].x()), hsv[i].y(), hsv[i].z());
+}
+
+/**
+@brief Convert an array of RGB colors to HSV
+
+Inverse of @ref hsvToRgb(), equivalent to calling @ref Color3::toHSV() on
+each item of @p colors and saving the results into @p out, hue in degrees in
+@ref Vector3::x(). Expects that both views have the same size.
+*/
+inline void rgbToHsv(const Corrade::Containers::ArrayView<const Color3<Float>> colors, const Corrade::Containers::ArrayView<Vector3<Float>> out) {
+    CORRADE_ASSERT(out.size() == colors.size(),
+        "Math::rgbToHsv(): expected views of the same size", );
+
+    for(std::size_t i = 0; i != colors.size(); ++i) {
+        const Float max = colors[i].max();
+        const Float delta = max - colors[i].min();
+        out[i] = {Float(Implementation::hue<Float>(colors[i], max, delta)), max != 0.0f ? delta/max : 0.0f, max};
+    }
+}
+
 namespace Literals {
 
 /** @relatesalso Magnum::Math::Color3
@@ -55,7 +55,7 @@ namespace Implementation {
 @f]
 @see @ref Complex::dot() const
 */
-template<class T> inline T dot(const Complex<T>& a, const Complex<T>& b) {
+template<class T> constexpr T dot(const Complex<T>& a, const Complex<T>& b) {
     return a.real()*b.real() + a.imaginary()*b.imaginary();
 }
 
@@ -252,7 +252,7 @@ template<class T> class Complex {
          * @see @ref fromMatrix(), @ref DualComplex::toMatrix(),
          *      @ref Matrix3::from(const Matrix2x2<T>&, const Vector2<T>&)
          */
-        Matrix2x2<T> toMatrix() const {
+        constexpr Matrix2x2<T> toMatrix() const {
             return {Vector<2, T>(_real, _imaginary),
                     Vector<2, T>(-_imaginary, _real)};
         }
@@ -275,8 +275,8 @@ template<class T> class Complex {
          *
          * @see @ref operator+=(const Complex<T>&)
          */
-        Complex<T> operator+(const Complex<T>& other) const {
-            return Complex<T>(*this) += other;
+        constexpr Complex<T> operator+(const Complex<T>& other) const {
+            return {_real + other._real, _imaginary + other._imaginary};
         }
 
         /**
@@ -286,7 +286,7 @@ template<class T> class Complex {
          *      -c = -a -ib
          * @f]
          */
-        Complex<T> operator-() const {
+        constexpr Complex<T> operator-() const {
             return {-_real, -_imaginary};
         }
 
@@ -308,8 +308,8 @@ template<class T> class Complex {
          *
          * @see @ref operator-=(const Complex<T>&)
          */
-        Complex<T> operator-(const Complex<T>& other) const {
-            return Complex<T>(*this) -= other;
+        constexpr Complex<T> operator-(const Complex<T>& other) const {
+            return {_real - other._real, _imaginary - other._imaginary};
         }
 
         /**
@@ -330,8 +330,8 @@ template<class T> class Complex {
          *
          * @see @ref operator*=(T)
          */
-        Complex<T> operator*(T scalar) const {
-            return Complex<T>(*this) *= scalar;
+        constexpr Complex<T> operator*(T scalar) const {
+            return {_real*scalar, _imaginary*scalar};
         }
 
         /**
@@ -352,8 +352,8 @@ template<class T> class Complex {
          *
          * @see @ref operator/=(T)
          */
-        Complex<T> operator/(T scalar) const {
-            return Complex<T>(*this) /= scalar;
+        constexpr Complex<T> operator/(T scalar) const {
+            return {_real/scalar, _imaginary/scalar};
         }
 
         /**
@@ -363,7 +363,7 @@ template<class T> class Complex {
          *      c_0 c_1 = (a_0 + ib_0)(a_1 + ib_1) = (a_0 a_1 - b_0 b_1) + i(a_1 b_0 + a_0 b_1)
          * @f]
          */
-        Complex<T> operator*(const Complex<T>& other) const {
+        constexpr Complex<T> operator*(const Complex<T>& other) const {
             return {_real*other._real - _imaginary*other._imaginary,
                     _imaginary*other._real + _real*other._imaginary};
         }
@@ -378,7 +378,7 @@ template<class T> class Complex {
          * @f]
          * @see @ref dot(const Complex&, const Complex&), @ref isNormalized()
          */
-        T dot() const { return Math::dot(*this, *this); }
+        constexpr T dot() const { return Math::dot(*this, *this); }
 
         /**
          * @brief Complex number length
@@ -414,7 +414,7 @@ template<class T> class Complex {
          *      c^* = a - ib
          * @f]
          */
-        Complex<T> conjugated() const {
+        constexpr Complex<T> conjugated() const {
             return {_real, -_imaginary};
         }
 
@@ -426,7 +426,7 @@ template<class T> class Complex {
          *      c^{-1} = \frac{c^*}{|c|^2} = \frac{c^*}{c \cdot c}
          * @f]
          */
-        Complex<T> inverted() const {
+        constexpr Complex<T> inverted() const {
             return conjugated()/dot();
         }
 
@@ -454,7 +454,7 @@ template<class T> class Complex {
          * @see @ref Complex(const Vector2<T>&), @ref operator Vector2<T>(),
          *      @ref Matrix3::transformVector()
          */
-        Vector2<T> transformVector(const Vector2<T>& vector) const {
+        constexpr Vector2<T> transformVector(const Vector2<T>& vector) const {
             return Vector2<T>((*this)*Complex<T>(vector));
         }
 
@@ -467,7 +467,7 @@ template<class T> class Complex {
 
 Same as @ref Complex::operator*(T) const.
 */
-template<class T> inline Complex<T> operator*(T scalar, const Complex<T>& complex) {
+template<class T> constexpr Complex<T> operator*(T scalar, const Complex<T>& complex) {
     return complex*scalar;
 }
 
@@ -479,7 +479,7 @@ template<class T> inline Complex<T> operator*(T scalar, const Complex<T>& comple
 @f]
 @see @ref Complex::operator/()
 */
-template<class T> inline Complex<T> operator/(T scalar, const Complex<T>& complex) {
+template<class T> constexpr Complex<T> operator/(T scalar, const Complex<T>& complex) {
     return {scalar/complex.real(), scalar/complex.imaginary()};
 }
 
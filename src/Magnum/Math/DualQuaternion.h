@@ -157,6 +157,39 @@ template<class T> class DualQuaternion: public Dual<Quaternion<T>> {
             return {q, Quaternion<T>(matrix.translation()/2)*q};
         }
 
+        /**
+         * @brief Convert dual quaternions to transformation matrices
+         * @param dualQuaternions   Normalized dual quaternions
+         * @param out               Where to put the matrices
+         *
+         * Batch version of @ref toMatrix(), saves the matrix of each item of
+         * @p dualQuaternions into @p out. The rotation part and translation
+         * share the products of quaternion components, so it is cheaper than
+         * calling @ref toMatrix() in a loop. Expects that both views have
+         * the same size.
+         */
+        static void toMatrices(Corrade::Containers::ArrayView<const DualQuaternion<T>> dualQuaternions, Corrade::Containers::ArrayView<Matrix4<T>> out);
+
+        /**
+         * @brief Compose a chain of transformations
+         * @param transformations       Normalized dual quaternions
+         * @param out                   Where to put the composed chain
+         * @param normalizationInterval How often to renormalize the result
+         *
+         * The first item of @p out is the first item of @p transformations,
+         * each following item is the previous item of @p out multiplied by
+         * the corresponding item of @p transformations. Composition of
+         * normalized dual quaternions adds rounding error in the order of
+         * @ref TypeTraits::epsilon() with each step, so instead of calling
+         * @ref normalized() after each multiplication, the result is
+         * renormalized only after every @p normalizationInterval
+         * compositions, keeping the drift bounded by roughly
+         * @p normalizationInterval times the epsilon. Value of @cpp 1 @ce
+         * normalizes after every composition, @cpp 0 @ce never. Expects that
+         * both views have the same size.
+         */
+        static void composeChain(Corrade::Containers::ArrayView<const DualQuaternion<T>> transformations, Corrade::Containers::ArrayView<DualQuaternion<T>> out, std::size_t normalizationInterval);
+
         /**
          * @brief Default constructor
          *
@@ -446,6 +479,47 @@ template<class T> Corrade::Utility::Debug& operator<<(Corrade::Utility::Debug& d
         << value.dual().scalar() << Corrade::Utility::Debug::nospace << "})";
 }
 
+template<class T> void DualQuaternion<T>::toMatrices(const Corrade::Containers::ArrayView<const DualQuaternion<T>> dualQuaternions, const Corrade::Containers::ArrayView<Matrix4<T>> out) {
+    CORRADE_ASSERT(out.size() == dualQuaternions.size(),
+        "Math::DualQuaternion::toMatrices(): expected views of the same size", );
+
+    for(std::size_t i = 0; i != dualQuaternions.size(); ++i) {
+        const Vector3<T> v = dualQuaternions[i].real().vector();
+        const T w = dualQuaternions[i].real().scalar();
+        const Vector3<T> dv = dualQuaternions[i].dual().vector();
+        const T dw = dualQuaternions[i].dual().scalar();
+
+        const T xx = v.x()*v.x(), yy = v.y()*v.y(), zz = v.z()*v.z();
+        const T xy = v.x()*v.y(), xz = v.x()*v.z(), yz = v.y()*v.z();
+        const T xw = v.x()*w, yw = v.y()*w, zw = v.z()*w;
+
+        /* Same as translation(), with the quaternion product expanded */
+        const Vector3<T> translation = T(2)*(w*dv - dw*v + cross(v, dv));
+
+        out[i] = {
+            {T(1) - 2*(yy + zz), 2*(xy + zw), 2*(xz - yw), T(0)},
+            {2*(xy - zw), T(1) - 2*(xx + zz), 2*(yz + xw), T(0)},
+            {2*(xz + yw), 2*(yz - xw), T(1) - 2*(xx + yy), T(0)},
+            {translation, T(1)}};
+    }
+}
+
+template<class T> void DualQuaternion<T>::composeChain(const Corrade::Containers::ArrayView<const DualQuaternion<T>> transformations, const Corrade::Containers::ArrayView<DualQuaternion<T>> out, const std::size_t normalizationInterval) {
+    CORRADE_ASSERT(out.size() == transformations.size(),
+        "Math::DualQuaternion::composeChain(): expected views of the same size", );
+    if(transformations.empty()) return;
+
+    out[0] = transformations[0];
+    std::size_t compositions = 0;
+    for(std::size_t i = 1; i != transformations.size(); ++i) {
+        out[i] = out[i - 1]*transformations[i];
+        if(normalizationInterval && ++compositions == normalizationInterval) {
+            out[i] = out[i].normalized();
+            compositions = 0;
+        }
+    }
+}
+
 /* Explicit instantiation for commonly used types */
 #ifndef DOXYGEN_GENERATING_OUTPUT
 extern template MAGNUM_EXPORT Corrade::Utility::Debug& operator<<(Corrade::Utility::Debug&, const DualQuaternion<Float>&);
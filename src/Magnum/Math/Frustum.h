@@ -0,0 +1,157 @@
+#ifndef Magnum_Math_Frustum_h
+#define Magnum_Math_Frustum_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Math::Frustum
+ */
+
+#include "Magnum/Math/Matrix4.h"
+
+namespace Magnum { namespace Math {
+
+/**
+@brief Camera frustum
+
+Six normalized planes in order left, right, bottom, top, near and far, each
+stored as a @ref Vector4 with normal pointing inside the frustum in the
+first three components and distance from origin in the last, so a point
+@f$ \boldsymbol p @f$ is inside the frustum if @f[
+    \forall i: \boldsymbol n_i \cdot \boldsymbol p + d_i \ge 0
+@f]
+Usually created from a combined projection and view matrix using
+@ref fromMatrix(), the planes are then in world space. Intersection tests
+are in @ref Geometry::Intersection.
+@see @ref Magnum::Frustum, @ref Magnum::Frustumd
+*/
+template<class T> class Frustum {
+    public:
+        /**
+         * @brief Create frustum from projection matrix
+         *
+         * Extracts the planes from rows of the matrix and normalizes them.
+         * Passing a combined projection and view matrix gives planes in world
+         * space, passing just the projection matrix gives planes in camera
+         * space.
+         */
+        static Frustum<T> fromMatrix(const Matrix4<T>& matrix) {
+            const Vector4<T> w = matrix.row(3);
+            return Frustum<T>{w + matrix.row(0), w - matrix.row(0),
+                              w + matrix.row(1), w - matrix.row(1),
+                              w + matrix.row(2), w - matrix.row(2)}.normalized();
+        }
+
+        /**
+         * @brief Default constructor
+         *
+         * Frustum of an identity projection, i.e. a cube from
+         * @f$ (-1, -1, -1) @f$ to @f$ (1, 1, 1) @f$.
+         */
+        constexpr /*implicit*/ Frustum() noexcept: _data{
+            { T(1), T(0), T(0), T(1)},
+            {-T(1), T(0), T(0), T(1)},
+            { T(0), T(1), T(0), T(1)},
+            { T(0), -T(1), T(0), T(1)},
+            { T(0), T(0), T(1), T(1)},
+            { T(0), T(0), -T(1), T(1)}} {}
+
+        /**
+         * @brief Construct from planes
+         *
+         * The planes are expected to point inside the frustum, they're not
+         * normalized.
+         * @see @ref normalized()
+         */
+        constexpr explicit Frustum(const Vector4<T>& left, const Vector4<T>& right, const Vector4<T>& bottom, const Vector4<T>& top, const Vector4<T>& near, const Vector4<T>& far) noexcept: _data{left, right, bottom, top, near, far} {}
+
+        /** @brief Equality comparison */
+        bool operator==(const Frustum<T>& other) const {
+            for(std::size_t i = 0; i != 6; ++i)
+                if(_data[i] != other._data[i]) return false;
+            return true;
+        }
+
+        /** @brief Non-equality comparison */
+        bool operator!=(const Frustum<T>& other) const {
+            return !operator==(other);
+        }
+
+        /**
+         * @brief All planes
+         *
+         * Can be passed directly to the functions in
+         * @ref Geometry::Intersection taking the planes as an array.
+         */
+        const Vector4<T>(&planes() const)[6] { return _data; }
+
+        /** @brief Plane at given position */
+        Vector4<T>& operator[](std::size_t i) { return _data[i]; }
+        constexpr const Vector4<T>& operator[](std::size_t i) const { return _data[i]; } /**< @overload */
+
+        /** @brief Left plane */
+        constexpr const Vector4<T>& left() const { return _data[0]; }
+
+        /** @brief Right plane */
+        constexpr const Vector4<T>& right() const { return _data[1]; }
+
+        /** @brief Bottom plane */
+        constexpr const Vector4<T>& bottom() const { return _data[2]; }
+
+        /** @brief Top plane */
+        constexpr const Vector4<T>& top() const { return _data[3]; }
+
+        /** @brief Near plane */
+        constexpr const Vector4<T>& near() const { return _data[4]; }
+
+        /** @brief Far plane */
+        constexpr const Vector4<T>& far() const { return _data[5]; }
+
+        /**
+         * @brief Frustum with normalized planes
+         *
+         * Divides each plane by length of its normal.
+         */
+        Frustum<T> normalized() const {
+            Frustum<T> out{*this};
+            for(Vector4<T>& plane: out._data) plane /= plane.xyz().length();
+            return out;
+        }
+
+    private:
+        Vector4<T> _data[6];
+};
+
+/** @debugoperator{Magnum::Math::Frustum} */
+template<class T> Corrade::Utility::Debug& operator<<(Corrade::Utility::Debug& debug, const Frustum<T>& value) {
+    debug << "Frustum(" << Corrade::Utility::Debug::nospace << value[0];
+    for(std::size_t i = 1; i != 6; ++i)
+        debug << Corrade::Utility::Debug::nospace << "," << value[i];
+    return debug << Corrade::Utility::Debug::nospace << ")";
+}
+
+}}
+
+#endif
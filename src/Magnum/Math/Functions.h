@@ -33,9 +33,11 @@
 #include <limits>
 #include <type_traits>
 #include <utility>
+#include <Corrade/Containers/ArrayView.h>
 
 #include "Magnum/visibility.h"
 #include "Magnum/Math/Vector.h"
+#include "Magnum/Math/Implementation/FastMath.h"
 
 namespace Magnum { namespace Math {
 
@@ -595,6 +597,198 @@ template<class Integral, class FloatingPoint> inline typename std::enable_if<std
 
 /*@}*/
 
+/**
+@brief Fast approximate functions
+
+Opt-in replacements for @ref Math::sin(), @ref Math::cos(),
+@ref Math::sincos(), @ref Math::sqrtInverted(), @ref Math::exp() and
+@ref Math::log(), meant for per-vertex or per-particle loops where the
+precision of the standard library isn't needed. The functions are
+implemented with bit manipulation and short polynomials, can be inlined and
+don't touch `errno`. Available for @ref Magnum::Float "Float" and
+@ref Magnum::Double "Double", maximal errors measured for each are listed
+below. Apart from @ref exp(), none of the functions handle NaN, infinity or
+denormal inputs.
+
+Function                | Input range                   | Max error (Float)                 | Max error (Double)
+----------------------- | ----------------------------- | --------------------------------- | ------------------
+@ref sin(), @ref cos()  | @f$ [-1000; 1000] @f$ radians | @f$ 3 \cdot 10^{-7} @f$ absolute | @f$ 7 \cdot 10^{-10} @f$ absolute
+@ref sqrtInverted()     | positive normal numbers       | @f$ 5 \cdot 10^{-6} @f$ relative | @f$ 4 \cdot 10^{-11} @f$ relative
+@ref exp()              | whole range, saturates to zero or infinity | @f$ 2 \cdot 10^{-7} @f$ relative | @f$ 8 \cdot 10^{-9} @f$ relative
+@ref log()              | positive normal numbers       | @f$ 2 \cdot 10^{-7} @f$ absolute, relative for results outside of @f$ [-1; 1] @f$ | @f$ 8 \cdot 10^{-10} @f$ absolute, relative outside of @f$ [-1; 1] @f$
+
+Every function has a batch overload operating on array views, which is
+easier for the compiler to vectorize. The fast inverse square root is also
+available through @ref Vector::normalized(FastMathT) const. See
+`Math/Test/FunctionsBenchmark.cpp` for a comparison with the standard
+functions.
+*/
+namespace Fast {
+
+/**
+@brief Fast sine
+
+@see @ref Math::sin(), @ref sincos()
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T> inline T sin(Rad<T> angle);
+#else
+template<class T> inline T sin(Unit<Rad, T> angle) { return Implementation::fastSin(T(angle)); }
+template<class T> inline T sin(Unit<Deg, T> angle) { return Fast::sin(Rad<T>(angle)); }
+#endif
+
+/**
+@brief Fast cosine
+
+@see @ref Math::cos(), @ref sincos()
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T> inline T cos(Rad<T> angle);
+#else
+template<class T> inline T cos(Unit<Rad, T> angle) { return Implementation::fastCos(T(angle)); }
+template<class T> inline T cos(Unit<Deg, T> angle) { return Fast::cos(Rad<T>(angle)); }
+#endif
+
+/**
+@brief Fast sine and cosine
+
+Does the range reduction only once for both values.
+@see @ref Math::sincos()
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T> inline std::pair<T, T> sincos(Rad<T> angle);
+#else
+template<class T> inline std::pair<T, T> sincos(Unit<Rad, T> angle) {
+    T reduced = T(angle);
+    const T sign = Implementation::fastReduceAngle(reduced);
+    return {Implementation::fastSinReduced(reduced), sign*Implementation::fastCosReduced(reduced)};
+}
+template<class T> inline std::pair<T, T> sincos(Unit<Deg, T> angle) { return Fast::sincos(Rad<T>(angle)); }
+#endif
+
+/**
+@brief Fast inverse square root
+
+@see @ref Math::sqrtInverted(), @ref Vector::lengthInverted(FastMathT) const
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T> inline T sqrtInverted(const T& a);
+#else
+template<class T> inline typename std::enable_if<std::is_floating_point<T>::value, T>::type sqrtInverted(T a) {
+    return Implementation::fastSqrtInverted(a);
+}
+template<std::size_t size, class T> Vector<size, T> sqrtInverted(const Vector<size, T>& a) {
+    Vector<size, T> out{NoInit};
+    for(std::size_t i = 0; i != size; ++i)
+        out[i] = Implementation::fastSqrtInverted(a[i]);
+    return out;
+}
+#endif
+
+/**
+@brief Fast natural exponential
+
+@see @ref Math::exp()
+*/
+template<class T> inline T exp(T exponent) { return Implementation::fastExp(exponent); }
+
+/**
+@brief Fast natural logarithm
+
+@see @ref Math::log(T)
+*/
+template<class T> inline T log(T number) { return Implementation::fastLog(number); }
+
+/**
+@brief Fast sine of an array of angles
+
+Calls @ref sin(Rad<T>) on each item of @p angles and saves the results into
+@p out. Expects that both views have the same size.
+*/
+template<class T> void sin(const Corrade::Containers::ArrayView<const Rad<T>> angles, const Corrade::Containers::ArrayView<T> out) {
+    CORRADE_ASSERT(out.size() == angles.size(),
+        "Math::Fast::sin(): expected views of the same size", );
+
+    for(std::size_t i = 0; i != angles.size(); ++i)
+        out[i] = Implementation::fastSin(T(angles[i]));
+}
+
+/**
+@brief Fast cosine of an array of angles
+
+Calls @ref cos(Rad<T>) on each item of @p angles and saves the results into
+@p out. Expects that both views have the same size.
+*/
+template<class T> void cos(const Corrade::Containers::ArrayView<const Rad<T>> angles, const Corrade::Containers::ArrayView<T> out) {
+    CORRADE_ASSERT(out.size() == angles.size(),
+        "Math::Fast::cos(): expected views of the same size", );
+
+    for(std::size_t i = 0; i != angles.size(); ++i)
+        out[i] = Implementation::fastCos(T(angles[i]));
+}
+
+/**
+@brief Fast sine and cosine of an array of angles
+
+Calls @ref sincos(Rad<T>) on each item of @p angles and saves the results
+into @p sin and @p cos. Expects that all views have the same size.
+*/
+template<class T> void sincos(const Corrade::Containers::ArrayView<const Rad<T>> angles, const Corrade::Containers::ArrayView<T> sin, const Corrade::Containers::ArrayView<T> cos) {
+    CORRADE_ASSERT(sin.size() == angles.size() && cos.size() == angles.size(),
+        "Math::Fast::sincos(): expected views of the same size", );
+
+    for(std::size_t i = 0; i != angles.size(); ++i) {
+        T reduced = T(angles[i]);
+        const T sign = Implementation::fastReduceAngle(reduced);
+        sin[i] = Implementation::fastSinReduced(reduced);
+        cos[i] = sign*Implementation::fastCosReduced(reduced);
+    }
+}
+
+/**
+@brief Fast inverse square root of an array of values
+
+Calls @ref sqrtInverted(T) on each item of @p values and saves the results
+into @p out. Expects that both views have the same size.
+*/
+template<class T> void sqrtInverted(const Corrade::Containers::ArrayView<const T> values, const Corrade::Containers::ArrayView<T> out) {
+    CORRADE_ASSERT(out.size() == values.size(),
+        "Math::Fast::sqrtInverted(): expected views of the same size", );
+
+    for(std::size_t i = 0; i != values.size(); ++i)
+        out[i] = Implementation::fastSqrtInverted(values[i]);
+}
+
+/**
+@brief Fast natural exponential of an array of values
+
+Calls @ref exp(T) on each item of @p exponents and saves the results into
+@p out. Expects that both views have the same size.
+*/
+template<class T> void exp(const Corrade::Containers::ArrayView<const T> exponents, const Corrade::Containers::ArrayView<T> out) {
+    CORRADE_ASSERT(out.size() == exponents.size(),
+        "Math::Fast::exp(): expected views of the same size", );
+
+    for(std::size_t i = 0; i != exponents.size(); ++i)
+        out[i] = Implementation::fastExp(exponents[i]);
+}
+
+/**
+@brief Fast natural logarithm of an array of values
+
+Calls @ref log(T) on each item of @p numbers and saves the results into
+@p out. Expects that both views have the same size.
+*/
+template<class T> void log(const Corrade::Containers::ArrayView<const T> numbers, const Corrade::Containers::ArrayView<T> out) {
+    CORRADE_ASSERT(out.size() == numbers.size(),
+        "Math::Fast::log(): expected views of the same size", );
+
+    for(std::size_t i = 0; i != numbers.size(); ++i)
+        out[i] = Implementation::fastLog(numbers[i]);
+}
+
+}
+
 }}
 
 #endif
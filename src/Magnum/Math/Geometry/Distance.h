@@ -29,8 +29,11 @@
  * @brief Class @ref Magnum::Math::Geometry::Distance
  */
 
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
 #include "Magnum/Math/Functions.h"
-#include "Magnum/Math/Vector3.h"
+#include "Magnum/Math/Vector4.h"
 
 namespace Magnum { namespace Math { namespace Geometry {
 
@@ -162,6 +165,119 @@ class Distance {
          * the square root.
          */
         template<class T> static T lineSegmentPointSquared(const Vector3<T>& a, const Vector3<T>& b, const Vector3<T>& point);
+
+        /**
+         * @brief Distance of points from line segment in 3D
+         * @param a         Starting point of the line
+         * @param b         Ending point of the line
+         * @param points    Points
+         * @param out       Where to put the distances
+         *
+         * Batch version of @ref lineSegmentPoint(const Vector3<T>&, const Vector3<T>&, const Vector3<T>&),
+         * saves distance of each item of @p points into @p out. The segment
+         * is preprocessed only once and the closest point is found by
+         * clamping instead of branching. If the library is built with
+         * `BUILD_SIMD` and SSE2 or NEON instructions are enabled on the
+         * compiler command line, four @ref Magnum::Float "Float" points are
+         * processed at once. Expects that both views have the same size.
+         * @see @ref lineSegmentPointSquared(const Vector3<T>&, const Vector3<T>&, Corrade::Containers::ArrayView<const Vector3<T>>, Corrade::Containers::ArrayView<T>)
+         */
+        template<class T> static void lineSegmentPoint(const Vector3<T>& a, const Vector3<T>& b, Corrade::Containers::ArrayView<const Vector3<T>> points, Corrade::Containers::ArrayView<T> out);
+
+        /**
+         * @brief Distance of points from line segment in 3D, squared
+         *
+         * More efficient than
+         * @ref lineSegmentPoint(const Vector3<T>&, const Vector3<T>&, Corrade::Containers::ArrayView<const Vector3<T>>, Corrade::Containers::ArrayView<T>)
+         * for comparing distances with other values, because it doesn't
+         * compute the square root.
+         */
+        template<class T> static void lineSegmentPointSquared(const Vector3<T>& a, const Vector3<T>& b, Corrade::Containers::ArrayView<const Vector3<T>> points, Corrade::Containers::ArrayView<T> out);
+
+        /**
+         * @brief Signed distance of point from plane
+         * @param point     Point
+         * @param plane     Plane equation
+         *
+         * The @p plane is expected to be in the form @f$ (\boldsymbol n, d) @f$
+         * with normalized normal **n**, the same as returned by
+         * @ref Frustum::fromMatrix(). The distance is positive in direction
+         * of the normal: @f[
+         *      d_p = \boldsymbol n \cdot \boldsymbol p + d
+         * @f]
+         */
+        template<class T> static T pointPlane(const Vector3<T>& point, const Vector4<T>& plane) {
+            return dot(plane.xyz(), point) + plane.w();
+        }
+
+        /**
+         * @brief Signed distance of points from plane
+         * @param points    Points
+         * @param plane     Plane equation
+         * @param out       Where to put the distances
+         *
+         * Batch version of @ref pointPlane(const Vector3<T>&, const Vector4<T>&),
+         * saves distance of each item of @p points into @p out. If the
+         * library is built with `BUILD_SIMD` and SSE2 or NEON instructions
+         * are enabled on the compiler command line, four
+         * @ref Magnum::Float "Float" points are processed at once. Expects
+         * that both views have the same size.
+         */
+        template<class T> static void pointPlane(Corrade::Containers::ArrayView<const Vector3<T>> points, const Vector4<T>& plane, Corrade::Containers::ArrayView<T> out);
+
+        /**
+         * @brief Distance of point from triangle
+         * @param a         First vertex of the triangle
+         * @param b         Second vertex of the triangle
+         * @param c         Third vertex of the triangle
+         * @param point     Point
+         *
+         * Finds the closest point on the triangle by classifying @p point
+         * against the Voronoi regions of triangle vertices and edges and
+         * returns its distance from @p point.
+         *
+         * Source: Christer Ericson --- Real-Time Collision Detection, section
+         * 5.1.5.
+         * @see @ref trianglePointSquared(const Vector3<T>&, const Vector3<T>&, const Vector3<T>&, const Vector3<T>&)
+         */
+        template<class T> static T trianglePoint(const Vector3<T>& a, const Vector3<T>& b, const Vector3<T>& c, const Vector3<T>& point) {
+            return std::sqrt(trianglePointSquared(a, b, c, point));
+        }
+
+        /**
+         * @brief Distance of point from triangle, squared
+         *
+         * More efficient than
+         * @ref trianglePoint(const Vector3<T>&, const Vector3<T>&, const Vector3<T>&, const Vector3<T>&)
+         * for comparing distance with other values, because it doesn't
+         * compute the square root.
+         */
+        template<class T> static T trianglePointSquared(const Vector3<T>& a, const Vector3<T>& b, const Vector3<T>& c, const Vector3<T>& point);
+
+        /**
+         * @brief Distance of points from triangle
+         * @param a         First vertex of the triangle
+         * @param b         Second vertex of the triangle
+         * @param c         Third vertex of the triangle
+         * @param points    Points
+         * @param out       Where to put the distances
+         *
+         * Batch version of @ref trianglePoint(const Vector3<T>&, const Vector3<T>&, const Vector3<T>&, const Vector3<T>&),
+         * saves distance of each item of @p points into @p out. Expects that
+         * both views have the same size.
+         * @see @ref trianglePointSquared(const Vector3<T>&, const Vector3<T>&, const Vector3<T>&, Corrade::Containers::ArrayView<const Vector3<T>>, Corrade::Containers::ArrayView<T>)
+         */
+        template<class T> static void trianglePoint(const Vector3<T>& a, const Vector3<T>& b, const Vector3<T>& c, Corrade::Containers::ArrayView<const Vector3<T>> points, Corrade::Containers::ArrayView<T> out);
+
+        /**
+         * @brief Distance of points from triangle, squared
+         *
+         * More efficient than
+         * @ref trianglePoint(const Vector3<T>&, const Vector3<T>&, const Vector3<T>&, Corrade::Containers::ArrayView<const Vector3<T>>, Corrade::Containers::ArrayView<T>)
+         * for comparing distances with other values, because it doesn't
+         * compute the square root.
+         */
+        template<class T> static void trianglePointSquared(const Vector3<T>& a, const Vector3<T>& b, const Vector3<T>& c, Corrade::Containers::ArrayView<const Vector3<T>> points, Corrade::Containers::ArrayView<T> out);
 };
 
 template<class T> T Distance::lineSegmentPoint(const Vector2<T>& a, const Vector2<T>& b, const Vector2<T>& point) {
@@ -223,6 +339,122 @@ template<class T> T Distance::lineSegmentPointSquared(const Vector3<T>& a, const
     return cross(pointMinusA, pointMinusB).dot()/bDistanceA;
 }
 
+
+namespace Implementation {
+
+template<class T> void lineSegmentPointSquared(const Vector3<T>& a, const Vector3<T>& b, const Corrade::Containers::ArrayView<const Vector3<T>> points, const Corrade::Containers::ArrayView<T> out) {
+    const Vector3<T> ab = b - a;
+    const T abDot = ab.dot();
+    const T abInvDot = abDot == T(0) ? T(0) : T(1)/abDot;
+    for(std::size_t i = 0; i != points.size(); ++i) {
+        const Vector3<T> d = points[i] - a;
+        const T t = Math::clamp(dot(d, ab)*abInvDot, T(0), T(1));
+        out[i] = (d - t*ab).dot();
+    }
+}
+
+template<class T> void pointPlane(const Corrade::Containers::ArrayView<const Vector3<T>> points, const Vector4<T>& plane, const Corrade::Containers::ArrayView<T> out) {
+    for(std::size_t i = 0; i != points.size(); ++i)
+        out[i] = dot(plane.xyz(), points[i]) + plane.w();
+}
+
+#ifdef MAGNUM_MATH_SIMD
+static_assert(sizeof(Vector3<float>) == 3*sizeof(float), "improper size of Vector3");
+
+inline void lineSegmentPointSquared(const Vector3<float>& a, const Vector3<float>& b, const Corrade::Containers::ArrayView<const Vector3<float>> points, const Corrade::Containers::ArrayView<float> out) {
+    const Vector3<float> ab = b - a;
+    const float abDot = ab.dot();
+    const float abInvDot = abDot == 0.0f ? 0.0f : 1.0f/abDot;
+    std::size_t i = 0;
+    for(; i + 4 <= points.size(); i += 4)
+        Math::Implementation::simdLineSegmentPointSquared4(points[i].data(), a.data(), ab.data(), abInvDot, out + i);
+    lineSegmentPointSquared<float>(a, b, points.suffix(i), out.suffix(i));
+}
+
+inline void pointPlane(const Corrade::Containers::ArrayView<const Vector3<float>> points, const Vector4<float>& plane, const Corrade::Containers::ArrayView<float> out) {
+    std::size_t i = 0;
+    for(; i + 4 <= points.size(); i += 4)
+        Math::Implementation::simdPointPlane4(points[i].data(), plane.data(), out + i);
+    pointPlane<float>(points.suffix(i), plane, out.suffix(i));
+}
+#endif
+
+}
+
+template<class T> void Distance::lineSegmentPoint(const Vector3<T>& a, const Vector3<T>& b, const Corrade::Containers::ArrayView<const Vector3<T>> points, const Corrade::Containers::ArrayView<T> out) {
+    lineSegmentPointSquared(a, b, points, out);
+    for(T& distance: out) distance = std::sqrt(distance);
+}
+
+template<class T> void Distance::lineSegmentPointSquared(const Vector3<T>& a, const Vector3<T>& b, const Corrade::Containers::ArrayView<const Vector3<T>> points, const Corrade::Containers::ArrayView<T> out) {
+    CORRADE_ASSERT(out.size() == points.size(),
+        "Math::Geometry::Distance::lineSegmentPointSquared(): expected views of the same size", );
+    Implementation::lineSegmentPointSquared(a, b, points, out);
+}
+
+template<class T> void Distance::pointPlane(const Corrade::Containers::ArrayView<const Vector3<T>> points, const Vector4<T>& plane, const Corrade::Containers::ArrayView<T> out) {
+    CORRADE_ASSERT(out.size() == points.size(),
+        "Math::Geometry::Distance::pointPlane(): expected views of the same size", );
+    Implementation::pointPlane(points, plane, out);
+}
+
+template<class T> T Distance::trianglePointSquared(const Vector3<T>& a, const Vector3<T>& b, const Vector3<T>& c, const Vector3<T>& point) {
+    const Vector3<T> ab = b - a;
+    const Vector3<T> ac = c - a;
+
+    /* Vertex region of A */
+    const Vector3<T> ap = point - a;
+    const T d1 = dot(ab, ap);
+    const T d2 = dot(ac, ap);
+    if(d1 <= T(0) && d2 <= T(0))
+        return ap.dot();
+
+    /* Vertex region of B */
+    const Vector3<T> bp = point - b;
+    const T d3 = dot(ab, bp);
+    const T d4 = dot(ac, bp);
+    if(d3 >= T(0) && d4 <= d3)
+        return bp.dot();
+
+    /* Edge region of AB */
+    const T vc = d1*d4 - d3*d2;
+    if(vc <= T(0) && d1 >= T(0) && d3 <= T(0))
+        return (ap - ab*(d1/(d1 - d3))).dot();
+
+    /* Vertex region of C */
+    const Vector3<T> cp = point - c;
+    const T d5 = dot(ab, cp);
+    const T d6 = dot(ac, cp);
+    if(d6 >= T(0) && d5 <= d6)
+        return cp.dot();
+
+    /* Edge region of AC */
+    const T vb = d5*d2 - d1*d6;
+    if(vb <= T(0) && d2 >= T(0) && d6 <= T(0))
+        return (ap - ac*(d2/(d2 - d6))).dot();
+
+    /* Edge region of BC */
+    const T va = d3*d6 - d5*d4;
+    if(va <= T(0) && d4 - d3 >= T(0) && d5 - d6 >= T(0))
+        return (bp - (c - b)*((d4 - d3)/((d4 - d3) + (d5 - d6)))).dot();
+
+    /* Inside the face, project using barycentric coordinates */
+    const T denominator = T(1)/(va + vb + vc);
+    return (ap - ab*(vb*denominator) - ac*(vc*denominator)).dot();
+}
+
+template<class T> void Distance::trianglePoint(const Vector3<T>& a, const Vector3<T>& b, const Vector3<T>& c, const Corrade::Containers::ArrayView<const Vector3<T>> points, const Corrade::Containers::ArrayView<T> out) {
+    trianglePointSquared(a, b, c, points, out);
+    for(T& distance: out) distance = std::sqrt(distance);
+}
+
+template<class T> void Distance::trianglePointSquared(const Vector3<T>& a, const Vector3<T>& b, const Vector3<T>& c, const Corrade::Containers::ArrayView<const Vector3<T>> points, const Corrade::Containers::ArrayView<T> out) {
+    CORRADE_ASSERT(out.size() == points.size(),
+        "Math::Geometry::Distance::trianglePointSquared(): expected views of the same size", );
+    for(std::size_t i = 0; i != points.size(); ++i)
+        out[i] = trianglePointSquared(a, b, c, points[i]);
+}
+
 }}}
 
 #endif
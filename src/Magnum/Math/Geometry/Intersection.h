@@ -29,7 +29,14 @@
  * @brief Class @ref Magnum::Math::Geometry::Intersection
  */
 
-#include "Magnum/Math/Vector3.h"
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/BitArray.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector4.h"
 
 namespace Magnum { namespace Math { namespace Geometry {
 
@@ -123,8 +130,455 @@ class Intersection {
             const T f = dot(planePosition, planeNormal);
             return (f-dot(planeNormal, p))/dot(planeNormal, r);
         }
+
+        /**
+         * @brief Intersection of a ray and an axis-aligned box
+         * @param p             Starting point of the ray
+         * @param r             Direction of the ray
+         * @param min           Minimal box corner
+         * @param max           Maximal box corner
+         * @return Intersection point position `t` on the ray, `0` if the
+         *      ray starts inside the box or infinity if the intersection
+         *      doesn't exist. Intersection point can be then computed with
+         *      `p + t*r`. If @p r is normalized, `t` is the distance from
+         *      @p p.
+         *
+         * Uses the slab method -- the ray is clipped by each pair of
+         * parallel box faces and the intersection exists if the resulting
+         * range @f$ [ t_{near} ; t_{far} ] @f$ is not empty and not behind
+         * the ray start: @f[
+         *      t_{near} = \max_i \min \left( \frac{min_i - p_i}{r_i}, \frac{max_i - p_i}{r_i} \right) \qquad
+         *      t_{far} = \min_i \max \left( \frac{min_i - p_i}{r_i}, \frac{max_i - p_i}{r_i} \right)
+         * @f]
+         */
+        template<std::size_t size, class T> static T rayAabb(const Vector<size, T>& p, const Vector<size, T>& r, const Vector<size, T>& min, const Vector<size, T>& max);
+
+        /**
+         * @brief Intersection of a ray and a sphere
+         * @param p             Starting point of the ray
+         * @param r             Direction of the ray
+         * @param center        Sphere center
+         * @param radius        Sphere radius
+         * @return Intersection point position `t` on the ray, `0` if the
+         *      ray starts inside the sphere or infinity if the intersection
+         *      doesn't exist. See @ref rayAabb() for more information.
+         *
+         * The smaller root of the quadratic equation @f[
+         *      |\boldsymbol p + t \boldsymbol r - \boldsymbol c|^2 = R^2
+         * @f]
+         */
+        template<std::size_t size, class T> static T raySphere(const Vector<size, T>& p, const Vector<size, T>& r, const Vector<size, T>& center, T radius);
+
+        /**
+         * @brief Intersection of a ray and a capsule
+         * @param p             Starting point of the ray
+         * @param r             Direction of the ray
+         * @param a             Start point of capsule axis
+         * @param b             End point of capsule axis
+         * @param radius        Capsule radius
+         * @return Intersection point position `t` on the ray, `0` if the
+         *      ray starts inside the capsule or infinity if the intersection
+         *      doesn't exist. See @ref rayAabb() for more information.
+         *
+         * The capsule is an union of a cylinder around the axis segment and
+         * two spheres at its ends, so the first intersection is the nearest
+         * of the cylinder side intersection and the two
+         * @ref raySphere() "sphere intersections".
+         */
+        template<std::size_t size, class T> static T rayCapsule(const Vector<size, T>& p, const Vector<size, T>& r, const Vector<size, T>& a, const Vector<size, T>& b, T radius);
+
+        /**
+         * @brief Intersection of a ray and a triangle
+         * @param p             Starting point of the ray
+         * @param r             Direction of the ray
+         * @param a             First triangle vertex
+         * @param b             Second triangle vertex
+         * @param c             Third triangle vertex
+         * @return Intersection point position `t` on the ray or infinity if
+         *      the intersection doesn't exist or the ray lies in the triangle
+         *      plane. See @ref rayAabb() for more information.
+         *
+         * Both sides of the triangle are hit. Uses the Möller–Trumbore
+         * algorithm, which solves for `t` and barycentric coordinates
+         * @f$ u, v @f$ at once: @f[
+         *      \boldsymbol p + t \boldsymbol r = (1 - u - v) \boldsymbol a + u \boldsymbol b + v \boldsymbol c
+         * @f]
+         * The intersection lies inside the triangle if @f$ u \ge 0 @f$,
+         * @f$ v \ge 0 @f$ and @f$ u + v \le 1 @f$.
+         */
+        template<class T> static T rayTriangle(const Vector3<T>& p, const Vector3<T>& r, const Vector3<T>& a, const Vector3<T>& b, const Vector3<T>& c);
+
+        /**
+         * @brief Intersection of a sphere and a frustum
+         * @param center        Sphere center
+         * @param radius        Sphere radius
+         * @param frustum       Frustum planes in order left, right, bottom,
+         *      top, near and far. The planes are expected to be normalized
+         *      and pointing inside the frustum.
+         * @return `true` if the sphere intersects the frustum or is inside
+         *      it, `false` otherwise
+         *
+         * The sphere is outside of the frustum if it lies completely on the
+         * outer side of any of the frustum planes: @f[
+         *      \boldsymbol n \cdot \boldsymbol c + d < -r
+         * @f]
+         * The test is conservative -- spheres near frustum corners might be
+         * reported as intersecting even though they are outside.
+         * @see @ref aabbFrustum()
+         */
+        template<class T> static bool sphereFrustum(const Vector3<T>& center, T radius, const Vector4<T>(&frustum)[6]) {
+            for(const Vector4<T>& plane: frustum)
+                if(dot(plane.xyz(), center) + plane.w() < -radius) return false;
+            return true;
+        }
+
+        /**
+         * @brief Intersection of multiple spheres and a frustum
+         * @param centers       Sphere centers
+         * @param radii         Sphere radii
+         * @param frustum       Frustum planes, see
+         *      @ref sphereFrustum(const Vector3<T>&, T, const Vector4<T>(&)[6])
+         *      for details
+         * @param[out] visible  Whether given sphere intersects the frustum or
+         *      is inside it
+         * @return Count of visible spheres
+         *
+         * Equivalent to calling the single-sphere variant on each item, but
+         * the planes are iterated in the outer loop and the inner loop is
+         * branchless, which allows the compiler to vectorize it. All views are
+         * expected to have the same size.
+         */
+        template<class T> static std::size_t sphereFrustum(Corrade::Containers::ArrayView<const Vector3<T>> centers, Corrade::Containers::ArrayView<const T> radii, const Vector4<T>(&frustum)[6], Corrade::Containers::ArrayView<bool> visible);
+
+        /**
+         * @brief Intersection of an axis-aligned box and a frustum
+         * @param center        Box center
+         * @param extent        Box half-size
+         * @param frustum       Frustum planes, see
+         *      @ref sphereFrustum(const Vector3<T>&, T, const Vector4<T>(&)[6])
+         *      for details
+         * @return `true` if the box intersects the frustum or is inside it,
+         *      `false` otherwise
+         *
+         * The box is outside of the frustum if it lies completely on the
+         * outer side of any of the frustum planes, i.e. its vertex nearest to
+         * the plane is outside: @f[
+         *      \boldsymbol n \cdot \boldsymbol c + d < -|\boldsymbol n| \cdot \boldsymbol e
+         * @f]
+         * Same as with @ref sphereFrustum() the test is conservative.
+         */
+        template<class T> static bool aabbFrustum(const Vector3<T>& center, const Vector3<T>& extent, const Vector4<T>(&frustum)[6]) {
+            for(const Vector4<T>& plane: frustum)
+                if(dot(plane.xyz(), center) + plane.w() < -dot(Math::abs(plane.xyz()), extent)) return false;
+            return true;
+        }
+
+        /**
+         * @brief Intersection of multiple axis-aligned boxes and a frustum
+         * @param centers       Box centers
+         * @param extents       Box half-sizes
+         * @param frustum       Frustum planes, see
+         *      @ref sphereFrustum(const Vector3<T>&, T, const Vector4<T>(&)[6])
+         *      for details
+         * @param[out] visible  Whether given box intersects the frustum or is
+         *      inside it
+         * @return Count of visible boxes
+         *
+         * Batched version of @ref aabbFrustum(const Vector3<T>&, const Vector3<T>&, const Vector4<T>(&)[6]),
+         * see @ref sphereFrustum(Corrade::Containers::ArrayView<const Vector3<T>>, Corrade::Containers::ArrayView<const T>, const Vector4<T>(&)[6], Corrade::Containers::ArrayView<bool>)
+         * for more information.
+         */
+        template<class T> static std::size_t aabbFrustum(Corrade::Containers::ArrayView<const Vector3<T>> centers, Corrade::Containers::ArrayView<const Vector3<T>> extents, const Vector4<T>(&frustum)[6], Corrade::Containers::ArrayView<bool> visible);
+
+        /**
+         * @brief Intersection of a point and a frustum
+         * @return `true` if the point is inside the frustum, `false`
+         *      otherwise
+         *
+         * The point is outside if it's on the outer side of any of the
+         * frustum planes.
+         */
+        template<class T> static bool pointFrustum(const Vector3<T>& point, const Frustum<T>& frustum) {
+            for(const Vector4<T>& plane: frustum.planes())
+                if(dot(plane.xyz(), point) + plane.w() < T(0)) return false;
+            return true;
+        }
+
+        /**
+         * @brief Intersection of a sphere and a frustum
+         *
+         * Same as @ref sphereFrustum(const Vector3<T>&, T, const Vector4<T>(&)[6]).
+         */
+        template<class T> static bool sphereFrustum(const Vector3<T>& center, T radius, const Frustum<T>& frustum) {
+            return sphereFrustum(center, radius, frustum.planes());
+        }
+
+        /**
+         * @brief Intersection of an axis-aligned box and a frustum
+         *
+         * Same as @ref aabbFrustum(const Vector3<T>&, const Vector3<T>&, const Vector4<T>(&)[6]).
+         */
+        template<class T> static bool aabbFrustum(const Vector3<T>& center, const Vector3<T>& extent, const Frustum<T>& frustum) {
+            return aabbFrustum(center, extent, frustum.planes());
+        }
+
+        /**
+         * @brief Intersection of multiple points and a frustum
+         * @param x             Point X coordinates
+         * @param y             Point Y coordinates
+         * @param z             Point Z coordinates
+         * @param frustum       Frustum
+         * @param[out] visible  Bits set for points inside the frustum
+         * @return Count of points inside the frustum
+         *
+         * Batched version of @ref pointFrustum(const Vector3<T>&, const Frustum<T>&)
+         * operating on structure-of-arrays data. The objects are processed in
+         * blocks of @ref BitArray::WordBits, each block is tested against one
+         * plane after another in a branchless loop, which allows the compiler
+         * to vectorize it, and the results are written to @p visible a whole
+         * word at a time. All views and @p visible are expected to have the
+         * same size.
+         */
+        template<class T> static std::size_t pointFrustum(Corrade::Containers::ArrayView<const T> x, Corrade::Containers::ArrayView<const T> y, Corrade::Containers::ArrayView<const T> z, const Frustum<T>& frustum, BitArray& visible);
+
+        /**
+         * @brief Intersection of multiple spheres and a frustum
+         * @param x             Sphere center X coordinates
+         * @param y             Sphere center Y coordinates
+         * @param z             Sphere center Z coordinates
+         * @param radii         Sphere radii
+         * @param frustum       Frustum
+         * @param[out] visible  Bits set for spheres intersecting the
+         *      frustum or inside it
+         * @param[out] intersecting If not `nullptr`, bits set for visible
+         *      spheres which intersect any of the frustum planes, i.e. are
+         *      not fully inside
+         * @return Count of visible spheres
+         *
+         * Batched version of @ref sphereFrustum(const Vector3<T>&, T, const Frustum<T>&),
+         * see @ref pointFrustum(Corrade::Containers::ArrayView<const T>, Corrade::Containers::ArrayView<const T>, Corrade::Containers::ArrayView<const T>, const Frustum<T>&, BitArray&)
+         * for more information. The @p intersecting bits can be used to skip
+         * the tests for contents of objects that are fully inside. If
+         * specified, it's expected to have the same size as @p visible.
+         */
+        template<class T> static std::size_t sphereFrustum(Corrade::Containers::ArrayView<const T> x, Corrade::Containers::ArrayView<const T> y, Corrade::Containers::ArrayView<const T> z, Corrade::Containers::ArrayView<const T> radii, const Frustum<T>& frustum, BitArray& visible, BitArray* intersecting = nullptr);
+
+        /**
+         * @brief Intersection of multiple axis-aligned boxes and a frustum
+         * @param x             Box center X coordinates
+         * @param y             Box center Y coordinates
+         * @param z             Box center Z coordinates
+         * @param extentX       Box half-sizes in X
+         * @param extentY       Box half-sizes in Y
+         * @param extentZ       Box half-sizes in Z
+         * @param frustum       Frustum
+         * @param[out] visible  Bits set for boxes intersecting the frustum
+         *      or inside it
+         * @param[out] intersecting If not `nullptr`, bits set for visible
+         *      boxes which intersect any of the frustum planes
+         * @return Count of visible boxes
+         *
+         * Batched version of @ref aabbFrustum(const Vector3<T>&, const Vector3<T>&, const Frustum<T>&),
+         * see @ref sphereFrustum(Corrade::Containers::ArrayView<const T>, Corrade::Containers::ArrayView<const T>, Corrade::Containers::ArrayView<const T>, Corrade::Containers::ArrayView<const T>, const Frustum<T>&, BitArray&, BitArray*)
+         * for more information.
+         */
+        template<class T> static std::size_t aabbFrustum(Corrade::Containers::ArrayView<const T> x, Corrade::Containers::ArrayView<const T> y, Corrade::Containers::ArrayView<const T> z, Corrade::Containers::ArrayView<const T> extentX, Corrade::Containers::ArrayView<const T> extentY, Corrade::Containers::ArrayView<const T> extentZ, const Frustum<T>& frustum, BitArray& visible, BitArray* intersecting = nullptr);
+
+    private:
+        template<class T, class F> static std::size_t classifyFrustum(std::size_t count, const Frustum<T>& frustum, F distanceRadius, BitArray& visible, BitArray* intersecting);
 };
 
+template<std::size_t size, class T> T Intersection::rayAabb(const Vector<size, T>& p, const Vector<size, T>& r, const Vector<size, T>& min, const Vector<size, T>& max) {
+    T near{}, far = Constants<T>::inf();
+    for(std::size_t i = 0; i != size; ++i) {
+        /* Parallel to the slab, either always inside or never */
+        if(r[i] == T(0)) {
+            if(p[i] < min[i] || p[i] > max[i]) return Constants<T>::inf();
+            continue;
+        }
+
+        const T inverse = T(1)/r[i];
+        const std::pair<T, T> t = Math::minmax((min[i] - p[i])*inverse, (max[i] - p[i])*inverse);
+        near = Math::max(near, t.first);
+        far = Math::min(far, t.second);
+        if(near > far) return Constants<T>::inf();
+    }
+
+    return near;
+}
+
+template<std::size_t size, class T> T Intersection::raySphere(const Vector<size, T>& p, const Vector<size, T>& r, const Vector<size, T>& center, const T radius) {
+    const Vector<size, T> m = p - center;
+    const T c = m.dot() - radius*radius;
+
+    /* Starting inside */
+    if(c <= T(0)) return T(0);
+
+    /* Outside and pointing away */
+    const T b = dot(m, r);
+    if(b >= T(0)) return Constants<T>::inf();
+
+    const T a = r.dot();
+    const T discriminant = b*b - a*c;
+    if(discriminant < T(0)) return Constants<T>::inf();
+
+    return (-b - std::sqrt(discriminant))/a;
+}
+
+template<std::size_t size, class T> T Intersection::rayCapsule(const Vector<size, T>& p, const Vector<size, T>& r, const Vector<size, T>& a, const Vector<size, T>& b, const T radius) {
+    T t = Math::min(raySphere(p, r, a, radius), raySphere(p, r, b, radius));
+    if(t == T(0)) return t;
+
+    /* Infinite cylinder around the axis, components perpendicular to the
+       axis are computed implicitly by subtracting the projections */
+    const Vector<size, T> d = b - a;
+    const Vector<size, T> m = p - a;
+    const T dd = d.dot();
+
+    /* Degenerate capsule is just a sphere */
+    if(dd == T(0)) return t;
+
+    const T md = dot(m, d);
+    const T rd = dot(r, d);
+    const T qa = dd*r.dot() - rd*rd;
+    const T qb = dd*dot(m, r) - md*rd;
+    const T qc = dd*m.dot() - md*md - radius*radius*dd;
+
+    /* Starting inside the cylinder part */
+    if(qc <= T(0) && md >= T(0) && md <= dd) return T(0);
+
+    /* Ray parallel to the axis hits only the spheres */
+    if(qa == T(0)) return t;
+
+    const T discriminant = qb*qb - qa*qc;
+    if(discriminant < T(0)) return t;
+
+    /* Count the intersection only if it's between the end spheres */
+    const T cylinder = (-qb - std::sqrt(discriminant))/qa;
+    const T s = md + cylinder*rd;
+    if(cylinder >= T(0) && s >= T(0) && s <= dd) t = Math::min(t, cylinder);
+    return t;
+}
+
+template<class T> T Intersection::rayTriangle(const Vector3<T>& p, const Vector3<T>& r, const Vector3<T>& a, const Vector3<T>& b, const Vector3<T>& c) {
+    const Vector3<T> ab = b - a;
+    const Vector3<T> ac = c - a;
+    const Vector3<T> q = cross(r, ac);
+    const T determinant = dot(ab, q);
+
+    /* Ray parallel to the triangle plane */
+    if(determinant == T(0)) return Constants<T>::inf();
+
+    const T inverse = T(1)/determinant;
+    const Vector3<T> s = p - a;
+    const T u = dot(s, q)*inverse;
+    if(u < T(0) || u > T(1)) return Constants<T>::inf();
+
+    const Vector3<T> n = cross(s, ab);
+    const T v = dot(r, n)*inverse;
+    if(v < T(0) || u + v > T(1)) return Constants<T>::inf();
+
+    const T t = dot(ac, n)*inverse;
+    return t >= T(0) ? t : Constants<T>::inf();
+}
+
+template<class T> std::size_t Intersection::sphereFrustum(Corrade::Containers::ArrayView<const Vector3<T>> centers, Corrade::Containers::ArrayView<const T> radii, const Vector4<T>(&frustum)[6], Corrade::Containers::ArrayView<bool> visible) {
+    CORRADE_ASSERT(centers.size() == radii.size() && centers.size() == visible.size(),
+        "Math::Geometry::Intersection::sphereFrustum(): expected views of the same size", {});
+
+    for(bool& v: visible) v = true;
+
+    for(const Vector4<T>& plane: frustum) {
+        const T a = plane.x(), b = plane.y(), c = plane.z(), d = plane.w();
+        for(std::size_t i = 0; i != centers.size(); ++i)
+            visible[i] = visible[i] & (a*centers[i].x() + b*centers[i].y() + c*centers[i].z() + d >= -radii[i]);
+    }
+
+    std::size_t count = 0;
+    for(bool v: visible) count += v;
+    return count;
+}
+
+template<class T> std::size_t Intersection::aabbFrustum(Corrade::Containers::ArrayView<const Vector3<T>> centers, Corrade::Containers::ArrayView<const Vector3<T>> extents, const Vector4<T>(&frustum)[6], Corrade::Containers::ArrayView<bool> visible) {
+    CORRADE_ASSERT(centers.size() == extents.size() && centers.size() == visible.size(),
+        "Math::Geometry::Intersection::aabbFrustum(): expected views of the same size", {});
+
+    for(bool& v: visible) v = true;
+
+    for(const Vector4<T>& plane: frustum) {
+        const T a = plane.x(), b = plane.y(), c = plane.z(), d = plane.w();
+        const T absA = std::abs(a), absB = std::abs(b), absC = std::abs(c);
+        for(std::size_t i = 0; i != centers.size(); ++i)
+            visible[i] = visible[i] & (a*centers[i].x() + b*centers[i].y() + c*centers[i].z() + d >= -(absA*extents[i].x() + absB*extents[i].y() + absC*extents[i].z()));
+    }
+
+    std::size_t count = 0;
+    for(bool v: visible) count += v;
+    return count;
+}
+
+template<class T, class F> std::size_t Intersection::classifyFrustum(const std::size_t count, const Frustum<T>& frustum, F distanceRadius, BitArray& visible, BitArray* const intersecting) {
+    std::size_t visibleCount = 0;
+    for(std::size_t begin = 0; begin < count; begin += BitArray::WordBits) {
+        const std::size_t size = Math::min(count - begin, std::size_t(BitArray::WordBits));
+        bool inside[BitArray::WordBits], crossing[BitArray::WordBits];
+        for(std::size_t i = 0; i != size; ++i) {
+            inside[i] = true;
+            crossing[i] = false;
+        }
+
+        for(const Vector4<T>& plane: frustum.planes()) {
+            for(std::size_t i = 0; i != size; ++i) {
+                const std::pair<T, T> dr = distanceRadius(plane, begin + i);
+                inside[i] = inside[i] & (dr.first >= -dr.second);
+                crossing[i] = crossing[i] | (dr.first < dr.second);
+            }
+        }
+
+        UnsignedLong visibleWord{}, intersectingWord{};
+        for(std::size_t i = 0; i != size; ++i) {
+            visibleWord |= UnsignedLong(inside[i]) << i;
+            intersectingWord |= UnsignedLong(inside[i] & crossing[i]) << i;
+            visibleCount += inside[i];
+        }
+
+        visible.data()[begin/BitArray::WordBits] = visibleWord;
+        if(intersecting) intersecting->data()[begin/BitArray::WordBits] = intersectingWord;
+    }
+
+    return visibleCount;
+}
+
+template<class T> std::size_t Intersection::pointFrustum(Corrade::Containers::ArrayView<const T> x, Corrade::Containers::ArrayView<const T> y, Corrade::Containers::ArrayView<const T> z, const Frustum<T>& frustum, BitArray& visible) {
+    CORRADE_ASSERT(x.size() == y.size() && x.size() == z.size() && x.size() == visible.size(),
+        "Math::Geometry::Intersection::pointFrustum(): expected views of the same size", {});
+
+    return classifyFrustum(x.size(), frustum, [&](const Vector4<T>& plane, std::size_t i) {
+        return std::make_pair(plane.x()*x[i] + plane.y()*y[i] + plane.z()*z[i] + plane.w(), T(0));
+    }, visible, nullptr);
+}
+
+template<class T> std::size_t Intersection::sphereFrustum(Corrade::Containers::ArrayView<const T> x, Corrade::Containers::ArrayView<const T> y, Corrade::Containers::ArrayView<const T> z, Corrade::Containers::ArrayView<const T> radii, const Frustum<T>& frustum, BitArray& visible, BitArray* const intersecting) {
+    CORRADE_ASSERT(x.size() == y.size() && x.size() == z.size() && x.size() == radii.size() && x.size() == visible.size() && (!intersecting || intersecting->size() == visible.size()),
+        "Math::Geometry::Intersection::sphereFrustum(): expected views of the same size", {});
+
+    return classifyFrustum(x.size(), frustum, [&](const Vector4<T>& plane, std::size_t i) {
+        return std::make_pair(plane.x()*x[i] + plane.y()*y[i] + plane.z()*z[i] + plane.w(), radii[i]);
+    }, visible, intersecting);
+}
+
+template<class T> std::size_t Intersection::aabbFrustum(Corrade::Containers::ArrayView<const T> x, Corrade::Containers::ArrayView<const T> y, Corrade::Containers::ArrayView<const T> z, Corrade::Containers::ArrayView<const T> extentX, Corrade::Containers::ArrayView<const T> extentY, Corrade::Containers::ArrayView<const T> extentZ, const Frustum<T>& frustum, BitArray& visible, BitArray* const intersecting) {
+    CORRADE_ASSERT(x.size() == y.size() && x.size() == z.size() && x.size() == extentX.size() && x.size() == extentY.size() && x.size() == extentZ.size() && x.size() == visible.size() && (!intersecting || intersecting->size() == visible.size()),
+        "Math::Geometry::Intersection::aabbFrustum(): expected views of the same size", {});
+
+    /* Projected radius of the box is the distance of its vertex nearest to
+       the plane from the center */
+    return classifyFrustum(x.size(), frustum, [&](const Vector4<T>& plane, std::size_t i) {
+        return std::make_pair(plane.x()*x[i] + plane.y()*y[i] + plane.z()*z[i] + plane.w(),
+            std::abs(plane.x())*extentX[i] + std::abs(plane.y())*extentY[i] + std::abs(plane.z())*extentZ[i]);
+    }, visible, intersecting);
+}
+
 }}}
 
 #endif
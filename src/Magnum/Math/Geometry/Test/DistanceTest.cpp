@@ -37,17 +37,28 @@ struct DistanceTest: Corrade::TestSuite::Tester {
     void linePoint3D();
     void lineSegmentPoint2D();
     void lineSegmentPoint3D();
+    void lineSegmentPointBatch();
+    void pointPlane();
+    void pointPlaneBatch();
+    void trianglePoint();
+    void trianglePointBatch();
 };
 
 typedef Math::Vector2<Float> Vector2;
 typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector4<Float> Vector4;
 typedef Math::Constants<Float> Constants;
 
 DistanceTest::DistanceTest() {
     addTests({&DistanceTest::linePoint2D,
               &DistanceTest::linePoint3D,
               &DistanceTest::lineSegmentPoint2D,
-              &DistanceTest::lineSegmentPoint3D});
+              &DistanceTest::lineSegmentPoint3D,
+              &DistanceTest::lineSegmentPointBatch,
+              &DistanceTest::pointPlane,
+              &DistanceTest::pointPlaneBatch,
+              &DistanceTest::trianglePoint,
+              &DistanceTest::trianglePointBatch});
 }
 
 void DistanceTest::linePoint2D() {
@@ -156,6 +167,102 @@ void DistanceTest::lineSegmentPoint3D() {
                     Constants::sqrt2());
 }
 
+void DistanceTest::lineSegmentPointBatch() {
+    const Vector3 a{0.0f};
+    const Vector3 b{1.0f};
+    /* More than four to test both the SIMD and the remainder path */
+    const Vector3 points[]{
+        Vector3{0.25f},
+        Vector3{-1.0f},
+        Vector3{1.0f + 1.0f/Constants::sqrt3()},
+        {1.0f, 0.0f, 1.0f},
+        Vector3{1.0f, 0.0f, 1.0f} + Vector3{100.0f},
+        {3.0f, 0.5f, -2.0f}
+    };
+    Float squared[6];
+    Float distances[6];
+
+    Distance::lineSegmentPointSquared<Float>(a, b, points, squared);
+    Distance::lineSegmentPoint<Float>(a, b, points, distances);
+    for(std::size_t i = 0; i != 6; ++i) {
+        CORRADE_COMPARE(squared[i], Distance::lineSegmentPointSquared(a, b, points[i]));
+        CORRADE_COMPARE(distances[i], Distance::lineSegmentPoint(a, b, points[i]));
+    }
+
+    /* Degenerate segment is the distance from its only point */
+    Distance::lineSegmentPointSquared<Float>(b, b, points, squared);
+    for(std::size_t i = 0; i != 6; ++i)
+        CORRADE_COMPARE(squared[i], (points[i] - b).dot());
+}
+
+void DistanceTest::pointPlane() {
+    const Vector4 plane{0.0f, 0.6f, 0.8f, -1.0f};
+
+    CORRADE_COMPARE(Distance::pointPlane({5.0f, 3.0f, 4.0f}, plane), 4.0f);
+    CORRADE_COMPARE(Distance::pointPlane({-2.0f, 0.6f, 0.8f}, plane), 0.0f);
+    CORRADE_COMPARE(Distance::pointPlane(Vector3{0.0f}, plane), -1.0f);
+}
+
+void DistanceTest::pointPlaneBatch() {
+    const Vector4 plane{0.0f, 0.6f, 0.8f, -1.0f};
+    const Vector3 points[]{
+        {5.0f, 3.0f, 4.0f},
+        {-2.0f, 0.6f, 0.8f},
+        Vector3{0.0f},
+        {1.0f, -3.0f, -4.0f},
+        {0.0f, 0.0f, 10.0f}
+    };
+    Float distances[5];
+
+    Distance::pointPlane<Float>(points, plane, distances);
+    CORRADE_COMPARE(distances[0], 4.0f);
+    CORRADE_COMPARE(distances[1], 0.0f);
+    CORRADE_COMPARE(distances[2], -1.0f);
+    CORRADE_COMPARE(distances[3], -6.0f);
+    CORRADE_COMPARE(distances[4], 7.0f);
+}
+
+void DistanceTest::trianglePoint() {
+    const Vector3 a{0.0f, 0.0f, 0.0f};
+    const Vector3 b{2.0f, 0.0f, 0.0f};
+    const Vector3 c{0.0f, 2.0f, 0.0f};
+
+    /* Above the face */
+    CORRADE_COMPARE(Distance::trianglePoint(a, b, c, {0.5f, 0.5f, 3.0f}), 3.0f);
+    CORRADE_COMPARE(Distance::trianglePoint(a, b, c, {0.5f, 0.5f, 0.0f}), 0.0f);
+
+    /* Vertex regions */
+    CORRADE_COMPARE(Distance::trianglePointSquared(a, b, c, {-1.0f, -1.0f, 1.0f}), 3.0f);
+    CORRADE_COMPARE(Distance::trianglePoint(a, b, c, {3.0f, 0.0f, 0.0f}), 1.0f);
+    CORRADE_COMPARE(Distance::trianglePoint(a, b, c, {0.0f, 3.0f, 0.0f}), 1.0f);
+
+    /* Edge regions */
+    CORRADE_COMPARE(Distance::trianglePoint(a, b, c, {1.0f, -1.0f, 0.0f}), 1.0f);
+    CORRADE_COMPARE(Distance::trianglePoint(a, b, c, {-1.0f, 1.0f, 0.0f}), 1.0f);
+    CORRADE_COMPARE(Distance::trianglePoint(a, b, c, {2.0f, 2.0f, 0.0f}), Constants::sqrt2());
+}
+
+void DistanceTest::trianglePointBatch() {
+    const Vector3 a{0.0f, 0.0f, 0.0f};
+    const Vector3 b{2.0f, 0.0f, 0.0f};
+    const Vector3 c{0.0f, 2.0f, 0.0f};
+    const Vector3 points[]{
+        {0.5f, 0.5f, 3.0f},
+        {-1.0f, -1.0f, 1.0f},
+        {1.0f, -1.0f, 0.0f},
+        {2.0f, 2.0f, 0.0f}
+    };
+    Float squared[4];
+    Float distances[4];
+
+    Distance::trianglePointSquared<Float>(a, b, c, points, squared);
+    Distance::trianglePoint<Float>(a, b, c, points, distances);
+    for(std::size_t i = 0; i != 4; ++i) {
+        CORRADE_COMPARE(squared[i], Distance::trianglePointSquared(a, b, c, points[i]));
+        CORRADE_COMPARE(distances[i], Distance::trianglePoint(a, b, c, points[i]));
+    }
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Geometry::Test::DistanceTest)
@@ -34,15 +34,40 @@ struct IntersectionTest: Corrade::TestSuite::Tester {
 
     void planeLine();
     void lineLine();
+    void rayAabb();
+    void raySphere();
+    void rayCapsule();
+    void rayTriangle();
+    void sphereFrustum();
+    void sphereFrustumBatch();
+    void aabbFrustum();
+    void aabbFrustumBatch();
+    void pointFrustum();
+    void pointFrustumBatch();
+    void sphereFrustumBatchSoa();
+    void aabbFrustumBatchSoa();
 };
 
 typedef Math::Vector2<Float> Vector2;
 typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector4<Float> Vector4;
 typedef Math::Constants<Float> Constants;
 
 IntersectionTest::IntersectionTest() {
     addTests({&IntersectionTest::planeLine,
-              &IntersectionTest::lineLine});
+              &IntersectionTest::lineLine,
+              &IntersectionTest::rayAabb,
+              &IntersectionTest::raySphere,
+              &IntersectionTest::rayCapsule,
+              &IntersectionTest::rayTriangle,
+              &IntersectionTest::sphereFrustum,
+              &IntersectionTest::sphereFrustumBatch,
+              &IntersectionTest::aabbFrustum,
+              &IntersectionTest::aabbFrustumBatch,
+              &IntersectionTest::pointFrustum,
+              &IntersectionTest::pointFrustumBatch,
+              &IntersectionTest::sphereFrustumBatchSoa,
+              &IntersectionTest::aabbFrustumBatchSoa});
 }
 
 void IntersectionTest::planeLine() {
@@ -97,6 +122,226 @@ void IntersectionTest::lineLine() {
         {0.0f, 0.0f}, {1.0f, 2.0f}), Constants::inf());
 }
 
+namespace {
+    /* Unit cube, i.e. identity projection */
+    const Vector4 frustum[]{
+        { 1.0f,  0.0f,  0.0f, 1.0f},
+        {-1.0f,  0.0f,  0.0f, 1.0f},
+        { 0.0f,  1.0f,  0.0f, 1.0f},
+        { 0.0f, -1.0f,  0.0f, 1.0f},
+        { 0.0f,  0.0f,  1.0f, 1.0f},
+        { 0.0f,  0.0f, -1.0f, 1.0f}
+    };
+}
+
+void IntersectionTest::rayAabb() {
+    const Vector3 min{-1.0f, -2.0f, -3.0f};
+    const Vector3 max{1.0f, 2.0f, 3.0f};
+
+    /* Hit from outside */
+    CORRADE_COMPARE(Intersection::rayAabb({-3.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, min, max), 2.0f);
+    CORRADE_COMPARE(Intersection::rayAabb({3.0f, 4.0f, 0.0f}, {-1.0f, -1.0f, 0.0f}, min, max), 2.0f);
+
+    /* Starting inside */
+    CORRADE_COMPARE(Intersection::rayAabb({0.5f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, min, max), 0.0f);
+
+    /* Pointing away, missing, parallel outside the slab */
+    CORRADE_COMPARE(Intersection::rayAabb({-3.0f, 0.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}, min, max), Constants::inf());
+    CORRADE_COMPARE(Intersection::rayAabb({-3.0f, 0.0f, 0.0f}, {1.0f, 2.0f, 0.0f}, min, max), Constants::inf());
+    CORRADE_COMPARE(Intersection::rayAabb({-3.0f, 2.5f, 0.0f}, {1.0f, 0.0f, 0.0f}, min, max), Constants::inf());
+
+    /* 2D */
+    CORRADE_COMPARE(Intersection::rayAabb(Vector2{0.0f, -5.0f}, Vector2{0.0f, 2.0f}, Vector2{-1.0f}, Vector2{1.0f}), 2.0f);
+}
+
+void IntersectionTest::raySphere() {
+    const Vector3 center{1.0f, 2.0f, 3.0f};
+
+    /* Hit from outside, with non-normalized direction */
+    CORRADE_COMPARE(Intersection::raySphere({1.0f, 2.0f, -2.0f}, {0.0f, 0.0f, 1.0f}, center, 2.0f), 3.0f);
+    CORRADE_COMPARE(Intersection::raySphere({1.0f, 2.0f, -2.0f}, {0.0f, 0.0f, 2.0f}, center, 2.0f), 1.5f);
+
+    /* Tangent */
+    CORRADE_COMPARE(Intersection::raySphere({3.0f, 2.0f, -2.0f}, {0.0f, 0.0f, 1.0f}, center, 2.0f), 5.0f);
+
+    /* Starting inside */
+    CORRADE_COMPARE(Intersection::raySphere({1.0f, 2.5f, 3.0f}, {0.0f, 0.0f, 1.0f}, center, 2.0f), 0.0f);
+
+    /* Pointing away, missing */
+    CORRADE_COMPARE(Intersection::raySphere({1.0f, 2.0f, -2.0f}, {0.0f, 0.0f, -1.0f}, center, 2.0f), Constants::inf());
+    CORRADE_COMPARE(Intersection::raySphere({3.5f, 2.0f, -2.0f}, {0.0f, 0.0f, 1.0f}, center, 2.0f), Constants::inf());
+
+    /* 2D */
+    CORRADE_COMPARE(Intersection::raySphere(Vector2{-5.0f, 0.0f}, Vector2{1.0f, 0.0f}, Vector2{}, 1.0f), 4.0f);
+}
+
+void IntersectionTest::rayCapsule() {
+    const Vector3 a{0.0f, -2.0f, 0.0f};
+    const Vector3 b{0.0f, 2.0f, 0.0f};
+
+    /* Hitting the cylinder part */
+    CORRADE_COMPARE(Intersection::rayCapsule({-5.0f, 1.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, a, b, 1.0f), 4.0f);
+
+    /* Hitting the cap from the top and from the side */
+    CORRADE_COMPARE(Intersection::rayCapsule({0.0f, 5.0f, 0.0f}, {0.0f, -1.0f, 0.0f}, a, b, 1.0f), 2.0f);
+    CORRADE_COMPARE(Intersection::rayCapsule({-5.0f, 2.5f, 0.0f}, {1.0f, 0.0f, 0.0f}, a, b, 1.0f), 5.0f - std::sqrt(0.75f));
+
+    /* Starting inside the cylinder part */
+    CORRADE_COMPARE(Intersection::rayCapsule({0.5f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, a, b, 1.0f), 0.0f);
+
+    /* Missing beyond the caps, parallel outside */
+    CORRADE_COMPARE(Intersection::rayCapsule({-5.0f, 3.5f, 0.0f}, {1.0f, 0.0f, 0.0f}, a, b, 1.0f), Constants::inf());
+    CORRADE_COMPARE(Intersection::rayCapsule({1.5f, 5.0f, 0.0f}, {0.0f, -1.0f, 0.0f}, a, b, 1.0f), Constants::inf());
+
+    /* Degenerate capsule */
+    CORRADE_COMPARE(Intersection::rayCapsule({-5.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, Vector3{}, Vector3{}, 1.0f), 4.0f);
+}
+
+void IntersectionTest::rayTriangle() {
+    const Vector3 a{-1.0f, -1.0f, 2.0f};
+    const Vector3 b{1.0f, -1.0f, 2.0f};
+    const Vector3 c{0.0f, 1.0f, 2.0f};
+
+    /* Hit from both sides */
+    CORRADE_COMPARE(Intersection::rayTriangle({0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, a, b, c), 2.0f);
+    CORRADE_COMPARE(Intersection::rayTriangle({0.0f, 0.0f, 5.0f}, {0.0f, 0.0f, -1.0f}, a, b, c), 3.0f);
+
+    /* Outside of the triangle, behind the ray, in the triangle plane */
+    CORRADE_COMPARE(Intersection::rayTriangle({0.9f, 0.9f, 0.0f}, {0.0f, 0.0f, 1.0f}, a, b, c), Constants::inf());
+    CORRADE_COMPARE(Intersection::rayTriangle({0.0f, 0.0f, 3.0f}, {0.0f, 0.0f, 1.0f}, a, b, c), Constants::inf());
+    CORRADE_COMPARE(Intersection::rayTriangle({-5.0f, 0.0f, 2.0f}, {1.0f, 0.0f, 0.0f}, a, b, c), Constants::inf());
+}
+
+void IntersectionTest::sphereFrustum() {
+    /* Inside */
+    CORRADE_VERIFY(Intersection::sphereFrustum({0.5f, 0.0f, -0.5f}, 0.1f, frustum));
+
+    /* Intersecting */
+    CORRADE_VERIFY(Intersection::sphereFrustum({1.5f, 0.0f, 0.0f}, 0.6f, frustum));
+
+    /* Outside */
+    CORRADE_VERIFY(!Intersection::sphereFrustum({0.0f, -1.5f, 0.0f}, 0.4f, frustum));
+    CORRADE_VERIFY(!Intersection::sphereFrustum({0.0f, 0.0f, 3.0f}, 1.5f, frustum));
+}
+
+void IntersectionTest::sphereFrustumBatch() {
+    const Vector3 centers[]{
+        {0.5f, 0.0f, -0.5f},
+        {1.5f, 0.0f, 0.0f},
+        {0.0f, -1.5f, 0.0f},
+        {0.0f, 0.0f, 3.0f}
+    };
+    const Float radii[]{0.1f, 0.6f, 0.4f, 1.5f};
+    bool visible[4];
+
+    CORRADE_COMPARE(Intersection::sphereFrustum<Float>(centers, radii, frustum, visible), 2);
+    CORRADE_VERIFY(visible[0]);
+    CORRADE_VERIFY(visible[1]);
+    CORRADE_VERIFY(!visible[2]);
+    CORRADE_VERIFY(!visible[3]);
+}
+
+void IntersectionTest::aabbFrustum() {
+    /* Inside */
+    CORRADE_VERIFY(Intersection::aabbFrustum({0.5f, 0.0f, -0.5f}, Vector3{0.1f}, frustum));
+
+    /* Intersecting */
+    CORRADE_VERIFY(Intersection::aabbFrustum({1.5f, 0.0f, 0.0f}, {0.6f, 0.1f, 0.1f}, frustum));
+
+    /* Outside */
+    CORRADE_VERIFY(!Intersection::aabbFrustum({1.5f, 0.0f, 0.0f}, {0.4f, 5.0f, 5.0f}, frustum));
+}
+
+void IntersectionTest::aabbFrustumBatch() {
+    const Vector3 centers[]{
+        {0.5f, 0.0f, -0.5f},
+        {1.5f, 0.0f, 0.0f},
+        {1.5f, 0.0f, 0.0f}
+    };
+    const Vector3 extents[]{
+        Vector3{0.1f},
+        {0.6f, 0.1f, 0.1f},
+        {0.4f, 5.0f, 5.0f}
+    };
+    bool visible[3];
+
+    CORRADE_COMPARE(Intersection::aabbFrustum<Float>(centers, extents, frustum, visible), 2);
+    CORRADE_VERIFY(visible[0]);
+    CORRADE_VERIFY(visible[1]);
+    CORRADE_VERIFY(!visible[2]);
+}
+
+void IntersectionTest::pointFrustum() {
+    const Math::Frustum<Float> frustum;
+
+    /* Inside, on the boundary */
+    CORRADE_VERIFY(Intersection::pointFrustum({0.5f, 0.0f, -0.5f}, frustum));
+    CORRADE_VERIFY(Intersection::pointFrustum({1.0f, 1.0f, 1.0f}, frustum));
+
+    /* Outside */
+    CORRADE_VERIFY(!Intersection::pointFrustum({0.0f, 1.5f, 0.0f}, frustum));
+    CORRADE_VERIFY(!Intersection::pointFrustum({0.0f, 0.0f, -1.1f}, frustum));
+}
+
+void IntersectionTest::pointFrustumBatch() {
+    const Float x[]{0.5f, 1.0f, 0.0f, 0.0f, -2.0f};
+    const Float y[]{0.0f, 1.0f, 1.5f, 0.0f, 0.0f};
+    const Float z[]{-0.5f, 1.0f, 0.0f, -1.1f, 0.0f};
+    BitArray visible{5};
+
+    CORRADE_COMPARE(Intersection::pointFrustum<Float>(x, y, z, Math::Frustum<Float>{}, visible), 2);
+    CORRADE_VERIFY(visible[0]);
+    CORRADE_VERIFY(visible[1]);
+    CORRADE_VERIFY(!visible[2]);
+    CORRADE_VERIFY(!visible[3]);
+    CORRADE_VERIFY(!visible[4]);
+}
+
+void IntersectionTest::sphereFrustumBatchSoa() {
+    /* More than one word of output, every third sphere is outside, every
+       fifth is crossing the right plane */
+    constexpr std::size_t count = 150;
+    Float x[count], y[count], z[count], radii[count];
+    for(std::size_t i = 0; i != count; ++i) {
+        x[i] = i % 5 == 0 ? 0.9f : 0.0f;
+        y[i] = i % 3 == 0 ? -1.5f : 0.0f;
+        z[i] = -0.5f;
+        radii[i] = 0.2f;
+    }
+    BitArray visible{count}, intersecting{count};
+
+    const std::size_t visibleCount = Intersection::sphereFrustum<Float>(x, y, z, radii, Math::Frustum<Float>{}, visible, &intersecting);
+    CORRADE_COMPARE(visibleCount, 100);
+    CORRADE_COMPARE(visible.count(), 100);
+    for(std::size_t i = 0; i != count; ++i) {
+        CORRADE_COMPARE(visible[i], i % 3 != 0);
+        CORRADE_COMPARE(intersecting[i], i % 3 != 0 && i % 5 == 0);
+    }
+
+    /* Passing only the visibility mask gives the same result */
+    BitArray visible2{count};
+    CORRADE_COMPARE(Intersection::sphereFrustum<Float>(x, y, z, radii, Math::Frustum<Float>{}, visible2), 100);
+    CORRADE_COMPARE(visible2, visible);
+}
+
+void IntersectionTest::aabbFrustumBatchSoa() {
+    const Float x[]{0.5f, 1.5f, 1.5f};
+    const Float y[]{0.0f, 0.0f, 0.0f};
+    const Float z[]{-0.5f, 0.0f, 0.0f};
+    const Float extentX[]{0.1f, 0.6f, 0.4f};
+    const Float extentY[]{0.1f, 0.1f, 5.0f};
+    const Float extentZ[]{0.1f, 0.1f, 5.0f};
+    BitArray visible{3}, intersecting{3};
+
+    CORRADE_COMPARE(Intersection::aabbFrustum<Float>(x, y, z, extentX, extentY, extentZ, Math::Frustum<Float>{}, visible, &intersecting), 2);
+    CORRADE_VERIFY(visible[0]);
+    CORRADE_VERIFY(visible[1]);
+    CORRADE_VERIFY(!visible[2]);
+    CORRADE_VERIFY(!intersecting[0]);
+    CORRADE_VERIFY(intersecting[1]);
+    CORRADE_VERIFY(!intersecting[2]);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Geometry::Test::IntersectionTest)
@@ -0,0 +1,171 @@
+#ifndef Magnum_Math_Implementation_FastMath_h
+#define Magnum_Math_Implementation_FastMath_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <cstdint>
+#include <cstring>
+
+#include "Magnum/Types.h"
+
+/* Scalar kernels for Math::Fast and Vector::normalized(FastMathT). Kept
+   separate from Functions.h so Vector.h can use them without pulling in
+   the rest of the function library. None of these check for NaN,
+   infinity or denormals, see the documentation of Math::Fast for the
+   supported input ranges and the error bounds. */
+
+namespace Magnum { namespace Math { namespace Implementation {
+
+/* Bit-casting done through memcpy to stay within strict aliasing rules,
+   compilers turn that into a plain register move */
+inline UnsignedInt fastBits(const Float value) {
+    UnsignedInt bits;
+    std::memcpy(&bits, &value, sizeof(Float));
+    return bits;
+}
+inline std::uint64_t fastBits(const Double value) {
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(Double));
+    return bits;
+}
+inline Float fastFloat(const UnsignedInt bits) {
+    Float value;
+    std::memcpy(&value, &bits, sizeof(Float));
+    return value;
+}
+inline Double fastDouble(const std::uint64_t bits) {
+    Double value;
+    std::memcpy(&value, &bits, sizeof(Double));
+    return value;
+}
+
+/* Bit-level initial estimate refined with Newton-Raphson iterations, each
+   of them roughly squares the relative error. Two iterations for floats
+   give 4.7e-6, three iterations for doubles give 3.2e-11. */
+inline Float fastSqrtInverted(const Float value) {
+    const Float half = value*0.5f;
+    Float y = fastFloat(0x5f3759dfu - (fastBits(value) >> 1));
+    y *= 1.5f - half*y*y;
+    y *= 1.5f - half*y*y;
+    return y;
+}
+inline Double fastSqrtInverted(const Double value) {
+    const Double half = value*0.5;
+    Double y = fastDouble(0x5fe6eb50c7b537a9ull - (fastBits(value) >> 1));
+    y *= 1.5 - half*y*y;
+    y *= 1.5 - half*y*y;
+    y *= 1.5 - half*y*y;
+    return y;
+}
+
+/* Reduces the angle to [-π/2, π/2] and returns the sign the cosine has to
+   be multiplied with. The 2π multiple is subtracted in two parts
+   (Cody-Waite) so the reduction doesn't lose precision for angles up to a
+   few thousand radians. */
+template<class T> inline T fastReduceAngle(T& angle) {
+    const T k = T(std::int64_t(angle*T(0.15915494309189533577) + (angle < T(0) ? T(-0.5) : T(0.5))));
+    angle = (angle - k*T(6.28125)) - k*T(0.0019353071795864769253);
+    if(angle > T(1.57079632679489661923)) {
+        angle = T(3.14159265358979323846) - angle;
+        return T(-1);
+    }
+    if(angle < T(-1.57079632679489661923)) {
+        angle = T(-3.14159265358979323846) - angle;
+        return T(-1);
+    }
+    return T(1);
+}
+
+/* Taylor polynomials evaluated in the Horner scheme on the reduced range,
+   the first omitted term is below 7e-10 for sine and 7e-11 for cosine */
+template<class T> inline T fastSinReduced(const T x) {
+    const T x2 = x*x;
+    return x*(T(1) + x2*(T(-1.0/6.0) + x2*(T(1.0/120.0) + x2*(T(-1.0/5040.0) + x2*(T(1.0/362880.0) + x2*(T(-1.0/39916800.0) + x2*T(1.0/6227020800.0)))))));
+}
+template<class T> inline T fastCosReduced(const T x) {
+    const T x2 = x*x;
+    return T(1) + x2*(T(-0.5) + x2*(T(1.0/24.0) + x2*(T(-1.0/720.0) + x2*(T(1.0/40320.0) + x2*(T(-1.0/3628800.0) + x2*(T(1.0/479001600.0) + x2*T(-1.0/87178291200.0)))))));
+}
+
+template<class T> inline T fastSin(T angle) {
+    /* sin(π - x) = sin(x), so the sign returned by the reduction doesn't
+       apply here */
+    fastReduceAngle(angle);
+    return fastSinReduced(angle);
+}
+template<class T> inline T fastCos(T angle) {
+    const T sign = fastReduceAngle(angle);
+    return sign*fastCosReduced(angle);
+}
+
+/* e^x = 2^n e^r, where r is in [-ln(2)/2, ln(2)/2] and 2^n is constructed
+   directly in the exponent bits. The first omitted Taylor term for e^r is
+   below 5.2e-9. */
+template<class T> inline T fastExpReduced(const T r) {
+    return T(1) + r*(T(1) + r*(T(0.5) + r*(T(1.0/6.0) + r*(T(1.0/24.0) + r*(T(1.0/120.0) + r*(T(1.0/720.0) + r*T(1.0/5040.0)))))));
+}
+inline Float fastExp(const Float exponent) {
+    if(exponent > 88.72283f) return fastFloat(0x7f800000u);
+    if(exponent < -87.33654f) return 0.0f;
+    const Int n = Int(exponent*1.44269504f + (exponent < 0.0f ? -0.5f : 0.5f));
+    const Float r = (exponent - n*0.693145752f) - n*1.42860677e-6f;
+    /* 2^128 isn't representable, split the scaling in two */
+    if(n > 127) return fastExpReduced(r)*2.0f*fastFloat(254u << 23);
+    return fastExpReduced(r)*fastFloat(UnsignedInt(n + 127) << 23);
+}
+inline Double fastExp(const Double exponent) {
+    if(exponent > 709.782712893384) return fastDouble(0x7ff0000000000000ull);
+    if(exponent < -708.3964185322641) return 0.0;
+    const std::int64_t n = std::int64_t(exponent*1.4426950408889634074 + (exponent < 0.0 ? -0.5 : 0.5));
+    const Double r = (exponent - n*0.693145751953125) - n*1.42860682030941723212e-6;
+    if(n > 1023) return fastExpReduced(r)*2.0*fastDouble(2046ull << 52);
+    return fastExpReduced(r)*fastDouble(std::uint64_t(n + 1023) << 52);
+}
+
+/* ln(x) = e ln(2) + ln(m), where m is in [√½, √2] and ln(m) is computed
+   as 2 atanh((m - 1)/(m + 1)). The first omitted term is below 7e-10. */
+template<class T> inline T fastLogReduced(const T m) {
+    const T s = (m - T(1))/(m + T(1));
+    const T s2 = s*s;
+    return T(2)*s*(T(1) + s2*(T(1.0/3.0) + s2*(T(1.0/5.0) + s2*(T(1.0/7.0) + s2*T(1.0/9.0)))));
+}
+inline Float fastLog(const Float number) {
+    const UnsignedInt bits = fastBits(number);
+    /* Mantissa with exponent of 0 if it's below √2, -1 otherwise */
+    const UnsignedInt shift = (bits & 0x007fffffu) > 0x3504f3u ? 1 : 0;
+    const Int e = Int(bits >> 23) - 127 + Int(shift);
+    const Float m = fastFloat((bits & 0x007fffffu) | ((127u - shift) << 23));
+    return e*0.693147181f + fastLogReduced(m);
+}
+inline Double fastLog(const Double number) {
+    const std::uint64_t bits = fastBits(number);
+    const std::uint64_t shift = (bits & 0x000fffffffffffffull) > 0x6a09e667f3bcdull ? 1 : 0;
+    const std::int64_t e = std::int64_t(bits >> 52) - 1023 + std::int64_t(shift);
+    const Double m = fastDouble((bits & 0x000fffffffffffffull) | ((1023ull - shift) << 52));
+    return e*0.69314718055994530942 + fastLogReduced(m);
+}
+
+}}}
+
+#endif
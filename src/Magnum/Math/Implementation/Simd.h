@@ -0,0 +1,311 @@
+#ifndef Magnum_Math_Implementation_Simd_h
+#define Magnum_Math_Implementation_Simd_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+
+#include "Magnum/configure.h"
+
+/* SSE2 / NEON kernels for the most common 4x4 float operations. Used by
+   Vector.h, RectangularMatrix.h, Matrix4.h and Quaternion.h only if the
+   library is built with BUILD_SIMD and the instruction set is enabled on
+   the compiler command line, otherwise the generic loops are used. All
+   kernels operate on unaligned column-major data so the layout of the
+   value types stays the same. */
+#if defined(MAGNUM_BUILD_SIMD) && (defined(__SSE2__) || defined(__ARM_NEON))
+#define MAGNUM_MATH_SIMD
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#else
+#include <arm_neon.h>
+#endif
+
+namespace Magnum { namespace Math { namespace Implementation {
+
+/* out = a*b, all 4x4 */
+inline void simdMultiplyMatrix4(const float* const a, const float* const b, float* const out) {
+    #ifdef __SSE2__
+    const __m128 a0 = _mm_loadu_ps(a);
+    const __m128 a1 = _mm_loadu_ps(a + 4);
+    const __m128 a2 = _mm_loadu_ps(a + 8);
+    const __m128 a3 = _mm_loadu_ps(a + 12);
+    for(std::size_t col = 0; col != 4; ++col) {
+        const float* const b0 = b + col*4;
+        _mm_storeu_ps(out + col*4, _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(a0, _mm_set1_ps(b0[0])), _mm_mul_ps(a1, _mm_set1_ps(b0[1]))),
+            _mm_add_ps(_mm_mul_ps(a2, _mm_set1_ps(b0[2])), _mm_mul_ps(a3, _mm_set1_ps(b0[3])))));
+    }
+    #else
+    const float32x4_t a0 = vld1q_f32(a);
+    const float32x4_t a1 = vld1q_f32(a + 4);
+    const float32x4_t a2 = vld1q_f32(a + 8);
+    const float32x4_t a3 = vld1q_f32(a + 12);
+    for(std::size_t col = 0; col != 4; ++col) {
+        const float* const b0 = b + col*4;
+        vst1q_f32(out + col*4, vaddq_f32(
+            vaddq_f32(vmulq_n_f32(a0, b0[0]), vmulq_n_f32(a1, b0[1])),
+            vaddq_f32(vmulq_n_f32(a2, b0[2]), vmulq_n_f32(a3, b0[3]))));
+    }
+    #endif
+}
+
+/* out = a*b, where a is 4x4 and b a four-component vector */
+inline void simdMultiplyMatrix4Vector4(const float* const a, const float* const b, float* const out) {
+    #ifdef __SSE2__
+    _mm_storeu_ps(out, _mm_add_ps(
+        _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(a), _mm_set1_ps(b[0])), _mm_mul_ps(_mm_loadu_ps(a + 4), _mm_set1_ps(b[1]))),
+        _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(a + 8), _mm_set1_ps(b[2])), _mm_mul_ps(_mm_loadu_ps(a + 12), _mm_set1_ps(b[3])))));
+    #else
+    vst1q_f32(out, vaddq_f32(
+        vaddq_f32(vmulq_n_f32(vld1q_f32(a), b[0]), vmulq_n_f32(vld1q_f32(a + 4), b[1])),
+        vaddq_f32(vmulq_n_f32(vld1q_f32(a + 8), b[2]), vmulq_n_f32(vld1q_f32(a + 12), b[3]))));
+    #endif
+}
+
+inline void simdTransposeMatrix4(const float* const in, float* const out) {
+    #ifdef __SSE2__
+    __m128 c0 = _mm_loadu_ps(in);
+    __m128 c1 = _mm_loadu_ps(in + 4);
+    __m128 c2 = _mm_loadu_ps(in + 8);
+    __m128 c3 = _mm_loadu_ps(in + 12);
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+    _mm_storeu_ps(out, c0);
+    _mm_storeu_ps(out + 4, c1);
+    _mm_storeu_ps(out + 8, c2);
+    _mm_storeu_ps(out + 12, c3);
+    #else
+    /* De-interleaving load puts every fourth element into one register */
+    const float32x4x4_t rows = vld4q_f32(in);
+    vst1q_f32(out, rows.val[0]);
+    vst1q_f32(out + 4, rows.val[1]);
+    vst1q_f32(out + 8, rows.val[2]);
+    vst1q_f32(out + 12, rows.val[3]);
+    #endif
+}
+
+/* Inverse of a rigid 4x4 transformation: transposed rotation part and
+   translation rotated back. Same operation order as the generic code. */
+inline void simdInvertRigidMatrix4(const float* const in, float* const out) {
+    float rotation[16]{in[0], in[1], in[2], 0.0f,
+                       in[4], in[5], in[6], 0.0f,
+                       in[8], in[9], in[10], 0.0f,
+                       0.0f, 0.0f, 0.0f, 1.0f};
+    simdTransposeMatrix4(rotation, out);
+
+    const float* const t = in + 12;
+    #ifdef __SSE2__
+    const __m128 translation = _mm_add_ps(_mm_add_ps(
+        _mm_mul_ps(_mm_loadu_ps(out), _mm_set1_ps(-t[0])),
+        _mm_mul_ps(_mm_loadu_ps(out + 4), _mm_set1_ps(-t[1]))),
+        _mm_mul_ps(_mm_loadu_ps(out + 8), _mm_set1_ps(-t[2])));
+    _mm_storeu_ps(out + 12, _mm_add_ps(translation, _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f)));
+    #else
+    const float32x4_t translation = vaddq_f32(vaddq_f32(
+        vmulq_n_f32(vld1q_f32(out), -t[0]),
+        vmulq_n_f32(vld1q_f32(out + 4), -t[1])),
+        vmulq_n_f32(vld1q_f32(out + 8), -t[2]));
+    vst1q_f32(out + 12, translation);
+    out[15] = 1.0f;
+    #endif
+}
+
+/* Hamilton product of two quaternions stored as (x, y, z, w) */
+inline void simdMultiplyQuaternion(const float* const a, const float* const b, float* const out) {
+    #ifdef __SSE2__
+    const __m128 va = _mm_loadu_ps(a);
+    const __m128 vb = _mm_loadu_ps(b);
+    const __m128 signW = _mm_set_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+
+    /* aw*b + (axyz*bw, -ax*bx) + (ay*bz, az*bx, ax*by, -ay*by)
+            - (az*by, ax*bz, ay*bx, az*bz) */
+    const __m128 r = _mm_mul_ps(_mm_shuffle_ps(va, va, _MM_SHUFFLE(3, 3, 3, 3)), vb);
+    const __m128 t1 = _mm_xor_ps(signW, _mm_mul_ps(
+        _mm_shuffle_ps(va, va, _MM_SHUFFLE(0, 2, 1, 0)),
+        _mm_shuffle_ps(vb, vb, _MM_SHUFFLE(0, 3, 3, 3))));
+    const __m128 t2 = _mm_xor_ps(signW, _mm_mul_ps(
+        _mm_shuffle_ps(va, va, _MM_SHUFFLE(1, 0, 2, 1)),
+        _mm_shuffle_ps(vb, vb, _MM_SHUFFLE(1, 1, 0, 2))));
+    const __m128 t3 = _mm_mul_ps(
+        _mm_shuffle_ps(va, va, _MM_SHUFFLE(2, 1, 0, 2)),
+        _mm_shuffle_ps(vb, vb, _MM_SHUFFLE(2, 0, 2, 1)));
+    _mm_storeu_ps(out, _mm_sub_ps(_mm_add_ps(_mm_add_ps(r, t1), t2), t3));
+    #else
+    /* NEON has no arbitrary shuffles, gather the permutations directly */
+    const float a1[]{a[0], a[1], a[2], -a[0]};
+    const float b1[]{b[3], b[3], b[3], b[0]};
+    const float a2[]{a[1], a[2], a[0], -a[1]};
+    const float b2[]{b[2], b[0], b[1], b[1]};
+    const float a3[]{a[2], a[0], a[1], a[2]};
+    const float b3[]{b[1], b[2], b[0], b[2]};
+    const float32x4_t r = vmulq_n_f32(vld1q_f32(b), a[3]);
+    const float32x4_t t1 = vmulq_f32(vld1q_f32(a1), vld1q_f32(b1));
+    const float32x4_t t2 = vmulq_f32(vld1q_f32(a2), vld1q_f32(b2));
+    const float32x4_t t3 = vmulq_f32(vld1q_f32(a3), vld1q_f32(b3));
+    vst1q_f32(out, vsubq_f32(vaddq_f32(vaddq_f32(r, t1), t2), t3));
+    #endif
+}
+
+inline float simdDotVector4(const float* const a, const float* const b) {
+    #ifdef __SSE2__
+    const __m128 m = _mm_mul_ps(_mm_loadu_ps(a), _mm_loadu_ps(b));
+    const __m128 s = _mm_add_ps(m, _mm_movehl_ps(m, m));
+    return _mm_cvtss_f32(_mm_add_ss(s, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 1, 1, 1))));
+    #else
+    const float32x4_t m = vmulq_f32(vld1q_f32(a), vld1q_f32(b));
+    #ifdef __aarch64__
+    return vaddvq_f32(m);
+    #else
+    const float32x2_t s = vadd_f32(vget_low_f32(m), vget_high_f32(m));
+    return vget_lane_f32(vpadd_f32(s, s), 0);
+    #endif
+    #endif
+}
+
+/* Sixteen normalized unsigned bytes to floats in [0, 1] */
+inline void simdUnpackUnsignedByte16(const unsigned char* const in, float* const out) {
+    #ifdef __SSE2__
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 scale = _mm_set1_ps(1.0f/255.0f);
+    const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+    const __m128i lo = _mm_unpacklo_epi8(bytes, zero);
+    const __m128i hi = _mm_unpackhi_epi8(bytes, zero);
+    _mm_storeu_ps(out, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), scale));
+    _mm_storeu_ps(out + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), scale));
+    _mm_storeu_ps(out + 8, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), scale));
+    _mm_storeu_ps(out + 12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), scale));
+    #else
+    const uint8x16_t bytes = vld1q_u8(in);
+    const uint16x8_t lo = vmovl_u8(vget_low_u8(bytes));
+    const uint16x8_t hi = vmovl_u8(vget_high_u8(bytes));
+    vst1q_f32(out, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo))), 1.0f/255.0f));
+    vst1q_f32(out + 4, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo))), 1.0f/255.0f));
+    vst1q_f32(out + 8, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi))), 1.0f/255.0f));
+    vst1q_f32(out + 12, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi))), 1.0f/255.0f));
+    #endif
+}
+
+/* Four HSV triplets to RGB, hue in [0, 6) sextants. Channel n is
+   v - v*s*clamp(min(k, 4 - k), 0, 1) with k = (n + h) mod 6 and n being 5, 3
+   and 1 for red, green and blue, same as the generic code. */
+inline void simdHsvToRgb4(const float* const h, const float* const s, const float* const v, float* const out) {
+    float channel[4];
+    #ifdef __SSE2__
+    const __m128 vh = _mm_loadu_ps(h);
+    const __m128 vs = _mm_loadu_ps(s);
+    const __m128 vv = _mm_loadu_ps(v);
+    const __m128 vvs = _mm_mul_ps(vv, vs);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    for(std::size_t c = 0; c != 3; ++c) {
+        __m128 k = _mm_add_ps(vh, _mm_set1_ps(5.0f - 2.0f*c));
+        /* k is positive, so truncation is the same as floor */
+        k = _mm_sub_ps(k, _mm_mul_ps(_mm_set1_ps(6.0f),
+            _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_mul_ps(k, _mm_set1_ps(1.0f/6.0f))))));
+        const __m128 t = _mm_max_ps(zero, _mm_min_ps(one,
+            _mm_min_ps(k, _mm_sub_ps(_mm_set1_ps(4.0f), k))));
+        _mm_storeu_ps(channel, _mm_sub_ps(vv, _mm_mul_ps(vvs, t)));
+        for(std::size_t i = 0; i != 4; ++i) out[i*3 + c] = channel[i];
+    }
+    #else
+    const float32x4_t vh = vld1q_f32(h);
+    const float32x4_t vv = vld1q_f32(v);
+    const float32x4_t vvs = vmulq_f32(vv, vld1q_f32(s));
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    for(std::size_t c = 0; c != 3; ++c) {
+        float32x4_t k = vaddq_f32(vh, vdupq_n_f32(5.0f - 2.0f*c));
+        k = vsubq_f32(k, vmulq_n_f32(
+            vcvtq_f32_s32(vcvtq_s32_f32(vmulq_n_f32(k, 1.0f/6.0f))), 6.0f));
+        const float32x4_t t = vmaxq_f32(zero, vminq_f32(one,
+            vminq_f32(k, vsubq_f32(vdupq_n_f32(4.0f), k))));
+        vst1q_f32(channel, vsubq_f32(vv, vmulq_f32(vvs, t)));
+        for(std::size_t i = 0; i != 4; ++i) out[i*3 + c] = channel[i];
+    }
+    #endif
+}
+
+
+/* Signed distances of four interleaved 3D points from a plane */
+inline void simdPointPlane4(const float* const points, const float* const plane, float* const out) {
+    float x[4], y[4], z[4];
+    for(std::size_t i = 0; i != 4; ++i) {
+        x[i] = points[i*3 + 0];
+        y[i] = points[i*3 + 1];
+        z[i] = points[i*3 + 2];
+    }
+    #ifdef __SSE2__
+    _mm_storeu_ps(out, _mm_add_ps(
+        _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(x), _mm_set1_ps(plane[0])), _mm_mul_ps(_mm_loadu_ps(y), _mm_set1_ps(plane[1]))),
+        _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(z), _mm_set1_ps(plane[2])), _mm_set1_ps(plane[3]))));
+    #else
+    vst1q_f32(out, vaddq_f32(
+        vaddq_f32(vmulq_n_f32(vld1q_f32(x), plane[0]), vmulq_n_f32(vld1q_f32(y), plane[1])),
+        vaddq_f32(vmulq_n_f32(vld1q_f32(z), plane[2]), vdupq_n_f32(plane[3]))));
+    #endif
+}
+
+/* Squared distances of four interleaved 3D points from a line segment
+   starting at a with direction ab, abInvDot being 1/dot(ab, ab) or zero for
+   a degenerate segment. The closest point parameter is clamped to [0, 1]
+   instead of branching. */
+inline void simdLineSegmentPointSquared4(const float* const points, const float* const a, const float* const ab, const float abInvDot, float* const out) {
+    float x[4], y[4], z[4];
+    for(std::size_t i = 0; i != 4; ++i) {
+        x[i] = points[i*3 + 0];
+        y[i] = points[i*3 + 1];
+        z[i] = points[i*3 + 2];
+    }
+    #ifdef __SSE2__
+    const __m128 abx = _mm_set1_ps(ab[0]);
+    const __m128 aby = _mm_set1_ps(ab[1]);
+    const __m128 abz = _mm_set1_ps(ab[2]);
+    const __m128 dx = _mm_sub_ps(_mm_loadu_ps(x), _mm_set1_ps(a[0]));
+    const __m128 dy = _mm_sub_ps(_mm_loadu_ps(y), _mm_set1_ps(a[1]));
+    const __m128 dz = _mm_sub_ps(_mm_loadu_ps(z), _mm_set1_ps(a[2]));
+    const __m128 t = _mm_max_ps(_mm_setzero_ps(), _mm_min_ps(_mm_set1_ps(1.0f),
+        _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, abx), _mm_mul_ps(dy, aby)), _mm_mul_ps(dz, abz)), _mm_set1_ps(abInvDot))));
+    const __m128 ex = _mm_sub_ps(dx, _mm_mul_ps(t, abx));
+    const __m128 ey = _mm_sub_ps(dy, _mm_mul_ps(t, aby));
+    const __m128 ez = _mm_sub_ps(dz, _mm_mul_ps(t, abz));
+    _mm_storeu_ps(out, _mm_add_ps(_mm_add_ps(_mm_mul_ps(ex, ex), _mm_mul_ps(ey, ey)), _mm_mul_ps(ez, ez)));
+    #else
+    const float32x4_t dx = vsubq_f32(vld1q_f32(x), vdupq_n_f32(a[0]));
+    const float32x4_t dy = vsubq_f32(vld1q_f32(y), vdupq_n_f32(a[1]));
+    const float32x4_t dz = vsubq_f32(vld1q_f32(z), vdupq_n_f32(a[2]));
+    const float32x4_t t = vmaxq_f32(vdupq_n_f32(0.0f), vminq_f32(vdupq_n_f32(1.0f),
+        vmulq_n_f32(vaddq_f32(vaddq_f32(vmulq_n_f32(dx, ab[0]), vmulq_n_f32(dy, ab[1])), vmulq_n_f32(dz, ab[2])), abInvDot)));
+    const float32x4_t ex = vsubq_f32(dx, vmulq_n_f32(t, ab[0]));
+    const float32x4_t ey = vsubq_f32(dy, vmulq_n_f32(t, ab[1]));
+    const float32x4_t ez = vsubq_f32(dz, vmulq_n_f32(t, ab[2]));
+    vst1q_f32(out, vaddq_f32(vaddq_f32(vmulq_f32(ex, ex), vmulq_f32(ey, ey)), vmulq_f32(ez, ez)));
+    #endif
+}
+
+}}}
+#endif
+
+#endif
@@ -49,11 +49,15 @@ template<class T> using QuadraticBezier3D = QuadraticBezier<3, T>;
 template<class T> using CubicBezier2D = CubicBezier<2, T>;
 template<class T> using CubicBezier3D = CubicBezier<3, T>;
 
+class BitArray;
+
 template<class> class Complex;
 template<class> class Dual;
 template<class> class DualComplex;
 template<class> class DualQuaternion;
 
+template<class> class Frustum;
+
 template<std::size_t, class> class Matrix;
 template<class T> using Matrix2x2 = Matrix<2, T>;
 template<class T> using Matrix3x3 = Matrix<3, T>;
@@ -72,6 +76,9 @@ template<class T> using Matrix4x2 = RectangularMatrix<4, 2, T>;
 template<class T> using Matrix3x4 = RectangularMatrix<3, 4, T>;
 template<class T> using Matrix4x3 = RectangularMatrix<4, 3, T>;
 
+template<std::size_t, class> class SoaQuaternion;
+template<std::size_t, class> class SoaVector3;
+
 template<template<class> class, class> class Unit;
 template<class> class Deg;
 template<class> class Rad;
@@ -206,16 +206,16 @@ template<std::size_t size, class T> class Matrix: public RectangularMatrix<size,
 
         #ifndef DOXYGEN_GENERATING_OUTPUT
         /* Reimplementation of functions to return correct type */
-        Matrix<size, T> operator*(const Matrix<size, T>& other) const {
+        constexpr Matrix<size, T> operator*(const Matrix<size, T>& other) const {
             return RectangularMatrix<size, size, T>::operator*(other);
         }
-        template<std::size_t otherCols> RectangularMatrix<otherCols, size, T> operator*(const RectangularMatrix<otherCols, size, T>& other) const {
+        template<std::size_t otherCols> constexpr RectangularMatrix<otherCols, size, T> operator*(const RectangularMatrix<otherCols, size, T>& other) const {
             return RectangularMatrix<size, size, T>::operator*(other);
         }
-        Vector<size, T> operator*(const Vector<size, T>& other) const {
+        constexpr Vector<size, T> operator*(const Vector<size, T>& other) const {
             return RectangularMatrix<size, size, T>::operator*(other);
         }
-        Matrix<size, T> transposed() const {
+        constexpr Matrix<size, T> transposed() const {
             return RectangularMatrix<size, size, T>::transposed();
         }
         MAGNUM_RECTANGULARMATRIX_SUBCLASS_IMPLEMENTATION(size, size, Matrix<size, T>)
@@ -272,21 +272,21 @@ template<std::size_t size, class T> inline Corrade::Utility::Debug& operator<<(C
     constexpr const VectorType<T> operator[](std::size_t col) const {       \
         return VectorType<T>(Matrix<size, T>::operator[](col));             \
     }                                                                       \
-    VectorType<T> row(std::size_t row) const {                              \
+    constexpr VectorType<T> row(std::size_t row) const {                    \
         return VectorType<T>(Matrix<size, T>::row(row));                    \
     }                                                                       \
                                                                             \
-    Type<T> operator*(const Matrix<size, T>& other) const {                 \
+    constexpr Type<T> operator*(const Matrix<size, T>& other) const {       \
         return Matrix<size, T>::operator*(other);                           \
     }                                                                       \
-    template<std::size_t otherCols> RectangularMatrix<otherCols, size, T> operator*(const RectangularMatrix<otherCols, size, T>& other) const { \
+    template<std::size_t otherCols> constexpr RectangularMatrix<otherCols, size, T> operator*(const RectangularMatrix<otherCols, size, T>& other) const { \
         return Matrix<size, T>::operator*(other);                           \
     }                                                                       \
-    VectorType<T> operator*(const Vector<size, T>& other) const {           \
+    constexpr VectorType<T> operator*(const Vector<size, T>& other) const { \
         return Matrix<size, T>::operator*(other);                           \
     }                                                                       \
                                                                             \
-    Type<T> transposed() const { return Matrix<size, T>::transposed(); }    \
+    constexpr Type<T> transposed() const { return Matrix<size, T>::transposed(); } \
     constexpr VectorType<T> diagonal() const { return Matrix<size, T>::diagonal(); } \
     Type<T> inverted() const { return Matrix<size, T>::inverted(); }        \
     Type<T> invertedOrthogonal() const {                                    \
@@ -176,7 +176,7 @@ template<class T> class Matrix3: public Matrix3x3<T> {
          * @see @ref Matrix4::orthographicProjection(),
          *      @ref Matrix4::perspectiveProjection()
          */
-        static Matrix3<T> projection(const Vector2<T>& size) {
+        constexpr static Matrix3<T> projection(const Vector2<T>& size) {
             return scaling(2.0f/size);
         }
 
@@ -381,8 +381,8 @@ template<class T> class Matrix3: public Matrix3x3<T> {
          *      @ref Matrix4::transformVector()
          * @todo extract 2x2 matrix and multiply directly? (benchmark that)
          */
-        Vector2<T> transformVector(const Vector2<T>& vector) const {
-            return ((*this)*Vector3<T>(vector, T(0))).xy();
+        constexpr Vector2<T> transformVector(const Vector2<T>& vector) const {
+            return transformed((*this)*Vector3<T>(vector, T(0)));
         }
 
         /**
@@ -395,12 +395,18 @@ template<class T> class Matrix3: public Matrix3x3<T> {
          * @see @ref DualComplex::transformPoint(),
          *      @ref Matrix4::transformPoint()
          */
-        Vector2<T> transformPoint(const Vector2<T>& vector) const {
-            return ((*this)*Vector3<T>(vector, T(1))).xy();
+        constexpr Vector2<T> transformPoint(const Vector2<T>& vector) const {
+            return transformed((*this)*Vector3<T>(vector, T(1)));
         }
 
         MAGNUM_RECTANGULARMATRIX_SUBCLASS_IMPLEMENTATION(3, 3, Matrix3<T>)
         MAGNUM_MATRIX_SUBCLASS_IMPLEMENTATION(3, Matrix3, Vector3)
+
+    private:
+        /* Implementation for transformVector() and transformPoint() */
+        constexpr static Vector2<T> transformed(const Vector3<T>& vector) {
+            return vector.xy();
+        }
 };
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -555,8 +555,8 @@ template<class T> class Matrix4: public Matrix4x4<T> {
          *      @ref Matrix3::transformVector()
          * @todo extract 3x3 matrix and multiply directly? (benchmark that)
          */
-        Vector3<T> transformVector(const Vector3<T>& vector) const {
-            return ((*this)*Vector4<T>(vector, T(0))).xyz();
+        constexpr Vector3<T> transformVector(const Vector3<T>& vector) const {
+            return transformedVector((*this)*Vector4<T>(vector, T(0)));
         }
 
         /**
@@ -569,13 +569,21 @@ template<class T> class Matrix4: public Matrix4x4<T> {
          * @see @ref DualQuaternion::transformPoint(),
          *      @ref Matrix3::transformPoint()
          */
-        Vector3<T> transformPoint(const Vector3<T>& vector) const {
-            const Vector4<T> transformed{(*this)*Vector4<T>(vector, T(1))};
-            return transformed.xyz()/transformed.w();
+        constexpr Vector3<T> transformPoint(const Vector3<T>& vector) const {
+            return transformedPoint((*this)*Vector4<T>(vector, T(1)));
         }
 
         MAGNUM_RECTANGULARMATRIX_SUBCLASS_IMPLEMENTATION(4, 4, Matrix4<T>)
         MAGNUM_MATRIX_SUBCLASS_IMPLEMENTATION(4, Matrix4, Vector4)
+
+    private:
+        /* Implementation for transformVector() and transformPoint() */
+        constexpr static Vector3<T> transformedVector(const Vector4<T>& vector) {
+            return vector.xyz();
+        }
+        constexpr static Vector3<T> transformedPoint(const Vector4<T>& vector) {
+            return vector.xyz()/vector.w();
+        }
 };
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -706,12 +714,28 @@ template<class T> T Matrix4<T>::uniformScalingSquared() const {
     return scalingSquared;
 }
 
+namespace Implementation {
+
+template<class T> inline Matrix4<T> matrixInvertedRigid(const Matrix4<T>& matrix) {
+    Matrix3x3<T> inverseRotation = matrix.rotationScaling().transposed();
+    return Matrix4<T>::from(inverseRotation, inverseRotation*-matrix.translation());
+}
+
+#ifdef MAGNUM_MATH_SIMD
+inline Matrix4<float> matrixInvertedRigid(const Matrix4<float>& matrix) {
+    Matrix4<float> out{NoInit};
+    simdInvertRigidMatrix4(matrix.data(), out.data());
+    return out;
+}
+#endif
+
+}
+
 template<class T> Matrix4<T> Matrix4<T>::invertedRigid() const {
     CORRADE_ASSERT(isRigidTransformation(),
         "Math::Matrix4::invertedRigid(): the matrix doesn't represent rigid transformation", {});
 
-    Matrix3x3<T> inverseRotation = rotationScaling().transposed();
-    return from(inverseRotation, inverseRotation*-translation());
+    return Implementation::matrixInvertedRigid(*this);
 }
 
 }}
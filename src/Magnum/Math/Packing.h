@@ -0,0 +1,358 @@
+#ifndef Magnum_Math_Packing_h
+#define Magnum_Math_Packing_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Functions @ref Magnum::Math::packHalf(), @ref Magnum::Math::unpackHalf(), @ref Magnum::Math::packNormalized(), @ref Magnum::Math::unpackNormalized(), @ref Magnum::Math::packInt2101010Rev(), @ref Magnum::Math::unpackInt2101010Rev(), @ref Magnum::Math::packUnsignedInt2101010Rev(), @ref Magnum::Math::unpackUnsignedInt2101010Rev()
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/configure.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector4.h"
+
+#if defined(MAGNUM_BUILD_SIMD) && defined(__F16C__)
+#define MAGNUM_MATH_F16C
+#include <immintrin.h>
+#endif
+
+namespace Magnum { namespace Math {
+
+/**
+@brief Pack a float into a half-float
+
+Returns bit representation of the half-float, rounded to nearest even. Values
+out of half-float range are converted to infinity, values below the smallest
+half-float subnormal are flushed to zero. NaNs stay quiet NaNs, but the
+payload is not preserved. The result can be used as
+@ref Attribute::DataType::HalfFloat vertex data or
+@ref PixelType::HalfFloat pixel data.
+@see @ref unpackHalf(), @ref packHalf(Corrade::Containers::ArrayView<const Float>, Corrade::Containers::ArrayView<UnsignedShort>)
+*/
+inline UnsignedShort packHalf(const Float value) {
+    UnsignedInt bits;
+    std::memcpy(&bits, &value, sizeof(Float));
+    const UnsignedShort sign = (bits >> 16) & 0x8000;
+    const UnsignedInt abs = bits & 0x7fffffff;
+
+    /* Infinity and NaN, keep NaN quiet */
+    if(abs >= 0x7f800000)
+        return sign | 0x7c00 | (abs > 0x7f800000 ? 0x200 : 0);
+
+    /* Subnormals and zero. The scaled value is below 1024 so it's exactly
+       representable and nearbyint() rounds to even in default rounding
+       mode. Rounding up to 1024 gives the smallest normal value. */
+    if(abs < 0x38800000) {
+        Float absValue;
+        std::memcpy(&absValue, &abs, sizeof(Float));
+        return sign | UnsignedShort(std::nearbyint(absValue*16777216.0f));
+    }
+
+    /* Rebias the exponent and round the mantissa, carry propagates to
+       exponent and overflows to infinity */
+    const UnsignedInt rebiased = abs - 0x38000000;
+    return sign | UnsignedShort(std::min((rebiased + 0xfff + ((rebiased >> 13) & 1)) >> 13, 0x7c00u));
+}
+
+/**
+@brief Unpack a half-float into a float
+
+Inverse to @ref packHalf(Float), the conversion is exact.
+@see @ref unpackHalf(Corrade::Containers::ArrayView<const UnsignedShort>, Corrade::Containers::ArrayView<Float>)
+*/
+inline Float unpackHalf(const UnsignedShort value) {
+    const UnsignedInt sign = UnsignedInt(value & 0x8000) << 16;
+    const UnsignedInt exponent = (value >> 10) & 0x1f;
+    const UnsignedInt mantissa = value & 0x3ff;
+
+    UnsignedInt bits;
+    /* Zero and subnormals, the mantissa is exactly representable as a float
+       and scaling by a power of two doesn't round */
+    if(exponent == 0) {
+        const Float abs = Float(mantissa)*(1.0f/16777216.0f);
+        std::memcpy(&bits, &abs, sizeof(Float));
+        bits |= sign;
+
+    /* Infinity and NaN */
+    } else if(exponent == 0x1f)
+        bits = sign | 0x7f800000 | (mantissa << 13);
+
+    /* Normal numbers, rebias the exponent */
+    else bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+
+    Float out;
+    std::memcpy(&out, &bits, sizeof(Float));
+    return out;
+}
+
+/**
+@brief Pack an array of floats into half-floats
+
+Equivalent to calling @ref packHalf(Float) on each item of @p values and
+saving the results into @p out. If the library is built with
+`BUILD_SIMD` and F16C instructions are enabled on the compiler command line,
+eight values are converted at once using hardware conversion; the results
+are the same except for NaN payloads. Expects that both views have the same
+size.
+*/
+inline void packHalf(const Corrade::Containers::ArrayView<const Float> values, const Corrade::Containers::ArrayView<UnsignedShort> out) {
+    CORRADE_ASSERT(out.size() == values.size(),
+        "Math::packHalf(): expected views of the same size", );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_MATH_F16C
+    for(; i + 8 <= values.size(); i += 8)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+            _mm256_cvtps_ph(_mm256_loadu_ps(values + i), _MM_FROUND_TO_NEAREST_INT));
+    #endif
+    for(; i != values.size(); ++i)
+        out[i] = packHalf(values[i]);
+}
+
+/**
+@brief Unpack an array of half-floats into floats
+
+Equivalent to calling @ref unpackHalf(UnsignedShort) on each item of
+@p values and saving the results into @p out. If the library is built with
+`BUILD_SIMD` and F16C instructions are enabled on the compiler command line,
+eight values are converted at once using hardware conversion. Expects that
+both views have the same size.
+*/
+inline void unpackHalf(const Corrade::Containers::ArrayView<const UnsignedShort> values, const Corrade::Containers::ArrayView<Float> out) {
+    CORRADE_ASSERT(out.size() == values.size(),
+        "Math::unpackHalf(): expected views of the same size", );
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_MATH_F16C
+    for(; i + 8 <= values.size(); i += 8)
+        _mm256_storeu_ps(out + i,
+            _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i))));
+    #endif
+    for(; i != values.size(); ++i)
+        out[i] = unpackHalf(values[i]);
+}
+
+/**
+@brief Pack a float into a normalized integral value
+
+Unlike @ref denormalize(), the value is clamped to @f$ [0, 1] @f$ for
+unsigned and to @f$ [-1, 1] @f$ for signed types first and then rounded to
+nearest integer, so the packing is symmetric and
+@ref unpackNormalized() returns the closest representable value. Example
+usage:
+@code
+UnsignedShort a = Math::packNormalized<UnsignedShort>(0.5f); // 32768
+Short b = Math::packNormalized<Short>(-2.0f); // -32767
+@endcode
+@see @ref packNormalized(Corrade::Containers::ArrayView<const Float>, Corrade::Containers::ArrayView<Integral>)
+*/
+template<class Integral> inline Integral packNormalized(const Float value) {
+    static_assert(std::is_integral<Integral>::value && sizeof(Integral) <= 2,
+        "Math::packNormalized(): packing can be done only to 8- and 16-bit integral types");
+    constexpr Float max = Float(std::numeric_limits<Integral>::max());
+    return Integral(std::round(Math::clamp(value, std::is_signed<Integral>::value ? -1.0f : 0.0f, 1.0f)*max));
+}
+
+/**
+@brief Unpack a normalized integral value into a float
+
+Converts the value to range @f$ [0, 1] @f$ for unsigned and
+@f$ [-1, 1] @f$ for signed types. The smallest signed value is clamped to
+@f$ -1 @f$.
+@see @ref normalize(),
+    @ref unpackNormalized(Corrade::Containers::ArrayView<const Integral>, Corrade::Containers::ArrayView<Float>)
+*/
+template<class Integral> inline Float unpackNormalized(const Integral value) {
+    return normalize<Float, Integral>(value);
+}
+
+/**
+@brief Pack an array of floats into normalized integral values
+
+Equivalent to calling @ref packNormalized(Float) on each item of @p values
+and saving the results into @p out. Expects that both views have the same
+size.
+*/
+template<class Integral> void packNormalized(const Corrade::Containers::ArrayView<const Float> values, const Corrade::Containers::ArrayView<Integral> out) {
+    CORRADE_ASSERT(out.size() == values.size(),
+        "Math::packNormalized(): expected views of the same size", );
+
+    for(std::size_t i = 0; i != values.size(); ++i)
+        out[i] = packNormalized<Integral>(values[i]);
+}
+
+/**
+@brief Unpack an array of normalized integral values into floats
+
+Equivalent to calling @ref unpackNormalized(Integral) on each item of
+@p values and saving the results into @p out. Expects that both views have
+the same size.
+*/
+template<class Integral> void unpackNormalized(const Corrade::Containers::ArrayView<const Integral> values, const Corrade::Containers::ArrayView<Float> out) {
+    CORRADE_ASSERT(out.size() == values.size(),
+        "Math::unpackNormalized(): expected views of the same size", );
+
+    for(std::size_t i = 0; i != values.size(); ++i)
+        out[i] = unpackNormalized<Integral>(values[i]);
+}
+
+/**
+@brief Pack a vector into signed normalized 10-10-10-2 format
+
+Stores X in the lowest ten bits, followed by Y and Z, each being signed
+normalized ten-bit value, and W as signed normalized two-bit value in the
+two highest bits. Values are clamped to @f$ [-1, 1] @f$. The layout matches
+@ref Attribute::DataType::Int2101010Rev.
+@see @ref unpackInt2101010Rev(), @ref packUnsignedInt2101010Rev()
+*/
+inline UnsignedInt packInt2101010Rev(const Vector4<Float>& value) {
+    const auto pack = [](Float value, Float max, UnsignedInt mask) {
+        return UnsignedInt(Int(std::round(Math::clamp(value, -1.0f, 1.0f)*max))) & mask;
+    };
+    return pack(value.x(), 511.0f, 0x3ff)|
+          (pack(value.y(), 511.0f, 0x3ff) << 10)|
+          (pack(value.z(), 511.0f, 0x3ff) << 20)|
+          (pack(value.w(), 1.0f, 0x3) << 30);
+}
+
+/**
+@brief Unpack a vector from signed normalized 10-10-10-2 format
+
+Inverse to @ref packInt2101010Rev(), the smallest values are clamped to
+@f$ -1 @f$.
+*/
+inline Vector4<Float> unpackInt2101010Rev(const UnsignedInt value) {
+    /* Sign-extend by shifting the field to the top and back */
+    const auto unpack = [](UnsignedInt value, UnsignedInt shift, UnsignedInt bits, Float max) {
+        return Math::max(Float(Int(value << (32 - shift - bits)) >> (32 - bits))/max, -1.0f);
+    };
+    return {unpack(value, 0, 10, 511.0f),
+            unpack(value, 10, 10, 511.0f),
+            unpack(value, 20, 10, 511.0f),
+            unpack(value, 30, 2, 1.0f)};
+}
+
+/**
+@brief Pack a vector into unsigned normalized 10-10-10-2 format
+
+Same layout as @ref packInt2101010Rev(), but with unsigned normalized fields
+and values clamped to @f$ [0, 1] @f$. The layout matches
+@ref Attribute::DataType::UnsignedInt2101010Rev and
+@ref PixelType::UnsignedInt2101010Rev.
+@see @ref unpackUnsignedInt2101010Rev()
+*/
+inline UnsignedInt packUnsignedInt2101010Rev(const Vector4<Float>& value) {
+    const auto pack = [](Float value, Float max) {
+        return UnsignedInt(std::round(Math::clamp(value, 0.0f, 1.0f)*max));
+    };
+    return pack(value.x(), 1023.0f)|
+          (pack(value.y(), 1023.0f) << 10)|
+          (pack(value.z(), 1023.0f) << 20)|
+          (pack(value.w(), 3.0f) << 30);
+}
+
+/**
+@brief Unpack a vector from unsigned normalized 10-10-10-2 format
+
+Inverse to @ref packUnsignedInt2101010Rev().
+*/
+inline Vector4<Float> unpackUnsignedInt2101010Rev(const UnsignedInt value) {
+    return {Float(value & 0x3ff)/1023.0f,
+            Float((value >> 10) & 0x3ff)/1023.0f,
+            Float((value >> 20) & 0x3ff)/1023.0f,
+            Float(value >> 30)/3.0f};
+}
+
+/**
+@brief Pack an array of vectors into signed normalized 10-10-10-2 format
+
+Equivalent to calling @ref packInt2101010Rev(const Vector4<Float>&) on each
+item of @p values and saving the results into @p out. Expects that both
+views have the same size.
+*/
+inline void packInt2101010Rev(const Corrade::Containers::ArrayView<const Vector4<Float>> values, const Corrade::Containers::ArrayView<UnsignedInt> out) {
+    CORRADE_ASSERT(out.size() == values.size(),
+        "Math::packInt2101010Rev(): expected views of the same size", );
+
+    for(std::size_t i = 0; i != values.size(); ++i)
+        out[i] = packInt2101010Rev(values[i]);
+}
+
+/**
+@brief Unpack an array of vectors from signed normalized 10-10-10-2 format
+
+Equivalent to calling @ref unpackInt2101010Rev(UnsignedInt) on each item of
+@p values and saving the results into @p out. Expects that both views have
+the same size.
+*/
+inline void unpackInt2101010Rev(const Corrade::Containers::ArrayView<const UnsignedInt> values, const Corrade::Containers::ArrayView<Vector4<Float>> out) {
+    CORRADE_ASSERT(out.size() == values.size(),
+        "Math::unpackInt2101010Rev(): expected views of the same size", );
+
+    for(std::size_t i = 0; i != values.size(); ++i)
+        out[i] = unpackInt2101010Rev(values[i]);
+}
+
+/**
+@brief Pack an array of vectors into unsigned normalized 10-10-10-2 format
+
+Equivalent to calling @ref packUnsignedInt2101010Rev(const Vector4<Float>&)
+on each item of @p values and saving the results into @p out. Expects that
+both views have the same size.
+*/
+inline void packUnsignedInt2101010Rev(const Corrade::Containers::ArrayView<const Vector4<Float>> values, const Corrade::Containers::ArrayView<UnsignedInt> out) {
+    CORRADE_ASSERT(out.size() == values.size(),
+        "Math::packUnsignedInt2101010Rev(): expected views of the same size", );
+
+    for(std::size_t i = 0; i != values.size(); ++i)
+        out[i] = packUnsignedInt2101010Rev(values[i]);
+}
+
+/**
+@brief Unpack an array of vectors from unsigned normalized 10-10-10-2 format
+
+Equivalent to calling @ref unpackUnsignedInt2101010Rev(UnsignedInt) on each
+item of @p values and saving the results into @p out. Expects that both
+views have the same size.
+*/
+inline void unpackUnsignedInt2101010Rev(const Corrade::Containers::ArrayView<const UnsignedInt> values, const Corrade::Containers::ArrayView<Vector4<Float>> out) {
+    CORRADE_ASSERT(out.size() == values.size(),
+        "Math::unpackUnsignedInt2101010Rev(): expected views of the same size", );
+
+    for(std::size_t i = 0; i != values.size(); ++i)
+        out[i] = unpackUnsignedInt2101010Rev(values[i]);
+}
+
+}}
+
+#endif
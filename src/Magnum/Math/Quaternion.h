@@ -51,7 +51,7 @@ namespace Implementation {
 @f]
 @see @ref Quaternion::dot() const
 */
-template<class T> inline T dot(const Quaternion<T>& a, const Quaternion<T>& b) {
+template<class T> constexpr T dot(const Quaternion<T>& a, const Quaternion<T>& b) {
     return dot(a.vector(), b.vector()) + a.scalar()*b.scalar();
 }
 
@@ -307,7 +307,7 @@ template<class T> class Quaternion {
          * @see @ref fromMatrix(), @ref DualQuaternion::toMatrix(),
          *      @ref Matrix4::from(const Matrix3x3<T>&, const Vector3<T>&)
          */
-        Matrix3x3<T> toMatrix() const;
+        constexpr Matrix3x3<T> toMatrix() const;
 
         /**
          * @brief Add and assign quaternion
@@ -327,8 +327,8 @@ template<class T> class Quaternion {
          *
          * @see @ref operator+=()
          */
-        Quaternion<T> operator+(const Quaternion<T>& other) const {
-            return Quaternion<T>(*this) += other;
+        constexpr Quaternion<T> operator+(const Quaternion<T>& other) const {
+            return {_vector + other._vector, _scalar + other._scalar};
         }
 
         /**
@@ -338,7 +338,7 @@ template<class T> class Quaternion {
          *      -q = [-\boldsymbol q_V, -q_S]
          * @f]
          */
-        Quaternion<T> operator-() const { return {-_vector, -_scalar}; }
+        constexpr Quaternion<T> operator-() const { return {-_vector, -_scalar}; }
 
         /**
          * @brief Subtract and assign quaternion
@@ -358,8 +358,8 @@ template<class T> class Quaternion {
          *
          * @see @ref operator-=()
          */
-        Quaternion<T> operator-(const Quaternion<T>& other) const {
-            return Quaternion<T>(*this) -= other;
+        constexpr Quaternion<T> operator-(const Quaternion<T>& other) const {
+            return {_vector - other._vector, _scalar - other._scalar};
         }
 
         /**
@@ -380,8 +380,8 @@ template<class T> class Quaternion {
          *
          * @see @ref operator*=(T)
          */
-        Quaternion<T> operator*(T scalar) const {
-            return Quaternion<T>(*this) *= scalar;
+        constexpr Quaternion<T> operator*(T scalar) const {
+            return {_vector*scalar, _scalar*scalar};
         }
 
         /**
@@ -402,8 +402,8 @@ template<class T> class Quaternion {
          *
          * @see @ref operator/=(T)
          */
-        Quaternion<T> operator/(T scalar) const {
-            return Quaternion<T>(*this) /= scalar;
+        constexpr Quaternion<T> operator/(T scalar) const {
+            return {_vector/scalar, _scalar/scalar};
         }
 
         /**
@@ -414,7 +414,7 @@ template<class T> class Quaternion {
          *             p_S q_S - \boldsymbol p_V \cdot \boldsymbol q_V]
          * @f]
          */
-        Quaternion<T> operator*(const Quaternion<T>& other) const;
+        constexpr Quaternion<T> operator*(const Quaternion<T>& other) const;
 
         /**
          * @brief Dot product of the quaternion
@@ -427,7 +427,7 @@ template<class T> class Quaternion {
          * @see @ref isNormalized(),
          *      @ref dot(const Quaternion<T>&, const Quaternion<T>&)
          */
-        T dot() const { return Math::dot(*this, *this); }
+        constexpr T dot() const { return Math::dot(*this, *this); }
 
         /**
          * @brief Quaternion length
@@ -454,7 +454,7 @@ template<class T> class Quaternion {
          *      q^* = [-\boldsymbol q_V, q_S]
          * @f]
          */
-        Quaternion<T> conjugated() const { return {-_vector, _scalar}; }
+        constexpr Quaternion<T> conjugated() const { return {-_vector, _scalar}; }
 
         /**
          * @brief Inverted quaternion
@@ -464,7 +464,7 @@ template<class T> class Quaternion {
          *      q^{-1} = \frac{q^*}{|q|^2} = \frac{q^*}{q \cdot q}
          * @f]
          */
-        Quaternion<T> inverted() const { return conjugated()/dot(); }
+        constexpr Quaternion<T> inverted() const { return conjugated()/dot(); }
 
         /**
          * @brief Inverted normalized quaternion
@@ -489,7 +489,7 @@ template<class T> class Quaternion {
          *      @ref DualQuaternion::transformPoint(),
          *      @ref Complex::transformVector()
          */
-        Vector3<T> transformVector(const Vector3<T>& vector) const {
+        constexpr Vector3<T> transformVector(const Vector3<T>& vector) const {
             return ((*this)*Quaternion<T>(vector)*inverted()).vector();
         }
 
@@ -529,7 +529,7 @@ template<class T> class Quaternion {
 
 Same as @ref Quaternion::operator*(T) const.
 */
-template<class T> inline Quaternion<T> operator*(T scalar, const Quaternion<T>& quaternion) {
+template<class T> constexpr Quaternion<T> operator*(T scalar, const Quaternion<T>& quaternion) {
     return quaternion*scalar;
 }
 
@@ -541,7 +541,7 @@ template<class T> inline Quaternion<T> operator*(T scalar, const Quaternion<T>&
 @f]
 @see @ref Quaternion::operator/()
 */
-template<class T> inline Quaternion<T> operator/(T scalar, const Quaternion<T>& quaternion) {
+template<class T> constexpr Quaternion<T> operator/(T scalar, const Quaternion<T>& quaternion) {
     return {scalar/quaternion.vector(), scalar/quaternion.scalar()};
 }
 
@@ -619,7 +619,7 @@ template<class T> inline Vector3<T> Quaternion<T>::axis() const {
     return _vector/std::sqrt(1-pow2(_scalar));
 }
 
-template<class T> Matrix3x3<T> Quaternion<T>::toMatrix() const {
+template<class T> constexpr Matrix3x3<T> Quaternion<T>::toMatrix() const {
     return {
         Vector<3, T>(T(1) - 2*pow2(_vector.y()) - 2*pow2(_vector.z()),
             2*_vector.x()*_vector.y() + 2*_vector.z()*_scalar,
@@ -633,9 +633,28 @@ template<class T> Matrix3x3<T> Quaternion<T>::toMatrix() const {
     };
 }
 
-template<class T> inline Quaternion<T> Quaternion<T>::operator*(const Quaternion<T>& other) const {
-    return {_scalar*other._vector + other._scalar*_vector + Math::cross(_vector, other._vector),
-            _scalar*other._scalar - Math::dot(_vector, other._vector)};
+namespace Implementation {
+
+template<class T> constexpr Quaternion<T> quaternionMultiply(const Quaternion<T>& a, const Quaternion<T>& b) {
+    return {a.scalar()*b.vector() + b.scalar()*a.vector() + Math::cross(a.vector(), b.vector()),
+            a.scalar()*b.scalar() - Math::dot(a.vector(), b.vector())};
+}
+
+#ifdef MAGNUM_MATH_SIMD
+/* The vector part is directly followed by the scalar part */
+static_assert(sizeof(Quaternion<float>) == 4*sizeof(float), "improper size of Quaternion");
+
+inline Quaternion<float> quaternionMultiply(const Quaternion<float>& a, const Quaternion<float>& b) {
+    Quaternion<float> out{NoInit};
+    simdMultiplyQuaternion(reinterpret_cast<const float*>(&a), reinterpret_cast<const float*>(&b), reinterpret_cast<float*>(&out));
+    return out;
+}
+#endif
+
+}
+
+template<class T> constexpr Quaternion<T> Quaternion<T>::operator*(const Quaternion<T>& other) const {
+    return Implementation::quaternionMultiply(*this, other);
 }
 
 template<class T> inline Quaternion<T> Quaternion<T>::invertedNormalized() const {
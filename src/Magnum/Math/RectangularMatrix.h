@@ -193,7 +193,9 @@ template<std::size_t cols, std::size_t rows, class T> class RectangularMatrix {
          * stored.
          * @see @ref setRow(), @ref operator[]()
          */
-        Vector<cols, T> row(std::size_t row) const;
+        constexpr Vector<cols, T> row(std::size_t row) const {
+            return rowInternal(typename Implementation::GenerateSequence<cols>::Type{}, row);
+        }
 
         /**
          * @brief Set matrix row
@@ -230,7 +232,9 @@ template<std::size_t cols, std::size_t rows, class T> class RectangularMatrix {
          *      \boldsymbol B_j = -\boldsymbol A_j
          * @f]
          */
-        RectangularMatrix<cols, rows, T> operator-() const;
+        constexpr RectangularMatrix<cols, rows, T> operator-() const {
+            return negatedInternal(typename Implementation::GenerateSequence<cols>::Type{});
+        }
 
         /**
          * @brief Add and assign matrix
@@ -251,8 +255,8 @@ template<std::size_t cols, std::size_t rows, class T> class RectangularMatrix {
          *
          * @see @ref operator+=()
          */
-        RectangularMatrix<cols, rows, T> operator+(const RectangularMatrix<cols, rows, T>& other) const {
-            return RectangularMatrix<cols, rows, T>(*this)+=other;
+        constexpr RectangularMatrix<cols, rows, T> operator+(const RectangularMatrix<cols, rows, T>& other) const {
+            return addedInternal(typename Implementation::GenerateSequence<cols>::Type{}, other);
         }
 
         /**
@@ -274,8 +278,8 @@ template<std::size_t cols, std::size_t rows, class T> class RectangularMatrix {
          *
          * @see @ref operator-=()
          */
-        RectangularMatrix<cols, rows, T> operator-(const RectangularMatrix<cols, rows, T>& other) const {
-            return RectangularMatrix<cols, rows, T>(*this)-=other;
+        constexpr RectangularMatrix<cols, rows, T> operator-(const RectangularMatrix<cols, rows, T>& other) const {
+            return subtractedInternal(typename Implementation::GenerateSequence<cols>::Type{}, other);
         }
 
         /**
@@ -297,8 +301,8 @@ template<std::size_t cols, std::size_t rows, class T> class RectangularMatrix {
          *
          * @see @ref operator*=(T), @ref operator*(T, const RectangularMatrix<cols, rows, T>&)
          */
-        RectangularMatrix<cols, rows, T> operator*(T number) const {
-            return RectangularMatrix<cols, rows, T>(*this) *= number;
+        constexpr RectangularMatrix<cols, rows, T> operator*(T number) const {
+            return multipliedInternal(typename Implementation::GenerateSequence<cols>::Type{}, number);
         }
 
         /**
@@ -321,8 +325,8 @@ template<std::size_t cols, std::size_t rows, class T> class RectangularMatrix {
          * @see @ref operator/=(T),
          *      @ref operator/(T, const RectangularMatrix<cols, rows, T>&)
          */
-        RectangularMatrix<cols, rows, T> operator/(T number) const {
-            return RectangularMatrix<cols, rows, T>(*this) /= number;
+        constexpr RectangularMatrix<cols, rows, T> operator/(T number) const {
+            return dividedInternal(typename Implementation::GenerateSequence<cols>::Type{}, number);
         }
 
         /**
@@ -332,7 +336,7 @@ template<std::size_t cols, std::size_t rows, class T> class RectangularMatrix {
          *      (\boldsymbol {AB})_{ji} = \sum_{k=0}^{m-1} \boldsymbol A_{ki} \boldsymbol B_{jk}
          * @f]
          */
-        template<std::size_t size> RectangularMatrix<size, rows, T> operator*(const RectangularMatrix<size, cols, T>& other) const;
+        template<std::size_t size> constexpr RectangularMatrix<size, rows, T> operator*(const RectangularMatrix<size, cols, T>& other) const;
 
         /**
          * @brief Multiply vector
@@ -342,8 +346,8 @@ template<std::size_t cols, std::size_t rows, class T> class RectangularMatrix {
          *      (\boldsymbol {Aa})_i = \sum_{k=0}^{m-1} \boldsymbol A_{ki} \boldsymbol a_k
          * @f]
          */
-        Vector<rows, T> operator*(const Vector<cols, T>& other) const {
-            return operator*(RectangularMatrix<1, cols, T>(other))[0];
+        constexpr Vector<rows, T> operator*(const Vector<cols, T>& other) const {
+            return firstColumn(operator*(RectangularMatrix<1, cols, T>(other)));
         }
 
         /**
@@ -354,7 +358,7 @@ template<std::size_t cols, std::size_t rows, class T> class RectangularMatrix {
          * @f]
          * @see @ref row(), @ref flippedCols(), @ref flippedRows()
          */
-        RectangularMatrix<rows, cols, T> transposed() const;
+        constexpr RectangularMatrix<rows, cols, T> transposed() const;
 
         /**
          * @brief Matrix with flipped cols
@@ -422,6 +426,33 @@ template<std::size_t cols, std::size_t rows, class T> class RectangularMatrix {
 
         template<std::size_t ...sequence> constexpr Vector<DiagonalSize, T> diagonalInternal(Implementation::Sequence<sequence...>) const;
 
+        /* Implementation for operator*(const Vector<cols, T>&), the
+           temporary would pick the non-const operator[]() otherwise */
+        constexpr static Vector<rows, T> firstColumn(const RectangularMatrix<1, rows, T>& matrix) {
+            return matrix[0];
+        }
+
+        template<std::size_t ...sequence> constexpr Vector<cols, T> rowInternal(Implementation::Sequence<sequence...>, std::size_t row) const {
+            return {_data[sequence][row]...};
+        }
+
+        /* Implementation for constexpr arithmetic operators */
+        template<std::size_t ...sequence> constexpr RectangularMatrix<cols, rows, T> negatedInternal(Implementation::Sequence<sequence...>) const {
+            return {-_data[sequence]...};
+        }
+        template<std::size_t ...sequence> constexpr RectangularMatrix<cols, rows, T> addedInternal(Implementation::Sequence<sequence...>, const RectangularMatrix<cols, rows, T>& other) const {
+            return {(_data[sequence] + other._data[sequence])...};
+        }
+        template<std::size_t ...sequence> constexpr RectangularMatrix<cols, rows, T> subtractedInternal(Implementation::Sequence<sequence...>, const RectangularMatrix<cols, rows, T>& other) const {
+            return {(_data[sequence] - other._data[sequence])...};
+        }
+        template<std::size_t ...sequence> constexpr RectangularMatrix<cols, rows, T> multipliedInternal(Implementation::Sequence<sequence...>, T number) const {
+            return {(_data[sequence]*number)...};
+        }
+        template<std::size_t ...sequence> constexpr RectangularMatrix<cols, rows, T> dividedInternal(Implementation::Sequence<sequence...>, T number) const {
+            return {(_data[sequence]/number)...};
+        }
+
         Vector<rows, T> _data[cols];
 };
 
@@ -496,7 +527,7 @@ template<class T> using Matrix4x3 = RectangularMatrix<4, 3, T>;
 
 Same as @ref RectangularMatrix::operator*(T) const.
 */
-template<std::size_t cols, std::size_t rows, class T> inline RectangularMatrix<cols, rows, T> operator*(
+template<std::size_t cols, std::size_t rows, class T> constexpr RectangularMatrix<cols, rows, T> operator*(
     #ifdef DOXYGEN_GENERATING_OUTPUT
     T
     #else
@@ -515,7 +546,15 @@ The computation is done column-wise. @f[
 @f]
 @see @ref RectangularMatrix::operator/(T) const
 */
-template<std::size_t cols, std::size_t rows, class T> inline RectangularMatrix<cols, rows, T> operator/(
+#ifndef DOXYGEN_GENERATING_OUTPUT
+namespace Implementation {
+    template<std::size_t cols, std::size_t rows, class T, std::size_t ...sequence> constexpr RectangularMatrix<cols, rows, T> divideNumber(Sequence<sequence...>, T number, const RectangularMatrix<cols, rows, T>& matrix) {
+        return {(number/matrix[sequence])...};
+    }
+}
+#endif
+
+template<std::size_t cols, std::size_t rows, class T> constexpr RectangularMatrix<cols, rows, T> operator/(
     #ifdef DOXYGEN_GENERATING_OUTPUT
     T
     #else
@@ -523,12 +562,7 @@ template<std::size_t cols, std::size_t rows, class T> inline RectangularMatrix<c
     #endif
     number, const RectangularMatrix<cols, rows, T>& matrix)
 {
-    RectangularMatrix<cols, rows, T> out{NoInit};
-
-    for(std::size_t i = 0; i != cols; ++i)
-        out[i] = number/matrix[i];
-
-    return out;
+    return Implementation::divideNumber(typename Implementation::GenerateSequence<cols>::Type{}, number, matrix);
 }
 
 /** @relates RectangularMatrix
@@ -539,7 +573,7 @@ Internally the same as multiplying one-column matrix with one-row matrix. @f[
 @f]
 @see @ref RectangularMatrix::operator*(const RectangularMatrix<size, cols, T>&) const
 */
-template<std::size_t size, std::size_t cols, class T> inline RectangularMatrix<cols, size, T> operator*(const Vector<size, T>& vector, const RectangularMatrix<cols, 1, T>& matrix) {
+template<std::size_t size, std::size_t cols, class T> constexpr RectangularMatrix<cols, size, T> operator*(const Vector<size, T>& vector, const RectangularMatrix<cols, 1, T>& matrix) {
     return RectangularMatrix<1, size, T>(vector)*matrix;
 }
 
@@ -591,35 +625,35 @@ extern template MAGNUM_EXPORT Corrade::Utility::Debug& operator<<(Corrade::Utili
         return Math::RectangularMatrix<cols, rows, T>::fromDiagonal(diagonal); \
     }                                                                       \
                                                                             \
-    __VA_ARGS__ operator-() const {                                         \
+    constexpr __VA_ARGS__ operator-() const {                               \
         return Math::RectangularMatrix<cols, rows, T>::operator-();         \
     }                                                                       \
     __VA_ARGS__& operator+=(const Math::RectangularMatrix<cols, rows, T>& other) { \
         Math::RectangularMatrix<cols, rows, T>::operator+=(other);          \
         return *this;                                                       \
     }                                                                       \
-    __VA_ARGS__ operator+(const Math::RectangularMatrix<cols, rows, T>& other) const { \
+    constexpr __VA_ARGS__ operator+(const Math::RectangularMatrix<cols, rows, T>& other) const { \
         return Math::RectangularMatrix<cols, rows, T>::operator+(other);    \
     }                                                                       \
     __VA_ARGS__& operator-=(const Math::RectangularMatrix<cols, rows, T>& other) { \
         Math::RectangularMatrix<cols, rows, T>::operator-=(other);          \
         return *this;                                                       \
     }                                                                       \
-    __VA_ARGS__ operator-(const Math::RectangularMatrix<cols, rows, T>& other) const { \
+    constexpr __VA_ARGS__ operator-(const Math::RectangularMatrix<cols, rows, T>& other) const { \
         return Math::RectangularMatrix<cols, rows, T>::operator-(other);    \
     }                                                                       \
     __VA_ARGS__& operator*=(T number) {                                     \
         Math::RectangularMatrix<cols, rows, T>::operator*=(number);         \
         return *this;                                                       \
     }                                                                       \
-    __VA_ARGS__ operator*(T number) const {                                 \
+    constexpr __VA_ARGS__ operator*(T number) const {                       \
         return Math::RectangularMatrix<cols, rows, T>::operator*(number);   \
     }                                                                       \
     __VA_ARGS__& operator/=(T number) {                                     \
         Math::RectangularMatrix<cols, rows, T>::operator/=(number);         \
         return *this;                                                       \
     }                                                                       \
-    __VA_ARGS__ operator/(T number) const {                                 \
+    constexpr __VA_ARGS__ operator/(T number) const {                       \
         return Math::RectangularMatrix<cols, rows, T>::operator/(number);   \
     }                                                                       \
     constexpr __VA_ARGS__ flippedCols() const {                             \
@@ -630,24 +664,24 @@ extern template MAGNUM_EXPORT Corrade::Utility::Debug& operator<<(Corrade::Utili
     }                                                                       \
 
 #define MAGNUM_MATRIX_OPERATOR_IMPLEMENTATION(...)                          \
-    template<std::size_t size, class T> inline __VA_ARGS__ operator*(typename std::common_type<T>::type number, const __VA_ARGS__& matrix) { \
+    template<std::size_t size, class T> constexpr __VA_ARGS__ operator*(typename std::common_type<T>::type number, const __VA_ARGS__& matrix) { \
         return number*static_cast<const Math::RectangularMatrix<size, size, T>&>(matrix); \
     }                                                                       \
-    template<std::size_t size, class T> inline __VA_ARGS__ operator/(typename std::common_type<T>::type number, const __VA_ARGS__& matrix) { \
+    template<std::size_t size, class T> constexpr __VA_ARGS__ operator/(typename std::common_type<T>::type number, const __VA_ARGS__& matrix) { \
         return number/static_cast<const Math::RectangularMatrix<size, size, T>&>(matrix); \
     }                                                                       \
-    template<std::size_t size, class T> inline __VA_ARGS__ operator*(const Vector<size, T>& vector, const RectangularMatrix<size, 1, T>& matrix) { \
+    template<std::size_t size, class T> constexpr __VA_ARGS__ operator*(const Vector<size, T>& vector, const RectangularMatrix<size, 1, T>& matrix) { \
         return Math::RectangularMatrix<1, size, T>(vector)*matrix;          \
     }
 
 #define MAGNUM_MATRIXn_OPERATOR_IMPLEMENTATION(size, Type)                  \
-    template<class T> inline Type<T> operator*(typename std::common_type<T>::type number, const Type<T>& matrix) { \
+    template<class T> constexpr Type<T> operator*(typename std::common_type<T>::type number, const Type<T>& matrix) { \
         return number*static_cast<const Math::RectangularMatrix<size, size, T>&>(matrix); \
     }                                                                       \
-    template<class T> inline Type<T> operator/(typename std::common_type<T>::type number, const Type<T>& matrix) { \
+    template<class T> constexpr Type<T> operator/(typename std::common_type<T>::type number, const Type<T>& matrix) { \
         return number/static_cast<const Math::RectangularMatrix<size, size, T>&>(matrix); \
     }                                                                       \
-    template<class T> inline Type<T> operator*(const Vector<size, T>& vector, const RectangularMatrix<size, 1, T>& matrix) { \
+    template<class T> constexpr Type<T> operator*(const Vector<size, T>& vector, const RectangularMatrix<size, 1, T>& matrix) { \
         return Math::RectangularMatrix<1, size, T>(vector)*matrix;          \
     }
 #endif
@@ -663,48 +697,68 @@ namespace Implementation {
 
 template<std::size_t cols, std::size_t rows, class T> template<std::size_t ...sequence> constexpr RectangularMatrix<cols, rows, T>::RectangularMatrix(Implementation::Sequence<sequence...>, const Vector<DiagonalSize, T>& diagonal): _data{Implementation::diagonalMatrixColumn<rows, sequence>(sequence < DiagonalSize ? diagonal[sequence] : T{})...} {}
 
-template<std::size_t cols, std::size_t rows, class T> inline Vector<cols, T> RectangularMatrix<cols, rows, T>::row(std::size_t row) const {
-    Vector<cols, T> out;
-
+template<std::size_t cols, std::size_t rows, class T> inline void RectangularMatrix<cols, rows, T>::setRow(std::size_t row, const Vector<cols, T>& data) {
     for(std::size_t i = 0; i != cols; ++i)
-        out[i] = _data[i][row];
+        _data[i][row] = data[i];
+}
 
-    return out;
+namespace Implementation {
+
+/* Each element is a left fold over products of the row and column, so the
+   result is the same as with a plain triple loop */
+template<std::size_t size, std::size_t cols, std::size_t rows, class T, std::size_t ...sequence> constexpr T matrixMultiplyElement(Sequence<sequence...>, const RectangularMatrix<cols, rows, T>& a, const RectangularMatrix<size, cols, T>& b, std::size_t col, std::size_t row) {
+    return foldAdd(T(0), T(a[sequence][row]*b[col][sequence])...);
 }
 
-template<std::size_t cols, std::size_t rows, class T> inline void RectangularMatrix<cols, rows, T>::setRow(std::size_t row, const Vector<cols, T>& data) {
-    for(std::size_t i = 0; i != cols; ++i)
-        _data[i][row] = data[i];
+template<std::size_t size, std::size_t cols, std::size_t rows, class T, std::size_t ...sequence> constexpr Vector<rows, T> matrixMultiplyColumn(Sequence<sequence...>, const RectangularMatrix<cols, rows, T>& a, const RectangularMatrix<size, cols, T>& b, std::size_t col) {
+    return {matrixMultiplyElement(typename GenerateSequence<cols>::Type{}, a, b, col, sequence)...};
 }
 
-template<std::size_t cols, std::size_t rows, class T> inline RectangularMatrix<cols, rows, T> RectangularMatrix<cols, rows, T>::operator-() const {
-    RectangularMatrix<cols, rows, T> out;
+template<std::size_t size, std::size_t cols, std::size_t rows, class T, std::size_t ...sequence> constexpr RectangularMatrix<size, rows, T> matrixMultiply(Sequence<sequence...>, const RectangularMatrix<cols, rows, T>& a, const RectangularMatrix<size, cols, T>& b) {
+    return {matrixMultiplyColumn(typename GenerateSequence<rows>::Type{}, a, b, sequence)...};
+}
 
-    for(std::size_t i = 0; i != cols; ++i)
-        out._data[i] = -_data[i];
+template<std::size_t size, std::size_t cols, std::size_t rows, class T> constexpr RectangularMatrix<size, rows, T> matrixMultiply(const RectangularMatrix<cols, rows, T>& a, const RectangularMatrix<size, cols, T>& b) {
+    return matrixMultiply(typename GenerateSequence<size>::Type{}, a, b);
+}
 
-    return out;
+template<std::size_t cols, std::size_t rows, class T, std::size_t ...sequence> constexpr RectangularMatrix<rows, cols, T> matrixTranspose(Sequence<sequence...>, const RectangularMatrix<cols, rows, T>& matrix) {
+    return {matrix.row(sequence)...};
 }
 
-template<std::size_t cols, std::size_t rows, class T> template<std::size_t size> inline RectangularMatrix<size, rows, T> RectangularMatrix<cols, rows, T>::operator*(const RectangularMatrix<size, cols, T>& other) const {
-    RectangularMatrix<size, rows, T> out{ZeroInit};
+template<std::size_t cols, std::size_t rows, class T> constexpr RectangularMatrix<rows, cols, T> matrixTranspose(const RectangularMatrix<cols, rows, T>& matrix) {
+    return matrixTranspose(typename GenerateSequence<rows>::Type{}, matrix);
+}
 
-    for(std::size_t col = 0; col != size; ++col)
-        for(std::size_t row = 0; row != rows; ++row)
-            for(std::size_t pos = 0; pos != cols; ++pos)
-                out[col][row] += _data[pos][row]*other._data[col][pos];
+/* Non-template overloads are preferred over the generic versions above */
+#ifdef MAGNUM_MATH_SIMD
+inline RectangularMatrix<4, 4, float> matrixMultiply(const RectangularMatrix<4, 4, float>& a, const RectangularMatrix<4, 4, float>& b) {
+    RectangularMatrix<4, 4, float> out{NoInit};
+    simdMultiplyMatrix4(a.data(), b.data(), out.data());
+    return out;
+}
 
+inline RectangularMatrix<1, 4, float> matrixMultiply(const RectangularMatrix<4, 4, float>& a, const RectangularMatrix<1, 4, float>& b) {
+    RectangularMatrix<1, 4, float> out{NoInit};
+    simdMultiplyMatrix4Vector4(a.data(), b.data(), out.data());
     return out;
 }
 
-template<std::size_t cols, std::size_t rows, class T> inline RectangularMatrix<rows, cols, T> RectangularMatrix<cols, rows, T>::transposed() const {
-    RectangularMatrix<rows, cols, T> out{NoInit};
+inline RectangularMatrix<4, 4, float> matrixTranspose(const RectangularMatrix<4, 4, float>& matrix) {
+    RectangularMatrix<4, 4, float> out{NoInit};
+    simdTransposeMatrix4(matrix.data(), out.data());
+    return out;
+}
+#endif
 
-    for(std::size_t col = 0; col != cols; ++col)
-        for(std::size_t row = 0; row != rows; ++row)
-            out[row][col] = _data[col][row];
+}
 
-    return out;
+template<std::size_t cols, std::size_t rows, class T> template<std::size_t size> constexpr RectangularMatrix<size, rows, T> RectangularMatrix<cols, rows, T>::operator*(const RectangularMatrix<size, cols, T>& other) const {
+    return Implementation::matrixMultiply(*this, other);
+}
+
+template<std::size_t cols, std::size_t rows, class T> constexpr RectangularMatrix<rows, cols, T> RectangularMatrix<cols, rows, T>::transposed() const {
+    return Implementation::matrixTranspose(*this);
 }
 
 template<std::size_t cols, std::size_t rows, class T> constexpr auto RectangularMatrix<cols, rows, T>::diagonal() const -> Vector<DiagonalSize, T> { return diagonalInternal(typename Implementation::GenerateSequence<DiagonalSize>::Type()); }
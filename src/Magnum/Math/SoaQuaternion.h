@@ -0,0 +1,179 @@
+#ifndef Magnum_Math_SoaQuaternion_h
+#define Magnum_Math_SoaQuaternion_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Math::SoaQuaternion, function @ref Magnum::Math::dot(const SoaQuaternion<size, T>&, const SoaQuaternion<size, T>&)
+ */
+
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/Math/SoaVector3.h"
+
+namespace Magnum { namespace Math {
+
+/**
+@brief Block of quaternions in structure-of-arrays layout
+@tparam size    Count of quaternions in the block
+@tparam T       Underlying data type
+
+Component-wise counterpart to @ref Quaternion, see @ref SoaVector3 for more
+information. Together with @ref SoaVector3 it can be used to compose rigid
+transformations of whole batches of objects, equivalent to multiplying
+@ref DualQuaternion instances:
+@code
+// rotation = parentRotation*rotation, translation = parentRotation*translation + parentTranslation
+Math::SoaQuaternion<8, Float> rotation = parentRotation*localRotation;
+Math::SoaVector3<8, Float> translation = parentRotation.transformVectorNormalized(localTranslation) + parentTranslation;
+@endcode
+*/
+template<std::size_t size, class T> class SoaQuaternion {
+    public:
+        /** @brief Load from contiguous array of @p size quaternions */
+        static SoaQuaternion<size, T> from(const Quaternion<T>* data) {
+            SoaQuaternion<size, T> out{NoInit};
+            for(std::size_t i = 0; i != size; ++i)
+                out.set(i, data[i]);
+            return out;
+        }
+
+        /**
+         * @brief Default constructor
+         *
+         * All quaternions are set to identity.
+         */
+        constexpr /*implicit*/ SoaQuaternion() noexcept: _scalar{T(1)} {}
+
+        /** @brief Construct without initializing the contents */
+        explicit SoaQuaternion(NoInitT) noexcept: _vector{NoInit}, _scalar{NoInit} {}
+
+        /** @brief Construct from vector and scalar parts */
+        constexpr /*implicit*/ SoaQuaternion(const SoaVector3<size, T>& vector, const Vector<size, T>& scalar) noexcept: _vector{vector}, _scalar{scalar} {}
+
+        /** @brief Construct a block with the same quaternion in all places */
+        constexpr explicit SoaQuaternion(const Quaternion<T>& value) noexcept: _vector{value.vector()}, _scalar{value.scalar()} {}
+
+        /** @brief Store to contiguous array of @p size quaternions */
+        void to(Quaternion<T>* data) const {
+            for(std::size_t i = 0; i != size; ++i)
+                data[i] = operator[](i);
+        }
+
+        /** @brief Equality comparison */
+        bool operator==(const SoaQuaternion<size, T>& other) const {
+            return _vector == other._vector && _scalar == other._scalar;
+        }
+
+        /** @brief Non-equality comparison */
+        bool operator!=(const SoaQuaternion<size, T>& other) const {
+            return !operator==(other);
+        }
+
+        /** @brief Quaternion at given position */
+        Quaternion<T> operator[](std::size_t i) const { return {_vector[i], _scalar[i]}; }
+
+        /** @brief Set quaternion at given position */
+        void set(std::size_t i, const Quaternion<T>& value) {
+            _vector.set(i, value.vector());
+            _scalar[i] = value.scalar();
+        }
+
+        /** @brief Vector parts */
+        SoaVector3<size, T>& vector() { return _vector; }
+        constexpr const SoaVector3<size, T> vector() const { return _vector; } /**< @overload */
+
+        /** @brief Scalar parts */
+        Vector<size, T>& scalar() { return _scalar; }
+        constexpr const Vector<size, T> scalar() const { return _scalar; } /**< @overload */
+
+        /**
+         * @brief Multiply corresponding quaternions
+         *
+         * Same as @ref Quaternion::operator*(const Quaternion<T>&) const
+         * done for each pair in the blocks.
+         */
+        SoaQuaternion<size, T> operator*(const SoaQuaternion<size, T>& other) const {
+            return {other._vector*_scalar + _vector*other._scalar + Math::cross(_vector, other._vector),
+                    _scalar*other._scalar - Math::dot(_vector, other._vector)};
+        }
+
+        /** @brief Dot product of the quaternions */
+        Vector<size, T> dot() const { return _vector.dot() + _scalar*_scalar; }
+
+        /** @brief Quaternion lengths */
+        Vector<size, T> length() const { return Math::sqrt(dot()); }
+
+        /**
+         * @brief Normalized quaternions
+         *
+         * Expects that none of the quaternions is zero, otherwise the result
+         * contains NaNs.
+         */
+        SoaQuaternion<size, T> normalized() const {
+            const Vector<size, T> lengthInverted = Vector<size, T>{T(1)}/length();
+            return {_vector*lengthInverted, _scalar*lengthInverted};
+        }
+
+        /** @brief Conjugated quaternions */
+        SoaQuaternion<size, T> conjugated() const { return {-_vector, _scalar}; }
+
+        /**
+         * @brief Rotate vectors with normalized quaternions
+         *
+         * Same as @ref Quaternion::transformVectorNormalized() done for each
+         * pair, with the normalization not being checked.
+         */
+        SoaVector3<size, T> transformVectorNormalized(const SoaVector3<size, T>& vectors) const {
+            const SoaVector3<size, T> t = Math::cross(_vector, vectors)*T(2);
+            return vectors + t*_scalar + Math::cross(_vector, t);
+        }
+
+    private:
+        SoaVector3<size, T> _vector;
+        Vector<size, T> _scalar;
+};
+
+/** @relatesalso SoaQuaternion
+@brief Dot products of corresponding quaternions in two blocks
+
+@see @ref dot(const Quaternion<T>&, const Quaternion<T>&)
+*/
+template<std::size_t size, class T> inline Vector<size, T> dot(const SoaQuaternion<size, T>& a, const SoaQuaternion<size, T>& b) {
+    return dot(a.vector(), b.vector()) + a.scalar()*b.scalar();
+}
+
+/** @debugoperator{Magnum::Math::SoaQuaternion} */
+template<std::size_t size, class T> Corrade::Utility::Debug& operator<<(Corrade::Utility::Debug& debug, const SoaQuaternion<size, T>& value) {
+    debug << "SoaQuaternion(" << Corrade::Utility::Debug::nospace;
+    for(std::size_t i = 0; i != size; ++i) {
+        if(i) debug << Corrade::Utility::Debug::nospace << ",";
+        debug << value[i];
+    }
+    return debug << Corrade::Utility::Debug::nospace << ")";
+}
+
+}}
+
+#endif
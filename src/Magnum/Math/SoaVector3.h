@@ -0,0 +1,231 @@
+#ifndef Magnum_Math_SoaVector3_h
+#define Magnum_Math_SoaVector3_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Math::SoaVector3, function @ref Magnum::Math::dot(const SoaVector3<size, T>&, const SoaVector3<size, T>&), @ref Magnum::Math::cross(const SoaVector3<size, T>&, const SoaVector3<size, T>&), @ref Magnum::Math::transformPoint()
+ */
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix4.h"
+
+namespace Magnum { namespace Math {
+
+/**
+@brief Block of three-component vectors in structure-of-arrays layout
+@tparam size    Count of vectors in the block
+@tparam T       Data type
+
+Stores X, Y and Z components of @p size vectors in three separate
+@ref Vector instances, so every operation is a straight loop over
+consecutive values of one component, which compilers turn into SSE / AVX /
+NEON code processing four or eight vectors at once. Use @ref from() and
+@ref to() to convert from and to contiguous arrays of @ref Vector3 and
+process longer arrays block by block:
+@code
+constexpr std::size_t Size = 8;
+for(std::size_t i = 0; i + Size <= positions.size(); i += Size) {
+    auto block = Math::SoaVector3<Size, Float>::from(positions.data() + i);
+    Math::transformPoint(matrix, block).to(positions.data() + i);
+}
+@endcode
+Lengths and dot products are returned as @ref Vector with one value for each
+vector in the block. See @ref SoaQuaternion for a similar block of rotations.
+*/
+template<std::size_t size, class T> class SoaVector3 {
+    public:
+        /** @brief Load from contiguous array of @p size vectors */
+        static SoaVector3<size, T> from(const Vector3<T>* data) {
+            SoaVector3<size, T> out{NoInit};
+            for(std::size_t i = 0; i != size; ++i) {
+                out._x[i] = data[i].x();
+                out._y[i] = data[i].y();
+                out._z[i] = data[i].z();
+            }
+            return out;
+        }
+
+        /**
+         * @brief Default constructor
+         *
+         * All components are set to zero.
+         */
+        constexpr /*implicit*/ SoaVector3() noexcept {}
+
+        /** @brief Construct without initializing the contents */
+        explicit SoaVector3(NoInitT) noexcept: _x{NoInit}, _y{NoInit}, _z{NoInit} {}
+
+        /** @brief Construct from separate components */
+        constexpr /*implicit*/ SoaVector3(const Vector<size, T>& x, const Vector<size, T>& y, const Vector<size, T>& z) noexcept: _x{x}, _y{y}, _z{z} {}
+
+        /** @brief Construct a block with the same vector in all places */
+        constexpr explicit SoaVector3(const Vector3<T>& value) noexcept: _x{value.x()}, _y{value.y()}, _z{value.z()} {}
+
+        /** @brief Store to contiguous array of @p size vectors */
+        void to(Vector3<T>* data) const {
+            for(std::size_t i = 0; i != size; ++i)
+                data[i] = {_x[i], _y[i], _z[i]};
+        }
+
+        /** @brief Equality comparison */
+        bool operator==(const SoaVector3<size, T>& other) const {
+            return _x == other._x && _y == other._y && _z == other._z;
+        }
+
+        /** @brief Non-equality comparison */
+        bool operator!=(const SoaVector3<size, T>& other) const {
+            return !operator==(other);
+        }
+
+        /** @brief Vector at given position */
+        Vector3<T> operator[](std::size_t i) const { return {_x[i], _y[i], _z[i]}; }
+
+        /** @brief Set vector at given position */
+        void set(std::size_t i, const Vector3<T>& value) {
+            _x[i] = value.x();
+            _y[i] = value.y();
+            _z[i] = value.z();
+        }
+
+        /** @brief X components */
+        Vector<size, T>& x() { return _x; }
+        constexpr const Vector<size, T> x() const { return _x; } /**< @overload */
+
+        /** @brief Y components */
+        Vector<size, T>& y() { return _y; }
+        constexpr const Vector<size, T> y() const { return _y; } /**< @overload */
+
+        /** @brief Z components */
+        Vector<size, T>& z() { return _z; }
+        constexpr const Vector<size, T> z() const { return _z; } /**< @overload */
+
+        /** @brief Negated vectors */
+        SoaVector3<size, T> operator-() const { return {-_x, -_y, -_z}; }
+
+        /** @brief Add vectors */
+        SoaVector3<size, T> operator+(const SoaVector3<size, T>& other) const {
+            return {_x + other._x, _y + other._y, _z + other._z};
+        }
+
+        /** @brief Subtract vectors */
+        SoaVector3<size, T> operator-(const SoaVector3<size, T>& other) const {
+            return {_x - other._x, _y - other._y, _z - other._z};
+        }
+
+        /** @brief Multiply vectors component-wise */
+        SoaVector3<size, T> operator*(const SoaVector3<size, T>& other) const {
+            return {_x*other._x, _y*other._y, _z*other._z};
+        }
+
+        /** @brief Multiply each vector with corresponding number */
+        SoaVector3<size, T> operator*(const Vector<size, T>& numbers) const {
+            return {_x*numbers, _y*numbers, _z*numbers};
+        }
+
+        /** @brief Multiply all vectors with a number */
+        SoaVector3<size, T> operator*(T number) const {
+            return {_x*number, _y*number, _z*number};
+        }
+
+        /**
+         * @brief Dot product of the vectors
+         *
+         * @see @ref dot(const SoaVector3<size, T>&, const SoaVector3<size, T>&)
+         */
+        Vector<size, T> dot() const { return _x*_x + _y*_y + _z*_z; }
+
+        /** @brief Vector lengths */
+        Vector<size, T> length() const { return Math::sqrt(dot()); }
+
+        /**
+         * @brief Normalized vectors
+         *
+         * Expects that none of the vectors is zero, otherwise the result
+         * contains NaNs.
+         */
+        SoaVector3<size, T> normalized() const {
+            return operator*(Vector<size, T>{T(1)}/length());
+        }
+
+    private:
+        Vector<size, T> _x, _y, _z;
+};
+
+/** @relatesalso SoaVector3
+@brief Dot products of corresponding vectors in two blocks
+
+@see @ref dot(const Vector<size, T>&, const Vector<size, T>&)
+*/
+template<std::size_t size, class T> inline Vector<size, T> dot(const SoaVector3<size, T>& a, const SoaVector3<size, T>& b) {
+    return a.x()*b.x() + a.y()*b.y() + a.z()*b.z();
+}
+
+/** @relatesalso SoaVector3
+@brief Cross products of corresponding vectors in two blocks
+
+@see @ref cross(const Vector3<T>&, const Vector3<T>&)
+*/
+template<std::size_t size, class T> inline SoaVector3<size, T> cross(const SoaVector3<size, T>& a, const SoaVector3<size, T>& b) {
+    return {a.y()*b.z() - a.z()*b.y(),
+            a.z()*b.x() - a.x()*b.z(),
+            a.x()*b.y() - a.y()*b.x()};
+}
+
+/** @relatesalso SoaVector3
+@brief Transform a block of points with a matrix
+
+Same as calling @ref Matrix4::transformPoint() on each vector in the block.
+*/
+template<std::size_t size, class T> SoaVector3<size, T> transformPoint(const Matrix4<T>& matrix, const SoaVector3<size, T>& points) {
+    return {points.x()*matrix[0][0] + points.y()*matrix[1][0] + points.z()*matrix[2][0] + Vector<size, T>{matrix[3][0]},
+            points.x()*matrix[0][1] + points.y()*matrix[1][1] + points.z()*matrix[2][1] + Vector<size, T>{matrix[3][1]},
+            points.x()*matrix[0][2] + points.y()*matrix[1][2] + points.z()*matrix[2][2] + Vector<size, T>{matrix[3][2]}};
+}
+
+/** @relatesalso SoaVector3
+@brief Transform a block of vectors with a matrix
+
+Same as calling @ref Matrix4::transformVector() on each vector in the block.
+*/
+template<std::size_t size, class T> SoaVector3<size, T> transformVector(const Matrix4<T>& matrix, const SoaVector3<size, T>& vectors) {
+    return {vectors.x()*matrix[0][0] + vectors.y()*matrix[1][0] + vectors.z()*matrix[2][0],
+            vectors.x()*matrix[0][1] + vectors.y()*matrix[1][1] + vectors.z()*matrix[2][1],
+            vectors.x()*matrix[0][2] + vectors.y()*matrix[1][2] + vectors.z()*matrix[2][2]};
+}
+
+/** @debugoperator{Magnum::Math::SoaVector3} */
+template<std::size_t size, class T> Corrade::Utility::Debug& operator<<(Corrade::Utility::Debug& debug, const SoaVector3<size, T>& value) {
+    debug << "SoaVector3(" << Corrade::Utility::Debug::nospace;
+    for(std::size_t i = 0; i != size; ++i) {
+        if(i) debug << Corrade::Utility::Debug::nospace << ",";
+        debug << value[i];
+    }
+    return debug << Corrade::Utility::Debug::nospace << ")";
+}
+
+}}
+
+#endif
@@ -26,7 +26,7 @@
 */
 
 /** @file
- * @brief Tag type @ref Magnum::Math::NoInitT, @ref Magnum::Math::ZeroInitT, @ref Magnum::Math::IdentityInitT, tag @ref Magnum::Math::NoInit, @ref Magnum::Math::ZeroInit, @ref Magnum::Math::IdentityInit
+ * @brief Tag type @ref Magnum::Math::NoInitT, @ref Magnum::Math::ZeroInitT, @ref Magnum::Math::IdentityInitT, @ref Magnum::Math::FastMathT, tag @ref Magnum::Math::NoInit, @ref Magnum::Math::ZeroInit, @ref Magnum::Math::IdentityInit, @ref Magnum::Math::FastMath
  */
 
 #include <Corrade/Containers/Tags.h>
@@ -69,6 +69,20 @@ struct IdentityInitT {
     #endif
 };
 
+/**
+@brief Fast math tag type
+
+Used to select an approximate but faster variant of a function.
+@see @ref FastMath
+*/
+/* Explicit constructor to avoid ambiguous calls when using {} */
+struct FastMathT {
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    struct Init{};
+    constexpr explicit FastMathT(Init) {}
+    #endif
+};
+
 /**
 @brief No initialization tag
 
@@ -95,6 +109,15 @@ Use for construction with transformation set to identity.
 */
 constexpr IdentityInitT IdentityInit{IdentityInitT::Init{}};
 
+/**
+@brief Fast math tag
+
+Use for selecting the approximate variant of a function, such as
+@ref Vector::normalized(FastMathT) const. See @ref Math::Fast for the error
+bounds.
+*/
+constexpr FastMathT FastMath{FastMathT::Init{}};
+
 }}
 
 #endif
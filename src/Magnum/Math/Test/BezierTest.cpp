@@ -25,7 +25,9 @@
 */
 
 #include <sstream>
+#include <vector>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
 #include <Corrade/Utility/Configuration.h>
 
 #include "Magnum/Math/Bezier.h"
@@ -61,6 +63,13 @@ struct BezierTest : Corrade::TestSuite::Tester {
     void subdivideQuadratic();
     void subdivideCubic();
 
+    void valuesUniform();
+    void valuesUniformSingle();
+    void valuesArray();
+    void flattenLinear();
+    void flattenCubic();
+    void arcLength();
+
     void debug();
     void configuration();
 };
@@ -83,6 +92,13 @@ BezierTest::BezierTest() {
               &BezierTest::subdivideQuadratic,
               &BezierTest::subdivideCubic,
 
+              &BezierTest::valuesUniform,
+              &BezierTest::valuesUniformSingle,
+              &BezierTest::valuesArray,
+              &BezierTest::flattenLinear,
+              &BezierTest::flattenCubic,
+              &BezierTest::arcLength,
+
               &BezierTest::debug,
               &BezierTest::configuration});
 }
@@ -231,6 +247,102 @@ void BezierTest::subdivideCubic() {
     CORRADE_COMPARE(right, (CubicBezier2D{Vector2{7.10938f, 6.57812f}, Vector2{13.4375f, 8.6875f}, Vector2{16.25f, -2.0f}, Vector2{5.0f, -20.0f}}));
 }
 
+void BezierTest::valuesUniform() {
+    CubicBezier2D bezier{Vector2{0.0f, 0.0f}, Vector2{10.0f, 15.0f}, Vector2{20.0f, 4.0f}, Vector2{5.0f, -20.0f}};
+
+    std::vector<Vector2> points(11);
+    bezier.values({points.data(), points.size()});
+    for(std::size_t i = 0; i != points.size(); ++i)
+        CORRADE_COMPARE(points[i], bezier.value(i*0.1f));
+
+    /* End points are exact */
+    CORRADE_VERIFY(points.front() == bezier[0]);
+    CORRADE_VERIFY(points.back() == bezier[3]);
+
+    /* Many points don't accumulate too much error */
+    std::vector<Vector2> many(10001);
+    QuadraticBezier2D{Vector2{0.0f, 0.0f}, Vector2{10.0f, 15.0f}, Vector2{20.0f, 4.0f}}.values({many.data(), many.size()});
+    CORRADE_COMPARE(many[5000], (Vector2{10.0f, 8.5f}));
+}
+
+void BezierTest::valuesUniformSingle() {
+    QuadraticBezier2D bezier{Vector2{0.0f, 0.0f}, Vector2{10.0f, 15.0f}, Vector2{20.0f, 4.0f}};
+
+    Vector2 point[1];
+    bezier.values({point, 1});
+    CORRADE_COMPARE(point[0], bezier[0]);
+
+    /* Empty view does nothing */
+    bezier.values(nullptr);
+}
+
+void BezierTest::valuesArray() {
+    CubicBezier2D bezier{Vector2{0.0f, 0.0f}, Vector2{10.0f, 15.0f}, Vector2{20.0f, 4.0f}, Vector2{5.0f, -20.0f}};
+
+    const Float t[]{0.2f, 0.5f, 1.0f, 0.0f};
+    Vector2 points[4];
+    bezier.values(t, {points, 4});
+    CORRADE_COMPARE(points[0], (Vector2{5.8f, 5.984f}));
+    CORRADE_COMPARE(points[1], (Vector2{11.875f, 4.625f}));
+    CORRADE_COMPARE(points[2], bezier[3]);
+    CORRADE_COMPARE(points[3], bezier[0]);
+}
+
+void BezierTest::flattenLinear() {
+    LinearBezier2D bezier{Vector2{0.0f, 0.0f}, Vector2{20.0f, 4.0f}};
+
+    /* A line is flat already */
+    const std::vector<Math::Vector<2, Float>> points = bezier.flatten(0.001f);
+    CORRADE_COMPARE(points.size(), 2);
+    CORRADE_COMPARE(points[0], bezier[0]);
+    CORRADE_COMPARE(points[1], bezier[1]);
+}
+
+void BezierTest::flattenCubic() {
+    CubicBezier2D bezier{Vector2{0.0f, 0.0f}, Vector2{10.0f, 15.0f}, Vector2{20.0f, 4.0f}, Vector2{5.0f, -20.0f}};
+
+    const std::vector<Math::Vector<2, Float>> coarse = bezier.flatten(1.0f);
+    const std::vector<Math::Vector<2, Float>> fine = bezier.flatten(0.01f);
+    CORRADE_COMPARE(coarse.front(), bezier[0]);
+    CORRADE_COMPARE(coarse.back(), bezier[3]);
+    CORRADE_VERIFY(coarse.size() < fine.size());
+
+    /* Every point of the curve is within tolerance from the polyline */
+    for(const std::vector<Math::Vector<2, Float>>* polyline: {&coarse, &fine}) {
+        const Float tolerance = polyline == &coarse ? 1.0f : 0.01f;
+        for(std::size_t i = 0; i <= 1000; ++i) {
+            const Vector2 point = bezier.value(i*0.001f);
+            Float distance = Constants<Float>::inf();
+            for(std::size_t j = 1; j != polyline->size(); ++j) {
+                const Vector2 a = (*polyline)[j - 1];
+                const Vector2 ab = (*polyline)[j] - a;
+                const Float f = Math::clamp(Math::dot(point - a, ab)/ab.dot(), 0.0f, 1.0f);
+                distance = Math::min(distance, (point - (a + f*ab)).length());
+            }
+            CORRADE_VERIFY(distance <= tolerance);
+        }
+    }
+}
+
+void BezierTest::arcLength() {
+    /* Straight line with non-uniform parametrization */
+    QuadraticBezier2D bezier{Vector2{0.0f, 0.0f}, Vector2{1.0f, 0.0f}, Vector2{10.0f, 0.0f}};
+    const std::vector<Float> table = bezier.arcLengthTable(100);
+    CORRADE_COMPARE(table.size(), 101);
+    CORRADE_COMPARE(table.front(), 0.0f);
+    CORRADE_COMPARE(table.back(), 10.0f);
+
+    CORRADE_COMPARE(QuadraticBezier2D::arcLengthParameter(table, -1.0f), 0.0f);
+    CORRADE_COMPARE(QuadraticBezier2D::arcLengthParameter(table, 11.0f), 1.0f);
+    for(const Float length: {1.0f, 2.5f, 5.0f, 9.0f})
+        CORRADE_COMPARE_WITH(bezier.value(QuadraticBezier2D::arcLengthParameter(table, length))[0], length, TestSuite::Compare::Around<Float>{0.001f});
+
+    /* Quarter of a circle approximation */
+    constexpr Float k = 0.5522847f;
+    CubicBezier2D circle{Vector2{1.0f, 0.0f}, Vector2{1.0f, k}, Vector2{k, 1.0f}, Vector2{0.0f, 1.0f}};
+    CORRADE_COMPARE_WITH(circle.arcLengthTable(256).back(), Constants<Float>::piHalf(), TestSuite::Compare::Around<Float>{0.001f});
+}
+
 void BezierTest::debug() {
     std::ostringstream out;
     Debug(&out) << CubicBezier2D{Vector2{0.0f, 1.0f}, Vector2{1.5f, -0.3f}, Vector2{2.1f, 0.5f}, Vector2{0.0f, 2.0f}};
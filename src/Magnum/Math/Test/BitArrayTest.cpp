@@ -0,0 +1,278 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/BitArray.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct BitArrayTest: Corrade::TestSuite::Tester {
+    explicit BitArrayTest();
+
+    void construct();
+    void constructDefault();
+    void constructValue();
+    void setReset();
+    void fill();
+    void resize();
+
+    void count();
+    void allNoneAny();
+    void findNext();
+    void setBits();
+
+    void compare();
+    void bitInverse();
+    void bitAndOrXor();
+    void andNot();
+    void sizeMismatch();
+
+    void debug();
+};
+
+BitArrayTest::BitArrayTest() {
+    addTests({&BitArrayTest::construct,
+              &BitArrayTest::constructDefault,
+              &BitArrayTest::constructValue,
+              &BitArrayTest::setReset,
+              &BitArrayTest::fill,
+              &BitArrayTest::resize,
+
+              &BitArrayTest::count,
+              &BitArrayTest::allNoneAny,
+              &BitArrayTest::findNext,
+              &BitArrayTest::setBits,
+
+              &BitArrayTest::compare,
+              &BitArrayTest::bitInverse,
+              &BitArrayTest::bitAndOrXor,
+              &BitArrayTest::andNot,
+              &BitArrayTest::sizeMismatch,
+
+              &BitArrayTest::debug});
+}
+
+void BitArrayTest::construct() {
+    BitArray a{130};
+    CORRADE_COMPARE(a.size(), 130);
+    CORRADE_VERIFY(!a.isEmpty());
+    CORRADE_COMPARE(a.wordCount(), 3);
+    CORRADE_VERIFY(a.none());
+}
+
+void BitArrayTest::constructDefault() {
+    BitArray a;
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_VERIFY(a.isEmpty());
+    CORRADE_COMPARE(a.wordCount(), 0);
+    CORRADE_VERIFY(a.none());
+    CORRADE_VERIFY(a.all());
+    CORRADE_COMPARE(a.findNext(0), 0);
+}
+
+void BitArrayTest::constructValue() {
+    BitArray a{70, true};
+    CORRADE_COMPARE(a.count(), 70);
+
+    /* Unused bits are kept at zero */
+    CORRADE_COMPARE(a.data()[1], (UnsignedLong{1} << 6) - 1);
+}
+
+void BitArrayTest::setReset() {
+    BitArray a{100};
+    a.set(0).set(64).set(99, true).set(5, false);
+    CORRADE_VERIFY(a[0]);
+    CORRADE_VERIFY(!a[1]);
+    CORRADE_VERIFY(!a[5]);
+    CORRADE_VERIFY(a[64]);
+    CORRADE_VERIFY(a[99]);
+
+    a.reset(64).set(0, false);
+    CORRADE_VERIFY(!a[0]);
+    CORRADE_VERIFY(!a[64]);
+    CORRADE_COMPARE(a.count(), 1);
+}
+
+void BitArrayTest::fill() {
+    BitArray a{67};
+    a.fill(true);
+    CORRADE_COMPARE(a.count(), 67);
+    CORRADE_VERIFY(a.all());
+
+    a.fill(false);
+    CORRADE_VERIFY(a.none());
+}
+
+void BitArrayTest::resize() {
+    BitArray a{10};
+    a.set(3);
+
+    /* New bits set, including the unused part of the original last word */
+    a.resize(80, true);
+    CORRADE_COMPARE(a.size(), 80);
+    CORRADE_VERIFY(a[3]);
+    CORRADE_VERIFY(!a[4]);
+    CORRADE_VERIFY(a[10]);
+    CORRADE_VERIFY(a[63]);
+    CORRADE_VERIFY(a[79]);
+    CORRADE_COMPARE(a.count(), 71);
+
+    /* Shrinking clears bits past the end */
+    a.resize(12);
+    CORRADE_COMPARE(a.count(), 3);
+    a.resize(20);
+    CORRADE_COMPARE(a.count(), 3);
+}
+
+void BitArrayTest::count() {
+    BitArray a{200};
+    for(std::size_t i = 0; i < 200; i += 3) a.set(i);
+    CORRADE_COMPARE(a.count(), 67);
+}
+
+void BitArrayTest::allNoneAny() {
+    BitArray a{65};
+    CORRADE_VERIFY(a.none());
+    CORRADE_VERIFY(!a.any());
+    CORRADE_VERIFY(!a.all());
+
+    a.set(64);
+    CORRADE_VERIFY(!a.none());
+    CORRADE_VERIFY(a.any());
+    CORRADE_VERIFY(!a.all());
+
+    a.fill(true);
+    CORRADE_VERIFY(a.all());
+}
+
+void BitArrayTest::findNext() {
+    BitArray a{300};
+    a.set(2).set(64).set(65).set(299);
+
+    CORRADE_COMPARE(a.findNext(0), 2);
+    CORRADE_COMPARE(a.findNext(2), 2);
+    CORRADE_COMPARE(a.findNext(3), 64);
+    CORRADE_COMPARE(a.findNext(65), 65);
+    /* Skips two empty words */
+    CORRADE_COMPARE(a.findNext(66), 299);
+    CORRADE_COMPARE(a.findNext(300), 300);
+    CORRADE_COMPARE(a.findNext(1000), 300);
+
+    a.reset(299);
+    CORRADE_COMPARE(a.findNext(66), 300);
+}
+
+void BitArrayTest::setBits() {
+    BitArray a{150};
+    a.set(0).set(63).set(64).set(149);
+
+    std::vector<std::size_t> bits;
+    for(std::size_t i: a.setBits()) bits.push_back(i);
+    CORRADE_COMPARE(bits, (std::vector<std::size_t>{0, 63, 64, 149}));
+
+    bits.clear();
+    const BitArray empty{10};
+    for(std::size_t i: empty.setBits()) bits.push_back(i);
+    CORRADE_VERIFY(bits.empty());
+}
+
+void BitArrayTest::compare() {
+    BitArray a{70};
+    a.set(69);
+    BitArray b{70};
+    CORRADE_VERIFY(a != b);
+    b.set(69);
+    CORRADE_VERIFY(a == b);
+
+    /* Different size */
+    CORRADE_VERIFY(BitArray{70} != BitArray{71});
+}
+
+void BitArrayTest::bitInverse() {
+    BitArray a{70};
+    a.set(1).set(68);
+
+    const BitArray b = ~a;
+    CORRADE_COMPARE(b.count(), 68);
+    CORRADE_VERIFY(!b[1]);
+    CORRADE_VERIFY(b[0]);
+    CORRADE_VERIFY(b[69]);
+
+    /* Unused bits stay zero */
+    CORRADE_COMPARE((~BitArray{70}).count(), 70);
+}
+
+void BitArrayTest::bitAndOrXor() {
+    BitArray a{100};
+    a.set(1).set(70).set(99);
+    BitArray b{100};
+    b.set(1).set(50).set(99);
+
+    BitArray andResult{100};
+    andResult.set(1).set(99);
+    BitArray orResult{100};
+    orResult.set(1).set(50).set(70).set(99);
+    BitArray xorResult{100};
+    xorResult.set(50).set(70);
+
+    CORRADE_COMPARE(a & b, andResult);
+    CORRADE_COMPARE(a | b, orResult);
+    CORRADE_COMPARE(a ^ b, xorResult);
+}
+
+void BitArrayTest::andNot() {
+    BitArray a{100};
+    a.set(1).set(70).set(99);
+    BitArray b{100};
+    b.set(1).set(50);
+
+    BitArray expected{100};
+    expected.set(70).set(99);
+    CORRADE_COMPARE(a.andNot(b), expected);
+}
+
+void BitArrayTest::sizeMismatch() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    BitArray a{10};
+    a &= BitArray{11};
+    CORRADE_COMPARE(out.str(), "Math::BitArray: size mismatch\n");
+}
+
+void BitArrayTest::debug() {
+    BitArray a{10};
+    a.set(0).set(9);
+
+    std::ostringstream o;
+    Debug(&o) << a;
+    CORRADE_COMPARE(o.str(), "BitArray(10000000 01)\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::BitArrayTest)
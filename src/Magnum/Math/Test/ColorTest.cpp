@@ -94,6 +94,11 @@ struct ColorTest: Corrade::TestSuite::Tester {
     void hsvOverflow();
     void hsvAlpha();
 
+    void srgbBatch();
+    void srgbBatchUnsignedByte();
+    void unpackNormalizedBatch();
+    void hsvBatch();
+
     void swizzleType();
     void debug();
     void debugUb();
@@ -139,6 +144,11 @@ ColorTest::ColorTest() {
               &ColorTest::hsvOverflow,
               &ColorTest::hsvAlpha,
 
+              &ColorTest::srgbBatch,
+              &ColorTest::srgbBatchUnsignedByte,
+              &ColorTest::unpackNormalizedBatch,
+              &ColorTest::hsvBatch,
+
               &ColorTest::swizzleType,
               &ColorTest::debug,
               &ColorTest::debugUb,
@@ -437,6 +447,84 @@ void ColorTest::hsvAlpha() {
     CORRADE_COMPARE(Color4ub::fromHSV(230.0_degf, 0.749f, 0.427f), Color4ub(27, 40, 108, 255));
 }
 
+void ColorTest::srgbBatch() {
+    constexpr Float srgb[]{0.0f, 0.02f, 0.5f, 1.0f};
+    Float linear[4];
+    Math::srgbToLinear(srgb, linear);
+    CORRADE_COMPARE(linear[0], 0.0f);
+    CORRADE_COMPARE(linear[1], 0.00154799f);
+    CORRADE_COMPARE(linear[2], 0.214041f);
+    CORRADE_COMPARE(linear[3], 1.0f);
+
+    Float back[4];
+    Math::linearToSrgb(linear, back);
+    CORRADE_COMPARE(back[0], 0.0f);
+    CORRADE_COMPARE(back[1], 0.02f);
+    CORRADE_COMPARE(back[2], 0.5f);
+    CORRADE_COMPARE(back[3], 1.0f);
+}
+
+void ColorTest::srgbBatchUnsignedByte() {
+    constexpr Color3ub srgb[]{{0, 5, 128}, {255, 188, 10}};
+    Color3 linear[2];
+    Math::srgbToLinearRgb(srgb, linear);
+    CORRADE_COMPARE(linear[0], (Color3{0.0f, 0.00151763f, 0.215861f}));
+    CORRADE_COMPARE(linear[1], (Color3{1.0f, 0.502886f, 0.00303527f}));
+
+    /* Alpha is not converted */
+    constexpr Color4ub srgbAlpha[]{{0, 5, 128, 128}};
+    Color4 linearAlpha[1];
+    Math::srgbToLinearRgba(srgbAlpha, linearAlpha);
+    CORRADE_COMPARE(linearAlpha[0], (Color4{0.0f, 0.00151763f, 0.215861f, 0.501961f}));
+}
+
+void ColorTest::unpackNormalizedBatch() {
+    /* More than four to test both the SIMD and the remainder path */
+    Color4ub colors[6];
+    for(std::size_t i = 0; i != 6; ++i)
+        colors[i] = {UnsignedByte(i*50), UnsignedByte(255 - i), UnsignedByte(i), UnsignedByte(i*17)};
+    Color4 out[6];
+    Math::unpackNormalizedRgba(colors, out);
+    for(std::size_t i = 0; i != 6; ++i) {
+        CORRADE_COMPARE(out[i], Math::normalize<Color4>(colors[i]));
+    }
+
+    constexpr Color3ub colors3[]{{0, 128, 255}};
+    Color3 out3[1];
+    Math::unpackNormalizedRgb(colors3, out3);
+    CORRADE_COMPARE(out3[0], (Color3{0.0f, 0.501961f, 1.0f}));
+}
+
+void ColorTest::hsvBatch() {
+    /* All sextants, repeats and grayscale, more than four values to test
+       both the SIMD and the remainder path */
+    constexpr Vector3 hsv[]{
+        {27.0f, 1.0f, 1.0f},
+        {86.0f, 0.5f, 0.8f},
+        {134.0f - 360.0f, 1.0f, 1.0f},
+        {191.0f, 0.25f, 0.3f},
+        {269.0f + 360.0f, 1.0f, 1.0f},
+        {317.0f, 0.7f, 0.9f},
+        {120.0f, 0.0f, 0.5f},
+        {360.0f, 1.0f, 1.0f},
+        {-0.0001f, 1.0f, 1.0f}};
+    Color3 rgb[9];
+    Math::hsvToRgb(hsv, rgb);
+    for(std::size_t i = 0; i != 9; ++i) {
+        CORRADE_COMPARE(rgb[i], Color3::fromHSV(Deg(hsv[i].x()), hsv[i].y(), hsv[i].z()));
+    }
+
+    Vector3 back[9];
+    Math::rgbToHsv(rgb, back);
+    for(std::size_t i = 0; i != 9; ++i) {
+        Deg hue;
+        Float saturation, value;
+        std::tie(hue, saturation, value) = rgb[i].toHSV();
+        CORRADE_COMPARE(back[i], (Vector3{Float(hue), saturation, value}));
+    }
+    CORRADE_COMPARE(back[0], (Vector3{27.0f, 1.0f, 1.0f}));
+}
+
 void ColorTest::swizzleType() {
     constexpr Color3 origColor3;
     constexpr Color4ub origColor4;
@@ -266,48 +266,58 @@ template<class T> void ComplexTest::isNormalizedEpsilon() {
 }
 
 void ComplexTest::addSubtract() {
-    Complex a( 1.7f, -3.7f);
-    Complex b(-3.6f,  0.2f);
-    Complex c(-1.9f, -3.5f);
-
-    CORRADE_COMPARE(a + b, c);
-    CORRADE_COMPARE(c - b, a);
+    constexpr Complex a( 1.7f, -3.7f);
+    constexpr Complex b(-3.6f,  0.2f);
+    constexpr Complex c(-1.9f, -3.5f);
+
+    constexpr Complex added = a + b;
+    constexpr Complex subtracted = c - b;
+    CORRADE_COMPARE(added, c);
+    CORRADE_COMPARE(subtracted, a);
 }
 
 void ComplexTest::negated() {
-    CORRADE_COMPARE(-Complex(2.5f, -7.4f), Complex(-2.5f, 7.4f));
+    constexpr Complex a = -Complex(2.5f, -7.4f);
+    CORRADE_COMPARE(a, Complex(-2.5f, 7.4f));
 }
 
 void ComplexTest::multiplyDivideScalar() {
-    Complex a( 2.5f, -0.5f);
-    Complex b(-7.5f,  1.5f);
+    constexpr Complex a( 2.5f, -0.5f);
+    constexpr Complex b(-7.5f,  1.5f);
 
-    CORRADE_COMPARE(a*-3.0f, b);
-    CORRADE_COMPARE(-3.0f*a, b);
-    CORRADE_COMPARE(b/-3.0f, a);
+    constexpr Complex c = a*-3.0f;
+    constexpr Complex d = -3.0f*a;
+    constexpr Complex e = b/-3.0f;
+    CORRADE_COMPARE(c, b);
+    CORRADE_COMPARE(d, b);
+    CORRADE_COMPARE(e, a);
 
-    Complex c(-0.8f, 4.0f);
-    CORRADE_COMPARE(-2.0f/a, c);
+    constexpr Complex f = -2.0f/a;
+    CORRADE_COMPARE(f, Complex(-0.8f, 4.0f));
 }
 
 void ComplexTest::multiply() {
-    Complex a( 5.0f,   3.0f);
-    Complex b( 6.0f,  -7.0f);
-    Complex c(51.0f, -17.0f);
-
-    CORRADE_COMPARE(a*b, c);
-    CORRADE_COMPARE(b*a, c);
+    constexpr Complex a( 5.0f,   3.0f);
+    constexpr Complex b( 6.0f,  -7.0f);
+    constexpr Complex c(51.0f, -17.0f);
+
+    constexpr Complex ab = a*b;
+    constexpr Complex ba = b*a;
+    CORRADE_COMPARE(ab, c);
+    CORRADE_COMPARE(ba, c);
 }
 
 void ComplexTest::dot() {
-    Complex a(5.0f,  3.0f);
-    Complex b(6.0f, -7.0f);
+    constexpr Complex a(5.0f,  3.0f);
+    constexpr Complex b(6.0f, -7.0f);
 
-    CORRADE_COMPARE(Math::dot(a, b), 9.0f);
+    constexpr Float c = Math::dot(a, b);
+    CORRADE_COMPARE(c, 9.0f);
 }
 
 void ComplexTest::dotSelf() {
-    CORRADE_COMPARE(Complex(-4.0f, 3.0f).dot(), 25.0f);
+    constexpr Float a = Complex(-4.0f, 3.0f).dot();
+    CORRADE_COMPARE(a, 25.0f);
 }
 
 void ComplexTest::length() {
@@ -335,14 +345,15 @@ template<class T> void ComplexTest::normalizedIterative() {
 }
 
 void ComplexTest::conjugated() {
-    CORRADE_COMPARE(Complex(-3.0f, 4.5f).conjugated(), Complex(-3.0f, -4.5f));
+    constexpr Complex a = Complex(-3.0f, 4.5f).conjugated();
+    CORRADE_COMPARE(a, Complex(-3.0f, -4.5f));
 }
 
 void ComplexTest::inverted() {
-    Complex a(-3.0f, 4.0f);
-    Complex b(-0.12f, -0.16f);
+    constexpr Complex a(-3.0f, 4.0f);
+    constexpr Complex b(-0.12f, -0.16f);
 
-    Complex inverted = a.inverted();
+    constexpr Complex inverted = a.inverted();
     CORRADE_COMPARE(a*inverted, Complex());
     CORRADE_COMPARE(inverted*a, Complex());
     CORRADE_COMPARE(inverted, b);
@@ -88,6 +88,8 @@ struct DualQuaternionTest: Corrade::TestSuite::Tester {
     void translation();
     void combinedTransformParts();
     void matrix();
+    void matrixBatch();
+    void composeChain();
     void transformPoint();
     void transformPointNormalized();
 
@@ -141,6 +143,8 @@ DualQuaternionTest::DualQuaternionTest() {
               &DualQuaternionTest::translation,
               &DualQuaternionTest::combinedTransformParts,
               &DualQuaternionTest::matrix,
+              &DualQuaternionTest::matrixBatch,
+              &DualQuaternionTest::composeChain,
               &DualQuaternionTest::transformPoint,
               &DualQuaternionTest::transformPointNormalized,
 
@@ -442,6 +446,44 @@ void DualQuaternionTest::matrix() {
     CORRADE_COMPARE(p, q);
 }
 
+void DualQuaternionTest::matrixBatch() {
+    const DualQuaternion a[]{
+        {},
+        DualQuaternion::rotation(Deg(23.0f), Vector3::xAxis())*DualQuaternion::translation({-1.0f, 2.0f, 3.0f}),
+        DualQuaternion::translation({-1.0f, 2.0f, 3.0f})*DualQuaternion::rotation(Deg(-75.0f), Vector3{1.0f, 3.0f, -2.0f}.normalized()),
+        -DualQuaternion::rotation(Deg(120.0f), Vector3::zAxis())
+    };
+    Matrix4 m[4];
+
+    DualQuaternion::toMatrices(a, m);
+    for(std::size_t i = 0; i != 4; ++i)
+        CORRADE_COMPARE(m[i], a[i].toMatrix());
+}
+
+void DualQuaternionTest::composeChain() {
+    DualQuaternion transformations[100];
+    for(std::size_t i = 0; i != 100; ++i)
+        transformations[i] = DualQuaternion::rotation(Deg(7.3f*i), Vector3{0.25f, 7.3f, -1.1f}.normalized())*DualQuaternion::translation({0.5f, -0.1f, 0.2f});
+
+    /* Without normalization it's plain multiplication */
+    DualQuaternion chain[100];
+    DualQuaternion::composeChain(transformations, chain, 0);
+    CORRADE_COMPARE(chain[0], transformations[0]);
+    CORRADE_COMPARE(chain[3], transformations[0]*transformations[1]*transformations[2]*transformations[3]);
+
+    /* Normalizing every Nth composition stays normalized and close to
+       normalizing every time */
+    DualQuaternion expected[100];
+    DualQuaternion::composeChain(transformations, expected, 1);
+    DualQuaternion::composeChain(transformations, chain, 16);
+    for(std::size_t i = 0; i != 100; ++i) {
+        CORRADE_VERIFY(chain[i].isNormalized());
+        const Vector3 point = chain[i].transformPointNormalized({1.0f, 2.0f, 3.0f});
+        const Vector3 expectedPoint = expected[i].transformPointNormalized({1.0f, 2.0f, 3.0f});
+        CORRADE_VERIFY((point - expectedPoint).length() < 1.0e-4f);
+    }
+}
+
 void DualQuaternionTest::transformPoint() {
     DualQuaternion a = DualQuaternion::translation({-1.0f, 2.0f, 3.0f})*DualQuaternion::rotation(Deg(23.0f), Vector3::xAxis());
     DualQuaternion b = DualQuaternion::rotation(Deg(23.0f), Vector3::xAxis())*DualQuaternion::translation({-1.0f, 2.0f, 3.0f});
@@ -0,0 +1,179 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Frustum.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct FrustumTest: Corrade::TestSuite::Tester {
+    explicit FrustumTest();
+
+    void construct();
+    void constructDefault();
+    void constructCopy();
+
+    void access();
+    void compare();
+    void normalized();
+
+    void fromMatrixOrthographic();
+    void fromMatrixPerspective();
+    void fromMatrixTransformed();
+
+    void debug();
+};
+
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector4<Float> Vector4;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Frustum<Float> Frustum;
+typedef Math::Deg<Float> Deg;
+
+FrustumTest::FrustumTest() {
+    addTests({&FrustumTest::construct,
+              &FrustumTest::constructDefault,
+              &FrustumTest::constructCopy,
+
+              &FrustumTest::access,
+              &FrustumTest::compare,
+              &FrustumTest::normalized,
+
+              &FrustumTest::fromMatrixOrthographic,
+              &FrustumTest::fromMatrixPerspective,
+              &FrustumTest::fromMatrixTransformed,
+
+              &FrustumTest::debug});
+}
+
+void FrustumTest::construct() {
+    constexpr Frustum a{
+        {1.0f, 0.0f, 0.0f, 4.0f},
+        {-1.0f, 0.0f, 0.0f, 4.0f},
+        {0.0f, 1.0f, 0.0f, 2.0f},
+        {0.0f, -1.0f, 0.0f, 2.0f},
+        {0.0f, 0.0f, 2.0f, 0.0f},
+        {0.0f, 0.0f, -1.0f, 10.0f}};
+    constexpr Vector4 left = a.left();
+    constexpr Vector4 near = a.near();
+    CORRADE_COMPARE(left, (Vector4{1.0f, 0.0f, 0.0f, 4.0f}));
+    CORRADE_COMPARE(near, (Vector4{0.0f, 0.0f, 2.0f, 0.0f}));
+    CORRADE_COMPARE(a.right(), (Vector4{-1.0f, 0.0f, 0.0f, 4.0f}));
+    CORRADE_COMPARE(a.bottom(), (Vector4{0.0f, 1.0f, 0.0f, 2.0f}));
+    CORRADE_COMPARE(a.top(), (Vector4{0.0f, -1.0f, 0.0f, 2.0f}));
+    CORRADE_COMPARE(a.far(), (Vector4{0.0f, 0.0f, -1.0f, 10.0f}));
+}
+
+void FrustumTest::constructDefault() {
+    constexpr Frustum a;
+    CORRADE_COMPARE(a, Frustum::fromMatrix(Matrix4{}));
+    CORRADE_COMPARE(a.left(), (Vector4{1.0f, 0.0f, 0.0f, 1.0f}));
+    CORRADE_COMPARE(a.far(), (Vector4{0.0f, 0.0f, -1.0f, 1.0f}));
+}
+
+void FrustumTest::constructCopy() {
+    constexpr Frustum a;
+    constexpr Frustum b(a);
+    CORRADE_COMPARE(b, a);
+}
+
+void FrustumTest::access() {
+    Frustum a;
+    a[3] = {0.0f, -1.0f, 0.0f, 5.0f};
+    CORRADE_COMPARE(a.top(), (Vector4{0.0f, -1.0f, 0.0f, 5.0f}));
+
+    const Frustum& ca = a;
+    CORRADE_COMPARE(ca[3], (Vector4{0.0f, -1.0f, 0.0f, 5.0f}));
+    CORRADE_COMPARE(&ca.planes()[3], &ca.top());
+}
+
+void FrustumTest::compare() {
+    Frustum a;
+    Frustum b;
+    CORRADE_VERIFY(a == b);
+
+    b[5].w() += 0.1f;
+    CORRADE_VERIFY(a != b);
+}
+
+void FrustumTest::normalized() {
+    const Frustum a{
+        {2.0f, 0.0f, 0.0f, 4.0f},
+        {-1.0f, 0.0f, 0.0f, 4.0f},
+        {0.0f, 3.0f, 4.0f, 10.0f},
+        {0.0f, -1.0f, 0.0f, 2.0f},
+        {0.0f, 0.0f, 0.5f, 1.0f},
+        {0.0f, 0.0f, -1.0f, 10.0f}};
+    const Frustum b = a.normalized();
+    CORRADE_COMPARE(b.left(), (Vector4{1.0f, 0.0f, 0.0f, 2.0f}));
+    CORRADE_COMPARE(b.bottom(), (Vector4{0.0f, 0.6f, 0.8f, 2.0f}));
+    CORRADE_COMPARE(b.near(), (Vector4{0.0f, 0.0f, 1.0f, 2.0f}));
+    CORRADE_COMPARE(b.far(), a.far());
+}
+
+void FrustumTest::fromMatrixOrthographic() {
+    /* X and Y in [-2, 2] and [-1, 1], Z in [-1, -3] */
+    const Frustum a = Frustum::fromMatrix(Matrix4::orthographicProjection({4.0f, 2.0f}, 1.0f, 3.0f));
+    CORRADE_COMPARE(a, (Frustum{
+        {1.0f, 0.0f, 0.0f, 2.0f},
+        {-1.0f, 0.0f, 0.0f, 2.0f},
+        {0.0f, 1.0f, 0.0f, 1.0f},
+        {0.0f, -1.0f, 0.0f, 1.0f},
+        {0.0f, 0.0f, -1.0f, -1.0f},
+        {0.0f, 0.0f, 1.0f, 3.0f}}));
+}
+
+void FrustumTest::fromMatrixPerspective() {
+    const Frustum a = Frustum::fromMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 1.0f, 100.0f));
+    const Float s = 1.0f/Constants<Float>::sqrt2();
+    CORRADE_COMPARE(a.left(), (Vector4{s, 0.0f, -s, 0.0f}));
+    CORRADE_COMPARE(a.right(), (Vector4{-s, 0.0f, -s, 0.0f}));
+    CORRADE_COMPARE(a.bottom(), (Vector4{0.0f, s, -s, 0.0f}));
+    CORRADE_COMPARE(a.top(), (Vector4{0.0f, -s, -s, 0.0f}));
+    CORRADE_COMPARE(a.near(), (Vector4{0.0f, 0.0f, -1.0f, -1.0f}));
+    CORRADE_COMPARE(a.far(), (Vector4{0.0f, 0.0f, 1.0f, 100.0f}));
+}
+
+void FrustumTest::fromMatrixTransformed() {
+    /* Camera moved to (0, 0, 10), the planes are in world space */
+    const Frustum a = Frustum::fromMatrix(Matrix4::orthographicProjection({4.0f, 2.0f}, 1.0f, 3.0f)*Matrix4::translation({0.0f, 0.0f, -10.0f}));
+    CORRADE_COMPARE(a.left(), (Vector4{1.0f, 0.0f, 0.0f, 2.0f}));
+    CORRADE_COMPARE(a.near(), (Vector4{0.0f, 0.0f, -1.0f, 9.0f}));
+    CORRADE_COMPARE(a.far(), (Vector4{0.0f, 0.0f, 1.0f, -7.0f}));
+}
+
+void FrustumTest::debug() {
+    std::ostringstream o;
+    Debug(&o) << Frustum{};
+    CORRADE_COMPARE(o.str(), "Frustum(Vector(1, 0, 0, 1), Vector(-1, 0, 0, 1), "
+                                     "Vector(0, 1, 0, 1), Vector(0, -1, 0, 1), "
+                                     "Vector(0, 0, 1, 1), Vector(0, 0, -1, 1))\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::FrustumTest)
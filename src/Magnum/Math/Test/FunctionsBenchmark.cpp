@@ -0,0 +1,233 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct FunctionsBenchmark: Corrade::TestSuite::Tester {
+    explicit FunctionsBenchmark();
+
+    void sin();
+    void sinFast();
+    void sinFastArray();
+    void sincos();
+    void sincosFast();
+    void sqrtInverted();
+    void sqrtInvertedFast();
+    void sqrtInvertedFastArray();
+    void exp();
+    void expFast();
+    void log();
+    void logFast();
+    void normalized();
+    void normalizedFast();
+};
+
+typedef Math::Rad<Float> Rad;
+typedef Math::Vector3<Float> Vector3;
+
+namespace {
+    /* Each benchmark processes 10k values 10 times, divide the iteration
+       count by the measured time to get values per second */
+    constexpr std::size_t ValueCount = 10*1024;
+
+    std::vector<Float> values() {
+        std::vector<Float> out;
+        out.reserve(ValueCount);
+        for(std::size_t i = 0; i != ValueCount; ++i)
+            out.push_back(0.01f + Float(i%977)*0.0125f);
+        return out;
+    }
+
+    std::vector<Rad> angles() {
+        std::vector<Rad> out;
+        out.reserve(ValueCount);
+        for(const Float value: values())
+            out.push_back(Rad(value - 6.0f));
+        return out;
+    }
+
+    std::vector<Vector3> vectors() {
+        std::vector<Vector3> out;
+        out.reserve(ValueCount);
+        for(const Float value: values())
+            out.push_back({value, 1.0f - value, 0.5f*value});
+        return out;
+    }
+}
+
+FunctionsBenchmark::FunctionsBenchmark() {
+    addBenchmarks({&FunctionsBenchmark::sin,
+                   &FunctionsBenchmark::sinFast,
+                   &FunctionsBenchmark::sinFastArray,
+                   &FunctionsBenchmark::sincos,
+                   &FunctionsBenchmark::sincosFast,
+                   &FunctionsBenchmark::sqrtInverted,
+                   &FunctionsBenchmark::sqrtInvertedFast,
+                   &FunctionsBenchmark::sqrtInvertedFastArray,
+                   &FunctionsBenchmark::exp,
+                   &FunctionsBenchmark::expFast,
+                   &FunctionsBenchmark::log,
+                   &FunctionsBenchmark::logFast,
+                   &FunctionsBenchmark::normalized,
+                   &FunctionsBenchmark::normalizedFast}, 5, BenchmarkType::WallClock);
+}
+
+void FunctionsBenchmark::sin() {
+    const std::vector<Rad> in = angles();
+    Float sum{};
+    CORRADE_BENCHMARK(10)
+        for(const Rad angle: in)
+            sum += Math::sin(angle);
+    CORRADE_VERIFY(sum == sum);
+}
+
+void FunctionsBenchmark::sinFast() {
+    const std::vector<Rad> in = angles();
+    Float sum{};
+    CORRADE_BENCHMARK(10)
+        for(const Rad angle: in)
+            sum += Math::Fast::sin(angle);
+    CORRADE_VERIFY(sum == sum);
+}
+
+void FunctionsBenchmark::sinFastArray() {
+    const std::vector<Rad> in = angles();
+    std::vector<Float> out(in.size());
+    CORRADE_BENCHMARK(10)
+        Math::Fast::sin<Float>({in.data(), in.size()}, {out.data(), out.size()});
+    CORRADE_VERIFY(out[0] == out[0]);
+}
+
+void FunctionsBenchmark::sincos() {
+    const std::vector<Rad> in = angles();
+    Float sum{};
+    CORRADE_BENCHMARK(10)
+        for(const Rad angle: in) {
+            const std::pair<Float, Float> sincos = Math::sincos(angle);
+            sum += sincos.first + sincos.second;
+        }
+    CORRADE_VERIFY(sum == sum);
+}
+
+void FunctionsBenchmark::sincosFast() {
+    const std::vector<Rad> in = angles();
+    Float sum{};
+    CORRADE_BENCHMARK(10)
+        for(const Rad angle: in) {
+            const std::pair<Float, Float> sincos = Math::Fast::sincos(angle);
+            sum += sincos.first + sincos.second;
+        }
+    CORRADE_VERIFY(sum == sum);
+}
+
+void FunctionsBenchmark::sqrtInverted() {
+    const std::vector<Float> in = values();
+    Float sum{};
+    CORRADE_BENCHMARK(10)
+        for(const Float value: in)
+            sum += Math::sqrtInverted(value);
+    CORRADE_VERIFY(sum > 0.0f);
+}
+
+void FunctionsBenchmark::sqrtInvertedFast() {
+    const std::vector<Float> in = values();
+    Float sum{};
+    CORRADE_BENCHMARK(10)
+        for(const Float value: in)
+            sum += Math::Fast::sqrtInverted(value);
+    CORRADE_VERIFY(sum > 0.0f);
+}
+
+void FunctionsBenchmark::sqrtInvertedFastArray() {
+    const std::vector<Float> in = values();
+    std::vector<Float> out(in.size());
+    CORRADE_BENCHMARK(10)
+        Math::Fast::sqrtInverted<Float>({in.data(), in.size()}, {out.data(), out.size()});
+    CORRADE_VERIFY(out[0] > 0.0f);
+}
+
+void FunctionsBenchmark::exp() {
+    const std::vector<Float> in = values();
+    Float sum{};
+    CORRADE_BENCHMARK(10)
+        for(const Float value: in)
+            sum += Math::exp(value);
+    CORRADE_VERIFY(sum > 0.0f);
+}
+
+void FunctionsBenchmark::expFast() {
+    const std::vector<Float> in = values();
+    Float sum{};
+    CORRADE_BENCHMARK(10)
+        for(const Float value: in)
+            sum += Math::Fast::exp(value);
+    CORRADE_VERIFY(sum > 0.0f);
+}
+
+void FunctionsBenchmark::log() {
+    const std::vector<Float> in = values();
+    Float sum{};
+    CORRADE_BENCHMARK(10)
+        for(const Float value: in)
+            sum += Math::log(value);
+    CORRADE_VERIFY(sum == sum);
+}
+
+void FunctionsBenchmark::logFast() {
+    const std::vector<Float> in = values();
+    Float sum{};
+    CORRADE_BENCHMARK(10)
+        for(const Float value: in)
+            sum += Math::Fast::log(value);
+    CORRADE_VERIFY(sum == sum);
+}
+
+void FunctionsBenchmark::normalized() {
+    const std::vector<Vector3> in = vectors();
+    Vector3 sum;
+    CORRADE_BENCHMARK(10)
+        for(const Vector3& vector: in)
+            sum += vector.normalized();
+    CORRADE_VERIFY(sum.x() > 0.0f);
+}
+
+void FunctionsBenchmark::normalizedFast() {
+    const std::vector<Vector3> in = vectors();
+    Vector3 sum;
+    CORRADE_BENCHMARK(10)
+        for(const Vector3& vector: in)
+            sum += vector.normalized(Math::FastMath);
+    CORRADE_VERIFY(sum.x() > 0.0f);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::FunctionsBenchmark)
@@ -73,6 +73,13 @@ struct FunctionsTest: Corrade::TestSuite::Tester {
     void div();
     void trigonometric();
     void trigonometricWithBase();
+
+    void fastTrigonometric();
+    void fastTrigonometricPrecision();
+    void fastSqrtInverted();
+    void fastExpLog();
+    void fastExpLogPrecision();
+    void fastBatch();
 };
 
 typedef Math::Constants<Float> Constants;
@@ -123,7 +130,14 @@ FunctionsTest::FunctionsTest() {
               &FunctionsTest::exp,
               &FunctionsTest::div,
               &FunctionsTest::trigonometric,
-              &FunctionsTest::trigonometricWithBase});
+              &FunctionsTest::trigonometricWithBase,
+
+              &FunctionsTest::fastTrigonometric,
+              &FunctionsTest::fastTrigonometricPrecision,
+              &FunctionsTest::fastSqrtInverted,
+              &FunctionsTest::fastExpLog,
+              &FunctionsTest::fastExpLogPrecision,
+              &FunctionsTest::fastBatch});
 }
 
 void FunctionsTest::min() {
@@ -514,6 +528,124 @@ void FunctionsTest::trigonometricWithBase() {
     CORRADE_COMPARE(Math::tan(2*Rad(Constants::pi()/8)), 1.0f);
 }
 
+void FunctionsTest::fastTrigonometric() {
+    CORRADE_COMPARE(Math::Fast::sin(Deg(30.0f)), 0.5f);
+    CORRADE_COMPARE(Math::Fast::sin(Rad(Constants::pi()/6)), 0.5f);
+    CORRADE_COMPARE(Math::Fast::sin(2*Deg(15.0f)), 0.5f);
+    CORRADE_COMPARE(Math::Fast::sin(Deg(-150.0f)), -0.5f);
+
+    CORRADE_COMPARE(Math::Fast::cos(Deg(60.0f)), 0.5f);
+    CORRADE_COMPARE(Math::Fast::cos(Rad(Constants::pi()/3)), 0.5f);
+    CORRADE_COMPARE(Math::Fast::cos(2*Deg(30.0f)), 0.5f);
+    CORRADE_COMPARE(Math::Fast::cos(Deg(240.0f)), -0.5f);
+
+    CORRADE_COMPARE(Math::Fast::sincos(Deg(-210.0f)).first, 0.5f);
+    CORRADE_COMPARE(Math::Fast::sincos(Deg(-210.0f)).second, -0.8660254037844386f);
+    CORRADE_COMPARE(Math::Fast::sincos(2*Rad(Constants::pi()/12)).first, 0.5f);
+    CORRADE_COMPARE(Math::Fast::sincos(2*Rad(Constants::pi()/12)).second, 0.8660254037844386f);
+}
+
+void FunctionsTest::fastTrigonometricPrecision() {
+    /* Verify the error bounds documented in Math::Fast. Doubles are tested
+       only here, as their error is above the fuzzy compare epsilon. */
+    Float maxErrorFloat{};
+    Double maxErrorDouble{};
+    for(Int i = -100000; i <= 100000; ++i) {
+        const Double angle = i*0.01 + 0.001;
+        maxErrorFloat = Math::max({maxErrorFloat,
+            Float(std::abs(Math::Fast::sin(Rad(Float(angle))) - std::sin(Double(Float(angle))))),
+            Float(std::abs(Math::Fast::cos(Rad(Float(angle))) - std::cos(Double(Float(angle)))))});
+        maxErrorDouble = Math::max({maxErrorDouble,
+            std::abs(Math::Fast::sin(Math::Rad<Double>(angle)) - std::sin(angle)),
+            std::abs(Math::Fast::cos(Math::Rad<Double>(angle)) - std::cos(angle))});
+    }
+    CORRADE_VERIFY(maxErrorFloat < 3.0e-7f);
+    CORRADE_VERIFY(maxErrorDouble < 7.0e-10);
+}
+
+void FunctionsTest::fastSqrtInverted() {
+    CORRADE_COMPARE(Math::Fast::sqrtInverted(16.0f), 0.25f);
+    CORRADE_COMPARE(Math::Fast::sqrtInverted(Vector3(1.0f, 4.0f, 16.0f)), Vector3(1.0f, 0.5f, 0.25f));
+
+    Float maxErrorFloat{};
+    Double maxErrorDouble{};
+    for(Int i = -2000; i <= 2000; ++i) {
+        const Double value = std::pow(10.0, i*0.01 + 0.001);
+        maxErrorFloat = Math::max(maxErrorFloat,
+            Float(std::abs(Math::Fast::sqrtInverted(Float(value))*std::sqrt(Double(Float(value))) - 1.0)));
+        maxErrorDouble = Math::max(maxErrorDouble,
+            std::abs(Math::Fast::sqrtInverted(value)*std::sqrt(value) - 1.0));
+    }
+    CORRADE_VERIFY(maxErrorFloat < 5.0e-6f);
+    CORRADE_VERIFY(maxErrorDouble < 4.0e-11);
+}
+
+void FunctionsTest::fastExpLog() {
+    CORRADE_COMPARE(Math::Fast::exp(0.693147f), 2.0f);
+    CORRADE_COMPARE(Math::Fast::exp(0.0f), 1.0f);
+    CORRADE_COMPARE(Math::Fast::exp(-2.302585f), 0.1f);
+    CORRADE_COMPARE(Math::Fast::log(2.0f), 0.693147f);
+    CORRADE_COMPARE(Math::Fast::log(1.0f), 0.0f);
+    CORRADE_COMPARE(Math::Fast::log(0.1f), -2.302585f);
+
+    /* Saturation */
+    CORRADE_COMPARE(Math::Fast::exp(100.0f), Constants::inf());
+    CORRADE_COMPARE(Math::Fast::exp(-100.0f), 0.0f);
+    CORRADE_COMPARE(Math::Fast::exp(1000.0), Math::Constants<Double>::inf());
+    CORRADE_COMPARE(Math::Fast::exp(-1000.0), 0.0);
+
+    /* Largest representable result */
+    CORRADE_COMPARE(Math::Fast::exp(88.7f)/std::exp(88.7f), 1.0f);
+}
+
+void FunctionsTest::fastExpLogPrecision() {
+    Float maxExpErrorFloat{}, maxLogErrorFloat{};
+    Double maxExpErrorDouble{}, maxLogErrorDouble{};
+    for(Int i = -8700; i <= 8800; ++i) {
+        const Double exponent = i*0.01 + 0.001;
+        const Double expected = std::exp(Double(Float(exponent)));
+        maxExpErrorFloat = Math::max(maxExpErrorFloat,
+            Float(std::abs(Math::Fast::exp(Float(exponent)) - expected)/expected));
+        maxExpErrorDouble = Math::max(maxExpErrorDouble,
+            std::abs(Math::Fast::exp(exponent) - std::exp(exponent))/std::exp(exponent));
+
+        const Double value = std::exp(exponent);
+        const Double expectedLog = std::log(Double(Float(value)));
+        maxLogErrorFloat = Math::max(maxLogErrorFloat,
+            Float(std::abs(Math::Fast::log(Float(value)) - expectedLog)/Math::max(1.0, std::abs(expectedLog))));
+        maxLogErrorDouble = Math::max(maxLogErrorDouble,
+            std::abs(Math::Fast::log(value) - exponent)/Math::max(1.0, std::abs(exponent)));
+    }
+    CORRADE_VERIFY(maxExpErrorFloat < 2.0e-7f);
+    CORRADE_VERIFY(maxExpErrorDouble < 8.0e-9);
+    CORRADE_VERIFY(maxLogErrorFloat < 2.0e-7f);
+    CORRADE_VERIFY(maxLogErrorDouble < 8.0e-10);
+}
+
+void FunctionsTest::fastBatch() {
+    const Rad angles[]{Rad(Deg(30.0f)), Rad(Deg(-150.0f)), Rad(Deg(60.0f))};
+    const Float values[]{16.0f, 0.693147f, 1.0f};
+    Float sin[3], cos[3], out[3];
+
+    Math::Fast::sin<Float>(angles, sin);
+    CORRADE_COMPARE(Vector3::from(sin), Vector3(0.5f, -0.5f, 0.8660254037844386f));
+    Math::Fast::cos<Float>(angles, cos);
+    CORRADE_COMPARE(Vector3::from(cos), Vector3(0.8660254037844386f, -0.8660254037844386f, 0.5f));
+
+    Float sin2[3], cos2[3];
+    Math::Fast::sincos<Float>(angles, sin2, cos2);
+    CORRADE_COMPARE(Vector3::from(sin2), Vector3::from(sin));
+    CORRADE_COMPARE(Vector3::from(cos2), Vector3::from(cos));
+
+    Math::Fast::sqrtInverted<Float>(values, out);
+    CORRADE_COMPARE(out[0], 0.25f);
+    Math::Fast::exp<Float>(values, out);
+    CORRADE_COMPARE(out[1], 2.0f);
+    Math::Fast::log<Float>(values, out);
+    CORRADE_COMPARE(out[0], 2.772589f);
+    CORRADE_COMPARE(out[2], 0.0f);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Test::FunctionsTest)
@@ -452,6 +452,13 @@ void Matrix3Test::transform() {
 
     CORRADE_COMPARE(a.transformVector(v), Vector2(2.0f, 1.0f));
     CORRADE_COMPARE(a.transformPoint(v), Vector2(3.0f, -4.0f));
+
+    /* Rotation can't be constexpr, but everything else can */
+    constexpr Matrix3 b = Matrix3::translation({1.0f, -5.0f})*Matrix3::scaling({2.0f, -1.0f});
+    constexpr Vector2 bv = b.transformVector({1.0f, -2.0f});
+    constexpr Vector2 bp = b.transformPoint({1.0f, -2.0f});
+    CORRADE_COMPARE(bv, Vector2(2.0f, 2.0f));
+    CORRADE_COMPARE(bp, Vector2(3.0f, -3.0f));
 }
 
 void Matrix3Test::debug() {
@@ -0,0 +1,105 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Matrix4.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct Matrix4Benchmark: Corrade::TestSuite::Tester {
+    explicit Matrix4Benchmark();
+
+    void multiply();
+    void inverted();
+    void invertedRigid();
+    void transformPoint();
+};
+
+typedef Math::Deg<Float> Deg;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Vector3<Float> Vector3;
+
+namespace {
+    /* Each benchmark processes 1k matrices 100 times, divide the iteration
+       count by the measured time to get matrices per second */
+    constexpr std::size_t MatrixCount = 1024;
+
+    std::vector<Matrix4> matrices() {
+        std::vector<Matrix4> out;
+        out.reserve(MatrixCount);
+        for(std::size_t i = 0; i != MatrixCount; ++i)
+            out.push_back(Matrix4::translation({Float(i), 1.0f, -Float(i%7)})*
+                Matrix4::rotation(Deg(Float(i%360)), Vector3{1.0f, 2.0f, -1.0f}.normalized()));
+        return out;
+    }
+}
+
+Matrix4Benchmark::Matrix4Benchmark() {
+    addBenchmarks({&Matrix4Benchmark::multiply,
+                   &Matrix4Benchmark::inverted,
+                   &Matrix4Benchmark::invertedRigid,
+                   &Matrix4Benchmark::transformPoint}, 5, BenchmarkType::WallClock);
+}
+
+void Matrix4Benchmark::multiply() {
+    const std::vector<Matrix4> in = matrices();
+    Matrix4 result;
+    CORRADE_BENCHMARK(100)
+        for(const Matrix4& matrix: in)
+            result = result*matrix;
+    CORRADE_VERIFY(result[0][0] == result[0][0]);
+}
+
+void Matrix4Benchmark::inverted() {
+    const std::vector<Matrix4> in = matrices();
+    Matrix4 sum{Math::ZeroInit};
+    CORRADE_BENCHMARK(100)
+        for(const Matrix4& matrix: in)
+            sum += matrix.inverted();
+    CORRADE_VERIFY(sum[0][0] == sum[0][0]);
+}
+
+void Matrix4Benchmark::invertedRigid() {
+    const std::vector<Matrix4> in = matrices();
+    Matrix4 sum{Math::ZeroInit};
+    CORRADE_BENCHMARK(100)
+        for(const Matrix4& matrix: in)
+            sum += matrix.invertedRigid();
+    CORRADE_VERIFY(sum[0][0] == sum[0][0]);
+}
+
+void Matrix4Benchmark::transformPoint() {
+    const std::vector<Matrix4> in = matrices();
+    Vector3 sum;
+    CORRADE_BENCHMARK(100)
+        for(const Matrix4& matrix: in)
+            sum += matrix.transformPoint({1.0f, 2.0f, 3.0f});
+    CORRADE_VERIFY(sum == sum);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::Matrix4Benchmark)
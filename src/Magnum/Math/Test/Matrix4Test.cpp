@@ -110,6 +110,7 @@ typedef Math::Matrix4<Float> Matrix4;
 typedef Math::Matrix4<Int> Matrix4i;
 typedef Math::Matrix<3, Float> Matrix3x3;
 typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector3<Int> Vector3i;
 typedef Math::Vector4<Float> Vector4;
 typedef Math::Constants<Float> Constants;
 
@@ -603,6 +604,14 @@ void Matrix4Test::transform() {
 
     CORRADE_COMPARE(a.transformVector(v), Vector3(2.0f, 1.0f, 5.5f));
     CORRADE_COMPARE(a.transformPoint(v), Vector3(3.0f, -4.0f, 9.0f));
+
+    /* Rotation can't be constexpr, but everything else can. Using an integer
+       matrix, as float ones are not constexpr with MAGNUM_BUILD_SIMD. */
+    constexpr Matrix4i b = Matrix4i::translation({1, -5, 3})*Matrix4i::scaling({2, 1, -1});
+    constexpr Vector3i bv = b.transformVector({1, -2, 5});
+    constexpr Vector3i bp = b.transformPoint({1, -2, 5});
+    CORRADE_COMPARE(bv, Vector3i(2, -2, -5));
+    CORRADE_COMPARE(bp, Vector3i(3, -7, -2));
 }
 
 void Matrix4Test::transformProjection() {
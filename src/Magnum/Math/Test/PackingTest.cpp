@@ -0,0 +1,230 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Packing.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct PackingTest: Corrade::TestSuite::Tester {
+    explicit PackingTest();
+
+    void packHalf();
+    void unpackHalf();
+    void halfRoundTrip();
+    void halfArray();
+
+    void packNormalized();
+    void unpackNormalized();
+    void normalizedArray();
+
+    void packInt2101010Rev();
+    void unpackInt2101010Rev();
+    void packUnsignedInt2101010Rev();
+    void unpackUnsignedInt2101010Rev();
+    void int2101010RevArray();
+};
+
+typedef Math::Constants<Float> Constants;
+typedef Math::Vector4<Float> Vector4;
+
+PackingTest::PackingTest() {
+    addTests({&PackingTest::packHalf,
+              &PackingTest::unpackHalf,
+              &PackingTest::halfRoundTrip,
+              &PackingTest::halfArray,
+
+              &PackingTest::packNormalized,
+              &PackingTest::unpackNormalized,
+              &PackingTest::normalizedArray,
+
+              &PackingTest::packInt2101010Rev,
+              &PackingTest::unpackInt2101010Rev,
+              &PackingTest::packUnsignedInt2101010Rev,
+              &PackingTest::unpackUnsignedInt2101010Rev,
+              &PackingTest::int2101010RevArray});
+}
+
+void PackingTest::packHalf() {
+    CORRADE_COMPARE(Math::packHalf(0.0f), 0x0000);
+    CORRADE_COMPARE(Math::packHalf(-0.0f), 0x8000);
+    CORRADE_COMPARE(Math::packHalf(1.0f), 0x3c00);
+    CORRADE_COMPARE(Math::packHalf(-2.0f), 0xc000);
+    CORRADE_COMPARE(Math::packHalf(0.333333f), 0x3555);
+    CORRADE_COMPARE(Math::packHalf(65504.0f), 0x7bff);
+
+    /* Overflow, infinity and NaN */
+    CORRADE_COMPARE(Math::packHalf(65520.0f), 0x7c00);
+    CORRADE_COMPARE(Math::packHalf(-Constants::inf()), 0xfc00);
+    CORRADE_COMPARE(Math::packHalf(Constants::nan()) & 0x7e00, 0x7e00);
+
+    /* Smallest subnormal, smallest normal, underflow */
+    CORRADE_COMPARE(Math::packHalf(5.9604645e-08f), 0x0001);
+    CORRADE_COMPARE(Math::packHalf(6.1035156e-05f), 0x0400);
+    CORRADE_COMPARE(Math::packHalf(1.0e-8f), 0x0000);
+
+    /* Rounding of halfway values to even */
+    CORRADE_COMPARE(Math::packHalf(1.0f + 1.0f/2048.0f), 0x3c00);
+    CORRADE_COMPARE(Math::packHalf(1.0f + 3.0f/2048.0f), 0x3c02);
+}
+
+void PackingTest::unpackHalf() {
+    CORRADE_COMPARE(Math::unpackHalf(0x0000), 0.0f);
+    CORRADE_VERIFY(std::signbit(Math::unpackHalf(0x8000)));
+    CORRADE_COMPARE(Math::unpackHalf(0x3c00), 1.0f);
+    CORRADE_COMPARE(Math::unpackHalf(0xc000), -2.0f);
+    CORRADE_COMPARE(Math::unpackHalf(0x3555), 0.333251953125f);
+    CORRADE_COMPARE(Math::unpackHalf(0x7bff), 65504.0f);
+    CORRADE_COMPARE(Math::unpackHalf(0x0001), 5.9604645e-08f);
+    CORRADE_COMPARE(Math::unpackHalf(0x83ff), -6.0975552e-05f);
+    CORRADE_COMPARE(Math::unpackHalf(0x0400), 6.1035156e-05f);
+    CORRADE_COMPARE(Math::unpackHalf(0x7c00), Constants::inf());
+    CORRADE_COMPARE(Math::unpackHalf(0xfc00), -Constants::inf());
+    CORRADE_VERIFY(Math::unpackHalf(0x7e00) != Math::unpackHalf(0x7e00));
+}
+
+void PackingTest::halfRoundTrip() {
+    /* Every half-float except NaNs survives the round trip unchanged */
+    for(UnsignedInt i = 0; i != 0x10000; ++i) {
+        if((i & 0x7c00) == 0x7c00 && (i & 0x3ff)) continue;
+        if(Math::packHalf(Math::unpackHalf(UnsignedShort(i))) != i) {
+            CORRADE_COMPARE(Math::packHalf(Math::unpackHalf(UnsignedShort(i))), i);
+            return;
+        }
+    }
+}
+
+void PackingTest::halfArray() {
+    /* More than eight values to test both the SIMD and the scalar part */
+    const Float values[]{0.0f, -0.0f, 1.0f, -2.0f, 0.333333f, 65504.0f,
+        65520.0f, -Constants::inf(), 5.9604645e-08f, 1.0e-8f,
+        1.0f + 1.0f/2048.0f, 1.0f + 3.0f/2048.0f, 6.1035156e-05f};
+    constexpr std::size_t count = sizeof(values)/sizeof(Float);
+
+    UnsignedShort packed[count];
+    Math::packHalf(values, packed);
+    for(std::size_t i = 0; i != count; ++i)
+        CORRADE_COMPARE(packed[i], Math::packHalf(values[i]));
+
+    Float unpacked[count];
+    Math::unpackHalf(packed, unpacked);
+    for(std::size_t i = 0; i != count; ++i)
+        CORRADE_COMPARE(unpacked[i], Math::unpackHalf(packed[i]));
+}
+
+void PackingTest::packNormalized() {
+    CORRADE_COMPARE(Math::packNormalized<UnsignedByte>(0.0f), 0);
+    CORRADE_COMPARE(Math::packNormalized<UnsignedByte>(1.0f), 255);
+    CORRADE_COMPARE(Math::packNormalized<UnsignedShort>(0.5f), 32768);
+    CORRADE_COMPARE(Math::packNormalized<UnsignedShort>(-0.5f), 0);
+    CORRADE_COMPARE(Math::packNormalized<UnsignedShort>(2.0f), 65535);
+
+    CORRADE_COMPARE(Math::packNormalized<Byte>(-1.0f), -127);
+    CORRADE_COMPARE(Math::packNormalized<Byte>(0.5f), 64);
+    CORRADE_COMPARE(Math::packNormalized<Short>(-2.0f), -32767);
+    CORRADE_COMPARE(Math::packNormalized<Short>(1.0f), 32767);
+}
+
+void PackingTest::unpackNormalized() {
+    CORRADE_COMPARE(Math::unpackNormalized<UnsignedByte>(255), 1.0f);
+    CORRADE_COMPARE(Math::unpackNormalized<UnsignedShort>(32768), 0.500008f);
+    CORRADE_COMPARE(Math::unpackNormalized<Short>(-32767), -1.0f);
+    CORRADE_COMPARE(Math::unpackNormalized<Short>(-32768), -1.0f);
+    CORRADE_COMPARE(Math::unpackNormalized<Byte>(64), 0.503937f);
+}
+
+void PackingTest::normalizedArray() {
+    const Float values[]{0.0f, 1.0f, 0.25f, -0.5f};
+    UnsignedShort packed[4];
+    Math::packNormalized<UnsignedShort>(values, packed);
+    CORRADE_COMPARE(packed[0], 0);
+    CORRADE_COMPARE(packed[1], 65535);
+    CORRADE_COMPARE(packed[2], 16384);
+    CORRADE_COMPARE(packed[3], 0);
+
+    Float unpacked[4];
+    Math::unpackNormalized<UnsignedShort>(packed, unpacked);
+    CORRADE_COMPARE(unpacked[0], 0.0f);
+    CORRADE_COMPARE(unpacked[1], 1.0f);
+    CORRADE_COMPARE(unpacked[2], 0.250004f);
+    CORRADE_COMPARE(unpacked[3], 0.0f);
+}
+
+void PackingTest::packInt2101010Rev() {
+    CORRADE_COMPARE(Math::packInt2101010Rev({1.0f, 0.0f, 0.0f, 0.0f}), 0x000001ff);
+    CORRADE_COMPARE(Math::packInt2101010Rev({0.0f, -1.0f, 0.0f, 0.0f}), 0x00080400);
+    CORRADE_COMPARE(Math::packInt2101010Rev({0.0f, 0.0f, 2.0f, 1.0f}), 0x5ff00000);
+    CORRADE_COMPARE(Math::packInt2101010Rev({0.0f, 0.0f, 0.0f, -1.0f}), 0xc0000000);
+}
+
+void PackingTest::unpackInt2101010Rev() {
+    CORRADE_COMPARE(Math::unpackInt2101010Rev(0x000001ff), (Vector4{1.0f, 0.0f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(Math::unpackInt2101010Rev(0x00080400), (Vector4{0.0f, -1.0f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(Math::unpackInt2101010Rev(0x5ff00000), (Vector4{0.0f, 0.0f, 1.0f, 1.0f}));
+    CORRADE_COMPARE(Math::unpackInt2101010Rev(0xc0000000), (Vector4{0.0f, 0.0f, 0.0f, -1.0f}));
+
+    /* The smallest values are clamped to -1 */
+    CORRADE_COMPARE(Math::unpackInt2101010Rev(0x80000200), (Vector4{-1.0f, 0.0f, 0.0f, -1.0f}));
+
+    const Vector4 a{0.25f, -0.5f, 0.75f, 0.0f};
+    CORRADE_COMPARE(Math::unpackInt2101010Rev(Math::packInt2101010Rev(a)), (Vector4{0.250489f, -0.500978f, 0.749511f, 0.0f}));
+}
+
+void PackingTest::packUnsignedInt2101010Rev() {
+    CORRADE_COMPARE(Math::packUnsignedInt2101010Rev({1.0f, 0.0f, 0.0f, 0.0f}), 0x000003ff);
+    CORRADE_COMPARE(Math::packUnsignedInt2101010Rev({0.0f, 1.0f, -1.0f, 0.0f}), 0x000ffc00);
+    CORRADE_COMPARE(Math::packUnsignedInt2101010Rev({0.0f, 0.0f, 2.0f, 1.0f}), 0xfff00000);
+    CORRADE_COMPARE(Math::packUnsignedInt2101010Rev({0.5f, 0.0f, 0.0f, 0.333333f}), 0x40000200);
+}
+
+void PackingTest::unpackUnsignedInt2101010Rev() {
+    CORRADE_COMPARE(Math::unpackUnsignedInt2101010Rev(0x000003ff), (Vector4{1.0f, 0.0f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(Math::unpackUnsignedInt2101010Rev(0xfff00000), (Vector4{0.0f, 0.0f, 1.0f, 1.0f}));
+    CORRADE_COMPARE(Math::unpackUnsignedInt2101010Rev(0x40000200), (Vector4{0.500489f, 0.0f, 0.0f, 0.333333f}));
+}
+
+void PackingTest::int2101010RevArray() {
+    const Vector4 values[]{{1.0f, 0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 2.0f, 1.0f}};
+    UnsignedInt packed[2];
+    Vector4 unpacked[2];
+
+    Math::packInt2101010Rev(values, packed);
+    CORRADE_COMPARE(packed[0], 0x000001ff);
+    CORRADE_COMPARE(packed[1], 0x5ff00000);
+    Math::unpackInt2101010Rev(packed, unpacked);
+    CORRADE_COMPARE(unpacked[1], (Vector4{0.0f, 0.0f, 1.0f, 1.0f}));
+
+    Math::packUnsignedInt2101010Rev(values, packed);
+    CORRADE_COMPARE(packed[0], 0x000003ff);
+    CORRADE_COMPARE(packed[1], 0xfff00000);
+    Math::unpackUnsignedInt2101010Rev(packed, unpacked);
+    CORRADE_COMPARE(unpacked[1], (Vector4{0.0f, 0.0f, 1.0f, 1.0f}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::PackingTest)
@@ -0,0 +1,115 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Quaternion.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct QuaternionBenchmark: Corrade::TestSuite::Tester {
+    explicit QuaternionBenchmark();
+
+    void multiply();
+    void lerp();
+    void slerp();
+    void transformVectorNormalized();
+    void toMatrix();
+};
+
+typedef Math::Deg<Float> Deg;
+typedef Math::Quaternion<Float> Quaternion;
+typedef Math::Vector3<Float> Vector3;
+
+namespace {
+    /* Each benchmark processes 1k quaternions 100 times, divide the iteration
+       count by the measured time to get quaternions per second */
+    constexpr std::size_t QuaternionCount = 1024;
+
+    std::vector<Quaternion> quaternions() {
+        std::vector<Quaternion> out;
+        out.reserve(QuaternionCount);
+        for(std::size_t i = 0; i != QuaternionCount; ++i)
+            out.push_back(Quaternion::rotation(Deg(Float(i%360)), Vector3{1.0f, Float(i%5), -1.0f}.normalized()));
+        return out;
+    }
+}
+
+QuaternionBenchmark::QuaternionBenchmark() {
+    addBenchmarks({&QuaternionBenchmark::multiply,
+                   &QuaternionBenchmark::lerp,
+                   &QuaternionBenchmark::slerp,
+                   &QuaternionBenchmark::transformVectorNormalized,
+                   &QuaternionBenchmark::toMatrix}, 5, BenchmarkType::WallClock);
+}
+
+void QuaternionBenchmark::multiply() {
+    const std::vector<Quaternion> in = quaternions();
+    Quaternion result;
+    CORRADE_BENCHMARK(100)
+        for(const Quaternion& quaternion: in)
+            result = result*quaternion;
+    CORRADE_VERIFY(result == result);
+}
+
+void QuaternionBenchmark::lerp() {
+    const std::vector<Quaternion> in = quaternions();
+    Quaternion sum{Math::ZeroInit};
+    CORRADE_BENCHMARK(100)
+        for(std::size_t i = 1; i != in.size(); ++i)
+            sum += Math::lerp(in[i - 1], in[i], 0.35f);
+    CORRADE_VERIFY(sum == sum);
+}
+
+void QuaternionBenchmark::slerp() {
+    const std::vector<Quaternion> in = quaternions();
+    Quaternion sum{Math::ZeroInit};
+    CORRADE_BENCHMARK(100)
+        for(std::size_t i = 1; i != in.size(); ++i)
+            sum += Math::slerp(in[i - 1], in[i], 0.35f);
+    CORRADE_VERIFY(sum == sum);
+}
+
+void QuaternionBenchmark::transformVectorNormalized() {
+    const std::vector<Quaternion> in = quaternions();
+    Vector3 sum;
+    CORRADE_BENCHMARK(100)
+        for(const Quaternion& quaternion: in)
+            sum += quaternion.transformVectorNormalized({1.0f, 2.0f, 3.0f});
+    CORRADE_VERIFY(sum == sum);
+}
+
+void QuaternionBenchmark::toMatrix() {
+    const std::vector<Quaternion> in = quaternions();
+    Matrix<3, Float> sum{Math::ZeroInit};
+    CORRADE_BENCHMARK(100)
+        for(const Quaternion& quaternion: in)
+            sum += quaternion.toMatrix();
+    CORRADE_VERIFY(sum[0][0] == sum[0][0]);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::QuaternionBenchmark)
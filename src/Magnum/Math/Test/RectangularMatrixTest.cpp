@@ -305,12 +305,14 @@ void RectangularMatrixTest::data() {
 }
 
 void RectangularMatrixTest::row() {
-    Matrix3x4 a(Vector4(1.0f,  2.0f,  3.0f,  4.0f),
-                Vector4(5.0f,  6.0f,  7.0f,  8.0f),
-                Vector4(9.0f, 10.0f, 11.0f, 12.0f));
+    constexpr Matrix3x4 original(Vector4(1.0f,  2.0f,  3.0f,  4.0f),
+                                 Vector4(5.0f,  6.0f,  7.0f,  8.0f),
+                                 Vector4(9.0f, 10.0f, 11.0f, 12.0f));
 
-    CORRADE_COMPARE(a.row(1), Vector3(2.0f, 6.0f, 10.0f));
+    constexpr Vector3 row = original.row(1);
+    CORRADE_COMPARE(row, Vector3(2.0f, 6.0f, 10.0f));
 
+    Matrix3x4 a{original};
     a.setRow(1, {-2.1f, -6.1f, -10.1f});
     CORRADE_COMPARE(a, (Matrix3x4{Vector4{1.0f,  -2.1f,  3.0f,  4.0f},
                                   Vector4{5.0f,  -6.1f,  7.0f,  8.0f},
@@ -336,58 +338,63 @@ void RectangularMatrixTest::compare() {
 }
 
 void RectangularMatrixTest::negative() {
-    Matrix2x2 matrix(Vector2(1.0f,  -3.0f),
-                     Vector2(5.0f, -10.0f));
-    Matrix2x2 negated(Vector2(-1.0f,  3.0f),
-                      Vector2(-5.0f, 10.0f));
-    CORRADE_COMPARE(-matrix, negated);
+    constexpr Matrix2x2 matrix(Vector2(1.0f,  -3.0f),
+                               Vector2(5.0f, -10.0f));
+    constexpr Matrix2x2 negated = -matrix;
+    CORRADE_COMPARE(negated, Matrix2x2(Vector2(-1.0f,  3.0f),
+                                       Vector2(-5.0f, 10.0f)));
 }
 
 void RectangularMatrixTest::addSubtract() {
-    Matrix4x3 a(Vector3(0.0f,   1.0f,   3.0f),
-                Vector3(4.0f,   5.0f,   7.0f),
-                Vector3(8.0f,   9.0f,   11.0f),
-                Vector3(12.0f, 13.0f,  15.0f));
-    Matrix4x3 b(Vector3(-4.0f,  0.5f,   9.0f),
-                Vector3(-9.0f, 11.0f,  0.25f),
-                Vector3( 0.0f, -8.0f,  19.0f),
-                Vector3(-3.0f, -5.0f,   2.0f));
-    Matrix4x3 c(Vector3(-4.0f,  1.5f,  12.0f),
-                Vector3(-5.0f, 16.0f,  7.25f),
-                Vector3( 8.0f,  1.0f,  30.0f),
-                Vector3( 9.0f,  8.0f,  17.0f));
-
-    CORRADE_COMPARE(a + b, c);
-    CORRADE_COMPARE(c - b, a);
+    constexpr Matrix4x3 a(Vector3(0.0f,   1.0f,   3.0f),
+                          Vector3(4.0f,   5.0f,   7.0f),
+                          Vector3(8.0f,   9.0f,   11.0f),
+                          Vector3(12.0f, 13.0f,  15.0f));
+    constexpr Matrix4x3 b(Vector3(-4.0f,  0.5f,   9.0f),
+                          Vector3(-9.0f, 11.0f,  0.25f),
+                          Vector3( 0.0f, -8.0f,  19.0f),
+                          Vector3(-3.0f, -5.0f,   2.0f));
+    constexpr Matrix4x3 c(Vector3(-4.0f,  1.5f,  12.0f),
+                          Vector3(-5.0f, 16.0f,  7.25f),
+                          Vector3( 8.0f,  1.0f,  30.0f),
+                          Vector3( 9.0f,  8.0f,  17.0f));
+
+    constexpr Matrix4x3 added = a + b;
+    constexpr Matrix4x3 subtracted = c - b;
+    CORRADE_COMPARE(added, c);
+    CORRADE_COMPARE(subtracted, a);
 }
 
 void RectangularMatrixTest::multiplyDivide() {
-    Matrix2x2 matrix(Vector2(1.0f, 2.0f),
-                     Vector2(3.0f, 4.0f));
-    Matrix2x2 multiplied(Vector2(-1.5f, -3.0f),
-                         Vector2(-4.5f, -6.0f));
-
-    CORRADE_COMPARE(matrix*-1.5f, multiplied);
-    CORRADE_COMPARE(-1.5f*matrix, multiplied);
-    CORRADE_COMPARE(multiplied/-1.5f, matrix);
+    constexpr Matrix2x2 matrix(Vector2(1.0f, 2.0f),
+                               Vector2(3.0f, 4.0f));
+    constexpr Matrix2x2 multiplied(Vector2(-1.5f, -3.0f),
+                                   Vector2(-4.5f, -6.0f));
+
+    constexpr Matrix2x2 a = matrix*-1.5f;
+    constexpr Matrix2x2 b = -1.5f*matrix;
+    constexpr Matrix2x2 c = multiplied/-1.5f;
+    CORRADE_COMPARE(a, multiplied);
+    CORRADE_COMPARE(b, multiplied);
+    CORRADE_COMPARE(c, matrix);
 
     /* Divide vector with number and inverse */
-    Matrix2x2 divisor(Vector2( 1.0f, 2.0f),
-                      Vector2(-4.0f, 8.0f));
-    Matrix2x2 result(Vector2(  1.0f,   0.5f),
-                     Vector2(-0.25f, 0.125f));
-    CORRADE_COMPARE(1.0f/divisor, result);
+    constexpr Matrix2x2 divisor(Vector2( 1.0f, 2.0f),
+                                Vector2(-4.0f, 8.0f));
+    constexpr Matrix2x2 result = 1.0f/divisor;
+    CORRADE_COMPARE(result, Matrix2x2(Vector2(  1.0f,   0.5f),
+                                      Vector2(-0.25f, 0.125f)));
 }
 
 void RectangularMatrixTest::multiply() {
-    RectangularMatrix<4, 6, Int> left(
+    constexpr RectangularMatrix<4, 6, Int> left(
         Vector<6, Int>(-5,   27, 10,  33, 0, -15),
         Vector<6, Int>( 7,   56, 66,   1, 0, -24),
         Vector<6, Int>( 4,   41,  4,   0, 1,  -4),
         Vector<6, Int>( 9, -100, 19, -49, 1,   9)
     );
 
-    RectangularMatrix<5, 4, Int> right(
+    constexpr RectangularMatrix<5, 4, Int> right(
         Vector<4, Int>(1,  -7,  0,  158),
         Vector<4, Int>(2,  24, -3,   40),
         Vector<4, Int>(3, -15, -2,  -50),
@@ -403,36 +410,40 @@ void RectangularMatrixTest::multiply() {
        Vector<6, Int>(  363,    179,  2388,  -687,   22,  -649)
     );
 
-    CORRADE_COMPARE(left*right, expected);
+    constexpr RectangularMatrix<5, 6, Int> multiplied = left*right;
+    CORRADE_COMPARE(multiplied, expected);
 }
 
 void RectangularMatrixTest::multiplyVector() {
-    Vector4i a(-5, 27, 10, 33);
-    RectangularMatrix<3, 1, Int> b(1, 2, 3);
-    CORRADE_COMPARE(a*b, Matrix3x4i(
+    constexpr Vector4i a(-5, 27, 10, 33);
+    constexpr RectangularMatrix<3, 1, Int> b(1, 2, 3);
+    constexpr Matrix3x4i ab = a*b;
+    CORRADE_COMPARE(ab, Matrix3x4i(
        Vector4i( -5,  27, 10,  33),
        Vector4i(-10,  54, 20,  66),
        Vector4i(-15,  81, 30,  99)
     ));
 
-    Matrix3x4i c(Vector4i(0, 4,  8, 12),
-                 Vector4i(1, 5,  9, 13),
-                 Vector4i(3, 7, 11, 15));
-    Vector3i d(2, -2, 3);
-    CORRADE_COMPARE(c*d, Vector4i(7, 19, 31, 43));
+    constexpr Matrix3x4i c(Vector4i(0, 4,  8, 12),
+                           Vector4i(1, 5,  9, 13),
+                           Vector4i(3, 7, 11, 15));
+    constexpr Vector3i d(2, -2, 3);
+    constexpr Vector4i cd = c*d;
+    CORRADE_COMPARE(cd, Vector4i(7, 19, 31, 43));
 }
 
 void RectangularMatrixTest::transposed() {
-    Matrix4x3 original(Vector3( 0.0f,  1.0f,  3.0f),
-                       Vector3( 4.0f,  5.0f,  7.0f),
-                       Vector3( 8.0f,  9.0f, 11.0f),
-                       Vector3(12.0f, 13.0f, 15.0f));
+    constexpr Matrix4x3 original(Vector3( 0.0f,  1.0f,  3.0f),
+                                 Vector3( 4.0f,  5.0f,  7.0f),
+                                 Vector3( 8.0f,  9.0f, 11.0f),
+                                 Vector3(12.0f, 13.0f, 15.0f));
+    constexpr Matrix3x4 transposed = original.transposed();
 
-    Matrix3x4 transposed(Vector4(0.0f, 4.0f,  8.0f, 12.0f),
-                         Vector4(1.0f, 5.0f,  9.0f, 13.0f),
-                         Vector4(3.0f, 7.0f, 11.0f, 15.0f));
+    Matrix3x4 expectedTransposed(Vector4(0.0f, 4.0f,  8.0f, 12.0f),
+                                 Vector4(1.0f, 5.0f,  9.0f, 13.0f),
+                                 Vector4(3.0f, 7.0f, 11.0f, 15.0f));
 
-    CORRADE_COMPARE(original.transposed(), transposed);
+    CORRADE_COMPARE(transposed, expectedTransposed);
 }
 
 void RectangularMatrixTest::flippedCols() {
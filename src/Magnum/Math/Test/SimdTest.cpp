@@ -0,0 +1,131 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Quaternion.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct SimdTest: Corrade::TestSuite::Tester {
+    explicit SimdTest();
+
+    void dot();
+    void multiply();
+    void multiplyVector();
+    void transpose();
+    void invertedRigid();
+    void multiplyQuaternion();
+};
+
+typedef Math::Vector4<Float> Vector4;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Matrix3x3<Float> Matrix3x3;
+typedef Math::Quaternion<Float> Quaternion;
+typedef Math::Deg<Float> Deg;
+
+SimdTest::SimdTest() {
+    addTests({&SimdTest::dot,
+              &SimdTest::multiply,
+              &SimdTest::multiplyVector,
+              &SimdTest::transpose,
+              &SimdTest::invertedRigid,
+              &SimdTest::multiplyQuaternion});
+}
+
+/* The operators pick the SIMD overloads if MAGNUM_MATH_SIMD is defined,
+   explicitly specified template arguments always pick the generic code */
+
+void SimdTest::dot() {
+    const Vector4 a{1.5f, -3.0f, 0.25f, 7.0f};
+    const Vector4 b{-2.0f, 0.5f, 8.0f, 1.25f};
+    CORRADE_COMPARE(Math::dot(a, b), (Math::dot<4, Float>(a, b)));
+    CORRADE_COMPARE(a.dot(), 60.3125f);
+}
+
+void SimdTest::multiply() {
+    const Matrix4 a{Vector4{3.0f, 5.0f, 8.0f, -3.0f},
+                    Vector4{4.5f, 4.0f, 7.0f, 2.0f},
+                    Vector4{1.0f, 2.0f, 3.0f, -1.0f},
+                    Vector4{7.9f, -1.0f, 8.0f, -1.5f}};
+    const Matrix4 b{Vector4{-2.0f, 0.5f, 1.0f, 4.0f},
+                    Vector4{3.0f, -1.0f, 2.5f, 0.0f},
+                    Vector4{1.5f, 6.0f, -3.0f, 2.0f},
+                    Vector4{0.0f, 1.0f, 0.5f, 1.0f}};
+
+    const RectangularMatrix<4, 4, Float> expected = Implementation::matrixMultiply<4, 4, 4, Float>(a, b);
+    CORRADE_COMPARE(a*b, expected);
+    CORRADE_COMPARE(Matrix4::translation({1.0f, 2.0f, 3.0f})*Matrix4::scaling(Vector3<Float>{2.0f}),
+        Matrix4::from(Matrix3x3::fromDiagonal(Vector3<Float>{2.0f}), {1.0f, 2.0f, 3.0f}));
+}
+
+void SimdTest::multiplyVector() {
+    const Matrix4 a{Vector4{3.0f, 5.0f, 8.0f, -3.0f},
+                    Vector4{4.5f, 4.0f, 7.0f, 2.0f},
+                    Vector4{1.0f, 2.0f, 3.0f, -1.0f},
+                    Vector4{7.9f, -1.0f, 8.0f, -1.5f}};
+    const Vector4 b{-5.0f, -2.0f, -7.0f, 2.0f};
+
+    const RectangularMatrix<1, 4, Float> expected = Implementation::matrixMultiply<1, 4, 4, Float>(a, RectangularMatrix<1, 4, Float>{b});
+    CORRADE_COMPARE(a*b, expected[0]);
+    CORRADE_COMPARE(a*b, (Vector4{-15.2f, -49.0f, -59.0f, 15.0f}));
+}
+
+void SimdTest::transpose() {
+    const Matrix4 a{Vector4{0.0f, 1.0f, 2.0f, 3.0f},
+                    Vector4{4.0f, 5.0f, 6.0f, 7.0f},
+                    Vector4{8.0f, 9.0f, 10.0f, 11.0f},
+                    Vector4{12.0f, 13.0f, 14.0f, 15.0f}};
+    const Matrix4 expected{Vector4{0.0f, 4.0f, 8.0f, 12.0f},
+                           Vector4{1.0f, 5.0f, 9.0f, 13.0f},
+                           Vector4{2.0f, 6.0f, 10.0f, 14.0f},
+                           Vector4{3.0f, 7.0f, 11.0f, 15.0f}};
+
+    CORRADE_COMPARE(a.transposed(), expected);
+    CORRADE_COMPARE(a.transposed(), (Implementation::matrixTranspose<4, 4, Float>(a)));
+}
+
+void SimdTest::invertedRigid() {
+    const Matrix4 a = Matrix4::translation({1.0f, -3.5f, 7.0f})*
+        Matrix4::rotation(Deg(-74.0f), Vector3<Float>{-1.0f, 0.5f, 2.0f}.normalized());
+
+    const Matrix4 expected = Implementation::matrixInvertedRigid<Float>(a);
+    CORRADE_COMPARE(a.invertedRigid(), expected);
+    CORRADE_COMPARE(a.invertedRigid()*a, Matrix4{});
+    CORRADE_COMPARE(a.invertedRigid(), a.inverted());
+}
+
+void SimdTest::multiplyQuaternion() {
+    const Quaternion a{{-6.0f, -9.0f, 15.0f}, 0.5f};
+    const Quaternion b{{2.0f, 3.0f, -4.0f}, -1.5f};
+
+    CORRADE_COMPARE(a*b, (Implementation::quaternionMultiply<Float>(a, b)));
+    CORRADE_COMPARE(a*b, Quaternion({1.0f, 21.0f, -24.5f}, 98.25f));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::SimdTest)
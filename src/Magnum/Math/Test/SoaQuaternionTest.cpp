@@ -0,0 +1,190 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/SoaQuaternion.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct SoaQuaternionTest: Corrade::TestSuite::Tester {
+    explicit SoaQuaternionTest();
+
+    void construct();
+    void constructDefault();
+    void convert();
+    void access();
+
+    void multiply();
+    void dot();
+    void normalized();
+    void conjugated();
+    void transformVectorNormalized();
+    void composeRigid();
+
+    void debug();
+};
+
+typedef Math::Vector<4, Float> Vector4;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Quaternion<Float> Quaternion;
+typedef Math::DualQuaternion<Float> DualQuaternion;
+typedef Math::SoaVector3<4, Float> SoaVector3;
+typedef Math::SoaQuaternion<4, Float> SoaQuaternion;
+typedef Math::Deg<Float> Deg;
+
+SoaQuaternionTest::SoaQuaternionTest() {
+    addTests({&SoaQuaternionTest::construct,
+              &SoaQuaternionTest::constructDefault,
+              &SoaQuaternionTest::convert,
+              &SoaQuaternionTest::access,
+
+              &SoaQuaternionTest::multiply,
+              &SoaQuaternionTest::dot,
+              &SoaQuaternionTest::normalized,
+              &SoaQuaternionTest::conjugated,
+              &SoaQuaternionTest::transformVectorNormalized,
+              &SoaQuaternionTest::composeRigid,
+
+              &SoaQuaternionTest::debug});
+}
+
+namespace {
+    const Quaternion Data[]{
+        Quaternion::rotation(Deg(35.0f), Vector3::xAxis()),
+        Quaternion::rotation(Deg(-120.0f), Vector3{1.0f, 1.0f, 0.0f}.normalized()),
+        Quaternion::rotation(Deg(90.0f), Vector3::zAxis()),
+        Quaternion::rotation(Deg(7.5f), Vector3{-1.0f, 3.0f, 2.0f}.normalized())};
+
+    const Vector3 Vectors[]{
+        {1.0f, 2.0f, 3.0f},
+        {-4.0f, 0.5f, 2.0f},
+        {0.0f, -1.0f, 5.0f},
+        {3.0f, 7.0f, -2.5f}};
+}
+
+void SoaQuaternionTest::construct() {
+    const SoaQuaternion a{SoaVector3{Vector3{1.0f, 2.0f, 3.0f}}, Vector4{4.0f, 5.0f, 6.0f, 7.0f}};
+    CORRADE_COMPARE(a[0], Quaternion({1.0f, 2.0f, 3.0f}, 4.0f));
+    CORRADE_COMPARE(a[3], Quaternion({1.0f, 2.0f, 3.0f}, 7.0f));
+    CORRADE_COMPARE(a.scalar(), (Vector4{4.0f, 5.0f, 6.0f, 7.0f}));
+    CORRADE_COMPARE(a.vector()[1], (Vector3{1.0f, 2.0f, 3.0f}));
+}
+
+void SoaQuaternionTest::constructDefault() {
+    const SoaQuaternion a;
+    for(std::size_t i = 0; i != 4; ++i)
+        CORRADE_COMPARE(a[i], Quaternion{});
+    CORRADE_COMPARE(a, SoaQuaternion{Quaternion{}});
+}
+
+void SoaQuaternionTest::convert() {
+    const SoaQuaternion a = SoaQuaternion::from(Data);
+    Quaternion out[4];
+    a.to(out);
+    for(std::size_t i = 0; i != 4; ++i) {
+        CORRADE_COMPARE(a[i], Data[i]);
+        CORRADE_COMPARE(out[i], Data[i]);
+    }
+}
+
+void SoaQuaternionTest::access() {
+    SoaQuaternion a;
+    a.set(2, Data[1]);
+    a.scalar()[0] = 0.5f;
+    CORRADE_COMPARE(a[0], Quaternion({}, 0.5f));
+    CORRADE_COMPARE(a[2], Data[1]);
+    CORRADE_VERIFY(a != SoaQuaternion{});
+}
+
+void SoaQuaternionTest::multiply() {
+    const SoaQuaternion a = SoaQuaternion::from(Data);
+    const SoaQuaternion b{Quaternion({-1.0f, 0.5f, 2.0f}, 3.0f)};
+    for(std::size_t i = 0; i != 4; ++i) {
+        CORRADE_COMPARE((a*b)[i], Data[i]*b[i]);
+        CORRADE_COMPARE((b*a)[i], b[i]*Data[i]);
+    }
+}
+
+void SoaQuaternionTest::dot() {
+    const SoaQuaternion a = SoaQuaternion::from(Data);
+    const SoaQuaternion b{Quaternion({-1.0f, 0.5f, 2.0f}, 3.0f)};
+    for(std::size_t i = 0; i != 4; ++i) {
+        CORRADE_COMPARE(Math::dot(a, b)[i], Math::dot(Data[i], b[i]));
+        CORRADE_COMPARE(b.dot()[i], b[i].dot());
+        CORRADE_COMPARE(b.length()[i], b[i].length());
+    }
+}
+
+void SoaQuaternionTest::normalized() {
+    const SoaQuaternion a = (SoaQuaternion::from(Data)*SoaQuaternion{Quaternion({-1.0f, 0.5f, 2.0f}, 3.0f)}).normalized();
+    for(std::size_t i = 0; i != 4; ++i) {
+        CORRADE_VERIFY(a[i].isNormalized());
+        CORRADE_COMPARE(a[i], (Data[i]*Quaternion({-1.0f, 0.5f, 2.0f}, 3.0f)).normalized());
+    }
+}
+
+void SoaQuaternionTest::conjugated() {
+    const SoaQuaternion a = SoaQuaternion::from(Data).conjugated();
+    for(std::size_t i = 0; i != 4; ++i)
+        CORRADE_COMPARE(a[i], Data[i].conjugated());
+}
+
+void SoaQuaternionTest::transformVectorNormalized() {
+    const SoaVector3 a = SoaQuaternion::from(Data).transformVectorNormalized(SoaVector3::from(Vectors));
+    for(std::size_t i = 0; i != 4; ++i)
+        CORRADE_COMPARE(a[i], Data[i].transformVectorNormalized(Vectors[i]));
+}
+
+void SoaQuaternionTest::composeRigid() {
+    /* Parent and child transformations of four objects */
+    const SoaQuaternion parentRotation = SoaQuaternion::from(Data);
+    const SoaVector3 parentTranslation = SoaVector3::from(Vectors);
+    const SoaQuaternion rotation{Quaternion::rotation(Deg(25.0f), Vector3::yAxis())};
+    const SoaVector3 translation{Vector3{0.5f, -1.0f, 2.0f}};
+
+    const SoaQuaternion composedRotation = parentRotation*rotation;
+    const SoaVector3 composedTranslation = parentRotation.transformVectorNormalized(translation) + parentTranslation;
+
+    for(std::size_t i = 0; i != 4; ++i) {
+        const DualQuaternion expected =
+            DualQuaternion::translation(Vectors[i])*DualQuaternion{Data[i]}*
+            DualQuaternion::translation({0.5f, -1.0f, 2.0f})*DualQuaternion{rotation[i]};
+        CORRADE_COMPARE(composedRotation[i], expected.rotation());
+        CORRADE_COMPARE(composedTranslation[i], expected.translation());
+    }
+}
+
+void SoaQuaternionTest::debug() {
+    std::ostringstream out;
+    Debug(&out) << Math::SoaQuaternion<2, Float>{Quaternion({1.0f, 2.0f, 3.0f}, 4.0f)};
+    CORRADE_COMPARE(out.str(), "SoaQuaternion(Quaternion({1, 2, 3}, 4), Quaternion({1, 2, 3}, 4))\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::SoaQuaternionTest)
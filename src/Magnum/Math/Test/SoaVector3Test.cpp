@@ -0,0 +1,187 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/SoaVector3.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct SoaVector3Test: Corrade::TestSuite::Tester {
+    explicit SoaVector3Test();
+
+    void construct();
+    void constructDefault();
+    void constructBroadcast();
+    void convert();
+    void access();
+
+    void arithmetic();
+    void dot();
+    void cross();
+    void normalized();
+    void transform();
+
+    void debug();
+};
+
+typedef Math::Vector<4, Float> Vector4;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::SoaVector3<4, Float> SoaVector3;
+typedef Math::Deg<Float> Deg;
+
+SoaVector3Test::SoaVector3Test() {
+    addTests({&SoaVector3Test::construct,
+              &SoaVector3Test::constructDefault,
+              &SoaVector3Test::constructBroadcast,
+              &SoaVector3Test::convert,
+              &SoaVector3Test::access,
+
+              &SoaVector3Test::arithmetic,
+              &SoaVector3Test::dot,
+              &SoaVector3Test::cross,
+              &SoaVector3Test::normalized,
+              &SoaVector3Test::transform,
+
+              &SoaVector3Test::debug});
+}
+
+namespace {
+    const Vector3 Data[]{
+        {1.0f, 2.0f, 3.0f},
+        {-4.0f, 0.5f, 2.0f},
+        {0.0f, -1.0f, 5.0f},
+        {3.0f, 7.0f, -2.5f}};
+}
+
+void SoaVector3Test::construct() {
+    const SoaVector3 a{Vector4{1.0f, 2.0f, 3.0f, 4.0f},
+                       Vector4{5.0f, 6.0f, 7.0f, 8.0f},
+                       Vector4{9.0f, 10.0f, 11.0f, 12.0f}};
+    CORRADE_COMPARE(a.x(), (Vector4{1.0f, 2.0f, 3.0f, 4.0f}));
+    CORRADE_COMPARE(a.y(), (Vector4{5.0f, 6.0f, 7.0f, 8.0f}));
+    CORRADE_COMPARE(a.z(), (Vector4{9.0f, 10.0f, 11.0f, 12.0f}));
+    CORRADE_COMPARE(a[2], (Vector3{3.0f, 7.0f, 11.0f}));
+}
+
+void SoaVector3Test::constructDefault() {
+    const SoaVector3 a;
+    CORRADE_COMPARE(a, SoaVector3(Vector3{}));
+}
+
+void SoaVector3Test::constructBroadcast() {
+    const SoaVector3 a{Vector3{1.0f, -2.0f, 3.0f}};
+    for(std::size_t i = 0; i != 4; ++i)
+        CORRADE_COMPARE(a[i], (Vector3{1.0f, -2.0f, 3.0f}));
+}
+
+void SoaVector3Test::convert() {
+    const SoaVector3 a = SoaVector3::from(Data);
+    CORRADE_COMPARE(a.x(), (Vector4{1.0f, -4.0f, 0.0f, 3.0f}));
+    CORRADE_COMPARE(a.y(), (Vector4{2.0f, 0.5f, -1.0f, 7.0f}));
+    CORRADE_COMPARE(a.z(), (Vector4{3.0f, 2.0f, 5.0f, -2.5f}));
+
+    Vector3 out[4];
+    a.to(out);
+    for(std::size_t i = 0; i != 4; ++i)
+        CORRADE_COMPARE(out[i], Data[i]);
+}
+
+void SoaVector3Test::access() {
+    SoaVector3 a;
+    a.set(1, {1.0f, 2.0f, 3.0f});
+    a.z()[3] = 7.0f;
+    CORRADE_COMPARE(a[0], Vector3{});
+    CORRADE_COMPARE(a[1], (Vector3{1.0f, 2.0f, 3.0f}));
+    CORRADE_COMPARE(a[3], (Vector3{0.0f, 0.0f, 7.0f}));
+    CORRADE_VERIFY(a != SoaVector3{});
+}
+
+void SoaVector3Test::arithmetic() {
+    const SoaVector3 a = SoaVector3::from(Data);
+    const SoaVector3 b{Vector3{0.5f, 1.0f, -2.0f}};
+    const Vector4 numbers{1.0f, 2.0f, -1.0f, 0.5f};
+
+    for(std::size_t i = 0; i != 4; ++i) {
+        CORRADE_COMPARE((-a)[i], -Data[i]);
+        CORRADE_COMPARE((a + b)[i], Data[i] + b[i]);
+        CORRADE_COMPARE((a - b)[i], Data[i] - b[i]);
+        CORRADE_COMPARE((a*b)[i], Data[i]*b[i]);
+        CORRADE_COMPARE((a*numbers)[i], Data[i]*numbers[i]);
+        CORRADE_COMPARE((a*2.0f)[i], Data[i]*2.0f);
+    }
+}
+
+void SoaVector3Test::dot() {
+    const SoaVector3 a = SoaVector3::from(Data);
+    const SoaVector3 b{Vector3{0.5f, 1.0f, -2.0f}};
+
+    for(std::size_t i = 0; i != 4; ++i) {
+        CORRADE_COMPARE(Math::dot(a, b)[i], Math::dot(Data[i], b[i]));
+        CORRADE_COMPARE(a.dot()[i], Data[i].dot());
+        CORRADE_COMPARE(a.length()[i], Data[i].length());
+    }
+}
+
+void SoaVector3Test::cross() {
+    const SoaVector3 a = SoaVector3::from(Data);
+    const SoaVector3 b{Vector3{0.5f, 1.0f, -2.0f}};
+
+    for(std::size_t i = 0; i != 4; ++i)
+        CORRADE_COMPARE(Math::cross(a, b)[i], Math::cross(Data[i], b[i]));
+}
+
+void SoaVector3Test::normalized() {
+    const SoaVector3 a = SoaVector3::from(Data).normalized();
+
+    for(std::size_t i = 0; i != 4; ++i)
+        CORRADE_COMPARE(a[i], Data[i].normalized());
+}
+
+void SoaVector3Test::transform() {
+    const Matrix4 matrix = Matrix4::translation({1.0f, -2.0f, 0.5f})*
+        Matrix4::rotation(Deg(35.0f), Vector3{1.0f, 2.0f, -1.0f}.normalized())*
+        Matrix4::scaling({2.0f, 1.0f, 0.5f});
+    const SoaVector3 a = SoaVector3::from(Data);
+
+    const SoaVector3 points = Math::transformPoint(matrix, a);
+    const SoaVector3 vectors = Math::transformVector(matrix, a);
+    for(std::size_t i = 0; i != 4; ++i) {
+        CORRADE_COMPARE(points[i], matrix.transformPoint(Data[i]));
+        CORRADE_COMPARE(vectors[i], matrix.transformVector(Data[i]));
+    }
+}
+
+void SoaVector3Test::debug() {
+    std::ostringstream out;
+    Debug(&out) << Math::SoaVector3<2, Float>::from(Data);
+    CORRADE_COMPARE(out.str(), "SoaVector3(Vector(1, 2, 3), Vector(-4, 0.5, 2))\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::SoaVector3Test)
@@ -42,6 +42,7 @@ void TagsTest::noDefaultConstructor() {
     CORRADE_VERIFY(!std::is_default_constructible<NoInitT>::value);
     CORRADE_VERIFY(!std::is_default_constructible<ZeroInitT>::value);
     CORRADE_VERIFY(!std::is_default_constructible<IdentityInitT>::value);
+    CORRADE_VERIFY(!std::is_default_constructible<FastMathT>::value);
 }
 
 }}}
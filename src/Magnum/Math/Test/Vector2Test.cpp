@@ -193,10 +193,11 @@ void Vector2Test::access() {
 }
 
 void Vector2Test::cross() {
-    Vector2i a(1, -1);
-    Vector2i b(4, 3);
+    constexpr Vector2i a(1, -1);
+    constexpr Vector2i b(4, 3);
 
-    CORRADE_COMPARE(Math::cross(a, b), 7);
+    constexpr Int c = Math::cross(a, b);
+    CORRADE_COMPARE(c, 7);
     CORRADE_COMPARE(Math::cross<Int>({a, 0}, {b, 0}), Vector3i(0, 0, Math::cross(a, b)));
 }
 
@@ -212,10 +212,11 @@ void Vector3Test::access() {
 }
 
 void Vector3Test::cross() {
-    Vector3i a(1, -1, 1);
-    Vector3i b(4, 3, 7);
+    constexpr Vector3i a(1, -1, 1);
+    constexpr Vector3i b(4, 3, 7);
 
-    CORRADE_COMPARE(Math::cross(a, b), Vector3i(-10, -3, 7));
+    constexpr Vector3i c = Math::cross(a, b);
+    CORRADE_COMPARE(c, Vector3i(-10, -3, 7));
 }
 
 void Vector3Test::axes() {
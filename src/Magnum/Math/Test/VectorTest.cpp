@@ -91,6 +91,7 @@ struct VectorTest: Corrade::TestSuite::Tester {
     void length();
     void lengthInverted();
     void normalized();
+    void normalizedFast();
     void resized();
 
     void sum();
@@ -151,6 +152,7 @@ VectorTest::VectorTest() {
               &VectorTest::length,
               &VectorTest::lengthInverted,
               &VectorTest::normalized,
+              &VectorTest::normalizedFast,
               &VectorTest::resized,
 
               &VectorTest::sum,
@@ -336,30 +338,36 @@ void VectorTest::compareComponentWise() {
 }
 
 void VectorTest::negative() {
-    CORRADE_COMPARE(-Vector4(1.0f, -3.0f, 5.0f, -10.0f), Vector4(-1.0f, 3.0f, -5.0f, 10.0f));
+    constexpr Vector4 a = -Vector4(1.0f, -3.0f, 5.0f, -10.0f);
+    CORRADE_COMPARE(a, Vector4(-1.0f, 3.0f, -5.0f, 10.0f));
 }
 
 void VectorTest::addSubtract() {
-    Vector4 a(1.0f, -3.0f, 5.0f, -10.0f);
-    Vector4 b(7.5f, 33.0f, -15.0f, 0.0f);
-    Vector4 c(8.5f, 30.0f, -10.0f, -10.0f);
+    constexpr Vector4 a(1.0f, -3.0f, 5.0f, -10.0f);
+    constexpr Vector4 b(7.5f, 33.0f, -15.0f, 0.0f);
+    constexpr Vector4 c(8.5f, 30.0f, -10.0f, -10.0f);
 
-    CORRADE_COMPARE(a + b, c);
-    CORRADE_COMPARE(c - b, a);
+    constexpr Vector4 added = a + b;
+    constexpr Vector4 subtracted = c - b;
+    CORRADE_COMPARE(added, c);
+    CORRADE_COMPARE(subtracted, a);
 }
 
 void VectorTest::multiplyDivide() {
-    Vector4 vector(1.0f, 2.0f, 3.0f, 4.0f);
-    Vector4 multiplied(-1.5f, -3.0f, -4.5f, -6.0f);
+    constexpr Vector4 vector(1.0f, 2.0f, 3.0f, 4.0f);
+    constexpr Vector4 multiplied(-1.5f, -3.0f, -4.5f, -6.0f);
 
-    CORRADE_COMPARE(vector*-1.5f, multiplied);
-    CORRADE_COMPARE(-1.5f*vector, multiplied);
-    CORRADE_COMPARE(multiplied/-1.5f, vector);
+    constexpr Vector4 a = vector*-1.5f;
+    constexpr Vector4 b = -1.5f*vector;
+    constexpr Vector4 c = multiplied/-1.5f;
+    CORRADE_COMPARE(a, multiplied);
+    CORRADE_COMPARE(b, multiplied);
+    CORRADE_COMPARE(c, vector);
 
     /* Divide vector with number and invert */
-    Vector4 divisor(1.0f, 2.0f, -4.0f, 8.0f);
-    Vector4 result(1.0f, 0.5f, -0.25f, 0.125f);
-    CORRADE_COMPARE(1.0f/divisor, result);
+    constexpr Vector4 divisor(1.0f, 2.0f, -4.0f, 8.0f);
+    constexpr Vector4 result = 1.0f/divisor;
+    CORRADE_COMPARE(result, Vector4(1.0f, 0.5f, -0.25f, 0.125f));
 }
 
 void VectorTest::multiplyDivideIntegral() {
@@ -374,12 +382,14 @@ void VectorTest::multiplyDivideIntegral() {
 }
 
 void VectorTest::multiplyDivideComponentWise() {
-    Vector4 vec(1.0f, 2.0f, 3.0f, 4.0f);
-    Vector4 multiplier(7.0f, -4.0f, -1.5f, 1.0f);
-    Vector4 multiplied(7.0f, -8.0f, -4.5f, 4.0f);
+    constexpr Vector4 vec(1.0f, 2.0f, 3.0f, 4.0f);
+    constexpr Vector4 multiplier(7.0f, -4.0f, -1.5f, 1.0f);
+    constexpr Vector4 multiplied(7.0f, -8.0f, -4.5f, 4.0f);
 
-    CORRADE_COMPARE(vec*multiplier, multiplied);
-    CORRADE_COMPARE(multiplied/multiplier, vec);
+    constexpr Vector4 a = vec*multiplier;
+    constexpr Vector4 b = multiplied/multiplier;
+    CORRADE_COMPARE(a, multiplied);
+    CORRADE_COMPARE(b, vec);
 }
 
 void VectorTest::multiplyDivideComponentWiseIntegral() {
@@ -420,10 +430,18 @@ void VectorTest::bitwise() {
 
 void VectorTest::dot() {
     CORRADE_COMPARE(Math::dot(Vector4{1.0f, 0.5f, 0.75f, 1.5f}, {2.0f, 4.0f, 1.0f, 7.0f}), 15.25f);
+
+    /* Four-component float vectors go through a SIMD implementation with
+       MAGNUM_BUILD_SIMD enabled, which isn't constexpr */
+    constexpr Float a = Math::dot(Vector3{1.0f, 0.5f, 0.75f}, {2.0f, 4.0f, 1.0f});
+    CORRADE_COMPARE(a, 4.75f);
 }
 
 void VectorTest::dotSelf() {
     CORRADE_COMPARE(Vector4(1.0f, 2.0f, 3.0f, 4.0f).dot(), 30.0f);
+
+    constexpr Float a = Vector3(1.0f, 2.0f, 3.0f).dot();
+    CORRADE_COMPARE(a, 14.0f);
 }
 
 void VectorTest::length() {
@@ -440,6 +458,18 @@ void VectorTest::normalized() {
     CORRADE_COMPARE(vec.length(), 1.0f);
 }
 
+void VectorTest::normalizedFast() {
+    CORRADE_COMPARE(Vector4(1.0f, 2.0f, 3.0f, 4.0f).lengthInverted(Math::FastMath), 0.182574f);
+
+    const auto vec = Vector4(1.0f, 1.0f, 1.0f, 1.0f).normalized(Math::FastMath);
+    CORRADE_COMPARE(vec, Vector4(0.5f, 0.5f, 0.5f, 0.5f));
+    CORRADE_VERIFY(vec.isNormalized());
+
+    const Vector3 vec3 = Vector3(3.0f, 0.0f, -4.0f).normalized(Math::FastMath);
+    CORRADE_COMPARE(vec3, Vector3(0.6f, 0.0f, -0.8f));
+    CORRADE_VERIFY(vec3.isNormalized());
+}
+
 void VectorTest::resized() {
     const auto vec = Vector4(2.0f, 2.0f, 0.0f, 1.0f).resized(9.0f);
     CORRADE_COMPARE(vec, Vector4(6.0f, 6.0f, 0.0f, 3.0f));
@@ -447,21 +477,25 @@ void VectorTest::resized() {
 }
 
 void VectorTest::sum() {
-    CORRADE_COMPARE(Vector3(1.0f, 2.0f, 4.0f).sum(), 7.0f);
+    constexpr Float a = Vector3(1.0f, 2.0f, 4.0f).sum();
+    CORRADE_COMPARE(a, 7.0f);
 }
 
 void VectorTest::product() {
-    CORRADE_COMPARE(Vector3(1.0f, 2.0f, 3.0f).product(), 6.0f);
+    constexpr Float a = Vector3(1.0f, 2.0f, 3.0f).product();
+    CORRADE_COMPARE(a, 6.0f);
 }
 
 void VectorTest::min() {
     /* Check also that initial value isn't initialized to 0 */
-    CORRADE_COMPARE(Vector3(1.0f, -2.0f, 3.0f).min(), -2.0f);
+    constexpr Float a = Vector3(1.0f, -2.0f, 3.0f).min();
+    CORRADE_COMPARE(a, -2.0f);
 }
 
 void VectorTest::max() {
     /* Check also that initial value isn't initialized to 0 */
-    CORRADE_COMPARE(Vector3(-1.0f, -2.0f, -3.0f).max(), -1.0f);
+    constexpr Float a = Vector3(-1.0f, -2.0f, -3.0f).max();
+    CORRADE_COMPARE(a, -1.0f);
 }
 
 void VectorTest::projected() {
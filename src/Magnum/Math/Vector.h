@@ -30,9 +30,6 @@
  */
 
 #include <cmath>
-#ifdef _MSC_VER
-#include <algorithm> /* std::max() */
-#endif
 #include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/ConfigurationValue.h>
 #include <Corrade/Utility/Debug.h>
@@ -41,6 +38,8 @@
 #include "Magnum/Math/Angle.h"
 #include "Magnum/Math/BoolVector.h"
 #include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Math/Implementation/FastMath.h"
+#include "Magnum/Math/Implementation/Simd.h"
 
 #ifdef MAGNUM_BUILD_DEPRECATED
 #include <Corrade/Utility/Macros.h>
@@ -68,6 +67,25 @@ namespace Implementation {
             return vec == Vector<size, T>{};
         }
     };
+
+    /* Left folds for constexpr sum(), product(), min() and max(), giving the
+       same result as an equivalent loop */
+    template<class T> constexpr T foldAdd(T a) { return a; }
+    template<class T, class ...U> constexpr T foldAdd(T a, T b, U... next) {
+        return foldAdd<T>(a + b, next...);
+    }
+    template<class T> constexpr T foldMultiply(T a) { return a; }
+    template<class T, class ...U> constexpr T foldMultiply(T a, T b, U... next) {
+        return foldMultiply<T>(a*b, next...);
+    }
+    template<class T> constexpr T foldMin(T a) { return a; }
+    template<class T, class ...U> constexpr T foldMin(T a, T b, U... next) {
+        return foldMin<T>(b < a ? b : a, next...);
+    }
+    template<class T> constexpr T foldMax(T a) { return a; }
+    template<class T, class ...U> constexpr T foldMax(T a, T b, U... next) {
+        return foldMax<T>(a < b ? b : a, next...);
+    }
 }
 
 /** @relatesalso Vector
@@ -81,10 +99,15 @@ the same general direction, `1` when two *normalized* vectors are parallel,
 @f]
 @see @ref Vector::dot() const, @ref Vector::operator-(), @ref Vector2::perpendicular()
 */
-template<std::size_t size, class T> inline T dot(const Vector<size, T>& a, const Vector<size, T>& b) {
+template<std::size_t size, class T> constexpr T dot(const Vector<size, T>& a, const Vector<size, T>& b) {
     return (a*b).sum();
 }
 
+#if defined(MAGNUM_MATH_SIMD) && !defined(DOXYGEN_GENERATING_OUTPUT)
+/* Defined below, needs the complete type */
+inline float dot(const Vector<4, float>& a, const Vector<4, float>& b);
+#endif
+
 /** @relatesalso Vector
 @brief Angle between normalized vectors
 
@@ -298,7 +321,9 @@ template<std::size_t size, class T> class Vector {
          * @f]
          * @see @ref Vector2::perpendicular()
          */
-        Vector<size, T> operator-() const;
+        constexpr Vector<size, T> operator-() const {
+            return negatedInternal(typename Implementation::GenerateSequence<size>::Type{});
+        }
 
         /**
          * @brief Add and assign vector
@@ -319,8 +344,8 @@ template<std::size_t size, class T> class Vector {
          *
          * @see @ref operator+=(), @ref sum()
          */
-        Vector<size, T> operator+(const Vector<size, T>& other) const {
-            return Vector<size, T>(*this) += other;
+        constexpr Vector<size, T> operator+(const Vector<size, T>& other) const {
+            return addedInternal(typename Implementation::GenerateSequence<size>::Type{}, other);
         }
 
         /**
@@ -342,8 +367,8 @@ template<std::size_t size, class T> class Vector {
          *
          * @see @ref operator-=()
          */
-        Vector<size, T> operator-(const Vector<size, T>& other) const {
-            return Vector<size, T>(*this) -= other;
+        constexpr Vector<size, T> operator-(const Vector<size, T>& other) const {
+            return subtractedInternal(typename Implementation::GenerateSequence<size>::Type{}, other);
         }
 
         /**
@@ -369,8 +394,8 @@ template<std::size_t size, class T> class Vector {
          *      @ref operator*=(T), @ref operator*(T, const Vector<size, T>&),
          *      @ref operator*(const Vector<size, Integral>&, FloatingPoint)
          */
-        Vector<size, T> operator*(T number) const {
-            return Vector<size, T>(*this) *= number;
+        constexpr Vector<size, T> operator*(T number) const {
+            return multipliedInternal(typename Implementation::GenerateSequence<size>::Type{}, number);
         }
 
         /**
@@ -396,8 +421,8 @@ template<std::size_t size, class T> class Vector {
          *      @ref operator/=(T), @ref operator/(T, const Vector<size, T>&),
          *      @ref operator/(const Vector<size, Integral>&, FloatingPoint)
          */
-        Vector<size, T> operator/(T number) const {
-            return Vector<size, T>(*this) /= number;
+        constexpr Vector<size, T> operator/(T number) const {
+            return dividedInternal(typename Implementation::GenerateSequence<size>::Type{}, number);
         }
 
         /**
@@ -423,8 +448,8 @@ template<std::size_t size, class T> class Vector {
          *      @ref operator*(const Vector<size, Integral>&, const Vector<size, FloatingPoint>&),
          *      @ref product()
          */
-        Vector<size, T> operator*(const Vector<size, T>& other) const {
-            return Vector<size, T>(*this) *= other;
+        constexpr Vector<size, T> operator*(const Vector<size, T>& other) const {
+            return multipliedInternal(typename Implementation::GenerateSequence<size>::Type{}, other);
         }
 
         /**
@@ -449,8 +474,8 @@ template<std::size_t size, class T> class Vector {
          * @see @ref operator/(T) const, @ref operator/=(const Vector<size, T>&),
          *      @ref operator/(const Vector<size, Integral>&, const Vector<size, FloatingPoint>&)
          */
-        Vector<size, T> operator/(const Vector<size, T>& other) const {
-            return Vector<size, T>(*this) /= other;
+        constexpr Vector<size, T> operator/(const Vector<size, T>& other) const {
+            return dividedInternal(typename Implementation::GenerateSequence<size>::Type{}, other);
         }
 
         /**
@@ -463,7 +488,7 @@ template<std::size_t size, class T> class Vector {
          * @see @ref dot(const Vector<size, T>&, const Vector<size, T>&),
          *      @ref isNormalized()
          */
-        T dot() const { return Math::dot(*this, *this); }
+        constexpr T dot() const { return Math::dot(*this, *this); }
 
         /**
          * @brief Vector length
@@ -489,6 +514,17 @@ template<std::size_t size, class T> class Vector {
          */
         T lengthInverted() const { return T(1)/length(); }
 
+        /**
+         * @brief Approximate inverse vector length
+         *
+         * Uses @ref Math::Fast::sqrtInverted() instead of a division by
+         * @ref length(). Available only for floating-point types.
+         * @see @ref normalized(FastMathT) const
+         */
+        T lengthInverted(FastMathT) const {
+            return Implementation::fastSqrtInverted(dot());
+        }
+
         /**
          * @brief Normalized vector (of unit length)
          *
@@ -496,6 +532,24 @@ template<std::size_t size, class T> class Vector {
          */
         Vector<size, T> normalized() const { return *this*lengthInverted(); }
 
+        /**
+         * @brief Approximately normalized vector
+         *
+         * Faster alternative to @ref normalized() for per-vertex or
+         * per-particle loops. The length of the resulting vector differs
+         * from one by at most @f$ 5 \cdot 10^{-6} @f$ for
+         * @ref Magnum::Float "Float" and @f$ 4 \cdot 10^{-11} @f$ for
+         * @ref Magnum::Double "Double", so the result might not pass
+         * @ref isNormalized() for doubles. Usage:
+         * @code
+         * Vector3 n = (b - a).normalized(Math::FastMath);
+         * @endcode
+         * @see @ref lengthInverted(FastMathT) const
+         */
+        Vector<size, T> normalized(FastMathT) const {
+            return *this*Implementation::fastSqrtInverted(dot());
+        }
+
         /**
          * @brief Resized vector
          *
@@ -551,28 +605,28 @@ template<std::size_t size, class T> class Vector {
          *
          * @see @ref operator+()
          */
-        T sum() const;
+        constexpr T sum() const;
 
         /**
          * @brief Product of values in the vector
          *
          * @see @ref operator*(const Vector<size, T>&) const
          */
-        T product() const;
+        constexpr T product() const;
 
         /**
          * @brief Minimal value in the vector
          *
          * @see @ref Math::min(), @ref Vector2::minmax()
          */
-        T min() const;
+        constexpr T min() const;
 
         /**
          * @brief Maximal value in the vector
          *
          * @see @ref Math::max(), @ref Vector2::minmax()
          */
-        T max() const;
+        constexpr T max() const;
 
     private:
         /* Implementation for Vector<size, T>::Vector(const Vector<size, U>&) */
@@ -589,6 +643,43 @@ template<std::size_t size, class T> class Vector {
             return {(*this)[sequence]...};
         }
 
+        /* Implementation for constexpr arithmetic operators */
+        template<std::size_t ...sequence> constexpr Vector<size, T> negatedInternal(Implementation::Sequence<sequence...>) const {
+            return {T(-_data[sequence])...};
+        }
+        template<std::size_t ...sequence> constexpr Vector<size, T> addedInternal(Implementation::Sequence<sequence...>, const Vector<size, T>& other) const {
+            return {T(_data[sequence] + other._data[sequence])...};
+        }
+        template<std::size_t ...sequence> constexpr Vector<size, T> subtractedInternal(Implementation::Sequence<sequence...>, const Vector<size, T>& other) const {
+            return {T(_data[sequence] - other._data[sequence])...};
+        }
+        template<std::size_t ...sequence> constexpr Vector<size, T> multipliedInternal(Implementation::Sequence<sequence...>, T number) const {
+            return {T(_data[sequence]*number)...};
+        }
+        template<std::size_t ...sequence> constexpr Vector<size, T> dividedInternal(Implementation::Sequence<sequence...>, T number) const {
+            return {T(_data[sequence]/number)...};
+        }
+        template<std::size_t ...sequence> constexpr Vector<size, T> multipliedInternal(Implementation::Sequence<sequence...>, const Vector<size, T>& other) const {
+            return {T(_data[sequence]*other._data[sequence])...};
+        }
+        template<std::size_t ...sequence> constexpr Vector<size, T> dividedInternal(Implementation::Sequence<sequence...>, const Vector<size, T>& other) const {
+            return {T(_data[sequence]/other._data[sequence])...};
+        }
+
+        /* Implementation for constexpr sum(), product(), min(), max() */
+        template<std::size_t ...sequence> constexpr T sumInternal(Implementation::Sequence<sequence...>) const {
+            return Implementation::foldAdd(_data[sequence]...);
+        }
+        template<std::size_t ...sequence> constexpr T productInternal(Implementation::Sequence<sequence...>) const {
+            return Implementation::foldMultiply(_data[sequence]...);
+        }
+        template<std::size_t ...sequence> constexpr T minInternal(Implementation::Sequence<sequence...>) const {
+            return Implementation::foldMin(_data[sequence]...);
+        }
+        template<std::size_t ...sequence> constexpr T maxInternal(Implementation::Sequence<sequence...>) const {
+            return Implementation::foldMax(_data[sequence]...);
+        }
+
         T _data[size];
 };
 
@@ -597,7 +688,7 @@ template<std::size_t size, class T> class Vector {
 
 Same as @ref Vector::operator*(T) const.
 */
-template<std::size_t size, class T> inline Vector<size, T> operator*(
+template<std::size_t size, class T> constexpr Vector<size, T> operator*(
     #ifdef DOXYGEN_GENERATING_OUTPUT
     T
     #else
@@ -616,7 +707,15 @@ template<std::size_t size, class T> inline Vector<size, T> operator*(
 @f]
 @see @ref Vector::operator/(T) const
 */
-template<std::size_t size, class T> inline Vector<size, T> operator/(
+#ifndef DOXYGEN_GENERATING_OUTPUT
+namespace Implementation {
+    template<std::size_t size, class T, std::size_t ...sequence> constexpr Vector<size, T> divideNumber(Sequence<sequence...>, T number, const Vector<size, T>& vector) {
+        return {T(number/vector[sequence])...};
+    }
+}
+#endif
+
+template<std::size_t size, class T> constexpr Vector<size, T> operator/(
     #ifdef DOXYGEN_GENERATING_OUTPUT
     T
     #else
@@ -624,12 +723,7 @@ template<std::size_t size, class T> inline Vector<size, T> operator/(
     #endif
     number, const Vector<size, T>& vector)
 {
-    Vector<size, T> out;
-
-    for(std::size_t i = 0; i != size; ++i)
-        out[i] = number/vector[i];
-
-    return out;
+    return Implementation::divideNumber(typename Implementation::GenerateSequence<size>::Type{}, number, vector);
 }
 
 /** @relates Vector
@@ -1116,55 +1210,58 @@ extern template MAGNUM_EXPORT Corrade::Utility::Debug& operator<<(Corrade::Utili
         return Math::Vector<size, T>::pad(a, value);                        \
     }                                                                       \
                                                                             \
-    Type<T> operator-() const {                                             \
+    constexpr Type<T> operator-() const {                                   \
         return Math::Vector<size, T>::operator-();                          \
     }                                                                       \
     Type<T>& operator+=(const Math::Vector<size, T>& other) {               \
         Math::Vector<size, T>::operator+=(other);                           \
         return *this;                                                       \
     }                                                                       \
-    Type<T> operator+(const Math::Vector<size, T>& other) const {           \
+    constexpr Type<T> operator+(const Math::Vector<size, T>& other) const { \
         return Math::Vector<size, T>::operator+(other);                     \
     }                                                                       \
     Type<T>& operator-=(const Math::Vector<size, T>& other) {               \
         Math::Vector<size, T>::operator-=(other);                           \
         return *this;                                                       \
     }                                                                       \
-    Type<T> operator-(const Math::Vector<size, T>& other) const {           \
+    constexpr Type<T> operator-(const Math::Vector<size, T>& other) const { \
         return Math::Vector<size, T>::operator-(other);                     \
     }                                                                       \
     Type<T>& operator*=(T number) {                                         \
         Math::Vector<size, T>::operator*=(number);                          \
         return *this;                                                       \
     }                                                                       \
-    Type<T> operator*(T number) const {                                     \
+    constexpr Type<T> operator*(T number) const {                           \
         return Math::Vector<size, T>::operator*(number);                    \
     }                                                                       \
     Type<T>& operator/=(T number) {                                         \
         Math::Vector<size, T>::operator/=(number);                          \
         return *this;                                                       \
     }                                                                       \
-    Type<T> operator/(T number) const {                                     \
+    constexpr Type<T> operator/(T number) const {                           \
         return Math::Vector<size, T>::operator/(number);                    \
     }                                                                       \
     Type<T>& operator*=(const Math::Vector<size, T>& other) {               \
         Math::Vector<size, T>::operator*=(other);                           \
         return *this;                                                       \
     }                                                                       \
-    Type<T> operator*(const Math::Vector<size, T>& other) const {           \
+    constexpr Type<T> operator*(const Math::Vector<size, T>& other) const { \
         return Math::Vector<size, T>::operator*(other);                     \
     }                                                                       \
     Type<T>& operator/=(const Math::Vector<size, T>& other) {               \
         Math::Vector<size, T>::operator/=(other);                           \
         return *this;                                                       \
     }                                                                       \
-    Type<T> operator/(const Math::Vector<size, T>& other) const {           \
+    constexpr Type<T> operator/(const Math::Vector<size, T>& other) const { \
         return Math::Vector<size, T>::operator/(other);                     \
     }                                                                       \
                                                                             \
     Type<T> normalized() const {                                            \
         return Math::Vector<size, T>::normalized();                         \
     }                                                                       \
+    Type<T> normalized(Math::FastMathT tag) const {                         \
+        return Math::Vector<size, T>::normalized(tag);                      \
+    }                                                                       \
     Type<T> resized(T length) const {                                       \
         return Math::Vector<size, T>::resized(length);                      \
     }                                                                       \
@@ -1179,10 +1276,10 @@ extern template MAGNUM_EXPORT Corrade::Utility::Debug& operator<<(Corrade::Utili
     }
 
 #define MAGNUM_VECTORn_OPERATOR_IMPLEMENTATION(size, Type)                  \
-    template<class T> inline Type<T> operator*(typename std::common_type<T>::type number, const Type<T>& vector) { \
+    template<class T> constexpr Type<T> operator*(typename std::common_type<T>::type number, const Type<T>& vector) { \
         return number*static_cast<const Math::Vector<size, T>&>(vector);    \
     }                                                                       \
-    template<class T> inline Type<T> operator/(typename std::common_type<T>::type number, const Type<T>& vector) { \
+    template<class T> constexpr Type<T> operator/(typename std::common_type<T>::type number, const Type<T>& vector) { \
         return number/static_cast<const Math::Vector<size, T>&>(vector);    \
     }                                                                       \
                                                                             \
@@ -1312,55 +1409,32 @@ template<std::size_t size, class T> inline BoolVector<size> Vector<size, T>::ope
     return out;
 }
 
-template<std::size_t size, class T> inline Vector<size, T> Vector<size, T>::operator-() const {
-    Vector<size, T> out;
-
-    for(std::size_t i = 0; i != size; ++i)
-        out._data[i] = -_data[i];
-
-    return out;
-}
-
 template<std::size_t size, class T> inline Vector<size, T> Vector<size, T>::projectedOntoNormalized(const Vector<size, T>& line) const {
     CORRADE_ASSERT(line.isNormalized(), "Math::Vector::projectedOntoNormalized(): line must be normalized", {});
     return line*Math::dot(*this, line);
 }
 
-template<std::size_t size, class T> inline T Vector<size, T>::sum() const {
-    T out(_data[0]);
-
-    for(std::size_t i = 1; i != size; ++i)
-        out += _data[i];
-
-    return out;
+template<std::size_t size, class T> constexpr T Vector<size, T>::sum() const {
+    return sumInternal(typename Implementation::GenerateSequence<size>::Type{});
 }
 
-template<std::size_t size, class T> inline T Vector<size, T>::product() const {
-    T out(_data[0]);
-
-    for(std::size_t i = 1; i != size; ++i)
-        out *= _data[i];
-
-    return out;
+template<std::size_t size, class T> constexpr T Vector<size, T>::product() const {
+    return productInternal(typename Implementation::GenerateSequence<size>::Type{});
 }
 
-template<std::size_t size, class T> inline T Vector<size, T>::min() const {
-    T out(_data[0]);
-
-    for(std::size_t i = 1; i != size; ++i)
-        out = std::min(out, _data[i]);
-
-    return out;
+template<std::size_t size, class T> constexpr T Vector<size, T>::min() const {
+    return minInternal(typename Implementation::GenerateSequence<size>::Type{});
 }
 
-template<std::size_t size, class T> inline T Vector<size, T>::max() const {
-    T out(_data[0]);
-
-    for(std::size_t i = 1; i != size; ++i)
-        out = std::max(out, _data[i]);
+template<std::size_t size, class T> constexpr T Vector<size, T>::max() const {
+    return maxInternal(typename Implementation::GenerateSequence<size>::Type{});
+}
 
-    return out;
+#if defined(MAGNUM_MATH_SIMD) && !defined(DOXYGEN_GENERATING_OUTPUT)
+inline float dot(const Vector<4, float>& a, const Vector<4, float>& b) {
+    return Implementation::simdDotVector4(a.data(), b.data());
 }
+#endif
 
 }}
 
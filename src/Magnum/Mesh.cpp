@@ -29,6 +29,7 @@
 
 #include "Magnum/AbstractShaderProgram.h"
 #include "Magnum/Buffer.h"
+#include "Magnum/CommandObserver.h"
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
 #ifndef MAGNUM_TARGET_GLES
@@ -63,6 +64,10 @@ struct Mesh::AttributeLayout {
 Int Mesh::maxVertexAttributes() { return AbstractShaderProgram::maxVertexAttributes(); }
 #endif
 
+UnsignedLong Mesh::drawCallCount() {
+    return Context::current().state().mesh->drawCount;
+}
+
 #ifndef MAGNUM_TARGET_GLES2
 #ifndef MAGNUM_TARGET_WEBGL
 Long Mesh::maxElementIndex()
@@ -125,6 +130,16 @@ std::size_t Mesh::indexSize(IndexType type) {
     CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
 }
 
+UnsignedInt Mesh::primitiveRestartIndex(IndexType type) {
+    switch(type) {
+        case IndexType::UnsignedByte: return 0xff;
+        case IndexType::UnsignedShort: return 0xffff;
+        case IndexType::UnsignedInt: return 0xffffffffu;
+    }
+
+    CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
 Mesh::Mesh(const MeshPrimitive primitive): _primitive{primitive}, _flags{ObjectFlag::DeleteOnDestruction}, _count{0}, _baseVertex{0}, _instanceCount{1},
     #ifndef MAGNUM_TARGET_GLES
     _baseInstance{0},
@@ -132,7 +147,7 @@ Mesh::Mesh(const MeshPrimitive primitive): _primitive{primitive}, _flags{ObjectF
     #ifndef MAGNUM_TARGET_GLES2
     _indexStart(0), _indexEnd(0),
     #endif
-    _indexOffset(0), _indexType(IndexType::UnsignedInt), _indexBuffer(nullptr)
+    _indexOffset(0), _indexType(IndexType::UnsignedInt), _indexBuffer(nullptr), _sharedVertexArray{false}
 {
     (this->*Context::current().state().mesh->createImplementation)();
 }
@@ -144,7 +159,7 @@ Mesh::Mesh(NoCreateT) noexcept: _id{0}, _primitive{MeshPrimitive::Triangles}, _f
     #ifndef MAGNUM_TARGET_GLES2
     _indexStart(0), _indexEnd(0),
     #endif
-    _indexOffset(0), _indexType(IndexType::UnsignedInt), _indexBuffer(nullptr) {}
+    _indexOffset(0), _indexType(IndexType::UnsignedInt), _indexBuffer(nullptr), _sharedVertexArray{false} {}
 
 Mesh::~Mesh() {
     /* Moved out or not deleting on destruction, nothing to do */
@@ -154,6 +169,9 @@ Mesh::~Mesh() {
     GLuint& current = Context::current().state().mesh->currentVAO;
     if(current == _id) current = 0;
 
+    /* Other meshes still use the shared VAO */
+    if(_sharedVertexArray && !releaseSharedVertexArray()) return;
+
     (this->*Context::current().state().mesh->destroyImplementation)();
 }
 
@@ -164,9 +182,10 @@ Mesh::Mesh(Mesh&& other) noexcept: _id(other._id), _primitive(other._primitive),
     #ifndef MAGNUM_TARGET_GLES2
     _indexStart(other._indexStart), _indexEnd(other._indexEnd),
     #endif
-    _indexOffset(other._indexOffset), _indexType(other._indexType), _indexBuffer(other._indexBuffer), _attributes(std::move(other._attributes))
+    _indexOffset(other._indexOffset), _indexType(other._indexType), _indexBuffer(other._indexBuffer), _sharedVertexArray{other._sharedVertexArray}, _attributes(std::move(other._attributes))
 {
     other._id = 0;
+    other._sharedVertexArray = false;
 }
 
 Mesh& Mesh::operator=(Mesh&& other) noexcept {
@@ -187,12 +206,21 @@ Mesh& Mesh::operator=(Mesh&& other) noexcept {
     swap(_indexOffset, other._indexOffset);
     swap(_indexType, other._indexType);
     swap(_indexBuffer, other._indexBuffer);
+    swap(_sharedVertexArray, other._sharedVertexArray);
     swap(_attributes, other._attributes);
 
     return *this;
 }
 
-Mesh::Mesh(const GLuint id, const MeshPrimitive primitive, const ObjectFlags flags): _id{id}, _primitive{primitive}, _flags{flags} {}
+Mesh::Mesh(const GLuint id, const MeshPrimitive primitive, const ObjectFlags flags): _id{id}, _primitive{primitive}, _flags{flags}, _sharedVertexArray{false} {}
+
+GLuint Mesh::release() {
+    CORRADE_ASSERT(!_sharedVertexArray,
+        "Mesh::release(): can't release a shared vertex array", {});
+    const GLuint id = _id;
+    _id = 0;
+    return id;
+}
 
 inline void Mesh::createIfNotAlready() {
     /* If VAO extension is not available, the following is always true */
@@ -228,6 +256,8 @@ Mesh& Mesh::setLabelInternal(const Containers::ArrayView<const char> label) {
 #endif
 
 Mesh& Mesh::setIndexBuffer(Buffer& buffer, GLintptr offset, IndexType type, UnsignedInt start, UnsignedInt end) {
+    CORRADE_ASSERT(!_sharedVertexArray || _indexBuffer == &buffer,
+        "Mesh::setIndexBuffer(): can't change index buffer of a shared vertex array", *this);
     #if defined(CORRADE_TARGET_NACL) || defined(MAGNUM_TARGET_WEBGL)
     CORRADE_ASSERT(buffer.targetHint() == Buffer::TargetHint::ElementArray,
         "Mesh::setIndexBuffer(): the buffer has unexpected target hint, expected" << Buffer::TargetHint::ElementArray << "but got" << buffer.targetHint(), *this);
@@ -243,10 +273,100 @@ Mesh& Mesh::setIndexBuffer(Buffer& buffer, GLintptr offset, IndexType type, Unsi
     static_cast<void>(start);
     static_cast<void>(end);
     #endif
-    (this->*Context::current().state().mesh->bindIndexBufferImplementation)(buffer);
+    if(!_sharedVertexArray)
+        (this->*Context::current().state().mesh->bindIndexBufferImplementation)(buffer);
     return *this;
 }
 
+Mesh& Mesh::shareVertexArray() {
+    Implementation::MeshState& state = *Context::current().state().mesh;
+
+    /* Nothing to share without VAOs, already shared */
+    if(state.createImplementation == &Mesh::createImplementationDefault || _sharedVertexArray)
+        return *this;
+
+    CORRADE_ASSERT(_flags & ObjectFlag::DeleteOnDestruction,
+        "Mesh::shareVertexArray(): can't share a vertex array not owned by the mesh", *this);
+
+    std::vector<GLintptr> key;
+    layoutInto(key);
+    key.push_back(_indexBuffer ? _indexBuffer->id() : 0);
+
+    /* First mesh with this layout, its VAO becomes the shared one */
+    auto found = state.sharedVertexArrays.find(key);
+    if(found == state.sharedVertexArrays.end()) {
+        state.sharedVertexArrays.emplace(std::move(key), _id);
+        state.sharedVertexArrayReferences.emplace(_id, 1);
+
+    /* Otherwise replace own VAO with the shared one */
+    } else {
+        if(state.currentVAO == _id) state.currentVAO = 0;
+        (this->*state.destroyImplementation)();
+
+        _id = found->second;
+        _flags |= ObjectFlag::Created;
+        ++state.sharedVertexArrayReferences[_id];
+    }
+
+    _sharedVertexArray = true;
+    return *this;
+}
+
+bool Mesh::releaseSharedVertexArray() {
+    Implementation::MeshState& state = *Context::current().state().mesh;
+
+    auto found = state.sharedVertexArrayReferences.find(_id);
+    CORRADE_INTERNAL_ASSERT(found != state.sharedVertexArrayReferences.end());
+    if(--found->second) return false;
+
+    /* Last user, remove the VAO from the lookup (if it wasn't pruned already
+       because of buffer deletion) */
+    state.sharedVertexArrayReferences.erase(found);
+    for(auto it = state.sharedVertexArrays.begin(); it != state.sharedVertexArrays.end(); ++it) {
+        if(it->second != _id) continue;
+        state.sharedVertexArrays.erase(it);
+        break;
+    }
+
+    return true;
+}
+
+void Mesh::layoutInto(std::vector<GLintptr>& out) const {
+    out.clear();
+    out.reserve(_attributes.size()*Implementation::MeshState::LayoutAttributeSize);
+    for(const AttributeLayout& attribute: _attributes) {
+        out.push_back(attribute.buffer.id());
+        out.push_back(attribute.location);
+        out.push_back(attribute.size);
+        out.push_back(attribute.type);
+        out.push_back(GLintptr(attribute.kind));
+        out.push_back(attribute.offset);
+        out.push_back(attribute.stride);
+        out.push_back(attribute.divisor);
+    }
+}
+
+bool Mesh::layoutMatches(const std::vector<GLintptr>& layout) const {
+    if(layout.size() != _attributes.size()*Implementation::MeshState::LayoutAttributeSize)
+        return false;
+
+    const GLintptr* data = layout.data();
+    for(const AttributeLayout& attribute: _attributes) {
+        if(GLuint(data[0]) != attribute.buffer.id() ||
+           GLuint(data[1]) != attribute.location ||
+           GLint(data[2]) != attribute.size ||
+           GLenum(data[3]) != attribute.type ||
+           AttributeKind(data[4]) != attribute.kind ||
+           data[5] != attribute.offset ||
+           GLsizei(data[6]) != attribute.stride ||
+           GLuint(data[7]) != attribute.divisor)
+            return false;
+        data += Implementation::MeshState::LayoutAttributeSize;
+    }
+
+    return true;
+}
+
 void Mesh::draw(AbstractShaderProgram& shader) {
     /* Nothing to draw, exit without touching any state */
     if(!_count || !_instanceCount) return;
@@ -270,7 +390,10 @@ void Mesh::drawInternal(Int count, Int baseVertex, Int instanceCount, GLintptr i
 void Mesh::drawInternal(Int count, Int baseVertex, Int instanceCount, GLintptr indexOffset)
 #endif
 {
-    const Implementation::MeshState& state = *Context::current().state().mesh;
+    Implementation::MeshState& state = *Context::current().state().mesh;
+    ++state.drawCount;
+    if(CommandObserver* const observer = Context::current().state().commandObserver)
+        observer->record(CommandObserver::Command::Draw, _id, UnsignedLong(count)*instanceCount, false);
 
     (this->*state.bindImplementation)();
 
@@ -368,7 +491,10 @@ void Mesh::drawInternal(Int count, Int baseVertex, Int instanceCount, GLintptr i
 
 #ifndef MAGNUM_TARGET_GLES
 void Mesh::drawInternal(TransformFeedback& xfb, const UnsignedInt stream, const Int instanceCount) {
-    const Implementation::MeshState& state = *Context::current().state().mesh;
+    Implementation::MeshState& state = *Context::current().state().mesh;
+    ++state.drawCount;
+    if(CommandObserver* const observer = Context::current().state().commandObserver)
+        observer->record(CommandObserver::Command::Draw, _id, instanceCount, false);
 
     (this->*state.bindImplementation)();
 
@@ -400,6 +526,43 @@ void Mesh::draw(AbstractShaderProgram& shader, TransformFeedback& xfb, UnsignedI
 
     drawInternal(xfb, stream, _instanceCount);
 }
+
+void Mesh::drawIndirect(AbstractShaderProgram& shader, Buffer& buffer, const GLintptr offset, const UnsignedInt drawCount, const UnsignedInt stride) {
+    /* Nothing to draw, exit without touching any state */
+    if(!drawCount) return;
+
+    shader.use();
+
+    Implementation::MeshState& state = *Context::current().state().mesh;
+    ++state.drawCount;
+    if(CommandObserver* const observer = Context::current().state().commandObserver)
+        observer->record(CommandObserver::Command::Draw, _id, drawCount, false);
+
+    (this->*state.bindImplementation)();
+    buffer.bindInternal(Buffer::TargetHint::DrawIndirect);
+    (this->*state.multiDrawIndirectImplementation)(offset, drawCount, stride);
+    (this->*state.unbindImplementation)();
+}
+
+void Mesh::multiDrawIndirectImplementationDefault(const GLintptr offset, const GLsizei drawCount, const GLsizei stride) {
+    if(!_indexBuffer)
+        glMultiDrawArraysIndirect(GLenum(_primitive), reinterpret_cast<GLvoid*>(offset), drawCount, stride);
+    else
+        glMultiDrawElementsIndirect(GLenum(_primitive), GLenum(_indexType), reinterpret_cast<GLvoid*>(offset), drawCount, stride);
+}
+
+void Mesh::multiDrawIndirectImplementationFallback(const GLintptr offset, const GLsizei drawCount, GLsizei stride) {
+    if(!stride) stride = GLsizei(_indexBuffer ? sizeof(DrawElementsIndirectCommand) : sizeof(DrawArraysIndirectCommand));
+
+    /* The indirect draw itself was already counted */
+    Context::current().state().mesh->drawCount += drawCount - 1;
+
+    for(GLsizei i = 0; i != drawCount; ++i) {
+        const GLvoid* const indirect = reinterpret_cast<GLvoid*>(offset + i*stride);
+        if(!_indexBuffer) glDrawArraysIndirect(GLenum(_primitive), indirect);
+        else glDrawElementsIndirect(GLenum(_primitive), GLenum(_indexType), indirect);
+    }
+}
 #endif
 
 void Mesh::bindVAO() {
@@ -458,6 +621,8 @@ void Mesh::attributePointerInternal(const Buffer& buffer, const GLuint location,
 }
 
 void Mesh::attributePointerInternal(AttributeLayout& attribute) {
+    CORRADE_ASSERT(!_sharedVertexArray,
+        "Mesh::addVertexBuffer(): can't modify a shared vertex array", );
     (this->*Context::current().state().mesh->attributePointerImplementation)(attribute);
 }
 
@@ -478,6 +643,9 @@ void Mesh::attributePointerImplementationVAO(AttributeLayout& attribute) {
 
     bindVAO();
     vertexAttribPointer(attribute);
+
+    /* Remembered only for comparison in shareVertexArray() */
+    _attributes.push_back(attribute);
 }
 
 #ifndef MAGNUM_TARGET_GLES
@@ -500,6 +668,9 @@ void Mesh::attributePointerImplementationDSAEXT(AttributeLayout& attribute) {
 
     if(attribute.divisor)
         (this->*Context::current().state().mesh->vertexAttribDivisorImplementation)(attribute.location, attribute.divisor);
+
+    /* Remembered only for comparison in shareVertexArray() */
+    _attributes.push_back(attribute);
 }
 #endif
 
@@ -582,9 +753,30 @@ void Mesh::bindIndexBufferImplementationVAO(Buffer& buffer) {
 }
 
 void Mesh::bindImplementationDefault() {
-    /* Specify vertex attributes */
-    for(AttributeLayout& attribute: _attributes)
-        vertexAttribPointer(attribute);
+    Implementation::MeshState& state = *Context::current().state().mesh;
+
+    /* Specify vertex attributes, if they differ from the previous draw */
+    if(!state.currentLayoutValid || !layoutMatches(state.currentLayout)) {
+        /* Disable attributes of the previous layout, reset their divisors so
+           they don't leak to this layout */
+        for(std::size_t i = 0; i < state.currentLayout.size(); i += Implementation::MeshState::LayoutAttributeSize) {
+            const GLuint location = state.currentLayout[i + 1];
+            glDisableVertexAttribArray(location);
+            if(state.currentLayout[i + 7]) {
+                #ifndef MAGNUM_TARGET_GLES2
+                glVertexAttribDivisor(location, 0);
+                #else
+                (this->*state.vertexAttribDivisorImplementation)(location, 0);
+                #endif
+            }
+        }
+
+        for(AttributeLayout& attribute: _attributes)
+            vertexAttribPointer(attribute);
+
+        layoutInto(state.currentLayout);
+        state.currentLayoutValid = true;
+    }
 
     /* Bind index buffer, if the mesh is indexed */
     if(_indexBuffer) _indexBuffer->bindInternal(Buffer::TargetHint::ElementArray);
@@ -595,8 +787,8 @@ void Mesh::bindImplementationVAO() {
 }
 
 void Mesh::unbindImplementationDefault() {
-    for(const AttributeLayout& attribute: _attributes)
-        glDisableVertexAttribArray(attribute.location);
+    /* The attributes are kept enabled so the next draw with the same layout
+       doesn't need to specify them again */
 }
 
 void Mesh::unbindImplementationVAO() {}
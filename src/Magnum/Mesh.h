@@ -338,6 +338,17 @@ available, DSA functions are used for specifying attribute locations to avoid
 unnecessary calls to @fn_gl{BindBuffer} and @fn_gl{BindVertexArray}. See
 documentation of @ref addVertexBuffer() for more information.
 
+If VAOs are not available, the attribute layout specified in the previous
+@ref draw() is remembered and the attribute pointers are specified again only
+if the next drawn mesh has a different layout. Drawing many meshes sharing
+the same buffers and layout in a row thus results just in the draw calls.
+
+Meshes with identical vertex buffers, attribute layout and index buffer that
+differ only in vertex/index ranges can share a single VAO using
+@ref shareVertexArray(), which saves @fn_gl{BindVertexArray} calls when
+drawing them one after another. If the meshes differ only in ranges, consider
+also drawing them through @ref MeshView instances of a single mesh.
+
 If index range is specified in @ref setIndexBuffer(), range-based version of
 drawing commands are used on desktop OpenGL and OpenGL ES 3.0. See also
 @ref draw() for more information.
@@ -419,6 +430,17 @@ class MAGNUM_EXPORT Mesh: public AbstractObject {
         static Int maxElementsVertices();
         #endif
 
+        /**
+         * @brief Count of draw calls submitted to OpenGL
+         *
+         * Count of OpenGL draw calls issued by @ref draw(),
+         * @ref drawIndirect() and @ref MeshView::draw() since the context
+         * creation. A multi-draw counts as a single call, unless it is
+         * emulated with a sequence of draws.
+         * @see @ref DebugTools::FrameStatistics
+         */
+        static UnsignedLong drawCallCount();
+
         /**
          * @brief Size of given index type
          *
@@ -426,6 +448,18 @@ class MAGNUM_EXPORT Mesh: public AbstractObject {
          */
         static std::size_t indexSize(IndexType type);
 
+        /**
+         * @brief Primitive restart index for given index type
+         *
+         * The maximal value representable with the type, i.e. `0xff`,
+         * `0xffff` or `0xffffffff`. This index restarts the primitive if
+         * @ref Renderer::Feature::PrimitiveRestartFixedIndex is enabled. Pass
+         * it to @ref Renderer::setPrimitiveRestartIndex() when using
+         * @ref Renderer::Feature::PrimitiveRestart.
+         * @see @ref indexSize(IndexType), @ref MeshTools::stripify()
+         */
+        static UnsignedInt primitiveRestartIndex(IndexType type);
+
         /**
          * @brief Wrap existing OpenGL vertex array object
          * @param id            OpenGL vertex array ID
@@ -516,7 +550,8 @@ class MAGNUM_EXPORT Mesh: public AbstractObject {
          *
          * Releases ownership of OpenGL vertex array object and returns its ID
          * so it is not deleted on destruction. The internal state is then
-         * equivalent to moved-from state.
+         * equivalent to moved-from state. Expects that the vertex array is
+         * not shared using @ref shareVertexArray().
          * @see @ref wrap()
          * @requires_gl30 Extension @extension{ARB,vertex_array_object}
          * @requires_gles30 Extension @es_extension{OES,vertex_array_object} in
@@ -836,6 +871,36 @@ class MAGNUM_EXPORT Mesh: public AbstractObject {
             return setIndexBuffer(buffer, offset, type, 0, 0);
         }
 
+        /**
+         * @brief Share the vertex array with meshes of the same layout
+         * @return Reference to self (for method chaining)
+         *
+         * If another mesh with the same vertex buffers, attribute layout and
+         * index buffer was already shared, the vertex array of this mesh is
+         * deleted and the shared one is used instead, otherwise the vertex
+         * array of this mesh becomes the shared one. The shared vertex array
+         * is deleted together with the last mesh using it. Index type, index
+         * offset and vertex/index ranges are not part of the vertex array
+         * state and can differ between the meshes.
+         *
+         * Call this function after all vertex buffers and the index buffer
+         * were added, the vertex array can't be modified afterwards. Expects
+         * that the vertex array is owned by the mesh, i.e. not created with
+         * @ref wrap() without @ref ObjectFlag::DeleteOnDestruction. If VAOs
+         * are not available, the function does nothing, as redundant
+         * attribute setup is skipped already in @ref draw().
+         * @see @ref isVertexArrayShared(),
+         *      @ref Mesh-performance-optimization "Performance optimizations"
+         */
+        Mesh& shareVertexArray();
+
+        /**
+         * @brief Whether the vertex array is shared
+         *
+         * @see @ref shareVertexArray()
+         */
+        bool isVertexArrayShared() const { return _sharedVertexArray; }
+
         /**
          * @brief Draw the mesh
          * @param shader    Shader to use for drawing
@@ -852,7 +917,8 @@ class MAGNUM_EXPORT Mesh: public AbstractObject {
          * @see @ref setCount(), @ref setInstanceCount(),
          *      @ref draw(AbstractShaderProgram&, TransformFeedback&, UnsignedInt),
          *      @ref MeshView::draw(AbstractShaderProgram&),
-         *      @ref MeshView::draw(AbstractShaderProgram&, std::initializer_list<std::reference_wrapper<MeshView>>),
+         *      @ref MeshView::draw(AbstractShaderProgram&, Containers::ArrayView<const std::reference_wrapper<MeshView>>),
+         *      @ref drawIndirect(),
          *      @fn_gl{UseProgram}, @fn_gl{EnableVertexAttribArray},
          *      @fn_gl{BindBuffer}, @fn_gl{VertexAttribPointer},
          *      @fn_gl{DisableVertexAttribArray} or @fn_gl{BindVertexArray},
@@ -916,6 +982,72 @@ class MAGNUM_EXPORT Mesh: public AbstractObject {
         void draw(AbstractShaderProgram&& shader, TransformFeedback& xfb, UnsignedInt stream = 0) {
             draw(shader, xfb, stream);
         }
+
+        /**
+         * @brief Indirect draw command for non-indexed meshes
+         *
+         * Layout of a draw command stored in a buffer passed to
+         * @ref drawIndirect().
+         */
+        struct DrawArraysIndirectCommand {
+            UnsignedInt count;          /**< @brief Vertex count */
+            UnsignedInt instanceCount;  /**< @brief Instance count */
+            UnsignedInt first;          /**< @brief First vertex */
+            UnsignedInt baseInstance;   /**< @brief Base instance */
+        };
+
+        /**
+         * @brief Indirect draw command for indexed meshes
+         *
+         * Layout of a draw command stored in a buffer passed to
+         * @ref drawIndirect().
+         */
+        struct DrawElementsIndirectCommand {
+            UnsignedInt count;          /**< @brief Index count */
+            UnsignedInt instanceCount;  /**< @brief Instance count */
+            UnsignedInt firstIndex;     /**< @brief First index */
+            Int baseVertex;             /**< @brief Base vertex */
+            UnsignedInt baseInstance;   /**< @brief Base instance */
+        };
+
+        /**
+         * @brief Draw the mesh using draw commands from a buffer
+         * @param shader        Shader to use for drawing
+         * @param buffer        Buffer containing the draw commands
+         * @param offset        Offset of the first command in the buffer
+         * @param drawCount     Count of draw commands
+         * @param stride        Stride between the commands, `0` means they
+         *      are tightly packed
+         *
+         * Expects that the @p shader is compatible with this mesh and is fully
+         * set up. The commands are expected to have the layout of
+         * @ref DrawElementsIndirectCommand if the mesh is indexed and
+         * @ref DrawArraysIndirectCommand otherwise. Everything set by
+         * @ref setCount(), @ref setBaseVertex(), @ref setInstanceCount() and
+         * @ref setBaseInstance() is ignored, the offset passed to
+         * @ref setIndexBuffer() is ignored as well and
+         * @ref DrawElementsIndirectCommand::firstIndex is counted from the
+         * beginning of the index buffer. If @p drawCount is `0`, no draw
+         * commands are issued.
+         *
+         * The commands can be produced on the GPU, for example by a compute
+         * shader doing visibility culling. If @extension{ARB,multi_draw_indirect}
+         * (part of OpenGL 4.3) is available, all commands are submitted in a
+         * single call, otherwise one call is issued for each of them.
+         * @see @ref MeshView::drawIndirect(), @fn_gl{UseProgram},
+         *      @fn_gl{BindBuffer}, @fn_gl{BindVertexArray},
+         *      @fn_gl{MultiDrawArraysIndirect}/@fn_gl{MultiDrawElementsIndirect}
+         *      or @fn_gl{DrawArraysIndirect}/@fn_gl{DrawElementsIndirect}
+         * @requires_gl40 Extension @extension{ARB,draw_indirect}
+         * @requires_gl Multi-draw indirect is not available in OpenGL ES or
+         *      WebGL.
+         */
+        void drawIndirect(AbstractShaderProgram& shader, Buffer& buffer, GLintptr offset, UnsignedInt drawCount, UnsignedInt stride = 0);
+
+        /** @overload */
+        void drawIndirect(AbstractShaderProgram&& shader, Buffer& buffer, GLintptr offset, UnsignedInt drawCount, UnsignedInt stride = 0) {
+            drawIndirect(shader, buffer, offset, drawCount, stride);
+        }
         #endif
 
     private:
@@ -1013,6 +1145,9 @@ class MAGNUM_EXPORT Mesh: public AbstractObject {
 
         #ifndef MAGNUM_TARGET_GLES
         void drawInternal(TransformFeedback& xfb, UnsignedInt stream, Int instanceCount);
+
+        void MAGNUM_LOCAL multiDrawIndirectImplementationDefault(GLintptr offset, GLsizei drawCount, GLsizei stride);
+        void MAGNUM_LOCAL multiDrawIndirectImplementationFallback(GLintptr offset, GLsizei drawCount, GLsizei stride);
         #endif
 
         void MAGNUM_LOCAL createImplementationDefault();
@@ -1024,6 +1159,10 @@ class MAGNUM_EXPORT Mesh: public AbstractObject {
         void MAGNUM_LOCAL destroyImplementationDefault();
         void MAGNUM_LOCAL destroyImplementationVAO();
 
+        void MAGNUM_LOCAL layoutInto(std::vector<GLintptr>& out) const;
+        bool MAGNUM_LOCAL layoutMatches(const std::vector<GLintptr>& layout) const;
+        bool MAGNUM_LOCAL releaseSharedVertexArray();
+
         void attributePointerInternal(const Buffer& buffer, GLuint location, GLint size, GLenum type, AttributeKind kind, GLintptr offset, GLsizei stride, GLuint divisor);
         void MAGNUM_LOCAL attributePointerInternal(AttributeLayout& attribute);
         void MAGNUM_LOCAL attributePointerImplementationDefault(AttributeLayout& attribute);
@@ -1080,6 +1219,7 @@ class MAGNUM_EXPORT Mesh: public AbstractObject {
         GLintptr _indexOffset;
         IndexType _indexType;
         Buffer* _indexBuffer;
+        bool _sharedVertexArray;
 
         std::vector<AttributeLayout> _attributes;
 };
@@ -1090,12 +1230,6 @@ MAGNUM_EXPORT Debug& operator<<(Debug& debug, MeshPrimitive value);
 /** @debugoperatorclassenum{Magnum::Mesh,Magnum::Mesh::IndexType} */
 MAGNUM_EXPORT Debug& operator<<(Debug& debug, Mesh::IndexType value);
 
-inline GLuint Mesh::release() {
-    const GLuint id = _id;
-    _id = 0;
-    return id;
-}
-
 }
 
 namespace Corrade { namespace Utility {
@@ -0,0 +1,161 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MeshArena.h"
+
+#include <vector>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+
+namespace Magnum {
+
+RangeAllocator::RangeAllocator(const UnsignedInt capacity): _capacity{capacity}, _used{} {
+    if(capacity) _free.emplace(0, capacity);
+}
+
+UnsignedInt RangeAllocator::largestFreeRange() const {
+    UnsignedInt largest = 0;
+    for(const auto& range: _free) largest = std::max(largest, range.second);
+    return largest;
+}
+
+std::optional<UnsignedInt> RangeAllocator::allocate(const UnsignedInt count) {
+    CORRADE_ASSERT(count, "RangeAllocator::allocate(): expected non-zero count", std::nullopt);
+
+    /* Best fit, keeps the large ranges for large allocations */
+    auto found = _free.end();
+    for(auto it = _free.begin(); it != _free.end(); ++it) {
+        if(it->second < count || (found != _free.end() && found->second <= it->second)) continue;
+        found = it;
+        if(it->second == count) break;
+    }
+
+    if(found == _free.end()) return std::nullopt;
+
+    /* Take the beginning of the range, keep the rest free */
+    const UnsignedInt offset = found->first;
+    const UnsignedInt left = found->second - count;
+    _free.erase(found);
+    if(left) _free.emplace(offset + count, left);
+
+    _allocations.emplace(offset, count);
+    _used += count;
+    return offset;
+}
+
+void RangeAllocator::free(const UnsignedInt offset) {
+    const auto found = _allocations.find(offset);
+    CORRADE_ASSERT(found != _allocations.end(),
+        "RangeAllocator::free(): no allocation at offset" << offset, );
+
+    UnsignedInt begin = offset;
+    UnsignedInt size = found->second;
+    _used -= size;
+    _allocations.erase(found);
+
+    /* Merge with the following free range */
+    const auto next = _free.find(begin + size);
+    if(next != _free.end()) {
+        size += next->second;
+        _free.erase(next);
+    }
+
+    /* Merge with the preceding free range */
+    auto prev = _free.lower_bound(begin);
+    if(prev != _free.begin() && (--prev)->first + prev->second == begin) {
+        begin = prev->first;
+        size += prev->second;
+        _free.erase(prev);
+    }
+
+    _free.emplace(begin, size);
+}
+
+MeshArena::MeshArena(const MeshPrimitive primitive, const UnsignedInt vertexStride, const UnsignedInt vertexCapacity, const UnsignedInt indexCapacity, const BufferUsage usage): _vertexStride{vertexStride},
+    #ifndef MAGNUM_TARGET_GLES
+    _baseVertex{Context::current().isExtensionSupported<Extensions::GL::ARB::draw_elements_base_vertex>()},
+    #else
+    _baseVertex{false},
+    #endif
+    _vertexAllocator{vertexCapacity}, _indexAllocator{indexCapacity}, _vertexBuffer{Buffer::TargetHint::Array}, _indexBuffer{Buffer::TargetHint::ElementArray}, _mesh{primitive}
+{
+    CORRADE_ASSERT(vertexStride && vertexCapacity && indexCapacity,
+        "MeshArena: expected non-zero vertex stride and buffer capacities", );
+
+    _vertexBuffer.setData({nullptr, std::size_t(vertexStride)*vertexCapacity}, usage);
+    _indexBuffer.setData({nullptr, std::size_t(indexCapacity)*sizeof(UnsignedInt)}, usage);
+    _mesh.setIndexBuffer(_indexBuffer, 0, Mesh::IndexType::UnsignedInt);
+}
+
+std::optional<MeshArena::Range> MeshArena::add(const Containers::ArrayView<const void> vertices, const Containers::ArrayView<const UnsignedInt> indices) {
+    CORRADE_ASSERT(!vertices.empty() && vertices.size() % _vertexStride == 0,
+        "MeshArena::add(): expected vertex data size to be a non-zero multiple of" << _vertexStride << "but got" << vertices.size(), std::nullopt);
+    CORRADE_ASSERT(!indices.empty(),
+        "MeshArena::add(): expected non-empty index data", std::nullopt);
+
+    const UnsignedInt vertexCount = vertices.size()/_vertexStride;
+    const std::optional<UnsignedInt> vertexOffset = _vertexAllocator.allocate(vertexCount);
+    if(!vertexOffset) return std::nullopt;
+    const std::optional<UnsignedInt> indexOffset = _indexAllocator.allocate(indices.size());
+    if(!indexOffset) {
+        _vertexAllocator.free(*vertexOffset);
+        return std::nullopt;
+    }
+
+    _vertexBuffer.setSubData(GLintptr(*vertexOffset)*_vertexStride, vertices);
+    if(_baseVertex || !*vertexOffset)
+        _indexBuffer.setSubData(GLintptr(*indexOffset)*sizeof(UnsignedInt), indices);
+    else {
+        std::vector<UnsignedInt> rebased{indices.begin(), indices.end()};
+        for(UnsignedInt& index: rebased) index += *vertexOffset;
+        _indexBuffer.setSubData(GLintptr(*indexOffset)*sizeof(UnsignedInt), rebased);
+    }
+
+    return Range{*vertexOffset, vertexCount, *indexOffset, UnsignedInt(indices.size())};
+}
+
+void MeshArena::remove(const Range& range) {
+    _vertexAllocator.free(range.vertexOffset);
+    _indexAllocator.free(range.indexOffset);
+}
+
+MeshView& MeshArena::setupView(MeshView& view, const Range& range) const {
+    view.setCount(range.indexCount);
+    if(_baseVertex) view.setBaseVertex(range.vertexOffset)
+        .setIndexRange(range.indexOffset, 0, range.vertexCount - 1);
+    else view.setIndexRange(range.indexOffset, range.vertexOffset, range.vertexOffset + range.vertexCount - 1);
+    return view;
+}
+
+void MeshArena::draw(AbstractShaderProgram& shader, const Range& range) {
+    MeshView view{_mesh};
+    setupView(view, range).draw(shader);
+}
+
+}
@@ -0,0 +1,287 @@
+#ifndef Magnum_MeshArena_h
+#define Magnum_MeshArena_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::RangeAllocator, @ref Magnum::MeshArena
+ */
+
+#include <map>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Buffer.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/MeshView.h"
+#include "MagnumExternal/Optional/optional.hpp"
+
+namespace Magnum {
+
+/**
+@brief Free-list range allocator
+
+Sub-allocates contiguous element ranges from a fixed capacity. Only the
+bookkeeping is done here, no GL memory is touched, see @ref MeshArena for
+the buffer-backed use. Each allocation takes the smallest free range that
+fits, and freed ranges are merged with their free neighbors immediately, so
+the free list never contains two adjacent ranges and a completely freed
+allocator has exactly one free range again.
+*/
+class MAGNUM_EXPORT RangeAllocator {
+    public:
+        /**
+         * @brief Constructor
+         * @param capacity  Count of elements to allocate from
+         */
+        explicit RangeAllocator(UnsignedInt capacity);
+
+        /** @brief Count of elements to allocate from */
+        UnsignedInt capacity() const { return _capacity; }
+
+        /** @brief Count of elements in all allocations */
+        UnsignedInt usedCount() const { return _used; }
+
+        /** @brief Count of live allocations */
+        std::size_t allocationCount() const { return _allocations.size(); }
+
+        /**
+         * @brief Count of free ranges
+         *
+         * `1` for an empty allocator and `0` for a completely full one.
+         * Anything above that means the free space is fragmented.
+         */
+        std::size_t freeRangeCount() const { return _free.size(); }
+
+        /**
+         * @brief Size of the largest free range
+         *
+         * The largest allocation that will currently succeed.
+         */
+        UnsignedInt largestFreeRange() const;
+
+        /**
+         * @brief Allocate a range
+         * @param count     Count of elements
+         * @return Offset of the first element or @ref std::nullopt if there
+         *      is no free range large enough
+         *
+         * Expects that @p count is not zero.
+         */
+        std::optional<UnsignedInt> allocate(UnsignedInt count);
+
+        /**
+         * @brief Free a range
+         * @param offset    Offset returned from @ref allocate()
+         *
+         * Merges the range with the neighboring free ranges. Expects that
+         * @p offset is an offset of a live allocation.
+         */
+        void free(UnsignedInt offset);
+
+    private:
+        UnsignedInt _capacity, _used;
+        std::map<UnsignedInt, UnsignedInt> _free, _allocations;
+};
+
+/**
+@brief Shared vertex and index buffer for many meshes
+
+Each @ref Mesh usually owns its own vertex and index buffer and its own vertex
+array object, so drawing thousands of small meshes means rebinding buffers
+before each draw. Meshes with the same vertex layout can instead be placed
+into one vertex and one index @ref Buffer, with ranges from both allocated by
+a @ref RangeAllocator, and drawn with a @ref MeshView of one shared @ref Mesh.
+It's also the buffer layout required for multi-draw.
+
+## Usage
+
+The arena is created with a vertex stride and capacities of both buffers and
+the vertex layout is then specified on @ref mesh() at offset `0` of
+@ref vertexBuffer(). Meshes are added with @ref add() and drawn using
+@ref draw():
+@code
+MeshArena arena{MeshPrimitive::Triangles, sizeof(Vertex), 1024*1024, 4*1024*1024};
+arena.mesh().addVertexBuffer(arena.vertexBuffer(), 0,
+    Shaders::Phong::Position{}, Shaders::Phong::Normal{});
+
+std::optional<MeshArena::Range> range = arena.add(vertices, indices);
+if(!range) {
+    // not enough space, create another arena
+}
+
+arena.draw(shader, *range);
+@endcode
+
+Alternatively, @ref setupView() configures a @ref MeshView of @ref mesh() and
+all views can be then submitted at once using
+@ref MeshView::draw(AbstractShaderProgram&, std::initializer_list<std::reference_wrapper<MeshView>>),
+which uses a single multi-draw call if possible:
+@code
+MeshView a{arena.mesh()}, b{arena.mesh()};
+arena.setupView(a, rangeA);
+arena.setupView(b, rangeB);
+MeshView::draw(shader, {a, b});
+@endcode
+
+Removing a mesh with @ref remove() returns both of its ranges to the
+allocators. The buffer data stay where they are, so ranges of other meshes
+stay valid and the freed space is reused by subsequent @ref add() calls.
+
+## Base vertex
+
+Indices of each mesh are relative to its first vertex. If
+@extension{ARB,draw_elements_base_vertex} (part of OpenGL 3.2) is available,
+they are uploaded as-is and the view offsets them using
+@ref MeshView::setBaseVertex(). Otherwise, and always on OpenGL ES and WebGL,
+the vertex offset is added to the indices during upload. In that case the
+vertex capacity on OpenGL ES 2.0 and WebGL 1.0 has to fit into 16-bit indices
+unless @es_extension{OES,element_index_uint} (or the WebGL equivalent) is
+available.
+@see @ref BufferRing
+*/
+class MAGNUM_EXPORT MeshArena {
+    public:
+        /**
+         * @brief Allocated ranges of one mesh
+         *
+         * @see @ref add(), @ref view(), @ref remove()
+         */
+        struct Range {
+            UnsignedInt vertexOffset;   /**< @brief First vertex */
+            UnsignedInt vertexCount;    /**< @brief Vertex count */
+            UnsignedInt indexOffset;    /**< @brief First index */
+            UnsignedInt indexCount;     /**< @brief Index count */
+        };
+
+        /**
+         * @brief Constructor
+         * @param primitive         Primitive type of all meshes
+         * @param vertexStride      Size of one vertex in bytes
+         * @param vertexCapacity    Vertex count the vertex buffer can hold
+         * @param indexCapacity     Index count the index buffer can hold
+         * @param usage             Buffer usage
+         *
+         * Allocates storage of both buffers and sets up @ref mesh() with
+         * @ref Mesh::IndexType::UnsignedInt index buffer. The vertex layout
+         * has to be specified by the application.
+         * @see @ref Buffer::setData(), @ref Mesh::setIndexBuffer()
+         */
+        explicit MeshArena(MeshPrimitive primitive, UnsignedInt vertexStride, UnsignedInt vertexCapacity, UnsignedInt indexCapacity, BufferUsage usage = BufferUsage::StaticDraw);
+
+        /** @brief Copying is not allowed */
+        MeshArena(const MeshArena&) = delete;
+
+        /** @brief Moving is not allowed */
+        MeshArena(MeshArena&&) = delete;
+
+        /** @brief Copying is not allowed */
+        MeshArena& operator=(const MeshArena&) = delete;
+
+        /** @brief Moving is not allowed */
+        MeshArena& operator=(MeshArena&&) = delete;
+
+        /** @brief Shared vertex buffer */
+        Buffer& vertexBuffer() { return _vertexBuffer; }
+
+        /** @brief Shared index buffer */
+        Buffer& indexBuffer() { return _indexBuffer; }
+
+        /** @brief Shared mesh */
+        Mesh& mesh() { return _mesh; }
+
+        /** @brief Size of one vertex in bytes */
+        UnsignedInt vertexStride() const { return _vertexStride; }
+
+        /** @brief Vertex range allocator */
+        const RangeAllocator& vertexAllocator() const { return _vertexAllocator; }
+
+        /** @brief Index range allocator */
+        const RangeAllocator& indexAllocator() const { return _indexAllocator; }
+
+        /**
+         * @brief Whether the views use base vertex
+         *
+         * If `false`, the vertex offset is added to the indices on upload.
+         * See class documentation for more information.
+         */
+        bool usesBaseVertex() const { return _baseVertex; }
+
+        /**
+         * @brief Add a mesh
+         * @param vertices  Interleaved vertex data
+         * @param indices   Indices relative to the first vertex
+         * @return Allocated ranges or @ref std::nullopt if there isn't
+         *      enough space in either of the buffers
+         *
+         * Expects that the vertex data size is a non-zero multiple of
+         * @ref vertexStride() and that @p indices are not empty.
+         * @see @ref Buffer::setSubData()
+         */
+        std::optional<Range> add(Containers::ArrayView<const void> vertices, Containers::ArrayView<const UnsignedInt> indices);
+
+        /**
+         * @brief Remove a mesh
+         *
+         * Returns both ranges to the allocators, the buffer contents are not
+         * touched. Expects that @p range was returned from @ref add() and
+         * wasn't removed yet.
+         */
+        void remove(const Range& range);
+
+        /**
+         * @brief Set up a view for drawing a mesh
+         * @return Reference to @p view
+         *
+         * Sets index count, index range and, if supported, base vertex for
+         * given mesh ranges. Expects that @p view is a view of @ref mesh().
+         * @see @ref MeshView::setCount(), @ref MeshView::setIndexRange(),
+         *      @ref MeshView::setBaseVertex()
+         */
+        MeshView& setupView(MeshView& view, const Range& range) const;
+
+        /**
+         * @brief Draw a mesh
+         *
+         * Convenience alternative to creating a @ref MeshView, setting it up
+         * with @ref setupView() and drawing it.
+         */
+        void draw(AbstractShaderProgram& shader, const Range& range);
+
+        /** @overload */
+        void draw(AbstractShaderProgram&& shader, const Range& range) {
+            draw(shader, range);
+        }
+
+    private:
+        UnsignedInt _vertexStride;
+        bool _baseVertex;
+        RangeAllocator _vertexAllocator, _indexAllocator;
+        Buffer _vertexBuffer, _indexBuffer;
+        Mesh _mesh;
+};
+
+}
+
+#endif
@@ -0,0 +1,167 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "BoundingVolume.h"
+
+#include "Magnum/Math/Range.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace Magnum { namespace MeshTools {
+
+Range3D boundingBox(const Containers::ArrayView<const Vector3> positions) {
+    if(positions.empty()) return {};
+
+    const Float* data = positions.data()->data();
+    std::size_t count = positions.size();
+    Vector3 min = positions[0], max = positions[0];
+
+    /* Four points are three registers, x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3.
+       Each lane always holds the same component, so the registers can be
+       accumulated without any shuffling and the lanes are combined at the
+       end. */
+    #if defined(__SSE2__) || defined(__ARM_NEON)
+    if(count >= 4) {
+        Float lanesMin[12], lanesMax[12];
+
+        #ifdef __SSE2__
+        __m128 min0 = _mm_loadu_ps(data), min1 = _mm_loadu_ps(data + 4), min2 = _mm_loadu_ps(data + 8);
+        __m128 max0 = min0, max1 = min1, max2 = min2;
+        for(data += 12, count -= 4; count >= 4; count -= 4, data += 12) {
+            const __m128 in0 = _mm_loadu_ps(data), in1 = _mm_loadu_ps(data + 4), in2 = _mm_loadu_ps(data + 8);
+            min0 = _mm_min_ps(min0, in0); max0 = _mm_max_ps(max0, in0);
+            min1 = _mm_min_ps(min1, in1); max1 = _mm_max_ps(max1, in1);
+            min2 = _mm_min_ps(min2, in2); max2 = _mm_max_ps(max2, in2);
+        }
+        _mm_storeu_ps(lanesMin, min0); _mm_storeu_ps(lanesMin + 4, min1); _mm_storeu_ps(lanesMin + 8, min2);
+        _mm_storeu_ps(lanesMax, max0); _mm_storeu_ps(lanesMax + 4, max1); _mm_storeu_ps(lanesMax + 8, max2);
+        #else
+        float32x4_t min0 = vld1q_f32(data), min1 = vld1q_f32(data + 4), min2 = vld1q_f32(data + 8);
+        float32x4_t max0 = min0, max1 = min1, max2 = min2;
+        for(data += 12, count -= 4; count >= 4; count -= 4, data += 12) {
+            const float32x4_t in0 = vld1q_f32(data), in1 = vld1q_f32(data + 4), in2 = vld1q_f32(data + 8);
+            min0 = vminq_f32(min0, in0); max0 = vmaxq_f32(max0, in0);
+            min1 = vminq_f32(min1, in1); max1 = vmaxq_f32(max1, in1);
+            min2 = vminq_f32(min2, in2); max2 = vmaxq_f32(max2, in2);
+        }
+        vst1q_f32(lanesMin, min0); vst1q_f32(lanesMin + 4, min1); vst1q_f32(lanesMin + 8, min2);
+        vst1q_f32(lanesMax, max0); vst1q_f32(lanesMax + 4, max1); vst1q_f32(lanesMax + 8, max2);
+        #endif
+
+        for(std::size_t i = 0; i != 12; ++i) {
+            min[i % 3] = Math::min(min[i % 3], lanesMin[i]);
+            max[i % 3] = Math::max(max[i % 3], lanesMax[i]);
+        }
+    }
+    #endif
+
+    const Vector3* const remaining = reinterpret_cast<const Vector3*>(data);
+    for(std::size_t i = 0; i != count; ++i) {
+        min = Math::min(min, remaining[i]);
+        max = Math::max(max, remaining[i]);
+    }
+
+    return {min, max};
+}
+
+std::pair<Vector3, Float> boundingSphere(const Containers::ArrayView<const Vector3> positions) {
+    if(positions.empty()) return {};
+
+    /* Extremal points along the axes and cube diagonals, the directions
+       don't need to be normalized for that */
+    constexpr std::size_t DirectionCount = 7;
+    const Vector3 directions[DirectionCount]{
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {0.0f, 0.0f, 1.0f},
+        {1.0f, 1.0f, 1.0f},
+        {1.0f, 1.0f, -1.0f},
+        {1.0f, -1.0f, 1.0f},
+        {1.0f, -1.0f, -1.0f}};
+    std::size_t minPoint[DirectionCount]{}, maxPoint[DirectionCount]{};
+    Float minProjection[DirectionCount], maxProjection[DirectionCount];
+    for(std::size_t j = 0; j != DirectionCount; ++j)
+        minProjection[j] = maxProjection[j] = Math::dot(positions[0], directions[j]);
+    for(std::size_t i = 1; i != positions.size(); ++i) {
+        for(std::size_t j = 0; j != DirectionCount; ++j) {
+            const Float projection = Math::dot(positions[i], directions[j]);
+            if(projection < minProjection[j]) {
+                minProjection[j] = projection;
+                minPoint[j] = i;
+            } else if(projection > maxProjection[j]) {
+                maxProjection[j] = projection;
+                maxPoint[j] = i;
+            }
+        }
+    }
+
+    /* The most distant pair of the extremal points is the initial diameter */
+    std::size_t a = 0, b = 0;
+    Float diameterSquared = -1.0f;
+    for(std::size_t j = 0; j != DirectionCount; ++j) {
+        const Float distanceSquared = (positions[maxPoint[j]] - positions[minPoint[j]]).dot();
+        if(distanceSquared > diameterSquared) {
+            diameterSquared = distanceSquared;
+            a = minPoint[j];
+            b = maxPoint[j];
+        }
+    }
+
+    Vector3 center = (positions[a] + positions[b])*0.5f;
+    Float radius = Math::sqrt(diameterSquared)*0.5f;
+    Float radiusSquared = radius*radius;
+
+    /* Grow the sphere to include the remaining points, moving the center
+       towards each outside point so the opposite side stays put */
+    for(const Vector3& position: positions) {
+        const Vector3 direction = position - center;
+        const Float distanceSquared = direction.dot();
+        if(distanceSquared <= radiusSquared) continue;
+
+        const Float distance = Math::sqrt(distanceSquared);
+        const Float newRadius = (radius + distance)*0.5f;
+        center += direction*((newRadius - radius)/distance);
+        radius = newRadius;
+        radiusSquared = radius*radius;
+    }
+
+    return {center, radius};
+}
+
+void computeBoundingVolumes(Trade::MeshData3D& mesh) {
+    const std::vector<Vector3>& positionData = mesh.positions(0);
+    const Containers::ArrayView<const Vector3> positions{positionData.data(), positionData.size()};
+    const std::pair<Vector3, Float> sphere = boundingSphere(positions);
+    mesh.setBoundingBox(boundingBox(positions))
+        .setBoundingSphere(sphere.first, sphere.second);
+}
+
+}}
@@ -0,0 +1,87 @@
+#ifndef Magnum_MeshTools_BoundingVolume_h
+#define Magnum_MeshTools_BoundingVolume_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::boundingBox(), @ref Magnum::MeshTools::boundingSphere(), @ref Magnum::MeshTools::computeBoundingVolumes()
+ */
+
+#include <utility>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Axis-aligned bounding box of a point set
+
+Returns a zero range for an empty point set. The points are processed four at
+a time using SSE2 or NEON instructions, if available.
+@see @ref boundingSphere(), @ref computeBoundingVolumes()
+*/
+MAGNUM_MESHTOOLS_EXPORT Range3D boundingBox(Containers::ArrayView<const Vector3> positions);
+
+/**
+@brief Bounding sphere of a point set
+@return Center and radius
+
+Finds the pair of points that is farthest apart among the extremal points
+along seven directions (the coordinate axes and the four cube diagonals) and
+uses it as the initial sphere diameter. Then the sphere is grown in one pass
+over all points to include the points that are outside. Algorithm used:
+*Thomas Larsson - Fast and Tight Fitting Bounding Spheres, SIGRAD 2008* (the
+EPOS-14 variant) for the initial sphere, *Jack Ritter - An Efficient Bounding
+Sphere, Graphics Gems, 1990* for the growing pass. The result is usually within
+a few percent of the minimal bounding sphere.
+
+Returns sphere with zero center and radius for an empty point set.
+@see @ref boundingBox(), @ref computeBoundingVolumes(),
+    @ref SceneGraph::Drawable::setBoundingSphere()
+*/
+MAGNUM_MESHTOOLS_EXPORT std::pair<Vector3, Float> boundingSphere(Containers::ArrayView<const Vector3> positions);
+
+/**
+@brief Compute and store bounding volumes of mesh data
+
+Calculates @ref boundingBox() and @ref boundingSphere() of the first position
+array of @p mesh and stores them using @ref Trade::MeshData3D::setBoundingBox()
+and @ref Trade::MeshData3D::setBoundingSphere(), so they don't need to be
+recalculated for culling or LOD selection:
+@code
+Trade::MeshData3D mesh = *importer.mesh3D(0);
+MeshTools::computeBoundingVolumes(mesh);
+
+drawable.setBoundingSphere(mesh.boundingSphere().first, mesh.boundingSphere().second);
+@endcode
+*/
+MAGNUM_MESHTOOLS_EXPORT void computeBoundingVolumes(Trade::MeshData3D& mesh);
+
+}}
+
+#endif
@@ -26,9 +26,7 @@
 #include "CombineIndexedArrays.h"
 
 #include <cstring>
-#include <unordered_map>
 #include <Corrade/Utility/Assert.h>
-#include <Corrade/Utility/MurmurHash2.h>
 
 #include "Magnum/Magnum.h"
 
@@ -87,31 +85,19 @@ std::vector<UnsignedInt> combineIndexArrays(const std::reference_wrapper<std::ve
 
 namespace {
 
-class IndexHash {
-    public:
-        explicit IndexHash(const std::vector<UnsignedInt>& indices, UnsignedInt stride): indices(indices), stride(stride) {}
-
-        std::size_t operator()(UnsignedInt key) const {
-            return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2()(reinterpret_cast<const char*>(indices.data()+key*stride), sizeof(UnsignedInt)*stride).byteArray());
-        }
-
-    private:
-        const std::vector<UnsignedInt>& indices;
-        UnsignedInt stride;
-};
-
-class IndexEqual {
-    public:
-        explicit IndexEqual(const std::vector<UnsignedInt>& indices, UnsignedInt stride): indices(indices), stride(stride) {}
-
-        bool operator()(UnsignedInt a, UnsignedInt b) const {
-            return std::memcmp(indices.data()+a*stride, indices.data()+b*stride, sizeof(UnsignedInt)*stride) == 0;
-        }
-
-    private:
-        const std::vector<UnsignedInt>& indices;
-        UnsignedInt stride;
-};
+/* Combines all indices of one combination and mixes the bits using the
+   MurmurHash3 finalizer */
+inline UnsignedInt hashCombination(const UnsignedInt* const combination, const UnsignedInt stride) {
+    UnsignedInt hash = 0;
+    for(UnsignedInt i = 0; i != stride; ++i)
+        hash = (hash ^ combination[i])*0x9e3779b1u;
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bu;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35u;
+    hash ^= hash >> 16;
+    return hash;
+}
 
 }
 
@@ -119,38 +105,56 @@ std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> combineIndexArrays
     CORRADE_ASSERT(stride != 0, "MeshTools::combineIndexArrays(): stride can't be zero", {});
     CORRADE_ASSERT(interleavedArrays.size() % stride == 0, "MeshTools::combineIndexArrays(): array size is not divisible by stride", {});
 
-    /* Hash map with index combinations, containing just indices into
-       interleavedArrays vector, hashing and comparison is done using IndexHash
-       and IndexEqual functors. Reserving more buckets than necessary (i.e. as
-       if each combination was unique). */
-    std::unordered_map<UnsignedInt, UnsignedInt, IndexHash, IndexEqual> indexCombinations(
-        interleavedArrays.size()/stride,
-        IndexHash(interleavedArrays, stride),
-        IndexEqual(interleavedArrays, stride));
-
-    /* Make the index combinations unique. Original indices into original
-       `interleavedArrays` array were 0, 1, 2, 3, ..., `combinedIndices`
-       contains new ones into new (shorter) `newInterleavedArrays` array. */
-    std::vector<UnsignedInt> combinedIndices;
-    combinedIndices.reserve(interleavedArrays.size()/stride);
-    std::vector<UnsignedInt> newInterleavedArrays;
-    for(std::size_t oldIndex = 0, end = interleavedArrays.size()/stride; oldIndex != end; ++oldIndex) {
-        /* Try to insert new index combination to the map */
-        const auto result = indexCombinations.emplace(oldIndex, indexCombinations.size());
-
-        /* Add the (either new or already existing) index to resulting index array */
-        combinedIndices.push_back(result.first->second);
-
-        /* If this is new combination, copy it to new interleaved arrays */
-        if(result.second) newInterleavedArrays.insert(newInterleavedArrays.end(),
-            interleavedArrays.begin()+oldIndex*stride,
-            interleavedArrays.begin()+(oldIndex+1)*stride);
-    }
-
-    CORRADE_INTERNAL_ASSERT(combinedIndices.size() == interleavedArrays.size()/stride &&
-                            newInterleavedArrays.size() <= interleavedArrays.size());
+    std::vector<UnsignedInt> combinedIndices(interleavedArrays.size()/stride);
+    std::vector<UnsignedInt> newInterleavedArrays(interleavedArrays.size());
+    const UnsignedInt uniqueCount = combineIndexArraysInto(
+        {interleavedArrays.data(), interleavedArrays.size()}, stride,
+        {combinedIndices.data(), combinedIndices.size()},
+        {newInterleavedArrays.data(), newInterleavedArrays.size()});
+    newInterleavedArrays.resize(uniqueCount*stride);
 
     return {std::move(combinedIndices), std::move(newInterleavedArrays)};
 }
 
+UnsignedInt combineIndexArraysInto(const Containers::ArrayView<const UnsignedInt> interleavedArrays, const UnsignedInt stride, const Containers::ArrayView<UnsignedInt> combinedIndices, const Containers::ArrayView<UnsignedInt> uniqueInterleavedArrays) {
+    CORRADE_ASSERT(stride != 0, "MeshTools::combineIndexArraysInto(): stride can't be zero", {});
+    CORRADE_ASSERT(interleavedArrays.size() % stride == 0, "MeshTools::combineIndexArraysInto(): array size is not divisible by stride", {});
+    const std::size_t count = interleavedArrays.size()/stride;
+    CORRADE_ASSERT(combinedIndices.size() == count && uniqueInterleavedArrays.size() == interleavedArrays.size(),
+        "MeshTools::combineIndexArraysInto(): expected output sizes" << count << "and" << interleavedArrays.size() << "but got" << combinedIndices.size() << "and" << uniqueInterleavedArrays.size(), {});
+
+    /* Power-of-two table with load factor at most 0.5, containing output
+       indices of the unique combinations. The combination data are then
+       compared directly in the output array. */
+    std::size_t capacity = 1;
+    while(capacity < count*2) capacity <<= 1;
+    const std::size_t mask = capacity - 1;
+    constexpr UnsignedInt Empty = ~UnsignedInt{};
+    std::vector<UnsignedInt> table(capacity, Empty);
+
+    UnsignedInt uniqueCount = 0;
+    for(std::size_t i = 0; i != count; ++i) {
+        const UnsignedInt* const combination = interleavedArrays.data() + i*stride;
+
+        /* Linear probing until the combination or an empty slot is found */
+        std::size_t slot = hashCombination(combination, stride) & mask;
+        for(;; slot = (slot + 1) & mask) {
+            const UnsignedInt candidate = table[slot];
+            if(candidate == Empty) {
+                table[slot] = uniqueCount;
+                std::memcpy(uniqueInterleavedArrays.data() + uniqueCount*stride, combination, stride*sizeof(UnsignedInt));
+                combinedIndices[i] = uniqueCount++;
+                break;
+            }
+
+            if(std::memcmp(uniqueInterleavedArrays.data() + candidate*stride, combination, stride*sizeof(UnsignedInt)) == 0) {
+                combinedIndices[i] = candidate;
+                break;
+            }
+        }
+    }
+
+    return uniqueCount;
+}
+
 }}
@@ -26,15 +26,16 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::combineIndexArrays(), @ref Magnum::MeshTools::combineIndexedArrays()
+ * @brief Function @ref Magnum::MeshTools::combineIndexArrays(), @ref Magnum::MeshTools::combineIndexArraysInto(), @ref Magnum::MeshTools::combineIndexedArrays()
  */
 
 #include <functional>
 #include <tuple>
 #include <vector>
+#include <Corrade/Containers/ArrayView.h>
 #include <Corrade/Utility/Assert.h>
 
-#include "Magnum/Types.h"
+#include "Magnum/Magnum.h"
 #include "Magnum/MeshTools/visibility.h"
 
 namespace Magnum { namespace MeshTools {
@@ -110,10 +111,32 @@ And second pair value is the cleaned up interleaved array:
 
     0 1 2 3 5 4 0 4 1 6 3 1 2 1
 
+This function calls @ref combineIndexArraysInto() internally.
 @see @ref combineIndexedArrays()
 */
 MAGNUM_MESHTOOLS_EXPORT std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> combineIndexArrays(const std::vector<UnsignedInt>& interleavedArrays, UnsignedInt stride);
 
+/**
+@brief Combine index arrays into existing storage
+@param[in] interleavedArrays    Interleaved index arrays
+@param[in] stride               Count of interleaved arrays
+@param[out] combinedIndices     Where to put the combined index array. Expected
+    to have size of @p interleavedArrays divided by @p stride.
+@param[out] uniqueInterleavedArrays Where to put the cleaned up interleaved
+    array. Expected to have the same size as @p interleavedArrays.
+@return Count of unique index combinations
+
+Same as @ref combineIndexArrays(const std::vector<UnsignedInt>&, UnsignedInt),
+but writes the output into caller-provided storage, so it can be reused
+across meshes without reallocations. Only first @p stride times the returned
+value items of @p uniqueInterleavedArrays are written.
+
+The unique combinations are found using a flat open-addressing hash table
+sized from the input and storing just the output index of each combination,
+which is much faster than hashing the combinations through a node-based map.
+*/
+MAGNUM_MESHTOOLS_EXPORT UnsignedInt combineIndexArraysInto(Containers::ArrayView<const UnsignedInt> interleavedArrays, UnsignedInt stride, Containers::ArrayView<UnsignedInt> combinedIndices, Containers::ArrayView<UnsignedInt> uniqueInterleavedArrays);
+
 namespace Implementation {
 
 MAGNUM_MESHTOOLS_EXPORT std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> interleaveAndCombineIndexArrays(const std::reference_wrapper<const std::vector<UnsignedInt>>* begin, const std::reference_wrapper<const std::vector<UnsignedInt>>* end);
@@ -26,9 +26,12 @@
 #include "Compile.h"
 
 #include "Magnum/Buffer.h"
-#include "Magnum/Math/Vector3.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
 #include "Magnum/MeshTools/CompressIndices.h"
 #include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/Trade/MeshData.h"
 #include "Magnum/Trade/MeshData2D.h"
 #include "Magnum/Trade/MeshData3D.h"
 
@@ -93,6 +96,12 @@ std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const
     return std::make_tuple(std::move(mesh), std::move(vertexBuffer), std::move(indexBuffer));
 }
 
+std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const Trade::MeshData2D& meshData, const BufferUsage usage, Buffer& instanceBuffer) {
+    std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> out = compile(meshData, usage);
+    std::get<0>(out).addVertexBufferInstanced(instanceBuffer, 1, 0, Shaders::Generic2D::TransformationMatrix{});
+    return out;
+}
+
 std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const Trade::MeshData3D& meshData, const BufferUsage usage) {
     Mesh mesh;
     mesh.setPrimitive(meshData.primitive());
@@ -107,6 +116,12 @@ std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const
     }
     if(meshData.hasTextureCoords2D())
         stride += sizeof(Shaders::Generic3D::TextureCoordinates::Type);
+    #ifndef MAGNUM_TARGET_GLES2
+    const UnsignedInt jointIdsOffset = stride;
+    const UnsignedInt weightsOffset = jointIdsOffset + sizeof(Shaders::Generic3D::JointIds::Type);
+    if(meshData.isSkinned())
+        stride += sizeof(Shaders::Generic3D::JointIds::Type) + sizeof(Shaders::Generic3D::Weights::Type);
+    #endif
 
     /* Create vertex buffer */
     std::unique_ptr<Buffer> vertexBuffer{new Buffer{Buffer::TargetHint::Array}};
@@ -143,6 +158,25 @@ std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const
             stride - textureCoordsOffset - sizeof(Shaders::Generic3D::TextureCoordinates::Type));
     }
 
+    /* Add also joint IDs and weights, if the mesh is skinned */
+    #ifndef MAGNUM_TARGET_GLES2
+    if(meshData.isSkinned()) {
+        MeshTools::interleaveInto(data,
+            jointIdsOffset,
+            meshData.jointIds(),
+            stride - jointIdsOffset - sizeof(Shaders::Generic3D::JointIds::Type));
+        MeshTools::interleaveInto(data,
+            weightsOffset,
+            meshData.weights(),
+            stride - weightsOffset - sizeof(Shaders::Generic3D::Weights::Type));
+        mesh.addVertexBuffer(*vertexBuffer, 0,
+            jointIdsOffset,
+            Shaders::Generic3D::JointIds(),
+            Shaders::Generic3D::Weights(),
+            stride - weightsOffset - sizeof(Shaders::Generic3D::Weights::Type));
+    }
+    #endif
+
     /* Fill vertex buffer with interleaved data */
     vertexBuffer->setData(data, usage);
 
@@ -165,4 +199,112 @@ std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const
     return std::make_tuple(std::move(mesh), std::move(vertexBuffer), std::move(indexBuffer));
 }
 
+std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const Trade::MeshData3D& meshData, const BufferUsage usage, Buffer& instanceBuffer) {
+    std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> out = compile(meshData, usage);
+    std::get<0>(out).addVertexBufferInstanced(instanceBuffer, 1, 0, Shaders::Generic3D::TransformationMatrix{});
+    return out;
+}
+
+namespace {
+
+GLenum attributeType(const Trade::MeshAttributeType type) {
+    switch(type) {
+        case Trade::MeshAttributeType::UnsignedByte: return GL_UNSIGNED_BYTE;
+        case Trade::MeshAttributeType::Byte: return GL_BYTE;
+        case Trade::MeshAttributeType::UnsignedShort: return GL_UNSIGNED_SHORT;
+        case Trade::MeshAttributeType::Short: return GL_SHORT;
+        case Trade::MeshAttributeType::UnsignedInt: return GL_UNSIGNED_INT;
+        case Trade::MeshAttributeType::Int: return GL_INT;
+        #ifndef MAGNUM_TARGET_GLES2
+        case Trade::MeshAttributeType::HalfFloat: return GL_HALF_FLOAT;
+        #else
+        case Trade::MeshAttributeType::HalfFloat: return GL_HALF_FLOAT_OES;
+        #endif
+        case Trade::MeshAttributeType::Float: return GL_FLOAT;
+    }
+
+    CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+Mesh::IndexType indexType(const Trade::MeshIndexType type) {
+    switch(type) {
+        case Trade::MeshIndexType::UnsignedByte: return Mesh::IndexType::UnsignedByte;
+        case Trade::MeshIndexType::UnsignedShort: return Mesh::IndexType::UnsignedShort;
+        case Trade::MeshIndexType::UnsignedInt: return Mesh::IndexType::UnsignedInt;
+    }
+
+    CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+template<class Attribute> void addAttribute(Mesh& mesh, Buffer& buffer, const Trade::MeshData& meshData, const Trade::MeshAttribute name) {
+    if(!meshData.hasAttribute(name)) return;
+
+    const Trade::MeshAttributeData& attribute = meshData.attribute(name);
+    CORRADE_ASSERT(attribute.stride() == 0 || attribute.stride() >= attribute.size(),
+        "MeshTools::compile(): stride of" << name << "attribute is smaller than its size", );
+
+    /* The stride is calculated from attribute size and the gap after it */
+    mesh.addVertexBuffer(buffer, attribute.offset(),
+        Attribute{typename Attribute::Components(attribute.components()),
+            typename Attribute::DataType(attributeType(attribute.type())),
+            attribute.isNormalized() ? typename Attribute::DataOptions{Attribute::DataOption::Normalized} : typename Attribute::DataOptions{}},
+        attribute.stride() ? attribute.stride() - attribute.size() : 0);
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+/* Integral attributes have no normalization option */
+template<class Attribute> void addIntegerAttribute(Mesh& mesh, Buffer& buffer, const Trade::MeshData& meshData, const Trade::MeshAttribute name) {
+    if(!meshData.hasAttribute(name)) return;
+
+    const Trade::MeshAttributeData& attribute = meshData.attribute(name);
+    CORRADE_ASSERT(attribute.stride() == 0 || attribute.stride() >= attribute.size(),
+        "MeshTools::compile(): stride of" << name << "attribute is smaller than its size", );
+    CORRADE_ASSERT(!attribute.isNormalized() && attribute.type() != Trade::MeshAttributeType::HalfFloat && attribute.type() != Trade::MeshAttributeType::Float,
+        "MeshTools::compile():" << name << "attribute has to be of a non-normalized integral type", );
+
+    mesh.addVertexBuffer(buffer, attribute.offset(),
+        Attribute{typename Attribute::Components(attribute.components()),
+            typename Attribute::DataType(attributeType(attribute.type()))},
+        attribute.stride() ? attribute.stride() - attribute.size() : 0);
+}
+#endif
+
+}
+
+std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const Trade::MeshData& meshData, const BufferUsage usage) {
+    Mesh mesh;
+    mesh.setPrimitive(meshData.primitive());
+
+    /* Upload the interleaved vertex data directly */
+    std::unique_ptr<Buffer> vertexBuffer{new Buffer{Buffer::TargetHint::Array}};
+    vertexBuffer->setData(meshData.vertexData(), usage);
+
+    /* Bind the attributes according to the layout. Colors with alpha use the
+       same location as the three-component ones. */
+    addAttribute<Shaders::Generic3D::Position>(mesh, *vertexBuffer, meshData, Trade::MeshAttribute::Position);
+    addAttribute<Shaders::Generic3D::Normal>(mesh, *vertexBuffer, meshData, Trade::MeshAttribute::Normal);
+    addAttribute<Shaders::Generic3D::TextureCoordinates>(mesh, *vertexBuffer, meshData, Trade::MeshAttribute::TextureCoordinates);
+    if(meshData.hasAttribute(Trade::MeshAttribute::Color) && meshData.attribute(Trade::MeshAttribute::Color).components() == 4)
+        addAttribute<Attribute<Shaders::Generic3D::Color::Location, Color4>>(mesh, *vertexBuffer, meshData, Trade::MeshAttribute::Color);
+    else addAttribute<Shaders::Generic3D::Color>(mesh, *vertexBuffer, meshData, Trade::MeshAttribute::Color);
+    #ifndef MAGNUM_TARGET_GLES2
+    addIntegerAttribute<Shaders::Generic3D::JointIds>(mesh, *vertexBuffer, meshData, Trade::MeshAttribute::JointIds);
+    #endif
+    addAttribute<Shaders::Generic3D::Weights>(mesh, *vertexBuffer, meshData, Trade::MeshAttribute::Weights);
+
+    /* If indexed, upload the index data as-is as well */
+    std::unique_ptr<Buffer> indexBuffer;
+    if(meshData.isIndexed()) {
+        const std::pair<UnsignedInt, UnsignedInt> indexRange = meshData.indexRange();
+        indexBuffer.reset(new Buffer{Buffer::TargetHint::ElementArray});
+        indexBuffer->setData(meshData.indexData(), usage);
+        mesh.setCount(meshData.indexCount())
+            .setIndexBuffer(*indexBuffer, 0, indexType(meshData.indexType()), indexRange.first, indexRange.second);
+
+    /* Else set vertex count */
+    } else mesh.setCount(meshData.vertexCount());
+
+    return std::make_tuple(std::move(mesh), std::move(vertexBuffer), std::move(indexBuffer));
+}
+
 }}
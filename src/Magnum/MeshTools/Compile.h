@@ -59,6 +59,24 @@ greater flexibility.
 */
 MAGNUM_MESHTOOLS_EXPORT std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const Trade::MeshData2D& meshData, BufferUsage usage);
 
+/**
+@brief Compile 2D mesh data for instanced rendering
+
+Same as @ref compile(const Trade::MeshData2D&, BufferUsage), but additionally
+binds @p instanceBuffer as per-instance
+@ref Shaders::Generic2D::TransformationMatrix attribute. The buffer is expected
+to contain tightly packed @ref Matrix3 for each instance, filled for example
+from @ref SceneGraph::InstanceCollector::transformations(). Instance count is
+left at `1`, set it using @ref Mesh::setInstanceCount() before drawing.
+@requires_gl33 Extension @extension{ARB,instanced_arrays}
+@requires_gles30 Extension @es_extension{ANGLE,instanced_arrays},
+    @es_extension{EXT,instanced_arrays} or
+    @es_extension{NV,instanced_arrays} in OpenGL ES 2.0.
+@requires_webgl20 Extension @webgl_extension{ANGLE,instanced_arrays} in WebGL
+    1.0.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const Trade::MeshData2D& meshData, BufferUsage usage, Buffer& instanceBuffer);
+
 /**
 @brief Compile 3D mesh data
 
@@ -66,8 +84,10 @@ Configures mesh for @ref Shaders::Generic3D shader with vertex buffer and
 possibly also index buffer, if the mesh is indexed. Positions are bound to
 @ref Shaders::Generic3D::Position attribute. If the mesh contains normals, they
 are bound to @ref Shaders::Generic3D::Normal attribute, texture coordinates are
-bound to @ref Shaders::Generic2D::TextureCoordinates attribute. No data
-compression or index optimization (except for index buffer packing) is done.
+bound to @ref Shaders::Generic2D::TextureCoordinates attribute. Joint IDs and
+weights of skinned meshes are bound to @ref Shaders::Generic3D::JointIds and
+@ref Shaders::Generic3D::Weights, except on OpenGL ES 2.0 and WebGL 1.0, which
+don't support integer attributes. No data compression or index optimization (except for index buffer packing) is done.
 The @p usage parameter is used for both vertex and index buffer.
 
 The second returned buffer may be `nullptr` if the mesh is not indexed.
@@ -80,6 +100,47 @@ greater flexibility.
 */
 MAGNUM_MESHTOOLS_EXPORT std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const Trade::MeshData3D& meshData, BufferUsage usage);
 
+/**
+@brief Compile 3D mesh data for instanced rendering
+
+Same as @ref compile(const Trade::MeshData3D&, BufferUsage), but additionally
+binds @p instanceBuffer as per-instance
+@ref Shaders::Generic3D::TransformationMatrix attribute. The buffer is expected
+to contain tightly packed @ref Matrix4 for each instance, filled for example
+from @ref SceneGraph::InstanceCollector::transformations(). Instance count is
+left at `1`, set it using @ref Mesh::setInstanceCount() before drawing.
+@requires_gl33 Extension @extension{ARB,instanced_arrays}
+@requires_gles30 Extension @es_extension{ANGLE,instanced_arrays},
+    @es_extension{EXT,instanced_arrays} or
+    @es_extension{NV,instanced_arrays} in OpenGL ES 2.0.
+@requires_webgl20 Extension @webgl_extension{ANGLE,instanced_arrays} in WebGL
+    1.0.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const Trade::MeshData3D& meshData, BufferUsage usage, Buffer& instanceBuffer);
+
+/**
+@brief Compile interleaved mesh data
+
+Uploads the vertex and index data of @p meshData to GPU buffers as-is, without
+any interleaving or index processing, and configures the mesh based on
+attribute layout. @ref Trade::MeshAttribute::Position is bound to
+@ref Shaders::Generic3D::Position, @ref Trade::MeshAttribute::Normal to
+@ref Shaders::Generic3D::Normal, @ref Trade::MeshAttribute::TextureCoordinates
+to @ref Shaders::Generic3D::TextureCoordinates and
+@ref Trade::MeshAttribute::Color to @ref Shaders::Generic3D::Color,
+@ref Trade::MeshAttribute::JointIds to @ref Shaders::Generic3D::JointIds and
+@ref Trade::MeshAttribute::Weights to @ref Shaders::Generic3D::Weights. Only the
+first attribute of each name is bound, two-component positions are usable
+also with @ref Shaders::Generic2D. The @p usage parameter is used for both
+vertex and index buffer.
+
+The second returned buffer may be `nullptr` if the mesh is not indexed.
+
+@see @ref Trade::AbstractImporter::mesh(), @ref shaders-generic,
+    @ref compile(MeshPrimitive, Containers::ArrayView<const typename Format::Type>, BufferUsage)
+*/
+MAGNUM_MESHTOOLS_EXPORT std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const Trade::MeshData& meshData, BufferUsage usage);
+
 }}
 
 #endif
@@ -87,6 +87,47 @@ template<class T> Containers::Array<T> compressIndicesAs(const std::vector<Unsig
     return buffer;
 }
 
+std::pair<Containers::Array<UnsignedShort>, std::vector<IndexChunk>> compressIndicesSplit(const std::vector<UnsignedInt>& indices, const UnsignedInt maxVertexCount) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::compressIndicesSplit(): index count is not divisible by 3", {});
+    CORRADE_ASSERT(maxVertexCount && maxVertexCount <= 65536,
+        "MeshTools::compressIndicesSplit(): expected max vertex count in range [1, 65536] but got" << maxVertexCount, {});
+
+    Containers::Array<UnsignedShort> data{indices.size()};
+    std::vector<IndexChunk> chunks;
+
+    /* Extend the current chunk with triangles while the index range fits */
+    std::size_t chunkBegin = 0;
+    UnsignedInt min = 0, max = 0;
+    const auto flush = [&](const std::size_t end) {
+        for(std::size_t i = chunkBegin; i != end; ++i)
+            data[i] = UnsignedShort(indices[i] - min);
+        chunks.push_back({UnsignedInt(chunkBegin), UnsignedInt(end - chunkBegin), min, max - min});
+        chunkBegin = end;
+    };
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        const UnsignedInt triangleMin = std::min({indices[i], indices[i + 1], indices[i + 2]});
+        const UnsignedInt triangleMax = std::max({indices[i], indices[i + 1], indices[i + 2]});
+        CORRADE_ASSERT(triangleMax - triangleMin < maxVertexCount,
+            "MeshTools::compressIndicesSplit(): triangle" << i/3 << "spans more than" << maxVertexCount << "vertices", {});
+
+        if(i == chunkBegin) {
+            min = triangleMin;
+            max = triangleMax;
+        } else if(std::max(max, triangleMax) - std::min(min, triangleMin) < maxVertexCount) {
+            min = std::min(min, triangleMin);
+            max = std::max(max, triangleMax);
+        } else {
+            flush(i);
+            min = triangleMin;
+            max = triangleMax;
+        }
+    }
+    if(chunkBegin != indices.size()) flush(indices.size());
+
+    return {std::move(data), std::move(chunks)};
+}
+
 template Containers::Array<UnsignedByte> compressIndicesAs(const std::vector<UnsignedInt>& indices);
 template Containers::Array<UnsignedShort> compressIndicesAs(const std::vector<UnsignedInt>& indices);
 template Containers::Array<UnsignedInt> compressIndicesAs(const std::vector<UnsignedInt>& indices);
@@ -26,10 +26,11 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::compressIndices()
+ * @brief Function @ref Magnum::MeshTools::compressIndices(), @ref Magnum::MeshTools::compressIndicesAs(), @ref Magnum::MeshTools::compressIndicesSplit(), struct @ref Magnum::MeshTools::IndexChunk
  */
 
 #include <tuple>
+#include <vector>
 
 #include "Magnum/Mesh.h"
 #include "Magnum/MeshTools/visibility.h"
@@ -63,6 +64,8 @@ mesh.setCount(indices.size())
     .setIndexBuffer(indexBuffer, 0, indexType, indexStart, indexEnd);
 @endcode
 
+If the maximum index doesn't fit into 16 bits, consider using
+@ref compressIndicesSplit() instead.
 @see @ref compressIndicesAs()
 @todo Extract IndexType out of Mesh class
 */
@@ -85,6 +88,69 @@ Containers::Array<UnsignedShort> indexData = MeshTools::compressIndicesAs<Unsign
 */
 template<class T> MAGNUM_MESHTOOLS_EXPORT Containers::Array<T> compressIndicesAs(const std::vector<UnsignedInt>& indices);
 
+/**
+@brief Index chunk
+
+@see @ref compressIndicesSplit()
+*/
+struct IndexChunk {
+    UnsignedInt indexOffset;    /**< @brief Offset of first index */
+    UnsignedInt indexCount;     /**< @brief Index count */
+    UnsignedInt baseVertex;     /**< @brief Vertex the indices are relative to */
+    UnsignedInt indexEnd;       /**< @brief Maximal index in the chunk */
+};
+
+/**
+@brief Compress triangle indices to 16 bits by splitting them into chunks
+@param indices          Triangle index array
+@param maxVertexCount   Max count of vertices a chunk can address
+@return 16-bit index array and chunk list
+
+Meshes with more than 65536 vertices would need 32-bit indices with
+@ref compressIndices(). This function instead splits the triangles into
+consecutive chunks where all indices are within @p maxVertexCount from the
+smallest index in the chunk. That index is stored as
+@ref IndexChunk::baseVertex and subtracted from the chunk indices, so the
+smallest index in each chunk is `0` and each
+chunk is addressable with @ref Magnum::UnsignedShort "UnsignedShort". Chunk
+indices are stored one after another in the output array, triangle order is
+preserved. Use @p maxVertexCount of `65535` if you need to keep the index
+`0xffff` free for primitive restart.
+
+The fewer chunks, the better, so the vertices should be ordered
+by first use, for example with @ref optimizeVertexFetch(). Expects that index
+count is divisible by three and that no triangle references vertices more
+than @p maxVertexCount apart.
+
+Each chunk is then drawn using a @ref MeshView with base vertex:
+@code
+std::vector<UnsignedInt> indices;
+
+Containers::Array<UnsignedShort> indexData;
+std::vector<MeshTools::IndexChunk> chunks;
+std::tie(indexData, chunks) = MeshTools::compressIndicesSplit(indices);
+
+Buffer indexBuffer;
+indexBuffer.setData(indexData, BufferUsage::StaticDraw);
+mesh.setIndexBuffer(indexBuffer, 0, Mesh::IndexType::UnsignedShort);
+
+for(const MeshTools::IndexChunk& chunk: chunks) {
+    MeshView view{mesh};
+    view.setCount(chunk.indexCount)
+        .setBaseVertex(chunk.baseVertex)
+        .setIndexRange(chunk.indexOffset, 0, chunk.indexEnd)
+        .draw(shader);
+}
+@endcode
+
+Base vertex for indexed meshes is not available on OpenGL ES and WebGL. There
+create one @ref Mesh for each chunk and offset the vertex buffer by
+@ref IndexChunk::baseVertex multiplied by vertex stride in
+@ref Mesh::addVertexBuffer() instead.
+@see @ref compressIndicesAs()
+*/
+MAGNUM_MESHTOOLS_EXPORT std::pair<Containers::Array<UnsignedShort>, std::vector<IndexChunk>> compressIndicesSplit(const std::vector<UnsignedInt>& indices, UnsignedInt maxVertexCount = 65536);
+
 #if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
 extern template MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedByte> compressIndicesAs<UnsignedByte>(const std::vector<UnsignedInt>& indices);
 extern template MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedShort> compressIndicesAs<UnsignedShort>(const std::vector<UnsignedInt>& indices);
@@ -0,0 +1,221 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ComputeProcessor.h"
+
+#include <Corrade/Utility/Resource.h>
+
+#include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Buffer.h"
+#include "Magnum/Context.h"
+#include "Magnum/Renderer.h"
+#include "Magnum/Shader.h"
+#include "Magnum/Version.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/GenerateMeshlets.h"
+
+#ifdef MAGNUM_BUILD_STATIC
+static void importMeshToolsResources() {
+    CORRADE_RESOURCE_INITIALIZE(MagnumMeshTools_RESOURCES)
+}
+#endif
+
+namespace Magnum { namespace MeshTools {
+
+/* The shader reads the meshlets as raw 32-bit words */
+static_assert(sizeof(Meshlet) == 11*4, "unexpected Meshlet layout");
+
+namespace {
+
+enum: UnsignedInt { WorkGroupSize = 64 };
+
+class ComputeShader: public AbstractShaderProgram {
+    public:
+        using AbstractShaderProgram::uniformLocation;
+        using AbstractShaderProgram::setUniform;
+
+        explicit ComputeShader(const std::string& file, const std::string& defines = {}) {
+            #ifdef MAGNUM_BUILD_STATIC
+            /* Import resources on static build, if not already */
+            if(!Utility::Resource::hasGroup("MagnumMeshTools"))
+                importMeshToolsResources();
+            #endif
+            Utility::Resource rs{"MagnumMeshTools"};
+
+            #ifndef MAGNUM_TARGET_GLES
+            MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GL430);
+            Shader comp{Version::GL430, Shader::Type::Compute};
+            #else
+            MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GLES310);
+            Shader comp{Version::GLES310, Shader::Type::Compute};
+            #endif
+            comp.addSource(defines)
+                .addSource(rs.get(file));
+
+            CORRADE_INTERNAL_ASSERT_OUTPUT(comp.compile());
+            attachShader(comp);
+            CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+            countUniform = uniformLocation("count");
+        }
+
+        /* Dispatches one invocation for each item, spreading the work groups
+           into two dimensions to avoid hitting the work group count limit */
+        void dispatch(const UnsignedInt count) {
+            setUniform(countUniform, count);
+            const UnsignedInt groupCount = (count + WorkGroupSize - 1)/WorkGroupSize;
+            if(!groupCount) return;
+            const UnsignedInt x = Math::min(groupCount, 65535u);
+            dispatchCompute({x, (groupCount + x - 1)/x, 1});
+        }
+
+    private:
+        Int countUniform;
+};
+
+/* Offset or stride in floats */
+UnsignedInt floatCount(const GLintptr bytes, const char* const function) {
+    CORRADE_ASSERT(bytes % 4 == 0,
+        "MeshTools::ComputeProcessor::" << function << Debug::nospace << "(): expected offset and stride to be a multiple of four bytes", {});
+    static_cast<void>(function);
+    return UnsignedInt(bytes/4);
+}
+
+}
+
+namespace Implementation {
+
+struct ComputeProcessorState {
+    explicit ComputeProcessorState();
+
+    ComputeShader transform, accumulateNormals, normalizeNormals, cullMeshlets;
+    Int transformMatrixUniform, transformWUniform, transformOffsetUniform, transformStrideUniform,
+        accumulatePositionOffsetUniform, accumulatePositionStrideUniform,
+        normalizeNormalOffsetUniform, normalizeNormalStrideUniform,
+        cullFrustumUniform, cullCameraPositionUniform;
+
+    /* Scratch buffer for normal accumulation, three integers per vertex */
+    Buffer accumulated;
+    UnsignedInt accumulatedCapacity;
+};
+
+ComputeProcessorState::ComputeProcessorState():
+    transform{"TransformInPlace.comp"},
+    accumulateNormals{"GenerateSmoothNormals.comp", "#define ACCUMULATE\n"},
+    normalizeNormals{"GenerateSmoothNormals.comp", "#define NORMALIZE\n"},
+    cullMeshlets{"CullMeshlets.comp"},
+    transformMatrixUniform{transform.uniformLocation("transformationMatrix")},
+    transformWUniform{transform.uniformLocation("w")},
+    transformOffsetUniform{transform.uniformLocation("offset")},
+    transformStrideUniform{transform.uniformLocation("stride")},
+    accumulatePositionOffsetUniform{accumulateNormals.uniformLocation("positionOffset")},
+    accumulatePositionStrideUniform{accumulateNormals.uniformLocation("positionStride")},
+    normalizeNormalOffsetUniform{normalizeNormals.uniformLocation("normalOffset")},
+    normalizeNormalStrideUniform{normalizeNormals.uniformLocation("normalStride")},
+    cullFrustumUniform{cullMeshlets.uniformLocation("frustum")},
+    cullCameraPositionUniform{cullMeshlets.uniformLocation("cameraPosition")},
+    accumulatedCapacity{0} {}
+
+}
+
+ComputeProcessor::ComputeProcessor(): _state{new Implementation::ComputeProcessorState} {}
+
+ComputeProcessor::ComputeProcessor(ComputeProcessor&&) noexcept = default;
+
+ComputeProcessor::~ComputeProcessor() = default;
+
+ComputeProcessor& ComputeProcessor::operator=(ComputeProcessor&&) noexcept = default;
+
+ComputeProcessor& ComputeProcessor::transformPointsInPlace(const Matrix4& matrix, const Attribute& points, const UnsignedInt count) {
+    ComputeShader& shader = _state->transform;
+    shader.setUniform(_state->transformMatrixUniform, matrix);
+    shader.setUniform(_state->transformWUniform, 1.0f);
+    shader.setUniform(_state->transformOffsetUniform, floatCount(points.offset, "transformPointsInPlace"));
+    shader.setUniform(_state->transformStrideUniform, points.stride ? floatCount(points.stride, "transformPointsInPlace") : 3);
+    points.buffer.bind(Buffer::Target::ShaderStorage, 0);
+    shader.dispatch(count);
+
+    Renderer::setMemoryBarrier(Renderer::MemoryBarrier::VertexAttributeArray|Renderer::MemoryBarrier::ShaderStorage);
+    return *this;
+}
+
+ComputeProcessor& ComputeProcessor::transformVectorsInPlace(const Matrix4& matrix, const Attribute& vectors, const UnsignedInt count) {
+    ComputeShader& shader = _state->transform;
+    shader.setUniform(_state->transformMatrixUniform, matrix);
+    shader.setUniform(_state->transformWUniform, 0.0f);
+    shader.setUniform(_state->transformOffsetUniform, floatCount(vectors.offset, "transformVectorsInPlace"));
+    shader.setUniform(_state->transformStrideUniform, vectors.stride ? floatCount(vectors.stride, "transformVectorsInPlace") : 3);
+    vectors.buffer.bind(Buffer::Target::ShaderStorage, 0);
+    shader.dispatch(count);
+
+    Renderer::setMemoryBarrier(Renderer::MemoryBarrier::VertexAttributeArray|Renderer::MemoryBarrier::ShaderStorage);
+    return *this;
+}
+
+ComputeProcessor& ComputeProcessor::generateSmoothNormals(Buffer& indices, const UnsignedInt indexCount, const Attribute& positions, const Attribute& normals, const UnsignedInt vertexCount) {
+    CORRADE_ASSERT(indexCount % 3 == 0,
+        "MeshTools::ComputeProcessor::generateSmoothNormals(): index count is not divisible by 3", *this);
+
+    /* Enlarge the accumulator, if needed. It's zero-filled only on
+       allocation, the normalization pass clears it afterwards. */
+    if(_state->accumulatedCapacity < vertexCount) {
+        _state->accumulated.setData(std::vector<Int>(vertexCount*3), BufferUsage::DynamicCopy);
+        _state->accumulatedCapacity = vertexCount;
+    }
+
+    /* Accumulate angle-weighted face normals for each triangle */
+    _state->accumulateNormals.setUniform(_state->accumulatePositionOffsetUniform, floatCount(positions.offset, "generateSmoothNormals"));
+    _state->accumulateNormals.setUniform(_state->accumulatePositionStrideUniform, positions.stride ? floatCount(positions.stride, "generateSmoothNormals") : 3);
+    _state->accumulated.bind(Buffer::Target::ShaderStorage, 0);
+    indices.bind(Buffer::Target::ShaderStorage, 1);
+    positions.buffer.bind(Buffer::Target::ShaderStorage, 2);
+    _state->accumulateNormals.dispatch(indexCount/3);
+
+    Renderer::setMemoryBarrier(Renderer::MemoryBarrier::ShaderStorage);
+
+    /* Normalize them and write them to the output */
+    _state->normalizeNormals.setUniform(_state->normalizeNormalOffsetUniform, floatCount(normals.offset, "generateSmoothNormals"));
+    _state->normalizeNormals.setUniform(_state->normalizeNormalStrideUniform, normals.stride ? floatCount(normals.stride, "generateSmoothNormals") : 3);
+    normals.buffer.bind(Buffer::Target::ShaderStorage, 2);
+    _state->normalizeNormals.dispatch(vertexCount);
+
+    Renderer::setMemoryBarrier(Renderer::MemoryBarrier::VertexAttributeArray|Renderer::MemoryBarrier::ShaderStorage);
+    return *this;
+}
+
+ComputeProcessor& ComputeProcessor::cullMeshlets(Buffer& meshlets, const UnsignedInt count, const Vector4(&frustum)[6], const Vector3& cameraPosition, Buffer& commands) {
+    ComputeShader& shader = _state->cullMeshlets;
+    shader.setUniform(_state->cullFrustumUniform, Containers::ArrayView<const Vector4>{frustum});
+    shader.setUniform(_state->cullCameraPositionUniform, cameraPosition);
+    meshlets.bind(Buffer::Target::ShaderStorage, 0);
+    commands.bind(Buffer::Target::ShaderStorage, 1);
+    shader.dispatch(count);
+
+    Renderer::setMemoryBarrier(Renderer::MemoryBarrier::Command|Renderer::MemoryBarrier::ShaderStorage);
+    return *this;
+}
+
+}}
@@ -0,0 +1,211 @@
+#ifndef Magnum_MeshTools_ComputeProcessor_h
+#define Magnum_MeshTools_ComputeProcessor_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+/** @file
+ * @brief Class @ref Magnum::MeshTools::ComputeProcessor
+ */
+#endif
+
+#include <memory>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/OpenGL.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/MeshTools/visibility.h"
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+namespace Magnum { namespace MeshTools {
+
+namespace Implementation { struct ComputeProcessorState; }
+
+/**
+@brief Mesh processing on the GPU
+
+GPU counterparts to @ref transformPointsInPlace(), @ref transformVectorsInPlace(),
+@ref generateSmoothNormals() and meshlet culling, implemented as compute
+shaders operating directly on vertex and index buffers bound as shader storage.
+The results stay in GPU memory and can be used for rendering right away,
+without any roundtrip to the CPU, which is useful for huge meshes such as
+scans. All compute shaders are compiled in the constructor, so it's advised to
+create the instance once and reuse it.
+
+Vertex data are described with @ref Attribute, which allows to process a
+particular attribute of an interleaved buffer such as the one created by
+@ref compile(). Positions and normals are expected to be three-component
+floats and indices 32-bit unsigned integers. The data offsets and strides need
+to be multiples of four bytes.
+@code
+Buffer vertices, indices;
+vertices.setData(MeshTools::interleave(positions, normals), BufferUsage::StaticDraw);
+indices.setData(indexData, BufferUsage::StaticDraw);
+
+MeshTools::ComputeProcessor processor;
+processor
+    .transformPointsInPlace(Matrix4::scaling(Vector3{0.01f}),
+        {vertices, 0, 24}, positions.size())
+    .generateSmoothNormals(indices, indexData.size(), {vertices, 0, 24},
+        {vertices, 12, 24}, positions.size());
+@endcode
+
+Each operation is followed by a memory barrier, so the results are visible to
+subsequent vertex fetches, draw commands and other compute shaders.
+@requires_gl43 Extension @extension{ARB,compute_shader} and
+    @extension{ARB,shader_storage_buffer_object}
+@requires_gles31 Compute shaders are not available in OpenGL ES 3.0 and
+    older.
+@requires_gles Compute shaders are not available in WebGL.
+*/
+class MAGNUM_MESHTOOLS_EXPORT ComputeProcessor {
+    public:
+        /**
+         * @brief Vertex attribute in a buffer
+         *
+         * Three-component float attribute at given byte offset. Stride of
+         * `0` means the attributes are tightly packed.
+         */
+        struct Attribute {
+            /** @brief Constructor */
+            /*implicit*/ Attribute(Buffer& buffer, GLintptr offset = 0, UnsignedInt stride = 0): buffer(buffer), offset(offset), stride(stride) {}
+
+            Buffer& buffer;     /**< @brief Buffer */
+            GLintptr offset;    /**< @brief Offset of the first attribute */
+            UnsignedInt stride; /**< @brief Stride between the attributes */
+        };
+
+        /**
+         * @brief Constructor
+         *
+         * Compiles all compute shaders.
+         */
+        explicit ComputeProcessor();
+
+        /** @brief Copying is not allowed */
+        ComputeProcessor(const ComputeProcessor&) = delete;
+
+        /** @brief Move constructor */
+        ComputeProcessor(ComputeProcessor&&) noexcept;
+
+        ~ComputeProcessor();
+
+        /** @brief Copying is not allowed */
+        ComputeProcessor& operator=(const ComputeProcessor&) = delete;
+
+        /** @brief Move assignment */
+        ComputeProcessor& operator=(ComputeProcessor&&) noexcept;
+
+        /**
+         * @brief Transform points in place
+         * @param matrix    Transformation matrix
+         * @param points    Points to transform
+         * @param count     Point count
+         * @return Reference to self (for method chaining)
+         *
+         * GPU counterpart to @ref transformPointsInPlace(const Matrix4&, Containers::ArrayView<Vector3>).
+         * @see @ref AbstractShaderProgram::dispatchCompute(),
+         *      @ref Renderer::setMemoryBarrier()
+         */
+        ComputeProcessor& transformPointsInPlace(const Matrix4& matrix, const Attribute& points, UnsignedInt count);
+
+        /**
+         * @brief Transform vectors in place
+         * @param matrix    Transformation matrix
+         * @param vectors   Vectors to transform
+         * @param count     Vector count
+         * @return Reference to self (for method chaining)
+         *
+         * GPU counterpart to @ref transformVectorsInPlace(const Matrix4&, Containers::ArrayView<Vector3>),
+         * the translation part of @p matrix is ignored. For transforming
+         * normals pass normal matrix instead of transformation matrix.
+         */
+        ComputeProcessor& transformVectorsInPlace(const Matrix4& matrix, const Attribute& vectors, UnsignedInt count);
+
+        /**
+         * @brief Generate smooth normals
+         * @param indices       Buffer with triangle indices
+         * @param indexCount    Index count, expected to be divisible by 3
+         * @param positions     Vertex positions
+         * @param normals       Where to put the normals
+         * @param vertexCount   Vertex count
+         * @return Reference to self (for method chaining)
+         *
+         * GPU counterpart to @ref generateSmoothNormals(), the face normals
+         * are weighted by the angle at each vertex and degenerate triangles
+         * don't contribute. As floating-point atomics are not commonly
+         * available, the normals are accumulated in fixed point with
+         * precision of about @f$ 10^{-5} @f$ in a scratch buffer with three
+         * 32-bit integers per vertex, which is kept for subsequent calls.
+         * Vertices shared by more than about ten thousand triangles might
+         * overflow the accumulator. Vertices without any non-degenerate
+         * triangle get zero normal.
+         */
+        ComputeProcessor& generateSmoothNormals(Buffer& indices, UnsignedInt indexCount, const Attribute& positions, const Attribute& normals, UnsignedInt vertexCount);
+
+        /**
+         * @brief Cull meshlets
+         * @param meshlets      Buffer with @ref Meshlet structures
+         * @param count         Meshlet count
+         * @param frustum       Frustum planes in mesh coordinate system
+         * @param cameraPosition Camera position in mesh coordinate system
+         * @param commands      Where to put the draw commands
+         * @return Reference to self (for method chaining)
+         *
+         * GPU counterpart to culling meshlets on the CPU using
+         * @ref Math::Geometry::Intersection::sphereFrustum() and
+         * @ref Meshlet::isBackfacing(). The frustum planes are expected in
+         * the same format as in @ref Math::Geometry::Intersection::sphereFrustum().
+         * For each meshlet a @ref Mesh::DrawElementsIndirectCommand is
+         * written into @p commands, which needs to be large enough. Culled
+         * meshlets have zero instance count, so on desktop GL all @p count
+         * commands can be drawn directly with @ref Mesh::drawIndirect() using
+         * indices created by @ref meshletIndices():
+         * @code
+         * MeshTools::Meshlets meshlets = MeshTools::generateMeshlets(indexData, positions);
+         * Buffer meshletBuffer, commands;
+         * meshletBuffer.setData(meshlets.meshlets, BufferUsage::StaticDraw);
+         * commands.setData({nullptr, meshlets.meshlets.size()*sizeof(Mesh::DrawElementsIndirectCommand)}, BufferUsage::DynamicDraw);
+         * mesh.setIndexBuffer(indices, 0, Mesh::IndexType::UnsignedInt);
+         *
+         * // each frame
+         * processor.cullMeshlets(meshletBuffer, meshlets.meshlets.size(),
+         *     frustum, cameraPosition, commands);
+         * mesh.drawIndirect(shader, commands, 0, meshlets.meshlets.size());
+         * @endcode
+         */
+        ComputeProcessor& cullMeshlets(Buffer& meshlets, UnsignedInt count, const Vector4(&frustum)[6], const Vector3& cameraPosition, Buffer& commands);
+
+    private:
+        std::unique_ptr<Implementation::ComputeProcessorState> _state;
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 and WebGL builds
+#endif
+
+#endif
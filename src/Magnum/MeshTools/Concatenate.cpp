@@ -0,0 +1,113 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Concatenate.h"
+
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/MeshTools/Transform.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Returned on assertion failure */
+std::pair<Trade::MeshData3D, std::vector<MeshRange>> emptyResult() {
+    return std::make_pair(Trade::MeshData3D{MeshPrimitive::Points, {}, {{}}, {}, {}}, std::vector<MeshRange>{});
+}
+
+}
+
+std::pair<Trade::MeshData3D, std::vector<MeshRange>> concatenate(const std::vector<std::pair<std::reference_wrapper<const Trade::MeshData3D>, Matrix4>>& meshes) {
+    CORRADE_ASSERT(!meshes.empty(), "MeshTools::concatenate(): no meshes passed", emptyResult());
+
+    const Trade::MeshData3D& first = meshes.front().first;
+    std::vector<UnsignedInt> indices;
+    std::vector<std::vector<Vector3>> positions(first.positionArrayCount());
+    std::vector<std::vector<Vector3>> normals(first.normalArrayCount());
+    std::vector<std::vector<Vector2>> textureCoords2D(first.textureCoords2DArrayCount());
+    std::vector<MeshRange> ranges;
+    ranges.reserve(meshes.size());
+
+    /* Reserve everything upfront */
+    std::size_t indexCount = 0, vertexCount = 0;
+    for(const auto& mesh: meshes) {
+        const Trade::MeshData3D& data = mesh.first;
+        CORRADE_ASSERT(data.primitive() == first.primitive() &&
+            data.isIndexed() == first.isIndexed() &&
+            data.positionArrayCount() == first.positionArrayCount() &&
+            data.normalArrayCount() == first.normalArrayCount() &&
+            data.textureCoords2DArrayCount() == first.textureCoords2DArrayCount(),
+            "MeshTools::concatenate(): mesh" << ranges.size() << "has different primitive or layout than the first mesh",
+            emptyResult());
+        CORRADE_ASSERT(!data.isSkinned(),
+            "MeshTools::concatenate(): skinned meshes are not supported", emptyResult());
+
+        const UnsignedInt meshIndexCount = data.isIndexed() ? data.indices().size() : 0;
+        const UnsignedInt meshVertexCount = data.positions(0).size();
+        ranges.push_back({UnsignedInt(indexCount), meshIndexCount, UnsignedInt(vertexCount), meshVertexCount});
+        indexCount += meshIndexCount;
+        vertexCount += meshVertexCount;
+    }
+    indices.reserve(indexCount);
+    for(auto& array: positions) array.reserve(vertexCount);
+    for(auto& array: normals) array.reserve(vertexCount);
+    for(auto& array: textureCoords2D) array.reserve(vertexCount);
+
+    for(std::size_t i = 0; i != meshes.size(); ++i) {
+        const Trade::MeshData3D& data = meshes[i].first;
+        const Matrix4& transformation = meshes[i].second;
+        const UnsignedInt vertexOffset = ranges[i].vertexOffset;
+
+        if(data.isIndexed()) for(const UnsignedInt index: data.indices())
+            indices.push_back(vertexOffset + index);
+
+        /* Transform the newly appended part of each array in place */
+        for(std::size_t j = 0; j != positions.size(); ++j) {
+            positions[j].insert(positions[j].end(), data.positions(j).begin(), data.positions(j).end());
+            transformPointsInPlace(transformation, Containers::ArrayView<Vector3>{positions[j].data() + vertexOffset, data.positions(j).size()});
+        }
+
+        /* Normals are transformed with inverse transpose of the rotation and
+           scaling part to stay perpendicular under non-uniform scaling */
+        if(!normals.empty()) {
+            const Matrix4 normalMatrix = Matrix4::from(transformation.rotationScaling().inverted().transposed(), {});
+            for(std::size_t j = 0; j != normals.size(); ++j) {
+                normals[j].insert(normals[j].end(), data.normals(j).begin(), data.normals(j).end());
+                Containers::ArrayView<Vector3> view{normals[j].data() + vertexOffset, data.normals(j).size()};
+                transformVectorsInPlace(normalMatrix, view);
+                for(Vector3& normal: view) normal = normal.normalized();
+            }
+        }
+
+        for(std::size_t j = 0; j != textureCoords2D.size(); ++j)
+            textureCoords2D[j].insert(textureCoords2D[j].end(), data.textureCoords2D(j).begin(), data.textureCoords2D(j).end());
+    }
+
+    return std::make_pair(Trade::MeshData3D{first.primitive(), std::move(indices), std::move(positions), std::move(normals), std::move(textureCoords2D)}, std::move(ranges));
+}
+
+}}
@@ -0,0 +1,109 @@
+#ifndef Magnum_MeshTools_Concatenate_h
+#define Magnum_MeshTools_Concatenate_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::MeshTools::MeshRange, function @ref Magnum::MeshTools::concatenate()
+ */
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Range of a mesh in concatenated mesh data
+
+@see @ref concatenate()
+*/
+struct MeshRange {
+    /**
+     * @brief Index offset
+     *
+     * Offset of the first index of the mesh. Zero if the concatenated mesh
+     * is not indexed.
+     */
+    UnsignedInt indexOffset;
+
+    /**
+     * @brief Index count
+     *
+     * Zero if the concatenated mesh is not indexed.
+     */
+    UnsignedInt indexCount;
+
+    /** @brief Offset of the first vertex of the mesh */
+    UnsignedInt vertexOffset;
+
+    /** @brief Vertex count */
+    UnsignedInt vertexCount;
+};
+
+/**
+@brief Concatenate transformed meshes
+@param meshes       Meshes together with their transformations
+@return Concatenated mesh data and range of each mesh in it
+
+Transforms positions of each mesh with its transformation using
+@ref transformPointsInPlace(const Matrix4&, Containers::ArrayView<Vector3>),
+normals with the corresponding normal matrix, and concatenates the vertex and
+index data, with indices of each mesh offset to point to its vertices.
+Texture coordinates are copied unchanged. Useful for static batching of
+level geometry --- meshes of many objects that never move and share the same
+shader configuration can be baked into a single mesh and drawn with a single
+draw call. The returned ranges can be used to set up a @ref MeshView for each
+original mesh, for example for culling or picking:
+@code
+std::vector<std::pair<std::reference_wrapper<const Trade::MeshData3D>, Matrix4>> meshes;
+// fill with data of static objects ...
+
+std::pair<Trade::MeshData3D, std::vector<MeshTools::MeshRange>> batch = MeshTools::concatenate(meshes);
+
+Mesh mesh;
+std::unique_ptr<Buffer> vertices, indices;
+std::tie(mesh, vertices, indices) = MeshTools::compile(batch.first, BufferUsage::StaticDraw);
+
+MeshView view{mesh};
+view.setCount(batch.second[3].indexCount)
+    .setIndexRange(batch.second[3].indexOffset);
+@endcode
+
+See @ref SceneGraph::staticBatches() for collecting the drawables from a
+scene. Expects that at least one mesh is passed, that all meshes have the same
+primitive, are either all indexed or all non-indexed, have the same count of
+position, normal and texture coordinate arrays and are not skinned.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::pair<Trade::MeshData3D, std::vector<MeshRange>> concatenate(const std::vector<std::pair<std::reference_wrapper<const Trade::MeshData3D>, Matrix4>>& meshes);
+
+}}
+
+#endif
@@ -0,0 +1,92 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GenerateBarycentric.h"
+
+#include <algorithm>
+
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace MeshTools {
+
+std::tuple<std::vector<UnsignedInt>, std::vector<UnsignedInt>, std::vector<Vector3>> generateBarycentric(const std::vector<UnsignedInt>& indices) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::generateBarycentric(): index count is not divisible by 3!", (std::tuple<std::vector<UnsignedInt>, std::vector<UnsignedInt>, std::vector<Vector3>>()));
+
+    /* All six ways to assign the three coordinates to face corners, the
+       identity first so the common case keeps the original corner order */
+    constexpr UnsignedByte permutations[6][3]{
+        {0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}
+    };
+    constexpr UnsignedInt NoVertex = ~UnsignedInt{};
+
+    /* New vertex index for each original vertex and each of its three
+       possible coordinates */
+    const UnsignedInt vertexCount = indices.empty() ? 0 : *std::max_element(indices.begin(), indices.end()) + 1;
+    std::vector<UnsignedInt> copies(vertexCount*3, NoVertex);
+
+    std::vector<UnsignedInt> newIndices;
+    newIndices.reserve(indices.size());
+    std::vector<UnsignedInt> vertexMapping;
+    vertexMapping.reserve(vertexCount);
+    std::vector<Vector3> barycentric;
+    barycentric.reserve(vertexCount);
+
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        /* Pick the assignment that reuses the most already colored vertices */
+        std::size_t best = 0;
+        Int bestReused = -1;
+        for(std::size_t p = 0; p != 6; ++p) {
+            Int reused = 0;
+            for(std::size_t j = 0; j != 3; ++j)
+                if(copies[indices[i + j]*3 + permutations[p][j]] != NoVertex)
+                    ++reused;
+            if(reused > bestReused) {
+                best = p;
+                bestReused = reused;
+                if(reused == 3) break;
+            }
+        }
+
+        /* Add a new vertex for every corner that doesn't have the coordinate
+           yet */
+        for(std::size_t j = 0; j != 3; ++j) {
+            const UnsignedInt coordinate = permutations[best][j];
+            UnsignedInt& copy = copies[indices[i + j]*3 + coordinate];
+            if(copy == NoVertex) {
+                copy = vertexMapping.size();
+                vertexMapping.push_back(indices[i + j]);
+                Vector3 b;
+                b[coordinate] = 1.0f;
+                barycentric.push_back(b);
+            }
+
+            newIndices.push_back(copy);
+        }
+    }
+
+    return std::make_tuple(std::move(newIndices), std::move(vertexMapping), std::move(barycentric));
+}
+
+}}
@@ -0,0 +1,73 @@
+#ifndef Magnum_MeshTools_GenerateBarycentric_h
+#define Magnum_MeshTools_GenerateBarycentric_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::generateBarycentric()
+ */
+
+#include <tuple>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Generate barycentric coordinates for wireframe rendering
+@param indices      Array of triangle face indices
+@return New index array, original vertex index for each new vertex and
+    barycentric coordinates for each new vertex
+
+Assigns to each vertex one of the @f$ (1, 0, 0) @f$, @f$ (0, 1, 0) @f$,
+@f$ (0, 0, 1) @f$ barycentric coordinates so all three corners of every
+triangle have a different one. The assignment is done greedily face by face,
+reusing an already colored vertex wherever possible and duplicating it only if
+its coordinate conflicts with other corners of the face, so the mesh stays
+indexed and the vertex count grows only as much as needed. Example usage:
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+
+std::vector<UnsignedInt> vertexMapping;
+std::vector<Vector3> barycentric;
+std::tie(indices, vertexMapping, barycentric) = MeshTools::generateBarycentric(indices);
+positions = MeshTools::duplicate(vertexMapping, positions);
+@endcode
+The positions and barycentric coordinates can be then rendered with
+@ref Shaders::MeshVisualizer::Flag::BarycentricAttribute using the new index
+array.
+
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3.
+@see @ref duplicate()
+*/
+std::tuple<std::vector<UnsignedInt>, std::vector<UnsignedInt>, std::vector<Vector3>> MAGNUM_MESHTOOLS_EXPORT generateBarycentric(const std::vector<UnsignedInt>& indices);
+
+}}
+
+#endif
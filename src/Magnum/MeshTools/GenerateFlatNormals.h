@@ -58,6 +58,7 @@ to use the same indices.
 
 @attention The function requires the mesh to have triangle faces, thus index
     count must be divisible by 3.
+@see @ref generateSmoothNormals()
 */
 std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> MAGNUM_MESHTOOLS_EXPORT generateFlatNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions);
 
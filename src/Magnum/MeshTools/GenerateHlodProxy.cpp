@@ -0,0 +1,83 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GenerateHlodProxy.h"
+
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/MeshTools/Concatenate.h"
+#include "Magnum/MeshTools/Duplicate.h"
+#include "Magnum/MeshTools/OptimizeVertexFetch.h"
+#include "Magnum/MeshTools/Simplify.h"
+
+namespace Magnum { namespace MeshTools {
+
+Trade::MeshData3D generateHlodProxy(const std::vector<std::tuple<std::reference_wrapper<const Trade::MeshData3D>, Matrix4, Range2D>>& meshes, const Float ratio, const Float maxError) {
+    CORRADE_ASSERT(!meshes.empty(), "MeshTools::generateHlodProxy(): no meshes passed",
+        (Trade::MeshData3D{MeshPrimitive::Triangles, {}, {{}}, {}, {}}));
+    #ifndef CORRADE_NO_ASSERT
+    for(const auto& mesh: meshes) {
+        const Trade::MeshData3D& data = std::get<0>(mesh);
+        CORRADE_ASSERT(data.primitive() == MeshPrimitive::Triangles && data.isIndexed(),
+            "MeshTools::generateHlodProxy(): expected indexed triangle meshes",
+            (Trade::MeshData3D{MeshPrimitive::Triangles, {}, {{}}, {}, {}}));
+    }
+    #endif
+
+    /* Merge everything together */
+    std::vector<std::pair<std::reference_wrapper<const Trade::MeshData3D>, Matrix4>> transformed;
+    transformed.reserve(meshes.size());
+    for(const auto& mesh: meshes)
+        transformed.emplace_back(std::get<0>(mesh), std::get<1>(mesh));
+    std::pair<Trade::MeshData3D, std::vector<MeshRange>> merged = concatenate(transformed);
+    Trade::MeshData3D& data = merged.first;
+
+    /* Move texture coordinates of each mesh into its atlas range */
+    std::vector<Vector2> textureCoords2D;
+    if(data.hasTextureCoords2D()) {
+        textureCoords2D = std::move(data.textureCoords2D(0));
+        for(std::size_t i = 0; i != meshes.size(); ++i) {
+            const Range2D& range = std::get<2>(meshes[i]);
+            const MeshRange& meshRange = merged.second[i];
+            for(std::size_t j = meshRange.vertexOffset; j != meshRange.vertexOffset + meshRange.vertexCount; ++j)
+                textureCoords2D[j] = range.min() + Math::clamp(textureCoords2D[j], 0.0f, 1.0f)*range.size();
+        }
+    }
+
+    /* Simplify and drop vertices that are not referenced anymore */
+    std::vector<UnsignedInt> indices = simplify(data.indices(), data.positions(0), std::size_t(data.indices().size()*ratio)/3*3, maxError);
+    const std::vector<UnsignedInt> order = optimizeVertexFetch(indices, data.positions(0).size());
+
+    std::vector<std::vector<Vector3>> normals;
+    if(data.hasNormals()) normals.push_back(duplicate(order, data.normals(0)));
+    std::vector<std::vector<Vector2>> textureCoords;
+    if(!textureCoords2D.empty()) textureCoords.push_back(duplicate(order, textureCoords2D));
+
+    return Trade::MeshData3D{MeshPrimitive::Triangles, std::move(indices), {duplicate(order, data.positions(0))}, std::move(normals), std::move(textureCoords)};
+}
+
+}}
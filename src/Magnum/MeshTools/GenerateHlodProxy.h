@@ -0,0 +1,98 @@
+#ifndef Magnum_MeshTools_GenerateHlodProxy_h
+#define Magnum_MeshTools_GenerateHlodProxy_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::generateHlodProxy()
+ */
+
+#include <functional>
+#include <tuple>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Generate proxy mesh for a cluster of static meshes
+@param meshes       Meshes, their transformations and texture atlas ranges
+@param ratio        Ratio of index count of the proxy to the total index
+    count of all meshes
+@param maxError     Max allowed simplification error, in position units
+@return Proxy mesh
+
+Merges the meshes using @ref concatenate(), reduces the result using
+@ref simplify() to @p ratio of its index count and removes vertices that are
+no longer referenced using @ref optimizeVertexFetch(). The meshes are expected
+to be indexed triangle meshes with the same layout, only the first position,
+normal and texture coordinate array is kept.
+
+Texture coordinates of each mesh are clamped to @f$ [0, 1] @f$ and mapped
+into its range in the texture atlas, given in normalized coordinates, so the
+whole proxy can be drawn with a single texture. The atlas ranges can be
+calculated from @ref TextureTools::atlas() and the atlas image itself with
+@ref TextureTools::bakeAtlas(). As the coordinates are clamped, textures
+repeating over the surface are not preserved.
+
+Together with @ref SceneGraph::hlodClusters() and @ref SceneGraph::HlodDrawable
+this can be used to replace distant groups of static objects with a single
+cheap mesh:
+@code
+for(const SceneGraph::HlodCluster3D& cluster: SceneGraph::hlodClusters(city, drawables, 200.0f)) {
+    std::vector<Vector2i> sizes;
+    std::vector<ImageView2D> images;
+    for(const auto& drawable: cluster.drawables) {
+        images.push_back(textureImages[drawable.first.get().drawState().textures]);
+        sizes.push_back(images.back().size()/4);
+    }
+    const std::vector<Range2Di> ranges = TextureTools::atlas({1024, 1024}, sizes, {2, 2});
+
+    std::vector<std::tuple<std::reference_wrapper<const Trade::MeshData3D>, Matrix4, Range2D>> meshes;
+    for(std::size_t i = 0; i != cluster.drawables.size(); ++i)
+        meshes.emplace_back(meshData[cluster.drawables[i].first.get().drawState().mesh],
+            cluster.drawables[i].second, Range2D{ranges[i]}.scaled(Vector2{1.0f/1024.0f}));
+
+    Trade::MeshData3D proxy = MeshTools::generateHlodProxy(meshes, 0.05f);
+    Image2D atlas = TextureTools::bakeAtlas({1024, 1024}, images, ranges);
+    // ...
+}
+@endcode
+
+@attention The function requires the meshes to have triangle faces, thus
+    index count of each mesh must be divisible by 3.
+@see @ref generateLods()
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData3D generateHlodProxy(const std::vector<std::tuple<std::reference_wrapper<const Trade::MeshData3D>, Matrix4, Range2D>>& meshes, Float ratio = 0.1f, Float maxError = Constants::inf());
+
+}}
+
+#endif
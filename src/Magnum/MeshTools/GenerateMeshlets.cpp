@@ -0,0 +1,193 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GenerateMeshlets.h"
+
+#include <algorithm>
+
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/MeshTools/Tipsify.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+constexpr UnsignedInt NoVertex = ~UnsignedInt{};
+
+void calculateBounds(Meshlet& meshlet, const Meshlets& out, const std::vector<Vector3>& positions) {
+    /* Bounding sphere around center of the bounding box */
+    Vector3 min{Constants::inf()}, max{-Constants::inf()};
+    for(std::size_t i = 0; i != meshlet.vertexCount; ++i) {
+        const Vector3& position = positions[out.vertices[meshlet.vertexOffset + i]];
+        min = Math::min(min, position);
+        max = Math::max(max, position);
+    }
+    meshlet.center = (min + max)*0.5f;
+    meshlet.radius = 0.0f;
+    for(std::size_t i = 0; i != meshlet.vertexCount; ++i)
+        meshlet.radius = Math::max(meshlet.radius, (positions[out.vertices[meshlet.vertexOffset + i]] - meshlet.center).dot());
+    meshlet.radius = std::sqrt(meshlet.radius);
+
+    /* Normal cone around average normal */
+    std::vector<Vector3> normals;
+    normals.reserve(meshlet.triangleCount);
+    Vector3 axis;
+    for(std::size_t i = 0; i != meshlet.triangleCount*3; i += 3) {
+        const Vector3& a = positions[out.vertices[meshlet.vertexOffset + out.triangles[meshlet.triangleOffset + i]]];
+        const Vector3& b = positions[out.vertices[meshlet.vertexOffset + out.triangles[meshlet.triangleOffset + i + 1]]];
+        const Vector3& c = positions[out.vertices[meshlet.vertexOffset + out.triangles[meshlet.triangleOffset + i + 2]]];
+        const Vector3 normal = Math::cross(b - a, c - a);
+        const Float length = normal.length();
+        if(length == 0.0f) continue;
+
+        normals.push_back(normal/length);
+        axis += normals.back();
+    }
+
+    const Float axisLength = axis.length();
+    if(axisLength == 0.0f) {
+        meshlet.coneAxis = Vector3::zAxis();
+        meshlet.coneCutoff = 1.0f;
+        return;
+    }
+
+    meshlet.coneAxis = axis/axisLength;
+    Float minDot = 1.0f;
+    for(const Vector3& normal: normals)
+        minDot = Math::min(minDot, Math::dot(normal, meshlet.coneAxis));
+    meshlet.coneCutoff = minDot <= 0.0f ? 1.0f : std::sqrt(1.0f - minDot*minDot);
+}
+
+}
+
+Meshlets generateMeshlets(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const UnsignedInt maxVertexCount, const UnsignedInt maxTriangleCount) {
+    CORRADE_ASSERT(indices.size() % 3 == 0, "MeshTools::generateMeshlets(): index count is not divisible by 3", {});
+    CORRADE_ASSERT(maxVertexCount >= 3 && maxVertexCount <= 256 && maxTriangleCount >= 1 && maxTriangleCount <= 65535,
+        "MeshTools::generateMeshlets(): expected 3 to 256 vertices and 1 to 65535 triangles per meshlet but got" << maxVertexCount << "and" << maxTriangleCount, {});
+
+    const UnsignedInt vertexCount = positions.size();
+    const std::size_t triangleCount = indices.size()/3;
+
+    /* Vertex-triangle adjacency */
+    std::vector<UnsignedInt> liveTriangleCount, neighborOffset, neighbors;
+    {
+        std::vector<UnsignedInt> indicesCopy = indices;
+        Implementation::Tipsify{indicesCopy, vertexCount}.buildAdjacency(liveTriangleCount, neighborOffset, neighbors);
+    }
+
+    Meshlets out;
+    std::vector<bool> emitted(triangleCount);
+    std::vector<UnsignedInt> localIndex(vertexCount, NoVertex);
+    std::vector<UnsignedInt> candidates;
+    std::size_t nextSeed = 0;
+
+    Meshlet meshlet{};
+    Vector3 positionSum;
+    auto finishMeshlet = [&]() {
+        for(std::size_t i = 0; i != meshlet.vertexCount; ++i)
+            localIndex[out.vertices[meshlet.vertexOffset + i]] = NoVertex;
+        calculateBounds(meshlet, out, positions);
+        out.meshlets.push_back(meshlet);
+
+        meshlet = Meshlet{};
+        meshlet.vertexOffset = out.vertices.size();
+        meshlet.triangleOffset = out.triangles.size();
+        positionSum = {};
+        candidates.clear();
+    };
+
+    for(std::size_t remaining = triangleCount; remaining; --remaining) {
+        /* Adjacent triangle adding the least new vertices and, among those,
+           nearest to the meshlet centroid so the meshlet stays compact.
+           Already emitted triangles are removed from the candidate list. */
+        const Vector3 centroid = meshlet.vertexCount ? positionSum/Float(meshlet.vertexCount) : Vector3{};
+        std::size_t best = triangleCount;
+        UnsignedInt bestNewVertexCount = 4;
+        Float bestDistance = Constants::inf();
+        std::size_t candidateCount = 0;
+        for(const UnsignedInt candidate: candidates) {
+            if(emitted[candidate]) continue;
+            candidates[candidateCount++] = candidate;
+
+            UnsignedInt newVertexCount = 0;
+            for(std::size_t j = 0; j != 3; ++j)
+                if(localIndex[indices[candidate*3 + j]] == NoVertex) ++newVertexCount;
+            if(newVertexCount > bestNewVertexCount) continue;
+
+            const Float distance = (positions[indices[candidate*3]] +
+                positions[indices[candidate*3 + 1]] +
+                positions[indices[candidate*3 + 2]] - centroid*3.0f).dot();
+            if(newVertexCount < bestNewVertexCount || distance < bestDistance || (distance == bestDistance && candidate < best)) {
+                best = candidate;
+                bestNewVertexCount = newVertexCount;
+                bestDistance = distance;
+            }
+        }
+        candidates.resize(candidateCount);
+
+        /* No adjacent triangle, take the next one in the index buffer */
+        if(best == triangleCount) {
+            while(emitted[nextSeed]) ++nextSeed;
+            best = nextSeed;
+            bestNewVertexCount = 0;
+            for(std::size_t j = 0; j != 3; ++j)
+                if(localIndex[indices[best*3 + j]] == NoVertex) ++bestNewVertexCount;
+        }
+
+        /* The triangle doesn't fit, start a new meshlet with it */
+        if(meshlet.vertexCount + bestNewVertexCount > maxVertexCount || meshlet.triangleCount == maxTriangleCount)
+            finishMeshlet();
+
+        for(std::size_t j = 0; j != 3; ++j) {
+            const UnsignedInt vertex = indices[best*3 + j];
+            if(localIndex[vertex] == NoVertex) {
+                localIndex[vertex] = meshlet.vertexCount++;
+                out.vertices.push_back(vertex);
+                positionSum += positions[vertex];
+                for(std::size_t i = neighborOffset[vertex]; i != neighborOffset[vertex + 1]; ++i)
+                    if(!emitted[neighbors[i]]) candidates.push_back(neighbors[i]);
+            }
+            out.triangles.push_back(localIndex[vertex]);
+        }
+
+        emitted[best] = true;
+        ++meshlet.triangleCount;
+    }
+
+    if(meshlet.triangleCount) finishMeshlet();
+
+    return out;
+}
+
+std::vector<UnsignedInt> meshletIndices(const Meshlets& meshlets) {
+    std::vector<UnsignedInt> out(meshlets.triangles.size());
+    for(const Meshlet& meshlet: meshlets.meshlets)
+        for(std::size_t i = meshlet.triangleOffset, end = meshlet.triangleOffset + meshlet.triangleCount*3; i != end; ++i)
+            out[i] = meshlets.vertices[meshlet.vertexOffset + meshlets.triangles[i]];
+    return out;
+}
+
+}}
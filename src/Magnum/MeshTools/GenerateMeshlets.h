@@ -0,0 +1,184 @@
+#ifndef Magnum_MeshTools_GenerateMeshlets_h
+#define Magnum_MeshTools_GenerateMeshlets_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::generateMeshlets(), @ref Magnum::MeshTools::meshletIndices(), struct @ref Magnum::MeshTools::Meshlet, @ref Magnum::MeshTools::Meshlets
+ */
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Meshlet
+
+Small cluster of triangles with its own local vertex indices and bounds. See
+@ref generateMeshlets() for more information.
+@see @ref Meshlets
+*/
+struct Meshlet {
+    /** @brief Offset of the first vertex in @ref Meshlets::vertices */
+    UnsignedInt vertexOffset;
+
+    /** @brief Offset of the first triangle index in @ref Meshlets::triangles */
+    UnsignedInt triangleOffset;
+
+    /** @brief Vertex count */
+    UnsignedShort vertexCount;
+
+    /** @brief Triangle count */
+    UnsignedShort triangleCount;
+
+    /** @brief Bounding sphere center */
+    Vector3 center;
+
+    /** @brief Bounding sphere radius */
+    Float radius;
+
+    /**
+     * @brief Normal cone axis
+     *
+     * Average direction of all triangle normals.
+     */
+    Vector3 coneAxis;
+
+    /**
+     * @brief Normal cone cutoff
+     *
+     * Sine of the angle between @ref coneAxis and the most deviating
+     * triangle normal. If the deviation is @f$ 90 \degree @f$ or more, the
+     * value is @cpp 1.0f @ce and the meshlet is never backfacing.
+     */
+    Float coneCutoff;
+
+    /**
+     * @brief Whether the meshlet is backfacing
+     * @param cameraPosition    Camera position in the same coordinate system
+     *      as the meshlet
+     *
+     * Returns @cpp true @ce if all triangles of the meshlet are facing away
+     * from the camera and thus the whole meshlet can be skipped. The test is
+     * conservative. The cone is anchored at bounding sphere center, so the
+     * camera distance is offset by the sphere radius.
+     */
+    bool isBackfacing(const Vector3& cameraPosition) const {
+        const Vector3 direction = center - cameraPosition;
+        const Float distance = direction.length();
+        return Math::dot(direction, coneAxis) >= coneCutoff*distance + radius;
+    }
+};
+
+/**
+@brief Meshlets
+
+Contiguous storage of all meshlets of a mesh.
+@see @ref generateMeshlets()
+*/
+struct Meshlets {
+    /** @brief Meshlets */
+    std::vector<Meshlet> meshlets;
+
+    /**
+     * @brief Vertices
+     *
+     * Global vertex indices referenced by the meshlets, range belonging to
+     * each meshlet is defined by @ref Meshlet::vertexOffset and
+     * @ref Meshlet::vertexCount.
+     */
+    std::vector<UnsignedInt> vertices;
+
+    /**
+     * @brief Triangles
+     *
+     * Triangle indices into the meshlet-local part of @ref vertices, three
+     * for each triangle. Range belonging to each meshlet starts at
+     * @ref Meshlet::triangleOffset and contains three times
+     * @ref Meshlet::triangleCount indices.
+     */
+    std::vector<UnsignedByte> triangles;
+};
+
+/**
+@brief Split the mesh into meshlets
+@param indices          Triangle indices
+@param positions        Vertex positions
+@param maxVertexCount   Max vertex count in each meshlet, at most `256`
+@param maxTriangleCount Max triangle count in each meshlet
+@return Meshlets
+
+Splits large indexed mesh into clusters of at most @p maxVertexCount vertices
+and @p maxTriangleCount triangles. The default limits match the
+recommendations for mesh shaders, where each meshlet is processed by a single
+work group. Each meshlet is grown from a seed triangle by greedily adding
+triangles adjacent to its vertices, preferring triangles adding the least new
+vertices and then triangles nearest to the meshlet centroid. If there's no adjacent triangle left, the next triangle in the index
+buffer is used, so it's recommended to run @ref optimizeVertexCache() on the
+mesh first to keep the rest of the meshlet spatially close. All triangles
+are kept, including degenerate ones.
+
+Each meshlet has bounding sphere and normal cone calculated, which can be used
+to cull whole meshlets on the CPU --- use
+@ref Math::Geometry::Intersection::sphereFrustum() with @ref Meshlet::center
+and @ref Meshlet::radius for frustum culling and
+@ref Meshlet::isBackfacing() for backface culling. Triangles of the visible
+meshlets can be then gathered into the index buffer like this:
+@code
+MeshTools::Meshlets meshlets = MeshTools::generateMeshlets(indices, positions);
+
+std::vector<UnsignedInt> visibleIndices;
+for(const MeshTools::Meshlet& meshlet: meshlets.meshlets) {
+    if(meshlet.isBackfacing(cameraPosition)) continue;
+
+    for(std::size_t i = 0; i != meshlet.triangleCount*3; ++i)
+        visibleIndices.push_back(meshlets.vertices[meshlet.vertexOffset +
+            meshlets.triangles[meshlet.triangleOffset + i]]);
+}
+@endcode
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3.
+*/
+MAGNUM_MESHTOOLS_EXPORT Meshlets generateMeshlets(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, UnsignedInt maxVertexCount = 64, UnsignedInt maxTriangleCount = 124);
+
+/**
+@brief Global index buffer of all meshlets
+@param meshlets     Meshlets
+
+Expands the meshlet-local triangle indices back to indices into the original
+vertex data. The indices are laid out the same way as
+@ref Meshlets::triangles, thus the triangles of each meshlet start at
+@ref Meshlet::triangleOffset and can be drawn separately, for example using
+draw commands generated by @ref ComputeProcessor::cullMeshlets().
+*/
+MAGNUM_MESHTOOLS_EXPORT std::vector<UnsignedInt> meshletIndices(const Meshlets& meshlets);
+
+}}
+
+#endif
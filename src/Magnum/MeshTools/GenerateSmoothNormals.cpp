@@ -0,0 +1,94 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include "GenerateSmoothNormals.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Tipsify.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+Float cornerAngle(const Vector3& corner, const Vector3& a, const Vector3& b) {
+    return std::acos(Math::clamp(Math::dot((a - corner).normalized(), (b - corner).normalized()), -1.0f, 1.0f));
+}
+
+}
+
+std::vector<Vector3> generateSmoothNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, UnsignedInt threadCount) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::generateSmoothNormals(): index count is not divisible by 3", {});
+
+    if(!threadCount) threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    /* Normalized face normals, zero for degenerate faces (assuming
+       counterclockwise winding) */
+    std::vector<Vector3> faceNormals(indices.size()/3);
+    Magnum::Implementation::parallelFor(faceNormals.size(), threadCount, 1024, [&indices, &positions, &faceNormals](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            const Vector3 normal = Math::cross(
+                positions[indices[i*3 + 1]] - positions[indices[i*3]],
+                positions[indices[i*3 + 2]] - positions[indices[i*3]]);
+            const Float length = normal.length();
+            if(length != 0.0f) faceNormals[i] = normal/length;
+        }
+    });
+
+    /* Faces adjacent to each vertex. The adjacency building doesn't modify
+       the indices. */
+    std::vector<UnsignedInt> liveTriangleCount, neighborOffset, neighbors;
+    Implementation::Tipsify{const_cast<std::vector<UnsignedInt>&>(indices), UnsignedInt(positions.size())}.buildAdjacency(liveTriangleCount, neighborOffset, neighbors);
+
+    /* Sum angle-weighted normals of adjacent faces. Each vertex is written by
+       exactly one thread. */
+    std::vector<Vector3> normals(positions.size());
+    Magnum::Implementation::parallelFor(normals.size(), threadCount, 1024, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t vertex = begin; vertex != end; ++vertex) {
+            Vector3 normal;
+            for(std::size_t j = neighborOffset[vertex]; j != neighborOffset[vertex + 1]; ++j) {
+                const UnsignedInt face = neighbors[j];
+                if(faceNormals[face].isZero()) continue;
+
+                /* Find the corner of the face that is this vertex */
+                std::size_t corner = 0;
+                while(indices[face*3 + corner] != vertex) ++corner;
+                const Float angle = cornerAngle(positions[vertex],
+                    positions[indices[face*3 + (corner + 1)%3]],
+                    positions[indices[face*3 + (corner + 2)%3]]);
+                normal += faceNormals[face]*angle;
+            }
+
+            if(!normal.isZero()) normals[vertex] = normal.normalized();
+        }
+    });
+
+    return normals;
+}
+
+}}
@@ -0,0 +1,77 @@
+#ifndef Magnum_MeshTools_GenerateSmoothNormals_h
+#define Magnum_MeshTools_GenerateSmoothNormals_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+/** @file
+ * @brief Function @ref Magnum::MeshTools::generateSmoothNormals()
+ */
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Generate smooth normals
+@param indices      Array of triangle face indices
+@param positions    Array of vertex positions
+@param threadCount  Max count of threads to use from
+    @ref TaskScheduler::global(). If set to @cpp 0 @ce,
+    @ref std::thread::hardware_concurrency() is used.
+@return Normal for each vertex
+
+Unlike @ref generateFlatNormals(), the normals share the index array with
+positions, so there's no need to use @ref combineIndexedArrays() afterwards.
+Normal of each vertex is average of normals of all faces that reference it,
+weighted by the face angle at the vertex, which gives results independent of
+how the surface is triangulated. Degenerate faces don't contribute and
+vertices not referenced by any non-degenerate face get a zero normal. Example
+usage:
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+
+std::vector<Vector3> normals = MeshTools::generateSmoothNormals(indices, positions);
+@endcode
+
+Only faces sharing the same vertex index are smoothed together. Use
+@ref removeDuplicates() on the positions first if the mesh has the positions
+duplicated, otherwise the duplicates stay as hard edges.
+
+The function runs in linear time, using flat vertex-to-face adjacency array.
+Face normals are calculated in parallel over faces and vertex normals in
+parallel over vertices, so no synchronization is needed.
+
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3.
+@see @ref generateTangents()
+*/
+MAGNUM_MESHTOOLS_EXPORT std::vector<Vector3> generateSmoothNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, UnsignedInt threadCount = 1);
+
+}}
+
+#endif
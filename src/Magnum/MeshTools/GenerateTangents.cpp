@@ -0,0 +1,128 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include "GenerateTangents.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/MeshTools/Tipsify.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Face tangent and bitangent, unnormalized */
+struct FaceBasis {
+    Vector3 tangent, bitangent;
+    bool valid;
+};
+
+/* Any unit vector perpendicular to given one */
+Vector3 perpendicular(const Vector3& normal) {
+    const Vector3 axis = std::abs(normal.x()) < 0.9f ? Vector3::xAxis() : Vector3::yAxis();
+    return (axis - normal*Math::dot(axis, normal)).normalized();
+}
+
+}
+
+std::vector<Vector4> generateTangents(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const std::vector<Vector3>& normals, const std::vector<Vector2>& textureCoordinates, UnsignedInt threadCount) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::generateTangents(): index count is not divisible by 3", {});
+    CORRADE_ASSERT(normals.size() == positions.size() && textureCoordinates.size() == positions.size(),
+        "MeshTools::generateTangents(): expected" << positions.size() << "normals and texture coordinates but got" << normals.size() << "and" << textureCoordinates.size(), {});
+
+    if(!threadCount) threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    /* Tangent and bitangent of each face from texture coordinate
+       derivatives */
+    std::vector<FaceBasis> faces(indices.size()/3);
+    Magnum::Implementation::parallelFor(faces.size(), threadCount, 1024, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            const UnsignedInt a = indices[i*3], b = indices[i*3 + 1], c = indices[i*3 + 2];
+            const Vector3 e1 = positions[b] - positions[a];
+            const Vector3 e2 = positions[c] - positions[a];
+            const Vector2 t1 = textureCoordinates[b] - textureCoordinates[a];
+            const Vector2 t2 = textureCoordinates[c] - textureCoordinates[a];
+
+            const Float determinant = t1.x()*t2.y() - t2.x()*t1.y();
+            if(determinant == 0.0f || Math::cross(e1, e2).isZero()) {
+                faces[i].valid = false;
+                continue;
+            }
+
+            faces[i].tangent = (e1*t2.y() - e2*t1.y())/determinant;
+            faces[i].bitangent = (e2*t1.x() - e1*t2.x())/determinant;
+            faces[i].valid = true;
+        }
+    });
+
+    /* Faces adjacent to each vertex. The adjacency building doesn't modify
+       the indices. */
+    std::vector<UnsignedInt> liveTriangleCount, neighborOffset, neighbors;
+    Implementation::Tipsify{const_cast<std::vector<UnsignedInt>&>(indices), UnsignedInt(positions.size())}.buildAdjacency(liveTriangleCount, neighborOffset, neighbors);
+
+    std::vector<Vector4> tangents(positions.size());
+    Magnum::Implementation::parallelFor(tangents.size(), threadCount, 1024, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t vertex = begin; vertex != end; ++vertex) {
+            const Vector3& normal = normals[vertex];
+
+            /* Sum angle-weighted face tangents projected to the vertex
+               tangent plane */
+            Vector3 tangent, bitangent;
+            for(std::size_t j = neighborOffset[vertex]; j != neighborOffset[vertex + 1]; ++j) {
+                const UnsignedInt face = neighbors[j];
+                if(!faces[face].valid) continue;
+
+                std::size_t corner = 0;
+                while(indices[face*3 + corner] != vertex) ++corner;
+                const Vector3 a = (positions[indices[face*3 + (corner + 1)%3]] - positions[vertex]).normalized();
+                const Vector3 b = (positions[indices[face*3 + (corner + 2)%3]] - positions[vertex]).normalized();
+                const Float angle = std::acos(Math::clamp(Math::dot(a, b), -1.0f, 1.0f));
+
+                const Vector3 faceTangent = faces[face].tangent - normal*Math::dot(normal, faces[face].tangent);
+                const Vector3 faceBitangent = faces[face].bitangent - normal*Math::dot(normal, faces[face].bitangent);
+                if(!faceTangent.isZero()) tangent += faceTangent.normalized()*angle;
+                if(!faceBitangent.isZero()) bitangent += faceBitangent.normalized()*angle;
+            }
+
+            /* Gram-Schmidt once more, as the sum doesn't need to be
+               orthogonal for non-unit normals */
+            tangent -= normal*Math::dot(normal, tangent);
+            if(tangent.isZero()) {
+                tangents[vertex] = {perpendicular(normal), 1.0f};
+                continue;
+            }
+
+            tangent = tangent.normalized();
+            tangents[vertex] = {tangent, Math::dot(Math::cross(normal, tangent), bitangent) < 0.0f ? -1.0f : 1.0f};
+        }
+    });
+
+    return tangents;
+}
+
+}}
@@ -0,0 +1,84 @@
+#ifndef Magnum_MeshTools_GenerateTangents_h
+#define Magnum_MeshTools_GenerateTangents_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+/** @file
+ * @brief Function @ref Magnum::MeshTools::generateTangents()
+ */
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Generate tangents
+@param indices              Array of triangle face indices
+@param positions            Array of vertex positions
+@param normals              Array of vertex normals
+@param textureCoordinates   Array of vertex texture coordinates
+@param threadCount          Max count of threads to use from
+    @ref TaskScheduler::global(). If set to @cpp 0 @ce,
+    @ref std::thread::hardware_concurrency() is used.
+@return Tangent for each vertex
+
+Returns normalized tangent space basis for each vertex, sharing the index
+array with the other attributes. The XYZ components contain the tangent
+orthogonal to the vertex normal and the W component is sign of the
+bitangent, which can be then reconstructed as
+@code
+Vector3 bitangent = Math::cross(normal, tangent.xyz())*tangent.w();
+@endcode
+
+The calculation follows the MikkTSpace conventions --- tangent of each face
+is projected to the tangent plane of the vertex normal, normalized and then
+averaged over all adjacent faces, weighted by the face angle at the vertex.
+Unlike MikkTSpace the vertices are not split, so the result matches only for
+meshes that have the vertices already split on texture coordinate seams and
+mirrored parts, which is the case for most meshes exported with per-vertex
+tangents in mind. Faces with degenerate texture coordinates don't contribute,
+vertices without any contributing face get an arbitrary tangent orthogonal
+to the normal. Example usage:
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+std::vector<Vector2> textureCoordinates;
+
+std::vector<Vector3> normals = MeshTools::generateSmoothNormals(indices, positions);
+std::vector<Vector4> tangents = MeshTools::generateTangents(indices, positions, normals, textureCoordinates);
+@endcode
+
+The function runs in linear time the same way as @ref generateSmoothNormals().
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3. All attribute arrays are expected to have
+    the same size.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::vector<Vector4> generateTangents(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const std::vector<Vector3>& normals, const std::vector<Vector2>& textureCoordinates, UnsignedInt threadCount = 1);
+
+}}
+
+#endif
@@ -0,0 +1,76 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "JointMatrices.h"
+
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/Matrix4.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Composes the local transformations down the hierarchy in place. Returns
+   false if the joints are not ordered parent-first. */
+template<class T> bool composeHierarchy(const std::vector<Int>& parents, std::vector<T>& transformations) {
+    for(std::size_t i = 0; i != transformations.size(); ++i) {
+        const Int parent = parents[i];
+        if(parent == -1) continue;
+
+        CORRADE_ASSERT(parent >= 0 && std::size_t(parent) < i,
+            "MeshTools::jointMatrices(): parent" << parent << "of joint" << i << "is not before it", false);
+        transformations[i] = transformations[parent]*transformations[i];
+    }
+
+    return true;
+}
+
+}
+
+std::vector<Matrix4> jointMatrices(const std::vector<Int>& parents, const std::vector<Matrix4>& inverseBindMatrices, const std::vector<Matrix4>& localTransformations) {
+    CORRADE_ASSERT(inverseBindMatrices.size() == parents.size() && localTransformations.size() == parents.size(),
+        "MeshTools::jointMatrices(): expected" << parents.size() << "inverse bind matrices and transformations but got" << inverseBindMatrices.size() << "and" << localTransformations.size(), {});
+
+    std::vector<Matrix4> out = localTransformations;
+    if(!composeHierarchy(parents, out)) return {};
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = out[i]*inverseBindMatrices[i];
+    return out;
+}
+
+std::vector<Matrix4> jointMatrices(const std::vector<Int>& parents, const std::vector<Matrix4>& inverseBindMatrices, const std::vector<DualQuaternion>& localTransformations) {
+    CORRADE_ASSERT(inverseBindMatrices.size() == parents.size() && localTransformations.size() == parents.size(),
+        "MeshTools::jointMatrices(): expected" << parents.size() << "inverse bind matrices and transformations but got" << inverseBindMatrices.size() << "and" << localTransformations.size(), {});
+
+    std::vector<DualQuaternion> transformations = localTransformations;
+    if(!composeHierarchy(parents, transformations)) return {};
+
+    std::vector<Matrix4> out(transformations.size());
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = transformations[i].toMatrix()*inverseBindMatrices[i];
+    return out;
+}
+
+}}
@@ -0,0 +1,81 @@
+#ifndef Magnum_MeshTools_JointMatrices_h
+#define Magnum_MeshTools_JointMatrices_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+/** @file
+ * @brief Function @ref Magnum::MeshTools::jointMatrices()
+ */
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Calculate joint matrices for skinning
+@param parents              Parent joint ID for each joint or @cpp -1 @ce
+    for root joints
+@param inverseBindMatrices  Inverse bind matrix for each joint
+@param localTransformations Pose of each joint relative to its parent
+@return Skinning matrix for each joint
+
+Composes the local transformations along the hierarchy and multiplies each
+resulting joint transformation with its inverse bind matrix, so the vertices
+stay in place for the bind pose. The result is meant to be uploaded into a
+buffer and used with @ref Shaders::Phong::Flag::Skinning, the poses of many
+characters sharing the same skeleton can be calculated into consecutive ranges
+of a single buffer. Example usage:
+@code
+std::vector<Int> parents;
+std::vector<Matrix4> inverseBindMatrices;
+std::vector<Matrix4> pose = animation.at(time);
+
+std::vector<Matrix4> joints = MeshTools::jointMatrices(parents, inverseBindMatrices, pose);
+jointBuffer.setSubData(offset, joints);
+@endcode
+
+The function runs in linear time.
+@attention The parent of each joint is expected to have a smaller ID than the
+    joint itself, which is the case for skeletons exported in depth-first
+    order. All arrays are expected to have the same size.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::vector<Matrix4> jointMatrices(const std::vector<Int>& parents, const std::vector<Matrix4>& inverseBindMatrices, const std::vector<Matrix4>& localTransformations);
+
+/**
+@brief Calculate joint matrices for skinning from dual quaternions
+
+Same as @ref jointMatrices(const std::vector<Int>&, const std::vector<Matrix4>&, const std::vector<Matrix4>&),
+but the local transformations are rigid and specified as dual quaternions,
+which is the usual output of blending animation keyframes. The hierarchy is
+composed using dual quaternion multiplication and converted to matrices only
+at the end.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::vector<Matrix4> jointMatrices(const std::vector<Int>& parents, const std::vector<Matrix4>& inverseBindMatrices, const std::vector<DualQuaternion>& localTransformations);
+
+}}
+
+#endif
@@ -0,0 +1,163 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "OptimizeOverdraw.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* FIFO vertex cache simulation, same as in analyzeVertexCache() */
+class VertexCache {
+    public:
+        explicit VertexCache(std::size_t vertexCount, std::size_t cacheSize): _timestamp(vertexCount), _time(cacheSize + 1), _cacheSize(cacheSize) {}
+
+        /* Returns count of cache misses for given triangle */
+        UnsignedInt add(const UnsignedInt* triangle) {
+            UnsignedInt misses = 0;
+            for(std::size_t i = 0; i != 3; ++i) {
+                if(_time - _timestamp[triangle[i]] <= _cacheSize) continue;
+                _timestamp[triangle[i]] = _time++;
+                ++misses;
+            }
+            return misses;
+        }
+
+        /* Moving time forward makes everything a miss */
+        void flush() { _time += _cacheSize + 1; }
+
+    private:
+        std::vector<UnsignedInt> _timestamp;
+        UnsignedInt _time;
+        std::size_t _cacheSize;
+};
+
+}
+
+void optimizeOverdraw(std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const std::size_t cacheSize, const Float threshold) {
+    const std::size_t triangleCount = indices.size()/3;
+    if(!triangleCount) return;
+
+    /* Hard boundaries -- triangles where the cache got completely flushed.
+       Reordering the clusters there has no effect on the cache efficiency. */
+    std::vector<UnsignedInt> hardBoundaries{0};
+    {
+        VertexCache cache{positions.size(), cacheSize};
+        cache.add(indices.data());
+        for(std::size_t i = 1; i != triangleCount; ++i)
+            if(cache.add(indices.data() + i*3) == 3) hardBoundaries.push_back(i);
+    }
+    hardBoundaries.push_back(triangleCount);
+
+    /* Soft boundaries -- split each hard cluster further on places where the
+       running cache miss ratio is not worse than the threshold. Splitting
+       flushes the cache, since the next cluster may be drawn after anything
+       else. */
+    std::vector<UnsignedInt> clusters;
+    {
+        VertexCache cache{positions.size(), cacheSize};
+        for(std::size_t i = 0; i + 1 < hardBoundaries.size(); ++i) {
+            const std::size_t begin = hardBoundaries[i], end = hardBoundaries[i + 1];
+
+            cache.flush();
+            UnsignedInt clusterMisses = 0;
+            for(std::size_t j = begin; j != end; ++j)
+                clusterMisses += cache.add(indices.data() + j*3);
+            const Float maxRatio = threshold*Float(clusterMisses)/Float(end - begin);
+
+            cache.flush();
+            clusters.push_back(begin);
+            UnsignedInt misses = 0, count = 0;
+            for(std::size_t j = begin; j + 1 < end; ++j) {
+                misses += cache.add(indices.data() + j*3);
+                ++count;
+                if(Float(misses)/Float(count) <= maxRatio) {
+                    clusters.push_back(j + 1);
+                    cache.flush();
+                    misses = count = 0;
+                }
+            }
+        }
+    }
+    clusters.push_back(triangleCount);
+
+    /* Area-weighted centroid and normal of each cluster and of the whole
+       mesh */
+    const std::size_t clusterCount = clusters.size() - 1;
+    std::vector<Vector3> clusterCentroid(clusterCount), clusterNormal(clusterCount);
+    std::vector<Float> clusterArea(clusterCount);
+    Vector3 meshCentroid;
+    Float meshArea = 0.0f;
+    for(std::size_t i = 0; i != clusterCount; ++i) {
+        for(std::size_t j = clusters[i]; j != clusters[i + 1]; ++j) {
+            const Vector3& a = positions[indices[j*3]];
+            const Vector3& b = positions[indices[j*3 + 1]];
+            const Vector3& c = positions[indices[j*3 + 2]];
+            const Vector3 normal = Math::cross(b - a, c - a);
+            const Float area = normal.length();
+
+            clusterCentroid[i] += (a + b + c)*area/3.0f;
+            clusterNormal[i] += normal;
+            clusterArea[i] += area;
+        }
+
+        meshCentroid += clusterCentroid[i];
+        meshArea += clusterArea[i];
+    }
+    if(meshArea) meshCentroid /= meshArea;
+
+    /* Sort key of each cluster -- how much it faces outwards from the mesh
+       centroid */
+    std::vector<std::pair<Float, UnsignedInt>> order(clusterCount);
+    for(std::size_t i = 0; i != clusterCount; ++i) {
+        Float key = 0.0f;
+        const Float normalLength = clusterNormal[i].length();
+        if(clusterArea[i] && normalLength)
+            key = Math::dot(clusterCentroid[i]/clusterArea[i] - meshCentroid, clusterNormal[i]/normalLength);
+        order[i] = {key, UnsignedInt(i)};
+    }
+
+    /* Outward-facing clusters first, keep original order for equal keys to
+       not mess up flat meshes */
+    std::stable_sort(order.begin(), order.end(), [](const std::pair<Float, UnsignedInt>& a, const std::pair<Float, UnsignedInt>& b) {
+        return a.first > b.first;
+    });
+
+    std::vector<UnsignedInt> outputIndices;
+    outputIndices.reserve(indices.size());
+    for(const std::pair<Float, UnsignedInt>& cluster: order)
+        outputIndices.insert(outputIndices.end(), indices.begin() + clusters[cluster.second]*3, indices.begin() + clusters[cluster.second + 1]*3);
+
+    /* Swap original index buffer with optimized */
+    using std::swap;
+    swap(indices, outputIndices);
+}
+
+}}
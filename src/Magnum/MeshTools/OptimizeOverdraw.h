@@ -0,0 +1,70 @@
+#ifndef Magnum_MeshTools_OptimizeOverdraw_h
+#define Magnum_MeshTools_OptimizeOverdraw_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::optimizeOverdraw()
+ */
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Optimize the mesh for reduced overdraw
+@param[in,out] indices  Indices array to operate on
+@param[in] positions    Vertex positions
+@param[in] cacheSize    Post-transform vertex cache size
+@param[in] threshold    How much can the average cache miss ratio get worse
+
+Splits the triangles into clusters and reorders them so the clusters facing
+outwards from the mesh center are drawn first, as they are more likely to
+occlude the others from any view direction. Triangle order inside each
+cluster is preserved, so the index array is expected to be already optimized
+using @ref optimizeVertexCache() or @ref tipsify().
+
+Cluster boundaries are first put at places where the vertex cache is flushed
+(i.e., all three vertices of a triangle are transformed) and then each
+cluster is further split as long as the average cache miss ratio doesn't get
+worse by more than given @p threshold, thus value of `1.0` preserves the
+vertex cache efficiency, while higher values allow for smaller clusters and
+better overdraw reduction. Algorithm used: *Pedro V. Sander, Diego Nehab, and
+Joshua Barczak - Fast Triangle Reordering for Vertex Locality and Reduced
+Overdraw, SIGGRAPH 2007,
+http://gfx.cs.princeton.edu/pubs/Sander_2007_%3ETR/index.php*.
+
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3.
+@see @ref analyzeVertexCache()
+*/
+MAGNUM_MESHTOOLS_EXPORT void optimizeOverdraw(std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, std::size_t cacheSize, Float threshold = 1.05f);
+
+}}
+
+#endif
@@ -0,0 +1,180 @@
+/*
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "OptimizeVertexCache.h"
+
+#include <cmath>
+#include <utility>
+
+#include "Magnum/MeshTools/Tipsify.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Values recommended in the paper */
+constexpr Float CacheDecayPower = 1.5f;
+constexpr Float LastTriangleScore = 0.75f;
+constexpr Float ValenceBoostScale = 2.0f;
+constexpr Float ValenceBoostPower = 0.5f;
+
+Float vertexScore(const Int cachePosition, const UnsignedInt liveTriangleCount, const std::size_t cacheSize) {
+    /* No triangle to emit, the vertex is not interesting anymore */
+    if(!liveTriangleCount) return -1.0f;
+
+    Float score = 0.0f;
+    if(cachePosition >= 0) {
+        /* Vertices of the last triangle have fixed score, so the next
+           triangle isn't just the one sharing the last edge --- that's worse
+           for the cache in general */
+        if(cachePosition < 3) score = LastTriangleScore;
+        else score = std::pow(1.0f - Float(cachePosition - 3)/Float(cacheSize - 3), CacheDecayPower);
+    }
+
+    /* Boost vertices with only few triangles left, so they are not left
+       behind */
+    return score + ValenceBoostScale*std::pow(Float(liveTriangleCount), -ValenceBoostPower);
+}
+
+}
+
+void optimizeVertexCache(std::vector<UnsignedInt>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    const std::size_t triangleCount = indices.size()/3;
+
+    /* Neighboring triangles for each vertex, per-vertex live triangle count */
+    std::vector<UnsignedInt> liveTriangleCount, neighborOffset, neighbors;
+    Implementation::Tipsify{indices, vertexCount}.buildAdjacency(liveTriangleCount, neighborOffset, neighbors);
+
+    /* Initial vertex and triangle scores, nothing is in the cache */
+    std::vector<Int> cachePosition(vertexCount, -1);
+    std::vector<Float> score(vertexCount);
+    for(std::size_t i = 0; i != vertexCount; ++i)
+        score[i] = vertexScore(-1, liveTriangleCount[i], cacheSize);
+    std::vector<Float> triangleScore(triangleCount);
+    for(std::size_t i = 0; i != triangleCount; ++i)
+        triangleScore[i] = score[indices[i*3]] + score[indices[i*3 + 1]] + score[indices[i*3 + 2]];
+
+    /* Start with the best triangle overall */
+    UnsignedInt best = 0;
+    for(std::size_t i = 1; i < triangleCount; ++i)
+        if(triangleScore[i] > triangleScore[best]) best = i;
+
+    std::vector<bool> emitted(triangleCount);
+    std::vector<UnsignedInt> cache, newCache;
+    cache.reserve(cacheSize + 3);
+    newCache.reserve(cacheSize + 3);
+
+    std::vector<UnsignedInt> outputIndices;
+    outputIndices.reserve(indices.size());
+
+    /* Cursor for finding next triangle on dead end */
+    std::size_t deadEndCursor = 0;
+    for(std::size_t emittedCount = 0; emittedCount != triangleCount; ++emittedCount) {
+        /* No triangle with vertices in the cache left, take next non-emitted
+           in original order. The cursor goes only forward, so all dead-ends
+           together are processed in linear time. */
+        if(best == 0xFFFFFFFFu) {
+            while(emitted[deadEndCursor]) ++deadEndCursor;
+            best = deadEndCursor;
+        }
+
+        /* Emit the triangle and put its vertices at the front of the cache */
+        emitted[best] = true;
+        newCache.clear();
+        for(std::size_t i = 0; i != 3; ++i) {
+            const UnsignedInt v = indices[best*3 + i];
+            outputIndices.push_back(v);
+            --liveTriangleCount[v];
+
+            /* The triangle might be degenerate */
+            if(cachePosition[v] != -2) {
+                newCache.push_back(v);
+                cachePosition[v] = -2;
+            }
+        }
+
+        /* Then the rest of the cache. Temporarily mark everything already in
+           the new cache with -2 to skip duplicates. */
+        for(const UnsignedInt v: cache) if(cachePosition[v] != -2) {
+            newCache.push_back(v);
+            cachePosition[v] = -2;
+        }
+
+        /* Update cache positions and scores of all touched vertices, the
+           ones that fell out of the cache are no longer in it */
+        for(std::size_t i = 0; i != newCache.size(); ++i) {
+            const UnsignedInt v = newCache[i];
+            cachePosition[v] = i < cacheSize ? Int(i) : -1;
+            score[v] = vertexScore(cachePosition[v], liveTriangleCount[v], cacheSize);
+        }
+
+        /* Update scores of all live triangles of the touched vertices and
+           pick the best of them as the next one */
+        best = 0xFFFFFFFFu;
+        Float bestScore = -1.0f;
+        for(const UnsignedInt v: newCache) {
+            for(std::size_t i = neighborOffset[v]; i != neighborOffset[v + 1]; ++i) {
+                const UnsignedInt t = neighbors[i];
+                if(emitted[t]) continue;
+
+                triangleScore[t] = score[indices[t*3]] + score[indices[t*3 + 1]] + score[indices[t*3 + 2]];
+                if(triangleScore[t] > bestScore) {
+                    best = t;
+                    bestScore = triangleScore[t];
+                }
+            }
+        }
+
+        /* Vertices that fell out won't be used in the next iteration */
+        if(newCache.size() > cacheSize) newCache.resize(cacheSize);
+        std::swap(cache, newCache);
+    }
+
+    /* Swap original index buffer with optimized */
+    using std::swap;
+    swap(indices, outputIndices);
+}
+
+VertexCacheStatistics analyzeVertexCache(const std::vector<UnsignedInt>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    /* FIFO cache -- a vertex is in the cache if there wasn't more than
+       cacheSize misses since it was put there */
+    std::vector<UnsignedInt> timestamp(vertexCount);
+    std::vector<bool> referenced(vertexCount);
+    UnsignedInt time = cacheSize + 1;
+    UnsignedInt referencedCount = 0;
+    for(const UnsignedInt v: indices) {
+        if(!referenced[v]) {
+            referenced[v] = true;
+            ++referencedCount;
+        }
+
+        if(time - timestamp[v] > cacheSize) timestamp[v] = time++;
+    }
+
+    const UnsignedInt transformedVertexCount = time - cacheSize - 1;
+    return {transformedVertexCount,
+        indices.empty() ? 0.0f : Float(transformedVertexCount)*3.0f/Float(indices.size()),
+        referencedCount ? Float(transformedVertexCount)/Float(referencedCount) : 0.0f};
+}
+
+}}
@@ -0,0 +1,114 @@
+#ifndef Magnum_MeshTools_OptimizeVertexCache_h
+#define Magnum_MeshTools_OptimizeVertexCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::optimizeVertexCache(), @ref Magnum::MeshTools::analyzeVertexCache(), struct @ref Magnum::MeshTools::VertexCacheStatistics
+ */
+
+#include <vector>
+
+#include "Magnum/Types.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Optimize the mesh for post-transform vertex cache
+@param[in,out] indices  Indices array to operate on
+@param[in] vertexCount  Vertex count
+@param[in] cacheSize    Modelled post-transform vertex cache size
+
+Rearranges the index array for better usage of post-transform vertex cache,
+similarly to @ref tipsify(). Triangles are emitted greedily based on score of
+their vertices, which is higher for vertices that were recently used and for
+vertices with only few remaining triangles, so isolated triangles are not left
+behind. The algorithm runs in linear time. Compared to @ref tipsify() it's
+slower, but the result doesn't depend much on the actual cache size of the
+hardware, which makes it a better choice when the target hardware is not
+known. The results can be measured using @ref analyzeVertexCache(). Algorithm
+used: *Tom Forsyth --- Linear-Speed
+Vertex Cache Optimisation, 2006,
+https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html*.
+
+The scoring models an LRU cache, while the real hardware caches are usually
+smaller and FIFO, but the result is good for both. Cache size of `32` is the
+value recommended by the author, there's no need to match the size of a
+particular hardware. Follow with @ref optimizeOverdraw() and
+@ref optimizeVertexFetch() for best results.
+
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3.
+*/
+MAGNUM_MESHTOOLS_EXPORT void optimizeVertexCache(std::vector<UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize = 32);
+
+/**
+@brief Vertex cache statistics
+
+@see @ref analyzeVertexCache()
+*/
+struct VertexCacheStatistics {
+    /** @brief Count of transformed vertices, i.e. cache misses */
+    UnsignedInt transformedVertexCount;
+
+    /**
+     * @brief Average cache miss ratio
+     *
+     * Count of transformed vertices divided by triangle count. The value is
+     * between `3.0` (every vertex is transformed for each triangle) and
+     * approximately `0.5` (theoretical minimum for large regular meshes).
+     */
+    Float acmr;
+
+    /**
+     * @brief Average transformed vertex ratio
+     *
+     * Count of transformed vertices divided by count of vertices referenced
+     * by the index array. The ideal value is `1.0`, which means every vertex
+     * is transformed only once. Unlike @ref acmr, the value doesn't depend on
+     * mesh topology, so it can be compared across different meshes.
+     */
+    Float atvr;
+};
+
+/**
+@brief Analyze post-transform vertex cache usage
+@param indices      Triangle indices
+@param vertexCount  Vertex count
+@param cacheSize    Post-transform vertex cache size
+
+Simulates FIFO post-transform vertex cache of given size, which is the model
+used by most hardware. Useful for measuring the effect of
+@ref optimizeVertexCache() or @ref tipsify().
+
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3.
+*/
+MAGNUM_MESHTOOLS_EXPORT VertexCacheStatistics analyzeVertexCache(const std::vector<UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize);
+
+}}
+
+#endif
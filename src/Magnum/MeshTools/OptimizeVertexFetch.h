@@ -0,0 +1,68 @@
+#ifndef Magnum_MeshTools_OptimizeVertexFetch_h
+#define Magnum_MeshTools_OptimizeVertexFetch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::optimizeVertexFetch()
+ */
+
+#include <vector>
+
+#include "Magnum/Types.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Optimize the mesh for pre-transform vertex fetch
+@param[in,out] indices  Indices array to operate on
+@param[in] vertexCount  Vertex count
+@return Vertex order
+
+Renumbers the vertices in order in which they are first referenced by the
+index array, so the vertex data are fetched from memory as sequentially as
+possible. Vertices that are not referenced by any index are removed. The
+returned array contains original vertex index for each new vertex, use it
+with @ref duplicate() to reorder all vertex attributes accordingly:
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+std::vector<Vector2> textureCoordinates;
+
+const std::vector<UnsignedInt> order = MeshTools::optimizeVertexFetch(indices, positions.size());
+positions = MeshTools::duplicate(order, positions);
+textureCoordinates = MeshTools::duplicate(order, textureCoordinates);
+@endcode
+
+As the result depends on triangle order, call this function as the last
+step, after @ref optimizeVertexCache() or @ref tipsify() and
+@ref optimizeOverdraw().
+*/
+MAGNUM_MESHTOOLS_EXPORT std::vector<UnsignedInt> optimizeVertexFetch(std::vector<UnsignedInt>& indices, UnsignedInt vertexCount);
+
+}}
+
+#endif
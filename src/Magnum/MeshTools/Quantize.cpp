@@ -0,0 +1,200 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include "Quantize.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+Vector2 octahedralEncode(const Vector3& normal) {
+    Vector2 p = normal.xy()/(std::abs(normal.x()) + std::abs(normal.y()) + std::abs(normal.z()));
+    if(normal.z() < 0.0f) p = Vector2{
+        (1.0f - std::abs(p.y()))*(p.x() >= 0.0f ? 1.0f : -1.0f),
+        (1.0f - std::abs(p.x()))*(p.y() >= 0.0f ? 1.0f : -1.0f)};
+    return p;
+}
+
+template<class T> void writeAttribute(Containers::Array<char>& data, const std::vector<T>& attribute, const std::size_t offset, const std::size_t stride) {
+    for(std::size_t i = 0; i != attribute.size(); ++i)
+        std::memcpy(data + offset + i*stride, &attribute[i], sizeof(T));
+}
+
+template<class T> Containers::Array<char> packIndices(const std::vector<UnsignedInt>& indices) {
+    Containers::Array<char> out{Containers::ValueInit, indices.size()*sizeof(T)};
+    for(std::size_t i = 0; i != indices.size(); ++i) {
+        const T index = T(indices[i]);
+        std::memcpy(out + i*sizeof(T), &index, sizeof(T));
+    }
+    return out;
+}
+
+}
+
+std::pair<std::vector<Math::Vector3<Short>>, Matrix4> quantizePositions(const std::vector<Vector3>& positions) {
+    if(positions.empty()) return {};
+
+    Vector3 min{positions.front()}, max{positions.front()};
+    for(const Vector3& position: positions) {
+        min = Math::min(min, position);
+        max = Math::max(max, position);
+    }
+
+    const Vector3 center = (min + max)*0.5f;
+    Vector3 halfSize = (max - min)*0.5f;
+    for(std::size_t i = 0; i != 3; ++i)
+        if(halfSize[i] == 0.0f) halfSize[i] = 1.0f;
+
+    std::vector<Math::Vector3<Short>> out;
+    out.reserve(positions.size());
+    for(const Vector3& position: positions) {
+        const Vector3 normalized = (position - center)/halfSize;
+        out.emplace_back(Math::packNormalized<Short>(normalized.x()),
+                         Math::packNormalized<Short>(normalized.y()),
+                         Math::packNormalized<Short>(normalized.z()));
+    }
+
+    return {std::move(out), Matrix4::translation(center)*Matrix4::scaling(halfSize)};
+}
+
+std::vector<UnsignedInt> quantizeNormals(const std::vector<Vector3>& normals) {
+    std::vector<UnsignedInt> out;
+    out.reserve(normals.size());
+    for(const Vector3& normal: normals)
+        out.push_back(Math::packInt2101010Rev({normal, 0.0f}));
+    return out;
+}
+
+std::vector<Math::Vector2<Short>> quantizeNormalsOctahedral(const std::vector<Vector3>& normals) {
+    std::vector<Math::Vector2<Short>> out;
+    out.reserve(normals.size());
+    for(const Vector3& normal: normals) {
+        const Vector2 encoded = octahedralEncode(normal);
+        out.emplace_back(Math::packNormalized<Short>(encoded.x()),
+                         Math::packNormalized<Short>(encoded.y()));
+    }
+    return out;
+}
+
+std::vector<Math::Vector2<UnsignedShort>> quantizeTextureCoordinates(const std::vector<Vector2>& textureCoordinates) {
+    std::vector<Math::Vector2<UnsignedShort>> out;
+    out.reserve(textureCoordinates.size());
+    for(const Vector2& textureCoordinate: textureCoordinates)
+        out.emplace_back(Math::packNormalized<UnsignedShort>(textureCoordinate.x()),
+                         Math::packNormalized<UnsignedShort>(textureCoordinate.y()));
+    return out;
+}
+
+std::vector<Math::Vector2<UnsignedShort>> quantizeTextureCoordinatesHalf(const std::vector<Vector2>& textureCoordinates) {
+    std::vector<Math::Vector2<UnsignedShort>> out;
+    out.reserve(textureCoordinates.size());
+    for(const Vector2& textureCoordinate: textureCoordinates)
+        out.emplace_back(Math::packHalf(textureCoordinate.x()),
+                         Math::packHalf(textureCoordinate.y()));
+    return out;
+}
+
+std::pair<Trade::MeshData, Matrix4> interleaveQuantized(const Trade::MeshData3D& meshData, const QuantizeFlags flags) {
+    const std::vector<Vector3>& positions = meshData.positions(0);
+    const UnsignedInt vertexCount = positions.size();
+
+    /* Calculate the layout, all attributes are four-byte aligned */
+    std::vector<Trade::MeshAttributeData> attributes;
+    std::size_t stride = 8;
+    std::size_t normalOffset{}, textureCoordinateOffset{};
+    if(meshData.hasNormals()) {
+        normalOffset = stride;
+        stride += 4;
+    }
+    if(meshData.hasTextureCoords2D()) {
+        textureCoordinateOffset = stride;
+        stride += 4;
+    }
+
+    Containers::Array<char> vertexData{Containers::ValueInit, vertexCount*stride};
+
+    std::pair<std::vector<Math::Vector3<Short>>, Matrix4> quantizedPositions = quantizePositions(positions);
+    writeAttribute(vertexData, quantizedPositions.first, 0, stride);
+    attributes.emplace_back(Trade::MeshAttribute::Position, Trade::MeshAttributeType::Short, 3, 0, stride, true);
+
+    if(meshData.hasNormals()) {
+        if(flags & QuantizeFlag::OctahedralNormals) {
+            writeAttribute(vertexData, quantizeNormalsOctahedral(meshData.normals(0)), normalOffset, stride);
+            attributes.emplace_back(Trade::MeshAttribute::Normal, Trade::MeshAttributeType::Short, 2, normalOffset, stride, true);
+        } else {
+            std::vector<Math::Vector3<Byte>> normals;
+            normals.reserve(vertexCount);
+            for(const Vector3& normal: meshData.normals(0))
+                normals.emplace_back(Math::packNormalized<Byte>(normal.x()),
+                                     Math::packNormalized<Byte>(normal.y()),
+                                     Math::packNormalized<Byte>(normal.z()));
+            writeAttribute(vertexData, normals, normalOffset, stride);
+            attributes.emplace_back(Trade::MeshAttribute::Normal, Trade::MeshAttributeType::Byte, 3, normalOffset, stride, true);
+        }
+    }
+
+    if(meshData.hasTextureCoords2D()) {
+        if(flags & QuantizeFlag::NormalizedTextureCoordinates) {
+            writeAttribute(vertexData, quantizeTextureCoordinates(meshData.textureCoords2D(0)), textureCoordinateOffset, stride);
+            attributes.emplace_back(Trade::MeshAttribute::TextureCoordinates, Trade::MeshAttributeType::UnsignedShort, 2, textureCoordinateOffset, stride, true);
+        } else {
+            writeAttribute(vertexData, quantizeTextureCoordinatesHalf(meshData.textureCoords2D(0)), textureCoordinateOffset, stride);
+            attributes.emplace_back(Trade::MeshAttribute::TextureCoordinates, Trade::MeshAttributeType::HalfFloat, 2, textureCoordinateOffset, stride);
+        }
+    }
+
+    if(!meshData.isIndexed())
+        return {Trade::MeshData{meshData.primitive(), std::move(vertexData), std::move(attributes), vertexCount}, quantizedPositions.second};
+
+    /* Store the indices in the smallest possible type */
+    const std::vector<UnsignedInt>& indices = meshData.indices();
+    const UnsignedInt maxIndex = indices.empty() ? 0 : *std::max_element(indices.begin(), indices.end());
+    Trade::MeshIndexType indexType;
+    Containers::Array<char> indexData;
+    if(maxIndex <= 0xff) {
+        indexType = Trade::MeshIndexType::UnsignedByte;
+        indexData = packIndices<UnsignedByte>(indices);
+    } else if(maxIndex <= 0xffff) {
+        indexType = Trade::MeshIndexType::UnsignedShort;
+        indexData = packIndices<UnsignedShort>(indices);
+    } else {
+        indexType = Trade::MeshIndexType::UnsignedInt;
+        indexData = packIndices<UnsignedInt>(indices);
+    }
+
+    return {Trade::MeshData{meshData.primitive(), indexType, std::move(indexData), std::move(vertexData), std::move(attributes), vertexCount}, quantizedPositions.second};
+}
+
+}}
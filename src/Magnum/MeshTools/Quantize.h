@@ -0,0 +1,159 @@
+#ifndef Magnum_MeshTools_Quantize_h
+#define Magnum_MeshTools_Quantize_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+/** @file
+ * @brief Function @ref Magnum::MeshTools::quantizePositions(), @ref Magnum::MeshTools::quantizeNormals(), @ref Magnum::MeshTools::quantizeNormalsOctahedral(), @ref Magnum::MeshTools::quantizeTextureCoordinates(), @ref Magnum::MeshTools::quantizeTextureCoordinatesHalf(), @ref Magnum::MeshTools::interleaveQuantized()
+ */
+
+#include <utility>
+#include <vector>
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Quantize positions
+
+Maps the positions from their bounding box to the full range of normalized
+signed shorts. Returns the quantized positions and a dequantization matrix,
+which converts the normalized positions back to the original space. Pass the
+positions to the shader as normalized @ref Magnum::Short "Short" attribute
+and multiply the transformation matrix with the returned matrix. Normal matrix
+should be still calculated from the original transformation, as the
+dequantization matrix has non-uniform scaling. Zero-size extents are mapped to
+unit size to avoid division by zero, for empty input the matrix is identity.
+@see @ref interleaveQuantized(), @ref Attribute::DataOption::Normalized
+*/
+MAGNUM_MESHTOOLS_EXPORT std::pair<std::vector<Math::Vector3<Short>>, Matrix4> quantizePositions(const std::vector<Vector3>& positions);
+
+/**
+@brief Quantize normals to packed 10-10-10-2 format
+
+Packs each normalized normal into one @ref Magnum::UnsignedInt "UnsignedInt"
+with X in the lowest ten bits, followed by Y and Z, each being signed
+normalized ten-bit value. The two highest bits are zero. The layout matches
+@ref Attribute::DataType::Int2101010Rev with four components, so the data can
+be used with four-component normal attribute:
+@code
+Attribute<Shaders::Phong::Normal::Location, Vector4> normal{
+    Attribute<Shaders::Phong::Normal::Location, Vector4>::DataType::Int2101010Rev,
+    Attribute<Shaders::Phong::Normal::Location, Vector4>::DataOption::Normalized};
+@endcode
+@see @ref quantizeNormalsOctahedral()
+*/
+MAGNUM_MESHTOOLS_EXPORT std::vector<UnsignedInt> quantizeNormals(const std::vector<Vector3>& normals);
+
+/**
+@brief Quantize normals using octahedral encoding
+
+Projects each normalized normal onto an octahedron, unfolds it into a square
+and stores the result in two normalized signed shorts. The data can be used
+with @ref Shaders::Phong::OctahedralNormal attribute together with
+@ref Shaders::Phong::Flag::OctahedralNormals, which decodes them back in the
+vertex shader. The maximal angular error is below @f$ 0.01 \degree @f$.
+@see @ref quantizeNormals()
+*/
+MAGNUM_MESHTOOLS_EXPORT std::vector<Math::Vector2<Short>> quantizeNormalsOctahedral(const std::vector<Vector3>& normals);
+
+/**
+@brief Quantize texture coordinates to normalized unsigned shorts
+
+Coordinates outside of the @f$ [0, 1] @f$ range are clamped, use
+@ref quantizeTextureCoordinatesHalf() for repeated textures.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::vector<Math::Vector2<UnsignedShort>> quantizeTextureCoordinates(const std::vector<Vector2>& textureCoordinates);
+
+/**
+@brief Quantize texture coordinates to half-floats
+
+Returns the coordinates as bit representation of half-floats, rounded to
+nearest even. Values out of half-float range are converted to infinity. The
+data can be used with @ref Attribute::DataType::HalfFloat.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::vector<Math::Vector2<UnsignedShort>> quantizeTextureCoordinatesHalf(const std::vector<Vector2>& textureCoordinates);
+
+/**
+@brief Quantization flag
+
+@see @ref QuantizeFlags, @ref interleaveQuantized()
+*/
+enum class QuantizeFlag: UnsignedByte {
+    /**
+     * Store normals in octahedral encoding using two normalized signed
+     * shorts instead of three normalized signed bytes. More precise, but
+     * needs @ref Shaders::Phong::Flag::OctahedralNormals in the shader.
+     */
+    OctahedralNormals = 1 << 0,
+
+    /**
+     * Store texture coordinates as normalized unsigned shorts instead of
+     * half-floats. More precise, but the coordinates are clamped to
+     * @f$ [0, 1] @f$ range.
+     */
+    NormalizedTextureCoordinates = 1 << 1
+};
+
+/**
+@brief Quantization flags
+
+@see @ref interleaveQuantized()
+*/
+typedef Containers::EnumSet<QuantizeFlag> QuantizeFlags;
+
+CORRADE_ENUMSET_OPERATORS(QuantizeFlags)
+
+/**
+@brief Interleave quantized mesh data
+
+Quantizes first position, normal and texture coordinate array of given mesh
+and interleaves them into one buffer with four-byte aligned attributes:
+
+-   position as three normalized signed shorts with two bytes of padding,
+    see @ref quantizePositions()
+-   normal, if present, as three normalized signed bytes with one byte of
+    padding or, with @ref QuantizeFlag::OctahedralNormals, as two normalized
+    signed shorts, see @ref quantizeNormalsOctahedral()
+-   texture coordinates, if present, as two half-floats or, with
+    @ref QuantizeFlag::NormalizedTextureCoordinates, as two normalized
+    unsigned shorts, see @ref quantizeTextureCoordinatesHalf() and
+    @ref quantizeTextureCoordinates()
+
+Compared to floating-point data the vertex size is reduced from 32 to 16
+bytes. Indices, if present, are stored in the smallest type that can hold
+them. Returns the mesh data and dequantization matrix for the positions, the
+mesh data can be directly passed to @ref compile(const Trade::MeshData&, BufferUsage).
+@see @ref interleave()
+*/
+MAGNUM_MESHTOOLS_EXPORT std::pair<Trade::MeshData, Matrix4> interleaveQuantized(const Trade::MeshData3D& meshData, QuantizeFlags flags = {});
+
+}}
+
+#endif
@@ -29,39 +29,147 @@
  * @brief Function @ref Magnum::MeshTools::removeDuplicates()
  */
 
+#include <algorithm>
 #include <limits>
-#include <numeric>
-#include <unordered_map>
+#include <thread>
 #include <vector>
-#include <Corrade/Utility/MurmurHash2.h>
 
 #include "Magnum/Magnum.h"
 #include "Magnum/Math/Functions.h"
 
+#if !defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(CORRADE_TARGET_NACL)
+#include "Magnum/TaskScheduler.h"
+#endif
+
 namespace Magnum { namespace MeshTools {
 
 namespace Implementation {
-    template<std::size_t size> class VectorHash {
+    /* Open-addressing hash table of grid cells, each cell has a linked list
+       of unique vectors inside it */
+    template<std::size_t size> class DuplicateGrid {
         public:
-            std::size_t operator()(const Math::Vector<size, std::size_t>& data) const {
-                return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2()(reinterpret_cast<const char*>(&data), sizeof(data)).byteArray());
+            typedef Math::Vector<size, Long> Cell;
+
+            enum: UnsignedInt { Empty = ~UnsignedInt{} };
+
+            /* Load factor is at most 0.5 as there's never more non-empty
+               cells than inserted vectors */
+            explicit DuplicateGrid(std::size_t capacity) {
+                std::size_t tableSize = 16;
+                while(tableSize < capacity*2) tableSize *= 2;
+                _cells.resize(tableSize);
+                _heads.resize(tableSize, Empty);
+                _nodes.reserve(capacity);
+            }
+
+            /* Slot containing given cell or empty slot where it belongs */
+            std::size_t slot(const Cell& cell) const {
+                UnsignedLong hash = 0;
+                for(std::size_t i = 0; i != size; ++i)
+                    hash = (hash ^ UnsignedLong(cell[i]))*0x9e3779b97f4a7c15ull;
+                hash ^= hash >> 32;
+
+                const std::size_t mask = _heads.size() - 1;
+                std::size_t slot = std::size_t(hash) & mask;
+                while(_heads[slot] != Empty && _cells[slot] != cell)
+                    slot = (slot + 1) & mask;
+                return slot;
+            }
+
+            /* Lowest vector index in given cell matching the predicate or
+               Empty */
+            template<class F> UnsignedInt find(const Cell& cell, UnsignedInt found, F matches) const {
+                for(UnsignedInt node = _heads[slot(cell)]; node != Empty; node = _nodes[node].next)
+                    if(_nodes[node].index < found && matches(_nodes[node].index))
+                        found = _nodes[node].index;
+                return found;
             }
+
+            void insert(const Cell& cell, UnsignedInt index) {
+                const std::size_t slot = this->slot(cell);
+                _cells[slot] = cell;
+                _nodes.push_back({index, _heads[slot]});
+                _heads[slot] = _nodes.size() - 1;
+            }
+
+        private:
+            struct Node {
+                UnsignedInt index, next;
+            };
+
+            std::vector<Cell> _cells;
+            std::vector<UnsignedInt> _heads;
+            std::vector<Node> _nodes;
     };
+
+    /* Welds data[i] against all vectors already in the grid. With cell size
+       of 2*epsilon everything nearer than epsilon lies either in the vector's
+       own cell or in the neighbor on the nearer side, so only 2^size cells
+       need to be probed. Returns index of the representative, inserting the
+       vector into the grid if it's unique. */
+    template<class Vector> UnsignedInt weld(DuplicateGrid<Vector::Size>& grid, const std::vector<Vector>& data, const std::size_t i, const Vector& min, const Double cellSize, const typename Vector::Type epsilon) {
+        typename DuplicateGrid<Vector::Size>::Cell cell, direction;
+        for(std::size_t j = 0; j != Vector::Size; ++j) {
+            const Double position = Double(data[i][j] - min[j])/cellSize;
+            cell[j] = Long(position);
+            direction[j] = position - Double(cell[j]) < 0.5 ? -1 : 1;
+        }
+
+        const Vector& v = data[i];
+        auto matches = [&](UnsignedInt candidate) {
+            for(std::size_t j = 0; j != Vector::Size; ++j) {
+                const typename Vector::Type distance = Math::abs(data[candidate][j] - v[j]);
+                if(distance >= epsilon && distance != typename Vector::Type(0)) return false;
+            }
+            return true;
+        };
+
+        UnsignedInt found = DuplicateGrid<Vector::Size>::Empty;
+        for(std::size_t neighbor = 0; neighbor != (std::size_t(1) << Vector::Size); ++neighbor) {
+            typename DuplicateGrid<Vector::Size>::Cell probe = cell;
+            for(std::size_t j = 0; j != Vector::Size; ++j)
+                if(neighbor & (std::size_t(1) << j)) probe[j] += direction[j];
+            found = grid.find(probe, found, matches);
+        }
+
+        if(found != DuplicateGrid<Vector::Size>::Empty) return found;
+        grid.insert(cell, UnsignedInt(i));
+        return UnsignedInt(i);
+    }
 }
 
 /**
 @brief Remove duplicate floating-point vector data from given array
 @param[in,out] data Input data array
-@param[out] epsilon Epsilon value, vertices nearer than this distance will be
-    melt together
+@param[in] epsilon  Epsilon value, vertices nearer than this distance in each
+    component will be melt together
+@param[in] threadCount Max count of threads to use from
+    @ref TaskScheduler::global(). If set to @cpp 0 @ce,
+    @ref std::thread::hardware_concurrency() is used.
 @return Index array and unique data
 
-Removes duplicate data from the array by collapsing them into buckets of size
-@p epsilon. First vector in given bucket is used, other ones are thrown away,
-no interpolation is done. Note that this function is meant to be used for
+Removes duplicate data from the array. First occurence of each vector is kept,
+all vectors nearer than @p epsilon to it (in each component) are removed and
+mapped to it, no interpolation is done. The resulting unique data are in order
+of their first occurence. Note that this function is meant to be used for
 floating-point data (or generally with non-zero @p epsilon), for discrete data
 the usual sorting method is much more efficient.
 
+The vectors are put into an open-addressing hash grid with cell size of
+@cpp 2*epsilon @ce, so a single pass probing the @f$ 2^n @f$ cells adjacent to
+the vector is enough to find all its duplicates. Input data are thus processed
+in linear time, however the function gets impractical for vectors with many
+components.
+
+If @p threadCount is larger than @cpp 1 @ce, the input is split into chunks
+which are welded independently in parallel and then the unique vectors of each
+chunk are welded together in order. The merge step is done serially, so the
+parallel version scales well only if there are many duplicates in the data,
+which is the common case for triangle soups. If the data contain chains of
+vectors with distance to each other less than @p epsilon, the result may
+differ from the serial version, as the representative vector may be chosen
+differently.
+
 If you want to remove duplicate data from already indexed array, first remove
 duplicates as if the array wasn't indexed at all and then use @ref duplicate()
 to combine the two index arrays:
@@ -89,7 +197,9 @@ std::vector<UnsignedInt> indices = MeshTools::combineIndexedArrays(
 );
 @endcode
 */
-template<class Vector> std::vector<UnsignedInt> removeDuplicates(std::vector<Vector>& data, typename Vector::Type epsilon = Math::TypeTraits<typename Vector::Type>::epsilon()) {
+template<class Vector> std::vector<UnsignedInt> removeDuplicates(std::vector<Vector>& data, typename Vector::Type epsilon = Math::TypeTraits<typename Vector::Type>::epsilon(), UnsignedInt threadCount = 1) {
+    if(data.empty()) return {};
+
     /* Get bounds */
     Vector min = data[0], max = data[0];
     for(const auto& v: data) {
@@ -97,60 +207,68 @@ template<class Vector> std::vector<UnsignedInt> removeDuplicates(std::vector<Vec
         max = Math::max(v, max);
     }
 
-    /* Make epsilon so large that std::size_t can index all vectors inside the
-       bounds. */
-    epsilon = Math::max(epsilon, typename Vector::Type((max-min).max()/std::numeric_limits<std::size_t>::max()));
+    /* Make the cells so large that Long can index all vectors inside the
+       bounds */
+    Double cellSize = Math::max(2.0*Double(epsilon), Double((max-min).max())/Double(std::numeric_limits<Long>::max()/2));
+    if(cellSize == 0.0) cellSize = 1.0;
 
-    /* Resulting index array */
-    std::vector<UnsignedInt> resultIndices(data.size());
-    std::iota(resultIndices.begin(), resultIndices.end(), 0);
-
-    /* Table containing original vector index for each discretized vector.
-       Reserving more buckets than necessary (i.e. as if each vector was
-       unique). */
-    std::unordered_map<Math::Vector<Vector::Size, std::size_t>, UnsignedInt, Implementation::VectorHash<Vector::Size>> table(data.size());
-
-    /* Index array for each pass, new data array */
-    std::vector<UnsignedInt> indices;
-    indices.reserve(data.size());
-
-    /* First go with original coordinates, then move them by epsilon/2 in each
-       direction. */
-    Vector moved;
-    for(std::size_t moving = 0; moving <= Vector::Size; ++moving) {
-        /* Go through all vectors */
-        for(std::size_t i = 0; i != data.size(); ++i) {
-            /* Try to insert new vertex to the table */
-            const Math::Vector<Vector::Size, std::size_t> v((data[i] + moved - min)/epsilon);
-            const auto result = table.emplace(v, table.size());
+    /* Representative for each vector, always at or before its position */
+    std::vector<UnsignedInt> representatives(data.size());
 
-            /* Add the (either new or already existing) index to index array */
-            indices.push_back(result.first->second);
+    /* Don't bother with threads for small chunks. Platforms without threads
+       always weld serially. */
+    #if !defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(CORRADE_TARGET_NACL)
+    if(!threadCount) threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    #else
+    threadCount = 1;
+    #endif
+    const std::size_t chunkCount = Math::max(std::size_t(1), Math::min(std::size_t(threadCount), data.size()/1024));
 
-            /* If this is new combination, copy the data to new (earlier)
-               possition in the array */
-            if(result.second && i != table.size()-1) data[table.size()-1] = data[i];
-        }
-
-        /* Shrink the data array */
-        CORRADE_INTERNAL_ASSERT(data.size() >= table.size());
-        data.resize(table.size());
+    if(chunkCount == 1) {
+        Implementation::DuplicateGrid<Vector::Size> grid{data.size()};
+        for(std::size_t i = 0; i != data.size(); ++i)
+            representatives[i] = Implementation::weld(grid, data, i, min, cellSize, epsilon);
 
-        /* Remap the resulting index array */
-        for(auto& i: resultIndices) i = indices[i];
-
-        /* Finished */
-        if(moving == Vector::Size) continue;
+    }
+    #if !defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(CORRADE_TARGET_NACL)
+    else {
+        /* Weld each chunk separately on the global scheduler, which makes
+           at most chunkCount chunks of at least this size */
+        TaskScheduler::global().parallelFor(data.size(), (data.size() + chunkCount - 1)/chunkCount, [&data, &representatives, &min, cellSize, epsilon](const std::size_t begin, const std::size_t end) {
+            Implementation::DuplicateGrid<Vector::Size> grid{end - begin};
+            for(std::size_t i = begin; i != end; ++i)
+                representatives[i] = Implementation::weld(grid, data, i, min, cellSize, epsilon);
+        });
 
-        /* Move vertex coordinates by epsilon/2 in next direction */
-        moved = Vector();
-        moved[moving] = epsilon/2;
+        /* Weld unique vectors of all chunks together, chunk-local duplicates
+           then inherit the representative of their local representative. As
+           the chunks (and vectors in them) are processed in order, the
+           representative is always resolved already. */
+        std::size_t uniqueCount = 0;
+        for(std::size_t i = 0; i != data.size(); ++i)
+            if(representatives[i] == i) ++uniqueCount;
+        Implementation::DuplicateGrid<Vector::Size> grid{uniqueCount};
+        for(std::size_t i = 0; i != data.size(); ++i) {
+            if(representatives[i] == i)
+                representatives[i] = Implementation::weld(grid, data, i, min, cellSize, epsilon);
+            else representatives[i] = representatives[representatives[i]];
+        }
+    }
+    #endif
 
-        /* Clear the structures for next pass */
-        table.clear();
-        indices.clear();
+    /* Move the unique data to the front and remap the representatives to new
+       positions. Unique vectors are their own representatives, so the new
+       position can be stored in place. */
+    std::vector<UnsignedInt> resultIndices(data.size());
+    std::size_t uniqueCount = 0;
+    for(std::size_t i = 0; i != data.size(); ++i) {
+        if(representatives[i] == i) {
+            if(uniqueCount != i) data[uniqueCount] = data[i];
+            resultIndices[i] = uniqueCount++;
+        } else resultIndices[i] = resultIndices[representatives[i]];
     }
 
+    data.resize(uniqueCount);
     return resultIndices;
 }
 
@@ -0,0 +1,304 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Simplify.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <unordered_set>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Tipsify.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Border planes are weighted more, so the border is not eroded */
+constexpr Double BorderWeight = 10.0;
+
+/* Symmetric 4x4 matrix of plane equation products, stored as upper triangle,
+   plus sum of weights to normalize the error */
+struct Quadric {
+    Double a00, a01, a02, a03,
+                a11, a12, a13,
+                     a22, a23,
+                          a33;
+    Double weight;
+};
+
+Quadric planeQuadric(const Vector3& normal, const Vector3& point, const Double weight) {
+    const Double a = normal.x(), b = normal.y(), c = normal.z();
+    const Double d = -Math::dot(normal, point);
+    return {weight*a*a, weight*a*b, weight*a*c, weight*a*d,
+                        weight*b*b, weight*b*c, weight*b*d,
+                                    weight*c*c, weight*c*d,
+                                                weight*d*d,
+            weight};
+}
+
+Quadric& operator+=(Quadric& a, const Quadric& b) {
+    a.a00 += b.a00; a.a01 += b.a01; a.a02 += b.a02; a.a03 += b.a03;
+    a.a11 += b.a11; a.a12 += b.a12; a.a13 += b.a13;
+    a.a22 += b.a22; a.a23 += b.a23;
+    a.a33 += b.a33;
+    a.weight += b.weight;
+    return a;
+}
+
+/* Mean squared distance of the point from all the planes */
+Double quadricError(const Quadric& q, const Vector3& point) {
+    if(q.weight == 0.0) return 0.0;
+
+    const Double x = point.x(), y = point.y(), z = point.z();
+    const Double error =
+        q.a00*x*x + 2.0*q.a01*x*y + 2.0*q.a02*x*z + 2.0*q.a03*x +
+                        q.a11*y*y + 2.0*q.a12*y*z + 2.0*q.a13*y +
+                                        q.a22*z*z + 2.0*q.a23*z +
+                                                        q.a33;
+    return std::abs(error)/q.weight;
+}
+
+enum class VertexKind: UnsignedByte {
+    Manifold,   /* Can be collapsed anywhere */
+    Border,     /* Can be collapsed only along the border */
+    Locked      /* Can't be collapsed */
+};
+
+constexpr UnsignedInt NoVertex = ~UnsignedInt{};
+
+inline UnsignedLong edgeKey(const UnsignedInt a, const UnsignedInt b) {
+    return (UnsignedLong(a) << 32)|b;
+}
+
+void removeDegenerateTriangles(std::vector<UnsignedInt>& indices) {
+    std::size_t out = 0;
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        const UnsignedInt a = indices[i], b = indices[i + 1], c = indices[i + 2];
+        if(a == b || b == c || c == a) continue;
+        indices[out++] = a;
+        indices[out++] = b;
+        indices[out++] = c;
+    }
+    indices.resize(out);
+}
+
+struct Collapse {
+    UnsignedInt from, to;
+    Double error;
+};
+
+}
+
+std::vector<UnsignedInt> simplify(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const std::size_t targetIndexCount, const Float maxError) {
+    CORRADE_ASSERT(indices.size() % 3 == 0, "MeshTools::simplify(): index count is not divisible by 3", {});
+
+    const UnsignedInt vertexCount = positions.size();
+    std::vector<UnsignedInt> result = indices;
+    removeDegenerateTriangles(result);
+    if(result.size() <= targetIndexCount) return result;
+
+    /* Lock vertices sharing the position with some other vertex */
+    std::vector<VertexKind> kind(vertexCount, VertexKind::Manifold);
+    {
+        std::vector<UnsignedInt> sorted(vertexCount);
+        std::iota(sorted.begin(), sorted.end(), 0);
+        auto less = [&positions](UnsignedInt a, UnsignedInt b) {
+            const Vector3& pa = positions[a];
+            const Vector3& pb = positions[b];
+            if(pa.x() != pb.x()) return pa.x() < pb.x();
+            if(pa.y() != pb.y()) return pa.y() < pb.y();
+            return pa.z() < pb.z();
+        };
+        std::sort(sorted.begin(), sorted.end(), less);
+        for(std::size_t i = 1; i < sorted.size(); ++i) {
+            if(positions[sorted[i - 1]] != positions[sorted[i]]) continue;
+            kind[sorted[i - 1]] = kind[sorted[i]] = VertexKind::Locked;
+        }
+    }
+
+    /* Plane quadric of each triangle, weighted by its area */
+    std::vector<Quadric> quadrics(vertexCount, Quadric{});
+    for(std::size_t i = 0; i != result.size(); i += 3) {
+        const Vector3& a = positions[result[i]];
+        const Vector3 normal = Math::cross(positions[result[i + 1]] - a, positions[result[i + 2]] - a);
+        const Float length = normal.length();
+        if(length == 0.0f) continue;
+
+        const Quadric q = planeQuadric(normal/length, a, 0.5*length);
+        for(std::size_t j = 0; j != 3; ++j) quadrics[result[i + j]] += q;
+    }
+
+    /* Find border edges, i.e. edges with no opposite edge. Vertices on
+       border or non-manifold edges that aren't part of exactly one border
+       loop get locked. */
+    std::vector<UnsignedInt> borderNext(vertexCount, NoVertex), borderPrevious(vertexCount, NoVertex);
+    {
+        std::unordered_set<UnsignedLong> edges;
+        edges.reserve(result.size());
+        for(std::size_t i = 0; i != result.size(); ++i) {
+            const UnsignedInt a = result[i], b = result[i - i%3 + (i + 1)%3];
+            if(!edges.insert(edgeKey(a, b)).second)
+                kind[a] = kind[b] = VertexKind::Locked;
+        }
+
+        for(std::size_t i = 0; i != result.size(); ++i) {
+            const UnsignedInt a = result[i], b = result[i - i%3 + (i + 1)%3];
+            if(edges.count(edgeKey(b, a))) continue;
+
+            if(borderNext[a] != NoVertex || borderPrevious[b] != NoVertex)
+                kind[a] = kind[b] = VertexKind::Locked;
+            borderNext[a] = b;
+            borderPrevious[b] = a;
+            if(kind[a] == VertexKind::Manifold) kind[a] = VertexKind::Border;
+            if(kind[b] == VertexKind::Manifold) kind[b] = VertexKind::Border;
+
+            /* Plane going through the edge, perpendicular to the triangle */
+            const Vector3& pa = positions[a];
+            const Vector3 edge = positions[b] - pa;
+            const Vector3 normal = Math::cross(edge, Math::cross(edge, positions[result[i - i%3 + (i + 2)%3]] - pa));
+            const Float length = normal.length();
+            if(length == 0.0f) continue;
+
+            const Quadric q = planeQuadric(normal/length, pa, BorderWeight*edge.dot());
+            quadrics[a] += q;
+            quadrics[b] += q;
+        }
+
+        for(UnsignedInt i = 0; i != vertexCount; ++i)
+            if(kind[i] == VertexKind::Border && (borderNext[i] == NoVertex || borderPrevious[i] == NoVertex))
+                kind[i] = VertexKind::Locked;
+    }
+
+    const Double maxSquaredError = Double(maxError)*Double(maxError);
+    std::vector<UnsignedInt> liveTriangleCount, neighborOffset, neighbors;
+    std::vector<Collapse> collapses;
+    std::vector<UnsignedInt> remap(vertexCount);
+    std::vector<bool> locked(vertexCount);
+    while(result.size() > targetIndexCount) {
+        Implementation::Tipsify{result, vertexCount}.buildAdjacency(liveTriangleCount, neighborOffset, neighbors);
+
+        /* Gather all possible collapses, sort them by the error */
+        collapses.clear();
+        for(std::size_t i = 0; i != result.size(); ++i) {
+            const UnsignedInt a = result[i], b = result[i - i%3 + (i + 1)%3];
+            for(const std::pair<UnsignedInt, UnsignedInt>& edge: {std::make_pair(a, b), std::make_pair(b, a)}) {
+                const UnsignedInt from = edge.first, to = edge.second;
+                if(kind[from] == VertexKind::Locked) continue;
+                if(kind[from] == VertexKind::Border && borderNext[from] != to && borderPrevious[from] != to) continue;
+
+                Quadric q = quadrics[from];
+                q += quadrics[to];
+                const Double error = quadricError(q, positions[to]);
+                if(error <= maxSquaredError) collapses.push_back({from, to, error});
+            }
+        }
+        std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) {
+            return a.error < b.error;
+        });
+
+        /* Collapse as many edges as possible, each vertex can be touched
+           only once in each pass so the adjacency stays valid */
+        std::iota(remap.begin(), remap.end(), 0);
+        std::fill(locked.begin(), locked.end(), false);
+        std::size_t indexCount = result.size();
+        std::size_t collapseCount = 0;
+        for(const Collapse& collapse: collapses) {
+            if(indexCount <= targetIndexCount) break;
+
+            const UnsignedInt from = collapse.from, to = collapse.to;
+            if(locked[from] || locked[to]) continue;
+
+            /* Reject the collapse if it would flip any of the remaining
+               triangles */
+            std::size_t removedTriangleCount = 0;
+            bool flips = false;
+            for(std::size_t i = neighborOffset[from]; i != neighborOffset[from + 1] && !flips; ++i) {
+                const std::size_t triangle = neighbors[i]*3;
+                UnsignedInt v[3];
+                for(std::size_t j = 0; j != 3; ++j) v[j] = remap[result[triangle + j]];
+                if(v[0] == to || v[1] == to || v[2] == to) {
+                    ++removedTriangleCount;
+                    continue;
+                }
+                if(v[0] == v[1] || v[1] == v[2] || v[2] == v[0]) continue;
+
+                const Vector3 before = Math::cross(positions[v[1]] - positions[v[0]], positions[v[2]] - positions[v[0]]);
+                for(std::size_t j = 0; j != 3; ++j) if(v[j] == from) v[j] = to;
+                const Vector3 after = Math::cross(positions[v[1]] - positions[v[0]], positions[v[2]] - positions[v[0]]);
+                if(Math::dot(before, after) <= 0.0f) flips = true;
+            }
+            if(flips) continue;
+
+            remap[from] = to;
+            quadrics[to] += quadrics[from];
+            locked[from] = locked[to] = true;
+            indexCount -= removedTriangleCount*3;
+            ++collapseCount;
+
+            /* Shorten the border loop */
+            if(kind[from] == VertexKind::Border) {
+                if(borderNext[from] == to) {
+                    borderNext[borderPrevious[from]] = to;
+                    borderPrevious[to] = borderPrevious[from];
+                } else {
+                    borderPrevious[borderNext[from]] = to;
+                    borderNext[to] = borderNext[from];
+                }
+            }
+        }
+
+        /* Nothing more to do */
+        if(!collapseCount) break;
+
+        for(UnsignedInt& index: result) index = remap[index];
+        removeDegenerateTriangles(result);
+    }
+
+    return result;
+}
+
+std::vector<std::vector<UnsignedInt>> generateLods(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const UnsignedInt lodCount, const Float ratio, const Float maxError) {
+    CORRADE_ASSERT(indices.size() % 3 == 0, "MeshTools::generateLods(): index count is not divisible by 3", {});
+
+    std::vector<std::vector<UnsignedInt>> lods;
+    if(!lodCount) return lods;
+
+    lods.push_back(indices);
+    while(lods.size() != lodCount) {
+        const std::size_t targetIndexCount = std::size_t(lods.back().size()*ratio)/3*3;
+        std::vector<UnsignedInt> lod = simplify(lods.back(), positions, targetIndexCount, maxError);
+
+        /* Can't simplify any further */
+        if(lod.empty() || lod.size() >= lods.back().size()) break;
+
+        lods.push_back(std::move(lod));
+    }
+
+    return lods;
+}
+
+}}
@@ -0,0 +1,106 @@
+#ifndef Magnum_MeshTools_Simplify_h
+#define Magnum_MeshTools_Simplify_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::simplify(), @ref Magnum::MeshTools::generateLods()
+ */
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Simplify the mesh
+@param indices          Triangle indices
+@param positions        Vertex positions
+@param targetIndexCount Target index count
+@param maxError         Max allowed error, in position units
+@return Indices of simplified mesh
+
+Reduces triangle count of the mesh by collapsing edges, cheapest first, until
+the index count is at or below @p targetIndexCount or until no edge can be
+collapsed without exceeding @p maxError. Cost of each collapse is measured
+using quadric error metric, which approximates distance of the vertex from
+planes of all triangles it was originally adjacent to. Algorithm used:
+*Michael Garland, Paul S. Heckbert --- Surface Simplification Using Quadric
+Error Metrics, SIGGRAPH 1997*.
+
+Edges are always collapsed into one of their existing vertices, so no vertex
+data are modified or added and the simplified index array can be used
+together with the original vertex buffer. Collapses that would flip any
+triangle are rejected. Open borders are kept in place, border vertices are
+allowed to slide only along the border. Vertices that share the same position
+with some other vertex (i.e. seams where the vertex had to be split because of
+different normals or texture coordinates) are never moved, so the seams don't
+crack.
+
+As the result usually references only a subset of vertices, you may want to
+use @ref optimizeVertexCache() on it afterwards. On the other hand,
+@ref optimizeVertexFetch() is not useful if the vertex buffer is shared with
+other detail levels.
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3.
+@see @ref generateLods(), @ref subdivide()
+*/
+MAGNUM_MESHTOOLS_EXPORT std::vector<UnsignedInt> simplify(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, std::size_t targetIndexCount, Float maxError = Constants::inf());
+
+/**
+@brief Generate chain of detail levels
+@param indices          Triangle indices
+@param positions        Vertex positions
+@param lodCount         Max count of detail levels, including the original
+@param ratio            Ratio of index count between two successive levels
+@param maxError         Max allowed error of each level relative to the
+    previous one, in position units
+@return Index arrays of all detail levels
+
+First item of the returned array is @p indices, each next item is the previous
+one simplified using @ref simplify() to @p ratio of its index count. Fewer
+than @p lodCount levels are returned if the mesh can't be simplified any
+further. All levels reference the same @p positions array, so they can share
+a single vertex buffer. The index arrays can be also concatenated into a
+single index buffer and drawn using @ref Mesh::setIndexBuffer() with
+appropriate offset. See @ref SceneGraph::LodDrawable for selecting the level
+based on projected size of the object on the screen.
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+
+std::vector<std::vector<UnsignedInt>> lods = MeshTools::generateLods(indices, positions, 4);
+@endcode
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::vector<std::vector<UnsignedInt>> generateLods(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, UnsignedInt lodCount, Float ratio = 0.5f, Float maxError = Constants::inf());
+
+}}
+
+#endif
@@ -0,0 +1,170 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "Stripify.h"
+
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* How many not-yet-used triangles are checked when extending a strip */
+constexpr std::size_t LookAhead = 16;
+
+/* Returns third vertex of a triangle containing directed edge a -> b or
+   `false` if the triangle doesn't contain it */
+bool thirdVertex(const UnsignedInt* const triangle, const UnsignedInt a, const UnsignedInt b, UnsignedInt& c) {
+    for(std::size_t i = 0; i != 3; ++i) {
+        if(triangle[i] == a && triangle[(i + 1) % 3] == b) {
+            c = triangle[(i + 2) % 3];
+            return true;
+        }
+    }
+
+    return false;
+}
+
+class Stripifier {
+    public:
+        explicit Stripifier(const std::vector<UnsignedInt>& indices): _indices(indices), _used(indices.size()/3), _first{} {}
+
+        /* Moves past the used triangles, returns false if there are none
+           left */
+        bool next() {
+            while(_first != _used.size() && _used[_first]) ++_first;
+            return _first != _used.size();
+        }
+
+        std::size_t first() const { return _first; }
+
+        const UnsignedInt* triangle(std::size_t i) const { return _indices.data() + i*3; }
+
+        void use(std::size_t i) { _used[i] = true; }
+        void unuse(std::size_t i) { _used[i] = false; }
+
+        /* Finds a triangle in the look-ahead window containing directed edge
+           a -> b, returns its ID or the triangle count if there's none */
+        std::size_t find(const UnsignedInt a, const UnsignedInt b, UnsignedInt& c) const {
+            std::size_t checked = 0;
+            for(std::size_t i = _first; i != _used.size() && checked != LookAhead; ++i) {
+                if(_used[i]) continue;
+                if(thirdVertex(triangle(i), a, b, c)) return i;
+                ++checked;
+            }
+
+            return _used.size();
+        }
+
+        std::size_t triangleCount() const { return _used.size(); }
+
+    private:
+        const std::vector<UnsignedInt>& _indices;
+        std::vector<bool> _used;
+        std::size_t _first;
+};
+
+}
+
+std::vector<UnsignedInt> stripify(const std::vector<UnsignedInt>& indices, const UnsignedInt restartIndex) {
+    CORRADE_ASSERT(indices.size() % 3 == 0, "MeshTools::stripify(): index count is not divisible by 3", {});
+
+    std::vector<UnsignedInt> strips;
+    strips.reserve(indices.size());
+
+    Stripifier stripifier{indices};
+    std::vector<std::size_t> simulated;
+    while(stripifier.next()) {
+        const std::size_t first = stripifier.first();
+        const UnsignedInt* const triangle = stripifier.triangle(first);
+        stripifier.use(first);
+
+        /* Triangle i of a strip is (v[i], v[i + 1], v[i + 2]) for even i and
+           (v[i + 1], v[i], v[i + 2]) for odd i. Starting with (x, y, z) needs
+           the next triangle to contain edge z -> y, while starting with a
+           degenerate triangle (y, y, x) followed by (x, y, z) needs edge
+           x -> z. Try all rotations of both and pick the one giving the
+           longest strip, which matters e.g. for grids where only one of the
+           two winding parities is able to continue past the second
+           triangle. */
+        std::size_t bestRotation = 0, bestLength = 0;
+        bool bestOdd = false;
+        for(std::size_t i = 0; i != 6; ++i) {
+            const bool odd = i >= 3;
+            const UnsignedInt x = triangle[i % 3],
+                y = triangle[(i + 1) % 3],
+                z = triangle[(i + 2) % 3];
+            UnsignedInt a = odd ? x : y, b = z, c;
+            bool nextOdd = !odd;
+
+            /* Extend the strip without committing the triangles */
+            std::size_t length = 0;
+            for(;;) {
+                const std::size_t found = nextOdd ? stripifier.find(b, a, c) : stripifier.find(a, b, c);
+                if(found == stripifier.triangleCount()) break;
+                stripifier.use(found);
+                simulated.push_back(found);
+                a = b;
+                b = c;
+                nextOdd = !nextOdd;
+                ++length;
+            }
+            for(std::size_t t: simulated) stripifier.unuse(t);
+            simulated.clear();
+
+            /* The degenerate start costs one index more, use it only if it
+               makes the strip longer */
+            if(length > bestLength) {
+                bestRotation = i % 3;
+                bestLength = length;
+                bestOdd = odd;
+            }
+        }
+
+        const UnsignedInt x = triangle[bestRotation],
+            y = triangle[(bestRotation + 1) % 3],
+            z = triangle[(bestRotation + 2) % 3];
+        if(!strips.empty()) strips.push_back(restartIndex);
+        if(bestOdd) strips.insert(strips.end(), {y, y, x, z});
+        else strips.insert(strips.end(), {x, y, z});
+
+        for(bool odd = !bestOdd; ; odd = !odd) {
+            const UnsignedInt a = strips[strips.size() - 2];
+            const UnsignedInt b = strips.back();
+            UnsignedInt c;
+            const std::size_t found = odd ? stripifier.find(b, a, c) : stripifier.find(a, b, c);
+            if(found == stripifier.triangleCount()) break;
+
+            stripifier.use(found);
+            strips.push_back(c);
+        }
+    }
+
+    return strips;
+}
+
+}}
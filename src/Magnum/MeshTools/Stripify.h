@@ -0,0 +1,84 @@
+#ifndef Magnum_MeshTools_Stripify_h
+#define Magnum_MeshTools_Stripify_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::stripify()
+ */
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Convert a triangle list to triangle strips
+@param indices      Triangle index array
+@param restartIndex Primitive restart index inserted between the strips
+@return Index array for @ref MeshPrimitive::TriangleStrip
+
+Greedily joins consecutive triangles of the list into strips, preserving
+the winding of each triangle. A triangle is appended to the current strip if
+it shares the last strip edge and is among the next few not-yet-used triangles,
+so the triangle order stays close to the original and the index array should be
+already optimized using @ref optimizeVertexCache() or @ref tipsify(). When no
+such triangle is found, @p restartIndex is inserted and a new strip begins.
+A strip may begin with a degenerate triangle if that allows it to continue
+with the opposite winding parity.
+
+The restart index has to match the index type the array is converted to, use
+@ref Mesh::primitiveRestartIndex() to get it. Then draw the mesh with
+@ref Renderer::Feature::PrimitiveRestartFixedIndex or with
+@ref Renderer::Feature::PrimitiveRestart and the same index passed to
+@ref Renderer::setPrimitiveRestartIndex():
+@code
+std::vector<UnsignedInt> indices;
+MeshTools::tipsify(indices, vertexCount, 24);
+std::vector<UnsignedInt> strips = MeshTools::stripify(indices,
+    Mesh::primitiveRestartIndex(Mesh::IndexType::UnsignedShort));
+
+Buffer indexBuffer;
+indexBuffer.setData(MeshTools::compressIndicesAs<UnsignedShort>(strips), BufferUsage::StaticDraw);
+
+Mesh mesh{MeshPrimitive::TriangleStrip};
+mesh.setCount(strips.size())
+    .setIndexBuffer(indexBuffer, 0, Mesh::IndexType::UnsignedShort);
+
+Renderer::enable(Renderer::Feature::PrimitiveRestartFixedIndex);
+mesh.draw(shader);
+@endcode
+
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3. The @p restartIndex is expected to not be
+    used by any vertex.
+*/
+MAGNUM_MESHTOOLS_EXPORT std::vector<UnsignedInt> stripify(const std::vector<UnsignedInt>& indices, UnsignedInt restartIndex);
+
+}}
+
+#endif
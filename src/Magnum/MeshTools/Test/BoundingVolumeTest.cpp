@@ -0,0 +1,161 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/MeshTools/BoundingVolume.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct BoundingVolumeTest: TestSuite::Tester {
+    explicit BoundingVolumeTest();
+
+    void boxEmpty();
+    void box();
+    void boxRemaining();
+
+    void sphereEmpty();
+    void sphereSinglePoint();
+    void sphere();
+    void sphereGrow();
+
+    void computeBoundingVolumes();
+};
+
+BoundingVolumeTest::BoundingVolumeTest() {
+    addTests({&BoundingVolumeTest::boxEmpty,
+              &BoundingVolumeTest::box,
+              &BoundingVolumeTest::boxRemaining,
+
+              &BoundingVolumeTest::sphereEmpty,
+              &BoundingVolumeTest::sphereSinglePoint,
+              &BoundingVolumeTest::sphere,
+              &BoundingVolumeTest::sphereGrow,
+
+              &BoundingVolumeTest::computeBoundingVolumes});
+}
+
+void BoundingVolumeTest::boxEmpty() {
+    CORRADE_COMPARE(MeshTools::boundingBox(nullptr), Range3D{});
+}
+
+void BoundingVolumeTest::box() {
+    /* Extremes in different lanes of the vector registers */
+    const Vector3 positions[]{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, -3.0f, 0.5f},
+        {0.5f, 0.5f, 7.0f},
+        {-2.0f, 0.0f, 0.0f},
+        {0.0f, 4.0f, 0.0f},
+        {0.0f, 0.0f, -1.5f},
+        {3.0f, 0.0f, 0.0f},
+        {0.0f, 0.0f, 0.0f}
+    };
+
+    CORRADE_COMPARE(MeshTools::boundingBox(positions),
+        (Range3D{{-2.0f, -3.0f, -1.5f}, {3.0f, 4.0f, 7.0f}}));
+}
+
+void BoundingVolumeTest::boxRemaining() {
+    /* Two points don't fit into the vector loop */
+    const Vector3 positions[]{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 1.0f, 1.0f},
+        {0.5f, 0.5f, 0.5f},
+        {0.2f, 0.2f, 0.2f},
+        {0.5f, -10.0f, 0.5f},
+        {0.5f, 0.5f, 10.0f}
+    };
+
+    CORRADE_COMPARE(MeshTools::boundingBox(positions),
+        (Range3D{{0.0f, -10.0f, 0.0f}, {1.0f, 1.0f, 10.0f}}));
+}
+
+void BoundingVolumeTest::sphereEmpty() {
+    const std::pair<Vector3, Float> sphere = MeshTools::boundingSphere(nullptr);
+    CORRADE_COMPARE(sphere.first, Vector3{});
+    CORRADE_COMPARE(sphere.second, 0.0f);
+}
+
+void BoundingVolumeTest::sphereSinglePoint() {
+    const Vector3 positions[]{{1.0f, 2.0f, 3.0f}};
+    const std::pair<Vector3, Float> sphere = MeshTools::boundingSphere(positions);
+    CORRADE_COMPARE(sphere.first, (Vector3{1.0f, 2.0f, 3.0f}));
+    CORRADE_COMPARE(sphere.second, 0.0f);
+}
+
+void BoundingVolumeTest::sphere() {
+    /* Octahedron, the extremal points give the minimal sphere directly */
+    const Vector3 positions[]{
+        {1.0f, 0.0f, 0.0f},
+        {-1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {0.0f, -1.0f, 0.0f},
+        {0.0f, 0.0f, 1.0f},
+        {0.0f, 0.0f, -1.0f},
+        {0.1f, 0.2f, 0.3f}
+    };
+
+    const std::pair<Vector3, Float> sphere = MeshTools::boundingSphere(positions);
+    CORRADE_COMPARE(sphere.first, Vector3{});
+    CORRADE_COMPARE(sphere.second, 1.0f);
+}
+
+void BoundingVolumeTest::sphereGrow() {
+    /* The initial diameter is along X, the point on Y is outside */
+    const Vector3 positions[]{
+        {-1.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 2.0f, 0.0f}
+    };
+
+    const std::pair<Vector3, Float> sphere = MeshTools::boundingSphere(positions);
+    for(const Vector3& position: positions)
+        CORRADE_VERIFY((position - sphere.first).length() <= sphere.second*1.0001f);
+
+    /* Not minimal, but not too far from it either */
+    CORRADE_VERIFY(sphere.second < 1.5f);
+}
+
+void BoundingVolumeTest::computeBoundingVolumes() {
+    Trade::MeshData3D mesh{MeshPrimitive::Points, {}, {{
+        {-1.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 0.0f, 0.5f}}}, {}, {}};
+    MeshTools::computeBoundingVolumes(mesh);
+
+    CORRADE_VERIFY(mesh.hasBoundingBox());
+    CORRADE_VERIFY(mesh.hasBoundingSphere());
+    CORRADE_COMPARE(mesh.boundingBox(), (Range3D{{-1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.5f}}));
+    CORRADE_COMPARE(mesh.boundingSphere().first, Vector3{});
+    CORRADE_COMPARE(mesh.boundingSphere().second, 1.0f);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::BoundingVolumeTest)
@@ -37,12 +37,18 @@ struct CombineIndexedArraysTest: TestSuite::Tester {
 
     void wrongIndexCount();
     void indexArrays();
+    void indexArraysInto();
+    void indexArraysIntoWrongOutputSize();
+    void indexArraysIntoMany();
     void indexedArrays();
 };
 
 CombineIndexedArraysTest::CombineIndexedArraysTest() {
     addTests({&CombineIndexedArraysTest::wrongIndexCount,
               &CombineIndexedArraysTest::indexArrays,
+              &CombineIndexedArraysTest::indexArraysInto,
+              &CombineIndexedArraysTest::indexArraysIntoWrongOutputSize,
+              &CombineIndexedArraysTest::indexArraysIntoMany,
               &CombineIndexedArraysTest::indexedArrays});
 }
 
@@ -68,6 +74,50 @@ void CombineIndexedArraysTest::indexArrays() {
     CORRADE_COMPARE(c, (std::vector<UnsignedInt>{6, 7}));
 }
 
+void CombineIndexedArraysTest::indexArraysInto() {
+    /* Example from the documentation */
+    const UnsignedInt interleaved[]{0, 1, 2, 3, 5, 4, 0, 1, 0, 4, 1, 6, 3, 1, 2, 3, 2, 1};
+    UnsignedInt combined[9];
+    UnsignedInt unique[18];
+
+    const UnsignedInt count = MeshTools::combineIndexArraysInto(interleaved, 2, combined, unique);
+    CORRADE_COMPARE(count, 7);
+    CORRADE_COMPARE(std::vector<UnsignedInt>(combined, combined + 9),
+        (std::vector<UnsignedInt>{0, 1, 2, 0, 3, 4, 5, 1, 6}));
+    CORRADE_COMPARE(std::vector<UnsignedInt>(unique, unique + 14),
+        (std::vector<UnsignedInt>{0, 1, 2, 3, 5, 4, 0, 4, 1, 6, 3, 1, 2, 1}));
+}
+
+void CombineIndexedArraysTest::indexArraysIntoWrongOutputSize() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+    const UnsignedInt interleaved[]{0, 1, 2, 3};
+    UnsignedInt combined[1];
+    UnsignedInt unique[4];
+    MeshTools::combineIndexArraysInto(interleaved, 2, combined, unique);
+
+    CORRADE_COMPARE(ss.str(), "MeshTools::combineIndexArraysInto(): expected output sizes 2 and 4 but got 1 and 4\n");
+}
+
+void CombineIndexedArraysTest::indexArraysIntoMany() {
+    /* Three index streams with lots of repeated combinations, checking that
+       the unique combinations are in order of first occurrence */
+    std::vector<UnsignedInt> interleaved;
+    for(UnsignedInt i = 0; i != 30000; ++i)
+        interleaved.insert(interleaved.end(), {i%1000, (i*7)%300, i%1000});
+
+    std::vector<UnsignedInt> combined(10000*3);
+    std::vector<UnsignedInt> unique(interleaved.size());
+    const UnsignedInt count = MeshTools::combineIndexArraysInto({interleaved.data(), interleaved.size()}, 3, {combined.data(), combined.size()}, {unique.data(), unique.size()});
+
+    /* Combination repeats with period of lcm(1000, 300) = 3000 */
+    CORRADE_COMPARE(count, 3000);
+    for(UnsignedInt i = 0; i != 30000; ++i) {
+        CORRADE_COMPARE(combined[i], i%3000);
+        CORRADE_COMPARE(unique[combined[i]*3 + 1], interleaved[i*3 + 1]);
+    }
+}
+
 void CombineIndexedArraysTest::indexedArrays() {
     std::vector<UnsignedInt> a{0, 1, 0};
     std::vector<UnsignedInt> b{3, 4, 3};
@@ -0,0 +1,97 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <vector>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/MeshTools/CompressIndices.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct CompressIndicesBenchmark: TestSuite::Tester {
+    explicit CompressIndicesBenchmark();
+
+    void compressUnsignedByte();
+    void compressUnsignedShort();
+    void compressUnsignedInt();
+    void compressAsUnsignedShort();
+};
+
+namespace {
+    /* Each benchmark compresses 1M indices, divide the iteration count by the
+       measured time to get indices per second */
+    constexpr std::size_t IndexCount = 1024*1024;
+
+    std::vector<UnsignedInt> indices(const UnsignedInt max) {
+        std::vector<UnsignedInt> out;
+        out.reserve(IndexCount);
+        for(std::size_t i = 0; i != IndexCount; ++i)
+            out.push_back((i*7919)%(max + 1));
+        return out;
+    }
+}
+
+CompressIndicesBenchmark::CompressIndicesBenchmark() {
+    addBenchmarks({&CompressIndicesBenchmark::compressUnsignedByte,
+                   &CompressIndicesBenchmark::compressUnsignedShort,
+                   &CompressIndicesBenchmark::compressUnsignedInt,
+                   &CompressIndicesBenchmark::compressAsUnsignedShort}, 5, BenchmarkType::WallClock);
+}
+
+void CompressIndicesBenchmark::compressUnsignedByte() {
+    const std::vector<UnsignedInt> in = indices(0xff);
+    std::size_t size{};
+    CORRADE_BENCHMARK(10)
+        size += std::get<0>(MeshTools::compressIndices(in)).size();
+    CORRADE_COMPARE(size, 10*IndexCount);
+}
+
+void CompressIndicesBenchmark::compressUnsignedShort() {
+    const std::vector<UnsignedInt> in = indices(0xffff);
+    std::size_t size{};
+    CORRADE_BENCHMARK(10)
+        size += std::get<0>(MeshTools::compressIndices(in)).size();
+    CORRADE_COMPARE(size, 10*IndexCount*2);
+}
+
+void CompressIndicesBenchmark::compressUnsignedInt() {
+    const std::vector<UnsignedInt> in = indices(0x1ffff);
+    std::size_t size{};
+    CORRADE_BENCHMARK(10)
+        size += std::get<0>(MeshTools::compressIndices(in)).size();
+    CORRADE_COMPARE(size, 10*IndexCount*4);
+}
+
+void CompressIndicesBenchmark::compressAsUnsignedShort() {
+    const std::vector<UnsignedInt> in = indices(0xffff);
+    std::size_t size{};
+    CORRADE_BENCHMARK(10)
+        size += MeshTools::compressIndicesAs<UnsignedShort>(in).size();
+    CORRADE_COMPARE(size, 10*IndexCount);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::CompressIndicesBenchmark)
@@ -41,6 +41,10 @@ struct CompressIndicesTest: TestSuite::Tester {
     void compressInt();
 
     void compressAsShort();
+
+    void compressSplit();
+    void compressSplitSingleChunk();
+    void compressSplitInvalid();
 };
 
 CompressIndicesTest::CompressIndicesTest() {
@@ -48,7 +52,11 @@ CompressIndicesTest::CompressIndicesTest() {
               &CompressIndicesTest::compressShort,
               &CompressIndicesTest::compressInt,
 
-              &CompressIndicesTest::compressAsShort});
+              &CompressIndicesTest::compressAsShort,
+
+              &CompressIndicesTest::compressSplit,
+              &CompressIndicesTest::compressSplitSingleChunk,
+              &CompressIndicesTest::compressSplitInvalid});
 }
 
 void CompressIndicesTest::compressChar() {
@@ -125,6 +133,67 @@ void CompressIndicesTest::compressAsShort() {
     CORRADE_COMPARE(out.str(), "MeshTools::compressIndicesAs(): type too small to represent value 65536\n");
 }
 
+void CompressIndicesTest::compressSplit() {
+    Containers::Array<UnsignedShort> data;
+    std::vector<IndexChunk> chunks;
+    std::tie(data, chunks) = MeshTools::compressIndicesSplit({
+        0, 1, 2,
+        2, 1, 9,
+        /* Doesn't fit with the previous ones */
+        10, 11, 12,
+        12, 11, 19,
+        /* Fits into the second chunk */
+        15, 16, 17,
+        /* Start of the range is too far back */
+        5, 9, 10}, 10);
+
+    CORRADE_COMPARE_AS(data, (Containers::Array<UnsignedShort>::from(
+        0, 1, 2, 2, 1, 9,
+        0, 1, 2, 2, 1, 9, 5, 6, 7,
+        0, 4, 5)), TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(chunks.size(), 3);
+    CORRADE_COMPARE(chunks[0].indexOffset, 0);
+    CORRADE_COMPARE(chunks[0].indexCount, 6);
+    CORRADE_COMPARE(chunks[0].baseVertex, 0);
+    CORRADE_COMPARE(chunks[0].indexEnd, 9);
+    CORRADE_COMPARE(chunks[1].indexOffset, 6);
+    CORRADE_COMPARE(chunks[1].indexCount, 9);
+    CORRADE_COMPARE(chunks[1].baseVertex, 10);
+    CORRADE_COMPARE(chunks[1].indexEnd, 9);
+    CORRADE_COMPARE(chunks[2].indexOffset, 15);
+    CORRADE_COMPARE(chunks[2].indexCount, 3);
+    CORRADE_COMPARE(chunks[2].baseVertex, 5);
+    CORRADE_COMPARE(chunks[2].indexEnd, 5);
+}
+
+void CompressIndicesTest::compressSplitSingleChunk() {
+    Containers::Array<UnsignedShort> data;
+    std::vector<IndexChunk> chunks;
+    std::tie(data, chunks) = MeshTools::compressIndicesSplit({
+        70000, 70001, 135535});
+
+    /* Base vertex is subtracted even if there's just one chunk */
+    CORRADE_COMPARE_AS(data, (Containers::Array<UnsignedShort>::from(
+        0, 1, 65535)), TestSuite::Compare::Container);
+    CORRADE_COMPARE(chunks.size(), 1);
+    CORRADE_COMPARE(chunks[0].indexCount, 3);
+    CORRADE_COMPARE(chunks[0].baseVertex, 70000);
+    CORRADE_COMPARE(chunks[0].indexEnd, 65535);
+}
+
+void CompressIndicesTest::compressSplitInvalid() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshTools::compressIndicesSplit({0, 1});
+    MeshTools::compressIndicesSplit({0, 1, 2}, 65537);
+    MeshTools::compressIndicesSplit({0, 1, 2, 0, 1, 10}, 10);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::compressIndicesSplit(): index count is not divisible by 3\n"
+        "MeshTools::compressIndicesSplit(): expected max vertex count in range [1, 65536] but got 65537\n"
+        "MeshTools::compressIndicesSplit(): triangle 1 spans more than 10 vertices\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::CompressIndicesTest)
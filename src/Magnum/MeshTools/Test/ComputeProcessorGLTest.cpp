@@ -0,0 +1,213 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <vector>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/Buffer.h"
+#include "Magnum/Context.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/Version.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/ComputeProcessor.h"
+#include "Magnum/MeshTools/GenerateMeshlets.h"
+#include "Magnum/MeshTools/GenerateSmoothNormals.h"
+#include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct ComputeProcessorGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit ComputeProcessorGLTest();
+
+    void transformPoints();
+    void transformVectors();
+    void generateSmoothNormals();
+    void cullMeshlets();
+};
+
+ComputeProcessorGLTest::ComputeProcessorGLTest() {
+    addTests({&ComputeProcessorGLTest::transformPoints,
+              &ComputeProcessorGLTest::transformVectors,
+              &ComputeProcessorGLTest::generateSmoothNormals,
+              &ComputeProcessorGLTest::cullMeshlets});
+}
+
+namespace {
+    bool isSupported() {
+        #ifndef MAGNUM_TARGET_GLES
+        return Context::current().isVersionSupported(Version::GL430);
+        #else
+        return Context::current().isVersionSupported(Version::GLES310);
+        #endif
+    }
+
+    template<class T> std::vector<T> read(Buffer& buffer, const std::size_t count) {
+        const T* data = buffer.map<T>(0, count*sizeof(T), Buffer::MapFlag::Read);
+        CORRADE_INTERNAL_ASSERT(data);
+        std::vector<T> out{data, data + count};
+        buffer.unmap();
+        return out;
+    }
+
+    /* Positions interleaved with normals */
+    const std::vector<Vector3> Positions{{0.0f, 0.0f, 0.0f},
+                                         {1.0f, 0.0f, 0.0f},
+                                         {1.0f, 1.0f, 0.0f},
+                                         {0.0f, 1.0f, 1.0f}};
+    const std::vector<Vector3> Normals{{0.0f, 0.0f, 1.0f},
+                                       {1.0f, 0.0f, 0.0f},
+                                       {0.0f, 1.0f, 0.0f},
+                                       {0.0f, 0.0f, 1.0f}};
+    const std::vector<UnsignedInt> Indices{0, 1, 2, 0, 2, 3};
+}
+
+void ComputeProcessorGLTest::transformPoints() {
+    if(!isSupported()) CORRADE_SKIP("Compute shaders are not supported.");
+
+    Buffer vertices;
+    vertices.setData(MeshTools::interleave(Positions, Normals), BufferUsage::StaticDraw);
+
+    ComputeProcessor processor;
+    processor.transformPointsInPlace(Matrix4::translation({1.0f, 2.0f, 3.0f}), {vertices, 0, 24}, 4);
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Normals stay untouched */
+    const std::vector<Vector3> data = read<Vector3>(vertices, 8);
+    CORRADE_COMPARE_AS(data, (std::vector<Vector3>{
+        {1.0f, 2.0f, 3.0f}, {0.0f, 0.0f, 1.0f},
+        {2.0f, 2.0f, 3.0f}, {1.0f, 0.0f, 0.0f},
+        {2.0f, 3.0f, 3.0f}, {0.0f, 1.0f, 0.0f},
+        {1.0f, 3.0f, 4.0f}, {0.0f, 0.0f, 1.0f}}), TestSuite::Compare::Container);
+}
+
+void ComputeProcessorGLTest::transformVectors() {
+    if(!isSupported()) CORRADE_SKIP("Compute shaders are not supported.");
+
+    Buffer vertices;
+    vertices.setData(MeshTools::interleave(Positions, Normals), BufferUsage::StaticDraw);
+
+    /* Translation is ignored, positions stay untouched */
+    ComputeProcessor processor;
+    processor.transformVectorsInPlace(Matrix4::translation({1.0f, 2.0f, 3.0f})*Matrix4::scaling(Vector3{2.0f}), {vertices, 12, 24}, 4);
+    MAGNUM_VERIFY_NO_ERROR();
+
+    const std::vector<Vector3> data = read<Vector3>(vertices, 8);
+    CORRADE_COMPARE_AS(data, (std::vector<Vector3>{
+        {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 2.0f},
+        {1.0f, 0.0f, 0.0f}, {2.0f, 0.0f, 0.0f},
+        {1.0f, 1.0f, 0.0f}, {0.0f, 2.0f, 0.0f},
+        {0.0f, 1.0f, 1.0f}, {0.0f, 0.0f, 2.0f}}), TestSuite::Compare::Container);
+}
+
+void ComputeProcessorGLTest::generateSmoothNormals() {
+    if(!isSupported()) CORRADE_SKIP("Compute shaders are not supported.");
+
+    Buffer vertices, indices;
+    vertices.setData(MeshTools::interleave(Positions, Normals), BufferUsage::StaticDraw);
+    indices.setData(Indices, BufferUsage::StaticDraw);
+
+    ComputeProcessor processor;
+    processor.generateSmoothNormals(indices, Indices.size(), {vertices, 0, 24}, {vertices, 12, 24}, 4);
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Should match the CPU implementation, positions stay untouched */
+    const std::vector<Vector3> expected = MeshTools::generateSmoothNormals(Indices, Positions);
+    const std::vector<Vector3> data = read<Vector3>(vertices, 8);
+    for(std::size_t i = 0; i != 4; ++i) {
+        CORRADE_COMPARE(data[i*2], Positions[i]);
+        for(std::size_t j = 0; j != 3; ++j)
+            CORRADE_COMPARE_WITH(data[i*2 + 1][j], expected[i][j], TestSuite::Compare::Around<Float>{1.0e-4f});
+    }
+
+    /* Second run reuses the accumulator, which should be cleared */
+    processor.generateSmoothNormals(indices, Indices.size(), {vertices, 0, 24}, {vertices, 12, 24}, 4);
+    MAGNUM_VERIFY_NO_ERROR();
+    const std::vector<Vector3> data2 = read<Vector3>(vertices, 8);
+    for(std::size_t i = 0; i != 4; ++i) for(std::size_t j = 0; j != 3; ++j)
+        CORRADE_COMPARE_WITH(data2[i*2 + 1][j], expected[i][j], TestSuite::Compare::Around<Float>{1.0e-4f});
+}
+
+void ComputeProcessorGLTest::cullMeshlets() {
+    if(!isSupported()) CORRADE_SKIP("Compute shaders are not supported.");
+
+    /* Two meshlets facing +Z, one at origin, one far on the left */
+    Meshlet meshlets[2]{};
+    meshlets[0].triangleOffset = 0;
+    meshlets[0].triangleCount = 4;
+    meshlets[0].center = {};
+    meshlets[0].radius = 1.0f;
+    meshlets[0].coneAxis = {0.0f, 0.0f, 1.0f};
+    meshlets[0].coneCutoff = 0.5f;
+    meshlets[1] = meshlets[0];
+    meshlets[1].triangleOffset = 12;
+    meshlets[1].triangleCount = 2;
+    meshlets[1].center = {-100.0f, 0.0f, 0.0f};
+
+    Buffer meshletBuffer, commands;
+    meshletBuffer.setData(meshlets, BufferUsage::StaticDraw);
+    commands.setData({nullptr, 2*sizeof(Mesh::DrawElementsIndirectCommand)}, BufferUsage::DynamicDraw);
+
+    /* Box -10 to 10 on all axes */
+    const Vector4 frustum[]{
+        { 1.0f,  0.0f,  0.0f, 10.0f},
+        {-1.0f,  0.0f,  0.0f, 10.0f},
+        { 0.0f,  1.0f,  0.0f, 10.0f},
+        { 0.0f, -1.0f,  0.0f, 10.0f},
+        { 0.0f,  0.0f,  1.0f, 10.0f},
+        { 0.0f,  0.0f, -1.0f, 10.0f}};
+
+    ComputeProcessor processor;
+
+    /* Camera in front, the second is outside of the frustum */
+    processor.cullMeshlets(meshletBuffer, 2, frustum, {0.0f, 0.0f, 5.0f}, commands);
+    MAGNUM_VERIFY_NO_ERROR();
+    {
+        const std::vector<UnsignedInt> data = read<UnsignedInt>(commands, 10);
+        CORRADE_COMPARE_AS(data, (std::vector<UnsignedInt>{
+            12, 1, 0, 0, 0,
+            6, 0, 12, 0, 0}), TestSuite::Compare::Container);
+    }
+
+    /* Camera behind, the first is backfacing */
+    processor.cullMeshlets(meshletBuffer, 2, frustum, {0.0f, 0.0f, -5.0f}, commands);
+    MAGNUM_VERIFY_NO_ERROR();
+    {
+        const std::vector<UnsignedInt> data = read<UnsignedInt>(commands, 10);
+        CORRADE_COMPARE_AS(data, (std::vector<UnsignedInt>{
+            12, 0, 0, 0, 0,
+            6, 0, 12, 0, 0}), TestSuite::Compare::Container);
+    }
+
+    /* Should match the CPU implementation */
+    CORRADE_VERIFY(!meshlets[0].isBackfacing({0.0f, 0.0f, 5.0f}));
+    CORRADE_VERIFY(meshlets[0].isBackfacing({0.0f, 0.0f, -5.0f}));
+}
+
+}}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::MeshTools::Test::ComputeProcessorGLTest)
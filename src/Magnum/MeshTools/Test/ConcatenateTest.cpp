@@ -0,0 +1,151 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/MeshTools/Concatenate.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct ConcatenateTest: TestSuite::Tester {
+    explicit ConcatenateTest();
+
+    void noMeshes();
+    void differentLayout();
+    void skinned();
+    void indexed();
+    void nonIndexed();
+    void normalsNonUniformScaling();
+};
+
+ConcatenateTest::ConcatenateTest() {
+    addTests({&ConcatenateTest::noMeshes,
+              &ConcatenateTest::differentLayout,
+              &ConcatenateTest::skinned,
+              &ConcatenateTest::indexed,
+              &ConcatenateTest::nonIndexed,
+              &ConcatenateTest::normalsNonUniformScaling});
+}
+
+typedef std::vector<std::pair<std::reference_wrapper<const Trade::MeshData3D>, Matrix4>> Meshes;
+
+void ConcatenateTest::noMeshes() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+    concatenate(Meshes{});
+
+    CORRADE_COMPARE(ss.str(), "MeshTools::concatenate(): no meshes passed\n");
+}
+
+void ConcatenateTest::differentLayout() {
+    const Trade::MeshData3D a{MeshPrimitive::Triangles, {0, 1, 2}, {{{}, {}, {}}}, {}, {}};
+    const Trade::MeshData3D b{MeshPrimitive::Triangles, {}, {{{}, {}, {}}}, {}, {}};
+
+    std::stringstream ss;
+    Error redirectError{&ss};
+    concatenate(Meshes{{a, {}}, {a, {}}, {b, {}}});
+
+    CORRADE_COMPARE(ss.str(), "MeshTools::concatenate(): mesh 2 has different primitive or layout than the first mesh\n");
+}
+
+void ConcatenateTest::skinned() {
+    const Trade::MeshData3D a{MeshPrimitive::Points, {}, {{{}}}, {}, {}, {{}}, {{1.0f, 0.0f, 0.0f, 0.0f}}};
+
+    std::stringstream ss;
+    Error redirectError{&ss};
+    concatenate(Meshes{{a, {}}});
+
+    CORRADE_COMPARE(ss.str(), "MeshTools::concatenate(): skinned meshes are not supported\n");
+}
+
+void ConcatenateTest::indexed() {
+    const Trade::MeshData3D a{MeshPrimitive::Triangles, {0, 1, 2},
+        {{{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}}},
+        {{Vector3::zAxis(), Vector3::zAxis(), Vector3::zAxis()}},
+        {{{0.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 1.0f}}}};
+    const Trade::MeshData3D b{MeshPrimitive::Triangles, {1, 0, 3, 1, 3, 2},
+        {{{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 0.0f}, {0.0f, 1.0f, 0.0f}}},
+        {{Vector3::zAxis(), Vector3::zAxis(), Vector3::zAxis(), Vector3::zAxis()}},
+        {{{0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}}}};
+
+    std::pair<Trade::MeshData3D, std::vector<MeshRange>> result = concatenate(Meshes{
+        {a, Matrix4::translation(Vector3::xAxis(5.0f))},
+        {b, Matrix4::rotationX(Deg(90.0f))}});
+    const Trade::MeshData3D& mesh = result.first;
+
+    CORRADE_COMPARE(mesh.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(mesh.indices(), (std::vector<UnsignedInt>{0, 1, 2, 4, 3, 6, 4, 6, 5}));
+    CORRADE_COMPARE(mesh.positionArrayCount(), 1);
+    CORRADE_COMPARE(mesh.positions(0).size(), 7);
+    CORRADE_COMPARE(mesh.positions(0)[1], (Vector3{6.0f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(mesh.positions(0)[6], (Vector3{0.0f, 0.0f, 1.0f}));
+    CORRADE_COMPARE(mesh.normals(0)[0], Vector3::zAxis());
+    CORRADE_COMPARE(mesh.normals(0)[3], -Vector3::yAxis());
+    CORRADE_COMPARE(mesh.textureCoords2D(0)[5], (Vector2{1.0f, 1.0f}));
+
+    CORRADE_COMPARE(result.second.size(), 2);
+    CORRADE_COMPARE(result.second[0].indexOffset, 0);
+    CORRADE_COMPARE(result.second[0].indexCount, 3);
+    CORRADE_COMPARE(result.second[0].vertexOffset, 0);
+    CORRADE_COMPARE(result.second[0].vertexCount, 3);
+    CORRADE_COMPARE(result.second[1].indexOffset, 3);
+    CORRADE_COMPARE(result.second[1].indexCount, 6);
+    CORRADE_COMPARE(result.second[1].vertexOffset, 3);
+    CORRADE_COMPARE(result.second[1].vertexCount, 4);
+}
+
+void ConcatenateTest::nonIndexed() {
+    const Trade::MeshData3D a{MeshPrimitive::Lines, {},
+        {{{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}}}, {}, {}};
+
+    std::pair<Trade::MeshData3D, std::vector<MeshRange>> result = concatenate(Meshes{
+        {a, Matrix4::translation(Vector3::yAxis(1.0f))},
+        {a, Matrix4::translation(Vector3::yAxis(2.0f))}});
+
+    CORRADE_VERIFY(!result.first.isIndexed());
+    CORRADE_COMPARE(result.first.normalArrayCount(), 0);
+    CORRADE_COMPARE(result.first.positions(0), (std::vector<Vector3>{
+        {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 0.0f},
+        {0.0f, 2.0f, 0.0f}, {1.0f, 2.0f, 0.0f}}));
+    CORRADE_COMPARE(result.second[1].indexCount, 0);
+    CORRADE_COMPARE(result.second[1].vertexOffset, 2);
+    CORRADE_COMPARE(result.second[1].vertexCount, 2);
+}
+
+void ConcatenateTest::normalsNonUniformScaling() {
+    /* Normal of a 45° slope stays perpendicular to it after scaling */
+    const Trade::MeshData3D a{MeshPrimitive::Points, {},
+        {{{}}}, {{Vector3{1.0f, 1.0f, 0.0f}.normalized()}}, {}};
+
+    std::pair<Trade::MeshData3D, std::vector<MeshRange>> result = concatenate(Meshes{
+        {a, Matrix4::scaling({2.0f, 1.0f, 1.0f})}});
+
+    CORRADE_COMPARE(result.first.normals(0)[0], (Vector3{1.0f, 2.0f, 0.0f}.normalized()));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::ConcatenateTest)
@@ -0,0 +1,141 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/GenerateBarycentric.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct GenerateBarycentricTest: TestSuite::Tester {
+    explicit GenerateBarycentricTest();
+
+    void wrongIndexCount();
+    void empty();
+    void generate();
+    void generateConflict();
+};
+
+GenerateBarycentricTest::GenerateBarycentricTest() {
+    addTests({&GenerateBarycentricTest::wrongIndexCount,
+              &GenerateBarycentricTest::empty,
+              &GenerateBarycentricTest::generate,
+              &GenerateBarycentricTest::generateConflict});
+}
+
+void GenerateBarycentricTest::wrongIndexCount() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+    std::vector<UnsignedInt> indices, mapping;
+    std::vector<Vector3> barycentric;
+    std::tie(indices, mapping, barycentric) = MeshTools::generateBarycentric({
+        0, 1
+    });
+
+    CORRADE_COMPARE(indices.size(), 0);
+    CORRADE_COMPARE(mapping.size(), 0);
+    CORRADE_COMPARE(barycentric.size(), 0);
+    CORRADE_COMPARE(ss.str(), "MeshTools::generateBarycentric(): index count is not divisible by 3!\n");
+}
+
+void GenerateBarycentricTest::empty() {
+    std::vector<UnsignedInt> indices, mapping;
+    std::vector<Vector3> barycentric;
+    std::tie(indices, mapping, barycentric) = MeshTools::generateBarycentric({});
+
+    CORRADE_COMPARE(indices.size(), 0);
+    CORRADE_COMPARE(mapping.size(), 0);
+    CORRADE_COMPARE(barycentric.size(), 0);
+}
+
+void GenerateBarycentricTest::generate() {
+    /* A quad made of two triangles, the shared edge can get coordinates
+       compatible with both faces, so no vertex needs to be duplicated */
+    std::vector<UnsignedInt> indices, mapping;
+    std::vector<Vector3> barycentric;
+    std::tie(indices, mapping, barycentric) = MeshTools::generateBarycentric({
+        0, 1, 2,
+        2, 1, 3
+    });
+
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{
+        0, 1, 2,
+        2, 1, 3
+    }));
+    CORRADE_COMPARE(mapping, (std::vector<UnsignedInt>{
+        0, 1, 2, 3
+    }));
+    CORRADE_COMPARE(barycentric, (std::vector<Vector3>{
+        Vector3::xAxis(1.0f),
+        Vector3::yAxis(1.0f),
+        Vector3::zAxis(1.0f),
+        Vector3::xAxis(1.0f)
+    }));
+}
+
+void GenerateBarycentricTest::generateConflict() {
+    /* Three triangles around a center vertex forming a closed fan. The
+       outer ring has an odd vertex count, so with the center taking one
+       coordinate the ring can't alternate between the remaining two and one
+       vertex has to be duplicated. */
+    const std::vector<UnsignedInt> original{
+        0, 1, 2,
+        0, 2, 3,
+        0, 3, 1
+    };
+    std::vector<UnsignedInt> indices, mapping;
+    std::vector<Vector3> barycentric;
+    std::tie(indices, mapping, barycentric) = MeshTools::generateBarycentric(original);
+
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{
+        0, 1, 2,
+        0, 2, 3,
+        0, 3, 4
+    }));
+    CORRADE_COMPARE(mapping, (std::vector<UnsignedInt>{
+        0, 1, 2, 3, 1
+    }));
+    CORRADE_COMPARE(barycentric, (std::vector<Vector3>{
+        Vector3::xAxis(1.0f),
+        Vector3::yAxis(1.0f),
+        Vector3::zAxis(1.0f),
+        Vector3::yAxis(1.0f),
+        Vector3::zAxis(1.0f)
+    }));
+
+    /* Every face has three distinct coordinates and references the original
+       vertices */
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        CORRADE_COMPARE(barycentric[indices[i]] + barycentric[indices[i + 1]] + barycentric[indices[i + 2]], Vector3{1.0f});
+        for(std::size_t j = 0; j != 3; ++j)
+            CORRADE_COMPARE(mapping[indices[i + j]], original[i + j]);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateBarycentricTest)
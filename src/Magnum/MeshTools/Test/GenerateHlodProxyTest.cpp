@@ -0,0 +1,128 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/MeshTools/GenerateHlodProxy.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct GenerateHlodProxyTest: TestSuite::Tester {
+    explicit GenerateHlodProxyTest();
+
+    void noMeshes();
+    void notIndexedTriangles();
+    void textureCoordinates();
+    void simplify();
+};
+
+GenerateHlodProxyTest::GenerateHlodProxyTest() {
+    addTests({&GenerateHlodProxyTest::noMeshes,
+              &GenerateHlodProxyTest::notIndexedTriangles,
+              &GenerateHlodProxyTest::textureCoordinates,
+              &GenerateHlodProxyTest::simplify});
+}
+
+typedef std::vector<std::tuple<std::reference_wrapper<const Trade::MeshData3D>, Matrix4, Range2D>> Meshes;
+
+void GenerateHlodProxyTest::noMeshes() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+    generateHlodProxy(Meshes{});
+
+    CORRADE_COMPARE(ss.str(), "MeshTools::generateHlodProxy(): no meshes passed\n");
+}
+
+void GenerateHlodProxyTest::notIndexedTriangles() {
+    const Trade::MeshData3D a{MeshPrimitive::Triangles, {0, 1, 2}, {{{}, {}, {}}}, {}, {}};
+    const Trade::MeshData3D b{MeshPrimitive::Triangles, {}, {{{}, {}, {}}}, {}, {}};
+
+    std::stringstream ss;
+    Error redirectError{&ss};
+    generateHlodProxy(Meshes{std::make_tuple(std::cref(a), Matrix4{}, Range2D{}),
+                             std::make_tuple(std::cref(b), Matrix4{}, Range2D{})});
+
+    CORRADE_COMPARE(ss.str(), "MeshTools::generateHlodProxy(): expected indexed triangle meshes\n");
+}
+
+void GenerateHlodProxyTest::textureCoordinates() {
+    const Trade::MeshData3D a{MeshPrimitive::Triangles, {0, 1, 2}, {{
+        {0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}
+    }}, {}, {{
+        {0.0f, 0.0f}, {1.0f, 0.0f}, {0.5f, 1.5f}
+    }}};
+
+    /* Ratio of 1 keeps everything, the coordinates are only remapped */
+    const Trade::MeshData3D proxy = generateHlodProxy(Meshes{
+        std::make_tuple(std::cref(a), Matrix4{}, Range2D{{0.0f, 0.0f}, {0.5f, 0.5f}}),
+        std::make_tuple(std::cref(a), Matrix4::translation(Vector3::zAxis(2.0f)), Range2D{{0.5f, 0.0f}, {1.0f, 0.25f}})}, 1.0f);
+
+    CORRADE_COMPARE(proxy.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(proxy.indices(), (std::vector<UnsignedInt>{0, 1, 2, 3, 4, 5}));
+    CORRADE_COMPARE(proxy.positions(0), (std::vector<Vector3>{
+        {0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f},
+        {0.0f, 0.0f, 2.0f}, {1.0f, 0.0f, 2.0f}, {0.0f, 1.0f, 2.0f}}));
+    CORRADE_VERIFY(!proxy.hasNormals());
+    CORRADE_COMPARE(proxy.textureCoords2D(0), (std::vector<Vector2>{
+        {0.0f, 0.0f}, {0.5f, 0.0f}, {0.25f, 0.5f},
+        {0.5f, 0.0f}, {1.0f, 0.0f}, {0.75f, 0.25f}}));
+}
+
+void GenerateHlodProxyTest::simplify() {
+    /* Grid of 8x8 quads in XY plane */
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    for(UnsignedInt y = 0; y <= 8; ++y) for(UnsignedInt x = 0; x <= 8; ++x)
+        positions.emplace_back(Float(x), Float(y), 0.0f);
+    for(UnsignedInt y = 0; y != 8; ++y) for(UnsignedInt x = 0; x != 8; ++x) {
+        const UnsignedInt i = y*9 + x;
+        indices.insert(indices.end(), {i, i + 1, i + 10, i, i + 10, i + 9});
+    }
+    const Trade::MeshData3D grid{MeshPrimitive::Triangles, indices, {positions}, {std::vector<Vector3>(positions.size(), Vector3::zAxis())}, {}};
+
+    const Trade::MeshData3D proxy = generateHlodProxy(Meshes{
+        std::make_tuple(std::cref(grid), Matrix4{}, Range2D{}),
+        std::make_tuple(std::cref(grid), Matrix4::translation(Vector3::yAxis(10.0f)), Range2D{})}, 0.1f);
+
+    /* The planes can be simplified a lot */
+    CORRADE_VERIFY(!proxy.indices().empty());
+    CORRADE_VERIFY(proxy.indices().size() <= 2*indices.size()/10);
+    CORRADE_VERIFY(!proxy.hasTextureCoords2D());
+    CORRADE_COMPARE(proxy.normals(0).size(), proxy.positions(0).size());
+
+    /* All remaining vertices are referenced */
+    std::vector<bool> referenced(proxy.positions(0).size());
+    for(const UnsignedInt index: proxy.indices()) {
+        CORRADE_VERIFY(index < referenced.size());
+        referenced[index] = true;
+    }
+    for(const bool i: referenced) CORRADE_VERIFY(i);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateHlodProxyTest)
@@ -0,0 +1,210 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <tuple>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/MeshTools/GenerateMeshlets.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct GenerateMeshletsTest: TestSuite::Tester {
+    explicit GenerateMeshletsTest();
+
+    void wrongIndexCount();
+    void wrongLimits();
+    void empty();
+    void generate();
+    void bounds();
+    void backfacing();
+    void indices();
+};
+
+GenerateMeshletsTest::GenerateMeshletsTest() {
+    addTests({&GenerateMeshletsTest::wrongIndexCount,
+              &GenerateMeshletsTest::wrongLimits,
+              &GenerateMeshletsTest::empty,
+              &GenerateMeshletsTest::generate,
+              &GenerateMeshletsTest::bounds,
+              &GenerateMeshletsTest::backfacing,
+              &GenerateMeshletsTest::indices});
+}
+
+namespace {
+    /* Grid of size*size quads in XY plane, facing +Z */
+    void grid(std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions, UnsignedInt size) {
+        for(UnsignedInt y = 0; y <= size; ++y) for(UnsignedInt x = 0; x <= size; ++x)
+            positions.emplace_back(Float(x), Float(y), 0.0f);
+
+        for(UnsignedInt y = 0; y != size; ++y) for(UnsignedInt x = 0; x != size; ++x) {
+            const UnsignedInt i = y*(size + 1) + x;
+            indices.insert(indices.end(), {i, i + 1, i + size + 2,
+                                           i, i + size + 2, i + size + 1});
+        }
+    }
+}
+
+void GenerateMeshletsTest::wrongIndexCount() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+    const Meshlets meshlets = MeshTools::generateMeshlets({0, 1}, {});
+
+    CORRADE_VERIFY(meshlets.meshlets.empty());
+    CORRADE_COMPARE(ss.str(), "MeshTools::generateMeshlets(): index count is not divisible by 3\n");
+}
+
+void GenerateMeshletsTest::wrongLimits() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+    MeshTools::generateMeshlets({0, 1, 2}, {{}, {}, {}}, 257, 124);
+    MeshTools::generateMeshlets({0, 1, 2}, {{}, {}, {}}, 64, 0);
+
+    CORRADE_COMPARE(ss.str(),
+        "MeshTools::generateMeshlets(): expected 3 to 256 vertices and 1 to 65535 triangles per meshlet but got 257 and 124\n"
+        "MeshTools::generateMeshlets(): expected 3 to 256 vertices and 1 to 65535 triangles per meshlet but got 64 and 0\n");
+}
+
+void GenerateMeshletsTest::empty() {
+    const Meshlets meshlets = MeshTools::generateMeshlets({}, {});
+    CORRADE_VERIFY(meshlets.meshlets.empty());
+    CORRADE_VERIFY(meshlets.vertices.empty());
+    CORRADE_VERIFY(meshlets.triangles.empty());
+}
+
+void GenerateMeshletsTest::generate() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    grid(indices, positions, 16);
+
+    const Meshlets meshlets = MeshTools::generateMeshlets(indices, positions, 64, 124);
+
+    /* 512 triangles, at least five meshlets needed */
+    CORRADE_VERIFY(meshlets.meshlets.size() >= 5);
+    CORRADE_VERIFY(meshlets.meshlets.size() <= 8);
+
+    /* The meshlets are contiguous, within limits and contain all the
+       original triangles */
+    std::vector<std::tuple<UnsignedInt, UnsignedInt, UnsignedInt>> expected, actual;
+    for(std::size_t i = 0; i != indices.size(); i += 3)
+        expected.emplace_back(indices[i], indices[i + 1], indices[i + 2]);
+    std::size_t vertexOffset = 0, triangleOffset = 0;
+    for(const Meshlet& meshlet: meshlets.meshlets) {
+        CORRADE_COMPARE(meshlet.vertexOffset, vertexOffset);
+        CORRADE_COMPARE(meshlet.triangleOffset, triangleOffset);
+        CORRADE_VERIFY(meshlet.vertexCount <= 64);
+        CORRADE_VERIFY(meshlet.triangleCount <= 124);
+        vertexOffset += meshlet.vertexCount;
+        triangleOffset += meshlet.triangleCount*3;
+
+        for(std::size_t i = 0; i != meshlet.triangleCount*3; i += 3) {
+            UnsignedInt v[3];
+            for(std::size_t j = 0; j != 3; ++j) {
+                const UnsignedByte local = meshlets.triangles[meshlet.triangleOffset + i + j];
+                CORRADE_VERIFY(local < meshlet.vertexCount);
+                v[j] = meshlets.vertices[meshlet.vertexOffset + local];
+            }
+            actual.emplace_back(v[0], v[1], v[2]);
+        }
+    }
+    CORRADE_COMPARE(vertexOffset, meshlets.vertices.size());
+    CORRADE_COMPARE(triangleOffset, meshlets.triangles.size());
+
+    std::sort(expected.begin(), expected.end());
+    std::sort(actual.begin(), actual.end());
+    CORRADE_VERIFY(actual == expected);
+}
+
+void GenerateMeshletsTest::bounds() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    grid(indices, positions, 16);
+
+    const Meshlets meshlets = MeshTools::generateMeshlets(indices, positions, 32, 32);
+    Float radiusSum = 0.0f;
+    for(const Meshlet& meshlet: meshlets.meshlets) {
+        for(std::size_t i = 0; i != meshlet.vertexCount; ++i)
+            CORRADE_VERIFY((positions[meshlets.vertices[meshlet.vertexOffset + i]] - meshlet.center).length() <= meshlet.radius*1.0001f);
+        radiusSum += meshlet.radius;
+
+        /* The plane is flat, so the cone is infinitely narrow */
+        CORRADE_COMPARE(meshlet.coneAxis, Vector3::zAxis());
+        CORRADE_COMPARE(meshlet.coneCutoff, 0.0f);
+    }
+
+    /* Meshlets are compact, not spanning whole rows of the grid */
+    CORRADE_VERIFY(radiusSum/meshlets.meshlets.size() < 5.0f);
+}
+
+void GenerateMeshletsTest::backfacing() {
+    /* One triangle facing +Z, one facing +X */
+    const std::vector<Vector3> positions{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {0.0f, 0.0f, -1.0f}
+    };
+    const Meshlets flat = MeshTools::generateMeshlets({0, 1, 2}, positions);
+    CORRADE_COMPARE(flat.meshlets.size(), 1);
+    CORRADE_VERIFY(flat.meshlets[0].isBackfacing({0.2f, 0.2f, -10.0f}));
+    CORRADE_VERIFY(!flat.meshlets[0].isBackfacing({0.2f, 0.2f, 10.0f}));
+    /* Looking from the side, some part of the sphere is front facing */
+    CORRADE_VERIFY(!flat.meshlets[0].isBackfacing({10.0f, 0.2f, -0.1f}));
+
+    const Meshlets bent = MeshTools::generateMeshlets({0, 1, 2, 0, 3, 2}, positions);
+    CORRADE_COMPARE(bent.meshlets.size(), 1);
+    CORRADE_COMPARE(bent.meshlets[0].coneAxis, Vector3(0.707107f, 0.0f, 0.707107f));
+    CORRADE_COMPARE(bent.meshlets[0].coneCutoff, 0.707107f);
+    CORRADE_VERIFY(bent.meshlets[0].isBackfacing({-10.0f, 0.2f, -10.0f}));
+    CORRADE_VERIFY(!bent.meshlets[0].isBackfacing({0.2f, 0.2f, -10.0f}));
+}
+
+void GenerateMeshletsTest::indices() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    grid(indices, positions, 8);
+
+    const Meshlets meshlets = MeshTools::generateMeshlets(indices, positions, 16, 20);
+    CORRADE_VERIFY(meshlets.meshlets.size() > 1);
+
+    /* Each meshlet range contains its triangles with global indices */
+    const std::vector<UnsignedInt> out = MeshTools::meshletIndices(meshlets);
+    CORRADE_COMPARE(out.size(), indices.size());
+    for(const Meshlet& meshlet: meshlets.meshlets) {
+        for(std::size_t i = 0; i != meshlet.triangleCount*3; ++i)
+            CORRADE_COMPARE(out[meshlet.triangleOffset + i],
+                meshlets.vertices[meshlet.vertexOffset + meshlets.triangles[meshlet.triangleOffset + i]]);
+    }
+
+    /* All triangles are there */
+    std::vector<UnsignedInt> sortedOut = out, sortedIndices = indices;
+    std::sort(sortedOut.begin(), sortedOut.end());
+    std::sort(sortedIndices.begin(), sortedIndices.end());
+    CORRADE_VERIFY(sortedOut == sortedIndices);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateMeshletsTest)
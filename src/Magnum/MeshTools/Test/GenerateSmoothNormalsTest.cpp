@@ -0,0 +1,146 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/GenerateSmoothNormals.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct GenerateSmoothNormalsTest: TestSuite::Tester {
+    explicit GenerateSmoothNormalsTest();
+
+    void wrongIndexCount();
+    void generate();
+    void angleWeighted();
+    void degenerate();
+    void parallel();
+};
+
+GenerateSmoothNormalsTest::GenerateSmoothNormalsTest() {
+    addTests({&GenerateSmoothNormalsTest::wrongIndexCount,
+              &GenerateSmoothNormalsTest::generate,
+              &GenerateSmoothNormalsTest::angleWeighted,
+              &GenerateSmoothNormalsTest::degenerate,
+              &GenerateSmoothNormalsTest::parallel});
+}
+
+void GenerateSmoothNormalsTest::wrongIndexCount() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+    const std::vector<Vector3> normals = MeshTools::generateSmoothNormals({0, 1}, {});
+
+    CORRADE_VERIFY(normals.empty());
+    CORRADE_COMPARE(ss.str(), "MeshTools::generateSmoothNormals(): index count is not divisible by 3\n");
+}
+
+void GenerateSmoothNormalsTest::generate() {
+    /* Two faces with a 90 degree bend along the shared edge */
+    const std::vector<Vector3> normals = MeshTools::generateSmoothNormals({
+        0, 1, 2,
+        0, 2, 3
+    }, {
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {0.0f, 0.0f, -1.0f}});
+
+    CORRADE_COMPARE(normals, (std::vector<Vector3>{
+        Vector3{-1.0f, 0.0f, 1.0f}.normalized(),
+        {0.0f, 0.0f, 1.0f},
+        Vector3{-1.0f, 0.0f, 1.0f}.normalized(),
+        {-1.0f, 0.0f, 0.0f}}));
+}
+
+void GenerateSmoothNormalsTest::angleWeighted() {
+    /* Cube corner at origin, the -Z face is split with diagonal going
+       through the origin, the others not. The corner normal should be the
+       same as if the faces were triangulated the same way. */
+    const std::vector<Vector3> normals = MeshTools::generateSmoothNormals({
+        0, 3, 2, 0, 2, 1,
+        0, 1, 5, 1, 4, 5,
+        0, 5, 3, 3, 5, 6
+    }, {
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {1.0f, 1.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {1.0f, 0.0f, 1.0f},
+        {0.0f, 0.0f, 1.0f},
+        {0.0f, 1.0f, 1.0f}});
+
+    CORRADE_COMPARE(normals.size(), 7);
+    CORRADE_COMPARE(normals[0], -Vector3{1.0f}.normalized());
+    CORRADE_COMPARE(normals[1], (-Vector3{0.0f, 1.0f, 1.0f}.normalized()));
+    CORRADE_COMPARE(normals[2], -Vector3::zAxis());
+    CORRADE_COMPARE(normals[4], -Vector3::yAxis());
+    CORRADE_COMPARE(normals[6], -Vector3::xAxis());
+}
+
+void GenerateSmoothNormalsTest::degenerate() {
+    /* Degenerate face doesn't contribute, unreferenced vertex gets zero
+       normal */
+    const std::vector<Vector3> normals = MeshTools::generateSmoothNormals({
+        0, 1, 2,
+        0, 1, 4
+    }, {
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {5.0f, 5.0f, 5.0f},
+        {2.0f, 0.0f, 0.0f}});
+
+    CORRADE_COMPARE(normals, (std::vector<Vector3>{
+        {0.0f, 0.0f, 1.0f},
+        {0.0f, 0.0f, 1.0f},
+        {0.0f, 0.0f, 1.0f},
+        {},
+        {}}));
+}
+
+void GenerateSmoothNormalsTest::parallel() {
+    /* Wavy grid large enough to be split into chunks */
+    constexpr UnsignedInt Size = 100;
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    for(UnsignedInt y = 0; y <= Size; ++y) for(UnsignedInt x = 0; x <= Size; ++x)
+        positions.emplace_back(Float(x), Float(y), std::sin(Float(x)*0.3f)*std::cos(Float(y)*0.2f));
+    for(UnsignedInt y = 0; y != Size; ++y) for(UnsignedInt x = 0; x != Size; ++x) {
+        const UnsignedInt i = y*(Size + 1) + x;
+        indices.insert(indices.end(), {i, i + 1, i + Size + 2,
+                                       i, i + Size + 2, i + Size + 1});
+    }
+
+    const std::vector<Vector3> expected = MeshTools::generateSmoothNormals(indices, positions);
+    const std::vector<Vector3> normals = MeshTools::generateSmoothNormals(indices, positions, 4);
+    CORRADE_COMPARE(normals.size(), positions.size());
+    CORRADE_VERIFY(normals == expected);
+    for(const Vector3& normal: normals) CORRADE_VERIFY(normal.z() > 0.0f);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateSmoothNormalsTest)
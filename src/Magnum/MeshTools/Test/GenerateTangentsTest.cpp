@@ -0,0 +1,140 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/MeshTools/GenerateTangents.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct GenerateTangentsTest: TestSuite::Tester {
+    explicit GenerateTangentsTest();
+
+    void wrongIndexCount();
+    void wrongAttributeCount();
+    void generate();
+    void mirrored();
+    void orthogonalize();
+    void degenerate();
+};
+
+GenerateTangentsTest::GenerateTangentsTest() {
+    addTests({&GenerateTangentsTest::wrongIndexCount,
+              &GenerateTangentsTest::wrongAttributeCount,
+              &GenerateTangentsTest::generate,
+              &GenerateTangentsTest::mirrored,
+              &GenerateTangentsTest::orthogonalize,
+              &GenerateTangentsTest::degenerate});
+}
+
+namespace {
+    const std::vector<UnsignedInt> quadIndices{0, 1, 2, 0, 2, 3};
+    const std::vector<Vector3> quadPositions{
+        {0.0f, 0.0f, 0.0f},
+        {2.0f, 0.0f, 0.0f},
+        {2.0f, 2.0f, 0.0f},
+        {0.0f, 2.0f, 0.0f}};
+    const std::vector<Vector3> quadNormals(4, Vector3::zAxis());
+}
+
+void GenerateTangentsTest::wrongIndexCount() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+    const std::vector<Vector4> tangents = MeshTools::generateTangents({0, 1}, {}, {}, {});
+
+    CORRADE_VERIFY(tangents.empty());
+    CORRADE_COMPARE(ss.str(), "MeshTools::generateTangents(): index count is not divisible by 3\n");
+}
+
+void GenerateTangentsTest::wrongAttributeCount() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+    const std::vector<Vector4> tangents = MeshTools::generateTangents(quadIndices, quadPositions, quadNormals, {{}, {}, {}});
+
+    CORRADE_VERIFY(tangents.empty());
+    CORRADE_COMPARE(ss.str(), "MeshTools::generateTangents(): expected 4 normals and texture coordinates but got 4 and 3\n");
+}
+
+void GenerateTangentsTest::generate() {
+    /* Texture U goes along -Y, V along +X */
+    const std::vector<Vector4> tangents = MeshTools::generateTangents(quadIndices, quadPositions, quadNormals, {
+        {1.0f, 0.0f},
+        {1.0f, 1.0f},
+        {0.0f, 1.0f},
+        {0.0f, 0.0f}});
+
+    CORRADE_COMPARE(tangents, std::vector<Vector4>(4, Vector4{0.0f, -1.0f, 0.0f, 1.0f}));
+}
+
+void GenerateTangentsTest::mirrored() {
+    /* U goes along -X, V along +Y, thus the basis is left-handed */
+    const std::vector<Vector4> tangents = MeshTools::generateTangents(quadIndices, quadPositions, quadNormals, {
+        {1.0f, 0.0f},
+        {0.0f, 0.0f},
+        {0.0f, 1.0f},
+        {1.0f, 1.0f}});
+
+    CORRADE_COMPARE(tangents, std::vector<Vector4>(4, Vector4{-1.0f, 0.0f, 0.0f, -1.0f}));
+}
+
+void GenerateTangentsTest::orthogonalize() {
+    /* Tilted normals, the tangent should stay orthogonal to them */
+    const std::vector<Vector3> normals{
+        Vector3{1.0f, 0.0f, 1.0f}.normalized(),
+        Vector3{1.0f, 0.0f, 1.0f}.normalized(),
+        Vector3{0.0f, 1.0f, 1.0f}.normalized(),
+        Vector3{0.0f, 1.0f, 1.0f}.normalized()};
+    const std::vector<Vector4> tangents = MeshTools::generateTangents(quadIndices, quadPositions, normals, {
+        {0.0f, 0.0f},
+        {1.0f, 0.0f},
+        {1.0f, 1.0f},
+        {0.0f, 1.0f}});
+
+    CORRADE_COMPARE(tangents.size(), 4);
+    for(std::size_t i = 0; i != 4; ++i) {
+        CORRADE_COMPARE(Math::dot(tangents[i].xyz(), normals[i]), 0.0f);
+        CORRADE_COMPARE(tangents[i].xyz().length(), 1.0f);
+        CORRADE_COMPARE(tangents[i].w(), 1.0f);
+    }
+    CORRADE_COMPARE(tangents[0], (Vector4{Vector3{1.0f, 0.0f, -1.0f}.normalized(), 1.0f}));
+    CORRADE_COMPARE(tangents[2], (Vector4{1.0f, 0.0f, 0.0f, 1.0f}));
+}
+
+void GenerateTangentsTest::degenerate() {
+    /* All texture coordinates the same, the tangent is arbitrary but
+       orthogonal */
+    const std::vector<Vector4> tangents = MeshTools::generateTangents(quadIndices, quadPositions, quadNormals, std::vector<Vector2>(4, Vector2{0.5f}));
+
+    CORRADE_COMPARE(tangents.size(), 4);
+    for(const Vector4& tangent: tangents) {
+        CORRADE_COMPARE(Math::dot(tangent.xyz(), Vector3::zAxis()), 0.0f);
+        CORRADE_COMPARE(tangent.xyz().length(), 1.0f);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateTangentsTest)
@@ -0,0 +1,81 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <vector>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Interleave.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct InterleaveBenchmark: TestSuite::Tester {
+    explicit InterleaveBenchmark();
+
+    void interleave();
+    void interleavePadded();
+    void interleaveInto();
+};
+
+namespace {
+    /* Each benchmark interleaves 256k vertices with position, normal and
+       texture coordinates 10 times */
+    constexpr std::size_t VertexCount = 256*1024;
+
+    const std::vector<Vector3> positions(VertexCount, Vector3{1.0f, 2.0f, 3.0f});
+    const std::vector<Vector3> normals(VertexCount, Vector3::zAxis());
+    const std::vector<Vector2> textureCoordinates(VertexCount, Vector2{0.5f});
+}
+
+InterleaveBenchmark::InterleaveBenchmark() {
+    addBenchmarks({&InterleaveBenchmark::interleave,
+                   &InterleaveBenchmark::interleavePadded,
+                   &InterleaveBenchmark::interleaveInto}, 5, BenchmarkType::WallClock);
+}
+
+void InterleaveBenchmark::interleave() {
+    std::size_t size{};
+    CORRADE_BENCHMARK(10)
+        size += MeshTools::interleave(positions, normals, textureCoordinates).size();
+    CORRADE_COMPARE(size, 10*VertexCount*32);
+}
+
+void InterleaveBenchmark::interleavePadded() {
+    std::size_t size{};
+    CORRADE_BENCHMARK(10)
+        size += MeshTools::interleave(positions, 4, normals, 4, textureCoordinates).size();
+    CORRADE_COMPARE(size, 10*VertexCount*40);
+}
+
+void InterleaveBenchmark::interleaveInto() {
+    Containers::Array<char> data{VertexCount*32};
+    CORRADE_BENCHMARK(10)
+        MeshTools::interleaveInto(data, positions, normals, textureCoordinates);
+    CORRADE_COMPARE(*reinterpret_cast<const Vector3*>(data.data() + 32), positions[1]);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::InterleaveBenchmark)
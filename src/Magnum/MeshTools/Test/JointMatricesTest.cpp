@@ -0,0 +1,122 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/JointMatrices.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct JointMatricesTest: TestSuite::Tester {
+    explicit JointMatricesTest();
+
+    void wrongCount();
+    void wrongOrder();
+    void bindPose();
+    void hierarchy();
+    void hierarchyDualQuaternion();
+};
+
+JointMatricesTest::JointMatricesTest() {
+    addTests({&JointMatricesTest::wrongCount,
+              &JointMatricesTest::wrongOrder,
+              &JointMatricesTest::bindPose,
+              &JointMatricesTest::hierarchy,
+              &JointMatricesTest::hierarchyDualQuaternion});
+}
+
+using namespace Math::Literals;
+
+namespace {
+    /* Three-joint chain along the Y axis */
+    const std::vector<Int> parents{-1, 0, 1};
+    const std::vector<Matrix4> bindPoseTransformations{
+        Matrix4::translation(Vector3::yAxis(1.0f)),
+        Matrix4::translation(Vector3::yAxis(2.0f)),
+        Matrix4::translation(Vector3::yAxis(1.5f))};
+    const std::vector<Matrix4> inverseBindMatrices{
+        Matrix4::translation(Vector3::yAxis(-1.0f)),
+        Matrix4::translation(Vector3::yAxis(-3.0f)),
+        Matrix4::translation(Vector3::yAxis(-4.5f))};
+}
+
+void JointMatricesTest::wrongCount() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+    const std::vector<Matrix4> joints = MeshTools::jointMatrices(parents, inverseBindMatrices, std::vector<Matrix4>(2));
+
+    CORRADE_VERIFY(joints.empty());
+    CORRADE_COMPARE(ss.str(), "MeshTools::jointMatrices(): expected 3 inverse bind matrices and transformations but got 3 and 2\n");
+}
+
+void JointMatricesTest::wrongOrder() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+    const std::vector<Matrix4> joints = MeshTools::jointMatrices({-1, 2, 0}, inverseBindMatrices, bindPoseTransformations);
+
+    CORRADE_VERIFY(joints.empty());
+    CORRADE_COMPARE(ss.str(), "MeshTools::jointMatrices(): parent 2 of joint 1 is not before it\n");
+}
+
+void JointMatricesTest::bindPose() {
+    /* Bind pose results in identity for all joints */
+    CORRADE_COMPARE(MeshTools::jointMatrices(parents, inverseBindMatrices, bindPoseTransformations),
+        (std::vector<Matrix4>{Matrix4{}, Matrix4{}, Matrix4{}}));
+}
+
+void JointMatricesTest::hierarchy() {
+    /* Bend the middle joint, the last joint follows */
+    std::vector<Matrix4> pose = bindPoseTransformations;
+    pose[1] = pose[1]*Matrix4::rotationZ(90.0_degf);
+    const std::vector<Matrix4> joints = MeshTools::jointMatrices(parents, inverseBindMatrices, pose);
+
+    CORRADE_COMPARE(joints.size(), 3);
+    CORRADE_COMPARE(joints[0], Matrix4{});
+
+    /* The joint origin stays in place, point above it gets rotated */
+    CORRADE_COMPARE(joints[1].transformPoint(Vector3::yAxis(3.0f)), Vector3::yAxis(3.0f));
+    CORRADE_COMPARE(joints[1].transformPoint(Vector3::yAxis(4.0f)), (Vector3{-1.0f, 3.0f, 0.0f}));
+    CORRADE_COMPARE(joints[2].transformPoint(Vector3::yAxis(4.5f)), (Vector3{-1.5f, 3.0f, 0.0f}));
+}
+
+void JointMatricesTest::hierarchyDualQuaternion() {
+    const std::vector<DualQuaternion> pose{
+        DualQuaternion::translation(Vector3::yAxis(1.0f)),
+        DualQuaternion::translation(Vector3::yAxis(2.0f))*DualQuaternion::rotation(90.0_degf, Vector3::zAxis()),
+        DualQuaternion::translation(Vector3::yAxis(1.5f))};
+    const std::vector<Matrix4> joints = MeshTools::jointMatrices(parents, inverseBindMatrices, pose);
+
+    CORRADE_COMPARE(joints.size(), 3);
+    CORRADE_COMPARE(joints[0], Matrix4{});
+    CORRADE_COMPARE(joints[1].transformPoint(Vector3::yAxis(4.0f)), (Vector3{-1.0f, 3.0f, 0.0f}));
+    CORRADE_COMPARE(joints[2].transformPoint(Vector3::yAxis(4.5f)), (Vector3{-1.5f, 3.0f, 0.0f}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::JointMatricesTest)
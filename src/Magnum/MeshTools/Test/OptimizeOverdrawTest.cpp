@@ -0,0 +1,92 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/OptimizeOverdraw.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct OptimizeOverdrawTest: TestSuite::Tester {
+    explicit OptimizeOverdrawTest();
+
+    void optimize();
+    void preserveOrder();
+    void empty();
+};
+
+OptimizeOverdrawTest::OptimizeOverdrawTest() {
+    addTests({&OptimizeOverdrawTest::optimize,
+              &OptimizeOverdrawTest::preserveOrder,
+              &OptimizeOverdrawTest::empty});
+}
+
+namespace {
+
+/* Two quads facing +Z, one at Z = -1 and one at Z = +1 */
+const std::vector<Vector3> Positions{
+    {-1.0f, -1.0f, -1.0f},
+    { 1.0f, -1.0f, -1.0f},
+    { 1.0f,  1.0f, -1.0f},
+    {-1.0f,  1.0f, -1.0f},
+
+    {-1.0f, -1.0f,  1.0f},
+    { 1.0f, -1.0f,  1.0f},
+    { 1.0f,  1.0f,  1.0f},
+    {-1.0f,  1.0f,  1.0f}
+};
+
+}
+
+void OptimizeOverdrawTest::optimize() {
+    /* The quad at -Z is facing inwards, should be drawn last */
+    std::vector<UnsignedInt> indices{0, 1, 2, 0, 2, 3,
+                                     4, 5, 6, 4, 6, 7};
+    optimizeOverdraw(indices, Positions, 16);
+
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{4, 5, 6, 4, 6, 7,
+                                                      0, 1, 2, 0, 2, 3}));
+}
+
+void OptimizeOverdrawTest::preserveOrder() {
+    /* Already in the right order, nothing to do */
+    const std::vector<UnsignedInt> original{4, 5, 6, 4, 6, 7,
+                                            0, 1, 2, 0, 2, 3};
+    std::vector<UnsignedInt> indices = original;
+    optimizeOverdraw(indices, Positions, 16);
+    CORRADE_COMPARE(indices, original);
+}
+
+void OptimizeOverdrawTest::empty() {
+    std::vector<UnsignedInt> indices;
+    optimizeOverdraw(indices, {}, 16);
+    CORRADE_VERIFY(indices.empty());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::OptimizeOverdrawTest)
@@ -0,0 +1,138 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <array>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/OptimizeVertexCache.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct OptimizeVertexCacheTest: TestSuite::Tester {
+    explicit OptimizeVertexCacheTest();
+
+    void analyze();
+    void analyzeEmpty();
+
+    void optimize();
+    void optimizeDegenerate();
+    void optimizeEmpty();
+};
+
+OptimizeVertexCacheTest::OptimizeVertexCacheTest() {
+    addTests({&OptimizeVertexCacheTest::analyze,
+              &OptimizeVertexCacheTest::analyzeEmpty,
+
+              &OptimizeVertexCacheTest::optimize,
+              &OptimizeVertexCacheTest::optimizeDegenerate,
+              &OptimizeVertexCacheTest::optimizeEmpty});
+}
+
+namespace {
+
+/* Grid of size*size quads with triangles ordered column by column, which is
+   bad if the cache is smaller than the column */
+std::vector<UnsignedInt> grid(const UnsignedInt size) {
+    std::vector<UnsignedInt> indices;
+    for(UnsignedInt x = 0; x != size; ++x) for(UnsignedInt y = 0; y != size; ++y) {
+        const UnsignedInt i = y*(size + 1) + x;
+        indices.insert(indices.end(), {i, i + 1, i + size + 2,
+                                       i, i + size + 2, i + size + 1});
+    }
+    return indices;
+}
+
+std::vector<std::array<UnsignedInt, 3>> sortedTriangles(const std::vector<UnsignedInt>& indices) {
+    std::vector<std::array<UnsignedInt, 3>> triangles;
+    for(std::size_t i = 0; i != indices.size(); i += 3)
+        triangles.push_back({{indices[i], indices[i + 1], indices[i + 2]}});
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+}
+
+void OptimizeVertexCacheTest::analyze() {
+    const std::vector<UnsignedInt> indices{0, 1, 2, 2, 1, 3};
+
+    /* Only the last vertex is a miss */
+    VertexCacheStatistics statistics = analyzeVertexCache(indices, 5, 2);
+    CORRADE_COMPARE(statistics.transformedVertexCount, 4);
+    CORRADE_COMPARE(statistics.acmr, 2.0f);
+    CORRADE_COMPARE(statistics.atvr, 1.0f);
+
+    /* Vertex 1 is already evicted from the cache */
+    statistics = analyzeVertexCache(indices, 5, 1);
+    CORRADE_COMPARE(statistics.transformedVertexCount, 5);
+    CORRADE_COMPARE(statistics.acmr, 2.5f);
+    CORRADE_COMPARE(statistics.atvr, 1.25f);
+}
+
+void OptimizeVertexCacheTest::analyzeEmpty() {
+    const VertexCacheStatistics statistics = analyzeVertexCache({}, 0, 16);
+    CORRADE_COMPARE(statistics.transformedVertexCount, 0);
+    CORRADE_COMPARE(statistics.acmr, 0.0f);
+    CORRADE_COMPARE(statistics.atvr, 0.0f);
+}
+
+void OptimizeVertexCacheTest::optimize() {
+    const std::vector<UnsignedInt> original = grid(32);
+    constexpr UnsignedInt VertexCount = 33*33;
+
+    std::vector<UnsignedInt> indices = original;
+    optimizeVertexCache(indices, VertexCount);
+
+    /* Same triangles, just in different order */
+    CORRADE_COMPARE(indices.size(), original.size());
+    CORRADE_VERIFY(sortedTriangles(indices) == sortedTriangles(original));
+
+    /* The cache efficiency should be considerably better than before, with
+       similar results for various cache sizes */
+    CORRADE_COMPARE(analyzeVertexCache(original, VertexCount, 16).acmr, 1.03125f);
+    CORRADE_VERIFY(analyzeVertexCache(indices, VertexCount, 16).acmr < 0.7f);
+    CORRADE_VERIFY(analyzeVertexCache(indices, VertexCount, 32).acmr < 0.7f);
+}
+
+void OptimizeVertexCacheTest::optimizeDegenerate() {
+    std::vector<UnsignedInt> indices{0, 1, 2,
+                                     2, 2, 3,
+                                     3, 1, 2};
+    optimizeVertexCache(indices, 4);
+
+    CORRADE_VERIFY(sortedTriangles(indices) == (std::vector<std::array<UnsignedInt, 3>>{
+        {{0, 1, 2}}, {{2, 2, 3}}, {{3, 1, 2}}}));
+}
+
+void OptimizeVertexCacheTest::optimizeEmpty() {
+    std::vector<UnsignedInt> indices;
+    optimizeVertexCache(indices, 0);
+    CORRADE_VERIFY(indices.empty());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::OptimizeVertexCacheTest)
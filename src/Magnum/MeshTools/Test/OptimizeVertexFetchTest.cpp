@@ -0,0 +1,67 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/Duplicate.h"
+#include "Magnum/MeshTools/OptimizeVertexFetch.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct OptimizeVertexFetchTest: TestSuite::Tester {
+    explicit OptimizeVertexFetchTest();
+
+    void optimize();
+};
+
+OptimizeVertexFetchTest::OptimizeVertexFetchTest() {
+    addTests({&OptimizeVertexFetchTest::optimize});
+}
+
+void OptimizeVertexFetchTest::optimize() {
+    std::vector<UnsignedInt> indices{4, 2, 0,
+                                     0, 2, 5,
+                                     5, 2, 1};
+    const std::vector<Int> data{0, 10, 20, 30, 40, 50};
+
+    /* Vertex 3 is unused */
+    const std::vector<UnsignedInt> order = optimizeVertexFetch(indices, data.size());
+    CORRADE_COMPARE(order, (std::vector<UnsignedInt>{4, 2, 0, 5, 1}));
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{0, 1, 2,
+                                                      2, 1, 3,
+                                                      3, 1, 4}));
+
+    /* The referenced data stay the same */
+    const std::vector<Int> optimized = duplicate(order, data);
+    CORRADE_COMPARE(duplicate(indices, optimized), (std::vector<Int>{
+        40, 20, 0,
+        0, 20, 50,
+        50, 20, 10}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::OptimizeVertexFetchTest)
@@ -0,0 +1,244 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/MeshTools/Quantize.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct QuantizeTest: TestSuite::Tester {
+    explicit QuantizeTest();
+
+    void positions();
+    void positionsFlat();
+    void positionsEmpty();
+    void normals();
+    void normalsOctahedral();
+    void textureCoordinates();
+    void textureCoordinatesHalf();
+
+    void interleave();
+    void interleaveFlags();
+};
+
+QuantizeTest::QuantizeTest() {
+    addTests({&QuantizeTest::positions,
+              &QuantizeTest::positionsFlat,
+              &QuantizeTest::positionsEmpty,
+              &QuantizeTest::normals,
+              &QuantizeTest::normalsOctahedral,
+              &QuantizeTest::textureCoordinates,
+              &QuantizeTest::textureCoordinatesHalf,
+
+              &QuantizeTest::interleave,
+              &QuantizeTest::interleaveFlags});
+}
+
+namespace {
+    Vector3 dequantize(const Matrix4& matrix, const Math::Vector3<Short>& position) {
+        return matrix.transformPoint(Vector3{position}/32767.0f);
+    }
+
+    Vector3 octahedralDecode(const Math::Vector2<Short>& normal) {
+        const Vector2 p = Vector2{normal}/32767.0f;
+        Vector3 out{p, 1.0f - std::abs(p.x()) - std::abs(p.y())};
+        if(out.z() < 0.0f) out.xy() = Vector2{
+            (1.0f - std::abs(p.y()))*(p.x() >= 0.0f ? 1.0f : -1.0f),
+            (1.0f - std::abs(p.x()))*(p.y() >= 0.0f ? 1.0f : -1.0f)};
+        return out.normalized();
+    }
+}
+
+void QuantizeTest::positions() {
+    const std::vector<Vector3> positions{
+        {-10.0f, 2.0f, 100.0f},
+        {30.0f, 4.0f, 150.0f},
+        {5.5f, 3.25f, 101.0f}};
+
+    const std::pair<std::vector<Math::Vector3<Short>>, Matrix4> quantized = MeshTools::quantizePositions(positions);
+    CORRADE_COMPARE(quantized.first.size(), 3);
+    CORRADE_COMPARE(quantized.first[0], (Math::Vector3<Short>{-32767, -32767, -32767}));
+    CORRADE_COMPARE(quantized.first[1], (Math::Vector3<Short>{32767, 32767, 32767}));
+    CORRADE_COMPARE(quantized.second, Matrix4::translation({10.0f, 3.0f, 125.0f})*Matrix4::scaling({20.0f, 1.0f, 25.0f}));
+
+    /* Round-trip error is at most half of the quantization step */
+    for(std::size_t i = 0; i != positions.size(); ++i) {
+        const Vector3 error = Math::abs(dequantize(quantized.second, quantized.first[i]) - positions[i]);
+        CORRADE_VERIFY(error.x() <= 20.0f/32767.0f);
+        CORRADE_VERIFY(error.y() <= 1.0f/32767.0f);
+        CORRADE_VERIFY(error.z() <= 25.0f/32767.0f);
+    }
+}
+
+void QuantizeTest::positionsFlat() {
+    /* Zero-size extent in Z shouldn't divide by zero */
+    const std::pair<std::vector<Math::Vector3<Short>>, Matrix4> quantized = MeshTools::quantizePositions({
+        {0.0f, 0.0f, 5.0f},
+        {2.0f, 4.0f, 5.0f}});
+
+    CORRADE_COMPARE(quantized.first[0], (Math::Vector3<Short>{-32767, -32767, 0}));
+    CORRADE_COMPARE(quantized.first[1], (Math::Vector3<Short>{32767, 32767, 0}));
+    CORRADE_COMPARE(dequantize(quantized.second, quantized.first[1]), (Vector3{2.0f, 4.0f, 5.0f}));
+}
+
+void QuantizeTest::positionsEmpty() {
+    const std::pair<std::vector<Math::Vector3<Short>>, Matrix4> quantized = MeshTools::quantizePositions({});
+    CORRADE_VERIFY(quantized.first.empty());
+    CORRADE_COMPARE(quantized.second, Matrix4{});
+}
+
+void QuantizeTest::normals() {
+    const std::vector<UnsignedInt> quantized = MeshTools::quantizeNormals({
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, -1.0f, 0.0f},
+        Vector3{0.0f, 1.0f, 1.0f}.normalized()});
+
+    CORRADE_COMPARE(quantized.size(), 3);
+    CORRADE_COMPARE(quantized[0], 511);
+    /* -511 in ten-bit two's complement is 0x201 */
+    CORRADE_COMPARE(quantized[1], 0x201 << 10);
+    CORRADE_COMPARE(quantized[2], (361 << 10)|(361 << 20));
+}
+
+void QuantizeTest::normalsOctahedral() {
+    const std::vector<Vector3> normals{
+        {0.0f, 0.0f, 1.0f},
+        {0.0f, 0.0f, -1.0f},
+        {1.0f, 0.0f, 0.0f},
+        Vector3{1.0f, -2.0f, 3.0f}.normalized(),
+        Vector3{-3.0f, 0.5f, -1.0f}.normalized(),
+        Vector3{0.25f, 0.5f, -4.0f}.normalized()};
+
+    const std::vector<Math::Vector2<Short>> quantized = MeshTools::quantizeNormalsOctahedral(normals);
+    CORRADE_COMPARE(quantized.size(), normals.size());
+    CORRADE_COMPARE(quantized[0], (Math::Vector2<Short>{0, 0}));
+    CORRADE_COMPARE(quantized[1], (Math::Vector2<Short>{32767, 32767}));
+    CORRADE_COMPARE(quantized[2], (Math::Vector2<Short>{32767, 0}));
+
+    /* The angular error should be below 0.01 degree, which is roughly
+       0.000175 in distance on a unit sphere */
+    for(std::size_t i = 0; i != normals.size(); ++i)
+        CORRADE_VERIFY((octahedralDecode(quantized[i]) - normals[i]).length() < 0.000175f);
+}
+
+void QuantizeTest::textureCoordinates() {
+    const std::vector<Math::Vector2<UnsignedShort>> quantized = MeshTools::quantizeTextureCoordinates({
+        {0.0f, 1.0f},
+        {0.5f, 0.25f},
+        {-1.0f, 2.0f}});
+
+    CORRADE_COMPARE(quantized.size(), 3);
+    CORRADE_COMPARE(quantized[0], (Math::Vector2<UnsignedShort>{0, 65535}));
+    CORRADE_COMPARE(quantized[1], (Math::Vector2<UnsignedShort>{32768, 16384}));
+    CORRADE_COMPARE(quantized[2], (Math::Vector2<UnsignedShort>{0, 65535}));
+}
+
+void QuantizeTest::textureCoordinatesHalf() {
+    const std::vector<Math::Vector2<UnsignedShort>> quantized = MeshTools::quantizeTextureCoordinatesHalf({
+        {0.0f, -0.0f},
+        {1.0f, -2.0f},
+        {0.333333f, 65504.0f},
+        {65520.0f, Constants::inf()},
+        /* Smallest subnormal and rounding of the halfway value to even */
+        {5.9604645e-08f, 1.0f + 1.0f/2048.0f},
+        {1.0f + 3.0f/2048.0f, 6.1035156e-05f}});
+
+    CORRADE_COMPARE(quantized[0], (Math::Vector2<UnsignedShort>{0x0000, 0x8000}));
+    CORRADE_COMPARE(quantized[1], (Math::Vector2<UnsignedShort>{0x3c00, 0xc000}));
+    CORRADE_COMPARE(quantized[2], (Math::Vector2<UnsignedShort>{0x3555, 0x7bff}));
+    CORRADE_COMPARE(quantized[3], (Math::Vector2<UnsignedShort>{0x7c00, 0x7c00}));
+    CORRADE_COMPARE(quantized[4], (Math::Vector2<UnsignedShort>{0x0001, 0x3c00}));
+    CORRADE_COMPARE(quantized[5], (Math::Vector2<UnsignedShort>{0x3c02, 0x0400}));
+}
+
+void QuantizeTest::interleave() {
+    const Trade::MeshData3D data{MeshPrimitive::Triangles, {0, 2, 1},
+        {{{-1.0f, 0.0f, 0.0f}, {1.0f, 2.0f, 0.0f}, {0.0f, 1.0f, 4.0f}}},
+        {{{0.0f, 0.0f, 1.0f}, {0.0f, -1.0f, 0.0f}, {1.0f, 0.0f, 0.0f}}},
+        {{{0.0f, 0.0f}, {1.0f, 0.5f}, {0.5f, 1.0f}}}};
+
+    const std::pair<Trade::MeshData, Matrix4> quantized = MeshTools::interleaveQuantized(data);
+    const Trade::MeshData& mesh = quantized.first;
+    CORRADE_COMPARE(quantized.second, Matrix4::translation({0.0f, 1.0f, 2.0f})*Matrix4::scaling({1.0f, 1.0f, 2.0f}));
+
+    CORRADE_COMPARE(mesh.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(mesh.vertexCount(), 3);
+    CORRADE_VERIFY(mesh.isIndexed());
+    CORRADE_COMPARE(mesh.indexType(), Trade::MeshIndexType::UnsignedByte);
+    CORRADE_COMPARE(mesh.indexData().size(), 3);
+    CORRADE_COMPARE(mesh.indexData()[1], 2);
+
+    CORRADE_COMPARE(mesh.vertexData().size(), 3*16);
+    CORRADE_COMPARE(mesh.attributeCount(), 3);
+    CORRADE_COMPARE(mesh.attribute(0).name(), Trade::MeshAttribute::Position);
+    CORRADE_COMPARE(mesh.attribute(0).type(), Trade::MeshAttributeType::Short);
+    CORRADE_COMPARE(mesh.attribute(0).components(), 3);
+    CORRADE_COMPARE(mesh.attribute(0).offset(), 0);
+    CORRADE_COMPARE(mesh.attribute(0).stride(), 16);
+    CORRADE_VERIFY(mesh.attribute(0).isNormalized());
+    CORRADE_COMPARE(mesh.attribute(1).name(), Trade::MeshAttribute::Normal);
+    CORRADE_COMPARE(mesh.attribute(1).type(), Trade::MeshAttributeType::Byte);
+    CORRADE_COMPARE(mesh.attribute(1).components(), 3);
+    CORRADE_COMPARE(mesh.attribute(1).offset(), 8);
+    CORRADE_VERIFY(mesh.attribute(1).isNormalized());
+    CORRADE_COMPARE(mesh.attribute(2).name(), Trade::MeshAttribute::TextureCoordinates);
+    CORRADE_COMPARE(mesh.attribute(2).type(), Trade::MeshAttributeType::HalfFloat);
+    CORRADE_COMPARE(mesh.attribute(2).components(), 2);
+    CORRADE_COMPARE(mesh.attribute(2).offset(), 12);
+    CORRADE_VERIFY(!mesh.attribute(2).isNormalized());
+
+    /* Second vertex */
+    const char* const vertex = mesh.vertexData() + 16;
+    CORRADE_COMPARE(*reinterpret_cast<const Math::Vector3<Short>*>(vertex), (Math::Vector3<Short>{32767, 32767, -32767}));
+    CORRADE_COMPARE(*reinterpret_cast<const Math::Vector3<Byte>*>(vertex + 8), (Math::Vector3<Byte>{0, -127, 0}));
+    CORRADE_COMPARE(*reinterpret_cast<const Math::Vector2<UnsignedShort>*>(vertex + 12), (Math::Vector2<UnsignedShort>{0x3c00, 0x3800}));
+}
+
+void QuantizeTest::interleaveFlags() {
+    std::vector<UnsignedInt> indices(300);
+    indices[299] = 299;
+    std::vector<Vector3> positions(300);
+    const Trade::MeshData3D data{MeshPrimitive::Points, indices, {positions},
+        {std::vector<Vector3>(300, Vector3::zAxis(-1.0f))}, {}};
+
+    const std::pair<Trade::MeshData, Matrix4> quantized = MeshTools::interleaveQuantized(data, QuantizeFlag::OctahedralNormals|QuantizeFlag::NormalizedTextureCoordinates);
+    const Trade::MeshData& mesh = quantized.first;
+    CORRADE_COMPARE(mesh.indexType(), Trade::MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE(mesh.vertexData().size(), 300*12);
+    CORRADE_COMPARE(mesh.attributeCount(), 2);
+    CORRADE_COMPARE(mesh.attribute(1).name(), Trade::MeshAttribute::Normal);
+    CORRADE_COMPARE(mesh.attribute(1).type(), Trade::MeshAttributeType::Short);
+    CORRADE_COMPARE(mesh.attribute(1).components(), 2);
+    CORRADE_COMPARE(mesh.attribute(1).stride(), 12);
+    CORRADE_COMPARE(*reinterpret_cast<const Math::Vector2<Short>*>(mesh.vertexData() + 12 + 8), (Math::Vector2<Short>{32767, 32767}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::QuantizeTest)
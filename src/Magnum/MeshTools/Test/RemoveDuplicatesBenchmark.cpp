@@ -0,0 +1,87 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/RemoveDuplicates.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct RemoveDuplicatesBenchmark: TestSuite::Tester {
+    explicit RemoveDuplicatesBenchmark();
+
+    void singleThreaded();
+    void multiThreaded();
+};
+
+namespace {
+    /* Positions of a 256x256 quad grid with each quad having its own four
+       vertices, i.e. 256k vertices collapsing into 66k unique ones */
+    constexpr Int GridSize = 256;
+
+    std::vector<Vector3> positions() {
+        std::vector<Vector3> out;
+        out.reserve(GridSize*GridSize*4);
+        for(Int y = 0; y != GridSize; ++y) for(Int x = 0; x != GridSize; ++x) {
+            out.push_back({Float(x), Float(y), 0.0f});
+            out.push_back({Float(x + 1), Float(y), 0.0f});
+            out.push_back({Float(x), Float(y + 1), 0.0f});
+            out.push_back({Float(x + 1), Float(y + 1), 0.0f});
+        }
+        return out;
+    }
+}
+
+RemoveDuplicatesBenchmark::RemoveDuplicatesBenchmark() {
+    addBenchmarks({&RemoveDuplicatesBenchmark::singleThreaded,
+                   &RemoveDuplicatesBenchmark::multiThreaded}, 5, BenchmarkType::WallClock);
+}
+
+void RemoveDuplicatesBenchmark::singleThreaded() {
+    const std::vector<Vector3> in = positions();
+    std::vector<Vector3> data;
+    std::vector<UnsignedInt> indices;
+    CORRADE_BENCHMARK(1) {
+        data = in;
+        indices = MeshTools::removeDuplicates(data);
+    }
+    CORRADE_COMPARE(data.size(), (GridSize + 1)*(GridSize + 1));
+}
+
+void RemoveDuplicatesBenchmark::multiThreaded() {
+    const std::vector<Vector3> in = positions();
+    std::vector<Vector3> data;
+    std::vector<UnsignedInt> indices;
+    CORRADE_BENCHMARK(1) {
+        data = in;
+        indices = MeshTools::removeDuplicates(data, Math::TypeTraits<Float>::epsilon(), 0);
+    }
+    CORRADE_COMPARE(data.size(), (GridSize + 1)*(GridSize + 1));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::RemoveDuplicatesBenchmark)
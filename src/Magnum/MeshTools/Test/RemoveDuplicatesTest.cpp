@@ -26,6 +26,7 @@
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Vector2.h"
+#include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
 
 namespace Magnum { namespace MeshTools { namespace Test {
@@ -34,10 +35,16 @@ struct RemoveDuplicatesTest: TestSuite::Tester {
     explicit RemoveDuplicatesTest();
 
     void removeDuplicates();
+    void empty();
+    void cellBoundary();
+    void parallel();
 };
 
 RemoveDuplicatesTest::RemoveDuplicatesTest() {
-    addTests({&RemoveDuplicatesTest::removeDuplicates});
+    addTests({&RemoveDuplicatesTest::removeDuplicates,
+              &RemoveDuplicatesTest::empty,
+              &RemoveDuplicatesTest::cellBoundary,
+              &RemoveDuplicatesTest::parallel});
 }
 
 void RemoveDuplicatesTest::removeDuplicates() {
@@ -59,6 +66,47 @@ void RemoveDuplicatesTest::removeDuplicates() {
     }));
 }
 
+void RemoveDuplicatesTest::empty() {
+    std::vector<Vector3> data;
+    CORRADE_VERIFY(MeshTools::removeDuplicates(data).empty());
+    CORRADE_VERIFY(data.empty());
+}
+
+void RemoveDuplicatesTest::cellBoundary() {
+    /* The first two vectors are on different sides of a cell boundary, the
+       third is on the other side of the first vector, but too far from it */
+    std::vector<Vector2> data{
+        {0.059f, 0.5f},
+        {0.061f, 0.5f},
+        {0.0f, 0.5f},
+        {0.061f, 0.52f}
+    };
+
+    const std::vector<UnsignedInt> indices = MeshTools::removeDuplicates(data, 0.03f);
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{0, 0, 1, 0}));
+    CORRADE_COMPARE(data, (std::vector<Vector2>{
+        {0.059f, 0.5f},
+        {0.0f, 0.5f}
+    }));
+}
+
+void RemoveDuplicatesTest::parallel() {
+    /* Triangle-soup-like data, each position repeated a few times with slight
+       noise, scattered across the whole array */
+    std::vector<Vector3> data;
+    for(std::size_t i = 0; i != 60000; ++i) {
+        const std::size_t id = (i*7919) % 10000;
+        data.emplace_back(Float(id % 100), Float(id/100), (i % 3)*0.0001f);
+    }
+    std::vector<Vector3> dataParallel = data;
+
+    const std::vector<UnsignedInt> indices = MeshTools::removeDuplicates(data, 0.001f);
+    const std::vector<UnsignedInt> indicesParallel = MeshTools::removeDuplicates(dataParallel, 0.001f, 4);
+    CORRADE_COMPARE(data.size(), 10000);
+    CORRADE_VERIFY(indicesParallel == indices);
+    CORRADE_VERIFY(dataParallel == data);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::RemoveDuplicatesTest)
@@ -0,0 +1,160 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Simplify.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct SimplifyTest: TestSuite::Tester {
+    explicit SimplifyTest();
+
+    void wrongIndexCount();
+    void plane();
+    void seam();
+    void maxError();
+    void generateLods();
+};
+
+SimplifyTest::SimplifyTest() {
+    addTests({&SimplifyTest::wrongIndexCount,
+              &SimplifyTest::plane,
+              &SimplifyTest::seam,
+              &SimplifyTest::maxError,
+              &SimplifyTest::generateLods});
+}
+
+namespace {
+    /* Grid of size*size quads in XY plane, with optional bump in the middle */
+    void grid(std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions, UnsignedInt size, Float bump = 0.0f) {
+        for(UnsignedInt y = 0; y <= size; ++y) for(UnsignedInt x = 0; x <= size; ++x) {
+            const Float z = ((x == size/2 && y == size/2) ? bump : 0.0f);
+            positions.emplace_back(Float(x), Float(y), z);
+        }
+
+        for(UnsignedInt y = 0; y != size; ++y) for(UnsignedInt x = 0; x != size; ++x) {
+            const UnsignedInt i = y*(size + 1) + x;
+            indices.insert(indices.end(), {i, i + 1, i + size + 2,
+                                           i, i + size + 2, i + size + 1});
+        }
+    }
+
+    bool referenced(const std::vector<UnsignedInt>& indices, UnsignedInt vertex) {
+        return std::find(indices.begin(), indices.end(), vertex) != indices.end();
+    }
+}
+
+void SimplifyTest::wrongIndexCount() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+    const std::vector<UnsignedInt> indices = MeshTools::simplify({0, 1}, {}, 0);
+
+    CORRADE_VERIFY(indices.empty());
+    CORRADE_COMPARE(ss.str(), "MeshTools::simplify(): index count is not divisible by 3\n");
+}
+
+void SimplifyTest::plane() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    grid(indices, positions, 8);
+
+    /* Flat plane can be simplified almost without any error, the corners
+       have to stay */
+    const std::vector<UnsignedInt> simplified = MeshTools::simplify(indices, positions, 0, 0.001f);
+    CORRADE_VERIFY(simplified.size() < indices.size()/8);
+    CORRADE_COMPARE(simplified.size() % 3, 0);
+    CORRADE_VERIFY(referenced(simplified, 0));
+    CORRADE_VERIFY(referenced(simplified, 8));
+    CORRADE_VERIFY(referenced(simplified, 72));
+    CORRADE_VERIFY(referenced(simplified, 80));
+
+    /* All triangles still face the same direction */
+    for(std::size_t i = 0; i != simplified.size(); i += 3) {
+        const Vector3& a = positions[simplified[i]];
+        CORRADE_VERIFY(Math::cross(positions[simplified[i + 1]] - a, positions[simplified[i + 2]] - a).z() > 0.0f);
+    }
+}
+
+void SimplifyTest::seam() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    grid(indices, positions, 8);
+
+    /* Split the middle column into two, as if there was a texture seam */
+    for(UnsignedInt y = 0; y <= 8; ++y)
+        positions.push_back(positions[y*9 + 4]);
+    for(UnsignedInt& index: indices) {
+        const UnsignedInt y = index/9;
+        if(index % 9 != 4) continue;
+
+        /* Triangles on the right side of the seam use the new vertices */
+        const std::size_t triangle = &index - &indices[0] - (&index - &indices[0])%3;
+        bool right = false;
+        for(std::size_t j = 0; j != 3; ++j) if(indices[triangle + j] % 9 > 4 && indices[triangle + j] < 81) right = true;
+        if(right) index = 81 + y;
+    }
+
+    const std::vector<UnsignedInt> simplified = MeshTools::simplify(indices, positions, 0, 0.001f);
+    CORRADE_VERIFY(simplified.size() < indices.size()/2);
+    for(UnsignedInt y = 0; y <= 8; ++y) {
+        CORRADE_VERIFY(referenced(simplified, y*9 + 4));
+        CORRADE_VERIFY(referenced(simplified, 81 + y));
+    }
+}
+
+void SimplifyTest::maxError() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    grid(indices, positions, 8, 2.0f);
+
+    /* The bump can't be collapsed with small error */
+    const std::vector<UnsignedInt> simplified = MeshTools::simplify(indices, positions, 0, 0.1f);
+    CORRADE_VERIFY(referenced(simplified, 40));
+
+    /* But it can with large one */
+    const std::vector<UnsignedInt> simplifiedMore = MeshTools::simplify(indices, positions, 0, 10.0f);
+    CORRADE_VERIFY(simplifiedMore.size() < simplified.size());
+}
+
+void SimplifyTest::generateLods() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    grid(indices, positions, 16, 2.0f);
+
+    const std::vector<std::vector<UnsignedInt>> lods = MeshTools::generateLods(indices, positions, 4);
+    CORRADE_COMPARE(lods.size(), 4);
+    CORRADE_VERIFY(lods[0] == indices);
+    for(std::size_t i = 1; i != lods.size(); ++i) {
+        CORRADE_VERIFY(lods[i].size() <= lods[i - 1].size()/2);
+        CORRADE_COMPARE(lods[i].size() % 3, 0);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SimplifyTest)
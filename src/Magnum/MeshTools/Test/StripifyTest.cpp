@@ -0,0 +1,135 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <algorithm>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/MeshTools/Stripify.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct StripifyTest: TestSuite::Tester {
+    explicit StripifyTest();
+
+    void quad();
+    void disconnected();
+    void startRotation();
+    void grid();
+
+    void wrongIndexCount();
+};
+
+StripifyTest::StripifyTest() {
+    addTests({&StripifyTest::quad,
+              &StripifyTest::disconnected,
+              &StripifyTest::startRotation,
+              &StripifyTest::grid,
+
+              &StripifyTest::wrongIndexCount});
+}
+
+namespace {
+    constexpr UnsignedInt Restart = 0xffff;
+
+    /* Converts strips back to triangles, each rotated so the smallest index
+       is first, and sorts them. Degenerate triangles are dropped. */
+    std::vector<std::vector<UnsignedInt>> triangles(const std::vector<UnsignedInt>& strips) {
+        std::vector<std::vector<UnsignedInt>> out;
+        std::size_t begin = 0;
+        for(std::size_t i = 0; i <= strips.size(); ++i) {
+            if(i != strips.size() && strips[i] != Restart) continue;
+            for(std::size_t j = begin; j + 2 < i; ++j) {
+                std::vector<UnsignedInt> t;
+                if((j - begin) % 2 == 0) t = {strips[j], strips[j + 1], strips[j + 2]};
+                else t = {strips[j + 1], strips[j], strips[j + 2]};
+                if(t[0] == t[1] || t[1] == t[2] || t[2] == t[0]) continue;
+                std::rotate(t.begin(), std::min_element(t.begin(), t.end()), t.end());
+                out.push_back(t);
+            }
+            begin = i + 1;
+        }
+
+        std::sort(out.begin(), out.end());
+        return out;
+    }
+
+    std::vector<std::vector<UnsignedInt>> triangleList(const std::vector<UnsignedInt>& indices) {
+        std::vector<UnsignedInt> strips;
+        for(std::size_t i = 0; i != indices.size(); i += 3) {
+            if(i) strips.push_back(Restart);
+            strips.insert(strips.end(), indices.begin() + i, indices.begin() + i + 3);
+        }
+        return triangles(strips);
+    }
+}
+
+void StripifyTest::quad() {
+    CORRADE_COMPARE(MeshTools::stripify({0, 1, 2, 2, 1, 3}, Restart),
+        (std::vector<UnsignedInt>{0, 1, 2, 3}));
+}
+
+void StripifyTest::disconnected() {
+    CORRADE_COMPARE(MeshTools::stripify({0, 1, 2, 3, 4, 5}, Restart),
+        (std::vector<UnsignedInt>{0, 1, 2, Restart, 3, 4, 5}));
+}
+
+void StripifyTest::startRotation() {
+    /* The shared edge is 0 -> 2, so the strip has to start at 1 */
+    const std::vector<UnsignedInt> indices{0, 1, 2, 0, 2, 3};
+    const std::vector<UnsignedInt> strips = MeshTools::stripify(indices, Restart);
+    CORRADE_COMPARE(strips, (std::vector<UnsignedInt>{1, 2, 0, 3}));
+    CORRADE_COMPARE(triangles(strips), triangleList(indices));
+}
+
+void StripifyTest::grid() {
+    /* 4x4 quads, row by row */
+    std::vector<UnsignedInt> indices;
+    for(UnsignedInt y = 0; y != 4; ++y) for(UnsignedInt x = 0; x != 4; ++x) {
+        const UnsignedInt i = y*5 + x;
+        indices.insert(indices.end(), {i, i + 1, i + 5, i + 5, i + 1, i + 6});
+    }
+
+    const std::vector<UnsignedInt> strips = MeshTools::stripify(indices, Restart);
+
+    /* One strip per row, each starting with a degenerate triangle to get
+       the winding right */
+    CORRADE_COMPARE(std::count(strips.begin(), strips.end(), Restart), 3);
+    CORRADE_COMPARE(strips.size(), 4*11 + 3);
+    CORRADE_COMPARE(strips[0], strips[1]);
+    CORRADE_COMPARE(triangles(strips), triangleList(indices));
+}
+
+void StripifyTest::wrongIndexCount() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshTools::stripify({0, 1}, Restart);
+    CORRADE_COMPARE(out.str(), "MeshTools::stripify(): index count is not divisible by 3\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::StripifyTest)
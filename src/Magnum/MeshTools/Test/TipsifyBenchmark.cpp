@@ -0,0 +1,71 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/MeshTools/Tipsify.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct TipsifyBenchmark: Corrade::TestSuite::Tester {
+    explicit TipsifyBenchmark();
+
+    void tipsify();
+};
+
+namespace {
+    /* Triangles of a 256x256 quad grid, 128k triangles in total. The quads
+       are listed column by column to have something to optimize. */
+    constexpr UnsignedInt GridSize = 256;
+
+    std::vector<UnsignedInt> indices() {
+        std::vector<UnsignedInt> out;
+        out.reserve(GridSize*GridSize*6);
+        for(UnsignedInt x = 0; x != GridSize; ++x) for(UnsignedInt y = 0; y != GridSize; ++y) {
+            const UnsignedInt i = y*(GridSize + 1) + x;
+            out.insert(out.end(), {i, i + 1, i + GridSize + 1,
+                                   i + GridSize + 1, i + 1, i + GridSize + 2});
+        }
+        return out;
+    }
+}
+
+TipsifyBenchmark::TipsifyBenchmark() {
+    addBenchmarks({&TipsifyBenchmark::tipsify}, 5, BenchmarkType::WallClock);
+}
+
+void TipsifyBenchmark::tipsify() {
+    const std::vector<UnsignedInt> in = indices();
+    std::vector<UnsignedInt> data;
+    CORRADE_BENCHMARK(1) {
+        data = in;
+        MeshTools::tipsify(data, (GridSize + 1)*(GridSize + 1), 24);
+    }
+    CORRADE_COMPARE(data.size(), in.size());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::TipsifyBenchmark)
@@ -0,0 +1,110 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/Transform.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct TransformBenchmark: TestSuite::Tester {
+    explicit TransformBenchmark();
+
+    void pointsMatrixGeneric();
+    void pointsMatrixArray();
+    void pointsDualQuaternionGeneric();
+    void pointsDualQuaternionArray();
+    void vectorsQuaternionGeneric();
+    void vectorsQuaternionArray();
+};
+
+namespace {
+    /* Each benchmark transforms 1M vectors 10 times, divide the iteration
+       count by the measured time to get vectors per second */
+    constexpr std::size_t VectorCount = 1024*1024;
+
+    const Matrix4 matrix = Matrix4::translation({1.0f, 2.0f, 3.0f})*
+        Matrix4::rotation(Deg(35.0f), Vector3{1.0f, 2.0f, -1.0f}.normalized())*
+        Matrix4::scaling({2.0f, 1.0f, 0.5f});
+    const DualQuaternion dualQuaternion = DualQuaternion::translation({1.0f, 2.0f, 3.0f})*
+        DualQuaternion::rotation(Deg(35.0f), Vector3{1.0f, 2.0f, -1.0f}.normalized());
+    const Quaternion quaternion = Quaternion::rotation(Deg(35.0f), Vector3{1.0f, 2.0f, -1.0f}.normalized());
+}
+
+TransformBenchmark::TransformBenchmark() {
+    addBenchmarks({&TransformBenchmark::pointsMatrixGeneric,
+                   &TransformBenchmark::pointsMatrixArray,
+                   &TransformBenchmark::pointsDualQuaternionGeneric,
+                   &TransformBenchmark::pointsDualQuaternionArray,
+                   &TransformBenchmark::vectorsQuaternionGeneric,
+                   &TransformBenchmark::vectorsQuaternionArray}, 5, BenchmarkType::WallClock);
+}
+
+void TransformBenchmark::pointsMatrixGeneric() {
+    std::vector<Vector3> points(VectorCount, Vector3{1.0f});
+    CORRADE_BENCHMARK(10)
+        MeshTools::transformPointsInPlace(matrix, points);
+    CORRADE_VERIFY(points[0] != Vector3{1.0f});
+}
+
+void TransformBenchmark::pointsMatrixArray() {
+    std::vector<Vector3> points(VectorCount, Vector3{1.0f});
+    CORRADE_BENCHMARK(10)
+        MeshTools::transformPointsInPlace(matrix, {points.data(), points.size()});
+    CORRADE_VERIFY(points[0] != Vector3{1.0f});
+}
+
+void TransformBenchmark::pointsDualQuaternionGeneric() {
+    std::vector<Vector3> points(VectorCount, Vector3{1.0f});
+    CORRADE_BENCHMARK(10)
+        MeshTools::transformPointsInPlace(dualQuaternion, points);
+    CORRADE_VERIFY(points[0] != Vector3{1.0f});
+}
+
+void TransformBenchmark::pointsDualQuaternionArray() {
+    std::vector<Vector3> points(VectorCount, Vector3{1.0f});
+    CORRADE_BENCHMARK(10)
+        MeshTools::transformPointsInPlace(dualQuaternion, {points.data(), points.size()});
+    CORRADE_VERIFY(points[0] != Vector3{1.0f});
+}
+
+void TransformBenchmark::vectorsQuaternionGeneric() {
+    std::vector<Vector3> vectors(VectorCount, Vector3{1.0f});
+    CORRADE_BENCHMARK(10)
+        MeshTools::transformVectorsInPlace(quaternion, vectors);
+    CORRADE_VERIFY(vectors[0] != Vector3{1.0f});
+}
+
+void TransformBenchmark::vectorsQuaternionArray() {
+    std::vector<Vector3> vectors(VectorCount, Vector3{1.0f});
+    CORRADE_BENCHMARK(10)
+        MeshTools::transformVectorsInPlace(quaternion, {vectors.data(), vectors.size()});
+    CORRADE_VERIFY(vectors[0] != Vector3{1.0f});
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::TransformBenchmark)
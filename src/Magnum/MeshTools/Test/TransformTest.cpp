@@ -24,6 +24,7 @@
 */
 
 #include <array>
+#include <vector>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Matrix3.h"
@@ -40,6 +41,10 @@ struct TransformTest: TestSuite::Tester {
 
     void transformPoints2D();
     void transformPoints3D();
+
+    void transformVectorsArray();
+    void transformPointsArray();
+    void transformPointsArrayProjective();
 };
 
 TransformTest::TransformTest() {
@@ -47,7 +52,11 @@ TransformTest::TransformTest() {
               &TransformTest::transformVectors3D,
 
               &TransformTest::transformPoints2D,
-              &TransformTest::transformPoints3D});
+              &TransformTest::transformPoints3D,
+
+              &TransformTest::transformVectorsArray,
+              &TransformTest::transformPointsArray,
+              &TransformTest::transformPointsArrayProjective});
 }
 
 constexpr static std::array<Vector2, 2> points2D{{
@@ -116,6 +125,65 @@ void TransformTest::transformPoints3D() {
     CORRADE_COMPARE(quaternion, points3DRotatedTranslated);
 }
 
+namespace {
+    /* Odd count so both the SIMD and the scalar remainder path are used */
+    std::vector<Vector3> pointsArray() {
+        std::vector<Vector3> points;
+        for(std::size_t i = 0; i != 19; ++i)
+            points.emplace_back(Float(i) - 7.5f, 0.25f*Float(i*i), 3.0f - Float(i%5));
+        return points;
+    }
+}
+
+void TransformTest::transformVectorsArray() {
+    const Matrix4 matrix = Matrix4::translation({1.0f, 2.0f, 3.0f})*
+        Matrix4::rotation(Deg(35.0f), Vector3{1.0f, 2.0f, -1.0f}.normalized())*
+        Matrix4::scaling({2.0f, 1.0f, 0.5f});
+    const Quaternion quaternion = Quaternion::rotation(Deg(35.0f), Vector3{1.0f, 2.0f, -1.0f}.normalized());
+
+    const std::vector<Vector3> expectedMatrix = MeshTools::transformVectors(matrix, pointsArray());
+    const std::vector<Vector3> expectedQuaternion = MeshTools::transformVectors(quaternion, pointsArray());
+
+    std::vector<Vector3> transformedMatrix = pointsArray();
+    std::vector<Vector3> transformedQuaternion = pointsArray();
+    MeshTools::transformVectorsInPlace(matrix, {transformedMatrix.data(), transformedMatrix.size()});
+    MeshTools::transformVectorsInPlace(quaternion, {transformedQuaternion.data(), transformedQuaternion.size()});
+
+    CORRADE_COMPARE(transformedMatrix, expectedMatrix);
+    CORRADE_COMPARE(transformedQuaternion, expectedQuaternion);
+}
+
+void TransformTest::transformPointsArray() {
+    const Matrix4 matrix = Matrix4::translation({1.0f, 2.0f, 3.0f})*
+        Matrix4::rotation(Deg(35.0f), Vector3{1.0f, 2.0f, -1.0f}.normalized())*
+        Matrix4::scaling({2.0f, 1.0f, 0.5f});
+    const DualQuaternion dualQuaternion = DualQuaternion::translation({1.0f, 2.0f, 3.0f})*
+        DualQuaternion::rotation(Deg(35.0f), Vector3{1.0f, 2.0f, -1.0f}.normalized());
+
+    const std::vector<Vector3> expectedMatrix = MeshTools::transformPoints(matrix, pointsArray());
+    const std::vector<Vector3> expectedDualQuaternion = MeshTools::transformPoints(dualQuaternion, pointsArray());
+
+    std::vector<Vector3> transformedMatrix = pointsArray();
+    std::vector<Vector3> transformedDualQuaternion = pointsArray();
+    MeshTools::transformPointsInPlace(matrix, {transformedMatrix.data(), transformedMatrix.size()});
+    MeshTools::transformPointsInPlace(dualQuaternion, {transformedDualQuaternion.data(), transformedDualQuaternion.size()});
+
+    CORRADE_COMPARE(transformedMatrix, expectedMatrix);
+    CORRADE_COMPARE(transformedDualQuaternion, expectedDualQuaternion);
+}
+
+void TransformTest::transformPointsArrayProjective() {
+    const Matrix4 matrix = Matrix4::perspectiveProjection(Deg(60.0f), 1.5f, 0.1f, 100.0f)*
+        Matrix4::translation(Vector3::zAxis(-50.0f));
+
+    const std::vector<Vector3> expected = MeshTools::transformPoints(matrix, pointsArray());
+
+    std::vector<Vector3> transformed = pointsArray();
+    MeshTools::transformPointsInPlace(matrix, {transformed.data(), transformed.size()});
+
+    CORRADE_COMPARE(transformed, expected);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::TransformTest)
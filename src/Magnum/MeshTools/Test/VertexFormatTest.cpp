@@ -0,0 +1,93 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/VertexFormat.h"
+#include "Magnum/Shaders/Generic.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct VertexFormatTest: Corrade::TestSuite::Tester {
+    explicit VertexFormatTest();
+
+    void layout();
+    void attribute();
+    void attributeDataType();
+};
+
+VertexFormatTest::VertexFormatTest() {
+    addTests({&VertexFormatTest::layout,
+              &VertexFormatTest::attribute,
+              &VertexFormatTest::attributeDataType});
+}
+
+namespace {
+    struct Vertex {
+        Vector3 position;
+        Math::Vector3<Byte> normal;
+        UnsignedByte padding;
+        Vector2 textureCoordinates;
+    };
+
+    typedef VertexAttribute<Shaders::Generic3D::Position, offsetof(Vertex, position)> Position;
+    typedef VertexAttribute<Shaders::Generic3D::Normal, offsetof(Vertex, normal), Shaders::Generic3D::Normal::DataType::Byte, Shaders::Generic3D::Normal::DataOption::Normalized> Normal;
+    typedef VertexAttribute<Shaders::Generic3D::TextureCoordinates, offsetof(Vertex, textureCoordinates)> TextureCoordinates;
+
+    typedef VertexFormat<Vertex, Position, Normal, TextureCoordinates> Format;
+}
+
+void VertexFormatTest::layout() {
+    constexpr std::size_t stride = Format::Stride;
+    constexpr std::size_t attributeCount = Format::AttributeCount;
+    CORRADE_COMPARE(stride, 24);
+    CORRADE_COMPARE(attributeCount, 3);
+
+    constexpr std::size_t normalOffset = Normal::Offset;
+    constexpr std::size_t textureCoordinatesOffset = TextureCoordinates::Offset;
+    CORRADE_COMPARE(std::size_t(Position::Offset), 0);
+    CORRADE_COMPARE(normalOffset, 12);
+    CORRADE_COMPARE(textureCoordinatesOffset, 16);
+}
+
+void VertexFormatTest::attribute() {
+    constexpr Shaders::Generic3D::Position attribute = Position::attribute();
+    CORRADE_VERIFY(attribute.dataType() == Shaders::Generic3D::Position::DataType::Float);
+    CORRADE_VERIFY(attribute.dataOptions() == Shaders::Generic3D::Position::DataOptions{});
+    CORRADE_COMPARE(attribute.vectorSize(), 12);
+}
+
+void VertexFormatTest::attributeDataType() {
+    constexpr Shaders::Generic3D::Normal attribute = Normal::attribute();
+    CORRADE_VERIFY(attribute.dataType() == Shaders::Generic3D::Normal::DataType::Byte);
+    CORRADE_VERIFY(attribute.dataOptions() == Shaders::Generic3D::Normal::DataOption::Normalized);
+    CORRADE_COMPARE(attribute.vectorSize(), 3);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::VertexFormatTest)
@@ -71,6 +71,8 @@ array for beter usage of post-transform vertex cache. Algorithm used:
 *Pedro V. Sander, Diego Nehab, and Joshua Barczak - Fast Triangle Reordering
 for Vertex Locality and Reduced Overdraw, SIGGRAPH 2007,
 http://gfx.cs.princeton.edu/pubs/Sander_2007_%3ETR/index.php*.
+@see @ref optimizeVertexCache(), @ref optimizeOverdraw(),
+    @ref analyzeVertexCache()
 @todo Ability to compute vertex count automatically
 */
 inline void tipsify(std::vector<UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize) {
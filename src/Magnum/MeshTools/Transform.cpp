@@ -0,0 +1,213 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include "Transform.h"
+
+#include "Magnum/Math/Matrix4.h"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* The kernels work on structure-of-arrays data, so one register holds
+   the same component of four (or eight) vectors. The matrix is broadcast to
+   registers once and the AoS input is transposed on load and store. */
+
+#if defined(__SSE2__) || defined(__AVX__)
+/* x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3 -> x0 x1 x2 x3 | y.. | z.. */
+inline void load4(const Float* const data, __m128& x, __m128& y, __m128& z) {
+    const __m128 in0 = _mm_loadu_ps(data);
+    const __m128 in1 = _mm_loadu_ps(data + 4);
+    const __m128 in2 = _mm_loadu_ps(data + 8);
+    const __m128 x2y2x3y3 = _mm_shuffle_ps(in1, in2, _MM_SHUFFLE(2, 1, 3, 2));
+    const __m128 y0z0y1z1 = _mm_shuffle_ps(in0, in1, _MM_SHUFFLE(1, 0, 2, 1));
+    const __m128 x0x1 = _mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 0, 3, 0));
+    const __m128 z2z3 = _mm_shuffle_ps(in2, in2, _MM_SHUFFLE(3, 0, 3, 0));
+    x = _mm_shuffle_ps(x0x1, x2y2x3y3, _MM_SHUFFLE(2, 0, 1, 0));
+    y = _mm_shuffle_ps(y0z0y1z1, x2y2x3y3, _MM_SHUFFLE(3, 1, 2, 0));
+    z = _mm_shuffle_ps(y0z0y1z1, z2z3, _MM_SHUFFLE(1, 0, 3, 1));
+}
+
+/* Inverse of load4() */
+inline void store4(Float* const data, const __m128 x, const __m128 y, const __m128 z) {
+    const __m128 x0y0x1y1 = _mm_unpacklo_ps(x, y);
+    const __m128 x2y2x3y3 = _mm_unpackhi_ps(x, y);
+    const __m128 z0z0x1x1 = _mm_shuffle_ps(z, x0y0x1y1, _MM_SHUFFLE(2, 2, 0, 0));
+    const __m128 y1y1z1z1 = _mm_shuffle_ps(x0y0x1y1, z, _MM_SHUFFLE(1, 1, 3, 3));
+    const __m128 z2z2x3x3 = _mm_shuffle_ps(z, x2y2x3y3, _MM_SHUFFLE(2, 2, 2, 2));
+    const __m128 y3y3z3z3 = _mm_shuffle_ps(x2y2x3y3, z, _MM_SHUFFLE(3, 3, 3, 3));
+    _mm_storeu_ps(data, _mm_shuffle_ps(x0y0x1y1, z0z0x1x1, _MM_SHUFFLE(2, 0, 1, 0)));
+    _mm_storeu_ps(data + 4, _mm_shuffle_ps(y1y1z1z1, x2y2x3y3, _MM_SHUFFLE(1, 0, 2, 0)));
+    _mm_storeu_ps(data + 8, _mm_shuffle_ps(z2z2x3x3, y3y3z3z3, _MM_SHUFFLE(2, 0, 2, 0)));
+}
+struct Sse {
+    typedef __m128 Type;
+    static __m128 add(__m128 a, __m128 b) { return _mm_add_ps(a, b); }
+    static __m128 mul(__m128 a, __m128 b) { return _mm_mul_ps(a, b); }
+    static __m128 div(__m128 a, __m128 b) { return _mm_div_ps(a, b); }
+    static __m128 broadcast(Float a) { return _mm_set1_ps(a); }
+};
+#endif
+
+#ifdef __AVX__
+struct Avx {
+    typedef __m256 Type;
+    static __m256 add(__m256 a, __m256 b) { return _mm256_add_ps(a, b); }
+    static __m256 mul(__m256 a, __m256 b) { return _mm256_mul_ps(a, b); }
+    static __m256 div(__m256 a, __m256 b) { return _mm256_div_ps(a, b); }
+    static __m256 broadcast(Float a) { return _mm256_set1_ps(a); }
+};
+
+/* Eight vectors as two transposed halves */
+inline void load8(const Float* const data, __m256& x, __m256& y, __m256& z) {
+    __m128 x0, y0, z0, x1, y1, z1;
+    load4(data, x0, y0, z0);
+    load4(data + 12, x1, y1, z1);
+    x = _mm256_insertf128_ps(_mm256_castps128_ps256(x0), x1, 1);
+    y = _mm256_insertf128_ps(_mm256_castps128_ps256(y0), y1, 1);
+    z = _mm256_insertf128_ps(_mm256_castps128_ps256(z0), z1, 1);
+}
+
+inline void store8(Float* const data, const __m256 x, const __m256 y, const __m256 z) {
+    store4(data, _mm256_castps256_ps128(x), _mm256_castps256_ps128(y), _mm256_castps256_ps128(z));
+    store4(data + 12, _mm256_extractf128_ps(x, 1), _mm256_extractf128_ps(y, 1), _mm256_extractf128_ps(z, 1));
+}
+#endif
+
+#if defined(__ARM_NEON) && !defined(__SSE2__)
+struct Neon {
+    typedef float32x4_t Type;
+    static float32x4_t add(float32x4_t a, float32x4_t b) { return vaddq_f32(a, b); }
+    static float32x4_t mul(float32x4_t a, float32x4_t b) { return vmulq_f32(a, b); }
+    static float32x4_t broadcast(Float a) { return vdupq_n_f32(a); }
+
+    /* There's no vector division on ARMv7, refine the reciprocal estimate
+       with two Newton-Raphson steps instead */
+    static float32x4_t div(float32x4_t a, float32x4_t b) {
+        float32x4_t reciprocal = vrecpeq_f32(b);
+        reciprocal = vmulq_f32(vrecpsq_f32(b, reciprocal), reciprocal);
+        reciprocal = vmulq_f32(vrecpsq_f32(b, reciprocal), reciprocal);
+        return vmulq_f32(a, reciprocal);
+    }
+};
+#endif
+
+#if defined(__SSE2__) || defined(__AVX__) || defined(__ARM_NEON)
+template<class Isa> struct BroadcastMatrix {
+    explicit BroadcastMatrix(const Matrix4& matrix) {
+        for(std::size_t col = 0; col != 4; ++col)
+            for(std::size_t row = 0; row != 4; ++row)
+                data[col][row] = Isa::broadcast(matrix[col][row]);
+    }
+
+    typename Isa::Type data[4][4];
+};
+
+template<class Isa, class V = typename Isa::Type> inline V transformRow(const BroadcastMatrix<Isa>& m, const std::size_t row, const V x, const V y, const V z) {
+    return Isa::add(Isa::add(Isa::mul(m.data[0][row], x), Isa::mul(m.data[1][row], y)),
+                    Isa::add(Isa::mul(m.data[2][row], z), m.data[3][row]));
+}
+
+template<class Isa, class V = typename Isa::Type> inline void transform(const BroadcastMatrix<Isa>& m, const bool projective, V& x, V& y, V& z) {
+    const V tx = transformRow(m, 0, x, y, z);
+    const V ty = transformRow(m, 1, x, y, z);
+    const V tz = transformRow(m, 2, x, y, z);
+    if(projective) {
+        const V w = transformRow(m, 3, x, y, z);
+        x = Isa::div(tx, w);
+        y = Isa::div(ty, w);
+        z = Isa::div(tz, w);
+    } else {
+        x = tx;
+        y = ty;
+        z = tz;
+    }
+}
+#endif
+
+void transformPoints(const Matrix4& matrix, Containers::ArrayView<Vector3> points) {
+    const bool projective = matrix.row(3) != Vector4{0.0f, 0.0f, 0.0f, 1.0f};
+    Float* data = points.data()->data();
+    std::size_t count = points.size();
+
+    #ifdef __AVX__
+    const BroadcastMatrix<Avx> m8{matrix};
+    for(; count >= 8; count -= 8, data += 24) {
+        __m256 x, y, z;
+        load8(data, x, y, z);
+        transform(m8, projective, x, y, z);
+        store8(data, x, y, z);
+    }
+    #endif
+
+    #if defined(__SSE2__) || defined(__AVX__)
+    const BroadcastMatrix<Sse> m4{matrix};
+    for(; count >= 4; count -= 4, data += 12) {
+        __m128 x, y, z;
+        load4(data, x, y, z);
+        transform(m4, projective, x, y, z);
+        store4(data, x, y, z);
+    }
+    #elif defined(__ARM_NEON)
+    const BroadcastMatrix<Neon> m4{matrix};
+    for(; count >= 4; count -= 4, data += 12) {
+        float32x4x3_t xyz = vld3q_f32(data);
+        transform(m4, projective, xyz.val[0], xyz.val[1], xyz.val[2]);
+        vst3q_f32(data, xyz);
+    }
+    #endif
+
+    Vector3* const remaining = reinterpret_cast<Vector3*>(data);
+    for(std::size_t i = 0; i != count; ++i)
+        remaining[i] = matrix.transformPoint(remaining[i]);
+}
+
+}
+
+void transformVectorsInPlace(const Matrix4& matrix, const Containers::ArrayView<Vector3> vectors) {
+    /* Drop the translation and projection */
+    transformPoints(Matrix4::from(matrix.rotationScaling(), {}), vectors);
+}
+
+void transformVectorsInPlace(const Quaternion& normalizedQuaternion, const Containers::ArrayView<Vector3> vectors) {
+    transformPoints(Matrix4::from(normalizedQuaternion.toMatrix(), {}), vectors);
+}
+
+void transformPointsInPlace(const Matrix4& matrix, const Containers::ArrayView<Vector3> points) {
+    transformPoints(matrix, points);
+}
+
+void transformPointsInPlace(const DualQuaternion& normalizedDualQuaternion, const Containers::ArrayView<Vector3> points) {
+    transformPoints(normalizedDualQuaternion.toMatrix(), points);
+}
+
+}}
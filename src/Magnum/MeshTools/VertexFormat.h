@@ -0,0 +1,188 @@
+#ifndef Magnum_MeshTools_VertexFormat_h
+#define Magnum_MeshTools_VertexFormat_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::MeshTools::VertexAttribute, @ref Magnum::MeshTools::VertexFormat, function @ref Magnum::MeshTools::compile()
+ */
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <tuple>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Buffer.h"
+#include "Magnum/Mesh.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace Implementation {
+    template<class T> constexpr T vertexAttributeOptions() { return T{}; }
+    template<class T, class U, class ...V> constexpr T vertexAttributeOptions(U first, V... next) {
+        return T{first}|vertexAttributeOptions<T>(next...);
+    }
+
+    template<class> struct VertexFormatIndexType;
+    template<> struct VertexFormatIndexType<UnsignedByte> {
+        constexpr static Mesh::IndexType Value = Mesh::IndexType::UnsignedByte;
+    };
+    template<> struct VertexFormatIndexType<UnsignedShort> {
+        constexpr static Mesh::IndexType Value = Mesh::IndexType::UnsignedShort;
+    };
+    template<> struct VertexFormatIndexType<UnsignedInt> {
+        constexpr static Mesh::IndexType Value = Mesh::IndexType::UnsignedInt;
+    };
+}
+
+/**
+@brief Vertex attribute at fixed offset in a vertex structure
+@tparam Attribute   Shader attribute, e.g. @ref Shaders::Generic3D::Position
+@tparam offset      Offset of the attribute in the vertex structure, usually
+    obtained with `offsetof()`
+@tparam dataType    Type of the data in the structure
+@tparam options     Data options, e.g. @ref Attribute::DataOption::Normalized
+
+Used as a parameter of @ref VertexFormat. All properties are compile-time
+constants.
+*/
+template<class Attribute, std::size_t offset, typename Attribute::DataType dataType = typename Attribute::DataType(Magnum::Implementation::Attribute<typename Attribute::Type>::DefaultDataType), typename Attribute::DataOption ...options> struct VertexAttribute {
+    /** @brief Shader attribute */
+    typedef Attribute Type;
+
+    enum: std::size_t {
+        Offset = offset /**< Offset in the vertex structure */
+    };
+
+    /** @brief Attribute description passed to @ref Mesh::addVertexBuffer() */
+    constexpr static Attribute attribute() {
+        return Attribute{dataType, Implementation::vertexAttributeOptions<typename Attribute::DataOptions>(options...)};
+    }
+};
+
+/**
+@brief Compile-time vertex format
+@tparam Vertex      Vertex structure
+@tparam Attributes  List of @ref VertexAttribute instances
+
+Describes layout of a vertex structure, from which the mesh setup is generated
+with no runtime interpretation of the layout. Stride is always the size of the
+vertex structure, the gap after each attribute is calculated from its offset
+and size. Example usage:
+@code
+struct Vertex {
+    Vector3 position;
+    Vector3 normal;
+    Vector2 textureCoordinates;
+};
+
+typedef MeshTools::VertexFormat<Vertex,
+    MeshTools::VertexAttribute<Shaders::Phong::Position, offsetof(Vertex, position)>,
+    MeshTools::VertexAttribute<Shaders::Phong::Normal, offsetof(Vertex, normal)>,
+    MeshTools::VertexAttribute<Shaders::Phong::TextureCoordinates, offsetof(Vertex, textureCoordinates)>> Format;
+
+std::vector<Vertex> vertices;
+Mesh mesh;
+std::unique_ptr<Buffer> vertexBuffer, indexBuffer;
+std::tie(mesh, vertexBuffer, indexBuffer) = MeshTools::compile<Format>(MeshPrimitive::Triangles, vertices, BufferUsage::StaticDraw);
+@endcode
+@see @ref compile(MeshPrimitive, Containers::ArrayView<const typename Format::Type>, BufferUsage)
+*/
+template<class Vertex, class ...Attributes> struct VertexFormat {
+    /** @brief Vertex structure */
+    typedef Vertex Type;
+
+    enum: std::size_t {
+        Stride = sizeof(Vertex),                /**< Vertex stride */
+        AttributeCount = sizeof...(Attributes)  /**< Attribute count */
+    };
+
+    /**
+     * @brief Add vertex buffer to the mesh
+     *
+     * Calls @ref Mesh::addVertexBuffer() for each attribute, with the
+     * attribute offset added to @p offset.
+     */
+    static void addVertexBuffer(Mesh& mesh, Buffer& buffer, GLintptr offset = 0) {
+        /* Expands to one addVertexBuffer() call per attribute, the casts
+           silence unused parameter warnings for empty formats */
+        static_cast<void>(std::initializer_list<int>{(addAttribute<Attributes>(mesh, buffer, offset), 0)...});
+        static_cast<void>(mesh);
+        static_cast<void>(buffer);
+        static_cast<void>(offset);
+    }
+
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    template<class T> static void addAttribute(Mesh& mesh, Buffer& buffer, GLintptr offset) {
+        static_assert(std::size_t(T::Offset) < std::size_t(Stride), "attribute offset is out of vertex bounds");
+        constexpr typename T::Type attribute = T::attribute();
+        mesh.addVertexBuffer(buffer, offset + T::Offset, attribute,
+            GLintptr(std::size_t(Stride) - std::size_t(T::Offset) - attribute.vectorSize()*T::Type::VectorCount));
+    }
+    #endif
+};
+
+/**
+@brief Compile mesh with compile-time vertex format
+
+Uploads @p vertices directly to a vertex buffer and configures the mesh using
+@ref VertexFormat::addVertexBuffer(), without any intermediate copies. The
+second returned buffer is always `nullptr`.
+@see @ref compile(const Trade::MeshData&, BufferUsage)
+*/
+template<class Format> std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const MeshPrimitive primitive, const Containers::ArrayView<const typename Format::Type> vertices, const BufferUsage usage) {
+    Mesh mesh{primitive};
+    std::unique_ptr<Buffer> vertexBuffer{new Buffer{Buffer::TargetHint::Array}};
+    vertexBuffer->setData(vertices, usage);
+    Format::addVertexBuffer(mesh, *vertexBuffer);
+    mesh.setCount(vertices.size());
+    return std::make_tuple(std::move(mesh), std::move(vertexBuffer), std::unique_ptr<Buffer>{});
+}
+
+/**
+@brief Compile indexed mesh with compile-time vertex format
+
+Same as above, but additionally uploads @p indices to an index buffer. The
+index type is deduced from @p T, which can be @ref UnsignedByte,
+@ref UnsignedShort or @ref UnsignedInt. Index range is not calculated, to
+avoid an extra pass over the data.
+*/
+template<class Format, class T> std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const MeshPrimitive primitive, const Containers::ArrayView<const typename Format::Type> vertices, const Containers::ArrayView<const T> indices, const BufferUsage usage) {
+    Mesh mesh{primitive};
+    std::unique_ptr<Buffer> vertexBuffer{new Buffer{Buffer::TargetHint::Array}};
+    vertexBuffer->setData(vertices, usage);
+    Format::addVertexBuffer(mesh, *vertexBuffer);
+
+    std::unique_ptr<Buffer> indexBuffer{new Buffer{Buffer::TargetHint::ElementArray}};
+    indexBuffer->setData(indices, usage);
+    mesh.setCount(indices.size())
+        .setIndexBuffer(*indexBuffer, 0, Implementation::VertexFormatIndexType<T>::Value);
+    return std::make_tuple(std::move(mesh), std::move(vertexBuffer), std::move(indexBuffer));
+}
+
+}}
+
+#endif
@@ -29,7 +29,10 @@
 #include <Corrade/Utility/Assert.h>
 
 #include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Buffer.h"
+#include "Magnum/CommandObserver.h"
 #include "Magnum/Context.h"
+#include "Magnum/FrameAllocator.h"
 #include "Magnum/Mesh.h"
 
 #include "Implementation/State.h"
@@ -37,8 +40,7 @@
 
 namespace Magnum {
 
-void MeshView::draw(AbstractShaderProgram& shader, std::initializer_list<std::reference_wrapper<MeshView>> meshes) {
-    /* Why std::initializer_list doesn't have empty()? */
+void MeshView::draw(AbstractShaderProgram& shader, Containers::ArrayView<const std::reference_wrapper<MeshView>> meshes) {
     if(!meshes.size()) return;
 
     shader.use();
@@ -56,16 +58,52 @@ void MeshView::draw(AbstractShaderProgram& shader, std::initializer_list<std::re
     #endif
 }
 
+#ifndef MAGNUM_TARGET_GLES
+void MeshView::drawIndirect(AbstractShaderProgram& shader, Containers::ArrayView<const std::reference_wrapper<MeshView>> meshes, Buffer& indirectBuffer) {
+    if(!meshes.size()) return;
+
+    Mesh& original = meshes.begin()->get()._original;
+    #ifndef CORRADE_NO_ASSERT
+    for(MeshView& mesh: meshes)
+        CORRADE_ASSERT(&mesh._original.get() == &original, "MeshView::drawIndirect(): all meshes must be views of the same original mesh", );
+    #endif
+
+    /* Gather the commands, skipping empty views */
+    std::size_t drawCount = 0;
+    if(original._indexBuffer) {
+        Containers::Array<Mesh::DrawElementsIndirectCommand> commands = FrameAllocator::currentArray<Mesh::DrawElementsIndirectCommand>(meshes.size());
+        const std::size_t indexSize = original.indexSize();
+        for(MeshView& mesh: meshes) {
+            if(!mesh._count || !mesh._instanceCount) continue;
+            commands[drawCount++] = {UnsignedInt(mesh._count), UnsignedInt(mesh._instanceCount), UnsignedInt(mesh._indexOffset/indexSize), mesh._baseVertex, mesh._baseInstance};
+        }
+        indirectBuffer.setData({commands.data(), drawCount}, BufferUsage::StreamDraw);
+    } else {
+        Containers::Array<Mesh::DrawArraysIndirectCommand> commands = FrameAllocator::currentArray<Mesh::DrawArraysIndirectCommand>(meshes.size());
+        for(MeshView& mesh: meshes) {
+            if(!mesh._count || !mesh._instanceCount) continue;
+            commands[drawCount++] = {UnsignedInt(mesh._count), UnsignedInt(mesh._instanceCount), UnsignedInt(mesh._baseVertex), mesh._baseInstance};
+        }
+        indirectBuffer.setData({commands.data(), drawCount}, BufferUsage::StreamDraw);
+    }
+
+    original.drawIndirect(shader, indirectBuffer, 0, drawCount);
+}
+#endif
+
 #ifndef MAGNUM_TARGET_WEBGL
-void MeshView::multiDrawImplementationDefault(std::initializer_list<std::reference_wrapper<MeshView>> meshes) {
+void MeshView::multiDrawImplementationDefault(Containers::ArrayView<const std::reference_wrapper<MeshView>> meshes) {
     CORRADE_INTERNAL_ASSERT(meshes.size());
 
-    const Implementation::MeshState& state = *Context::current().state().mesh;
+    Implementation::MeshState& state = *Context::current().state().mesh;
+    ++state.drawCount;
 
     Mesh& original = meshes.begin()->get()._original;
-    Containers::Array<GLsizei> count{meshes.size()};
-    Containers::Array<GLvoid*> indices{meshes.size()};
-    Containers::Array<GLint> baseVertex{meshes.size()};
+    if(CommandObserver* const observer = Context::current().state().commandObserver)
+        observer->record(CommandObserver::Command::Draw, original._id, meshes.size(), false);
+    Containers::Array<GLsizei> count = FrameAllocator::currentArray<GLsizei>(meshes.size());
+    Containers::Array<GLvoid*> indices = FrameAllocator::currentArray<GLvoid*>(meshes.size());
+    Containers::Array<GLint> baseVertex = FrameAllocator::currentArray<GLint>(meshes.size());
 
     /* Gather the parameters */
     #ifndef MAGNUM_TARGET_GLES
@@ -128,7 +166,7 @@ void MeshView::multiDrawImplementationDefault(std::initializer_list<std::referen
 #endif
 
 #ifdef MAGNUM_TARGET_GLES
-void MeshView::multiDrawImplementationFallback(std::initializer_list<std::reference_wrapper<MeshView>> meshes) {
+void MeshView::multiDrawImplementationFallback(Containers::ArrayView<const std::reference_wrapper<MeshView>> meshes) {
     for(MeshView& mesh: meshes) {
         /* Nothing to draw in this mesh */
         if(!mesh._count) continue;
@@ -31,6 +31,7 @@
 
 #include <functional>
 #include <initializer_list>
+#include <Corrade/Containers/ArrayView.h>
 
 #include "Magnum/Magnum.h"
 #include "Magnum/OpenGL.h"
@@ -74,7 +75,8 @@ class MAGNUM_EXPORT MeshView {
          * setting up the mesh from scratch.
          * @attention All meshes must be views of the same original mesh and
          *      must not be instanced.
-         * @see @ref draw(AbstractShaderProgram&), @fn_gl{UseProgram},
+         * @see @ref draw(AbstractShaderProgram&),
+         *      @ref drawIndirect(), @fn_gl{UseProgram},
          *      @fn_gl{EnableVertexAttribArray}, @fn_gl{BindBuffer},
          *      @fn_gl{VertexAttribPointer}, @fn_gl{DisableVertexAttribArray}
          *      or @fn_gl{BindVertexArray}, @fn_gl{MultiDrawArrays} or
@@ -84,13 +86,52 @@ class MAGNUM_EXPORT MeshView {
          * @requires_gl Specifying base vertex for indexed meshes is not
          *      available in OpenGL ES or WebGL.
          */
-        static void draw(AbstractShaderProgram& shader, std::initializer_list<std::reference_wrapper<MeshView>> meshes);
+        static void draw(AbstractShaderProgram& shader, Containers::ArrayView<const std::reference_wrapper<MeshView>> meshes);
 
         /** @overload */
-        static void draw(AbstractShaderProgram&& shader, std::initializer_list<std::reference_wrapper<MeshView>> meshes) {
+        static void draw(AbstractShaderProgram&& shader, Containers::ArrayView<const std::reference_wrapper<MeshView>> meshes) {
             draw(shader, meshes);
         }
 
+        /** @overload */
+        static void draw(AbstractShaderProgram& shader, std::initializer_list<std::reference_wrapper<MeshView>> meshes) {
+            draw(shader, {meshes.begin(), meshes.size()});
+        }
+
+        /** @overload */
+        static void draw(AbstractShaderProgram&& shader, std::initializer_list<std::reference_wrapper<MeshView>> meshes) {
+            draw(shader, {meshes.begin(), meshes.size()});
+        }
+
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Draw multiple meshes at once using an indirect buffer
+         * @param shader            Shader to use for drawing
+         * @param meshes            Meshes to draw
+         * @param indirectBuffer    Buffer to write the draw commands to
+         *
+         * Writes a @ref Mesh::DrawElementsIndirectCommand or
+         * @ref Mesh::DrawArraysIndirectCommand for each mesh into
+         * @p indirectBuffer, replacing its previous contents, and then draws
+         * them using @ref Mesh::drawIndirect(). Compared to
+         * @ref draw(AbstractShaderProgram&, Containers::ArrayView<const std::reference_wrapper<MeshView>>)
+         * the meshes can be also instanced. Views with zero count or instance
+         * count are skipped. The index range set with
+         * @ref setIndexRange(Int, UnsignedInt, UnsignedInt) is ignored.
+         * @attention All meshes must be views of the same original mesh.
+         * @see @fn_gl{BindBuffer}, @fn_gl{BufferData}
+         * @requires_gl40 Extension @extension{ARB,draw_indirect}
+         * @requires_gl Indirect drawing of multiple meshes is not available in
+         *      OpenGL ES or WebGL.
+         */
+        static void drawIndirect(AbstractShaderProgram& shader, Containers::ArrayView<const std::reference_wrapper<MeshView>> meshes, Buffer& indirectBuffer);
+
+        /** @overload */
+        static void drawIndirect(AbstractShaderProgram&& shader, Containers::ArrayView<const std::reference_wrapper<MeshView>> meshes, Buffer& indirectBuffer) {
+            drawIndirect(shader, meshes, indirectBuffer);
+        }
+        #endif
+
         /**
          * @brief Constructor
          * @param original  Original, already configured mesh
@@ -221,7 +262,7 @@ class MAGNUM_EXPORT MeshView {
          * @brief Draw the mesh
          *
          * See @ref Mesh::draw(AbstractShaderProgram&) for more information.
-         * @see @ref draw(AbstractShaderProgram&, std::initializer_list<std::reference_wrapper<MeshView>>),
+         * @see @ref draw(AbstractShaderProgram&, Containers::ArrayView<const std::reference_wrapper<MeshView>>),
          *      @ref draw(AbstractShaderProgram&, TransformFeedback&, UnsignedInt)
          * @requires_gl32 Extension @extension{ARB,draw_elements_base_vertex}
          *      if the mesh is indexed and @ref baseVertex() is not `0`.
@@ -268,9 +309,9 @@ class MAGNUM_EXPORT MeshView {
 
     private:
         #ifndef MAGNUM_TARGET_WEBGL
-        static MAGNUM_LOCAL void multiDrawImplementationDefault(std::initializer_list<std::reference_wrapper<MeshView>> meshes);
+        static MAGNUM_LOCAL void multiDrawImplementationDefault(Containers::ArrayView<const std::reference_wrapper<MeshView>> meshes);
         #endif
-        static MAGNUM_LOCAL void multiDrawImplementationFallback(std::initializer_list<std::reference_wrapper<MeshView>> meshes);
+        static MAGNUM_LOCAL void multiDrawImplementationFallback(Containers::ArrayView<const std::reference_wrapper<MeshView>> meshes);
 
         std::reference_wrapper<Mesh> _original;
 
@@ -0,0 +1,442 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "PixelConversion.h"
+
+#include <cstring>
+#include <tuple>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Implementation/componentSize.h"
+#include "Magnum/Math/Color.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace Magnum { namespace PixelConversion {
+
+namespace {
+
+/* Lookup table for sRGB encoding of values in [2^-9, 1), indexed by the
+   exponent and top nine bits of mantissa, so the relative precision is the
+   same across the whole range. Each entry is the encoded value at the center
+   of its range. Values below the range are in the linear part of the curve
+   and are calculated directly. */
+constexpr UnsignedInt SrgbEncodeMantissaBits = 9;
+constexpr UnsignedInt SrgbEncodeMinBits = (127 - 9) << 23;
+
+struct SrgbEncodeTable {
+    SrgbEncodeTable() {
+        for(UnsignedInt i = 0; i != Size; ++i) {
+            const UnsignedInt bits = SrgbEncodeMinBits + (i << (23 - SrgbEncodeMantissaBits)) + (1 << (22 - SrgbEncodeMantissaBits));
+            Float value;
+            std::memcpy(&value, &bits, 4);
+            data[i] = UnsignedByte(Math::Implementation::linearToSrgb(value)*255.0f + 0.5f);
+        }
+    }
+
+    enum: UnsignedInt { Size = 9 << SrgbEncodeMantissaBits };
+    UnsignedByte data[Size];
+};
+
+inline const UnsignedByte* srgbEncodeTable() {
+    static const SrgbEncodeTable table;
+    return table.data;
+}
+
+inline UnsignedByte linearToSrgbValue(const UnsignedByte* const table, const Float value) {
+    /* Negative values and NaNs fail this comparison */
+    if(!(value >= 0.001953125f)) return value > 0.0f ? UnsignedByte(Math::Implementation::linearToSrgb(value)*255.0f + 0.5f) : 0;
+    if(value >= 1.0f) return 255;
+
+    UnsignedInt bits;
+    std::memcpy(&bits, &value, 4);
+    return table[(bits - SrgbEncodeMinBits) >> (23 - SrgbEncodeMantissaBits)];
+}
+
+inline Float clampUnorm(const Float value) {
+    /* NaNs fail the first comparison and become zero */
+    const Float clamped = value > 0.0f ? value : 0.0f;
+    return clamped < 1.0f ? clamped : 1.0f;
+}
+
+template<UnsignedInt dimensions> std::size_t channelCount(const ImageView<dimensions>& image) {
+    const std::size_t size = Implementation::componentSize(image.type());
+    return size ? image.pixelSize()/size : 0;
+}
+
+/* Calls the kernel for each row of the image, returns image of given format
+   and type with default pixel storage */
+template<UnsignedInt dimensions, class Kernel> Image<dimensions> convert(const ImageView<dimensions>& image, const PixelFormat format, const PixelType type, Kernel kernel) {
+    const Vector3i size = Vector3i::pad(image.size(), 1);
+
+    Math::Vector3<std::size_t> srcOffset, srcDataSize, dstOffset, dstDataSize;
+    std::size_t srcPixelSize, dstPixelSize;
+    std::tie(srcOffset, srcDataSize, srcPixelSize) = image.storage().dataProperties(image.format(), image.type(), size);
+    std::tie(dstOffset, dstDataSize, dstPixelSize) = PixelStorage{}.dataProperties(format, type, size);
+
+    Containers::Array<char> data{dstDataSize.product()};
+    const char* const src = image.data() + srcOffset.sum();
+    for(Int z = 0; z != size.z(); ++z) for(Int y = 0; y != size.y(); ++y) {
+        kernel(src + (z*srcDataSize.y() + y)*srcDataSize.x(),
+               data + (z*dstDataSize.y() + y)*dstDataSize.x(), std::size_t(size.x()));
+    }
+
+    return Image<dimensions>{format, type, image.size(), std::move(data)};
+}
+
+}
+
+void swapRedBlue(const UnsignedByte* src, UnsignedByte* dst, std::size_t count, const std::size_t channelCount) {
+    CORRADE_ASSERT(channelCount == 3 || channelCount == 4,
+        "PixelConversion::swapRedBlue(): expected three or four channels, got" << channelCount, );
+
+    if(channelCount == 3) {
+        #ifdef __ARM_NEON
+        for(; count >= 16; count -= 16, src += 48, dst += 48) {
+            const uint8x16x3_t in = vld3q_u8(src);
+            const uint8x16x3_t out{{in.val[2], in.val[1], in.val[0]}};
+            vst3q_u8(dst, out);
+        }
+        #endif
+
+        for(; count; --count, src += 3, dst += 3) {
+            const UnsignedByte r = src[0];
+            dst[0] = src[2];
+            dst[1] = src[1];
+            dst[2] = r;
+        }
+
+    } else {
+        #if defined(__SSE2__)
+        /* Keep G and A in place, swap B and R in each 32-bit lane */
+        const __m128i ga = _mm_set1_epi32(int(0xff00ff00));
+        for(; count >= 4; count -= 4, src += 16, dst += 16) {
+            const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+            const __m128i br = _mm_andnot_si128(ga, in);
+            const __m128i out = _mm_or_si128(_mm_and_si128(in, ga),
+                _mm_or_si128(_mm_srli_epi32(br, 16), _mm_slli_epi32(br, 16)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), out);
+        }
+        #elif defined(__ARM_NEON)
+        for(; count >= 16; count -= 16, src += 64, dst += 64) {
+            const uint8x16x4_t in = vld4q_u8(src);
+            const uint8x16x4_t out{{in.val[2], in.val[1], in.val[0], in.val[3]}};
+            vst4q_u8(dst, out);
+        }
+        #endif
+
+        for(; count; --count, src += 4, dst += 4) {
+            const UnsignedByte r = src[0];
+            dst[0] = src[2];
+            dst[1] = src[1];
+            dst[2] = r;
+            dst[3] = src[3];
+        }
+    }
+}
+
+void expandRgbToRgba(const UnsignedByte* src, UnsignedByte* dst, std::size_t count, const UnsignedByte alpha) {
+    #ifdef __ARM_NEON
+    const uint8x16_t a = vdupq_n_u8(alpha);
+    for(; count >= 16; count -= 16, src += 48, dst += 64) {
+        const uint8x16x3_t in = vld3q_u8(src);
+        const uint8x16x4_t out{{in.val[0], in.val[1], in.val[2], a}};
+        vst4q_u8(dst, out);
+    }
+    #endif
+
+    for(; count; --count, src += 3, dst += 4) {
+        dst[0] = src[0];
+        dst[1] = src[1];
+        dst[2] = src[2];
+        dst[3] = alpha;
+    }
+}
+
+void srgbToLinear(const UnsignedByte* const src, Float* const dst, const std::size_t count) {
+    const Float* const table = Math::Implementation::srgbToLinearTable();
+    for(std::size_t i = 0; i != count; ++i)
+        dst[i] = table[src[i]];
+}
+
+void srgbToLinearAlpha(const UnsignedByte* src, Float* dst, std::size_t count) {
+    const Float* const table = Math::Implementation::srgbToLinearTable();
+    for(; count; --count, src += 4, dst += 4) {
+        dst[0] = table[src[0]];
+        dst[1] = table[src[1]];
+        dst[2] = table[src[2]];
+        dst[3] = src[3]/255.0f;
+    }
+}
+
+void linearToSrgb(const Float* const src, UnsignedByte* const dst, const std::size_t count) {
+    const UnsignedByte* const table = srgbEncodeTable();
+    for(std::size_t i = 0; i != count; ++i)
+        dst[i] = linearToSrgbValue(table, src[i]);
+}
+
+void linearToSrgbAlpha(const Float* src, UnsignedByte* dst, std::size_t count) {
+    const UnsignedByte* const table = srgbEncodeTable();
+    for(; count; --count, src += 4, dst += 4) {
+        dst[0] = linearToSrgbValue(table, src[0]);
+        dst[1] = linearToSrgbValue(table, src[1]);
+        dst[2] = linearToSrgbValue(table, src[2]);
+        dst[3] = UnsignedByte(clampUnorm(src[3])*255.0f + 0.5f);
+    }
+}
+
+void unormToFloat(const UnsignedByte* src, Float* dst, std::size_t count) {
+    #if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 scale = _mm_set1_ps(1.0f/255.0f);
+    for(; count >= 16; count -= 16, src += 16, dst += 16) {
+        const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        const __m128i lo = _mm_unpacklo_epi8(in, zero);
+        const __m128i hi = _mm_unpackhi_epi8(in, zero);
+        _mm_storeu_ps(dst +  0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), scale));
+        _mm_storeu_ps(dst +  4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), scale));
+        _mm_storeu_ps(dst +  8, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), scale));
+        _mm_storeu_ps(dst + 12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), scale));
+    }
+    #elif defined(__ARM_NEON)
+    const float32x4_t scale = vdupq_n_f32(1.0f/255.0f);
+    for(; count >= 16; count -= 16, src += 16, dst += 16) {
+        const uint8x16_t in = vld1q_u8(src);
+        const uint16x8_t lo = vmovl_u8(vget_low_u8(in));
+        const uint16x8_t hi = vmovl_u8(vget_high_u8(in));
+        vst1q_f32(dst +  0, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo))), scale));
+        vst1q_f32(dst +  4, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo))), scale));
+        vst1q_f32(dst +  8, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi))), scale));
+        vst1q_f32(dst + 12, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi))), scale));
+    }
+    #endif
+
+    for(; count; --count, ++src, ++dst)
+        *dst = *src*(1.0f/255.0f);
+}
+
+void unormToFloat(const UnsignedShort* const src, Float* const dst, const std::size_t count) {
+    for(std::size_t i = 0; i != count; ++i)
+        dst[i] = src[i]*(1.0f/65535.0f);
+}
+
+void floatToUnorm(const Float* src, UnsignedByte* dst, std::size_t count) {
+    #if defined(__SSE2__)
+    /* Max with zero as the second operand turns NaNs into zero */
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(255.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    for(; count >= 16; count -= 16, src += 16, dst += 16) {
+        __m128i v[4];
+        for(std::size_t i = 0; i != 4; ++i) {
+            const __m128 in = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + i*4), zero), one);
+            v[i] = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(in, scale), half));
+        }
+        const __m128i out = _mm_packus_epi16(_mm_packs_epi32(v[0], v[1]), _mm_packs_epi32(v[2], v[3]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), out);
+    }
+    #endif
+
+    for(; count; --count, ++src, ++dst)
+        *dst = UnsignedByte(clampUnorm(*src)*255.0f + 0.5f);
+}
+
+void floatToUnorm(const Float* const src, UnsignedShort* const dst, const std::size_t count) {
+    for(std::size_t i = 0; i != count; ++i)
+        dst[i] = UnsignedShort(clampUnorm(src[i])*65535.0f + 0.5f);
+}
+
+void premultiplyAlpha(const UnsignedByte* src, UnsignedByte* dst, std::size_t count) {
+    #if defined(__SSE2__)
+    /* Multiplier is alpha for color channels and 255 for alpha, division by
+       255 with rounding is done as (x + 128 + ((x + 128) >> 8)) >> 8 */
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alphaMask = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+    const __m128i alphaOne = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+    const __m128i bias = _mm_set1_epi16(128);
+    for(; count >= 4; count -= 4, src += 16, dst += 16) {
+        const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        __m128i v[2]{_mm_unpacklo_epi8(in, zero), _mm_unpackhi_epi8(in, zero)};
+        for(__m128i& x: v) {
+            const __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(x, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+            const __m128i multiplier = _mm_or_si128(_mm_andnot_si128(alphaMask, alpha), alphaOne);
+            const __m128i t = _mm_add_epi16(_mm_mullo_epi16(x, multiplier), bias);
+            x = _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(v[0], v[1]));
+    }
+    #endif
+
+    for(; count; --count, src += 4, dst += 4) {
+        const UnsignedInt alpha = src[3];
+        for(std::size_t i = 0; i != 3; ++i) {
+            const UnsignedInt t = src[i]*alpha + 128;
+            dst[i] = UnsignedByte((t + (t >> 8)) >> 8);
+        }
+        dst[3] = UnsignedByte(alpha);
+    }
+}
+
+void premultiplyAlpha(const Float* src, Float* dst, std::size_t count) {
+    for(; count; --count, src += 4, dst += 4) {
+        const Float alpha = src[3];
+        dst[0] = src[0]*alpha;
+        dst[1] = src[1]*alpha;
+        dst[2] = src[2]*alpha;
+        dst[3] = alpha;
+    }
+}
+
+namespace {
+
+template<UnsignedInt dimensions> Image<dimensions> swapRedBlueImplementation(const ImageView<dimensions>& image) {
+    const std::size_t channels = channelCount(image);
+    CORRADE_ASSERT(image.type() == PixelType::UnsignedByte && (channels == 3 || channels == 4),
+        "PixelConversion::swapRedBlue(): expected three- or four-channel unsigned byte image, got" << image.format() << image.type(), (Image<dimensions>{image.format(), image.type()}));
+
+    return convert(image, image.format(), image.type(), [channels](const char* src, char* dst, std::size_t count) {
+        swapRedBlue(reinterpret_cast<const UnsignedByte*>(src), reinterpret_cast<UnsignedByte*>(dst), count, channels);
+    });
+}
+
+template<UnsignedInt dimensions> Image<dimensions> expandRgbToRgbaImplementation(const ImageView<dimensions>& image, const UnsignedByte alpha) {
+    PixelFormat format;
+    if(image.format() == PixelFormat::RGB) format = PixelFormat::RGBA;
+    #ifndef MAGNUM_TARGET_GLES
+    else if(image.format() == PixelFormat::BGR) format = PixelFormat::BGRA;
+    #endif
+    else format = image.format();
+    CORRADE_ASSERT(image.type() == PixelType::UnsignedByte && format != image.format(),
+        "PixelConversion::expandRgbToRgba(): expected RGB unsigned byte image, got" << image.format() << image.type(), (Image<dimensions>{image.format(), image.type()}));
+
+    return convert(image, format, image.type(), [alpha](const char* src, char* dst, std::size_t count) {
+        expandRgbToRgba(reinterpret_cast<const UnsignedByte*>(src), reinterpret_cast<UnsignedByte*>(dst), count, alpha);
+    });
+}
+
+template<UnsignedInt dimensions> Image<dimensions> srgbToLinearImplementation(const ImageView<dimensions>& image) {
+    const std::size_t channels = channelCount(image);
+    CORRADE_ASSERT(image.type() == PixelType::UnsignedByte && channels,
+        "PixelConversion::srgbToLinear(): expected unsigned byte image, got" << image.format() << image.type(), (Image<dimensions>{image.format(), image.type()}));
+
+    return convert(image, image.format(), PixelType::Float, [channels](const char* src, char* dst, std::size_t count) {
+        if(channels == 4)
+            srgbToLinearAlpha(reinterpret_cast<const UnsignedByte*>(src), reinterpret_cast<Float*>(dst), count);
+        else
+            srgbToLinear(reinterpret_cast<const UnsignedByte*>(src), reinterpret_cast<Float*>(dst), count*channels);
+    });
+}
+
+template<UnsignedInt dimensions> Image<dimensions> linearToSrgbImplementation(const ImageView<dimensions>& image) {
+    const std::size_t channels = channelCount(image);
+    CORRADE_ASSERT(image.type() == PixelType::Float && channels,
+        "PixelConversion::linearToSrgb(): expected float image, got" << image.format() << image.type(), (Image<dimensions>{image.format(), image.type()}));
+
+    return convert(image, image.format(), PixelType::UnsignedByte, [channels](const char* src, char* dst, std::size_t count) {
+        if(channels == 4)
+            linearToSrgbAlpha(reinterpret_cast<const Float*>(src), reinterpret_cast<UnsignedByte*>(dst), count);
+        else
+            linearToSrgb(reinterpret_cast<const Float*>(src), reinterpret_cast<UnsignedByte*>(dst), count*channels);
+    });
+}
+
+template<UnsignedInt dimensions> Image<dimensions> unormToFloatImplementation(const ImageView<dimensions>& image) {
+    const std::size_t channels = channelCount(image);
+    CORRADE_ASSERT((image.type() == PixelType::UnsignedByte || image.type() == PixelType::UnsignedShort) && channels,
+        "PixelConversion::unormToFloat(): expected unsigned byte or unsigned short image, got" << image.format() << image.type(), (Image<dimensions>{image.format(), image.type()}));
+
+    if(image.type() == PixelType::UnsignedByte)
+        return convert(image, image.format(), PixelType::Float, [channels](const char* src, char* dst, std::size_t count) {
+            unormToFloat(reinterpret_cast<const UnsignedByte*>(src), reinterpret_cast<Float*>(dst), count*channels);
+        });
+
+    return convert(image, image.format(), PixelType::Float, [channels](const char* src, char* dst, std::size_t count) {
+        unormToFloat(reinterpret_cast<const UnsignedShort*>(src), reinterpret_cast<Float*>(dst), count*channels);
+    });
+}
+
+template<UnsignedInt dimensions> Image<dimensions> floatToUnormImplementation(const ImageView<dimensions>& image, const PixelType type) {
+    const std::size_t channels = channelCount(image);
+    CORRADE_ASSERT(image.type() == PixelType::Float && channels,
+        "PixelConversion::floatToUnorm(): expected float image, got" << image.format() << image.type(), (Image<dimensions>{image.format(), image.type()}));
+    CORRADE_ASSERT(type == PixelType::UnsignedByte || type == PixelType::UnsignedShort,
+        "PixelConversion::floatToUnorm(): expected unsigned byte or unsigned short type, got" << type, (Image<dimensions>{image.format(), image.type()}));
+
+    if(type == PixelType::UnsignedByte)
+        return convert(image, image.format(), type, [channels](const char* src, char* dst, std::size_t count) {
+            floatToUnorm(reinterpret_cast<const Float*>(src), reinterpret_cast<UnsignedByte*>(dst), count*channels);
+        });
+
+    return convert(image, image.format(), type, [channels](const char* src, char* dst, std::size_t count) {
+        floatToUnorm(reinterpret_cast<const Float*>(src), reinterpret_cast<UnsignedShort*>(dst), count*channels);
+    });
+}
+
+template<UnsignedInt dimensions> Image<dimensions> premultiplyAlphaImplementation(const ImageView<dimensions>& image) {
+    CORRADE_ASSERT((image.type() == PixelType::UnsignedByte || image.type() == PixelType::Float) && channelCount(image) == 4,
+        "PixelConversion::premultiplyAlpha(): expected four-channel unsigned byte or float image, got" << image.format() << image.type(), (Image<dimensions>{image.format(), image.type()}));
+
+    if(image.type() == PixelType::UnsignedByte)
+        return convert(image, image.format(), image.type(), [](const char* src, char* dst, std::size_t count) {
+            premultiplyAlpha(reinterpret_cast<const UnsignedByte*>(src), reinterpret_cast<UnsignedByte*>(dst), count);
+        });
+
+    return convert(image, image.format(), image.type(), [](const char* src, char* dst, std::size_t count) {
+        premultiplyAlpha(reinterpret_cast<const Float*>(src), reinterpret_cast<Float*>(dst), count);
+    });
+}
+
+}
+
+Image1D swapRedBlue(const ImageView1D& image) { return swapRedBlueImplementation(image); }
+Image2D swapRedBlue(const ImageView2D& image) { return swapRedBlueImplementation(image); }
+Image3D swapRedBlue(const ImageView3D& image) { return swapRedBlueImplementation(image); }
+Image1D expandRgbToRgba(const ImageView1D& image, const UnsignedByte alpha) { return expandRgbToRgbaImplementation(image, alpha); }
+Image2D expandRgbToRgba(const ImageView2D& image, const UnsignedByte alpha) { return expandRgbToRgbaImplementation(image, alpha); }
+Image3D expandRgbToRgba(const ImageView3D& image, const UnsignedByte alpha) { return expandRgbToRgbaImplementation(image, alpha); }
+Image1D srgbToLinear(const ImageView1D& image) { return srgbToLinearImplementation(image); }
+Image2D srgbToLinear(const ImageView2D& image) { return srgbToLinearImplementation(image); }
+Image3D srgbToLinear(const ImageView3D& image) { return srgbToLinearImplementation(image); }
+Image1D linearToSrgb(const ImageView1D& image) { return linearToSrgbImplementation(image); }
+Image2D linearToSrgb(const ImageView2D& image) { return linearToSrgbImplementation(image); }
+Image3D linearToSrgb(const ImageView3D& image) { return linearToSrgbImplementation(image); }
+Image1D unormToFloat(const ImageView1D& image) { return unormToFloatImplementation(image); }
+Image2D unormToFloat(const ImageView2D& image) { return unormToFloatImplementation(image); }
+Image3D unormToFloat(const ImageView3D& image) { return unormToFloatImplementation(image); }
+Image1D floatToUnorm(const ImageView1D& image, const PixelType type) { return floatToUnormImplementation(image, type); }
+Image2D floatToUnorm(const ImageView2D& image, const PixelType type) { return floatToUnormImplementation(image, type); }
+Image3D floatToUnorm(const ImageView3D& image, const PixelType type) { return floatToUnormImplementation(image, type); }
+Image1D premultiplyAlpha(const ImageView1D& image) { return premultiplyAlphaImplementation(image); }
+Image2D premultiplyAlpha(const ImageView2D& image) { return premultiplyAlphaImplementation(image); }
+Image3D premultiplyAlpha(const ImageView3D& image) { return premultiplyAlphaImplementation(image); }
+
+}}
@@ -0,0 +1,290 @@
+#ifndef Magnum_PixelConversion_h
+#define Magnum_PixelConversion_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Namespace @ref Magnum::PixelConversion
+ */
+
+#include <cstddef>
+
+#include "Magnum/Image.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum {
+
+/**
+@brief Pixel format conversion
+
+CPU conversion of pixel data between commonly used layouts, for example
+when preparing data for upload on platforms that don't support given format
+or when importing and exporting image files.
+
+## Image conversion
+
+The image functions take an @ref ImageView, honor its @ref PixelStorage
+parameters such as row alignment or skip and return a new @ref Image with
+default pixel storage. Only @ref PixelType::UnsignedByte,
+@ref PixelType::UnsignedShort and @ref PixelType::Float data with one to
+four channels are supported, four-channel formats are expected to have alpha
+in the last channel:
+@code
+Image2D image = PixelConversion::expandRgbToRgba(rgbImage);
+Image2D linear = PixelConversion::srgbToLinear(image);
+Image2D premultiplied = PixelConversion::premultiplyAlpha(linear);
+@endcode
+
+## Pixel kernels
+
+The image functions are built on top of kernels operating on contiguous
+pixel runs, which can be used directly when converting into an already
+allocated memory, such as a file buffer. Swizzling, unsigned byte ↔ float
+conversion and alpha premultiplication are vectorized with SSE2 or NEON
+where available, sRGB conversion uses lookup tables.
+*/
+namespace PixelConversion {
+
+/**
+@brief Swap red and blue channels
+@param src          Source pixels
+@param dst          Destination pixels
+@param count        Pixel count
+@param channelCount Channel count, either `3` or `4`
+
+Converts three- or four-channel unsigned byte pixels between RGB(A) and
+BGR(A) order. The alpha channel is kept in place. The @p src and @p dst can
+point to the same memory.
+*/
+MAGNUM_EXPORT void swapRedBlue(const UnsignedByte* src, UnsignedByte* dst, std::size_t count, std::size_t channelCount);
+
+/**
+@brief Expand RGB to RGBA
+@param src          Source pixels
+@param dst          Destination pixels
+@param count        Pixel count
+@param alpha        Alpha value to fill
+
+Converts three-channel unsigned byte pixels to four-channel. The @p src and
+@p dst must not overlap.
+*/
+MAGNUM_EXPORT void expandRgbToRgba(const UnsignedByte* src, UnsignedByte* dst, std::size_t count, UnsignedByte alpha = 0xff);
+
+/**
+@brief Convert sRGB unsigned byte values to linear floats
+@param src          Source values
+@param dst          Destination values
+@param count        Value count
+
+Converts each value separately, use @ref srgbToLinearAlpha() for data with
+alpha channel.
+*/
+MAGNUM_EXPORT void srgbToLinear(const UnsignedByte* src, Float* dst, std::size_t count);
+
+/**
+@brief Convert sRGB unsigned byte values with alpha to linear floats
+@param src          Source values
+@param dst          Destination values
+@param count        Pixel count
+
+Expects four channels per pixel, the last one is alpha which is only
+normalized to @f$ [0, 1] @f$ range.
+*/
+MAGNUM_EXPORT void srgbToLinearAlpha(const UnsignedByte* src, Float* dst, std::size_t count);
+
+/**
+@brief Convert linear floats to sRGB unsigned byte values
+@param src          Source values
+@param dst          Destination values
+@param count        Value count
+
+The values are clamped to @f$ [0, 1] @f$ range. Converts each value
+separately, use @ref linearToSrgbAlpha() for data with alpha channel.
+*/
+MAGNUM_EXPORT void linearToSrgb(const Float* src, UnsignedByte* dst, std::size_t count);
+
+/**
+@brief Convert linear floats with alpha to sRGB unsigned byte values
+@param src          Source values
+@param dst          Destination values
+@param count        Pixel count
+
+Expects four channels per pixel, the last one is alpha which is only
+converted to unsigned byte range.
+*/
+MAGNUM_EXPORT void linearToSrgbAlpha(const Float* src, UnsignedByte* dst, std::size_t count);
+
+/**
+@brief Convert normalized unsigned byte values to floats
+@param src          Source values
+@param dst          Destination values
+@param count        Value count
+*/
+MAGNUM_EXPORT void unormToFloat(const UnsignedByte* src, Float* dst, std::size_t count);
+
+/** @overload */
+MAGNUM_EXPORT void unormToFloat(const UnsignedShort* src, Float* dst, std::size_t count);
+
+/**
+@brief Convert floats to normalized unsigned byte values
+@param src          Source values
+@param dst          Destination values
+@param count        Value count
+
+The values are clamped to @f$ [0, 1] @f$ range and rounded to nearest.
+*/
+MAGNUM_EXPORT void floatToUnorm(const Float* src, UnsignedByte* dst, std::size_t count);
+
+/** @overload */
+MAGNUM_EXPORT void floatToUnorm(const Float* src, UnsignedShort* dst, std::size_t count);
+
+/**
+@brief Premultiply RGBA unsigned byte pixels with alpha
+@param src          Source pixels
+@param dst          Destination pixels
+@param count        Pixel count
+
+The result is rounded to nearest. The @p src and @p dst can point to the
+same memory.
+*/
+MAGNUM_EXPORT void premultiplyAlpha(const UnsignedByte* src, UnsignedByte* dst, std::size_t count);
+
+/** @overload */
+MAGNUM_EXPORT void premultiplyAlpha(const Float* src, Float* dst, std::size_t count);
+
+/**
+@brief Swap red and blue channels of an image
+
+Expects three- or four-channel @ref PixelType::UnsignedByte image. The
+pixel format is kept, as BGR formats are not available on all targets.
+@see @ref swapRedBlue(const UnsignedByte*, UnsignedByte*, std::size_t, std::size_t)
+*/
+MAGNUM_EXPORT Image2D swapRedBlue(const ImageView2D& image);
+
+/** @overload */
+MAGNUM_EXPORT Image1D swapRedBlue(const ImageView1D& image);
+
+/** @overload */
+MAGNUM_EXPORT Image3D swapRedBlue(const ImageView3D& image);
+
+/**
+@brief Expand RGB image to RGBA
+
+Expects @ref PixelFormat::RGB (or @ref PixelFormat::BGR on desktop) and
+@ref PixelType::UnsignedByte image, returns @ref PixelFormat::RGBA (or
+@ref PixelFormat::BGRA) image.
+@see @ref expandRgbToRgba(const UnsignedByte*, UnsignedByte*, std::size_t, UnsignedByte)
+*/
+MAGNUM_EXPORT Image2D expandRgbToRgba(const ImageView2D& image, UnsignedByte alpha = 0xff);
+
+/** @overload */
+MAGNUM_EXPORT Image1D expandRgbToRgba(const ImageView1D& image, UnsignedByte alpha = 0xff);
+
+/** @overload */
+MAGNUM_EXPORT Image3D expandRgbToRgba(const ImageView3D& image, UnsignedByte alpha = 0xff);
+
+/**
+@brief Convert sRGB image to linear
+
+Expects @ref PixelType::UnsignedByte image, returns @ref PixelType::Float
+image with the same format. Alpha of four-channel images is only normalized.
+@see @ref srgbToLinear(const UnsignedByte*, Float*, std::size_t),
+    @ref srgbToLinearAlpha()
+*/
+MAGNUM_EXPORT Image2D srgbToLinear(const ImageView2D& image);
+
+/** @overload */
+MAGNUM_EXPORT Image1D srgbToLinear(const ImageView1D& image);
+
+/** @overload */
+MAGNUM_EXPORT Image3D srgbToLinear(const ImageView3D& image);
+
+/**
+@brief Convert linear image to sRGB
+
+Expects @ref PixelType::Float image, returns @ref PixelType::UnsignedByte
+image with the same format. Alpha of four-channel images is only converted
+to unsigned byte range.
+@see @ref linearToSrgb(const Float*, UnsignedByte*, std::size_t),
+    @ref linearToSrgbAlpha()
+*/
+MAGNUM_EXPORT Image2D linearToSrgb(const ImageView2D& image);
+
+/** @overload */
+MAGNUM_EXPORT Image1D linearToSrgb(const ImageView1D& image);
+
+/** @overload */
+MAGNUM_EXPORT Image3D linearToSrgb(const ImageView3D& image);
+
+/**
+@brief Convert normalized image to float
+
+Expects @ref PixelType::UnsignedByte or @ref PixelType::UnsignedShort
+image, returns @ref PixelType::Float image with the same format.
+@see @ref unormToFloat(const UnsignedByte*, Float*, std::size_t)
+*/
+MAGNUM_EXPORT Image2D unormToFloat(const ImageView2D& image);
+
+/** @overload */
+MAGNUM_EXPORT Image1D unormToFloat(const ImageView1D& image);
+
+/** @overload */
+MAGNUM_EXPORT Image3D unormToFloat(const ImageView3D& image);
+
+/**
+@brief Convert float image to normalized
+
+Expects @ref PixelType::Float image, returns image with the same format and
+@p type, which is expected to be either @ref PixelType::UnsignedByte or
+@ref PixelType::UnsignedShort.
+@see @ref floatToUnorm(const Float*, UnsignedByte*, std::size_t)
+*/
+MAGNUM_EXPORT Image2D floatToUnorm(const ImageView2D& image, PixelType type = PixelType::UnsignedByte);
+
+/** @overload */
+MAGNUM_EXPORT Image1D floatToUnorm(const ImageView1D& image, PixelType type = PixelType::UnsignedByte);
+
+/** @overload */
+MAGNUM_EXPORT Image3D floatToUnorm(const ImageView3D& image, PixelType type = PixelType::UnsignedByte);
+
+/**
+@brief Premultiply image with alpha
+
+Expects four-channel @ref PixelType::UnsignedByte or @ref PixelType::Float
+image, returns image with the same format and type.
+@see @ref premultiplyAlpha(const UnsignedByte*, UnsignedByte*, std::size_t)
+*/
+MAGNUM_EXPORT Image2D premultiplyAlpha(const ImageView2D& image);
+
+/** @overload */
+MAGNUM_EXPORT Image1D premultiplyAlpha(const ImageView1D& image);
+
+/** @overload */
+MAGNUM_EXPORT Image3D premultiplyAlpha(const ImageView3D& image);
+
+}}
+
+#endif
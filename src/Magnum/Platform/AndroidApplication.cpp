@@ -28,6 +28,7 @@
 #include <Corrade/Utility/AndroidStreamBuffer.h>
 #include <Corrade/Utility/Debug.h>
 
+#include "Magnum/ContextRestorer.h"
 #include "Magnum/Version.h"
 #include "Magnum/Platform/Context.h"
 
@@ -67,9 +68,7 @@ AndroidApplication::AndroidApplication(const Arguments& arguments, std::nullptr_
 }
 
 AndroidApplication::~AndroidApplication() {
-    eglMakeCurrent(_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
-    eglDestroyContext(_display, _glContext);
-    eglDestroySurface(_display, _surface);
+    destroySurfaceAndContext();
     eglTerminate(_display);
 }
 
@@ -100,8 +99,7 @@ bool AndroidApplication::tryCreateContext(const Configuration& configuration) {
         EGL_NONE
     };
     EGLint configCount;
-    EGLConfig config;
-    if(!eglChooseConfig(_display, configAttributes, &config, 1, &configCount)) {
+    if(!eglChooseConfig(_display, configAttributes, &_config, 1, &configCount)) {
         Error() << "Platform::AndroidApplication::tryCreateContext(): cannot choose EGL config:"
                 << Implementation::eglErrorString(eglGetError());
         return false;
@@ -109,13 +107,18 @@ bool AndroidApplication::tryCreateContext(const Configuration& configuration) {
 
     /* Resize native window and match it to the selected format */
     EGLint format;
-    CORRADE_INTERNAL_ASSERT_OUTPUT(eglGetConfigAttrib(_display, config, EGL_NATIVE_VISUAL_ID, &format));
+    CORRADE_INTERNAL_ASSERT_OUTPUT(eglGetConfigAttrib(_display, _config, EGL_NATIVE_VISUAL_ID, &format));
     ANativeWindow_setBuffersGeometry(_state->window,
         configuration.size().isZero() ? 0 : configuration.size().x(),
         configuration.size().isZero() ? 0 : configuration.size().y(), format);
 
-    /* Create surface and context */
-    if(!(_surface = eglCreateWindowSurface(_display, config, _state->window, nullptr))) {
+    /* Create surface and context and return true if the initialization
+       succeeds */
+    return tryCreateSurfaceAndContext() && _context->tryCreate();
+}
+
+bool AndroidApplication::tryCreateSurfaceAndContext() {
+    if(!(_surface = eglCreateWindowSurface(_display, _config, _state->window, nullptr))) {
         Error() << "Platform::AndroidApplication::tryCreateContext(): cannot create EGL window surface:"
                 << Implementation::eglErrorString(eglGetError());
         return false;
@@ -130,7 +133,7 @@ bool AndroidApplication::tryCreateContext(const Configuration& configuration) {
         #endif
         EGL_NONE
     };
-    if(!(_glContext = eglCreateContext(_display, config, EGL_NO_CONTEXT, contextAttributes))) {
+    if(!(_glContext = eglCreateContext(_display, _config, EGL_NO_CONTEXT, contextAttributes))) {
         Error() << "Platform::AndroidApplication::tryCreateContext(): cannot create EGL context:"
                 << Implementation::eglErrorString(eglGetError());
         return false;
@@ -138,9 +141,19 @@ bool AndroidApplication::tryCreateContext(const Configuration& configuration) {
 
     /* Make the context current */
     CORRADE_INTERNAL_ASSERT_OUTPUT(eglMakeCurrent(_display, _surface, _surface, _glContext));
+    return true;
+}
 
-    /* Return true if the initialization succeeds */
-    return _context->tryCreate();
+void AndroidApplication::destroySurfaceAndContext() {
+    eglMakeCurrent(_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if(_glContext != EGL_NO_CONTEXT) {
+        eglDestroyContext(_display, _glContext);
+        _glContext = EGL_NO_CONTEXT;
+    }
+    if(_surface != EGL_NO_SURFACE) {
+        eglDestroySurface(_display, _surface);
+        _surface = EGL_NO_SURFACE;
+    }
 }
 
 void AndroidApplication::swapBuffers() {
@@ -174,12 +187,25 @@ void AndroidApplication::commandEvent(android_app* state, int32_t cmd) {
             if(!data.instance) {
                 data.instance = data.instancer(state);
                 data.instance->drawEvent();
+
+            /* The application survived window termination, recreate the
+               context and everything that was in it */
+            } else if(data.instance->_glContext == EGL_NO_CONTEXT) {
+                if(!data.instance->tryCreateSurfaceAndContext()) std::exit(32);
+                data.instance->_restorer->restore();
+                data.instance->drawEvent();
             }
             break;
 
         case APP_CMD_TERM_WINDOW:
+            /* Keep the application alive if it is able to restore its GL
+               state, destroy just the context */
+            if(data.instance && data.instance->_restorer) {
+                data.instance->_restorer->contextLost();
+                data.instance->destroySurfaceAndContext();
+
             /* Destroy the application */
-            data.instance.reset();
+            } else data.instance.reset();
             break;
 
         case APP_CMD_GAINED_FOCUS:
@@ -227,6 +253,12 @@ void AndroidApplication::exec(android_app* state, std::unique_ptr<AndroidApplica
     Data data{instancer};
     state->userData = &data;
 
+    /* Don't redraw while the window is terminated and the context is
+       waiting to be restored */
+    auto wantsRedraw = [&data]() {
+        return data.instance && data.instance->_glContext != EGL_NO_CONTEXT && (data.instance->_flags & Flag::Redraw);
+    };
+
     for(;;) {
         /* Read all pending events. Block and wait for them only if the app
            doesn't want to redraw immediately WHY THIS GODDAMN THING DOESNT
@@ -235,7 +267,7 @@ void AndroidApplication::exec(android_app* state, std::unique_ptr<AndroidApplica
         int ident, events;
         android_poll_source* source;
         while((ident = ALooper_pollAll(
-            data.instance && (data.instance->_flags & Flag::Redraw) ? 0 : -1,
+            wantsRedraw() ? 0 : -1,
             nullptr, &events, reinterpret_cast<void**>(&source))) >= 0)
         {
             /* Process this event OH SIR MAY MY POOR EXISTENCE CALL THIS
@@ -249,8 +281,7 @@ void AndroidApplication::exec(android_app* state, std::unique_ptr<AndroidApplica
 
         /* Redraw the app if it wants to be redrawn. Frame limiting is done by
            Android itself */
-        if(data.instance && (data.instance->_flags & Flag::Redraw))
-            data.instance->drawEvent();
+        if(wantsRedraw()) data.instance->drawEvent();
     }
 
     state->userData = nullptr;
@@ -231,6 +231,22 @@ class AndroidApplication {
         /** @copydoc Sdl2Application::tryCreateContext() */
         bool tryCreateContext(const Configuration& configuration);
 
+        /**
+         * @brief Set context restorer
+         *
+         * By default the application is destroyed when Android terminates its
+         * window and a new instance is created once the window is available
+         * again. If a restorer is set, the application instance is kept
+         * alive instead --- on window termination
+         * @ref ContextRestorer::contextLost() is called and the EGL context
+         * is destroyed, when the window is available again, new EGL surface
+         * and context are created and @ref ContextRestorer::restore() is
+         * called before the next @ref drawEvent(). The restorer must be alive
+         * for the whole lifetime of the application, pass `nullptr` to reset
+         * back to the default behavior.
+         */
+        void setContextRestorer(ContextRestorer* restorer) { _restorer = restorer; }
+
         /** @{ @name Screen handling */
 
         /**
@@ -299,12 +315,17 @@ class AndroidApplication {
         static void commandEvent(android_app* state, std::int32_t cmd);
         static std::int32_t inputEvent(android_app* state, AInputEvent* event);
 
+        bool tryCreateSurfaceAndContext();
+        void destroySurfaceAndContext();
+
         android_app* const _state;
         Flags _flags;
 
         EGLDisplay _display;
-        EGLSurface _surface;
-        EGLContext _glContext;
+        EGLConfig _config;
+        EGLSurface _surface{EGL_NO_SURFACE};
+        EGLContext _glContext{EGL_NO_CONTEXT};
+        ContextRestorer* _restorer{};
 
         std::unique_ptr<Platform::Context> _context;
         std::unique_ptr<LogOutput> _logOutput;
@@ -26,6 +26,7 @@
 
 #include "GlfwApplication.h"
 
+#include <algorithm>
 #include <tuple>
 #include <Corrade/Utility/String.h>
 
@@ -42,6 +43,33 @@ GlfwApplication* GlfwApplication::_instance = nullptr;
 static_assert(GLFW_TRUE == true && GLFW_FALSE == false, "GLFW does not have sane bool values");
 #endif
 
+namespace {
+
+/* Sets window flag hints, returns the monitor for fullscreen windows */
+GLFWmonitor* windowHints(const GlfwApplication::Configuration& configuration) {
+    typedef GlfwApplication::Configuration Configuration;
+
+    GLFWmonitor* monitor = nullptr; /* Needed for setting fullscreen */
+    if (configuration.windowFlags() >= Configuration::WindowFlag::Fullscreen) {
+        monitor = glfwGetPrimaryMonitor();
+        glfwWindowHint(GLFW_AUTO_ICONIFY, configuration.windowFlags() >= Configuration::WindowFlag::AutoIconify);
+    } else {
+        const Configuration::WindowFlags& flags = configuration.windowFlags();
+        glfwWindowHint(GLFW_RESIZABLE, flags >= Configuration::WindowFlag::Resizeable);
+        glfwWindowHint(GLFW_VISIBLE, !(flags >= Configuration::WindowFlag::Hidden));
+        #ifdef GLFW_MAXIMIZED
+        glfwWindowHint(GLFW_MAXIMIZED, flags >= Configuration::WindowFlag::Maximized);
+        #endif
+        glfwWindowHint(GLFW_ICONIFIED, flags >= Configuration::WindowFlag::Minimized);
+        glfwWindowHint(GLFW_FLOATING, flags >= Configuration::WindowFlag::Floating);
+    }
+    glfwWindowHint(GLFW_FOCUSED, configuration.windowFlags() >= Configuration::WindowFlag::Focused);
+
+    return monitor;
+}
+
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 GlfwApplication::GlfwApplication(const Arguments& arguments): GlfwApplication{arguments, Configuration{}} {}
 #endif
@@ -76,21 +104,7 @@ bool GlfwApplication::tryCreateContext(const Configuration& configuration) {
     CORRADE_ASSERT(_context->version() == Version::None, "Platform::GlfwApplication::tryCreateContext(): context already created", false);
 
     /* Window flags */
-    GLFWmonitor* monitor = nullptr; /* Needed for setting fullscreen */
-    if (configuration.windowFlags() >= Configuration::WindowFlag::Fullscreen) {
-        monitor = glfwGetPrimaryMonitor();
-        glfwWindowHint(GLFW_AUTO_ICONIFY, configuration.windowFlags() >= Configuration::WindowFlag::AutoIconify);
-    } else {
-        const Configuration::WindowFlags& flags = configuration.windowFlags();
-        glfwWindowHint(GLFW_RESIZABLE, flags >= Configuration::WindowFlag::Resizeable);
-        glfwWindowHint(GLFW_VISIBLE, !(flags >= Configuration::WindowFlag::Hidden));
-        #ifdef GLFW_MAXIMIZED
-        glfwWindowHint(GLFW_MAXIMIZED, flags >= Configuration::WindowFlag::Maximized);
-        #endif
-        glfwWindowHint(GLFW_ICONIFIED, flags >= Configuration::WindowFlag::Minimized);
-        glfwWindowHint(GLFW_FLOATING, flags >= Configuration::WindowFlag::Floating);
-    }
-    glfwWindowHint(GLFW_FOCUSED, configuration.windowFlags() >= Configuration::WindowFlag::Focused);
+    GLFWmonitor* monitor = windowHints(configuration);
 
     /* Context window hints */
     glfwWindowHint(GLFW_SAMPLES, configuration.sampleCount());
@@ -148,8 +162,43 @@ GlfwApplication::~GlfwApplication() {
     glfwTerminate();
 }
 
-void GlfwApplication::setSwapInterval(const Int interval) {
+void GlfwApplication::swapBuffers() {
+    glfwSwapBuffers(_window);
+
+    const Double presentTime = glfwGetTime();
+    if(_presentTime) _presentInterval = Float(presentTime - _presentTime);
+    _presentTime = presentTime;
+}
+
+bool GlfwApplication::setSwapInterval(const Int interval) {
+    /* Adaptive VSync needs EXT_swap_control_tear, fall back to ordinary VSync
+       if it's not there */
+    if(interval < 0 && !glfwExtensionSupported("WGL_EXT_swap_control_tear") && !glfwExtensionSupported("GLX_EXT_swap_control_tear")) {
+        Warning() << "Platform::GlfwApplication::setSwapInterval(): adaptive VSync not supported, falling back to ordinary VSync";
+        glfwSwapInterval(-interval);
+        return false;
+    }
+
     glfwSwapInterval(interval);
+    return true;
+}
+
+Int GlfwApplication::refreshRate() {
+    GLFWmonitor* monitor = glfwGetWindowMonitor(_window);
+    if(!monitor) monitor = glfwGetPrimaryMonitor();
+    const GLFWvidmode* const mode = monitor ? glfwGetVideoMode(monitor) : nullptr;
+    return mode ? mode->refreshRate : 0;
+}
+
+bool GlfwApplication::makeContextCurrent() {
+    glfwMakeContextCurrent(_window);
+    Context::makeCurrent(_context.get());
+    return true;
+}
+
+void GlfwApplication::releaseContext() {
+    Context::makeCurrent(nullptr);
+    glfwMakeContextCurrent(nullptr);
 }
 
 int GlfwApplication::exec() {
@@ -157,14 +206,54 @@ int GlfwApplication::exec() {
         if(_needsRedraw) {
             drawEvent();
         }
+
+        /* Draw event of additional windows, each with its own context
+           current */
+        if(!_windows.empty()) {
+            bool windowDrawn = false;
+            for(Window* window: _windows) {
+                if(!window->_needsRedraw) continue;
+                window->makeContextCurrent();
+                window->drawEvent();
+                windowDrawn = true;
+            }
+            if(windowDrawn) makeContextCurrent();
+        }
+
         glfwPollEvents();
+        if(!_mouseMoveHistory.empty()) flushMouseMoveEvent();
     }
     return 0;
 }
 
-void GlfwApplication::staticKeyEvent(GLFWwindow*, int key, int, int action, int mods) {
+void GlfwApplication::flushMouseMoveEvent() {
+    MouseMoveEvent e{_mouseMoveHistory.back(), KeyEvent::getCurrentGlfwModifiers(_window), {_mouseMoveHistory.data(), _mouseMoveHistory.size()}};
+    mouseMoveEvent(e);
+
+    /* Keeps the capacity for the next frame */
+    _mouseMoveHistory.clear();
+}
+
+/* Additional windows have the Window instance set as user pointer, the
+   application window has none */
+
+void GlfwApplication::staticViewportEvent(GLFWwindow* window, int w, int h) {
+    if(Window* const additional = static_cast<Window*>(glfwGetWindowUserPointer(window)))
+        additional->viewportEvent({w, h});
+    else _instance->viewportEvent({w, h});
+}
+
+void GlfwApplication::staticKeyEvent(GLFWwindow* window, int key, int, int action, int mods) {
+    if(!_instance->_mouseMoveHistory.empty()) _instance->flushMouseMoveEvent();
+
     KeyEvent e(static_cast<KeyEvent::Key>(key), {static_cast<InputEvent::Modifier>(mods)}, action == GLFW_REPEAT);
 
+    if(Window* const additional = static_cast<Window*>(glfwGetWindowUserPointer(window))) {
+        if(action == GLFW_RELEASE) additional->keyReleaseEvent(e);
+        else additional->keyPressEvent(e);
+        return;
+    }
+
     if(action == GLFW_PRESS) {
         _instance->keyPressEvent(e);
     } else if(action == GLFW_RELEASE) {
@@ -175,13 +264,28 @@ void GlfwApplication::staticKeyEvent(GLFWwindow*, int key, int, int action, int
 }
 
 void GlfwApplication::staticMouseMoveEvent(GLFWwindow* window, double x, double y) {
+    Window* const additional = static_cast<Window*>(glfwGetWindowUserPointer(window));
+    if(!additional && _instance->_coalesceMouseMove) {
+        _instance->_mouseMoveHistory.emplace_back(Int(x), Int(y));
+        return;
+    }
+
     MouseMoveEvent e{Vector2i{Int(x), Int(y)}, KeyEvent::getCurrentGlfwModifiers(window)};
-    _instance->mouseMoveEvent(e);
+    if(additional) additional->mouseMoveEvent(e);
+    else _instance->mouseMoveEvent(e);
 }
 
-void GlfwApplication::staticMouseEvent(GLFWwindow*, int button, int action, int mods) {
+void GlfwApplication::staticMouseEvent(GLFWwindow* window, int button, int action, int mods) {
+    if(!_instance->_mouseMoveHistory.empty()) _instance->flushMouseMoveEvent();
+
     MouseEvent e(static_cast<MouseEvent::Button>(button), {static_cast<InputEvent::Modifier>(mods)});
 
+    if(Window* const additional = static_cast<Window*>(glfwGetWindowUserPointer(window))) {
+        if(action == GLFW_PRESS) additional->mousePressEvent(e);
+        else if(action == GLFW_RELEASE) additional->mouseReleaseEvent(e);
+        return;
+    }
+
     if(action == GLFW_PRESS) {
         _instance->mousePressEvent(e);
     } else if(action == GLFW_RELEASE) {
@@ -190,7 +294,13 @@ void GlfwApplication::staticMouseEvent(GLFWwindow*, int button, int action, int
 }
 
 void GlfwApplication::staticMouseScrollEvent(GLFWwindow* window, double xoffset, double yoffset) {
+    if(!_instance->_mouseMoveHistory.empty()) _instance->flushMouseMoveEvent();
+
     MouseScrollEvent e(Vector2{Float(xoffset), Float(yoffset)}, KeyEvent::getCurrentGlfwModifiers(window));
+    if(Window* const additional = static_cast<Window*>(glfwGetWindowUserPointer(window))) {
+        additional->mouseScrollEvent(e);
+        return;
+    }
     _instance->mouseScrollEvent(e);
 
     #ifdef MAGNUM_BUILD_DEPRECATED
@@ -237,6 +347,60 @@ void GlfwApplication::mouseReleaseEvent(MouseEvent&) {}
 void GlfwApplication::mouseMoveEvent(MouseMoveEvent&) {}
 void GlfwApplication::mouseScrollEvent(MouseScrollEvent&) {}
 
+GlfwApplication::Window::Window(GlfwApplication& application): Window{application, Configuration{}} {}
+
+GlfwApplication::Window::Window(GlfwApplication& application, const Configuration& configuration): _application(application), _context{new Context{NoCreate, 0, nullptr}}, _needsRedraw{true} {
+    CORRADE_ASSERT(application._window, "Platform::GlfwApplication::Window: application context is not created", );
+
+    /* Context hints are kept from the application context creation, only the
+       window flags are set. Share objects with the application context. */
+    GLFWmonitor* monitor = windowHints(configuration);
+    _window = glfwCreateWindow(configuration.size().x(), configuration.size().y(), configuration.title().c_str(), monitor, application._window);
+    if(!_window) {
+        Error() << "Platform::GlfwApplication::Window: cannot create context";
+        std::exit(1);
+    }
+
+    /* Set callbacks, the user pointer makes them go to this instance */
+    glfwSetWindowUserPointer(_window, this);
+    glfwSetFramebufferSizeCallback(_window, staticViewportEvent);
+    glfwSetKeyCallback(_window, staticKeyEvent);
+    glfwSetCursorPosCallback(_window, staticMouseMoveEvent);
+    glfwSetMouseButtonCallback(_window, staticMouseEvent);
+    glfwSetScrollCallback(_window, staticMouseScrollEvent);
+
+    glfwMakeContextCurrent(_window);
+    if(!_context->tryCreate()) std::exit(1);
+
+    application._windows.push_back(this);
+    application.makeContextCurrent();
+}
+
+GlfwApplication::Window::~Window() {
+    _application._windows.erase(std::find(_application._windows.begin(), _application._windows.end(), this));
+
+    /* Destroy the Magnum context with the GL context current */
+    makeContextCurrent();
+    _context.reset();
+    glfwDestroyWindow(_window);
+
+    _application.makeContextCurrent();
+}
+
+bool GlfwApplication::Window::makeContextCurrent() {
+    glfwMakeContextCurrent(_window);
+    Context::makeCurrent(_context.get());
+    return true;
+}
+
+void GlfwApplication::Window::viewportEvent(const Vector2i&) {}
+void GlfwApplication::Window::keyPressEvent(KeyEvent&) {}
+void GlfwApplication::Window::keyReleaseEvent(KeyEvent&) {}
+void GlfwApplication::Window::mousePressEvent(MouseEvent&) {}
+void GlfwApplication::Window::mouseReleaseEvent(MouseEvent&) {}
+void GlfwApplication::Window::mouseMoveEvent(MouseMoveEvent&) {}
+void GlfwApplication::Window::mouseScrollEvent(MouseScrollEvent&) {}
+
 GlfwApplication::Configuration::Configuration():
     _title{"Magnum GLFW Application"},
     _size{800, 600}, _sampleCount{0},
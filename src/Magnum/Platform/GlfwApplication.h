@@ -32,6 +32,8 @@
 
 #include <memory>
 #include <string>
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
 
 #include "Magnum/Magnum.h"
 #include "Magnum/Math/Vector2.h"
@@ -92,6 +94,15 @@ MAGNUM_GLFWAPPLICATION_MAIN(MyApplication)
 If no other application header is included, this class is also aliased to
 `Platform::Application` and the macro is aliased to `MAGNUM_APPLICATION_MAIN()`
 to simplify porting.
+
+## Multiple windows
+
+Additional windows can be opened by subclassing @ref Window. Each window has
+its own OpenGL context sharing objects with the application context, so
+textures, buffers and shader programs created once can be used in all windows
+and only the default framebuffer and container objects such as @ref Mesh
+(vertex array objects) or @ref Framebuffer are specific to each window. See
+@ref Window documentation for details.
 */
 class GlfwApplication {
     public:
@@ -105,6 +116,7 @@ class GlfwApplication {
         };
 
         class Configuration;
+        class Window;
         class InputEvent;
         class KeyEvent;
         class MouseEvent;
@@ -172,19 +184,65 @@ class GlfwApplication {
          *
          * Paints currently rendered framebuffer on screen.
          */
-        void swapBuffers() { glfwSwapBuffers(_window); }
+        void swapBuffers();
+
+        /** @copydoc Sdl2Application::makeContextCurrent() */
+        bool makeContextCurrent();
+
+        /** @copydoc Sdl2Application::releaseContext() */
+        void releaseContext();
 
         /**
          * @brief Set swap interval
          *
-         * Set `0` for no VSync, `1` for enabled VSync. Some platforms support
-         * `-1` for late swap tearing. Default is driver-dependent.
+         * Set `0` for no VSync, `1` for enabled VSync. Set `-1` for adaptive
+         * VSync, where a frame that misses the vertical blank is swapped
+         * immediately with tearing instead of waiting for the next one.
+         * Adaptive VSync needs the `WGL_EXT_swap_control_tear` or
+         * `GLX_EXT_swap_control_tear` extension, if neither is supported, a
+         * warning is printed, ordinary VSync is enabled instead and the
+         * function returns `false`. Default is driver-dependent.
+         * @see @ref refreshRate(), @ref presentInterval()
          */
-        void setSwapInterval(Int interval);
+        bool setSwapInterval(Int interval);
+
+        /**
+         * @brief Display refresh rate
+         *
+         * Refresh rate in Hz of the monitor of a fullscreen window or of the
+         * primary monitor otherwise. Returns `0` if the refresh rate is not
+         * known.
+         * @see @ref presentInterval(), @ref setSwapInterval()
+         */
+        Int refreshRate();
+
+        /** @copydoc Sdl2Application::presentInterval() */
+        Float presentInterval() const { return _presentInterval; }
 
         /** @copydoc Sdl2Application::redraw() */
         void redraw() { _needsRedraw = true; }
 
+        /**
+         * @brief Whether mouse move events are coalesced
+         *
+         * @see @ref setMouseMoveCoalescing()
+         */
+        bool isMouseMoveCoalescing() const { return _coalesceMouseMove; }
+
+        /**
+         * @brief Enable or disable mouse move event coalescing
+         *
+         * If enabled, consecutive cursor position changes received in one
+         * main loop iteration are merged into a single @ref mouseMoveEvent()
+         * call with the last position and the complete list of positions
+         * available through @ref MouseMoveEvent::history(). The merged event
+         * is dispatched before any other input event following it, so the
+         * relative order of events is preserved. Disabled by default.
+         */
+        void setMouseMoveCoalescing(bool enabled) {
+            _coalesceMouseMove = enabled;
+        }
+
     #ifdef DOXYGEN_GENERATING_OUTPUT
     protected:
     #else
@@ -241,9 +299,7 @@ class GlfwApplication {
         /*@}*/
 
     private:
-        static void staticViewportEvent(GLFWwindow*, int w, int h) {
-            _instance->viewportEvent({w, h});
-        }
+        static void staticViewportEvent(GLFWwindow* window, int w, int h);
 
         static void staticKeyEvent(GLFWwindow* window, int key, int scancode, int action, int mod);
 
@@ -255,11 +311,20 @@ class GlfwApplication {
 
         static void staticErrorCallback(int error, const char* description);
 
+        void flushMouseMoveEvent();
+
         static GlfwApplication* _instance;
 
         GLFWwindow* _window;
         std::unique_ptr<Platform::Context> _context;
         bool _needsRedraw;
+        bool _coalesceMouseMove{};
+        std::vector<Window*> _windows;
+        Double _presentTime{};
+        Float _presentInterval{};
+
+        /* Pending coalesced mouse move events, reused across frames */
+        std::vector<Vector2i> _mouseMoveHistory;
 };
 
 /**
@@ -482,6 +547,146 @@ class GlfwApplication::Configuration {
         bool _srgbCapable;
 };
 
+/**
+@brief Additional window
+
+Window with its own OpenGL context, sharing textures, buffers, shader
+programs and other non-container objects with the application context.
+Container objects such as @ref Mesh (when using vertex array objects),
+@ref Framebuffer or @ref TransformFeedback can't be shared between contexts
+and have to be created separately for each window, with its context current.
+
+The window is drawn by the application main loop after the application
+@ref GlfwApplication::drawEvent() "drawEvent()", with its context made current
+for the duration of @ref drawEvent(). Input events targeted at the window are
+delivered to the window instead of the application. Everywhere else the
+application context is current.
+
+@code
+class SecondaryWindow: public Platform::GlfwApplication::Window {
+    public:
+        explicit SecondaryWindow(Platform::GlfwApplication& application):
+            Platform::GlfwApplication::Window{application,
+                Configuration{}.setTitle("Secondary")} {
+            // create meshes and framebuffers for this window here
+        }
+
+    private:
+        void drawEvent() override {
+            defaultFramebuffer.clear(FramebufferClear::Color);
+            // ...
+            swapBuffers();
+        }
+};
+@endcode
+
+Only title, size and window flags are taken from the passed
+@ref Configuration, the pixel format and context version are always the same
+as of the application context. Fullscreen windows are opened on the primary
+monitor, use `glfwSetWindowMonitor()` on @ref window() to move them
+elsewhere. Each window swaps its buffers separately, so with VSync enabled in
+every context the application frame rate might be divided by the window count
+--- disable VSync for all contexts except one if that's an issue. Use
+`glfwWindowShouldClose()` on @ref window() to check for close requests
+of the window; closing the application window exits the application.
+*/
+class GlfwApplication::Window {
+    friend GlfwApplication;
+
+    public:
+        /**
+         * @brief Constructor
+         * @param application   Application instance
+         * @param configuration Window configuration
+         *
+         * Creates the window and the OpenGL context. Expects that the
+         * application context is already created. Error message is printed
+         * and the program exits if the window or the context cannot be
+         * created. The application context is current after the constructor
+         * exits.
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        explicit Window(GlfwApplication& application, const Configuration& configuration = Configuration());
+        #else
+        /* To avoid "invalid use of incomplete type" */
+        explicit Window(GlfwApplication& application, const Configuration& configuration);
+        explicit Window(GlfwApplication& application);
+        #endif
+
+        /** @brief Copying is not allowed */
+        Window(const Window&) = delete;
+
+        /** @brief Moving is not allowed */
+        Window(Window&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Destroys the context and the window. The application context is
+         * current after the destructor exits.
+         */
+        virtual ~Window();
+
+        /** @brief Copying is not allowed */
+        Window& operator=(const Window&) = delete;
+
+        /** @brief Moving is not allowed */
+        Window& operator=(Window&&) = delete;
+
+        /** @brief Underlying GLFW window */
+        GLFWwindow* window() { return _window; }
+
+        /**
+         * @brief Make the window context current
+         *
+         * Done automatically before @ref drawEvent(), use this to create
+         * window-specific objects outside of it.
+         * @see @ref GlfwApplication::makeContextCurrent()
+         */
+        bool makeContextCurrent();
+
+        /** @copydoc GlfwApplication::swapBuffers() */
+        void swapBuffers() { glfwSwapBuffers(_window); }
+
+        /** @copydoc GlfwApplication::redraw() */
+        void redraw() { _needsRedraw = true; }
+
+    #ifdef DOXYGEN_GENERATING_OUTPUT
+    protected:
+    #else
+    private:
+    #endif
+        /** @copydoc GlfwApplication::viewportEvent() */
+        virtual void viewportEvent(const Vector2i& size);
+
+        /** @copydoc GlfwApplication::drawEvent() */
+        virtual void drawEvent() = 0;
+
+        /** @copydoc GlfwApplication::keyPressEvent() */
+        virtual void keyPressEvent(KeyEvent& event);
+
+        /** @copydoc GlfwApplication::keyReleaseEvent() */
+        virtual void keyReleaseEvent(KeyEvent& event);
+
+        /** @copydoc GlfwApplication::mousePressEvent() */
+        virtual void mousePressEvent(MouseEvent& event);
+
+        /** @copydoc GlfwApplication::mouseReleaseEvent() */
+        virtual void mouseReleaseEvent(MouseEvent& event);
+
+        /** @copydoc GlfwApplication::mouseMoveEvent() */
+        virtual void mouseMoveEvent(MouseMoveEvent& event);
+
+        /** @copydoc GlfwApplication::mouseScrollEvent() */
+        virtual void mouseScrollEvent(MouseScrollEvent& event);
+
+    private:
+        GlfwApplication& _application;
+        GLFWwindow* _window;
+        std::unique_ptr<Platform::Context> _context;
+        bool _needsRedraw;
+};
+
 CORRADE_ENUMSET_OPERATORS(GlfwApplication::Configuration::Flags)
 CORRADE_ENUMSET_OPERATORS(GlfwApplication::Configuration::WindowFlags)
 
@@ -861,11 +1066,23 @@ class GlfwApplication::MouseMoveEvent: public GlfwApplication::InputEvent {
         /** @brief Modifiers */
         constexpr Modifiers modifiers() const { return _modifiers; }
 
+        /**
+         * @brief Positions of all coalesced events
+         *
+         * If mouse move event coalescing is enabled, contains positions of
+         * all cursor position changes merged into this event in the order
+         * they arrived, the last being equal to @ref position(). Empty
+         * otherwise. See @ref GlfwApplication::setMouseMoveCoalescing() for
+         * more information.
+         */
+        constexpr Containers::ArrayView<const Vector2i> history() const { return _history; }
+
     private:
-        constexpr MouseMoveEvent(const Vector2i& position, Modifiers modifiers): _position(position), _modifiers(modifiers) {}
+        constexpr MouseMoveEvent(const Vector2i& position, Modifiers modifiers, Containers::ArrayView<const Vector2i> history = nullptr): _position(position), _modifiers(modifiers), _history(history) {}
 
         const Vector2i _position;
         const Modifiers _modifiers;
+        const Containers::ArrayView<const Vector2i> _history;
 };
 
 /**
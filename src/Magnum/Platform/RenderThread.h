@@ -0,0 +1,206 @@
+#ifndef Magnum_Platform_RenderThread_h
+#define Magnum_Platform_RenderThread_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Platform::RenderThread
+ */
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "Magnum/Magnum.h"
+
+namespace Magnum { namespace Platform {
+
+/**
+@brief Render thread consuming double-buffered snapshots
+
+Opt-in two-thread model for @ref Sdl2Application and @ref GlfwApplication.
+The main thread keeps handling events and running the simulation, fills a
+@ref snapshot() of the data needed for rendering (for example the
+absolute transformations from @ref SceneGraph::FlatTransformationCache) and
+calls @ref publish(). The render thread owns the GL context and draws the
+last published snapshot while the main thread already works on the next one,
+overlapping CPU simulation with GL submission.
+
+@code
+struct Frame {
+    std::vector<Matrix4> transformations;
+    Matrix4 projection;
+};
+
+class MyApplication: public Platform::Application {
+    // ...
+
+    void drawEvent() override {
+        // Simulate, then copy the state for rendering
+        _cache.update();
+        _renderThread.snapshot().transformations = _cache.absoluteTransformations();
+        _renderThread.publish();
+        redraw();
+    }
+
+    SceneGraph::FlatTransformationCache<SceneGraph::MatrixTransformation3D> _cache;
+    Platform::RenderThread<Frame> _renderThread{*this, [this](const Frame& frame) {
+        defaultFramebuffer.clear(FramebufferClear::Color|FramebufferClear::Depth);
+        // draw frame.transformations ...
+        swapBuffers();
+    }};
+};
+@endcode
+
+The renderer is called on the render thread with the application context
+current, thus no GL calls are allowed on the main thread while the render
+thread exists. As the main thread can't run more than one frame ahead,
+@ref publish() blocks if the render thread didn't finish the previous
+snapshot yet. Using the two-thread model requires Magnum to be built with
+@ref MAGNUM_BUILD_MULTITHREADED and linking to the system thread library.
+Swapping buffers from a non-main thread is not supported on all platforms
+(notably macOS).
+*/
+template<class Snapshot> class RenderThread {
+    public:
+        /**
+         * @brief Constructor
+         * @param application   Application owning the GL context
+         * @param renderer      Called on the render thread for each
+         *      published snapshot
+         *
+         * Releases the context from the calling thread using
+         * `Application::releaseContext()` and starts the render thread,
+         * which makes it current using `Application::makeContextCurrent()`.
+         */
+        template<class Application> explicit RenderThread(Application& application, std::function<void(const Snapshot&)> renderer);
+
+        /** @brief Copying is not allowed */
+        RenderThread(const RenderThread<Snapshot>&) = delete;
+
+        /** @brief Moving is not allowed */
+        RenderThread(RenderThread<Snapshot>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Renders the snapshot published last, if any, stops the render
+         * thread and makes the context current in the calling thread again.
+         */
+        ~RenderThread();
+
+        /** @brief Copying is not allowed */
+        RenderThread<Snapshot>& operator=(const RenderThread<Snapshot>&) = delete;
+
+        /** @brief Moving is not allowed */
+        RenderThread<Snapshot>& operator=(RenderThread<Snapshot>&&) = delete;
+
+        /**
+         * @brief Snapshot to fill
+         *
+         * Owned by the main thread until @ref publish() is called. Note that
+         * it contains the data written two frames ago, not the last
+         * published ones.
+         */
+        Snapshot& snapshot() { return _snapshots[_back]; }
+
+        /**
+         * @brief Publish the snapshot for rendering
+         *
+         * Waits until the render thread finishes the previous snapshot, then
+         * swaps the buffers and wakes up the render thread.
+         */
+        void publish();
+
+    private:
+        void run();
+
+        std::function<void()> _acquire, _release;
+        std::function<void(const Snapshot&)> _renderer;
+        Snapshot _snapshots[2];
+        std::size_t _back{};
+        bool _pending{}, _rendering{}, _stopping{};
+        std::mutex _mutex;
+        std::condition_variable _condition;
+        std::thread _thread;
+};
+
+template<class Snapshot> template<class Application> RenderThread<Snapshot>::RenderThread(Application& application, std::function<void(const Snapshot&)> renderer): _acquire{[&application]() { application.makeContextCurrent(); }}, _release{[&application]() { application.releaseContext(); }}, _renderer{std::move(renderer)} {
+    _release();
+    _thread = std::thread{&RenderThread<Snapshot>::run, this};
+}
+
+template<class Snapshot> RenderThread<Snapshot>::~RenderThread() {
+    {
+        std::unique_lock<std::mutex> lock{_mutex};
+        _stopping = true;
+    }
+    _condition.notify_all();
+    _thread.join();
+
+    _acquire();
+}
+
+template<class Snapshot> void RenderThread<Snapshot>::publish() {
+    {
+        std::unique_lock<std::mutex> lock{_mutex};
+        _condition.wait(lock, [this]() { return !_pending && !_rendering; });
+        _back ^= 1;
+        _pending = true;
+    }
+    _condition.notify_all();
+}
+
+template<class Snapshot> void RenderThread<Snapshot>::run() {
+    _acquire();
+
+    for(;;) {
+        std::size_t front;
+        {
+            std::unique_lock<std::mutex> lock{_mutex};
+            _condition.wait(lock, [this]() { return _pending || _stopping; });
+            if(!_pending) break;
+
+            _pending = false;
+            _rendering = true;
+            front = _back ^ 1;
+        }
+
+        _renderer(_snapshots[front]);
+
+        {
+            std::unique_lock<std::mutex> lock{_mutex};
+            _rendering = false;
+        }
+        _condition.notify_all();
+    }
+
+    _release();
+}
+
+}}
+
+#endif
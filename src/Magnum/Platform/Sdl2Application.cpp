@@ -27,6 +27,7 @@
 
 #include <cstring>
 #ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <algorithm>
 #include <tuple>
 #else
 #include <emscripten/emscripten.h>
@@ -56,6 +57,27 @@ Sdl2Application::InputEvent::Modifiers fixedModifiers(Uint16 mod) {
     return modifiers;
 }
 
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+bool isInputEvent(const Uint32 type) {
+    return (type >= SDL_KEYDOWN && type <= SDL_TEXTINPUT) ||
+           (type >= SDL_MOUSEMOTION && type <= SDL_MOUSEWHEEL) ||
+           (type >= SDL_FINGERDOWN && type <= SDL_MULTIGESTURE);
+}
+
+/* SDL_Delay() has only millisecond precision and can oversleep, so it's used
+   only for the coarse part of the wait and the rest is spent spinning */
+void sleepUntil(const UnsignedLong time) {
+    const UnsignedLong frequency = SDL_GetPerformanceFrequency();
+    const UnsignedLong current = SDL_GetPerformanceCounter();
+    if(current >= time) return;
+
+    const UnsignedLong milliseconds = (time - current)*1000/frequency;
+    if(milliseconds > 2) SDL_Delay(milliseconds - 2);
+
+    while(SDL_GetPerformanceCounter() < time) {}
+}
+#endif
+
 }
 
 #ifdef CORRADE_TARGET_EMSCRIPTEN
@@ -291,17 +313,51 @@ Vector2i Sdl2Application::windowSize() {
 void Sdl2Application::swapBuffers() {
     #ifndef CORRADE_TARGET_EMSCRIPTEN
     SDL_GL_SwapWindow(_window);
+
+    const UnsignedLong presentTime = SDL_GetPerformanceCounter();
+    if(_presentTime)
+        _presentInterval = Float(presentTime - _presentTime)/SDL_GetPerformanceFrequency();
+    _presentTime = presentTime;
+    if(_inputTime) {
+        _inputLatency = Float(_presentTime - _inputTime)/SDL_GetPerformanceFrequency();
+        _inputTime = 0;
+    }
     #else
     SDL_Flip(_glContext);
     #endif
 }
 
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+bool Sdl2Application::makeContextCurrent() {
+    if(SDL_GL_MakeCurrent(_window, _glContext) != 0) {
+        Error() << "Platform::Sdl2Application::makeContextCurrent(): cannot make context current:" << SDL_GetError();
+        return false;
+    }
+
+    Context::makeCurrent(_context.get());
+    return true;
+}
+
+void Sdl2Application::releaseContext() {
+    Context::makeCurrent(nullptr);
+    SDL_GL_MakeCurrent(_window, nullptr);
+}
+#endif
+
 Int Sdl2Application::swapInterval() const {
     return SDL_GL_GetSwapInterval();
 }
 
 bool Sdl2Application::setSwapInterval(const Int interval) {
     if(SDL_GL_SetSwapInterval(interval) == -1) {
+        /* Adaptive VSync needs EXT_swap_control_tear, fall back to ordinary
+           VSync if it's not there */
+        if(interval == -1 && SDL_GL_SetSwapInterval(1) == 0) {
+            Warning() << "Platform::Sdl2Application::setSwapInterval(): adaptive VSync not supported, falling back to ordinary VSync";
+            _flags |= Flag::VSyncEnabled;
+            return false;
+        }
+
         Error() << "Platform::Sdl2Application::setSwapInterval(): cannot set swap interval:" << SDL_GetError();
         _flags &= ~Flag::VSyncEnabled;
         return false;
@@ -348,13 +404,73 @@ void Sdl2Application::exit() {
     #endif
 }
 
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+void Sdl2Application::setFramePacing(const Float framesPerSecond, const Float renderAhead) {
+    CORRADE_ASSERT(framesPerSecond >= 0.0f && renderAhead >= 0.0f,
+        "Platform::Sdl2Application::setFramePacing(): expected non-negative values, got" << framesPerSecond << renderAhead, );
+    _framePeriod = framesPerSecond ? 1.0f/framesPerSecond : 0.0f;
+    _renderAhead = renderAhead;
+    _frameStart = 0;
+}
+
+Int Sdl2Application::refreshRate() {
+    SDL_DisplayMode mode;
+    const int display = SDL_GetWindowDisplayIndex(_window);
+    if(display < 0 || SDL_GetCurrentDisplayMode(display, &mode) != 0)
+        return 0;
+    return mode.refresh_rate;
+}
+
+void Sdl2Application::waitForFrameStart() {
+    const UnsignedLong frequency = SDL_GetPerformanceFrequency();
+    const UnsignedLong period = UnsignedLong(_framePeriod*frequency);
+    const UnsignedLong current = SDL_GetPerformanceCounter();
+
+    /* Either a fixed cadence or an offset from the last present. If there's
+       no previous frame or we fell behind by more than a frame,
+       resynchronize instead of trying to catch up. */
+    UnsignedLong start;
+    if(_renderAhead) {
+        const UnsignedLong ahead = UnsignedLong(_renderAhead*frequency);
+        start = _presentTime + (ahead < period ? period - ahead : 0);
+    } else start = _frameStart + period;
+    if(!_frameStart || current > start + period) start = current;
+
+    sleepUntil(start);
+    _frameStart = start;
+}
+#endif
+
 void Sdl2Application::mainLoop() {
     #ifndef CORRADE_TARGET_EMSCRIPTEN
+    /* Wait for the frame start before processing any input, so it's as fresh
+       as possible */
+    if(_framePeriod && _flags & Flag::Redraw) waitForFrameStart();
+
     const UnsignedInt timeBefore = _minimalLoopPeriod ? SDL_GetTicks() : 0;
     #endif
 
     SDL_Event event;
     while(SDL_PollEvent(&event)) {
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        /* Remember when the earliest input event of this frame happened. The
+           event timestamp has only millisecond precision, so it's converted
+           to the high-resolution counter relative to current time. */
+        if(!_inputTime && isInputEvent(event.type)) {
+            const UnsignedInt age = SDL_GetTicks() - event.common.timestamp;
+            _inputTime = SDL_GetPerformanceCounter() - UnsignedLong(age)*SDL_GetPerformanceFrequency()/1000;
+        }
+        #endif
+
+        /* Dispatch pending coalesced mouse motion before anything else */
+        if(event.type != SDL_MOUSEMOTION && !_mouseMoveHistory.empty())
+            flushMouseMoveEvent();
+
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        /* Events targeted at additional windows */
+        if(!_windows.empty() && dispatchWindowEvent(event)) continue;
+        #endif
+
         switch(event.type) {
             case SDL_WINDOWEVENT:
                 switch(event.window.event) {
@@ -373,6 +489,14 @@ void Sdl2Application::mainLoop() {
                     case SDL_WINDOWEVENT_EXPOSED:
                         _flags |= Flag::Redraw;
                         break;
+                    #ifndef CORRADE_TARGET_EMSCRIPTEN
+                    /* SDL_QUIT is sent only after the last window is closed,
+                       so with additional windows exit on the application
+                       window close */
+                    case SDL_WINDOWEVENT_CLOSE:
+                        if(!_windows.empty()) _flags |= Flag::Exit;
+                        break;
+                    #endif
                 } break;
 
             case SDL_KEYDOWN:
@@ -415,6 +539,15 @@ void Sdl2Application::mainLoop() {
             } break;
 
             case SDL_MOUSEMOTION: {
+                if(_flags & Flag::CoalesceMouseMove) {
+                    if(_mouseMoveHistory.empty())
+                        _mouseMoveRelativePosition = {};
+                    _mouseMoveHistory.emplace_back(event.motion.x, event.motion.y);
+                    _mouseMoveRelativePosition += Vector2i{event.motion.xrel, event.motion.yrel};
+                    _mouseMoveButtons = event.motion.state;
+                    break;
+                }
+
                 MouseMoveEvent e({event.motion.x, event.motion.y}, {event.motion.xrel, event.motion.yrel}, static_cast<MouseMoveEvent::Button>(event.motion.state));
                 mouseMoveEvent(e);
                 break;
@@ -446,17 +579,33 @@ void Sdl2Application::mainLoop() {
         }
     }
 
+    if(!_mouseMoveHistory.empty()) flushMouseMoveEvent();
+
     /* Tick event */
     if(!(_flags & Flag::NoTickEvent)) tickEvent();
 
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    /* Draw event of additional windows, each with its own context current */
+    bool windowDrawn = false;
+    for(Window* window: _windows) {
+        if(!window->_redraw) continue;
+        window->_redraw = false;
+        window->makeContextCurrent();
+        window->drawEvent();
+        windowDrawn = true;
+    }
+    if(windowDrawn) makeContextCurrent();
+    #endif
+
     /* Draw event */
     if(_flags & Flag::Redraw) {
         _flags &= ~Flag::Redraw;
         drawEvent();
 
         #ifndef CORRADE_TARGET_EMSCRIPTEN
-        /* If VSync is not enabled, delay to prevent CPU hogging (if set) */
-        if(!(_flags & Flag::VSyncEnabled) && _minimalLoopPeriod) {
+        /* If VSync or frame pacing is not enabled, delay to prevent CPU
+           hogging (if set) */
+        if(!(_flags & Flag::VSyncEnabled) && _minimalLoopPeriod && !_framePeriod) {
             const UnsignedInt loopTime = SDL_GetTicks() - timeBefore;
             if(loopTime < _minimalLoopPeriod)
                 SDL_Delay(_minimalLoopPeriod - loopTime);
@@ -474,12 +623,81 @@ void Sdl2Application::mainLoop() {
             SDL_Delay(_minimalLoopPeriod - loopTime);
     }
 
-    /* Then, if the tick event doesn't need to be called periodically, wait
-       indefinitely for next input event */
-    if(_flags & Flag::NoTickEvent) SDL_WaitEvent(nullptr);
+    /* Then, if the tick event doesn't need to be called periodically and no
+       window wants to be redrawn, wait indefinitely for next input event */
+    if(_flags & Flag::NoTickEvent && std::none_of(_windows.begin(), _windows.end(), [](Window* window) { return window->_redraw; }))
+        SDL_WaitEvent(nullptr);
     #endif
 }
 
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+bool Sdl2Application::dispatchWindowEvent(const SDL_Event& event) {
+    /* Find the window the event belongs to, events of the application window
+       and events not tied to any window are handled by the application */
+    Uint32 id;
+    switch(event.type) {
+        case SDL_WINDOWEVENT: id = event.window.windowID; break;
+        case SDL_KEYDOWN:
+        case SDL_KEYUP: id = event.key.windowID; break;
+        case SDL_MOUSEBUTTONDOWN:
+        case SDL_MOUSEBUTTONUP: id = event.button.windowID; break;
+        case SDL_MOUSEWHEEL: id = event.wheel.windowID; break;
+        case SDL_MOUSEMOTION: id = event.motion.windowID; break;
+        default: return false;
+    }
+    const auto found = std::find_if(_windows.begin(), _windows.end(), [id](Window* window) {
+        return SDL_GetWindowID(window->_window) == id;
+    });
+    if(found == _windows.end()) return false;
+
+    Window& window = **found;
+    switch(event.type) {
+        case SDL_WINDOWEVENT:
+            switch(event.window.event) {
+                case SDL_WINDOWEVENT_RESIZED:
+                    window.viewportEvent({event.window.data1, event.window.data2});
+                    window._redraw = true;
+                    break;
+                case SDL_WINDOWEVENT_EXPOSED:
+                    window._redraw = true;
+                    break;
+            } break;
+
+        case SDL_KEYDOWN:
+        case SDL_KEYUP: {
+            KeyEvent e(static_cast<KeyEvent::Key>(event.key.keysym.sym), fixedModifiers(event.key.keysym.mod), event.key.repeat != 0);
+            event.type == SDL_KEYDOWN ? window.keyPressEvent(e) : window.keyReleaseEvent(e);
+        } break;
+
+        case SDL_MOUSEBUTTONDOWN:
+        case SDL_MOUSEBUTTONUP: {
+            MouseEvent e(static_cast<MouseEvent::Button>(event.button.button), {event.button.x, event.button.y}, event.button.clicks);
+            event.type == SDL_MOUSEBUTTONDOWN ? window.mousePressEvent(e) : window.mouseReleaseEvent(e);
+        } break;
+
+        case SDL_MOUSEWHEEL: {
+            MouseScrollEvent e{{Float(event.wheel.x), Float(event.wheel.y)}};
+            window.mouseScrollEvent(e);
+        } break;
+
+        case SDL_MOUSEMOTION: {
+            MouseMoveEvent e({event.motion.x, event.motion.y}, {event.motion.xrel, event.motion.yrel}, static_cast<MouseMoveEvent::Button>(event.motion.state));
+            window.mouseMoveEvent(e);
+        } break;
+    }
+
+    return true;
+}
+#endif
+
+void Sdl2Application::flushMouseMoveEvent() {
+    MouseMoveEvent e{_mouseMoveHistory.back(), _mouseMoveRelativePosition, static_cast<MouseMoveEvent::Button>(_mouseMoveButtons), {_mouseMoveHistory.data(), _mouseMoveHistory.size()}};
+    mouseMoveEvent(e);
+
+    /* Keeps the capacity for the next frame */
+    _mouseMoveHistory.clear();
+}
+
 void Sdl2Application::setMouseLocked(bool enabled) {
     /** @todo Implement this in Emscripten */
     #ifndef CORRADE_TARGET_EMSCRIPTEN
@@ -535,6 +753,87 @@ void Sdl2Application::multiGestureEvent(MultiGestureEvent&) {}
 void Sdl2Application::textInputEvent(TextInputEvent&) {}
 void Sdl2Application::textEditingEvent(TextEditingEvent&) {}
 
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+Sdl2Application::Window::Window(Sdl2Application& application): Window{application, Configuration{}} {}
+
+Sdl2Application::Window::Window(Sdl2Application& application, const Configuration& configuration): _application(application), _glContext{}, _context{new Context{NoCreate, 0, nullptr}}, _redraw{true} {
+    CORRADE_ASSERT(application._glContext, "Platform::Sdl2Application::Window: application context is not created", );
+
+    /* Share objects with the application context. All other context
+       attributes are kept from the application context creation. */
+    SDL_GL_MakeCurrent(application._window, application._glContext);
+    SDL_GL_SetAttribute(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 1);
+
+    if(!(_window = SDL_CreateWindow(
+        #ifndef CORRADE_TARGET_IOS
+        configuration.title().data(),
+        #else
+        nullptr,
+        #endif
+        SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED,
+        configuration.size().x(), configuration.size().y(),
+        SDL_WINDOW_OPENGL|Uint32(configuration.windowFlags()))))
+    {
+        Error() << "Platform::Sdl2Application::Window: cannot create window:" << SDL_GetError();
+        std::exit(1);
+    }
+
+    /* Create the context, it's made current implicitly */
+    _glContext = SDL_GL_CreateContext(_window);
+    SDL_GL_SetAttribute(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 0);
+    if(!_glContext) {
+        Error() << "Platform::Sdl2Application::Window: cannot create context:" << SDL_GetError();
+        std::exit(1);
+    }
+    if(!_context->tryCreate()) std::exit(1);
+
+    application._windows.push_back(this);
+    application.makeContextCurrent();
+}
+
+Sdl2Application::Window::~Window() {
+    _application._windows.erase(std::find(_application._windows.begin(), _application._windows.end(), this));
+
+    /* Destroy the Magnum context with the GL context current */
+    makeContextCurrent();
+    _context.reset();
+
+    SDL_GL_MakeCurrent(_window, nullptr);
+    SDL_GL_DeleteContext(_glContext);
+    SDL_DestroyWindow(_window);
+
+    _application.makeContextCurrent();
+}
+
+Vector2i Sdl2Application::Window::windowSize() {
+    Vector2i size;
+    SDL_GetWindowSize(_window, &size.x(), &size.y());
+    return size;
+}
+
+bool Sdl2Application::Window::makeContextCurrent() {
+    if(SDL_GL_MakeCurrent(_window, _glContext) != 0) {
+        Error() << "Platform::Sdl2Application::Window::makeContextCurrent(): cannot make context current:" << SDL_GetError();
+        return false;
+    }
+
+    Context::makeCurrent(_context.get());
+    return true;
+}
+
+void Sdl2Application::Window::swapBuffers() {
+    SDL_GL_SwapWindow(_window);
+}
+
+void Sdl2Application::Window::viewportEvent(const Vector2i&) {}
+void Sdl2Application::Window::keyPressEvent(KeyEvent&) {}
+void Sdl2Application::Window::keyReleaseEvent(KeyEvent&) {}
+void Sdl2Application::Window::mousePressEvent(MouseEvent&) {}
+void Sdl2Application::Window::mouseReleaseEvent(MouseEvent&) {}
+void Sdl2Application::Window::mouseMoveEvent(MouseMoveEvent&) {}
+void Sdl2Application::Window::mouseScrollEvent(MouseScrollEvent&) {}
+#endif
+
 Sdl2Application::Configuration::Configuration():
     #if !defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(CORRADE_TARGET_IOS)
     _title("Magnum SDL2 Application"),
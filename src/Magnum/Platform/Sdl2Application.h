@@ -30,6 +30,7 @@
  */
 
 #include <memory>
+#include <vector>
 #include <Corrade/Corrade.h>
 #include <Corrade/Containers/ArrayView.h>
 #include <Corrade/Containers/EnumSet.h>
@@ -188,6 +189,15 @@ If no other application header is included, this class is also aliased to
 `Platform::Application` and the macro is aliased to `MAGNUM_APPLICATION_MAIN()`
 to simplify porting.
 
+## Multiple windows
+
+Additional windows can be opened by subclassing @ref Window. Each window has
+its own OpenGL context sharing objects with the application context, so
+textures, buffers and shader programs created once can be used in all windows
+and only the default framebuffer and container objects such as @ref Mesh
+(vertex array objects) or @ref Framebuffer are specific to each window. See
+@ref Window documentation for details.
+
 ## Usage with Emscripten
 
 If you are targetting Emscripten, you need to provide HTML markup for your
@@ -327,6 +337,9 @@ class Sdl2Application {
         };
 
         class Configuration;
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        class Window;
+        #endif
         class InputEvent;
         class KeyEvent;
         class MouseEvent;
@@ -442,17 +455,48 @@ class Sdl2Application {
          */
         void swapBuffers();
 
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        /**
+         * @brief Make the context current in calling thread
+         *
+         * Makes both the GL context and the corresponding @ref Context
+         * current, so the rendering can be moved to another thread. The
+         * context has to be released from the thread that had it current
+         * first using @ref releaseContext(). Prints error message and returns
+         * `false` if the context can't be made current. See
+         * @ref RenderThread for a convenience wrapper.
+         * @note Not available in @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten".
+         */
+        bool makeContextCurrent();
+
+        /**
+         * @brief Release the context from calling thread
+         *
+         * @note Not available in @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten".
+         * @see @ref makeContextCurrent()
+         */
+        void releaseContext();
+        #endif
+
         /** @brief Swap interval */
         Int swapInterval() const;
 
         /**
          * @brief Set swap interval
          *
-         * Set `0` for no VSync, `1` for enabled VSync. Some platforms support
-         * `-1` for late swap tearing. Prints error message and returns `false`
-         * if swap interval cannot be set, `true` otherwise. Default is
-         * driver-dependent, you can query the value with @ref swapInterval().
-         * @see @ref setMinimalLoopPeriod()
+         * Set `0` for no VSync, `1` for enabled VSync. Set `-1` for adaptive
+         * VSync, where a frame that misses the vertical blank is swapped
+         * immediately with tearing instead of waiting for the next one ---
+         * that avoids halving the frame rate when a frame only marginally
+         * misses its deadline. Adaptive VSync needs the
+         * `EXT_swap_control_tear` extension (`GLX_`, `WGL_` variants), if
+         * not supported, a warning is printed, ordinary VSync is enabled
+         * instead and the function returns `false`. Prints error message and
+         * returns `false` if swap interval cannot be set, `true` otherwise.
+         * Default is driver-dependent, you can query the value with
+         * @ref swapInterval().
+         * @see @ref setMinimalLoopPeriod(), @ref refreshRate(),
+         *      @ref presentInterval()
          */
         bool setSwapInterval(Int interval);
 
@@ -470,6 +514,71 @@ class Sdl2Application {
         void setMinimalLoopPeriod(UnsignedInt milliseconds) {
             _minimalLoopPeriod = milliseconds;
         }
+
+        /**
+         * @brief Set frame pacing
+         * @param framesPerSecond   Target frame rate. Set to `0.0f` to
+         *      disable frame pacing.
+         * @param renderAhead       Time in seconds before the expected
+         *      present at which the frame should start
+         *
+         * If enabled, each frame that requested redraw starts at a fixed
+         * cadence given by @p framesPerSecond. The loop waits for the frame
+         * start using a coarse sleep followed by a short spin on the
+         * high-resolution counter, which is considerably more precise than
+         * @ref setMinimalLoopPeriod(), which is ignored for drawn frames when
+         * frame pacing is enabled. The pacing is not applied when no redraw
+         * is requested, so the application stays idle.
+         *
+         * If @p renderAhead is non-zero, the frame starts @p renderAhead
+         * seconds before the expected present, counted from the time the
+         * previous @ref swapBuffers() returned, instead of right after it.
+         * With VSync enabled and @p renderAhead set slightly larger than the
+         * time needed to process and render the frame, the input gets
+         * sampled as late as possible, reducing the input lag. Default is no
+         * frame pacing.
+         * @note Not available in @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten",
+         *      the browser is managing the frequency instead.
+         * @see @ref inputLatency(), @ref setSwapInterval()
+         */
+        void setFramePacing(Float framesPerSecond, Float renderAhead = 0.0f);
+
+        /**
+         * @brief Input latency
+         *
+         * Time in seconds between the earliest input event processed in the
+         * last frame that had any input and the return from
+         * @ref swapBuffers() in the same frame. As the buffer swap is not
+         * necessarily synchronous, the actual presentation may happen later.
+         * Returns `0.0f` if no input was processed yet.
+         * @note Not available in @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten".
+         * @see @ref setFramePacing()
+         */
+        Float inputLatency() const { return _inputLatency; }
+
+        /**
+         * @brief Display refresh rate
+         *
+         * Refresh rate in Hz of the display the window is currently on.
+         * Returns `0` if the refresh rate is not known.
+         * @note Not available in @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten".
+         * @see @ref presentInterval(), @ref setSwapInterval()
+         */
+        Int refreshRate();
+
+        /**
+         * @brief Present interval
+         *
+         * Time in seconds between returns from the last two
+         * @ref swapBuffers() calls, measured on the CPU. With VSync enabled
+         * it is a multiple of the display refresh period, a value
+         * considerably longer than `1.0f/refreshRate()` means the frame
+         * missed the vertical blank. Returns `0.0f` if less than two frames
+         * were swapped.
+         * @note Not available in @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten".
+         * @see @ref inputLatency(), @ref setSwapInterval()
+         */
+        Float presentInterval() const { return _presentInterval; }
         #endif
 
         /**
@@ -481,6 +590,33 @@ class Sdl2Application {
          */
         void redraw() { _flags |= Flag::Redraw; }
 
+        /**
+         * @brief Whether mouse move events are coalesced
+         *
+         * @see @ref setMouseMoveCoalescing()
+         */
+        bool isMouseMoveCoalescing() const {
+            return !!(_flags & Flag::CoalesceMouseMove);
+        }
+
+        /**
+         * @brief Enable or disable mouse move event coalescing
+         *
+         * If enabled, consecutive mouse motion events received in one main
+         * loop iteration are merged into a single @ref mouseMoveEvent() call
+         * with the last position, relative position summed over all of them
+         * and the complete list of positions available through
+         * @ref MouseMoveEvent::history(). The merged event is dispatched
+         * before any other event following it, so the relative order of
+         * events is preserved. Useful with high-frequency mice, where handling
+         * each motion separately often costs more than the actual rendering.
+         * Disabled by default.
+         */
+        void setMouseMoveCoalescing(bool enabled) {
+            if(enabled) _flags |= Flag::CoalesceMouseMove;
+            else _flags &= ~Flag::CoalesceMouseMove;
+        }
+
     #ifdef DOXYGEN_GENERATING_OUTPUT
     protected:
     #else
@@ -677,8 +813,9 @@ class Sdl2Application {
             Redraw = 1 << 0,
             VSyncEnabled = 1 << 1,
             NoTickEvent = 1 << 2,
+            CoalesceMouseMove = 1 << 3,
             #ifndef CORRADE_TARGET_EMSCRIPTEN
-            Exit = 1 << 3
+            Exit = 1 << 4
             #endif
         };
 
@@ -691,11 +828,19 @@ class Sdl2Application {
         #endif
 
         void mainLoop();
+        void flushMouseMoveEvent();
 
         #ifndef CORRADE_TARGET_EMSCRIPTEN
+        void waitForFrameStart();
+        bool dispatchWindowEvent(const SDL_Event& event);
+
         SDL_Window* _window;
         SDL_GLContext _glContext;
         UnsignedInt _minimalLoopPeriod;
+        Float _framePeriod{}, _renderAhead{}, _inputLatency{}, _presentInterval{};
+        /* In SDL_GetPerformanceCounter() units */
+        UnsignedLong _frameStart{}, _presentTime{}, _inputTime{};
+        std::vector<Window*> _windows;
         #else
         SDL_Surface* _glContext;
         bool _isTextInputActive = false;
@@ -703,6 +848,11 @@ class Sdl2Application {
 
         std::unique_ptr<Platform::Context> _context;
 
+        /* Pending coalesced mouse move events, reused across frames */
+        std::vector<Vector2i> _mouseMoveHistory;
+        Vector2i _mouseMoveRelativePosition;
+        UnsignedInt _mouseMoveButtons{};
+
         Flags _flags;
 };
 
@@ -955,6 +1105,153 @@ class Sdl2Application::Configuration {
         #endif
 };
 
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+/**
+@brief Additional window
+
+Window with its own OpenGL context, sharing textures, buffers, shader
+programs and other non-container objects with the application context.
+Container objects such as @ref Mesh (when using vertex array objects),
+@ref Framebuffer or @ref TransformFeedback can't be shared between contexts
+and have to be created separately for each window, with its context current.
+
+The window is drawn by the application main loop after the application
+@ref Sdl2Application::drawEvent() "drawEvent()", with its context made
+current for the duration of @ref drawEvent(). Input events targeted at the
+window are delivered to the window instead of the application. Everywhere
+else the application context is current.
+
+@code
+class SecondaryWindow: public Platform::Sdl2Application::Window {
+    public:
+        explicit SecondaryWindow(Platform::Sdl2Application& application):
+            Platform::Sdl2Application::Window{application,
+                Configuration{}.setTitle("Secondary")} {
+            // create meshes and framebuffers for this window here
+        }
+
+    private:
+        void drawEvent() override {
+            defaultFramebuffer.clear(FramebufferClear::Color);
+            // ...
+            swapBuffers();
+        }
+};
+@endcode
+
+Only title, size and window flags are taken from the passed
+@ref Configuration, the pixel format and context version are always the same
+as of the application context. Each window swaps its buffers separately, so
+with VSync enabled in every context the application frame rate might be
+divided by the window count --- disable VSync for all contexts except one if
+that's an issue. Close requests of additional windows are ignored, destroy the
+window instance to close it; closing the application window exits the
+application.
+@note Not available in @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten".
+*/
+class Sdl2Application::Window {
+    friend Sdl2Application;
+
+    public:
+        /**
+         * @brief Constructor
+         * @param application   Application instance
+         * @param configuration Window configuration
+         *
+         * Creates the window and the OpenGL context. Expects that the
+         * application context is already created. Error message is printed
+         * and the program exits if the window or the context cannot be
+         * created. The application context is current after the constructor
+         * exits.
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        explicit Window(Sdl2Application& application, const Configuration& configuration = Configuration());
+        #else
+        /* To avoid "invalid use of incomplete type" */
+        explicit Window(Sdl2Application& application, const Configuration& configuration);
+        explicit Window(Sdl2Application& application);
+        #endif
+
+        /** @brief Copying is not allowed */
+        Window(const Window&) = delete;
+
+        /** @brief Moving is not allowed */
+        Window(Window&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Destroys the context and the window. The application context is
+         * current after the destructor exits.
+         */
+        virtual ~Window();
+
+        /** @brief Copying is not allowed */
+        Window& operator=(const Window&) = delete;
+
+        /** @brief Moving is not allowed */
+        Window& operator=(Window&&) = delete;
+
+        /** @brief Underlying SDL window */
+        SDL_Window* window() { return _window; }
+
+        /** @copydoc Sdl2Application::windowSize() */
+        Vector2i windowSize();
+
+        /**
+         * @brief Make the window context current
+         *
+         * Done automatically before @ref drawEvent(), use this to create
+         * window-specific objects outside of it. Prints error message and
+         * returns `false` if the context can't be made current.
+         * @see @ref Sdl2Application::makeContextCurrent()
+         */
+        bool makeContextCurrent();
+
+        /** @copydoc Sdl2Application::swapBuffers() */
+        void swapBuffers();
+
+        /** @copydoc Sdl2Application::redraw() */
+        void redraw() { _redraw = true; }
+
+    #ifdef DOXYGEN_GENERATING_OUTPUT
+    protected:
+    #else
+    private:
+    #endif
+        /** @copydoc Sdl2Application::viewportEvent() */
+        virtual void viewportEvent(const Vector2i& size);
+
+        /** @copydoc Sdl2Application::drawEvent() */
+        virtual void drawEvent() = 0;
+
+        /** @copydoc Sdl2Application::keyPressEvent() */
+        virtual void keyPressEvent(KeyEvent& event);
+
+        /** @copydoc Sdl2Application::keyReleaseEvent() */
+        virtual void keyReleaseEvent(KeyEvent& event);
+
+        /** @copydoc Sdl2Application::mousePressEvent() */
+        virtual void mousePressEvent(MouseEvent& event);
+
+        /** @copydoc Sdl2Application::mouseReleaseEvent() */
+        virtual void mouseReleaseEvent(MouseEvent& event);
+
+        /** @copydoc Sdl2Application::mouseMoveEvent() */
+        virtual void mouseMoveEvent(MouseMoveEvent& event);
+
+        /** @copydoc Sdl2Application::mouseScrollEvent() */
+        virtual void mouseScrollEvent(MouseScrollEvent& event);
+
+    private:
+        Sdl2Application& _application;
+        SDL_Window* _window;
+        SDL_GLContext _glContext;
+        std::unique_ptr<Platform::Context> _context;
+        bool _redraw;
+};
+#endif
+
 /**
 @brief Base for input events
 
@@ -1388,6 +1685,17 @@ class Sdl2Application::MouseMoveEvent: public Sdl2Application::InputEvent {
         /** @brief Mouse buttons */
         constexpr Buttons buttons() const { return _buttons; }
 
+        /**
+         * @brief Positions of all coalesced events
+         *
+         * If mouse move event coalescing is enabled, contains positions of
+         * all motion events merged into this one in the order they arrived,
+         * the last being equal to @ref position(). Empty otherwise. See
+         * @ref Sdl2Application::setMouseMoveCoalescing() for more
+         * information.
+         */
+        constexpr Containers::ArrayView<const Vector2i> history() const { return _history; }
+
         /**
          * @brief Modifiers
          *
@@ -1396,10 +1704,11 @@ class Sdl2Application::MouseMoveEvent: public Sdl2Application::InputEvent {
         Modifiers modifiers();
 
     private:
-        constexpr MouseMoveEvent(const Vector2i& position, const Vector2i& relativePosition, Buttons buttons): _position{position}, _relativePosition{relativePosition}, _buttons{buttons}, _modifiersLoaded{false} {}
+        constexpr MouseMoveEvent(const Vector2i& position, const Vector2i& relativePosition, Buttons buttons, Containers::ArrayView<const Vector2i> history = nullptr): _position{position}, _relativePosition{relativePosition}, _buttons{buttons}, _history{history}, _modifiersLoaded{false} {}
 
         const Vector2i _position, _relativePosition;
         const Buttons _buttons;
+        const Containers::ArrayView<const Vector2i> _history;
         bool _modifiersLoaded;
         Modifiers _modifiers;
 };
@@ -0,0 +1,215 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Platform/RenderThread.h"
+
+namespace Magnum { namespace Platform { namespace Test {
+
+struct RenderThreadTest: TestSuite::Tester {
+    explicit RenderThreadTest();
+
+    void contextHandoff();
+    void snapshotOrdering();
+    void snapshotDoubleBuffered();
+    void renderLastPublishedOnStop();
+    void stopWhileRendering();
+};
+
+RenderThreadTest::RenderThreadTest() {
+    addTests({&RenderThreadTest::contextHandoff,
+              &RenderThreadTest::snapshotOrdering,
+              &RenderThreadTest::snapshotDoubleBuffered,
+              &RenderThreadTest::renderLastPublishedOnStop,
+              &RenderThreadTest::stopWhileRendering});
+}
+
+namespace {
+
+/* Tracks which thread has the context current instead of owning a real one */
+struct FakeApplication {
+    explicit FakeApplication(): owner{std::this_thread::get_id()} {}
+
+    void makeContextCurrent() {
+        std::unique_lock<std::mutex> lock{mutex};
+        if(owner != std::thread::id{}) ++conflicts;
+        owner = std::this_thread::get_id();
+    }
+
+    void releaseContext() {
+        std::unique_lock<std::mutex> lock{mutex};
+        if(owner != std::this_thread::get_id()) ++conflicts;
+        owner = std::thread::id{};
+    }
+
+    bool isCurrent() {
+        std::unique_lock<std::mutex> lock{mutex};
+        return owner == std::this_thread::get_id();
+    }
+
+    std::mutex mutex;
+    std::thread::id owner;
+    Int conflicts{};
+};
+
+struct Frame {
+    Int value{};
+};
+
+}
+
+void RenderThreadTest::contextHandoff() {
+    FakeApplication application;
+    std::atomic<Int> rendered{0}, renderedWithoutContext{0};
+    {
+        RenderThread<Frame> thread{application, [&](const Frame&) {
+            if(!application.isCurrent()) ++renderedWithoutContext;
+            ++rendered;
+        }};
+        CORRADE_VERIFY(!application.isCurrent());
+
+        thread.publish();
+        thread.publish();
+    }
+
+    CORRADE_COMPARE(rendered.load(), 2);
+    CORRADE_COMPARE(renderedWithoutContext.load(), 0);
+    CORRADE_COMPARE(application.conflicts, 0);
+    CORRADE_VERIFY(application.isCurrent());
+}
+
+void RenderThreadTest::snapshotOrdering() {
+    FakeApplication application;
+    std::vector<Int> rendered;
+    {
+        /* Only the render thread touches the vector until it's joined */
+        RenderThread<Frame> thread{application, [&](const Frame& frame) {
+            rendered.push_back(frame.value);
+        }};
+
+        for(Int i = 1; i <= 100; ++i) {
+            thread.snapshot().value = i;
+            thread.publish();
+        }
+    }
+
+    std::vector<Int> expected;
+    for(Int i = 1; i <= 100; ++i) expected.push_back(i);
+    CORRADE_COMPARE(rendered, expected);
+}
+
+void RenderThreadTest::snapshotDoubleBuffered() {
+    FakeApplication application;
+    RenderThread<Frame> thread{application, [](const Frame&) {}};
+
+    Frame* const first = &thread.snapshot();
+    first->value = 1;
+    thread.publish();
+
+    /* The main thread gets the other buffer while the first one renders */
+    Frame* const second = &thread.snapshot();
+    CORRADE_VERIFY(second != first);
+    second->value = 2;
+    thread.publish();
+
+    /* After the second publish the first buffer is handed back, with the
+       data written two frames ago */
+    CORRADE_VERIFY(&thread.snapshot() == first);
+    CORRADE_COMPARE(thread.snapshot().value, 1);
+}
+
+void RenderThreadTest::renderLastPublishedOnStop() {
+    FakeApplication application;
+    std::vector<Int> rendered;
+    {
+        /* Slow renderer, so the last snapshot is still pending when the
+           destructor is entered */
+        RenderThread<Frame> thread{application, [&](const Frame& frame) {
+            std::this_thread::sleep_for(std::chrono::milliseconds{5});
+            rendered.push_back(frame.value);
+        }};
+
+        for(Int i = 1; i <= 3; ++i) {
+            thread.snapshot().value = i;
+            thread.publish();
+        }
+    }
+
+    CORRADE_COMPARE(rendered, (std::vector<Int>{1, 2, 3}));
+    CORRADE_VERIFY(application.isCurrent());
+}
+
+void RenderThreadTest::stopWhileRendering() {
+    FakeApplication application;
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool entered{}, unblocked{};
+    std::atomic<Int> rendered{0};
+    std::atomic<bool> finished{false};
+
+    std::thread unblocker;
+    {
+        RenderThread<Frame> thread{application, [&](const Frame&) {
+            std::unique_lock<std::mutex> lock{mutex};
+            entered = true;
+            condition.notify_all();
+            condition.wait(lock, [&]() { return unblocked; });
+            ++rendered;
+            finished = true;
+        }};
+
+        thread.publish();
+
+        /* Wait until the frame is in flight, then let it finish only after
+           the destructor is already waiting for it */
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            condition.wait(lock, [&]() { return entered; });
+        }
+        unblocker = std::thread{[&]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds{20});
+            std::unique_lock<std::mutex> lock{mutex};
+            unblocked = true;
+            condition.notify_all();
+        }};
+    }
+
+    /* The destructor waited for the in-flight frame and didn't render
+       anything else */
+    CORRADE_VERIFY(finished);
+    CORRADE_COMPARE(rendered.load(), 1);
+    CORRADE_COMPARE(application.conflicts, 0);
+    CORRADE_VERIFY(application.isCurrent());
+
+    unblocker.join();
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Platform::Test::RenderThreadTest)
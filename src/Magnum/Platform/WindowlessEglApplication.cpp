@@ -25,6 +25,7 @@
 
 #include "WindowlessEglApplication.h"
 
+#include <vector>
 #include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Debug.h>
 
@@ -33,11 +34,58 @@
 
 #include "Implementation/Egl.h"
 
+#include <EGL/eglext.h>
+
 namespace Magnum { namespace Platform {
 
+namespace {
+
+/* Empty if the device enumeration or platform device extensions are not
+   available */
+std::vector<EGLDeviceEXT> eglDevices() {
+    #if defined(EGL_EXT_device_enumeration) && defined(EGL_EXT_platform_device)
+    auto eglQueryDevices = reinterpret_cast<PFNEGLQUERYDEVICESEXTPROC>(eglGetProcAddress("eglQueryDevicesEXT"));
+    EGLint count;
+    if(!eglQueryDevices || !eglQueryDevices(0, nullptr, &count) || !count)
+        return {};
+
+    std::vector<EGLDeviceEXT> devices(count);
+    if(!eglQueryDevices(count, devices.data(), &count)) return {};
+    devices.resize(count);
+    return devices;
+    #else
+    return {};
+    #endif
+}
+
+}
+
+UnsignedInt WindowlessEglContext::deviceCount() {
+    return eglDevices().size();
+}
+
 WindowlessEglContext::WindowlessEglContext(const Configuration& configuration, Context*) {
-    /* Initialize */
-    _display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    /* Initialize. The display is the same for all contexts, the shared
+       context is responsible for terminating it. */
+    if(configuration.device() == Configuration::DefaultDevice)
+        _display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    else {
+        #if defined(EGL_EXT_device_enumeration) && defined(EGL_EXT_platform_device)
+        const std::vector<EGLDeviceEXT> devices = eglDevices();
+        auto eglGetPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+        if(configuration.device() >= devices.size() || !eglGetPlatformDisplay) {
+            Error() << "Platform::WindowlessEglApplication::tryCreateContext(): requested device" << configuration.device() << "but only" << devices.size() << "devices are available";
+            return;
+        }
+
+        /* The display is the same for all contexts on given device */
+        _display = eglGetPlatformDisplay(EGL_PLATFORM_DEVICE_EXT, devices[configuration.device()], nullptr);
+        #else
+        Error() << "Platform::WindowlessEglApplication::tryCreateContext(): EGL device selection is not supported";
+        return;
+        #endif
+    }
+    _sharedDisplay = configuration.sharedContext() != EGL_NO_CONTEXT;
     if(!eglInitialize(_display, nullptr, nullptr)) {
         Error() << "Platform::WindowlessEglApplication::tryCreateContext(): cannot initialize EGL:" << Implementation::eglErrorString(eglGetError());
         return;
@@ -96,26 +144,27 @@ WindowlessEglContext::WindowlessEglContext(const Configuration& configuration, C
         EGL_NONE
     };
 
-    if(!(_context = eglCreateContext(_display, config, EGL_NO_CONTEXT, attributes))) {
+    if(!(_context = eglCreateContext(_display, config, configuration.sharedContext(), attributes))) {
         Error() << "Platform::WindowlessEglApplication::tryCreateContext(): cannot create EGL context:" << Implementation::eglErrorString(eglGetError());
         return;
     }
 }
 
-WindowlessEglContext::WindowlessEglContext(WindowlessEglContext&& other): _display{other._display}, _context{other._context} {
+WindowlessEglContext::WindowlessEglContext(WindowlessEglContext&& other): _display{other._display}, _context{other._context}, _sharedDisplay{other._sharedDisplay} {
     other._display = {};
     other._context = {};
 }
 
 WindowlessEglContext::~WindowlessEglContext() {
     if(_context) eglDestroyContext(_display, _context);
-    if(_display) eglTerminate(_display);
+    if(_display && !_sharedDisplay) eglTerminate(_display);
 }
 
 WindowlessEglContext& WindowlessEglContext::operator=(WindowlessEglContext && other) {
     using std::swap;
     swap(other._display, _display);
     swap(other._context, _context);
+    swap(other._sharedDisplay, _sharedDisplay);
     return *this;
 }
 
@@ -154,6 +203,15 @@ bool WindowlessEglApplication::tryCreateContext(const Configuration& configurati
     return true;
 }
 
+WindowlessEglContext WindowlessEglApplication::createSharedContext() { return createSharedContext({}); }
+
+WindowlessEglContext WindowlessEglApplication::createSharedContext(Configuration configuration) {
+    CORRADE_ASSERT(_glContext.isCreated(),
+        "Platform::WindowlessEglApplication::createSharedContext(): no context created", WindowlessEglContext{NoCreate});
+
+    return WindowlessEglContext{configuration.setSharedContext(_glContext.glContext()), _context.get()};
+}
+
 WindowlessEglApplication::~WindowlessEglApplication() = default;
 
 }}
@@ -62,6 +62,15 @@ class WindowlessEglContext {
     public:
         class Configuration;
 
+        /**
+         * @brief Count of available EGL devices
+         *
+         * Returns `0` if @egl_extension{EXT,device_enumeration} is not
+         * supported. See @ref Configuration::setDevice() for more
+         * information.
+         */
+        static UnsignedInt deviceCount();
+
         /**
          * @brief Constructor
          * @param configuration Context configuration
@@ -103,6 +112,14 @@ class WindowlessEglContext {
         /** @brief Whether the context is created */
         bool isCreated() const { return _context; }
 
+        /**
+         * @brief Underlying OpenGL context
+         *
+         * Use in @ref Configuration::setSharedContext() to create another
+         * context sharing objects with this one.
+         */
+        EGLContext glContext() { return _context; }
+
         /**
          * @brief Make the context current
          *
@@ -114,6 +131,7 @@ class WindowlessEglContext {
     private:
         EGLDisplay _display{};
         EGLContext _context{};
+        bool _sharedDisplay{};
 };
 
 /**
@@ -146,6 +164,15 @@ class WindowlessEglContext::Configuration {
         typedef Containers::EnumSet<Flag> Flags;
         #endif
 
+        enum: UnsignedInt {
+            /**
+             * Use the default display
+             *
+             * @see @ref setDevice()
+             */
+            DefaultDevice = ~UnsignedInt{}
+        };
+
         constexpr /*implicit*/ Configuration() {}
 
         /** @brief Context flags */
@@ -162,8 +189,52 @@ class WindowlessEglContext::Configuration {
             return *this;
         }
 
+        /**
+         * @brief Device ID
+         *
+         * @see @ref setDevice()
+         */
+        UnsignedInt device() const { return _device; }
+
+        /**
+         * @brief Set device to create the context on
+         * @return Reference to self (for method chaining)
+         *
+         * If set to a value lower than @ref WindowlessEglContext::deviceCount(),
+         * the context is created on given device using
+         * @egl_extension{EXT,device_enumeration} and
+         * @egl_extension{EXT,platform_device} instead of the default display,
+         * allowing to use a particular GPU on multi-GPU machines without any
+         * windowing system. Default is @ref DefaultDevice. A shared context
+         * (see @ref setSharedContext()) has to be on the same device.
+         */
+        Configuration& setDevice(UnsignedInt id) {
+            _device = id;
+            return *this;
+        }
+
+        /** @brief Shared context */
+        EGLContext sharedContext() const { return _sharedContext; }
+
+        /**
+         * @brief Set context to share objects with
+         * @return Reference to self (for method chaining)
+         *
+         * If set, the created context shares buffers, textures, shaders and
+         * other objects with given context, so it can be used for example to
+         * upload data from a background thread. See
+         * @ref platform-windowless-contexts-shared for more information.
+         * Default is no shared context.
+         */
+        Configuration& setSharedContext(EGLContext context) {
+            _sharedContext = context;
+            return *this;
+        }
+
     private:
         Flags _flags;
+        UnsignedInt _device{DefaultDevice};
+        EGLContext _sharedContext{};
 };
 
 /**
@@ -320,6 +391,24 @@ class WindowlessEglApplication {
          */
         bool tryCreateContext(const Configuration& configuration);
 
+        /**
+         * @brief Create a context sharing objects with the application context
+         *
+         * Creates a new windowless context with given configuration and
+         * @ref Configuration::setSharedContext() set to the application
+         * context. Expects that the application context is already created.
+         * The returned context can be made current in a worker thread, which
+         * then creates its own @ref Platform::Context instance. See
+         * @ref platform-windowless-contexts-shared for more information.
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        WindowlessEglContext createSharedContext(Configuration configuration = Configuration());
+        #else
+        /* To avoid "invalid use of incomplete type" */
+        WindowlessEglContext createSharedContext(Configuration configuration);
+        WindowlessEglContext createSharedContext();
+        #endif
+
     private:
         WindowlessEglContext _glContext;
         std::unique_ptr<Platform::Context> _context;
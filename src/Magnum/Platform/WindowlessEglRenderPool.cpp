@@ -0,0 +1,215 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "WindowlessEglRenderPool.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Framebuffer.h"
+#include "Magnum/Renderbuffer.h"
+#include "Magnum/RenderbufferFormat.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Platform/Context.h"
+#include "Magnum/Platform/WindowlessEglApplication.h"
+
+namespace Magnum { namespace Platform {
+
+struct WindowlessEglRenderPool::Worker::Target {
+    explicit Target(const Vector2i& size):
+        size{size}, framebuffer{{{}, size}}
+    {
+        color.setStorage(RenderbufferFormat::RGBA8, size);
+        depth.setStorage(RenderbufferFormat::DepthComponent24, size);
+        framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment(0), color)
+            .attachRenderbuffer(Framebuffer::BufferAttachment::Depth, depth);
+    }
+
+    Vector2i size;
+    Renderbuffer color, depth;
+    Framebuffer framebuffer;
+    bool used{};
+};
+
+WindowlessEglRenderPool::Worker::Worker(const UnsignedInt id, const UnsignedInt device): _id{id}, _device{device} {}
+
+WindowlessEglRenderPool::Worker::~Worker() = default;
+
+Framebuffer& WindowlessEglRenderPool::Worker::framebuffer(const Vector2i& size) {
+    /* Round the size up to a power of two, with a lower bound so tiny
+       requests don't fragment the pool */
+    Vector2i bucket;
+    for(std::size_t i = 0; i != 2; ++i) {
+        bucket[i] = 64;
+        while(bucket[i] < size[i]) bucket[i] *= 2;
+    }
+
+    Target* target = nullptr;
+    for(std::unique_ptr<Target>& t: _targets) if(!t->used && t->size == bucket) {
+        target = t.get();
+        break;
+    }
+
+    if(!target) {
+        _targets.emplace_back(new Target{bucket});
+        target = _targets.back().get();
+    }
+
+    target->used = true;
+    target->framebuffer.setViewport({{}, size});
+    return target->framebuffer;
+}
+
+void WindowlessEglRenderPool::Worker::release() {
+    for(std::unique_ptr<Target>& t: _targets) t->used = false;
+}
+
+struct WindowlessEglRenderPool::State {
+    explicit State(Int argc, const char** argv): argc{argc}, argv{argv} {}
+
+    void run(WindowlessEglContext& glContext, UnsignedInt id, UnsignedInt device);
+
+    Int argc;
+    const char** argv;
+
+    /* Contexts sharing a display with the first one on given device are
+       listed after it, the vector is destroyed in reverse */
+    std::vector<WindowlessEglContext> glContexts;
+    std::vector<UnsignedInt> devices;
+    std::vector<std::thread> threads;
+
+    std::mutex mutex;
+    std::condition_variable jobAvailable, jobsDone;
+    std::deque<std::function<void(Worker&)>> jobs;
+    std::size_t running{};
+    bool stopping{};
+};
+
+void WindowlessEglRenderPool::State::run(WindowlessEglContext& glContext, const UnsignedInt id, const UnsignedInt device) {
+    if(!glContext.makeCurrent()) std::exit(1);
+
+    Platform::Context context{argc, argv};
+    Worker worker{id, device};
+
+    for(;;) {
+        std::function<void(Worker&)> job;
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            jobAvailable.wait(lock, [this]() { return stopping || !jobs.empty(); });
+            if(jobs.empty()) break;
+
+            job = std::move(jobs.front());
+            jobs.pop_front();
+            ++running;
+        }
+
+        job(worker);
+        worker.release();
+
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            --running;
+            if(jobs.empty() && !running) jobsDone.notify_all();
+        }
+    }
+
+    /* Delete the render targets while the context is still alive */
+    worker._targets.clear();
+}
+
+WindowlessEglRenderPool::WindowlessEglRenderPool(const Int argc, const char** const argv, const UnsignedInt workersPerDevice): _state{new State{argc, argv}} {
+    CORRADE_ASSERT(workersPerDevice, "Platform::WindowlessEglRenderPool: expected at least one worker per device", );
+
+    /* Fall back to the default display if the devices can't be enumerated */
+    const UnsignedInt deviceCount = WindowlessEglContext::deviceCount();
+    std::vector<UnsignedInt> devices;
+    if(deviceCount) for(UnsignedInt i = 0; i != deviceCount; ++i)
+        devices.push_back(i);
+    else devices.push_back(WindowlessEglContext::Configuration::DefaultDevice);
+
+    /* Create all contexts upfront so the vector doesn't reallocate while the
+       threads are using them */
+    #ifndef MAGNUM_BUILD_MULTITHREADED
+    /* Without thread-local current context only one thread can use Magnum */
+    if(devices.size()*workersPerDevice > 1) {
+        Warning() << "Platform::WindowlessEglRenderPool: Magnum is not built with MAGNUM_BUILD_MULTITHREADED, using only one worker";
+        devices.resize(1);
+    }
+    const UnsignedInt workerCount = 1;
+    #else
+    const UnsignedInt workerCount = workersPerDevice;
+    #endif
+    _state->glContexts.reserve(devices.size()*workerCount);
+    for(const UnsignedInt device: devices) {
+        const std::size_t first = _state->glContexts.size();
+        for(UnsignedInt i = 0; i != workerCount; ++i) {
+            WindowlessEglContext::Configuration configuration;
+            configuration.setDevice(device);
+            if(i) configuration.setSharedContext(_state->glContexts[first].glContext());
+
+            _state->glContexts.emplace_back(configuration);
+            if(!_state->glContexts.back().isCreated()) std::exit(1);
+            _state->devices.push_back(device);
+        }
+    }
+
+    for(std::size_t i = 0; i != _state->glContexts.size(); ++i)
+        _state->threads.emplace_back(&State::run, _state.get(), std::ref(_state->glContexts[i]), UnsignedInt(i), _state->devices[i]);
+}
+
+WindowlessEglRenderPool::~WindowlessEglRenderPool() {
+    {
+        std::unique_lock<std::mutex> lock{_state->mutex};
+        _state->stopping = true;
+    }
+    _state->jobAvailable.notify_all();
+
+    for(std::thread& thread: _state->threads) thread.join();
+
+    /* Destroy the contexts sharing a display first */
+    while(!_state->glContexts.empty()) _state->glContexts.pop_back();
+}
+
+std::size_t WindowlessEglRenderPool::workerCount() const {
+    return _state->threads.size();
+}
+
+void WindowlessEglRenderPool::submit(std::function<void(Worker&)> job) {
+    {
+        std::unique_lock<std::mutex> lock{_state->mutex};
+        _state->jobs.push_back(std::move(job));
+    }
+    _state->jobAvailable.notify_one();
+}
+
+void WindowlessEglRenderPool::wait() {
+    std::unique_lock<std::mutex> lock{_state->mutex};
+    _state->jobsDone.wait(lock, [this]() { return _state->jobs.empty() && !_state->running; });
+}
+
+}}
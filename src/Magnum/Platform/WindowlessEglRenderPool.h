@@ -0,0 +1,198 @@
+#ifndef Magnum_Platform_WindowlessEglRenderPool_h
+#define Magnum_Platform_WindowlessEglRenderPool_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Platform::WindowlessEglRenderPool
+ */
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector2.h"
+
+namespace Magnum { namespace Platform {
+
+/**
+@brief Pool of windowless EGL render workers
+
+Keeps a fixed set of worker threads, each with its own persistent
+@ref WindowlessEglContext, and executes submitted jobs on them. Meant for
+batch rendering servers where creating a context and render targets for every
+request would dominate the actual rendering time. It is built together with
+@ref WindowlessEglApplication if `WITH_WINDOWLESSEGLAPPLICATION` is enabled in
+CMake.
+
+If @egl_extension{EXT,device_enumeration} and @egl_extension{EXT,platform_device}
+are available, the pool creates given count of workers on each EGL device
+(see @ref WindowlessEglContext::Configuration::setDevice()), otherwise all
+workers are created on the default display. All workers take jobs from a
+single queue, so faster or less loaded GPUs naturally take more of them.
+Workers on the same device share the GL objects of the first context created
+on it.
+
+@code
+Platform::WindowlessEglRenderPool pool{argc, argv};
+
+for(const Request& request: requests) pool.submit([&request](Platform::WindowlessEglRenderPool::Worker& worker) {
+    Framebuffer& framebuffer = worker.framebuffer(request.size);
+    framebuffer.clear(FramebufferClear::Color|FramebufferClear::Depth)
+        .bind();
+
+    // draw the scene ...
+
+    request.output = framebuffer.read(framebuffer.viewport(), {PixelFormat::RGBA, PixelType::UnsignedByte});
+});
+
+pool.wait();
+@endcode
+
+Note that each job is executed on one of the worker threads, thus it has to
+synchronize access to any data shared with other jobs or with the submitting
+thread. Using more than one worker requires Magnum to be built with
+@ref MAGNUM_BUILD_MULTITHREADED, otherwise the pool falls back to a single
+worker.
+*/
+class WindowlessEglRenderPool {
+    public:
+        class Worker;
+
+        /**
+         * @brief Constructor
+         * @param argc              Count of command-line arguments
+         * @param argv              Command-line arguments
+         * @param workersPerDevice  Count of workers created on each device
+         *
+         * Creates the contexts and starts the worker threads. The arguments
+         * are passed to @ref Platform::Context of each worker and thus have
+         * to stay in scope for the whole pool lifetime. If any of the
+         * contexts can't be created, the application exits.
+         */
+        explicit WindowlessEglRenderPool(Int argc, const char** argv, UnsignedInt workersPerDevice = 1);
+
+        /** @brief Copying is not allowed */
+        WindowlessEglRenderPool(const WindowlessEglRenderPool&) = delete;
+
+        /** @brief Moving is not allowed */
+        WindowlessEglRenderPool(WindowlessEglRenderPool&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Finishes all submitted jobs and stops the worker threads.
+         */
+        ~WindowlessEglRenderPool();
+
+        /** @brief Copying is not allowed */
+        WindowlessEglRenderPool& operator=(const WindowlessEglRenderPool&) = delete;
+
+        /** @brief Moving is not allowed */
+        WindowlessEglRenderPool& operator=(WindowlessEglRenderPool&&) = delete;
+
+        /** @brief Count of workers */
+        std::size_t workerCount() const;
+
+        /**
+         * @brief Submit a job
+         *
+         * The job is executed on the first idle worker, with its GL context
+         * current. Render targets retrieved with @ref Worker::framebuffer()
+         * are released for reuse once the job returns. Can be called from
+         * any thread.
+         * @see @ref wait()
+         */
+        void submit(std::function<void(Worker&)> job);
+
+        /**
+         * @brief Wait for all submitted jobs to finish
+         *
+         * Blocks until the queue is empty and no worker is executing a job.
+         */
+        void wait();
+
+    private:
+        struct State;
+
+        std::unique_ptr<State> _state;
+};
+
+/**
+@brief Render worker
+
+Passed to jobs submitted to @ref WindowlessEglRenderPool.
+*/
+class WindowlessEglRenderPool::Worker {
+    friend WindowlessEglRenderPool;
+
+    public:
+        /** @brief Copying is not allowed */
+        Worker(const Worker&) = delete;
+
+        /** @brief Copying is not allowed */
+        Worker& operator=(const Worker&) = delete;
+
+        /** @brief Worker ID */
+        UnsignedInt id() const { return _id; }
+
+        /**
+         * @brief Device ID
+         *
+         * @ref WindowlessEglContext::Configuration::DefaultDevice if the
+         * worker runs on the default display.
+         */
+        UnsignedInt device() const { return _device; }
+
+        /**
+         * @brief Render target of given size
+         *
+         * Returns a framebuffer with RGBA8 color attachment at
+         * @ref Framebuffer::ColorAttachment "ColorAttachment(0)" and 24-bit
+         * depth attachment, with viewport set to @p size. Targets are pooled
+         * in buckets with each dimension rounded up to a power of two, so
+         * requests of similar sizes reuse the same allocation. Each call in
+         * a single job returns a different target.
+         * @requires_gles30 Extension @es_extension{OES,rgb8_rgba8} and
+         *      @es_extension{OES,depth24} in OpenGL ES 2.0.
+         */
+        Framebuffer& framebuffer(const Vector2i& size);
+
+    private:
+        struct Target;
+
+        explicit Worker(UnsignedInt id, UnsignedInt device);
+        ~Worker();
+
+        void release();
+
+        UnsignedInt _id, _device;
+        std::vector<std::unique_ptr<Target>> _targets;
+};
+
+}}
+
+#endif
@@ -89,7 +89,7 @@ WindowlessGlxContext::WindowlessGlxContext(const WindowlessGlxContext::Configura
         #endif
         0
     };
-    _context = glXCreateContextAttribsARB(_display, configs[0], nullptr, True, contextAttributes);
+    _context = glXCreateContextAttribsARB(_display, configs[0], configuration.sharedContext(), True, contextAttributes);
 
     #ifndef MAGNUM_TARGET_GLES
     /* Fall back to (forward compatible) GL 2.1 if core context creation fails */
@@ -100,7 +100,7 @@ WindowlessGlxContext::WindowlessGlxContext(const WindowlessGlxContext::Configura
             GLX_CONTEXT_FLAGS_ARB, GLint(configuration.flags()),
             0
         };
-        _context = glXCreateContextAttribsARB(_display, configs[0], nullptr, True, fallbackContextAttributes);
+        _context = glXCreateContextAttribsARB(_display, configs[0], configuration.sharedContext(), True, fallbackContextAttributes);
 
     /* Fall back to (forward compatible) GL 2.1 if we are on binary NVidia/AMD
        drivers on Linux. Instead of creating forward-compatible context with
@@ -133,7 +133,7 @@ WindowlessGlxContext::WindowlessGlxContext(const WindowlessGlxContext::Configura
                 GLX_CONTEXT_FLAGS_ARB, GLint(configuration.flags()),
                 0
             };
-            _context = glXCreateContextAttribsARB(_display, configs[0], nullptr, True, fallbackContextAttributes);
+            _context = glXCreateContextAttribsARB(_display, configs[0], configuration.sharedContext(), True, fallbackContextAttributes);
         }
 
         /* Revert back the old context */
@@ -207,6 +207,15 @@ bool WindowlessGlxApplication::tryCreateContext(const Configuration& configurati
     return true;
 }
 
+WindowlessGlxContext WindowlessGlxApplication::createSharedContext() { return createSharedContext({}); }
+
+WindowlessGlxContext WindowlessGlxApplication::createSharedContext(Configuration configuration) {
+    CORRADE_ASSERT(_glContext.isCreated(),
+        "Platform::WindowlessGlxApplication::createSharedContext(): no context created", WindowlessGlxContext{NoCreate});
+
+    return WindowlessGlxContext{configuration.setSharedContext(_glContext.glContext()), _context.get()};
+}
+
 WindowlessGlxApplication::~WindowlessGlxApplication() = default;
 
 }}
@@ -115,6 +115,14 @@ class WindowlessGlxContext {
         /** @brief Whether the context is created */
         bool isCreated() const { return _context; }
 
+        /**
+         * @brief Underlying OpenGL context
+         *
+         * Use in @ref Configuration::setSharedContext() to create another
+         * context sharing objects with this one.
+         */
+        GLXContext glContext() { return _context; }
+
         /**
          * @brief Make the context current
          *
@@ -175,8 +183,27 @@ class WindowlessGlxContext::Configuration {
             return *this;
         }
 
+        /** @brief Shared context */
+        GLXContext sharedContext() const { return _sharedContext; }
+
+        /**
+         * @brief Set context to share objects with
+         * @return Reference to self (for method chaining)
+         *
+         * If set, the created context shares buffers, textures, shaders and
+         * other objects with given context, so it can be used for example to
+         * upload data from a background thread. See
+         * @ref platform-windowless-contexts-shared for more information.
+         * Default is no shared context.
+         */
+        Configuration& setSharedContext(GLXContext context) {
+            _sharedContext = context;
+            return *this;
+        }
+
     private:
         Flags _flags;
+        GLXContext _sharedContext{};
 };
 
 /**
@@ -333,6 +360,24 @@ class WindowlessGlxApplication {
          */
         bool tryCreateContext(const Configuration& configuration);
 
+        /**
+         * @brief Create a context sharing objects with the application context
+         *
+         * Creates a new windowless context with given configuration and
+         * @ref Configuration::setSharedContext() set to the application
+         * context. Expects that the application context is already created.
+         * The returned context can be made current in a worker thread, which
+         * then creates its own @ref Platform::Context instance. See
+         * @ref platform-windowless-contexts-shared for more information.
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        WindowlessGlxContext createSharedContext(Configuration configuration = Configuration());
+        #else
+        /* To avoid "invalid use of incomplete type" */
+        WindowlessGlxContext createSharedContext(Configuration configuration);
+        WindowlessGlxContext createSharedContext();
+        #endif
+
     private:
         WindowlessGlxContext _glContext;
         std::unique_ptr<Platform::Context> _context;
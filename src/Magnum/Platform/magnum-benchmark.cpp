@@ -0,0 +1,575 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Arguments.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Buffer.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Framebuffer.h"
+#include "Magnum/Image.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/MeshView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Renderbuffer.h"
+#include "Magnum/RenderbufferFormat.h"
+#include "Magnum/Renderer.h"
+#include "Magnum/Shader.h"
+#include "Magnum/Texture.h"
+#include "Magnum/TextureFormat.h"
+#ifndef MAGNUM_TARGET_WEBGL
+#include "Magnum/TimeQuery.h"
+#endif
+#include "Magnum/Version.h"
+#include "Magnum/Math/Color.h"
+
+#ifdef MAGNUM_TARGET_HEADLESS
+#include "Magnum/Platform/WindowlessEglApplication.h"
+#elif defined(CORRADE_TARGET_APPLE)
+#include "Magnum/Platform/WindowlessCglApplication.h"
+#elif defined(CORRADE_TARGET_UNIX)
+#if defined(MAGNUM_TARGET_GLES) && !defined(MAGNUM_TARGET_DESKTOP_GLES)
+#include "Magnum/Platform/WindowlessEglApplication.h"
+#else
+#include "Magnum/Platform/WindowlessGlxApplication.h"
+#endif
+#elif defined(CORRADE_TARGET_WINDOWS)
+#if !defined(MAGNUM_TARGET_GLES) || defined(MAGNUM_TARGET_DESKTOP_GLES)
+#include "Magnum/Platform/WindowlessWglApplication.h"
+#else
+#include "Magnum/Platform/WindowlessWindowsEglApplication.h"
+#endif
+#else
+#error no windowless application available on this platform
+#endif
+
+namespace Magnum {
+
+/** @page magnum-benchmark Magnum Benchmark
+@brief Measures OpenGL draw submission throughput
+
+@section magnum-benchmark-usage Usage
+
+    magnum-benchmark [--magnum-...] [-h|--help] [--draws N] [--iterations N]
+        [--size N] [--output FILE]
+
+Arguments:
+-   `-h`, `--help` -- display this help message and exit
+-   `--draws N` -- draw count in one iteration (default: `10000`)
+-   `--iterations N` -- measured iteration count (default: `10`)
+-   `--size N` -- size of the offscreen framebuffer (default: `256`)
+-   `--output FILE` -- write the results into a file instead of standard
+    output
+-   `--magnum-...` -- engine-specific options (see @ref Context for details)
+
+Renders small quads into an offscreen framebuffer using various draw
+submission patterns and measures the time spent on the CPU submitting the
+draws, the time spent on the GPU executing them (using @ref TimeQuery, if
+available) and the total wall time including @ref Renderer::finish(). Each
+benchmark is run once for warm-up and then the given count of iterations is
+measured. The following benchmarks are done:
+
+-   `mesh-draw` -- @ref Mesh::draw() of the same mesh without any state
+    changes in between
+-   `meshview-draw` -- @ref MeshView::draw() of different ranges of the same
+    mesh
+-   `meshview-multidraw` -- all ranges from above submitted with single
+    @ref MeshView::draw(AbstractShaderProgram&, std::initializer_list<std::reference_wrapper<MeshView>>)
+    call, using @fn_gl{MultiDrawArrays} where available
+-   `mesh-instanced` -- single instanced draw with an instance for each draw.
+    Requires @extension{ARB,instanced_arrays} and @extension{ARB,draw_instanced}
+    on desktop, not available in OpenGL ES 2.0 and WebGL 1.0.
+-   `uniform-setuniform` -- per-draw data updated with
+    @ref AbstractShaderProgram::setUniform()
+-   `uniform-ubo-subdata` -- per-draw data uploaded into a single uniform
+    buffer using @ref Buffer::setSubData(). Requires
+    @extension{ARB,uniform_buffer_object}, not available in OpenGL ES 2.0 and
+    WebGL 1.0.
+-   `uniform-ubo-range` -- per-draw data uploaded upfront into one large
+    uniform buffer, for each draw a different range of it is bound using
+    @ref Buffer::bind(Target, UnsignedInt, GLintptr, GLsizeiptr). Same
+    requirements as above.
+-   `texture-same` -- the same texture bound for every draw, measures
+    overhead of the redundant bind filtering
+-   `texture-switch` -- one of sixteen textures bound for every draw
+
+The results are printed as JSON, use `--magnum-log quiet` to suppress the
+context creation log if printing to standard output. In the output, the
+`gpuTime` field is `null` if time queries are not supported, all times are in
+nanoseconds and `drawsPerSecond` is calculated from the CPU time:
+
+    {
+      "application": "Platform::WindowlessGlxApplication",
+      "vendor": "ATI Technologies Inc.",
+      "renderer": "AMD Radeon R7 M260 Series",
+      "version": "4.5.13399 Compatibility Profile Context 15.201.1151",
+      "draws": 10000,
+      "iterations": 10,
+      "results": [
+        {"name": "mesh-draw", "supported": true, "cpuTime": 10942712, "gpuTime": 8201216, "wallTime": 12640118, "drawsPerSecond": 9138466.9},
+        ...
+      ]
+    }
+
+*/
+
+namespace {
+
+class BenchmarkShader: public AbstractShaderProgram {
+    public:
+        typedef Attribute<0, Vector2> Position;
+        typedef Attribute<1, Vector2> InstanceOffset;
+
+        enum: UnsignedInt { DrawBufferBinding = 0 };
+
+        explicit BenchmarkShader(Version version, bool uniformBuffer);
+
+        BenchmarkShader& setOffset(const Vector2& offset) {
+            setUniform(_offsetUniform, offset);
+            return *this;
+        }
+
+        BenchmarkShader& setColor(const Color4& color) {
+            setUniform(_colorUniform, color);
+            return *this;
+        }
+
+    private:
+        Int _offsetUniform{-1},
+            _colorUniform{-1};
+};
+
+BenchmarkShader::BenchmarkShader(const Version version, const bool uniformBuffer) {
+    Shader vert{version, Shader::Type::Vertex};
+    Shader frag{version, Shader::Type::Fragment};
+
+    const char* common =
+        "#if (defined(GL_ES) && __VERSION__ < 300) || (!defined(GL_ES) && __VERSION__ < 140)\n"
+        "#define LEGACY_GLSL\n"
+        "#endif\n"
+        "#ifdef GL_ES\n"
+        "precision mediump float;\n"
+        "#endif\n";
+    vert.addSource(common);
+    frag.addSource(common);
+    if(uniformBuffer) vert.addSource("#define UNIFORM_BUFFER\n");
+
+    vert.addSource(
+        "#ifdef LEGACY_GLSL\n"
+        "#define in attribute\n"
+        "#define out varying\n"
+        "#endif\n"
+        "#ifdef UNIFORM_BUFFER\n"
+        "layout(std140) uniform Draw {\n"
+        "    vec4 offset;\n"
+        "    vec4 color;\n"
+        "};\n"
+        "#else\n"
+        "uniform vec2 offset;\n"
+        "uniform vec4 color;\n"
+        "#endif\n"
+        "in vec2 position;\n"
+        "in vec2 instanceOffset;\n"
+        "out vec4 interpolatedColor;\n"
+        "out vec2 textureCoordinates;\n"
+        "void main() {\n"
+        "    interpolatedColor = color;\n"
+        "    textureCoordinates = position*0.5 + vec2(0.5);\n"
+        "    gl_Position = vec4(position*0.05 + offset.xy + instanceOffset, 0.0, 1.0);\n"
+        "}\n");
+    frag.addSource(
+        "#ifdef LEGACY_GLSL\n"
+        "#define in varying\n"
+        "#define texture texture2D\n"
+        "#define fragmentColor gl_FragColor\n"
+        "#else\n"
+        "out vec4 fragmentColor;\n"
+        "#endif\n"
+        "uniform sampler2D textureData;\n"
+        "in vec4 interpolatedColor;\n"
+        "in vec2 textureCoordinates;\n"
+        "void main() {\n"
+        "    fragmentColor = interpolatedColor*texture(textureData, textureCoordinates);\n"
+        "}\n");
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({vert, frag}));
+
+    attachShaders({vert, frag});
+    bindAttributeLocation(Position::Location, "position");
+    bindAttributeLocation(InstanceOffset::Location, "instanceOffset");
+    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+    #ifndef MAGNUM_TARGET_GLES2
+    if(uniformBuffer)
+        setUniformBlockBinding(uniformBlockIndex("Draw"), DrawBufferBinding);
+    else
+    #endif
+    {
+        _offsetUniform = uniformLocation("offset");
+        _colorUniform = uniformLocation("color");
+    }
+    setUniform(uniformLocation("textureData"), 0);
+}
+
+/* Layout of the uniform block */
+struct DrawData {
+    Vector4 offset;
+    Color4 color;
+};
+
+struct Result {
+    std::string name;
+    bool supported;
+    std::chrono::nanoseconds::rep cpuTime, gpuTime, wallTime;
+};
+
+std::string escape(const std::string& string) {
+    std::string out;
+    for(const char c: string) {
+        if(c == '"' || c == '\\') out += '\\';
+        if(UnsignedByte(c) < 0x20) out += ' ';
+        else out += c;
+    }
+    return out;
+}
+
+class MagnumBenchmark: public Platform::WindowlessApplication {
+    public:
+        explicit MagnumBenchmark(const Arguments& arguments);
+
+        int exec() override { return 0; }
+
+    private:
+        /* Runs the submission once for warm-up and then measures given
+           iteration count */
+        Result measure(std::string name, const std::function<void()>& submit);
+        Result unsupported(std::string name) const;
+
+        Vector2 offset(std::size_t i) const;
+        Color4 color(std::size_t i) const;
+
+        UnsignedInt _drawCount, _iterationCount;
+        bool _timeQuery{};
+};
+
+MagnumBenchmark::MagnumBenchmark(const Arguments& arguments): Platform::WindowlessApplication{arguments, NoCreate} {
+    Utility::Arguments args;
+    args.addOption("draws", "10000").setHelp("draws", "draw count in one iteration", "N")
+        .addOption("iterations", "10").setHelp("iterations", "measured iteration count", "N")
+        .addOption("size", "256").setHelp("size", "size of the offscreen framebuffer", "N")
+        .addOption("output").setHelp("output", "write the results into a file instead of standard output", "FILE")
+        .addSkippedPrefix("magnum", "engine-specific options")
+        .setHelp("Measures OpenGL draw submission throughput.")
+        .parse(arguments.argc, arguments.argv);
+
+    _drawCount = args.value<UnsignedInt>("draws");
+    _iterationCount = args.value<UnsignedInt>("iterations");
+    const Vector2i size{args.value<Int>("size")};
+
+    createContext();
+    Context& c = Context::current();
+
+    #ifndef MAGNUM_TARGET_GLES
+    const Version version = c.supportedVersion({Version::GL310, Version::GL210});
+    const bool uniformBuffers = version == Version::GL310 && c.isExtensionSupported<Extensions::GL::ARB::uniform_buffer_object>();
+    const bool instancing = c.isExtensionSupported<Extensions::GL::ARB::instanced_arrays>() && c.isExtensionSupported<Extensions::GL::ARB::draw_instanced>();
+    _timeQuery = c.isExtensionSupported<Extensions::GL::ARB::timer_query>();
+    #else
+    const Version version = c.supportedVersion({Version::GLES300, Version::GLES200});
+    #ifndef MAGNUM_TARGET_GLES2
+    const bool uniformBuffers = true;
+    const bool instancing = true;
+    #endif
+    #ifndef MAGNUM_TARGET_WEBGL
+    _timeQuery = c.isExtensionSupported<Extensions::GL::EXT::disjoint_timer_query>();
+    #endif
+    #endif
+
+    /* Offscreen framebuffer */
+    Renderbuffer colorBuffer;
+    #ifndef MAGNUM_TARGET_GLES2
+    colorBuffer.setStorage(RenderbufferFormat::RGBA8, size);
+    #else
+    colorBuffer.setStorage(RenderbufferFormat::RGBA4, size);
+    #endif
+    Framebuffer framebuffer{{{}, size}};
+    framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment{0}, colorBuffer)
+        .bind();
+
+    /* A quad made of two triangles, repeated for every view so each view
+       draws a different range. The views are further repeated to get the
+       wanted draw count. */
+    constexpr std::size_t ViewRangeCount = 64;
+    const Vector2 quad[]{{-1.0f, -1.0f}, { 1.0f, -1.0f}, {-1.0f,  1.0f},
+                         {-1.0f,  1.0f}, { 1.0f, -1.0f}, { 1.0f,  1.0f}};
+    std::vector<Vector2> positions;
+    positions.reserve(ViewRangeCount*6);
+    for(std::size_t i = 0; i != ViewRangeCount; ++i)
+        positions.insert(positions.end(), std::begin(quad), std::end(quad));
+    Buffer vertices;
+    vertices.setData(positions, BufferUsage::StaticDraw);
+
+    Mesh mesh;
+    mesh.setPrimitive(MeshPrimitive::Triangles)
+        .setCount(6)
+        .addVertexBuffer(vertices, 0, BenchmarkShader::Position{});
+
+    std::vector<MeshView> views;
+    views.reserve(_drawCount);
+    for(std::size_t i = 0; i != _drawCount; ++i) {
+        views.emplace_back(mesh);
+        views.back().setCount(6)
+            .setBaseVertex(6*(i%ViewRangeCount));
+    }
+    std::vector<std::reference_wrapper<MeshView>> viewReferences{views.begin(), views.end()};
+
+    /* Textures */
+    std::vector<Texture2D> textures;
+    textures.reserve(16);
+    for(std::size_t i = 0; i != 16; ++i) {
+        const Color4ub pixels[]{Color4ub{UnsignedByte(i*16), 255, 255, 255}, Color4ub{255},
+                                Color4ub{255}, Color4ub{UnsignedByte(i*16), 255, 255, 255}};
+        textures.emplace_back();
+        textures.back().setMinificationFilter(Sampler::Filter::Nearest)
+            .setMagnificationFilter(Sampler::Filter::Nearest)
+            #ifndef MAGNUM_TARGET_GLES2
+            .setImage(0, TextureFormat::RGBA8, ImageView2D{PixelFormat::RGBA, PixelType::UnsignedByte, {2, 2}, pixels});
+            #else
+            .setImage(0, TextureFormat::RGBA, ImageView2D{PixelFormat::RGBA, PixelType::UnsignedByte, {2, 2}, pixels});
+            #endif
+    }
+    textures[0].bind(0);
+
+    BenchmarkShader shader{version, false};
+    shader.setOffset({})
+        .setColor(Color4{1.0f});
+
+    std::vector<Result> results;
+
+    /* Mesh submission */
+    results.push_back(measure("mesh-draw", [&]() {
+        for(std::size_t i = 0; i != _drawCount; ++i)
+            mesh.draw(shader);
+    }));
+    results.push_back(measure("meshview-draw", [&]() {
+        for(MeshView& view: views)
+            view.draw(shader);
+    }));
+    results.push_back(measure("meshview-multidraw", [&]() {
+        MeshView::draw(shader, {viewReferences.data(), viewReferences.size()});
+    }));
+
+    #ifndef MAGNUM_TARGET_GLES2
+    if(instancing) {
+        std::vector<Vector2> offsets;
+        offsets.reserve(_drawCount);
+        for(std::size_t i = 0; i != _drawCount; ++i)
+            offsets.push_back(offset(i));
+        Buffer instanceData;
+        instanceData.setData(offsets, BufferUsage::StaticDraw);
+
+        Mesh instanced;
+        instanced.setPrimitive(MeshPrimitive::Triangles)
+            .setCount(6)
+            .setInstanceCount(_drawCount)
+            .addVertexBuffer(vertices, 0, BenchmarkShader::Position{})
+            .addVertexBufferInstanced(instanceData, 1, 0, BenchmarkShader::InstanceOffset{});
+
+        results.push_back(measure("mesh-instanced", [&]() {
+            instanced.draw(shader);
+        }));
+    } else
+    #endif
+    {
+        results.push_back(unsupported("mesh-instanced"));
+    }
+
+    /* Uniform updates */
+    results.push_back(measure("uniform-setuniform", [&]() {
+        for(std::size_t i = 0; i != _drawCount; ++i) {
+            shader.setOffset(offset(i))
+                .setColor(color(i));
+            mesh.draw(shader);
+        }
+    }));
+
+    #ifndef MAGNUM_TARGET_GLES2
+    if(uniformBuffers) {
+        BenchmarkShader uniformBufferShader{version, true};
+
+        Buffer drawData;
+        drawData.setData({nullptr, sizeof(DrawData)}, BufferUsage::DynamicDraw);
+        drawData.bind(Buffer::Target::Uniform, BenchmarkShader::DrawBufferBinding);
+        results.push_back(measure("uniform-ubo-subdata", [&]() {
+            for(std::size_t i = 0; i != _drawCount; ++i) {
+                const DrawData data[]{{Vector4::pad(offset(i)), color(i)}};
+                drawData.setSubData(0, data);
+                mesh.draw(uniformBufferShader);
+            }
+        }));
+
+        /* Each range has to start at a properly aligned offset */
+        const std::size_t stride = (sizeof(DrawData) + Buffer::uniformOffsetAlignment() - 1)/Buffer::uniformOffsetAlignment()*Buffer::uniformOffsetAlignment();
+        Containers::Array<char> allData{Containers::ValueInit, stride*_drawCount};
+        for(std::size_t i = 0; i != _drawCount; ++i)
+            *reinterpret_cast<DrawData*>(allData + i*stride) = DrawData{Vector4::pad(offset(i)), color(i)};
+        Buffer allDrawData;
+        allDrawData.setData(allData, BufferUsage::StaticDraw);
+        results.push_back(measure("uniform-ubo-range", [&]() {
+            for(std::size_t i = 0; i != _drawCount; ++i) {
+                allDrawData.bind(Buffer::Target::Uniform, BenchmarkShader::DrawBufferBinding, i*stride, sizeof(DrawData));
+                mesh.draw(uniformBufferShader);
+            }
+        }));
+    } else
+    #endif
+    {
+        results.push_back(unsupported("uniform-ubo-subdata"));
+        results.push_back(unsupported("uniform-ubo-range"));
+    }
+
+    /* Texture binding */
+    shader.setOffset({})
+        .setColor(Color4{1.0f});
+    results.push_back(measure("texture-same", [&]() {
+        for(std::size_t i = 0; i != _drawCount; ++i) {
+            textures[0].bind(0);
+            mesh.draw(shader);
+        }
+    }));
+    results.push_back(measure("texture-switch", [&]() {
+        for(std::size_t i = 0; i != _drawCount; ++i) {
+            textures[i%textures.size()].bind(0);
+            mesh.draw(shader);
+        }
+    }));
+
+    /* Output */
+    std::ostringstream out;
+    out << "{\n";
+    #ifdef MAGNUM_WINDOWLESSEGLAPPLICATION_MAIN
+    out << "  \"application\": \"Platform::WindowlessEglApplication\",\n";
+    #elif defined(MAGNUM_WINDOWLESSCGLAPPLICATION_MAIN)
+    out << "  \"application\": \"Platform::WindowlessCglApplication\",\n";
+    #elif defined(MAGNUM_WINDOWLESSGLXAPPLICATION_MAIN)
+    out << "  \"application\": \"Platform::WindowlessGlxApplication\",\n";
+    #elif defined(MAGNUM_WINDOWLESSWGLAPPLICATION_MAIN)
+    out << "  \"application\": \"Platform::WindowlessWglApplication\",\n";
+    #elif defined(MAGNUM_WINDOWLESSWINDOWSEGLAPPLICATION_MAIN)
+    out << "  \"application\": \"Platform::WindowlessWindowsEglApplication\",\n";
+    #endif
+    out << "  \"vendor\": \"" << escape(c.vendorString()) << "\",\n"
+        << "  \"renderer\": \"" << escape(c.rendererString()) << "\",\n"
+        << "  \"version\": \"" << escape(c.versionString()) << "\",\n"
+        << "  \"draws\": " << _drawCount << ",\n"
+        << "  \"iterations\": " << _iterationCount << ",\n"
+        << "  \"results\": [\n";
+    for(std::size_t i = 0; i != results.size(); ++i) {
+        const Result& result = results[i];
+        out << "    {\"name\": \"" << result.name << "\", \"supported\": " << (result.supported ? "true" : "false");
+        if(result.supported) {
+            out << ", \"cpuTime\": " << result.cpuTime << ", \"gpuTime\": ";
+            if(_timeQuery) out << result.gpuTime;
+            else out << "null";
+            out << ", \"wallTime\": " << result.wallTime
+                << ", \"drawsPerSecond\": " << (result.cpuTime ? Double(_drawCount)*_iterationCount*1.0e9/result.cpuTime : 0.0);
+        }
+        out << '}' << (i + 1 != results.size() ? "," : "") << '\n';
+    }
+    out << "  ]\n}\n";
+
+    if(args.value("output").empty()) std::cout << out.str();
+    else {
+        std::ofstream file{args.value("output")};
+        if(!file) {
+            Error() << "Cannot write to file" << args.value("output");
+            return;
+        }
+        file << out.str();
+    }
+}
+
+Result MagnumBenchmark::measure(std::string name, const std::function<void()>& submit) {
+    Renderer::finish();
+    submit();
+    Renderer::finish();
+
+    Result result{std::move(name), true, 0, 0, 0};
+    for(UnsignedInt i = 0; i != _iterationCount; ++i) {
+        #ifndef MAGNUM_TARGET_WEBGL
+        TimeQuery query{NoCreate};
+        if(_timeQuery) {
+            query = TimeQuery{TimeQuery::Target::TimeElapsed};
+            query.begin();
+        }
+        #endif
+
+        const auto start = std::chrono::high_resolution_clock::now();
+        submit();
+        const auto submitted = std::chrono::high_resolution_clock::now();
+
+        #ifndef MAGNUM_TARGET_WEBGL
+        if(_timeQuery) query.end();
+        #endif
+
+        Renderer::finish();
+        const auto finished = std::chrono::high_resolution_clock::now();
+
+        result.cpuTime += std::chrono::duration_cast<std::chrono::nanoseconds>(submitted - start).count();
+        result.wallTime += std::chrono::duration_cast<std::chrono::nanoseconds>(finished - start).count();
+        #ifndef MAGNUM_TARGET_WEBGL
+        if(_timeQuery) result.gpuTime += query.result<UnsignedLong>();
+        #endif
+    }
+
+    return result;
+}
+
+Result MagnumBenchmark::unsupported(std::string name) const {
+    return Result{std::move(name), false, 0, 0, 0};
+}
+
+Vector2 MagnumBenchmark::offset(const std::size_t i) const {
+    return {Float(i%32)/16.0f - 1.0f, Float((i/32)%32)/16.0f - 1.0f};
+}
+
+Color4 MagnumBenchmark::color(const std::size_t i) const {
+    return {Float(i%7)/6.0f, Float(i%11)/10.0f, Float(i%13)/12.0f, 1.0f};
+}
+
+}
+
+}
+
+MAGNUM_WINDOWLESSAPPLICATION_MAIN(Magnum::MagnumBenchmark)
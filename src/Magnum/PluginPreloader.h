@@ -0,0 +1,137 @@
+#ifndef Magnum_PluginPreloader_h
+#define Magnum_PluginPreloader_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::PluginPreloader
+ */
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <Corrade/PluginManager/Manager.h>
+
+#include "Magnum/Magnum.h"
+
+namespace Magnum {
+
+/**
+@brief Background plugin preloader
+
+Plugins are usually loaded by @ref Corrade::PluginManager::Manager::load() on
+first use, which can be in the middle of loading a level, and the dynamic
+library loading then stalls the main thread. This class loads a list of
+plugins on a background thread right away, so they're available by the time
+they're needed:
+@code
+PluginManager::Manager<Trade::AbstractImporter> importerManager{MAGNUM_PLUGINS_IMPORTER_DIR};
+PluginPreloader<Trade::AbstractImporter> preloader{importerManager, {"ObjImporter", "TgaImporter"}};
+
+// create the window, compile shaders ...
+
+preloader.wait();
+std::unique_ptr<Trade::AbstractImporter> importer = importerManager.instance("TgaImporter");
+@endcode
+
+The plugin manager isn't thread-safe, so it must not be used from any other
+thread, including for loading of other plugins, until @ref wait() returns.
+After that, subsequent @ref Corrade::PluginManager::Manager::load() calls for the
+preloaded plugins return immediately and the plugins can be instantiated as
+usual, for example through @ref Trade::BatchImporter.
+
+Plugin discovery (scanning of the plugin directory) is done by the plugin
+manager constructor and is thus not affected by this class.
+*/
+template<class T> class PluginPreloader {
+    public:
+        /**
+         * @brief Constructor
+         * @param manager   Plugin manager
+         * @param plugins   Names of plugins to load
+         *
+         * Starts loading the plugins on a background thread.
+         */
+        explicit PluginPreloader(PluginManager::Manager<T>& manager, std::vector<std::string> plugins);
+
+        /** @brief Copying is not allowed */
+        PluginPreloader(const PluginPreloader<T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        PluginPreloader(PluginPreloader<T>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Waits for the loading to finish using @ref wait().
+         */
+        ~PluginPreloader() { wait(); }
+
+        /** @brief Copying is not allowed */
+        PluginPreloader<T>& operator=(const PluginPreloader<T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        PluginPreloader<T>& operator=(PluginPreloader<T>&&) = delete;
+
+        /**
+         * @brief Whether the loading is finished
+         *
+         * If this returns `true`, @ref wait() doesn't block.
+         */
+        bool isFinished() const { return _finished; }
+
+        /**
+         * @brief Wait for the loading to finish
+         * @return Names of plugins that failed to load
+         *
+         * After this function returns, the plugin manager can be used again.
+         */
+        const std::vector<std::string>& wait();
+
+    private:
+        std::vector<std::string> _plugins, _failed;
+        std::atomic<bool> _finished;
+        std::thread _thread;
+};
+
+template<class T> PluginPreloader<T>::PluginPreloader(PluginManager::Manager<T>& manager, std::vector<std::string> plugins): _plugins{std::move(plugins)}, _finished{false} {
+    /* Started last, after all members are initialized */
+    _thread = std::thread{[this, &manager]() {
+        for(const std::string& plugin: _plugins)
+            if(!(manager.load(plugin) & PluginManager::LoadState::Loaded))
+                _failed.push_back(plugin);
+        _finished = true;
+    }};
+}
+
+template<class T> const std::vector<std::string>& PluginPreloader<T>::wait() {
+    if(_thread.joinable()) _thread.join();
+    return _failed;
+}
+
+}
+
+#endif
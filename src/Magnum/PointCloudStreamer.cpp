@@ -0,0 +1,229 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "PointCloudStreamer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Geometry/Intersection.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/PointCloudOctree.h"
+
+namespace Magnum {
+
+PointCloudStreamer::PointCloudStreamer(const Trade::PointCloudOctree& octree, Trade::AbstractImporter& importer, const UnsignedInt capacity, const BufferUsage usage): _octree(octree), _importer(importer), _allocator{capacity}, _vertexBuffer{Buffer::TargetHint::Array}, _mesh{MeshPrimitive::Points}, _nodes(octree.nodeCount(), Node{NodeState::NotLoaded, 0, 0}) {
+    CORRADE_ASSERT(capacity,
+        "PointCloudStreamer: expected non-zero capacity", );
+
+    _vertexBuffer.setData({nullptr, std::size_t(capacity)*sizeof(Trade::PointCloudOctreeVertex)}, usage);
+}
+
+Float PointCloudStreamer::nodeError(const UnsignedInt id, const Vector3& cameraPosition, const Matrix4& projection, const Vector2i& viewportSize) const {
+    const Float spacing = _octree.nodeSpacing(id)*projection[1][1]*viewportSize.y()*0.5f;
+
+    /* Orthographic projection, the size doesn't depend on distance */
+    if(projection[3][3] != 0.0f) return spacing;
+
+    const Range3D bounds = _octree.nodeBounds(id);
+    const Float distance = (bounds.center() - cameraPosition).length() - bounds.size().length()*0.5f;
+    if(distance <= 0.0f) return std::numeric_limits<Float>::infinity();
+    return spacing/distance;
+}
+
+bool PointCloudStreamer::isResident(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _nodes.size(),
+        "PointCloudStreamer::isResident(): index" << id << "out of range for" << _nodes.size() << "nodes", false);
+    return _nodes[id].state == NodeState::Resident;
+}
+
+bool PointCloudStreamer::isFailed(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _nodes.size(),
+        "PointCloudStreamer::isFailed(): index" << id << "out of range for" << _nodes.size() << "nodes", false);
+    return _nodes[id].state == NodeState::Failed;
+}
+
+void PointCloudStreamer::evict(const UnsignedInt id) {
+    Node& node = _nodes[id];
+    if(_octree.node(id).pointCount) _allocator.free(node.offset);
+    node.state = NodeState::NotLoaded;
+    --_residentNodeCount;
+    ++_evictionCount;
+}
+
+bool PointCloudStreamer::allocate(const UnsignedInt id) {
+    const UnsignedInt pointCount = _octree.node(id).pointCount;
+    std::optional<UnsignedInt> offset = _allocator.allocate(pointCount);
+    if(!offset) {
+        /* Evict the nodes that weren't used for the longest time until the
+           node fits. Nodes selected in this update stay. */
+        _evictionCandidates.clear();
+        for(std::size_t i = 0; i != _nodes.size(); ++i)
+            if(_nodes[i].state == NodeState::Resident && _nodes[i].lastUsed != _frame && _octree.node(i).pointCount)
+                _evictionCandidates.emplace_back(_nodes[i].lastUsed, i);
+        std::sort(_evictionCandidates.begin(), _evictionCandidates.end());
+
+        for(const auto& candidate: _evictionCandidates) {
+            evict(candidate.second);
+            if((offset = _allocator.allocate(pointCount))) break;
+        }
+
+        if(!offset) return false;
+    }
+
+    _nodes[id].offset = *offset;
+    return true;
+}
+
+bool PointCloudStreamer::load(const UnsignedInt id) {
+    const UnsignedInt pointCount = _octree.node(id).pointCount;
+
+    /* Nothing to upload for empty nodes */
+    if(!pointCount) return true;
+
+    std::optional<Containers::Array<char>> data = _octree.nodeData(id);
+    if(!data || !_importer.openData(*data)) {
+        Error() << "PointCloudStreamer::update(): can't open data of node" << id;
+        return false;
+    }
+
+    std::optional<Trade::MeshData> mesh = _importer.mesh3DCount() ? _importer.mesh(0) : std::nullopt;
+    _importer.close();
+    if(!mesh) {
+        Error() << "PointCloudStreamer::update(): can't import data of node" << id;
+        return false;
+    }
+
+    const std::size_t size = std::size_t(pointCount)*sizeof(Trade::PointCloudOctreeVertex);
+    if(mesh->vertexCount() != pointCount || mesh->vertexData().size() != size) {
+        Error() << "PointCloudStreamer::update(): expected" << pointCount << "points in" << size << "bytes for node" << id << "but got" << mesh->vertexCount() << "points in" << mesh->vertexData().size() << "bytes";
+        return false;
+    }
+
+    _vertexBuffer.setSubData(GLintptr(_nodes[id].offset)*sizeof(Trade::PointCloudOctreeVertex), mesh->vertexData());
+    _uploadedSize += size;
+    return true;
+}
+
+void PointCloudStreamer::update(const Matrix4& transformation, const Matrix4& projection, const Vector2i& viewportSize) {
+    ++_frame;
+    _views.clear();
+    _viewReferences.clear();
+    _selectedNodeCount = _drawnPointCount = _uploadCount = _evictionCount = 0;
+    _uploadedSize = 0;
+    if(_nodes.empty() || !_pointBudget) return;
+
+    const Frustum frustum = Frustum::fromMatrix(projection*transformation);
+    const Vector3 cameraPosition = transformation.inverted().translation();
+
+    /* Nodes with the largest error first, the queue is a max-heap */
+    _queue.clear();
+    _drawn.clear();
+    auto push = [&](const UnsignedInt id) {
+        const Range3D bounds = _octree.nodeBounds(id);
+        if(!Math::Geometry::Intersection::aabbFrustum(bounds.center(), bounds.size()*0.5f, frustum.planes()))
+            return;
+        _queue.emplace_back(nodeError(id, cameraPosition, projection, viewportSize), id);
+        std::push_heap(_queue.begin(), _queue.end());
+    };
+    push(0);
+
+    UnsignedInt selectedPointCount = 0;
+    while(!_queue.empty()) {
+        std::pop_heap(_queue.begin(), _queue.end());
+        const Float error = _queue.back().first;
+        const UnsignedInt id = _queue.back().second;
+        _queue.pop_back();
+
+        Node& node = _nodes[id];
+        if(node.state == NodeState::Failed) continue;
+
+        const Trade::PointCloudOctreeNode& data = _octree.node(id);
+        if(selectedPointCount + data.pointCount > _pointBudget) break;
+        selectedPointCount += data.pointCount;
+        ++_selectedNodeCount;
+        node.lastUsed = _frame;
+
+        /* Load the node if there's still room in the upload limit. The
+           subtree can't be drawn until the node is resident. */
+        if(node.state == NodeState::NotLoaded) {
+            if(_uploadCount && _uploadedSize >= _uploadLimit) continue;
+
+            if(data.pointCount > _allocator.capacity()) {
+                Error() << "PointCloudStreamer::update(): node" << id << "with" << data.pointCount << "points doesn't fit into capacity of" << _allocator.capacity() << "points";
+                node.state = NodeState::Failed;
+                continue;
+            }
+
+            /* Not enough space left after the nodes selected in this update,
+               try again next time */
+            if(data.pointCount && !allocate(id)) continue;
+
+            ++_uploadCount;
+            if(!load(id)) {
+                if(data.pointCount) _allocator.free(node.offset);
+                node.state = NodeState::Failed;
+                continue;
+            }
+            node.state = NodeState::Resident;
+            ++_residentNodeCount;
+        }
+
+        if(data.pointCount) _drawn.push_back(id);
+
+        /* Refine if the node is too coarse */
+        if(error > _errorThreshold) for(UnsignedInt i = 0, child = data.firstChild; i != 8; ++i)
+            if(data.childMask & (1 << i)) push(child++);
+    }
+
+    /* Set up the views for drawing */
+    _views.reserve(_drawn.size());
+    for(const UnsignedInt id: _drawn) {
+        const UnsignedInt pointCount = _octree.node(id).pointCount;
+        _views.emplace_back(_mesh);
+        _views.back().setCount(pointCount)
+            .setBaseVertex(_nodes[id].offset);
+        _drawnPointCount += pointCount;
+    }
+
+    /* The views don't move until the next update */
+    _viewReferences.assign(_views.begin(), _views.end());
+}
+
+void PointCloudStreamer::draw(AbstractShaderProgram& shader) {
+    if(_views.empty()) return;
+
+    MeshView::draw(shader, {_viewReferences.data(), _viewReferences.size()});
+}
+
+}
@@ -0,0 +1,329 @@
+#ifndef Magnum_PointCloudStreamer_h
+#define Magnum_PointCloudStreamer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::PointCloudStreamer
+ */
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "Magnum/Buffer.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/MeshArena.h"
+#include "Magnum/MeshView.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum {
+
+/**
+@brief Point cloud streamer
+
+Draws a @ref Trade::PointCloudOctree that doesn't fit into memory. Point data
+of the nodes that are needed for the current view are loaded on demand into a
+single vertex @ref Buffer with ranges allocated by a @ref RangeAllocator,
+nodes that weren't needed for the longest time are evicted when there's no
+space left. All resident nodes are drawn with a single @ref MeshView::draw()
+call of one shared @ref MeshPrimitive::Points @ref Mesh.
+
+## Usage
+
+The node data are decoded with an importer plugin able to open the mesh
+format the octree was built with, for example
+@ref Trade::MagnumMeshImporter "MagnumMeshImporter". The vertex layout is
+specified on @ref mesh() by the application, the data are interleaved as
+described by @ref Trade::PointCloudOctreeVertex. Each frame, call
+@ref update() with the current camera and draw the points using @ref draw():
+@code
+std::optional<Trade::PointCloudOctree> octree = Trade::PointCloudOctree::open("cloud.mgoctree");
+std::unique_ptr<Trade::AbstractImporter> importer = manager.loadAndInstantiate("MagnumMeshImporter");
+
+PointCloudStreamer streamer{*octree, *importer, 8*1024*1024};
+streamer.mesh().addVertexBuffer(streamer.vertexBuffer(), 0,
+    Shaders::VertexColor3D::Position{},
+    Shaders::VertexColor3D::Color{Shaders::VertexColor3D::Color::Components::Four,
+        Shaders::VertexColor3D::Color::DataType::UnsignedByte,
+        Shaders::VertexColor3D::Color::DataOption::Normalized});
+
+// each frame
+streamer.update(transformation, camera.projectionMatrix(), camera.viewport());
+streamer.draw(shader);
+@endcode
+
+The octree and the importer must be available for whole lifetime of the
+streamer.
+
+@anchor PointCloudStreamer-streaming-strategy
+## Streaming strategy
+
+Every point of the cloud is stored in exactly one node, interior nodes
+contain an evenly spaced subsample of their subtree, so the cloud is drawn by
+drawing a connected set of nodes starting at the root. Size of the point
+spacing of given node projected to the screen, in pixels, is used as its
+error. On @ref update(), nodes intersecting the view frustum are processed
+from the one with the largest error and each is selected for drawing as long
+as the count of selected points stays within @ref pointBudget(). Children of
+a selected node are considered only if its error is larger than
+@ref errorThreshold() and the node is resident, so the drawn set is always
+connected and the cloud gets refined over a few frames as the data arrive.
+
+Selected nodes that aren't resident are loaded in the same update until the
+size of data uploaded in it reaches @ref uploadLimit(), at least one node is
+loaded in each update. If there's no space left in the buffer, resident nodes
+that were not selected in this update are evicted, starting with the node
+that was selected longest time ago. If that's still not enough, the node is
+skipped in this update. Nodes that can't be loaded, either
+because the data are invalid or the node wouldn't fit into the buffer even if
+it was empty, are marked as failed and never loaded again, their subtrees are
+not drawn.
+
+Loading is synchronous, so the upload limit should be chosen so the file
+access and decoding fits into the frame time. An octree built by
+@ref Trade::PointCloudOctreeBuilder from a file of @ref Trade::MagnumMeshConverter "MagnumMeshConverter"
+has node data in the same layout as in the vertex buffer, so the import is
+just a copy from the memory-mapped file.
+@see @ref MeshArena, @ref TextureStreamer
+*/
+class MAGNUM_EXPORT PointCloudStreamer {
+    public:
+        /**
+         * @brief Constructor
+         * @param octree        Octree to stream the points from
+         * @param importer      Importer for the node data
+         * @param capacity      Count of points the vertex buffer can hold
+         * @param usage         Buffer usage
+         *
+         * Allocates storage of the vertex buffer. The vertex layout of
+         * @ref mesh() has to be specified by the application. Expects that
+         * @p capacity is not zero.
+         * @see @ref Buffer::setData()
+         */
+        explicit PointCloudStreamer(const Trade::PointCloudOctree& octree, Trade::AbstractImporter& importer, UnsignedInt capacity, BufferUsage usage = BufferUsage::StaticDraw);
+
+        /** @brief Copying is not allowed */
+        PointCloudStreamer(const PointCloudStreamer&) = delete;
+
+        /** @brief Moving is not allowed */
+        PointCloudStreamer(PointCloudStreamer&&) = delete;
+
+        /** @brief Copying is not allowed */
+        PointCloudStreamer& operator=(const PointCloudStreamer&) = delete;
+
+        /** @brief Moving is not allowed */
+        PointCloudStreamer& operator=(PointCloudStreamer&&) = delete;
+
+        /** @brief Streamed octree */
+        const Trade::PointCloudOctree& octree() const { return _octree; }
+
+        /** @brief Vertex buffer */
+        Buffer& vertexBuffer() { return _vertexBuffer; }
+
+        /** @brief Shared mesh */
+        Mesh& mesh() { return _mesh; }
+
+        /** @brief Vertex range allocator */
+        const RangeAllocator& allocator() const { return _allocator; }
+
+        /** @brief Per-frame point budget */
+        UnsignedInt pointBudget() const { return _pointBudget; }
+
+        /**
+         * @brief Set per-frame point budget
+         * @return Reference to self (for method chaining)
+         *
+         * Maximal count of points drawn in one frame. Default is `1000000`.
+         * See @ref PointCloudStreamer-streaming-strategy "class documentation"
+         * for more information.
+         */
+        PointCloudStreamer& setPointBudget(UnsignedInt budget) {
+            _pointBudget = budget;
+            return *this;
+        }
+
+        /** @brief Error threshold */
+        Float errorThreshold() const { return _errorThreshold; }
+
+        /**
+         * @brief Set error threshold
+         * @return Reference to self (for method chaining)
+         *
+         * Children of a node are considered for drawing only if point spacing
+         * of the node projected to the screen is larger than given amount of
+         * pixels. Default is `1.0f`. See
+         * @ref PointCloudStreamer-streaming-strategy "class documentation"
+         * for more information.
+         */
+        PointCloudStreamer& setErrorThreshold(Float threshold) {
+            _errorThreshold = threshold;
+            return *this;
+        }
+
+        /** @brief Upload limit */
+        std::size_t uploadLimit() const { return _uploadLimit; }
+
+        /**
+         * @brief Set upload limit
+         * @return Reference to self (for method chaining)
+         *
+         * Size of node data in bytes after which no more nodes are loaded in
+         * one @ref update(). At least one node is always loaded. Default is
+         * 4 MB. See @ref PointCloudStreamer-streaming-strategy "class documentation"
+         * for more information.
+         */
+        PointCloudStreamer& setUploadLimit(std::size_t limit) {
+            _uploadLimit = limit;
+            return *this;
+        }
+
+        /**
+         * @brief Screen-space error of a node
+         * @param id                Node ID
+         * @param cameraPosition    Camera position in the octree space
+         * @param projection        Projection matrix
+         * @param viewportSize      Viewport size in pixels
+         *
+         * Point spacing of the node projected to the screen, in pixels. For
+         * perspective projection the spacing is projected at the point of
+         * the node bounding sphere nearest to the camera and if the camera is
+         * inside the sphere, the error is infinite. For orthographic
+         * projection the distance is not taken into account.
+         * @see @ref Trade::PointCloudOctree::nodeSpacing()
+         */
+        Float nodeError(UnsignedInt id, const Vector3& cameraPosition, const Matrix4& projection, const Vector2i& viewportSize) const;
+
+        /**
+         * @brief Update the drawn node set
+         * @param transformation    Transformation of the octree relative to
+         *      the camera
+         * @param projection        Projection matrix
+         * @param viewportSize      Viewport size in pixels
+         *
+         * Selects nodes for drawing, loads the ones that are not resident and
+         * evicts unused nodes if needed. See
+         * @ref PointCloudStreamer-streaming-strategy "class documentation"
+         * for more information.
+         * @see @ref Frustum::fromMatrix(),
+         *      @ref Math::Geometry::Intersection::aabbFrustum(),
+         *      @ref Buffer::setSubData()
+         */
+        void update(const Matrix4& transformation, const Matrix4& projection, const Vector2i& viewportSize);
+
+        /**
+         * @brief Draw the selected nodes
+         *
+         * Draws all resident nodes selected in the last @ref update(). Does
+         * nothing if no node is selected.
+         * @see @ref MeshView::draw(AbstractShaderProgram&, Containers::ArrayView<const std::reference_wrapper<MeshView>>)
+         */
+        void draw(AbstractShaderProgram& shader);
+
+        /** @overload */
+        void draw(AbstractShaderProgram&& shader) {
+            draw(shader);
+        }
+
+        /** @brief Whether given node is resident */
+        bool isResident(UnsignedInt id) const;
+
+        /**
+         * @brief Whether loading of given node failed
+         *
+         * See @ref PointCloudStreamer-streaming-strategy "class documentation"
+         * for more information.
+         */
+        bool isFailed(UnsignedInt id) const;
+
+        /** @brief Count of resident nodes */
+        UnsignedInt residentNodeCount() const { return _residentNodeCount; }
+
+        /** @brief Count of points in resident nodes */
+        UnsignedInt residentPointCount() const { return _allocator.usedCount(); }
+
+        /**
+         * @brief Count of nodes selected in the last update
+         *
+         * Includes also the nodes that failed to load in the update.
+         */
+        UnsignedInt selectedNodeCount() const { return _selectedNodeCount; }
+
+        /** @brief Count of nodes drawn by @ref draw() */
+        UnsignedInt drawnNodeCount() const { return _views.size(); }
+
+        /** @brief Count of points drawn by @ref draw() */
+        UnsignedInt drawnPointCount() const { return _drawnPointCount; }
+
+        /** @brief Count of nodes loaded in the last update */
+        UnsignedInt uploadCount() const { return _uploadCount; }
+
+        /** @brief Count of nodes evicted in the last update */
+        UnsignedInt evictionCount() const { return _evictionCount; }
+
+    private:
+        enum class NodeState: UnsignedByte {
+            NotLoaded, Resident, Failed
+        };
+
+        struct Node {
+            NodeState state;
+            UnsignedInt offset;
+            UnsignedLong lastUsed;
+        };
+
+        bool load(UnsignedInt id);
+        bool allocate(UnsignedInt id);
+        void evict(UnsignedInt id);
+
+        const Trade::PointCloudOctree& _octree;
+        Trade::AbstractImporter& _importer;
+        RangeAllocator _allocator;
+        Buffer _vertexBuffer;
+        Mesh _mesh;
+
+        UnsignedInt _pointBudget{1000000};
+        Float _errorThreshold{1.0f};
+        std::size_t _uploadLimit{4*1024*1024};
+
+        std::vector<Node> _nodes;
+        std::vector<MeshView> _views;
+
+        /* Scratch storage kept across updates so it doesn't get allocated
+           every frame */
+        std::vector<std::pair<Float, UnsignedInt>> _queue;
+        std::vector<std::pair<UnsignedLong, UnsignedInt>> _evictionCandidates;
+        std::vector<UnsignedInt> _drawn;
+        std::vector<std::reference_wrapper<MeshView>> _viewReferences;
+
+        UnsignedLong _frame{};
+        UnsignedInt _residentNodeCount{}, _selectedNodeCount{},
+            _drawnPointCount{}, _uploadCount{}, _evictionCount{};
+        std::size_t _uploadedSize{};
+};
+
+}
+
+#endif
@@ -59,7 +59,8 @@ if(!q.resultAvailable()) {
 // ...or block until the result is available
 UnsignedInt primitiveCount = q.result<UnsignedInt>();
 @endcode
-@see @ref SampleQuery, @ref TimeQuery, @ref TransformFeedback
+@see @ref SampleQuery, @ref TimeQuery, @ref QueryPool,
+    @ref TransformFeedback
 @requires_gl30 Extension @extension{EXT,transform_feedback}
 @requires_gles30 Only sample queries are available in OpenGL ES 2.0.
 @requires_webgl20 Queries are not available in WebGL 1.0.
@@ -90,13 +90,9 @@ Trade::MeshData2D Capsule2D::wireframe(UnsignedInt hemisphereRings, UnsignedInt
     return Trade::MeshData2D(MeshPrimitive::Lines, std::move(indices), {std::move(positions)}, {});
 }
 
-Trade::MeshData3D Capsule3D::solid(UnsignedInt hemisphereRings, UnsignedInt cylinderRings, UnsignedInt segments, Float halfLength, TextureCoords textureCoords) {
-    CORRADE_ASSERT(hemisphereRings >= 1 && cylinderRings >= 1 && segments >= 3, "Capsule must have at least one hemisphere ring, one cylinder ring and three segments", Trade::MeshData3D(MeshPrimitive::Triangles, {}, {}, {}, {}));
-
-    Implementation::Spheroid capsule(segments, textureCoords == TextureCoords::Generate ?
-        Implementation::Spheroid::TextureCoords::Generate :
-        Implementation::Spheroid::TextureCoords::DontGenerate);
+namespace {
 
+void solidInto(Implementation::Spheroid& capsule, const UnsignedInt hemisphereRings, const UnsignedInt cylinderRings, const Float halfLength) {
     Float height = 2.0f+2.0f*halfLength;
     Float hemisphereTextureCoordsVIncrement = 1.0f/(hemisphereRings*height);
     Rad hemisphereRingAngleIncrement(Constants::piHalf()/hemisphereRings);
@@ -120,10 +116,43 @@ Trade::MeshData3D Capsule3D::solid(UnsignedInt hemisphereRings, UnsignedInt cyli
     capsule.bottomFaceRing();
     capsule.faceRings(hemisphereRings*2-2+cylinderRings);
     capsule.topFaceRing();
+}
+
+Implementation::Spheroid::TextureCoords spheroidTextureCoords(const Capsule3D::TextureCoords textureCoords) {
+    return textureCoords == Capsule3D::TextureCoords::Generate ?
+        Implementation::Spheroid::TextureCoords::Generate :
+        Implementation::Spheroid::TextureCoords::DontGenerate;
+}
+
+}
 
+Trade::MeshData3D Capsule3D::solid(UnsignedInt hemisphereRings, UnsignedInt cylinderRings, UnsignedInt segments, Float halfLength, TextureCoords textureCoords) {
+    CORRADE_ASSERT(hemisphereRings >= 1 && cylinderRings >= 1 && segments >= 3, "Capsule must have at least one hemisphere ring, one cylinder ring and three segments", Trade::MeshData3D(MeshPrimitive::Triangles, {}, {}, {}, {}));
+
+    Implementation::Spheroid capsule(segments, spheroidTextureCoords(textureCoords));
+    solidInto(capsule, hemisphereRings, cylinderRings, halfLength);
     return capsule.finalize();
 }
 
+std::pair<UnsignedInt, UnsignedInt> Capsule3D::solidCount(const UnsignedInt hemisphereRings, const UnsignedInt cylinderRings, const UnsignedInt segments, const TextureCoords textureCoords) {
+    const UnsignedInt ringVertexCount = Implementation::Spheroid::ringVertexCount(segments, spheroidTextureCoords(textureCoords));
+    return {2 + (hemisphereRings*2-1+cylinderRings)*ringVertexCount,
+            6*segments*(hemisphereRings*2-1+cylinderRings)};
+}
+
+void Capsule3D::solidInterleaved(const Containers::ArrayView<SolidVertex> vertices, const Containers::ArrayView<UnsignedShort> indices, const UnsignedInt hemisphereRings, const UnsignedInt cylinderRings, const UnsignedInt segments, const Float halfLength, const TextureCoords textureCoords) {
+    CORRADE_ASSERT(hemisphereRings >= 1 && cylinderRings >= 1 && segments >= 3, "Capsule must have at least one hemisphere ring, one cylinder ring and three segments", );
+
+    const std::pair<UnsignedInt, UnsignedInt> count = solidCount(hemisphereRings, cylinderRings, segments, textureCoords);
+    CORRADE_ASSERT(count.first <= 65536,
+        "Primitives::Capsule3D::solidInterleaved():" << count.first << "vertices don't fit into 16-bit indices", );
+    CORRADE_ASSERT(vertices.size() == count.first && indices.size() == count.second,
+        "Primitives::Capsule3D::solidInterleaved(): expected" << count.first << "vertices and" << count.second << "indices but got" << vertices.size() << "and" << indices.size(), );
+
+    Implementation::Spheroid capsule(segments, spheroidTextureCoords(textureCoords), vertices, indices);
+    solidInto(capsule, hemisphereRings, cylinderRings, halfLength);
+}
+
 Trade::MeshData3D Capsule3D::wireframe(const UnsignedInt hemisphereRings, const UnsignedInt cylinderRings, const UnsignedInt segments, const Float halfLength) {
     CORRADE_ASSERT(hemisphereRings >= 1 && cylinderRings >= 1 && segments >= 4 && segments%4 == 0, "Primitives::Capsule::wireframe(): improper parameters", Trade::MeshData3D(MeshPrimitive::Lines, {}, {}, {}, {}));
 
@@ -29,6 +29,10 @@
  * @brief Class @ref Magnum::Primitives::Capsule2D, @ref Magnum::Primitives::Capsule3D
  */
 
+#include <utility>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Primitives/SolidVertex.h"
 #include "Magnum/Primitives/visibility.h"
 #include "Magnum/Trade/Trade.h"
 
@@ -84,6 +88,43 @@ class MAGNUM_PRIMITIVES_EXPORT Capsule3D {
          */
         static Trade::MeshData3D solid(UnsignedInt hemisphereRings, UnsignedInt cylinderRings, UnsignedInt segments, Float halfLength, TextureCoords textureCoords = TextureCoords::DontGenerate);
 
+        /**
+         * @brief Vertex and index count of solid capsule
+         *
+         * Returns vertex and index count of a capsule generated with
+         * @ref solid() or @ref solidInterleaved() with the same parameters,
+         * without generating anything.
+         */
+        static std::pair<UnsignedInt, UnsignedInt> solidCount(UnsignedInt hemisphereRings, UnsignedInt cylinderRings, UnsignedInt segments, TextureCoords textureCoords = TextureCoords::DontGenerate);
+
+        /**
+         * @brief Solid capsule into interleaved memory
+         * @param vertices      Vertex output
+         * @param indices       Index output
+         *
+         * Same as @ref solid(), but writes the vertices and indices directly
+         * to caller-provided memory, such as a mapped buffer, without any
+         * intermediate allocation. The views are expected to have exactly the
+         * size returned by @ref solidCount() and the vertex count is expected
+         * to fit into 16-bit indices. Example usage:
+         * @code
+         * UnsignedInt vertexCount, indexCount;
+         * std::tie(vertexCount, indexCount) = Primitives::Capsule3D::solidCount(4, 1, 16);
+         *
+         * Buffer vertices, indices;
+         * vertices.setData({nullptr, vertexCount*sizeof(Primitives::SolidVertex)}, BufferUsage::StaticDraw);
+         * indices.setData({nullptr, indexCount*sizeof(UnsignedShort)}, BufferUsage::StaticDraw);
+         * Primitives::Capsule3D::solidInterleaved(
+         *     {vertices.map<Primitives::SolidVertex>(0, vertexCount*sizeof(Primitives::SolidVertex), Buffer::MapFlag::Write|Buffer::MapFlag::InvalidateBuffer), vertexCount},
+         *     {indices.map<UnsignedShort>(0, indexCount*sizeof(UnsignedShort), Buffer::MapFlag::Write|Buffer::MapFlag::InvalidateBuffer), indexCount},
+         *     4, 1, 16, 0.75f);
+         * CORRADE_INTERNAL_ASSERT_OUTPUT(vertices.unmap());
+         * CORRADE_INTERNAL_ASSERT_OUTPUT(indices.unmap());
+         * @endcode
+         * @see @ref SolidVertex
+         */
+        static void solidInterleaved(Containers::ArrayView<SolidVertex> vertices, Containers::ArrayView<UnsignedShort> indices, UnsignedInt hemisphereRings, UnsignedInt cylinderRings, UnsignedInt segments, Float halfLength, TextureCoords textureCoords = TextureCoords::DontGenerate);
+
         /**
          * @brief Wireframe capsule
          * @param hemisphereRings Number of (line) rings for each hemisphere.
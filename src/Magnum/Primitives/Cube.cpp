@@ -25,81 +25,114 @@
 
 #include "Cube.h"
 
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
 #include "Magnum/Mesh.h"
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/Trade/MeshData3D.h"
 
 namespace Magnum { namespace Primitives {
 
-Trade::MeshData3D Cube::solid() {
-    return Trade::MeshData3D(MeshPrimitive::Triangles, {
-         0,  1,  2,  0,  2,  3, /* +Z */
-         4,  5,  6,  4,  6,  7, /* +X */
-         8,  9, 10,  8, 10, 11, /* +Y */
-        12, 13, 14, 12, 14, 15, /* -Z */
-        16, 17, 18, 16, 18, 19, /* -Y */
-        20, 21, 22, 20, 22, 23  /* -X */
-    }, {{
-        {-1.0f, -1.0f,  1.0f},
-        { 1.0f, -1.0f,  1.0f},
-        { 1.0f,  1.0f,  1.0f}, /* +Z */
-        {-1.0f,  1.0f,  1.0f},
+namespace {
+
+constexpr UnsignedShort SolidIndices[]{
+     0,  1,  2,  0,  2,  3, /* +Z */
+     4,  5,  6,  4,  6,  7, /* +X */
+     8,  9, 10,  8, 10, 11, /* +Y */
+    12, 13, 14, 12, 14, 15, /* -Z */
+    16, 17, 18, 16, 18, 19, /* -Y */
+    20, 21, 22, 20, 22, 23  /* -X */
+};
+
+constexpr Vector3 SolidPositions[]{
+    {-1.0f, -1.0f,  1.0f},
+    { 1.0f, -1.0f,  1.0f},
+    { 1.0f,  1.0f,  1.0f}, /* +Z */
+    {-1.0f,  1.0f,  1.0f},
+
+    { 1.0f, -1.0f,  1.0f},
+    { 1.0f, -1.0f, -1.0f},
+    { 1.0f,  1.0f, -1.0f}, /* +X */
+    { 1.0f,  1.0f,  1.0f},
+
+    {-1.0f,  1.0f,  1.0f},
+    { 1.0f,  1.0f,  1.0f},
+    { 1.0f,  1.0f, -1.0f}, /* +Y */
+    {-1.0f,  1.0f, -1.0f},
+
+    { 1.0f, -1.0f, -1.0f},
+    {-1.0f, -1.0f, -1.0f},
+    {-1.0f,  1.0f, -1.0f}, /* -Z */
+    { 1.0f,  1.0f, -1.0f},
+
+    {-1.0f, -1.0f, -1.0f},
+    { 1.0f, -1.0f, -1.0f},
+    { 1.0f, -1.0f,  1.0f}, /* -Y */
+    {-1.0f, -1.0f,  1.0f},
+
+    {-1.0f, -1.0f, -1.0f},
+    {-1.0f, -1.0f,  1.0f},
+    {-1.0f,  1.0f,  1.0f}, /* -X */
+    {-1.0f,  1.0f, -1.0f}
+};
+
+constexpr std::size_t SolidIndexCount = std::extent<decltype(SolidIndices)>::value;
+constexpr std::size_t SolidVertexCount = std::extent<decltype(SolidPositions)>::value;
+
+constexpr Vector3 SolidNormals[]{
+    { 0.0f,  0.0f,  1.0f},
+    { 0.0f,  0.0f,  1.0f},
+    { 0.0f,  0.0f,  1.0f}, /* +Z */
+    { 0.0f,  0.0f,  1.0f},
+
+    { 1.0f,  0.0f,  0.0f},
+    { 1.0f,  0.0f,  0.0f},
+    { 1.0f,  0.0f,  0.0f}, /* +X */
+    { 1.0f,  0.0f,  0.0f},
+
+    { 0.0f,  1.0f,  0.0f},
+    { 0.0f,  1.0f,  0.0f},
+    { 0.0f,  1.0f,  0.0f}, /* +Y */
+    { 0.0f,  1.0f,  0.0f},
+
+    { 0.0f,  0.0f, -1.0f},
+    { 0.0f,  0.0f, -1.0f},
+    { 0.0f,  0.0f, -1.0f}, /* -Z */
+    { 0.0f,  0.0f, -1.0f},
+
+    { 0.0f, -1.0f,  0.0f},
+    { 0.0f, -1.0f,  0.0f},
+    { 0.0f, -1.0f,  0.0f}, /* -Y */
+    { 0.0f, -1.0f,  0.0f},
+
+    {-1.0f,  0.0f,  0.0f},
+    {-1.0f,  0.0f,  0.0f},
+    {-1.0f,  0.0f,  0.0f}, /* -X */
+    {-1.0f,  0.0f,  0.0f}
+};
 
-        { 1.0f, -1.0f,  1.0f},
-        { 1.0f, -1.0f, -1.0f},
-        { 1.0f,  1.0f, -1.0f}, /* +X */
-        { 1.0f,  1.0f,  1.0f},
+}
 
-        {-1.0f,  1.0f,  1.0f},
-        { 1.0f,  1.0f,  1.0f},
-        { 1.0f,  1.0f, -1.0f}, /* +Y */
-        {-1.0f,  1.0f, -1.0f},
+Trade::MeshData3D Cube::solid() {
+    return Trade::MeshData3D(MeshPrimitive::Triangles,
+        {std::begin(SolidIndices), std::end(SolidIndices)},
+        {{std::begin(SolidPositions), std::end(SolidPositions)}},
+        {{std::begin(SolidNormals), std::end(SolidNormals)}}, {});
+}
 
-        { 1.0f, -1.0f, -1.0f},
-        {-1.0f, -1.0f, -1.0f},
-        {-1.0f,  1.0f, -1.0f}, /* -Z */
-        { 1.0f,  1.0f, -1.0f},
+std::pair<UnsignedInt, UnsignedInt> Cube::solidCount() {
+    return {SolidVertexCount, SolidIndexCount};
+}
 
-        {-1.0f, -1.0f, -1.0f},
-        { 1.0f, -1.0f, -1.0f},
-        { 1.0f, -1.0f,  1.0f}, /* -Y */
-        {-1.0f, -1.0f,  1.0f},
+void Cube::solidInterleaved(const Containers::ArrayView<SolidVertex> vertices, const Containers::ArrayView<UnsignedShort> indices) {
+    CORRADE_ASSERT(vertices.size() == SolidVertexCount && indices.size() == SolidIndexCount,
+        "Primitives::Cube::solidInterleaved(): expected" << SolidVertexCount << "vertices and" << SolidIndexCount << "indices but got" << vertices.size() << "and" << indices.size(), );
 
-        {-1.0f, -1.0f, -1.0f},
-        {-1.0f, -1.0f,  1.0f},
-        {-1.0f,  1.0f,  1.0f}, /* -X */
-        {-1.0f,  1.0f, -1.0f}
-    }}, {{
-        { 0.0f,  0.0f,  1.0f},
-        { 0.0f,  0.0f,  1.0f},
-        { 0.0f,  0.0f,  1.0f}, /* +Z */
-        { 0.0f,  0.0f,  1.0f},
-
-        { 1.0f,  0.0f,  0.0f},
-        { 1.0f,  0.0f,  0.0f},
-        { 1.0f,  0.0f,  0.0f}, /* +X */
-        { 1.0f,  0.0f,  0.0f},
-
-        { 0.0f,  1.0f,  0.0f},
-        { 0.0f,  1.0f,  0.0f},
-        { 0.0f,  1.0f,  0.0f}, /* +Y */
-        { 0.0f,  1.0f,  0.0f},
-
-        { 0.0f,  0.0f, -1.0f},
-        { 0.0f,  0.0f, -1.0f},
-        { 0.0f,  0.0f, -1.0f}, /* -Z */
-        { 0.0f,  0.0f, -1.0f},
-
-        { 0.0f, -1.0f,  0.0f},
-        { 0.0f, -1.0f,  0.0f},
-        { 0.0f, -1.0f,  0.0f}, /* -Y */
-        { 0.0f, -1.0f,  0.0f},
-
-        {-1.0f,  0.0f,  0.0f},
-        {-1.0f,  0.0f,  0.0f},
-        {-1.0f,  0.0f,  0.0f}, /* -X */
-        {-1.0f,  0.0f,  0.0f}
-    }}, {});
+    for(std::size_t i = 0; i != vertices.size(); ++i)
+        vertices[i] = {SolidPositions[i], SolidNormals[i], {}};
+    std::copy(std::begin(SolidIndices), std::end(SolidIndices), indices.begin());
 }
 
 Trade::MeshData3D Cube::solidStrip() {
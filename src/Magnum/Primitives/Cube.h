@@ -29,6 +29,10 @@
  * @brief Class @ref Magnum::Primitives::Cube
  */
 
+#include <utility>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Primitives/SolidVertex.h"
 #include "Magnum/Primitives/visibility.h"
 #include "Magnum/Trade/Trade.h"
 
@@ -48,6 +52,27 @@ class MAGNUM_PRIMITIVES_EXPORT Cube {
          */
         static Trade::MeshData3D solid();
 
+        /**
+         * @brief Vertex and index count of solid cube
+         *
+         * Returns vertex and index count of the cube generated with
+         * @ref solid() or @ref solidInterleaved().
+         */
+        static std::pair<UnsignedInt, UnsignedInt> solidCount();
+
+        /**
+         * @brief Solid cube into interleaved memory
+         * @param vertices      Vertex output
+         * @param indices       Index output
+         *
+         * Same as @ref solid(), but writes the vertices and indices directly
+         * to caller-provided memory. The views are expected to have exactly
+         * the size returned by @ref solidCount(). Texture coordinates are
+         * zero. See @ref Capsule3D::solidInterleaved() for an example.
+         * @see @ref SolidVertex
+         */
+        static void solidInterleaved(Containers::ArrayView<SolidVertex> vertices, Containers::ArrayView<UnsignedShort> indices);
+
         /**
          * @brief Solid cube as a single strip
          *
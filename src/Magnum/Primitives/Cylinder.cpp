@@ -33,37 +33,69 @@
 
 namespace Magnum { namespace Primitives {
 
-Trade::MeshData3D Cylinder::solid(const UnsignedInt rings, const UnsignedInt segments, const Float halfLength, const Flags flags) {
-    CORRADE_ASSERT(rings >= 1 && segments >= 3, "Primitives::Cylinder::solid(): cylinder must have at least one ring and three segments", Trade::MeshData3D(MeshPrimitive::Triangles, {}, {}, {}, {}));
-
-    Implementation::Spheroid cylinder(segments, flags & Flag::GenerateTextureCoords ? Implementation::Spheroid::TextureCoords::Generate : Implementation::Spheroid::TextureCoords::DontGenerate);
+namespace {
 
+void solidInto(Implementation::Spheroid& cylinder, const UnsignedInt rings, const Float halfLength, const Cylinder::Flags flags) {
     const Float length = 2.0f*halfLength;
-    const Float textureCoordsV = flags & Flag::CapEnds ? 1.0f/(length+2.0f) : 0.0f;
+    const Float textureCoordsV = flags & Cylinder::Flag::CapEnds ? 1.0f/(length+2.0f) : 0.0f;
 
     /* Bottom cap */
-    if(flags & Flag::CapEnds) {
+    if(flags & Cylinder::Flag::CapEnds) {
         cylinder.capVertex(-halfLength, -1.0f, 0.0f);
         cylinder.capVertexRing(-halfLength, textureCoordsV, Vector3::yAxis(-1.0f));
     }
 
     /* Vertex rings */
-    cylinder.cylinderVertexRings(rings+1, -halfLength, length/rings, textureCoordsV, length/(rings*(flags & Flag::CapEnds ? length + 2.0f : length)));
+    cylinder.cylinderVertexRings(rings+1, -halfLength, length/rings, textureCoordsV, length/(rings*(flags & Cylinder::Flag::CapEnds ? length + 2.0f : length)));
 
     /* Top cap */
-    if(flags & Flag::CapEnds) {
+    if(flags & Cylinder::Flag::CapEnds) {
         cylinder.capVertexRing(halfLength, 1.0f - textureCoordsV, Vector3::yAxis(1.0f));
         cylinder.capVertex(halfLength, 1.0f, 1.0f);
     }
 
     /* Faces */
-    if(flags & Flag::CapEnds) cylinder.bottomFaceRing();
-    cylinder.faceRings(rings, flags & Flag::CapEnds ? 1 : 0);
-    if(flags & Flag::CapEnds) cylinder.topFaceRing();
+    if(flags & Cylinder::Flag::CapEnds) cylinder.bottomFaceRing();
+    cylinder.faceRings(rings, flags & Cylinder::Flag::CapEnds ? 1 : 0);
+    if(flags & Cylinder::Flag::CapEnds) cylinder.topFaceRing();
+}
 
+Implementation::Spheroid::TextureCoords spheroidTextureCoords(const Cylinder::Flags flags) {
+    return flags & Cylinder::Flag::GenerateTextureCoords ?
+        Implementation::Spheroid::TextureCoords::Generate :
+        Implementation::Spheroid::TextureCoords::DontGenerate;
+}
+
+}
+
+Trade::MeshData3D Cylinder::solid(const UnsignedInt rings, const UnsignedInt segments, const Float halfLength, const Flags flags) {
+    CORRADE_ASSERT(rings >= 1 && segments >= 3, "Primitives::Cylinder::solid(): cylinder must have at least one ring and three segments", Trade::MeshData3D(MeshPrimitive::Triangles, {}, {}, {}, {}));
+
+    Implementation::Spheroid cylinder(segments, spheroidTextureCoords(flags));
+    solidInto(cylinder, rings, halfLength, flags);
     return cylinder.finalize();
 }
 
+std::pair<UnsignedInt, UnsignedInt> Cylinder::solidCount(const UnsignedInt rings, const UnsignedInt segments, const Flags flags) {
+    const UnsignedInt ringVertexCount = Implementation::Spheroid::ringVertexCount(segments, spheroidTextureCoords(flags));
+    const bool capEnds = !!(flags & Flag::CapEnds);
+    return {(rings+1)*ringVertexCount + (capEnds ? 2 + 2*ringVertexCount : 0),
+            6*segments*rings + (capEnds ? 6*segments : 0)};
+}
+
+void Cylinder::solidInterleaved(const Containers::ArrayView<SolidVertex> vertices, const Containers::ArrayView<UnsignedShort> indices, const UnsignedInt rings, const UnsignedInt segments, const Float halfLength, const Flags flags) {
+    CORRADE_ASSERT(rings >= 1 && segments >= 3, "Primitives::Cylinder::solidInterleaved(): cylinder must have at least one ring and three segments", );
+
+    const std::pair<UnsignedInt, UnsignedInt> count = solidCount(rings, segments, flags);
+    CORRADE_ASSERT(count.first <= 65536,
+        "Primitives::Cylinder::solidInterleaved():" << count.first << "vertices don't fit into 16-bit indices", );
+    CORRADE_ASSERT(vertices.size() == count.first && indices.size() == count.second,
+        "Primitives::Cylinder::solidInterleaved(): expected" << count.first << "vertices and" << count.second << "indices but got" << vertices.size() << "and" << indices.size(), );
+
+    Implementation::Spheroid cylinder(segments, spheroidTextureCoords(flags), vertices, indices);
+    solidInto(cylinder, rings, halfLength, flags);
+}
+
 Trade::MeshData3D Cylinder::wireframe(const UnsignedInt rings, const UnsignedInt segments, const Float halfLength) {
     CORRADE_ASSERT(rings >= 1 && segments >= 4 && segments%4 == 0, "Primitives::Cylinder::wireframe(): improper parameters", Trade::MeshData3D(MeshPrimitive::Lines, {}, {}, {}, {}));
 
@@ -29,9 +29,12 @@
  * @brief Class @ref Magnum::Primitives::Cylinder
  */
 
+#include <utility>
+#include <Corrade/Containers/ArrayView.h>
 #include <Corrade/Containers/EnumSet.h>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/Primitives/SolidVertex.h"
 #include "Magnum/Primitives/visibility.h"
 #include "Magnum/Trade/Trade.h"
 
@@ -77,6 +80,29 @@ class MAGNUM_PRIMITIVES_EXPORT Cylinder {
          */
         static Trade::MeshData3D solid(UnsignedInt rings, UnsignedInt segments, Float halfLength, Flags flags = Flags());
 
+        /**
+         * @brief Vertex and index count of solid cylinder
+         *
+         * Returns vertex and index count of a cylinder generated with
+         * @ref solid() or @ref solidInterleaved() with the same parameters,
+         * without generating anything.
+         */
+        static std::pair<UnsignedInt, UnsignedInt> solidCount(UnsignedInt rings, UnsignedInt segments, Flags flags = Flags());
+
+        /**
+         * @brief Solid cylinder into interleaved memory
+         * @param vertices      Vertex output
+         * @param indices       Index output
+         *
+         * Same as @ref solid(), but writes the vertices and indices directly
+         * to caller-provided memory. The views are expected to have exactly
+         * the size returned by @ref solidCount() and the vertex count is
+         * expected to fit into 16-bit indices. See
+         * @ref Capsule3D::solidInterleaved() for an example.
+         * @see @ref SolidVertex
+         */
+        static void solidInterleaved(Containers::ArrayView<SolidVertex> vertices, Containers::ArrayView<UnsignedShort> indices, UnsignedInt rings, UnsignedInt segments, Float halfLength, Flags flags = Flags());
+
         /**
          * @brief Wireframe cylinder
          * @param rings         Number of (line) rings. Must be larger or equal
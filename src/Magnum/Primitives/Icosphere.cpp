@@ -25,11 +25,10 @@
 
 #include "Icosphere.h"
 
+#include <unordered_map>
+
 #include "Magnum/Mesh.h"
 #include "Magnum/Math/Vector3.h"
-#include "Magnum/MeshTools/Duplicate.h"
-#include "Magnum/MeshTools/RemoveDuplicates.h"
-#include "Magnum/MeshTools/Subdivide.h"
 #include "Magnum/Trade/MeshData3D.h"
 
 namespace Magnum { namespace Primitives {
@@ -73,12 +72,39 @@ Trade::MeshData3D Icosphere::solid(const UnsignedInt subdivisions) {
         {0.0f, 0.525731f, 0.850651f}
     };
 
-    for(std::size_t i = 0; i != subdivisions; ++i)
-        MeshTools::subdivide(indices, positions, [](const Vector3& a, const Vector3& b) {
-            return (a+b).normalized();
-        });
+    /* Each level quadruples the face count and adds one vertex per edge, the
+       final counts are known upfront */
+    std::size_t faceCount = 20;
+    for(std::size_t i = 0; i != subdivisions; ++i) faceCount *= 4;
+    indices.reserve(faceCount*3);
+    positions.reserve(faceCount/2 + 2);
+
+    /* Vertices on shared edges are created only once, so there's no need to
+       remove duplicates afterwards */
+    std::unordered_map<UnsignedLong, UnsignedInt> midpoints;
+    for(std::size_t i = 0; i != subdivisions; ++i) {
+        midpoints.clear();
+        midpoints.reserve(indices.size()/2);
+        const auto midpoint = [&midpoints, &positions](UnsignedInt a, UnsignedInt b) {
+            const UnsignedLong key = a < b ? (UnsignedLong(a) << 32)|b : (UnsignedLong(b) << 32)|a;
+            const auto found = midpoints.emplace(key, positions.size());
+            if(found.second) positions.push_back((positions[a] + positions[b]).normalized());
+            return found.first->second;
+        };
 
-    indices = MeshTools::duplicate(indices, MeshTools::removeDuplicates(positions));
+        std::vector<UnsignedInt> subdivided;
+        subdivided.reserve(indices.size()*4);
+        for(std::size_t j = 0; j != indices.size(); j += 3) {
+            const UnsignedInt a = indices[j], b = indices[j + 1], c = indices[j + 2];
+            const UnsignedInt ab = midpoint(a, b), bc = midpoint(b, c), ca = midpoint(c, a);
+            subdivided.insert(subdivided.end(), {
+                a, ab, ca,
+                ab, b, bc,
+                ca, bc, c,
+                ab, bc, ca});
+        }
+        indices = std::move(subdivided);
+    }
 
     std::vector<Vector3> normals(positions);
     return Trade::MeshData3D(MeshPrimitive::Triangles, std::move(indices), {std::move(positions)}, {std::move(normals)}, {});
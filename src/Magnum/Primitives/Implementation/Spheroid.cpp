@@ -32,14 +32,38 @@
 
 namespace Magnum { namespace Primitives { namespace Implementation {
 
-Spheroid::Spheroid(UnsignedInt segments, TextureCoords textureCoords): segments(segments), textureCoords(textureCoords) {}
+Spheroid::Spheroid(UnsignedInt segments, TextureCoords textureCoords): segments(segments), textureCoords(textureCoords), vertexCount(0), indexCount(0) {}
+
+Spheroid::Spheroid(UnsignedInt segments, TextureCoords textureCoords, Containers::ArrayView<SolidVertex> vertices, Containers::ArrayView<UnsignedShort> indices): segments(segments), textureCoords(textureCoords), vertexCount(0), indexCount(0), interleavedVertices(vertices), interleavedIndices(indices) {}
+
+void Spheroid::vertex(const Vector3& position, const Vector3& normal, const Vector2& textureCoords) {
+    if(interleavedVertices) {
+        CORRADE_INTERNAL_ASSERT(vertexCount < interleavedVertices.size());
+        SolidVertex& out = interleavedVertices[vertexCount];
+        out.position = position;
+        out.normal = normal;
+        out.textureCoordinates = this->textureCoords == TextureCoords::Generate ? textureCoords : Vector2{};
+    } else {
+        positions.push_back(position);
+        normals.push_back(normal);
+        if(this->textureCoords == TextureCoords::Generate)
+            textureCoords2D.push_back(textureCoords);
+    }
 
-void Spheroid::capVertex(Float y, Float normalY, Float textureCoordsV) {
-    positions.push_back({0.0f, y, 0.0f});
-    normals.push_back({0.0f, normalY, 0.0f});
+    ++vertexCount;
+}
 
-    if(textureCoords == TextureCoords::Generate)
-        textureCoords2D.push_back({0.5, textureCoordsV});
+void Spheroid::index(UnsignedInt index) {
+    if(interleavedIndices) {
+        CORRADE_INTERNAL_ASSERT(indexCount < interleavedIndices.size());
+        interleavedIndices[indexCount] = UnsignedShort(index);
+    } else indices.push_back(index);
+
+    ++indexCount;
+}
+
+void Spheroid::capVertex(Float y, Float normalY, Float textureCoordsV) {
+    vertex({0.0f, y, 0.0f}, {0.0f, normalY, 0.0f}, {0.5f, textureCoordsV});
 }
 
 void Spheroid::hemisphereVertexRings(UnsignedInt count, Float centerY, Rad startRingAngle, Rad ringAngleIncrement, Float startTextureCoordsV, Float textureCoordsVIncrement) {
@@ -52,19 +76,15 @@ void Spheroid::hemisphereVertexRings(UnsignedInt count, Float centerY, Rad start
 
         for(UnsignedInt j = 0; j != segments; ++j) {
             Rad segmentAngle = Float(j)*segmentAngleIncrement;
-            positions.push_back({x*Math::sin(segmentAngle), centerY+y, z*Math::cos(segmentAngle)});
-            normals.push_back({x*Math::sin(segmentAngle), y, z*Math::cos(segmentAngle)});
-
-            if(textureCoords == TextureCoords::Generate)
-                textureCoords2D.push_back({j*1.0f/segments, startTextureCoordsV + i*textureCoordsVIncrement});
+            vertex({x*Math::sin(segmentAngle), centerY+y, z*Math::cos(segmentAngle)},
+                   {x*Math::sin(segmentAngle), y, z*Math::cos(segmentAngle)},
+                   {j*1.0f/segments, startTextureCoordsV + i*textureCoordsVIncrement});
         }
 
         /* Duplicate first segment in the ring for additional vertex for texture coordinate */
-        if(textureCoords == TextureCoords::Generate) {
-            positions.push_back(positions[positions.size()-segments]);
-            normals.push_back(normals[normals.size()-segments]);
-            textureCoords2D.push_back({1.0f, startTextureCoordsV + i*textureCoordsVIncrement});
-        }
+        if(textureCoords == TextureCoords::Generate)
+            vertex({0.0f, centerY+y, z}, {0.0f, y, z},
+                   {1.0f, startTextureCoordsV + i*textureCoordsVIncrement});
     }
 }
 
@@ -73,19 +93,15 @@ void Spheroid::cylinderVertexRings(UnsignedInt count, Float startY, Float yIncre
     for(UnsignedInt i = 0; i != count; ++i) {
         for(UnsignedInt j = 0; j != segments; ++j) {
             Rad segmentAngle = Float(j)*segmentAngleIncrement;
-            positions.push_back({Math::sin(segmentAngle), startY, Math::cos(segmentAngle)});
-            normals.push_back({Math::sin(segmentAngle), 0.0f, Math::cos(segmentAngle)});
-
-            if(textureCoords == TextureCoords::Generate)
-                textureCoords2D.push_back({j*1.0f/segments, startTextureCoordsV + i*textureCoordsVIncrement});
+            vertex({Math::sin(segmentAngle), startY, Math::cos(segmentAngle)},
+                   {Math::sin(segmentAngle), 0.0f, Math::cos(segmentAngle)},
+                   {j*1.0f/segments, startTextureCoordsV + i*textureCoordsVIncrement});
         }
 
         /* Duplicate first segment in the ring for additional vertex for texture coordinate */
-        if(textureCoords == TextureCoords::Generate) {
-            positions.push_back(positions[positions.size()-segments]);
-            normals.push_back(normals[normals.size()-segments]);
-            textureCoords2D.push_back({1.0f, startTextureCoordsV + i*textureCoordsVIncrement});
-        }
+        if(textureCoords == TextureCoords::Generate)
+            vertex({0.0f, startY, 1.0f}, {0.0f, 0.0f, 1.0f},
+                   {1.0f, startTextureCoordsV + i*textureCoordsVIncrement});
 
         startY += yIncrement;
     }
@@ -94,19 +110,19 @@ void Spheroid::cylinderVertexRings(UnsignedInt count, Float startY, Float yIncre
 void Spheroid::bottomFaceRing() {
     for(UnsignedInt j = 0; j != segments; ++j) {
         /* Bottom vertex */
-        indices.push_back(0);
+        index(0);
 
         /* Top right vertex */
-        indices.push_back((j != segments-1 || textureCoords == TextureCoords::Generate) ?
+        index((j != segments-1 || textureCoords == TextureCoords::Generate) ?
             j+2 : 1);
 
         /* Top left vertex */
-        indices.push_back(j+1);
+        index(j+1);
     }
 }
 
 void Spheroid::faceRings(UnsignedInt count, UnsignedInt offset) {
-    UnsignedInt vertexSegments = segments + (textureCoords == TextureCoords::Generate ? 1 : 0);
+    UnsignedInt vertexSegments = ringVertexCount(segments, textureCoords);
 
     for(UnsignedInt i = 0; i != count; ++i) {
         for(UnsignedInt j = 0; j != segments; ++j) {
@@ -116,29 +132,29 @@ void Spheroid::faceRings(UnsignedInt count, UnsignedInt offset) {
             UnsignedInt topLeft = bottomLeft+vertexSegments;
             UnsignedInt topRight = bottomRight+vertexSegments;
 
-            indices.push_back(bottomLeft);
-            indices.push_back(bottomRight);
-            indices.push_back(topRight);
-            indices.push_back(bottomLeft);
-            indices.push_back(topRight);
-            indices.push_back(topLeft);
+            index(bottomLeft);
+            index(bottomRight);
+            index(topRight);
+            index(bottomLeft);
+            index(topRight);
+            index(topLeft);
         }
     }
 }
 
 void Spheroid::topFaceRing() {
-    UnsignedInt vertexSegments = segments + (textureCoords == TextureCoords::Generate ? 1 : 0);
+    UnsignedInt vertexSegments = ringVertexCount(segments, textureCoords);
 
     for(UnsignedInt j = 0; j != segments; ++j) {
         /* Bottom left vertex */
-        indices.push_back(normals.size()-vertexSegments+j-1);
+        index(vertexCount-vertexSegments+j-1);
 
         /* Bottom right vertex */
-        indices.push_back((j != segments-1 || textureCoords == TextureCoords::Generate) ?
-            normals.size()-vertexSegments+j : normals.size()-segments-1);
+        index((j != segments-1 || textureCoords == TextureCoords::Generate) ?
+            vertexCount-vertexSegments+j : vertexCount-segments-1);
 
         /* Top vertex */
-        indices.push_back(normals.size()-1);
+        index(vertexCount-1);
     }
 }
 
@@ -147,19 +163,13 @@ void Spheroid::capVertexRing(Float y, Float textureCoordsV, const Vector3& norma
 
     for(UnsignedInt i = 0; i != segments; ++i) {
         Rad segmentAngle = Float(i)*segmentAngleIncrement;
-        positions.push_back({Math::sin(segmentAngle), y, Math::cos(segmentAngle)});
-        normals.push_back(normal);
-
-        if(textureCoords == TextureCoords::Generate)
-            textureCoords2D.push_back({i*1.0f/segments, textureCoordsV});
+        vertex({Math::sin(segmentAngle), y, Math::cos(segmentAngle)}, normal,
+               {i*1.0f/segments, textureCoordsV});
     }
 
     /* Duplicate first segment in the ring for additional vertex for texture coordinate */
-    if(textureCoords == TextureCoords::Generate) {
-        positions.push_back(positions[positions.size()-segments]);
-        normals.push_back(normal);
-        textureCoords2D.push_back({1.0f, textureCoordsV});
-    }
+    if(textureCoords == TextureCoords::Generate)
+        vertex({0.0f, y, 1.0f}, normal, {1.0f, textureCoordsV});
 }
 
 Trade::MeshData3D Spheroid::finalize() {
@@ -26,8 +26,10 @@
 */
 
 #include <vector>
+#include <Corrade/Containers/ArrayView.h>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/Primitives/SolidVertex.h"
 #include "Magnum/Trade/Trade.h"
 
 namespace Magnum { namespace Primitives { namespace Implementation {
@@ -41,6 +43,15 @@ class Spheroid {
 
         Spheroid(UnsignedInt segments, TextureCoords textureCoords);
 
+        /* Writes the data into given views instead of internal arrays, the
+           views are expected to have exactly the size needed */
+        Spheroid(UnsignedInt segments, TextureCoords textureCoords, Containers::ArrayView<SolidVertex> vertices, Containers::ArrayView<UnsignedShort> indices);
+
+        /* Vertex count of a vertex ring */
+        static UnsignedInt ringVertexCount(UnsignedInt segments, TextureCoords textureCoords) {
+            return segments + (textureCoords == TextureCoords::Generate ? 1 : 0);
+        }
+
         void capVertex(Float y, Float normalY, Float textureCoordsV);
         void hemisphereVertexRings(UnsignedInt count, Float centerY, Rad startRingAngle, Rad ringAngleIncrement, Float startTextureCoordsV, Float textureCoordsVIncrement);
         void cylinderVertexRings(UnsignedInt count, Float startY, Float yIncrement, Float startTextureCoordsV, Float textureCoordsVIncrement);
@@ -52,9 +63,16 @@ class Spheroid {
         Trade::MeshData3D finalize();
 
     private:
+        void vertex(const Vector3& position, const Vector3& normal, const Vector2& textureCoords);
+        void index(UnsignedInt index);
+
         UnsignedInt segments;
         TextureCoords textureCoords;
 
+        UnsignedInt vertexCount, indexCount;
+        Containers::ArrayView<SolidVertex> interleavedVertices;
+        Containers::ArrayView<UnsignedShort> interleavedIndices;
+
         std::vector<UnsignedInt> indices;
         std::vector<Vector3> positions;
         std::vector<Vector3> normals;
@@ -0,0 +1,69 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include "MeshCache.h"
+
+#include <tuple>
+
+#include "Magnum/Buffer.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/MeshTools/Compile.h"
+
+namespace Magnum { namespace Primitives {
+
+struct MeshCache::Entry {
+    Mesh mesh{NoCreate};
+    std::unique_ptr<Buffer> vertices, indices;
+};
+
+MeshCache::MeshCache(const BufferUsage usage): _usage{usage} {}
+
+MeshCache::MeshCache(): MeshCache{BufferUsage::StaticDraw} {}
+
+MeshCache::MeshCache(MeshCache&&) = default;
+
+MeshCache::~MeshCache() = default;
+
+MeshCache& MeshCache::operator=(MeshCache&&) = default;
+
+void MeshCache::clear() { _meshes.clear(); }
+
+Mesh* MeshCache::find(const std::string& key) {
+    const auto found = _meshes.find(key);
+    return found == _meshes.end() ? nullptr : &found->second->mesh;
+}
+
+Mesh& MeshCache::add(std::string&& key, const Trade::MeshData2D& data) {
+    std::unique_ptr<Entry> entry{new Entry};
+    std::tie(entry->mesh, entry->vertices, entry->indices) = MeshTools::compile(data, _usage);
+    return _meshes.emplace(std::move(key), std::move(entry)).first->second->mesh;
+}
+
+Mesh& MeshCache::add(std::string&& key, const Trade::MeshData3D& data) {
+    std::unique_ptr<Entry> entry{new Entry};
+    std::tie(entry->mesh, entry->vertices, entry->indices) = MeshTools::compile(data, _usage);
+    return _meshes.emplace(std::move(key), std::move(entry)).first->second->mesh;
+}
+
+}}
@@ -0,0 +1,156 @@
+#ifndef Magnum_Primitives_MeshCache_h
+#define Magnum_Primitives_MeshCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+/** @file
+ * @brief Class @ref Magnum::Primitives::MeshCache
+ */
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Primitives/visibility.h"
+#include "Magnum/Trade/MeshData2D.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace Primitives {
+
+namespace Implementation {
+    /* Terminator for recursive calls */
+    inline void appendMeshCacheKey(std::string&) {}
+
+    template<class T, class ...U> void appendMeshCacheKey(std::string& key, const T& first, const U&... next) {
+        key.append(reinterpret_cast<const char*>(&first), sizeof(T));
+        appendMeshCacheKey(key, next...);
+    }
+}
+
+/**
+@brief Cache of compiled primitive meshes
+
+Generates and compiles each primitive only once for given parameters and then
+returns reference to the same @ref Mesh on subsequent calls. The mesh is
+identified by the generator function and the parameters passed to it, so
+different parameters result in different meshes:
+@code
+Primitives::MeshCache cache;
+
+// Generated, compiled and returned
+Mesh& sphere = cache.get(Primitives::Icosphere::solid, 3);
+
+// Returns the same mesh as above
+Mesh& sameSphere = cache.get(Primitives::Icosphere::solid, 3);
+
+// Generates new mesh
+Mesh& capsule = cache.get(Primitives::Capsule3D::solid, 4, 1, 16, 0.5f,
+    Primitives::Capsule3D::TextureCoords::DontGenerate);
+@endcode
+
+Because default arguments can't be used through function pointers, all
+parameters of the generator have to be specified. The parameters are
+compared bitwise, so they have to be trivially copyable types without
+padding, which is the case for all primitives in this library. The meshes,
+along with their vertex and index buffers, are owned by the cache and are
+destroyed with it or when @ref clear() is called. They are compiled using
+@ref MeshTools::compile().
+@see @ref ResourceManager
+*/
+class MAGNUM_PRIMITIVES_EXPORT MeshCache {
+    public:
+        /**
+         * @brief Constructor
+         * @param usage     Buffer usage for the compiled meshes
+         */
+        explicit MeshCache(BufferUsage usage);
+
+        /** @brief Constructor with @ref BufferUsage::StaticDraw usage */
+        explicit MeshCache();
+
+        /** @brief Copying is not allowed */
+        MeshCache(const MeshCache&) = delete;
+
+        /** @brief Move constructor */
+        MeshCache(MeshCache&&);
+
+        /** @brief Destructor */
+        ~MeshCache();
+
+        /** @brief Copying is not allowed */
+        MeshCache& operator=(const MeshCache&) = delete;
+
+        /** @brief Move assignment */
+        MeshCache& operator=(MeshCache&&);
+
+        /** @brief Count of cached meshes */
+        std::size_t size() const { return _meshes.size(); }
+
+        /**
+         * @brief Get a mesh
+         * @param generator     Primitive generator function, either
+         *      returning @ref Trade::MeshData2D or @ref Trade::MeshData3D
+         * @param args          Arguments for the generator
+         *
+         * If the mesh generated with given arguments is already in the
+         * cache, returns reference to it. Otherwise calls @p generator,
+         * compiles the result and adds it to the cache. The arguments are
+         * converted to generator parameter types first.
+         */
+        template<class T, class ...Args, class ...U> Mesh& get(T(*generator)(Args...), U&&... args) {
+            return getInternal<T, Args...>(generator, Args(std::forward<U>(args))...);
+        }
+
+        /**
+         * @brief Remove all meshes from the cache
+         *
+         * References returned from @ref get() are invalidated.
+         */
+        void clear();
+
+    private:
+        struct Entry;
+
+        template<class T, class ...Args> Mesh& getInternal(T(*generator)(Args...), const Args&... args) {
+            std::string key;
+            key.append(reinterpret_cast<const char*>(&generator), sizeof(generator));
+            Implementation::appendMeshCacheKey(key, args...);
+
+            if(Mesh* const mesh = find(key)) return *mesh;
+            return add(std::move(key), generator(args...));
+        }
+
+        Mesh* find(const std::string& key);
+        Mesh& add(std::string&& key, const Trade::MeshData2D& data);
+        Mesh& add(std::string&& key, const Trade::MeshData3D& data);
+
+        BufferUsage _usage;
+        std::unordered_map<std::string, std::unique_ptr<Entry>> _meshes;
+};
+
+}}
+
+#endif
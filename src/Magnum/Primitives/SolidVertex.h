@@ -0,0 +1,62 @@
+#ifndef Magnum_Primitives_SolidVertex_h
+#define Magnum_Primitives_SolidVertex_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::Primitives::SolidVertex
+ */
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Primitives {
+
+/**
+@brief Interleaved vertex of a solid primitive
+
+Vertex layout used by the `solidInterleaved()` variants of solid primitives,
+such as @ref Capsule3D::solidInterleaved(), which write the mesh directly into
+caller-provided memory (e.g. a mapped buffer) instead of creating a
+@ref Trade::MeshData3D. Texture coordinates are zero if not generated. The
+layout can be described with @ref MeshTools::VertexFormat:
+@code
+typedef MeshTools::VertexFormat<Primitives::SolidVertex,
+    MeshTools::VertexAttribute<Shaders::Phong::Position, offsetof(Primitives::SolidVertex, position)>,
+    MeshTools::VertexAttribute<Shaders::Phong::Normal, offsetof(Primitives::SolidVertex, normal)>,
+    MeshTools::VertexAttribute<Shaders::Phong::TextureCoordinates, offsetof(Primitives::SolidVertex, textureCoordinates)>> Format;
+@endcode
+Indices are written as @ref Magnum::UnsignedShort "UnsignedShort", so the
+primitive can have at most 65536 vertices.
+*/
+struct SolidVertex {
+    Vector3 position;           /**< @brief Position */
+    Vector3 normal;             /**< @brief Normal */
+    Vector2 textureCoordinates; /**< @brief Texture coordinates */
+};
+
+}}
+
+#endif
@@ -41,13 +41,33 @@ struct CapsuleTest: TestSuite::Tester {
     void solid3DWithoutTextureCoords();
     void solid3DWithTextureCoords();
     void wireframe3D();
+
+    void solid3DInterleaved();
+};
+
+namespace {
+
+enum: std::size_t { Solid3DInterleavedDataCount = 3 };
+
+struct {
+    const char* name;
+    UnsignedInt hemisphereRings, cylinderRings, segments;
+    Capsule3D::TextureCoords textureCoords;
+} Solid3DInterleavedData[Solid3DInterleavedDataCount]{
+    {"", 2, 2, 3, Capsule3D::TextureCoords::DontGenerate},
+    {"texture coordinates", 2, 2, 3, Capsule3D::TextureCoords::Generate},
+    {"more rings and segments", 4, 3, 8, Capsule3D::TextureCoords::Generate}
 };
 
+}
+
 CapsuleTest::CapsuleTest() {
     addTests({&CapsuleTest::wireframe2D,
               &CapsuleTest::solid3DWithoutTextureCoords,
               &CapsuleTest::solid3DWithTextureCoords,
               &CapsuleTest::wireframe3D});
+
+    addInstancedTests({&CapsuleTest::solid3DInterleaved}, Solid3DInterleavedDataCount);
 }
 
 void CapsuleTest::wireframe2D() {
@@ -320,6 +340,30 @@ void CapsuleTest::wireframe3D() {
     }), TestSuite::Compare::Container);
 }
 
+void CapsuleTest::solid3DInterleaved() {
+    const auto& data = Solid3DInterleavedData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Trade::MeshData3D capsule = Capsule3D::solid(data.hemisphereRings, data.cylinderRings, data.segments, 1.0f, data.textureCoords);
+    const std::pair<UnsignedInt, UnsignedInt> count = Capsule3D::solidCount(data.hemisphereRings, data.cylinderRings, data.segments, data.textureCoords);
+    CORRADE_COMPARE(count.first, capsule.positions(0).size());
+    CORRADE_COMPARE(count.second, capsule.indices().size());
+
+    std::vector<SolidVertex> vertices(count.first);
+    std::vector<UnsignedShort> indices(count.second);
+    Capsule3D::solidInterleaved({vertices.data(), vertices.size()}, {indices.data(), indices.size()}, data.hemisphereRings, data.cylinderRings, data.segments, 1.0f, data.textureCoords);
+
+    /* Texture coordinates are zero if not generated */
+    const bool textureCoords = data.textureCoords == Capsule3D::TextureCoords::Generate;
+    CORRADE_COMPARE(capsule.hasTextureCoords2D(), textureCoords);
+    for(std::size_t i = 0; i != vertices.size(); ++i) {
+        CORRADE_COMPARE(vertices[i].position, capsule.positions(0)[i]);
+        CORRADE_COMPARE(vertices[i].normal, capsule.normals(0)[i]);
+        CORRADE_COMPARE(vertices[i].textureCoordinates, textureCoords ? capsule.textureCoords2D(0)[i] : Vector2{});
+    }
+    CORRADE_COMPARE_AS((std::vector<UnsignedInt>{indices.begin(), indices.end()}), capsule.indices(), TestSuite::Compare::Container);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Primitives::Test::CapsuleTest)
@@ -0,0 +1,108 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <cstddef>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Primitives/Cube.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace Primitives { namespace Test {
+
+struct CubeTest: TestSuite::Tester {
+    explicit CubeTest();
+
+    void solid();
+    void solidInterleaved();
+    void solidInterleavedLayout();
+};
+
+CubeTest::CubeTest() {
+    addTests({&CubeTest::solid,
+              &CubeTest::solidInterleaved,
+              &CubeTest::solidInterleavedLayout});
+}
+
+void CubeTest::solid() {
+    Trade::MeshData3D cube = Cube::solid();
+
+    CORRADE_COMPARE(cube.primitive(), MeshPrimitive::Triangles);
+    CORRADE_VERIFY(cube.isIndexed());
+    CORRADE_COMPARE(cube.positionArrayCount(), 1);
+    CORRADE_COMPARE(cube.normalArrayCount(), 1);
+    CORRADE_VERIFY(!cube.hasTextureCoords2D());
+
+    /* Four vertices for each face so the normals can be flat */
+    CORRADE_COMPARE(cube.positions(0).size(), 24);
+    CORRADE_COMPARE(cube.normals(0).size(), 24);
+    CORRADE_COMPARE(cube.indices().size(), 36);
+}
+
+void CubeTest::solidInterleaved() {
+    Trade::MeshData3D cube = Cube::solid();
+    const std::pair<UnsignedInt, UnsignedInt> count = Cube::solidCount();
+    CORRADE_COMPARE(count.first, cube.positions(0).size());
+    CORRADE_COMPARE(count.second, cube.indices().size());
+
+    std::vector<SolidVertex> vertices(count.first);
+    std::vector<UnsignedShort> indices(count.second);
+    Cube::solidInterleaved({vertices.data(), vertices.size()}, {indices.data(), indices.size()});
+
+    /* Same vertices in the same order, texture coordinates are not
+       generated */
+    for(std::size_t i = 0; i != vertices.size(); ++i) {
+        CORRADE_COMPARE(vertices[i].position, cube.positions(0)[i]);
+        CORRADE_COMPARE(vertices[i].normal, cube.normals(0)[i]);
+        CORRADE_COMPARE(vertices[i].textureCoordinates, Vector2{});
+    }
+
+    /* Indices in the same order, so the winding is the same */
+    CORRADE_COMPARE_AS((std::vector<UnsignedInt>{indices.begin(), indices.end()}), cube.indices(), TestSuite::Compare::Container);
+}
+
+void CubeTest::solidInterleavedLayout() {
+    /* The layout is tightly packed so it can be uploaded as-is */
+    CORRADE_COMPARE(sizeof(SolidVertex), 8*sizeof(Float));
+    CORRADE_COMPARE(offsetof(SolidVertex, position), 0);
+    CORRADE_COMPARE(offsetof(SolidVertex, normal), 3*sizeof(Float));
+    CORRADE_COMPARE(offsetof(SolidVertex, textureCoordinates), 6*sizeof(Float));
+
+    /* Vertices of each face are consecutive and share its normal */
+    std::vector<SolidVertex> vertices(Cube::solidCount().first);
+    std::vector<UnsignedShort> indices(Cube::solidCount().second);
+    Cube::solidInterleaved({vertices.data(), vertices.size()}, {indices.data(), indices.size()});
+    for(std::size_t face = 0; face != 6; ++face) {
+        for(std::size_t i = 0; i != 6; ++i) {
+            CORRADE_COMPARE(indices[face*6 + i]/4, face);
+            CORRADE_COMPARE(vertices[indices[face*6 + i]].normal, vertices[face*4].normal);
+        }
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Primitives::Test::CubeTest)
@@ -38,12 +38,34 @@ struct CylinderTest: TestSuite::Tester {
     void solidWithoutAnything();
     void solidWithTextureCoordsAndCaps();
     void wireframe();
+
+    void solidInterleaved();
+};
+
+namespace {
+
+enum: std::size_t { SolidInterleavedDataCount = 5 };
+
+struct {
+    const char* name;
+    UnsignedInt rings, segments;
+    Cylinder::Flags flags;
+} SolidInterleavedData[SolidInterleavedDataCount]{
+    {"", 2, 3, {}},
+    {"texture coordinates", 2, 3, Cylinder::Flag::GenerateTextureCoords},
+    {"caps", 2, 3, Cylinder::Flag::CapEnds},
+    {"texture coordinates and caps", 2, 3, Cylinder::Flag::GenerateTextureCoords|Cylinder::Flag::CapEnds},
+    {"more rings and segments", 5, 12, Cylinder::Flag::GenerateTextureCoords|Cylinder::Flag::CapEnds}
 };
 
+}
+
 CylinderTest::CylinderTest() {
     addTests({&CylinderTest::solidWithoutAnything,
               &CylinderTest::solidWithTextureCoordsAndCaps,
               &CylinderTest::wireframe});
+
+    addInstancedTests({&CylinderTest::solidInterleaved}, SolidInterleavedDataCount);
 }
 
 void CylinderTest::solidWithoutAnything() {
@@ -237,6 +259,30 @@ void CylinderTest::wireframe() {
     }), TestSuite::Compare::Container);
 }
 
+void CylinderTest::solidInterleaved() {
+    const auto& data = SolidInterleavedData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Trade::MeshData3D cylinder = Cylinder::solid(data.rings, data.segments, 1.5f, data.flags);
+    const std::pair<UnsignedInt, UnsignedInt> count = Cylinder::solidCount(data.rings, data.segments, data.flags);
+    CORRADE_COMPARE(count.first, cylinder.positions(0).size());
+    CORRADE_COMPARE(count.second, cylinder.indices().size());
+
+    std::vector<SolidVertex> vertices(count.first);
+    std::vector<UnsignedShort> indices(count.second);
+    Cylinder::solidInterleaved({vertices.data(), vertices.size()}, {indices.data(), indices.size()}, data.rings, data.segments, 1.5f, data.flags);
+
+    /* Texture coordinates are zero if not generated */
+    const bool textureCoords = bool(data.flags & Cylinder::Flag::GenerateTextureCoords);
+    CORRADE_COMPARE(cylinder.hasTextureCoords2D(), textureCoords);
+    for(std::size_t i = 0; i != vertices.size(); ++i) {
+        CORRADE_COMPARE(vertices[i].position, cylinder.positions(0)[i]);
+        CORRADE_COMPARE(vertices[i].normal, cylinder.normals(0)[i]);
+        CORRADE_COMPARE(vertices[i].textureCoordinates, textureCoords ? cylinder.textureCoords2D(0)[i] : Vector2{});
+    }
+    CORRADE_COMPARE_AS((std::vector<UnsignedInt>{indices.begin(), indices.end()}), cylinder.indices(), TestSuite::Compare::Container);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Primitives::Test::CylinderTest)
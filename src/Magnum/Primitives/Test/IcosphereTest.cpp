@@ -35,10 +35,14 @@ struct IcosphereTest: TestSuite::Tester {
     explicit IcosphereTest();
 
     void count();
+    void noDuplicates();
+    void winding();
 };
 
 IcosphereTest::IcosphereTest() {
-    addTests({&IcosphereTest::count});
+    addTests({&IcosphereTest::count,
+              &IcosphereTest::noDuplicates,
+              &IcosphereTest::winding});
 }
 
 void IcosphereTest::count() {
@@ -52,6 +56,33 @@ void IcosphereTest::count() {
     CORRADE_COMPARE(data.normals(0).size(), 162);
 }
 
+void IcosphereTest::noDuplicates() {
+    Trade::MeshData3D data = Primitives::Icosphere::solid(3);
+
+    /* Edge midpoints shared by two faces are created only once */
+    const std::vector<Vector3>& positions = data.positions(0);
+    CORRADE_COMPARE(positions.size(), 642);
+    for(std::size_t i = 0; i != positions.size(); ++i) {
+        CORRADE_COMPARE(positions[i].length(), 1.0f);
+        for(std::size_t j = 0; j != i; ++j)
+            CORRADE_VERIFY((positions[i] - positions[j]).length() > 0.01f);
+    }
+}
+
+void IcosphereTest::winding() {
+    Trade::MeshData3D data = Primitives::Icosphere::solid(2);
+
+    /* All faces are counterclockwise, facing outwards */
+    const std::vector<UnsignedInt>& indices = data.indices();
+    const std::vector<Vector3>& positions = data.positions(0);
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        const Vector3 a = positions[indices[i]];
+        const Vector3 b = positions[indices[i + 1]];
+        const Vector3 c = positions[indices[i + 2]];
+        CORRADE_VERIFY(Math::dot(Math::cross(b - a, c - a), a + b + c) > 0.0f);
+    }
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Primitives::Test::IcosphereTest)
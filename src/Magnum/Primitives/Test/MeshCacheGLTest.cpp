@@ -0,0 +1,101 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include "Magnum/Mesh.h"
+#include "Magnum/Primitives/Capsule.h"
+#include "Magnum/Primitives/Circle.h"
+#include "Magnum/Primitives/Icosphere.h"
+#include "Magnum/Primitives/MeshCache.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Primitives { namespace Test {
+
+struct MeshCacheGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit MeshCacheGLTest();
+
+    void get();
+    void get2D();
+    void differentParameters();
+    void clear();
+};
+
+MeshCacheGLTest::MeshCacheGLTest() {
+    addTests({&MeshCacheGLTest::get,
+              &MeshCacheGLTest::get2D,
+              &MeshCacheGLTest::differentParameters,
+              &MeshCacheGLTest::clear});
+}
+
+void MeshCacheGLTest::get() {
+    MeshCache cache;
+    Mesh& a = cache.get(Icosphere::solid, 2);
+    MAGNUM_VERIFY_NO_ERROR();
+
+    CORRADE_COMPARE(cache.size(), 1);
+    CORRADE_VERIFY(a.isIndexed());
+    CORRADE_COMPARE(a.count(), 960);
+
+    /* The same mesh is returned the second time */
+    Mesh& b = cache.get(Icosphere::solid, 2u);
+    CORRADE_COMPARE(cache.size(), 1);
+    CORRADE_VERIFY(&a == &b);
+}
+
+void MeshCacheGLTest::get2D() {
+    MeshCache cache;
+    Mesh& a = cache.get(Circle::solid, 16);
+    MAGNUM_VERIFY_NO_ERROR();
+
+    CORRADE_VERIFY(!a.isIndexed());
+    CORRADE_COMPARE(a.count(), 17);
+    CORRADE_VERIFY(&cache.get(Circle::solid, 16) == &a);
+}
+
+void MeshCacheGLTest::differentParameters() {
+    MeshCache cache;
+    Mesh& a = cache.get(Capsule3D::solid, 2, 1, 8, 0.5f, Capsule3D::TextureCoords::DontGenerate);
+    Mesh& b = cache.get(Capsule3D::solid, 2, 1, 8, 1.0f, Capsule3D::TextureCoords::DontGenerate);
+    Mesh& c = cache.get(Capsule3D::wireframe, 2, 1, 8, 0.5f);
+    MAGNUM_VERIFY_NO_ERROR();
+
+    CORRADE_COMPARE(cache.size(), 3);
+    CORRADE_VERIFY(&a != &b);
+    CORRADE_VERIFY(&a != &c);
+    CORRADE_VERIFY(&cache.get(Capsule3D::solid, 2, 1, 8, 1.0f, Capsule3D::TextureCoords::DontGenerate) == &b);
+}
+
+void MeshCacheGLTest::clear() {
+    MeshCache cache;
+    cache.get(Icosphere::solid, 0);
+    cache.get(Icosphere::solid, 1);
+    CORRADE_COMPARE(cache.size(), 2);
+
+    cache.clear();
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(cache.size(), 0);
+}
+
+}}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Primitives::Test::MeshCacheGLTest)
@@ -38,12 +38,32 @@ struct UVSphereTest: TestSuite::Tester {
     void solidWithoutTextureCoords();
     void solidWithTextureCoords();
     void wireframe();
+
+    void solidInterleaved();
+};
+
+namespace {
+
+enum: std::size_t { SolidInterleavedDataCount = 3 };
+
+struct {
+    const char* name;
+    UnsignedInt rings, segments;
+    UVSphere::TextureCoords textureCoords;
+} SolidInterleavedData[SolidInterleavedDataCount]{
+    {"", 3, 3, UVSphere::TextureCoords::DontGenerate},
+    {"texture coordinates", 3, 3, UVSphere::TextureCoords::Generate},
+    {"more rings and segments", 6, 12, UVSphere::TextureCoords::Generate}
 };
 
+}
+
 UVSphereTest::UVSphereTest() {
     addTests({&UVSphereTest::solidWithoutTextureCoords,
               &UVSphereTest::solidWithTextureCoords,
               &UVSphereTest::wireframe});
+
+    addInstancedTests({&UVSphereTest::solidInterleaved}, SolidInterleavedDataCount);
 }
 
 void UVSphereTest::solidWithoutTextureCoords() {
@@ -168,6 +188,30 @@ void UVSphereTest::wireframe() {
     }), TestSuite::Compare::Container);
 }
 
+void UVSphereTest::solidInterleaved() {
+    const auto& data = SolidInterleavedData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Trade::MeshData3D sphere = UVSphere::solid(data.rings, data.segments, data.textureCoords);
+    const std::pair<UnsignedInt, UnsignedInt> count = UVSphere::solidCount(data.rings, data.segments, data.textureCoords);
+    CORRADE_COMPARE(count.first, sphere.positions(0).size());
+    CORRADE_COMPARE(count.second, sphere.indices().size());
+
+    std::vector<SolidVertex> vertices(count.first);
+    std::vector<UnsignedShort> indices(count.second);
+    UVSphere::solidInterleaved({vertices.data(), vertices.size()}, {indices.data(), indices.size()}, data.rings, data.segments, data.textureCoords);
+
+    /* Texture coordinates are zero if not generated */
+    const bool textureCoords = data.textureCoords == UVSphere::TextureCoords::Generate;
+    CORRADE_COMPARE(sphere.hasTextureCoords2D(), textureCoords);
+    for(std::size_t i = 0; i != vertices.size(); ++i) {
+        CORRADE_COMPARE(vertices[i].position, sphere.positions(0)[i]);
+        CORRADE_COMPARE(vertices[i].normal, sphere.normals(0)[i]);
+        CORRADE_COMPARE(vertices[i].textureCoordinates, textureCoords ? sphere.textureCoords2D(0)[i] : Vector2{});
+    }
+    CORRADE_COMPARE_AS((std::vector<UnsignedInt>{indices.begin(), indices.end()}), sphere.indices(), TestSuite::Compare::Container);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Primitives::Test::UVSphereTest)
@@ -33,13 +33,9 @@
 
 namespace Magnum { namespace Primitives {
 
-Trade::MeshData3D UVSphere::solid(UnsignedInt rings, UnsignedInt segments, TextureCoords textureCoords) {
-    CORRADE_ASSERT(rings >= 2 && segments >= 3, "UVSphere must have at least two rings and three segments", Trade::MeshData3D(MeshPrimitive::Triangles, {}, {}, {}, {}));
-
-    Implementation::Spheroid sphere(segments, textureCoords == TextureCoords::Generate ?
-        Implementation::Spheroid::TextureCoords::Generate :
-        Implementation::Spheroid::TextureCoords::DontGenerate);
+namespace {
 
+void solidInto(Implementation::Spheroid& sphere, const UnsignedInt rings) {
     Float textureCoordsVIncrement = 1.0f/rings;
     Rad ringAngleIncrement(Constants::pi()/rings);
 
@@ -56,10 +52,42 @@ Trade::MeshData3D UVSphere::solid(UnsignedInt rings, UnsignedInt segments, Textu
     sphere.bottomFaceRing();
     sphere.faceRings(rings-2);
     sphere.topFaceRing();
+}
+
+Implementation::Spheroid::TextureCoords spheroidTextureCoords(const UVSphere::TextureCoords textureCoords) {
+    return textureCoords == UVSphere::TextureCoords::Generate ?
+        Implementation::Spheroid::TextureCoords::Generate :
+        Implementation::Spheroid::TextureCoords::DontGenerate;
+}
+
+}
 
+Trade::MeshData3D UVSphere::solid(UnsignedInt rings, UnsignedInt segments, TextureCoords textureCoords) {
+    CORRADE_ASSERT(rings >= 2 && segments >= 3, "UVSphere must have at least two rings and three segments", Trade::MeshData3D(MeshPrimitive::Triangles, {}, {}, {}, {}));
+
+    Implementation::Spheroid sphere(segments, spheroidTextureCoords(textureCoords));
+    solidInto(sphere, rings);
     return sphere.finalize();
 }
 
+std::pair<UnsignedInt, UnsignedInt> UVSphere::solidCount(const UnsignedInt rings, const UnsignedInt segments, const TextureCoords textureCoords) {
+    return {2 + (rings-1)*Implementation::Spheroid::ringVertexCount(segments, spheroidTextureCoords(textureCoords)),
+            6*segments*(rings-1)};
+}
+
+void UVSphere::solidInterleaved(const Containers::ArrayView<SolidVertex> vertices, const Containers::ArrayView<UnsignedShort> indices, const UnsignedInt rings, const UnsignedInt segments, const TextureCoords textureCoords) {
+    CORRADE_ASSERT(rings >= 2 && segments >= 3, "UVSphere must have at least two rings and three segments", );
+
+    const std::pair<UnsignedInt, UnsignedInt> count = solidCount(rings, segments, textureCoords);
+    CORRADE_ASSERT(count.first <= 65536,
+        "Primitives::UVSphere::solidInterleaved():" << count.first << "vertices don't fit into 16-bit indices", );
+    CORRADE_ASSERT(vertices.size() == count.first && indices.size() == count.second,
+        "Primitives::UVSphere::solidInterleaved(): expected" << count.first << "vertices and" << count.second << "indices but got" << vertices.size() << "and" << indices.size(), );
+
+    Implementation::Spheroid sphere(segments, spheroidTextureCoords(textureCoords), vertices, indices);
+    solidInto(sphere, rings);
+}
+
 Trade::MeshData3D UVSphere::wireframe(const UnsignedInt rings, const UnsignedInt segments) {
     CORRADE_ASSERT(rings >= 2 && rings%2 == 0 && segments >= 4 && segments%2 == 0, "Primitives::UVSphere::wireframe(): improper parameters", Trade::MeshData3D(MeshPrimitive::Lines, {}, {}, {}, {}));
 
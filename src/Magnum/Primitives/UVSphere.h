@@ -29,8 +29,12 @@
  * @brief Class @ref Magnum::Primitives::UVSphere
  */
 
-#include "Magnum/Trade/Trade.h"
+#include <utility>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Primitives/SolidVertex.h"
 #include "Magnum/Primitives/visibility.h"
+#include "Magnum/Trade/Trade.h"
 
 namespace Magnum { namespace Primitives {
 
@@ -61,6 +65,29 @@ class MAGNUM_PRIMITIVES_EXPORT UVSphere {
          */
         static Trade::MeshData3D solid(UnsignedInt rings, UnsignedInt segments, TextureCoords textureCoords = TextureCoords::DontGenerate);
 
+        /**
+         * @brief Vertex and index count of solid UV sphere
+         *
+         * Returns vertex and index count of a sphere generated with
+         * @ref solid() or @ref solidInterleaved() with the same parameters,
+         * without generating anything.
+         */
+        static std::pair<UnsignedInt, UnsignedInt> solidCount(UnsignedInt rings, UnsignedInt segments, TextureCoords textureCoords = TextureCoords::DontGenerate);
+
+        /**
+         * @brief Solid UV sphere into interleaved memory
+         * @param vertices      Vertex output
+         * @param indices       Index output
+         *
+         * Same as @ref solid(), but writes the vertices and indices directly
+         * to caller-provided memory. The views are expected to have exactly
+         * the size returned by @ref solidCount() and the vertex count is
+         * expected to fit into 16-bit indices. See
+         * @ref Capsule3D::solidInterleaved() for an example.
+         * @see @ref SolidVertex
+         */
+        static void solidInterleaved(Containers::ArrayView<SolidVertex> vertices, Containers::ArrayView<UnsignedShort> indices, UnsignedInt rings, UnsignedInt segments, TextureCoords textureCoords = TextureCoords::DontGenerate);
+
         /**
          * @brief Wireframe UV sphere
          * @param rings         Number of (line) rings. Must be larger or equal
@@ -0,0 +1,288 @@
+#ifndef Magnum_QueryPool_h
+#define Magnum_QueryPool_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::QueryPool
+ */
+
+#include "Magnum/configure.h"
+
+#if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+#include <vector>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/AbstractQuery.h"
+
+namespace Magnum {
+
+/**
+@brief Query pool
+
+Recycles query objects of given type and collects their results
+asynchronously, which is useful for per-frame instrumentation that would
+otherwise create and destroy hundreds of query objects each frame and stall on
+@ref AbstractQuery::result() "result()". The @p Query template parameter is
+one of @ref TimeQuery, @ref SampleQuery or @ref PrimitiveQuery.
+@code
+QueryPool<TimeQuery> pool{TimeQuery::Target::TimeElapsed};
+
+// each frame
+pool.begin(ShadowPass);
+// render shadow maps...
+pool.end();
+
+pool.begin(MainPass);
+// render the scene...
+pool.end();
+
+pool.collect([](const QueryPool<TimeQuery>::Result& result) {
+    Debug() << "Pass" << result.tag << "in frame" << result.frame << "took"
+            << result.value << "ns";
+});
+@endcode
+
+Each @ref begin() takes a query object from the pool, creating a new one only
+if there's no free one, and @ref end() puts it into a list of pending queries.
+@ref collect() marks end of a frame. It goes through the pending queries and
+reports results only of the ones that have @ref AbstractQuery::resultAvailable()
+set, returning the queries back to the pool. To bound the latency and the
+number of query objects, results of queries older than @ref latency() frames
+are retrieved even if not yet available, which may stall. The results are
+reported in the order the queries were issued.
+
+## Disabled mode
+
+Instrumentation is often wanted only in some builds or only when explicitly
+requested. If the pool is disabled using @ref setEnabled(), @ref begin(),
+@ref end(), @ref timestamp() and @ref collect() return immediately without
+any OpenGL call or allocation, so the instrumentation can stay in the code.
+The callback is a template parameter, so no type-erased function object is
+created either.
+The pool is also disabled if constructed with @ref QueryPool(NoCreateT).
+Queries pending at the time of disabling are still collected by subsequent
+@ref collect() calls.
+
+Queries of the same target can't be nested, so only one query from the pool
+can be active at a time.
+@see @ref TimeQuery, @ref SampleQuery, @ref PrimitiveQuery
+@requires_gles30 Extension @es_extension{EXT,occlusion_query_boolean} in
+    OpenGL ES 2.0 for @ref SampleQuery pool, @es_extension{EXT,disjoint_timer_query}
+    for @ref TimeQuery pool.
+@requires_webgl20 Queries are not available in WebGL 1.0.
+*/
+template<class Query> class QueryPool {
+    public:
+        /**
+         * @brief Query result type
+         *
+         * @ref Magnum::UnsignedLong "UnsignedLong" is not available as a query
+         * result type in WebGL, @ref Magnum::UnsignedInt "UnsignedInt" is used
+         * there instead.
+         */
+        #ifndef MAGNUM_TARGET_WEBGL
+        typedef UnsignedLong ResultType;
+        #else
+        typedef UnsignedInt ResultType;
+        #endif
+
+        /** @brief Query result */
+        struct Result {
+            UnsignedLong frame; /**< Frame in which the query was issued */
+            UnsignedInt tag;    /**< Tag passed to @ref begin() or @ref timestamp() */
+            ResultType value;   /**< Query result */
+        };
+
+        /**
+         * @brief Constructor
+         * @param target    Query target
+         * @param latency   Max count of frames after which the result is
+         *      retrieved even if not yet available
+         *
+         * No query object is created until the first @ref begin().
+         */
+        explicit QueryPool(typename Query::Target target, UnsignedInt latency = 3): _target{target}, _latency{latency}, _frame{}, _created{true}, _enabled{true}, _active{false} {}
+
+        /**
+         * @brief Construct disabled pool
+         *
+         * Equivalent to constructing the pool and calling
+         * @ref setEnabled() "setEnabled(false)". Useful when the pool is
+         * created only conditionally. The pool can't be enabled later.
+         */
+        explicit QueryPool(NoCreateT) noexcept: _target{}, _latency{}, _frame{}, _created{false}, _enabled{false}, _active{false} {}
+
+        /** @brief Copying is not allowed */
+        QueryPool(const QueryPool<Query>&) = delete;
+
+        /** @brief Move constructor */
+        QueryPool(QueryPool<Query>&&) = default;
+
+        /** @brief Copying is not allowed */
+        QueryPool<Query>& operator=(const QueryPool<Query>&) = delete;
+
+        /** @brief Move assignment */
+        QueryPool<Query>& operator=(QueryPool<Query>&&) = default;
+
+        /** @brief Max frame latency */
+        UnsignedInt latency() const { return _latency; }
+
+        /** @brief Whether the pool is enabled */
+        bool isEnabled() const { return _enabled; }
+
+        /**
+         * @brief Enable or disable the pool
+         * @return Reference to self (for method chaining)
+         *
+         * Enabling a pool constructed with @ref QueryPool(NoCreateT) is not
+         * allowed. Disabling the pool while a query is active is not allowed.
+         */
+        QueryPool<Query>& setEnabled(bool enabled) {
+            CORRADE_ASSERT(!enabled || _created,
+                "QueryPool::setEnabled(): can't enable a pool constructed with NoCreate", *this);
+            CORRADE_ASSERT(!_active,
+                "QueryPool::setEnabled(): a query is active", *this);
+            _enabled = enabled;
+            return *this;
+        }
+
+        /** @brief Count of query objects created by the pool */
+        std::size_t capacity() const { return _free.size() + _pending.size(); }
+
+        /** @brief Count of queries waiting for the result */
+        std::size_t pendingCount() const { return _pending.size(); }
+
+        /**
+         * @brief Begin query
+         * @param tag       Arbitrary value passed back with the result
+         *
+         * Expects that no other query from the pool is active.
+         * @see @ref AbstractQuery::begin()
+         */
+        void begin(UnsignedInt tag = 0) {
+            if(!_enabled) return;
+            CORRADE_ASSERT(!_active, "QueryPool::begin(): a query is already active", );
+            acquire(tag).begin();
+            _active = true;
+        }
+
+        /**
+         * @brief End query
+         *
+         * Expects that a query was started with @ref begin().
+         * @see @ref AbstractQuery::end()
+         */
+        void end() {
+            if(!_enabled) return;
+            CORRADE_ASSERT(_active, "QueryPool::end(): no query is active", );
+            _pending.back().query.end();
+            _active = false;
+        }
+
+        /**
+         * @brief Query timestamp
+         * @param tag       Arbitrary value passed back with the result
+         *
+         * Available only for @ref TimeQuery pool with
+         * @ref TimeQuery::Target::Timestamp.
+         * @see @ref TimeQuery::timestamp()
+         */
+        void timestamp(UnsignedInt tag = 0) {
+            if(!_enabled) return;
+            acquire(tag).timestamp();
+        }
+
+        /**
+         * @brief Collect available results
+         * @param callback  Function called for each result, taking
+         *      @ref Result as a parameter
+         *
+         * Marks end of a frame. Calls @p callback for each pending query that
+         * has the result available or which was issued @ref latency() or more
+         * frames ago, in the order the queries were issued. Expects that no
+         * query is active.
+         */
+        template<class Callback> void collect(Callback&& callback);
+
+    private:
+        struct Pending {
+            Query query;
+            UnsignedLong frame;
+            UnsignedInt tag;
+        };
+
+        Query& acquire(UnsignedInt tag) {
+            if(_free.empty()) _pending.push_back({Query{_target}, _frame, tag});
+            else {
+                _pending.push_back({std::move(_free.back()), _frame, tag});
+                _free.pop_back();
+            }
+            return _pending.back().query;
+        }
+
+        typename Query::Target _target;
+        UnsignedInt _latency;
+        UnsignedLong _frame;
+        bool _created, _enabled, _active;
+        std::vector<Query> _free;
+        std::vector<Pending> _pending;
+};
+
+template<class Query> template<class Callback> void QueryPool<Query>::collect(Callback&& callback) {
+    /* Pending queries might be left from before the pool got disabled */
+    if(_pending.empty()) {
+        ++_frame;
+        return;
+    }
+
+    CORRADE_ASSERT(!_active, "QueryPool::collect(): a query is active", );
+
+    /* Keep the order of the remaining queries */
+    std::size_t out = 0;
+    for(std::size_t i = 0; i != _pending.size(); ++i) {
+        Pending& pending = _pending[i];
+        if(_frame - pending.frame >= _latency || pending.query.resultAvailable()) {
+            callback(Result{pending.frame, pending.tag, pending.query.template result<ResultType>()});
+            _free.push_back(std::move(pending.query));
+        } else {
+            if(out != i) _pending[out] = std::move(pending);
+            ++out;
+        }
+    }
+
+    /* Can't use erase() or resize(), as the queries are not
+       default-constructible */
+    while(_pending.size() != out) _pending.pop_back();
+
+    ++_frame;
+}
+
+}
+#else
+#error this header is not available in WebGL 1.0 build
+#endif
+
+#endif
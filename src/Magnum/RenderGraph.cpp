@@ -0,0 +1,394 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "RenderGraph.h"
+
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+namespace Magnum {
+
+namespace {
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+Renderer::MemoryBarrier barrierFor(const RenderGraph::Access access) {
+    switch(access) {
+        case RenderGraph::Access::Sampled:
+            return Renderer::MemoryBarrier::TextureFetch;
+        case RenderGraph::Access::Image:
+            return Renderer::MemoryBarrier::ShaderImageAccess;
+        case RenderGraph::Access::Attachment:
+        case RenderGraph::Access::Blit:
+            return Renderer::MemoryBarrier::Framebuffer;
+    }
+
+    CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+#endif
+
+}
+
+AbstractFramebuffer& RenderGraph::PassResources::framebuffer(const UnsignedInt resource) {
+    CORRADE_ASSERT(_graph.isUsedByCurrentPass(resource),
+        "RenderGraph::PassResources::framebuffer(): resource" << resource << "is not used by the pass", *static_cast<AbstractFramebuffer*>(nullptr));
+    Resource& r = _graph._resources[resource];
+    CORRADE_ASSERT(!r.texture,
+        "RenderGraph::PassResources::framebuffer(): resource" << r.name << "is an imported texture", *static_cast<AbstractFramebuffer*>(nullptr));
+    return r.framebuffer ? *r.framebuffer : r.target->framebuffer();
+}
+
+Texture2D& RenderGraph::PassResources::texture(const UnsignedInt resource) {
+    CORRADE_ASSERT(_graph.isUsedByCurrentPass(resource),
+        "RenderGraph::PassResources::texture(): resource" << resource << "is not used by the pass", *static_cast<Texture2D*>(nullptr));
+    Resource& r = _graph._resources[resource];
+    CORRADE_ASSERT(!r.framebuffer,
+        "RenderGraph::PassResources::texture(): resource" << r.name << "is an imported framebuffer", *static_cast<Texture2D*>(nullptr));
+    return r.texture ? *r.texture : r.target->color();
+}
+
+Texture2D& RenderGraph::PassResources::depthTexture(const UnsignedInt resource) {
+    CORRADE_ASSERT(_graph.isUsedByCurrentPass(resource),
+        "RenderGraph::PassResources::depthTexture(): resource" << resource << "is not used by the pass", *static_cast<Texture2D*>(nullptr));
+    Resource& r = _graph._resources[resource];
+    CORRADE_ASSERT(!r.texture && !r.framebuffer,
+        "RenderGraph::PassResources::depthTexture(): resource" << r.name << "is not transient", *static_cast<Texture2D*>(nullptr));
+    return r.target->depth();
+}
+
+RenderGraph::RenderGraph(RenderTargetPool& pool): _pool(pool), _currentPass{-1}, _compiled{false} {}
+
+RenderGraph::~RenderGraph() = default;
+
+UnsignedInt RenderGraph::addTransient(std::string name, const RenderTargetPool::Description& description) {
+    _resources.push_back({std::move(name), description, nullptr, nullptr, nullptr, -1, -1, false});
+    _compiled = false;
+    return _resources.size() - 1;
+}
+
+UnsignedInt RenderGraph::importTexture(std::string name, Texture2D& texture) {
+    _resources.push_back({std::move(name), {{}, TextureFormat{}}, &texture, nullptr, nullptr, -1, -1, false});
+    _compiled = false;
+    return _resources.size() - 1;
+}
+
+UnsignedInt RenderGraph::importFramebuffer(std::string name, AbstractFramebuffer& framebuffer) {
+    _resources.push_back({std::move(name), {{}, TextureFormat{}}, nullptr, &framebuffer, nullptr, -1, -1, false});
+    _compiled = false;
+    return _resources.size() - 1;
+}
+
+UnsignedInt RenderGraph::resource(const std::string& name) const {
+    for(std::size_t i = 0; i != _resources.size(); ++i)
+        if(_resources[i].name == name) return i;
+
+    CORRADE_ASSERT(false, "RenderGraph::resource(): resource" << name << "not found", {});
+    return {}; /* LCOV_EXCL_LINE */
+}
+
+const std::string& RenderGraph::resourceName(const UnsignedInt resource) const {
+    CORRADE_ASSERT(resource < _resources.size(),
+        "RenderGraph::resourceName(): index" << resource << "out of range for" << _resources.size() << "resources", _resources[0].name);
+    return _resources[resource].name;
+}
+
+RenderGraph& RenderGraph::setOutput(const UnsignedInt resource) {
+    CORRADE_ASSERT(resource < _resources.size(),
+        "RenderGraph::setOutput(): index" << resource << "out of range for" << _resources.size() << "resources", *this);
+    _resources[resource].output = true;
+    _compiled = false;
+    return *this;
+}
+
+UnsignedInt RenderGraph::addPass(std::string name, std::function<void(PassResources&)> execute) {
+    _passes.push_back({std::move(name), std::move(execute), {}, false
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        , {}
+        #endif
+        });
+    _compiled = false;
+    return _passes.size() - 1;
+}
+
+#if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+UnsignedInt RenderGraph::addBlitPass(std::string name, const UnsignedInt source, const UnsignedInt destination, const FramebufferBlitMask mask, const FramebufferBlitFilter filter) {
+    const UnsignedInt pass = addPass(std::move(name), [source, destination, mask, filter](PassResources& resources) {
+        AbstractFramebuffer& from = resources.framebuffer(source);
+        AbstractFramebuffer& to = resources.framebuffer(destination);
+        AbstractFramebuffer::blit(from, to, from.viewport(), to.viewport(), mask, filter);
+    });
+    read(pass, source, Access::Blit);
+    write(pass, destination, Access::Blit);
+    return pass;
+}
+#endif
+
+const std::string& RenderGraph::passName(const UnsignedInt pass) const {
+    CORRADE_ASSERT(pass < _passes.size(),
+        "RenderGraph::passName(): index" << pass << "out of range for" << _passes.size() << "passes", _passes[0].name);
+    return _passes[pass].name;
+}
+
+RenderGraph& RenderGraph::read(const UnsignedInt pass, const UnsignedInt resource, const Access access) {
+    return this->access(pass, resource, access, false);
+}
+
+RenderGraph& RenderGraph::write(const UnsignedInt pass, const UnsignedInt resource, const Access access) {
+    CORRADE_ASSERT(access != Access::Sampled,
+        "RenderGraph::write(): can't write with sampled access", *this);
+    return this->access(pass, resource, access, true);
+}
+
+RenderGraph& RenderGraph::access(const UnsignedInt pass, const UnsignedInt resource, const Access access, const bool write) {
+    CORRADE_ASSERT(pass < _passes.size(),
+        (write ? "RenderGraph::write():" : "RenderGraph::read():") << "pass index" << pass << "out of range for" << _passes.size() << "passes", *this);
+    CORRADE_ASSERT(resource < _resources.size(),
+        (write ? "RenderGraph::write():" : "RenderGraph::read():") << "resource index" << resource << "out of range for" << _resources.size() << "resources", *this);
+    #ifndef CORRADE_NO_ASSERT
+    const Resource& r = _resources[resource];
+    #endif
+    CORRADE_ASSERT(!r.texture || access == Access::Sampled || access == Access::Image,
+        (write ? "RenderGraph::write():" : "RenderGraph::read():") << "imported texture" << r.name << "can be accessed only as sampled or image", *this);
+    CORRADE_ASSERT(!r.framebuffer || access == Access::Attachment || access == Access::Blit,
+        (write ? "RenderGraph::write():" : "RenderGraph::read():") << "imported framebuffer" << r.name << "can be accessed only as attachment or blit", *this);
+
+    _passes[pass].accesses.push_back({resource, access, write});
+    _compiled = false;
+    return *this;
+}
+
+bool RenderGraph::compile() {
+    _compiled = false;
+    _order.clear();
+
+    /* Dependencies carrying data (writer before reader or before next
+       writer), used for culling, and all ordering dependencies, including
+       readers before subsequent writers */
+    std::vector<std::vector<UnsignedInt>> dataDependencies(_passes.size()), orderDependencies(_passes.size());
+    {
+        std::vector<Int> lastWriter(_resources.size(), -1);
+        std::vector<std::vector<UnsignedInt>> readers(_resources.size());
+        for(UnsignedInt p = 0; p != _passes.size(); ++p) {
+            /* Reads of a pass see the writes of previous passes, so process
+               them first */
+            for(const ResourceAccess& a: _passes[p].accesses) {
+                if(a.write) continue;
+                const Int writer = lastWriter[a.resource];
+                if(writer != -1 && UnsignedInt(writer) != p) {
+                    dataDependencies[p].push_back(writer);
+                    orderDependencies[p].push_back(writer);
+                }
+                readers[a.resource].push_back(p);
+            }
+
+            for(const ResourceAccess& a: _passes[p].accesses) {
+                if(!a.write) continue;
+                const Int writer = lastWriter[a.resource];
+
+                /* First writer, readers declared earlier depend on it */
+                if(writer == -1) {
+                    for(UnsignedInt reader: readers[a.resource]) {
+                        if(reader == p) continue;
+                        dataDependencies[reader].push_back(p);
+                        orderDependencies[reader].push_back(p);
+                    }
+
+                /* Otherwise it goes after the previous writer and its
+                   readers */
+                } else {
+                    if(UnsignedInt(writer) != p) {
+                        dataDependencies[p].push_back(writer);
+                        orderDependencies[p].push_back(writer);
+                    }
+                    for(UnsignedInt reader: readers[a.resource])
+                        if(reader != p) orderDependencies[p].push_back(reader);
+                }
+
+                lastWriter[a.resource] = p;
+                readers[a.resource].clear();
+            }
+        }
+    }
+
+    /* Keep only passes writing outputs and everything they depend on */
+    std::vector<UnsignedInt> stack;
+    for(Pass& pass: _passes) pass.culled = true;
+    for(UnsignedInt p = 0; p != _passes.size(); ++p) {
+        for(const ResourceAccess& a: _passes[p].accesses) {
+            if(!a.write || !_resources[a.resource].output) continue;
+            _passes[p].culled = false;
+            stack.push_back(p);
+            break;
+        }
+    }
+    while(!stack.empty()) {
+        const UnsignedInt p = stack.back();
+        stack.pop_back();
+        for(UnsignedInt dependency: dataDependencies[p]) {
+            if(!_passes[dependency].culled) continue;
+            _passes[dependency].culled = false;
+            stack.push_back(dependency);
+        }
+    }
+
+    /* Order the kept passes, preferring declaration order among the ones that
+       have all dependencies satisfied */
+    std::size_t keptCount = 0;
+    for(const Pass& pass: _passes) if(!pass.culled) ++keptCount;
+    std::vector<bool> scheduled(_passes.size(), false);
+    while(_order.size() != keptCount) {
+        bool found = false;
+        for(UnsignedInt p = 0; p != _passes.size(); ++p) {
+            if(_passes[p].culled || scheduled[p]) continue;
+
+            bool ready = true;
+            for(UnsignedInt dependency: orderDependencies[p]) {
+                if(_passes[dependency].culled || scheduled[dependency]) continue;
+                ready = false;
+                break;
+            }
+            if(!ready) continue;
+
+            scheduled[p] = true;
+            _order.push_back(p);
+            found = true;
+            break;
+        }
+
+        if(!found) {
+            Error() << "RenderGraph::compile(): passes have cyclic dependencies";
+            _order.clear();
+            return false;
+        }
+    }
+
+    /* Lifetimes of resources */
+    for(Resource& resource: _resources) resource.first = resource.last = -1;
+    for(std::size_t i = 0; i != _order.size(); ++i) {
+        for(const ResourceAccess& a: _passes[_order[i]].accesses) {
+            Resource& resource = _resources[a.resource];
+            if(resource.first == -1) resource.first = i;
+            resource.last = i;
+        }
+    }
+
+    /* Barriers after incoherent image writes */
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    {
+        std::vector<bool> pending(_resources.size(), false);
+        std::vector<Renderer::MemoryBarriers> issued(_resources.size());
+        for(Pass& pass: _passes) pass.barriers = {};
+        for(UnsignedInt p: _order) {
+            Pass& pass = _passes[p];
+            for(const ResourceAccess& a: pass.accesses) {
+                if(!pending[a.resource]) continue;
+                const Renderer::MemoryBarrier barrier = barrierFor(a.access);
+                if(issued[a.resource] & barrier) continue;
+                pass.barriers |= barrier;
+                issued[a.resource] |= barrier;
+            }
+
+            for(const ResourceAccess& a: pass.accesses) {
+                if(!a.write) continue;
+                pending[a.resource] = a.access == Access::Image;
+                issued[a.resource] = {};
+            }
+        }
+    }
+    #endif
+
+    _compiled = true;
+    return true;
+}
+
+const std::vector<UnsignedInt>& RenderGraph::passOrder() const {
+    CORRADE_ASSERT(_compiled,
+        "RenderGraph::passOrder(): the graph is not compiled", _order);
+    return _order;
+}
+
+bool RenderGraph::isPassCulled(const UnsignedInt pass) const {
+    CORRADE_ASSERT(_compiled,
+        "RenderGraph::isPassCulled(): the graph is not compiled", {});
+    CORRADE_ASSERT(pass < _passes.size(),
+        "RenderGraph::isPassCulled(): index" << pass << "out of range for" << _passes.size() << "passes", {});
+    return _passes[pass].culled;
+}
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+Renderer::MemoryBarriers RenderGraph::passMemoryBarriers(const UnsignedInt pass) const {
+    CORRADE_ASSERT(_compiled,
+        "RenderGraph::passMemoryBarriers(): the graph is not compiled", {});
+    CORRADE_ASSERT(pass < _passes.size(),
+        "RenderGraph::passMemoryBarriers(): index" << pass << "out of range for" << _passes.size() << "passes", {});
+    return _passes[pass].barriers;
+}
+#endif
+
+void RenderGraph::execute() {
+    CORRADE_ASSERT(_compiled,
+        "RenderGraph::execute(): the graph is not compiled", );
+
+    PassResources resources{*this};
+    for(std::size_t i = 0; i != _order.size(); ++i) {
+        for(Resource& resource: _resources)
+            if(resource.first == Int(i) && !resource.texture && !resource.framebuffer)
+                resource.target = &_pool.acquire(resource.description);
+
+        Pass& pass = _passes[_order[i]];
+
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        if(pass.barriers) Renderer::setMemoryBarrier(pass.barriers);
+        #endif
+
+        _currentPass = _order[i];
+        if(pass.execute) pass.execute(resources);
+        _currentPass = -1;
+
+        /* Released right after the last use so subsequent passes can reuse
+           the memory */
+        for(Resource& resource: _resources) {
+            if(resource.last != Int(i) || !resource.target) continue;
+            _pool.release(*resource.target);
+            resource.target = nullptr;
+        }
+    }
+}
+
+void RenderGraph::clear() {
+    _resources.clear();
+    _passes.clear();
+    _order.clear();
+    _compiled = false;
+}
+
+bool RenderGraph::isUsedByCurrentPass(const UnsignedInt resource) const {
+    if(_currentPass == -1) return false;
+    for(const ResourceAccess& a: _passes[_currentPass].accesses)
+        if(a.resource == resource) return true;
+    return false;
+}
+
+}
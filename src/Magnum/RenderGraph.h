@@ -0,0 +1,416 @@
+#ifndef Magnum_RenderGraph_h
+#define Magnum_RenderGraph_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::RenderGraph
+ */
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Magnum/RenderTargetPool.h"
+#include "Magnum/Renderer.h"
+
+namespace Magnum {
+
+/**
+@brief Render graph
+
+Composes a frame out of passes that declare which resources they read and
+write. The graph then culls passes that don't contribute to any output,
+orders the rest, allocates transient render targets from a
+@ref RenderTargetPool only for the time they are used and inserts memory
+barriers between incoherent writes and subsequent reads.
+@code
+RenderTargetPool pool;
+RenderGraph graph{pool};
+
+const Vector2i size = defaultFramebuffer.viewport().size();
+UnsignedInt shadowMap = graph.importTexture("shadow map", shadowTexture);
+UnsignedInt scene = graph.addTransient("scene", {size, TextureFormat::RGBA16F, TextureFormat::DepthComponent24});
+UnsignedInt screen = graph.importFramebuffer("screen", defaultFramebuffer);
+graph.setOutput(screen);
+
+UnsignedInt shadow = graph.addPass("shadow", [&](RenderGraph::PassResources&) {
+    shadowFramebuffer.bind();
+    // render shadow casters...
+});
+graph.write(shadow, shadowMap);
+
+UnsignedInt forward = graph.addPass("forward", [&](RenderGraph::PassResources& resources) {
+    resources.framebuffer(scene).clear(FramebufferClear::Color|FramebufferClear::Depth).bind();
+    phong.setShadowTexture(resources.texture(shadowMap));
+    // render the scene...
+});
+graph.read(forward, shadowMap)
+    .write(forward, scene);
+
+UnsignedInt tonemap = graph.addPass("tonemap", [&](RenderGraph::PassResources& resources) {
+    resources.framebuffer(screen).bind();
+    tonemapShader.setTexture(resources.texture(scene));
+    // draw fullscreen triangle...
+});
+graph.read(tonemap, scene)
+    .write(tonemap, screen);
+
+graph.compile();
+
+// each frame
+graph.execute();
+pool.nextFrame();
+@endcode
+
+## Resources
+
+Transient resources added with @ref addTransient() are taken from the pool
+right before the first pass using them and released right after the last
+one, so transient resources with disjoint lifetimes share the same memory.
+Imported resources added with @ref importTexture() and @ref importFramebuffer()
+are owned by the application and live across frames.
+
+Transient resources can be accessed in any way. Imported textures can be
+accessed only with @ref Access::Sampled and @ref Access::Image, imported
+framebuffers only with @ref Access::Attachment and @ref Access::Blit.
+
+## Culling and ordering
+
+Only passes that write a resource marked with @ref setOutput() and,
+recursively, passes that write resources read or written by these are kept,
+the other passes are culled. The kept passes are then ordered so that every
+pass reading a resource comes after the last pass declared before it that
+writes the resource and every pass writing a resource comes after all passes
+accessing it declared before. If a resource is read by a pass declared before
+any pass writing it, the read depends on the first writer. Otherwise the
+declaration order is kept.
+
+## Memory barriers
+
+Writes done with @ref Access::Image are not coherent with subsequent reads,
+so before a pass accessing such resource the graph calls
+@ref Renderer::setMemoryBarrier() with @ref Renderer::MemoryBarrier::TextureFetch,
+@ref Renderer::MemoryBarrier::ShaderImageAccess or
+@ref Renderer::MemoryBarrier::Framebuffer, depending on how the resource is
+accessed. Other writes don't need any barrier.
+
+@see @ref AbstractFramebuffer::blit()
+*/
+class MAGNUM_EXPORT RenderGraph {
+    public:
+        /**
+         * @brief Resource access
+         *
+         * @see @ref read(), @ref write()
+         */
+        enum class Access: UnsignedByte {
+            /** Sampled in a shader */
+            Sampled,
+
+            /** Rendered to or depth-tested against as framebuffer attachment */
+            Attachment,
+
+            /**
+             * Accessed with shader image load/store
+             * @requires_gl42 Extension @extension{ARB,shader_image_load_store}
+             * @requires_gles31 Shader image load/store is not available in
+             *      OpenGL ES 3.0 and older.
+             * @requires_gles Shader image load/store is not available in
+             *      WebGL.
+             */
+            Image,
+
+            /** Blitted from or to, read with @ref AbstractFramebuffer::read() */
+            Blit
+        };
+
+        /**
+         * @brief Resources available to a pass
+         *
+         * Passed to the pass execution function.
+         */
+        class MAGNUM_EXPORT PassResources {
+            friend RenderGraph;
+
+            public:
+                /**
+                 * @brief Framebuffer of given resource
+                 *
+                 * Expects that the resource is a transient resource or an
+                 * imported framebuffer and that it's used by the pass.
+                 */
+                AbstractFramebuffer& framebuffer(UnsignedInt resource);
+
+                /**
+                 * @brief Color texture of given resource
+                 *
+                 * Expects that the resource is a non-multisampled transient
+                 * resource with color attachment or an imported texture and
+                 * that it's used by the pass.
+                 */
+                Texture2D& texture(UnsignedInt resource);
+
+                /**
+                 * @brief Depth texture of given resource
+                 *
+                 * Expects that the resource is a non-multisampled transient
+                 * resource with depth attachment and that it's used by the
+                 * pass.
+                 */
+                Texture2D& depthTexture(UnsignedInt resource);
+
+            private:
+                explicit PassResources(RenderGraph& graph): _graph(graph) {}
+
+                RenderGraph& _graph;
+        };
+
+        /**
+         * @brief Constructor
+         * @param pool      Pool from which transient resources are taken
+         *
+         * The pool is expected to be alive for the whole lifetime of the
+         * graph.
+         */
+        explicit RenderGraph(RenderTargetPool& pool);
+
+        /** @brief Copying is not allowed */
+        RenderGraph(const RenderGraph&) = delete;
+
+        /** @brief Moving is not allowed */
+        RenderGraph(RenderGraph&&) = delete;
+
+        ~RenderGraph();
+
+        /** @brief Copying is not allowed */
+        RenderGraph& operator=(const RenderGraph&) = delete;
+
+        /** @brief Moving is not allowed */
+        RenderGraph& operator=(RenderGraph&&) = delete;
+
+        /** @brief Render target pool */
+        RenderTargetPool& pool() { return _pool; }
+
+        /** @brief Resource count */
+        std::size_t resourceCount() const { return _resources.size(); }
+
+        /** @brief Pass count */
+        std::size_t passCount() const { return _passes.size(); }
+
+        /**
+         * @brief Add a transient resource
+         * @return Resource ID
+         *
+         * @see @ref RenderTargetPool::acquire()
+         */
+        UnsignedInt addTransient(std::string name, const RenderTargetPool::Description& description);
+
+        /**
+         * @brief Import a texture
+         * @return Resource ID
+         *
+         * The texture is expected to be alive for the whole lifetime of the
+         * graph.
+         */
+        UnsignedInt importTexture(std::string name, Texture2D& texture);
+
+        /**
+         * @brief Import a framebuffer
+         * @return Resource ID
+         *
+         * The framebuffer, for example @ref defaultFramebuffer, is expected
+         * to be alive for the whole lifetime of the graph.
+         */
+        UnsignedInt importFramebuffer(std::string name, AbstractFramebuffer& framebuffer);
+
+        /**
+         * @brief Find a resource by name
+         *
+         * Expects that a resource with given name exists.
+         */
+        UnsignedInt resource(const std::string& name) const;
+
+        /** @brief Resource name */
+        const std::string& resourceName(UnsignedInt resource) const;
+
+        /**
+         * @brief Mark a resource as an output
+         * @return Reference to self (for method chaining)
+         *
+         * Passes writing output resources are never culled.
+         */
+        RenderGraph& setOutput(UnsignedInt resource);
+
+        /**
+         * @brief Add a pass
+         * @param name      Pass name
+         * @param execute   Function executing the pass
+         * @return Pass ID
+         *
+         * Use @ref read() and @ref write() to declare resources used by the
+         * pass.
+         */
+        UnsignedInt addPass(std::string name, std::function<void(PassResources&)> execute);
+
+        #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+        /**
+         * @brief Add a blit pass
+         * @return Pass ID
+         *
+         * Adds a pass that blits the whole viewport of @p source to the whole
+         * viewport of @p destination, reading @p source and writing
+         * @p destination with @ref Access::Blit. Useful for resolving
+         * multisampled targets.
+         * @see @ref AbstractFramebuffer::blit()
+         * @requires_gles30 Extension @es_extension{ANGLE,framebuffer_blit} or
+         *      @es_extension{NV,framebuffer_blit} in OpenGL ES 2.0.
+         * @requires_webgl20 Framebuffer blit is not available in WebGL 1.0.
+         */
+        UnsignedInt addBlitPass(std::string name, UnsignedInt source, UnsignedInt destination, FramebufferBlitMask mask, FramebufferBlitFilter filter = FramebufferBlitFilter::Nearest);
+        #endif
+
+        /** @brief Pass name */
+        const std::string& passName(UnsignedInt pass) const;
+
+        /**
+         * @brief Declare a resource read
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the access is allowed for given resource type.
+         */
+        RenderGraph& read(UnsignedInt pass, UnsignedInt resource, Access access = Access::Sampled);
+
+        /**
+         * @brief Declare a resource write
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the access is allowed for given resource type and
+         * that it's not @ref Access::Sampled.
+         */
+        RenderGraph& write(UnsignedInt pass, UnsignedInt resource, Access access = Access::Attachment);
+
+        /**
+         * @brief Compile the graph
+         *
+         * Culls and orders the passes, computes lifetimes of transient
+         * resources and memory barriers. Prints a message to error output and
+         * returns `false` if the passes have cyclic dependencies. Any
+         * subsequent modification of the graph makes it uncompiled again.
+         */
+        bool compile();
+
+        /** @brief Whether the graph is compiled */
+        bool isCompiled() const { return _compiled; }
+
+        /**
+         * @brief Pass execution order
+         *
+         * IDs of passes that weren't culled, in the order they are executed.
+         * Expects that the graph is compiled.
+         */
+        const std::vector<UnsignedInt>& passOrder() const;
+
+        /**
+         * @brief Whether a pass is culled
+         *
+         * Expects that the graph is compiled.
+         */
+        bool isPassCulled(UnsignedInt pass) const;
+
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        /**
+         * @brief Memory barriers issued before a pass
+         *
+         * Expects that the graph is compiled.
+         * @requires_gl42 Extension @extension{ARB,shader_image_load_store}
+         * @requires_gles31 Shader image load/store is not available in OpenGL
+         *      ES 3.0 and older.
+         * @requires_gles Shader image load/store is not available in WebGL.
+         */
+        Renderer::MemoryBarriers passMemoryBarriers(UnsignedInt pass) const;
+        #endif
+
+        /**
+         * @brief Execute the graph
+         *
+         * Executes the passes in @ref passOrder(), acquiring transient
+         * resources before their first use, issuing memory barriers and
+         * releasing the transient resources after their last use. Expects
+         * that the graph is compiled.
+         */
+        void execute();
+
+        /**
+         * @brief Clear the graph
+         *
+         * Removes all passes and resources, useful for rebuilding the graph
+         * every frame.
+         */
+        void clear();
+
+    private:
+        /* Transient if both texture and framebuffer are null */
+        struct Resource {
+            std::string name;
+            RenderTargetPool::Description description;
+            Texture2D* texture;
+            AbstractFramebuffer* framebuffer;
+            RenderTargetPool::Target* target;
+            /* Position of first and last use in _order, -1 if not used */
+            Int first, last;
+            bool output;
+        };
+
+        struct ResourceAccess {
+            UnsignedInt resource;
+            Access access;
+            bool write;
+        };
+
+        struct Pass {
+            std::string name;
+            std::function<void(PassResources&)> execute;
+            std::vector<ResourceAccess> accesses;
+            bool culled;
+            #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+            Renderer::MemoryBarriers barriers;
+            #endif
+        };
+
+        MAGNUM_LOCAL RenderGraph& access(UnsignedInt pass, UnsignedInt resource, Access access, bool write);
+        MAGNUM_LOCAL bool isUsedByCurrentPass(UnsignedInt resource) const;
+
+        RenderTargetPool& _pool;
+        std::vector<Resource> _resources;
+        std::vector<Pass> _passes;
+        std::vector<UnsignedInt> _order;
+        Int _currentPass;
+        bool _compiled;
+};
+
+}
+
+#endif
@@ -0,0 +1,112 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "RenderState.h"
+
+#include <atomic>
+
+namespace Magnum {
+
+namespace {
+    /* IDs are assigned from any thread, 0 is reserved for unknown state */
+    std::atomic<UnsignedInt> nextId{1};
+}
+
+RenderState::RenderState(const Blend& blend, const Depth& depth, const Raster& raster, const Stencil& stencil): _id{nextId++}, _blend(blend), _depth(depth), _raster(raster), _stencil(stencil) {}
+
+void RenderState::apply() const {
+    Renderer::setFeature(Renderer::Feature::Blending, _blend.enabled);
+    if(_blend.enabled) {
+        Renderer::setBlendEquation(_blend.rgbEquation, _blend.alphaEquation);
+        Renderer::setBlendFunction(_blend.sourceRgb, _blend.destinationRgb, _blend.sourceAlpha, _blend.destinationAlpha);
+    }
+
+    /* Write masks affect also framebuffer clearing, so they are applied
+       even if the corresponding test is disabled */
+    Renderer::setFeature(Renderer::Feature::DepthTest, _depth.test);
+    if(_depth.test) Renderer::setDepthFunction(_depth.function);
+    Renderer::setDepthMask(_depth.write);
+
+    Renderer::setFeature(Renderer::Feature::FaceCulling, _raster.faceCulling);
+    if(_raster.faceCulling) Renderer::setFaceCullingMode(_raster.faceCullingMode);
+    Renderer::setFrontFace(_raster.frontFace);
+    Renderer::setFeature(Renderer::Feature::PolygonOffsetFill, _raster.polygonOffsetFill);
+    if(_raster.polygonOffsetFill) Renderer::setPolygonOffset(_raster.polygonOffsetFactor, _raster.polygonOffsetUnits);
+    Renderer::setColorMask(_raster.colorMask[0], _raster.colorMask[1], _raster.colorMask[2], _raster.colorMask[3]);
+
+    Renderer::setFeature(Renderer::Feature::StencilTest, _stencil.test);
+    if(_stencil.test) {
+        Renderer::setStencilFunction(_stencil.function, _stencil.referenceValue, _stencil.mask);
+        Renderer::setStencilOperation(_stencil.stencilFail, _stencil.depthFail, _stencil.depthPass);
+    }
+    Renderer::setStencilMask(_stencil.writeMask);
+}
+
+bool operator==(const RenderState::Blend& a, const RenderState::Blend& b) {
+    return a.enabled == b.enabled &&
+        a.rgbEquation == b.rgbEquation &&
+        a.alphaEquation == b.alphaEquation &&
+        a.sourceRgb == b.sourceRgb &&
+        a.destinationRgb == b.destinationRgb &&
+        a.sourceAlpha == b.sourceAlpha &&
+        a.destinationAlpha == b.destinationAlpha;
+}
+
+bool operator==(const RenderState::Depth& a, const RenderState::Depth& b) {
+    return a.test == b.test &&
+        a.function == b.function &&
+        a.write == b.write;
+}
+
+bool operator==(const RenderState::Raster& a, const RenderState::Raster& b) {
+    return a.faceCulling == b.faceCulling &&
+        a.faceCullingMode == b.faceCullingMode &&
+        a.frontFace == b.frontFace &&
+        a.polygonOffsetFill == b.polygonOffsetFill &&
+        a.polygonOffsetFactor == b.polygonOffsetFactor &&
+        a.polygonOffsetUnits == b.polygonOffsetUnits &&
+        a.colorMask == b.colorMask;
+}
+
+bool operator==(const RenderState::Stencil& a, const RenderState::Stencil& b) {
+    return a.test == b.test &&
+        a.function == b.function &&
+        a.referenceValue == b.referenceValue &&
+        a.mask == b.mask &&
+        a.stencilFail == b.stencilFail &&
+        a.depthFail == b.depthFail &&
+        a.depthPass == b.depthPass &&
+        a.writeMask == b.writeMask;
+}
+
+bool operator==(const RenderState& a, const RenderState& b) {
+    return a.blend() == b.blend() &&
+        a.depth() == b.depth() &&
+        a.raster() == b.raster() &&
+        a.stencil() == b.stencil();
+}
+
+}
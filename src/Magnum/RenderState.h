@@ -0,0 +1,306 @@
+#ifndef Magnum_RenderState_h
+#define Magnum_RenderState_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::RenderState
+ */
+
+#include "Magnum/Renderer.h"
+#include "Magnum/Math/BoolVector.h"
+
+namespace Magnum {
+
+/**
+@brief Precompiled render state block
+
+Immutable description of blending, depth, rasterizer and stencil state
+needed for a draw, created once and applied with @ref apply() before every
+draw that needs it:
+@code
+const RenderState opaque{{}, RenderState::Depth{Renderer::DepthFunction::Less}};
+const RenderState transparent{
+    RenderState::Blend{Renderer::BlendFunction::SourceAlpha,
+                       Renderer::BlendFunction::OneMinusSourceAlpha},
+    RenderState::Depth{Renderer::DepthFunction::Less, false}};
+
+opaque.apply();
+// draw opaque meshes...
+
+transparent.apply();
+// draw transparent meshes...
+@endcode
+
+Each block describes the complete state of its part of the pipeline and
+default-constructed blocks correspond to the initial OpenGL state, so
+applying a state block always results in the same configuration,
+regardless of what was applied before.
+
+## State tracking
+
+The state is applied through @ref Renderer, so it is compared against the
+tracked renderer state and only the values that differ result in an OpenGL
+call. Switching between two state blocks thus costs only the calls needed to
+change the differing values, see @ref Renderer class documentation for
+details. The state block can be freely mixed with direct calls to
+@ref Renderer functions.
+
+## Sorting by render state
+
+Each state block has a unique @ref id(), which can be used for example in
+@ref SceneGraph::DrawState::renderState to make @ref SceneGraph::RenderQueue
+draw drawables sharing the same state together:
+@code
+drawable->setDrawState({shader.id(), textures.id(), mesh.id(), transparent.id()});
+@endcode
+
+The ID is shared by copies of the same block, two blocks created separately
+with the same values have different IDs, though. Use
+@ref operator==() to compare contents of the blocks.
+@see @ref Renderer::stateChangeCount()
+*/
+class MAGNUM_EXPORT RenderState {
+    public:
+        /**
+         * @brief Blend state
+         *
+         * @see @ref blend(), @ref Renderer::Feature::Blending,
+         *      @ref Renderer::setBlendEquation(),
+         *      @ref Renderer::setBlendFunction()
+         */
+        struct Blend {
+            /**
+             * @brief Constructor
+             *
+             * Blending disabled, the equation and functions are set to
+             * OpenGL defaults, which are @ref Renderer::BlendEquation::Add,
+             * @ref Renderer::BlendFunction::One for source and
+             * @ref Renderer::BlendFunction::Zero for destination.
+             */
+            constexpr /*implicit*/ Blend() noexcept: enabled{false}, rgbEquation{Renderer::BlendEquation::Add}, alphaEquation{Renderer::BlendEquation::Add}, sourceRgb{Renderer::BlendFunction::One}, destinationRgb{Renderer::BlendFunction::Zero}, sourceAlpha{Renderer::BlendFunction::One}, destinationAlpha{Renderer::BlendFunction::Zero} {}
+
+            /**
+             * @brief Construct with blending enabled
+             *
+             * Same function and equation is used for RGB and alpha.
+             */
+            constexpr explicit Blend(Renderer::BlendFunction source, Renderer::BlendFunction destination, Renderer::BlendEquation equation = Renderer::BlendEquation::Add) noexcept: enabled{true}, rgbEquation{equation}, alphaEquation{equation}, sourceRgb{source}, destinationRgb{destination}, sourceAlpha{source}, destinationAlpha{destination} {}
+
+            /** @brief Construct with blending enabled and separate RGB and alpha setup */
+            constexpr explicit Blend(Renderer::BlendFunction sourceRgb, Renderer::BlendFunction destinationRgb, Renderer::BlendFunction sourceAlpha, Renderer::BlendFunction destinationAlpha, Renderer::BlendEquation rgbEquation = Renderer::BlendEquation::Add, Renderer::BlendEquation alphaEquation = Renderer::BlendEquation::Add) noexcept: enabled{true}, rgbEquation{rgbEquation}, alphaEquation{alphaEquation}, sourceRgb{sourceRgb}, destinationRgb{destinationRgb}, sourceAlpha{sourceAlpha}, destinationAlpha{destinationAlpha} {}
+
+            bool enabled;                           /**< @brief Whether blending is enabled */
+            Renderer::BlendEquation rgbEquation;    /**< @brief RGB blend equation */
+            Renderer::BlendEquation alphaEquation;  /**< @brief Alpha blend equation */
+            Renderer::BlendFunction sourceRgb;      /**< @brief RGB source function */
+            Renderer::BlendFunction destinationRgb; /**< @brief RGB destination function */
+            Renderer::BlendFunction sourceAlpha;    /**< @brief Alpha source function */
+            Renderer::BlendFunction destinationAlpha; /**< @brief Alpha destination function */
+        };
+
+        /**
+         * @brief Depth state
+         *
+         * @see @ref depth(), @ref Renderer::Feature::DepthTest,
+         *      @ref Renderer::setDepthFunction(),
+         *      @ref Renderer::setDepthMask()
+         */
+        struct Depth {
+            /**
+             * @brief Constructor
+             *
+             * Depth test disabled, depth function set to
+             * @ref Renderer::DepthFunction::Less and depth writes enabled.
+             */
+            constexpr /*implicit*/ Depth() noexcept: test{false}, function{Renderer::DepthFunction::Less}, write{true} {}
+
+            /** @brief Construct with depth test enabled */
+            constexpr explicit Depth(Renderer::DepthFunction function, bool write = true) noexcept: test{true}, function{function}, write{write} {}
+
+            bool test;                          /**< @brief Whether depth test is enabled */
+            Renderer::DepthFunction function;   /**< @brief Depth function */
+            bool write;                         /**< @brief Whether depth writes are enabled */
+        };
+
+        /**
+         * @brief Rasterizer state
+         *
+         * @see @ref raster(), @ref Renderer::Feature::FaceCulling,
+         *      @ref Renderer::setFaceCullingMode(),
+         *      @ref Renderer::setFrontFace(),
+         *      @ref Renderer::Feature::PolygonOffsetFill,
+         *      @ref Renderer::setPolygonOffset(),
+         *      @ref Renderer::setColorMask()
+         */
+        struct Raster {
+            /**
+             * @brief Constructor
+             *
+             * Face culling and polygon offset disabled, culling mode set to
+             * @ref Renderer::PolygonFacing::Back, front face to
+             * @ref Renderer::FrontFace::CounterClockWise, polygon offset to
+             * zero and all color channels writable.
+             */
+            constexpr /*implicit*/ Raster() noexcept: faceCulling{false}, faceCullingMode{Renderer::PolygonFacing::Back}, frontFace{Renderer::FrontFace::CounterClockWise}, polygonOffsetFill{false}, polygonOffsetFactor{0.0f}, polygonOffsetUnits{0.0f}, colorMask{0x0f} {}
+
+            /** @brief Construct with face culling enabled */
+            constexpr explicit Raster(Renderer::PolygonFacing faceCullingMode, Renderer::FrontFace frontFace = Renderer::FrontFace::CounterClockWise) noexcept: faceCulling{true}, faceCullingMode{faceCullingMode}, frontFace{frontFace}, polygonOffsetFill{false}, polygonOffsetFactor{0.0f}, polygonOffsetUnits{0.0f}, colorMask{0x0f} {}
+
+            bool faceCulling;                       /**< @brief Whether face culling is enabled */
+            Renderer::PolygonFacing faceCullingMode; /**< @brief Culled faces */
+            Renderer::FrontFace frontFace;          /**< @brief Front face */
+            bool polygonOffsetFill;                 /**< @brief Whether polygon offset for filled polygons is enabled */
+            Float polygonOffsetFactor;              /**< @brief Polygon offset scale factor */
+            Float polygonOffsetUnits;               /**< @brief Polygon offset units */
+
+            /**
+             * @brief Color mask
+             *
+             * Bit @cpp 0 @ce, @cpp 1 @ce, @cpp 2 @ce and @cpp 3 @ce
+             * enables writes to red, green, blue and alpha channel.
+             */
+            Math::BoolVector<4> colorMask;
+        };
+
+        /**
+         * @brief Stencil state
+         *
+         * The same setup is used for both front- and back-facing polygons.
+         * @see @ref stencil(), @ref Renderer::Feature::StencilTest,
+         *      @ref Renderer::setStencilFunction(),
+         *      @ref Renderer::setStencilOperation(),
+         *      @ref Renderer::setStencilMask()
+         */
+        struct Stencil {
+            /**
+             * @brief Constructor
+             *
+             * Stencil test disabled, function set to
+             * @ref Renderer::StencilFunction::Always with reference value
+             * @cpp 0 @ce and all bits set in the mask, all operations set to
+             * @ref Renderer::StencilOperation::Keep and writes allowed for
+             * all bits.
+             */
+            constexpr /*implicit*/ Stencil() noexcept: test{false}, function{Renderer::StencilFunction::Always}, referenceValue{0}, mask{0xffffffffu}, stencilFail{Renderer::StencilOperation::Keep}, depthFail{Renderer::StencilOperation::Keep}, depthPass{Renderer::StencilOperation::Keep}, writeMask{0xffffffffu} {}
+
+            /** @brief Construct with stencil test enabled */
+            constexpr explicit Stencil(Renderer::StencilFunction function, Int referenceValue, UnsignedInt mask, Renderer::StencilOperation stencilFail, Renderer::StencilOperation depthFail, Renderer::StencilOperation depthPass, UnsignedInt writeMask = 0xffffffffu) noexcept: test{true}, function{function}, referenceValue{referenceValue}, mask{mask}, stencilFail{stencilFail}, depthFail{depthFail}, depthPass{depthPass}, writeMask{writeMask} {}
+
+            bool test;                          /**< @brief Whether stencil test is enabled */
+            Renderer::StencilFunction function; /**< @brief Stencil function */
+            Int referenceValue;                 /**< @brief Reference value */
+            UnsignedInt mask;                   /**< @brief Mask for both the reference and buffer value */
+            Renderer::StencilOperation stencilFail; /**< @brief Operation when the stencil test fails */
+            Renderer::StencilOperation depthFail;   /**< @brief Operation when the depth test fails */
+            Renderer::StencilOperation depthPass;   /**< @brief Operation when both tests pass */
+            UnsignedInt writeMask;              /**< @brief Allowed stencil bits for writing */
+        };
+
+        /**
+         * @brief Constructor
+         *
+         * Assigns a new unique @ref id() to the block. Blocks that are not
+         * specified are set to the initial OpenGL state.
+         */
+        explicit RenderState(const Blend& blend = {}, const Depth& depth = {}, const Raster& raster = {}, const Stencil& stencil = {});
+
+        /**
+         * @brief Unique ID
+         *
+         * Never @cpp 0 @ce, so it can be used in sort keys where @cpp 0 @ce
+         * means unknown state.
+         */
+        UnsignedInt id() const { return _id; }
+
+        /** @brief Blend state */
+        const Blend& blend() const { return _blend; }
+
+        /** @brief Depth state */
+        const Depth& depth() const { return _depth; }
+
+        /** @brief Rasterizer state */
+        const Raster& raster() const { return _raster; }
+
+        /** @brief Stencil state */
+        const Stencil& stencil() const { return _stencil; }
+
+        /**
+         * @brief Apply the state
+         *
+         * Sets all state described by the block, the calls that would set
+         * the state to already tracked value are skipped.
+         * @see @ref Renderer::stateChangeCount(),
+         *      @ref Renderer::skippedStateChangeCount()
+         */
+        void apply() const;
+
+    private:
+        UnsignedInt _id;
+        Blend _blend;
+        Depth _depth;
+        Raster _raster;
+        Stencil _stencil;
+};
+
+/** @relatesalso RenderState::Blend
+@brief Equality comparison
+*/
+MAGNUM_EXPORT bool operator==(const RenderState::Blend& a, const RenderState::Blend& b);
+
+/** @relatesalso RenderState::Depth
+@brief Equality comparison
+*/
+MAGNUM_EXPORT bool operator==(const RenderState::Depth& a, const RenderState::Depth& b);
+
+/** @relatesalso RenderState::Raster
+@brief Equality comparison
+*/
+MAGNUM_EXPORT bool operator==(const RenderState::Raster& a, const RenderState::Raster& b);
+
+/** @relatesalso RenderState::Stencil
+@brief Equality comparison
+*/
+MAGNUM_EXPORT bool operator==(const RenderState::Stencil& a, const RenderState::Stencil& b);
+
+/** @relatesalso RenderState
+@brief Equality comparison
+
+Compares contents of all the blocks, ignoring @ref RenderState::id().
+*/
+MAGNUM_EXPORT bool operator==(const RenderState& a, const RenderState& b);
+
+/** @relatesalso RenderState
+@brief Non-equality comparison
+
+Compares contents of all the blocks, ignoring @ref RenderState::id().
+*/
+inline bool operator!=(const RenderState& a, const RenderState& b) {
+    return !operator==(a, b);
+}
+
+}
+
+#endif
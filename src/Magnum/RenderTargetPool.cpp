@@ -0,0 +1,230 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "RenderTargetPool.h"
+
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/RenderbufferFormat.h"
+
+namespace Magnum {
+
+namespace {
+
+bool isDepthStencil(const TextureFormat format) {
+    return format == TextureFormat::DepthStencil
+        #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+        || format == TextureFormat::Depth24Stencil8
+        #endif
+        #ifndef MAGNUM_TARGET_GLES2
+        || format == TextureFormat::Depth32FStencil8
+        #endif
+        ;
+}
+
+template<class T> void attachDepth(Framebuffer& framebuffer, T& attachment, const bool stencil);
+
+template<> void attachDepth(Framebuffer& framebuffer, Texture2D& texture, const bool stencil) {
+    #if !defined(MAGNUM_TARGET_GLES2) || defined(MAGNUM_TARGET_WEBGL)
+    if(stencil) {
+        framebuffer.attachTexture(Framebuffer::BufferAttachment::DepthStencil, texture, 0);
+        return;
+    }
+    #endif
+
+    framebuffer.attachTexture(Framebuffer::BufferAttachment::Depth, texture, 0);
+
+    /* Combined attachment is not available on ES2, attach the texture to
+       both */
+    #if defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(stencil) framebuffer.attachTexture(Framebuffer::BufferAttachment::Stencil, texture, 0);
+    #endif
+}
+
+#if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+template<> void attachDepth(Framebuffer& framebuffer, Renderbuffer& renderbuffer, const bool stencil) {
+    #ifndef MAGNUM_TARGET_GLES2
+    if(stencil) {
+        framebuffer.attachRenderbuffer(Framebuffer::BufferAttachment::DepthStencil, renderbuffer);
+        return;
+    }
+    #endif
+
+    framebuffer.attachRenderbuffer(Framebuffer::BufferAttachment::Depth, renderbuffer);
+
+    #ifdef MAGNUM_TARGET_GLES2
+    if(stencil) framebuffer.attachRenderbuffer(Framebuffer::BufferAttachment::Stencil, renderbuffer);
+    #endif
+}
+#endif
+
+}
+
+RenderTargetPool::Target::Target(const Description& description): _description{description}, _framebuffer{{{}, description.size}}, _color{NoCreate}, _depth{NoCreate},
+    #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+    _colorRenderbuffer{NoCreate}, _depthRenderbuffer{NoCreate},
+    #endif
+    _lastUsedFrame{}, _acquired{}
+{
+    const bool stencil = isDepthStencil(description.depthFormat);
+
+    #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+    if(description.samples) {
+        if(description.colorFormat != TextureFormat{}) {
+            _colorRenderbuffer = Renderbuffer{};
+            _colorRenderbuffer.setStorageMultisample(description.samples, RenderbufferFormat(GLenum(description.colorFormat)), description.size);
+            _framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment{0}, _colorRenderbuffer);
+        }
+
+        if(description.depthFormat != TextureFormat{}) {
+            _depthRenderbuffer = Renderbuffer{};
+            _depthRenderbuffer.setStorageMultisample(description.samples, RenderbufferFormat(GLenum(description.depthFormat)), description.size);
+            attachDepth(_framebuffer, _depthRenderbuffer, stencil);
+        }
+
+        return;
+    }
+    #endif
+
+    if(description.colorFormat != TextureFormat{}) {
+        _color = Texture2D{};
+        _color.setMinificationFilter(Sampler::Filter::Linear)
+            .setMagnificationFilter(Sampler::Filter::Linear)
+            .setWrapping(Sampler::Wrapping::ClampToEdge)
+            .setStorage(1, description.colorFormat, description.size);
+        _framebuffer.attachTexture(Framebuffer::ColorAttachment{0}, _color, 0);
+    }
+
+    if(description.depthFormat != TextureFormat{}) {
+        _depth = Texture2D{};
+        _depth.setMinificationFilter(Sampler::Filter::Nearest)
+            .setMagnificationFilter(Sampler::Filter::Nearest)
+            .setWrapping(Sampler::Wrapping::ClampToEdge)
+            .setStorage(1, description.depthFormat, description.size);
+        attachDepth(_framebuffer, _depth, stencil);
+    }
+}
+
+Texture2D& RenderTargetPool::Target::color() {
+    CORRADE_ASSERT(_color.id(),
+        "RenderTargetPool::Target::color(): the target has no color texture", _color);
+    return _color;
+}
+
+Texture2D& RenderTargetPool::Target::depth() {
+    CORRADE_ASSERT(_depth.id(),
+        "RenderTargetPool::Target::depth(): the target has no depth texture", _depth);
+    return _depth;
+}
+
+#if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+Renderbuffer& RenderTargetPool::Target::colorRenderbuffer() {
+    CORRADE_ASSERT(_colorRenderbuffer.id(),
+        "RenderTargetPool::Target::colorRenderbuffer(): the target has no color renderbuffer", _colorRenderbuffer);
+    return _colorRenderbuffer;
+}
+
+Renderbuffer& RenderTargetPool::Target::depthRenderbuffer() {
+    CORRADE_ASSERT(_depthRenderbuffer.id(),
+        "RenderTargetPool::Target::depthRenderbuffer(): the target has no depth renderbuffer", _depthRenderbuffer);
+    return _depthRenderbuffer;
+}
+#endif
+
+RenderTargetPool::RenderTargetPool(const UnsignedInt maxUnusedFrames): _maxUnusedFrames{maxUnusedFrames}, _frame{}, _createdCount{}, _acquiredCount{} {}
+
+RenderTargetPool::RenderTargetPool(RenderTargetPool&&) noexcept = default;
+
+RenderTargetPool::~RenderTargetPool() = default;
+
+RenderTargetPool& RenderTargetPool::operator=(RenderTargetPool&&) noexcept = default;
+
+RenderTargetPool::Target& RenderTargetPool::acquire(const Description& description) {
+    CORRADE_ASSERT(description.size.product() && (description.colorFormat != TextureFormat{} || description.depthFormat != TextureFormat{}),
+        "RenderTargetPool::acquire(): expected non-zero size and at least one attachment", *static_cast<Target*>(nullptr));
+
+    Target* found = nullptr;
+    for(std::unique_ptr<Target>& target: _targets) {
+        if(target->_acquired || target->_description != description) continue;
+        found = target.get();
+        break;
+    }
+
+    if(!found) {
+        _targets.emplace_back(new Target{description});
+        found = _targets.back().get();
+        ++_createdCount;
+    }
+
+    found->_acquired = true;
+    found->_lastUsedFrame = _frame;
+    ++_acquiredCount;
+    return *found;
+}
+
+void RenderTargetPool::release(Target& target) {
+    CORRADE_ASSERT(target._acquired,
+        "RenderTargetPool::release(): the target is not acquired", );
+
+    #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+    /* The contents are not needed anymore, tile-based GPUs can skip writing
+       them back to memory */
+    const bool color = target._description.colorFormat != TextureFormat{};
+    const bool depth = target._description.depthFormat != TextureFormat{};
+    const bool stencil = isDepthStencil(target._description.depthFormat);
+    if(color && stencil)
+        target._framebuffer.invalidate({Framebuffer::ColorAttachment{0}, Framebuffer::InvalidationAttachment::Depth, Framebuffer::InvalidationAttachment::Stencil});
+    else if(color && depth)
+        target._framebuffer.invalidate({Framebuffer::ColorAttachment{0}, Framebuffer::InvalidationAttachment::Depth});
+    else if(color)
+        target._framebuffer.invalidate({Framebuffer::ColorAttachment{0}});
+    else if(stencil)
+        target._framebuffer.invalidate({Framebuffer::InvalidationAttachment::Depth, Framebuffer::InvalidationAttachment::Stencil});
+    else
+        target._framebuffer.invalidate({Framebuffer::InvalidationAttachment::Depth});
+    #endif
+
+    target._acquired = false;
+    target._lastUsedFrame = _frame;
+    --_acquiredCount;
+}
+
+void RenderTargetPool::nextFrame() {
+    /* Delete targets not used for too long, keeping the order of the
+       remaining ones */
+    std::size_t out = 0;
+    for(std::size_t i = 0; i != _targets.size(); ++i) {
+        if(!_targets[i]->_acquired && _frame - _targets[i]->_lastUsedFrame >= _maxUnusedFrames)
+            continue;
+        if(out != i) _targets[out] = std::move(_targets[i]);
+        ++out;
+    }
+    _targets.resize(out);
+
+    ++_frame;
+}
+
+}
@@ -0,0 +1,302 @@
+#ifndef Magnum_RenderTargetPool_h
+#define Magnum_RenderTargetPool_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::RenderTargetPool
+ */
+
+#include <memory>
+#include <vector>
+
+#include "Magnum/Framebuffer.h"
+#include "Magnum/Renderbuffer.h"
+#include "Magnum/Texture.h"
+#include "Magnum/TextureFormat.h"
+
+namespace Magnum {
+
+/**
+@brief Pool of transient render targets
+
+Post-processing chains and multi-pass renderers need a lot of intermediate
+framebuffers that live only for a part of the frame. Instead of keeping a
+@ref Framebuffer with its textures for each pass and reallocating all of them
+on every viewport resize, the passes can take the targets from a pool:
+@code
+RenderTargetPool pool;
+
+// each frame
+const Vector2i size = defaultFramebuffer.viewport().size();
+RenderTargetPool::Target& scene = pool.acquire({size, TextureFormat::RGBA8, TextureFormat::DepthComponent24});
+scene.framebuffer().bind();
+// render the scene...
+
+RenderTargetPool::Target& blurred = pool.acquire({size, TextureFormat::RGBA8});
+blurred.framebuffer().bind();
+blurShader.setTexture(scene.color());
+// draw fullscreen triangle...
+
+pool.release(scene);
+
+// the same textures as "scene" are reused for this target
+RenderTargetPool::Target& bloom = pool.acquire({size, TextureFormat::RGBA8, TextureFormat::DepthComponent24});
+// ...
+
+pool.release(blurred);
+pool.release(bloom);
+pool.nextFrame();
+@endcode
+
+@ref acquire() returns a released target with the same @ref Description,
+creating a new one only if there's no such target free. The lifetime of a
+target is thus given by the @ref acquire() and @ref release() calls and
+targets with disjoint lifetimes share the same memory. @ref release()
+invalidates all attachments of the framebuffer using
+@ref Framebuffer::invalidate(), so tile-based GPUs don't need to write their
+contents back to the memory. @ref nextFrame() deletes targets that weren't
+used for more than @ref maxUnusedFrames() frames, so the targets of the
+previous size get freed after a resize.
+
+The references returned from @ref acquire() are stable until the target is
+deleted by @ref nextFrame() or by the pool destruction.
+@see @ref Framebuffer, @ref Texture2D, @ref Renderbuffer
+*/
+class MAGNUM_EXPORT RenderTargetPool {
+    public:
+        /**
+         * @brief Render target description
+         *
+         * If @ref samples is `0`, the attachments are @ref Texture2D "Texture2D"
+         * instances with a single mip level and can be sampled in later
+         * passes. Otherwise they are multisampled @ref Renderbuffer
+         * instances, meant to be resolved to a single-sampled target using
+         * @ref AbstractFramebuffer::blit(). In that case the formats are
+         * used as @ref RenderbufferFormat, so they have to be valid for both.
+         */
+        struct Description {
+            /**
+             * @brief Constructor
+             * @param size          Target size
+             * @param colorFormat   Format of color attachment `0`. Use
+             *      @cpp TextureFormat{} @ce for no color attachment.
+             * @param depthFormat   Format of depth attachment. Use
+             *      @cpp TextureFormat{} @ce for no depth attachment. Depth
+             *      and stencil formats are attached also to the stencil
+             *      attachment.
+             * @param samples       Sample count, `0` for non-multisampled
+             *      target
+             */
+            constexpr /*implicit*/ Description(const Vector2i& size, TextureFormat colorFormat, TextureFormat depthFormat = TextureFormat{}, Int samples = 0): size{size}, colorFormat{colorFormat}, depthFormat{depthFormat}, samples{samples} {}
+
+            Vector2i size;              /**< @brief Target size */
+            TextureFormat colorFormat;  /**< @brief Color attachment format */
+            TextureFormat depthFormat;  /**< @brief Depth attachment format */
+            Int samples;                /**< @brief Sample count */
+
+            /** @brief Equality comparison */
+            bool operator==(const Description& other) const {
+                return size == other.size && colorFormat == other.colorFormat && depthFormat == other.depthFormat && samples == other.samples;
+            }
+
+            /** @brief Non-equality comparison */
+            bool operator!=(const Description& other) const {
+                return !operator==(other);
+            }
+        };
+
+        /**
+         * @brief Render target
+         *
+         * Created only through @ref acquire().
+         */
+        class MAGNUM_EXPORT Target {
+            friend RenderTargetPool;
+
+            public:
+                /** @brief Copying is not allowed */
+                Target(const Target&) = delete;
+
+                /** @brief Moving is not allowed */
+                Target(Target&&) = delete;
+
+                /** @brief Copying is not allowed */
+                Target& operator=(const Target&) = delete;
+
+                /** @brief Moving is not allowed */
+                Target& operator=(Target&&) = delete;
+
+                /** @brief Target description */
+                const Description& description() const { return _description; }
+
+                /**
+                 * @brief Framebuffer
+                 *
+                 * The viewport covers the whole target.
+                 */
+                Framebuffer& framebuffer() { return _framebuffer; }
+
+                /**
+                 * @brief Color texture
+                 *
+                 * Expects that the target has a color attachment and isn't
+                 * multisampled.
+                 */
+                Texture2D& color();
+
+                /**
+                 * @brief Depth texture
+                 *
+                 * Expects that the target has a depth attachment and isn't
+                 * multisampled.
+                 */
+                Texture2D& depth();
+
+                #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+                /**
+                 * @brief Multisampled color renderbuffer
+                 *
+                 * Expects that the target has a color attachment and is
+                 * multisampled.
+                 * @requires_gles30 Extension @es_extension{ANGLE,framebuffer_multisample}
+                 *      or @es_extension{NV,framebuffer_multisample} in OpenGL
+                 *      ES 2.0.
+                 * @requires_webgl20 Multisample framebuffers are not
+                 *      available in WebGL 1.0.
+                 */
+                Renderbuffer& colorRenderbuffer();
+
+                /**
+                 * @brief Multisampled depth renderbuffer
+                 *
+                 * Expects that the target has a depth attachment and is
+                 * multisampled.
+                 * @requires_gles30 Extension @es_extension{ANGLE,framebuffer_multisample}
+                 *      or @es_extension{NV,framebuffer_multisample} in OpenGL
+                 *      ES 2.0.
+                 * @requires_webgl20 Multisample framebuffers are not
+                 *      available in WebGL 1.0.
+                 */
+                Renderbuffer& depthRenderbuffer();
+                #endif
+
+                /** @brief Whether the target is acquired */
+                bool isAcquired() const { return _acquired; }
+
+            private:
+                explicit Target(const Description& description);
+
+                Description _description;
+                Framebuffer _framebuffer;
+                Texture2D _color, _depth;
+                #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+                Renderbuffer _colorRenderbuffer, _depthRenderbuffer;
+                #endif
+                UnsignedLong _lastUsedFrame;
+                bool _acquired;
+        };
+
+        /**
+         * @brief Constructor
+         * @param maxUnusedFrames   Count of frames after which an unused
+         *      target is deleted
+         *
+         * No target is created until the first @ref acquire().
+         */
+        explicit RenderTargetPool(UnsignedInt maxUnusedFrames = 2);
+
+        /** @brief Copying is not allowed */
+        RenderTargetPool(const RenderTargetPool&) = delete;
+
+        /** @brief Move constructor */
+        RenderTargetPool(RenderTargetPool&&) noexcept;
+
+        ~RenderTargetPool();
+
+        /** @brief Copying is not allowed */
+        RenderTargetPool& operator=(const RenderTargetPool&) = delete;
+
+        /** @brief Move assignment */
+        RenderTargetPool& operator=(RenderTargetPool&&) noexcept;
+
+        /** @brief Count of frames after which an unused target is deleted */
+        UnsignedInt maxUnusedFrames() const { return _maxUnusedFrames; }
+
+        /** @brief Count of targets in the pool */
+        std::size_t capacity() const { return _targets.size(); }
+
+        /** @brief Count of currently acquired targets */
+        std::size_t acquiredCount() const { return _acquiredCount; }
+
+        /**
+         * @brief Count of created targets
+         *
+         * Count of all targets created since the pool construction. If the
+         * value grows every frame, the targets aren't released early enough
+         * or their descriptions aren't stable.
+         */
+        UnsignedLong createdCount() const { return _createdCount; }
+
+        /**
+         * @brief Acquire a render target
+         *
+         * Returns a released target with the same description or creates a
+         * new one. The contents of the target are undefined, clear it or
+         * overwrite it fully before use. Expects that the size is non-zero
+         * and that the target has at least one attachment.
+         * @see @ref release()
+         */
+        Target& acquire(const Description& description);
+
+        /**
+         * @brief Release a render target
+         *
+         * Invalidates all attachments and makes the target available for
+         * subsequent @ref acquire() calls with the same description. Expects
+         * that the target is acquired.
+         * @see @ref Framebuffer::invalidate()
+         */
+        void release(Target& target);
+
+        /**
+         * @brief Advance to next frame
+         *
+         * Deletes released targets that weren't acquired during the last
+         * @ref maxUnusedFrames() frames. Targets that are acquired across
+         * frames, such as history buffers for temporal effects, are kept.
+         */
+        void nextFrame();
+
+    private:
+        UnsignedInt _maxUnusedFrames;
+        UnsignedLong _frame, _createdCount;
+        std::size_t _acquiredCount;
+        std::vector<std::unique_ptr<Target>> _targets;
+};
+
+}
+
+#endif
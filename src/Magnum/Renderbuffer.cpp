@@ -32,6 +32,7 @@
 #include "Implementation/DebugState.h"
 #endif
 #include "Implementation/FramebufferState.h"
+#include "Implementation/GpuMemoryState.h"
 #include "Implementation/State.h"
 
 namespace Magnum {
@@ -91,6 +92,7 @@ Renderbuffer::~Renderbuffer() {
     GLuint& binding = Context::current().state().framebuffer->renderbufferBinding;
     if(binding == _id) binding = 0;
 
+    Context::current().state().gpuMemory->remove(GpuMemory::Category::Renderbuffer, _id);
     glDeleteRenderbuffers(1, &_id);
 }
 
@@ -114,17 +116,20 @@ std::string Renderbuffer::label() {
 Renderbuffer& Renderbuffer::setLabelInternal(const Containers::ArrayView<const char> label) {
     createIfNotAlready();
     Context::current().state().debug->labelImplementation(GL_RENDERBUFFER, _id, label);
+    Context::current().state().gpuMemory->setLabel(GpuMemory::Category::Renderbuffer, _id, {label.data(), label.size()});
     return *this;
 }
 #endif
 
 void Renderbuffer::setStorage(const RenderbufferFormat internalFormat, const Vector2i& size) {
     (this->*Context::current().state().framebuffer->renderbufferStorageImplementation)(internalFormat, size);
+    Context::current().state().gpuMemory->setSize(GpuMemory::Category::Renderbuffer, _id, std::size_t(size.product())*Implementation::textureFormatBits(GLenum(internalFormat))/8);
 }
 
 #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
 void Renderbuffer::setStorageMultisample(const Int samples, const RenderbufferFormat internalFormat, const Vector2i& size) {
     (this->*Context::current().state().framebuffer->renderbufferStorageMultisampleImplementation)(samples, internalFormat, size);
+    Context::current().state().gpuMemory->setSize(GpuMemory::Category::Renderbuffer, _id, std::size_t(samples ? samples : 1)*size.product()*Implementation::textureFormatBits(GLenum(internalFormat))/8);
 }
 #endif
 
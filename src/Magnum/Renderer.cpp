@@ -35,12 +35,44 @@
 
 namespace Magnum {
 
+namespace {
+
+inline Implementation::RendererState::Shadow& shadow() {
+    return Context::current().state().renderer->shadow;
+}
+
+/* Updates the stencil state for all faces affected by given facing, returns
+   true if any of them differs and the GL call is needed */
+template<class T> bool updateStencil(const Renderer::PolygonFacing facing, std::optional<T> Implementation::RendererState::Shadow::StencilFace::*member, const T& value) {
+    Implementation::RendererState::Shadow& state = shadow();
+
+    bool needed = false;
+    for(std::size_t i = 0; i != 2; ++i) {
+        if(facing == (i == 0 ? Renderer::PolygonFacing::Back : Renderer::PolygonFacing::Front))
+            continue;
+
+        std::optional<T>& current = state.stencil[i].*member;
+        if(current && *current == value) continue;
+
+        current = value;
+        needed = true;
+    }
+
+    ++(needed ? state.issued : state.skipped);
+    if(state.commandObserver) state.commandObserver->record(CommandObserver::Command::RendererState, 0, 0, !needed);
+    return needed;
+}
+
+}
+
 void Renderer::enable(const Feature feature) {
-    glEnable(GLenum(feature));
+    if(shadow().updateFeature(GLenum(feature), true))
+        glEnable(GLenum(feature));
 }
 
 void Renderer::disable(const Feature feature) {
-    glDisable(GLenum(feature));
+    if(shadow().updateFeature(GLenum(feature), false))
+        glDisable(GLenum(feature));
 }
 
 void Renderer::setFeature(const Feature feature, const bool enabled) {
@@ -48,44 +80,62 @@ void Renderer::setFeature(const Feature feature, const bool enabled) {
 }
 
 void Renderer::setHint(const Hint target, const HintMode mode) {
-    glHint(GLenum(target), GLenum(mode));
+    if(shadow().updateHint(GLenum(target), GLenum(mode)))
+        glHint(GLenum(target), GLenum(mode));
 }
 
 void Renderer::setClearColor(const Color4& color) {
-    glClearColor(color.r(), color.g(), color.b(), color.a());
+    Implementation::RendererState::Shadow& state = shadow();
+    if(state.update(state.clearColor, color))
+        glClearColor(color.r(), color.g(), color.b(), color.a());
 }
 
 #ifndef MAGNUM_TARGET_GLES
 void Renderer::setClearDepth(const Double depth) {
-    glClearDepth(depth);
+    Implementation::RendererState::Shadow& state = shadow();
+    if(state.update(state.clearDepth, depth))
+        glClearDepth(depth);
 }
 #endif
 
 void Renderer::setClearDepth(Float depth) {
-    Context::current().state().renderer->clearDepthfImplementation(depth);
+    Implementation::RendererState& state = *Context::current().state().renderer;
+    if(state.shadow.update(state.shadow.clearDepth, Double(depth)))
+        state.clearDepthfImplementation(depth);
 }
 
 void Renderer::setClearStencil(const Int stencil) {
-    glClearStencil(stencil);
+    Implementation::RendererState::Shadow& state = shadow();
+    if(state.update(state.clearStencil, stencil))
+        glClearStencil(stencil);
 }
 
 void Renderer::setFrontFace(const FrontFace mode) {
-    glFrontFace(GLenum(mode));
+    Implementation::RendererState::Shadow& state = shadow();
+    if(state.update(state.frontFace, GLenum(mode)))
+        glFrontFace(GLenum(mode));
 }
 
 void Renderer::setFaceCullingMode(const PolygonFacing mode) {
-    glCullFace(GLenum(mode));
+    Implementation::RendererState::Shadow& state = shadow();
+    if(state.update(state.faceCullingMode, GLenum(mode)))
+        glCullFace(GLenum(mode));
 }
 
 #ifndef MAGNUM_TARGET_GLES
 void Renderer::setProvokingVertex(const ProvokingVertex mode) {
-    glProvokingVertex(GLenum(mode));
+    Implementation::RendererState::Shadow& state = shadow();
+    if(state.update(state.provokingVertex, GLenum(mode)))
+        glProvokingVertex(GLenum(mode));
 }
 #endif
 
 #ifndef MAGNUM_TARGET_WEBGL
 void Renderer::setPolygonMode(const PolygonMode mode) {
     #ifndef CORRADE_TARGET_NACL
+    Implementation::RendererState::Shadow& state = shadow();
+    if(!state.update(state.polygonMode, GLenum(mode))) return;
+
     #ifndef MAGNUM_TARGET_GLES
     glPolygonMode
     #else
@@ -100,82 +150,120 @@ void Renderer::setPolygonMode(const PolygonMode mode) {
 #endif
 
 void Renderer::setPolygonOffset(const Float factor, const Float units) {
-    glPolygonOffset(factor, units);
+    Implementation::RendererState::Shadow& state = shadow();
+    if(state.update(state.polygonOffset, Vector2{factor, units}))
+        glPolygonOffset(factor, units);
 }
 
 void Renderer::setLineWidth(const Float width) {
-    glLineWidth(width);
+    Implementation::RendererState::Shadow& state = shadow();
+    if(state.update(state.lineWidth, width))
+        glLineWidth(width);
 }
 
 #ifndef MAGNUM_TARGET_GLES
 void Renderer::setPointSize(const Float size) {
-    glPointSize(size);
+    Implementation::RendererState::Shadow& state = shadow();
+    if(state.update(state.pointSize, size))
+        glPointSize(size);
+}
+
+void Renderer::setPrimitiveRestartIndex(const UnsignedInt index) {
+    Implementation::RendererState::Shadow& state = shadow();
+    if(state.update(state.primitiveRestartIndex, index))
+        glPrimitiveRestartIndex(index);
 }
 #endif
 
 void Renderer::setScissor(const Range2Di& rectangle) {
-    glScissor(rectangle.left(), rectangle.bottom(), rectangle.sizeX(), rectangle.sizeY());
+    Implementation::RendererState::Shadow& state = shadow();
+    if(state.update(state.scissor, rectangle))
+        glScissor(rectangle.left(), rectangle.bottom(), rectangle.sizeX(), rectangle.sizeY());
 }
 
 void Renderer::setStencilFunction(const PolygonFacing facing, const StencilFunction function, const Int referenceValue, const UnsignedInt mask) {
-    glStencilFuncSeparate(GLenum(facing), GLenum(function), referenceValue, mask);
+    if(updateStencil(facing, &Implementation::RendererState::Shadow::StencilFace::function, std::make_tuple(GLenum(function), referenceValue, mask)))
+        glStencilFuncSeparate(GLenum(facing), GLenum(function), referenceValue, mask);
 }
 
 void Renderer::setStencilFunction(const StencilFunction function, const Int referenceValue, const UnsignedInt mask) {
-    glStencilFunc(GLenum(function), referenceValue, mask);
+    if(updateStencil(PolygonFacing::FrontAndBack, &Implementation::RendererState::Shadow::StencilFace::function, std::make_tuple(GLenum(function), referenceValue, mask)))
+        glStencilFunc(GLenum(function), referenceValue, mask);
 }
 
 void Renderer::setStencilOperation(const PolygonFacing facing, const StencilOperation stencilFail, const StencilOperation depthFail, const StencilOperation depthPass) {
-    glStencilOpSeparate(GLenum(facing), GLenum(stencilFail), GLenum(depthFail), GLenum(depthPass));
+    if(updateStencil(facing, &Implementation::RendererState::Shadow::StencilFace::operation, std::make_tuple(GLenum(stencilFail), GLenum(depthFail), GLenum(depthPass))))
+        glStencilOpSeparate(GLenum(facing), GLenum(stencilFail), GLenum(depthFail), GLenum(depthPass));
 }
 
 void Renderer::setStencilOperation(const StencilOperation stencilFail, const StencilOperation depthFail, const StencilOperation depthPass) {
-    glStencilOp(GLenum(stencilFail), GLenum(depthFail), GLenum(depthPass));
+    if(updateStencil(PolygonFacing::FrontAndBack, &Implementation::RendererState::Shadow::StencilFace::operation, std::make_tuple(GLenum(stencilFail), GLenum(depthFail), GLenum(depthPass))))
+        glStencilOp(GLenum(stencilFail), GLenum(depthFail), GLenum(depthPass));
 }
 
 void Renderer::setDepthFunction(const DepthFunction function) {
-    glDepthFunc(GLenum(function));
+    Implementation::RendererState::Shadow& state = shadow();
+    if(state.update(state.depthFunction, GLenum(function)))
+        glDepthFunc(GLenum(function));
 }
 
 void Renderer::setColorMask(const GLboolean allowRed, const GLboolean allowGreen, const GLboolean allowBlue, const GLboolean allowAlpha) {
-    glColorMask(allowRed, allowGreen, allowBlue, allowAlpha);
+    Implementation::RendererState::Shadow& state = shadow();
+    if(state.update(state.colorMask, Math::Vector4<GLboolean>{allowRed, allowGreen, allowBlue, allowAlpha}))
+        glColorMask(allowRed, allowGreen, allowBlue, allowAlpha);
 }
 
 void Renderer::setDepthMask(const GLboolean allow) {
-    glDepthMask(allow);
+    Implementation::RendererState::Shadow& state = shadow();
+    if(state.update(state.depthMask, allow))
+        glDepthMask(allow);
 }
 
 void Renderer::setStencilMask(const PolygonFacing facing, const UnsignedInt allowBits) {
-    glStencilMaskSeparate(GLenum(facing), allowBits);
+    if(updateStencil(facing, &Implementation::RendererState::Shadow::StencilFace::mask, allowBits))
+        glStencilMaskSeparate(GLenum(facing), allowBits);
 }
 
 void Renderer::setStencilMask(const UnsignedInt allowBits) {
-    glStencilMask(allowBits);
+    if(updateStencil(PolygonFacing::FrontAndBack, &Implementation::RendererState::Shadow::StencilFace::mask, allowBits))
+        glStencilMask(allowBits);
 }
 
 void Renderer::setBlendEquation(const BlendEquation equation) {
-    glBlendEquation(GLenum(equation));
+    Implementation::RendererState::Shadow& state = shadow();
+    if(state.update(state.blendEquation, std::make_pair(GLenum(equation), GLenum(equation))))
+        glBlendEquation(GLenum(equation));
 }
 
 void Renderer::setBlendEquation(const BlendEquation rgb, const BlendEquation alpha) {
-    glBlendEquationSeparate(GLenum(rgb), GLenum(alpha));
+    Implementation::RendererState::Shadow& state = shadow();
+    if(state.update(state.blendEquation, std::make_pair(GLenum(rgb), GLenum(alpha))))
+        glBlendEquationSeparate(GLenum(rgb), GLenum(alpha));
 }
 
 void Renderer::setBlendFunction(const BlendFunction source, const BlendFunction destination) {
-    glBlendFunc(GLenum(source), GLenum(destination));
+    Implementation::RendererState::Shadow& state = shadow();
+    if(state.update(state.blendFunction, std::make_tuple(GLenum(source), GLenum(destination), GLenum(source), GLenum(destination))))
+        glBlendFunc(GLenum(source), GLenum(destination));
 }
 
 void Renderer::setBlendFunction(const BlendFunction sourceRgb, const BlendFunction destinationRgb, const BlendFunction sourceAlpha, const BlendFunction destinationAlpha) {
-    glBlendFuncSeparate(GLenum(sourceRgb), GLenum(destinationRgb), GLenum(sourceAlpha), GLenum(destinationAlpha));
+    Implementation::RendererState::Shadow& state = shadow();
+    if(state.update(state.blendFunction, std::make_tuple(GLenum(sourceRgb), GLenum(destinationRgb), GLenum(sourceAlpha), GLenum(destinationAlpha))))
+        glBlendFuncSeparate(GLenum(sourceRgb), GLenum(destinationRgb), GLenum(sourceAlpha), GLenum(destinationAlpha));
 }
 
 void Renderer::setBlendColor(const Color4& color) {
-    glBlendColor(color.r(), color.g(), color.b(), color.a());
+    Implementation::RendererState::Shadow& state = shadow();
+    if(state.update(state.blendColor, color))
+        glBlendColor(color.r(), color.g(), color.b(), color.a());
 }
 
 #ifndef MAGNUM_TARGET_GLES
 void Renderer::setLogicOperation(const LogicOperation operation) {
-    glLogicOp(GLenum(operation));
+    Implementation::RendererState::Shadow& state = shadow();
+    if(state.update(state.logicOperation, GLenum(operation)))
+        glLogicOp(GLenum(operation));
 }
 #endif
 
@@ -206,6 +294,19 @@ Renderer::GraphicsResetStatus Renderer::graphicsResetStatus() {
 }
 #endif
 
+UnsignedLong Renderer::stateChangeCount() {
+    return shadow().issued;
+}
+
+UnsignedLong Renderer::skippedStateChangeCount() {
+    return shadow().skipped;
+}
+
+void Renderer::resetStateChangeCount() {
+    Implementation::RendererState::Shadow& state = shadow();
+    state.issued = state.skipped = 0;
+}
+
 void Renderer::initializeContextBasedFunctionality() {
     /* Set some "corporate identity" */
     using namespace Magnum::Math::Literals;
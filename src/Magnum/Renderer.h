@@ -42,6 +42,17 @@ namespace Implementation { struct RendererState; }
 /** @nosubgrouping
 @brief Global renderer configuration.
 
+## State tracking
+
+The renderer state such as enabled features, blending, depth and stencil
+setup is tracked by the engine and the functions don't call OpenGL if the state
+is already set to the same value, so it's fine to set the state needed for
+given draw every time before it. The state is considered unknown after context
+creation and after calling @ref Context::resetState() with
+@ref Context::State::Renderer, in which case the next call always goes to
+OpenGL. Count of issued and skipped state changes is available through
+@ref stateChangeCount() and @ref skippedStateChangeCount().
+
 @todo @extension{ARB,viewport_array}
 @todo `GL_POINT_SIZE_GRANULARITY`, `GL_POINT_SIZE_RANGE` (?)
 @todo `GL_STEREO`, `GL_DOUBLEBUFFER` (?)
@@ -234,6 +245,35 @@ class MAGNUM_EXPORT Renderer {
              * @requires_gl Always enabled on OpenGL ES and WebGL.
              */
             ProgramPointSize = GL_PROGRAM_POINT_SIZE,
+
+            /**
+             * Primitive restart with custom index. If enabled, index
+             * specified with @ref setPrimitiveRestartIndex() starts a new
+             * primitive in indexed strip and fan meshes.
+             * @see @ref Feature::PrimitiveRestartFixedIndex,
+             *      @ref Mesh::primitiveRestartIndex()
+             * @requires_gl31 Primitive restart is not available in OpenGL
+             *      3.0.
+             * @requires_gl Only @ref Feature::PrimitiveRestartFixedIndex is
+             *      available in OpenGL ES.
+             */
+            PrimitiveRestart = GL_PRIMITIVE_RESTART,
+            #endif
+
+            #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+            /**
+             * Primitive restart with fixed index. If enabled, the maximal
+             * value of the mesh index type (see
+             * @ref Mesh::primitiveRestartIndex()) starts a new primitive in
+             * indexed strip and fan meshes.
+             * @see @ref Feature::PrimitiveRestart
+             * @requires_gl43 Extension @extension{ARB,ES3_compatibility}
+             * @requires_gles30 Primitive restart is not available in OpenGL
+             *      ES 2.0.
+             * @requires_gles Always enabled in WebGL 2.0, not available in
+             *      WebGL 1.0.
+             */
+            PrimitiveRestartFixedIndex = GL_PRIMITIVE_RESTART_FIXED_INDEX,
             #endif
 
             #ifndef MAGNUM_TARGET_GLES2
@@ -538,6 +578,19 @@ class MAGNUM_EXPORT Renderer {
          *      OpenGL ES and WebGL instead.
          */
         static void setPointSize(Float size);
+
+        /**
+         * @brief Set primitive restart index
+         *
+         * Used if @ref Feature::PrimitiveRestart is enabled. Initial value
+         * is `0`. Use @ref Mesh::primitiveRestartIndex() to get an index
+         * matching the mesh index type.
+         * @see @fn_gl{PrimitiveRestartIndex}
+         * @requires_gl31 Primitive restart is not available in OpenGL 3.0.
+         * @requires_gl Use @ref Feature::PrimitiveRestartFixedIndex in
+         *      OpenGL ES instead.
+         */
+        static void setPrimitiveRestartIndex(UnsignedInt index);
         #endif
 
         /*@}*/
@@ -1279,7 +1332,7 @@ class MAGNUM_EXPORT Renderer {
              *      3.0 and older.
              * @requires_gles Shader storage is not available in WebGL.
              */
-            ShaderStorage = GL_ATOMIC_COUNTER_BARRIER_BIT
+            ShaderStorage = GL_SHADER_STORAGE_BARRIER_BIT
         };
 
         /**
@@ -1293,7 +1346,7 @@ class MAGNUM_EXPORT Renderer {
          */
         typedef Containers::EnumSet<MemoryBarrier
             #ifndef DOXYGEN_GENERATING_OUTPUT
-            , GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT|GL_ELEMENT_ARRAY_BARRIER_BIT|GL_UNIFORM_BARRIER_BIT|GL_TEXTURE_FETCH_BARRIER_BIT|GL_SHADER_IMAGE_ACCESS_BARRIER_BIT|GL_COMMAND_BARRIER_BIT|GL_PIXEL_BUFFER_BARRIER_BIT|GL_TEXTURE_UPDATE_BARRIER_BIT|GL_BUFFER_UPDATE_BARRIER_BIT|GL_FRAMEBUFFER_BARRIER_BIT|GL_TRANSFORM_FEEDBACK_BARRIER_BIT|GL_ATOMIC_COUNTER_BARRIER_BIT|GL_ATOMIC_COUNTER_BARRIER_BIT
+            , GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT|GL_ELEMENT_ARRAY_BARRIER_BIT|GL_UNIFORM_BARRIER_BIT|GL_TEXTURE_FETCH_BARRIER_BIT|GL_SHADER_IMAGE_ACCESS_BARRIER_BIT|GL_COMMAND_BARRIER_BIT|GL_PIXEL_BUFFER_BARRIER_BIT|GL_TEXTURE_UPDATE_BARRIER_BIT|GL_BUFFER_UPDATE_BARRIER_BIT|GL_FRAMEBUFFER_BARRIER_BIT|GL_TRANSFORM_FEEDBACK_BARRIER_BIT|GL_ATOMIC_COUNTER_BARRIER_BIT|GL_SHADER_STORAGE_BARRIER_BIT
             #endif
             > MemoryBarriers;
 
@@ -1552,6 +1605,35 @@ class MAGNUM_EXPORT Renderer {
         static GraphicsResetStatus graphicsResetStatus();
         #endif
 
+        /**
+         * @brief Count of state changes sent to OpenGL
+         *
+         * Count of calls to the state-setting functions such as @ref enable(),
+         * @ref setBlendFunction() or @ref setDepthMask() that resulted in an
+         * OpenGL call since the context creation or since last
+         * @ref resetStateChangeCount().
+         * @see @ref skippedStateChangeCount(), @ref Context::resetState()
+         */
+        static UnsignedLong stateChangeCount();
+
+        /**
+         * @brief Count of skipped state changes
+         *
+         * Count of calls to the state-setting functions that were skipped,
+         * because the state was already set to the same value, since the
+         * context creation or since last @ref resetStateChangeCount().
+         * @see @ref stateChangeCount()
+         */
+        static UnsignedLong skippedStateChangeCount();
+
+        /**
+         * @brief Reset the state change counters
+         *
+         * Call it e.g. at the start of every frame to get per-frame counts.
+         * @see @ref stateChangeCount(), @ref skippedStateChangeCount()
+         */
+        static void resetStateChangeCount();
+
         /*@}*/
 
     private:
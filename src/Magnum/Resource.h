@@ -128,22 +128,29 @@ class Resource {
          * Creates empty resource. Resources are acquired from the manager by
          * calling @ref ResourceManager::get().
          */
-        explicit Resource(): manager(nullptr), lastCheck(0), _state(ResourceState::Final), data(nullptr) {}
+        explicit Resource(): manager(nullptr), _slot(nullptr), lastCheck(0), _state(ResourceState::Final), data(nullptr) {}
 
-        /** @brief Copy constructor */
-        Resource(const Resource<T, U>& other): manager(other.manager), _key(other._key), lastCheck(other.lastCheck), _state(other._state), data(other.data) {
-            if(manager) manager->incrementReferenceCount(_key);
+        /**
+         * @brief Copy constructor
+         *
+         * The reference count is updated atomically, so it's safe to copy
+         * and destroy resource references from other threads as long as the
+         * last reference is released on the thread owning the manager.
+         */
+        Resource(const Resource<T, U>& other): manager(other.manager), _slot(other._slot), _key(other._key), lastCheck(other.lastCheck), _state(other._state), data(other.data) {
+            if(manager) manager->incrementReferenceCount(*_slot);
         }
 
         /** @brief Move constructor */
-        Resource(Resource<T, U>&& other): manager(other.manager), _key(other._key), lastCheck(other.lastCheck), _state(other._state), data(other.data) {
+        Resource(Resource<T, U>&& other): manager(other.manager), _slot(other._slot), _key(other._key), lastCheck(other.lastCheck), _state(other._state), data(other.data) {
             /** @brief Make other's state well-defined */
             other.manager = nullptr;
+            other._slot = nullptr;
         }
 
         /** @brief Destructor */
         ~Resource() {
-            if(manager) manager->decrementReferenceCount(_key);
+            if(manager) manager->decrementReferenceCount(*_slot);
         }
 
         /** @brief Copy assignment */
@@ -215,13 +222,14 @@ class Resource {
         }
 
     private:
-        Resource(Implementation::ResourceManagerData<T>* manager, ResourceKey key): manager(manager), _key(key), lastCheck(0), _state(ResourceState::NotLoaded), data(nullptr) {
-            manager->incrementReferenceCount(key);
+        Resource(Implementation::ResourceManagerData<T>* manager, ResourceKey key, typename Implementation::ResourceManagerData<T>::Data& slot): manager(manager), _slot(&slot), _key(key), lastCheck(0), _state(ResourceState::NotLoaded), data(nullptr) {
+            manager->incrementReferenceCount(slot);
         }
 
         void acquire();
 
         Implementation::ResourceManagerData<T>* manager;
+        typename Implementation::ResourceManagerData<T>::Data* _slot;
         ResourceKey _key;
         std::size_t lastCheck;
         ResourceState _state;
@@ -229,29 +237,33 @@ class Resource {
 };
 
 template<class T, class U> Resource<T, U>& Resource<T, U>::operator=(const Resource<T, U>& other) {
-    if(manager) manager->decrementReferenceCount(_key);
+    /* Increment first so self-assignment doesn't release the resource */
+    if(other.manager) other.manager->incrementReferenceCount(*other._slot);
+    if(manager) manager->decrementReferenceCount(*_slot);
 
     manager = other.manager;
+    _slot = other._slot;
     _key = other._key;
     lastCheck = other.lastCheck;
     _state = other._state;
     data = other.data;
 
-    if(manager) manager->incrementReferenceCount(_key);
     return *this;
 }
 
 template<class T, class U> Resource<T, U>& Resource<T, U>::operator=(Resource<T, U>&& other) {
     /** @todo Just swap the values */
-    if(manager) manager->decrementReferenceCount(_key);
+    if(manager) manager->decrementReferenceCount(*_slot);
 
     manager = other.manager;
+    _slot = other._slot;
     _key = other._key;
     lastCheck = other.lastCheck;
     _state = other._state;
     data = other.data;
 
     other.manager = nullptr;
+    other._slot = nullptr;
     return *this;
 }
 
@@ -259,12 +271,13 @@ template<class T, class U> void Resource<T, U>::acquire() {
     /* The data are already final, nothing to do */
     if(_state == ResourceState::Final) return;
 
-    /* Nothing changed since last check */
-    if(manager->lastChange() < lastCheck) return;
+    /* The data didn't change since last check. Resources without data are
+       checked every time, as the fallback might have changed meanwhile. */
+    const typename Implementation::ResourceManagerData<T>::Data& d = *_slot;
+    if(_state == ResourceState::Mutable && d.generation == lastCheck) return;
 
-    /* Acquire new data and save last check time */
-    const typename Implementation::ResourceManagerData<T>::Data& d = manager->data(_key);
-    lastCheck = manager->lastChange();
+    /* Acquire new data and save the slot generation */
+    lastCheck = d.generation;
 
     /* Try to get the data */
     data = d.data;
@@ -29,7 +29,11 @@
  * @brief Class @ref Magnum::ResourceManager, @ref Magnum::ResourceDataState, @ref Magnum::ResourcePolicy
  */
 
+#include <atomic>
+#include <deque>
+#include <list>
 #include <unordered_map>
+#include <vector>
 
 #include "Magnum/Resource.h"
 
@@ -75,7 +79,12 @@ enum class ResourceDataState: UnsignedByte {
 @see @ref ResourceManager::set(), @ref ResourceManager::free()
  */
 enum class ResourcePolicy: UnsignedByte {
-    /** The resource will stay resident for whole lifetime of resource manager. */
+    /**
+     * The resource will stay resident for whole lifetime of resource manager.
+     * If memory budget is set using @ref ResourceManager::setMemoryBudget()
+     * and the resource type has a loader, the resource might be evicted when
+     * nothing references it and loaded again when requested.
+     */
     Resident,
 
     /**
@@ -109,7 +118,7 @@ template<class T> class ResourceManagerData {
 
         std::size_t lastChange() const { return _lastChange; }
 
-        std::size_t count() const { return _data.size(); }
+        std::size_t count() const { return _keys.size(); }
 
         std::size_t referenceCount(ResourceKey key) const;
 
@@ -117,7 +126,13 @@ template<class T> class ResourceManagerData {
 
         template<class U> Resource<T, U> get(ResourceKey key);
 
-        void set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy);
+        void set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy, std::size_t size = 0);
+
+        std::size_t memoryUsage() const { return _memoryUsage; }
+
+        std::size_t memoryBudget() const { return _memoryBudget; }
+
+        void setMemoryBudget(std::size_t budget);
 
         T* fallback() { return _fallback; }
         const T* fallback() const { return _fallback; }
@@ -126,7 +141,7 @@ template<class T> class ResourceManagerData {
 
         void free();
 
-        void clear() { _data.clear(); }
+        void clear();
 
         AbstractResourceLoader<T>* loader() { return _loader; }
         const AbstractResourceLoader<T>* loader() const { return _loader; }
@@ -136,23 +151,50 @@ template<class T> class ResourceManagerData {
         void setLoader(AbstractResourceLoader<T>* loader);
 
     protected:
-        ResourceManagerData(): _fallback(nullptr), _loader(nullptr), _lastChange(0) {}
+        ResourceManagerData(): _fallback(nullptr), _loader(nullptr), _lastChange(0), _memoryUsage(0), _memoryBudget(0) {}
 
     private:
         struct Data;
+        typedef typename std::unordered_map<ResourceKey, std::size_t>::iterator KeyIterator;
+
+        /* Returns a slot for given key, creating an empty one if the key is
+           not known yet. The slot address stays stable until the slot is
+           erased, which can't happen while it is referenced. */
+        Data& slot(ResourceKey key);
+
+        void incrementReferenceCount(Data& data) { ++data.referenceCount; }
 
-        const Data& data(ResourceKey key) { return _data[key]; }
+        void decrementReferenceCount(Data& data) {
+            /* Fast path, other references are still alive */
+            if(--data.referenceCount) return;
+            release(data);
+        }
+
+        /* Called after the last reference to given slot is removed */
+        void release(Data& data);
 
-        void incrementReferenceCount(ResourceKey key) {
-            ++_data[key].referenceCount;
+        /* Moves the resource to the front of the LRU list */
+        void touch(Data& data) {
+            if(data.size) _lru.splice(_lru.begin(), _lru, data.lruPosition);
         }
 
-        void decrementReferenceCount(ResourceKey key);
+        KeyIterator erase(KeyIterator it);
 
-        std::unordered_map<ResourceKey, Data> _data;
+        void evict();
+
+        /* Key to slot index mapping, looked up only when acquiring a new
+           Resource. The slots are never moved, erased slots are put to the
+           free list and reused for new keys. */
+        std::unordered_map<ResourceKey, std::size_t> _keys;
+        std::deque<Data> _slots;
+        std::vector<std::size_t> _freeSlots;
         T* _fallback;
         AbstractResourceLoader<T>* _loader;
         std::size_t _lastChange;
+
+        /* Resources with nonzero size, most recently used first */
+        std::list<ResourceKey> _lru;
+        std::size_t _memoryUsage, _memoryBudget;
 };
 
 /* Helper class for defining which real types are in the type pack */
@@ -242,6 +284,23 @@ cube->draw(*shader);
 -   Destroying resource references and deleting manager instance when nothing
     references the resources anymore.
 
+## Access performance and threading
+
+Each resource is stored in a slot that keeps its address for the whole time
+the resource is referenced, so a @ref Resource points directly to it and the
+key lookup is done only once in @ref get(). Each slot also has a generation
+counter that's incremented every time its contents change, so accessing a
+mutable resource only compares the counter and doesn't refetch anything if
+the data stayed the same.
+
+Reference counts are updated atomically, which means @ref Resource instances
+can be copied to and destroyed on worker threads. The manager itself isn't
+thread-safe, though --- @ref get(), @ref set() and all other functions should
+be called only from one thread and the last reference to a resource has to be
+released on that thread as well, as it may trigger freeing or eviction of the
+data. Accessing final resources from other threads is safe, as their data
+never change.
+
 @see @ref AbstractResourceLoader
 */
 /* Due to too much work involved with explicit template instantiation (all
@@ -321,18 +380,22 @@ template<class... Types> class ResourceManager: private Implementation::Resource
          * zero reference count. It means that all reference counted resources
          * which were only loaded but not used will stay loaded and you need to
          * explicitly call @ref free() to delete them.
+         *
+         * The @p size is memory size of the resource in bytes (e.g. size of
+         * the texture or buffer data on the GPU) and is counted towards
+         * @ref memoryUsage(). Resources with zero size are never evicted.
          * @attention Subsequent updates are not possible if resource state is
          *      already @ref ResourceState::Final.
          * @see @ref referenceCount(), @ref state()
          */
-        template<class T> ResourceManager<Types...>& set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy) {
-            this->Implementation::ResourceManagerData<T>::set(key, data, state, policy);
+        template<class T> ResourceManager<Types...>& set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy, std::size_t size = 0) {
+            this->Implementation::ResourceManagerData<T>::set(key, data, state, policy, size);
             return *this;
         }
 
         /** @overload */
-        template<class U> ResourceManager<Types...>& set(ResourceKey key, U&& data, ResourceDataState state, ResourcePolicy policy) {
-            return set(key, new typename std::decay<U>::type(std::forward<U>(data)), state, policy);
+        template<class U> ResourceManager<Types...>& set(ResourceKey key, U&& data, ResourceDataState state, ResourcePolicy policy, std::size_t size = 0) {
+            return set(key, new typename std::decay<U>::type(std::forward<U>(data)), state, policy, size);
         }
 
         /**
@@ -351,6 +414,46 @@ template<class... Types> class ResourceManager: private Implementation::Resource
             return set(key, new typename std::decay<U>::type(std::forward<U>(data)));
         }
 
+        /**
+         * @brief Memory usage of resources of given type
+         *
+         * Sum of sizes passed to @ref set() for all currently present
+         * resources of given type.
+         * @see @ref memoryBudget()
+         */
+        template<class T> std::size_t memoryUsage() const {
+            return this->Implementation::ResourceManagerData<T>::memoryUsage();
+        }
+
+        /**
+         * @brief Memory budget for resources of given type
+         *
+         * Zero means unlimited, which is the default.
+         * @see @ref setMemoryBudget()
+         */
+        template<class T> std::size_t memoryBudget() const {
+            return this->Implementation::ResourceManagerData<T>::memoryBudget();
+        }
+
+        /**
+         * @brief Set memory budget for resources of given type
+         * @return Reference to self (for method chaining)
+         *
+         * If @ref memoryUsage() exceeds the budget, least recently used
+         * resources of given type are deleted until it fits. Only resources
+         * with @ref ResourcePolicy::Resident that are not referenced are
+         * evicted and only if there is a loader for given type set with
+         * @ref setLoader(), so they can be loaded again when requested. The
+         * check is done also on each @ref set() and when the last reference
+         * to a resource is removed. A resource is used when a @ref Resource
+         * referencing it is created or destroyed. Set to zero to disable the
+         * budget.
+         */
+        template<class T> ResourceManager<Types...>& setMemoryBudget(std::size_t budget) {
+            this->Implementation::ResourceManagerData<T>::setMemoryBudget(budget);
+            return *this;
+        }
+
         /** @brief Fallback for not found resources */
         template<class T> T* fallback() {
             return this->Implementation::ResourceManagerData<T>::fallback();
@@ -479,64 +582,151 @@ template<class T> ResourceManagerData<T>::~ResourceManagerData() {
 }
 
 template<class T> std::size_t ResourceManagerData<T>::referenceCount(const ResourceKey key) const {
-    auto it = _data.find(key);
-    if(it == _data.end()) return 0;
-    return it->second.referenceCount;
+    auto it = _keys.find(key);
+    if(it == _keys.end()) return 0;
+    return _slots[it->second].referenceCount;
 }
 
 template<class T> ResourceState ResourceManagerData<T>::state(const ResourceKey key) const {
-    const auto it = _data.find(key);
+    const auto it = _keys.find(key);
+    const Data* const d = it == _keys.end() ? nullptr : &_slots[it->second];
 
     /* Resource not loaded */
-    if(it == _data.end() || !it->second.data) {
+    if(!d || !d->data) {
         /* Fallback found, add *Fallback to state */
         if(_fallback) {
-            if(it != _data.end() && it->second.state == ResourceDataState::Loading)
+            if(d && d->state == ResourceDataState::Loading)
                 return ResourceState::LoadingFallback;
-            else if(it != _data.end() && it->second.state == ResourceDataState::NotFound)
+            else if(d && d->state == ResourceDataState::NotFound)
                 return ResourceState::NotFoundFallback;
             else return ResourceState::NotLoadedFallback;
         }
 
         /* Fallback not found, loading didn't start yet */
-        if(it == _data.end() || (it->second.state != ResourceDataState::Loading && it->second.state != ResourceDataState::NotFound))
+        if(!d || (d->state != ResourceDataState::Loading && d->state != ResourceDataState::NotFound))
             return ResourceState::NotLoaded;
     }
 
     /* Loading / NotFound without fallback, Mutable / Final */
-    return static_cast<ResourceState>(it->second.state);
+    return static_cast<ResourceState>(d->state);
 }
 
 template<class T> template<class U> Resource<T, U> ResourceManagerData<T>::get(ResourceKey key) {
     /* Ask loader for the data, if they aren't there yet */
-    if(_loader && _data.find(key) == _data.end())
+    if(_loader && _keys.find(key) == _keys.end())
         _loader->load(key);
 
-    return Resource<T, U>(this, key);
+    Data& d = slot(key);
+    touch(d);
+    return Resource<T, U>(this, key, d);
 }
 
-template<class T> void ResourceManagerData<T>::set(const ResourceKey key, T* const data, const ResourceDataState state, const ResourcePolicy policy) {
-    auto it = _data.find(key);
+template<class T> void ResourceManagerData<T>::set(const ResourceKey key, T* const data, const ResourceDataState state, const ResourcePolicy policy, const std::size_t size) {
+    auto it = _keys.find(key);
 
     /* NotFound / Loading state shouldn't have any data */
     CORRADE_ASSERT((data == nullptr) == (state == ResourceDataState::NotFound || state == ResourceDataState::Loading),
         "ResourceManager::set(): data should be null if and only if state is NotFound or Loading", );
 
     /* Cannot change resource with already final state */
-    CORRADE_ASSERT(it == _data.end() || it->second.state != ResourceDataState::Final,
+    CORRADE_ASSERT(it == _keys.end() || _slots[it->second].state != ResourceDataState::Final,
         "ResourceManager::set(): cannot change already final resource" << key, );
 
     /* Insert the resource, if not already there */
-    if(it == _data.end())
-        it = _data.emplace(key, Data()).first;
+    Data& d = it == _keys.end() ? slot(key) : _slots[it->second];
 
-    /* Otherwise delete previous data */
-    else safeDelete(it->second.data);
+    /* Delete previous data */
+    safeDelete(d.data);
+    if(d.size) {
+        _memoryUsage -= d.size;
+        _lru.erase(d.lruPosition);
+    }
+
+    d.data = data;
+    d.state = state;
+    d.policy = policy;
+    d.size = size;
+    if(size) {
+        _memoryUsage += size;
+        d.lruPosition = _lru.insert(_lru.begin(), key);
+    }
 
-    it->second.data = data;
-    it->second.state = state;
-    it->second.policy = policy;
+    /* Let the references know they need to fetch the data again */
+    ++d.generation;
     ++_lastChange;
+
+    evict();
+}
+
+template<class T> void ResourceManagerData<T>::setMemoryBudget(const std::size_t budget) {
+    _memoryBudget = budget;
+    evict();
+}
+
+template<class T> void ResourceManagerData<T>::clear() {
+    _keys.clear();
+    _slots.clear();
+    _freeSlots.clear();
+    _lru.clear();
+    _memoryUsage = 0;
+}
+
+template<class T> auto ResourceManagerData<T>::slot(const ResourceKey key) -> Data& {
+    const auto it = _keys.find(key);
+    if(it != _keys.end()) return _slots[it->second];
+
+    /* Reuse a previously erased slot, if possible */
+    std::size_t index;
+    if(!_freeSlots.empty()) {
+        index = _freeSlots.back();
+        _freeSlots.pop_back();
+    } else {
+        index = _slots.size();
+        _slots.emplace_back();
+    }
+
+    _keys.emplace(key, index);
+    _slots[index].key = key;
+    return _slots[index];
+}
+
+template<class T> auto ResourceManagerData<T>::erase(const KeyIterator it) -> KeyIterator {
+    Data& d = _slots[it->second];
+    if(d.size) {
+        _memoryUsage -= d.size;
+        _lru.erase(d.lruPosition);
+    }
+
+    /* Reset the slot to initial state, the generation is kept increasing so
+       a slot reused for another key is never mistaken for the previous one */
+    safeDelete(d.data);
+    d.data = nullptr;
+    d.state = ResourceDataState::Mutable;
+    d.policy = ResourcePolicy::Manual;
+    d.size = 0;
+    ++d.generation;
+
+    _freeSlots.push_back(it->second);
+    return _keys.erase(it);
+}
+
+template<class T> void ResourceManagerData<T>::evict() {
+    /* Evicted resources need to be loaded again when requested */
+    if(!_memoryBudget || !_loader) return;
+
+    /* Go from the least recently used resource, skipping these which can't
+       be evicted */
+    auto lit = _lru.end();
+    while(_memoryUsage > _memoryBudget && lit != _lru.begin()) {
+        const auto it = _keys.find(*--lit);
+        CORRADE_INTERNAL_ASSERT(it != _keys.end());
+        const Data& d = _slots[it->second];
+        if(d.policy != ResourcePolicy::Resident || d.referenceCount)
+            continue;
+
+        lit = std::next(lit);
+        erase(it);
+    }
 }
 
 template<class T> void ResourceManagerData<T>::setFallback(T* const data) {
@@ -546,9 +736,10 @@ template<class T> void ResourceManagerData<T>::setFallback(T* const data) {
 
 template<class T> void ResourceManagerData<T>::free() {
     /* Delete all non-referenced non-resident resources */
-    for(auto it = _data.begin(); it != _data.end(); ) {
-        if(it->second.policy != ResourcePolicy::Resident && !it->second.referenceCount)
-            it = _data.erase(it);
+    for(auto it = _keys.begin(); it != _keys.end(); ) {
+        const Data& d = _slots[it->second];
+        if(d.policy != ResourcePolicy::Resident && !d.referenceCount)
+            it = erase(it);
         else ++it;
     }
 }
@@ -568,34 +759,43 @@ template<class T> void ResourceManagerData<T>::freeLoader() {
     delete _loader;
 }
 
-template<class T> void ResourceManagerData<T>::decrementReferenceCount(ResourceKey key) {
-    auto it = _data.find(key);
-    CORRADE_INTERNAL_ASSERT(it != _data.end());
+template<class T> void ResourceManagerData<T>::release(Data& data) {
+    const auto it = _keys.find(data.key);
+    CORRADE_INTERNAL_ASSERT(it != _keys.end() && &_slots[it->second] == &data);
 
     /* Free the resource if it is reference counted */
-    if(--it->second.referenceCount == 0 && it->second.policy == ResourcePolicy::ReferenceCounted)
-        _data.erase(it);
+    if(data.policy == ResourcePolicy::ReferenceCounted) {
+        erase(it);
+        return;
+    }
+
+    /* Otherwise it might now be possible to evict it */
+    touch(data);
+    evict();
 }
 
 template<class T> struct ResourceManagerData<T>::Data {
-    Data(): data(nullptr), state(ResourceDataState::Mutable), policy(ResourcePolicy::Manual), referenceCount(0) {}
+    Data(): data(nullptr), state(ResourceDataState::Mutable), policy(ResourcePolicy::Manual), referenceCount(0), size(0), generation(0) {}
 
     Data(const Data&) = delete;
-
-    Data(Data&& other): data(other.data), state(other.state), policy(other.policy), referenceCount(other.referenceCount) {
-        other.data = nullptr;
-        other.referenceCount = 0;
-    }
+    Data(Data&&) = delete;
 
     ~Data();
 
     Data& operator=(const Data&) = delete;
     Data& operator=(Data&&) = delete;
 
+    ResourceKey key;
     T* data;
     ResourceDataState state;
     ResourcePolicy policy;
-    std::size_t referenceCount;
+    std::atomic<std::size_t> referenceCount;
+    std::size_t size;
+    std::list<ResourceKey>::iterator lruPosition;
+
+    /* Incremented on every change of the slot contents, compared against
+       Resource::lastCheck to avoid refetching unchanged data */
+    std::size_t generation;
 };
 
 template<class T> inline ResourceManagerData<T>::Data::~Data() {
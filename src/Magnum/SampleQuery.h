@@ -75,7 +75,7 @@ q.beginConditionalRender(SampleQuery::ConditionalRenderMode::Wait);
 q.endConditionalRender();
 @endcode
 
-@see @ref PrimitiveQuery, @ref TimeQuery
+@see @ref PrimitiveQuery, @ref TimeQuery, @ref QueryPool
 @requires_gles30 Extension @es_extension{EXT,occlusion_query_boolean} in
     OpenGL ES 2.0.
 @requires_webgl20 Queries are not available in WebGL 1.0.
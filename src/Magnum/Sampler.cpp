@@ -25,11 +25,17 @@
 
 #include "Sampler.h"
 
+#include <algorithm>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Debug.h>
 
 #include "Magnum/Context.h"
 #include "Magnum/Implementation/State.h"
 #include "Magnum/Implementation/TextureState.h"
+#ifndef MAGNUM_TARGET_WEBGL
+#include "Magnum/Implementation/DebugState.h"
+#endif
 #include "Magnum/Extensions.h"
 
 namespace Magnum {
@@ -60,6 +66,160 @@ Float Sampler::maxMaxAnisotropy() {
     return value;
 }
 
+#ifndef MAGNUM_TARGET_GLES2
+void Sampler::bind(const Int firstTextureUnit, std::initializer_list<Sampler*> samplers) {
+    Containers::Array<GLuint> ids{Containers::ValueInit, samplers.size()};
+    for(std::size_t i = 0; i != samplers.size(); ++i)
+        if(Sampler* const sampler = *(samplers.begin() + i)) ids[i] = sampler->_id;
+    bindInternal(firstTextureUnit, ids);
+}
+
+void Sampler::unbind(const Int textureUnit) {
+    const GLuint id = 0;
+    bindInternal(textureUnit, {&id, 1});
+}
+
+void Sampler::bindInternal(const GLint firstTextureUnit, const Containers::ArrayView<const GLuint> ids) {
+    if(ids.empty()) return;
+
+    CORRADE_ASSERT(firstTextureUnit + ids.size() <= Context::current().state().texture->samplerBindings.size(),
+        "Sampler::bind(): texture unit range" << firstTextureUnit << Debug::nospace << ":" << Debug::nospace << firstTextureUnit + ids.size() << "out of range", );
+
+    /* State tracker is updated in the implementations */
+    Context::current().state().texture->bindSamplersImplementation(firstTextureUnit, ids);
+}
+
+void Sampler::bindImplementationFallback(const GLint firstTextureUnit, const Containers::ArrayView<const GLuint> ids) {
+    GLuint* const bindings = Context::current().state().texture->samplerBindings + firstTextureUnit;
+    for(std::size_t i = 0; i != ids.size(); ++i) {
+        if(bindings[i] == ids[i]) continue;
+
+        bindings[i] = ids[i];
+        glBindSampler(firstTextureUnit + i, ids[i]);
+    }
+}
+
+#ifndef MAGNUM_TARGET_GLES
+void Sampler::bindImplementationMulti(const GLint firstTextureUnit, const Containers::ArrayView<const GLuint> ids) {
+    GLuint* const bindings = Context::current().state().texture->samplerBindings + firstTextureUnit;
+
+    /* Find the first and the last unit that differs from the state tracker */
+    std::size_t first = 0;
+    std::size_t last = ids.size();
+    while(first != last && bindings[first] == ids[first]) ++first;
+    while(last != first && bindings[last - 1] == ids[last - 1]) --last;
+
+    /* Avoid doing the binding if there is nothing different */
+    if(first == last) return;
+
+    std::copy(ids.begin() + first, ids.begin() + last, bindings + first);
+    glBindSamplers(firstTextureUnit + first, last - first, ids + first);
+}
+#endif
+
+Sampler::Sampler(): _flags{ObjectFlag::DeleteOnDestruction} {
+    /* glGenSamplers() creates the objects right away, unlike e.g.
+       glGenTextures(), so the IDs can be used for glSamplerParameter() and
+       glObjectLabel() without binding them first */
+    glGenSamplers(1, &_id);
+    _flags |= ObjectFlag::Created;
+}
+
+Sampler::Sampler(const Configuration& configuration): Sampler{} {
+    setConfiguration(configuration);
+}
+
+Sampler::~Sampler() {
+    /* Moved out or not deleting on destruction, nothing to do */
+    if(!_id || !(_flags & ObjectFlag::DeleteOnDestruction)) return;
+
+    /* Deleting a sampler unbinds it from all units, remove it from the state
+       tracker as well */
+    Containers::ArrayView<GLuint> bindings = Context::current().state().texture->samplerBindings;
+    std::replace(bindings.begin(), bindings.end(), _id, 0u);
+
+    glDeleteSamplers(1, &_id);
+}
+
+#ifndef MAGNUM_TARGET_WEBGL
+std::string Sampler::label() {
+    #ifndef MAGNUM_TARGET_GLES
+    return Context::current().state().debug->getLabelImplementation(GL_SAMPLER, _id);
+    #else
+    return Context::current().state().debug->getLabelImplementation(GL_SAMPLER_KHR, _id);
+    #endif
+}
+
+Sampler& Sampler::setLabelInternal(const Containers::ArrayView<const char> label) {
+    #ifndef MAGNUM_TARGET_GLES
+    Context::current().state().debug->labelImplementation(GL_SAMPLER, _id, label);
+    #else
+    Context::current().state().debug->labelImplementation(GL_SAMPLER_KHR, _id, label);
+    #endif
+    return *this;
+}
+#endif
+
+Sampler& Sampler::setMinificationFilter(const Filter filter, const Mipmap mipmap) {
+    glSamplerParameteri(_id, GL_TEXTURE_MIN_FILTER, GLint(filter)|GLint(mipmap));
+    return *this;
+}
+
+Sampler& Sampler::setMagnificationFilter(const Filter filter) {
+    glSamplerParameteri(_id, GL_TEXTURE_MAG_FILTER, GLint(filter));
+    return *this;
+}
+
+Sampler& Sampler::setWrapping(const Array3D<Wrapping>& wrapping) {
+    glSamplerParameteri(_id, GL_TEXTURE_WRAP_S, GLint(wrapping.x()));
+    glSamplerParameteri(_id, GL_TEXTURE_WRAP_T, GLint(wrapping.y()));
+    glSamplerParameteri(_id, GL_TEXTURE_WRAP_R, GLint(wrapping.z()));
+    return *this;
+}
+
+Sampler& Sampler::setMinLod(const Float lod) {
+    glSamplerParameterf(_id, GL_TEXTURE_MIN_LOD, lod);
+    return *this;
+}
+
+Sampler& Sampler::setMaxLod(const Float lod) {
+    glSamplerParameterf(_id, GL_TEXTURE_MAX_LOD, lod);
+    return *this;
+}
+
+Sampler& Sampler::setMaxAnisotropy(const Float anisotropy) {
+    if(Context::current().isExtensionSupported<Extensions::GL::EXT::texture_filter_anisotropic>())
+        glSamplerParameterf(_id, GL_TEXTURE_MAX_ANISOTROPY_EXT, anisotropy);
+    return *this;
+}
+
+Sampler& Sampler::setCompareMode(const CompareMode mode) {
+    glSamplerParameteri(_id, GL_TEXTURE_COMPARE_MODE, GLenum(mode));
+    return *this;
+}
+
+Sampler& Sampler::setCompareFunction(const CompareFunction function) {
+    glSamplerParameteri(_id, GL_TEXTURE_COMPARE_FUNC, GLenum(function));
+    return *this;
+}
+
+Sampler& Sampler::setConfiguration(const Configuration& configuration) {
+    setMinificationFilter(configuration.minificationFilter(), configuration.minificationMipmap());
+    setMagnificationFilter(configuration.magnificationFilter());
+    setWrapping(configuration.wrapping());
+    setMinLod(configuration.minLod());
+    setMaxLod(configuration.maxLod());
+    setMaxAnisotropy(configuration.maxAnisotropy());
+    setCompareMode(configuration.compareMode());
+    setCompareFunction(configuration.compareFunction());
+    return *this;
+}
+
+void Sampler::bind(const Int textureUnit) {
+    bindInternal(textureUnit, {&_id, 1});
+}
+#endif
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 Debug& operator<<(Debug& debug, const Sampler::Filter value) {
     switch(value) {
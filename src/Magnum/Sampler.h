@@ -29,19 +29,65 @@
  * @brief Class @ref Magnum::Sampler
  */
 
-#include "Magnum/Magnum.h"
-#include "Magnum/OpenGL.h"
-#include "Magnum/visibility.h"
+#include <initializer_list>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/AbstractObject.h"
+#include "Magnum/Array.h"
+#include "Magnum/Tags.h"
 
 namespace Magnum {
 
+namespace Implementation { struct TextureState; }
+
 /**
 @brief Texture sampler
 
+Besides providing the filtering, wrapping and comparison enums used by all
+texture classes, on OpenGL 3.3+, OpenGL ES 3.0+ and WebGL 2.0 this class wraps
+an OpenGL sampler object. A sampler object bound to a texture unit overrides
+the sampling parameters of any texture bound to the same unit, so textures
+sharing the same filtering setup don't need to have it duplicated in each of
+them. Use @ref SamplerRegistry to share one sampler object among all users of
+given @ref Configuration.
+
+@code
+Sampler sampler{Sampler::Configuration{}
+    .setMinificationFilter(Sampler::Filter::Linear, Sampler::Mipmap::Linear)
+    .setWrapping(Sampler::Wrapping::ClampToEdge)};
+
+// ...
+
+texture.bind(0);
+sampler.bind(0);
+mesh.draw(shader);
+@endcode
+
+@anchor Sampler-performance-optimization
+## Performance optimizations
+
+Sampler bindings are tracked in the same way as texture bindings, so binding
+a sampler that is already bound to given unit is a no-op. If
+@extension{ARB,multi_bind} (part of OpenGL 4.4) is available,
+@ref bind(Int, std::initializer_list<Sampler*>) and @ref TextureSet with
+samplers bind only the range between the first and the last changed unit
+with a single @fn_gl{BindSamplers} call, otherwise each changed unit is bound
+using @fn_gl{BindSampler}. Sampler parameters are set directly on the object
+without any binding.
+
 @see @ref Texture, @ref TextureArray, @ref CubeMapTexture,
     @ref CubeMapTextureArray, @ref RectangleTexture
 */
-class MAGNUM_EXPORT Sampler {
+class MAGNUM_EXPORT Sampler
+    #ifndef MAGNUM_TARGET_GLES2
+    : public AbstractObject
+    #endif
+{
+    #ifndef MAGNUM_TARGET_GLES2
+    friend Implementation::TextureState;
+    friend TextureSet;
+    #endif
+
     public:
         /**
          * @brief Texture filtering
@@ -253,8 +299,457 @@ class MAGNUM_EXPORT Sampler {
          * @see @fn_gl{Get} with @def_gl{MAX_TEXTURE_MAX_ANISOTROPY_EXT}
          */
         static Float maxMaxAnisotropy();
+
+        #ifndef MAGNUM_TARGET_GLES2
+        class Configuration;
+
+        /**
+         * @brief Bind samplers to given range of texture units
+         *
+         * The first sampler in the list is bound to @p firstTextureUnit, the
+         * second to `firstTextureUnit + 1` etc. If any sampler is `nullptr`,
+         * given texture unit has no sampler bound and the texture parameters
+         * are used instead. See @ref Sampler-performance-optimization "class documentation"
+         * for more information.
+         * @see @ref unbind(), @ref TextureSet, @fn_gl{BindSamplers},
+         *      eventually @fn_gl{BindSampler}
+         * @requires_gl33 Extension @extension{ARB,sampler_objects}
+         * @requires_gles30 Sampler objects are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Sampler objects are not available in WebGL 1.0.
+         */
+        static void bind(Int firstTextureUnit, std::initializer_list<Sampler*> samplers);
+
+        /**
+         * @brief Unbind any sampler from given texture unit
+         *
+         * The texture bound to given unit will then use its own parameters.
+         * @see @ref bind(), @fn_gl{BindSampler}
+         * @requires_gl33 Extension @extension{ARB,sampler_objects}
+         * @requires_gles30 Sampler objects are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Sampler objects are not available in WebGL 1.0.
+         */
+        static void unbind(Int textureUnit);
+
+        /**
+         * @brief Wrap existing OpenGL sampler object
+         * @param id        OpenGL sampler ID
+         * @param flags     Object creation flags
+         *
+         * The @p id is expected to be of an existing OpenGL sampler object.
+         * Unlike sampler created using constructor, the OpenGL object is by
+         * default not deleted on destruction, use @p flags for different
+         * behavior.
+         * @see @ref release()
+         */
+        static Sampler wrap(GLuint id, ObjectFlags flags = {}) {
+            return Sampler{id, flags};
+        }
+
+        /**
+         * @brief Constructor
+         *
+         * Creates new OpenGL sampler object with default parameters.
+         * @see @ref Sampler(const Configuration&), @ref Sampler(NoCreateT),
+         *      @ref wrap(), @fn_gl{GenSamplers}
+         * @requires_gl33 Extension @extension{ARB,sampler_objects}
+         * @requires_gles30 Sampler objects are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Sampler objects are not available in WebGL 1.0.
+         */
+        explicit Sampler();
+
+        /**
+         * @brief Construct with given configuration
+         *
+         * Creates new OpenGL sampler object and applies all parameters from
+         * @p configuration to it.
+         * @see @ref setConfiguration()
+         */
+        explicit Sampler(const Configuration& configuration);
+
+        /**
+         * @brief Construct without creating the underlying OpenGL object
+         *
+         * The constructed instance is equivalent to moved-from state. Useful
+         * in cases where you will overwrite the instance later anyway. Move
+         * another object over it to make it useful.
+         * @see @ref Sampler(), @ref wrap()
+         */
+        explicit Sampler(NoCreateT) noexcept: _id{0}, _flags{ObjectFlag::DeleteOnDestruction} {}
+
+        /** @brief Copying is not allowed */
+        Sampler(const Sampler&) = delete;
+
+        /** @brief Move constructor */
+        inline Sampler(Sampler&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Deletes associated OpenGL object.
+         * @see @ref wrap(), @ref release(), @fn_gl{DeleteSamplers}
+         */
+        ~Sampler();
+
+        /** @brief Copying is not allowed */
+        Sampler& operator=(const Sampler&) = delete;
+
+        /** @brief Move assignment */
+        inline Sampler& operator=(Sampler&& other) noexcept;
+
+        /** @brief OpenGL sampler ID */
+        GLuint id() const { return _id; }
+
+        /**
+         * @brief Release OpenGL object
+         *
+         * Releases ownership of OpenGL sampler object and returns its ID so it
+         * is not deleted on destruction. The internal state is then
+         * equivalent to moved-from state.
+         * @see @ref wrap()
+         */
+        inline GLuint release();
+
+        #ifndef MAGNUM_TARGET_WEBGL
+        /**
+         * @brief Sampler label
+         *
+         * The result is *not* cached, repeated queries will result in
+         * repeated OpenGL calls. If OpenGL 4.3 is not supported and neither
+         * @extension{KHR,debug} (covered also by @es_extension{ANDROID,extension_pack_es31a})
+         * nor @extension2{EXT,debug_label} desktop or ES extension is
+         * available, this function returns empty string.
+         * @see @fn_gl{GetObjectLabel} or
+         *      @fn_gl_extension2{GetObjectLabel,EXT,debug_label} with
+         *      @def_gl{SAMPLER}
+         * @requires_gles Debug output is not available in WebGL.
+         */
+        std::string label();
+
+        /**
+         * @brief Set sampler label
+         * @return Reference to self (for method chaining)
+         *
+         * Default is empty string. If OpenGL 4.3 is not supported and neither
+         * @extension{KHR,debug} (covered also by @es_extension{ANDROID,extension_pack_es31a})
+         * nor @extension2{EXT,debug_label} desktop or ES extension is
+         * available, this function does nothing.
+         * @see @ref maxLabelLength(), @fn_gl{ObjectLabel} or
+         *      @fn_gl_extension2{LabelObject,EXT,debug_label} with
+         *      @def_gl{SAMPLER}
+         * @requires_gles Debug output is not available in WebGL.
+         */
+        Sampler& setLabel(const std::string& label) {
+            return setLabelInternal({label.data(), label.size()});
+        }
+
+        /** @overload */
+        template<std::size_t size> Sampler& setLabel(const char(&label)[size]) {
+            return setLabelInternal({label, size - 1});
+        }
+        #endif
+
+        /**
+         * @brief Set minification filter
+         * @return Reference to self (for method chaining)
+         *
+         * Initial value is {@ref Filter::Nearest, @ref Mipmap::Linear}.
+         * @see @ref Texture::setMinificationFilter() "*Texture::setMinificationFilter()",
+         *      @fn_gl{SamplerParameter} with @def_gl{TEXTURE_MIN_FILTER}
+         */
+        Sampler& setMinificationFilter(Filter filter, Mipmap mipmap = Mipmap::Base);
+
+        /**
+         * @brief Set magnification filter
+         * @return Reference to self (for method chaining)
+         *
+         * Initial value is @ref Filter::Linear.
+         * @see @ref Texture::setMagnificationFilter() "*Texture::setMagnificationFilter()",
+         *      @fn_gl{SamplerParameter} with @def_gl{TEXTURE_MAG_FILTER}
+         */
+        Sampler& setMagnificationFilter(Filter filter);
+
+        /**
+         * @brief Set wrapping
+         * @return Reference to self (for method chaining)
+         *
+         * Sets wrapping in all three dimensions, the unused ones are ignored
+         * for textures of lower dimension count. Initial value is
+         * @ref Wrapping::Repeat.
+         * @see @ref Texture::setWrapping() "*Texture::setWrapping()",
+         *      @fn_gl{SamplerParameter} with @def_gl{TEXTURE_WRAP_S},
+         *      @def_gl{TEXTURE_WRAP_T}, @def_gl{TEXTURE_WRAP_R}
+         */
+        Sampler& setWrapping(const Array3D<Wrapping>& wrapping);
+
+        /**
+         * @brief Set minimum level-of-detail parameter
+         * @return Reference to self (for method chaining)
+         *
+         * Initial value is `-1000.0f`.
+         * @see @fn_gl{SamplerParameter} with @def_gl{TEXTURE_MIN_LOD}
+         */
+        Sampler& setMinLod(Float lod);
+
+        /**
+         * @brief Set maximum level-of-detail parameter
+         * @return Reference to self (for method chaining)
+         *
+         * Initial value is `1000.0f`.
+         * @see @fn_gl{SamplerParameter} with @def_gl{TEXTURE_MAX_LOD}
+         */
+        Sampler& setMaxLod(Float lod);
+
+        /**
+         * @brief Set max anisotropy
+         * @return Reference to self (for method chaining)
+         *
+         * Default value is `1.0f`, which means no anisotropy. Set to value
+         * greater than `1.0f` for anisotropic filtering. If extension
+         * @extension{EXT,texture_filter_anisotropic} (desktop or ES) is not
+         * available, this function does nothing.
+         * @see @ref maxMaxAnisotropy(), @fn_gl{SamplerParameter} with
+         *      @def_gl{TEXTURE_MAX_ANISOTROPY_EXT}
+         */
+        Sampler& setMaxAnisotropy(Float anisotropy);
+
+        /**
+         * @brief Set depth texture comparison mode
+         * @return Reference to self (for method chaining)
+         *
+         * Initial value is @ref CompareMode::None.
+         * @see @ref setCompareFunction(), @fn_gl{SamplerParameter} with
+         *      @def_gl{TEXTURE_COMPARE_MODE}
+         */
+        Sampler& setCompareMode(CompareMode mode);
+
+        /**
+         * @brief Set depth texture comparison function
+         * @return Reference to self (for method chaining)
+         *
+         * Comparison operator used when comparison mode is set to
+         * @ref CompareMode::CompareRefToTexture. Initial value is
+         * @ref CompareFunction::LessOrEqual.
+         * @see @ref setCompareMode(), @fn_gl{SamplerParameter} with
+         *      @def_gl{TEXTURE_COMPARE_FUNC}
+         */
+        Sampler& setCompareFunction(CompareFunction function);
+
+        /**
+         * @brief Set all parameters from given configuration
+         * @return Reference to self (for method chaining)
+         */
+        Sampler& setConfiguration(const Configuration& configuration);
+
+        /**
+         * @brief Bind the sampler to given texture unit
+         *
+         * If the sampler is already bound to given unit, the function does
+         * nothing.
+         * @see @ref bind(Int, std::initializer_list<Sampler*>),
+         *      @ref unbind(), @fn_gl{BindSampler}
+         */
+        void bind(Int textureUnit);
+
+    private:
+        explicit Sampler(GLuint id, ObjectFlags flags) noexcept: _id{id}, _flags{flags} {}
+
+        #ifndef MAGNUM_TARGET_WEBGL
+        Sampler& MAGNUM_LOCAL setLabelInternal(Containers::ArrayView<const char> label);
+        #endif
+
+        static void MAGNUM_LOCAL bindInternal(GLint firstTextureUnit, Containers::ArrayView<const GLuint> ids);
+        static void MAGNUM_LOCAL bindImplementationFallback(GLint firstTextureUnit, Containers::ArrayView<const GLuint> ids);
+        #ifndef MAGNUM_TARGET_GLES
+        static void MAGNUM_LOCAL bindImplementationMulti(GLint firstTextureUnit, Containers::ArrayView<const GLuint> ids);
+        #endif
+
+        GLuint _id;
+        ObjectFlags _flags;
+        #endif
+};
+
+#ifndef MAGNUM_TARGET_GLES2
+/**
+@brief Sampler configuration
+
+Plain value description of all parameters of a @ref Sampler. Default
+constructed instance matches the initial OpenGL sampler state. Two
+configurations comparing equal result in identical sampling, which is used
+by @ref SamplerRegistry to share sampler objects.
+@requires_gl33 Extension @extension{ARB,sampler_objects}
+@requires_gles30 Sampler objects are not available in OpenGL ES 2.0.
+@requires_webgl20 Sampler objects are not available in WebGL 1.0.
+*/
+class Sampler::Configuration {
+    public:
+        /** @brief Constructor */
+        constexpr /*implicit*/ Configuration() noexcept: _minificationFilter{Filter::Nearest}, _minificationMipmap{Mipmap::Linear}, _magnificationFilter{Filter::Linear}, _wrapping{Wrapping::Repeat}, _minLod{-1000.0f}, _maxLod{1000.0f}, _maxAnisotropy{1.0f}, _compareMode{CompareMode::None}, _compareFunction{CompareFunction::LessOrEqual} {}
+
+        /** @brief Minification filter */
+        constexpr Filter minificationFilter() const { return _minificationFilter; }
+
+        /** @brief Minification mip level selection */
+        constexpr Mipmap minificationMipmap() const { return _minificationMipmap; }
+
+        /**
+         * @brief Set minification filter
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Sampler::setMinificationFilter()
+         */
+        Configuration& setMinificationFilter(Filter filter, Mipmap mipmap = Mipmap::Base) {
+            _minificationFilter = filter;
+            _minificationMipmap = mipmap;
+            return *this;
+        }
+
+        /** @brief Magnification filter */
+        constexpr Filter magnificationFilter() const { return _magnificationFilter; }
+
+        /**
+         * @brief Set magnification filter
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Sampler::setMagnificationFilter()
+         */
+        Configuration& setMagnificationFilter(Filter filter) {
+            _magnificationFilter = filter;
+            return *this;
+        }
+
+        /** @brief Wrapping */
+        constexpr Array3D<Wrapping> wrapping() const { return _wrapping; }
+
+        /**
+         * @brief Set wrapping
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Sampler::setWrapping()
+         */
+        Configuration& setWrapping(const Array3D<Wrapping>& wrapping) {
+            _wrapping = wrapping;
+            return *this;
+        }
+
+        /** @brief Minimum level-of-detail */
+        constexpr Float minLod() const { return _minLod; }
+
+        /**
+         * @brief Set minimum level-of-detail
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Sampler::setMinLod()
+         */
+        Configuration& setMinLod(Float lod) {
+            _minLod = lod;
+            return *this;
+        }
+
+        /** @brief Maximum level-of-detail */
+        constexpr Float maxLod() const { return _maxLod; }
+
+        /**
+         * @brief Set maximum level-of-detail
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Sampler::setMaxLod()
+         */
+        Configuration& setMaxLod(Float lod) {
+            _maxLod = lod;
+            return *this;
+        }
+
+        /** @brief Max anisotropy */
+        constexpr Float maxAnisotropy() const { return _maxAnisotropy; }
+
+        /**
+         * @brief Set max anisotropy
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Sampler::setMaxAnisotropy()
+         */
+        Configuration& setMaxAnisotropy(Float anisotropy) {
+            _maxAnisotropy = anisotropy;
+            return *this;
+        }
+
+        /** @brief Depth texture comparison mode */
+        constexpr CompareMode compareMode() const { return _compareMode; }
+
+        /**
+         * @brief Set depth texture comparison mode
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Sampler::setCompareMode()
+         */
+        Configuration& setCompareMode(CompareMode mode) {
+            _compareMode = mode;
+            return *this;
+        }
+
+        /** @brief Depth texture comparison function */
+        constexpr CompareFunction compareFunction() const { return _compareFunction; }
+
+        /**
+         * @brief Set depth texture comparison function
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Sampler::setCompareFunction()
+         */
+        Configuration& setCompareFunction(CompareFunction function) {
+            _compareFunction = function;
+            return *this;
+        }
+
+        /** @brief Equality comparison */
+        bool operator==(const Configuration& other) const {
+            return _minificationFilter == other._minificationFilter &&
+                _minificationMipmap == other._minificationMipmap &&
+                _magnificationFilter == other._magnificationFilter &&
+                _wrapping == other._wrapping &&
+                _minLod == other._minLod &&
+                _maxLod == other._maxLod &&
+                _maxAnisotropy == other._maxAnisotropy &&
+                _compareMode == other._compareMode &&
+                _compareFunction == other._compareFunction;
+        }
+
+        /** @brief Non-equality comparison */
+        bool operator!=(const Configuration& other) const {
+            return !operator==(other);
+        }
+
+    private:
+        Filter _minificationFilter;
+        Mipmap _minificationMipmap;
+        Filter _magnificationFilter;
+        Array3D<Wrapping> _wrapping;
+        Float _minLod, _maxLod, _maxAnisotropy;
+        CompareMode _compareMode;
+        CompareFunction _compareFunction;
 };
 
+inline Sampler::Sampler(Sampler&& other) noexcept: _id{other._id}, _flags{other._flags} {
+    other._id = 0;
+}
+
+inline Sampler& Sampler::operator=(Sampler&& other) noexcept {
+    using std::swap;
+    swap(_id, other._id);
+    swap(_flags, other._flags);
+    return *this;
+}
+
+inline GLuint Sampler::release() {
+    const GLuint id = _id;
+    _id = 0;
+    return id;
+}
+#endif
+
 /** @debugoperatorclassenum{Magnum::Sampler,Magnum::Sampler::Filter} */
 MAGNUM_EXPORT Debug& operator<<(Debug& debug, Sampler::Filter value);
 
@@ -0,0 +1,56 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SamplerRegistry.h"
+
+namespace Magnum {
+
+SamplerRegistry::SamplerRegistry() = default;
+
+SamplerRegistry::SamplerRegistry(SamplerRegistry&&) noexcept = default;
+
+SamplerRegistry::~SamplerRegistry() = default;
+
+SamplerRegistry& SamplerRegistry::operator=(SamplerRegistry&&) noexcept = default;
+
+Sampler* SamplerRegistry::find(const Sampler::Configuration& configuration) const {
+    for(const auto& sampler: _samplers)
+        if(sampler.first == configuration) return sampler.second.get();
+
+    return nullptr;
+}
+
+Sampler& SamplerRegistry::get(const Sampler::Configuration& configuration) {
+    if(Sampler* const sampler = find(configuration)) return *sampler;
+
+    _samplers.emplace_back(configuration, std::unique_ptr<Sampler>{new Sampler{configuration}});
+    return *_samplers.back().second;
+}
+
+void SamplerRegistry::clear() {
+    _samplers.clear();
+}
+
+}
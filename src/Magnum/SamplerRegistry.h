@@ -0,0 +1,142 @@
+#ifndef Magnum_SamplerRegistry_h
+#define Magnum_SamplerRegistry_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <memory>
+#include <vector>
+
+#include "Magnum/Sampler.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::SamplerRegistry
+ */
+#endif
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum {
+
+/**
+@brief Sampler registry
+
+Owns one @ref Sampler object for each distinct @ref Sampler::Configuration
+requested from it. Scenes usually have thousands of textures but only a
+handful of distinct sampling setups, so instead of setting filtering and
+wrapping on each texture separately, request the sampler for given setup from
+the registry and bind it together with the textures, for example using
+@ref TextureSet:
+
+@code
+SamplerRegistry samplers;
+Sampler& trilinear = samplers.get(Sampler::Configuration{}
+    .setMinificationFilter(Sampler::Filter::Linear, Sampler::Mipmap::Linear)
+    .setMaxAnisotropy(Sampler::maxMaxAnisotropy()));
+Sampler& pixelated = samplers.get(Sampler::Configuration{}
+    .setMinificationFilter(Sampler::Filter::Nearest)
+    .setMagnificationFilter(Sampler::Filter::Nearest)
+    .setWrapping(Sampler::Wrapping::ClampToEdge));
+
+// Returns the same instance as above
+Sampler& alsoTrilinear = samplers.get(Sampler::Configuration{}
+    .setMinificationFilter(Sampler::Filter::Linear, Sampler::Mipmap::Linear)
+    .setMaxAnisotropy(Sampler::maxMaxAnisotropy()));
+@endcode
+
+The lookup is a linear search over the configurations, which is faster than
+hashing for the few samplers an application typically has. The returned
+references stay valid until @ref clear() is called or the registry is
+destroyed. Configuring the returned sampler directly would affect all its
+users and is not tracked by the registry, so don't do that.
+@requires_gl33 Extension @extension{ARB,sampler_objects}
+@requires_gles30 Sampler objects are not available in OpenGL ES 2.0.
+@requires_webgl20 Sampler objects are not available in WebGL 1.0.
+*/
+class MAGNUM_EXPORT SamplerRegistry {
+    public:
+        /** @brief Constructor */
+        explicit SamplerRegistry();
+
+        /** @brief Copying is not allowed */
+        SamplerRegistry(const SamplerRegistry&) = delete;
+
+        /** @brief Move constructor */
+        SamplerRegistry(SamplerRegistry&&) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Deletes all samplers owned by the registry.
+         */
+        ~SamplerRegistry();
+
+        /** @brief Copying is not allowed */
+        SamplerRegistry& operator=(const SamplerRegistry&) = delete;
+
+        /** @brief Move assignment */
+        SamplerRegistry& operator=(SamplerRegistry&&) noexcept;
+
+        /** @brief Count of distinct samplers in the registry */
+        std::size_t size() const { return _samplers.size(); }
+
+        /** @brief Whether the registry is empty */
+        bool isEmpty() const { return _samplers.empty(); }
+
+        /**
+         * @brief Find sampler for given configuration
+         *
+         * Returns `nullptr` if there is no sampler with given configuration
+         * in the registry. Doesn't create any OpenGL object.
+         * @see @ref get()
+         */
+        Sampler* find(const Sampler::Configuration& configuration) const;
+
+        /**
+         * @brief Get sampler for given configuration
+         *
+         * If there is a sampler with the same configuration already, returns
+         * it, otherwise creates a new sampler with given configuration and
+         * adds it to the registry.
+         * @see @ref find()
+         */
+        Sampler& get(const Sampler::Configuration& configuration);
+
+        /**
+         * @brief Delete all samplers
+         *
+         * All references previously returned from @ref get() are invalidated.
+         */
+        void clear();
+
+    private:
+        std::vector<std::pair<Sampler::Configuration, std::unique_ptr<Sampler>>> _samplers;
+};
+
+}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
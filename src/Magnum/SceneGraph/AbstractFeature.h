@@ -158,6 +158,7 @@ template<UnsignedInt dimensions, class T> class AbstractFeature
 {
     friend Containers::LinkedList<AbstractFeature<dimensions, T>>;
     friend Containers::LinkedListItem<AbstractFeature<dimensions, T>, AbstractObject<dimensions, T>>;
+    friend AbstractObject<dimensions, T>;
     template<class> friend class Object;
 
     public:
@@ -176,6 +177,18 @@ template<UnsignedInt dimensions, class T> class AbstractFeature
 
         virtual ~AbstractFeature() = 0;
 
+        /**
+         * @brief Destroy the feature
+         *
+         * Equivalent to @cpp delete this @ce for features allocated with
+         * @cpp new @ce, returns the memory back to the pool for features
+         * allocated using @ref AbstractObject::addFeature() from a scene
+         * with @ref Scene::setPoolAllocator() "pool allocator" set. Expects
+         * that the feature is not allocated on stack or as a part of another
+         * object.
+         */
+        void destroy();
+
         /** @brief Object holding this feature */
         AbstractObject<dimensions, T>& object() {
             return *Containers::LinkedListItem<AbstractFeature<dimensions, T>, AbstractObject<dimensions, T>>::list();
@@ -222,6 +235,13 @@ template<UnsignedInt dimensions, class T> class AbstractFeature
             return _cachedTransformations;
         }
 
+        /**
+         * @brief Whether the feature can be cleaned from a worker thread
+         *
+         * @see @ref setCleanThreadSafe()
+         */
+        bool isCleanThreadSafe() const { return _cleanThreadSafe; }
+
     protected:
         /**
          * @brief Set transformations to be cached
@@ -237,6 +257,19 @@ template<UnsignedInt dimensions, class T> class AbstractFeature
             _cachedTransformations = transformations;
         }
 
+        /**
+         * @brief Set whether the feature can be cleaned from a worker thread
+         *
+         * If set to `false`, @ref clean() and @ref cleanInverted() are always
+         * called from the thread calling
+         * @ref FlatTransformationCache::update(AbstractTaskExecutor&), after
+         * all parallel work is done. Set it to `false` if the implementation
+         * accesses data shared with other objects. Default is `true`.
+         */
+        void setCleanThreadSafe(bool threadSafe) {
+            _cleanThreadSafe = threadSafe;
+        }
+
         /**
          * @brief Mark feature as dirty
          *
@@ -278,6 +311,7 @@ template<UnsignedInt dimensions, class T> class AbstractFeature
 
     private:
         CachedTransformations _cachedTransformations;
+        bool _cleanThreadSafe, _pooled;
 };
 
 /**
@@ -33,12 +33,24 @@
 
 namespace Magnum { namespace SceneGraph {
 
-template<UnsignedInt dimensions, class T> AbstractFeature<dimensions, T>::AbstractFeature(AbstractObject<dimensions, T>& object) {
+template<UnsignedInt dimensions, class T> AbstractFeature<dimensions, T>::AbstractFeature(AbstractObject<dimensions, T>& object): _cleanThreadSafe{true}, _pooled{false} {
     object.Containers::template LinkedList<AbstractFeature<dimensions, T>>::insert(this);
 }
 
 template<UnsignedInt dimensions, class T> AbstractFeature<dimensions, T>::~AbstractFeature() = default;
 
+template<UnsignedInt dimensions, class T> void AbstractFeature<dimensions, T>::destroy() {
+    if(!_pooled) {
+        delete this;
+        return;
+    }
+
+    /* The feature might not be the first base of the allocated type */
+    void* const memory = dynamic_cast<void*>(this);
+    this->~AbstractFeature();
+    PoolAllocator::deallocate(memory);
+}
+
 template<UnsignedInt dimensions, class T> void AbstractFeature<dimensions, T>::markDirty() {}
 
 template<UnsignedInt dimensions, class T> void AbstractFeature<dimensions, T>::clean(const MatrixTypeFor<dimensions, T>&) {}
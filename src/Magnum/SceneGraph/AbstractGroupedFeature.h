@@ -79,7 +79,7 @@ template<UnsignedInt dimensions, class Derived, class T> class AbstractGroupedFe
          * Adds the feature to the object and to group, if specified.
          * @see @ref FeatureGroup::add()
          */
-        explicit AbstractGroupedFeature(AbstractObject<dimensions, T>& object, FeatureGroup<dimensions, Derived, T>* group = nullptr): AbstractFeature<dimensions, T>(object), _group(nullptr) {
+        explicit AbstractGroupedFeature(AbstractObject<dimensions, T>& object, FeatureGroup<dimensions, Derived, T>* group = nullptr): AbstractFeature<dimensions, T>(object), _group(nullptr), _groupIndex(0) {
             if(group) group->add(static_cast<Derived&>(*this));
         }
 
@@ -103,8 +103,20 @@ template<UnsignedInt dimensions, class Derived, class T> class AbstractGroupedFe
             return _group;
         }
 
+        /**
+         * @brief Index in the group
+         *
+         * Position of the feature in @ref group(), i.e. `(*group())[index]`
+         * is this feature. The index may change when other features are
+         * removed from the group, see @ref SceneGraph-FeatureGroup-removal
+         * for details. Unspecified if the feature doesn't belong to any
+         * group.
+         */
+        std::size_t groupIndex() const { return _groupIndex; }
+
     private:
         FeatureGroup<dimensions, Derived, T>* _group;
+        std::size_t _groupIndex;
 };
 
 /**
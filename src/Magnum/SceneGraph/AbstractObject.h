@@ -30,10 +30,13 @@
  */
 
 #include <functional>
+#include <new>
 #include <vector>
+#include <Corrade/Containers/ArrayView.h>
 #include <Corrade/Containers/LinkedList.h>
 
 #include "Magnum/DimensionTraits.h"
+#include "Magnum/SceneGraph/PoolAllocator.h"
 #include "Magnum/SceneGraph/SceneGraph.h"
 #include "Magnum/SceneGraph/visibility.h"
 
@@ -155,10 +158,19 @@ template<UnsignedInt dimensions, class T> class AbstractObject
          * @brief Add a feature
          *
          * Calling `object.addFeature<MyFeature>(args...)` is equivalent to
-         * `new MyFeature{object, args...}`.
+         * `new MyFeature{object, args...}`. If the object is part of a scene
+         * with @ref Scene::setPoolAllocator() "pool allocator" set, the
+         * feature is allocated from the pool instead. In that case it has to
+         * be destroyed using @ref AbstractFeature::destroy() and not using
+         * @cpp delete @ce.
          */
         template<class U, class ...Args> U& addFeature(Args... args) {
-            return *(new U{*this, std::forward<Args>(args)...});
+            PoolAllocator* const allocator = doPoolAllocator();
+            if(!allocator) return *(new U{*this, std::forward<Args>(args)...});
+
+            U* const feature = new(allocator->allocate(sizeof(U), alignof(U))) U{*this, std::forward<Args>(args)...};
+            static_cast<AbstractFeature<dimensions, T>&>(*feature)._pooled = true;
+            return *feature;
         }
 
         /**
@@ -210,6 +222,24 @@ template<UnsignedInt dimensions, class T> class AbstractObject
             return doTransformationMatrices(objects, initialTransformationMatrix);
         }
 
+        /**
+         * @brief Transformation matrices of given set of objects relative to this object into existing storage
+         * @param[in] objects   Objects
+         * @param[out] out      Where to put the matrices. Expected to have
+         *      the same size as @p objects.
+         * @param initialTransformationMatrix Matrix to premultiply all
+         *      transformations with
+         *
+         * Same as @ref transformationMatrices(), but the temporary data
+         * needed for the computation are kept in the scene and reused
+         * across calls, so nothing is allocated once they're large enough.
+         * @warning This function cannot check if all objects are of the same
+         *      @ref Object type.
+         */
+        void transformationMatricesInto(Containers::ArrayView<const std::reference_wrapper<AbstractObject<dimensions, T>>> objects, Containers::ArrayView<MatrixType> out, const MatrixType& initialTransformationMatrix = MatrixType()) const {
+            doTransformationMatricesInto(objects, out, initialTransformationMatrix);
+        }
+
         /*@}*/
 
         /**
@@ -278,9 +308,12 @@ template<UnsignedInt dimensions, class T> class AbstractObject
         virtual AbstractObject<dimensions, T>* doParent() = 0;
         virtual const AbstractObject<dimensions, T>* doParent() const = 0;
 
+        virtual PoolAllocator* doPoolAllocator() const = 0;
+
         virtual MatrixType doTransformationMatrix() const = 0;
         virtual MatrixType doAbsoluteTransformationMatrix() const = 0;
         virtual std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, const MatrixType& initialTransformationMatrix) const = 0;
+        virtual void doTransformationMatricesInto(Containers::ArrayView<const std::reference_wrapper<AbstractObject<dimensions, T>>> objects, Containers::ArrayView<MatrixType> out, const MatrixType& initialTransformationMatrix) const = 0;
 
         virtual bool doIsDirty() const = 0;
         virtual void doSetDirty() = 0;
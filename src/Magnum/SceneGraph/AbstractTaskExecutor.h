@@ -0,0 +1,114 @@
+#ifndef Magnum_SceneGraph_AbstractTaskExecutor_h
+#define Magnum_SceneGraph_AbstractTaskExecutor_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::AbstractTaskExecutor
+ */
+
+#include <cstddef>
+
+#include "Magnum/SceneGraph/SceneGraph.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Base for task executors
+
+Provides a way to distribute independent pieces of work, such as updating
+independent subtrees in @ref FlatTransformationCache::update(AbstractTaskExecutor&),
+across multiple threads. The library itself doesn't spawn any threads, it's up
+to the application to implement @ref doExecute() using a thread pool or
+whatever else it has at hand. @ref TaskSchedulerExecutor runs the tasks on
+the threads of an @ref Magnum::TaskScheduler "TaskScheduler".
+
+## Subclassing
+
+The implementation is expected to call given task for every index in range
+@f$ [ 0, count ) @f$ exactly once, in any order and possibly in parallel,
+passing the @p state pointer through. The function must not return until all
+tasks are finished. Minimal sequential implementation:
+@code
+class SequentialExecutor: public SceneGraph::AbstractTaskExecutor {
+    private:
+        void doExecute(std::size_t count, Task task, void* state) override {
+            for(std::size_t i = 0; i != count; ++i) task(state, i);
+        }
+};
+@endcode
+*/
+class MAGNUM_SCENEGRAPH_EXPORT AbstractTaskExecutor {
+    public:
+        /**
+         * @brief Task
+         *
+         * The first parameter is the state pointer passed to @ref execute(),
+         * the second is task index.
+         */
+        typedef void(*Task)(void*, std::size_t);
+
+        explicit AbstractTaskExecutor();
+
+        /** @brief Copying is not allowed */
+        AbstractTaskExecutor(const AbstractTaskExecutor&) = delete;
+
+        /** @brief Moving is not allowed */
+        AbstractTaskExecutor(AbstractTaskExecutor&&) = delete;
+
+        virtual ~AbstractTaskExecutor();
+
+        /** @brief Copying is not allowed */
+        AbstractTaskExecutor& operator=(const AbstractTaskExecutor&) = delete;
+
+        /** @brief Moving is not allowed */
+        AbstractTaskExecutor& operator=(AbstractTaskExecutor&&) = delete;
+
+        /**
+         * @brief Execute tasks
+         * @param count     Task count
+         * @param task      Task function
+         * @param state     State passed to each task
+         *
+         * Calls @p task for all indices in range @f$ [ 0, count ) @f$ and
+         * waits until all of them are finished. If @p count is `0`, does
+         * nothing.
+         * @see @ref doExecute()
+         */
+        void execute(std::size_t count, Task task, void* state);
+
+    private:
+        /**
+         * @brief Implementation for @ref execute()
+         *
+         * Called only if @p count is not zero.
+         */
+        virtual void doExecute(std::size_t count, Task task, void* state) = 0;
+};
+
+}}
+
+#endif
@@ -142,7 +142,7 @@ errors. See also @ref compilation-speedup-hpp for more information.
 -   @ref Animable3D, @ref AnimableGroup3D
 
 @see @ref scenegraph, @ref BasicAnimable2D, @ref BasicAnimable3D,
-    @ref Animable2D, @ref Animable3D, @ref AnimableGroup
+    @ref Animable2D, @ref Animable3D, @ref AnimableGroup, @ref TrackAnimator
 */
 template<UnsignedInt dimensions, class T> class Animable: public AbstractGroupedFeature<dimensions, Animable<dimensions, T>, T> {
     friend AnimableGroup<dimensions, T>;
@@ -29,9 +29,14 @@
  * @brief Class @ref Magnum::SceneGraph::Camera, enum @ref Magnum::SceneGraph::AspectRatioPolicy, alias @ref Magnum::SceneGraph::BasicCamera2D, @ref Magnum::SceneGraph::BasicCamera3D, typedef @ref Magnum::SceneGraph::Camera2D, @ref Magnum::SceneGraph::Camera3D
  */
 
+#include <functional>
+#include <utility>
+#include <vector>
+
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/SceneGraph/AbstractFeature.h"
+#include "Magnum/SceneGraph/Drawable.h"
 #include "Magnum/SceneGraph/visibility.h"
 
 #ifdef CORRADE_TARGET_WINDOWS /* I so HATE windef.h */
@@ -93,6 +98,20 @@ errors. See also @ref compilation-speedup-hpp for more information.
 */
 template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<dimensions, T> {
     public:
+        /**
+         * @brief Drawable with its transformation relative to the camera
+         *
+         * @see @ref drawableTransformations()
+         */
+        typedef std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>> DrawableTransformation;
+
+        /**
+         * @brief Drawable with its precomputed matrices
+         *
+         * @see @ref drawableMatrices()
+         */
+        typedef std::pair<std::reference_wrapper<Drawable<dimensions, T>>, DrawableMatrices<dimensions, T>> DrawableWithMatrices;
+
         /**
          * @brief Constructor
          * @param object        Object holding the camera
@@ -235,10 +254,143 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
         /**
          * @brief Draw
          *
-         * Draws given group of drawables.
+         * Draws given group of drawables. Transformations of the drawables
+         * are computed using @ref drawableTransformations(), thus no
+         * allocation is done unless the group grew since the previous call.
          */
         virtual void draw(DrawableGroup<dimensions, T>& group);
 
+        /**
+         * @brief Draw masked group
+         *
+         * Draws only drawables at positions set in @p mask, for example a
+         * visible set computed by an occlusion culling pass in the previous
+         * frame. Unlike building a separate group, the mask is iterated
+         * directly, skipping whole empty words, so nothing is allocated.
+         * Expects that the mask has the same size as the group.
+         * @see @ref drawableTransformations(DrawableGroup<dimensions, T>&, const Math::BitArray&)
+         */
+        void draw(DrawableGroup<dimensions, T>& group, const Math::BitArray& mask);
+
+        /**
+         * @brief Compute transformations of given group of drawables
+         *
+         * Computes transformations of all drawables in the group relative to
+         * the camera in the same order as they are in the group. The result
+         * is stored in a scratch storage owned by the camera which is reused
+         * on every call, so once it is large enough no allocation happens.
+         * The returned reference is valid until next call to this function or
+         * to @ref draw().
+         *
+         * Useful for submitting the whole group in one go instead of calling
+         * @ref Drawable::draw() on each drawable separately:
+         * @code
+         * for(const SceneGraph::Camera3D::DrawableTransformation& d: camera.drawableTransformations(drawables)) {
+         *     MyDrawable& drawable = static_cast<MyDrawable&>(d.first.get());
+         *     // gather data for batched draw using d.second...
+         * }
+         *
+         * // submit the batch...
+         * @endcode
+         *
+         * Drawables which have a bounding volume and are outside of the
+         * camera frustum are not included in the output, see
+         * @ref SceneGraph-Drawable-culling "Drawable frustum culling" for more
+         * information. All drawables are expected to be in the same scene as
+         * the camera.
+         * @see @ref testedDrawableCount(), @ref culledDrawableCount()
+         */
+        const std::vector<DrawableTransformation>& drawableTransformations(DrawableGroup<dimensions, T>& group);
+
+        /**
+         * @brief Compute transformations of masked group of drawables
+         *
+         * Same as @ref drawableTransformations(DrawableGroup<dimensions, T>&),
+         * but includes only drawables at positions set in @p mask. Expects
+         * that the mask has the same size as the group.
+         */
+        const std::vector<DrawableTransformation>& drawableTransformations(DrawableGroup<dimensions, T>& group, const Math::BitArray& mask);
+
+        /**
+         * @brief Compute transformations of given group of drawables for custom view
+         *
+         * Same as @ref drawableTransformations(DrawableGroup<dimensions, T>&),
+         * but the transformations are computed relative to @p cameraMatrix
+         * and the drawables are culled against frustum of @p projectionMatrix
+         * instead of the camera's own matrices. Useful for rendering the same
+         * group from a different point of view, for example into shadow map
+         * cascades of a light. The output shares the scratch storage with
+         * the other overload and updates @ref testedDrawableCount() and
+         * @ref culledDrawableCount() as well. The camera doesn't need to be
+         * part of any scene in this case.
+         */
+        const std::vector<DrawableTransformation>& drawableTransformations(DrawableGroup<dimensions, T>& group, const MatrixTypeFor<dimensions, T>& cameraMatrix, const MatrixTypeFor<dimensions, T>& projectionMatrix);
+
+        /**
+         * @brief Whether precomputed drawable matrices are enabled
+         *
+         * @see @ref setDrawableMatricesEnabled()
+         */
+        bool isDrawableMatricesEnabled() const { return _drawableMatricesEnabled; }
+
+        /**
+         * @brief Enable or disable precomputed drawable matrices
+         * @return Reference to self (for method chaining)
+         *
+         * If enabled, @ref draw() computes the matrices for all visible
+         * drawables in one batch using @ref drawableMatrices() and calls
+         * @ref Drawable::drawWithMatrices() instead of @ref Drawable::draw().
+         * Useful if most drawables need the projection and normal matrix, as
+         * it removes the redundant per-draw matrix math. Disabled by default.
+         */
+        Camera<dimensions, T>& setDrawableMatricesEnabled(bool enabled) {
+            _drawableMatricesEnabled = enabled;
+            return *this;
+        }
+
+        /**
+         * @brief Compute matrices of given group of drawables
+         *
+         * Same as @ref drawableTransformations(DrawableGroup<dimensions, T>&),
+         * but in addition the transformation of each drawable is multiplied
+         * with @ref projectionMatrix() and its normal matrix is computed.
+         * The normal matrix is calculated from cross products of the
+         * rotation and scaling columns instead of a full inversion. The
+         * result is stored in a scratch storage owned by the camera, the
+         * returned reference is valid until next call to this function or to
+         * @ref draw().
+         * @see @ref setDrawableMatricesEnabled()
+         */
+        const std::vector<DrawableWithMatrices>& drawableMatrices(DrawableGroup<dimensions, T>& group);
+
+        /**
+         * @brief Compute matrices of masked group of drawables
+         *
+         * Same as @ref drawableMatrices(DrawableGroup<dimensions, T>&), but
+         * includes only drawables at positions set in @p mask. Expects that
+         * the mask has the same size as the group.
+         */
+        const std::vector<DrawableWithMatrices>& drawableMatrices(DrawableGroup<dimensions, T>& group, const Math::BitArray& mask);
+
+        /**
+         * @brief Count of drawables tested for visibility
+         *
+         * Count of drawables with a bounding volume in the last call to
+         * @ref draw() or @ref drawableTransformations().
+         * @see @ref Drawable::boundingVolume(), @ref culledDrawableCount()
+         */
+        std::size_t testedDrawableCount() const { return _testedDrawableCount; }
+
+        /**
+         * @brief Count of culled drawables
+         *
+         * Count of drawables which were found to be outside of the camera
+         * frustum and thus skipped in the last call to @ref draw() or
+         * @ref drawableTransformations().
+         * @see @ref testedDrawableCount()
+         */
+        std::size_t culledDrawableCount() const { return _culledDrawableCount; }
+
     private:
         /** Recalculates camera matrix */
         void cleanInverted(const MatrixTypeFor<dimensions, T>& invertedAbsoluteTransformationMatrix) override {
@@ -247,6 +399,9 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
 
         void fixAspectRatio();
 
+        const std::vector<DrawableTransformation>& drawableTransformationsInternal(DrawableGroup<dimensions, T>& group, const MatrixTypeFor<dimensions, T>& cameraMatrix, const MatrixTypeFor<dimensions, T>& projectionMatrix, const Math::BitArray* mask);
+        const std::vector<DrawableWithMatrices>& drawableMatricesInternal(const std::vector<DrawableTransformation>& transformations);
+
         MatrixTypeFor<dimensions, T> _rawProjectionMatrix;
         AspectRatioPolicy _aspectRatioPolicy;
 
@@ -254,6 +409,13 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
         MatrixTypeFor<dimensions, T> _cameraMatrix;
 
         Vector2i _viewport;
+
+        std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> _objects;
+        std::vector<MatrixTypeFor<dimensions, T>> _objectTransformationMatrices;
+        std::vector<DrawableTransformation> _drawableTransformations;
+        std::vector<DrawableWithMatrices> _drawableMatrices;
+        std::size_t _testedDrawableCount, _culledDrawableCount;
+        bool _drawableMatricesEnabled;
 };
 
 /**
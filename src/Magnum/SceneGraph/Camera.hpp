@@ -29,7 +29,12 @@
  * @brief @ref compilation-speedup-hpp "Template implementation" for @ref Camera.h
  */
 
+#include <algorithm>
+
+#include "Magnum/Math/BitArray.h"
+#include "Magnum/Math/Frustum.h"
 #include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Geometry/Intersection.h"
 #include "Magnum/SceneGraph/Camera.h"
 #include "Magnum/SceneGraph/Drawable.h"
 
@@ -53,9 +58,86 @@ template<UnsignedInt dimensions, class T> MatrixTypeFor<dimensions, T> aspectRat
         Math::Vector2<T>(T(1), relativeAspectRatio.x()/relativeAspectRatio.y()), T(1)));
 }
 
+/* Normal matrix as inverted transposed rotation and scaling part, which is
+   the cofactor matrix divided by determinant. That's just cross products of
+   the columns, no need to go through a full inversion. */
+template<class T> Math::Matrix2x2<T> normalMatrix(const Math::Matrix3<T>& matrix) {
+    const Math::Vector2<T> a = matrix[0].xy();
+    const Math::Vector2<T> b = matrix[1].xy();
+    const T invertedDeterminant = T(1)/(a.x()*b.y() - b.x()*a.y());
+    return {Math::Vector2<T>{b.y(), -b.x()}*invertedDeterminant,
+            Math::Vector2<T>{-a.y(), a.x()}*invertedDeterminant};
+}
+
+template<class T> Math::Matrix3x3<T> normalMatrix(const Math::Matrix4<T>& matrix) {
+    const Math::Vector3<T> a = matrix[0].xyz();
+    const Math::Vector3<T> b = matrix[1].xyz();
+    const Math::Vector3<T> c = matrix[2].xyz();
+    const Math::Vector3<T> bc = Math::cross(b, c);
+    const T invertedDeterminant = T(1)/Math::dot(a, bc);
+    return {bc*invertedDeterminant,
+            Math::cross(c, a)*invertedDeterminant,
+            Math::cross(a, b)*invertedDeterminant};
+}
+
+/* Frustum culling of drawables, the frustum planes are extracted from the
+   projection matrix and the tests are done in camera space */
+template<UnsignedInt, class> class Culling;
+
+template<class T> class Culling<2, T> {
+    public:
+        explicit Culling(const Math::Matrix3<T>& projectionMatrix) {
+            for(std::size_t i = 0; i != 2; ++i) {
+                _frustum[2*i] = projectionMatrix.row(2) + projectionMatrix.row(i);
+                _frustum[2*i + 1] = projectionMatrix.row(2) - projectionMatrix.row(i);
+            }
+            for(Math::Vector3<T>& line: _frustum) line /= line.xy().length();
+        }
+
+        bool isVisible(const Math::Matrix3<T>& transformationMatrix, const Drawable<2, T>& drawable) const {
+            const Math::Vector2<T> center = transformationMatrix.transformPoint(drawable.boundingCenter());
+            const Math::Matrix2x2<T> rotationScaling = transformationMatrix.rotationScaling();
+            const Math::Vector2<T> extent = drawable.boundingVolume() == BoundingVolume::Sphere ?
+                Math::Vector2<T>{drawable.boundingExtent().x()*std::sqrt(std::max(rotationScaling[0].dot(), rotationScaling[1].dot()))} :
+                Math::Vector2<T>{Math::abs(rotationScaling[0])*drawable.boundingExtent().x() + Math::abs(rotationScaling[1])*drawable.boundingExtent().y()};
+
+            /* In 2D the sphere (i.e. circle) test is equivalent to the box
+               test with equal extents, as the lines are axis-aligned */
+            for(const Math::Vector3<T>& line: _frustum)
+                if(Math::dot(line.xy(), center) + line.z() < -Math::dot(Math::abs(line.xy()), extent)) return false;
+            return true;
+        }
+
+    private:
+        Math::Vector3<T> _frustum[4];
+};
+
+template<class T> class Culling<3, T> {
+    public:
+        explicit Culling(const Math::Matrix4<T>& projectionMatrix): _frustum{Math::Frustum<T>::fromMatrix(projectionMatrix)} {}
+
+        bool isVisible(const Math::Matrix4<T>& transformationMatrix, const Drawable<3, T>& drawable) const {
+            const Math::Vector3<T> center = transformationMatrix.transformPoint(drawable.boundingCenter());
+            const Math::Matrix3x3<T> rotationScaling = transformationMatrix.rotationScaling();
+
+            /* Radius is scaled by the largest scaling factor */
+            if(drawable.boundingVolume() == BoundingVolume::Sphere)
+                return Math::Geometry::Intersection::sphereFrustum(center, drawable.boundingExtent().x()*std::sqrt(std::max({rotationScaling[0].dot(), rotationScaling[1].dot(), rotationScaling[2].dot()})), _frustum);
+
+            /* Box extents are transformed by absolute value of the rotation
+               and scaling part, giving an axis-aligned box that encloses the
+               transformed one */
+            const Math::Vector3<T> extent = Math::abs(rotationScaling[0])*drawable.boundingExtent().x() + Math::abs(rotationScaling[1])*drawable.boundingExtent().y() + Math::abs(rotationScaling[2])*drawable.boundingExtent().z();
+            return Math::Geometry::Intersection::aabbFrustum(center, extent, _frustum);
+        }
+
+    private:
+        Math::Frustum<T> _frustum;
+};
+
 }
 
-template<UnsignedInt dimensions, class T> Camera<dimensions, T>::Camera(AbstractObject<dimensions, T>& object): AbstractFeature<dimensions, T>(object), _aspectRatioPolicy(AspectRatioPolicy::NotPreserved) {
+template<UnsignedInt dimensions, class T> Camera<dimensions, T>::Camera(AbstractObject<dimensions, T>& object): AbstractFeature<dimensions, T>(object), _aspectRatioPolicy(AspectRatioPolicy::NotPreserved), _testedDrawableCount{}, _culledDrawableCount{}, _drawableMatricesEnabled{false} {
     AbstractFeature<dimensions, T>::setCachedTransformations(CachedTransformation::InvertedAbsolute);
 }
 
@@ -83,23 +165,122 @@ template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::setViewpor
 }
 
 template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(DrawableGroup<dimensions, T>& group) {
-    AbstractObject<dimensions, T>* scene = AbstractFeature<dimensions, T>::object().scene();
-    CORRADE_ASSERT(scene, "Camera::draw(): cannot draw when camera is not part of any scene", );
+    CORRADE_ASSERT((AbstractFeature<dimensions, T>::object().scene()), "Camera::draw(): cannot draw when camera is not part of any scene", );
+
+    /* Perform the drawing */
+    if(_drawableMatricesEnabled) {
+        for(const DrawableWithMatrices& drawableMatrices: this->drawableMatrices(group))
+            drawableMatrices.first.get().drawWithMatrices(drawableMatrices.second, *this);
+        return;
+    }
+
+    for(const DrawableTransformation& drawableTransformation: drawableTransformations(group))
+        drawableTransformation.first.get().draw(drawableTransformation.second, *this);
+}
+
+template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(DrawableGroup<dimensions, T>& group, const Math::BitArray& mask) {
+    CORRADE_ASSERT((AbstractFeature<dimensions, T>::object().scene()), "Camera::draw(): cannot draw when camera is not part of any scene", );
+
+    if(_drawableMatricesEnabled) {
+        for(const DrawableWithMatrices& drawableMatrices: this->drawableMatrices(group, mask))
+            drawableMatrices.first.get().drawWithMatrices(drawableMatrices.second, *this);
+        return;
+    }
+
+    for(const DrawableTransformation& drawableTransformation: drawableTransformations(group, mask))
+        drawableTransformation.first.get().draw(drawableTransformation.second, *this);
+}
+
+template<UnsignedInt dimensions, class T> auto Camera<dimensions, T>::drawableTransformations(DrawableGroup<dimensions, T>& group) -> const std::vector<DrawableTransformation>& {
+    CORRADE_ASSERT((AbstractFeature<dimensions, T>::object().scene()), "Camera::drawableTransformations(): camera is not part of any scene", _drawableTransformations);
 
     /* Compute camera matrix */
     AbstractFeature<dimensions, T>::object().setClean();
 
-    /* Compute transformations of all objects in the group relative to the camera */
-    std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> objects;
-    objects.reserve(group.size());
-    for(std::size_t i = 0; i != group.size(); ++i)
-        objects.push_back(group[i].object());
-    std::vector<MatrixTypeFor<dimensions, T>> transformations =
-        scene->transformationMatrices(objects, _cameraMatrix);
+    return drawableTransformationsInternal(group, _cameraMatrix, _projectionMatrix, nullptr);
+}
 
-    /* Perform the drawing */
-    for(std::size_t i = 0; i != transformations.size(); ++i)
-        group[i].draw(transformations[i], *this);
+template<UnsignedInt dimensions, class T> auto Camera<dimensions, T>::drawableTransformations(DrawableGroup<dimensions, T>& group, const Math::BitArray& mask) -> const std::vector<DrawableTransformation>& {
+    CORRADE_ASSERT((AbstractFeature<dimensions, T>::object().scene()), "Camera::drawableTransformations(): camera is not part of any scene", _drawableTransformations);
+    CORRADE_ASSERT(mask.size() == group.size(), "Camera::drawableTransformations(): expected mask of" << group.size() << "bits but got" << mask.size(), _drawableTransformations);
+
+    /* Compute camera matrix */
+    AbstractFeature<dimensions, T>::object().setClean();
+
+    return drawableTransformationsInternal(group, _cameraMatrix, _projectionMatrix, &mask);
+}
+
+template<UnsignedInt dimensions, class T> auto Camera<dimensions, T>::drawableTransformations(DrawableGroup<dimensions, T>& group, const MatrixTypeFor<dimensions, T>& cameraMatrix, const MatrixTypeFor<dimensions, T>& projectionMatrix) -> const std::vector<DrawableTransformation>& {
+    return drawableTransformationsInternal(group, cameraMatrix, projectionMatrix, nullptr);
+}
+
+template<UnsignedInt dimensions, class T> auto Camera<dimensions, T>::drawableTransformationsInternal(DrawableGroup<dimensions, T>& group, const MatrixTypeFor<dimensions, T>& cameraMatrix, const MatrixTypeFor<dimensions, T>& projectionMatrix, const Math::BitArray* const mask) -> const std::vector<DrawableTransformation>& {
+    _testedDrawableCount = _culledDrawableCount = 0;
+    _drawableTransformations.clear();
+
+    /* Gather objects of all selected drawables. With a mask, jump directly
+       from one set bit to another. */
+    _objects.clear();
+    _objects.reserve(mask ? mask->count() : group.size());
+    for(std::size_t i = mask ? mask->findNext(0) : 0; i < group.size(); i = mask ? mask->findNext(i + 1) : i + 1)
+        _objects.push_back(group[i].object());
+    if(_objects.empty()) return _drawableTransformations;
+
+    /* Compute transformations of all objects relative to the camera in one
+       pass over the hierarchy, so each object on the way to the root is
+       visited only once. The storage is reused from previous call, so
+       nothing is allocated unless the group grew. */
+    AbstractObject<dimensions, T>* const scene = _objects.front().get().scene();
+    CORRADE_ASSERT(scene, "Camera::drawableTransformations(): drawables are not part of any scene", _drawableTransformations);
+    _objectTransformationMatrices.resize(_objects.size());
+    scene->transformationMatricesInto(
+        {_objects.data(), _objects.size()},
+        {_objectTransformationMatrices.data(), _objectTransformationMatrices.size()},
+        cameraMatrix);
+
+    /* Skip drawables which are outside of the frustum */
+    const Implementation::Culling<dimensions, T> culling{projectionMatrix};
+    _drawableTransformations.reserve(_objects.size());
+    std::size_t object = 0;
+    for(std::size_t i = mask ? mask->findNext(0) : 0; i < group.size(); i = mask ? mask->findNext(i + 1) : i + 1, ++object) {
+        Drawable<dimensions, T>& drawable = group[i];
+        const MatrixTypeFor<dimensions, T>& transformationMatrix = _objectTransformationMatrices[object];
+
+        if(drawable.boundingVolume() != BoundingVolume::None) {
+            ++_testedDrawableCount;
+            if(!culling.isVisible(transformationMatrix, drawable)) {
+                ++_culledDrawableCount;
+                continue;
+            }
+        }
+
+        _drawableTransformations.emplace_back(drawable, transformationMatrix);
+    }
+
+    return _drawableTransformations;
+}
+
+template<UnsignedInt dimensions, class T> auto Camera<dimensions, T>::drawableMatrices(DrawableGroup<dimensions, T>& group) -> const std::vector<DrawableWithMatrices>& {
+    return drawableMatricesInternal(drawableTransformations(group));
+}
+
+template<UnsignedInt dimensions, class T> auto Camera<dimensions, T>::drawableMatrices(DrawableGroup<dimensions, T>& group, const Math::BitArray& mask) -> const std::vector<DrawableWithMatrices>& {
+    return drawableMatricesInternal(drawableTransformations(group, mask));
+}
+
+template<UnsignedInt dimensions, class T> auto Camera<dimensions, T>::drawableMatricesInternal(const std::vector<DrawableTransformation>& transformations) -> const std::vector<DrawableWithMatrices>& {
+    /* The storage is reused from previous call the same way as for the
+       transformations. The projection is multiplied in a tight loop, which
+       goes through the SIMD matrix multiplication if enabled. */
+    _drawableMatrices.clear();
+    _drawableMatrices.reserve(transformations.size());
+    for(const DrawableTransformation& transformation: transformations)
+        _drawableMatrices.emplace_back(transformation.first, DrawableMatrices<dimensions, T>{
+            transformation.second,
+            _projectionMatrix*transformation.second,
+            Implementation::normalMatrix(transformation.second)});
+
+    return _drawableMatrices;
 }
 
 }}
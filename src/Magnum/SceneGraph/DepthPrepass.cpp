@@ -0,0 +1,152 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DepthPrepass.hpp"
+
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Context.h"
+#include "Magnum/MeshView.h"
+#include "Magnum/Shader.h"
+#include "Magnum/Version.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+
+namespace {
+
+/* Color output is masked out, so the fragment shader doesn't need to write
+   anything. The position is calculated the same way as in Shaders::Phong so
+   DepthFunction::Equal works for it in the main pass. */
+constexpr const char* DepthVertexShader =
+    "#if (defined(GL_ES) && __VERSION__ >= 300) || (!defined(GL_ES) && __VERSION__ >= 130)\n"
+    "#define attribute in\n"
+    "#endif\n"
+    "uniform highp mat4 transformationMatrix;\n"
+    "uniform highp mat4 projectionMatrix;\n"
+    "attribute highp vec4 position;\n"
+    "void main() {\n"
+    "    highp vec4 transformedPosition4 = transformationMatrix*position;\n"
+    "    gl_Position = projectionMatrix*transformedPosition4;\n"
+    "}\n";
+constexpr const char* DepthFragmentShader =
+    "void main() {}\n";
+
+class DepthShader: public AbstractShaderProgram {
+    public:
+        typedef Attribute<0, Vector3> Position;
+
+        explicit DepthShader();
+
+        DepthShader& setTransformationMatrix(const Matrix4& matrix) {
+            setUniform(_transformationMatrixUniform, matrix);
+            return *this;
+        }
+
+        DepthShader& setProjectionMatrix(const Matrix4& matrix) {
+            setUniform(_projectionMatrixUniform, matrix);
+            return *this;
+        }
+
+    private:
+        Int _transformationMatrixUniform,
+            _projectionMatrixUniform;
+};
+
+DepthShader::DepthShader() {
+    #ifndef MAGNUM_TARGET_GLES
+    const Version version = Context::current().supportedVersion({Version::GL320, Version::GL310, Version::GL300, Version::GL210});
+    #else
+    const Version version = Context::current().supportedVersion({Version::GLES300, Version::GLES200});
+    #endif
+
+    Shader vert{version, Shader::Type::Vertex};
+    Shader frag{version, Shader::Type::Fragment};
+    vert.addSource(DepthVertexShader);
+    frag.addSource(DepthFragmentShader);
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({vert, frag}));
+    attachShaders({vert, frag});
+
+    bindAttributeLocation(Position::Location, "position");
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+    _transformationMatrixUniform = uniformLocation("transformationMatrix");
+    _projectionMatrixUniform = uniformLocation("projectionMatrix");
+}
+
+}
+
+DepthPrepassState depthPrepassState(const DepthPrepassPass pass, const Renderer::DepthFunction depthFunction) {
+    switch(pass) {
+        case DepthPrepassPass::Depth:
+            return {false, true, Renderer::DepthFunction::Less};
+        case DepthPrepassPass::Shade:
+            return {true, false, depthFunction};
+        case DepthPrepassPass::Forward:
+            return {true, true, Renderer::DepthFunction::Less};
+    }
+
+    CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+void applyDepthPrepassState(const DepthPrepassState& state) {
+    Renderer::setColorMask(state.colorMask, state.colorMask, state.colorMask, state.colorMask);
+    Renderer::setDepthMask(state.depthMask);
+    Renderer::setDepthFunction(state.depthFunction);
+}
+
+struct DepthPrepassShader::State {
+    DepthShader shader;
+};
+
+DepthPrepassShader::DepthPrepassShader(): _state{new State} {}
+
+DepthPrepassShader::~DepthPrepassShader() = default;
+
+void DepthPrepassShader::setProjectionMatrix(const Matrix4& projectionMatrix) {
+    _state->shader.setProjectionMatrix(projectionMatrix);
+}
+
+void DepthPrepassShader::draw(MeshView& mesh, const Matrix4& transformationMatrix) {
+    _state->shader.setTransformationMatrix(transformationMatrix);
+    mesh.draw(_state->shader);
+}
+
+}
+
+/* Instantiated here and not in instantiation.cpp, as the unit test library
+   doesn't link to Magnum. On non-MinGW Windows the instantiation is already
+   marked with extern template. */
+#if !defined(CORRADE_TARGET_WINDOWS) || defined(__MINGW32__)
+template class MAGNUM_SCENEGRAPH_EXPORT BasicDepthPrepass3D<Float>;
+#else
+template class BasicDepthPrepass3D<Float>;
+#endif
+
+}}
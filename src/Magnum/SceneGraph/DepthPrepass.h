@@ -0,0 +1,208 @@
+#ifndef Magnum_SceneGraph_DepthPrepass_h
+#define Magnum_SceneGraph_DepthPrepass_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::BasicDepthPrepass3D, typedef @ref Magnum::SceneGraph::DepthPrepass3D
+ */
+
+#include <memory>
+#include <vector>
+
+#include "Magnum/Renderer.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+    enum class DepthPrepassPass: UnsignedByte {
+        Depth,      /* Depth of drawables with a depth mesh */
+        Shade,      /* Drawables with a depth mesh against their depth */
+        Forward     /* Drawables without depth mesh, also the final state */
+    };
+
+    struct DepthPrepassState {
+        bool colorMask, depthMask;
+        Renderer::DepthFunction depthFunction;
+    };
+
+    /* Render state for given pass, depthFunction is used for the shading
+       pass */
+    MAGNUM_SCENEGRAPH_EXPORT DepthPrepassState depthPrepassState(DepthPrepassPass pass, Renderer::DepthFunction depthFunction);
+
+    MAGNUM_SCENEGRAPH_EXPORT void applyDepthPrepassState(const DepthPrepassState& state);
+
+    /* Fills the order with pairs of camera-space depth and index into the
+       transformation list, sorted front-to-back. Original index is the second
+       key to make the sort stable. */
+    template<class T, class Transformations> void depthPrepassSort(const Transformations& transformations, std::vector<std::pair<T, UnsignedInt>>& order);
+
+    class MAGNUM_SCENEGRAPH_EXPORT DepthPrepassShader {
+        public:
+            explicit DepthPrepassShader();
+            ~DepthPrepassShader();
+
+            void setProjectionMatrix(const Matrix4& projectionMatrix);
+            void draw(MeshView& mesh, const Matrix4& transformationMatrix);
+
+        private:
+            struct State;
+            std::unique_ptr<State> _state;
+    };
+}
+
+/**
+@brief Depth pre-pass for three-dimensional scenes
+
+Draws a group of opaque drawables in two passes to reduce overdraw. First,
+depth of all drawables that have a mesh set via @ref Drawable::setDepthMesh()
+is rendered using a minimal position-only shader with color writes disabled.
+Then the drawables are drawn with the depth test set to
+@ref depthFunction() and depth writes disabled, so each pixel is shaded only
+once by the nearest drawable. Drawables without a depth mesh are drawn
+afterwards with the usual depth test. In both passes the drawables are sorted
+front-to-back by depth of their origin in camera space, so the early depth
+test rejects as much as possible already in the first pass and in the
+drawables without a depth mesh.
+@code
+SceneGraph::DepthPrepass3D prepass;
+
+MeshView foliageDepth{foliageMesh};
+foliageDepth.setCount(foliageMesh.count());
+foliage->setDepthMesh(&foliageDepth);
+
+// each frame
+prepass.draw(camera, drawables);
+@endcode
+
+The depth mesh is expected to have the position in
+@ref Shaders::Generic::Position "generic attribute location" `0`, so views
+on meshes configured for the builtin shaders can be used directly, and only
+this attribute is used. The pre-pass shader computes the position as
+`projectionMatrix*(transformationMatrix*position)`, which is the same as in
+@ref Shaders::Phong. With @ref Renderer::DepthFunction::Equal the shaders of
+the main pass need to compute the position in exactly the same way, otherwise
+some pixels may fail the depth test. If that can't be guaranteed, use
+@ref Renderer::DepthFunction::LessOrEqual instead. Drawables which discard
+fragments, such as alpha-tested foliage, shouldn't have a depth mesh, as the
+pre-pass would write depth also for the discarded fragments.
+
+The pre-pass uses @ref Camera::drawableTransformations(), so frustum culling is
+done the same way as in @ref Camera::draw(). The depth test is expected to be
+enabled. If any visible drawable has a depth mesh, the color mask, depth mask
+and depth function are set back to enabled, enabled and
+@ref Renderer::DepthFunction::Less when the drawing is done, otherwise the
+render state is not touched at all.
+
+## Explicit template specializations
+
+The following specialization is explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref DepthPrepass.hpp implementation file to avoid
+linker errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref DepthPrepass3D
+
+@see @ref scenegraph, @ref RenderQueue, @ref BasicOcclusionCuller3D
+*/
+template<class T> class BasicDepthPrepass3D {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * Creates the pre-pass shader.
+         */
+        explicit BasicDepthPrepass3D();
+
+        /** @brief Copying is not allowed */
+        BasicDepthPrepass3D(const BasicDepthPrepass3D<T>&) = delete;
+
+        /** @brief Copying is not allowed */
+        BasicDepthPrepass3D<T>& operator=(const BasicDepthPrepass3D<T>&) = delete;
+
+        ~BasicDepthPrepass3D();
+
+        /** @brief Depth function of the main pass */
+        Renderer::DepthFunction depthFunction() const { return _depthFunction; }
+
+        /**
+         * @brief Set depth function of the main pass
+         * @return Reference to self (for method chaining)
+         *
+         * Used for drawables that have a depth mesh. Default is
+         * @ref Renderer::DepthFunction::Equal.
+         */
+        BasicDepthPrepass3D<T>& setDepthFunction(Renderer::DepthFunction function) {
+            _depthFunction = function;
+            return *this;
+        }
+
+        /**
+         * @brief Draw group of drawables with depth pre-pass
+         *
+         * Renders depth of all visible drawables with a depth mesh, then
+         * calls @ref Drawable::draw() on all visible drawables. See above
+         * for a detailed description of the passes.
+         */
+        void draw(Camera<3, T>& camera, DrawableGroup<3, T>& group);
+
+        /**
+         * @brief Count of drawables drawn in last @ref draw() call
+         *
+         * Doesn't include drawables removed by frustum culling.
+         * @see @ref prepassCount()
+         */
+        std::size_t drawCount() const { return _order.size(); }
+
+        /**
+         * @brief Count of drawables rendered in the pre-pass in last @ref draw() call
+         *
+         * Count of visible drawables with a depth mesh.
+         */
+        std::size_t prepassCount() const { return _prepassCount; }
+
+    private:
+        Implementation::DepthPrepassShader _shader;
+        Renderer::DepthFunction _depthFunction;
+        std::vector<std::pair<T, UnsignedInt>> _order;
+        std::size_t _prepassCount;
+};
+
+/**
+@brief Depth pre-pass for three-dimensional float scenes
+
+@see @ref BasicDepthPrepass3D
+*/
+typedef BasicDepthPrepass3D<Float> DepthPrepass3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT BasicDepthPrepass3D<Float>;
+#endif
+
+}}
+
+#endif
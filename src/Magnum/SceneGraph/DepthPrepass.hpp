@@ -0,0 +1,96 @@
+#ifndef Magnum_SceneGraph_DepthPrepass_hpp
+#define Magnum_SceneGraph_DepthPrepass_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref DepthPrepass.h
+ */
+
+#include <algorithm>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/DepthPrepass.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+
+template<class T, class Transformations> void depthPrepassSort(const Transformations& transformations, std::vector<std::pair<T, UnsignedInt>>& order) {
+    order.clear();
+    order.reserve(transformations.size());
+    for(std::size_t i = 0; i != transformations.size(); ++i)
+        order.emplace_back(-transformations[i].second.translation().z(), UnsignedInt(i));
+    std::sort(order.begin(), order.end());
+}
+
+}
+
+template<class T> BasicDepthPrepass3D<T>::BasicDepthPrepass3D(): _depthFunction{Renderer::DepthFunction::Equal}, _prepassCount{} {}
+
+template<class T> BasicDepthPrepass3D<T>::~BasicDepthPrepass3D() = default;
+
+template<class T> void BasicDepthPrepass3D<T>::draw(Camera<3, T>& camera, DrawableGroup<3, T>& group) {
+    const std::vector<typename Camera<3, T>::DrawableTransformation>& drawableTransformations = camera.drawableTransformations(group);
+    Implementation::depthPrepassSort(drawableTransformations, _order);
+
+    /* Depth of everything that has a depth mesh. The render state is touched
+       only if there's anything to render in the pre-pass. */
+    _prepassCount = 0;
+    for(const std::pair<T, UnsignedInt>& item: _order) {
+        const typename Camera<3, T>::DrawableTransformation& drawableTransformation = drawableTransformations[item.second];
+        MeshView* const mesh = drawableTransformation.first.get().depthMesh();
+        if(!mesh) continue;
+
+        if(!_prepassCount++) {
+            Implementation::applyDepthPrepassState(Implementation::depthPrepassState(Implementation::DepthPrepassPass::Depth, _depthFunction));
+            _shader.setProjectionMatrix(Matrix4{camera.projectionMatrix()});
+        }
+        _shader.draw(*mesh, Matrix4{drawableTransformation.second});
+    }
+
+    /* Shade them, the depth is already there */
+    if(_prepassCount) {
+        Implementation::applyDepthPrepassState(Implementation::depthPrepassState(Implementation::DepthPrepassPass::Shade, _depthFunction));
+        for(const std::pair<T, UnsignedInt>& item: _order) {
+            const typename Camera<3, T>::DrawableTransformation& drawableTransformation = drawableTransformations[item.second];
+            if(drawableTransformation.first.get().depthMesh())
+                drawableTransformation.first.get().draw(drawableTransformation.second, camera);
+        }
+        Implementation::applyDepthPrepassState(Implementation::depthPrepassState(Implementation::DepthPrepassPass::Forward, _depthFunction));
+    }
+
+    /* The rest is drawn the usual way */
+    if(_prepassCount != _order.size()) for(const std::pair<T, UnsignedInt>& item: _order) {
+        const typename Camera<3, T>::DrawableTransformation& drawableTransformation = drawableTransformations[item.second];
+        if(!drawableTransformation.first.get().depthMesh())
+            drawableTransformation.first.get().draw(drawableTransformation.second, camera);
+    }
+}
+
+}}
+
+#endif
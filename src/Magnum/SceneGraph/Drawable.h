@@ -26,13 +26,95 @@
 */
 
 /** @file
- * @brief Class @ref Magnum::SceneGraph::Drawable, @ref Magnum::SceneGraph::DrawableGroup, alias @ref Magnum::SceneGraph::BasicDrawable2D, @ref Magnum::SceneGraph::BasicDrawable3D, @ref Magnum::SceneGraph::BasicDrawableGroup2D, @ref Magnum::SceneGraph::BasicDrawableGroup3D, typedef @ref Magnum::SceneGraph::Drawable2D, @ref Magnum::SceneGraph::Drawable3D, @ref Magnum::SceneGraph::DrawableGroup2D, @ref Magnum::SceneGraph::DrawableGroup3D
+ * @brief Class @ref Magnum::SceneGraph::Drawable, @ref Magnum::SceneGraph::DrawableGroup, @ref Magnum::SceneGraph::DrawState, enum @ref Magnum::SceneGraph::BoundingVolume, alias @ref Magnum::SceneGraph::BasicDrawable2D, @ref Magnum::SceneGraph::BasicDrawable3D, @ref Magnum::SceneGraph::BasicDrawableGroup2D, @ref Magnum::SceneGraph::BasicDrawableGroup3D, typedef @ref Magnum::SceneGraph::Drawable2D, @ref Magnum::SceneGraph::Drawable3D, @ref Magnum::SceneGraph::DrawableGroup2D, @ref Magnum::SceneGraph::DrawableGroup3D
  */
 
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/SceneGraph/AbstractGroupedFeature.h"
 
 namespace Magnum { namespace SceneGraph {
 
+/**
+@brief Drawable bounding volume
+
+@see @ref Drawable::boundingVolume(), @ref Drawable::setBoundingSphere(),
+    @ref Drawable::setBoundingBox()
+*/
+enum class BoundingVolume: UnsignedByte {
+    None,           /**< No bounding volume, never culled (default) */
+    Sphere,         /**< Bounding sphere */
+    Box             /**< Axis-aligned bounding box */
+};
+
+/**
+@brief Drawable render state
+
+Identifies GPU state needed by a drawable, used by @ref RenderQueue to sort
+the drawables so the state changes are minimized. The values are arbitrary
+identifiers, usually @ref AbstractShaderProgram::id(), @ref Mesh::id(),
+@ref RenderState::id() and ID of a texture or some application-specific set
+of textures. Drawables with equal values are assumed to share the
+corresponding state, value of `0` means no or unknown state.
+@see @ref Drawable::setDrawState()
+*/
+struct DrawState {
+    /** @brief Default constructor */
+    constexpr /*implicit*/ DrawState(): shader{}, textures{}, mesh{}, renderState{} {}
+
+    /** @brief Constructor */
+    constexpr /*implicit*/ DrawState(UnsignedInt shader, UnsignedInt textures, UnsignedInt mesh, UnsignedInt renderState = 0): shader{shader}, textures{textures}, mesh{mesh}, renderState{renderState} {}
+
+    UnsignedInt shader;     /**< @brief Shader program ID */
+    UnsignedInt textures;   /**< @brief Texture set ID */
+    UnsignedInt mesh;       /**< @brief Mesh ID */
+    UnsignedInt renderState; /**< @brief Render state block ID */
+};
+
+/** @relates DrawState
+@brief Equality comparison
+*/
+constexpr bool operator==(const DrawState& a, const DrawState& b) {
+    return a.shader == b.shader && a.textures == b.textures && a.mesh == b.mesh && a.renderState == b.renderState;
+}
+
+/** @relates DrawState
+@brief Non-equality comparison
+*/
+constexpr bool operator!=(const DrawState& a, const DrawState& b) {
+    return !operator==(a, b);
+}
+
+/**
+@brief Precomputed drawable matrices
+
+Matrices computed by @ref Camera for each drawable in one batch if
+@ref Camera::setDrawableMatricesEnabled() "enabled" and passed to
+@ref Drawable::drawWithMatrices(), so the drawables don't need to multiply
+with the projection matrix and compute the normal matrix themselves.
+@see @ref Camera::drawableMatrices()
+*/
+template<UnsignedInt dimensions, class T> struct DrawableMatrices {
+    /** @brief Object transformation relative to camera */
+    MatrixTypeFor<dimensions, T> transformationMatrix;
+
+    /**
+     * @brief Projection matrix multiplied with the transformation matrix
+     *
+     * @see @ref Camera::projectionMatrix()
+     */
+    MatrixTypeFor<dimensions, T> projectionTransformationMatrix;
+
+    /**
+     * @brief Normal matrix
+     *
+     * Inverted transposed rotation and scaling part of
+     * @ref transformationMatrix.
+     */
+    Math::Matrix<dimensions, T> normalMatrix;
+};
+
 /**
 @brief Drawable
 
@@ -155,6 +237,52 @@ void MyApplication::drawEvent() {
 }
 @endcode
 
+@anchor SceneGraph-Drawable-culling
+## Frustum culling
+
+If the drawable has a bounding volume set using @ref setBoundingSphere() or
+@ref setBoundingBox(), @ref Camera::draw() tests it against the camera
+frustum and skips the drawable if it's not visible. The bounding volume is
+specified relative to the object the drawable is attached to and is
+transformed together with it. Drawables without bounding volume are always
+drawn.
+@code
+RedCube* cube = new RedCube(&scene, &drawables);
+cube->setBoundingBox({Vector3{-1.0f}, Vector3{1.0f}});
+@endcode
+
+Count of tested and culled drawables in the last draw can be queried with
+@ref Camera::testedDrawableCount() and @ref Camera::culledDrawableCount().
+
+The bounding volume is also used by @ref BasicOcclusionCuller3D "OcclusionCuller3D",
+which additionally skips drawables hidden behind other geometry using
+occlusion queries.
+
+@anchor SceneGraph-Drawable-sorting
+## Draw order and state sorting
+
+@ref Camera::draw() draws the drawables in the order they were added to the
+group. If the drawables describe the GPU state they need using
+@ref setDrawState(), @ref RenderQueue can be used instead to draw them sorted
+by shader, render state, textures, mesh and depth, minimizing the state
+changes:
+@code
+RedCube* cube = new RedCube(&scene, &drawables);
+cube->setDrawState({shader.id(), 0, mesh.id()});
+
+SceneGraph::RenderQueue3D queue;
+queue.draw(camera, drawables);
+@endcode
+
+For opaque geometry with a lot of overdraw, @ref BasicDepthPrepass3D "DepthPrepass3D"
+first renders depth of drawables that have a mesh set via @ref setDepthMesh()
+and then shades each pixel only once, drawing the drawables front-to-back.
+
+Static geometry that never moves can be batched instead. @ref staticBatches()
+collects drawables of a subtree sharing the same shader and textures, their
+meshes can be then merged into one using @ref MeshTools::concatenate() and
+drawn with a single drawable.
+
 ## Explicit template specializations
 
 The following specializations are explicitly compiled into @ref SceneGraph
@@ -203,6 +331,141 @@ template<UnsignedInt dimensions, class T> class Drawable: public AbstractGrouped
          * @ref SceneGraph::Camera::projectionMatrix() "Camera::projectionMatrix()".
          */
         virtual void draw(const MatrixTypeFor<dimensions, T>& transformationMatrix, Camera<dimensions, T>& camera) = 0;
+
+        /**
+         * @brief Draw the object using precomputed matrices
+         * @param matrices      Matrices relative to camera
+         * @param camera        Camera
+         *
+         * Called by @ref Camera::draw() instead of
+         * @ref draw(const MatrixTypeFor<dimensions, T>&, Camera<dimensions, T>&)
+         * if @ref Camera::setDrawableMatricesEnabled() "precomputed matrices are enabled".
+         * Default implementation calls the above function with
+         * @ref DrawableMatrices::transformationMatrix, override it to make
+         * use of the other matrices.
+         */
+        virtual void drawWithMatrices(const DrawableMatrices<dimensions, T>& matrices, Camera<dimensions, T>& camera) {
+            draw(matrices.transformationMatrix, camera);
+        }
+
+        /**
+         * @brief Bounding volume type
+         *
+         * Default is @ref BoundingVolume::None.
+         * @see @ref setBoundingSphere(), @ref setBoundingBox()
+         */
+        BoundingVolume boundingVolume() const { return _boundingVolume; }
+
+        /**
+         * @brief Bounding volume center
+         *
+         * Relative to the object. Unspecified if @ref boundingVolume() is
+         * @ref BoundingVolume::None.
+         */
+        VectorTypeFor<dimensions, T> boundingCenter() const { return _boundingCenter; }
+
+        /**
+         * @brief Bounding volume extent
+         *
+         * Half-size of the box. If @ref boundingVolume() is
+         * @ref BoundingVolume::Sphere, all components are equal to sphere
+         * radius. Unspecified if @ref boundingVolume() is
+         * @ref BoundingVolume::None.
+         */
+        VectorTypeFor<dimensions, T> boundingExtent() const { return _boundingExtent; }
+
+        /**
+         * @brief Set bounding sphere
+         * @param center    Sphere center relative to the object
+         * @param radius    Sphere radius
+         * @return Reference to self (for method chaining)
+         *
+         * See @ref SceneGraph-Drawable-culling "Frustum culling" for more
+         * information.
+         * @see @ref setBoundingBox(), @ref resetBoundingVolume()
+         */
+        Drawable<dimensions, T>& setBoundingSphere(const VectorTypeFor<dimensions, T>& center, T radius) {
+            _boundingVolume = BoundingVolume::Sphere;
+            _boundingCenter = center;
+            _boundingExtent = VectorTypeFor<dimensions, T>{radius};
+            return *this;
+        }
+
+        /**
+         * @brief Set bounding box
+         * @param box       Axis-aligned box relative to the object
+         * @return Reference to self (for method chaining)
+         *
+         * See @ref SceneGraph-Drawable-culling "Frustum culling" for more
+         * information.
+         * @see @ref setBoundingSphere(), @ref resetBoundingVolume()
+         */
+        Drawable<dimensions, T>& setBoundingBox(const RangeTypeFor<dimensions, T>& box) {
+            _boundingVolume = BoundingVolume::Box;
+            _boundingCenter = box.center();
+            _boundingExtent = box.size()/T(2);
+            return *this;
+        }
+
+        /**
+         * @brief Reset bounding volume
+         * @return Reference to self (for method chaining)
+         *
+         * The drawable won't be culled anymore.
+         */
+        Drawable<dimensions, T>& resetBoundingVolume() {
+            _boundingVolume = BoundingVolume::None;
+            return *this;
+        }
+
+        /**
+         * @brief Render state
+         *
+         * Default is @ref DrawState with all values set to `0`.
+         * @see @ref RenderQueue
+         */
+        DrawState drawState() const { return _drawState; }
+
+        /**
+         * @brief Set render state
+         * @return Reference to self (for method chaining)
+         *
+         * See @ref SceneGraph-Drawable-sorting "Draw order and state sorting"
+         * for more information.
+         */
+        Drawable<dimensions, T>& setDrawState(const DrawState& state) {
+            _drawState = state;
+            return *this;
+        }
+
+        /**
+         * @brief Depth mesh
+         *
+         * Default is `nullptr`.
+         * @see @ref BasicDepthPrepass3D "DepthPrepass3D"
+         */
+        MeshView* depthMesh() const { return _depthMesh; }
+
+        /**
+         * @brief Set depth mesh
+         * @return Reference to self (for method chaining)
+         *
+         * Mesh view used for rendering depth of the drawable in a depth
+         * pre-pass, see @ref BasicDepthPrepass3D "DepthPrepass3D" for more
+         * information. The view is not owned by the drawable and has to stay
+         * alive as long as it's set. Pass `nullptr` to exclude the drawable
+         * from the pre-pass.
+         */
+        Drawable<dimensions, T>& setDepthMesh(MeshView* mesh) {
+            _depthMesh = mesh;
+            return *this;
+        }
+
+    private:
+        BoundingVolume _boundingVolume;
+        VectorTypeFor<dimensions, T> _boundingCenter, _boundingExtent;
+        DrawState _drawState;
+        MeshView* _depthMesh;
 };
 
 /**
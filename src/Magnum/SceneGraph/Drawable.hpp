@@ -33,7 +33,7 @@
 
 namespace Magnum { namespace SceneGraph {
 
-template<UnsignedInt dimensions, class T> Drawable<dimensions, T>::Drawable(AbstractObject<dimensions, T>& object, DrawableGroup<dimensions, T>* drawables): AbstractGroupedFeature<dimensions, Drawable<dimensions, T>, T>(object, drawables) {}
+template<UnsignedInt dimensions, class T> Drawable<dimensions, T>::Drawable(AbstractObject<dimensions, T>& object, DrawableGroup<dimensions, T>* drawables): AbstractGroupedFeature<dimensions, Drawable<dimensions, T>, T>(object, drawables), _boundingVolume{BoundingVolume::None}, _depthMesh{} {}
 
 }}
 
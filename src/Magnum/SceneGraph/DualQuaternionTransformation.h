@@ -82,6 +82,32 @@ template<class T> class BasicDualQuaternionTransformation: public AbstractBasicT
             return setTransformationInternal(_transformation.normalized());
         }
 
+        /**
+         * @brief Automatic renormalization interval
+         *
+         * @see @ref setNormalizationInterval()
+         */
+        UnsignedInt normalizationInterval() const { return _normalizationInterval; }
+
+        /**
+         * @brief Set automatic renormalization interval
+         * @return Reference to self (for method chaining)
+         *
+         * If nonzero, the transformation is renormalized after every
+         * @p interval calls to @ref transform(), @ref translate(),
+         * @ref rotate() and their local variants, so it's not needed to call
+         * @ref normalizeRotation() after each of them. Each composition adds
+         * rounding error in the order of @ref Math::TypeTraits::epsilon(),
+         * so the drift stays bounded by roughly @p interval times the
+         * epsilon. Default is @cpp 0 @ce, i.e. no automatic renormalization.
+         * @see @ref Math::DualQuaternion::composeChain()
+         */
+        Object<BasicDualQuaternionTransformation<T>>& setNormalizationInterval(UnsignedInt interval) {
+            _normalizationInterval = interval;
+            _compositions = 0;
+            return static_cast<Object<BasicDualQuaternionTransformation<T>>&>(*this);
+        }
+
         /**
          * @brief Transform object
          * @return Reference to self (for method chaining)
@@ -302,6 +328,7 @@ template<class T> class BasicDualQuaternionTransformation: public AbstractBasicT
             /** @todo Do this in some common code so we don't need to include Object? */
             if(!static_cast<Object<BasicDualQuaternionTransformation<T>>*>(this)->isScene()) {
                 _transformation = transformation;
+                _compositions = 0;
                 static_cast<Object<BasicDualQuaternionTransformation<T>>*>(this)->setDirty();
             }
 
@@ -310,13 +337,26 @@ template<class T> class BasicDualQuaternionTransformation: public AbstractBasicT
 
         /* No assertions fired, for internal use */
         Object<BasicDualQuaternionTransformation<T>>& transformInternal(const Math::DualQuaternion<T>& transformation) {
-            return setTransformationInternal(transformation*_transformation);
+            return composeInternal(transformation*_transformation);
         }
         Object<BasicDualQuaternionTransformation<T>>& transformLocalInternal(const Math::DualQuaternion<T>& transformation) {
-            return setTransformationInternal(_transformation*transformation);
+            return composeInternal(_transformation*transformation);
+        }
+
+        /* Renormalizes only every _normalizationInterval compositions, the
+           counter is reset by setTransformationInternal() */
+        Object<BasicDualQuaternionTransformation<T>>& composeInternal(const Math::DualQuaternion<T>& transformation) {
+            const UnsignedInt compositions = _compositions + 1;
+            if(_normalizationInterval && compositions >= _normalizationInterval)
+                return setTransformationInternal(transformation.normalized());
+
+            setTransformationInternal(transformation);
+            _compositions = compositions;
+            return static_cast<Object<BasicDualQuaternionTransformation<T>>&>(*this);
         }
 
         Math::DualQuaternion<T> _transformation;
+        UnsignedInt _normalizationInterval{}, _compositions{};
 };
 
 /**
@@ -49,15 +49,27 @@ template<UnsignedInt dimensions, class T> class AbstractFeatureGroup {
     virtual ~AbstractFeatureGroup();
 
     void add(AbstractFeature<dimensions, T>& feature);
-    void remove(AbstractFeature<dimensions, T>& feature);
+    void remove(std::size_t index);
 
     std::vector<std::reference_wrapper<AbstractFeature<dimensions, T>>> features;
+    bool stableOrder = false;
 };
 
 /**
 @brief Group of features
 
 See @ref AbstractGroupedFeature for more information.
+
+@section SceneGraph-FeatureGroup-removal Feature removal
+
+Each feature remembers its index in the group, so both @ref add() and
+@ref remove() are done in constant time. By default, the removed feature is
+replaced with the last feature in the group, which means that the order of
+remaining features changes. If your code depends on the features being
+iterated in the order in which they were added, enable
+@ref setStableOrder() "stable order". The removal then needs to shift and
+reindex all features after the removed one, which makes it linear in the
+count of features in the group.
 @see @ref scenegraph, @ref BasicFeatureGroup2D, @ref BasicFeatureGroup3D,
     @ref FeatureGroup2D, @ref FeatureGroup3D
 */
@@ -84,6 +96,29 @@ template<UnsignedInt dimensions, class Feature, class T> class FeatureGroup: pub
             return AbstractFeatureGroup<dimensions, T>::features.size();
         }
 
+        /**
+         * @brief Whether the group preserves feature order on removal
+         *
+         * @see @ref setStableOrder()
+         */
+        bool isStableOrder() const {
+            return AbstractFeatureGroup<dimensions, T>::stableOrder;
+        }
+
+        /**
+         * @brief Enable or disable stable feature order
+         * @return Reference to self (for method chaining)
+         *
+         * If enabled, @ref remove() preserves relative order of the remaining
+         * features in linear time. Otherwise the removed feature is replaced
+         * with the last one in constant time. Disabled by default. See
+         * @ref SceneGraph-FeatureGroup-removal for more information.
+         */
+        FeatureGroup<dimensions, Feature, T>& setStableOrder(bool enabled) {
+            AbstractFeatureGroup<dimensions, T>::stableOrder = enabled;
+            return *this;
+        }
+
         /** @brief Feature at given index */
         Feature& operator[](std::size_t index) {
             return static_cast<Feature&>(AbstractFeatureGroup<dimensions, T>::features[index].get());
@@ -107,7 +142,11 @@ template<UnsignedInt dimensions, class Feature, class T> class FeatureGroup: pub
          * @brief Remove feature from the group
          * @return Reference to self (for method chaining)
          *
-         * The feature must be part of the group.
+         * The feature must be part of the group. By default the last
+         * feature is moved into the freed slot, which is done in constant
+         * time. If @ref setStableOrder() "stable order" is enabled, all
+         * following features are shifted by one instead, which is linear in
+         * the count of features after the removed one.
          * @see @ref add()
          */
         FeatureGroup<dimensions, Feature, T>& remove(Feature& feature);
@@ -167,6 +206,7 @@ template<UnsignedInt dimensions, class Feature, class T> FeatureGroup<dimensions
         feature._group->remove(feature);
 
     /* Crossreference the feature and group together */
+    feature._groupIndex = AbstractFeatureGroup<dimensions, T>::features.size();
     AbstractFeatureGroup<dimensions, T>::add(feature);
     feature._group = this;
     return *this;
@@ -176,7 +216,18 @@ template<UnsignedInt dimensions, class Feature, class T> FeatureGroup<dimensions
     CORRADE_ASSERT(feature._group == this,
         "SceneGraph::AbstractFeatureGroup::remove(): feature is not part of this group", *this);
 
-    AbstractFeatureGroup<dimensions, T>::remove(feature);
+    const std::size_t index = feature._groupIndex;
+    AbstractFeatureGroup<dimensions, T>::remove(index);
+
+    /* Update indices of features that got moved -- either all following
+       ones or just the last one that took place of the removed feature */
+    auto& features = AbstractFeatureGroup<dimensions, T>::features;
+    if(AbstractFeatureGroup<dimensions, T>::stableOrder) {
+        for(std::size_t i = index; i != features.size(); ++i)
+            static_cast<Feature&>(features[i].get())._groupIndex = i;
+    } else if(index != features.size())
+        static_cast<Feature&>(features[index].get())._groupIndex = index;
+
     feature._group = nullptr;
     return *this;
 }
@@ -29,8 +29,6 @@
  * @brief @ref compilation-speedup-hpp "Template implementation" for @ref FeatureGroup.h
  */
 
-#include <algorithm>
-
 #include "Magnum/SceneGraph/FeatureGroup.h"
 
 namespace Magnum { namespace SceneGraph {
@@ -42,9 +40,15 @@ template<UnsignedInt dimensions, class T> void AbstractFeatureGroup<dimensions,
     features.push_back(feature);
 }
 
-template<UnsignedInt dimensions, class T> void AbstractFeatureGroup<dimensions, T>::remove(AbstractFeature<dimensions, T>& feature) {
-    features.erase(std::find_if(features.begin(), features.end(),
-        [&feature](AbstractFeature<dimensions, T>& f) { return &f == &feature; }));
+template<UnsignedInt dimensions, class T> void AbstractFeatureGroup<dimensions, T>::remove(const std::size_t index) {
+    if(stableOrder) {
+        features.erase(features.begin() + index);
+        return;
+    }
+
+    /* Move the last feature to the place of the removed one */
+    features[index] = features.back();
+    features.pop_back();
 }
 
 }}
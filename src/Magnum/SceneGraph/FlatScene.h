@@ -0,0 +1,81 @@
+#ifndef Magnum_SceneGraph_FlatScene_h
+#define Magnum_SceneGraph_FlatScene_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::SceneGraph::instantiateFlatScene()
+ */
+
+#include <vector>
+
+#include "Magnum/SceneGraph/Object.h"
+#include "Magnum/Trade/FlatSceneData3D.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Instantiate flat scene data
+@param parent   Parent for top-level objects of the scene
+@param data     Scene data
+
+Creates an object for each object in @p data using @ref Object::addChild() and
+sets its transformation, all in a single linear pass. If @p parent is part of
+a scene with @ref Scene::setPoolAllocator() "pool allocator", all objects are
+allocated from the pool. Returns the created objects in the same order as in
+@p data, so the meshes, cameras and other instances can be attached to them
+afterwards:
+@code
+std::optional<Trade::FlatSceneData3D> data = importer.flatScene3D(importer.defaultScene());
+std::vector<Object3D*> objects = SceneGraph::instantiateFlatScene(scene, *data);
+for(std::size_t i = 0; i != objects.size(); ++i)
+    if(data->instanceTypes()[i] == Trade::ObjectInstanceType3D::Mesh)
+        new ColoredDrawable{*objects[i], meshes[data->instances()[i]], drawables};
+@endcode
+
+The objects are created in depth-first order as produced by
+@ref Trade::AbstractImporter::flatScene3D(), which is the same order in which
+@ref FlatTransformationCache stores them, so the cache built for the scene
+afterwards has good memory locality.
+*/
+template<class Transformation> std::vector<Object<Transformation>*> instantiateFlatScene(Object<Transformation>& parent, const Trade::FlatSceneData3D& data) {
+    static_assert(Transformation::Dimensions == 3, "SceneGraph::instantiateFlatScene(): the transformation has to be three-dimensional");
+
+    std::vector<Object<Transformation>*> objects;
+    objects.reserve(data.objectCount());
+    for(std::size_t i = 0; i != data.objectCount(); ++i) {
+        /* Parent is always before its children, so it is already created */
+        const Int parentIndex = data.parents()[i];
+        Object<Transformation>& object = (parentIndex == -1 ? parent : *objects[parentIndex]).template addChild<Object<Transformation>>();
+        object.setTransformation(Implementation::Transformation<Transformation>::fromMatrix(Math::Matrix4<typename Transformation::Type>{data.transformations()[i]}));
+        objects.push_back(&object);
+    }
+
+    return objects;
+}
+
+}}
+
+#endif
@@ -0,0 +1,256 @@
+#ifndef Magnum_SceneGraph_FlatTransformationCache_h
+#define Magnum_SceneGraph_FlatTransformationCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::FlatTransformationCache
+ */
+
+#include <utility>
+#include <vector>
+
+#include "Magnum/SceneGraph/SceneGraph.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Flat transformation cache
+
+Keeps all objects of given @ref Scene in a contiguous, depth-first ordered
+array together with index of their parent, their relative transformation and
+absolute transformation. With this layout, computing absolute transformations
+of the whole scene and cleaning dirty objects is a single linear pass over the
+arrays instead of pointer-chasing through the object hierarchy, which is
+significantly more cache-friendly for large scenes. See also
+@ref scenegraph-features-caching for more information.
+
+The cache is opt-in and works on top of the existing @ref Object API, which
+stays fully functional -- objects can be transformed, reparented and cleaned
+one by one as usual. Usage example:
+@code
+Scene3D scene;
+SceneGraph::FlatTransformationCache<SceneGraph::MatrixTransformation3D> cache{scene};
+
+// add tens of thousands of objects to the scene...
+
+// each frame
+cache.update();
+@endcode
+
+The cache tracks changes in scene hierarchy using
+@ref Scene::hierarchyGeneration() and rebuilds itself in @ref update()
+whenever an object is added to or removed from the scene, so it's advised to
+do larger structural changes in bulk to avoid frequent rebuilds. The cache must
+not outlive the scene it operates on.
+
+@anchor SceneGraph-FlatTransformationCache-parallel
+## Parallel update
+
+Subtrees of the scene that don't depend on each other can be processed in
+parallel using @ref update(AbstractTaskExecutor&). Each direct child of the
+scene is an independent *island*, large subtrees can be further split by
+marking some of their objects with @ref Object::setIsland(). The actual
+threading is provided by an @ref AbstractTaskExecutor subclass:
+@code
+MyThreadPoolExecutor executor;
+
+// each frame
+cache.update(executor);
+@endcode
+
+Features that access data shared between objects in their
+@ref AbstractFeature::clean() "clean()" implementation should opt out using
+@ref AbstractFeature::setCleanThreadSafe(), they are then cleaned from the
+calling thread after all tasks finish.
+
+@anchor SceneGraph-FlatTransformationCache-explicit-specializations
+## Explicit template specializations
+
+The following specializations are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type or special transformation class) you have to use
+@ref FlatTransformationCache.hpp implementation file to avoid linker errors.
+See also @ref compilation-speedup-hpp for more information.
+
+-   @ref DualComplexTransformation "FlatTransformationCache<DualComplexTransformation>"
+-   @ref DualQuaternionTransformation "FlatTransformationCache<DualQuaternionTransformation>"
+-   @ref MatrixTransformation2D "FlatTransformationCache<MatrixTransformation2D>"
+-   @ref MatrixTransformation3D "FlatTransformationCache<MatrixTransformation3D>"
+-   @ref RigidMatrixTransformation2D "FlatTransformationCache<RigidMatrixTransformation2D>"
+-   @ref RigidMatrixTransformation3D "FlatTransformationCache<RigidMatrixTransformation3D>"
+-   @ref TranslationTransformation2D "FlatTransformationCache<TranslationTransformation2D>"
+-   @ref TranslationTransformation3D "FlatTransformationCache<TranslationTransformation3D>"
+
+@see @ref Object::setClean()
+*/
+template<class Transformation> class FlatTransformationCache {
+    public:
+        /**
+         * @brief Parent index of the scene
+         *
+         * The scene is always at index `0` and has no parent.
+         * @see @ref parents()
+         */
+        enum: UnsignedInt { NoParent = ~UnsignedInt{} };
+
+        /**
+         * @brief Constructor
+         * @param scene     Scene to cache
+         *
+         * The cache is populated on first call to @ref update() or
+         * @ref rebuild().
+         */
+        explicit FlatTransformationCache(Scene<Transformation>& scene);
+
+        /** @brief Copying is not allowed */
+        FlatTransformationCache(const FlatTransformationCache<Transformation>&) = delete;
+
+        /** @brief Moving is not allowed */
+        FlatTransformationCache(FlatTransformationCache<Transformation>&&) = delete;
+
+        ~FlatTransformationCache();
+
+        /** @brief Copying is not allowed */
+        FlatTransformationCache<Transformation>& operator=(const FlatTransformationCache<Transformation>&) = delete;
+
+        /** @brief Moving is not allowed */
+        FlatTransformationCache<Transformation>& operator=(FlatTransformationCache<Transformation>&&) = delete;
+
+        /** @brief Scene */
+        Scene<Transformation>& scene() { return _scene; }
+        const Scene<Transformation>& scene() const { return _scene; } /**< @overload */
+
+        /**
+         * @brief Whether the cache needs to be rebuilt
+         *
+         * Returns `true` if the scene hierarchy changed since last call to
+         * @ref rebuild(), `false` otherwise.
+         */
+        bool isOutdated() const;
+
+        /**
+         * @brief Count of cached objects
+         *
+         * Includes also the scene itself.
+         */
+        std::size_t size() const { return _objects.size(); }
+
+        /**
+         * @brief Objects in depth-first order
+         *
+         * First item is always the scene, parent object is always before its
+         * children. Each island (see @ref islands()) occupies a contiguous
+         * range, subtrees of nested islands are put after all objects of the
+         * enclosing island.
+         */
+        const std::vector<Object<Transformation>*>& objects() const { return _objects; }
+
+        /**
+         * @brief Parent indices
+         *
+         * Index of parent object for each item in @ref objects(), first item
+         * is always @ref NoParent.
+         */
+        const std::vector<UnsignedInt>& parents() const { return _parents; }
+
+        /**
+         * @brief Relative transformations
+         *
+         * Transformation of each item in @ref objects() relative to its
+         * parent, as of last call to @ref update().
+         */
+        const std::vector<typename Transformation::DataType>& transformations() const { return _transformations; }
+
+        /**
+         * @brief Absolute transformations
+         *
+         * Transformation of each item in @ref objects() relative to the scene,
+         * as of last call to @ref update().
+         */
+        const std::vector<typename Transformation::DataType>& absoluteTransformations() const { return _absoluteTransformations; }
+
+        /**
+         * @brief Island ranges
+         *
+         * Begin and end index into @ref objects() for each island. Each direct
+         * child of the scene and each object marked with
+         * @ref Object::setIsland() forms an island together with its subtree,
+         * excluding subtrees of nested islands. The scene itself is not part
+         * of any island.
+         */
+        const std::vector<std::pair<UnsignedInt, UnsignedInt>>& islands() const { return _islands; }
+
+        /**
+         * @brief Rebuild the cache
+         *
+         * Walks the scene hierarchy and repopulates the arrays. Called
+         * implicitly from @ref update() if @ref isOutdated() is `true`.
+         */
+        void rebuild();
+
+        /**
+         * @brief Update the cache and clean dirty objects
+         *
+         * Rebuilds the cache if it is outdated, then in a single pass copies
+         * relative transformations of all objects into @ref transformations(),
+         * computes @ref absoluteTransformations() from them and cleans all
+         * dirty objects the same way as @ref Object::setClean() does.
+         */
+        void update();
+
+        /**
+         * @brief Update the cache and clean dirty objects in parallel
+         *
+         * Same as @ref update(), but each island (see @ref islands()) is
+         * processed as a separate task using given executor. Transformation of
+         * the scene and of parents of all island roots is computed upfront,
+         * so the tasks don't depend on each other. Features that are not
+         * marked with @ref AbstractFeature::setCleanThreadSafe() are cleaned
+         * afterwards from the calling thread, in the same order as in
+         * @ref update().
+         *
+         * Note that transformations of objects must not be modified while the
+         * update is in progress.
+         */
+        void update(AbstractTaskExecutor& executor);
+
+    private:
+        static void updateIsland(void* state, std::size_t id);
+
+        Scene<Transformation>& _scene;
+        UnsignedInt _hierarchyGeneration;
+        std::vector<Object<Transformation>*> _objects;
+        std::vector<UnsignedInt> _parents;
+        std::vector<typename Transformation::DataType> _transformations;
+        std::vector<typename Transformation::DataType> _absoluteTransformations;
+        std::vector<std::pair<UnsignedInt, UnsignedInt>> _islands;
+        std::vector<typename Transformation::DataType> _islandBaseTransformations;
+};
+
+}}
+
+#endif
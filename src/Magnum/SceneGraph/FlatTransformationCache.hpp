@@ -0,0 +1,162 @@
+#ifndef Magnum_SceneGraph_FlatTransformationCache_hpp
+#define Magnum_SceneGraph_FlatTransformationCache_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref FlatTransformationCache.h
+ */
+
+#include "Magnum/SceneGraph/FlatTransformationCache.h"
+#include "Magnum/SceneGraph/AbstractTaskExecutor.h"
+#include "Magnum/SceneGraph/Object.hpp"
+
+namespace Magnum { namespace SceneGraph {
+
+template<class Transformation> FlatTransformationCache<Transformation>::FlatTransformationCache(Scene<Transformation>& scene): _scene(scene), _hierarchyGeneration{0} {}
+
+template<class Transformation> FlatTransformationCache<Transformation>::~FlatTransformationCache() = default;
+
+template<class Transformation> bool FlatTransformationCache<Transformation>::isOutdated() const {
+    return _objects.empty() || _hierarchyGeneration != _scene.hierarchyGeneration();
+}
+
+template<class Transformation> void FlatTransformationCache<Transformation>::rebuild() {
+    _objects.clear();
+    _parents.clear();
+    _islands.clear();
+
+    _objects.push_back(&_scene);
+    _parents.push_back(NoParent);
+
+    /* Island roots with their parent index, direct children of the scene
+       first. Nested islands are appended as they are discovered. */
+    std::vector<std::pair<Object<Transformation>*, UnsignedInt>> islandRoots;
+    for(Object<Transformation>* child = _scene.children().first(); child; child = child->nextSibling())
+        islandRoots.emplace_back(child, 0);
+
+    /* Depth-first traversal of each island with explicit stack, pushing the
+       children in reverse so they end up in the array in the same order as
+       they are in the hierarchy */
+    std::vector<std::pair<Object<Transformation>*, UnsignedInt>> stack;
+    for(std::size_t i = 0; i != islandRoots.size(); ++i) {
+        const UnsignedInt begin = UnsignedInt(_objects.size());
+        stack.push_back(islandRoots[i]);
+        while(!stack.empty()) {
+            Object<Transformation>* const object = stack.back().first;
+            const UnsignedInt parent = stack.back().second;
+            stack.pop_back();
+
+            const UnsignedInt index = UnsignedInt(_objects.size());
+            _objects.push_back(object);
+            _parents.push_back(parent);
+
+            for(Object<Transformation>* child = object->children().last(); child; child = child->previousSibling()) {
+                if(child->isIsland()) islandRoots.emplace_back(child, index);
+                else stack.emplace_back(child, index);
+            }
+        }
+
+        _islands.emplace_back(begin, UnsignedInt(_objects.size()));
+    }
+
+    _transformations.resize(_objects.size());
+    _absoluteTransformations.resize(_objects.size());
+    _islandBaseTransformations.resize(_islands.size());
+    _hierarchyGeneration = _scene.hierarchyGeneration();
+}
+
+template<class Transformation> void FlatTransformationCache<Transformation>::update() {
+    if(isOutdated()) rebuild();
+
+    /* Parent is always before its children, so its absolute transformation is
+       already computed when we get to them */
+    _transformations[0] = _objects[0]->transformation();
+    _absoluteTransformations[0] = _transformations[0];
+    for(std::size_t i = 1; i != _objects.size(); ++i) {
+        _transformations[i] = _objects[i]->transformation();
+        _absoluteTransformations[i] = Implementation::Transformation<Transformation>::compose(_absoluteTransformations[_parents[i]], _transformations[i]);
+    }
+
+    /* Clean dirty objects. All parents of a dirty object are either dirty as
+       well or already clean, so the order doesn't matter here. */
+    for(std::size_t i = 0; i != _objects.size(); ++i) {
+        if(!_objects[i]->isDirty()) continue;
+
+        _objects[i]->setCleanInternal(_absoluteTransformations[i]);
+        CORRADE_ASSERT(!_objects[i]->isDirty(), "SceneGraph::FlatTransformationCache::update(): original implementation was not called", );
+    }
+}
+
+template<class Transformation> void FlatTransformationCache<Transformation>::update(AbstractTaskExecutor& executor) {
+    if(isOutdated()) rebuild();
+
+    /* Scene and base transformations of all islands. Parents of nested
+       islands are part of other islands, which are processed in parallel, so
+       their absolute transformation is calculated here from scratch. */
+    _transformations[0] = _objects[0]->transformation();
+    _absoluteTransformations[0] = _transformations[0];
+    if(_objects[0]->isDirty()) _objects[0]->setCleanInternal(_absoluteTransformations[0]);
+    for(std::size_t i = 0; i != _islands.size(); ++i) {
+        const UnsignedInt parent = _parents[_islands[i].first];
+        _islandBaseTransformations[i] = parent ? _objects[parent]->absoluteTransformation() : _absoluteTransformations[0];
+    }
+
+    executor.execute(_islands.size(), updateIsland, this);
+
+    /* Clean features that can't be cleaned from worker threads */
+    for(std::size_t i = 1; i != _objects.size(); ++i) {
+        if(!_objects[i]->isDirty()) continue;
+
+        _objects[i]->setCleanInternal(_absoluteTransformations[i], Implementation::FeatureCleaning::NotThreadSafe);
+        CORRADE_ASSERT(!_objects[i]->isDirty(), "SceneGraph::FlatTransformationCache::update(): original implementation was not called", );
+    }
+}
+
+template<class Transformation> void FlatTransformationCache<Transformation>::updateIsland(void* const state, const std::size_t id) {
+    FlatTransformationCache<Transformation>& cache = *static_cast<FlatTransformationCache<Transformation>*>(state);
+    const UnsignedInt begin = cache._islands[id].first;
+    const UnsignedInt end = cache._islands[id].second;
+
+    /* Island root is the first item, all other objects have their parent
+       inside the same island */
+    cache._transformations[begin] = cache._objects[begin]->transformation();
+    cache._absoluteTransformations[begin] = Implementation::Transformation<Transformation>::compose(cache._islandBaseTransformations[id], cache._transformations[begin]);
+    for(UnsignedInt i = begin + 1; i != end; ++i) {
+        cache._transformations[i] = cache._objects[i]->transformation();
+        cache._absoluteTransformations[i] = Implementation::Transformation<Transformation>::compose(cache._absoluteTransformations[cache._parents[i]], cache._transformations[i]);
+    }
+
+    /* Clean thread-safe features, objects with no other features are marked
+       as clean right away */
+    for(UnsignedInt i = begin; i != end; ++i) {
+        if(cache._objects[i]->isDirty())
+            cache._objects[i]->setCleanInternal(cache._absoluteTransformations[i], Implementation::FeatureCleaning::ThreadSafe);
+    }
+}
+
+}}
+
+#endif
@@ -0,0 +1,252 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "HiZCuller.hpp"
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Context.h"
+#include "Magnum/Framebuffer.h"
+#include "Magnum/Image.h"
+#include "Magnum/ImageReadbackQueue.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Shader.h"
+#include "Magnum/Texture.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/Version.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+
+namespace {
+
+/* Each output texel is the maximum of the 2x2 source texels below it. If the
+   source size is odd, the last output texel also covers the last source
+   column or row so nothing is left out. Has to be kept in sync with
+   HiZPyramid::setData(). */
+constexpr const char* ReductionVertexShader =
+    "void main() {\n"
+    "    gl_Position = vec4((gl_VertexID == 2) ?  3.0 : -1.0,\n"
+    "                       (gl_VertexID == 1) ? -3.0 :  1.0, 0.0, 1.0);\n"
+    "}\n";
+constexpr const char* ReductionFragmentShader =
+    "uniform highp sampler2D sourceTexture;\n"
+    "out highp float depth;\n"
+    "void main() {\n"
+    "    highp ivec2 sourceSize = textureSize(sourceTexture, 0);\n"
+    "    highp ivec2 size = max(sourceSize/2, ivec2(1));\n"
+    "    highp ivec2 position = ivec2(gl_FragCoord.xy);\n"
+    "    highp ivec2 first = position*2;\n"
+    "    highp ivec2 last = min(mix(first + ivec2(1), sourceSize - ivec2(1), equal(position, size - ivec2(1))), sourceSize - ivec2(1));\n"
+    "    depth = 0.0;\n"
+    "    for(highp int y = first.y; y <= last.y; ++y)\n"
+    "        for(highp int x = first.x; x <= last.x; ++x)\n"
+    "            depth = max(depth, texelFetch(sourceTexture, ivec2(x, y), 0).r);\n"
+    "}\n";
+
+class ReductionShader: public AbstractShaderProgram {
+    public:
+        enum: Int { SourceTextureLayer = 0 };
+
+        explicit ReductionShader();
+};
+
+ReductionShader::ReductionShader() {
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GL300);
+    const Version version = Context::current().supportedVersion({Version::GL320, Version::GL310, Version::GL300});
+    #else
+    MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GLES300);
+    const Version version = Version::GLES300;
+    #endif
+
+    Shader vert{version, Shader::Type::Vertex};
+    Shader frag{version, Shader::Type::Fragment};
+    vert.addSource(ReductionVertexShader);
+    frag.addSource(ReductionFragmentShader);
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({vert, frag}));
+    attachShaders({vert, frag});
+
+    #ifndef MAGNUM_TARGET_GLES
+    bindFragmentDataLocation(0, "depth");
+    #endif
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+    setUniform(uniformLocation("sourceTexture"), SourceTextureLayer);
+}
+
+Vector2i levelSize(const Vector2i& size) {
+    return Math::max(size/2, Vector2i{1});
+}
+
+}
+
+void HiZPyramid::setData(const Vector2i& size, std::vector<Float> data) {
+    CORRADE_INTERNAL_ASSERT(std::size_t(size.product()) == data.size());
+
+    _levels.clear();
+    _levels.emplace_back(size, std::move(data));
+    while((_levels.back().first > Vector2i{1}).any()) {
+        const Vector2i sourceSize = _levels.back().first;
+        const Vector2i nextSize = levelSize(sourceSize);
+        const std::vector<Float>& source = _levels.back().second;
+
+        std::vector<Float> next(nextSize.product());
+        for(Int y = 0; y != nextSize.y(); ++y) {
+            const Int lastY = y == nextSize.y() - 1 ? sourceSize.y() - 1 : Math::min(y*2 + 1, sourceSize.y() - 1);
+            for(Int x = 0; x != nextSize.x(); ++x) {
+                const Int lastX = x == nextSize.x() - 1 ? sourceSize.x() - 1 : Math::min(x*2 + 1, sourceSize.x() - 1);
+
+                Float depth = 0.0f;
+                for(Int sy = y*2; sy <= lastY; ++sy)
+                    for(Int sx = x*2; sx <= lastX; ++sx)
+                        depth = Math::max(depth, source[sy*sourceSize.x() + sx]);
+                next[y*nextSize.x() + x] = depth;
+            }
+        }
+
+        _levels.emplace_back(nextSize, std::move(next));
+    }
+}
+
+bool HiZPyramid::isOccluded(const Range2D& rectangle, const Float depth) const {
+    if(_levels.empty()) return false;
+
+    /* Nothing is known about areas outside of the pyramid */
+    if((rectangle.min() < Vector2{0.0f}).any() || (rectangle.max() > Vector2{1.0f}).any())
+        return false;
+
+    /* Covered texel range on the first level, inclusive */
+    const Vector2i last = _levels.front().first - Vector2i{1};
+    const Vector2 size{_levels.front().first};
+    Vector2i min = Math::min(Vector2i{Math::floor(rectangle.min()*size)}, last);
+    Vector2i max = Math::max(Math::min(Vector2i{Math::ceil(rectangle.max()*size)} - Vector2i{1}, last), min);
+
+    /* Go coarser until the range is at most two texels in each direction */
+    Int level = 0;
+    while(level + 1 != levelCount() && ((max - min) > Vector2i{1}).any()) {
+        ++level;
+        min /= 2;
+        max = Math::min(max/2, _levels[level].first - Vector2i{1});
+    }
+
+    for(Int y = min.y(); y <= max.y(); ++y)
+        for(Int x = min.x(); x <= max.x(); ++x)
+            if(depth <= this->depth(level, {x, y})) return false;
+
+    return true;
+}
+
+struct HiZReduction::State {
+    explicit State(UnsignedInt latency): queue{PixelFormat::Red, PixelType::Float, latency} {}
+
+    ReductionShader shader;
+    Texture2D texture;
+    std::vector<Framebuffer> framebuffers;
+    Mesh triangle;
+    ImageReadbackQueue2D queue;
+};
+
+HiZReduction::HiZReduction(const Vector2i& size, const UnsignedInt latency): _state{new State{latency}} {
+    /* Level sizes, pick the first one that's small enough for the readback */
+    std::vector<Vector2i> sizes{levelSize(size)};
+    while((sizes.back() > Vector2i{1}).any())
+        sizes.push_back(levelSize(sizes.back()));
+    for(_readbackLevel = 0; (sizes[_readbackLevel] > Vector2i{128}).any(); ++_readbackLevel);
+
+    _state->texture.setMinificationFilter(Sampler::Filter::Nearest, Sampler::Mipmap::Nearest)
+        .setMagnificationFilter(Sampler::Filter::Nearest)
+        .setWrapping(Sampler::Wrapping::ClampToEdge)
+        .setStorage(sizes.size(), TextureFormat::R32F, sizes.front());
+
+    _state->framebuffers.reserve(sizes.size());
+    for(std::size_t i = 0; i != sizes.size(); ++i) {
+        _state->framebuffers.emplace_back(Range2Di{{}, sizes[i]});
+        _state->framebuffers.back().attachTexture(Framebuffer::ColorAttachment{0}, _state->texture, i)
+            .mapForDraw(Framebuffer::ColorAttachment{0});
+    }
+    _state->framebuffers[_readbackLevel].mapForRead(Framebuffer::ColorAttachment{0});
+
+    /* Attribute-less full-screen triangle, see MeshTools::fullScreenTriangle() */
+    _state->triangle.setPrimitive(MeshPrimitive::Triangles)
+        .setCount(3);
+}
+
+HiZReduction::~HiZReduction() = default;
+
+Int HiZReduction::levelCount() const { return _state->framebuffers.size(); }
+
+Texture2D& HiZReduction::texture() { return _state->texture; }
+
+void HiZReduction::reduce(Texture2D& depth) {
+    depth.bind(ReductionShader::SourceTextureLayer);
+    _state->framebuffers.front().bind();
+    _state->triangle.draw(_state->shader);
+
+    /* Restrict the accessible levels so the level being rendered to is never
+       sampled */
+    _state->texture.bind(ReductionShader::SourceTextureLayer);
+    for(Int level = 1; level != levelCount(); ++level) {
+        _state->texture.setBaseLevel(level - 1)
+            .setMaxLevel(level - 1);
+        _state->framebuffers[level].bind();
+        _state->triangle.draw(_state->shader);
+    }
+    _state->texture.setBaseLevel(0)
+        .setMaxLevel(levelCount() - 1);
+
+    Framebuffer& readback = _state->framebuffers[_readbackLevel];
+    _state->queue.read(readback, readback.viewport());
+}
+
+bool HiZReduction::retrieve(HiZPyramid& pyramid) {
+    std::optional<Image2D> image = _state->queue.retrieve();
+    if(!image) return false;
+
+    const Float* const data = image->data<Float>();
+    pyramid.setData(image->size(), std::vector<Float>(data, data + image->size().product()));
+    return true;
+}
+
+}
+
+/* Instantiated here and not in instantiation.cpp, as the unit test library
+   doesn't link to Magnum. On non-MinGW Windows the instantiation is already
+   marked with extern template. */
+#if !defined(CORRADE_TARGET_WINDOWS) || defined(__MINGW32__)
+template class MAGNUM_SCENEGRAPH_EXPORT BasicHiZCuller3D<Float>;
+#else
+template class BasicHiZCuller3D<Float>;
+#endif
+
+}}
+#endif
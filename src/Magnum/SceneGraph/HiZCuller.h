@@ -0,0 +1,283 @@
+#ifndef Magnum_SceneGraph_HiZCuller_h
+#define Magnum_SceneGraph_HiZCuller_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::BasicHiZCuller3D, typedef @ref Magnum::SceneGraph::HiZCuller3D
+ */
+#endif
+
+#include "Magnum/configure.h"
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "Magnum/Math/Range.h"
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+    /* CPU copy of the depth pyramid, level 0 is the downloaded level, the
+       coarser ones are calculated from it */
+    class MAGNUM_SCENEGRAPH_EXPORT HiZPyramid {
+        public:
+            Int levelCount() const { return _levels.size(); }
+            Vector2i size(Int level) const { return _levels[level].first; }
+            Float depth(Int level, const Vector2i& position) const {
+                return _levels[level].second[position.y()*_levels[level].first.x() + position.x()];
+            }
+
+            /* Takes maximal depth for each texel, rows from bottom to top */
+            void setData(const Vector2i& size, std::vector<Float> data);
+
+            /* Rectangle in [0, 1] window coordinates, depth is the nearest
+               depth of the tested geometry. Returns false if there are no
+               data. */
+            bool isOccluded(const Range2D& rectangle, Float depth) const;
+
+        private:
+            std::vector<std::pair<Vector2i, std::vector<Float>>> _levels;
+    };
+
+    /* Builds the depth pyramid on the GPU and downloads its coarse level */
+    class MAGNUM_SCENEGRAPH_EXPORT HiZReduction {
+        public:
+            explicit HiZReduction(const Vector2i& size, UnsignedInt latency);
+            ~HiZReduction();
+
+            Int levelCount() const;
+            Int readbackLevel() const { return _readbackLevel; }
+            Texture2D& texture();
+
+            void reduce(Texture2D& depth);
+
+            /* Returns false if no new data are available */
+            bool retrieve(HiZPyramid& pyramid);
+
+        private:
+            struct State;
+            std::unique_ptr<State> _state;
+            Int _readbackLevel;
+    };
+
+    /* Projects the unit box transformed with given matrix into a window
+       rectangle and nearest depth. Returns false if the box crosses the
+       near plane. */
+    template<class T> bool hiZProjectBox(const Math::Matrix4<T>& transformationProjectionMatrix, Range2D& rectangle, Float& depth);
+}
+
+/**
+@brief Hierarchical-Z occlusion culler for three-dimensional scenes
+
+Draws a group of drawables, skipping those whose bounding box is hidden behind
+the depth of a previous frame. Unlike @ref OcclusionCuller3D, which needs a
+query per drawable and one frame to decide, it tests all drawables on the CPU
+against a small depth image, so it's useful for scenes with many drawables and
+also for filling multi-draw batches using @ref cull().
+
+The depth of a frame is passed to @ref update(). It is reduced on the GPU into
+a mip chain where each texel contains the farthest depth of the four texels
+below it. A coarse level of the chain, at most 128 texels wide and tall, is
+then downloaded using @ref ImageReadbackQueue2D, so the readback doesn't stall
+the pipeline, and the rest of the chain is calculated from it on the CPU. A
+drawable is occluded if the nearest depth of its projected bounding box is
+farther than the farthest depth in the covered area, which is tested on the
+mip level where the area spans at most two texels in each direction.
+@code
+Texture2D depth;
+depth.setStorage(1, TextureFormat::DepthComponent24, size);
+Framebuffer framebuffer{{{}, size}};
+framebuffer.attachTexture(Framebuffer::BufferAttachment::Depth, depth, 0)
+    // attach color ...
+
+SceneGraph::HiZCuller3D culler{size};
+
+// each frame
+framebuffer.clear(FramebufferClear::Color|FramebufferClear::Depth).bind();
+culler.draw(camera, drawables);
+culler.update(depth, camera);
+@endcode
+
+If the scene is rendered into the default framebuffer, the depth can be first
+copied into a depth texture using @ref Framebuffer::blit() with
+@ref FramebufferBlit::Depth.
+
+Because the depth arrives a few frames later, it is reprojected using the
+camera matrix and projection matrix of the frame it comes from. Geometry that
+moved since then or areas that were not visible in that frame may cause
+visible objects to be culled for a few frames, so the depth passed to
+@ref update() should contain only static or slowly moving occluders. A box
+crossing the camera near plane or the near plane of the frame the depth comes
+from is never culled, similarly to drawables without a bounding volume. Until
+the first depth arrives, nothing is culled.
+
+## Multi-draw batches
+
+The @ref cull() function returns the visible drawables without drawing them,
+which allows to issue them all at once for example using
+@ref MeshView::drawIndirect():
+@code
+std::vector<std::reference_wrapper<MeshView>> meshes;
+for(const SceneGraph::Camera3D::DrawableTransformation& visible: culler.cull(camera, drawables))
+    meshes.push_back(static_cast<MyDrawable&>(visible.first.get()).mesh());
+
+MeshView::drawIndirect(shader, meshes, indirectBuffer);
+@endcode
+
+## Explicit template specializations
+
+The following specialization is explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref HiZCuller.hpp implementation file to avoid linker
+errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref HiZCuller3D
+
+@see @ref scenegraph, @ref DepthPrepass3D
+@requires_gl30 Extension @extension{ARB,texture_float},
+    @extension{ARB,texture_rg} and @extension{EXT,gpu_shader4}
+@requires_gles30 Float textures and integer texture fetches are not available
+    in OpenGL ES 2.0.
+@requires_es_extension Extension @es_extension{EXT,color_buffer_float} for
+    rendering into and reading from float textures in OpenGL ES.
+@requires_gles Buffer mapping is not available in WebGL.
+*/
+template<class T> class BasicHiZCuller3D {
+    public:
+        /**
+         * @brief Constructor
+         * @param size      Size of the depth texture passed to @ref update()
+         * @param latency   Maximal count of frames the depth readback is
+         *      allowed to lag behind
+         *
+         * Creates the pyramid texture, which is half the @p size, and the
+         * reduction shader.
+         */
+        explicit BasicHiZCuller3D(const Vector2i& size, UnsignedInt latency = 3);
+
+        /** @brief Copying is not allowed */
+        BasicHiZCuller3D(const BasicHiZCuller3D<T>&) = delete;
+
+        /** @brief Copying is not allowed */
+        BasicHiZCuller3D<T>& operator=(const BasicHiZCuller3D<T>&) = delete;
+
+        ~BasicHiZCuller3D();
+
+        /**
+         * @brief Depth pyramid texture
+         *
+         * Single-channel float texture with full mip chain, where level `0`
+         * is half the size of the depth. Useful for debugging or for culling
+         * done by custom GPU code.
+         */
+        Texture2D& pyramidTexture();
+
+        /**
+         * @brief Mip level of the pyramid texture that's downloaded
+         *
+         * The first level that is at most 128 texels wide and tall.
+         */
+        Int readbackLevel() const;
+
+        /**
+         * @brief Whether any depth data are available
+         *
+         * Until the first readback arrives, no drawables are culled.
+         */
+        bool hasData() const { return _pyramid.levelCount() != 0; }
+
+        /**
+         * @brief Update the depth pyramid
+         * @param depth     Depth texture of size passed to the constructor
+         * @param camera    Camera used to render the depth
+         *
+         * Retrieves the latest completed readback, reduces @p depth into
+         * the pyramid and schedules its download. Changes the current
+         * framebuffer and viewport, so the framebuffer used for rendering
+         * needs to be bound again afterwards.
+         * @see @fn_gl{FenceSync}, @fn_gl{ClientWaitSync}
+         */
+        void update(Texture2D& depth, Camera<3, T>& camera);
+
+        /**
+         * @brief Cull a group of drawables
+         *
+         * Returns transformations of drawables that are in the camera view
+         * frustum and are not occluded, in the same format as
+         * @ref Camera::drawableTransformations().
+         */
+        std::vector<typename Camera<3, T>::DrawableTransformation> cull(Camera<3, T>& camera, DrawableGroup<3, T>& group);
+
+        /**
+         * @brief Draw group of drawables with occlusion culling
+         *
+         * Calls @ref Drawable::draw() on all drawables returned by
+         * @ref cull().
+         */
+        void draw(Camera<3, T>& camera, DrawableGroup<3, T>& group);
+
+        /**
+         * @brief Count of drawables drawn or returned in last @ref cull() call
+         *
+         * Doesn't include drawables removed by frustum culling.
+         * @see @ref occludedCount()
+         */
+        std::size_t drawCount() const { return _drawCount; }
+
+        /** @brief Count of occluded drawables in last @ref cull() call */
+        std::size_t occludedCount() const { return _occludedCount; }
+
+    private:
+        Implementation::HiZReduction _reduction;
+        Implementation::HiZPyramid _pyramid;
+        std::deque<Math::Matrix4<T>> _pendingMatrices;
+        Math::Matrix4<T> _matrix;
+        std::size_t _drawCount, _occludedCount;
+};
+
+/**
+@brief Hierarchical-Z occlusion culler for three-dimensional float scenes
+
+@see @ref BasicHiZCuller3D
+*/
+typedef BasicHiZCuller3D<Float> HiZCuller3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT BasicHiZCuller3D<Float>;
+#endif
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 and WebGL build
+#endif
+
+#endif
@@ -0,0 +1,119 @@
+#ifndef Magnum_SceneGraph_HiZCuller_hpp
+#define Magnum_SceneGraph_HiZCuller_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref HiZCuller.h
+ */
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneGraph/HiZCuller.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+
+template<class T> bool hiZProjectBox(const Math::Matrix4<T>& transformationProjectionMatrix, Range2D& rectangle, Float& depth) {
+    Math::Vector3<T> min{Constants::inf()}, max{-Constants::inf()};
+    for(UnsignedInt i = 0; i != 8; ++i) {
+        const Math::Vector4<T> corner = transformationProjectionMatrix*Math::Vector4<T>{
+            i & 1 ? T(1) : T(-1), i & 2 ? T(1) : T(-1), i & 4 ? T(1) : T(-1), T(1)};
+        if(corner.z() < -corner.w()) return false;
+
+        const Math::Vector3<T> ndc = corner.xyz()/corner.w();
+        min = Math::min(min, ndc);
+        max = Math::max(max, ndc);
+    }
+
+    rectangle = {Vector2{min.xy()*T(0.5) + Math::Vector2<T>{T(0.5)}},
+                 Vector2{max.xy()*T(0.5) + Math::Vector2<T>{T(0.5)}}};
+    depth = Float(min.z()*T(0.5) + T(0.5));
+    return true;
+}
+
+}
+
+template<class T> BasicHiZCuller3D<T>::BasicHiZCuller3D(const Vector2i& size, const UnsignedInt latency): _reduction{size, latency}, _drawCount{}, _occludedCount{} {}
+
+template<class T> BasicHiZCuller3D<T>::~BasicHiZCuller3D() = default;
+
+template<class T> Texture2D& BasicHiZCuller3D<T>::pyramidTexture() { return _reduction.texture(); }
+
+template<class T> Int BasicHiZCuller3D<T>::readbackLevel() const { return _reduction.readbackLevel(); }
+
+template<class T> void BasicHiZCuller3D<T>::update(Texture2D& depth, Camera<3, T>& camera) {
+    /* The readbacks are retrieved in the order they were scheduled */
+    if(_reduction.retrieve(_pyramid)) {
+        _matrix = _pendingMatrices.front();
+        _pendingMatrices.pop_front();
+    }
+
+    _reduction.reduce(depth);
+    _pendingMatrices.push_back(camera.projectionMatrix()*camera.cameraMatrix());
+}
+
+template<class T> std::vector<typename Camera<3, T>::DrawableTransformation> BasicHiZCuller3D<T>::cull(Camera<3, T>& camera, DrawableGroup<3, T>& group) {
+    const std::vector<typename Camera<3, T>::DrawableTransformation>& drawableTransformations = camera.drawableTransformations(group);
+
+    std::vector<typename Camera<3, T>::DrawableTransformation> visible;
+    visible.reserve(drawableTransformations.size());
+    _occludedCount = 0;
+
+    /* Transforms from current camera space to clip space of the frame the
+       depth comes from */
+    const Math::Matrix4<T> reprojectionMatrix = _matrix*camera.cameraMatrix().inverted();
+
+    for(const typename Camera<3, T>::DrawableTransformation& drawableTransformation: drawableTransformations) {
+        const Drawable<3, T>& drawable = drawableTransformation.first;
+
+        if(hasData() && drawable.boundingVolume() != BoundingVolume::None) {
+            Range2D rectangle;
+            Float depth;
+            if(Implementation::hiZProjectBox(reprojectionMatrix*drawableTransformation.second*
+                Math::Matrix4<T>::translation(drawable.boundingCenter())*
+                Math::Matrix4<T>::scaling(drawable.boundingExtent()), rectangle, depth) &&
+               _pyramid.isOccluded(rectangle, depth))
+            {
+                ++_occludedCount;
+                continue;
+            }
+        }
+
+        visible.push_back(drawableTransformation);
+    }
+
+    _drawCount = visible.size();
+    return visible;
+}
+
+template<class T> void BasicHiZCuller3D<T>::draw(Camera<3, T>& camera, DrawableGroup<3, T>& group) {
+    for(const typename Camera<3, T>::DrawableTransformation& drawableTransformation: cull(camera, group))
+        drawableTransformation.first.get().draw(drawableTransformation.second, camera);
+}
+
+}}
+
+#endif
@@ -0,0 +1,147 @@
+#ifndef Magnum_SceneGraph_HlodCluster_h
+#define Magnum_SceneGraph_HlodCluster_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::SceneGraph::HlodCluster, function @ref Magnum::SceneGraph::hlodClusters()
+ */
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "Magnum/Math/Range.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Spatially nearby drawables for hierarchical level of detail
+
+@see @ref hlodClusters(), @ref HlodDrawable
+*/
+template<UnsignedInt dimensions, class T> struct HlodCluster {
+    /**
+     * @brief Bounds of the cluster
+     *
+     * Union of bounding volumes of all drawables in the cluster, relative
+     * to the root object passed to @ref hlodClusters().
+     */
+    RangeTypeFor<dimensions, T> bounds;
+
+    /**
+     * @brief Drawables and their transformations
+     *
+     * Transformation of each drawable relative to the root object passed to
+     * @ref hlodClusters().
+     */
+    std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>> drawables;
+};
+
+/**
+@brief Cluster static drawables for hierarchical level of detail
+@param root     Root of the static subtree
+@param group    Drawable group
+@param cellSize Size of a cluster cell
+
+Returns drawables from @p group that are attached to @p root or any of its
+descendants, grouped by the cell of a uniform grid with @p cellSize in which
+the center of their bounding volume lies, each together with its
+transformation relative to @p root. Drawables without bounding volume use
+origin of their object instead. The cell size should be a few times larger
+than a typical object so each cluster contains enough geometry to be worth
+replacing. As the clusters are assigned based on bounding volume centers, the
+cluster bounds may extend past the cell, the clusters are ordered by the cell,
+drawables in each cluster are in the order they are in the group.
+
+For each cluster, a merged and simplified proxy mesh can be then generated
+with @ref MeshTools::generateHlodProxy() together with texture atlas baked
+using @ref TextureTools::bakeAtlas() and drawn in place of the original
+drawables with @ref HlodDrawable, which switches back to them when the cluster
+gets close to the camera:
+@code
+for(const SceneGraph::HlodCluster3D& cluster: SceneGraph::hlodClusters(city, drawables, 200.0f)) {
+    // generate proxy mesh and atlas, see MeshTools::generateHlodProxy()
+
+    auto proxy = new ProxyDrawable{city, drawables, ...};
+    proxy->setSwitchDistance(500.0f)
+        .setBoundingBox(cluster.bounds);
+    for(const auto& drawable: cluster.drawables) {
+        drawables.remove(drawable.first);
+        proxy->addOriginal(drawable.first);
+    }
+}
+@endcode
+
+Note that moving the original objects afterwards has no effect on the
+clusters and the generated proxies.
+@see @ref staticBatches()
+*/
+template<UnsignedInt dimensions, class T> std::vector<HlodCluster<dimensions, T>> hlodClusters(AbstractObject<dimensions, T>& root, DrawableGroup<dimensions, T>& group, T cellSize);
+
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+/**
+@brief Hierarchical level of detail cluster of two-dimensional drawables
+
+Convenience alternative to `HlodCluster<2, T>`. See @ref hlodClusters() for
+more information.
+@see @ref HlodCluster2D, @ref BasicHlodCluster3D
+*/
+template<class T> using BasicHlodCluster2D = HlodCluster<2, T>;
+
+/**
+@brief Hierarchical level of detail cluster of three-dimensional drawables
+
+Convenience alternative to `HlodCluster<3, T>`. See @ref hlodClusters() for
+more information.
+@see @ref HlodCluster3D, @ref BasicHlodCluster2D
+*/
+template<class T> using BasicHlodCluster3D = HlodCluster<3, T>;
+#endif
+
+/**
+@brief Hierarchical level of detail cluster of two-dimensional float drawables
+
+@see @ref HlodCluster3D
+*/
+typedef BasicHlodCluster2D<Float> HlodCluster2D;
+
+/**
+@brief Hierarchical level of detail cluster of three-dimensional float drawables
+
+@see @ref HlodCluster2D
+*/
+typedef BasicHlodCluster3D<Float> HlodCluster3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template MAGNUM_SCENEGRAPH_EXPORT std::vector<HlodCluster<2, Float>> hlodClusters(AbstractObject<2, Float>&, DrawableGroup<2, Float>&, Float);
+extern template MAGNUM_SCENEGRAPH_EXPORT std::vector<HlodCluster<3, Float>> hlodClusters(AbstractObject<3, Float>&, DrawableGroup<3, Float>&, Float);
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,109 @@
+#ifndef Magnum_SceneGraph_HlodCluster_hpp
+#define Magnum_SceneGraph_HlodCluster_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref HlodCluster.h
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/SceneGraph/AbstractObject.h"
+#include "Magnum/SceneGraph/FeatureGroup.h"
+#include "Magnum/SceneGraph/HlodCluster.h"
+
+namespace Magnum { namespace SceneGraph {
+
+template<UnsignedInt dimensions, class T> std::vector<HlodCluster<dimensions, T>> hlodClusters(AbstractObject<dimensions, T>& root, DrawableGroup<dimensions, T>& group, const T cellSize) {
+    struct Item {
+        UnsignedInt index;
+        Math::Vector<dimensions, Int> cell;
+        RangeTypeFor<dimensions, T> bounds;
+        MatrixTypeFor<dimensions, T> transformation;
+    };
+
+    /* Pick drawables in the subtree, calculate their bounds relative to the
+       root and the cell they belong to */
+    const MatrixTypeFor<dimensions, T> invertedRootTransformation = root.absoluteTransformationMatrix().inverted();
+    std::vector<Item> items;
+    for(std::size_t i = 0; i != group.size(); ++i) {
+        for(AbstractObject<dimensions, T>* object = &group[i].object(); object; object = object->parent()) {
+            if(object != &root) continue;
+
+            const Drawable<dimensions, T>& drawable = group[i];
+            const MatrixTypeFor<dimensions, T> transformation = invertedRootTransformation*drawable.object().absoluteTransformationMatrix();
+            VectorTypeFor<dimensions, T> center = transformation.translation();
+            VectorTypeFor<dimensions, T> extent;
+            if(drawable.boundingVolume() != BoundingVolume::None) {
+                /* Box extents are transformed by absolute value of the
+                   rotation and scaling part */
+                const auto rotationScaling = transformation.rotationScaling();
+                center = transformation.transformPoint(drawable.boundingCenter());
+                for(UnsignedInt j = 0; j != dimensions; ++j)
+                    extent += Math::abs(rotationScaling[j])*drawable.boundingExtent()[j];
+            }
+
+            Math::Vector<dimensions, Int> cell;
+            for(UnsignedInt j = 0; j != dimensions; ++j)
+                cell[j] = Int(std::floor(center[j]/cellSize));
+
+            items.push_back({UnsignedInt(i), cell, RangeTypeFor<dimensions, T>{center - extent, center + extent}, transformation});
+            break;
+        }
+    }
+
+    /* Sort by cell, original index is the last key to keep the group order
+       inside each cluster */
+    std::sort(items.begin(), items.end(), [](const Item& a, const Item& b) {
+        for(UnsignedInt i = 0; i != dimensions; ++i)
+            if(a.cell[i] != b.cell[i]) return a.cell[i] < b.cell[i];
+        return a.index < b.index;
+    });
+
+    /* Start a new cluster every time the cell changes */
+    std::vector<HlodCluster<dimensions, T>> clusters;
+    for(std::size_t i = 0; i != items.size(); ++i) {
+        const Item& item = items[i];
+        if(!i || item.cell != items[i - 1].cell)
+            clusters.push_back({item.bounds, {}});
+        /* Not using Math::join(), as it ignores zero-size bounds of drawables
+           without bounding volume */
+        else {
+            RangeTypeFor<dimensions, T>& bounds = clusters.back().bounds;
+            bounds = {Math::min(bounds.min(), item.bounds.min()), Math::max(bounds.max(), item.bounds.max())};
+        }
+
+        clusters.back().drawables.emplace_back(group[item.index], item.transformation);
+    }
+
+    return clusters;
+}
+
+}}
+
+#endif
@@ -0,0 +1,198 @@
+#ifndef Magnum_SceneGraph_HlodDrawable_h
+#define Magnum_SceneGraph_HlodDrawable_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::HlodDrawable, alias @ref Magnum::SceneGraph::BasicHlodDrawable2D, @ref Magnum::SceneGraph::BasicHlodDrawable3D, typedef @ref Magnum::SceneGraph::HlodDrawable2D, @ref Magnum::SceneGraph::HlodDrawable3D
+ */
+
+#include <functional>
+#include <vector>
+
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Drawable switching between a cluster proxy and original drawables
+
+Stands in for a cluster of static drawables, usually collected using
+@ref hlodClusters(). If distance of its bounding volume from the camera is at
+least @ref switchDistance(), a single proxy mesh is drawn, otherwise all the
+original drawables added with @ref addOriginal() are drawn in its place. The
+distance is measured from the camera origin to the bounding sphere (or sphere
+enclosing the bounding box), drawables without bounding volume use distance
+to the object origin.
+
+The original drawables are expected to be removed from the group that is
+drawn by the camera, otherwise they would be drawn twice. Their absolute
+transformation is recalculated every time the originals are drawn, they are
+culled only together with the whole cluster using the bounding volume of this
+drawable.
+
+Instead of @ref draw(), implement @ref drawProxy():
+@code
+class ProxyDrawable: public SceneGraph::HlodDrawable3D {
+    public:
+        explicit ProxyDrawable(Object3D& object, SceneGraph::DrawableGroup3D* group, Mesh& mesh, Texture2D& atlas): SceneGraph::HlodDrawable3D{object, group}, _mesh(mesh), _atlas(atlas) {}
+
+    private:
+        void drawProxy(const Matrix4& transformationMatrix, SceneGraph::Camera3D& camera) override {
+            // ...
+            _mesh.draw(_shader);
+        }
+
+        Mesh& _mesh;
+        Texture2D& _atlas;
+        Shaders::Phong _shader;
+};
+@endcode
+
+See @ref hlodClusters() for more information about setting it up.
+
+## Explicit template specializations
+
+The following specializations are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref HlodDrawable.hpp implementation file to avoid
+linker errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref HlodDrawable2D
+-   @ref HlodDrawable3D
+
+@see @ref scenegraph, @ref LodDrawable, @ref BasicHlodDrawable2D,
+    @ref BasicHlodDrawable3D, @ref HlodDrawable2D, @ref HlodDrawable3D
+*/
+template<UnsignedInt dimensions, class T> class HlodDrawable: public Drawable<dimensions, T> {
+    public:
+        /**
+         * @brief Constructor
+         * @param object    Object this drawable belongs to
+         * @param drawables Group this drawable belongs to
+         *
+         * Switch distance is set to @cpp 0 @ce by default, so the proxy is
+         * always drawn.
+         */
+        explicit HlodDrawable(AbstractObject<dimensions, T>& object, DrawableGroup<dimensions, T>* drawables = nullptr);
+
+        /** @brief Switch distance */
+        T switchDistance() const { return _switchDistance; }
+
+        /**
+         * @brief Set switch distance
+         * @return Reference to self (for method chaining)
+         *
+         * Minimal distance from the camera at which the proxy is drawn
+         * instead of the original drawables.
+         */
+        HlodDrawable<dimensions, T>& setSwitchDistance(T distance) {
+            _switchDistance = distance;
+            return *this;
+        }
+
+        /** @brief Original drawables */
+        const std::vector<std::reference_wrapper<Drawable<dimensions, T>>>& originals() const { return _originals; }
+
+        /**
+         * @brief Add original drawable
+         * @return Reference to self (for method chaining)
+         *
+         * The drawable is drawn in place of the proxy when the cluster is
+         * closer than @ref switchDistance().
+         */
+        HlodDrawable<dimensions, T>& addOriginal(Drawable<dimensions, T>& drawable) {
+            _originals.push_back(drawable);
+            return *this;
+        }
+
+        /**
+         * @brief Distance of the bounding volume from the camera
+         * @param transformationMatrix  Object transformation relative to camera
+         *
+         * Returns @cpp 0 @ce if the camera is inside the bounding volume.
+         */
+        T distance(const MatrixTypeFor<dimensions, T>& transformationMatrix) const;
+
+    private:
+        /* Calls drawProxy() or draws the originals based on distance() */
+        void draw(const MatrixTypeFor<dimensions, T>& transformationMatrix, Camera<dimensions, T>& camera) override final;
+
+        /**
+         * @brief Draw the proxy
+         * @param transformationMatrix  Object transformation relative to camera
+         * @param camera                Camera
+         */
+        virtual void drawProxy(const MatrixTypeFor<dimensions, T>& transformationMatrix, Camera<dimensions, T>& camera) = 0;
+
+        T _switchDistance;
+        std::vector<std::reference_wrapper<Drawable<dimensions, T>>> _originals;
+};
+
+/**
+@brief Drawable switching between a cluster proxy and original drawables for two-dimensional scenes
+
+Convenience alternative to `HlodDrawable<2, T>`. See @ref HlodDrawable for
+more information.
+@see @ref HlodDrawable2D, @ref BasicHlodDrawable3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicHlodDrawable2D = HlodDrawable<2, T>;
+#endif
+
+/**
+@brief Drawable switching between a cluster proxy and original drawables for two-dimensional float scenes
+
+@see @ref HlodDrawable3D
+*/
+typedef BasicHlodDrawable2D<Float> HlodDrawable2D;
+
+/**
+@brief Drawable switching between a cluster proxy and original drawables for three-dimensional scenes
+
+Convenience alternative to `HlodDrawable<3, T>`. See @ref HlodDrawable for
+more information.
+@see @ref HlodDrawable3D, @ref BasicHlodDrawable2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicHlodDrawable3D = HlodDrawable<3, T>;
+#endif
+
+/**
+@brief Drawable switching between a cluster proxy and original drawables for three-dimensional float scenes
+
+@see @ref HlodDrawable2D
+*/
+typedef BasicHlodDrawable3D<Float> HlodDrawable3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT HlodDrawable<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT HlodDrawable<3, Float>;
+#endif
+
+}}
+
+#endif
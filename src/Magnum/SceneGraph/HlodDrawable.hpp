@@ -0,0 +1,76 @@
+#ifndef Magnum_SceneGraph_HlodDrawable_hpp
+#define Magnum_SceneGraph_HlodDrawable_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref HlodDrawable.h
+ */
+
+#include <cmath>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/SceneGraph/AbstractObject.h"
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/HlodDrawable.h"
+
+namespace Magnum { namespace SceneGraph {
+
+template<UnsignedInt dimensions, class T> HlodDrawable<dimensions, T>::HlodDrawable(AbstractObject<dimensions, T>& object, DrawableGroup<dimensions, T>* drawables): Drawable<dimensions, T>{object, drawables}, _switchDistance{} {}
+
+template<UnsignedInt dimensions, class T> T HlodDrawable<dimensions, T>::distance(const MatrixTypeFor<dimensions, T>& transformationMatrix) const {
+    if(this->boundingVolume() == BoundingVolume::None)
+        return transformationMatrix.translation().length();
+
+    /* Radius of the bounding sphere, scaled by the largest scaling of the
+       transformation */
+    const T radius = this->boundingVolume() == BoundingVolume::Sphere ?
+        this->boundingExtent().max() : this->boundingExtent().length();
+    T scaling{};
+    for(UnsignedInt i = 0; i != dimensions; ++i) {
+        T squaredLength{};
+        for(UnsignedInt j = 0; j != dimensions; ++j)
+            squaredLength += transformationMatrix[i][j]*transformationMatrix[i][j];
+        scaling = Math::max(scaling, squaredLength);
+    }
+
+    const T distance = transformationMatrix.transformPoint(this->boundingCenter()).length() - radius*std::sqrt(scaling);
+    return Math::max(distance, T(0));
+}
+
+template<UnsignedInt dimensions, class T> void HlodDrawable<dimensions, T>::draw(const MatrixTypeFor<dimensions, T>& transformationMatrix, Camera<dimensions, T>& camera) {
+    if(distance(transformationMatrix) >= _switchDistance) {
+        drawProxy(transformationMatrix, camera);
+        return;
+    }
+
+    const MatrixTypeFor<dimensions, T> cameraMatrix = camera.cameraMatrix();
+    for(Drawable<dimensions, T>& original: _originals)
+        original.draw(cameraMatrix*original.object().absoluteTransformationMatrix(), camera);
+}
+
+}}
+
+#endif
@@ -0,0 +1,188 @@
+#ifndef Magnum_SceneGraph_InstanceCollector_h
+#define Magnum_SceneGraph_InstanceCollector_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::InstanceCollector, alias @ref Magnum::SceneGraph::BasicInstanceCollector2D, @ref Magnum::SceneGraph::BasicInstanceCollector3D, typedef @ref Magnum::SceneGraph::InstanceCollector2D, @ref Magnum::SceneGraph::InstanceCollector3D
+ */
+
+#include <vector>
+
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Instance collector
+
+Collects transformations of drawables sharing the same
+@ref Drawable::drawState() "render state" into contiguous batches, so each
+batch can be drawn with a single instanced draw call instead of calling
+@ref Drawable::draw() for each drawable separately. The transformations are
+relative to the camera and are laid out so they can be directly uploaded into
+an instance buffer set up with @ref MeshTools::compile(const Trade::MeshData3D&, BufferUsage, Buffer&):
+@code
+Buffer instanceBuffer;
+Mesh mesh;
+std::unique_ptr<Buffer> vertices, indices;
+std::tie(mesh, vertices, indices) = MeshTools::compile(rock, BufferUsage::StaticDraw, instanceBuffer);
+
+// add thousands of rocks sharing the same draw state...
+
+SceneGraph::InstanceCollector3D collector;
+
+// each frame
+collector.collect(camera, rocks);
+instanceBuffer.setData(collector.transformations(), BufferUsage::StreamDraw);
+for(const SceneGraph::InstanceCollector3D::Batch& batch: collector.batches()) {
+    mesh.setInstanceCount(batch.count)
+        .setBaseInstance(batch.offset);
+    mesh.draw(shader);
+}
+@endcode
+
+Drawables are grouped by the full @ref DrawState, batches are ordered by it and
+drawables in each batch are in the order they are in the group. Drawables
+with @ref DrawState::mesh set to `0` are treated as having an unknown mesh and
+each of them gets a batch of its own. Frustum culling is done the same way as
+in @ref Camera::draw(), see @ref SceneGraph-Drawable-culling "Drawable documentation"
+for details. Internal storage is reused between calls, so no allocation is
+done unless the group grew since the previous call.
+
+## Explicit template specializations
+
+The following specializations are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref InstanceCollector.hpp implementation file to avoid
+linker errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref InstanceCollector2D
+-   @ref InstanceCollector3D
+
+@see @ref scenegraph, @ref BasicInstanceCollector2D,
+    @ref BasicInstanceCollector3D, @ref InstanceCollector2D,
+    @ref InstanceCollector3D, @ref RenderQueue
+*/
+template<UnsignedInt dimensions, class T> class InstanceCollector {
+    public:
+        /** @brief Batch of drawables sharing the same render state */
+        struct Batch {
+            /** @brief Render state shared by all drawables in the batch */
+            DrawState state;
+
+            /**
+             * @brief First drawable in the batch
+             *
+             * Useful for retrieving the mesh and other properties.
+             */
+            Drawable<dimensions, T>* drawable;
+
+            /** @brief Offset of the batch in @ref transformations() */
+            UnsignedInt offset;
+
+            /** @brief Count of drawables in the batch */
+            UnsignedInt count;
+        };
+
+        explicit InstanceCollector();
+
+        /**
+         * @brief Collect transformations of given group of drawables
+         *
+         * Replaces contents of @ref transformations() and @ref batches() with
+         * visible drawables of given group.
+         */
+        void collect(Camera<dimensions, T>& camera, DrawableGroup<dimensions, T>& group);
+
+        /**
+         * @brief Transformations relative to the camera
+         *
+         * Transformations of all batches in @ref batches() one after
+         * another.
+         */
+        const std::vector<MatrixTypeFor<dimensions, T>>& transformations() const {
+            return _transformations;
+        }
+
+        /** @brief Batches */
+        const std::vector<Batch>& batches() const { return _batches; }
+
+    private:
+        struct Item {
+            DrawState state;
+            UnsignedInt index;
+        };
+
+        std::vector<Item> _items;
+        std::vector<MatrixTypeFor<dimensions, T>> _transformations;
+        std::vector<Batch> _batches;
+};
+
+/**
+@brief Instance collector for two-dimensional scenes
+
+Convenience alternative to `InstanceCollector<2, T>`. See
+@ref InstanceCollector for more information.
+@see @ref InstanceCollector2D, @ref BasicInstanceCollector3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicInstanceCollector2D = InstanceCollector<2, T>;
+#endif
+
+/**
+@brief Instance collector for two-dimensional float scenes
+
+@see @ref InstanceCollector3D
+*/
+typedef BasicInstanceCollector2D<Float> InstanceCollector2D;
+
+/**
+@brief Instance collector for three-dimensional scenes
+
+Convenience alternative to `InstanceCollector<3, T>`. See
+@ref InstanceCollector for more information.
+@see @ref InstanceCollector3D, @ref BasicInstanceCollector2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicInstanceCollector3D = InstanceCollector<3, T>;
+#endif
+
+/**
+@brief Instance collector for three-dimensional float scenes
+
+@see @ref InstanceCollector2D
+*/
+typedef BasicInstanceCollector3D<Float> InstanceCollector3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT InstanceCollector<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT InstanceCollector<3, Float>;
+#endif
+
+}}
+
+#endif
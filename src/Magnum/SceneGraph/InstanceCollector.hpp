@@ -0,0 +1,74 @@
+#ifndef Magnum_SceneGraph_InstanceCollector_hpp
+#define Magnum_SceneGraph_InstanceCollector_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref InstanceCollector.h
+ */
+
+#include <algorithm>
+
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/InstanceCollector.h"
+
+namespace Magnum { namespace SceneGraph {
+
+template<UnsignedInt dimensions, class T> InstanceCollector<dimensions, T>::InstanceCollector() = default;
+
+template<UnsignedInt dimensions, class T> void InstanceCollector<dimensions, T>::collect(Camera<dimensions, T>& camera, DrawableGroup<dimensions, T>& group) {
+    const std::vector<typename Camera<dimensions, T>::DrawableTransformation>& drawableTransformations = camera.drawableTransformations(group);
+
+    /* Sort by state, original index is the last key to keep the group order
+       inside each batch */
+    _items.clear();
+    _items.reserve(drawableTransformations.size());
+    for(std::size_t i = 0; i != drawableTransformations.size(); ++i)
+        _items.push_back({drawableTransformations[i].first.get().drawState(), UnsignedInt(i)});
+    std::sort(_items.begin(), _items.end(), [](const Item& a, const Item& b) {
+        if(a.state.shader != b.state.shader) return a.state.shader < b.state.shader;
+        if(a.state.renderState != b.state.renderState) return a.state.renderState < b.state.renderState;
+        if(a.state.textures != b.state.textures) return a.state.textures < b.state.textures;
+        if(a.state.mesh != b.state.mesh) return a.state.mesh < b.state.mesh;
+        return a.index < b.index;
+    });
+
+    /* Put the transformations one after another, starting a new batch every
+       time the state changes or the mesh is unknown */
+    _transformations.clear();
+    _transformations.reserve(_items.size());
+    _batches.clear();
+    for(const Item& item: _items) {
+        if(_batches.empty() || _batches.back().state != item.state || !item.state.mesh)
+            _batches.push_back({item.state, &drawableTransformations[item.index].first.get(), UnsignedInt(_transformations.size()), 0});
+
+        _transformations.push_back(drawableTransformations[item.index].second);
+        ++_batches.back().count;
+    }
+}
+
+}}
+
+#endif
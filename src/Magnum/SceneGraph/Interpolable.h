@@ -0,0 +1,241 @@
+#ifndef Magnum_SceneGraph_Interpolable_h
+#define Magnum_SceneGraph_Interpolable_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::Interpolable, @ref Magnum::SceneGraph::InterpolableGroup, alias @ref Magnum::SceneGraph::BasicInterpolable2D, @ref Magnum::SceneGraph::BasicInterpolable3D, @ref Magnum::SceneGraph::BasicInterpolableGroup2D, @ref Magnum::SceneGraph::BasicInterpolableGroup3D, typedef @ref Magnum::SceneGraph::Interpolable2D, @ref Magnum::SceneGraph::Interpolable3D, @ref Magnum::SceneGraph::InterpolableGroup2D, @ref Magnum::SceneGraph::InterpolableGroup3D
+ */
+
+#include "Magnum/SceneGraph/AbstractGroupedFeature.h"
+#include "Magnum/SceneGraph/FeatureGroup.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Interpolable
+
+Remembers absolute transformation of the object from the previous simulation
+step, so it can be drawn interpolated between the previous and the current
+simulation state. Used together with @ref FixedTimestep to run the
+simulation at a fixed rate, decoupled from rendering, without visible
+stutter. Call @ref InterpolableGroup::capture() before each simulation step
+and then draw the objects with @ref transformationMatrix(), passing
+@ref FixedTimestep::alpha() to it:
+@code
+class Box: public Object3D, public SceneGraph::Drawable3D, public SceneGraph::Interpolable3D {
+    public:
+        explicit Box(Object3D* parent, SceneGraph::DrawableGroup3D* drawables, SceneGraph::InterpolableGroup3D* interpolables): Object3D{parent}, SceneGraph::Drawable3D{*this, drawables}, SceneGraph::Interpolable3D{*this, interpolables} {}
+
+        Float alpha;
+
+    private:
+        void draw(const Matrix4&, SceneGraph::Camera3D& camera) override {
+            const Matrix4 transformationMatrix = camera.cameraMatrix()*Interpolable3D::transformationMatrix(alpha);
+            // ...
+        }
+};
+
+// in the draw event
+timestep.accumulate(timeline.previousFrameDuration());
+while(timestep.nextStep()) {
+    interpolables.capture();
+    animables.step(timestep.time(), timestep.step());
+}
+@endcode
+
+Translation and scaling is interpolated linearly, rotation is interpolated
+using spherical linear interpolation along the shortest path (see
+@ref Math::slerp()), so the transformations are expected to not contain any
+shear. Before the first @ref capture() the current transformation is
+returned.
+
+## Explicit template specializations
+
+The following specializations are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref Interpolable.hpp implementation file to avoid
+linker errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref Interpolable2D, @ref InterpolableGroup2D
+-   @ref Interpolable3D, @ref InterpolableGroup3D
+
+@see @ref scenegraph, @ref BasicInterpolable2D, @ref BasicInterpolable3D,
+    @ref Interpolable2D, @ref Interpolable3D
+*/
+template<UnsignedInt dimensions, class T> class Interpolable: public AbstractGroupedFeature<dimensions, Interpolable<dimensions, T>, T> {
+    public:
+        /**
+         * @brief Constructor
+         * @param object    Object this interpolable belongs to
+         * @param group     Group this interpolable belongs to
+         *
+         * Nothing is captured initially.
+         */
+        explicit Interpolable(AbstractObject<dimensions, T>& object, InterpolableGroup<dimensions, T>* group = nullptr);
+
+        /** @brief Whether the previous transformation is captured */
+        bool isCaptured() const { return _captured; }
+
+        /**
+         * @brief Capture current transformation
+         *
+         * Saves current absolute transformation of the object as the
+         * previous state. Called from @ref InterpolableGroup::capture(), call
+         * it directly for objects that aren't part of any group. Call it
+         * twice to make the object jump to a new position without
+         * interpolation.
+         */
+        void capture();
+
+        /**
+         * @brief Previous absolute transformation
+         *
+         * Absolute transformation saved by the last @ref capture(). Identity
+         * if nothing was captured yet.
+         */
+        const MatrixTypeFor<dimensions, T>& previousTransformationMatrix() const {
+            return _previousTransformationMatrix;
+        }
+
+        /**
+         * @brief Interpolated absolute transformation
+         * @param alpha     Interpolation factor, usually
+         *      @ref FixedTimestep::alpha()
+         *
+         * Returns @ref previousTransformationMatrix() for @p alpha equal to
+         * @cpp 0 @ce and current absolute transformation of the object for
+         * @p alpha equal to @cpp 1 @ce. If nothing was captured yet, returns
+         * current absolute transformation.
+         */
+        MatrixTypeFor<dimensions, T> transformationMatrix(T alpha) const;
+
+    private:
+        MatrixTypeFor<dimensions, T> _previousTransformationMatrix;
+        bool _captured;
+};
+
+/**
+@brief Group of interpolables
+
+See @ref Interpolable for more information.
+@see @ref scenegraph, @ref BasicInterpolableGroup2D,
+    @ref BasicInterpolableGroup3D, @ref InterpolableGroup2D,
+    @ref InterpolableGroup3D
+*/
+template<UnsignedInt dimensions, class T> class InterpolableGroup: public FeatureGroup<dimensions, Interpolable<dimensions, T>, T> {
+    public:
+        /**
+         * @brief Capture current transformation of all interpolables
+         *
+         * Call before each simulation step.
+         * @see @ref Interpolable::capture()
+         */
+        void capture();
+};
+
+/**
+@brief Interpolable for two-dimensional scenes
+
+Convenience alternative to `Interpolable<2, T>`. See @ref Interpolable for
+more information.
+@see @ref Interpolable2D, @ref BasicInterpolable3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicInterpolable2D = Interpolable<2, T>;
+#endif
+
+/**
+@brief Interpolable for two-dimensional float scenes
+
+@see @ref Interpolable3D
+*/
+typedef BasicInterpolable2D<Float> Interpolable2D;
+
+/**
+@brief Interpolable for three-dimensional scenes
+
+Convenience alternative to `Interpolable<3, T>`. See @ref Interpolable for
+more information.
+@see @ref Interpolable3D, @ref BasicInterpolable2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicInterpolable3D = Interpolable<3, T>;
+#endif
+
+/**
+@brief Interpolable for three-dimensional float scenes
+
+@see @ref Interpolable2D
+*/
+typedef BasicInterpolable3D<Float> Interpolable3D;
+
+/**
+@brief Interpolable group for two-dimensional scenes
+
+Convenience alternative to `InterpolableGroup<2, T>`. See @ref Interpolable
+for more information.
+@see @ref InterpolableGroup2D, @ref BasicInterpolableGroup3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicInterpolableGroup2D = InterpolableGroup<2, T>;
+#endif
+
+/**
+@brief Interpolable group for two-dimensional float scenes
+
+@see @ref InterpolableGroup3D
+*/
+typedef BasicInterpolableGroup2D<Float> InterpolableGroup2D;
+
+/**
+@brief Interpolable group for three-dimensional scenes
+
+Convenience alternative to `InterpolableGroup<3, T>`. See @ref Interpolable
+for more information.
+@see @ref InterpolableGroup3D, @ref BasicInterpolableGroup2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicInterpolableGroup3D = InterpolableGroup<3, T>;
+#endif
+
+/**
+@brief Interpolable group for three-dimensional float scenes
+
+@see @ref InterpolableGroup2D
+*/
+typedef BasicInterpolableGroup3D<Float> InterpolableGroup3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT Interpolable<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT Interpolable<3, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT InterpolableGroup<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT InterpolableGroup<3, Float>;
+#endif
+
+}}
+
+#endif
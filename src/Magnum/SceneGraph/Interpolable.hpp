@@ -0,0 +1,118 @@
+#ifndef Magnum_SceneGraph_Interpolable_hpp
+#define Magnum_SceneGraph_Interpolable_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref Interpolable.h
+ */
+
+#include "Magnum/Math/Complex.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/SceneGraph/AbstractObject.h"
+#include "Magnum/SceneGraph/Interpolable.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+
+template<UnsignedInt, class> struct TransformationInterpolator;
+
+template<class T> struct TransformationInterpolator<2, T> {
+    /* Splits the matrix into rotation and per-axis scaling, mirroring is
+       put into the scaling */
+    static Math::Complex<T> decompose(const Math::Matrix3<T>& matrix, Math::Vector2<T>& scaling) {
+        scaling = {matrix[0].xy().length(), matrix[1].xy().length()};
+        if(matrix.rotationScaling().determinant() < T(0)) scaling.y() = -scaling.y();
+        return Math::Complex<T>::fromMatrix({matrix[0].xy()/scaling.x(),
+                                             matrix[1].xy()/scaling.y()});
+    }
+
+    static Math::Matrix3<T> interpolate(const Math::Matrix3<T>& a, const Math::Matrix3<T>& b, const T t) {
+        Math::Vector2<T> scalingA, scalingB;
+        const Math::Complex<T> rotationA = decompose(a, scalingA);
+        const Math::Complex<T> rotationB = decompose(b, scalingB);
+
+        /* Angle of the relative rotation is always in [-pi, pi], i.e. along
+           the shortest path */
+        const Math::Matrix2x2<T> rotation = (rotationA*Math::Complex<T>::rotation((rotationA.inverted()*rotationB).angle()*t)).toMatrix();
+        const Math::Vector2<T> scaling = Math::lerp(scalingA, scalingB, t);
+        return Math::Matrix3<T>::from({rotation[0]*scaling.x(),
+                                       rotation[1]*scaling.y()},
+            Math::lerp(a.translation(), b.translation(), t));
+    }
+};
+
+template<class T> struct TransformationInterpolator<3, T> {
+    static Math::Quaternion<T> decompose(const Math::Matrix4<T>& matrix, Math::Vector3<T>& scaling) {
+        scaling = {matrix[0].xyz().length(), matrix[1].xyz().length(), matrix[2].xyz().length()};
+        if(matrix.rotationScaling().determinant() < T(0)) scaling.z() = -scaling.z();
+        return Math::Quaternion<T>::fromMatrix({matrix[0].xyz()/scaling.x(),
+                                                matrix[1].xyz()/scaling.y(),
+                                                matrix[2].xyz()/scaling.z()});
+    }
+
+    static Math::Matrix4<T> interpolate(const Math::Matrix4<T>& a, const Math::Matrix4<T>& b, const T t) {
+        Math::Vector3<T> scalingA, scalingB;
+        const Math::Quaternion<T> rotationA = decompose(a, scalingA);
+        Math::Quaternion<T> rotationB = decompose(b, scalingB);
+
+        /* Go along the shortest path */
+        if(Math::dot(rotationA, rotationB) < T(0)) rotationB = -rotationB;
+
+        const Math::Matrix3x3<T> rotation = Math::slerp(rotationA, rotationB, t).toMatrix();
+        const Math::Vector3<T> scaling = Math::lerp(scalingA, scalingB, t);
+        return Math::Matrix4<T>::from({rotation[0]*scaling.x(),
+                                       rotation[1]*scaling.y(),
+                                       rotation[2]*scaling.z()},
+            Math::lerp(a.translation(), b.translation(), t));
+    }
+};
+
+}
+
+template<UnsignedInt dimensions, class T> Interpolable<dimensions, T>::Interpolable(AbstractObject<dimensions, T>& object, InterpolableGroup<dimensions, T>* group): AbstractGroupedFeature<dimensions, Interpolable<dimensions, T>, T>{object, group}, _captured{false} {}
+
+template<UnsignedInt dimensions, class T> void Interpolable<dimensions, T>::capture() {
+    _previousTransformationMatrix = this->object().absoluteTransformationMatrix();
+    _captured = true;
+}
+
+template<UnsignedInt dimensions, class T> MatrixTypeFor<dimensions, T> Interpolable<dimensions, T>::transformationMatrix(const T alpha) const {
+    const MatrixTypeFor<dimensions, T> current = this->object().absoluteTransformationMatrix();
+    if(!_captured || current == _previousTransformationMatrix) return current;
+    return Implementation::TransformationInterpolator<dimensions, T>::interpolate(_previousTransformationMatrix, current, alpha);
+}
+
+template<UnsignedInt dimensions, class T> void InterpolableGroup<dimensions, T>::capture() {
+    for(std::size_t i = 0; i != this->size(); ++i) (*this)[i].capture();
+}
+
+}}
+
+#endif
@@ -0,0 +1,188 @@
+#ifndef Magnum_SceneGraph_LodDrawable_h
+#define Magnum_SceneGraph_LodDrawable_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::LodDrawable, alias @ref Magnum::SceneGraph::BasicLodDrawable2D, @ref Magnum::SceneGraph::BasicLodDrawable3D, typedef @ref Magnum::SceneGraph::LodDrawable2D, @ref Magnum::SceneGraph::LodDrawable3D
+ */
+
+#include <vector>
+
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Drawable with multiple detail levels
+
+Selects detail level of the drawable based on size of its bounding volume
+projected on the screen, so distant objects can be drawn with fewer
+triangles. The projected size is diameter of the bounding sphere (or sphere
+enclosing the bounding box) relative to the viewport height, i.e. @cpp 1.0 @ce
+if the object fills the whole viewport vertically. Level @cpp 0 @ce is drawn
+if the size is at least the first threshold set by @ref setLodThresholds(),
+level @cpp 1 @ce if it's at least the second threshold and so on, level equal
+to the threshold count is drawn if it's smaller than all of them. Drawables
+without bounding volume are always drawn with level @cpp 0 @ce.
+
+Instead of @ref draw(), implement @ref drawLod(). The detail levels can be
+generated for example using @ref MeshTools::generateLods():
+@code
+class Rock: public Object3D, public SceneGraph::LodDrawable3D {
+    public:
+        explicit Rock(Object3D* parent, SceneGraph::DrawableGroup3D* group): Object3D{parent}, SceneGraph::LodDrawable3D{*this, group} {
+            setBoundingSphere({}, 1.0f);
+            setLodThresholds({0.25f, 0.1f, 0.02f});
+        }
+
+    private:
+        void drawLod(const Matrix4& transformationMatrix, SceneGraph::Camera3D& camera, UnsignedInt lod) override {
+            // ...
+            _meshes[lod].draw(_shader);
+        }
+
+        Mesh _meshes[4];
+        Shaders::Phong _shader;
+};
+@endcode
+
+## Explicit template specializations
+
+The following specializations are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref LodDrawable.hpp implementation file to avoid linker
+errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref LodDrawable2D
+-   @ref LodDrawable3D
+
+@see @ref scenegraph, @ref BasicLodDrawable2D, @ref BasicLodDrawable3D,
+    @ref LodDrawable2D, @ref LodDrawable3D
+*/
+template<UnsignedInt dimensions, class T> class LodDrawable: public Drawable<dimensions, T> {
+    public:
+        /**
+         * @brief Constructor
+         * @param object    Object this drawable belongs to
+         * @param drawables Group this drawable belongs to
+         *
+         * No thresholds are set by default, so level @cpp 0 @ce is always
+         * drawn.
+         */
+        explicit LodDrawable(AbstractObject<dimensions, T>& object, DrawableGroup<dimensions, T>* drawables = nullptr);
+
+        /** @brief Detail level thresholds */
+        const std::vector<T>& lodThresholds() const { return _lodThresholds; }
+
+        /**
+         * @brief Set detail level thresholds
+         * @return Reference to self (for method chaining)
+         *
+         * Minimal projected size for each level, in descending order. See
+         * @ref LodDrawable class documentation for more information.
+         */
+        LodDrawable<dimensions, T>& setLodThresholds(std::vector<T> thresholds);
+
+        /**
+         * @brief Projected size of the bounding volume
+         * @param transformationMatrix  Object transformation relative to camera
+         * @param camera                Camera
+         *
+         * Relative to viewport height. Returns infinity if the drawable has no
+         * bounding volume.
+         */
+        T projectedSize(const MatrixTypeFor<dimensions, T>& transformationMatrix, const Camera<dimensions, T>& camera) const;
+
+        /**
+         * @brief Detail level for given transformation
+         * @param transformationMatrix  Object transformation relative to camera
+         * @param camera                Camera
+         *
+         * @see @ref projectedSize(), @ref lodThresholds()
+         */
+        UnsignedInt lod(const MatrixTypeFor<dimensions, T>& transformationMatrix, const Camera<dimensions, T>& camera) const;
+
+    private:
+        /* Calls drawLod() with level computed using lod() */
+        void draw(const MatrixTypeFor<dimensions, T>& transformationMatrix, Camera<dimensions, T>& camera) override final;
+
+        /**
+         * @brief Draw the object using given camera and detail level
+         * @param transformationMatrix  Object transformation relative to camera
+         * @param camera                Camera
+         * @param lod                   Detail level, at most
+         *      @ref lodThresholds() size
+         */
+        virtual void drawLod(const MatrixTypeFor<dimensions, T>& transformationMatrix, Camera<dimensions, T>& camera, UnsignedInt lod) = 0;
+
+        std::vector<T> _lodThresholds;
+};
+
+/**
+@brief Drawable with multiple detail levels for two-dimensional scenes
+
+Convenience alternative to `LodDrawable<2, T>`. See @ref LodDrawable for more
+information.
+@see @ref LodDrawable2D, @ref BasicLodDrawable3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicLodDrawable2D = LodDrawable<2, T>;
+#endif
+
+/**
+@brief Drawable with multiple detail levels for two-dimensional float scenes
+
+@see @ref LodDrawable3D
+*/
+typedef BasicLodDrawable2D<Float> LodDrawable2D;
+
+/**
+@brief Drawable with multiple detail levels for three-dimensional scenes
+
+Convenience alternative to `LodDrawable<3, T>`. See @ref LodDrawable for more
+information.
+@see @ref LodDrawable3D, @ref BasicLodDrawable2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicLodDrawable3D = LodDrawable<3, T>;
+#endif
+
+/**
+@brief Drawable with multiple detail levels for three-dimensional float scenes
+
+@see @ref LodDrawable2D
+*/
+typedef BasicLodDrawable3D<Float> LodDrawable3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT LodDrawable<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT LodDrawable<3, Float>;
+#endif
+
+}}
+
+#endif
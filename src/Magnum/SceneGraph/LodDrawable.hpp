@@ -0,0 +1,91 @@
+#ifndef Magnum_SceneGraph_LodDrawable_hpp
+#define Magnum_SceneGraph_LodDrawable_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref LodDrawable.h
+ */
+
+#include <cmath>
+
+#include "Magnum/Math/Constants.h"
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/LodDrawable.h"
+
+namespace Magnum { namespace SceneGraph {
+
+template<UnsignedInt dimensions, class T> LodDrawable<dimensions, T>::LodDrawable(AbstractObject<dimensions, T>& object, DrawableGroup<dimensions, T>* drawables): Drawable<dimensions, T>{object, drawables} {}
+
+template<UnsignedInt dimensions, class T> LodDrawable<dimensions, T>& LodDrawable<dimensions, T>::setLodThresholds(std::vector<T> thresholds) {
+    _lodThresholds = std::move(thresholds);
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> T LodDrawable<dimensions, T>::projectedSize(const MatrixTypeFor<dimensions, T>& transformationMatrix, const Camera<dimensions, T>& camera) const {
+    if(this->boundingVolume() == BoundingVolume::None)
+        return Math::Constants<T>::inf();
+
+    /* Radius of the bounding sphere, scaled by the largest scaling of the
+       transformation */
+    const T radius = this->boundingVolume() == BoundingVolume::Sphere ?
+        this->boundingExtent().max() : this->boundingExtent().length();
+    T scaling{};
+    for(UnsignedInt i = 0; i != dimensions; ++i) {
+        T squaredLength{};
+        for(UnsignedInt j = 0; j != dimensions; ++j)
+            squaredLength += transformationMatrix[i][j]*transformationMatrix[i][j];
+        scaling = Math::max(scaling, squaredLength);
+    }
+
+    /* W component of the center in clip space is distance from the camera
+       for perspective projection and 1 for orthographic projection */
+    const VectorTypeFor<dimensions, T> center = transformationMatrix.transformPoint(this->boundingCenter());
+    const MatrixTypeFor<dimensions, T> projectionMatrix = camera.projectionMatrix();
+    T w = projectionMatrix[dimensions][dimensions];
+    for(UnsignedInt i = 0; i != dimensions; ++i)
+        w += projectionMatrix[i][dimensions]*center[i];
+    if(w == T(0)) return Math::Constants<T>::inf();
+
+    /* Viewport height is 2 in normalized device coordinates, thus the
+       diameter relative to it is equal to the projected radius */
+    return radius*std::sqrt(scaling)*std::abs(projectionMatrix[1][1]/w);
+}
+
+template<UnsignedInt dimensions, class T> UnsignedInt LodDrawable<dimensions, T>::lod(const MatrixTypeFor<dimensions, T>& transformationMatrix, const Camera<dimensions, T>& camera) const {
+    const T size = projectedSize(transformationMatrix, camera);
+
+    UnsignedInt lod = 0;
+    while(lod != _lodThresholds.size() && size < _lodThresholds[lod]) ++lod;
+    return lod;
+}
+
+template<UnsignedInt dimensions, class T> void LodDrawable<dimensions, T>::draw(const MatrixTypeFor<dimensions, T>& transformationMatrix, Camera<dimensions, T>& camera) {
+    drawLod(transformationMatrix, camera, lod(transformationMatrix, camera));
+}
+
+}}
+
+#endif
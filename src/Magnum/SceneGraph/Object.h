@@ -41,12 +41,22 @@ namespace Implementation {
     enum class ObjectFlag: UnsignedByte {
         Dirty = 1 << 0,
         Visited = 1 << 1,
-        Joint = 1 << 2
+        Joint = 1 << 2,
+        Island = 1 << 3,
+        Pooled = 1 << 4,
+        Destroying = 1 << 5,
+        DirtyRoot = 1 << 6
     };
 
     typedef Containers::EnumSet<ObjectFlag> ObjectFlags;
 
     CORRADE_ENUMSET_OPERATORS(ObjectFlags)
+
+    enum class FeatureCleaning: UnsignedByte {
+        All,
+        ThreadSafe,
+        NotThreadSafe
+    };
 }
 
 /**
@@ -113,6 +123,8 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
 {
     friend Containers::LinkedList<Object<Transformation>>;
     friend Containers::LinkedListItem<Object<Transformation>, Object<Transformation>>;
+    friend FlatTransformationCache<Transformation>;
+    friend Scene<Transformation>;
 
     public:
         /** @brief Matrix type */
@@ -134,7 +146,8 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
          * @brief Destructor
          *
          * Removes itself from parent's children list and destroys all own
-         * children.
+         * children. If the object is part of a scene, its
+         * @ref Scene::hierarchyGeneration() is incremented.
          */
         ~Object();
 
@@ -232,12 +245,46 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
          * @brief Add a child
          *
          * Calling `object.addChild<MyObject>(args...)` is equivalent to
-         * `new MyObject{args..., &object}`.
+         * `new MyObject{args..., &object}`. If the object is part of a scene
+         * with @ref Scene::setPoolAllocator() "pool allocator" set, the child
+         * is allocated from the pool instead. In that case it has to be
+         * destroyed using @ref destroy() and not using @cpp delete @ce.
          */
         template<class T, class ...Args> T& addChild(Args... args) {
-            return *(new T{std::forward<Args>(args)..., this});
+            PoolAllocator* const allocator = doPoolAllocator();
+            if(!allocator) return *(new T{std::forward<Args>(args)..., this});
+
+            T* const object = new(allocator->allocate(sizeof(T), alignof(T))) T{std::forward<Args>(args)..., this};
+            static_cast<Object<Transformation>&>(*object).flags |= Flag::Pooled;
+            return *object;
         }
 
+        /**
+         * @brief Destroy the object
+         *
+         * Equivalent to @cpp delete this @ce for objects allocated with
+         * @cpp new @ce, returns the memory back to the pool for objects
+         * allocated using @ref addChild() in a scene with
+         * @ref Scene::setPoolAllocator() "pool allocator" set. All children
+         * and features are destroyed as well. Expects that the object is not
+         * allocated on stack.
+         * @see @ref destroyChildren(), @ref AbstractFeature::destroy()
+         */
+        void destroy();
+
+        /**
+         * @brief Destroy all children
+         * @return Reference to self (for method chaining)
+         *
+         * Destroys the whole subtree except this object. Unlike destroying
+         * the children one by one, the scene is notified about the hierarchy
+         * change only once and the objects in the subtree don't need to
+         * notify their parents about their destruction, so the operation is
+         * linear in the count of destroyed objects and features.
+         * @see @ref destroy(), @ref Scene::hierarchyGeneration()
+         */
+        Object<Transformation>& destroyChildren();
+
         /**
          * @brief Set parent object
          * @return Reference to self (for method chaining)
@@ -256,6 +303,25 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
          */
         Object<Transformation>& setParentKeepTransformation(Object<Transformation>* parent);
 
+        /**
+         * @brief Whether this object is an island
+         *
+         * @see @ref setIsland()
+         */
+        bool isIsland() const { return !!(flags & Flag::Island); }
+
+        /**
+         * @brief Mark this object as an island
+         * @return Reference to self (for method chaining)
+         *
+         * Subtree of an island object is considered independent from the rest
+         * of the scene and is processed as a separate task in
+         * @ref FlatTransformationCache::update(AbstractTaskExecutor&).
+         * Direct children of the scene are always treated as islands. Useful
+         * for splitting large subtrees into smaller tasks.
+         */
+        Object<Transformation>& setIsland(bool island);
+
         /*@}*/
 
         /** @{ @name Object transformation */
@@ -366,6 +432,8 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
         Object<Transformation>* doParent() override final;
         const Object<Transformation>* doParent() const override final;
 
+        PoolAllocator* doPoolAllocator() const override final;
+
         MatrixType MAGNUM_SCENEGRAPH_LOCAL doTransformationMatrix() const override final {
             return transformationMatrix();
         }
@@ -374,6 +442,7 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
         }
 
         std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const MatrixType& initialTransformationMatrix) const override final;
+        void doTransformationMatricesInto(Containers::ArrayView<const std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>> objects, Containers::ArrayView<MatrixType> out, const MatrixType& initialTransformationMatrix) const override final;
 
         typename Transformation::DataType MAGNUM_SCENEGRAPH_LOCAL computeJointTransformation(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::size_t joint, const typename Transformation::DataType& initialTransformation) const;
 
@@ -382,12 +451,19 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
         void MAGNUM_SCENEGRAPH_LOCAL doSetClean() override final { setClean(); }
         void doSetClean(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects) override final;
 
-        void MAGNUM_SCENEGRAPH_LOCAL setCleanInternal(const typename Transformation::DataType& absoluteTransformation);
+        void MAGNUM_SCENEGRAPH_LOCAL setCleanInternal(const typename Transformation::DataType& absoluteTransformation, Implementation::FeatureCleaning cleaning = Implementation::FeatureCleaning::All);
+
+        static void MAGNUM_SCENEGRAPH_LOCAL hierarchyChanged(Object<Transformation>* object);
+
+        void MAGNUM_SCENEGRAPH_LOCAL addDirtyRoot();
+        void MAGNUM_SCENEGRAPH_LOCAL removeDirtyRoots(Scene<Transformation>& scene);
+        void cleanAllInternal();
 
         typedef Implementation::ObjectFlag Flag;
         typedef Implementation::ObjectFlags Flags;
         UnsignedShort counter;
         Flags flags;
+        UnsignedInt dirtyRootIndex;
 };
 
 }}
@@ -31,7 +31,9 @@
 
 #include <algorithm>
 #include <stack>
+#include <utility>
 
+#include "Magnum/Math/DualQuaternion.h"
 #include "Magnum/SceneGraph/AbstractTransformation.h"
 #include "Magnum/SceneGraph/Object.h"
 #include "Magnum/SceneGraph/Scene.h"
@@ -39,15 +41,66 @@
 namespace Magnum { namespace SceneGraph {
 
 template<UnsignedInt dimensions, class T> AbstractObject<dimensions, T>::AbstractObject() {}
-template<UnsignedInt dimensions, class T> AbstractObject<dimensions, T>::~AbstractObject() {}
+template<UnsignedInt dimensions, class T> AbstractObject<dimensions, T>::~AbstractObject() {
+    /* Destroy the features explicitly instead of relying on LinkedList
+       destructor, as some of them may be allocated from a pool */
+    while(!features().isEmpty()) features().first()->destroy();
+}
 
 template<UnsignedInt dimensions, class T> AbstractTransformation<dimensions, T>::AbstractTransformation() {}
 
-template<class Transformation> Object<Transformation>::Object(Object<Transformation>* parent): counter(0xFFFFu), flags(Flag::Dirty) {
+template<class Transformation> Object<Transformation>::Object(Object<Transformation>* parent): counter(0xFFFFu), flags(Flag::Dirty), dirtyRootIndex{} {
     setParent(parent);
 }
 
-template<class Transformation> Object<Transformation>::~Object() = default;
+template<class Transformation> Object<Transformation>::~Object() {
+    /* Remove itself from parent's children list explicitly (instead of
+       relying on LinkedListItem destructor) so the scene can be notified
+       about the change */
+    if(Object<Transformation>* const parent = this->parent()) {
+        /* If the parent is being destroyed as well, the scene was already
+           notified and the dirty roots in this subtree were removed */
+        if(!(parent->flags & Flag::Destroying)) {
+            if(Scene<Transformation>* const scene = this->scene())
+                removeDirtyRoots(*scene);
+            parent->Containers::template LinkedList<Object<Transformation>>::cut(this);
+            hierarchyChanged(parent);
+        } else parent->Containers::template LinkedList<Object<Transformation>>::cut(this);
+    }
+
+    /* Delete children while this is still a complete Object, so they can
+       safely walk up the (now detached) hierarchy in their destructors */
+    flags |= Flag::Destroying;
+    while(!children().isEmpty()) children().first()->destroy();
+}
+
+template<class Transformation> void Object<Transformation>::destroy() {
+    if(!(flags & Flag::Pooled)) {
+        delete this;
+        return;
+    }
+
+    /* The object might not be the first base of the allocated type */
+    void* const memory = dynamic_cast<void*>(this);
+    this->~Object();
+    PoolAllocator::deallocate(memory);
+}
+
+template<class Transformation> Object<Transformation>& Object<Transformation>::destroyChildren() {
+    if(children().isEmpty()) return *this;
+
+    /* The children won't remove their dirty roots when the parent is being
+       destroyed, do it here */
+    if(Scene<Transformation>* const scene = this->scene())
+        for(Object<Transformation>& child: children()) child.removeDirtyRoots(*scene);
+
+    flags |= Flag::Destroying;
+    while(!children().isEmpty()) children().first()->destroy();
+    flags &= ~Flag::Destroying;
+
+    hierarchyChanged(this);
+    return *this;
+}
 
 template<class Transformation> Scene<Transformation>* Object<Transformation>::scene() {
     Object<Transformation>* p(this);
@@ -77,6 +130,11 @@ template<class Transformation> const Object<Transformation>* Object<Transformati
     return parent();
 }
 
+template<class Transformation> PoolAllocator* Object<Transformation>::doPoolAllocator() const {
+    const Scene<Transformation>* const s = scene();
+    return s ? s->_poolAllocator : nullptr;
+}
+
 template<class Transformation> Object<Transformation>& Object<Transformation>::setParent(Object<Transformation>* parent) {
     /* Skip if parent is already parent or this is scene (which cannot have parent) */
     /** @todo Assert for setting parent to scene */
@@ -90,16 +148,44 @@ template<class Transformation> Object<Transformation>& Object<Transformation>::s
         p = p->parent();
     }
 
-    /* Remove the object from old parent children list */
-    if(this->parent()) this->parent()->Containers::template LinkedList<Object<Transformation>>::cut(this);
+    /* Remove the object from old parent children list. Dirty roots in the
+       subtree are not tracked by the old scene anymore. */
+    if(Object<Transformation>* const oldParent = this->parent()) {
+        if(Scene<Transformation>* const scene = this->scene())
+            removeDirtyRoots(*scene);
+        oldParent->Containers::template LinkedList<Object<Transformation>>::cut(this);
+        hierarchyChanged(oldParent);
+    }
 
     /* Add the object to list of new parent */
-    if(parent) parent->Containers::LinkedList<Object<Transformation>>::insert(this);
+    if(parent) {
+        parent->Containers::LinkedList<Object<Transformation>>::insert(this);
+        hierarchyChanged(parent);
+    }
 
+    /* If the object was already dirty, setDirty() does nothing, so the object
+       has to be made a dirty root explicitly */
     setDirty();
+    if(parent && !parent->isDirty()) addDirtyRoot();
     return *this;
 }
 
+template<class Transformation> Object<Transformation>& Object<Transformation>::setIsland(const bool island) {
+    if(isIsland() == island) return *this;
+
+    if(island) flags |= Flag::Island;
+    else flags &= ~Flag::Island;
+
+    /* Islands are part of the flattened hierarchy */
+    hierarchyChanged(this);
+    return *this;
+}
+
+template<class Transformation> void Object<Transformation>::hierarchyChanged(Object<Transformation>* object) {
+    while(object->parent()) object = object->parent();
+    if(object->isScene()) ++static_cast<Scene<Transformation>*>(object)->_hierarchyGeneration;
+}
+
 template<class Transformation> Object<Transformation>& Object<Transformation>::setParentKeepTransformation(Object<Transformation>* parent) {
     CORRADE_ASSERT(scene() == parent->scene(), "SceneGraph::Object::setParentKeepTransformation(): both parents must be in the same scene", *this);
 
@@ -121,6 +207,10 @@ template<class Transformation> void Object<Transformation>::setDirty() {
        nothing to do */
     if(flags & Flag::Dirty) return;
 
+    /* Mark object as dirty. Done before recursing into children so they don't
+       consider themselves roots of dirty subtrees. */
+    flags |= Flag::Dirty;
+
     /* Make all features dirty */
     for(AbstractFeature<Transformation::Dimensions, typename Transformation::Type>& feature: this->features())
         feature.markDirty();
@@ -129,8 +219,84 @@ template<class Transformation> void Object<Transformation>::setDirty() {
     for(Object<Transformation>& child: children())
         child.setDirty();
 
-    /* Mark object as dirty */
-    flags |= Flag::Dirty;
+    /* If the parent is clean, this is a root of dirty subtree. If the parent
+       is dirty, it's already covered by some other dirty root. */
+    Object<Transformation>* const parent = this->parent();
+    if(parent && !parent->isDirty()) addDirtyRoot();
+}
+
+template<class Transformation> void Object<Transformation>::addDirtyRoot() {
+    if(flags & Flag::DirtyRoot) return;
+
+    Scene<Transformation>* const scene = this->scene();
+    if(!scene) return;
+
+    flags |= Flag::DirtyRoot;
+    dirtyRootIndex = scene->_dirtyRoots.size();
+    scene->_dirtyRoots.push_back(this);
+}
+
+template<class Transformation> void Object<Transformation>::removeDirtyRoots(Scene<Transformation>& scene) {
+    std::vector<Object<Transformation>*>& dirtyRoots = scene._dirtyRoots;
+    if(dirtyRoots.empty()) return;
+
+    /* Remove all dirty roots in the subtree from the scene list, moving the
+       last item in place of the removed one */
+    std::vector<Object<Transformation>*> objects{this};
+    while(!objects.empty()) {
+        Object<Transformation>* const o = objects.back();
+        objects.pop_back();
+
+        if(o->flags & Flag::DirtyRoot) {
+            dirtyRoots[o->dirtyRootIndex] = dirtyRoots.back();
+            dirtyRoots[o->dirtyRootIndex]->dirtyRootIndex = o->dirtyRootIndex;
+            dirtyRoots.pop_back();
+            o->flags &= ~Flag::DirtyRoot;
+            if(dirtyRoots.empty()) return;
+        }
+
+        for(Object<Transformation>& child: o->children()) objects.push_back(&child);
+    }
+}
+
+template<class Transformation> void Object<Transformation>::cleanAllInternal() {
+    CORRADE_INTERNAL_ASSERT(isScene());
+    std::vector<Object<Transformation>*>& dirtyRoots = static_cast<Scene<Transformation>*>(this)->_dirtyRoots;
+
+    /* Subtrees to clean with parent absolute transformation. If the scene
+       itself is dirty (i.e., it wasn't cleaned yet), everything is dirty and
+       it's enough to clean it from the top. */
+    std::vector<std::pair<Object<Transformation>*, typename Transformation::DataType>> subtrees;
+    if(isDirty()) subtrees.emplace_back(this, typename Transformation::DataType{});
+    else for(Object<Transformation>* const root: dirtyRoots) {
+        /* If any parent is a dirty root, the subtree will be cleaned together
+           with it. Otherwise all parents are clean and the absolute
+           transformation of the parent can be used directly. */
+        Object<Transformation>* parent = root->parent();
+        while(parent && !(parent->flags & Flag::DirtyRoot)) parent = parent->parent();
+        if(!parent) subtrees.emplace_back(root, root->parent()->absoluteTransformation());
+    }
+
+    for(Object<Transformation>* const root: dirtyRoots) root->flags &= ~Flag::DirtyRoot;
+    dirtyRoots.clear();
+
+    /* Go through the subtrees and clean all dirty objects. Objects in the
+       subtree that were cleaned explicitly since it was made dirty are clean
+       already, but their children might not be. */
+    while(!subtrees.empty()) {
+        Object<Transformation>& o = *subtrees.back().first;
+        const typename Transformation::DataType absoluteTransformation =
+            Implementation::Transformation<Transformation>::compose(subtrees.back().second, o.transformation());
+        subtrees.pop_back();
+
+        if(o.isDirty()) {
+            o.setCleanInternal(absoluteTransformation);
+            CORRADE_ASSERT(!o.isDirty(), "SceneGraph::Scene::cleanAll(): original implementation of setClean() was not called", );
+        }
+
+        for(Object<Transformation>& child: o.children())
+            subtrees.emplace_back(&child, absoluteTransformation);
+    }
 }
 
 template<class Transformation> void Object<Transformation>::setClean() {
@@ -179,11 +345,25 @@ template<class Transformation> auto Object<Transformation>::doTransformationMatr
     return transformationMatrices(std::move(castObjects), initialTransformationMatrix);
 }
 
+namespace Implementation {
+
+template<class Transformation, class DataType, class MatrixType> void transformationsToMatrices(const std::vector<DataType>& transformations, std::vector<MatrixType>& matrices) {
+    for(std::size_t i = 0; i != transformations.size(); ++i)
+        matrices[i] = Transformation::toMatrix(transformations[i]);
+}
+
+/* Dual quaternions have a batch conversion that's cheaper than converting
+   them one by one */
+template<class Transformation, class T> void transformationsToMatrices(const std::vector<Math::DualQuaternion<T>>& transformations, std::vector<Math::Matrix4<T>>& matrices) {
+    Math::DualQuaternion<T>::toMatrices({transformations.data(), transformations.size()}, {matrices.data(), matrices.size()});
+}
+
+}
+
 template<class Transformation> auto Object<Transformation>::transformationMatrices(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, const MatrixType& initialTransformationMatrix) const -> std::vector<MatrixType> {
     std::vector<typename Transformation::DataType> transformations = this->transformations(std::move(objects), Implementation::Transformation<Transformation>::fromMatrix(initialTransformationMatrix));
     std::vector<MatrixType> transformationMatrices(transformations.size());
-    for(std::size_t i = 0; i != objects.size(); ++i)
-        transformationMatrices[i] = Implementation::Transformation<Transformation>::toMatrix(transformations[i]);
+    Implementation::transformationsToMatrices<Implementation::Transformation<Transformation>>(transformations, transformationMatrices);
 
     return transformationMatrices;
 }
@@ -297,6 +477,84 @@ template<class Transformation> std::vector<typename Transformation::DataType> Ob
     return jointTransformations;
 }
 
+template<class Transformation> void Object<Transformation>::doTransformationMatricesInto(const Containers::ArrayView<const std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>> objects, const Containers::ArrayView<MatrixType> out, const MatrixType& initialTransformationMatrix) const {
+    CORRADE_ASSERT(out.size() == objects.size(),
+        "SceneGraph::Object::transformationMatricesInto(): expected" << objects.size() << "output matrices but got" << out.size(), );
+    CORRADE_ASSERT(objects.size() < 0xFFFFu, "SceneGraph::Object::transformationMatricesInto(): too large scene", );
+
+    /* Nearest common ancestor not yet implemented - assert this is done on scene */
+    CORRADE_ASSERT(isScene(), "SceneGraph::Object::transformationMatricesInto(): currently implemented only for Scene", );
+    const Scene<Transformation>& scene = static_cast<const Scene<Transformation>&>(*this);
+
+    /* Same algorithm as in transformations(), but with the temporary arrays
+       reused from the previous call */
+    std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects = scene._jointObjects;
+    std::vector<typename Transformation::DataType>& jointTransformations = scene._jointTransformations;
+    jointObjects.clear();
+
+    /* Mark all original objects as joints, multiple occurences of one object
+       share the same counter */
+    for(const std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>& object: objects) {
+        Object<Transformation>& o = static_cast<Object<Transformation>&>(object.get());
+        if(o.counter != 0xFFFFu) continue;
+
+        o.counter = UnsignedShort(jointObjects.size());
+        o.flags |= Flag::Joint;
+        jointObjects.push_back(o);
+    }
+
+    /* Mark all objects up the hierarchy as visited. The walk from each
+       object ends on the first object that was already visited from another
+       one, which then becomes a joint, so each object is visited only
+       once. */
+    const std::size_t objectJointCount = jointObjects.size();
+    for(std::size_t i = 0; i != objectJointCount; ++i) {
+        Object<Transformation>* o = &jointObjects[i].get();
+        for(;;) {
+            o->flags |= Flag::Visited;
+
+            Object<Transformation>* const parent = o->parent();
+
+            /* Root object, done */
+            if(!parent) {
+                CORRADE_ASSERT(o == this, "SceneGraph::Object::transformationMatricesInto(): the objects are not part of the same tree", );
+                break;
+            }
+
+            /* Parent is a joint or already visited, mark it as a joint if it
+               isn't already, done */
+            if(parent->flags & (Flag::Visited|Flag::Joint)) {
+                if(!(parent->flags & Flag::Joint)) {
+                    CORRADE_ASSERT(jointObjects.size() < 0xFFFFu,
+                        "SceneGraph::Object::transformationMatricesInto(): too large scene", );
+                    parent->counter = UnsignedShort(jointObjects.size());
+                    parent->flags |= Flag::Joint;
+                    jointObjects.push_back(*parent);
+                }
+                break;
+            }
+
+            /* Else go up the hierarchy */
+            o = parent;
+        }
+    }
+
+    /* Compute transformations for all joints */
+    const typename Transformation::DataType initialTransformation = Implementation::Transformation<Transformation>::fromMatrix(initialTransformationMatrix);
+    jointTransformations.resize(jointObjects.size());
+    for(std::size_t i = 0; i != jointTransformations.size(); ++i)
+        computeJointTransformation(jointObjects, jointTransformations, i, initialTransformation);
+
+    for(std::size_t i = 0; i != objects.size(); ++i)
+        out[i] = Implementation::Transformation<Transformation>::toMatrix(jointTransformations[static_cast<Object<Transformation>&>(objects[i].get()).counter]);
+
+    /* All visited marks are now cleaned, clean joint marks and counters */
+    for(Object<Transformation>& o: jointObjects) {
+        o.flags &= ~Flag::Joint;
+        o.counter = 0xFFFFu;
+    }
+}
+
 template<class Transformation> typename Transformation::DataType Object<Transformation>::computeJointTransformation(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::size_t joint, const typename Transformation::DataType& initialTransformation) const {
     std::reference_wrapper<Object<Transformation>> o = jointObjects[joint];
 
@@ -382,13 +640,21 @@ template<class Transformation> void Object<Transformation>::setClean(std::vector
     }
 }
 
-template<class Transformation> void Object<Transformation>::setCleanInternal(const typename Transformation::DataType& absoluteTransformation) {
+template<class Transformation> void Object<Transformation>::setCleanInternal(const typename Transformation::DataType& absoluteTransformation, const Implementation::FeatureCleaning cleaning) {
     /* "Lazy storage" for transformation matrix and inverted transformation matrix */
     CachedTransformations cached;
     MatrixType matrix, invertedMatrix;
 
     /* Clean all features */
+    bool skipped = false;
     for(AbstractFeature<Transformation::Dimensions, typename Transformation::Type>& feature: this->features()) {
+        /* Skip features not matching requested thread safety */
+        if((cleaning == Implementation::FeatureCleaning::ThreadSafe && !feature.isCleanThreadSafe()) ||
+           (cleaning == Implementation::FeatureCleaning::NotThreadSafe && feature.isCleanThreadSafe())) {
+            skipped = true;
+            continue;
+        }
+
         /* Cached absolute transformation, compute it if it wasn't
             computed already */
         if(feature.cachedTransformations() & CachedTransformation::Absolute) {
@@ -413,8 +679,10 @@ template<class Transformation> void Object<Transformation>::setCleanInternal(con
         }
     }
 
-    /* Mark object as clean */
-    flags &= ~Flag::Dirty;
+    /* Mark object as clean, unless there are thread-unsafe features left to
+       be cleaned later on the main thread */
+    if(cleaning != Implementation::FeatureCleaning::ThreadSafe || !skipped)
+        flags &= ~Flag::Dirty;
 }
 
 }}
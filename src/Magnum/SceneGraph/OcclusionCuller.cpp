@@ -0,0 +1,222 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "OcclusionCuller.hpp"
+
+#if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+#include <array>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Buffer.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/Renderer.h"
+#include "Magnum/Shader.h"
+#include "Magnum/Version.h"
+#include "Magnum/Math/Matrix4.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+
+namespace {
+
+/* Fragment output is masked out, so the fragment shader doesn't need to write
+   anything */
+constexpr const char* ProxyVertexShader =
+    "#if (defined(GL_ES) && __VERSION__ >= 300) || (!defined(GL_ES) && __VERSION__ >= 130)\n"
+    "#define attribute in\n"
+    "#endif\n"
+    "uniform highp mat4 transformationProjectionMatrix;\n"
+    "attribute highp vec4 position;\n"
+    "void main() {\n"
+    "    gl_Position = transformationProjectionMatrix*position;\n"
+    "}\n";
+constexpr const char* ProxyFragmentShader =
+    "void main() {}\n";
+
+/* Unit cube, vertex i has its X, Y and Z coordinate positive if bit 0, 1 and
+   2 of i is set. Faces are counterclockwise when looked at from outside so
+   the proxy isn't affected by face culling. */
+constexpr std::array<Vector3, 8> ProxyVertices{{
+    {-1.0f, -1.0f, -1.0f},
+    { 1.0f, -1.0f, -1.0f},
+    {-1.0f,  1.0f, -1.0f},
+    { 1.0f,  1.0f, -1.0f},
+    {-1.0f, -1.0f,  1.0f},
+    { 1.0f, -1.0f,  1.0f},
+    {-1.0f,  1.0f,  1.0f},
+    { 1.0f,  1.0f,  1.0f}
+}};
+constexpr std::array<UnsignedByte, 36> ProxyIndices{{
+    4, 6, 2, 4, 2, 0,   /* -X */
+    1, 3, 7, 1, 7, 5,   /* +X */
+    1, 5, 4, 1, 4, 0,   /* -Y */
+    2, 6, 7, 2, 7, 3,   /* +Y */
+    2, 3, 1, 2, 1, 0,   /* -Z */
+    4, 5, 7, 4, 7, 6    /* +Z */
+}};
+
+class ProxyShader: public AbstractShaderProgram {
+    public:
+        typedef Attribute<0, Vector3> Position;
+
+        explicit ProxyShader();
+
+        ProxyShader& setTransformationProjectionMatrix(const Matrix4& matrix) {
+            setUniform(_transformationProjectionMatrixUniform, matrix);
+            return *this;
+        }
+
+    private:
+        Int _transformationProjectionMatrixUniform;
+};
+
+ProxyShader::ProxyShader() {
+    #ifndef MAGNUM_TARGET_GLES
+    const Version version = Context::current().supportedVersion({Version::GL320, Version::GL310, Version::GL300, Version::GL210});
+    #else
+    const Version version = Context::current().supportedVersion({Version::GLES300, Version::GLES200});
+    #endif
+
+    Shader vert{version, Shader::Type::Vertex};
+    Shader frag{version, Shader::Type::Fragment};
+    vert.addSource(ProxyVertexShader);
+    frag.addSource(ProxyFragmentShader);
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({vert, frag}));
+    attachShaders({vert, frag});
+
+    bindAttributeLocation(Position::Location, "position");
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+    _transformationProjectionMatrixUniform = uniformLocation("transformationProjectionMatrix");
+}
+
+}
+
+struct OcclusionProxy::State {
+    explicit State();
+
+    Buffer vertices{Buffer::TargetHint::Array},
+        indices{Buffer::TargetHint::ElementArray};
+    Mesh mesh;
+    ProxyShader shader;
+};
+
+OcclusionProxy::State::State() {
+    vertices.setData(ProxyVertices, BufferUsage::StaticDraw);
+    indices.setData(ProxyIndices, BufferUsage::StaticDraw);
+    mesh.setPrimitive(MeshPrimitive::Triangles)
+        .setCount(ProxyIndices.size())
+        .addVertexBuffer(vertices, 0, ProxyShader::Position{})
+        .setIndexBuffer(indices, 0, Mesh::IndexType::UnsignedByte, 0, ProxyVertices.size() - 1);
+}
+
+OcclusionVisibility::Entry& OcclusionVisibility::entry(const void* const drawable) {
+    auto found = _entries.find(drawable);
+    if(found == _entries.end()) {
+        UnsignedInt query;
+        if(_freeQueries.empty()) query = _queryCount++;
+        else {
+            query = _freeQueries.back();
+            _freeQueries.pop_back();
+        }
+        found = _entries.emplace(drawable, Entry{query, _frame, true, false}).first;
+    }
+
+    found->second.frame = _frame;
+    return found->second;
+}
+
+bool OcclusionVisibility::update(Entry& entry, const bool crossesNearPlane) {
+    if(crossesNearPlane) {
+        entry.visible = true;
+        entry.pending = false;
+        return false;
+    }
+
+    return !entry.pending;
+}
+
+void OcclusionVisibility::recycle() {
+    for(auto it = _entries.begin(); it != _entries.end(); ) {
+        if(it->second.frame != _frame) {
+            _freeQueries.push_back(it->second.query);
+            it = _entries.erase(it);
+        } else ++it;
+    }
+}
+
+OcclusionProxy::OcclusionProxy(): _state{new State} {
+    #ifndef MAGNUM_TARGET_GLES
+    if(Context::current().isExtensionSupported<Extensions::GL::ARB::ES3_compatibility>())
+        _target = SampleQuery::Target::AnySamplesPassedConservative;
+    else if(Context::current().isExtensionSupported<Extensions::GL::ARB::occlusion_query2>())
+        _target = SampleQuery::Target::AnySamplesPassed;
+    else _target = SampleQuery::Target::SamplesPassed;
+    _conditionalRender = Context::current().isExtensionSupported<Extensions::GL::NV::conditional_render>();
+    #else
+    #ifdef MAGNUM_TARGET_GLES2
+    MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::EXT::occlusion_query_boolean);
+    #endif
+    _target = SampleQuery::Target::AnySamplesPassedConservative;
+    _conditionalRender = false;
+    #endif
+}
+
+OcclusionProxy::~OcclusionProxy() = default;
+
+void OcclusionProxy::begin() {
+    Renderer::setColorMask(false, false, false, false);
+    Renderer::setDepthMask(false);
+}
+
+void OcclusionProxy::draw(const Matrix4& transformationProjectionMatrix) {
+    _state->shader.setTransformationProjectionMatrix(transformationProjectionMatrix);
+    _state->mesh.draw(_state->shader);
+}
+
+void OcclusionProxy::end() {
+    Renderer::setColorMask(true, true, true, true);
+    Renderer::setDepthMask(true);
+}
+
+}
+
+/* Instantiated here and not in instantiation.cpp, as the unit test library
+   doesn't link to Magnum. On non-MinGW Windows the instantiation is already
+   marked with extern template. */
+#if !defined(CORRADE_TARGET_WINDOWS) || defined(__MINGW32__)
+template class MAGNUM_SCENEGRAPH_EXPORT BasicOcclusionCuller3D<Float>;
+#else
+template class BasicOcclusionCuller3D<Float>;
+#endif
+
+}}
+#endif
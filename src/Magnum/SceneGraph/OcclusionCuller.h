@@ -0,0 +1,251 @@
+#ifndef Magnum_SceneGraph_OcclusionCuller_h
+#define Magnum_SceneGraph_OcclusionCuller_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::BasicOcclusionCuller3D, typedef @ref Magnum::SceneGraph::OcclusionCuller3D
+ */
+
+#include "Magnum/configure.h"
+
+#if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "Magnum/SampleQuery.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+    /* Query result bookkeeping of the culler, independent of GL. Each
+       drawable gets an entry holding index of its query, which is either
+       recycled from drawables that went out of view or a new one equal to
+       the query count before the call. */
+    class MAGNUM_SCENEGRAPH_EXPORT OcclusionVisibility {
+        public:
+            struct Entry {
+                UnsignedInt query;
+                UnsignedInt frame;
+                bool visible, pending;
+            };
+
+            explicit OcclusionVisibility(): _frame{}, _queryCount{} {}
+
+            std::size_t entryCount() const { return _entries.size(); }
+            std::size_t queryCount() const { return _queryCount; }
+
+            void newFrame() { ++_frame; }
+
+            /* Retrieves entry for given drawable and marks it as used in
+               this frame, new entries are visible */
+            Entry& entry(const void* drawable);
+
+            /* Applies an available query result */
+            static void setResult(Entry& entry, bool visible) {
+                entry.visible = visible;
+                entry.pending = false;
+            }
+
+            /* Proxies crossing the near plane are always considered
+               visible. Returns true if a new query should be issued. */
+            static bool update(Entry& entry, bool crossesNearPlane);
+
+            /* Releases queries of drawables not used in this frame */
+            void recycle();
+
+        private:
+            std::unordered_map<const void*, Entry> _entries;
+            std::vector<UnsignedInt> _freeQueries;
+            UnsignedInt _frame, _queryCount;
+    };
+
+    class MAGNUM_SCENEGRAPH_EXPORT OcclusionProxy {
+        public:
+            explicit OcclusionProxy();
+            ~OcclusionProxy();
+
+            SampleQuery::Target target() const { return _target; }
+            bool isConditionalRenderSupported() const { return _conditionalRender; }
+
+            /* Disables color and depth writes, enables them back in end() */
+            void begin();
+            void draw(const Matrix4& transformationProjectionMatrix);
+            void end();
+
+        private:
+            struct State;
+            std::unique_ptr<State> _state;
+            SampleQuery::Target _target;
+            bool _conditionalRender;
+    };
+}
+
+/**
+@brief Occlusion culler for three-dimensional scenes
+
+Draws a group of drawables, skipping those hidden behind other geometry. Each
+drawable with a bounding volume set using @ref Drawable::setBoundingBox() or
+@ref Drawable::setBoundingSphere() gets a @ref SampleQuery, which counts
+samples of a cheap box proxy rendered with color and depth writes disabled.
+Drawables without bounding volume are always drawn.
+@code
+SceneGraph::OcclusionCuller3D culler;
+
+// each frame
+culler.draw(camera, drawables);
+Debug() << culler.occludedCount() << "drawables occluded";
+@endcode
+
+To avoid stalling the pipeline, query results are never waited for. A result
+is read only after @ref SampleQuery::resultAvailable() reports it's ready,
+which is usually in the next frame, and until then the drawable keeps the
+visibility it had. Each frame is drawn in three passes:
+
+1.  Drawables that were visible according to the latest known result are
+    drawn. These are the occluders for the following passes.
+2.  Box proxies of all drawables that don't have a query in flight are
+    rendered against the depth buffer and their queries are issued.
+3.  Drawables that were occluded according to the latest known result are
+    drawn using conditional rendering with
+    @ref SampleQuery::ConditionalRenderMode::NoWait, so the GPU discards them
+    if their proxy is still occluded. In OpenGL ES and WebGL, where
+    conditional rendering is not available, they are skipped and appear one or
+    two frames later once the query result arrives.
+
+The culler uses @ref Camera::drawableTransformations(), so frustum culling is
+done the same way as in @ref Camera::draw(). Proxies that cross the camera near
+plane would be clipped and report no samples, so drawables close to the camera
+are always drawn. Queries of drawables that are not visible in the current
+frame are recycled, so the number of query objects stays bounded by the number
+of drawables in the view frustum.
+
+The proxy pass changes the color and depth mask, both are set back to enabled
+when it is done. The depth test is expected to be enabled. Drawables are
+expected to write depth so they can occlude each other, thus this is useful
+mainly for opaque geometry.
+
+## Explicit template specializations
+
+The following specialization is explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref OcclusionCuller.hpp implementation file to avoid
+linker errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref OcclusionCuller3D
+
+@see @ref scenegraph, @ref RenderQueue
+@requires_gles30 Extension @es_extension{EXT,occlusion_query_boolean} in
+    OpenGL ES 2.0.
+@requires_webgl20 Queries are not available in WebGL 1.0.
+*/
+template<class T> class BasicOcclusionCuller3D {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * Creates the proxy mesh and shader. Uses
+         * @ref SampleQuery::Target::AnySamplesPassedConservative if
+         * @extension{ARB,ES3_compatibility} (part of OpenGL 4.3) is
+         * available, @ref SampleQuery::Target::AnySamplesPassed if
+         * @extension{ARB,occlusion_query2} (part of OpenGL 3.3) is available
+         * and @ref SampleQuery::Target::SamplesPassed otherwise. In OpenGL ES
+         * and WebGL @ref SampleQuery::Target::AnySamplesPassedConservative is
+         * always used.
+         */
+        explicit BasicOcclusionCuller3D();
+
+        /** @brief Copying is not allowed */
+        BasicOcclusionCuller3D(const BasicOcclusionCuller3D<T>&) = delete;
+
+        /** @brief Copying is not allowed */
+        BasicOcclusionCuller3D<T>& operator=(const BasicOcclusionCuller3D<T>&) = delete;
+
+        ~BasicOcclusionCuller3D();
+
+        /**
+         * @brief Draw group of drawables with occlusion culling
+         *
+         * Calls @ref Drawable::draw() on all visible drawables in the group
+         * which are not known to be occluded. See above for a detailed
+         * description of the passes.
+         */
+        void draw(Camera<3, T>& camera, DrawableGroup<3, T>& group);
+
+        /**
+         * @brief Count of drawables drawn in last @ref draw() call
+         *
+         * Doesn't include drawables removed by frustum culling. Includes
+         * drawables drawn using conditional rendering, which may be discarded
+         * by the GPU.
+         * @see @ref occludedCount()
+         */
+        std::size_t drawCount() const { return _drawCount; }
+
+        /**
+         * @brief Count of occluded drawables in last @ref draw() call
+         *
+         * Drawables that were occluded according to the latest known query
+         * result, including those drawn using conditional rendering.
+         */
+        std::size_t occludedCount() const { return _occludedCount; }
+
+        /**
+         * @brief Count of queries issued in last @ref draw() call
+         *
+         * Equal to count of rendered box proxies.
+         */
+        std::size_t queryCount() const { return _queryCount; }
+
+    private:
+        typedef Implementation::OcclusionVisibility::Entry Entry;
+
+        Implementation::OcclusionProxy _proxy;
+        Implementation::OcclusionVisibility _visibility;
+        std::vector<SampleQuery> _queries;
+        std::vector<std::pair<UnsignedInt, Entry*>> _tested, _occluded;
+        std::size_t _drawCount, _occludedCount, _queryCount;
+};
+
+/**
+@brief Occlusion culler for three-dimensional float scenes
+
+@see @ref BasicOcclusionCuller3D
+*/
+typedef BasicOcclusionCuller3D<Float> OcclusionCuller3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT BasicOcclusionCuller3D<Float>;
+#endif
+
+}}
+#else
+#error this header is not available in WebGL 1.0 build
+#endif
+
+#endif
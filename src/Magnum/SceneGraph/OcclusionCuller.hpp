@@ -0,0 +1,138 @@
+#ifndef Magnum_SceneGraph_OcclusionCuller_hpp
+#define Magnum_SceneGraph_OcclusionCuller_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref OcclusionCuller.h
+ */
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/OcclusionCuller.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+
+/* Whether the box crosses the near plane, in which case its proxy would be
+   clipped and the query result is meaningless */
+template<class T> bool occlusionProxyCrossesNearPlane(const Math::Matrix4<T>& transformationProjectionMatrix) {
+    for(UnsignedInt i = 0; i != 8; ++i) {
+        const Math::Vector4<T> corner = transformationProjectionMatrix*Math::Vector4<T>{
+            i & 1 ? T(1) : T(-1), i & 2 ? T(1) : T(-1), i & 4 ? T(1) : T(-1), T(1)};
+        if(corner.z() < -corner.w()) return true;
+    }
+
+    return false;
+}
+
+}
+
+template<class T> BasicOcclusionCuller3D<T>::BasicOcclusionCuller3D(): _drawCount{}, _occludedCount{}, _queryCount{} {}
+
+template<class T> BasicOcclusionCuller3D<T>::~BasicOcclusionCuller3D() = default;
+
+template<class T> void BasicOcclusionCuller3D<T>::draw(Camera<3, T>& camera, DrawableGroup<3, T>& group) {
+    const std::vector<typename Camera<3, T>::DrawableTransformation>& drawableTransformations = camera.drawableTransformations(group);
+    const Math::Matrix4<T> projectionMatrix = camera.projectionMatrix();
+
+    _visibility.newFrame();
+    _drawCount = _occludedCount = _queryCount = 0;
+    _tested.clear();
+    _occluded.clear();
+
+    /* Draw everything that was visible according to the latest known result,
+       collect drawables for the proxy pass and the occluded pass */
+    for(std::size_t i = 0; i != drawableTransformations.size(); ++i) {
+        Drawable<3, T>& drawable = drawableTransformations[i].first;
+        const Math::Matrix4<T>& transformationMatrix = drawableTransformations[i].second;
+
+        if(drawable.boundingVolume() == BoundingVolume::None) {
+            drawable.draw(transformationMatrix, camera);
+            ++_drawCount;
+            continue;
+        }
+
+        Entry& entry = _visibility.entry(&drawable);
+        if(entry.query == _queries.size()) _queries.emplace_back(_proxy.target());
+        SampleQuery& query = _queries[entry.query];
+
+        /* Update visibility only if the result is there, never wait */
+        if(entry.pending && query.resultAvailable())
+            Implementation::OcclusionVisibility::setResult(entry, query.template result<bool>());
+
+        const Math::Matrix4<T> proxyMatrix = projectionMatrix*transformationMatrix*
+            Math::Matrix4<T>::translation(drawable.boundingCenter())*
+            Math::Matrix4<T>::scaling(drawable.boundingExtent());
+        if(Implementation::OcclusionVisibility::update(entry, Implementation::occlusionProxyCrossesNearPlane(proxyMatrix)))
+            _tested.emplace_back(UnsignedInt(i), &entry);
+
+        if(entry.visible) {
+            drawable.draw(transformationMatrix, camera);
+            ++_drawCount;
+        } else {
+            _occluded.emplace_back(UnsignedInt(i), &entry);
+            ++_occludedCount;
+        }
+    }
+
+    /* Render proxies against depth of the visible drawables */
+    if(!_tested.empty()) {
+        _proxy.begin();
+        for(const std::pair<UnsignedInt, Entry*>& tested: _tested) {
+            const Drawable<3, T>& drawable = drawableTransformations[tested.first].first;
+            SampleQuery& query = _queries[tested.second->query];
+            query.begin();
+            _proxy.draw(Matrix4{projectionMatrix*drawableTransformations[tested.first].second*
+                Math::Matrix4<T>::translation(drawable.boundingCenter())*
+                Math::Matrix4<T>::scaling(drawable.boundingExtent())});
+            query.end();
+            tested.second->pending = true;
+        }
+        _proxy.end();
+        _queryCount = _tested.size();
+    }
+
+    /* Let the GPU decide about the occluded ones, if possible */
+    #ifndef MAGNUM_TARGET_GLES
+    if(_proxy.isConditionalRenderSupported()) for(const std::pair<UnsignedInt, Entry*>& occluded: _occluded) {
+        const typename Camera<3, T>::DrawableTransformation& drawableTransformation = drawableTransformations[occluded.first];
+        SampleQuery& query = _queries[occluded.second->query];
+        query.beginConditionalRender(SampleQuery::ConditionalRenderMode::NoWait);
+        drawableTransformation.first.get().draw(drawableTransformation.second, camera);
+        query.endConditionalRender();
+        ++_drawCount;
+    }
+    #endif
+
+    /* Recycle queries of drawables that are no longer in view. This also
+       removes drawables that were deleted since the previous frame. */
+    _visibility.recycle();
+}
+
+}}
+
+#endif
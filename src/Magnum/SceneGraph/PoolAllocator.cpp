@@ -0,0 +1,101 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "PoolAllocator.h"
+
+#include <cstdint>
+#include <new>
+#include <Corrade/Utility/Assert.h>
+
+namespace Magnum { namespace SceneGraph {
+
+/* Placed before every allocation. When the slot is freed, the memory (and
+   not the header) is used for the free list link. */
+struct PoolAllocator::Header {
+    PoolAllocator* allocator;
+    std::size_t sizeClass;
+};
+
+PoolAllocator::PoolAllocator(const std::size_t chunkSize): _chunkSize{chunkSize}, _allocationCount{} {}
+
+PoolAllocator::~PoolAllocator() {
+    CORRADE_ASSERT(!_allocationCount,
+        "SceneGraph::PoolAllocator: destroyed with" << _allocationCount << "live allocations", );
+
+    for(void* const chunk: _chunks) ::operator delete(chunk);
+}
+
+void* PoolAllocator::allocate(const std::size_t size, const std::size_t alignment) {
+    static_assert(sizeof(Header) <= MaxAlignment, "improper size of PoolAllocator::Header");
+    CORRADE_ASSERT(alignment <= MaxAlignment,
+        "SceneGraph::PoolAllocator::allocate(): alignment" << alignment << "is not supported", nullptr);
+
+    /* Size including the header, rounded up to whole size classes. The slot
+       needs to have space for the free list link. */
+    const std::size_t sizeClass = size ? (size + MaxAlignment - 1)/MaxAlignment : 1;
+    const std::size_t slotSize = (sizeClass + 1)*MaxAlignment;
+    if(_sizeClasses.size() <= sizeClass) _sizeClasses.resize(sizeClass + 1);
+    SizeClass& c = _sizeClasses[sizeClass];
+
+    char* slot;
+
+    /* Reuse a freed slot */
+    if(c.freeList) {
+        slot = static_cast<char*>(c.freeList) - MaxAlignment;
+        c.freeList = *static_cast<void**>(c.freeList);
+
+    /* Take the slot from current chunk, allocate a new one if it's full. The
+       chunk is over-allocated so it can be aligned. */
+    } else {
+        if(std::size_t(c.end - c.current) < slotSize) {
+            const std::size_t chunkSize = slotSize > _chunkSize ? slotSize : _chunkSize;
+            char* const chunk = static_cast<char*>(::operator new(chunkSize + MaxAlignment));
+            _chunks.push_back(chunk);
+            c.current = chunk + (MaxAlignment - reinterpret_cast<std::uintptr_t>(chunk)%MaxAlignment)%MaxAlignment;
+            c.end = c.current + chunkSize;
+        }
+
+        slot = c.current;
+        c.current += slotSize;
+    }
+
+    *reinterpret_cast<Header*>(slot) = Header{this, sizeClass};
+    ++_allocationCount;
+    return slot + MaxAlignment;
+}
+
+void PoolAllocator::deallocate(void* const pointer) {
+    const Header header = *reinterpret_cast<Header*>(static_cast<char*>(pointer) - MaxAlignment);
+    PoolAllocator& allocator = *header.allocator;
+    SizeClass& c = allocator._sizeClasses[header.sizeClass];
+
+    /* Put the slot to the front of the free list */
+    *static_cast<void**>(pointer) = c.freeList;
+    c.freeList = pointer;
+    --allocator._allocationCount;
+}
+
+}}
@@ -0,0 +1,155 @@
+#ifndef Magnum_SceneGraph_PoolAllocator_h
+#define Magnum_SceneGraph_PoolAllocator_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::PoolAllocator
+ */
+
+#include <cstddef>
+#include <vector>
+
+#include "Magnum/SceneGraph/SceneGraph.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Pool allocator for objects and features
+
+Large scenes consisting of many small objects and features suffer from heap
+fragmentation and poor cache locality if every object is allocated separately
+using @cpp new @ce. If a pool allocator is set for a scene using
+@ref Scene::setPoolAllocator(), @ref Object::addChild() and
+@ref AbstractObject::addFeature() allocate the objects and features from it
+instead:
+@code
+SceneGraph::PoolAllocator pool;
+Scene3D scene;
+scene.setPoolAllocator(&pool);
+
+for(std::size_t i = 0; i != 100000; ++i) {
+    Object3D& object = scene.addChild<Object3D>();
+    object.addFeature<MyDrawable>(drawables);
+}
+@endcode
+
+Allocations are grouped by size into 16-byte classes, each size class having
+its own chunks and its own free list, so instances of the same class end up
+next to each other in memory and freed slots are reused by subsequently
+created instances of the same size.
+
+Objects and features allocated from the pool are destroyed along with their
+parent object like heap-allocated ones. They however must not be deleted
+using @cpp delete @ce, use @ref Object::destroy() or
+@ref AbstractFeature::destroy() instead, which work for both pooled and
+heap-allocated instances. The pool has to outlive all objects allocated from
+it --- destroy the scene first.
+@see @ref Object::destroyChildren()
+*/
+class MAGNUM_SCENEGRAPH_EXPORT PoolAllocator {
+    public:
+        /**
+         * @brief Maximal supported alignment
+         *
+         * Types with larger alignment can't be allocated from the pool.
+         */
+        enum: std::size_t { MaxAlignment = 16 };
+
+        /**
+         * @brief Constructor
+         * @param chunkSize     Size of one memory chunk in bytes
+         *
+         * No memory is allocated until the first call to @ref allocate().
+         */
+        explicit PoolAllocator(std::size_t chunkSize = 65536);
+
+        /** @brief Copying is not allowed */
+        PoolAllocator(const PoolAllocator&) = delete;
+
+        /** @brief Moving is not allowed */
+        PoolAllocator(PoolAllocator&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Frees all chunks. Expects that all allocations were freed.
+         */
+        ~PoolAllocator();
+
+        /** @brief Copying is not allowed */
+        PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+        /** @brief Moving is not allowed */
+        PoolAllocator& operator=(PoolAllocator&&) = delete;
+
+        /** @brief Size of one memory chunk in bytes */
+        std::size_t chunkSize() const { return _chunkSize; }
+
+        /** @brief Count of allocated chunks */
+        std::size_t chunkCount() const { return _chunks.size(); }
+
+        /** @brief Count of live allocations */
+        std::size_t allocationCount() const { return _allocationCount; }
+
+        /**
+         * @brief Allocate memory
+         * @param size          Size in bytes
+         * @param alignment     Alignment in bytes
+         *
+         * Takes a free slot of given size class or a new one from the
+         * current chunk of given size class, allocating a new chunk if the
+         * current one is full. Allocations larger than @ref chunkSize() get
+         * a dedicated chunk. Expects that @p alignment is not larger than
+         * @ref MaxAlignment.
+         */
+        void* allocate(std::size_t size, std::size_t alignment = MaxAlignment);
+
+        /**
+         * @brief Free memory
+         *
+         * Expects that @p pointer was returned from @ref allocate() of any
+         * pool allocator that is still alive. The slot is put to a free list
+         * of given size class of the originating allocator.
+         */
+        static void deallocate(void* pointer);
+
+    private:
+        struct Header;
+        struct SizeClass {
+            void* freeList{};
+            char* current{};
+            char* end{};
+        };
+
+        std::size_t _chunkSize, _allocationCount;
+        std::vector<void*> _chunks;
+        std::vector<SizeClass> _sizeClasses;
+};
+
+}}
+
+#endif
@@ -0,0 +1,215 @@
+#ifndef Magnum_SceneGraph_RenderQueue_h
+#define Magnum_SceneGraph_RenderQueue_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::RenderQueue, enum @ref Magnum::SceneGraph::DepthSort, alias @ref Magnum::SceneGraph::BasicRenderQueue2D, @ref Magnum::SceneGraph::BasicRenderQueue3D, typedef @ref Magnum::SceneGraph::RenderQueue2D, @ref Magnum::SceneGraph::RenderQueue3D
+ */
+
+#include <vector>
+
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Depth sorting
+
+@see @ref RenderQueue::setDepthSort()
+*/
+enum class DepthSort: UnsignedByte {
+    /** Depth is not taken into account (default) */
+    None,
+
+    /**
+     * Drawables with the same render state are drawn from the nearest to the
+     * farthest, useful for opaque objects to reduce overdraw.
+     */
+    FrontToBack,
+
+    /**
+     * All drawables are drawn from the farthest to the nearest regardless of
+     * their render state, which is then used only for sorting drawables at
+     * the same depth. Needed for correct rendering of transparent objects.
+     */
+    BackToFront
+};
+
+/**
+@brief Render queue
+
+Draws a group of drawables sorted by their render state to minimize
+shader, render state, texture and mesh changes. Drawables describe the state
+they need using @ref Drawable::setDrawState(), the queue then sorts them by
+shader, @ref RenderState "render state block", textures and mesh, in that
+order, optionally also by depth. See
+@ref SceneGraph-Drawable-sorting "Drawable documentation" for an introduction.
+@code
+SceneGraph::RenderQueue3D queue;
+
+// each frame
+queue.draw(camera, drawables);
+Debug() << queue.savedStateChangeCount() << "state changes saved";
+@endcode
+
+The queue uses @ref Camera::drawableTransformations(), so frustum culling is
+done the same way as in @ref Camera::draw(). Internal storage is reused
+between calls, so no allocation is done unless the group grew since the
+previous call.
+
+In 2D the depth is not known, so @ref DepthSort has no effect there. In 3D, the
+depth is distance of the object origin from the camera along the view
+direction.
+
+## Explicit template specializations
+
+The following specializations are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref RenderQueue.hpp implementation file to avoid
+linker errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref RenderQueue2D
+-   @ref RenderQueue3D
+
+@see @ref scenegraph, @ref BasicRenderQueue2D, @ref BasicRenderQueue3D,
+    @ref RenderQueue2D, @ref RenderQueue3D
+*/
+template<UnsignedInt dimensions, class T> class RenderQueue {
+    public:
+        /**
+         * @brief Constructor
+         * @param depthSort     Depth sorting
+         */
+        explicit RenderQueue(DepthSort depthSort = DepthSort::None);
+
+        /** @brief Depth sorting */
+        DepthSort depthSort() const { return _depthSort; }
+
+        /**
+         * @brief Set depth sorting
+         * @return Reference to self (for method chaining)
+         */
+        RenderQueue<dimensions, T>& setDepthSort(DepthSort depthSort) {
+            _depthSort = depthSort;
+            return *this;
+        }
+
+        /**
+         * @brief Draw sorted group of drawables
+         *
+         * Sorts all visible drawables in the group and calls
+         * @ref Drawable::draw() on them in the sorted order. Drawables with
+         * equal sort keys are drawn in the order they are in the group.
+         */
+        void draw(Camera<dimensions, T>& camera, DrawableGroup<dimensions, T>& group);
+
+        /**
+         * @brief Count of drawables drawn in last @ref draw() call
+         *
+         * Doesn't include drawables removed by frustum culling.
+         */
+        std::size_t drawCount() const { return _items.size(); }
+
+        /**
+         * @brief Count of state changes in last @ref draw() call
+         *
+         * Each change of @ref DrawState::shader,
+         * @ref DrawState::renderState, @ref DrawState::textures or
+         * @ref DrawState::mesh between two consecutive drawables is counted
+         * separately.
+         * @see @ref savedStateChangeCount()
+         */
+        std::size_t stateChangeCount() const { return _stateChangeCount; }
+
+        /**
+         * @brief Count of state changes saved in last @ref draw() call
+         *
+         * Difference between count of state changes if the drawables were
+         * drawn in the order they are in the group and
+         * @ref stateChangeCount(). Can be negative if @ref DepthSort::BackToFront
+         * forced an unfavorable order.
+         */
+        Long savedStateChangeCount() const {
+            return Long(_unsortedStateChangeCount) - Long(_stateChangeCount);
+        }
+
+    private:
+        struct Item {
+            DrawState state;
+            T depth;
+            UnsignedInt index;
+        };
+
+        DepthSort _depthSort;
+        std::size_t _stateChangeCount, _unsortedStateChangeCount;
+        std::vector<Item> _items;
+};
+
+/**
+@brief Render queue for two-dimensional scenes
+
+Convenience alternative to `RenderQueue<2, T>`. See @ref RenderQueue for more
+information.
+@see @ref RenderQueue2D, @ref BasicRenderQueue3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicRenderQueue2D = RenderQueue<2, T>;
+#endif
+
+/**
+@brief Render queue for two-dimensional float scenes
+
+@see @ref RenderQueue3D
+*/
+typedef BasicRenderQueue2D<Float> RenderQueue2D;
+
+/**
+@brief Render queue for three-dimensional scenes
+
+Convenience alternative to `RenderQueue<3, T>`. See @ref RenderQueue for more
+information.
+@see @ref RenderQueue3D, @ref BasicRenderQueue2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicRenderQueue3D = RenderQueue<3, T>;
+#endif
+
+/**
+@brief Render queue for three-dimensional float scenes
+
+@see @ref RenderQueue2D
+*/
+typedef BasicRenderQueue3D<Float> RenderQueue3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT RenderQueue<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT RenderQueue<3, Float>;
+#endif
+
+}}
+
+#endif
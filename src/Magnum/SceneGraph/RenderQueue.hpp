@@ -0,0 +1,105 @@
+#ifndef Magnum_SceneGraph_RenderQueue_hpp
+#define Magnum_SceneGraph_RenderQueue_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref RenderQueue.h
+ */
+
+#include <algorithm>
+
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/RenderQueue.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+
+/* Depth of drawable origin in camera space, 2D has no depth */
+template<UnsignedInt, class> struct RenderQueueDepth;
+template<class T> struct RenderQueueDepth<2, T> {
+    static T depth(const Math::Matrix3<T>&) { return T(0); }
+};
+template<class T> struct RenderQueueDepth<3, T> {
+    static T depth(const Math::Matrix4<T>& transformationMatrix) {
+        return -transformationMatrix.translation().z();
+    }
+};
+
+inline std::size_t stateChangeCount(const DrawState& a, const DrawState& b) {
+    return (a.shader != b.shader ? 1 : 0) +
+           (a.renderState != b.renderState ? 1 : 0) +
+           (a.textures != b.textures ? 1 : 0) +
+           (a.mesh != b.mesh ? 1 : 0);
+}
+
+}
+
+template<UnsignedInt dimensions, class T> RenderQueue<dimensions, T>::RenderQueue(const DepthSort depthSort): _depthSort{depthSort}, _stateChangeCount{}, _unsortedStateChangeCount{} {}
+
+template<UnsignedInt dimensions, class T> void RenderQueue<dimensions, T>::draw(Camera<dimensions, T>& camera, DrawableGroup<dimensions, T>& group) {
+    const std::vector<typename Camera<dimensions, T>::DrawableTransformation>& drawableTransformations = camera.drawableTransformations(group);
+
+    /* Gather sort keys, count state changes in the original order */
+    _items.clear();
+    _items.reserve(drawableTransformations.size());
+    _unsortedStateChangeCount = 0;
+    for(std::size_t i = 0; i != drawableTransformations.size(); ++i) {
+        const DrawState state = drawableTransformations[i].first.get().drawState();
+        if(i) _unsortedStateChangeCount += Implementation::stateChangeCount(_items.back().state, state);
+        _items.push_back({state, Implementation::RenderQueueDepth<dimensions, T>::depth(drawableTransformations[i].second), UnsignedInt(i)});
+    }
+
+    /* Sort by state, then by depth if requested. Back-to-front sorting has
+       depth as the primary key, otherwise the result wouldn't be correct.
+       Original index is the last key to make the sort stable. */
+    const DepthSort depthSort = _depthSort;
+    std::sort(_items.begin(), _items.end(), [depthSort](const Item& a, const Item& b) {
+        if(depthSort == DepthSort::BackToFront && a.depth != b.depth)
+            return a.depth > b.depth;
+        if(a.state.shader != b.state.shader) return a.state.shader < b.state.shader;
+        if(a.state.renderState != b.state.renderState) return a.state.renderState < b.state.renderState;
+        if(a.state.textures != b.state.textures) return a.state.textures < b.state.textures;
+        if(a.state.mesh != b.state.mesh) return a.state.mesh < b.state.mesh;
+        if(depthSort == DepthSort::FrontToBack && a.depth != b.depth)
+            return a.depth < b.depth;
+        return a.index < b.index;
+    });
+
+    /* Draw in the sorted order */
+    _stateChangeCount = 0;
+    for(std::size_t i = 0; i != _items.size(); ++i) {
+        if(i) _stateChangeCount += Implementation::stateChangeCount(_items[i - 1].state, _items[i].state);
+        const typename Camera<dimensions, T>::DrawableTransformation& drawableTransformation = drawableTransformations[_items[i].index];
+        drawableTransformation.first.get().draw(drawableTransformation.second, camera);
+    }
+}
+
+}}
+
+#endif
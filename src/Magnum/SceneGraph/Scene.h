@@ -29,6 +29,8 @@
  * @brief Class @ref Magnum::SceneGraph::Scene
  */
 
+#include <vector>
+
 #include "Magnum/SceneGraph/Object.h"
 
 namespace Magnum { namespace SceneGraph {
@@ -40,11 +42,82 @@ Basically @ref Object which cannot have parent or non-default transformation.
 See @ref scenegraph for introduction.
 */
 template<class Transformation> class Scene: public Object<Transformation> {
+    friend Object<Transformation>;
+
     public:
-        explicit Scene() = default;
+        explicit Scene(): _poolAllocator{}, _hierarchyGeneration{0} {}
+
+        /**
+         * @brief Pool allocator
+         *
+         * @see @ref setPoolAllocator()
+         */
+        PoolAllocator* poolAllocator() const { return _poolAllocator; }
+
+        /**
+         * @brief Set pool allocator
+         * @return Reference to self (for method chaining)
+         *
+         * Objects and features subsequently created in this scene using
+         * @ref Object::addChild() and @ref AbstractObject::addFeature() are
+         * allocated from given pool. Already existing objects are not
+         * affected. The allocator has to outlive all objects allocated from
+         * it. Pass @cpp nullptr @ce to use the heap again. See
+         * @ref PoolAllocator for more information.
+         */
+        Scene<Transformation>& setPoolAllocator(PoolAllocator* allocator) {
+            _poolAllocator = allocator;
+            return *this;
+        }
+
+        /**
+         * @brief Hierarchy generation
+         *
+         * Incremented every time an object is added to or removed from the
+         * scene hierarchy. Useful for detecting whether data derived from
+         * the hierarchy, such as @ref FlatTransformationCache, need to be
+         * rebuilt.
+         */
+        UnsignedInt hierarchyGeneration() const { return _hierarchyGeneration; }
+
+        /**
+         * @brief Count of dirty subtree roots
+         *
+         * Count of objects made dirty since the last @ref cleanAll() call
+         * whose parent was clean at that time. Objects made dirty as a part
+         * of already dirty subtree are not counted.
+         * @see @ref Object::setDirty()
+         */
+        std::size_t dirtyRootCount() const { return _dirtyRoots.size(); }
+
+        /**
+         * @brief Clean all dirty objects in the scene
+         *
+         * The scene keeps track of roots of subtrees that were made dirty
+         * using @ref Object::setDirty() or by hierarchy changes. Unlike
+         * @ref Object::setClean(std::vector<std::reference_wrapper<Object<Transformation>>>),
+         * which needs to be given an explicit list of objects, this function
+         * cleans all dirty objects in the scene while visiting only the
+         * subtrees that were actually changed since the last call, computing
+         * absolute transformation of each object in them only once. Call it
+         * once per frame before drawing.
+         *
+         * On the first call, when the scene itself is dirty, all objects are
+         * visited.
+         * @see @ref dirtyRootCount(), @ref scenegraph-features-caching
+         */
+        void cleanAll() { Object<Transformation>::cleanAllInternal(); }
 
     private:
         bool isScene() const override final { return true; }
+
+        PoolAllocator* _poolAllocator;
+        UnsignedInt _hierarchyGeneration;
+        std::vector<Object<Transformation>*> _dirtyRoots;
+
+        /* Scratch storage for Object::transformationMatricesInto() */
+        mutable std::vector<std::reference_wrapper<Object<Transformation>>> _jointObjects;
+        mutable std::vector<typename Transformation::DataType> _jointTransformations;
 };
 
 }}
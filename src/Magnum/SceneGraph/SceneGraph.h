@@ -62,6 +62,8 @@ template<class T> using AbstractBasicObject3D = AbstractObject<3, T>;
 typedef AbstractBasicObject2D<Float> AbstractObject2D;
 typedef AbstractBasicObject3D<Float> AbstractObject3D;
 
+class AbstractTaskExecutor;
+
 template<UnsignedInt, class> class AbstractTransformation;
 template<class T> using AbstractBasicTransformation2D = AbstractTransformation<2, T>;
 template<class T> using AbstractBasicTransformation3D = AbstractTransformation<3, T>;
@@ -98,6 +100,18 @@ template<class T> using BasicAnimableGroup3D = AnimableGroup<3, T>;
 typedef BasicAnimableGroup2D<Float> AnimableGroup2D;
 typedef BasicAnimableGroup3D<Float> AnimableGroup3D;
 
+template<UnsignedInt, class> class Interpolable;
+template<class T> using BasicInterpolable2D = Interpolable<2, T>;
+template<class T> using BasicInterpolable3D = Interpolable<3, T>;
+typedef BasicInterpolable2D<Float> Interpolable2D;
+typedef BasicInterpolable3D<Float> Interpolable3D;
+
+template<UnsignedInt, class> class InterpolableGroup;
+template<class T> using BasicInterpolableGroup2D = InterpolableGroup<2, T>;
+template<class T> using BasicInterpolableGroup3D = InterpolableGroup<3, T>;
+typedef BasicInterpolableGroup2D<Float> InterpolableGroup2D;
+typedef BasicInterpolableGroup3D<Float> InterpolableGroup3D;
+
 template<UnsignedInt, class> class Camera;
 template<class T> using BasicCamera2D = Camera<2, T>;
 template<class T> using BasicCamera3D = Camera<3, T>;
@@ -112,12 +126,24 @@ template<class T> using AbstractBasicCamera3D CORRADE_DEPRECATED_ALIAS("use Basi
 CORRADE_DEPRECATED("use Camera3D instead") typedef Camera3D AbstractCamera3D;
 #endif
 
+enum class BoundingVolume: UnsignedByte;
+
+template<class> class BasicDepthPrepass3D;
+typedef BasicDepthPrepass3D<Float> DepthPrepass3D;
+struct DrawState;
+
 template<UnsignedInt, class> class Drawable;
 template<class T> using BasicDrawable2D = Drawable<2, T>;
 template<class T> using BasicDrawable3D = Drawable<3, T>;
 typedef BasicDrawable2D<Float> Drawable2D;
 typedef BasicDrawable3D<Float> Drawable3D;
 
+template<UnsignedInt, class> struct DrawableMatrices;
+template<class T> using BasicDrawableMatrices2D = DrawableMatrices<2, T>;
+template<class T> using BasicDrawableMatrices3D = DrawableMatrices<3, T>;
+typedef BasicDrawableMatrices2D<Float> DrawableMatrices2D;
+typedef BasicDrawableMatrices3D<Float> DrawableMatrices3D;
+
 template<class> class BasicDualComplexTransformation;
 template<class> class BasicDualQuaternionTransformation;
 typedef BasicDualComplexTransformation<Float> DualComplexTransformation;
@@ -135,6 +161,35 @@ template<class T> using BasicDrawableGroup3D = DrawableGroup<3, T>;
 typedef BasicDrawableGroup2D<Float> DrawableGroup2D;
 typedef BasicDrawableGroup3D<Float> DrawableGroup3D;
 
+template<class Transformation> class FlatTransformationCache;
+
+template<class> class BasicHiZCuller3D;
+typedef BasicHiZCuller3D<Float> HiZCuller3D;
+
+template<UnsignedInt, class> class InstanceCollector;
+template<UnsignedInt, class> struct HlodCluster;
+template<class T> using BasicHlodCluster2D = HlodCluster<2, T>;
+template<class T> using BasicHlodCluster3D = HlodCluster<3, T>;
+typedef BasicHlodCluster2D<Float> HlodCluster2D;
+typedef BasicHlodCluster3D<Float> HlodCluster3D;
+
+template<UnsignedInt, class> class HlodDrawable;
+template<class T> using BasicHlodDrawable2D = HlodDrawable<2, T>;
+template<class T> using BasicHlodDrawable3D = HlodDrawable<3, T>;
+typedef BasicHlodDrawable2D<Float> HlodDrawable2D;
+typedef BasicHlodDrawable3D<Float> HlodDrawable3D;
+
+template<class T> using BasicInstanceCollector2D = InstanceCollector<2, T>;
+template<class T> using BasicInstanceCollector3D = InstanceCollector<3, T>;
+typedef BasicInstanceCollector2D<Float> InstanceCollector2D;
+typedef BasicInstanceCollector3D<Float> InstanceCollector3D;
+
+template<UnsignedInt, class> class LodDrawable;
+template<class T> using BasicLodDrawable2D = LodDrawable<2, T>;
+template<class T> using BasicLodDrawable3D = LodDrawable<3, T>;
+typedef BasicLodDrawable2D<Float> LodDrawable2D;
+typedef BasicLodDrawable3D<Float> LodDrawable3D;
+
 template<class> class BasicMatrixTransformation2D;
 template<class> class BasicMatrixTransformation3D;
 typedef BasicMatrixTransformation2D<Float> MatrixTransformation2D;
@@ -142,6 +197,19 @@ typedef BasicMatrixTransformation3D<Float> MatrixTransformation3D;
 
 template<class Transformation> class Object;
 
+template<class> class BasicOcclusionCuller3D;
+typedef BasicOcclusionCuller3D<Float> OcclusionCuller3D;
+
+class PoolAllocator;
+
+enum class DepthSort: UnsignedByte;
+
+template<UnsignedInt, class> class RenderQueue;
+template<class T> using BasicRenderQueue2D = RenderQueue<2, T>;
+template<class T> using BasicRenderQueue3D = RenderQueue<3, T>;
+typedef BasicRenderQueue2D<Float> RenderQueue2D;
+typedef BasicRenderQueue3D<Float> RenderQueue3D;
+
 template<class> class BasicRigidMatrixTransformation2D;
 template<class> class BasicRigidMatrixTransformation3D;
 typedef BasicRigidMatrixTransformation2D<Float> RigidMatrixTransformation2D;
@@ -149,6 +217,31 @@ typedef BasicRigidMatrixTransformation3D<Float> RigidMatrixTransformation3D;
 
 template<class Transformation> class Scene;
 
+template<class> class BasicSpatial3D;
+template<class> class BasicSpatialIndex3D;
+typedef BasicSpatial3D<Float> Spatial3D;
+typedef BasicSpatialIndex3D<Float> SpatialIndex3D;
+
+template<class> class BasicSprite2D;
+template<class> class BasicSpriteBatch2D;
+template<class T> using BasicSpriteGroup2D = FeatureGroup<2, BasicSprite2D<T>, T>;
+typedef BasicSprite2D<Float> Sprite2D;
+typedef BasicSpriteBatch2D<Float> SpriteBatch2D;
+typedef BasicSpriteGroup2D<Float> SpriteGroup2D;
+
+template<UnsignedInt, class> struct StaticBatch;
+template<class T> using BasicStaticBatch2D = StaticBatch<2, T>;
+template<class T> using BasicStaticBatch3D = StaticBatch<3, T>;
+typedef BasicStaticBatch2D<Float> StaticBatch2D;
+typedef BasicStaticBatch3D<Float> StaticBatch3D;
+
+#if !defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(CORRADE_TARGET_NACL)
+class TaskSchedulerExecutor;
+#endif
+
+enum class TrackInterpolation: UnsignedByte;
+template<class Transformation> class TrackAnimator;
+
 template<UnsignedInt, class T, class = T> class TranslationTransformation;
 template<class T, class TranslationType = T> using BasicTranslationTransformation2D = TranslationTransformation<2, T, TranslationType>;
 template<class T, class TranslationType = T> using BasicTranslationTransformation3D = TranslationTransformation<3, T, TranslationType>;
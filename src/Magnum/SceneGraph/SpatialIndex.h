@@ -0,0 +1,330 @@
+#ifndef Magnum_SceneGraph_SpatialIndex_h
+#define Magnum_SceneGraph_SpatialIndex_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::BasicSpatial3D, @ref Magnum::SceneGraph::BasicSpatialIndex3D, typedef @ref Magnum::SceneGraph::Spatial3D, @ref Magnum::SceneGraph::SpatialIndex3D
+ */
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "Magnum/Math/BitArray.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/SceneGraph/AbstractGroupedFeature.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Spatially indexed feature for three-dimensional scenes
+
+Bounding sphere of an object, kept in a @ref BasicSpatialIndex3D "SpatialIndex3D"
+and updated automatically when the object transformation changes. See
+@ref BasicSpatialIndex3D for more information.
+
+@section SceneGraph-Spatial3D-explicit-specializations Explicit template specializations
+
+The following specialization is explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref SpatialIndex.hpp implementation file to avoid
+linker errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref Spatial3D
+
+@see @ref scenegraph, @ref Spatial3D
+*/
+template<class T> class BasicSpatial3D: public AbstractBasicGroupedFeature3D<BasicSpatial3D<T>, T> {
+    friend BasicSpatialIndex3D<T>;
+
+    public:
+        /**
+         * @brief Constructor
+         * @param object    Object this feature belongs to
+         * @param index     Spatial index this feature belongs to
+         *
+         * The bounding sphere is initially a point at object origin.
+         */
+        explicit BasicSpatial3D(AbstractBasicObject3D<T>& object, BasicSpatialIndex3D<T>* index = nullptr);
+
+        /**
+         * @brief Destructor
+         *
+         * Removes the feature from the index.
+         */
+        ~BasicSpatial3D();
+
+        /**
+         * @brief Index containing this feature
+         *
+         * If the feature doesn't belong to any index, returns `nullptr`.
+         */
+        BasicSpatialIndex3D<T>* index();
+
+        /** @overload */
+        const BasicSpatialIndex3D<T>* index() const;
+
+        /** @brief Bounding sphere center relative to the object */
+        Math::Vector3<T> boundingCenter() const { return _center; }
+
+        /** @brief Bounding sphere radius relative to the object */
+        T boundingRadius() const { return _radius; }
+
+        /**
+         * @brief Set bounding sphere
+         * @param center    Sphere center relative to the object
+         * @param radius    Sphere radius
+         * @return Reference to self (for method chaining)
+         *
+         * The index is updated on next @ref BasicSpatialIndex3D::update() "SpatialIndex3D::update()".
+         */
+        BasicSpatial3D<T>& setBoundingSphere(const Math::Vector3<T>& center, T radius);
+
+        /**
+         * @brief Absolute bounding sphere center
+         *
+         * As of the last index update.
+         */
+        Math::Vector3<T> absoluteCenter() const { return _absoluteCenter; }
+
+        /**
+         * @brief Absolute bounding sphere radius
+         *
+         * Radius scaled by the largest scaling factor of absolute object
+         * transformation, as of the last index update.
+         */
+        T absoluteRadius() const { return _absoluteRadius; }
+
+    private:
+        void markDirty() override;
+        void clean(const Math::Matrix4<T>& absoluteTransformationMatrix) override;
+
+        void schedule();
+
+        Math::Vector3<T> _center;
+        T _radius;
+        Math::Vector3<T> _absoluteCenter;
+        T _absoluteRadius;
+
+        UnsignedLong _cell;
+        std::size_t _cellIndex, _pendingIndex;
+        bool _inGrid, _pending;
+};
+
+/**
+@brief Spatial index for three-dimensional scenes
+
+Accelerates queries like "all objects in this box" or "all objects visible
+from this camera", which would otherwise require testing every feature of a
+@ref FeatureGroup. Objects are indexed through a @ref BasicSpatial3D "Spatial3D"
+feature holding their bounding sphere:
+@code
+SceneGraph::SpatialIndex3D index{10.0f};
+
+Object3D* object = new Object3D{&scene};
+(new SceneGraph::Spatial3D{*object, &index})->setBoundingSphere({}, 1.5f);
+@endcode
+
+The index is a loose hashed grid --- every sphere is stored in the grid cell
+containing its center, only cells that contain something are allocated and
+cells are tested as if they were enlarged by @ref cellSize() on each side.
+Spheres larger than the cell size are kept in a separate list and tested for
+every query. Choose the cell size to be around the size of typical objects.
+
+The index is updated incrementally. When a transformation of an indexed
+object changes, the feature gets a dirty notification and is scheduled for
+update. @ref update(), called implicitly by all queries, cleans the
+scheduled objects and moves their spheres to new cells, not touching the
+rest of the index.
+
+@section SceneGraph-SpatialIndex3D-queries Queries
+
+Query results are written into an output vector, which is cleared first, so
+its storage can be reused across frames:
+@code
+std::vector<std::reference_wrapper<SceneGraph::Spatial3D>> result;
+
+// everything within 5 units of the player
+index.querySphere(player.absoluteTransformation().translation(), 5.0f, result);
+
+// everything in the selection box
+index.queryBox(selection, result);
+@endcode
+
+@ref queryFrustum() returns features intersecting camera frustum, entire
+cells outside of the frustum are skipped at once. @ref drawableMask() can
+be used for culling the drawables directly, its output is meant to be passed
+to @ref Camera::draw(DrawableGroup<dimensions, T>&, const Math::BitArray&):
+@code
+camera.draw(drawables, index.drawableMask(camera, drawables));
+@endcode
+
+Similarly, @ref querySphere() around the listener position can be used to
+pick a subset of @ref Audio::Playable "Audio::Playable" features for
+prioritizing the available voices.
+
+@section SceneGraph-SpatialIndex3D-explicit-specializations Explicit template specializations
+
+The following specialization is explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref SpatialIndex.hpp implementation file to avoid
+linker errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref SpatialIndex3D
+
+@see @ref scenegraph, @ref SpatialIndex3D
+*/
+template<class T> class BasicSpatialIndex3D: public FeatureGroup<3, BasicSpatial3D<T>, T> {
+    friend BasicSpatial3D<T>;
+
+    public:
+        /**
+         * @brief Constructor
+         * @param cellSize      Size of grid cell
+         *
+         * Expects that the cell size is positive.
+         */
+        explicit BasicSpatialIndex3D(T cellSize);
+
+        ~BasicSpatialIndex3D();
+
+        /** @brief Size of grid cell */
+        T cellSize() const { return _cellSize; }
+
+        /**
+         * @brief Count of non-empty grid cells
+         *
+         * As of the last @ref update().
+         */
+        std::size_t cellCount() const { return _cells.size(); }
+
+        /**
+         * @brief Count of features larger than grid cell
+         *
+         * As of the last @ref update(). These are tested in every query.
+         */
+        std::size_t oversizedCount() const { return _oversized.size(); }
+
+        /**
+         * @brief Add feature to the index
+         * @return Reference to self (for method chaining)
+         *
+         * If the feature is part of another index, it is removed from it. The
+         * feature is put into the grid on next @ref update().
+         * @see @ref FeatureGroup::add()
+         */
+        BasicSpatialIndex3D<T>& add(BasicSpatial3D<T>& feature);
+
+        /**
+         * @brief Remove feature from the index
+         * @return Reference to self (for method chaining)
+         *
+         * The feature must be part of the index.
+         * @see @ref FeatureGroup::remove()
+         */
+        BasicSpatialIndex3D<T>& remove(BasicSpatial3D<T>& feature);
+
+        /**
+         * @brief Update the index
+         *
+         * Cleans objects of all features that were changed since last update
+         * and moves them to new grid cells. Called implicitly by all
+         * queries.
+         */
+        void update();
+
+        /**
+         * @brief Query features intersecting a box
+         * @param box       Axis-aligned box in absolute coordinates
+         * @param[out] out  Output features
+         */
+        void queryBox(const Math::Range3D<T>& box, std::vector<std::reference_wrapper<BasicSpatial3D<T>>>& out);
+
+        /**
+         * @brief Query features intersecting a sphere
+         * @param center    Sphere center in absolute coordinates
+         * @param radius    Sphere radius
+         * @param[out] out  Output features
+         */
+        void querySphere(const Math::Vector3<T>& center, T radius, std::vector<std::reference_wrapper<BasicSpatial3D<T>>>& out);
+
+        /**
+         * @brief Query features intersecting a frustum
+         * @param projectionMatrix  Projection matrix multiplied with camera
+         *      matrix, i.e. transformation from absolute coordinates to clip
+         *      space
+         * @param[out] out          Output features
+         *
+         * The frustum planes are extracted from the matrix.
+         */
+        void queryFrustum(const Math::Matrix4<T>& projectionMatrix, std::vector<std::reference_wrapper<BasicSpatial3D<T>>>& out);
+
+        /**
+         * @brief Mask of drawables potentially visible from given camera
+         *
+         * Queries features intersecting the camera frustum and sets bits of
+         * all drawables from @p drawables attached to the same objects as the
+         * found features. Drawables on objects that aren't in the index are
+         * not included. The camera is expected to be part of a scene.
+         * @see @ref Camera::draw(DrawableGroup<dimensions, T>&, const Math::BitArray&)
+         */
+        Math::BitArray drawableMask(Camera<3, T>& camera, DrawableGroup<3, T>& drawables);
+
+    private:
+        void insert(BasicSpatial3D<T>& feature);
+        void erase(BasicSpatial3D<T>& feature);
+        void unschedule(BasicSpatial3D<T>& feature);
+        void queryCells(const Math::Range3D<T>& box, std::vector<std::reference_wrapper<BasicSpatial3D<T>>>& out);
+
+        T _cellSize;
+        std::unordered_map<UnsignedLong, std::vector<BasicSpatial3D<T>*>> _cells;
+        std::vector<BasicSpatial3D<T>*> _oversized, _pending;
+        std::vector<std::reference_wrapper<BasicSpatial3D<T>>> _scratch;
+};
+
+/**
+@brief Spatially indexed feature for three-dimensional float scenes
+
+@see @ref SpatialIndex3D
+*/
+typedef BasicSpatial3D<Float> Spatial3D;
+
+/**
+@brief Spatial index for three-dimensional float scenes
+
+@see @ref Spatial3D
+*/
+typedef BasicSpatialIndex3D<Float> SpatialIndex3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT BasicSpatial3D<Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT BasicSpatialIndex3D<Float>;
+#endif
+
+}}
+
+#endif
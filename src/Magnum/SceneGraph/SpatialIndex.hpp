@@ -0,0 +1,335 @@
+#ifndef Magnum_SceneGraph_SpatialIndex_hpp
+#define Magnum_SceneGraph_SpatialIndex_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref SpatialIndex.h
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Geometry/Intersection.h"
+#include "Magnum/SceneGraph/AbstractObject.h"
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/FeatureGroup.hpp"
+#include "Magnum/SceneGraph/SpatialIndex.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+
+/* Cell coordinates are packed into 21 bits per axis, offset so negative
+   coordinates fit too. Coordinates outside of the range wrap around, which
+   only makes the cells shared, the queries still test every feature. */
+constexpr Int SpatialIndexCellBits = 21;
+constexpr Int SpatialIndexCellOffset = 1 << (SpatialIndexCellBits - 1);
+constexpr UnsignedLong SpatialIndexCellMask = (1ull << SpatialIndexCellBits) - 1;
+
+inline UnsignedLong spatialIndexCellKey(const Vector3i& cell) {
+    return (UnsignedLong(cell.x() + SpatialIndexCellOffset) & SpatialIndexCellMask) |
+          ((UnsignedLong(cell.y() + SpatialIndexCellOffset) & SpatialIndexCellMask) << SpatialIndexCellBits) |
+          ((UnsignedLong(cell.z() + SpatialIndexCellOffset) & SpatialIndexCellMask) << 2*SpatialIndexCellBits);
+}
+
+inline Vector3i spatialIndexCell(const UnsignedLong key) {
+    return {Int(key & SpatialIndexCellMask) - SpatialIndexCellOffset,
+            Int((key >> SpatialIndexCellBits) & SpatialIndexCellMask) - SpatialIndexCellOffset,
+            Int((key >> 2*SpatialIndexCellBits) & SpatialIndexCellMask) - SpatialIndexCellOffset};
+}
+
+template<class T> Vector3i spatialIndexCellFor(const Math::Vector3<T>& point, const T cellSize) {
+    return Vector3i{Math::floor(point/cellSize)};
+}
+
+template<class T> bool sphereRange(const Math::Vector3<T>& center, const T radius, const Math::Range3D<T>& range) {
+    /* Distance of the center from the box */
+    const Math::Vector3<T> distance = Math::max(Math::max(range.min() - center, center - range.max()), Math::Vector3<T>{T(0)});
+    return distance.dot() <= radius*radius;
+}
+
+}
+
+template<class T> BasicSpatial3D<T>::BasicSpatial3D(AbstractBasicObject3D<T>& object, BasicSpatialIndex3D<T>* const index): AbstractBasicGroupedFeature3D<BasicSpatial3D<T>, T>{object}, _radius{}, _absoluteRadius{}, _cell{}, _cellIndex{}, _pendingIndex{}, _inGrid{}, _pending{} {
+    AbstractFeature<3, T>::setCachedTransformations(CachedTransformation::Absolute);
+
+    /* Not passing the index to the base constructor, as it would bypass the
+       grid bookkeeping in BasicSpatialIndex3D::add() */
+    if(index) index->add(*this);
+}
+
+template<class T> BasicSpatial3D<T>::~BasicSpatial3D() {
+    if(BasicSpatialIndex3D<T>* i = index()) i->remove(*this);
+}
+
+template<class T> BasicSpatialIndex3D<T>* BasicSpatial3D<T>::index() {
+    return static_cast<BasicSpatialIndex3D<T>*>(this->group());
+}
+
+template<class T> const BasicSpatialIndex3D<T>* BasicSpatial3D<T>::index() const {
+    return static_cast<const BasicSpatialIndex3D<T>*>(this->group());
+}
+
+template<class T> BasicSpatial3D<T>& BasicSpatial3D<T>::setBoundingSphere(const Math::Vector3<T>& center, const T radius) {
+    _center = center;
+    _radius = radius;
+    schedule();
+    return *this;
+}
+
+template<class T> void BasicSpatial3D<T>::markDirty() {
+    schedule();
+}
+
+template<class T> void BasicSpatial3D<T>::schedule() {
+    BasicSpatialIndex3D<T>* const i = index();
+    if(!i || _pending) return;
+
+    _pending = true;
+    _pendingIndex = i->_pending.size();
+    i->_pending.push_back(this);
+}
+
+template<class T> void BasicSpatial3D<T>::clean(const Math::Matrix4<T>& absoluteTransformationMatrix) {
+    /* Take the feature out of its current cell while the absolute sphere
+       still corresponds to it */
+    BasicSpatialIndex3D<T>* const i = index();
+    if(i) {
+        i->unschedule(*this);
+        i->erase(*this);
+    }
+
+    /* Radius is scaled by the largest scaling factor */
+    const Math::Matrix3x3<T> rotationScaling = absoluteTransformationMatrix.rotationScaling();
+    _absoluteCenter = absoluteTransformationMatrix.transformPoint(_center);
+    _absoluteRadius = _radius*std::sqrt(std::max({rotationScaling[0].dot(), rotationScaling[1].dot(), rotationScaling[2].dot()}));
+
+    if(i) i->insert(*this);
+}
+
+template<class T> BasicSpatialIndex3D<T>::BasicSpatialIndex3D(const T cellSize): _cellSize{cellSize} {
+    CORRADE_ASSERT(cellSize > T(0), "SceneGraph::SpatialIndex3D: expected positive cell size, got" << cellSize, );
+}
+
+template<class T> BasicSpatialIndex3D<T>::~BasicSpatialIndex3D() = default;
+
+template<class T> BasicSpatialIndex3D<T>& BasicSpatialIndex3D<T>::add(BasicSpatial3D<T>& feature) {
+    /* Remove from the previous index first so its grid stays consistent */
+    if(BasicSpatialIndex3D<T>* const previous = feature.index()) {
+        if(previous == this) return *this;
+        previous->remove(feature);
+    }
+
+    FeatureGroup<3, BasicSpatial3D<T>, T>::add(feature);
+    feature.schedule();
+    return *this;
+}
+
+template<class T> BasicSpatialIndex3D<T>& BasicSpatialIndex3D<T>::remove(BasicSpatial3D<T>& feature) {
+    CORRADE_ASSERT(feature.index() == this,
+        "SceneGraph::SpatialIndex3D::remove(): feature is not part of this index", *this);
+
+    unschedule(feature);
+    erase(feature);
+    FeatureGroup<3, BasicSpatial3D<T>, T>::remove(feature);
+    return *this;
+}
+
+template<class T> void BasicSpatialIndex3D<T>::unschedule(BasicSpatial3D<T>& feature) {
+    if(!feature._pending) return;
+
+    _pending[feature._pendingIndex] = _pending.back();
+    _pending[feature._pendingIndex]->_pendingIndex = feature._pendingIndex;
+    _pending.pop_back();
+    feature._pending = false;
+}
+
+template<class T> void BasicSpatialIndex3D<T>::insert(BasicSpatial3D<T>& feature) {
+    std::vector<BasicSpatial3D<T>*>* list;
+    if(feature._absoluteRadius > _cellSize) {
+        list = &_oversized;
+    } else {
+        feature._cell = Implementation::spatialIndexCellKey(Implementation::spatialIndexCellFor(feature._absoluteCenter, _cellSize));
+        list = &_cells[feature._cell];
+    }
+
+    feature._inGrid = true;
+    feature._cellIndex = list->size();
+    list->push_back(&feature);
+}
+
+template<class T> void BasicSpatialIndex3D<T>::erase(BasicSpatial3D<T>& feature) {
+    if(!feature._inGrid) return;
+
+    /* Find the list the feature was put into. Neither the radius nor the
+       center changed since insert(), so this gives the same list. */
+    std::vector<BasicSpatial3D<T>*>* list;
+    typename std::unordered_map<UnsignedLong, std::vector<BasicSpatial3D<T>*>>::iterator found;
+    const bool oversized = feature._absoluteRadius > _cellSize;
+    if(oversized) list = &_oversized;
+    else {
+        found = _cells.find(feature._cell);
+        CORRADE_INTERNAL_ASSERT(found != _cells.end());
+        list = &found->second;
+    }
+
+    /* Move the last feature to the place of the removed one */
+    (*list)[feature._cellIndex] = list->back();
+    (*list)[feature._cellIndex]->_cellIndex = feature._cellIndex;
+    list->pop_back();
+    feature._inGrid = false;
+
+    /* Don't keep empty cells around, so the cell count stays proportional to
+       the feature count */
+    if(!oversized && list->empty()) _cells.erase(found);
+}
+
+template<class T> void BasicSpatialIndex3D<T>::update() {
+    if(_pending.empty()) return;
+
+    /* Clean all dirty objects in a single batch, so the shared parent
+       transformations are computed only once. The clean() calls remove the
+       features from the pending list. */
+    std::vector<std::reference_wrapper<AbstractObject<3, T>>> objects;
+    objects.reserve(_pending.size());
+    for(BasicSpatial3D<T>* feature: _pending) {
+        AbstractObject<3, T>& object = feature->object();
+        if(object.isDirty() && object.scene() && object.scene() == _pending.front()->object().scene())
+            objects.push_back(object);
+    }
+    AbstractObject<3, T>::setClean(objects);
+
+    /* What's left are features with changed bounding sphere on clean
+       objects, objects from other scenes and objects outside of any scene */
+    while(!_pending.empty()) {
+        BasicSpatial3D<T>& feature = *_pending.back();
+        AbstractObject<3, T>& object = feature.object();
+        if(object.isDirty() && object.scene()) object.setClean();
+
+        /* Object was clean or the cleaning skipped the feature */
+        if(feature._pending) feature.clean(object.absoluteTransformationMatrix());
+    }
+}
+
+template<class T> void BasicSpatialIndex3D<T>::queryCells(const Math::Range3D<T>& box, std::vector<std::reference_wrapper<BasicSpatial3D<T>>>& out) {
+    /* The cells are loose, so a feature in given cell can extend up to one
+       cell size outside of it */
+    const Vector3i min = Implementation::spatialIndexCellFor(box.min() - Math::Vector3<T>{_cellSize}, _cellSize);
+    const Vector3i max = Implementation::spatialIndexCellFor(box.max() + Math::Vector3<T>{_cellSize}, _cellSize);
+    const Vector3i size = max - min + Vector3i{1};
+
+    /* Look up cells in the range if there's less of them than of the
+       non-empty cells, otherwise go through the non-empty cells */
+    if(Double(size.x())*size.y()*size.z() <= Double(_cells.size())) {
+        for(Int z = min.z(); z <= max.z(); ++z)
+            for(Int y = min.y(); y <= max.y(); ++y)
+                for(Int x = min.x(); x <= max.x(); ++x) {
+                    auto found = _cells.find(Implementation::spatialIndexCellKey({x, y, z}));
+                    if(found == _cells.end()) continue;
+                    for(BasicSpatial3D<T>* feature: found->second)
+                        out.push_back(*feature);
+                }
+    } else for(const auto& cell: _cells) {
+        const Vector3i coordinates = Implementation::spatialIndexCell(cell.first);
+        if((coordinates < min).any() || (coordinates > max).any()) continue;
+        for(BasicSpatial3D<T>* feature: cell.second)
+            out.push_back(*feature);
+    }
+
+    for(BasicSpatial3D<T>* feature: _oversized)
+        out.push_back(*feature);
+}
+
+template<class T> void BasicSpatialIndex3D<T>::queryBox(const Math::Range3D<T>& box, std::vector<std::reference_wrapper<BasicSpatial3D<T>>>& out) {
+    update();
+
+    out.clear();
+    queryCells(box, out);
+    out.erase(std::remove_if(out.begin(), out.end(), [&box](const BasicSpatial3D<T>& feature) {
+        return !Implementation::sphereRange(feature._absoluteCenter, feature._absoluteRadius, box);
+    }), out.end());
+}
+
+template<class T> void BasicSpatialIndex3D<T>::querySphere(const Math::Vector3<T>& center, const T radius, std::vector<std::reference_wrapper<BasicSpatial3D<T>>>& out) {
+    update();
+
+    out.clear();
+    queryCells({center - Math::Vector3<T>{radius}, center + Math::Vector3<T>{radius}}, out);
+    out.erase(std::remove_if(out.begin(), out.end(), [&center, radius](const BasicSpatial3D<T>& feature) {
+        const T distance = radius + feature._absoluteRadius;
+        return (feature._absoluteCenter - center).dot() > distance*distance;
+    }), out.end());
+}
+
+template<class T> void BasicSpatialIndex3D<T>::queryFrustum(const Math::Matrix4<T>& projectionMatrix, std::vector<std::reference_wrapper<BasicSpatial3D<T>>>& out) {
+    update();
+
+    const Math::Frustum<T> frustum = Math::Frustum<T>::fromMatrix(projectionMatrix);
+
+    out.clear();
+
+    /* Skip whole cells outside of the frustum. Half-extent of a loose cell is
+       half of the cell plus the largest possible radius. */
+    const Math::Vector3<T> cellExtent{_cellSize*T(1.5)};
+    for(const auto& cell: _cells) {
+        const Math::Vector3<T> cellCenter = (Math::Vector3<T>{Implementation::spatialIndexCell(cell.first)} + Math::Vector3<T>{T(0.5)})*_cellSize;
+        if(!Math::Geometry::Intersection::aabbFrustum(cellCenter, cellExtent, frustum))
+            continue;
+
+        for(BasicSpatial3D<T>* feature: cell.second)
+            if(Math::Geometry::Intersection::sphereFrustum(feature->_absoluteCenter, feature->_absoluteRadius, frustum))
+                out.push_back(*feature);
+    }
+
+    for(BasicSpatial3D<T>* feature: _oversized)
+        if(Math::Geometry::Intersection::sphereFrustum(feature->_absoluteCenter, feature->_absoluteRadius, frustum))
+            out.push_back(*feature);
+}
+
+template<class T> Math::BitArray BasicSpatialIndex3D<T>::drawableMask(Camera<3, T>& camera, DrawableGroup<3, T>& drawables) {
+    Math::BitArray mask{drawables.size()};
+    CORRADE_ASSERT(camera.object().scene(), "SceneGraph::SpatialIndex3D::drawableMask(): camera is not part of any scene", mask);
+
+    queryFrustum(camera.projectionMatrix()*camera.cameraMatrix(), _scratch);
+
+    /* Mark all drawables of the visible objects that are in given group */
+    for(BasicSpatial3D<T>& feature: _scratch)
+        for(AbstractFeature<3, T>& other: feature.object().features()) {
+            Drawable<3, T>* const drawable = dynamic_cast<Drawable<3, T>*>(&other);
+            if(drawable && drawable->drawables() == &drawables)
+                mask.set(drawable->groupIndex());
+        }
+
+    return mask;
+}
+
+}}
+
+#endif
@@ -0,0 +1,230 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "SpriteBatch.hpp"
+
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Buffer.h"
+#include "Magnum/Context.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/MeshView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Shader.h"
+#include "Magnum/Texture.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/Version.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+
+namespace {
+
+/* Positions are already in normalized device coordinates. Precision
+   qualifiers are not available in GLSL 1.20. */
+constexpr const char* SpriteVertexShader =
+    "#if (defined(GL_ES) && __VERSION__ >= 300) || (!defined(GL_ES) && __VERSION__ >= 130)\n"
+    "#define attribute in\n"
+    "#define varying out\n"
+    "#elif !defined(GL_ES)\n"
+    "#define highp\n"
+    "#define mediump\n"
+    "#define lowp\n"
+    "#endif\n"
+    "attribute highp vec2 position;\n"
+    "attribute mediump vec2 textureCoordinates;\n"
+    "attribute lowp vec4 color;\n"
+    "varying mediump vec2 interpolatedTextureCoordinates;\n"
+    "varying lowp vec4 interpolatedColor;\n"
+    "void main() {\n"
+    "    interpolatedTextureCoordinates = textureCoordinates;\n"
+    "    interpolatedColor = color;\n"
+    "    gl_Position = vec4(position, 0.0, 1.0);\n"
+    "}\n";
+constexpr const char* SpriteFragmentShader =
+    "#if (defined(GL_ES) && __VERSION__ >= 300) || (!defined(GL_ES) && __VERSION__ >= 130)\n"
+    "#define varying in\n"
+    "#define texture2D texture\n"
+    "out lowp vec4 fragmentColor;\n"
+    "#else\n"
+    "#define fragmentColor gl_FragColor\n"
+    "#ifndef GL_ES\n"
+    "#define mediump\n"
+    "#define lowp\n"
+    "#endif\n"
+    "#endif\n"
+    "uniform lowp sampler2D textureData;\n"
+    "varying mediump vec2 interpolatedTextureCoordinates;\n"
+    "varying lowp vec4 interpolatedColor;\n"
+    "void main() {\n"
+    "    fragmentColor = texture2D(textureData, interpolatedTextureCoordinates)*interpolatedColor;\n"
+    "}\n";
+
+enum: Int { TextureLayer = 0 };
+
+class SpriteShader: public AbstractShaderProgram {
+    public:
+        typedef Attribute<0, Vector2> Position;
+        typedef Attribute<1, Vector2> TextureCoordinates;
+        typedef Attribute<3, Color4> Color;
+
+        explicit SpriteShader();
+};
+
+SpriteShader::SpriteShader() {
+    #ifndef MAGNUM_TARGET_GLES
+    const Version version = Context::current().supportedVersion({Version::GL320, Version::GL310, Version::GL300, Version::GL210});
+    #else
+    const Version version = Context::current().supportedVersion({Version::GLES300, Version::GLES200});
+    #endif
+
+    Shader vert{version, Shader::Type::Vertex};
+    Shader frag{version, Shader::Type::Fragment};
+    vert.addSource(SpriteVertexShader);
+    frag.addSource(SpriteFragmentShader);
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({vert, frag}));
+    attachShaders({vert, frag});
+
+    bindAttributeLocation(Position::Location, "position");
+    bindAttributeLocation(TextureCoordinates::Location, "textureCoordinates");
+    bindAttributeLocation(Color::Location, "color");
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+    setUniform(uniformLocation("textureData"), TextureLayer);
+}
+
+template<class T> void createIndices(void* const output, const UnsignedInt spriteCount) {
+    T* const out = reinterpret_cast<T*>(output);
+    for(UnsignedInt i = 0; i != spriteCount; ++i) {
+        /* 2---3 2 3---5
+           |   | |\ \  |
+           |   | | \ \ |
+           |   | |  \ \|
+           0---1 0---1 4 */
+
+        const T vertex = T(i)*4;
+        const UnsignedInt pos = i*6;
+        out[pos]   = vertex;
+        out[pos+1] = vertex+1;
+        out[pos+2] = vertex+2;
+        out[pos+3] = vertex+2;
+        out[pos+4] = vertex+1;
+        out[pos+5] = vertex+3;
+    }
+}
+
+}
+
+struct SpriteBatchRenderer::State {
+    explicit State();
+
+    Buffer vertices{Buffer::TargetHint::Array},
+        indices{Buffer::TargetHint::ElementArray};
+    Mesh mesh;
+    SpriteShader shader;
+    Texture2D white;
+    UnsignedInt capacity{};
+};
+
+SpriteBatchRenderer::State::State() {
+    mesh.setPrimitive(MeshPrimitive::Triangles)
+        .addVertexBuffer(vertices, 0,
+            SpriteShader::Position{},
+            SpriteShader::TextureCoordinates{},
+            SpriteShader::Color{SpriteShader::Color::DataType::UnsignedByte, SpriteShader::Color::DataOption::Normalized});
+
+    /* Used for untextured sprites so the same shader can be used for
+       everything */
+    constexpr Color4ub WhitePixel[]{{255, 255, 255, 255}};
+    white.setMinificationFilter(Sampler::Filter::Nearest)
+        .setMagnificationFilter(Sampler::Filter::Nearest)
+        .setImage(0,
+            #ifndef MAGNUM_TARGET_GLES2
+            TextureFormat::RGBA8,
+            #else
+            TextureFormat::RGBA,
+            #endif
+            ImageView2D{PixelFormat::RGBA, PixelType::UnsignedByte, Vector2i{1}, WhitePixel});
+}
+
+SpriteBatchRenderer::SpriteBatchRenderer(): _state{new State} {}
+
+SpriteBatchRenderer::~SpriteBatchRenderer() = default;
+
+void SpriteBatchRenderer::setVertices(const std::vector<SpriteVertex>& vertices) {
+    /* Orphan the previous data so the upload doesn't need to wait for the
+       previous frame to finish */
+    _state->vertices.setData(vertices, BufferUsage::StreamDraw);
+
+    /* The index buffer depends only on sprite count, recreate it only if
+       it's not large enough */
+    const UnsignedInt spriteCount = vertices.size()/4;
+    if(spriteCount <= _state->capacity) return;
+
+    _state->capacity = Math::max(spriteCount, _state->capacity*2);
+    const UnsignedInt vertexCount = _state->capacity*4;
+    const UnsignedInt indexCount = _state->capacity*6;
+    Mesh::IndexType indexType;
+    Containers::Array<char> indices;
+    if(vertexCount <= 65536) {
+        indexType = Mesh::IndexType::UnsignedShort;
+        indices = Containers::Array<char>{indexCount*sizeof(UnsignedShort)};
+        createIndices<UnsignedShort>(indices, _state->capacity);
+    } else {
+        indexType = Mesh::IndexType::UnsignedInt;
+        indices = Containers::Array<char>{indexCount*sizeof(UnsignedInt)};
+        createIndices<UnsignedInt>(indices, _state->capacity);
+    }
+
+    _state->indices.setData(indices, BufferUsage::StaticDraw);
+    _state->mesh.setIndexBuffer(_state->indices, 0, indexType, 0, vertexCount - 1);
+}
+
+void SpriteBatchRenderer::draw(Texture2D* const texture, const UnsignedInt offset, const UnsignedInt count) {
+    (texture ? *texture : _state->white).bind(TextureLayer);
+    MeshView{_state->mesh}
+        .setCount(count*6)
+        .setIndexRange(offset*6, offset*4, (offset + count)*4 - 1)
+        .draw(_state->shader);
+}
+
+}
+
+/* Instantiated here and not in instantiation.cpp, as the unit test library
+   doesn't link to Magnum. On non-MinGW Windows the instantiation is already
+   marked with extern template. */
+#if !defined(CORRADE_TARGET_WINDOWS) || defined(__MINGW32__)
+template class MAGNUM_SCENEGRAPH_EXPORT BasicSpriteBatch2D<Float>;
+#else
+template class BasicSpriteBatch2D<Float>;
+#endif
+
+}}
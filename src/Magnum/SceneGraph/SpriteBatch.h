@@ -0,0 +1,375 @@
+#ifndef Magnum_SceneGraph_SpriteBatch_h
+#define Magnum_SceneGraph_SpriteBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::BasicSprite2D, @ref Magnum::SceneGraph::BasicSpriteBatch2D, alias @ref Magnum::SceneGraph::BasicSpriteGroup2D, typedef @ref Magnum::SceneGraph::Sprite2D, @ref Magnum::SceneGraph::SpriteGroup2D, @ref Magnum::SceneGraph::SpriteBatch2D
+ */
+
+#include <memory>
+#include <vector>
+
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/SceneGraph/AbstractGroupedFeature.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+    struct SpriteVertex {
+        Vector2 position;
+        Vector2 textureCoordinates;
+        Color4ub color;
+    };
+
+    class MAGNUM_SCENEGRAPH_EXPORT SpriteBatchRenderer {
+        public:
+            explicit SpriteBatchRenderer();
+            ~SpriteBatchRenderer();
+
+            /* Uploads the vertices, enlarges the index buffer if needed */
+            void setVertices(const std::vector<SpriteVertex>& vertices);
+
+            /* Count and offset is in sprites, null texture is replaced with
+               a white one */
+            void draw(Texture2D* texture, UnsignedInt offset, UnsignedInt count);
+
+        private:
+            struct State;
+            std::unique_ptr<State> _state;
+    };
+}
+
+/**
+@brief Sprite for two-dimensional scenes
+
+Textured and colored rectangle attached to an object, drawn in batches using
+@ref BasicSpriteBatch2D "SpriteBatch2D". See its documentation for more
+information and an example.
+
+@see @ref scenegraph, @ref Sprite2D, @ref BasicSpriteGroup2D,
+    @ref SpriteGroup2D
+*/
+template<class T> class BasicSprite2D: public AbstractGroupedFeature<2, BasicSprite2D<T>, T> {
+    public:
+        /**
+         * @brief Constructor
+         * @param object    Object this sprite belongs to
+         * @param sprites   Group this sprite belongs to
+         *
+         * Adds the feature to the object and also to the group, if specified.
+         * By default the sprite is a white square of size @cpp 1 @ce centered
+         * at object origin, without any texture and in layer @cpp 0 @ce.
+         */
+        explicit BasicSprite2D(AbstractObject<2, T>& object, FeatureGroup<2, BasicSprite2D<T>, T>* sprites = nullptr): AbstractGroupedFeature<2, BasicSprite2D<T>, T>{object, sprites}, _rectangle{{T(-0.5), T(-0.5)}, {T(0.5), T(0.5)}}, _textureRectangle{{}, Vector2{1.0f}}, _texture{}, _color{1.0f}, _layer{} {}
+
+        /** @brief Rectangle in object coordinates */
+        Math::Range2D<T> rectangle() const { return _rectangle; }
+
+        /**
+         * @brief Set rectangle in object coordinates
+         * @return Reference to self (for method chaining)
+         *
+         * The rectangle is transformed with object transformation, so
+         * scaling and rotation of the object is applied to it as well.
+         */
+        BasicSprite2D<T>& setRectangle(const Math::Range2D<T>& rectangle) {
+            _rectangle = rectangle;
+            return *this;
+        }
+
+        /** @brief Texture */
+        Texture2D* texture() const { return _texture; }
+
+        /**
+         * @brief Set texture
+         * @return Reference to self (for method chaining)
+         *
+         * Sprites sharing the same texture and layer are drawn with a single
+         * draw call. If set to @cpp nullptr @ce, the sprite is drawn with
+         * just @ref color().
+         */
+        BasicSprite2D<T>& setTexture(Texture2D* texture) {
+            _texture = texture;
+            return *this;
+        }
+
+        /** @brief Texture rectangle */
+        Range2D textureRectangle() const { return _textureRectangle; }
+
+        /**
+         * @brief Set texture rectangle
+         * @return Reference to self (for method chaining)
+         *
+         * In normalized texture coordinates, default is the whole texture.
+         * @see @ref setTextureRectangle(const Range2Di&, const Vector2i&)
+         */
+        BasicSprite2D<T>& setTextureRectangle(const Range2D& rectangle) {
+            _textureRectangle = rectangle;
+            return *this;
+        }
+
+        /**
+         * @brief Set texture rectangle in pixels
+         * @return Reference to self (for method chaining)
+         *
+         * Converts @p rectangle in pixels to normalized texture coordinates
+         * using @p textureSize. Useful for rectangles returned by
+         * @ref TextureTools::atlas().
+         */
+        BasicSprite2D<T>& setTextureRectangle(const Range2Di& rectangle, const Vector2i& textureSize) {
+            return setTextureRectangle({Vector2{rectangle.min()}/Vector2{textureSize},
+                                        Vector2{rectangle.max()}/Vector2{textureSize}});
+        }
+
+        /** @brief Color */
+        Color4 color() const { return _color; }
+
+        /**
+         * @brief Set color
+         * @return Reference to self (for method chaining)
+         *
+         * The texture is multiplied with the color. Default is fully opaque
+         * white.
+         */
+        BasicSprite2D<T>& setColor(const Color4& color) {
+            _color = color;
+            return *this;
+        }
+
+        /** @brief Layer */
+        Int layer() const { return _layer; }
+
+        /**
+         * @brief Set layer
+         * @return Reference to self (for method chaining)
+         *
+         * Sprites in lower layers are drawn first. Default is @cpp 0 @ce.
+         */
+        BasicSprite2D<T>& setLayer(Int layer) {
+            _layer = layer;
+            return *this;
+        }
+
+    private:
+        Math::Range2D<T> _rectangle;
+        Range2D _textureRectangle;
+        Texture2D* _texture;
+        Color4 _color;
+        Int _layer;
+};
+
+/**
+@brief Sprite for two-dimensional float scenes
+
+@see @ref SpriteGroup2D, @ref SpriteBatch2D
+*/
+typedef BasicSprite2D<Float> Sprite2D;
+
+/**
+@brief Group of sprites for two-dimensional scenes
+
+See @ref BasicSpriteBatch2D for more information.
+@see @ref SpriteGroup2D, @ref scenegraph
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicSpriteGroup2D = FeatureGroup<2, BasicSprite2D<T>, T>;
+#endif
+
+/**
+@brief Group of sprites for two-dimensional float scenes
+
+@see @ref Sprite2D, @ref SpriteBatch2D
+*/
+typedef BasicSpriteGroup2D<Float> SpriteGroup2D;
+
+/**
+@brief Sprite batch for two-dimensional scenes
+
+Draws a group of @ref BasicSprite2D "Sprite2D" features with as few draw calls
+as possible. Each frame, vertices of all visible sprites are generated on the
+CPU, transformed with the object transformation and camera projection, sorted
+by @ref BasicSprite2D::layer() "layer" and
+@ref BasicSprite2D::texture() "texture", streamed into a single vertex buffer
+and drawn with one draw call per texture and layer. Sprite rectangles in a
+texture atlas can be taken directly from @ref TextureTools::atlas():
+@code
+Texture2D atlasTexture;
+Vector2i atlasSize{1024};
+std::vector<Range2Di> rectangles = TextureTools::atlas(atlasSize, iconSizes);
+// upload the icons to atlasTexture ...
+
+SceneGraph::SpriteGroup2D sprites;
+for(std::size_t i = 0; i != icons.size(); ++i) {
+    auto object = new Object2D{&scene};
+    (new SceneGraph::Sprite2D{*object, &sprites})
+        ->setTexture(&atlasTexture)
+        .setTextureRectangle(rectangles[i], atlasSize)
+        .setRectangle(Range2D::fromSize({}, Vector2{iconSizes[i]}));
+}
+
+SceneGraph::SpriteBatch2D batch;
+
+// each frame
+Renderer::enable(Renderer::Feature::Blending);
+Renderer::setBlendFunction(Renderer::BlendFunction::SourceAlpha,
+    Renderer::BlendFunction::OneMinusSourceAlpha);
+batch.draw(camera, sprites);
+@endcode
+
+Ordering of sprites is preserved only within the same texture and layer, so
+overlapping sprites that use different textures should be put into
+different layers. Sprites that are completely outside of the view are not
+drawn. Blending and depth test are not changed by the batch, the colors are
+expected to be non-premultiplied.
+
+Vertex generation is done in @ref collect(), which doesn't need any OpenGL
+context, the GPU resources are created on first call to @ref draw(). Internal
+storage is reused between calls, so no allocation is done unless the group
+grew since the previous call.
+
+## Explicit template specializations
+
+The following specialization is explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref SpriteBatch.hpp implementation file to avoid
+linker errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref SpriteBatch2D
+
+@see @ref scenegraph, @ref InstanceCollector, @ref Text::BatchRenderer
+*/
+template<class T> class BasicSpriteBatch2D {
+    public:
+        /** @brief Batch of sprites sharing the same texture and layer */
+        struct Batch {
+            /** @brief Texture, @cpp nullptr @ce for untextured sprites */
+            Texture2D* texture;
+
+            /** @brief Layer */
+            Int layer;
+
+            /** @brief Offset of the batch in sprites */
+            UnsignedInt offset;
+
+            /** @brief Count of sprites in the batch */
+            UnsignedInt count;
+        };
+
+        /**
+         * @brief Sprite vertex
+         *
+         * Position is in normalized device coordinates, each sprite has four
+         * vertices, in order bottom left, bottom right, top left and top
+         * right corner of its rectangle.
+         */
+        typedef Implementation::SpriteVertex Vertex;
+
+        /**
+         * @brief Constructor
+         *
+         * Doesn't create any OpenGL objects, these are created on first
+         * @ref draw() call.
+         */
+        explicit BasicSpriteBatch2D();
+
+        /** @brief Copying is not allowed */
+        BasicSpriteBatch2D(const BasicSpriteBatch2D<T>&) = delete;
+
+        /** @brief Copying is not allowed */
+        BasicSpriteBatch2D<T>& operator=(const BasicSpriteBatch2D<T>&) = delete;
+
+        ~BasicSpriteBatch2D();
+
+        /**
+         * @brief Collect vertices of given group of sprites
+         *
+         * Replaces contents of @ref vertices() and @ref batches() with
+         * visible sprites of given group.
+         */
+        void collect(Camera<2, T>& camera, BasicSpriteGroup2D<T>& group);
+
+        /**
+         * @brief Draw given group of sprites
+         *
+         * Calls @ref collect(), uploads the vertices and draws each batch.
+         */
+        void draw(Camera<2, T>& camera, BasicSpriteGroup2D<T>& group);
+
+        /**
+         * @brief Sprite vertices
+         *
+         * Vertices of all batches in @ref batches() one after another.
+         */
+        const std::vector<Vertex>& vertices() const { return _vertices; }
+
+        /** @brief Batches */
+        const std::vector<Batch>& batches() const { return _batches; }
+
+        /**
+         * @brief Count of sprites drawn in last @ref collect() call
+         *
+         * Doesn't include sprites that were outside of the view.
+         */
+        std::size_t spriteCount() const { return _vertices.size()/4; }
+
+        /**
+         * @brief Count of draw calls in last @ref collect() call
+         *
+         * Equal to count of @ref batches().
+         */
+        std::size_t drawCallCount() const { return _batches.size(); }
+
+    private:
+        struct Item {
+            Int layer;
+            Texture2D* texture;
+            UnsignedInt index;
+            /* Vertices in normalized device coordinates */
+            Vector2 corners[4];
+        };
+
+        std::unique_ptr<Implementation::SpriteBatchRenderer> _renderer;
+        std::vector<Item> _items;
+        std::vector<Vertex> _vertices;
+        std::vector<Batch> _batches;
+};
+
+/**
+@brief Sprite batch for two-dimensional float scenes
+
+@see @ref Sprite2D, @ref SpriteGroup2D
+*/
+typedef BasicSpriteBatch2D<Float> SpriteBatch2D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT BasicSpriteBatch2D<Float>;
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef Magnum_SceneGraph_SpriteBatch_hpp
+#define Magnum_SceneGraph_SpriteBatch_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref SpriteBatch.h
+ */
+
+#include <algorithm>
+#include <functional>
+
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/SpriteBatch.h"
+
+namespace Magnum { namespace SceneGraph {
+
+template<class T> BasicSpriteBatch2D<T>::BasicSpriteBatch2D() = default;
+
+template<class T> BasicSpriteBatch2D<T>::~BasicSpriteBatch2D() = default;
+
+template<class T> void BasicSpriteBatch2D<T>::collect(Camera<2, T>& camera, BasicSpriteGroup2D<T>& group) {
+    const MatrixTypeFor<2, T> projectionCameraMatrix = camera.projectionMatrix()*camera.cameraMatrix();
+
+    /* Transform corners of all sprites to normalized device coordinates,
+       skipping these which are completely outside of the view */
+    _items.clear();
+    _items.reserve(group.size());
+    for(std::size_t i = 0; i != group.size(); ++i) {
+        BasicSprite2D<T>& sprite = group[i];
+        const MatrixTypeFor<2, T> transformationMatrix = projectionCameraMatrix*sprite.object().absoluteTransformationMatrix();
+        const Math::Range2D<T> rectangle = sprite.rectangle();
+
+        Item item{sprite.layer(), sprite.texture(), UnsignedInt(i), {}};
+        Vector2 min{Math::Constants<Float>::inf()}, max{-Math::Constants<Float>::inf()};
+        for(UnsignedInt j = 0; j != 4; ++j) {
+            const Math::Vector2<T> corner{j & 1 ? rectangle.right() : rectangle.left(),
+                                          j & 2 ? rectangle.top() : rectangle.bottom()};
+            item.corners[j] = Vector2{transformationMatrix.transformPoint(corner)};
+            min = Math::min(min, item.corners[j]);
+            max = Math::max(max, item.corners[j]);
+        }
+
+        if((min > Vector2{1.0f}).any() || (max < Vector2{-1.0f}).any())
+            continue;
+
+        _items.push_back(item);
+    }
+
+    /* Sort by layer and texture, original index is the last key to make the
+       sort stable */
+    std::sort(_items.begin(), _items.end(), [](const Item& a, const Item& b) {
+        if(a.layer != b.layer) return a.layer < b.layer;
+        if(a.texture != b.texture) return std::less<Texture2D*>{}(a.texture, b.texture);
+        return a.index < b.index;
+    });
+
+    /* Generate the vertices and batches */
+    _vertices.clear();
+    _vertices.reserve(_items.size()*4);
+    _batches.clear();
+    for(std::size_t i = 0; i != _items.size(); ++i) {
+        const Item& item = _items[i];
+        if(!i || item.layer != _items[i - 1].layer || item.texture != _items[i - 1].texture)
+            _batches.push_back({item.texture, item.layer, UnsignedInt(i), 0});
+        ++_batches.back().count;
+
+        const BasicSprite2D<T>& sprite = group[item.index];
+        const Range2D textureRectangle = sprite.textureRectangle();
+        const Color4ub color = Math::denormalize<Color4ub>(sprite.color());
+        for(UnsignedInt j = 0; j != 4; ++j) _vertices.push_back({item.corners[j],
+            {j & 1 ? textureRectangle.right() : textureRectangle.left(),
+             j & 2 ? textureRectangle.top() : textureRectangle.bottom()},
+            color});
+    }
+}
+
+template<class T> void BasicSpriteBatch2D<T>::draw(Camera<2, T>& camera, BasicSpriteGroup2D<T>& group) {
+    collect(camera, group);
+    if(_vertices.empty()) return;
+
+    if(!_renderer) _renderer.reset(new Implementation::SpriteBatchRenderer);
+    _renderer->setVertices(_vertices);
+    for(const Batch& batch: _batches)
+        _renderer->draw(batch.texture, batch.offset, batch.count);
+}
+
+}}
+
+#endif
@@ -0,0 +1,141 @@
+#ifndef Magnum_SceneGraph_StaticBatch_h
+#define Magnum_SceneGraph_StaticBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::SceneGraph::StaticBatch, function @ref Magnum::SceneGraph::staticBatches()
+ */
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Drawables that can be batched together
+
+@see @ref staticBatches()
+*/
+template<UnsignedInt dimensions, class T> struct StaticBatch {
+    /**
+     * @brief Render state shared by all drawables in the batch
+     *
+     * The @ref DrawState::mesh is always `0`, as the drawables are expected
+     * to differ only in mesh.
+     */
+    DrawState state;
+
+    /**
+     * @brief Drawables and their transformations
+     *
+     * Transformation of each drawable relative to the root object passed to
+     * @ref staticBatches().
+     */
+    std::vector<std::pair<std::reference_wrapper<Drawable<dimensions, T>>, MatrixTypeFor<dimensions, T>>> drawables;
+};
+
+/**
+@brief Collect static drawables for batching
+@param root     Root of the static subtree
+@param group    Drawable group
+
+Returns drawables from @p group that are attached to @p root or any of its
+descendants, grouped by @ref DrawState::shader, @ref DrawState::renderState
+and @ref DrawState::textures, each together with its transformation relative
+to @p root. Drawables with unknown shader (i.e., @ref DrawState::shader set to
+`0`) are skipped. The batches are ordered by state, drawables in each batch
+are in the order they are in the group.
+
+Together with @ref MeshTools::concatenate() this can be used to replace many
+drawables of static level geometry with a single drawable per shader
+configuration, which then has all the vertices pre-transformed and draws
+everything in one call:
+@code
+for(const SceneGraph::StaticBatch3D& batch: SceneGraph::staticBatches(level, drawables)) {
+    std::vector<std::pair<std::reference_wrapper<const Trade::MeshData3D>, Matrix4>> meshes;
+    for(const auto& drawable: batch.drawables)
+        meshes.emplace_back(meshData[drawable.first.get().drawState().mesh], drawable.second);
+
+    std::pair<Trade::MeshData3D, std::vector<MeshTools::MeshRange>> batched = MeshTools::concatenate(meshes);
+    new BatchedDrawable{level, batched.first, batch.state, drawables};
+
+    for(const auto& drawable: batch.drawables)
+        drawable.first.get().destroy();
+}
+@endcode
+
+Note that the batched geometry is not culled per original drawable and moving
+the original objects afterwards has no effect on it.
+@see @ref InstanceCollector
+*/
+template<UnsignedInt dimensions, class T> std::vector<StaticBatch<dimensions, T>> staticBatches(AbstractObject<dimensions, T>& root, DrawableGroup<dimensions, T>& group);
+
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+/**
+@brief Static batch of two-dimensional drawables
+
+Convenience alternative to `StaticBatch<2, T>`. See @ref staticBatches() for
+more information.
+@see @ref StaticBatch2D, @ref BasicStaticBatch3D
+*/
+template<class T> using BasicStaticBatch2D = StaticBatch<2, T>;
+
+/**
+@brief Static batch of three-dimensional drawables
+
+Convenience alternative to `StaticBatch<3, T>`. See @ref staticBatches() for
+more information.
+@see @ref StaticBatch3D, @ref BasicStaticBatch2D
+*/
+template<class T> using BasicStaticBatch3D = StaticBatch<3, T>;
+#endif
+
+/**
+@brief Static batch of two-dimensional float drawables
+
+@see @ref StaticBatch3D
+*/
+typedef BasicStaticBatch2D<Float> StaticBatch2D;
+
+/**
+@brief Static batch of three-dimensional float drawables
+
+@see @ref StaticBatch2D
+*/
+typedef BasicStaticBatch3D<Float> StaticBatch3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template MAGNUM_SCENEGRAPH_EXPORT std::vector<StaticBatch<2, Float>> staticBatches(AbstractObject<2, Float>&, DrawableGroup<2, Float>&);
+extern template MAGNUM_SCENEGRAPH_EXPORT std::vector<StaticBatch<3, Float>> staticBatches(AbstractObject<3, Float>&, DrawableGroup<3, Float>&);
+#endif
+
+}}
+
+#endif
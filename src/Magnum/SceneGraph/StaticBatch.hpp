@@ -0,0 +1,81 @@
+#ifndef Magnum_SceneGraph_StaticBatch_hpp
+#define Magnum_SceneGraph_StaticBatch_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref StaticBatch.h
+ */
+
+#include <algorithm>
+
+#include "Magnum/SceneGraph/AbstractObject.h"
+#include "Magnum/SceneGraph/FeatureGroup.h"
+#include "Magnum/SceneGraph/StaticBatch.h"
+
+namespace Magnum { namespace SceneGraph {
+
+template<UnsignedInt dimensions, class T> std::vector<StaticBatch<dimensions, T>> staticBatches(AbstractObject<dimensions, T>& root, DrawableGroup<dimensions, T>& group) {
+    /* Pick drawables in the subtree, with known shader */
+    std::vector<UnsignedInt> items;
+    for(std::size_t i = 0; i != group.size(); ++i) {
+        if(!group[i].drawState().shader) continue;
+
+        for(AbstractObject<dimensions, T>* object = &group[i].object(); object; object = object->parent()) {
+            if(object != &root) continue;
+            items.push_back(UnsignedInt(i));
+            break;
+        }
+    }
+
+    /* Sort by state, original index is the last key to keep the group order
+       inside each batch */
+    std::sort(items.begin(), items.end(), [&group](UnsignedInt a, UnsignedInt b) {
+        const DrawState& stateA = group[a].drawState();
+        const DrawState& stateB = group[b].drawState();
+        if(stateA.shader != stateB.shader) return stateA.shader < stateB.shader;
+        if(stateA.renderState != stateB.renderState) return stateA.renderState < stateB.renderState;
+        if(stateA.textures != stateB.textures) return stateA.textures < stateB.textures;
+        return a < b;
+    });
+
+    /* Start a new batch every time the state changes */
+    const MatrixTypeFor<dimensions, T> invertedRootTransformation = root.absoluteTransformationMatrix().inverted();
+    std::vector<StaticBatch<dimensions, T>> batches;
+    for(const UnsignedInt item: items) {
+        Drawable<dimensions, T>& drawable = group[item];
+        const DrawState state{drawable.drawState().shader, drawable.drawState().textures, 0, drawable.drawState().renderState};
+        if(batches.empty() || batches.back().state != state)
+            batches.push_back({state, {}});
+
+        batches.back().drawables.emplace_back(drawable, invertedRootTransformation*drawable.object().absoluteTransformationMatrix());
+    }
+
+    return batches;
+}
+
+}}
+
+#endif
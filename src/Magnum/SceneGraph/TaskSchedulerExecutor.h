@@ -0,0 +1,83 @@
+#ifndef Magnum_SceneGraph_TaskSchedulerExecutor_h
+#define Magnum_SceneGraph_TaskSchedulerExecutor_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#if !defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(CORRADE_TARGET_NACL)
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::TaskSchedulerExecutor
+ */
+#endif
+
+#include "Magnum/Magnum.h"
+#include "Magnum/SceneGraph/AbstractTaskExecutor.h"
+
+#if !defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(CORRADE_TARGET_NACL)
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Task executor using @ref TaskScheduler
+
+Distributes the tasks among threads of given @ref Magnum::TaskScheduler "TaskScheduler"
+using @ref TaskScheduler::parallelFor(), so the scene graph shares the worker
+threads with the rest of the application:
+@code
+TaskScheduler scheduler;
+SceneGraph::TaskSchedulerExecutor executor{scheduler};
+
+SceneGraph::FlatTransformationCache<SceneGraph::MatrixTransformation3D> cache{scene};
+cache.update(executor);
+@endcode
+*/
+class MAGNUM_SCENEGRAPH_EXPORT TaskSchedulerExecutor: public AbstractTaskExecutor {
+    public:
+        /**
+         * @brief Constructor
+         * @param scheduler     Task scheduler
+         * @param grainSize     Minimal count of tasks executed in one
+         *      scheduler task
+         */
+        explicit TaskSchedulerExecutor(TaskScheduler& scheduler, std::size_t grainSize = 1): _scheduler(scheduler), _grainSize{grainSize} {}
+
+        /** @brief Task scheduler */
+        TaskScheduler& scheduler() { return _scheduler; }
+
+        /** @brief Grain size */
+        std::size_t grainSize() const { return _grainSize; }
+
+    private:
+        void doExecute(std::size_t count, Task task, void* state) override;
+
+        TaskScheduler& _scheduler;
+        std::size_t _grainSize;
+};
+
+}}
+
+#else
+#error this header is not available in Emscripten and NaCl build
+#endif
+
+#endif
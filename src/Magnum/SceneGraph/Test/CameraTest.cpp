@@ -25,6 +25,8 @@
 
 #include <Corrade/TestSuite/Tester.h>
 
+#include "Magnum/Math/BitArray.h"
+
 #include "Magnum/SceneGraph/Camera.hpp" /* only for aspectRatioFix(), so it doesn't have to be exported */
 #include "Magnum/SceneGraph/Camera.h"
 #include "Magnum/SceneGraph/Drawable.h"
@@ -46,10 +48,19 @@ struct CameraTest: TestSuite::Tester {
     void projectionSizePerspective();
     void projectionSizeViewport();
     void draw();
+    void drawableTransformations();
+    void drawMasked();
+    void drawCulling2D();
+    void drawCulling3D();
+    void drawableTransformationsCustomView();
+    void drawableMatrices2D();
+    void drawableMatrices3D();
+    void drawWithMatrices();
 };
 
 typedef SceneGraph::Object<SceneGraph::MatrixTransformation2D> Object2D;
 typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation2D> Scene2D;
 typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
 
 CameraTest::CameraTest() {
@@ -61,7 +72,15 @@ CameraTest::CameraTest() {
               &CameraTest::projectionSizeOrthographic,
               &CameraTest::projectionSizePerspective,
               &CameraTest::projectionSizeViewport,
-              &CameraTest::draw});
+              &CameraTest::draw,
+              &CameraTest::drawableTransformations,
+              &CameraTest::drawMasked,
+              &CameraTest::drawCulling2D,
+              &CameraTest::drawCulling3D,
+              &CameraTest::drawableTransformationsCustomView,
+              &CameraTest::drawableMatrices2D,
+              &CameraTest::drawableMatrices3D,
+              &CameraTest::drawWithMatrices});
 }
 
 void CameraTest::fixAspectRatio() {
@@ -210,6 +229,368 @@ void CameraTest::draw() {
     CORRADE_COMPARE(thirdTransformation, Matrix4());
 }
 
+void CameraTest::drawableTransformations() {
+    class Drawable: public SceneGraph::Drawable3D {
+        public:
+            Drawable(AbstractObject3D& object, DrawableGroup3D* group): SceneGraph::Drawable3D(object, group) {}
+
+        protected:
+            void draw(const Matrix4&, Camera3D&) override {}
+    };
+
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    Object3D first(&scene);
+    first.scale(Vector3(5.0f));
+    Drawable* firstDrawable = new Drawable(first, &group);
+
+    Object3D second(&scene);
+    second.translate(Vector3::yAxis(3.0f));
+    Drawable* secondDrawable = new Drawable(second, &group);
+
+    Object3D third(&second);
+    third.translate(Vector3::zAxis(-1.5f));
+
+    Camera3D camera(third);
+    const std::vector<Camera3D::DrawableTransformation>& transformations = camera.drawableTransformations(group);
+    CORRADE_COMPARE(transformations.size(), 2);
+    CORRADE_VERIFY(&transformations[0].first.get() == firstDrawable);
+    CORRADE_VERIFY(&transformations[1].first.get() == secondDrawable);
+    CORRADE_COMPARE(transformations[0].second, Matrix4::translation({0.0f, -3.0f, 1.5f})*Matrix4::scaling(Vector3(5.0f)));
+    CORRADE_COMPARE(transformations[1].second, Matrix4::translation(Vector3::zAxis(1.5f)));
+
+    /* The storage is reused on next call */
+    const Camera3D::DrawableTransformation* data = transformations.data();
+    second.translate(Vector3::yAxis(1.0f));
+    CORRADE_VERIFY(camera.drawableTransformations(group).data() == data);
+    CORRADE_COMPARE(transformations[1].second, Matrix4::translation(Vector3::zAxis(1.5f)));
+    CORRADE_COMPARE(transformations[0].second, Matrix4::translation({0.0f, -4.0f, 1.5f})*Matrix4::scaling(Vector3(5.0f)));
+}
+
+void CameraTest::drawMasked() {
+    class Drawable: public SceneGraph::Drawable3D {
+        public:
+            Drawable(AbstractObject3D& object, DrawableGroup3D* group, Int& drawCount): SceneGraph::Drawable3D(object, group), drawCount(drawCount) {}
+
+        protected:
+            void draw(const Matrix4&, Camera3D&) override { ++drawCount; }
+
+        private:
+            Int& drawCount;
+    };
+
+    DrawableGroup3D group;
+    Scene3D scene;
+    Object3D cameraObject(&scene);
+    Camera3D camera(cameraObject);
+
+    /* Cross the word boundary */
+    std::vector<Object3D*> objects;
+    std::vector<Int> drawCounts(100);
+    for(std::size_t i = 0; i != drawCounts.size(); ++i) {
+        objects.push_back(new Object3D{&scene});
+        new Drawable(*objects.back(), &group, drawCounts[i]);
+    }
+
+    Math::BitArray mask{group.size()};
+    mask.set(3).set(63).set(64).set(99);
+    camera.draw(group, mask);
+    for(std::size_t i = 0; i != drawCounts.size(); ++i)
+        CORRADE_COMPARE(drawCounts[i], mask[i] ? 1 : 0);
+
+    const std::vector<Camera3D::DrawableTransformation>& transformations = camera.drawableTransformations(group, mask);
+    CORRADE_COMPARE(transformations.size(), 4);
+    CORRADE_VERIFY(&transformations[0].first.get() == &group[3]);
+    CORRADE_VERIFY(&transformations[1].first.get() == &group[63]);
+    CORRADE_VERIFY(&transformations[2].first.get() == &group[64]);
+    CORRADE_VERIFY(&transformations[3].first.get() == &group[99]);
+
+    /* Empty mask draws nothing */
+    CORRADE_VERIFY(camera.drawableTransformations(group, Math::BitArray{group.size()}).empty());
+}
+
+void CameraTest::drawCulling2D() {
+    class Drawable: public SceneGraph::Drawable2D {
+        public:
+            Drawable(AbstractObject2D& object, DrawableGroup2D* group, bool& drawn): SceneGraph::Drawable2D(object, group), drawn(drawn) {}
+
+        protected:
+            void draw(const Matrix3&, Camera2D&) override {
+                drawn = true;
+            }
+
+        private:
+            bool& drawn;
+    };
+
+    DrawableGroup2D group;
+    Scene2D scene;
+
+    /* Inside */
+    Object2D first(&scene);
+    bool firstDrawn = false;
+    first.translate({0.5f, 0.5f});
+    (new Drawable(first, &group, firstDrawn))->setBoundingSphere({}, 0.25f);
+
+    /* Outside, but scaled so it intersects */
+    Object2D second(&scene);
+    bool secondDrawn = false;
+    second.scale(Vector2{4.0f}).translate(Vector2::xAxis(3.5f));
+    (new Drawable(second, &group, secondDrawn))->setBoundingBox({Vector2{-0.5f}, Vector2{0.5f}});
+
+    /* Outside */
+    Object2D third(&scene);
+    bool thirdDrawn = false;
+    third.translate(Vector2::yAxis(-3.0f));
+    (new Drawable(third, &group, thirdDrawn))->setBoundingBox({Vector2{-0.5f}, Vector2{0.5f}});
+
+    Object2D cameraObject(&scene);
+    Camera2D camera(cameraObject);
+    camera.setProjectionMatrix(Matrix3::projection({4.0f, 4.0f}));
+    camera.draw(group);
+
+    CORRADE_VERIFY(firstDrawn);
+    CORRADE_VERIFY(secondDrawn);
+    CORRADE_VERIFY(!thirdDrawn);
+    CORRADE_COMPARE(camera.testedDrawableCount(), 3);
+    CORRADE_COMPARE(camera.culledDrawableCount(), 1);
+}
+
+void CameraTest::drawCulling3D() {
+    class Drawable: public SceneGraph::Drawable3D {
+        public:
+            Drawable(AbstractObject3D& object, DrawableGroup3D* group, bool& drawn): SceneGraph::Drawable3D(object, group), drawn(drawn) {}
+
+        protected:
+            void draw(const Matrix4&, Camera3D&) override {
+                drawn = true;
+            }
+
+        private:
+            bool& drawn;
+    };
+
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    /* Inside */
+    Object3D first(&scene);
+    bool firstDrawn = false;
+    first.translate(Vector3::zAxis(-10.0f));
+    (new Drawable(first, &group, firstDrawn))->setBoundingSphere({}, 1.0f);
+
+    /* Outside on the side */
+    Object3D second(&scene);
+    bool secondDrawn = false;
+    second.translate({100.0f, 0.0f, -10.0f});
+    (new Drawable(second, &group, secondDrawn))->setBoundingSphere({}, 1.0f);
+
+    /* Outside, but without bounding volume */
+    Object3D third(&scene);
+    bool thirdDrawn = false;
+    third.translate({100.0f, 0.0f, -10.0f});
+    new Drawable(third, &group, thirdDrawn);
+
+    /* Behind the camera */
+    Object3D fourth(&scene);
+    bool fourthDrawn = false;
+    fourth.translate(Vector3::zAxis(5.0f));
+    (new Drawable(fourth, &group, fourthDrawn))->setBoundingBox({{-0.5f, -0.5f, -0.5f}, {0.5f, 0.5f, 10.0f}});
+
+    /* Behind the far plane */
+    Object3D fifth(&scene);
+    bool fifthDrawn = false;
+    fifth.translate(Vector3::zAxis(-200.0f));
+    (new Drawable(fifth, &group, fifthDrawn))->setBoundingBox({Vector3{-1.0f}, Vector3{1.0f}});
+
+    Object3D cameraObject(&scene);
+    Camera3D camera(cameraObject);
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(35.0f), 1.0f, 0.1f, 100.0f));
+    camera.draw(group);
+
+    CORRADE_VERIFY(firstDrawn);
+    CORRADE_VERIFY(!secondDrawn);
+    CORRADE_VERIFY(thirdDrawn);
+    CORRADE_VERIFY(!fourthDrawn);
+    CORRADE_VERIFY(!fifthDrawn);
+    CORRADE_COMPARE(camera.testedDrawableCount(), 4);
+    CORRADE_COMPARE(camera.culledDrawableCount(), 3);
+
+    /* Rotate the fourth so it extends into the frustum */
+    fourth.rotateY(Deg(180.0f));
+    camera.draw(group);
+    CORRADE_VERIFY(fourthDrawn);
+    CORRADE_COMPARE(camera.culledDrawableCount(), 2);
+}
+
+void CameraTest::drawableTransformationsCustomView() {
+    class Drawable: public SceneGraph::Drawable3D {
+        public:
+            Drawable(AbstractObject3D& object, DrawableGroup3D* group): SceneGraph::Drawable3D(object, group) {}
+
+        protected:
+            void draw(const Matrix4&, Camera3D&) override {}
+    };
+
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    /* In front of the camera, but behind the custom view */
+    Object3D first(&scene);
+    first.translate(Vector3::zAxis(-10.0f));
+    (new Drawable(first, &group))->setBoundingSphere({}, 1.0f);
+
+    /* Behind the camera, but in front of the custom view */
+    Object3D second(&scene);
+    second.translate(Vector3::zAxis(10.0f));
+    Drawable* secondDrawable = new Drawable(second, &group);
+    secondDrawable->setBoundingSphere({}, 1.0f);
+
+    Object3D cameraObject(&scene);
+    Camera3D camera(cameraObject);
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(35.0f), 1.0f, 0.1f, 100.0f));
+    CORRADE_COMPARE(camera.drawableTransformations(group).size(), 1);
+
+    /* View from the other side */
+    const Matrix4 cameraMatrix = Matrix4::rotationY(Deg(180.0f));
+    const std::vector<Camera3D::DrawableTransformation>& transformations = camera.drawableTransformations(group, cameraMatrix, Matrix4::orthographicProjection({4.0f, 4.0f}, 0.0f, 20.0f));
+    CORRADE_COMPARE(transformations.size(), 1);
+    CORRADE_VERIFY(&transformations[0].first.get() == secondDrawable);
+    CORRADE_COMPARE(transformations[0].second, cameraMatrix*Matrix4::translation(Vector3::zAxis(10.0f)));
+    CORRADE_COMPARE(camera.testedDrawableCount(), 2);
+    CORRADE_COMPARE(camera.culledDrawableCount(), 1);
+}
+
+void CameraTest::drawableMatrices2D() {
+    class Drawable: public SceneGraph::Drawable2D {
+        public:
+            Drawable(AbstractObject2D& object, DrawableGroup2D* group): SceneGraph::Drawable2D(object, group) {}
+
+        protected:
+            void draw(const Matrix3&, Camera2D&) override {}
+    };
+
+    DrawableGroup2D group;
+    Scene2D scene;
+
+    Object2D object(&scene);
+    object.scale({2.0f, 0.5f})
+          .rotate(Deg(30.0f))
+          .translate({1.0f, -3.0f});
+    new Drawable(object, &group);
+
+    Object2D cameraObject(&scene);
+    cameraObject.translate({0.5f, 1.0f});
+    Camera2D camera(cameraObject);
+    camera.setProjectionMatrix(Matrix3::projection({4.0f, 3.0f}));
+
+    const std::vector<Camera2D::DrawableWithMatrices>& matrices = camera.drawableMatrices(group);
+    CORRADE_COMPARE(matrices.size(), 1);
+    CORRADE_VERIFY(&matrices[0].first.get() == &group[0]);
+
+    const Matrix3 transformation = Matrix3::translation({-0.5f, -1.0f})*object.transformationMatrix();
+    CORRADE_COMPARE(matrices[0].second.transformationMatrix, transformation);
+    CORRADE_COMPARE(matrices[0].second.projectionTransformationMatrix, camera.projectionMatrix()*transformation);
+    CORRADE_COMPARE(matrices[0].second.normalMatrix, transformation.rotationScaling().inverted().transposed());
+}
+
+void CameraTest::drawableMatrices3D() {
+    class Drawable: public SceneGraph::Drawable3D {
+        public:
+            Drawable(AbstractObject3D& object, DrawableGroup3D* group): SceneGraph::Drawable3D(object, group) {}
+
+        protected:
+            void draw(const Matrix4&, Camera3D&) override {}
+    };
+
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    Object3D first(&scene);
+    first.scale({2.0f, 0.5f, 3.0f})
+         .rotate(Deg(30.0f), Vector3{1.0f, 3.0f, -2.0f}.normalized())
+         .translate({1.0f, -3.0f, -5.0f});
+    new Drawable(first, &group);
+
+    Object3D second(&scene);
+    second.translate({0.0f, 0.0f, -4.0f});
+    new Drawable(second, &group);
+
+    Object3D cameraObject(&scene);
+    cameraObject.rotateY(Deg(15.0f));
+    Camera3D camera(cameraObject);
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(60.0f), 1.0f, 0.1f, 100.0f));
+
+    /* Only the second one */
+    Math::BitArray mask{2};
+    mask.set(1);
+    const std::vector<Camera3D::DrawableWithMatrices>& masked = camera.drawableMatrices(group, mask);
+    CORRADE_COMPARE(masked.size(), 1);
+    CORRADE_VERIFY(&masked[0].first.get() == &group[1]);
+
+    const std::vector<Camera3D::DrawableWithMatrices>& matrices = camera.drawableMatrices(group);
+    CORRADE_COMPARE(matrices.size(), 2);
+    for(std::size_t i = 0; i != 2; ++i) {
+        const Matrix4 transformation = Matrix4::rotationY(Deg(-15.0f))*group[i].object().transformationMatrix();
+        CORRADE_COMPARE(matrices[i].second.transformationMatrix, transformation);
+        CORRADE_COMPARE(matrices[i].second.projectionTransformationMatrix, camera.projectionMatrix()*transformation);
+        CORRADE_COMPARE(matrices[i].second.normalMatrix, transformation.rotationScaling().inverted().transposed());
+    }
+}
+
+void CameraTest::drawWithMatrices() {
+    class Drawable: public SceneGraph::Drawable3D {
+        public:
+            Drawable(AbstractObject3D& object, DrawableGroup3D* group): SceneGraph::Drawable3D(object, group) {}
+
+            Matrix4 transformation, projectionTransformation;
+
+        protected:
+            void draw(const Matrix4& transformationMatrix, Camera3D&) override {
+                transformation = transformationMatrix;
+            }
+    };
+
+    class MatricesDrawable: public Drawable {
+        public:
+            using Drawable::Drawable;
+
+        protected:
+            void drawWithMatrices(const DrawableMatrices3D& matrices, Camera3D&) override {
+                projectionTransformation = matrices.projectionTransformationMatrix;
+            }
+    };
+
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    Object3D object(&scene);
+    object.translate({0.0f, 0.0f, -4.0f});
+    Drawable* a = new Drawable(object, &group);
+    Drawable* b = new MatricesDrawable(object, &group);
+
+    Camera3D camera(scene);
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(60.0f), 1.0f, 0.1f, 100.0f));
+    CORRADE_VERIFY(!camera.isDrawableMatricesEnabled());
+
+    /* Disabled, calling the classic draw() */
+    camera.draw(group);
+    CORRADE_COMPARE(a->transformation, Matrix4::translation({0.0f, 0.0f, -4.0f}));
+    CORRADE_COMPARE(b->transformation, Matrix4::translation({0.0f, 0.0f, -4.0f}));
+    CORRADE_COMPARE(b->projectionTransformation, Matrix4{});
+
+    /* Enabled, the default implementation delegates to draw() */
+    a->transformation = b->transformation = {};
+    camera.setDrawableMatricesEnabled(true)
+        .draw(group);
+    CORRADE_VERIFY(camera.isDrawableMatricesEnabled());
+    CORRADE_COMPARE(a->transformation, Matrix4::translation({0.0f, 0.0f, -4.0f}));
+    CORRADE_COMPARE(a->projectionTransformation, Matrix4{});
+    CORRADE_COMPARE(b->transformation, Matrix4{});
+    CORRADE_COMPARE(b->projectionTransformation, camera.projectionMatrix()*Matrix4::translation({0.0f, 0.0f, -4.0f}));
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::CameraTest)
@@ -0,0 +1,130 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneGraph/DepthPrepass.hpp"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct DepthPrepassTest: TestSuite::Tester {
+    explicit DepthPrepassTest();
+
+    void stateDepth();
+    void stateShade();
+    void stateShadeDepthFunction();
+    void stateForward();
+
+    void sort();
+    void sortStable();
+    void sortEmpty();
+};
+
+DepthPrepassTest::DepthPrepassTest() {
+    addTests({&DepthPrepassTest::stateDepth,
+              &DepthPrepassTest::stateShade,
+              &DepthPrepassTest::stateShadeDepthFunction,
+              &DepthPrepassTest::stateForward,
+
+              &DepthPrepassTest::sort,
+              &DepthPrepassTest::sortStable,
+              &DepthPrepassTest::sortEmpty});
+}
+
+using Implementation::DepthPrepassPass;
+
+void DepthPrepassTest::stateDepth() {
+    /* Only depth is written in the pre-pass */
+    const Implementation::DepthPrepassState state = Implementation::depthPrepassState(DepthPrepassPass::Depth, Renderer::DepthFunction::Equal);
+    CORRADE_VERIFY(!state.colorMask);
+    CORRADE_VERIFY(state.depthMask);
+    CORRADE_VERIFY(state.depthFunction == Renderer::DepthFunction::Less);
+}
+
+void DepthPrepassTest::stateShade() {
+    /* The depth is already there, only color is written */
+    const Implementation::DepthPrepassState state = Implementation::depthPrepassState(DepthPrepassPass::Shade, Renderer::DepthFunction::Equal);
+    CORRADE_VERIFY(state.colorMask);
+    CORRADE_VERIFY(!state.depthMask);
+    CORRADE_VERIFY(state.depthFunction == Renderer::DepthFunction::Equal);
+}
+
+void DepthPrepassTest::stateShadeDepthFunction() {
+    const Implementation::DepthPrepassState state = Implementation::depthPrepassState(DepthPrepassPass::Shade, Renderer::DepthFunction::LessOrEqual);
+    CORRADE_VERIFY(state.depthFunction == Renderer::DepthFunction::LessOrEqual);
+}
+
+void DepthPrepassTest::stateForward() {
+    /* Usual state, restored after the drawing is done */
+    const Implementation::DepthPrepassState state = Implementation::depthPrepassState(DepthPrepassPass::Forward, Renderer::DepthFunction::Equal);
+    CORRADE_VERIFY(state.colorMask);
+    CORRADE_VERIFY(state.depthMask);
+    CORRADE_VERIFY(state.depthFunction == Renderer::DepthFunction::Less);
+}
+
+void DepthPrepassTest::sort() {
+    /* Camera looks down -Z, so the nearest is the one with largest Z */
+    const std::vector<std::pair<Int, Matrix4>> transformations{
+        {0, Matrix4::translation({0.0f, 0.0f, -10.0f})},
+        {1, Matrix4::translation({5.0f, 0.0f, -1.0f})},
+        {2, Matrix4::translation({0.0f, -3.0f, -5.0f})}
+    };
+
+    std::vector<std::pair<Float, UnsignedInt>> order;
+    Implementation::depthPrepassSort(transformations, order);
+    CORRADE_COMPARE(order.size(), 3);
+    CORRADE_COMPARE(order[0].first, 1.0f);
+    CORRADE_COMPARE(order[0].second, 1);
+    CORRADE_COMPARE(order[1].first, 5.0f);
+    CORRADE_COMPARE(order[1].second, 2);
+    CORRADE_COMPARE(order[2].first, 10.0f);
+    CORRADE_COMPARE(order[2].second, 0);
+}
+
+void DepthPrepassTest::sortStable() {
+    const std::vector<std::pair<Int, Matrix4>> transformations{
+        {0, Matrix4::translation({0.0f, 0.0f, -2.0f})},
+        {1, Matrix4::translation({1.0f, 0.0f, -2.0f})},
+        {2, Matrix4::translation({0.0f, 0.0f, -1.0f})}
+    };
+
+    /* Previous contents are discarded */
+    std::vector<std::pair<Float, UnsignedInt>> order{{0.0f, 7}};
+    Implementation::depthPrepassSort(transformations, order);
+    CORRADE_COMPARE(order.size(), 3);
+    CORRADE_COMPARE(order[0].second, 2);
+    CORRADE_COMPARE(order[1].second, 0);
+    CORRADE_COMPARE(order[2].second, 1);
+}
+
+void DepthPrepassTest::sortEmpty() {
+    std::vector<std::pair<Float, UnsignedInt>> order{{0.0f, 7}};
+    Implementation::depthPrepassSort(std::vector<std::pair<Int, Matrix4>>{}, order);
+    CORRADE_VERIFY(order.empty());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::DepthPrepassTest)
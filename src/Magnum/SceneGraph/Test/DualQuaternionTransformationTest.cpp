@@ -48,6 +48,9 @@ struct DualQuaternionTransformationTest: TestSuite::Tester {
     void translate();
     void rotate();
     void normalizeRotation();
+    void normalizationInterval();
+
+    void transformationMatrices();
 };
 
 DualQuaternionTransformationTest::DualQuaternionTransformationTest() {
@@ -61,7 +64,10 @@ DualQuaternionTransformationTest::DualQuaternionTransformationTest() {
               &DualQuaternionTransformationTest::transform,
               &DualQuaternionTransformationTest::translate,
               &DualQuaternionTransformationTest::rotate,
-              &DualQuaternionTransformationTest::normalizeRotation});
+              &DualQuaternionTransformationTest::normalizeRotation,
+              &DualQuaternionTransformationTest::normalizationInterval,
+
+              &DualQuaternionTransformationTest::transformationMatrices});
 }
 
 void DualQuaternionTransformationTest::fromMatrix() {
@@ -197,6 +203,40 @@ void DualQuaternionTransformationTest::normalizeRotation() {
     CORRADE_COMPARE(o.transformationMatrix(), Matrix4::rotationX(Deg(17.0f)));
 }
 
+void DualQuaternionTransformationTest::normalizationInterval() {
+    Object3D o;
+    CORRADE_COMPARE(o.normalizationInterval(), 0);
+
+    /* Slightly denormalized, but still passing the assertion */
+    o.setNormalizationInterval(3)
+     .setTransformation(DualQuaternion::rotation(Deg(17.0f), Vector3::xAxis())*1.000002f);
+    CORRADE_COMPARE(o.normalizationInterval(), 3);
+
+    /* The length is kept for the first two compositions */
+    o.rotateX(Deg(10.0f))
+     .translate({1.0f, -0.3f, 2.3f});
+    CORRADE_VERIFY(Math::abs(o.transformation().length().real() - 1.0f) > 1.0e-6f);
+
+    /* Third composition renormalizes */
+    o.rotateYLocal(Deg(5.0f));
+    CORRADE_VERIFY(Math::abs(o.transformation().length().real() - 1.0f) < 1.0e-6f);
+    CORRADE_COMPARE(o.transformationMatrix(), Matrix4::translation({1.0f, -0.3f, 2.3f})*Matrix4::rotationX(Deg(27.0f))*Matrix4::rotationY(Deg(5.0f)));
+}
+
+void DualQuaternionTransformationTest::transformationMatrices() {
+    Scene3D s;
+    Object3D a{&s};
+    a.rotateX(Deg(17.0f))
+     .translate({1.0f, -0.3f, 2.3f});
+    Object3D b{&a};
+    b.rotateZ(Deg(-35.0f));
+
+    const std::vector<Matrix4> matrices = s.transformationMatrices({a, b}, Matrix4::translation(Vector3::yAxis()));
+    CORRADE_COMPARE(matrices.size(), 2);
+    CORRADE_COMPARE(matrices[0], Matrix4::translation(Vector3::yAxis())*a.absoluteTransformationMatrix());
+    CORRADE_COMPARE(matrices[1], Matrix4::translation(Vector3::yAxis())*b.absoluteTransformationMatrix());
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::DualQuaternionTransformationTest)
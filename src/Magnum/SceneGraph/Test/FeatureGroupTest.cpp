@@ -0,0 +1,199 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/AbstractGroupedFeature.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct FeatureGroupTest: TestSuite::Tester {
+    explicit FeatureGroupTest();
+
+    void add();
+    void remove();
+    void removeStableOrder();
+    void removeLast();
+    void addToAnotherGroup();
+    void deleteFeature();
+    void deleteGroup();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+
+struct Feature: AbstractGroupedFeature3D<Feature> {
+    explicit Feature(AbstractObject3D& object, FeatureGroup3D<Feature>* group = nullptr): AbstractGroupedFeature3D<Feature>{object, group} {}
+};
+
+typedef FeatureGroup3D<Feature> Group;
+
+FeatureGroupTest::FeatureGroupTest() {
+    addTests({&FeatureGroupTest::add,
+              &FeatureGroupTest::remove,
+              &FeatureGroupTest::removeStableOrder,
+              &FeatureGroupTest::removeLast,
+              &FeatureGroupTest::addToAnotherGroup,
+              &FeatureGroupTest::deleteFeature,
+              &FeatureGroupTest::deleteGroup});
+}
+
+void FeatureGroupTest::add() {
+    Object3D object;
+    Group group;
+    CORRADE_VERIFY(group.isEmpty());
+    CORRADE_VERIFY(!group.isStableOrder());
+
+    Feature a{object, &group};
+    Feature b{object};
+    group.add(b);
+
+    CORRADE_COMPARE(group.size(), 2);
+    CORRADE_VERIFY(&group[0] == &a);
+    CORRADE_VERIFY(&group[1] == &b);
+    CORRADE_VERIFY(a.group() == &group);
+    CORRADE_VERIFY(b.group() == &group);
+}
+
+void FeatureGroupTest::remove() {
+    Object3D object;
+    Group group;
+    Feature a{object, &group};
+    Feature b{object, &group};
+    Feature c{object, &group};
+    Feature d{object, &group};
+
+    /* The last feature takes place of the removed one */
+    group.remove(b);
+    CORRADE_VERIFY(!b.group());
+    CORRADE_COMPARE(group.size(), 3);
+    CORRADE_VERIFY(&group[0] == &a);
+    CORRADE_VERIFY(&group[1] == &d);
+    CORRADE_VERIFY(&group[2] == &c);
+
+    /* The moved feature has its index updated */
+    group.remove(d);
+    CORRADE_COMPARE(group.size(), 2);
+    CORRADE_VERIFY(&group[0] == &a);
+    CORRADE_VERIFY(&group[1] == &c);
+
+    group.remove(a);
+    CORRADE_COMPARE(group.size(), 1);
+    CORRADE_VERIFY(&group[0] == &c);
+}
+
+void FeatureGroupTest::removeStableOrder() {
+    Object3D object;
+    Group group;
+    group.setStableOrder(true);
+    CORRADE_VERIFY(group.isStableOrder());
+
+    Feature a{object, &group};
+    Feature b{object, &group};
+    Feature c{object, &group};
+    Feature d{object, &group};
+
+    group.remove(b);
+    CORRADE_COMPARE(group.size(), 3);
+    CORRADE_VERIFY(&group[0] == &a);
+    CORRADE_VERIFY(&group[1] == &c);
+    CORRADE_VERIFY(&group[2] == &d);
+
+    /* All following features have their indices updated */
+    group.remove(c);
+    CORRADE_COMPARE(group.size(), 2);
+    CORRADE_VERIFY(&group[0] == &a);
+    CORRADE_VERIFY(&group[1] == &d);
+
+    group.remove(a);
+    CORRADE_COMPARE(group.size(), 1);
+    CORRADE_VERIFY(&group[0] == &d);
+}
+
+void FeatureGroupTest::removeLast() {
+    Object3D object;
+    Group group;
+    Feature a{object, &group};
+    Feature b{object, &group};
+
+    group.remove(b).remove(a);
+    CORRADE_VERIFY(group.isEmpty());
+
+    /* Adding again works */
+    group.add(b).add(a);
+    CORRADE_VERIFY(&group[0] == &b);
+    CORRADE_VERIFY(&group[1] == &a);
+    group.remove(b);
+    CORRADE_VERIFY(&group[0] == &a);
+}
+
+void FeatureGroupTest::addToAnotherGroup() {
+    Object3D object;
+    Group group1, group2;
+    Feature a{object, &group1};
+    Feature b{object, &group1};
+    Feature c{object, &group2};
+
+    group2.add(a);
+    CORRADE_VERIFY(a.group() == &group2);
+    CORRADE_COMPARE(group1.size(), 1);
+    CORRADE_VERIFY(&group1[0] == &b);
+    CORRADE_COMPARE(group2.size(), 2);
+    CORRADE_VERIFY(&group2[1] == &a);
+
+    /* Index in the new group is used for removal */
+    group2.remove(c);
+    CORRADE_COMPARE(group2.size(), 1);
+    CORRADE_VERIFY(&group2[0] == &a);
+}
+
+void FeatureGroupTest::deleteFeature() {
+    Object3D object;
+    Group group;
+    Feature a{object, &group};
+    Feature* b = new Feature{object, &group};
+    Feature c{object, &group};
+
+    delete b;
+    CORRADE_COMPARE(group.size(), 2);
+    CORRADE_VERIFY(&group[0] == &a);
+    CORRADE_VERIFY(&group[1] == &c);
+}
+
+void FeatureGroupTest::deleteGroup() {
+    Object3D object;
+    Feature a{object};
+    {
+        Group group;
+        group.add(a);
+    }
+
+    CORRADE_VERIFY(!a.group());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::FeatureGroupTest)
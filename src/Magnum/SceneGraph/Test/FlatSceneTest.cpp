@@ -0,0 +1,115 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/DualQuaternionTransformation.h"
+#include "Magnum/SceneGraph/FlatScene.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/PoolAllocator.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct FlatSceneTest: TestSuite::Tester {
+    explicit FlatSceneTest();
+
+    void instantiate();
+    void instantiateDualQuaternion();
+    void instantiatePooled();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+FlatSceneTest::FlatSceneTest() {
+    addTests({&FlatSceneTest::instantiate,
+              &FlatSceneTest::instantiateDualQuaternion,
+              &FlatSceneTest::instantiatePooled});
+}
+
+namespace {
+    Trade::FlatSceneData3D sceneData() {
+        return Trade::FlatSceneData3D{{2, 0, 4, 3},
+            {-1, 0, 1, -1},
+            {Matrix4::translation(Vector3::xAxis(2.0f)),
+             Matrix4::translation(Vector3::yAxis(3.0f)),
+             Matrix4::rotationZ(Deg(90.0f)),
+             Matrix4::translation(Vector3::zAxis(-1.0f))},
+            {Trade::ObjectInstanceType3D::Empty, Trade::ObjectInstanceType3D::Mesh, Trade::ObjectInstanceType3D::Empty, Trade::ObjectInstanceType3D::Empty},
+            {-1, 0, -1, -1},
+            {-1, -1, -1, -1}};
+    }
+}
+
+void FlatSceneTest::instantiate() {
+    Scene3D scene;
+    Object3D parent{&scene};
+    const Trade::FlatSceneData3D data = sceneData();
+
+    std::vector<Object3D*> objects = instantiateFlatScene(parent, data);
+    CORRADE_COMPARE(objects.size(), 4);
+    CORRADE_VERIFY(objects[0]->parent() == &parent);
+    CORRADE_VERIFY(objects[1]->parent() == objects[0]);
+    CORRADE_VERIFY(objects[2]->parent() == objects[1]);
+    CORRADE_VERIFY(objects[3]->parent() == &parent);
+    CORRADE_COMPARE(objects[1]->transformation(), Matrix4::translation(Vector3::yAxis(3.0f)));
+    CORRADE_COMPARE(objects[2]->absoluteTransformation(), Matrix4::translation({2.0f, 3.0f, 0.0f})*Matrix4::rotationZ(Deg(90.0f)));
+
+    /* Children are in the same order as in the data */
+    CORRADE_VERIFY(parent.children().first() == objects[0]);
+    CORRADE_VERIFY(parent.children().last() == objects[3]);
+
+    for(Object3D* o: {objects[3], objects[0]}) delete o;
+}
+
+void FlatSceneTest::instantiateDualQuaternion() {
+    typedef SceneGraph::Object<SceneGraph::DualQuaternionTransformation> DualQuaternionObject3D;
+    typedef SceneGraph::Scene<SceneGraph::DualQuaternionTransformation> DualQuaternionScene3D;
+
+    DualQuaternionScene3D scene;
+    std::vector<DualQuaternionObject3D*> objects = instantiateFlatScene(scene, sceneData());
+    CORRADE_COMPARE(objects.size(), 4);
+    CORRADE_VERIFY(objects[0]->parent() == &scene);
+    CORRADE_COMPARE(objects[2]->absoluteTransformationMatrix(), Matrix4::translation({2.0f, 3.0f, 0.0f})*Matrix4::rotationZ(Deg(90.0f)));
+}
+
+void FlatSceneTest::instantiatePooled() {
+    PoolAllocator allocator;
+    {
+        Scene3D scene;
+        scene.setPoolAllocator(&allocator);
+
+        std::vector<Object3D*> objects = instantiateFlatScene(scene, sceneData());
+        CORRADE_COMPARE(objects.size(), 4);
+        CORRADE_COMPARE(allocator.allocationCount(), 4);
+
+        scene.destroyChildren();
+        CORRADE_COMPARE(allocator.allocationCount(), 0);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::FlatSceneTest)
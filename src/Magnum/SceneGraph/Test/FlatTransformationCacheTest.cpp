@@ -0,0 +1,282 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/AbstractTaskExecutor.h"
+#include "Magnum/SceneGraph/FlatTransformationCache.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct FlatTransformationCacheTest: TestSuite::Tester {
+    explicit FlatTransformationCacheTest();
+
+    void rebuild();
+    void rebuildOnHierarchyChange();
+    void update();
+
+    void rebuildIslands();
+    void updateParallel();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+typedef SceneGraph::FlatTransformationCache<SceneGraph::MatrixTransformation3D> FlatTransformationCache3D;
+
+class CachingObject: public Object3D, AbstractFeature3D {
+    public:
+        CachingObject(Object3D* parent = nullptr): Object3D(parent), AbstractFeature3D(*this) {
+            setCachedTransformations(CachedTransformation::Absolute);
+        }
+
+        Matrix4 cleanedAbsoluteTransformation;
+
+    protected:
+        void clean(const Matrix4& absoluteTransformation) override {
+            cleanedAbsoluteTransformation = absoluteTransformation;
+        }
+};
+
+/* Runs the tasks in reverse to verify they don't depend on each other */
+class ReverseExecutor: public AbstractTaskExecutor {
+    public:
+        explicit ReverseExecutor(): taskCount{}, running{} {}
+
+        std::size_t taskCount;
+        bool running;
+
+    private:
+        void doExecute(std::size_t count, Task task, void* state) override {
+            running = true;
+            taskCount = count;
+            for(std::size_t i = count; i != 0; --i) task(state, i - 1);
+            running = false;
+        }
+};
+
+class ExecutorCheckingObject: public Object3D, public AbstractFeature3D {
+    public:
+        ExecutorCheckingObject(const ReverseExecutor& executor, Object3D* parent = nullptr): Object3D(parent), AbstractFeature3D(*this), cleanedFromTask{}, _executor(executor) {
+            setCachedTransformations(CachedTransformation::Absolute);
+        }
+
+        using AbstractFeature3D::setCleanThreadSafe;
+
+        Matrix4 cleanedAbsoluteTransformation;
+        bool cleanedFromTask;
+
+    protected:
+        void clean(const Matrix4& absoluteTransformation) override {
+            cleanedAbsoluteTransformation = absoluteTransformation;
+            cleanedFromTask = _executor.running;
+        }
+
+    private:
+        const ReverseExecutor& _executor;
+};
+
+FlatTransformationCacheTest::FlatTransformationCacheTest() {
+    addTests({&FlatTransformationCacheTest::rebuild,
+              &FlatTransformationCacheTest::rebuildOnHierarchyChange,
+              &FlatTransformationCacheTest::update,
+
+              &FlatTransformationCacheTest::rebuildIslands,
+              &FlatTransformationCacheTest::updateParallel});
+}
+
+void FlatTransformationCacheTest::rebuild() {
+    Scene3D scene;
+    Object3D a{&scene};
+    Object3D b{&a};
+    Object3D c{&scene};
+    Object3D d{&a};
+
+    FlatTransformationCache3D cache{scene};
+    CORRADE_VERIFY(cache.isOutdated());
+    CORRADE_COMPARE(cache.size(), 0);
+
+    cache.rebuild();
+    CORRADE_VERIFY(!cache.isOutdated());
+    CORRADE_COMPARE(cache.objects(), (std::vector<Object3D*>{&scene, &a, &b, &d, &c}));
+    CORRADE_COMPARE(cache.parents(), (std::vector<UnsignedInt>{FlatTransformationCache3D::NoParent, 0, 1, 1, 0}));
+}
+
+void FlatTransformationCacheTest::rebuildOnHierarchyChange() {
+    Scene3D scene;
+    Object3D a{&scene};
+
+    FlatTransformationCache3D cache{scene};
+    cache.update();
+    CORRADE_VERIFY(!cache.isOutdated());
+    CORRADE_COMPARE(cache.size(), 2);
+
+    /* Adding an object makes it outdated */
+    UnsignedInt generation = scene.hierarchyGeneration();
+    Object3D* b = new Object3D{&a};
+    CORRADE_VERIFY(scene.hierarchyGeneration() != generation);
+    CORRADE_VERIFY(cache.isOutdated());
+    cache.update();
+    CORRADE_COMPARE(cache.objects(), (std::vector<Object3D*>{&scene, &a, b}));
+
+    /* Reparenting also */
+    b->setParent(&scene);
+    CORRADE_VERIFY(cache.isOutdated());
+    cache.update();
+    CORRADE_COMPARE(cache.parents(), (std::vector<UnsignedInt>{FlatTransformationCache3D::NoParent, 0, 0}));
+
+    /* Transforming doesn't */
+    b->translate(Vector3::xAxis(1.0f));
+    CORRADE_VERIFY(!cache.isOutdated());
+
+    /* Deleting does */
+    delete b;
+    CORRADE_VERIFY(cache.isOutdated());
+    cache.update();
+    CORRADE_COMPARE(cache.objects(), (std::vector<Object3D*>{&scene, &a}));
+
+    /* Changes in objects outside of the scene don't affect it */
+    generation = scene.hierarchyGeneration();
+    Object3D orphan;
+    Object3D orphanChild{&orphan};
+    CORRADE_COMPARE(scene.hierarchyGeneration(), generation);
+    CORRADE_VERIFY(!cache.isOutdated());
+}
+
+void FlatTransformationCacheTest::update() {
+    Scene3D scene;
+    CachingObject a{&scene};
+    a.scale(Vector3(2.0f));
+    CachingObject b{&a};
+    b.translate(Vector3::xAxis(1.0f));
+    CachingObject c{&scene};
+    c.rotateY(Deg(90.0f));
+
+    FlatTransformationCache3D cache{scene};
+    CORRADE_VERIFY(scene.isDirty());
+    CORRADE_VERIFY(a.isDirty());
+    CORRADE_VERIFY(b.isDirty());
+    CORRADE_VERIFY(c.isDirty());
+
+    cache.update();
+    CORRADE_VERIFY(!scene.isDirty());
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_VERIFY(!c.isDirty());
+
+    CORRADE_COMPARE(cache.transformations()[2], Matrix4::translation(Vector3::xAxis(1.0f)));
+    CORRADE_COMPARE(cache.absoluteTransformations()[2], b.absoluteTransformationMatrix());
+    CORRADE_COMPARE(a.cleanedAbsoluteTransformation, a.absoluteTransformationMatrix());
+    CORRADE_COMPARE(b.cleanedAbsoluteTransformation, b.absoluteTransformationMatrix());
+    CORRADE_COMPARE(c.cleanedAbsoluteTransformation, c.absoluteTransformationMatrix());
+
+    /* Clean objects are not cleaned again */
+    a.cleanedAbsoluteTransformation = Matrix4{Math::ZeroInit};
+    b.translate(Vector3::yAxis(1.0f));
+    cache.update();
+    CORRADE_COMPARE(a.cleanedAbsoluteTransformation, Matrix4{Math::ZeroInit});
+    CORRADE_COMPARE(b.cleanedAbsoluteTransformation, b.absoluteTransformationMatrix());
+
+    /* Objects cleaned through the usual API are handled properly */
+    c.translate(Vector3::zAxis(3.0f));
+    c.setClean();
+    cache.update();
+    CORRADE_COMPARE(cache.absoluteTransformations()[3], c.absoluteTransformationMatrix());
+}
+
+void FlatTransformationCacheTest::rebuildIslands() {
+    Scene3D scene;
+    Object3D a{&scene};
+    Object3D b{&a};
+    Object3D c{&b};
+    Object3D d{&a};
+    Object3D e{&scene};
+
+    b.setIsland(true);
+    CORRADE_VERIFY(b.isIsland());
+
+    FlatTransformationCache3D cache{scene};
+    cache.rebuild();
+
+    /* Subtree of the nested island is put after everything else */
+    CORRADE_COMPARE(cache.objects(), (std::vector<Object3D*>{&scene, &a, &d, &e, &b, &c}));
+    CORRADE_COMPARE(cache.parents(), (std::vector<UnsignedInt>{FlatTransformationCache3D::NoParent, 0, 1, 0, 1, 4}));
+    CORRADE_COMPARE(cache.islands(), (std::vector<std::pair<UnsignedInt, UnsignedInt>>{{1, 3}, {3, 4}, {4, 6}}));
+
+    /* Removing the island flag makes the cache outdated */
+    b.setIsland(false);
+    CORRADE_VERIFY(cache.isOutdated());
+    cache.rebuild();
+    CORRADE_COMPARE(cache.objects(), (std::vector<Object3D*>{&scene, &a, &b, &c, &d, &e}));
+    CORRADE_COMPARE(cache.islands(), (std::vector<std::pair<UnsignedInt, UnsignedInt>>{{1, 5}, {5, 6}}));
+}
+
+void FlatTransformationCacheTest::updateParallel() {
+    ReverseExecutor executor;
+
+    Scene3D scene;
+    ExecutorCheckingObject a{executor, &scene};
+    a.scale(Vector3(2.0f));
+    ExecutorCheckingObject b{executor, &a};
+    b.translate(Vector3::xAxis(1.0f))
+     .setIsland(true);
+    ExecutorCheckingObject c{executor, &b};
+    c.rotateY(Deg(90.0f));
+    ExecutorCheckingObject d{executor, &scene};
+    d.translate(Vector3::zAxis(3.0f));
+    d.setCleanThreadSafe(false);
+
+    FlatTransformationCache3D cache{scene};
+    cache.update(executor);
+    CORRADE_COMPARE(executor.taskCount, 3);
+    CORRADE_VERIFY(!scene.isDirty());
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_VERIFY(!c.isDirty());
+    CORRADE_VERIFY(!d.isDirty());
+
+    /* Results are the same as with the serial update */
+    for(std::size_t i = 0; i != cache.size(); ++i)
+        CORRADE_COMPARE(cache.absoluteTransformations()[i], cache.objects()[i]->absoluteTransformationMatrix());
+    CORRADE_COMPARE(c.cleanedAbsoluteTransformation, c.absoluteTransformationMatrix());
+    CORRADE_COMPARE(d.cleanedAbsoluteTransformation, d.absoluteTransformationMatrix());
+
+    /* Thread-unsafe features are cleaned after all tasks finish */
+    CORRADE_VERIFY(a.cleanedFromTask);
+    CORRADE_VERIFY(c.cleanedFromTask);
+    CORRADE_VERIFY(!d.cleanedFromTask);
+
+    /* Clean objects are not cleaned again */
+    a.cleanedAbsoluteTransformation = Matrix4{Math::ZeroInit};
+    c.translate(Vector3::yAxis(1.0f));
+    cache.update(executor);
+    CORRADE_COMPARE(a.cleanedAbsoluteTransformation, Matrix4{Math::ZeroInit});
+    CORRADE_COMPARE(c.cleanedAbsoluteTransformation, c.absoluteTransformationMatrix());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::FlatTransformationCacheTest)
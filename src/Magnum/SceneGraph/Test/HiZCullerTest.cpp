@@ -0,0 +1,152 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneGraph/HiZCuller.hpp"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct HiZCullerTest: TestSuite::Tester {
+    explicit HiZCullerTest();
+
+    void pyramidLevels();
+    void pyramidLevelsOdd();
+    void pyramidEmpty();
+    void occluded();
+    void occludedCoarseLevel();
+    void occludedOutside();
+
+    void projectBox();
+    void projectBoxNearPlane();
+};
+
+HiZCullerTest::HiZCullerTest() {
+    addTests({&HiZCullerTest::pyramidLevels,
+              &HiZCullerTest::pyramidLevelsOdd,
+              &HiZCullerTest::pyramidEmpty,
+              &HiZCullerTest::occluded,
+              &HiZCullerTest::occludedCoarseLevel,
+              &HiZCullerTest::occludedOutside,
+
+              &HiZCullerTest::projectBox,
+              &HiZCullerTest::projectBoxNearPlane});
+}
+
+void HiZCullerTest::pyramidLevels() {
+    Implementation::HiZPyramid pyramid;
+    pyramid.setData({4, 2}, {0.1f, 0.2f, 0.3f, 0.4f,
+                             0.5f, 0.2f, 0.3f, 0.9f});
+
+    CORRADE_COMPARE(pyramid.levelCount(), 3);
+    CORRADE_COMPARE(pyramid.size(1), (Vector2i{2, 1}));
+    CORRADE_COMPARE(pyramid.depth(1, {0, 0}), 0.5f);
+    CORRADE_COMPARE(pyramid.depth(1, {1, 0}), 0.9f);
+    CORRADE_COMPARE(pyramid.size(2), (Vector2i{1, 1}));
+    CORRADE_COMPARE(pyramid.depth(2, {0, 0}), 0.9f);
+}
+
+void HiZCullerTest::pyramidLevelsOdd() {
+    /* The last column is included in the last texel of the next level */
+    Implementation::HiZPyramid pyramid;
+    pyramid.setData({3, 1}, {0.1f, 0.2f, 0.7f});
+
+    CORRADE_COMPARE(pyramid.levelCount(), 2);
+    CORRADE_COMPARE(pyramid.size(1), (Vector2i{1, 1}));
+    CORRADE_COMPARE(pyramid.depth(1, {0, 0}), 0.7f);
+}
+
+void HiZCullerTest::pyramidEmpty() {
+    /* Nothing is culled without data */
+    Implementation::HiZPyramid pyramid;
+    CORRADE_COMPARE(pyramid.levelCount(), 0);
+    CORRADE_VERIFY(!pyramid.isOccluded({{0.2f, 0.2f}, {0.4f, 0.4f}}, 1.0f));
+}
+
+void HiZCullerTest::occluded() {
+    /* Left half near, right half far */
+    Implementation::HiZPyramid pyramid;
+    pyramid.setData({4, 4}, {0.2f, 0.2f, 1.0f, 1.0f,
+                             0.2f, 0.2f, 1.0f, 1.0f,
+                             0.2f, 0.2f, 1.0f, 1.0f,
+                             0.2f, 0.2f, 1.0f, 1.0f});
+
+    CORRADE_VERIFY(pyramid.isOccluded({{0.1f, 0.1f}, {0.4f, 0.9f}}, 0.5f));
+    CORRADE_VERIFY(!pyramid.isOccluded({{0.1f, 0.1f}, {0.4f, 0.9f}}, 0.1f));
+    CORRADE_VERIFY(!pyramid.isOccluded({{0.6f, 0.1f}, {0.9f, 0.9f}}, 0.5f));
+
+    /* Crossing into the far half */
+    CORRADE_VERIFY(!pyramid.isOccluded({{0.1f, 0.1f}, {0.6f, 0.4f}}, 0.5f));
+}
+
+void HiZCullerTest::occludedCoarseLevel() {
+    /* A single far texel makes all coarse texels covering it far, so the
+       test is conservative */
+    std::vector<Float> data(16*16, 0.2f);
+    data[15*16 + 15] = 1.0f;
+    Implementation::HiZPyramid pyramid;
+    pyramid.setData({16, 16}, std::move(data));
+
+    CORRADE_COMPARE(pyramid.levelCount(), 5);
+    CORRADE_VERIFY(pyramid.isOccluded({{0.0f, 0.0f}, {0.5f, 0.5f}}, 0.5f));
+    CORRADE_VERIFY(pyramid.isOccluded({{0.0f, 0.0f}, {0.9f, 0.4f}}, 0.5f));
+    CORRADE_VERIFY(!pyramid.isOccluded({{0.0f, 0.0f}, {0.9f, 0.9f}}, 0.5f));
+    CORRADE_VERIFY(!pyramid.isOccluded({{0.0f, 0.0f}, {1.0f, 1.0f}}, 0.5f));
+}
+
+void HiZCullerTest::occludedOutside() {
+    /* Areas outside of the pyramid are unknown */
+    Implementation::HiZPyramid pyramid;
+    pyramid.setData({2, 2}, {0.2f, 0.2f,
+                             0.2f, 0.2f});
+
+    CORRADE_VERIFY(pyramid.isOccluded({{0.0f, 0.0f}, {1.0f, 1.0f}}, 0.5f));
+    CORRADE_VERIFY(!pyramid.isOccluded({{-0.1f, 0.0f}, {0.5f, 0.5f}}, 0.5f));
+    CORRADE_VERIFY(!pyramid.isOccluded({{0.5f, 0.5f}, {1.0f, 1.1f}}, 0.5f));
+}
+
+void HiZCullerTest::projectBox() {
+    const Matrix4 projection = Matrix4::orthographicProjection({4.0f, 4.0f}, 1.0f, 11.0f);
+
+    Range2D rectangle;
+    Float depth;
+    CORRADE_VERIFY(Implementation::hiZProjectBox(projection*Matrix4::translation({1.0f, 0.0f, -6.0f}), rectangle, depth));
+    CORRADE_COMPARE(rectangle.min(), (Vector2{0.5f, 0.25f}));
+    CORRADE_COMPARE(rectangle.max(), (Vector2{1.0f, 0.75f}));
+    CORRADE_COMPARE(depth, 0.4f);
+}
+
+void HiZCullerTest::projectBoxNearPlane() {
+    const Matrix4 projection = Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.5f, 100.0f);
+
+    Range2D rectangle;
+    Float depth;
+    CORRADE_VERIFY(Implementation::hiZProjectBox(projection*Matrix4::translation({0.0f, 0.0f, -5.0f}), rectangle, depth));
+    CORRADE_VERIFY(!Implementation::hiZProjectBox(projection*Matrix4::translation({0.0f, 0.0f, -1.0f}), rectangle, depth));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::HiZCullerTest)
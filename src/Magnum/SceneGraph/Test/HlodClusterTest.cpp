@@ -0,0 +1,129 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/HlodCluster.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct HlodClusterTest: TestSuite::Tester {
+    explicit HlodClusterTest();
+
+    void empty();
+    void clusters();
+    void bounds();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+HlodClusterTest::HlodClusterTest() {
+    addTests({&HlodClusterTest::empty,
+              &HlodClusterTest::clusters,
+              &HlodClusterTest::bounds});
+}
+
+namespace {
+    struct Drawable: SceneGraph::Drawable3D {
+        explicit Drawable(AbstractObject3D& object, DrawableGroup3D& group): SceneGraph::Drawable3D{object, &group} {}
+
+        void draw(const Matrix4&, Camera3D&) override {}
+    };
+}
+
+void HlodClusterTest::empty() {
+    Scene3D scene;
+    DrawableGroup3D group;
+    CORRADE_VERIFY(hlodClusters(scene, group, 10.0f).empty());
+}
+
+void HlodClusterTest::clusters() {
+    Scene3D scene;
+    Object3D city{&scene};
+    city.translate(Vector3::xAxis(100.0f));
+    Object3D a{&city}, b{&city}, c{&a}, d{&city}, outside{&scene};
+    a.translate({12.0f, 1.0f, 1.0f});
+    b.translate({-5.0f, 1.0f, 1.0f});
+    c.translate({3.0f, 0.0f, 0.0f});
+    d.translate({2.0f, 3.0f, 4.0f});
+
+    DrawableGroup3D group;
+    Drawable da{a, group};
+    Drawable db{b, group};
+    Drawable dc{c, group};
+    Drawable dOutside{outside, group};
+    Drawable dd{d, group};
+
+    const std::vector<HlodCluster3D> clusters = hlodClusters(city, group, 10.0f);
+    CORRADE_COMPARE(clusters.size(), 3);
+
+    /* Ordered by cell, not by group order */
+    CORRADE_COMPARE(clusters[0].drawables.size(), 1);
+    CORRADE_VERIFY(&clusters[0].drawables[0].first.get() == &db);
+
+    CORRADE_COMPARE(clusters[1].drawables.size(), 1);
+    CORRADE_VERIFY(&clusters[1].drawables[0].first.get() == &dd);
+    /* Relative to the city root */
+    CORRADE_COMPARE(clusters[1].drawables[0].second, Matrix4::translation({2.0f, 3.0f, 4.0f}));
+
+    /* In group order */
+    CORRADE_COMPARE(clusters[2].drawables.size(), 2);
+    CORRADE_VERIFY(&clusters[2].drawables[0].first.get() == &da);
+    CORRADE_VERIFY(&clusters[2].drawables[1].first.get() == &dc);
+    CORRADE_COMPARE(clusters[2].drawables[1].second, Matrix4::translation({15.0f, 1.0f, 1.0f}));
+
+    /* No bounding volumes, so the bounds enclose the origins */
+    CORRADE_COMPARE(clusters[2].bounds.min(), (Vector3{12.0f, 1.0f, 1.0f}));
+    CORRADE_COMPARE(clusters[2].bounds.max(), (Vector3{15.0f, 1.0f, 1.0f}));
+}
+
+void HlodClusterTest::bounds() {
+    Scene3D scene;
+    Object3D a{&scene}, b{&scene};
+    a.rotateZ(Deg(90.0f))
+     .translate({2.0f, 2.0f, 2.0f});
+    b.scale(Vector3{2.0f})
+     .translate({8.0f, 8.0f, 8.0f});
+
+    DrawableGroup3D group;
+    Drawable da{a, group};
+    da.setBoundingBox({{0.0f, -1.0f, -1.0f}, {2.0f, 1.0f, 1.0f}});
+    Drawable db{b, group};
+    db.setBoundingSphere({}, 0.5f);
+
+    /* Both centers are in the same cell, the bounds extend past it */
+    const std::vector<HlodCluster3D> clusters = hlodClusters(scene, group, 10.0f);
+    CORRADE_COMPARE(clusters.size(), 1);
+    CORRADE_COMPARE(clusters[0].drawables.size(), 2);
+    CORRADE_COMPARE(clusters[0].bounds.min(), (Vector3{1.0f, 2.0f, 1.0f}));
+    CORRADE_COMPARE(clusters[0].bounds.max(), (Vector3{9.0f, 9.0f, 9.0f}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::HlodClusterTest)
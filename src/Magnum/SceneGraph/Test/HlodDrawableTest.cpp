@@ -0,0 +1,155 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/HlodDrawable.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct HlodDrawableTest: TestSuite::Tester {
+    explicit HlodDrawableTest();
+
+    void distance();
+    void distanceScaled();
+    void distanceNoBoundingVolume();
+    void draw();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+HlodDrawableTest::HlodDrawableTest() {
+    addTests({&HlodDrawableTest::distance,
+              &HlodDrawableTest::distanceScaled,
+              &HlodDrawableTest::distanceNoBoundingVolume,
+              &HlodDrawableTest::draw});
+}
+
+namespace {
+
+struct ProxyDrawable: HlodDrawable3D {
+    explicit ProxyDrawable(AbstractObject3D& object, DrawableGroup3D* group = nullptr): HlodDrawable3D{object, group} {}
+
+    Int proxyDrawn = 0;
+
+    private:
+        void drawProxy(const Matrix4&, Camera3D&) override {
+            ++proxyDrawn;
+        }
+};
+
+struct OriginalDrawable: Drawable3D {
+    explicit OriginalDrawable(AbstractObject3D& object): Drawable3D{object} {}
+
+    Int drawn = 0;
+    Matrix4 transformationMatrix;
+
+    void draw(const Matrix4& transformationMatrix, Camera3D&) override {
+        ++drawn;
+        this->transformationMatrix = transformationMatrix;
+    }
+};
+
+}
+
+void HlodDrawableTest::distance() {
+    Scene3D scene;
+    ProxyDrawable a{scene};
+    a.setBoundingSphere({}, 1.0f);
+
+    CORRADE_COMPARE(a.distance(Matrix4::translation(Vector3::zAxis(-10.0f))), 9.0f);
+
+    /* Box is enclosed in a sphere */
+    a.setBoundingBox({{-3.0f, -4.0f, -1.0f}, {3.0f, 4.0f, 1.0f}});
+    CORRADE_COMPARE(a.distance(Matrix4::translation(Vector3::zAxis(-10.0f))), 10.0f - Math::sqrt(26.0f));
+
+    /* Camera inside */
+    CORRADE_COMPARE(a.distance(Matrix4::translation(Vector3::zAxis(-1.0f))), 0.0f);
+}
+
+void HlodDrawableTest::distanceScaled() {
+    Scene3D scene;
+    ProxyDrawable a{scene};
+    a.setBoundingSphere(Vector3::xAxis(1.0f), 1.0f);
+
+    /* The largest scaling is used, center is transformed */
+    CORRADE_COMPARE(a.distance(Matrix4::translation(Vector3::zAxis(-20.0f))*Matrix4::scaling({1.0f, 2.0f, 1.0f})), 18.0f + Math::sqrt(401.0f) - 20.0f);
+    CORRADE_COMPARE(a.distance(Matrix4::translation(Vector3::zAxis(-20.0f))*Matrix4::rotationY(Deg(90.0f))), 20.0f);
+}
+
+void HlodDrawableTest::distanceNoBoundingVolume() {
+    Scene3D scene;
+    ProxyDrawable a{scene};
+
+    CORRADE_COMPARE(a.distance(Matrix4::translation({0.0f, 3.0f, -4.0f})), 5.0f);
+}
+
+void HlodDrawableTest::draw() {
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    cameraObject.translate(Vector3::zAxis(5.0f));
+    Camera3D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f));
+
+    Object3D cluster{&scene};
+    cluster.translate(Vector3::zAxis(-10.0f));
+    Object3D a{&cluster}, b{&cluster};
+    a.translate(Vector3::xAxis(1.0f));
+    b.translate(Vector3::xAxis(-1.0f));
+
+    DrawableGroup3D drawables;
+    ProxyDrawable proxy{cluster, &drawables};
+    proxy.setBoundingSphere({}, 2.0f);
+    OriginalDrawable da{a}, db{b};
+    proxy.addOriginal(da)
+         .addOriginal(db);
+    CORRADE_COMPARE(proxy.originals().size(), 2);
+    CORRADE_COMPARE(proxy.switchDistance(), 0.0f);
+
+    /* Far enough, the proxy is drawn */
+    proxy.setSwitchDistance(13.0f);
+    CORRADE_COMPARE(proxy.switchDistance(), 13.0f);
+    camera.draw(drawables);
+    CORRADE_COMPARE(proxy.proxyDrawn, 1);
+    CORRADE_COMPARE(da.drawn, 0);
+    CORRADE_COMPARE(db.drawn, 0);
+
+    /* Close, the originals are drawn instead */
+    proxy.setSwitchDistance(13.5f);
+    camera.draw(drawables);
+    CORRADE_COMPARE(proxy.proxyDrawn, 1);
+    CORRADE_COMPARE(da.drawn, 1);
+    CORRADE_COMPARE(db.drawn, 1);
+    CORRADE_COMPARE(da.transformationMatrix, Matrix4::translation({1.0f, 0.0f, -15.0f}));
+    CORRADE_COMPARE(db.transformationMatrix, Matrix4::translation({-1.0f, 0.0f, -15.0f}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::HlodDrawableTest)
@@ -0,0 +1,128 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/InstanceCollector.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct InstanceCollectorTest: TestSuite::Tester {
+    explicit InstanceCollectorTest();
+
+    void collect();
+    void collectEmpty();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+InstanceCollectorTest::InstanceCollectorTest() {
+    addTests({&InstanceCollectorTest::collect,
+              &InstanceCollectorTest::collectEmpty});
+}
+
+namespace {
+
+class NullDrawable: public Object3D, public Drawable3D {
+    public:
+        explicit NullDrawable(Object3D& parent, DrawableGroup3D& group): Object3D{&parent}, Drawable3D{*this, &group} {}
+
+    private:
+        void draw(const Matrix4&, Camera3D&) override {}
+};
+
+}
+
+void InstanceCollectorTest::collect() {
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    cameraObject.translate(Vector3::zAxis(10.0f));
+    Camera3D camera{cameraObject};
+
+    DrawableGroup3D drawables;
+    NullDrawable a{scene, drawables};
+    a.translate(Vector3::xAxis(1.0f));
+    a.setDrawState({1, 0, 1});
+    NullDrawable b{scene, drawables};
+    b.translate(Vector3::xAxis(2.0f));
+    b.setDrawState({1, 0, 2});
+    NullDrawable c{scene, drawables};
+    c.translate(Vector3::xAxis(3.0f));
+    c.setDrawState({1, 0, 1});
+    /* Unknown mesh, not batched together */
+    NullDrawable d{scene, drawables};
+    d.translate(Vector3::xAxis(4.0f));
+    d.setDrawState({1, 0, 0});
+    NullDrawable e{scene, drawables};
+    e.translate(Vector3::xAxis(5.0f));
+    e.setDrawState({1, 0, 0});
+
+    InstanceCollector3D collector;
+    collector.collect(camera, drawables);
+
+    CORRADE_COMPARE(collector.batches().size(), 4);
+    CORRADE_VERIFY(collector.batches()[0].drawable == &d);
+    CORRADE_COMPARE(collector.batches()[0].offset, 0);
+    CORRADE_COMPARE(collector.batches()[0].count, 1);
+    CORRADE_VERIFY(collector.batches()[1].drawable == &e);
+    CORRADE_COMPARE(collector.batches()[1].offset, 1);
+    CORRADE_COMPARE(collector.batches()[1].count, 1);
+    CORRADE_VERIFY(collector.batches()[2].drawable == &a);
+    CORRADE_VERIFY(collector.batches()[2].state == (DrawState{1, 0, 1}));
+    CORRADE_COMPARE(collector.batches()[2].offset, 2);
+    CORRADE_COMPARE(collector.batches()[2].count, 2);
+    CORRADE_VERIFY(collector.batches()[3].drawable == &b);
+    CORRADE_COMPARE(collector.batches()[3].offset, 4);
+    CORRADE_COMPARE(collector.batches()[3].count, 1);
+
+    /* Transformations are relative to the camera */
+    CORRADE_COMPARE(collector.transformations(), (std::vector<Matrix4>{
+        Matrix4::translation({4.0f, 0.0f, -10.0f}),
+        Matrix4::translation({5.0f, 0.0f, -10.0f}),
+        Matrix4::translation({1.0f, 0.0f, -10.0f}),
+        Matrix4::translation({3.0f, 0.0f, -10.0f}),
+        Matrix4::translation({2.0f, 0.0f, -10.0f})}));
+}
+
+void InstanceCollectorTest::collectEmpty() {
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    DrawableGroup3D drawables;
+
+    InstanceCollector3D collector;
+    collector.collect(camera, drawables);
+    CORRADE_VERIFY(collector.batches().empty());
+    CORRADE_VERIFY(collector.transformations().empty());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::InstanceCollectorTest)
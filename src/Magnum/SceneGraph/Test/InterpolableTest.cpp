@@ -0,0 +1,160 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Constants.h"
+#include "Magnum/SceneGraph/Interpolable.h"
+#include "Magnum/SceneGraph/MatrixTransformation2D.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct InterpolableTest: TestSuite::Tester {
+    explicit InterpolableTest();
+
+    void notCaptured();
+    void translation();
+    void rotation2D();
+    void rotation3D();
+    void rotation3DShortestPath();
+    void scaling();
+    void group();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation2D> Object2D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation2D> Scene2D;
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+InterpolableTest::InterpolableTest() {
+    addTests({&InterpolableTest::notCaptured,
+              &InterpolableTest::translation,
+              &InterpolableTest::rotation2D,
+              &InterpolableTest::rotation3D,
+              &InterpolableTest::rotation3DShortestPath,
+              &InterpolableTest::scaling,
+              &InterpolableTest::group});
+}
+
+void InterpolableTest::notCaptured() {
+    Scene3D scene;
+    Object3D object{&scene};
+    object.translate({1.0f, 2.0f, 3.0f});
+    Interpolable3D interpolable{object};
+
+    CORRADE_VERIFY(!interpolable.isCaptured());
+    CORRADE_COMPARE(interpolable.transformationMatrix(0.0f), Matrix4::translation({1.0f, 2.0f, 3.0f}));
+}
+
+void InterpolableTest::translation() {
+    Scene3D scene;
+    Object3D parent{&scene};
+    parent.translate({0.0f, 10.0f, 0.0f});
+    Object3D object{&parent};
+    Interpolable3D interpolable{object};
+
+    interpolable.capture();
+    CORRADE_VERIFY(interpolable.isCaptured());
+    CORRADE_COMPARE(interpolable.previousTransformationMatrix(), Matrix4::translation({0.0f, 10.0f, 0.0f}));
+
+    object.translate({4.0f, 0.0f, -2.0f});
+    CORRADE_COMPARE(interpolable.transformationMatrix(0.0f), Matrix4::translation({0.0f, 10.0f, 0.0f}));
+    CORRADE_COMPARE(interpolable.transformationMatrix(0.25f), Matrix4::translation({1.0f, 10.0f, -0.5f}));
+    CORRADE_COMPARE(interpolable.transformationMatrix(1.0f), Matrix4::translation({4.0f, 10.0f, -2.0f}));
+}
+
+void InterpolableTest::rotation2D() {
+    Scene2D scene;
+    Object2D object{&scene};
+    object.rotate(Deg(170.0f));
+    Interpolable2D interpolable{object};
+    interpolable.capture();
+
+    /* Rotating by 20 degrees crosses the 180 degree boundary, the
+       interpolation should still go along the shortest path */
+    object.rotate(Deg(20.0f))
+        .translate({2.0f, 0.0f});
+    CORRADE_COMPARE(interpolable.transformationMatrix(0.5f),
+        Matrix3::translation({1.0f, 0.0f})*Matrix3::rotation(Deg(180.0f)));
+}
+
+void InterpolableTest::rotation3D() {
+    Scene3D scene;
+    Object3D object{&scene};
+    Interpolable3D interpolable{object};
+    interpolable.capture();
+
+    object.rotateY(Deg(90.0f));
+    CORRADE_COMPARE(interpolable.transformationMatrix(0.5f), Matrix4::rotationY(Deg(45.0f)));
+}
+
+void InterpolableTest::rotation3DShortestPath() {
+    Scene3D scene;
+    Object3D object{&scene};
+    object.rotateX(Deg(-170.0f));
+    Interpolable3D interpolable{object};
+    interpolable.capture();
+
+    object.rotateX(Deg(-20.0f));
+    CORRADE_COMPARE(interpolable.transformationMatrix(0.5f), Matrix4::rotationX(Deg(180.0f)));
+}
+
+void InterpolableTest::scaling() {
+    Scene3D scene;
+    Object3D object{&scene};
+    object.scale({1.0f, 2.0f, -1.0f});
+    Interpolable3D interpolable{object};
+    interpolable.capture();
+
+    object.scale({3.0f, 2.0f, 2.0f});
+    CORRADE_COMPARE(interpolable.transformationMatrix(0.5f), Matrix4::scaling({2.0f, 3.0f, -1.5f}));
+}
+
+void InterpolableTest::group() {
+    Scene2D scene;
+    Object2D a{&scene};
+    Object2D b{&scene};
+    InterpolableGroup2D group;
+    Interpolable2D interpolableA{a, &group};
+    Interpolable2D interpolableB{b, &group};
+    CORRADE_COMPARE(group.size(), 2);
+
+    a.translate({2.0f, 0.0f});
+    b.translate({0.0f, 4.0f});
+    group.capture();
+    CORRADE_VERIFY(interpolableA.isCaptured());
+    CORRADE_VERIFY(interpolableB.isCaptured());
+
+    a.translate({2.0f, 0.0f});
+    b.translate({0.0f, 4.0f});
+    CORRADE_COMPARE(interpolableA.transformationMatrix(0.5f), Matrix3::translation({3.0f, 0.0f}));
+    CORRADE_COMPARE(interpolableB.transformationMatrix(0.5f), Matrix3::translation({0.0f, 6.0f}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::InterpolableTest)
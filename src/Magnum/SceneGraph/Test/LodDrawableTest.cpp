@@ -0,0 +1,188 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Constants.h"
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/LodDrawable.h"
+#include "Magnum/SceneGraph/MatrixTransformation2D.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct LodDrawableTest: TestSuite::Tester {
+    explicit LodDrawableTest();
+
+    void projectedSize();
+    void projectedSizeScaled();
+    void projectedSizeNoBoundingVolume();
+    void projectedSizeOrthographic2D();
+    void lod();
+    void draw();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation2D> Object2D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation2D> Scene2D;
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+LodDrawableTest::LodDrawableTest() {
+    addTests({&LodDrawableTest::projectedSize,
+              &LodDrawableTest::projectedSizeScaled,
+              &LodDrawableTest::projectedSizeNoBoundingVolume,
+              &LodDrawableTest::projectedSizeOrthographic2D,
+              &LodDrawableTest::lod,
+              &LodDrawableTest::draw});
+}
+
+namespace {
+
+template<UnsignedInt dimensions, class Transformation> class NullLodDrawable: public Object<Transformation>, public LodDrawable<dimensions, Float> {
+    public:
+        explicit NullLodDrawable(Object<Transformation>& parent, DrawableGroup<dimensions, Float>& group): Object<Transformation>{&parent}, LodDrawable<dimensions, Float>{*this, &group} {}
+
+        UnsignedInt drawnLod = ~UnsignedInt{};
+
+    private:
+        void drawLod(const MatrixTypeFor<dimensions, Float>&, Camera<dimensions, Float>&, UnsignedInt lod) override {
+            drawnLod = lod;
+        }
+};
+
+typedef NullLodDrawable<2, MatrixTransformation2D> NullLodDrawable2D;
+typedef NullLodDrawable<3, MatrixTransformation3D> NullLodDrawable3D;
+
+}
+
+void LodDrawableTest::projectedSize() {
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    /* Perspective projection with 90° FoV has [1][1] equal to 1 */
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f));
+
+    DrawableGroup3D drawables;
+    NullLodDrawable3D a{scene, drawables};
+    a.setBoundingSphere({}, 1.0f);
+
+    CORRADE_COMPARE(a.projectedSize(Matrix4::translation(Vector3::zAxis(-10.0f)), camera), 0.1f);
+    CORRADE_COMPARE(a.projectedSize(Matrix4::translation(Vector3::zAxis(-2.0f)), camera), 0.5f);
+
+    /* Box is enclosed in a sphere */
+    a.setBoundingBox({Vector3{-1.0f}, Vector3{1.0f}});
+    CORRADE_COMPARE(a.projectedSize(Matrix4::translation(Vector3::zAxis(-10.0f)), camera), 0.1f*Constants::sqrt3());
+}
+
+void LodDrawableTest::projectedSizeScaled() {
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f));
+
+    DrawableGroup3D drawables;
+    NullLodDrawable3D a{scene, drawables};
+    a.setBoundingSphere(Vector3::xAxis(1.0f), 1.0f);
+
+    /* The largest scaling is used, center is transformed */
+    CORRADE_COMPARE(a.projectedSize(Matrix4::translation(Vector3::zAxis(-20.0f))*Matrix4::scaling({1.0f, 2.0f, 1.0f}), camera), 0.1f);
+    CORRADE_COMPARE(a.projectedSize(Matrix4::translation(Vector3::zAxis(-20.0f))*Matrix4::rotationY(Deg(90.0f)), camera), 1.0f/21.0f);
+}
+
+void LodDrawableTest::projectedSizeNoBoundingVolume() {
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f));
+
+    DrawableGroup3D drawables;
+    NullLodDrawable3D a{scene, drawables};
+    a.setLodThresholds({0.5f});
+
+    CORRADE_VERIFY(a.projectedSize(Matrix4::translation(Vector3::zAxis(-50.0f)), camera) == Constants::inf());
+    CORRADE_COMPARE(a.lod(Matrix4::translation(Vector3::zAxis(-50.0f)), camera), 0);
+}
+
+void LodDrawableTest::projectedSizeOrthographic2D() {
+    Scene2D scene;
+    Object2D cameraObject{&scene};
+    Camera2D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix3::projection({8.0f, 4.0f}));
+
+    DrawableGroup2D drawables;
+    NullLodDrawable2D a{scene, drawables};
+    a.setBoundingSphere({}, 1.0f);
+
+    /* Doesn't depend on the position */
+    CORRADE_COMPARE(a.projectedSize(Matrix3::translation({1.0f, 1.0f}), camera), 0.5f);
+    CORRADE_COMPARE(a.projectedSize(Matrix3::translation({-3.0f, 0.0f}), camera), 0.5f);
+}
+
+void LodDrawableTest::lod() {
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f));
+
+    DrawableGroup3D drawables;
+    NullLodDrawable3D a{scene, drawables};
+    a.setBoundingSphere({}, 1.0f);
+
+    /* No thresholds, always the first level */
+    CORRADE_COMPARE(a.lod(Matrix4::translation(Vector3::zAxis(-50.0f)), camera), 0);
+
+    a.setLodThresholds({0.5f, 0.2f, 0.05f});
+    CORRADE_COMPARE(a.lodThresholds(), (std::vector<Float>{0.5f, 0.2f, 0.05f}));
+    CORRADE_COMPARE(a.lod(Matrix4::translation(Vector3::zAxis(-1.5f)), camera), 0);
+    CORRADE_COMPARE(a.lod(Matrix4::translation(Vector3::zAxis(-4.0f)), camera), 1);
+    CORRADE_COMPARE(a.lod(Matrix4::translation(Vector3::zAxis(-10.0f)), camera), 2);
+    CORRADE_COMPARE(a.lod(Matrix4::translation(Vector3::zAxis(-40.0f)), camera), 3);
+}
+
+void LodDrawableTest::draw() {
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f));
+
+    DrawableGroup3D drawables;
+    NullLodDrawable3D a{scene, drawables};
+    a.setBoundingSphere({}, 1.0f);
+    a.setLodThresholds({0.5f, 0.2f, 0.05f});
+    a.translate(Vector3::zAxis(-10.0f));
+    NullLodDrawable3D b{scene, drawables};
+    b.setBoundingSphere({}, 1.0f);
+    b.setLodThresholds({0.5f, 0.2f, 0.05f});
+    b.translate(Vector3::zAxis(-1.5f));
+
+    camera.draw(drawables);
+    CORRADE_COMPARE(a.drawnLod, 2);
+    CORRADE_COMPARE(b.drawnLod, 0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::LodDrawableTest)
@@ -0,0 +1,157 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct ObjectBenchmark: TestSuite::Tester {
+    explicit ObjectBenchmark();
+
+    void absoluteTransformationMatrix();
+    void transformationMatrices();
+    void transformationsDeep();
+    void setClean();
+    void cameraDraw();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+namespace {
+    /* Each benchmark works on a hierarchy of 16k objects where each object
+       has four children, i.e. about seven levels deep */
+    constexpr std::size_t ObjectCount = 16*1024;
+
+    std::vector<std::reference_wrapper<Object3D>> hierarchy(Scene3D& scene) {
+        std::vector<std::reference_wrapper<Object3D>> objects;
+        objects.reserve(ObjectCount);
+        objects.push_back(*new Object3D{&scene});
+        for(std::size_t i = 1; i != ObjectCount; ++i) {
+            Object3D* object = new Object3D{&objects[(i - 1)/4].get()};
+            object->translate({1.0f, 0.0f, 0.0f})
+                .rotateY(Deg(Float(i%360)));
+            objects.push_back(*object);
+        }
+        return objects;
+    }
+
+    class NoopDrawable: public Drawable3D {
+        public:
+            explicit NoopDrawable(Object3D& object, DrawableGroup3D& group, std::size_t& counter): Drawable3D{object, &group}, _counter(counter) {}
+
+        private:
+            void draw(const Matrix4&, Camera3D&) override { ++_counter; }
+
+            std::size_t& _counter;
+    };
+}
+
+ObjectBenchmark::ObjectBenchmark() {
+    addBenchmarks({&ObjectBenchmark::absoluteTransformationMatrix,
+                   &ObjectBenchmark::transformationMatrices,
+                   &ObjectBenchmark::transformationsDeep,
+                   &ObjectBenchmark::setClean,
+                   &ObjectBenchmark::cameraDraw}, 5, BenchmarkType::WallClock);
+}
+
+void ObjectBenchmark::absoluteTransformationMatrix() {
+    Scene3D scene;
+    const std::vector<std::reference_wrapper<Object3D>> objects = hierarchy(scene);
+
+    /* Naive approach walking up the hierarchy separately for each object */
+    Matrix4 sum{Math::ZeroInit};
+    CORRADE_BENCHMARK(1)
+        for(Object3D& object: objects)
+            sum += object.absoluteTransformationMatrix();
+    CORRADE_VERIFY(sum[3][3] > 0.0f);
+}
+
+void ObjectBenchmark::transformationMatrices() {
+    Scene3D scene;
+    const std::vector<std::reference_wrapper<Object3D>> objects = hierarchy(scene);
+
+    /* Batch computation reusing transformations of shared parents */
+    std::vector<Matrix4> matrices;
+    CORRADE_BENCHMARK(1)
+        matrices = scene.transformationMatrices(objects);
+    CORRADE_COMPARE(matrices.size(), ObjectCount);
+}
+
+void ObjectBenchmark::transformationsDeep() {
+    Scene3D scene;
+
+    /* A single chain 1k objects long */
+    std::vector<std::reference_wrapper<Object3D>> objects;
+    Object3D* parent = new Object3D{&scene};
+    objects.push_back(*parent);
+    for(std::size_t i = 1; i != 1024; ++i) {
+        parent = new Object3D{parent};
+        parent->translate({0.0f, 0.001f, 0.0f});
+        objects.push_back(*parent);
+    }
+
+    std::vector<Matrix4> matrices;
+    CORRADE_BENCHMARK(10)
+        matrices = scene.transformationMatrices(objects);
+    CORRADE_COMPARE(matrices.size(), 1024);
+}
+
+void ObjectBenchmark::setClean() {
+    Scene3D scene;
+    const std::vector<std::reference_wrapper<Object3D>> objects = hierarchy(scene);
+
+    CORRADE_BENCHMARK(1) {
+        /* Dirty the whole hierarchy and clean it again in one batch */
+        objects[0].get().setDirty();
+        Object3D::setClean(objects);
+    }
+    CORRADE_VERIFY(!objects.back().get().isDirty());
+}
+
+void ObjectBenchmark::cameraDraw() {
+    Scene3D scene;
+    const std::vector<std::reference_wrapper<Object3D>> objects = hierarchy(scene);
+
+    DrawableGroup3D group;
+    std::size_t counter{};
+    for(Object3D& object: objects)
+        new NoopDrawable{object, group, counter};
+
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    CORRADE_BENCHMARK(1)
+        camera.draw(group);
+    CORRADE_COMPARE(counter, ObjectCount);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::ObjectBenchmark)
@@ -27,6 +27,7 @@
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/PoolAllocator.h"
 #include "Magnum/SceneGraph/Scene.h"
 
 namespace Magnum { namespace SceneGraph { namespace Test {
@@ -38,6 +39,10 @@ struct ObjectTest: TestSuite::Tester {
 
     void parenting();
     void addChild();
+    void addChildPooled();
+    void addFeaturePooled();
+    void destroy();
+    void destroyChildren();
     void scene();
     void setParentKeepTransformation();
     void absoluteTransformation();
@@ -45,6 +50,7 @@ struct ObjectTest: TestSuite::Tester {
     void transformationsRelative();
     void transformationsOrphan();
     void transformationsDuplicate();
+    void transformationMatricesInto();
     void setClean();
     void setCleanListHierarchy();
     void setCleanListBulk();
@@ -70,11 +76,20 @@ class CachingObject: public Object3D, AbstractFeature3D {
         }
 };
 
+class EmptyFeature: public AbstractFeature3D {
+    public:
+        explicit EmptyFeature(AbstractObject3D& object): AbstractFeature3D{object} {}
+};
+
 ObjectTest::ObjectTest() {
     addTests({&ObjectTest::addFeature,
 
               &ObjectTest::parenting,
               &ObjectTest::addChild,
+              &ObjectTest::addChildPooled,
+              &ObjectTest::addFeaturePooled,
+              &ObjectTest::destroy,
+              &ObjectTest::destroyChildren,
               &ObjectTest::scene,
               &ObjectTest::setParentKeepTransformation,
               &ObjectTest::absoluteTransformation,
@@ -82,6 +97,7 @@ ObjectTest::ObjectTest() {
               &ObjectTest::transformationsRelative,
               &ObjectTest::transformationsOrphan,
               &ObjectTest::transformationsDuplicate,
+              &ObjectTest::transformationMatricesInto,
               &ObjectTest::setClean,
               &ObjectTest::setCleanListHierarchy,
               &ObjectTest::setCleanListBulk,
@@ -146,6 +162,118 @@ void ObjectTest::addChild() {
     CORRADE_COMPARE(p.parent(), &o);
 }
 
+void ObjectTest::addChildPooled() {
+    class MyObject: public Object3D {
+        public:
+            explicit MyObject(Int* destructed, Object3D* parent = nullptr): Object3D{parent}, _destructed(destructed) {}
+            ~MyObject() { ++*_destructed; }
+
+        private:
+            Int* _destructed;
+    };
+
+    PoolAllocator pool;
+    Int destructed = 0;
+    {
+        Scene3D scene;
+        scene.setPoolAllocator(&pool);
+        CORRADE_COMPARE(scene.poolAllocator(), &pool);
+
+        MyObject& a = scene.addChild<MyObject>(&destructed);
+        MyObject& b = a.addChild<MyObject>(&destructed);
+        CORRADE_COMPARE(b.parent(), &a);
+        CORRADE_COMPARE(pool.allocationCount(), 2);
+        CORRADE_COMPARE(pool.chunkCount(), 1);
+
+        /* Objects outside of the scene are not pooled */
+        Object3D orphan;
+        Object3D* c = &orphan.addChild<Object3D>();
+        delete c;
+        CORRADE_COMPARE(pool.allocationCount(), 2);
+    }
+
+    /* Scene destruction returns everything to the pool */
+    CORRADE_COMPARE(destructed, 2);
+    CORRADE_COMPARE(pool.allocationCount(), 0);
+}
+
+void ObjectTest::addFeaturePooled() {
+    class MyFeature: public AbstractFeature3D {
+        public:
+            explicit MyFeature(AbstractObject3D& object, Int* destructed): AbstractFeature3D{object}, _destructed(destructed) {}
+            ~MyFeature() { ++*_destructed; }
+
+        private:
+            Int* _destructed;
+    };
+
+    PoolAllocator pool;
+    Int destructed = 0;
+    {
+        Scene3D scene;
+        scene.setPoolAllocator(&pool);
+
+        Object3D& o = scene.addChild<Object3D>();
+        MyFeature& a = o.addFeature<MyFeature>(&destructed);
+        o.addFeature<MyFeature>(&destructed);
+        CORRADE_COMPARE(&a.object(), &o);
+        CORRADE_COMPARE(pool.allocationCount(), 3);
+
+        a.destroy();
+        CORRADE_COMPARE(destructed, 1);
+        CORRADE_COMPARE(pool.allocationCount(), 2);
+
+        /* Features of the scene itself are pooled too */
+        scene.addFeature<MyFeature>(&destructed);
+        CORRADE_COMPARE(pool.allocationCount(), 3);
+    }
+
+    CORRADE_COMPARE(destructed, 3);
+    CORRADE_COMPARE(pool.allocationCount(), 0);
+}
+
+void ObjectTest::destroy() {
+    Scene3D scene;
+    Object3D* a = new Object3D{&scene};
+    Object3D* b = new Object3D{a};
+    new Object3D{b};
+    a->addFeature<EmptyFeature>();
+
+    const UnsignedInt generation = scene.hierarchyGeneration();
+    a->destroy();
+    CORRADE_VERIFY(scene.children().isEmpty());
+    CORRADE_COMPARE(scene.hierarchyGeneration(), generation + 1);
+}
+
+void ObjectTest::destroyChildren() {
+    PoolAllocator pool;
+    Scene3D scene;
+    scene.setPoolAllocator(&pool);
+
+    Object3D& a = scene.addChild<Object3D>();
+    for(std::size_t i = 0; i != 10; ++i)
+        a.addChild<Object3D>().addChild<Object3D>().addFeature<EmptyFeature>();
+    Object3D& b = scene.addChild<Object3D>();
+    CORRADE_COMPARE(pool.allocationCount(), 32);
+
+    /* The scene is notified just once */
+    const UnsignedInt generation = scene.hierarchyGeneration();
+    CORRADE_COMPARE(&a.destroyChildren(), &a);
+    CORRADE_COMPARE(scene.hierarchyGeneration(), generation + 1);
+    CORRADE_VERIFY(a.children().isEmpty());
+    CORRADE_COMPARE(a.nextSibling(), &b);
+    CORRADE_COMPARE(pool.allocationCount(), 2);
+
+    /* Freed slots are reused */
+    a.addChild<Object3D>();
+    CORRADE_COMPARE(pool.allocationCount(), 3);
+    CORRADE_COMPARE(pool.chunkCount(), 2);
+
+    /* No-op */
+    b.destroyChildren();
+    CORRADE_COMPARE(scene.hierarchyGeneration(), generation + 2);
+}
+
 void ObjectTest::scene() {
     Scene3D scene;
     CORRADE_VERIFY(scene.scene() == &scene);
@@ -304,6 +432,46 @@ void ObjectTest::transformationsDuplicate() {
     }));
 }
 
+void ObjectTest::transformationMatricesInto() {
+    Scene3D s;
+    Object3D first(&s);
+    first.rotateZ(Deg(30.0f));
+    Object3D second(&first);
+    second.scale(Vector3(0.5f));
+    Object3D third(&first);
+    third.translate(Vector3::xAxis(5.0f));
+    Object3D fourth(&third);
+    fourth.rotateX(Deg(15.0f));
+
+    Matrix4 initial = Matrix4::rotationX(Deg(90.0f)).inverted();
+    Matrix4 firstExpected = initial*Matrix4::rotationZ(Deg(30.0f));
+    Matrix4 secondExpected = firstExpected*Matrix4::scaling(Vector3(0.5f));
+    Matrix4 thirdExpected = firstExpected*Matrix4::translation(Vector3::xAxis(5.0f));
+    Matrix4 fourthExpected = thirdExpected*Matrix4::rotationX(Deg(15.0f));
+
+    /* Foreign joint, joint as one of the objects, duplicates and scene */
+    const std::reference_wrapper<AbstractObject3D> objects[]{second, fourth, second, first, third, s};
+    Matrix4 out[6];
+    s.transformationMatricesInto(objects, out, initial);
+    CORRADE_COMPARE(out[0], secondExpected);
+    CORRADE_COMPARE(out[1], fourthExpected);
+    CORRADE_COMPARE(out[2], secondExpected);
+    CORRADE_COMPARE(out[3], firstExpected);
+    CORRADE_COMPARE(out[4], thirdExpected);
+    CORRADE_COMPARE(out[5], initial);
+
+    /* Second call reuses the scratch storage and should give the same result
+       on a smaller subset */
+    s.transformationMatricesInto({objects + 1, 2}, {out, 2}, initial);
+    CORRADE_COMPARE(out[0], fourthExpected);
+    CORRADE_COMPARE(out[1], secondExpected);
+
+    /* All marks got reset, so the classic API still works */
+    CORRADE_COMPARE(s.transformationMatrices({third, second}, initial), (std::vector<Matrix4>{
+        thirdExpected, secondExpected
+    }));
+}
+
 void ObjectTest::setClean() {
     Scene3D scene;
 
@@ -0,0 +1,164 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneGraph/OcclusionCuller.hpp"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct OcclusionCullerTest: TestSuite::Tester {
+    explicit OcclusionCullerTest();
+
+    void entry();
+    void queryResult();
+    void pending();
+    void nearPlane();
+    void recycle();
+
+    void crossesNearPlane();
+};
+
+typedef Implementation::OcclusionVisibility OcclusionVisibility;
+
+OcclusionCullerTest::OcclusionCullerTest() {
+    addTests({&OcclusionCullerTest::entry,
+              &OcclusionCullerTest::queryResult,
+              &OcclusionCullerTest::pending,
+              &OcclusionCullerTest::nearPlane,
+              &OcclusionCullerTest::recycle,
+
+              &OcclusionCullerTest::crossesNearPlane});
+}
+
+void OcclusionCullerTest::entry() {
+    Int a, b;
+    OcclusionVisibility visibility;
+    visibility.newFrame();
+
+    /* New drawables are visible and get new queries */
+    OcclusionVisibility::Entry& entryA = visibility.entry(&a);
+    CORRADE_COMPARE(entryA.query, 0);
+    CORRADE_VERIFY(entryA.visible);
+    CORRADE_VERIFY(!entryA.pending);
+    CORRADE_COMPARE(visibility.entry(&b).query, 1);
+
+    /* Existing drawable gets the same entry */
+    CORRADE_VERIFY(&visibility.entry(&a) == &entryA);
+    CORRADE_COMPARE(visibility.entryCount(), 2);
+    CORRADE_COMPARE(visibility.queryCount(), 2);
+}
+
+void OcclusionCullerTest::queryResult() {
+    Int a;
+    OcclusionVisibility visibility;
+    visibility.newFrame();
+
+    OcclusionVisibility::Entry& entry = visibility.entry(&a);
+    CORRADE_VERIFY(OcclusionVisibility::update(entry, false));
+    entry.pending = true;
+
+    OcclusionVisibility::setResult(entry, false);
+    CORRADE_VERIFY(!entry.visible);
+    CORRADE_VERIFY(!entry.pending);
+
+    /* Occluded drawable is tested again to find out when it reappears */
+    visibility.newFrame();
+    CORRADE_VERIFY(OcclusionVisibility::update(visibility.entry(&a), false));
+
+    OcclusionVisibility::setResult(entry, true);
+    CORRADE_VERIFY(entry.visible);
+}
+
+void OcclusionCullerTest::pending() {
+    Int a;
+    OcclusionVisibility visibility;
+    visibility.newFrame();
+
+    OcclusionVisibility::Entry& entry = visibility.entry(&a);
+    entry.visible = false;
+    entry.pending = true;
+
+    /* No new query while the previous one is in flight, the last known
+       visibility is kept */
+    visibility.newFrame();
+    CORRADE_VERIFY(!OcclusionVisibility::update(visibility.entry(&a), false));
+    CORRADE_VERIFY(!entry.visible);
+    CORRADE_VERIFY(entry.pending);
+}
+
+void OcclusionCullerTest::nearPlane() {
+    Int a;
+    OcclusionVisibility visibility;
+    visibility.newFrame();
+
+    OcclusionVisibility::Entry& entry = visibility.entry(&a);
+    entry.visible = false;
+    entry.pending = true;
+
+    /* The pending result is dropped and no query is issued */
+    CORRADE_VERIFY(!OcclusionVisibility::update(entry, true));
+    CORRADE_VERIFY(entry.visible);
+    CORRADE_VERIFY(!entry.pending);
+}
+
+void OcclusionCullerTest::recycle() {
+    Int a, b, c;
+    OcclusionVisibility visibility;
+    visibility.newFrame();
+    visibility.entry(&a);
+    visibility.entry(&b);
+    visibility.recycle();
+    CORRADE_COMPARE(visibility.entryCount(), 2);
+
+    /* Drawable A is out of view, its query gets reused */
+    visibility.newFrame();
+    visibility.entry(&b);
+    visibility.recycle();
+    CORRADE_COMPARE(visibility.entryCount(), 1);
+
+    visibility.newFrame();
+    CORRADE_COMPARE(visibility.entry(&c).query, 0);
+    CORRADE_COMPARE(visibility.entry(&b).query, 1);
+    CORRADE_COMPARE(visibility.queryCount(), 2);
+
+    /* A is back with a new query and default visibility */
+    OcclusionVisibility::Entry& entryA = visibility.entry(&a);
+    CORRADE_COMPARE(entryA.query, 2);
+    CORRADE_VERIFY(entryA.visible);
+    CORRADE_COMPARE(visibility.queryCount(), 3);
+}
+
+void OcclusionCullerTest::crossesNearPlane() {
+    const Matrix4 projection = Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f);
+
+    CORRADE_VERIFY(!Implementation::occlusionProxyCrossesNearPlane(projection*Matrix4::translation(Vector3::zAxis(-5.0f))));
+    CORRADE_VERIFY(Implementation::occlusionProxyCrossesNearPlane(projection*Matrix4::translation(Vector3::zAxis(-0.5f))));
+    CORRADE_VERIFY(Implementation::occlusionProxyCrossesNearPlane(projection));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::OcclusionCullerTest)
@@ -0,0 +1,170 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/PoolAllocator.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct PoolAllocatorTest: Corrade::TestSuite::Tester {
+    explicit PoolAllocatorTest();
+
+    void construct();
+    void allocate();
+    void allocateSizeClasses();
+    void allocateLarge();
+    void allocateZero();
+    void allocateInvalidAlignment();
+    void deallocate();
+};
+
+PoolAllocatorTest::PoolAllocatorTest() {
+    addTests({&PoolAllocatorTest::construct,
+              &PoolAllocatorTest::allocate,
+              &PoolAllocatorTest::allocateSizeClasses,
+              &PoolAllocatorTest::allocateLarge,
+              &PoolAllocatorTest::allocateZero,
+              &PoolAllocatorTest::allocateInvalidAlignment,
+              &PoolAllocatorTest::deallocate});
+}
+
+void PoolAllocatorTest::construct() {
+    PoolAllocator pool{4096};
+    CORRADE_COMPARE(pool.chunkSize(), 4096);
+    CORRADE_COMPARE(pool.chunkCount(), 0);
+    CORRADE_COMPARE(pool.allocationCount(), 0);
+}
+
+void PoolAllocatorTest::allocate() {
+    PoolAllocator pool{1024};
+
+    /* 48 bytes plus header, 16 slots fit into a chunk */
+    std::vector<void*> pointers;
+    for(std::size_t i = 0; i != 16; ++i) {
+        void* const pointer = pool.allocate(40);
+        CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(pointer)%PoolAllocator::MaxAlignment, 0);
+        pointers.push_back(pointer);
+    }
+    CORRADE_COMPARE(pool.allocationCount(), 16);
+    CORRADE_COMPARE(pool.chunkCount(), 1);
+
+    /* Same-sized allocations are next to each other */
+    CORRADE_COMPARE(static_cast<char*>(pointers[1]) - static_cast<char*>(pointers[0]), 64);
+
+    pointers.push_back(pool.allocate(40));
+    CORRADE_COMPARE(pool.allocationCount(), 17);
+    CORRADE_COMPARE(pool.chunkCount(), 2);
+
+    for(void* const pointer: pointers) PoolAllocator::deallocate(pointer);
+    CORRADE_COMPARE(pool.allocationCount(), 0);
+}
+
+void PoolAllocatorTest::allocateSizeClasses() {
+    PoolAllocator pool{1024};
+
+    void* a = pool.allocate(16);
+    void* b = pool.allocate(17);
+    void* c = pool.allocate(16);
+
+    /* Different size classes have separate chunks */
+    CORRADE_COMPARE(pool.chunkCount(), 2);
+    CORRADE_COMPARE(static_cast<char*>(c) - static_cast<char*>(a), 32);
+
+    PoolAllocator::deallocate(a);
+    PoolAllocator::deallocate(b);
+    PoolAllocator::deallocate(c);
+}
+
+void PoolAllocatorTest::allocateLarge() {
+    PoolAllocator pool{256};
+
+    void* a = pool.allocate(1000);
+    CORRADE_COMPARE(pool.chunkCount(), 1);
+
+    /* The memory is usable */
+    std::fill_n(static_cast<char*>(a), 1000, '\xab');
+
+    void* b = pool.allocate(1000);
+    CORRADE_COMPARE(pool.chunkCount(), 2);
+
+    PoolAllocator::deallocate(a);
+    PoolAllocator::deallocate(b);
+    CORRADE_COMPARE(pool.allocationCount(), 0);
+}
+
+void PoolAllocatorTest::allocateZero() {
+    PoolAllocator pool;
+
+    void* a = pool.allocate(0);
+    void* b = pool.allocate(0);
+    CORRADE_VERIFY(a != b);
+
+    PoolAllocator::deallocate(a);
+    PoolAllocator::deallocate(b);
+    CORRADE_COMPARE(pool.allocationCount(), 0);
+}
+
+void PoolAllocatorTest::allocateInvalidAlignment() {
+    std::ostringstream out;
+    Corrade::Utility::Error redirectError{&out};
+
+    PoolAllocator pool;
+    CORRADE_VERIFY(!pool.allocate(16, 32));
+    CORRADE_COMPARE(out.str(), "SceneGraph::PoolAllocator::allocate(): alignment 32 is not supported\n");
+}
+
+void PoolAllocatorTest::deallocate() {
+    PoolAllocator pool{1024};
+
+    void* a = pool.allocate(32);
+    void* b = pool.allocate(32);
+    void* c = pool.allocate(32);
+
+    /* Freed slots are reused in LIFO order */
+    PoolAllocator::deallocate(a);
+    PoolAllocator::deallocate(c);
+    CORRADE_COMPARE(pool.allocationCount(), 1);
+    CORRADE_COMPARE(pool.allocate(30), c);
+    CORRADE_COMPARE(pool.allocate(32), a);
+
+    /* New slot is taken after the free list is exhausted */
+    void* d = pool.allocate(32);
+    CORRADE_COMPARE(static_cast<char*>(d) - static_cast<char*>(c), 48);
+    CORRADE_COMPARE(pool.chunkCount(), 1);
+
+    PoolAllocator::deallocate(a);
+    PoolAllocator::deallocate(b);
+    PoolAllocator::deallocate(c);
+    PoolAllocator::deallocate(d);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::PoolAllocatorTest)
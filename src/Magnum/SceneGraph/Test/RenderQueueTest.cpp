@@ -0,0 +1,160 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/RenderQueue.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct RenderQueueTest: TestSuite::Tester {
+    explicit RenderQueueTest();
+
+    void stateSort();
+    void stateSortRenderState();
+    void depthSortFrontToBack();
+    void depthSortBackToFront();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+RenderQueueTest::RenderQueueTest() {
+    addTests({&RenderQueueTest::stateSort,
+              &RenderQueueTest::stateSortRenderState,
+              &RenderQueueTest::depthSortFrontToBack,
+              &RenderQueueTest::depthSortBackToFront});
+}
+
+namespace {
+
+class RecordingDrawable: public Object3D, public Drawable3D {
+    public:
+        explicit RecordingDrawable(Int id, Object3D& parent, DrawableGroup3D& group, std::vector<Int>& order): Object3D{&parent}, Drawable3D{*this, &group}, _id{id}, _order(order) {}
+
+    private:
+        void draw(const Matrix4&, Camera3D&) override {
+            _order.push_back(_id);
+        }
+
+        Int _id;
+        std::vector<Int>& _order;
+};
+
+/* Drawables are added in an order that needs 6 state changes */
+struct Fixture {
+    explicit Fixture();
+
+    Scene3D scene;
+    Object3D cameraObject;
+    Camera3D camera;
+    DrawableGroup3D drawables;
+    std::vector<Int> order;
+    RecordingDrawable a, b, c, d, e;
+};
+
+Fixture::Fixture(): cameraObject{&scene}, camera{cameraObject}, a{0, scene, drawables, order}, b{1, scene, drawables, order}, c{2, scene, drawables, order}, d{3, scene, drawables, order}, e{4, scene, drawables, order} {
+    a.translate(Vector3::zAxis(-5.0f));
+    a.setDrawState({2, 1, 1});
+    b.translate(Vector3::zAxis(-3.0f));
+    b.setDrawState({1, 1, 2});
+    c.translate(Vector3::zAxis(-1.0f));
+    c.setDrawState({2, 1, 1});
+    d.translate(Vector3::zAxis(-4.0f));
+    d.setDrawState({1, 1, 1});
+    e.translate(Vector3::zAxis(-2.0f));
+    e.setDrawState({1, 1, 2});
+}
+
+}
+
+void RenderQueueTest::stateSort() {
+    Fixture f;
+
+    RenderQueue3D queue;
+    CORRADE_VERIFY(queue.depthSort() == DepthSort::None);
+    queue.draw(f.camera, f.drawables);
+
+    /* Drawables with the same state keep their original order */
+    CORRADE_COMPARE(f.order, (std::vector<Int>{3, 1, 4, 0, 2}));
+    CORRADE_COMPARE(queue.drawCount(), 5);
+    CORRADE_COMPARE(queue.stateChangeCount(), 3);
+    CORRADE_COMPARE(queue.savedStateChangeCount(), 3);
+}
+
+void RenderQueueTest::stateSortRenderState() {
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    DrawableGroup3D drawables;
+    std::vector<Int> order;
+    RecordingDrawable a{0, scene, drawables, order};
+    a.setDrawState({1, 1, 1, 2});
+    RecordingDrawable b{1, scene, drawables, order};
+    b.setDrawState({1, 2, 1, 1});
+    RecordingDrawable c{2, scene, drawables, order};
+    c.setDrawState({1, 1, 1, 1});
+
+    RenderQueue3D queue;
+    queue.draw(camera, drawables);
+
+    /* Render state has precedence over textures */
+    CORRADE_COMPARE(order, (std::vector<Int>{2, 1, 0}));
+    CORRADE_COMPARE(queue.stateChangeCount(), 3);
+    CORRADE_COMPARE(queue.savedStateChangeCount(), 0);
+}
+
+void RenderQueueTest::depthSortFrontToBack() {
+    Fixture f;
+
+    RenderQueue3D queue;
+    queue.setDepthSort(DepthSort::FrontToBack)
+        .draw(f.camera, f.drawables);
+
+    /* Depth is sorted only among drawables with the same state */
+    CORRADE_COMPARE(f.order, (std::vector<Int>{3, 4, 1, 2, 0}));
+    CORRADE_COMPARE(queue.stateChangeCount(), 3);
+    CORRADE_COMPARE(queue.savedStateChangeCount(), 3);
+}
+
+void RenderQueueTest::depthSortBackToFront() {
+    Fixture f;
+
+    RenderQueue3D queue{DepthSort::BackToFront};
+    queue.draw(f.camera, f.drawables);
+
+    /* Depth has precedence over the state */
+    CORRADE_COMPARE(f.order, (std::vector<Int>{0, 3, 1, 4, 2}));
+    CORRADE_COMPARE(queue.stateChangeCount(), 4);
+    CORRADE_COMPARE(queue.savedStateChangeCount(), 2);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::RenderQueueTest)
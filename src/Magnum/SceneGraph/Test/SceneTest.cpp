@@ -35,14 +35,42 @@ struct SceneTest: TestSuite::Tester {
 
     void transformation();
     void parent();
+
+    void cleanAll();
+    void cleanAllNested();
+    void cleanAllPartiallyClean();
+    void cleanAllReparent();
+    void cleanAllDestroy();
 };
 
 typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
 typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
 
+class CachingFeature: public AbstractFeature3D {
+    public:
+        explicit CachingFeature(AbstractObject3D& object): AbstractFeature3D{object}, cleanCount{} {
+            setCachedTransformations(CachedTransformation::Absolute);
+        }
+
+        Matrix4 absoluteTransformation;
+        Int cleanCount;
+
+    private:
+        void clean(const Matrix4& absoluteTransformation) override {
+            this->absoluteTransformation = absoluteTransformation;
+            ++cleanCount;
+        }
+};
+
 SceneTest::SceneTest() {
     addTests({&SceneTest::transformation,
-              &SceneTest::parent});
+              &SceneTest::parent,
+
+              &SceneTest::cleanAll,
+              &SceneTest::cleanAllNested,
+              &SceneTest::cleanAllPartiallyClean,
+              &SceneTest::cleanAllReparent,
+              &SceneTest::cleanAllDestroy});
 }
 
 void SceneTest::transformation() {
@@ -65,6 +93,156 @@ void SceneTest::parent() {
     CORRADE_VERIFY(object.children().isEmpty());
 }
 
+void SceneTest::cleanAll() {
+    Scene3D scene;
+    Object3D a{&scene};
+    a.translate(Vector3::xAxis(1.0f));
+    Object3D b{&a};
+    b.translate(Vector3::yAxis(2.0f));
+    Object3D c{&scene};
+    CachingFeature fa{a}, fb{b}, fc{c};
+
+    /* Everything is initially dirty, cleaned from the scene down */
+    scene.cleanAll();
+    CORRADE_VERIFY(!scene.isDirty());
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_VERIFY(!c.isDirty());
+    CORRADE_COMPARE(scene.dirtyRootCount(), 0);
+    CORRADE_COMPARE(fb.absoluteTransformation, Matrix4::translation({1.0f, 2.0f, 0.0f}));
+    CORRADE_COMPARE(fb.cleanCount, 1);
+
+    /* Only the changed subtree is cleaned */
+    a.translate(Vector3::zAxis(3.0f));
+    CORRADE_VERIFY(a.isDirty());
+    CORRADE_VERIFY(b.isDirty());
+    CORRADE_VERIFY(!c.isDirty());
+    CORRADE_COMPARE(scene.dirtyRootCount(), 1);
+
+    scene.cleanAll();
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_COMPARE(scene.dirtyRootCount(), 0);
+    CORRADE_COMPARE(fa.cleanCount, 2);
+    CORRADE_COMPARE(fb.cleanCount, 2);
+    CORRADE_COMPARE(fc.cleanCount, 1);
+    CORRADE_COMPARE(fb.absoluteTransformation, Matrix4::translation({1.0f, 2.0f, 3.0f}));
+
+    /* Nothing to do */
+    scene.cleanAll();
+    CORRADE_COMPARE(fa.cleanCount, 2);
+}
+
+void SceneTest::cleanAllNested() {
+    Scene3D scene;
+    Object3D a{&scene};
+    Object3D b{&a};
+    Object3D c{&b};
+    CachingFeature fa{a}, fb{b}, fc{c};
+    scene.cleanAll();
+
+    /* Child made dirty first, then the parent. The child is still listed as
+       dirty root, but the subtree is cleaned just once. */
+    b.translate(Vector3::xAxis(1.0f));
+    a.translate(Vector3::yAxis(1.0f));
+    CORRADE_COMPARE(scene.dirtyRootCount(), 2);
+
+    /* Additional change in already dirty subtree is not recorded */
+    c.translate(Vector3::zAxis(1.0f));
+    CORRADE_COMPARE(scene.dirtyRootCount(), 2);
+
+    scene.cleanAll();
+    CORRADE_COMPARE(fa.cleanCount, 2);
+    CORRADE_COMPARE(fb.cleanCount, 2);
+    CORRADE_COMPARE(fc.cleanCount, 2);
+    CORRADE_COMPARE(fc.absoluteTransformation, Matrix4::translation({1.0f, 1.0f, 1.0f}));
+}
+
+void SceneTest::cleanAllPartiallyClean() {
+    Scene3D scene;
+    Object3D a{&scene};
+    Object3D b{&a};
+    Object3D c{&a};
+    b.translate(Vector3::xAxis(1.0f));
+    c.translate(Vector3::yAxis(1.0f));
+    CachingFeature fb{b}, fc{c};
+    scene.cleanAll();
+
+    /* Explicitly cleaning one child cleans also the root, but the other child
+       still needs to be cleaned */
+    a.translate(Vector3::zAxis(1.0f));
+    b.setClean();
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(c.isDirty());
+    CORRADE_COMPARE(fb.cleanCount, 2);
+
+    scene.cleanAll();
+    CORRADE_VERIFY(!c.isDirty());
+    CORRADE_COMPARE(fb.cleanCount, 2);
+    CORRADE_COMPARE(fc.cleanCount, 2);
+    CORRADE_COMPARE(fc.absoluteTransformation, Matrix4::translation({0.0f, 1.0f, 1.0f}));
+}
+
+void SceneTest::cleanAllReparent() {
+    Scene3D scene1, scene2;
+    Object3D b{&scene2};
+    b.translate(Vector3::xAxis(1.0f));
+    Object3D a{&scene1};
+    CachingFeature fa{a};
+    scene1.cleanAll();
+    scene2.cleanAll();
+
+    /* Dirty root moved to another scene is removed from the original one */
+    a.translate(Vector3::yAxis(1.0f));
+    CORRADE_COMPARE(scene1.dirtyRootCount(), 1);
+    a.setParent(&b);
+    CORRADE_COMPARE(scene1.dirtyRootCount(), 0);
+    CORRADE_COMPARE(scene2.dirtyRootCount(), 1);
+
+    scene2.cleanAll();
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_COMPARE(fa.absoluteTransformation, Matrix4::translation({1.0f, 1.0f, 0.0f}));
+
+    /* Object not part of any scene is not tracked, but it is tracked after
+       it gets added to a scene, even if it was dirty already */
+    Object3D orphan;
+    Object3D c{&orphan};
+    CachingFeature fc{c};
+    CORRADE_COMPARE(scene1.dirtyRootCount(), 0);
+    orphan.setParent(&scene1);
+    CORRADE_COMPARE(scene1.dirtyRootCount(), 1);
+
+    scene1.cleanAll();
+    CORRADE_VERIFY(!c.isDirty());
+    CORRADE_COMPARE(fc.cleanCount, 1);
+}
+
+void SceneTest::cleanAllDestroy() {
+    Scene3D scene;
+    Object3D& a = scene.addChild<Object3D>();
+    scene.cleanAll();
+
+    /* Destroyed dirty roots are removed from the list */
+    Object3D* b = &a.addChild<Object3D>();
+    Object3D& c = b->addChild<Object3D>().addChild<Object3D>();
+    c.translate(Vector3::xAxis(1.0f));
+    Object3D& d = a.addChild<Object3D>();
+    CORRADE_COMPARE(scene.dirtyRootCount(), 2);
+    b->destroy();
+    CORRADE_COMPARE(scene.dirtyRootCount(), 1);
+
+    /* Also when destroying all children at once */
+    a.addChild<Object3D>().addChild<Object3D>();
+    CORRADE_COMPARE(scene.dirtyRootCount(), 2);
+    a.destroyChildren();
+    CORRADE_COMPARE(scene.dirtyRootCount(), 0);
+
+    /* d was destroyed as well, nothing to clean */
+    static_cast<void>(d);
+    scene.cleanAll();
+    CORRADE_VERIFY(!a.isDirty());
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::SceneTest)
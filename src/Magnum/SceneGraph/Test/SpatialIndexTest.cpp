@@ -0,0 +1,434 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+#include "Magnum/SceneGraph/SpatialIndex.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct SpatialIndexTest: TestSuite::Tester {
+    explicit SpatialIndexTest();
+
+    void construct();
+    void absoluteSphere();
+    void queryBox();
+    void querySphere();
+    void queryOversized();
+    void queryManyCells();
+    void updateIncremental();
+    void setBoundingSphere();
+    void addToAnotherIndex();
+    void remove();
+    void deleteFeature();
+    void deleteIndex();
+
+    void queryFrustum();
+    void drawableMask();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+typedef std::vector<std::reference_wrapper<Spatial3D>> Result;
+
+SpatialIndexTest::SpatialIndexTest() {
+    addTests({&SpatialIndexTest::construct,
+              &SpatialIndexTest::absoluteSphere,
+              &SpatialIndexTest::queryBox,
+              &SpatialIndexTest::querySphere,
+              &SpatialIndexTest::queryOversized,
+              &SpatialIndexTest::queryManyCells,
+              &SpatialIndexTest::updateIncremental,
+              &SpatialIndexTest::setBoundingSphere,
+              &SpatialIndexTest::addToAnotherIndex,
+              &SpatialIndexTest::remove,
+              &SpatialIndexTest::deleteFeature,
+              &SpatialIndexTest::deleteIndex,
+
+              &SpatialIndexTest::queryFrustum,
+              &SpatialIndexTest::drawableMask});
+}
+
+namespace {
+    /* Order-independent comparison of query results */
+    bool contains(const Result& result, const Spatial3D& feature) {
+        for(const Spatial3D& f: result) if(&f == &feature) return true;
+        return false;
+    }
+}
+
+void SpatialIndexTest::construct() {
+    Scene3D scene;
+    Object3D object{&scene};
+    SpatialIndex3D index{4.0f};
+    Spatial3D spatial{object, &index};
+
+    CORRADE_COMPARE(index.cellSize(), 4.0f);
+    CORRADE_COMPARE(index.size(), 1);
+    CORRADE_VERIFY(spatial.index() == &index);
+    CORRADE_COMPARE(spatial.boundingCenter(), Vector3{});
+    CORRADE_COMPARE(spatial.boundingRadius(), 0.0f);
+
+    /* The grid is populated lazily */
+    CORRADE_COMPARE(index.cellCount(), 0);
+    index.update();
+    CORRADE_COMPARE(index.cellCount(), 1);
+    CORRADE_COMPARE(index.oversizedCount(), 0);
+}
+
+void SpatialIndexTest::absoluteSphere() {
+    Scene3D scene;
+    Object3D parent{&scene};
+    parent.scale(Vector3{2.0f, 3.0f, 1.0f})
+        .translate({1.0f, 0.0f, 0.0f});
+    Object3D object{&parent};
+    object.translate({0.0f, 1.0f, 0.0f});
+
+    SpatialIndex3D index{10.0f};
+    Spatial3D spatial{object, &index};
+    spatial.setBoundingSphere({0.0f, 0.0f, 1.0f}, 0.5f);
+
+    index.update();
+    CORRADE_COMPARE(spatial.absoluteCenter(), (Vector3{1.0f, 3.0f, 1.0f}));
+    /* Radius scaled by the largest scale */
+    CORRADE_COMPARE(spatial.absoluteRadius(), 1.5f);
+    CORRADE_VERIFY(!object.isDirty());
+}
+
+void SpatialIndexTest::queryBox() {
+    Scene3D scene;
+    Object3D a{&scene}, b{&scene}, c{&scene};
+    a.translate({1.0f, 1.0f, 1.0f});
+    b.translate({5.0f, 1.0f, 1.0f});
+    c.translate({-20.0f, 0.0f, 0.0f});
+
+    SpatialIndex3D index{2.0f};
+    Spatial3D sa{a, &index}, sb{b, &index}, sc{c, &index};
+    sa.setBoundingSphere({}, 0.5f);
+    sb.setBoundingSphere({}, 1.5f);
+    sc.setBoundingSphere({}, 1.0f);
+
+    Result result;
+    index.queryBox({{0.0f, 0.0f, 0.0f}, {2.0f, 2.0f, 2.0f}}, result);
+    CORRADE_COMPARE(result.size(), 1);
+    CORRADE_VERIFY(contains(result, sa));
+    CORRADE_COMPARE(index.cellCount(), 3);
+
+    /* Touches only the sphere of b, which is in a cell outside of the box */
+    index.queryBox({{3.0f, 0.0f, 0.0f}, {3.6f, 2.0f, 2.0f}}, result);
+    CORRADE_COMPARE(result.size(), 1);
+    CORRADE_VERIFY(contains(result, sb));
+
+    /* Previous contents of the output are discarded */
+    index.queryBox({{-100.0f, -100.0f, -100.0f}, {100.0f, 100.0f, 100.0f}}, result);
+    CORRADE_COMPARE(result.size(), 3);
+
+    index.queryBox({{10.0f, 10.0f, 10.0f}, {11.0f, 11.0f, 11.0f}}, result);
+    CORRADE_VERIFY(result.empty());
+}
+
+void SpatialIndexTest::querySphere() {
+    Scene3D scene;
+    Object3D a{&scene}, b{&scene};
+    a.translate({3.0f, 0.0f, 0.0f});
+    b.translate({-3.0f, -3.0f, 0.0f});
+
+    SpatialIndex3D index{1.0f};
+    Spatial3D sa{a, &index}, sb{b, &index};
+    sa.setBoundingSphere({}, 1.0f);
+    sb.setBoundingSphere({}, 1.0f);
+
+    Result result;
+    index.querySphere({}, 2.5f, result);
+    CORRADE_COMPARE(result.size(), 1);
+    CORRADE_VERIFY(contains(result, sa));
+
+    /* The box around the query sphere touches b, but the sphere not */
+    index.querySphere({-1.0f, -1.0f, 0.0f}, 1.5f, result);
+    CORRADE_VERIFY(result.empty());
+
+    index.querySphere({-1.0f, -1.0f, 0.0f}, 2.0f, result);
+    CORRADE_COMPARE(result.size(), 1);
+    CORRADE_VERIFY(contains(result, sb));
+}
+
+void SpatialIndexTest::queryOversized() {
+    Scene3D scene;
+    Object3D a{&scene};
+    a.translate({50.0f, 0.0f, 0.0f});
+
+    SpatialIndex3D index{1.0f};
+    Spatial3D sa{a, &index};
+    sa.setBoundingSphere({}, 45.0f);
+
+    Result result;
+    index.queryBox({{0.0f, 0.0f, 0.0f}, {6.0f, 1.0f, 1.0f}}, result);
+    CORRADE_COMPARE(result.size(), 1);
+    CORRADE_COMPARE(index.cellCount(), 0);
+    CORRADE_COMPARE(index.oversizedCount(), 1);
+
+    /* Shrinking moves it to the grid */
+    sa.setBoundingSphere({}, 0.5f);
+    index.queryBox({{0.0f, 0.0f, 0.0f}, {6.0f, 1.0f, 1.0f}}, result);
+    CORRADE_VERIFY(result.empty());
+    CORRADE_COMPARE(index.cellCount(), 1);
+    CORRADE_COMPARE(index.oversizedCount(), 0);
+}
+
+void SpatialIndexTest::queryManyCells() {
+    Scene3D scene;
+    SpatialIndex3D index{1.0f};
+
+    /* Few occupied cells, large query box -- goes through the occupied cells
+       instead of through the box */
+    Object3D a{&scene}, b{&scene};
+    a.translate({-500.0f, 3.0f, 7.0f});
+    b.translate({800.0f, -900.0f, 0.0f});
+    Spatial3D sa{a, &index}, sb{b, &index};
+
+    Result result;
+    index.queryBox({{-600.0f, -600.0f, -600.0f}, {600.0f, 600.0f, 600.0f}}, result);
+    CORRADE_COMPARE(result.size(), 1);
+    CORRADE_VERIFY(contains(result, sa));
+}
+
+void SpatialIndexTest::updateIncremental() {
+    struct Counter: AbstractFeature3D {
+        explicit Counter(AbstractObject3D& object): AbstractFeature3D{object} {
+            setCachedTransformations(CachedTransformation::Absolute);
+        }
+
+        void clean(const Matrix4&) override { ++cleaned; }
+
+        Int cleaned = 0;
+    };
+
+    Scene3D scene;
+    Object3D a{&scene}, b{&scene};
+    SpatialIndex3D index{1.0f};
+    Spatial3D sa{a, &index}, sb{b, &index};
+    Counter ca{a}, cb{b};
+
+    Result result;
+    index.querySphere({}, 0.5f, result);
+    CORRADE_COMPARE(result.size(), 2);
+    CORRADE_COMPARE(ca.cleaned, 1);
+    CORRADE_COMPARE(cb.cleaned, 1);
+
+    /* Moving one object cleans only that one */
+    a.translate({10.0f, 0.0f, 0.0f});
+    index.querySphere({}, 0.5f, result);
+    CORRADE_COMPARE(result.size(), 1);
+    CORRADE_VERIFY(contains(result, sb));
+    CORRADE_COMPARE(ca.cleaned, 2);
+    CORRADE_COMPARE(cb.cleaned, 1);
+    CORRADE_COMPARE(index.cellCount(), 2);
+
+    /* Nothing changed, nothing cleaned */
+    index.querySphere({10.0f, 0.0f, 0.0f}, 0.5f, result);
+    CORRADE_COMPARE(result.size(), 1);
+    CORRADE_VERIFY(contains(result, sa));
+    CORRADE_COMPARE(ca.cleaned, 2);
+
+    /* Cleaning the object from outside updates the index as well */
+    b.translate({10.0f, 0.0f, 0.0f});
+    b.setClean();
+    CORRADE_COMPARE(index.cellCount(), 1);
+    index.querySphere({10.0f, 0.0f, 0.0f}, 0.5f, result);
+    CORRADE_COMPARE(result.size(), 2);
+    CORRADE_COMPARE(cb.cleaned, 2);
+}
+
+void SpatialIndexTest::setBoundingSphere() {
+    Scene3D scene;
+    Object3D a{&scene};
+    SpatialIndex3D index{1.0f};
+    Spatial3D sa{a, &index};
+
+    Result result;
+    index.querySphere({0.0f, 5.0f, 0.0f}, 0.5f, result);
+    CORRADE_VERIFY(result.empty());
+
+    /* Object is clean, the change is picked up anyway */
+    CORRADE_VERIFY(!a.isDirty());
+    sa.setBoundingSphere({0.0f, 5.0f, 0.0f}, 0.25f);
+    index.querySphere({0.0f, 5.0f, 0.0f}, 0.5f, result);
+    CORRADE_COMPARE(result.size(), 1);
+    CORRADE_COMPARE(sa.absoluteCenter(), (Vector3{0.0f, 5.0f, 0.0f}));
+}
+
+void SpatialIndexTest::addToAnotherIndex() {
+    Scene3D scene;
+    Object3D a{&scene};
+    SpatialIndex3D index1{1.0f}, index2{1.0f};
+    Spatial3D sa{a, &index1};
+    index1.update();
+    CORRADE_COMPARE(index1.cellCount(), 1);
+
+    index2.add(sa);
+    CORRADE_VERIFY(sa.index() == &index2);
+    CORRADE_VERIFY(index1.isEmpty());
+    CORRADE_COMPARE(index1.cellCount(), 0);
+
+    Result result;
+    index2.querySphere({}, 1.0f, result);
+    CORRADE_COMPARE(result.size(), 1);
+    index1.querySphere({}, 1.0f, result);
+    CORRADE_VERIFY(result.empty());
+}
+
+void SpatialIndexTest::remove() {
+    Scene3D scene;
+    Object3D a{&scene}, b{&scene};
+    SpatialIndex3D index{1.0f};
+    Spatial3D sa{a, &index}, sb{b, &index};
+    index.update();
+
+    index.remove(sa);
+    CORRADE_VERIFY(!sa.index());
+    CORRADE_COMPARE(index.size(), 1);
+
+    Result result;
+    index.querySphere({}, 1.0f, result);
+    CORRADE_COMPARE(result.size(), 1);
+    CORRADE_VERIFY(contains(result, sb));
+
+    /* Removing a dirty feature removes it from the pending list as well */
+    b.translate({1.0f, 0.0f, 0.0f});
+    index.remove(sb);
+    index.update();
+    CORRADE_VERIFY(b.isDirty());
+    CORRADE_COMPARE(index.cellCount(), 0);
+}
+
+void SpatialIndexTest::deleteFeature() {
+    Scene3D scene;
+    Object3D a{&scene};
+    SpatialIndex3D index{1.0f};
+    Spatial3D* sa = new Spatial3D{a, &index};
+    Spatial3D sb{a, &index};
+    index.update();
+    CORRADE_COMPARE(index.cellCount(), 1);
+
+    delete sa;
+    CORRADE_COMPARE(index.size(), 1);
+
+    Result result;
+    index.querySphere({}, 1.0f, result);
+    CORRADE_COMPARE(result.size(), 1);
+    CORRADE_VERIFY(contains(result, sb));
+}
+
+void SpatialIndexTest::deleteIndex() {
+    Scene3D scene;
+    Object3D a{&scene};
+    Spatial3D sa{a};
+
+    {
+        SpatialIndex3D index{1.0f};
+        index.add(sa);
+        index.update();
+    }
+
+    CORRADE_VERIFY(!sa.index());
+
+    /* Not crashing on a dangling index */
+    a.translate({1.0f, 0.0f, 0.0f});
+    a.setClean();
+}
+
+void SpatialIndexTest::queryFrustum() {
+    Scene3D scene;
+    SpatialIndex3D index{1.0f};
+
+    Object3D front{&scene}, behind{&scene}, side{&scene}, edge{&scene};
+    front.translate({0.0f, 0.0f, -5.0f});
+    behind.translate({0.0f, 0.0f, 5.0f});
+    side.translate({-20.0f, 0.0f, -5.0f});
+    /* Center outside, sphere partially inside */
+    edge.translate({0.0f, 0.0f, -10.5f});
+
+    Spatial3D sFront{front, &index}, sBehind{behind, &index}, sSide{side, &index}, sEdge{edge, &index};
+    sFront.setBoundingSphere({}, 0.5f);
+    sBehind.setBoundingSphere({}, 0.5f);
+    sSide.setBoundingSphere({}, 0.5f);
+    sEdge.setBoundingSphere({}, 0.75f);
+
+    Result result;
+    index.queryFrustum(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 1.0f, 10.0f), result);
+    CORRADE_COMPARE(result.size(), 2);
+    CORRADE_VERIFY(contains(result, sFront));
+    CORRADE_VERIFY(contains(result, sEdge));
+}
+
+void SpatialIndexTest::drawableMask() {
+    struct Drawable: SceneGraph::Drawable3D {
+        explicit Drawable(AbstractObject3D& object, DrawableGroup3D* group): SceneGraph::Drawable3D{object, group} {}
+
+        void draw(const Matrix4&, Camera3D&) override {}
+    };
+
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    cameraObject.translate({0.0f, 0.0f, 5.0f});
+    Camera3D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 1.0f, 10.0f));
+
+    SpatialIndex3D index{1.0f};
+    DrawableGroup3D drawables, otherDrawables;
+
+    Object3D visible{&scene}, hidden{&scene}, unindexed{&scene};
+    hidden.translate({0.0f, 0.0f, 10.0f});
+    new Spatial3D{visible, &index};
+    new Spatial3D{hidden, &index};
+
+    Drawable hiddenDrawable{hidden, &drawables};
+    Drawable visibleDrawable1{visible, &drawables};
+    Drawable unindexedDrawable{unindexed, &drawables};
+    Drawable otherDrawable{visible, &otherDrawables};
+    Drawable visibleDrawable2{visible, &drawables};
+
+    const Math::BitArray mask = index.drawableMask(camera, drawables);
+    CORRADE_COMPARE(mask.size(), 4);
+    CORRADE_VERIFY(!mask[hiddenDrawable.groupIndex()]);
+    CORRADE_VERIFY(mask[visibleDrawable1.groupIndex()]);
+    CORRADE_VERIFY(!mask[unindexedDrawable.groupIndex()]);
+    CORRADE_VERIFY(mask[visibleDrawable2.groupIndex()]);
+    CORRADE_COMPARE(mask.count(), 2);
+
+    /* Moving the camera changes the result, the previously visible object is
+       now behind the far plane */
+    cameraObject.translate({0.0f, 0.0f, 10.0f});
+    const Math::BitArray mask2 = index.drawableMask(camera, drawables);
+    CORRADE_VERIFY(mask2[hiddenDrawable.groupIndex()]);
+    CORRADE_COMPARE(mask2.count(), 1);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::SpatialIndexTest)
@@ -0,0 +1,206 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/MatrixTransformation2D.h"
+#include "Magnum/SceneGraph/Scene.h"
+#include "Magnum/SceneGraph/SpriteBatch.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct SpriteBatchTest: TestSuite::Tester {
+    explicit SpriteBatchTest();
+
+    void sprite();
+    void textureRectanglePixels();
+
+    void collect();
+    void collectCulled();
+    void collectEmpty();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation2D> Object2D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation2D> Scene2D;
+
+SpriteBatchTest::SpriteBatchTest() {
+    addTests({&SpriteBatchTest::sprite,
+              &SpriteBatchTest::textureRectanglePixels,
+
+              &SpriteBatchTest::collect,
+              &SpriteBatchTest::collectCulled,
+              &SpriteBatchTest::collectEmpty});
+}
+
+void SpriteBatchTest::sprite() {
+    Scene2D scene;
+    Object2D object{&scene};
+    SpriteGroup2D sprites;
+    Sprite2D sprite{object, &sprites};
+
+    CORRADE_COMPARE(sprites.size(), 1);
+    CORRADE_COMPARE(sprite.rectangle(), (Range2D{{-0.5f, -0.5f}, {0.5f, 0.5f}}));
+    CORRADE_COMPARE(sprite.textureRectangle(), (Range2D{{}, Vector2{1.0f}}));
+    CORRADE_VERIFY(!sprite.texture());
+    CORRADE_COMPARE(sprite.color(), Color4{1.0f});
+    CORRADE_COMPARE(sprite.layer(), 0);
+}
+
+void SpriteBatchTest::textureRectanglePixels() {
+    Scene2D scene;
+    Object2D object{&scene};
+    Sprite2D sprite{object};
+    sprite.setTextureRectangle({{64, 32}, {128, 96}}, {256, 128});
+
+    CORRADE_COMPARE(sprite.textureRectangle(), (Range2D{{0.25f, 0.25f}, {0.5f, 0.75f}}));
+}
+
+void SpriteBatchTest::collect() {
+    Scene2D scene;
+    Object2D cameraObject{&scene};
+    cameraObject.translate(Vector2::xAxis(1.0f));
+    Camera2D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix3::projection({4.0f, 4.0f}));
+
+    /* The textures are never accessed in collect() */
+    Texture2D* const first = reinterpret_cast<Texture2D*>(std::size_t{0x10});
+    Texture2D* const second = reinterpret_cast<Texture2D*>(std::size_t{0x20});
+
+    SpriteGroup2D sprites;
+    Object2D a{&scene};
+    Sprite2D spriteA{a, &sprites};
+    spriteA.setTexture(second);
+    Object2D b{&scene};
+    b.translate(Vector2::xAxis(1.0f));
+    Sprite2D spriteB{b, &sprites};
+    spriteB.setTexture(first)
+        .setRectangle({{}, {2.0f, 1.0f}})
+        .setTextureRectangle({{0.5f, 0.25f}, {1.0f, 0.5f}})
+        .setColor({1.0f, 0.0f, 0.5f, 1.0f});
+    /* Higher layer, drawn last even though it has the first texture */
+    Object2D c{&scene};
+    Sprite2D spriteC{c, &sprites};
+    spriteC.setTexture(first)
+        .setLayer(1);
+    Object2D d{&scene};
+    Sprite2D spriteD{d, &sprites};
+    spriteD.setTexture(second);
+    /* Untextured */
+    Object2D e{&scene};
+    Sprite2D spriteE{e, &sprites};
+
+    SpriteBatch2D batch;
+    batch.collect(camera, sprites);
+
+    CORRADE_COMPARE(batch.spriteCount(), 5);
+    CORRADE_COMPARE(batch.drawCallCount(), 4);
+    CORRADE_COMPARE(batch.batches().size(), 4);
+    CORRADE_VERIFY(!batch.batches()[0].texture);
+    CORRADE_COMPARE(batch.batches()[0].layer, 0);
+    CORRADE_COMPARE(batch.batches()[0].offset, 0);
+    CORRADE_COMPARE(batch.batches()[0].count, 1);
+    CORRADE_VERIFY(batch.batches()[1].texture == first);
+    CORRADE_COMPARE(batch.batches()[1].layer, 0);
+    CORRADE_COMPARE(batch.batches()[1].offset, 1);
+    CORRADE_COMPARE(batch.batches()[1].count, 1);
+    CORRADE_VERIFY(batch.batches()[2].texture == second);
+    CORRADE_COMPARE(batch.batches()[2].layer, 0);
+    CORRADE_COMPARE(batch.batches()[2].offset, 2);
+    CORRADE_COMPARE(batch.batches()[2].count, 2);
+    CORRADE_VERIFY(batch.batches()[3].texture == first);
+    CORRADE_COMPARE(batch.batches()[3].layer, 1);
+    CORRADE_COMPARE(batch.batches()[3].offset, 4);
+    CORRADE_COMPARE(batch.batches()[3].count, 1);
+
+    /* Sprite B is second, its vertices are relative to camera and projected */
+    CORRADE_COMPARE(batch.vertices().size(), 20);
+    const SpriteBatch2D::Vertex* vertices = batch.vertices().data() + 4;
+    CORRADE_COMPARE(vertices[0].position, (Vector2{0.0f, 0.0f}));
+    CORRADE_COMPARE(vertices[1].position, (Vector2{1.0f, 0.0f}));
+    CORRADE_COMPARE(vertices[2].position, (Vector2{0.0f, 0.5f}));
+    CORRADE_COMPARE(vertices[3].position, (Vector2{1.0f, 0.5f}));
+    CORRADE_COMPARE(vertices[0].textureCoordinates, (Vector2{0.5f, 0.25f}));
+    CORRADE_COMPARE(vertices[1].textureCoordinates, (Vector2{1.0f, 0.25f}));
+    CORRADE_COMPARE(vertices[2].textureCoordinates, (Vector2{0.5f, 0.5f}));
+    CORRADE_COMPARE(vertices[3].textureCoordinates, (Vector2{1.0f, 0.5f}));
+    CORRADE_COMPARE(vertices[0].color, (Color4ub{255, 0, 127, 255}));
+    CORRADE_COMPARE(vertices[3].color, (Color4ub{255, 0, 127, 255}));
+
+    /* Sprites A and D share a batch and are in group order */
+    CORRADE_COMPARE(batch.vertices()[8].position, (Vector2{-0.75f, -0.25f}));
+    CORRADE_COMPARE(batch.vertices()[15].position, (Vector2{-0.25f, 0.25f}));
+}
+
+void SpriteBatchTest::collectCulled() {
+    Scene2D scene;
+    Object2D cameraObject{&scene};
+    Camera2D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix3::projection({2.0f, 2.0f}));
+
+    SpriteGroup2D sprites;
+    /* Partially visible */
+    Object2D a{&scene};
+    a.translate({1.25f, 0.0f});
+    Sprite2D spriteA{a, &sprites};
+    /* Completely outside */
+    Object2D b{&scene};
+    b.translate({0.0f, -1.75f});
+    Sprite2D spriteB{b, &sprites};
+    /* Outside until moved */
+    Object2D c{&scene};
+    c.translate({-1.6f, 0.0f});
+    Sprite2D spriteC{c, &sprites};
+    spriteC.setRectangle({{-0.5f, -0.05f}, {0.5f, 0.05f}});
+
+    SpriteBatch2D batch;
+    batch.collect(camera, sprites);
+    CORRADE_COMPARE(batch.spriteCount(), 1);
+    CORRADE_COMPARE(batch.drawCallCount(), 1);
+    CORRADE_COMPARE(batch.vertices()[0].position, (Vector2{0.75f, -0.5f}));
+
+    c.translate({0.5f, 0.0f});
+    batch.collect(camera, sprites);
+    CORRADE_COMPARE(batch.spriteCount(), 2);
+    CORRADE_COMPARE(batch.drawCallCount(), 1);
+    CORRADE_COMPARE(batch.vertices()[4].position, (Vector2{-1.6f, -0.05f}));
+}
+
+void SpriteBatchTest::collectEmpty() {
+    Scene2D scene;
+    Object2D cameraObject{&scene};
+    Camera2D camera{cameraObject};
+    SpriteGroup2D sprites;
+
+    SpriteBatch2D batch;
+    batch.collect(camera, sprites);
+    CORRADE_VERIFY(batch.vertices().empty());
+    CORRADE_VERIFY(batch.batches().empty());
+    CORRADE_COMPARE(batch.spriteCount(), 0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::SpriteBatchTest)
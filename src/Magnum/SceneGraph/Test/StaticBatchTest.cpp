@@ -0,0 +1,102 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+#include "Magnum/SceneGraph/StaticBatch.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct StaticBatchTest: TestSuite::Tester {
+    explicit StaticBatchTest();
+
+    void empty();
+    void batches();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+StaticBatchTest::StaticBatchTest() {
+    addTests({&StaticBatchTest::empty,
+              &StaticBatchTest::batches});
+}
+
+namespace {
+    struct Drawable: SceneGraph::Drawable3D {
+        explicit Drawable(AbstractObject3D& object, DrawableGroup3D& group, const DrawState& state): SceneGraph::Drawable3D{object, &group} {
+            setDrawState(state);
+        }
+
+        void draw(const Matrix4&, Camera3D&) override {}
+    };
+}
+
+void StaticBatchTest::empty() {
+    Scene3D scene;
+    DrawableGroup3D group;
+    CORRADE_VERIFY(staticBatches(scene, group).empty());
+}
+
+void StaticBatchTest::batches() {
+    Scene3D scene;
+    Object3D level{&scene};
+    level.translate(Vector3::xAxis(10.0f));
+    Object3D a{&level}, b{&a}, c{&level}, outside{&scene};
+    a.translate(Vector3::yAxis(1.0f));
+    b.translate(Vector3::zAxis(2.0f));
+
+    DrawableGroup3D group;
+    Drawable da{a, group, {2, 1, 5}};
+    Drawable db{b, group, {1, 0, 3}};
+    Drawable dc{c, group, {2, 1, 6}};
+    Drawable dOutside{outside, group, {2, 1, 5}};
+    Drawable dUnknown{c, group, {0, 1, 5}};
+    Drawable dLevel{level, group, {2, 1, 7}};
+
+    const std::vector<StaticBatch3D> batches = staticBatches(level, group);
+    CORRADE_COMPARE(batches.size(), 2);
+
+    /* Ordered by state, mesh is not part of it */
+    CORRADE_VERIFY(batches[0].state == (DrawState{1, 0, 0}));
+    CORRADE_COMPARE(batches[0].drawables.size(), 1);
+    CORRADE_VERIFY(&batches[0].drawables[0].first.get() == &db);
+    /* Relative to the level root */
+    CORRADE_COMPARE(batches[0].drawables[0].second, Matrix4::translation({0.0f, 1.0f, 2.0f}));
+
+    /* In group order */
+    CORRADE_VERIFY(batches[1].state == (DrawState{2, 1, 0}));
+    CORRADE_COMPARE(batches[1].drawables.size(), 3);
+    CORRADE_VERIFY(&batches[1].drawables[0].first.get() == &da);
+    CORRADE_VERIFY(&batches[1].drawables[1].first.get() == &dc);
+    CORRADE_VERIFY(&batches[1].drawables[2].first.get() == &dLevel);
+    CORRADE_COMPARE(batches[1].drawables[2].second, Matrix4{});
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::StaticBatchTest)
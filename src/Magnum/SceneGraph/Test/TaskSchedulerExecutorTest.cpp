@@ -0,0 +1,77 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <atomic>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/TaskScheduler.h"
+#include "Magnum/SceneGraph/TaskSchedulerExecutor.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct TaskSchedulerExecutorTest: TestSuite::Tester {
+    explicit TaskSchedulerExecutorTest();
+
+    void execute();
+    void executeEmpty();
+};
+
+TaskSchedulerExecutorTest::TaskSchedulerExecutorTest() {
+    addTests({&TaskSchedulerExecutorTest::execute,
+              &TaskSchedulerExecutorTest::executeEmpty});
+}
+
+void TaskSchedulerExecutorTest::execute() {
+    TaskScheduler scheduler{4};
+    TaskSchedulerExecutor executor{scheduler, 8};
+    CORRADE_VERIFY(&executor.scheduler() == &scheduler);
+    CORRADE_COMPARE(executor.grainSize(), 8);
+
+    std::vector<std::atomic<int>> called(1000);
+    for(std::atomic<int>& i: called) i = 0;
+    executor.execute(called.size(), [](void* state, std::size_t i) {
+        ++static_cast<std::atomic<int>*>(state)[i];
+    }, called.data());
+
+    /* Each task executed exactly once */
+    for(std::size_t i = 0; i != called.size(); ++i)
+        if(called[i] != 1) CORRADE_COMPARE(called[i], 1);
+}
+
+void TaskSchedulerExecutorTest::executeEmpty() {
+    TaskScheduler scheduler{2};
+    TaskSchedulerExecutor executor{scheduler};
+
+    bool called = false;
+    executor.execute(0, [](void* state, std::size_t) {
+        *static_cast<bool*>(state) = true;
+    }, &called);
+    CORRADE_VERIFY(!called);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::TaskSchedulerExecutorTest)
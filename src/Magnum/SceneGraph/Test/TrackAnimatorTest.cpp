@@ -0,0 +1,355 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/DualQuaternionTransformation.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+#include "Magnum/SceneGraph/TrackAnimator.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct TrackAnimatorTest: TestSuite::Tester {
+    explicit TrackAnimatorTest();
+
+    void defaults();
+    void constant();
+    void linear();
+    void spherical();
+    void sphericalShortestPath();
+    void cubic();
+    void composition();
+    void outsideRange();
+    void backwards();
+    void repeat();
+    void dualQuaternion();
+    void clear();
+
+    void invalidTrack();
+    void invalidKeyframes();
+    void invalidInterpolation();
+
+    void debugInterpolation();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+using namespace Math::Literals;
+
+TrackAnimatorTest::TrackAnimatorTest() {
+    addTests({&TrackAnimatorTest::defaults,
+              &TrackAnimatorTest::constant,
+              &TrackAnimatorTest::linear,
+              &TrackAnimatorTest::spherical,
+              &TrackAnimatorTest::sphericalShortestPath,
+              &TrackAnimatorTest::cubic,
+              &TrackAnimatorTest::composition,
+              &TrackAnimatorTest::outsideRange,
+              &TrackAnimatorTest::backwards,
+              &TrackAnimatorTest::repeat,
+              &TrackAnimatorTest::dualQuaternion,
+              &TrackAnimatorTest::clear,
+
+              &TrackAnimatorTest::invalidTrack,
+              &TrackAnimatorTest::invalidKeyframes,
+              &TrackAnimatorTest::invalidInterpolation,
+
+              &TrackAnimatorTest::debugInterpolation});
+}
+
+void TrackAnimatorTest::defaults() {
+    Scene3D scene;
+    Object3D object{&scene};
+    object.translate(Vector3::yAxis(3.0f));
+
+    TrackAnimator<MatrixTransformation3D> animator;
+    CORRADE_COMPARE(animator.size(), 0);
+    CORRADE_COMPARE(animator.duration(), 0.0f);
+    CORRADE_VERIFY(!animator.isRepeated());
+
+    /* A track without any keyframes just sets the default values */
+    CORRADE_COMPARE(animator.add(object, Vector3::xAxis(2.0f), {}, Vector3{3.0f}), 0);
+    CORRADE_COMPARE(animator.size(), 1);
+    CORRADE_COMPARE(animator.duration(), 0.0f);
+
+    animator.advance(1.0f);
+    CORRADE_COMPARE(object.transformation(), Matrix4::translation(Vector3::xAxis(2.0f))*Matrix4::scaling(Vector3{3.0f}));
+}
+
+void TrackAnimatorTest::constant() {
+    Object3D object;
+    TrackAnimator<MatrixTransformation3D> animator;
+    const Float times[]{0.0f, 1.0f, 3.0f};
+    const Vector3 translations[]{Vector3::xAxis(1.0f), Vector3::xAxis(2.0f), Vector3::xAxis(3.0f)};
+    animator.setTranslations(animator.add(object), times, translations, TrackInterpolation::Constant);
+    CORRADE_COMPARE(animator.duration(), 3.0f);
+
+    animator.advance(0.5f);
+    CORRADE_COMPARE(object.transformation().translation(), Vector3::xAxis(1.0f));
+    animator.advance(1.0f);
+    CORRADE_COMPARE(object.transformation().translation(), Vector3::xAxis(2.0f));
+    animator.advance(2.9f);
+    CORRADE_COMPARE(object.transformation().translation(), Vector3::xAxis(2.0f));
+}
+
+void TrackAnimatorTest::linear() {
+    Object3D object;
+    TrackAnimator<MatrixTransformation3D> animator;
+    const Float times[]{0.0f, 1.0f, 3.0f};
+    const Vector3 scalings[]{Vector3{1.0f}, Vector3{2.0f}, Vector3{4.0f, 1.0f, 0.0f}};
+    animator.setScalings(animator.add(object), times, scalings, TrackInterpolation::Linear);
+
+    animator.advance(0.25f);
+    CORRADE_COMPARE(object.transformation(), Matrix4::scaling(Vector3{1.25f}));
+    animator.advance(2.0f);
+    CORRADE_COMPARE(object.transformation(), Matrix4::scaling({3.0f, 1.5f, 1.0f}));
+}
+
+void TrackAnimatorTest::spherical() {
+    Object3D object;
+    TrackAnimator<MatrixTransformation3D> animator;
+    const Float times[]{0.0f, 2.0f};
+    const Quaternion rotations[]{
+        Quaternion::rotation(0.0_degf, Vector3::zAxis()),
+        Quaternion::rotation(120.0_degf, Vector3::zAxis())};
+    animator.setRotations(animator.add(object), times, rotations, TrackInterpolation::Spherical);
+
+    animator.advance(0.5f);
+    CORRADE_COMPARE(object.transformation(), Matrix4::rotationZ(30.0_degf));
+
+    /* Normalized linear interpolation isn't uniform in angle */
+    const Quaternion nlerp = Math::lerp(rotations[0], rotations[1], 0.25f);
+    CORRADE_VERIFY(nlerp.angle() != Rad(60.0_degf)/2.0f);
+}
+
+void TrackAnimatorTest::sphericalShortestPath() {
+    Object3D object;
+    TrackAnimator<MatrixTransformation3D> animator;
+    const Float times[]{0.0f, 1.0f};
+    /* The second quaternion is the same rotation as 90° about Z, but in the
+       opposite hemisphere */
+    const Quaternion rotations[]{
+        Quaternion{},
+        -Quaternion::rotation(90.0_degf, Vector3::zAxis())};
+    animator.setRotations(animator.add(object), times, rotations, TrackInterpolation::Spherical);
+
+    animator.advance(0.5f);
+    CORRADE_COMPARE(object.transformation(), Matrix4::rotationZ(45.0_degf));
+}
+
+void TrackAnimatorTest::cubic() {
+    Object3D object;
+    TrackAnimator<MatrixTransformation3D> animator;
+    const Float times[]{0.0f, 1.0f, 2.0f, 3.0f};
+    const Vector3 translations[]{
+        Vector3{0.0f}, Vector3{1.0f}, Vector3{2.0f}, Vector3{3.0f}};
+    const Vector3 bumps[]{
+        Vector3{0.0f}, Vector3{1.0f}, Vector3{0.0f}, Vector3{0.0f}};
+    UnsignedInt track = animator.add(object);
+    animator.setTranslations(track, times, translations, TrackInterpolation::Cubic);
+
+    /* Linear data stay linear */
+    animator.advance(1.25f);
+    CORRADE_COMPARE(object.transformation().translation(), Vector3{1.25f});
+
+    /* Passes through the keyframes, smooth in between */
+    Object3D another;
+    track = animator.add(another);
+    animator.setTranslations(track, times, bumps, TrackInterpolation::Cubic);
+    animator.advance(1.0f);
+    CORRADE_COMPARE(another.transformation().translation(), Vector3{1.0f});
+    animator.advance(1.5f);
+    CORRADE_COMPARE(another.transformation().translation(), Vector3{0.5625f});
+    animator.advance(0.5f);
+    CORRADE_COMPARE(another.transformation().translation(), Vector3{0.625f});
+}
+
+void TrackAnimatorTest::composition() {
+    Object3D object;
+    TrackAnimator<MatrixTransformation3D> animator;
+    const Float times[]{0.0f, 1.0f};
+    const Vector3 translations[]{Vector3::xAxis(0.0f), Vector3::xAxis(4.0f)};
+    const Quaternion rotations[]{
+        Quaternion{},
+        Quaternion::rotation(90.0_degf, Vector3::yAxis())};
+    const Vector3 scalings[]{Vector3{1.0f}, Vector3{1.0f, 3.0f, 1.0f}};
+    const UnsignedInt track = animator.add(object);
+    animator.setTranslations(track, times, translations, TrackInterpolation::Linear)
+        .setRotations(track, times, rotations, TrackInterpolation::Spherical)
+        .setScalings(track, times, scalings, TrackInterpolation::Linear);
+
+    animator.advance(0.5f);
+    CORRADE_COMPARE(object.transformation(),
+        Matrix4::translation(Vector3::xAxis(2.0f))*
+        Matrix4::rotationY(45.0_degf)*
+        Matrix4::scaling({1.0f, 2.0f, 1.0f}));
+}
+
+void TrackAnimatorTest::outsideRange() {
+    Object3D object;
+    TrackAnimator<MatrixTransformation3D> animator;
+    const Float times[]{1.0f, 2.0f};
+    const Vector3 translations[]{Vector3::xAxis(1.0f), Vector3::xAxis(2.0f)};
+    animator.setTranslations(animator.add(object), times, translations, TrackInterpolation::Cubic);
+
+    animator.advance(0.0f);
+    CORRADE_COMPARE(object.transformation().translation(), Vector3::xAxis(1.0f));
+    animator.advance(5.0f);
+    CORRADE_COMPARE(object.transformation().translation(), Vector3::xAxis(2.0f));
+}
+
+void TrackAnimatorTest::backwards() {
+    Object3D object;
+    TrackAnimator<MatrixTransformation3D> animator;
+    const Float times[]{0.0f, 1.0f, 2.0f, 3.0f, 4.0f};
+    const Vector3 translations[]{
+        Vector3::xAxis(0.0f), Vector3::xAxis(1.0f), Vector3::xAxis(4.0f),
+        Vector3::xAxis(9.0f), Vector3::xAxis(16.0f)};
+    animator.setTranslations(animator.add(object), times, translations, TrackInterpolation::Linear);
+
+    /* The remembered keyframe doesn't break going back in time */
+    animator.advance(3.5f);
+    CORRADE_COMPARE(object.transformation().translation(), Vector3::xAxis(12.5f));
+    animator.advance(0.5f);
+    CORRADE_COMPARE(object.transformation().translation(), Vector3::xAxis(0.5f));
+    animator.advance(2.5f);
+    CORRADE_COMPARE(object.transformation().translation(), Vector3::xAxis(6.5f));
+}
+
+void TrackAnimatorTest::repeat() {
+    Object3D object;
+    TrackAnimator<MatrixTransformation3D> animator;
+    const Float times[]{0.0f, 2.0f};
+    const Vector3 translations[]{Vector3::xAxis(0.0f), Vector3::xAxis(4.0f)};
+    animator.setTranslations(animator.add(object), times, translations, TrackInterpolation::Linear);
+
+    animator.advance(5.0f);
+    CORRADE_COMPARE(object.transformation().translation(), Vector3::xAxis(4.0f));
+
+    animator.setRepeated(true);
+    CORRADE_VERIFY(animator.isRepeated());
+    animator.advance(5.0f);
+    CORRADE_COMPARE(object.transformation().translation(), Vector3::xAxis(2.0f));
+    animator.advance(-0.5f);
+    CORRADE_COMPARE(object.transformation().translation(), Vector3::xAxis(3.0f));
+}
+
+void TrackAnimatorTest::dualQuaternion() {
+    Object<DualQuaternionTransformation> object;
+    TrackAnimator<DualQuaternionTransformation> animator;
+    const Float times[]{0.0f, 1.0f};
+    const Quaternion rotations[]{
+        Quaternion{},
+        Quaternion::rotation(90.0_degf, Vector3::xAxis())};
+    animator.setRotations(animator.add(object, Vector3::zAxis(1.0f)), times, rotations, TrackInterpolation::Linear);
+
+    animator.advance(1.0f);
+    CORRADE_COMPARE(object.transformation(), DualQuaternion::translation(Vector3::zAxis(1.0f))*DualQuaternion::rotation(90.0_degf, Vector3::xAxis()));
+}
+
+void TrackAnimatorTest::clear() {
+    Object3D object;
+    TrackAnimator<MatrixTransformation3D> animator;
+    const Float times[]{0.0f, 2.0f};
+    const Vector3 translations[]{Vector3::xAxis(0.0f), Vector3::xAxis(4.0f)};
+    animator.setTranslations(animator.add(object), times, translations, TrackInterpolation::Linear);
+    CORRADE_COMPARE(animator.duration(), 2.0f);
+
+    animator.clear();
+    CORRADE_COMPARE(animator.size(), 0);
+    CORRADE_COMPARE(animator.duration(), 0.0f);
+
+    /* Doesn't touch the object anymore */
+    object.translate(Vector3::yAxis(1.0f));
+    animator.advance(1.0f);
+    CORRADE_COMPARE(object.transformation().translation(), Vector3::yAxis(1.0f));
+}
+
+void TrackAnimatorTest::invalidTrack() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    TrackAnimator<MatrixTransformation3D> animator;
+    const Float times[]{0.0f};
+    const Vector3 translations[]{Vector3{}};
+    animator.setTranslations(0, times, translations, TrackInterpolation::Linear);
+    CORRADE_COMPARE(out.str(), "SceneGraph::TrackAnimator::setTranslations(): track 0 out of range for 0 tracks\n");
+}
+
+void TrackAnimatorTest::invalidKeyframes() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Object3D object;
+    TrackAnimator<MatrixTransformation3D> animator;
+    const UnsignedInt track = animator.add(object);
+    const Float times[]{0.0f, 2.0f, 1.0f};
+    const Vector3 translations[]{Vector3{}, Vector3{}, Vector3{}};
+    const Quaternion rotations[]{Quaternion{}, Quaternion{}, Quaternion{{}, 2.0f}};
+    animator.setTranslations(track, {times, 2}, translations, TrackInterpolation::Linear);
+    animator.setTranslations(track, times, translations, TrackInterpolation::Linear);
+    animator.setRotations(track, {times, 2}, {rotations + 1, 2}, TrackInterpolation::Linear);
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::TrackAnimator::setTranslations(): expected the same non-zero count of times and values, got 2 and 3\n"
+        "SceneGraph::TrackAnimator::setTranslations(): times are not sorted\n"
+        "SceneGraph::TrackAnimator::setRotations(): rotations are not normalized\n");
+
+    out.str({});
+    animator.setScalings(track, {times, 2}, {translations, 2}, TrackInterpolation::Linear);
+    animator.setScalings(track, {times, 2}, {translations, 2}, TrackInterpolation::Linear);
+    CORRADE_COMPARE(out.str(), "SceneGraph::TrackAnimator::setScalings(): keyframes already set\n");
+}
+
+void TrackAnimatorTest::invalidInterpolation() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Object3D object;
+    TrackAnimator<MatrixTransformation3D> animator;
+    const UnsignedInt track = animator.add(object);
+    const Float times[]{0.0f};
+    const Vector3 translations[]{Vector3{}};
+    const Quaternion rotations[]{Quaternion{}};
+    animator.setTranslations(track, times, translations, TrackInterpolation::Spherical);
+    animator.setRotations(track, times, rotations, TrackInterpolation::Cubic);
+    animator.setScalings(track, times, translations, TrackInterpolation::Spherical);
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::TrackAnimator::setTranslations(): spherical interpolation is allowed only for rotations\n"
+        "SceneGraph::TrackAnimator::setRotations(): cubic interpolation is allowed only for translations and scalings\n"
+        "SceneGraph::TrackAnimator::setScalings(): spherical interpolation is allowed only for rotations\n");
+}
+
+void TrackAnimatorTest::debugInterpolation() {
+    std::ostringstream out;
+    Debug(&out) << TrackInterpolation::Spherical << TrackInterpolation(0xbe);
+    CORRADE_COMPARE(out.str(), "SceneGraph::TrackInterpolation::Spherical SceneGraph::TrackInterpolation(0xbe)\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::TrackAnimatorTest)
@@ -0,0 +1,273 @@
+#ifndef Magnum_SceneGraph_TrackAnimator_h
+#define Magnum_SceneGraph_TrackAnimator_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::TrackAnimator, enum @ref Magnum::SceneGraph::TrackInterpolation
+ */
+
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/SceneGraph/SceneGraph.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Track interpolation
+
+@see @ref TrackAnimator::setTranslations(), @ref TrackAnimator::setRotations(),
+    @ref TrackAnimator::setScalings()
+*/
+enum class TrackInterpolation: UnsignedByte {
+    /** Value of the previous keyframe is used until the next one is reached */
+    Constant,
+
+    /**
+     * Linear interpolation. Vectors are interpolated using
+     * @ref Math::lerp(), rotations using normalized linear interpolation,
+     * see @ref Math::lerp(const Quaternion<T>&, const Quaternion<T>&, T).
+     */
+    Linear,
+
+    /**
+     * Spherical linear interpolation using
+     * @ref Math::slerp(const Quaternion<T>&, const Quaternion<T>&, T). Allowed
+     * only for rotations.
+     */
+    Spherical,
+
+    /**
+     * Cubic Hermite spline with Catmull-Rom tangents, passing through all
+     * keyframes. Allowed only for translations and scalings.
+     */
+    Cubic
+};
+
+/** @debugoperatorenum{Magnum::SceneGraph::TrackInterpolation} */
+MAGNUM_SCENEGRAPH_EXPORT Debug& operator<<(Debug& debug, TrackInterpolation value);
+
+/**
+@brief Keyframe track animator
+
+Evaluates keyframed translation, rotation and scaling tracks of many objects
+in a single pass and writes the result directly into their transformations.
+Compared to @ref Animable, there is no virtual call per object and keyframes
+of all tracks are stored in a few contiguous arrays, which makes it suitable
+for animating tens of thousands of objects. Usage example:
+@code
+Scene3D scene;
+SceneGraph::TrackAnimator<SceneGraph::MatrixTransformation3D> animator;
+
+Object3D spinner{&scene};
+UnsignedInt track = animator.add(spinner, Vector3::xAxis(5.0f));
+const Float times[]{0.0f, 1.0f, 2.0f};
+const Quaternion rotations[]{
+    Quaternion::rotation(0.0_degf, Vector3::yAxis()),
+    Quaternion::rotation(180.0_degf, Vector3::yAxis()),
+    Quaternion::rotation(360.0_degf, Vector3::yAxis())};
+animator.setRotations(track, times, rotations, SceneGraph::TrackInterpolation::Spherical);
+animator.setRepeated(true);
+
+// each frame
+animator.advance(timeline.previousFrameTime());
+@endcode
+
+Each track has three channels --- translation, rotation and scaling. Channels
+without keyframes use the constant value passed to @ref add(). Outside of the
+keyframe range of a channel the first or last keyframe value is used. The
+resulting transformation is composed as translation * rotation * scaling and
+converted to the object transformation using `setTransformation()` of given
+transformation implementation, so it can be used only with 3D
+transformation implementations that can represent it. In particular,
+@ref DualQuaternionTransformation and @ref RigidMatrixTransformation3D can't
+represent scaling, so no scaling keyframes should be used with them.
+
+Rotations are interpolated along the shorter path, i.e. the second quaternion
+is negated if the dot product of the two is negative. The keyframe search
+remembers the last used keyframe for each channel, so advancing the time
+monotonically costs only a constant amount of work per channel.
+
+## Explicit template specializations
+
+The following specializations are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type or special transformation class) you have to use @ref TrackAnimator.hpp
+implementation file to avoid linker errors. See also
+@ref compilation-speedup-hpp for more information.
+
+-   @ref DualQuaternionTransformation "TrackAnimator<DualQuaternionTransformation>"
+-   @ref MatrixTransformation3D "TrackAnimator<MatrixTransformation3D>"
+-   @ref RigidMatrixTransformation3D "TrackAnimator<RigidMatrixTransformation3D>"
+
+@see @ref scenegraph, @ref Animable
+*/
+template<class Transformation> class TrackAnimator {
+    static_assert(Transformation::Dimensions == 3, "only 3D transformations are supported");
+
+    public:
+        /** @brief Underlying floating-point type */
+        typedef typename Transformation::Type Type;
+
+        explicit TrackAnimator();
+
+        /** @brief Copying is not allowed */
+        TrackAnimator(const TrackAnimator<Transformation>&) = delete;
+
+        /** @brief Move constructor */
+        TrackAnimator(TrackAnimator<Transformation>&&) noexcept;
+
+        ~TrackAnimator();
+
+        /** @brief Copying is not allowed */
+        TrackAnimator<Transformation>& operator=(const TrackAnimator<Transformation>&) = delete;
+
+        /** @brief Move assignment */
+        TrackAnimator<Transformation>& operator=(TrackAnimator<Transformation>&&) noexcept;
+
+        /** @brief Count of tracks */
+        std::size_t size() const { return _tracks.size(); }
+
+        /**
+         * @brief Animation duration
+         *
+         * Time of the last keyframe of all tracks, `0` if there are no
+         * keyframes.
+         */
+        Float duration() const { return _duration; }
+
+        /** @brief Whether the animation is repeated */
+        bool isRepeated() const { return _repeated; }
+
+        /**
+         * @brief Enable or disable repeat
+         * @return Reference to self (for method chaining)
+         *
+         * If enabled, the time passed to @ref advance() is wrapped to range
+         * @f$ [0, d) @f$, where @f$ d @f$ is @ref duration(). Disabled by
+         * default.
+         */
+        TrackAnimator<Transformation>& setRepeated(bool repeated) {
+            _repeated = repeated;
+            return *this;
+        }
+
+        /**
+         * @brief Add a track
+         * @param object        Object to animate
+         * @param translation   Translation used if the track has no
+         *      translation keyframes
+         * @param rotation      Rotation used if the track has no rotation
+         *      keyframes
+         * @param scaling       Scaling used if the track has no scaling
+         *      keyframes
+         * @return Track ID
+         *
+         * The object must outlive the animator or all its tracks must be
+         * removed using @ref clear() before the object is destroyed.
+         */
+        UnsignedInt add(Object<Transformation>& object, const Math::Vector3<Type>& translation = {}, const Math::Quaternion<Type>& rotation = {}, const Math::Vector3<Type>& scaling = Math::Vector3<Type>{Type(1)});
+
+        /**
+         * @brief Set translation keyframes
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the track exists, doesn't have translation keyframes
+         * set already, both views have the same non-zero size, the times are
+         * sorted and @p interpolation is not @ref TrackInterpolation::Spherical.
+         */
+        TrackAnimator<Transformation>& setTranslations(UnsignedInt track, Containers::ArrayView<const Float> times, Containers::ArrayView<const Math::Vector3<Type>> values, TrackInterpolation interpolation);
+
+        /**
+         * @brief Set rotation keyframes
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the track exists, doesn't have rotation keyframes set
+         * already, both views have the same non-zero size, the times are
+         * sorted, the quaternions are normalized and @p interpolation is not
+         * @ref TrackInterpolation::Cubic.
+         */
+        TrackAnimator<Transformation>& setRotations(UnsignedInt track, Containers::ArrayView<const Float> times, Containers::ArrayView<const Math::Quaternion<Type>> values, TrackInterpolation interpolation);
+
+        /**
+         * @brief Set scaling keyframes
+         * @return Reference to self (for method chaining)
+         *
+         * Same requirements as for @ref setTranslations() apply.
+         */
+        TrackAnimator<Transformation>& setScalings(UnsignedInt track, Containers::ArrayView<const Float> times, Containers::ArrayView<const Math::Vector3<Type>> values, TrackInterpolation interpolation);
+
+        /** @brief Remove all tracks and keyframes */
+        void clear();
+
+        /**
+         * @brief Advance the animation
+         * @param time      Absolute animation time
+         *
+         * Evaluates all tracks at given time and sets the resulting
+         * transformation to all animated objects.
+         */
+        void advance(Float time);
+
+    private:
+        struct Channel {
+            UnsignedInt offset, count;
+            UnsignedInt hint;
+            TrackInterpolation interpolation;
+        };
+
+        struct Track {
+            Object<Transformation>* object;
+            Channel translation, rotation, scaling;
+            Math::Vector3<Type> defaultTranslation;
+            Math::Quaternion<Type> defaultRotation;
+            Math::Vector3<Type> defaultScaling;
+        };
+
+        void setChannel(Channel& channel, std::vector<Float>& channelTimes, Containers::ArrayView<const Float> times, TrackInterpolation interpolation);
+
+        std::vector<Track> _tracks;
+        std::vector<Float> _translationTimes, _rotationTimes, _scalingTimes;
+        std::vector<Math::Vector3<Type>> _translations;
+        std::vector<Math::Quaternion<Type>> _rotations;
+        std::vector<Math::Vector3<Type>> _scalings;
+        Float _duration;
+        bool _repeated;
+};
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT TrackAnimator<BasicDualQuaternionTransformation<Float>>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT TrackAnimator<BasicMatrixTransformation3D<Float>>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT TrackAnimator<BasicRigidMatrixTransformation3D<Float>>;
+#endif
+
+}}
+
+#endif
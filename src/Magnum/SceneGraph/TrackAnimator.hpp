@@ -0,0 +1,212 @@
+#ifndef Magnum_SceneGraph_TrackAnimator_hpp
+#define Magnum_SceneGraph_TrackAnimator_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref TrackAnimator.h
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneGraph/Object.h"
+#include "Magnum/SceneGraph/TrackAnimator.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+
+/* Finds keyframe index i so times[i] <= time < times[i + 1], starting from
+   the hint. Monotonically increasing time thus needs just a few steps. */
+inline UnsignedInt trackKeyframe(const Float* const times, const UnsignedInt count, UnsignedInt& hint, const Float time) {
+    UnsignedInt i = hint;
+    if(i >= count || times[i] > time)
+        i = std::max(UnsignedInt(std::upper_bound(times, times + count, time) - times), 1u) - 1;
+    else while(i + 2 <= count && times[i + 1] <= time) ++i;
+    return hint = i;
+}
+
+template<class T> Math::Vector3<T> trackValue(const Float* const times, const Math::Vector3<T>* const values, const UnsignedInt count, const UnsignedInt i, const Float time, const TrackInterpolation interpolation) {
+    if(i + 1 == count || time <= times[i]) return values[i];
+
+    const Float duration = times[i + 1] - times[i];
+    const T t = T((time - times[i])/duration);
+    if(interpolation == TrackInterpolation::Linear)
+        return Math::lerp(values[i], values[i + 1], t);
+    if(interpolation != TrackInterpolation::Cubic)
+        return values[i];
+
+    /* Catmull-Rom tangents scaled to the segment duration, one-sided at the
+       track ends */
+    const Math::Vector3<T> tangentA = i == 0 ? values[1] - values[0] :
+        (values[i + 1] - values[i - 1])*T(duration/(times[i + 1] - times[i - 1]));
+    const Math::Vector3<T> tangentB = i + 2 == count ? values[i + 1] - values[i] :
+        (values[i + 2] - values[i])*T(duration/(times[i + 2] - times[i]));
+    const T t2 = t*t;
+    const T t3 = t2*t;
+    return (T(2)*t3 - T(3)*t2 + T(1))*values[i] + (t3 - T(2)*t2 + t)*tangentA +
+        (T(-2)*t3 + T(3)*t2)*values[i + 1] + (t3 - t2)*tangentB;
+}
+
+template<class T> Math::Quaternion<T> trackValue(const Float* const times, const Math::Quaternion<T>* const values, const UnsignedInt count, const UnsignedInt i, const Float time, const TrackInterpolation interpolation) {
+    if(i + 1 == count || time <= times[i] || interpolation == TrackInterpolation::Constant)
+        return values[i];
+
+    const T t = T((time - times[i])/(times[i + 1] - times[i]));
+
+    /* Take the shorter path */
+    const Math::Quaternion<T> b = Math::dot(values[i], values[i + 1]) < T(0) ? -values[i + 1] : values[i + 1];
+    return interpolation == TrackInterpolation::Spherical ?
+        Math::slerp(values[i], b, t) : Math::lerp(values[i], b, t);
+}
+
+}
+
+template<class Transformation> TrackAnimator<Transformation>::TrackAnimator(): _duration{0.0f}, _repeated{false} {}
+
+template<class Transformation> TrackAnimator<Transformation>::TrackAnimator(TrackAnimator<Transformation>&&) noexcept = default;
+
+template<class Transformation> TrackAnimator<Transformation>::~TrackAnimator() = default;
+
+template<class Transformation> TrackAnimator<Transformation>& TrackAnimator<Transformation>::operator=(TrackAnimator<Transformation>&&) noexcept = default;
+
+template<class Transformation> UnsignedInt TrackAnimator<Transformation>::add(Object<Transformation>& object, const Math::Vector3<Type>& translation, const Math::Quaternion<Type>& rotation, const Math::Vector3<Type>& scaling) {
+    _tracks.push_back({&object, {}, {}, {}, translation, rotation, scaling});
+    return _tracks.size() - 1;
+}
+
+template<class Transformation> void TrackAnimator<Transformation>::setChannel(Channel& channel, std::vector<Float>& channelTimes, const Containers::ArrayView<const Float> times, const TrackInterpolation interpolation) {
+    channel.offset = channelTimes.size();
+    channel.count = times.size();
+    channel.hint = 0;
+    channel.interpolation = interpolation;
+    channelTimes.insert(channelTimes.end(), times.begin(), times.end());
+    _duration = std::max(_duration, times[times.size() - 1]);
+}
+
+template<class Transformation> TrackAnimator<Transformation>& TrackAnimator<Transformation>::setTranslations(const UnsignedInt track, const Containers::ArrayView<const Float> times, const Containers::ArrayView<const Math::Vector3<Type>> values, const TrackInterpolation interpolation) {
+    CORRADE_ASSERT(track < _tracks.size(),
+        "SceneGraph::TrackAnimator::setTranslations(): track" << track << "out of range for" << _tracks.size() << "tracks", *this);
+    CORRADE_ASSERT(!_tracks[track].translation.count,
+        "SceneGraph::TrackAnimator::setTranslations(): keyframes already set", *this);
+    CORRADE_ASSERT(!times.empty() && times.size() == values.size(),
+        "SceneGraph::TrackAnimator::setTranslations(): expected the same non-zero count of times and values, got" << times.size() << "and" << values.size(), *this);
+    CORRADE_ASSERT(std::is_sorted(times.begin(), times.end()),
+        "SceneGraph::TrackAnimator::setTranslations(): times are not sorted", *this);
+    CORRADE_ASSERT(interpolation != TrackInterpolation::Spherical,
+        "SceneGraph::TrackAnimator::setTranslations(): spherical interpolation is allowed only for rotations", *this);
+
+    setChannel(_tracks[track].translation, _translationTimes, times, interpolation);
+    _translations.insert(_translations.end(), values.begin(), values.end());
+    return *this;
+}
+
+template<class Transformation> TrackAnimator<Transformation>& TrackAnimator<Transformation>::setRotations(const UnsignedInt track, const Containers::ArrayView<const Float> times, const Containers::ArrayView<const Math::Quaternion<Type>> values, const TrackInterpolation interpolation) {
+    CORRADE_ASSERT(track < _tracks.size(),
+        "SceneGraph::TrackAnimator::setRotations(): track" << track << "out of range for" << _tracks.size() << "tracks", *this);
+    CORRADE_ASSERT(!_tracks[track].rotation.count,
+        "SceneGraph::TrackAnimator::setRotations(): keyframes already set", *this);
+    CORRADE_ASSERT(!times.empty() && times.size() == values.size(),
+        "SceneGraph::TrackAnimator::setRotations(): expected the same non-zero count of times and values, got" << times.size() << "and" << values.size(), *this);
+    CORRADE_ASSERT(std::is_sorted(times.begin(), times.end()),
+        "SceneGraph::TrackAnimator::setRotations(): times are not sorted", *this);
+    CORRADE_ASSERT(std::all_of(values.begin(), values.end(), [](const Math::Quaternion<Type>& q) { return q.isNormalized(); }),
+        "SceneGraph::TrackAnimator::setRotations(): rotations are not normalized", *this);
+    CORRADE_ASSERT(interpolation != TrackInterpolation::Cubic,
+        "SceneGraph::TrackAnimator::setRotations(): cubic interpolation is allowed only for translations and scalings", *this);
+
+    setChannel(_tracks[track].rotation, _rotationTimes, times, interpolation);
+    _rotations.insert(_rotations.end(), values.begin(), values.end());
+    return *this;
+}
+
+template<class Transformation> TrackAnimator<Transformation>& TrackAnimator<Transformation>::setScalings(const UnsignedInt track, const Containers::ArrayView<const Float> times, const Containers::ArrayView<const Math::Vector3<Type>> values, const TrackInterpolation interpolation) {
+    CORRADE_ASSERT(track < _tracks.size(),
+        "SceneGraph::TrackAnimator::setScalings(): track" << track << "out of range for" << _tracks.size() << "tracks", *this);
+    CORRADE_ASSERT(!_tracks[track].scaling.count,
+        "SceneGraph::TrackAnimator::setScalings(): keyframes already set", *this);
+    CORRADE_ASSERT(!times.empty() && times.size() == values.size(),
+        "SceneGraph::TrackAnimator::setScalings(): expected the same non-zero count of times and values, got" << times.size() << "and" << values.size(), *this);
+    CORRADE_ASSERT(std::is_sorted(times.begin(), times.end()),
+        "SceneGraph::TrackAnimator::setScalings(): times are not sorted", *this);
+    CORRADE_ASSERT(interpolation != TrackInterpolation::Spherical,
+        "SceneGraph::TrackAnimator::setScalings(): spherical interpolation is allowed only for rotations", *this);
+
+    setChannel(_tracks[track].scaling, _scalingTimes, times, interpolation);
+    _scalings.insert(_scalings.end(), values.begin(), values.end());
+    return *this;
+}
+
+template<class Transformation> void TrackAnimator<Transformation>::clear() {
+    _tracks.clear();
+    _translationTimes.clear();
+    _rotationTimes.clear();
+    _scalingTimes.clear();
+    _translations.clear();
+    _rotations.clear();
+    _scalings.clear();
+    _duration = 0.0f;
+}
+
+template<class Transformation> void TrackAnimator<Transformation>::advance(Float time) {
+    if(_repeated && _duration > 0.0f) {
+        time = std::fmod(time, _duration);
+        if(time < 0.0f) time += _duration;
+    }
+
+    for(Track& track: _tracks) {
+        Math::Vector3<Type> translation = track.defaultTranslation;
+        if(const UnsignedInt count = track.translation.count) {
+            const Float* const times = _translationTimes.data() + track.translation.offset;
+            const UnsignedInt i = Implementation::trackKeyframe(times, count, track.translation.hint, time);
+            translation = Implementation::trackValue(times, _translations.data() + track.translation.offset, count, i, time, track.translation.interpolation);
+        }
+
+        Math::Quaternion<Type> rotation = track.defaultRotation;
+        if(const UnsignedInt count = track.rotation.count) {
+            const Float* const times = _rotationTimes.data() + track.rotation.offset;
+            const UnsignedInt i = Implementation::trackKeyframe(times, count, track.rotation.hint, time);
+            rotation = Implementation::trackValue(times, _rotations.data() + track.rotation.offset, count, i, time, track.rotation.interpolation);
+        }
+
+        Math::Vector3<Type> scaling = track.defaultScaling;
+        if(const UnsignedInt count = track.scaling.count) {
+            const Float* const times = _scalingTimes.data() + track.scaling.offset;
+            const UnsignedInt i = Implementation::trackKeyframe(times, count, track.scaling.hint, time);
+            scaling = Implementation::trackValue(times, _scalings.data() + track.scaling.offset, count, i, time, track.scaling.interpolation);
+        }
+
+        /* Scale the rotation matrix columns instead of multiplying by a
+           scaling matrix */
+        Math::Matrix3x3<Type> rotationScaling = rotation.toMatrix();
+        for(std::size_t j = 0; j != 3; ++j) rotationScaling[j] *= scaling[j];
+        track.object->setTransformation(Implementation::Transformation<Transformation>::fromMatrix(Math::Matrix4<Type>::from(rotationScaling, translation)));
+    }
+}
+}}
+
+#endif
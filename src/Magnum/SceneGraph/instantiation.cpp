@@ -30,11 +30,21 @@
 #include "Magnum/SceneGraph/DualComplexTransformation.h"
 #include "Magnum/SceneGraph/DualQuaternionTransformation.h"
 #include "Magnum/SceneGraph/FeatureGroup.hpp"
+#include "Magnum/SceneGraph/FlatTransformationCache.hpp"
+#include "Magnum/SceneGraph/HlodCluster.hpp"
+#include "Magnum/SceneGraph/HlodDrawable.hpp"
+#include "Magnum/SceneGraph/InstanceCollector.hpp"
+#include "Magnum/SceneGraph/Interpolable.hpp"
+#include "Magnum/SceneGraph/LodDrawable.hpp"
 #include "Magnum/SceneGraph/MatrixTransformation2D.h"
 #include "Magnum/SceneGraph/MatrixTransformation3D.h"
 #include "Magnum/SceneGraph/Object.hpp"
+#include "Magnum/SceneGraph/RenderQueue.hpp"
 #include "Magnum/SceneGraph/RigidMatrixTransformation2D.h"
 #include "Magnum/SceneGraph/RigidMatrixTransformation3D.h"
+#include "Magnum/SceneGraph/SpatialIndex.hpp"
+#include "Magnum/SceneGraph/StaticBatch.hpp"
+#include "Magnum/SceneGraph/TrackAnimator.hpp"
 #include "Magnum/SceneGraph/TranslationTransformation.h"
 
 namespace Magnum { namespace SceneGraph {
@@ -69,6 +79,23 @@ template class MAGNUM_SCENEGRAPH_EXPORT_HPP Camera<3, Float>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Drawable<2, Float>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Drawable<3, Float>;
 
+template MAGNUM_SCENEGRAPH_EXPORT_HPP std::vector<HlodCluster<2, Float>> hlodClusters(AbstractObject<2, Float>&, DrawableGroup<2, Float>&, Float);
+template MAGNUM_SCENEGRAPH_EXPORT_HPP std::vector<HlodCluster<3, Float>> hlodClusters(AbstractObject<3, Float>&, DrawableGroup<3, Float>&, Float);
+
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP HlodDrawable<2, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP HlodDrawable<3, Float>;
+
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP InstanceCollector<2, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP InstanceCollector<3, Float>;
+
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP Interpolable<2, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP Interpolable<3, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP InterpolableGroup<2, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP InterpolableGroup<3, Float>;
+
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP LodDrawable<2, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP LodDrawable<3, Float>;
+
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<BasicDualComplexTransformation<Float>>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<BasicDualQuaternionTransformation<Float>>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<BasicMatrixTransformation2D<Float>>;
@@ -77,6 +104,28 @@ template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<BasicRigidMatrixTransformatio
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<BasicRigidMatrixTransformation3D<Float>>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<TranslationTransformation<2, Float>>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<TranslationTransformation<3, Float>>;
+
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP RenderQueue<2, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP RenderQueue<3, Float>;
+
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP BasicSpatial3D<Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP BasicSpatialIndex3D<Float>;
+
+template MAGNUM_SCENEGRAPH_EXPORT_HPP std::vector<StaticBatch<2, Float>> staticBatches(AbstractObject<2, Float>&, DrawableGroup<2, Float>&);
+template MAGNUM_SCENEGRAPH_EXPORT_HPP std::vector<StaticBatch<3, Float>> staticBatches(AbstractObject<3, Float>&, DrawableGroup<3, Float>&);
+
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP TrackAnimator<BasicDualQuaternionTransformation<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP TrackAnimator<BasicMatrixTransformation3D<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP TrackAnimator<BasicRigidMatrixTransformation3D<Float>>;
+
+template class MAGNUM_SCENEGRAPH_EXPORT FlatTransformationCache<BasicDualComplexTransformation<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT FlatTransformationCache<BasicDualQuaternionTransformation<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT FlatTransformationCache<BasicMatrixTransformation2D<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT FlatTransformationCache<BasicMatrixTransformation3D<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT FlatTransformationCache<BasicRigidMatrixTransformation2D<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT FlatTransformationCache<BasicRigidMatrixTransformation3D<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT FlatTransformationCache<TranslationTransformation<2, Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT FlatTransformationCache<TranslationTransformation<3, Float>>;
 #endif
 
 }}
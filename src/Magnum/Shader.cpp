@@ -810,6 +810,14 @@ Shader& Shader::addSource(std::string source) {
     return *this;
 }
 
+Shader& Shader::addSource(std::string source, std::string digest) {
+    if(source.empty()) return *this;
+
+    addSource(std::move(source));
+    _digests.emplace_back(_sources.size() - 1, std::move(digest));
+    return *this;
+}
+
 Shader& Shader::addFile(const std::string& filename) {
     CORRADE_ASSERT(Utility::Directory::fileExists(filename),
         "Shader file " << '\'' + filename + '\'' << " cannot be read.", *this);
@@ -819,13 +827,16 @@ Shader& Shader::addFile(const std::string& filename) {
 }
 
 bool Shader::compile(std::initializer_list<std::reference_wrapper<Shader>> shaders) {
-    bool allSuccess = true;
+    submitCompile(shaders);
+    return checkCompile(shaders);
+}
 
+void Shader::submitCompile(std::initializer_list<std::reference_wrapper<Shader>> shaders) {
     /* Allocate large enough array for source pointers and sizes (to avoid
        reallocating it for each of them) */
     std::size_t maxSourceCount = 0;
     for(Shader& shader: shaders) {
-        CORRADE_ASSERT(shader._sources.size() > 1, "Shader::compile(): no files added", false);
+        CORRADE_ASSERT(shader._sources.size() > 1, "Shader::compile(): no files added", );
         maxSourceCount = std::max(shader._sources.size(), maxSourceCount);
     }
     /** @todo ArrayTuple/VLAs */
@@ -844,8 +855,12 @@ bool Shader::compile(std::initializer_list<std::reference_wrapper<Shader>> shade
 
     /* Invoke (possibly parallel) compilation on all shaders */
     for(Shader& shader: shaders) glCompileShader(shader._id);
+}
 
-    /* After compilation phase, check status of all shaders */
+bool Shader::checkCompile(std::initializer_list<std::reference_wrapper<Shader>> shaders) {
+    bool allSuccess = true;
+
+    /* Check status of all shaders */
     Int i = 1;
     for(Shader& shader: shaders) {
         GLint success, logLength;
@@ -900,6 +915,18 @@ bool Shader::compile(std::initializer_list<std::reference_wrapper<Shader>> shade
     return allSuccess;
 }
 
+bool Shader::isCompileFinished() {
+    #ifndef MAGNUM_TARGET_WEBGL
+    if(Context::current().isExtensionSupported<Extensions::GL::KHR::parallel_shader_compile>()) {
+        GLint finished;
+        glGetShaderiv(_id, GL_COMPLETION_STATUS_KHR, &finished);
+        return finished == GL_TRUE;
+    }
+    #endif
+
+    return true;
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 Debug& operator<<(Debug& debug, const Shader::Type value) {
     switch(value) {
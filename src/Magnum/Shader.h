@@ -31,6 +31,7 @@
 
 #include <functional>
 #include <string>
+#include <utility>
 #include <vector>
 #include <Corrade/Containers/ArrayView.h>
 
@@ -50,6 +51,8 @@ Shader limits and implementation-defined values (such as @ref maxUniformComponen
 are cached, so repeated queries don't result in repeated @fn_gl{Get} calls.
  */
 class MAGNUM_EXPORT Shader: public AbstractObject {
+    friend AbstractShaderProgram;
+
     public:
         /**
          * @brief Shader type
@@ -507,6 +510,36 @@ class MAGNUM_EXPORT Shader: public AbstractObject {
          */
         static bool compile(std::initializer_list<std::reference_wrapper<Shader>> shaders);
 
+        /**
+         * @brief Submit multiple shaders for compilation
+         *
+         * Uploads sources of all shaders and starts their compilation, but
+         * doesn't wait for it to finish. Use @ref isCompileFinished() to
+         * poll for the completion and @ref checkCompile() to get the result.
+         * Calling this function and then @ref checkCompile() is equivalent to
+         * @ref compile(std::initializer_list<std::reference_wrapper<Shader>>).
+         *
+         * If @extension{KHR,parallel_shader_compile} is supported, the
+         * driver compiles the shaders in background threads and the
+         * application can continue with other work (e.g. rendering a
+         * loading screen) until the compilation finishes. Otherwise the
+         * compilation may block either here or in @ref checkCompile().
+         * @see @fn_gl{ShaderSource}, @fn_gl{CompileShader}
+         */
+        static void submitCompile(std::initializer_list<std::reference_wrapper<Shader>> shaders);
+
+        /**
+         * @brief Check compilation status of multiple shaders
+         *
+         * Waits until the compilation submitted with @ref submitCompile()
+         * finishes, returns `false` if compilation of any shader failed,
+         * `true` if everything succeeded. Compiler messages (if any) are
+         * printed to error output.
+         * @see @fn_gl{GetShader} with @def_gl{COMPILE_STATUS} and
+         *      @def_gl{INFO_LOG_LENGTH}, @fn_gl{GetShaderInfoLog}
+         */
+        static bool checkCompile(std::initializer_list<std::reference_wrapper<Shader>> shaders);
+
         /**
          * @brief Constructor
          * @param version   Target version
@@ -602,6 +635,20 @@ class MAGNUM_EXPORT Shader: public AbstractObject {
          */
         Shader& addSource(std::string source);
 
+        /**
+         * @brief Add shader source with precomputed digest
+         * @param source    String with shader source
+         * @param digest    Digest of the source
+         * @return Reference to self (for method chaining)
+         *
+         * Same as @ref addSource(std::string), but @ref ShaderProgramBinaryCache
+         * uses @p digest instead of the whole source when computing the
+         * program key, avoiding hashing the same source again for every
+         * program. The digest has to change with every change of the source.
+         * @see @ref ShaderSourceCache::addTo()
+         */
+        Shader& addSource(std::string source, std::string digest);
+
         /**
          * @brief Add source file
          * @param filename  Name of source file to read from
@@ -622,6 +669,19 @@ class MAGNUM_EXPORT Shader: public AbstractObject {
          */
         bool compile() { return compile({*this}); }
 
+        /**
+         * @brief Whether the compilation is finished
+         *
+         * If @extension{KHR,parallel_shader_compile} is supported, returns
+         * `false` while the compilation submitted with @ref submitCompile()
+         * is still in progress, in which case @ref checkCompile() would
+         * block. If the extension is not supported, always returns `true`.
+         * @see @fn_gl{GetShader} with @def_gl{COMPLETION_STATUS_KHR}
+         * @requires_gles Parallel shader compilation is not available in
+         *      WebGL, always returns `true` there.
+         */
+        bool isCompileFinished();
+
     private:
         Shader& setLabelInternal(Containers::ArrayView<const char> label);
 
@@ -629,12 +689,15 @@ class MAGNUM_EXPORT Shader: public AbstractObject {
         GLuint _id;
 
         std::vector<std::string> _sources;
+        /* Index into _sources and the digest to use in place of the source,
+           sorted by the index */
+        std::vector<std::pair<std::size_t, std::string>> _digests;
 };
 
 /** @debugoperatorclassenum{Magnum::Shader,Magnum::Shader::Type} */
 MAGNUM_EXPORT Debug& operator<<(Debug& debug, Shader::Type value);
 
-inline Shader::Shader(Shader&& other) noexcept: _type(other._type), _id(other._id), _sources(std::move(other._sources)) {
+inline Shader::Shader(Shader&& other) noexcept: _type(other._type), _id(other._id), _sources(std::move(other._sources)), _digests(std::move(other._digests)) {
     other._id = 0;
 }
 
@@ -643,6 +706,7 @@ inline Shader& Shader::operator=(Shader&& other) noexcept {
     swap(_type, other._type);
     swap(_id, other._id);
     swap(_sources, other._sources);
+    swap(_digests, other._digests);
     return *this;
 }
 
@@ -0,0 +1,140 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ShaderProgramBinaryCache.h"
+
+#include <chrono>
+#include <cstring>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/Sha1.h>
+
+#include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+
+#include "Implementation/ShaderProgramState.h"
+#include "Implementation/State.h"
+
+namespace Magnum {
+
+namespace {
+    /* Header of the cached file, followed by the binary itself */
+    struct BinaryHeader {
+        char magic[4];
+        char driverDigest[Utility::Sha1::DigestSize];
+        UnsignedInt format;
+        UnsignedLong linkTime;
+    };
+
+    constexpr const char BinaryMagic[] = {'M', 'G', 'P', 'B'};
+}
+
+bool ShaderProgramBinaryCache::isSupported() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::get_program_binary>())
+        return false;
+    #endif
+
+    GLint count = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &count);
+    return count > 0;
+}
+
+ShaderProgramBinaryCache::ShaderProgramBinaryCache(std::string directory): _directory{std::move(directory)}, _hits{}, _misses{}, _timeSaved{} {
+    Utility::Directory::mkpath(_directory);
+
+    const Context& context = Context::current();
+    const Utility::Sha1::Digest digest = Utility::Sha1::digest(context.vendorString() + '\n' + context.rendererString() + '\n' + context.versionString());
+    _driverDigest = std::string{digest.byteArray(), Utility::Sha1::DigestSize};
+}
+
+ShaderProgramBinaryCache::~ShaderProgramBinaryCache() {
+    if(Context::hasCurrent() && AbstractShaderProgram::binaryCache() == this)
+        AbstractShaderProgram::setBinaryCache(nullptr);
+}
+
+bool ShaderProgramBinaryCache::load(const GLuint id, const std::string& key) {
+    const std::string filename = Utility::Directory::join(_directory, key + ".bin");
+    if(!Utility::Directory::fileExists(filename)) {
+        ++_misses;
+        return false;
+    }
+
+    const auto start = std::chrono::high_resolution_clock::now();
+
+    /* Corrupted file or binary cached for another driver, will be
+       overwritten after the program is linked */
+    const Containers::Array<char> data = Utility::Directory::read(filename);
+    BinaryHeader header;
+    if(data.size() <= sizeof(BinaryHeader)) {
+        ++_misses;
+        return false;
+    }
+    std::memcpy(&header, data.data(), sizeof(BinaryHeader));
+    if(std::memcmp(header.magic, BinaryMagic, sizeof(BinaryMagic)) != 0 ||
+       std::memcmp(header.driverDigest, _driverDigest.data(), Utility::Sha1::DigestSize) != 0) {
+        ++_misses;
+        return false;
+    }
+
+    /* The driver is free to refuse the binary, e.g. after an update that
+       didn't change the version string */
+    glProgramBinary(id, header.format, data.data() + sizeof(BinaryHeader), data.size() - sizeof(BinaryHeader));
+    GLint success;
+    glGetProgramiv(id, GL_LINK_STATUS, &success);
+    if(!success) {
+        ++_misses;
+        return false;
+    }
+
+    const UnsignedLong loadTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start).count();
+    if(header.linkTime > loadTime) _timeSaved += header.linkTime - loadTime;
+    ++_hits;
+    return true;
+}
+
+void ShaderProgramBinaryCache::save(const GLuint id, const std::string& key, const UnsignedLong linkTime) {
+    GLint size;
+    glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &size);
+    if(!size) return;
+
+    BinaryHeader header;
+    std::memcpy(header.magic, BinaryMagic, sizeof(BinaryMagic));
+    std::memcpy(header.driverDigest, _driverDigest.data(), Utility::Sha1::DigestSize);
+    header.linkTime = linkTime;
+
+    Containers::Array<char> data{Containers::ValueInit, sizeof(BinaryHeader) + size};
+    GLenum format;
+    glGetProgramBinary(id, size, nullptr, &format, data.data() + sizeof(BinaryHeader));
+    header.format = format;
+    std::memcpy(data.data(), &header, sizeof(BinaryHeader));
+
+    const std::string filename = Utility::Directory::join(_directory, key + ".bin");
+    if(!Utility::Directory::write(filename, data))
+        Warning() << "ShaderProgramBinaryCache: cannot write program binary to" << filename;
+}
+
+}
@@ -0,0 +1,169 @@
+#ifndef Magnum_ShaderProgramBinaryCache_h
+#define Magnum_ShaderProgramBinaryCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+/** @file
+ * @brief Class @ref Magnum::ShaderProgramBinaryCache
+ */
+#endif
+
+#include <string>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/OpenGL.h"
+#include "Magnum/visibility.h"
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+namespace Magnum {
+
+/**
+@brief On-disk cache of linked shader program binaries
+
+Saves the binary representation of every successfully linked shader program
+into given directory and on next run uses it in @ref AbstractShaderProgram::link()
+instead of linking the program again. The cache is used for all shader
+programs, including the builtin ones in the @ref Shaders namespace, after it is
+made current with @ref AbstractShaderProgram::setBinaryCache():
+@code
+ShaderProgramBinaryCache cache{Utility::Directory::join(Utility::Directory::configurationDir("MyApp"), "shaders")};
+AbstractShaderProgram::setBinaryCache(&cache);
+
+Shaders::Phong shader; // linked from the cache on second run
+@endcode
+
+The cache should be set before creating the shader programs, as the program
+key is computed from all sources of the attached shaders and from bound
+attribute and fragment data locations and transform feedback outputs. The key
+thus changes with every change of the shader sources, which then results in a
+cache miss and the binary being saved again. The cached binaries are
+additionally tagged with a hash of @ref Context::vendorString(),
+@ref Context::rendererString() and @ref Context::versionString() and
+discarded when the driver changes. A binary that the driver refuses to load is
+also treated like a cache miss and the program is linked as usual.
+
+Note that the shaders are still compiled with @ref Shader::compile(), only the
+linking is skipped. Cache efficiency can be checked with @ref hits(),
+@ref misses() and @ref timeSaved().
+
+@requires_gl41 Extension @extension{ARB,get_program_binary}
+@requires_gles30 Binary program representations are not supported in
+    OpenGL ES 2.0 in Magnum.
+@requires_gles Binary program representations are not supported in WebGL.
+*/
+class MAGNUM_EXPORT ShaderProgramBinaryCache {
+    friend AbstractShaderProgram;
+
+    public:
+        /**
+         * @brief Whether binary caching is supported
+         *
+         * Returns `true` if @extension{ARB,get_program_binary} (part of
+         * OpenGL 4.1) is supported and the driver reports at least one
+         * binary format, `false` otherwise.
+         * @see @fn_gl{Get} with @def_gl{NUM_PROGRAM_BINARY_FORMATS}
+         */
+        static bool isSupported();
+
+        /**
+         * @brief Constructor
+         * @param directory     Directory where to put the cached binaries.
+         *      Created if it doesn't exist.
+         *
+         * Expects that there is current OpenGL context, as the driver
+         * identification is queried from it.
+         */
+        explicit ShaderProgramBinaryCache(std::string directory);
+
+        /** @brief Copying is not allowed */
+        ShaderProgramBinaryCache(const ShaderProgramBinaryCache&) = delete;
+
+        /** @brief Moving is not allowed */
+        ShaderProgramBinaryCache(ShaderProgramBinaryCache&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * If the cache is current, resets it with
+         * @ref AbstractShaderProgram::setBinaryCache().
+         */
+        ~ShaderProgramBinaryCache();
+
+        /** @brief Copying is not allowed */
+        ShaderProgramBinaryCache& operator=(const ShaderProgramBinaryCache&) = delete;
+
+        /** @brief Moving is not allowed */
+        ShaderProgramBinaryCache& operator=(ShaderProgramBinaryCache&&) = delete;
+
+        /** @brief Cache directory */
+        std::string directory() const { return _directory; }
+
+        /**
+         * @brief Count of cache hits
+         *
+         * Count of programs that were successfully loaded from the cache.
+         */
+        UnsignedInt hits() const { return _hits; }
+
+        /**
+         * @brief Count of cache misses
+         *
+         * Count of programs that had to be linked, either because they were
+         * not in the cache, were cached for another driver or the driver
+         * refused to load the cached binary.
+         */
+        UnsignedInt misses() const { return _misses; }
+
+        /**
+         * @brief Time saved by the cache
+         *
+         * Sum of differences between the time it originally took to link
+         * the program and the time it took to load its binary, in seconds.
+         * As the linking of multiple programs in @ref AbstractShaderProgram::link()
+         * may run in parallel, the original link time is only an estimate.
+         */
+        Float timeSaved() const { return _timeSaved*1.0e-9f; }
+
+    private:
+        /* Loads binary for given program, returns false if there's no
+           usable binary */
+        MAGNUM_LOCAL bool load(GLuint id, const std::string& key);
+
+        /* Saves binary of given (successfully linked) program */
+        MAGNUM_LOCAL void save(GLuint id, const std::string& key, UnsignedLong linkTime);
+
+        std::string _directory,
+            _driverDigest;
+        UnsignedInt _hits, _misses;
+        UnsignedLong _timeSaved;
+};
+
+}
+#else
+#error this header is not available in OpenGL ES 2.0 and WebGL build
+#endif
+
+#endif
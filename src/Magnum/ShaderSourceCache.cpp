@@ -0,0 +1,204 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "ShaderSourceCache.h"
+
+#include <algorithm>
+#include <Corrade/Utility/Debug.h>
+#include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/Resource.h>
+#include <Corrade/Utility/Sha1.h>
+
+#include "Magnum/Shader.h"
+
+namespace Magnum {
+
+namespace {
+
+/* Returns the included name if the line is an #include directive, empty
+   string otherwise */
+std::string includeName(const std::string& line) {
+    std::size_t i = line.find_first_not_of(" \t");
+    if(i == std::string::npos || line[i] != '#') return {};
+    i = line.find_first_not_of(" \t", i + 1);
+    if(i == std::string::npos || line.compare(i, 7, "include") != 0) return {};
+    i = line.find_first_not_of(" \t", i + 7);
+    if(i == std::string::npos || (line[i] != '"' && line[i] != '<')) return {};
+
+    const char end = line[i] == '"' ? '"' : '>';
+    const std::size_t nameEnd = line.find(end, i + 1);
+    if(nameEnd == std::string::npos) return {};
+    return line.substr(i + 1, nameEnd - i - 1);
+}
+
+}
+
+ShaderSourceCache::ShaderSourceCache(): _hits{}, _misses{} {}
+
+ShaderSourceCache::ShaderSourceCache(ShaderSourceCache&&) noexcept = default;
+
+ShaderSourceCache::~ShaderSourceCache() = default;
+
+ShaderSourceCache& ShaderSourceCache::operator=(ShaderSourceCache&&) noexcept = default;
+
+ShaderSourceCache& ShaderSourceCache::addIncludePath(std::string path) {
+    _includePaths.push_back(std::move(path));
+    return *this;
+}
+
+ShaderSourceCache& ShaderSourceCache::addResourceGroup(std::string group) {
+    _resourceGroups.push_back(std::move(group));
+    return *this;
+}
+
+ShaderSourceCache& ShaderSourceCache::addFile(std::string name, std::string source) {
+    _files[std::move(name)] = {true, std::move(source)};
+    _cache.clear();
+    return *this;
+}
+
+void ShaderSourceCache::clear() {
+    _cache.clear();
+    for(auto it = _files.begin(); it != _files.end(); ) {
+        if(!it->second.first) it = _files.erase(it);
+        else ++it;
+    }
+}
+
+const std::string* ShaderSourceCache::find(const std::string& name) {
+    /* Files added explicitly or loaded earlier */
+    auto found = _files.find(name);
+    if(found != _files.end()) return &found->second.second;
+
+    /* Resource groups */
+    for(const std::string& group: _resourceGroups) {
+        Utility::Resource rs{group};
+        const std::vector<std::string> list = rs.list();
+        if(std::find(list.begin(), list.end(), name) == list.end()) continue;
+        return &_files.emplace(name, std::make_pair(false, rs.get(name))).first->second.second;
+    }
+
+    /* Filesystem */
+    for(const std::string& path: _includePaths) {
+        const std::string filename = Utility::Directory::join(path, name);
+        if(!Utility::Directory::fileExists(filename)) continue;
+        return &_files.emplace(name, std::make_pair(false, Utility::Directory::readString(filename))).first->second.second;
+    }
+
+    return nullptr;
+}
+
+bool ShaderSourceCache::process(const std::string& source, const std::string& name, std::vector<std::string>& included, std::string& out) {
+    const std::string directory = Utility::Directory::path(name);
+
+    std::size_t lineNumber = 1;
+    for(std::size_t begin = 0; begin < source.size(); ++lineNumber) {
+        std::size_t end = source.find('\n', begin);
+        if(end == std::string::npos) end = source.size();
+        const std::string line = source.substr(begin, end - begin);
+        begin = end + 1;
+
+        const std::string include = includeName(line);
+        if(include.empty()) {
+            out += line;
+            out += '\n';
+            continue;
+        }
+
+        /* Try relative to the including file first, then as-is */
+        std::string includeFile;
+        const std::string* includeSource = nullptr;
+        if(!directory.empty()) {
+            includeFile = Utility::Directory::join(directory, include);
+            includeSource = find(includeFile);
+        }
+        if(!includeSource) {
+            includeFile = include;
+            includeSource = find(includeFile);
+        }
+        if(!includeSource) {
+            Error() << "ShaderSourceCache: can't find" << include << "included from" << (name.empty() ? "<source>" : name);
+            return false;
+        }
+
+        /* Each file is included only once, which also breaks cycles */
+        if(std::find(included.begin(), included.end(), includeFile) == included.end()) {
+            included.push_back(includeFile);
+
+            /* Copy the source, as the find() calls in the recursion may
+               rehash the file map */
+            out += "#line 1\n";
+            if(!process(std::string{*includeSource}, includeFile, included, out))
+                return false;
+        }
+
+        out += "#line " + std::to_string(lineNumber + 1) + '\n';
+    }
+
+    return true;
+}
+
+std::string ShaderSourceCache::preprocess(const std::string& source, const std::string& name) {
+    std::vector<std::string> included;
+    if(!name.empty()) included.push_back(name);
+
+    std::string out;
+    if(!process(source, name, included, out)) return {};
+    return out;
+}
+
+const ShaderSourceCache::Source* ShaderSourceCache::get(const std::string& name) {
+    auto found = _cache.find(name);
+    if(found != _cache.end()) {
+        ++_hits;
+        return &found->second;
+    }
+
+    ++_misses;
+
+    const std::string* source = find(name);
+    if(!source) {
+        Error() << "ShaderSourceCache::get(): can't find" << name;
+        return nullptr;
+    }
+
+    std::vector<std::string> included{name};
+    std::string out;
+    if(!process(std::string{*source}, name, included, out)) return nullptr;
+
+    const std::string digest = Utility::Sha1::digest(out).hexString();
+    return &_cache.emplace(name, Source{std::move(out), digest}).first->second;
+}
+
+bool ShaderSourceCache::addTo(Shader& shader, const std::string& name) {
+    const Source* const source = get(name);
+    if(!source) return false;
+
+    shader.addSource(source->source, source->digest);
+    return true;
+}
+
+}
@@ -0,0 +1,205 @@
+#ifndef Magnum_ShaderSourceCache_h
+#define Magnum_ShaderSourceCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::ShaderSourceCache
+ */
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum {
+
+/**
+@brief Shader source cache with include resolution
+
+Resolves @glsl #include @ce directives in GLSL sources and caches the
+resulting sources together with their digests, so shared snippets don't need
+to be assembled by hand for each shader and creating many shaders from the
+same sources becomes a hash map lookup:
+@code
+ShaderSourceCache cache;
+cache.addIncludePath("shaders")
+    .addFile("lights.glsl", lightsSource);
+
+// shaders/Terrain.frag contains #include "lights.glsl"
+Shader frag{Version::GL330, Shader::Type::Fragment};
+cache.addTo(frag, "Terrain.frag");
+@endcode
+
+## Include resolution
+
+A line consisting of @glsl #include "name" @ce or @glsl #include <name> @ce
+is replaced with the contents of the file, recursively. The file is looked
+up first relative to the directory of the including file and then as-is.
+Each name is searched for in files added with @ref addFile(), then in
+resource groups added with @ref addResourceGroup() and then in directories
+added with @ref addIncludePath(), in the order they were added. Files read
+from a resource group or the filesystem are kept in memory, so each is read
+only once.
+
+Every file is included only once per source, repeated includes are removed,
+so the snippets don't need include guards. The included contents are
+surrounded by @glsl #line @ce directives, so compiler messages refer to the
+line in the included file and the line numbering of the including file
+continues after it.
+
+## Digests and binary cache
+
+The preprocessed sources are cached by name together with their SHA-1 digest.
+@ref addTo() passes the digest to @ref Shader::addSource(std::string, std::string),
+so @ref ShaderProgramBinaryCache doesn't need to hash the full sources of
+every program again. Adding or replacing a file with @ref addFile() or
+calling @ref clear() invalidates all cached sources.
+@see @ref Shader::addFile()
+*/
+class MAGNUM_EXPORT ShaderSourceCache {
+    public:
+        /** @brief Preprocessed source */
+        struct Source {
+            std::string source;     /**< @brief Source with resolved includes */
+            std::string digest;     /**< @brief SHA-1 digest of the source */
+        };
+
+        /** @brief Constructor */
+        explicit ShaderSourceCache();
+
+        /** @brief Copying is not allowed */
+        ShaderSourceCache(const ShaderSourceCache&) = delete;
+
+        /** @brief Move constructor */
+        ShaderSourceCache(ShaderSourceCache&&) noexcept;
+
+        ~ShaderSourceCache();
+
+        /** @brief Copying is not allowed */
+        ShaderSourceCache& operator=(const ShaderSourceCache&) = delete;
+
+        /** @brief Move assignment */
+        ShaderSourceCache& operator=(ShaderSourceCache&&) noexcept;
+
+        /**
+         * @brief Add include path
+         * @return Reference to self (for method chaining)
+         */
+        ShaderSourceCache& addIncludePath(std::string path);
+
+        /**
+         * @brief Add resource group
+         * @return Reference to self (for method chaining)
+         *
+         * Files from given @ref Corrade::Utility::Resource group are
+         * available under their resource names.
+         */
+        ShaderSourceCache& addResourceGroup(std::string group);
+
+        /**
+         * @brief Add a file
+         * @return Reference to self (for method chaining)
+         *
+         * Makes @p source available under @p name. If a file with the same
+         * name is already present, it's replaced. Invalidates all cached
+         * sources.
+         */
+        ShaderSourceCache& addFile(std::string name, std::string source);
+
+        /** @brief Count of cached preprocessed sources */
+        std::size_t cachedCount() const { return _cache.size(); }
+
+        /**
+         * @brief Count of cache hits
+         *
+         * Count of @ref get() calls that didn't need to preprocess the
+         * source.
+         */
+        UnsignedInt hits() const { return _hits; }
+
+        /**
+         * @brief Count of cache misses
+         *
+         * Count of @ref get() calls that had to preprocess the source.
+         */
+        UnsignedInt misses() const { return _misses; }
+
+        /**
+         * @brief Get preprocessed source
+         *
+         * Returns the cached source or preprocesses and caches it. If the
+         * file or any of its includes can't be found, prints a message to
+         * error output and returns `nullptr`. The returned pointer is valid
+         * until the cache is invalidated.
+         */
+        const Source* get(const std::string& name);
+
+        /**
+         * @brief Add preprocessed source to a shader
+         *
+         * Calls @ref Shader::addSource(std::string, std::string) with the
+         * source and digest from @ref get(). Returns `false` if the source
+         * can't be preprocessed, `true` otherwise.
+         */
+        bool addTo(Shader& shader, const std::string& name);
+
+        /**
+         * @brief Preprocess a source
+         * @param source    Source to preprocess
+         * @param name      Name used for resolving relative includes and
+         *      in error messages
+         *
+         * Resolves includes in given source without caching the result.
+         * If an include can't be found, prints a message to error output and
+         * returns an empty string.
+         */
+        std::string preprocess(const std::string& source, const std::string& name = {});
+
+        /**
+         * @brief Clear the cache
+         *
+         * Removes all cached sources and all files read from resources or
+         * filesystem, so changed files get read again. Files added with
+         * @ref addFile() are kept.
+         */
+        void clear();
+
+    private:
+        MAGNUM_LOCAL const std::string* find(const std::string& name);
+        MAGNUM_LOCAL bool process(const std::string& source, const std::string& name, std::vector<std::string>& included, std::string& out);
+
+        std::vector<std::string> _includePaths, _resourceGroups;
+        /* Added files, first is true for files added with addFile() */
+        std::unordered_map<std::string, std::pair<bool, std::string>> _files;
+        std::unordered_map<std::string, Source> _cache;
+        UnsignedInt _hits, _misses;
+};
+
+}
+
+#endif
@@ -29,14 +29,65 @@
  * @brief Class @ref Magnum::Shaders::AbstractVector, typedef @ref Magnum::Shaders::AbstractVector2D, @ref Magnum::Shaders::AbstractVector3D
  */
 
+#include <Corrade/Containers/EnumSet.h>
+
 #include "Magnum/Shaders/Generic.h"
 
 namespace Magnum { namespace Shaders {
 
+namespace Implementation {
+    enum class VectorFlag: UnsignedByte {
+        #ifndef MAGNUM_TARGET_GLES2
+        InstancedGlyphs = 1 << 0,
+        #endif
+        MultichannelDistanceField = 1 << 1
+    };
+    typedef Containers::EnumSet<VectorFlag> VectorFlags;
+}
+
 /**
 @brief Base for vector shaders
 
 See @ref DistanceFieldVector and @ref Vector for more information.
+
+@anchor Shaders-AbstractVector-instanced-glyphs
+## Instanced glyphs
+
+With @ref Flag::InstancedGlyphs the shaders don't take any per-vertex
+attributes. Instead, each instance is one quad described by the
+@ref GlyphRectangle, @ref GlyphTextureRectangle and @ref GlyphColor attributes,
+and the vertex shader expands it from @glsl gl_VertexID @ce of a four-vertex
+@ref MeshPrimitive::TriangleStrip. Compared to classic quads this needs one
+instance instead of four vertices and six indices per glyph. A text can also
+be changed by updating just its instances. @ref Text::InstancedRenderer
+provides ready-to-use instance buffer management.
+@code
+struct Glyph {
+    Vector4 rectangle;          // min.xy, max.xy
+    Vector4 textureRectangle;   // min.xy, max.xy
+    Color4ub color;
+};
+std::vector<Glyph> glyphs;
+
+Buffer instances;
+instances.setData(glyphs, BufferUsage::DynamicDraw);
+
+Mesh mesh;
+mesh.setPrimitive(MeshPrimitive::TriangleStrip)
+    .setCount(4)
+    .addVertexBufferInstanced(instances, 1, 0,
+        Shaders::Vector2D::GlyphRectangle{},
+        Shaders::Vector2D::GlyphTextureRectangle{},
+        Shaders::Vector2D::GlyphColor{
+            Shaders::Vector2D::GlyphColor::DataType::UnsignedByte,
+            Shaders::Vector2D::GlyphColor::DataOption::Normalized})
+    .setInstanceCount(glyphs.size());
+
+Shaders::Vector2D shader{Shaders::Vector2D::Flag::InstancedGlyphs};
+@endcode
+
+The glyph color is multiplied with the color set on the shader.
+
 @see @ref shaders, @ref AbstractVector2D, @ref AbstractVector3D
 */
 template<UnsignedInt dimensions> class AbstractVector: public AbstractShaderProgram {
@@ -56,6 +107,76 @@ template<UnsignedInt dimensions> class AbstractVector: public AbstractShaderProg
          */
         typedef typename Generic<dimensions>::TextureCoordinates TextureCoordinates;
 
+        /**
+         * @brief Glyph rectangle
+         *
+         * Minimal and maximal corner of the glyph quad, @ref Vector4. Used
+         * only if @ref Flag::InstancedGlyphs is set.
+         */
+        typedef Attribute<10, Vector4> GlyphRectangle;
+
+        /**
+         * @brief Glyph texture rectangle
+         *
+         * Minimal and maximal corner of the glyph in the vector texture,
+         * @ref Vector4. Used only if @ref Flag::InstancedGlyphs is set.
+         */
+        typedef Attribute<11, Vector4> GlyphTextureRectangle;
+
+        /**
+         * @brief Glyph color
+         *
+         * @ref Color4, usually specified as four normalized unsigned bytes.
+         * Shares location with @ref Generic::Color. Used only if
+         * @ref Flag::InstancedGlyphs is set.
+         */
+        typedef Attribute<Generic<dimensions>::Color::Location, Color4> GlyphColor;
+
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        /**
+         * @brief Flag
+         *
+         * @see @ref Flags, @ref flags()
+         */
+        enum class Flag: UnsignedByte {
+            /**
+             * Each instance is one glyph quad described by
+             * @ref GlyphRectangle, @ref GlyphTextureRectangle and
+             * @ref GlyphColor instead of per-vertex @ref Position and
+             * @ref TextureCoordinates.
+             * @requires_gl30 Extension @extension{EXT,gpu_shader4} for
+             *      @glsl gl_VertexID @ce
+             * @requires_gl33 Extension @extension{ARB,instanced_arrays}
+             * @requires_gles30 @glsl gl_VertexID @ce is not available in
+             *      OpenGL ES 2.0.
+             * @requires_webgl20 @glsl gl_VertexID @ce is not available in
+             *      WebGL 1.0.
+             */
+            InstancedGlyphs = 1 << 0,
+
+            /**
+             * The vector texture is a multi-channel distance field, such as
+             * one created by @ref TextureTools::multichannelDistanceField(),
+             * and the distance is reconstructed from median of its RGB
+             * channels. Used only by @ref DistanceFieldVector.
+             */
+            MultichannelDistanceField = 1 << 1
+        };
+
+        /**
+         * @brief Flags
+         *
+         * @see @ref flags()
+         */
+        typedef Containers::EnumSet<Flag> Flags;
+        #else
+        typedef Implementation::VectorFlag Flag;
+        typedef Implementation::VectorFlags Flags;
+        #endif
+
+        /** @brief Flags */
+        Flags flags() const { return _flags; }
+
         /**
          * @brief Set vector texture
          * @return Reference to self (for method chaining)
@@ -65,8 +186,11 @@ template<UnsignedInt dimensions> class AbstractVector: public AbstractShaderProg
     protected:
         enum: Int { VectorTextureLayer = 15 };
 
-        explicit AbstractVector() = default;
+        explicit AbstractVector(Flags flags): _flags{flags} {}
         ~AbstractVector() = default;
+
+    private:
+        Flags _flags;
 };
 
 /** @brief Base for two-dimensional text shaders */
@@ -75,6 +199,8 @@ typedef AbstractVector<2> AbstractVector2D;
 /** @brief Base for three-dimensional text shader */
 typedef AbstractVector<3> AbstractVector3D;
 
+CORRADE_ENUMSET_OPERATORS(Implementation::VectorFlags)
+
 }}
 
 #endif
@@ -33,6 +33,7 @@ layout(location = 0)
 #endif
 uniform highp mat3 transformationProjectionMatrix;
 
+#ifndef INSTANCED_GLYPHS
 #ifdef EXPLICIT_ATTRIB_LOCATION
 layout(location = POSITION_ATTRIBUTE_LOCATION)
 #endif
@@ -42,10 +43,36 @@ in highp vec2 position;
 layout(location = TEXTURECOORDINATES_ATTRIBUTE_LOCATION)
 #endif
 in mediump vec2 textureCoordinates;
+#else
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = GLYPH_RECTANGLE_ATTRIBUTE_LOCATION)
+#endif
+in highp vec4 glyphRectangle;
+
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = GLYPH_TEXTURE_RECTANGLE_ATTRIBUTE_LOCATION)
+#endif
+in mediump vec4 glyphTextureRectangle;
+
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = COLOR_ATTRIBUTE_LOCATION)
+#endif
+in lowp vec4 glyphColor;
+
+out lowp vec4 interpolatedGlyphColor;
+#endif
 
 out mediump vec2 fragmentTextureCoordinates;
 
 void main() {
+    #ifdef INSTANCED_GLYPHS
+    /* Expand the quad from vertex ID of a four-vertex triangle strip */
+    highp vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));
+    highp vec2 position = mix(glyphRectangle.xy, glyphRectangle.zw, corner);
+    mediump vec2 textureCoordinates = mix(glyphTextureRectangle.xy, glyphTextureRectangle.zw, corner);
+    interpolatedGlyphColor = glyphColor;
+    #endif
+
     gl_Position.xywz = vec4(transformationProjectionMatrix*vec3(position, 1.0), 0.0);
     fragmentTextureCoordinates = textureCoordinates;
 }
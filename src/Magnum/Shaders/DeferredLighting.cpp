@@ -0,0 +1,95 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DeferredLighting.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include <Corrade/Utility/Resource.h>
+
+#include "Magnum/Context.h"
+#include "Magnum/Shader.h"
+#include "Magnum/Texture.h"
+#include "Magnum/Shaders/GBuffer.h"
+
+#include "Implementation/CreateCompatibilityShader.h"
+
+namespace Magnum { namespace Shaders {
+
+namespace {
+    enum: Int {
+        AlbedoTextureLayer = 0,
+        NormalTextureLayer = 1,
+        DepthTextureLayer = 2
+    };
+}
+
+DeferredLighting::DeferredLighting() {
+    #ifdef MAGNUM_BUILD_STATIC
+    /* Import resources on static build, if not already */
+    if(!Utility::Resource::hasGroup("MagnumShaders"))
+        importShaderResources();
+    #endif
+    Utility::Resource rs("MagnumShaders");
+
+    /* Texel fetches and gl_VertexID need GLSL 1.30 */
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GL300);
+    const Version version = Context::current().supportedVersion({Version::GL320, Version::GL310, Version::GL300});
+    #else
+    const Version version = Version::GLES300;
+    #endif
+
+    Shader vert = Implementation::createCompatibilityShader(rs, version, Shader::Type::Vertex);
+    Shader frag = Implementation::createCompatibilityShader(rs, version, Shader::Type::Fragment);
+
+    vert.addSource(rs.get("FullScreenTriangle.glsl"))
+        .addSource(rs.get("DeferredLighting.vert"));
+    frag.addSource(rs.get("DeferredLighting.frag"));
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({vert, frag}));
+
+    attachShaders({vert, frag});
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+    reflectUniforms();
+
+    _inverseProjectionMatrixUniform = uniformLocation("inverseProjectionMatrix");
+    _ambientColorUniform = uniformLocation("ambientColor");
+    _lightPositionUniform = uniformLocation("lightPosition");
+    _lightRangeUniform = uniformLocation("lightRange");
+    _lightColorUniform = uniformLocation("lightColor");
+
+    setUniform(uniformLocation("albedoTexture"), AlbedoTextureLayer);
+    setUniform(uniformLocation("normalTexture"), NormalTextureLayer);
+    setUniform(uniformLocation("depthTexture"), DepthTextureLayer);
+}
+
+DeferredLighting& DeferredLighting::setGBuffer(GBuffer& gbuffer) {
+    AbstractTexture::bind(AlbedoTextureLayer, {&gbuffer.albedoTexture(), &gbuffer.normalTexture(), &gbuffer.depthTexture()});
+    return *this;
+}
+
+}}
+#endif
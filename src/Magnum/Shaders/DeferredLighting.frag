@@ -0,0 +1,84 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+uniform lowp sampler2D albedoTexture;
+uniform mediump sampler2D normalTexture;
+uniform highp sampler2D depthTexture;
+
+uniform highp mat4 inverseProjectionMatrix;
+uniform lowp vec3 ambientColor;
+uniform highp vec3 lightPosition;
+uniform highp float lightRange;
+uniform lowp vec3 lightColor;
+
+out lowp vec4 color;
+
+void main() {
+    highp ivec2 coords = ivec2(gl_FragCoord.xy);
+
+    /* Nothing rendered there */
+    highp float depth = texelFetch(depthTexture, coords, 0).r;
+    if(depth == 1.0) discard;
+
+    lowp vec4 albedo = texelFetch(albedoTexture, coords, 0);
+    mediump vec4 packedNormal = texelFetch(normalTexture, coords, 0);
+
+    color = vec4(albedo.rgb*ambientColor, 1.0);
+    if(lightRange <= 0.0) return;
+
+    /* Camera-space position from the depth */
+    highp vec4 position4 = inverseProjectionMatrix*vec4(
+        gl_FragCoord.xy/vec2(textureSize(depthTexture, 0))*2.0 - vec2(1.0),
+        depth*2.0 - 1.0, 1.0);
+    highp vec3 position = position4.xyz/position4.w;
+
+    highp vec3 lightDirection = lightPosition - position;
+    highp float lightDistance = length(lightDirection);
+    if(lightDistance >= lightRange) return;
+    lightDirection /= lightDistance;
+
+    /* Unfold the octahedron, the lower hemisphere is folded over the
+       diagonals */
+    mediump vec2 octahedralNormal = packedNormal.xy*2.0 - vec2(1.0);
+    mediump vec3 normal = vec3(octahedralNormal, 1.0 - abs(octahedralNormal.x) - abs(octahedralNormal.y));
+    if(normal.z < 0.0)
+        normal.xy = (1.0 - abs(normal.yx))*vec2(
+            normal.x >= 0.0 ? 1.0 : -1.0,
+            normal.y >= 0.0 ? 1.0 : -1.0);
+    normal = normalize(normal);
+
+    /* Smooth falloff reaching zero at the light range */
+    highp float falloff = 1.0 - lightDistance*lightDistance/(lightRange*lightRange);
+    falloff *= falloff;
+
+    lowp float intensity = max(0.0, dot(normal, lightDirection));
+    color.rgb += albedo.rgb*lightColor*intensity*falloff;
+
+    if(intensity > 0.001) {
+        highp vec3 reflection = reflect(-lightDirection, normal);
+        mediump float specularity = pow(max(0.0, dot(normalize(-position), reflection)), packedNormal.z*256.0);
+        color.rgb += albedo.a*lightColor*specularity*falloff;
+    }
+}
@@ -0,0 +1,144 @@
+#ifndef Magnum_Shaders_DeferredLighting_h
+#define Magnum_Shaders_DeferredLighting_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::Shaders::DeferredLighting
+ */
+#endif
+
+#include "Magnum/configure.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shaders/Shaders.h"
+#include "Magnum/Shaders/visibility.h"
+
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Deferred lighting shader
+
+Full-screen pass reading the textures of a @ref GBuffer and adding ambient
+light and one point light to the target. The camera-space position is
+reconstructed from the depth texture using @ref setInverseProjectionMatrix(),
+pixels with depth `1.0` are discarded. The light uses the same falloff as
+@ref Phong with @ref Phong::Flag::ClusteredLights, reaching zero at the light
+range. The target is expected to have the same size as the G-buffer.
+
+Draw it with a full-screen triangle, for example from
+@ref MeshTools::fullScreenTriangle(), once per light with additive blending.
+The shader has no vertex attributes on the supported GL versions. Usually not
+used directly, see @ref DeferredRenderer for a ready-to-use setup with light
+culling.
+@requires_gl30 Extension @extension{EXT,gpu_shader4}
+@requires_gles30 Integer texture fetches are not available in OpenGL ES
+    2.0.
+@requires_webgl20 Integer texture fetches are not available in WebGL 1.0.
+@see @ref shaders
+*/
+class MAGNUM_SHADERS_EXPORT DeferredLighting: public AbstractShaderProgram {
+    public:
+        /** @brief Constructor */
+        explicit DeferredLighting();
+
+        /**
+         * @brief Set G-buffer textures
+         * @return Reference to self (for method chaining)
+         */
+        DeferredLighting& setGBuffer(GBuffer& gbuffer);
+
+        /**
+         * @brief Set inverse projection matrix
+         * @return Reference to self (for method chaining)
+         *
+         * Inverse of the projection used when rendering into the G-buffer.
+         */
+        DeferredLighting& setInverseProjectionMatrix(const Matrix4& matrix) {
+            setUniform(_inverseProjectionMatrixUniform, matrix);
+            return *this;
+        }
+
+        /**
+         * @brief Set ambient color
+         * @return Reference to self (for method chaining)
+         *
+         * Multiplied with the albedo. Usually set to non-zero only for the
+         * first pass.
+         */
+        DeferredLighting& setAmbientColor(const Color3& color) {
+            setUniform(_ambientColorUniform, color);
+            return *this;
+        }
+
+        /**
+         * @brief Set light position
+         * @return Reference to self (for method chaining)
+         *
+         * In camera space.
+         */
+        DeferredLighting& setLightPosition(const Vector3& position) {
+            setUniform(_lightPositionUniform, position);
+            return *this;
+        }
+
+        /**
+         * @brief Set light range
+         * @return Reference to self (for method chaining)
+         *
+         * Distance at which the light fades out, zero disables the light.
+         */
+        DeferredLighting& setLightRange(Float range) {
+            setUniform(_lightRangeUniform, range);
+            return *this;
+        }
+
+        /**
+         * @brief Set light color
+         * @return Reference to self (for method chaining)
+         */
+        DeferredLighting& setLightColor(const Color3& color) {
+            setUniform(_lightColorUniform, color);
+            return *this;
+        }
+
+    private:
+        Int _inverseProjectionMatrixUniform,
+            _ambientColorUniform,
+            _lightPositionUniform,
+            _lightRangeUniform,
+            _lightColorUniform;
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
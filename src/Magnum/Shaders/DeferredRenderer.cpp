@@ -0,0 +1,115 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DeferredRenderer.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/AbstractFramebuffer.h"
+#include "Magnum/Renderer.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace Shaders {
+
+Range2Di DeferredRenderer::lightScissor(const Matrix4& projection, const Vector2i& size, const Vector3& position, const Float range) {
+    /* Completely behind the camera */
+    if(position.z() - range >= 0.0f) return {};
+
+    /* The camera is inside or the box crosses the camera plane, can't
+       project it */
+    if(position.z() + range >= 0.0f) return {{}, size};
+
+    /* Project all corners of the bounding box */
+    Vector2 min{Constants::inf()}, max{-Constants::inf()};
+    for(UnsignedInt i = 0; i != 8; ++i) {
+        const Vector3 corner = position + Vector3{i & 1 ? range : -range,
+                                                  i & 2 ? range : -range,
+                                                  i & 4 ? range : -range};
+        const Vector4 clip = projection*Vector4{corner, 1.0f};
+        const Vector2 ndc = clip.xy()/clip.w();
+        min = Math::min(min, ndc);
+        max = Math::max(max, ndc);
+    }
+
+    /* Outside of the frustum sides */
+    if((max < Vector2{-1.0f}).any() || (min > Vector2{1.0f}).any()) return {};
+
+    const Vector2 sizef{size};
+    const Vector2i minPixel{Math::floor((Math::max(min, Vector2{-1.0f})*0.5f + Vector2{0.5f})*sizef)};
+    const Vector2i maxPixel{Math::ceil((Math::min(max, Vector2{1.0f})*0.5f + Vector2{0.5f})*sizef)};
+    return {minPixel, maxPixel};
+}
+
+DeferredRenderer::DeferredRenderer(const Vector2i& size): _gbuffer{size} {
+    /* Attribute-less full-screen triangle, see MeshTools::fullScreenTriangle() */
+    _triangle.setPrimitive(MeshPrimitive::Triangles)
+        .setCount(3);
+}
+
+DeferredRenderer& DeferredRenderer::setLights(const Containers::ArrayView<const Light> lights) {
+    _lights.assign(lights.begin(), lights.end());
+    return *this;
+}
+
+DeferredRenderer& DeferredRenderer::setLights(std::initializer_list<Light> lights) {
+    return setLights(Containers::arrayView(lights.begin(), lights.size()));
+}
+
+void DeferredRenderer::draw(AbstractFramebuffer& framebuffer) {
+    framebuffer.bind();
+
+    Renderer::disable(Renderer::Feature::DepthTest);
+    Renderer::enable(Renderer::Feature::Blending);
+    Renderer::setBlendFunction(Renderer::BlendFunction::One, Renderer::BlendFunction::One);
+
+    /* Ambient pass */
+    _shader.setGBuffer(_gbuffer)
+        .setInverseProjectionMatrix(_projectionMatrix.inverted())
+        .setAmbientColor(_ambientColor)
+        .setLightRange(0.0f);
+    _triangle.draw(_shader);
+
+    /* Light passes, each restricted to the area the light can affect */
+    _drawnLightCount = 0;
+    _shader.setAmbientColor({});
+    Renderer::enable(Renderer::Feature::ScissorTest);
+    for(const Light& light: _lights) {
+        const Range2Di scissor = lightScissor(_projectionMatrix, _gbuffer.size(), light.position, light.range);
+        if((scissor.size() <= Vector2i{0}).any()) continue;
+
+        Renderer::setScissor(scissor);
+        _shader.setLightPosition(light.position)
+            .setLightRange(light.range)
+            .setLightColor(light.color);
+        _triangle.draw(_shader);
+        ++_drawnLightCount;
+    }
+
+    Renderer::disable(Renderer::Feature::ScissorTest);
+    Renderer::disable(Renderer::Feature::Blending);
+    Renderer::enable(Renderer::Feature::DepthTest);
+}
+
+}}
+#endif
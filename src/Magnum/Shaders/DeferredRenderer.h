@@ -0,0 +1,202 @@
+#ifndef Magnum_Shaders_DeferredRenderer_h
+#define Magnum_Shaders_DeferredRenderer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::Shaders::DeferredRenderer
+ */
+#endif
+
+#include "Magnum/configure.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Shaders/DeferredLighting.h"
+#include "Magnum/Shaders/GBuffer.h"
+
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Deferred renderer
+
+Ties together a @ref GBuffer, the @ref DeferredLighting shader and a
+full-screen triangle. Meshes are first rendered into the G-buffer with
+@ref Phong using @ref Phong::Flag::GBuffer, then @ref draw() accumulates the
+ambient light and all point lights into the target framebuffer:
+@code
+Shaders::DeferredRenderer renderer{defaultFramebuffer.viewport().size()};
+Shaders::Phong shader{Shaders::Phong::Flag::GBuffer};
+
+// Each frame
+renderer.bindGBuffer();
+shader.setProjectionMatrix(projection)
+    .setTransformationMatrix(transformation)
+    .setNormalMatrix(transformation.rotation())
+    .setDiffuseColor(color);
+mesh.draw(shader);
+
+renderer.setProjectionMatrix(projection)
+    .setAmbientColor(Color3{0.1f})
+    .setLights(lights);
+defaultFramebuffer.clear(FramebufferClear::Color);
+renderer.draw(defaultFramebuffer);
+@endcode
+
+Each light is drawn as a separate full-screen triangle pass with additive
+blending, restricted with the scissor test to the screen-space rectangle of its
+bounding box, see @ref lightScissor(). Lights that don't intersect the view
+frustum are skipped. The lights are specified in camera space.
+@requires_gl30 Extension @extension{ARB,framebuffer_object} and
+    @extension{EXT,gpu_shader4}
+@requires_gles30 Multiple render targets are not available in OpenGL ES
+    2.0.
+@requires_webgl20 Multiple render targets are not available in WebGL 1.0.
+*/
+class MAGNUM_SHADERS_EXPORT DeferredRenderer {
+    public:
+        /** @brief Point light */
+        struct Light {
+            Vector3 position;   /**< @brief Position in camera space */
+            Float range;        /**< @brief Distance at which the light fades out */
+            Color3 color;       /**< @brief Light color */
+        };
+
+        /**
+         * @brief Screen-space rectangle affected by a light
+         * @param projection    Perspective projection matrix
+         * @param size          Framebuffer size
+         * @param position      Light position in camera space
+         * @param range         Light range
+         *
+         * Conservative bounds of the projected bounding box of the light.
+         * If the camera is inside the bounding box, returns the whole
+         * framebuffer. If the light is behind the camera or outside of the
+         * frustum sides, returns an empty range.
+         */
+        static Range2Di lightScissor(const Matrix4& projection, const Vector2i& size, const Vector3& position, Float range);
+
+        /**
+         * @brief Constructor
+         *
+         * Creates the G-buffer with given size, which is expected to match
+         * the target framebuffer.
+         */
+        explicit DeferredRenderer(const Vector2i& size);
+
+        /** @brief G-buffer */
+        GBuffer& gbuffer() { return _gbuffer; }
+
+        /** @brief Lighting shader */
+        DeferredLighting& shader() { return _shader; }
+
+        /**
+         * @brief Bind and clear the G-buffer
+         *
+         * Call before rendering the meshes with @ref Phong::Flag::GBuffer.
+         */
+        void bindGBuffer() { _gbuffer.bind(); }
+
+        /** @brief Projection matrix */
+        Matrix4 projectionMatrix() const { return _projectionMatrix; }
+
+        /**
+         * @brief Set projection matrix
+         * @return Reference to self (for method chaining)
+         *
+         * Has to match the projection used for rendering into the G-buffer.
+         * Default is identity.
+         */
+        DeferredRenderer& setProjectionMatrix(const Matrix4& matrix) {
+            _projectionMatrix = matrix;
+            return *this;
+        }
+
+        /** @brief Ambient color */
+        Color3 ambientColor() const { return _ambientColor; }
+
+        /**
+         * @brief Set ambient color
+         * @return Reference to self (for method chaining)
+         *
+         * Default is black.
+         */
+        DeferredRenderer& setAmbientColor(const Color3& color) {
+            _ambientColor = color;
+            return *this;
+        }
+
+        /** @brief Lights */
+        const std::vector<Light>& lights() const { return _lights; }
+
+        /**
+         * @brief Set lights
+         * @return Reference to self (for method chaining)
+         */
+        DeferredRenderer& setLights(Containers::ArrayView<const Light> lights);
+
+        /** @overload */
+        DeferredRenderer& setLights(std::initializer_list<Light> lights);
+
+        /**
+         * @brief Count of lights drawn in the last @ref draw()
+         *
+         * Lights culled by @ref lightScissor() are not counted.
+         */
+        UnsignedInt drawnLightCount() const { return _drawnLightCount; }
+
+        /**
+         * @brief Draw the lighting into given framebuffer
+         *
+         * Binds @p framebuffer and draws the ambient pass and a pass for each
+         * light that's not culled. The framebuffer is not cleared. Depth
+         * test is disabled during the passes and enabled afterwards,
+         * blending and scissor test are left disabled.
+         */
+        void draw(AbstractFramebuffer& framebuffer);
+
+    private:
+        GBuffer _gbuffer;
+        DeferredLighting _shader;
+        Mesh _triangle;
+        Matrix4 _projectionMatrix;
+        Color3 _ambientColor;
+        std::vector<Light> _lights;
+        UnsignedInt _drawnLightCount{};
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
@@ -64,15 +64,35 @@ uniform lowp sampler2D vectorTexture;
 
 in mediump vec2 fragmentTextureCoordinates;
 
+#ifdef INSTANCED_GLYPHS
+in lowp vec4 interpolatedGlyphColor;
+#endif
+
 #ifdef NEW_GLSL
 out lowp vec4 fragmentColor;
 #endif
 
+#ifdef MULTICHANNEL_DISTANCE_FIELD
+lowp float median(lowp vec3 value) {
+    return max(min(value.r, value.g), min(max(value.r, value.g), value.b));
+}
+#endif
+
 void main() {
+    #ifndef MULTICHANNEL_DISTANCE_FIELD
     lowp float intensity = texture(vectorTexture, fragmentTextureCoordinates).r;
+    #else
+    /* Each channel has distance to a different subset of the edges, the
+       median of them gives back the original edge including sharp corners */
+    lowp float intensity = median(texture(vectorTexture, fragmentTextureCoordinates).rgb);
+    #endif
 
     /* Fill color */
-    fragmentColor = smoothstep(outlineRange.x-smoothness, outlineRange.x+smoothness, intensity)*color;
+    fragmentColor = smoothstep(outlineRange.x-smoothness, outlineRange.x+smoothness, intensity)*
+        #ifdef INSTANCED_GLYPHS
+        interpolatedGlyphColor*
+        #endif
+        color;
 
     /* Outline */
     if(outlineRange.x > outlineRange.y) {
@@ -47,7 +47,15 @@ rendered outlook will greatly depend on radius of input distance field and
 value passed to @ref setSmoothness(). You need to provide @ref Position and
 @ref TextureCoordinates attributes in your triangle mesh and call at least
 @ref setTransformationProjectionMatrix(), @ref setColor() and
-@ref setVectorTexture().
+@ref setVectorTexture(). With @ref Flag::InstancedGlyphs the shader draws
+one glyph quad per instance instead, see
+@ref Shaders-AbstractVector-instanced-glyphs "AbstractVector" for details.
+The per-glyph color is applied only to the fill, not to the outline.
+
+With @ref Flag::MultichannelDistanceField the shader takes a multi-channel
+distance field created by @ref TextureTools::multichannelDistanceField()
+instead, which keeps sharp corners with much smaller textures. The outline
+and smoothness parameters have the same meaning in both cases.
 
 @image html shaders-distancefieldvector.png
 @image latex shaders-distancefieldvector.png
@@ -93,7 +101,11 @@ mesh.draw(shader);
 */
 template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT DistanceFieldVector: public AbstractVector<dimensions> {
     public:
-        DistanceFieldVector();
+        /**
+         * @brief Constructor
+         * @param flags     Flags
+         */
+        explicit DistanceFieldVector(typename AbstractVector<dimensions>::Flags flags = {});
 
         /**
          * @brief Set transformation and projection matrix
@@ -31,20 +31,38 @@
 #include "Magnum/Extensions.h"
 #include "Magnum/Shader.h"
 #include "Magnum/Texture.h"
+#ifndef MAGNUM_TARGET_GLES
+#include "Magnum/TextureHandle.h"
+#endif
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include "Magnum/BufferTexture.h"
+#endif
 
 #include "Implementation/CreateCompatibilityShader.h"
 
 namespace Magnum { namespace Shaders {
 
 namespace {
-    enum: Int { TextureLayer = 0 };
+    enum: Int {
+        TextureLayer = 0,
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        PositionBufferTextureLayer = 1,
+        TextureCoordinatesBufferTextureLayer = 2,
+        ColorBufferTextureLayer = 3
+        #endif
+    };
 
     template<UnsignedInt> constexpr const char* vertexShaderName();
     template<> constexpr const char* vertexShaderName<2>() { return "Flat2D.vert"; }
     template<> constexpr const char* vertexShaderName<3>() { return "Flat3D.vert"; }
 }
 
-template<UnsignedInt dimensions> Flat<dimensions>::Flat(const Flags flags): transformationProjectionMatrixUniform(0), colorUniform(1), _flags(flags) {
+template<UnsignedInt dimensions> Flat<dimensions>::Flat(const Flags flags): transformationProjectionMatrixUniform(0), colorUniform(1),
+    #ifndef MAGNUM_TARGET_GLES
+    textureUniform(-1),
+    #endif
+    _flags(flags)
+{
     #ifdef MAGNUM_BUILD_STATIC
     /* Import resources on static build, if not already */
     if(!Utility::Resource::hasGroup("MagnumShaders"))
@@ -53,18 +71,69 @@ template<UnsignedInt dimensions> Flat<dimensions>::Flat(const Flags flags): tran
     Utility::Resource rs("MagnumShaders");
 
     #ifndef MAGNUM_TARGET_GLES
-    const Version version = Context::current().supportedVersion({Version::GL320, Version::GL310, Version::GL300, Version::GL210});
+    const bool bindless = (flags & Flag::Textured) && (flags & Flag::BindlessTexture);
+    if(bindless)
+        MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::bindless_texture);
+
+    /* Bindless textures need GLSL 4.00 */
+    const Version version = bindless ? Version::GL400 :
+        Context::current().supportedVersion({Version::GL320, Version::GL310, Version::GL300, Version::GL210});
+    #elif !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    /* Buffer textures need at least ES 3.1 */
+    const Version version = flags & Flag::VertexPulling ?
+        Context::current().supportedVersion({Version::GLES310, Version::GLES300}) :
+        Context::current().supportedVersion({Version::GLES300, Version::GLES200});
     #else
     const Version version = Context::current().supportedVersion({Version::GLES300, Version::GLES200});
     #endif
 
+    #ifndef MAGNUM_TARGET_GLES2
+    if(flags & Flag::UniformBuffers) {
+        #ifndef MAGNUM_TARGET_GLES
+        MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GL310);
+        #else
+        MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GLES300);
+        #endif
+    }
+    #endif
+
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(flags & Flag::VertexPulling) {
+        #ifndef MAGNUM_TARGET_GLES
+        MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GL310);
+        #else
+        MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::EXT::texture_buffer);
+        #endif
+    }
+    #endif
+
+    /* Color is not used at all when only depth is written without alpha
+       testing */
+    const bool colored = !(flags & Flag::DepthOnly) || (flags & Flag::Textured);
+
     Shader vert = Implementation::createCompatibilityShader(rs, version, Shader::Type::Vertex);
     Shader frag = Implementation::createCompatibilityShader(rs, version, Shader::Type::Fragment);
 
+    #ifndef MAGNUM_TARGET_GLES2
+    if(flags & Flag::UniformBuffers) {
+        vert.addSource("#define UNIFORM_BUFFERS\n");
+        frag.addSource("#define UNIFORM_BUFFERS\n");
+    }
+    #endif
+    #ifndef MAGNUM_TARGET_GLES
+    if(bindless) frag.addSource("#define BINDLESS_TEXTURE\n");
+    #endif
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(flags & Flag::VertexPulling) vert.addSource("#define VERTEX_PULLING\n");
+    #endif
     vert.addSource(flags & Flag::Textured ? "#define TEXTURED\n" : "")
+        .addSource(flags & Flag::VertexColor ? "#define VERTEX_COLOR\n" : "")
+        .addSource(flags & Flag::InstancedTransformation ? "#define INSTANCED_TRANSFORMATION\n" : "")
         .addSource(rs.get("generic.glsl"))
         .addSource(rs.get(vertexShaderName<dimensions>()));
     frag.addSource(flags & Flag::Textured ? "#define TEXTURED\n" : "")
+        .addSource(flags & Flag::DepthOnly ? "#define DEPTH_ONLY\n" : "")
+        .addSource(flags & Flag::VertexColor ? "#define VERTEX_COLOR\n" : "")
         .addSource(rs.get("Flat.frag"));
 
     CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({vert, frag}));
@@ -77,31 +146,74 @@ template<UnsignedInt dimensions> Flat<dimensions>::Flat(const Flags flags): tran
     if(!Context::current().isVersionSupported(Version::GLES300))
     #endif
     {
-        bindAttributeLocation(Position::Location, "position");
-        if(flags & Flag::Textured) bindAttributeLocation(TextureCoordinates::Location, "textureCoordinates");
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        if(!(flags & Flag::VertexPulling))
+        #endif
+        {
+            bindAttributeLocation(Position::Location, "position");
+            if(flags & Flag::Textured) bindAttributeLocation(TextureCoordinates::Location, "textureCoordinates");
+            if(flags & Flag::VertexColor) bindAttributeLocation(Color::Location, "vertexColor");
+        }
+        if(flags & Flag::InstancedTransformation) bindAttributeLocation(TransformationMatrix::Location, "instancedTransformationMatrix");
     }
 
     CORRADE_INTERNAL_ASSERT_OUTPUT(link());
-
+    reflectUniforms();
+
+    #ifndef MAGNUM_TARGET_GLES2
+    if(flags & Flag::UniformBuffers) {
+        #ifndef MAGNUM_TARGET_GLES
+        if(!Context::current().isExtensionSupported<Extensions::GL::ARB::shading_language_420pack>(version))
+        #endif
+        {
+            setUniformBlockBinding(uniformBlockIndex("FlatTransformation"), TransformationUniformBinding);
+            if(colored) setUniformBlockBinding(uniformBlockIndex("FlatMaterial"), MaterialUniformBinding);
+        }
+    } else
+    #endif
     #ifndef MAGNUM_TARGET_GLES
     if(!Context::current().isExtensionSupported<Extensions::GL::ARB::explicit_uniform_location>(version))
     #endif
     {
         transformationProjectionMatrixUniform = uniformLocation("transformationProjectionMatrix");
-        colorUniform = uniformLocation("color");
+        if(colored) colorUniform = uniformLocation("color");
     }
 
+    /* Make setColor() a no-op if the uniform is not there */
+    if(!colored) colorUniform = -1;
+
     #ifndef MAGNUM_TARGET_GLES
     if(!Context::current().isExtensionSupported<Extensions::GL::ARB::shading_language_420pack>(version))
     #endif
     {
-        if(flags & Flag::Textured) setUniform(uniformLocation("textureData"), TextureLayer);
+        if(flags & Flag::Textured
+            #ifndef MAGNUM_TARGET_GLES
+            && !bindless
+            #endif
+        ) setUniform(uniformLocation("textureData"), TextureLayer);
+
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        if(flags & Flag::VertexPulling) {
+            setUniform(uniformLocation("positionBuffer"), PositionBufferTextureLayer);
+            if(flags & Flag::Textured) setUniform(uniformLocation("textureCoordinatesBuffer"), TextureCoordinatesBufferTextureLayer);
+            if(flags & Flag::VertexColor) setUniform(uniformLocation("colorBuffer"), ColorBufferTextureLayer);
+        }
+        #endif
     }
 
+    #ifndef MAGNUM_TARGET_GLES
+    if(bindless) textureUniform = uniformLocation("textureData");
+    #endif
+
     /* Set defaults in OpenGL ES (for desktop they are set in shader code itself) */
     #ifdef MAGNUM_TARGET_GLES
-    /* Default to fully opaque white so we can see the texture */
-    if(flags & Flag::Textured) setColor(Color4(1.0f));
+    /* Default to fully opaque white so we can see the texture, uniform
+       blocks have no defaults */
+    if(flags & Flag::Textured
+        #ifndef MAGNUM_TARGET_GLES2
+        && !(flags & Flag::UniformBuffers)
+        #endif
+    ) setColor(Color4(1.0f));
     #endif
 }
 
@@ -110,6 +222,21 @@ template<UnsignedInt dimensions> Flat<dimensions>& Flat<dimensions>::setTexture(
     return *this;
 }
 
+#ifndef MAGNUM_TARGET_GLES
+template<UnsignedInt dimensions> Flat<dimensions>& Flat<dimensions>::setTexture(const TextureHandle& handle) {
+    if(textureUniform != -1) setUniform(textureUniform, handle);
+    return *this;
+}
+#endif
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+template<UnsignedInt dimensions> Flat<dimensions>& Flat<dimensions>::setVertexBuffers(BufferTexture& positions, BufferTexture* const textureCoordinates, BufferTexture* const colors) {
+    if(_flags & Flag::VertexPulling)
+        AbstractTexture::bind(PositionBufferTextureLayer, {&positions, textureCoordinates, colors});
+    return *this;
+}
+#endif
+
 template class Flat<2>;
 template class Flat<3>;
 
@@ -23,6 +23,10 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#ifdef BINDLESS_TEXTURE
+#extension GL_ARB_bindless_texture: require
+#endif
+
 #ifndef NEW_GLSL
 #define fragmentColor gl_FragColor
 #define texture texture2D
@@ -30,12 +34,24 @@
 #endif
 
 #ifdef TEXTURED
-#ifdef EXPLICIT_TEXTURE_LAYER
+#ifdef BINDLESS_TEXTURE
+layout(bindless_sampler)
+#elif defined(EXPLICIT_TEXTURE_LAYER)
 layout(binding = 0)
 #endif
 uniform lowp sampler2D textureData;
 #endif
 
+#ifdef UNIFORM_BUFFERS
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(std140, binding = 1)
+#else
+layout(std140)
+#endif
+uniform FlatMaterial {
+    lowp vec4 color;
+};
+#else
 #ifdef EXPLICIT_UNIFORM_LOCATION
 layout(location = 1)
 #endif
@@ -44,19 +60,35 @@ uniform lowp vec4 color
     = vec4(1.0)
     #endif
     ;
+#endif
 
 #ifdef TEXTURED
 in mediump vec2 interpolatedTextureCoordinates;
 #endif
 
-#ifdef NEW_GLSL
+#if defined(VERTEX_COLOR) && !defined(DEPTH_ONLY)
+in lowp vec4 interpolatedVertexColor;
+#endif
+
+#if defined(NEW_GLSL) && !defined(DEPTH_ONLY)
 out lowp vec4 fragmentColor;
 #endif
 
 void main() {
+    #ifdef DEPTH_ONLY
+    /* Only alpha-tested, depth is written implicitly */
+    #ifdef TEXTURED
+    if(texture(textureData, interpolatedTextureCoordinates).a*color.a < 0.5)
+        discard;
+    #endif
+    #else
     fragmentColor =
         #ifdef TEXTURED
         texture(textureData, interpolatedTextureCoordinates)*
         #endif
+        #ifdef VERTEX_COLOR
+        interpolatedVertexColor*
+        #endif
         color;
+    #endif
 }
@@ -33,13 +33,30 @@
 #include "Magnum/Math/Color.h"
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/UniformBlock.h"
+#endif
 #include "Magnum/Shaders/Generic.h"
 #include "Magnum/Shaders/visibility.h"
 
 namespace Magnum { namespace Shaders {
 
 namespace Implementation {
-    enum class FlatFlag: UnsignedByte { Textured = 1 << 0 };
+    enum class FlatFlag: UnsignedByte {
+        Textured = 1 << 0,
+        #ifndef MAGNUM_TARGET_GLES2
+        UniformBuffers = 1 << 1,
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        BindlessTexture = 1 << 2,
+        #endif
+        DepthOnly = 1 << 3,
+        VertexColor = 1 << 4,
+        InstancedTransformation = 1 << 5,
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        VertexPulling = 1 << 6
+        #endif
+    };
     typedef Containers::EnumSet<FlatFlag> FlatFlags;
 }
 
@@ -58,6 +75,52 @@ texturing is enabled.
 
 For coloring the texture based on intensity you can use the @ref Vector shader.
 
+With @ref Flag::UniformBuffers the shader takes the parameters from
+@ref TransformationUniformBlock and @ref MaterialUniformBlock instead of
+separate uniforms, see @ref Shaders-Phong-uniform-buffers "Phong shader documentation"
+for an example.
+
+With @ref Flag::DepthOnly the shader writes only depth, which together with
+just the @ref Position attribute makes it suitable for shadow map rendering
+and depth pre-passes.
+
+With @ref Flag::BindlessTexture the texture is not bound to any texture unit
+but accessed through a @ref TextureHandle passed to
+@ref setTexture(const TextureHandle&), which removes the texture binding
+overhead when drawing many differently textured meshes.
+
+With @ref Flag::VertexColor the color is additionally multiplied with the
+@ref Color attribute and with @ref Flag::InstancedTransformation the position
+is additionally transformed with the @ref TransformationMatrix attribute. When
+both attributes are added with @ref Mesh::addVertexBufferInstanced(), many
+differently colored and placed copies of the same mesh can be drawn with a
+single instanced draw call:
+@code
+struct Instance {
+    Matrix4 transformation;
+    Color4 color;
+};
+std::vector<Instance> instanceData;
+
+Buffer instances;
+instances.setData(instanceData, BufferUsage::DynamicDraw);
+mesh.addVertexBufferInstanced(instances, 1, 0,
+        Shaders::Flat3D::TransformationMatrix{},
+        Shaders::Flat3D::Color{})
+    .setInstanceCount(instanceData.size());
+
+Shaders::Flat3D shader{Shaders::Flat3D::Flag::VertexColor|
+                       Shaders::Flat3D::Flag::InstancedTransformation};
+shader.setTransformationProjectionMatrix(projectionMatrix*cameraMatrix);
+mesh.draw(shader);
+@endcode
+
+With @ref Flag::VertexPulling the position, texture coordinates and vertex
+color are fetched from buffer textures set via @ref setVertexBuffers(),
+indexed with @glsl gl_VertexID @ce, instead of vertex attributes. See
+@ref Shaders-Phong-vertex-pulling "Phong shader documentation" for an
+example.
+
 @image html shaders-flat.png
 @image latex shaders-flat.png
 
@@ -142,6 +205,24 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Flat: public Abstra
          */
         typedef typename Generic<dimensions>::TextureCoordinates TextureCoordinates;
 
+        /**
+         * @brief Vertex color
+         *
+         * @ref shaders-generic "Generic attribute", @ref Magnum::Color4 "Color4".
+         * Data with @ref Magnum::Color3 "Color3" can be added using
+         * @ref Generic::Color. Used only if @ref Flag::VertexColor is set.
+         */
+        typedef Attribute<3, Magnum::Color4> Color;
+
+        /**
+         * @brief Per-instance transformation matrix
+         *
+         * @ref shaders-generic "Generic attribute", @ref Matrix3 in 2D,
+         * @ref Matrix4 in 3D. Used only if @ref Flag::InstancedTransformation
+         * is set.
+         */
+        typedef typename Generic<dimensions>::TransformationMatrix TransformationMatrix;
+
         #ifdef DOXYGEN_GENERATING_OUTPUT
         /**
          * @brief Flag
@@ -149,7 +230,72 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Flat: public Abstra
          * @see @ref Flags, @ref flags()
          */
         enum class Flag: UnsignedByte {
-            Textured = 1 << 0   /**< The shader uses texture instead of color */
+            Textured = 1 << 0,  /**< The shader uses texture instead of color */
+
+            /**
+             * The shader takes the parameters from
+             * @ref TransformationUniformBlock and @ref MaterialUniformBlock
+             * instead of separate uniforms.
+             * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+             * @requires_gles30 Uniform buffers are not available in OpenGL
+             *      ES 2.0.
+             * @requires_webgl20 Uniform buffers are not available in WebGL
+             *      1.0.
+             */
+            UniformBuffers = 1 << 1,
+
+            /**
+             * The texture is accessed through a bindless handle set via
+             * @ref setTexture(const TextureHandle&) instead of being bound
+             * to a texture unit. Has effect only if @ref Flag::Textured is
+             * also set.
+             * @requires_extension Extension @extension{ARB,bindless_texture}
+             * @requires_gl Bindless textures are not available in OpenGL ES
+             *      or WebGL.
+             */
+            BindlessTexture = 1 << 2,
+
+            /**
+             * The shader doesn't write any color and is meant for rendering
+             * into depth-only framebuffers, such as shadow maps or depth
+             * pre-passes. If @ref Flag::Textured is also set, fragments with
+             * alpha of texture multiplied by color below `0.5` are
+             * discarded.
+             */
+            DepthOnly = 1 << 3,
+
+            /**
+             * The color is multiplied with the @ref Color attribute, either
+             * per-vertex or per-instance.
+             */
+            VertexColor = 1 << 4,
+
+            /**
+             * Vertex positions are transformed with the
+             * @ref TransformationMatrix attribute before applying
+             * transformation projection matrix. Meant to be used with
+             * @ref Mesh::addVertexBufferInstanced() for instanced rendering.
+             * @requires_gl33 Extension @extension{ARB,instanced_arrays} for
+             *      instanced rendering
+             * @requires_gles30 Extension @es_extension{ANGLE,instanced_arrays},
+             *      @es_extension{EXT,instanced_arrays} or
+             *      @es_extension{NV,instanced_arrays} in OpenGL ES 2.0 for
+             *      instanced rendering.
+             * @requires_webgl20 Extension @webgl_extension{ANGLE,instanced_arrays}
+             *      in WebGL 1.0 for instanced rendering.
+             */
+            InstancedTransformation = 1 << 5,
+
+            /**
+             * The position, texture coordinates and vertex color are
+             * fetched from buffer textures set via @ref setVertexBuffers()
+             * instead of vertex attributes. The @ref TransformationMatrix
+             * attribute is still taken from the mesh.
+             * @requires_gl31 Extension @extension{ARB,texture_buffer_object}
+             * @requires_gles31 Extension @es_extension{EXT,texture_buffer}
+             * @requires_gles Buffer textures are not available in WebGL.
+             */
+            VertexPulling = 1 << 6
         };
 
         /**
@@ -163,6 +309,48 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Flat: public Abstra
         typedef Implementation::FlatFlags Flags;
         #endif
 
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Transformation uniform block
+         *
+         * Transformation and projection matrix, used if
+         * @ref Flag::UniformBuffers is set. See
+         * @ref setTransformationProjectionMatrix() for details.
+         * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Uniform buffers are not available in WebGL 1.0.
+         */
+        typedef UniformBlock<MatrixTypeFor<dimensions, Float>> TransformationUniformBlock;
+
+        /**
+         * @brief Material uniform block
+         *
+         * Color, used if @ref Flag::UniformBuffers is set. See
+         * @ref setColor() for details. Unlike with separate uniforms, the
+         * color doesn't have any default value.
+         * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Uniform buffers are not available in WebGL 1.0.
+         */
+        typedef UniformBlock<Color4> MaterialUniformBlock;
+
+        enum: UnsignedInt {
+            /**
+             * Uniform buffer binding for @ref TransformationUniformBlock
+             * @see @ref UniformBlockBuffer::bind()
+             */
+            TransformationUniformBinding = 0,
+
+            /**
+             * Uniform buffer binding for @ref MaterialUniformBlock
+             * @see @ref UniformBlockBuffer::bind()
+             */
+            MaterialUniformBinding = 1
+        };
+        #endif
+
         /**
          * @brief Constructor
          * @param flags     Flags
@@ -203,9 +391,46 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Flat: public Abstra
          */
         Flat<dimensions>& setTexture(Texture2D& texture);
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Set bindless texture
+         * @return Reference to self (for method chaining)
+         *
+         * Has effect only if both @ref Flag::Textured and
+         * @ref Flag::BindlessTexture is set. The handle has to be resident
+         * when drawing.
+         * @requires_extension Extension @extension{ARB,bindless_texture}
+         * @requires_gl Bindless textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        Flat<dimensions>& setTexture(const TextureHandle& handle);
+        #endif
+
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        /**
+         * @brief Set vertex buffers
+         * @return Reference to self (for method chaining)
+         *
+         * Binds buffer textures containing one position, texture
+         * coordinates and vertex color texel per vertex. Only the first two
+         * components of position texels are used in 2D and the first three
+         * in 3D. The texture coordinates are used only if
+         * @ref Flag::Textured is set and the colors only if
+         * @ref Flag::VertexColor is set. Has effect only if
+         * @ref Flag::VertexPulling is set.
+         * @requires_gl31 Extension @extension{ARB,texture_buffer_object}
+         * @requires_gles31 Extension @es_extension{EXT,texture_buffer}
+         * @requires_gles Buffer textures are not available in WebGL.
+         */
+        Flat<dimensions>& setVertexBuffers(BufferTexture& positions, BufferTexture* textureCoordinates = nullptr, BufferTexture* colors = nullptr);
+        #endif
+
     private:
         Int transformationProjectionMatrixUniform,
             colorUniform;
+        #ifndef MAGNUM_TARGET_GLES
+        Int textureUniform;
+        #endif
 
         Flags _flags;
 };
@@ -28,30 +28,103 @@
 #define out varying
 #endif
 
+#if defined(VERTEX_PULLING) && defined(GL_ES) && __VERSION__ < 320
+#extension GL_EXT_texture_buffer: require
+#endif
+
+#ifdef UNIFORM_BUFFERS
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(std140, binding = 0)
+#else
+layout(std140)
+#endif
+uniform FlatTransformation {
+    highp mat3 transformationProjectionMatrix;
+};
+#else
 #ifdef EXPLICIT_UNIFORM_LOCATION
 layout(location = 0)
 #endif
 uniform highp mat3 transformationProjectionMatrix;
+#endif
 
+#ifdef VERTEX_PULLING
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 1)
+#endif
+uniform highp samplerBuffer positionBuffer;
+#else
 #ifdef EXPLICIT_ATTRIB_LOCATION
 layout(location = POSITION_ATTRIBUTE_LOCATION)
 #endif
 in highp vec2 position;
+#endif
 
 #ifdef TEXTURED
+#ifdef VERTEX_PULLING
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 2)
+#endif
+uniform mediump samplerBuffer textureCoordinatesBuffer;
+#else
 #ifdef EXPLICIT_ATTRIB_LOCATION
 layout(location = TEXTURECOORDINATES_ATTRIBUTE_LOCATION)
 #endif
 in mediump vec2 textureCoordinates;
+#endif
 
 out mediump vec2 interpolatedTextureCoordinates;
 #endif
 
+#ifdef VERTEX_COLOR
+#ifdef VERTEX_PULLING
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 3)
+#endif
+uniform lowp samplerBuffer colorBuffer;
+#else
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = COLOR_ATTRIBUTE_LOCATION)
+#endif
+in lowp vec4 vertexColor;
+#endif
+
+out lowp vec4 interpolatedVertexColor;
+#endif
+
+#ifdef INSTANCED_TRANSFORMATION
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = TRANSFORMATION_MATRIX_ATTRIBUTE_LOCATION)
+#endif
+in highp mat3 instancedTransformationMatrix;
+#endif
+
 void main() {
-    gl_Position.xywz = vec4(transformationProjectionMatrix*vec3(position, 1.0), 0.0);
+    #ifdef VERTEX_PULLING
+    /* Fetch the attributes from buffer textures. The vertex ID includes the
+       first vertex and base vertex offset of the draw call. */
+    highp vec2 position = texelFetch(positionBuffer, gl_VertexID).xy;
+    #ifdef TEXTURED
+    mediump vec2 textureCoordinates = texelFetch(textureCoordinatesBuffer, gl_VertexID).xy;
+    #endif
+    #ifdef VERTEX_COLOR
+    lowp vec4 vertexColor = texelFetch(colorBuffer, gl_VertexID);
+    #endif
+    #endif
+
+    gl_Position.xywz = vec4(transformationProjectionMatrix*
+        #ifdef INSTANCED_TRANSFORMATION
+        instancedTransformationMatrix*
+        #endif
+        vec3(position, 1.0), 0.0);
 
     #ifdef TEXTURED
     /* Texture coordinates, if needed */
     interpolatedTextureCoordinates = textureCoordinates;
     #endif
+
+    #ifdef VERTEX_COLOR
+    /* Vertex color, if needed */
+    interpolatedVertexColor = vertexColor;
+    #endif
 }
@@ -0,0 +1,111 @@
+#ifndef Magnum_Shaders_GBuffer_h
+#define Magnum_Shaders_GBuffer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::Shaders::GBuffer
+ */
+#endif
+
+#include "Magnum/configure.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/Framebuffer.h"
+#include "Magnum/Texture.h"
+#include "Magnum/Shaders/visibility.h"
+
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Geometry buffer for deferred shading
+
+Off-screen framebuffer with immutable @ref Texture2D attachments filled by
+@ref Phong with @ref Phong::Flag::GBuffer and consumed by
+@ref DeferredLighting:
+
+-   @ref albedoTexture() --- @ref TextureFormat::RGBA8, diffuse color in
+    RGB, specular intensity in alpha
+-   @ref normalTexture() --- @ref TextureFormat::RGB10A2, camera-space
+    normal octahedral-encoded in RG, shininess divided by `256` in B
+-   @ref depthTexture() --- @ref TextureFormat::DepthComponent24, used to
+    reconstruct the camera-space position
+
+All textures have nearest filtering and a single mip level. The attachments
+can't be resized, create a new instance when the window size changes. See
+@ref DeferredRenderer for a complete pipeline.
+@requires_gl30 Extension @extension{ARB,framebuffer_object}
+@requires_gles30 Multiple render targets are not available in OpenGL ES
+    2.0.
+@requires_webgl20 Multiple render targets are not available in WebGL 1.0.
+*/
+class MAGNUM_SHADERS_EXPORT GBuffer {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * Allocates the attachments with given size and maps
+         * @ref Phong::GBufferAlbedoOutput and @ref Phong::GBufferNormalOutput
+         * to them.
+         */
+        explicit GBuffer(const Vector2i& size);
+
+        /** @brief Size */
+        Vector2i size() const { return _size; }
+
+        /** @brief Framebuffer */
+        Framebuffer& framebuffer() { return _framebuffer; }
+
+        /** @brief Albedo texture */
+        Texture2D& albedoTexture() { return _albedo; }
+
+        /** @brief Normal texture */
+        Texture2D& normalTexture() { return _normal; }
+
+        /** @brief Depth texture */
+        Texture2D& depthTexture() { return _depth; }
+
+        /**
+         * @brief Bind and clear the framebuffer
+         * @return Reference to self (for method chaining)
+         *
+         * Clears all attachments, depth to `1.0` which marks pixels with
+         * nothing rendered.
+         */
+        GBuffer& bind();
+
+    private:
+        Vector2i _size;
+        Texture2D _albedo, _normal, _depth;
+        Framebuffer _framebuffer;
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
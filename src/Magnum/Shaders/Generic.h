@@ -73,6 +73,38 @@ template<UnsignedInt dimensions> struct Generic {
      * @ref Color3.
      */
     typedef Attribute<3, Color3> Color;
+
+    /**
+     * @brief Per-instance transformation matrix
+     *
+     * @ref Matrix3 in 2D and @ref Matrix4 in 3D, occupying three or four
+     * consecutive attribute locations. Meant to be used with
+     * @ref Mesh::addVertexBufferInstanced() for instanced rendering.
+     * @see @ref MeshTools::compile(const Trade::MeshData3D&, BufferUsage, Buffer&)
+     */
+    typedef Attribute<4, T> TransformationMatrix;
+
+    /**
+     * @brief Vertex joint IDs
+     *
+     * @ref Vector4ui, defined only in 3D. Indices of up to four joints
+     * influencing the vertex, used for skinning together with @ref Weights.
+     * @see @ref Shaders::Phong::Flag::Skinning
+     * @requires_gl30 Extension @extension{EXT,gpu_shader4}
+     * @requires_gles30 Integer attributes are not available in OpenGL ES
+     *      2.0.
+     * @requires_webgl20 Integer attributes are not available in WebGL 1.0.
+     */
+    typedef Attribute<8, Vector4ui> JointIds;
+
+    /**
+     * @brief Vertex joint weights
+     *
+     * @ref Vector4, defined only in 3D. Weights of joints referenced by
+     * @ref JointIds, expected to sum up to `1.0f`.
+     * @see @ref Shaders::Phong::Flag::Skinning
+     */
+    typedef Attribute<9, Vector4> Weights;
 };
 #endif
 
@@ -90,11 +122,17 @@ struct BaseGeneric {
 
 template<> struct Generic<2>: BaseGeneric {
     typedef Attribute<0, Vector2> Position;
+    typedef Attribute<4, Matrix3> TransformationMatrix;
 };
 
 template<> struct Generic<3>: BaseGeneric {
     typedef Attribute<0, Vector3> Position;
     typedef Attribute<2, Vector3> Normal;
+    typedef Attribute<4, Matrix4> TransformationMatrix;
+    #ifndef MAGNUM_TARGET_GLES2
+    typedef Attribute<8, Vector4ui> JointIds;
+    #endif
+    typedef Attribute<9, Vector4> Weights;
 };
 #endif
 
@@ -0,0 +1,160 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "LightClusters.h"
+
+#include <algorithm>
+#include <cmath>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/BufferTextureFormat.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector4.h"
+
+namespace Magnum { namespace Shaders {
+
+LightClusters::LightClusters(const Vector3i& gridSize): _gridSize{gridSize}, _fov{Deg{35.0f}}, _aspectRatio{1.0f}, _near{0.01f}, _far{100.0f}, _viewportSize{1} {
+    CORRADE_ASSERT(gridSize.min() > 0,
+        "Shaders::LightClusters: expected non-zero grid size, got" << gridSize, );
+
+    _clusters.resize(gridSize.product());
+
+    _lightTexture.setBuffer(BufferTextureFormat::RGBA32F, _lightBuffer);
+    _clusterTexture.setBuffer(BufferTextureFormat::RG32UI, _clusterBuffer);
+    _lightIndexTexture.setBuffer(BufferTextureFormat::R32UI, _lightIndexBuffer);
+}
+
+LightClusters& LightClusters::setProjection(const Rad fov, const Float aspectRatio, const Float near, const Float far) {
+    CORRADE_ASSERT(near > 0.0f && near < far,
+        "Shaders::LightClusters::setProjection(): expected 0 < near < far, got" << near << "and" << far, *this);
+
+    _fov = fov;
+    _aspectRatio = aspectRatio;
+    _near = near;
+    _far = far;
+    return *this;
+}
+
+LightClusters& LightClusters::setLights(const Containers::ArrayView<const Light> lights) {
+    _lights.assign(lights.begin(), lights.end());
+    return *this;
+}
+
+LightClusters& LightClusters::setLights(std::initializer_list<Light> lights) {
+    return setLights(Containers::arrayView(lights.begin(), lights.size()));
+}
+
+template<class F> void LightClusters::forEachCluster(const Light& light, F f) const {
+    /* Depth range of the light bounding sphere, camera looks down -Z */
+    const Float center = -light.position.z();
+    const Float minDepth = Math::max(center - light.range, _near);
+    const Float maxDepth = Math::min(center + light.range, _far);
+    if(minDepth > maxDepth) return;
+
+    /* Depth slices are distributed exponentially between near and far
+       plane, slice i spans near*(far/near)^(i/n) to near*(far/near)^((i+1)/n) */
+    const Float sliceScale = Float(_gridSize.z())/std::log(_far/_near);
+    const Int minSlice = Math::clamp(Int(std::log(minDepth/_near)*sliceScale), 0, _gridSize.z() - 1);
+    const Int maxSlice = Math::clamp(Int(std::log(maxDepth/_near)*sliceScale), 0, _gridSize.z() - 1);
+
+    /* Extents of the bounding box in view space */
+    const Vector2 tanHalfFov{Float(Math::tan(_fov*0.5f)), Float(Math::tan(_fov*0.5f))/_aspectRatio};
+    const Vector2 boxMin = light.position.xy() - Vector2{light.range};
+    const Vector2 boxMax = light.position.xy() + Vector2{light.range};
+    const Vector2 gridSizeXY{_gridSize.xy()};
+    const Vector2i lastCell = _gridSize.xy() - Vector2i{1};
+
+    for(Int slice = minSlice; slice <= maxSlice; ++slice) {
+        /* Part of the bounding box depth range inside this slice */
+        const Float sliceNear = Math::max(_near*std::exp(slice/sliceScale), minDepth);
+        const Float sliceFar = Math::min(_near*std::exp((slice + 1)/sliceScale), maxDepth);
+
+        /* Project the box slab conservatively -- negative edges project
+           farthest from the center at the near depth, positive at the far
+           depth and vice versa */
+        Vector2 ndcMin, ndcMax;
+        for(std::size_t i = 0; i != 2; ++i) {
+            ndcMin[i] = boxMin[i]/(boxMin[i] < 0.0f ? sliceNear : sliceFar)/tanHalfFov[i];
+            ndcMax[i] = boxMax[i]/(boxMax[i] > 0.0f ? sliceNear : sliceFar)/tanHalfFov[i];
+        }
+        if(ndcMin.x() > 1.0f || ndcMin.y() > 1.0f || ndcMax.x() < -1.0f || ndcMax.y() < -1.0f)
+            continue;
+
+        const Vector2i minCell{Math::min(Math::max(Vector2i{Math::floor((ndcMin*0.5f + Vector2{0.5f})*gridSizeXY)}, Vector2i{0}), lastCell)};
+        const Vector2i maxCell{Math::min(Math::max(Vector2i{Math::floor((ndcMax*0.5f + Vector2{0.5f})*gridSizeXY)}, Vector2i{0}), lastCell)};
+
+        for(Int y = minCell.y(); y <= maxCell.y(); ++y)
+            for(Int x = minCell.x(); x <= maxCell.x(); ++x)
+                f(x + _gridSize.x()*(y + _gridSize.y()*slice));
+    }
+}
+
+void LightClusters::bin() {
+    /* Count lights in every cell, turn the counts into offsets and then fill
+       the index list. Processing the lights in order keeps the indices in
+       every cell sorted. */
+    std::fill(_clusters.begin(), _clusters.end(), Vector2ui{});
+    for(const Light& light: _lights)
+        forEachCluster(light, [this](Int cluster) { ++_clusters[cluster].y(); });
+
+    UnsignedInt offset = 0;
+    for(Vector2ui& cluster: _clusters) {
+        cluster.x() = offset;
+        offset += cluster.y();
+        cluster.y() = 0;
+    }
+
+    _indices.resize(offset);
+    for(std::size_t i = 0; i != _lights.size(); ++i)
+        forEachCluster(_lights[i], [this, i](Int cluster) {
+            Vector2ui& c = _clusters[cluster];
+            _indices[c.x() + c.y()++] = i;
+        });
+
+    /* Two texels per light, position with range and color */
+    std::vector<Vector4> lightData;
+    lightData.reserve(_lights.size()*2);
+    for(const Light& light: _lights) {
+        lightData.emplace_back(light.position, light.range);
+        lightData.emplace_back(light.color, 0.0f);
+    }
+
+    /* Empty buffer textures are not allowed, upload at least one element */
+    if(lightData.empty()) lightData.emplace_back();
+    _lightBuffer.setData(lightData, BufferUsage::DynamicDraw);
+    _clusterBuffer.setData(_clusters, BufferUsage::DynamicDraw);
+    if(_indices.empty()) _lightIndexBuffer.setData({nullptr, sizeof(UnsignedInt)}, BufferUsage::DynamicDraw);
+    else _lightIndexBuffer.setData(_indices, BufferUsage::DynamicDraw);
+}
+
+Containers::ArrayView<const UnsignedInt> LightClusters::clusterLights(const Vector3i& cell) const {
+    CORRADE_ASSERT((cell >= Vector3i{0}).all() && (cell < _gridSize).all(),
+        "Shaders::LightClusters::clusterLights(): cell" << cell << "out of range for" << _gridSize << "grid", nullptr);
+
+    const Vector2ui cluster = _clusters[cell.x() + _gridSize.x()*(cell.y() + _gridSize.y()*cell.z())];
+    return {_indices.data() + cluster.x(), cluster.y()};
+}
+
+}}
@@ -0,0 +1,223 @@
+#ifndef Magnum_Shaders_LightClusters_h
+#define Magnum_Shaders_LightClusters_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+/** @file
+ * @brief Class @ref Magnum::Shaders::LightClusters
+ */
+#endif
+
+#include "Magnum/configure.h"
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Buffer.h"
+#include "Magnum/BufferTexture.h"
+#include "Magnum/Math/Angle.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Shaders/visibility.h"
+
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Light clusters for clustered forward shading
+
+Bins point lights into a grid of view-space frustum cells (*froxels*) and
+stores the result in buffer textures consumed by @ref Phong with
+@ref Phong::Flag::ClusteredLights. Every fragment then evaluates only the
+lights affecting its own cell, allowing hundreds of dynamic lights to be
+rendered in a single pass.
+
+The grid is split uniformly in screen space and exponentially in depth
+between near and far plane of the projection, which has to be perspective.
+The lights are specified in camera space, i.e. transformed with the same
+camera matrix as the meshes, and the binning is done on the CPU in
+@ref bin():
+@code
+Shaders::LightClusters clusters{{16, 9, 24}};
+clusters.setProjection(35.0_degf, 16.0f/9.0f, 0.1f, 100.0f)
+    .setViewportSize(defaultFramebuffer.viewport().size());
+
+Shaders::Phong shader{Shaders::Phong::Flag::ClusteredLights};
+
+// Each frame
+std::vector<Shaders::LightClusters::Light> lights;
+for(const Light& light: sceneLights)
+    lights.push_back({camera.cameraMatrix().transformPoint(light.position), light.range, light.color});
+clusters.setLights(lights)
+    .bin();
+
+shader.setLightClusters(clusters)
+    .setTransformationMatrix(transformationMatrix)
+    ...;
+mesh.draw(shader);
+@endcode
+
+The light data are stored as two @ref BufferTextureFormat::RGBA32F texels
+per light (position and range, color), each cell as a
+@ref BufferTextureFormat::RG32UI pair of offset and count into the
+@ref BufferTextureFormat::R32UI light index list. Cells are ordered by X,
+then Y and then depth slice.
+@requires_gl31 Extension @extension{ARB,texture_buffer_object}
+@requires_gles31 Extension @es_extension{EXT,texture_buffer}
+@requires_gles Buffer textures are not available in WebGL.
+*/
+class MAGNUM_SHADERS_EXPORT LightClusters {
+    public:
+        /** @brief Point light */
+        struct Light {
+            Vector3 position;   /**< @brief Position in camera space */
+            Float range;        /**< @brief Distance at which the light fades out */
+            Color3 color;       /**< @brief Light color */
+        };
+
+        /**
+         * @brief Constructor
+         * @param gridSize      Cell count in X, Y and depth
+         *
+         * Expects that all cell counts are non-zero. Default projection is
+         * 35° field of view, aspect ratio of 1, near plane at `0.01` and far
+         * plane at `100.0`, the default viewport size is @f$ 1 \times 1 @f$.
+         */
+        explicit LightClusters(const Vector3i& gridSize = {16, 9, 24});
+
+        /** @brief Cell count in X, Y and depth */
+        Vector3i gridSize() const { return _gridSize; }
+
+        /** @brief Total cell count */
+        std::size_t clusterCount() const { return _clusters.size(); }
+
+        /**
+         * @brief Set perspective projection
+         * @return Reference to self (for method chaining)
+         *
+         * Parameters have the same meaning as in
+         * @ref Matrix4::perspectiveProjection(Rad, Float, Float, Float) and
+         * have to match the projection used for rendering. Expects that
+         * @p near is positive and smaller than @p far. Affects the next
+         * @ref bin().
+         */
+        LightClusters& setProjection(Rad fov, Float aspectRatio, Float near, Float far);
+
+        /** @brief Horizontal field of view */
+        Rad fov() const { return _fov; }
+
+        /** @brief Aspect ratio */
+        Float aspectRatio() const { return _aspectRatio; }
+
+        /** @brief Near clipping plane */
+        Float near() const { return _near; }
+
+        /** @brief Far clipping plane */
+        Float far() const { return _far; }
+
+        /** @brief Viewport size */
+        Vector2i viewportSize() const { return _viewportSize; }
+
+        /**
+         * @brief Set viewport size
+         * @return Reference to self (for method chaining)
+         *
+         * Used for mapping fragment coordinates to cells, expected to match
+         * the viewport the meshes are rendered into.
+         */
+        LightClusters& setViewportSize(const Vector2i& size) {
+            _viewportSize = size;
+            return *this;
+        }
+
+        /** @brief Lights */
+        const std::vector<Light>& lights() const { return _lights; }
+
+        /**
+         * @brief Set lights
+         * @return Reference to self (for method chaining)
+         *
+         * Affects the next @ref bin().
+         */
+        LightClusters& setLights(Containers::ArrayView<const Light> lights);
+
+        /** @overload */
+        LightClusters& setLights(std::initializer_list<Light> lights);
+
+        /**
+         * @brief Bin the lights and upload the result
+         *
+         * Assigns every light to all cells intersecting its bounding box and
+         * uploads the light data, cell ranges and light index list into the
+         * buffer textures. Cost is linear in the count of cells covered by the
+         * lights.
+         */
+        void bin();
+
+        /**
+         * @brief Total count of light indices
+         *
+         * Sum of light counts in all cells after the last @ref bin().
+         */
+        std::size_t lightIndexCount() const { return _indices.size(); }
+
+        /**
+         * @brief Lights in given cell
+         *
+         * Indices into @ref lights() after the last @ref bin(), in ascending
+         * order. Expects that @p cell is inside the grid.
+         */
+        Containers::ArrayView<const UnsignedInt> clusterLights(const Vector3i& cell) const;
+
+        /** @brief Buffer texture with light data */
+        BufferTexture& lightTexture() { return _lightTexture; }
+
+        /** @brief Buffer texture with cell light ranges */
+        BufferTexture& clusterTexture() { return _clusterTexture; }
+
+        /** @brief Buffer texture with light index list */
+        BufferTexture& lightIndexTexture() { return _lightIndexTexture; }
+
+    private:
+        template<class F> void forEachCluster(const Light& light, F f) const;
+
+        Vector3i _gridSize;
+        Rad _fov;
+        Float _aspectRatio, _near, _far;
+        Vector2i _viewportSize;
+        std::vector<Light> _lights;
+        std::vector<Vector2ui> _clusters;
+        std::vector<UnsignedInt> _indices;
+        Buffer _lightBuffer, _clusterBuffer, _lightIndexBuffer;
+        BufferTexture _lightTexture, _clusterTexture, _lightIndexTexture;
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 and WebGL build
+#endif
+
+#endif
@@ -36,7 +36,11 @@
 
 namespace Magnum { namespace Shaders {
 
-MeshVisualizer::MeshVisualizer(const Flags flags): flags(flags), transformationProjectionMatrixUniform(0), viewportSizeUniform(1), colorUniform(2), wireframeColorUniform(3), wireframeWidthUniform(4), smoothnessUniform(5) {
+MeshVisualizer::MeshVisualizer(Flags flags): flags(flags), transformationProjectionMatrixUniform(0), viewportSizeUniform(1), colorUniform(2), wireframeColorUniform(3), wireframeWidthUniform(4), smoothnessUniform(5) {
+    /* Barycentric attribute is a variant of the no-GS wireframe rendering */
+    if(flags & Flag::BarycentricAttribute)
+        this->flags = flags |= Flag::NoGeometryShader;
+
     #ifndef MAGNUM_TARGET_GLES2
     if(flags & Flag::Wireframe && !(flags & Flag::NoGeometryShader)) {
         #ifndef MAGNUM_TARGET_GLES
@@ -73,6 +77,7 @@ MeshVisualizer::MeshVisualizer(const Flags flags): flags(flags), transformationP
 
     vert.addSource(flags & Flag::Wireframe ? "#define WIREFRAME_RENDERING\n" : "")
         .addSource(flags & Flag::NoGeometryShader ? "#define NO_GEOMETRY_SHADER\n" : "")
+        .addSource(flags & Flag::BarycentricAttribute ? "#define BARYCENTRIC_ATTRIBUTE\n" : "")
         #ifdef MAGNUM_TARGET_WEBGL
         .addSource("#define SUBSCRIPTING_WORKAROUND\n")
         #elif defined(MAGNUM_TARGET_GLES2)
@@ -112,9 +117,14 @@ MeshVisualizer::MeshVisualizer(const Flags flags): flags(flags), transformationP
     {
         bindAttributeLocation(Position::Location, "position");
 
+        if(flags & Flag::BarycentricAttribute)
+            bindAttributeLocation(Barycentric::Location, "barycentricCoordinates");
+
         #if !defined(MAGNUM_TARGET_GLES) || defined(MAGNUM_TARGET_GLES2)
         #ifndef MAGNUM_TARGET_GLES
-        if(!Context::current().isVersionSupported(Version::GL310))
+        else if(!Context::current().isVersionSupported(Version::GL310))
+        #else
+        else
         #endif
         {
             bindAttributeLocation(VertexIndex::Location, "vertexIndex");
@@ -123,6 +133,7 @@ MeshVisualizer::MeshVisualizer(const Flags flags): flags(flags), transformationP
     }
 
     CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+    reflectUniforms();
 
     #ifndef MAGNUM_TARGET_GLES
     if(!Context::current().isExtensionSupported<Extensions::GL::ARB::explicit_uniform_location>(version))
@@ -63,7 +63,9 @@ If you don't have geometry shaders, you need to set @ref Flag::NoGeometryShader
 (it's enabled by default in OpenGL ES 2.0) and use only **non-indexed** triangle
 meshes (see @ref MeshTools::duplicate() for possible solution). Additionaly, if
 you have OpenGL < 3.1 or OpenGL ES 2.0, you need to provide also
-@ref VertexIndex attribute.
+@ref VertexIndex attribute. Alternatively, with @ref Flag::BarycentricAttribute
+the barycentric coordinates are taken from the @ref Barycentric attribute,
+which works also with indexed meshes.
 
 @requires_gles30 Extension @es_extension{OES,standard_derivatives} for
     wireframe rendering without geometry shaders.
@@ -148,6 +150,45 @@ mesh.addVertexBuffer(vertices, 0, Shaders::MeshVisualizer::Position{});
 
 Rendering setup the same as above.
 
+### Wireframe visualization of indexed meshes using barycentric attribute
+
+Geometry shaders can be slow and de-indexing the mesh multiplies its vertex
+count. Alternatively, the barycentric coordinates can be generated once using
+@ref MeshTools::generateBarycentric(), which duplicates only the vertices
+needed to give every triangle corner a distinct coordinate, and passed to the
+shader via the @ref Barycentric attribute with @ref Flag::BarycentricAttribute
+enabled. The mesh stays indexed and no geometry shader is used. Mesh setup:
+@code
+std::vector<UnsignedInt> indices{ ... };
+std::vector<Vector3> positions{ ... };
+
+std::vector<UnsignedInt> vertexMapping;
+std::vector<Vector3> barycentric;
+std::tie(indices, vertexMapping, barycentric) = MeshTools::generateBarycentric(indices);
+
+Buffer vertices, barycentricCoordinates, indexBuffer;
+vertices.setData(MeshTools::duplicate(vertexMapping, positions), BufferUsage::StaticDraw);
+barycentricCoordinates.setData(barycentric, BufferUsage::StaticDraw);
+indexBuffer.setData(indices, BufferUsage::StaticDraw);
+
+Mesh mesh;
+mesh.addVertexBuffer(vertices, 0, Shaders::MeshVisualizer::Position{})
+    .addVertexBuffer(barycentricCoordinates, 0, Shaders::MeshVisualizer::Barycentric{})
+    .setIndexBuffer(indexBuffer, 0, Mesh::IndexType::UnsignedInt)
+    .setCount(indices.size());
+@endcode
+
+Rendering setup:
+@code
+Shaders::MeshVisualizer shader{Shaders::MeshVisualizer::Wireframe|
+                               Shaders::MeshVisualizer::BarycentricAttribute};
+shader.setColor(Color3::fromHSV(216.0_degf, 0.85f, 1.0f))
+    .setWireframeColor(Color3{0.95f})
+    .setTransformationProjectionMatrix(projectionMatrix*transformationMatrix);
+
+mesh.draw(shader);
+@endcode
+
 @see @ref shaders
 @todo Understand and add support wireframe width/smoothness without GS
 */
@@ -172,6 +213,16 @@ class MAGNUM_SHADERS_EXPORT MeshVisualizer: public AbstractShaderProgram {
          */
         typedef Attribute<3, Float> VertexIndex;
 
+        /**
+         * @brief Barycentric coordinates
+         *
+         * @ref Vector3, used only if @ref Flag::BarycentricAttribute is
+         * enabled. Each vertex of a triangle has to have a different one of
+         * @f$ (1, 0, 0) @f$, @f$ (0, 1, 0) @f$ and @f$ (0, 0, 1) @f$, see
+         * @ref MeshTools::generateBarycentric() for a way to generate them.
+         */
+        typedef Attribute<4, Vector3> Barycentric;
+
         /**
          * @brief Flag
          *
@@ -194,7 +245,17 @@ class MAGNUM_SHADERS_EXPORT MeshVisualizer: public AbstractShaderProgram {
              * attribute in the mesh. In OpenGL ES enabled alongside
              * @ref Flag::Wireframe.
              */
-            NoGeometryShader = 1 << 1
+            NoGeometryShader = 1 << 1,
+
+            /**
+             * Take the barycentric coordinates for wireframe visualization
+             * from the @ref Barycentric attribute instead of computing them
+             * in a geometry shader or from vertex index. Unlike
+             * @ref Flag::NoGeometryShader alone, this works also with indexed
+             * meshes. Implies @ref Flag::NoGeometryShader, has effect only
+             * together with @ref Flag::Wireframe.
+             */
+            BarycentricAttribute = 1 << 2
         };
 
         /** @brief Flags */
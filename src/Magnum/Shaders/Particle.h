@@ -0,0 +1,118 @@
+#ifndef Magnum_Shaders_Particle_h
+#define Magnum_Shaders_Particle_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::Shaders::Particle
+ */
+#endif
+
+#include "Magnum/configure.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shaders/ParticleSimulation.h"
+
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Particle shader
+
+Renders particles simulated by @ref ParticleSimulation as points with given
+color, fading out linearly over their lifetime. Particles that were not
+emitted yet are not rendered. Blending has to be enabled for the fading to
+have any effect and on desktop GL also @ref Renderer::Feature::ProgramPointSize
+for @ref setPointSize() to have any effect. See @ref ParticleSystem for an
+example.
+@requires_gl30 Extension @extension{EXT,gpu_shader4}
+@requires_gles30 Particle simulation is not available in OpenGL ES 2.0.
+@requires_webgl20 Particle simulation is not available in WebGL 1.0.
+@see @ref shaders
+*/
+class MAGNUM_SHADERS_EXPORT Particle: public AbstractShaderProgram {
+    public:
+        /**
+         * @brief Particle position
+         *
+         * @ref shaders-generic "Generic attribute", @ref Vector3.
+         */
+        typedef ParticleSimulation::Position Position;
+
+        /**
+         * @brief Particle life
+         *
+         * @ref Vector3, see @ref ParticleSimulation::Life.
+         */
+        typedef ParticleSimulation::Life Life;
+
+        explicit Particle();
+
+        /**
+         * @brief Set transformation and projection matrix
+         * @return Reference to self (for method chaining)
+         */
+        Particle& setTransformationProjectionMatrix(const Matrix4& matrix) {
+            setUniform(_transformationProjectionMatrixUniform, matrix);
+            return *this;
+        }
+
+        /**
+         * @brief Set color
+         * @return Reference to self (for method chaining)
+         *
+         * Color of newly emitted particles, alpha is multiplied with the
+         * remaining fraction of particle lifetime.
+         */
+        Particle& setColor(const Color4& color) {
+            setUniform(_colorUniform, color);
+            return *this;
+        }
+
+        /**
+         * @brief Set point size
+         * @return Reference to self (for method chaining)
+         *
+         * Default is `1.0f`.
+         */
+        Particle& setPointSize(Float size) {
+            setUniform(_pointSizeUniform, size);
+            return *this;
+        }
+
+    private:
+        Int _transformationProjectionMatrixUniform,
+            _colorUniform,
+            _pointSizeUniform;
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
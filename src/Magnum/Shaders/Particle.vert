@@ -0,0 +1,56 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+uniform highp mat4 transformationProjectionMatrix;
+uniform highp float pointSize
+    #ifndef GL_ES
+    = 1.0
+    #endif
+    ;
+
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = POSITION_ATTRIBUTE_LOCATION)
+#endif
+in highp vec4 position;
+
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = LIFE_ATTRIBUTE_LOCATION)
+#endif
+in highp vec3 life;
+
+out lowp float fade;
+
+void main() {
+    /* Move particles that were not emitted yet out of the clip volume */
+    if(life.x < 0.0) {
+        gl_Position = vec4(2.0, 2.0, 2.0, 1.0);
+        fade = 0.0;
+        return;
+    }
+
+    gl_Position = transformationProjectionMatrix*position;
+    gl_PointSize = pointSize;
+    fade = 1.0 - life.x/life.y;
+}
@@ -0,0 +1,129 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ParticleSimulation.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include <string>
+#include <Corrade/Utility/Resource.h>
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Shader.h"
+
+#include "Implementation/CreateCompatibilityShader.h"
+
+namespace Magnum { namespace Shaders {
+
+ParticleSimulation::ParticleSimulation() {
+    #ifdef MAGNUM_BUILD_STATIC
+    /* Import resources on static build, if not already */
+    if(!Utility::Resource::hasGroup("MagnumShaders"))
+        importShaderResources();
+    #endif
+    Utility::Resource rs("MagnumShaders");
+
+    /* Integer operations and gl_VertexID need GLSL 1.30 */
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GL300);
+    const Version version = Context::current().supportedVersion({Version::GL320, Version::GL310, Version::GL300});
+    #else
+    const Version version = Version::GLES300;
+    #endif
+
+    Shader vert = Implementation::createCompatibilityShader(rs, version, Shader::Type::Vertex);
+    vert.addSource("#define VELOCITY_ATTRIBUTE_LOCATION " + std::to_string(Velocity::Location) + "\n"
+                   "#define LIFE_ATTRIBUTE_LOCATION " + std::to_string(Life::Location) + "\n"
+                   "#define EMITTER_COUNT " + std::to_string(MaxEmitterCount) + "\n")
+        .addSource(rs.get("generic.glsl"))
+        .addSource(rs.get("ParticleSimulation.vert"));
+
+    /* OpenGL ES requires a fragment shader even if rasterization is
+       discarded */
+    #ifdef MAGNUM_TARGET_GLES
+    Shader frag = Implementation::createCompatibilityShader(rs, version, Shader::Type::Fragment);
+    frag.addSource("out lowp vec4 fragmentColor;\n"
+                   "void main() { fragmentColor = vec4(0.0); }\n");
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({vert, frag}));
+    attachShaders({vert, frag});
+    #else
+    CORRADE_INTERNAL_ASSERT_OUTPUT(vert.compile());
+    attachShader(vert);
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::explicit_attrib_location>(version))
+    #endif
+    {
+        bindAttributeLocation(Position::Location, "position");
+        bindAttributeLocation(Velocity::Location, "velocity");
+        bindAttributeLocation(Life::Location, "life");
+    }
+
+    setTransformFeedbackOutputs({"simulatedPosition", "simulatedVelocity", "simulatedLife"}, TransformFeedbackBufferMode::InterleavedAttributes);
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+    reflectUniforms();
+
+    _timeDeltaUniform = uniformLocation("timeDelta");
+    _gravityUniform = uniformLocation("gravity");
+    _seedUniform = uniformLocation("seed");
+    _emitterPositionsUniform = uniformLocation("emitterPositions");
+    _emitterVelocitiesUniform = uniformLocation("emitterVelocities");
+    _emitterSpreadsUniform = uniformLocation("emitterSpreads");
+    _emitterLifetimesUniform = uniformLocation("emitterLifetimes");
+}
+
+ParticleSimulation& ParticleSimulation::setEmitterPositions(const Containers::ArrayView<const Vector3> positions) {
+    CORRADE_ASSERT(positions.size() <= MaxEmitterCount,
+        "Shaders::ParticleSimulation::setEmitterPositions(): expected at most" << MaxEmitterCount << "emitters, got" << positions.size(), *this);
+    setUniform(_emitterPositionsUniform, Containers::ArrayView<const Math::Vector<3, Float>>{positions.data(), positions.size()});
+    return *this;
+}
+
+ParticleSimulation& ParticleSimulation::setEmitterVelocities(const Containers::ArrayView<const Vector3> velocities) {
+    CORRADE_ASSERT(velocities.size() <= MaxEmitterCount,
+        "Shaders::ParticleSimulation::setEmitterVelocities(): expected at most" << MaxEmitterCount << "emitters, got" << velocities.size(), *this);
+    setUniform(_emitterVelocitiesUniform, Containers::ArrayView<const Math::Vector<3, Float>>{velocities.data(), velocities.size()});
+    return *this;
+}
+
+ParticleSimulation& ParticleSimulation::setEmitterSpreads(const Containers::ArrayView<const Float> spreads) {
+    CORRADE_ASSERT(spreads.size() <= MaxEmitterCount,
+        "Shaders::ParticleSimulation::setEmitterSpreads(): expected at most" << MaxEmitterCount << "emitters, got" << spreads.size(), *this);
+    setUniform(_emitterSpreadsUniform, spreads);
+    return *this;
+}
+
+ParticleSimulation& ParticleSimulation::setEmitterLifetimes(const Containers::ArrayView<const Float> lifetimes) {
+    CORRADE_ASSERT(lifetimes.size() <= MaxEmitterCount,
+        "Shaders::ParticleSimulation::setEmitterLifetimes(): expected at most" << MaxEmitterCount << "emitters, got" << lifetimes.size(), *this);
+    setUniform(_emitterLifetimesUniform, lifetimes);
+    return *this;
+}
+
+}}
+#endif
@@ -0,0 +1,175 @@
+#ifndef Magnum_Shaders_ParticleSimulation_h
+#define Magnum_Shaders_ParticleSimulation_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::Shaders::ParticleSimulation
+ */
+#endif
+
+#include "Magnum/configure.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Shaders/Generic.h"
+#include "Magnum/Shaders/visibility.h"
+
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Particle simulation shader
+
+Advances particle state using transform feedback, without any data
+round-tripping through the CPU. Each particle has a @ref Position, a
+@ref Velocity and a @ref Life attribute, which contains the particle age, its
+lifetime and the ID of the emitter it belongs to. Particles with negative age
+are not emitted yet, particles reaching their lifetime are re-emitted from
+their emitter with velocity randomized by emitter spread. The shader outputs
+the new state into transform feedback in the same interleaved layout.
+
+Usually not used directly, see @ref ParticleSystem for a ready-to-use setup
+ping-ponging two buffers and @ref Particle for rendering the particles.
+@requires_gl30 Extension @extension{EXT,transform_feedback} and
+    @extension{EXT,gpu_shader4}
+@requires_gles30 Transform feedback is not available in OpenGL ES 2.0.
+@requires_webgl20 Transform feedback is not available in WebGL 1.0.
+@see @ref shaders
+*/
+class MAGNUM_SHADERS_EXPORT ParticleSimulation: public AbstractShaderProgram {
+    public:
+        enum: UnsignedInt {
+            /** Max count of emitters */
+            MaxEmitterCount = 8
+        };
+
+        /**
+         * @brief Particle position
+         *
+         * @ref shaders-generic "Generic attribute", @ref Vector3, so the
+         * simulated buffer can be directly rendered with other shaders.
+         */
+        typedef Generic3D::Position Position;
+
+        /** @brief Particle velocity */
+        typedef Attribute<1, Vector3> Velocity;
+
+        /**
+         * @brief Particle life
+         *
+         * Age, lifetime and emitter ID (stored as float).
+         */
+        typedef Attribute<2, Vector3> Life;
+
+        explicit ParticleSimulation();
+
+        /**
+         * @brief Set time delta
+         * @return Reference to self (for method chaining)
+         *
+         * Time in seconds to advance the simulation by.
+         */
+        ParticleSimulation& setTimeDelta(Float timeDelta) {
+            setUniform(_timeDeltaUniform, timeDelta);
+            return *this;
+        }
+
+        /**
+         * @brief Set gravity
+         * @return Reference to self (for method chaining)
+         *
+         * Acceleration applied to all particles. Default is zero vector.
+         */
+        ParticleSimulation& setGravity(const Vector3& gravity) {
+            setUniform(_gravityUniform, gravity);
+            return *this;
+        }
+
+        /**
+         * @brief Set random seed
+         * @return Reference to self (for method chaining)
+         *
+         * Should be changed every step, otherwise particles re-emitted in
+         * different steps get the same random velocity.
+         */
+        ParticleSimulation& setSeed(UnsignedInt seed) {
+            setUniform(_seedUniform, seed);
+            return *this;
+        }
+
+        /**
+         * @brief Set emitter positions
+         * @return Reference to self (for method chaining)
+         *
+         * Expects at most @ref MaxEmitterCount items.
+         */
+        ParticleSimulation& setEmitterPositions(Containers::ArrayView<const Vector3> positions);
+
+        /**
+         * @brief Set emitter velocities
+         * @return Reference to self (for method chaining)
+         *
+         * Initial velocity of emitted particles. Expects at most
+         * @ref MaxEmitterCount items.
+         */
+        ParticleSimulation& setEmitterVelocities(Containers::ArrayView<const Vector3> velocities);
+
+        /**
+         * @brief Set emitter spreads
+         * @return Reference to self (for method chaining)
+         *
+         * Max random deviation of each velocity component of emitted
+         * particles. Expects at most @ref MaxEmitterCount items.
+         */
+        ParticleSimulation& setEmitterSpreads(Containers::ArrayView<const Float> spreads);
+
+        /**
+         * @brief Set emitter lifetimes
+         * @return Reference to self (for method chaining)
+         *
+         * Lifetime of emitted particles in seconds. Expects at most
+         * @ref MaxEmitterCount items.
+         */
+        ParticleSimulation& setEmitterLifetimes(Containers::ArrayView<const Float> lifetimes);
+
+    private:
+        Int _timeDeltaUniform,
+            _gravityUniform,
+            _seedUniform,
+            _emitterPositionsUniform,
+            _emitterVelocitiesUniform,
+            _emitterSpreadsUniform,
+            _emitterLifetimesUniform;
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
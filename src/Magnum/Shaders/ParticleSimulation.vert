@@ -0,0 +1,99 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+uniform highp float timeDelta;
+uniform highp vec3 gravity;
+uniform highp uint seed;
+
+uniform highp vec3 emitterPositions[EMITTER_COUNT];
+uniform highp vec3 emitterVelocities[EMITTER_COUNT];
+uniform highp float emitterSpreads[EMITTER_COUNT];
+uniform highp float emitterLifetimes[EMITTER_COUNT];
+
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = POSITION_ATTRIBUTE_LOCATION)
+#endif
+in highp vec3 position;
+
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = VELOCITY_ATTRIBUTE_LOCATION)
+#endif
+in highp vec3 velocity;
+
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = LIFE_ATTRIBUTE_LOCATION)
+#endif
+in highp vec3 life;
+
+out highp vec3 simulatedPosition;
+out highp vec3 simulatedVelocity;
+out highp vec3 simulatedLife;
+
+/* Integer hash with good avalanche, used instead of a noise texture */
+highp uint hash(highp uint x) {
+    x ^= x >> 16u;
+    x *= 0x7feb352du;
+    x ^= x >> 15u;
+    x *= 0x846ca68bu;
+    x ^= x >> 16u;
+    return x;
+}
+
+/* Uniformly distributed in [-1, 1], using only 24 bits to be exact in float */
+highp float random(highp uint x) {
+    return float(hash(x) >> 8u)/8388607.5 - 1.0;
+}
+
+void main() {
+    /* Life is (age, lifetime, emitter ID), negative age means the particle
+       was not emitted yet */
+    int emitter = int(life.z);
+    highp float age = life.x + timeDelta;
+
+    /* Emit the particle for the first time or re-emit an expired one */
+    if((life.x < 0.0 && age >= 0.0) || (life.x >= 0.0 && age >= life.y)) {
+        if(life.x >= 0.0) age = min(age - life.y, timeDelta);
+
+        highp uint id = uint(gl_VertexID)*3u + seed*0x9e3779b9u;
+        highp vec3 direction = vec3(random(id), random(id + 1u), random(id + 2u));
+        simulatedPosition = emitterPositions[emitter];
+        simulatedVelocity = emitterVelocities[emitter] + direction*emitterSpreads[emitter];
+        simulatedLife = vec3(age, emitterLifetimes[emitter], life.z);
+
+    /* Alive particle, integrate */
+    } else if(age >= 0.0) {
+        simulatedVelocity = velocity + gravity*timeDelta;
+        simulatedPosition = position + simulatedVelocity*timeDelta;
+        simulatedLife = vec3(age, life.y, life.z);
+
+    /* Not emitted yet, only count down */
+    } else {
+        simulatedPosition = position;
+        simulatedVelocity = velocity;
+        simulatedLife = vec3(age, life.y, life.z);
+    }
+
+    gl_Position = vec4(simulatedPosition, 1.0);
+}
@@ -0,0 +1,139 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ParticleSystem.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Renderer.h"
+
+namespace Magnum { namespace Shaders {
+
+namespace {
+    struct Vertex {
+        Vector3 position;
+        Vector3 velocity;
+        Vector3 life;
+    };
+}
+
+ParticleSystem::ParticleSystem(std::vector<Emitter> emitters): _emitters{std::move(emitters)} {
+    CORRADE_ASSERT(!_emitters.empty() && _emitters.size() <= ParticleSimulation::MaxEmitterCount,
+        "Shaders::ParticleSystem: expected at least one and at most" << ParticleSimulation::MaxEmitterCount << "emitters, got" << _emitters.size(), );
+
+    /* Stagger the initial ages so each emitter emits at a steady rate instead
+       of everything at once */
+    std::vector<Vertex> data;
+    for(std::size_t i = 0; i != _emitters.size(); ++i) {
+        const Emitter& emitter = _emitters[i];
+        CORRADE_ASSERT(emitter.lifetime > 0.0f,
+            "Shaders::ParticleSystem: expected positive lifetime for emitter" << i, );
+        for(UnsignedInt j = 0; j != emitter.count; ++j)
+            data.push_back({emitter.position, emitter.velocity, {-emitter.lifetime*Float(j)/emitter.count, emitter.lifetime, Float(i)}});
+    }
+    _count = data.size();
+
+    /* The first buffer has the initial state, the second only storage */
+    _buffers[0].setData(data, BufferUsage::DynamicCopy);
+    _buffers[1].setData({nullptr, data.size()*sizeof(Vertex)}, BufferUsage::DynamicCopy);
+
+    for(std::size_t i = 0; i != 2; ++i) {
+        _meshes[i].setPrimitive(MeshPrimitive::Points)
+            .setCount(_count)
+            .addVertexBuffer(_buffers[i], 0,
+                ParticleSimulation::Position{},
+                ParticleSimulation::Velocity{},
+                ParticleSimulation::Life{});
+        _feedbacks[i].attachBuffer(0, _buffers[i]);
+    }
+}
+
+ParticleSystem& ParticleSystem::setEmitterPosition(const UnsignedInt id, const Vector3& position) {
+    CORRADE_ASSERT(id < _emitters.size(),
+        "Shaders::ParticleSystem::setEmitterPosition(): index" << id << "out of range for" << _emitters.size() << "emitters", *this);
+    _emitters[id].position = position;
+    _emittersChanged = true;
+    return *this;
+}
+
+ParticleSystem& ParticleSystem::setEmitterVelocity(const UnsignedInt id, const Vector3& velocity) {
+    CORRADE_ASSERT(id < _emitters.size(),
+        "Shaders::ParticleSystem::setEmitterVelocity(): index" << id << "out of range for" << _emitters.size() << "emitters", *this);
+    _emitters[id].velocity = velocity;
+    _emittersChanged = true;
+    return *this;
+}
+
+void ParticleSystem::step(const Float timeDelta) {
+    if(_emittersChanged) {
+        Vector3 positions[ParticleSimulation::MaxEmitterCount];
+        Vector3 velocities[ParticleSimulation::MaxEmitterCount];
+        Float spreads[ParticleSimulation::MaxEmitterCount];
+        Float lifetimes[ParticleSimulation::MaxEmitterCount];
+        for(std::size_t i = 0; i != _emitters.size(); ++i) {
+            positions[i] = _emitters[i].position;
+            velocities[i] = _emitters[i].velocity;
+            spreads[i] = _emitters[i].spread;
+            lifetimes[i] = _emitters[i].lifetime;
+        }
+
+        _shader.setEmitterPositions({positions, _emitters.size()})
+            .setEmitterVelocities({velocities, _emitters.size()})
+            .setEmitterSpreads({spreads, _emitters.size()})
+            .setEmitterLifetimes({lifetimes, _emitters.size()});
+        _emittersChanged = false;
+    }
+
+    _shader.setTimeDelta(timeDelta)
+        .setGravity(_gravity)
+        .setSeed(++_seed);
+
+    /* Record the new state into the other buffer, nothing is rasterized */
+    const UnsignedInt next = _current ^ 1;
+    Renderer::enable(Renderer::Feature::RasterizerDiscard);
+    _feedbacks[next].begin(_shader, TransformFeedback::PrimitiveMode::Points);
+    _meshes[_current].draw(_shader);
+    _feedbacks[next].end();
+    Renderer::disable(Renderer::Feature::RasterizerDiscard);
+
+    _current = next;
+    _stepped = true;
+}
+
+void ParticleSystem::draw(AbstractShaderProgram& shader) {
+    /* The vertex count can be taken from the transform feedback only if it
+       recorded anything */
+    #ifndef MAGNUM_TARGET_GLES
+    if(_stepped) _meshes[_current].draw(shader, _feedbacks[_current]);
+    else
+    #endif
+    {
+        _meshes[_current].draw(shader);
+    }
+}
+
+}}
+#endif
@@ -0,0 +1,185 @@
+#ifndef Magnum_Shaders_ParticleSystem_h
+#define Magnum_Shaders_ParticleSystem_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::Shaders::ParticleSystem
+ */
+#endif
+
+#include "Magnum/configure.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include <vector>
+
+#include "Magnum/Buffer.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/TransformFeedback.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Shaders/ParticleSimulation.h"
+
+namespace Magnum { namespace Shaders {
+
+/**
+@brief GPU particle system
+
+Keeps particle state in two buffers and advances it with
+@ref ParticleSimulation, ping-ponging between them through transform
+feedback, so the particle data never leave the GPU. Each emitter owns a fixed
+range of particles that are emitted at a steady rate over the emitter lifetime
+and re-emitted once they expire.
+
+@code
+Shaders::ParticleSystem particles{{
+    {{0.0f, 0.0f, 0.0f}, {0.0f, 5.0f, 0.0f}, 1.0f, 2.5f, 50000},
+    {{4.0f, 0.0f, 0.0f}, {0.0f, 3.0f, 0.0f}, 0.5f, 1.5f, 50000}
+}};
+particles.setGravity({0.0f, -9.81f, 0.0f});
+
+Shaders::Particle shader;
+shader.setTransformationProjectionMatrix(projection*camera)
+    .setColor(Color4{1.0f, 0.5f, 0.1f, 1.0f});
+
+// Each frame
+particles.step(timeline.previousFrameDuration());
+particles.draw(shader);
+@endcode
+
+On desktop GL the rendering uses @ref Mesh::draw(AbstractShaderProgram&, TransformFeedback&, UnsignedInt),
+taking the vertex count directly from the transform feedback object.
+@requires_gl40 Extension @extension{ARB,transform_feedback2}
+@requires_gles30 Transform feedback is not available in OpenGL ES 2.0.
+@requires_webgl20 Transform feedback is not available in WebGL 1.0.
+*/
+class MAGNUM_SHADERS_EXPORT ParticleSystem {
+    public:
+        /** @brief Particle emitter */
+        struct Emitter {
+            Vector3 position;   /**< @brief Emitter position */
+            Vector3 velocity;   /**< @brief Initial particle velocity */
+            Float spread;       /**< @brief Max random velocity deviation */
+            Float lifetime;     /**< @brief Particle lifetime in seconds */
+            UnsignedInt count;  /**< @brief Particle count */
+        };
+
+        /**
+         * @brief Constructor
+         *
+         * Expects at least one and at most
+         * @ref ParticleSimulation::MaxEmitterCount emitters with non-zero
+         * lifetime.
+         */
+        explicit ParticleSystem(std::vector<Emitter> emitters);
+
+        /** @brief Emitters */
+        const std::vector<Emitter>& emitters() const { return _emitters; }
+
+        /**
+         * @brief Set emitter position
+         * @return Reference to self (for method chaining)
+         *
+         * Affects only particles emitted after the next @ref step().
+         */
+        ParticleSystem& setEmitterPosition(UnsignedInt id, const Vector3& position);
+
+        /**
+         * @brief Set emitter velocity
+         * @return Reference to self (for method chaining)
+         *
+         * Affects only particles emitted after the next @ref step().
+         */
+        ParticleSystem& setEmitterVelocity(UnsignedInt id, const Vector3& velocity);
+
+        /** @brief Gravity */
+        Vector3 gravity() const { return _gravity; }
+
+        /**
+         * @brief Set gravity
+         * @return Reference to self (for method chaining)
+         *
+         * Default is zero vector.
+         */
+        ParticleSystem& setGravity(const Vector3& gravity) {
+            _gravity = gravity;
+            return *this;
+        }
+
+        /** @brief Total particle count */
+        UnsignedInt count() const { return _count; }
+
+        /**
+         * @brief Advance the simulation
+         *
+         * Runs @ref ParticleSimulation on the current buffer with rasterizer
+         * discard enabled, recording the output into the other buffer, which
+         * then becomes current.
+         */
+        void step(Float timeDelta);
+
+        /**
+         * @brief Draw the particles
+         *
+         * Draws the current buffer as points using given shader. The shader
+         * is expected to use @ref ParticleSimulation::Position and
+         * optionally @ref ParticleSimulation::Life attributes, such as
+         * @ref Particle.
+         */
+        void draw(AbstractShaderProgram& shader);
+
+        /**
+         * @brief Mesh with the current particle state
+         *
+         * For custom rendering.
+         */
+        Mesh& mesh() { return _meshes[_current]; }
+
+        /**
+         * @brief Buffer with the current particle state
+         *
+         * Contains @ref ParticleSimulation::Position,
+         * @ref ParticleSimulation::Velocity and @ref ParticleSimulation::Life
+         * interleaved for each particle, in order of emitters.
+         */
+        Buffer& buffer() { return _buffers[_current]; }
+
+    private:
+        std::vector<Emitter> _emitters;
+        Vector3 _gravity;
+        UnsignedInt _count{}, _seed{}, _current{};
+        bool _stepped{}, _emittersChanged{true};
+        ParticleSimulation _shader;
+        Buffer _buffers[2];
+        Mesh _meshes[2];
+        TransformFeedback _feedbacks[2];
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
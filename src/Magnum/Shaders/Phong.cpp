@@ -25,12 +25,23 @@
 
 #include "Phong.h"
 
+#include <cmath>
+#include <string>
 #include <Corrade/Utility/Resource.h>
 
+#include "Magnum/Buffer.h"
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
 #include "Magnum/Shader.h"
 #include "Magnum/Texture.h"
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/TextureArray.h"
+#include "Magnum/Shaders/ShadowMap.h"
+#endif
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include "Magnum/BufferTexture.h"
+#include "Magnum/Shaders/LightClusters.h"
+#endif
 
 #include "Implementation/CreateCompatibilityShader.h"
 
@@ -40,7 +51,20 @@ namespace {
     enum: Int {
         AmbientTextureLayer = 0,
         DiffuseTextureLayer = 1,
-        SpecularTextureLayer = 2
+        SpecularTextureLayer = 2,
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        ClusterLightTextureLayer = 3,
+        ClusterTextureLayer = 4,
+        ClusterLightIndexTextureLayer = 5,
+        #endif
+        #ifndef MAGNUM_TARGET_GLES2
+        ShadowMapTextureLayer = 6,
+        #endif
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        PositionBufferTextureLayer = 7,
+        NormalBufferTextureLayer = 8,
+        TextureCoordinatesBufferTextureLayer = 9
+        #endif
     };
 }
 
@@ -54,14 +78,73 @@ Phong::Phong(const Flags flags): transformationMatrixUniform(0), projectionMatri
 
     #ifndef MAGNUM_TARGET_GLES
     const Version version = Context::current().supportedVersion({Version::GL320, Version::GL310, Version::GL300, Version::GL210});
+    #elif !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    /* Buffer textures need at least ES 3.1 */
+    const Version version = flags & (Flag::ClusteredLights|Flag::VertexPulling) ?
+        Context::current().supportedVersion({Version::GLES310, Version::GLES300}) :
+        Context::current().supportedVersion({Version::GLES300, Version::GLES200});
     #else
     const Version version = Context::current().supportedVersion({Version::GLES300, Version::GLES200});
     #endif
 
+    #ifndef MAGNUM_TARGET_GLES2
+    if(flags & (Flag::UniformBuffers|Flag::Skinning)) {
+        #ifndef MAGNUM_TARGET_GLES
+        MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GL310);
+        #else
+        MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GLES300);
+        #endif
+    }
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES2
+    if(flags & (Flag::GBuffer|Flag::ShadowMap)) {
+        #ifndef MAGNUM_TARGET_GLES
+        MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GL300);
+        #else
+        MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GLES300);
+        #endif
+    }
+    #endif
+
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(flags & (Flag::ClusteredLights|Flag::VertexPulling)) {
+        #ifndef MAGNUM_TARGET_GLES
+        MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GL310);
+        #else
+        MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::EXT::texture_buffer);
+        #endif
+    }
+    #endif
+
+    const bool textured = !!(flags & (Flag::AmbientTexture|Flag::DiffuseTexture|Flag::SpecularTexture));
+
     Shader vert = Implementation::createCompatibilityShader(rs, version, Shader::Type::Vertex);
     Shader frag = Implementation::createCompatibilityShader(rs, version, Shader::Type::Fragment);
 
-    vert.addSource(flags ? "#define TEXTURED\n" : "")
+    #ifndef MAGNUM_TARGET_GLES2
+    if(flags & Flag::UniformBuffers) {
+        vert.addSource("#define UNIFORM_BUFFERS\n");
+        frag.addSource("#define UNIFORM_BUFFERS\n");
+    }
+    #endif
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    if(flags & Flag::ClusteredLights)
+        frag.addSource("#define CLUSTERED_LIGHTS\n");
+    if(flags & Flag::VertexPulling)
+        vert.addSource("#define VERTEX_PULLING\n");
+    #endif
+    #ifndef MAGNUM_TARGET_GLES2
+    if(flags & Flag::GBuffer)
+        frag.addSource("#define GBUFFER\n");
+    if(flags & Flag::ShadowMap)
+        frag.addSource("#define SHADOW_MAP\n");
+    if(flags & Flag::Skinning)
+        vert.addSource("#define SKINNING\n"
+                       "#define MAX_JOINT_COUNT " + std::to_string(MaxJointCount) + "\n");
+    #endif
+    vert.addSource(textured ? "#define TEXTURED\n" : "")
+        .addSource(flags & Flag::OctahedralNormals ? "#define OCTAHEDRAL_NORMALS\n" : "")
         .addSource(rs.get("generic.glsl"))
         .addSource(rs.get("Phong.vert"));
     frag.addSource(flags & Flag::AmbientTexture ? "#define AMBIENT_TEXTURE\n" : "")
@@ -79,13 +162,53 @@ Phong::Phong(const Flags flags): transformationMatrixUniform(0), projectionMatri
     if(!Context::current().isVersionSupported(Version::GLES300))
     #endif
     {
-        bindAttributeLocation(Position::Location, "position");
-        bindAttributeLocation(Normal::Location, "normal");
-        if(flags) bindAttributeLocation(TextureCoordinates::Location, "textureCoordinates");
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        if(!(flags & Flag::VertexPulling))
+        #endif
+        {
+            bindAttributeLocation(Position::Location, "position");
+            bindAttributeLocation(Normal::Location, "normal");
+            if(textured) bindAttributeLocation(TextureCoordinates::Location, "textureCoordinates");
+        }
+        #ifndef MAGNUM_TARGET_GLES2
+        if(flags & Flag::Skinning) {
+            bindAttributeLocation(JointIds::Location, "jointIds");
+            bindAttributeLocation(Weights::Location, "weights");
+        }
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        if(flags & Flag::GBuffer) {
+            bindFragmentDataLocation(GBufferAlbedoOutput, "gbufferAlbedo");
+            bindFragmentDataLocation(GBufferNormalOutput, "gbufferNormal");
+        }
+        #endif
     }
 
     CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+    /* Query all active uniforms at once, the uniformLocation() and
+       uniformBlockIndex() calls below are then just table lookups */
+    reflectUniforms();
 
+    #ifndef MAGNUM_TARGET_GLES2
+    #ifndef MAGNUM_TARGET_GLES
+    if(flags & Flag::Skinning && !Context::current().isExtensionSupported<Extensions::GL::ARB::shading_language_420pack>(version))
+    #else
+    if(flags & Flag::Skinning)
+    #endif
+    {
+        setUniformBlockBinding(uniformBlockIndex("PhongJoints"), JointUniformBinding);
+    }
+
+    if(flags & Flag::UniformBuffers) {
+        #ifndef MAGNUM_TARGET_GLES
+        if(!Context::current().isExtensionSupported<Extensions::GL::ARB::shading_language_420pack>(version))
+        #endif
+        {
+            setUniformBlockBinding(uniformBlockIndex("PhongTransformation"), TransformationUniformBinding);
+            setUniformBlockBinding(uniformBlockIndex("PhongMaterial"), MaterialUniformBinding);
+        }
+    } else
+    #endif
     #ifndef MAGNUM_TARGET_GLES
     if(!Context::current().isExtensionSupported<Extensions::GL::ARB::explicit_uniform_location>(version))
     #endif
@@ -101,17 +224,63 @@ Phong::Phong(const Flags flags): transformationMatrixUniform(0), projectionMatri
         shininessUniform = uniformLocation("shininess");
     }
 
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    /* Not part of the uniform blocks, so queried in both cases */
+    #ifndef MAGNUM_TARGET_GLES
+    if(flags & Flag::ClusteredLights && !Context::current().isExtensionSupported<Extensions::GL::ARB::explicit_uniform_location>(version))
+    #else
+    if(flags & Flag::ClusteredLights)
+    #endif
+    {
+        clusterScaleUniform = uniformLocation("clusterScale");
+        clusterGridSizeUniform = uniformLocation("clusterGridSize");
+        clusterDepthUniform = uniformLocation("clusterDepth");
+    }
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES2
     #ifndef MAGNUM_TARGET_GLES
-    if(flags && !Context::current().isExtensionSupported<Extensions::GL::ARB::shading_language_420pack>(version))
+    if(flags & Flag::ShadowMap && !Context::current().isExtensionSupported<Extensions::GL::ARB::explicit_uniform_location>(version))
+    #else
+    if(flags & Flag::ShadowMap)
+    #endif
+    {
+        shadowMatricesUniform = uniformLocation("shadowMatrices");
+        shadowSplitsUniform = uniformLocation("shadowSplits");
+    }
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::shading_language_420pack>(version))
     #endif
     {
         if(flags & Flag::AmbientTexture) setUniform(uniformLocation("ambientTexture"), AmbientTextureLayer);
         if(flags & Flag::DiffuseTexture) setUniform(uniformLocation("diffuseTexture"), DiffuseTextureLayer);
         if(flags & Flag::SpecularTexture) setUniform(uniformLocation("specularTexture"), SpecularTextureLayer);
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        if(flags & Flag::ClusteredLights) {
+            setUniform(uniformLocation("clusterLights"), ClusterLightTextureLayer);
+            setUniform(uniformLocation("clusters"), ClusterTextureLayer);
+            setUniform(uniformLocation("clusterLightIndices"), ClusterLightIndexTextureLayer);
+        }
+        if(flags & Flag::VertexPulling) {
+            setUniform(uniformLocation("positionBuffer"), PositionBufferTextureLayer);
+            setUniform(uniformLocation("normalBuffer"), NormalBufferTextureLayer);
+            if(textured) setUniform(uniformLocation("textureCoordinatesBuffer"), TextureCoordinatesBufferTextureLayer);
+        }
+        #endif
+        #ifndef MAGNUM_TARGET_GLES2
+        if(flags & Flag::ShadowMap) setUniform(uniformLocation("shadowMapTexture"), ShadowMapTextureLayer);
+        #endif
     }
 
     /* Set defaults in OpenGL ES (for desktop they are set in shader code itself) */
     #ifdef MAGNUM_TARGET_GLES
+    #ifndef MAGNUM_TARGET_GLES2
+    /* Uniform blocks have no defaults */
+    if(flags & Flag::UniformBuffers) return;
+    #endif
+
     /* Default to fully opaque white so we can see the textures */
     if(flags & Flag::AmbientTexture) setAmbientColor(Color4{1.0f});
     else setAmbientColor(Color4{0.0f, 1.0f});
@@ -139,6 +308,47 @@ Phong& Phong::setSpecularTexture(Texture2D& texture) {
     return *this;
 }
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+Phong& Phong::setLightClusters(LightClusters& clusters) {
+    if(!(_flags & Flag::ClusteredLights)) return *this;
+
+    AbstractTexture::bind(ClusterLightTextureLayer, {&clusters.lightTexture(), &clusters.clusterTexture(), &clusters.lightIndexTexture()});
+    setUniform(clusterScaleUniform, Vector2{clusters.gridSize().xy()}/Vector2{clusters.viewportSize()});
+    setUniform(clusterGridSizeUniform, clusters.gridSize());
+    setUniform(clusterDepthUniform, Vector2{clusters.near(), clusters.gridSize().z()/std::log(clusters.far()/clusters.near())});
+    return *this;
+}
+
+Phong& Phong::setVertexBuffers(BufferTexture& positions, BufferTexture& normals, BufferTexture* const textureCoordinates) {
+    if(_flags & Flag::VertexPulling)
+        AbstractTexture::bind(PositionBufferTextureLayer, {&positions, &normals, textureCoordinates});
+    return *this;
+}
+#endif
+
+#ifndef MAGNUM_TARGET_GLES2
+Phong& Phong::setShadowMap(ShadowMap& shadowMap) {
+    if(!(_flags & Flag::ShadowMap)) return *this;
+
+    shadowMap.texture().bind(ShadowMapTextureLayer);
+    const Containers::ArrayView<const Matrix4> matrices = shadowMap.shadowMatrices();
+    setUniform(shadowMatricesUniform, Containers::ArrayView<const Math::RectangularMatrix<4, 4, Float>>{matrices.data(), matrices.size()});
+
+    /* Unused cascades have zero distance so they're never picked */
+    Vector4 splits;
+    for(UnsignedInt i = 0; i != shadowMap.cascadeCount(); ++i)
+        splits[i] = shadowMap.splitDistance(i);
+    setUniform(shadowSplitsUniform, splits);
+    return *this;
+}
+
+Phong& Phong::setJointMatrices(Buffer& buffer, const GLintptr offset) {
+    if(_flags & Flag::Skinning)
+        buffer.bind(Buffer::Target::Uniform, JointUniformBinding, offset, MaxJointCount*sizeof(Matrix4));
+    return *this;
+}
+#endif
+
 Phong& Phong::setTextures(Texture2D* ambient, Texture2D* diffuse, Texture2D* specular) {
     AbstractTexture::bind(AmbientTextureLayer, {ambient, diffuse, specular});
     return *this;
@@ -33,6 +33,45 @@
 #define const
 #endif
 
+#if defined(CLUSTERED_LIGHTS) && defined(GL_ES) && __VERSION__ < 320
+#extension GL_EXT_texture_buffer: require
+#endif
+
+#ifdef AMBIENT_TEXTURE
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 0)
+#endif
+uniform lowp sampler2D ambientTexture;
+#endif
+
+#ifdef DIFFUSE_TEXTURE
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 1)
+#endif
+uniform lowp sampler2D diffuseTexture;
+#endif
+
+#ifdef SPECULAR_TEXTURE
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 2)
+#endif
+uniform lowp sampler2D specularTexture;
+#endif
+
+#ifdef UNIFORM_BUFFERS
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(std140, binding = 1)
+#else
+layout(std140)
+#endif
+uniform PhongMaterial {
+    lowp vec4 ambientColor;
+    lowp vec4 diffuseColor;
+    lowp vec4 specularColor;
+    lowp vec4 lightColor;
+    mediump float shininess;
+};
+#else
 #ifdef EXPLICIT_UNIFORM_LOCATION
 layout(location = 7)
 #endif
@@ -51,13 +90,6 @@ uniform mediump float shininess
     #endif
     ;
 
-#ifdef AMBIENT_TEXTURE
-#ifdef EXPLICIT_TEXTURE_LAYER
-layout(binding = 0)
-#endif
-uniform lowp sampler2D ambientTexture;
-#endif
-
 #ifdef EXPLICIT_UNIFORM_LOCATION
 layout(location = 5)
 #endif
@@ -71,13 +103,6 @@ uniform lowp vec4 ambientColor
     #endif
     ;
 
-#ifdef DIFFUSE_TEXTURE
-#ifdef EXPLICIT_TEXTURE_LAYER
-layout(binding = 1)
-#endif
-uniform lowp sampler2D diffuseTexture;
-#endif
-
 #ifdef EXPLICIT_UNIFORM_LOCATION
 layout(location = 4)
 #endif
@@ -87,13 +112,6 @@ uniform lowp vec4 diffuseColor
     #endif
     ;
 
-#ifdef SPECULAR_TEXTURE
-#ifdef EXPLICIT_TEXTURE_LAYER
-layout(binding = 2)
-#endif
-uniform lowp sampler2D specularTexture;
-#endif
-
 #ifdef EXPLICIT_UNIFORM_LOCATION
 layout(location = 6)
 #endif
@@ -102,6 +120,59 @@ uniform lowp vec4 specularColor
     = vec4(1.0)
     #endif
     ;
+#endif
+
+#ifdef CLUSTERED_LIGHTS
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 3)
+#endif
+uniform highp samplerBuffer clusterLights;
+
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 4)
+#endif
+uniform highp usamplerBuffer clusters;
+
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 5)
+#endif
+uniform highp usamplerBuffer clusterLightIndices;
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 9)
+#endif
+uniform highp vec2 clusterScale;
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 10)
+#endif
+uniform highp ivec3 clusterGridSize;
+
+/* Near plane and depth slice scale */
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 11)
+#endif
+uniform highp vec2 clusterDepth;
+#endif
+
+#ifdef SHADOW_MAP
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 6)
+#endif
+uniform highp sampler2DArrayShadow shadowMapTexture;
+
+/* Camera space to shadow map space for each cascade */
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 12)
+#endif
+uniform highp mat4 shadowMatrices[4];
+
+/* Far distance of each cascade, zero for unused */
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 16)
+#endif
+uniform highp vec4 shadowSplits;
+#endif
 
 in mediump vec3 transformedNormal;
 in highp vec3 lightDirection;
@@ -111,10 +182,43 @@ in highp vec3 cameraDirection;
 in mediump vec2 interpolatedTextureCoords;
 #endif
 
-#ifdef NEW_GLSL
+#ifdef GBUFFER
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = 0)
+#endif
+out lowp vec4 gbufferAlbedo;
+
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = 1)
+#endif
+out mediump vec4 gbufferNormal;
+#elif defined(NEW_GLSL)
 out lowp vec4 color;
 #endif
 
+#ifdef SHADOW_MAP
+lowp float shadowVisibility(highp vec3 position) {
+    for(int i = 0; i < 4; ++i) {
+        if(-position.z >= shadowSplits[i]) continue;
+
+        highp vec4 shadowCoords = shadowMatrices[i]*vec4(position, 1.0);
+        shadowCoords.xyz /= shadowCoords.w;
+
+        /* 3x3 percentage-closer filtering, each tap is additionally
+           bilinearly filtered by the hardware comparison */
+        highp vec2 texelSize = 1.0/vec2(textureSize(shadowMapTexture, 0).xy);
+        lowp float visibility = 0.0;
+        for(int x = -1; x <= 1; ++x)
+            for(int y = -1; y <= 1; ++y)
+                visibility += texture(shadowMapTexture, vec4(shadowCoords.xy + vec2(float(x), float(y))*texelSize, float(i), shadowCoords.z));
+        return visibility/9.0;
+    }
+
+    /* Beyond the last cascade */
+    return 1.0;
+}
+#endif
+
 void main() {
     lowp const vec4 finalAmbientColor =
         #ifdef AMBIENT_TEXTURE
@@ -132,20 +236,79 @@ void main() {
         #endif
         specularColor;
 
+    #ifdef GBUFFER
+    /* Diffuse color and specular intensity */
+    gbufferAlbedo = vec4(finalDiffuseColor.rgb, dot(finalSpecularColor.rgb, vec3(1.0/3.0)));
+
+    /* Octahedral-encoded normal, the lower hemisphere is folded over the
+       diagonals, and shininess */
+    mediump vec3 octahedralNormal = normalize(transformedNormal);
+    octahedralNormal /= abs(octahedralNormal.x) + abs(octahedralNormal.y) + abs(octahedralNormal.z);
+    if(octahedralNormal.z < 0.0)
+        octahedralNormal.xy = (1.0 - abs(octahedralNormal.yx))*vec2(
+            octahedralNormal.x >= 0.0 ? 1.0 : -1.0,
+            octahedralNormal.y >= 0.0 ? 1.0 : -1.0);
+    gbufferNormal = vec4(octahedralNormal.xy*0.5 + vec2(0.5), clamp(shininess/256.0, 0.0, 1.0), 1.0);
+    #else
     /* Ambient color */
     color = finalAmbientColor;
 
     mediump vec3 normalizedTransformedNormal = normalize(transformedNormal);
     highp vec3 normalizedLightDirection = normalize(lightDirection);
 
+    #ifdef SHADOW_MAP
+    /* Shadow of the light */
+    lowp float visibility = shadowVisibility(-cameraDirection);
+    #endif
+
     /* Add diffuse color */
     lowp float intensity = max(0.0, dot(normalizedTransformedNormal, normalizedLightDirection));
+    #ifdef SHADOW_MAP
+    intensity *= visibility;
+    #endif
     color += finalDiffuseColor*lightColor*intensity;
 
     /* Add specular color, if needed */
     if(intensity > 0.001) {
         highp vec3 reflection = reflect(-normalizedLightDirection, normalizedTransformedNormal);
         mediump float specularity = pow(max(0.0, dot(normalize(cameraDirection), reflection)), shininess);
+        #ifdef SHADOW_MAP
+        specularity *= visibility;
+        #endif
         color += finalSpecularColor*specularity;
     }
+
+    #ifdef CLUSTERED_LIGHTS
+    /* Find the cell, the depth slices are distributed exponentially */
+    highp vec3 position = -cameraDirection;
+    highp ivec2 tile = clamp(ivec2(gl_FragCoord.xy*clusterScale), ivec2(0), clusterGridSize.xy - ivec2(1));
+    highp int slice = clamp(int(log(-position.z/clusterDepth.x)*clusterDepth.y), 0, clusterGridSize.z - 1);
+    highp uvec2 cluster = texelFetch(clusters, tile.x + clusterGridSize.x*(tile.y + clusterGridSize.y*slice)).xy;
+
+    mediump vec3 normalizedCameraDirection = normalize(cameraDirection);
+    for(highp uint i = 0u; i < cluster.y; ++i) {
+        highp int index = int(texelFetch(clusterLightIndices, int(cluster.x + i)).x);
+        highp vec4 clusterLightPosition = texelFetch(clusterLights, 2*index);
+        lowp vec3 clusterLightColor = texelFetch(clusterLights, 2*index + 1).rgb;
+
+        highp vec3 clusterLightDirection = clusterLightPosition.xyz - position;
+        highp float lightDistance = length(clusterLightDirection);
+        if(lightDistance >= clusterLightPosition.w) continue;
+        clusterLightDirection /= lightDistance;
+
+        /* Smooth falloff reaching zero at the light range */
+        highp float falloff = 1.0 - lightDistance*lightDistance/(clusterLightPosition.w*clusterLightPosition.w);
+        falloff *= falloff;
+
+        lowp float clusterIntensity = max(0.0, dot(normalizedTransformedNormal, clusterLightDirection));
+        color.rgb += finalDiffuseColor.rgb*clusterLightColor*clusterIntensity*falloff;
+
+        if(clusterIntensity > 0.001) {
+            highp vec3 reflection = reflect(-clusterLightDirection, normalizedTransformedNormal);
+            mediump float specularity = pow(max(0.0, dot(normalizedCameraDirection, reflection)), shininess);
+            color.rgb += finalSpecularColor.rgb*clusterLightColor*specularity*falloff;
+        }
+    }
+    #endif
+    #endif
 }
@@ -31,7 +31,11 @@
 
 #include "Magnum/Math/Color.h"
 #include "Magnum/Math/Matrix4.h"
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/UniformBlock.h"
+#endif
 #include "Magnum/Shaders/Generic.h"
+#include "Magnum/Shaders/Shaders.h"
 #include "Magnum/Shaders/visibility.h"
 
 namespace Magnum { namespace Shaders {
@@ -144,6 +148,134 @@ shader.setTextures(&diffuseAlphaTexture, &diffuseAlphaTexture, nullptr)
     .setSpecularColor(Color4{specularRgb, 0.0f});
 @endcode
 
+@anchor Shaders-Phong-uniform-buffers
+### Uniform buffers
+
+With @ref Flag::UniformBuffers the shader takes the transformation and
+material parameters from uniform blocks instead of separate uniforms, so
+drawing many objects needs only two buffer range binds per object instead of
+nine uniform uploads. The individual uniform setters can't be used in that
+case.
+@code
+UniformBlockBuffer<Shaders::Phong::TransformationUniformBlock> transformations{objects.size()};
+UniformBlockBuffer<Shaders::Phong::MaterialUniformBlock> materials{objects.size()};
+for(std::size_t i = 0; i != objects.size(); ++i) {
+    transformations.set<0>(i, objects[i].transformationMatrix)
+        .set<1>(i, projectionMatrix)
+        .set<2>(i, objects[i].transformationMatrix.rotation())
+        .set<3>(i, lightPosition);
+    materials.set<1>(i, objects[i].diffuseColor)
+        .set<2>(i, Color4{1.0f})
+        .set<3>(i, Color4{1.0f})
+        .set<4>(i, 80.0f);
+}
+transformations.upload();
+materials.upload();
+
+Shaders::Phong shader{Shaders::Phong::Flag::UniformBuffers};
+for(std::size_t i = 0; i != objects.size(); ++i) {
+    transformations.bind(Shaders::Phong::TransformationUniformBinding, i);
+    materials.bind(Shaders::Phong::MaterialUniformBinding, i);
+    objects[i].mesh.draw(shader);
+}
+@endcode
+
+@anchor Shaders-Phong-clustered-lights
+### Clustered lights
+
+With @ref Flag::ClusteredLights the shader additionally evaluates an arbitrary
+count of point lights binned in @ref LightClusters. Every fragment looks up its
+cell in the light grid and loops only over the lights affecting it, so
+hundreds of lights can be rendered in a single pass. The light set with
+@ref setLightPosition() and @ref setLightColor() is still used, set its color
+to zero if it's not desired. See @ref LightClusters for an example.
+
+@anchor Shaders-Phong-gbuffer
+### G-buffer output
+
+With @ref Flag::GBuffer the shader doesn't evaluate any lighting and instead
+writes diffuse color with specular intensity to @ref GBufferAlbedoOutput and
+octahedral-encoded camera-space normal with shininess to
+@ref GBufferNormalOutput, in the layout described in @ref GBuffer. Ambient
+color, light position and light color are not used in this case, the lighting
+is then done by @ref DeferredLighting. See @ref DeferredRenderer for an
+example.
+
+@anchor Shaders-Phong-shadows
+### Shadows
+
+With @ref Flag::ShadowMap the diffuse and specular contribution of the light
+is attenuated by a cascaded @ref ShadowMap. The cascade is picked based on
+fragment depth and the shadow is smoothed using 3x3 percentage-closer
+filtering on top of the hardware depth comparison. The shadow map is expected
+to be updated for the same camera as is used for rendering, the shadow
+direction is taken from @ref ShadowMap::setLightDirection() and is independent
+of @ref setLightPosition(), place the light far in the opposite direction to
+make the lighting consistent. See @ref ShadowMap for an example.
+
+@anchor Shaders-Phong-skinning
+### Skinning
+
+With @ref Flag::Skinning the vertex position and normal are transformed by a
+weighted sum of up to four joint matrices referenced by the @ref JointIds and
+@ref Weights attributes before applying the transformation matrix. The joint
+matrices are taken from a uniform buffer containing @ref MaxJointCount
+tightly packed @ref Matrix4 instances, usually calculated by
+@ref MeshTools::jointMatrices(). Palettes of many characters can be stored in
+a single buffer and bound per draw, the offsets are expected to respect
+@ref Buffer::uniformOffsetAlignment().
+@code
+std::vector<Matrix4> palettes(characters.size()*Shaders::Phong::MaxJointCount);
+for(std::size_t i = 0; i != characters.size(); ++i) {
+    std::vector<Matrix4> joints = MeshTools::jointMatrices(skin.parents, skin.inverseBindMatrices, characters[i].pose());
+    std::copy(joints.begin(), joints.end(), palettes.begin() + i*Shaders::Phong::MaxJointCount);
+}
+Buffer jointBuffer{Buffer::TargetHint::Uniform};
+jointBuffer.setData(palettes, BufferUsage::StreamDraw);
+
+Shaders::Phong shader{Shaders::Phong::Flag::Skinning};
+for(std::size_t i = 0; i != characters.size(); ++i) {
+    shader.setJointMatrices(jointBuffer, i*Shaders::Phong::MaxJointCount*sizeof(Matrix4))
+        .setTransformationMatrix(characters[i].transformationMatrix);
+    // ...
+    mesh.draw(shader);
+}
+@endcode
+
+@anchor Shaders-Phong-vertex-pulling
+### Vertex pulling
+
+With @ref Flag::VertexPulling the position, normal and texture coordinates
+are not taken from vertex attributes but fetched from buffer textures set via
+@ref setVertexBuffers(), indexed with @glsl gl_VertexID @ce. The mesh then
+needs no attribute setup at all, only vertex count and optionally an index
+buffer, so meshes stored in the same buffers can be drawn through multiple
+@ref MeshView instances of a single @ref Mesh with different base vertex
+without any vertex array switches. Each attribute is expected in its own
+tightly packed buffer, one texel per vertex. The components are converted
+by the buffer texture format, so for example positions can be stored as
+@ref BufferTextureFormat::RGBA16F or texture coordinates as normalized
+@ref BufferTextureFormat::RG16 to save memory. The remaining attributes such
+as @ref JointIds and @ref Weights are still taken from the mesh.
+@code
+BufferTexture positions, normals;
+positions.setBuffer(BufferTextureFormat::RGB32F, positionBuffer);
+normals.setBuffer(BufferTextureFormat::RGBA16F, normalBuffer);
+
+Mesh mesh;
+mesh.setIndexBuffer(indexBuffer, 0, Mesh::IndexType::UnsignedShort);
+
+Shaders::Phong shader{Shaders::Phong::Flag::VertexPulling};
+shader.setVertexBuffers(positions, normals);
+for(const MeshRange& range: ranges) {
+    MeshView view{mesh};
+    view.setCount(range.indexCount)
+        .setIndexRange(range.indexOffset)
+        .setBaseVertex(range.vertexOffset);
+    view.draw(shader);
+}
+@endcode
+
 @see @ref shaders
 */
 class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
@@ -162,6 +294,16 @@ class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
          */
         typedef Generic3D::Normal Normal;
 
+        /**
+         * @brief Octahedral-encoded normal direction
+         *
+         * @ref Vector2 in the same location as @ref Normal, used instead of it
+         * if @ref Flag::OctahedralNormals is set. Usually supplied as two
+         * normalized 16-bit components, see
+         * @ref MeshTools::quantizeNormalsOctahedral().
+         */
+        typedef Attribute<Generic3D::Normal::Location, Vector2> OctahedralNormal;
+
         /**
          * @brief 2D texture coordinates
          *
@@ -171,15 +313,122 @@ class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
          */
         typedef Generic3D::TextureCoordinates TextureCoordinates;
 
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Joint IDs
+         *
+         * @ref shaders-generic "Generic attribute", @ref Vector4ui, used only
+         * if @ref Flag::Skinning is set.
+         * @requires_gl30 Extension @extension{EXT,gpu_shader4}
+         * @requires_gles30 Integer attributes are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Integer attributes are not available in WebGL
+         *      1.0.
+         */
+        typedef Generic3D::JointIds JointIds;
+
+        /**
+         * @brief Joint weights
+         *
+         * @ref shaders-generic "Generic attribute", @ref Vector4, used only
+         * if @ref Flag::Skinning is set.
+         */
+        typedef Generic3D::Weights Weights;
+        #endif
+
         /**
          * @brief Flag
          *
          * @see @ref Flags, @ref flags()
          */
-        enum class Flag: UnsignedByte {
+        enum class Flag: UnsignedShort {
             AmbientTexture = 1 << 0,    /**< The shader uses ambient texture instead of color */
             DiffuseTexture = 1 << 1,    /**< The shader uses diffuse texture instead of color */
-            SpecularTexture = 1 << 2    /**< The shader uses specular texture instead of color */
+            SpecularTexture = 1 << 2,   /**< The shader uses specular texture instead of color */
+
+            #ifndef MAGNUM_TARGET_GLES2
+            /**
+             * The shader takes the parameters from
+             * @ref TransformationUniformBlock and @ref MaterialUniformBlock
+             * instead of separate uniforms.
+             * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+             * @requires_gles30 Uniform buffers are not available in OpenGL
+             *      ES 2.0.
+             * @requires_webgl20 Uniform buffers are not available in WebGL
+             *      1.0.
+             */
+            UniformBuffers = 1 << 3,
+            #endif
+
+            /**
+             * The shader takes the normal from @ref OctahedralNormal instead of
+             * @ref Normal and decodes it.
+             */
+            OctahedralNormals = 1 << 4,
+
+            #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+            /**
+             * The shader additionally evaluates point lights from
+             * @ref LightClusters set via @ref setLightClusters().
+             * @requires_gl31 Extension @extension{ARB,texture_buffer_object}
+             * @requires_gles31 Extension @es_extension{EXT,texture_buffer}
+             * @requires_gles Buffer textures are not available in WebGL.
+             */
+            ClusteredLights = 1 << 5,
+            #endif
+
+            #ifndef MAGNUM_TARGET_GLES2
+            /**
+             * Instead of evaluating the lighting, the shader writes the
+             * material and normal into a @ref GBuffer for deferred shading.
+             * See @ref Shaders-Phong-gbuffer "G-buffer output" for details.
+             * @requires_gl30 Extension @extension{EXT,gpu_shader4}
+             * @requires_gles30 Multiple render targets are not available in
+             *      OpenGL ES 2.0.
+             * @requires_webgl20 Multiple render targets are not available
+             *      in WebGL 1.0.
+             */
+            GBuffer = 1 << 6,
+
+            /**
+             * The light casts shadows from a @ref ShadowMap set via
+             * @ref setShadowMap(). See
+             * @ref Shaders-Phong-shadows "Shadows" for details.
+             * @requires_gl30 Extension @extension{EXT,texture_array}
+             * @requires_gles30 Texture arrays are not available in OpenGL
+             *      ES 2.0.
+             * @requires_webgl20 Texture arrays are not available in WebGL
+             *      1.0.
+             */
+            ShadowMap = 1 << 7,
+
+            /**
+             * The vertices are skinned using the @ref JointIds and
+             * @ref Weights attributes and joint matrices set via
+             * @ref setJointMatrices(). See
+             * @ref Shaders-Phong-skinning "Skinning" for details.
+             * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+             * @requires_gles30 Uniform buffers are not available in OpenGL
+             *      ES 2.0.
+             * @requires_webgl20 Uniform buffers are not available in WebGL
+             *      1.0.
+             */
+            Skinning = 1 << 8,
+            #endif
+
+            #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+            /**
+             * The position, normal and texture coordinates are fetched from
+             * buffer textures set via @ref setVertexBuffers() instead of
+             * vertex attributes. See
+             * @ref Shaders-Phong-vertex-pulling "Vertex pulling" for
+             * details.
+             * @requires_gl31 Extension @extension{ARB,texture_buffer_object}
+             * @requires_gles31 Extension @es_extension{EXT,texture_buffer}
+             * @requires_gles Buffer textures are not available in WebGL.
+             */
+            VertexPulling = 1 << 9
+            #endif
         };
 
         /**
@@ -189,6 +438,82 @@ class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
          */
         typedef Containers::EnumSet<Flag> Flags;
 
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Transformation uniform block
+         *
+         * Transformation matrix, projection matrix, normal matrix and light
+         * position, used if @ref Flag::UniformBuffers is set. See
+         * @ref setTransformationMatrix(), @ref setProjectionMatrix(),
+         * @ref setNormalMatrix() and @ref setLightPosition() for details.
+         * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Uniform buffers are not available in WebGL 1.0.
+         */
+        typedef UniformBlock<Matrix4, Matrix4, Matrix3x3, Vector3> TransformationUniformBlock;
+
+        /**
+         * @brief Material uniform block
+         *
+         * Ambient color, diffuse color, specular color, light color and
+         * shininess, used if @ref Flag::UniformBuffers is set. See
+         * @ref setAmbientColor(), @ref setDiffuseColor(),
+         * @ref setSpecularColor(), @ref setLightColor() and
+         * @ref setShininess() for details. Unlike with separate uniforms, the
+         * members don't have any default values.
+         * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Uniform buffers are not available in WebGL 1.0.
+         */
+        typedef UniformBlock<Color4, Color4, Color4, Color4, Float> MaterialUniformBlock;
+
+        enum: UnsignedInt {
+            /**
+             * Uniform buffer binding for @ref TransformationUniformBlock
+             * @see @ref UniformBlockBuffer::bind()
+             */
+            TransformationUniformBinding = 0,
+
+            /**
+             * Uniform buffer binding for @ref MaterialUniformBlock
+             * @see @ref UniformBlockBuffer::bind()
+             */
+            MaterialUniformBinding = 1,
+
+            /**
+             * Uniform buffer binding for joint matrices if
+             * @ref Flag::Skinning is set
+             * @see @ref setJointMatrices()
+             */
+            JointUniformBinding = 2
+        };
+
+        enum: UnsignedInt {
+            /**
+             * Max count of joints if @ref Flag::Skinning is set. The joint
+             * matrix uniform block occupies 8 kB, which fits into the
+             * minimal guaranteed uniform block size of 16 kB.
+             */
+            MaxJointCount = 128
+        };
+
+        enum: UnsignedInt {
+            /**
+             * Albedo output if @ref Flag::GBuffer is set
+             * @see @ref Framebuffer::mapForDraw()
+             */
+            GBufferAlbedoOutput = 0,
+
+            /**
+             * Normal output if @ref Flag::GBuffer is set
+             * @see @ref Framebuffer::mapForDraw()
+             */
+            GBufferNormalOutput = 1
+        };
+        #endif
+
         /**
          * @brief Constructor
          * @param flags     Flags
@@ -341,6 +666,74 @@ class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
             return *this;
         }
 
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        /**
+         * @brief Set light clusters
+         * @return Reference to self (for method chaining)
+         *
+         * Binds the buffer textures of @p clusters and sets the grid
+         * parameters. Has effect only if @ref Flag::ClusteredLights is set.
+         * The clusters are expected to be binned with projection and
+         * viewport matching the ones used for rendering.
+         * @requires_gl31 Extension @extension{ARB,texture_buffer_object}
+         * @requires_gles31 Extension @es_extension{EXT,texture_buffer}
+         * @requires_gles Buffer textures are not available in WebGL.
+         */
+        Phong& setLightClusters(LightClusters& clusters);
+
+        /**
+         * @brief Set vertex buffers
+         * @return Reference to self (for method chaining)
+         *
+         * Binds buffer textures containing one position, normal and
+         * texture coordinates texel per vertex. Only the first three
+         * components of position and normal texels are used, or the first
+         * two if @ref Flag::OctahedralNormals is set. The texture
+         * coordinates are used only if @ref Flag::AmbientTexture,
+         * @ref Flag::DiffuseTexture or @ref Flag::SpecularTexture is set.
+         * Has effect only if @ref Flag::VertexPulling is set.
+         * @requires_gl31 Extension @extension{ARB,texture_buffer_object}
+         * @requires_gles31 Extension @es_extension{EXT,texture_buffer}
+         * @requires_gles Buffer textures are not available in WebGL.
+         */
+        Phong& setVertexBuffers(BufferTexture& positions, BufferTexture& normals, BufferTexture* textureCoordinates = nullptr);
+        #endif
+
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Set shadow map
+         * @return Reference to self (for method chaining)
+         *
+         * Binds the depth texture of @p shadowMap and sets the cascade
+         * matrices and split distances. Has effect only if
+         * @ref Flag::ShadowMap is set. Needs to be called again after every
+         * @ref ShadowMap::update().
+         * @requires_gl30 Extension @extension{EXT,texture_array}
+         * @requires_gles30 Texture arrays are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Texture arrays are not available in WebGL 1.0.
+         */
+        Phong& setShadowMap(ShadowMap& shadowMap);
+
+        /**
+         * @brief Set joint matrices
+         * @return Reference to self (for method chaining)
+         *
+         * Binds @ref MaxJointCount consecutive @ref Matrix4 instances
+         * starting at @p offset in @p buffer to @ref JointUniformBinding.
+         * The buffer is thus expected to be large enough even if the mesh
+         * uses less joints, @p offset is expected to be a multiple of
+         * @ref Buffer::uniformOffsetAlignment(). Has effect only if
+         * @ref Flag::Skinning is set.
+         * @see @ref MeshTools::jointMatrices()
+         * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Uniform buffers are not available in WebGL 1.0.
+         */
+        Phong& setJointMatrices(Buffer& buffer, GLintptr offset = 0);
+        #endif
+
     private:
         Int transformationMatrixUniform,
             projectionMatrixUniform,
@@ -351,6 +744,15 @@ class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
             specularColorUniform,
             lightColorUniform,
             shininessUniform;
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        Int clusterScaleUniform{9},
+            clusterGridSizeUniform{10},
+            clusterDepthUniform{11};
+        #endif
+        #ifndef MAGNUM_TARGET_GLES2
+        Int shadowMatricesUniform{12},
+            shadowSplitsUniform{16};
+        #endif
 
         Flags _flags;
 };
@@ -28,6 +28,23 @@
 #define out varying
 #endif
 
+#if defined(VERTEX_PULLING) && defined(GL_ES) && __VERSION__ < 320
+#extension GL_EXT_texture_buffer: require
+#endif
+
+#ifdef UNIFORM_BUFFERS
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(std140, binding = 0)
+#else
+layout(std140)
+#endif
+uniform PhongTransformation {
+    highp mat4 transformationMatrix;
+    highp mat4 projectionMatrix;
+    mediump mat3 normalMatrix;
+    highp vec3 light;
+};
+#else
 #ifdef EXPLICIT_UNIFORM_LOCATION
 layout(location = 0)
 #endif
@@ -47,7 +64,19 @@ uniform mediump mat3 normalMatrix;
 layout(location = 3)
 #endif
 uniform highp vec3 light;
+#endif
 
+#ifdef VERTEX_PULLING
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 7)
+#endif
+uniform highp samplerBuffer positionBuffer;
+
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 8)
+#endif
+uniform mediump samplerBuffer normalBuffer;
+#else
 #ifdef EXPLICIT_ATTRIB_LOCATION
 layout(location = POSITION_ATTRIBUTE_LOCATION)
 #endif
@@ -56,28 +85,103 @@ in highp vec4 position;
 #ifdef EXPLICIT_ATTRIB_LOCATION
 layout(location = NORMAL_ATTRIBUTE_LOCATION)
 #endif
+#ifdef OCTAHEDRAL_NORMALS
+in mediump vec2 normal;
+#else
 in mediump vec3 normal;
+#endif
+#endif
 
 #ifdef TEXTURED
+#ifdef VERTEX_PULLING
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 9)
+#endif
+uniform mediump samplerBuffer textureCoordinatesBuffer;
+#else
 #ifdef EXPLICIT_ATTRIB_LOCATION
 layout(location = TEXTURECOORDINATES_ATTRIBUTE_LOCATION)
 #endif
 in mediump vec2 textureCoords;
+#endif
 
 out mediump vec2 interpolatedTextureCoords;
 #endif
 
+#ifdef SKINNING
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(std140, binding = 2)
+#else
+layout(std140)
+#endif
+uniform PhongJoints {
+    highp mat4 jointMatrices[MAX_JOINT_COUNT];
+};
+
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = JOINTIDS_ATTRIBUTE_LOCATION)
+#endif
+in highp uvec4 jointIds;
+
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = WEIGHTS_ATTRIBUTE_LOCATION)
+#endif
+in mediump vec4 weights;
+#endif
+
 out mediump vec3 transformedNormal;
 out highp vec3 lightDirection;
 out highp vec3 cameraDirection;
 
 void main() {
+    #ifdef VERTEX_PULLING
+    /* Fetch the attributes from buffer textures. The vertex ID includes the
+       first vertex and base vertex offset of the draw call. */
+    highp vec4 position = vec4(texelFetch(positionBuffer, gl_VertexID).xyz, 1.0);
+    #ifdef OCTAHEDRAL_NORMALS
+    mediump vec2 normal = texelFetch(normalBuffer, gl_VertexID).xy;
+    #else
+    mediump vec3 normal = texelFetch(normalBuffer, gl_VertexID).xyz;
+    #endif
+    #ifdef TEXTURED
+    mediump vec2 textureCoords = texelFetch(textureCoordinatesBuffer, gl_VertexID).xy;
+    #endif
+    #endif
+
+    #ifdef SKINNING
+    /* Blend the joint matrices, unused joints have zero weight */
+    highp mat4 skinMatrix =
+        weights.x*jointMatrices[jointIds.x] +
+        weights.y*jointMatrices[jointIds.y] +
+        weights.z*jointMatrices[jointIds.z] +
+        weights.w*jointMatrices[jointIds.w];
+    highp vec4 skinnedPosition = skinMatrix*position;
+    #else
+    #define skinnedPosition position
+    #endif
+
     /* Transformed vertex position */
-    highp vec4 transformedPosition4 = transformationMatrix*position;
+    highp vec4 transformedPosition4 = transformationMatrix*skinnedPosition;
     highp vec3 transformedPosition = transformedPosition4.xyz/transformedPosition4.w;
 
     /* Transformed normal vector */
-    transformedNormal = normalMatrix*normal;
+    #ifdef OCTAHEDRAL_NORMALS
+    /* Unfold the octahedron, the lower hemisphere is folded over the
+       diagonals */
+    mediump vec3 unpackedNormal = vec3(normal, 1.0 - abs(normal.x) - abs(normal.y));
+    if(unpackedNormal.z < 0.0)
+        unpackedNormal.xy = (1.0 - abs(unpackedNormal.yx))*vec2(
+            unpackedNormal.x >= 0.0 ? 1.0 : -1.0,
+            unpackedNormal.y >= 0.0 ? 1.0 : -1.0);
+    mediump vec3 objectNormal = normalize(unpackedNormal);
+    #else
+    mediump vec3 objectNormal = normal;
+    #endif
+    #ifdef SKINNING
+    /* Assuming the joints don't contain non-uniform scaling */
+    objectNormal = mat3(skinMatrix)*objectNormal;
+    #endif
+    transformedNormal = normalMatrix*objectNormal;
 
     /* Direction to the light */
     lightDirection = normalize(light - transformedPosition);
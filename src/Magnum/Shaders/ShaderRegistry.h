@@ -0,0 +1,270 @@
+#ifndef Magnum_Shaders_ShaderRegistry_h
+#define Magnum_Shaders_ShaderRegistry_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Shaders::ShaderRegistry
+ */
+
+#include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Shaders/visibility.h"
+
+namespace Magnum { namespace Shaders {
+
+namespace Implementation {
+    /* Unique address for every shader type, used as a part of the registry
+       key so no RTTI is needed */
+    template<class T> const void* shaderRegistryTypeKey() {
+        static const char key{};
+        return &key;
+    }
+}
+
+/**
+@brief Shader permutation registry
+
+Builtin shaders compile and link their GLSL sources in the constructor, so
+creating two @ref Phong instances with the same flags compiles the same
+program twice. The registry instead keeps a single instance for every
+combination of shader type, flags and @ref Context::version() and returns a
+reference to it on every subsequent request:
+@code
+Shaders::ShaderRegistry registry;
+
+Shaders::Phong& a = registry.get<Shaders::Phong>(Shaders::Phong::Flag::DiffuseTexture);
+Shaders::Phong& b = registry.get<Shaders::Phong>(Shaders::Phong::Flag::DiffuseTexture);
+// &a == &b, the program was compiled only once
+
+Shaders::Vector2D& vector = registry.get<Shaders::Vector2D>();
+@endcode
+
+Shaders without flags (such as @ref VertexColor) and shaders with default
+flags are retrieved using @ref get() without arguments. The instances are
+owned by the registry and stay valid until @ref clear() is called or the
+registry is destroyed, which has to happen while the OpenGL context is still
+alive.
+
+@section Shaders-ShaderRegistry-precompile Precompiling permutations
+
+To avoid compilation hitches during rendering, all permutations that the
+application is going to use can be compiled upfront with @ref precompile().
+The @ref permutations() helper enumerates all flag combinations from given
+mask:
+@code
+registry.precompile<Shaders::Phong>(Shaders::ShaderRegistry::permutations(
+    Shaders::Phong::Flag::AmbientTexture|Shaders::Phong::Flag::DiffuseTexture));
+registry.precompile<Shaders::Flat3D>({{}, Shaders::Flat3D::Flag::Textured});
+@endcode
+
+@section Shaders-ShaderRegistry-binary-cache Integration with program binary cache
+
+OpenGL programs can't be shared between contexts that are not in the same
+share group, so the instances stored in the registry are usable only in the
+context they were created in. Combined with @ref ShaderProgramBinaryCache it
+is however possible to precompile the permutations in a background
+thread with its own context. The background registry is used only to warm
+up the cache and then thrown away, the actual instances in the main registry
+are then linked from the cached binaries:
+@code
+// In a background thread with its own current context
+ShaderProgramBinaryCache cache{directory};
+AbstractShaderProgram::setBinaryCache(&cache);
+{
+    Shaders::ShaderRegistry registry;
+    registry.precompile<Shaders::Phong>(Shaders::ShaderRegistry::permutations(mask));
+}
+
+// Later in the main thread, linked from the cache
+Shaders::Phong& shader = mainRegistry.get<Shaders::Phong>(flags);
+@endcode
+
+Note that the registry itself is not thread-safe, every thread should use its
+own instance.
+*/
+class MAGNUM_SHADERS_EXPORT ShaderRegistry {
+    public:
+        /**
+         * @brief All flag combinations from given mask
+         *
+         * Returns all subsets of bits in @p mask, including empty flags and
+         * the @p mask itself. The result is ordered from the full @p mask
+         * down to empty flags.
+         */
+        template<class Flags> static std::vector<Flags> permutations(Flags mask);
+
+        /** @brief Constructor */
+        explicit ShaderRegistry();
+
+        /** @brief Copying is not allowed */
+        ShaderRegistry(const ShaderRegistry&) = delete;
+
+        /** @brief Moving is not allowed */
+        ShaderRegistry(ShaderRegistry&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Destroys all stored shader instances.
+         */
+        ~ShaderRegistry();
+
+        /** @brief Copying is not allowed */
+        ShaderRegistry& operator=(const ShaderRegistry&) = delete;
+
+        /** @brief Moving is not allowed */
+        ShaderRegistry& operator=(ShaderRegistry&&) = delete;
+
+        /** @brief Count of stored shader instances */
+        std::size_t size() const { return _programs.size(); }
+
+        /** @brief Whether the registry is empty */
+        bool isEmpty() const { return _programs.empty(); }
+
+        /**
+         * @brief Count of created shader instances
+         *
+         * Counts every instance compiled by @ref get() or @ref precompile()
+         * since construction of the registry.
+         * @see @ref reused()
+         */
+        UnsignedInt created() const { return _created; }
+
+        /**
+         * @brief Count of reused shader instances
+         *
+         * Counts every @ref get() call that returned an already existing
+         * instance.
+         * @see @ref created()
+         */
+        UnsignedInt reused() const { return _reused; }
+
+        /**
+         * @brief Whether given shader permutation is already compiled
+         *
+         * Takes the current context version into account.
+         */
+        template<class T> bool contains(typename T::Flags flags) const {
+            return _programs.count(key<T>(flags));
+        }
+
+        /** @overload */
+        template<class T> bool contains() const {
+            return _programs.count(key<T>());
+        }
+
+        /**
+         * @brief Shader instance for given flags
+         *
+         * If the permutation with given flags for current context version
+         * isn't in the registry yet, it is created (and thus compiled and
+         * linked), otherwise reference to the existing instance is returned.
+         */
+        template<class T> T& get(typename T::Flags flags);
+
+        /** @overload
+         *
+         * Variant for shaders which don't have any flags.
+         */
+        template<class T> T& get();
+
+        /**
+         * @brief Precompile given shader permutations
+         *
+         * Equivalent to calling @ref get() for all @p permutations.
+         * @see @ref permutations()
+         */
+        template<class T> void precompile(const std::vector<typename T::Flags>& permutations) {
+            for(typename T::Flags flags: permutations) get<T>(flags);
+        }
+
+        /** @overload */
+        template<class T> void precompile(std::initializer_list<typename T::Flags> permutations) {
+            precompile<T>(std::vector<typename T::Flags>{permutations});
+        }
+
+        /**
+         * @brief Destroy all stored shader instances
+         *
+         * All references returned from @ref get() are invalidated.
+         */
+        void clear();
+
+    private:
+        /* Shader type, flags, context version */
+        typedef std::tuple<const void*, UnsignedInt, Version> Key;
+
+        static Version currentVersion();
+
+        template<class T> static Key key(typename T::Flags flags) {
+            return Key{Implementation::shaderRegistryTypeKey<T>(), UnsignedInt(typename T::Flags::UnderlyingType(flags)), currentVersion()};
+        }
+        template<class T> static Key key() {
+            return Key{Implementation::shaderRegistryTypeKey<T>(), 0, currentVersion()};
+        }
+
+        AbstractShaderProgram* find(const Key& key);
+        AbstractShaderProgram& add(const Key& key, std::unique_ptr<AbstractShaderProgram> program);
+
+        std::map<Key, std::unique_ptr<AbstractShaderProgram>> _programs;
+        UnsignedInt _created{}, _reused{};
+};
+
+template<class Flags> std::vector<Flags> ShaderRegistry::permutations(const Flags mask) {
+    typedef typename Flags::UnderlyingType UnderlyingType;
+    const UnderlyingType value = UnderlyingType(mask);
+
+    /* Standard submask enumeration, goes through all subsets of the mask in
+       descending order and ends with zero */
+    std::vector<Flags> out;
+    for(UnderlyingType i = value; ; i = UnderlyingType((i - 1) & value)) {
+        out.push_back(Flags{i});
+        if(!i) break;
+    }
+    return out;
+}
+
+template<class T> T& ShaderRegistry::get(const typename T::Flags flags) {
+    const Key k = key<T>(flags);
+    if(AbstractShaderProgram* found = find(k))
+        return static_cast<T&>(*found);
+    return static_cast<T&>(add(k, std::unique_ptr<AbstractShaderProgram>{new T{flags}}));
+}
+
+template<class T> T& ShaderRegistry::get() {
+    const Key k = key<T>();
+    if(AbstractShaderProgram* found = find(k))
+        return static_cast<T&>(*found);
+    return static_cast<T&>(add(k, std::unique_ptr<AbstractShaderProgram>{new T{}}));
+}
+
+}}
+
+#endif
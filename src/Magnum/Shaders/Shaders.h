@@ -34,6 +34,11 @@
 namespace Magnum { namespace Shaders {
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_TARGET_GLES2
+class DeferredLighting;
+class DeferredRenderer;
+#endif
+
 template<UnsignedInt> class DistanceFieldVector;
 typedef DistanceFieldVector<2> DistanceFieldVector2D;
 typedef DistanceFieldVector<3> DistanceFieldVector3D;
@@ -46,10 +51,27 @@ template<UnsignedInt> class Flat;
 typedef Flat<2> Flat2D;
 typedef Flat<3> Flat3D;
 
+#ifndef MAGNUM_TARGET_GLES2
+class GBuffer;
+#endif
+
 /* Generic is used only statically */
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+class LightClusters;
+#endif
+
 class MeshVisualizer;
+#ifndef MAGNUM_TARGET_GLES2
+class Particle;
+class ParticleSimulation;
+class ParticleSystem;
+#endif
 class Phong;
+class ShaderRegistry;
+#ifndef MAGNUM_TARGET_GLES2
+class ShadowMap;
+#endif
 
 template<UnsignedInt> class Vector;
 typedef Vector<2> Vector2D;
@@ -0,0 +1,164 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ShadowMap.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include <cmath>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/TextureFormat.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace Shaders {
+
+std::vector<Float> ShadowMap::splitDistances(const Float near, const Float far, const UnsignedInt count, const Float lambda) {
+    std::vector<Float> distances(count + 1);
+    for(UnsignedInt i = 0; i <= count; ++i) {
+        const Float t = Float(i)/count;
+        const Float logarithmic = near*std::pow(far/near, t);
+        const Float uniform = near + (far - near)*t;
+        distances[i] = lambda*logarithmic + (1.0f - lambda)*uniform;
+    }
+
+    /* Make the ends exact */
+    distances.front() = near;
+    distances.back() = far;
+    return distances;
+}
+
+ShadowMap::ShadowMap(const Vector2i& size, const UnsignedInt cascadeCount): _size{size}, _cascadeCount{cascadeCount}, _lightDirection{0.0f, -1.0f, 0.0f}, _splitLambda{0.75f}, _casterDistance{0.0f}, _depthBias{0.001f}, _splitDistances{}, _framebuffer{{{}, size}} {
+    CORRADE_ASSERT(cascadeCount && cascadeCount <= MaxCascadeCount,
+        "Shaders::ShadowMap: expected 1 to" << MaxCascadeCount << "cascades but got" << cascadeCount, );
+
+    _texture.setMinificationFilter(Sampler::Filter::Linear)
+        .setMagnificationFilter(Sampler::Filter::Linear)
+        .setWrapping(Sampler::Wrapping::ClampToEdge)
+        .setCompareMode(Sampler::CompareMode::CompareRefToTexture)
+        .setCompareFunction(Sampler::CompareFunction::LessOrEqual)
+        .setStorage(1, TextureFormat::DepthComponent24, {size, Int(cascadeCount)});
+
+    _framebuffer.attachTextureLayer(Framebuffer::BufferAttachment::Depth, _texture, 0, 0)
+        .mapForDraw(Framebuffer::DrawAttachment::None);
+
+    CORRADE_INTERNAL_ASSERT(_framebuffer.checkStatus(FramebufferTarget::Draw) == Framebuffer::Status::Complete);
+}
+
+ShadowMap& ShadowMap::setLightDirection(const Vector3& direction) {
+    _lightDirection = direction.normalized();
+    return *this;
+}
+
+ShadowMap& ShadowMap::update(const Matrix4& cameraMatrix, const Matrix4& projectionMatrix) {
+    const Matrix4 inverseProjection = projectionMatrix.inverted();
+    const Matrix4 inverseCamera = cameraMatrix.inverted();
+
+    /* Corners of the near and far plane in camera space. Points of each
+       slice lie on lines between them for both perspective and orthographic
+       projection. */
+    Vector3 nearCorners[4], farCorners[4];
+    for(std::size_t i = 0; i != 4; ++i) {
+        const Vector2 corner{i & 1 ? 1.0f : -1.0f, i & 2 ? 1.0f : -1.0f};
+        nearCorners[i] = inverseProjection.transformPoint({corner, -1.0f});
+        farCorners[i] = inverseProjection.transformPoint({corner, 1.0f});
+    }
+    const Float near = -nearCorners[0].z();
+    const Float far = -farCorners[0].z();
+    const std::vector<Float> distances = splitDistances(near, far, _cascadeCount, _splitLambda);
+
+    /* Avoid up vector parallel to the light direction */
+    const Vector3 up = std::abs(_lightDirection.y()) > 0.99f ? Vector3::xAxis() : Vector3::yAxis();
+
+    /* From clip space to texture coordinates and depth in [0, 1] */
+    const Matrix4 bias = Matrix4::translation({0.5f, 0.5f, 0.5f - _depthBias})*Matrix4::scaling(Vector3{0.5f});
+
+    for(UnsignedInt i = 0; i != _cascadeCount; ++i) {
+        /* Slice corners in world space, their bounding sphere */
+        Vector3 corners[8];
+        Vector3 center;
+        for(std::size_t j = 0; j != 4; ++j) {
+            const Vector3 direction = farCorners[j] - nearCorners[j];
+            corners[2*j] = inverseCamera.transformPoint(nearCorners[j] + direction*((distances[i] - near)/(far - near)));
+            corners[2*j + 1] = inverseCamera.transformPoint(nearCorners[j] + direction*((distances[i + 1] - near)/(far - near)));
+            center += corners[2*j] + corners[2*j + 1];
+        }
+        center /= 8.0f;
+        Float radius = 0.0f;
+        for(const Vector3& corner: corners)
+            radius = Math::max(radius, (corner - center).length());
+
+        /* Round the radius so the extents don't change due to float
+           imprecision */
+        radius = std::ceil(radius*16.0f)/16.0f;
+
+        /* Orthographic projection from the light looking at the sphere center,
+           extended towards the light to include the casters */
+        const Matrix4 lightCamera = Matrix4::lookAt(center - _lightDirection*(radius + _casterDistance), center, up).invertedRigid();
+        Matrix4 projection = Matrix4::orthographicProjection(Vector2{2.0f*radius}, 0.0f, 2.0f*radius + _casterDistance);
+
+        /* Snap to whole texels so the shadow edges don't shimmer when the
+           camera moves */
+        const Vector2 origin = (projection*lightCamera).transformPoint({}).xy()*Vector2{_size}*0.5f;
+        projection = Matrix4::translation({(Math::round(origin) - origin)*2.0f/Vector2{_size}, 0.0f})*projection;
+
+        _splitDistances[i] = distances[i + 1];
+        _cascadeCameraMatrices[i] = lightCamera;
+        _cascadeProjectionMatrices[i] = projection;
+        _shadowMatrices[i] = bias*projection*lightCamera*inverseCamera;
+    }
+
+    return *this;
+}
+
+Float ShadowMap::splitDistance(const UnsignedInt cascade) const {
+    CORRADE_ASSERT(cascade < _cascadeCount,
+        "Shaders::ShadowMap::splitDistance(): index" << cascade << "out of range for" << _cascadeCount << "cascades", {});
+    return _splitDistances[cascade];
+}
+
+Matrix4 ShadowMap::cascadeCameraMatrix(const UnsignedInt cascade) const {
+    CORRADE_ASSERT(cascade < _cascadeCount,
+        "Shaders::ShadowMap::cascadeCameraMatrix(): index" << cascade << "out of range for" << _cascadeCount << "cascades", {});
+    return _cascadeCameraMatrices[cascade];
+}
+
+Matrix4 ShadowMap::cascadeProjectionMatrix(const UnsignedInt cascade) const {
+    CORRADE_ASSERT(cascade < _cascadeCount,
+        "Shaders::ShadowMap::cascadeProjectionMatrix(): index" << cascade << "out of range for" << _cascadeCount << "cascades", {});
+    return _cascadeProjectionMatrices[cascade];
+}
+
+ShadowMap& ShadowMap::bind(const UnsignedInt cascade) {
+    CORRADE_ASSERT(cascade < _cascadeCount,
+        "Shaders::ShadowMap::bind(): index" << cascade << "out of range for" << _cascadeCount << "cascades", *this);
+
+    _framebuffer.attachTextureLayer(Framebuffer::BufferAttachment::Depth, _texture, 0, cascade)
+        .bind();
+    _framebuffer.clear(FramebufferClear::Depth);
+    return *this;
+}
+
+}}
+#endif
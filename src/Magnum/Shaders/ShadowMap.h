@@ -0,0 +1,273 @@
+#ifndef Magnum_Shaders_ShadowMap_h
+#define Magnum_Shaders_ShadowMap_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::Shaders::ShadowMap
+ */
+#endif
+
+#include "Magnum/configure.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Framebuffer.h"
+#include "Magnum/TextureArray.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shaders/visibility.h"
+
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Cascaded shadow map
+
+Shadow map of a directional light split into up to @ref MaxCascadeCount
+cascades, each covering a successive depth range of the camera frustum with
+its own layer of a depth @ref Texture2DArray. Nearer cascades cover smaller
+area and thus have higher effective resolution.
+
+Every frame, call @ref update() with the camera matrices, then for each
+cascade bind its layer with @ref bind() and render the shadow casters using
+@ref cascadeCameraMatrix() and @ref cascadeProjectionMatrix(), for example
+with @ref Flat3D using @ref Flat3D::Flag::DepthOnly. The drawables can be
+culled against each cascade using the
+@ref SceneGraph::Camera::drawableTransformations(DrawableGroup<dimensions, T>&, const MatrixTypeFor<dimensions, T>&, const MatrixTypeFor<dimensions, T>&) "SceneGraph::Camera::drawableTransformations()"
+overload taking custom matrices. The scene is then rendered with @ref Phong
+using @ref Phong::Flag::ShadowMap:
+@code
+Shaders::ShadowMap shadowMap{{2048, 2048}, 3};
+Shaders::Flat3D depthShader{Shaders::Flat3D::Flag::DepthOnly};
+
+shadowMap.setLightDirection({-1.0f, -2.0f, -0.5f})
+    .update(camera.cameraMatrix(), camera.projectionMatrix());
+for(UnsignedInt i = 0; i != shadowMap.cascadeCount(); ++i) {
+    shadowMap.bind(i);
+    const Matrix4 projection = shadowMap.cascadeProjectionMatrix(i);
+    for(const auto& d: camera.drawableTransformations(drawables, shadowMap.cascadeCameraMatrix(i), projection)) {
+        depthShader.setTransformationProjectionMatrix(projection*d.second);
+        static_cast<MyDrawable&>(d.first.get()).mesh().draw(depthShader);
+    }
+}
+
+defaultFramebuffer.bind();
+phongShader.setShadowMap(shadowMap);
+camera.draw(drawables);
+@endcode
+
+The cascade fits a bounding sphere of its frustum slice, which keeps the
+shadow map extents constant while the camera rotates, and the light view is
+snapped to whole texels to avoid shimmering of shadow edges when the camera
+moves. Casters outside of the camera frustum but between it and the light are
+included only up to @ref setCasterDistance() away.
+
+@requires_gl30 Extension @extension{EXT,texture_array} and
+    @extension{ARB,framebuffer_object}
+@requires_gles30 Texture arrays are not available in OpenGL ES 2.0.
+@requires_webgl20 Texture arrays are not available in WebGL 1.0.
+*/
+class MAGNUM_SHADERS_EXPORT ShadowMap {
+    public:
+        enum: UnsignedInt {
+            MaxCascadeCount = 4     /**< Max cascade count */
+        };
+
+        /**
+         * @brief Split distances
+         * @param near      Near plane distance
+         * @param far       Far plane distance
+         * @param count     Cascade count
+         * @param lambda    Blend between uniform (`0.0f`) and logarithmic
+         *      (`1.0f`) distribution
+         *
+         * Returns @p count + 1 distances, the first being @p near and the
+         * last @p far, cascade @f$ i @f$ covers range between distances
+         * @f$ i @f$ and @f$ i + 1 @f$: @f[
+         *      d_i = \lambda n \left(\frac{f}{n}\right)^{\frac{i}{N}} + (1 - \lambda) \left(n + (f - n) \frac{i}{N}\right)
+         * @f]
+         */
+        static std::vector<Float> splitDistances(Float near, Float far, UnsignedInt count, Float lambda);
+
+        /**
+         * @brief Constructor
+         * @param size          Size of each cascade
+         * @param cascadeCount  Cascade count, at most @ref MaxCascadeCount
+         *
+         * Allocates a @ref TextureFormat::DepthComponent24 texture array
+         * with linear filtering and depth comparison enabled, so
+         * the shadow lookups are filtered in hardware.
+         */
+        explicit ShadowMap(const Vector2i& size, UnsignedInt cascadeCount = MaxCascadeCount);
+
+        /** @brief Size of each cascade */
+        Vector2i size() const { return _size; }
+
+        /** @brief Cascade count */
+        UnsignedInt cascadeCount() const { return _cascadeCount; }
+
+        /** @brief Depth texture array */
+        Texture2DArray& texture() { return _texture; }
+
+        /** @brief Framebuffer */
+        Framebuffer& framebuffer() { return _framebuffer; }
+
+        /** @brief Light direction */
+        Vector3 lightDirection() const { return _lightDirection; }
+
+        /**
+         * @brief Set light direction
+         * @return Reference to self (for method chaining)
+         *
+         * Direction in which the light shines, in world space. Doesn't need
+         * to be normalized. Default is `{0.0f, -1.0f, 0.0f}`. Takes effect
+         * on next @ref update().
+         */
+        ShadowMap& setLightDirection(const Vector3& direction);
+
+        /** @brief Split distribution */
+        Float splitLambda() const { return _splitLambda; }
+
+        /**
+         * @brief Set split distribution
+         * @return Reference to self (for method chaining)
+         *
+         * See @ref splitDistances() for details. Default is `0.75f`. Takes
+         * effect on next @ref update().
+         */
+        ShadowMap& setSplitLambda(Float lambda) {
+            _splitLambda = lambda;
+            return *this;
+        }
+
+        /** @brief Caster distance */
+        Float casterDistance() const { return _casterDistance; }
+
+        /**
+         * @brief Set caster distance
+         * @return Reference to self (for method chaining)
+         *
+         * How far towards the light from the cascade volume are shadow
+         * casters still included. Default is `0.0f`, i.e. only casters
+         * overlapping the cascade volume. Takes effect on next
+         * @ref update().
+         */
+        ShadowMap& setCasterDistance(Float distance) {
+            _casterDistance = distance;
+            return *this;
+        }
+
+        /** @brief Depth bias */
+        Float depthBias() const { return _depthBias; }
+
+        /**
+         * @brief Set depth bias
+         * @return Reference to self (for method chaining)
+         *
+         * Subtracted from depth of the shaded fragment to avoid
+         * self-shadowing artifacts, in the @f$ [0, 1] @f$ depth range of
+         * the cascade. Default is `0.001f`. Takes effect on next
+         * @ref update().
+         */
+        ShadowMap& setDepthBias(Float bias) {
+            _depthBias = bias;
+            return *this;
+        }
+
+        /**
+         * @brief Update the cascades
+         * @param cameraMatrix      Camera matrix, converting from world to
+         *      camera space
+         * @param projectionMatrix  Camera projection matrix
+         * @return Reference to self (for method chaining)
+         *
+         * Splits the frustum described by @p projectionMatrix using
+         * @ref splitDistances() and fits an orthographic light view to each
+         * slice. Both perspective and orthographic projections are
+         * supported.
+         * @see @ref SceneGraph::Camera::cameraMatrix(),
+         *      @ref SceneGraph::Camera::projectionMatrix()
+         */
+        ShadowMap& update(const Matrix4& cameraMatrix, const Matrix4& projectionMatrix);
+
+        /**
+         * @brief Split distance
+         *
+         * Far distance of given cascade in camera space, as computed by last
+         * @ref update().
+         */
+        Float splitDistance(UnsignedInt cascade) const;
+
+        /**
+         * @brief Cascade camera matrix
+         *
+         * Converts from world space to the light view of given cascade.
+         */
+        Matrix4 cascadeCameraMatrix(UnsignedInt cascade) const;
+
+        /** @brief Cascade projection matrix */
+        Matrix4 cascadeProjectionMatrix(UnsignedInt cascade) const;
+
+        /**
+         * @brief Shadow matrices
+         *
+         * For each cascade a matrix converting from camera space of the
+         * camera passed to last @ref update() to texture coordinates and
+         * biased depth of the cascade. Used by @ref Phong::setShadowMap().
+         */
+        Containers::ArrayView<const Matrix4> shadowMatrices() const {
+            return {_shadowMatrices, _cascadeCount};
+        }
+
+        /**
+         * @brief Bind given cascade for rendering
+         * @return Reference to self (for method chaining)
+         *
+         * Attaches layer of given cascade to the framebuffer, binds it and
+         * clears depth.
+         */
+        ShadowMap& bind(UnsignedInt cascade);
+
+    private:
+        Vector2i _size;
+        UnsignedInt _cascadeCount;
+        Vector3 _lightDirection;
+        Float _splitLambda, _casterDistance, _depthBias;
+        Float _splitDistances[MaxCascadeCount];
+        Matrix4 _cascadeCameraMatrices[MaxCascadeCount],
+            _cascadeProjectionMatrices[MaxCascadeCount],
+            _shadowMatrices[MaxCascadeCount];
+        Texture2DArray _texture;
+        Framebuffer _framebuffer;
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
@@ -0,0 +1,152 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Context.h"
+#include "Magnum/Framebuffer.h"
+#include "Magnum/Renderbuffer.h"
+#include "Magnum/RenderbufferFormat.h"
+#include "Magnum/Shaders/DeferredRenderer.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+struct DeferredRendererGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit DeferredRendererGLTest();
+
+    void lightScissor();
+    void lightScissorCameraInside();
+    void lightScissorBehind();
+    void lightScissorOutside();
+    void lightScissorClamped();
+
+    void constructGBuffer();
+    void compileLighting();
+    void draw();
+};
+
+DeferredRendererGLTest::DeferredRendererGLTest() {
+    addTests({&DeferredRendererGLTest::lightScissor,
+              &DeferredRendererGLTest::lightScissorCameraInside,
+              &DeferredRendererGLTest::lightScissorBehind,
+              &DeferredRendererGLTest::lightScissorOutside,
+              &DeferredRendererGLTest::lightScissorClamped,
+
+              &DeferredRendererGLTest::constructGBuffer,
+              &DeferredRendererGLTest::compileLighting,
+              &DeferredRendererGLTest::draw});
+}
+
+namespace {
+    const Matrix4 Projection = Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f);
+}
+
+void DeferredRendererGLTest::lightScissor() {
+    /* Nearest box face is at depth 9, so the box projects to 1/9 of the
+       half-size around the center */
+    CORRADE_COMPARE(DeferredRenderer::lightScissor(Projection, {100, 100}, {0.0f, 0.0f, -10.0f}, 1.0f),
+        Range2Di({44, 44}, {56, 56}));
+}
+
+void DeferredRendererGLTest::lightScissorCameraInside() {
+    CORRADE_COMPARE(DeferredRenderer::lightScissor(Projection, {100, 100}, {0.0f, 0.0f, -0.5f}, 1.0f),
+        Range2Di({0, 0}, {100, 100}));
+}
+
+void DeferredRendererGLTest::lightScissorBehind() {
+    CORRADE_COMPARE(DeferredRenderer::lightScissor(Projection, {100, 100}, {0.0f, 0.0f, 10.0f}, 1.0f),
+        Range2Di{});
+}
+
+void DeferredRendererGLTest::lightScissorOutside() {
+    CORRADE_COMPARE(DeferredRenderer::lightScissor(Projection, {100, 100}, {-50.0f, 0.0f, -10.0f}, 1.0f),
+        Range2Di{});
+}
+
+void DeferredRendererGLTest::lightScissorClamped() {
+    CORRADE_COMPARE(DeferredRenderer::lightScissor(Projection, {100, 100}, {9.5f, 0.0f, -10.0f}, 1.0f),
+        Range2Di({88, 44}, {100, 56}));
+}
+
+void DeferredRendererGLTest::constructGBuffer() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isVersionSupported(Version::GL300))
+        CORRADE_SKIP("OpenGL 3.0 is not supported");
+    #endif
+
+    GBuffer gbuffer{{32, 16}};
+    gbuffer.bind();
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(gbuffer.size(), (Vector2i{32, 16}));
+    CORRADE_COMPARE(gbuffer.framebuffer().checkStatus(FramebufferTarget::Draw), Framebuffer::Status::Complete);
+
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_COMPARE(gbuffer.albedoTexture().imageSize(0), (Vector2i{32, 16}));
+    CORRADE_COMPARE(gbuffer.normalTexture().imageSize(0), (Vector2i{32, 16}));
+    CORRADE_COMPARE(gbuffer.depthTexture().imageSize(0), (Vector2i{32, 16}));
+    #endif
+}
+
+void DeferredRendererGLTest::compileLighting() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isVersionSupported(Version::GL300))
+        CORRADE_SKIP("OpenGL 3.0 is not supported");
+    #endif
+
+    DeferredLighting shader;
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void DeferredRendererGLTest::draw() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isVersionSupported(Version::GL300))
+        CORRADE_SKIP("OpenGL 3.0 is not supported");
+    #endif
+
+    Renderbuffer color;
+    color.setStorage(RenderbufferFormat::RGBA8, {32, 32});
+    Framebuffer framebuffer{{{}, {32, 32}}};
+    framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment{0}, color);
+
+    DeferredRenderer renderer{{32, 32}};
+    renderer.bindGBuffer();
+    renderer.setProjectionMatrix(Projection)
+        .setAmbientColor(Color3{0.1f})
+        .setLights({
+            {{0.0f, 0.0f, -10.0f}, 1.0f, Color3{1.0f}},
+            /* Culled */
+            {{0.0f, 0.0f, 10.0f}, 1.0f, Color3{1.0f}}});
+    renderer.draw(framebuffer);
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(renderer.drawnLightCount(), 1);
+}
+
+}}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Shaders::Test::DeferredRendererGLTest)
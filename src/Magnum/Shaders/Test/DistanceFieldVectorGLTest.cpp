@@ -23,6 +23,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include "Magnum/Context.h"
+#include "Magnum/Version.h"
 #include "Magnum/Shaders/DistanceFieldVector.h"
 #include "Magnum/Test/AbstractOpenGLTester.h"
 
@@ -33,11 +35,24 @@ struct DistanceFieldVectorGLTest: Magnum::Test::AbstractOpenGLTester {
 
     void compile2D();
     void compile3D();
+    void compileMultichannel2D();
+    void compileMultichannel3D();
+    #ifndef MAGNUM_TARGET_GLES2
+    void compileInstancedGlyphs2D();
+    void compileInstancedGlyphs3D();
+    #endif
 };
 
 DistanceFieldVectorGLTest::DistanceFieldVectorGLTest() {
     addTests({&DistanceFieldVectorGLTest::compile2D,
-              &DistanceFieldVectorGLTest::compile3D});
+              &DistanceFieldVectorGLTest::compile3D,
+              &DistanceFieldVectorGLTest::compileMultichannel2D,
+              &DistanceFieldVectorGLTest::compileMultichannel3D,
+              #ifndef MAGNUM_TARGET_GLES2
+              &DistanceFieldVectorGLTest::compileInstancedGlyphs2D,
+              &DistanceFieldVectorGLTest::compileInstancedGlyphs3D
+              #endif
+              });
 }
 
 void DistanceFieldVectorGLTest::compile2D() {
@@ -60,6 +75,62 @@ void DistanceFieldVectorGLTest::compile3D() {
     }
 }
 
+void DistanceFieldVectorGLTest::compileMultichannel2D() {
+    Shaders::DistanceFieldVector2D shader{Shaders::DistanceFieldVector2D::Flag::MultichannelDistanceField};
+    CORRADE_COMPARE(shader.flags(), Shaders::DistanceFieldVector2D::Flag::MultichannelDistanceField);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void DistanceFieldVectorGLTest::compileMultichannel3D() {
+    Shaders::DistanceFieldVector3D shader{Shaders::DistanceFieldVector3D::Flag::MultichannelDistanceField};
+    CORRADE_COMPARE(shader.flags(), Shaders::DistanceFieldVector3D::Flag::MultichannelDistanceField);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+void DistanceFieldVectorGLTest::compileInstancedGlyphs2D() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isVersionSupported(Version::GL300))
+        CORRADE_SKIP("OpenGL 3.0 is not supported.");
+    #endif
+
+    Shaders::DistanceFieldVector2D shader{Shaders::DistanceFieldVector2D::Flag::InstancedGlyphs};
+    CORRADE_COMPARE(shader.flags(), Shaders::DistanceFieldVector2D::Flag::InstancedGlyphs);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void DistanceFieldVectorGLTest::compileInstancedGlyphs3D() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isVersionSupported(Version::GL300))
+        CORRADE_SKIP("OpenGL 3.0 is not supported.");
+    #endif
+
+    Shaders::DistanceFieldVector3D shader{Shaders::DistanceFieldVector3D::Flag::InstancedGlyphs};
+    CORRADE_COMPARE(shader.flags(), Shaders::DistanceFieldVector3D::Flag::InstancedGlyphs);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+#endif
+
 }}}
 
 MAGNUM_GL_TEST_MAIN(Magnum::Shaders::Test::DistanceFieldVectorGLTest)
@@ -23,6 +23,13 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include "Magnum/Context.h"
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include "Magnum/Buffer.h"
+#include "Magnum/BufferTexture.h"
+#include "Magnum/BufferTextureFormat.h"
+#endif
+#include "Magnum/Extensions.h"
 #include "Magnum/Shaders/Flat.h"
 #include "Magnum/Test/AbstractOpenGLTester.h"
 
@@ -35,13 +42,46 @@ struct FlatGLTest: Magnum::Test::AbstractOpenGLTester {
     void compile3D();
     void compile2DTextured();
     void compile3DTextured();
+    void compile3DDepthOnly();
+    void compile3DDepthOnlyTextured();
+    void compile2DInstanced();
+    void compile3DInstanced();
+    #ifndef MAGNUM_TARGET_GLES2
+    void compile2DUniformBuffers();
+    void compile3DUniformBuffers();
+    #endif
+    #ifndef MAGNUM_TARGET_GLES
+    void compile2DBindlessTexture();
+    void compile3DBindlessTexture();
+    #endif
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    void compile2DVertexPulling();
+    void compile3DVertexPulling();
+    #endif
 };
 
 FlatGLTest::FlatGLTest() {
     addTests({&FlatGLTest::compile2D,
               &FlatGLTest::compile3D,
               &FlatGLTest::compile2DTextured,
-              &FlatGLTest::compile3DTextured});
+              &FlatGLTest::compile3DTextured,
+              &FlatGLTest::compile3DDepthOnly,
+              &FlatGLTest::compile3DDepthOnlyTextured,
+              &FlatGLTest::compile2DInstanced,
+              &FlatGLTest::compile3DInstanced,
+              #ifndef MAGNUM_TARGET_GLES2
+              &FlatGLTest::compile2DUniformBuffers,
+              &FlatGLTest::compile3DUniformBuffers,
+              #endif
+              #ifndef MAGNUM_TARGET_GLES
+              &FlatGLTest::compile2DBindlessTexture,
+              &FlatGLTest::compile3DBindlessTexture,
+              #endif
+              #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+              &FlatGLTest::compile2DVertexPulling,
+              &FlatGLTest::compile3DVertexPulling
+              #endif
+              });
 }
 
 void FlatGLTest::compile2D() {
@@ -84,6 +124,152 @@ void FlatGLTest::compile3DTextured() {
     }
 }
 
+void FlatGLTest::compile3DDepthOnly() {
+    Shaders::Flat3D shader(Shaders::Flat3D::Flag::DepthOnly);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void FlatGLTest::compile3DDepthOnlyTextured() {
+    Shaders::Flat3D shader(Shaders::Flat3D::Flag::DepthOnly|Shaders::Flat3D::Flag::Textured);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void FlatGLTest::compile2DInstanced() {
+    Shaders::Flat2D shader(Shaders::Flat2D::Flag::VertexColor|Shaders::Flat2D::Flag::InstancedTransformation);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void FlatGLTest::compile3DInstanced() {
+    Shaders::Flat3D shader(Shaders::Flat3D::Flag::VertexColor|Shaders::Flat3D::Flag::InstancedTransformation);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+void FlatGLTest::compile2DUniformBuffers() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isVersionSupported(Version::GL310))
+        CORRADE_SKIP("OpenGL 3.1 is not supported");
+    #endif
+
+    Shaders::Flat2D shader(Shaders::Flat2D::Flag::UniformBuffers);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void FlatGLTest::compile3DUniformBuffers() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isVersionSupported(Version::GL310))
+        CORRADE_SKIP("OpenGL 3.1 is not supported");
+    #endif
+
+    Shaders::Flat3D shader(Shaders::Flat3D::Flag::UniformBuffers);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+#endif
+
+#ifndef MAGNUM_TARGET_GLES
+void FlatGLTest::compile2DBindlessTexture() {
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::bindless_texture>())
+        CORRADE_SKIP(Extensions::GL::ARB::bindless_texture::string() + std::string(" is not supported."));
+
+    Shaders::Flat2D shader(Shaders::Flat2D::Flag::Textured|Shaders::Flat2D::Flag::BindlessTexture);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void FlatGLTest::compile3DBindlessTexture() {
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::bindless_texture>())
+        CORRADE_SKIP(Extensions::GL::ARB::bindless_texture::string() + std::string(" is not supported."));
+
+    Shaders::Flat3D shader(Shaders::Flat3D::Flag::Textured|Shaders::Flat3D::Flag::BindlessTexture);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+#endif
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+void FlatGLTest::compile2DVertexPulling() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isVersionSupported(Version::GL310))
+        CORRADE_SKIP("OpenGL 3.1 is not supported");
+    #else
+    if(!Context::current().isExtensionSupported<Extensions::GL::EXT::texture_buffer>())
+        CORRADE_SKIP(Extensions::GL::EXT::texture_buffer::string() + std::string(" is not supported."));
+    #endif
+
+    Shaders::Flat2D shader(Shaders::Flat2D::Flag::Textured|Shaders::Flat2D::Flag::VertexPulling);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void FlatGLTest::compile3DVertexPulling() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isVersionSupported(Version::GL310))
+        CORRADE_SKIP("OpenGL 3.1 is not supported");
+    #else
+    if(!Context::current().isExtensionSupported<Extensions::GL::EXT::texture_buffer>())
+        CORRADE_SKIP(Extensions::GL::EXT::texture_buffer::string() + std::string(" is not supported."));
+    #endif
+
+    Buffer buffer;
+    buffer.setData({nullptr, 3*16}, BufferUsage::StaticDraw);
+    BufferTexture positions, colors;
+    positions.setBuffer(BufferTextureFormat::RGB32F, buffer);
+    colors.setBuffer(BufferTextureFormat::RGBA8, buffer);
+
+    Shaders::Flat3D shader(Shaders::Flat3D::Flag::VertexColor|Shaders::Flat3D::Flag::VertexPulling);
+    shader.setVertexBuffers(positions, nullptr, &colors);
+    MAGNUM_VERIFY_NO_ERROR();
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+#endif
+
 }}}
 
 MAGNUM_GL_TEST_MAIN(Magnum::Shaders::Test::FlatGLTest)
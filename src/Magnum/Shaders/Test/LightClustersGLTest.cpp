@@ -0,0 +1,211 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Shaders/LightClusters.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+struct LightClustersGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit LightClustersGLTest();
+
+    void construct();
+    void constructZeroGridSize();
+
+    void binEmpty();
+    void binSingle();
+    void binCulled();
+    void binLarge();
+    void binOrder();
+
+    void invalidProjection();
+    void clusterOutOfRange();
+};
+
+LightClustersGLTest::LightClustersGLTest() {
+    addTests({&LightClustersGLTest::construct,
+              &LightClustersGLTest::constructZeroGridSize,
+
+              &LightClustersGLTest::binEmpty,
+              &LightClustersGLTest::binSingle,
+              &LightClustersGLTest::binCulled,
+              &LightClustersGLTest::binLarge,
+              &LightClustersGLTest::binOrder,
+
+              &LightClustersGLTest::invalidProjection,
+              &LightClustersGLTest::clusterOutOfRange});
+}
+
+namespace {
+    bool isSupported() {
+        #ifndef MAGNUM_TARGET_GLES
+        return Context::current().isExtensionSupported<Extensions::GL::ARB::texture_buffer_object>();
+        #else
+        return Context::current().isExtensionSupported<Extensions::GL::EXT::texture_buffer>();
+        #endif
+    }
+
+    const char* notSupportedMessage() {
+        #ifndef MAGNUM_TARGET_GLES
+        return "GL_ARB_texture_buffer_object is not supported.";
+        #else
+        return "GL_EXT_texture_buffer is not supported.";
+        #endif
+    }
+}
+
+void LightClustersGLTest::construct() {
+    if(!isSupported()) CORRADE_SKIP(notSupportedMessage());
+
+    LightClusters clusters{{4, 3, 2}};
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(clusters.gridSize(), (Vector3i{4, 3, 2}));
+    CORRADE_COMPARE(clusters.clusterCount(), 24);
+    CORRADE_COMPARE(clusters.lightIndexCount(), 0);
+    CORRADE_VERIFY(clusters.lights().empty());
+}
+
+void LightClustersGLTest::constructZeroGridSize() {
+    if(!isSupported()) CORRADE_SKIP(notSupportedMessage());
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    LightClusters clusters{{4, 0, 2}};
+    CORRADE_COMPARE(out.str(), "Shaders::LightClusters: expected non-zero grid size, got Vector(4, 0, 2)\n");
+}
+
+void LightClustersGLTest::binEmpty() {
+    if(!isSupported()) CORRADE_SKIP(notSupportedMessage());
+
+    LightClusters clusters{{4, 4, 8}};
+    clusters.bin();
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(clusters.lightIndexCount(), 0);
+    CORRADE_COMPARE(clusters.clusterLights({0, 0, 0}).size(), 0);
+}
+
+void LightClustersGLTest::binSingle() {
+    if(!isSupported()) CORRADE_SKIP(notSupportedMessage());
+
+    LightClusters clusters{{4, 4, 8}};
+    clusters.setProjection(Deg(90.0f), 1.0f, 1.0f, 100.0f)
+        .setLights({{{0.0f, 0.0f, -10.0f}, 0.5f, Color3{1.0f}}})
+        .bin();
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Depth 9.5 to 10.5 is in depth slices 3 and 4, the light is in the
+       center so it touches the two middle tiles on both axes */
+    CORRADE_COMPARE(clusters.lightIndexCount(), 8);
+    for(Int z: {3, 4}) for(Int y: {1, 2}) for(Int x: {1, 2}) {
+        CORRADE_COMPARE(clusters.clusterLights({x, y, z}).size(), 1);
+        CORRADE_COMPARE(clusters.clusterLights({x, y, z})[0], 0);
+    }
+    CORRADE_COMPARE(clusters.clusterLights({0, 1, 3}).size(), 0);
+    CORRADE_COMPARE(clusters.clusterLights({1, 1, 2}).size(), 0);
+}
+
+void LightClustersGLTest::binCulled() {
+    if(!isSupported()) CORRADE_SKIP(notSupportedMessage());
+
+    LightClusters clusters{{4, 4, 8}};
+    clusters.setProjection(Deg(90.0f), 1.0f, 1.0f, 100.0f)
+        .setLights({
+            /* Behind the camera */
+            {{0.0f, 0.0f, 10.0f}, 2.0f, Color3{1.0f}},
+            /* Behind far plane */
+            {{0.0f, 0.0f, -1000.0f}, 2.0f, Color3{1.0f}},
+            /* Outside of the frustum on the left */
+            {{-50.0f, 0.0f, -10.0f}, 2.0f, Color3{1.0f}}})
+        .bin();
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(clusters.lightIndexCount(), 0);
+}
+
+void LightClustersGLTest::binLarge() {
+    if(!isSupported()) CORRADE_SKIP(notSupportedMessage());
+
+    LightClusters clusters{{4, 4, 8}};
+    clusters.setProjection(Deg(90.0f), 1.0f, 1.0f, 100.0f)
+        .setLights({{{0.0f, 0.0f, -50.0f}, 100.0f, Color3{1.0f}}})
+        .bin();
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Light covering the whole frustum is in every cell */
+    CORRADE_COMPARE(clusters.lightIndexCount(), clusters.clusterCount());
+}
+
+void LightClustersGLTest::binOrder() {
+    if(!isSupported()) CORRADE_SKIP(notSupportedMessage());
+
+    LightClusters clusters{{4, 4, 8}};
+    clusters.setProjection(Deg(90.0f), 1.0f, 1.0f, 100.0f)
+        .setLights({
+            {{0.0f, 0.0f, -50.0f}, 100.0f, Color3{1.0f}},
+            {{-9.0f, -9.0f, -10.0f}, 0.5f, Color3{1.0f}},
+            {{0.0f, 0.0f, -10.0f}, 0.5f, Color3{1.0f}}})
+        .bin();
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Indices in every cell are sorted */
+    Containers::ArrayView<const UnsignedInt> lights = clusters.clusterLights({1, 1, 3});
+    CORRADE_COMPARE(lights.size(), 2);
+    CORRADE_COMPARE(lights[0], 0);
+    CORRADE_COMPARE(lights[1], 2);
+
+    lights = clusters.clusterLights({0, 0, 4});
+    CORRADE_COMPARE(lights.size(), 2);
+    CORRADE_COMPARE(lights[0], 0);
+    CORRADE_COMPARE(lights[1], 1);
+
+    CORRADE_COMPARE(clusters.lightIndexCount(), clusters.clusterCount() + 2 + 8);
+}
+
+void LightClustersGLTest::invalidProjection() {
+    if(!isSupported()) CORRADE_SKIP(notSupportedMessage());
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    LightClusters clusters;
+    clusters.setProjection(Deg(35.0f), 1.0f, 0.0f, 100.0f);
+    CORRADE_COMPARE(out.str(), "Shaders::LightClusters::setProjection(): expected 0 < near < far, got 0 and 100\n");
+}
+
+void LightClustersGLTest::clusterOutOfRange() {
+    if(!isSupported()) CORRADE_SKIP(notSupportedMessage());
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    LightClusters clusters{{4, 4, 8}};
+    clusters.clusterLights({0, 4, 0});
+    CORRADE_COMPARE(out.str(), "Shaders::LightClusters::clusterLights(): cell Vector(0, 4, 0) out of range for Vector(4, 4, 8) grid\n");
+}
+
+}}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Shaders::Test::LightClustersGLTest)
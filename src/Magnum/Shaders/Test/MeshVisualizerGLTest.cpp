@@ -38,6 +38,7 @@ struct MeshVisualizerGLTest: Magnum::Test::AbstractOpenGLTester {
     void compileWireframeGeometryShader();
     #endif
     void compileWireframeNoGeometryShader();
+    void compileWireframeBarycentricAttribute();
 };
 
 MeshVisualizerGLTest::MeshVisualizerGLTest() {
@@ -45,7 +46,8 @@ MeshVisualizerGLTest::MeshVisualizerGLTest() {
               #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
               &MeshVisualizerGLTest::compileWireframeGeometryShader,
               #endif
-              &MeshVisualizerGLTest::compileWireframeNoGeometryShader});
+              &MeshVisualizerGLTest::compileWireframeNoGeometryShader,
+              &MeshVisualizerGLTest::compileWireframeBarycentricAttribute});
 }
 
 void MeshVisualizerGLTest::compile() {
@@ -93,6 +95,16 @@ void MeshVisualizerGLTest::compileWireframeNoGeometryShader() {
     }
 }
 
+void MeshVisualizerGLTest::compileWireframeBarycentricAttribute() {
+    Shaders::MeshVisualizer shader(Shaders::MeshVisualizer::Flag::Wireframe|Shaders::MeshVisualizer::Flag::BarycentricAttribute);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
 }}}
 
 MAGNUM_GL_TEST_MAIN(Magnum::Shaders::Test::MeshVisualizerGLTest)
@@ -0,0 +1,111 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Buffer.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Shaders/Particle.h"
+#include "Magnum/Shaders/ParticleSystem.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+struct ParticleSystemGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit ParticleSystemGLTest();
+
+    void compileSimulation();
+    void compileParticle();
+    void step();
+};
+
+ParticleSystemGLTest::ParticleSystemGLTest() {
+    addTests({&ParticleSystemGLTest::compileSimulation,
+              &ParticleSystemGLTest::compileParticle,
+              &ParticleSystemGLTest::step});
+}
+
+void ParticleSystemGLTest::compileSimulation() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isVersionSupported(Version::GL300))
+        CORRADE_SKIP("OpenGL 3.0 is not supported.");
+    #endif
+
+    Shaders::ParticleSimulation shader;
+    CORRADE_VERIFY(shader.id());
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void ParticleSystemGLTest::compileParticle() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isVersionSupported(Version::GL300))
+        CORRADE_SKIP("OpenGL 3.0 is not supported.");
+    #endif
+
+    Shaders::Particle shader;
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void ParticleSystemGLTest::step() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::transform_feedback2>())
+        CORRADE_SKIP(Extensions::GL::ARB::transform_feedback2::string() + std::string(" is not supported."));
+    #endif
+
+    Shaders::ParticleSystem particles{{
+        {{1.0f, 2.0f, 3.0f}, {0.0f, 1.0f, 0.0f}, 0.0f, 1.0f, 2}
+    }};
+    particles.setGravity({0.0f, -1.0f, 0.0f});
+    CORRADE_COMPARE(particles.count(), 2);
+
+    particles.step(0.75f);
+    MAGNUM_VERIFY_NO_ERROR();
+
+    struct Vertex {
+        Vector3 position;
+        Vector3 velocity;
+        Vector3 life;
+    };
+    Vertex* data = particles.buffer().map<Vertex>(0, 2*sizeof(Vertex), Buffer::MapFlag::Read);
+    CORRADE_VERIFY(data);
+
+    /* The first particle was alive already, integrated; the second was just
+       emitted */
+    CORRADE_COMPARE(data[0].velocity, (Vector3{0.0f, 0.25f, 0.0f}));
+    CORRADE_COMPARE(data[0].position, (Vector3{1.0f, 2.1875f, 3.0f}));
+    CORRADE_COMPARE(data[0].life, (Vector3{0.75f, 1.0f, 0.0f}));
+    CORRADE_COMPARE(data[1].position, (Vector3{1.0f, 2.0f, 3.0f}));
+    CORRADE_COMPARE(data[1].velocity, (Vector3{0.0f, 1.0f, 0.0f}));
+    CORRADE_COMPARE(data[1].life, (Vector3{0.25f, 1.0f, 0.0f}));
+    particles.buffer().unmap();
+}
+
+}}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Shaders::Test::ParticleSystemGLTest)
@@ -23,7 +23,18 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include "Magnum/Buffer.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
 #include "Magnum/Shaders/Phong.h"
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+#include "Magnum/BufferTexture.h"
+#include "Magnum/BufferTextureFormat.h"
+#include "Magnum/Shaders/LightClusters.h"
+#endif
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/Shaders/ShadowMap.h"
+#endif
 #include "Magnum/Test/AbstractOpenGLTester.h"
 
 namespace Magnum { namespace Shaders { namespace Test {
@@ -39,6 +50,22 @@ struct PhongGLTest: Magnum::Test::AbstractOpenGLTester {
     void compileAmbientSpecularTexture();
     void compileDiffuseSpecularTexture();
     void compileAmbientDiffuseSpecularTexture();
+    void compileOctahedralNormals();
+    #ifndef MAGNUM_TARGET_GLES2
+    void compileUniformBuffers();
+    void compileUniformBuffersTextured();
+    void compileGBuffer();
+    void compileGBufferTextured();
+    void compileShadowMap();
+    void compileSkinning();
+    void compileSkinningOctahedralNormals();
+    #endif
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    void compileClusteredLights();
+    void compileClusteredLightsTextured();
+    void compileVertexPulling();
+    void compileVertexPullingOctahedralNormals();
+    #endif
 };
 
 PhongGLTest::PhongGLTest() {
@@ -49,7 +76,24 @@ PhongGLTest::PhongGLTest() {
               &PhongGLTest::compileAmbientDiffuseTexture,
               &PhongGLTest::compileAmbientSpecularTexture,
               &PhongGLTest::compileDiffuseSpecularTexture,
-              &PhongGLTest::compileAmbientDiffuseSpecularTexture});
+              &PhongGLTest::compileAmbientDiffuseSpecularTexture,
+              &PhongGLTest::compileOctahedralNormals,
+              #ifndef MAGNUM_TARGET_GLES2
+              &PhongGLTest::compileUniformBuffers,
+              &PhongGLTest::compileUniformBuffersTextured,
+              &PhongGLTest::compileGBuffer,
+              &PhongGLTest::compileGBufferTextured,
+              &PhongGLTest::compileShadowMap,
+              &PhongGLTest::compileSkinning,
+              &PhongGLTest::compileSkinningOctahedralNormals,
+              #endif
+              #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+              &PhongGLTest::compileClusteredLights,
+              &PhongGLTest::compileClusteredLightsTextured,
+              &PhongGLTest::compileVertexPulling,
+              &PhongGLTest::compileVertexPullingOctahedralNormals
+              #endif
+              });
 }
 
 void PhongGLTest::compile() {
@@ -132,6 +176,225 @@ void PhongGLTest::compileAmbientDiffuseSpecularTexture() {
     }
 }
 
+void PhongGLTest::compileOctahedralNormals() {
+    Shaders::Phong shader(Shaders::Phong::Flag::OctahedralNormals);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+void PhongGLTest::compileUniformBuffers() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isVersionSupported(Version::GL310))
+        CORRADE_SKIP("OpenGL 3.1 is not supported");
+    #endif
+
+    Shaders::Phong shader(Shaders::Phong::Flag::UniformBuffers);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void PhongGLTest::compileUniformBuffersTextured() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isVersionSupported(Version::GL310))
+        CORRADE_SKIP("OpenGL 3.1 is not supported");
+    #endif
+
+    Shaders::Phong shader(Shaders::Phong::Flag::DiffuseTexture|Shaders::Phong::Flag::UniformBuffers);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+#endif
+
+#ifndef MAGNUM_TARGET_GLES2
+void PhongGLTest::compileGBuffer() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isVersionSupported(Version::GL300))
+        CORRADE_SKIP("OpenGL 3.0 is not supported");
+    #endif
+
+    Shaders::Phong shader(Shaders::Phong::Flag::GBuffer);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void PhongGLTest::compileGBufferTextured() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isVersionSupported(Version::GL300))
+        CORRADE_SKIP("OpenGL 3.0 is not supported");
+    #endif
+
+    Shaders::Phong shader(Shaders::Phong::Flag::DiffuseTexture|Shaders::Phong::Flag::SpecularTexture|Shaders::Phong::Flag::GBuffer);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void PhongGLTest::compileShadowMap() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isVersionSupported(Version::GL300))
+        CORRADE_SKIP("OpenGL 3.0 is not supported");
+    #endif
+
+    Shaders::ShadowMap shadowMap{{64, 64}, 2};
+    shadowMap.update(Matrix4{}, Matrix4::perspectiveProjection(Deg(60.0f), 1.0f, 0.1f, 100.0f));
+
+    Shaders::Phong shader(Shaders::Phong::Flag::ShadowMap);
+    shader.setShadowMap(shadowMap);
+    MAGNUM_VERIFY_NO_ERROR();
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void PhongGLTest::compileSkinning() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isVersionSupported(Version::GL310))
+        CORRADE_SKIP("OpenGL 3.1 is not supported");
+    #endif
+
+    const std::vector<Matrix4> joints(Shaders::Phong::MaxJointCount);
+    Buffer jointBuffer{Buffer::TargetHint::Uniform};
+    jointBuffer.setData(joints, BufferUsage::StaticDraw);
+
+    Shaders::Phong shader(Shaders::Phong::Flag::Skinning);
+    shader.setJointMatrices(jointBuffer);
+    MAGNUM_VERIFY_NO_ERROR();
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void PhongGLTest::compileSkinningOctahedralNormals() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isVersionSupported(Version::GL310))
+        CORRADE_SKIP("OpenGL 3.1 is not supported");
+    #endif
+
+    Shaders::Phong shader(Shaders::Phong::Flag::Skinning|Shaders::Phong::Flag::OctahedralNormals|Shaders::Phong::Flag::DiffuseTexture);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+#endif
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+void PhongGLTest::compileClusteredLights() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isVersionSupported(Version::GL310))
+        CORRADE_SKIP("OpenGL 3.1 is not supported");
+    #else
+    if(!Context::current().isExtensionSupported<Extensions::GL::EXT::texture_buffer>())
+        CORRADE_SKIP(Extensions::GL::EXT::texture_buffer::string() + std::string(" is not supported."));
+    #endif
+
+    LightClusters clusters{{4, 4, 4}};
+    clusters.setLights({{{0.0f, 0.0f, -5.0f}, 2.0f, Color3{1.0f}}})
+        .bin();
+
+    Shaders::Phong shader(Shaders::Phong::Flag::ClusteredLights);
+    shader.setLightClusters(clusters);
+    MAGNUM_VERIFY_NO_ERROR();
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void PhongGLTest::compileClusteredLightsTextured() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isVersionSupported(Version::GL310))
+        CORRADE_SKIP("OpenGL 3.1 is not supported");
+    #else
+    if(!Context::current().isExtensionSupported<Extensions::GL::EXT::texture_buffer>())
+        CORRADE_SKIP(Extensions::GL::EXT::texture_buffer::string() + std::string(" is not supported."));
+    #endif
+
+    Shaders::Phong shader(Shaders::Phong::Flag::DiffuseTexture|Shaders::Phong::Flag::ClusteredLights);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void PhongGLTest::compileVertexPulling() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isVersionSupported(Version::GL310))
+        CORRADE_SKIP("OpenGL 3.1 is not supported");
+    #else
+    if(!Context::current().isExtensionSupported<Extensions::GL::EXT::texture_buffer>())
+        CORRADE_SKIP(Extensions::GL::EXT::texture_buffer::string() + std::string(" is not supported."));
+    #endif
+
+    Buffer buffer;
+    buffer.setData({nullptr, 3*16}, BufferUsage::StaticDraw);
+    BufferTexture positions, normals, textureCoordinates;
+    positions.setBuffer(BufferTextureFormat::RGB32F, buffer);
+    normals.setBuffer(BufferTextureFormat::RGBA16F, buffer);
+    textureCoordinates.setBuffer(BufferTextureFormat::RG16, buffer);
+
+    Shaders::Phong shader(Shaders::Phong::Flag::DiffuseTexture|Shaders::Phong::Flag::VertexPulling);
+    shader.setVertexBuffers(positions, normals, &textureCoordinates);
+    MAGNUM_VERIFY_NO_ERROR();
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+
+void PhongGLTest::compileVertexPullingOctahedralNormals() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isVersionSupported(Version::GL310))
+        CORRADE_SKIP("OpenGL 3.1 is not supported");
+    #else
+    if(!Context::current().isExtensionSupported<Extensions::GL::EXT::texture_buffer>())
+        CORRADE_SKIP(Extensions::GL::EXT::texture_buffer::string() + std::string(" is not supported."));
+    #endif
+
+    Shaders::Phong shader(Shaders::Phong::Flag::OctahedralNormals|Shaders::Phong::Flag::VertexPulling);
+    {
+        #ifdef CORRADE_TARGET_APPLE
+        CORRADE_EXPECT_FAIL("OSX drivers need insane amount of state to validate properly.");
+        #endif
+        CORRADE_VERIFY(shader.validate().first);
+    }
+}
+#endif
+
 }}}
 
 MAGNUM_GL_TEST_MAIN(Magnum::Shaders::Test::PhongGLTest)
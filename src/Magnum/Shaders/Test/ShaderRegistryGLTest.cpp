@@ -0,0 +1,170 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Shaders/Flat.h"
+#include "Magnum/Shaders/Phong.h"
+#include "Magnum/Shaders/ShaderRegistry.h"
+#include "Magnum/Shaders/Vector.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+struct ShaderRegistryGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit ShaderRegistryGLTest();
+
+    void permutations();
+    void permutationsEmpty();
+
+    void get();
+    void getDifferentFlags();
+    void getDifferentType();
+    void getNoFlags();
+    void precompile();
+    void clear();
+};
+
+ShaderRegistryGLTest::ShaderRegistryGLTest() {
+    addTests({&ShaderRegistryGLTest::permutations,
+              &ShaderRegistryGLTest::permutationsEmpty,
+
+              &ShaderRegistryGLTest::get,
+              &ShaderRegistryGLTest::getDifferentFlags,
+              &ShaderRegistryGLTest::getDifferentType,
+              &ShaderRegistryGLTest::getNoFlags,
+              &ShaderRegistryGLTest::precompile,
+              &ShaderRegistryGLTest::clear});
+}
+
+void ShaderRegistryGLTest::permutations() {
+    const std::vector<Phong::Flags> permutations = ShaderRegistry::permutations(Phong::Flag::AmbientTexture|Phong::Flag::SpecularTexture);
+    CORRADE_COMPARE(permutations.size(), 4);
+    CORRADE_VERIFY(permutations[0] == (Phong::Flag::AmbientTexture|Phong::Flag::SpecularTexture));
+    CORRADE_VERIFY(permutations[1] == Phong::Flag::SpecularTexture);
+    CORRADE_VERIFY(permutations[2] == Phong::Flag::AmbientTexture);
+    CORRADE_VERIFY(permutations[3] == Phong::Flags{});
+}
+
+void ShaderRegistryGLTest::permutationsEmpty() {
+    const std::vector<Phong::Flags> permutations = ShaderRegistry::permutations(Phong::Flags{});
+    CORRADE_COMPARE(permutations.size(), 1);
+    CORRADE_VERIFY(permutations[0] == Phong::Flags{});
+}
+
+void ShaderRegistryGLTest::get() {
+    ShaderRegistry registry;
+    CORRADE_VERIFY(registry.isEmpty());
+    CORRADE_VERIFY(!registry.contains<Phong>(Phong::Flag::DiffuseTexture));
+
+    Phong& a = registry.get<Phong>(Phong::Flag::DiffuseTexture);
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(registry.contains<Phong>(Phong::Flag::DiffuseTexture));
+    CORRADE_COMPARE(a.flags(), Phong::Flag::DiffuseTexture);
+
+    /* Second request returns the same instance */
+    Phong& b = registry.get<Phong>(Phong::Flag::DiffuseTexture);
+    CORRADE_COMPARE(&a, &b);
+    CORRADE_COMPARE(registry.size(), 1);
+    CORRADE_COMPARE(registry.created(), 1);
+    CORRADE_COMPARE(registry.reused(), 1);
+}
+
+void ShaderRegistryGLTest::getDifferentFlags() {
+    ShaderRegistry registry;
+
+    Phong& a = registry.get<Phong>(Phong::Flag::DiffuseTexture);
+    Phong& b = registry.get<Phong>(Phong::Flag::AmbientTexture);
+    Phong& c = registry.get<Phong>({});
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(&a != &b);
+    CORRADE_VERIFY(&b != &c);
+    CORRADE_COMPARE(c.flags(), Phong::Flags{});
+    CORRADE_COMPARE(registry.size(), 3);
+    CORRADE_COMPARE(registry.created(), 3);
+    CORRADE_COMPARE(registry.reused(), 0);
+}
+
+void ShaderRegistryGLTest::getDifferentType() {
+    ShaderRegistry registry;
+
+    /* Same flag values, but different types, thus different instances */
+    Flat2D& a = registry.get<Flat2D>(Flat2D::Flag::Textured);
+    Flat3D& b = registry.get<Flat3D>(Flat3D::Flag::Textured);
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(static_cast<AbstractShaderProgram*>(&a) != static_cast<AbstractShaderProgram*>(&b));
+    CORRADE_VERIFY(registry.contains<Flat2D>(Flat2D::Flag::Textured));
+    CORRADE_VERIFY(!registry.contains<Flat2D>({}));
+    CORRADE_COMPARE(registry.size(), 2);
+}
+
+void ShaderRegistryGLTest::getNoFlags() {
+    ShaderRegistry registry;
+    CORRADE_VERIFY(!registry.contains<Vector2D>());
+
+    Vector2D& a = registry.get<Vector2D>();
+    Vector2D& b = registry.get<Vector2D>();
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(&a, &b);
+    CORRADE_VERIFY(registry.contains<Vector2D>());
+    CORRADE_VERIFY(!registry.contains<Vector3D>());
+    CORRADE_COMPARE(registry.created(), 1);
+    CORRADE_COMPARE(registry.reused(), 1);
+}
+
+void ShaderRegistryGLTest::precompile() {
+    ShaderRegistry registry;
+
+    registry.precompile<Phong>(ShaderRegistry::permutations(Phong::Flag::AmbientTexture|Phong::Flag::DiffuseTexture|Phong::Flag::SpecularTexture));
+    registry.precompile<Flat3D>({{}, Flat3D::Flag::Textured});
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(registry.size(), 10);
+    CORRADE_COMPARE(registry.created(), 10);
+    CORRADE_VERIFY(registry.contains<Phong>(Phong::Flag::AmbientTexture|Phong::Flag::SpecularTexture));
+
+    /* Everything is already compiled, nothing new gets created */
+    registry.get<Phong>(Phong::Flag::DiffuseTexture);
+    registry.get<Flat3D>({});
+    CORRADE_COMPARE(registry.created(), 10);
+    CORRADE_COMPARE(registry.reused(), 2);
+}
+
+void ShaderRegistryGLTest::clear() {
+    ShaderRegistry registry;
+    registry.get<Phong>({});
+    registry.get<Vector3D>();
+    CORRADE_COMPARE(registry.size(), 2);
+
+    registry.clear();
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(registry.isEmpty());
+    CORRADE_VERIFY(!registry.contains<Phong>({}));
+
+    /* Requesting again compiles a new instance */
+    registry.get<Phong>({});
+    CORRADE_COMPARE(registry.created(), 3);
+}
+
+}}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Shaders::Test::ShaderRegistryGLTest)
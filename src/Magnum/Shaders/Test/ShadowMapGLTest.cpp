@@ -0,0 +1,124 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Context.h"
+#include "Magnum/Shaders/ShadowMap.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+struct ShadowMapGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit ShadowMapGLTest();
+
+    void splitDistancesUniform();
+    void splitDistancesLogarithmic();
+
+    void construct();
+    void update();
+    void bind();
+};
+
+ShadowMapGLTest::ShadowMapGLTest() {
+    addTests({&ShadowMapGLTest::splitDistancesUniform,
+              &ShadowMapGLTest::splitDistancesLogarithmic,
+
+              &ShadowMapGLTest::construct,
+              &ShadowMapGLTest::update,
+              &ShadowMapGLTest::bind});
+}
+
+void ShadowMapGLTest::splitDistancesUniform() {
+    CORRADE_COMPARE(ShadowMap::splitDistances(1.0f, 100.0f, 4, 0.0f),
+        (std::vector<Float>{1.0f, 25.75f, 50.5f, 75.25f, 100.0f}));
+}
+
+void ShadowMapGLTest::splitDistancesLogarithmic() {
+    CORRADE_COMPARE(ShadowMap::splitDistances(1.0f, 100.0f, 4, 1.0f),
+        (std::vector<Float>{1.0f, 3.16228f, 10.0f, 31.6228f, 100.0f}));
+}
+
+void ShadowMapGLTest::construct() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isVersionSupported(Version::GL300))
+        CORRADE_SKIP("OpenGL 3.0 is not supported");
+    #endif
+
+    ShadowMap shadowMap{{256, 128}, 3};
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(shadowMap.size(), (Vector2i{256, 128}));
+    CORRADE_COMPARE(shadowMap.cascadeCount(), 3);
+    CORRADE_COMPARE(shadowMap.shadowMatrices().size(), 3);
+    CORRADE_COMPARE(shadowMap.lightDirection(), (Vector3{0.0f, -1.0f, 0.0f}));
+
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_COMPARE(shadowMap.texture().imageSize(0), (Vector3i{256, 128, 3}));
+    #endif
+}
+
+void ShadowMapGLTest::update() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isVersionSupported(Version::GL300))
+        CORRADE_SKIP("OpenGL 3.0 is not supported");
+    #endif
+
+    ShadowMap shadowMap{{1024, 1024}, 3};
+    shadowMap.setLightDirection({-1.0f, -2.0f, -0.5f})
+        .setSplitLambda(0.5f)
+        .setCasterDistance(10.0f)
+        .setDepthBias(0.0f);
+
+    const Matrix4 cameraObject = Matrix4::translation({3.0f, 2.0f, 5.0f})*Matrix4::rotationY(Deg(30.0f));
+    const Matrix4 projection = Matrix4::perspectiveProjection(Deg(60.0f), 1.5f, 0.5f, 50.0f);
+    shadowMap.update(cameraObject.invertedRigid(), projection);
+    CORRADE_COMPARE(shadowMap.lightDirection(), (Vector3{-1.0f, -2.0f, -0.5f}).normalized());
+    CORRADE_COMPARE(shadowMap.splitDistance(2), 50.0f);
+
+    /* Points on the view axis and in the frustum corner just before the end
+       of each cascade land inside it */
+    for(UnsignedInt i = 0; i != shadowMap.cascadeCount(); ++i) {
+        const Float z = 0.1f - shadowMap.splitDistance(i);
+        for(const Vector3& point: {Vector3{0.0f, 0.0f, z}, Vector3{-z*0.5f, -z*0.3f, z}}) {
+            const Vector3 shadowPoint = shadowMap.shadowMatrices()[i].transformPoint(point);
+            CORRADE_VERIFY((shadowPoint >= Vector3{0.0f}).all());
+            CORRADE_VERIFY((shadowPoint <= Vector3{1.0f}).all());
+        }
+    }
+}
+
+void ShadowMapGLTest::bind() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isVersionSupported(Version::GL300))
+        CORRADE_SKIP("OpenGL 3.0 is not supported");
+    #endif
+
+    ShadowMap shadowMap{{64, 64}, 2};
+    shadowMap.bind(1);
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(shadowMap.framebuffer().checkStatus(FramebufferTarget::Draw), Framebuffer::Status::Complete);
+}
+
+}}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Shaders::Test::ShadowMapGLTest)
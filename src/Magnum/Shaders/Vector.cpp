@@ -41,7 +41,7 @@ namespace {
     template<> constexpr const char* vertexShaderName<3>() { return "AbstractVector3D.vert"; }
 }
 
-template<UnsignedInt dimensions> Vector<dimensions>::Vector(): transformationProjectionMatrixUniform(0), backgroundColorUniform(1), colorUniform(2) {
+template<UnsignedInt dimensions> Vector<dimensions>::Vector(const typename AbstractVector<dimensions>::Flags flags): AbstractVector<dimensions>{flags}, transformationProjectionMatrixUniform(0), backgroundColorUniform(1), colorUniform(2) {
     #ifdef MAGNUM_BUILD_STATIC
     /* Import resources on static build, if not already */
     if(!Utility::Resource::hasGroup("MagnumShaders"))
@@ -55,12 +55,32 @@ template<UnsignedInt dimensions> Vector<dimensions>::Vector(): transformationPro
     const Version version = Context::current().supportedVersion({Version::GLES300, Version::GLES200});
     #endif
 
+    #ifndef MAGNUM_TARGET_GLES2
+    /* gl_VertexID needs GLSL 1.30 */
+    if(flags & AbstractVector<dimensions>::Flag::InstancedGlyphs) {
+        #ifndef MAGNUM_TARGET_GLES
+        MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GL300);
+        #else
+        MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GLES300);
+        #endif
+    }
+    #endif
+
     Shader vert = Implementation::createCompatibilityShader(rs, version, Shader::Type::Vertex);
     Shader frag = Implementation::createCompatibilityShader(rs, version, Shader::Type::Fragment);
 
-    vert.addSource(rs.get("generic.glsl"))
+    #ifndef MAGNUM_TARGET_GLES2
+    const bool instancedGlyphs = !!(flags & AbstractVector<dimensions>::Flag::InstancedGlyphs);
+    #else
+    static_cast<void>(flags);
+    const bool instancedGlyphs = false;
+    #endif
+
+    vert.addSource(instancedGlyphs ? "#define INSTANCED_GLYPHS\n" : "")
+        .addSource(rs.get("generic.glsl"))
         .addSource(rs.get(vertexShaderName<dimensions>()));
-    frag.addSource(rs.get("Vector.frag"));
+    frag.addSource(instancedGlyphs ? "#define INSTANCED_GLYPHS\n" : "")
+        .addSource(rs.get("Vector.frag"));
 
     CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({vert, frag}));
 
@@ -72,8 +92,14 @@ template<UnsignedInt dimensions> Vector<dimensions>::Vector(): transformationPro
     if(!Context::current().isVersionSupported(Version::GLES300))
     #endif
     {
-        AbstractShaderProgram::bindAttributeLocation(AbstractVector<dimensions>::Position::Location, "position");
-        AbstractShaderProgram::bindAttributeLocation(AbstractVector<dimensions>::TextureCoordinates::Location, "textureCoordinates");
+        if(instancedGlyphs) {
+            AbstractShaderProgram::bindAttributeLocation(AbstractVector<dimensions>::GlyphRectangle::Location, "glyphRectangle");
+            AbstractShaderProgram::bindAttributeLocation(AbstractVector<dimensions>::GlyphTextureRectangle::Location, "glyphTextureRectangle");
+            AbstractShaderProgram::bindAttributeLocation(AbstractVector<dimensions>::GlyphColor::Location, "glyphColor");
+        } else {
+            AbstractShaderProgram::bindAttributeLocation(AbstractVector<dimensions>::Position::Location, "position");
+            AbstractShaderProgram::bindAttributeLocation(AbstractVector<dimensions>::TextureCoordinates::Location, "textureCoordinates");
+        }
     }
 
     CORRADE_INTERNAL_ASSERT_OUTPUT(AbstractShaderProgram::link());
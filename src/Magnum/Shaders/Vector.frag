@@ -46,11 +46,19 @@ uniform lowp sampler2D vectorTexture;
 
 in mediump vec2 fragmentTextureCoordinates;
 
+#ifdef INSTANCED_GLYPHS
+in lowp vec4 interpolatedGlyphColor;
+#endif
+
 #ifdef NEW_GLSL
 out lowp vec4 fragmentColor;
 #endif
 
 void main() {
     lowp float intensity = texture(vectorTexture, fragmentTextureCoordinates).r;
-    fragmentColor = mix(backgroundColor, color, intensity);
+    fragmentColor = mix(backgroundColor,
+        #ifdef INSTANCED_GLYPHS
+        interpolatedGlyphColor*
+        #endif
+        color, intensity);
 }
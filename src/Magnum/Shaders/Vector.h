@@ -46,7 +46,9 @@ for more advanced effects. For rendering unchanged texture you can use the
 @ref Flat shader. You need to provide @ref Position and @ref TextureCoordinates
 attributes in your triangle mesh and call at least
 @ref setTransformationProjectionMatrix(), @ref setColor() and
-@ref setVectorTexture().
+@ref setVectorTexture(). With @ref Flag::InstancedGlyphs the shader draws
+one glyph quad per instance instead, see
+@ref Shaders-AbstractVector-instanced-glyphs "AbstractVector" for details.
 
 @image html shaders-vector.png
 @image latex shaders-vector.png
@@ -87,7 +89,11 @@ mesh.draw(shader);
 */
 template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Vector: public AbstractVector<dimensions> {
     public:
-        Vector();
+        /**
+         * @brief Constructor
+         * @param flags     Flags
+         */
+        explicit Vector(typename AbstractVector<dimensions>::Flags flags = {});
 
         /**
          * @brief Set transformation and projection matrix
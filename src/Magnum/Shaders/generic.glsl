@@ -26,3 +26,9 @@
 #define POSITION_ATTRIBUTE_LOCATION 0
 #define TEXTURECOORDINATES_ATTRIBUTE_LOCATION 1
 #define NORMAL_ATTRIBUTE_LOCATION 2
+#define COLOR_ATTRIBUTE_LOCATION 3
+#define TRANSFORMATION_MATRIX_ATTRIBUTE_LOCATION 4
+#define JOINTIDS_ATTRIBUTE_LOCATION 8
+#define WEIGHTS_ATTRIBUTE_LOCATION 9
+#define GLYPH_RECTANGLE_ATTRIBUTE_LOCATION 10
+#define GLYPH_TEXTURE_RECTANGLE_ATTRIBUTE_LOCATION 11
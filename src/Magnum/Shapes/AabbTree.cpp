@@ -0,0 +1,334 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "AabbTree.h"
+
+#include <algorithm>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Geometry/Intersection.h"
+
+namespace Magnum { namespace Shapes {
+
+namespace {
+
+template<UnsignedInt dimensions> inline Math::Range<dimensions, Float> combine(const Math::Range<dimensions, Float>& a, const Math::Range<dimensions, Float>& b) {
+    return {Math::min(a.min(), b.min()), Math::max(a.max(), b.max())};
+}
+
+template<UnsignedInt dimensions> inline bool overlaps(const Math::Range<dimensions, Float>& a, const Math::Range<dimensions, Float>& b) {
+    return (a.min() <= b.max()).all() && (b.min() <= a.max()).all();
+}
+
+template<UnsignedInt dimensions> inline bool contains(const Math::Range<dimensions, Float>& a, const Math::Range<dimensions, Float>& b) {
+    return (a.min() <= b.min()).all() && (b.max() <= a.max()).all();
+}
+
+/* Surface area in 3D, perimeter in 2D (both halved) */
+template<UnsignedInt dimensions> Float cost(const Math::Range<dimensions, Float>& range) {
+    const auto size = range.size();
+    Float out = 0.0f;
+    for(UnsignedInt i = 0; i != dimensions; ++i) {
+        Float face = 1.0f;
+        for(UnsignedInt j = 0; j != dimensions; ++j)
+            if(j != i) face *= size[j];
+        out += face;
+    }
+    return out;
+}
+
+}
+
+template<UnsignedInt dimensions> AabbTree<dimensions>::AabbTree(const Float margin): _root{Null}, _free{Null}, _leafCount{}, _margin{margin} {}
+
+template<UnsignedInt dimensions> UnsignedInt AabbTree<dimensions>::insert(const Math::Range<dimensions, Float>& bounds) {
+    const UnsignedInt leaf = allocate();
+    _nodes[leaf].bounds = bounds.padded(VectorTypeFor<dimensions, Float>{_margin});
+    _nodes[leaf].height = 0;
+    insertLeaf(leaf);
+    ++_leafCount;
+    return leaf;
+}
+
+template<UnsignedInt dimensions> void AabbTree<dimensions>::remove(const UnsignedInt proxy) {
+    CORRADE_ASSERT(proxy < _nodes.size() && _nodes[proxy].height == 0,
+        "Shapes::AabbTree::remove(): invalid proxy" << proxy, );
+
+    removeLeaf(proxy);
+    release(proxy);
+    --_leafCount;
+}
+
+template<UnsignedInt dimensions> bool AabbTree<dimensions>::update(const UnsignedInt proxy, const Math::Range<dimensions, Float>& bounds) {
+    CORRADE_ASSERT(proxy < _nodes.size() && _nodes[proxy].height == 0,
+        "Shapes::AabbTree::update(): invalid proxy" << proxy, false);
+
+    /* Still inside the enlarged bounds, nothing to do */
+    if(contains(_nodes[proxy].bounds, bounds)) return false;
+
+    removeLeaf(proxy);
+    _nodes[proxy].bounds = bounds.padded(VectorTypeFor<dimensions, Float>{_margin});
+    insertLeaf(proxy);
+    return true;
+}
+
+template<UnsignedInt dimensions> const Math::Range<dimensions, Float>& AabbTree<dimensions>::bounds(const UnsignedInt proxy) const {
+    CORRADE_ASSERT(proxy < _nodes.size() && _nodes[proxy].height == 0,
+        "Shapes::AabbTree::bounds(): invalid proxy" << proxy, _nodes[0].bounds);
+
+    return _nodes[proxy].bounds;
+}
+
+template<UnsignedInt dimensions> std::vector<UnsignedInt> AabbTree<dimensions>::query(const Math::Range<dimensions, Float>& bounds) const {
+    std::vector<UnsignedInt> stack, out;
+    query(bounds, stack, out);
+    return out;
+}
+
+template<UnsignedInt dimensions> void AabbTree<dimensions>::query(const Math::Range<dimensions, Float>& bounds, std::vector<UnsignedInt>& stack, std::vector<UnsignedInt>& out) const {
+    if(_root == Null) return;
+
+    stack.push_back(_root);
+    while(!stack.empty()) {
+        const Node& node = _nodes[stack.back()];
+        const UnsignedInt index = stack.back();
+        stack.pop_back();
+
+        if(!overlaps(node.bounds, bounds)) continue;
+
+        if(node.left == Null) out.push_back(index);
+        else {
+            stack.push_back(node.left);
+            stack.push_back(node.right);
+        }
+    }
+}
+
+template<UnsignedInt dimensions> std::vector<std::pair<UnsignedInt, Float>> AabbTree<dimensions>::raycast(const VectorTypeFor<dimensions, Float>& origin, const VectorTypeFor<dimensions, Float>& direction, const Float maxDistance) const {
+    std::vector<std::pair<UnsignedInt, Float>> out;
+    if(_root == Null) return out;
+
+    std::vector<UnsignedInt> stack{_root};
+    while(!stack.empty()) {
+        const UnsignedInt index = stack.back();
+        const Node& node = _nodes[index];
+        stack.pop_back();
+
+        const Float t = Math::Geometry::Intersection::rayAabb(origin, direction, node.bounds.min(), node.bounds.max());
+        if(t == Constants::inf() || t > maxDistance) continue;
+
+        if(node.left == Null) out.emplace_back(index, t);
+        else {
+            stack.push_back(node.left);
+            stack.push_back(node.right);
+        }
+    }
+
+    std::sort(out.begin(), out.end(), [](const std::pair<UnsignedInt, Float>& a, const std::pair<UnsignedInt, Float>& b) {
+        return a.second < b.second;
+    });
+    return out;
+}
+
+template<UnsignedInt dimensions> std::vector<std::pair<UnsignedInt, UnsignedInt>> AabbTree<dimensions>::pairs() const {
+    std::vector<std::pair<UnsignedInt, UnsignedInt>> out;
+    std::vector<UnsignedInt> stack, candidates;
+    for(UnsignedInt i = 0; i != _nodes.size(); ++i) {
+        if(_nodes[i].height != 0) continue;
+
+        /* Report each pair only from the leaf with lower ID */
+        candidates.clear();
+        query(_nodes[i].bounds, stack, candidates);
+        for(UnsignedInt candidate: candidates)
+            if(candidate > i) out.emplace_back(i, candidate);
+    }
+
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+template<UnsignedInt dimensions> void AabbTree<dimensions>::clear() {
+    _nodes.clear();
+    _root = _free = Null;
+    _leafCount = 0;
+}
+
+template<UnsignedInt dimensions> UnsignedInt AabbTree<dimensions>::allocate() {
+    UnsignedInt node;
+    if(_free != Null) {
+        node = _free;
+        _free = _nodes[node].parent;
+    } else {
+        node = _nodes.size();
+        _nodes.emplace_back();
+    }
+
+    _nodes[node].parent = _nodes[node].left = _nodes[node].right = Null;
+    _nodes[node].height = 0;
+    return node;
+}
+
+template<UnsignedInt dimensions> void AabbTree<dimensions>::release(const UnsignedInt node) {
+    _nodes[node].parent = _free;
+    _nodes[node].height = -1;
+    _free = node;
+}
+
+template<UnsignedInt dimensions> void AabbTree<dimensions>::insertLeaf(const UnsignedInt leaf) {
+    if(_root == Null) {
+        _root = leaf;
+        _nodes[leaf].parent = Null;
+        return;
+    }
+
+    /* Find the best sibling. Going down costs the enlargement of the current
+       node, stopping here costs a new parent enclosing both. */
+    const Math::Range<dimensions, Float> bounds = _nodes[leaf].bounds;
+    UnsignedInt index = _root;
+    while(_nodes[index].left != Null) {
+        const Node& node = _nodes[index];
+        const Float area = cost(node.bounds);
+        const Float combinedArea = cost(combine(node.bounds, bounds));
+        const Float here = 2.0f*combinedArea;
+        const Float inheritance = 2.0f*(combinedArea - area);
+
+        Float childCost[2];
+        const UnsignedInt children[]{node.left, node.right};
+        for(std::size_t i = 0; i != 2; ++i) {
+            const Node& child = _nodes[children[i]];
+            childCost[i] = cost(combine(child.bounds, bounds)) + inheritance;
+            if(child.left != Null) childCost[i] -= cost(child.bounds);
+        }
+
+        if(here < childCost[0] && here < childCost[1]) break;
+
+        index = childCost[0] < childCost[1] ? node.left : node.right;
+    }
+
+    /* Create new parent for the sibling and the leaf. Allocation might
+       reallocate the storage, so no references are held across it. */
+    const UnsignedInt sibling = index;
+    const UnsignedInt oldParent = _nodes[sibling].parent;
+    const UnsignedInt newParent = allocate();
+    _nodes[newParent].parent = oldParent;
+    _nodes[newParent].bounds = combine(bounds, _nodes[sibling].bounds);
+    _nodes[newParent].height = _nodes[sibling].height + 1;
+    _nodes[newParent].left = sibling;
+    _nodes[newParent].right = leaf;
+    _nodes[sibling].parent = newParent;
+    _nodes[leaf].parent = newParent;
+
+    if(oldParent == Null) _root = newParent;
+    else if(_nodes[oldParent].left == sibling) _nodes[oldParent].left = newParent;
+    else _nodes[oldParent].right = newParent;
+
+    refit(newParent);
+}
+
+template<UnsignedInt dimensions> void AabbTree<dimensions>::removeLeaf(const UnsignedInt leaf) {
+    if(leaf == _root) {
+        _root = Null;
+        return;
+    }
+
+    /* Replace the parent with the sibling */
+    const UnsignedInt parent = _nodes[leaf].parent;
+    const UnsignedInt grandParent = _nodes[parent].parent;
+    const UnsignedInt sibling = _nodes[parent].left == leaf ? _nodes[parent].right : _nodes[parent].left;
+
+    _nodes[sibling].parent = grandParent;
+    release(parent);
+
+    if(grandParent == Null) {
+        _root = sibling;
+        return;
+    }
+
+    if(_nodes[grandParent].left == parent) _nodes[grandParent].left = sibling;
+    else _nodes[grandParent].right = sibling;
+
+    refit(grandParent);
+}
+
+template<UnsignedInt dimensions> void AabbTree<dimensions>::refit(UnsignedInt index) {
+    /* Walk back to the root, rebalancing and fixing bounds and heights */
+    while(index != Null) {
+        index = balance(index);
+
+        Node& node = _nodes[index];
+        node.height = 1 + std::max(_nodes[node.left].height, _nodes[node.right].height);
+        node.bounds = combine(_nodes[node.left].bounds, _nodes[node.right].bounds);
+        index = node.parent;
+    }
+}
+
+template<UnsignedInt dimensions> UnsignedInt AabbTree<dimensions>::balance(const UnsignedInt a) {
+    Node& nodeA = _nodes[a];
+    if(nodeA.left == Null || nodeA.height < 2) return a;
+
+    const UnsignedInt b = nodeA.left;
+    const UnsignedInt c = nodeA.right;
+    const Int difference = _nodes[c].height - _nodes[b].height;
+    if(difference >= -1 && difference <= 1) return a;
+
+    /* Rotate the higher child up, in place of A. The higher grandchild stays
+       under it, the lower one gets moved under A. */
+    const bool rightUp = difference > 1;
+    const UnsignedInt up = rightUp ? c : b;
+    const UnsignedInt other = rightUp ? b : c;
+    Node& nodeUp = _nodes[up];
+
+    nodeUp.parent = nodeA.parent;
+    nodeA.parent = up;
+    if(nodeUp.parent == Null) _root = up;
+    else if(_nodes[nodeUp.parent].left == a) _nodes[nodeUp.parent].left = up;
+    else _nodes[nodeUp.parent].right = up;
+
+    const UnsignedInt f = nodeUp.left;
+    const UnsignedInt g = nodeUp.right;
+    const UnsignedInt higher = _nodes[f].height > _nodes[g].height ? f : g;
+    const UnsignedInt lower = higher == f ? g : f;
+
+    nodeUp.left = a;
+    nodeUp.right = higher;
+    if(rightUp) nodeA.right = lower;
+    else nodeA.left = lower;
+    _nodes[lower].parent = a;
+
+    nodeA.bounds = combine(_nodes[other].bounds, _nodes[lower].bounds);
+    nodeA.height = 1 + std::max(_nodes[other].height, _nodes[lower].height);
+    nodeUp.bounds = combine(nodeA.bounds, _nodes[higher].bounds);
+    nodeUp.height = 1 + std::max(nodeA.height, _nodes[higher].height);
+
+    return up;
+}
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+template class MAGNUM_SHAPES_EXPORT AabbTree<2>;
+template class MAGNUM_SHAPES_EXPORT AabbTree<3>;
+#endif
+
+}}
@@ -0,0 +1,190 @@
+#ifndef Magnum_Shapes_AabbTree_h
+#define Magnum_Shapes_AabbTree_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Shapes::AabbTree, typedef @ref Magnum::Shapes::AabbTree2D, @ref Magnum::Shapes::AabbTree3D
+ */
+
+#include <utility>
+#include <vector>
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Shapes/visibility.h"
+
+namespace Magnum { namespace Shapes {
+
+/**
+@brief Dynamic axis-aligned bounding box tree
+
+Broad-phase acceleration structure used by @ref ShapeGroup. Each inserted
+bounding box is enlarged by @ref margin() on every side and stored in a leaf of
+a balanced binary tree, internal nodes hold union of bounds of their children.
+Insertion descends to the sibling with the least increase of surface area (or
+perimeter in 2D), the tree is rebalanced with rotations on the way back up, so
+its height stays logarithmic in leaf count.
+
+Small movements that stay inside the enlarged bounds don't touch the tree at
+all, see @ref update(). Querying for overlaps with @ref query() or
+@ref pairs() is then @f$ \mathcal{O}(\log n) @f$ per result instead of
+testing against all other leaves.
+@see @ref AabbTree2D, @ref AabbTree3D
+*/
+template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AabbTree {
+    public:
+        enum: UnsignedInt {
+            Dimensions = dimensions,    /**< Dimension count */
+            Null = ~UnsignedInt{}       /**< Invalid proxy ID */
+        };
+
+        /**
+         * @brief Constructor
+         * @param margin    Amount by which the stored bounds are enlarged on
+         *      each side
+         */
+        explicit AabbTree(Float margin = 0.1f);
+
+        /** @brief Margin */
+        Float margin() const { return _margin; }
+
+        /** @brief Count of leaves in the tree */
+        std::size_t size() const { return _leafCount; }
+
+        /** @brief Whether the tree is empty */
+        bool isEmpty() const { return _root == Null; }
+
+        /**
+         * @brief Tree height
+         *
+         * Returns `0` for empty tree and `1` for tree with just one leaf.
+         */
+        UnsignedInt height() const {
+            return _root == Null ? 0 : _nodes[_root].height + 1;
+        }
+
+        /**
+         * @brief Insert bounding box
+         * @return Proxy ID identifying the leaf
+         *
+         * The ID stays the same until the leaf is removed with @ref remove(),
+         * after that it may be reused for another leaf.
+         */
+        UnsignedInt insert(const Math::Range<dimensions, Float>& bounds);
+
+        /** @brief Remove leaf with given proxy ID */
+        void remove(UnsignedInt proxy);
+
+        /**
+         * @brief Update bounding box of given leaf
+         * @return `True` if the leaf was reinserted, `false` if the new
+         *      bounds still fit into the enlarged ones
+         */
+        bool update(UnsignedInt proxy, const Math::Range<dimensions, Float>& bounds);
+
+        /**
+         * @brief Enlarged bounding box of given leaf
+         *
+         * @see @ref margin()
+         */
+        const Math::Range<dimensions, Float>& bounds(UnsignedInt proxy) const;
+
+        /**
+         * @brief Leaves overlapping given range
+         *
+         * Returns proxy IDs of all leaves whose enlarged bounds overlap given
+         * range, in unspecified order.
+         */
+        std::vector<UnsignedInt> query(const Math::Range<dimensions, Float>& bounds) const;
+
+        /**
+         * @brief Leaves intersected by a ray
+         * @param origin        Ray origin
+         * @param direction     Ray direction
+         * @param maxDistance   Maximal position on the ray
+         *
+         * Returns proxy IDs of all leaves whose enlarged bounds are
+         * intersected by the ray `origin + t*direction` for
+         * @f$ t \in [ 0 ; maxDistance ] @f$, each together with the position
+         * `t` at which the ray enters the bounds, sorted by the position.
+         * @see @ref Math::Geometry::Intersection::rayAabb()
+         */
+        std::vector<std::pair<UnsignedInt, Float>> raycast(const VectorTypeFor<dimensions, Float>& origin, const VectorTypeFor<dimensions, Float>& direction, Float maxDistance) const;
+
+        /**
+         * @brief Pairs of overlapping leaves
+         *
+         * Returns each pair of leaves with overlapping enlarged bounds exactly
+         * once, with lower proxy ID first, sorted.
+         */
+        std::vector<std::pair<UnsignedInt, UnsignedInt>> pairs() const;
+
+        /** @brief Remove all leaves */
+        void clear();
+
+    private:
+        struct Node {
+            Math::Range<dimensions, Float> bounds;
+            /* Next node in the free list for unused nodes */
+            UnsignedInt parent;
+            /* Both are Null for leaves */
+            UnsignedInt left, right;
+            /* 0 for leaves, -1 for unused nodes */
+            Int height;
+        };
+
+        MAGNUM_SHAPES_LOCAL UnsignedInt allocate();
+        MAGNUM_SHAPES_LOCAL void release(UnsignedInt node);
+        MAGNUM_SHAPES_LOCAL void insertLeaf(UnsignedInt leaf);
+        MAGNUM_SHAPES_LOCAL void removeLeaf(UnsignedInt leaf);
+        MAGNUM_SHAPES_LOCAL void refit(UnsignedInt node);
+        MAGNUM_SHAPES_LOCAL UnsignedInt balance(UnsignedInt node);
+        MAGNUM_SHAPES_LOCAL void query(const Math::Range<dimensions, Float>& bounds, std::vector<UnsignedInt>& stack, std::vector<UnsignedInt>& out) const;
+
+        std::vector<Node> _nodes;
+        UnsignedInt _root, _free;
+        std::size_t _leafCount;
+        Float _margin;
+};
+
+/**
+@brief Two-dimensional AABB tree
+
+@see @ref AabbTree3D
+*/
+typedef AabbTree<2> AabbTree2D;
+
+/**
+@brief Three-dimensional AABB tree
+
+@see @ref AabbTree2D
+*/
+typedef AabbTree<3> AabbTree3D;
+
+}}
+
+#endif
@@ -57,6 +57,7 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AbstractShape: publi
     /* Otherwise it complains that this is not a function */
     template<UnsignedInt dimensions_> friend const Implementation::AbstractShape<dimensions_>& Implementation::getAbstractShape(const Shapes::AbstractShape<dimensions_>&);
     #endif
+    friend ShapeGroup<dimensions>;
 
     public:
         enum: UnsignedInt {
@@ -84,9 +85,18 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AbstractShape: publi
          * @brief Constructor
          * @param object    Object holding this feature
          * @param group     Group this shape belongs to
+         *
+         * Marks the group as dirty.
          */
         explicit AbstractShape(SceneGraph::AbstractObject<dimensions, Float>& object, ShapeGroup<dimensions>* group = nullptr);
 
+        /**
+         * @brief Destructor
+         *
+         * Marks the group as dirty.
+         */
+        ~AbstractShape();
+
         /**
          * @brief Shape group containing this shape
          *
@@ -113,11 +123,16 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AbstractShape: publi
         Collision<dimensions> collision(const AbstractShape<dimensions>& other) const;
 
     protected:
-        /** Marks also the group as dirty */
+        /**
+         * Marks also the group as dirty and schedules update of the shape
+         * bounds in group broad phase
+         */
         void markDirty() override;
 
     private:
         virtual const Implementation::AbstractShape<dimensions> MAGNUM_SHAPES_LOCAL & abstractTransformedShape() const = 0;
+
+        bool _boundsDirty;
 };
 
 /** @brief Base class for two-dimensional object shapes */
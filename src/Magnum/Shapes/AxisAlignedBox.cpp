@@ -25,6 +25,9 @@
 
 #include "AxisAlignedBox.h"
 
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/Shapes/Point.h"
@@ -41,6 +44,45 @@ template<UnsignedInt dimensions> bool AxisAlignedBox<dimensions>::operator%(cons
            (other.position() < _max).all();
 }
 
+template<UnsignedInt dimensions> bool AxisAlignedBox<dimensions>::operator%(const AxisAlignedBox<dimensions>& other) const {
+    return (_min < other._max).all() && (other._min < _max).all();
+}
+
+template<UnsignedInt dimensions> Collision<dimensions> AxisAlignedBox<dimensions>::operator/(const AxisAlignedBox<dimensions>& other) const {
+    /* Find axis along which this box needs to be moved the least to separate
+       it from the other, in either direction */
+    Float separationDistance = Constants::inf();
+    std::size_t axis = 0;
+    Float direction = 1.0f;
+    for(std::size_t i = 0; i != dimensions; ++i) {
+        const Float positive = other._max[i] - _min[i];
+        const Float negative = _max[i] - other._min[i];
+
+        /* No collision occured */
+        if(positive <= 0.0f || negative <= 0.0f) return {};
+
+        if(positive < separationDistance) {
+            separationDistance = positive;
+            axis = i;
+            direction = 1.0f;
+        }
+        if(negative < separationDistance) {
+            separationDistance = negative;
+            axis = i;
+            direction = -1.0f;
+        }
+    }
+
+    /* Contact position is in the center of the overlap, moved onto the
+       surface of `other` */
+    VectorTypeFor<dimensions, Float> position = (Math::max(_min, other._min) + Math::min(_max, other._max))*0.5f;
+    position[axis] = direction > 0.0f ? other._max[axis] : other._min[axis];
+
+    VectorTypeFor<dimensions, Float> separationNormal;
+    separationNormal[axis] = direction;
+    return Collision<dimensions>(position, separationNormal, separationDistance);
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template class MAGNUM_SHAPES_EXPORT AxisAlignedBox<2>;
 template class MAGNUM_SHAPES_EXPORT AxisAlignedBox<3>;
@@ -31,6 +31,7 @@
 
 #include "Magnum/DimensionTraits.h"
 #include "Magnum/Math/Vector3.h"
+#include "Magnum/Shapes/Collision.h"
 #include "Magnum/Shapes/Shapes.h"
 #include "Magnum/Shapes/visibility.h"
 
@@ -85,6 +86,18 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AxisAlignedBox {
         /** @brief Collision occurence with point */
         bool operator%(const Point<dimensions>& other) const;
 
+        /** @brief Collision occurence with axis-aligned box */
+        bool operator%(const AxisAlignedBox<dimensions>& other) const;
+
+        /**
+         * @brief Collision with axis-aligned box
+         *
+         * The separation normal is along the axis with the smallest
+         * penetration, contact position is in the center of the overlapping
+         * area on the surface of @p other.
+         */
+        Collision<dimensions> operator/(const AxisAlignedBox<dimensions>& other) const;
+
     private:
         VectorTypeFor<dimensions, Float> _min, _max;
 };
@@ -0,0 +1,280 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BatchCollision.h"
+
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Shapes/AxisAlignedBox.h"
+#include "Magnum/Shapes/Collision.h"
+#include "Magnum/Shapes/Point.h"
+#include "Magnum/Shapes/Sphere.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace Magnum { namespace Shapes {
+
+namespace {
+
+template<class T, class U, UnsignedInt dimensions> void collisionsScalar(const Containers::ArrayView<const T> a, const Containers::ArrayView<const U> b, const Containers::ArrayView<Collision<dimensions>> out, std::size_t i) {
+    for(; i != out.size(); ++i) out[i] = a[i]/b[i];
+}
+
+#ifdef __SSE2__
+/* The kernels load four pairs into structure-of-arrays registers, one
+   register per component, and compute the collision in the same order of
+   operations as the scalar code, so the results are identical. The output is
+   written per lane only for pairs that collide. */
+
+static_assert(sizeof(Sphere3D) == 4*sizeof(Float), "unexpected sphere layout");
+static_assert(sizeof(Point3D) == 3*sizeof(Float), "unexpected point layout");
+static_assert(sizeof(AxisAlignedBox3D) == 6*sizeof(Float), "unexpected box layout");
+
+/* Position and radius of four spheres */
+inline void loadSpheres(const Sphere3D* const spheres, __m128& x, __m128& y, __m128& z, __m128& r) {
+    const Float* const data = reinterpret_cast<const Float*>(spheres);
+    x = _mm_loadu_ps(data);
+    y = _mm_loadu_ps(data + 4);
+    z = _mm_loadu_ps(data + 8);
+    r = _mm_loadu_ps(data + 12);
+    _MM_TRANSPOSE4_PS(x, y, z, r);
+}
+
+/* Three consecutive components of four items `stride` floats apart */
+inline void loadVectors(const Float* const data, const std::size_t stride, __m128& x, __m128& y, __m128& z) {
+    x = _mm_setr_ps(data[0], data[stride], data[2*stride], data[3*stride]);
+    y = _mm_setr_ps(data[1], data[stride + 1], data[2*stride + 1], data[3*stride + 1]);
+    z = _mm_setr_ps(data[2], data[stride + 2], data[2*stride + 2], data[3*stride + 2]);
+}
+
+inline __m128 select(const __m128 mask, const __m128 a, const __m128 b) {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+/* Normalized separating vector or Y axis if it is too short, same as in
+   Sphere::operator/() */
+inline void separatingNormal(const __m128 dot, const __m128 distance, __m128& x, __m128& y, __m128& z) {
+    const __m128 zero = _mm_cmplt_ps(dot, _mm_set1_ps(Math::TypeTraits<Float>::epsilon()));
+    x = _mm_andnot_ps(zero, _mm_div_ps(x, distance));
+    y = select(zero, _mm_set1_ps(1.0f), _mm_div_ps(y, distance));
+    z = _mm_andnot_ps(zero, _mm_div_ps(z, distance));
+}
+
+inline __m128 dotSelf(const __m128 x, const __m128 y, const __m128 z) {
+    return _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+}
+
+struct Lanes {
+    alignas(16) Float position[3][4];
+    alignas(16) Float normal[3][4];
+    alignas(16) Float distance[4];
+
+    void store(const __m128 px, const __m128 py, const __m128 pz, const __m128 nx, const __m128 ny, const __m128 nz, const __m128 d) {
+        _mm_store_ps(position[0], px);
+        _mm_store_ps(position[1], py);
+        _mm_store_ps(position[2], pz);
+        _mm_store_ps(normal[0], nx);
+        _mm_store_ps(normal[1], ny);
+        _mm_store_ps(normal[2], nz);
+        _mm_store_ps(distance, d);
+    }
+
+    void write(const Int mask, Collision3D* const out) const {
+        for(std::size_t i = 0; i != 4; ++i) out[i] = (mask & (1 << i)) ?
+            Collision3D{{position[0][i], position[1][i], position[2][i]},
+                        {normal[0][i], normal[1][i], normal[2][i]}, distance[i]} :
+            Collision3D{};
+    }
+};
+#endif
+
+}
+
+void collisions(const Containers::ArrayView<const Sphere3D> a, const Containers::ArrayView<const Sphere3D> b, const Containers::ArrayView<Collision3D> out) {
+    CORRADE_ASSERT(a.size() == out.size() && b.size() == out.size(),
+        "Shapes::collisions(): expected the same size of all views but got" << a.size() << Debug::nospace << "," << b.size() << "and" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef __SSE2__
+    Lanes lanes;
+    for(; i + 4 <= out.size(); i += 4) {
+        __m128 ax, ay, az, ar, bx, by, bz, br;
+        loadSpheres(a + i, ax, ay, az, ar);
+        loadSpheres(b + i, bx, by, bz, br);
+
+        const __m128 minDistance = _mm_add_ps(ar, br);
+        __m128 x = _mm_sub_ps(ax, bx);
+        __m128 y = _mm_sub_ps(ay, by);
+        __m128 z = _mm_sub_ps(az, bz);
+        const __m128 dot = dotSelf(x, y, z);
+
+        /* Early out if none of the pairs collides */
+        const Int mask = _mm_movemask_ps(_mm_cmpngt_ps(dot, _mm_mul_ps(minDistance, minDistance)));
+        if(!mask) {
+            for(std::size_t j = 0; j != 4; ++j) out[i + j] = {};
+            continue;
+        }
+
+        const __m128 distance = _mm_sqrt_ps(dot);
+        separatingNormal(dot, distance, x, y, z);
+
+        /* Contact position is on the surface of `b` */
+        lanes.store(_mm_add_ps(bx, _mm_mul_ps(x, br)),
+                    _mm_add_ps(by, _mm_mul_ps(y, br)),
+                    _mm_add_ps(bz, _mm_mul_ps(z, br)),
+                    x, y, z, _mm_sub_ps(minDistance, distance));
+        lanes.write(mask, out + i);
+    }
+    #endif
+
+    collisionsScalar(a, b, out, i);
+}
+
+void collisions(const Containers::ArrayView<const Sphere2D> a, const Containers::ArrayView<const Sphere2D> b, const Containers::ArrayView<Collision2D> out) {
+    CORRADE_ASSERT(a.size() == out.size() && b.size() == out.size(),
+        "Shapes::collisions(): expected the same size of all views but got" << a.size() << Debug::nospace << "," << b.size() << "and" << out.size(), );
+
+    collisionsScalar(a, b, out, 0);
+}
+
+void collisions(const Containers::ArrayView<const Sphere3D> a, const Containers::ArrayView<const Point3D> b, const Containers::ArrayView<Collision3D> out) {
+    CORRADE_ASSERT(a.size() == out.size() && b.size() == out.size(),
+        "Shapes::collisions(): expected the same size of all views but got" << a.size() << Debug::nospace << "," << b.size() << "and" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef __SSE2__
+    Lanes lanes;
+    for(; i + 4 <= out.size(); i += 4) {
+        __m128 ax, ay, az, ar, bx, by, bz;
+        loadSpheres(a + i, ax, ay, az, ar);
+        loadVectors(reinterpret_cast<const Float*>(b + i), 3, bx, by, bz);
+
+        __m128 x = _mm_sub_ps(ax, bx);
+        __m128 y = _mm_sub_ps(ay, by);
+        __m128 z = _mm_sub_ps(az, bz);
+        const __m128 dot = dotSelf(x, y, z);
+
+        /* Early out if none of the pairs collides */
+        const Int mask = _mm_movemask_ps(_mm_cmpngt_ps(dot, _mm_mul_ps(ar, ar)));
+        if(!mask) {
+            for(std::size_t j = 0; j != 4; ++j) out[i + j] = {};
+            continue;
+        }
+
+        const __m128 distance = _mm_sqrt_ps(dot);
+        separatingNormal(dot, distance, x, y, z);
+
+        /* Contact position is on the point */
+        lanes.store(bx, by, bz, x, y, z, _mm_sub_ps(ar, distance));
+        lanes.write(mask, out + i);
+    }
+    #endif
+
+    collisionsScalar(a, b, out, i);
+}
+
+void collisions(const Containers::ArrayView<const Sphere2D> a, const Containers::ArrayView<const Point2D> b, const Containers::ArrayView<Collision2D> out) {
+    CORRADE_ASSERT(a.size() == out.size() && b.size() == out.size(),
+        "Shapes::collisions(): expected the same size of all views but got" << a.size() << Debug::nospace << "," << b.size() << "and" << out.size(), );
+
+    collisionsScalar(a, b, out, 0);
+}
+
+void collisions(const Containers::ArrayView<const AxisAlignedBox3D> a, const Containers::ArrayView<const AxisAlignedBox3D> b, const Containers::ArrayView<Collision3D> out) {
+    CORRADE_ASSERT(a.size() == out.size() && b.size() == out.size(),
+        "Shapes::collisions(): expected the same size of all views but got" << a.size() << Debug::nospace << "," << b.size() << "and" << out.size(), );
+
+    std::size_t i = 0;
+    #ifdef __SSE2__
+    Lanes lanes;
+    const __m128 zero = _mm_setzero_ps();
+    for(; i + 4 <= out.size(); i += 4) {
+        const Float* const aData = reinterpret_cast<const Float*>(a + i);
+        const Float* const bData = reinterpret_cast<const Float*>(b + i);
+        __m128 aMin[3], aMax[3], bMin[3], bMax[3];
+        loadVectors(aData, 6, aMin[0], aMin[1], aMin[2]);
+        loadVectors(aData + 3, 6, aMax[0], aMax[1], aMax[2]);
+        loadVectors(bData, 6, bMin[0], bMin[1], bMin[2]);
+        loadVectors(bData + 3, 6, bMax[0], bMax[1], bMax[2]);
+
+        /* Find the axis with least movement needed for separation, the same
+           way as AxisAlignedBox::operator/() */
+        __m128 collides = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        __m128 distance = _mm_set1_ps(Constants::inf());
+        __m128 normal[3]{zero, zero, zero};
+        __m128 position[3];
+        for(std::size_t axis = 0; axis != 3; ++axis) {
+            const __m128 positive = _mm_sub_ps(bMax[axis], aMin[axis]);
+            const __m128 negative = _mm_sub_ps(aMax[axis], bMin[axis]);
+            collides = _mm_and_ps(collides, _mm_and_ps(_mm_cmpgt_ps(positive, zero), _mm_cmpgt_ps(negative, zero)));
+
+            const __m128 positiveLess = _mm_cmplt_ps(positive, distance);
+            distance = select(positiveLess, positive, distance);
+            const __m128 negativeLess = _mm_cmplt_ps(negative, distance);
+            distance = select(negativeLess, negative, distance);
+
+            /* The normal has only one nonzero component, reset the others if
+               this axis wins */
+            const __m128 selected = _mm_or_ps(positiveLess, negativeLess);
+            const __m128 direction = select(negativeLess, _mm_set1_ps(-1.0f), _mm_set1_ps(1.0f));
+            for(std::size_t j = 0; j != 3; ++j)
+                normal[j] = j == axis ? select(selected, direction, normal[j]) : _mm_andnot_ps(selected, normal[j]);
+
+            position[axis] = _mm_mul_ps(_mm_add_ps(_mm_max_ps(aMin[axis], bMin[axis]), _mm_min_ps(aMax[axis], bMax[axis])), _mm_set1_ps(0.5f));
+        }
+
+        /* Early out if none of the pairs collides */
+        const Int mask = _mm_movemask_ps(collides);
+        if(!mask) {
+            for(std::size_t j = 0; j != 4; ++j) out[i + j] = {};
+            continue;
+        }
+
+        /* Contact position is moved onto the surface of `b` along the normal */
+        for(std::size_t axis = 0; axis != 3; ++axis) {
+            const __m128 onAxis = _mm_cmpneq_ps(normal[axis], zero);
+            const __m128 surface = select(_mm_cmpgt_ps(normal[axis], zero), bMax[axis], bMin[axis]);
+            position[axis] = select(onAxis, surface, position[axis]);
+        }
+
+        lanes.store(position[0], position[1], position[2], normal[0], normal[1], normal[2], distance);
+        lanes.write(mask, out + i);
+    }
+    #endif
+
+    collisionsScalar(a, b, out, i);
+}
+
+void collisions(const Containers::ArrayView<const AxisAlignedBox2D> a, const Containers::ArrayView<const AxisAlignedBox2D> b, const Containers::ArrayView<Collision2D> out) {
+    CORRADE_ASSERT(a.size() == out.size() && b.size() == out.size(),
+        "Shapes::collisions(): expected the same size of all views but got" << a.size() << Debug::nospace << "," << b.size() << "and" << out.size(), );
+
+    collisionsScalar(a, b, out, 0);
+}
+
+}}
@@ -0,0 +1,83 @@
+#ifndef Magnum_Shapes_BatchCollision_h
+#define Magnum_Shapes_BatchCollision_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Shapes::collisions()
+ */
+
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Shapes/Shapes.h"
+#include "Magnum/Shapes/visibility.h"
+
+namespace Magnum { namespace Shapes {
+
+/**
+@brief Batch collision of sphere pairs
+
+Equivalent to calling `out[i] = a[i]/b[i]` for all items, see
+@ref Sphere::operator/(const Sphere<dimensions>&) const. The shapes are plain
+value types, so the data can be filled directly from physics state without
+creating any @ref Shape features. All views are expected to have the same
+size. On SSE2-enabled targets the 3D variant processes four pairs at once.
+@see @ref ShapeGroup::collisionCandidates()
+*/
+MAGNUM_SHAPES_EXPORT void collisions(Containers::ArrayView<const Sphere3D> a, Containers::ArrayView<const Sphere3D> b, Containers::ArrayView<Collision3D> out);
+
+/** @overload */
+MAGNUM_SHAPES_EXPORT void collisions(Containers::ArrayView<const Sphere2D> a, Containers::ArrayView<const Sphere2D> b, Containers::ArrayView<Collision2D> out);
+
+/**
+@brief Batch collision of sphere and point pairs
+
+Equivalent to calling `out[i] = a[i]/b[i]` for all items, see
+@ref Sphere::operator/(const Point<dimensions>&) const and
+@ref collisions(Containers::ArrayView<const Sphere3D>, Containers::ArrayView<const Sphere3D>, Containers::ArrayView<Collision3D>)
+for more information.
+*/
+MAGNUM_SHAPES_EXPORT void collisions(Containers::ArrayView<const Sphere3D> a, Containers::ArrayView<const Point3D> b, Containers::ArrayView<Collision3D> out);
+
+/** @overload */
+MAGNUM_SHAPES_EXPORT void collisions(Containers::ArrayView<const Sphere2D> a, Containers::ArrayView<const Point2D> b, Containers::ArrayView<Collision2D> out);
+
+/**
+@brief Batch collision of axis-aligned box pairs
+
+Equivalent to calling `out[i] = a[i]/b[i]` for all items, see
+@ref AxisAlignedBox::operator/(const AxisAlignedBox<dimensions>&) const and
+@ref collisions(Containers::ArrayView<const Sphere3D>, Containers::ArrayView<const Sphere3D>, Containers::ArrayView<Collision3D>)
+for more information.
+*/
+MAGNUM_SHAPES_EXPORT void collisions(Containers::ArrayView<const AxisAlignedBox3D> a, Containers::ArrayView<const AxisAlignedBox3D> b, Containers::ArrayView<Collision3D> out);
+
+/** @overload */
+MAGNUM_SHAPES_EXPORT void collisions(Containers::ArrayView<const AxisAlignedBox2D> a, Containers::ArrayView<const AxisAlignedBox2D> b, Containers::ArrayView<Collision2D> out);
+
+}}
+
+#endif
@@ -28,6 +28,14 @@
 #include <algorithm>
 #include <Corrade/Utility/Assert.h>
 
+#include "Magnum/Shapes/AxisAlignedBox.h"
+#include "Magnum/Shapes/Box.h"
+#include "Magnum/Shapes/Capsule.h"
+#include "Magnum/Shapes/Cylinder.h"
+#include "Magnum/Shapes/LineSegment.h"
+#include "Magnum/Shapes/Plane.h"
+#include "Magnum/Shapes/Point.h"
+#include "Magnum/Shapes/Sphere.h"
 #include "Magnum/Shapes/Implementation/CollisionDispatch.h"
 
 namespace Magnum { namespace Shapes {
@@ -58,16 +66,92 @@ Shapes are merged together by concatenating its node and shape list and adding
 new node at the beginning with properly set `rightNode` and `rightShape`.
 Because these values are relative to parent, they don't need to be modified
 when concatenating.
+
+The tree is then compiled into a flat program for a single-accumulator
+machine, so collision queries are a loop without recursion. Leaf nodes set the
+accumulator to collision result with given shape, NOT negates it and AND/OR
+evaluate the left child followed by a conditional jump over the right child,
+which preserves the short-circuit evaluation:
+
+    AND(a, OR(b, NOT(c)))   ->  0: collides a
+                                1: jump to 6 if false
+                                2: collides b
+                                3: jump to 6 if true
+                                4: collides c
+                                5: not
+
+Besides that, shape indices are sorted by type so the transformation is done
+in runs of shapes of the same type without any virtual calls.
 */
 
+namespace {
+
+template<class T> void transformRun(const MatrixTypeFor<T::Dimensions, Float>& matrix, Implementation::AbstractShape<T::Dimensions>* const* in, Implementation::AbstractShape<T::Dimensions>* const* out, const UnsignedInt* begin, const UnsignedInt* const end) {
+    for(; begin != end; ++begin)
+        static_cast<Implementation::Shape<T>*>(out[*begin])->shape = static_cast<const Implementation::Shape<T>*>(in[*begin])->shape.transformed(matrix);
+}
+
+template<UnsignedInt dimensions> void transformRun(typename Implementation::ShapeDimensionTraits<dimensions>::Type type, const MatrixTypeFor<dimensions, Float>& matrix, Implementation::AbstractShape<dimensions>* const* in, Implementation::AbstractShape<dimensions>* const* out, const UnsignedInt* begin, const UnsignedInt* end);
+
+template<> void transformRun<2>(const Implementation::ShapeDimensionTraits<2>::Type type, const Matrix3& matrix, Implementation::AbstractShape<2>* const* in, Implementation::AbstractShape<2>* const* out, const UnsignedInt* const begin, const UnsignedInt* const end) {
+    switch(type) {
+        #define _c(type, class) \
+            case Implementation::ShapeDimensionTraits<2>::Type::type: \
+                transformRun<class>(matrix, in, out, begin, end); \
+                return;
+        _c(Point, Point2D)
+        _c(Line, Line2D)
+        _c(LineSegment, LineSegment2D)
+        _c(Sphere, Sphere2D)
+        _c(InvertedSphere, InvertedSphere2D)
+        _c(Cylinder, Cylinder2D)
+        _c(Capsule, Capsule2D)
+        _c(AxisAlignedBox, AxisAlignedBox2D)
+        _c(Box, Box2D)
+        #undef _c
+        case Implementation::ShapeDimensionTraits<2>::Type::Composition: break;
+    }
+
+    CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+template<> void transformRun<3>(const Implementation::ShapeDimensionTraits<3>::Type type, const Matrix4& matrix, Implementation::AbstractShape<3>* const* in, Implementation::AbstractShape<3>* const* out, const UnsignedInt* const begin, const UnsignedInt* const end) {
+    switch(type) {
+        #define _c(type, class) \
+            case Implementation::ShapeDimensionTraits<3>::Type::type: \
+                transformRun<class>(matrix, in, out, begin, end); \
+                return;
+        _c(Point, Point3D)
+        _c(Line, Line3D)
+        _c(LineSegment, LineSegment3D)
+        _c(Sphere, Sphere3D)
+        _c(InvertedSphere, InvertedSphere3D)
+        _c(Cylinder, Cylinder3D)
+        _c(Capsule, Capsule3D)
+        _c(AxisAlignedBox, AxisAlignedBox3D)
+        _c(Box, Box3D)
+        _c(Plane, Plane)
+        #undef _c
+        case Implementation::ShapeDimensionTraits<3>::Type::Composition: break;
+    }
+
+    CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+}
+
 template<UnsignedInt dimensions> Composition<dimensions>::Composition(const Composition<dimensions>& other): _shapes(other._shapes.size()), _nodes(other._nodes.size()) {
     copyShapes(0, other);
     copyNodes(0, other);
+    compile();
 }
 
-template<UnsignedInt dimensions> Composition<dimensions>::Composition(Composition<dimensions>&& other): _shapes(std::move(other._shapes)), _nodes(std::move(other._nodes)) {
+template<UnsignedInt dimensions> Composition<dimensions>::Composition(Composition<dimensions>&& other): _shapes(std::move(other._shapes)), _nodes(std::move(other._nodes)), _program(std::move(other._program)), _order(std::move(other._order)), _runs(std::move(other._runs)) {
     other._shapes = nullptr;
     other._nodes = nullptr;
+    other._program = nullptr;
+    other._order = nullptr;
+    other._runs = nullptr;
 }
 
 template<UnsignedInt dimensions> Composition<dimensions>::~Composition() {
@@ -87,6 +171,7 @@ template<UnsignedInt dimensions> Composition<dimensions>& Composition<dimensions
 
     copyShapes(0, other);
     copyNodes(0, other);
+    compile();
     return *this;
 }
 
@@ -94,6 +179,9 @@ template<UnsignedInt dimensions> Composition<dimensions>& Composition<dimensions
     using std::swap;
     swap(other._shapes, _shapes);
     swap(other._nodes, _nodes);
+    swap(other._program, _program);
+    swap(other._order, _order);
+    swap(other._runs, _runs);
     return *this;
 }
 
@@ -114,38 +202,108 @@ template<UnsignedInt dimensions> void Composition<dimensions>::copyNodes(std::si
     std::copy(other._nodes.begin(), other._nodes.end(), _nodes.begin()+offset);
 }
 
-template<UnsignedInt dimensions> Composition<dimensions> Composition<dimensions>::transformed(const MatrixTypeFor<dimensions, Float>& matrix) const {
-    Composition<dimensions> out(*this);
-    for(Implementation::AbstractShape<dimensions> * const* i = _shapes.begin(), * const* o = out._shapes.begin(); i != _shapes.end(); ++i, ++o)
-        (*i)->transform(matrix, *o);
-    return out;
+template<UnsignedInt dimensions> void Composition<dimensions>::compile() {
+    /* Flatten the operation tree */
+    std::vector<Instruction> program;
+    if(!_shapes.empty()) compile(program, 0, 0, _shapes.size());
+    _program = Containers::Array<Instruction>(program.size());
+    std::copy(program.begin(), program.end(), _program.begin());
+
+    /* Sort shapes by type, preserving the original order for the same type */
+    std::vector<std::pair<Type, UnsignedInt>> types;
+    types.reserve(_shapes.size());
+    for(std::size_t i = 0; i != _shapes.size(); ++i)
+        types.emplace_back(_shapes[i]->type(), i);
+    std::sort(types.begin(), types.end());
+
+    _order = Containers::Array<UnsignedInt>(types.size());
+    std::vector<Run> runs;
+    for(std::size_t i = 0; i != types.size(); ++i) {
+        _order[i] = types[i].second;
+        if(i + 1 == types.size() || types[i + 1].first != types[i].first)
+            runs.push_back({types[i].first, UnsignedInt(i + 1)});
+    }
+    _runs = Containers::Array<Run>(runs.size());
+    std::copy(runs.begin(), runs.end(), _runs.begin());
 }
 
-template<UnsignedInt dimensions> bool Composition<dimensions>::collides(const Implementation::AbstractShape<dimensions>& a, const std::size_t node, const std::size_t shapeBegin, const std::size_t shapeEnd) const {
+template<UnsignedInt dimensions> void Composition<dimensions>::compile(std::vector<Instruction>& program, const std::size_t node, const std::size_t shapeBegin, const std::size_t shapeEnd) const {
     /* Empty group */
-    if(shapeBegin == shapeEnd) return false;
+    if(shapeBegin == shapeEnd) {
+        program.push_back({Opcode::False, 0});
+        return;
+    }
 
     CORRADE_INTERNAL_ASSERT(node < _nodes.size() && shapeBegin < shapeEnd);
 
-    /* Collision on the left child. If the node is leaf one (no left child
-       exists), do it directly, recurse instead. */
-    const bool collidesLeft = (_nodes[node].rightNode == 0 || _nodes[node].rightNode == 2) ?
-        Implementation::collides(a, *_shapes[shapeBegin]) :
-        collides(a, node+1, shapeBegin, shapeBegin+_nodes[node].rightShape);
+    /* Left child. If the node is leaf one (no left child exists), test the
+       shape directly, recurse instead. */
+    if(_nodes[node].rightNode == 0 || _nodes[node].rightNode == 2)
+        program.push_back({Opcode::Collides, UnsignedInt(shapeBegin)});
+    else compile(program, node+1, shapeBegin, shapeBegin+_nodes[node].rightShape);
 
     /* NOT operation */
-    if(_nodes[node].operation == CompositionOperation::Not)
-        return !collidesLeft;
-
-    /* Short-circuit evaluation for AND/OR */
-    if((_nodes[node].operation == CompositionOperation::Or) == collidesLeft)
-        return collidesLeft;
-
-    /* Now the collision result depends only on the right child. Similar to
-       collision on the left child. */
-    return (_nodes[node].rightNode < 2) ?
-        Implementation::collides(a, *_shapes[shapeBegin+_nodes[node].rightShape]) :
-        collides(a, node+_nodes[node].rightNode-1, shapeBegin+_nodes[node].rightShape, shapeEnd);
+    if(_nodes[node].operation == CompositionOperation::Not) {
+        program.push_back({Opcode::Not, 0});
+        return;
+    }
+
+    /* Short-circuit evaluation for AND/OR, the target is filled after the
+       right child is compiled */
+    const std::size_t jump = program.size();
+    program.push_back({_nodes[node].operation == CompositionOperation::Or ? Opcode::JumpIfTrue : Opcode::JumpIfFalse, 0});
+
+    /* Right child, similarly to the left one */
+    if(_nodes[node].rightNode < 2)
+        program.push_back({Opcode::Collides, UnsignedInt(shapeBegin+_nodes[node].rightShape)});
+    else compile(program, node+_nodes[node].rightNode-1, shapeBegin+_nodes[node].rightShape, shapeEnd);
+
+    program[jump].argument = program.size();
+}
+
+template<UnsignedInt dimensions> Composition<dimensions> Composition<dimensions>::transformed(const MatrixTypeFor<dimensions, Float>& matrix) const {
+    Composition<dimensions> out(*this);
+    transformInto(matrix, out);
+    return out;
+}
+
+template<UnsignedInt dimensions> void Composition<dimensions>::transformInto(const MatrixTypeFor<dimensions, Float>& matrix, Composition<dimensions>& out) const {
+    CORRADE_INTERNAL_ASSERT(out._shapes.size() == _shapes.size());
+
+    UnsignedInt begin = 0;
+    for(const Run& run: _runs) {
+        transformRun<dimensions>(run.type, matrix, _shapes.begin(), out._shapes.begin(), _order.begin() + begin, _order.begin() + run.end);
+        begin = run.end;
+    }
+}
+
+template<UnsignedInt dimensions> bool Composition<dimensions>::collides(const Implementation::AbstractShape<dimensions>& a) const {
+    bool result = false;
+    for(std::size_t i = 0; i != _program.size(); ) {
+        const Instruction& instruction = _program[i];
+        switch(instruction.opcode) {
+            case Opcode::Collides:
+                result = Implementation::collides(a, *_shapes[instruction.argument]);
+                ++i;
+                break;
+            case Opcode::False:
+                result = false;
+                ++i;
+                break;
+            case Opcode::Not:
+                result = !result;
+                ++i;
+                break;
+            case Opcode::JumpIfFalse:
+                i = result ? i + 1 : instruction.argument;
+                break;
+            case Opcode::JumpIfTrue:
+                i = result ? instruction.argument : i + 1;
+                break;
+        }
+    }
+
+    return result;
 }
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -31,6 +31,7 @@
 
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Utility/Assert.h>
 
@@ -41,6 +42,13 @@
 
 namespace Magnum { namespace Shapes {
 
+/** @brief Shape operation */
+enum class CompositionOperation: UnsignedByte {
+    Not,    /**< Boolean NOT */
+    And,    /**< Boolean AND */
+    Or      /**< Boolean OR */
+};
+
 namespace Implementation {
     template<class> struct ShapeHelper;
 
@@ -50,15 +58,18 @@ namespace Implementation {
     template<UnsignedInt dimensions> inline const AbstractShape<dimensions>& getAbstractShape(const Composition<dimensions>& group, std::size_t i) {
         return *group._shapes[i];
     }
+    template<UnsignedInt dimensions> inline bool hasNegation(const Composition<dimensions>& group) {
+        for(std::size_t i = 0; i != group._nodes.size(); ++i)
+            if(group._nodes[i].operation == CompositionOperation::Not) return true;
+        return false;
+    }
+    template<UnsignedInt dimensions> inline bool isUnion(const Composition<dimensions>& group) {
+        for(std::size_t i = 0; i != group._nodes.size(); ++i)
+            if(group._nodes[i].operation != CompositionOperation::Or) return false;
+        return true;
+    }
 }
 
-/** @brief Shape operation */
-enum class CompositionOperation: UnsignedByte {
-    Not,    /**< Boolean NOT */
-    And,    /**< Boolean AND */
-    Or      /**< Boolean OR */
-};
-
 /**
 @brief Composition of shapes
 
@@ -67,6 +78,8 @@ Result of logical operations on shapes. See @ref shapes for brief introduction.
 template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT Composition {
     friend Implementation::AbstractShape<dimensions>& Implementation::getAbstractShape<>(Composition<dimensions>&, std::size_t);
     friend const Implementation::AbstractShape<dimensions>& Implementation::getAbstractShape<>(const Composition<dimensions>&, std::size_t);
+    friend bool Implementation::hasNegation<>(const Composition<dimensions>&);
+    friend bool Implementation::isUnion<>(const Composition<dimensions>&);
     friend Implementation::ShapeHelper<Composition<dimensions>>;
 
     public:
@@ -155,11 +168,31 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT Composition {
             CompositionOperation operation;
         };
 
-        bool collides(const Implementation::AbstractShape<dimensions>& a) const {
-            return collides(a, 0, 0, _shapes.size());
-        }
+        /* Flattened operation tree, evaluated in a loop instead of recursion */
+        enum class Opcode: UnsignedByte {
+            Collides,       /* result = collision with shape `argument` */
+            False,          /* result = false */
+            Not,            /* result = !result */
+            JumpIfFalse,    /* continue at `argument` if result is false */
+            JumpIfTrue      /* continue at `argument` if result is true */
+        };
+
+        struct Instruction {
+            Opcode opcode;
+            UnsignedInt argument;
+        };
+
+        /* Shapes of the same type in a contiguous range of _order */
+        struct Run {
+            Type type;
+            UnsignedInt end;
+        };
+
+        bool collides(const Implementation::AbstractShape<dimensions>& a) const;
 
-        bool collides(const Implementation::AbstractShape<dimensions>& a, std::size_t node, std::size_t shapeBegin, std::size_t shapeEnd) const;
+        void compile();
+        void MAGNUM_SHAPES_LOCAL compile(std::vector<Instruction>& program, std::size_t node, std::size_t shapeBegin, std::size_t shapeEnd) const;
+        void transformInto(const MatrixTypeFor<dimensions, Float>& matrix, Composition<dimensions>& out) const;
 
         template<class T> constexpr static std::size_t shapeCount(const T&) {
             return 1;
@@ -185,6 +218,10 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT Composition {
 
         Containers::Array<Implementation::AbstractShape<dimensions>*> _shapes;
         Containers::Array<Node> _nodes;
+        Containers::Array<Instruction> _program;
+        /* Shape indices sorted by type, split into runs */
+        Containers::Array<UnsignedInt> _order;
+        Containers::Array<Run> _runs;
 };
 
 /** @brief Two-dimensional shape composition */
@@ -266,6 +303,7 @@ template<UnsignedInt dimensions> template<class T> Composition<dimensions>::Comp
     _nodes[0].rightShape = shapeCount(a);
     copyNodes(1, a);
     copyShapes(0, std::forward<T>(a));
+    compile();
 }
 
 template<UnsignedInt dimensions> template<class T, class U> Composition<dimensions>::Composition(CompositionOperation operation, T&& a, U&& b): _shapes(shapeCount(a) + shapeCount(b)), _nodes(nodeCount(a) + nodeCount(b) + 1) {
@@ -285,6 +323,7 @@ template<UnsignedInt dimensions> template<class T, class U> Composition<dimensio
     copyNodes(nodeCount(a) + 1, b);
     copyShapes(shapeCount(a), std::forward<U>(b));
     copyShapes(0, std::forward<T>(a));
+    compile();
 }
 
 template<UnsignedInt dimensions> template<class T> inline const T& Composition<dimensions>::get(std::size_t i) const {
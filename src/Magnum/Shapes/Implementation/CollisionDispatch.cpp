@@ -25,9 +25,13 @@
 
 #include "CollisionDispatch.h"
 
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Math/Geometry/Intersection.h"
 #include "Magnum/Shapes/AxisAlignedBox.h"
 #include "Magnum/Shapes/Box.h"
 #include "Magnum/Shapes/Capsule.h"
+#include "Magnum/Shapes/Composition.h"
 #include "Magnum/Shapes/Cylinder.h"
 #include "Magnum/Shapes/LineSegment.h"
 #include "Magnum/Shapes/Plane.h"
@@ -59,6 +63,7 @@ template<> bool collides(const AbstractShape<2>& a, const AbstractShape<2>& b) {
         _c(Capsule, Capsule2D, Sphere, Sphere2D)
 
         _c(AxisAlignedBox, AxisAlignedBox2D, Point, Point2D)
+        _c(AxisAlignedBox, AxisAlignedBox2D, AxisAlignedBox, AxisAlignedBox2D)
         #undef _c
     }
 
@@ -74,6 +79,7 @@ template<> Collision<2> collision(const AbstractShape<2>& a, const AbstractShape
                 return static_cast<const Shape<aClass>&>(a).shape / static_cast<const Shape<bClass>&>(b).shape;
         _c(Sphere, Sphere2D, Point, Point2D)
         _c(Sphere, Sphere2D, Sphere, Sphere2D)
+        _c(AxisAlignedBox, AxisAlignedBox2D, AxisAlignedBox, AxisAlignedBox2D)
         #undef _c
     }
 
@@ -102,6 +108,7 @@ template<> bool collides(const AbstractShape<3>& a, const AbstractShape<3>& b) {
         _c(Capsule, Capsule3D, Sphere, Sphere3D)
 
         _c(AxisAlignedBox, AxisAlignedBox3D, Point, Point3D)
+        _c(AxisAlignedBox, AxisAlignedBox3D, AxisAlignedBox, AxisAlignedBox3D)
 
         _c(Plane, Plane, Line, Line3D)
         _c(Plane, Plane, LineSegment, LineSegment3D)
@@ -120,10 +127,130 @@ template<> Collision<3> collision(const AbstractShape<3>& a, const AbstractShape
                 return static_cast<const Shape<aClass>&>(a).shape / static_cast<const Shape<bClass>&>(b).shape;
         _c(Sphere, Sphere3D, Point, Point3D)
         _c(Sphere, Sphere3D, Sphere, Sphere3D)
+        _c(AxisAlignedBox, AxisAlignedBox3D, AxisAlignedBox, AxisAlignedBox3D)
         #undef _c
     }
 
     return {};
 }
 
+template<UnsignedInt dimensions> bool bounds(const AbstractShape<dimensions>& shape, Math::Range<dimensions, Float>& out) {
+    typedef typename ShapeDimensionTraits<dimensions>::Type Type;
+
+    switch(shape.type()) {
+        case Type::Point: {
+            const auto& point = static_cast<const Shape<Point<dimensions>>&>(shape).shape;
+            out = {point.position(), point.position()};
+            return true;
+        }
+
+        case Type::LineSegment: {
+            const auto& segment = static_cast<const Shape<LineSegment<dimensions>>&>(shape).shape;
+            out = {Math::min(segment.a(), segment.b()), Math::max(segment.a(), segment.b())};
+            return true;
+        }
+
+        case Type::Sphere: {
+            const auto& sphere = static_cast<const Shape<Sphere<dimensions>>&>(shape).shape;
+            out = {sphere.position() - VectorTypeFor<dimensions, Float>{sphere.radius()},
+                   sphere.position() + VectorTypeFor<dimensions, Float>{sphere.radius()}};
+            return true;
+        }
+
+        case Type::Capsule: {
+            const auto& capsule = static_cast<const Shape<Capsule<dimensions>>&>(shape).shape;
+            out = {Math::min(capsule.a(), capsule.b()) - VectorTypeFor<dimensions, Float>{capsule.radius()},
+                   Math::max(capsule.a(), capsule.b()) + VectorTypeFor<dimensions, Float>{capsule.radius()}};
+            return true;
+        }
+
+        case Type::AxisAlignedBox: {
+            /* Negative scaling might have swapped the corners */
+            const auto& box = static_cast<const Shape<AxisAlignedBox<dimensions>>&>(shape).shape;
+            out = {Math::min(box.min(), box.max()), Math::max(box.min(), box.max())};
+            return true;
+        }
+
+        case Type::Box: {
+            /* Half extent in each axis is the sum of absolute values of the
+               projected (unit-size) basis vectors */
+            const MatrixTypeFor<dimensions, Float> transformation = static_cast<const Shape<Box<dimensions>>&>(shape).shape.transformation();
+            VectorTypeFor<dimensions, Float> extent;
+            for(UnsignedInt i = 0; i != dimensions; ++i)
+                extent += Math::abs(VectorTypeFor<dimensions, Float>::pad(transformation[i]));
+            const VectorTypeFor<dimensions, Float> center = VectorTypeFor<dimensions, Float>::pad(transformation[dimensions]);
+            out = {center - extent, center + extent};
+            return true;
+        }
+
+        case Type::Composition: {
+            /* Negation collides with everything outside of the shape, for the
+               other operations the union of all subshapes is conservative */
+            const auto& composition = static_cast<const Shape<Composition<dimensions>>&>(shape).shape;
+            if(hasNegation(composition)) return false;
+
+            for(std::size_t i = 0; i != composition.size(); ++i) {
+                Math::Range<dimensions, Float> subshape;
+                if(!bounds(getAbstractShape(composition, i), subshape)) return false;
+                out = i ? Math::Range<dimensions, Float>{Math::min(out.min(), subshape.min()), Math::max(out.max(), subshape.max())} : subshape;
+            }
+            return true;
+        }
+
+        default: return false;
+    }
+}
+
+template MAGNUM_SHAPES_EXPORT bool bounds(const AbstractShape<2>&, Math::Range<2, Float>&);
+template MAGNUM_SHAPES_EXPORT bool bounds(const AbstractShape<3>&, Math::Range<3, Float>&);
+
+template<UnsignedInt dimensions> Float raycast(const AbstractShape<dimensions>& shape, const VectorTypeFor<dimensions, Float>& origin, const VectorTypeFor<dimensions, Float>& direction) {
+    typedef typename ShapeDimensionTraits<dimensions>::Type Type;
+
+    switch(shape.type()) {
+        case Type::Sphere: {
+            const auto& sphere = static_cast<const Shape<Sphere<dimensions>>&>(shape).shape;
+            return Math::Geometry::Intersection::raySphere(origin, direction, sphere.position(), sphere.radius());
+        }
+
+        case Type::Capsule: {
+            const auto& capsule = static_cast<const Shape<Capsule<dimensions>>&>(shape).shape;
+            return Math::Geometry::Intersection::rayCapsule(origin, direction, capsule.a(), capsule.b(), capsule.radius());
+        }
+
+        case Type::AxisAlignedBox: {
+            /* Negative scaling might have swapped the corners */
+            const auto& box = static_cast<const Shape<AxisAlignedBox<dimensions>>&>(shape).shape;
+            return Math::Geometry::Intersection::rayAabb(origin, direction, Math::min(box.min(), box.max()), Math::max(box.min(), box.max()));
+        }
+
+        case Type::Box: {
+            /* Affine transformation preserves the position on the ray, so
+               it's enough to intersect the ray in box local coordinates
+               with an unit cube */
+            const MatrixTypeFor<dimensions, Float> inverted = static_cast<const Shape<Box<dimensions>>&>(shape).shape.transformation().inverted();
+            return Math::Geometry::Intersection::rayAabb(
+                inverted.transformPoint(origin), inverted.transformVector(direction),
+                VectorTypeFor<dimensions, Float>{-1.0f}, VectorTypeFor<dimensions, Float>{1.0f});
+        }
+
+        case Type::Composition: {
+            /* Nearest intersection of union is the nearest intersection of
+               any subshape, AND and NOT would need clipping of the ray */
+            const auto& composition = static_cast<const Shape<Composition<dimensions>>&>(shape).shape;
+            if(!isUnion(composition)) return Constants::inf();
+
+            Float t = Constants::inf();
+            for(std::size_t i = 0; i != composition.size(); ++i)
+                t = Math::min(t, raycast(getAbstractShape(composition, i), origin, direction));
+            return t;
+        }
+
+        default: return Constants::inf();
+    }
+}
+
+template MAGNUM_SHAPES_EXPORT Float raycast(const AbstractShape<2>&, const Vector2&, const Vector2&);
+template MAGNUM_SHAPES_EXPORT Float raycast(const AbstractShape<3>&, const Vector3&, const Vector3&);
+
 }}}
@@ -25,8 +25,11 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include "Magnum/DimensionTraits.h"
 #include "Magnum/Types.h"
+#include "Magnum/Math/Math.h"
 #include "Magnum/Shapes/Shapes.h"
+#include "Magnum/Shapes/visibility.h"
 
 namespace Magnum { namespace Shapes { namespace Implementation {
 
@@ -46,6 +49,25 @@ template<UnsignedInt dimensions> bool collides(const AbstractShape<dimensions>&
 
 template<UnsignedInt dimensions> Collision<dimensions> collision(const AbstractShape<dimensions>& a, const AbstractShape<dimensions>& b);
 
+/*
+Axis-aligned bounds of a shape, used by the broad phase in ShapeGroup. Returns
+false if the shape is unbounded (lines, cylinders, planes, inverted spheres or
+compositions with negation), in which case it has to be tested against all
+other shapes.
+*/
+
+template<UnsignedInt dimensions> MAGNUM_SHAPES_EXPORT bool bounds(const AbstractShape<dimensions>& shape, Math::Range<dimensions, Float>& out);
+
+/*
+Ray intersection with a shape, used by ShapeGroup::raycast(). Returns position
+of the intersection on the ray (0 if the ray starts inside) or infinity if
+there is no intersection. Only spheres, capsules, boxes and compositions
+consisting only of OR operations can be hit, the other shapes either have no
+volume or are unbounded.
+*/
+
+template<UnsignedInt dimensions> MAGNUM_SHAPES_EXPORT Float raycast(const AbstractShape<dimensions>& shape, const VectorTypeFor<dimensions, Float>& origin, const VectorTypeFor<dimensions, Float>& direction);
+
 }}}
 
 #endif
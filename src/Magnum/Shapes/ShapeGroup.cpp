@@ -25,7 +25,14 @@
 
 #include "ShapeGroup.h"
 
+#include <algorithm>
+#include <functional>
+
+#include "Magnum/Math/Range.h"
 #include "Magnum/Shapes/AbstractShape.h"
+#include "Magnum/Shapes/Sphere.h"
+#include "Magnum/Shapes/shapeImplementation.h"
+#include "Magnum/Shapes/Implementation/CollisionDispatch.h"
 
 namespace Magnum { namespace Shapes {
 
@@ -40,18 +47,264 @@ template<UnsignedInt dimensions> void ShapeGroup<dimensions>::setClean() {
         SceneGraph::AbstractObject<dimensions, Float>::setClean(objects);
     }
 
+    updateBroadPhase();
     dirty = false;
 }
 
+template<UnsignedInt dimensions> void ShapeGroup<dimensions>::updateBroadPhase() {
+    ++_generation;
+    _unbounded.clear();
+
+    for(std::size_t i = 0; i != this->size(); ++i) {
+        AbstractShape<dimensions>& shape = (*this)[i];
+
+        auto found = _entries.find(&shape);
+        const bool added = found == _entries.end();
+        if(added) found = _entries.emplace(&shape, BroadPhaseEntry{AabbTree<dimensions>::Null, 0, 0, 0}).first;
+
+        BroadPhaseEntry& entry = found->second;
+        entry.index = i;
+        entry.generation = _generation;
+
+        /* Update bounds only of new or changed shapes */
+        if(added || shape._boundsDirty) {
+            Math::Range<dimensions, Float> bounds;
+            if(!Implementation::bounds(shape.abstractTransformedShape(), bounds)) {
+                if(entry.proxy != AabbTree<dimensions>::Null) {
+                    _tree.remove(entry.proxy);
+                    entry.proxy = AabbTree<dimensions>::Null;
+                }
+            } else if(entry.proxy == AabbTree<dimensions>::Null) {
+                entry.proxy = _tree.insert(bounds);
+                if(_proxyIndices.size() <= entry.proxy)
+                    _proxyIndices.resize(entry.proxy + 1);
+            } else _tree.update(entry.proxy, bounds);
+
+            shape._boundsDirty = false;
+            entry.changed = _generation;
+        }
+
+        if(entry.proxy == AabbTree<dimensions>::Null) _unbounded.push_back(i);
+        else _proxyIndices[entry.proxy] = i;
+    }
+
+    /* Remove shapes which are no longer in the group */
+    if(_entries.size() == this->size()) return;
+    for(auto it = _entries.begin(); it != _entries.end(); ) {
+        if(it->second.generation == _generation) {
+            ++it;
+            continue;
+        }
+
+        if(it->second.proxy != AabbTree<dimensions>::Null)
+            _tree.remove(it->second.proxy);
+        it = _entries.erase(it);
+    }
+}
+
+template<UnsignedInt dimensions> std::vector<std::pair<UnsignedInt, UnsignedInt>> ShapeGroup<dimensions>::candidateIndices() const {
+    std::vector<std::pair<UnsignedInt, UnsignedInt>> out;
+    for(const std::pair<UnsignedInt, UnsignedInt>& pair: _tree.pairs())
+        out.emplace_back(std::minmax(_proxyIndices[pair.first], _proxyIndices[pair.second]));
+
+    /* Unbounded shapes are paired with everything, pairs of two unbounded
+       shapes are added only once */
+    std::vector<bool> isUnbounded(this->size());
+    for(UnsignedInt unbounded: _unbounded) isUnbounded[unbounded] = true;
+    for(UnsignedInt unbounded: _unbounded)
+        for(UnsignedInt i = 0; i != this->size(); ++i)
+            if(!isUnbounded[i] || i < unbounded)
+                out.emplace_back(std::minmax(i, unbounded));
+
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+template<UnsignedInt dimensions> std::vector<UnsignedInt> ShapeGroup<dimensions>::candidateIndices(const Math::Range<dimensions, Float>& bounds) const {
+    std::vector<UnsignedInt> out = _unbounded;
+    for(UnsignedInt proxy: _tree.query(bounds))
+        out.push_back(_proxyIndices[proxy]);
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
 template<UnsignedInt dimensions> AbstractShape<dimensions>* ShapeGroup<dimensions>::firstCollision(const AbstractShape<dimensions>& shape) {
-    setClean();
-    for(std::size_t i = 0; i != this->size(); ++i)
+    if(dirty) setClean();
+
+    /* Unbounded shape, test against everything */
+    Math::Range<dimensions, Float> bounds;
+    if(!Implementation::bounds(shape.abstractTransformedShape(), bounds)) {
+        for(std::size_t i = 0; i != this->size(); ++i)
+            if(&(*this)[i] != &shape && (*this)[i].collides(shape))
+                return &(*this)[i];
+
+        return nullptr;
+    }
+
+    /* Test only shapes with overlapping bounds, in the group order */
+    for(UnsignedInt i: candidateIndices(bounds))
         if(&(*this)[i] != &shape && (*this)[i].collides(shape))
             return &(*this)[i];
 
     return nullptr;
 }
 
+template<UnsignedInt dimensions> auto ShapeGroup<dimensions>::collisionCandidates() -> std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>> {
+    if(dirty) setClean();
+
+    std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>> out;
+    for(const std::pair<UnsignedInt, UnsignedInt>& pair: candidateIndices())
+        out.emplace_back(&(*this)[pair.first], &(*this)[pair.second]);
+    return out;
+}
+
+template<UnsignedInt dimensions> auto ShapeGroup<dimensions>::collisions() -> std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>> {
+    if(dirty) setClean();
+
+    std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>> out;
+    for(const std::pair<UnsignedInt, UnsignedInt>& pair: candidateIndices())
+        if((*this)[pair.first].collides((*this)[pair.second]))
+            out.emplace_back(&(*this)[pair.first], &(*this)[pair.second]);
+    return out;
+}
+
+template<UnsignedInt dimensions> auto ShapeGroup<dimensions>::raycast(const VectorTypeFor<dimensions, Float>& origin, const VectorTypeFor<dimensions, Float>& direction, const Float maxDistance) -> std::vector<RaycastHit> {
+    if(dirty) setClean();
+
+    /* Candidates in the group order, so the stable sort below orders hits at
+       the same distance by it */
+    std::vector<UnsignedInt> candidates = _unbounded;
+    for(const std::pair<UnsignedInt, Float>& proxy: _tree.raycast(origin, direction, maxDistance))
+        candidates.push_back(_proxyIndices[proxy.first]);
+    std::sort(candidates.begin(), candidates.end());
+
+    std::vector<RaycastHit> out;
+    for(UnsignedInt i: candidates) {
+        AbstractShape<dimensions>& shape = (*this)[i];
+        const Float t = Implementation::raycast(shape.abstractTransformedShape(), origin, direction);
+        if(t != Constants::inf() && t <= maxDistance)
+            out.push_back({&shape, &shape.object(), t});
+    }
+
+    std::stable_sort(out.begin(), out.end(), [](const RaycastHit& a, const RaycastHit& b) {
+        return a.distance < b.distance;
+    });
+    return out;
+}
+
+template<UnsignedInt dimensions> auto ShapeGroup<dimensions>::firstHit(const VectorTypeFor<dimensions, Float>& origin, const VectorTypeFor<dimensions, Float>& direction, const Float maxDistance) -> RaycastHit {
+    if(dirty) setClean();
+
+    /* Hits at the same distance are ordered by position in the group */
+    RaycastHit hit{nullptr, nullptr, maxDistance};
+    UnsignedInt hitIndex{};
+    const auto test = [&](const UnsignedInt i) {
+        AbstractShape<dimensions>& shape = (*this)[i];
+        const Float t = Implementation::raycast(shape.abstractTransformedShape(), origin, direction);
+        if(t == Constants::inf() || t > hit.distance || (hit.shape && t == hit.distance && i > hitIndex)) return;
+
+        hit = {&shape, &shape.object(), t};
+        hitIndex = i;
+    };
+
+    for(UnsignedInt i: _unbounded) test(i);
+
+    /* Leaves are sorted by the distance at which the ray enters their
+       bounds, no shape further than that can be hit before the current
+       nearest one */
+    for(const std::pair<UnsignedInt, Float>& proxy: _tree.raycast(origin, direction, maxDistance)) {
+        if(proxy.second > hit.distance) break;
+        test(_proxyIndices[proxy.first]);
+    }
+
+    if(!hit.shape) hit.distance = Constants::inf();
+    return hit;
+}
+
+template<UnsignedInt dimensions> std::vector<AbstractShape<dimensions>*> ShapeGroup<dimensions>::sphereQuery(const VectorTypeFor<dimensions, Float>& center, const Float radius) {
+    if(dirty) setClean();
+
+    const Implementation::Shape<Sphere<dimensions>> sphere{Sphere<dimensions>{center, radius}};
+    const Math::Range<dimensions, Float> bounds{center - VectorTypeFor<dimensions, Float>{radius}, center + VectorTypeFor<dimensions, Float>{radius}};
+
+    std::vector<AbstractShape<dimensions>*> out;
+    for(UnsignedInt i: candidateIndices(bounds))
+        if(Implementation::collides((*this)[i].abstractTransformedShape(), sphere))
+            out.push_back(&(*this)[i]);
+    return out;
+}
+
+template<UnsignedInt dimensions> auto ShapeGroup<dimensions>::updateContacts() -> const std::vector<Contact>& {
+    typedef std::pair<const AbstractShape<dimensions>*, const AbstractShape<dimensions>*> Key;
+
+    if(dirty) setClean();
+
+    const UnsignedInt frame = ++_contactFrame;
+    _contacts.clear();
+    _contactsBegan.clear();
+    _contactsEnded.clear();
+    _narrowPhaseTestCount = 0;
+
+    for(const std::pair<UnsignedInt, UnsignedInt>& pair: candidateIndices()) {
+        AbstractShape<dimensions>& a = (*this)[pair.first];
+        AbstractShape<dimensions>& b = (*this)[pair.second];
+        const Key key = std::less<const AbstractShape<dimensions>*>{}(&b, &a) ? Key{&b, &a} : Key{&a, &b};
+
+        auto found = _contactCache.find(key);
+        const bool added = found == _contactCache.end();
+        if(added) found = _contactCache.emplace(key, CachedContact{{}, nullptr, 0, 0, false}).first;
+        CachedContact& cached = found->second;
+
+        /* Skip the exact test if neither of the shapes changed since the
+           pair was tested last time */
+        const bool wasColliding = cached.colliding;
+        if(added || _entries.at(&a).changed > cached.tested || _entries.at(&b).changed > cached.tested) {
+            /* The collision is always of the shape with higher type with the
+               other. Not all pairs for which collides() is implemented have
+               also collision(). */
+            cached.collision = a.collision(b);
+            cached.first = a.type() < b.type() ? &b : &a;
+            cached.colliding = cached.collision || a.collides(b);
+            cached.tested = _generation;
+            ++_narrowPhaseTestCount;
+        }
+        cached.frame = frame;
+
+        if(cached.colliding) {
+            _contacts.push_back({&a, &b, cached.first != &a && cached.collision ? cached.collision.flipped() : cached.collision});
+            if(!wasColliding) _contactsBegan.push_back(_contacts.back());
+        } else if(wasColliding) _contactsEnded.push_back({&a, &b, {}});
+    }
+
+    /* Pairs which are no longer candidates. If both shapes are still in the
+       group, report the ended contact. */
+    bool endedSorted = true;
+    for(auto it = _contactCache.begin(); it != _contactCache.end(); ) {
+        if(it->second.frame == frame) {
+            ++it;
+            continue;
+        }
+
+        if(it->second.colliding) {
+            const auto foundA = _entries.find(it->first.first);
+            const auto foundB = _entries.find(it->first.second);
+            if(foundA != _entries.end() && foundB != _entries.end()) {
+                const std::pair<UnsignedInt, UnsignedInt> indices = std::minmax(foundA->second.index, foundB->second.index);
+                _contactsEnded.push_back({&(*this)[indices.first], &(*this)[indices.second], {}});
+                endedSorted = false;
+            }
+        }
+
+        it = _contactCache.erase(it);
+    }
+
+    if(!endedSorted) std::sort(_contactsEnded.begin(), _contactsEnded.end(), [this](const Contact& a, const Contact& b) {
+        return std::make_pair(_entries.at(a.a).index, _entries.at(a.b).index) < std::make_pair(_entries.at(b.a).index, _entries.at(b.b).index);
+    });
+
+    return _contacts;
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template class MAGNUM_SHAPES_EXPORT ShapeGroup<2>;
 template class MAGNUM_SHAPES_EXPORT ShapeGroup<3>;
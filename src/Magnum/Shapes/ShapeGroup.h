@@ -29,10 +29,15 @@
  * @brief Class @ref Magnum::Shapes::ShapeGroup, typedef @ref Magnum::Shapes::ShapeGroup2D, @ref Magnum::Shapes::ShapeGroup3D
  */
 
+#include <map>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "Magnum/SceneGraph/FeatureGroup.h"
+#include "Magnum/Shapes/AabbTree.h"
 #include "Magnum/Shapes/AbstractShape.h"
+#include "Magnum/Shapes/Collision.h"
 #include "Magnum/Shapes/visibility.h"
 
 namespace Magnum { namespace Shapes {
@@ -41,18 +46,92 @@ namespace Magnum { namespace Shapes {
 @brief Group of shapes
 
 See @ref Shape for more information. See @ref shapes for brief introduction.
+
+@section Shapes-ShapeGroup-broad-phase Broad phase
+
+Bounds of all shapes in the group are kept in an @ref AabbTree, which is
+updated in @ref setClean() only for shapes whose transformation or shape
+changed since the last time. @ref firstCollision(), @ref collisionCandidates()
+and @ref collisions() then run the exact tests only on shapes with overlapping
+bounds. Unbounded shapes (lines, cylinders, planes, inverted spheres and
+compositions containing negation) are always tested against everything else.
+The same tree is used also for scene queries -- @ref raycast(),
+@ref firstHit() and @ref sphereQuery().
+
+@section Shapes-ShapeGroup-contacts Persistent contacts
+
+@ref updateContacts() keeps a cache of candidate pairs across calls. The exact
+test is repeated only for pairs in which at least one shape changed its
+transformation or shape since the pair was last tested, for the other pairs
+the last result is reused. Pairs which started or stopped colliding since the
+previous call are reported in @ref contactsBegan() and @ref contactsEnded():
+@code
+shapes.updateContacts();
+for(const ShapeGroup3D::Contact& contact: shapes.contactsBegan())
+    playImpactSound(contact.a->object(), contact.collision);
+@endcode
+
+Shapes mark the group as dirty when they are created, destroyed or changed.
+If you move shapes between groups using @ref SceneGraph::FeatureGroup::add()
+or @ref SceneGraph::FeatureGroup::remove() directly, call @ref setDirty() on
+the group afterwards.
 @see @ref scenegraph, @ref ShapeGroup2D, @ref ShapeGroup3D
 */
 template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT ShapeGroup: public SceneGraph::FeatureGroup<dimensions, AbstractShape<dimensions>, Float> {
     friend AbstractShape<dimensions>;
 
     public:
+        /**
+         * @brief Ray hit
+         *
+         * @see @ref raycast(), @ref firstHit()
+         */
+        struct RaycastHit {
+            /** @brief Hit shape or `nullptr` if nothing was hit */
+            AbstractShape<dimensions>* shape;
+
+            /** @brief Object owning the shape or `nullptr` if nothing was hit */
+            SceneGraph::AbstractObject<dimensions, Float>* object;
+
+            /**
+             * @brief Position of the hit on the ray
+             *
+             * The hit point is `origin + distance*direction`, if the
+             * direction is normalized, this is the distance from ray origin.
+             * Zero if the ray starts inside the shape.
+             */
+            Float distance;
+        };
+
+        /**
+         * @brief Contact between two shapes
+         *
+         * @see @ref updateContacts()
+         */
+        struct Contact {
+            /** @brief First shape, earlier in the group */
+            AbstractShape<dimensions>* a;
+
+            /** @brief Second shape, later in the group */
+            AbstractShape<dimensions>* b;
+
+            /**
+             * @brief Collision of the first shape with the second
+             *
+             * Empty for shape pairs for which only
+             * @ref AbstractShape::collides() is implemented and
+             * @ref AbstractShape::collision() isn't. Not available for
+             * ended contacts.
+             */
+            Collision<dimensions> collision;
+        };
+
         /**
          * @brief Constructor
          *
          * Marks the group as dirty.
          */
-        explicit ShapeGroup(): dirty(true) {}
+        explicit ShapeGroup(): dirty(true), _generation{}, _contactFrame{}, _narrowPhaseTestCount{} {}
 
         /**
          * @brief Whether the group is dirty
@@ -74,21 +153,165 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT ShapeGroup: public S
          * @brief Set the group and all bodies as clean
          *
          * This function is called before computing any collisions to ensure
-         * all objects are cleaned.
+         * all objects are cleaned. Also updates bounds of changed shapes in
+         * the broad phase, see @ref Shapes-ShapeGroup-broad-phase.
          */
         void setClean();
 
+        /**
+         * @brief Broad phase tree
+         *
+         * Contains bounds of all bounded shapes in the group as of last call
+         * to @ref setClean().
+         */
+        const AabbTree<dimensions>& broadPhase() const { return _tree; }
+
         /**
          * @brief First collision of given shape with other shapes in the group
          *
          * Returns first shape colliding with given one. If there aren't any
          * collisions, returns `nullptr`. Calls @ref setClean() before the
-         * operation.
+         * operation if the group is dirty.
          */
         AbstractShape<dimensions>* firstCollision(const AbstractShape<dimensions>& shape);
 
+        /**
+         * @brief Pairs of shapes that might collide
+         *
+         * Returns all pairs of shapes with overlapping bounds, each pair
+         * exactly once, ordered by position of the shapes in the group. Calls
+         * @ref setClean() before the operation if the group is dirty.
+         * @see @ref collisions()
+         */
+        std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>> collisionCandidates();
+
+        /**
+         * @brief Pairs of colliding shapes
+         *
+         * Returns pairs from @ref collisionCandidates() which actually
+         * collide.
+         */
+        std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>> collisions();
+
+        /**
+         * @brief All shapes hit by a ray
+         * @param origin        Ray origin
+         * @param direction     Ray direction
+         * @param maxDistance   Maximal position of the hit on the ray
+         *
+         * Returns all shapes intersected by the ray sorted by distance, hits
+         * at the same distance are ordered by position of the shapes in the
+         * group. Only spheres, capsules, boxes and compositions consisting
+         * only of @ref CompositionOperation::Or can be hit, other shapes are
+         * either not solid or unbounded. Calls @ref setClean() before the
+         * operation if the group is dirty.
+         * @see @ref firstHit(), @ref Math::Geometry::Intersection::raySphere(),
+         *      @ref Math::Geometry::Intersection::rayCapsule(),
+         *      @ref Math::Geometry::Intersection::rayAabb()
+         */
+        std::vector<RaycastHit> raycast(const VectorTypeFor<dimensions, Float>& origin, const VectorTypeFor<dimensions, Float>& direction, Float maxDistance = Constants::inf());
+
+        /**
+         * @brief Nearest shape hit by a ray
+         *
+         * Same as the first item returned by @ref raycast(), but the exact
+         * tests stop as soon as no nearer hit is possible. If nothing is hit,
+         * returns a @ref RaycastHit with `nullptr` shape and object.
+         */
+        RaycastHit firstHit(const VectorTypeFor<dimensions, Float>& origin, const VectorTypeFor<dimensions, Float>& direction, Float maxDistance = Constants::inf());
+
+        /**
+         * @brief Shapes colliding with a sphere
+         * @param center        Sphere center
+         * @param radius        Sphere radius
+         *
+         * Returns all shapes colliding with @ref Sphere of given center and
+         * radius, ordered by position of the shapes in the group. Calls
+         * @ref setClean() before the operation if the group is dirty.
+         */
+        std::vector<AbstractShape<dimensions>*> sphereQuery(const VectorTypeFor<dimensions, Float>& center, Float radius);
+
+        /**
+         * @brief Update persistent contacts
+         * @return Reference to @ref contacts()
+         *
+         * Tests all pairs from @ref collisionCandidates(), reusing results
+         * for pairs of unchanged shapes from the previous call, and updates
+         * @ref contacts(), @ref contactsBegan() and @ref contactsEnded(). See
+         * @ref Shapes-ShapeGroup-contacts for more information. Calls
+         * @ref setClean() before the operation if the group is dirty.
+         */
+        const std::vector<Contact>& updateContacts();
+
+        /**
+         * @brief Current contacts
+         *
+         * Pairs of colliding shapes as of last call to @ref updateContacts(),
+         * ordered by position of the shapes in the group.
+         */
+        const std::vector<Contact>& contacts() const { return _contacts; }
+
+        /**
+         * @brief Contacts which began in last update
+         *
+         * Subset of @ref contacts() which weren't colliding in the previous
+         * call to @ref updateContacts().
+         */
+        const std::vector<Contact>& contactsBegan() const { return _contactsBegan; }
+
+        /**
+         * @brief Contacts which ended in last update
+         *
+         * Pairs which were colliding in the previous call to
+         * @ref updateContacts() and aren't anymore, ordered by position of
+         * the shapes in the group. Pairs in which one of the shapes was
+         * destroyed or removed from the group are not reported. The
+         * @ref Contact::collision member is empty.
+         */
+        const std::vector<Contact>& contactsEnded() const { return _contactsEnded; }
+
+        /**
+         * @brief Count of exact tests in last update
+         *
+         * Count of candidate pairs for which the exact test was done in last
+         * call to @ref updateContacts(), the remaining ones reused cached
+         * results.
+         */
+        std::size_t narrowPhaseTestCount() const { return _narrowPhaseTestCount; }
+
     private:
+        struct BroadPhaseEntry {
+            /* Generation in which the shape was changed last time */
+            UnsignedInt proxy, index, generation, changed;
+        };
+
+        struct CachedContact {
+            Collision<dimensions> collision;
+            /* Shape which is the first in the collision */
+            const AbstractShape<dimensions>* first;
+            /* Generation in which the pair was tested, last update in which
+               it was a candidate */
+            UnsignedInt tested, frame;
+            bool colliding;
+        };
+
+        MAGNUM_SHAPES_LOCAL void updateBroadPhase();
+        MAGNUM_SHAPES_LOCAL std::vector<std::pair<UnsignedInt, UnsignedInt>> candidateIndices() const;
+        MAGNUM_SHAPES_LOCAL std::vector<UnsignedInt> candidateIndices(const Math::Range<dimensions, Float>& bounds) const;
+
         bool dirty;
+        UnsignedInt _generation;
+        AabbTree<dimensions> _tree;
+        std::unordered_map<const AbstractShape<dimensions>*, BroadPhaseEntry> _entries;
+        /* Position in the group for each tree proxy, positions of unbounded
+           shapes */
+        std::vector<UnsignedInt> _proxyIndices, _unbounded;
+
+        /* Keyed by the pair of shapes ordered by address */
+        std::map<std::pair<const AbstractShape<dimensions>*, const AbstractShape<dimensions>*>, CachedContact> _contactCache;
+        std::vector<Contact> _contacts, _contactsBegan, _contactsEnded;
+        UnsignedInt _contactFrame;
+        std::size_t _narrowPhaseTestCount;
 };
 
 /**
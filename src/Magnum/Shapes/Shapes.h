@@ -34,6 +34,10 @@
 namespace Magnum { namespace Shapes {
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
+template<UnsignedInt> class AabbTree;
+typedef AabbTree<2> AabbTree2D;
+typedef AabbTree<3> AabbTree3D;
+
 template<UnsignedInt> class AbstractShape;
 typedef AbstractShape<2> AbstractShape2D;
 typedef AbstractShape<3> AbstractShape3D;
@@ -89,6 +93,8 @@ class Plane;
 template<UnsignedInt> class Point;
 typedef Point<2> Point2D;
 typedef Point<3> Point3D;
+
+class TriangleBvh;
 #endif
 
 }}
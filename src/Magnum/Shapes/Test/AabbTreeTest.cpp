@@ -0,0 +1,237 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Range.h"
+#include "Magnum/Shapes/AabbTree.h"
+
+namespace Magnum { namespace Shapes { namespace Test {
+
+struct AabbTreeTest: TestSuite::Tester {
+    explicit AabbTreeTest();
+
+    void construct();
+    void insertRemove();
+    void update();
+    void query();
+    void raycast();
+    void pairs();
+    void balanced();
+    void clear();
+    void invalidProxy();
+};
+
+AabbTreeTest::AabbTreeTest() {
+    addTests({&AabbTreeTest::construct,
+              &AabbTreeTest::insertRemove,
+              &AabbTreeTest::update,
+              &AabbTreeTest::query,
+              &AabbTreeTest::raycast,
+              &AabbTreeTest::pairs,
+              &AabbTreeTest::balanced,
+              &AabbTreeTest::clear,
+              &AabbTreeTest::invalidProxy});
+}
+
+void AabbTreeTest::construct() {
+    AabbTree3D tree{0.5f};
+    CORRADE_COMPARE(tree.margin(), 0.5f);
+    CORRADE_COMPARE(tree.size(), 0);
+    CORRADE_COMPARE(tree.height(), 0);
+    CORRADE_VERIFY(tree.isEmpty());
+    CORRADE_VERIFY(tree.query({{-100.0f, -100.0f, -100.0f}, {100.0f, 100.0f, 100.0f}}).empty());
+    CORRADE_VERIFY(tree.pairs().empty());
+}
+
+void AabbTreeTest::insertRemove() {
+    AabbTree2D tree{0.5f};
+
+    const UnsignedInt a = tree.insert({{0.0f, 0.0f}, {1.0f, 2.0f}});
+    CORRADE_COMPARE(tree.size(), 1);
+    CORRADE_COMPARE(tree.height(), 1);
+    CORRADE_VERIFY(!tree.isEmpty());
+
+    /* Stored bounds are enlarged */
+    CORRADE_COMPARE(tree.bounds(a), Range2D({-0.5f, -0.5f}, {1.5f, 2.5f}));
+
+    const UnsignedInt b = tree.insert({{3.0f, 0.0f}, {4.0f, 1.0f}});
+    CORRADE_VERIFY(b != a);
+    CORRADE_COMPARE(tree.size(), 2);
+    CORRADE_COMPARE(tree.height(), 2);
+    CORRADE_COMPARE(tree.bounds(b), Range2D({2.5f, -0.5f}, {4.5f, 1.5f}));
+
+    tree.remove(a);
+    CORRADE_COMPARE(tree.size(), 1);
+    CORRADE_COMPARE(tree.height(), 1);
+    CORRADE_COMPARE(tree.bounds(b), Range2D({2.5f, -0.5f}, {4.5f, 1.5f}));
+
+    tree.remove(b);
+    CORRADE_COMPARE(tree.size(), 0);
+    CORRADE_VERIFY(tree.isEmpty());
+}
+
+void AabbTreeTest::update() {
+    AabbTree2D tree{0.5f};
+    const UnsignedInt a = tree.insert({{0.0f, 0.0f}, {1.0f, 1.0f}});
+    const UnsignedInt b = tree.insert({{5.0f, 5.0f}, {6.0f, 6.0f}});
+
+    /* Small movement stays inside the enlarged bounds */
+    CORRADE_VERIFY(!tree.update(a, {{0.25f, -0.25f}, {1.25f, 0.75f}}));
+    CORRADE_COMPARE(tree.bounds(a), Range2D({-0.5f, -0.5f}, {1.5f, 1.5f}));
+
+    /* Larger one reinserts the leaf, the ID stays the same */
+    CORRADE_VERIFY(tree.update(a, {{4.5f, 4.5f}, {5.5f, 5.5f}}));
+    CORRADE_COMPARE(tree.bounds(a), Range2D({4.0f, 4.0f}, {6.0f, 6.0f}));
+    CORRADE_COMPARE(tree.size(), 2);
+    CORRADE_COMPARE(tree.pairs(), (std::vector<std::pair<UnsignedInt, UnsignedInt>>{{a, b}}));
+}
+
+void AabbTreeTest::query() {
+    AabbTree2D tree{0.0f};
+    const UnsignedInt a = tree.insert({{0.0f, 0.0f}, {1.0f, 1.0f}});
+    const UnsignedInt b = tree.insert({{2.0f, 0.0f}, {3.0f, 1.0f}});
+    const UnsignedInt c = tree.insert({{0.0f, 2.0f}, {1.0f, 3.0f}});
+
+    std::vector<UnsignedInt> result = tree.query({{0.5f, 0.5f}, {2.5f, 0.75f}});
+    std::sort(result.begin(), result.end());
+    CORRADE_COMPARE(result, (std::vector<UnsignedInt>{a, b}));
+
+    /* Touching counts as overlap */
+    result = tree.query({{1.0f, 1.0f}, {1.5f, 2.0f}});
+    std::sort(result.begin(), result.end());
+    CORRADE_COMPARE(result, (std::vector<UnsignedInt>{a, c}));
+
+    CORRADE_VERIFY(tree.query({{1.25f, 1.25f}, {1.75f, 1.75f}}).empty());
+}
+
+void AabbTreeTest::raycast() {
+    AabbTree2D tree{0.0f};
+    const UnsignedInt a = tree.insert({{4.0f, 0.0f}, {5.0f, 1.0f}});
+    const UnsignedInt b = tree.insert({{2.0f, 0.0f}, {3.0f, 1.0f}});
+    tree.insert({{0.0f, 2.0f}, {1.0f, 3.0f}});
+
+    /* Sorted by distance */
+    typedef std::vector<std::pair<UnsignedInt, Float>> Hits;
+    CORRADE_COMPARE(tree.raycast({0.0f, 0.5f}, {1.0f, 0.0f}, Constants::inf()), (Hits{{b, 2.0f}, {a, 4.0f}}));
+
+    /* Limited distance */
+    CORRADE_COMPARE(tree.raycast({0.0f, 0.5f}, {1.0f, 0.0f}, 3.0f), (Hits{{b, 2.0f}}));
+
+    /* Missing everything or pointing away */
+    CORRADE_VERIFY(tree.raycast({0.0f, 1.5f}, {1.0f, 0.0f}, Constants::inf()).empty());
+    CORRADE_VERIFY(tree.raycast({0.0f, 0.5f}, {-1.0f, 0.0f}, Constants::inf()).empty());
+}
+
+void AabbTreeTest::pairs() {
+    AabbTree3D tree{0.1f};
+
+    /* Pseudo-random boxes, compared to brute force */
+    std::vector<Range3D> boxes;
+    std::vector<UnsignedInt> ids;
+    UnsignedInt seed = 17;
+    auto random = [&seed]() {
+        seed = seed*1103515245u + 12345u;
+        return Float((seed >> 16) & 0x7fff)/Float(0x7fff);
+    };
+    for(std::size_t i = 0; i != 300; ++i) {
+        const Vector3 min{random()*20.0f, random()*20.0f, random()*20.0f};
+        boxes.push_back({min, min + Vector3{random(), random(), random()}*2.0f});
+        ids.push_back(tree.insert(boxes.back()));
+    }
+
+    /* Remove some and move others to exercise the free list and
+       reinsertion */
+    for(UnsignedInt i = 0; i < 300; i += 7) tree.remove(ids[i]);
+    for(UnsignedInt i = 3; i < 300; i += 7) {
+        boxes[i] = boxes[i].translated({random()*5.0f, 0.0f, 0.0f});
+        tree.update(ids[i], boxes[i]);
+    }
+
+    std::vector<std::pair<UnsignedInt, UnsignedInt>> expected;
+    for(UnsignedInt i = 0; i != 300; ++i) {
+        if(i % 7 == 0) continue;
+        for(UnsignedInt j = i + 1; j != 300; ++j) {
+            if(j % 7 == 0) continue;
+
+            const Range3D& a = tree.bounds(ids[i]);
+            const Range3D& b = tree.bounds(ids[j]);
+            if((a.min() <= b.max()).all() && (b.min() <= a.max()).all())
+                expected.emplace_back(std::minmax(ids[i], ids[j]));
+        }
+    }
+    std::sort(expected.begin(), expected.end());
+
+    CORRADE_VERIFY(!expected.empty());
+    CORRADE_COMPARE(tree.pairs(), expected);
+}
+
+void AabbTreeTest::balanced() {
+    AabbTree2D tree{0.0f};
+
+    /* Inserting sorted boxes would degenerate into a list without rotations */
+    for(std::size_t i = 0; i != 1024; ++i)
+        tree.insert({{Float(i), 0.0f}, {Float(i) + 0.5f, 1.0f}});
+
+    CORRADE_COMPARE(tree.size(), 1024);
+    CORRADE_VERIFY(tree.height() <= 20);
+}
+
+void AabbTreeTest::clear() {
+    AabbTree2D tree;
+    tree.insert({{0.0f, 0.0f}, {1.0f, 1.0f}});
+    tree.insert({{0.5f, 0.5f}, {1.0f, 1.0f}});
+
+    tree.clear();
+    CORRADE_VERIFY(tree.isEmpty());
+    CORRADE_COMPARE(tree.size(), 0);
+    CORRADE_COMPARE(tree.height(), 0);
+    CORRADE_VERIFY(tree.pairs().empty());
+
+    /* IDs are reused from the beginning */
+    CORRADE_COMPARE(tree.insert({{0.0f, 0.0f}, {1.0f, 1.0f}}), 0);
+}
+
+void AabbTreeTest::invalidProxy() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    AabbTree2D tree;
+    tree.insert({{0.0f, 0.0f}, {1.0f, 1.0f}});
+    const UnsignedInt b = tree.insert({{2.0f, 0.0f}, {3.0f, 1.0f}});
+    tree.remove(b);
+
+    tree.remove(b);
+    tree.update(7, {});
+    CORRADE_COMPARE(out.str(),
+        "Shapes::AabbTree::remove(): invalid proxy 1\n"
+        "Shapes::AabbTree::update(): invalid proxy 7\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shapes::Test::AabbTreeTest)
@@ -26,6 +26,7 @@
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/Magnum.h"
 #include "Magnum/Shapes/AxisAlignedBox.h"
+#include "Magnum/Shapes/Collision.h"
 #include "Magnum/Shapes/Point.h"
 
 #include "ShapeTestBase.h"
@@ -37,11 +38,13 @@ struct AxisAlignedBoxTest: TestSuite::Tester {
 
     void transformed();
     void collisionPoint();
+    void collisionAxisAlignedBox();
 };
 
 AxisAlignedBoxTest::AxisAlignedBoxTest() {
     addTests({&AxisAlignedBoxTest::transformed,
-              &AxisAlignedBoxTest::collisionPoint});
+              &AxisAlignedBoxTest::collisionPoint,
+              &AxisAlignedBoxTest::collisionAxisAlignedBox});
 }
 
 void AxisAlignedBoxTest::transformed() {
@@ -60,6 +63,29 @@ void AxisAlignedBoxTest::collisionPoint() {
     VERIFY_COLLIDES(box, point2);
 }
 
+void AxisAlignedBoxTest::collisionAxisAlignedBox() {
+    const Shapes::AxisAlignedBox3D box({-1.0f, -2.0f, -3.0f}, {1.0f, 2.0f, 3.0f});
+
+    /* Overlapping the least on X from the positive side */
+    const Shapes::AxisAlignedBox3D box1({0.5f, -1.0f, -1.0f}, {3.0f, 1.0f, 2.0f});
+    const Shapes::Collision3D collision = box/box1;
+    VERIFY_COLLIDES(box, box1);
+    CORRADE_COMPARE(collision.position(), Vector3(0.5f, 0.0f, 0.5f));
+    CORRADE_COMPARE(collision.separationNormal(), -Vector3::xAxis());
+    CORRADE_COMPARE(collision.separationDistance(), 0.5f);
+
+    /* Collision, flipped */
+    const Shapes::Collision3D collision1 = box1/box;
+    CORRADE_COMPARE(collision1.position(), Vector3(1.0f, 0.0f, 0.5f));
+    CORRADE_COMPARE(collision1.separationNormal(), Vector3::xAxis());
+    CORRADE_COMPARE(collision1.separationDistance(), 0.5f);
+
+    /* Touching boxes don't collide */
+    const Shapes::AxisAlignedBox3D box2({1.0f, -1.0f, -1.0f}, {3.0f, 1.0f, 2.0f});
+    VERIFY_NOT_COLLIDES(box, box2);
+    CORRADE_VERIFY(!(box/box2));
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Shapes::Test::AxisAlignedBoxTest)
@@ -0,0 +1,225 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Shapes/AxisAlignedBox.h"
+#include "Magnum/Shapes/BatchCollision.h"
+#include "Magnum/Shapes/Collision.h"
+#include "Magnum/Shapes/Point.h"
+#include "Magnum/Shapes/Sphere.h"
+
+namespace Magnum { namespace Shapes { namespace Test {
+
+struct BatchCollisionTest: TestSuite::Tester {
+    explicit BatchCollisionTest();
+
+    void sphereSphere3D();
+    void sphereSphere2D();
+    void spherePoint3D();
+    void spherePoint2D();
+    void axisAlignedBox3D();
+    void axisAlignedBox2D();
+
+    void empty();
+    void sizeMismatch();
+};
+
+BatchCollisionTest::BatchCollisionTest() {
+    addTests({&BatchCollisionTest::sphereSphere3D,
+              &BatchCollisionTest::sphereSphere2D,
+              &BatchCollisionTest::spherePoint3D,
+              &BatchCollisionTest::spherePoint2D,
+              &BatchCollisionTest::axisAlignedBox3D,
+              &BatchCollisionTest::axisAlignedBox2D,
+
+              &BatchCollisionTest::empty,
+              &BatchCollisionTest::sizeMismatch});
+}
+
+namespace {
+
+/* Deterministic pseudo-random values in the [-2, 2) range, dense enough to
+   get both colliding and non-colliding pairs. The count is deliberately not a
+   multiple of four to exercise also the scalar remainder. */
+constexpr std::size_t Count = 67;
+
+Float value(UnsignedInt& seed) {
+    seed = seed*1103515245u + 12345u;
+    return Float((seed >> 8) & 0xffff)/Float(0x4000) - 2.0f;
+}
+
+template<UnsignedInt dimensions> VectorTypeFor<dimensions, Float> vector(UnsignedInt& seed) {
+    VectorTypeFor<dimensions, Float> out;
+    for(std::size_t i = 0; i != dimensions; ++i) out[i] = value(seed);
+    return out;
+}
+
+template<UnsignedInt dimensions> Sphere<dimensions> sphere(UnsignedInt& seed) {
+    const VectorTypeFor<dimensions, Float> position = vector<dimensions>(seed);
+    return Sphere<dimensions>{position, Math::abs(value(seed))*0.5f};
+}
+
+template<UnsignedInt dimensions> AxisAlignedBox<dimensions> box(UnsignedInt& seed) {
+    const VectorTypeFor<dimensions, Float> a = vector<dimensions>(seed);
+    const VectorTypeFor<dimensions, Float> b = vector<dimensions>(seed);
+    return AxisAlignedBox<dimensions>{Math::min(a, b), Math::max(a, b)};
+}
+
+}
+
+#define COMPARE_COLLISIONS(a, b, out)                                       \
+    for(std::size_t i = 0; i != out.size(); ++i) {                          \
+        const auto expected = a[i]/b[i];                                    \
+        CORRADE_COMPARE(bool(out[i]), bool(expected));                      \
+        if(!expected) continue;                                             \
+        CORRADE_COMPARE(out[i].position(), expected.position());            \
+        CORRADE_COMPARE(out[i].separationNormal(), expected.separationNormal()); \
+        CORRADE_COMPARE(out[i].separationDistance(), expected.separationDistance()); \
+    }
+
+void BatchCollisionTest::sphereSphere3D() {
+    UnsignedInt seed = 1;
+    Containers::Array<Sphere3D> a{Count};
+    Containers::Array<Sphere3D> b{Count};
+    for(std::size_t i = 0; i != Count; ++i) {
+        a[i] = sphere<3>(seed);
+        b[i] = sphere<3>(seed);
+    }
+
+    /* Concentric spheres in one lane of a vectorized group */
+    b[5] = Sphere3D{a[5].position(), 0.25f};
+
+    Containers::Array<Collision3D> out{Count};
+    collisions(a, b, out);
+
+    std::size_t collided = 0;
+    for(const Collision3D& c: out) if(c) ++collided;
+    CORRADE_VERIFY(collided > 0 && collided < Count);
+    COMPARE_COLLISIONS(a, b, out)
+}
+
+void BatchCollisionTest::sphereSphere2D() {
+    UnsignedInt seed = 2;
+    Containers::Array<Sphere2D> a{Count};
+    Containers::Array<Sphere2D> b{Count};
+    for(std::size_t i = 0; i != Count; ++i) {
+        a[i] = sphere<2>(seed);
+        b[i] = sphere<2>(seed);
+    }
+
+    Containers::Array<Collision2D> out{Count};
+    collisions(a, b, out);
+    COMPARE_COLLISIONS(a, b, out)
+}
+
+void BatchCollisionTest::spherePoint3D() {
+    UnsignedInt seed = 3;
+    Containers::Array<Sphere3D> a{Count};
+    Containers::Array<Point3D> b{Count};
+    for(std::size_t i = 0; i != Count; ++i) {
+        /* Bigger spheres to get enough collisions */
+        a[i] = Sphere3D{vector<3>(seed), Math::abs(value(seed))};
+        b[i] = Point3D{vector<3>(seed)};
+    }
+
+    Containers::Array<Collision3D> out{Count};
+    collisions(a, b, out);
+
+    std::size_t collided = 0;
+    for(const Collision3D& c: out) if(c) ++collided;
+    CORRADE_VERIFY(collided > 0 && collided < Count);
+    COMPARE_COLLISIONS(a, b, out)
+}
+
+void BatchCollisionTest::spherePoint2D() {
+    UnsignedInt seed = 4;
+    Containers::Array<Sphere2D> a{Count};
+    Containers::Array<Point2D> b{Count};
+    for(std::size_t i = 0; i != Count; ++i) {
+        a[i] = Sphere2D{vector<2>(seed), Math::abs(value(seed))};
+        b[i] = Point2D{vector<2>(seed)};
+    }
+
+    Containers::Array<Collision2D> out{Count};
+    collisions(a, b, out);
+    COMPARE_COLLISIONS(a, b, out)
+}
+
+void BatchCollisionTest::axisAlignedBox3D() {
+    UnsignedInt seed = 5;
+    Containers::Array<AxisAlignedBox3D> a{Count};
+    Containers::Array<AxisAlignedBox3D> b{Count};
+    for(std::size_t i = 0; i != Count; ++i) {
+        a[i] = box<3>(seed);
+        b[i] = box<3>(seed);
+    }
+
+    Containers::Array<Collision3D> out{Count};
+    collisions(a, b, out);
+
+    std::size_t collided = 0;
+    for(const Collision3D& c: out) if(c) ++collided;
+    CORRADE_VERIFY(collided > 0 && collided < Count);
+    COMPARE_COLLISIONS(a, b, out)
+}
+
+void BatchCollisionTest::axisAlignedBox2D() {
+    UnsignedInt seed = 6;
+    Containers::Array<AxisAlignedBox2D> a{Count};
+    Containers::Array<AxisAlignedBox2D> b{Count};
+    for(std::size_t i = 0; i != Count; ++i) {
+        a[i] = box<2>(seed);
+        b[i] = box<2>(seed);
+    }
+
+    Containers::Array<Collision2D> out{Count};
+    collisions(a, b, out);
+    COMPARE_COLLISIONS(a, b, out)
+}
+
+void BatchCollisionTest::empty() {
+    /* Shouldn't crash */
+    collisions(Containers::ArrayView<const Sphere3D>{}, Containers::ArrayView<const Sphere3D>{}, Containers::ArrayView<Collision3D>{});
+    CORRADE_VERIFY(true);
+}
+
+void BatchCollisionTest::sizeMismatch() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Containers::Array<Sphere3D> a{3};
+    Containers::Array<Point3D> b{2};
+    Containers::Array<Collision3D> c{3};
+    collisions(a, b, c);
+    CORRADE_COMPARE(out.str(), "Shapes::collisions(): expected the same size of all views but got 3, 2 and 3\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shapes::Test::BatchCollisionTest)
@@ -47,6 +47,7 @@ struct CompositionTest: TestSuite::Tester {
     void copy();
     void move();
     void transformed();
+    void transformedInterleaved();
 };
 
 CompositionTest::CompositionTest() {
@@ -59,7 +60,8 @@ CompositionTest::CompositionTest() {
 
               &CompositionTest::copy,
               &CompositionTest::move,
-              &CompositionTest::transformed});
+              &CompositionTest::transformed,
+              &CompositionTest::transformedInterleaved});
 }
 
 void CompositionTest::negated() {
@@ -140,12 +142,16 @@ void CompositionTest::copy() {
     const Shapes::Composition3D b(a);
     CORRADE_COMPARE(b.size(), 3);
     CORRADE_COMPARE(b.get<Shapes::AxisAlignedBox3D>(2).max(), Vector3(0.5f));
+    VERIFY_COLLIDES(b, Shapes::Sphere3D(Vector3::xAxis(1.5f), 0.6f));
+    VERIFY_NOT_COLLIDES(b, Shapes::Point3D(Vector3(0.25f)));
 
     /* Copy assignment */
     Shapes::Composition3D c;
     c = a;
     CORRADE_COMPARE(c.size(), 3);
     CORRADE_COMPARE(c.get<Shapes::Point3D>(1).position(), Vector3::xAxis(1.5f));
+    VERIFY_COLLIDES(c, Shapes::Sphere3D(Vector3::xAxis(1.5f), 0.6f));
+    VERIFY_NOT_COLLIDES(c, Shapes::Point3D(Vector3(0.25f)));
 }
 
 void CompositionTest::move() {
@@ -158,6 +164,8 @@ void CompositionTest::move() {
         CORRADE_COMPARE(a.size(), 0);
         CORRADE_COMPARE(b.size(), 3);
         CORRADE_COMPARE(b.get<Shapes::Point3D>(1).position(), Vector3::xAxis(1.5f));
+        VERIFY_COLLIDES(b, Shapes::Sphere3D(Vector3::xAxis(1.5f), 0.6f));
+        VERIFY_NOT_COLLIDES(a, Shapes::Sphere3D(Vector3::xAxis(1.5f), 0.6f));
     } {
         Shapes::Composition3D a = Shapes::Sphere3D({}, 1.0f) &&
             (Shapes::Point3D(Vector3::xAxis(1.5f)) || !Shapes::AxisAlignedBox3D({}, Vector3(0.5f)));
@@ -168,6 +176,7 @@ void CompositionTest::move() {
         CORRADE_COMPARE(a.size(), 0);
         CORRADE_COMPARE(b.size(), 3);
         CORRADE_COMPARE(b.get<Shapes::AxisAlignedBox3D>(2).max(), Vector3(0.5f));
+        VERIFY_COLLIDES(b, Shapes::Sphere3D(Vector3::xAxis(1.5f), 0.6f));
     }
 }
 
@@ -183,6 +192,25 @@ void CompositionTest::transformed() {
     CORRADE_COMPARE(b.get<Shapes::AxisAlignedBox2D>(2).max(), Vector2(2.0f, -6.5f));
 }
 
+void CompositionTest::transformedInterleaved() {
+    /* Shapes are transformed grouped by type, verify that the order is
+       preserved */
+    const Shapes::Composition2D a = (Shapes::Point2D({1.0f, 0.0f}) || Shapes::Sphere2D({2.0f, 0.0f}, 0.5f)) ||
+        (Shapes::Point2D({3.0f, 0.0f}) || Shapes::Sphere2D({4.0f, 0.0f}, 0.25f));
+
+    const Shapes::Composition2D b = a.transformed(Matrix3::translation(Vector2::yAxis(1.0f))*Matrix3::scaling(Vector2(2.0f)));
+    CORRADE_COMPARE(b.size(), 4);
+    CORRADE_COMPARE(b.get<Shapes::Point2D>(0).position(), Vector2(2.0f, 1.0f));
+    CORRADE_COMPARE(b.get<Shapes::Sphere2D>(1).position(), Vector2(4.0f, 1.0f));
+    CORRADE_COMPARE(b.get<Shapes::Sphere2D>(1).radius(), 1.0f);
+    CORRADE_COMPARE(b.get<Shapes::Point2D>(2).position(), Vector2(6.0f, 1.0f));
+    CORRADE_COMPARE(b.get<Shapes::Sphere2D>(3).position(), Vector2(8.0f, 1.0f));
+    CORRADE_COMPARE(b.get<Shapes::Sphere2D>(3).radius(), 0.5f);
+
+    VERIFY_COLLIDES(b, Shapes::Sphere2D({8.0f, 1.0f}, 0.1f));
+    VERIFY_NOT_COLLIDES(b, Shapes::Sphere2D({8.0f, 3.0f}, 0.1f));
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Shapes::Test::CompositionTest)
@@ -25,7 +25,10 @@
 
 #include <Corrade/TestSuite/Tester.h>
 
+#include "Magnum/Shapes/AxisAlignedBox.h"
+#include "Magnum/Shapes/Capsule.h"
 #include "Magnum/Shapes/Composition.h"
+#include "Magnum/Shapes/Line.h"
 #include "Magnum/Shapes/Point.h"
 #include "Magnum/Shapes/Shape.h"
 #include "Magnum/Shapes/ShapeGroup.h"
@@ -43,6 +46,18 @@ struct ShapeTest: TestSuite::Tester {
     void collides();
     void collision();
     void firstCollision();
+    void firstCollisionUnbounded();
+    void collisionCandidates();
+    void collisionCandidatesUnbounded();
+    void collisionCandidatesUpdate();
+    void collisions();
+    void contacts();
+    void contactsCached();
+    void contactsRemoved();
+    void raycast();
+    void raycastComposition();
+    void firstHit();
+    void sphereQuery();
     void shapeGroup();
 };
 
@@ -56,6 +71,18 @@ ShapeTest::ShapeTest() {
               &ShapeTest::collides,
               &ShapeTest::collision,
               &ShapeTest::firstCollision,
+              &ShapeTest::firstCollisionUnbounded,
+              &ShapeTest::collisionCandidates,
+              &ShapeTest::collisionCandidatesUnbounded,
+              &ShapeTest::collisionCandidatesUpdate,
+              &ShapeTest::collisions,
+              &ShapeTest::contacts,
+              &ShapeTest::contactsCached,
+              &ShapeTest::contactsRemoved,
+              &ShapeTest::raycast,
+              &ShapeTest::raycastComposition,
+              &ShapeTest::firstHit,
+              &ShapeTest::sphereQuery,
               &ShapeTest::shapeGroup});
 }
 
@@ -206,6 +233,380 @@ void ShapeTest::firstCollision() {
     CORRADE_VERIFY(!shapes.isDirty());
 }
 
+void ShapeTest::firstCollisionUnbounded() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    Object3D a(&scene);
+    Shape<Shapes::Sphere3D> aShape(a, {{1.0f, -2.0f, 3.0f}, 1.5f}, &shapes);
+
+    /* Line is not in the broad phase tree, but still found */
+    Object3D b(&scene);
+    Shape<Shapes::Line3D> bShape(b, {{-100.0f, -2.0f, 3.0f}, {-99.0f, -2.0f, 3.0f}}, &shapes);
+
+    CORRADE_VERIFY(shapes.firstCollision(aShape) == &bShape);
+    CORRADE_VERIFY(shapes.firstCollision(bShape) == &aShape);
+    CORRADE_COMPARE(shapes.broadPhase().size(), 1);
+}
+
+void ShapeTest::collisionCandidates() {
+    Scene2D scene;
+    ShapeGroup2D shapes;
+
+    Object2D a(&scene);
+    Shape<Shapes::Sphere2D> aShape(a, {{}, 1.0f}, &shapes);
+
+    /* Enlarged bounds of the point touch the sphere */
+    Object2D b(&scene);
+    b.translate({1.0f, 0.0f});
+    Shape<Shapes::Point2D> bShape(b, {{}}, &shapes);
+
+    Object2D c(&scene);
+    c.translate({10.0f, 0.0f});
+    Shape<Shapes::Point2D> cShape(c, {{}}, &shapes);
+
+    /* Composition bounds are union of the subshapes */
+    Object2D d(&scene);
+    Shape<Shapes::Composition2D> dShape(d, Shapes::Point2D({-20.0f, 0.0f}) || Shapes::Point2D({10.0f, 0.0f}), &shapes);
+
+    typedef std::vector<std::pair<AbstractShape2D*, AbstractShape2D*>> Pairs;
+    CORRADE_COMPARE(shapes.collisionCandidates(), (Pairs{{&aShape, &bShape}, {&aShape, &dShape}, {&bShape, &dShape}, {&cShape, &dShape}}));
+    CORRADE_VERIFY(!shapes.isDirty());
+    CORRADE_COMPARE(shapes.broadPhase().size(), 4);
+}
+
+void ShapeTest::collisionCandidatesUnbounded() {
+    Scene2D scene;
+    ShapeGroup2D shapes;
+
+    Object2D a(&scene);
+    Shape<Shapes::Point2D> aShape(a, {{}}, &shapes);
+
+    Object2D b(&scene);
+    Shape<Shapes::Line2D> bShape(b, {{}, {1.0f, 0.0f}}, &shapes);
+
+    Object2D c(&scene);
+    c.translate({10.0f, 0.0f});
+    Shape<Shapes::Point2D> cShape(c, {{}}, &shapes);
+
+    /* Negation is unbounded */
+    Object2D d(&scene);
+    Shape<Shapes::Composition2D> dShape(d, !Shapes::Sphere2D({}, 1.0f), &shapes);
+
+    typedef std::vector<std::pair<AbstractShape2D*, AbstractShape2D*>> Pairs;
+    CORRADE_COMPARE(shapes.collisionCandidates(), (Pairs{
+        {&aShape, &bShape}, {&aShape, &dShape},
+        {&bShape, &cShape}, {&bShape, &dShape},
+        {&cShape, &dShape}}));
+    CORRADE_COMPARE(shapes.broadPhase().size(), 2);
+}
+
+void ShapeTest::collisionCandidatesUpdate() {
+    Scene2D scene;
+    ShapeGroup2D shapes;
+
+    Object2D a(&scene);
+    Shape<Shapes::Sphere2D> aShape(a, {{}, 1.0f}, &shapes);
+
+    Object2D b(&scene);
+    b.translate({5.0f, 0.0f});
+    Shape<Shapes::Point2D> bShape(b, {{}}, &shapes);
+
+    CORRADE_VERIFY(shapes.collisionCandidates().empty());
+
+    /* Moving the object marks the group dirty and updates the bounds */
+    b.translate({-4.5f, 0.0f});
+    CORRADE_VERIFY(shapes.isDirty());
+
+    typedef std::vector<std::pair<AbstractShape2D*, AbstractShape2D*>> Pairs;
+    CORRADE_COMPARE(shapes.collisionCandidates(), (Pairs{{&aShape, &bShape}}));
+
+    /* Changing the shape also */
+    aShape.setShape({{-10.0f, 0.0f}, 1.0f});
+    CORRADE_VERIFY(shapes.isDirty());
+    CORRADE_VERIFY(shapes.collisionCandidates().empty());
+
+    {
+        /* Added shape is in the broad phase */
+        Object2D c(&scene);
+        Shape<Shapes::Point2D> cShape(c, {{-10.0f, 0.5f}}, &shapes);
+        CORRADE_VERIFY(shapes.isDirty());
+        CORRADE_COMPARE(shapes.collisionCandidates(), (Pairs{{&aShape, &cShape}}));
+        CORRADE_COMPARE(shapes.broadPhase().size(), 3);
+    }
+
+    /* Removed shape is not */
+    CORRADE_VERIFY(shapes.isDirty());
+    CORRADE_VERIFY(shapes.collisionCandidates().empty());
+    CORRADE_COMPARE(shapes.broadPhase().size(), 2);
+}
+
+void ShapeTest::collisions() {
+    Scene2D scene;
+    ShapeGroup2D shapes;
+
+    Object2D a(&scene);
+    Shape<Shapes::Sphere2D> aShape(a, {{}, 1.0f}, &shapes);
+
+    /* Bounds overlap, but the point is outside of the sphere */
+    Object2D b(&scene);
+    b.translate({0.9f, 0.9f});
+    Shape<Shapes::Point2D> bShape(b, {{}}, &shapes);
+
+    Object2D c(&scene);
+    c.translate({0.5f, 0.0f});
+    Shape<Shapes::Point2D> cShape(c, {{}}, &shapes);
+
+    typedef std::vector<std::pair<AbstractShape2D*, AbstractShape2D*>> Pairs;
+    CORRADE_COMPARE(shapes.collisionCandidates().size(), 2);
+    CORRADE_COMPARE(shapes.collisions(), (Pairs{{&aShape, &cShape}}));
+}
+
+void ShapeTest::contacts() {
+    Scene2D scene;
+    ShapeGroup2D shapes;
+
+    Object2D a(&scene);
+    Shape<Shapes::Sphere2D> aShape(a, {{}, 1.0f}, &shapes);
+
+    Object2D b(&scene);
+    b.translate({3.0f, 0.0f});
+    Shape<Shapes::Point2D> bShape(b, {{}}, &shapes);
+
+    CORRADE_VERIFY(shapes.updateContacts().empty());
+    CORRADE_VERIFY(shapes.contactsBegan().empty());
+    CORRADE_VERIFY(shapes.contactsEnded().empty());
+
+    /* Contact begins */
+    b.translate({-2.5f, 0.0f});
+    CORRADE_COMPARE(shapes.updateContacts().size(), 1);
+    CORRADE_COMPARE(shapes.contacts()[0].a, &aShape);
+    CORRADE_COMPARE(shapes.contacts()[0].b, &bShape);
+    CORRADE_COMPARE(shapes.contacts()[0].collision.separationDistance(), 0.5f);
+    CORRADE_COMPARE(shapes.contacts()[0].collision.separationNormal(), Vector2::xAxis(-1.0f));
+    CORRADE_COMPARE(shapes.contactsBegan().size(), 1);
+    CORRADE_COMPARE(shapes.contactsBegan()[0].b, &bShape);
+    CORRADE_VERIFY(shapes.contactsEnded().empty());
+
+    /* Contact persists */
+    b.translate({0.25f, 0.0f});
+    CORRADE_COMPARE(shapes.updateContacts().size(), 1);
+    CORRADE_COMPARE(shapes.contacts()[0].collision.separationDistance(), 0.25f);
+    CORRADE_VERIFY(shapes.contactsBegan().empty());
+    CORRADE_VERIFY(shapes.contactsEnded().empty());
+
+    /* Contact ends while bounds still overlap */
+    b.translate({0.1f, 0.9f});
+    CORRADE_VERIFY(shapes.updateContacts().empty());
+    CORRADE_VERIFY(shapes.contactsBegan().empty());
+    CORRADE_COMPARE(shapes.contactsEnded().size(), 1);
+    CORRADE_COMPARE(shapes.contactsEnded()[0].a, &aShape);
+    CORRADE_COMPARE(shapes.contactsEnded()[0].b, &bShape);
+
+    /* Contact begins again and then ends as the bounds stop overlapping */
+    b.translate({-0.5f, -0.9f});
+    CORRADE_COMPARE(shapes.updateContacts().size(), 1);
+    CORRADE_COMPARE(shapes.contactsBegan().size(), 1);
+    b.translate({10.0f, 0.0f});
+    CORRADE_VERIFY(shapes.updateContacts().empty());
+    CORRADE_COMPARE(shapes.contactsEnded().size(), 1);
+    CORRADE_COMPARE(shapes.contactsEnded()[0].b, &bShape);
+}
+
+void ShapeTest::contactsCached() {
+    Scene2D scene;
+    ShapeGroup2D shapes;
+
+    Object2D a(&scene);
+    Shape<Shapes::Sphere2D> aShape(a, {{}, 1.0f}, &shapes);
+
+    Object2D b(&scene);
+    b.translate({0.5f, 0.0f});
+    Shape<Shapes::Point2D> bShape(b, {{}}, &shapes);
+
+    Object2D c(&scene);
+    c.translate({10.0f, 0.0f});
+    Shape<Shapes::Sphere2D> cShape(c, {{}, 1.0f}, &shapes);
+
+    Object2D d(&scene);
+    d.translate({10.5f, 0.0f});
+    Shape<Shapes::Point2D> dShape(d, {{}}, &shapes);
+
+    CORRADE_COMPARE(shapes.updateContacts().size(), 2);
+    CORRADE_COMPARE(shapes.narrowPhaseTestCount(), 2);
+
+    /* Nothing changed, no exact tests */
+    CORRADE_COMPARE(shapes.updateContacts().size(), 2);
+    CORRADE_COMPARE(shapes.narrowPhaseTestCount(), 0);
+    CORRADE_VERIFY(shapes.contactsBegan().empty());
+
+    /* Only the pair with moved shape is tested, the other reuses the
+       collision */
+    d.translate({0.25f, 0.0f});
+    CORRADE_COMPARE(shapes.updateContacts().size(), 2);
+    CORRADE_COMPARE(shapes.narrowPhaseTestCount(), 1);
+    CORRADE_COMPARE(shapes.contacts()[0].a, &aShape);
+    CORRADE_COMPARE(shapes.contacts()[0].collision.separationDistance(), 0.5f);
+    CORRADE_COMPARE(shapes.contacts()[1].a, &cShape);
+    CORRADE_COMPARE(shapes.contacts()[1].b, &dShape);
+    CORRADE_COMPARE(shapes.contacts()[1].collision.separationDistance(), 0.25f);
+
+    /* Unrelated queries don't invalidate the cache */
+    CORRADE_COMPARE(shapes.collisions().size(), 2);
+    CORRADE_COMPARE(shapes.updateContacts().size(), 2);
+    CORRADE_COMPARE(shapes.narrowPhaseTestCount(), 0);
+}
+
+void ShapeTest::contactsRemoved() {
+    Scene2D scene;
+    ShapeGroup2D shapes;
+
+    Object2D a(&scene);
+    Shape<Shapes::Sphere2D> aShape(a, {{}, 1.0f}, &shapes);
+
+    Object2D b(&scene);
+    b.translate({0.5f, 0.0f});
+    Shape<Shapes::Point2D> bShape(b, {{}}, &shapes);
+
+    {
+        Object2D c(&scene);
+        c.translate({-0.5f, 0.0f});
+        Shape<Shapes::Point2D> cShape(c, {{}}, &shapes);
+        CORRADE_COMPARE(shapes.updateContacts().size(), 2);
+    }
+
+    /* Contact with destroyed shape is not reported as ended */
+    CORRADE_COMPARE(shapes.updateContacts().size(), 1);
+    CORRADE_COMPARE(shapes.contacts()[0].b, &bShape);
+    CORRADE_VERIFY(shapes.contactsEnded().empty());
+    CORRADE_COMPARE(shapes.narrowPhaseTestCount(), 0);
+}
+
+void ShapeTest::raycast() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    Object3D a(&scene);
+    a.translate({10.0f, 0.0f, 0.0f});
+    Shape<Shapes::Sphere3D> aShape(a, {{}, 1.0f}, &shapes);
+
+    Object3D b(&scene);
+    b.translate({5.0f, 0.0f, 0.0f});
+    Shape<Shapes::AxisAlignedBox3D> bShape(b, {Vector3{-0.5f}, Vector3{0.5f}}, &shapes);
+
+    /* Transformed with the object */
+    Object3D c(&scene);
+    c.scale(Vector3{2.0f}).translate({20.0f, 0.0f, 0.0f});
+    Shape<Shapes::Capsule3D> cShape(c, {{0.0f, -1.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, 0.5f}, &shapes);
+
+    /* Out of the ray */
+    Object3D d(&scene);
+    d.translate({7.0f, 5.0f, 0.0f});
+    Shape<Shapes::Sphere3D> dShape(d, {{}, 1.0f}, &shapes);
+
+    /* Not solid, never hit */
+    Object3D e(&scene);
+    Shape<Shapes::Point3D> eShape(e, {{2.0f, 0.0f, 0.0f}}, &shapes);
+
+    std::vector<ShapeGroup3D::RaycastHit> hits = shapes.raycast({}, Vector3::xAxis());
+    CORRADE_COMPARE(hits.size(), 3);
+    CORRADE_VERIFY(hits[0].shape == &bShape);
+    CORRADE_VERIFY(hits[0].object == &b);
+    CORRADE_COMPARE(hits[0].distance, 4.5f);
+    CORRADE_VERIFY(hits[1].shape == &aShape);
+    CORRADE_VERIFY(hits[1].object == &a);
+    CORRADE_COMPARE(hits[1].distance, 9.0f);
+    CORRADE_VERIFY(hits[2].shape == &cShape);
+    CORRADE_COMPARE(hits[2].distance, 19.0f);
+    CORRADE_VERIFY(!shapes.isDirty());
+
+    /* Limited distance */
+    CORRADE_COMPARE(shapes.raycast({}, Vector3::xAxis(), 5.0f).size(), 1);
+
+    /* Starting inside */
+    hits = shapes.raycast({10.0f, 0.0f, 0.0f}, Vector3::xAxis());
+    CORRADE_COMPARE(hits.size(), 2);
+    CORRADE_VERIFY(hits[0].shape == &aShape);
+    CORRADE_COMPARE(hits[0].distance, 0.0f);
+}
+
+void ShapeTest::raycastComposition() {
+    Scene2D scene;
+    ShapeGroup2D shapes;
+
+    Object2D a(&scene);
+    Shape<Shapes::Composition2D> aShape(a, Shapes::Sphere2D({5.0f, 0.0f}, 1.0f) || Shapes::Sphere2D({3.0f, 0.0f}, 0.5f), &shapes);
+
+    /* Intersection can't be hit */
+    Object2D b(&scene);
+    Shape<Shapes::Composition2D> bShape(b, Shapes::Sphere2D({-5.0f, 0.0f}, 1.0f) && Shapes::Sphere2D({-5.0f, 0.0f}, 0.5f), &shapes);
+
+    std::vector<ShapeGroup2D::RaycastHit> hits = shapes.raycast({}, Vector2::xAxis());
+    CORRADE_COMPARE(hits.size(), 1);
+    CORRADE_VERIFY(hits[0].shape == &aShape);
+    CORRADE_COMPARE(hits[0].distance, 2.5f);
+
+    CORRADE_VERIFY(shapes.raycast({}, -Vector2::xAxis()).empty());
+}
+
+void ShapeTest::firstHit() {
+    Scene2D scene;
+    ShapeGroup2D shapes;
+
+    Object2D a(&scene);
+    Shape<Shapes::Sphere2D> aShape(a, {{9.5f, 0.0f}, 0.2f}, &shapes);
+
+    /* Bounds entered first, but the ray is nearly tangent so hit later */
+    Object2D b(&scene);
+    Shape<Shapes::Sphere2D> bShape(b, {{10.0f, 0.99f}, 1.0f}, &shapes);
+
+    ShapeGroup2D::RaycastHit hit = shapes.firstHit({0.0f, 0.0f}, Vector2::xAxis());
+    CORRADE_VERIFY(hit.shape == &aShape);
+    CORRADE_VERIFY(hit.object == &a);
+    CORRADE_COMPARE(hit.distance, 9.3f);
+
+    /* Same as the first item of raycast() */
+    std::vector<ShapeGroup2D::RaycastHit> hits = shapes.raycast({0.0f, 0.0f}, Vector2::xAxis());
+    CORRADE_COMPARE(hits.size(), 2);
+    CORRADE_VERIFY(hits[0].shape == &aShape);
+    CORRADE_VERIFY(hits[1].shape == &bShape);
+
+    /* Nothing hit */
+    hit = shapes.firstHit({0.0f, -1.5f}, Vector2::xAxis());
+    CORRADE_VERIFY(!hit.shape);
+    CORRADE_VERIFY(!hit.object);
+    CORRADE_COMPARE(hit.distance, Constants::inf());
+
+    /* Nothing hit in given distance */
+    CORRADE_VERIFY(!shapes.firstHit({0.0f, 0.0f}, Vector2::xAxis(), 8.0f).shape);
+}
+
+void ShapeTest::sphereQuery() {
+    Scene2D scene;
+    ShapeGroup2D shapes;
+
+    Object2D a(&scene);
+    a.translate({2.0f, 0.0f});
+    Shape<Shapes::Point2D> aShape(a, {{}}, &shapes);
+
+    Object2D b(&scene);
+    Shape<Shapes::Sphere2D> bShape(b, {{-3.0f, 0.0f}, 1.5f}, &shapes);
+
+    /* Bounds overlap, but outside of the sphere */
+    Object2D c(&scene);
+    c.translate({2.0f, 2.0f});
+    Shape<Shapes::Point2D> cShape(c, {{}}, &shapes);
+
+    /* Unbounded */
+    Object2D d(&scene);
+    Shape<Shapes::Line2D> dShape(d, {{0.0f, -1.0f}, {1.0f, -1.0f}}, &shapes);
+
+    typedef std::vector<AbstractShape2D*> Shapes;
+    CORRADE_COMPARE(shapes.sphereQuery({}, 2.5f), (Shapes{&aShape, &bShape, &dShape}));
+    CORRADE_COMPARE(shapes.sphereQuery({}, 0.5f), Shapes{});
+    CORRADE_COMPARE(shapes.sphereQuery({2.0f, 2.0f}, 0.1f), (Shapes{&cShape}));
+}
+
 void ShapeTest::shapeGroup() {
     Scene2D scene;
     ShapeGroup2D shapes;
@@ -0,0 +1,312 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Geometry/Intersection.h"
+#include "Magnum/Shapes/TriangleBvh.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace Shapes { namespace Test {
+
+struct TriangleBvhTest: TestSuite::Tester {
+    explicit TriangleBvhTest();
+
+    void construct();
+    void constructEmpty();
+    void constructMeshData();
+    void constructMeshDataNonIndexed();
+    void constructMeshDataNotTriangles();
+    void constructInvalidIndexCount();
+    void constructParallel();
+
+    void raycast();
+    void raycastMaxDistance();
+    void raycastPacket();
+    void raycastPacketSizeMismatch();
+    void queryRange();
+    void queryFrustum();
+};
+
+TriangleBvhTest::TriangleBvhTest() {
+    addTests({&TriangleBvhTest::construct,
+              &TriangleBvhTest::constructEmpty,
+              &TriangleBvhTest::constructMeshData,
+              &TriangleBvhTest::constructMeshDataNonIndexed,
+              &TriangleBvhTest::constructMeshDataNotTriangles,
+              &TriangleBvhTest::constructInvalidIndexCount,
+              &TriangleBvhTest::constructParallel,
+
+              &TriangleBvhTest::raycast,
+              &TriangleBvhTest::raycastMaxDistance,
+              &TriangleBvhTest::raycastPacket,
+              &TriangleBvhTest::raycastPacketSizeMismatch,
+              &TriangleBvhTest::queryRange,
+              &TriangleBvhTest::queryFrustum});
+}
+
+namespace {
+
+Float value(UnsignedInt& seed) {
+    seed = seed*1103515245u + 12345u;
+    return Float((seed >> 8) & 0xffff)/Float(0x8000) - 1.0f;
+}
+
+Vector3 vector(UnsignedInt& seed) {
+    const Float x = value(seed);
+    const Float y = value(seed);
+    return {x, y, value(seed)};
+}
+
+/* Soup of small pseudo-random triangles in the [-10, 10] cube */
+struct Soup {
+    explicit Soup(std::size_t count) {
+        UnsignedInt seed = 7;
+        for(std::size_t i = 0; i != count; ++i) {
+            const Vector3 center = vector(seed)*10.0f;
+            for(std::size_t j = 0; j != 3; ++j) {
+                indices.push_back(positions.size());
+                positions.push_back(center + vector(seed));
+            }
+        }
+    }
+
+    TriangleBvh::RaycastHit raycast(const Vector3& origin, const Vector3& direction) const {
+        TriangleBvh::RaycastHit hit{TriangleBvh::NoTriangle, Constants::inf()};
+        for(std::size_t i = 0; i != indices.size()/3; ++i) {
+            const Float t = Math::Geometry::Intersection::rayTriangle(origin, direction, positions[indices[i*3]], positions[indices[i*3 + 1]], positions[indices[i*3 + 2]]);
+            if(t < hit.distance) hit = {UnsignedInt(i), t};
+        }
+        return hit;
+    }
+
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+};
+
+}
+
+void TriangleBvhTest::construct() {
+    const Soup soup{1000};
+    const TriangleBvh bvh{soup.indices, soup.positions};
+
+    CORRADE_COMPARE(bvh.triangleCount(), 1000);
+    CORRADE_VERIFY(bvh.nodeCount() > 1 && bvh.nodeCount() < 2*1000);
+
+    /* Leaves are small, so the depth is about logarithmic */
+    CORRADE_VERIFY(bvh.depth() > 8 && bvh.depth() < 40);
+
+    Range3D bounds{soup.positions.front(), soup.positions.front()};
+    for(const Vector3& position: soup.positions)
+        bounds = {Math::min(bounds.min(), position), Math::max(bounds.max(), position)};
+    CORRADE_COMPARE(bvh.bounds(), bounds);
+}
+
+void TriangleBvhTest::constructEmpty() {
+    const TriangleBvh bvh{{}, {}};
+    CORRADE_COMPARE(bvh.triangleCount(), 0);
+    CORRADE_COMPARE(bvh.nodeCount(), 0);
+    CORRADE_COMPARE(bvh.bounds(), Range3D{});
+    CORRADE_COMPARE(bvh.raycast({}, Vector3::xAxis()).triangle, TriangleBvh::NoTriangle);
+    CORRADE_VERIFY(bvh.query(Range3D{Vector3{-1.0f}, Vector3{1.0f}}).empty());
+}
+
+void TriangleBvhTest::constructMeshData() {
+    /* Two quads facing the ray, the second one nearer */
+    const Trade::MeshData3D mesh{MeshPrimitive::Triangles,
+        {0, 1, 2, 0, 2, 3, 4, 5, 6, 4, 6, 7},
+        {{{-1.0f, -1.0f, 0.0f}, {1.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 0.0f}, {-1.0f, 1.0f, 0.0f},
+          {-1.0f, -1.0f, 2.0f}, {1.0f, -1.0f, 2.0f}, {1.0f, 1.0f, 2.0f}, {-1.0f, 1.0f, 2.0f}}},
+        {}, {}};
+    const TriangleBvh bvh{mesh};
+    CORRADE_COMPARE(bvh.triangleCount(), 4);
+
+    const TriangleBvh::RaycastHit hit = bvh.raycast({0.5f, 0.25f, 5.0f}, -Vector3::zAxis());
+    CORRADE_COMPARE(hit.triangle, 2);
+    CORRADE_COMPARE(hit.distance, 3.0f);
+}
+
+void TriangleBvhTest::constructMeshDataNonIndexed() {
+    const Trade::MeshData3D mesh{MeshPrimitive::Triangles, {},
+        {{{-1.0f, -1.0f, 0.0f}, {1.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 0.0f},
+          {-1.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 0.0f}, {-1.0f, 1.0f, 0.0f}}},
+        {}, {}};
+    const TriangleBvh bvh{mesh};
+    CORRADE_COMPARE(bvh.triangleCount(), 2);
+    CORRADE_COMPARE(bvh.raycast({-0.5f, 0.5f, 1.0f}, -Vector3::zAxis()).triangle, 1);
+}
+
+void TriangleBvhTest::constructMeshDataNotTriangles() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const Trade::MeshData3D mesh{MeshPrimitive::Lines, {}, {{}}, {}, {}};
+    TriangleBvh bvh{mesh};
+    CORRADE_COMPARE(out.str(), "Shapes::TriangleBvh: expected triangle mesh, got MeshPrimitive::Lines\n");
+}
+
+void TriangleBvhTest::constructInvalidIndexCount() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    TriangleBvh bvh{{0, 1, 2, 0}, {{}, {}, {}}};
+    CORRADE_COMPARE(out.str(), "Shapes::TriangleBvh: index count is not divisible by 3\n");
+}
+
+void TriangleBvhTest::constructParallel() {
+    const Soup soup{5000};
+    const TriangleBvh bvh{soup.indices, soup.positions};
+    const TriangleBvh parallel{soup.indices, soup.positions, 4};
+
+    /* Same tree regardless of thread count */
+    CORRADE_COMPARE(parallel.nodeCount(), bvh.nodeCount());
+    CORRADE_COMPARE(parallel.depth(), bvh.depth());
+    CORRADE_COMPARE(parallel.query(Range3D{Vector3{-2.0f}, Vector3{3.0f}}), bvh.query(Range3D{Vector3{-2.0f}, Vector3{3.0f}}));
+
+    UnsignedInt seed = 3;
+    for(std::size_t i = 0; i != 100; ++i) {
+        const Vector3 origin = vector(seed)*15.0f;
+        const Vector3 direction = -origin + vector(seed)*5.0f;
+        CORRADE_COMPARE(parallel.raycast(origin, direction).triangle, bvh.raycast(origin, direction).triangle);
+    }
+}
+
+void TriangleBvhTest::raycast() {
+    const Soup soup{2000};
+    const TriangleBvh bvh{soup.indices, soup.positions};
+
+    /* Rays from outside towards the center, most of them hit something */
+    UnsignedInt seed = 11;
+    std::size_t hitCount = 0;
+    for(std::size_t i = 0; i != 200; ++i) {
+        const Vector3 origin = vector(seed)*15.0f;
+        const Vector3 direction = (-origin + vector(seed)*5.0f).normalized();
+
+        const TriangleBvh::RaycastHit expected = soup.raycast(origin, direction);
+        const TriangleBvh::RaycastHit hit = bvh.raycast(origin, direction);
+        CORRADE_COMPARE(hit.triangle, expected.triangle);
+        CORRADE_COMPARE(hit.distance, expected.distance);
+        if(hit.triangle != TriangleBvh::NoTriangle) ++hitCount;
+    }
+
+    CORRADE_VERIFY(hitCount > 50 && hitCount < 200);
+}
+
+void TriangleBvhTest::raycastMaxDistance() {
+    const std::vector<Vector3> positions{
+        {-1.0f, -1.0f, 2.0f}, {1.0f, -1.0f, 2.0f}, {0.0f, 1.0f, 2.0f}};
+    const TriangleBvh bvh{{0, 1, 2}, positions};
+
+    CORRADE_COMPARE(bvh.raycast({}, Vector3::zAxis(), 2.0f).triangle, 0);
+
+    const TriangleBvh::RaycastHit hit = bvh.raycast({}, Vector3::zAxis(), 1.5f);
+    CORRADE_COMPARE(hit.triangle, TriangleBvh::NoTriangle);
+    CORRADE_COMPARE(hit.distance, Constants::inf());
+}
+
+void TriangleBvhTest::raycastPacket() {
+    const Soup soup{2000};
+    const TriangleBvh bvh{soup.indices, soup.positions};
+
+    /* Coherent rays from one point, count not divisible by packet size */
+    constexpr std::size_t Count = 21*21;
+    Containers::Array<Vector3> origins{Count};
+    Containers::Array<Vector3> directions{Count};
+    for(std::size_t i = 0; i != Count; ++i) {
+        origins[i] = {0.0f, 0.0f, 20.0f};
+        directions[i] = {(Float(i%21) - 10.0f)*0.1f, (Float(i/21) - 10.0f)*0.1f, -1.0f};
+    }
+
+    Containers::Array<TriangleBvh::RaycastHit> hits{Count};
+    bvh.raycast(origins, directions, hits);
+
+    for(std::size_t i = 0; i != Count; ++i) {
+        const TriangleBvh::RaycastHit expected = bvh.raycast(origins[i], directions[i]);
+        CORRADE_COMPARE(hits[i].triangle, expected.triangle);
+        CORRADE_COMPARE(hits[i].distance, expected.distance);
+    }
+}
+
+void TriangleBvhTest::raycastPacketSizeMismatch() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const TriangleBvh bvh{{}, {}};
+    Containers::Array<Vector3> origins{3};
+    Containers::Array<Vector3> directions{2};
+    Containers::Array<TriangleBvh::RaycastHit> hits{3};
+    bvh.raycast(origins, directions, hits);
+    CORRADE_COMPARE(out.str(), "Shapes::TriangleBvh::raycast(): expected views of the same size\n");
+}
+
+void TriangleBvhTest::queryRange() {
+    const Soup soup{2000};
+    const TriangleBvh bvh{soup.indices, soup.positions};
+
+    const Range3D range{{-3.0f, -2.0f, -5.0f}, {4.0f, 1.0f, 0.0f}};
+    std::vector<UnsignedInt> expected;
+    for(UnsignedInt i = 0; i != soup.indices.size()/3; ++i) {
+        const Vector3& a = soup.positions[soup.indices[i*3]];
+        const Vector3& b = soup.positions[soup.indices[i*3 + 1]];
+        const Vector3& c = soup.positions[soup.indices[i*3 + 2]];
+        const Vector3 min = Math::min(Math::min(a, b), c);
+        const Vector3 max = Math::max(Math::max(a, b), c);
+        if((min <= range.max()).all() && (range.min() <= max).all())
+            expected.push_back(i);
+    }
+
+    CORRADE_VERIFY(!expected.empty());
+    CORRADE_COMPARE(bvh.query(range), expected);
+}
+
+void TriangleBvhTest::queryFrustum() {
+    const Soup soup{2000};
+    const TriangleBvh bvh{soup.indices, soup.positions};
+
+    /* Box-shaped frustum, planes pointing inside */
+    const Range3D range{{-3.0f, -2.0f, -5.0f}, {4.0f, 1.0f, 0.0f}};
+    const Vector4 frustum[6]{
+        { 1.0f,  0.0f,  0.0f, -range.min().x()},
+        {-1.0f,  0.0f,  0.0f,  range.max().x()},
+        { 0.0f,  1.0f,  0.0f, -range.min().y()},
+        { 0.0f, -1.0f,  0.0f,  range.max().y()},
+        { 0.0f,  0.0f,  1.0f, -range.min().z()},
+        { 0.0f,  0.0f, -1.0f,  range.max().z()}};
+
+    /* The result is conservative, containing everything in the range, but
+       not everything */
+    const std::vector<UnsignedInt> visible = bvh.query(frustum);
+    const std::vector<UnsignedInt> inRange = bvh.query(range);
+    CORRADE_VERIFY(std::includes(visible.begin(), visible.end(), inRange.begin(), inRange.end()));
+    CORRADE_VERIFY(visible.size() < bvh.triangleCount()/2);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shapes::Test::TriangleBvhTest)
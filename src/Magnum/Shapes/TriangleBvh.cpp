@@ -0,0 +1,426 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "TriangleBvh.h"
+
+#include <algorithm>
+#include <thread>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Geometry/Intersection.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+#if !defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(CORRADE_TARGET_NACL)
+#include "Magnum/TaskScheduler.h"
+#endif
+
+namespace Magnum { namespace Shapes {
+
+namespace {
+
+/* Centroids along the split axis are sorted into this many bins, the split
+   is then searched only between the bins */
+constexpr UnsignedInt BinCount = 16;
+
+/* Leaves larger than this are split even if the SAH says it's not worth it */
+constexpr std::size_t MaxLeafSize = 8;
+
+/* Cost of traversing a node relative to a triangle test */
+constexpr Float TraversalCost = 1.0f;
+
+inline Range3D join(const Range3D& a, const Range3D& b) {
+    return {Math::min(a.min(), b.min()), Math::max(a.max(), b.max())};
+}
+
+/* Half of the surface area */
+inline Float area(const Range3D& range) {
+    const Vector3 size = range.size();
+    return size.x()*size.y() + size.y()*size.z() + size.z()*size.x();
+}
+
+inline bool overlaps(const Range3D& a, const Range3D& b) {
+    return (a.min() <= b.max()).all() && (b.min() <= a.max()).all();
+}
+
+inline Float raycastBounds(const Vector3& origin, const Vector3& direction, const Range3D& bounds) {
+    return Math::Geometry::Intersection::rayAabb(origin, direction, bounds.min(), bounds.max());
+}
+
+}
+
+struct TriangleBvh::Builder {
+    /* Returns depth of the built subtree */
+    std::size_t build(std::size_t begin, std::size_t end, std::vector<Node>& nodes, std::size_t depth);
+
+    const std::vector<Range3D>& bounds;
+    const std::vector<Vector3>& centroids;
+    std::vector<UnsignedInt>& triangles;
+    std::size_t parallelDepth;
+};
+
+std::size_t TriangleBvh::Builder::build(const std::size_t begin, const std::size_t end, std::vector<Node>& nodes, const std::size_t depth) {
+    const std::size_t index = nodes.size();
+    nodes.push_back({});
+
+    Range3D nodeBounds = bounds[triangles[begin]];
+    Range3D centroidBounds{centroids[triangles[begin]], centroids[triangles[begin]]};
+    for(std::size_t i = begin + 1; i != end; ++i) {
+        nodeBounds = join(nodeBounds, bounds[triangles[i]]);
+        centroidBounds = join(centroidBounds, {centroids[triangles[i]], centroids[triangles[i]]});
+    }
+    nodes[index].bounds = nodeBounds;
+
+    const std::size_t count = end - begin;
+    if(count <= 2) {
+        nodes[index].offset = begin;
+        nodes[index].count = count;
+        return 1;
+    }
+
+    /* Find the cheapest split between bins along all axes */
+    Float bestCost = Constants::inf();
+    std::size_t bestAxis = 0;
+    UnsignedInt bestBin = 0;
+    for(std::size_t axis = 0; axis != 3; ++axis) {
+        const Float extent = centroidBounds.size()[axis];
+        if(extent <= 0.0f) continue;
+
+        const Float scale = BinCount/extent;
+        const Float min = centroidBounds.min()[axis];
+        const auto binOf = [&](const UnsignedInt triangle) {
+            return Math::min(UnsignedInt((centroids[triangle][axis] - min)*scale), BinCount - 1);
+        };
+
+        std::size_t binCounts[BinCount]{};
+        Range3D binBounds[BinCount];
+        for(std::size_t i = begin; i != end; ++i) {
+            const UnsignedInt bin = binOf(triangles[i]);
+            binBounds[bin] = binCounts[bin] ? join(binBounds[bin], bounds[triangles[i]]) : bounds[triangles[i]];
+            ++binCounts[bin];
+        }
+
+        /* Sweep from the right to get costs of right sides, then from the
+           left */
+        Float rightCosts[BinCount];
+        std::size_t rightCount = 0;
+        Range3D rightBounds;
+        for(UnsignedInt bin = BinCount - 1; bin != 0; --bin) {
+            if(binCounts[bin]) rightBounds = rightCount ? join(rightBounds, binBounds[bin]) : binBounds[bin];
+            rightCount += binCounts[bin];
+            rightCosts[bin] = rightCount ? rightCount*area(rightBounds) : Constants::inf();
+        }
+
+        std::size_t leftCount = 0;
+        Range3D leftBounds;
+        for(UnsignedInt bin = 0; bin != BinCount - 1; ++bin) {
+            if(binCounts[bin]) leftBounds = leftCount ? join(leftBounds, binBounds[bin]) : binBounds[bin];
+            leftCount += binCounts[bin];
+            if(!leftCount) continue;
+
+            const Float cost = leftCount*area(leftBounds) + rightCosts[bin + 1];
+            if(cost < bestCost) {
+                bestCost = cost;
+                bestAxis = axis;
+                bestBin = bin;
+            }
+        }
+    }
+
+    /* All centroids in one place, nothing to split */
+    std::size_t middle;
+    if(bestCost == Constants::inf()) {
+        if(count <= MaxLeafSize) {
+            nodes[index].offset = begin;
+            nodes[index].count = count;
+            return 1;
+        }
+
+        middle = begin + count/2;
+
+    } else {
+        /* Not worth splitting */
+        const Float nodeArea = area(nodeBounds);
+        if(count <= MaxLeafSize && TraversalCost*nodeArea + bestCost >= count*nodeArea) {
+            nodes[index].offset = begin;
+            nodes[index].count = count;
+            return 1;
+        }
+
+        const Float scale = BinCount/centroidBounds.size()[bestAxis];
+        const Float min = centroidBounds.min()[bestAxis];
+        middle = std::partition(triangles.begin() + begin, triangles.begin() + end, [&](const UnsignedInt triangle) {
+            return Math::min(UnsignedInt((centroids[triangle][bestAxis] - min)*scale), BinCount - 1) <= bestBin;
+        }) - triangles.begin();
+    }
+
+    /* Build the right subtree in a separate task into a separate array and
+       then append it, fixing the child indices. The wait executes other
+       tasks in the meantime, so the nested forks don't block the pool. */
+    std::size_t leftDepth, rightDepth;
+    #if !defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(CORRADE_TARGET_NACL)
+    if(depth < parallelDepth) {
+        std::vector<Node> right;
+        TaskScheduler& scheduler = TaskScheduler::global();
+        const TaskScheduler::TaskHandle task = scheduler.submit([&]() {
+            rightDepth = build(middle, end, right, depth + 1);
+        });
+        leftDepth = build(begin, middle, nodes, depth + 1);
+        scheduler.wait(task);
+
+        const UnsignedInt rightIndex = nodes.size();
+        nodes[index].offset = rightIndex;
+        nodes.reserve(nodes.size() + right.size());
+        for(Node node: right) {
+            if(!node.count) node.offset += rightIndex;
+            nodes.push_back(node);
+        }
+
+    } else
+    #endif
+    {
+        leftDepth = build(begin, middle, nodes, depth + 1);
+        nodes[index].offset = nodes.size();
+        rightDepth = build(middle, end, nodes, depth + 1);
+    }
+
+    return 1 + Math::max(leftDepth, rightDepth);
+}
+
+TriangleBvh::TriangleBvh(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const UnsignedInt threadCount): _depth{} {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "Shapes::TriangleBvh: index count is not divisible by 3", );
+
+    build(indices, positions, threadCount);
+}
+
+TriangleBvh::TriangleBvh(const Trade::MeshData3D& mesh, const UnsignedInt threadCount): _depth{} {
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles,
+        "Shapes::TriangleBvh: expected triangle mesh, got" << mesh.primitive(), );
+
+    const std::vector<Vector3>& positions = mesh.positions(0);
+    if(mesh.isIndexed()) {
+        CORRADE_ASSERT(mesh.indices().size() % 3 == 0,
+            "Shapes::TriangleBvh: index count is not divisible by 3", );
+        build(mesh.indices(), positions, threadCount);
+    } else {
+        CORRADE_ASSERT(positions.size() % 3 == 0,
+            "Shapes::TriangleBvh: vertex count is not divisible by 3", );
+        std::vector<UnsignedInt> indices(positions.size());
+        for(std::size_t i = 0; i != indices.size(); ++i) indices[i] = i;
+        build(indices, positions, threadCount);
+    }
+}
+
+void TriangleBvh::build(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, UnsignedInt threadCount) {
+    const std::size_t triangleCount = indices.size()/3;
+    if(!triangleCount) return;
+
+    std::vector<Range3D> bounds(triangleCount);
+    std::vector<Vector3> centroids(triangleCount);
+    for(std::size_t i = 0; i != triangleCount; ++i) {
+        const Vector3& a = positions[indices[i*3]];
+        const Vector3& b = positions[indices[i*3 + 1]];
+        const Vector3& c = positions[indices[i*3 + 2]];
+        bounds[i] = {Math::min(Math::min(a, b), c), Math::max(Math::max(a, b), c)};
+        centroids[i] = (a + b + c)/3.0f;
+    }
+
+    _triangles.resize(triangleCount);
+    for(std::size_t i = 0; i != triangleCount; ++i) _triangles[i] = i;
+
+    /* Each level doubles the count of tasks */
+    if(!threadCount) threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    std::size_t parallelDepth = 0;
+    while((1u << parallelDepth) < threadCount) ++parallelDepth;
+
+    /* The tree has at most 2n - 1 nodes */
+    _nodes.reserve(2*triangleCount - 1);
+    Builder builder{bounds, centroids, _triangles, parallelDepth};
+    _depth = builder.build(0, triangleCount, _nodes, 0);
+
+    /* Copy the vertices in leaf order */
+    _vertices.reserve(triangleCount*3);
+    for(const UnsignedInt triangle: _triangles)
+        for(std::size_t i = 0; i != 3; ++i)
+            _vertices.push_back(positions[indices[triangle*3 + i]]);
+}
+
+Range3D TriangleBvh::bounds() const {
+    return _nodes.empty() ? Range3D{} : _nodes.front().bounds;
+}
+
+auto TriangleBvh::raycast(const Vector3& origin, const Vector3& direction, const Float maxDistance) const -> RaycastHit {
+    RaycastHit hit{NoTriangle, maxDistance};
+    const Float rootDistance = _nodes.empty() ? Constants::inf() : raycastBounds(origin, direction, _nodes.front().bounds);
+    if(rootDistance == Constants::inf() || rootDistance > maxDistance) {
+        hit.distance = Constants::inf();
+        return hit;
+    }
+
+    /* Stack of nodes together with the distance at which the ray enters
+       them, so nodes behind the nearest hit found so far can be skipped */
+    std::vector<std::pair<UnsignedInt, Float>> stack;
+    stack.reserve(_depth + 1);
+    stack.emplace_back(0, rootDistance);
+    while(!stack.empty()) {
+        const std::pair<UnsignedInt, Float> top = stack.back();
+        stack.pop_back();
+        if(top.second > hit.distance) continue;
+
+        const Node& node = _nodes[top.first];
+        if(node.count) {
+            for(std::size_t i = node.offset, end = node.offset + node.count; i != end; ++i) {
+                const Float t = Math::Geometry::Intersection::rayTriangle(origin, direction, _vertices[i*3], _vertices[i*3 + 1], _vertices[i*3 + 2]);
+                if(t != Constants::inf() && t <= hit.distance) hit = {_triangles[i], t};
+            }
+            continue;
+        }
+
+        /* Visit the nearer child first */
+        std::pair<UnsignedInt, Float> left{top.first + 1, raycastBounds(origin, direction, _nodes[top.first + 1].bounds)};
+        std::pair<UnsignedInt, Float> right{node.offset, raycastBounds(origin, direction, _nodes[node.offset].bounds)};
+        if(left.second > right.second) std::swap(left, right);
+        if(right.second != Constants::inf() && right.second <= hit.distance) stack.push_back(right);
+        if(left.second != Constants::inf() && left.second <= hit.distance) stack.push_back(left);
+    }
+
+    if(hit.triangle == NoTriangle) hit.distance = Constants::inf();
+    return hit;
+}
+
+void TriangleBvh::raycast(const Containers::ArrayView<const Vector3> origins, const Containers::ArrayView<const Vector3> directions, const Containers::ArrayView<RaycastHit> hits) const {
+    CORRADE_ASSERT(origins.size() == hits.size() && directions.size() == hits.size(),
+        "Shapes::TriangleBvh::raycast(): expected views of the same size", );
+
+    for(RaycastHit& hit: hits) hit = {NoTriangle, Constants::inf()};
+    if(_nodes.empty()) return;
+
+    constexpr std::size_t PacketSize = 8;
+    std::vector<UnsignedInt> stack;
+    stack.reserve(_depth + 1);
+    for(std::size_t packet = 0; packet < hits.size(); packet += PacketSize) {
+        const std::size_t size = Math::min(PacketSize, hits.size() - packet);
+        const Vector3* const origin = origins + packet;
+        const Vector3* const direction = directions + packet;
+        RaycastHit* const hit = hits + packet;
+
+        /* The whole packet descends into a node if any of the rays can hit
+           something nearer than what it has found so far */
+        stack.push_back(0);
+        while(!stack.empty()) {
+            const UnsignedInt index = stack.back();
+            stack.pop_back();
+
+            bool active[PacketSize];
+            bool anyActive = false;
+            for(std::size_t i = 0; i != size; ++i) {
+                const Float t = raycastBounds(origin[i], direction[i], _nodes[index].bounds);
+                active[i] = t != Constants::inf() && t <= hit[i].distance;
+                anyActive |= active[i];
+            }
+            if(!anyActive) continue;
+
+            const Node& node = _nodes[index];
+            if(node.count) {
+                for(std::size_t j = node.offset, end = node.offset + node.count; j != end; ++j) {
+                    for(std::size_t i = 0; i != size; ++i) {
+                        if(!active[i]) continue;
+                        const Float t = Math::Geometry::Intersection::rayTriangle(origin[i], direction[i], _vertices[j*3], _vertices[j*3 + 1], _vertices[j*3 + 2]);
+                        if(t != Constants::inf() && t <= hit[i].distance) hit[i] = {_triangles[j], t};
+                    }
+                }
+                continue;
+            }
+
+            /* Order the children by the first active ray, which works well
+               for coherent packets */
+            std::size_t first = 0;
+            while(!active[first]) ++first;
+            UnsignedInt left = index + 1, right = node.offset;
+            if(raycastBounds(origin[first], direction[first], _nodes[left].bounds) > raycastBounds(origin[first], direction[first], _nodes[right].bounds))
+                std::swap(left, right);
+            stack.push_back(right);
+            stack.push_back(left);
+        }
+    }
+}
+
+std::vector<UnsignedInt> TriangleBvh::query(const Range3D& bounds) const {
+    std::vector<UnsignedInt> out;
+    if(_nodes.empty()) return out;
+
+    std::vector<UnsignedInt> stack{0};
+    while(!stack.empty()) {
+        const UnsignedInt index = stack.back();
+        const Node& node = _nodes[index];
+        stack.pop_back();
+
+        if(!overlaps(node.bounds, bounds)) continue;
+
+        if(node.count) {
+            for(std::size_t i = node.offset, end = node.offset + node.count; i != end; ++i) {
+                const Vector3& a = _vertices[i*3];
+                const Vector3& b = _vertices[i*3 + 1];
+                const Vector3& c = _vertices[i*3 + 2];
+                if(overlaps({Math::min(Math::min(a, b), c), Math::max(Math::max(a, b), c)}, bounds))
+                    out.push_back(_triangles[i]);
+            }
+        } else {
+            stack.push_back(node.offset);
+            stack.push_back(index + 1);
+        }
+    }
+
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+std::vector<UnsignedInt> TriangleBvh::query(const Vector4(&frustum)[6]) const {
+    std::vector<UnsignedInt> out;
+    if(_nodes.empty()) return out;
+
+    std::vector<UnsignedInt> stack{0};
+    while(!stack.empty()) {
+        const UnsignedInt index = stack.back();
+        const Node& node = _nodes[index];
+        stack.pop_back();
+
+        if(!Math::Geometry::Intersection::aabbFrustum(node.bounds.center(), node.bounds.size()*0.5f, frustum)) continue;
+
+        if(node.count) out.insert(out.end(), _triangles.begin() + node.offset, _triangles.begin() + node.offset + node.count);
+        else {
+            stack.push_back(node.offset);
+            stack.push_back(index + 1);
+        }
+    }
+
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+}}
@@ -0,0 +1,211 @@
+#ifndef Magnum_Shapes_TriangleBvh_h
+#define Magnum_Shapes_TriangleBvh_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Shapes::TriangleBvh
+ */
+
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/Shapes/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace Shapes {
+
+/**
+@brief Bounding volume hierarchy over triangle mesh
+
+Static acceleration structure for ray and overlap queries against render
+geometry, such as picking or lightmap baking. Unlike @ref AabbTree, which is
+optimized for frequently moving shapes, this tree is built once and can't be
+modified afterwards.
+
+The tree is built top-down, each node is split along the axis and position
+with the lowest surface area heuristic cost, evaluated over 16 bins of
+triangle centroids. Nodes end up in a single array in depth-first order, so
+left child always directly follows its parent, and vertex positions are
+copied into the leaf order, making traversal mostly sequential in memory.
+Top levels of the tree can be built in parallel on
+@ref TaskScheduler::global(), the result is the same regardless of thread
+count.
+
+Example usage for picking:
+@code
+Trade::MeshData3D mesh = ...;
+Shapes::TriangleBvh bvh{mesh};
+
+const Shapes::TriangleBvh::RaycastHit hit = bvh.raycast(origin, direction);
+if(hit.triangle != Shapes::TriangleBvh::NoTriangle) {
+    Vector3 position = origin + direction*hit.distance;
+    // ...
+}
+@endcode
+
+Coherent rays, for example from a lightmap texel or a screen tile, can be
+traced together with @ref raycast(Containers::ArrayView<const Vector3>, Containers::ArrayView<const Vector3>, Containers::ArrayView<RaycastHit>) const,
+which traverses the tree once for whole packet of rays.
+
+@ref query(const Range3D&) const and @ref query(const Vector4(&)[6]) const
+return triangles in given box or frustum, which is useful e.g. for culling or
+selecting detail level of parts of large meshes.
+@see @ref Math::Geometry::Intersection::rayTriangle()
+*/
+class MAGNUM_SHAPES_EXPORT TriangleBvh {
+    public:
+        enum: UnsignedInt {
+            NoTriangle = ~UnsignedInt{} /**< Triangle ID if nothing was hit */
+        };
+
+        /**
+         * @brief Ray hit
+         *
+         * @see @ref raycast()
+         */
+        struct RaycastHit {
+            /** @brief Hit triangle or @ref NoTriangle if nothing was hit */
+            UnsignedInt triangle;
+
+            /**
+             * @brief Position of the hit on the ray
+             *
+             * The hit point is `origin + distance*direction`, if the
+             * direction is normalized, this is the distance from ray origin.
+             * Infinity if nothing was hit.
+             */
+            Float distance;
+        };
+
+        /**
+         * @brief Constructor
+         * @param indices       Triangle indices. Size is expected to be
+         *      divisible by 3.
+         * @param positions     Vertex positions
+         * @param threadCount   Count of threads to use for the build. If set
+         *      to `0`, `std::thread::hardware_concurrency()` is used.
+         *
+         * Triangle IDs reported by queries are positions of the triangles in
+         * @p indices divided by 3. The data are copied, so they don't need to
+         * stay in scope after the tree is built.
+         */
+        explicit TriangleBvh(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, UnsignedInt threadCount = 1);
+
+        /**
+         * @brief Construct from mesh data
+         *
+         * Builds the tree from the first position array of given mesh. The
+         * mesh is expected to have @ref MeshPrimitive::Triangles primitive,
+         * non-indexed meshes are treated as triangle lists.
+         */
+        explicit TriangleBvh(const Trade::MeshData3D& mesh, UnsignedInt threadCount = 1);
+
+        /** @brief Triangle count */
+        std::size_t triangleCount() const { return _triangles.size(); }
+
+        /** @brief Node count */
+        std::size_t nodeCount() const { return _nodes.size(); }
+
+        /** @brief Tree depth */
+        std::size_t depth() const { return _depth; }
+
+        /**
+         * @brief Bounds of whole mesh
+         *
+         * Zero-size range at origin for an empty mesh.
+         */
+        Range3D bounds() const;
+
+        /**
+         * @brief Nearest triangle hit by a ray
+         * @param origin        Ray origin
+         * @param direction     Ray direction
+         * @param maxDistance   Maximal position of the hit on the ray
+         *
+         * Both sides of the triangles are hit. If more triangles are hit at
+         * the same distance, it's unspecified which one is returned.
+         */
+        RaycastHit raycast(const Vector3& origin, const Vector3& direction, Float maxDistance = Constants::inf()) const;
+
+        /**
+         * @brief Nearest triangles hit by packet of rays
+         * @param origins       Ray origins
+         * @param directions    Ray directions
+         * @param[out] hits     Nearest hit for each ray
+         *
+         * Equivalent to calling @ref raycast(const Vector3&, const Vector3&, Float) const
+         * for each ray, but the rays are processed in packets of eight that
+         * traverse the tree together, which saves node visits for coherent
+         * rays. All views are expected to have the same size.
+         */
+        void raycast(Containers::ArrayView<const Vector3> origins, Containers::ArrayView<const Vector3> directions, Containers::ArrayView<RaycastHit> hits) const;
+
+        /**
+         * @brief Triangles overlapping a box
+         *
+         * Returns IDs of all triangles whose bounds overlap given range,
+         * sorted. The test is conservative, triangles near box corners might
+         * be reported even though they don't intersect it.
+         */
+        std::vector<UnsignedInt> query(const Range3D& bounds) const;
+
+        /**
+         * @brief Triangles in a frustum
+         *
+         * Returns IDs of all triangles in leaves whose bounds intersect given
+         * frustum, sorted. Frustum planes are expected in the same format as
+         * in @ref Math::Geometry::Intersection::aabbFrustum(). The test is
+         * conservative.
+         */
+        std::vector<UnsignedInt> query(const Vector4(&frustum)[6]) const;
+
+    private:
+        struct Node {
+            Range3D bounds;
+            /* Index of the right child for inner nodes, index of first
+               triangle for leaves */
+            UnsignedInt offset;
+            /* Zero for inner nodes */
+            UnsignedInt count;
+        };
+
+        struct Builder;
+
+        MAGNUM_SHAPES_LOCAL void build(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, UnsignedInt threadCount);
+
+        std::vector<Node> _nodes;
+        /* Original triangle IDs and their vertex positions in leaf order */
+        std::vector<UnsignedInt> _triangles;
+        std::vector<Vector3> _vertices;
+        std::size_t _depth;
+};
+
+}}
+
+#endif
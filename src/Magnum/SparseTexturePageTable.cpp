@@ -0,0 +1,209 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SparseTexturePageTable.h"
+
+#include <algorithm>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/TextureFormat.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+
+#ifndef MAGNUM_TARGET_GLES
+namespace Magnum {
+
+SparseTexturePageTable::SparseTexturePageTable(const TextureFormat format, const Vector2i& size, const Int levelCount, const UnsignedInt maxPageCount, const Int pageSizeIndex, const UnsignedInt bufferCount): _queue{bufferCount}, _size{size}, _pageSize{Texture2D::virtualPageSize(format, pageSizeIndex)}, _levelCount{levelCount}, _maxPageCount{maxPageCount}, _frame{1}, _evictionCount{} {
+    CORRADE_ASSERT(levelCount > 0, "SparseTexturePageTable: expected at least one level", );
+
+    _texture.setSparse(true)
+        .setVirtualPageSizeIndex(pageSizeIndex)
+        .setStorage(levelCount, format, size);
+    _sparseLevelCount = Math::min(_texture.sparseLevelCount(), levelCount);
+
+    _lastRequested.resize(_sparseLevelCount);
+    _committed.resize(_sparseLevelCount);
+    for(Int level = 0; level != _sparseLevelCount; ++level) {
+        const std::size_t count = pageCount(level).product();
+        _lastRequested[level].resize(count);
+        _committed[level].resize(count);
+    }
+
+    /* Committing any level of the mip tail commits all of them */
+    if(_sparseLevelCount != _levelCount)
+        _texture.commitPages(_sparseLevelCount, {{}, levelSize(_sparseLevelCount)});
+}
+
+Vector2i SparseTexturePageTable::levelSize(const Int level) const {
+    return Math::max(Vector2i{_size.x() >> level, _size.y() >> level}, Vector2i{1});
+}
+
+Vector2i SparseTexturePageTable::pageCount(const Int level) const {
+    return (levelSize(level) + _pageSize - Vector2i{1})/_pageSize;
+}
+
+std::size_t SparseTexturePageTable::pageIndex(const Int level, const Vector2i& page) const {
+    const Vector2i count = pageCount(level);
+    CORRADE_INTERNAL_ASSERT(page.x() >= 0 && page.y() >= 0 && page.x() < count.x() && page.y() < count.y());
+    return page.y()*count.x() + page.x();
+}
+
+Range2Di SparseTexturePageTable::pageRange(const Int level, const Vector2i& page) const {
+    const Vector2i offset = page*_pageSize;
+    return {offset, Math::min(offset + _pageSize, levelSize(level))};
+}
+
+bool SparseTexturePageTable::isResident(const Int level, const Vector2i& page) const {
+    CORRADE_ASSERT(level >= 0 && level < _levelCount,
+        "SparseTexturePageTable::isResident(): level" << level << "out of range for" << _levelCount << "levels", false);
+    if(level >= _sparseLevelCount) return true;
+    return _committed[level][pageIndex(level, page)];
+}
+
+SparseTexturePageTable& SparseTexturePageTable::setTailImage(const Int level, const ImageView2D& image) {
+    CORRADE_ASSERT(level >= _sparseLevelCount && level < _levelCount,
+        "SparseTexturePageTable::setTailImage(): level" << level << "is not in the mip tail", *this);
+    CORRADE_ASSERT(image.size() == levelSize(level),
+        "SparseTexturePageTable::setTailImage(): expected image of size" << levelSize(level) << "but got" << image.size(), *this);
+
+    _queue.upload(_texture, level, {}, image);
+    return *this;
+}
+
+SparseTexturePageTable& SparseTexturePageTable::request(const Int level, const Vector2i& page) {
+    CORRADE_ASSERT(level >= 0 && level < _levelCount,
+        "SparseTexturePageTable::request(): level" << level << "out of range for" << _levelCount << "levels", *this);
+
+    /* Mip tail is always resident */
+    if(level >= _sparseLevelCount) return *this;
+
+    const std::size_t index = pageIndex(level, page);
+    UnsignedInt& lastRequested = _lastRequested[level][index];
+    if(lastRequested == _frame) return *this;
+
+    lastRequested = _frame;
+    if(!_committed[level][index]) _missing.emplace_back(level, page);
+    return *this;
+}
+
+std::vector<std::pair<Int, Vector2i>> SparseTexturePageTable::missingPages() const {
+    std::vector<std::pair<Int, Vector2i>> out;
+    out.reserve(_missing.size());
+    for(const auto& page: _missing)
+        if(!_committed[page.first][pageIndex(page.first, page.second)])
+            out.push_back(page);
+
+    std::stable_sort(out.begin(), out.end(), [](const std::pair<Int, Vector2i>& a, const std::pair<Int, Vector2i>& b) {
+        return a.first > b.first;
+    });
+    return out;
+}
+
+bool SparseTexturePageTable::evict() {
+    /* Find the least recently requested page that's not needed in this frame */
+    std::size_t found = _resident.size();
+    UnsignedInt foundFrame = _frame;
+    for(std::size_t i = 0; i != _resident.size(); ++i) {
+        const UnsignedInt lastRequested = _lastRequested[_resident[i].level][pageIndex(_resident[i].level, _resident[i].page)];
+        if(lastRequested < foundFrame) {
+            found = i;
+            foundFrame = lastRequested;
+        }
+    }
+
+    if(found == _resident.size()) return false;
+
+    decommit(_resident[found].level, _resident[found].page);
+    ++_evictionCount;
+    return true;
+}
+
+bool SparseTexturePageTable::commit(const Int level, const Vector2i& page, const ImageView2D& image) {
+    CORRADE_ASSERT(level >= 0 && level < _sparseLevelCount,
+        "SparseTexturePageTable::commit(): level" << level << "is not paged, use setTailImage() instead", false);
+
+    const std::size_t index = pageIndex(level, page);
+    const Range2Di range = pageRange(level, page);
+    CORRADE_ASSERT(image.size() == range.size(),
+        "SparseTexturePageTable::commit(): expected image of size" << range.size() << "but got" << image.size(), false);
+
+    if(!_committed[level][index]) {
+        if(_resident.size() >= _maxPageCount && !evict()) return false;
+
+        _texture.commitPages(level, range);
+        _committed[level][index] = true;
+        _resident.push_back({level, page});
+    }
+
+    _queue.upload(_texture, level, range.min(), image);
+    return true;
+}
+
+SparseTexturePageTable& SparseTexturePageTable::decommit(const Int level, const Vector2i& page) {
+    CORRADE_ASSERT(level >= 0 && level < _sparseLevelCount,
+        "SparseTexturePageTable::decommit(): level" << level << "is not paged", *this);
+
+    const std::size_t index = pageIndex(level, page);
+    if(!_committed[level][index]) return *this;
+
+    _texture.decommitPages(level, pageRange(level, page));
+    _committed[level][index] = false;
+
+    auto found = std::find_if(_resident.begin(), _resident.end(), [level, &page](const ResidentPage& resident) {
+        return resident.level == level && resident.page == page;
+    });
+    CORRADE_INTERNAL_ASSERT(found != _resident.end());
+    *found = _resident.back();
+    _resident.pop_back();
+    return *this;
+}
+
+SparseTexturePageTable& SparseTexturePageTable::nextFrame() {
+    _missing.clear();
+    _evictionCount = 0;
+    ++_frame;
+    return *this;
+}
+
+std::vector<UnsignedByte> SparseTexturePageTable::residency() const {
+    const Vector2i count = pageCount(0);
+    std::vector<UnsignedByte> out(count.product(), UnsignedByte(_sparseLevelCount));
+
+    /* Pages have the same size in texels in all levels, so page covering
+       given level 0 page in level `l` has coordinates divided by 2^l */
+    for(Int y = 0; y != count.y(); ++y) for(Int x = 0; x != count.x(); ++x) {
+        for(Int level = 0; level != _sparseLevelCount; ++level) {
+            const Vector2i page = Math::min(Vector2i{x >> level, y >> level}, pageCount(level) - Vector2i{1});
+            if(!_committed[level][pageIndex(level, page)]) continue;
+            out[y*count.x() + x] = UnsignedByte(level);
+            break;
+        }
+    }
+
+    return out;
+}
+
+}
+#endif
@@ -0,0 +1,271 @@
+#ifndef Magnum_SparseTexturePageTable_h
+#define Magnum_SparseTexturePageTable_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef MAGNUM_TARGET_GLES
+/** @file
+ * @brief Class @ref Magnum::SparseTexturePageTable
+ */
+#endif
+
+#include <utility>
+#include <vector>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/Texture.h"
+#include "Magnum/TextureUploadQueue.h"
+
+#ifndef MAGNUM_TARGET_GLES
+namespace Magnum {
+
+/**
+@brief Sparse texture page table
+
+Manages residency of pages of a sparse @ref Texture2D, allowing to have
+textures much larger than available video memory with only the parts that are
+actually visible being resident. The texture is created and owned by the
+table, its pages are committed on demand and filled through a
+@ref TextureUploadQueue2D.
+
+## Usage
+
+Each frame, report pages that are needed for rendering with @ref request(),
+for example based on a feedback pass rendering page coordinates and mip
+levels into a small framebuffer. Pages that are not resident yet are then
+available through @ref missingPages(), coarsest first. Load their data (e.g.
+on a background thread) and commit them with @ref commit():
+@code
+SparseTexturePageTable table{TextureFormat::RGBA8, {16384, 16384}, 7, 512};
+table.texture().setMinificationFilter(Sampler::Filter::Linear, Sampler::Mipmap::Linear);
+
+// levels in the mip tail are not paged, upload them whole
+for(Int level = table.sparseLevelCount(); level != table.levelCount(); ++level)
+    table.setTailImage(level, tailImages[level]);
+
+// each frame
+for(const auto& page: feedbackPages)
+    table.request(page.first, page.second);
+for(const auto& page: table.missingPages())
+    table.commit(page.first, page.second, loadPage(page.first, page.second));
+table.nextFrame();
+@endcode
+
+Page not resident in the texture contains undefined data when sampled. Use
+@ref residency() to tell the shader the finest resident level for each area
+of the texture, so it can clamp the level of detail to it.
+
+@anchor SparseTexturePageTable-residency
+## Residency management
+
+Levels starting from @ref sparseLevelCount() form the mip tail, which can't
+be committed by pages. It is committed as a whole in the constructor and stays
+resident for the whole lifetime of the table, so the texture can always be
+sampled at least at the coarsest levels. When the count of committed pages
+reaches @ref maxPageCount(), @ref commit() decommits the least recently
+requested page first. Pages requested in the current frame are never evicted.
+
+@see @ref TextureStreamer
+@requires_extension Extension @extension{ARB,sparse_texture}
+@requires_gl Sparse textures are not available in OpenGL ES or WebGL.
+*/
+class MAGNUM_EXPORT SparseTexturePageTable {
+    public:
+        /**
+         * @brief Constructor
+         * @param format        Texture format
+         * @param size          Size of level `0`
+         * @param levelCount    Mip level count
+         * @param maxPageCount  Max count of committed pages, excluding the
+         *      mip tail
+         * @param pageSizeIndex Virtual page size index, see
+         *      @ref Texture::virtualPageSize()
+         * @param bufferCount   Staging buffer count of the upload queue
+         *
+         * Creates a sparse texture with immutable storage, queries its
+         * page size and sparse level count and commits the mip tail.
+         * @see @ref Texture::setSparse(),
+         *      @ref Texture::setVirtualPageSizeIndex(),
+         *      @ref Texture::setStorage(), @ref Texture::commitPages()
+         */
+        explicit SparseTexturePageTable(TextureFormat format, const Vector2i& size, Int levelCount, UnsignedInt maxPageCount, Int pageSizeIndex = 0, UnsignedInt bufferCount = 3);
+
+        /** @brief Copying is not allowed */
+        SparseTexturePageTable(const SparseTexturePageTable&) = delete;
+
+        /** @brief Moving is not allowed */
+        SparseTexturePageTable(SparseTexturePageTable&&) = delete;
+
+        /** @brief Copying is not allowed */
+        SparseTexturePageTable& operator=(const SparseTexturePageTable&) = delete;
+
+        /** @brief Moving is not allowed */
+        SparseTexturePageTable& operator=(SparseTexturePageTable&&) = delete;
+
+        /** @brief Managed texture */
+        Texture2D& texture() { return _texture; }
+
+        /** @brief Size of level `0` */
+        Vector2i size() const { return _size; }
+
+        /** @brief Size of given level */
+        Vector2i levelSize(Int level) const;
+
+        /** @brief Mip level count */
+        Int levelCount() const { return _levelCount; }
+
+        /**
+         * @brief Count of levels that can be committed by pages
+         *
+         * Levels starting from this one form the mip tail.
+         * @see @ref Texture::sparseLevelCount()
+         */
+        Int sparseLevelCount() const { return _sparseLevelCount; }
+
+        /** @brief Page size in texels */
+        Vector2i pageSize() const { return _pageSize; }
+
+        /**
+         * @brief Page count in given level
+         *
+         * Pages on the right and bottom edge may cover less than
+         * @ref pageSize() texels.
+         */
+        Vector2i pageCount(Int level) const;
+
+        /** @brief Max count of committed pages */
+        UnsignedInt maxPageCount() const { return _maxPageCount; }
+
+        /** @brief Count of committed pages, excluding the mip tail */
+        UnsignedInt residentPageCount() const { return _resident.size(); }
+
+        /** @brief Whether given page is committed */
+        bool isResident(Int level, const Vector2i& page) const;
+
+        /**
+         * @brief Set image of a mip tail level
+         * @return Reference to self (for method chaining)
+         *
+         * The @p level must be at least @ref sparseLevelCount() and the image
+         * must have the size of whole level.
+         */
+        SparseTexturePageTable& setTailImage(Int level, const ImageView2D& image);
+
+        /**
+         * @brief Request a page
+         * @return Reference to self (for method chaining)
+         *
+         * Marks the page as used in this frame. If it's not resident, it's
+         * added to @ref missingPages(). Requesting a page more than once per
+         * frame has no additional effect.
+         */
+        SparseTexturePageTable& request(Int level, const Vector2i& page);
+
+        /**
+         * @brief Pages requested in this frame that are not resident
+         *
+         * Sorted from the coarsest level to the finest, so coarser data
+         * can be committed before finer data on limited per-frame upload
+         * budgets.
+         */
+        std::vector<std::pair<Int, Vector2i>> missingPages() const;
+
+        /**
+         * @brief Commit a page and upload its data
+         * @return `False` if the page count limit was reached and all
+         *      committed pages were requested in this frame, `true`
+         *      otherwise
+         *
+         * The @p image must have the size of the page, which is
+         * @ref pageSize() except for pages on the right and bottom edge.
+         * If the page is already resident, only its data are replaced. See
+         * @ref SparseTexturePageTable-residency "class documentation" for
+         * information about eviction.
+         * @see @ref Texture::commitPages(), @ref TextureUploadQueue::upload()
+         */
+        bool commit(Int level, const Vector2i& page, const ImageView2D& image);
+
+        /**
+         * @brief Decommit a page
+         * @return Reference to self (for method chaining)
+         *
+         * If the page is not resident, the function does nothing.
+         * @see @ref Texture::decommitPages()
+         */
+        SparseTexturePageTable& decommit(Int level, const Vector2i& page);
+
+        /**
+         * @brief Advance to next frame
+         * @return Reference to self (for method chaining)
+         *
+         * Clears @ref missingPages() and resets @ref evictionCount().
+         */
+        SparseTexturePageTable& nextFrame();
+
+        /** @brief Count of pages evicted in this frame */
+        UnsignedInt evictionCount() const { return _evictionCount; }
+
+        /**
+         * @brief Residency table
+         *
+         * One value per page of level `0`, in row-major order with
+         * @ref pageCount() "pageCount(0)" columns, containing the finest
+         * level in which the area of the page is resident, or
+         * @ref sparseLevelCount() if it's available only in the mip tail.
+         * Upload it for example into a @ref TextureFormat::R8UI texture and
+         * clamp the level of detail in the shader with it.
+         */
+        std::vector<UnsignedByte> residency() const;
+
+    private:
+        struct ResidentPage {
+            Int level;
+            Vector2i page;
+        };
+
+        MAGNUM_LOCAL std::size_t pageIndex(Int level, const Vector2i& page) const;
+        MAGNUM_LOCAL Range2Di pageRange(Int level, const Vector2i& page) const;
+        MAGNUM_LOCAL bool evict();
+
+        Texture2D _texture;
+        TextureUploadQueue2D _queue;
+        Vector2i _size, _pageSize;
+        Int _levelCount, _sparseLevelCount;
+        UnsignedInt _maxPageCount, _frame, _evictionCount;
+
+        /* Frame in which each page was last requested, per level, 0 if never */
+        std::vector<std::vector<UnsignedInt>> _lastRequested;
+        std::vector<std::vector<bool>> _committed;
+        std::vector<ResidentPage> _resident;
+        std::vector<std::pair<Int, Vector2i>> _missing;
+};
+
+}
+#else
+#error this header is not available in OpenGL ES build
+#endif
+
+#endif
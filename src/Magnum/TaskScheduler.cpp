@@ -0,0 +1,306 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "TaskScheduler.h"
+
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum {
+
+namespace Implementation {
+
+struct ScheduledTask {
+    explicit ScheduledTask(std::function<void()>&& function, TaskScheduler::Affinity affinity): function{std::move(function)}, pendingDependencies{1}, finished{false}, affinity{affinity} {}
+
+    std::function<void()> function;
+    /* Starts at one so the task isn't queued while the dependencies are
+       still being added */
+    std::atomic<std::size_t> pendingDependencies;
+    std::atomic<bool> finished;
+    TaskScheduler::Affinity affinity;
+
+    /* Guards the dependents and setting finished */
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ScheduledTask>> dependents;
+};
+
+}
+
+namespace {
+    /* Scheduler the current thread is a worker of and the worker queue
+       index */
+    #if !defined(CORRADE_GCC47_COMPATIBILITY) && !defined(CORRADE_TARGET_APPLE)
+    thread_local
+    #else
+    __thread
+    #endif
+    const TaskScheduler* currentScheduler = nullptr;
+
+    #if !defined(CORRADE_GCC47_COMPATIBILITY) && !defined(CORRADE_TARGET_APPLE)
+    thread_local
+    #else
+    __thread
+    #endif
+    std::size_t currentQueue = 0;
+}
+
+TaskScheduler& TaskScheduler::global() {
+    /* Intentionally leaked -- the destructor has to run on the main thread
+       and joining the workers during static destruction is fragile */
+    static TaskScheduler* const scheduler = new TaskScheduler;
+    return *scheduler;
+}
+
+bool TaskScheduler::TaskHandle::isFinished() const {
+    return !_task || _task->finished;
+}
+
+TaskScheduler::TaskScheduler(UnsignedInt threadCount): _mainThread{std::this_thread::get_id()}, _queuedCount{0}, _mainThreadQueuedCount{0}, _unfinishedCount{0}, _finishedCount{0}, _stopping{false} {
+    if(!threadCount) threadCount = Math::max(std::thread::hardware_concurrency(), 1u);
+
+    _queueCount = threadCount;
+    _queues.reset(new Queue[_queueCount]);
+
+    _workers.reserve(threadCount - 1);
+    for(std::size_t i = 0; i != threadCount - 1; ++i)
+        _workers.emplace_back(&TaskScheduler::work, this, i);
+}
+
+TaskScheduler::~TaskScheduler() {
+    CORRADE_ASSERT(isMainThread(),
+        "TaskScheduler: destructed outside of the main thread", );
+
+    waitAll();
+
+    _stopping = true;
+    notify();
+    for(std::thread& worker: _workers) worker.join();
+}
+
+TaskScheduler::TaskHandle TaskScheduler::submit(std::function<void()> task, const std::initializer_list<TaskHandle> dependencies, const Affinity affinity) {
+    return submit(std::move(task), std::vector<TaskHandle>{dependencies}, affinity);
+}
+
+TaskScheduler::TaskHandle TaskScheduler::submit(std::function<void()> task, const std::vector<TaskHandle>& dependencies, const Affinity affinity) {
+    std::shared_ptr<Implementation::ScheduledTask> scheduled = std::make_shared<Implementation::ScheduledTask>(std::move(task), affinity);
+    ++_unfinishedCount;
+
+    /* Register with the unfinished dependencies, the last of them to finish
+       queues the task */
+    for(const TaskHandle& dependency: dependencies) {
+        if(!dependency._task) continue;
+
+        std::lock_guard<std::mutex> lock{dependency._task->mutex};
+        if(dependency._task->finished) continue;
+        ++scheduled->pendingDependencies;
+        dependency._task->dependents.push_back(scheduled);
+    }
+
+    if(--scheduled->pendingDependencies == 0) enqueue(scheduled);
+    return TaskHandle{std::move(scheduled)};
+}
+
+void TaskScheduler::enqueue(std::shared_ptr<Implementation::ScheduledTask> task) {
+    if(task->affinity == Affinity::MainThread) {
+        {
+            std::lock_guard<std::mutex> lock{_mainThreadQueue.mutex};
+            _mainThreadQueue.tasks.push_back(std::move(task));
+        }
+        ++_mainThreadQueuedCount;
+    } else {
+        /* Workers push to their own queue, everyone else to the shared one */
+        Queue& queue = _queues[currentScheduler == this ? currentQueue : _queueCount - 1];
+        {
+            std::lock_guard<std::mutex> lock{queue.mutex};
+            queue.tasks.push_back(std::move(task));
+        }
+        ++_queuedCount;
+    }
+
+    notify();
+}
+
+std::shared_ptr<Implementation::ScheduledTask> TaskScheduler::take(const std::size_t queue, const bool mainThread) {
+    std::shared_ptr<Implementation::ScheduledTask> task;
+
+    /* Own worker queue is LIFO */
+    if(queue != _queueCount - 1) {
+        Queue& own = _queues[queue];
+        std::lock_guard<std::mutex> lock{own.mutex};
+        if(!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            --_queuedCount;
+            return task;
+        }
+    }
+
+    if(mainThread && _mainThreadQueuedCount) {
+        std::lock_guard<std::mutex> lock{_mainThreadQueue.mutex};
+        if(!_mainThreadQueue.tasks.empty()) {
+            task = std::move(_mainThreadQueue.tasks.front());
+            _mainThreadQueue.tasks.pop_front();
+            --_mainThreadQueuedCount;
+            return task;
+        }
+    }
+
+    /* Steal the oldest task from the shared queue first, then from the other
+       workers */
+    if(!_queuedCount) return task;
+    for(std::size_t i = 0; i != _queueCount; ++i) {
+        Queue& other = _queues[(_queueCount - 1 + i) % _queueCount];
+        std::lock_guard<std::mutex> lock{other.mutex};
+        if(!other.tasks.empty()) {
+            task = std::move(other.tasks.front());
+            other.tasks.pop_front();
+            --_queuedCount;
+            return task;
+        }
+    }
+
+    return task;
+}
+
+void TaskScheduler::execute(std::shared_ptr<Implementation::ScheduledTask> task) {
+    task->function();
+
+    std::vector<std::shared_ptr<Implementation::ScheduledTask>> dependents;
+    {
+        std::lock_guard<std::mutex> lock{task->mutex};
+        task->finished = true;
+        dependents.swap(task->dependents);
+    }
+
+    for(std::shared_ptr<Implementation::ScheduledTask>& dependent: dependents)
+        if(--dependent->pendingDependencies == 0) enqueue(std::move(dependent));
+
+    --_unfinishedCount;
+    ++_finishedCount;
+    notify();
+}
+
+void TaskScheduler::notify() {
+    /* Locking the mutex ensures that a thread that just checked the
+       state and is about to sleep doesn't miss the notification */
+    { std::lock_guard<std::mutex> lock{_sleepMutex}; }
+    _sleep.notify_all();
+}
+
+void TaskScheduler::work(const std::size_t queue) {
+    currentScheduler = this;
+    currentQueue = queue;
+
+    for(;;) {
+        if(std::shared_ptr<Implementation::ScheduledTask> task = take(queue, false)) {
+            execute(std::move(task));
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock{_sleepMutex};
+        _sleep.wait(lock, [this]() { return _queuedCount || _stopping; });
+        if(_stopping && !_queuedCount) return;
+    }
+}
+
+template<class Predicate> void TaskScheduler::helpUntil(const Predicate& predicate) {
+    const bool mainThread = isMainThread();
+    const std::size_t queue = currentScheduler == this ? currentQueue : _queueCount - 1;
+
+    while(!predicate()) {
+        if(std::shared_ptr<Implementation::ScheduledTask> task = take(queue, mainThread)) {
+            execute(std::move(task));
+            continue;
+        }
+
+        /* Nothing to do, sleep until there's a new task or some task
+           finishes */
+        std::unique_lock<std::mutex> lock{_sleepMutex};
+        const std::size_t finishedCount = _finishedCount;
+        _sleep.wait(lock, [&]() {
+            return predicate() || _queuedCount || (mainThread && _mainThreadQueuedCount) || _finishedCount != finishedCount;
+        });
+    }
+}
+
+void TaskScheduler::wait(const TaskHandle& task) {
+    helpUntil([&task]() { return task.isFinished(); });
+}
+
+void TaskScheduler::waitAll() {
+    CORRADE_ASSERT(isMainThread(),
+        "TaskScheduler::waitAll(): not called from the main thread", );
+    helpUntil([this]() { return _unfinishedCount == 0; });
+}
+
+void TaskScheduler::parallelFor(const std::size_t count, std::size_t grainSize, const std::function<void(std::size_t, std::size_t)>& function) {
+    if(!grainSize) grainSize = 1;
+
+    /* A few chunks per thread so the stealing can balance the load */
+    const std::size_t chunkCount = Math::min((count + grainSize - 1)/grainSize, std::size_t(threadCount())*4);
+    if(chunkCount <= 1) {
+        if(count) function(0, count);
+        return;
+    }
+
+    const std::size_t chunkSize = (count + chunkCount - 1)/chunkCount;
+    std::vector<TaskHandle> chunks;
+    chunks.reserve(chunkCount - 1);
+    for(std::size_t begin = chunkSize; begin < count; begin += chunkSize) {
+        const std::size_t end = Math::min(begin + chunkSize, count);
+        chunks.push_back(submit([&function, begin, end]() { function(begin, end); }));
+    }
+
+    /* The calling thread processes the first chunk and then helps with the
+       rest */
+    function(0, chunkSize);
+    for(const TaskHandle& chunk: chunks) wait(chunk);
+}
+
+std::size_t TaskScheduler::runMainThreadTasks() {
+    CORRADE_ASSERT(isMainThread(),
+        "TaskScheduler::runMainThreadTasks(): not called from the main thread", 0);
+
+    std::size_t count = 0;
+    while(_mainThreadQueuedCount) {
+        std::shared_ptr<Implementation::ScheduledTask> task;
+        {
+            std::lock_guard<std::mutex> lock{_mainThreadQueue.mutex};
+            if(_mainThreadQueue.tasks.empty()) break;
+            task = std::move(_mainThreadQueue.tasks.front());
+            _mainThreadQueue.tasks.pop_front();
+            --_mainThreadQueuedCount;
+        }
+        execute(std::move(task));
+        ++count;
+    }
+
+    return count;
+}
+
+}
@@ -0,0 +1,288 @@
+#ifndef Magnum_TaskScheduler_h
+#define Magnum_TaskScheduler_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#if !defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(CORRADE_TARGET_NACL)
+/** @file
+ * @brief Class @ref Magnum::TaskScheduler
+ */
+#endif
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+
+#if !defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(CORRADE_TARGET_NACL)
+namespace Magnum {
+
+namespace Implementation { struct ScheduledTask; }
+
+/**
+@brief Work-stealing task scheduler
+
+A pool of worker threads shared by everything that wants to run work in
+parallel, so the libraries don't need to spawn their own threads for every
+operation. Tasks are submitted with @ref submit(), optionally depending on
+other tasks, and waited for with @ref wait():
+@code
+TaskScheduler scheduler;
+
+TaskScheduler::TaskHandle load = scheduler.submit([&]() { data = loadFile(); });
+TaskScheduler::TaskHandle parse = scheduler.submit([&]() { mesh = parse(data); }, {load});
+TaskScheduler::TaskHandle upload = scheduler.submit([&]() { buffer.setData(mesh); }, {parse},
+    TaskScheduler::Affinity::MainThread);
+
+scheduler.wait(upload);
+@endcode
+
+Loops over independent items are best expressed with @ref parallelFor(), which
+splits the range into chunks:
+@code
+scheduler.parallelFor(positions.size(), 1024, [&](std::size_t begin, std::size_t end) {
+    for(std::size_t i = begin; i != end; ++i)
+        positions[i] = transformation.transformPoint(positions[i]);
+});
+@endcode
+
+## Scheduling
+
+Each worker thread has its own task queue. Tasks submitted from a worker are
+put into its queue and the worker takes them in last-in, first-out order,
+which keeps the data of nested tasks hot in cache. Tasks submitted from other
+threads go to a shared queue. A worker that has nothing to do steals the
+oldest task from the queue of another worker or from the shared queue. A
+thread waiting in @ref wait() or @ref parallelFor() doesn't block, but
+executes other tasks in the meantime, so tasks can wait for tasks they
+spawned without deadlocking the pool.
+
+## Main thread tasks
+
+Tasks submitted with @ref Affinity::MainThread, such as anything that calls
+OpenGL, are executed only on the thread that created the scheduler: while it
+is waiting in @ref wait(), @ref waitAll() or @ref parallelFor(), or explicitly
+by calling @ref runMainThreadTasks(), for example once per frame.
+
+@note This class is not available in @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten"
+    and @ref CORRADE_TARGET_NACL "NaCl" builds.
+
+@see @ref SceneGraph::TaskSchedulerExecutor
+*/
+class MAGNUM_EXPORT TaskScheduler {
+    public:
+        /**
+         * @brief Task affinity
+         *
+         * @see @ref submit()
+         */
+        enum class Affinity: UnsignedByte {
+            /** Executed on any thread */
+            Any,
+
+            /**
+             * Executed only on the thread that created the scheduler
+             * @see @ref runMainThreadTasks()
+             */
+            MainThread
+        };
+
+        /**
+         * @brief Handle of a submitted task
+         *
+         * Default-constructed handle refers to no task, which is treated as
+         * already finished.
+         * @see @ref submit(), @ref wait()
+         */
+        class MAGNUM_EXPORT TaskHandle {
+            public:
+                /** @brief Constructor */
+                /*implicit*/ TaskHandle() = default;
+
+                /** @brief Whether the task is finished */
+                bool isFinished() const;
+
+            private:
+                friend TaskScheduler;
+
+                explicit TaskHandle(std::shared_ptr<Implementation::ScheduledTask> task): _task{std::move(task)} {}
+
+                std::shared_ptr<Implementation::ScheduledTask> _task;
+        };
+
+        /**
+         * @brief Global scheduler
+         *
+         * Scheduler used by library functions that parallelize their work
+         * internally, such as @ref MeshTools::generateSmoothNormals() or
+         * @ref TextureTools::resample(), so they share one pool of threads
+         * instead of each spawning its own. Created with
+         * @ref std::thread::hardware_concurrency() threads on first use and
+         * never destroyed. The thread that first called this function is
+         * its main thread, so it's not meant for
+         * @ref Affinity::MainThread tasks.
+         */
+        static TaskScheduler& global();
+
+        /**
+         * @brief Constructor
+         * @param threadCount   Count of threads executing the tasks,
+         *      including the thread calling @ref wait(). If set to `0`,
+         *      @ref std::thread::hardware_concurrency() is used.
+         *
+         * Spawns @p threadCount minus one worker threads. With thread count
+         * set to `1` all tasks are executed on the waiting thread.
+         */
+        explicit TaskScheduler(UnsignedInt threadCount = 0);
+
+        /** @brief Copying is not allowed */
+        TaskScheduler(const TaskScheduler&) = delete;
+
+        /** @brief Moving is not allowed */
+        TaskScheduler(TaskScheduler&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Waits for all submitted tasks using @ref waitAll() and joins the
+         * worker threads. Expects to be called from the main thread.
+         */
+        ~TaskScheduler();
+
+        /** @brief Copying is not allowed */
+        TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+        /** @brief Moving is not allowed */
+        TaskScheduler& operator=(TaskScheduler&&) = delete;
+
+        /**
+         * @brief Count of threads executing the tasks
+         *
+         * Worker thread count plus one.
+         */
+        UnsignedInt threadCount() const { return _workers.size() + 1; }
+
+        /**
+         * @brief Whether the current thread is the main thread
+         *
+         * @see @ref Affinity::MainThread
+         */
+        bool isMainThread() const { return std::this_thread::get_id() == _mainThread; }
+
+        /**
+         * @brief Submit a task
+         * @param task          Task function
+         * @param dependencies  Tasks that need to finish first
+         * @param affinity      Task affinity
+         *
+         * The task is queued for execution once all @p dependencies are
+         * finished. Can be called from any thread, including from inside
+         * other tasks.
+         */
+        TaskHandle submit(std::function<void()> task, std::initializer_list<TaskHandle> dependencies = {}, Affinity affinity = Affinity::Any);
+
+        /** @overload */
+        TaskHandle submit(std::function<void()> task, const std::vector<TaskHandle>& dependencies, Affinity affinity = Affinity::Any);
+
+        /**
+         * @brief Wait for a task
+         *
+         * Executes other tasks until @p task is finished. Main thread tasks
+         * are executed only if called from the main thread.
+         */
+        void wait(const TaskHandle& task);
+
+        /**
+         * @brief Wait for all submitted tasks
+         *
+         * Expects to be called from the main thread, otherwise there could
+         * be main thread tasks that never get executed.
+         */
+        void waitAll();
+
+        /**
+         * @brief Execute a function on a range in parallel
+         * @param count     Item count
+         * @param grainSize Minimal count of items processed in one task
+         * @param function  Function processing items in range
+         *      @f$ [ begin, end ) @f$
+         *
+         * Splits the range into consecutive chunks of at least @p grainSize
+         * items, a few for each thread, executes @p function for each and
+         * waits until all are done. If the range fits into one chunk, the
+         * function is called directly.
+         */
+        void parallelFor(std::size_t count, std::size_t grainSize, const std::function<void(std::size_t, std::size_t)>& function);
+
+        /**
+         * @brief Execute queued main thread tasks
+         * @return Count of executed tasks
+         *
+         * Expects to be called from the main thread.
+         * @see @ref Affinity::MainThread
+         */
+        std::size_t runMainThreadTasks();
+
+    private:
+        struct Queue {
+            std::mutex mutex;
+            std::deque<std::shared_ptr<Implementation::ScheduledTask>> tasks;
+        };
+
+        MAGNUM_LOCAL void enqueue(std::shared_ptr<Implementation::ScheduledTask> task);
+        MAGNUM_LOCAL std::shared_ptr<Implementation::ScheduledTask> take(std::size_t queue, bool mainThread);
+        MAGNUM_LOCAL void execute(std::shared_ptr<Implementation::ScheduledTask> task);
+        MAGNUM_LOCAL void notify();
+        MAGNUM_LOCAL void work(std::size_t queue);
+        template<class Predicate> MAGNUM_LOCAL void helpUntil(const Predicate& predicate);
+
+        std::thread::id _mainThread;
+        /* One queue for each worker plus the shared one at the end */
+        std::unique_ptr<Queue[]> _queues;
+        std::size_t _queueCount;
+        Queue _mainThreadQueue;
+        std::vector<std::thread> _workers;
+
+        std::atomic<std::size_t> _queuedCount, _mainThreadQueuedCount, _unfinishedCount, _finishedCount;
+        std::atomic<bool> _stopping;
+        std::mutex _sleepMutex;
+        std::condition_variable _sleep;
+};
+
+}
+
+#else
+#error this header is not available in Emscripten and NaCl build
+#endif
+
+#endif
@@ -0,0 +1,207 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <string>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/AbstractAsyncResourceLoader.h"
+#include "Magnum/ResourceManager.h"
+
+namespace Magnum { namespace Test {
+
+struct AbstractAsyncResourceLoaderTest: TestSuite::Tester {
+    explicit AbstractAsyncResourceLoaderTest();
+
+    void load();
+    void loadNoThreads();
+    void budget();
+    void finish();
+    void stop();
+};
+
+typedef Magnum::ResourceManager<Int> ResourceManager;
+
+AbstractAsyncResourceLoaderTest::AbstractAsyncResourceLoaderTest() {
+    addTests({&AbstractAsyncResourceLoaderTest::load,
+              &AbstractAsyncResourceLoaderTest::loadNoThreads,
+              &AbstractAsyncResourceLoaderTest::budget,
+              &AbstractAsyncResourceLoaderTest::finish,
+              &AbstractAsyncResourceLoaderTest::stop});
+}
+
+namespace {
+
+class IntResourceLoader: public AbstractAsyncResourceLoader<Int> {
+    public:
+        explicit IntResourceLoader(UnsignedInt threadCount, std::chrono::milliseconds delay = {}): AbstractAsyncResourceLoader<Int>{threadCount}, _delay{delay} {}
+
+        ~IntResourceLoader() { stop(); }
+
+    private:
+        std::unique_ptr<Int> doLoadAsync(ResourceKey key) override {
+            std::this_thread::sleep_for(_delay);
+            if(key == ResourceKey{"hello"}) return std::unique_ptr<Int>{new Int{773}};
+            if(key == ResourceKey{"answer"}) return std::unique_ptr<Int>{new Int{42}};
+            return nullptr;
+        }
+
+        std::chrono::milliseconds _delay;
+};
+
+}
+
+void AbstractAsyncResourceLoaderTest::load() {
+    ResourceManager rm;
+    rm.setFallback(new Int{-1});
+    auto loader = new IntResourceLoader{2};
+    rm.setLoader(loader);
+    CORRADE_COMPARE(loader->threadCount(), 2);
+
+    Resource<Int> hello = rm.get<Int>("hello");
+    Resource<Int> answer = rm.get<Int>("answer");
+    Resource<Int> world = rm.get<Int>("world");
+    CORRADE_COMPARE(loader->requestedCount(), 3);
+    CORRADE_COMPARE(loader->pendingCount(), 3);
+
+    /* Nothing is passed to the manager before update(), fallback is used */
+    CORRADE_COMPARE(hello.state(), ResourceState::LoadingFallback);
+    CORRADE_COMPARE(*hello, -1);
+
+    std::size_t processed = 0;
+    while(loader->pendingCount()) {
+        processed += loader->update();
+        std::this_thread::yield();
+    }
+    CORRADE_COMPARE(processed, 3);
+
+    CORRADE_COMPARE(hello.state(), ResourceState::Final);
+    CORRADE_COMPARE(*hello, 773);
+    CORRADE_COMPARE(answer.state(), ResourceState::Final);
+    CORRADE_COMPARE(*answer, 42);
+    CORRADE_COMPARE(world.state(), ResourceState::NotFoundFallback);
+    CORRADE_COMPARE(loader->loadedCount(), 2);
+    CORRADE_COMPARE(loader->notFoundCount(), 1);
+}
+
+void AbstractAsyncResourceLoaderTest::loadNoThreads() {
+    ResourceManager rm;
+    auto loader = new IntResourceLoader{0};
+    rm.setLoader(loader);
+    CORRADE_COMPARE(loader->threadCount(), 0);
+
+    Resource<Int> hello = rm.get<Int>("hello");
+    Resource<Int> world = rm.get<Int>("world");
+    CORRADE_COMPARE(hello.state(), ResourceState::Loading);
+    CORRADE_COMPARE(loader->pendingCount(), 2);
+
+    /* Everything is loaded directly in update() */
+    CORRADE_COMPARE(loader->update(), 2);
+    CORRADE_COMPARE(loader->pendingCount(), 0);
+    CORRADE_COMPARE(hello.state(), ResourceState::Final);
+    CORRADE_COMPARE(*hello, 773);
+    CORRADE_COMPARE(world.state(), ResourceState::NotFound);
+
+    /* Nothing more to do */
+    CORRADE_COMPARE(loader->update(), 0);
+}
+
+void AbstractAsyncResourceLoaderTest::budget() {
+    ResourceManager rm;
+    auto loader = new IntResourceLoader{0, std::chrono::milliseconds{2}};
+    rm.setLoader(loader);
+
+    Resource<Int> hello = rm.get<Int>("hello");
+    Resource<Int> answer = rm.get<Int>("answer");
+
+    /* The budget is exceeded by the first resource, but it gets processed
+       anyway */
+    CORRADE_COMPARE(loader->update(std::chrono::microseconds{1}), 1);
+    CORRADE_COMPARE(loader->pendingCount(), 1);
+    CORRADE_COMPARE(hello.state(), ResourceState::Final);
+    CORRADE_COMPARE(answer.state(), ResourceState::Loading);
+
+    CORRADE_COMPARE(loader->update(std::chrono::microseconds{1}), 1);
+    CORRADE_COMPARE(loader->pendingCount(), 0);
+    CORRADE_COMPARE(answer.state(), ResourceState::Final);
+}
+
+void AbstractAsyncResourceLoaderTest::finish() {
+    class StringResourceLoader: public AbstractAsyncResourceLoader<Int, std::string> {
+        public:
+            explicit StringResourceLoader(): AbstractAsyncResourceLoader<Int, std::string>{1} {}
+
+            ~StringResourceLoader() { stop(); }
+
+        private:
+            std::unique_ptr<std::string> doLoadAsync(ResourceKey key) override {
+                if(key == ResourceKey{"hello"}) return std::unique_ptr<std::string>{new std::string{"773"}};
+                return nullptr;
+            }
+
+            void doFinish(ResourceKey key, std::unique_ptr<std::string> data) override {
+                set(key, new Int{std::stoi(*data)}, ResourceDataState::Mutable, ResourcePolicy::Manual);
+            }
+    };
+
+    ResourceManager rm;
+    auto loader = new StringResourceLoader;
+    rm.setLoader(loader);
+
+    Resource<Int> hello = rm.get<Int>("hello");
+    while(loader->pendingCount()) {
+        loader->update();
+        std::this_thread::yield();
+    }
+
+    CORRADE_COMPARE(hello.state(), ResourceState::Mutable);
+    CORRADE_COMPARE(*hello, 773);
+}
+
+void AbstractAsyncResourceLoaderTest::stop() {
+    ResourceManager rm;
+    auto loader = new IntResourceLoader{0};
+    rm.setLoader(loader);
+
+    Resource<Int> hello = rm.get<Int>("hello");
+    CORRADE_COMPARE(loader->pendingCount(), 1);
+
+    /* Queued resources are discarded and stay in loading state */
+    loader->stop();
+    CORRADE_COMPARE(loader->pendingCount(), 0);
+    CORRADE_COMPARE(loader->update(), 0);
+    CORRADE_COMPARE(hello.state(), ResourceState::Loading);
+
+    /* Subsequent loads are ignored */
+    Resource<Int> answer = rm.get<Int>("answer");
+    CORRADE_COMPARE(loader->pendingCount(), 0);
+    CORRADE_COMPARE(answer.state(), ResourceState::Loading);
+
+    /* Stopping again does nothing */
+    loader->stop();
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::AbstractAsyncResourceLoaderTest)
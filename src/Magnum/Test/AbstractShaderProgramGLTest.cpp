@@ -25,6 +25,7 @@
 
 #include <sstream>
 #include <Corrade/Utility/Resource.h>
+#include <Corrade/Utility/System.h>
 #include <Corrade/TestSuite/Compare/Container.h>
 
 #include "Magnum/AbstractShaderProgram.h"
@@ -56,6 +57,7 @@ struct AbstractShaderProgramGLTest: AbstractOpenGLTester {
     void label();
 
     void create();
+    void createAsync();
     void createMultipleOutputs();
     #ifndef MAGNUM_TARGET_GLES
     void createMultipleOutputsIndexed();
@@ -66,11 +68,14 @@ struct AbstractShaderProgramGLTest: AbstractOpenGLTester {
     void uniformVector();
     void uniformMatrix();
     void uniformArray();
+    void uniformCache();
+    void uniformReflection();
 
     #ifndef MAGNUM_TARGET_GLES2
     void createUniformBlocks();
     void uniformBlockIndexNotFound();
     void uniformBlock();
+    void uniformBlockReflection();
     #endif
 
     void compute();
@@ -84,6 +89,7 @@ AbstractShaderProgramGLTest::AbstractShaderProgramGLTest() {
               &AbstractShaderProgramGLTest::label,
 
               &AbstractShaderProgramGLTest::create,
+              &AbstractShaderProgramGLTest::createAsync,
               &AbstractShaderProgramGLTest::createMultipleOutputs,
               #ifndef MAGNUM_TARGET_GLES
               &AbstractShaderProgramGLTest::createMultipleOutputsIndexed,
@@ -94,11 +100,14 @@ AbstractShaderProgramGLTest::AbstractShaderProgramGLTest() {
               &AbstractShaderProgramGLTest::uniformVector,
               &AbstractShaderProgramGLTest::uniformMatrix,
               &AbstractShaderProgramGLTest::uniformArray,
+              &AbstractShaderProgramGLTest::uniformCache,
+              &AbstractShaderProgramGLTest::uniformReflection,
 
               #ifndef MAGNUM_TARGET_GLES2
               &AbstractShaderProgramGLTest::createUniformBlocks,
               &AbstractShaderProgramGLTest::uniformBlockIndexNotFound,
               &AbstractShaderProgramGLTest::uniformBlock,
+              &AbstractShaderProgramGLTest::uniformBlockReflection,
 
               &AbstractShaderProgramGLTest::compute
               #endif
@@ -174,6 +183,8 @@ namespace {
         using AbstractShaderProgram::bindFragmentDataLocation;
         #endif
         using AbstractShaderProgram::link;
+        using AbstractShaderProgram::submitLink;
+        using AbstractShaderProgram::checkLink;
         using AbstractShaderProgram::uniformLocation;
         #ifndef MAGNUM_TARGET_GLES2
         using AbstractShaderProgram::uniformBlockIndex;
@@ -246,6 +257,55 @@ void AbstractShaderProgramGLTest::create() {
     CORRADE_VERIFY(additionsUniform >= 0);
 }
 
+void AbstractShaderProgramGLTest::createAsync() {
+    Utility::Resource rs("AbstractShaderProgramGLTest");
+
+    Shader vert(
+        #ifndef MAGNUM_TARGET_GLES
+        #ifndef CORRADE_TARGET_APPLE
+        Version::GL210
+        #else
+        Version::GL310
+        #endif
+        #else
+        Version::GLES200
+        #endif
+        , Shader::Type::Vertex);
+    vert.addSource(rs.get("MyShader.vert"));
+    Shader frag(
+        #ifndef MAGNUM_TARGET_GLES
+        #ifndef CORRADE_TARGET_APPLE
+        Version::GL210
+        #else
+        Version::GL310
+        #endif
+        #else
+        Version::GLES200
+        #endif
+        , Shader::Type::Fragment);
+    frag.addSource(rs.get("MyShader.frag"));
+    Shader::submitCompile({vert, frag});
+
+    /* Linking can be submitted while the compilation is still running */
+    MyPublicShader program;
+    program.attachShaders({vert, frag});
+    program.bindAttributeLocation(0, "position");
+    MyPublicShader::submitLink({program});
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Without the extension this is always true, with the extension it
+       has to become true eventually */
+    while(!program.isLinkFinished()) Utility::System::sleep(1);
+
+    CORRADE_VERIFY(vert.isCompileFinished());
+    CORRADE_VERIFY(frag.isCompileFinished());
+    CORRADE_VERIFY(Shader::checkCompile({vert, frag}));
+    CORRADE_VERIFY(MyPublicShader::checkLink({program}));
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
 void AbstractShaderProgramGLTest::createMultipleOutputs() {
     #ifndef MAGNUM_TARGET_GLES
     Utility::Resource rs("AbstractShaderProgramGLTest");
@@ -402,6 +462,9 @@ namespace {
     struct MyShader: AbstractShaderProgram {
         explicit MyShader();
 
+        using AbstractShaderProgram::link;
+        using AbstractShaderProgram::reflectUniforms;
+        using AbstractShaderProgram::uniformLocation;
         using AbstractShaderProgram::setUniform;
 
         Int matrixUniform,
@@ -484,6 +547,37 @@ void AbstractShaderProgramGLTest::uniformMatrix() {
     MAGNUM_VERIFY_NO_ERROR();
 }
 
+void AbstractShaderProgramGLTest::uniformReflection() {
+    MyShader shader;
+    CORRADE_COMPARE(shader.reflectedUniformCount(), 0);
+
+    shader.reflectUniforms();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    /* additions[0] is there also as additions */
+    CORRADE_COMPARE(shader.reflectedUniformCount(), 5);
+    CORRADE_COMPARE(shader.uniformLocation("matrix"), shader.matrixUniform);
+    CORRADE_COMPARE(shader.uniformLocation("multiplier"), shader.multiplierUniform);
+    CORRADE_COMPARE(shader.uniformLocation(std::string{"color"}), shader.colorUniform);
+    CORRADE_COMPARE(shader.uniformLocation("additions"), shader.additionsUniform);
+    CORRADE_COMPARE(shader.uniformLocation("additions[0]"), shader.additionsUniform);
+
+    /* Names not in the table still go through GL */
+    CORRADE_VERIFY(shader.uniformLocation("additions[2]") != -1);
+    {
+        std::ostringstream out;
+        Warning redirectWarning{&out};
+        shader.uniformLocation("nonexistent");
+        CORRADE_COMPARE(out.str(), "AbstractShaderProgram: location of uniform 'nonexistent' cannot be retrieved\n");
+    }
+
+    /* Relinking discards the table */
+    CORRADE_VERIFY(shader.link());
+    CORRADE_COMPARE(shader.reflectedUniformCount(), 0);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
 void AbstractShaderProgramGLTest::uniformArray() {
     MyShader shader;
 
@@ -503,6 +597,40 @@ void AbstractShaderProgramGLTest::uniformArray() {
     MAGNUM_VERIFY_NO_ERROR();
 }
 
+void AbstractShaderProgramGLTest::uniformCache() {
+    MyShader shader;
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    CORRADE_VERIFY(!shader.isUniformCacheEnabled());
+    shader.setUniform(shader.multiplierUniform, 0.35f);
+    CORRADE_COMPARE(shader.uniformCacheHits(), 0);
+    CORRADE_COMPARE(shader.uniformCacheMisses(), 0);
+
+    shader.setUniformCacheEnabled(true);
+    CORRADE_VERIFY(shader.isUniformCacheEnabled());
+
+    /* First upload is always a miss, the same value again is a hit */
+    shader.setUniform(shader.multiplierUniform, 0.35f);
+    shader.setUniform(shader.multiplierUniform, 0.35f);
+    CORRADE_COMPARE(shader.uniformCacheHits(), 1);
+    CORRADE_COMPARE(shader.uniformCacheMisses(), 1);
+
+    /* Different value is a miss */
+    shader.setUniform(shader.multiplierUniform, 0.5f);
+    shader.setUniform(shader.colorUniform, Vector4(0.3f, 0.7f, 1.0f, 0.25f));
+    shader.setUniform(shader.colorUniform, Vector4(0.3f, 0.7f, 1.0f, 0.25f));
+    CORRADE_COMPARE(shader.uniformCacheHits(), 2);
+    CORRADE_COMPARE(shader.uniformCacheMisses(), 3);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Disabling resets the counters */
+    shader.setUniformCacheEnabled(false);
+    CORRADE_COMPARE(shader.uniformCacheHits(), 0);
+    CORRADE_COMPARE(shader.uniformCacheMisses(), 0);
+}
+
 #ifndef MAGNUM_TARGET_GLES2
 void AbstractShaderProgramGLTest::createUniformBlocks() {
     Utility::Resource rs("AbstractShaderProgramGLTest");
@@ -594,6 +722,8 @@ namespace {
     struct UniformBlockShader: AbstractShaderProgram {
         explicit UniformBlockShader();
 
+        using AbstractShaderProgram::reflectUniforms;
+        using AbstractShaderProgram::uniformBlockIndex;
         using AbstractShaderProgram::setUniformBlockBinding;
 
         Int matricesUniformBlock,
@@ -643,6 +773,24 @@ void AbstractShaderProgramGLTest::uniformBlock() {
     MAGNUM_VERIFY_NO_ERROR();
 }
 
+void AbstractShaderProgramGLTest::uniformBlockReflection() {
+    UniformBlockShader shader;
+    CORRADE_COMPARE(shader.reflectedUniformBlockCount(), 0);
+
+    shader.reflectUniforms();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(shader.reflectedUniformBlockCount(), 2);
+    CORRADE_COMPARE(shader.uniformBlockIndex("matrices"), shader.matricesUniformBlock);
+    CORRADE_COMPARE(shader.uniformBlockIndex(std::string{"material"}), shader.materialUniformBlock);
+
+    /* Names not in the table still go through GL */
+    std::ostringstream out;
+    Warning redirectWarning{&out};
+    shader.uniformBlockIndex("nonexistent");
+    CORRADE_COMPARE(out.str(), "AbstractShaderProgram: index of uniform block 'nonexistent' cannot be retrieved\n");
+}
+
 void AbstractShaderProgramGLTest::compute() {
     #ifndef MAGNUM_TARGET_GLES
     if(!Context::current().isExtensionSupported<Extensions::GL::ARB::compute_shader>())
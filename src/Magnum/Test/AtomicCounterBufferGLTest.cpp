@@ -0,0 +1,207 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/AtomicCounterBuffer.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct AtomicCounterBufferGLTest: AbstractOpenGLTester {
+    explicit AtomicCounterBufferGLTest();
+
+    void construct();
+    void resetRead();
+    void readFull();
+
+    void constructAppend();
+    void copyCount();
+};
+
+AtomicCounterBufferGLTest::AtomicCounterBufferGLTest() {
+    addTests({&AtomicCounterBufferGLTest::construct,
+              &AtomicCounterBufferGLTest::resetRead,
+              &AtomicCounterBufferGLTest::readFull,
+
+              &AtomicCounterBufferGLTest::constructAppend,
+              &AtomicCounterBufferGLTest::copyCount});
+}
+
+void AtomicCounterBufferGLTest::construct() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::shader_atomic_counters>())
+        CORRADE_SKIP(Extensions::GL::ARB::shader_atomic_counters::string() + std::string(" is not supported."));
+    #else
+    if(!Context::current().isVersionSupported(Version::GLES310))
+        CORRADE_SKIP("OpenGL ES 3.1 is not supported.");
+    #endif
+
+    AtomicCounterBuffer counters{3, 2};
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(counters.counterCount(), 3);
+    CORRADE_COMPARE(counters.readbackCount(), 2);
+    CORRADE_COMPARE(counters.pendingCount(), 0);
+    CORRADE_COMPARE(counters.waitCount(), 0);
+    CORRADE_COMPARE(counters.buffer().size(), 3*4);
+    CORRADE_VERIFY(!counters.retrieve());
+}
+
+void AtomicCounterBufferGLTest::resetRead() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::shader_atomic_counters>())
+        CORRADE_SKIP(Extensions::GL::ARB::shader_atomic_counters::string() + std::string(" is not supported."));
+    #else
+    if(!Context::current().isVersionSupported(Version::GLES310))
+        CORRADE_SKIP("OpenGL ES 3.1 is not supported.");
+    #endif
+
+    AtomicCounterBuffer counters{2};
+    counters.read();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(counters.pendingCount(), 1);
+
+    counters.reset(1337)
+        .read();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(counters.pendingCount(), 2);
+
+    std::optional<Containers::Array<UnsignedInt>> initial = counters.retrieveBlocking();
+    std::optional<Containers::Array<UnsignedInt>> reset = counters.retrieveBlocking();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(initial);
+    CORRADE_VERIFY(reset);
+    CORRADE_COMPARE(counters.pendingCount(), 0);
+    CORRADE_COMPARE(initial->size(), 2);
+    CORRADE_COMPARE((*initial)[0], 0);
+    CORRADE_COMPARE((*initial)[1], 0);
+    CORRADE_COMPARE(reset->size(), 2);
+    CORRADE_COMPARE((*reset)[0], 1337);
+    CORRADE_COMPARE((*reset)[1], 1337);
+    CORRADE_VERIFY(!counters.retrieveBlocking());
+}
+
+void AtomicCounterBufferGLTest::readFull() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::shader_atomic_counters>())
+        CORRADE_SKIP(Extensions::GL::ARB::shader_atomic_counters::string() + std::string(" is not supported."));
+    #else
+    if(!Context::current().isVersionSupported(Version::GLES310))
+        CORRADE_SKIP("OpenGL ES 3.1 is not supported.");
+    #endif
+
+    AtomicCounterBuffer counters{1, 2};
+    counters.reset(1).read()
+        .reset(2).read();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(counters.pendingCount(), 2);
+
+    /* All buffers are pending, so this always gives back the oldest one */
+    std::optional<Containers::Array<UnsignedInt>> first = counters.retrieve();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(first);
+    CORRADE_COMPARE(counters.pendingCount(), 1);
+    CORRADE_COMPARE((*first)[0], 1);
+
+    /* Reuse the freed buffer */
+    counters.reset(3).read();
+    std::optional<Containers::Array<UnsignedInt>> second = counters.retrieve();
+    std::optional<Containers::Array<UnsignedInt>> third = counters.retrieveBlocking();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(second);
+    CORRADE_VERIFY(third);
+    CORRADE_COMPARE((*second)[0], 2);
+    CORRADE_COMPARE((*third)[0], 3);
+}
+
+void AtomicCounterBufferGLTest::constructAppend() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::shader_atomic_counters>())
+        CORRADE_SKIP(Extensions::GL::ARB::shader_atomic_counters::string() + std::string(" is not supported."));
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::shader_storage_buffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::shader_storage_buffer_object::string() + std::string(" is not supported."));
+    #else
+    if(!Context::current().isVersionSupported(Version::GLES310))
+        CORRADE_SKIP("OpenGL ES 3.1 is not supported.");
+    #endif
+
+    AppendBuffer buffer{16, 128};
+    buffer.bind(0, 0);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(buffer.elementSize(), 16);
+    CORRADE_COMPARE(buffer.capacity(), 128);
+    CORRADE_COMPARE(buffer.buffer().size(), 16*128);
+    CORRADE_COMPARE(buffer.counter().counterCount(), 1);
+}
+
+void AtomicCounterBufferGLTest::copyCount() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::shader_atomic_counters>())
+        CORRADE_SKIP(Extensions::GL::ARB::shader_atomic_counters::string() + std::string(" is not supported."));
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::shader_storage_buffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::shader_storage_buffer_object::string() + std::string(" is not supported."));
+    #else
+    if(!Context::current().isVersionSupported(Version::GLES310))
+        CORRADE_SKIP("OpenGL ES 3.1 is not supported.");
+    #endif
+
+    AppendBuffer buffer{16, 128};
+    buffer.counter().reset(42);
+
+    constexpr UnsignedInt data[]{1, 2, 3, 4};
+    Buffer destination;
+    destination.setData(data, BufferUsage::StaticRead);
+    buffer.copyCount(destination, 8);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    const UnsignedInt* mapped = destination.map<const UnsignedInt>(0, sizeof(data), Buffer::MapFlag::Read);
+    CORRADE_VERIFY(mapped);
+    CORRADE_COMPARE(mapped[0], 1);
+    CORRADE_COMPARE(mapped[1], 2);
+    CORRADE_COMPARE(mapped[2], 42);
+    CORRADE_COMPARE(mapped[3], 4);
+    destination.unmap();
+
+    /* Resetting makes the count zero again */
+    buffer.reset()
+        .copyCount(destination, 0);
+    mapped = destination.map<const UnsignedInt>(0, sizeof(data), Buffer::MapFlag::Read);
+    CORRADE_VERIFY(mapped);
+    CORRADE_COMPARE(mapped[0], 0);
+    destination.unmap();
+}
+
+}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Test::AtomicCounterBufferGLTest)
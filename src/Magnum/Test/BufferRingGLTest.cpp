@@ -0,0 +1,184 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/BufferRing.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct BufferRingGLTest: AbstractOpenGLTester {
+    explicit BufferRingGLTest();
+
+    void construct();
+    void constructCopy();
+
+    void allocate();
+    void allocateAligned();
+    void wrapAround();
+};
+
+BufferRingGLTest::BufferRingGLTest() {
+    addTests({&BufferRingGLTest::construct,
+              &BufferRingGLTest::constructCopy,
+
+              &BufferRingGLTest::allocate,
+              &BufferRingGLTest::allocateAligned,
+              &BufferRingGLTest::wrapAround});
+}
+
+void BufferRingGLTest::construct() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::ARB::map_buffer_range::string() + std::string(" is not supported"));
+    #elif defined(MAGNUM_TARGET_GLES2)
+    if(!Context::current().isExtensionSupported<Extensions::GL::EXT::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::EXT::map_buffer_range::string() + std::string(" is not supported"));
+    #endif
+
+    {
+        BufferRing ring{64, 4};
+
+        MAGNUM_VERIFY_NO_ERROR();
+        CORRADE_VERIFY(ring.buffer().id() > 0);
+        CORRADE_COMPARE(ring.sectionSize(), 64);
+        CORRADE_COMPARE(ring.sectionCount(), 4);
+        CORRADE_COMPARE(ring.buffer().size(), 256);
+        CORRADE_COMPARE(ring.waitCount(), 0);
+
+        #ifndef MAGNUM_TARGET_GLES
+        CORRADE_COMPARE(ring.isPersistent(), Context::current().isExtensionSupported<Extensions::GL::ARB::buffer_storage>() && Context::current().isExtensionSupported<Extensions::GL::ARB::sync>());
+        #else
+        CORRADE_VERIFY(!ring.isPersistent());
+        #endif
+    }
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void BufferRingGLTest::constructCopy() {
+    CORRADE_VERIFY(!(std::is_constructible<BufferRing, const BufferRing&>{}));
+    CORRADE_VERIFY(!(std::is_assignable<BufferRing, const BufferRing&>{}));
+}
+
+void BufferRingGLTest::allocate() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::ARB::map_buffer_range::string() + std::string(" is not supported"));
+    #elif defined(MAGNUM_TARGET_GLES2)
+    if(!Context::current().isExtensionSupported<Extensions::GL::EXT::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::EXT::map_buffer_range::string() + std::string(" is not supported"));
+    #endif
+
+    BufferRing ring{16, 2};
+
+    ring.beginSection();
+    Containers::ArrayView<char> a = ring.allocate(3);
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(ring.allocationOffset(), 0);
+    a[0] = 2; a[1] = 7; a[2] = 5;
+
+    Containers::ArrayView<char> b = ring.allocate(2);
+    CORRADE_COMPARE(b.size(), 2);
+    CORRADE_COMPARE(ring.allocationOffset(), 3);
+    b[0] = 13; b[1] = 25;
+    ring.endSection();
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /** @todo How to verify the contents in ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    Containers::Array<char> contents = ring.buffer().subData<char>(0, 5);
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(contents[0], 2);
+    CORRADE_COMPARE(contents[2], 5);
+    CORRADE_COMPARE(contents[4], 25);
+    #endif
+}
+
+void BufferRingGLTest::allocateAligned() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::ARB::map_buffer_range::string() + std::string(" is not supported"));
+    #elif defined(MAGNUM_TARGET_GLES2)
+    if(!Context::current().isExtensionSupported<Extensions::GL::EXT::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::EXT::map_buffer_range::string() + std::string(" is not supported"));
+    #endif
+
+    BufferRing ring{18, 2};
+
+    /* Second section starts at 18, aligned allocation should go to 20 */
+    ring.beginSection().endSection();
+    ring.beginSection();
+    ring.allocate(4, 4);
+    CORRADE_COMPARE(ring.allocationOffset(), 20);
+    ring.allocate(1);
+    CORRADE_COMPARE(ring.allocationOffset(), 24);
+    ring.allocate(4, 4);
+    CORRADE_COMPARE(ring.allocationOffset(), 28);
+    ring.endSection();
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void BufferRingGLTest::wrapAround() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::ARB::map_buffer_range::string() + std::string(" is not supported"));
+    #elif defined(MAGNUM_TARGET_GLES2)
+    if(!Context::current().isExtensionSupported<Extensions::GL::EXT::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::EXT::map_buffer_range::string() + std::string(" is not supported"));
+    #endif
+
+    BufferRing ring{8, 3};
+
+    for(Int i = 0; i != 7; ++i) {
+        ring.beginSection();
+        ring.allocate(8)[7] = char(i);
+        CORRADE_COMPARE(ring.allocationOffset(), (i % 3)*8);
+        ring.endSection();
+    }
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Last written section was the first one, the other two contain data
+       from the previous round if the buffer wasn't orphaned */
+    #ifndef MAGNUM_TARGET_GLES
+    Containers::Array<char> contents = ring.buffer().subData<char>(0, 24);
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(contents[7], 6);
+    if(ring.isPersistent()) {
+        CORRADE_COMPARE(contents[15], 4);
+        CORRADE_COMPARE(contents[23], 5);
+    }
+    #endif
+}
+
+}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Test::BufferRingGLTest)
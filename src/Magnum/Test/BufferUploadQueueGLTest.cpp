@@ -0,0 +1,176 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Buffer.h"
+#include "Magnum/BufferUploadQueue.h"
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#endif
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct BufferUploadQueueGLTest: AbstractOpenGLTester {
+    explicit BufferUploadQueueGLTest();
+
+    void coalesce();
+    void overlap();
+    void multipleBuffers();
+    #ifndef MAGNUM_TARGET_GLES2
+    void copy();
+    #endif
+};
+
+BufferUploadQueueGLTest::BufferUploadQueueGLTest() {
+    addTests({&BufferUploadQueueGLTest::coalesce,
+              &BufferUploadQueueGLTest::overlap,
+              &BufferUploadQueueGLTest::multipleBuffers,
+              #ifndef MAGNUM_TARGET_GLES2
+              &BufferUploadQueueGLTest::copy
+              #endif
+              });
+}
+
+void BufferUploadQueueGLTest::coalesce() {
+    constexpr Int zeros[8]{};
+    Buffer buffer;
+    buffer.setData(zeros, BufferUsage::DynamicDraw);
+
+    constexpr Int a[]{2, 7}, b[]{5}, c[]{13, 25};
+    BufferUploadQueue queue;
+    queue.setSubData(buffer, 4, a)
+        .setSubData(buffer, 12, b)
+        .setSubData(buffer, 16, c);
+    CORRADE_COMPARE(queue.pendingUpdateCount(), 3);
+    CORRADE_COMPARE(queue.pendingSize(), 20);
+
+    queue.flush();
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(queue.uploadCount(), 1);
+    CORRADE_COMPARE(queue.pendingUpdateCount(), 0);
+    CORRADE_COMPARE(queue.pendingSize(), 0);
+
+    /** @todo How to verify the contents in ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    constexpr Int expected[]{0, 2, 7, 5, 13, 25, 0, 0};
+    CORRADE_COMPARE_AS(buffer.data<Int>(),
+        Containers::ArrayView<const Int>{expected},
+        TestSuite::Compare::Container);
+    #endif
+}
+
+void BufferUploadQueueGLTest::overlap() {
+    constexpr Int zeros[8]{};
+    Buffer buffer;
+    buffer.setData(zeros, BufferUsage::DynamicDraw);
+
+    /* Queued out of order and overlapping, the later update wins */
+    constexpr Int a[]{2, 7, 5}, b[]{13, 25}, c[]{-1};
+    BufferUploadQueue queue;
+    queue.setSubData(buffer, 8, a)
+        .setSubData(buffer, 0, b)
+        .setSubData(buffer, 12, c)
+        .flush();
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(queue.uploadCount(), 1);
+
+    #ifndef MAGNUM_TARGET_GLES
+    constexpr Int expected[]{13, 25, 2, -1, 5, 0, 0, 0};
+    CORRADE_COMPARE_AS(buffer.data<Int>(),
+        Containers::ArrayView<const Int>{expected},
+        TestSuite::Compare::Container);
+    #endif
+}
+
+void BufferUploadQueueGLTest::multipleBuffers() {
+    constexpr Int zeros[4]{};
+    Buffer first, second;
+    first.setData(zeros, BufferUsage::DynamicDraw);
+    second.setData(zeros, BufferUsage::DynamicDraw);
+
+    /* Disjoint ranges in the same buffer are uploaded separately */
+    constexpr Int a[]{2}, b[]{7}, c[]{5};
+    BufferUploadQueue queue;
+    queue.setSubData(first, 0, a)
+        .setSubData(second, 4, b)
+        .setSubData(first, 12, c)
+        .flush();
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(queue.uploadCount(), 3);
+
+    #ifndef MAGNUM_TARGET_GLES
+    constexpr Int expectedFirst[]{2, 0, 0, 5};
+    CORRADE_COMPARE_AS(first.data<Int>(),
+        Containers::ArrayView<const Int>{expectedFirst},
+        TestSuite::Compare::Container);
+    constexpr Int expectedSecond[]{0, 7, 0, 0};
+    CORRADE_COMPARE_AS(second.data<Int>(),
+        Containers::ArrayView<const Int>{expectedSecond},
+        TestSuite::Compare::Container);
+    #endif
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+void BufferUploadQueueGLTest::copy() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::copy_buffer>())
+        CORRADE_SKIP(Extensions::GL::ARB::copy_buffer::string() + std::string(" is not supported."));
+    #endif
+
+    constexpr Int zeros[4]{};
+    Buffer read, write;
+    read.setData(zeros, BufferUsage::DynamicDraw);
+    write.setData(zeros, BufferUsage::DynamicDraw);
+
+    /* The copy sees the first update but not the second */
+    constexpr Int a[]{2, 7}, b[]{5};
+    BufferUploadQueue queue;
+    queue.setSubData(read, 0, a)
+        .copy(read, write, 0, 8, 8)
+        .setSubData(read, 0, b)
+        .flush();
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(queue.uploadCount(), 2);
+
+    #ifndef MAGNUM_TARGET_GLES
+    constexpr Int expectedRead[]{5, 7, 0, 0};
+    CORRADE_COMPARE_AS(read.data<Int>(),
+        Containers::ArrayView<const Int>{expectedRead},
+        TestSuite::Compare::Container);
+    constexpr Int expectedWrite[]{0, 0, 2, 7};
+    CORRADE_COMPARE_AS(write.data<Int>(),
+        Containers::ArrayView<const Int>{expectedWrite},
+        TestSuite::Compare::Container);
+    #endif
+}
+#endif
+
+}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Test::BufferUploadQueueGLTest)
@@ -0,0 +1,150 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Buffer.h"
+#include "Magnum/ContextRestorer.h"
+#include "Magnum/Texture.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct ContextRestorerGLTest: AbstractOpenGLTester {
+    explicit ContextRestorerGLTest();
+
+    void setData();
+    void add();
+    void addReplace();
+    void remove();
+};
+
+ContextRestorerGLTest::ContextRestorerGLTest() {
+    addTests({&ContextRestorerGLTest::setData,
+              &ContextRestorerGLTest::add,
+              &ContextRestorerGLTest::addReplace,
+              &ContextRestorerGLTest::remove});
+}
+
+void ContextRestorerGLTest::setData() {
+    constexpr Int data[]{2, 7, 5, 13};
+
+    ContextRestorer restorer;
+    Buffer buffer{Buffer::TargetHint::ElementArray};
+    restorer.setData(buffer, data, BufferUsage::StaticDraw);
+    CORRADE_COMPARE(restorer.size(), 1);
+    CORRADE_COMPARE(buffer.size(), 16);
+
+    /* Simulate the context loss, the driver deletes everything */
+    const GLuint id = buffer.id();
+    restorer.contextLost();
+    CORRADE_COMPARE(buffer.id(), 0);
+    glDeleteBuffers(1, &id);
+
+    restorer.restore();
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(buffer.id() != 0);
+    CORRADE_COMPARE(buffer.targetHint(), Buffer::TargetHint::ElementArray);
+    CORRADE_COMPARE(buffer.size(), 16);
+
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_COMPARE_AS(buffer.data<Int>(),
+        Containers::ArrayView<const Int>{data},
+        TestSuite::Compare::Container);
+    #endif
+}
+
+void ContextRestorerGLTest::add() {
+    std::vector<Int> order;
+
+    ContextRestorer restorer;
+    Buffer buffer;
+    Texture2D texture;
+    restorer.add<Buffer>(buffer, [&order](Buffer& buffer) {
+        CORRADE_COMPARE(buffer.id(), 0);
+        buffer = Buffer{};
+        order.push_back(0);
+    }).add<Texture2D>(texture, [&order](Texture2D& texture) {
+        CORRADE_COMPARE(texture.id(), 0);
+        texture = Texture2D{};
+        texture.setStorage(1, TextureFormat::RGBA8, {4, 4});
+        order.push_back(1);
+    });
+    CORRADE_COMPARE(restorer.size(), 2);
+
+    const GLuint ids[]{buffer.id(), texture.id()};
+    restorer.contextLost();
+    glDeleteBuffers(1, ids);
+    glDeleteTextures(1, ids + 1);
+
+    restorer.restore();
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(buffer.id() != 0);
+    CORRADE_VERIFY(texture.id() != 0);
+    CORRADE_COMPARE_AS(order, (std::vector<Int>{0, 1}),
+        TestSuite::Compare::Container);
+}
+
+void ContextRestorerGLTest::addReplace() {
+    Int called = 0;
+
+    ContextRestorer restorer;
+    Buffer buffer;
+    restorer.setData(buffer, Containers::ArrayView<const void>{nullptr, 0}, BufferUsage::StaticDraw)
+        .add<Buffer>(buffer, [&called](Buffer& buffer) {
+            buffer = Buffer{};
+            ++called;
+        });
+    CORRADE_COMPARE(restorer.size(), 1);
+
+    const GLuint id = buffer.id();
+    restorer.contextLost();
+    glDeleteBuffers(1, &id);
+
+    restorer.restore();
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(called, 1);
+}
+
+void ContextRestorerGLTest::remove() {
+    ContextRestorer restorer;
+    Buffer a, b;
+    restorer.add<Buffer>(a, [](Buffer& buffer) { buffer = Buffer{}; })
+        .add<Buffer>(b, [](Buffer& buffer) { buffer = Buffer{}; })
+        .remove(&a);
+    CORRADE_COMPARE(restorer.size(), 1);
+
+    /* The removed object is untouched */
+    const GLuint id = a.id();
+    restorer.contextLost();
+    CORRADE_COMPARE(a.id(), id);
+    CORRADE_COMPARE(b.id(), 0);
+}
+
+}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Test::ContextRestorerGLTest)
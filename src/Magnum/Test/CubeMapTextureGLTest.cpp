@@ -82,6 +82,8 @@ struct CubeMapTextureGLTest: AbstractOpenGLTester {
     #endif
     void immutableCompressedImage();
     #ifndef MAGNUM_TARGET_GLES
+    void fullSubImage();
+    void compressedFullSubImage();
     void fullImageQuery();
     void compressedFullImageQuery();
     void fullImageQueryBuffer();
@@ -154,6 +156,8 @@ CubeMapTextureGLTest::CubeMapTextureGLTest() {
               #endif
               &CubeMapTextureGLTest::immutableCompressedImage,
               #ifndef MAGNUM_TARGET_GLES
+              &CubeMapTextureGLTest::fullSubImage,
+              &CubeMapTextureGLTest::compressedFullSubImage,
               &CubeMapTextureGLTest::fullImageQuery,
               &CubeMapTextureGLTest::compressedFullImageQuery,
               &CubeMapTextureGLTest::fullImageQueryBuffer,
@@ -700,6 +704,52 @@ namespace {
     };
 }
 
+void CubeMapTextureGLTest::fullSubImage() {
+    /* Goes through the per-face fallback if ARB_direct_state_access is not
+       available. Skipping the first face in the data and putting the rest
+       at an offset verifies the face stride calculation. */
+    CubeMapTexture texture;
+    texture.setStorage(1, TextureFormat::RGBA8, Vector2i{2})
+        .setSubImage(0, {}, ImageView3D{PixelFormat::RGBA, PixelType::UnsignedByte, {2, 2, 1}, Containers::ArrayView<const UnsignedByte>{FullData}.prefix(16)})
+        .setSubImage(0, Vector3i::zAxis(1), ImageView3D{FullDataStorage, PixelFormat::RGBA, PixelType::UnsignedByte, {2, 2, 5}, FullData});
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    for(Int i = 0; i != 6; ++i) {
+        Image2D image = texture.image(CubeMapCoordinate(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i), 0, {PixelFormat::RGBA, PixelType::UnsignedByte});
+
+        MAGNUM_VERIFY_NO_ERROR();
+
+        CORRADE_COMPARE(image.size(), Vector2i{2});
+        CORRADE_COMPARE_AS(
+            (Containers::ArrayView<const UnsignedByte>{image.data<UnsignedByte>(), image.data().size()}),
+            (Containers::ArrayView<const UnsignedByte>{FullData}.slice(16*i, 16*(i + 1))), TestSuite::Compare::Container);
+    }
+}
+
+void CubeMapTextureGLTest::compressedFullSubImage() {
+    if(!Context::current().isExtensionSupported<Extensions::GL::EXT::texture_compression_s3tc>())
+        CORRADE_SKIP(Extensions::GL::EXT::texture_compression_s3tc::string() + std::string(" is not supported."));
+
+    /* All six faces in one call, as they would come from a KTX file */
+    CubeMapTexture texture;
+    texture.setStorage(1, TextureFormat::CompressedRGBAS3tcDxt3, Vector2i{4})
+        .setCompressedSubImage(0, {}, CompressedImageView3D{CompressedPixelFormat::RGBAS3tcDxt3, {4, 4, 6}, CompressedFullData});
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    for(Int i = 0; i != 6; ++i) {
+        CompressedImage2D image = texture.compressedImage(CubeMapCoordinate(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i), 0, {});
+
+        MAGNUM_VERIFY_NO_ERROR();
+
+        CORRADE_COMPARE(image.size(), Vector2i{4});
+        CORRADE_COMPARE_AS(
+            (Containers::ArrayView<const UnsignedByte>{image.data<UnsignedByte>(), image.data().size()}),
+            (Containers::ArrayView<const UnsignedByte>{CompressedFullData}.slice(16*i, 16*(i + 1))), TestSuite::Compare::Container);
+    }
+}
+
 void CubeMapTextureGLTest::fullImageQuery() {
     if(!Context::current().isExtensionSupported<Extensions::GL::ARB::direct_state_access>())
         CORRADE_SKIP(Extensions::GL::ARB::direct_state_access::string() + std::string(" is not supported."));
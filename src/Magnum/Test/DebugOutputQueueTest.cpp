@@ -0,0 +1,198 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <sstream>
+#include <thread>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/DebugOutputQueue.h"
+
+namespace Magnum { namespace Test {
+
+struct DebugOutputQueueTest: TestSuite::Tester {
+    explicit DebugOutputQueueTest();
+
+    void construct();
+    void drainEmpty();
+    void drain();
+    void deduplicate();
+    void full();
+    void truncate();
+    void threaded();
+    void print();
+};
+
+DebugOutputQueueTest::DebugOutputQueueTest() {
+    addTests({&DebugOutputQueueTest::construct,
+              &DebugOutputQueueTest::drainEmpty,
+              &DebugOutputQueueTest::drain,
+              &DebugOutputQueueTest::deduplicate,
+              &DebugOutputQueueTest::full,
+              &DebugOutputQueueTest::truncate,
+              &DebugOutputQueueTest::threaded,
+              &DebugOutputQueueTest::print});
+}
+
+namespace {
+    struct Message {
+        DebugOutput::Source source;
+        UnsignedInt id;
+        std::string message;
+        UnsignedInt count;
+    };
+
+    void collect(DebugOutput::Source source, DebugOutput::Type, UnsignedInt id, DebugOutput::Severity, const std::string& message, UnsignedInt count, const void* userParam) {
+        static_cast<std::vector<Message>*>(const_cast<void*>(userParam))->push_back({source, id, message, count});
+    }
+
+    Containers::ArrayView<const char> view(const std::string& string) {
+        return {string.data(), string.size()};
+    }
+}
+
+void DebugOutputQueueTest::construct() {
+    CORRADE_COMPARE(DebugOutputQueue{}.capacity(), 256);
+    CORRADE_COMPARE(DebugOutputQueue{100}.capacity(), 128);
+    CORRADE_COMPARE(DebugOutputQueue{1}.capacity(), 1);
+}
+
+void DebugOutputQueueTest::drainEmpty() {
+    DebugOutputQueue queue;
+    std::vector<Message> messages;
+    CORRADE_COMPARE(queue.drain(collect, &messages), 0);
+    CORRADE_VERIFY(messages.empty());
+}
+
+void DebugOutputQueueTest::drain() {
+    DebugOutputQueue queue;
+    queue.push(DebugOutput::Source::Api, DebugOutput::Type::Error, 1, DebugOutput::Severity::High, view("first"));
+    queue.push(DebugOutput::Source::Application, DebugOutput::Type::Marker, 2, DebugOutput::Severity::Notification, view("second"));
+
+    std::vector<Message> messages;
+    CORRADE_COMPARE(queue.drain(collect, &messages), 2);
+    CORRADE_COMPARE(messages.size(), 2);
+    CORRADE_COMPARE(messages[0].source, DebugOutput::Source::Api);
+    CORRADE_COMPARE(messages[0].id, 1);
+    CORRADE_COMPARE(messages[0].message, "first");
+    CORRADE_COMPARE(messages[0].count, 1);
+    CORRADE_COMPARE(messages[1].source, DebugOutput::Source::Application);
+    CORRADE_COMPARE(messages[1].id, 2);
+    CORRADE_COMPARE(messages[1].message, "second");
+
+    /* Everything was consumed */
+    messages.clear();
+    CORRADE_COMPARE(queue.drain(collect, &messages), 0);
+}
+
+void DebugOutputQueueTest::deduplicate() {
+    DebugOutputQueue queue{4};
+    for(std::size_t i = 0; i != 1000; ++i)
+        queue.push(DebugOutput::Source::Api, DebugOutput::Type::Performance, 131218, DebugOutput::Severity::Medium, view("spam"));
+    /* Same ID from another source is a different message */
+    queue.push(DebugOutput::Source::ShaderCompiler, DebugOutput::Type::Performance, 131218, DebugOutput::Severity::Medium, view("other"));
+
+    std::vector<Message> messages;
+    CORRADE_COMPARE(queue.drain(collect, &messages), 2);
+    CORRADE_COMPARE(messages[0].message, "spam");
+    CORRADE_COMPARE(messages[0].count, 1000);
+    CORRADE_COMPARE(messages[1].message, "other");
+    CORRADE_COMPARE(messages[1].count, 1);
+
+    /* After draining the message is queued again */
+    queue.push(DebugOutput::Source::Api, DebugOutput::Type::Performance, 131218, DebugOutput::Severity::Medium, view("spam"));
+    messages.clear();
+    CORRADE_COMPARE(queue.drain(collect, &messages), 1);
+    CORRADE_COMPARE(messages[0].count, 1);
+}
+
+void DebugOutputQueueTest::full() {
+    DebugOutputQueue queue{2};
+    for(UnsignedInt i = 0; i != 5; ++i)
+        queue.push(DebugOutput::Source::Api, DebugOutput::Type::Other, i, DebugOutput::Severity::Low, view("message"));
+
+    std::vector<Message> messages;
+    CORRADE_COMPARE(queue.drain(collect, &messages), 3);
+    CORRADE_COMPARE(messages[0].id, 0);
+    CORRADE_COMPARE(messages[1].id, 1);
+    CORRADE_COMPARE(messages[2].source, DebugOutput::Source::Application);
+    CORRADE_COMPARE(messages[2].message, "DebugOutputQueue: 3 messages dropped, queue full");
+
+    /* Dropped messages are not deduplicated against */
+    queue.push(DebugOutput::Source::Api, DebugOutput::Type::Other, 4, DebugOutput::Severity::Low, view("message"));
+    messages.clear();
+    CORRADE_COMPARE(queue.drain(collect, &messages), 1);
+    CORRADE_COMPARE(messages[0].id, 4);
+}
+
+void DebugOutputQueueTest::truncate() {
+    DebugOutputQueue queue;
+    queue.push(DebugOutput::Source::Api, DebugOutput::Type::Other, 0, DebugOutput::Severity::Low, view(std::string(1000, 'a')));
+
+    std::vector<Message> messages;
+    queue.drain(collect, &messages);
+    CORRADE_COMPARE(messages[0].message, std::string(DebugOutputQueue::MaxMessageLength, 'a'));
+}
+
+void DebugOutputQueueTest::threaded() {
+    DebugOutputQueue queue{1024};
+
+    /* Each thread pushes a few distinct messages many times */
+    std::vector<std::thread> threads;
+    for(UnsignedInt t = 0; t != 4; ++t) threads.emplace_back([&queue, t]() {
+        for(UnsignedInt i = 0; i != 1000; ++i)
+            queue.push(DebugOutput::Source::ThirdParty, DebugOutput::Type::Other, t*10 + i%5, DebugOutput::Severity::Low, {"message", 7});
+    });
+
+    /* Drain concurrently until all pushes are done */
+    std::vector<Message> messages;
+    for(std::size_t i = 0; i != 100; ++i) queue.drain(collect, &messages);
+    for(std::thread& thread: threads) thread.join();
+    queue.drain(collect, &messages);
+
+    UnsignedInt count = 0;
+    for(const Message& message: messages) {
+        CORRADE_COMPARE(message.message, "message");
+        count += message.count;
+    }
+    CORRADE_COMPARE(count, 4000);
+}
+
+void DebugOutputQueueTest::print() {
+    DebugOutputQueue queue;
+    queue.push(DebugOutput::Source::Api, DebugOutput::Type::Performance, 131218, DebugOutput::Severity::Medium, view("Program/shader state performance warning"));
+    queue.push(DebugOutput::Source::Api, DebugOutput::Type::Performance, 131218, DebugOutput::Severity::Medium, view("Program/shader state performance warning"));
+    queue.push(DebugOutput::Source::Application, DebugOutput::Type::Marker, 1337, DebugOutput::Severity::Notification, view("Hello"));
+
+    std::ostringstream out;
+    Debug redirectOutput{&out};
+    CORRADE_COMPARE(queue.drain(), 2);
+    CORRADE_COMPARE(out.str(),
+        "Debug output: medium severity API performance note (131218): Program/shader state performance warning (repeated 2 times)\n"
+        "Debug output: application marker (1337): Hello\n");
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::DebugOutputQueueTest)
@@ -0,0 +1,157 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Configuration.h>
+
+#include "Magnum/Implementation/fastPaths.h"
+
+namespace Magnum { namespace Test {
+
+struct FastPathsTest: TestSuite::Tester {
+    explicit FastPathsTest();
+
+    void faster();
+
+    void cacheEmpty();
+    void cacheRoundTrip();
+    void cacheNoPaths();
+    void cacheDifferentDriver();
+    void cacheDifferentVersion();
+    void cacheUnknownPath();
+};
+
+FastPathsTest::FastPathsTest() {
+    addTests({&FastPathsTest::faster,
+
+              &FastPathsTest::cacheEmpty,
+              &FastPathsTest::cacheRoundTrip,
+              &FastPathsTest::cacheNoPaths,
+              &FastPathsTest::cacheDifferentDriver,
+              &FastPathsTest::cacheDifferentVersion,
+              &FastPathsTest::cacheUnknownPath});
+}
+
+using Implementation::FastPath;
+using Implementation::FastPaths;
+
+void FastPathsTest::faster() {
+    CORRADE_VERIFY(Implementation::isFastPathFaster(1000, 500));
+    CORRADE_VERIFY(Implementation::isFastPathFaster(1000, 899));
+
+    /* Less than 10% improvement is not enough */
+    CORRADE_VERIFY(!Implementation::isFastPathFaster(1000, 900));
+    CORRADE_VERIFY(!Implementation::isFastPathFaster(1000, 1000));
+    CORRADE_VERIFY(!Implementation::isFastPathFaster(1000, 2000));
+}
+
+void FastPathsTest::cacheEmpty() {
+    Utility::Configuration cache;
+    FastPaths paths = FastPath::MeshBind;
+    CORRADE_VERIFY(!Implementation::fastPathsFromCache(cache, "Renderer", "Vendor", "4.5", paths));
+
+    /* Paths are untouched on a miss, the cache is initialized */
+    CORRADE_VERIFY(paths == FastPath::MeshBind);
+    CORRADE_VERIFY(cache.value<UnsignedInt>("version") != 0);
+}
+
+void FastPathsTest::cacheRoundTrip() {
+    Utility::Configuration cache;
+    FastPaths paths;
+    CORRADE_VERIFY(!Implementation::fastPathsFromCache(cache, "Renderer", "Vendor", "4.5", paths));
+
+    Implementation::fastPathsToCache(cache, "Renderer", "Vendor", "4.5", FastPath::BufferMapRange|FastPath::TextureUploadBind);
+    CORRADE_COMPARE(cache.groupCount("driver"), 1);
+    CORRADE_COMPARE(cache.groups("driver")[0]->values("fastPath"), (std::vector<std::string>{"buffer-map-range", "texture-upload-bind"}));
+
+    CORRADE_VERIFY(Implementation::fastPathsFromCache(cache, "Renderer", "Vendor", "4.5", paths));
+    CORRADE_VERIFY(paths == (FastPath::BufferMapRange|FastPath::TextureUploadBind));
+}
+
+void FastPathsTest::cacheNoPaths() {
+    Utility::Configuration cache;
+    FastPaths paths = FastPath::BufferBind;
+    Implementation::fastPathsFromCache(cache, "Renderer", "Vendor", "4.5", paths);
+
+    /* Probe picking only the default implementations is a hit as well */
+    Implementation::fastPathsToCache(cache, "Renderer", "Vendor", "4.5", {});
+    CORRADE_VERIFY(Implementation::fastPathsFromCache(cache, "Renderer", "Vendor", "4.5", paths));
+    CORRADE_VERIFY(paths == FastPaths{});
+}
+
+void FastPathsTest::cacheDifferentDriver() {
+    Utility::Configuration cache;
+    FastPaths paths;
+    Implementation::fastPathsFromCache(cache, "Renderer", "Vendor", "4.5", paths);
+    Implementation::fastPathsToCache(cache, "Renderer", "Vendor", "4.5", FastPath::BufferBind);
+
+    /* Every part of the key has to match */
+    CORRADE_VERIFY(!Implementation::fastPathsFromCache(cache, "Other", "Vendor", "4.5", paths));
+    CORRADE_VERIFY(!Implementation::fastPathsFromCache(cache, "Renderer", "Other", "4.5", paths));
+    CORRADE_VERIFY(!Implementation::fastPathsFromCache(cache, "Renderer", "Vendor", "4.6", paths));
+    CORRADE_VERIFY(paths == FastPaths{});
+
+    /* Other drivers are kept */
+    Implementation::fastPathsToCache(cache, "Renderer", "Vendor", "4.6", FastPath::MeshBind);
+    CORRADE_COMPARE(cache.groupCount("driver"), 2);
+    CORRADE_VERIFY(Implementation::fastPathsFromCache(cache, "Renderer", "Vendor", "4.5", paths));
+    CORRADE_VERIFY(paths == FastPath::BufferBind);
+    CORRADE_VERIFY(Implementation::fastPathsFromCache(cache, "Renderer", "Vendor", "4.6", paths));
+    CORRADE_VERIFY(paths == FastPath::MeshBind);
+}
+
+void FastPathsTest::cacheDifferentVersion() {
+    Utility::Configuration cache;
+    FastPaths paths;
+    Implementation::fastPathsFromCache(cache, "Renderer", "Vendor", "4.5", paths);
+    Implementation::fastPathsToCache(cache, "Renderer", "Vendor", "4.5", FastPath::BufferBind);
+
+    /* Cache written by another version of the probe is discarded */
+    const UnsignedInt version = cache.value<UnsignedInt>("version");
+    cache.setValue("version", version + 1);
+    CORRADE_VERIFY(!Implementation::fastPathsFromCache(cache, "Renderer", "Vendor", "4.5", paths));
+    CORRADE_COMPARE(cache.groupCount("driver"), 0);
+    CORRADE_COMPARE(cache.value<UnsignedInt>("version"), version);
+}
+
+void FastPathsTest::cacheUnknownPath() {
+    Utility::Configuration cache;
+    FastPaths paths;
+    Implementation::fastPathsFromCache(cache, "Renderer", "Vendor", "4.5", paths);
+
+    /* Paths that are no longer known are ignored */
+    Utility::ConfigurationGroup* const driver = cache.addGroup("driver");
+    driver->setValue("renderer", "Renderer");
+    driver->setValue("vendor", "Vendor");
+    driver->setValue("version", "4.5");
+    driver->addValue("fastPath", "shader-bind");
+    driver->addValue("fastPath", "texture-bind");
+
+    CORRADE_VERIFY(Implementation::fastPathsFromCache(cache, "Renderer", "Vendor", "4.5", paths));
+    CORRADE_VERIFY(paths == FastPath::TextureBind);
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::FastPathsTest)
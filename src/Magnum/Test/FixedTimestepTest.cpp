@@ -0,0 +1,149 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/FixedTimestep.h"
+
+namespace Magnum { namespace Test {
+
+struct FixedTimestepTest: TestSuite::Tester {
+    explicit FixedTimestepTest();
+
+    void construct();
+    void steps();
+    void noStep();
+    void maxStepCount();
+    void setStep();
+    void reset();
+};
+
+FixedTimestepTest::FixedTimestepTest() {
+    addTests({&FixedTimestepTest::construct,
+              &FixedTimestepTest::steps,
+              &FixedTimestepTest::noStep,
+              &FixedTimestepTest::maxStepCount,
+              &FixedTimestepTest::setStep,
+              &FixedTimestepTest::reset});
+}
+
+void FixedTimestepTest::construct() {
+    FixedTimestep timestep{0.25f, 3};
+    CORRADE_COMPARE(timestep.step(), 0.25f);
+    CORRADE_COMPARE(timestep.maxStepCount(), 3);
+    CORRADE_COMPARE(timestep.time(), 0.0f);
+    CORRADE_COMPARE(timestep.stepCount(), 0);
+    CORRADE_COMPARE(timestep.alpha(), 0.0f);
+    CORRADE_COMPARE(timestep.droppedTime(), 0.0f);
+}
+
+void FixedTimestepTest::steps() {
+    FixedTimestep timestep{0.25f};
+
+    /* Two full steps and a half */
+    timestep.accumulate(0.625f);
+    CORRADE_VERIFY(timestep.nextStep());
+    CORRADE_COMPARE(timestep.time(), 0.25f);
+    CORRADE_VERIFY(timestep.nextStep());
+    CORRADE_COMPARE(timestep.time(), 0.5f);
+    CORRADE_VERIFY(!timestep.nextStep());
+    CORRADE_COMPARE(timestep.stepCount(), 2);
+    CORRADE_COMPARE(timestep.alpha(), 0.5f);
+
+    /* The remainder is carried over to the next frame */
+    timestep.accumulate(0.125f);
+    CORRADE_VERIFY(timestep.nextStep());
+    CORRADE_VERIFY(!timestep.nextStep());
+    CORRADE_COMPARE(timestep.time(), 0.75f);
+    CORRADE_COMPARE(timestep.stepCount(), 3);
+    CORRADE_COMPARE(timestep.alpha(), 0.0f);
+}
+
+void FixedTimestepTest::noStep() {
+    FixedTimestep timestep{0.25f};
+
+    /* Frames shorter than the step only advance the interpolation */
+    timestep.accumulate(0.0625f);
+    CORRADE_VERIFY(!timestep.nextStep());
+    CORRADE_COMPARE(timestep.alpha(), 0.25f);
+
+    timestep.accumulate(0.0625f);
+    CORRADE_VERIFY(!timestep.nextStep());
+    CORRADE_COMPARE(timestep.alpha(), 0.5f);
+    CORRADE_COMPARE(timestep.time(), 0.0f);
+}
+
+void FixedTimestepTest::maxStepCount() {
+    FixedTimestep timestep{0.25f, 2};
+
+    /* A long frame, only two steps are run and the rest is dropped */
+    timestep.accumulate(1.25f);
+    UnsignedInt count = 0;
+    while(timestep.nextStep()) ++count;
+    CORRADE_COMPARE(count, 2);
+    CORRADE_COMPARE(timestep.time(), 0.5f);
+    CORRADE_COMPARE(timestep.alpha(), 0.0f);
+    CORRADE_COMPARE(timestep.droppedTime(), 0.75f);
+
+    timestep.setMaxStepCount(5);
+    CORRADE_COMPARE(timestep.maxStepCount(), 5);
+    timestep.accumulate(1.25f);
+    count = 0;
+    while(timestep.nextStep()) ++count;
+    CORRADE_COMPARE(count, 5);
+    CORRADE_COMPARE(timestep.droppedTime(), 0.75f);
+}
+
+void FixedTimestepTest::setStep() {
+    FixedTimestep timestep{0.25f};
+    timestep.accumulate(0.375f);
+    CORRADE_VERIFY(timestep.nextStep());
+
+    /* The accumulated remainder is kept */
+    timestep.setStep(0.0625f);
+    CORRADE_COMPARE(timestep.step(), 0.0625f);
+    CORRADE_COMPARE(timestep.alpha(), 2.0f);
+    CORRADE_VERIFY(timestep.nextStep());
+    CORRADE_VERIFY(timestep.nextStep());
+    CORRADE_VERIFY(!timestep.nextStep());
+    CORRADE_COMPARE(timestep.time(), 0.375f);
+}
+
+void FixedTimestepTest::reset() {
+    FixedTimestep timestep{0.25f, 1};
+    timestep.accumulate(0.875f);
+    CORRADE_VERIFY(timestep.nextStep());
+
+    timestep.reset();
+    CORRADE_COMPARE(timestep.time(), 0.0f);
+    CORRADE_COMPARE(timestep.stepCount(), 0);
+    CORRADE_COMPARE(timestep.alpha(), 0.0f);
+    CORRADE_COMPARE(timestep.droppedTime(), 0.0f);
+    CORRADE_VERIFY(!timestep.nextStep());
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::FixedTimestepTest)
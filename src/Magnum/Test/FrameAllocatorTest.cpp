@@ -0,0 +1,194 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstdint>
+#include <thread>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/FrameAllocator.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Test {
+
+struct FrameAllocatorTest: TestSuite::Tester {
+    explicit FrameAllocatorTest();
+
+    void construct();
+    void allocate();
+    void allocateAlignment();
+    void allocateArray();
+    void overflow();
+    void reset();
+
+    void current();
+    void currentThreadLocal();
+    void currentArray();
+};
+
+FrameAllocatorTest::FrameAllocatorTest() {
+    addTests({&FrameAllocatorTest::construct,
+              &FrameAllocatorTest::allocate,
+              &FrameAllocatorTest::allocateAlignment,
+              &FrameAllocatorTest::allocateArray,
+              &FrameAllocatorTest::overflow,
+              &FrameAllocatorTest::reset,
+
+              &FrameAllocatorTest::current,
+              &FrameAllocatorTest::currentThreadLocal,
+              &FrameAllocatorTest::currentArray});
+}
+
+void FrameAllocatorTest::construct() {
+    FrameAllocator allocator{1024};
+    CORRADE_COMPARE(allocator.capacity(), 1024);
+    CORRADE_COMPARE(allocator.usedSize(), 0);
+    CORRADE_COMPARE(allocator.overflowCount(), 0);
+}
+
+void FrameAllocatorTest::allocate() {
+    FrameAllocator allocator{1024};
+
+    char* a = static_cast<char*>(allocator.allocate(100, 1));
+    char* b = static_cast<char*>(allocator.allocate(50, 1));
+    CORRADE_VERIFY(a);
+    CORRADE_COMPARE(b, a + 100);
+    CORRADE_COMPARE(allocator.usedSize(), 150);
+    CORRADE_COMPARE(allocator.overflowCount(), 0);
+}
+
+void FrameAllocatorTest::allocateAlignment() {
+    FrameAllocator allocator{1024};
+
+    allocator.allocate(3, 1);
+    void* a = allocator.allocate(4, 4);
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(a) % 4, 0);
+    CORRADE_COMPARE(allocator.usedSize(), 8);
+
+    allocator.allocate(1, 1);
+    void* b = allocator.allocate(16, 8);
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(b) % 8, 0);
+    CORRADE_COMPARE(allocator.usedSize(), 32);
+}
+
+void FrameAllocatorTest::allocateArray() {
+    FrameAllocator allocator{1024};
+
+    allocator.allocate(1, 1);
+    Containers::ArrayView<Vector3> a = allocator.allocateArray<Vector3>(10);
+    CORRADE_COMPARE(a.size(), 10);
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(a.data()) % alignof(Vector3), 0);
+    for(const Vector3& v: a) CORRADE_COMPARE(v, Vector3{});
+    CORRADE_COMPARE(allocator.usedSize(), 4 + 10*sizeof(Vector3));
+}
+
+void FrameAllocatorTest::overflow() {
+    FrameAllocator allocator{64};
+
+    void* a = allocator.allocate(48, 1);
+    void* b = allocator.allocate(32, 1);
+    CORRADE_VERIFY(a);
+    CORRADE_VERIFY(b);
+    CORRADE_COMPARE(allocator.overflowCount(), 1);
+    CORRADE_COMPARE(allocator.capacity(), 64);
+
+    /* Overflow memory is usable */
+    static_cast<char*>(b)[31] = 'x';
+}
+
+void FrameAllocatorTest::reset() {
+    FrameAllocator allocator{64};
+
+    /* The block gets enlarged to fit everything from previous frame */
+    for(std::size_t i = 0; i != 3; ++i) allocator.allocateArray<Int>(10);
+    CORRADE_COMPARE(allocator.overflowCount(), 2);
+    allocator.reset();
+    CORRADE_VERIFY(allocator.capacity() >= 120);
+    CORRADE_COMPARE(allocator.usedSize(), 0);
+    CORRADE_COMPARE(allocator.overflowCount(), 0);
+
+    /* Same frame again doesn't overflow */
+    for(std::size_t i = 0; i != 3; ++i) allocator.allocateArray<Int>(10);
+    CORRADE_COMPARE(allocator.overflowCount(), 0);
+    CORRADE_COMPARE(allocator.usedSize(), 120);
+
+    /* Reset without overflow keeps the block */
+    const std::size_t capacity = allocator.capacity();
+    allocator.reset();
+    void* data = allocator.allocate(1);
+    allocator.reset();
+    CORRADE_COMPARE(allocator.capacity(), capacity);
+    CORRADE_COMPARE(allocator.allocate(1), data);
+}
+
+void FrameAllocatorTest::current() {
+    CORRADE_VERIFY(!FrameAllocator::current());
+
+    {
+        FrameAllocator a;
+        CORRADE_COMPARE(FrameAllocator::current(), &a);
+
+        /* Second allocator doesn't replace the current one */
+        FrameAllocator b;
+        CORRADE_COMPARE(FrameAllocator::current(), &a);
+
+        FrameAllocator::makeCurrent(&b);
+        CORRADE_COMPARE(FrameAllocator::current(), &b);
+    }
+
+    CORRADE_VERIFY(!FrameAllocator::current());
+}
+
+void FrameAllocatorTest::currentThreadLocal() {
+    FrameAllocator a;
+    CORRADE_COMPARE(FrameAllocator::current(), &a);
+
+    FrameAllocator* other{};
+    std::thread{[&other]() { other = FrameAllocator::current(); }}.join();
+    CORRADE_VERIFY(!other);
+}
+
+void FrameAllocatorTest::currentArray() {
+    {
+        /* Heap fallback */
+        Containers::Array<Int> a = FrameAllocator::currentArray<Int>(5);
+        CORRADE_COMPARE(a.size(), 5);
+        CORRADE_COMPARE(a[4], 0);
+    }
+
+    FrameAllocator allocator{1024};
+    {
+        Containers::Array<Int> a = FrameAllocator::currentArray<Int>(5);
+        CORRADE_COMPARE(a.size(), 5);
+        CORRADE_COMPARE(a[4], 0);
+        CORRADE_COMPARE(allocator.usedSize(), 20);
+    }
+
+    /* Destruction of the array doesn't free anything */
+    CORRADE_COMPARE(allocator.usedSize(), 20);
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::FrameAllocatorTest)
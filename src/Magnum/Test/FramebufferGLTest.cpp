@@ -108,6 +108,7 @@ struct FramebufferGLTest: AbstractOpenGLTester {
     void invalidateSub();
     #endif
     void read();
+    void readView();
     #ifndef MAGNUM_TARGET_GLES2
     void readBuffer();
     #endif
@@ -141,6 +142,9 @@ struct FramebufferGLTest: AbstractOpenGLTester {
     void copySubImageCubeMapTextureArray();
     #endif
     void blit();
+    #ifndef MAGNUM_TARGET_GLES2
+    void resolve();
+    #endif
 
     #ifdef MAGNUM_TARGET_GLES2
     private:
@@ -202,6 +206,7 @@ FramebufferGLTest::FramebufferGLTest() {
               &FramebufferGLTest::invalidateSub,
               #endif
               &FramebufferGLTest::read,
+              &FramebufferGLTest::readView,
               #ifndef MAGNUM_TARGET_GLES2
               &FramebufferGLTest::readBuffer,
               #endif
@@ -234,7 +239,11 @@ FramebufferGLTest::FramebufferGLTest() {
               #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
               &FramebufferGLTest::copySubImageCubeMapTextureArray,
               #endif
-              &FramebufferGLTest::blit});
+              &FramebufferGLTest::blit,
+              #ifndef MAGNUM_TARGET_GLES2
+              &FramebufferGLTest::resolve
+              #endif
+              });
 
     #ifdef MAGNUM_TARGET_GLES2
     if(Context::current().isExtensionSupported<Extensions::GL::EXT::texture_storage>()) {
@@ -1177,6 +1186,49 @@ void FramebufferGLTest::read() {
     }
 }
 
+void FramebufferGLTest::readView() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::framebuffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::framebuffer_object::string() + std::string(" is not available."));
+    #endif
+
+    Renderbuffer color;
+    #ifndef MAGNUM_TARGET_GLES2
+    color.setStorage(RenderbufferFormat::RGBA8, Vector2i(128));
+    #else
+    color.setStorage(RenderbufferFormat::RGBA4, Vector2i(128));
+    #endif
+
+    Framebuffer framebuffer({{}, Vector2i(128)});
+    framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment(0), color);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(framebuffer.checkStatus(FramebufferTarget::Read), Framebuffer::Status::Complete);
+
+    Renderer::setClearColor(Math::normalize<Color4>(Color4ub(128, 64, 32, 17)));
+    framebuffer.clear(FramebufferClear::Color);
+
+    /* Reading twice into the same memory, the second time with a smaller
+       rectangle */
+    char data[(DataOffset + 8*16)*sizeof(Color4ub)]{};
+    const Color4ub* pixels = reinterpret_cast<const Color4ub*>(data);
+    framebuffer.read(Range2Di::fromSize({16, 8}, {8, 16}), DataStorage,
+        PixelFormat::RGBA, PixelType::UnsignedByte, data);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(pixels[DataOffset], Color4ub(128, 64, 32, 17));
+    CORRADE_COMPARE(pixels[DataOffset + 8*16 - 1], Color4ub(128, 64, 32, 17));
+
+    Renderer::setClearColor(Math::normalize<Color4>(Color4ub(32, 64, 128, 255)));
+    framebuffer.clear(FramebufferClear::Color);
+    framebuffer.read(Range2Di::fromSize({16, 8}, {8, 8}), DataStorage,
+        PixelFormat::RGBA, PixelType::UnsignedByte, data);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(pixels[DataOffset], Color4ub(32, 64, 128, 255));
+    CORRADE_COMPARE(pixels[DataOffset + 8*16 - 1], Color4ub(128, 64, 32, 17));
+}
+
 #ifndef MAGNUM_TARGET_GLES2
 void FramebufferGLTest::readBuffer() {
     #ifndef MAGNUM_TARGET_GLES
@@ -1761,6 +1813,39 @@ void FramebufferGLTest::blit() {
     CORRADE_COMPARE(imageAfter.data<Color4ub>()[0], Color4ub(128, 64, 32, 17));
 }
 
+#ifndef MAGNUM_TARGET_GLES2
+void FramebufferGLTest::resolve() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::framebuffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::framebuffer_object::string() + std::string(" is not available."));
+    #endif
+
+    Renderbuffer colorMultisample, depthMultisample, color;
+    colorMultisample.setStorageMultisample(4, RenderbufferFormat::RGBA8, Vector2i(128));
+    depthMultisample.setStorageMultisample(4, RenderbufferFormat::DepthComponent24, Vector2i(128));
+    color.setStorage(RenderbufferFormat::RGBA8, Vector2i(128));
+
+    Framebuffer multisampled({{}, Vector2i(128)}), resolved({{}, Vector2i(128)});
+    multisampled.attachRenderbuffer(Framebuffer::ColorAttachment(0), colorMultisample)
+                .attachRenderbuffer(Framebuffer::BufferAttachment::Depth, depthMultisample);
+    resolved.attachRenderbuffer(Framebuffer::ColorAttachment(0), color);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(multisampled.checkStatus(FramebufferTarget::Read), Framebuffer::Status::Complete);
+    CORRADE_COMPARE(resolved.checkStatus(FramebufferTarget::Draw), Framebuffer::Status::Complete);
+
+    Renderer::setClearColor(Math::normalize<Color4>(Color4ub(128, 64, 32, 17)));
+    multisampled.clear(FramebufferClear::Color|FramebufferClear::Depth);
+
+    multisampled.resolve(resolved, multisampled.viewport(), FramebufferBlit::Color,
+        {Framebuffer::ColorAttachment(0), Framebuffer::InvalidationAttachment::Depth});
+    Image2D image = resolved.read({{}, Vector2i{1}}, {PixelFormat::RGBA, PixelType::UnsignedByte});
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(image.data<Color4ub>()[0], Color4ub(128, 64, 32, 17));
+}
+#endif
+
 }}
 
 MAGNUM_GL_TEST_MAIN(Magnum::Test::FramebufferGLTest)
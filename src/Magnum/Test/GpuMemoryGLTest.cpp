@@ -0,0 +1,186 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+
+#include "Magnum/Buffer.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/GpuMemory.h"
+#include "Magnum/Renderbuffer.h"
+#include "Magnum/RenderbufferFormat.h"
+#include "Magnum/Texture.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct GpuMemoryGLTest: AbstractOpenGLTester {
+    explicit GpuMemoryGLTest();
+
+    void buffer();
+    void texture();
+    void renderbuffer();
+    void peakUsage();
+    void largestAllocations();
+
+    void debugCategory();
+};
+
+GpuMemoryGLTest::GpuMemoryGLTest() {
+    addTests({&GpuMemoryGLTest::buffer,
+              &GpuMemoryGLTest::texture,
+              &GpuMemoryGLTest::renderbuffer,
+              &GpuMemoryGLTest::peakUsage,
+              &GpuMemoryGLTest::largestAllocations,
+
+              &GpuMemoryGLTest::debugCategory});
+}
+
+void GpuMemoryGLTest::buffer() {
+    const std::size_t usage = GpuMemory::usage(GpuMemory::Category::Buffer);
+    const std::size_t count = GpuMemory::allocationCount();
+
+    {
+        Buffer buffer;
+        buffer.setData({nullptr, 1024}, BufferUsage::StaticDraw);
+
+        MAGNUM_VERIFY_NO_ERROR();
+        CORRADE_COMPARE(GpuMemory::usage(GpuMemory::Category::Buffer), usage + 1024);
+        CORRADE_COMPARE(GpuMemory::allocationCount(), count + 1);
+
+        /* Respecifying the data replaces the previous size */
+        buffer.setData({nullptr, 256}, BufferUsage::StaticDraw);
+        CORRADE_COMPARE(GpuMemory::usage(GpuMemory::Category::Buffer), usage + 256);
+
+        /* Updating part of the data doesn't change anything */
+        const char data[16]{};
+        buffer.setSubData(0, data);
+        CORRADE_COMPARE(GpuMemory::usage(GpuMemory::Category::Buffer), usage + 256);
+    }
+
+    CORRADE_COMPARE(GpuMemory::usage(GpuMemory::Category::Buffer), usage);
+    CORRADE_COMPARE(GpuMemory::allocationCount(), count);
+}
+
+void GpuMemoryGLTest::texture() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::texture_storage>())
+        CORRADE_SKIP(Extensions::GL::ARB::texture_storage::string() + std::string(" is not available."));
+    #endif
+
+    const std::size_t usage = GpuMemory::usage(GpuMemory::Category::Texture);
+
+    {
+        Texture2D texture;
+        texture.setStorage(3, TextureFormat::RGBA8, {4, 4});
+
+        MAGNUM_VERIFY_NO_ERROR();
+        /* 4x4, 2x2 and 1x1 levels, four bytes each */
+        CORRADE_COMPARE(GpuMemory::usage(GpuMemory::Category::Texture), usage + (16 + 4 + 1)*4);
+    }
+
+    CORRADE_COMPARE(GpuMemory::usage(GpuMemory::Category::Texture), usage);
+}
+
+void GpuMemoryGLTest::renderbuffer() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::framebuffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::framebuffer_object::string() + std::string(" is not available."));
+    #endif
+
+    const std::size_t usage = GpuMemory::usage(GpuMemory::Category::Renderbuffer);
+
+    {
+        Renderbuffer renderbuffer;
+        #ifndef MAGNUM_TARGET_GLES2
+        renderbuffer.setStorage(RenderbufferFormat::RGBA8, {32, 16});
+        #else
+        renderbuffer.setStorage(RenderbufferFormat::RGBA4, {32, 16});
+        #endif
+
+        MAGNUM_VERIFY_NO_ERROR();
+        #ifndef MAGNUM_TARGET_GLES2
+        CORRADE_COMPARE(GpuMemory::usage(GpuMemory::Category::Renderbuffer), usage + 32*16*4);
+        #else
+        CORRADE_COMPARE(GpuMemory::usage(GpuMemory::Category::Renderbuffer), usage + 32*16*2);
+        #endif
+    }
+
+    CORRADE_COMPARE(GpuMemory::usage(GpuMemory::Category::Renderbuffer), usage);
+}
+
+void GpuMemoryGLTest::peakUsage() {
+    GpuMemory::resetPeakUsage();
+    const std::size_t usage = GpuMemory::usage();
+    CORRADE_COMPARE(GpuMemory::peakUsage(), usage);
+
+    {
+        Buffer buffer;
+        buffer.setData({nullptr, 4096}, BufferUsage::StaticDraw);
+    }
+
+    CORRADE_COMPARE(GpuMemory::usage(), usage);
+    CORRADE_COMPARE(GpuMemory::peakUsage(), usage + 4096);
+    CORRADE_COMPARE(GpuMemory::peakUsage(GpuMemory::Category::Buffer), GpuMemory::usage(GpuMemory::Category::Buffer) + 4096);
+
+    GpuMemory::resetPeakUsage();
+    CORRADE_COMPARE(GpuMemory::peakUsage(), usage);
+}
+
+void GpuMemoryGLTest::largestAllocations() {
+    Buffer a, b, c;
+    a.setData({nullptr, 1 << 20}, BufferUsage::StaticDraw);
+    #ifndef MAGNUM_TARGET_WEBGL
+    b.setLabel("Second largest");
+    #endif
+    b.setData({nullptr, 1 << 19}, BufferUsage::StaticDraw);
+    c.setData({nullptr, 16}, BufferUsage::StaticDraw);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    std::vector<GpuMemory::Allocation> allocations = GpuMemory::largestAllocations(2);
+    CORRADE_COMPARE(allocations.size(), 2);
+    CORRADE_COMPARE(allocations[0].category, GpuMemory::Category::Buffer);
+    CORRADE_COMPARE(allocations[0].id, a.id());
+    CORRADE_COMPARE(allocations[0].size, 1 << 20);
+    CORRADE_COMPARE(allocations[1].id, b.id());
+    CORRADE_COMPARE(allocations[1].size, 1 << 19);
+    #ifndef MAGNUM_TARGET_WEBGL
+    CORRADE_COMPARE(allocations[1].label, "Second largest");
+    #endif
+}
+
+void GpuMemoryGLTest::debugCategory() {
+    std::ostringstream out;
+
+    Debug(&out) << GpuMemory::Category::Texture << GpuMemory::Category(0xde);
+    CORRADE_COMPARE(out.str(), "GpuMemory::Category::Texture GpuMemory::Category(0xde)\n");
+}
+
+}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Test::GpuMemoryGLTest)
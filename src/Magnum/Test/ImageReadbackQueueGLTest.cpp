@@ -0,0 +1,181 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Framebuffer.h"
+#include "Magnum/ImageReadbackQueue.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Renderbuffer.h"
+#include "Magnum/RenderbufferFormat.h"
+#include "Magnum/Renderer.h"
+#include "Magnum/Texture.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct ImageReadbackQueueGLTest: AbstractOpenGLTester {
+    explicit ImageReadbackQueueGLTest();
+
+    void construct();
+
+    void read();
+    void readFull();
+    #ifndef MAGNUM_TARGET_GLES
+    void image();
+    #endif
+};
+
+ImageReadbackQueueGLTest::ImageReadbackQueueGLTest() {
+    addTests({&ImageReadbackQueueGLTest::construct,
+
+              &ImageReadbackQueueGLTest::read,
+              &ImageReadbackQueueGLTest::readFull,
+              #ifndef MAGNUM_TARGET_GLES
+              &ImageReadbackQueueGLTest::image
+              #endif
+              });
+}
+
+void ImageReadbackQueueGLTest::construct() {
+    ImageReadbackQueue2D queue{PixelFormat::RGBA, PixelType::UnsignedByte, 4};
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(queue.bufferCount(), 4);
+    CORRADE_COMPARE(queue.pendingCount(), 0);
+    CORRADE_COMPARE(queue.waitCount(), 0);
+    CORRADE_VERIFY(!queue.retrieve());
+}
+
+void ImageReadbackQueueGLTest::read() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::framebuffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::framebuffer_object::string() + std::string(" is not available."));
+    #endif
+
+    Renderbuffer color;
+    color.setStorage(RenderbufferFormat::RGBA8, Vector2i(32));
+
+    Framebuffer framebuffer({{}, Vector2i(32)});
+    framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment(0), color);
+
+    ImageReadbackQueue2D queue{PixelFormat::RGBA, PixelType::UnsignedByte};
+
+    Renderer::setClearColor(Math::normalize<Color4>(Color4ub(128, 64, 32, 17)));
+    framebuffer.clear(FramebufferClear::Color);
+    queue.read(framebuffer, Range2Di::fromSize({16, 8}, {8, 16}));
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(queue.pendingCount(), 1);
+
+    std::optional<Image2D> image = queue.retrieveBlocking();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(queue.pendingCount(), 0);
+    CORRADE_COMPARE(image->size(), Vector2i(8, 16));
+    CORRADE_COMPARE(image->data<Color4ub>()[0], Color4ub(128, 64, 32, 17));
+}
+
+void ImageReadbackQueueGLTest::readFull() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::framebuffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::framebuffer_object::string() + std::string(" is not available."));
+    #endif
+
+    Renderbuffer color;
+    color.setStorage(RenderbufferFormat::RGBA8, Vector2i(32));
+
+    Framebuffer framebuffer({{}, Vector2i(32)});
+    framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment(0), color);
+
+    /* Fill all buffers with different colors */
+    ImageReadbackQueue2D queue{PixelFormat::RGBA, PixelType::UnsignedByte, 2};
+    Renderer::setClearColor(Math::normalize<Color4>(Color4ub(255, 0, 0, 255)));
+    framebuffer.clear(FramebufferClear::Color);
+    queue.read(framebuffer, {{}, Vector2i(32)});
+    Renderer::setClearColor(Math::normalize<Color4>(Color4ub(0, 255, 0, 255)));
+    framebuffer.clear(FramebufferClear::Color);
+    queue.read(framebuffer, {{}, Vector2i(32)});
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(queue.pendingCount(), 2);
+
+    /* All buffers are pending, so this always gives back the oldest one */
+    std::optional<Image2D> first = queue.retrieve();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(first);
+    CORRADE_COMPARE(queue.pendingCount(), 1);
+    CORRADE_COMPARE(first->data<Color4ub>()[0], Color4ub(255, 0, 0, 255));
+
+    /* Reuse the freed buffer */
+    Renderer::setClearColor(Math::normalize<Color4>(Color4ub(0, 0, 255, 255)));
+    framebuffer.clear(FramebufferClear::Color);
+    queue.read(framebuffer, {{}, Vector2i(32)});
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(queue.pendingCount(), 2);
+
+    std::optional<Image2D> second = queue.retrieve();
+    std::optional<Image2D> third = queue.retrieveBlocking();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(second);
+    CORRADE_VERIFY(third);
+    CORRADE_COMPARE(queue.pendingCount(), 0);
+    CORRADE_COMPARE(second->data<Color4ub>()[0], Color4ub(0, 255, 0, 255));
+    CORRADE_COMPARE(third->data<Color4ub>()[0], Color4ub(0, 0, 255, 255));
+}
+
+#ifndef MAGNUM_TARGET_GLES
+void ImageReadbackQueueGLTest::image() {
+    constexpr UnsignedByte data[] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+                                      0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+
+    Texture2D texture;
+    texture.setImage(0, TextureFormat::RGBA8,
+        ImageView2D(PixelFormat::RGBA, PixelType::UnsignedByte, Vector2i(2), data));
+
+    ImageReadbackQueue2D queue{PixelFormat::RGBA, PixelType::UnsignedByte, 1};
+    queue.image(texture, 0);
+
+    /* The only buffer is pending, so this waits if needed */
+    std::optional<Image2D> image = queue.retrieve();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->size(), Vector2i(2));
+    CORRADE_COMPARE(image->data<UnsignedByte>()[5], 0x05);
+    CORRADE_COMPARE(image->data<UnsignedByte>()[15], 0x0f);
+}
+#endif
+
+}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Test::ImageReadbackQueueGLTest)
@@ -23,6 +23,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <string>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Image.h"
@@ -46,6 +47,13 @@ struct ImageTest: TestSuite::Tester {
     void toViewCompressed();
     void release();
     void releaseCompressed();
+
+    void copy();
+    void copyStrided();
+    void copyToData();
+    void copy3D();
+    void subImage();
+    void subImage1D();
 };
 
 ImageTest::ImageTest() {
@@ -61,7 +69,14 @@ ImageTest::ImageTest() {
               &ImageTest::toView,
               &ImageTest::toViewCompressed,
               &ImageTest::release,
-              &ImageTest::releaseCompressed});
+              &ImageTest::releaseCompressed,
+
+              &ImageTest::copy,
+              &ImageTest::copyStrided,
+              &ImageTest::copyToData,
+              &ImageTest::copy3D,
+              &ImageTest::subImage,
+              &ImageTest::subImage1D});
 }
 
 void ImageTest::construct() {
@@ -253,6 +268,80 @@ void ImageTest::releaseCompressed() {
     CORRADE_COMPARE(a.size(), Vector2i());
 }
 
+void ImageTest::copy() {
+    const char data[]{'a', 'b', 'c', 'd',
+                      'e', 'f', 'g', 'h'};
+    Image2D a{PixelFormat::RGBA, PixelType::UnsignedByte, {4, 3}, Containers::Array<char>{Containers::ValueInit, 4*4*3}};
+
+    /* Whole rows, copied at once */
+    copyImage(ImageView2D{PixelFormat::RGBA, PixelType::UnsignedByte, {1, 2}, data}, {{}, {1, 2}}, a, {2, 1});
+    CORRADE_COMPARE((std::string{a.data() + 4*4 + 2*4, 4}), "abcd");
+    CORRADE_COMPARE((std::string{a.data() + 2*4*4 + 2*4, 4}), "efgh");
+    CORRADE_COMPARE(a.data()[4*4 + 1*4], '\0');
+    CORRADE_COMPARE(a.data()[4*4 + 3*4], '\0');
+}
+
+void ImageTest::copyStrided() {
+    /* Two rows of five pixels, aligned to eight bytes, skipping the first row
+       and the first pixel */
+    const char data[]{'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x',
+                      'x', 'a', 'b', 'c', 'd', 'x', 'x', 'x',
+                      'x', 'e', 'f', 'g', 'h', 'x', 'x', 'x'};
+    const ImageView2D view{PixelStorage{}.setAlignment(8).setSkip({1, 1, 0}),
+        PixelFormat::Red, PixelType::UnsignedByte, {5, 2}, data};
+
+    Image2D a{PixelStorage{}.setAlignment(1), PixelFormat::Red, PixelType::UnsignedByte, {3, 2}, Containers::Array<char>{Containers::ValueInit, 3*2}};
+    copyImage(view, {{1, 0}, {4, 2}}, a);
+    CORRADE_COMPARE((std::string{a.data(), 3*2}), "bcdfgh");
+}
+
+void ImageTest::copyToData() {
+    const char data[]{'a', 'b', 'c', 'd',
+                      'e', 'f', 'g', 'h'};
+    char out[]{'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x',
+               'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x'};
+
+    /* Destination rows padded to four bytes */
+    copyImage(ImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::Red, PixelType::UnsignedByte, {4, 2}, data}, {{1, 0}, {3, 2}},
+        PixelStorage{}, {3, 4}, out, {1, 2});
+    CORRADE_COMPARE((std::string{out, 16}), "xxxxxxxxxbcxxfgx");
+}
+
+void ImageTest::copy3D() {
+    const char data[]{'a', 'b',
+                      'c', 'd',
+
+                      'e', 'f',
+                      'g', 'h'};
+    Image3D a{PixelStorage{}.setAlignment(1), PixelFormat::Red, PixelType::UnsignedByte, {1, 2, 2}, Containers::Array<char>{Containers::ValueInit, 4}};
+
+    copyImage(ImageView3D{PixelStorage{}.setAlignment(1), PixelFormat::Red, PixelType::UnsignedByte, {2, 2, 2}, data}, {{1, 0, 0}, {2, 2, 2}}, a);
+    CORRADE_COMPARE((std::string{a.data(), 4}), "bdfh");
+}
+
+void ImageTest::subImage() {
+    const char data[]{'a', 'b', 'c', 'd',
+                      'e', 'f', 'g', 'h',
+                      'i', 'j', 'k', 'l'};
+    const Image2D a = Magnum::subImage(ImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::Red, PixelType::UnsignedByte, {4, 3}, data}, {{1, 1}, {3, 3}});
+
+    CORRADE_COMPARE(a.format(), PixelFormat::Red);
+    CORRADE_COMPARE(a.type(), PixelType::UnsignedByte);
+    CORRADE_COMPARE(a.size(), (Vector2i{2, 2}));
+    /* Default storage pads the rows to four bytes */
+    CORRADE_COMPARE(a.data().size(), 8);
+    CORRADE_COMPARE((std::string{a.data(), 2}), "fg");
+    CORRADE_COMPARE((std::string{a.data() + 4, 2}), "jk");
+}
+
+void ImageTest::subImage1D() {
+    const char data[]{'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h'};
+    const Image1D a = Magnum::subImage(ImageView1D{PixelFormat::RG, PixelType::UnsignedByte, 4, data}, {1, 3});
+
+    CORRADE_COMPARE(a.size(), (Math::Vector<1, Int>{2}));
+    CORRADE_COMPARE((std::string{a.data(), 4}), "cdef");
+}
+
 }}
 
 CORRADE_TEST_MAIN(Magnum::Test::ImageTest)
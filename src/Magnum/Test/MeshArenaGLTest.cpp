@@ -0,0 +1,155 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/MeshArena.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct MeshArenaGLTest: AbstractOpenGLTester {
+    explicit MeshArenaGLTest();
+
+    void construct();
+    void constructCopy();
+
+    void add();
+    void addFull();
+    void remove();
+};
+
+MeshArenaGLTest::MeshArenaGLTest() {
+    addTests({&MeshArenaGLTest::construct,
+              &MeshArenaGLTest::constructCopy,
+
+              &MeshArenaGLTest::add,
+              &MeshArenaGLTest::addFull,
+              &MeshArenaGLTest::remove});
+}
+
+void MeshArenaGLTest::construct() {
+    {
+        MeshArena arena{MeshPrimitive::Triangles, sizeof(Vector3), 64, 128};
+
+        MAGNUM_VERIFY_NO_ERROR();
+        CORRADE_VERIFY(arena.vertexBuffer().id() > 0);
+        CORRADE_VERIFY(arena.indexBuffer().id() > 0);
+        CORRADE_COMPARE(arena.vertexStride(), sizeof(Vector3));
+        CORRADE_COMPARE(arena.vertexAllocator().capacity(), 64);
+        CORRADE_COMPARE(arena.indexAllocator().capacity(), 128);
+        CORRADE_VERIFY(arena.mesh().isIndexed());
+
+        #ifndef MAGNUM_TARGET_GLES
+        CORRADE_COMPARE(arena.usesBaseVertex(), Context::current().isExtensionSupported<Extensions::GL::ARB::draw_elements_base_vertex>());
+        CORRADE_COMPARE(arena.vertexBuffer().size(), 64*sizeof(Vector3));
+        CORRADE_COMPARE(arena.indexBuffer().size(), 128*sizeof(UnsignedInt));
+        #else
+        CORRADE_VERIFY(!arena.usesBaseVertex());
+        #endif
+    }
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void MeshArenaGLTest::constructCopy() {
+    CORRADE_VERIFY(!(std::is_constructible<MeshArena, const MeshArena&>{}));
+    CORRADE_VERIFY(!(std::is_assignable<MeshArena, const MeshArena&>{}));
+}
+
+namespace {
+    const Vector3 Positions[]{{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}};
+    const UnsignedInt Indices[]{0, 1, 2};
+}
+
+void MeshArenaGLTest::add() {
+    MeshArena arena{MeshPrimitive::Triangles, sizeof(Vector3), 64, 128};
+
+    std::optional<MeshArena::Range> a = arena.add(Positions, Indices);
+    std::optional<MeshArena::Range> b = arena.add(Positions, Indices);
+    MAGNUM_VERIFY_NO_ERROR();
+
+    CORRADE_VERIFY(a);
+    CORRADE_VERIFY(b);
+    CORRADE_COMPARE(a->vertexOffset, 0);
+    CORRADE_COMPARE(b->vertexOffset, 3);
+    CORRADE_COMPARE(b->vertexCount, 3);
+    CORRADE_COMPARE(b->indexOffset, 3);
+    CORRADE_COMPARE(b->indexCount, 3);
+
+    MeshView view{arena.mesh()};
+    arena.setupView(view, *b);
+    CORRADE_COMPARE(view.count(), 3);
+    CORRADE_COMPARE(view.baseVertex(), arena.usesBaseVertex() ? 3 : 0);
+
+    /** @todo How to verify the contents in ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    Containers::Array<UnsignedInt> indices = arena.indexBuffer().subData<UnsignedInt>(3*sizeof(UnsignedInt), 3);
+    MAGNUM_VERIFY_NO_ERROR();
+    if(arena.usesBaseVertex()) {
+        CORRADE_COMPARE(indices[0], 0);
+        CORRADE_COMPARE(indices[2], 2);
+    } else {
+        CORRADE_COMPARE(indices[0], 3);
+        CORRADE_COMPARE(indices[2], 5);
+    }
+    #endif
+}
+
+void MeshArenaGLTest::addFull() {
+    MeshArena arena{MeshPrimitive::Triangles, sizeof(Vector3), 4, 128};
+
+    CORRADE_VERIFY(arena.add(Positions, Indices));
+    CORRADE_VERIFY(!arena.add(Positions, Indices));
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Failed allocation doesn't leak the index range */
+    CORRADE_COMPARE(arena.indexAllocator().usedCount(), 3);
+}
+
+void MeshArenaGLTest::remove() {
+    MeshArena arena{MeshPrimitive::Triangles, sizeof(Vector3), 6, 6};
+
+    std::optional<MeshArena::Range> a = arena.add(Positions, Indices);
+    std::optional<MeshArena::Range> b = arena.add(Positions, Indices);
+    CORRADE_VERIFY(a);
+    CORRADE_VERIFY(b);
+    CORRADE_VERIFY(!arena.add(Positions, Indices));
+
+    /* The freed space is reused */
+    arena.remove(*a);
+    std::optional<MeshArena::Range> c = arena.add(Positions, Indices);
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(c);
+    CORRADE_COMPARE(c->vertexOffset, 0);
+    CORRADE_COMPARE(c->indexOffset, 0);
+}
+
+}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Test::MeshArenaGLTest)
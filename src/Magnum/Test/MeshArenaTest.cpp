@@ -0,0 +1,143 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/MeshArena.h"
+
+namespace Magnum { namespace Test {
+
+struct MeshArenaTest: TestSuite::Tester {
+    explicit MeshArenaTest();
+
+    void construct();
+    void allocate();
+    void allocateBestFit();
+    void allocateFull();
+    void freeMerge();
+};
+
+MeshArenaTest::MeshArenaTest() {
+    addTests({&MeshArenaTest::construct,
+              &MeshArenaTest::allocate,
+              &MeshArenaTest::allocateBestFit,
+              &MeshArenaTest::allocateFull,
+              &MeshArenaTest::freeMerge});
+}
+
+namespace {
+    /* Makes failed allocations show up in the comparison */
+    UnsignedInt offset(const std::optional<UnsignedInt>& offset) {
+        return offset ? *offset : ~UnsignedInt{};
+    }
+}
+
+void MeshArenaTest::construct() {
+    RangeAllocator a{100};
+    CORRADE_COMPARE(a.capacity(), 100);
+    CORRADE_COMPARE(a.usedCount(), 0);
+    CORRADE_COMPARE(a.allocationCount(), 0);
+    CORRADE_COMPARE(a.freeRangeCount(), 1);
+    CORRADE_COMPARE(a.largestFreeRange(), 100);
+}
+
+void MeshArenaTest::allocate() {
+    RangeAllocator a{100};
+    CORRADE_COMPARE(offset(a.allocate(10)), 0);
+    CORRADE_COMPARE(offset(a.allocate(25)), 10);
+    CORRADE_COMPARE(offset(a.allocate(5)), 35);
+    CORRADE_COMPARE(a.usedCount(), 40);
+    CORRADE_COMPARE(a.allocationCount(), 3);
+    CORRADE_COMPARE(a.freeRangeCount(), 1);
+    CORRADE_COMPARE(a.largestFreeRange(), 60);
+}
+
+void MeshArenaTest::allocateBestFit() {
+    RangeAllocator a{100};
+    a.allocate(10);
+    a.allocate(30);
+    a.allocate(10);
+    a.allocate(8);
+    a.allocate(10);
+
+    /* Free ranges of size 30 at 10, 8 at 50 and 32 at 68 */
+    a.free(10);
+    a.free(50);
+    CORRADE_COMPARE(a.freeRangeCount(), 3);
+
+    /* The smallest range that fits is taken */
+    CORRADE_COMPARE(offset(a.allocate(6)), 50);
+    CORRADE_COMPARE(offset(a.allocate(31)), 68);
+    CORRADE_COMPARE(offset(a.allocate(30)), 10);
+    CORRADE_COMPARE(a.freeRangeCount(), 2);
+    CORRADE_COMPARE(a.largestFreeRange(), 2);
+}
+
+void MeshArenaTest::allocateFull() {
+    RangeAllocator a{16};
+    CORRADE_COMPARE(offset(a.allocate(16)), 0);
+    CORRADE_COMPARE(a.freeRangeCount(), 0);
+    CORRADE_COMPARE(a.largestFreeRange(), 0);
+    CORRADE_VERIFY(!a.allocate(1));
+
+    /* Fragmented free space doesn't fit a larger allocation */
+    RangeAllocator b{16};
+    b.allocate(4);
+    b.allocate(4);
+    b.allocate(4);
+    b.free(0);
+    CORRADE_COMPARE(b.usedCount(), 8);
+    CORRADE_VERIFY(!b.allocate(5));
+    CORRADE_COMPARE(offset(b.allocate(4)), 0);
+}
+
+void MeshArenaTest::freeMerge() {
+    RangeAllocator a{40};
+    a.allocate(10);
+    a.allocate(10);
+    a.allocate(10);
+    a.allocate(10);
+
+    a.free(0);
+    a.free(20);
+    CORRADE_COMPARE(a.freeRangeCount(), 2);
+    CORRADE_COMPARE(a.largestFreeRange(), 10);
+
+    /* Merges with both neighbors */
+    a.free(10);
+    CORRADE_COMPARE(a.freeRangeCount(), 1);
+    CORRADE_COMPARE(a.largestFreeRange(), 30);
+
+    /* Merges with the preceding range, the allocator is empty again */
+    a.free(30);
+    CORRADE_COMPARE(a.freeRangeCount(), 1);
+    CORRADE_COMPARE(a.largestFreeRange(), 40);
+    CORRADE_COMPARE(a.usedCount(), 0);
+    CORRADE_COMPARE(a.allocationCount(), 0);
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::MeshArenaTest)
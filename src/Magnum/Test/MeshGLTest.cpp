@@ -110,6 +110,8 @@ struct MeshGLTest: AbstractOpenGLTester {
     void setIndexBufferRange();
     void setIndexBufferUnsignedInt();
 
+    void shareVertexArray();
+
     #ifndef MAGNUM_TARGET_GLES
     void setBaseVertex();
     #endif
@@ -134,6 +136,9 @@ struct MeshGLTest: AbstractOpenGLTester {
     void multiDrawIndexed();
     #ifndef MAGNUM_TARGET_GLES
     void multiDrawBaseVertex();
+
+    void multiDrawIndirect();
+    void multiDrawIndirectIndexed();
     #endif
 };
 
@@ -202,6 +207,8 @@ MeshGLTest::MeshGLTest() {
               &MeshGLTest::setIndexBufferRange,
               &MeshGLTest::setIndexBufferUnsignedInt,
 
+              &MeshGLTest::shareVertexArray,
+
               #ifndef MAGNUM_TARGET_GLES
               &MeshGLTest::setBaseVertex,
               #endif
@@ -225,7 +232,10 @@ MeshGLTest::MeshGLTest() {
               &MeshGLTest::multiDraw,
               &MeshGLTest::multiDrawIndexed,
               #ifndef MAGNUM_TARGET_GLES
-              &MeshGLTest::multiDrawBaseVertex
+              &MeshGLTest::multiDrawBaseVertex,
+
+              &MeshGLTest::multiDrawIndirect,
+              &MeshGLTest::multiDrawIndirectIndexed
               #endif
               });
 }
@@ -1457,6 +1467,61 @@ void MeshGLTest::setIndexBufferUnsignedInt() {
 }
 
 #ifndef MAGNUM_TARGET_GLES
+void MeshGLTest::shareVertexArray() {
+    Buffer vertices;
+    vertices.setData(indexedVertexData, BufferUsage::StaticDraw);
+
+    constexpr UnsignedShort indexData[] = { 2, 1, 0 };
+    Buffer indices{Buffer::TargetHint::ElementArray};
+    indices.setData(indexData, BufferUsage::StaticDraw);
+
+    Mesh a;
+    a.addVertexBuffer(vertices, 1*4,  MultipleShader::Position(),
+                      MultipleShader::Normal(), MultipleShader::TextureCoordinates())
+        .setIndexBuffer(indices, 2, Mesh::IndexType::UnsignedShort)
+        .shareVertexArray();
+    Mesh b;
+    b.addVertexBuffer(vertices, 1*4,  MultipleShader::Position(),
+                      MultipleShader::Normal(), MultipleShader::TextureCoordinates())
+        .setIndexBuffer(indices, 2, Mesh::IndexType::UnsignedShort)
+        .shareVertexArray();
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(Context::current().isExtensionSupported<Extensions::GL::ARB::vertex_array_object>())
+    #elif defined(MAGNUM_TARGET_GLES2)
+    if(Context::current().isExtensionSupported<Extensions::GL::OES::vertex_array_object>())
+    #endif
+    {
+        CORRADE_VERIFY(a.isVertexArrayShared());
+        CORRADE_VERIFY(b.isVertexArrayShared());
+        CORRADE_COMPARE(a.id(), b.id());
+    }
+
+    {
+        /* Destroying one of the meshes shouldn't affect the other */
+        Mesh c;
+        c.addVertexBuffer(vertices, 1*4,  MultipleShader::Position(),
+                          MultipleShader::Normal(), MultipleShader::TextureCoordinates())
+            .setIndexBuffer(indices, 2, Mesh::IndexType::UnsignedShort)
+            .shareVertexArray();
+    }
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    const auto value = Checker(MultipleShader{},
+        #ifndef MAGNUM_TARGET_GLES2
+        RenderbufferFormat::RGBA8,
+        #else
+        RenderbufferFormat::RGBA4,
+        #endif
+        b).get<Color4ub>(PixelFormat::RGBA, PixelType::UnsignedByte);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(value, indexedResult);
+}
+
 void MeshGLTest::setBaseVertex() {
     if(!Context::current().isExtensionSupported<Extensions::GL::ARB::draw_elements_base_vertex>())
         CORRADE_SKIP(Extensions::GL::ARB::draw_elements_base_vertex::string() + std::string(" is not available."));
@@ -1829,7 +1894,7 @@ void MeshGLTest::addVertexBufferInstancedDouble() {
 
 namespace {
     struct MultiChecker {
-        MultiChecker(AbstractShaderProgram&& shader, Mesh& mesh);
+        MultiChecker(AbstractShaderProgram&& shader, Mesh& mesh, bool indirect = false);
 
         template<class T> T get(PixelFormat format, PixelType type);
 
@@ -1839,7 +1904,7 @@ namespace {
 }
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
-MultiChecker::MultiChecker(AbstractShaderProgram&& shader, Mesh& mesh): framebuffer({{}, Vector2i(1)}) {
+MultiChecker::MultiChecker(AbstractShaderProgram&& shader, Mesh& mesh, const bool indirect): framebuffer({{}, Vector2i(1)}) {
     renderbuffer.setStorage(
         #ifndef MAGNUM_TARGET_GLES2
         RenderbufferFormat::RGBA8,
@@ -1869,7 +1934,18 @@ MultiChecker::MultiChecker(AbstractShaderProgram&& shader, Mesh& mesh): framebuf
          .setIndexRange(1);
     } else c.setBaseVertex(1);
 
-    MeshView::draw(shader, {a, b, c});
+    #ifndef MAGNUM_TARGET_GLES
+    if(indirect) {
+        const std::reference_wrapper<MeshView> meshes[]{a, b, c};
+        Buffer indirectBuffer{Buffer::TargetHint::DrawIndirect};
+        MeshView::drawIndirect(shader, meshes, indirectBuffer);
+    } else
+    #else
+    static_cast<void>(indirect);
+    #endif
+    {
+        MeshView::draw(shader, {a, b, c});
+    }
 }
 
 template<class T> T MultiChecker::get(PixelFormat format, PixelType type) {
@@ -1952,6 +2028,56 @@ void MeshGLTest::multiDrawBaseVertex() {
     MAGNUM_VERIFY_NO_ERROR();
     CORRADE_COMPARE(value, indexedResult);
 }
+
+void MeshGLTest::multiDrawIndirect() {
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::draw_indirect>())
+        CORRADE_SKIP(Extensions::GL::ARB::draw_indirect::string() + std::string(" is not available."));
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::multi_draw_indirect>())
+        Debug() << Extensions::GL::ARB::multi_draw_indirect::string() << "not supported, using fallback implementation";
+
+    typedef Attribute<0, Float> Attribute;
+
+    const Float data[] = { 0.0f, -0.7f, Math::normalize<Float, UnsignedByte>(96) };
+    Buffer buffer;
+    buffer.setData(data, BufferUsage::StaticDraw);
+
+    Mesh mesh;
+    mesh.addVertexBuffer(buffer, 4, Attribute());
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    const auto value = MultiChecker(FloatShader("float", "vec4(valueInterpolated, 0.0, 0.0, 0.0)"),
+        mesh, true).get<UnsignedByte>(PixelFormat::RGBA, PixelType::UnsignedByte);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(value, 96);
+}
+
+void MeshGLTest::multiDrawIndirectIndexed() {
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::draw_indirect>())
+        CORRADE_SKIP(Extensions::GL::ARB::draw_indirect::string() + std::string(" is not available."));
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::multi_draw_indirect>())
+        Debug() << Extensions::GL::ARB::multi_draw_indirect::string() << "not supported, using fallback implementation";
+
+    Buffer vertices;
+    vertices.setData(indexedVertexData, BufferUsage::StaticDraw);
+
+    constexpr UnsignedShort indexData[] = { 2, 1, 0 };
+    Buffer indices{Buffer::TargetHint::ElementArray};
+    indices.setData(indexData, BufferUsage::StaticDraw);
+
+    Mesh mesh;
+    mesh.addVertexBuffer(vertices, 1*4,  MultipleShader::Position(),
+                         MultipleShader::Normal(), MultipleShader::TextureCoordinates())
+        .setIndexBuffer(indices, 2, Mesh::IndexType::UnsignedShort);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    const auto value = MultiChecker(MultipleShader{}, mesh, true).get<Color4ub>(PixelFormat::RGBA, PixelType::UnsignedByte);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(value, indexedResult);
+}
 #endif
 
 }}
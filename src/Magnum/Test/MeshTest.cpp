@@ -35,6 +35,7 @@ struct MeshTest: TestSuite::Tester {
     explicit MeshTest();
 
     void indexSize();
+    void primitiveRestartIndex();
 
     void debugPrimitive();
     void debugIndexType();
@@ -44,6 +45,7 @@ struct MeshTest: TestSuite::Tester {
 
 MeshTest::MeshTest() {
     addTests({&MeshTest::indexSize,
+              &MeshTest::primitiveRestartIndex,
 
               &MeshTest::debugPrimitive,
               &MeshTest::debugIndexType,
@@ -57,6 +59,12 @@ void MeshTest::indexSize() {
     CORRADE_COMPARE(Mesh::indexSize(Mesh::IndexType::UnsignedInt), 4);
 }
 
+void MeshTest::primitiveRestartIndex() {
+    CORRADE_COMPARE(Mesh::primitiveRestartIndex(Mesh::IndexType::UnsignedByte), 0xff);
+    CORRADE_COMPARE(Mesh::primitiveRestartIndex(Mesh::IndexType::UnsignedShort), 0xffff);
+    CORRADE_COMPARE(Mesh::primitiveRestartIndex(Mesh::IndexType::UnsignedInt), 0xffffffffu);
+}
+
 void MeshTest::debugPrimitive() {
     std::ostringstream o;
     Debug(&o) << MeshPrimitive::TriangleFan << MeshPrimitive(0xdead);
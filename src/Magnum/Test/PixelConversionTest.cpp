@@ -0,0 +1,315 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <cmath>
+#include <limits>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/PixelConversion.h"
+
+namespace Magnum { namespace Test {
+
+struct PixelConversionTest: TestSuite::Tester {
+    explicit PixelConversionTest();
+
+    void swapRedBlue();
+    void swapRedBlueInPlace();
+    void expandRgbToRgba();
+    void srgbToLinear();
+    void linearToSrgb();
+    void srgbRoundTrip();
+    void unormToFloat();
+    void floatToUnorm();
+    void premultiplyAlpha();
+
+    void imageSwapRedBlue();
+    void imageExpandRgbToRgba();
+    void imageSrgbToLinear();
+    void imageFloatToUnorm();
+    void imagePremultiplyAlpha();
+};
+
+PixelConversionTest::PixelConversionTest() {
+    addTests({&PixelConversionTest::swapRedBlue,
+              &PixelConversionTest::swapRedBlueInPlace,
+              &PixelConversionTest::expandRgbToRgba,
+              &PixelConversionTest::srgbToLinear,
+              &PixelConversionTest::linearToSrgb,
+              &PixelConversionTest::srgbRoundTrip,
+              &PixelConversionTest::unormToFloat,
+              &PixelConversionTest::floatToUnorm,
+              &PixelConversionTest::premultiplyAlpha,
+
+              &PixelConversionTest::imageSwapRedBlue,
+              &PixelConversionTest::imageExpandRgbToRgba,
+              &PixelConversionTest::imageSrgbToLinear,
+              &PixelConversionTest::imageFloatToUnorm,
+              &PixelConversionTest::imagePremultiplyAlpha});
+}
+
+/* Pixel counts in the kernel tests are chosen to exercise both the vectorized
+   and the remainder code paths */
+
+void PixelConversionTest::swapRedBlue() {
+    UnsignedByte rgb[19*3], rgba[19*4], outRgb[19*3], outRgba[19*4];
+    for(std::size_t i = 0; i != 19*3; ++i) rgb[i] = UnsignedByte(i);
+    for(std::size_t i = 0; i != 19*4; ++i) rgba[i] = UnsignedByte(i);
+
+    PixelConversion::swapRedBlue(rgb, outRgb, 19, 3);
+    PixelConversion::swapRedBlue(rgba, outRgba, 19, 4);
+
+    for(std::size_t i = 0; i != 19; ++i) {
+        CORRADE_COMPARE(outRgb[i*3 + 0], rgb[i*3 + 2]);
+        CORRADE_COMPARE(outRgb[i*3 + 1], rgb[i*3 + 1]);
+        CORRADE_COMPARE(outRgb[i*3 + 2], rgb[i*3 + 0]);
+
+        CORRADE_COMPARE(outRgba[i*4 + 0], rgba[i*4 + 2]);
+        CORRADE_COMPARE(outRgba[i*4 + 1], rgba[i*4 + 1]);
+        CORRADE_COMPARE(outRgba[i*4 + 2], rgba[i*4 + 0]);
+        CORRADE_COMPARE(outRgba[i*4 + 3], rgba[i*4 + 3]);
+    }
+}
+
+void PixelConversionTest::swapRedBlueInPlace() {
+    UnsignedByte rgba[19*4];
+    for(std::size_t i = 0; i != 19*4; ++i) rgba[i] = UnsignedByte(i);
+
+    PixelConversion::swapRedBlue(rgba, rgba, 19, 4);
+    PixelConversion::swapRedBlue(rgba, rgba, 19, 4);
+
+    for(std::size_t i = 0; i != 19*4; ++i)
+        CORRADE_COMPARE(rgba[i], UnsignedByte(i));
+}
+
+void PixelConversionTest::expandRgbToRgba() {
+    UnsignedByte rgb[19*3], rgba[19*4];
+    for(std::size_t i = 0; i != 19*3; ++i) rgb[i] = UnsignedByte(i);
+
+    PixelConversion::expandRgbToRgba(rgb, rgba, 19, 0x7f);
+
+    for(std::size_t i = 0; i != 19; ++i) {
+        CORRADE_COMPARE(rgba[i*4 + 0], rgb[i*3 + 0]);
+        CORRADE_COMPARE(rgba[i*4 + 1], rgb[i*3 + 1]);
+        CORRADE_COMPARE(rgba[i*4 + 2], rgb[i*3 + 2]);
+        CORRADE_COMPARE(rgba[i*4 + 3], 0x7f);
+    }
+}
+
+void PixelConversionTest::srgbToLinear() {
+    const UnsignedByte in[]{0, 10, 128, 255, 200, 10, 20, 128};
+    Float out[8];
+
+    PixelConversion::srgbToLinear(in, out, 4);
+    CORRADE_COMPARE(out[0], 0.0f);
+    CORRADE_COMPARE(out[1], 0.0030352698f);
+    CORRADE_COMPARE(out[2], 0.21586050f);
+    CORRADE_COMPARE(out[3], 1.0f);
+
+    /* Alpha is only normalized */
+    PixelConversion::srgbToLinearAlpha(in, out, 2);
+    CORRADE_COMPARE(out[2], 0.21586050f);
+    CORRADE_COMPARE(out[3], 1.0f);
+    CORRADE_COMPARE(out[7], 128.0f/255.0f);
+}
+
+void PixelConversionTest::linearToSrgb() {
+    const Float in[]{0.0f, 0.0030352698f, 0.21586050f, 1.0f,
+        -1.0f, 2.0f, std::numeric_limits<Float>::quiet_NaN(), 0.5f};
+    UnsignedByte out[8];
+
+    PixelConversion::linearToSrgb(in, out, 8);
+    CORRADE_COMPARE(out[0], 0);
+    CORRADE_COMPARE(out[1], 10);
+    CORRADE_COMPARE(out[2], 128);
+    CORRADE_COMPARE(out[3], 255);
+
+    /* Clamped */
+    CORRADE_COMPARE(out[4], 0);
+    CORRADE_COMPARE(out[5], 255);
+    CORRADE_COMPARE(out[6], 0);
+
+    /* Alpha is only converted to unsigned byte range */
+    PixelConversion::linearToSrgbAlpha(in, out, 2);
+    CORRADE_COMPARE(out[3], 255);
+    CORRADE_COMPARE(out[7], 128);
+}
+
+void PixelConversionTest::srgbRoundTrip() {
+    UnsignedByte in[256], out[256];
+    Float linear[256];
+    for(std::size_t i = 0; i != 256; ++i) in[i] = UnsignedByte(i);
+
+    PixelConversion::srgbToLinear(in, linear, 256);
+    PixelConversion::linearToSrgb(linear, out, 256);
+
+    for(std::size_t i = 0; i != 256; ++i)
+        CORRADE_COMPARE(out[i], in[i]);
+}
+
+void PixelConversionTest::unormToFloat() {
+    UnsignedByte in[19];
+    for(std::size_t i = 0; i != 19; ++i) in[i] = UnsignedByte(i*13);
+    Float out[19];
+
+    PixelConversion::unormToFloat(in, out, 19);
+    for(std::size_t i = 0; i != 19; ++i)
+        CORRADE_COMPARE(out[i], in[i]/255.0f);
+
+    const UnsignedShort in16[]{0, 32768, 65535};
+    PixelConversion::unormToFloat(in16, out, 3);
+    CORRADE_COMPARE(out[0], 0.0f);
+    CORRADE_COMPARE(out[1], 32768.0f/65535.0f);
+    CORRADE_COMPARE(out[2], 1.0f);
+}
+
+void PixelConversionTest::floatToUnorm() {
+    Float in[19];
+    for(std::size_t i = 0; i != 19; ++i) in[i] = i/18.0f;
+    in[1] = -1.0f;
+    in[2] = 2.0f;
+    in[17] = std::numeric_limits<Float>::quiet_NaN();
+    UnsignedByte out[19];
+
+    PixelConversion::floatToUnorm(in, out, 19);
+    CORRADE_COMPARE(out[0], 0);
+    CORRADE_COMPARE(out[1], 0);
+    CORRADE_COMPARE(out[2], 255);
+    CORRADE_COMPARE(out[3], 43);
+    CORRADE_COMPARE(out[9], 128);
+    CORRADE_COMPARE(out[17], 0);
+    CORRADE_COMPARE(out[18], 255);
+
+    UnsignedShort out16[3];
+    PixelConversion::floatToUnorm(in + 8, out16, 3);
+    CORRADE_COMPARE(out16[0], 29127);
+    CORRADE_COMPARE(out16[1], 32768);
+    CORRADE_COMPARE(out16[2], 36408);
+}
+
+void PixelConversionTest::premultiplyAlpha() {
+    UnsignedByte in[7*4], out[7*4];
+    for(std::size_t i = 0; i != 7*4; ++i) in[i] = UnsignedByte(i*37);
+
+    PixelConversion::premultiplyAlpha(in, out, 7);
+    for(std::size_t i = 0; i != 7; ++i) {
+        for(std::size_t j = 0; j != 3; ++j)
+            CORRADE_COMPARE(out[i*4 + j], UnsignedByte(std::round(in[i*4 + j]*in[i*4 + 3]/255.0)));
+        CORRADE_COMPARE(out[i*4 + 3], in[i*4 + 3]);
+    }
+
+    const Float inFloat[]{1.0f, 0.5f, 0.25f, 0.5f};
+    Float outFloat[4];
+    PixelConversion::premultiplyAlpha(inFloat, outFloat, 1);
+    CORRADE_COMPARE(outFloat[0], 0.5f);
+    CORRADE_COMPARE(outFloat[1], 0.25f);
+    CORRADE_COMPARE(outFloat[2], 0.125f);
+    CORRADE_COMPARE(outFloat[3], 0.5f);
+}
+
+void PixelConversionTest::imageSwapRedBlue() {
+    /* Skipping one row, rows padded to four bytes */
+    const char data[]{
+        0, 0, 0, 0, 0, 0, 0, 0,
+        1, 2, 3, 4, 5, 6, 0, 0,
+        7, 8, 9, 10, 11, 12, 0, 0};
+    const ImageView2D image{PixelStorage{}.setSkip({0, 1, 0}), PixelFormat::RGB, PixelType::UnsignedByte, {2, 2}, data};
+
+    const Image2D out = PixelConversion::swapRedBlue(image);
+    CORRADE_COMPARE(out.format(), PixelFormat::RGB);
+    CORRADE_COMPARE(out.type(), PixelType::UnsignedByte);
+    CORRADE_COMPARE(out.size(), (Vector2i{2, 2}));
+    CORRADE_COMPARE(out.storage().alignment(), 4);
+    CORRADE_COMPARE_AS(out.data(),
+        (Containers::ArrayView<const char>{"\x03\x02\x01\x06\x05\x04\x00\x00"
+                                           "\x09\x08\x07\x0c\x0b\x0a\x00\x00", 16}),
+        TestSuite::Compare::Container);
+}
+
+void PixelConversionTest::imageExpandRgbToRgba() {
+    /* Rows padded to four bytes */
+    const char data[]{1, 2, 3, 0, 4, 5, 6, 0, 7, 8, 9, 0};
+    const ImageView2D image{PixelFormat::RGB, PixelType::UnsignedByte, {1, 3}, data};
+
+    const Image2D out = PixelConversion::expandRgbToRgba(image);
+    CORRADE_COMPARE(out.format(), PixelFormat::RGBA);
+    CORRADE_COMPARE(out.type(), PixelType::UnsignedByte);
+    CORRADE_COMPARE(out.size(), (Vector2i{1, 3}));
+    CORRADE_COMPARE_AS(out.data(),
+        (Containers::ArrayView<const char>{"\x01\x02\x03\xff\x04\x05\x06\xff\x07\x08\x09\xff", 12}),
+        TestSuite::Compare::Container);
+}
+
+void PixelConversionTest::imageSrgbToLinear() {
+    const char data[]{0, char(128), char(255), 0};
+    const ImageView2D image{PixelFormat::RGBA, PixelType::UnsignedByte, {1, 1}, data};
+
+    const Image2D out = PixelConversion::srgbToLinear(image);
+    CORRADE_COMPARE(out.format(), PixelFormat::RGBA);
+    CORRADE_COMPARE(out.type(), PixelType::Float);
+    CORRADE_COMPARE(out.data<Float>()[0], 0.0f);
+    CORRADE_COMPARE(out.data<Float>()[1], 0.21586050f);
+    CORRADE_COMPARE(out.data<Float>()[2], 1.0f);
+    CORRADE_COMPARE(out.data<Float>()[3], 0.0f);
+
+    const Image2D back = PixelConversion::linearToSrgb(out);
+    CORRADE_COMPARE(back.type(), PixelType::UnsignedByte);
+    CORRADE_COMPARE_AS(back.data(),
+        (Containers::ArrayView<const char>{data, 4}),
+        TestSuite::Compare::Container);
+}
+
+void PixelConversionTest::imageFloatToUnorm() {
+    const Float data[]{0.0f, 0.5f, 1.0f, 0.0f};
+    const ImageView2D image{PixelFormat::RGB, PixelType::Float, {1, 1}, data};
+
+    const Image2D out = PixelConversion::floatToUnorm(image, PixelType::UnsignedShort);
+    CORRADE_COMPARE(out.format(), PixelFormat::RGB);
+    CORRADE_COMPARE(out.type(), PixelType::UnsignedShort);
+    CORRADE_COMPARE(out.data<UnsignedShort>()[0], 0);
+    CORRADE_COMPARE(out.data<UnsignedShort>()[1], 32768);
+    CORRADE_COMPARE(out.data<UnsignedShort>()[2], 65535);
+
+    const Image2D back = PixelConversion::unormToFloat(out);
+    CORRADE_COMPARE(back.type(), PixelType::Float);
+    CORRADE_COMPARE(back.data<Float>()[0], 0.0f);
+    CORRADE_COMPARE(back.data<Float>()[1], 32768.0f/65535.0f);
+    CORRADE_COMPARE(back.data<Float>()[2], 1.0f);
+}
+
+void PixelConversionTest::imagePremultiplyAlpha() {
+    const Float data[]{1.0f, 0.5f, 0.25f, 0.5f};
+    const ImageView2D image{PixelFormat::RGBA, PixelType::Float, {1, 1}, data};
+
+    const Image2D out = PixelConversion::premultiplyAlpha(image);
+    CORRADE_COMPARE(out.format(), PixelFormat::RGBA);
+    CORRADE_COMPARE(out.type(), PixelType::Float);
+    CORRADE_COMPARE(out.data<Float>()[0], 0.5f);
+    CORRADE_COMPARE(out.data<Float>()[1], 0.25f);
+    CORRADE_COMPARE(out.data<Float>()[2], 0.125f);
+    CORRADE_COMPARE(out.data<Float>()[3], 0.5f);
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::PixelConversionTest)
@@ -0,0 +1,65 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/PluginPreloader.h"
+#include "Magnum/Trade/AbstractImporter.h"
+
+namespace Magnum { namespace Test {
+
+struct PluginPreloaderTest: TestSuite::Tester {
+    explicit PluginPreloaderTest();
+
+    void empty();
+    void notFound();
+};
+
+PluginPreloaderTest::PluginPreloaderTest() {
+    addTests({&PluginPreloaderTest::empty,
+              &PluginPreloaderTest::notFound});
+}
+
+void PluginPreloaderTest::empty() {
+    PluginManager::Manager<Trade::AbstractImporter> manager{"nonexistent"};
+    PluginPreloader<Trade::AbstractImporter> preloader{manager, {}};
+    CORRADE_VERIFY(preloader.wait().empty());
+    CORRADE_VERIFY(preloader.isFinished());
+
+    /* Waiting again is a no-op */
+    CORRADE_VERIFY(preloader.wait().empty());
+}
+
+void PluginPreloaderTest::notFound() {
+    PluginManager::Manager<Trade::AbstractImporter> manager{"nonexistent"};
+    PluginPreloader<Trade::AbstractImporter> preloader{manager, {"NonexistentImporter", "NonexistentFont"}};
+    CORRADE_COMPARE_AS(preloader.wait(), (std::vector<std::string>{"NonexistentImporter", "NonexistentFont"}), TestSuite::Compare::Container);
+    CORRADE_VERIFY(preloader.isFinished());
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::PluginPreloaderTest)
@@ -0,0 +1,398 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/PointCloudStreamer.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/AbstractMeshConverter.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/PointCloudOctree.h"
+#include "Magnum/Trade/PointCloudOctreeBuilder.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Test {
+
+struct PointCloudStreamerGLTest: AbstractOpenGLTester {
+    explicit PointCloudStreamerGLTest();
+
+    void construct();
+    void constructCopy();
+
+    void nodeErrorPerspective();
+    void nodeErrorOrthographic();
+
+    void updateFar();
+    void updateNear();
+    void updateCulled();
+    void updatePointBudget();
+    void updateUploadLimit();
+    void updateEviction();
+    void updateFailed();
+
+    private:
+        std::optional<Trade::PointCloudOctree> _octree;
+};
+
+namespace {
+    /* Both just pass the interleaved vertex data through */
+    class RawMeshConverter: public Trade::AbstractMeshConverter {
+        private:
+            Features doFeatures() const override { return Feature::ConvertData; }
+
+            Containers::Array<char> doExportToData(const Trade::MeshData& mesh) override {
+                Containers::Array<char> data{mesh.vertexData().size()};
+                std::memcpy(data, mesh.vertexData(), data.size());
+                return data;
+            }
+    };
+
+    class RawMeshImporter: public Trade::AbstractImporter {
+        public:
+            /* If set, every second opened data are rejected */
+            bool failEveryOther{};
+
+        private:
+            Features doFeatures() const override { return Feature::OpenData; }
+            bool doIsOpened() const override { return _opened; }
+            void doClose() override { _opened = false; }
+
+            void doOpenData(Containers::ArrayView<const char> data) override {
+                if(failEveryOther && (_openCount++ % 2)) return;
+                _data = data;
+                _opened = true;
+            }
+
+            UnsignedInt doMesh3DCount() const override { return 1; }
+
+            std::optional<Trade::MeshData> doMesh(UnsignedInt) override {
+                const UnsignedInt stride = sizeof(Trade::PointCloudOctreeVertex);
+                return Trade::MeshData{MeshPrimitive::Points, _data, {
+                    Trade::MeshAttributeData{Trade::MeshAttribute::Position, Trade::MeshAttributeType::Float, 3, 0, stride},
+                    Trade::MeshAttributeData{Trade::MeshAttribute::Color, Trade::MeshAttributeType::UnsignedByte, 4, 12, stride, true}
+                }, UnsignedInt(_data.size()/stride)};
+            }
+
+            Containers::ArrayView<const char> _data;
+            UnsignedInt _openCount{};
+            bool _opened{};
+    };
+
+    constexpr UnsignedInt PointCount = 64*64*4;
+
+    const Matrix4 Projection = Matrix4::perspectiveProjection(Deg(60.0f), 1.0f, 0.01f, 1000.0f);
+    const Vector2i Viewport{512, 512};
+}
+
+PointCloudStreamerGLTest::PointCloudStreamerGLTest() {
+    addTests({&PointCloudStreamerGLTest::construct,
+              &PointCloudStreamerGLTest::constructCopy,
+
+              &PointCloudStreamerGLTest::nodeErrorPerspective,
+              &PointCloudStreamerGLTest::nodeErrorOrthographic,
+
+              &PointCloudStreamerGLTest::updateFar,
+              &PointCloudStreamerGLTest::updateNear,
+              &PointCloudStreamerGLTest::updateCulled,
+              &PointCloudStreamerGLTest::updatePointBudget,
+              &PointCloudStreamerGLTest::updateUploadLimit,
+              &PointCloudStreamerGLTest::updateEviction,
+              &PointCloudStreamerGLTest::updateFailed});
+
+    /* Four stacked layers of a regular grid in a unit cube */
+    std::vector<Vector3> positions;
+    std::vector<Color4ub> colors;
+    for(Int z = 0; z != 4; ++z) for(Int y = 0; y != 64; ++y) for(Int x = 0; x != 64; ++x) {
+        positions.emplace_back((x + 0.5f)/64.0f, (y + 0.5f)/64.0f, (z + 0.5f)/4.0f);
+        colors.emplace_back(x*4, y*4, z*64, 255);
+    }
+
+    Utility::Directory::mkpath(POINTCLOUDSTREAMERGLTEST_OUTPUT_DIR);
+    const std::string filename = Utility::Directory::join(POINTCLOUDSTREAMERGLTEST_OUTPUT_DIR, "cloud.mgoctree");
+
+    RawMeshConverter converter;
+    Trade::PointCloudOctreeBuilder builder{converter, filename, {{}, Vector3{1.0f}}, 256, 1};
+    if(builder.addPoints({positions.data(), positions.size()}, {colors.data(), colors.size()}) && builder.finish())
+        _octree = Trade::PointCloudOctree::open(filename);
+}
+
+void PointCloudStreamerGLTest::construct() {
+    CORRADE_VERIFY(_octree);
+    CORRADE_VERIFY(_octree->levelCount() > 2);
+    CORRADE_COMPARE(_octree->pointCount(), PointCount);
+
+    RawMeshImporter importer;
+    {
+        PointCloudStreamer streamer{*_octree, importer, 4096};
+
+        MAGNUM_VERIFY_NO_ERROR();
+        CORRADE_VERIFY(streamer.vertexBuffer().id() > 0);
+        CORRADE_COMPARE(&streamer.octree(), &*_octree);
+        CORRADE_COMPARE(streamer.allocator().capacity(), 4096);
+        CORRADE_COMPARE(streamer.mesh().primitive(), MeshPrimitive::Points);
+        CORRADE_COMPARE(streamer.pointBudget(), 1000000);
+        CORRADE_COMPARE(streamer.errorThreshold(), 1.0f);
+        CORRADE_COMPARE(streamer.uploadLimit(), 4*1024*1024);
+        CORRADE_COMPARE(streamer.residentNodeCount(), 0);
+        CORRADE_COMPARE(streamer.drawnNodeCount(), 0);
+        CORRADE_VERIFY(!streamer.isResident(0));
+
+        #ifndef MAGNUM_TARGET_GLES
+        CORRADE_COMPARE(streamer.vertexBuffer().size(), 4096*sizeof(Trade::PointCloudOctreeVertex));
+        #endif
+    }
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void PointCloudStreamerGLTest::constructCopy() {
+    CORRADE_VERIFY(!(std::is_constructible<PointCloudStreamer, const PointCloudStreamer&>{}));
+    CORRADE_VERIFY(!(std::is_constructible<PointCloudStreamer, PointCloudStreamer&&>{}));
+    CORRADE_VERIFY(!(std::is_assignable<PointCloudStreamer, const PointCloudStreamer&>{}));
+    CORRADE_VERIFY(!(std::is_assignable<PointCloudStreamer, PointCloudStreamer&&>{}));
+}
+
+void PointCloudStreamerGLTest::nodeErrorPerspective() {
+    CORRADE_VERIFY(_octree);
+
+    RawMeshImporter importer;
+    PointCloudStreamer streamer{*_octree, importer, 16};
+
+    /* Root spans the unit cube, nearest point of the bounding sphere is at
+       distance 10 */
+    const Float radius = Math::sqrt(3.0f)*0.5f;
+    const Float spacing = _octree->nodeSpacing(0)*Projection[1][1]*Viewport.y()*0.5f;
+    CORRADE_COMPARE(streamer.nodeError(0, {0.5f, 0.5f, 10.5f + radius}, Projection, Viewport), spacing/10.0f);
+
+    /* Inside of the node */
+    CORRADE_COMPARE(streamer.nodeError(0, {0.5f, 0.5f, 0.5f}, Projection, Viewport), Constants::inf());
+
+    /* Finer levels have larger error */
+    const UnsignedInt child = _octree->node(0).firstChild;
+    CORRADE_VERIFY(streamer.nodeError(child, {0.5f, 0.5f, 100.0f}, Projection, Viewport) < streamer.nodeError(0, {0.5f, 0.5f, 100.0f}, Projection, Viewport));
+}
+
+void PointCloudStreamerGLTest::nodeErrorOrthographic() {
+    CORRADE_VERIFY(_octree);
+
+    RawMeshImporter importer;
+    PointCloudStreamer streamer{*_octree, importer, 16};
+
+    const Matrix4 projection = Matrix4::orthographicProjection({2.0f, 2.0f}, 0.0f, 100.0f);
+    const Float error = _octree->nodeSpacing(0)*Viewport.y()*0.5f;
+    CORRADE_COMPARE(streamer.nodeError(0, {0.5f, 0.5f, 10.0f}, projection, Viewport), error);
+    CORRADE_COMPARE(streamer.nodeError(0, {0.5f, 0.5f, 50.0f}, projection, Viewport), error);
+}
+
+void PointCloudStreamerGLTest::updateFar() {
+    CORRADE_VERIFY(_octree);
+
+    RawMeshImporter importer;
+    PointCloudStreamer streamer{*_octree, importer, PointCount};
+
+    /* So far away that the root is enough */
+    streamer.update(Matrix4::translation({-0.5f, -0.5f, -1000.0f}), Projection, Viewport);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(streamer.selectedNodeCount(), 1);
+    CORRADE_COMPARE(streamer.drawnNodeCount(), 1);
+    CORRADE_COMPARE(streamer.drawnPointCount(), _octree->node(0).pointCount);
+    CORRADE_COMPARE(streamer.residentNodeCount(), 1);
+    CORRADE_COMPARE(streamer.residentPointCount(), _octree->node(0).pointCount);
+    CORRADE_COMPARE(streamer.uploadCount(), 1);
+    CORRADE_COMPARE(streamer.evictionCount(), 0);
+    CORRADE_VERIFY(streamer.isResident(0));
+
+    /* Next update doesn't upload anything */
+    streamer.update(Matrix4::translation({-0.5f, -0.5f, -1000.0f}), Projection, Viewport);
+    CORRADE_COMPARE(streamer.drawnNodeCount(), 1);
+    CORRADE_COMPARE(streamer.uploadCount(), 0);
+
+    #ifndef MAGNUM_TARGET_GLES
+    /* The root data are at the beginning of the buffer */
+    const std::optional<Containers::Array<char>> data = _octree->nodeData(0);
+    CORRADE_VERIFY(data);
+    Containers::Array<char> uploaded = streamer.vertexBuffer().subData(0, data->size());
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(std::memcmp(uploaded, *data, data->size()) == 0);
+    #endif
+}
+
+void PointCloudStreamerGLTest::updateNear() {
+    CORRADE_VERIFY(_octree);
+
+    RawMeshImporter importer;
+    PointCloudStreamer streamer{*_octree, importer, PointCount};
+    streamer.setErrorThreshold(0.0f);
+
+    /* With zero threshold and the whole cloud in view everything gets drawn
+       in the end, each update gets one level further */
+    const Matrix4 transformation = Matrix4::translation({-0.5f, -0.5f, -3.0f});
+    for(UnsignedInt i = 0; i != _octree->levelCount(); ++i)
+        streamer.update(transformation, Projection, Viewport);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(streamer.drawnPointCount(), PointCount);
+    CORRADE_COMPARE(streamer.residentPointCount(), PointCount);
+    CORRADE_COMPARE(streamer.residentNodeCount(), _octree->nodeCount());
+    CORRADE_COMPARE(streamer.selectedNodeCount(), _octree->nodeCount());
+    CORRADE_COMPARE(streamer.evictionCount(), 0);
+
+    /* Nothing more to do */
+    streamer.update(transformation, Projection, Viewport);
+    CORRADE_COMPARE(streamer.uploadCount(), 0);
+    CORRADE_COMPARE(streamer.drawnPointCount(), PointCount);
+}
+
+void PointCloudStreamerGLTest::updateCulled() {
+    CORRADE_VERIFY(_octree);
+
+    RawMeshImporter importer;
+    PointCloudStreamer streamer{*_octree, importer, PointCount};
+
+    /* Looking away from the cloud */
+    streamer.update(Matrix4::translation({-0.5f, -0.5f, 3.0f}), Projection, Viewport);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(streamer.selectedNodeCount(), 0);
+    CORRADE_COMPARE(streamer.drawnNodeCount(), 0);
+    CORRADE_COMPARE(streamer.uploadCount(), 0);
+    CORRADE_COMPARE(streamer.residentNodeCount(), 0);
+}
+
+void PointCloudStreamerGLTest::updatePointBudget() {
+    CORRADE_VERIFY(_octree);
+
+    RawMeshImporter importer;
+    PointCloudStreamer streamer{*_octree, importer, PointCount};
+    streamer.setErrorThreshold(0.0f)
+        .setPointBudget(PointCount/2);
+
+    const Matrix4 transformation = Matrix4::translation({-0.5f, -0.5f, -3.0f});
+    for(UnsignedInt i = 0; i != _octree->levelCount(); ++i)
+        streamer.update(transformation, Projection, Viewport);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(streamer.drawnPointCount() > _octree->node(0).pointCount);
+    CORRADE_VERIFY(streamer.drawnPointCount() <= PointCount/2);
+    CORRADE_VERIFY(streamer.drawnNodeCount() < _octree->nodeCount());
+
+    /* The root is always drawn */
+    CORRADE_VERIFY(streamer.isResident(0));
+}
+
+void PointCloudStreamerGLTest::updateUploadLimit() {
+    CORRADE_VERIFY(_octree);
+
+    RawMeshImporter importer;
+    PointCloudStreamer streamer{*_octree, importer, PointCount};
+    streamer.setErrorThreshold(0.0f)
+        .setUploadLimit(0);
+
+    /* Only one node per update */
+    const Matrix4 transformation = Matrix4::translation({-0.5f, -0.5f, -3.0f});
+    for(UnsignedInt i = 0; i != _octree->nodeCount(); ++i) {
+        streamer.update(transformation, Projection, Viewport);
+        CORRADE_COMPARE(streamer.uploadCount(), 1);
+        CORRADE_COMPARE(streamer.residentNodeCount(), i + 1);
+    }
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(streamer.drawnPointCount(), PointCount);
+
+    streamer.update(transformation, Projection, Viewport);
+    CORRADE_COMPARE(streamer.uploadCount(), 0);
+}
+
+void PointCloudStreamerGLTest::updateEviction() {
+    CORRADE_VERIFY(_octree);
+
+    RawMeshImporter importer;
+    PointCloudStreamer streamer{*_octree, importer, PointCount/2};
+    streamer.setErrorThreshold(0.0f);
+
+    /* Refine one corner of the cloud as much as fits */
+    const Matrix4 left = Matrix4::lookAt({0.0f, 0.5f, -0.05f}, {0.0f, 0.5f, 1.0f}, Vector3::yAxis()).invertedRigid();
+    for(UnsignedInt i = 0; i != _octree->levelCount(); ++i)
+        streamer.update(left, Projection, Viewport);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    const UnsignedInt drawnLeft = streamer.drawnPointCount();
+    CORRADE_VERIFY(drawnLeft > _octree->node(0).pointCount);
+    CORRADE_VERIFY(streamer.residentPointCount() <= PointCount/2);
+
+    /* Looking at the other corner has to evict the nodes of the first */
+    const Matrix4 right = Matrix4::lookAt({1.0f, 0.5f, -0.05f}, {1.0f, 0.5f, 1.0f}, Vector3::yAxis()).invertedRigid();
+    UnsignedInt evictionCount = 0;
+    for(UnsignedInt i = 0; i != _octree->levelCount(); ++i) {
+        streamer.update(right, Projection, Viewport);
+        evictionCount += streamer.evictionCount();
+    }
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(evictionCount > 0);
+    CORRADE_VERIFY(streamer.drawnPointCount() > _octree->node(0).pointCount);
+    CORRADE_VERIFY(streamer.residentPointCount() <= PointCount/2);
+    CORRADE_VERIFY(streamer.isResident(0));
+}
+
+void PointCloudStreamerGLTest::updateFailed() {
+    CORRADE_VERIFY(_octree);
+
+    RawMeshImporter importer;
+    importer.failEveryOther = true;
+    PointCloudStreamer streamer{*_octree, importer, PointCount};
+    streamer.setErrorThreshold(0.0f);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const Matrix4 transformation = Matrix4::translation({-0.5f, -0.5f, -3.0f});
+    for(UnsignedInt i = 0; i != _octree->levelCount(); ++i)
+        streamer.update(transformation, Projection, Viewport);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(streamer.isResident(0));
+    CORRADE_VERIFY(streamer.drawnPointCount() < PointCount);
+
+    /* Failed nodes are not tried again */
+    UnsignedInt failedCount = 0;
+    for(UnsignedInt i = 0; i != _octree->nodeCount(); ++i)
+        if(streamer.isFailed(i)) ++failedCount;
+    CORRADE_VERIFY(failedCount > 0);
+    streamer.update(transformation, Projection, Viewport);
+    CORRADE_COMPARE(streamer.uploadCount(), 0);
+    CORRADE_VERIFY(out.str().find("PointCloudStreamer::update(): can't open data of node") != std::string::npos);
+}
+
+}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Test::PointCloudStreamerGLTest)
@@ -0,0 +1,233 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <vector>
+
+#include "Magnum/QueryPool.h"
+#include "Magnum/Renderer.h"
+#include "Magnum/SampleQuery.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct QueryPoolGLTest: AbstractOpenGLTester {
+    explicit QueryPoolGLTest();
+
+    void constructNoCreate();
+    void enableNoCreate();
+
+    void collect();
+    void collectLatency();
+    void recycle();
+    void disabled();
+
+    void beginActive();
+    void endNotActive();
+};
+
+namespace {
+    #ifndef MAGNUM_TARGET_GLES
+    constexpr SampleQuery::Target Target = SampleQuery::Target::SamplesPassed;
+    #else
+    constexpr SampleQuery::Target Target = SampleQuery::Target::AnySamplesPassed;
+    #endif
+}
+
+QueryPoolGLTest::QueryPoolGLTest() {
+    addTests({&QueryPoolGLTest::constructNoCreate,
+              &QueryPoolGLTest::enableNoCreate,
+
+              &QueryPoolGLTest::collect,
+              &QueryPoolGLTest::collectLatency,
+              &QueryPoolGLTest::recycle,
+              &QueryPoolGLTest::disabled,
+
+              &QueryPoolGLTest::beginActive,
+              &QueryPoolGLTest::endNotActive});
+}
+
+void QueryPoolGLTest::constructNoCreate() {
+    {
+        QueryPool<SampleQuery> pool{NoCreate};
+        CORRADE_VERIFY(!pool.isEnabled());
+
+        /* Everything is a no-op */
+        pool.begin();
+        pool.end();
+        std::size_t count = 0;
+        pool.collect([&count](const QueryPool<SampleQuery>::Result&) { ++count; });
+        CORRADE_COMPARE(count, 0);
+        CORRADE_COMPARE(pool.capacity(), 0);
+
+        MAGNUM_VERIFY_NO_ERROR();
+    }
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void QueryPoolGLTest::enableNoCreate() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    QueryPool<SampleQuery> pool{NoCreate};
+    pool.setEnabled(true);
+    CORRADE_COMPARE(out.str(), "QueryPool::setEnabled(): can't enable a pool constructed with NoCreate\n");
+}
+
+void QueryPoolGLTest::collect() {
+    #ifdef MAGNUM_TARGET_GLES2
+    if(!Context::current().isExtensionSupported<Extensions::GL::EXT::occlusion_query_boolean>())
+        CORRADE_SKIP(Extensions::GL::EXT::occlusion_query_boolean::string() + std::string(" is not available."));
+    #endif
+
+    QueryPool<SampleQuery> pool{Target};
+    pool.begin(3);
+    pool.end();
+    pool.begin(7);
+    pool.end();
+    CORRADE_COMPARE(pool.pendingCount(), 2);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Results are available after everything is finished */
+    Renderer::finish();
+    std::vector<std::pair<UnsignedLong, UnsignedInt>> results;
+    pool.collect([&results](const QueryPool<SampleQuery>::Result& result) {
+        results.emplace_back(result.frame, result.tag);
+    });
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(pool.pendingCount(), 0);
+    CORRADE_VERIFY(results == (std::vector<std::pair<UnsignedLong, UnsignedInt>>{{0, 3}, {0, 7}}));
+}
+
+void QueryPoolGLTest::collectLatency() {
+    #ifdef MAGNUM_TARGET_GLES2
+    if(!Context::current().isExtensionSupported<Extensions::GL::EXT::occlusion_query_boolean>())
+        CORRADE_SKIP(Extensions::GL::EXT::occlusion_query_boolean::string() + std::string(" is not available."));
+    #endif
+
+    /* With zero latency the results are retrieved in the same frame, even if
+       not available yet */
+    QueryPool<SampleQuery> pool{Target, 0};
+    CORRADE_COMPARE(pool.latency(), 0);
+    pool.begin(1);
+    pool.end();
+
+    std::size_t count = 0;
+    pool.collect([this, &count](const QueryPool<SampleQuery>::Result& result) {
+        CORRADE_COMPARE(result.tag, 1);
+        ++count;
+    });
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(count, 1);
+    CORRADE_COMPARE(pool.pendingCount(), 0);
+}
+
+void QueryPoolGLTest::recycle() {
+    #ifdef MAGNUM_TARGET_GLES2
+    if(!Context::current().isExtensionSupported<Extensions::GL::EXT::occlusion_query_boolean>())
+        CORRADE_SKIP(Extensions::GL::EXT::occlusion_query_boolean::string() + std::string(" is not available."));
+    #endif
+
+    QueryPool<SampleQuery> pool{Target};
+    for(std::size_t frame = 0; frame != 10; ++frame) {
+        for(UnsignedInt i = 0; i != 4; ++i) {
+            pool.begin(i);
+            pool.end();
+        }
+
+        Renderer::finish();
+        pool.collect([](const QueryPool<SampleQuery>::Result&) {});
+    }
+
+    /* The queries got reused every frame */
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(pool.capacity(), 4);
+    CORRADE_COMPARE(pool.pendingCount(), 0);
+}
+
+void QueryPoolGLTest::disabled() {
+    #ifdef MAGNUM_TARGET_GLES2
+    if(!Context::current().isExtensionSupported<Extensions::GL::EXT::occlusion_query_boolean>())
+        CORRADE_SKIP(Extensions::GL::EXT::occlusion_query_boolean::string() + std::string(" is not available."));
+    #endif
+
+    QueryPool<SampleQuery> pool{Target, 0};
+    pool.begin(1);
+    pool.end();
+    pool.setEnabled(false);
+    CORRADE_VERIFY(!pool.isEnabled());
+
+    /* No new queries are created */
+    pool.begin(2);
+    pool.end();
+    CORRADE_COMPARE(pool.pendingCount(), 1);
+
+    /* Queries from before disabling are still collected */
+    std::vector<UnsignedInt> tags;
+    pool.collect([&tags](const QueryPool<SampleQuery>::Result& result) {
+        tags.push_back(result.tag);
+    });
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(tags == std::vector<UnsignedInt>{1});
+    CORRADE_COMPARE(pool.capacity(), 1);
+}
+
+void QueryPoolGLTest::beginActive() {
+    #ifdef MAGNUM_TARGET_GLES2
+    if(!Context::current().isExtensionSupported<Extensions::GL::EXT::occlusion_query_boolean>())
+        CORRADE_SKIP(Extensions::GL::EXT::occlusion_query_boolean::string() + std::string(" is not available."));
+    #endif
+
+    QueryPool<SampleQuery> pool{Target};
+    pool.begin();
+
+    std::ostringstream out;
+    {
+        Error redirectError{&out};
+        pool.begin();
+    }
+    pool.end();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(out.str(), "QueryPool::begin(): a query is already active\n");
+}
+
+void QueryPoolGLTest::endNotActive() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    QueryPool<SampleQuery> pool{Target};
+    pool.end();
+    CORRADE_COMPARE(out.str(), "QueryPool::end(): no query is active\n");
+}
+
+}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Test::QueryPoolGLTest)
@@ -0,0 +1,186 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Image.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/RenderbufferFormat.h"
+#include "Magnum/RenderGraph.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct RenderGraphGLTest: AbstractOpenGLTester {
+    explicit RenderGraphGLTest();
+
+    void execute();
+    void executeAliasing();
+    #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+    void blit();
+    #endif
+
+    private:
+        TextureFormat _color;
+};
+
+RenderGraphGLTest::RenderGraphGLTest() {
+    addTests({&RenderGraphGLTest::execute,
+              &RenderGraphGLTest::executeAliasing,
+              #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+              &RenderGraphGLTest::blit
+              #endif
+              });
+
+    #ifndef MAGNUM_TARGET_GLES2
+    _color = TextureFormat::RGBA8;
+    #else
+    _color = Context::current().isExtensionSupported<Extensions::GL::EXT::texture_storage>() ? TextureFormat::RGBA8 : TextureFormat::RGBA;
+    #endif
+}
+
+void RenderGraphGLTest::execute() {
+    RenderTargetPool pool;
+    RenderGraph graph{pool};
+    Texture2D outputTexture;
+    outputTexture.setStorage(1, _color, {4, 4});
+    const UnsignedInt scene = graph.addTransient("scene", {{4, 4}, _color});
+    const UnsignedInt output = graph.importTexture("output", outputTexture);
+    graph.setOutput(output);
+
+    std::vector<UnsignedInt> executed;
+    const UnsignedInt render = graph.addPass("render", [&](RenderGraph::PassResources& resources) {
+        executed.push_back(0);
+        resources.framebuffer(scene).bind();
+        CORRADE_COMPARE(pool.acquiredCount(), 1);
+    });
+    const UnsignedInt copy = graph.addPass("copy", [&](RenderGraph::PassResources& resources) {
+        executed.push_back(1);
+        CORRADE_VERIFY(resources.texture(scene).id() > 0);
+        CORRADE_VERIFY(&resources.texture(output) == &outputTexture);
+    });
+    graph.write(render, scene)
+        .read(copy, scene)
+        .write(copy, output, RenderGraph::Access::Image);
+
+    CORRADE_VERIFY(graph.compile());
+    graph.execute();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(executed, (std::vector<UnsignedInt>{0, 1}));
+    CORRADE_COMPARE(pool.capacity(), 1);
+    CORRADE_COMPARE(pool.acquiredCount(), 0);
+}
+
+void RenderGraphGLTest::executeAliasing() {
+    RenderTargetPool pool;
+    RenderGraph graph{pool};
+    Framebuffer screen{{{}, {4, 4}}};
+    const UnsignedInt a = graph.addTransient("a", {{4, 4}, _color});
+    const UnsignedInt b = graph.addTransient("b", {{4, 4}, _color});
+    const UnsignedInt c = graph.addTransient("c", {{4, 4}, _color});
+    const UnsignedInt output = graph.importFramebuffer("screen", screen);
+    graph.setOutput(output);
+
+    /* "a" is not used anymore when "c" is needed, so they share the same
+       target */
+    GLuint aId{}, cId{};
+    const UnsignedInt first = graph.addPass("first", [&](RenderGraph::PassResources& resources) {
+        aId = resources.texture(a).id();
+    });
+    const UnsignedInt second = graph.addPass("second", nullptr);
+    const UnsignedInt third = graph.addPass("third", [&](RenderGraph::PassResources& resources) {
+        cId = resources.texture(c).id();
+    });
+    const UnsignedInt final = graph.addPass("final", nullptr);
+    graph.write(first, a)
+        .read(second, a)
+        .write(second, b)
+        .read(third, b)
+        .write(third, c)
+        .read(final, c)
+        .write(final, output);
+
+    CORRADE_VERIFY(graph.compile());
+    graph.execute();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(pool.capacity(), 2);
+    CORRADE_COMPARE(pool.createdCount(), 2);
+    CORRADE_VERIFY(aId);
+    CORRADE_COMPARE(aId, cId);
+
+    /* Executing again doesn't create anything new */
+    graph.execute();
+    CORRADE_COMPARE(pool.createdCount(), 2);
+}
+
+#if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+void RenderGraphGLTest::blit() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::framebuffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::framebuffer_object::string() + std::string(" is not available."));
+    #elif defined(MAGNUM_TARGET_GLES2)
+    if(!Context::current().isExtensionSupported<Extensions::GL::ANGLE::framebuffer_blit>() &&
+       !Context::current().isExtensionSupported<Extensions::GL::NV::framebuffer_blit>())
+        CORRADE_SKIP("Required extension is not available.");
+    #endif
+
+    RenderTargetPool pool;
+    RenderGraph graph{pool};
+    Renderbuffer color;
+    #ifndef MAGNUM_TARGET_GLES2
+    color.setStorage(RenderbufferFormat::RGBA8, {4, 4});
+    #else
+    color.setStorage(RenderbufferFormat::RGBA4, {4, 4});
+    #endif
+    Framebuffer screen{{{}, {4, 4}}};
+    screen.attachRenderbuffer(Framebuffer::ColorAttachment{0}, color);
+    const UnsignedInt scene = graph.addTransient("scene", {{4, 4}, _color});
+    const UnsignedInt output = graph.importFramebuffer("screen", screen);
+    graph.setOutput(output);
+
+    const UnsignedInt render = graph.addPass("render", [&](RenderGraph::PassResources& resources) {
+        Renderer::setClearColor(Color4{1.0f, 0.0f, 1.0f, 1.0f});
+        resources.framebuffer(scene).clear(FramebufferClear::Color);
+    });
+    graph.write(render, scene);
+    graph.addBlitPass("resolve", scene, output, FramebufferBlit::Color);
+
+    CORRADE_VERIFY(graph.compile());
+    CORRADE_COMPARE(graph.passOrder().size(), 2);
+    graph.execute();
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    Image2D image = screen.read({{}, Vector2i{1}}, {PixelFormat::RGBA, PixelType::UnsignedByte});
+    CORRADE_COMPARE(image.data<Color4ub>()[0], Color4ub(255, 0, 255, 255));
+}
+#endif
+
+}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Test::RenderGraphGLTest)
@@ -0,0 +1,300 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/RenderGraph.h"
+
+namespace Magnum { namespace Test {
+
+struct RenderGraphTest: TestSuite::Tester {
+    explicit RenderGraphTest();
+
+    void construct();
+    void resourceByName();
+
+    void cull();
+    void cullTransitive();
+    void orderReadBeforeWrite();
+    void orderWriteAfterRead();
+    void cyclic();
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    void memoryBarriers();
+    #endif
+
+    void invalidAccess();
+    void notCompiled();
+    void modifiedAfterCompile();
+};
+
+RenderGraphTest::RenderGraphTest() {
+    addTests({&RenderGraphTest::construct,
+              &RenderGraphTest::resourceByName,
+
+              &RenderGraphTest::cull,
+              &RenderGraphTest::cullTransitive,
+              &RenderGraphTest::orderReadBeforeWrite,
+              &RenderGraphTest::orderWriteAfterRead,
+              &RenderGraphTest::cyclic,
+              #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+              &RenderGraphTest::memoryBarriers,
+              #endif
+
+              &RenderGraphTest::invalidAccess,
+              &RenderGraphTest::notCompiled,
+              &RenderGraphTest::modifiedAfterCompile});
+}
+
+namespace {
+    /* Transient resources don't touch GL until the graph is executed */
+    const RenderTargetPool::Description Target{{64, 64}, TextureFormat::RGBA8};
+}
+
+void RenderGraphTest::construct() {
+    RenderTargetPool pool;
+    RenderGraph graph{pool};
+
+    CORRADE_VERIFY(&graph.pool() == &pool);
+    CORRADE_COMPARE(graph.resourceCount(), 0);
+    CORRADE_COMPARE(graph.passCount(), 0);
+    CORRADE_VERIFY(!graph.isCompiled());
+}
+
+void RenderGraphTest::resourceByName() {
+    RenderTargetPool pool;
+    RenderGraph graph{pool};
+    Texture2D texture{NoCreate};
+    graph.addTransient("scene", Target);
+    graph.importTexture("shadow map", texture);
+
+    CORRADE_COMPARE(graph.resourceCount(), 2);
+    CORRADE_COMPARE(graph.resource("shadow map"), 1);
+    CORRADE_COMPARE(graph.resourceName(0), "scene");
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    graph.resource("bloom");
+    CORRADE_COMPARE(out.str(), "RenderGraph::resource(): resource bloom not found\n");
+}
+
+void RenderGraphTest::cull() {
+    RenderTargetPool pool;
+    RenderGraph graph{pool};
+    Framebuffer screen{NoCreate};
+    const UnsignedInt unused = graph.addTransient("unused", Target);
+    const UnsignedInt output = graph.importFramebuffer("screen", screen);
+    graph.setOutput(output);
+
+    const UnsignedInt a = graph.addPass("a", nullptr);
+    const UnsignedInt b = graph.addPass("b", nullptr);
+    const UnsignedInt c = graph.addPass("c", nullptr);
+    graph.write(a, unused)
+        .write(b, output);
+
+    CORRADE_VERIFY(graph.compile());
+    CORRADE_VERIFY(graph.isCompiled());
+    CORRADE_VERIFY(graph.isPassCulled(a));
+    CORRADE_VERIFY(!graph.isPassCulled(b));
+    /* Doesn't write anything */
+    CORRADE_VERIFY(graph.isPassCulled(c));
+    CORRADE_COMPARE_AS(graph.passOrder(), (std::vector<UnsignedInt>{b}), TestSuite::Compare::Container);
+}
+
+void RenderGraphTest::cullTransitive() {
+    RenderTargetPool pool;
+    RenderGraph graph{pool};
+    Framebuffer screen{NoCreate};
+    const UnsignedInt scene = graph.addTransient("scene", Target);
+    const UnsignedInt debug = graph.addTransient("debug", Target);
+    const UnsignedInt output = graph.importFramebuffer("screen", screen);
+    graph.setOutput(output);
+
+    const UnsignedInt render = graph.addPass("render", nullptr);
+    const UnsignedInt visualize = graph.addPass("visualize", nullptr);
+    const UnsignedInt tonemap = graph.addPass("tonemap", nullptr);
+    graph.write(render, scene)
+        .read(visualize, scene)
+        .write(visualize, debug)
+        .read(tonemap, scene)
+        .write(tonemap, output);
+
+    CORRADE_VERIFY(graph.compile());
+    CORRADE_VERIFY(!graph.isPassCulled(render));
+    CORRADE_VERIFY(graph.isPassCulled(visualize));
+    CORRADE_VERIFY(!graph.isPassCulled(tonemap));
+    CORRADE_COMPARE_AS(graph.passOrder(), (std::vector<UnsignedInt>{render, tonemap}), TestSuite::Compare::Container);
+}
+
+void RenderGraphTest::orderReadBeforeWrite() {
+    RenderTargetPool pool;
+    RenderGraph graph{pool};
+    Framebuffer screen{NoCreate};
+    const UnsignedInt shadowMap = graph.addTransient("shadow map", {{1024, 1024}, TextureFormat{}, TextureFormat::DepthComponent24});
+    const UnsignedInt output = graph.importFramebuffer("screen", screen);
+    graph.setOutput(output);
+
+    /* The lighting pass is declared first, but has to go after the shadow
+       pass */
+    const UnsignedInt lighting = graph.addPass("lighting", nullptr);
+    const UnsignedInt shadow = graph.addPass("shadow", nullptr);
+    graph.read(lighting, shadowMap)
+        .write(lighting, output)
+        .write(shadow, shadowMap);
+
+    CORRADE_VERIFY(graph.compile());
+    CORRADE_COMPARE_AS(graph.passOrder(), (std::vector<UnsignedInt>{shadow, lighting}), TestSuite::Compare::Container);
+}
+
+void RenderGraphTest::orderWriteAfterRead() {
+    RenderTargetPool pool;
+    RenderGraph graph{pool};
+    Framebuffer screen{NoCreate};
+    const UnsignedInt scene = graph.addTransient("scene", Target);
+    const UnsignedInt output = graph.importFramebuffer("screen", screen);
+    graph.setOutput(output);
+
+    const UnsignedInt opaque = graph.addPass("opaque", nullptr);
+    const UnsignedInt copy = graph.addPass("copy", nullptr);
+    const UnsignedInt transparent = graph.addPass("transparent", nullptr);
+    graph.write(opaque, scene)
+        .read(copy, scene)
+        .write(copy, output)
+        /* Writes to the scene after it got copied, depends on both the
+           previous writer and the reader */
+        .read(transparent, scene, RenderGraph::Access::Attachment)
+        .write(transparent, scene)
+        .write(transparent, output);
+
+    CORRADE_VERIFY(graph.compile());
+    CORRADE_COMPARE_AS(graph.passOrder(), (std::vector<UnsignedInt>{opaque, copy, transparent}), TestSuite::Compare::Container);
+}
+
+void RenderGraphTest::cyclic() {
+    RenderTargetPool pool;
+    RenderGraph graph{pool};
+    const UnsignedInt a = graph.addTransient("a", Target);
+    const UnsignedInt b = graph.addTransient("b", Target);
+    graph.setOutput(a);
+
+    const UnsignedInt first = graph.addPass("first", nullptr);
+    const UnsignedInt second = graph.addPass("second", nullptr);
+    graph.read(first, a)
+        .write(first, b)
+        .read(second, b)
+        .write(second, a);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!graph.compile());
+    CORRADE_VERIFY(!graph.isCompiled());
+    CORRADE_COMPARE(out.str(), "RenderGraph::compile(): passes have cyclic dependencies\n");
+}
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+void RenderGraphTest::memoryBarriers() {
+    RenderTargetPool pool;
+    RenderGraph graph{pool};
+    Framebuffer screen{NoCreate};
+    const UnsignedInt lights = graph.addTransient("lights", Target);
+    const UnsignedInt output = graph.importFramebuffer("screen", screen);
+    graph.setOutput(output);
+
+    const UnsignedInt cull = graph.addPass("cull", nullptr);
+    const UnsignedInt shade = graph.addPass("shade", nullptr);
+    const UnsignedInt composite = graph.addPass("composite", nullptr);
+    graph.write(cull, lights, RenderGraph::Access::Image)
+        .read(shade, lights, RenderGraph::Access::Image)
+        .read(shade, lights)
+        .write(shade, output)
+        .read(composite, lights)
+        .write(composite, output);
+
+    CORRADE_VERIFY(graph.compile());
+    CORRADE_COMPARE(graph.passMemoryBarriers(cull), Renderer::MemoryBarriers{});
+    CORRADE_COMPARE(graph.passMemoryBarriers(shade), Renderer::MemoryBarrier::ShaderImageAccess|Renderer::MemoryBarrier::TextureFetch);
+    /* Already issued before the previous pass */
+    CORRADE_COMPARE(graph.passMemoryBarriers(composite), Renderer::MemoryBarriers{});
+}
+#endif
+
+void RenderGraphTest::invalidAccess() {
+    RenderTargetPool pool;
+    RenderGraph graph{pool};
+    Texture2D texture{NoCreate};
+    Framebuffer framebuffer{NoCreate};
+    const UnsignedInt t = graph.importTexture("texture", texture);
+    const UnsignedInt f = graph.importFramebuffer("framebuffer", framebuffer);
+    const UnsignedInt pass = graph.addPass("pass", nullptr);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    graph.write(pass, t);
+    graph.read(pass, f);
+    graph.write(pass, f, RenderGraph::Access::Sampled);
+    graph.read(pass, 2);
+    CORRADE_COMPARE(out.str(),
+        "RenderGraph::write(): imported texture texture can be accessed only as sampled or image\n"
+        "RenderGraph::read(): imported framebuffer framebuffer can be accessed only as attachment or blit\n"
+        "RenderGraph::write(): can't write with sampled access\n"
+        "RenderGraph::read(): resource index 2 out of range for 2 resources\n");
+}
+
+void RenderGraphTest::notCompiled() {
+    RenderTargetPool pool;
+    RenderGraph graph{pool};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    graph.passOrder();
+    graph.execute();
+    CORRADE_COMPARE(out.str(),
+        "RenderGraph::passOrder(): the graph is not compiled\n"
+        "RenderGraph::execute(): the graph is not compiled\n");
+}
+
+void RenderGraphTest::modifiedAfterCompile() {
+    RenderTargetPool pool;
+    RenderGraph graph{pool};
+    Framebuffer screen{NoCreate};
+    const UnsignedInt output = graph.importFramebuffer("screen", screen);
+    graph.setOutput(output);
+    graph.write(graph.addPass("pass", nullptr), output);
+
+    CORRADE_VERIFY(graph.compile());
+    CORRADE_VERIFY(graph.isCompiled());
+
+    graph.addPass("another", nullptr);
+    CORRADE_VERIFY(!graph.isCompiled());
+
+    graph.clear();
+    CORRADE_COMPARE(graph.resourceCount(), 0);
+    CORRADE_COMPARE(graph.passCount(), 0);
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::RenderGraphTest)
@@ -0,0 +1,148 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/RenderState.h"
+
+namespace Magnum { namespace Test {
+
+struct RenderStateTest: TestSuite::Tester {
+    explicit RenderStateTest();
+
+    void constructDefault();
+    void construct();
+    void constructBlocks();
+
+    void id();
+    void compare();
+};
+
+RenderStateTest::RenderStateTest() {
+    addTests({&RenderStateTest::constructDefault,
+              &RenderStateTest::construct,
+              &RenderStateTest::constructBlocks,
+
+              &RenderStateTest::id,
+              &RenderStateTest::compare});
+}
+
+void RenderStateTest::constructDefault() {
+    RenderState state;
+
+    CORRADE_VERIFY(!state.blend().enabled);
+    CORRADE_COMPARE(state.blend().rgbEquation, Renderer::BlendEquation::Add);
+    CORRADE_COMPARE(state.blend().sourceRgb, Renderer::BlendFunction::One);
+    CORRADE_COMPARE(state.blend().destinationAlpha, Renderer::BlendFunction::Zero);
+    CORRADE_VERIFY(!state.depth().test);
+    CORRADE_COMPARE(state.depth().function, Renderer::DepthFunction::Less);
+    CORRADE_VERIFY(state.depth().write);
+    CORRADE_VERIFY(!state.raster().faceCulling);
+    CORRADE_COMPARE(state.raster().faceCullingMode, Renderer::PolygonFacing::Back);
+    CORRADE_COMPARE(state.raster().frontFace, Renderer::FrontFace::CounterClockWise);
+    CORRADE_VERIFY(!state.raster().polygonOffsetFill);
+    CORRADE_VERIFY(state.raster().colorMask.all());
+    CORRADE_VERIFY(!state.stencil().test);
+    CORRADE_COMPARE(state.stencil().function, Renderer::StencilFunction::Always);
+    CORRADE_COMPARE(state.stencil().mask, 0xffffffffu);
+    CORRADE_COMPARE(state.stencil().depthPass, Renderer::StencilOperation::Keep);
+    CORRADE_COMPARE(state.stencil().writeMask, 0xffffffffu);
+}
+
+void RenderStateTest::construct() {
+    RenderState state{
+        RenderState::Blend{Renderer::BlendFunction::SourceAlpha, Renderer::BlendFunction::OneMinusSourceAlpha},
+        RenderState::Depth{Renderer::DepthFunction::LessOrEqual, false},
+        RenderState::Raster{Renderer::PolygonFacing::Front, Renderer::FrontFace::ClockWise},
+        RenderState::Stencil{Renderer::StencilFunction::Equal, 1, 0xff, Renderer::StencilOperation::Keep, Renderer::StencilOperation::Keep, Renderer::StencilOperation::Replace, 0}};
+
+    CORRADE_VERIFY(state.blend().enabled);
+    CORRADE_COMPARE(state.blend().sourceRgb, Renderer::BlendFunction::SourceAlpha);
+    CORRADE_COMPARE(state.blend().sourceAlpha, Renderer::BlendFunction::SourceAlpha);
+    CORRADE_COMPARE(state.blend().destinationRgb, Renderer::BlendFunction::OneMinusSourceAlpha);
+    CORRADE_COMPARE(state.blend().destinationAlpha, Renderer::BlendFunction::OneMinusSourceAlpha);
+    CORRADE_VERIFY(state.depth().test);
+    CORRADE_COMPARE(state.depth().function, Renderer::DepthFunction::LessOrEqual);
+    CORRADE_VERIFY(!state.depth().write);
+    CORRADE_VERIFY(state.raster().faceCulling);
+    CORRADE_COMPARE(state.raster().faceCullingMode, Renderer::PolygonFacing::Front);
+    CORRADE_COMPARE(state.raster().frontFace, Renderer::FrontFace::ClockWise);
+    CORRADE_VERIFY(state.stencil().test);
+    CORRADE_COMPARE(state.stencil().function, Renderer::StencilFunction::Equal);
+    CORRADE_COMPARE(state.stencil().referenceValue, 1);
+    CORRADE_COMPARE(state.stencil().mask, 0xff);
+    CORRADE_COMPARE(state.stencil().depthPass, Renderer::StencilOperation::Replace);
+    CORRADE_COMPARE(state.stencil().writeMask, 0);
+}
+
+void RenderStateTest::constructBlocks() {
+    constexpr RenderState::Blend blend{
+        Renderer::BlendFunction::One, Renderer::BlendFunction::One,
+        Renderer::BlendFunction::Zero, Renderer::BlendFunction::One,
+        Renderer::BlendEquation::Add, Renderer::BlendEquation::Max};
+    CORRADE_VERIFY(blend.enabled);
+    CORRADE_COMPARE(blend.sourceAlpha, Renderer::BlendFunction::Zero);
+    CORRADE_COMPARE(blend.alphaEquation, Renderer::BlendEquation::Max);
+
+    RenderState::Raster raster;
+    raster.polygonOffsetFill = true;
+    raster.polygonOffsetFactor = 1.0f;
+    raster.polygonOffsetUnits = 2.0f;
+    raster.colorMask = Math::BoolVector<4>{0x08};
+    RenderState state{{}, {}, raster};
+    CORRADE_VERIFY(!state.raster().faceCulling);
+    CORRADE_VERIFY(state.raster().polygonOffsetFill);
+    CORRADE_COMPARE(state.raster().polygonOffsetUnits, 2.0f);
+    CORRADE_VERIFY(!state.raster().colorMask[0]);
+    CORRADE_VERIFY(state.raster().colorMask[3]);
+}
+
+void RenderStateTest::id() {
+    RenderState a;
+    RenderState b;
+    RenderState c = a;
+
+    CORRADE_VERIFY(a.id());
+    CORRADE_VERIFY(b.id());
+    CORRADE_VERIFY(a.id() != b.id());
+    CORRADE_COMPARE(c.id(), a.id());
+}
+
+void RenderStateTest::compare() {
+    RenderState a{RenderState::Blend{Renderer::BlendFunction::One, Renderer::BlendFunction::One}};
+    RenderState b{RenderState::Blend{Renderer::BlendFunction::One, Renderer::BlendFunction::One}};
+    RenderState c{RenderState::Blend{Renderer::BlendFunction::One, Renderer::BlendFunction::Zero}};
+    RenderState d{{}, RenderState::Depth{Renderer::DepthFunction::Less}};
+
+    /* Contents are compared, not IDs */
+    CORRADE_VERIFY(a == b);
+    CORRADE_VERIFY(a != c);
+    CORRADE_VERIFY(a != d);
+    CORRADE_VERIFY(RenderState{} == RenderState{});
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::RenderStateTest)
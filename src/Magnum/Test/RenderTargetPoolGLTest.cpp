@@ -0,0 +1,222 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/RenderTargetPool.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct RenderTargetPoolGLTest: AbstractOpenGLTester {
+    explicit RenderTargetPoolGLTest();
+
+    void construct();
+
+    void acquire();
+    void acquireDepthStencil();
+    #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+    void acquireMultisample();
+    #endif
+    void reuse();
+    void reuseDifferentDescription();
+    void nextFrame();
+    void nextFrameAcquired();
+
+    private:
+        TextureFormat _color, _depthStencil;
+};
+
+RenderTargetPoolGLTest::RenderTargetPoolGLTest() {
+    addTests({&RenderTargetPoolGLTest::construct,
+
+              &RenderTargetPoolGLTest::acquire,
+              &RenderTargetPoolGLTest::acquireDepthStencil,
+              #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+              &RenderTargetPoolGLTest::acquireMultisample,
+              #endif
+              &RenderTargetPoolGLTest::reuse,
+              &RenderTargetPoolGLTest::reuseDifferentDescription,
+              &RenderTargetPoolGLTest::nextFrame,
+              &RenderTargetPoolGLTest::nextFrameAcquired});
+
+    #ifndef MAGNUM_TARGET_GLES2
+    _color = TextureFormat::RGBA8;
+    _depthStencil = TextureFormat::Depth24Stencil8;
+    #else
+    if(Context::current().isExtensionSupported<Extensions::GL::EXT::texture_storage>()) {
+        _color = TextureFormat::RGBA8;
+        _depthStencil = TextureFormat::Depth24Stencil8;
+    } else {
+        _color = TextureFormat::RGBA;
+        _depthStencil = TextureFormat::DepthStencil;
+    }
+    #endif
+}
+
+void RenderTargetPoolGLTest::construct() {
+    RenderTargetPool pool{5};
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(pool.maxUnusedFrames(), 5);
+    CORRADE_COMPARE(pool.capacity(), 0);
+    CORRADE_COMPARE(pool.acquiredCount(), 0);
+    CORRADE_COMPARE(pool.createdCount(), 0);
+}
+
+void RenderTargetPoolGLTest::acquire() {
+    RenderTargetPool pool;
+    RenderTargetPool::Target& target = pool.acquire({{32, 16}, _color});
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(target.isAcquired());
+    CORRADE_VERIFY(target.description() == RenderTargetPool::Description({32, 16}, _color));
+    CORRADE_VERIFY(target.color().id() > 0);
+    CORRADE_COMPARE(target.framebuffer().viewport(), Range2Di({}, {32, 16}));
+    CORRADE_COMPARE(target.framebuffer().checkStatus(FramebufferTarget::Draw), Framebuffer::Status::Complete);
+    CORRADE_COMPARE(pool.capacity(), 1);
+    CORRADE_COMPARE(pool.acquiredCount(), 1);
+    CORRADE_COMPARE(pool.createdCount(), 1);
+
+    pool.release(target);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(!target.isAcquired());
+    CORRADE_COMPARE(pool.capacity(), 1);
+    CORRADE_COMPARE(pool.acquiredCount(), 0);
+}
+
+void RenderTargetPoolGLTest::acquireDepthStencil() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::framebuffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::framebuffer_object::string() + std::string(" is not available."));
+    #elif defined(MAGNUM_TARGET_GLES2)
+    if(!Context::current().isExtensionSupported<Extensions::GL::OES::packed_depth_stencil>())
+        CORRADE_SKIP(Extensions::GL::OES::packed_depth_stencil::string() + std::string(" is not available."));
+    #endif
+
+    RenderTargetPool pool;
+    RenderTargetPool::Target& target = pool.acquire({{32, 16}, _color, _depthStencil});
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(target.color().id() > 0);
+    CORRADE_VERIFY(target.depth().id() > 0);
+    CORRADE_COMPARE(target.framebuffer().checkStatus(FramebufferTarget::Draw), Framebuffer::Status::Complete);
+
+    pool.release(target);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+#if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+void RenderTargetPoolGLTest::acquireMultisample() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::framebuffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::framebuffer_object::string() + std::string(" is not available."));
+    #elif defined(MAGNUM_TARGET_GLES2)
+    if(!Context::current().isExtensionSupported<Extensions::GL::ANGLE::framebuffer_multisample>() &&
+       !Context::current().isExtensionSupported<Extensions::GL::NV::framebuffer_multisample>())
+        CORRADE_SKIP("Required extension is not available.");
+    #endif
+
+    RenderTargetPool pool;
+    RenderTargetPool::Target& target = pool.acquire({{32, 16}, TextureFormat::RGBA8, TextureFormat::DepthComponent24, Renderbuffer::maxSamples()});
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(target.colorRenderbuffer().id() > 0);
+    CORRADE_VERIFY(target.depthRenderbuffer().id() > 0);
+    CORRADE_COMPARE(target.framebuffer().checkStatus(FramebufferTarget::Draw), Framebuffer::Status::Complete);
+}
+#endif
+
+void RenderTargetPoolGLTest::reuse() {
+    RenderTargetPool pool;
+    RenderTargetPool::Target& a = pool.acquire({{32, 16}, _color});
+    RenderTargetPool::Target& b = pool.acquire({{32, 16}, _color});
+
+    /* Both are acquired, so they can't be the same */
+    CORRADE_VERIFY(&a != &b);
+    CORRADE_COMPARE(pool.createdCount(), 2);
+
+    pool.release(a);
+    RenderTargetPool::Target& c = pool.acquire({{32, 16}, _color});
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(&c == &a);
+    CORRADE_COMPARE(pool.capacity(), 2);
+    CORRADE_COMPARE(pool.acquiredCount(), 2);
+    CORRADE_COMPARE(pool.createdCount(), 2);
+}
+
+void RenderTargetPoolGLTest::reuseDifferentDescription() {
+    RenderTargetPool pool;
+    RenderTargetPool::Target& a = pool.acquire({{32, 16}, _color});
+    pool.release(a);
+
+    /* Different size, a new target has to be created */
+    RenderTargetPool::Target& b = pool.acquire({{16, 32}, _color});
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(&a != &b);
+    CORRADE_COMPARE(pool.capacity(), 2);
+    CORRADE_COMPARE(pool.createdCount(), 2);
+}
+
+void RenderTargetPoolGLTest::nextFrame() {
+    RenderTargetPool pool{1};
+    pool.release(pool.acquire({{32, 16}, _color}));
+    pool.nextFrame();
+
+    /* Used in this frame, kept */
+    pool.release(pool.acquire({{32, 16}, _color}));
+    pool.nextFrame();
+    CORRADE_COMPARE(pool.capacity(), 1);
+    CORRADE_COMPARE(pool.createdCount(), 1);
+
+    /* Not used in this frame, deleted */
+    pool.release(pool.acquire({{16, 32}, _color}));
+    pool.nextFrame();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(pool.capacity(), 1);
+    CORRADE_COMPARE(pool.createdCount(), 2);
+}
+
+void RenderTargetPoolGLTest::nextFrameAcquired() {
+    RenderTargetPool pool{1};
+    RenderTargetPool::Target& history = pool.acquire({{32, 16}, _color});
+    pool.nextFrame();
+    pool.nextFrame();
+    pool.nextFrame();
+
+    /* Kept across frames while acquired */
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(pool.capacity(), 1);
+    CORRADE_VERIFY(history.isAcquired());
+}
+
+}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Test::RenderTargetPoolGLTest)
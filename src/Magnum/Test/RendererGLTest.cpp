@@ -0,0 +1,141 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Context.h"
+#include "Magnum/Renderer.h"
+#include "Magnum/RenderState.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct RendererGLTest: AbstractOpenGLTester {
+    explicit RendererGLTest();
+
+    void stateTracking();
+    void stateTrackingStencilFacing();
+    void stateTrackingReset();
+
+    void renderState();
+};
+
+RendererGLTest::RendererGLTest() {
+    addTests({&RendererGLTest::stateTracking,
+              &RendererGLTest::stateTrackingStencilFacing,
+              &RendererGLTest::stateTrackingReset,
+
+              &RendererGLTest::renderState});
+}
+
+void RendererGLTest::stateTracking() {
+    Renderer::enable(Renderer::Feature::DepthTest);
+    Renderer::setBlendFunction(Renderer::BlendFunction::One, Renderer::BlendFunction::OneMinusSourceAlpha);
+    Renderer::setClearColor(Color4{0.5f});
+    Renderer::resetStateChangeCount();
+
+    /* Same values as above are skipped */
+    Renderer::enable(Renderer::Feature::DepthTest);
+    Renderer::setBlendFunction(Renderer::BlendFunction::One, Renderer::BlendFunction::OneMinusSourceAlpha);
+    Renderer::setClearColor(Color4{0.5f});
+    CORRADE_COMPARE(Renderer::stateChangeCount(), 0);
+    CORRADE_COMPARE(Renderer::skippedStateChangeCount(), 3);
+
+    /* Different values are not */
+    Renderer::disable(Renderer::Feature::DepthTest);
+    Renderer::setBlendFunction(Renderer::BlendFunction::One, Renderer::BlendFunction::Zero);
+    Renderer::setClearColor(Color4{0.25f});
+    CORRADE_COMPARE(Renderer::stateChangeCount(), 3);
+    CORRADE_COMPARE(Renderer::skippedStateChangeCount(), 3);
+
+    /* The separate variant with the same values is skipped */
+    Renderer::setBlendFunction(Renderer::BlendFunction::One, Renderer::BlendFunction::Zero, Renderer::BlendFunction::One, Renderer::BlendFunction::Zero);
+    CORRADE_COMPARE(Renderer::stateChangeCount(), 3);
+    CORRADE_COMPARE(Renderer::skippedStateChangeCount(), 4);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void RendererGLTest::stateTrackingStencilFacing() {
+    Renderer::setStencilMask(0xff);
+    Renderer::resetStateChangeCount();
+
+    /* Setting just one face to the same value is skipped */
+    Renderer::setStencilMask(Renderer::PolygonFacing::Front, 0xff);
+    CORRADE_COMPARE(Renderer::stateChangeCount(), 0);
+    CORRADE_COMPARE(Renderer::skippedStateChangeCount(), 1);
+
+    /* Setting back face to a different value makes setting both faces to
+       the original value needed again */
+    Renderer::setStencilMask(Renderer::PolygonFacing::Back, 0x0f);
+    Renderer::setStencilMask(0xff);
+    CORRADE_COMPARE(Renderer::stateChangeCount(), 2);
+    CORRADE_COMPARE(Renderer::skippedStateChangeCount(), 1);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void RendererGLTest::stateTrackingReset() {
+    Renderer::setDepthMask(true);
+    Renderer::resetStateChangeCount();
+
+    /* After reset the state is unknown and the call is not skipped */
+    Context::current().resetState(Context::State::Renderer);
+    Renderer::setDepthMask(true);
+    CORRADE_COMPARE(Renderer::stateChangeCount(), 1);
+    CORRADE_COMPARE(Renderer::skippedStateChangeCount(), 0);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void RendererGLTest::renderState() {
+    const RenderState opaque;
+    const RenderState additive{RenderState::Blend{Renderer::BlendFunction::One, Renderer::BlendFunction::One}};
+
+    Context::current().resetState(Context::State::Renderer);
+    opaque.apply();
+    Renderer::resetStateChangeCount();
+
+    /* Applying the same state again doesn't result in any GL call */
+    opaque.apply();
+    CORRADE_COMPARE(Renderer::stateChangeCount(), 0);
+    CORRADE_COMPARE(Renderer::skippedStateChangeCount(), 9);
+
+    /* Only the blending setup differs. The equation was never set before,
+       so it's unknown and applied as well. */
+    additive.apply();
+    CORRADE_COMPARE(Renderer::stateChangeCount(), 3);
+    CORRADE_COMPARE(Renderer::skippedStateChangeCount(), 17);
+
+    /* Switching back only disables the blending */
+    opaque.apply();
+    CORRADE_COMPARE(Renderer::stateChangeCount(), 4);
+    CORRADE_COMPARE(Renderer::skippedStateChangeCount(), 25);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Test::RendererGLTest)
@@ -24,6 +24,8 @@
 */
 
 #include <sstream>
+#include <thread>
+#include <vector>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/AbstractResourceLoader.h"
@@ -45,6 +47,11 @@ struct ResourceManagerTest: TestSuite::Tester {
     void clear();
     void clearWhileReferenced();
     void loader();
+    void memoryBudget();
+    void memoryBudgetNotEvictable();
+    void slotReuse();
+    void mutableGeneration();
+    void referenceCountThreaded();
 
     void debugResourceState();
 };
@@ -72,6 +79,11 @@ ResourceManagerTest::ResourceManagerTest() {
               &ResourceManagerTest::clear,
               &ResourceManagerTest::clearWhileReferenced,
               &ResourceManagerTest::loader,
+              &ResourceManagerTest::memoryBudget,
+              &ResourceManagerTest::memoryBudgetNotEvictable,
+              &ResourceManagerTest::slotReuse,
+              &ResourceManagerTest::mutableGeneration,
+              &ResourceManagerTest::referenceCountThreaded,
 
               &ResourceManagerTest::debugResourceState});
 }
@@ -333,6 +345,163 @@ void ResourceManagerTest::loader() {
     CORRADE_COMPARE(Data::count, 0);
 }
 
+namespace {
+    class DataResourceLoader: public AbstractResourceLoader<Data> {
+        private:
+            void doLoad(ResourceKey) override {}
+    };
+}
+
+void ResourceManagerTest::memoryBudget() {
+    ResourceManager rm;
+    auto loader = new DataResourceLoader;
+    rm.setLoader(loader);
+    rm.setMemoryBudget<Data>(100);
+    CORRADE_COMPARE(rm.memoryBudget<Data>(), 100);
+
+    rm.set("a", new Data, ResourceDataState::Final, ResourcePolicy::Resident, 40);
+    rm.set("b", new Data, ResourceDataState::Final, ResourcePolicy::Resident, 40);
+    CORRADE_COMPARE(rm.memoryUsage<Data>(), 80);
+
+    /* Using "a" makes "b" the least recently used */
+    rm.get<Data>("a");
+
+    /* Exceeding the budget evicts "b" */
+    rm.set("c", new Data, ResourceDataState::Final, ResourcePolicy::Resident, 40);
+    CORRADE_COMPARE(rm.memoryUsage<Data>(), 80);
+    CORRADE_COMPARE(rm.count<Data>(), 2);
+    CORRADE_COMPARE(Data::count, 2);
+    CORRADE_COMPARE(rm.state<Data>("a"), ResourceState::Final);
+    CORRADE_COMPARE(rm.state<Data>("b"), ResourceState::NotLoaded);
+    CORRADE_COMPARE(rm.state<Data>("c"), ResourceState::Final);
+
+    {
+        /* Referenced resources are not evicted even if least recently used */
+        Resource<Data> a = rm.get<Data>("a");
+        rm.get<Data>("c");
+        rm.setMemoryBudget<Data>(10);
+        CORRADE_COMPARE(rm.memoryUsage<Data>(), 40);
+        CORRADE_COMPARE(a.state(), ResourceState::Final);
+        CORRADE_COMPARE(rm.state<Data>("c"), ResourceState::NotLoaded);
+    }
+
+    /* Removing the last reference evicts it */
+    CORRADE_COMPARE(rm.memoryUsage<Data>(), 0);
+    CORRADE_COMPARE(rm.count<Data>(), 0);
+    CORRADE_COMPARE(Data::count, 0);
+
+    /* Evicted resources are requested from the loader again */
+    CORRADE_COMPARE(loader->requestedCount(), 0);
+    Resource<Data> b = rm.get<Data>("b");
+    CORRADE_COMPARE(loader->requestedCount(), 1);
+    CORRADE_COMPARE(b.state(), ResourceState::Loading);
+}
+
+void ResourceManagerTest::memoryBudgetNotEvictable() {
+    ResourceManager rm;
+    rm.setMemoryBudget<Data>(10);
+
+    /* No loader, nothing is evicted */
+    rm.set("resident", new Data, ResourceDataState::Final, ResourcePolicy::Resident, 10);
+    rm.set("manual", new Data, ResourceDataState::Mutable, ResourcePolicy::Manual, 20);
+    CORRADE_COMPARE(rm.memoryUsage<Data>(), 30);
+    CORRADE_COMPARE(rm.count<Data>(), 2);
+
+    /* Only resident resources are evicted */
+    rm.setLoader(new DataResourceLoader);
+    rm.set("manual", new Data, ResourceDataState::Mutable, ResourcePolicy::Manual, 30);
+    CORRADE_COMPARE(rm.memoryUsage<Data>(), 30);
+    CORRADE_COMPARE(rm.count<Data>(), 1);
+    CORRADE_COMPARE(rm.state<Data>("resident"), ResourceState::NotLoaded);
+
+    /* Freeing updates the usage */
+    rm.free();
+    CORRADE_COMPARE(rm.memoryUsage<Data>(), 0);
+    CORRADE_COMPARE(Data::count, 0);
+
+    /* Clearing as well */
+    rm.setMemoryBudget<Data>(0);
+    rm.set("unlimited", new Data, ResourceDataState::Final, ResourcePolicy::Resident, 50);
+    CORRADE_COMPARE(rm.memoryUsage<Data>(), 50);
+    rm.clear();
+    CORRADE_COMPARE(rm.memoryUsage<Data>(), 0);
+}
+
+void ResourceManagerTest::slotReuse() {
+    ResourceManager rm;
+
+    {
+        rm.set("a", 1, ResourceDataState::Final, ResourcePolicy::ReferenceCounted);
+        Resource<Int> a = rm.get<Int>("a");
+        CORRADE_COMPARE(*a, 1);
+    }
+    CORRADE_COMPARE(rm.count<Int>(), 0);
+
+    /* The erased slot gets reused for another key, which must not see the
+       previous data */
+    Resource<Int> b = rm.get<Int>("b");
+    CORRADE_COMPARE(rm.count<Int>(), 1);
+    CORRADE_COMPARE(b.state(), ResourceState::NotLoaded);
+    CORRADE_VERIFY(!b);
+
+    rm.set("b", 2, ResourceDataState::Mutable, ResourcePolicy::Manual);
+    CORRADE_COMPARE(b.state(), ResourceState::Mutable);
+    CORRADE_COMPARE(*b, 2);
+    CORRADE_COMPARE(rm.state<Int>("a"), ResourceState::NotLoaded);
+}
+
+void ResourceManagerTest::mutableGeneration() {
+    ResourceManager rm;
+
+    rm.set("a", 1, ResourceDataState::Mutable, ResourcePolicy::Resident);
+    Resource<Int> a = rm.get<Int>("a");
+    CORRADE_COMPARE(*a, 1);
+
+    /* Changing other resources doesn't affect this one */
+    rm.set("b", 2, ResourceDataState::Mutable, ResourcePolicy::Resident);
+    CORRADE_COMPARE(*a, 1);
+
+    /* Copies see the updated data as well */
+    Resource<Int> aCopy = a;
+    rm.set("a", 3, ResourceDataState::Mutable, ResourcePolicy::Resident);
+    CORRADE_COMPARE(*a, 3);
+    CORRADE_COMPARE(*aCopy, 3);
+
+    /* Fallback is picked up even without changing the resource itself */
+    Resource<Int> c = rm.get<Int>("c");
+    CORRADE_VERIFY(!c);
+    rm.setFallback(7);
+    CORRADE_COMPARE(c.state(), ResourceState::NotLoadedFallback);
+    CORRADE_COMPARE(*c, 7);
+}
+
+void ResourceManagerTest::referenceCountThreaded() {
+    ResourceManager rm;
+    rm.set("data", new Data, ResourceDataState::Final, ResourcePolicy::ReferenceCounted);
+
+    {
+        const Resource<Data> data = rm.get<Data>("data");
+        CORRADE_COMPARE(rm.referenceCount<Data>("data"), 1);
+
+        /* Copy and destroy the references concurrently */
+        std::vector<std::thread> threads;
+        for(std::size_t i = 0; i != 4; ++i) threads.emplace_back([&data]() {
+            for(std::size_t j = 0; j != 10000; ++j) {
+                Resource<Data> copy = data;
+                Resource<Data> another = copy;
+            }
+        });
+        for(std::thread& thread: threads) thread.join();
+
+        CORRADE_COMPARE(rm.referenceCount<Data>("data"), 1);
+        CORRADE_COMPARE(Data::count, 1);
+    }
+
+    /* The last reference released on this thread frees the data */
+    CORRADE_COMPARE(rm.count<Data>(), 0);
+    CORRADE_COMPARE(Data::count, 0);
+}
+
 void ResourceManagerTest::debugResourceState() {
     std::ostringstream out;
     Debug{&out} << ResourceState::Loading << ResourceState(0xbe);
@@ -0,0 +1,328 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/SamplerRegistry.h"
+#include "Magnum/Texture.h"
+#include "Magnum/TextureSet.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct SamplerGLTest: AbstractOpenGLTester {
+    explicit SamplerGLTest();
+
+    void construct();
+    void constructConfiguration();
+    void constructNoCreate();
+    void constructCopy();
+    void constructMove();
+    void wrap();
+
+    #ifndef MAGNUM_TARGET_WEBGL
+    void label();
+    #endif
+
+    void setParameters();
+
+    void bind();
+    void bindMulti();
+    void bindTextureSet();
+
+    void registry();
+};
+
+SamplerGLTest::SamplerGLTest() {
+    addTests({&SamplerGLTest::construct,
+              &SamplerGLTest::constructConfiguration,
+              &SamplerGLTest::constructNoCreate,
+              &SamplerGLTest::constructCopy,
+              &SamplerGLTest::constructMove,
+              &SamplerGLTest::wrap,
+
+              #ifndef MAGNUM_TARGET_WEBGL
+              &SamplerGLTest::label,
+              #endif
+
+              &SamplerGLTest::setParameters,
+
+              &SamplerGLTest::bind,
+              &SamplerGLTest::bindMulti,
+              &SamplerGLTest::bindTextureSet,
+
+              &SamplerGLTest::registry});
+}
+
+#ifndef MAGNUM_TARGET_GLES
+#define SKIP_IF_NO_SAMPLER_OBJECTS()                                        \
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::sampler_objects>()) \
+        CORRADE_SKIP(Extensions::GL::ARB::sampler_objects::string() + std::string(" is not available."))
+#else
+#define SKIP_IF_NO_SAMPLER_OBJECTS() do {} while(false)
+#endif
+
+void SamplerGLTest::construct() {
+    SKIP_IF_NO_SAMPLER_OBJECTS();
+
+    {
+        const Sampler sampler;
+
+        MAGNUM_VERIFY_NO_ERROR();
+        CORRADE_VERIFY(sampler.id() > 0);
+    }
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void SamplerGLTest::constructConfiguration() {
+    SKIP_IF_NO_SAMPLER_OBJECTS();
+
+    Sampler sampler{Sampler::Configuration{}
+        .setMinificationFilter(Sampler::Filter::Linear, Sampler::Mipmap::Linear)
+        .setWrapping(Sampler::Wrapping::ClampToEdge)};
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    GLint value;
+    glGetSamplerParameteriv(sampler.id(), GL_TEXTURE_MIN_FILTER, &value);
+    CORRADE_COMPARE(value, GL_LINEAR_MIPMAP_LINEAR);
+    glGetSamplerParameteriv(sampler.id(), GL_TEXTURE_WRAP_T, &value);
+    CORRADE_COMPARE(value, GL_CLAMP_TO_EDGE);
+}
+
+void SamplerGLTest::constructNoCreate() {
+    {
+        Sampler sampler{NoCreate};
+
+        MAGNUM_VERIFY_NO_ERROR();
+        CORRADE_COMPARE(sampler.id(), 0);
+    }
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void SamplerGLTest::constructCopy() {
+    CORRADE_VERIFY(!(std::is_constructible<Sampler, const Sampler&>{}));
+    CORRADE_VERIFY(!(std::is_assignable<Sampler, const Sampler&>{}));
+}
+
+void SamplerGLTest::constructMove() {
+    SKIP_IF_NO_SAMPLER_OBJECTS();
+
+    Sampler a;
+    const Int id = a.id();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(id > 0);
+
+    Sampler b(std::move(a));
+
+    CORRADE_COMPARE(a.id(), 0);
+    CORRADE_COMPARE(b.id(), id);
+
+    Sampler c;
+    const Int cId = c.id();
+    c = std::move(b);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(cId > 0);
+    CORRADE_COMPARE(b.id(), cId);
+    CORRADE_COMPARE(c.id(), id);
+}
+
+void SamplerGLTest::wrap() {
+    SKIP_IF_NO_SAMPLER_OBJECTS();
+
+    GLuint id;
+    glGenSamplers(1, &id);
+
+    /* Releasing won't delete anything */
+    {
+        auto sampler = Sampler::wrap(id, ObjectFlag::DeleteOnDestruction);
+        CORRADE_COMPARE(sampler.release(), id);
+    }
+
+    /* ...so we can wrap it again */
+    Sampler::wrap(id);
+    glDeleteSamplers(1, &id);
+}
+
+#ifndef MAGNUM_TARGET_WEBGL
+void SamplerGLTest::label() {
+    SKIP_IF_NO_SAMPLER_OBJECTS();
+
+    /* No-Op version is tested in AbstractObjectGLTest */
+    if(!Context::current().isExtensionSupported<Extensions::GL::KHR::debug>() &&
+       !Context::current().isExtensionSupported<Extensions::GL::EXT::debug_label>())
+        CORRADE_SKIP("Required extension is not available");
+
+    Sampler sampler;
+    CORRADE_COMPARE(sampler.label(), "");
+
+    sampler.setLabel("MySampler");
+    CORRADE_COMPARE(sampler.label(), "MySampler");
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+#endif
+
+void SamplerGLTest::setParameters() {
+    SKIP_IF_NO_SAMPLER_OBJECTS();
+
+    Sampler sampler;
+    sampler.setMinificationFilter(Sampler::Filter::Linear, Sampler::Mipmap::Nearest)
+        .setMagnificationFilter(Sampler::Filter::Nearest)
+        .setWrapping({Sampler::Wrapping::ClampToEdge, Sampler::Wrapping::MirroredRepeat, Sampler::Wrapping::Repeat})
+        .setMinLod(-100.0f)
+        .setMaxLod(100.0f)
+        .setMaxAnisotropy(Sampler::maxMaxAnisotropy())
+        .setCompareMode(Sampler::CompareMode::CompareRefToTexture)
+        .setCompareFunction(Sampler::CompareFunction::GreaterOrEqual);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    GLint value;
+    glGetSamplerParameteriv(sampler.id(), GL_TEXTURE_MIN_FILTER, &value);
+    CORRADE_COMPARE(value, GL_LINEAR_MIPMAP_NEAREST);
+    glGetSamplerParameteriv(sampler.id(), GL_TEXTURE_MAG_FILTER, &value);
+    CORRADE_COMPARE(value, GL_NEAREST);
+    glGetSamplerParameteriv(sampler.id(), GL_TEXTURE_WRAP_S, &value);
+    CORRADE_COMPARE(value, GL_CLAMP_TO_EDGE);
+    glGetSamplerParameteriv(sampler.id(), GL_TEXTURE_WRAP_T, &value);
+    CORRADE_COMPARE(value, GL_MIRRORED_REPEAT);
+    glGetSamplerParameteriv(sampler.id(), GL_TEXTURE_COMPARE_FUNC, &value);
+    CORRADE_COMPARE(value, GL_GEQUAL);
+
+    GLfloat lod;
+    glGetSamplerParameterfv(sampler.id(), GL_TEXTURE_MAX_LOD, &lod);
+    CORRADE_COMPARE(lod, 100.0f);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void SamplerGLTest::bind() {
+    SKIP_IF_NO_SAMPLER_OBJECTS();
+
+    Sampler sampler;
+    sampler.bind(5);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Binding again is a no-op */
+    sampler.bind(5);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    Sampler::unbind(5);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void SamplerGLTest::bindMulti() {
+    SKIP_IF_NO_SAMPLER_OBJECTS();
+
+    Sampler a, b;
+    Sampler::bind(7, {&a, nullptr, &b});
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Only the middle unit differs from the state tracker */
+    Sampler::bind(7, {&a, &b, &b});
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    Sampler::bind(7, {nullptr, nullptr, nullptr});
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void SamplerGLTest::bindTextureSet() {
+    SKIP_IF_NO_SAMPLER_OBJECTS();
+
+    Texture2D a, b;
+    Sampler sampler;
+    TextureSet set{3, {&a, &b}, {&sampler, nullptr}};
+
+    CORRADE_VERIFY(set.hasSamplers());
+    CORRADE_VERIFY(set.sampler(0) == &sampler);
+    CORRADE_VERIFY(set.sampler(1) == nullptr);
+
+    set.bind();
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    set.setSampler(0, nullptr)
+       .setSampler(1, &sampler);
+    set.bind();
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Texture set without samplers doesn't touch sampler bindings */
+    TextureSet plain{3, {&a}};
+    CORRADE_VERIFY(!plain.hasSamplers());
+    CORRADE_VERIFY(plain.sampler(0) == nullptr);
+    plain.bind();
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void SamplerGLTest::registry() {
+    SKIP_IF_NO_SAMPLER_OBJECTS();
+
+    SamplerRegistry registry;
+    CORRADE_VERIFY(registry.isEmpty());
+
+    const auto trilinear = Sampler::Configuration{}
+        .setMinificationFilter(Sampler::Filter::Linear, Sampler::Mipmap::Linear);
+    const auto nearest = Sampler::Configuration{}
+        .setMinificationFilter(Sampler::Filter::Nearest)
+        .setMagnificationFilter(Sampler::Filter::Nearest);
+
+    CORRADE_VERIFY(!registry.find(trilinear));
+
+    Sampler& a = registry.get(trilinear);
+    Sampler& b = registry.get(nearest);
+    Sampler& c = registry.get(Sampler::Configuration{trilinear});
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(registry.size(), 2);
+    CORRADE_VERIFY(&a == &c);
+    CORRADE_VERIFY(&a != &b);
+    CORRADE_VERIFY(registry.find(nearest) == &b);
+
+    GLint value;
+    glGetSamplerParameteriv(b.id(), GL_TEXTURE_MAG_FILTER, &value);
+    CORRADE_COMPARE(value, GL_NEAREST);
+
+    registry.clear();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(registry.isEmpty());
+}
+
+}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Test::SamplerGLTest)
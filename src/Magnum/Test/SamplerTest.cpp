@@ -33,6 +33,12 @@ namespace Magnum { namespace Test {
 struct SamplerTest: TestSuite::Tester {
     explicit SamplerTest();
 
+    #ifndef MAGNUM_TARGET_GLES2
+    void configurationConstructDefault();
+    void configurationSetters();
+    void configurationCompare();
+    #endif
+
     void debugFilter();
     void debugMipmap();
     void debugWrapping();
@@ -46,7 +52,14 @@ struct SamplerTest: TestSuite::Tester {
 };
 
 SamplerTest::SamplerTest() {
-    addTests({&SamplerTest::debugFilter,
+    addTests({
+              #ifndef MAGNUM_TARGET_GLES2
+              &SamplerTest::configurationConstructDefault,
+              &SamplerTest::configurationSetters,
+              &SamplerTest::configurationCompare,
+              #endif
+
+              &SamplerTest::debugFilter,
               &SamplerTest::debugMipmap,
               &SamplerTest::debugWrapping,
               #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
@@ -59,6 +72,63 @@ SamplerTest::SamplerTest() {
              });
 }
 
+#ifndef MAGNUM_TARGET_GLES2
+void SamplerTest::configurationConstructDefault() {
+    constexpr Sampler::Configuration configuration;
+    constexpr Sampler::Filter minificationFilter = configuration.minificationFilter();
+    constexpr Float maxLod = configuration.maxLod();
+
+    /* Matches the initial OpenGL sampler state */
+    CORRADE_COMPARE(minificationFilter, Sampler::Filter::Nearest);
+    CORRADE_COMPARE(configuration.minificationMipmap(), Sampler::Mipmap::Linear);
+    CORRADE_COMPARE(configuration.magnificationFilter(), Sampler::Filter::Linear);
+    CORRADE_VERIFY(configuration.wrapping() == Array3D<Sampler::Wrapping>{Sampler::Wrapping::Repeat});
+    CORRADE_COMPARE(configuration.minLod(), -1000.0f);
+    CORRADE_COMPARE(maxLod, 1000.0f);
+    CORRADE_COMPARE(configuration.maxAnisotropy(), 1.0f);
+    CORRADE_COMPARE(configuration.compareMode(), Sampler::CompareMode::None);
+    CORRADE_COMPARE(configuration.compareFunction(), Sampler::CompareFunction::LessOrEqual);
+}
+
+void SamplerTest::configurationSetters() {
+    Sampler::Configuration configuration;
+    configuration.setMinificationFilter(Sampler::Filter::Linear, Sampler::Mipmap::Nearest)
+        .setMagnificationFilter(Sampler::Filter::Nearest)
+        .setWrapping({Sampler::Wrapping::ClampToEdge, Sampler::Wrapping::MirroredRepeat, Sampler::Wrapping::Repeat})
+        .setMinLod(-2.0f)
+        .setMaxLod(8.0f)
+        .setMaxAnisotropy(16.0f)
+        .setCompareMode(Sampler::CompareMode::CompareRefToTexture)
+        .setCompareFunction(Sampler::CompareFunction::Greater);
+
+    CORRADE_COMPARE(configuration.minificationFilter(), Sampler::Filter::Linear);
+    CORRADE_COMPARE(configuration.minificationMipmap(), Sampler::Mipmap::Nearest);
+    CORRADE_COMPARE(configuration.magnificationFilter(), Sampler::Filter::Nearest);
+    CORRADE_COMPARE(configuration.wrapping()[0], Sampler::Wrapping::ClampToEdge);
+    CORRADE_COMPARE(configuration.wrapping()[1], Sampler::Wrapping::MirroredRepeat);
+    CORRADE_COMPARE(configuration.wrapping()[2], Sampler::Wrapping::Repeat);
+    CORRADE_COMPARE(configuration.minLod(), -2.0f);
+    CORRADE_COMPARE(configuration.maxLod(), 8.0f);
+    CORRADE_COMPARE(configuration.maxAnisotropy(), 16.0f);
+    CORRADE_COMPARE(configuration.compareMode(), Sampler::CompareMode::CompareRefToTexture);
+    CORRADE_COMPARE(configuration.compareFunction(), Sampler::CompareFunction::Greater);
+}
+
+void SamplerTest::configurationCompare() {
+    const auto a = Sampler::Configuration{}
+        .setMinificationFilter(Sampler::Filter::Linear, Sampler::Mipmap::Linear);
+    const auto b = Sampler::Configuration{}
+        .setMinificationFilter(Sampler::Filter::Linear, Sampler::Mipmap::Linear);
+
+    CORRADE_VERIFY(a == b);
+    CORRADE_VERIFY(!(a != b));
+    CORRADE_VERIFY(a != Sampler::Configuration{});
+    CORRADE_VERIFY(Sampler::Configuration{b}.setMaxAnisotropy(4.0f) != a);
+    CORRADE_VERIFY(Sampler::Configuration{b}.setWrapping(Sampler::Wrapping::ClampToEdge) != a);
+    CORRADE_VERIFY(Sampler::Configuration{b}.setCompareFunction(Sampler::CompareFunction::Less) != a);
+}
+#endif
+
 void SamplerTest::debugFilter() {
     std::ostringstream out;
 
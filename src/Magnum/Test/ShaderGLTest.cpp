@@ -23,7 +23,9 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
 #include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/System.h>
 
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
@@ -48,6 +50,7 @@ struct ShaderGLTest: AbstractOpenGLTester {
     void addSourceNoVersion();
     void addFile();
     void compile();
+    void compileAsync();
     void compileNoVersion();
 };
 
@@ -63,6 +66,7 @@ ShaderGLTest::ShaderGLTest() {
               &ShaderGLTest::addSourceNoVersion,
               &ShaderGLTest::addFile,
               &ShaderGLTest::compile,
+              &ShaderGLTest::compileAsync,
               &ShaderGLTest::compileNoVersion});
 }
 
@@ -265,6 +269,39 @@ void ShaderGLTest::compile() {
     CORRADE_VERIFY(!shader2.compile());
 }
 
+void ShaderGLTest::compileAsync() {
+    #ifndef MAGNUM_TARGET_GLES
+    constexpr Version v =
+        #ifndef CORRADE_TARGET_APPLE
+        Version::GL210
+        #else
+        Version::GL310
+        #endif
+        ;
+    #else
+    constexpr Version v = Version::GLES200;
+    #endif
+
+    Shader shader(v, Shader::Type::Fragment);
+    shader.addSource("void main() {}\n");
+    Shader shader2(v, Shader::Type::Fragment);
+    shader2.addSource("[fu] bleh error #:! stuff\n");
+    Shader::submitCompile({shader, shader2});
+
+    /* Without the extension this is always true, with the extension it
+       has to become true eventually */
+    while(!shader.isCompileFinished() || !shader2.isCompileFinished())
+        Utility::System::sleep(1);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(Shader::checkCompile({shader}));
+    CORRADE_VERIFY(!Shader::checkCompile({shader2}));
+    CORRADE_VERIFY(!out.str().empty());
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
 void ShaderGLTest::compileNoVersion() {
     Shader shader(Version::None, Shader::Type::Fragment);
     #ifndef MAGNUM_TARGET_GLES
@@ -0,0 +1,197 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Shader.h"
+#include "Magnum/ShaderProgramBinaryCache.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Test {
+
+struct ShaderProgramBinaryCacheGLTest: AbstractOpenGLTester {
+    explicit ShaderProgramBinaryCacheGLTest();
+
+    void construct();
+    void constructCopy();
+
+    void setCurrent();
+    void link();
+    void linkChangedSource();
+};
+
+ShaderProgramBinaryCacheGLTest::ShaderProgramBinaryCacheGLTest() {
+    addTests({&ShaderProgramBinaryCacheGLTest::construct,
+              &ShaderProgramBinaryCacheGLTest::constructCopy,
+
+              &ShaderProgramBinaryCacheGLTest::setCurrent,
+              &ShaderProgramBinaryCacheGLTest::link,
+              &ShaderProgramBinaryCacheGLTest::linkChangedSource});
+
+    Utility::Directory::mkpath(SHADERPROGRAMBINARYCACHEGLTEST_OUTPUT_DIR);
+}
+
+namespace {
+    struct MyShader: AbstractShaderProgram {
+        explicit MyShader(const std::string& color);
+    };
+
+    MyShader::MyShader(const std::string& color) {
+        Shader vert(
+            #ifndef MAGNUM_TARGET_GLES
+            #ifndef CORRADE_TARGET_APPLE
+            Version::GL210
+            #else
+            Version::GL310
+            #endif
+            #else
+            Version::GLES300
+            #endif
+            , Shader::Type::Vertex);
+        Shader frag(
+            #ifndef MAGNUM_TARGET_GLES
+            #ifndef CORRADE_TARGET_APPLE
+            Version::GL210
+            #else
+            Version::GL310
+            #endif
+            #else
+            Version::GLES300
+            #endif
+            , Shader::Type::Fragment);
+
+        vert.addSource("void main() { gl_Position = vec4(0.0); }\n");
+        frag.addSource(
+            #if !defined(MAGNUM_TARGET_GLES) && !defined(CORRADE_TARGET_APPLE)
+            "void main() { gl_FragColor = vec4(" + color + "); }\n"
+            #else
+            "out lowp vec4 fragmentColor;\n"
+            "void main() { fragmentColor = vec4(" + color + "); }\n"
+            #endif
+            );
+
+        CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({vert, frag}));
+        attachShaders({vert, frag});
+        CORRADE_INTERNAL_ASSERT_OUTPUT(AbstractShaderProgram::link({*this}));
+    }
+}
+
+void ShaderProgramBinaryCacheGLTest::construct() {
+    {
+        ShaderProgramBinaryCache cache{Utility::Directory::join(SHADERPROGRAMBINARYCACHEGLTEST_OUTPUT_DIR, "construct")};
+
+        CORRADE_COMPARE(cache.directory(), Utility::Directory::join(SHADERPROGRAMBINARYCACHEGLTEST_OUTPUT_DIR, "construct"));
+        CORRADE_COMPARE(cache.hits(), 0);
+        CORRADE_COMPARE(cache.misses(), 0);
+        CORRADE_COMPARE(cache.timeSaved(), 0.0f);
+    }
+
+    CORRADE_VERIFY(Utility::Directory::fileExists(Utility::Directory::join(SHADERPROGRAMBINARYCACHEGLTEST_OUTPUT_DIR, "construct")));
+}
+
+void ShaderProgramBinaryCacheGLTest::constructCopy() {
+    CORRADE_VERIFY(!(std::is_constructible<ShaderProgramBinaryCache, const ShaderProgramBinaryCache&>{}));
+    CORRADE_VERIFY(!(std::is_assignable<ShaderProgramBinaryCache, const ShaderProgramBinaryCache&>{}));
+}
+
+void ShaderProgramBinaryCacheGLTest::setCurrent() {
+    if(!ShaderProgramBinaryCache::isSupported())
+        CORRADE_SKIP("Program binaries are not supported");
+
+    CORRADE_VERIFY(!AbstractShaderProgram::binaryCache());
+
+    {
+        ShaderProgramBinaryCache cache{Utility::Directory::join(SHADERPROGRAMBINARYCACHEGLTEST_OUTPUT_DIR, "setCurrent")};
+        AbstractShaderProgram::setBinaryCache(&cache);
+        CORRADE_COMPARE(AbstractShaderProgram::binaryCache(), &cache);
+    }
+
+    /* Destructor resets the current cache */
+    CORRADE_VERIFY(!AbstractShaderProgram::binaryCache());
+}
+
+void ShaderProgramBinaryCacheGLTest::link() {
+    if(!ShaderProgramBinaryCache::isSupported())
+        CORRADE_SKIP("Program binaries are not supported");
+
+    const std::string directory = Utility::Directory::join(SHADERPROGRAMBINARYCACHEGLTEST_OUTPUT_DIR, "link");
+    for(const std::string& file: Utility::Directory::list(directory, Utility::Directory::Flag::SkipDirectories))
+        Utility::Directory::rm(Utility::Directory::join(directory, file));
+
+    ShaderProgramBinaryCache cache{directory};
+    AbstractShaderProgram::setBinaryCache(&cache);
+
+    /* First link is a miss, the binary gets saved */
+    {
+        MyShader shader{"1.0"};
+        MAGNUM_VERIFY_NO_ERROR();
+    }
+    CORRADE_COMPARE(cache.hits(), 0);
+    CORRADE_COMPARE(cache.misses(), 1);
+
+    /* Second is loaded from the cache */
+    {
+        MyShader shader{"1.0"};
+        MAGNUM_VERIFY_NO_ERROR();
+    }
+    CORRADE_COMPARE(cache.hits(), 1);
+    CORRADE_COMPARE(cache.misses(), 1);
+
+    AbstractShaderProgram::setBinaryCache(nullptr);
+}
+
+void ShaderProgramBinaryCacheGLTest::linkChangedSource() {
+    if(!ShaderProgramBinaryCache::isSupported())
+        CORRADE_SKIP("Program binaries are not supported");
+
+    ShaderProgramBinaryCache cache{Utility::Directory::join(SHADERPROGRAMBINARYCACHEGLTEST_OUTPUT_DIR, "linkChangedSource")};
+    AbstractShaderProgram::setBinaryCache(&cache);
+
+    {
+        MyShader shader{"1.0"};
+        MyShader another{"0.5"};
+        MAGNUM_VERIFY_NO_ERROR();
+    }
+
+    /* Each source has its own entry */
+    CORRADE_COMPARE(cache.hits() + cache.misses(), 2);
+    {
+        MyShader shader{"0.5"};
+        MAGNUM_VERIFY_NO_ERROR();
+    }
+    CORRADE_COMPARE(cache.hits() + cache.misses(), 3);
+    CORRADE_VERIFY(cache.hits() >= 1);
+
+    AbstractShaderProgram::setBinaryCache(nullptr);
+}
+
+}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Test::ShaderProgramBinaryCacheGLTest)
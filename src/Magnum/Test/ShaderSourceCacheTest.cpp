@@ -0,0 +1,214 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/ShaderSourceCache.h"
+
+namespace Magnum { namespace Test {
+
+struct ShaderSourceCacheTest: TestSuite::Tester {
+    explicit ShaderSourceCacheTest();
+
+    void noInclude();
+    void include();
+    void includeNested();
+    void includeRelative();
+    void includeOnce();
+    void includeCyclic();
+    void includeNotFound();
+    void notFound();
+
+    void cached();
+    void digest();
+};
+
+ShaderSourceCacheTest::ShaderSourceCacheTest() {
+    addTests({&ShaderSourceCacheTest::noInclude,
+              &ShaderSourceCacheTest::include,
+              &ShaderSourceCacheTest::includeNested,
+              &ShaderSourceCacheTest::includeRelative,
+              &ShaderSourceCacheTest::includeOnce,
+              &ShaderSourceCacheTest::includeCyclic,
+              &ShaderSourceCacheTest::includeNotFound,
+              &ShaderSourceCacheTest::notFound,
+
+              &ShaderSourceCacheTest::cached,
+              &ShaderSourceCacheTest::digest});
+}
+
+void ShaderSourceCacheTest::noInclude() {
+    ShaderSourceCache cache;
+    CORRADE_COMPARE(cache.preprocess("void main() {}\n"), "void main() {}\n");
+}
+
+void ShaderSourceCacheTest::include() {
+    ShaderSourceCache cache;
+    cache.addFile("a.glsl", "float a() { return 1.0; }\n");
+
+    CORRADE_COMPARE(cache.preprocess(
+        "uniform float b;\n"
+        "  #  include \"a.glsl\"\n"
+        "#include <a.glsl>\n"
+        "void main() {}\n"),
+        "uniform float b;\n"
+        "#line 1\n"
+        "float a() { return 1.0; }\n"
+        "#line 3\n"
+        "#line 4\n"
+        "void main() {}\n");
+}
+
+void ShaderSourceCacheTest::includeNested() {
+    ShaderSourceCache cache;
+    cache.addFile("a.glsl", "#include \"b.glsl\"\nfloat a;\n")
+        .addFile("b.glsl", "float b;\n");
+
+    CORRADE_COMPARE(cache.preprocess("#include \"a.glsl\"\nfloat c;\n"),
+        "#line 1\n"
+        "#line 1\n"
+        "float b;\n"
+        "#line 2\n"
+        "float a;\n"
+        "#line 2\n"
+        "float c;\n");
+}
+
+void ShaderSourceCacheTest::includeRelative() {
+    ShaderSourceCache cache;
+    cache.addFile("lib/a.glsl", "#include \"b.glsl\"\n")
+        .addFile("lib/b.glsl", "float libB;\n")
+        .addFile("b.glsl", "float b;\n");
+
+    /* b.glsl is found next to lib/a.glsl first */
+    CORRADE_COMPARE(cache.preprocess("#include \"lib/a.glsl\"\n#include \"b.glsl\"\n"),
+        "#line 1\n"
+        "#line 1\n"
+        "float libB;\n"
+        "#line 2\n"
+        "#line 2\n"
+        "#line 1\n"
+        "float b;\n"
+        "#line 3\n");
+}
+
+void ShaderSourceCacheTest::includeOnce() {
+    ShaderSourceCache cache;
+    cache.addFile("common.glsl", "float common;\n")
+        .addFile("a.glsl", "#include \"common.glsl\"\n")
+        .addFile("b.glsl", "#include \"common.glsl\"\n");
+
+    CORRADE_COMPARE(cache.preprocess("#include \"a.glsl\"\n#include \"b.glsl\"\n"),
+        "#line 1\n"
+        "#line 1\n"
+        "float common;\n"
+        "#line 2\n"
+        "#line 2\n"
+        "#line 1\n"
+        "#line 2\n"
+        "#line 3\n");
+}
+
+void ShaderSourceCacheTest::includeCyclic() {
+    ShaderSourceCache cache;
+    cache.addFile("a.glsl", "#include \"b.glsl\"\nfloat a;\n")
+        .addFile("b.glsl", "#include \"a.glsl\"\nfloat b;\n");
+
+    const ShaderSourceCache::Source* source = cache.get("a.glsl");
+    CORRADE_VERIFY(source);
+    CORRADE_COMPARE(source->source,
+        "#line 1\n"
+        "#line 2\n"
+        "float b;\n"
+        "#line 2\n"
+        "float a;\n");
+}
+
+void ShaderSourceCacheTest::includeNotFound() {
+    ShaderSourceCache cache;
+    cache.addFile("a.glsl", "#include \"nonexistent.glsl\"\n");
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!cache.get("a.glsl"));
+    CORRADE_COMPARE(cache.cachedCount(), 0);
+    CORRADE_COMPARE(out.str(), "ShaderSourceCache: can't find nonexistent.glsl included from a.glsl\n");
+}
+
+void ShaderSourceCacheTest::notFound() {
+    ShaderSourceCache cache;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!cache.get("nonexistent.glsl"));
+    CORRADE_COMPARE(out.str(), "ShaderSourceCache::get(): can't find nonexistent.glsl\n");
+}
+
+void ShaderSourceCacheTest::cached() {
+    ShaderSourceCache cache;
+    cache.addFile("a.glsl", "float a;\n")
+        .addFile("b.glsl", "float b;\n");
+
+    const ShaderSourceCache::Source* a = cache.get("a.glsl");
+    CORRADE_VERIFY(a);
+    CORRADE_COMPARE(cache.get("a.glsl"), a);
+    CORRADE_VERIFY(cache.get("b.glsl"));
+    CORRADE_COMPARE(cache.cachedCount(), 2);
+    CORRADE_COMPARE(cache.hits(), 1);
+    CORRADE_COMPARE(cache.misses(), 2);
+
+    /* Adding a file invalidates the cache */
+    cache.addFile("c.glsl", "float c;\n");
+    CORRADE_COMPARE(cache.cachedCount(), 0);
+
+    /* Clearing keeps the added files */
+    cache.clear();
+    CORRADE_VERIFY(cache.get("c.glsl"));
+    CORRADE_COMPARE(cache.cachedCount(), 1);
+}
+
+void ShaderSourceCacheTest::digest() {
+    ShaderSourceCache cache;
+    cache.addFile("common.glsl", "float common;\n")
+        .addFile("a.glsl", "#include \"common.glsl\"\n")
+        .addFile("b.glsl", "#include \"common.glsl\"\n");
+
+    const std::string a = cache.get("a.glsl")->digest;
+    const std::string b = cache.get("b.glsl")->digest;
+    CORRADE_VERIFY(!a.empty());
+    /* Same preprocessed source, same digest */
+    CORRADE_COMPARE(a, b);
+
+    /* Changing the include changes the digest of both */
+    cache.addFile("common.glsl", "float common2;\n");
+    CORRADE_VERIFY(cache.get("a.glsl")->digest != a);
+    CORRADE_COMPARE(cache.get("a.glsl")->digest, cache.get("b.glsl")->digest);
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::ShaderSourceCacheTest)
@@ -0,0 +1,227 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <string>
+#include <vector>
+
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/SparseTexturePageTable.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct SparseTexturePageTableGLTest: AbstractOpenGLTester {
+    explicit SparseTexturePageTableGLTest();
+
+    void construct();
+    void request();
+    void commit();
+    void commitEvict();
+    void commitEvictRequested();
+    void decommit();
+    void residency();
+};
+
+SparseTexturePageTableGLTest::SparseTexturePageTableGLTest() {
+    addTests({&SparseTexturePageTableGLTest::construct,
+              &SparseTexturePageTableGLTest::request,
+              &SparseTexturePageTableGLTest::commit,
+              &SparseTexturePageTableGLTest::commitEvict,
+              &SparseTexturePageTableGLTest::commitEvictRequested,
+              &SparseTexturePageTableGLTest::decommit,
+              &SparseTexturePageTableGLTest::residency});
+}
+
+namespace {
+    /* Four pages in each direction in level 0 */
+    Vector2i textureSize() {
+        return Texture2D::virtualPageSize(TextureFormat::RGBA8)*4;
+    }
+
+    ImageView2D pageImage(const SparseTexturePageTable& table, std::vector<UnsignedByte>& data) {
+        data.resize(table.pageSize().product()*4);
+        return ImageView2D{PixelFormat::RGBA, PixelType::UnsignedByte, table.pageSize(), Containers::arrayView(data.data(), data.size())};
+    }
+}
+
+void SparseTexturePageTableGLTest::construct() {
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::sparse_texture>())
+        CORRADE_SKIP(Extensions::GL::ARB::sparse_texture::string() + std::string(" is not supported."));
+
+    SparseTexturePageTable table{TextureFormat::RGBA8, textureSize(), 3, 8};
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(table.texture().id() > 0);
+    CORRADE_COMPARE(table.size(), textureSize());
+    CORRADE_COMPARE(table.levelCount(), 3);
+    CORRADE_VERIFY(table.sparseLevelCount() <= 3);
+    CORRADE_COMPARE(table.pageSize(), Texture2D::virtualPageSize(TextureFormat::RGBA8));
+    CORRADE_COMPARE(table.pageCount(0), Vector2i{4});
+    CORRADE_COMPARE(table.pageCount(1), Vector2i{2});
+    CORRADE_COMPARE(table.maxPageCount(), 8);
+    CORRADE_COMPARE(table.residentPageCount(), 0);
+}
+
+void SparseTexturePageTableGLTest::request() {
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::sparse_texture>())
+        CORRADE_SKIP(Extensions::GL::ARB::sparse_texture::string() + std::string(" is not supported."));
+
+    SparseTexturePageTable table{TextureFormat::RGBA8, textureSize(), 3, 8};
+    if(table.sparseLevelCount() < 2)
+        CORRADE_SKIP("Not enough sparse levels.");
+
+    table.request(0, {1, 2})
+        .request(1, {0, 1})
+        .request(0, {1, 2});
+
+    const auto missing = table.missingPages();
+    CORRADE_COMPARE(missing.size(), 2);
+    CORRADE_COMPARE(missing[0].first, 1);
+    CORRADE_COMPARE(missing[0].second, (Vector2i{0, 1}));
+    CORRADE_COMPARE(missing[1].first, 0);
+    CORRADE_COMPARE(missing[1].second, (Vector2i{1, 2}));
+
+    table.nextFrame();
+    CORRADE_VERIFY(table.missingPages().empty());
+}
+
+void SparseTexturePageTableGLTest::commit() {
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::sparse_texture>())
+        CORRADE_SKIP(Extensions::GL::ARB::sparse_texture::string() + std::string(" is not supported."));
+
+    SparseTexturePageTable table{TextureFormat::RGBA8, textureSize(), 3, 8};
+    std::vector<UnsignedByte> data;
+
+    table.request(0, {1, 2});
+    CORRADE_VERIFY(!table.isResident(0, {1, 2}));
+    CORRADE_VERIFY(table.commit(0, {1, 2}, pageImage(table, data)));
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(table.isResident(0, {1, 2}));
+    CORRADE_COMPARE(table.residentPageCount(), 1);
+    CORRADE_VERIFY(table.missingPages().empty());
+
+    /* Committing again only replaces the data */
+    CORRADE_VERIFY(table.commit(0, {1, 2}, pageImage(table, data)));
+    CORRADE_COMPARE(table.residentPageCount(), 1);
+}
+
+void SparseTexturePageTableGLTest::commitEvict() {
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::sparse_texture>())
+        CORRADE_SKIP(Extensions::GL::ARB::sparse_texture::string() + std::string(" is not supported."));
+
+    SparseTexturePageTable table{TextureFormat::RGBA8, textureSize(), 3, 2};
+    std::vector<UnsignedByte> data;
+
+    table.request(0, {0, 0});
+    table.commit(0, {0, 0}, pageImage(table, data));
+    table.nextFrame()
+        .request(0, {1, 0});
+    table.commit(0, {1, 0}, pageImage(table, data));
+    table.nextFrame()
+        .request(0, {2, 0});
+
+    /* The least recently requested page is evicted */
+    CORRADE_VERIFY(table.commit(0, {2, 0}, pageImage(table, data)));
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(table.residentPageCount(), 2);
+    CORRADE_COMPARE(table.evictionCount(), 1);
+    CORRADE_VERIFY(!table.isResident(0, {0, 0}));
+    CORRADE_VERIFY(table.isResident(0, {1, 0}));
+    CORRADE_VERIFY(table.isResident(0, {2, 0}));
+}
+
+void SparseTexturePageTableGLTest::commitEvictRequested() {
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::sparse_texture>())
+        CORRADE_SKIP(Extensions::GL::ARB::sparse_texture::string() + std::string(" is not supported."));
+
+    SparseTexturePageTable table{TextureFormat::RGBA8, textureSize(), 3, 1};
+    std::vector<UnsignedByte> data;
+
+    table.request(0, {0, 0})
+        .request(0, {1, 0});
+    CORRADE_VERIFY(table.commit(0, {0, 0}, pageImage(table, data)));
+
+    /* Page requested in this frame is not evicted */
+    CORRADE_VERIFY(!table.commit(0, {1, 0}, pageImage(table, data)));
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(table.residentPageCount(), 1);
+    CORRADE_COMPARE(table.evictionCount(), 0);
+    CORRADE_VERIFY(table.isResident(0, {0, 0}));
+    CORRADE_VERIFY(!table.isResident(0, {1, 0}));
+}
+
+void SparseTexturePageTableGLTest::decommit() {
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::sparse_texture>())
+        CORRADE_SKIP(Extensions::GL::ARB::sparse_texture::string() + std::string(" is not supported."));
+
+    SparseTexturePageTable table{TextureFormat::RGBA8, textureSize(), 3, 8};
+    std::vector<UnsignedByte> data;
+
+    table.commit(0, {0, 0}, pageImage(table, data));
+    table.commit(0, {3, 3}, pageImage(table, data));
+    table.decommit(0, {0, 0})
+        .decommit(0, {0, 1});
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(table.residentPageCount(), 1);
+    CORRADE_VERIFY(!table.isResident(0, {0, 0}));
+    CORRADE_VERIFY(table.isResident(0, {3, 3}));
+}
+
+void SparseTexturePageTableGLTest::residency() {
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::sparse_texture>())
+        CORRADE_SKIP(Extensions::GL::ARB::sparse_texture::string() + std::string(" is not supported."));
+
+    SparseTexturePageTable table{TextureFormat::RGBA8, textureSize(), 3, 8};
+    if(table.sparseLevelCount() < 2)
+        CORRADE_SKIP("Not enough sparse levels.");
+
+    std::vector<UnsignedByte> data;
+    table.commit(0, {0, 0}, pageImage(table, data));
+    table.commit(1, {1, 0}, pageImage(table, data));
+
+    const std::vector<UnsignedByte> residency = table.residency();
+    const UnsignedByte tail = table.sparseLevelCount();
+    CORRADE_COMPARE(residency.size(), 16);
+    CORRADE_COMPARE(residency[0], 0);
+    CORRADE_COMPARE(residency[1], tail);
+    CORRADE_COMPARE(residency[2], 1);
+    CORRADE_COMPARE(residency[3], 1);
+    CORRADE_COMPARE(residency[4*1 + 2], 1);
+    CORRADE_COMPARE(residency[4*2 + 2], tail);
+}
+
+}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Test::SparseTexturePageTableGLTest)
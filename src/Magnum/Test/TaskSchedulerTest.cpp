@@ -0,0 +1,278 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/TaskScheduler.h"
+
+namespace Magnum { namespace Test {
+
+struct TaskSchedulerTest: TestSuite::Tester {
+    explicit TaskSchedulerTest();
+
+    void construct();
+    void constructSingleThread();
+    void global();
+
+    void submitWait();
+    void submitNested();
+    void dependencies();
+    void dependenciesFinished();
+    void mainThread();
+    void waitAll();
+
+    void parallelFor();
+    void parallelForSmall();
+    void parallelForSingleThread();
+};
+
+TaskSchedulerTest::TaskSchedulerTest() {
+    addTests({&TaskSchedulerTest::construct,
+              &TaskSchedulerTest::constructSingleThread,
+              &TaskSchedulerTest::global,
+
+              &TaskSchedulerTest::submitWait,
+              &TaskSchedulerTest::submitNested,
+              &TaskSchedulerTest::dependencies,
+              &TaskSchedulerTest::dependenciesFinished,
+              &TaskSchedulerTest::mainThread,
+              &TaskSchedulerTest::waitAll,
+
+              &TaskSchedulerTest::parallelFor,
+              &TaskSchedulerTest::parallelForSmall,
+              &TaskSchedulerTest::parallelForSingleThread});
+}
+
+void TaskSchedulerTest::construct() {
+    TaskScheduler scheduler{4};
+    CORRADE_COMPARE(scheduler.threadCount(), 4);
+    CORRADE_VERIFY(scheduler.isMainThread());
+
+    TaskScheduler defaults;
+    CORRADE_VERIFY(defaults.threadCount() >= 1);
+
+    TaskScheduler::TaskHandle handle;
+    CORRADE_VERIFY(handle.isFinished());
+}
+
+void TaskSchedulerTest::constructSingleThread() {
+    TaskScheduler scheduler{1};
+    CORRADE_COMPARE(scheduler.threadCount(), 1);
+
+    /* Executed only once waited for */
+    int value = 0;
+    TaskScheduler::TaskHandle handle = scheduler.submit([&value]() { value = 42; });
+    CORRADE_VERIFY(!handle.isFinished());
+    CORRADE_COMPARE(value, 0);
+
+    scheduler.wait(handle);
+    CORRADE_VERIFY(handle.isFinished());
+    CORRADE_COMPARE(value, 42);
+}
+
+void TaskSchedulerTest::global() {
+    TaskScheduler& scheduler = TaskScheduler::global();
+    CORRADE_VERIFY(&TaskScheduler::global() == &scheduler);
+    CORRADE_VERIFY(scheduler.threadCount() >= 1);
+    CORRADE_VERIFY(scheduler.isMainThread());
+
+    int value = 0;
+    scheduler.wait(scheduler.submit([&value]() { value = 42; }));
+    CORRADE_COMPARE(value, 42);
+}
+
+void TaskSchedulerTest::submitWait() {
+    TaskScheduler scheduler{4};
+
+    std::atomic<int> sum{0};
+    std::vector<TaskScheduler::TaskHandle> handles;
+    for(int i = 0; i != 100; ++i)
+        handles.push_back(scheduler.submit([&sum, i]() { sum += i; }));
+
+    for(const TaskScheduler::TaskHandle& handle: handles) {
+        scheduler.wait(handle);
+        CORRADE_VERIFY(handle.isFinished());
+    }
+    CORRADE_COMPARE(sum, 4950);
+}
+
+void TaskSchedulerTest::submitNested() {
+    TaskScheduler scheduler{3};
+
+    /* Tasks waiting for tasks they spawned shouldn't deadlock the pool */
+    std::atomic<int> count{0};
+    std::vector<TaskScheduler::TaskHandle> handles;
+    for(int i = 0; i != 8; ++i) handles.push_back(scheduler.submit([&]() {
+        std::vector<TaskScheduler::TaskHandle> nested;
+        for(int j = 0; j != 8; ++j)
+            nested.push_back(scheduler.submit([&count]() { ++count; }));
+        for(const TaskScheduler::TaskHandle& handle: nested)
+            scheduler.wait(handle);
+    }));
+
+    for(const TaskScheduler::TaskHandle& handle: handles)
+        scheduler.wait(handle);
+    CORRADE_COMPARE(count, 64);
+}
+
+void TaskSchedulerTest::dependencies() {
+    TaskScheduler scheduler{4};
+
+    std::mutex mutex;
+    std::vector<int> order;
+    auto record = [&](int i) {
+        std::lock_guard<std::mutex> lock{mutex};
+        order.push_back(i);
+    };
+
+    /* Diamond: 0 -> {1, 2} -> 3 */
+    TaskScheduler::TaskHandle first = scheduler.submit([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        record(0);
+    });
+    TaskScheduler::TaskHandle a = scheduler.submit([&]() { record(1); }, {first});
+    TaskScheduler::TaskHandle b = scheduler.submit([&]() { record(1); }, {first});
+    TaskScheduler::TaskHandle last = scheduler.submit([&]() { record(2); }, {a, b});
+
+    scheduler.wait(last);
+    CORRADE_VERIFY(first.isFinished());
+    CORRADE_VERIFY(a.isFinished());
+    CORRADE_VERIFY(b.isFinished());
+    CORRADE_COMPARE(order, (std::vector<int>{0, 1, 1, 2}));
+}
+
+void TaskSchedulerTest::dependenciesFinished() {
+    TaskScheduler scheduler{2};
+
+    int value = 0;
+    TaskScheduler::TaskHandle first = scheduler.submit([&value]() { value = 3; });
+    scheduler.wait(first);
+
+    /* Already finished and empty dependencies are ignored */
+    TaskScheduler::TaskHandle second = scheduler.submit([&value]() { value *= 2; },
+        {first, TaskScheduler::TaskHandle{}});
+    scheduler.wait(second);
+    CORRADE_COMPARE(value, 6);
+}
+
+void TaskSchedulerTest::mainThread() {
+    TaskScheduler scheduler{4};
+
+    std::atomic<bool> onMainThread{false};
+    TaskScheduler::TaskHandle worker = scheduler.submit([]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds{5});
+    });
+    TaskScheduler::TaskHandle main = scheduler.submit([&]() {
+        onMainThread = scheduler.isMainThread();
+    }, {worker}, TaskScheduler::Affinity::MainThread);
+
+    /* Workers never execute it */
+    scheduler.wait(worker);
+    std::this_thread::sleep_for(std::chrono::milliseconds{5});
+    CORRADE_VERIFY(!main.isFinished());
+
+    CORRADE_COMPARE(scheduler.runMainThreadTasks(), 1);
+    CORRADE_VERIFY(main.isFinished());
+    CORRADE_VERIFY(onMainThread);
+    CORRADE_COMPARE(scheduler.runMainThreadTasks(), 0);
+
+    /* Executed also while waiting on the main thread */
+    onMainThread = false;
+    TaskScheduler::TaskHandle another = scheduler.submit([&]() {
+        onMainThread = scheduler.isMainThread();
+    }, {}, TaskScheduler::Affinity::MainThread);
+    scheduler.wait(another);
+    CORRADE_VERIFY(onMainThread);
+}
+
+void TaskSchedulerTest::waitAll() {
+    TaskScheduler scheduler{4};
+
+    std::atomic<int> count{0};
+    for(int i = 0; i != 50; ++i) {
+        TaskScheduler::TaskHandle handle = scheduler.submit([&count]() { ++count; });
+        scheduler.submit([&count]() { ++count; }, {handle});
+        scheduler.submit([&count]() { ++count; }, {handle}, TaskScheduler::Affinity::MainThread);
+    }
+
+    scheduler.waitAll();
+    CORRADE_COMPARE(count, 150);
+}
+
+void TaskSchedulerTest::parallelFor() {
+    TaskScheduler scheduler{4};
+
+    std::vector<int> data(10000, 0);
+    std::atomic<int> calls{0};
+    scheduler.parallelFor(data.size(), 100, [&](std::size_t begin, std::size_t end) {
+        ++calls;
+        for(std::size_t i = begin; i != end; ++i) ++data[i];
+    });
+
+    /* Each item processed exactly once, in a few chunks per thread */
+    for(std::size_t i = 0; i != data.size(); ++i)
+        if(data[i] != 1) CORRADE_COMPARE(data[i], 1);
+    CORRADE_COMPARE(calls, 16);
+}
+
+void TaskSchedulerTest::parallelForSmall() {
+    TaskScheduler scheduler{4};
+
+    /* Fits into one chunk, called directly */
+    std::size_t calledBegin = ~std::size_t{}, calledEnd = 0;
+    std::thread::id thread;
+    scheduler.parallelFor(50, 100, [&](std::size_t begin, std::size_t end) {
+        calledBegin = begin;
+        calledEnd = end;
+        thread = std::this_thread::get_id();
+    });
+    CORRADE_COMPARE(calledBegin, 0);
+    CORRADE_COMPARE(calledEnd, 50);
+    CORRADE_VERIFY(thread == std::this_thread::get_id());
+
+    /* Empty range does nothing */
+    bool called = false;
+    scheduler.parallelFor(0, 100, [&](std::size_t, std::size_t) { called = true; });
+    CORRADE_VERIFY(!called);
+}
+
+void TaskSchedulerTest::parallelForSingleThread() {
+    TaskScheduler scheduler{1};
+
+    std::vector<int> data(1000, 0);
+    scheduler.parallelFor(data.size(), 1, [&](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) data[i] += int(i);
+    });
+
+    for(std::size_t i = 0; i != data.size(); ++i)
+        if(data[i] != int(i)) CORRADE_COMPARE(data[i], int(i));
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::TaskSchedulerTest)
@@ -0,0 +1,128 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Texture.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/TextureHandle.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct TextureHandleGLTest: AbstractOpenGLTester {
+    explicit TextureHandleGLTest();
+
+    void construct();
+    void constructMove();
+
+    void residency();
+};
+
+TextureHandleGLTest::TextureHandleGLTest() {
+    addTests({&TextureHandleGLTest::construct,
+              &TextureHandleGLTest::constructMove,
+
+              &TextureHandleGLTest::residency});
+}
+
+void TextureHandleGLTest::construct() {
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::bindless_texture>())
+        CORRADE_SKIP(Extensions::GL::ARB::bindless_texture::string() + std::string(" is not supported."));
+
+    Texture2D texture;
+    texture.setStorage(1, TextureFormat::RGBA8, {16, 16});
+
+    {
+        TextureHandle handle{texture};
+
+        MAGNUM_VERIFY_NO_ERROR();
+        CORRADE_VERIFY(handle.handle() != 0);
+        CORRADE_VERIFY(handle.isResident());
+        CORRADE_VERIFY(glIsTextureHandleResidentARB(handle.handle()));
+    }
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void TextureHandleGLTest::constructMove() {
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::bindless_texture>())
+        CORRADE_SKIP(Extensions::GL::ARB::bindless_texture::string() + std::string(" is not supported."));
+
+    Texture2D texture;
+    texture.setStorage(1, TextureFormat::RGBA8, {16, 16});
+
+    TextureHandle a{texture};
+    const UnsignedLong handle = a.handle();
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    TextureHandle b{std::move(a)};
+
+    CORRADE_COMPARE(a.handle(), 0);
+    CORRADE_VERIFY(!a.isResident());
+    CORRADE_COMPARE(b.handle(), handle);
+    CORRADE_VERIFY(b.isResident());
+
+    Texture2D another;
+    another.setStorage(1, TextureFormat::RGBA8, {16, 16});
+    TextureHandle c{another};
+    const UnsignedLong anotherHandle = c.handle();
+    c = std::move(b);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(b.handle(), anotherHandle);
+    CORRADE_COMPARE(c.handle(), handle);
+}
+
+void TextureHandleGLTest::residency() {
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::bindless_texture>())
+        CORRADE_SKIP(Extensions::GL::ARB::bindless_texture::string() + std::string(" is not supported."));
+
+    Texture2D texture;
+    texture.setStorage(1, TextureFormat::RGBA8, {16, 16});
+
+    TextureHandle handle{texture};
+    handle.makeNonResident();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(!handle.isResident());
+    CORRADE_VERIFY(!glIsTextureHandleResidentARB(handle.handle()));
+
+    /* Calling it again is a no-op */
+    handle.makeNonResident();
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    handle.makeResident();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(handle.isResident());
+    CORRADE_VERIFY(glIsTextureHandleResidentARB(handle.handle()));
+}
+
+}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Test::TextureHandleGLTest)
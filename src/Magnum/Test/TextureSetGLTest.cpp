@@ -0,0 +1,139 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Texture.h"
+#include "Magnum/TextureSet.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct TextureSetGLTest: AbstractOpenGLTester {
+    explicit TextureSetGLTest();
+
+    void construct();
+    void constructMove();
+    void setTexture();
+
+    void bind();
+    void bindPartiallyChanged();
+};
+
+TextureSetGLTest::TextureSetGLTest() {
+    addTests({&TextureSetGLTest::construct,
+              &TextureSetGLTest::constructMove,
+              &TextureSetGLTest::setTexture,
+
+              &TextureSetGLTest::bind,
+              &TextureSetGLTest::bindPartiallyChanged});
+}
+
+void TextureSetGLTest::construct() {
+    Texture2D a, b;
+    TextureSet set{3, {&a, nullptr, &b}};
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(set.firstTextureUnit(), 3);
+    CORRADE_COMPARE(set.size(), 3);
+    CORRADE_VERIFY(set.texture(0) == &a);
+    CORRADE_VERIFY(set.texture(1) == nullptr);
+    CORRADE_VERIFY(set.texture(2) == &b);
+}
+
+void TextureSetGLTest::constructMove() {
+    Texture2D a;
+    TextureSet set{2, {&a}};
+
+    TextureSet b{std::move(set)};
+    CORRADE_COMPARE(b.firstTextureUnit(), 2);
+    CORRADE_COMPARE(b.size(), 1);
+    CORRADE_VERIFY(b.texture(0) == &a);
+
+    TextureSet c{0, {}};
+    c = std::move(b);
+    CORRADE_COMPARE(c.firstTextureUnit(), 2);
+    CORRADE_COMPARE(c.size(), 1);
+    CORRADE_VERIFY(c.texture(0) == &a);
+}
+
+void TextureSetGLTest::setTexture() {
+    Texture2D a, b;
+    TextureSet set{0, {&a, nullptr}};
+    set.setTexture(0, nullptr)
+       .setTexture(1, &b);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(set.texture(0) == nullptr);
+    CORRADE_VERIFY(set.texture(1) == &b);
+}
+
+void TextureSetGLTest::bind() {
+    Texture2D a, b;
+    TextureSet set{7, {&a, nullptr, &b}};
+    set.bind();
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Binding again is a no-op */
+    set.bind();
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    AbstractTexture::unbind(7, 3);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void TextureSetGLTest::bindPartiallyChanged() {
+    Texture2D a, b, c;
+    TextureSet set{7, {&a, &b, &c}};
+    set.bind();
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Only the middle unit differs from the state tracker now */
+    a.bind(7);
+    c.bind(9);
+    set.setTexture(1, nullptr);
+    set.bind();
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Rebinding single unit changed outside of the set */
+    b.bind(8);
+    set.bind();
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Unbinding through the state tracker has to know the target of the
+       units that were bound by the set */
+    AbstractTexture::unbind(7);
+    AbstractTexture::unbind(9);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Test::TextureSetGLTest)
@@ -0,0 +1,250 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Texture.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/TextureStreamer.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct TextureStreamerGLTest: AbstractOpenGLTester {
+    explicit TextureStreamerGLTest();
+
+    void levelForScreenSize();
+
+    void construct();
+    void add();
+    void remove();
+
+    void update();
+    void updateUploadLimit();
+    void updateBudget();
+    void updateBudgetLowered();
+};
+
+TextureStreamerGLTest::TextureStreamerGLTest() {
+    addTests({&TextureStreamerGLTest::levelForScreenSize,
+
+              &TextureStreamerGLTest::construct,
+              &TextureStreamerGLTest::add,
+              &TextureStreamerGLTest::remove,
+
+              &TextureStreamerGLTest::update,
+              &TextureStreamerGLTest::updateUploadLimit,
+              &TextureStreamerGLTest::updateBudget,
+              &TextureStreamerGLTest::updateBudgetLowered});
+}
+
+namespace {
+    /* 256x256 RGBA8, all levels view the same data */
+    UnsignedByte Data[256*256*4]{};
+
+    std::vector<ImageView2D> levels() {
+        std::vector<ImageView2D> out;
+        for(Int size = 256; size; size /= 2)
+            out.emplace_back(PixelFormat::RGBA, PixelType::UnsignedByte, Vector2i{size},
+                Containers::ArrayView<const UnsignedByte>{Data, std::size_t(size*size*4)});
+        return out;
+    }
+
+    /* Levels 64x64 to 1x1 */
+    constexpr std::size_t TailSize = 4*(64*64 + 32*32 + 16*16 + 8*8 + 4*4 + 2*2 + 1);
+    constexpr std::size_t Level1Size = 4*128*128;
+    constexpr std::size_t Level0Size = 4*256*256;
+}
+
+void TextureStreamerGLTest::levelForScreenSize() {
+    CORRADE_COMPARE(TextureStreamer::levelForScreenSize({256, 128}, 9, 256.0f), 0);
+    CORRADE_COMPARE(TextureStreamer::levelForScreenSize({256, 128}, 9, 100.0f), 1);
+    CORRADE_COMPARE(TextureStreamer::levelForScreenSize({256, 128}, 9, 1.0f), 8);
+
+    /* Clamped */
+    CORRADE_COMPARE(TextureStreamer::levelForScreenSize({256, 128}, 9, 1000.0f), 0);
+    CORRADE_COMPARE(TextureStreamer::levelForScreenSize({256, 128}, 4, 1.0f), 3);
+
+    /* Not requested */
+    CORRADE_COMPARE(TextureStreamer::levelForScreenSize({256, 128}, 9, 0.0f), 8);
+}
+
+void TextureStreamerGLTest::construct() {
+    TextureStreamer streamer{1024};
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(streamer.budget(), 1024);
+    CORRADE_COMPARE(streamer.residentSize(), 0);
+    CORRADE_COMPARE(streamer.textureCount(), 0);
+    CORRADE_COMPARE(streamer.tailSize(), 64);
+}
+
+void TextureStreamerGLTest::add() {
+    const std::vector<ImageView2D> views = levels();
+
+    Texture2D texture;
+    TextureStreamer streamer{1024*1024};
+    const UnsignedInt id = streamer.add(texture, TextureFormat::RGBA8, Containers::arrayView(views.data(), views.size()));
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(id, 0);
+    CORRADE_COMPARE(streamer.textureCount(), 1);
+    CORRADE_COMPARE(streamer.baseLevel(id), 2);
+    CORRADE_COMPARE(streamer.desiredLevel(id), 8);
+    CORRADE_COMPARE(streamer.residentSize(), TailSize);
+
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_COMPARE(texture.imageSize(2), Vector2i{64});
+    CORRADE_COMPARE(texture.imageSize(0), Vector2i{0});
+    #endif
+}
+
+void TextureStreamerGLTest::remove() {
+    const std::vector<ImageView2D> views = levels();
+
+    Texture2D a, b, c;
+    TextureStreamer streamer{1024*1024};
+    streamer.add(a, TextureFormat::RGBA8, Containers::arrayView(views.data(), views.size()));
+    const UnsignedInt idB = streamer.add(b, TextureFormat::RGBA8, Containers::arrayView(views.data(), views.size()));
+    CORRADE_COMPARE(streamer.residentSize(), 2*TailSize);
+
+    streamer.remove(idB);
+    CORRADE_COMPARE(streamer.textureCount(), 1);
+    CORRADE_COMPARE(streamer.residentSize(), TailSize);
+
+    /* The ID gets reused */
+    CORRADE_COMPARE(streamer.add(c, TextureFormat::RGBA8, Containers::arrayView(views.data(), views.size())), idB);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void TextureStreamerGLTest::update() {
+    const std::vector<ImageView2D> views = levels();
+
+    Texture2D texture;
+    TextureStreamer streamer{1024*1024};
+    const UnsignedInt id = streamer.add(texture, TextureFormat::RGBA8, Containers::arrayView(views.data(), views.size()));
+
+    /* Largest request wins */
+    streamer.request(id, 50.0f)
+        .request(id, 256.0f)
+        .update();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(streamer.desiredLevel(id), 0);
+    CORRADE_COMPARE(streamer.baseLevel(id), 0);
+    CORRADE_COMPARE(streamer.uploadCount(), 2);
+    CORRADE_COMPARE(streamer.residentSize(), TailSize + Level1Size + Level0Size);
+
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_COMPARE(texture.imageSize(0), Vector2i{256});
+    #endif
+
+    /* Not requested anymore, but the levels stay */
+    streamer.update();
+    CORRADE_COMPARE(streamer.desiredLevel(id), 8);
+    CORRADE_COMPARE(streamer.baseLevel(id), 0);
+    CORRADE_COMPARE(streamer.uploadCount(), 0);
+    CORRADE_COMPARE(streamer.evictionCount(), 0);
+}
+
+void TextureStreamerGLTest::updateUploadLimit() {
+    const std::vector<ImageView2D> views = levels();
+
+    Texture2D texture;
+    TextureStreamer streamer{1024*1024};
+    streamer.setUploadLimit(Level1Size);
+    const UnsignedInt id = streamer.add(texture, TextureFormat::RGBA8, Containers::arrayView(views.data(), views.size()));
+
+    /* One level per update. The second is larger than the limit, but at
+       least one is always uploaded */
+    streamer.request(id, 256.0f).update();
+    CORRADE_COMPARE(streamer.uploadCount(), 1);
+    CORRADE_COMPARE(streamer.baseLevel(id), 1);
+
+    streamer.request(id, 256.0f).update();
+    CORRADE_COMPARE(streamer.uploadCount(), 1);
+    CORRADE_COMPARE(streamer.baseLevel(id), 0);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void TextureStreamerGLTest::updateBudget() {
+    const std::vector<ImageView2D> views = levels();
+
+    Texture2D a, b;
+    TextureStreamer streamer{2*TailSize + Level1Size};
+    const UnsignedInt idA = streamer.add(a, TextureFormat::RGBA8, Containers::arrayView(views.data(), views.size()));
+    const UnsignedInt idB = streamer.add(b, TextureFormat::RGBA8, Containers::arrayView(views.data(), views.size()));
+
+    /* Only the first level of A fits */
+    streamer.request(idA, 256.0f).update();
+    CORRADE_COMPARE(streamer.baseLevel(idA), 1);
+    CORRADE_COMPARE(streamer.residentSize(), 2*TailSize + Level1Size);
+
+    /* B smaller than A doesn't get anything */
+    streamer.request(idA, 256.0f)
+        .request(idB, 128.0f)
+        .update();
+    CORRADE_COMPARE(streamer.baseLevel(idA), 1);
+    CORRADE_COMPARE(streamer.baseLevel(idB), 2);
+    CORRADE_COMPARE(streamer.uploadCount(), 0);
+
+    /* B larger than A evicts its level */
+    streamer.request(idA, 100.0f)
+        .request(idB, 128.0f)
+        .update();
+    CORRADE_COMPARE(streamer.baseLevel(idA), 2);
+    CORRADE_COMPARE(streamer.baseLevel(idB), 1);
+    CORRADE_COMPARE(streamer.uploadCount(), 1);
+    CORRADE_COMPARE(streamer.evictionCount(), 1);
+    CORRADE_COMPARE(streamer.residentSize(), 2*TailSize + Level1Size);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void TextureStreamerGLTest::updateBudgetLowered() {
+    const std::vector<ImageView2D> views = levels();
+
+    Texture2D texture;
+    TextureStreamer streamer{1024*1024};
+    const UnsignedInt id = streamer.add(texture, TextureFormat::RGBA8, Containers::arrayView(views.data(), views.size()));
+    streamer.request(id, 256.0f).update();
+    CORRADE_COMPARE(streamer.baseLevel(id), 0);
+
+    /* The tail is never evicted, even if it doesn't fit */
+    streamer.setBudget(TailSize/2)
+        .request(id, 256.0f)
+        .update();
+    CORRADE_COMPARE(streamer.baseLevel(id), 2);
+    CORRADE_COMPARE(streamer.evictionCount(), 2);
+    CORRADE_COMPARE(streamer.uploadCount(), 0);
+    CORRADE_COMPARE(streamer.residentSize(), TailSize);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Test::TextureStreamerGLTest)
@@ -0,0 +1,158 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/BufferImage.h"
+#include "Magnum/Image.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Texture.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/TextureUploadQueue.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct TextureUploadQueueGLTest: AbstractOpenGLTester {
+    explicit TextureUploadQueueGLTest();
+
+    void construct();
+
+    void upload();
+    void uploadWrapAround();
+    void uploadGrow();
+};
+
+TextureUploadQueueGLTest::TextureUploadQueueGLTest() {
+    addTests({&TextureUploadQueueGLTest::construct,
+
+              &TextureUploadQueueGLTest::upload,
+              &TextureUploadQueueGLTest::uploadWrapAround,
+              &TextureUploadQueueGLTest::uploadGrow});
+}
+
+namespace {
+    constexpr UnsignedByte Zero[4*4*4] = {};
+
+    constexpr UnsignedByte Data[] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+    };
+
+    /* Data at offset {1, 1} in a zero-filled 4x4 texture */
+    constexpr UnsignedByte SubDataComplete[] = {
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0, 0, 0, 0,
+        0,    0,    0,    0,    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0, 0, 0, 0,
+        0,    0,    0,    0,    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0, 0, 0, 0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0, 0, 0, 0
+    };
+}
+
+void TextureUploadQueueGLTest::construct() {
+    TextureUploadQueue2D queue{5};
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(queue.bufferCount(), 5);
+    CORRADE_COMPARE(queue.waitCount(), 0);
+}
+
+void TextureUploadQueueGLTest::upload() {
+    Texture2D texture;
+    texture.setImage(0, TextureFormat::RGBA8,
+        ImageView2D(PixelFormat::RGBA, PixelType::UnsignedByte, Vector2i(4), Zero));
+
+    TextureUploadQueue2D queue;
+    queue.upload(texture, 0, Vector2i(1),
+        ImageView2D(PixelFormat::RGBA, PixelType::UnsignedByte, Vector2i(2), Data));
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /** @todo How to test this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    Image2D image = texture.image(0, {PixelFormat::RGBA, PixelType::UnsignedByte});
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    CORRADE_COMPARE(image.size(), Vector2i(4));
+    CORRADE_COMPARE_AS((Containers::ArrayView<const UnsignedByte>{image.data<UnsignedByte>(), image.data().size()}),
+        Containers::ArrayView<const UnsignedByte>{SubDataComplete}, TestSuite::Compare::Container);
+    #endif
+}
+
+void TextureUploadQueueGLTest::uploadWrapAround() {
+    Texture2D texture;
+    texture.setImage(0, TextureFormat::RGBA8,
+        ImageView2D(PixelFormat::RGBA, PixelType::UnsignedByte, Vector2i(4), Zero));
+
+    /* Upload to all four corners with two staging buffers, the last upload
+       is the one from the test above */
+    TextureUploadQueue2D queue{2};
+    queue.upload(texture, 0, {0, 0}, ImageView2D(PixelFormat::RGBA, PixelType::UnsignedByte, Vector2i(2), Zero))
+        .upload(texture, 0, {2, 0}, ImageView2D(PixelFormat::RGBA, PixelType::UnsignedByte, Vector2i(2), Zero))
+        .upload(texture, 0, {0, 2}, ImageView2D(PixelFormat::RGBA, PixelType::UnsignedByte, Vector2i(2), Zero))
+        .upload(texture, 0, {2, 2}, ImageView2D(PixelFormat::RGBA, PixelType::UnsignedByte, Vector2i(2), Zero))
+        .upload(texture, 0, Vector2i(1), ImageView2D(PixelFormat::RGBA, PixelType::UnsignedByte, Vector2i(2), Data));
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /** @todo How to test this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    Image2D image = texture.image(0, {PixelFormat::RGBA, PixelType::UnsignedByte});
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    CORRADE_COMPARE_AS((Containers::ArrayView<const UnsignedByte>{image.data<UnsignedByte>(), image.data().size()}),
+        Containers::ArrayView<const UnsignedByte>{SubDataComplete}, TestSuite::Compare::Container);
+    #endif
+}
+
+void TextureUploadQueueGLTest::uploadGrow() {
+    Texture2D texture;
+    texture.setImage(0, TextureFormat::RGBA8,
+        ImageView2D(PixelFormat::RGBA, PixelType::UnsignedByte, Vector2i(4), Zero));
+
+    /* Small upload first, then the whole texture through the same buffer
+       and then small again to reuse the grown storage */
+    TextureUploadQueue2D queue{1};
+    queue.upload(texture, 0, {}, ImageView2D(PixelFormat::RGBA, PixelType::UnsignedByte, Vector2i(2), Data))
+        .upload(texture, 0, {}, ImageView2D(PixelFormat::RGBA, PixelType::UnsignedByte, Vector2i(4), Zero))
+        .upload(texture, 0, Vector2i(1), ImageView2D(PixelFormat::RGBA, PixelType::UnsignedByte, Vector2i(2), Data));
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /** @todo How to test this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    Image2D image = texture.image(0, {PixelFormat::RGBA, PixelType::UnsignedByte});
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    CORRADE_COMPARE_AS((Containers::ArrayView<const UnsignedByte>{image.data<UnsignedByte>(), image.data().size()}),
+        Containers::ArrayView<const UnsignedByte>{SubDataComplete}, TestSuite::Compare::Container);
+    #endif
+}
+
+}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Test::TextureUploadQueueGLTest)
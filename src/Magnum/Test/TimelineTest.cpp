@@ -0,0 +1,178 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <thread>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/FrameAllocator.h"
+#include "Magnum/Timeline.h"
+
+namespace Magnum { namespace Test {
+
+struct TimelineTest: TestSuite::Tester {
+    explicit TimelineTest();
+
+    void statisticsDisabled();
+    void statistics();
+    void statisticsRolling();
+    void statisticsRestart();
+
+    void hitch();
+    void hitchDisabled();
+
+    void frameAllocator();
+};
+
+TimelineTest::TimelineTest() {
+    addTests({&TimelineTest::statisticsDisabled,
+              &TimelineTest::statistics,
+              &TimelineTest::statisticsRolling,
+              &TimelineTest::statisticsRestart,
+
+              &TimelineTest::hitch,
+              &TimelineTest::hitchDisabled,
+
+              &TimelineTest::frameAllocator});
+}
+
+void TimelineTest::statisticsDisabled() {
+    Timeline timeline;
+    CORRADE_COMPARE(timeline.statisticsDuration(), 0);
+
+    timeline.start();
+    timeline.nextFrame();
+    timeline.nextFrame();
+
+    CORRADE_COMPARE(timeline.statisticsFrameCount(), 0);
+    CORRADE_COMPARE(timeline.statistics().max, 0.0f);
+}
+
+void TimelineTest::statistics() {
+    Timeline timeline;
+    timeline.setStatisticsDuration(10);
+    CORRADE_COMPARE(timeline.statisticsDuration(), 10);
+    timeline.start();
+
+    /* Nine short frames and one long */
+    for(std::size_t i = 0; i != 9; ++i) timeline.nextFrame();
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    timeline.nextFrame();
+    const Float longFrame = timeline.previousFrameDuration();
+
+    CORRADE_COMPARE(timeline.statisticsFrameCount(), 10);
+    const Timeline::Statistics s = timeline.statistics();
+    CORRADE_VERIFY(longFrame >= 0.02f);
+    CORRADE_COMPARE(s.max, longFrame);
+    CORRADE_COMPARE(s.percentile99, longFrame);
+    CORRADE_COMPARE(s.percentile95, longFrame);
+    CORRADE_VERIFY(s.median < 0.01f);
+    CORRADE_VERIFY(s.min <= s.median);
+    CORRADE_VERIFY(s.mean >= longFrame/10.0f);
+    CORRADE_VERIFY(s.mean < longFrame);
+}
+
+void TimelineTest::statisticsRolling() {
+    Timeline timeline;
+    timeline.setStatisticsDuration(3);
+    timeline.start();
+
+    /* The long frame falls out of the window */
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    timeline.nextFrame();
+    for(std::size_t i = 0; i != 3; ++i) timeline.nextFrame();
+
+    CORRADE_COMPARE(timeline.statisticsFrameCount(), 3);
+    CORRADE_VERIFY(timeline.statistics().max < 0.01f);
+}
+
+void TimelineTest::statisticsRestart() {
+    Timeline timeline;
+    timeline.setStatisticsDuration(3);
+    timeline.start();
+    timeline.nextFrame();
+    CORRADE_COMPARE(timeline.statisticsFrameCount(), 1);
+
+    timeline.start();
+    CORRADE_COMPARE(timeline.statisticsFrameCount(), 0);
+}
+
+void TimelineTest::hitch() {
+    Timeline timeline;
+    std::vector<Float> hitches;
+    timeline.setHitchThreshold(0.01f)
+        .setHitchCallback([](Float duration, void* state) {
+            static_cast<std::vector<Float>*>(state)->push_back(duration);
+        }, &hitches);
+    CORRADE_COMPARE(timeline.hitchThreshold(), 0.01f);
+    timeline.start();
+
+    timeline.nextFrame();
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    timeline.nextFrame();
+    timeline.nextFrame();
+
+    CORRADE_COMPARE(timeline.hitchCount(), 1);
+    CORRADE_COMPARE(hitches.size(), 1);
+    CORRADE_VERIFY(hitches[0] >= 0.02f);
+
+    /* Restarting resets the count */
+    timeline.start();
+    CORRADE_COMPARE(timeline.hitchCount(), 0);
+}
+
+void TimelineTest::hitchDisabled() {
+    Timeline timeline;
+    timeline.start();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    timeline.nextFrame();
+
+    CORRADE_COMPARE(timeline.hitchCount(), 0);
+}
+
+void TimelineTest::frameAllocator() {
+    FrameAllocator allocator{1024};
+    Timeline timeline;
+    CORRADE_VERIFY(!timeline.frameAllocator());
+
+    timeline.setFrameAllocator(&allocator);
+    CORRADE_COMPARE(timeline.frameAllocator(), &allocator);
+
+    /* Reset on every frame */
+    timeline.start();
+    allocator.allocate(100);
+    timeline.nextFrame();
+    CORRADE_COMPARE(allocator.usedSize(), 0);
+
+    /* Also if the timeline is stopped */
+    timeline.stop();
+    allocator.allocate(100);
+    timeline.nextFrame();
+    CORRADE_COMPARE(allocator.usedSize(), 0);
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::TimelineTest)
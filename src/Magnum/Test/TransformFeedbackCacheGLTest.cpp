@@ -0,0 +1,256 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Framebuffer.h"
+#include "Magnum/Renderbuffer.h"
+#include "Magnum/RenderbufferFormat.h"
+#include "Magnum/Shader.h"
+#include "Magnum/TransformFeedbackCache.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct TransformFeedbackCacheGLTest: AbstractOpenGLTester {
+    explicit TransformFeedbackCacheGLTest();
+
+    void construct();
+    void capture();
+    void captureIndexed();
+    void overflow();
+};
+
+TransformFeedbackCacheGLTest::TransformFeedbackCacheGLTest() {
+    addTests({&TransformFeedbackCacheGLTest::construct,
+              &TransformFeedbackCacheGLTest::capture,
+              &TransformFeedbackCacheGLTest::captureIndexed,
+              &TransformFeedbackCacheGLTest::overflow});
+}
+
+namespace {
+
+constexpr const Vector2 inputData[] = {
+    {0.0f, 0.0f},
+    {-1.0f, 1.0f},
+    {2.0f, 3.0f}
+};
+
+struct XfbShader: AbstractShaderProgram {
+    typedef Attribute<0, Vector2> Input;
+
+    explicit XfbShader();
+};
+
+XfbShader::XfbShader() {
+    #ifndef MAGNUM_TARGET_GLES
+    Shader vert(
+        #ifndef CORRADE_TARGET_APPLE
+        Version::GL300
+        #else
+        Version::GL310
+        #endif
+        , Shader::Type::Vertex);
+    #else
+    Shader vert(Version::GLES300, Shader::Type::Vertex);
+    Shader frag(Version::GLES300, Shader::Type::Fragment);
+    #endif
+    CORRADE_INTERNAL_ASSERT_OUTPUT(vert.addSource(
+        "in mediump vec2 inputData;\n"
+        "out mediump vec2 outputData;\n"
+        "void main() {\n"
+        "    outputData = inputData + vec2(1.0, -1.0);\n"
+        /* Mesa drivers complain that vertex shader doesn't write to
+           gl_Position otherwise */
+        "    gl_Position = vec4(1.0);\n"
+        "}\n").compile());
+    #ifndef MAGNUM_TARGET_GLES
+    attachShader(vert);
+    #else
+    /* ES for some reason needs both vertex and fragment shader */
+    CORRADE_INTERNAL_ASSERT_OUTPUT(frag.addSource("void main() {}\n").compile());
+    attachShaders({vert, frag});
+    #endif
+    bindAttributeLocation(Input::Location, "inputData");
+    setTransformFeedbackOutputs({"outputData"}, TransformFeedbackBufferMode::SeparateAttributes);
+    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+}
+
+}
+
+void TransformFeedbackCacheGLTest::construct() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::transform_feedback2>())
+        CORRADE_SKIP(Extensions::GL::ARB::transform_feedback2::string() + std::string(" is not supported."));
+    #endif
+
+    TransformFeedbackCache cache{TransformFeedback::PrimitiveMode::Triangles, sizeof(Vector2), 12};
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(cache.primitiveMode(), TransformFeedback::PrimitiveMode::Triangles);
+    CORRADE_COMPARE(cache.vertexStride(), sizeof(Vector2));
+    CORRADE_COMPARE(cache.vertexCapacity(), 12);
+    CORRADE_COMPARE(cache.buffer().size(), 12*sizeof(Vector2));
+    CORRADE_COMPARE(cache.mesh().primitive(), MeshPrimitive::Triangles);
+    CORRADE_VERIFY(!cache.isCaptured());
+}
+
+void TransformFeedbackCacheGLTest::capture() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::transform_feedback2>())
+        CORRADE_SKIP(Extensions::GL::ARB::transform_feedback2::string() + std::string(" is not supported."));
+    #endif
+
+    /* Bind some FB to avoid errors on contexts w/o default FB */
+    Renderbuffer color;
+    color.setStorage(RenderbufferFormat::RGBA8, Vector2i{32});
+    Framebuffer fb{{{}, Vector2i{32}}};
+    fb.attachRenderbuffer(Framebuffer::ColorAttachment{0}, color)
+      .bind();
+
+    XfbShader shader;
+
+    Buffer input;
+    input.setData(inputData, BufferUsage::StaticDraw);
+
+    Mesh mesh;
+    mesh.setPrimitive(MeshPrimitive::Points)
+        .addVertexBuffer(input, 0, XfbShader::Input{})
+        .setCount(3);
+
+    TransformFeedbackCache cache{TransformFeedback::PrimitiveMode::Points, sizeof(Vector2), 4};
+    cache.mesh().addVertexBuffer(cache.buffer(), 0, XfbShader::Input{});
+
+    /* Capturing twice replaces the previous contents */
+    cache.capture(shader, mesh);
+    cache.capture(shader, mesh);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(cache.isCaptured());
+    CORRADE_COMPARE(cache.vertexCount(), 3);
+    CORRADE_VERIFY(!cache.hasOverflow());
+
+    Vector2* data = cache.buffer().map<Vector2>(0, 3*sizeof(Vector2), Buffer::MapFlag::Read);
+    CORRADE_COMPARE(data[0], Vector2(1.0f, -1.0f));
+    CORRADE_COMPARE(data[1], Vector2(0.0f, 0.0f));
+    CORRADE_COMPARE(data[2], Vector2(3.0f, 2.0f));
+    cache.buffer().unmap();
+
+    /* Draw the captured mesh into another cache, which applies the
+       transformation one more time */
+    TransformFeedbackCache second{TransformFeedback::PrimitiveMode::Points, sizeof(Vector2), 4};
+    Renderer::enable(Renderer::Feature::RasterizerDiscard);
+    second.transformFeedback().begin(shader, TransformFeedback::PrimitiveMode::Points);
+    cache.draw(shader);
+    second.transformFeedback().end();
+    Renderer::disable(Renderer::Feature::RasterizerDiscard);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    Vector2* secondData = second.buffer().map<Vector2>(0, 3*sizeof(Vector2), Buffer::MapFlag::Read);
+    CORRADE_COMPARE(secondData[0], Vector2(2.0f, -2.0f));
+    CORRADE_COMPARE(secondData[1], Vector2(1.0f, -1.0f));
+    CORRADE_COMPARE(secondData[2], Vector2(4.0f, 1.0f));
+    second.buffer().unmap();
+}
+
+void TransformFeedbackCacheGLTest::captureIndexed() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::transform_feedback2>())
+        CORRADE_SKIP(Extensions::GL::ARB::transform_feedback2::string() + std::string(" is not supported."));
+    #endif
+
+    /* Bind some FB to avoid errors on contexts w/o default FB */
+    Renderbuffer color;
+    color.setStorage(RenderbufferFormat::RGBA8, Vector2i{32});
+    Framebuffer fb{{{}, Vector2i{32}}};
+    fb.attachRenderbuffer(Framebuffer::ColorAttachment{0}, color)
+      .bind();
+
+    XfbShader shader;
+
+    Buffer input;
+    input.setData(inputData, BufferUsage::StaticDraw);
+
+    constexpr UnsignedShort indexData[]{2, 0, 2, 1};
+    Buffer indices{Buffer::TargetHint::ElementArray};
+    indices.setData(indexData, BufferUsage::StaticDraw);
+
+    Mesh mesh;
+    mesh.setPrimitive(MeshPrimitive::Lines)
+        .addVertexBuffer(input, 0, XfbShader::Input{})
+        .setIndexBuffer(indices, 0, Mesh::IndexType::UnsignedShort)
+        .setCount(4);
+
+    TransformFeedbackCache cache{TransformFeedback::PrimitiveMode::Lines, sizeof(Vector2), 8};
+    cache.capture(shader, mesh);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(cache.vertexCount(), 4);
+    CORRADE_VERIFY(!cache.hasOverflow());
+
+    Vector2* data = cache.buffer().map<Vector2>(0, 4*sizeof(Vector2), Buffer::MapFlag::Read);
+    CORRADE_COMPARE(data[0], Vector2(3.0f, 2.0f));
+    CORRADE_COMPARE(data[1], Vector2(1.0f, -1.0f));
+    CORRADE_COMPARE(data[2], Vector2(3.0f, 2.0f));
+    CORRADE_COMPARE(data[3], Vector2(0.0f, 0.0f));
+    cache.buffer().unmap();
+}
+
+void TransformFeedbackCacheGLTest::overflow() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::transform_feedback2>())
+        CORRADE_SKIP(Extensions::GL::ARB::transform_feedback2::string() + std::string(" is not supported."));
+    #endif
+
+    /* Bind some FB to avoid errors on contexts w/o default FB */
+    Renderbuffer color;
+    color.setStorage(RenderbufferFormat::RGBA8, Vector2i{32});
+    Framebuffer fb{{{}, Vector2i{32}}};
+    fb.attachRenderbuffer(Framebuffer::ColorAttachment{0}, color)
+      .bind();
+
+    XfbShader shader;
+
+    Buffer input;
+    input.setData(inputData, BufferUsage::StaticDraw);
+
+    Mesh mesh;
+    mesh.setPrimitive(MeshPrimitive::Points)
+        .addVertexBuffer(input, 0, XfbShader::Input{})
+        .setCount(3);
+
+    /* Only two of the three vertices fit */
+    TransformFeedbackCache cache{TransformFeedback::PrimitiveMode::Points, sizeof(Vector2), 2};
+    cache.capture(shader, mesh);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(cache.vertexCount(), 2);
+    CORRADE_VERIFY(cache.hasOverflow());
+}
+
+}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Test::TransformFeedbackCacheGLTest)
@@ -0,0 +1,115 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/UniformBlock.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Matrix4.h"
+
+namespace Magnum { namespace Test {
+
+struct UniformBlockTest: TestSuite::Tester {
+    explicit UniformBlockTest();
+
+    void offsetScalarVector();
+    void offsetMatrix();
+    void offsetDerived();
+
+    void construct();
+    void set();
+};
+
+UniformBlockTest::UniformBlockTest() {
+    addTests({&UniformBlockTest::offsetScalarVector,
+              &UniformBlockTest::offsetMatrix,
+              &UniformBlockTest::offsetDerived,
+
+              &UniformBlockTest::construct,
+              &UniformBlockTest::set});
+}
+
+void UniformBlockTest::offsetScalarVector() {
+    typedef UniformBlock<Float, Vector3, Float, Vector2, Vector4i, UnsignedInt> Block;
+
+    CORRADE_COMPARE(Block::offset<0>(), 0);
+    CORRADE_COMPARE(Block::offset<1>(), 16);
+    /* Scalar fits right after three-component vector */
+    CORRADE_COMPARE(Block::offset<2>(), 28);
+    CORRADE_COMPARE(Block::offset<3>(), 32);
+    CORRADE_COMPARE(Block::offset<4>(), 48);
+    CORRADE_COMPARE(Block::offset<5>(), 64);
+    CORRADE_COMPARE(std::size_t(Block::Size), 80);
+}
+
+void UniformBlockTest::offsetMatrix() {
+    typedef UniformBlock<Float, Matrix3x3, Matrix2x3, Matrix4, Vector3> Block;
+
+    CORRADE_COMPARE(Block::offset<0>(), 0);
+    /* Matrices are aligned to 16 bytes, each column takes 16 bytes */
+    CORRADE_COMPARE(Block::offset<1>(), 16);
+    CORRADE_COMPARE(Block::offset<2>(), 64);
+    CORRADE_COMPARE(Block::offset<3>(), 96);
+    CORRADE_COMPARE(Block::offset<4>(), 160);
+    CORRADE_COMPARE(std::size_t(Block::Size), 176);
+}
+
+void UniformBlockTest::offsetDerived() {
+    typedef UniformBlock<Color3, Color4, Matrix3, Float> Block;
+
+    CORRADE_COMPARE(Block::offset<0>(), 0);
+    CORRADE_COMPARE(Block::offset<1>(), 16);
+    CORRADE_COMPARE(Block::offset<2>(), 32);
+    CORRADE_COMPARE(Block::offset<3>(), 80);
+    CORRADE_COMPARE(std::size_t(Block::Size), 96);
+}
+
+void UniformBlockTest::construct() {
+    UniformBlock<Vector3, Float> block;
+
+    CORRADE_COMPARE(block.data().size(), 16);
+    for(char c: block.data()) CORRADE_COMPARE(c, 0);
+}
+
+void UniformBlockTest::set() {
+    UniformBlock<Matrix3x3, Float> block;
+    block.set<0>(Matrix3x3{Vector3{1.0f, 2.0f, 3.0f},
+                           Vector3{4.0f, 5.0f, 6.0f},
+                           Vector3{7.0f, 8.0f, 9.0f}})
+         .set<1>(-1.5f);
+
+    const Float* data = reinterpret_cast<const Float*>(block.data().data());
+    CORRADE_COMPARE(data[0], 1.0f);
+    CORRADE_COMPARE(data[2], 3.0f);
+    CORRADE_COMPARE(data[3], 0.0f);
+    CORRADE_COMPARE(data[4], 4.0f);
+    CORRADE_COMPARE(data[10], 9.0f);
+    CORRADE_COMPARE(data[11], 0.0f);
+    CORRADE_COMPARE(data[12], -1.5f);
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::UniformBlockTest)
@@ -23,4 +23,6 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#define POINTCLOUDSTREAMERGLTEST_OUTPUT_DIR "${CMAKE_CURRENT_BINARY_DIR}/PointCloudStreamerGLTestFiles"
 #define SHADERGLTEST_FILES_DIR "${CMAKE_CURRENT_SOURCE_DIR}/ShaderGLTestFiles"
+#define SHADERPROGRAMBINARYCACHEGLTEST_OUTPUT_DIR "${CMAKE_CURRENT_BINARY_DIR}/ShaderProgramBinaryCacheGLTestFiles"
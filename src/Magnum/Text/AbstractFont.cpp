@@ -26,6 +26,7 @@
 #include "AbstractFont.h"
 
 #include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/ArrayView.h>
 #include <Corrade/Utility/Directory.h>
 #include <Corrade/Utility/Unicode.h>
 
@@ -130,6 +131,54 @@ Vector2 AbstractFont::glyphAdvance(const UnsignedInt glyph) {
     return doGlyphAdvance(glyph);
 }
 
+void AbstractFont::glyphIds(const Containers::ArrayView<const char32_t> characters, const Containers::ArrayView<UnsignedInt> glyphs) {
+    CORRADE_ASSERT(isOpened(), "Text::AbstractFont::glyphIds(): no font opened", );
+    CORRADE_ASSERT(characters.size() == glyphs.size(),
+        "Text::AbstractFont::glyphIds(): expected" << characters.size() << "glyphs but got" << glyphs.size(), );
+
+    doGlyphIds(characters, glyphs);
+}
+
+void AbstractFont::doGlyphIds(const Containers::ArrayView<const char32_t> characters, const Containers::ArrayView<UnsignedInt> glyphs) {
+    for(std::size_t i = 0; i != characters.size(); ++i)
+        glyphs[i] = doGlyphId(characters[i]);
+}
+
+void AbstractFont::glyphAdvances(const Containers::ArrayView<const UnsignedInt> glyphs, const Containers::ArrayView<Vector2> advances) {
+    CORRADE_ASSERT(isOpened(), "Text::AbstractFont::glyphAdvances(): no font opened", );
+    CORRADE_ASSERT(glyphs.size() == advances.size(),
+        "Text::AbstractFont::glyphAdvances(): expected" << glyphs.size() << "advances but got" << advances.size(), );
+
+    doGlyphAdvances(glyphs, advances);
+}
+
+void AbstractFont::doGlyphAdvances(const Containers::ArrayView<const UnsignedInt> glyphs, const Containers::ArrayView<Vector2> advances) {
+    for(std::size_t i = 0; i != glyphs.size(); ++i)
+        advances[i] = doGlyphAdvance(glyphs[i]);
+}
+
+Vector2 AbstractFont::kerning(const UnsignedInt left, const UnsignedInt right) {
+    CORRADE_ASSERT(isOpened(), "Text::AbstractFont::kerning(): no font opened", {});
+
+    return doKerning(left, right);
+}
+
+Vector2 AbstractFont::doKerning(UnsignedInt, UnsignedInt) { return {}; }
+
+std::optional<Image2D> AbstractFont::rasterizeGlyph(const UnsignedInt glyph, Vector2i& position) {
+    CORRADE_ASSERT(isOpened(),
+        "Text::AbstractFont::rasterizeGlyph(): no font opened", std::nullopt);
+    CORRADE_ASSERT(features() & Feature::GlyphRasterization,
+        "Text::AbstractFont::rasterizeGlyph(): feature not supported", std::nullopt);
+
+    return doRasterizeGlyph(glyph, position);
+}
+
+std::optional<Image2D> AbstractFont::doRasterizeGlyph(UnsignedInt, Vector2i&) {
+    CORRADE_ASSERT(false, "Text::AbstractFont::rasterizeGlyph(): feature advertised but not implemented", std::nullopt);
+    return std::nullopt;
+}
+
 void AbstractFont::fillGlyphCache(GlyphCache& cache, const std::string& characters) {
     CORRADE_ASSERT(isOpened(),
         "Text::AbstractFont::createGlyphCache(): no font opened", );
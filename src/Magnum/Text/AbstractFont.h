@@ -34,10 +34,12 @@
 #include <tuple>
 #include <Corrade/PluginManager/AbstractPlugin.h>
 
+#include "Magnum/Image.h"
 #include "Magnum/Magnum.h"
 #include "Magnum/Texture.h"
 #include "Magnum/Text/Text.h"
 #include "Magnum/Text/visibility.h"
+#include "MagnumExternal/Optional/optional.hpp"
 
 namespace Magnum { namespace Text {
 
@@ -60,6 +62,10 @@ text rendering later, see @ref GlyphCache for more information. See
 Plugin implements @ref doFeatures(), @ref doClose(), @ref doLayout(), either
 @ref doCreateGlyphCache() or @ref doFillGlyphCache() and one or more of
 `doOpen*()` functions. See also @ref AbstractLayouter for more information.
+If the plugin has no special shaping needs, @ref doLayout() can just return a
+@ref BatchLayouter instance and reimplement @ref doGlyphIds(),
+@ref doGlyphAdvances() and @ref doKerning() where the font can do better than
+the defaults.
 
 You don't need to do most of the redundant sanity checks, these things are
 checked by the implementation:
@@ -98,7 +104,13 @@ class MAGNUM_TEXT_EXPORT AbstractFont: public PluginManager::AbstractPlugin {
              *
              * @see @ref fillGlyphCache(), @ref createGlyphCache()
              */
-            PreparedGlyphCache = 1 << 2
+            PreparedGlyphCache = 1 << 2,
+
+            /**
+             * Rasterizing glyphs to CPU-side images using
+             * @ref rasterizeGlyph()
+             */
+            GlyphRasterization = 1 << 3
         };
 
         /** @brief Set of features supported by this importer */
@@ -209,6 +221,62 @@ class MAGNUM_TEXT_EXPORT AbstractFont: public PluginManager::AbstractPlugin {
          */
         Vector2 glyphAdvance(UnsignedInt glyph);
 
+        /**
+         * @brief Glyph IDs for given characters
+         * @param[in] characters    UTF-32 characters
+         * @param[out] glyphs       Where to put the glyph IDs
+         *
+         * Batch variant of @ref glyphId(), querying the whole text in a
+         * single call. Expects that both views have the same size.
+         * @see @ref glyphAdvances(), @ref BatchLayouter
+         */
+        void glyphIds(Containers::ArrayView<const char32_t> characters, Containers::ArrayView<UnsignedInt> glyphs);
+
+        /**
+         * @brief Glyph advances
+         * @param[in] glyphs        Glyph IDs
+         * @param[out] advances     Where to put the advances
+         *
+         * Batch variant of @ref glyphAdvance(), the advances are scaled to
+         * font size. Expects that both views have the same size.
+         * @see @ref glyphIds(), @ref BatchLayouter
+         */
+        void glyphAdvances(Containers::ArrayView<const UnsignedInt> glyphs, Containers::ArrayView<Vector2> advances);
+
+        /**
+         * @brief Kerning between two glyphs
+         * @param left      Left glyph ID
+         * @param right     Right glyph ID
+         *
+         * Returns offset to add to advance of the @p left glyph when it's
+         * followed by the @p right glyph, scaled to font size. Zero if the
+         * font doesn't have kerning information for given pair.
+         * @note This function is meant to be used only for font observations
+         *      and conversions. For layouting, fill a @ref KerningTable
+         *      with all pairs used by the text instead.
+         */
+        Vector2 kerning(UnsignedInt left, UnsignedInt right);
+
+        /**
+         * @brief Rasterize a glyph
+         * @param[in] glyph         Glyph ID
+         * @param[out] position     Position of the image relative to the
+         *      cursor, in pixels
+         *
+         * Returns single-channel image with @ref PixelType::UnsignedByte and
+         * default @ref PixelStorage, which can be then packed into an atlas
+         * together with other glyphs. The image may have zero size for
+         * glyphs that have nothing to draw, such as space. Returns
+         * `std::nullopt` on failure. Available only if
+         * @ref Feature::GlyphRasterization is supported.
+         *
+         * Unlike @ref fillGlyphCache() this function doesn't need any GL
+         * context. It isn't required to be thread-safe, to rasterize glyphs
+         * in multiple threads, open the font in a separate instance for each
+         * thread.
+         */
+        std::optional<Image2D> rasterizeGlyph(UnsignedInt glyph, Vector2i& position);
+
         /**
          * @brief Fill glyph cache with given character set
          * @param cache         Glyph cache instance
@@ -321,6 +389,29 @@ class MAGNUM_TEXT_EXPORT AbstractFont: public PluginManager::AbstractPlugin {
         /** @brief Implementation for @ref glyphAdvance() */
         virtual Vector2 doGlyphAdvance(UnsignedInt glyph) = 0;
 
+        /**
+         * @brief Implementation for @ref glyphIds()
+         *
+         * Default implementation calls @ref doGlyphId() for each character.
+         * Reimplement if the font can look up the whole text more
+         * efficiently.
+         */
+        virtual void doGlyphIds(Containers::ArrayView<const char32_t> characters, Containers::ArrayView<UnsignedInt> glyphs);
+
+        /**
+         * @brief Implementation for @ref glyphAdvances()
+         *
+         * Default implementation calls @ref doGlyphAdvance() for each glyph.
+         */
+        virtual void doGlyphAdvances(Containers::ArrayView<const UnsignedInt> glyphs, Containers::ArrayView<Vector2> advances);
+
+        /**
+         * @brief Implementation for @ref kerning()
+         *
+         * Default implementation returns zero vector.
+         */
+        virtual Vector2 doKerning(UnsignedInt left, UnsignedInt right);
+
         /**
          * @brief Implementation for @ref fillGlyphCache()
          *
@@ -329,6 +420,9 @@ class MAGNUM_TEXT_EXPORT AbstractFont: public PluginManager::AbstractPlugin {
          */
         virtual void doFillGlyphCache(GlyphCache& cache, const std::u32string& characters);
 
+        /** @brief Implementation for @ref rasterizeGlyph() */
+        virtual std::optional<Image2D> doRasterizeGlyph(UnsignedInt glyph, Vector2i& position);
+
         /** @brief Implementation for @ref createGlyphCache() */
         virtual std::unique_ptr<GlyphCache> doCreateGlyphCache();
 
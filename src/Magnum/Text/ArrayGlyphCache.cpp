@@ -0,0 +1,103 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ArrayGlyphCache.h"
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/TextureFormat.h"
+
+namespace Magnum { namespace Text {
+
+ArrayGlyphCache::ArrayGlyphCache(const TextureFormat internalFormat, const Vector3i& size, const Vector2i& padding): _atlas{size, padding} {
+    initialize(internalFormat);
+}
+
+ArrayGlyphCache::ArrayGlyphCache(const Vector3i& size, const Vector2i& padding): _atlas{size, padding} {
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::texture_rg);
+    #endif
+
+    initialize(TextureFormat::R8);
+}
+
+ArrayGlyphCache::~ArrayGlyphCache() = default;
+
+void ArrayGlyphCache::initialize(const TextureFormat internalFormat) {
+    _texture.setWrapping(Sampler::Wrapping::ClampToEdge)
+        .setMinificationFilter(Sampler::Filter::Linear)
+        .setMagnificationFilter(Sampler::Filter::Linear)
+        .setStorage(1, internalFormat, _atlas.size());
+}
+
+std::tuple<Vector2i, Int, Range2Di> ArrayGlyphCache::operator[](const UnsignedInt glyph) const {
+    if(glyph) {
+        auto found = _glyphs.find(glyph);
+        if(found != _glyphs.end()) return found->second;
+    }
+
+    return _notFound;
+}
+
+std::vector<std::pair<Int, Range2Di>> ArrayGlyphCache::reserve(const std::vector<Vector2i>& sizes) {
+    std::vector<std::pair<Int, Range2Di>> out = _atlas.add(sizes);
+    if(out.empty() && !sizes.empty())
+        Error() << "Text::ArrayGlyphCache::reserve(): cannot fit" << sizes.size()
+                << "glyphs into remaining space of" << _atlas.size() << "cache";
+    return out;
+}
+
+void ArrayGlyphCache::insert(const UnsignedInt glyph, const Vector2i& position, const Int layer, const Range2Di& rectangle) {
+    std::tuple<Vector2i, Int, Range2Di> glyphData{position - padding(), layer, rectangle.padded(padding())};
+
+    /* Overwriting "Not Found" glyph */
+    if(glyph == 0) {
+        _notFound = glyphData;
+        return;
+    }
+
+    /* Inserting new glyph */
+    const bool inserted = _glyphs.emplace(glyph, glyphData).second;
+    CORRADE_INTERNAL_ASSERT(inserted);
+    static_cast<void>(inserted);
+}
+
+bool ArrayGlyphCache::erase(const UnsignedInt glyph) {
+    CORRADE_ASSERT(glyph, "Text::ArrayGlyphCache::erase(): can't erase the \"Not Found\" glyph", false);
+
+    auto found = _glyphs.find(glyph);
+    if(found == _glyphs.end()) return false;
+
+    _atlas.remove(std::get<1>(found->second), std::get<2>(found->second).padded(-padding()));
+    _glyphs.erase(found);
+    return true;
+}
+
+void ArrayGlyphCache::setImage(const Vector3i& offset, const ImageView2D& image) {
+    _texture.setSubImage(0, offset, ImageView3D{image.storage(), image.format(), image.type(), {image.size(), 1}, image.data()});
+}
+
+}}
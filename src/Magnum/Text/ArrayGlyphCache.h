@@ -0,0 +1,200 @@
+#ifndef Magnum_Text_ArrayGlyphCache_h
+#define Magnum_Text_ArrayGlyphCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::Text::ArrayGlyphCache
+ */
+#endif
+
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "Magnum/TextureArray.h"
+#include "Magnum/Text/visibility.h"
+#include "Magnum/TextureTools/Atlas.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum { namespace Text {
+
+/**
+@brief Glyph cache with multiple atlas pages
+
+Like @ref GlyphCache, but backed by a @ref Texture2DArray. Glyphs are packed
+with @ref TextureTools::AtlasArrayPacker, when a layer gets full, new glyphs
+spill into the next one. The texture storage for all layers is allocated
+upfront, so the cache can grow up to the layer count without recreating the
+texture or rasterizing the glyphs already in it, and all pages are bound as a
+single texture.
+
+## Usage
+
+@code
+Text::ArrayGlyphCache cache{{512, 512, 8}, Vector2i{1}};
+
+std::vector<std::pair<Int, Range2Di>> ranges = cache.reserve(glyphSizes);
+for(std::size_t i = 0; i != ranges.size(); ++i) {
+    cache.insert(glyphIds[i], glyphPositions[i], ranges[i].first, ranges[i].second);
+    cache.setImage({ranges[i].second.min(), ranges[i].first}, glyphImages[i]);
+}
+@endcode
+
+Sampling the glyphs needs the layer as a third texture coordinate component,
+so unlike @ref GlyphCache this cache is not usable with @ref Renderer and is
+meant for custom text rendering.
+@requires_gl30 Extension @extension{EXT,texture_array}
+@requires_gles30 Texture arrays are not available in OpenGL ES 2.0.
+@requires_webgl20 Texture arrays are not available in WebGL 1.0.
+*/
+class MAGNUM_TEXT_EXPORT ArrayGlyphCache {
+    public:
+        /**
+         * @brief Constructor
+         * @param internalFormat    Internal texture format
+         * @param size              Layer size and layer count
+         * @param padding           Padding around every glyph
+         */
+        explicit ArrayGlyphCache(TextureFormat internalFormat, const Vector3i& size, const Vector2i& padding = Vector2i());
+
+        /**
+         * @brief Constructor
+         *
+         * Sets internal texture format to red channel only. On desktop OpenGL
+         * requires @extension{ARB,texture_rg} (also part of OpenGL ES 3.0).
+         */
+        explicit ArrayGlyphCache(const Vector3i& size, const Vector2i& padding = Vector2i());
+
+        /** @brief Copying is not allowed */
+        ArrayGlyphCache(const ArrayGlyphCache&) = delete;
+
+        /** @brief Moving is not allowed */
+        ArrayGlyphCache(ArrayGlyphCache&&) = delete;
+
+        ~ArrayGlyphCache();
+
+        /** @brief Copying is not allowed */
+        ArrayGlyphCache& operator=(const ArrayGlyphCache&) = delete;
+
+        /** @brief Moving is not allowed */
+        ArrayGlyphCache& operator=(ArrayGlyphCache&&) = delete;
+
+        /** @brief Layer size and layer count */
+        Vector3i textureSize() const { return _atlas.size(); }
+
+        /** @brief Glyph padding */
+        Vector2i padding() const { return _atlas.padding(); }
+
+        /**
+         * @brief Count of layers containing glyphs
+         *
+         * Layers are used in order, the remaining ones are free for glyphs
+         * reserved later.
+         */
+        Int layerCount() const { return _atlas.layerCount(); }
+
+        /** @brief Count of glyphs in the cache */
+        std::size_t glyphCount() const { return _glyphs.size(); }
+
+        /** @brief Cache texture */
+        Texture2DArray& texture() { return _texture; }
+
+        /**
+         * @brief Parameters of given glyph
+         * @param glyph         Glyph ID
+         *
+         * First tuple element is glyph position relative to point on baseline,
+         * second element is texture layer and third is glyph region in the
+         * layer. Returned values include padding.
+         *
+         * If no glyph is found, glyph `0` is returned, which is by default on
+         * zero position and has zero region in the first layer.
+         * @see @ref GlyphCache::operator[]()
+         */
+        std::tuple<Vector2i, Int, Range2Di> operator[](UnsignedInt glyph) const;
+
+        /**
+         * @brief Layout glyphs with given sizes to the cache
+         *
+         * Returns layers and non-overlapping regions in them to store glyphs.
+         * New layers are used if the glyphs don't fit into the current ones.
+         * If the glyphs don't fit even after using all layers, prints a
+         * message to error output and returns empty vector.
+         *
+         * Glyph @p sizes are expected to be without padding.
+         * @see @ref GlyphCache::reserve()
+         */
+        std::vector<std::pair<Int, Range2Di>> reserve(const std::vector<Vector2i>& sizes);
+
+        /**
+         * @brief Insert glyph to cache
+         * @param glyph         Glyph ID
+         * @param position      Position relative to point on baseline
+         * @param layer         Texture layer
+         * @param rectangle     Region in the texture layer
+         *
+         * You can obtain unused non-overlapping regions with @ref reserve().
+         * You can't overwrite already inserted glyph, however you can reset
+         * glyph `0` to some meaningful value.
+         *
+         * Glyph parameters are expected to be without padding.
+         */
+        void insert(UnsignedInt glyph, const Vector2i& position, Int layer, const Range2Di& rectangle);
+
+        /**
+         * @brief Remove glyph from the cache
+         *
+         * Removes the glyph and makes its region available to @ref reserve()
+         * again. The region is expected to be previously returned from
+         * @ref reserve(). Returns `false` if there is no such glyph. Glyph
+         * `0` can't be removed.
+         */
+        bool erase(UnsignedInt glyph);
+
+        /**
+         * @brief Set cache image
+         *
+         * Uploads image for one or more glyphs to given offset in layer
+         * @cpp offset.z() @ce of the cache texture.
+         */
+        void setImage(const Vector3i& offset, const ImageView2D& image);
+
+    private:
+        void MAGNUM_LOCAL initialize(TextureFormat internalFormat);
+
+        Texture2DArray _texture;
+        TextureTools::AtlasArrayPacker _atlas;
+        std::tuple<Vector2i, Int, Range2Di> _notFound;
+        std::unordered_map<UnsignedInt, std::tuple<Vector2i, Int, Range2Di>> _glyphs;
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
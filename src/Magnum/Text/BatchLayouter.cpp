@@ -0,0 +1,69 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "BatchLayouter.h"
+
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Utility/Unicode.h>
+
+#include "Magnum/Math/Range.h"
+#include "Magnum/Text/GlyphCache.h"
+#include "Magnum/Text/KerningTable.h"
+
+namespace Magnum { namespace Text {
+
+BatchLayouter::BatchLayouter(AbstractFont& font, const GlyphCache& cache, const Float size, const std::string& text, const KerningTable* const kerning): BatchLayouter{font, cache, size, Utility::Unicode::utf32(text), kerning} {}
+
+BatchLayouter::BatchLayouter(AbstractFont& font, const GlyphCache& cache, const Float size, std::u32string&& characters, const KerningTable* const kerning): AbstractLayouter(characters.size()), _cache(cache), _scale{size/font.size()}, _glyphs(characters.size()), _advances(characters.size()) {
+    font.glyphIds({characters.data(), characters.size()}, {_glyphs.data(), _glyphs.size()});
+    font.glyphAdvances({_glyphs.data(), _glyphs.size()}, {_advances.data(), _advances.size()});
+
+    if(kerning && !kerning->isEmpty() && !_glyphs.empty()) {
+        for(std::size_t i = 0; i + 1 < _glyphs.size(); ++i)
+            _advances[i] += (*kerning)(_glyphs[i], _glyphs[i + 1]);
+    }
+
+    /* Scale to text size */
+    for(Vector2& advance: _advances) advance *= _scale;
+}
+
+std::tuple<Range2D, Range2D, Vector2> BatchLayouter::doRenderGlyph(const UnsignedInt i) {
+    /* Position of the texture in the resulting glyph, texture coordinates */
+    Vector2i position;
+    Range2Di rectangle;
+    std::tie(position, rectangle) = _cache[_glyphs[i]];
+
+    /* Normalized texture coordinates */
+    const auto textureCoordinates = Range2D(rectangle).scaled(1.0f/Vector2(_cache.textureSize()));
+
+    /* Quad rectangle, computed from texture rectangle, denormalized to
+       requested text size */
+    const auto quadRectangle = Range2D(Range2Di::fromSize(position, rectangle.size())).scaled(Vector2(_scale));
+
+    return std::make_tuple(quadRectangle, textureCoordinates, _advances[i]);
+}
+
+}}
@@ -0,0 +1,106 @@
+#ifndef Magnum_Text_BatchLayouter_h
+#define Magnum_Text_BatchLayouter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Text::BatchLayouter
+ */
+
+#include <string>
+#include <vector>
+
+#include "Magnum/Text/AbstractFont.h"
+
+namespace Magnum { namespace Text {
+
+/**
+@brief Layouter using batch glyph queries
+
+Generic layouter for fonts that don't need any special shaping. Instead of
+converting the text and querying the font character by character, the text
+is converted to UTF-32 in a single pass and glyph IDs and advances of the
+whole text are fetched with one @ref AbstractFont::glyphIds() and one
+@ref AbstractFont::glyphAdvances() call. Kerning from an optional
+@ref KerningTable is applied to the advances right away, so
+@ref renderGlyph() is just a lookup into the glyph cache and the layout cost
+is linear in the text length.
+
+Font plugins can return it directly from their @ref AbstractFont::doLayout()
+implementation, it can be also used directly:
+@code
+Text::KerningTable kerning;
+// fill the kerning table...
+
+Text::BatchLayouter layouter{*font, cache, 0.15f, log, &kerning};
+Vector2 cursor;
+Range2D rectangle;
+for(UnsignedInt i = 0; i != layouter.glyphCount(); ++i) {
+    Range2D position, textureCoordinates;
+    std::tie(position, textureCoordinates) = layouter.renderGlyph(i, cursor, rectangle);
+    // ...
+}
+@endcode
+*/
+class MAGNUM_TEXT_EXPORT BatchLayouter: public AbstractLayouter {
+    public:
+        /**
+         * @brief Constructor
+         * @param font      Font
+         * @param cache     Glyph cache
+         * @param size      Text size
+         * @param text      UTF-8 text to layout
+         * @param kerning   Kerning table or `nullptr`
+         *
+         * Expects that the font is opened. The font, glyph cache and kerning
+         * table are used only during the construction, the glyph cache has
+         * to stay alive until all glyphs are rendered.
+         */
+        explicit BatchLayouter(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, const KerningTable* kerning = nullptr);
+
+        /** @brief Glyph IDs */
+        const std::vector<UnsignedInt>& glyphs() const { return _glyphs; }
+
+        /**
+         * @brief Glyph advances
+         *
+         * Scaled to text size, with kerning applied.
+         */
+        const std::vector<Vector2>& advances() const { return _advances; }
+
+    private:
+        explicit BatchLayouter(AbstractFont& font, const GlyphCache& cache, Float size, std::u32string&& characters, const KerningTable* kerning);
+
+        std::tuple<Range2D, Range2D, Vector2> MAGNUM_TEXT_LOCAL doRenderGlyph(UnsignedInt i) override;
+
+        const GlyphCache& _cache;
+        Float _scale;
+        std::vector<UnsignedInt> _glyphs;
+        std::vector<Vector2> _advances;
+};
+
+}}
+
+#endif
@@ -28,9 +28,8 @@
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
 #include "Magnum/ImageView.h"
-#ifndef CORRADE_NO_ASSERT
 #include "Magnum/PixelFormat.h"
-#endif
+#include "Magnum/Math/Functions.h"
 #include "Magnum/TextureFormat.h"
 #include "Magnum/TextureTools/DistanceField.h"
 
@@ -46,7 +45,7 @@ DistanceFieldGlyphCache::DistanceFieldGlyphCache(const Vector2i& originalSize, c
     #else
     GlyphCache(TextureFormat::RGB, originalSize, size, Vector2i(radius)),
     #endif
-    scale(Vector2(size)/Vector2(originalSize)), radius(radius)
+    _size{size}, _scale(Vector2(size)/Vector2(originalSize)), _radius(radius)
 {
     #ifndef MAGNUM_TARGET_GLES
     MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::texture_rg);
@@ -57,37 +56,86 @@ DistanceFieldGlyphCache::DistanceFieldGlyphCache(const Vector2i& originalSize, c
     if(!Context::current().isExtensionSupported<Extensions::GL::EXT::texture_rg>())
         Warning() << "Text::DistanceFieldGlyphCache:" << Extensions::GL::EXT::texture_rg::string() << "not supported, using inefficient RGB format for glyph cache texture";
     #endif
+
+    /* Input texture with the original binary image */
+    #if !(defined(MAGNUM_TARGET_GLES) && defined(MAGNUM_TARGET_GLES2))
+    const TextureFormat inputFormat = TextureFormat::R8;
+    #elif !defined(MAGNUM_TARGET_WEBGL)
+    const TextureFormat inputFormat = Context::current().isExtensionSupported<Extensions::GL::EXT::texture_rg>() ?
+        TextureFormat::Red : TextureFormat::Luminance;
+    #else
+    const TextureFormat inputFormat = TextureFormat::Luminance;
+    #endif
+    _input.setWrapping(Sampler::Wrapping::ClampToEdge)
+        .setMinificationFilter(Sampler::Filter::Linear)
+        .setMagnificationFilter(Sampler::Filter::Linear)
+        .setStorage(1, inputFormat, originalSize);
+}
+
+DistanceFieldGlyphCache::~DistanceFieldGlyphCache() = default;
+
+std::vector<Range2Di> DistanceFieldGlyphCache::reserve(const std::vector<Vector2i>& sizes) {
+    std::vector<Range2Di> ranges = GlyphCache::reserve(sizes);
+    _pending.insert(_pending.end(), ranges.begin(), ranges.end());
+    return ranges;
+}
+
+void DistanceFieldGlyphCache::convert(const Range2Di& range) {
+    /* Distances up to radius + 1 are affected by the change */
+    const Vector2i padding{Int(_radius) + 1};
+    const Range2Di padded{Math::max(range.min() - padding, Vector2i{}),
+                          Math::min(range.max() + padding, textureSize())};
+    const Range2Di output{Math::max(Vector2i{Math::floor(Vector2(padded.min())*_scale)}, Vector2i{}),
+                          Math::min(Vector2i{Math::ceil(Vector2(padded.max())*_scale)}, _size)};
+
+    TextureTools::distanceField(_input, texture(), output, _radius, textureSize(), _size);
 }
 
 void DistanceFieldGlyphCache::setImage(const Vector2i& offset, const ImageView2D& image) {
     #if !(defined(MAGNUM_TARGET_GLES) && defined(MAGNUM_TARGET_GLES2))
-    const TextureFormat internalFormat = TextureFormat::R8;
     CORRADE_ASSERT(image.format() == PixelFormat::Red,
         "Text::DistanceFieldGlyphCache::setImage(): expected" << PixelFormat::Red << "but got" << image.format(), );
     #else
-    TextureFormat internalFormat;
     #ifndef MAGNUM_TARGET_WEBGL
-    if(Context::current().isExtensionSupported<Extensions::GL::EXT::texture_rg>()) {
-        internalFormat = TextureFormat::Red;
+    if(Context::current().isExtensionSupported<Extensions::GL::EXT::texture_rg>())
         CORRADE_ASSERT(image.format() == PixelFormat::Red,
             "Text::DistanceFieldGlyphCache::setImage(): expected" << PixelFormat::Red << "but got" << image.format(), );
-    } else
+    else
     #endif
     {
-        internalFormat = TextureFormat::Luminance;
         CORRADE_ASSERT(image.format() == PixelFormat::Luminance,
             "Text::DistanceFieldGlyphCache::setImage(): expected" << PixelFormat::Luminance << "but got" << image.format(), );
     }
     #endif
 
-    Texture2D input;
-    input.setWrapping(Sampler::Wrapping::ClampToEdge)
-        .setMinificationFilter(Sampler::Filter::Linear)
-        .setMagnificationFilter(Sampler::Filter::Linear)
-        .setImage(0, internalFormat, image);
+    /* Convert only the newly reserved regions */
+    const Range2Di imageRange = Range2Di::fromSize(offset, image.size());
+    if(!_pending.empty()) {
+        std::vector<Range2Di> pending;
+        std::swap(pending, _pending);
+
+        #ifdef MAGNUM_TARGET_GLES2
+        _input.setSubImage(0, offset, image);
+        #endif
+        for(const Range2Di& glyph: pending) {
+            const Range2Di range{Math::max(glyph.min(), imageRange.min()),
+                                 Math::min(glyph.max(), imageRange.max())};
+            if(range.sizeX() <= 0 || range.sizeY() <= 0) continue;
+
+            #ifndef MAGNUM_TARGET_GLES2
+            PixelStorage storage = image.storage();
+            if(!storage.rowLength()) storage.setRowLength(image.size().x());
+            storage.setSkip(storage.skip() + Vector3i{range.min() - offset, 0});
+            _input.setSubImage(0, range.min(), ImageView2D{storage, image.format(), image.type(), range.size(), image.data()});
+            #endif
+            convert(range);
+        }
+
+        return;
+    }
 
-    /* Create distance field from input texture */
-    TextureTools::distanceField(input, texture(), Range2Di::fromSize(offset*scale, image.size()*scale), radius, image.size());
+    _input.setSubImage(0, offset, image);
+    convert(imageRange);
 }
 
 void DistanceFieldGlyphCache::setDistanceFieldImage(const Vector2i& offset, const ImageView2D& image) {
@@ -29,6 +29,8 @@
  * @brief Class @ref Magnum::Text::DistanceFieldGlyphCache
  */
 
+#include <vector>
+
 #include "Magnum/Text/GlyphCache.h"
 
 namespace Magnum { namespace Text {
@@ -52,6 +54,11 @@ font->createGlyphCache(cache, "abcdefghijklmnopqrstuvwxyz"
                               "0123456789?!:;,. ");
 @endcode
 
+The original binary image is kept in a texture of the unscaled size, so when
+glyphs are added to the cache later, the distance field is computed only for
+the regions of the new glyphs padded by the radius and the rest of the
+texture is left untouched.
+
 @see @ref TextureTools::distanceField()
 */
 class MAGNUM_TEXT_EXPORT DistanceFieldGlyphCache: public GlyphCache {
@@ -73,11 +80,33 @@ class MAGNUM_TEXT_EXPORT DistanceFieldGlyphCache: public GlyphCache {
          */
         explicit DistanceFieldGlyphCache(const Vector2i& originalSize, const Vector2i& size, UnsignedInt radius);
 
+        ~DistanceFieldGlyphCache();
+
+        /** @brief Distance field computation radius */
+        UnsignedInt radius() const { return _radius; }
+
+        /**
+         * @brief Layout glyphs with given sizes to the cache
+         *
+         * Same as @ref GlyphCache::reserve(), but additionally remembers the
+         * reserved regions so only them are converted in subsequent
+         * @ref setImage() call.
+         */
+        std::vector<Range2Di> reserve(const std::vector<Vector2i>& sizes) override;
+
         /**
          * @brief Set cache image
          *
          * Uploads image for one or more glyphs to given offset in original
-         * cache texture. The texture is then converted to distance field.
+         * cache texture. If glyphs were reserved using @ref reserve() since
+         * the last call, only their regions are uploaded and converted to
+         * distance field, so the font can pass image of the whole cache
+         * without affecting existing glyphs. Otherwise the whole @p image is
+         * uploaded and converted. The converted regions are padded by the
+         * radius, so distances to the new glyphs are updated in the
+         * surroundings as well.
+         * @requires_gles30 In OpenGL ES 2.0 and WebGL 1.0 the whole image is
+         *      uploaded, but still only the reserved regions are converted.
          */
         void setImage(const Vector2i& offset, const ImageView2D& image) override;
 
@@ -90,8 +119,13 @@ class MAGNUM_TEXT_EXPORT DistanceFieldGlyphCache: public GlyphCache {
         void setDistanceFieldImage(const Vector2i& offset, const ImageView2D& image);
 
     private:
-        const Vector2 scale;
-        const UnsignedInt radius;
+        void MAGNUM_TEXT_LOCAL convert(const Range2Di& range);
+
+        const Vector2i _size;
+        const Vector2 _scale;
+        const UnsignedInt _radius;
+        Texture2D _input;
+        std::vector<Range2Di> _pending;
 };
 
 }}
@@ -0,0 +1,147 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DynamicGlyphCache.h"
+
+#include <algorithm>
+#include <tuple>
+#include <Corrade/Utility/Unicode.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Text/AbstractFont.h"
+
+namespace Magnum { namespace Text {
+
+DynamicGlyphCache::DynamicGlyphCache(AbstractFont& font, const TextureFormat internalFormat, const Vector2i& size, const Vector2i& padding): GlyphCache{internalFormat, size, size, padding}, _font(font), _frame{}, _filling{} {}
+
+DynamicGlyphCache::DynamicGlyphCache(AbstractFont& font, const Vector2i& size, const Vector2i& padding): GlyphCache{size, size, padding}, _font(font), _frame{}, _filling{} {}
+
+DynamicGlyphCache::~DynamicGlyphCache() = default;
+
+std::size_t DynamicGlyphCache::prepare(const std::string& text) {
+    /* Mark used glyphs, collect UTF-8 sequences of the missing ones */
+    std::string missing;
+    std::vector<UnsignedInt> missingGlyphs;
+    for(std::size_t i = 0; i < text.size(); ) {
+        const std::size_t begin = i;
+        char32_t character;
+        std::tie(character, i) = Utility::Unicode::nextChar(text, i);
+
+        const UnsignedInt glyph = _font.glyphId(character);
+        if(!glyph) continue;
+
+        auto found = _used.find(glyph);
+        if(found != _used.end()) {
+            found->second = _frame;
+            continue;
+        }
+
+        if(std::find(missingGlyphs.begin(), missingGlyphs.end(), glyph) != missingGlyphs.end())
+            continue;
+
+        missingGlyphs.push_back(glyph);
+        missing.append(text, begin, i - begin);
+    }
+
+    if(missingGlyphs.empty()) return 0;
+
+    /* The font may insert the "Not Found" glyph again, release its old
+       space in that case */
+    const Range2Di notFound = (*this)[0].second;
+
+    _filling = true;
+    _font.fillGlyphCache(*this, missing);
+    _filling = false;
+    _pending.clear();
+
+    const Range2Di newNotFound = (*this)[0].second;
+    if(newNotFound != notFound && notFound.size().product())
+        atlas().remove(notFound.padded(-padding()));
+
+    /* Glyphs that the font failed to insert fall back to the "Not Found"
+       glyph, don't track them */
+    std::size_t count = 0;
+    for(const UnsignedInt glyph: missingGlyphs) {
+        if((*this)[glyph] == (*this)[0]) continue;
+        _used.emplace(glyph, _frame);
+        ++count;
+    }
+
+    return count;
+}
+
+std::vector<Range2Di> DynamicGlyphCache::reserve(const std::vector<Vector2i>& sizes) {
+    std::vector<Range2Di> out;
+    while((out = reserveInternal(sizes)).empty() && !sizes.empty()) {
+        /* Evict all glyphs from the least recently used frame */
+        UnsignedInt oldest = _frame;
+        for(const auto& glyph: _used)
+            oldest = Math::min(oldest, glyph.second);
+
+        if(oldest == _frame) {
+            Error() << "Text::DynamicGlyphCache::reserve(): cannot fit"
+                    << sizes.size() << "glyphs into" << textureSize()
+                    << "cache even after evicting all unused glyphs";
+            return out;
+        }
+
+        for(auto it = _used.begin(); it != _used.end(); ) {
+            if(it->second == oldest) {
+                erase(it->first);
+                it = _used.erase(it);
+            } else ++it;
+        }
+    }
+
+    for(const Range2Di& range: out)
+        _pending.push_back(range.padded(padding()));
+    return out;
+}
+
+void DynamicGlyphCache::setImage(const Vector2i& offset, const ImageView2D& image) {
+    #ifndef MAGNUM_TARGET_GLES2
+    /* Upload only the newly reserved regions */
+    if(_filling) {
+        const Range2Di imageRange = Range2Di::fromSize(offset, image.size());
+        for(const Range2Di& pending: _pending) {
+            const Range2Di range{Math::max(pending.min(), imageRange.min()),
+                                 Math::min(pending.max(), imageRange.max())};
+            if(range.sizeX() <= 0 || range.sizeY() <= 0) continue;
+
+            PixelStorage storage = image.storage();
+            if(!storage.rowLength()) storage.setRowLength(image.size().x());
+            storage.setSkip(storage.skip() + Vector3i{range.min() - offset, 0});
+            GlyphCache::setImage(range.min(), ImageView2D{storage, image.format(), image.type(), range.size(), image.data()});
+        }
+
+        return;
+    }
+    #endif
+
+    GlyphCache::setImage(offset, image);
+}
+
+}}
@@ -0,0 +1,149 @@
+#ifndef Magnum_Text_DynamicGlyphCache_h
+#define Magnum_Text_DynamicGlyphCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Text::DynamicGlyphCache
+ */
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Magnum/Text/GlyphCache.h"
+#include "Magnum/Text/Text.h"
+
+namespace Magnum { namespace Text {
+
+/**
+@brief Dynamic glyph cache
+
+Glyph cache which rasterizes glyphs on demand. Instead of filling the cache
+with a known character set upfront, call @ref prepare() with each text before
+rendering it. Glyphs missing in the cache are rasterized using
+@ref AbstractFont::fillGlyphCache(), packed into free space of the texture
+atlas and only their regions of the texture are uploaded.
+
+If the cache is full, glyphs that weren't used for the longest time are
+evicted. The usage is tracked in frames, glyphs used in any @ref prepare()
+call since the last @ref newFrame() call are never evicted.
+
+## Usage
+
+@code
+Text::AbstractFont* font;
+Text::DynamicGlyphCache cache{*font, Vector2i{512}, Vector2i{1}};
+
+// each frame
+cache.newFrame();
+cache.prepare(text);
+renderer.render(text);
+@endcode
+
+The font is expected to support glyph cache filling, i.e. not to have
+@ref AbstractFont::Feature::PreparedGlyphCache.
+*/
+class MAGNUM_TEXT_EXPORT DynamicGlyphCache: public GlyphCache {
+    public:
+        /**
+         * @brief Constructor
+         * @param font              Font used to rasterize the glyphs
+         * @param internalFormat    Internal texture format
+         * @param size              Glyph cache texture size
+         * @param padding           Padding around every glyph
+         *
+         * The font is expected to stay opened for the whole lifetime of the
+         * cache.
+         */
+        explicit DynamicGlyphCache(AbstractFont& font, TextureFormat internalFormat, const Vector2i& size, const Vector2i& padding = {});
+
+        /**
+         * @brief Constructor
+         *
+         * Sets internal texture format to red channel only, see
+         * @ref GlyphCache::GlyphCache(const Vector2i&, const Vector2i&) for
+         * more information.
+         */
+        explicit DynamicGlyphCache(AbstractFont& font, const Vector2i& size, const Vector2i& padding = {});
+
+        ~DynamicGlyphCache();
+
+        /** @brief Font used to rasterize the glyphs */
+        AbstractFont& font() { return _font; }
+
+        /** @brief Current frame */
+        UnsignedInt frame() const { return _frame; }
+
+        /**
+         * @brief Start a new frame
+         *
+         * Glyphs used only in previous frames can be evicted on subsequent
+         * @ref prepare() calls.
+         */
+        void newFrame() { ++_frame; }
+
+        /**
+         * @brief Prepare glyphs for given text
+         *
+         * Marks glyphs for all characters in UTF-8 @p text as used in current
+         * frame and rasterizes the missing ones. Returns count of newly
+         * rasterized glyphs. If there's not enough space for the glyphs even
+         * after evicting all glyphs not used in the current frame, a message
+         * is printed to error output by @ref reserve().
+         */
+        std::size_t prepare(const std::string& text);
+
+        /**
+         * @brief Layout glyphs with given sizes to the cache
+         *
+         * Same as @ref GlyphCache::reserve(), but evicts least recently used
+         * glyphs if the glyphs don't fit.
+         */
+        std::vector<Range2Di> reserve(const std::vector<Vector2i>& sizes) override;
+
+        /**
+         * @brief Set cache image
+         *
+         * When called from @ref prepare(), only the regions of glyphs
+         * reserved in given call are uploaded from @p image, so the font can
+         * pass image of the whole cache texture without overwriting
+         * existing glyphs. Otherwise the whole image is uploaded.
+         * @requires_gles30 Only whole image is uploaded in OpenGL ES 2.0 and
+         *      WebGL 1.0.
+         */
+        void setImage(const Vector2i& offset, const ImageView2D& image) override;
+
+    private:
+        AbstractFont& _font;
+        UnsignedInt _frame;
+        bool _filling;
+        std::unordered_map<UnsignedInt, UnsignedInt> _used;
+        std::vector<Range2Di> _pending;
+};
+
+}}
+
+#endif
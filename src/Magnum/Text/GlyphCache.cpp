@@ -25,6 +25,8 @@
 
 #include "GlyphCache.h"
 
+#include <algorithm>
+
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
 #include "Magnum/Image.h"
@@ -33,15 +35,23 @@
 
 namespace Magnum { namespace Text {
 
+namespace {
+    struct SparseGlyphCompare {
+        bool operator()(const std::pair<UnsignedInt, std::pair<Vector2i, Range2Di>>& a, const UnsignedInt b) const {
+            return a.first < b;
+        }
+    };
+}
+
 GlyphCache::GlyphCache(const TextureFormat internalFormat, const Vector2i& size, const Vector2i& padding): GlyphCache{internalFormat, size, size, padding} {}
 
-GlyphCache::GlyphCache(const TextureFormat internalFormat, const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): _size(originalSize), _padding(padding) {
+GlyphCache::GlyphCache(const TextureFormat internalFormat, const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): _size(originalSize), _padding(padding), _atlas{originalSize, padding} {
     initialize(internalFormat, size);
 }
 
 GlyphCache::GlyphCache(const Vector2i& size, const Vector2i& padding): GlyphCache{size, size, padding} {}
 
-GlyphCache::GlyphCache(const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): _size(originalSize), _padding(padding) {
+GlyphCache::GlyphCache(const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): _size(originalSize), _padding(padding), _atlas{originalSize, padding} {
     #ifndef MAGNUM_TARGET_GLES
     MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::texture_rg);
     #endif
@@ -72,24 +82,81 @@ void GlyphCache::initialize(const TextureFormat internalFormat, const Vector2i&
         .setStorage(1, internalFormat, size);
 
     /* Default "Not Found" glyph */
-    glyphs.insert({0, {}});
+    _glyphs.emplace_back();
+    _glyphPresent.push_back(true);
+    _glyphCount = 1;
 }
 
 std::vector<Range2Di> GlyphCache::reserve(const std::vector<Vector2i>& sizes) {
-    CORRADE_ASSERT((glyphs.size() == 1 && glyphs.at(0) == std::pair<Vector2i, Range2Di>()),
-        "Text::GlyphCache::reserve(): reserving space in non-empty cache is not yet implemented", {});
-    glyphs.reserve(glyphs.size() + sizes.size());
-    return TextureTools::atlas(_size, sizes, _padding);
+    std::vector<Range2Di> out = reserveInternal(sizes);
+    if(out.empty() && !sizes.empty())
+        Error() << "Text::GlyphCache::reserve(): cannot fit" << sizes.size()
+                << "glyphs into remaining space of" << _size << "cache";
+    return out;
+}
+
+std::vector<Range2Di> GlyphCache::reserveInternal(const std::vector<Vector2i>& sizes) {
+    return _atlas.add(sizes);
+}
+
+bool GlyphCache::erase(const UnsignedInt glyph) {
+    CORRADE_ASSERT(glyph, "Text::GlyphCache::erase(): can't erase the \"Not Found\" glyph", false);
+
+    Range2Di rectangle;
+    if(glyph < _glyphs.size()) {
+        if(!_glyphPresent[glyph]) return false;
+        rectangle = _glyphs[glyph].second;
+        _glyphs[glyph] = {};
+        _glyphPresent[glyph] = false;
+    } else {
+        auto found = std::lower_bound(_sparseGlyphs.begin(), _sparseGlyphs.end(), glyph, SparseGlyphCompare{});
+        if(found == _sparseGlyphs.end() || found->first != glyph) return false;
+        rectangle = found->second.second;
+        _sparseGlyphs.erase(found);
+    }
+
+    _atlas.remove(rectangle.padded(-_padding));
+    --_glyphCount;
+    return true;
+}
+
+std::pair<Vector2i, Range2Di> GlyphCache::sparseGlyph(const UnsignedInt glyph) const {
+    auto found = std::lower_bound(_sparseGlyphs.begin(), _sparseGlyphs.end(), glyph, SparseGlyphCompare{});
+    return found == _sparseGlyphs.end() || found->first != glyph ? _glyphs[0] : found->second;
 }
 
+auto GlyphCache::begin() const -> ConstIterator { return ConstIterator{*this, 0, 0}; }
+
+auto GlyphCache::end() const -> ConstIterator { return ConstIterator{*this, _glyphs.size(), _sparseGlyphs.size()}; }
+
 void GlyphCache::insert(const UnsignedInt glyph, const Vector2i& position, const Range2Di& rectangle) {
     const std::pair<Vector2i, Range2Di> glyphData = {position-_padding, rectangle.padded(_padding)};
 
     /* Overwriting "Not Found" glyph */
-    if(glyph == 0) glyphs[0] = glyphData;
+    if(glyph == 0) {
+        _glyphs[0] = glyphData;
+        return;
+    }
+
+    /* Grow the dense array if the ID isn't too far from the other ones, so
+       it doesn't explode for fonts with few glyphs of large IDs */
+    if(glyph >= _glyphs.size() && glyph < 2*_glyphCount + 256) {
+        _glyphs.resize(glyph + 1);
+        _glyphPresent.resize(glyph + 1);
+    }
 
     /* Inserting new glyph */
-    else CORRADE_INTERNAL_ASSERT_OUTPUT(glyphs.insert({glyph, glyphData}).second);
+    if(glyph < _glyphs.size()) {
+        CORRADE_INTERNAL_ASSERT(!_glyphPresent[glyph]);
+        _glyphs[glyph] = glyphData;
+        _glyphPresent[glyph] = true;
+    } else {
+        auto found = std::lower_bound(_sparseGlyphs.begin(), _sparseGlyphs.end(), glyph, SparseGlyphCompare{});
+        CORRADE_INTERNAL_ASSERT(found == _sparseGlyphs.end() || found->first != glyph);
+        _sparseGlyphs.insert(found, {glyph, glyphData});
+    }
+
+    ++_glyphCount;
 }
 
 void GlyphCache::setImage(const Vector2i& offset, const ImageView2D& image) {
@@ -97,4 +164,24 @@ void GlyphCache::setImage(const Vector2i& offset, const ImageView2D& image) {
     _texture.setSubImage(0, offset, image);
 }
 
+GlyphCache::ConstIterator::ConstIterator(const GlyphCache& cache, const std::size_t dense, const std::size_t sparse): _cache{&cache}, _dense{dense}, _sparse{sparse} {
+    /* Skip to the first present glyph */
+    while(_dense != _cache->_glyphs.size() && !_cache->_glyphPresent[_dense])
+        ++_dense;
+}
+
+auto GlyphCache::ConstIterator::operator*() const -> std::pair<UnsignedInt, std::pair<Vector2i, Range2Di>> {
+    if(_dense != _cache->_glyphs.size())
+        return {UnsignedInt(_dense), _cache->_glyphs[_dense]};
+    return _cache->_sparseGlyphs[_sparse];
+}
+
+auto GlyphCache::ConstIterator::operator++() -> ConstIterator& {
+    if(_dense != _cache->_glyphs.size()) {
+        do ++_dense;
+        while(_dense != _cache->_glyphs.size() && !_cache->_glyphPresent[_dense]);
+    } else ++_sparse;
+    return *this;
+}
+
 }}
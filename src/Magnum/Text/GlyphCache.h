@@ -29,12 +29,13 @@
  * @brief Class @ref Magnum::Text::GlyphCache
  */
 
+#include <iterator>
 #include <vector>
-#include <unordered_map>
 
 #include "Magnum/Math/Range.h"
 #include "Magnum/Texture.h"
 #include "Magnum/Text/visibility.h"
+#include "Magnum/TextureTools/Atlas.h"
 
 namespace Magnum { namespace Text {
 
@@ -55,13 +56,16 @@ font->createGlyphCache(cache, "abcdefghijklmnopqrstuvwxyz"
                               "0123456789?!:;,. ");
 @endcode
 
-See @ref Renderer for information about text rendering.
+See @ref Renderer for information about text rendering. For rasterizing
+glyphs on demand use @ref DynamicGlyphCache.
 @todo Some way for Font to negotiate or check internal texture format
 @todo Default glyph 0 with rect 0 0 0 0 will result in negative dimensions when
     nonzero padding is removed
 */
 class MAGNUM_TEXT_EXPORT GlyphCache {
     public:
+        class ConstIterator;
+
         /**
          * @brief Constructor
          * @param internalFormat    Internal texture format
@@ -112,7 +116,7 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
         Vector2i padding() const { return _padding; }
 
         /** @brief Count of glyphs in the cache */
-        std::size_t glyphCount() const { return glyphs.size(); }
+        std::size_t glyphCount() const { return _glyphCount; }
 
         /** @brief Cache texture */
         Texture2D& texture() { return _texture; }
@@ -132,35 +136,38 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
          * @see @ref padding()
          */
         std::pair<Vector2i, Range2Di> operator[](UnsignedInt glyph) const {
-            auto it = glyphs.find(glyph);
-            return it == glyphs.end() ? glyphs.at(0) : it->second;
+            /* Glyph IDs are usually small and dense, so they're stored in an
+               array directly, with rare large IDs in a sorted vector */
+            if(glyph < _glyphs.size())
+                return _glyphs[_glyphPresent[glyph] ? glyph : 0];
+            return sparseGlyph(glyph);
         }
 
-        /** @brief Iterator access to cache data */
-        std::unordered_map<UnsignedInt, std::pair<Vector2i, Range2Di>>::const_iterator begin() const {
-            return glyphs.begin();
-        }
+        /**
+         * @brief Iterator access to cache data
+         *
+         * The iterator dereferences to a pair of glyph ID and glyph
+         * parameters, which are the same as returned by @ref operator[]().
+         * Glyphs are iterated in ascending ID order.
+         */
+        ConstIterator begin() const;
 
         /** @brief Iterator access to cache data */
-        std::unordered_map<UnsignedInt, std::pair<Vector2i, Range2Di>>::const_iterator end() const {
-            return glyphs.end();
-        }
+        ConstIterator end() const;
 
         /**
          * @brief Layout glyphs with given sizes to the cache
          *
          * Returns non-overlapping regions in cache texture to store glyphs.
-         * The reserved space is reused on next call to @ref reserve() if no
-         * glyph was stored there, use @ref insert() to store actual glyph on
-         * given position and @ref setImage() to upload glyph image.
+         * The regions are packed into space not yet reserved by previous
+         * calls, use @ref insert() to store actual glyph on given position
+         * and @ref setImage() to upload glyph image. If the glyphs don't fit,
+         * prints a message to error output and returns empty vector.
          *
          * Glyph @p sizes are expected to be without padding.
-         *
-         * @attention Cache size must be large enough to contain all rendered
-         *      glyphs.
-         * @see @ref padding()
+         * @see @ref padding(), @ref TextureTools::AtlasPacker
          */
-        std::vector<Range2Di> reserve(const std::vector<Vector2i>& sizes);
+        virtual std::vector<Range2Di> reserve(const std::vector<Vector2i>& sizes);
 
         /**
          * @brief Insert glyph to cache
@@ -187,13 +194,91 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
          */
         virtual void setImage(const Vector2i& offset, const ImageView2D& image);
 
+    protected:
+        /**
+         * @brief Reserve space without printing an error
+         *
+         * Same as the base @ref reserve() implementation, but silently
+         * returns empty vector if the glyphs don't fit.
+         */
+        std::vector<Range2Di> reserveInternal(const std::vector<Vector2i>& sizes);
+
+        /**
+         * @brief Remove glyph from the cache
+         *
+         * Removes the glyph and makes its region in the texture atlas
+         * available to @ref reserve() again. The region is expected to be
+         * previously returned from @ref reserve(). Returns `false` if there
+         * is no such glyph. Glyph `0` can't be removed.
+         */
+        bool erase(UnsignedInt glyph);
+
+        /** @brief Texture atlas packer used by @ref reserve() */
+        TextureTools::AtlasPacker& atlas() { return _atlas; }
+
     private:
         void MAGNUM_LOCAL initialize(TextureFormat internalFormat, const Vector2i& size);
+        std::pair<Vector2i, Range2Di> sparseGlyph(UnsignedInt glyph) const;
 
         Vector2i _size, _padding;
         Texture2D _texture;
+        TextureTools::AtlasPacker _atlas;
+
+        std::vector<std::pair<Vector2i, Range2Di>> _glyphs;
+        std::vector<bool> _glyphPresent;
+        std::vector<std::pair<UnsignedInt, std::pair<Vector2i, Range2Di>>> _sparseGlyphs;
+        std::size_t _glyphCount;
+};
+
+/**
+@brief Glyph cache iterator
+
+@see @ref GlyphCache::begin(), @ref GlyphCache::end()
+*/
+class MAGNUM_TEXT_EXPORT GlyphCache::ConstIterator {
+    friend GlyphCache;
+
+    public:
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        typedef std::forward_iterator_tag iterator_category;
+        typedef std::pair<UnsignedInt, std::pair<Vector2i, Range2Di>> value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const value_type* pointer;
+        typedef value_type reference;
+        #endif
+
+        /**
+         * @brief Glyph ID and its parameters
+         *
+         * Returned by value, as the glyph ID isn't stored for most glyphs.
+         */
+        std::pair<UnsignedInt, std::pair<Vector2i, Range2Di>> operator*() const;
+
+        /** @brief Advance to next glyph */
+        ConstIterator& operator++();
+
+        /** @brief Advance to next glyph */
+        ConstIterator operator++(int) {
+            ConstIterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        /** @brief Equality comparison */
+        bool operator==(const ConstIterator& other) const {
+            return _dense == other._dense && _sparse == other._sparse;
+        }
+
+        /** @brief Non-equality comparison */
+        bool operator!=(const ConstIterator& other) const {
+            return !operator==(other);
+        }
+
+    private:
+        explicit ConstIterator(const GlyphCache& cache, std::size_t dense, std::size_t sparse);
 
-        std::unordered_map<UnsignedInt, std::pair<Vector2i, Range2Di>> glyphs;
+        const GlyphCache* _cache;
+        std::size_t _dense, _sparse;
 };
 
 }}
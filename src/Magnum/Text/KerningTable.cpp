@@ -0,0 +1,89 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "KerningTable.h"
+
+#include <algorithm>
+
+#include "Magnum/Text/AbstractFont.h"
+
+namespace Magnum { namespace Text {
+
+namespace {
+    inline UnsignedLong pairKey(const UnsignedInt left, const UnsignedInt right) {
+        return UnsignedLong(left) << 32 | right;
+    }
+
+    inline bool keyLess(const std::pair<UnsignedLong, Vector2>& a, const UnsignedLong b) {
+        return a.first < b;
+    }
+}
+
+KerningTable::KerningTable() = default;
+
+KerningTable& KerningTable::add(const UnsignedInt left, const UnsignedInt right, const Vector2& offset) {
+    const UnsignedLong key = pairKey(left, right);
+    const auto found = std::lower_bound(_pairs.begin(), _pairs.end(), key, keyLess);
+
+    if(found != _pairs.end() && found->first == key) {
+        if(offset.isZero()) _pairs.erase(found);
+        else found->second = offset;
+    } else if(!offset.isZero()) _pairs.insert(found, {key, offset});
+
+    return *this;
+}
+
+KerningTable& KerningTable::fill(AbstractFont& font, const Containers::ArrayView<const UnsignedInt> glyphs) {
+    std::vector<UnsignedInt> unique{glyphs.begin(), glyphs.end()};
+    std::sort(unique.begin(), unique.end());
+    unique.erase(std::unique(unique.begin(), unique.end()), unique.end());
+
+    /* Query everything first and sort once at the end instead of inserting
+       into the middle of the array for each pair */
+    std::vector<std::pair<UnsignedLong, Vector2>> pairs;
+    for(const UnsignedInt left: unique) for(const UnsignedInt right: unique) {
+        const Vector2 offset = font.kerning(left, right);
+        if(!offset.isZero()) pairs.emplace_back(pairKey(left, right), offset);
+    }
+
+    /* Merge with existing pairs, the new ones win */
+    pairs.insert(pairs.end(), _pairs.begin(), _pairs.end());
+    std::stable_sort(pairs.begin(), pairs.end(),
+        [](const std::pair<UnsignedLong, Vector2>& a, const std::pair<UnsignedLong, Vector2>& b) { return a.first < b.first; });
+    pairs.erase(std::unique(pairs.begin(), pairs.end(),
+        [](const std::pair<UnsignedLong, Vector2>& a, const std::pair<UnsignedLong, Vector2>& b) { return a.first == b.first; }), pairs.end());
+
+    _pairs = std::move(pairs);
+    return *this;
+}
+
+Vector2 KerningTable::operator()(const UnsignedInt left, const UnsignedInt right) const {
+    const UnsignedLong key = pairKey(left, right);
+    const auto found = std::lower_bound(_pairs.begin(), _pairs.end(), key, keyLess);
+    return found != _pairs.end() && found->first == key ? found->second : Vector2{};
+}
+
+}}
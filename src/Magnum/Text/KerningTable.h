@@ -0,0 +1,115 @@
+#ifndef Magnum_Text_KerningTable_h
+#define Magnum_Text_KerningTable_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Text::KerningTable
+ */
+
+#include <utility>
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/Text/Text.h"
+#include "Magnum/Text/visibility.h"
+
+namespace Magnum { namespace Text {
+
+/**
+@brief Kerning pair table
+
+Kerning offsets for pairs of glyphs, stored in a sorted contiguous array so
+the lookup during layouting is a binary search over a few cache lines instead
+of a virtual call into the font plugin for every pair of characters. Fill it
+once for the glyphs the text uses and pass it to @ref BatchLayouter:
+@code
+const std::u32string characters = Utility::Unicode::utf32(charset);
+std::vector<UnsignedInt> glyphs(characters.size());
+font->glyphIds({characters.data(), characters.size()}, {glyphs.data(), glyphs.size()});
+
+Text::KerningTable kerning;
+kerning.fill(*font, {glyphs.data(), glyphs.size()});
+
+Text::BatchLayouter layouter{*font, cache, 0.15f, text, &kerning};
+@endcode
+
+The offsets are in font units, i.e. scaled to @ref AbstractFont::size(), the
+same as @ref AbstractFont::glyphAdvance().
+*/
+class MAGNUM_TEXT_EXPORT KerningTable {
+    public:
+        /** @brief Constructor */
+        explicit KerningTable();
+
+        /** @brief Count of kerning pairs */
+        std::size_t size() const { return _pairs.size(); }
+
+        /** @brief Whether the table is empty */
+        bool isEmpty() const { return _pairs.empty(); }
+
+        /**
+         * @brief Add kerning pair
+         * @param left      Left glyph ID
+         * @param right     Right glyph ID
+         * @param offset    Offset to add to advance of the left glyph
+         * @return Reference to self (for method chaining)
+         *
+         * Replaces existing offset for the same pair. Zero offsets are not
+         * stored.
+         */
+        KerningTable& add(UnsignedInt left, UnsignedInt right, const Vector2& offset);
+
+        /**
+         * @brief Fill the table from a font
+         * @return Reference to self (for method chaining)
+         *
+         * Queries @ref AbstractFont::kerning() for all pairs of given glyphs,
+         * duplicate glyph IDs are skipped. The count of queries is quadratic
+         * with count of unique glyphs, so fill the table once for the
+         * character set and reuse it for all texts.
+         */
+        KerningTable& fill(AbstractFont& font, Containers::ArrayView<const UnsignedInt> glyphs);
+
+        /**
+         * @brief Kerning offset for given pair
+         *
+         * Returns zero vector if the pair is not in the table.
+         */
+        Vector2 operator()(UnsignedInt left, UnsignedInt right) const;
+
+        /** @brief Remove all pairs */
+        void clear() { _pairs.clear(); }
+
+    private:
+        /* Sorted by left glyph in upper bits and right glyph in lower bits */
+        std::vector<std::pair<UnsignedLong, Vector2>> _pairs;
+};
+
+}}
+
+#endif
@@ -0,0 +1,95 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "LayoutCache.h"
+
+#include <cstring>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Text/Alignment.h"
+
+namespace Magnum { namespace Text {
+
+bool LayoutCache::Key::operator==(const Key& other) const {
+    return font == other.font && cache == other.cache && size == other.size && alignment == other.alignment && text == other.text;
+}
+
+std::size_t LayoutCache::KeyHash::operator()(const Key& key) const {
+    UnsignedInt size;
+    std::memcpy(&size, &key.size, sizeof(Float));
+
+    /* Boost-like hash combining */
+    std::size_t hash = std::hash<std::string>{}(key.text);
+    for(const std::size_t value: {std::size_t(key.font), std::size_t(key.cache), std::size_t(size), std::size_t(key.alignment)})
+        hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+LayoutCache::LayoutCache(const std::size_t capacity): _capacity{capacity}, _hits{}, _misses{} {
+    CORRADE_ASSERT(capacity, "Text::LayoutCache: capacity can't be zero", );
+}
+
+LayoutCache::~LayoutCache() = default;
+
+auto LayoutCache::find(const AbstractFont& font, const GlyphCache& cache, const Float size, const Alignment alignment, const std::string& text) -> const Run* {
+    const auto found = _lookup.find(Key{&font, &cache, size, alignment, text});
+    if(found == _lookup.end()) {
+        ++_misses;
+        return nullptr;
+    }
+
+    ++_hits;
+    _runs.splice(_runs.begin(), _runs, found->second);
+    return &found->second->second;
+}
+
+auto LayoutCache::insert(const AbstractFont& font, const GlyphCache& cache, const Float size, const Alignment alignment, const std::string& text, Run run) -> const Run& {
+    Key key{&font, &cache, size, alignment, text};
+
+    /* Replace existing run */
+    const auto found = _lookup.find(key);
+    if(found != _lookup.end()) {
+        found->second->second = std::move(run);
+        _runs.splice(_runs.begin(), _runs, found->second);
+        return found->second->second;
+    }
+
+    /* Discard least recently used run if full */
+    if(_runs.size() == _capacity) {
+        _lookup.erase(_runs.back().first);
+        _runs.pop_back();
+    }
+
+    _runs.emplace_front(key, std::move(run));
+    _lookup.emplace(std::move(key), _runs.begin());
+    return _runs.front().second;
+}
+
+void LayoutCache::clear() {
+    _lookup.clear();
+    _runs.clear();
+}
+
+}}
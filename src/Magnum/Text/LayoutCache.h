@@ -0,0 +1,153 @@
+#ifndef Magnum_Text_LayoutCache_h
+#define Magnum_Text_LayoutCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Text::LayoutCache
+ */
+
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Text/Text.h"
+#include "Magnum/Text/visibility.h"
+
+namespace Magnum { namespace Text {
+
+/**
+@brief Layout cache
+
+Keeps laid-out glyph runs of recently rendered texts, so strings that are
+rendered repeatedly (numbers, units, menu entries) don't need to go through
+@ref AbstractFont::layout() again. The runs are keyed by font, glyph cache,
+size, alignment and the text itself, least recently used runs are discarded
+when the cache is full.
+
+Pass the cache to @ref AbstractRenderer::render(), @ref Renderer::render()
+or set it on a renderer instance using @ref AbstractRenderer::setLayoutCache()
+or @ref AbstractBatchRenderer::setLayoutCache():
+@code
+Text::LayoutCache layoutCache{512};
+
+Text::Renderer2D renderer(*font, cache, 0.15f);
+renderer.setLayoutCache(&layoutCache);
+renderer.reserve(32, BufferUsage::DynamicDraw, BufferUsage::StaticDraw);
+@endcode
+
+The cached runs contain texture coordinates from the glyph cache, call
+@ref clear() after the glyph cache contents change (e.g. on
+@ref DynamicGlyphCache::newFrame() that evicted some glyphs) or after the
+font was closed and reopened. The cache can be shared among any number of
+fonts and renderers.
+*/
+class MAGNUM_TEXT_EXPORT LayoutCache {
+    public:
+        /**
+         * @brief Laid-out glyph run
+         *
+         * Interleaved position and texture coordinates, four vertices for
+         * each glyph, and rectangle spanning the text.
+         */
+        typedef std::pair<std::vector<Vector2>, Range2D> Run;
+
+        /**
+         * @brief Constructor
+         * @param capacity  Max count of cached runs
+         */
+        explicit LayoutCache(std::size_t capacity = 256);
+
+        /** @brief Copying is not allowed */
+        LayoutCache(const LayoutCache&) = delete;
+
+        /** @brief Copying is not allowed */
+        LayoutCache& operator=(const LayoutCache&) = delete;
+
+        ~LayoutCache();
+
+        /** @brief Max count of cached runs */
+        std::size_t capacity() const { return _capacity; }
+
+        /** @brief Count of cached runs */
+        std::size_t size() const { return _runs.size(); }
+
+        /** @brief Count of successful lookups */
+        std::size_t hits() const { return _hits; }
+
+        /** @brief Count of failed lookups */
+        std::size_t misses() const { return _misses; }
+
+        /**
+         * @brief Find cached run
+         *
+         * If found, marks the run as most recently used and returns pointer
+         * to it, otherwise returns `nullptr`. The pointer is valid until next
+         * call to @ref insert() or @ref clear().
+         */
+        const Run* find(const AbstractFont& font, const GlyphCache& cache, Float size, Alignment alignment, const std::string& text);
+
+        /**
+         * @brief Insert run
+         *
+         * Replaces existing run with the same key. If the cache is full,
+         * least recently used run is discarded. Returns reference to the
+         * inserted run, valid until next call to @ref insert() or
+         * @ref clear().
+         */
+        const Run& insert(const AbstractFont& font, const GlyphCache& cache, Float size, Alignment alignment, const std::string& text, Run run);
+
+        /** @brief Discard all cached runs */
+        void clear();
+
+    private:
+        struct Key {
+            const AbstractFont* font;
+            const GlyphCache* cache;
+            Float size;
+            Alignment alignment;
+            std::string text;
+
+            bool operator==(const Key& other) const;
+        };
+
+        struct KeyHash {
+            std::size_t operator()(const Key& key) const;
+        };
+
+        /* Most recently used in front */
+        typedef std::list<std::pair<Key, Run>> Runs;
+
+        std::size_t _capacity, _hits, _misses;
+        Runs _runs;
+        std::unordered_map<Key, Runs::iterator, KeyHash> _lookup;
+};
+
+}}
+
+#endif
@@ -25,12 +25,15 @@
 
 #include "Renderer.h"
 
+#include <algorithm>
+
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
 #include "Magnum/Mesh.h"
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Shaders/AbstractVector.h"
 #include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/LayoutCache.h"
 
 namespace Magnum { namespace Text {
 
@@ -171,6 +174,25 @@ std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& fo
     return std::make_tuple(std::move(vertices), rectangle);
 }
 
+std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& font, const GlyphCache& cache, const Float size, const std::string& text, const Alignment alignment, LayoutCache* const layoutCache) {
+    if(!layoutCache) return renderVerticesInternal(font, cache, size, text, alignment);
+
+    /* Lay out and remember the text if not already cached */
+    const LayoutCache::Run* run = layoutCache->find(font, cache, size, alignment, text);
+    if(!run) {
+        std::vector<Vertex> vertices;
+        Range2D rectangle;
+        std::tie(vertices, rectangle) = renderVerticesInternal(font, cache, size, text, alignment);
+
+        std::vector<Vector2> data(vertices.size()*2);
+        std::copy(vertices.begin(), vertices.end(), reinterpret_cast<Vertex*>(data.data()));
+        run = &layoutCache->insert(font, cache, size, alignment, text, {std::move(data), rectangle});
+    }
+
+    const Vertex* const vertices = reinterpret_cast<const Vertex*>(run->first.data());
+    return std::make_tuple(std::vector<Vertex>(vertices, vertices + run->first.size()/2), run->second);
+}
+
 std::pair<Containers::Array<char>, Mesh::IndexType> renderIndicesInternal(const UnsignedInt glyphCount) {
     const UnsignedInt vertexCount = glyphCount*4;
     const UnsignedInt indexCount = glyphCount*6;
@@ -194,11 +216,11 @@ std::pair<Containers::Array<char>, Mesh::IndexType> renderIndicesInternal(const
     return {std::move(indices), indexType};
 }
 
-std::tuple<Mesh, Range2D> renderInternal(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Buffer& vertexBuffer, Buffer& indexBuffer, BufferUsage usage, Alignment alignment) {
+std::tuple<Mesh, Range2D> renderInternal(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Buffer& vertexBuffer, Buffer& indexBuffer, BufferUsage usage, Alignment alignment, LayoutCache* const layoutCache) {
     /* Render vertices and upload them */
     std::vector<Vertex> vertices;
     Range2D rectangle;
-    std::tie(vertices, rectangle) = renderVerticesInternal(font, cache, size, text, alignment);
+    std::tie(vertices, rectangle) = renderVerticesInternal(font, cache, size, text, alignment, layoutCache);
     vertexBuffer.setData(vertices, usage);
 
     const UnsignedInt glyphCount = vertices.size()/4;
@@ -222,11 +244,11 @@ std::tuple<Mesh, Range2D> renderInternal(AbstractFont& font, const GlyphCache& c
 
 }
 
-std::tuple<std::vector<Vector2>, std::vector<Vector2>, std::vector<UnsignedInt>, Range2D> AbstractRenderer::render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Alignment alignment) {
+std::tuple<std::vector<Vector2>, std::vector<Vector2>, std::vector<UnsignedInt>, Range2D> AbstractRenderer::render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Alignment alignment, LayoutCache* const layoutCache) {
     /* Render vertices */
     std::vector<Vertex> vertices;
     Range2D rectangle;
-    std::tie(vertices, rectangle) = renderVerticesInternal(font, cache, size, text, alignment);
+    std::tie(vertices, rectangle) = renderVerticesInternal(font, cache, size, text, alignment, layoutCache);
 
     /* Deinterleave the vertices */
     std::vector<Vector2> positions, textureCoordinates;
@@ -245,9 +267,9 @@ std::tuple<std::vector<Vector2>, std::vector<Vector2>, std::vector<UnsignedInt>,
     return std::make_tuple(std::move(positions), std::move(textureCoordinates), std::move(indices), rectangle);
 }
 
-template<UnsignedInt dimensions> std::tuple<Mesh, Range2D> Renderer<dimensions>::render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Buffer& vertexBuffer, Buffer& indexBuffer, BufferUsage usage, Alignment alignment) {
+template<UnsignedInt dimensions> std::tuple<Mesh, Range2D> Renderer<dimensions>::render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Buffer& vertexBuffer, Buffer& indexBuffer, BufferUsage usage, Alignment alignment, LayoutCache* const layoutCache) {
     /* Finalize mesh configuration and return the result */
-    auto r = renderInternal(font, cache, size, text, vertexBuffer, indexBuffer, usage, alignment);
+    auto r = renderInternal(font, cache, size, text, vertexBuffer, indexBuffer, usage, alignment, layoutCache);
     Mesh& mesh = std::get<0>(r);
     mesh.addVertexBuffer(vertexBuffer, 0,
             typename Shaders::AbstractVector<dimensions>::Position(
@@ -302,7 +324,7 @@ void AbstractRenderer::bufferUnmapImplementationDefault(Buffer& buffer)
     #endif
 }
 
-AbstractRenderer::AbstractRenderer(AbstractFont& font, const GlyphCache& cache, const Float size, const Alignment alignment): _vertexBuffer{Buffer::TargetHint::Array}, _indexBuffer{Buffer::TargetHint::ElementArray}, font(font), cache(cache), size(size), _alignment(alignment), _capacity(0) {
+AbstractRenderer::AbstractRenderer(AbstractFont& font, const GlyphCache& cache, const Float size, const Alignment alignment): _vertexBuffer{Buffer::TargetHint::Array}, _indexBuffer{Buffer::TargetHint::ElementArray}, font(font), cache(cache), size(size), _alignment(alignment), _capacity(0), _layoutCache{} {
     #ifndef MAGNUM_TARGET_GLES
     MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::map_buffer_range);
     #elif defined(MAGNUM_TARGET_GLES2) && !defined(CORRADE_TARGET_EMSCRIPTEN)
@@ -376,7 +398,7 @@ void AbstractRenderer::render(const std::string& text) {
     /* Render vertex data */
     std::vector<Vertex> vertexData;
     _rectangle = {};
-    std::tie(vertexData, _rectangle) = renderVerticesInternal(font, cache, size, text, _alignment);
+    std::tie(vertexData, _rectangle) = renderVerticesInternal(font, cache, size, text, _alignment, _layoutCache);
 
     const UnsignedInt glyphCount = vertexData.size()/4;
     const UnsignedInt vertexCount = glyphCount*4;
@@ -396,9 +418,267 @@ void AbstractRenderer::render(const std::string& text) {
     _mesh.setCount(indexCount);
 }
 
+AbstractBatchRenderer::AbstractBatchRenderer(AbstractFont& font, const GlyphCache& cache, const Float size, const BufferUsage usage, const Alignment alignment): _vertexBuffer{Buffer::TargetHint::Array}, _indexBuffer{Buffer::TargetHint::ElementArray}, _font(font), _cache(cache), _size{size}, _usage{usage}, _alignment{alignment}, _capacity{}, _uploadedCapacity{}, _layoutCache{} {
+    /* Vertex buffer configuration depends on dimension count, done in
+       subclass, index buffer is set on first update() */
+    _mesh.setPrimitive(MeshPrimitive::Triangles)
+        .setCount(0);
+}
+
+AbstractBatchRenderer::~AbstractBatchRenderer() = default;
+
+template<UnsignedInt dimensions> BatchRenderer<dimensions>::BatchRenderer(AbstractFont& font, const GlyphCache& cache, const Float size, const BufferUsage usage, const Alignment alignment): AbstractBatchRenderer(font, cache, size, usage, alignment) {
+    _mesh.addVertexBuffer(_vertexBuffer, 0,
+            typename Shaders::AbstractVector<dimensions>::Position(Shaders::AbstractVector<dimensions>::Position::Components::Two),
+            typename Shaders::AbstractVector<dimensions>::TextureCoordinates());
+}
+
+UnsignedInt AbstractBatchRenderer::add(const std::string& text, const Vector2& position, const UnsignedInt capacity) {
+    const UnsignedInt id = _texts.size();
+    _texts.push_back({text, position, {}, _capacity, 0});
+    layout(id);
+
+    /* Ensure the capacity is not smaller than requested in case the layout
+       didn't need that much */
+    Text& t = _texts[id];
+    if(t.capacity < capacity) {
+        _vertices.resize(_vertices.size() + (capacity - t.capacity)*8);
+        _capacity += capacity - t.capacity;
+        t.capacity = capacity;
+    }
+
+    return id;
+}
+
+void AbstractBatchRenderer::setText(const UnsignedInt id, const std::string& text) {
+    if(_texts[id].text == text) return;
+
+    _texts[id].text = text;
+    layout(id);
+}
+
+void AbstractBatchRenderer::setPosition(const UnsignedInt id, const Vector2& position) {
+    Text& t = _texts[id];
+    if(t.position == position) return;
+
+    translate(id, position - t.position);
+    t.position = position;
+    _dirty.emplace_back(t.offset, t.capacity);
+}
+
+void AbstractBatchRenderer::translate(const UnsignedInt id, const Vector2& offset) {
+    const Text& t = _texts[id];
+    for(std::size_t i = t.offset*8, end = (t.offset + t.capacity)*8; i != end; i += 2)
+        _vertices[i] += offset;
+}
+
+void AbstractBatchRenderer::layout(const UnsignedInt id) {
+    std::vector<Vertex> vertices;
+    Range2D rectangle;
+    std::tie(vertices, rectangle) = renderVerticesInternal(_font, _cache, _size, _texts[id].text, _alignment, _layoutCache);
+    const UnsignedInt glyphCount = vertices.size()/4;
+
+    /* If the text doesn't fit into its range anymore, make the old range
+       degenerate and move the text to the end */
+    Text& t = _texts[id];
+    if(glyphCount > t.capacity) {
+        std::fill(_vertices.begin() + t.offset*8, _vertices.begin() + (t.offset + t.capacity)*8, Vector2{});
+        if(t.capacity) _dirty.emplace_back(t.offset, t.capacity);
+
+        t.capacity = Math::max(glyphCount, 2*t.capacity);
+        t.offset = _capacity;
+        _capacity += t.capacity;
+        _vertices.resize(_capacity*8);
+    }
+
+    /* Copy the glyphs and make the rest of the range degenerate */
+    Vector2* const out = _vertices.data() + t.offset*8;
+    for(std::size_t i = 0; i != vertices.size(); ++i) {
+        out[i*2] = vertices[i].position + t.position;
+        out[i*2 + 1] = vertices[i].textureCoordinates;
+    }
+    std::fill(out + vertices.size()*2, out + t.capacity*8, Vector2{});
+
+    t.rectangle = rectangle;
+    if(t.capacity) _dirty.emplace_back(t.offset, t.capacity);
+}
+
+void AbstractBatchRenderer::update() {
+    /* Capacity changed, upload everything */
+    if(_capacity != _uploadedCapacity) {
+        _vertexBuffer.setData(_vertices, _usage);
+
+        Containers::Array<char> indices;
+        Mesh::IndexType indexType;
+        std::tie(indices, indexType) = renderIndicesInternal(_capacity);
+        _indexBuffer.setData(indices, _usage);
+        _mesh.setCount(_capacity*6)
+            .setIndexBuffer(_indexBuffer, 0, indexType, 0, _capacity*4);
+
+        _uploadedCapacity = _capacity;
+        _dirty.clear();
+        return;
+    }
+
+    /* Merge overlapping and adjacent ranges and upload them */
+    std::sort(_dirty.begin(), _dirty.end());
+    for(std::size_t i = 0; i != _dirty.size(); ) {
+        const UnsignedInt begin = _dirty[i].first;
+        UnsignedInt end = begin + _dirty[i].second;
+        for(++i; i != _dirty.size() && _dirty[i].first <= end; ++i)
+            end = Math::max(end, _dirty[i].first + _dirty[i].second);
+
+        _vertexBuffer.setSubData(begin*4*sizeof(Vertex), Containers::ArrayView<const Vector2>{_vertices.data() + begin*8, (end - begin)*8});
+    }
+
+    _dirty.clear();
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+InstancedRenderer::InstancedRenderer(AbstractFont& font, const GlyphCache& cache, const Float size, const BufferUsage usage, const Alignment alignment): _instanceBuffer{Buffer::TargetHint::Array}, _font(font), _cache(cache), _size{size}, _usage{usage}, _alignment{alignment}, _capacity{}, _uploadedCapacity{}, _layoutCache{} {
+    /* Quads are expanded from gl_VertexID of a triangle strip, the attribute
+       locations are the same for 2D and 3D shaders */
+    _mesh.setPrimitive(MeshPrimitive::TriangleStrip)
+        .setCount(4)
+        .setInstanceCount(0)
+        .addVertexBufferInstanced(_instanceBuffer, 1, 0,
+            Shaders::AbstractVector2D::GlyphRectangle{},
+            Shaders::AbstractVector2D::GlyphTextureRectangle{},
+            Shaders::AbstractVector2D::GlyphColor{
+                Shaders::AbstractVector2D::GlyphColor::DataType::UnsignedByte,
+                Shaders::AbstractVector2D::GlyphColor::DataOption::Normalized});
+}
+
+InstancedRenderer::~InstancedRenderer() = default;
+
+UnsignedInt InstancedRenderer::add(const std::string& text, const Vector2& position, const Color4& color, const UnsignedInt capacity) {
+    const UnsignedInt id = _texts.size();
+    _texts.push_back({text, position, Math::denormalize<Color4ub>(color), {}, _capacity, 0});
+    layout(id);
+
+    /* Ensure the capacity is not smaller than requested in case the layout
+       didn't need that much */
+    Text& t = _texts[id];
+    if(t.capacity < capacity) {
+        _glyphs.resize(_glyphs.size() + capacity - t.capacity, Glyph{});
+        _capacity += capacity - t.capacity;
+        t.capacity = capacity;
+    }
+
+    return id;
+}
+
+void InstancedRenderer::setText(const UnsignedInt id, const std::string& text) {
+    if(_texts[id].text == text) return;
+
+    _texts[id].text = text;
+    layout(id);
+}
+
+void InstancedRenderer::setPosition(const UnsignedInt id, const Vector2& position) {
+    Text& t = _texts[id];
+    if(t.position == position) return;
+
+    /* Unused glyphs have zero area, so they stay invisible when moved too */
+    const Vector2 delta = position - t.position;
+    const Vector4 offset{delta.x(), delta.y(), delta.x(), delta.y()};
+    for(std::size_t i = t.offset, end = t.offset + t.capacity; i != end; ++i)
+        _glyphs[i].rectangle += offset;
+
+    t.position = position;
+    markDirty(id);
+}
+
+Color4 InstancedRenderer::color(const UnsignedInt id) const {
+    return Math::normalize<Color4>(_texts[id].color);
+}
+
+void InstancedRenderer::setColor(const UnsignedInt id, const Color4& color) {
+    Text& t = _texts[id];
+    const Color4ub packed = Math::denormalize<Color4ub>(color);
+    if(t.color == packed) return;
+
+    for(std::size_t i = t.offset, end = t.offset + t.capacity; i != end; ++i)
+        _glyphs[i].color = packed;
+
+    t.color = packed;
+    markDirty(id);
+}
+
+void InstancedRenderer::markDirty(const UnsignedInt id) {
+    const Text& t = _texts[id];
+    if(t.capacity) _dirty.emplace_back(t.offset, t.capacity);
+}
+
+void InstancedRenderer::layout(const UnsignedInt id) {
+    std::vector<Vertex> vertices;
+    Range2D rectangle;
+    std::tie(vertices, rectangle) = renderVerticesInternal(_font, _cache, _size, _texts[id].text, _alignment, _layoutCache);
+    const UnsignedInt glyphCount = vertices.size()/4;
+
+    /* If the text doesn't fit into its range anymore, make the old range
+       empty and move the text to the end */
+    Text& t = _texts[id];
+    if(glyphCount > t.capacity) {
+        std::fill(_glyphs.begin() + t.offset, _glyphs.begin() + t.offset + t.capacity, Glyph{});
+        markDirty(id);
+
+        t.capacity = Math::max(glyphCount, 2*t.capacity);
+        t.offset = _capacity;
+        _capacity += t.capacity;
+        _glyphs.resize(_capacity, Glyph{});
+    }
+
+    /* The vertices are top left, bottom left, top right and bottom right
+       corner of each glyph, take the bottom left and top right one. Unused
+       glyphs in the range have zero area and thus are not rasterized. */
+    Glyph* const out = _glyphs.data() + t.offset;
+    for(std::size_t i = 0; i != glyphCount; ++i) {
+        const Vertex& min = vertices[i*4 + 1];
+        const Vertex& max = vertices[i*4 + 2];
+        const Vector2 minPosition = min.position + t.position;
+        const Vector2 maxPosition = max.position + t.position;
+        out[i].rectangle = {minPosition.x(), minPosition.y(), maxPosition.x(), maxPosition.y()};
+        out[i].textureRectangle = {min.textureCoordinates.x(), min.textureCoordinates.y(), max.textureCoordinates.x(), max.textureCoordinates.y()};
+        out[i].color = t.color;
+    }
+    std::fill(out + glyphCount, out + t.capacity, Glyph{});
+
+    t.rectangle = rectangle;
+    markDirty(id);
+}
+
+void InstancedRenderer::update() {
+    /* Capacity changed, upload everything */
+    if(_capacity != _uploadedCapacity) {
+        _instanceBuffer.setData(_glyphs, _usage);
+        _mesh.setInstanceCount(_capacity);
+
+        _uploadedCapacity = _capacity;
+        _dirty.clear();
+        return;
+    }
+
+    /* Merge overlapping and adjacent ranges and upload them */
+    std::sort(_dirty.begin(), _dirty.end());
+    for(std::size_t i = 0; i != _dirty.size(); ) {
+        const UnsignedInt begin = _dirty[i].first;
+        UnsignedInt end = begin + _dirty[i].second;
+        for(++i; i != _dirty.size() && _dirty[i].first <= end; ++i)
+            end = Math::max(end, _dirty[i].first + _dirty[i].second);
+
+        _instanceBuffer.setSubData(begin*sizeof(Glyph), Containers::ArrayView<const Glyph>{_glyphs.data() + begin, end - begin});
+    }
+
+    _dirty.clear();
+}
+#endif
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template class MAGNUM_TEXT_EXPORT Renderer<2>;
 template class MAGNUM_TEXT_EXPORT Renderer<3>;
+template class MAGNUM_TEXT_EXPORT BatchRenderer<2>;
+template class MAGNUM_TEXT_EXPORT BatchRenderer<3>;
 #endif
 
 }}
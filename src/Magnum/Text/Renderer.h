@@ -26,13 +26,14 @@
 */
 
 /** @file Text/Renderer.h
- * @brief Class @ref Magnum::Text::AbstractRenderer, @ref Magnum::Text::Renderer, typedef @ref Magnum::Text::Renderer2D, @ref Magnum::Text::Renderer3D
+ * @brief Class @ref Magnum::Text::AbstractRenderer, @ref Magnum::Text::Renderer, @ref Magnum::Text::AbstractBatchRenderer, @ref Magnum::Text::BatchRenderer, typedef @ref Magnum::Text::Renderer2D, @ref Magnum::Text::Renderer3D, @ref Magnum::Text::BatchRenderer2D, @ref Magnum::Text::BatchRenderer3D
  */
 
 #include <string>
 #include <tuple>
 #include <vector>
 
+#include "Magnum/Math/Color.h"
 #include "Magnum/Math/Range.h"
 #include "Magnum/Buffer.h"
 #include "Magnum/DimensionTraits.h"
@@ -58,11 +59,13 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
          * @param size          Font size
          * @param text          Text to render
          * @param alignment     Text alignment
+         * @param layoutCache   Layout cache to consult before laying out the
+         *      text or `nullptr`
          *
          * Returns tuple with vertex positions, texture coordinates, indices
          * and rectangle spanning the rendered text.
          */
-        static std::tuple<std::vector<Vector2>, std::vector<Vector2>, std::vector<UnsignedInt>, Range2D> render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Alignment alignment = Alignment::LineLeft);
+        static std::tuple<std::vector<Vector2>, std::vector<Vector2>, std::vector<UnsignedInt>, Range2D> render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Alignment alignment = Alignment::LineLeft, LayoutCache* layoutCache = nullptr);
 
         /**
          * @brief Capacity for rendered glyphs
@@ -83,6 +86,17 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
         /** @brief Mesh */
         Mesh& mesh() { return _mesh; }
 
+        /** @brief Layout cache */
+        LayoutCache* layoutCache() const { return _layoutCache; }
+
+        /**
+         * @brief Set layout cache
+         *
+         * If set to non-`nullptr`, the cache is consulted in @ref render()
+         * before laying out the text. Initially no cache is set.
+         */
+        void setLayoutCache(LayoutCache* cache) { _layoutCache = cache; }
+
         /**
          * @brief Reserve capacity for rendered glyphs
          *
@@ -132,6 +146,7 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
         Alignment _alignment;
         UnsignedInt _capacity;
         Range2D _rectangle;
+        LayoutCache* _layoutCache;
 
         #if defined(MAGNUM_TARGET_GLES2) && !defined(CORRADE_TARGET_EMSCRIPTEN)
         typedef void*(*BufferMapImplementation)(Buffer&, GLsizeiptr);
@@ -236,7 +251,7 @@ There is no similar extension in WebGL, thus plain (and slow) buffer updates
 are used there.
 
 @see @ref Renderer2D, @ref Renderer3D, @ref AbstractFont,
-    @ref Shaders::AbstractVector
+    @ref Shaders::AbstractVector, @ref BatchRenderer
 */
 template<UnsignedInt dimensions> class MAGNUM_TEXT_EXPORT Renderer: public AbstractRenderer {
     public:
@@ -250,11 +265,13 @@ template<UnsignedInt dimensions> class MAGNUM_TEXT_EXPORT Renderer: public Abstr
          * @param indexBuffer   Buffer where to store indices
          * @param usage         Usage of vertex and index buffer
          * @param alignment     Text alignment
+         * @param layoutCache   Layout cache to consult before laying out the
+         *      text or `nullptr`
          *
          * Returns mesh prepared for use with @ref Shaders::AbstractVector
          * subclasses and rectangle spanning the rendered text.
          */
-        static std::tuple<Mesh, Range2D> render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Buffer& vertexBuffer, Buffer& indexBuffer, BufferUsage usage, Alignment alignment = Alignment::LineLeft);
+        static std::tuple<Mesh, Range2D> render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Buffer& vertexBuffer, Buffer& indexBuffer, BufferUsage usage, Alignment alignment = Alignment::LineLeft, LayoutCache* layoutCache = nullptr);
 
         /**
          * @brief Constructor
@@ -275,6 +292,370 @@ typedef Renderer<2> Renderer2D;
 /** @brief Three-dimensional text renderer */
 typedef Renderer<3> Renderer3D;
 
+/**
+@brief Base for batch text renderers
+
+Not meant to be used directly, see @ref BatchRenderer for more information.
+@see @ref BatchRenderer2D, @ref BatchRenderer3D
+*/
+class MAGNUM_TEXT_EXPORT AbstractBatchRenderer {
+    public:
+        /** @brief Count of texts in the batch */
+        std::size_t textCount() const { return _texts.size(); }
+
+        /**
+         * @brief Capacity for rendered glyphs
+         *
+         * Sum of capacities of all texts, including space left after texts
+         * that had to be moved because they outgrew their capacity.
+         */
+        UnsignedInt capacity() const { return _capacity; }
+
+        /** @brief Vertex buffer */
+        Buffer& vertexBuffer() { return _vertexBuffer; }
+
+        /** @brief Index buffer */
+        Buffer& indexBuffer() { return _indexBuffer; }
+
+        /**
+         * @brief Mesh
+         *
+         * Draws all texts in the batch at once. Call @ref update() before
+         * drawing to upload the changes.
+         */
+        Mesh& mesh() { return _mesh; }
+
+        /** @brief Layout cache */
+        LayoutCache* layoutCache() const { return _layoutCache; }
+
+        /**
+         * @brief Set layout cache
+         *
+         * If set to non-`nullptr`, the cache is consulted in @ref add() and
+         * @ref setText() before laying out the text. Initially no cache is
+         * set.
+         */
+        void setLayoutCache(LayoutCache* cache) { _layoutCache = cache; }
+
+        /**
+         * @brief Add text to the batch
+         * @param text          Text to render
+         * @param position      Position of the text origin
+         * @param capacity      Capacity for glyphs of this text
+         * @return ID of the text, to be used in @ref setText() and other
+         *      functions
+         *
+         * If the text later outgrows its capacity, it's moved to the end of
+         * the batch. Specifying larger initial @p capacity for texts that
+         * will change avoids that. The text is uploaded on next
+         * @ref update().
+         */
+        UnsignedInt add(const std::string& text, const Vector2& position = {}, UnsignedInt capacity = 0);
+
+        /** @brief Text */
+        const std::string& text(UnsignedInt id) const { return _texts[id].text; }
+
+        /**
+         * @brief Set text
+         *
+         * If the text is the same as before, nothing is done. Otherwise only
+         * this text is laid out again and its range is uploaded on next
+         * @ref update().
+         */
+        void setText(UnsignedInt id, const std::string& text);
+
+        /** @brief Text position */
+        Vector2 position(UnsignedInt id) const { return _texts[id].position; }
+
+        /**
+         * @brief Set text position
+         *
+         * The text is moved without laying it out again.
+         */
+        void setPosition(UnsignedInt id, const Vector2& position);
+
+        /** @brief Rectangle spanning given text, including its position */
+        Range2D rectangle(UnsignedInt id) const { return _texts[id].rectangle.translated(_texts[id].position); }
+
+        /**
+         * @brief Upload changed texts
+         *
+         * Uploads vertex data of texts that changed since the last call.
+         * Consecutive changed texts are uploaded at once. If the capacity
+         * changed, both buffers are reallocated and filled again.
+         */
+        void update();
+
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    protected:
+    #else
+    private:
+    #endif
+        explicit MAGNUM_TEXT_LOCAL AbstractBatchRenderer(AbstractFont& font, const GlyphCache& cache, Float size, BufferUsage usage, Alignment alignment);
+
+        ~AbstractBatchRenderer();
+
+        Mesh _mesh;
+        Buffer _vertexBuffer, _indexBuffer;
+
+    private:
+        struct Text {
+            std::string text;
+            Vector2 position;
+            Range2D rectangle;
+            UnsignedInt offset, capacity;
+        };
+
+        void MAGNUM_TEXT_LOCAL layout(UnsignedInt id);
+        void MAGNUM_TEXT_LOCAL translate(UnsignedInt id, const Vector2& offset);
+
+        AbstractFont& _font;
+        const GlyphCache& _cache;
+        Float _size;
+        BufferUsage _usage;
+        Alignment _alignment;
+        UnsignedInt _capacity, _uploadedCapacity;
+        LayoutCache* _layoutCache;
+
+        std::vector<Text> _texts;
+        /* Interleaved position and texture coordinates, four vertices for
+           each glyph */
+        std::vector<Vector2> _vertices;
+        /* Glyph ranges to upload, kept sorted and merged in update() */
+        std::vector<std::pair<UnsignedInt, UnsignedInt>> _dirty;
+};
+
+/**
+@brief Batch text renderer
+
+Lays out many texts into one shared vertex and index buffer, so they can be
+drawn with a single @ref Mesh::draw() call. Each text occupies a range of
+glyphs in the buffers, changing one text lays out and uploads only its
+range. Unused glyphs in the ranges are degenerate and thus not rasterized.
+@code
+std::unique_ptr<Text::AbstractFont> font;
+Text::GlyphCache cache;
+Shaders::Vector2D shader;
+
+Text::BatchRenderer2D renderer{*font, cache, 0.15f, BufferUsage::DynamicDraw};
+UnsignedInt fps = renderer.add("FPS: 60", {-0.9f, 0.9f}, 12);
+for(const Label& label: labels) renderer.add(label.text, label.position);
+
+// Each frame, update only what changed and draw everything at once
+renderer.setText(fps, "FPS: 59");
+renderer.update();
+shader.setTransformationProjectionMatrix(projection)
+    .setColor(Color3(1.0f))
+    .setVectorTexture(cache.texture());
+renderer.mesh().draw(shader);
+@endcode
+
+All texts share the same font, size and alignment. Alignment is applied to
+each text relative to its position.
+@see @ref BatchRenderer2D, @ref BatchRenderer3D, @ref Renderer
+*/
+template<UnsignedInt dimensions> class MAGNUM_TEXT_EXPORT BatchRenderer: public AbstractBatchRenderer {
+    public:
+        /**
+         * @brief Constructor
+         * @param font          Font
+         * @param cache         Glyph cache
+         * @param size          Font size
+         * @param usage         Vertex and index buffer usage
+         * @param alignment     Text alignment
+         */
+        explicit BatchRenderer(AbstractFont& font, const GlyphCache& cache, Float size, BufferUsage usage, Alignment alignment = Alignment::LineLeft);
+        BatchRenderer(AbstractFont&, GlyphCache&&, Float, BufferUsage, Alignment alignment = Alignment::LineLeft) = delete; /**< @overload */
+};
+
+/** @brief Two-dimensional batch text renderer */
+typedef BatchRenderer<2> BatchRenderer2D;
+
+/** @brief Three-dimensional batch text renderer */
+typedef BatchRenderer<3> BatchRenderer3D;
+
+#ifndef MAGNUM_TARGET_GLES2
+/**
+@brief Instanced text renderer
+
+Similar to @ref BatchRenderer, but instead of four vertices and six indices
+each glyph is a single instance with position, glyph cache rectangle and
+color, expanded to a quad in the vertex shader of @ref Shaders::Vector or
+@ref Shaders::DistanceFieldVector with
+@ref Shaders::AbstractVector::Flag::InstancedGlyphs "Flag::InstancedGlyphs"
+enabled. The glyph data are several times smaller and changing the text,
+position or color of one text uploads only the instances of that text.
+@code
+std::unique_ptr<Text::AbstractFont> font;
+Text::GlyphCache cache;
+Shaders::Vector2D shader{Shaders::Vector2D::Flag::InstancedGlyphs};
+
+Text::InstancedRenderer renderer{*font, cache, 0.15f, BufferUsage::DynamicDraw};
+UnsignedInt fps = renderer.add("FPS: 60", {-0.9f, 0.9f}, Color4{1.0f}, 12);
+UnsignedInt warning = renderer.add("Low memory", {-0.9f, 0.8f}, Color4{1.0f, 0.0f, 0.0f});
+
+// Each frame, update only what changed and draw everything at once
+renderer.setText(fps, "FPS: 59");
+renderer.update();
+shader.setTransformationProjectionMatrix(projection)
+    .setColor(Color4{1.0f})
+    .setVectorTexture(cache.texture());
+renderer.mesh().draw(shader);
+@endcode
+
+The same renderer can be used with both 2D and 3D shaders, the glyphs are
+placed on the XY plane. All texts share the same font, size and alignment.
+Alignment is applied to each text relative to its position.
+@requires_gl30 Extension @extension{EXT,gpu_shader4} for @glsl gl_VertexID @ce
+@requires_gl33 Extension @extension{ARB,instanced_arrays}
+@requires_gles30 @glsl gl_VertexID @ce is not available in OpenGL ES 2.0.
+@requires_webgl20 @glsl gl_VertexID @ce is not available in WebGL 1.0.
+@see @ref Renderer
+*/
+class MAGNUM_TEXT_EXPORT InstancedRenderer {
+    public:
+        /**
+         * @brief Constructor
+         * @param font          Font
+         * @param cache         Glyph cache
+         * @param size          Font size
+         * @param usage         Instance buffer usage
+         * @param alignment     Text alignment
+         */
+        explicit InstancedRenderer(AbstractFont& font, const GlyphCache& cache, Float size, BufferUsage usage, Alignment alignment = Alignment::LineLeft);
+        InstancedRenderer(AbstractFont&, GlyphCache&&, Float, BufferUsage, Alignment alignment = Alignment::LineLeft) = delete; /**< @overload */
+
+        ~InstancedRenderer();
+
+        /** @brief Count of texts */
+        std::size_t textCount() const { return _texts.size(); }
+
+        /**
+         * @brief Capacity for rendered glyphs
+         *
+         * Sum of capacities of all texts, including space left after texts
+         * that had to be moved because they outgrew their capacity. Equal to
+         * instance count of the mesh after @ref update().
+         */
+        UnsignedInt capacity() const { return _capacity; }
+
+        /** @brief Instance buffer */
+        Buffer& instanceBuffer() { return _instanceBuffer; }
+
+        /**
+         * @brief Mesh
+         *
+         * Draws all texts at once. Call @ref update() before drawing to
+         * upload the changes.
+         */
+        Mesh& mesh() { return _mesh; }
+
+        /** @brief Layout cache */
+        LayoutCache* layoutCache() const { return _layoutCache; }
+
+        /**
+         * @brief Set layout cache
+         *
+         * If set to non-`nullptr`, the cache is consulted in @ref add() and
+         * @ref setText() before laying out the text. Initially no cache is
+         * set.
+         */
+        void setLayoutCache(LayoutCache* cache) { _layoutCache = cache; }
+
+        /**
+         * @brief Add text
+         * @param text          Text to render
+         * @param position      Position of the text origin
+         * @param color         Text color
+         * @param capacity      Capacity for glyphs of this text
+         * @return ID of the text, to be used in @ref setText() and other
+         *      functions
+         *
+         * If the text later outgrows its capacity, it's moved to the end.
+         * Specifying larger initial @p capacity for texts that will change
+         * avoids that. The text is uploaded on next @ref update().
+         */
+        UnsignedInt add(const std::string& text, const Vector2& position = {}, const Color4& color = Color4{1.0f}, UnsignedInt capacity = 0);
+
+        /** @brief Text */
+        const std::string& text(UnsignedInt id) const { return _texts[id].text; }
+
+        /**
+         * @brief Set text
+         *
+         * If the text is the same as before, nothing is done. Otherwise only
+         * this text is laid out again and its instances are uploaded on next
+         * @ref update().
+         */
+        void setText(UnsignedInt id, const std::string& text);
+
+        /** @brief Text position */
+        Vector2 position(UnsignedInt id) const { return _texts[id].position; }
+
+        /**
+         * @brief Set text position
+         *
+         * The text is moved without laying it out again.
+         */
+        void setPosition(UnsignedInt id, const Vector2& position);
+
+        /** @brief Text color */
+        Color4 color(UnsignedInt id) const;
+
+        /**
+         * @brief Set text color
+         *
+         * The color is changed without laying the text out again.
+         */
+        void setColor(UnsignedInt id, const Color4& color);
+
+        /** @brief Rectangle spanning given text, including its position */
+        Range2D rectangle(UnsignedInt id) const { return _texts[id].rectangle.translated(_texts[id].position); }
+
+        /**
+         * @brief Upload changed texts
+         *
+         * Uploads instances of texts that changed since the last call.
+         * Consecutive changed texts are uploaded at once. If the capacity
+         * changed, the whole buffer is reallocated and filled again.
+         */
+        void update();
+
+    private:
+        struct Text {
+            std::string text;
+            Vector2 position;
+            Color4ub color;
+            Range2D rectangle;
+            UnsignedInt offset, capacity;
+        };
+
+        struct Glyph {
+            /* Min and max corner of the quad and of the texture rectangle */
+            Vector4 rectangle, textureRectangle;
+            Color4ub color;
+        };
+
+        void MAGNUM_TEXT_LOCAL layout(UnsignedInt id);
+        void MAGNUM_TEXT_LOCAL markDirty(UnsignedInt id);
+
+        Mesh _mesh;
+        Buffer _instanceBuffer;
+        AbstractFont& _font;
+        const GlyphCache& _cache;
+        Float _size;
+        BufferUsage _usage;
+        Alignment _alignment;
+        UnsignedInt _capacity, _uploadedCapacity;
+        LayoutCache* _layoutCache;
+
+        std::vector<Text> _texts;
+        std::vector<Glyph> _glyphs;
+        /* Glyph ranges to upload, kept sorted and merged in update() */
+        std::vector<std::pair<UnsignedInt, UnsignedInt>> _dirty;
+};
+#endif
+
 }}
 
 #endif
@@ -23,6 +23,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
 #include <Corrade/Containers/ArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/Utility/Directory.h>
@@ -39,11 +40,23 @@ struct AbstractFontTest: TestSuite::Tester {
 
     void openSingleData();
     void openFile();
+
+    void glyphIds();
+    void glyphIdsSizeMismatch();
+    void glyphAdvances();
+    void kerning();
+    void rasterizeGlyphNotSupported();
 };
 
 AbstractFontTest::AbstractFontTest() {
     addTests({&AbstractFontTest::openSingleData,
-              &AbstractFontTest::openFile});
+              &AbstractFontTest::openFile,
+
+              &AbstractFontTest::glyphIds,
+              &AbstractFontTest::glyphIdsSizeMismatch,
+              &AbstractFontTest::glyphAdvances,
+              &AbstractFontTest::kerning,
+              &AbstractFontTest::rasterizeGlyphNotSupported});
 }
 
 namespace {
@@ -72,6 +85,21 @@ class SingleDataFont: public Text::AbstractFont {
         bool opened;
 };
 
+class GlyphFont: public Text::AbstractFont {
+    public:
+        Features doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doGlyphId(char32_t character) override { return character - U'a' + 1; }
+
+        Vector2 doGlyphAdvance(UnsignedInt glyph) override { return Vector2::xAxis(glyph*0.5f); }
+
+        std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache&, Float, const std::string&) override {
+            return nullptr;
+        }
+};
+
 }
 
 void AbstractFontTest::openSingleData() {
@@ -91,6 +119,54 @@ void AbstractFontTest::openFile() {
     CORRADE_VERIFY(font.isOpened());
 }
 
+void AbstractFontTest::glyphIds() {
+    /* Default implementation should call doGlyphId() for each character */
+    GlyphFont font;
+    const char32_t characters[]{U'a', U'c', U'b'};
+    UnsignedInt glyphs[3];
+    font.glyphIds(characters, glyphs);
+    CORRADE_COMPARE(glyphs[0], 1);
+    CORRADE_COMPARE(glyphs[1], 3);
+    CORRADE_COMPARE(glyphs[2], 2);
+}
+
+void AbstractFontTest::glyphIdsSizeMismatch() {
+    GlyphFont font;
+    const char32_t characters[]{U'a', U'c', U'b'};
+    UnsignedInt glyphs[2];
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    font.glyphIds(characters, glyphs);
+    CORRADE_COMPARE(out.str(), "Text::AbstractFont::glyphIds(): expected 3 glyphs but got 2\n");
+}
+
+void AbstractFontTest::glyphAdvances() {
+    /* Default implementation should call doGlyphAdvance() for each glyph */
+    GlyphFont font;
+    const UnsignedInt glyphs[]{1, 4};
+    Vector2 advances[2];
+    font.glyphAdvances(glyphs, advances);
+    CORRADE_COMPARE(advances[0], Vector2::xAxis(0.5f));
+    CORRADE_COMPARE(advances[1], Vector2::xAxis(2.0f));
+}
+
+void AbstractFontTest::kerning() {
+    /* Default implementation has no kerning */
+    GlyphFont font;
+    CORRADE_COMPARE(font.kerning(1, 2), Vector2{});
+}
+
+void AbstractFontTest::rasterizeGlyphNotSupported() {
+    GlyphFont font;
+    Vector2i position;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!font.rasterizeGlyph(1, position));
+    CORRADE_COMPARE(out.str(), "Text::AbstractFont::rasterizeGlyph(): feature not supported\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Text::Test::AbstractFontTest)
@@ -0,0 +1,171 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <tuple>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+#include "Magnum/Text/ArrayGlyphCache.h"
+
+namespace Magnum { namespace Text { namespace Test {
+
+struct ArrayGlyphCacheGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit ArrayGlyphCacheGLTest();
+
+    void initialize();
+    void access();
+    void reserve();
+    void reserveTooLarge();
+    void erase();
+    void setImage();
+};
+
+ArrayGlyphCacheGLTest::ArrayGlyphCacheGLTest() {
+    addTests({&ArrayGlyphCacheGLTest::initialize,
+              &ArrayGlyphCacheGLTest::access,
+              &ArrayGlyphCacheGLTest::reserve,
+              &ArrayGlyphCacheGLTest::reserveTooLarge,
+              &ArrayGlyphCacheGLTest::erase,
+              &ArrayGlyphCacheGLTest::setImage});
+}
+
+void ArrayGlyphCacheGLTest::initialize() {
+    Text::ArrayGlyphCache cache{{256, 512, 4}, Vector2i{1}};
+    MAGNUM_VERIFY_NO_ERROR();
+
+    CORRADE_COMPARE(cache.textureSize(), (Vector3i{256, 512, 4}));
+    CORRADE_COMPARE(cache.padding(), Vector2i{1});
+    CORRADE_COMPARE(cache.layerCount(), 0);
+    CORRADE_COMPARE(cache.glyphCount(), 0);
+
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_COMPARE(cache.texture().imageSize(0), (Vector3i{256, 512, 4}));
+    #endif
+}
+
+void ArrayGlyphCacheGLTest::access() {
+    Text::ArrayGlyphCache cache{{236, 236, 2}};
+    Vector2i position;
+    Int layer;
+    Range2Di rectangle;
+
+    /* Default "Not Found" glyph */
+    std::tie(position, layer, rectangle) = cache[0];
+    CORRADE_COMPARE(position, Vector2i(0, 0));
+    CORRADE_COMPARE(layer, 0);
+    CORRADE_COMPARE(rectangle, Range2Di({0, 0}, {0, 0}));
+
+    /* Overwrite "Not Found" glyph */
+    cache.insert(0, {3, 5}, 1, {{10, 10}, {23, 45}});
+    CORRADE_COMPARE(cache.glyphCount(), 0);
+    std::tie(position, layer, rectangle) = cache[0];
+    CORRADE_COMPARE(position, Vector2i(3, 5));
+    CORRADE_COMPARE(layer, 1);
+    CORRADE_COMPARE(rectangle, Range2Di({10, 10}, {23, 45}));
+
+    /* Querying available glyph */
+    cache.insert(25, {3, 4}, 0, {{15, 30}, {45, 35}});
+    CORRADE_COMPARE(cache.glyphCount(), 1);
+    std::tie(position, layer, rectangle) = cache[25];
+    CORRADE_COMPARE(position, Vector2i(3, 4));
+    CORRADE_COMPARE(layer, 0);
+    CORRADE_COMPARE(rectangle, Range2Di({15, 30}, {45, 35}));
+
+    /* Querying not available glyph falls back to "Not Found" */
+    CORRADE_VERIFY(cache[42] == cache[0]);
+}
+
+void ArrayGlyphCacheGLTest::reserve() {
+    Text::ArrayGlyphCache cache{{16, 16, 3}, Vector2i{1}};
+
+    std::vector<std::pair<Int, Range2Di>> first = cache.reserve({{14, 8}});
+    CORRADE_COMPARE(first.size(), 1);
+    CORRADE_COMPARE(first[0].first, 0);
+    CORRADE_COMPARE(cache.layerCount(), 1);
+
+    /* Glyphs not fitting into the first layer spill into the next ones */
+    std::vector<std::pair<Int, Range2Di>> second = cache.reserve({{14, 8}, {14, 8}, {14, 4}});
+    CORRADE_COMPARE(second.size(), 3);
+    CORRADE_COMPARE(second[0].first, 1);
+    CORRADE_COMPARE(second[1].first, 2);
+    CORRADE_COMPARE(second[2].first, 0);
+    CORRADE_COMPARE(cache.layerCount(), 3);
+}
+
+void ArrayGlyphCacheGLTest::reserveTooLarge() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Text::ArrayGlyphCache cache{{16, 16, 2}};
+    CORRADE_VERIFY(cache.reserve({{10, 10}, {10, 10}, {10, 10}}).empty());
+    CORRADE_COMPARE(cache.layerCount(), 0);
+    CORRADE_COMPARE(out.str(), "Text::ArrayGlyphCache::reserve(): cannot fit 3 glyphs into remaining space of Vector(16, 16, 2) cache\n");
+}
+
+void ArrayGlyphCacheGLTest::erase() {
+    Text::ArrayGlyphCache cache{{16, 16, 1}, Vector2i{1}};
+
+    std::vector<std::pair<Int, Range2Di>> ranges = cache.reserve({{14, 14}});
+    CORRADE_COMPARE(ranges.size(), 1);
+    cache.insert(3, {}, ranges[0].first, ranges[0].second);
+    CORRADE_COMPARE(cache.glyphCount(), 1);
+
+    CORRADE_VERIFY(!cache.erase(4));
+    CORRADE_VERIFY(cache.erase(3));
+    CORRADE_COMPARE(cache.glyphCount(), 0);
+    CORRADE_VERIFY(cache[3] == cache[0]);
+
+    /* The space can be reused */
+    CORRADE_COMPARE(cache.reserve({{14, 14}}).size(), 1);
+}
+
+void ArrayGlyphCacheGLTest::setImage() {
+    Text::ArrayGlyphCache cache{TextureFormat::RGBA8, {8, 8, 2}};
+
+    const UnsignedByte data[]{
+        0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88,
+        0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff, 0x00
+    };
+    cache.setImage({2, 4, 1}, ImageView2D{PixelFormat::RGBA, PixelType::UnsignedByte, {2, 2}, data});
+    MAGNUM_VERIFY_NO_ERROR();
+
+    #ifndef MAGNUM_TARGET_GLES
+    Image3D image = cache.texture().subImage(0, Range3Di::fromSize({2, 4, 1}, {2, 2, 1}), {PixelFormat::RGBA, PixelType::UnsignedByte});
+    MAGNUM_VERIFY_NO_ERROR();
+
+    CORRADE_COMPARE(image.size(), (Vector3i{2, 2, 1}));
+    CORRADE_COMPARE_AS(
+        (Containers::ArrayView<const UnsignedByte>{image.data<UnsignedByte>(), image.data().size()}),
+        Containers::ArrayView<const UnsignedByte>{data}, TestSuite::Compare::Container);
+    #endif
+}
+
+}}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Text::Test::ArrayGlyphCacheGLTest)
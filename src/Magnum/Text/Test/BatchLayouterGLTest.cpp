@@ -0,0 +1,166 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <tuple>
+
+#include "Magnum/Test/AbstractOpenGLTester.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Text/BatchLayouter.h"
+#include "Magnum/Text/GlyphCache.h"
+#include "Magnum/Text/KerningTable.h"
+
+namespace Magnum { namespace Text { namespace Test {
+
+struct BatchLayouterGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit BatchLayouterGLTest();
+
+    void layout();
+    void layoutKerning();
+    void layoutEmpty();
+};
+
+BatchLayouterGLTest::BatchLayouterGLTest() {
+    addTests({&BatchLayouterGLTest::layout,
+              &BatchLayouterGLTest::layoutKerning,
+              &BatchLayouterGLTest::layoutEmpty});
+}
+
+namespace {
+
+/* Glyph ID is the letter index, advance is its multiple */
+class TestFont: public Text::AbstractFont {
+    public:
+        explicit TestFont(): opened{}, idQueries{}, advanceQueries{} {}
+
+        Features doFeatures() const override { return Feature::OpenData; }
+        bool doIsOpened() const override { return opened; }
+        void doClose() override { opened = false; }
+
+        Metrics doOpenSingleData(Containers::ArrayView<const char>, Float size) override {
+            opened = true;
+            return {size, 1.0f, -0.5f, 2.0f};
+        }
+
+        UnsignedInt doGlyphId(char32_t character) override {
+            return character - U'a' + 1;
+        }
+
+        Vector2 doGlyphAdvance(UnsignedInt glyph) override {
+            return Vector2::xAxis(glyph*1.0f);
+        }
+
+        void doGlyphIds(Containers::ArrayView<const char32_t> characters, Containers::ArrayView<UnsignedInt> glyphs) override {
+            ++idQueries;
+            for(std::size_t i = 0; i != characters.size(); ++i)
+                glyphs[i] = doGlyphId(characters[i]);
+        }
+
+        void doGlyphAdvances(Containers::ArrayView<const UnsignedInt> glyphs, Containers::ArrayView<Vector2> advances) override {
+            ++advanceQueries;
+            for(std::size_t i = 0; i != glyphs.size(); ++i)
+                advances[i] = doGlyphAdvance(glyphs[i]);
+        }
+
+        std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache&, Float, const std::string&) override {
+            return nullptr;
+        }
+
+        bool opened;
+        Int idQueries, advanceQueries;
+};
+
+}
+
+void BatchLayouterGLTest::layout() {
+    TestFont font;
+    const char data[]{'\0'};
+    font.openSingleData(data, 2.0f);
+
+    GlyphCache cache{Vector2i{16}};
+    cache.insert(1, {1, 2}, {{0, 0}, {4, 8}});
+    cache.insert(2, {0, 0}, {{4, 0}, {8, 4}});
+
+    /* Non-ASCII character results in a single glyph */
+    BatchLayouter layouter{font, cache, 1.0f, "ab\xc4\x8d"};
+    CORRADE_COMPARE(layouter.glyphCount(), 3);
+
+    /* All glyphs queried in a single call */
+    CORRADE_COMPARE(font.idQueries, 1);
+    CORRADE_COMPARE(font.advanceQueries, 1);
+    CORRADE_COMPARE(layouter.glyphs(), (std::vector<UnsignedInt>{1, 2, U'č' - U'a' + 1}));
+
+    /* Advances are scaled to text size */
+    CORRADE_COMPARE(layouter.advances()[0], Vector2::xAxis(0.5f));
+    CORRADE_COMPARE(layouter.advances()[1], Vector2::xAxis(1.0f));
+
+    Vector2 cursor;
+    Range2D rectangle;
+    Range2D position, textureCoordinates;
+    std::tie(position, textureCoordinates) = layouter.renderGlyph(0, cursor, rectangle);
+    CORRADE_COMPARE(position, Range2D({0.5f, 1.0f}, {2.5f, 5.0f}));
+    CORRADE_COMPARE(textureCoordinates, Range2D({0.0f, 0.0f}, {0.25f, 0.5f}));
+    CORRADE_COMPARE(cursor, Vector2::xAxis(0.5f));
+
+    std::tie(position, textureCoordinates) = layouter.renderGlyph(1, cursor, rectangle);
+    CORRADE_COMPARE(position, Range2D({0.5f, 0.0f}, {1.5f, 1.0f}));
+    CORRADE_COMPARE(textureCoordinates, Range2D({0.25f, 0.0f}, {0.5f, 0.25f}));
+    CORRADE_COMPARE(cursor, Vector2::xAxis(1.5f));
+}
+
+void BatchLayouterGLTest::layoutKerning() {
+    TestFont font;
+    const char data[]{'\0'};
+    font.openSingleData(data, 2.0f);
+
+    GlyphCache cache{Vector2i{16}};
+
+    KerningTable kerning;
+    kerning.add(1, 2, Vector2::xAxis(-0.5f));
+
+    /* Kerning is applied only to "a" followed by "b", scaled to text size */
+    BatchLayouter layouter{font, cache, 1.0f, "abab", &kerning};
+    CORRADE_COMPARE(layouter.advances(), (std::vector<Vector2>{
+        Vector2::xAxis(0.25f),
+        Vector2::xAxis(1.0f),
+        Vector2::xAxis(0.25f),
+        Vector2::xAxis(1.0f)}));
+}
+
+void BatchLayouterGLTest::layoutEmpty() {
+    TestFont font;
+    const char data[]{'\0'};
+    font.openSingleData(data, 2.0f);
+
+    GlyphCache cache{Vector2i{16}};
+    KerningTable kerning;
+    kerning.add(1, 2, Vector2::xAxis(-0.5f));
+
+    BatchLayouter layouter{font, cache, 1.0f, "", &kerning};
+    CORRADE_COMPARE(layouter.glyphCount(), 0);
+}
+
+}}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Text::Test::BatchLayouterGLTest)
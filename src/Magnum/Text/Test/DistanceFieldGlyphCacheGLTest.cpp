@@ -0,0 +1,133 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstdlib>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+#include "Magnum/Text/DistanceFieldGlyphCache.h"
+#include "Magnum/TextureTools/DistanceField.h"
+
+namespace Magnum { namespace Text { namespace Test {
+
+struct DistanceFieldGlyphCacheGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit DistanceFieldGlyphCacheGLTest();
+
+    void initialize();
+    void setImage();
+    void setImageIncremental();
+
+    private:
+        void verify(DistanceFieldGlyphCache& cache, const ImageView2D& expected);
+};
+
+DistanceFieldGlyphCacheGLTest::DistanceFieldGlyphCacheGLTest() {
+    addTests({&DistanceFieldGlyphCacheGLTest::initialize,
+              &DistanceFieldGlyphCacheGLTest::setImage,
+              &DistanceFieldGlyphCacheGLTest::setImageIncremental});
+}
+
+namespace {
+
+void fill(UnsignedByte* const data, const Range2Di& range) {
+    for(Int y = range.bottom(); y != range.top(); ++y)
+        for(Int x = range.left(); x != range.right(); ++x)
+            data[y*32 + x] = 255;
+}
+
+}
+
+void DistanceFieldGlyphCacheGLTest::verify(DistanceFieldGlyphCache& cache, const ImageView2D& input) {
+    #ifndef MAGNUM_TARGET_GLES
+    /* Compare to the CPU implementation, allowing for rounding differences */
+    Image2D expected = TextureTools::distanceField(input, {32, 32}, cache.radius());
+    Image2D actual = cache.texture().image(0, {PixelFormat::Red, PixelType::UnsignedByte});
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(actual.size(), Vector2i(32, 32));
+
+    Int maxDifference = 0;
+    for(std::size_t i = 0; i != 32*32; ++i)
+        maxDifference = Math::max(maxDifference, std::abs(Int(actual.data<UnsignedByte>()[i]) - Int(expected.data<UnsignedByte>()[i])));
+    CORRADE_COMPARE_AS(maxDifference, 2, TestSuite::Compare::Less);
+    #else
+    static_cast<void>(cache);
+    static_cast<void>(input);
+    CORRADE_SKIP("Can't verify texture contents on OpenGL ES.");
+    #endif
+}
+
+void DistanceFieldGlyphCacheGLTest::initialize() {
+    DistanceFieldGlyphCache cache{{1024, 2048}, {128, 256}, 16};
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(cache.textureSize(), Vector2i(1024, 2048));
+    CORRADE_COMPARE(cache.padding(), Vector2i(16));
+    CORRADE_COMPARE(cache.radius(), 16);
+
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_COMPARE(cache.texture().imageSize(0), Vector2i(128, 256));
+    #endif
+}
+
+void DistanceFieldGlyphCacheGLTest::setImage() {
+    DistanceFieldGlyphCache cache{{32, 32}, {32, 32}, 3};
+
+    UnsignedByte data[32*32]{};
+    fill(data, {{4, 4}, {10, 12}});
+    const ImageView2D image{PixelFormat::Red, PixelType::UnsignedByte, {32, 32}, data};
+
+    /* Nothing reserved, the whole image is converted */
+    cache.setImage({}, image);
+    MAGNUM_VERIFY_NO_ERROR();
+    verify(cache, image);
+}
+
+void DistanceFieldGlyphCacheGLTest::setImageIncremental() {
+    DistanceFieldGlyphCache cache{{32, 32}, {32, 32}, 3};
+
+    UnsignedByte first[32*32]{};
+    fill(first, {{4, 4}, {10, 12}});
+    cache.setImage({}, ImageView2D{PixelFormat::Red, PixelType::UnsignedByte, {32, 32}, first});
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Reserve a glyph and pass image containing only it, the first glyph
+       should stay untouched */
+    const std::vector<Range2Di> reserved = cache.reserve({{6, 6}});
+    CORRADE_COMPARE(reserved.size(), 1);
+    UnsignedByte second[32*32]{};
+    fill(second, reserved[0]);
+    cache.setImage({}, ImageView2D{PixelFormat::Red, PixelType::UnsignedByte, {32, 32}, second});
+    MAGNUM_VERIFY_NO_ERROR();
+
+    UnsignedByte both[32*32];
+    for(std::size_t i = 0; i != 32*32; ++i) both[i] = first[i] | second[i];
+    verify(cache, ImageView2D{PixelFormat::Red, PixelType::UnsignedByte, {32, 32}, both});
+}
+
+}}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Text::Test::DistanceFieldGlyphCacheGLTest)
@@ -0,0 +1,162 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <tuple>
+
+#include "Magnum/Image.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+#include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/DynamicGlyphCache.h"
+
+namespace Magnum { namespace Text { namespace Test {
+
+struct DynamicGlyphCacheGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit DynamicGlyphCacheGLTest();
+
+    void prepare();
+    void prepareAgain();
+    void evict();
+    void evictUsedInCurrentFrame();
+};
+
+DynamicGlyphCacheGLTest::DynamicGlyphCacheGLTest() {
+    addTests({&DynamicGlyphCacheGLTest::prepare,
+              &DynamicGlyphCacheGLTest::prepareAgain,
+              &DynamicGlyphCacheGLTest::evict,
+              &DynamicGlyphCacheGLTest::evictUsedInCurrentFrame});
+}
+
+namespace {
+
+/* Rasterizes every character as a 6x6 square, glyph ID is the character
+   code. Uploads image of the whole cache as some font plugins do. */
+class SquareFont: public Text::AbstractFont {
+    public:
+        Features doFeatures() const override { return Feature::OpenData; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doGlyphId(const char32_t character) override { return character; }
+
+        Vector2 doGlyphAdvance(UnsignedInt) override { return {}; }
+
+        void doFillGlyphCache(GlyphCache& cache, const std::u32string& characters) override {
+            std::vector<Vector2i> sizes(characters.size(), Vector2i{6});
+            std::vector<Range2Di> ranges = cache.reserve(sizes);
+            if(ranges.empty()) return;
+
+            #ifndef MAGNUM_TARGET_GLES2
+            const PixelFormat format = PixelFormat::Red;
+            #else
+            const PixelFormat format = PixelFormat::Luminance;
+            #endif
+            Image2D image{format, PixelType::UnsignedByte, cache.textureSize(),
+                Containers::Array<char>{Containers::ValueInit, std::size_t(cache.textureSize().product())}};
+            for(std::size_t i = 0; i != characters.size(); ++i)
+                cache.insert(characters[i], {}, ranges[i]);
+            cache.setImage({}, image);
+            ++fillCount;
+        }
+
+        std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache&, Float, const std::string&) override {
+            return nullptr;
+        }
+
+        Int fillCount = 0;
+};
+
+}
+
+void DynamicGlyphCacheGLTest::prepare() {
+    SquareFont font;
+    DynamicGlyphCache cache{font, Vector2i{32}, Vector2i{1}};
+    MAGNUM_VERIFY_NO_ERROR();
+
+    CORRADE_COMPARE(cache.prepare("abca"), 3);
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(font.fillCount, 1);
+    CORRADE_COMPARE(cache.glyphCount(), 4);
+    CORRADE_COMPARE(cache['b'].second.size(), Vector2i{8});
+    CORRADE_VERIFY(cache['a'] != cache['b']);
+}
+
+void DynamicGlyphCacheGLTest::prepareAgain() {
+    SquareFont font;
+    DynamicGlyphCache cache{font, Vector2i{32}, Vector2i{1}};
+
+    CORRADE_COMPARE(cache.prepare("ab"), 2);
+    const std::pair<Vector2i, Range2Di> a = cache['a'];
+
+    /* Only the missing glyph is rasterized, existing ones are kept */
+    CORRADE_COMPARE(cache.prepare("abc"), 1);
+    CORRADE_COMPARE(cache.prepare("cba"), 0);
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(font.fillCount, 2);
+    CORRADE_COMPARE(cache.glyphCount(), 4);
+    CORRADE_VERIFY(cache['a'] == a);
+}
+
+void DynamicGlyphCacheGLTest::evict() {
+    SquareFont font;
+
+    /* Exactly 16 glyphs of 8x8 including the padding fit */
+    DynamicGlyphCache cache{font, Vector2i{32}, Vector2i{1}};
+    CORRADE_COMPARE(cache.prepare("abcdefgh"), 8);
+    cache.newFrame();
+    CORRADE_COMPARE(cache.prepare("ijklmnop"), 8);
+    cache.newFrame();
+
+    /* Glyphs from the first frame get evicted to make space */
+    CORRADE_COMPARE(cache.prepare("ijkq"), 1);
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(cache.glyphCount(), 10);
+    CORRADE_VERIFY(cache['a'] == cache[0]);
+    CORRADE_VERIFY(cache['i'] != cache[0]);
+    CORRADE_VERIFY(cache['q'] != cache[0]);
+
+    /* Evicted glyphs are rasterized again on next use */
+    CORRADE_COMPARE(cache.prepare("a"), 1);
+    CORRADE_VERIFY(cache['a'] != cache[0]);
+}
+
+void DynamicGlyphCacheGLTest::evictUsedInCurrentFrame() {
+    SquareFont font;
+    DynamicGlyphCache cache{font, Vector2i{16}, Vector2i{1}};
+    CORRADE_COMPARE(cache.prepare("abcd"), 4);
+
+    std::ostringstream out;
+    {
+        Error redirectError{&out};
+        CORRADE_COMPARE(cache.prepare("e"), 0);
+    }
+    CORRADE_COMPARE(out.str(), "Text::DynamicGlyphCache::reserve(): cannot fit 1 glyphs into Vector(16, 16) cache even after evicting all unused glyphs\n");
+    CORRADE_COMPARE(cache.glyphCount(), 5);
+}
+
+}}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Text::Test::DynamicGlyphCacheGLTest)
@@ -23,6 +23,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
 #include <tuple>
 
 #include "Magnum/Test/AbstractOpenGLTester.h"
@@ -35,13 +36,21 @@ struct GlyphCacheGLTest: Magnum::Test::AbstractOpenGLTester {
 
     void initialize();
     void access();
+    void accessSparse();
+    void iterate();
     void reserve();
+    void reserveIncremental();
+    void reserveTooLarge();
 };
 
 GlyphCacheGLTest::GlyphCacheGLTest() {
     addTests({&GlyphCacheGLTest::initialize,
               &GlyphCacheGLTest::access,
-              &GlyphCacheGLTest::reserve});
+              &GlyphCacheGLTest::accessSparse,
+              &GlyphCacheGLTest::iterate,
+              &GlyphCacheGLTest::reserve,
+              &GlyphCacheGLTest::reserveIncremental,
+              &GlyphCacheGLTest::reserveTooLarge});
 }
 
 void GlyphCacheGLTest::initialize() {
@@ -84,6 +93,47 @@ void GlyphCacheGLTest::access() {
     CORRADE_COMPARE(rectangle, Range2Di({10, 10}, {23, 45}));
 }
 
+void GlyphCacheGLTest::accessSparse() {
+    Text::GlyphCache cache(Vector2i(236));
+
+    /* Large IDs are stored outside of the dense array */
+    cache.insert(1000000, {1, 2}, {{3, 4}, {5, 6}});
+    cache.insert(70000, {7, 8}, {{9, 10}, {11, 12}});
+    cache.insert(3, {13, 14}, {{15, 16}, {17, 18}});
+    CORRADE_COMPARE(cache.glyphCount(), 4);
+
+    Vector2i position;
+    Range2Di rectangle;
+    std::tie(position, rectangle) = cache[1000000];
+    CORRADE_COMPARE(position, Vector2i(1, 2));
+    CORRADE_COMPARE(rectangle, Range2Di({3, 4}, {5, 6}));
+    std::tie(position, rectangle) = cache[70000];
+    CORRADE_COMPARE(position, Vector2i(7, 8));
+    CORRADE_COMPARE(rectangle, Range2Di({9, 10}, {11, 12}));
+    std::tie(position, rectangle) = cache[3];
+    CORRADE_COMPARE(position, Vector2i(13, 14));
+    CORRADE_COMPARE(rectangle, Range2Di({15, 16}, {17, 18}));
+
+    /* Not available glyphs in both storages fall back to "Not Found" */
+    CORRADE_VERIFY(cache[2] == cache[0]);
+    CORRADE_VERIFY(cache[70001] == cache[0]);
+}
+
+void GlyphCacheGLTest::iterate() {
+    Text::GlyphCache cache(Vector2i(236));
+    cache.insert(1000000, {}, {{3, 4}, {5, 6}});
+    cache.insert(5, {}, {{9, 10}, {11, 12}});
+    cache.insert(2, {}, {{15, 16}, {17, 18}});
+
+    /* Iterated in ascending order, including the "Not Found" glyph */
+    std::vector<UnsignedInt> glyphs;
+    for(const std::pair<UnsignedInt, std::pair<Vector2i, Range2Di>>& glyph: cache) {
+        CORRADE_VERIFY(glyph.second == cache[glyph.first]);
+        glyphs.push_back(glyph.first);
+    }
+    CORRADE_COMPARE(glyphs, (std::vector<UnsignedInt>{0, 2, 5, 1000000}));
+}
+
 void GlyphCacheGLTest::reserve() {
     Text::GlyphCache cache(Vector2i(236));
 
@@ -91,6 +141,30 @@ void GlyphCacheGLTest::reserve() {
     CORRADE_VERIFY(!cache.reserve({{5, 3}}).empty());
 }
 
+void GlyphCacheGLTest::reserveIncremental() {
+    Text::GlyphCache cache{Vector2i{16}, Vector2i{16}, Vector2i{1}};
+
+    std::vector<Range2Di> first = cache.reserve({{6, 6}});
+    CORRADE_COMPARE(first.size(), 1);
+    cache.insert(1, {}, first[0]);
+
+    /* Reserving in non-empty cache doesn't overlap the previous glyphs */
+    std::vector<Range2Di> second = cache.reserve({{6, 6}, {6, 6}, {6, 6}});
+    CORRADE_COMPARE(second.size(), 3);
+    for(const Range2Di& range: second)
+        CORRADE_VERIFY(range.padded(Vector2i{1}).min().x() >= first[0].padded(Vector2i{1}).max().x() ||
+                       range.padded(Vector2i{1}).min().y() >= first[0].padded(Vector2i{1}).max().y());
+}
+
+void GlyphCacheGLTest::reserveTooLarge() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Text::GlyphCache cache{Vector2i{16}};
+    CORRADE_VERIFY(cache.reserve({{10, 10}, {10, 10}}).empty());
+    CORRADE_COMPARE(out.str(), "Text::GlyphCache::reserve(): cannot fit 2 glyphs into remaining space of Vector(16, 16) cache\n");
+}
+
 }}}
 
 MAGNUM_GL_TEST_MAIN(Magnum::Text::Test::GlyphCacheGLTest)
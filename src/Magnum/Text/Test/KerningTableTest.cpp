@@ -0,0 +1,154 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/KerningTable.h"
+
+namespace Magnum { namespace Text { namespace Test {
+
+struct KerningTableTest: TestSuite::Tester {
+    explicit KerningTableTest();
+
+    void construct();
+    void add();
+    void addReplace();
+    void addZero();
+    void fill();
+    void fillMerge();
+};
+
+KerningTableTest::KerningTableTest() {
+    addTests({&KerningTableTest::construct,
+              &KerningTableTest::add,
+              &KerningTableTest::addReplace,
+              &KerningTableTest::addZero,
+              &KerningTableTest::fill,
+              &KerningTableTest::fillMerge});
+}
+
+namespace {
+
+/* Glyph 1 followed by glyph 2 is moved closer, everything else is zero */
+class KerningFont: public Text::AbstractFont {
+    public:
+        explicit KerningFont(): queries{} {}
+
+        Features doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doGlyphId(char32_t) override { return 0; }
+        Vector2 doGlyphAdvance(UnsignedInt) override { return {}; }
+
+        Vector2 doKerning(UnsignedInt left, UnsignedInt right) override {
+            ++queries;
+            return left == 1 && right == 2 ? Vector2::xAxis(-0.25f) : Vector2{};
+        }
+
+        std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache&, Float, const std::string&) override {
+            return nullptr;
+        }
+
+        Int queries;
+};
+
+}
+
+void KerningTableTest::construct() {
+    KerningTable table;
+    CORRADE_VERIFY(table.isEmpty());
+    CORRADE_COMPARE(table.size(), 0);
+    CORRADE_COMPARE(table(1, 2), Vector2{});
+}
+
+void KerningTableTest::add() {
+    KerningTable table;
+    table.add(3, 1, Vector2::xAxis(1.0f))
+        .add(1, 3, Vector2::xAxis(-1.0f))
+        .add(1, 2, Vector2::yAxis(0.5f));
+
+    CORRADE_COMPARE(table.size(), 3);
+    CORRADE_COMPARE(table(3, 1), Vector2::xAxis(1.0f));
+    CORRADE_COMPARE(table(1, 3), Vector2::xAxis(-1.0f));
+    CORRADE_COMPARE(table(1, 2), Vector2::yAxis(0.5f));
+
+    /* The order matters */
+    CORRADE_COMPARE(table(2, 1), Vector2{});
+}
+
+void KerningTableTest::addReplace() {
+    KerningTable table;
+    table.add(1, 2, Vector2::xAxis(1.0f))
+        .add(1, 2, Vector2::xAxis(2.0f));
+
+    CORRADE_COMPARE(table.size(), 1);
+    CORRADE_COMPARE(table(1, 2), Vector2::xAxis(2.0f));
+}
+
+void KerningTableTest::addZero() {
+    KerningTable table;
+    table.add(1, 2, {});
+    CORRADE_VERIFY(table.isEmpty());
+
+    /* Zero offset removes existing pair */
+    table.add(1, 2, Vector2::xAxis(1.0f))
+        .add(1, 2, {});
+    CORRADE_VERIFY(table.isEmpty());
+}
+
+void KerningTableTest::fill() {
+    KerningFont font;
+    KerningTable table;
+
+    /* Duplicate glyphs are queried just once */
+    const UnsignedInt glyphs[]{2, 1, 3, 1, 2};
+    table.fill(font, glyphs);
+    CORRADE_COMPARE(font.queries, 9);
+
+    /* Only non-zero pairs are stored */
+    CORRADE_COMPARE(table.size(), 1);
+    CORRADE_COMPARE(table(1, 2), Vector2::xAxis(-0.25f));
+    CORRADE_COMPARE(table(2, 1), Vector2{});
+}
+
+void KerningTableTest::fillMerge() {
+    KerningFont font;
+    KerningTable table;
+    table.add(1, 2, Vector2::xAxis(5.0f))
+        .add(7, 8, Vector2::xAxis(1.0f));
+
+    /* Pairs from the font replace existing ones, others are kept */
+    const UnsignedInt glyphs[]{1, 2};
+    table.fill(font, glyphs);
+    CORRADE_COMPARE(table.size(), 2);
+    CORRADE_COMPARE(table(1, 2), Vector2::xAxis(-0.25f));
+    CORRADE_COMPARE(table(7, 8), Vector2::xAxis(1.0f));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Text::Test::KerningTableTest)
@@ -0,0 +1,143 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Text/Alignment.h"
+#include "Magnum/Text/LayoutCache.h"
+
+namespace Magnum { namespace Text { namespace Test {
+
+struct LayoutCacheTest: TestSuite::Tester {
+    explicit LayoutCacheTest();
+
+    void construct();
+    void insertFind();
+    void key();
+    void replace();
+    void evict();
+    void clear();
+};
+
+LayoutCacheTest::LayoutCacheTest() {
+    addTests({&LayoutCacheTest::construct,
+              &LayoutCacheTest::insertFind,
+              &LayoutCacheTest::key,
+              &LayoutCacheTest::replace,
+              &LayoutCacheTest::evict,
+              &LayoutCacheTest::clear});
+}
+
+namespace {
+
+/* The cache uses only addresses of these, never touches the contents */
+char data[3];
+const AbstractFont& font = *reinterpret_cast<const AbstractFont*>(data);
+const AbstractFont& anotherFont = *reinterpret_cast<const AbstractFont*>(data + 1);
+const GlyphCache& glyphCache = *reinterpret_cast<const GlyphCache*>(data + 2);
+
+LayoutCache::Run run(Float value) {
+    return {{Vector2{value}, Vector2{}, Vector2{value}, Vector2{}}, Range2D{{}, Vector2{value}}};
+}
+
+}
+
+void LayoutCacheTest::construct() {
+    LayoutCache cache{16};
+    CORRADE_COMPARE(cache.capacity(), 16);
+    CORRADE_COMPARE(cache.size(), 0);
+    CORRADE_COMPARE(cache.hits(), 0);
+    CORRADE_COMPARE(cache.misses(), 0);
+}
+
+void LayoutCacheTest::insertFind() {
+    LayoutCache cache;
+    CORRADE_VERIFY(!cache.find(font, glyphCache, 1.0f, Alignment::LineLeft, "hello"));
+    CORRADE_COMPARE(cache.misses(), 1);
+
+    const LayoutCache::Run& inserted = cache.insert(font, glyphCache, 1.0f, Alignment::LineLeft, "hello", run(3.0f));
+    CORRADE_COMPARE(inserted.second, Range2D({}, Vector2{3.0f}));
+    CORRADE_COMPARE(cache.size(), 1);
+
+    const LayoutCache::Run* found = cache.find(font, glyphCache, 1.0f, Alignment::LineLeft, "hello");
+    CORRADE_VERIFY(found);
+    CORRADE_COMPARE(found->first.size(), 4);
+    CORRADE_COMPARE(found->first[2], Vector2{3.0f});
+    CORRADE_COMPARE(found->second, Range2D({}, Vector2{3.0f}));
+    CORRADE_COMPARE(cache.hits(), 1);
+    CORRADE_COMPARE(cache.misses(), 1);
+}
+
+void LayoutCacheTest::key() {
+    LayoutCache cache;
+    cache.insert(font, glyphCache, 1.0f, Alignment::LineLeft, "hello", run(3.0f));
+
+    /* Any difference in the key is a miss */
+    CORRADE_VERIFY(!cache.find(anotherFont, glyphCache, 1.0f, Alignment::LineLeft, "hello"));
+    CORRADE_VERIFY(!cache.find(font, glyphCache, 2.0f, Alignment::LineLeft, "hello"));
+    CORRADE_VERIFY(!cache.find(font, glyphCache, 1.0f, Alignment::LineRight, "hello"));
+    CORRADE_VERIFY(!cache.find(font, glyphCache, 1.0f, Alignment::LineLeft, "hello!"));
+    CORRADE_COMPARE(cache.misses(), 4);
+    CORRADE_VERIFY(cache.find(font, glyphCache, 1.0f, Alignment::LineLeft, "hello"));
+}
+
+void LayoutCacheTest::replace() {
+    LayoutCache cache;
+    cache.insert(font, glyphCache, 1.0f, Alignment::LineLeft, "hello", run(3.0f));
+    cache.insert(font, glyphCache, 1.0f, Alignment::LineLeft, "hello", run(5.0f));
+    CORRADE_COMPARE(cache.size(), 1);
+
+    const LayoutCache::Run* found = cache.find(font, glyphCache, 1.0f, Alignment::LineLeft, "hello");
+    CORRADE_VERIFY(found);
+    CORRADE_COMPARE(found->second, Range2D({}, Vector2{5.0f}));
+}
+
+void LayoutCacheTest::evict() {
+    LayoutCache cache{2};
+    cache.insert(font, glyphCache, 1.0f, Alignment::LineLeft, "a", run(1.0f));
+    cache.insert(font, glyphCache, 1.0f, Alignment::LineLeft, "b", run(2.0f));
+
+    /* Using "a" makes "b" least recently used */
+    CORRADE_VERIFY(cache.find(font, glyphCache, 1.0f, Alignment::LineLeft, "a"));
+    cache.insert(font, glyphCache, 1.0f, Alignment::LineLeft, "c", run(3.0f));
+    CORRADE_COMPARE(cache.size(), 2);
+
+    CORRADE_VERIFY(cache.find(font, glyphCache, 1.0f, Alignment::LineLeft, "a"));
+    CORRADE_VERIFY(!cache.find(font, glyphCache, 1.0f, Alignment::LineLeft, "b"));
+    CORRADE_VERIFY(cache.find(font, glyphCache, 1.0f, Alignment::LineLeft, "c"));
+}
+
+void LayoutCacheTest::clear() {
+    LayoutCache cache;
+    cache.insert(font, glyphCache, 1.0f, Alignment::LineLeft, "a", run(1.0f));
+    cache.insert(font, glyphCache, 1.0f, Alignment::LineLeft, "b", run(2.0f));
+    cache.clear();
+    CORRADE_COMPARE(cache.size(), 0);
+    CORRADE_VERIFY(!cache.find(font, glyphCache, 1.0f, Alignment::LineLeft, "a"));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Text::Test::LayoutCacheTest)
@@ -23,8 +23,11 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstring>
+
 #include "Magnum/Test/AbstractOpenGLTester.h"
 #include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/LayoutCache.h"
 #include "Magnum/Text/Renderer.h"
 
 namespace Magnum { namespace Text { namespace Test {
@@ -33,20 +36,39 @@ struct RendererGLTest: Magnum::Test::AbstractOpenGLTester {
     explicit RendererGLTest();
 
     void renderData();
+    void renderDataLayoutCache();
     void renderMesh();
     void renderMeshIndexType();
     void mutableText();
 
     void multiline();
+
+    void batch();
+    void batchUpdate();
+
+    #ifndef MAGNUM_TARGET_GLES2
+    void instanced();
+    void instancedUpdate();
+    #endif
 };
 
 RendererGLTest::RendererGLTest() {
     addTests({&RendererGLTest::renderData,
+              &RendererGLTest::renderDataLayoutCache,
               &RendererGLTest::renderMesh,
               &RendererGLTest::renderMeshIndexType,
               &RendererGLTest::mutableText,
 
-              &RendererGLTest::multiline});
+              &RendererGLTest::multiline,
+
+              &RendererGLTest::batch,
+              &RendererGLTest::batchUpdate,
+
+              #ifndef MAGNUM_TARGET_GLES2
+              &RendererGLTest::instanced,
+              &RendererGLTest::instancedUpdate
+              #endif
+              });
 }
 
 namespace {
@@ -170,6 +192,36 @@ void RendererGLTest::renderData() {
     }));
 }
 
+void RendererGLTest::renderDataLayoutCache() {
+    TestFont font;
+    LayoutCache layoutCache;
+
+    std::vector<Vector2> positions, textureCoordinates;
+    std::vector<UnsignedInt> indices;
+    Range2D bounds;
+    std::tie(positions, textureCoordinates, indices, bounds) = Text::AbstractRenderer::render(font, nullGlyphCache, 0.25f, "abc", Alignment::MiddleRightIntegral, &layoutCache);
+    CORRADE_COMPARE(layoutCache.size(), 1);
+    CORRADE_COMPARE(layoutCache.hits(), 0);
+    CORRADE_COMPARE(layoutCache.misses(), 1);
+
+    /* Second time it's taken from the cache, with the same output as without
+       the cache */
+    std::vector<Vector2> cachedPositions, cachedTextureCoordinates;
+    std::vector<UnsignedInt> cachedIndices;
+    Range2D cachedBounds;
+    std::tie(cachedPositions, cachedTextureCoordinates, cachedIndices, cachedBounds) = Text::AbstractRenderer::render(font, nullGlyphCache, 0.25f, "abc", Alignment::MiddleRightIntegral, &layoutCache);
+    CORRADE_COMPARE(layoutCache.size(), 1);
+    CORRADE_COMPARE(layoutCache.hits(), 1);
+    CORRADE_COMPARE(cachedPositions, positions);
+    CORRADE_COMPARE(cachedTextureCoordinates, textureCoordinates);
+    CORRADE_COMPARE(cachedIndices, indices);
+    CORRADE_COMPARE(cachedBounds, bounds);
+
+    std::tie(cachedPositions, cachedTextureCoordinates, cachedIndices, cachedBounds) = Text::AbstractRenderer::render(font, nullGlyphCache, 0.25f, "abc", Alignment::MiddleRightIntegral);
+    CORRADE_COMPARE(cachedPositions, positions);
+    CORRADE_COMPARE(cachedBounds, bounds);
+}
+
 void RendererGLTest::renderMesh() {
     TestFont font;
     Mesh mesh{NoCreate};
@@ -430,6 +482,215 @@ void RendererGLTest::multiline() {
     }));
 }
 
+void RendererGLTest::batch() {
+    TestFont font;
+    Text::BatchRenderer2D renderer{font, nullGlyphCache, 0.25f, BufferUsage::StaticDraw};
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(renderer.textCount(), 0);
+    CORRADE_COMPARE(renderer.capacity(), 0);
+
+    CORRADE_COMPARE(renderer.add("ab", {1.0f, 0.0f}, 3), 0);
+    CORRADE_COMPARE(renderer.add("c"), 1);
+    CORRADE_COMPARE(renderer.textCount(), 2);
+    CORRADE_COMPARE(renderer.capacity(), 4);
+    CORRADE_COMPARE(renderer.text(0), "ab");
+    CORRADE_COMPARE(renderer.position(0), Vector2(1.0f, 0.0f));
+    CORRADE_COMPARE(renderer.rectangle(0), Range2D({1.0f, -0.25f}, {3.5f, 0.75f}));
+    CORRADE_COMPARE(renderer.rectangle(1), Range2D({0.0f, 0.0f}, {0.75f, 0.5f}));
+
+    renderer.update();
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(renderer.mesh().count(), 24);
+
+    /** @todo How to verify this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    Containers::Array<UnsignedByte> indices = renderer.indexBuffer().data<UnsignedByte>();
+    CORRADE_COMPARE(std::vector<UnsignedByte>(indices.begin(), indices.end()), (std::vector<UnsignedByte>{
+         0,  1,  2,  1,  3,  2,
+         4,  5,  6,  5,  7,  6,
+         8,  9, 10,  9, 11, 10,
+        12, 13, 14, 13, 15, 14
+    }));
+
+    /* Unused third glyph of the first text is degenerate */
+    Containers::Array<Float> vertices = renderer.vertexBuffer().data<Float>();
+    CORRADE_COMPARE(std::vector<Float>(vertices.begin(), vertices.end()), (std::vector<Float>{
+        1.0f,  0.5f, 0.0f, 10.0f,
+        1.0f,  0.0f, 0.0f,  0.0f,
+        1.75f, 0.5f, 6.0f, 10.0f,
+        1.75f, 0.0f, 6.0f,  0.0f,
+
+        2.0f,  0.75f,  6.0f, 10.0f,
+        2.0f, -0.25f,  6.0f,  0.0f,
+        3.5f,  0.75f, 12.0f, 10.0f,
+        3.5f, -0.25f, 12.0f,  0.0f,
+
+        0.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 0.0f,
+
+        0.0f,  0.5f, 0.0f, 10.0f,
+        0.0f,  0.0f, 0.0f,  0.0f,
+        0.75f, 0.5f, 6.0f, 10.0f,
+        0.75f, 0.0f, 6.0f,  0.0f
+    }));
+    #endif
+}
+
+void RendererGLTest::batchUpdate() {
+    TestFont font;
+    Text::BatchRenderer2D renderer{font, nullGlyphCache, 0.25f, BufferUsage::DynamicDraw};
+    renderer.add("ab", {}, 3);
+    renderer.add("c");
+    renderer.update();
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Fits into the capacity, only the range gets updated */
+    renderer.setText(0, "abc");
+    renderer.setPosition(1, {1.0f, 0.0f});
+    CORRADE_COMPARE(renderer.capacity(), 4);
+    CORRADE_COMPARE(renderer.rectangle(0), Range2D({0.0f, -0.5f}, {5.0f, 1.0f}));
+    CORRADE_COMPARE(renderer.rectangle(1), Range2D({1.0f, 0.0f}, {1.75f, 0.5f}));
+    renderer.update();
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(renderer.mesh().count(), 24);
+
+    /** @todo How to verify this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    Containers::Array<Float> vertices = renderer.vertexBuffer().subData<Float>(32*4, 32);
+    CORRADE_COMPARE(std::vector<Float>(vertices.begin(), vertices.end()), (std::vector<Float>{
+        2.75f,  1.0f, 12.0f, 10.0f,
+        2.75f, -0.5f, 12.0f,  0.0f,
+        5.0f,   1.0f, 18.0f, 10.0f,
+        5.0f,  -0.5f, 18.0f,  0.0f,
+
+        1.0f,  0.5f, 0.0f, 10.0f,
+        1.0f,  0.0f, 0.0f,  0.0f,
+        1.75f, 0.5f, 6.0f, 10.0f,
+        1.75f, 0.0f, 6.0f,  0.0f
+    }));
+    #endif
+
+    /* Doesn't fit anymore, gets moved to the end with doubled capacity */
+    renderer.setText(1, "ab");
+    CORRADE_COMPARE(renderer.capacity(), 6);
+    CORRADE_COMPARE(renderer.rectangle(1), Range2D({1.0f, -0.25f}, {3.5f, 0.75f}));
+    renderer.update();
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(renderer.mesh().count(), 36);
+
+    /** @todo How to verify this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    /* Old range is degenerate */
+    Containers::Array<Float> old = renderer.vertexBuffer().subData<Float>(48*4, 16);
+    CORRADE_COMPARE(std::vector<Float>(old.begin(), old.end()), std::vector<Float>(16, 0.0f));
+    #endif
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace {
+    struct Glyph {
+        Vector4 rectangle, textureRectangle;
+        Color4ub color;
+    };
+
+    /** @todo How to verify this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    std::vector<Glyph> glyphs(Buffer& buffer) {
+        Containers::Array<char> data = buffer.data<char>();
+        std::vector<Glyph> out(data.size()/sizeof(Glyph));
+        std::memcpy(out.data(), data.data(), out.size()*sizeof(Glyph));
+        return out;
+    }
+    #endif
+}
+
+void RendererGLTest::instanced() {
+    TestFont font;
+    Text::InstancedRenderer renderer{font, nullGlyphCache, 0.25f, BufferUsage::StaticDraw};
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(renderer.textCount(), 0);
+    CORRADE_COMPARE(renderer.capacity(), 0);
+    CORRADE_COMPARE(renderer.mesh().count(), 4);
+
+    CORRADE_COMPARE(renderer.add("ab", {1.0f, 0.0f}, Color4{1.0f, 0.0f, 0.0f}, 3), 0);
+    CORRADE_COMPARE(renderer.add("c"), 1);
+    CORRADE_COMPARE(renderer.textCount(), 2);
+    CORRADE_COMPARE(renderer.capacity(), 4);
+    CORRADE_COMPARE(renderer.color(0), (Color4{1.0f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(renderer.color(1), Color4{1.0f});
+    CORRADE_COMPARE(renderer.rectangle(0), Range2D({1.0f, -0.25f}, {3.5f, 0.75f}));
+
+    renderer.update();
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(renderer.mesh().instanceCount(), 4);
+
+    #ifndef MAGNUM_TARGET_GLES
+    const std::vector<Glyph> data = glyphs(renderer.instanceBuffer());
+    CORRADE_COMPARE(data.size(), 4);
+    CORRADE_COMPARE(data[0].rectangle, (Vector4{1.0f, 0.0f, 1.75f, 0.5f}));
+    CORRADE_COMPARE(data[0].textureRectangle, (Vector4{0.0f, 0.0f, 6.0f, 10.0f}));
+    CORRADE_COMPARE(data[0].color, (Color4ub{255, 0, 0, 255}));
+    CORRADE_COMPARE(data[1].rectangle, (Vector4{2.0f, -0.25f, 3.5f, 0.75f}));
+    CORRADE_COMPARE(data[1].textureRectangle, (Vector4{6.0f, 0.0f, 12.0f, 10.0f}));
+
+    /* Unused third glyph of the first text has zero area */
+    CORRADE_COMPARE(data[2].rectangle, Vector4{});
+
+    CORRADE_COMPARE(data[3].rectangle, (Vector4{0.0f, 0.0f, 0.75f, 0.5f}));
+    CORRADE_COMPARE(data[3].color, (Color4ub{255, 255, 255, 255}));
+    #endif
+}
+
+void RendererGLTest::instancedUpdate() {
+    TestFont font;
+    Text::InstancedRenderer renderer{font, nullGlyphCache, 0.25f, BufferUsage::DynamicDraw};
+    renderer.add("ab", {}, Color4{1.0f}, 3);
+    renderer.add("c");
+    renderer.update();
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Fits into the capacity, only the ranges get updated */
+    renderer.setText(0, "abc");
+    renderer.setPosition(1, {1.0f, 0.0f});
+    renderer.setColor(1, Color4{0.0f, 0.0f, 1.0f});
+    CORRADE_COMPARE(renderer.capacity(), 4);
+    CORRADE_COMPARE(renderer.rectangle(1), Range2D({1.0f, 0.0f}, {1.75f, 0.5f}));
+    renderer.update();
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(renderer.mesh().instanceCount(), 4);
+
+    #ifndef MAGNUM_TARGET_GLES
+    {
+        const std::vector<Glyph> data = glyphs(renderer.instanceBuffer());
+        CORRADE_COMPARE(data[2].rectangle, (Vector4{2.75f, -0.5f, 5.0f, 1.0f}));
+        CORRADE_COMPARE(data[2].textureRectangle, (Vector4{12.0f, 0.0f, 18.0f, 10.0f}));
+        CORRADE_COMPARE(data[3].rectangle, (Vector4{1.0f, 0.0f, 1.75f, 0.5f}));
+        CORRADE_COMPARE(data[3].color, (Color4ub{0, 0, 255, 255}));
+    }
+    #endif
+
+    /* Doesn't fit anymore, gets moved to the end with doubled capacity */
+    renderer.setText(1, "ab");
+    CORRADE_COMPARE(renderer.capacity(), 6);
+    renderer.update();
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(renderer.mesh().instanceCount(), 6);
+
+    #ifndef MAGNUM_TARGET_GLES
+    {
+        /* Old range is empty, the color is kept */
+        const std::vector<Glyph> data = glyphs(renderer.instanceBuffer());
+        CORRADE_COMPARE(data[3].rectangle, Vector4{});
+        CORRADE_COMPARE(data[4].rectangle, (Vector4{1.0f, 0.0f, 1.75f, 0.5f}));
+        CORRADE_COMPARE(data[5].color, (Color4ub{0, 0, 255, 255}));
+    }
+    #endif
+}
+#endif
+
 }}}
 
+
 MAGNUM_GL_TEST_MAIN(Magnum::Text::Test::RendererGLTest)
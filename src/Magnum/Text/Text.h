@@ -38,8 +38,15 @@ namespace Magnum { namespace Text {
 class AbstractFont;
 class AbstractFontConverter;
 class AbstractLayouter;
+#ifndef MAGNUM_TARGET_GLES2
+class ArrayGlyphCache;
+#endif
+class BatchLayouter;
 class DistanceFieldGlyphCache;
+class DynamicGlyphCache;
 class GlyphCache;
+class KerningTable;
+class LayoutCache;
 
 enum class Alignment: UnsignedByte;
 
@@ -47,6 +54,15 @@ class AbstractRenderer;
 template<UnsignedInt> class Renderer;
 typedef Renderer<2> Renderer2D;
 typedef Renderer<3> Renderer3D;
+
+class AbstractBatchRenderer;
+template<UnsignedInt> class BatchRenderer;
+typedef BatchRenderer<2> BatchRenderer2D;
+typedef BatchRenderer<3> BatchRenderer3D;
+
+#ifndef MAGNUM_TARGET_GLES2
+class InstancedRenderer;
+#endif
 #endif
 
 }}
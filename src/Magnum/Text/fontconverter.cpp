@@ -23,13 +23,22 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
+#include <thread>
+#include <Corrade/Containers/Array.h>
 #include <Corrade/PluginManager/Manager.h>
 #include <Corrade/Utility/Arguments.h>
 #include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/Unicode.h>
 
+#include "Magnum/Image.h"
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/Text/AbstractFont.h"
 #include "Magnum/Text/AbstractFontConverter.h"
 #include "Magnum/Text/DistanceFieldGlyphCache.h"
+#include "Magnum/TextureTools/DistanceField.h"
 #include "Magnum/Trade/AbstractImageConverter.h"
 
 #ifdef MAGNUM_TARGET_HEADLESS
@@ -66,7 +75,7 @@ namespace Magnum {
 
 @section magnum-fontconverter-usage Usage
 
-    magnum-fontconverter [--magnum-...] [-h|--help] --font FONT --converter CONVERTER [--plugin-dir DIR] [--characters CHARACTERS] [--font-size N] [--atlas-size "X Y"] [--output-size "X Y"] [--radius N] [--] input output
+    magnum-fontconverter [--magnum-...] [-h|--help] --font FONT --converter CONVERTER [--plugin-dir DIR] [--characters CHARACTERS] [--font-size N] [--atlas-size "X Y"] [--output-size "X Y"] [--radius N] [--cpu] [--threads N] [--] input output
 
 Arguments:
 
@@ -84,11 +93,26 @@ Arguments:
 -   `--output-size "X Y"` -- output atlas size. If set to zero size, distance
     field computation will not be used. (default: `"256 256"`)
 -   `--radius N` -- distance field computation radius (default: `24`)
+-   `--cpu` -- rasterize the glyphs and compute the distance field on the
+    CPU. Requires the font plugin to support
+    @ref Text::AbstractFont::Feature::GlyphRasterization "GlyphRasterization".
+-   `--threads N` -- count of threads to use with `--cpu` (default: `0`,
+    which means all available cores)
 -   `--magnum-...` -- engine-specific options (see @ref Context for details)
 
 The resulting font files can be then used as specified in the documentation of
 `converter` plugin.
 
+By default the glyph cache is filled using @ref Text::AbstractFont::fillGlyphCache()
+and the distance field is computed on the GPU using
+@ref Text::DistanceFieldGlyphCache. With `--cpu`, each thread opens its own
+instance of the font and rasterizes a part of the glyphs using
+@ref Text::AbstractFont::rasterizeGlyph(), the glyphs are then packed into the
+atlas using @ref TextureTools::AtlasPacker and the distance field is computed
+using @ref TextureTools::distanceField(const ImageView2D&, const Vector2i&, Int, UnsignedInt).
+The GL context is then used only for uploading the final image, so large
+character sets such as CJK convert in a fraction of the time.
+
 @section magnum-fontconverter-example Example usage
 
 Making raster font from TTF file with default set of characters using
@@ -98,8 +122,9 @@ Making raster font from TTF file with default set of characters using
     magnum-fontconverter --font FreeTypeFont --converter MagnumFontConverter DejaVuSans.ttf myfont
 
 According to `MagnumFontConverter` plugin documentation, this will generate
-files `myfont.conf` and `myfont.tga` in current directory. You can then load
-and use them with the @ref Text::MagnumFont "MagnumFont" plugin.
+files `myfont.conf`, `myfont.mgfont` and `myfont.tga` in current directory.
+You can then load and use them with the @ref Text::MagnumFont "MagnumFont"
+plugin, opening either the text or the binary glyph table.
 */
 
 namespace Text {
@@ -111,6 +136,8 @@ class FontConverter: public Platform::WindowlessApplication {
         int exec() override;
 
     private:
+        std::unique_ptr<GlyphCache> rasterizeGlyphCache(PluginManager::Manager<AbstractFont>& fontManager, AbstractFont& font);
+
         Utility::Arguments args;
 };
 
@@ -127,6 +154,8 @@ FontConverter::FontConverter(const Arguments& arguments): Platform::WindowlessAp
         .addOption("atlas-size", "2048 2048").setHelp("atlas-size", "glyph atlas size", "\"X Y\"")
         .addOption("output-size", "256 256").setHelp("output-size", "output atlas size. If set to zero size, distance field computation will not be used.", "\"X Y\"")
         .addOption("radius", "24").setHelp("radius", "distance field computation radius", "N")
+        .addBooleanOption("cpu").setHelp("cpu", "rasterize the glyphs and compute the distance field on the CPU")
+        .addOption("threads", "0").setHelp("threads", "count of threads to use with --cpu, 0 for all available cores", "N")
         .addSkippedPrefix("magnum", "engine-specific options")
         .setHelp("Converts font to raster one of given atlas size.")
         .parse(arguments.argc, arguments.argv);
@@ -156,9 +185,20 @@ int FontConverter::exec() {
         std::exit(1);
     }
 
-    /* Create distance field glyph cache if radius is specified */
     std::unique_ptr<Text::GlyphCache> cache;
-    if(!args.value<Vector2i>("output-size").isZero()) {
+
+    /* Rasterize and convert the glyphs on the CPU */
+    if(args.isSet("cpu")) {
+        if(!(font->features() & AbstractFont::Feature::GlyphRasterization)) {
+            Error() << "Font plugin" << args.value("font") << "doesn't support glyph rasterization";
+            std::exit(1);
+        }
+
+        cache = rasterizeGlyphCache(fontManager, *font);
+        if(!cache) std::exit(1);
+
+    /* Create distance field glyph cache if radius is specified */
+    } else if(!args.value<Vector2i>("output-size").isZero()) {
         Debug() << "Populating distance field glyph cache...";
 
         cache.reset(new Text::DistanceFieldGlyphCache(
@@ -174,7 +214,8 @@ int FontConverter::exec() {
     }
 
     /* Fill the cache */
-    font->fillGlyphCache(*cache, args.value("characters"));
+    if(!args.isSet("cpu"))
+        font->fillGlyphCache(*cache, args.value("characters"));
 
     Debug() << "Converting font...";
 
@@ -189,6 +230,91 @@ int FontConverter::exec() {
     return 0;
 }
 
+std::unique_ptr<GlyphCache> FontConverter::rasterizeGlyphCache(PluginManager::Manager<AbstractFont>& fontManager, AbstractFont& font) {
+    const Vector2i atlasSize = args.value<Vector2i>("atlas-size");
+    const Vector2i outputSize = args.value<Vector2i>("output-size");
+    const Int radius = args.value<Int>("radius");
+
+    /* Unique glyphs for all characters */
+    const std::u32string characters = Utility::Unicode::utf32(args.value("characters"));
+    std::vector<UnsignedInt> glyphs(characters.size());
+    font.glyphIds({characters.data(), characters.size()}, {glyphs.data(), glyphs.size()});
+    std::sort(glyphs.begin(), glyphs.end());
+    glyphs.erase(std::unique(glyphs.begin(), glyphs.end()), glyphs.end());
+
+    UnsignedInt threadCount = args.value<UnsignedInt>("threads");
+    if(!threadCount) threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    threadCount = std::max(std::min(threadCount, UnsignedInt(glyphs.size())), 1u);
+
+    /* Font plugins don't need to be thread-safe, so each thread gets its own
+       instance. Create them upfront as the manager isn't thread-safe
+       either. */
+    std::vector<std::unique_ptr<AbstractFont>> instances;
+    std::vector<AbstractFont*> fonts{&font};
+    for(UnsignedInt i = 1; i != threadCount; ++i) {
+        instances.push_back(fontManager.instance(args.value("font")));
+        if(!instances.back()->openFile(args.value("input"), args.value<Float>("font-size"))) {
+            Error() << "Cannot open font" << args.value("input");
+            return nullptr;
+        }
+        fonts.push_back(instances.back().get());
+    }
+
+    Debug() << "Rasterizing" << glyphs.size() << "glyphs in" << threadCount << "threads...";
+
+    /* Interleave the glyphs among font instances, so each gets a similar mix
+       of simple and complex ones. Each instance is a separate task, so it's
+       never used from two threads at once. */
+    std::vector<std::optional<Image2D>> images(glyphs.size());
+    std::vector<Vector2i> positions(glyphs.size());
+    Magnum::Implementation::parallelFor(threadCount, threadCount, 1, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t instance = begin; instance != end; ++instance)
+            for(std::size_t i = instance; i < glyphs.size(); i += threadCount)
+                images[i] = fonts[instance]->rasterizeGlyph(glyphs[i], positions[i]);
+    });
+
+    std::vector<Vector2i> sizes;
+    sizes.reserve(glyphs.size());
+    for(std::size_t i = 0; i != glyphs.size(); ++i) {
+        if(!images[i]) {
+            Error() << "Cannot rasterize glyph" << glyphs[i];
+            return nullptr;
+        }
+        sizes.push_back(images[i]->size());
+    }
+
+    /* Pack the glyphs, padded by the radius so the distance fields of
+       neighboring glyphs don't overlap */
+    std::unique_ptr<GlyphCache> cache{outputSize.isZero() ?
+        new GlyphCache{atlasSize} :
+        new GlyphCache{atlasSize, outputSize, Vector2i{radius}}};
+    const std::vector<Range2Di> ranges = cache->reserve(sizes);
+    if(ranges.empty() && !sizes.empty()) return nullptr;
+
+    /* Copy the glyphs to the atlas, rows are four-byte aligned with the
+       default pixel storage */
+    #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+    const PixelFormat format = PixelFormat::Red;
+    #else
+    const PixelFormat format = PixelFormat::Luminance;
+    #endif
+    const std::size_t rowStride = (atlasSize.x() + 3)/4*4;
+    Image2D atlas{format, PixelType::UnsignedByte, atlasSize, Containers::Array<char>{Containers::ValueInit, rowStride*atlasSize.y()}};
+    for(std::size_t i = 0; i != glyphs.size(); ++i) {
+        copyImage(*images[i], {{}, images[i]->size()}, atlas, ranges[i].bottomLeft());
+        cache->insert(glyphs[i], positions[i], ranges[i]);
+    }
+
+    if(outputSize.isZero()) {
+        cache->setImage({}, atlas);
+    } else {
+        Debug() << "Computing distance field...";
+        cache->setImage({}, TextureTools::distanceField(atlas, outputSize, radius, threadCount));
+    }
+
+    return cache;
+}
+
 }
 
 }
@@ -154,6 +154,47 @@ template<UnsignedInt dimensions> class Texture: public AbstractTexture {
         static Int compressedBlockDataSize(TextureFormat format) {
             return AbstractTexture::compressedBlockDataSize(Implementation::textureTarget<dimensions>(), format);
         }
+
+        /**
+         * @brief Count of virtual page sizes
+         *
+         * Count of page sizes available for sparse textures of given
+         * @p format, zero if the format can't be used for sparse textures.
+         * Available only on 2D and 3D textures.
+         * @see @ref virtualPageSize(), @ref setVirtualPageSizeIndex(),
+         *      @fn_gl{Getinternalformat} with
+         *      @def_gl_extension{NUM_VIRTUAL_PAGE_SIZES,ARB,sparse_texture}
+         * @requires_extension Extension @extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        template<UnsignedInt d = dimensions, class = typename std::enable_if<d == 2 || d == 3>::type>
+        #endif
+        static Int virtualPageSizeCount(TextureFormat format) {
+            return AbstractTexture::virtualPageSizeCount(Implementation::textureTarget<dimensions>(), format);
+        }
+
+        /**
+         * @brief Virtual page size
+         *
+         * Size of a sparse texture page of given @p format (in pixels) for
+         * given page size index. Expects that @p index is less than
+         * @ref virtualPageSizeCount(). Available only on 2D and 3D textures.
+         * @see @ref setVirtualPageSizeIndex(), @fn_gl{Getinternalformat}
+         *      with @def_gl_extension{VIRTUAL_PAGE_SIZE_X,ARB,sparse_texture},
+         *      @def_gl_extension{VIRTUAL_PAGE_SIZE_Y,ARB,sparse_texture},
+         *      @def_gl_extension{VIRTUAL_PAGE_SIZE_Z,ARB,sparse_texture}
+         * @requires_extension Extension @extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        template<UnsignedInt d = dimensions, class = typename std::enable_if<d == 2 || d == 3>::type>
+        #endif
+        static VectorTypeFor<dimensions, Int> virtualPageSize(TextureFormat format, Int index = 0) {
+            return DataHelper<dimensions>::virtualPageSize(Implementation::textureTarget<dimensions>(), format, index);
+        }
         #endif
 
         /**
@@ -723,6 +764,131 @@ template<UnsignedInt dimensions> class Texture: public AbstractTexture {
             return *this;
         }
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Make the texture sparse
+         * @return Reference to self (for method chaining)
+         *
+         * Sparse textures have only virtual address space reserved by
+         * @ref setStorage(), memory is then allocated page by page using
+         * @ref commitPages(). Has to be called before @ref setStorage().
+         * Available only on 2D and 3D textures. If neither
+         * @extension{ARB,direct_state_access} (part of OpenGL 4.5) nor
+         * @extension{EXT,direct_state_access} desktop extension is
+         * available, the texture is bound before the operation (if not
+         * already). Initial value is `false`.
+         * @see @ref setVirtualPageSizeIndex(), @ref SparseTexturePageTable,
+         *      @fn_gl2{TextureParameter,TexParameter},
+         *      @fn_gl_extension{TextureParameter,EXT,direct_state_access},
+         *      eventually @fn_gl{ActiveTexture}, @fn_gl{BindTexture} and
+         *      @fn_gl{TexParameter} with @def_gl_extension{TEXTURE_SPARSE,ARB,sparse_texture}
+         * @requires_extension Extension @extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        template<UnsignedInt d = dimensions, class = typename std::enable_if<d == 2 || d == 3>::type>
+        #endif
+        Texture<dimensions>& setSparse(bool sparse) {
+            AbstractTexture::setSparse(sparse);
+            return *this;
+        }
+
+        /**
+         * @brief Set virtual page size index
+         * @return Reference to self (for method chaining)
+         *
+         * Selects one of the page sizes returned by @ref virtualPageSize().
+         * Has to be called before @ref setStorage(). Available only on 2D and
+         * 3D textures. Initial value is `0`.
+         * @see @ref virtualPageSizeCount(),
+         *      @fn_gl2{TextureParameter,TexParameter},
+         *      @fn_gl_extension{TextureParameter,EXT,direct_state_access},
+         *      eventually @fn_gl{ActiveTexture}, @fn_gl{BindTexture} and
+         *      @fn_gl{TexParameter} with @def_gl_extension{VIRTUAL_PAGE_SIZE_INDEX,ARB,sparse_texture}
+         * @requires_extension Extension @extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        template<UnsignedInt d = dimensions, class = typename std::enable_if<d == 2 || d == 3>::type>
+        #endif
+        Texture<dimensions>& setVirtualPageSizeIndex(Int index) {
+            AbstractTexture::setVirtualPageSizeIndex(index);
+            return *this;
+        }
+
+        /**
+         * @brief Count of sparse levels
+         *
+         * Levels from this one on form a *mip tail*, which is committed and
+         * decommitted as a whole by any @ref commitPages() or
+         * @ref decommitPages() call affecting one of them. Available only on
+         * 2D and 3D textures. The texture is bound before the operation (if
+         * not already).
+         * @see @fn_gl{ActiveTexture}, @fn_gl{BindTexture} and
+         *      @fn_gl{GetTexParameter} with @def_gl_extension{NUM_SPARSE_LEVELS,ARB,sparse_texture}
+         * @requires_extension Extension @extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        template<UnsignedInt d = dimensions, class = typename std::enable_if<d == 2 || d == 3>::type>
+        #endif
+        Int sparseLevelCount() {
+            return AbstractTexture::sparseLevelCount();
+        }
+
+        /**
+         * @brief Commit pages of a sparse texture
+         * @param level             Mip level
+         * @param range             Range to commit
+         * @return Reference to self (for method chaining)
+         *
+         * Allocates memory for all pages in given range. The range is
+         * expected to be a multiple of @ref virtualPageSize() or to extend
+         * to the level edge. Contents of newly committed pages are undefined.
+         * Available only on 2D and 3D textures made sparse using
+         * @ref setSparse(). The texture is bound before the operation (if
+         * not already).
+         * @see @ref decommitPages(), @ref sparseLevelCount(),
+         *      @fn_gl{ActiveTexture}, @fn_gl{BindTexture} and
+         *      @fn_gl_extension{TexPageCommitment,ARB,sparse_texture}
+         * @requires_extension Extension @extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        template<UnsignedInt d = dimensions, class = typename std::enable_if<d == 2 || d == 3>::type>
+        #endif
+        Texture<dimensions>& commitPages(Int level, const RangeTypeFor<dimensions, Int>& range) {
+            DataHelper<dimensions>::pageCommitment(*this, level, range, true);
+            return *this;
+        }
+
+        /**
+         * @brief Decommit pages of a sparse texture
+         * @param level             Mip level
+         * @param range             Range to decommit
+         * @return Reference to self (for method chaining)
+         *
+         * Frees memory of all pages in given range. See @ref commitPages()
+         * for more information.
+         * @see @fn_gl{ActiveTexture}, @fn_gl{BindTexture} and
+         *      @fn_gl_extension{TexPageCommitment,ARB,sparse_texture}
+         * @requires_extension Extension @extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        template<UnsignedInt d = dimensions, class = typename std::enable_if<d == 2 || d == 3>::type>
+        #endif
+        Texture<dimensions>& decommitPages(Int level, const RangeTypeFor<dimensions, Int>& range) {
+            DataHelper<dimensions>::pageCommitment(*this, level, range, false);
+            return *this;
+        }
+        #endif
+
         #ifndef MAGNUM_TARGET_GLES2
         /**
          * @brief Image size in given mip level
@@ -790,6 +956,26 @@ template<UnsignedInt dimensions> class Texture: public AbstractTexture {
          */
         Image<dimensions> image(Int level, Image<dimensions>&& image);
 
+        /**
+         * @brief Read given mip level of texture to existing memory
+         * @param level             Mip level
+         * @param storage           Storage of pixel data
+         * @param format            Format of pixel data
+         * @param type              Data type of pixel data
+         * @param data              Memory where to put the data
+         *
+         * Similar to @ref image(Int, Image<dimensions>&), but reads directly
+         * into user-provided memory, which makes it usable for repeated
+         * readbacks without any allocation. Expects that @p data is large
+         * enough to contain the whole level (see @ref imageSize()) with
+         * given @p storage, @p format and @p type.
+         * @requires_gl Texture image queries are not available in OpenGL ES or
+         *      WebGL. See @ref Framebuffer::read() for possible workaround.
+         */
+        void image(Int level, const PixelStorage& storage, PixelFormat format, PixelType type, Containers::ArrayView<char> data) {
+            AbstractTexture::image<dimensions>(level, storage, format, type, data);
+        }
+
         /**
          * @brief Read given mip level of texture to buffer image
          * @param level             Mip level
@@ -1114,7 +1300,9 @@ template<UnsignedInt dimensions> class Texture: public AbstractTexture {
          * If neither @extension{ARB,direct_state_access} (part of OpenGL 4.5)
          * nor @extension{EXT,direct_state_access} desktop extension is
          * available, the texture is bound before the operation (if not
-         * already).
+         * already). The upload is done synchronously, see
+         * @ref TextureUploadQueue for a way to stream large amounts of data
+         * without blocking.
          * @see @ref setStorage(), @ref Framebuffer::copySubImage(),
          *      @fn_gl{PixelStore}, @fn_gl2{TextureSubImage1D,TexSubImage1D} /
          *      @fn_gl2{TextureSubImage2D,TexSubImage2D} / @fn_gl2{TextureSubImage3D,TexSubImage3D},
@@ -137,6 +137,39 @@ template<UnsignedInt dimensions> class TextureArray: public AbstractTexture {
         static Int compressedBlockDataSize(TextureFormat format) {
             return AbstractTexture::compressedBlockDataSize(Implementation::textureArrayTarget<dimensions>(), format);
         }
+
+        /**
+         * @copybrief Texture::virtualPageSizeCount()
+         *
+         * Available only on 2D texture arrays. See
+         * @ref Texture::virtualPageSizeCount() for more information.
+         * @requires_extension Extension @extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        template<UnsignedInt d = dimensions, class = typename std::enable_if<d == 2>::type>
+        #endif
+        static Int virtualPageSizeCount(TextureFormat format) {
+            return AbstractTexture::virtualPageSizeCount(Implementation::textureArrayTarget<dimensions>(), format);
+        }
+
+        /**
+         * @copybrief Texture::virtualPageSize()
+         *
+         * Pages of texture arrays are always one layer deep. Available only
+         * on 2D texture arrays. See @ref Texture::virtualPageSize() for more
+         * information.
+         * @requires_extension Extension @extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        template<UnsignedInt d = dimensions, class = typename std::enable_if<d == 2>::type>
+        #endif
+        static VectorTypeFor<dimensions, Int> virtualPageSize(TextureFormat format, Int index = 0) {
+            return DataHelper<dimensions>::virtualPageSize(Implementation::textureArrayTarget<dimensions>(), format, index);
+        }
         #endif
 
         /**
@@ -454,6 +487,98 @@ template<UnsignedInt dimensions> class TextureArray: public AbstractTexture {
             return *this;
         }
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @copybrief Texture::setSparse()
+         * @return Reference to self (for method chaining)
+         *
+         * Available only on 2D texture arrays. See @ref Texture::setSparse()
+         * for more information.
+         * @requires_extension Extension @extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        template<UnsignedInt d = dimensions, class = typename std::enable_if<d == 2>::type>
+        #endif
+        TextureArray<dimensions>& setSparse(bool sparse) {
+            AbstractTexture::setSparse(sparse);
+            return *this;
+        }
+
+        /**
+         * @copybrief Texture::setVirtualPageSizeIndex()
+         * @return Reference to self (for method chaining)
+         *
+         * Available only on 2D texture arrays. See
+         * @ref Texture::setVirtualPageSizeIndex() for more information.
+         * @requires_extension Extension @extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        template<UnsignedInt d = dimensions, class = typename std::enable_if<d == 2>::type>
+        #endif
+        TextureArray<dimensions>& setVirtualPageSizeIndex(Int index) {
+            AbstractTexture::setVirtualPageSizeIndex(index);
+            return *this;
+        }
+
+        /**
+         * @copybrief Texture::sparseLevelCount()
+         *
+         * Available only on 2D texture arrays. See
+         * @ref Texture::sparseLevelCount() for more information.
+         * @requires_extension Extension @extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        template<UnsignedInt d = dimensions, class = typename std::enable_if<d == 2>::type>
+        #endif
+        Int sparseLevelCount() {
+            return AbstractTexture::sparseLevelCount();
+        }
+
+        /**
+         * @copybrief Texture::commitPages()
+         * @return Reference to self (for method chaining)
+         *
+         * The third dimension of @p range specifies the layers. Available
+         * only on 2D texture arrays. See @ref Texture::commitPages() for more
+         * information.
+         * @requires_extension Extension @extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        template<UnsignedInt d = dimensions, class = typename std::enable_if<d == 2>::type>
+        #endif
+        TextureArray<dimensions>& commitPages(Int level, const RangeTypeFor<dimensions+1, Int>& range) {
+            DataHelper<dimensions+1>::pageCommitment(*this, level, range, true);
+            return *this;
+        }
+
+        /**
+         * @copybrief Texture::decommitPages()
+         * @return Reference to self (for method chaining)
+         *
+         * The third dimension of @p range specifies the layers. Available
+         * only on 2D texture arrays. See @ref Texture::decommitPages() for
+         * more information.
+         * @requires_extension Extension @extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES or
+         *      WebGL.
+         */
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        template<UnsignedInt d = dimensions, class = typename std::enable_if<d == 2>::type>
+        #endif
+        TextureArray<dimensions>& decommitPages(Int level, const RangeTypeFor<dimensions+1, Int>& range) {
+            DataHelper<dimensions+1>::pageCommitment(*this, level, range, false);
+            return *this;
+        }
+        #endif
+
         #ifndef MAGNUM_TARGET_WEBGL
         /**
          * @copybrief Texture::imageSize()
@@ -0,0 +1,164 @@
+#ifndef Magnum_TextureHandle_h
+#define Magnum_TextureHandle_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES
+/** @file
+ * @brief Class @ref Magnum::TextureHandle
+ */
+
+#include <utility>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum {
+
+/**
+@brief Bindless texture handle
+
+Wraps a bindless handle of a texture, which can be passed directly to the
+shader without binding the texture to any texture unit. The handle can be set
+as a `sampler*` uniform using
+@ref AbstractShaderProgram::setUniform(Int, const TextureHandle&) or written
+into an uniform or shader storage buffer as `uvec2` (or
+`sampler*` with `layout(bindless_sampler)`) and then
+accessed from the shader. This completely removes the need for per-draw
+texture binding.
+
+## Usage
+
+The handle is created from any texture type, e.g. @ref Texture2D,
+@ref Texture2DArray or @ref CubeMapTexture. It is made resident on
+construction and non-resident on destruction, so the texture is accessible to
+shaders for the whole lifetime of the handle instance:
+@code
+Texture2D texture;
+texture.setStorage(...)
+    .setSubImage(...);
+
+TextureHandle handle{texture};
+shader.setTexture(handle);
+@endcode
+
+Note that once the handle is created, the texture storage, wrapping,
+filtering and all other sampling state is immutable until the texture is
+destroyed. Make sure the handle is destroyed before the texture.
+
+Residency of the handle can be also controlled manually using
+@ref makeResident() and @ref makeNonResident(), for example to keep only
+currently used textures resident if there is too many of them. Accessing
+non-resident handle from a shader results in undefined behavior.
+
+@see @ref Shaders::Flat::Flag::BindlessTexture
+@requires_extension Extension @extension{ARB,bindless_texture}
+@requires_gl Bindless textures are not available in OpenGL ES or WebGL.
+*/
+class MAGNUM_EXPORT TextureHandle {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * Gets the handle of given texture and makes it resident. If
+         * @extension{ARB,direct_state_access} (part of OpenGL 4.5) is not
+         * available, the texture is bound to some texture unit before the
+         * operation, if it's not created yet.
+         * @see @fn_gl_extension{GetTextureHandle,ARB,bindless_texture},
+         *      @fn_gl_extension{MakeTextureHandleResident,ARB,bindless_texture}
+         */
+        explicit TextureHandle(AbstractTexture& texture);
+
+        /** @brief Copying is not allowed */
+        TextureHandle(const TextureHandle&) = delete;
+
+        /** @brief Move constructor */
+        TextureHandle(TextureHandle&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Makes the handle non-resident, if it is resident.
+         * @see @fn_gl_extension{MakeTextureHandleNonResident,ARB,bindless_texture}
+         */
+        ~TextureHandle();
+
+        /** @brief Copying is not allowed */
+        TextureHandle& operator=(const TextureHandle&) = delete;
+
+        /** @brief Move assignment */
+        TextureHandle& operator=(TextureHandle&& other) noexcept;
+
+        /** @brief Bindless handle */
+        UnsignedLong handle() const { return _handle; }
+
+        /**
+         * @brief Whether the handle is resident
+         *
+         * @see @ref makeResident(), @ref makeNonResident()
+         */
+        bool isResident() const { return _resident; }
+
+        /**
+         * @brief Make the handle resident
+         * @return Reference to self (for method chaining)
+         *
+         * If the handle is already resident, the function does nothing.
+         * @see @fn_gl_extension{MakeTextureHandleResident,ARB,bindless_texture}
+         */
+        TextureHandle& makeResident();
+
+        /**
+         * @brief Make the handle non-resident
+         * @return Reference to self (for method chaining)
+         *
+         * If the handle is already non-resident, the function does nothing.
+         * @see @fn_gl_extension{MakeTextureHandleNonResident,ARB,bindless_texture}
+         */
+        TextureHandle& makeNonResident();
+
+    private:
+        UnsignedLong _handle;
+        bool _resident;
+};
+
+inline TextureHandle::TextureHandle(TextureHandle&& other) noexcept: _handle{other._handle}, _resident{other._resident} {
+    other._handle = 0;
+    other._resident = false;
+}
+
+inline TextureHandle& TextureHandle::operator=(TextureHandle&& other) noexcept {
+    using std::swap;
+    swap(_handle, other._handle);
+    swap(_resident, other._resident);
+    return *this;
+}
+
+}
+#else
+#error this header is not available in OpenGL ES build
+#endif
+
+#endif
@@ -0,0 +1,140 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "TextureSet.h"
+
+#include <algorithm>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/AbstractTexture.h"
+#include "Magnum/Context.h"
+#include "Magnum/Sampler.h"
+
+#include "Implementation/State.h"
+#include "Implementation/TextureState.h"
+
+namespace Magnum {
+
+/** @todoc const std::initializer_list makes Doxygen grumpy */
+TextureSet::TextureSet(const Int firstTextureUnit, std::initializer_list<AbstractTexture*> textures): _firstTextureUnit{firstTextureUnit}, _textures{textures.size()}, _targets{Containers::ValueInit, textures.size()}, _ids{Containers::ValueInit, textures.size()} {
+    std::copy(textures.begin(), textures.end(), _textures.begin());
+    for(std::size_t i = 0; i != _textures.size(); ++i) resolve(i);
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+TextureSet::TextureSet(const Int firstTextureUnit, std::initializer_list<AbstractTexture*> textures, std::initializer_list<Sampler*> samplers): TextureSet{firstTextureUnit, textures} {
+    CORRADE_ASSERT(samplers.size() == textures.size(),
+        "TextureSet: expected" << textures.size() << "samplers, got" << samplers.size(), );
+    _samplers = Containers::Array<Sampler*>{samplers.size()};
+    _samplerIds = Containers::Array<GLuint>{Containers::ValueInit, samplers.size()};
+    std::copy(samplers.begin(), samplers.end(), _samplers.begin());
+    for(std::size_t i = 0; i != _samplers.size(); ++i)
+        if(_samplers[i]) _samplerIds[i] = _samplers[i]->id();
+}
+#endif
+
+AbstractTexture* TextureSet::texture(const std::size_t i) const {
+    CORRADE_ASSERT(i < _textures.size(), "TextureSet::texture(): index" << i << "out of range for" << _textures.size() << "textures", nullptr);
+    return _textures[i];
+}
+
+TextureSet& TextureSet::setTexture(const std::size_t i, AbstractTexture* const texture) {
+    CORRADE_ASSERT(i < _textures.size(), "TextureSet::setTexture(): index" << i << "out of range for" << _textures.size() << "textures", *this);
+    _textures[i] = texture;
+    resolve(i);
+    return *this;
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+Sampler* TextureSet::sampler(const std::size_t i) const {
+    CORRADE_ASSERT(i < _textures.size(), "TextureSet::sampler(): index" << i << "out of range for" << _textures.size() << "textures", nullptr);
+    return _samplers.empty() ? nullptr : _samplers[i];
+}
+
+TextureSet& TextureSet::setSampler(const std::size_t i, Sampler* const sampler) {
+    CORRADE_ASSERT(!_samplers.empty(), "TextureSet::setSampler(): the set was created without samplers", *this);
+    CORRADE_ASSERT(i < _samplers.size(), "TextureSet::setSampler(): index" << i << "out of range for" << _samplers.size() << "samplers", *this);
+    _samplers[i] = sampler;
+    _samplerIds[i] = sampler ? sampler->id() : 0;
+    return *this;
+}
+#endif
+
+void TextureSet::resolve(const std::size_t i) {
+    AbstractTexture* const texture = _textures[i];
+    if(!texture) {
+        _targets[i] = 0;
+        _ids[i] = 0;
+        return;
+    }
+
+    /* Multi-bind needs the texture object to exist already, so create it now
+       instead of in every bind() call */
+    texture->createIfNotAlready();
+    _targets[i] = texture->_target;
+    _ids[i] = texture->_id;
+}
+
+void TextureSet::bind() {
+    /* State tracker is updated in the implementations */
+    Context::current().state().texture->bindTextureSetImplementation(*this);
+
+    #ifndef MAGNUM_TARGET_GLES2
+    if(!_samplers.empty()) Sampler::bindInternal(_firstTextureUnit, _samplerIds);
+    #endif
+}
+
+void TextureSet::bindImplementationFallback(TextureSet& self) {
+    for(std::size_t i = 0; i != self._textures.size(); ++i)
+        self._textures[i] ? self._textures[i]->bind(self._firstTextureUnit + i) : AbstractTexture::unbind(self._firstTextureUnit + i);
+}
+
+#ifndef MAGNUM_TARGET_GLES
+void TextureSet::bindImplementationMulti(TextureSet& self) {
+    Implementation::TextureState& textureState = *Context::current().state().texture;
+    std::pair<GLenum, GLuint>* const bindings = textureState.bindings + self._firstTextureUnit;
+
+    /* Find the first and the last unit that differs from the state tracker */
+    std::size_t first = 0;
+    std::size_t last = self._ids.size();
+    while(first != last && bindings[first].second == self._ids[first]) ++first;
+    while(last != first && bindings[last - 1].second == self._ids[last - 1]) --last;
+
+    /* Avoid doing the binding if there is nothing different */
+    if(first == last) return;
+
+    /* Update the state tracker and bind only the changed range. Unbound
+       units keep the previous target so AbstractTexture::unbind() can still
+       use it. */
+    for(std::size_t i = first; i != last; ++i) {
+        if(self._ids[i]) bindings[i].first = self._targets[i];
+        bindings[i].second = self._ids[i];
+    }
+    glBindTextures(self._firstTextureUnit + first, last - first, self._ids + first);
+}
+#endif
+
+}
@@ -0,0 +1,225 @@
+#ifndef Magnum_TextureSet_h
+#define Magnum_TextureSet_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::TextureSet
+ */
+
+#include <initializer_list>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/OpenGL.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum {
+
+namespace Implementation { struct TextureState; }
+
+/**
+@brief Texture set
+
+Group of textures bound to a contiguous range of texture units in one go.
+Compared to @ref AbstractTexture::bind(Int, std::initializer_list<AbstractTexture*>),
+the texture targets and IDs are resolved only once, when the set is created or
+modified, so binding the set in a draw loop involves no allocation and no
+indirection through the texture objects.
+
+@code
+TextureSet set{0, {&diffuseTexture, &normalTexture, &specularTexture}};
+
+// ...
+
+set.bind();
+mesh.draw(shader);
+@endcode
+
+@anchor TextureSet-performance-optimization
+## Performance optimizations
+
+If @extension{ARB,multi_bind} (part of OpenGL 4.4) is available, the set is
+compared against the texture binding state tracker and only the range between
+the first and the last changed unit is bound with a single @fn_gl{BindTextures}
+call. If nothing changed, no GL call is made at all. Otherwise the set is bound
+with a sequence of @ref AbstractTexture::bind(Int) calls, each of which is
+again skipped if the texture is already bound in given unit.
+
+On OpenGL 3.3+, OpenGL ES 3.0+ and WebGL 2.0 the set can also reference a
+@ref Sampler for each unit, which is then bound together with the textures.
+A registry such as @ref SamplerRegistry makes it possible to have thousands of
+textures sharing a few sampler objects instead of setting the same filtering
+parameters on each of them:
+
+@code
+SamplerRegistry samplers;
+Sampler& trilinear = samplers.get(Sampler::Configuration{}
+    .setMinificationFilter(Sampler::Filter::Linear, Sampler::Mipmap::Linear));
+
+TextureSet set{0, {&diffuseTexture, &normalTexture}, {&trilinear, &trilinear}};
+@endcode
+
+Sampler bindings go through the same state tracker as @ref Sampler::bind(),
+with @extension{ARB,multi_bind} the changed range is bound with a single
+@fn_gl{BindSamplers} call.
+
+The set doesn't own the textures or samplers, it only references their GL
+IDs. It's up to
+the user to ensure the textures and samplers outlive the set or are replaced
+using @ref setTexture() or @ref setSampler() before binding it again.
+@see @ref AbstractShaderProgram, @ref Shader::maxCombinedTextureImageUnits()
+*/
+class MAGNUM_EXPORT TextureSet {
+    friend Implementation::TextureState;
+
+    public:
+        /**
+         * @brief Constructor
+         * @param firstTextureUnit  First texture unit of the set
+         * @param textures          Textures to bind to
+         *      @p firstTextureUnit, `firstTextureUnit + 1` etc. If any texture
+         *      is `nullptr`, given texture unit is unbound.
+         *
+         * If @extension{ARB,direct_state_access} (part of OpenGL 4.5) is not
+         * available, textures which are not created yet are bound to some
+         * texture unit to create them.
+         */
+        explicit TextureSet(Int firstTextureUnit, std::initializer_list<AbstractTexture*> textures);
+
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Construct with samplers
+         * @param firstTextureUnit  First texture unit of the set
+         * @param textures          Textures to bind to
+         *      @p firstTextureUnit, `firstTextureUnit + 1` etc.
+         * @param samplers          Samplers to bind to the same units. Expected
+         *      to have the same size as @p textures. If any sampler is
+         *      `nullptr`, given unit uses parameters of the texture itself.
+         *
+         * @requires_gl33 Extension @extension{ARB,sampler_objects}
+         * @requires_gles30 Sampler objects are not available in OpenGL ES
+         *      2.0.
+         * @requires_webgl20 Sampler objects are not available in WebGL 1.0.
+         */
+        explicit TextureSet(Int firstTextureUnit, std::initializer_list<AbstractTexture*> textures, std::initializer_list<Sampler*> samplers);
+        #endif
+
+        /** @brief Copying is not allowed */
+        TextureSet(const TextureSet&) = delete;
+
+        /** @brief Move constructor */
+        TextureSet(TextureSet&&) noexcept = default;
+
+        /** @brief Copying is not allowed */
+        TextureSet& operator=(const TextureSet&) = delete;
+
+        /** @brief Move assignment */
+        TextureSet& operator=(TextureSet&&) noexcept = default;
+
+        /** @brief First texture unit of the set */
+        Int firstTextureUnit() const { return _firstTextureUnit; }
+
+        /** @brief Count of textures in the set */
+        std::size_t size() const { return _textures.size(); }
+
+        /**
+         * @brief Texture at given position
+         *
+         * Returns `nullptr` if given texture unit is unbound by the set.
+         */
+        AbstractTexture* texture(std::size_t i) const;
+
+        /**
+         * @brief Replace texture at given position
+         * @return Reference to self (for method chaining)
+         *
+         * Passing `nullptr` causes the texture unit to be unbound. The change
+         * is applied on next @ref bind() call.
+         */
+        TextureSet& setTexture(std::size_t i, AbstractTexture* texture);
+
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Whether the set binds samplers
+         *
+         * @see @ref TextureSet(Int, std::initializer_list<AbstractTexture*>, std::initializer_list<Sampler*>)
+         */
+        bool hasSamplers() const { return !_samplers.empty(); }
+
+        /**
+         * @brief Sampler at given position
+         *
+         * Returns `nullptr` if the set has no samplers or given unit has no
+         * sampler bound by the set.
+         */
+        Sampler* sampler(std::size_t i) const;
+
+        /**
+         * @brief Replace sampler at given position
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the set was created with samplers. Passing `nullptr`
+         * causes the sampler to be unbound from given unit. The change is
+         * applied on next @ref bind() call.
+         */
+        TextureSet& setSampler(std::size_t i, Sampler* sampler);
+        #endif
+
+        /**
+         * @brief Bind the set
+         *
+         * See @ref TextureSet-performance-optimization "class documentation"
+         * for more information.
+         * @note This function is meant to be used only internally from
+         *      @ref AbstractShaderProgram subclasses. See its documentation
+         *      for more information.
+         * @see @fn_gl{BindTextures}, @fn_gl{BindSamplers}, eventually
+         *      @ref AbstractTexture::bind(Int), @ref AbstractTexture::unbind(Int)
+         *      and @ref Sampler::bind(Int)
+         */
+        void bind();
+
+    private:
+        void MAGNUM_LOCAL resolve(std::size_t i);
+
+        static void MAGNUM_LOCAL bindImplementationFallback(TextureSet& self);
+        #ifndef MAGNUM_TARGET_GLES
+        static void MAGNUM_LOCAL bindImplementationMulti(TextureSet& self);
+        #endif
+
+        Int _firstTextureUnit;
+        Containers::Array<AbstractTexture*> _textures;
+        Containers::Array<GLenum> _targets;
+        Containers::Array<GLuint> _ids;
+        #ifndef MAGNUM_TARGET_GLES2
+        Containers::Array<Sampler*> _samplers;
+        Containers::Array<GLuint> _samplerIds;
+        #endif
+};
+
+}
+
+#endif
@@ -0,0 +1,218 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "TextureStreamer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Texture.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/Math/Functions.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum {
+
+Int TextureStreamer::levelForScreenSize(const Vector2i& size, const Int levelCount, const Float screenSize) {
+    if(screenSize <= 0.0f) return levelCount - 1;
+
+    const Float level = std::floor(std::log2(Float(size.max())/screenSize));
+    return Int(Math::clamp(level, 0.0f, Float(levelCount - 1)));
+}
+
+TextureStreamer::TextureStreamer(const std::size_t budget, const UnsignedInt bufferCount): _queue{bufferCount}, _budget{budget}, _uploadLimit{4*1024*1024}, _residentSize{}, _tailSize{64}, _textureCount{}, _uploadCount{}, _evictionCount{} {}
+
+std::size_t TextureStreamer::levelDataSize(const Entry& entry, const Int level) {
+    const ImageView2D& image = entry.levels[level];
+    return image.pixelSize()*image.size().product();
+}
+
+UnsignedInt TextureStreamer::add(Texture2D& texture, const TextureFormat format, const Containers::ArrayView<const ImageView2D> levels) {
+    CORRADE_ASSERT(levels.size(), "TextureStreamer::add(): no levels given", {});
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 1; i != levels.size(); ++i) {
+        const Vector2i expected = Math::max(levels[i - 1].size()/2, Vector2i{1});
+        CORRADE_ASSERT(levels[i].size() == expected,
+            "TextureStreamer::add(): expected level" << i << "to have size" << expected << "but got" << levels[i].size(), {});
+    }
+    #endif
+
+    /* Reuse a slot of a removed texture, if any */
+    UnsignedInt id = 0;
+    while(id != _entries.size() && _entries[id].texture) ++id;
+    if(id == _entries.size()) _entries.emplace_back();
+    ++_textureCount;
+
+    Entry& entry = _entries[id];
+    entry.texture = &texture;
+    entry.format = format;
+    entry.levels.assign(levels.begin(), levels.end());
+    entry.screenSize = entry.requestedScreenSize = 0.0f;
+
+    /* The tail is the first level fitting into the tail size and all after
+       it */
+    const Int levelCount = levels.size();
+    entry.tailLevel = 0;
+    while(entry.tailLevel != levelCount - 1 && (levels[entry.tailLevel].size() > Vector2i{_tailSize}).any())
+        ++entry.tailLevel;
+    entry.desiredLevel = levelCount - 1;
+
+    /* Upload the tail from the coarsest level */
+    entry.baseLevel = levelCount;
+    texture.setMaxLevel(levelCount - 1);
+    while(entry.baseLevel != entry.tailLevel) upload(entry);
+
+    return id;
+}
+
+UnsignedInt TextureStreamer::add(Texture2D& texture, const TextureFormat format, std::initializer_list<ImageView2D> levels) {
+    return add(texture, format, {levels.begin(), levels.size()});
+}
+
+void TextureStreamer::remove(const UnsignedInt id) {
+    CORRADE_ASSERT(id < _entries.size() && _entries[id].texture,
+        "TextureStreamer::remove(): texture" << id << "not found", );
+
+    Entry& entry = _entries[id];
+    for(Int level = entry.baseLevel; level != Int(entry.levels.size()); ++level)
+        _residentSize -= levelDataSize(entry, level);
+    entry.texture = nullptr;
+    entry.levels.clear();
+    --_textureCount;
+}
+
+TextureStreamer& TextureStreamer::request(const UnsignedInt id, const Float screenSize) {
+    CORRADE_ASSERT(id < _entries.size() && _entries[id].texture,
+        "TextureStreamer::request(): texture" << id << "not found", *this);
+
+    Entry& entry = _entries[id];
+    entry.requestedScreenSize = Math::max(entry.requestedScreenSize, screenSize);
+    return *this;
+}
+
+Int TextureStreamer::baseLevel(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _entries.size() && _entries[id].texture,
+        "TextureStreamer::baseLevel(): texture" << id << "not found", {});
+    return _entries[id].baseLevel;
+}
+
+Int TextureStreamer::desiredLevel(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _entries.size() && _entries[id].texture,
+        "TextureStreamer::desiredLevel(): texture" << id << "not found", {});
+    return _entries[id].desiredLevel;
+}
+
+void TextureStreamer::upload(Entry& entry) {
+    const Int level = entry.baseLevel - 1;
+    const ImageView2D& image = entry.levels[level];
+
+    /* Allocate the level and fill it asynchronously, the GL executes the
+       commands in order so the base level can be changed right away */
+    entry.texture->setImage(level, entry.format, ImageView2D{image.storage(), image.format(), image.type(), image.size()});
+    _queue.upload(*entry.texture, level, {}, image);
+    entry.texture->setBaseLevel(level);
+
+    entry.baseLevel = level;
+    _residentSize += levelDataSize(entry, level);
+}
+
+void TextureStreamer::evict(Entry& entry) {
+    const Int level = entry.baseLevel;
+    const ImageView2D& image = entry.levels[level];
+
+    entry.texture->setBaseLevel(level + 1);
+    entry.texture->setImage(level, entry.format, ImageView2D{image.storage(), image.format(), image.type(), {}});
+
+    entry.baseLevel = level + 1;
+    _residentSize -= levelDataSize(entry, level);
+    ++_evictionCount;
+}
+
+bool TextureStreamer::evictFor(const Entry* const entry, const Float screenSize) {
+    /* Prefer levels that are not needed, then levels of textures requested
+       with the smallest size. Levels needed by textures with larger size are
+       never evicted. */
+    Entry* victim = nullptr;
+    bool victimNeeded = true;
+    for(Entry& other: _entries) {
+        if(!other.texture || &other == entry || other.baseLevel >= other.tailLevel) continue;
+
+        const bool needed = other.baseLevel >= other.desiredLevel;
+        if(needed && other.screenSize >= screenSize) continue;
+
+        if(!victim || (victimNeeded && !needed) || (victimNeeded == needed && other.screenSize < victim->screenSize)) {
+            victim = &other;
+            victimNeeded = needed;
+        }
+    }
+
+    if(!victim) return false;
+    evict(*victim);
+    return true;
+}
+
+void TextureStreamer::update() {
+    _uploadCount = _evictionCount = 0;
+
+    /* Take the requests */
+    std::vector<Entry*> candidates;
+    for(Entry& entry: _entries) {
+        if(!entry.texture) continue;
+
+        entry.screenSize = entry.requestedScreenSize;
+        entry.requestedScreenSize = 0.0f;
+        entry.desiredLevel = levelForScreenSize(entry.levels.front().size(), entry.levels.size(), entry.screenSize);
+        if(entry.baseLevel > entry.desiredLevel) candidates.push_back(&entry);
+    }
+
+    /* Enforce the budget if it was lowered */
+    while(_residentSize > _budget && evictFor(nullptr, Constants::inf()));
+
+    /* Largest on screen first */
+    std::stable_sort(candidates.begin(), candidates.end(), [](const Entry* a, const Entry* b) {
+        return a->screenSize > b->screenSize;
+    });
+
+    std::size_t uploaded = 0;
+    for(Entry* const entry: candidates) {
+        while(entry->baseLevel > entry->desiredLevel) {
+            const std::size_t size = levelDataSize(*entry, entry->baseLevel - 1);
+            if(_uploadCount && uploaded + size > _uploadLimit) return;
+
+            while(_residentSize + size > _budget && evictFor(entry, entry->screenSize));
+            if(_residentSize + size > _budget) break;
+
+            upload(*entry);
+            uploaded += size;
+            ++_uploadCount;
+        }
+    }
+}
+
+}
+#endif
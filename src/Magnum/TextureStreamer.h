@@ -0,0 +1,295 @@
+#ifndef Magnum_TextureStreamer_h
+#define Magnum_TextureStreamer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::TextureStreamer
+ */
+#endif
+
+#include <initializer_list>
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/TextureUploadQueue.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum {
+
+/**
+@brief Texture streamer
+
+Keeps only the mip levels of 2D textures that are needed for the current view
+in video memory. For each texture the coarsest levels are uploaded right
+away, finer levels are then uploaded on demand through a
+@ref TextureUploadQueue2D, based on screen-space size of the textured geometry
+reported with @ref request(), as long as the total size of all resident
+levels stays within a memory budget.
+
+## Usage
+
+Image data of all mip levels are kept in client memory, for example in images
+returned by a @ref Trade::AbstractImporter "*Importer" plugin or in a
+memory-mapped file. Each frame, report the size in pixels the whole texture
+would cover on the screen for all visible geometry using it and call
+@ref update():
+@code
+std::vector<Image2D> levels = ...;
+std::vector<ImageView2D> views{levels.begin(), levels.end()};
+
+Texture2D texture;
+texture.setMinificationFilter(Sampler::Filter::Linear, Sampler::Mipmap::Linear);
+
+TextureStreamer streamer{256*1024*1024};
+UnsignedInt id = streamer.add(texture, TextureFormat::RGBA8,
+    Containers::arrayView(views.data(), views.size()));
+
+// each frame
+streamer.request(id, projectedSize)
+    .update();
+@endcode
+
+The image data must be available for as long as the texture is in the
+streamer. The viewed images are expected to be a complete mip chain, i.e. each
+level half the size of the previous one, rounded down.
+
+@anchor TextureStreamer-streaming-strategy
+## Streaming strategy
+
+Levels with size at most @ref tailSize() in both dimensions are uploaded in
+@ref add() and stay resident until the texture is removed with @ref remove(),
+so every texture can be always sampled. The finest level needed for a given
+screen-space size is calculated using @ref levelForScreenSize(). On
+@ref update(), textures that need finer levels are processed from the one with
+largest requested size and each gets its levels uploaded one by one, from
+coarse to fine, until the size uploaded in the update reaches
+@ref uploadLimit(). If there's not enough room in the budget, finest levels
+of other textures are evicted --- first levels that are not needed for their
+latest requested size, then levels of textures requested with smaller size.
+Requests are reset after each update, so a texture that is not requested is
+not streamed in, but it keeps its levels until the memory is needed for
+something else.
+
+The resident levels are restricted using @ref Texture::setBaseLevel() "setBaseLevel()"
+and @ref Texture::setMaxLevel() "setMaxLevel()". The texture levels are
+specified one by one using @ref Texture::setImage() "setImage()" and not with
+@ref Texture::setStorage() "setStorage()", because immutable storage would
+reserve memory for all levels regardless of whether they're resident.
+Evicted levels are redefined to zero size to free their memory.
+
+@see @ref TextureUploadQueue
+@requires_gles30 Base and max level and pixel buffer objects are not
+    available in OpenGL ES 2.0.
+@requires_webgl20 Base and max level and pixel buffer objects are not
+    available in WebGL 1.0.
+*/
+class MAGNUM_EXPORT TextureStreamer {
+    public:
+        /**
+         * @brief Mip level for given screen-space size
+         * @param size          Size of level `0`
+         * @param levelCount    Mip level count
+         * @param screenSize    Size in pixels the texture covers on the
+         *      screen
+         *
+         * Returns the coarsest level that has at least @p screenSize pixels
+         * in the larger dimension, clamped to available levels. If
+         * @p screenSize is not positive, returns the last level.
+         */
+        static Int levelForScreenSize(const Vector2i& size, Int levelCount, Float screenSize);
+
+        /**
+         * @brief Constructor
+         * @param budget        Memory budget in bytes
+         * @param bufferCount   Staging buffer count of the upload queue
+         *
+         * @see @ref TextureUploadQueue::TextureUploadQueue()
+         */
+        explicit TextureStreamer(std::size_t budget, UnsignedInt bufferCount = 3);
+
+        /** @brief Copying is not allowed */
+        TextureStreamer(const TextureStreamer&) = delete;
+
+        /** @brief Moving is not allowed */
+        TextureStreamer(TextureStreamer&&) = delete;
+
+        /** @brief Copying is not allowed */
+        TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+        /** @brief Moving is not allowed */
+        TextureStreamer& operator=(TextureStreamer&&) = delete;
+
+        /** @brief Memory budget in bytes */
+        std::size_t budget() const { return _budget; }
+
+        /**
+         * @brief Set memory budget
+         * @return Reference to self (for method chaining)
+         *
+         * If the resident size exceeds the new budget, levels are evicted in
+         * the next @ref update().
+         */
+        TextureStreamer& setBudget(std::size_t budget) {
+            _budget = budget;
+            return *this;
+        }
+
+        /**
+         * @brief Upload limit in bytes for one @ref update() call
+         *
+         * Default is 4 MB.
+         */
+        std::size_t uploadLimit() const { return _uploadLimit; }
+
+        /**
+         * @brief Set upload limit
+         * @return Reference to self (for method chaining)
+         *
+         * At least one level is uploaded in each @ref update() if any is
+         * needed, even if it's larger than the limit.
+         */
+        TextureStreamer& setUploadLimit(std::size_t limit) {
+            _uploadLimit = limit;
+            return *this;
+        }
+
+        /**
+         * @brief Size of always resident levels
+         *
+         * Default is `64`.
+         */
+        Int tailSize() const { return _tailSize; }
+
+        /**
+         * @brief Set size of always resident levels
+         * @return Reference to self (for method chaining)
+         *
+         * Affects only textures added after this call.
+         */
+        TextureStreamer& setTailSize(Int size) {
+            _tailSize = size;
+            return *this;
+        }
+
+        /**
+         * @brief Size of all resident levels in bytes
+         *
+         * Can be larger than @ref budget() if the always resident levels
+         * don't fit into it.
+         */
+        std::size_t residentSize() const { return _residentSize; }
+
+        /** @brief Count of textures in the streamer */
+        UnsignedInt textureCount() const { return _textureCount; }
+
+        /**
+         * @brief Add a texture
+         * @param texture       Texture
+         * @param format        Internal texture format
+         * @param levels        Image data of all mip levels
+         * @return Texture ID to be used in @ref request()
+         *
+         * Uploads levels with size at most @ref tailSize() and restricts the
+         * texture to them. The texture is expected to not have any storage
+         * allocated. IDs of removed textures are reused.
+         */
+        UnsignedInt add(Texture2D& texture, TextureFormat format, Containers::ArrayView<const ImageView2D> levels);
+
+        /** @overload */
+        UnsignedInt add(Texture2D& texture, TextureFormat format, std::initializer_list<ImageView2D> levels);
+
+        /**
+         * @brief Remove a texture
+         *
+         * The texture contents are left untouched, only the levels stop to
+         * count into @ref residentSize().
+         */
+        void remove(UnsignedInt id);
+
+        /**
+         * @brief Request a screen-space size
+         * @return Reference to self (for method chaining)
+         *
+         * The largest size requested since the last @ref update() is used to
+         * decide which level is needed.
+         * @see @ref levelForScreenSize()
+         */
+        TextureStreamer& request(UnsignedInt id, Float screenSize);
+
+        /** @brief Finest resident level of given texture */
+        Int baseLevel(UnsignedInt id) const;
+
+        /**
+         * @brief Finest needed level of given texture
+         *
+         * Calculated from the largest size requested before the last
+         * @ref update().
+         */
+        Int desiredLevel(UnsignedInt id) const;
+
+        /**
+         * @brief Stream the texture levels
+         *
+         * See @ref TextureStreamer-streaming-strategy "class documentation"
+         * for more information.
+         */
+        void update();
+
+        /** @brief Count of levels uploaded in the last @ref update() */
+        UnsignedInt uploadCount() const { return _uploadCount; }
+
+        /** @brief Count of levels evicted in the last @ref update() */
+        UnsignedInt evictionCount() const { return _evictionCount; }
+
+    private:
+        struct Entry {
+            Texture2D* texture;
+            TextureFormat format;
+            std::vector<ImageView2D> levels;
+            Int baseLevel, tailLevel, desiredLevel;
+            Float screenSize, requestedScreenSize;
+        };
+
+        MAGNUM_LOCAL static std::size_t levelDataSize(const Entry& entry, Int level);
+        MAGNUM_LOCAL void upload(Entry& entry);
+        MAGNUM_LOCAL void evict(Entry& entry);
+        MAGNUM_LOCAL bool evictFor(const Entry* entry, Float screenSize);
+
+        TextureUploadQueue2D _queue;
+        std::vector<Entry> _entries;
+        std::size_t _budget, _uploadLimit, _residentSize;
+        Int _tailSize;
+        UnsignedInt _textureCount, _uploadCount, _evictionCount;
+};
+
+}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
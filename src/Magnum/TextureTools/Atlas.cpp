@@ -25,36 +25,252 @@
 
 #include "Atlas.h"
 
+#include <algorithm>
+#include <numeric>
+
+#include <Corrade/Utility/Assert.h>
+
 #include "Magnum/Math/Functions.h"
-#include "Magnum/Math/Range.h"
 
 namespace Magnum { namespace TextureTools {
 
-std::vector<Range2Di> atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding) {
-    if(sizes.empty()) return {};
+namespace {
 
-    /* Size of largest texture */
-    Vector2i maxSize;
-    for(const Vector2i& size: sizes)
-        maxSize = Math::max(maxSize, size);
+inline bool intersects(const Range2Di& a, const Range2Di& b) {
+    return a.min().x() < b.max().x() && b.min().x() < a.max().x() &&
+           a.min().y() < b.max().y() && b.min().y() < a.max().y();
+}
 
-    std::vector<Range2Di> atlas;
+inline bool contains(const Range2Di& a, const Range2Di& b) {
+    return a.min().x() <= b.min().x() && a.min().y() <= b.min().y() &&
+           a.max().x() >= b.max().x() && a.max().y() >= b.max().y();
+}
 
-    /* Columns and rows */
-    const Vector2i paddedSize = maxSize+2*padding;
-    const Vector2i gridSize = atlasSize/paddedSize;
-    if(std::size_t(gridSize.product()) < sizes.size()) {
-        Error() << "TextureTools::atlas(): requested atlas size" << atlasSize
-                << "is too small to fit" << sizes.size() << paddedSize
-                << "textures. Generated atlas will be empty.";
-        return atlas;
+Long sortKey(const Vector2i& size, const AtlasSortHeuristic sort) {
+    switch(sort) {
+        case AtlasSortHeuristic::None: return 0;
+        case AtlasSortHeuristic::Area: return Long(size.x())*size.y();
+        case AtlasSortHeuristic::Perimeter: return Long(size.x()) + size.y();
+        case AtlasSortHeuristic::MaxSide: return Math::max(size.x(), size.y());
+    }
+
+    return 0; /* LCOV_EXCL_LINE */
+}
+
+}
+
+AtlasPacker::AtlasPacker(const Vector2i& size, const Vector2i& padding, const AtlasPackerFlags flags): _size{size}, _padding{padding}, _flags{flags}, _count{}, _area{} {
+    if(size.product()) _free.push_back({{}, size});
+}
+
+Float AtlasPacker::occupancy() const {
+    const Long area = Long(_size.x())*_size.y();
+    return area ? Float(Double(_area)/area) : 0.0f;
+}
+
+bool AtlasPacker::find(const Vector2i& size, Range2Di& out) const {
+    /* Best short side fit -- choose the free rectangle that leaves the
+       smallest leftover along the shorter side, break ties by the longer
+       side */
+    const bool rotate = (_flags & AtlasPackerFlag::AllowRotation) && size.x() != size.y();
+    Int bestShort = -1, bestLong = -1;
+    for(const Range2Di& free: _free) {
+        const Vector2i freeSize = free.size();
+        for(const Vector2i candidateSize: {size, Vector2i{size.y(), size.x()}}) {
+            const Vector2i candidate = candidateSize + 2*_padding;
+            if(candidate.x() <= freeSize.x() && candidate.y() <= freeSize.y()) {
+                const Vector2i leftover = freeSize - candidate;
+                const Int shortSide = Math::min(leftover.x(), leftover.y());
+                const Int longSide = Math::max(leftover.x(), leftover.y());
+                if(bestShort == -1 || shortSide < bestShort || (shortSide == bestShort && longSide < bestLong)) {
+                    bestShort = shortSide;
+                    bestLong = longSide;
+                    out = Range2Di::fromSize(free.min(), candidate);
+                }
+            }
+
+            if(!rotate) break;
+        }
+    }
+
+    return bestShort != -1;
+}
+
+void AtlasPacker::place(const Range2Di& range) {
+    /* Split all free rectangles overlapping the placed one into up to four
+       maximal rectangles around it */
+    std::vector<Range2Di> free;
+    free.reserve(_free.size() + 4);
+    for(const Range2Di& f: _free) {
+        if(!intersects(f, range)) {
+            free.push_back(f);
+            continue;
+        }
+
+        if(range.min().x() > f.min().x())
+            free.push_back({f.min(), {range.min().x(), f.max().y()}});
+        if(range.max().x() < f.max().x())
+            free.push_back({{range.max().x(), f.min().y()}, f.max()});
+        if(range.min().y() > f.min().y())
+            free.push_back({f.min(), {f.max().x(), range.min().y()}});
+        if(range.max().y() < f.max().y())
+            free.push_back({{f.min().x(), range.max().y()}, f.max()});
+    }
+
+    prune(free);
+}
+
+void AtlasPacker::prune(const std::vector<Range2Di>& free) {
+    /* Remove rectangles fully contained in other ones. Of two equal
+       rectangles only the first is kept. */
+    _free.clear();
+    for(std::size_t i = 0; i != free.size(); ++i) {
+        bool contained = false;
+        for(std::size_t j = 0; j != free.size() && !contained; ++j)
+            contained = i != j && contains(free[j], free[i]) && (j < i || free[j] != free[i]);
+        if(!contained) _free.push_back(free[i]);
+    }
+}
+
+std::optional<Range2Di> AtlasPacker::add(const Vector2i& size) {
+    Range2Di range;
+    if(!find(size, range)) return std::nullopt;
+
+    place(range);
+    ++_count;
+    _area += Long(size.x())*size.y();
+    return Range2Di{range.min() + _padding, range.max() - _padding};
+}
+
+std::vector<Range2Di> AtlasPacker::add(const std::vector<Vector2i>& sizes, const AtlasSortHeuristic sort) {
+    /* Largest first, keeping the original order for equal sizes */
+    std::vector<std::size_t> order(sizes.size());
+    std::iota(order.begin(), order.end(), 0);
+    if(sort != AtlasSortHeuristic::None) std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+        return sortKey(sizes[a], sort) > sortKey(sizes[b], sort);
+    });
+
+    /* Back up the state so it can be restored on failure */
+    std::vector<Range2Di> free = _free;
+    const std::size_t count = _count;
+    const Long area = _area;
+
+    std::vector<Range2Di> out(sizes.size());
+    for(const std::size_t i: order) {
+        std::optional<Range2Di> range = add(sizes[i]);
+        if(!range) {
+            _free = std::move(free);
+            _count = count;
+            _area = area;
+            return {};
+        }
+
+        out[i] = *range;
     }
 
-    /** @todo actual magic implementation, not this joke */
+    return out;
+}
+
+void AtlasPacker::remove(const Range2Di& range) {
+    CORRADE_ASSERT(_count, "TextureTools::AtlasPacker::remove(): the atlas is empty", );
+
+    /* The freed rectangle may not be maximal, but it's free space nevertheless
+       and place() splits it as any other */
+    std::vector<Range2Di> free = _free;
+    free.push_back(range.padded(_padding));
+    prune(free);
+    --_count;
+    _area -= Long(range.sizeX())*range.sizeY();
+}
+
+AtlasArrayPacker::AtlasArrayPacker(const Vector3i& size, const Vector2i& padding, const AtlasPackerFlags flags): _size{size}, _padding{padding}, _flags{flags} {}
+
+const AtlasPacker& AtlasArrayPacker::layer(const Int layer) const {
+    CORRADE_ASSERT(layer >= 0 && std::size_t(layer) < _layers.size(),
+        "TextureTools::AtlasArrayPacker::layer(): index" << layer << "out of range for" << _layers.size() << "layers", _layers[0]);
+    return _layers[layer];
+}
+
+std::size_t AtlasArrayPacker::count() const {
+    std::size_t count = 0;
+    for(const AtlasPacker& layer: _layers) count += layer.count();
+    return count;
+}
+
+Float AtlasArrayPacker::occupancy() const {
+    if(_layers.empty()) return 0.0f;
+
+    Float occupancy = 0.0f;
+    for(const AtlasPacker& layer: _layers) occupancy += layer.occupancy();
+    return occupancy/_layers.size();
+}
+
+std::optional<std::pair<Int, Range2Di>> AtlasArrayPacker::add(const Vector2i& size) {
+    for(std::size_t i = 0; i != _layers.size(); ++i)
+        if(std::optional<Range2Di> range = _layers[i].add(size))
+            return std::make_pair(Int(i), *range);
+
+    /* Spill into a new layer. Don't keep it if the texture doesn't fit even
+       there. */
+    if(Int(_layers.size()) >= _size.z()) return std::nullopt;
+    AtlasPacker layer{_size.xy(), _padding, _flags};
+    std::optional<Range2Di> range = layer.add(size);
+    if(!range) return std::nullopt;
+
+    _layers.push_back(std::move(layer));
+    return std::make_pair(Int(_layers.size() - 1), *range);
+}
+
+std::vector<std::pair<Int, Range2Di>> AtlasArrayPacker::add(const std::vector<Vector2i>& sizes, const AtlasSortHeuristic sort) {
+    std::vector<std::size_t> order(sizes.size());
+    std::iota(order.begin(), order.end(), 0);
+    if(sort != AtlasSortHeuristic::None) std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+        return sortKey(sizes[a], sort) > sortKey(sizes[b], sort);
+    });
+
+    /* Back up the state so it can be restored on failure */
+    std::vector<AtlasPacker> layers = _layers;
+
+    std::vector<std::pair<Int, Range2Di>> out(sizes.size());
+    for(const std::size_t i: order) {
+        std::optional<std::pair<Int, Range2Di>> range = add(sizes[i]);
+        if(!range) {
+            _layers = std::move(layers);
+            return {};
+        }
+
+        out[i] = *range;
+    }
+
+    return out;
+}
+
+void AtlasArrayPacker::remove(const Int layer, const Range2Di& range) {
+    CORRADE_ASSERT(layer >= 0 && std::size_t(layer) < _layers.size(),
+        "TextureTools::AtlasArrayPacker::remove(): index" << layer << "out of range for" << _layers.size() << "layers", );
+    _layers[layer].remove(range);
+}
+
+std::vector<Range2Di> atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding) {
+    if(sizes.empty()) return {};
+
+    std::vector<Range2Di> atlas = AtlasPacker{atlasSize, padding}.add(sizes);
+    if(atlas.empty())
+        Error() << "TextureTools::atlas(): requested atlas size" << atlasSize
+                << "is too small to fit" << sizes.size() << "textures with padding"
+                << padding << Debug::nospace << ". Generated atlas will be empty.";
+
+    return atlas;
+}
+
+std::vector<std::pair<Int, Range2Di>> atlasArray(const Vector3i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding) {
+    if(sizes.empty()) return {};
 
-    atlas.reserve(sizes.size());
-    for(std::size_t i = 0; i != sizes.size(); ++i)
-        atlas.push_back(Range2Di::fromSize(Vector2i(i%gridSize.x(), i/gridSize.x())*paddedSize+padding, sizes[i]));
+    std::vector<std::pair<Int, Range2Di>> atlas = AtlasArrayPacker{atlasSize, padding}.add(sizes);
+    if(atlas.empty())
+        Error() << "TextureTools::atlasArray(): requested atlas size" << atlasSize
+                << "is too small to fit" << sizes.size() << "textures with padding"
+                << padding << Debug::nospace << ". Generated atlas will be empty.";
 
     return atlas;
 }
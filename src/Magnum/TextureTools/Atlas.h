@@ -26,17 +26,250 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::TextureTools::atlas()
+ * @brief Class @ref Magnum::TextureTools::AtlasPacker, @ref Magnum::TextureTools::AtlasArrayPacker, function @ref Magnum::TextureTools::atlas(), enum @ref Magnum::TextureTools::AtlasPackerFlag, @ref Magnum::TextureTools::AtlasSortHeuristic, enum set @ref Magnum::TextureTools::AtlasPackerFlags
  */
 
+#include <utility>
 #include <vector>
+#include <Corrade/Containers/EnumSet.h>
 
 #include "Magnum/Magnum.h"
-#include "Magnum/Math/Vector2.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/TextureTools/visibility.h"
+#include "MagnumExternal/Optional/optional.hpp"
 
 namespace Magnum { namespace TextureTools {
 
+/**
+@brief Atlas packer flag
+
+@see @ref AtlasPackerFlags, @ref AtlasPacker
+*/
+enum class AtlasPackerFlag: UnsignedByte {
+    /**
+     * Allow rotating the textures by 90° if they fit better. Rotated
+     * textures are recognized by having the returned range size swapped
+     * against the original size.
+     */
+    AllowRotation = 1 << 0
+};
+
+/**
+@brief Atlas packer flags
+
+@see @ref AtlasPacker
+*/
+typedef Containers::EnumSet<AtlasPackerFlag> AtlasPackerFlags;
+
+CORRADE_ENUMSET_OPERATORS(AtlasPackerFlags)
+
+/**
+@brief Sort heuristic for packing multiple textures at once
+
+@see @ref AtlasPacker::add(const std::vector<Vector2i>&, AtlasSortHeuristic)
+*/
+enum class AtlasSortHeuristic: UnsignedByte {
+    None,           /**< Pack the textures in the order they were passed */
+    Area,           /**< Pack largest area first */
+    Perimeter,      /**< Pack largest perimeter first */
+    MaxSide         /**< Pack longest side first */
+};
+
+/**
+@brief Incremental texture atlas packer
+
+Packs rectangles into a fixed-size atlas using the MaxRects algorithm with
+best short side fit heuristic. Free space is tracked as a list of maximal
+free rectangles, so new textures can be added any time later without
+repacking the textures already in the atlas. Example usage:
+@code
+TextureTools::AtlasPacker packer{{512, 512}, {1, 1}};
+
+std::vector<Range2Di> glyphs = packer.add(glyphSizes);
+// ...
+std::optional<Range2Di> another = packer.add({12, 17});
+if(!another) Warning() << "The atlas is full";
+@endcode
+@see @ref atlas()
+*/
+class MAGNUM_TEXTURETOOLS_EXPORT AtlasPacker {
+    public:
+        /**
+         * @brief Constructor
+         * @param size      Atlas size
+         * @param padding   Padding around each texture
+         * @param flags     Flags
+         *
+         * Padding is added twice to each size and the textures are laid out
+         * so the padding doesn't overlap and doesn't go outside the atlas.
+         */
+        explicit AtlasPacker(const Vector2i& size, const Vector2i& padding = {}, AtlasPackerFlags flags = {});
+
+        /** @brief Atlas size */
+        Vector2i size() const { return _size; }
+
+        /** @brief Padding around each texture */
+        Vector2i padding() const { return _padding; }
+
+        /** @brief Flags */
+        AtlasPackerFlags flags() const { return _flags; }
+
+        /** @brief Count of textures in the atlas */
+        std::size_t count() const { return _count; }
+
+        /**
+         * @brief Atlas occupancy
+         *
+         * Ratio of area covered by textures (without padding) to total
+         * atlas area, in range @f$ [0, 1] @f$.
+         */
+        Float occupancy() const;
+
+        /**
+         * @brief Add a texture
+         *
+         * Returns range of the texture in the atlas, without the padding.
+         * If @ref AtlasPackerFlag::AllowRotation is set, the returned range
+         * may have its size swapped. If the texture doesn't fit, returns
+         * `std::nullopt` and the atlas is left unchanged.
+         */
+        std::optional<Range2Di> add(const Vector2i& size);
+
+        /**
+         * @brief Add multiple textures
+         *
+         * The textures are placed in order given by @p sort, which usually
+         * results in better packing than adding them one by one. Returned
+         * ranges are in the same order as @p sizes. If all the textures
+         * don't fit, returns empty vector and the atlas is left unchanged.
+         */
+        std::vector<Range2Di> add(const std::vector<Vector2i>& sizes, AtlasSortHeuristic sort = AtlasSortHeuristic::Area);
+
+        /**
+         * @brief Remove a texture
+         *
+         * Marks space occupied by @p range, as returned from @ref add(), as
+         * free so new textures can be placed there. The range is expected
+         * to be previously returned from @ref add() and not removed yet.
+         */
+        void remove(const Range2Di& range);
+
+    private:
+        bool find(const Vector2i& size, Range2Di& out) const;
+        void place(const Range2Di& range);
+        void prune(const std::vector<Range2Di>& free);
+
+        Vector2i _size, _padding;
+        AtlasPackerFlags _flags;
+        std::vector<Range2Di> _free;
+        std::size_t _count;
+        Long _area;
+};
+
+/**
+@brief Incremental texture array atlas packer
+
+Packs rectangles into layers of a fixed-size texture array atlas. Each layer
+is packed with @ref AtlasPacker, when a texture doesn't fit into any of the
+layers used so far, it spills into a new layer, up to the layer count given in
+the constructor. That way the atlas can grow without repacking the textures
+already in it and all the layers can be bound as a single
+@ref Texture2DArray. Example usage:
+@code
+TextureTools::AtlasArrayPacker packer{{512, 512, 16}, {1, 1}};
+
+std::vector<std::pair<Int, Range2Di>> glyphs = packer.add(glyphSizes);
+// ...
+std::optional<std::pair<Int, Range2Di>> another = packer.add({12, 17});
+if(!another) Warning() << "All atlas layers are full";
+@endcode
+@see @ref atlasArray()
+*/
+class MAGNUM_TEXTURETOOLS_EXPORT AtlasArrayPacker {
+    public:
+        /**
+         * @brief Constructor
+         * @param size      Layer size and max layer count
+         * @param padding   Padding around each texture
+         * @param flags     Flags
+         *
+         * See @ref AtlasPacker::AtlasPacker() for more information about
+         * padding and flags. No layers are used initially.
+         */
+        explicit AtlasArrayPacker(const Vector3i& size, const Vector2i& padding = {}, AtlasPackerFlags flags = {});
+
+        /** @brief Layer size and max layer count */
+        Vector3i size() const { return _size; }
+
+        /** @brief Padding around each texture */
+        Vector2i padding() const { return _padding; }
+
+        /** @brief Flags */
+        AtlasPackerFlags flags() const { return _flags; }
+
+        /**
+         * @brief Count of used layers
+         *
+         * At most @cpp size().z() @ce.
+         */
+        Int layerCount() const { return _layers.size(); }
+
+        /**
+         * @brief Packer for given layer
+         *
+         * Expects that @p layer is less than @ref layerCount().
+         */
+        const AtlasPacker& layer(Int layer) const;
+
+        /** @brief Count of textures in all layers */
+        std::size_t count() const;
+
+        /**
+         * @brief Atlas occupancy
+         *
+         * Ratio of area covered by textures (without padding) to total area
+         * of used layers, in range @f$ [0, 1] @f$.
+         */
+        Float occupancy() const;
+
+        /**
+         * @brief Add a texture
+         *
+         * Returns layer and range of the texture in it, without the padding.
+         * The texture is put into the first layer where it fits, if it
+         * doesn't fit into any of them, a new layer is used. If the texture
+         * doesn't fit even into a new layer or all layers are used, returns
+         * `std::nullopt` and the atlas is left unchanged.
+         * @see @ref AtlasPacker::add(const Vector2i&)
+         */
+        std::optional<std::pair<Int, Range2Di>> add(const Vector2i& size);
+
+        /**
+         * @brief Add multiple textures
+         *
+         * The textures are placed in order given by @p sort. Returned layers
+         * and ranges are in the same order as @p sizes. If all the textures
+         * don't fit, returns empty vector and the atlas is left unchanged.
+         * @see @ref AtlasPacker::add(const std::vector<Vector2i>&, AtlasSortHeuristic)
+         */
+        std::vector<std::pair<Int, Range2Di>> add(const std::vector<Vector2i>& sizes, AtlasSortHeuristic sort = AtlasSortHeuristic::Area);
+
+        /**
+         * @brief Remove a texture
+         *
+         * Marks space occupied by @p range in @p layer, as returned from
+         * @ref add(), as free. The layer stays used even if it becomes empty.
+         * @see @ref AtlasPacker::remove()
+         */
+        void remove(Int layer, const Range2Di& range);
+
+    private:
+        Vector3i _size;
+        Vector2i _padding;
+        AtlasPackerFlags _flags;
+        std::vector<AtlasPacker> _layers;
+};
+
 /**
 @brief Pack textures into texture atlas
 @param atlasSize    Size of resulting atlas
@@ -48,10 +281,25 @@ into required size, empty vector is returned.
 
 Padding is added twice to each size and the atlas is laid out so the padding
 don't overlap. Returned sizes are the same as original sizes, i.e. without the
-padding.
+padding. The textures are packed largest area first with @ref AtlasPacker,
+without rotation; use the class directly for rotation, adding textures later
+or querying occupancy.
 */
 std::vector<Range2Di> MAGNUM_TEXTURETOOLS_EXPORT atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding = Vector2i());
 
+/**
+@brief Pack textures into texture array atlas
+@param atlasSize    Size of one layer and max layer count
+@param sizes        Sizes of all textures in the atlas
+@param padding      Padding around each texture
+
+Like @ref atlas(), but spills the textures into as many layers as needed,
+returning layer and range for each texture. If the textures cannot be packed
+into the layer count given in @p atlasSize, empty vector is returned. Use
+@ref AtlasArrayPacker directly for rotation or adding textures later.
+*/
+std::vector<std::pair<Int, Range2Di>> MAGNUM_TEXTURETOOLS_EXPORT atlasArray(const Vector3i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding = Vector2i());
+
 }}
 
 #endif
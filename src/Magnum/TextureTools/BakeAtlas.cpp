@@ -0,0 +1,80 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BakeAtlas.h"
+
+#include <cstring>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/TextureTools/Resample.h"
+
+namespace Magnum { namespace TextureTools {
+
+Image2D bakeAtlas(const Vector2i& atlasSize, const std::vector<ImageView2D>& images, const std::vector<Range2Di>& ranges, const Vector2i& padding) {
+    CORRADE_ASSERT(!images.empty() && images.size() == ranges.size(),
+        "TextureTools::bakeAtlas(): expected the same non-zero count of images and ranges, got" << images.size() << "and" << ranges.size(), (Image2D{PixelFormat::RGBA, PixelType::UnsignedByte}));
+
+    const PixelFormat format = images.front().format();
+    const PixelType type = images.front().type();
+    Math::Vector3<std::size_t> atlasOffset, atlasDataSize;
+    std::size_t pixelSize;
+    std::tie(atlasOffset, atlasDataSize, pixelSize) = PixelStorage{}.dataProperties(format, type, Vector3i::pad(atlasSize, 1));
+    Image2D atlas{format, type, atlasSize, Containers::Array<char>{Containers::ValueInit, atlasDataSize.product()}};
+
+    for(std::size_t i = 0; i != images.size(); ++i) {
+        const Range2Di& range = ranges[i];
+        CORRADE_ASSERT(images[i].format() == format && images[i].type() == type,
+            "TextureTools::bakeAtlas(): image" << i << "has different format than the first image", (Image2D{format, type}));
+        CORRADE_ASSERT((range.min() >= Vector2i{}).all() && (range.max() <= atlasSize).all() && range.size().product() && images[i].size().product(),
+            "TextureTools::bakeAtlas(): range" << i << "is empty or out of atlas bounds", (Image2D{format, type}));
+
+        /* Resize the image to its range first, if needed */
+        if(images[i].size() != range.size())
+            copyImage(resample(images[i], range.size(), ResampleFilter::Box), {{}, range.size()}, atlas, range.min());
+        else copyImage(images[i], {{}, range.size()}, atlas, range.min());
+
+        /* Repeat the edge pixels over the padding */
+        const Vector2i min = Math::max(range.min() - padding, Vector2i{});
+        const Vector2i max = Math::min(range.max() + padding, atlasSize);
+        char* const data = atlas.data() + atlasOffset.sum();
+        for(Int y = min.y(); y != max.y(); ++y) {
+            char* const row = data + y*atlasDataSize.x();
+            const Int edgeY = Math::clamp(y, range.min().y(), range.max().y() - 1);
+            if(edgeY != y)
+                std::memcpy(row + range.min().x()*pixelSize, data + edgeY*atlasDataSize.x() + range.min().x()*pixelSize, range.size().x()*pixelSize);
+
+            for(Int x = min.x(); x < range.min().x(); ++x)
+                std::memcpy(row + x*pixelSize, row + range.min().x()*pixelSize, pixelSize);
+            for(Int x = range.max().x(); x < max.x(); ++x)
+                std::memcpy(row + x*pixelSize, row + (range.max().x() - 1)*pixelSize, pixelSize);
+        }
+    }
+
+    return atlas;
+}
+
+}}
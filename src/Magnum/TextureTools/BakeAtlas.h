@@ -0,0 +1,67 @@
+#ifndef Magnum_TextureTools_BakeAtlas_h
+#define Magnum_TextureTools_BakeAtlas_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::TextureTools::bakeAtlas()
+ */
+
+#include <vector>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/TextureTools/visibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Bake textures into texture atlas image
+@param atlasSize    Size of resulting atlas
+@param images       Images to put into the atlas
+@param ranges       Range of each image in the atlas, in pixels
+@param padding      Padding around each image
+
+Copies each image into its range in a newly allocated atlas image, the ranges
+are usually calculated with @ref atlas() or @ref AtlasPacker. Images with
+size different from their range are downsampled or upsampled with
+@ref resample() using @ref ResampleFilter::Box. Pixels in @p padding around
+each range are filled with the nearest edge pixel of the image so the edges
+don't bleed into neighbors with filtering and mipmapping, the padding is
+expected to be the same as the one passed to @ref atlas(). Rotated ranges
+from @ref AtlasPacker are not supported.
+
+All images are expected to have the same @ref PixelFormat and @ref PixelType,
+the @ref PixelStorage parameters of each input are taken into account. The
+output image has the same format and type, default pixel storage and is
+zero-filled outside of the ranges. See @ref MeshTools::generateHlodProxy()
+for an usage example.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT Image2D bakeAtlas(const Vector2i& atlasSize, const std::vector<ImageView2D>& images, const std::vector<Range2Di>& ranges, const Vector2i& padding = {});
+
+}}
+
+#endif
@@ -25,15 +25,25 @@
 
 #include "DistanceField.h"
 
+#include <cmath>
+#include <limits>
+#include <thread>
+#include <vector>
 #include <Corrade/Utility/Resource.h>
 
+#include "Magnum/Math/Bezier.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Range.h"
 #include "Magnum/AbstractShaderProgram.h"
 #include "Magnum/Buffer.h"
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
 #include "Magnum/Framebuffer.h"
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
 #include "Magnum/Mesh.h"
+#include "Magnum/PixelFormat.h"
 #include "Magnum/Shader.h"
 #include "Magnum/Texture.h"
 #include "Magnum/Shaders/Implementation/CreateCompatibilityShader.h"
@@ -144,23 +154,310 @@ DistanceFieldShader::DistanceFieldShader(): radiusUniform(0), scalingUniform(1)
     }
 }
 
+constexpr Float Infinity = std::numeric_limits<Float>::infinity();
+
+/* One-dimensional squared distance transform of n values at given stride,
+   in-place. Temporary storage has to be n values in f, v and n + 1 in z. */
+void distanceTransform(Float* const data, const std::size_t stride, const Int n, Float* const f, Int* const v, Float* const z) {
+    for(Int i = 0; i != n; ++i) f[i] = data[i*stride];
+
+    /* Lower envelope of parabolas rooted at finite values */
+    Int k = -1;
+    for(Int q = 0; q != n; ++q) {
+        if(f[q] == Infinity) continue;
+
+        Float s = -Infinity;
+        while(k >= 0) {
+            s = ((f[q] + q*q) - (f[v[k]] + v[k]*v[k]))/(2.0f*(q - v[k]));
+            if(s > z[k]) break;
+            --k;
+        }
+
+        ++k;
+        v[k] = q;
+        z[k] = k ? s : -Infinity;
+        z[k + 1] = Infinity;
+    }
+
+    /* No finite values, everything stays infinite */
+    if(k == -1) return;
+
+    for(Int q = 0, j = 0; q != n; ++q) {
+        while(z[j + 1] < q) ++j;
+        data[q*stride] = Float((q - v[j])*(q - v[j])) + f[v[j]];
+    }
 }
-#ifndef MAGNUM_TARGET_GLES
-void distanceField(Texture2D& input, Texture2D& output, const Range2Di& rectangle, const Int radius, const Vector2i&)
-#else
-void distanceField(Texture2D& input, Texture2D& output, const Range2Di& rectangle, const Int radius, const Vector2i& imageSize)
-#endif
-{
+
+/* Edge colors of the multi-channel distance field, one bit per channel */
+enum: UnsignedByte {
+    Black = 0,
+    Red = 1 << 0,
+    Green = 1 << 1,
+    Blue = 1 << 2,
+    Yellow = Red|Green,
+    Magenta = Red|Blue,
+    Cyan = Green|Blue,
+    White = Red|Green|Blue
+};
+
+struct Segment {
+    Vector2 p0, p1, p2;
+    UnsignedByte color;
+
+    Vector2 point(const Float t) const {
+        return Math::lerp(Math::lerp(p0, p1, t), Math::lerp(p1, p2, t), t);
+    }
+
+    Vector2 direction(const Float t) const {
+        const Vector2 direction = Math::lerp(p1 - p0, p2 - p1, t);
+        /* Control point coincides with one of the ends */
+        return direction.isZero() ? p2 - p0 : direction;
+    }
+};
+
+/* Distance with ties between segments broken by how orthogonal the segment
+   is to the direction to the point */
+struct SignedDistance {
+    Float distance, dot;
+
+    bool operator<(const SignedDistance& other) const {
+        return std::abs(distance) < std::abs(other.distance) ||
+            (std::abs(distance) == std::abs(other.distance) && dot < other.dot);
+    }
+};
+
+Int solveQuadratic(Double* const x, const Double a, const Double b, const Double c) {
+    /* Linear or close to it */
+    if(a == 0.0 || std::abs(b) > 1.0e12*std::abs(a)) {
+        if(b == 0.0) return 0;
+        x[0] = -c/b;
+        return 1;
+    }
+
+    Double discriminant = b*b - 4.0*a*c;
+    if(discriminant > 0.0) {
+        discriminant = std::sqrt(discriminant);
+        x[0] = (-b + discriminant)/(2.0*a);
+        x[1] = (-b - discriminant)/(2.0*a);
+        return 2;
+    } else if(discriminant == 0.0) {
+        x[0] = -b/(2.0*a);
+        return 1;
+    }
+
+    return 0;
+}
+
+/* Real roots of x^3 + a x^2 + b x + c */
+Int solveCubicNormed(Double* const x, Double a, const Double b, const Double c) {
+    const Double a2 = a*a;
+    Double q = (a2 - 3.0*b)/9.0;
+    const Double r = (a*(2.0*a2 - 9.0*b) + 27.0*c)/54.0;
+    const Double r2 = r*r;
+    const Double q3 = q*q*q;
+    a /= 3.0;
+
+    if(r2 < q3) {
+        const Double t = std::acos(Math::clamp(r/std::sqrt(q3), -1.0, 1.0));
+        q = -2.0*std::sqrt(q);
+        x[0] = q*std::cos(t/3.0) - a;
+        x[1] = q*std::cos((t + 2.0*Constantsd::pi())/3.0) - a;
+        x[2] = q*std::cos((t - 2.0*Constantsd::pi())/3.0) - a;
+        return 3;
+    }
+
+    Double u = -std::pow(std::abs(r) + std::sqrt(r2 - q3), 1.0/3.0);
+    if(r < 0.0) u = -u;
+    const Double v = u == 0.0 ? 0.0 : q/u;
+    x[0] = (u + v) - a;
+    x[1] = -0.5*(u + v) - a;
+    return std::abs(0.5*std::sqrt(3.0)*(u - v)) < 1.0e-14 ? 2 : 1;
+}
+
+Int solveCubic(Double* const x, const Double a, const Double b, const Double c, const Double d) {
+    /* Fall back to quadratic if the cubic term is negligible, which is the
+       case for straight and nearly straight segments */
+    if(a != 0.0) {
+        const Double bn = b/a;
+        if(std::abs(bn) < 1.0e6) return solveCubicNormed(x, bn, c/a, d/a);
+    }
+
+    return solveQuadratic(x, b, c, d);
+}
+
+/* Signed distance from given point to the closest point of the segment, the
+   param is position of the closest point on the segment, outside of [0, 1]
+   if the closest point is an end point and the point lies beyond it.
+   Positive on the right side of the segment. */
+SignedDistance signedDistance(const Segment& segment, const Vector2& point, Float& param) {
+    const Vector2 qa = segment.p0 - point;
+    const Vector2 ab = segment.p1 - segment.p0;
+    const Vector2 br = segment.p2 - segment.p1 - ab;
+    const Double a = Math::dot(br, br);
+    const Double b = 3.0*Math::dot(ab, br);
+    const Double c = 2.0*Math::dot(ab, ab) + Math::dot(qa, br);
+    const Double d = Math::dot(qa, ab);
+    Double t[3];
+    const Int solutions = solveCubic(t, a, b, c, d);
+
+    /* Start and end point */
+    Vector2 direction = segment.direction(0.0f);
+    Float minDistance = (Math::cross(direction, qa) < 0.0f ? -1.0f : 1.0f)*qa.length();
+    param = -Math::dot(qa, direction)/direction.dot();
+    {
+        direction = segment.direction(1.0f);
+        const Vector2 pb = segment.p2 - point;
+        const Float distance = pb.length();
+        if(distance < std::abs(minDistance)) {
+            minDistance = (Math::cross(direction, pb) < 0.0f ? -1.0f : 1.0f)*distance;
+            param = Math::dot(point - segment.p1, direction)/direction.dot();
+        }
+    }
+
+    /* Points inside the segment where the direction is perpendicular */
+    for(Int i = 0; i != solutions; ++i) {
+        if(t[i] <= 0.0 || t[i] >= 1.0) continue;
+
+        const Float ti = Float(t[i]);
+        const Vector2 qe = qa + 2.0f*ti*ab + ti*ti*br;
+        const Float distance = qe.length();
+        if(distance <= std::abs(minDistance)) {
+            minDistance = (Math::cross(ab + ti*br, qe) < 0.0f ? -1.0f : 1.0f)*distance;
+            param = ti;
+        }
+    }
+
+    if(param >= 0.0f && param <= 1.0f) return {minDistance, 0.0f};
+    if(param < 0.5f) return {minDistance, std::abs(Math::dot(segment.direction(0.0f).normalized(), qa.normalized()))};
+    return {minDistance, std::abs(Math::dot(segment.direction(1.0f).normalized(), (segment.p2 - point).normalized()))};
+}
+
+/* If the closest point is beyond an end point, distance to the tangent line
+   extended from the end point, which is what keeps the corners sharp */
+Float pseudoDistance(const Segment& segment, const Vector2& point, Float distance, const Float param) {
+    if(param < 0.0f) {
+        const Vector2 direction = segment.direction(0.0f).normalized();
+        const Vector2 aq = point - segment.p0;
+        if(Math::dot(aq, direction) < 0.0f) {
+            const Float pseudoDistance = Math::cross(aq, direction);
+            if(std::abs(pseudoDistance) <= std::abs(distance)) distance = pseudoDistance;
+        }
+    } else if(param > 1.0f) {
+        const Vector2 direction = segment.direction(1.0f).normalized();
+        const Vector2 bq = point - segment.p2;
+        if(Math::dot(bq, direction) > 0.0f) {
+            const Float pseudoDistance = Math::cross(bq, direction);
+            if(std::abs(pseudoDistance) <= std::abs(distance)) distance = pseudoDistance;
+        }
+    }
+
+    return distance;
+}
+
+void switchColor(UnsignedByte& color, UnsignedInt& seed, const UnsignedByte banned = Black) {
+    const UnsignedByte combined = color & banned;
+    if(combined == Red || combined == Green || combined == Blue) {
+        color = combined ^ White;
+        return;
+    }
+
+    if(color == Black || color == White) {
+        constexpr UnsignedByte start[]{Cyan, Magenta, Yellow};
+        color = start[seed % 3];
+        seed /= 3;
+        return;
+    }
+
+    const UnsignedInt shifted = color << (1 + (seed & 1));
+    color = UnsignedByte((shifted | shifted >> 3) & White);
+    seed >>= 1;
+}
+
+/* Splits a segment into thirds, for contours with too few segments to be
+   colored with three colors */
+void splitInThirds(const Segment& segment, Segment* const out) {
+    out[0] = {segment.p0, Math::lerp(segment.p0, segment.p1, 1.0f/3.0f), segment.point(1.0f/3.0f), Black};
+    out[1] = {segment.point(1.0f/3.0f), Math::lerp(Math::lerp(segment.p0, segment.p1, 5.0f/9.0f), Math::lerp(segment.p1, segment.p2, 4.0f/9.0f), 0.5f), segment.point(2.0f/3.0f), Black};
+    out[2] = {segment.point(2.0f/3.0f), Math::lerp(segment.p1, segment.p2, 2.0f/3.0f), segment.p2, Black};
+}
+
+/* Assigns channels to segments so the segments meeting at a corner always
+   differ in at least one channel */
+void colorContour(std::vector<Segment>& segments) {
+    /* Sine of 3 radians, the directions differ by more than ~8 degrees */
+    constexpr Float CrossThreshold = 0.14112f;
+    UnsignedInt seed = 0;
+
+    std::vector<std::size_t> corners;
+    Vector2 previousDirection = segments.back().direction(1.0f).normalized();
+    for(std::size_t i = 0; i != segments.size(); ++i) {
+        const Vector2 direction = segments[i].direction(0.0f).normalized();
+        if(Math::dot(previousDirection, direction) <= 0.0f || std::abs(Math::cross(previousDirection, direction)) > CrossThreshold)
+            corners.push_back(i);
+        previousDirection = segments[i].direction(1.0f).normalized();
+    }
+
+    /* Smooth contour, all channels are the same */
+    if(corners.empty()) {
+        for(Segment& segment: segments) segment.color = White;
+
+    /* Teardrop, spread three colors symmetrically around the corner */
+    } else if(corners.size() == 1) {
+        UnsignedByte colors[]{White, White, White};
+        switchColor(colors[0], seed);
+        colors[2] = colors[0];
+        switchColor(colors[2], seed);
+
+        const std::size_t corner = corners[0];
+        if(segments.size() >= 3) {
+            const std::size_t count = segments.size();
+            for(std::size_t i = 0; i != count; ++i)
+                segments[(corner + i) % count].color = colors[Int(3.0f + 2.875f*i/(count - 1) - 1.4375f + 0.5f) - 2];
+        } else {
+            Segment parts[6];
+            if(segments.size() == 1) {
+                splitInThirds(segments[0], parts);
+                parts[0].color = colors[0];
+                parts[1].color = colors[1];
+                parts[2].color = colors[2];
+                segments.assign(parts, parts + 3);
+            } else {
+                splitInThirds(segments[0], parts + 3*corner);
+                splitInThirds(segments[1], parts + 3 - 3*corner);
+                parts[0].color = parts[1].color = colors[0];
+                parts[2].color = parts[3].color = colors[1];
+                parts[4].color = parts[5].color = colors[2];
+                segments.assign(parts, parts + 6);
+            }
+        }
+
+    /* Switch color at each corner, making sure the last spline doesn't end
+       up with the same color as the first */
+    } else {
+        std::size_t spline = 0;
+        UnsignedByte color = White;
+        switchColor(color, seed);
+        const UnsignedByte initialColor = color;
+        for(std::size_t i = 0; i != segments.size(); ++i) {
+            const std::size_t index = (corners[0] + i) % segments.size();
+            if(spline + 1 < corners.size() && corners[spline + 1] == index) {
+                ++spline;
+                switchColor(color, seed, spline == corners.size() - 1 ? initialColor : UnsignedByte(Black));
+            }
+            segments[index].color = color;
+        }
+    }
+}
+
+/* Renders the distance field into rectangle of output, sampling the input
+   at position of the output pixel multiplied by scaling */
+void distanceFieldInternal(Texture2D& input, Texture2D& output, const Range2Di& rectangle, const Int radius, const Vector2i& imageSize, const Vector2& scaling) {
     #ifndef MAGNUM_TARGET_GLES
     MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::framebuffer_object);
     #endif
 
     /** @todo Disable depth test, blending and then enable it back (if was previously) */
 
-    #ifndef MAGNUM_TARGET_GLES
-    Vector2i imageSize = input.imageSize(0);
-    #endif
-
     Framebuffer framebuffer(rectangle);
     framebuffer.attachTexture(Framebuffer::ColorAttachment(0), output, 0);
     framebuffer.bind();
@@ -175,7 +472,7 @@ void distanceField(Texture2D& input, Texture2D& output, const Range2Di& rectangl
 
     DistanceFieldShader shader;
     shader.setRadius(radius)
-        .setScaling(Vector2(imageSize)/Vector2(rectangle.size()))
+        .setScaling(scaling)
         .setTexture(input);
 
     #ifndef MAGNUM_TARGET_GLES
@@ -212,4 +509,148 @@ void distanceField(Texture2D& input, Texture2D& output, const Range2Di& rectangl
     mesh.draw(shader);
 }
 
+}
+
+#ifndef MAGNUM_TARGET_GLES
+void distanceField(Texture2D& input, Texture2D& output, const Range2Di& rectangle, const Int radius, const Vector2i&)
+#else
+void distanceField(Texture2D& input, Texture2D& output, const Range2Di& rectangle, const Int radius, const Vector2i& imageSize)
+#endif
+{
+    #ifndef MAGNUM_TARGET_GLES
+    const Vector2i imageSize = input.imageSize(0);
+    #endif
+
+    distanceFieldInternal(input, output, rectangle, radius, imageSize, Vector2(imageSize)/Vector2(rectangle.size()));
+}
+
+void distanceField(Texture2D& input, Texture2D& output, const Range2Di& rectangle, const Int radius, const Vector2i& imageSize, const Vector2i& outputSize) {
+    distanceFieldInternal(input, output, rectangle, radius, imageSize, Vector2(imageSize)/Vector2(outputSize));
+}
+
+Image2D distanceField(const ImageView2D& input, const Vector2i& outputSize, const Int radius, UnsignedInt threadCount) {
+    CORRADE_ASSERT(input.type() == PixelType::UnsignedByte,
+        "TextureTools::distanceField(): expected" << PixelType::UnsignedByte << "input, got" << input.type(), (Image2D{PixelFormat::Red, PixelType::UnsignedByte}));
+
+    if(!threadCount) threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    const Vector2i size = input.size();
+    const std::size_t pixelSize = input.pixelSize();
+    const std::size_t rowStride = std::get<1>(input.dataProperties()).x();
+    const char* const inputData = input.data() + std::get<0>(input.dataProperties()).sum();
+
+    /* Squared distances to nearest inside and nearest outside pixel. Pixels
+       of the opposite kind are the roots of the transform. */
+    std::vector<bool> inside(size.product());
+    std::vector<Float> toInside(size.product()), toOutside(size.product());
+    for(Int y = 0; y != size.y(); ++y) for(Int x = 0; x != size.x(); ++x) {
+        const std::size_t i = y*size.x() + x;
+        inside[i] = UnsignedByte(inputData[y*rowStride + x*pixelSize]) > 127;
+        toInside[i] = inside[i] ? 0.0f : Infinity;
+        toOutside[i] = inside[i] ? Infinity : 0.0f;
+    }
+
+    /* Transform columns, then rows, both in parallel */
+    auto transform = [&toInside, &toOutside](const std::size_t begin, const std::size_t end, const std::size_t offsetStride, const std::size_t stride, const Int n) {
+        std::vector<Float> f(n), z(n + 1);
+        std::vector<Int> v(n);
+        for(std::size_t i = begin; i != end; ++i) {
+            distanceTransform(toInside.data() + i*offsetStride, stride, n, f.data(), v.data(), z.data());
+            distanceTransform(toOutside.data() + i*offsetStride, stride, n, f.data(), v.data(), z.data());
+        }
+    };
+    Implementation::parallelFor(size.x(), threadCount, 1, [&transform, &size](const std::size_t begin, const std::size_t end) {
+        transform(begin, end, 1, size.x(), size.y());
+    });
+    Implementation::parallelFor(size.y(), threadCount, 1, [&transform, &size](const std::size_t begin, const std::size_t end) {
+        transform(begin, end, size.x(), 1, size.x());
+    });
+
+    /* Output rows are four-byte aligned with the default pixel storage */
+    const std::size_t outputRowStride = (outputSize.x() + 3)/4*4;
+    Containers::Array<char> outputData{Containers::ValueInit, outputRowStride*outputSize.y()};
+
+    /* Sample the distances the same way as the GPU implementation, limit them
+       to radius + 1 and normalize from [-radius - 1, radius + 1] to [0, 1] */
+    const Vector2 scaling = Vector2(size)/Vector2(outputSize);
+    const Float maxDistance = radius + 1.0f;
+    Implementation::parallelFor(outputSize.y(), threadCount, 1, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t y = begin; y != end; ++y) {
+            for(Int x = 0; x != outputSize.x(); ++x) {
+                const Vector2i position = Math::min(Vector2i(Vector2(x, y)*scaling), size - Vector2i{1});
+                const std::size_t i = position.y()*size.x() + position.x();
+                const Float distance = Math::min(std::sqrt(inside[i] ? toOutside[i] : toInside[i]), maxDistance);
+                const Float value = (inside[i] ? distance : -distance)/(2.0f*maxDistance) + 0.5f;
+                outputData[y*outputRowStride + x] = char(UnsignedByte(Math::round(Math::clamp(value, 0.0f, 1.0f)*255.0f)));
+            }
+        }
+    });
+
+    return Image2D{PixelFormat::Red, PixelType::UnsignedByte, outputSize, std::move(outputData)};
+}
+
+Image2D multichannelDistanceField(const std::vector<std::vector<QuadraticBezier2D>>& contours, const Range2D& bounds, const Vector2i& outputSize, const Float radius, UnsignedInt threadCount) {
+    CORRADE_ASSERT(radius > 0.0f,
+        "TextureTools::multichannelDistanceField(): expected positive radius, got" << radius, (Image2D{PixelFormat::RGB, PixelType::UnsignedByte}));
+
+    if(!threadCount) threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    /* Color the contours, skipping degenerate segments which have no
+       direction */
+    std::vector<Segment> segments;
+    for(const std::vector<QuadraticBezier2D>& contour: contours) {
+        std::vector<Segment> contourSegments;
+        contourSegments.reserve(contour.size());
+        for(const QuadraticBezier2D& bezier: contour) {
+            const Segment segment{Vector2{bezier[0]}, Vector2{bezier[1]}, Vector2{bezier[2]}, Black};
+            if(segment.p0 != segment.p2 || segment.p0 != segment.p1)
+                contourSegments.push_back(segment);
+        }
+        if(contourSegments.empty()) continue;
+
+        colorContour(contourSegments);
+        segments.insert(segments.end(), contourSegments.begin(), contourSegments.end());
+    }
+
+    /* Output rows are four-byte aligned with the default pixel storage */
+    const std::size_t outputRowStride = (3*outputSize.x() + 3)/4*4;
+    Containers::Array<char> outputData{Containers::ValueInit, outputRowStride*outputSize.y()};
+
+    const Vector2 pixelSize = bounds.size()/Vector2(outputSize);
+    Implementation::parallelFor(outputSize.y(), threadCount, 1, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t y = begin; y != end; ++y) {
+            for(Int x = 0; x != outputSize.x(); ++x) {
+                const Vector2 point = bounds.min() + (Vector2(x, y) + Vector2{0.5f})*pixelSize;
+
+                /* Closest segment for each channel */
+                struct {
+                    SignedDistance distance{-std::numeric_limits<Float>::max(), 1.0f};
+                    const Segment* segment{};
+                    Float param{};
+                } closest[3];
+                for(const Segment& segment: segments) {
+                    Float param;
+                    const SignedDistance distance = signedDistance(segment, point, param);
+                    for(Int i = 0; i != 3; ++i) {
+                        if(!(segment.color & (1 << i)) || !(distance < closest[i].distance)) continue;
+                        closest[i].distance = distance;
+                        closest[i].segment = &segment;
+                        closest[i].param = param;
+                    }
+                }
+
+                char* const pixel = outputData + y*outputRowStride + 3*x;
+                for(Int i = 0; i != 3; ++i) {
+                    const Float distance = closest[i].segment ?
+                        pseudoDistance(*closest[i].segment, point, closest[i].distance.distance, closest[i].param) : -radius;
+                    const Float value = distance/(2.0f*radius) + 0.5f;
+                    pixel[i] = char(UnsignedByte(Math::round(Math::clamp(value, 0.0f, 1.0f)*255.0f)));
+                }
+            }
+        }
+    });
+
+    return Image2D{PixelFormat::RGB, PixelType::UnsignedByte, outputSize, std::move(outputData)};
+}
+
 }}
@@ -26,9 +26,11 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::TextureTools::distanceField()
+ * @brief Function @ref Magnum::TextureTools::distanceField(), @ref Magnum::TextureTools::distanceField(const ImageView2D&, const Vector2i&, Int, UnsignedInt), @ref Magnum::TextureTools::multichannelDistanceField()
  */
 
+#include <vector>
+
 #ifndef MAGNUM_TARGET_GLES
 #include "Magnum/Math/Vector2.h"
 #endif
@@ -80,7 +82,9 @@ Based on: *Chris Green - Improved Alpha-Tested Magnification for Vector Textures
 and Special Effects, SIGGRAPH 2007,
 http://www.valvesoftware.com/publications/2007/SIGGRAPH2007_AlphaTestedMagnification.pdf*
 
-@attention This is GPU-only implementation, so it expects active context.
+@attention This is GPU-only implementation, so it expects active context. See
+    @ref distanceField(const ImageView2D&, const Vector2i&, Int, UnsignedInt)
+    for a CPU implementation.
 
 @note If internal format of @p output texture is not renderable, this function
     prints message to error output and does nothing. In desktop OpenGL and
@@ -92,6 +96,9 @@ http://www.valvesoftware.com/publications/2007/SIGGRAPH2007_AlphaTestedMagnifica
 
 @bug ES (and maybe GL < 3.20) implementation behaves slightly different
     (jaggies, visible e.g. when rendering outlined fonts)
+
+@see @ref distanceField(Texture2D&, Texture2D&, const Range2Di&, Int, const Vector2i&, const Vector2i&),
+    @ref distanceField(const ImageView2D&, const Vector2i&, Int, UnsignedInt)
 */
 #ifndef MAGNUM_TARGET_GLES
 void MAGNUM_TEXTURETOOLS_EXPORT distanceField(Texture2D& input, Texture2D& output, const Range2Di& rectangle, Int radius, const Vector2i& imageSize = Vector2i());
@@ -99,6 +106,95 @@ void MAGNUM_TEXTURETOOLS_EXPORT distanceField(Texture2D& input, Texture2D& outpu
 void MAGNUM_TEXTURETOOLS_EXPORT distanceField(Texture2D& input, Texture2D& output, const Range2Di& rectangle, Int radius, const Vector2i& imageSize);
 #endif
 
+/**
+@brief Update part of signed distance field
+@param input        Input texture
+@param output       Output texture
+@param rectangle    Rectangle in output texture where to render
+@param radius       Max lookup radius in input texture
+@param imageSize    Input texture size
+@param outputSize   Output texture size
+
+Unlike @ref distanceField(Texture2D&, Texture2D&, const Range2Di&, Int, const Vector2i&),
+which maps the whole @p input to @p rectangle, this maps the whole @p input
+to the whole @p output of @p outputSize and renders only pixels inside
+@p rectangle. The result inside @p rectangle is the same as if the whole
+output was converted, which allows updating only changed regions of the
+output, for example after adding glyphs to @ref Text::DistanceFieldGlyphCache.
+
+@attention This is GPU-only implementation, so it expects active context.
+*/
+void MAGNUM_TEXTURETOOLS_EXPORT distanceField(Texture2D& input, Texture2D& output, const Range2Di& rectangle, Int radius, const Vector2i& imageSize, const Vector2i& outputSize);
+
+/**
+@brief Create signed distance field on the CPU
+@param input        Input image
+@param outputSize   Output image size
+@param radius       Max distance in input image
+@param threadCount  Max count of threads to use from
+    @ref TaskScheduler::global(). If `0`, uses
+    `std::thread::hardware_concurrency()`.
+
+CPU counterpart to @ref distanceField(Texture2D&, Texture2D&, const Range2Di&, Int, const Vector2i&),
+usable without GL context, e.g. for offline conversion on headless machines.
+The @p input is expected to have @ref PixelType::UnsignedByte, its first
+channel is treated as binary image with threshold at `0.5`. Returns image of
+@p outputSize with @ref PixelFormat::Red and @ref PixelType::UnsignedByte,
+encoded in the same way as the GPU implementation.
+
+Instead of searching the neighborhood of each pixel in given @p radius, exact
+squared Euclidean distance transform of the whole input is computed in linear
+time by first processing columns and then rows, each of them split among
+@p threadCount threads. The time is thus independent of @p radius.
+
+Based on: *Pedro F. Felzenszwalb, Daniel P. Huttenlocher - Distance Transforms
+of Sampled Functions, Theory of Computing 8, 2012*
+*/
+Image2D MAGNUM_TEXTURETOOLS_EXPORT distanceField(const ImageView2D& input, const Vector2i& outputSize, Int radius, UnsignedInt threadCount = 0);
+
+/**
+@brief Create multi-channel signed distance field from a vector shape
+@param contours     Closed contours of the shape
+@param bounds       Area of the shape mapped to the output image
+@param outputSize   Output image size
+@param radius       Max distance, in units of the shape
+@param threadCount  Max count of threads to use from
+    @ref TaskScheduler::global(). If `0`, uses
+    `std::thread::hardware_concurrency()`.
+
+Unlike the single-channel @ref distanceField(const ImageView2D&, const Vector2i&, Int, UnsignedInt),
+which loses sharp corners of the shape unless the output is large, this
+stores three distance fields, each to a different subset of the shape edges,
+and the original edge is reconstructed from a median of the three channels,
+preserving the corners even in small outputs. It thus needs vector outline
+of the shape instead of a binary image.
+
+Each contour is a list of quadratic Bézier segments, end point of each
+segment being the start point of the next one and end of the last segment
+the start of the first. Straight lines are segments with the middle control
+point anywhere on the line. Filled area is expected to be on the right side
+of the contours, i.e. outer contours are clockwise and holes
+counterclockwise, which is the convention of TrueType glyph outlines.
+
+Returns image of @p outputSize with @ref PixelFormat::RGB and
+@ref PixelType::UnsignedByte. Distance of center of each pixel, mapped to
+@p bounds, is limited to @p radius and normalized from
+@f$ [-radius, radius] @f$ to @f$ [0, 1] @f$, values above `0.5` being
+inside, same as with the single-channel variant. Rows of the output are
+split among @p threadCount threads. Sample the result with
+@ref Shaders::DistanceFieldVector with
+@ref Shaders::DistanceFieldVector::Flag::MultichannelDistanceField enabled.
+
+Edges are assigned to channels so that two edges meeting at a corner, i.e.
+where the contour direction changes by more than about 8°, always differ in
+at least one channel. Contours with no corners end up in all three channels,
+giving the same result as a single-channel distance field.
+
+Based on: *Viktor Chlumský - Shape Decomposition for Multi-channel Distance
+Fields, Master's thesis, Czech Technical University in Prague, 2015*
+*/
+Image2D MAGNUM_TEXTURETOOLS_EXPORT multichannelDistanceField(const std::vector<std::vector<QuadraticBezier2D>>& contours, const Range2D& bounds, const Vector2i& outputSize, Float radius, UnsignedInt threadCount = 0);
+
 }}
 
 #endif
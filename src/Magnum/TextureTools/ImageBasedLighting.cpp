@@ -0,0 +1,496 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ImageBasedLighting.h"
+
+#include <cmath>
+#include <cstring>
+#include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/Resource.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Context.h"
+#include "Magnum/CubeMapTexture.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Framebuffer.h"
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Shader.h"
+#include "Magnum/Texture.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/Shaders/Implementation/CreateCompatibilityShader.h"
+
+#ifdef MAGNUM_BUILD_STATIC
+static void importTextureToolResources() {
+    CORRADE_RESOURCE_INITIALIZE(MagnumTextureTools_RCS)
+}
+#endif
+
+namespace Magnum { namespace TextureTools {
+
+namespace {
+
+enum: Int { EnvironmentTextureUnit = 8 };
+
+class ImageBasedLightingShader: public AbstractShaderProgram {
+    protected:
+        explicit ImageBasedLightingShader(const std::string& fragment);
+
+        ImageBasedLightingShader& setEnvironment(CubeMapTexture& texture) {
+            texture.bind(EnvironmentTextureUnit);
+            return *this;
+        }
+};
+
+ImageBasedLightingShader::ImageBasedLightingShader(const std::string& fragment) {
+    #ifdef MAGNUM_BUILD_STATIC
+    /* Import resources on static build, if not already */
+    if(!Utility::Resource::hasGroup("MagnumTextureTools"))
+        importTextureToolResources();
+    #endif
+    Utility::Resource rs("MagnumTextureTools");
+
+    /* Integer operations and gl_VertexID are needed, so no GLSL 1.20 / ES 2.0
+       fallback */
+    #ifndef MAGNUM_TARGET_GLES
+    const Version v = Context::current().supportedVersion({Version::GL330, Version::GL300});
+    #else
+    const Version v = Version::GLES300;
+    #endif
+
+    Shader vert = Shaders::Implementation::createCompatibilityShader(rs, v, Shader::Type::Vertex);
+    Shader frag = Shaders::Implementation::createCompatibilityShader(rs, v, Shader::Type::Fragment);
+
+    vert.addSource(rs.get("FullScreenTriangle.glsl"))
+        .addSource(rs.get("ImageBasedLighting.vert"));
+    frag.addSource(rs.get("ImageBasedLighting.glsl"))
+        .addSource(rs.get(fragment));
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({vert, frag}));
+
+    attachShaders({vert, frag});
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+    setUniform(uniformLocation("environment"), EnvironmentTextureUnit);
+}
+
+class PrefilterShader: public ImageBasedLightingShader {
+    public:
+        explicit PrefilterShader();
+
+        PrefilterShader& setEnvironment(CubeMapTexture& texture, Int size) {
+            ImageBasedLightingShader::setEnvironment(texture);
+            setUniform(environmentSizeUniform, Float(size));
+            return *this;
+        }
+
+        PrefilterShader& setFace(Int face) {
+            setUniform(faceUniform, face);
+            return *this;
+        }
+
+        PrefilterShader& setRoughness(Float roughness) {
+            setUniform(roughnessUniform, roughness);
+            return *this;
+        }
+
+        PrefilterShader& setSampleCount(UnsignedInt count) {
+            setUniform(sampleCountUniform, Int(count));
+            return *this;
+        }
+
+    private:
+        Int environmentSizeUniform,
+            faceUniform,
+            roughnessUniform,
+            sampleCountUniform;
+};
+
+PrefilterShader::PrefilterShader(): ImageBasedLightingShader{"ImageBasedLightingPrefilter.frag"} {
+    environmentSizeUniform = uniformLocation("environmentSize");
+    faceUniform = uniformLocation("face");
+    roughnessUniform = uniformLocation("roughness");
+    sampleCountUniform = uniformLocation("sampleCount");
+}
+
+class IrradianceShader: public ImageBasedLightingShader {
+    public:
+        explicit IrradianceShader();
+
+        IrradianceShader& setEnvironment(CubeMapTexture& texture, Int size, Int resolution) {
+            ImageBasedLightingShader::setEnvironment(texture);
+            setUniform(resolutionUniform, resolution);
+            /* Take the samples from a level where one sample covers roughly
+               one texel */
+            setUniform(lodUniform, Math::max(std::log2(Float(size)/Float(resolution)), 0.0f));
+            return *this;
+        }
+
+    private:
+        Int resolutionUniform,
+            lodUniform;
+};
+
+IrradianceShader::IrradianceShader(): ImageBasedLightingShader{"ImageBasedLightingIrradiance.frag"} {
+    resolutionUniform = uniformLocation("resolution");
+    lodUniform = uniformLocation("lod");
+}
+
+constexpr CubeMapCoordinate Faces[]{
+    CubeMapCoordinate::PositiveX,
+    CubeMapCoordinate::NegativeX,
+    CubeMapCoordinate::PositiveY,
+    CubeMapCoordinate::NegativeY,
+    CubeMapCoordinate::PositiveZ,
+    CubeMapCoordinate::NegativeZ
+};
+
+/* Real spherical harmonics basis up to band 2, has to match the shader */
+void shBasis(const Vector3& d, Float(&out)[9]) {
+    out[0] = 0.282095f;
+    out[1] = 0.488603f*d.y();
+    out[2] = 0.488603f*d.z();
+    out[3] = 0.488603f*d.x();
+    out[4] = 1.092548f*d.x()*d.y();
+    out[5] = 1.092548f*d.y()*d.z();
+    out[6] = 0.315392f*(3.0f*d.z()*d.z() - 1.0f);
+    out[7] = 1.092548f*d.x()*d.z();
+    out[8] = 0.546274f*(d.x()*d.x() - d.y()*d.y());
+}
+
+/* Direction for given face and face coordinates in range [-1, 1], has to
+   match the shader */
+Vector3 cubeDirection(const Int face, const Float s, const Float t) {
+    switch(face) {
+        case 0: return Vector3{ 1.0f,    -t,    -s}.normalized();
+        case 1: return Vector3{-1.0f,    -t,     s}.normalized();
+        case 2: return Vector3{    s,  1.0f,     t}.normalized();
+        case 3: return Vector3{    s, -1.0f,    -t}.normalized();
+        case 4: return Vector3{    s,    -t,  1.0f}.normalized();
+    }
+
+    return Vector3{-s, -t, -1.0f}.normalized();
+}
+
+/* Solid angle of a face texel centered at given coordinates, computed
+   exactly from the area element integrated over the texel corners, has to
+   match the shader */
+Float areaElement(const Float x, const Float y) {
+    return std::atan2(x*y, std::sqrt(x*x + y*y + 1.0f));
+}
+
+Float texelSolidAngle(const Float s, const Float t, const Float halfTexelSize) {
+    const Float s0 = s - halfTexelSize, s1 = s + halfTexelSize;
+    const Float t0 = t - halfTexelSize, t1 = t + halfTexelSize;
+    return areaElement(s0, t0) - areaElement(s0, t1) - areaElement(s1, t0) + areaElement(s1, t1);
+}
+
+/* Header of the serialized data, followed by RGBA half-float data of all
+   levels */
+struct CacheHeader {
+    char magic[4];
+    UnsignedInt version;
+    Int size;
+    Int levels;
+    Float irradiance[27];
+};
+
+constexpr const char CacheMagic[] = {'M', 'G', 'I', 'B'};
+constexpr UnsignedInt CacheVersion = 1;
+
+std::size_t levelDataSize(const Int size) {
+    return std::size_t(size)*size*6*4*sizeof(UnsignedShort);
+}
+
+}
+
+void prefilterSpecular(CubeMapTexture& environment, const Int environmentSize, CubeMapTexture& output, const Int outputSize, const Int levels, const UnsignedInt sampleCount) {
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::framebuffer_object);
+    #endif
+
+    PrefilterShader shader;
+    shader.setEnvironment(environment, environmentSize);
+
+    Mesh mesh;
+    mesh.setPrimitive(MeshPrimitive::Triangles)
+        .setCount(3);
+
+    for(Int level = 0; level != levels; ++level) {
+        const Int size = Math::max(outputSize >> level, 1);
+
+        /* Perfect mirror needs just a single sample */
+        const Float roughness = levels > 1 ? Float(level)/Float(levels - 1) : 0.0f;
+        shader.setRoughness(roughness)
+            .setSampleCount(level ? sampleCount : 1);
+
+        for(Int face = 0; face != 6; ++face) {
+            Framebuffer framebuffer{{{}, Vector2i{size}}};
+            framebuffer.attachCubeMapTexture(Framebuffer::ColorAttachment(0), output, Faces[face], level)
+                .bind();
+
+            const Framebuffer::Status status = framebuffer.checkStatus(FramebufferTarget::Draw);
+            if(status != Framebuffer::Status::Complete) {
+                Error() << "TextureTools::prefilterSpecular(): cannot render to given output texture, unexpected framebuffer status"
+                        << status;
+                return;
+            }
+
+            shader.setFace(face);
+            mesh.draw(shader);
+        }
+    }
+}
+
+IrradianceCoefficients irradianceSphericalHarmonics(CubeMapTexture& environment, const Int environmentSize, const Int resolution) {
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::framebuffer_object);
+    #endif
+
+    Texture2D output;
+    output.setMinificationFilter(Sampler::Filter::Nearest)
+        .setMagnificationFilter(Sampler::Filter::Nearest)
+        .setStorage(1, TextureFormat::RGBA32F, {9, 1});
+
+    Framebuffer framebuffer{{{}, {9, 1}}};
+    framebuffer.attachTexture(Framebuffer::ColorAttachment(0), output, 0)
+        .bind();
+
+    const Framebuffer::Status status = framebuffer.checkStatus(FramebufferTarget::Draw);
+    if(status != Framebuffer::Status::Complete) {
+        Error() << "TextureTools::irradianceSphericalHarmonics(): cannot render the coefficients, unexpected framebuffer status"
+                << status;
+        return {};
+    }
+
+    IrradianceShader shader;
+    shader.setEnvironment(environment, environmentSize, resolution);
+
+    Mesh mesh;
+    mesh.setPrimitive(MeshPrimitive::Triangles)
+        .setCount(3)
+        .draw(shader);
+
+    const Image2D image = framebuffer.read({{}, {9, 1}}, {PixelFormat::RGBA, PixelType::Float});
+    const Color4* const data = image.data<Color4>();
+    IrradianceCoefficients out;
+    for(std::size_t i = 0; i != 9; ++i) out[i] = data[i].rgb();
+    return out;
+}
+
+IrradianceCoefficients irradianceSphericalHarmonics(const ImageView3D& faces) {
+    CORRADE_ASSERT(faces.type() == PixelType::Float && (faces.format() == PixelFormat::RGB || faces.format() == PixelFormat::RGBA),
+        "TextureTools::irradianceSphericalHarmonics(): expected" << PixelType::Float << "RGB or RGBA input, got" << faces.format() << faces.type(), {});
+    CORRADE_ASSERT(faces.size().x() == faces.size().y() && faces.size().z() == 6,
+        "TextureTools::irradianceSphericalHarmonics(): expected six square faces, got" << faces.size(), {});
+
+    const Int size = faces.size().x();
+    const std::size_t pixelSize = faces.pixelSize();
+    const auto properties = faces.dataProperties();
+    const std::size_t rowStride = std::get<1>(properties).x();
+    const std::size_t sliceStride = rowStride*std::get<1>(properties).y();
+    const char* const data = faces.data() + std::get<0>(properties).sum();
+
+    /* Each texel center is one sample, weighted by solid angle of the texel
+       projected onto unit sphere */
+    const Float texelSize = 2.0f/Float(size);
+    const Float halfTexelSize = texelSize*0.5f;
+    Vector3 sum[9]{};
+    Float basis[9];
+    for(Int face = 0; face != 6; ++face) {
+        for(Int y = 0; y != size; ++y) {
+            const Float t = (y + 0.5f)*texelSize - 1.0f;
+            for(Int x = 0; x != size; ++x) {
+                const Float s = (x + 0.5f)*texelSize - 1.0f;
+                const Float solidAngle = texelSolidAngle(s, t, halfTexelSize);
+
+                Vector3 radiance;
+                std::memcpy(radiance.data(), data + face*sliceStride + y*rowStride + x*pixelSize, sizeof(Vector3));
+
+                shBasis(cubeDirection(face, s, t), basis);
+                for(std::size_t i = 0; i != 9; ++i)
+                    sum[i] += radiance*basis[i]*solidAngle;
+            }
+        }
+    }
+
+    IrradianceCoefficients out;
+    for(std::size_t i = 0; i != 9; ++i) out[i] = Color3{sum[i]};
+    return out;
+}
+
+Color3 sphericalHarmonicsIrradiance(const IrradianceCoefficients& coefficients, const Vector3& normal) {
+    /* Clamped cosine lobe convolution factors for each band */
+    constexpr Float BandFactors[9]{
+        Constants::pi(),
+        2.0f*Constants::pi()/3.0f, 2.0f*Constants::pi()/3.0f, 2.0f*Constants::pi()/3.0f,
+        Constants::pi()/4.0f, Constants::pi()/4.0f, Constants::pi()/4.0f, Constants::pi()/4.0f, Constants::pi()/4.0f
+    };
+
+    Float basis[9];
+    shBasis(normal, basis);
+
+    Color3 out;
+    for(std::size_t i = 0; i != 9; ++i)
+        out += coefficients[i]*BandFactors[i]*basis[i];
+    return out;
+}
+
+Containers::Array<char> serializeImageBasedLighting(const IrradianceCoefficients& irradiance, const std::vector<Image3D>& specularLevels) {
+    if(specularLevels.empty()) {
+        Error() << "TextureTools::serializeImageBasedLighting(): no specular levels";
+        return nullptr;
+    }
+
+    const Int size = specularLevels.front().size().x();
+    std::size_t dataSize = sizeof(CacheHeader);
+    for(std::size_t i = 0; i != specularLevels.size(); ++i) {
+        const Image3D& level = specularLevels[i];
+        const Int levelSize = Math::max(size >> i, 1);
+        if(level.format() != PixelFormat::RGBA || level.type() != PixelType::HalfFloat || level.storage().skip() != Vector3i{} || level.size() != Vector3i{levelSize, levelSize, 6} || level.data().size() < levelDataSize(levelSize)) {
+            Error() << "TextureTools::serializeImageBasedLighting(): expected RGBA half-float level" << i << "of size" << Vector3i{levelSize, levelSize, 6} << "but got" << level.format() << level.type() << level.size();
+            return nullptr;
+        }
+
+        dataSize += levelDataSize(levelSize);
+    }
+
+    CacheHeader header;
+    std::memcpy(header.magic, CacheMagic, sizeof(CacheMagic));
+    header.version = CacheVersion;
+    header.size = size;
+    header.levels = specularLevels.size();
+    for(std::size_t i = 0; i != 9; ++i)
+        std::memcpy(header.irradiance + i*3, irradiance[i].data(), sizeof(Color3));
+
+    Containers::Array<char> data{Containers::ValueInit, dataSize};
+    std::memcpy(data.data(), &header, sizeof(CacheHeader));
+    std::size_t offset = sizeof(CacheHeader);
+    for(std::size_t i = 0; i != specularLevels.size(); ++i) {
+        const std::size_t levelSize = levelDataSize(Math::max(size >> i, 1));
+        std::memcpy(data.data() + offset, specularLevels[i].data(), levelSize);
+        offset += levelSize;
+    }
+
+    return data;
+}
+
+bool deserializeImageBasedLighting(const Containers::ArrayView<const char> data, IrradianceCoefficients& irradiance, std::vector<Image3D>& specularLevels) {
+    CacheHeader header;
+    if(data.size() < sizeof(CacheHeader)) return false;
+    std::memcpy(&header, data.data(), sizeof(CacheHeader));
+    if(std::memcmp(header.magic, CacheMagic, sizeof(CacheMagic)) != 0 ||
+       header.version != CacheVersion || header.size <= 0 || header.levels <= 0)
+        return false;
+
+    std::size_t dataSize = sizeof(CacheHeader);
+    for(Int i = 0; i != header.levels; ++i)
+        dataSize += levelDataSize(Math::max(header.size >> i, 1));
+    if(data.size() != dataSize) return false;
+
+    std::vector<Image3D> levels;
+    levels.reserve(header.levels);
+    std::size_t offset = sizeof(CacheHeader);
+    for(Int i = 0; i != header.levels; ++i) {
+        const Int size = Math::max(header.size >> i, 1);
+        Containers::Array<char> levelData{Containers::NoInit, levelDataSize(size)};
+        std::memcpy(levelData.data(), data.data() + offset, levelData.size());
+        offset += levelData.size();
+        levels.emplace_back(PixelFormat::RGBA, PixelType::HalfFloat, Vector3i{size, size, 6}, std::move(levelData));
+    }
+
+    for(std::size_t i = 0; i != 9; ++i)
+        std::memcpy(irradiance[i].data(), header.irradiance + i*3, sizeof(Color3));
+    specularLevels = std::move(levels);
+    return true;
+}
+
+bool saveImageBasedLighting(const std::string& filename, const IrradianceCoefficients& irradiance, const std::vector<Image3D>& specularLevels) {
+    const Containers::Array<char> data = serializeImageBasedLighting(irradiance, specularLevels);
+    if(!data) return false;
+
+    if(!Utility::Directory::write(filename, data)) {
+        Error() << "TextureTools::saveImageBasedLighting(): cannot write to" << filename;
+        return false;
+    }
+
+    return true;
+}
+
+bool loadImageBasedLighting(const std::string& filename, IrradianceCoefficients& irradiance, std::vector<Image3D>& specularLevels) {
+    if(!Utility::Directory::fileExists(filename)) return false;
+
+    const Containers::Array<char> data = Utility::Directory::read(filename);
+    return deserializeImageBasedLighting(data, irradiance, specularLevels);
+}
+
+IrradianceCoefficients imageBasedLighting(CubeMapTexture& environment, const Int environmentSize, CubeMapTexture& specular, const Int specularSize, const Int levels, const std::string& cacheFilename) {
+    IrradianceCoefficients irradiance;
+    std::vector<Image3D> specularLevels;
+
+    /* Upload everything from the cache, if it matches. One call per level
+       uploads all six faces. */
+    if(!cacheFilename.empty() && loadImageBasedLighting(cacheFilename, irradiance, specularLevels) &&
+       specularLevels.front().size().x() == specularSize && Int(specularLevels.size()) == levels)
+    {
+        for(std::size_t i = 0; i != specularLevels.size(); ++i)
+            specular.setSubImage(i, {}, specularLevels[i]);
+        return irradiance;
+    }
+
+    prefilterSpecular(environment, environmentSize, specular, specularSize, levels);
+    irradiance = irradianceSphericalHarmonics(environment, environmentSize);
+    if(cacheFilename.empty()) return irradiance;
+
+    /* Read the levels back. Float readback of floating-point color buffers
+       is the only one guaranteed on ES, so convert to half-floats here. */
+    specularLevels.clear();
+    specularLevels.reserve(levels);
+    for(Int level = 0; level != levels; ++level) {
+        const Int size = Math::max(specularSize >> level, 1);
+        Containers::Array<char> data{Containers::NoInit, levelDataSize(size)};
+        const std::size_t faceSize = data.size()/6;
+        for(Int face = 0; face != 6; ++face) {
+            Framebuffer framebuffer{{{}, Vector2i{size}}};
+            framebuffer.attachCubeMapTexture(Framebuffer::ColorAttachment(0), specular, Faces[face], level);
+            const Image2D image = framebuffer.read({{}, Vector2i{size}}, {PixelFormat::RGBA, PixelType::Float});
+            Math::packHalf(Containers::ArrayView<const Float>{image.data<Float>(), std::size_t(size)*size*4},
+                Containers::ArrayView<UnsignedShort>{reinterpret_cast<UnsignedShort*>(data.data() + face*faceSize), std::size_t(size)*size*4});
+        }
+
+        specularLevels.emplace_back(PixelFormat::RGBA, PixelType::HalfFloat, Vector3i{size, size, 6}, std::move(data));
+    }
+
+    saveImageBasedLighting(cacheFilename, irradiance, specularLevels);
+    return irradiance;
+}
+
+}}
@@ -0,0 +1,39 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#define Pi 3.14159265358979
+
+/* Direction corresponding to given face and face coordinates in range
+   [-1, 1], following the cube map face selection table in the GL spec */
+highp vec3 cubeDirection(int face, highp vec2 coordinates) {
+    highp float s = coordinates.x;
+    highp float t = coordinates.y;
+    if(face == 0) return normalize(vec3( 1.0,   -t,   -s));
+    if(face == 1) return normalize(vec3(-1.0,   -t,    s));
+    if(face == 2) return normalize(vec3(   s,  1.0,    t));
+    if(face == 3) return normalize(vec3(   s, -1.0,   -t));
+    if(face == 4) return normalize(vec3(   s,   -t,  1.0));
+    return normalize(vec3(-s, -t, -1.0));
+}
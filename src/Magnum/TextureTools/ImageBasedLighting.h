@@ -0,0 +1,228 @@
+#ifndef Magnum_TextureTools_ImageBasedLighting_h
+#define Magnum_TextureTools_ImageBasedLighting_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Typedef @ref Magnum::TextureTools::IrradianceCoefficients, function @ref Magnum::TextureTools::prefilterSpecular(), @ref Magnum::TextureTools::irradianceSphericalHarmonics(), @ref Magnum::TextureTools::sphericalHarmonicsIrradiance(), @ref Magnum::TextureTools::imageBasedLighting(), @ref Magnum::TextureTools::serializeImageBasedLighting(), @ref Magnum::TextureTools::deserializeImageBasedLighting(), @ref Magnum::TextureTools::saveImageBasedLighting(), @ref Magnum::TextureTools::loadImageBasedLighting()
+ */
+
+#include <array>
+#include <string>
+#include <vector>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/TextureTools/visibility.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Irradiance spherical harmonics coefficients
+
+Nine RGB coefficients of the first three bands of real spherical harmonics,
+in order @f$ Y_{0,0}, Y_{1,-1}, Y_{1,0}, Y_{1,1}, Y_{2,-2}, Y_{2,-1}, Y_{2,0},
+Y_{2,1}, Y_{2,2} @f$. These contain projection of the environment *radiance*,
+use @ref sphericalHarmonicsIrradiance() to get the cosine-convolved irradiance
+in given direction.
+*/
+typedef std::array<Color3, 9> IrradianceCoefficients;
+
+/**
+@brief Prefilter environment map for specular image-based lighting
+@param environment      Environment cube map
+@param environmentSize  Size of @p environment base level face
+@param output           Output cube map
+@param outputSize       Size of @p output base level face
+@param levels           Count of @p output mip levels to fill
+@param sampleCount      Count of GGX samples per output pixel
+
+Fills mip level @f$ i @f$ of @p output with @p environment convolved with GGX
+distribution of roughness @f$ \frac{i}{levels - 1} @f$, which is the
+prefiltered radiance part of the split-sum approximation. Sample directions
+are generated from the Hammersley point set and importance-sampled according
+to the distribution. Each sample is taken from a @p environment mip level
+whose texel covers roughly the same solid angle as the sample, so
+@p environment is expected to have a complete mip chain (e.g. created with
+@ref CubeMapTexture::generateMipmap()) and trilinear filtering. Enabling
+@ref Renderer::Feature::SeamlessCubeMapTexture on desktop GL avoids seams
+between the faces.
+
+The @p output is expected to have storage for at least @p levels levels
+allocated with a renderable floating-point format, such as
+@ref TextureFormat::RGBA16F.
+
+@attention This is GPU-only implementation, so it expects active context.
+    Similarly to @ref distanceField(), it doesn't touch depth test or
+    blending state, so these should be disabled.
+@note If internal format of @p output is not renderable, this function prints
+    message to error output and does nothing.
+@requires_gl30 Extension @extension{EXT,gpu_shader4} and
+    @extension{ARB,framebuffer_object}
+@requires_gles30 Not available in OpenGL ES 2.0. Rendering to floating-point
+    formats requires @es_extension{EXT,color_buffer_half_float} or
+    @es_extension{EXT,color_buffer_float}.
+@requires_webgl20 Not available in WebGL 1.0. Rendering to floating-point
+    formats requires @webgl_extension{EXT,color_buffer_float}.
+@see @ref irradianceSphericalHarmonics(), @ref imageBasedLighting()
+*/
+void MAGNUM_TEXTURETOOLS_EXPORT prefilterSpecular(CubeMapTexture& environment, Int environmentSize, CubeMapTexture& output, Int outputSize, Int levels, UnsignedInt sampleCount = 512);
+
+/**
+@brief Project environment map to irradiance spherical harmonics
+@param environment      Environment cube map
+@param environmentSize  Size of @p environment base level face
+@param resolution       Count of samples along one face edge
+
+The projection is done on the GPU, taking `resolution*resolution` samples
+from each face of a mip level with roughly the same resolution, weighted by
+their solid angle. The @p environment is thus expected to have a mip chain and
+the result is read back to client memory, so the function blocks until the
+GPU finishes. Default @p resolution is enough for diffuse lighting, as the
+first three bands don't capture any high-frequency detail.
+
+@attention This is GPU-only implementation, so it expects active context.
+    See @ref irradianceSphericalHarmonics(const ImageView3D&) for a CPU
+    implementation.
+@requires_gl30 Extension @extension{EXT,gpu_shader4},
+    @extension{ARB,framebuffer_object} and @extension{ARB,texture_float}
+@requires_gles30 Not available in OpenGL ES 2.0. Requires
+    @es_extension{EXT,color_buffer_float}.
+@requires_webgl20 Not available in WebGL 1.0. Requires
+    @webgl_extension{EXT,color_buffer_float}.
+@see @ref sphericalHarmonicsIrradiance()
+*/
+IrradianceCoefficients MAGNUM_TEXTURETOOLS_EXPORT irradianceSphericalHarmonics(CubeMapTexture& environment, Int environmentSize, Int resolution = 32);
+
+/**
+@brief Project environment map to irradiance spherical harmonics on the CPU
+
+CPU counterpart to @ref irradianceSphericalHarmonics(CubeMapTexture&, Int, Int),
+usable without GL context. Expects that @p faces is a square image with six
+slices in the usual cube map face order (positive X, negative X, positive Y
+etc.) with @ref PixelFormat::RGB or @ref PixelFormat::RGBA and
+@ref PixelType::Float, each texel is used as one sample.
+*/
+IrradianceCoefficients MAGNUM_TEXTURETOOLS_EXPORT irradianceSphericalHarmonics(const ImageView3D& faces);
+
+/**
+@brief Evaluate irradiance from spherical harmonics
+@param coefficients     Radiance projected to spherical harmonics
+@param normal           Normalized direction
+
+Returns irradiance @f$ E(n) @f$ in direction @p normal, i.e. the radiance
+convolved with clamped cosine lobe as described in *Ravi Ramamoorthi, Pat
+Hanrahan --- An Efficient Representation for Irradiance Environment Maps,
+SIGGRAPH 2001*. For uniform environment of radiance @f$ L @f$ the result is
+@f$ \pi L @f$, multiply it with @f$ \frac{albedo}{\pi} @f$ to get the diffuse
+lighting contribution.
+*/
+Color3 MAGNUM_TEXTURETOOLS_EXPORT sphericalHarmonicsIrradiance(const IrradianceCoefficients& coefficients, const Vector3& normal);
+
+/**
+@brief Compute image-based lighting with disk cache
+@param environment      Environment cube map
+@param environmentSize  Size of @p environment base level face
+@param specular         Prefiltered specular output cube map
+@param specularSize     Size of @p specular base level face
+@param levels           Count of @p specular mip levels
+@param cacheFilename    Cache file. If empty, the results are always
+    computed and not saved.
+
+If @p cacheFilename exists and contains data of matching size and level
+count, the prefiltered levels are uploaded to @p specular directly, each with
+a single @ref CubeMapTexture::setSubImage(Int, const Vector3i&, const ImageView3D&)
+call, and the irradiance coefficients are returned from the file. Otherwise
+both are computed using @ref prefilterSpecular() and
+@ref irradianceSphericalHarmonics(CubeMapTexture&, Int, Int), the specular
+levels are read back and everything is saved to @p cacheFilename using
+@ref saveImageBasedLighting().
+
+The cache doesn't know anything about content of @p environment, it's up to
+the user to pick a different file for different environments. The
+@p specular texture is expected to have storage allocated in the same way as
+for @ref prefilterSpecular(), with @ref TextureFormat::RGBA16F if the cache is
+used.
+
+@attention This is GPU-only implementation, so it expects active context.
+@requires_gl30 Extension @extension{EXT,gpu_shader4},
+    @extension{ARB,framebuffer_object} and @extension{ARB,texture_float}
+@requires_gles30 Not available in OpenGL ES 2.0. Requires
+    @es_extension{EXT,color_buffer_float}.
+@requires_webgl20 Not available in WebGL 1.0. Requires
+    @webgl_extension{EXT,color_buffer_float}.
+*/
+IrradianceCoefficients MAGNUM_TEXTURETOOLS_EXPORT imageBasedLighting(CubeMapTexture& environment, Int environmentSize, CubeMapTexture& specular, Int specularSize, Int levels, const std::string& cacheFilename = {});
+
+/**
+@brief Serialize image-based lighting data
+@param irradiance       Irradiance coefficients
+@param specularLevels   Prefiltered specular cube map levels
+
+Expects that each of @p specularLevels has @ref PixelFormat::RGBA,
+@ref PixelType::HalfFloat and default pixel storage, six square slices and
+that the levels are in a consecutive mip chain, i.e. each having half the
+size of the previous one, rounded down, but at least @cpp 1 @ce. If not,
+prints message to error output and returns empty array.
+@see @ref deserializeImageBasedLighting(), @ref saveImageBasedLighting()
+*/
+Containers::Array<char> MAGNUM_TEXTURETOOLS_EXPORT serializeImageBasedLighting(const IrradianceCoefficients& irradiance, const std::vector<Image3D>& specularLevels);
+
+/**
+@brief Deserialize image-based lighting data
+
+Counterpart to @ref serializeImageBasedLighting(). On success fills
+@p irradiance and @p specularLevels and returns `true`. If the data are
+truncated or not in the expected format, returns `false` and leaves the
+outputs untouched.
+*/
+bool MAGNUM_TEXTURETOOLS_EXPORT deserializeImageBasedLighting(Containers::ArrayView<const char> data, IrradianceCoefficients& irradiance, std::vector<Image3D>& specularLevels);
+
+/**
+@brief Save image-based lighting data to a file
+
+Writes the output of @ref serializeImageBasedLighting() to @p filename.
+Returns `false` if the data can't be serialized or written.
+@see @ref loadImageBasedLighting()
+*/
+bool MAGNUM_TEXTURETOOLS_EXPORT saveImageBasedLighting(const std::string& filename, const IrradianceCoefficients& irradiance, const std::vector<Image3D>& specularLevels);
+
+/**
+@brief Load image-based lighting data from a file
+
+Reads @p filename and passes its contents to
+@ref deserializeImageBasedLighting(). Returns `false` if the file doesn't
+exist or can't be deserialized.
+*/
+bool MAGNUM_TEXTURETOOLS_EXPORT loadImageBasedLighting(const std::string& filename, IrradianceCoefficients& irradiance, std::vector<Image3D>& specularLevels);
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
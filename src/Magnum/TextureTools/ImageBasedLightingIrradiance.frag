@@ -0,0 +1,77 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+uniform highp samplerCube environment;
+/* Count of samples along one face edge and the mip level to take them from
+   so each sample covers roughly one texel */
+uniform highp int resolution;
+uniform highp float lod;
+
+out highp vec4 color;
+
+/* Real spherical harmonics basis up to band 2 */
+highp float basis(int i, highp vec3 d) {
+    if(i == 0) return 0.282095;
+    if(i == 1) return 0.488603*d.y;
+    if(i == 2) return 0.488603*d.z;
+    if(i == 3) return 0.488603*d.x;
+    if(i == 4) return 1.092548*d.x*d.y;
+    if(i == 5) return 1.092548*d.y*d.z;
+    if(i == 6) return 0.315392*(3.0*d.z*d.z - 1.0);
+    if(i == 7) return 1.092548*d.x*d.z;
+    return 0.546274*(d.x*d.x - d.y*d.y);
+}
+
+/* Integral of the area element from face center to given coordinates */
+highp float areaElement(highp float x, highp float y) {
+    return atan(x*y, sqrt(x*x + y*y + 1.0));
+}
+
+void main() {
+    /* Each fragment of the 9x1 target integrates one coefficient */
+    int coefficient = int(gl_FragCoord.x);
+
+    highp float texelSize = 2.0/float(resolution);
+    highp vec3 sum = vec3(0.0);
+    for(int face = 0; face != 6; ++face) {
+        for(int y = 0; y != resolution; ++y) {
+            for(int x = 0; x != resolution; ++x) {
+                highp vec2 coordinates = (vec2(x, y) + vec2(0.5))*texelSize - vec2(1.0);
+
+                /* Solid angle of the texel projected onto unit sphere */
+                highp vec2 c0 = coordinates - vec2(0.5*texelSize);
+                highp vec2 c1 = coordinates + vec2(0.5*texelSize);
+                highp float solidAngle =
+                    areaElement(c0.x, c0.y) - areaElement(c0.x, c1.y) -
+                    areaElement(c1.x, c0.y) + areaElement(c1.x, c1.y);
+
+                highp vec3 d = cubeDirection(face, coordinates);
+                sum += textureLod(environment, d, lod).rgb*basis(coefficient, d)*solidAngle;
+            }
+        }
+    }
+
+    color = vec4(sum, 1.0);
+}
@@ -0,0 +1,103 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+uniform highp samplerCube environment;
+uniform lowp int face;
+uniform highp float roughness;
+/* Size of the environment base level, used for selecting the mip level
+   each sample is taken from */
+uniform highp float environmentSize;
+uniform highp int sampleCount;
+
+in highp vec2 cubeCoordinates;
+
+out highp vec4 color;
+
+/* Van der Corput radical inverse for the Hammersley point set */
+highp float radicalInverse(highp uint bits) {
+    bits = (bits << 16u) | (bits >> 16u);
+    bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);
+    bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);
+    bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);
+    bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);
+    return float(bits)*2.3283064365386963e-10;
+}
+
+/* Half vector around normal n, distributed according to GGX with
+   alpha = roughness^2 */
+highp vec3 importanceSampleGgx(highp vec2 xi, highp float alpha, highp vec3 n) {
+    highp float phi = 2.0*Pi*xi.x;
+    highp float cosTheta = sqrt((1.0 - xi.y)/(1.0 + (alpha*alpha - 1.0)*xi.y));
+    highp float sinTheta = sqrt(1.0 - cosTheta*cosTheta);
+
+    highp vec3 up = abs(n.z) < 0.999 ? vec3(0.0, 0.0, 1.0) : vec3(1.0, 0.0, 0.0);
+    highp vec3 tangentX = normalize(cross(up, n));
+    highp vec3 tangentY = cross(n, tangentX);
+    return tangentX*sinTheta*cos(phi) + tangentY*sinTheta*sin(phi) + n*cosTheta;
+}
+
+highp float distributionGgx(highp float nh, highp float alpha) {
+    highp float alpha2 = alpha*alpha;
+    highp float d = nh*nh*(alpha2 - 1.0) + 1.0;
+    return alpha2/(Pi*d*d);
+}
+
+void main() {
+    /* Assuming view direction equal to the normal, as is usual for split-sum
+       prefiltering */
+    highp vec3 n = cubeDirection(face, cubeCoordinates);
+    highp float alpha = roughness*roughness;
+
+    /* Solid angle of one environment texel */
+    highp float texelSolidAngle = 4.0*Pi/(6.0*environmentSize*environmentSize);
+
+    highp vec3 sum = vec3(0.0);
+    highp float weight = 0.0;
+    highp uint count = uint(sampleCount);
+    for(highp uint i = 0u; i < count; ++i) {
+        highp vec2 xi = vec2(float(i)/float(count), radicalInverse(i));
+        highp vec3 h = importanceSampleGgx(xi, alpha, n);
+        highp vec3 l = 2.0*dot(n, h)*h - n;
+
+        highp float nl = dot(n, l);
+        if(nl <= 0.0) continue;
+
+        /* Filtered importance sampling -- take the sample from a mip level
+           whose texel covers the same solid angle as the sample, which
+           avoids fireflies with low sample counts. With n = v the PDF
+           simplifies to D/4. */
+        highp float lod = 0.0;
+        if(roughness > 0.0) {
+            highp float pdf = distributionGgx(max(dot(n, h), 0.0), alpha)*0.25;
+            highp float sampleSolidAngle = 1.0/(float(count)*pdf + 0.0001);
+            lod = max(0.5*log2(sampleSolidAngle/texelSolidAngle) + 1.0, 0.0);
+        }
+
+        sum += textureLod(environment, l, lod).rgb*nl;
+        weight += nl;
+    }
+
+    color = vec4(sum/max(weight, 0.0001), 1.0);
+}
@@ -0,0 +1,270 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Resample.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <tuple>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Implementation/componentSize.h"
+#include "Magnum/Implementation/parallelFor.h"
+#include "Magnum/PixelConversion.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace TextureTools {
+
+namespace {
+
+/* Floating-point image with interleaved channels, rows tightly packed */
+struct FloatImage {
+    Vector2i size;
+    std::size_t channelCount;
+    std::vector<Float> data;
+};
+
+/* Calls the function for each row of the image with pointer to its data */
+template<class T, class F> void forEachRow(T* const data, const PixelStorage& storage, const PixelFormat format, const PixelType type, const Vector2i& size, F function) {
+    Math::Vector3<std::size_t> offset, dataSize;
+    std::size_t pixelSize;
+    std::tie(offset, dataSize, pixelSize) = storage.dataProperties(format, type, Vector3i::pad(size, 1));
+    for(Int y = 0; y != size.y(); ++y)
+        function(data + offset.sum() + y*dataSize.x(), y);
+}
+
+FloatImage toFloat(const ImageView2D& image, const std::size_t channelCount, const bool srgb) {
+    FloatImage out{image.size(), channelCount, std::vector<Float>(image.size().product()*channelCount)};
+    const std::size_t rowSize = image.size().x()*channelCount;
+    forEachRow(image.data().data(), image.storage(), image.format(), image.type(), image.size(), [&](const char* row, Int y) {
+        Float* const dst = out.data.data() + y*rowSize;
+        if(image.type() == PixelType::UnsignedByte) {
+            const UnsignedByte* const src = reinterpret_cast<const UnsignedByte*>(row);
+            if(!srgb) PixelConversion::unormToFloat(src, dst, rowSize);
+            else if(channelCount == 4) PixelConversion::srgbToLinearAlpha(src, dst, image.size().x());
+            else PixelConversion::srgbToLinear(src, dst, rowSize);
+        } else if(image.type() == PixelType::UnsignedShort)
+            PixelConversion::unormToFloat(reinterpret_cast<const UnsignedShort*>(row), dst, rowSize);
+        else std::copy_n(reinterpret_cast<const Float*>(row), rowSize, dst);
+    });
+    return out;
+}
+
+Image2D fromFloat(const FloatImage& image, const PixelFormat format, const PixelType type, const bool srgb) {
+    Math::Vector3<std::size_t> offset, dataSize;
+    std::size_t pixelSize;
+    std::tie(offset, dataSize, pixelSize) = PixelStorage{}.dataProperties(format, type, Vector3i::pad(image.size, 1));
+
+    Containers::Array<char> data{dataSize.product()};
+    const std::size_t rowSize = image.size.x()*image.channelCount;
+    forEachRow(data.data(), PixelStorage{}, format, type, image.size, [&](char* row, Int y) {
+        const Float* const src = image.data.data() + y*rowSize;
+        if(type == PixelType::UnsignedByte) {
+            UnsignedByte* const dst = reinterpret_cast<UnsignedByte*>(row);
+            if(!srgb) PixelConversion::floatToUnorm(src, dst, rowSize);
+            else if(image.channelCount == 4) PixelConversion::linearToSrgbAlpha(src, dst, image.size.x());
+            else PixelConversion::linearToSrgb(src, dst, rowSize);
+        } else if(type == PixelType::UnsignedShort)
+            PixelConversion::floatToUnorm(src, reinterpret_cast<UnsignedShort*>(row), rowSize);
+        else std::copy_n(src, rowSize, reinterpret_cast<Float*>(row));
+    });
+
+    return Image2D{format, type, image.size, std::move(data)};
+}
+
+Float sinc(const Float x) {
+    if(x == 0.0f) return 1.0f;
+    const Float px = Constants::pi()*x;
+    return std::sin(px)/px;
+}
+
+/* Zeroth-order modified Bessel function of the first kind */
+Float besselI0(const Float x) {
+    Float sum = 1.0f, term = 1.0f;
+    const Float halfSquared = x*x*0.25f;
+    for(Int k = 1; k != 32 && term > sum*1.0e-8f; ++k) {
+        term *= halfSquared/Float(k*k);
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr Float FilterRadius = 3.0f;
+constexpr Float KaiserAlpha = 4.0f;
+
+Float filterWeight(const ResampleFilter filter, const Float x) {
+    if(std::abs(x) >= FilterRadius) return 0.0f;
+    if(filter == ResampleFilter::Lanczos)
+        return sinc(x)*sinc(x/FilterRadius);
+
+    CORRADE_INTERNAL_ASSERT(filter == ResampleFilter::Kaiser);
+    const Float t = x/FilterRadius;
+    return sinc(x)*besselI0(KaiserAlpha*std::sqrt(1.0f - t*t))/besselI0(KaiserAlpha);
+}
+
+/* Weights of input pixels for each output pixel along one axis. Pixels
+   outside of the input are clamped to the edge, so the taps of each output
+   pixel form a contiguous range. */
+struct Contributions {
+    std::vector<Int> first, count;
+    std::vector<std::size_t> offset;
+    std::vector<Float> weights;
+};
+
+Contributions contributions(const ResampleFilter filter, const Int inputSize, const Int outputSize) {
+    Contributions out;
+    out.first.reserve(outputSize);
+    out.count.reserve(outputSize);
+    out.offset.reserve(outputSize);
+
+    const Float scale = Float(inputSize)/Float(outputSize);
+    const Float filterScale = Math::max(scale, 1.0f);
+    const Float radius = filter == ResampleFilter::Box ? filterScale*0.5f : FilterRadius*filterScale;
+
+    for(Int x = 0; x != outputSize; ++x) {
+        const Float center = (x + 0.5f)*scale - 0.5f;
+        const Int begin = Int(std::ceil(center - radius));
+        const Int end = Int(std::floor(center + radius)) + 1;
+        const Int first = Math::clamp(begin, 0, inputSize - 1);
+        const Int last = Math::clamp(end - 1, 0, inputSize - 1);
+
+        const std::size_t offset = out.weights.size();
+        out.weights.resize(offset + last - first + 1);
+        Float sum = 0.0f;
+        for(Int i = begin; i < end; ++i) {
+            Float weight;
+            if(filter == ResampleFilter::Box)
+                weight = Math::max(0.0f, Math::min(i + 0.5f, center + radius) - Math::max(i - 0.5f, center - radius));
+            else weight = filterWeight(filter, (i - center)/filterScale);
+            out.weights[offset + Math::clamp(i, 0, inputSize - 1) - first] += weight;
+            sum += weight;
+        }
+
+        /* Normalize, fall back to the nearest pixel if all taps are zero */
+        if(sum != 0.0f) for(std::size_t i = offset; i != out.weights.size(); ++i)
+            out.weights[i] /= sum;
+        else out.weights[offset + Math::clamp(Int(std::round(center)), first, last) - first] = 1.0f;
+
+        out.first.push_back(first);
+        out.count.push_back(last - first + 1);
+        out.offset.push_back(offset);
+    }
+
+    return out;
+}
+
+FloatImage resampleFloat(const FloatImage& image, const Vector2i& size, const ResampleFilter filter, const UnsignedInt threadCount) {
+    const std::size_t channelCount = image.channelCount;
+
+    /* Horizontal pass, each row is independent */
+    const Contributions horizontal = contributions(filter, image.size.x(), size.x());
+    FloatImage tmp{{size.x(), image.size.y()}, channelCount, std::vector<Float>(std::size_t(size.x())*image.size.y()*channelCount)};
+    Implementation::parallelFor(image.size.y(), threadCount, 8, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t y = begin; y != end; ++y) {
+            const Float* const src = image.data.data() + y*image.size.x()*channelCount;
+            Float* const dst = tmp.data.data() + y*size.x()*channelCount;
+            for(Int x = 0; x != size.x(); ++x) {
+                const Float* const weights = horizontal.weights.data() + horizontal.offset[x];
+                const Float* const pixels = src + horizontal.first[x]*channelCount;
+                Float* const out = dst + x*channelCount;
+                for(Int i = 0; i != horizontal.count[x]; ++i)
+                    for(std::size_t c = 0; c != channelCount; ++c)
+                        out[c] += pixels[i*channelCount + c]*weights[i];
+            }
+        }
+    });
+
+    /* Vertical pass, each output row is a weighted sum of whole input rows */
+    const Contributions vertical = contributions(filter, image.size.y(), size.y());
+    const std::size_t rowSize = std::size_t(size.x())*channelCount;
+    FloatImage out{size, channelCount, std::vector<Float>(rowSize*size.y())};
+    Implementation::parallelFor(size.y(), threadCount, 8, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t y = begin; y != end; ++y) {
+            Float* const dst = out.data.data() + y*rowSize;
+            const Float* const weights = vertical.weights.data() + vertical.offset[y];
+            for(Int i = 0; i != vertical.count[y]; ++i) {
+                const Float* const src = tmp.data.data() + (vertical.first[y] + i)*rowSize;
+                const Float weight = weights[i];
+                for(std::size_t j = 0; j != rowSize; ++j)
+                    dst[j] += src[j]*weight;
+            }
+        }
+    });
+
+    return out;
+}
+
+std::size_t checkImage(const char* const function, const ImageView2D& image, const ResampleFlags flags) {
+    const std::size_t size = Implementation::componentSize(image.type());
+    const std::size_t channelCount = size ? image.pixelSize()/size : 0;
+    CORRADE_ASSERT(channelCount >= 1 && channelCount <= 4,
+        "TextureTools::" << Debug::nospace << function << Debug::nospace << "(): unsupported image" << image.format() << image.type(), 0);
+    CORRADE_ASSERT(!(flags & ResampleFlag::Srgb) || image.type() == PixelType::UnsignedByte,
+        "TextureTools::" << Debug::nospace << function << Debug::nospace << "(): sRGB resampling is supported only for unsigned byte images", 0);
+    static_cast<void>(function);
+    return channelCount;
+}
+
+}
+
+Image2D resample(const ImageView2D& image, const Vector2i& size, const ResampleFilter filter, const ResampleFlags flags, UnsignedInt threadCount) {
+    const std::size_t channelCount = checkImage("resample", image, flags);
+    if(!channelCount) return Image2D{image.format(), image.type()};
+    CORRADE_ASSERT(size.product() && image.size().product(),
+        "TextureTools::resample(): can't resample" << image.size() << "to" << size, (Image2D{image.format(), image.type()}));
+
+    if(!threadCount) threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    const bool srgb = !!(flags & ResampleFlag::Srgb);
+    return fromFloat(resampleFloat(toFloat(image, channelCount, srgb), size, filter, threadCount), image.format(), image.type(), srgb);
+}
+
+std::vector<Image2D> generateMipmaps(const ImageView2D& image, const ResampleFilter filter, const ResampleFlags flags, UnsignedInt threadCount) {
+    const std::size_t channelCount = checkImage("generateMipmaps", image, flags);
+    if(!channelCount) return {};
+    CORRADE_ASSERT(image.size().product(),
+        "TextureTools::generateMipmaps(): can't generate mipmaps of" << image.size() << "image", {});
+
+    if(!threadCount) threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    const bool srgb = !!(flags & ResampleFlag::Srgb);
+    std::vector<Image2D> levels;
+    levels.reserve(mipLevelCount(image.size()));
+
+    FloatImage level = toFloat(image, channelCount, srgb);
+    levels.push_back(fromFloat(level, image.format(), image.type(), srgb));
+    while(level.size != Vector2i{1}) {
+        level = resampleFloat(level, Math::max(level.size/2, Vector2i{1}), filter, threadCount);
+        levels.push_back(fromFloat(level, image.format(), image.type(), srgb));
+    }
+
+    return levels;
+}
+
+}}
@@ -0,0 +1,161 @@
+#ifndef Magnum_TextureTools_Resample_h
+#define Magnum_TextureTools_Resample_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::TextureTools::resample(), @ref Magnum::TextureTools::generateMipmaps(), @ref Magnum::TextureTools::mipLevelCount(), enum @ref Magnum::TextureTools::ResampleFilter, @ref Magnum::TextureTools::ResampleFlag, enum set @ref Magnum::TextureTools::ResampleFlags
+ */
+
+#include <vector>
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/TextureTools/visibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Resampling filter
+
+@see @ref resample(), @ref generateMipmaps()
+*/
+enum class ResampleFilter: UnsignedByte {
+    /**
+     * Box filter. Each output pixel is an area-weighted average of the
+     * input pixels it covers, which for halving the size is the average of
+     * each 2x2 block. Fastest, but prone to aliasing when minifying by
+     * other than power-of-two factors.
+     */
+    Box,
+
+    /**
+     * Kaiser-windowed sinc with radius of three pixels and
+     * @f$ \alpha = 4 @f$. Sharper than @ref ResampleFilter::Box with little
+     * ringing, a good default for mip level generation.
+     */
+    Kaiser,
+
+    /**
+     * Lanczos filter with radius of three pixels. Sharpest, but may
+     * produce visible ringing around high-contrast edges.
+     */
+    Lanczos
+};
+
+/**
+@brief Resampling flag
+
+@see @ref ResampleFlags, @ref resample(), @ref generateMipmaps()
+*/
+enum class ResampleFlag: UnsignedByte {
+    /**
+     * The image is in sRGB color space. The data are converted to linear
+     * space before filtering and back after, so the filtered image keeps the
+     * perceived brightness. Alpha of four-channel images is filtered
+     * without any conversion. Supported only for
+     * @ref PixelType::UnsignedByte images.
+     */
+    Srgb = 1 << 0
+};
+
+/**
+@brief Resampling flags
+
+@see @ref resample(), @ref generateMipmaps()
+*/
+typedef Containers::EnumSet<ResampleFlag> ResampleFlags;
+
+CORRADE_ENUMSET_OPERATORS(ResampleFlags)
+
+/**
+@brief Resample image to different size
+@param image        Input image
+@param size         Output size
+@param filter       Filter to use
+@param flags        Resampling flags
+@param threadCount  Max count of threads to use from
+    @ref TaskScheduler::global(). If set to @cpp 0 @ce,
+    @ref std::thread::hardware_concurrency() is used.
+
+Expects @ref PixelType::UnsignedByte, @ref PixelType::UnsignedShort or
+@ref PixelType::Float image with one to four channels, the @ref PixelStorage
+parameters of the input are taken into account. The filtering is done on
+floating-point data in two separable passes with the filter widened by the
+scale factor when minifying, pixels outside of the image are clamped to the
+edge. The output image has the same format and type as the input and default
+pixel storage.
+
+The rows are distributed among the threads in both passes, the inner loops
+work on contiguous floating-point data so they can be vectorized by the
+compiler.
+@see @ref PixelConversion
+*/
+MAGNUM_TEXTURETOOLS_EXPORT Image2D resample(const ImageView2D& image, const Vector2i& size, ResampleFilter filter = ResampleFilter::Lanczos, ResampleFlags flags = {}, UnsignedInt threadCount = 1);
+
+/**
+@brief Generate full mip chain
+@param image        Image of level `0`
+@param filter       Filter to use
+@param flags        Resampling flags
+@param threadCount  Max count of threads to use from
+    @ref TaskScheduler::global(). If set to @cpp 0 @ce,
+    @ref std::thread::hardware_concurrency() is used.
+
+Returns @ref mipLevelCount() images, the first being a copy of @p image in
+default pixel storage and each next one half the size of the previous one,
+rounded down, down to @f$ 1 \times 1 @f$. Each level is calculated from the
+floating-point data of the previous one, so the result isn't degraded by
+repeated quantization. Expectations on the image are the same as in
+@ref resample(). The levels can be then directly uploaded with e.g.
+@ref Texture::setSubImage() instead of using @ref Texture::generateMipmap()
+at runtime:
+@code
+std::vector<Image2D> levels = TextureTools::generateMipmaps(image,
+    TextureTools::ResampleFilter::Kaiser, TextureTools::ResampleFlag::Srgb);
+
+Texture2D texture;
+texture.setStorage(levels.size(), TextureFormat::SRGB8Alpha8, levels[0].size());
+for(std::size_t i = 0; i != levels.size(); ++i)
+    texture.setSubImage(i, {}, levels[i]);
+@endcode
+*/
+MAGNUM_TEXTURETOOLS_EXPORT std::vector<Image2D> generateMipmaps(const ImageView2D& image, ResampleFilter filter = ResampleFilter::Box, ResampleFlags flags = {}, UnsignedInt threadCount = 1);
+
+/**
+@brief Mip level count for given size
+
+Count of levels of a full mip chain, i.e. @f$ \lfloor \log_2 n \rfloor + 1 @f$
+where @f$ n @f$ is the larger dimension.
+@see @ref generateMipmaps()
+*/
+inline Int mipLevelCount(const Vector2i& size) {
+    return Math::log2(UnsignedInt(Math::max(size.max(), 1))) + 1;
+}
+
+}}
+
+#endif
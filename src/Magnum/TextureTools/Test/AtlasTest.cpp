@@ -38,13 +38,45 @@ struct AtlasTest: TestSuite::Tester {
     void createPadding();
     void createEmpty();
     void createTooSmall();
+    void createDense();
+
+    void packerAdd();
+    void packerAddFull();
+    void packerAddMultipleFull();
+    void packerRemove();
+    void packerRotation();
+    void packerSort();
+    void packerNoOverlap();
+
+    void arrayAdd();
+    void arrayAddFull();
+    void arrayAddMultiple();
+    void arrayAddMultipleFull();
+    void arrayRemove();
+    void arrayCreateTooSmall();
 };
 
 AtlasTest::AtlasTest() {
     addTests({&AtlasTest::create,
               &AtlasTest::createPadding,
               &AtlasTest::createEmpty,
-              &AtlasTest::createTooSmall});
+              &AtlasTest::createTooSmall,
+              &AtlasTest::createDense,
+
+              &AtlasTest::packerAdd,
+              &AtlasTest::packerAddFull,
+              &AtlasTest::packerAddMultipleFull,
+              &AtlasTest::packerRemove,
+              &AtlasTest::packerRotation,
+              &AtlasTest::packerSort,
+              &AtlasTest::packerNoOverlap,
+
+              &AtlasTest::arrayAdd,
+              &AtlasTest::arrayAddFull,
+              &AtlasTest::arrayAddMultiple,
+              &AtlasTest::arrayAddMultipleFull,
+              &AtlasTest::arrayRemove,
+              &AtlasTest::arrayCreateTooSmall});
 }
 
 void AtlasTest::create() {
@@ -56,9 +88,9 @@ void AtlasTest::create() {
 
     CORRADE_COMPARE(atlas.size(), 3);
     CORRADE_COMPARE(atlas, (std::vector<Range2Di>{
-        Range2Di::fromSize({0, 0}, {12, 18}),
-        Range2Di::fromSize({32, 0}, {32, 15}),
-        Range2Di::fromSize({0, 25}, {23, 25})}));
+        Range2Di::fromSize({0, 25}, {12, 18}),
+        Range2Di::fromSize({23, 0}, {32, 15}),
+        Range2Di::fromSize({0, 0}, {23, 25})}));
 }
 
 void AtlasTest::createPadding() {
@@ -70,9 +102,9 @@ void AtlasTest::createPadding() {
 
     CORRADE_COMPARE(atlas.size(), 3);
     CORRADE_COMPARE(atlas, (std::vector<Range2Di>{
-        Range2Di::fromSize({2, 1}, {8, 16}),
-        Range2Di::fromSize({34, 1}, {28, 13}),
-        Range2Di::fromSize({2, 26}, {19, 23})}));
+        Range2Di::fromSize({2, 26}, {8, 16}),
+        Range2Di::fromSize({25, 1}, {28, 13}),
+        Range2Di::fromSize({2, 1}, {19, 23})}));
 }
 
 void AtlasTest::createEmpty() {
@@ -84,13 +116,257 @@ void AtlasTest::createTooSmall() {
     std::ostringstream o;
     Error redirectError{&o};
 
-    std::vector<Range2Di> atlas = TextureTools::atlas({64, 32}, {
+    std::vector<Range2Di> atlas = TextureTools::atlas({32, 32}, {
         {8, 16},
         {21, 13},
         {19, 29}
     }, {2, 1});
     CORRADE_VERIFY(atlas.empty());
-    CORRADE_COMPARE(o.str(), "TextureTools::atlas(): requested atlas size Vector(64, 32) is too small to fit 3 Vector(25, 31) textures. Generated atlas will be empty.\n");
+    CORRADE_COMPARE(o.str(), "TextureTools::atlas(): requested atlas size Vector(32, 32) is too small to fit 3 textures with padding Vector(2, 1). Generated atlas will be empty.\n");
+}
+
+void AtlasTest::createDense() {
+    /* A grid sized by the largest texture would fit only five of these, but
+       they cover the whole atlas when packed */
+    std::vector<Vector2i> sizes(14, {16, 16});
+    sizes.push_back({32, 16});
+    sizes.push_back({64, 16});
+
+    std::vector<Range2Di> atlas = TextureTools::atlas({64, 80}, sizes);
+    CORRADE_COMPARE(atlas.size(), sizes.size());
+
+    Int area = 0;
+    for(std::size_t i = 0; i != atlas.size(); ++i) {
+        CORRADE_COMPARE(atlas[i].size(), sizes[i]);
+        area += atlas[i].size().product();
+    }
+    CORRADE_COMPARE(area, 64*80);
+}
+
+void AtlasTest::packerAdd() {
+    AtlasPacker packer{{64, 64}, {1, 1}};
+    CORRADE_COMPARE(packer.size(), (Vector2i{64, 64}));
+    CORRADE_COMPARE(packer.padding(), (Vector2i{1, 1}));
+    CORRADE_COMPARE(packer.count(), 0);
+    CORRADE_COMPARE(packer.occupancy(), 0.0f);
+
+    std::optional<Range2Di> a = packer.add({30, 14});
+    CORRADE_VERIFY(a);
+    CORRADE_COMPARE(*a, Range2Di::fromSize({1, 1}, {30, 14}));
+
+    /* Added later without touching the first one */
+    std::optional<Range2Di> b = packer.add({30, 14});
+    CORRADE_VERIFY(b);
+    CORRADE_COMPARE(*b, Range2Di::fromSize({33, 1}, {30, 14}));
+
+    CORRADE_COMPARE(packer.count(), 2);
+    CORRADE_COMPARE(packer.occupancy(), 2*30*14/4096.0f);
+}
+
+void AtlasTest::packerAddFull() {
+    AtlasPacker packer{{32, 32}};
+    CORRADE_VERIFY(packer.add({32, 20}));
+    CORRADE_VERIFY(!packer.add({16, 16}));
+    CORRADE_COMPARE(packer.count(), 1);
+
+    /* The remaining space is still usable */
+    std::optional<Range2Di> a = packer.add({32, 12});
+    CORRADE_VERIFY(a);
+    CORRADE_COMPARE(*a, Range2Di::fromSize({0, 20}, {32, 12}));
+    CORRADE_COMPARE(packer.occupancy(), 1.0f);
+}
+
+void AtlasTest::packerAddMultipleFull() {
+    AtlasPacker packer{{32, 32}};
+    CORRADE_VERIFY(packer.add(std::vector<Vector2i>{{16, 16}, {16, 16}, {32, 20}}).empty());
+
+    /* Nothing was added */
+    CORRADE_COMPARE(packer.count(), 0);
+    CORRADE_COMPARE(packer.occupancy(), 0.0f);
+    std::optional<Range2Di> a = packer.add({32, 32});
+    CORRADE_VERIFY(a);
+    CORRADE_COMPARE(*a, Range2Di::fromSize({}, {32, 32}));
+}
+
+void AtlasTest::packerRemove() {
+    AtlasPacker packer{{32, 32}, {1, 1}};
+    std::optional<Range2Di> a = packer.add({14, 30});
+    std::optional<Range2Di> b = packer.add({14, 30});
+    CORRADE_VERIFY(a && b);
+    CORRADE_VERIFY(!packer.add({30, 14}));
+
+    /* The space of the first one can be reused */
+    packer.remove(*a);
+    CORRADE_COMPARE(packer.count(), 1);
+    CORRADE_COMPARE(packer.occupancy(), 14*30/1024.0f);
+    std::optional<Range2Di> c = packer.add({14, 14});
+    CORRADE_VERIFY(c);
+    CORRADE_COMPARE(*c, Range2Di::fromSize(a->min(), {14, 14}));
+    CORRADE_VERIFY(packer.add({14, 14}));
+    CORRADE_VERIFY(!packer.add({14, 14}));
+}
+
+void AtlasTest::packerRotation() {
+    {
+        AtlasPacker packer{{32, 16}};
+        CORRADE_VERIFY(!packer.add({16, 32}));
+    } {
+        AtlasPacker packer{{32, 16}, {}, AtlasPackerFlag::AllowRotation};
+        std::optional<Range2Di> a = packer.add({16, 32});
+        CORRADE_VERIFY(a);
+        CORRADE_COMPARE(*a, Range2Di::fromSize({}, {32, 16}));
+    }
+}
+
+void AtlasTest::packerSort() {
+    /* Packing the small textures first fragments the space so the large one
+       doesn't fit anymore */
+    const std::vector<Vector2i> sizes{{16, 4}, {4, 32}, {20, 24}};
+
+    CORRADE_VERIFY(AtlasPacker{{32, 32}}.add(sizes, AtlasSortHeuristic::None).empty());
+
+    std::vector<Range2Di> atlas = AtlasPacker{{32, 32}}.add(sizes, AtlasSortHeuristic::Area);
+    CORRADE_COMPARE(atlas, (std::vector<Range2Di>{
+        Range2Di::fromSize({0, 24}, {16, 4}),
+        Range2Di::fromSize({20, 0}, {4, 32}),
+        Range2Di::fromSize({0, 0}, {20, 24})}));
+
+    /* Different order, but fits as well */
+    CORRADE_COMPARE((AtlasPacker{{32, 32}}.add(sizes, AtlasSortHeuristic::MaxSide).size()), 3);
+    CORRADE_COMPARE((AtlasPacker{{32, 32}}.add(sizes, AtlasSortHeuristic::Perimeter).size()), 3);
+}
+
+void AtlasTest::packerNoOverlap() {
+    /* Pseudo-random sizes */
+    std::vector<Vector2i> sizes;
+    UnsignedInt seed = 17;
+    Int area = 0;
+    for(std::size_t i = 0; i != 120; ++i) {
+        seed = seed*1103515245 + 12345;
+        const Int x = 2 + (seed >> 16) % 30;
+        seed = seed*1103515245 + 12345;
+        const Int y = 2 + (seed >> 16) % 30;
+        sizes.push_back({x, y});
+        area += x*y;
+    }
+
+    AtlasPacker packer{{256, 256}, {1, 2}, AtlasPackerFlag::AllowRotation};
+    std::vector<Range2Di> atlas = packer.add(sizes);
+    CORRADE_COMPARE(atlas.size(), sizes.size());
+
+    for(std::size_t i = 0; i != atlas.size(); ++i) {
+        const Range2Di padded{atlas[i].min() - Vector2i{1, 2}, atlas[i].max() + Vector2i{1, 2}};
+        CORRADE_VERIFY(atlas[i].size() == sizes[i] || atlas[i].size() == (Vector2i{sizes[i].y(), sizes[i].x()}));
+        CORRADE_VERIFY(padded.min().x() >= 0 && padded.min().y() >= 0);
+        CORRADE_VERIFY(padded.max().x() <= 256 && padded.max().y() <= 256);
+        for(std::size_t j = 0; j != i; ++j) {
+            const Range2Di other{atlas[j].min() - Vector2i{1, 2}, atlas[j].max() + Vector2i{1, 2}};
+            CORRADE_VERIFY(padded.max().x() <= other.min().x() || other.max().x() <= padded.min().x() ||
+                           padded.max().y() <= other.min().y() || other.max().y() <= padded.min().y());
+        }
+    }
+
+    CORRADE_COMPARE(packer.count(), 120);
+    CORRADE_COMPARE(packer.occupancy(), area/65536.0f);
+}
+
+void AtlasTest::arrayAdd() {
+    AtlasArrayPacker packer{{32, 32, 4}, {1, 1}};
+    CORRADE_COMPARE(packer.size(), (Vector3i{32, 32, 4}));
+    CORRADE_COMPARE(packer.padding(), (Vector2i{1, 1}));
+    CORRADE_COMPARE(packer.layerCount(), 0);
+    CORRADE_COMPARE(packer.count(), 0);
+    CORRADE_COMPARE(packer.occupancy(), 0.0f);
+
+    std::optional<std::pair<Int, Range2Di>> a = packer.add({30, 20});
+    CORRADE_VERIFY(a);
+    CORRADE_COMPARE(a->first, 0);
+    CORRADE_COMPARE(a->second, Range2Di::fromSize({1, 1}, {30, 20}));
+    CORRADE_COMPARE(packer.layerCount(), 1);
+
+    /* Doesn't fit into the first layer anymore, spills into a new one */
+    std::optional<std::pair<Int, Range2Di>> b = packer.add({30, 20});
+    CORRADE_VERIFY(b);
+    CORRADE_COMPARE(b->first, 1);
+    CORRADE_COMPARE(b->second, Range2Di::fromSize({1, 1}, {30, 20}));
+    CORRADE_COMPARE(packer.layerCount(), 2);
+
+    /* Fills the remaining space in the first layer */
+    std::optional<std::pair<Int, Range2Di>> c = packer.add({30, 8});
+    CORRADE_VERIFY(c);
+    CORRADE_COMPARE(c->first, 0);
+    CORRADE_COMPARE(c->second, Range2Di::fromSize({1, 23}, {30, 8}));
+    CORRADE_COMPARE(packer.layerCount(), 2);
+
+    CORRADE_COMPARE(packer.count(), 3);
+    CORRADE_COMPARE(packer.layer(0).count(), 2);
+    CORRADE_COMPARE(packer.layer(1).count(), 1);
+    CORRADE_COMPARE(packer.occupancy(), (2*30*20 + 30*8)/2048.0f);
+}
+
+void AtlasTest::arrayAddFull() {
+    AtlasArrayPacker packer{{32, 32, 2}};
+    CORRADE_VERIFY(packer.add({32, 20}));
+    CORRADE_VERIFY(packer.add({32, 20}));
+    CORRADE_VERIFY(!packer.add({32, 20}));
+    CORRADE_COMPARE(packer.layerCount(), 2);
+
+    /* Too large to fit even into an empty layer, no layer is used for it */
+    AtlasArrayPacker another{{32, 32, 2}};
+    CORRADE_VERIFY(!another.add({33, 16}));
+    CORRADE_COMPARE(another.layerCount(), 0);
+}
+
+void AtlasTest::arrayAddMultiple() {
+    std::vector<std::pair<Int, Range2Di>> atlas = AtlasArrayPacker{{32, 32, 3}}.add(std::vector<Vector2i>{{32, 16}, {32, 32}, {32, 16}, {32, 16}});
+    CORRADE_COMPARE(atlas, (std::vector<std::pair<Int, Range2Di>>{
+        {1, Range2Di::fromSize({0, 0}, {32, 16})},
+        {0, Range2Di::fromSize({0, 0}, {32, 32})},
+        {1, Range2Di::fromSize({0, 16}, {32, 16})},
+        {2, Range2Di::fromSize({0, 0}, {32, 16})}}));
+
+    CORRADE_COMPARE(TextureTools::atlasArray({32, 32, 3}, {{32, 16}, {32, 32}, {32, 16}, {32, 16}}), atlas);
+}
+
+void AtlasTest::arrayAddMultipleFull() {
+    AtlasArrayPacker packer{{32, 32, 2}};
+    CORRADE_VERIFY(packer.add({16, 16}));
+    CORRADE_VERIFY(packer.add(std::vector<Vector2i>{{32, 32}, {32, 32}}).empty());
+
+    /* Nothing was added */
+    CORRADE_COMPARE(packer.layerCount(), 1);
+    CORRADE_COMPARE(packer.count(), 1);
+    std::optional<std::pair<Int, Range2Di>> a = packer.add({32, 32});
+    CORRADE_VERIFY(a);
+    CORRADE_COMPARE(a->first, 1);
+}
+
+void AtlasTest::arrayRemove() {
+    AtlasArrayPacker packer{{32, 32, 1}};
+    std::optional<std::pair<Int, Range2Di>> a = packer.add({32, 32});
+    CORRADE_VERIFY(a);
+    CORRADE_VERIFY(!packer.add({16, 16}));
+
+    packer.remove(a->first, a->second);
+    CORRADE_COMPARE(packer.count(), 0);
+    CORRADE_COMPARE(packer.layerCount(), 1);
+
+    std::optional<std::pair<Int, Range2Di>> b = packer.add({16, 16});
+    CORRADE_VERIFY(b);
+    CORRADE_COMPARE(b->first, 0);
+}
+
+void AtlasTest::arrayCreateTooSmall() {
+    std::ostringstream o;
+    Error redirectError{&o};
+
+    std::vector<std::pair<Int, Range2Di>> atlas = TextureTools::atlasArray({32, 32, 2}, {
+        {32, 32},
+        {32, 32},
+        {32, 32}
+    });
+    CORRADE_VERIFY(atlas.empty());
+    CORRADE_COMPARE(o.str(), "TextureTools::atlasArray(): requested atlas size Vector(32, 32, 2) is too small to fit 3 textures with padding Vector(0, 0). Generated atlas will be empty.\n");
 }
 
 }}}
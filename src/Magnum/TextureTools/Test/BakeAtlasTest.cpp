@@ -0,0 +1,122 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/TextureTools/BakeAtlas.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+struct BakeAtlasTest: TestSuite::Tester {
+    explicit BakeAtlasTest();
+
+    void wrongCount();
+    void differentFormat();
+    void outOfBounds();
+
+    void padding();
+    void resize();
+};
+
+BakeAtlasTest::BakeAtlasTest() {
+    addTests({&BakeAtlasTest::wrongCount,
+              &BakeAtlasTest::differentFormat,
+              &BakeAtlasTest::outOfBounds,
+
+              &BakeAtlasTest::padding,
+              &BakeAtlasTest::resize});
+}
+
+void BakeAtlasTest::wrongCount() {
+    const Float data[]{0.0f};
+
+    std::stringstream ss;
+    Error redirectError{&ss};
+    bakeAtlas({4, 4}, {ImageView2D{PixelFormat::Red, PixelType::Float, {1, 1}, data}}, {});
+
+    CORRADE_COMPARE(ss.str(), "TextureTools::bakeAtlas(): expected the same non-zero count of images and ranges, got 1 and 0\n");
+}
+
+void BakeAtlasTest::differentFormat() {
+    const Float data[]{0.0f};
+
+    std::stringstream ss;
+    Error redirectError{&ss};
+    bakeAtlas({4, 4}, {ImageView2D{PixelFormat::Red, PixelType::Float, {1, 1}, data},
+                       ImageView2D{PixelFormat::RGBA, PixelType::UnsignedByte, {1, 1}, data}},
+        {{{}, {1, 1}}, {{1, 1}, {2, 2}}});
+
+    CORRADE_COMPARE(ss.str(), "TextureTools::bakeAtlas(): image 1 has different format than the first image\n");
+}
+
+void BakeAtlasTest::outOfBounds() {
+    const Float data[]{0.0f};
+
+    std::stringstream ss;
+    Error redirectError{&ss};
+    bakeAtlas({4, 4}, {ImageView2D{PixelFormat::Red, PixelType::Float, {1, 1}, data}},
+        {{{3, 3}, {5, 4}}});
+
+    CORRADE_COMPARE(ss.str(), "TextureTools::bakeAtlas(): range 0 is empty or out of atlas bounds\n");
+}
+
+void BakeAtlasTest::padding() {
+    const Float a[]{1.0f, 2.0f,
+                    4.0f, 5.0f};
+    const Float b[]{3.0f};
+    const Image2D out = bakeAtlas({7, 4}, {
+        ImageView2D{PixelFormat::Red, PixelType::Float, {2, 2}, a},
+        ImageView2D{PixelFormat::Red, PixelType::Float, {1, 1}, b}},
+        {{{1, 1}, {3, 3}}, {{5, 1}, {6, 2}}}, {1, 1});
+
+    CORRADE_COMPARE(out.format(), PixelFormat::Red);
+    CORRADE_COMPARE(out.type(), PixelType::Float);
+    CORRADE_COMPARE(out.size(), (Vector2i{7, 4}));
+
+    /* Edge pixels are repeated over the padding, the rest is zero */
+    CORRADE_COMPARE_AS((std::vector<Float>{out.data<Float>(), out.data<Float>() + 7*4}), (std::vector<Float>{
+        1.0f, 1.0f, 2.0f, 2.0f, 3.0f, 3.0f, 3.0f,
+        1.0f, 1.0f, 2.0f, 2.0f, 3.0f, 3.0f, 3.0f,
+        4.0f, 4.0f, 5.0f, 5.0f, 3.0f, 3.0f, 3.0f,
+        4.0f, 4.0f, 5.0f, 5.0f, 0.0f, 0.0f, 0.0f}), TestSuite::Compare::Container);
+}
+
+void BakeAtlasTest::resize() {
+    const Float data[]{0.0f, 1.0f,
+                       0.5f, 0.5f};
+    const Image2D out = bakeAtlas({2, 1}, {ImageView2D{PixelFormat::Red, PixelType::Float, {2, 2}, data}},
+        {{{1, 0}, {2, 1}}});
+
+    /* Downsampled to a single pixel */
+    CORRADE_COMPARE(out.data<Float>()[0], 0.0f);
+    CORRADE_COMPARE(out.data<Float>()[1], 0.5f);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::BakeAtlasTest)
@@ -0,0 +1,303 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <random>
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Bezier.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/TextureTools/DistanceField.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+struct DistanceFieldTest: TestSuite::Tester {
+    explicit DistanceFieldTest();
+
+    void singlePixel();
+    void empty();
+    void bruteForce();
+    void downscale();
+    void threads();
+    void rgbInput();
+    void wrongType();
+
+    void multichannelSquare();
+    void multichannelSmooth();
+    void multichannelOrientation();
+    void multichannelEmpty();
+    void multichannelThreads();
+};
+
+DistanceFieldTest::DistanceFieldTest() {
+    addTests({&DistanceFieldTest::singlePixel,
+              &DistanceFieldTest::empty,
+              &DistanceFieldTest::bruteForce,
+              &DistanceFieldTest::downscale,
+              &DistanceFieldTest::threads,
+              &DistanceFieldTest::rgbInput,
+              &DistanceFieldTest::wrongType,
+
+              &DistanceFieldTest::multichannelSquare,
+              &DistanceFieldTest::multichannelSmooth,
+              &DistanceFieldTest::multichannelOrientation,
+              &DistanceFieldTest::multichannelEmpty,
+              &DistanceFieldTest::multichannelThreads});
+}
+
+namespace {
+
+/* Widths are multiples of four, so the rows are aligned */
+std::vector<UnsignedByte> randomImage(const Vector2i& size) {
+    std::mt19937 random{7};
+    std::vector<UnsignedByte> data(size.product());
+    /* Blobs instead of noise, so the distances are more than one pixel */
+    for(Int y = 0; y != size.y(); ++y) for(Int x = 0; x != size.x(); ++x)
+        data[y*size.x() + x] = ((x/3 + y/5 + random()%2) % 3 == 0) ? 255 : 0;
+    return data;
+}
+
+ImageView2D view(const PixelFormat format, const Vector2i& size, const std::vector<UnsignedByte>& data) {
+    return ImageView2D{format, PixelType::UnsignedByte, size, Containers::ArrayView<const void>{data.data(), data.size()}};
+}
+
+/* Direct implementation of what the GPU shader does */
+UnsignedByte bruteForceValue(const std::vector<UnsignedByte>& data, const Vector2i& size, const Vector2i& position, const Int radius) {
+    const bool inside = data[position.y()*size.x() + position.x()] > 127;
+    Float minDistanceSquared = (radius + 1)*(radius + 1);
+    for(Int y = 0; y != size.y(); ++y) for(Int x = 0; x != size.x(); ++x) {
+        if((data[y*size.x() + x] > 127) == inside) continue;
+        minDistanceSquared = Math::min(minDistanceSquared, Float((Vector2i{x, y} - position).dot()));
+    }
+
+    const Float value = (inside ? 1.0f : -1.0f)*std::sqrt(minDistanceSquared)/Float(radius*2 + 2) + 0.5f;
+    return UnsignedByte(Math::round(value*255.0f));
+}
+
+QuadraticBezier2D line(const Vector2& a, const Vector2& b) {
+    return {a, Math::lerp(a, b, 0.5f), b};
+}
+
+/* Clockwise 8x8 square at origin */
+const std::vector<std::vector<QuadraticBezier2D>> Square{{
+    line({0.0f, 0.0f}, {0.0f, 8.0f}),
+    line({0.0f, 8.0f}, {8.0f, 8.0f}),
+    line({8.0f, 8.0f}, {8.0f, 0.0f}),
+    line({8.0f, 0.0f}, {0.0f, 0.0f})
+}};
+
+UnsignedByte median(const UnsignedByte* const pixel) {
+    return Math::max(Math::min(pixel[0], pixel[1]), Math::min(Math::max(pixel[0], pixel[1]), pixel[2]));
+}
+
+}
+
+void DistanceFieldTest::singlePixel() {
+    /* 8x8 image with one white pixel at (3, 3) */
+    UnsignedByte data[64]{};
+    data[3*8 + 3] = 255;
+
+    Image2D output = distanceField(ImageView2D{PixelFormat::Red, PixelType::UnsignedByte, {8, 8}, data}, {8, 8}, 2);
+    CORRADE_COMPARE(output.format(), PixelFormat::Red);
+    CORRADE_COMPARE(output.type(), PixelType::UnsignedByte);
+    CORRADE_COMPARE(output.size(), Vector2i(8, 8));
+
+    const UnsignedByte* const out = output.data<UnsignedByte>();
+
+    /* Inside, nearest outside is one pixel away: 1/6 + 0.5 */
+    CORRADE_COMPARE(Int(out[3*8 + 3]), 170);
+    /* Outside, one pixel away: -1/6 + 0.5 */
+    CORRADE_COMPARE(Int(out[3*8 + 2]), 85);
+    /* Diagonal: -sqrt(2)/6 + 0.5 */
+    CORRADE_COMPARE(Int(out[2*8 + 2]), 67);
+    /* Three pixels away, which is limited to radius + 1 */
+    CORRADE_COMPARE(Int(out[3*8 + 0]), 0);
+    CORRADE_COMPARE(Int(out[7*8 + 7]), 0);
+}
+
+void DistanceFieldTest::empty() {
+    /* Nothing inside, everything is at max distance */
+    UnsignedByte data[16]{};
+    Image2D output = distanceField(ImageView2D{PixelFormat::Red, PixelType::UnsignedByte, {4, 4}, data}, {4, 4}, 3);
+    for(std::size_t i = 0; i != 16; ++i)
+        CORRADE_COMPARE(Int(output.data<UnsignedByte>()[i]), 0);
+}
+
+void DistanceFieldTest::bruteForce() {
+    const Vector2i size{32, 24};
+    const std::vector<UnsignedByte> data = randomImage(size);
+
+    for(const Int radius: {1, 4, 16}) {
+        Image2D output = distanceField(view(PixelFormat::Red, size, data), size, radius);
+        for(Int y = 0; y != size.y(); ++y) for(Int x = 0; x != size.x(); ++x) {
+            const UnsignedByte expected = bruteForceValue(data, size, {x, y}, radius);
+            const UnsignedByte actual = output.data<UnsignedByte>()[y*size.x() + x];
+            if(actual == expected) continue;
+
+            std::ostringstream out;
+            out << "radius " << radius << ", pixel " << x << " " << y;
+            CORRADE_COMPARE(out.str() + ": " + std::to_string(actual), out.str() + ": " + std::to_string(expected));
+        }
+    }
+}
+
+void DistanceFieldTest::downscale() {
+    const Vector2i size{32, 24};
+    const std::vector<UnsignedByte> data = randomImage(size);
+
+    /* Output row length 6 is padded to 8 bytes */
+    Image2D output = distanceField(view(PixelFormat::Red, size, data), {6, 4}, 4);
+    CORRADE_COMPARE(output.size(), Vector2i(6, 4));
+    CORRADE_COMPARE(output.data().size(), 8*4);
+    for(Int y = 0; y != 4; ++y) for(Int x = 0; x != 6; ++x) {
+        const Vector2i position{Vector2{Float(x), Float(y)}*Vector2{size}/Vector2{6.0f, 4.0f}};
+        CORRADE_COMPARE(Int(output.data<UnsignedByte>()[y*8 + x]), Int(bruteForceValue(data, size, position, 4)));
+    }
+}
+
+void DistanceFieldTest::threads() {
+    const Vector2i size{32, 24};
+    const std::vector<UnsignedByte> data = randomImage(size);
+    const ImageView2D input = view(PixelFormat::Red, size, data);
+
+    Image2D single = distanceField(input, size, 8, 1);
+    Image2D multiple = distanceField(input, size, 8, 7);
+    CORRADE_COMPARE(std::string(multiple.data(), multiple.data().size()),
+                    std::string(single.data(), single.data().size()));
+}
+
+void DistanceFieldTest::rgbInput() {
+    const Vector2i size{8, 4};
+    const std::vector<UnsignedByte> data = randomImage(size);
+
+    /* Only the red channel is taken, 24 bytes per row is already aligned */
+    std::vector<UnsignedByte> rgb(size.product()*3);
+    for(std::size_t i = 0; i != data.size(); ++i) {
+        rgb[i*3] = data[i];
+        rgb[i*3 + 1] = 255 - data[i];
+        rgb[i*3 + 2] = 255;
+    }
+
+    Image2D red = distanceField(view(PixelFormat::Red, size, data), size, 2);
+    Image2D fromRgb = distanceField(view(PixelFormat::RGB, size, rgb), size, 2);
+    CORRADE_COMPARE(std::string(fromRgb.data(), fromRgb.data().size()),
+                    std::string(red.data(), red.data().size()));
+}
+
+void DistanceFieldTest::wrongType() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Float data[4]{};
+    distanceField(ImageView2D{PixelFormat::Red, PixelType::Float, {2, 2}, data}, {2, 2}, 1);
+    CORRADE_COMPARE(out.str(), "TextureTools::distanceField(): expected PixelType::UnsignedByte input, got PixelType::Float\n");
+}
+
+void DistanceFieldTest::multichannelSquare() {
+    /* One output pixel per unit, 4 units around the square */
+    Image2D output = multichannelDistanceField(Square, {{-4.0f, -4.0f}, {12.0f, 12.0f}}, {16, 16}, 4.0f);
+    CORRADE_COMPARE(output.format(), PixelFormat::RGB);
+    CORRADE_COMPARE(output.type(), PixelType::UnsignedByte);
+    CORRADE_COMPARE(output.size(), Vector2i(16, 16));
+    CORRADE_COMPARE(output.data().size(), 48*16);
+
+    /* The median reconstructs the square including its corners, i.e. the
+       distance outside is the largest distance along one of the axes */
+    bool differentChannels = false;
+    for(Int y = 0; y != 16; ++y) for(Int x = 0; x != 16; ++x) {
+        const Vector2 point = Vector2{-3.5f} + Vector2(x, y);
+        const Vector2 outside = Math::max(-point, point - Vector2{8.0f});
+        const Float distance = -Math::max(outside.x(), outside.y());
+        const UnsignedByte expected = UnsignedByte(Math::round(Math::clamp(distance/8.0f + 0.5f, 0.0f, 1.0f)*255.0f));
+
+        const UnsignedByte* const pixel = output.data<UnsignedByte>() + y*48 + x*3;
+        CORRADE_COMPARE(Int(median(pixel)), Int(expected));
+        if(pixel[0] != pixel[1] || pixel[1] != pixel[2]) differentChannels = true;
+    }
+
+    /* Outside of the corners each channel sees different edges */
+    CORRADE_VERIFY(differentChannels);
+}
+
+void DistanceFieldTest::multichannelSmooth() {
+    /* Rounded contour without corners, all channels are the same */
+    const std::vector<std::vector<QuadraticBezier2D>> contours{{
+        QuadraticBezier2D{Vector2{4.0f, 0.0f}, Vector2{4.0f, -4.0f}, Vector2{0.0f, -4.0f}},
+        QuadraticBezier2D{Vector2{0.0f, -4.0f}, Vector2{-4.0f, -4.0f}, Vector2{-4.0f, 0.0f}},
+        QuadraticBezier2D{Vector2{-4.0f, 0.0f}, Vector2{-4.0f, 4.0f}, Vector2{0.0f, 4.0f}},
+        QuadraticBezier2D{Vector2{0.0f, 4.0f}, Vector2{4.0f, 4.0f}, Vector2{4.0f, 0.0f}}
+    }};
+
+    Image2D output = multichannelDistanceField(contours, {{-6.0f, -6.0f}, {6.0f, 6.0f}}, {12, 12}, 2.0f);
+    for(Int i = 0; i != 12*12; ++i) {
+        const UnsignedByte* const pixel = output.data<UnsignedByte>() + (i/12)*36 + (i%12)*3;
+        CORRADE_COMPARE(Int(pixel[0]), Int(pixel[1]));
+        CORRADE_COMPARE(Int(pixel[1]), Int(pixel[2]));
+    }
+
+    /* Center is inside and corners outside, both farther than the radius */
+    CORRADE_COMPARE(Int(output.data<UnsignedByte>()[5*36 + 5*3]), 255);
+    CORRADE_COMPARE(Int(output.data<UnsignedByte>()[0]), 0);
+    CORRADE_COMPARE(Int(output.data<UnsignedByte>()[11*36 + 11*3]), 0);
+}
+
+void DistanceFieldTest::multichannelOrientation() {
+    /* Counterclockwise contour is a hole, so the distances are inverted */
+    std::vector<std::vector<QuadraticBezier2D>> hole{{}};
+    for(auto it = Square[0].rbegin(); it != Square[0].rend(); ++it)
+        hole[0].push_back(QuadraticBezier2D{(*it)[2], (*it)[1], (*it)[0]});
+
+    Image2D square = multichannelDistanceField(Square, {{-4.0f, -4.0f}, {12.0f, 12.0f}}, {16, 16}, 4.0f);
+    Image2D inverted = multichannelDistanceField(hole, {{-4.0f, -4.0f}, {12.0f, 12.0f}}, {16, 16}, 4.0f);
+    for(Int y = 0; y != 16; ++y) for(Int x = 0; x != 16; ++x) {
+        const Int i = y*48 + x*3;
+        CORRADE_COMPARE(Int(median(inverted.data<UnsignedByte>() + i)), 255 - Int(median(square.data<UnsignedByte>() + i)));
+    }
+}
+
+void DistanceFieldTest::multichannelEmpty() {
+    /* Nothing inside, everything is at max distance. Output row length 6 is
+       padded to 8 bytes. */
+    Image2D output = multichannelDistanceField({}, {{}, {1.0f, 1.0f}}, {2, 3}, 1.0f);
+    CORRADE_COMPARE(output.size(), Vector2i(2, 3));
+    CORRADE_COMPARE(output.data().size(), 8*3);
+    for(std::size_t i = 0; i != output.data().size(); ++i)
+        CORRADE_COMPARE(Int(output.data<UnsignedByte>()[i]), 0);
+}
+
+void DistanceFieldTest::multichannelThreads() {
+    Image2D single = multichannelDistanceField(Square, {{-2.0f, -2.0f}, {10.0f, 10.0f}}, {24, 24}, 2.0f, 1);
+    Image2D multiple = multichannelDistanceField(Square, {{-2.0f, -2.0f}, {10.0f, 10.0f}}, {24, 24}, 2.0f, 7);
+    CORRADE_COMPARE(std::string(multiple.data(), multiple.data().size()),
+                    std::string(single.data(), single.data().size()));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::DistanceFieldTest)
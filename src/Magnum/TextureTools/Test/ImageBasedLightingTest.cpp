@@ -0,0 +1,194 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/TextureTools/ImageBasedLighting.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+struct ImageBasedLightingTest: TestSuite::Tester {
+    explicit ImageBasedLightingTest();
+
+    void projectConstant();
+    void projectDirectional();
+    void projectPixelStorage();
+    void evaluate();
+
+    void serialize();
+    void serializeInvalid();
+    void deserializeInvalid();
+};
+
+ImageBasedLightingTest::ImageBasedLightingTest() {
+    addTests({&ImageBasedLightingTest::projectConstant,
+              &ImageBasedLightingTest::projectDirectional,
+              &ImageBasedLightingTest::projectPixelStorage,
+              &ImageBasedLightingTest::evaluate,
+
+              &ImageBasedLightingTest::serialize,
+              &ImageBasedLightingTest::serializeInvalid,
+              &ImageBasedLightingTest::deserializeInvalid});
+}
+
+void ImageBasedLightingTest::projectConstant() {
+    std::vector<Color3> data(16*16*6, Color3{0.5f, 1.0f, 2.0f});
+    const IrradianceCoefficients coefficients = irradianceSphericalHarmonics(ImageView3D{PixelFormat::RGB, PixelType::Float, {16, 16, 6}, {data.data(), data.size()*sizeof(Color3)}});
+
+    /* Only the constant band should be non-zero, the texel solid angles sum
+       up to the full sphere */
+    CORRADE_COMPARE(coefficients[0], (Color3{0.5f, 1.0f, 2.0f})*0.282095f*4.0f*Constants::pi());
+    for(std::size_t i = 1; i != 9; ++i)
+        CORRADE_COMPARE(coefficients[i], Color3{});
+
+    /* Uniform environment results in pi times the radiance everywhere */
+    CORRADE_COMPARE(sphericalHarmonicsIrradiance(coefficients, Vector3::zAxis()), (Color3{0.5f, 1.0f, 2.0f})*Constants::pi());
+    CORRADE_COMPARE(sphericalHarmonicsIrradiance(coefficients, Vector3{1.0f, -1.0f, 1.0f}.normalized()), (Color3{0.5f, 1.0f, 2.0f})*Constants::pi());
+}
+
+void ImageBasedLightingTest::projectDirectional() {
+    /* Only the positive Y face is lit */
+    std::vector<Color3> data(16*16*6);
+    for(std::size_t i = 16*16*2; i != 16*16*3; ++i) data[i] = Color3{1.0f};
+    const IrradianceCoefficients coefficients = irradianceSphericalHarmonics(ImageView3D{PixelFormat::RGB, PixelType::Float, {16, 16, 6}, {data.data(), data.size()*sizeof(Color3)}});
+
+    /* Symmetric around Y, so the X and Z bands are zero */
+    CORRADE_COMPARE(coefficients[3], Color3{});
+    CORRADE_COMPARE(coefficients[2], Color3{});
+    CORRADE_VERIFY(coefficients[1].r() > 0.0f);
+
+    const Color3 up = sphericalHarmonicsIrradiance(coefficients, Vector3::yAxis());
+    const Color3 side = sphericalHarmonicsIrradiance(coefficients, Vector3::xAxis());
+    const Color3 down = sphericalHarmonicsIrradiance(coefficients, -Vector3::yAxis());
+    CORRADE_VERIFY(up.r() > side.r());
+    CORRADE_VERIFY(side.r() > down.r());
+    CORRADE_COMPARE(sphericalHarmonicsIrradiance(coefficients, Vector3::zAxis()), side);
+}
+
+void ImageBasedLightingTest::projectPixelStorage() {
+    /* RGBA input with skipped first slice should give the same result as
+       tightly packed RGB */
+    std::vector<Color4> data(4*4*7, Color4{1.0f, 0.0f, 0.0f, 0.0f});
+    for(std::size_t i = 4*4*3; i != 4*4*4; ++i) data[i] = Color4{0.0f, 0.0f, 1.0f, 0.0f};
+    std::vector<Color3> packed(4*4*6, Color3{1.0f, 0.0f, 0.0f});
+    for(std::size_t i = 4*4*2; i != 4*4*3; ++i) packed[i] = Color3{0.0f, 0.0f, 1.0f};
+
+    const IrradianceCoefficients a = irradianceSphericalHarmonics(ImageView3D{PixelStorage{}.setSkip({0, 0, 1}), PixelFormat::RGBA, PixelType::Float, {4, 4, 6}, {data.data(), data.size()*sizeof(Color4)}});
+    const IrradianceCoefficients b = irradianceSphericalHarmonics(ImageView3D{PixelFormat::RGB, PixelType::Float, {4, 4, 6}, {packed.data(), packed.size()*sizeof(Color3)}});
+    for(std::size_t i = 0; i != 9; ++i) CORRADE_COMPARE(a[i], b[i]);
+}
+
+void ImageBasedLightingTest::evaluate() {
+    IrradianceCoefficients coefficients{};
+    coefficients[2] = Color3{1.0f};
+
+    /* Linear band along Z is scaled by 2pi/3 */
+    CORRADE_COMPARE(sphericalHarmonicsIrradiance(coefficients, Vector3::zAxis()), Color3{0.488603f*2.0f*Constants::pi()/3.0f});
+    CORRADE_COMPARE(sphericalHarmonicsIrradiance(coefficients, -Vector3::zAxis()), Color3{-0.488603f*2.0f*Constants::pi()/3.0f});
+    CORRADE_COMPARE(sphericalHarmonicsIrradiance(coefficients, Vector3::xAxis()), Color3{});
+}
+
+namespace {
+    std::vector<Image3D> specularLevels(const Int size, const Int count) {
+        std::vector<Image3D> levels;
+        for(Int i = 0; i != count; ++i) {
+            const Int levelSize = Math::max(size >> i, 1);
+            Containers::Array<char> data{Containers::ValueInit, std::size_t(levelSize*levelSize*6*4*2)};
+            UnsignedShort* halfs = reinterpret_cast<UnsignedShort*>(data.data());
+            for(std::size_t j = 0; j != data.size()/2; ++j)
+                halfs[j] = Math::packHalf(Float(i) + Float(j%7)*0.25f);
+            levels.emplace_back(PixelFormat::RGBA, PixelType::HalfFloat, Vector3i{levelSize, levelSize, 6}, std::move(data));
+        }
+        return levels;
+    }
+}
+
+void ImageBasedLightingTest::serialize() {
+    IrradianceCoefficients irradiance;
+    for(std::size_t i = 0; i != 9; ++i) irradiance[i] = Color3{Float(i), 0.5f, -Float(i)};
+    const std::vector<Image3D> levels = specularLevels(4, 3);
+
+    const Containers::Array<char> data = serializeImageBasedLighting(irradiance, levels);
+    CORRADE_VERIFY(data);
+
+    IrradianceCoefficients outIrradiance{};
+    std::vector<Image3D> outLevels;
+    CORRADE_VERIFY(deserializeImageBasedLighting(data, outIrradiance, outLevels));
+    for(std::size_t i = 0; i != 9; ++i) CORRADE_COMPARE(outIrradiance[i], irradiance[i]);
+
+    CORRADE_COMPARE(outLevels.size(), 3);
+    for(std::size_t i = 0; i != 3; ++i) {
+        CORRADE_COMPARE(outLevels[i].format(), PixelFormat::RGBA);
+        CORRADE_COMPARE(outLevels[i].type(), PixelType::HalfFloat);
+        CORRADE_COMPARE(outLevels[i].size(), levels[i].size());
+        CORRADE_COMPARE(outLevels[i].data().size(), levels[i].data().size());
+        CORRADE_VERIFY(std::equal(levels[i].data().begin(), levels[i].data().end(), outLevels[i].data().begin()));
+    }
+}
+
+void ImageBasedLightingTest::serializeInvalid() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    CORRADE_VERIFY(!serializeImageBasedLighting({}, {}));
+
+    /* Second level doesn't have half the size */
+    std::vector<Image3D> levels = specularLevels(4, 1);
+    levels.push_back(std::move(specularLevels(4, 1).front()));
+    CORRADE_VERIFY(!serializeImageBasedLighting({}, levels));
+
+    CORRADE_COMPARE(out.str(),
+        "TextureTools::serializeImageBasedLighting(): no specular levels\n"
+        "TextureTools::serializeImageBasedLighting(): expected RGBA half-float level 1 of size Vector(2, 2, 6) but got PixelFormat::RGBA PixelType::HalfFloat Vector(4, 4, 6)\n");
+}
+
+void ImageBasedLightingTest::deserializeInvalid() {
+    const Containers::Array<char> data = serializeImageBasedLighting({}, specularLevels(2, 2));
+    CORRADE_VERIFY(data);
+
+    IrradianceCoefficients irradiance{};
+    std::vector<Image3D> levels;
+
+    /* Truncated */
+    CORRADE_VERIFY(!deserializeImageBasedLighting(data.prefix(data.size() - 1), irradiance, levels));
+    CORRADE_VERIFY(!deserializeImageBasedLighting(data.prefix(8), irradiance, levels));
+
+    /* Wrong magic */
+    Containers::Array<char> copy{Containers::NoInit, data.size()};
+    std::copy(data.begin(), data.end(), copy.begin());
+    copy[0] = 'X';
+    CORRADE_VERIFY(!deserializeImageBasedLighting(copy, irradiance, levels));
+
+    /* Outputs are untouched */
+    CORRADE_VERIFY(levels.empty());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::ImageBasedLightingTest)
@@ -0,0 +1,201 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/TextureTools/Resample.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+struct ResampleTest: TestSuite::Tester {
+    explicit ResampleTest();
+
+    void mipLevelCount();
+
+    void box();
+    void boxOddSize();
+    void constant();
+    void upsample();
+    void srgb();
+    void pixelStorage();
+    void unsignedShort();
+    void threads();
+
+    void mipmaps();
+    void mipmapsNonSquare();
+};
+
+ResampleTest::ResampleTest() {
+    addTests({&ResampleTest::mipLevelCount,
+
+              &ResampleTest::box,
+              &ResampleTest::boxOddSize,
+              &ResampleTest::constant,
+              &ResampleTest::upsample,
+              &ResampleTest::srgb,
+              &ResampleTest::pixelStorage,
+              &ResampleTest::unsignedShort,
+              &ResampleTest::threads,
+
+              &ResampleTest::mipmaps,
+              &ResampleTest::mipmapsNonSquare});
+}
+
+void ResampleTest::mipLevelCount() {
+    CORRADE_COMPARE(TextureTools::mipLevelCount({256, 128}), 9);
+    CORRADE_COMPARE(TextureTools::mipLevelCount({5, 3}), 3);
+    CORRADE_COMPARE(TextureTools::mipLevelCount({1, 1}), 1);
+}
+
+void ResampleTest::box() {
+    const Float data[]{0.0f, 1.0f,
+                       0.5f, 0.5f};
+    const Image2D out = resample(ImageView2D{PixelFormat::Red, PixelType::Float, {2, 2}, data}, {1, 1}, ResampleFilter::Box);
+
+    CORRADE_COMPARE(out.format(), PixelFormat::Red);
+    CORRADE_COMPARE(out.type(), PixelType::Float);
+    CORRADE_COMPARE(out.size(), (Vector2i{1, 1}));
+    CORRADE_COMPARE(out.data<Float>()[0], 0.5f);
+}
+
+void ResampleTest::boxOddSize() {
+    /* Each output pixel covers one and a half of input pixels */
+    const Float data[]{0.0f, 0.3f, 0.6f};
+    const Image2D out = resample(ImageView2D{PixelFormat::Red, PixelType::Float, {3, 1}, data}, {2, 1}, ResampleFilter::Box);
+
+    CORRADE_COMPARE(out.data<Float>()[0], 0.1f);
+    CORRADE_COMPARE(out.data<Float>()[1], 0.5f);
+}
+
+void ResampleTest::constant() {
+    /* All filters are normalized, so a constant image stays constant */
+    std::vector<Float> data(7*5*4, 0.25f);
+    const ImageView2D image{PixelFormat::RGBA, PixelType::Float, {7, 5}, Containers::arrayView(data.data(), data.size())};
+
+    for(ResampleFilter filter: {ResampleFilter::Box, ResampleFilter::Kaiser, ResampleFilter::Lanczos}) {
+        const Image2D out = resample(image, {3, 2}, filter);
+        for(std::size_t i = 0; i != 3*2*4; ++i)
+            CORRADE_COMPARE(out.data<Float>()[i], 0.25f);
+    }
+}
+
+void ResampleTest::upsample() {
+    const Float data[]{0.0f, 1.0f};
+    const Image2D out = resample(ImageView2D{PixelFormat::Red, PixelType::Float, {2, 1}, data}, {4, 1}, ResampleFilter::Lanczos);
+
+    /* Edges clamped, the middle interpolated symmetrically */
+    CORRADE_VERIFY(out.data<Float>()[0] < 0.1f);
+    CORRADE_VERIFY(out.data<Float>()[3] > 0.9f);
+    CORRADE_COMPARE(out.data<Float>()[1] + out.data<Float>()[2], 1.0f);
+    CORRADE_VERIFY(out.data<Float>()[1] < out.data<Float>()[2]);
+}
+
+void ResampleTest::srgb() {
+    /* Black and white pixel, rows padded to four bytes */
+    const char data[]{0, 0, 0, char(255), char(255), char(255), 0, 0};
+    const ImageView2D image{PixelFormat::RGB, PixelType::UnsignedByte, {2, 1}, data};
+
+    /* Average in linear space is 0.5, which is 188 in sRGB */
+    const Image2D linear = resample(image, {1, 1}, ResampleFilter::Box);
+    const Image2D srgb = resample(image, {1, 1}, ResampleFilter::Box, ResampleFlag::Srgb);
+    CORRADE_COMPARE(UnsignedByte(linear.data()[0]), 128);
+    CORRADE_COMPARE(UnsignedByte(srgb.data()[0]), 188);
+    CORRADE_COMPARE(UnsignedByte(srgb.data()[2]), 188);
+}
+
+void ResampleTest::pixelStorage() {
+    /* Skipping first row and first pixel of each row, no padding */
+    const char data[]{
+        9, 9, 9,
+        9, 10, 20,
+        9, 30, 40};
+    const ImageView2D image{PixelStorage{}.setAlignment(1).setSkip({1, 1, 0}).setRowLength(3),
+        PixelFormat::Red, PixelType::UnsignedByte, {2, 2}, data};
+
+    const Image2D out = resample(image, {1, 1}, ResampleFilter::Box);
+    CORRADE_COMPARE(out.storage().alignment(), 4);
+    CORRADE_COMPARE(UnsignedByte(out.data()[0]), 25);
+}
+
+void ResampleTest::unsignedShort() {
+    const UnsignedShort data[]{0, 65535};
+    const Image2D out = resample(ImageView2D{PixelFormat::Red, PixelType::UnsignedShort, {2, 1}, data}, {1, 1}, ResampleFilter::Box);
+
+    CORRADE_COMPARE(out.type(), PixelType::UnsignedShort);
+    CORRADE_COMPARE(out.data<UnsignedShort>()[0], 32768);
+}
+
+void ResampleTest::threads() {
+    std::vector<Float> data(64*64*2);
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = Float((i*7919)%101)/100.0f;
+    const ImageView2D image{PixelFormat::RG, PixelType::Float, {64, 64}, Containers::arrayView(data.data(), data.size())};
+
+    const Image2D single = resample(image, {41, 23}, ResampleFilter::Kaiser, {}, 1);
+    const Image2D multi = resample(image, {41, 23}, ResampleFilter::Kaiser, {}, 4);
+    CORRADE_COMPARE_AS(multi.data(), single.data(), TestSuite::Compare::Container);
+}
+
+void ResampleTest::mipmaps() {
+    /* 4x4 with 2x2 blocks of the same value */
+    const Float data[]{
+        0.0f, 0.0f, 1.0f, 1.0f,
+        0.0f, 0.0f, 1.0f, 1.0f,
+        0.5f, 0.5f, 0.25f, 0.25f,
+        0.5f, 0.5f, 0.25f, 0.25f};
+    const std::vector<Image2D> levels = generateMipmaps(ImageView2D{PixelFormat::Red, PixelType::Float, {4, 4}, data});
+
+    CORRADE_COMPARE(levels.size(), 3);
+    CORRADE_COMPARE(levels[0].size(), (Vector2i{4, 4}));
+    CORRADE_COMPARE(levels[1].size(), (Vector2i{2, 2}));
+    CORRADE_COMPARE(levels[2].size(), (Vector2i{1, 1}));
+
+    CORRADE_COMPARE(levels[0].data<Float>()[6], 1.0f);
+    CORRADE_COMPARE(levels[1].data<Float>()[0], 0.0f);
+    CORRADE_COMPARE(levels[1].data<Float>()[1], 1.0f);
+    CORRADE_COMPARE(levels[1].data<Float>()[2], 0.5f);
+    CORRADE_COMPARE(levels[1].data<Float>()[3], 0.25f);
+    CORRADE_COMPARE(levels[2].data<Float>()[0], 0.4375f);
+}
+
+void ResampleTest::mipmapsNonSquare() {
+    std::vector<char> data(16*4*4, char(200));
+    const std::vector<Image2D> levels = generateMipmaps(ImageView2D{PixelFormat::RGBA, PixelType::UnsignedByte, {16, 4}, Containers::arrayView(data.data(), data.size())}, ResampleFilter::Kaiser, ResampleFlag::Srgb);
+
+    CORRADE_COMPARE(levels.size(), 5);
+    CORRADE_COMPARE(levels[2].size(), (Vector2i{4, 1}));
+    CORRADE_COMPARE(levels[3].size(), (Vector2i{2, 1}));
+    CORRADE_COMPARE(levels[4].size(), (Vector2i{1, 1}));
+    for(const Image2D& level: levels) {
+        CORRADE_COMPARE(level.format(), PixelFormat::RGBA);
+        CORRADE_COMPARE(UnsignedByte(level.data()[0]), 200);
+        CORRADE_COMPARE(UnsignedByte(level.data()[3]), 200);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::ResampleTest)
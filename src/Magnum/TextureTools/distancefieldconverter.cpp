@@ -71,7 +71,7 @@ namespace Magnum {
 
 @section magnum-distancefieldconverter-usage Usage
 
-    magnum-distancefieldconverter [--magnum-...] [-h|--help] [--importer IMPORTER] [--converter CONVERTER] [--plugin-dir DIR] --output-size "X Y" --radius N [--] input output
+    magnum-distancefieldconverter [--magnum-...] [-h|--help] [--importer IMPORTER] [--converter CONVERTER] [--plugin-dir DIR] [--cpu] [--threads N] --output-size "X Y" --radius N [--] input output
 
 Arguments:
 
@@ -82,12 +82,17 @@ Arguments:
 -   `--converter CONVERTER` -- image converter plugin (default: @ref Trade::AnyImageConverter "AnyImageConverter")
 -   `--plugin-dir DIR` -- base plugin dir (defaults to plugin directory in
     Magnum install location)
+-   `--cpu` -- compute the distance field on the CPU, without creating a GL
+    context
+-   `--threads N` -- count of threads to use with `--cpu` (default: `0`,
+    which means all available cores)
 -   `--output-size "X Y"` -- size of output image
 -   `--radius N` -- distance field computation radius
 -   `--magnum-...` -- engine-specific options (see @ref Context for details)
 
 Images with @ref PixelFormat::Red, @ref PixelFormat::RGB or @ref PixelFormat::RGBA
-are accepted on input.
+are accepted on input. With `--cpu`, the input additionally has to have
+@ref PixelType::UnsignedByte.
 
 The resulting image can be then used with @ref Shaders::DistanceFieldVector
 shader. See also @ref TextureTools::distanceField() for more information about
@@ -99,7 +104,10 @@ the algorithm and parameters.
 
 This will open monochrome `logo-src.png` image using any plugin that can open
 PNG files and converts it to 256x256 distance field `logo.png` using any plugin
-that can write PNG files.
+that can write PNG files. On a headless build server without GPU, the
+conversion can be done on the CPU instead:
+
+    magnum-distancefieldconverter --cpu --output-size "256 256" --radius 24 logo-src.png logo.png
 
 */
 
@@ -121,13 +129,15 @@ DistanceFieldConverter::DistanceFieldConverter(const Arguments& arguments): Plat
         .addOption("importer", "AnyImageImporter").setHelp("importer", "image importer plugin")
         .addOption("converter", "AnyImageConverter").setHelp("converter", "image converter plugin")
         .addOption("plugin-dir", Utility::Directory::join(Utility::Directory::path(Utility::Directory::executableLocation()), MAGNUM_PLUGINS_DIR)).setHelp("plugin-dir", "base plugin dir", "DIR")
+        .addBooleanOption("cpu").setHelp("cpu", "compute the distance field on the CPU, without creating a GL context")
+        .addOption("threads", "0").setHelp("threads", "count of threads to use with --cpu, 0 for all available cores", "N")
         .addNamedArgument("output-size").setHelp("output-size", "size of output image", "\"X Y\"")
         .addNamedArgument("radius").setHelp("radius", "distance field computation radius", "N")
         .addSkippedPrefix("magnum", "engine-specific options")
         .setHelp("Converts red channel of an image to distance field representation.")
         .parse(arguments.argc, arguments.argv);
 
-    createContext();
+    if(!args.isSet("cpu")) createContext();
 }
 
 int DistanceFieldConverter::exec() {
@@ -150,6 +160,23 @@ int DistanceFieldConverter::exec() {
         return 1;
     }
 
+    /* Compute on the CPU, if requested */
+    if(args.isSet("cpu")) {
+        if(image->type() != PixelType::UnsignedByte) {
+            Error() << "Unsupported image type" << image->type();
+            return 1;
+        }
+
+        Debug() << "Converting image of size" << image->size() << "to distance field on the CPU...";
+        Image2D result = TextureTools::distanceField(*image, args.value<Vector2i>("output-size"), args.value<Int>("radius"), args.value<UnsignedInt>("threads"));
+        if(!converter->exportToFile(result, args.value("output"))) {
+            Error() << "Cannot save file" << args.value("output");
+            return 1;
+        }
+
+        return 0;
+    }
+
     /* Decide about internal format */
     TextureFormat internalFormat;
     if(image->format() == PixelFormat::Red) internalFormat = TextureFormat::R8;
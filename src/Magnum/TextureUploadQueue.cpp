@@ -0,0 +1,118 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "TextureUploadQueue.h"
+
+#include <cstring>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/PixelFormat.h"
+
+namespace Magnum {
+
+template<UnsignedInt dimensions> TextureUploadQueue<dimensions>::TextureUploadQueue(const UnsignedInt bufferCount): _capacities(bufferCount),
+    #ifndef MAGNUM_TARGET_WEBGL
+    _fences(bufferCount),
+    #ifndef MAGNUM_TARGET_GLES
+    _sync{Context::current().isExtensionSupported<Extensions::GL::ARB::sync>()},
+    #else
+    _sync{true},
+    #endif
+    #endif
+    _current{bufferCount - 1}, _waitCount{}
+{
+    CORRADE_ASSERT(bufferCount, "TextureUploadQueue: expected non-zero buffer count", );
+
+    /* The actual format is set on every upload */
+    _images.reserve(bufferCount);
+    for(UnsignedInt i = 0; i != bufferCount; ++i)
+        _images.emplace_back(PixelFormat::RGBA, PixelType::UnsignedByte);
+}
+
+template<UnsignedInt dimensions> TextureUploadQueue<dimensions>::~TextureUploadQueue() {
+    #ifndef MAGNUM_TARGET_WEBGL
+    for(GLsync fence: _fences) if(fence) glDeleteSync(fence);
+    #endif
+}
+
+template<UnsignedInt dimensions> BufferImage<dimensions>& TextureUploadQueue<dimensions>::stage(const ImageView<dimensions>& image) {
+    _current = (_current + 1) % _images.size();
+    BufferImage<dimensions>& bufferImage = _images[_current];
+    std::size_t& capacity = _capacities[_current];
+    const std::size_t size = image.data().size();
+
+    #ifndef MAGNUM_TARGET_WEBGL
+    bool unsynchronized = false;
+    GLsync& fence = _fences[_current];
+    if(fence) {
+        /* Check without flushing first to find out if we need to wait at
+           all, then wait with flush so the fence gets signaled eventually */
+        GLenum result = glClientWaitSync(fence, 0, 0);
+        if(result == GL_TIMEOUT_EXPIRED) {
+            ++_waitCount;
+            do result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+            while(result == GL_TIMEOUT_EXPIRED);
+        }
+
+        glDeleteSync(fence);
+        fence = nullptr;
+        unsynchronized = true;
+    }
+
+    /* Grow the storage if it's too small, otherwise keep it */
+    if(capacity < size) {
+        bufferImage.setData(image.storage(), image.format(), image.type(), image.size(), {nullptr, size}, BufferUsage::StreamDraw);
+        capacity = size;
+    } else bufferImage.setData(image.storage(), image.format(), image.type(), image.size(), {nullptr, 0}, BufferUsage::StreamDraw);
+
+    /* If the GL is done with the buffer, no need to synchronize, otherwise
+       let the driver orphan the old storage */
+    char* const data = bufferImage.buffer().template map<char>(0, size, Buffer::MapFlag::Write|(unsynchronized ? Buffer::MapFlag::Unsynchronized : Buffer::MapFlag::InvalidateBuffer));
+    CORRADE_INTERNAL_ASSERT(data);
+    std::memcpy(data, image.data().data(), size);
+    CORRADE_INTERNAL_ASSERT_OUTPUT(bufferImage.buffer().unmap());
+    #else
+    bufferImage.setData(image.storage(), image.format(), image.type(), image.size(), image.data(), BufferUsage::StreamDraw);
+    capacity = size;
+    #endif
+
+    return bufferImage;
+}
+
+template<UnsignedInt dimensions> void TextureUploadQueue<dimensions>::fence() {
+    #ifndef MAGNUM_TARGET_WEBGL
+    if(_sync) _fences[_current] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    #endif
+}
+
+#ifndef MAGNUM_TARGET_GLES
+template class MAGNUM_EXPORT TextureUploadQueue<1>;
+#endif
+template class MAGNUM_EXPORT TextureUploadQueue<2>;
+template class MAGNUM_EXPORT TextureUploadQueue<3>;
+
+}
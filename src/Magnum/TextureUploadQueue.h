@@ -0,0 +1,193 @@
+#ifndef Magnum_TextureUploadQueue_h
+#define Magnum_TextureUploadQueue_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::TextureUploadQueue, typedef @ref Magnum::TextureUploadQueue1D, @ref Magnum::TextureUploadQueue2D, @ref Magnum::TextureUploadQueue3D
+ */
+#endif
+
+#include <vector>
+
+#include "Magnum/BufferImage.h"
+#include "Magnum/ImageView.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum {
+
+/**
+@brief Asynchronous texture upload queue
+
+Uploading image data from client memory with e.g.
+@ref Texture::setSubImage(Int, const VectorTypeFor<dimensions, Int>&, const ImageView<dimensions>&)
+makes the driver copy and convert the data before the function returns, which
+for large images blocks the application for a significant time. This class
+instead copies the data into one of a pool of @ref BufferImage staging
+buffers and uploads the texture from there, so the transfer is done
+asynchronously by the GL.
+
+## Usage
+
+The queue works with any texture type that has a
+@ref Texture::setSubImage(Int, const VectorTypeFor<dimensions, Int>&, BufferImage<dimensions>&) "setSubImage()"
+overload taking a @ref BufferImage of matching dimension count, for example
+@ref Texture2D, @ref Texture1DArray, @ref RectangleTexture and the 3D
+variants with @ref TextureUploadQueue3D:
+@code
+Texture2D texture;
+texture.setStorage(1, TextureFormat::RGBA8, {4096, 4096});
+
+TextureUploadQueue2D queue;
+
+// for each tile streamed from disk
+queue.upload(texture, 0, tileOffset, ImageView2D{PixelFormat::RGBA, PixelType::UnsignedByte, tileSize, tileData});
+@endcode
+
+The client memory can be reused or freed right after @ref upload() returns.
+
+@anchor TextureUploadQueue-performance-optimization
+## Performance optimizations
+
+The staging buffers are used in a round-robin fashion and grow to fit the
+largest image uploaded through them, so after a few uploads no further
+allocations are done. If @extension{ARB,sync} (part of OpenGL 3.2) is
+available (fences are always available in OpenGL ES 3.0), a fence is placed after each upload and the buffer is reused only
+after the GL signals the fence. @ref upload() waits on the fence only if the
+GL didn't finish the transfer yet. Count of such waits is available through
+@ref waitCount(), if it's not zero, the queue needs more staging buffers.
+Since the fence guarantees the GL is done with the buffer, it's mapped with
+@ref Buffer::MapFlag::Unsynchronized. Otherwise the buffer is mapped with
+@ref Buffer::MapFlag::InvalidateBuffer so the driver can allocate a new storage
+instead of waiting for the GPU. In WebGL, where mapping is not available, the
+data are copied into the buffer using @ref Buffer::setData() and no fences
+are used.
+
+@see @ref TextureUploadQueue1D, @ref TextureUploadQueue2D,
+    @ref TextureUploadQueue3D, @ref BufferRing
+@requires_gles30 Pixel buffer objects are not available in OpenGL ES 2.0.
+@requires_webgl20 Pixel buffer objects are not available in WebGL 1.0.
+*/
+template<UnsignedInt dimensions> class TextureUploadQueue {
+    public:
+        enum: UnsignedInt {
+            Dimensions = dimensions /**< Image dimension count */
+        };
+
+        /**
+         * @brief Constructor
+         * @param bufferCount   Staging buffer count. Should be at least the
+         *      count of uploads the GL is allowed to lag behind the
+         *      application.
+         *
+         * The staging buffers are allocated on first use.
+         */
+        explicit TextureUploadQueue(UnsignedInt bufferCount = 3);
+
+        /** @brief Copying is not allowed */
+        TextureUploadQueue(const TextureUploadQueue<dimensions>&) = delete;
+
+        /** @brief Moving is not allowed */
+        TextureUploadQueue(TextureUploadQueue<dimensions>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Deletes all pending fences.
+         * @see @fn_gl{DeleteSync}
+         */
+        ~TextureUploadQueue();
+
+        /** @brief Copying is not allowed */
+        TextureUploadQueue<dimensions>& operator=(const TextureUploadQueue<dimensions>&) = delete;
+
+        /** @brief Moving is not allowed */
+        TextureUploadQueue<dimensions>& operator=(TextureUploadQueue<dimensions>&&) = delete;
+
+        /** @brief Staging buffer count */
+        UnsignedInt bufferCount() const { return _images.size(); }
+
+        /**
+         * @brief Upload image to a texture
+         * @param texture   Texture
+         * @param level     Mip level
+         * @param offset    Offset where to put data in the texture
+         * @param image     Image
+         * @return Reference to self (for method chaining)
+         *
+         * Copies the image data into next staging buffer and calls
+         * `texture.setSubImage(level, offset, buffer)`. See
+         * @ref TextureUploadQueue-performance-optimization "class documentation"
+         * for more information.
+         * @see @fn_gl{FenceSync}, @fn_gl{ClientWaitSync}, @fn_gl{DeleteSync},
+         *      @ref Buffer::map(GLintptr, GLsizeiptr, Buffer::MapFlags)
+         */
+        template<class T> TextureUploadQueue<dimensions>& upload(T& texture, Int level, const VectorTypeFor<dimensions, Int>& offset, const ImageView<dimensions>& image) {
+            texture.setSubImage(level, offset, stage(image));
+            fence();
+            return *this;
+        }
+
+        /**
+         * @brief Count of waits for the GL
+         *
+         * Count of times @ref upload() had to block because the GL didn't
+         * finish the transfer from the staging buffer yet. Always `0` if
+         * @extension{ARB,sync} is not available and in WebGL.
+         */
+        UnsignedInt waitCount() const { return _waitCount; }
+
+    private:
+        BufferImage<dimensions>& stage(const ImageView<dimensions>& image);
+        void fence();
+
+        std::vector<BufferImage<dimensions>> _images;
+        std::vector<std::size_t> _capacities;
+        #ifndef MAGNUM_TARGET_WEBGL
+        std::vector<GLsync> _fences;
+        bool _sync;
+        #endif
+        UnsignedInt _current,
+            _waitCount;
+};
+
+/** @brief One-dimensional texture upload queue */
+#ifndef MAGNUM_TARGET_GLES
+typedef TextureUploadQueue<1> TextureUploadQueue1D;
+#endif
+
+/** @brief Two-dimensional texture upload queue */
+typedef TextureUploadQueue<2> TextureUploadQueue2D;
+
+/** @brief Three-dimensional texture upload queue */
+typedef TextureUploadQueue<3> TextureUploadQueue3D;
+
+}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
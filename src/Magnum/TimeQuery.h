@@ -73,7 +73,7 @@ Using the latter results in fewer OpenGL calls when doing more measures.
 @requires_es_extension Extension @es_extension{EXT,disjoint_timer_query}
 @requires_gles Time query is not available in WebGL.
 
-@see @ref PrimitiveQuery, @ref SampleQuery
+@see @ref PrimitiveQuery, @ref SampleQuery, @ref QueryPool
 @todo timestamp with glGet + example usage
 @todo @es_extension{EXT,disjoint_timer_query} -- GL_GPU_DISJOINT_EXT support? where?
 */
@@ -25,10 +25,13 @@
 
 #include "Timeline.h"
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
 #include <Corrade/Utility/Debug.h>
 #include <Corrade/Utility/System.h>
 
-#include "Magnum/Magnum.h"
+#include "Magnum/FrameAllocator.h"
 
 using namespace std::chrono;
 
@@ -39,6 +42,9 @@ void Timeline::start() {
     _startTime = high_resolution_clock::now();
     _previousFrameTime = _startTime;
     _previousFrameDuration = 0;
+    _currentFrame = 0;
+    _frameCount = 0;
+    _hitchCount = 0;
 }
 
 void Timeline::stop() {
@@ -49,6 +55,8 @@ void Timeline::stop() {
 }
 
 void Timeline::nextFrame() {
+    if(_frameAllocator) _frameAllocator->reset();
+
     if(!running) return;
 
     auto now = high_resolution_clock::now();
@@ -64,6 +72,46 @@ void Timeline::nextFrame() {
     #endif
 
     _previousFrameTime = now;
+
+    if(_statisticsDuration) {
+        _frameDurations[_currentFrame] = _previousFrameDuration;
+        _currentFrame = (_currentFrame + 1) % _statisticsDuration;
+        if(_frameCount < _statisticsDuration) ++_frameCount;
+    }
+
+    if(_hitchThreshold != 0.0f && _previousFrameDuration > _hitchThreshold) {
+        ++_hitchCount;
+        if(_hitchCallback) _hitchCallback(_previousFrameDuration, _hitchCallbackState);
+    }
+}
+
+Timeline& Timeline::setStatisticsDuration(const std::size_t frames) {
+    _statisticsDuration = frames;
+    _frameDurations.assign(frames, 0.0f);
+    _currentFrame = 0;
+    _frameCount = 0;
+    return *this;
+}
+
+auto Timeline::statistics() const -> Statistics {
+    if(!_frameCount) return Statistics{0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+
+    /* Until the ring is full, only the first _frameCount items are valid */
+    std::vector<Float> durations{_frameDurations.begin(), _frameDurations.begin() + _frameCount};
+    std::sort(durations.begin(), durations.end());
+
+    auto percentile = [&durations](const Float p) {
+        const std::size_t rank = std::size_t(std::ceil(p*durations.size()));
+        return durations[rank ? rank - 1 : 0];
+    };
+
+    return Statistics{
+        durations.front(),
+        durations.back(),
+        std::accumulate(durations.begin(), durations.end(), 0.0f)/_frameCount,
+        percentile(0.50f),
+        percentile(0.95f),
+        percentile(0.99f)};
 }
 
 Float Timeline::previousFrameTime() const {
@@ -30,8 +30,9 @@
  */
 
 #include <chrono>
+#include <vector>
 
-#include "Magnum/Types.h"
+#include "Magnum/Magnum.h"
 #include "Magnum/visibility.h"
 
 #ifdef MAGNUM_BUILD_DEPRECATED
@@ -88,9 +89,64 @@ void MyApplication::drawEvent() {
     timeline.nextFrame();
 }
 @endcode
+
+## Frame time statistics
+
+Average frame time says little about smoothness of the animation, a single
+long frame is much more noticeable than a slightly slower framerate. Use
+@ref setStatisticsDuration() to keep a rolling window of frame durations and
+query its percentiles through @ref statistics():
+@code
+timeline.setStatisticsDuration(300);
+timeline.start();
+
+// ...
+
+Timeline::Statistics s = timeline.statistics();
+Debug() << "Frame time median" << s.median*1000.0f << "ms, 99th percentile"
+        << s.percentile99*1000.0f << "ms";
+@endcode
+
+## Hitch detection
+
+With @ref setHitchThreshold() each frame longer than given duration is counted
+as a *hitch* and optional callback set with @ref setHitchCallback() is called
+from @ref nextFrame(), for example to snapshot profiler state at the moment
+the spike happened:
+@code
+timeline.setHitchThreshold(1.0f/30.0f)
+    .setHitchCallback([](Float duration, void* state) {
+        Debug() << "Hitch:" << duration*1000.0f << "ms";
+        static_cast<DebugTools::Profiler*>(state)->printStatistics();
+    }, &profiler);
+@endcode
 */
 class MAGNUM_EXPORT Timeline {
     public:
+        /**
+         * @brief Hitch callback
+         *
+         * Called with duration of the hitched frame (in seconds) and the
+         * user-provided state pointer.
+         * @see @ref setHitchCallback()
+         */
+        typedef void(*HitchCallback)(Float, void*);
+
+        /**
+         * @brief Frame time statistics
+         *
+         * All values are in seconds.
+         * @see @ref statistics()
+         */
+        struct Statistics {
+            Float min,              /**< @brief Minimal frame duration */
+                max,                /**< @brief Maximal frame duration */
+                mean,               /**< @brief Mean frame duration */
+                median,             /**< @brief 50th percentile */
+                percentile95,       /**< @brief 95th percentile */
+                percentile99;       /**< @brief 99th percentile */
+        };
+
         /**
          * @brief Constructor
          *
@@ -101,7 +157,7 @@ class MAGNUM_EXPORT Timeline {
             #ifdef MAGNUM_BUILD_DEPRECATED
             _minimalFrameTime(0),
             #endif
-            _previousFrameDuration(0), running(false) {}
+            _previousFrameDuration(0), _statisticsDuration(0), _currentFrame(0), _frameCount(0), _hitchThreshold(0), _hitchCount(0), _hitchCallback(nullptr), _hitchCallbackState(nullptr), _frameAllocator(nullptr), running(false) {}
 
         #ifdef MAGNUM_BUILD_DEPRECATED
         /**
@@ -146,7 +202,9 @@ class MAGNUM_EXPORT Timeline {
         /**
          * @brief Advance to next frame
          *
-         * @note This function does nothing if the timeline is stopped.
+         * Resets the allocator set with @ref setFrameAllocator(), if any.
+         * @note Apart from that, this function does nothing if the timeline
+         *      is stopped.
          * @see @ref stop()
          */
         void nextFrame();
@@ -166,6 +224,90 @@ class MAGNUM_EXPORT Timeline {
          */
         Float previousFrameDuration() const { return _previousFrameDuration; }
 
+        /** @brief Count of frames kept for statistics */
+        std::size_t statisticsDuration() const { return _statisticsDuration; }
+
+        /**
+         * @brief Set count of frames kept for statistics
+         * @return Reference to self (for method chaining)
+         *
+         * Durations of last @p frames frames are kept for calculating
+         * @ref statistics(). Default is `0`, which means no statistics are
+         * calculated. Clears already collected data.
+         */
+        Timeline& setStatisticsDuration(std::size_t frames);
+
+        /**
+         * @brief Count of frames in statistics
+         *
+         * At most @ref statisticsDuration(). Reset on @ref start().
+         */
+        std::size_t statisticsFrameCount() const { return _frameCount; }
+
+        /**
+         * @brief Frame time statistics
+         *
+         * Calculated from durations of last @ref statisticsFrameCount()
+         * frames, percentiles use the nearest-rank method. If no frames were
+         * measured yet, all values are `0.0f`.
+         * @see @ref setStatisticsDuration()
+         */
+        Statistics statistics() const;
+
+        /** @brief Hitch threshold (in seconds) */
+        Float hitchThreshold() const { return _hitchThreshold; }
+
+        /**
+         * @brief Set hitch threshold
+         * @return Reference to self (for method chaining)
+         *
+         * Frames longer than @p seconds are counted as hitches. Default is
+         * `0.0f`, which means hitch detection is disabled.
+         * @see @ref hitchCount(), @ref setHitchCallback()
+         */
+        Timeline& setHitchThreshold(Float seconds) {
+            _hitchThreshold = seconds;
+            return *this;
+        }
+
+        /**
+         * @brief Hitch count
+         *
+         * Count of frames longer than @ref hitchThreshold() since
+         * @ref start().
+         */
+        std::size_t hitchCount() const { return _hitchCount; }
+
+        /**
+         * @brief Set hitch callback
+         * @return Reference to self (for method chaining)
+         *
+         * The @p callback is called from @ref nextFrame() for every frame
+         * longer than @ref hitchThreshold(), with @p state passed through.
+         * Pass `nullptr` to remove the callback.
+         */
+        Timeline& setHitchCallback(HitchCallback callback, void* state = nullptr) {
+            _hitchCallback = callback;
+            _hitchCallbackState = state;
+            return *this;
+        }
+
+        /** @brief Frame allocator */
+        FrameAllocator* frameAllocator() const { return _frameAllocator; }
+
+        /**
+         * @brief Set frame allocator
+         * @return Reference to self (for method chaining)
+         *
+         * The @p allocator is reset in every @ref nextFrame() call. Pass
+         * `nullptr` to not reset any allocator.
+         * @see @ref FrameAllocator::reset()
+         */
+        Timeline& setFrameAllocator(FrameAllocator* allocator) {
+            _frameAllocator = allocator;
+            return *this;
+        }
+
     private:
         std::chrono::high_resolution_clock::time_point _startTime;
         std::chrono::high_resolution_clock::time_point _previousFrameTime;
@@ -174,6 +316,17 @@ class MAGNUM_EXPORT Timeline {
         #endif
         Float _previousFrameDuration;
 
+        /* Ring buffer of last frame durations */
+        std::vector<Float> _frameDurations;
+        std::size_t _statisticsDuration, _currentFrame, _frameCount;
+
+        Float _hitchThreshold;
+        std::size_t _hitchCount;
+        HitchCallback _hitchCallback;
+        void* _hitchCallbackState;
+
+        FrameAllocator* _frameAllocator;
+
         bool running;
 };
 
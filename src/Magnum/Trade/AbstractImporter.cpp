@@ -25,17 +25,23 @@
 
 #include "AbstractImporter.h"
 
+#include <algorithm>
+#include <cstring>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/PluginManager/Manager.h>
 #include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Directory.h>
 
+#include "Magnum/Math/Vector4.h"
 #include "Magnum/Trade/AbstractMaterialData.h"
 #include "Magnum/Trade/CameraData.h"
+#include "Magnum/Trade/FlatSceneData3D.h"
 #include "Magnum/Trade/ImageData.h"
 #include "Magnum/Trade/LightData.h"
+#include "Magnum/Trade/MeshData.h"
 #include "Magnum/Trade/MeshData2D.h"
 #include "Magnum/Trade/MeshData3D.h"
+#include "Magnum/Trade/MeshObjectData3D.h"
 #include "Magnum/Trade/ObjectData2D.h"
 #include "Magnum/Trade/ObjectData3D.h"
 #include "Magnum/Trade/SceneData.h"
@@ -124,6 +130,61 @@ std::optional<SceneData> AbstractImporter::scene(const UnsignedInt id) {
 
 std::optional<SceneData> AbstractImporter::doScene(UnsignedInt) { return std::nullopt; }
 
+std::optional<FlatSceneData3D> AbstractImporter::flatScene3D(const UnsignedInt id) {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::flatScene3D(): no file opened", {});
+    CORRADE_ASSERT(id < doSceneCount(), "Trade::AbstractImporter::flatScene3D(): index out of range", {});
+    return doFlatScene3D(id);
+}
+
+std::optional<FlatSceneData3D> AbstractImporter::doFlatScene3D(const UnsignedInt id) {
+    std::optional<SceneData> scene = doScene(id);
+    if(!scene) return std::nullopt;
+
+    std::vector<UnsignedInt> objects;
+    std::vector<Int> parents;
+    std::vector<Matrix4> transformations;
+    std::vector<ObjectInstanceType3D> instanceTypes;
+    std::vector<Int> instances;
+    std::vector<Int> materials;
+
+    /* Depth-first traversal with explicit stack, pushing the children in
+       reverse so they end up in the same order as in the file. Broken files
+       might reference an object more than once, creating a cycle. */
+    const UnsignedInt objectCount = doObject3DCount();
+    std::vector<bool> visited(objectCount);
+    std::vector<std::pair<UnsignedInt, Int>> stack;
+    for(auto it = scene->children3D().rbegin(); it != scene->children3D().rend(); ++it)
+        stack.emplace_back(*it, -1);
+    while(!stack.empty()) {
+        const UnsignedInt object = stack.back().first;
+        const Int parent = stack.back().second;
+        stack.pop_back();
+
+        if(object >= objectCount || visited[object]) {
+            Error() << "Trade::AbstractImporter::flatScene3D(): object" << object << "is out of range or referenced more than once";
+            return std::nullopt;
+        }
+        visited[object] = true;
+
+        std::unique_ptr<ObjectData3D> data = doObject3D(object);
+        if(!data) return std::nullopt;
+
+        const Int index = Int(objects.size());
+        objects.push_back(object);
+        parents.push_back(parent);
+        transformations.push_back(data->transformation());
+        instanceTypes.push_back(data->instanceType());
+        instances.push_back(data->instance());
+        materials.push_back(data->instanceType() == ObjectInstanceType3D::Mesh ?
+            static_cast<MeshObjectData3D&>(*data).material() : -1);
+
+        for(auto it = data->children().rbegin(); it != data->children().rend(); ++it)
+            stack.emplace_back(*it, index);
+    }
+
+    return FlatSceneData3D{std::move(objects), std::move(parents), std::move(transformations), std::move(instanceTypes), std::move(instances), std::move(materials)};
+}
+
 UnsignedInt AbstractImporter::lightCount() const {
     CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::lightCount(): no file opened", {});
     return doLightCount();
@@ -304,6 +365,90 @@ std::optional<MeshData3D> AbstractImporter::mesh3D(const UnsignedInt id) {
 
 std::optional<MeshData3D> AbstractImporter::doMesh3D(UnsignedInt) { return std::nullopt; }
 
+std::optional<MeshData> AbstractImporter::mesh(const UnsignedInt id) {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::mesh(): no file opened", {});
+    CORRADE_ASSERT(id < doMesh3DCount(), "Trade::AbstractImporter::mesh(): index out of range", {});
+    return doMesh(id);
+}
+
+namespace {
+
+template<class T> void interleaveInto(Containers::Array<char>& data, const std::size_t offset, const std::size_t stride, const std::vector<T>& attribute) {
+    for(std::size_t i = 0; i != attribute.size(); ++i)
+        std::memcpy(data + offset + i*stride, &attribute[i], sizeof(T));
+}
+
+template<class T> Containers::Array<char> copyIndices(const std::vector<UnsignedInt>& indices) {
+    Containers::Array<char> data{indices.size()*sizeof(T)};
+    T* const out = reinterpret_cast<T*>(data.data());
+    for(std::size_t i = 0; i != indices.size(); ++i) out[i] = T(indices[i]);
+    return data;
+}
+
+}
+
+std::optional<MeshData> AbstractImporter::doMesh(const UnsignedInt id) {
+    std::optional<MeshData3D> mesh = doMesh3D(id);
+    if(!mesh) return std::nullopt;
+
+    /* Decide about the layout */
+    const std::vector<Vector3>& positions = mesh->positions(0);
+    std::vector<MeshAttributeData> attributes;
+    UnsignedInt stride = sizeof(Vector3);
+    if(mesh->hasNormals()) stride += sizeof(Vector3);
+    if(mesh->hasTextureCoords2D()) stride += sizeof(Vector2);
+    if(mesh->isSkinned()) stride += sizeof(Vector4ui) + sizeof(Vector4);
+
+    /* Interleave the attributes */
+    Containers::Array<char> vertexData{positions.size()*stride};
+    std::size_t offset = 0;
+    attributes.emplace_back(MeshAttribute::Position, MeshAttributeType::Float, 3, offset, stride);
+    interleaveInto(vertexData, offset, stride, positions);
+    offset += sizeof(Vector3);
+    if(mesh->hasNormals()) {
+        CORRADE_ASSERT(mesh->normals(0).size() == positions.size(),
+            "Trade::AbstractImporter::mesh(): normal count doesn't match position count", {});
+        attributes.emplace_back(MeshAttribute::Normal, MeshAttributeType::Float, 3, offset, stride);
+        interleaveInto(vertexData, offset, stride, mesh->normals(0));
+        offset += sizeof(Vector3);
+    }
+    if(mesh->hasTextureCoords2D()) {
+        CORRADE_ASSERT(mesh->textureCoords2D(0).size() == positions.size(),
+            "Trade::AbstractImporter::mesh(): texture coordinate count doesn't match position count", {});
+        attributes.emplace_back(MeshAttribute::TextureCoordinates, MeshAttributeType::Float, 2, offset, stride);
+        interleaveInto(vertexData, offset, stride, mesh->textureCoords2D(0));
+        offset += sizeof(Vector2);
+    }
+    if(mesh->isSkinned()) {
+        attributes.emplace_back(MeshAttribute::JointIds, MeshAttributeType::UnsignedInt, 4, offset, stride);
+        interleaveInto(vertexData, offset, stride, mesh->jointIds());
+        offset += sizeof(Vector4ui);
+        attributes.emplace_back(MeshAttribute::Weights, MeshAttributeType::Float, 4, offset, stride);
+        interleaveInto(vertexData, offset, stride, mesh->weights());
+    }
+
+    if(!mesh->isIndexed())
+        return MeshData{mesh->primitive(), std::move(vertexData), std::move(attributes), UnsignedInt(positions.size()), mesh->importerState()};
+
+    /* Store the indices in the smallest possible type */
+    const std::vector<UnsignedInt>& indices = mesh->indices();
+    const UnsignedInt max = *std::max_element(indices.begin(), indices.end());
+    MeshIndexType indexType;
+    Containers::Array<char> indexData;
+    if(max <= 0xff) {
+        indexType = MeshIndexType::UnsignedByte;
+        indexData = copyIndices<UnsignedByte>(indices);
+    } else if(max <= 0xffff) {
+        indexType = MeshIndexType::UnsignedShort;
+        indexData = copyIndices<UnsignedShort>(indices);
+    } else {
+        indexType = MeshIndexType::UnsignedInt;
+        indexData = copyIndices<UnsignedInt>(indices);
+    }
+
+    return MeshData{mesh->primitive(), indexType, std::move(indexData), std::move(vertexData), std::move(attributes), UnsignedInt(positions.size()), mesh->importerState()};
+}
+
 UnsignedInt AbstractImporter::materialCount() const {
     CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::materialCount(): no file opened", {});
     return doMaterialCount();
@@ -92,7 +92,16 @@ class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractManagingPlug
          */
         enum class Feature: UnsignedByte {
             /** Opening files from raw data using @ref openData() */
-            OpenData = 1 << 0
+            OpenData = 1 << 0,
+
+            /**
+             * Distinct instances of the plugin can be used concurrently from
+             * different threads. Instantiating the plugin still needs to be
+             * done from a single thread, as the plugin manager isn't
+             * thread-safe.
+             * @see @ref BatchImporter
+             */
+            ThreadSafeInstances = 1 << 1
         };
 
         /** @brief Set of features supported by this importer */
@@ -177,6 +186,19 @@ class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractManagingPlug
          */
         std::optional<SceneData> scene(UnsignedInt id);
 
+        /**
+         * @brief Flat three-dimensional scene
+         * @param id        Scene ID, from range [0, @ref sceneCount()).
+         *
+         * Returns whole 3D object hierarchy of given scene in a flat
+         * representation or `std::nullopt` if import failed. Compared to
+         * going through @ref scene() and @ref object3D() for each object, the
+         * importer can produce the data in a single call, without allocating
+         * a separate @ref ObjectData3D for each object.
+         * @see @ref SceneGraph::instantiateFlatScene()
+         */
+        std::optional<FlatSceneData3D> flatScene3D(UnsignedInt id);
+
         /** @brief Light count */
         UnsignedInt lightCount() const;
 
@@ -339,6 +361,17 @@ class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractManagingPlug
          */
         std::optional<MeshData3D> mesh3D(UnsignedInt id);
 
+        /**
+         * @brief Three-dimensional mesh in interleaved representation
+         * @param id        Mesh ID, from range [0, @ref mesh3DCount()).
+         *
+         * Returns given mesh with all attributes interleaved in a single
+         * vertex buffer, ready to be passed to @ref MeshTools::compile(), or
+         * `std::nullopt` if importing failed. Mesh IDs and names are shared
+         * with @ref mesh3D().
+         */
+        std::optional<MeshData> mesh(UnsignedInt id);
+
         /** @brief Material count */
         UnsignedInt materialCount() const;
 
@@ -550,6 +583,14 @@ class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractManagingPlug
         /** @brief Implementation for @ref scene() */
         virtual std::optional<SceneData> doScene(UnsignedInt id);
 
+        /**
+         * @brief Implementation for @ref flatScene3D()
+         *
+         * Default implementation assembles the data from @ref doScene() and
+         * @ref doObject3D(), visiting the objects in depth-first order.
+         */
+        virtual std::optional<FlatSceneData3D> doFlatScene3D(UnsignedInt id);
+
         /**
          * @brief Implementation for @ref lightCount()
          *
@@ -694,6 +735,18 @@ class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractManagingPlug
         /** @brief Implementation for @ref mesh3D() */
         virtual std::optional<MeshData3D> doMesh3D(UnsignedInt id);
 
+        /**
+         * @brief Implementation for @ref mesh()
+         *
+         * Default implementation calls @ref doMesh3D() and interleaves the
+         * first position, normal and texture coordinate array together with
+         * joint IDs and weights of skinned meshes into a single buffer,
+         * indices are stored in the smallest type that can
+         * represent them. Importers which are able to fill @ref MeshData
+         * directly should reimplement this to avoid the extra copy.
+         */
+        virtual std::optional<MeshData> doMesh(UnsignedInt id);
+
         /**
          * @brief Implementation for @ref materialCount()
          *
@@ -0,0 +1,151 @@
+#ifndef Magnum_Trade_AbstractMeshConverter_h
+#define Magnum_Trade_AbstractMeshConverter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::AbstractMeshConverter
+ */
+
+#include <Corrade/Containers/EnumSet.h>
+#include <Corrade/PluginManager/AbstractManagingPlugin.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Base for mesh converter plugins
+
+Provides functionality for exporting @ref MeshData to various file formats.
+See @ref plugins for more information and `*MeshConverter` classes in
+@ref Trade namespace for available mesh converter plugins.
+
+## Subclassing
+
+Plugin implements function @ref doFeatures() and one or both of
+@ref doExportToData() or @ref doExportToFile() functions based on what
+features are supported.
+
+You don't need to do most of the redundant sanity checks, these things are
+checked by the implementation:
+
+-   Function @ref doExportToData() is called only if @ref Feature::ConvertData
+    is supported.
+-   Function @ref doExportToFile() is called only if @ref Feature::ConvertFile
+    is supported.
+
+Plugin interface string is `"cz.mosra.magnum.Trade.AbstractMeshConverter/0.1"`.
+
+@attention @ref Corrade::Containers::Array instances returned from the plugin
+    should *not* use anything else than the default deleter, otherwise this can
+    cause dangling function pointer call on array destruction if the plugin
+    gets unloaded before the array is destroyed.
+*/
+class MAGNUM_EXPORT AbstractMeshConverter: public PluginManager::AbstractManagingPlugin<AbstractMeshConverter> {
+    CORRADE_PLUGIN_INTERFACE("cz.mosra.magnum.Trade.AbstractMeshConverter/0.1")
+
+    public:
+        /**
+         * @brief Features supported by this converter
+         *
+         * @see @ref Features, @ref features()
+         */
+        enum class Feature: UnsignedByte {
+            /** Exporting to file with @ref exportToFile() */
+            ConvertFile = 1 << 0,
+
+            /**
+             * Exporting to raw data with @ref exportToData(). Implies
+             * @ref Feature::ConvertFile.
+             */
+            ConvertData = ConvertFile|(1 << 1)
+        };
+
+        /**
+         * @brief Features supported by this converter
+         *
+         * @see @ref features()
+         */
+        typedef Containers::EnumSet<Feature> Features;
+
+        /** @brief Default constructor */
+        explicit AbstractMeshConverter();
+
+        /** @brief Constructor with access to plugin manager */
+        explicit AbstractMeshConverter(PluginManager::Manager<AbstractMeshConverter>& manager);
+
+        /** @brief Plugin manager constructor */
+        explicit AbstractMeshConverter(PluginManager::AbstractManager& manager, std::string plugin);
+
+        /** @brief Features supported by this converter */
+        Features features() const { return doFeatures(); }
+
+        /**
+         * @brief Export mesh to raw data
+         *
+         * Available only if @ref Feature::ConvertData is supported. Returns
+         * data on success, zero-sized array otherwise.
+         * @see @ref features(), @ref exportToFile()
+         */
+        Containers::Array<char> exportToData(const MeshData& mesh);
+
+        /**
+         * @brief Export mesh to file
+         *
+         * Available only if @ref Feature::ConvertFile or
+         * @ref Feature::ConvertData is supported. Returns `true` on success,
+         * `false` otherwise.
+         * @see @ref features(), @ref exportToData()
+         */
+        bool exportToFile(const MeshData& mesh, const std::string& filename);
+
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    private:
+    #else
+    protected:
+    #endif
+        /** @brief Implementation of @ref features() */
+        virtual Features doFeatures() const = 0;
+
+        /** @brief Implementation of @ref exportToData() */
+        virtual Containers::Array<char> doExportToData(const MeshData& mesh);
+
+        /**
+         * @brief Implementation of @ref exportToFile()
+         *
+         * If @ref Feature::ConvertData is supported, default implementation
+         * calls @ref doExportToData() and saves the result to given file.
+         */
+        virtual bool doExportToFile(const MeshData& mesh, const std::string& filename);
+};
+
+CORRADE_ENUMSET_OPERATORS(AbstractMeshConverter::Features)
+
+}}
+
+#endif
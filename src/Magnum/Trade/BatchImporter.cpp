@@ -0,0 +1,135 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BatchImporter.h"
+
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace Trade {
+
+BatchImporter::BatchImporter(TaskScheduler& scheduler, PluginManager::Manager<AbstractImporter>& manager, const std::string& plugin): _scheduler(scheduler), _threadSafe{} {
+    if(!(manager.load(plugin) & PluginManager::LoadState::Loaded)) {
+        Error() << "Trade::BatchImporter: cannot load" << plugin << "plugin";
+        return;
+    }
+
+    create([&manager, &plugin]() { return manager.instance(plugin); });
+}
+
+BatchImporter::BatchImporter(TaskScheduler& scheduler, const std::function<std::unique_ptr<AbstractImporter>()>& instantiate): _scheduler(scheduler), _threadSafe{} {
+    create(instantiate);
+}
+
+void BatchImporter::create(const std::function<std::unique_ptr<AbstractImporter>()>& instantiate) {
+    /* The plugin manager isn't thread-safe, so create all instances here */
+    std::unique_ptr<AbstractImporter> first = instantiate();
+    if(!first) return;
+    _threadSafe = !!(first->features() & AbstractImporter::Feature::ThreadSafeInstances);
+    _importers.push_back(std::move(first));
+    if(_threadSafe) for(UnsignedInt i = 1; i != _scheduler.threadCount(); ++i) {
+        std::unique_ptr<AbstractImporter> importer = instantiate();
+        if(!importer) break;
+        _importers.push_back(std::move(importer));
+    }
+
+    /* If fewer instances than threads got created, decode sequentially */
+    if(_importers.size() != _scheduler.threadCount()) _threadSafe = false;
+
+    for(const std::unique_ptr<AbstractImporter>& importer: _importers)
+        _available.push_back(importer.get());
+}
+
+BatchImporter::~BatchImporter() { wait(); }
+
+AbstractImporter* BatchImporter::acquire() {
+    std::lock_guard<std::mutex> lock{_availableMutex};
+    /* There's never more decoding tasks running at once than threads */
+    CORRADE_INTERNAL_ASSERT(!_available.empty());
+    AbstractImporter* const importer = _available.back();
+    _available.pop_back();
+    return importer;
+}
+
+void BatchImporter::release(AbstractImporter* const importer) {
+    std::lock_guard<std::mutex> lock{_availableMutex};
+    _available.push_back(importer);
+}
+
+template<class T> TaskScheduler::TaskHandle BatchImporter::load(const std::string& filename, std::function<void(std::optional<T>)> callback, std::function<std::optional<T>(AbstractImporter&)> import) {
+    std::shared_ptr<std::optional<T>> result = std::make_shared<std::optional<T>>();
+
+    /* Decode on a worker, sequentially if the instance isn't thread-safe */
+    TaskScheduler::TaskHandle decode;
+    if(!_importers.empty()) {
+        decode = _scheduler.submit([this, filename, result, import]() {
+            AbstractImporter* const importer = acquire();
+            if(importer->openFile(filename)) {
+                *result = import(*importer);
+                importer->close();
+            }
+            release(importer);
+        }, {_threadSafe ? TaskScheduler::TaskHandle{} : _lastDecode});
+        if(!_threadSafe) _lastDecode = decode;
+    }
+
+    /* Hand the result over on the main thread */
+    TaskScheduler::TaskHandle done = _scheduler.submit([callback, result]() {
+        callback(std::move(*result));
+    }, {decode}, TaskScheduler::Affinity::MainThread);
+    _pending.push_back(done);
+    return done;
+}
+
+TaskScheduler::TaskHandle BatchImporter::loadImage2D(const std::string& filename, Image2DCallback callback, const UnsignedInt id) {
+    return load<ImageData2D>(filename, std::move(callback), [id](AbstractImporter& importer) -> std::optional<ImageData2D> {
+        if(id >= importer.image2DCount()) {
+            Error() << "Trade::BatchImporter::loadImage2D(): image" << id << "out of range for" << importer.image2DCount() << "images";
+            return std::nullopt;
+        }
+        return importer.image2D(id);
+    });
+}
+
+TaskScheduler::TaskHandle BatchImporter::loadMesh3D(const std::string& filename, Mesh3DCallback callback, const UnsignedInt id) {
+    return load<MeshData3D>(filename, std::move(callback), [id](AbstractImporter& importer) -> std::optional<MeshData3D> {
+        if(id >= importer.mesh3DCount()) {
+            Error() << "Trade::BatchImporter::loadMesh3D(): mesh" << id << "out of range for" << importer.mesh3DCount() << "meshes";
+            return std::nullopt;
+        }
+        return importer.mesh3D(id);
+    });
+}
+
+void BatchImporter::wait() {
+    for(const TaskScheduler::TaskHandle& task: _pending) _scheduler.wait(task);
+    _pending.clear();
+}
+
+}}
@@ -0,0 +1,209 @@
+#ifndef Magnum_Trade_BatchImporter_h
+#define Magnum_Trade_BatchImporter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#if !defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(CORRADE_TARGET_NACL)
+/** @file
+ * @brief Class @ref Magnum::Trade::BatchImporter
+ */
+#endif
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Magnum/TaskScheduler.h"
+#include "Magnum/Trade/AbstractImporter.h"
+
+#if !defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(CORRADE_TARGET_NACL)
+namespace Magnum { namespace Trade {
+
+/**
+@brief Parallel importer of many files
+
+Importer instances are stateful, so a single @ref AbstractImporter can decode
+only one file at a time. This class creates a pool of importer instances of
+given plugin, decodes the files concurrently on worker threads of a
+@ref TaskScheduler and hands the results over to callbacks executed on the
+main thread of the scheduler, where they can be uploaded to the GPU:
+@code
+PluginManager::Manager<Trade::AbstractImporter> manager{MAGNUM_PLUGINS_IMPORTER_DIR};
+TaskScheduler scheduler;
+Trade::BatchImporter importer{scheduler, manager, "TgaImporter"};
+
+std::vector<Texture2D> textures(filenames.size());
+for(std::size_t i = 0; i != filenames.size(); ++i)
+    importer.loadImage2D(filenames[i], [&textures, i](std::optional<Trade::ImageData2D> image) {
+        if(!image) return;
+        textures[i].setStorage(1, TextureFormat::RGBA8, image->size())
+            .setSubImage(0, {}, *image);
+    });
+
+importer.wait();
+@endcode
+
+The callbacks are executed while the main thread waits in @ref wait() or
+@ref TaskScheduler::wait(), or when it calls
+@ref TaskScheduler::runMainThreadTasks(), so the loading can be also spread
+across several frames.
+
+## Thread safety
+
+Plugin manager isn't thread-safe, so all importer instances are created up
+front in the constructor, on the calling thread. If the plugin advertises
+@ref AbstractImporter::Feature::ThreadSafeInstances, one instance is created
+for each thread of the scheduler and the files are decoded in parallel.
+Otherwise only a single instance is created and the files are decoded one
+after another, although still off the main thread.
+*/
+class MAGNUM_EXPORT BatchImporter {
+    public:
+        /**
+         * @brief Image callback
+         *
+         * Called on the main thread with the imported image or
+         * @ref std::nullopt if the import failed.
+         */
+        typedef std::function<void(std::optional<ImageData2D>)> Image2DCallback;
+
+        /**
+         * @brief Mesh callback
+         *
+         * Called on the main thread with the imported mesh or
+         * @ref std::nullopt if the import failed.
+         */
+        typedef std::function<void(std::optional<MeshData3D>)> Mesh3DCallback;
+
+        /**
+         * @brief Constructor
+         * @param scheduler     Scheduler executing the decoding
+         * @param manager       Importer plugin manager
+         * @param plugin        Importer plugin name
+         *
+         * Loads @p plugin and instantiates the importers. If the plugin can't
+         * be loaded, prints a message to error output and all subsequent
+         * loads will fail.
+         */
+        explicit BatchImporter(TaskScheduler& scheduler, PluginManager::Manager<AbstractImporter>& manager, const std::string& plugin);
+
+        /**
+         * @brief Construct with a custom importer instantiation
+         * @param scheduler     Scheduler executing the decoding
+         * @param instantiate   Function returning a new importer instance
+         *
+         * Useful for example for importers that need to be configured
+         * first. The function is called once and then, if the returned
+         * importer supports @ref AbstractImporter::Feature::ThreadSafeInstances,
+         * once more for each remaining thread of the scheduler, all from the
+         * calling thread. If it returns `nullptr`, all subsequent loads will
+         * fail.
+         */
+        explicit BatchImporter(TaskScheduler& scheduler, const std::function<std::unique_ptr<AbstractImporter>()>& instantiate);
+
+        /** @brief Copying is not allowed */
+        BatchImporter(const BatchImporter&) = delete;
+
+        /** @brief Moving is not allowed */
+        BatchImporter(BatchImporter&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Waits for all pending loads using @ref wait().
+         */
+        ~BatchImporter();
+
+        /** @brief Copying is not allowed */
+        BatchImporter& operator=(const BatchImporter&) = delete;
+
+        /** @brief Moving is not allowed */
+        BatchImporter& operator=(BatchImporter&&) = delete;
+
+        /**
+         * @brief Count of importer instances
+         *
+         * Equal to @ref TaskScheduler::threadCount() if the plugin supports
+         * @ref AbstractImporter::Feature::ThreadSafeInstances, `1` otherwise
+         * and `0` if the plugin couldn't be loaded.
+         */
+        std::size_t importerCount() const { return _importers.size(); }
+
+        /**
+         * @brief Load 2D image
+         * @param filename      File to open
+         * @param callback      Function called on the main thread with the
+         *      result
+         * @param id            Image ID in the file
+         * @return Handle of the task executing the callback
+         */
+        TaskScheduler::TaskHandle loadImage2D(const std::string& filename, Image2DCallback callback, UnsignedInt id = 0);
+
+        /**
+         * @brief Load 3D mesh
+         * @param filename      File to open
+         * @param callback      Function called on the main thread with the
+         *      result
+         * @param id            Mesh ID in the file
+         * @return Handle of the task executing the callback
+         */
+        TaskScheduler::TaskHandle loadMesh3D(const std::string& filename, Mesh3DCallback callback, UnsignedInt id = 0);
+
+        /**
+         * @brief Wait for all pending loads
+         *
+         * Expects to be called from the main thread of the scheduler, as
+         * the callbacks are executed there.
+         */
+        void wait();
+
+    private:
+        template<class T> MAGNUM_LOCAL TaskScheduler::TaskHandle load(const std::string& filename, std::function<void(std::optional<T>)> callback, std::function<std::optional<T>(AbstractImporter&)> import);
+
+        MAGNUM_LOCAL void create(const std::function<std::unique_ptr<AbstractImporter>()>& instantiate);
+        MAGNUM_LOCAL AbstractImporter* acquire();
+        MAGNUM_LOCAL void release(AbstractImporter* importer);
+
+        TaskScheduler& _scheduler;
+        std::vector<std::unique_ptr<AbstractImporter>> _importers;
+        std::vector<AbstractImporter*> _available;
+        std::mutex _availableMutex;
+        bool _threadSafe;
+
+        /* Previous decoding task, each next depends on it if the importer
+           instances aren't thread-safe */
+        TaskScheduler::TaskHandle _lastDecode;
+        std::vector<TaskScheduler::TaskHandle> _pending;
+};
+
+}}
+
+#else
+#error this header is not available in Emscripten and NaCl build
+#endif
+
+#endif
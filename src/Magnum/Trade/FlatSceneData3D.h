@@ -0,0 +1,162 @@
+#ifndef Magnum_Trade_FlatSceneData3D_h
+#define Magnum_Trade_FlatSceneData3D_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::FlatSceneData3D
+ */
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Trade/ObjectData3D.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Flat three-dimensional scene data
+
+Whole object hierarchy of a scene stored in parallel arrays instead of one
+@ref ObjectData3D instance per object. Item @f$ i @f$ of every array
+describes the same object, objects are ordered so parent is always before
+its children. That allows the hierarchy to be recreated in a single linear
+pass, for example using @ref SceneGraph::instantiateFlatScene().
+
+Importers can provide the data in a single call through
+@ref AbstractImporter::flatScene3D(), otherwise it is assembled from
+@ref AbstractImporter::scene() and @ref AbstractImporter::object3D().
+@see @ref SceneData
+*/
+class MAGNUM_EXPORT FlatSceneData3D {
+    public:
+        /**
+         * @brief Constructor
+         * @param objects           Importer object IDs
+         * @param parents           Parent indices
+         * @param transformations   Transformations (relative to parent)
+         * @param instanceTypes     Instance types
+         * @param instances         Instance IDs
+         * @param materials         Material IDs or `-1`
+         * @param importerState     Importer-specific state
+         *
+         * All arrays are expected to have the same size and each parent index
+         * is expected to be either `-1` for top-level objects or less than
+         * index of the object itself.
+         */
+        explicit FlatSceneData3D(std::vector<UnsignedInt> objects, std::vector<Int> parents, std::vector<Matrix4> transformations, std::vector<ObjectInstanceType3D> instanceTypes, std::vector<Int> instances, std::vector<Int> materials, const void* importerState = nullptr);
+
+        /** @brief Copying is not allowed */
+        FlatSceneData3D(const FlatSceneData3D&) = delete;
+
+        /** @brief Move constructor */
+        FlatSceneData3D(FlatSceneData3D&&)
+            /* GCC 4.9.0 (the one from Android NDK) thinks this does not match
+               the implicit signature so it can't be defaulted. Works on 4.7,
+               5.0 and everywhere else, so I don't bother. */
+            #if !defined(__GNUC__) || __GNUC__*100 + __GNUC_MINOR__ != 409
+            noexcept
+            #endif
+            ;
+
+        /** @brief Copying is not allowed */
+        FlatSceneData3D& operator=(const FlatSceneData3D&) = delete;
+
+        /** @brief Move assignment */
+        FlatSceneData3D& operator=(FlatSceneData3D&&)
+            /* GCC 4.9.0 (the one from Android NDK) thinks this does not match
+               the implicit signature so it can't be defaulted. Works on 4.7,
+               5.0 and everywhere else, so I don't bother. */
+            #if !defined(__GNUC__) || __GNUC__*100 + __GNUC_MINOR__ != 409
+            noexcept
+            #endif
+            ;
+
+        /** @brief Object count */
+        std::size_t objectCount() const { return _objects.size(); }
+
+        /**
+         * @brief Importer object IDs
+         *
+         * ID of each object for use with @ref AbstractImporter::object3DName()
+         * and similar.
+         */
+        const std::vector<UnsignedInt>& objects() const { return _objects; }
+
+        /**
+         * @brief Parent indices
+         *
+         * Index of parent object in this data or `-1` for top-level objects.
+         * Parent is always before its children.
+         */
+        const std::vector<Int>& parents() const { return _parents; }
+
+        /** @brief Transformations (relative to parent) */
+        const std::vector<Matrix4>& transformations() const { return _transformations; }
+
+        /**
+         * @brief Instance types
+         *
+         * @see @ref instances()
+         */
+        const std::vector<ObjectInstanceType3D>& instanceTypes() const { return _instanceTypes; }
+
+        /**
+         * @brief Instance IDs
+         *
+         * ID of given camera / light / mesh etc., specified by
+         * @ref instanceTypes(), `-1` for @ref ObjectInstanceType3D::Empty.
+         */
+        const std::vector<Int>& instances() const { return _instances; }
+
+        /**
+         * @brief Material IDs
+         *
+         * Material ID for @ref ObjectInstanceType3D::Mesh objects, `-1` for
+         * other objects or if the mesh has no material. See
+         * @ref MeshObjectData3D::material().
+         */
+        const std::vector<Int>& materials() const { return _materials; }
+
+        /**
+         * @brief Importer-specific state
+         *
+         * See @ref AbstractImporter::importerState() for more information.
+         */
+        const void* importerState() const { return _importerState; }
+
+    private:
+        std::vector<UnsignedInt> _objects;
+        std::vector<Int> _parents;
+        std::vector<Matrix4> _transformations;
+        std::vector<ObjectInstanceType3D> _instanceTypes;
+        std::vector<Int> _instances, _materials;
+        const void* _importerState;
+};
+
+}}
+
+#endif
@@ -0,0 +1,187 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "MapFile.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <Corrade/Utility/Debug.h>
+
+#if defined(CORRADE_TARGET_UNIX) || defined(CORRADE_TARGET_EMSCRIPTEN)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#elif defined(CORRADE_TARGET_WINDOWS)
+#define WIN32_LEAN_AND_MEAN 1
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fstream>
+#endif
+
+namespace Magnum { namespace Trade {
+
+namespace {
+
+#if defined(CORRADE_TARGET_UNIX) || defined(CORRADE_TARGET_EMSCRIPTEN)
+/* The mapping always starts at a page boundary and the data pointer is less
+   than one page after it, so the base can be recovered by aligning the
+   pointer down. That makes the deleter stateless. */
+void unmap(char* const data, const std::size_t size) {
+    const std::size_t pageSize = sysconf(_SC_PAGESIZE);
+    char* const base = reinterpret_cast<char*>(reinterpret_cast<std::uintptr_t>(data) & ~(pageSize - 1));
+    munmap(base, size + (data - base));
+}
+#elif defined(CORRADE_TARGET_WINDOWS)
+/* Views are aligned to allocation granularity, same trick as above */
+void unmap(char* const data, std::size_t) {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    const std::size_t granularity = info.dwAllocationGranularity;
+    UnmapViewOfFile(reinterpret_cast<void*>(reinterpret_cast<std::uintptr_t>(data) & ~(granularity - 1)));
+}
+#endif
+
+}
+
+std::optional<Containers::Array<char>> mapFile(const std::string& filename, const std::size_t offset, std::size_t size) {
+    #if defined(CORRADE_TARGET_UNIX) || defined(CORRADE_TARGET_EMSCRIPTEN)
+    const int fd = open(filename.data(), O_RDONLY);
+    if(fd == -1) {
+        Error() << "Trade::mapFile(): cannot open file" << filename;
+        return std::nullopt;
+    }
+
+    struct stat info;
+    if(fstat(fd, &info) == -1) {
+        close(fd);
+        Error() << "Trade::mapFile(): cannot get size of file" << filename;
+        return std::nullopt;
+    }
+
+    const std::size_t fileSize = info.st_size;
+    if(offset > fileSize) {
+        close(fd);
+        Error() << "Trade::mapFile(): offset" << offset << "is past the end of" << fileSize << "byte file" << filename;
+        return std::nullopt;
+    }
+
+    size = std::min(size, fileSize - offset);
+    if(!size) {
+        close(fd);
+        return Containers::Array<char>{};
+    }
+
+    /* Map from the nearest page boundary */
+    const std::size_t pageSize = sysconf(_SC_PAGESIZE);
+    const std::size_t alignedOffset = offset & ~(pageSize - 1);
+    const std::size_t mappedSize = size + (offset - alignedOffset);
+    void* const base = mmap(nullptr, mappedSize, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, alignedOffset);
+
+    /* The mapping holds its own reference to the file */
+    close(fd);
+
+    if(base == MAP_FAILED) {
+        Error() << "Trade::mapFile(): cannot map file" << filename;
+        return std::nullopt;
+    }
+
+    return Containers::Array<char>{static_cast<char*>(base) + (offset - alignedOffset), size, unmap};
+
+    #elif defined(CORRADE_TARGET_WINDOWS)
+    HANDLE file = CreateFileA(filename.data(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if(file == INVALID_HANDLE_VALUE) {
+        Error() << "Trade::mapFile(): cannot open file" << filename;
+        return std::nullopt;
+    }
+
+    LARGE_INTEGER largeFileSize;
+    if(!GetFileSizeEx(file, &largeFileSize)) {
+        CloseHandle(file);
+        Error() << "Trade::mapFile(): cannot get size of file" << filename;
+        return std::nullopt;
+    }
+
+    const std::size_t fileSize = largeFileSize.QuadPart;
+    if(offset > fileSize) {
+        CloseHandle(file);
+        Error() << "Trade::mapFile(): offset" << offset << "is past the end of" << fileSize << "byte file" << filename;
+        return std::nullopt;
+    }
+
+    size = std::min(size, fileSize - offset);
+    if(!size) {
+        CloseHandle(file);
+        return Containers::Array<char>{};
+    }
+
+    /* Copy-on-write mapping, both the mapping object and the view hold a
+       reference to the file so the handles can be closed right away */
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    CloseHandle(file);
+    if(!mapping) {
+        Error() << "Trade::mapFile(): cannot map file" << filename;
+        return std::nullopt;
+    }
+
+    SYSTEM_INFO systemInfo;
+    GetSystemInfo(&systemInfo);
+    const std::size_t granularity = systemInfo.dwAllocationGranularity;
+    const unsigned long long alignedOffset = offset & ~(granularity - 1);
+    void* const base = MapViewOfFile(mapping, FILE_MAP_COPY, DWORD(alignedOffset >> 32), DWORD(alignedOffset & 0xffffffff), size + (offset - alignedOffset));
+    CloseHandle(mapping);
+
+    if(!base) {
+        Error() << "Trade::mapFile(): cannot map file" << filename;
+        return std::nullopt;
+    }
+
+    return Containers::Array<char>{static_cast<char*>(base) + (offset - alignedOffset), size, unmap};
+
+    #else
+    std::ifstream file{filename, std::ios::binary};
+    if(!file) {
+        Error() << "Trade::mapFile(): cannot open file" << filename;
+        return std::nullopt;
+    }
+
+    file.seekg(0, std::ios::end);
+    const std::size_t fileSize = file.tellg();
+    if(offset > fileSize) {
+        Error() << "Trade::mapFile(): offset" << offset << "is past the end of" << fileSize << "byte file" << filename;
+        return std::nullopt;
+    }
+
+    size = std::min(size, fileSize - offset);
+    Containers::Array<char> data{size};
+    file.seekg(offset, std::ios::beg);
+    file.read(data, size);
+    return std::move(data);
+    #endif
+}
+
+}}
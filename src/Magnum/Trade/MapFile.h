@@ -0,0 +1,75 @@
+#ifndef Magnum_Trade_MapFile_h
+#define Magnum_Trade_MapFile_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Trade::mapFile()
+ */
+
+#include <string>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+#include "MagnumExternal/Optional/optional.hpp"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Map a file into memory
+@param filename     File to map
+@param offset       Offset of the mapped range in the file
+@param size         Size of the mapped range. If it goes past the end of the
+    file, it is clamped to file size.
+
+Creates a private copy-on-write mapping of given file range, the returned
+array points directly into the mapped memory and unmaps it on destruction
+using a custom deleter. Pages are loaded lazily on first access and shared
+with the OS page cache, so mapping the same file repeatedly doesn't duplicate
+its contents in memory. Writing to the array doesn't affect the file, only the
+modified pages get copied.
+
+Useful for importers that return data which are already stored in the file in
+the output layout, as the file-backed array can be passed directly to
+@ref ImageData constructor without copying:
+@code
+std::optional<Containers::Array<char>> data = Trade::mapFile("image.raw", headerSize);
+if(!data) return;
+
+Trade::ImageData2D image{PixelFormat::RGBA, PixelType::UnsignedByte, size, std::move(*data)};
+@endcode
+
+On Unix (and Emscripten) the mapping is done using `mmap()`, on Windows using
+`MapViewOfFile()`. On other platforms the range is read into a newly allocated
+array instead. If the file can't be opened or @p offset is past its end, prints
+message to error output and returns `std::nullopt`. Mapping an empty range
+returns empty array.
+*/
+MAGNUM_EXPORT std::optional<Containers::Array<char>> mapFile(const std::string& filename, std::size_t offset = 0, std::size_t size = ~std::size_t{});
+
+}}
+
+#endif
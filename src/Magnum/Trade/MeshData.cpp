@@ -0,0 +1,221 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MeshData.h"
+
+#include <algorithm>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+namespace Magnum { namespace Trade {
+
+UnsignedInt meshAttributeTypeSize(const MeshAttributeType type) {
+    switch(type) {
+        case MeshAttributeType::UnsignedByte:
+        case MeshAttributeType::Byte:
+            return 1;
+        case MeshAttributeType::UnsignedShort:
+        case MeshAttributeType::Short:
+        case MeshAttributeType::HalfFloat:
+            return 2;
+        case MeshAttributeType::UnsignedInt:
+        case MeshAttributeType::Int:
+        case MeshAttributeType::Float:
+            return 4;
+    }
+
+    CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+UnsignedInt meshIndexTypeSize(const MeshIndexType type) {
+    switch(type) {
+        case MeshIndexType::UnsignedByte: return 1;
+        case MeshIndexType::UnsignedShort: return 2;
+        case MeshIndexType::UnsignedInt: return 4;
+    }
+
+    CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+MeshData::MeshData(const MeshPrimitive primitive, const MeshIndexType indexType, Containers::Array<char>&& indexData, Containers::Array<char>&& vertexData, std::vector<MeshAttributeData> attributes, const UnsignedInt vertexCount, const void* const importerState): _primitive{primitive}, _indexType{indexType}, _indexed{true}, _vertexCount{vertexCount}, _indexData{std::move(indexData)}, _vertexData{std::move(vertexData)}, _attributes{std::move(attributes)}, _importerState{importerState} {
+    CORRADE_ASSERT(_indexData.size()%meshIndexTypeSize(_indexType) == 0,
+        "Trade::MeshData: index data size" << _indexData.size() << "is not divisible by" << _indexType << "size", );
+    #ifndef CORRADE_NO_ASSERT
+    for(const MeshAttributeData& attribute: _attributes)
+        CORRADE_ASSERT(!_vertexCount || attribute.offset() + (_vertexCount - 1)*attribute.stride() + attribute.size() <= _vertexData.size(),
+            "Trade::MeshData:" << attribute.name() << "attribute doesn't fit into" << _vertexData.size() << "bytes of vertex data", );
+    #endif
+}
+
+MeshData::MeshData(const MeshPrimitive primitive, Containers::Array<char>&& vertexData, std::vector<MeshAttributeData> attributes, const UnsignedInt vertexCount, const void* const importerState): MeshData{primitive, MeshIndexType::UnsignedInt, nullptr, std::move(vertexData), std::move(attributes), vertexCount, importerState} {
+    _indexed = false;
+}
+
+namespace {
+    /* Defined here and not in the plugins so the array doesn't reference
+       code of a plugin that might get unloaded */
+    void nonOwnedDeleter(char*, std::size_t) {}
+}
+
+MeshData::MeshData(const MeshPrimitive primitive, const MeshIndexType indexType, const Containers::ArrayView<const char> indexData, const Containers::ArrayView<const char> vertexData, std::vector<MeshAttributeData> attributes, const UnsignedInt vertexCount, const void* const importerState): MeshData{primitive, indexType,
+    Containers::Array<char>{const_cast<char*>(indexData.data()), indexData.size(), nonOwnedDeleter},
+    Containers::Array<char>{const_cast<char*>(vertexData.data()), vertexData.size(), nonOwnedDeleter},
+    std::move(attributes), vertexCount, importerState} {}
+
+MeshData::MeshData(const MeshPrimitive primitive, const Containers::ArrayView<const char> vertexData, std::vector<MeshAttributeData> attributes, const UnsignedInt vertexCount, const void* const importerState): MeshData{primitive,
+    Containers::Array<char>{const_cast<char*>(vertexData.data()), vertexData.size(), nonOwnedDeleter},
+    std::move(attributes), vertexCount, importerState} {}
+
+MeshData::MeshData(MeshData&&)
+    #if !defined(__GNUC__) || __GNUC__*100 + __GNUC_MINOR__ != 409
+    noexcept
+    #endif
+    = default;
+
+MeshData::~MeshData() = default;
+
+MeshData& MeshData::operator=(MeshData&&)
+    #if !defined(__GNUC__) || __GNUC__*100 + __GNUC_MINOR__ != 409
+    noexcept
+    #endif
+    = default;
+
+MeshIndexType MeshData::indexType() const {
+    CORRADE_ASSERT(_indexed, "Trade::MeshData::indexType(): the mesh is not indexed", {});
+    return _indexType;
+}
+
+UnsignedInt MeshData::indexCount() const {
+    return _indexed ? _indexData.size()/meshIndexTypeSize(_indexType) : 0;
+}
+
+namespace {
+
+template<class T> std::pair<UnsignedInt, UnsignedInt> minmax(const char* const data, const std::size_t size) {
+    const T* const indices = reinterpret_cast<const T*>(data);
+    const std::pair<const T*, const T*> range = std::minmax_element(indices, indices + size/sizeof(T));
+    return {*range.first, *range.second};
+}
+
+}
+
+std::pair<UnsignedInt, UnsignedInt> MeshData::indexRange() const {
+    CORRADE_ASSERT(_indexed, "Trade::MeshData::indexRange(): the mesh is not indexed", {});
+
+    if(_indexData.empty()) return {};
+
+    switch(_indexType) {
+        case MeshIndexType::UnsignedByte:
+            return minmax<UnsignedByte>(_indexData, _indexData.size());
+        case MeshIndexType::UnsignedShort:
+            return minmax<UnsignedShort>(_indexData, _indexData.size());
+        case MeshIndexType::UnsignedInt:
+            return minmax<UnsignedInt>(_indexData, _indexData.size());
+    }
+
+    CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+UnsignedInt MeshData::attributeCount(const MeshAttribute name) const {
+    return std::count_if(_attributes.begin(), _attributes.end(), [name](const MeshAttributeData& attribute) {
+        return attribute.name() == name;
+    });
+}
+
+const MeshAttributeData& MeshData::attribute(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _attributes.size(), "Trade::MeshData::attribute(): index out of range", _attributes[id]);
+    return _attributes[id];
+}
+
+const MeshAttributeData& MeshData::attribute(const MeshAttribute name, UnsignedInt id) const {
+    for(const MeshAttributeData& attribute: _attributes)
+        if(attribute.name() == name && !id--) return attribute;
+
+    CORRADE_ASSERT(false, "Trade::MeshData::attribute(): index out of range for" << name, _attributes.front());
+    return _attributes.front(); /* LCOV_EXCL_LINE */
+}
+
+Containers::Array<char> MeshData::releaseIndexData() {
+    _indexed = false;
+    return std::move(_indexData);
+}
+
+Containers::Array<char> MeshData::releaseVertexData() {
+    _attributes.clear();
+    _vertexCount = 0;
+    return std::move(_vertexData);
+}
+
+Debug& operator<<(Debug& debug, const MeshAttribute value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case MeshAttribute::value: return debug << "Trade::MeshAttribute::" #value;
+        _c(Position)
+        _c(Normal)
+        _c(TextureCoordinates)
+        _c(Color)
+        _c(JointIds)
+        _c(Weights)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "Trade::MeshAttribute(" << Debug::nospace << reinterpret_cast<void*>(UnsignedByte(value)) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const MeshAttributeType value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case MeshAttributeType::value: return debug << "Trade::MeshAttributeType::" #value;
+        _c(UnsignedByte)
+        _c(Byte)
+        _c(UnsignedShort)
+        _c(Short)
+        _c(UnsignedInt)
+        _c(Int)
+        _c(HalfFloat)
+        _c(Float)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "Trade::MeshAttributeType(" << Debug::nospace << reinterpret_cast<void*>(UnsignedByte(value)) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const MeshIndexType value) {
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(value) case MeshIndexType::value: return debug << "Trade::MeshIndexType::" #value;
+        _c(UnsignedByte)
+        _c(UnsignedShort)
+        _c(UnsignedInt)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "Trade::MeshIndexType(" << Debug::nospace << reinterpret_cast<void*>(UnsignedByte(value)) << Debug::nospace << ")";
+}
+
+}}
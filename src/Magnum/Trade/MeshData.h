@@ -0,0 +1,373 @@
+#ifndef Magnum_Trade_MeshData_h
+#define Magnum_Trade_MeshData_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::MeshData, @ref Magnum::Trade::MeshAttributeData, enum @ref Magnum::Trade::MeshAttribute, @ref Magnum::Trade::MeshAttributeType, @ref Magnum::Trade::MeshIndexType
+ */
+
+#include <vector>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Mesh attribute name
+
+@see @ref MeshAttributeData
+*/
+enum class MeshAttribute: UnsignedByte {
+    /**
+     * Position, corresponds to @ref Shaders::Generic::Position. Two or three
+     * components.
+     */
+    Position,
+
+    /** Normal, corresponds to @ref Shaders::Generic3D::Normal. */
+    Normal,
+
+    /**
+     * Texture coordinates, corresponds to
+     * @ref Shaders::Generic::TextureCoordinates.
+     */
+    TextureCoordinates,
+
+    /** Vertex color, corresponds to @ref Shaders::Generic::Color. */
+    Color,
+
+    /**
+     * Joint IDs for skinning, corresponds to
+     * @ref Shaders::Generic3D::JointIds. Up to four unsigned integer
+     * components.
+     */
+    JointIds,
+
+    /**
+     * Joint weights for skinning, corresponds to
+     * @ref Shaders::Generic3D::Weights. Same component count as
+     * @ref MeshAttribute::JointIds.
+     */
+    Weights
+};
+
+/**
+@brief Mesh attribute component type
+
+@see @ref meshAttributeTypeSize(), @ref MeshAttributeData
+*/
+enum class MeshAttributeType: UnsignedByte {
+    UnsignedByte,   /**< Unsigned byte */
+    Byte,           /**< Byte */
+    UnsignedShort,  /**< Unsigned short */
+    Short,          /**< Short */
+    UnsignedInt,    /**< Unsigned int */
+    Int,            /**< Int */
+    HalfFloat,      /**< Half float */
+    Float           /**< Float */
+};
+
+/** @brief Size of given mesh attribute component type */
+MAGNUM_EXPORT UnsignedInt meshAttributeTypeSize(MeshAttributeType type);
+
+/**
+@brief Mesh index type
+
+@see @ref meshIndexTypeSize(), @ref MeshData::indexType()
+*/
+enum class MeshIndexType: UnsignedByte {
+    UnsignedByte,   /**< Unsigned byte */
+    UnsignedShort,  /**< Unsigned short */
+    UnsignedInt     /**< Unsigned int */
+};
+
+/** @brief Size of given mesh index type */
+MAGNUM_EXPORT UnsignedInt meshIndexTypeSize(MeshIndexType type);
+
+/**
+@brief Mesh attribute layout
+
+Describes where a single attribute is stored in the interleaved vertex data of
+@ref MeshData.
+*/
+class MeshAttributeData {
+    public:
+        /**
+         * @brief Constructor
+         * @param name          Attribute name
+         * @param type          Component type
+         * @param components    Component count, from range [1, 4]
+         * @param offset        Offset of the first item in vertex data
+         * @param stride        Distance between two consecutive items
+         * @param normalized    Whether integral values are normalized to
+         *      [0, 1] (or [-1, 1] for signed types)
+         */
+        constexpr explicit MeshAttributeData(MeshAttribute name, MeshAttributeType type, UnsignedInt components, std::size_t offset, UnsignedInt stride, bool normalized = false) noexcept: _name{name}, _type{type}, _components{UnsignedByte(components)}, _normalized{normalized}, _stride{stride}, _offset{offset} {}
+
+        /** @brief Attribute name */
+        constexpr MeshAttribute name() const { return _name; }
+
+        /** @brief Component type */
+        constexpr MeshAttributeType type() const { return _type; }
+
+        /** @brief Component count */
+        constexpr UnsignedInt components() const { return _components; }
+
+        /** @brief Whether integral values are normalized */
+        constexpr bool isNormalized() const { return _normalized; }
+
+        /** @brief Offset of the first item in vertex data */
+        constexpr std::size_t offset() const { return _offset; }
+
+        /** @brief Distance between two consecutive items */
+        constexpr UnsignedInt stride() const { return _stride; }
+
+        /**
+         * @brief Size of one item
+         *
+         * Component count multiplied by @ref meshAttributeTypeSize().
+         */
+        UnsignedInt size() const { return _components*meshAttributeTypeSize(_type); }
+
+    private:
+        MeshAttribute _name;
+        MeshAttributeType _type;
+        UnsignedByte _components;
+        bool _normalized;
+        UnsignedInt _stride;
+        std::size_t _offset;
+};
+
+/**
+@brief Interleaved mesh data
+
+Unlike @ref MeshData2D and @ref MeshData3D, which store every attribute in a
+separate array of fixed type, this class holds all vertex attributes in a
+single interleaved blob, its layout is described by a list of
+@ref MeshAttributeData. Index data, if any, are stored as a blob of given
+@ref MeshIndexType. The data thus have the same representation as in GPU
+buffers and the importer can fill them directly, @ref MeshTools::compile()
+then uploads them without any intermediate processing.
+
+@see @ref AbstractImporter::mesh()
+*/
+class MAGNUM_EXPORT MeshData {
+    public:
+        /**
+         * @brief Construct indexed mesh data
+         * @param primitive     Primitive
+         * @param indexType     Index type
+         * @param indexData     Index data
+         * @param vertexData    Interleaved vertex data
+         * @param attributes    Attribute layout
+         * @param vertexCount   Vertex count
+         * @param importerState Importer-specific state
+         *
+         * Size of @p indexData is expected to be divisible by size of
+         * @p indexType, all @p attributes are expected to fit into
+         * @p vertexData for given @p vertexCount.
+         */
+        explicit MeshData(MeshPrimitive primitive, MeshIndexType indexType, Containers::Array<char>&& indexData, Containers::Array<char>&& vertexData, std::vector<MeshAttributeData> attributes, UnsignedInt vertexCount, const void* importerState = nullptr);
+
+        /**
+         * @brief Construct non-indexed mesh data
+         * @param primitive     Primitive
+         * @param vertexData    Interleaved vertex data
+         * @param attributes    Attribute layout
+         * @param vertexCount   Vertex count
+         * @param importerState Importer-specific state
+         *
+         * All @p attributes are expected to fit into @p vertexData for given
+         * @p vertexCount.
+         */
+        explicit MeshData(MeshPrimitive primitive, Containers::Array<char>&& vertexData, std::vector<MeshAttributeData> attributes, UnsignedInt vertexCount, const void* importerState = nullptr);
+
+        /**
+         * @brief Construct indexed mesh data from non-owned memory
+         *
+         * Same as above, but the data are not copied and the instance
+         * doesn't take ownership of them. The memory has to stay valid for
+         * the whole instance lifetime and shouldn't be modified through
+         * @ref indexData() or @ref vertexData(). Useful for example for
+         * mapping the data directly from a memory-mapped file.
+         */
+        explicit MeshData(MeshPrimitive primitive, MeshIndexType indexType, Containers::ArrayView<const char> indexData, Containers::ArrayView<const char> vertexData, std::vector<MeshAttributeData> attributes, UnsignedInt vertexCount, const void* importerState = nullptr);
+
+        /**
+         * @brief Construct non-indexed mesh data from non-owned memory
+         *
+         * See @ref MeshData(MeshPrimitive, MeshIndexType, Containers::ArrayView<const char>, Containers::ArrayView<const char>, std::vector<MeshAttributeData>, UnsignedInt, const void*)
+         * for more information about data ownership.
+         */
+        explicit MeshData(MeshPrimitive primitive, Containers::ArrayView<const char> vertexData, std::vector<MeshAttributeData> attributes, UnsignedInt vertexCount, const void* importerState = nullptr);
+
+        /** @brief Copying is not allowed */
+        MeshData(const MeshData&) = delete;
+
+        /** @brief Move constructor */
+        MeshData(MeshData&&)
+            /* GCC 4.9.0 (the one from Android NDK) thinks this does not match
+               the implicit signature so it can't be defaulted. Works on 4.7,
+               5.0 and everywhere else, so I don't bother. */
+            #if !defined(__GNUC__) || __GNUC__*100 + __GNUC_MINOR__ != 409
+            noexcept
+            #endif
+            ;
+
+        ~MeshData();
+
+        /** @brief Copying is not allowed */
+        MeshData& operator=(const MeshData&) = delete;
+
+        /** @brief Move assignment */
+        MeshData& operator=(MeshData&&)
+            /* GCC 4.9.0 (the one from Android NDK) thinks this does not match
+               the implicit signature so it can't be defaulted. Works on 4.7,
+               5.0 and everywhere else, so I don't bother. */
+            #if !defined(__GNUC__) || __GNUC__*100 + __GNUC_MINOR__ != 409
+            noexcept
+            #endif
+            ;
+
+        /** @brief Primitive */
+        MeshPrimitive primitive() const { return _primitive; }
+
+        /** @brief Whether the mesh is indexed */
+        bool isIndexed() const { return _indexed; }
+
+        /**
+         * @brief Index type
+         *
+         * Expects that the mesh is indexed.
+         * @see @ref isIndexed()
+         */
+        MeshIndexType indexType() const;
+
+        /**
+         * @brief Index count
+         *
+         * Returns `0` if the mesh is not indexed.
+         */
+        UnsignedInt indexCount() const;
+
+        /**
+         * @brief Raw index data
+         *
+         * Returns `nullptr` if the mesh is not indexed.
+         * @see @ref releaseIndexData()
+         */
+        Containers::ArrayView<char> indexData() { return _indexData; }
+        Containers::ArrayView<const char> indexData() const { return _indexData; } /**< @overload */
+
+        /**
+         * @brief Index range
+         *
+         * Minimal and maximal index contained in index data. The range is
+         * calculated on every call. Expects that the mesh is indexed.
+         */
+        std::pair<UnsignedInt, UnsignedInt> indexRange() const;
+
+        /** @brief Vertex count */
+        UnsignedInt vertexCount() const { return _vertexCount; }
+
+        /**
+         * @brief Raw interleaved vertex data
+         *
+         * @see @ref releaseVertexData()
+         */
+        Containers::ArrayView<char> vertexData() { return _vertexData; }
+        Containers::ArrayView<const char> vertexData() const { return _vertexData; } /**< @overload */
+
+        /** @brief Total attribute count */
+        UnsignedInt attributeCount() const { return _attributes.size(); }
+
+        /** @brief Count of attributes of given name */
+        UnsignedInt attributeCount(MeshAttribute name) const;
+
+        /** @brief Whether the mesh has at least one attribute of given name */
+        bool hasAttribute(MeshAttribute name) const { return attributeCount(name); }
+
+        /**
+         * @brief Attribute layout
+         * @param id        Attribute ID, from range [0, @ref attributeCount()).
+         */
+        const MeshAttributeData& attribute(UnsignedInt id) const;
+
+        /**
+         * @brief Attribute layout for given name
+         * @param name      Attribute name
+         * @param id        Attribute ID, from range
+         *      [0, @ref attributeCount(MeshAttribute) const).
+         */
+        const MeshAttributeData& attribute(MeshAttribute name, UnsignedInt id = 0) const;
+
+        /**
+         * @brief Release index data storage
+         *
+         * Releases the ownership of index data, the mesh is then
+         * non-indexed.
+         */
+        Containers::Array<char> releaseIndexData();
+
+        /**
+         * @brief Release vertex data storage
+         *
+         * Releases the ownership of vertex data and clears the attribute
+         * list and vertex count.
+         */
+        Containers::Array<char> releaseVertexData();
+
+        /**
+         * @brief Importer-specific state
+         *
+         * See @ref AbstractImporter::importerState() for more information.
+         */
+        const void* importerState() const { return _importerState; }
+
+    private:
+        MeshPrimitive _primitive;
+        MeshIndexType _indexType;
+        bool _indexed;
+        UnsignedInt _vertexCount;
+        Containers::Array<char> _indexData, _vertexData;
+        std::vector<MeshAttributeData> _attributes;
+        const void* _importerState;
+};
+
+/** @debugoperatorenum{Magnum::Trade::MeshAttribute} */
+MAGNUM_EXPORT Debug& operator<<(Debug& debug, MeshAttribute value);
+
+/** @debugoperatorenum{Magnum::Trade::MeshAttributeType} */
+MAGNUM_EXPORT Debug& operator<<(Debug& debug, MeshAttributeType value);
+
+/** @debugoperatorenum{Magnum::Trade::MeshIndexType} */
+MAGNUM_EXPORT Debug& operator<<(Debug& debug, MeshIndexType value);
+
+}}
+
+#endif
@@ -25,7 +25,7 @@
 
 #include "MeshData3D.h"
 
-#include "Magnum/Math/Vector3.h"
+#include "Magnum/Math/Vector4.h"
 
 namespace Magnum { namespace Trade {
 
@@ -33,6 +33,15 @@ MeshData3D::MeshData3D(const MeshPrimitive primitive, std::vector<UnsignedInt> i
     CORRADE_ASSERT(!_positions.empty(), "Trade::MeshData3D: no position array specified", );
 }
 
+MeshData3D::MeshData3D(const MeshPrimitive primitive, std::vector<UnsignedInt> indices, std::vector<std::vector<Vector3>> positions, std::vector<std::vector<Vector3>> normals, std::vector<std::vector<Vector2>> textureCoords2D, std::vector<Vector4ui> jointIds, std::vector<Vector4> weights, const void* const importerState): MeshData3D{primitive, std::move(indices), std::move(positions), std::move(normals), std::move(textureCoords2D), importerState} {
+    CORRADE_ASSERT(jointIds.size() == weights.size(),
+        "Trade::MeshData3D: expected" << jointIds.size() << "joint weights but got" << weights.size(), );
+    CORRADE_ASSERT(jointIds.empty() || jointIds.size() == _positions[0].size(),
+        "Trade::MeshData3D: expected" << _positions[0].size() << "joint IDs but got" << jointIds.size(), );
+    _jointIds = std::move(jointIds);
+    _weights = std::move(weights);
+}
+
 MeshData3D::MeshData3D(MeshData3D&&)
     #if !defined(__GNUC__) || __GNUC__*100 + __GNUC_MINOR__ != 409
     noexcept
@@ -87,4 +96,34 @@ const std::vector<Vector2>& MeshData3D::textureCoords2D(const UnsignedInt id) co
     return _textureCoords2D[id];
 }
 
+std::vector<Vector4ui>& MeshData3D::jointIds() {
+    CORRADE_ASSERT(isSkinned(), "Trade::MeshData3D::jointIds(): the mesh is not skinned", _jointIds);
+    return _jointIds;
+}
+
+const std::vector<Vector4ui>& MeshData3D::jointIds() const {
+    CORRADE_ASSERT(isSkinned(), "Trade::MeshData3D::jointIds(): the mesh is not skinned", _jointIds);
+    return _jointIds;
+}
+
+std::vector<Vector4>& MeshData3D::weights() {
+    CORRADE_ASSERT(isSkinned(), "Trade::MeshData3D::weights(): the mesh is not skinned", _weights);
+    return _weights;
+}
+
+const std::vector<Vector4>& MeshData3D::weights() const {
+    CORRADE_ASSERT(isSkinned(), "Trade::MeshData3D::weights(): the mesh is not skinned", _weights);
+    return _weights;
+}
+
+const Range3D& MeshData3D::boundingBox() const {
+    CORRADE_ASSERT(_boundingBox, "Trade::MeshData3D::boundingBox(): the mesh has no bounding box", *_boundingBox);
+    return *_boundingBox;
+}
+
+const std::pair<Vector3, Float>& MeshData3D::boundingSphere() const {
+    CORRADE_ASSERT(_boundingSphere, "Trade::MeshData3D::boundingSphere(): the mesh has no bounding sphere", *_boundingSphere);
+    return *_boundingSphere;
+}
+
 }}
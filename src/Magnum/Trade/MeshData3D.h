@@ -33,6 +33,8 @@
 
 #include "Magnum/Magnum.h"
 #include "Magnum/visibility.h"
+#include "Magnum/Math/Range.h"
+#include "MagnumExternal/Optional/optional.hpp"
 
 namespace Magnum { namespace Trade {
 
@@ -59,6 +61,24 @@ class MAGNUM_EXPORT MeshData3D {
          */
         explicit MeshData3D(MeshPrimitive primitive, std::vector<UnsignedInt> indices, std::vector<std::vector<Vector3>> positions, std::vector<std::vector<Vector3>> normals, std::vector<std::vector<Vector2>> textureCoords2D, const void* importerState = nullptr);
 
+        /**
+         * @brief Construct skinned mesh data
+         * @param primitive         Primitive
+         * @param indices           Index array or empty array, if the mesh is
+         *      not indexed
+         * @param positions         Position arrays. At least one position
+         *      array should be present.
+         * @param normals           Normal arrays, if present
+         * @param textureCoords2D   Two-dimensional texture coordinate arrays,
+         *      if present
+         * @param jointIds          Per-vertex IDs of up to four influencing
+         *      joints or empty array, if the mesh is not skinned
+         * @param weights           Per-vertex joint weights. Expected to have
+         *      the same size as @p jointIds.
+         * @param importerState     Importer-specific state
+         */
+        explicit MeshData3D(MeshPrimitive primitive, std::vector<UnsignedInt> indices, std::vector<std::vector<Vector3>> positions, std::vector<std::vector<Vector3>> normals, std::vector<std::vector<Vector2>> textureCoords2D, std::vector<Vector4ui> jointIds, std::vector<Vector4> weights, const void* importerState = nullptr);
+
         /** @brief Copying is not allowed */
         MeshData3D(const MeshData3D&) = delete;
 
@@ -147,6 +167,87 @@ class MAGNUM_EXPORT MeshData3D {
         std::vector<Vector2>& textureCoords2D(UnsignedInt id);
         const std::vector<Vector2>& textureCoords2D(UnsignedInt id) const; /**< @overload */
 
+        /**
+         * @brief Whether the mesh is skinned
+         *
+         * Returns `true` if the data contain joint IDs and weights.
+         */
+        bool isSkinned() const { return !_jointIds.empty(); }
+
+        /**
+         * @brief Joint IDs
+         *
+         * Indices of up to four joints influencing each vertex, meant to be
+         * used with @ref Shaders::Generic3D::JointIds. Unused joints have zero
+         * weight.
+         * @see @ref isSkinned(), @ref weights()
+         */
+        std::vector<Vector4ui>& jointIds();
+        const std::vector<Vector4ui>& jointIds() const; /**< @overload */
+
+        /**
+         * @brief Joint weights
+         *
+         * Meant to be used with @ref Shaders::Generic3D::Weights.
+         * @see @ref isSkinned(), @ref jointIds()
+         */
+        std::vector<Vector4>& weights();
+        const std::vector<Vector4>& weights() const; /**< @overload */
+
+        /**
+         * @brief Whether the mesh has a bounding box
+         *
+         * @see @ref setBoundingBox()
+         */
+        bool hasBoundingBox() const { return !!_boundingBox; }
+
+        /**
+         * @brief Bounding box
+         *
+         * Expects that the bounding box is set.
+         * @see @ref hasBoundingBox()
+         */
+        const Range3D& boundingBox() const;
+
+        /**
+         * @brief Set bounding box
+         * @return Reference to self (for method chaining)
+         *
+         * The bounding box is not updated when the positions are modified.
+         * @see @ref MeshTools::computeBoundingVolumes()
+         */
+        MeshData3D& setBoundingBox(const Range3D& box) {
+            _boundingBox = box;
+            return *this;
+        }
+
+        /**
+         * @brief Whether the mesh has a bounding sphere
+         *
+         * @see @ref setBoundingSphere()
+         */
+        bool hasBoundingSphere() const { return !!_boundingSphere; }
+
+        /**
+         * @brief Bounding sphere center and radius
+         *
+         * Expects that the bounding sphere is set.
+         * @see @ref hasBoundingSphere()
+         */
+        const std::pair<Vector3, Float>& boundingSphere() const;
+
+        /**
+         * @brief Set bounding sphere
+         * @return Reference to self (for method chaining)
+         *
+         * The bounding sphere is not updated when the positions are modified.
+         * @see @ref MeshTools::computeBoundingVolumes()
+         */
+        MeshData3D& setBoundingSphere(const Vector3& center, Float radius) {
+            _boundingSphere = std::make_pair(center, radius);
+            return *this;
+        }
+
         /**
          * @brief Importer-specific state
          *
@@ -160,6 +261,10 @@ class MAGNUM_EXPORT MeshData3D {
         std::vector<std::vector<Vector3>> _positions;
         std::vector<std::vector<Vector3>> _normals;
         std::vector<std::vector<Vector2>> _textureCoords2D;
+        std::vector<Vector4ui> _jointIds;
+        std::vector<Vector4> _weights;
+        std::optional<Range3D> _boundingBox;
+        std::optional<std::pair<Vector3, Float>> _boundingSphere;
         const void* _importerState;
 };
 
@@ -0,0 +1,159 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "PointCloudOctree.h"
+
+#include <cstring>
+#include <fstream>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/Trade/MapFile.h"
+
+namespace Magnum { namespace Trade {
+
+std::optional<PointCloudOctree> PointCloudOctree::open(const std::string& filename) {
+    const std::optional<Containers::Array<char>> data = mapFile(filename);
+    if(!data) return std::nullopt;
+
+    if(data->size() < sizeof(PointCloudOctreeHeader)) {
+        Error() << "Trade::PointCloudOctree::open(): file too short, expected at least" << sizeof(PointCloudOctreeHeader) << "bytes but got" << data->size();
+        return std::nullopt;
+    }
+
+    PointCloudOctreeHeader header;
+    std::memcpy(&header, data->data(), sizeof(PointCloudOctreeHeader));
+    if(std::strncmp(header.signature, "MGPC", 4) != 0) {
+        Error() << "Trade::PointCloudOctree::open(): invalid file signature";
+        return std::nullopt;
+    }
+    if(header.version != PointCloudOctreeVersion) {
+        Error() << "Trade::PointCloudOctree::open(): unsupported format version" << header.version;
+        return std::nullopt;
+    }
+    if(!(header.flags & PointCloudOctreeFlag::BigEndian) != !Utility::Endianness::isBigEndian()) {
+        Error() << "Trade::PointCloudOctree::open(): file endianness doesn't match the machine endianness";
+        return std::nullopt;
+    }
+
+    const std::size_t expectedSize = sizeof(PointCloudOctreeHeader) + std::size_t(header.nodeCount)*sizeof(PointCloudOctreeNode);
+    if(data->size() != expectedSize) {
+        Error() << "Trade::PointCloudOctree::open(): file size doesn't match, expected" << expectedSize << "bytes for" << header.nodeCount << "nodes but got" << data->size();
+        return std::nullopt;
+    }
+
+    /* Node spacing is computed by dividing the root spacing by two for each
+       level */
+    if(header.levelCount > 64) {
+        Error() << "Trade::PointCloudOctree::open(): invalid level count" << header.levelCount;
+        return std::nullopt;
+    }
+
+    std::string dataFilename = filename + ".data";
+    std::ifstream dataFile{dataFilename, std::ios::binary|std::ios::ate};
+    if(!dataFile) {
+        Error() << "Trade::PointCloudOctree::open(): cannot open data file" << dataFilename;
+        return std::nullopt;
+    }
+    const UnsignedLong dataSize = dataFile.tellg();
+
+    std::vector<PointCloudOctreeNode> nodes(header.nodeCount);
+    std::memcpy(nodes.data(), data->data() + sizeof(PointCloudOctreeHeader), nodes.size()*sizeof(PointCloudOctreeNode));
+
+    /* Validate the hierarchy so the nodes can be traversed without further
+       checks. Children are always after their parent, so the traversal
+       can't loop. */
+    for(std::size_t i = 0; i != nodes.size(); ++i) {
+        const PointCloudOctreeNode& node = nodes[i];
+
+        if(i ? node.parent >= i : node.parent != 0xffffffffu) {
+            Error() << "Trade::PointCloudOctree::open(): invalid parent of node" << i;
+            return std::nullopt;
+        }
+
+        if(node.level != (i ? nodes[node.parent].level + 1 : 0) || node.level >= header.levelCount) {
+            Error() << "Trade::PointCloudOctree::open(): invalid level" << UnsignedInt(node.level) << "of node" << i;
+            return std::nullopt;
+        }
+
+        UnsignedInt childCount = 0;
+        for(UnsignedInt o = 0; o != 8; ++o)
+            if(node.childMask & (1 << o)) ++childCount;
+        if(childCount && (node.firstChild <= i || node.firstChild > nodes.size() || childCount > nodes.size() - node.firstChild)) {
+            Error() << "Trade::PointCloudOctree::open(): invalid children of node" << i;
+            return std::nullopt;
+        }
+        for(UnsignedInt child = node.firstChild; child != node.firstChild + childCount; ++child) {
+            if(nodes[child].parent != i) {
+                Error() << "Trade::PointCloudOctree::open(): invalid children of node" << i;
+                return std::nullopt;
+            }
+        }
+
+        /* Written so that the file-controlled values can't overflow */
+        if(node.dataOffset > dataSize || node.dataSize > dataSize - node.dataOffset || !node.pointCount != !node.dataSize) {
+            Error() << "Trade::PointCloudOctree::open(): invalid data range of node" << i << "for" << dataSize << "byte data file";
+            return std::nullopt;
+        }
+    }
+
+    return PointCloudOctree{std::move(dataFilename), header, std::move(nodes)};
+}
+
+PointCloudOctree::PointCloudOctree(std::string&& dataFilename, const PointCloudOctreeHeader& header, std::vector<PointCloudOctreeNode>&& nodes): _dataFilename{std::move(dataFilename)}, _header(header), _nodes{std::move(nodes)} {}
+
+Range3D PointCloudOctree::bounds() const {
+    return {Vector3::from(_header.min), Vector3::from(_header.max)};
+}
+
+const PointCloudOctreeNode& PointCloudOctree::node(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _nodes.size(),
+        "Trade::PointCloudOctree::node(): index" << id << "out of range for" << _nodes.size() << "nodes", _nodes.front());
+    return _nodes[id];
+}
+
+Range3D PointCloudOctree::nodeBounds(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _nodes.size(),
+        "Trade::PointCloudOctree::nodeBounds(): index" << id << "out of range for" << _nodes.size() << "nodes", {});
+    return {Vector3::from(_nodes[id].min), Vector3::from(_nodes[id].max)};
+}
+
+Float PointCloudOctree::nodeSpacing(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _nodes.size(),
+        "Trade::PointCloudOctree::nodeSpacing(): index" << id << "out of range for" << _nodes.size() << "nodes", {});
+    return _header.spacing/Float(1ull << _nodes[id].level);
+}
+
+std::optional<Containers::Array<char>> PointCloudOctree::nodeData(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _nodes.size(),
+        "Trade::PointCloudOctree::nodeData(): index" << id << "out of range for" << _nodes.size() << "nodes", std::nullopt);
+
+    const PointCloudOctreeNode& node = _nodes[id];
+    if(!node.dataSize) return Containers::Array<char>{};
+    return mapFile(_dataFilename, node.dataOffset, node.dataSize);
+}
+
+}}
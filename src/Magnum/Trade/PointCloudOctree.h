@@ -0,0 +1,228 @@
+#ifndef Magnum_Trade_PointCloudOctree_h
+#define Magnum_Trade_PointCloudOctree_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::PointCloudOctree, struct @ref Magnum::Trade::PointCloudOctreeHeader, @ref Magnum::Trade::PointCloudOctreeNode, @ref Magnum::Trade::PointCloudOctreeVertex
+ */
+
+#include <string>
+#include <vector>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/visibility.h"
+#include "MagnumExternal/Optional/optional.hpp"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Point cloud octree file header
+
+The octree index file starts with this header, followed by @ref nodeCount
+@ref PointCloudOctreeNode entries in breadth-first order, root first, with
+children of each node stored next to each other. Point data of the nodes are
+stored in a separate data file, each node as a @ref MeshPrimitive::Points mesh
+of @ref PointCloudOctreeVertex in the format used by
+@ref MagnumMeshImporter, at an offset aligned to
+@ref PointCloudOctreeDataAlignment bytes. All values are in the endianness of
+the machine that wrote the file, see @ref PointCloudOctreeFlag::BigEndian.
+@see @ref PointCloudOctree, @ref PointCloudOctreeBuilder
+*/
+struct PointCloudOctreeHeader {
+    char            signature[4];   /**< @brief File signature, `MGPC` */
+    UnsignedByte    version;        /**< @brief Format version */
+    UnsignedByte    flags;          /**< @brief @ref PointCloudOctreeFlag values */
+    UnsignedShort   levelCount;     /**< @brief Count of octree levels */
+    UnsignedInt     nodeCount;      /**< @brief Node count */
+    Float           spacing;        /**< @brief Point spacing of the root node */
+    UnsignedLong    pointCount;     /**< @brief Total point count */
+    Float           min[3];         /**< @brief Minimal corner of the root node */
+    Float           max[3];         /**< @brief Maximal corner of the root node */
+};
+
+/**
+@brief Point cloud octree node entry
+
+Points of a node are a subsample of the points in its bounds, with the
+remaining points distributed into the children, so each point is stored in
+exactly one node and drawing a node together with any of its ancestors
+gives a denser representation of the same area.
+*/
+struct PointCloudOctreeNode {
+    UnsignedLong    dataOffset;     /**< @brief Offset of point data in the data file */
+    UnsignedLong    dataSize;       /**< @brief Size of point data, `0` if the node has no points */
+    Float           min[3];         /**< @brief Minimal corner of the node */
+    Float           max[3];         /**< @brief Maximal corner of the node */
+    UnsignedInt     pointCount;     /**< @brief Point count */
+    UnsignedInt     parent;         /**< @brief Parent node index, `0xffffffffu` for the root */
+
+    /**
+     * @brief Index of the first child
+     *
+     * The children are stored one after another in the order of the bits
+     * set in @ref childMask. Zero if the node has no children.
+     */
+    UnsignedInt     firstChild;
+
+    /**
+     * @brief Mask of present children
+     *
+     * Bit @f$ i @f$ corresponds to the octant that's in the upper half of the
+     * node in X if bit `0` of @f$ i @f$ is set, in Y if bit `1` is set and in
+     * Z if bit `2` is set.
+     */
+    UnsignedByte    childMask;
+
+    UnsignedByte    level;          /**< @brief Level, `0` for the root */
+    UnsignedShort   reserved;       /**< @brief Reserved, zero */
+};
+
+/**
+@brief Point cloud octree vertex
+
+Layout of the interleaved vertex data of all nodes. The color is normalized,
+clouds without colors are stored with white color.
+*/
+struct PointCloudOctreeVertex {
+    Vector3 position;               /**< @brief Position */
+    Color4ub color;                 /**< @brief Color */
+};
+
+/** @brief Point cloud octree header flags */
+namespace PointCloudOctreeFlag { enum: UnsignedByte {
+    BigEndian = 1 << 0      /**< The file is in big-endian */
+}; }
+
+/** @brief Current point cloud octree format version */
+constexpr UnsignedByte PointCloudOctreeVersion = 1;
+
+/** @brief Alignment of point cloud octree node data */
+constexpr std::size_t PointCloudOctreeDataAlignment = 16;
+
+static_assert(sizeof(PointCloudOctreeHeader) == 48, "PointCloudOctreeHeader size is not 48 bytes");
+static_assert(sizeof(PointCloudOctreeNode) == 56, "PointCloudOctreeNode size is not 56 bytes");
+static_assert(sizeof(PointCloudOctreeVertex) == 16, "PointCloudOctreeVertex size is not 16 bytes");
+
+/**
+@brief Point cloud octree
+
+Node hierarchy of an out-of-core point cloud produced by
+@ref PointCloudOctreeBuilder. Only the index file is read into memory, point
+data of each node are memory-mapped from the data file on demand using
+@ref nodeData(). See @ref PointCloudStreamer for drawing the cloud.
+@code
+std::optional<Trade::PointCloudOctree> octree = Trade::PointCloudOctree::open("cloud.mgoctree");
+if(!octree) return;
+
+Debug() << octree->pointCount() << "points in" << octree->nodeCount() << "nodes";
+@endcode
+@see @ref PointCloudOctreeHeader
+*/
+class MAGNUM_EXPORT PointCloudOctree {
+    public:
+        /**
+         * @brief Open an octree
+         * @param filename  Index file
+         *
+         * Node data are expected in a file with the same name and `.data`
+         * appended. If the index or data file can't be read, the index has a
+         * different format version, endianness or unexpected size, or the
+         * node hierarchy or node data ranges are inconsistent, prints message
+         * to error output and returns `std::nullopt`.
+         */
+        static std::optional<PointCloudOctree> open(const std::string& filename);
+
+        /** @brief Data file name */
+        const std::string& dataFilename() const { return _dataFilename; }
+
+        /** @brief Total point count */
+        UnsignedLong pointCount() const { return _header.pointCount; }
+
+        /** @brief Count of octree levels */
+        UnsignedInt levelCount() const { return _header.levelCount; }
+
+        /** @brief Bounds of the root node */
+        Range3D bounds() const;
+
+        /** @brief Point spacing of the root node */
+        Float spacing() const { return _header.spacing; }
+
+        /** @brief Node count */
+        UnsignedInt nodeCount() const { return _nodes.size(); }
+
+        /** @brief Node entries */
+        Containers::ArrayView<const PointCloudOctreeNode> nodes() const {
+            return {_nodes.data(), _nodes.size()};
+        }
+
+        /**
+         * @brief Node entry
+         *
+         * Expects that @p id is less than @ref nodeCount().
+         */
+        const PointCloudOctreeNode& node(UnsignedInt id) const;
+
+        /**
+         * @brief Node bounds
+         *
+         * Expects that @p id is less than @ref nodeCount().
+         */
+        Range3D nodeBounds(UnsignedInt id) const;
+
+        /**
+         * @brief Point spacing of a node
+         *
+         * Root spacing divided by two for each level. Expects that @p id is
+         * less than @ref nodeCount().
+         */
+        Float nodeSpacing(UnsignedInt id) const;
+
+        /**
+         * @brief Point data of a node
+         *
+         * Maps the node range of the data file using @ref mapFile(). The data
+         * can be imported using @ref AbstractImporter::openData() of
+         * @ref MagnumMeshImporter. Returns empty array for nodes without
+         * points, if the file can't be mapped prints message to error output
+         * and returns `std::nullopt`. Expects that @p id is less than
+         * @ref nodeCount().
+         */
+        std::optional<Containers::Array<char>> nodeData(UnsignedInt id) const;
+
+    private:
+        explicit PointCloudOctree(std::string&& dataFilename, const PointCloudOctreeHeader& header, std::vector<PointCloudOctreeNode>&& nodes);
+
+        std::string _dataFilename;
+        PointCloudOctreeHeader _header;
+        std::vector<PointCloudOctreeNode> _nodes;
+};
+
+}}
+
+#endif
@@ -0,0 +1,453 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "PointCloudOctreeBuilder.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <unordered_set>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+#include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Trade/AbstractMeshConverter.h"
+#include "Magnum/Trade/MapFile.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace Trade {
+
+namespace {
+    /* Spacing of deeper levels would be below float precision for any
+       reasonably sized cloud, such nodes keep all their points */
+    constexpr UnsignedInt MaxLevel = 24;
+
+    /* Points buffered in addPoints() are written to the chunk files once
+       there's this many of them, i.e. 64 MB */
+    constexpr UnsignedLong MaxBufferedPointCount = 4*1024*1024;
+
+    UnsignedInt octant(const Vector3& position, const Vector3& center) {
+        return (position.x() >= center.x() ? 1 : 0)|
+               (position.y() >= center.y() ? 2 : 0)|
+               (position.z() >= center.z() ? 4 : 0);
+    }
+
+    Range3D octantBounds(const Range3D& bounds, const UnsignedInt octant) {
+        const Vector3 center = bounds.center();
+        Vector3 min, max;
+        for(UnsignedInt i = 0; i != 3; ++i) {
+            const bool upper = octant & (1 << i);
+            min[i] = upper ? center[i] : bounds.min()[i];
+            max[i] = upper ? bounds.max()[i] : center[i];
+        }
+        return {min, max};
+    }
+
+    /* Octant digits of the path from the root, most significant first. The
+       bounds are always calculated by the same sequence of operations, so
+       the chunk a point is sorted into contains it exactly in the node
+       bounds as well. */
+    Range3D pathBounds(Range3D bounds, const UnsignedInt path, const UnsignedInt level) {
+        for(UnsignedInt i = level; i != 0; --i)
+            bounds = octantBounds(bounds, (path >> 3*(i - 1)) & 7);
+        return bounds;
+    }
+}
+
+struct PointCloudOctreeBuilder::Node {
+    Range3D bounds;
+    UnsignedInt level;
+    UnsignedInt pointCount;
+    Int children[8];
+    UnsignedLong dataOffset, dataSize;
+};
+
+PointCloudOctreeBuilder::PointCloudOctreeBuilder(AbstractMeshConverter& converter, std::string filename, const Range3D& bounds, const UnsignedInt nodePointCount, const UnsignedInt chunkLevel): _converter(converter), _filename{std::move(filename)}, _nodePointCount{nodePointCount}, _gridSize{1}, _chunkLevel{chunkLevel}, _nodeCount{}, _pointCount{}, _skippedPointCount{}, _bufferedPointCount{}, _finished{false}, _dataSize{} {
+    CORRADE_ASSERT(nodePointCount,
+        "Trade::PointCloudOctreeBuilder: expected non-zero node point count", );
+    CORRADE_ASSERT(chunkLevel <= 6,
+        "Trade::PointCloudOctreeBuilder: expected chunk level at most 6 but got" << chunkLevel, );
+
+    /* Extend the bounds to a cube, make it non-degenerate for single-point
+       clouds */
+    Float halfSize = bounds.size().max()*0.5f;
+    if(halfSize <= 0.0f) halfSize = 0.5f;
+    _bounds = Range3D::fromSize(bounds.center() - Vector3{halfSize}, Vector3{halfSize*2.0f});
+
+    /* At most 1024 so the grid cell index fits into 32 bits */
+    while(_gridSize < 1024 && 4*_gridSize*_gridSize <= nodePointCount)
+        _gridSize *= 2;
+
+    _chunkBuffers.resize(1 << 3*chunkLevel);
+    _chunkPointCounts.resize(1 << 3*chunkLevel);
+}
+
+PointCloudOctreeBuilder::~PointCloudOctreeBuilder() {
+    if(!_finished) removeChunks();
+}
+
+std::string PointCloudOctreeBuilder::chunkFilename(const UnsignedInt chunk) const {
+    return _filename + ".chunk" + std::to_string(chunk);
+}
+
+bool PointCloudOctreeBuilder::addPoints(const Containers::ArrayView<const Vector3> positions, const Containers::ArrayView<const Color4ub> colors) {
+    CORRADE_ASSERT(!_finished,
+        "Trade::PointCloudOctreeBuilder::addPoints(): the octree is already finished", false);
+    CORRADE_ASSERT(colors.empty() || colors.size() == positions.size(),
+        "Trade::PointCloudOctreeBuilder::addPoints(): expected" << positions.size() << "colors but got" << colors.size(), false);
+
+    for(std::size_t i = 0; i != positions.size(); ++i) {
+        const Vector3 position = positions[i];
+
+        /* Also skips NaNs */
+        if(!(position >= _bounds.min()).all() || !(position <= _bounds.max()).all()) {
+            ++_skippedPointCount;
+            continue;
+        }
+
+        UnsignedInt chunk = 0;
+        Range3D bounds = _bounds;
+        for(UnsignedInt level = 0; level != _chunkLevel; ++level) {
+            const UnsignedInt o = octant(position, bounds.center());
+            chunk = chunk*8 + o;
+            bounds = octantBounds(bounds, o);
+        }
+
+        _chunkBuffers[chunk].push_back({position, colors.empty() ? Color4ub{255} : colors[i]});
+        ++_pointCount;
+        if(++_bufferedPointCount >= MaxBufferedPointCount && !flushChunks())
+            return false;
+    }
+
+    return true;
+}
+
+bool PointCloudOctreeBuilder::flushChunks() {
+    for(std::size_t chunk = 0; chunk != _chunkBuffers.size(); ++chunk) {
+        std::vector<PointCloudOctreeVertex>& buffer = _chunkBuffers[chunk];
+        if(buffer.empty()) continue;
+
+        const std::string filename = chunkFilename(chunk);
+        std::ofstream out{filename, std::ios::binary|std::ios::app};
+        out.write(reinterpret_cast<const char*>(buffer.data()), buffer.size()*sizeof(PointCloudOctreeVertex));
+        if(!out) {
+            Error() << "Trade::PointCloudOctreeBuilder: cannot write to file" << filename;
+            return false;
+        }
+
+        _chunkPointCounts[chunk] += buffer.size();
+
+        /* Release the memory, with spatially sorted input each chunk gets
+           filled only once */
+        std::vector<PointCloudOctreeVertex>{}.swap(buffer);
+    }
+
+    _bufferedPointCount = 0;
+    return true;
+}
+
+void PointCloudOctreeBuilder::removeChunks() {
+    for(std::size_t chunk = 0; chunk != _chunkPointCounts.size(); ++chunk) {
+        if(!_chunkPointCounts[chunk]) continue;
+        Utility::Directory::rm(chunkFilename(chunk));
+        _chunkPointCounts[chunk] = 0;
+    }
+}
+
+UnsignedInt PointCloudOctreeBuilder::addNode(const Range3D& bounds, const UnsignedInt level) {
+    Node node;
+    node.bounds = bounds;
+    node.level = level;
+    node.pointCount = 0;
+    std::fill_n(node.children, 8, -1);
+    node.dataOffset = node.dataSize = 0;
+    _nodes.push_back(node);
+    return _nodes.size() - 1;
+}
+
+std::vector<PointCloudOctreeVertex> PointCloudOctreeBuilder::subsample(std::vector<PointCloudOctreeVertex>& points, const Range3D& bounds) const {
+    const Vector3 scale = Vector3{Float(_gridSize)}/bounds.size();
+    const Float maxCell = _gridSize - 1;
+
+    /* First point in each grid cell */
+    std::unordered_set<UnsignedInt> occupied;
+    std::vector<PointCloudOctreeVertex> selected, rest;
+    for(const PointCloudOctreeVertex& point: points) {
+        const Vector3ui cell{Math::clamp((point.position - bounds.min())*scale, 0.0f, maxCell)};
+        if(occupied.insert(cell.x() + _gridSize*(cell.y() + _gridSize*cell.z())).second)
+            selected.push_back(point);
+        else rest.push_back(point);
+    }
+
+    /* Volume-like clouds occupy too many cells, keep an evenly strided
+       subset of them */
+    if(selected.size() > _nodePointCount) {
+        std::vector<PointCloudOctreeVertex> kept;
+        kept.reserve(_nodePointCount);
+        for(std::size_t i = 0; i != selected.size(); ++i) {
+            if(kept.size() != _nodePointCount && i == UnsignedLong(kept.size())*selected.size()/_nodePointCount)
+                kept.push_back(selected[i]);
+            else rest.push_back(selected[i]);
+        }
+        selected = std::move(kept);
+    }
+
+    points = std::move(rest);
+    return selected;
+}
+
+Int PointCloudOctreeBuilder::buildSubtree(std::vector<PointCloudOctreeVertex>&& points, const Range3D& bounds, const UnsignedInt level, std::vector<PointCloudOctreeVertex>* const pending) {
+    const UnsignedInt id = addNode(bounds, level);
+
+    std::vector<PointCloudOctreeVertex> kept;
+    if(points.size() <= _nodePointCount || level == MaxLevel)
+        kept = std::move(points);
+    else {
+        kept = subsample(points, bounds);
+
+        std::vector<PointCloudOctreeVertex> octants[8];
+        const Vector3 center = bounds.center();
+        for(const PointCloudOctreeVertex& point: points)
+            octants[octant(point.position, center)].push_back(point);
+        std::vector<PointCloudOctreeVertex>{}.swap(points);
+
+        for(UnsignedInt o = 0; o != 8; ++o) {
+            if(octants[o].empty()) continue;
+            const Int child = buildSubtree(std::move(octants[o]), octantBounds(bounds, o), level + 1, nullptr);
+            if(child == -1) return -1;
+            _nodes[id].children[o] = child;
+        }
+    }
+
+    if(pending) *pending = std::move(kept);
+    else if(!writeNode(id, kept)) return -1;
+    return id;
+}
+
+bool PointCloudOctreeBuilder::writeNode(const UnsignedInt id, const std::vector<PointCloudOctreeVertex>& points) {
+    _nodes[id].pointCount = points.size();
+    if(points.empty()) return true;
+
+    const MeshData mesh{MeshPrimitive::Points,
+        Containers::ArrayView<const char>{reinterpret_cast<const char*>(points.data()), points.size()*sizeof(PointCloudOctreeVertex)}, {
+            MeshAttributeData{MeshAttribute::Position, MeshAttributeType::Float, 3, 0, sizeof(PointCloudOctreeVertex)},
+            MeshAttributeData{MeshAttribute::Color, MeshAttributeType::UnsignedByte, 4, sizeof(Vector3), sizeof(PointCloudOctreeVertex), true}
+        }, UnsignedInt(points.size())};
+    const Containers::Array<char> data = _converter.exportToData(mesh);
+    if(!data) {
+        Error() << "Trade::PointCloudOctreeBuilder::finish(): cannot convert node data";
+        return false;
+    }
+
+    /* Pad the previous node data to the alignment */
+    const UnsignedLong offset = (_dataSize + PointCloudOctreeDataAlignment - 1)/PointCloudOctreeDataAlignment*PointCloudOctreeDataAlignment;
+    constexpr char padding[PointCloudOctreeDataAlignment]{};
+    _data->write(padding, offset - _dataSize);
+    _data->write(data, data.size());
+    if(!*_data) {
+        Error() << "Trade::PointCloudOctreeBuilder::finish(): cannot write to file" << _filename + ".data";
+        return false;
+    }
+
+    _nodes[id].dataOffset = offset;
+    _nodes[id].dataSize = data.size();
+    _dataSize = offset + data.size();
+    return true;
+}
+
+bool PointCloudOctreeBuilder::finish() {
+    CORRADE_ASSERT(!_finished,
+        "Trade::PointCloudOctreeBuilder::finish(): the octree is already finished", false);
+    _finished = true;
+
+    if(!flushChunks()) {
+        removeChunks();
+        return false;
+    }
+
+    const std::string dataFilename = _filename + ".data";
+    _data.reset(new std::ofstream{dataFilename, std::ios::binary|std::ios::trunc});
+    if(!*_data) {
+        Error() << "Trade::PointCloudOctreeBuilder::finish(): cannot open file" << dataFilename;
+        removeChunks();
+        return false;
+    }
+
+    /* Build subtrees of all chunks one after another. Points of the chunk
+       roots are kept in memory for building the levels above. A chunk file
+       is deleted right after it's read so the disk usage doesn't double. */
+    std::vector<std::pair<UnsignedInt, Int>> level;
+    std::vector<std::vector<PointCloudOctreeVertex>> pending;
+    for(UnsignedInt chunk = 0; chunk != _chunkPointCounts.size(); ++chunk) {
+        if(!_chunkPointCounts[chunk]) continue;
+
+        std::vector<PointCloudOctreeVertex> points;
+        {
+            const std::optional<Containers::Array<char>> data = mapFile(chunkFilename(chunk));
+            if(!data) {
+                removeChunks();
+                return false;
+            }
+            points.resize(data->size()/sizeof(PointCloudOctreeVertex));
+            std::memcpy(points.data(), data->data(), points.size()*sizeof(PointCloudOctreeVertex));
+        }
+        Utility::Directory::rm(chunkFilename(chunk));
+        _chunkPointCounts[chunk] = 0;
+
+        pending.emplace_back();
+        const Int id = buildSubtree(std::move(points), pathBounds(_bounds, chunk, _chunkLevel), _chunkLevel, &pending.back());
+        if(id == -1) {
+            removeChunks();
+            return false;
+        }
+        level.emplace_back(chunk, id);
+    }
+
+    /* Build the levels above the chunks bottom-up. Nodes on each level are
+       sorted by their path, so children of one parent are next to each
+       other. */
+    for(UnsignedInt l = _chunkLevel; l != 0; --l) {
+        std::vector<std::pair<UnsignedInt, Int>> parentLevel;
+        std::vector<std::vector<PointCloudOctreeVertex>> parentPending;
+        for(std::size_t i = 0; i != level.size(); ) {
+            const UnsignedInt path = level[i].first >> 3;
+            const Range3D bounds = pathBounds(_bounds, path, l - 1);
+            const UnsignedInt parent = addNode(bounds, l - 1);
+
+            std::size_t end = i;
+            std::vector<PointCloudOctreeVertex> points;
+            for(; end != level.size() && level[end].first >> 3 == path; ++end) {
+                points.insert(points.end(), pending[end].begin(), pending[end].end());
+                std::vector<PointCloudOctreeVertex>{}.swap(pending[end]);
+            }
+
+            /* Move a subsample to the parent, return the rest to the
+               children */
+            std::vector<PointCloudOctreeVertex> kept = subsample(points, bounds);
+            std::vector<PointCloudOctreeVertex> octants[8];
+            const Vector3 center = bounds.center();
+            for(const PointCloudOctreeVertex& point: points)
+                octants[octant(point.position, center)].push_back(point);
+
+            for(std::size_t j = i; j != end; ++j) {
+                const UnsignedInt o = level[j].first & 7;
+                const Int child = level[j].second;
+                if(!writeNode(child, octants[o])) {
+                    removeChunks();
+                    return false;
+                }
+
+                /* Drop children that ended up empty */
+                if(octants[o].empty() && std::all_of(_nodes[child].children, _nodes[child].children + 8, [](Int id) { return id == -1; }))
+                    continue;
+                _nodes[parent].children[o] = child;
+            }
+
+            parentLevel.emplace_back(path, parent);
+            parentPending.push_back(std::move(kept));
+            i = end;
+        }
+
+        level = std::move(parentLevel);
+        pending = std::move(parentPending);
+    }
+
+    /* Write the root, create an empty one if there are no points at all */
+    if(level.empty()) {
+        level.emplace_back(0, addNode(_bounds, 0));
+        pending.emplace_back();
+    }
+    const Int root = level.front().second;
+    if(!writeNode(root, pending.front())) return false;
+
+    _data->close();
+    if(!*_data) {
+        Error() << "Trade::PointCloudOctreeBuilder::finish(): cannot write to file" << dataFilename;
+        return false;
+    }
+    _data = nullptr;
+
+    /* Flatten the hierarchy in breadth-first order, with children of each
+       node next to each other */
+    std::vector<Int> order{root};
+    std::vector<UnsignedInt> parents{~UnsignedInt{}};
+    std::vector<PointCloudOctreeNode> nodes;
+    UnsignedInt levelCount = 0;
+    for(std::size_t i = 0; i != order.size(); ++i) {
+        const Node& node = _nodes[order[i]];
+
+        PointCloudOctreeNode entry{};
+        entry.dataOffset = node.dataOffset;
+        entry.dataSize = node.dataSize;
+        for(UnsignedInt j = 0; j != 3; ++j) {
+            entry.min[j] = node.bounds.min()[j];
+            entry.max[j] = node.bounds.max()[j];
+        }
+        entry.pointCount = node.pointCount;
+        entry.parent = parents[i];
+        entry.level = node.level;
+        levelCount = Math::max(levelCount, node.level + 1);
+
+        for(UnsignedInt o = 0; o != 8; ++o) {
+            if(node.children[o] == -1) continue;
+            if(!entry.childMask) entry.firstChild = order.size();
+            entry.childMask |= 1 << o;
+            order.push_back(node.children[o]);
+            parents.push_back(i);
+        }
+
+        nodes.push_back(entry);
+    }
+
+    Containers::Array<char> data{Containers::ValueInit, sizeof(PointCloudOctreeHeader) + nodes.size()*sizeof(PointCloudOctreeNode)};
+    PointCloudOctreeHeader& header = *reinterpret_cast<PointCloudOctreeHeader*>(data.data());
+    std::memcpy(header.signature, "MGPC", 4);
+    header.version = PointCloudOctreeVersion;
+    header.flags = Utility::Endianness::isBigEndian() ? PointCloudOctreeFlag::BigEndian : 0;
+    header.levelCount = levelCount;
+    header.nodeCount = nodes.size();
+    header.spacing = _bounds.sizeX()/Float(_gridSize);
+    header.pointCount = _pointCount;
+    for(UnsignedInt j = 0; j != 3; ++j) {
+        header.min[j] = _bounds.min()[j];
+        header.max[j] = _bounds.max()[j];
+    }
+    std::memcpy(data + sizeof(PointCloudOctreeHeader), nodes.data(), nodes.size()*sizeof(PointCloudOctreeNode));
+
+    if(!Utility::Directory::write(_filename, data)) {
+        Error() << "Trade::PointCloudOctreeBuilder::finish(): cannot write to file" << _filename;
+        return false;
+    }
+
+    _nodeCount = nodes.size();
+    std::vector<Node>{}.swap(_nodes);
+    return true;
+}
+
+}}
@@ -0,0 +1,214 @@
+#ifndef Magnum_Trade_PointCloudOctreeBuilder_h
+#define Magnum_Trade_PointCloudOctreeBuilder_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::PointCloudOctreeBuilder
+ */
+
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Trade/PointCloudOctree.h"
+#include "Magnum/Trade/Trade.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Out-of-core point cloud octree builder
+
+Builds a @ref PointCloudOctree from point clouds that don't fit into memory.
+Points are added in batches of arbitrary size with @ref addPoints() and the
+octree is written to disk in @ref finish(), with node data serialized with
+given @ref AbstractMeshConverter, usually @ref MagnumMeshConverter:
+@code
+PluginManager::Manager<Trade::AbstractMeshConverter> manager{MAGNUM_PLUGINS_MESHCONVERTER_DIR};
+std::unique_ptr<Trade::AbstractMeshConverter> converter = manager.loadAndInstantiate("MagnumMeshConverter");
+
+Trade::PointCloudOctreeBuilder builder{*converter, "cloud.mgoctree", bounds};
+while(...) builder.addPoints(positions, colors);
+if(!builder.finish()) return;
+@endcode
+
+The @ref magnum-pointcloudconverter "magnum-pointcloudconverter" utility
+builds the octree from point cloud meshes supported by any importer plugin.
+
+@anchor Trade-PointCloudOctreeBuilder-algorithm
+## Algorithm
+
+The bounds are first extended to a cube, which is the root node. Added
+points are sorted into @f$ 8^c @f$ chunks, where @f$ c @f$ is
+@ref chunkLevel(), and appended to a temporary file per chunk, so only a
+limited amount of points is held in memory at any time. In @ref finish() the
+chunks are then processed one by one in memory, which means a single chunk is
+expected to fit into memory. A node keeps all points if there's at most
+@ref nodePointCount() of them, otherwise it keeps the first point in each cell
+of a grid with @ref nodeGridSize() cells along each axis, at most
+@ref nodePointCount() of them, and distributes the remaining points into its
+eight children. The point spacing of the node is then size of the grid cell.
+Levels above the chunks are built bottom-up by subsampling the points of
+their children the same way and moving them to the parent. Each point is
+thus stored in exactly one node and coarser levels go into the nodes closer
+to the root.
+
+After all nodes are written, the node index is written to the output file and
+the temporary chunk files are deleted. The node data are in a file with the
+same name as the output and `.data` appended.
+*/
+class MAGNUM_EXPORT PointCloudOctreeBuilder {
+    public:
+        /**
+         * @brief Constructor
+         * @param converter     Converter used for serializing the node data
+         * @param filename      Output index file
+         * @param bounds        Bounds of all points
+         * @param nodePointCount Max point count in a leaf node
+         * @param chunkLevel    Octree level at which the points are split
+         *      into chunks processed separately
+         *
+         * The @p converter is expected to support
+         * @ref AbstractMeshConverter::Feature::ConvertData and has to stay
+         * alive until @ref finish(). Points outside of @p bounds are skipped
+         * in @ref addPoints(). Expects that @p nodePointCount is not zero and
+         * @p chunkLevel is at most `6`. The temporary chunk files are stored
+         * next to the output file.
+         */
+        explicit PointCloudOctreeBuilder(AbstractMeshConverter& converter, std::string filename, const Range3D& bounds, UnsignedInt nodePointCount = 20000, UnsignedInt chunkLevel = 3);
+
+        /** @brief Copying is not allowed */
+        PointCloudOctreeBuilder(const PointCloudOctreeBuilder&) = delete;
+
+        /** @brief Moving is not allowed */
+        PointCloudOctreeBuilder(PointCloudOctreeBuilder&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Deletes the temporary chunk files if @ref finish() wasn't called.
+         */
+        ~PointCloudOctreeBuilder();
+
+        /** @brief Copying is not allowed */
+        PointCloudOctreeBuilder& operator=(const PointCloudOctreeBuilder&) = delete;
+
+        /** @brief Moving is not allowed */
+        PointCloudOctreeBuilder& operator=(PointCloudOctreeBuilder&&) = delete;
+
+        /** @brief Output index file */
+        const std::string& filename() const { return _filename; }
+
+        /**
+         * @brief Bounds of the root node
+         *
+         * The bounds passed to the constructor extended to a cube around
+         * their center.
+         */
+        Range3D bounds() const { return _bounds; }
+
+        /** @brief Max point count in a leaf node */
+        UnsignedInt nodePointCount() const { return _nodePointCount; }
+
+        /**
+         * @brief Node subsampling grid size
+         *
+         * Largest power of two with square not larger than
+         * @ref nodePointCount(), so nodes of a surface-like cloud get about
+         * @ref nodePointCount() points.
+         */
+        UnsignedInt nodeGridSize() const { return _gridSize; }
+
+        /** @brief Chunk level */
+        UnsignedInt chunkLevel() const { return _chunkLevel; }
+
+        /** @brief Count of points added so far */
+        UnsignedLong pointCount() const { return _pointCount; }
+
+        /** @brief Count of points outside of @ref bounds() skipped so far */
+        UnsignedLong skippedPointCount() const { return _skippedPointCount; }
+
+        /**
+         * @brief Node count
+         *
+         * Available after a successful @ref finish(), `0` before.
+         */
+        UnsignedInt nodeCount() const { return _nodeCount; }
+
+        /**
+         * @brief Add points
+         * @param positions     Point positions
+         * @param colors        Point colors. If empty, the points are white.
+         *
+         * Expects that @p colors is either empty or has the same size as
+         * @p positions and that @ref finish() wasn't called yet. If the
+         * points can't be written to the temporary chunk files, prints
+         * message to error output and returns `false`.
+         */
+        bool addPoints(Containers::ArrayView<const Vector3> positions, Containers::ArrayView<const Color4ub> colors = nullptr);
+
+        /**
+         * @brief Build and write the octree
+         *
+         * See @ref Trade-PointCloudOctreeBuilder-algorithm "class documentation"
+         * for more information. Expects that it wasn't called yet. If
+         * writing any file or converting any node fails, prints message to
+         * error output and returns `false`.
+         */
+        bool finish();
+
+    private:
+        struct Node;
+
+        MAGNUM_LOCAL std::string chunkFilename(UnsignedInt chunk) const;
+        MAGNUM_LOCAL bool flushChunks();
+        MAGNUM_LOCAL void removeChunks();
+        MAGNUM_LOCAL UnsignedInt addNode(const Range3D& bounds, UnsignedInt level);
+        MAGNUM_LOCAL std::vector<PointCloudOctreeVertex> subsample(std::vector<PointCloudOctreeVertex>& points, const Range3D& bounds) const;
+        MAGNUM_LOCAL Int buildSubtree(std::vector<PointCloudOctreeVertex>&& points, const Range3D& bounds, UnsignedInt level, std::vector<PointCloudOctreeVertex>* pending);
+        MAGNUM_LOCAL bool writeNode(UnsignedInt id, const std::vector<PointCloudOctreeVertex>& points);
+
+        AbstractMeshConverter& _converter;
+        std::string _filename;
+        Range3D _bounds;
+        UnsignedInt _nodePointCount, _gridSize, _chunkLevel, _nodeCount;
+        UnsignedLong _pointCount, _skippedPointCount, _bufferedPointCount;
+        bool _finished;
+
+        std::vector<std::vector<PointCloudOctreeVertex>> _chunkBuffers;
+        std::vector<UnsignedLong> _chunkPointCounts;
+        std::vector<Node> _nodes;
+        std::unique_ptr<std::ofstream> _data;
+        UnsignedLong _dataSize;
+};
+
+}}
+
+#endif
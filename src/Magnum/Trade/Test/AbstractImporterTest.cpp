@@ -23,11 +23,20 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstring>
+#include <sstream>
 #include <Corrade/Containers/ArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/Utility/Directory.h>
 
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector4.h"
 #include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/FlatSceneData3D.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "Magnum/Trade/MeshObjectData3D.h"
+#include "Magnum/Trade/SceneData.h"
 
 #include "configure.h"
 
@@ -38,10 +47,20 @@ class AbstractImporterTest: public TestSuite::Tester {
         explicit AbstractImporterTest();
 
         void openFile();
+        void meshFromMesh3D();
+        void meshFromMesh3DNonIndexed();
+        void meshFromMesh3DSkinned();
+        void flatScene3DFromObjects();
+        void flatScene3DCycle();
 };
 
 AbstractImporterTest::AbstractImporterTest() {
-    addTests({&AbstractImporterTest::openFile});
+    addTests({&AbstractImporterTest::openFile,
+              &AbstractImporterTest::meshFromMesh3D,
+              &AbstractImporterTest::meshFromMesh3DNonIndexed,
+              &AbstractImporterTest::meshFromMesh3DSkinned,
+              &AbstractImporterTest::flatScene3DFromObjects,
+              &AbstractImporterTest::flatScene3DCycle});
 }
 
 void AbstractImporterTest::openFile() {
@@ -68,6 +87,185 @@ void AbstractImporterTest::openFile() {
     CORRADE_VERIFY(importer.isOpened());
 }
 
+namespace {
+
+class Mesh3DImporter: public Trade::AbstractImporter {
+    public:
+        explicit Mesh3DImporter(bool indexed): _indexed{indexed} {}
+
+    private:
+        Features doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMesh3DCount() const override { return 1; }
+        std::optional<MeshData3D> doMesh3D(UnsignedInt) override {
+            return MeshData3D{MeshPrimitive::Triangles,
+                _indexed ? std::vector<UnsignedInt>{2, 0, 1, 300} : std::vector<UnsignedInt>{},
+                {{{0.5f, 1.0f, 0.1f}, {-1.0f, 0.3f, -1.0f}}},
+                {{{0.0f, 1.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}}},
+                {{{0.3f, 0.7f}, {0.1f, 0.2f}}},
+                this};
+        }
+
+        bool _indexed;
+};
+
+}
+
+void AbstractImporterTest::meshFromMesh3D() {
+    Mesh3DImporter importer{true};
+    std::optional<MeshData> mesh = importer.mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(mesh->importerState(), &importer);
+
+    /* 300 doesn't fit into a byte */
+    CORRADE_VERIFY(mesh->isIndexed());
+    CORRADE_COMPARE(mesh->indexType(), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE(mesh->indexCount(), 4);
+    const UnsignedShort* indices = reinterpret_cast<const UnsignedShort*>(mesh->indexData().data());
+    CORRADE_COMPARE(indices[0], 2);
+    CORRADE_COMPARE(indices[3], 300);
+
+    CORRADE_COMPARE(mesh->vertexCount(), 2);
+    CORRADE_COMPARE(mesh->attributeCount(), 3);
+    CORRADE_COMPARE(mesh->vertexData().size(), 2*32);
+
+    const MeshAttributeData& normals = mesh->attribute(MeshAttribute::Normal);
+    CORRADE_COMPARE(normals.type(), MeshAttributeType::Float);
+    CORRADE_COMPARE(normals.components(), 3);
+    CORRADE_COMPARE(normals.offset(), 12);
+    CORRADE_COMPARE(normals.stride(), 32);
+
+    const MeshAttributeData& textureCoordinates = mesh->attribute(MeshAttribute::TextureCoordinates);
+    CORRADE_COMPARE(textureCoordinates.components(), 2);
+    CORRADE_COMPARE(textureCoordinates.offset(), 24);
+    CORRADE_COMPARE(textureCoordinates.stride(), 32);
+
+    Vector3 position;
+    std::memcpy(&position, mesh->vertexData().data() + 32, sizeof(Vector3));
+    CORRADE_COMPARE(position, (Vector3{-1.0f, 0.3f, -1.0f}));
+    Vector2 textureCoordinate;
+    std::memcpy(&textureCoordinate, mesh->vertexData().data() + 32 + 24, sizeof(Vector2));
+    CORRADE_COMPARE(textureCoordinate, (Vector2{0.1f, 0.2f}));
+}
+
+void AbstractImporterTest::meshFromMesh3DNonIndexed() {
+    Mesh3DImporter importer{false};
+    std::optional<MeshData> mesh = importer.mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_VERIFY(!mesh->isIndexed());
+    CORRADE_COMPARE(mesh->indexCount(), 0);
+    CORRADE_COMPARE(mesh->vertexCount(), 2);
+}
+
+void AbstractImporterTest::meshFromMesh3DSkinned() {
+    class SkinnedMesh3DImporter: public Trade::AbstractImporter {
+        private:
+            Features doFeatures() const override { return {}; }
+            bool doIsOpened() const override { return true; }
+            void doClose() override {}
+
+            UnsignedInt doMesh3DCount() const override { return 1; }
+            std::optional<MeshData3D> doMesh3D(UnsignedInt) override {
+                return MeshData3D{MeshPrimitive::Points, {},
+                    {{{0.5f, 1.0f, 0.1f}, {-1.0f, 0.3f, -1.0f}}}, {}, {},
+                    {{0, 1, 0, 0}, {3, 2, 1, 0}},
+                    {{0.75f, 0.25f, 0.0f, 0.0f}, {0.5f, 0.25f, 0.25f, 0.0f}}};
+            }
+    };
+
+    SkinnedMesh3DImporter importer;
+    std::optional<MeshData> mesh = importer.mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->attributeCount(), 3);
+    CORRADE_COMPARE(mesh->vertexData().size(), 2*44);
+
+    const MeshAttributeData& jointIds = mesh->attribute(MeshAttribute::JointIds);
+    CORRADE_COMPARE(jointIds.type(), MeshAttributeType::UnsignedInt);
+    CORRADE_COMPARE(jointIds.components(), 4);
+    CORRADE_COMPARE(jointIds.offset(), 12);
+    CORRADE_COMPARE(jointIds.stride(), 44);
+
+    const MeshAttributeData& weights = mesh->attribute(MeshAttribute::Weights);
+    CORRADE_COMPARE(weights.type(), MeshAttributeType::Float);
+    CORRADE_COMPARE(weights.components(), 4);
+    CORRADE_COMPARE(weights.offset(), 28);
+    CORRADE_COMPARE(weights.stride(), 44);
+
+    Vector4ui jointId;
+    std::memcpy(&jointId, mesh->vertexData().data() + 44 + 12, sizeof(Vector4ui));
+    CORRADE_COMPARE(jointId, (Vector4ui{3, 2, 1, 0}));
+    Vector4 weight;
+    std::memcpy(&weight, mesh->vertexData().data() + 44 + 28, sizeof(Vector4));
+    CORRADE_COMPARE(weight, (Vector4{0.5f, 0.25f, 0.25f, 0.0f}));
+}
+
+namespace {
+
+/* Object 2 has children 0 and 3, object 0 has child 4, object 1 is not part
+   of the scene */
+class HierarchyImporter: public Trade::AbstractImporter {
+    public:
+        explicit HierarchyImporter(bool cycle = false): _cycle{cycle} {}
+
+    private:
+        Features doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doSceneCount() const override { return 1; }
+        std::optional<SceneData> doScene(UnsignedInt) override {
+            return SceneData{{}, {2, 5}};
+        }
+
+        UnsignedInt doObject3DCount() const override { return 6; }
+        std::unique_ptr<ObjectData3D> doObject3D(UnsignedInt id) override {
+            switch(id) {
+                case 0: return std::unique_ptr<ObjectData3D>{new MeshObjectData3D{{4}, Matrix4::translation(Vector3::yAxis()), 7, 3}};
+                case 2: return std::unique_ptr<ObjectData3D>{new ObjectData3D{{0, 3}, Matrix4::scaling(Vector3{2.0f})}};
+                case 3: return std::unique_ptr<ObjectData3D>{new ObjectData3D{{}, {}, ObjectInstanceType3D::Camera, 1}};
+                case 4: return std::unique_ptr<ObjectData3D>{new ObjectData3D{_cycle ? std::vector<UnsignedInt>{2} : std::vector<UnsignedInt>{}, {}}};
+                case 5: return std::unique_ptr<ObjectData3D>{new ObjectData3D{{}, Matrix4::translation(Vector3::zAxis())}};
+            }
+
+            return nullptr;
+        }
+
+        bool _cycle;
+};
+
+}
+
+void AbstractImporterTest::flatScene3DFromObjects() {
+    HierarchyImporter importer;
+    std::optional<FlatSceneData3D> scene = importer.flatScene3D(0);
+    CORRADE_VERIFY(scene);
+
+    /* Depth-first order, children in the same order as in the file */
+    CORRADE_COMPARE(scene->objects(), (std::vector<UnsignedInt>{2, 0, 4, 3, 5}));
+    CORRADE_COMPARE(scene->parents(), (std::vector<Int>{-1, 0, 1, 0, -1}));
+    CORRADE_COMPARE(scene->transformations()[0], Matrix4::scaling(Vector3{2.0f}));
+    CORRADE_COMPARE(scene->transformations()[1], Matrix4::translation(Vector3::yAxis()));
+    CORRADE_COMPARE(scene->transformations()[4], Matrix4::translation(Vector3::zAxis()));
+    CORRADE_COMPARE(scene->instanceTypes(), (std::vector<ObjectInstanceType3D>{
+        ObjectInstanceType3D::Empty, ObjectInstanceType3D::Mesh,
+        ObjectInstanceType3D::Empty, ObjectInstanceType3D::Camera,
+        ObjectInstanceType3D::Empty}));
+    CORRADE_COMPARE(scene->instances(), (std::vector<Int>{-1, 7, -1, 1, -1}));
+    CORRADE_COMPARE(scene->materials(), (std::vector<Int>{-1, 3, -1, -1, -1}));
+}
+
+void AbstractImporterTest::flatScene3DCycle() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    HierarchyImporter importer{true};
+    CORRADE_VERIFY(!importer.flatScene3D(0));
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::flatScene3D(): object 2 is out of range or referenced more than once\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::AbstractImporterTest)
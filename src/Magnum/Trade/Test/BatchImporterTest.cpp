@@ -0,0 +1,181 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <atomic>
+#include <sstream>
+#include <thread>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Trade/BatchImporter.h"
+#include "Magnum/Trade/ImageData.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+struct BatchImporterTest: TestSuite::Tester {
+    explicit BatchImporterTest();
+
+    void threadSafe();
+    void notThreadSafe();
+    void failed();
+    void noImporter();
+};
+
+BatchImporterTest::BatchImporterTest() {
+    addTests({&BatchImporterTest::threadSafe,
+              &BatchImporterTest::notThreadSafe,
+              &BatchImporterTest::failed,
+              &BatchImporterTest::noImporter});
+}
+
+namespace {
+
+/* Opens files named by image width, counts how many decode at once */
+class WidthImporter: public Trade::AbstractImporter {
+    public:
+        explicit WidthImporter(bool threadSafe, std::atomic<Int>& active, std::atomic<Int>& maxActive): _threadSafe{threadSafe}, _active(active), _maxActive(maxActive), _width{} {}
+
+    private:
+        Features doFeatures() const override {
+            return _threadSafe ? Feature::ThreadSafeInstances : Features{};
+        }
+        bool doIsOpened() const override { return _width; }
+        void doClose() override { _width = 0; }
+
+        void doOpenFile(const std::string& filename) override {
+            _width = std::stoi(filename);
+        }
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+        std::optional<ImageData2D> doImage2D(UnsignedInt) override {
+            const Int active = ++_active;
+            Int max = _maxActive;
+            while(active > max && !_maxActive.compare_exchange_weak(max, active)) {}
+            std::this_thread::sleep_for(std::chrono::milliseconds{2});
+            --_active;
+            /* Rows are four-byte aligned by default */
+            return ImageData2D{PixelFormat::Red, PixelType::UnsignedByte, {_width, 1}, Containers::Array<char>{std::size_t((_width + 3)/4*4)}};
+        }
+
+        bool _threadSafe;
+        std::atomic<Int>& _active;
+        std::atomic<Int>& _maxActive;
+        Int _width;
+};
+
+}
+
+void BatchImporterTest::threadSafe() {
+    TaskScheduler scheduler{4};
+    std::atomic<Int> active{0}, maxActive{0};
+    BatchImporter importer{scheduler, [&]() {
+        return std::unique_ptr<AbstractImporter>{new WidthImporter{true, active, maxActive}};
+    }};
+    CORRADE_COMPARE(importer.importerCount(), 4);
+
+    std::vector<Int> widths(32);
+    const std::thread::id mainThread = std::this_thread::get_id();
+    bool allOnMainThread = true;
+    for(std::size_t i = 0; i != widths.size(); ++i)
+        importer.loadImage2D(std::to_string(i + 1), [&, i](std::optional<ImageData2D> image) {
+            if(std::this_thread::get_id() != mainThread) allOnMainThread = false;
+            widths[i] = image ? image->size().x() : -1;
+        });
+    importer.wait();
+
+    CORRADE_VERIFY(allOnMainThread);
+    for(std::size_t i = 0; i != widths.size(); ++i)
+        CORRADE_COMPARE(widths[i], i + 1);
+    CORRADE_VERIFY(maxActive <= 4);
+}
+
+void BatchImporterTest::notThreadSafe() {
+    TaskScheduler scheduler{4};
+    std::atomic<Int> active{0}, maxActive{0};
+    Int instanceCount = 0;
+    BatchImporter importer{scheduler, [&]() {
+        ++instanceCount;
+        return std::unique_ptr<AbstractImporter>{new WidthImporter{false, active, maxActive}};
+    }};
+    CORRADE_COMPARE(importer.importerCount(), 1);
+    CORRADE_COMPARE(instanceCount, 1);
+
+    std::vector<Int> widths(16);
+    for(std::size_t i = 0; i != widths.size(); ++i)
+        importer.loadImage2D(std::to_string(i + 1), [&, i](std::optional<ImageData2D> image) {
+            widths[i] = image ? image->size().x() : -1;
+        });
+    importer.wait();
+
+    for(std::size_t i = 0; i != widths.size(); ++i)
+        CORRADE_COMPARE(widths[i], i + 1);
+    CORRADE_COMPARE(Int(maxActive), 1);
+}
+
+void BatchImporterTest::failed() {
+    TaskScheduler scheduler{2};
+    std::atomic<Int> active{0}, maxActive{0};
+    BatchImporter importer{scheduler, [&]() {
+        return std::unique_ptr<AbstractImporter>{new WidthImporter{true, active, maxActive}};
+    }};
+
+    /* Width 0 means the file fails to open, second image is out of range */
+    std::ostringstream out;
+    Int opened = -1, outOfRange = -1;
+    {
+        Error redirectError{&out};
+        importer.loadImage2D("0", [&](std::optional<ImageData2D> image) {
+            opened = !!image;
+        });
+        importer.loadImage2D("3", [&](std::optional<ImageData2D> image) {
+            outOfRange = !!image;
+        }, 1);
+        importer.wait();
+    }
+
+    CORRADE_COMPARE(opened, 0);
+    CORRADE_COMPARE(outOfRange, 0);
+    CORRADE_COMPARE(out.str(), "Trade::BatchImporter::loadImage2D(): image 1 out of range for 1 images\n");
+}
+
+void BatchImporterTest::noImporter() {
+    TaskScheduler scheduler{2};
+    BatchImporter importer{scheduler, []() {
+        return std::unique_ptr<AbstractImporter>{};
+    }};
+    CORRADE_COMPARE(importer.importerCount(), 0);
+
+    Int loaded = -1;
+    importer.loadImage2D("1", [&](std::optional<ImageData2D> image) {
+        loaded = !!image;
+    });
+    importer.wait();
+    CORRADE_COMPARE(loaded, 0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::BatchImporterTest)
@@ -0,0 +1,93 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Trade/FlatSceneData3D.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+struct FlatSceneData3DTest: TestSuite::Tester {
+    explicit FlatSceneData3DTest();
+
+    void construct();
+    void constructCopy();
+    void constructMove();
+};
+
+FlatSceneData3DTest::FlatSceneData3DTest() {
+    addTests({&FlatSceneData3DTest::construct,
+              &FlatSceneData3DTest::constructCopy,
+              &FlatSceneData3DTest::constructMove});
+}
+
+void FlatSceneData3DTest::construct() {
+    const int a{};
+    const FlatSceneData3D data{{3, 0, 1},
+        {-1, 0, -1},
+        {Matrix4::translation(Vector3::xAxis()), Matrix4{}, Matrix4::scaling(Vector3{2.0f})},
+        {ObjectInstanceType3D::Mesh, ObjectInstanceType3D::Empty, ObjectInstanceType3D::Camera},
+        {5, -1, 0},
+        {2, -1, -1}, &a};
+
+    CORRADE_COMPARE(data.objectCount(), 3);
+    CORRADE_COMPARE(data.objects(), (std::vector<UnsignedInt>{3, 0, 1}));
+    CORRADE_COMPARE(data.parents(), (std::vector<Int>{-1, 0, -1}));
+    CORRADE_COMPARE(data.transformations()[0], Matrix4::translation(Vector3::xAxis()));
+    CORRADE_COMPARE(data.transformations()[2], Matrix4::scaling(Vector3{2.0f}));
+    CORRADE_COMPARE(data.instanceTypes()[2], ObjectInstanceType3D::Camera);
+    CORRADE_COMPARE(data.instances(), (std::vector<Int>{5, -1, 0}));
+    CORRADE_COMPARE(data.materials(), (std::vector<Int>{2, -1, -1}));
+    CORRADE_COMPARE(data.importerState(), &a);
+}
+
+void FlatSceneData3DTest::constructCopy() {
+    CORRADE_VERIFY(!(std::is_constructible<FlatSceneData3D, const FlatSceneData3D&>{}));
+    CORRADE_VERIFY(!(std::is_assignable<FlatSceneData3D, const FlatSceneData3D&>{}));
+}
+
+void FlatSceneData3DTest::constructMove() {
+    const int a{};
+    FlatSceneData3D data{{3, 0}, {-1, 0}, {Matrix4{}, Matrix4{}},
+        {ObjectInstanceType3D::Mesh, ObjectInstanceType3D::Empty},
+        {5, -1}, {2, -1}, &a};
+
+    FlatSceneData3D b{std::move(data)};
+
+    CORRADE_COMPARE(b.objects(), (std::vector<UnsignedInt>{3, 0}));
+    CORRADE_COMPARE(b.parents(), (std::vector<Int>{-1, 0}));
+    CORRADE_COMPARE(b.importerState(), &a);
+
+    const int c{};
+    FlatSceneData3D d{{}, {}, {}, {}, {}, {}, &c};
+    d = std::move(b);
+
+    CORRADE_COMPARE(d.objects(), (std::vector<UnsignedInt>{3, 0}));
+    CORRADE_COMPARE(d.instances(), (std::vector<Int>{5, -1}));
+    CORRADE_COMPARE(d.importerState(), &a);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::FlatSceneData3DTest)
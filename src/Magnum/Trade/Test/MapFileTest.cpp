@@ -0,0 +1,110 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/Trade/MapFile.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class MapFileTest: public TestSuite::Tester {
+    public:
+        explicit MapFileTest();
+
+        void map();
+        void mapClamped();
+        void mapEmpty();
+        void mapCopyOnWrite();
+        void nonexistent();
+        void offsetPastEnd();
+};
+
+MapFileTest::MapFileTest() {
+    addTests({&MapFileTest::map,
+              &MapFileTest::mapClamped,
+              &MapFileTest::mapEmpty,
+              &MapFileTest::mapCopyOnWrite,
+              &MapFileTest::nonexistent,
+              &MapFileTest::offsetPastEnd});
+}
+
+void MapFileTest::map() {
+    std::optional<Containers::Array<char>> data = mapFile(Utility::Directory::join(TRADE_TEST_DIR, "file.bin"));
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data->size(), 1);
+    CORRADE_COMPARE((*data)[0], '\xa5');
+}
+
+void MapFileTest::mapClamped() {
+    std::optional<Containers::Array<char>> data = mapFile(Utility::Directory::join(TRADE_TEST_DIR, "file.bin"), 0, 100);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data->size(), 1);
+    CORRADE_COMPARE((*data)[0], '\xa5');
+}
+
+void MapFileTest::mapEmpty() {
+    std::optional<Containers::Array<char>> data = mapFile(Utility::Directory::join(TRADE_TEST_DIR, "file.bin"), 1);
+    CORRADE_VERIFY(data);
+    CORRADE_VERIFY(data->empty());
+}
+
+void MapFileTest::mapCopyOnWrite() {
+    const std::string filename = Utility::Directory::join(TRADE_TEST_DIR, "file.bin");
+
+    {
+        std::optional<Containers::Array<char>> data = mapFile(filename);
+        CORRADE_VERIFY(data);
+        (*data)[0] = '\x00';
+        CORRADE_COMPARE((*data)[0], '\x00');
+    }
+
+    /* The file should stay untouched */
+    std::optional<Containers::Array<char>> data = mapFile(filename);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE((*data)[0], '\xa5');
+}
+
+void MapFileTest::nonexistent() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!mapFile("nonexistent.bin"));
+    CORRADE_COMPARE(out.str(), "Trade::mapFile(): cannot open file nonexistent.bin\n");
+}
+
+void MapFileTest::offsetPastEnd() {
+    const std::string filename = Utility::Directory::join(TRADE_TEST_DIR, "file.bin");
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!mapFile(filename, 2));
+    CORRADE_COMPARE(out.str(), "Trade::mapFile(): offset 2 is past the end of 1 byte file " + filename + "\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MapFileTest)
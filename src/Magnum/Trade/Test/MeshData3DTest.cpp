@@ -26,7 +26,7 @@
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Mesh.h"
-#include "Magnum/Math/Vector3.h"
+#include "Magnum/Math/Vector4.h"
 #include "Magnum/Trade/MeshData3D.h"
 
 namespace Magnum { namespace Trade { namespace Test {
@@ -38,8 +38,11 @@ struct MeshData3DTest: TestSuite::Tester {
     void constructNonIndexed();
     void constructNoNormals();
     void constructNoTexCoords();
+    void constructSkinned();
     void constructCopy();
     void constructMove();
+
+    void boundingVolumes();
 };
 
 MeshData3DTest::MeshData3DTest() {
@@ -47,8 +50,11 @@ MeshData3DTest::MeshData3DTest() {
               &MeshData3DTest::constructNonIndexed,
               &MeshData3DTest::constructNoNormals,
               &MeshData3DTest::constructNoTexCoords,
+              &MeshData3DTest::constructSkinned,
               &MeshData3DTest::constructCopy,
-              &MeshData3DTest::constructMove});
+              &MeshData3DTest::constructMove,
+
+              &MeshData3DTest::boundingVolumes});
 }
 
 void MeshData3DTest::construct() {
@@ -117,6 +123,23 @@ void MeshData3DTest::constructNoTexCoords() {
 
     CORRADE_VERIFY(!data.hasTextureCoords2D());
     CORRADE_COMPARE(data.textureCoords2DArrayCount(), 0);
+    CORRADE_VERIFY(!data.isSkinned());
+}
+
+void MeshData3DTest::constructSkinned() {
+    const int a{};
+    const MeshData3D data{MeshPrimitive::Lines, {1, 0},
+        {{{0.5f, 1.0f, 0.1f}, {-1.0f, 0.3f, -1.0f}}},
+        {},
+        {},
+        {{0, 3, 0, 0}, {2, 1, 7, 0}},
+        {{1.0f, 0.0f, 0.0f, 0.0f}, {0.5f, 0.25f, 0.25f, 0.0f}},
+        &a};
+
+    CORRADE_VERIFY(data.isSkinned());
+    CORRADE_COMPARE(data.jointIds(), (std::vector<Vector4ui>{{0, 3, 0, 0}, {2, 1, 7, 0}}));
+    CORRADE_COMPARE(data.weights(), (std::vector<Vector4>{{1.0f, 0.0f, 0.0f, 0.0f}, {0.5f, 0.25f, 0.25f, 0.0f}}));
+    CORRADE_COMPARE(data.importerState(), &a);
 }
 
 void MeshData3DTest::constructCopy() {
@@ -164,6 +187,25 @@ void MeshData3DTest::constructMove() {
     CORRADE_COMPARE(d.importerState(), &a);
 }
 
+void MeshData3DTest::boundingVolumes() {
+    MeshData3D data{MeshPrimitive::Triangles, {}, {{{0.5f, 1.0f, 0.1f}}}, {}, {}};
+    CORRADE_VERIFY(!data.hasBoundingBox());
+    CORRADE_VERIFY(!data.hasBoundingSphere());
+
+    data.setBoundingBox({{-1.0f, 0.0f, 0.5f}, {1.0f, 2.0f, 3.0f}})
+        .setBoundingSphere({0.5f, 1.0f, 0.1f}, 2.5f);
+    CORRADE_VERIFY(data.hasBoundingBox());
+    CORRADE_VERIFY(data.hasBoundingSphere());
+    CORRADE_COMPARE(data.boundingBox(), (Range3D{{-1.0f, 0.0f, 0.5f}, {1.0f, 2.0f, 3.0f}}));
+    CORRADE_COMPARE(data.boundingSphere().first, (Vector3{0.5f, 1.0f, 0.1f}));
+    CORRADE_COMPARE(data.boundingSphere().second, 2.5f);
+
+    /* The volumes are moved along */
+    MeshData3D b{std::move(data)};
+    CORRADE_VERIFY(b.hasBoundingBox());
+    CORRADE_COMPARE(b.boundingSphere().second, 2.5f);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::MeshData3DTest)
@@ -0,0 +1,295 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+struct MeshDataTest: TestSuite::Tester {
+    explicit MeshDataTest();
+
+    void attributeTypeSize();
+    void indexTypeSize();
+
+    void construct();
+    void constructNonIndexed();
+    void constructNonOwned();
+    void constructAttributeOutOfBounds();
+    void constructIndexSize();
+    void constructCopy();
+    void constructMove();
+
+    void attributeForName();
+    void attributeForNameOutOfRange();
+    void release();
+
+    void debugAttribute();
+    void debugAttributeType();
+    void debugIndexType();
+};
+
+MeshDataTest::MeshDataTest() {
+    addTests({&MeshDataTest::attributeTypeSize,
+              &MeshDataTest::indexTypeSize,
+
+              &MeshDataTest::construct,
+              &MeshDataTest::constructNonIndexed,
+              &MeshDataTest::constructNonOwned,
+              &MeshDataTest::constructAttributeOutOfBounds,
+              &MeshDataTest::constructIndexSize,
+              &MeshDataTest::constructCopy,
+              &MeshDataTest::constructMove,
+
+              &MeshDataTest::attributeForName,
+              &MeshDataTest::attributeForNameOutOfRange,
+              &MeshDataTest::release,
+
+              &MeshDataTest::debugAttribute,
+              &MeshDataTest::debugAttributeType,
+              &MeshDataTest::debugIndexType});
+}
+
+void MeshDataTest::attributeTypeSize() {
+    CORRADE_COMPARE(meshAttributeTypeSize(MeshAttributeType::Byte), 1);
+    CORRADE_COMPARE(meshAttributeTypeSize(MeshAttributeType::HalfFloat), 2);
+    CORRADE_COMPARE(meshAttributeTypeSize(MeshAttributeType::Float), 4);
+    CORRADE_COMPARE((MeshAttributeData{MeshAttribute::Normal, MeshAttributeType::Short, 3, 0, 8}.size()), 6);
+}
+
+void MeshDataTest::indexTypeSize() {
+    CORRADE_COMPARE(meshIndexTypeSize(MeshIndexType::UnsignedByte), 1);
+    CORRADE_COMPARE(meshIndexTypeSize(MeshIndexType::UnsignedShort), 2);
+    CORRADE_COMPARE(meshIndexTypeSize(MeshIndexType::UnsignedInt), 4);
+}
+
+namespace {
+
+/* Three vertices with three-component float position and normalized
+   four-component unsigned byte color, 16 bytes each */
+Containers::Array<char> vertexData() {
+    return Containers::Array<char>{3*16};
+}
+
+std::vector<MeshAttributeData> attributes() {
+    return {MeshAttributeData{MeshAttribute::Position, MeshAttributeType::Float, 3, 0, 16},
+            MeshAttributeData{MeshAttribute::Color, MeshAttributeType::UnsignedByte, 4, 12, 16, true}};
+}
+
+Containers::Array<char> indexData() {
+    Containers::Array<char> data{4*sizeof(UnsignedShort)};
+    UnsignedShort* indices = reinterpret_cast<UnsignedShort*>(data.data());
+    indices[0] = 2;
+    indices[1] = 1;
+    indices[2] = 1;
+    indices[3] = 0;
+    return data;
+}
+
+}
+
+void MeshDataTest::construct() {
+    const int a{};
+    Containers::Array<char> vertices = vertexData();
+    const char* vertexPointer = vertices;
+    const MeshData data{MeshPrimitive::Lines, MeshIndexType::UnsignedShort, indexData(), std::move(vertices), attributes(), 3, &a};
+
+    CORRADE_COMPARE(data.primitive(), MeshPrimitive::Lines);
+
+    CORRADE_VERIFY(data.isIndexed());
+    CORRADE_COMPARE(data.indexType(), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE(data.indexCount(), 4);
+    CORRADE_COMPARE(data.indexData().size(), 8);
+    CORRADE_COMPARE(data.indexRange(), (std::pair<UnsignedInt, UnsignedInt>{0, 2}));
+
+    /* The data are not copied */
+    CORRADE_COMPARE(data.vertexCount(), 3);
+    CORRADE_COMPARE(data.vertexData().data(), vertexPointer);
+    CORRADE_COMPARE(data.vertexData().size(), 48);
+
+    CORRADE_COMPARE(data.attributeCount(), 2);
+    CORRADE_COMPARE(data.attribute(1).name(), MeshAttribute::Color);
+    CORRADE_COMPARE(data.attribute(1).type(), MeshAttributeType::UnsignedByte);
+    CORRADE_COMPARE(data.attribute(1).components(), 4);
+    CORRADE_COMPARE(data.attribute(1).offset(), 12);
+    CORRADE_COMPARE(data.attribute(1).stride(), 16);
+    CORRADE_VERIFY(data.attribute(1).isNormalized());
+    CORRADE_VERIFY(!data.attribute(0).isNormalized());
+
+    CORRADE_COMPARE(data.importerState(), &a);
+}
+
+void MeshDataTest::constructNonIndexed() {
+    const MeshData data{MeshPrimitive::Triangles, vertexData(), attributes(), 3};
+
+    CORRADE_VERIFY(!data.isIndexed());
+    CORRADE_COMPARE(data.indexCount(), 0);
+    CORRADE_VERIFY(!data.indexData());
+    CORRADE_COMPARE(data.vertexCount(), 3);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    data.indexType();
+    CORRADE_COMPARE(out.str(), "Trade::MeshData::indexType(): the mesh is not indexed\n");
+}
+
+void MeshDataTest::constructNonOwned() {
+    const UnsignedByte indices[]{0, 2, 1};
+    const Float vertices[]{1.0f, 0.5f, 0.0f, 0.5f, -1.0f, 1.0f};
+
+    {
+        MeshData data{MeshPrimitive::Triangles, MeshIndexType::UnsignedByte,
+            {reinterpret_cast<const char*>(indices), sizeof(indices)},
+            {reinterpret_cast<const char*>(vertices), sizeof(vertices)},
+            {MeshAttributeData{MeshAttribute::Position, MeshAttributeType::Float, 2, 0, 8}}, 3};
+
+        /* The data are not copied */
+        CORRADE_VERIFY(data.isIndexed());
+        CORRADE_COMPARE(data.indexCount(), 3);
+        CORRADE_COMPARE(static_cast<const void*>(data.indexData().data()), static_cast<const void*>(indices));
+        CORRADE_COMPARE(static_cast<const void*>(data.vertexData().data()), static_cast<const void*>(vertices));
+        CORRADE_COMPARE(data.indexRange(), (std::pair<UnsignedInt, UnsignedInt>{0, 2}));
+    }
+
+    MeshData data{MeshPrimitive::Triangles,
+        {reinterpret_cast<const char*>(vertices), sizeof(vertices)},
+        {MeshAttributeData{MeshAttribute::Position, MeshAttributeType::Float, 2, 0, 8}}, 3};
+    CORRADE_VERIFY(!data.isIndexed());
+    CORRADE_COMPARE(data.vertexCount(), 3);
+
+    /* Releasing the data should not free them either */
+    Containers::Array<char> released = data.releaseVertexData();
+    CORRADE_COMPARE(static_cast<const void*>(released.data()), static_cast<const void*>(vertices));
+}
+
+void MeshDataTest::constructAttributeOutOfBounds() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshData{MeshPrimitive::Triangles, vertexData(), attributes(), 4};
+    CORRADE_COMPARE(out.str(), "Trade::MeshData: Trade::MeshAttribute::Position attribute doesn't fit into 48 bytes of vertex data\n");
+}
+
+void MeshDataTest::constructIndexSize() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    MeshData{MeshPrimitive::Triangles, MeshIndexType::UnsignedInt, Containers::Array<char>{6}, vertexData(), attributes(), 3};
+    CORRADE_COMPARE(out.str(), "Trade::MeshData: index data size 6 is not divisible by Trade::MeshIndexType::UnsignedInt size\n");
+}
+
+void MeshDataTest::constructCopy() {
+    CORRADE_VERIFY(!(std::is_constructible<MeshData, const MeshData&>{}));
+    CORRADE_VERIFY(!(std::is_assignable<MeshData, const MeshData&>{}));
+}
+
+void MeshDataTest::constructMove() {
+    const int a{};
+    MeshData data{MeshPrimitive::LineStrip, MeshIndexType::UnsignedShort, indexData(), vertexData(), attributes(), 3, &a};
+
+    MeshData b{std::move(data)};
+    CORRADE_COMPARE(b.primitive(), MeshPrimitive::LineStrip);
+    CORRADE_VERIFY(b.isIndexed());
+    CORRADE_COMPARE(b.indexCount(), 4);
+    CORRADE_COMPARE(b.vertexCount(), 3);
+    CORRADE_COMPARE(b.vertexData().size(), 48);
+    CORRADE_COMPARE(b.attributeCount(), 2);
+    CORRADE_COMPARE(b.importerState(), &a);
+
+    const int c{};
+    MeshData d{MeshPrimitive::TriangleFan, Containers::Array<char>{}, {}, 0, &c};
+    d = std::move(b);
+    CORRADE_COMPARE(d.primitive(), MeshPrimitive::LineStrip);
+    CORRADE_VERIFY(d.isIndexed());
+    CORRADE_COMPARE(d.indexCount(), 4);
+    CORRADE_COMPARE(d.vertexCount(), 3);
+    CORRADE_COMPARE(d.vertexData().size(), 48);
+    CORRADE_COMPARE(d.attributeCount(), 2);
+    CORRADE_COMPARE(d.importerState(), &a);
+}
+
+void MeshDataTest::attributeForName() {
+    const MeshData data{MeshPrimitive::Triangles, Containers::Array<char>{3*24}, {
+        MeshAttributeData{MeshAttribute::Position, MeshAttributeType::Float, 2, 0, 24},
+        MeshAttributeData{MeshAttribute::TextureCoordinates, MeshAttributeType::Float, 2, 8, 24},
+        MeshAttributeData{MeshAttribute::TextureCoordinates, MeshAttributeType::Float, 2, 16, 24}
+    }, 3};
+
+    CORRADE_VERIFY(data.hasAttribute(MeshAttribute::Position));
+    CORRADE_VERIFY(!data.hasAttribute(MeshAttribute::Normal));
+    CORRADE_COMPARE(data.attributeCount(MeshAttribute::TextureCoordinates), 2);
+    CORRADE_COMPARE(data.attribute(MeshAttribute::TextureCoordinates).offset(), 8);
+    CORRADE_COMPARE(data.attribute(MeshAttribute::TextureCoordinates, 1).offset(), 16);
+}
+
+void MeshDataTest::attributeForNameOutOfRange() {
+    const MeshData data{MeshPrimitive::Triangles, vertexData(), attributes(), 3};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    data.attribute(MeshAttribute::Color, 1);
+    data.attribute(2);
+    CORRADE_COMPARE(out.str(),
+        "Trade::MeshData::attribute(): index out of range for Trade::MeshAttribute::Color\n"
+        "Trade::MeshData::attribute(): index out of range\n");
+}
+
+void MeshDataTest::release() {
+    Containers::Array<char> vertices = vertexData();
+    const char* vertexPointer = vertices;
+    MeshData data{MeshPrimitive::Triangles, MeshIndexType::UnsignedShort, indexData(), std::move(vertices), attributes(), 3};
+
+    Containers::Array<char> indices = data.releaseIndexData();
+    CORRADE_COMPARE(indices.size(), 8);
+    CORRADE_VERIFY(!data.isIndexed());
+
+    Containers::Array<char> released = data.releaseVertexData();
+    CORRADE_COMPARE(released.data(), vertexPointer);
+    CORRADE_COMPARE(data.vertexCount(), 0);
+    CORRADE_COMPARE(data.attributeCount(), 0);
+}
+
+void MeshDataTest::debugAttribute() {
+    std::ostringstream out;
+    Debug(&out) << MeshAttribute::TextureCoordinates << MeshAttribute(0xde);
+    CORRADE_COMPARE(out.str(), "Trade::MeshAttribute::TextureCoordinates Trade::MeshAttribute(0xde)\n");
+}
+
+void MeshDataTest::debugAttributeType() {
+    std::ostringstream out;
+    Debug(&out) << MeshAttributeType::HalfFloat << MeshAttributeType(0xde);
+    CORRADE_COMPARE(out.str(), "Trade::MeshAttributeType::HalfFloat Trade::MeshAttributeType(0xde)\n");
+}
+
+void MeshDataTest::debugIndexType() {
+    std::ostringstream out;
+    Debug(&out) << MeshIndexType::UnsignedShort << MeshIndexType(0xde);
+    CORRADE_COMPARE(out.str(), "Trade::MeshIndexType::UnsignedShort Trade::MeshIndexType(0xde)\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MeshDataTest)
@@ -0,0 +1,413 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <cmath>
+#include <cstring>
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Trade/AbstractMeshConverter.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/PointCloudOctree.h"
+#include "Magnum/Trade/PointCloudOctreeBuilder.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class PointCloudOctreeTest: public TestSuite::Tester {
+    public:
+        explicit PointCloudOctreeTest();
+
+        void buildSingleNode();
+        void build();
+        void buildNoColors();
+        void buildSkipped();
+        void buildEmpty();
+
+        void openTooShort();
+        void openInvalidSignature();
+        void openInvalidSize();
+        void openNoDataFile();
+        void openCorrupted();
+};
+
+namespace {
+    enum: std::size_t { OpenCorruptedDataCount = 9 };
+
+    const struct {
+        const char* name;
+        void(*corrupt)(PointCloudOctreeHeader&, PointCloudOctreeNode*);
+        const char* message;
+    } OpenCorruptedData[OpenCorruptedDataCount]{
+        {"too many levels", [](PointCloudOctreeHeader& header, PointCloudOctreeNode*) {
+            header.levelCount = 65;
+        }, "invalid level count 65\n"},
+        {"level out of range", [](PointCloudOctreeHeader& header, PointCloudOctreeNode*) {
+            header.levelCount = 1;
+        }, "invalid level 1 of node 1\n"},
+        {"level not matching the parent", [](PointCloudOctreeHeader&, PointCloudOctreeNode* nodes) {
+            nodes[1].level = 0;
+        }, "invalid level 0 of node 1\n"},
+        {"root with a parent", [](PointCloudOctreeHeader&, PointCloudOctreeNode* nodes) {
+            nodes[0].parent = 0;
+        }, "invalid parent of node 0\n"},
+        {"child with a different parent", [](PointCloudOctreeHeader&, PointCloudOctreeNode* nodes) {
+            nodes[1].parent = 5;
+        }, "invalid children of node 0\n"},
+        {"children past the end", [](PointCloudOctreeHeader&, PointCloudOctreeNode* nodes) {
+            nodes[0].firstChild = 0xfffffffeu;
+        }, "invalid children of node 0\n"},
+        {"children before the node", [](PointCloudOctreeHeader&, PointCloudOctreeNode* nodes) {
+            nodes[0].firstChild = 0;
+        }, "invalid children of node 0\n"},
+        {"data offset past the end", [](PointCloudOctreeHeader&, PointCloudOctreeNode* nodes) {
+            nodes[0].dataOffset = ~UnsignedLong{} - 7;
+        }, "invalid data range of node 0 for {} byte data file\n"},
+        {"data size past the end", [](PointCloudOctreeHeader&, PointCloudOctreeNode* nodes) {
+            nodes[0].dataSize = ~UnsignedLong{};
+        }, "invalid data range of node 0 for {} byte data file\n"}
+    };
+}
+
+PointCloudOctreeTest::PointCloudOctreeTest() {
+    addTests({&PointCloudOctreeTest::buildSingleNode,
+              &PointCloudOctreeTest::build,
+              &PointCloudOctreeTest::buildNoColors,
+              &PointCloudOctreeTest::buildSkipped,
+              &PointCloudOctreeTest::buildEmpty,
+
+              &PointCloudOctreeTest::openTooShort,
+              &PointCloudOctreeTest::openInvalidSignature,
+              &PointCloudOctreeTest::openInvalidSize,
+              &PointCloudOctreeTest::openNoDataFile});
+
+    addInstancedTests({&PointCloudOctreeTest::openCorrupted}, OpenCorruptedDataCount);
+
+    /* Create testing dir */
+    Utility::Directory::mkpath(TRADE_TEST_OUTPUT_DIR);
+}
+
+namespace {
+    /* Stores just the vertex data, so the nodes can be checked directly */
+    class RawMeshConverter: public AbstractMeshConverter {
+        private:
+            Features doFeatures() const override { return Feature::ConvertData; }
+
+            Containers::Array<char> doExportToData(const MeshData& mesh) override {
+                Containers::Array<char> data{mesh.vertexData().size()};
+                std::memcpy(data, mesh.vertexData(), data.size());
+                return data;
+            }
+    };
+
+    std::vector<PointCloudOctreeVertex> nodePoints(const PointCloudOctree& octree, UnsignedInt id) {
+        const std::optional<Containers::Array<char>> data = octree.nodeData(id);
+        if(!data) return {};
+        std::vector<PointCloudOctreeVertex> points(data->size()/sizeof(PointCloudOctreeVertex));
+        std::memcpy(points.data(), data->data(), data->size());
+        return points;
+    }
+
+    /* Wavy surface sampled on a regular grid */
+    std::vector<Vector3> surface(const Int size) {
+        std::vector<Vector3> positions;
+        for(Int y = 0; y != size; ++y) for(Int x = 0; x != size; ++x) {
+            const Float u = Float(x)/size, v = Float(y)/size;
+            positions.emplace_back(u*8.0f, v*8.0f, 0.5f*std::sin(u*6.0f)*std::cos(v*4.0f));
+        }
+        return positions;
+    }
+}
+
+void PointCloudOctreeTest::buildSingleNode() {
+    const std::string filename = Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "single.mgoctree");
+
+    const Vector3 positions[]{{0.0f, 0.0f, 0.0f}, {1.0f, 2.0f, 0.5f}, {2.0f, 1.0f, 1.0f}};
+    const Color4ub colors[]{{255, 0, 0, 255}, {0, 255, 0, 255}, {0, 0, 255, 128}};
+
+    RawMeshConverter converter;
+    {
+        PointCloudOctreeBuilder builder{converter, filename, {{0.0f, 0.0f, 0.0f}, {2.0f, 2.0f, 1.0f}}, 100, 1};
+        CORRADE_COMPARE(builder.bounds(), (Range3D{{0.0f, 0.0f, -0.5f}, {2.0f, 2.0f, 1.5f}}));
+        CORRADE_COMPARE(builder.nodeGridSize(), 8);
+        CORRADE_VERIFY(builder.addPoints(positions, colors));
+        CORRADE_COMPARE(builder.pointCount(), 3);
+        CORRADE_VERIFY(builder.finish());
+        CORRADE_COMPARE(builder.nodeCount(), 1);
+
+        /* The temporary chunk files are removed */
+        for(UnsignedInt i = 0; i != 8; ++i)
+            CORRADE_VERIFY(!Utility::Directory::fileExists(filename + ".chunk" + std::to_string(i)));
+    }
+
+    std::optional<PointCloudOctree> octree = PointCloudOctree::open(filename);
+    CORRADE_VERIFY(octree);
+    CORRADE_COMPARE(octree->dataFilename(), filename + ".data");
+    CORRADE_COMPARE(octree->pointCount(), 3);
+    CORRADE_COMPARE(octree->nodeCount(), 1);
+    CORRADE_COMPARE(octree->levelCount(), 1);
+    CORRADE_COMPARE(octree->bounds(), (Range3D{{0.0f, 0.0f, -0.5f}, {2.0f, 2.0f, 1.5f}}));
+    CORRADE_COMPARE(octree->spacing(), 0.25f);
+    CORRADE_COMPARE(octree->nodeSpacing(0), 0.25f);
+
+    const PointCloudOctreeNode& root = octree->node(0);
+    CORRADE_COMPARE(root.pointCount, 3);
+    CORRADE_COMPARE(root.parent, 0xffffffffu);
+    CORRADE_COMPARE(root.childMask, 0);
+    CORRADE_COMPARE(root.level, 0);
+
+    /* The points stay in the order they were added as they're all in the
+       same chunk */
+    const std::vector<PointCloudOctreeVertex> points = nodePoints(*octree, 0);
+    CORRADE_COMPARE(points.size(), 3);
+    CORRADE_COMPARE(points[0].position, positions[0]);
+    CORRADE_COMPARE(points[1].position, positions[1]);
+    CORRADE_COMPARE(points[2].position, positions[2]);
+    CORRADE_COMPARE(points[0].color, colors[0]);
+    CORRADE_COMPARE(points[1].color, colors[1]);
+    CORRADE_COMPARE(points[2].color, colors[2]);
+}
+
+void PointCloudOctreeTest::build() {
+    const std::string filename = Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "surface.mgoctree");
+
+    const std::vector<Vector3> positions = surface(200);
+
+    RawMeshConverter converter;
+    {
+        PointCloudOctreeBuilder builder{converter, filename, {{0.0f, 0.0f, -0.5f}, {8.0f, 8.0f, 0.5f}}, 1000, 2};
+        CORRADE_COMPARE(builder.nodeGridSize(), 16);
+
+        /* Add in multiple batches */
+        const std::size_t half = positions.size()/2;
+        CORRADE_VERIFY(builder.addPoints({positions.data(), half}));
+        CORRADE_VERIFY(builder.addPoints({positions.data() + half, positions.size() - half}));
+        CORRADE_VERIFY(builder.finish());
+    }
+
+    std::optional<PointCloudOctree> octree = PointCloudOctree::open(filename);
+    CORRADE_VERIFY(octree);
+    CORRADE_COMPARE(octree->pointCount(), 40000);
+    CORRADE_VERIFY(octree->nodeCount() > 9);
+    CORRADE_VERIFY(octree->levelCount() > 3);
+
+    /* Each point is in exactly one node, inside its bounds, nodes have at
+       most the limit and children are next to each other */
+    UnsignedLong pointCount = 0;
+    for(UnsignedInt i = 0; i != octree->nodeCount(); ++i) {
+        const PointCloudOctreeNode& node = octree->node(i);
+        const Range3D bounds = octree->nodeBounds(i);
+        CORRADE_VERIFY(node.pointCount <= 1000);
+        CORRADE_COMPARE(node.dataOffset % PointCloudOctreeDataAlignment, 0);
+
+        const std::vector<PointCloudOctreeVertex> points = nodePoints(*octree, i);
+        CORRADE_COMPARE(points.size(), node.pointCount);
+        for(const PointCloudOctreeVertex& point: points) {
+            CORRADE_VERIFY((point.position >= bounds.min()).all());
+            CORRADE_VERIFY((point.position <= bounds.max()).all());
+        }
+        pointCount += points.size();
+
+        if(i) {
+            CORRADE_VERIFY(node.parent < i);
+            CORRADE_COMPARE(node.level, octree->node(node.parent).level + 1);
+            CORRADE_COMPARE(octree->nodeSpacing(i), octree->nodeSpacing(node.parent)*0.5f);
+        }
+
+        UnsignedInt child = node.firstChild;
+        for(UnsignedInt o = 0; o != 8; ++o) {
+            if(!(node.childMask & (1 << o))) continue;
+            CORRADE_COMPARE(octree->node(child).parent, i);
+            CORRADE_COMPARE(octree->nodeBounds(child).size(), bounds.size()*0.5f);
+            CORRADE_COMPARE(octree->nodeBounds(child).min().x(), o & 1 ? bounds.centerX() : bounds.min().x());
+            CORRADE_COMPARE(octree->nodeBounds(child).min().y(), o & 2 ? bounds.centerY() : bounds.min().y());
+            CORRADE_COMPARE(octree->nodeBounds(child).min().z(), o & 4 ? bounds.centerZ() : bounds.min().z());
+            ++child;
+        }
+    }
+    CORRADE_COMPARE(pointCount, 40000);
+
+    /* The root has the coarsest level, spread over the whole area */
+    CORRADE_VERIFY(octree->node(0).pointCount > 100);
+}
+
+void PointCloudOctreeTest::buildNoColors() {
+    const std::string filename = Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "nocolors.mgoctree");
+
+    const Vector3 positions[]{{0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}};
+
+    RawMeshConverter converter;
+    {
+        PointCloudOctreeBuilder builder{converter, filename, {{}, Vector3{1.0f}}};
+        CORRADE_VERIFY(builder.addPoints(positions));
+        CORRADE_VERIFY(builder.finish());
+    }
+
+    std::optional<PointCloudOctree> octree = PointCloudOctree::open(filename);
+    CORRADE_VERIFY(octree);
+
+    const std::vector<PointCloudOctreeVertex> points = nodePoints(*octree, 0);
+    CORRADE_COMPARE(points.size(), 2);
+    CORRADE_COMPARE(points[0].color, (Color4ub{255, 255, 255, 255}));
+    CORRADE_COMPARE(points[1].color, (Color4ub{255, 255, 255, 255}));
+}
+
+void PointCloudOctreeTest::buildSkipped() {
+    const std::string filename = Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "skipped.mgoctree");
+
+    const Vector3 positions[]{{0.5f, 0.5f, 0.5f}, {1.5f, 0.5f, 0.5f}, {0.5f, -0.5f, 0.5f}, {Constants::nan(), 0.0f, 0.0f}};
+
+    RawMeshConverter converter;
+    PointCloudOctreeBuilder builder{converter, filename, {{}, Vector3{1.0f}}};
+    CORRADE_VERIFY(builder.addPoints(positions));
+    CORRADE_COMPARE(builder.pointCount(), 1);
+    CORRADE_COMPARE(builder.skippedPointCount(), 3);
+    CORRADE_VERIFY(builder.finish());
+
+    std::optional<PointCloudOctree> octree = PointCloudOctree::open(filename);
+    CORRADE_VERIFY(octree);
+    CORRADE_COMPARE(octree->pointCount(), 1);
+}
+
+void PointCloudOctreeTest::buildEmpty() {
+    const std::string filename = Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "empty.mgoctree");
+
+    RawMeshConverter converter;
+    {
+        PointCloudOctreeBuilder builder{converter, filename, {{}, Vector3{1.0f}}};
+        CORRADE_VERIFY(builder.finish());
+        CORRADE_COMPARE(builder.nodeCount(), 1);
+    }
+
+    std::optional<PointCloudOctree> octree = PointCloudOctree::open(filename);
+    CORRADE_VERIFY(octree);
+    CORRADE_COMPARE(octree->pointCount(), 0);
+    CORRADE_COMPARE(octree->nodeCount(), 1);
+    CORRADE_COMPARE(octree->node(0).pointCount, 0);
+    CORRADE_COMPARE(octree->node(0).dataSize, 0);
+
+    const std::optional<Containers::Array<char>> data = octree->nodeData(0);
+    CORRADE_VERIFY(data);
+    CORRADE_VERIFY(data->empty());
+}
+
+void PointCloudOctreeTest::openTooShort() {
+    const std::string filename = Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "short.mgoctree");
+    CORRADE_VERIFY(Utility::Directory::write(filename, Containers::ArrayView<const char>{"MGPC", 4}));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!PointCloudOctree::open(filename));
+    CORRADE_COMPARE(out.str(), "Trade::PointCloudOctree::open(): file too short, expected at least 48 bytes but got 4\n");
+}
+
+void PointCloudOctreeTest::openInvalidSignature() {
+    const std::string filename = Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "signature.mgoctree");
+    char data[sizeof(PointCloudOctreeHeader)]{};
+    std::memcpy(data, "MGMS", 4);
+    CORRADE_VERIFY(Utility::Directory::write(filename, data));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!PointCloudOctree::open(filename));
+    CORRADE_COMPARE(out.str(), "Trade::PointCloudOctree::open(): invalid file signature\n");
+}
+
+void PointCloudOctreeTest::openInvalidSize() {
+    const std::string filename = Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "empty.mgoctree");
+    const std::string truncated = Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "truncated.mgoctree");
+
+    /* Take a valid file and cut the node off */
+    RawMeshConverter converter;
+    {
+        PointCloudOctreeBuilder builder{converter, filename, {{}, Vector3{1.0f}}};
+        CORRADE_VERIFY(builder.finish());
+    }
+    Containers::Array<char> data = Utility::Directory::read(filename);
+    CORRADE_COMPARE(data.size(), sizeof(PointCloudOctreeHeader) + sizeof(PointCloudOctreeNode));
+    CORRADE_VERIFY(Utility::Directory::write(truncated, data.prefix(sizeof(PointCloudOctreeHeader) + 8)));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!PointCloudOctree::open(truncated));
+    CORRADE_COMPARE(out.str(), "Trade::PointCloudOctree::open(): file size doesn't match, expected 104 bytes for 1 nodes but got 56\n");
+}
+
+void PointCloudOctreeTest::openNoDataFile() {
+    const std::string filename = Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "nodata.mgoctree");
+
+    RawMeshConverter converter;
+    {
+        PointCloudOctreeBuilder builder{converter, filename, {{}, Vector3{1.0f}}};
+        CORRADE_VERIFY(builder.finish());
+    }
+    CORRADE_VERIFY(Utility::Directory::rm(filename + ".data"));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!PointCloudOctree::open(filename));
+    CORRADE_COMPARE(out.str(), "Trade::PointCloudOctree::open(): cannot open data file " + filename + ".data\n");
+}
+
+void PointCloudOctreeTest::openCorrupted() {
+    setTestCaseDescription(OpenCorruptedData[testCaseInstanceId()].name);
+
+    const std::string filename = Utility::Directory::join(TRADE_TEST_OUTPUT_DIR, "corrupted.mgoctree");
+
+    /* A valid file with a few levels, which gets corrupted afterwards */
+    const std::vector<Vector3> positions = surface(40);
+    RawMeshConverter converter;
+    {
+        PointCloudOctreeBuilder builder{converter, filename, {{0.0f, 0.0f, -0.5f}, {8.0f, 8.0f, 0.5f}}, 100, 2};
+        CORRADE_VERIFY(builder.addPoints({positions.data(), positions.size()}));
+        CORRADE_VERIFY(builder.finish());
+    }
+    CORRADE_VERIFY(PointCloudOctree::open(filename));
+
+    Containers::Array<char> data = Utility::Directory::read(filename);
+    PointCloudOctreeHeader& header = *reinterpret_cast<PointCloudOctreeHeader*>(data.data());
+    CORRADE_VERIFY(header.nodeCount > 5);
+    CORRADE_VERIFY(header.levelCount > 1);
+    OpenCorruptedData[testCaseInstanceId()].corrupt(header, reinterpret_cast<PointCloudOctreeNode*>(data + sizeof(PointCloudOctreeHeader)));
+    CORRADE_VERIFY(Utility::Directory::write(filename, data));
+
+    /* Put the data file size into the message, if needed */
+    std::string message = OpenCorruptedData[testCaseInstanceId()].message;
+    const std::size_t placeholder = message.find("{}");
+    if(placeholder != std::string::npos)
+        message.replace(placeholder, 2, std::to_string(Utility::Directory::read(filename + ".data").size()));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!PointCloudOctree::open(filename));
+    CORRADE_COMPARE(out.str(), "Trade::PointCloudOctree::open(): " + message);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::PointCloudOctreeTest)
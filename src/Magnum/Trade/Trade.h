@@ -36,8 +36,11 @@ namespace Magnum { namespace Trade {
 #ifndef DOXYGEN_GENERATING_OUTPUT
 class AbstractImageConverter;
 class AbstractImporter;
+class AbstractMeshConverter;
+class BatchImporter;
 class AbstractMaterialData;
 class CameraData;
+class FlatSceneData3D;
 
 template<UnsignedInt> class ImageData;
 typedef ImageData<1> ImageData1D;
@@ -45,13 +48,23 @@ typedef ImageData<2> ImageData2D;
 typedef ImageData<3> ImageData3D;
 
 class LightData;
+enum class MeshAttribute: UnsignedByte;
+class MeshAttributeData;
+enum class MeshAttributeType: UnsignedByte;
+class MeshData;
 class MeshData2D;
 class MeshData3D;
+enum class MeshIndexType: UnsignedByte;
 class MeshObjectData2D;
 class MeshObjectData3D;
 class ObjectData2D;
 class ObjectData3D;
 class PhongMaterialData;
+class PointCloudOctree;
+class PointCloudOctreeBuilder;
+struct PointCloudOctreeHeader;
+struct PointCloudOctreeNode;
+struct PointCloudOctreeVertex;
 class TextureData;
 class SceneData;
 #endif
@@ -28,6 +28,7 @@
 #include <Corrade/Utility/Directory.h>
 
 #include "Magnum/PixelFormat.h"
+#include "Magnum/TextureTools/Resample.h"
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/AbstractImageConverter.h"
 #include "Magnum/Trade/ImageData.h"
@@ -42,7 +43,7 @@ namespace Magnum {
 
 @section magnum-imageconverter-usage Usage
 
-    magnum-imageconverter [-h|--help] [--importer IMPORTER] [--converter CONVERTER] [--plugin-dir DIR] [--] input output
+    magnum-imageconverter [-h|--help] [--importer IMPORTER] [--converter CONVERTER] [--plugin-dir DIR] [--mipmaps] [--filter FILTER] [--srgb] [--threads N] [--] input output
 
 Arguments:
 
@@ -55,6 +56,15 @@ Arguments:
     @ref Trade::AnyImageConverter "AnyImageConverter")
 -   `--plugin-dir DIR` -- base plugin dir (defaults to plugin directory in
     Magnum install location)
+-   `--mipmaps` -- generate full mip chain using
+    @ref TextureTools::generateMipmaps(). Level `0` is saved to `output`,
+    each next level `N` to a file with `.N` inserted before the output
+    extension.
+-   `--filter FILTER` -- mip level filter, one of `box`, `kaiser` or
+    `lanczos` (default: `kaiser`)
+-   `--srgb` -- treat the image as sRGB when filtering the mip levels
+-   `--threads N` -- count of threads used for filtering the mip levels
+    (default: `0`, meaning all available cores)
 
 @section magnum-imageconverter-example Example usage
 
@@ -62,6 +72,11 @@ Converting a JPEG file to a PNG:
 
     magnum-imageconverter image.jpg image.png
 
+Generating sRGB-correct mip levels `image.png`, `image.1.png` ...
+`image.9.png` from a 512x512 JPEG file:
+
+    magnum-imageconverter --mipmaps --srgb image.jpg image.png
+
 */
 
 }
@@ -75,6 +90,10 @@ int main(int argc, char** argv) {
         .addOption("importer", "AnyImageImporter").setHelp("importer", "image importer plugin")
         .addOption("converter", "AnyImageConverter").setHelp("converter", "image converter plugin")
         .addOption("plugin-dir", Utility::Directory::join(Utility::Directory::path(Utility::Directory::executableLocation()), MAGNUM_PLUGINS_DIR)).setHelp("plugin-dir", "base plugin dir", "DIR")
+        .addBooleanOption("mipmaps").setHelp("mipmaps", "generate full mip chain")
+        .addOption("filter", "kaiser").setHelp("filter", "mip level filter, one of box, kaiser or lanczos")
+        .addBooleanOption("srgb").setHelp("srgb", "treat the image as sRGB when filtering the mip levels")
+        .addOption("threads", "0").setHelp("threads", "count of threads used for filtering the mip levels, 0 for all available cores", "N")
         .setHelp("Converts images of different formats.")
         .parse(argc, argv);
 
@@ -100,8 +119,43 @@ int main(int argc, char** argv) {
     Debug() << "Converting image of size" << image->size() << Debug::nospace << ", format" << image->format() << "and type"  << image->type() << "to" << args.value("output");
 
     /* Save output file */
-    if(!converter->exportToFile(*image, args.value("output"))) {
-        Error() << "Cannot save file" << args.value("output");
+    if(!args.isSet("mipmaps")) {
+        if(!converter->exportToFile(*image, args.value("output"))) {
+            Error() << "Cannot save file" << args.value("output");
+            return 1;
+        }
+
+        return 0;
+    }
+
+    /* Generate mip levels and save each to its own file */
+    TextureTools::ResampleFilter filter;
+    if(args.value("filter") == "box") filter = TextureTools::ResampleFilter::Box;
+    else if(args.value("filter") == "kaiser") filter = TextureTools::ResampleFilter::Kaiser;
+    else if(args.value("filter") == "lanczos") filter = TextureTools::ResampleFilter::Lanczos;
+    else {
+        Error() << "Unknown filter" << args.value("filter");
         return 1;
     }
+
+    const std::vector<Image2D> levels = TextureTools::generateMipmaps(*image, filter,
+        args.isSet("srgb") ? TextureTools::ResampleFlag::Srgb : TextureTools::ResampleFlags{},
+        args.value<UnsignedInt>("threads"));
+    if(levels.empty()) return 1;
+
+    const std::string& output = args.value("output");
+    const std::size_t extension = output.rfind('.');
+    const bool hasExtension = extension != std::string::npos && output.find_first_of("/\\", extension) == std::string::npos;
+    for(std::size_t i = 0; i != levels.size(); ++i) {
+        std::string filename = output;
+        if(i) filename = hasExtension ?
+            output.substr(0, extension) + '.' + std::to_string(i) + output.substr(extension) :
+            output + '.' + std::to_string(i);
+
+        Debug() << "Saving level" << i << "of size" << levels[i].size() << "to" << filename;
+        if(!converter->exportToFile(levels[i], filename)) {
+            Error() << "Cannot save file" << filename;
+            return 1;
+        }
+    }
 }
@@ -0,0 +1,234 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <limits>
+#include <vector>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/Utility/Arguments.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/AbstractMeshConverter.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/PointCloudOctreeBuilder.h"
+
+#include "pointcloudconverterConfigure.h"
+
+namespace Magnum {
+
+/**
+@page magnum-pointcloudconverter Point cloud conversion utility
+@brief Builds an out-of-core point cloud octree
+
+@section magnum-pointcloudconverter-usage Usage
+
+    magnum-pointcloudconverter [-h|--help] [--importer IMPORTER] [--converter CONVERTER] [--plugin-dir DIR] [--node-points N] [--chunk-level N] [--batch N] [--] input output
+
+Arguments:
+
+-   `input` -- input point cloud
+-   `output` -- output octree index file, the node data are saved to a file
+    with `.data` appended
+-   `-h`, `--help` -- display this help message and exit
+-   `--importer IMPORTER` -- mesh importer plugin (default:
+    @ref Trade::MagnumMeshImporter "MagnumMeshImporter")
+-   `--converter CONVERTER` -- mesh converter plugin for the node data
+    (default: @ref Trade::MagnumMeshConverter "MagnumMeshConverter")
+-   `--plugin-dir DIR` -- base plugin dir (defaults to plugin directory in
+    Magnum install location)
+-   `--node-points N` -- maximal point count in one node (default: `20000`)
+-   `--chunk-level N` -- octree level at which the points are split into
+    temporary files (default: `3`)
+-   `--batch N` -- count of points passed to the builder at once (default:
+    `1048576`)
+
+All meshes in the input file are processed, vertices of each are treated as
+points regardless of the primitive. Positions have to be three-component
+floats, colors, if present, either three- or four-component normalized
+unsigned bytes or floats. The input is read twice, first to calculate the
+bounds and then to build the octree, only one batch of points is in memory at
+a time apart from the imported mesh itself, so an importer that maps the file
+into memory should be used for large inputs. See
+@ref Trade::PointCloudOctreeBuilder for details about the build process and
+@ref PointCloudStreamer for drawing the result.
+
+@section magnum-pointcloudconverter-example Example usage
+
+Building an octree with smaller nodes from a point cloud saved by
+@ref Trade::MagnumMeshConverter "MagnumMeshConverter":
+
+    magnum-pointcloudconverter --node-points 8192 scan.mgmesh scan.mgoctree
+
+*/
+
+}
+
+using namespace Magnum;
+
+namespace {
+
+/* Copies positions and colors of vertices [offset, offset + count) */
+bool extractPoints(const Trade::MeshData& mesh, const UnsignedInt offset, const UnsignedInt count, std::vector<Vector3>& positions, std::vector<Color4ub>& colors) {
+    const Trade::MeshAttributeData& position = mesh.attribute(Trade::MeshAttribute::Position);
+    if(position.type() != Trade::MeshAttributeType::Float || position.components() != 3) {
+        Error() << "Unsupported position format" << position.type() << Debug::nospace << "x" << Debug::nospace << position.components();
+        return false;
+    }
+
+    positions.resize(count);
+    const char* const data = mesh.vertexData();
+    for(UnsignedInt i = 0; i != count; ++i)
+        std::memcpy(&positions[i], data + position.offset() + std::size_t(offset + i)*position.stride(), sizeof(Vector3));
+
+    colors.clear();
+    if(!mesh.hasAttribute(Trade::MeshAttribute::Color)) return true;
+
+    const Trade::MeshAttributeData& color = mesh.attribute(Trade::MeshAttribute::Color);
+    colors.resize(count);
+    if(color.type() == Trade::MeshAttributeType::UnsignedByte && color.isNormalized() && (color.components() == 3 || color.components() == 4)) {
+        for(UnsignedInt i = 0; i != count; ++i) {
+            colors[i] = Color4ub{255};
+            std::memcpy(colors[i].data(), data + color.offset() + std::size_t(offset + i)*color.stride(), color.components());
+        }
+    } else if(color.type() == Trade::MeshAttributeType::Float && (color.components() == 3 || color.components() == 4)) {
+        for(UnsignedInt i = 0; i != count; ++i) {
+            Color4 value{1.0f};
+            std::memcpy(value.data(), data + color.offset() + std::size_t(offset + i)*color.stride(), color.components()*sizeof(Float));
+            colors[i] = Math::denormalize<Color4ub>(Math::clamp(value, 0.0f, 1.0f));
+        }
+    } else {
+        Error() << "Unsupported color format" << color.type() << Debug::nospace << "x" << Debug::nospace << color.components();
+        return false;
+    }
+
+    return true;
+}
+
+}
+
+int main(int argc, char** argv) {
+    Utility::Arguments args;
+    args.addArgument("input").setHelp("input", "input point cloud")
+        .addArgument("output").setHelp("output", "output octree index file")
+        .addOption("importer", "MagnumMeshImporter").setHelp("importer", "mesh importer plugin")
+        .addOption("converter", "MagnumMeshConverter").setHelp("converter", "mesh converter plugin for the node data")
+        .addOption("plugin-dir", Utility::Directory::join(Utility::Directory::path(Utility::Directory::executableLocation()), MAGNUM_PLUGINS_DIR)).setHelp("plugin-dir", "base plugin dir", "DIR")
+        .addOption("node-points", "20000").setHelp("node-points", "maximal point count in one node", "N")
+        .addOption("chunk-level", "3").setHelp("chunk-level", "octree level at which the points are split into temporary files", "N")
+        .addOption("batch", "1048576").setHelp("batch", "count of points passed to the builder at once", "N")
+        .setHelp("Builds an out-of-core point cloud octree.")
+        .parse(argc, argv);
+
+    /* Load importer plugin */
+    PluginManager::Manager<Trade::AbstractImporter> importerManager(Utility::Directory::join(args.value("plugin-dir"), "importers/"));
+    if(!(importerManager.load(args.value("importer")) & PluginManager::LoadState::Loaded))
+        return 1;
+    std::unique_ptr<Trade::AbstractImporter> importer = importerManager.instance(args.value("importer"));
+
+    /* Load converter plugin */
+    PluginManager::Manager<Trade::AbstractMeshConverter> converterManager(Utility::Directory::join(args.value("plugin-dir"), "meshconverters/"));
+    if(!(converterManager.load(args.value("converter")) & PluginManager::LoadState::Loaded))
+        return 1;
+    std::unique_ptr<Trade::AbstractMeshConverter> converter = converterManager.instance(args.value("converter"));
+
+    /* Open input file */
+    if(!importer->openFile(args.value("input")) || !importer->mesh3DCount()) {
+        Error() << "Cannot open file" << args.value("input");
+        return 1;
+    }
+
+    const UnsignedInt batch = Math::max(args.value<UnsignedInt>("batch"), 1u);
+    std::vector<Vector3> positions;
+    std::vector<Color4ub> colors;
+
+    /* First pass, calculate the bounds */
+    Range3D bounds{Vector3{std::numeric_limits<Float>::max()}, Vector3{-std::numeric_limits<Float>::max()}};
+    UnsignedLong pointCount = 0;
+    for(UnsignedInt i = 0; i != importer->mesh3DCount(); ++i) {
+        std::optional<Trade::MeshData> mesh = importer->mesh(i);
+        if(!mesh) {
+            Error() << "Cannot import mesh" << i;
+            return 1;
+        }
+
+        if(!mesh->hasAttribute(Trade::MeshAttribute::Position)) {
+            Warning() << "Skipping mesh" << i << "without positions";
+            continue;
+        }
+
+        for(UnsignedInt offset = 0; offset < mesh->vertexCount(); offset += batch) {
+            if(!extractPoints(*mesh, offset, Math::min(batch, mesh->vertexCount() - offset), positions, colors))
+                return 1;
+            for(const Vector3& position: positions) {
+                if(position != position) continue;
+                bounds.min() = Math::min(bounds.min(), position);
+                bounds.max() = Math::max(bounds.max(), position);
+            }
+        }
+
+        pointCount += mesh->vertexCount();
+    }
+
+    if(!pointCount) {
+        Error() << "No points in file" << args.value("input");
+        return 1;
+    }
+
+    Debug() << "Building octree of" << pointCount << "points in" << bounds << "to" << args.value("output");
+
+    /* Second pass, add the points */
+    Trade::PointCloudOctreeBuilder builder{*converter, args.value("output"), bounds,
+        args.value<UnsignedInt>("node-points"), args.value<UnsignedInt>("chunk-level")};
+    for(UnsignedInt i = 0; i != importer->mesh3DCount(); ++i) {
+        std::optional<Trade::MeshData> mesh = importer->mesh(i);
+        if(!mesh) {
+            Error() << "Cannot import mesh" << i;
+            return 1;
+        }
+
+        if(!mesh->hasAttribute(Trade::MeshAttribute::Position)) continue;
+
+        for(UnsignedInt offset = 0; offset < mesh->vertexCount(); offset += batch) {
+            if(!extractPoints(*mesh, offset, Math::min(batch, mesh->vertexCount() - offset), positions, colors) ||
+               !builder.addPoints({positions.data(), positions.size()}, {colors.data(), colors.size()})) {
+                Error() << "Cannot add points of mesh" << i;
+                return 1;
+            }
+        }
+    }
+
+    importer->close();
+
+    if(!builder.finish()) {
+        Error() << "Cannot save file" << args.value("output");
+        return 1;
+    }
+
+    Debug() << "Saved" << builder.nodeCount() << "nodes with" << builder.pointCount() << "points," << builder.skippedPointCount() << "points skipped";
+}
@@ -0,0 +1,130 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "TransformFeedbackCache.h"
+
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Renderer.h"
+
+namespace Magnum {
+
+namespace {
+
+MeshPrimitive meshPrimitive(const TransformFeedback::PrimitiveMode mode) {
+    switch(mode) {
+        case TransformFeedback::PrimitiveMode::Points: return MeshPrimitive::Points;
+        case TransformFeedback::PrimitiveMode::Lines: return MeshPrimitive::Lines;
+        case TransformFeedback::PrimitiveMode::Triangles: return MeshPrimitive::Triangles;
+    }
+
+    CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+}
+
+TransformFeedbackCache::TransformFeedbackCache(const TransformFeedback::PrimitiveMode primitiveMode, const UnsignedInt vertexStride, const UnsignedInt vertexCapacity, const BufferUsage usage): _primitiveMode{primitiveMode}, _vertexStride{vertexStride}, _vertexCapacity{vertexCapacity}, _captured{}, _buffer{Buffer::TargetHint::Array}, _mesh{meshPrimitive(primitiveMode)}, _written{PrimitiveQuery::Target::TransformFeedbackPrimitivesWritten}
+    #ifndef MAGNUM_TARGET_WEBGL
+    , _generated{NoCreate}
+    #endif
+{
+    CORRADE_ASSERT(vertexStride && vertexCapacity,
+        "TransformFeedbackCache: expected non-zero vertex stride and capacity", );
+
+    _buffer.setData({nullptr, std::size_t(vertexStride)*vertexCapacity}, usage);
+    _feedback.attachBuffer(0, _buffer);
+
+    /* The count of generated primitives is needed for exact overflow
+       detection, on ES it's available only with geometry shaders */
+    #ifndef MAGNUM_TARGET_GLES
+    _generated = PrimitiveQuery{PrimitiveQuery::Target::PrimitivesGenerated};
+    #elif !defined(MAGNUM_TARGET_WEBGL)
+    if(Context::current().isExtensionSupported<Extensions::GL::EXT::geometry_shader>())
+        _generated = PrimitiveQuery{PrimitiveQuery::Target::PrimitivesGenerated};
+    #endif
+}
+
+UnsignedInt TransformFeedbackCache::verticesPerPrimitive() const {
+    switch(_primitiveMode) {
+        case TransformFeedback::PrimitiveMode::Points: return 1;
+        case TransformFeedback::PrimitiveMode::Lines: return 2;
+        case TransformFeedback::PrimitiveMode::Triangles: return 3;
+    }
+
+    CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+void TransformFeedbackCache::capture(AbstractShaderProgram& shader, Mesh& mesh) {
+    #ifndef MAGNUM_TARGET_WEBGL
+    if(_generated.id()) _generated.begin();
+    #endif
+    _written.begin();
+
+    Renderer::enable(Renderer::Feature::RasterizerDiscard);
+    _feedback.begin(shader, _primitiveMode);
+    mesh.draw(shader);
+    _feedback.end();
+    Renderer::disable(Renderer::Feature::RasterizerDiscard);
+
+    _written.end();
+    #ifndef MAGNUM_TARGET_WEBGL
+    if(_generated.id()) _generated.end();
+    #endif
+
+    _captured = true;
+}
+
+UnsignedInt TransformFeedbackCache::vertexCount() {
+    CORRADE_ASSERT(_captured, "TransformFeedbackCache::vertexCount(): nothing captured", {});
+    return _written.result<UnsignedInt>()*verticesPerPrimitive();
+}
+
+bool TransformFeedbackCache::hasOverflow() {
+    CORRADE_ASSERT(_captured, "TransformFeedbackCache::hasOverflow(): nothing captured", {});
+
+    #ifndef MAGNUM_TARGET_WEBGL
+    if(_generated.id())
+        return _generated.result<UnsignedInt>() > _written.result<UnsignedInt>();
+    #endif
+
+    /* Without the generated count the best we can do is checking whether
+       there's space left for another primitive */
+    return _written.result<UnsignedInt>() == _vertexCapacity/verticesPerPrimitive();
+}
+
+void TransformFeedbackCache::draw(AbstractShaderProgram& shader) {
+    CORRADE_ASSERT(_captured, "TransformFeedbackCache::draw(): nothing captured", );
+
+    #ifndef MAGNUM_TARGET_GLES
+    _mesh.draw(shader, _feedback);
+    #else
+    _mesh.setCount(vertexCount());
+    _mesh.draw(shader);
+    #endif
+}
+
+}
@@ -0,0 +1,227 @@
+#ifndef Magnum_TransformFeedbackCache_h
+#define Magnum_TransformFeedbackCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::TransformFeedbackCache
+ */
+#endif
+
+#include "Magnum/Buffer.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/PrimitiveQuery.h"
+#include "Magnum/TransformFeedback.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum {
+
+/**
+@brief Transform feedback vertex cache
+
+Skinned or morphed meshes rendered in more than one pass (e.g. depth pre-pass,
+shadow cascades and G-buffer) execute the same expensive vertex
+transformation in each of them. The cache runs the transformation only once
+using @ref TransformFeedback, captures the transformed vertices into
+@ref buffer() and exposes them as a regular non-indexed @ref mesh() that the
+remaining passes draw with a cheap pass-through vertex shader.
+
+## Usage
+
+The cache is created with primitive mode, size of one captured vertex and
+vertex capacity of the buffer. Layout of the captured vertex has to be
+specified on @ref mesh() by the application, it's the same as the
+transform feedback output layout of the capturing shader:
+@code
+TransformFeedbackCache cache{TransformFeedback::PrimitiveMode::Triangles,
+    sizeof(Vector3) + sizeof(Vector3), 65536};
+cache.mesh().addVertexBuffer(cache.buffer(), 0,
+    Shaders::Phong::Position{}, Shaders::Phong::Normal{});
+
+// once per frame, the skinning shader has the outputs set up with
+// AbstractShaderProgram::setTransformFeedbackOutputs()
+cache.capture(skinningShader, skinnedMesh);
+
+// then in every pass
+cache.draw(depthShader);
+@endcode
+
+The source mesh can be indexed, in that case the vertex shader is executed
+for each index and the captured mesh has as many vertices as the source mesh
+has indices. Rasterization is disabled during the capture using
+@ref Renderer::Feature::RasterizerDiscard.
+
+## Vertex count and overflow checks
+
+Captured vertex count is tracked using a @ref PrimitiveQuery. On desktop
+OpenGL, @ref draw() takes the vertex count directly from the
+@ref TransformFeedback object, so drawing the captured mesh doesn't stall the
+pipeline waiting for the query result. On OpenGL ES and WebGL it is not
+possible and @ref draw() waits for the query result to set it as the mesh
+vertex count.
+
+If the buffer is not large enough, the vertices that don't fit are silently
+dropped. Use @ref hasOverflow() to detect that case, e.g. in debug builds or
+after changing the source meshes. On desktop OpenGL and on OpenGL ES with
+@es_extension{EXT,geometry_shader} the count of generated primitives is
+compared to the count of written primitives. Otherwise the cache is treated
+as overflown if the buffer got completely full.
+@see @ref MeshArena
+@requires_gl40 Extension @extension{ARB,transform_feedback2}
+@requires_gles30 Transform feedback is not available in OpenGL ES 2.0.
+@requires_webgl20 Transform feedback is not available in WebGL 1.0.
+*/
+class MAGNUM_EXPORT TransformFeedbackCache {
+    public:
+        /**
+         * @brief Constructor
+         * @param primitiveMode     Captured primitive mode
+         * @param vertexStride      Size of one captured vertex in bytes
+         * @param vertexCapacity    Vertex count the buffer can hold
+         * @param usage             Buffer usage
+         *
+         * Allocates the buffer storage, attaches it to the transform
+         * feedback object and sets up primitive of @ref mesh() to match
+         * @p primitiveMode. Expects that both @p vertexStride and
+         * @p vertexCapacity are non-zero. The vertex layout has to be specified by the
+         * application.
+         * @see @ref Buffer::setData(), @ref TransformFeedback::attachBuffer()
+         */
+        explicit TransformFeedbackCache(TransformFeedback::PrimitiveMode primitiveMode, UnsignedInt vertexStride, UnsignedInt vertexCapacity, BufferUsage usage = BufferUsage::DynamicCopy);
+
+        /** @brief Copying is not allowed */
+        TransformFeedbackCache(const TransformFeedbackCache&) = delete;
+
+        /** @brief Moving is not allowed */
+        TransformFeedbackCache(TransformFeedbackCache&&) = delete;
+
+        /** @brief Copying is not allowed */
+        TransformFeedbackCache& operator=(const TransformFeedbackCache&) = delete;
+
+        /** @brief Moving is not allowed */
+        TransformFeedbackCache& operator=(TransformFeedbackCache&&) = delete;
+
+        /** @brief Captured primitive mode */
+        TransformFeedback::PrimitiveMode primitiveMode() const { return _primitiveMode; }
+
+        /** @brief Size of one captured vertex in bytes */
+        UnsignedInt vertexStride() const { return _vertexStride; }
+
+        /** @brief Vertex count the buffer can hold */
+        UnsignedInt vertexCapacity() const { return _vertexCapacity; }
+
+        /** @brief Buffer with captured vertices */
+        Buffer& buffer() { return _buffer; }
+
+        /** @brief Mesh drawing the captured vertices */
+        Mesh& mesh() { return _mesh; }
+
+        /** @brief Transform feedback object */
+        TransformFeedback& transformFeedback() { return _feedback; }
+
+        /**
+         * @brief Whether anything was captured
+         *
+         * @see @ref capture()
+         */
+        bool isCaptured() const { return _captured; }
+
+        /**
+         * @brief Capture transformed vertices of a mesh
+         * @param shader    Shader to transform the vertices with
+         * @param mesh      Mesh to capture
+         *
+         * Draws @p mesh with @p shader with rasterization disabled and
+         * captures the output into @ref buffer(), replacing previously
+         * captured contents. Expects that @p shader has transform feedback
+         * outputs matching layout of @ref mesh() and that primitive of
+         * @p mesh is compatible with @ref primitiveMode().
+         * @see @ref TransformFeedback::begin(), @ref TransformFeedback::end(),
+         *      @ref PrimitiveQuery::Target::TransformFeedbackPrimitivesWritten
+         */
+        void capture(AbstractShaderProgram& shader, Mesh& mesh);
+
+        /** @overload */
+        void capture(AbstractShaderProgram&& shader, Mesh& mesh) {
+            capture(shader, mesh);
+        }
+
+        /**
+         * @brief Captured vertex count
+         *
+         * Waits for the query result. Expects that @ref capture() was called
+         * before.
+         * @see @ref isCaptured(), @ref PrimitiveQuery::result()
+         */
+        UnsignedInt vertexCount();
+
+        /**
+         * @brief Whether the last capture didn't fit into the buffer
+         *
+         * Waits for the query result. Expects that @ref capture() was called
+         * before. See @ref TransformFeedbackCache-vertex-count-and-overflow-checks "class documentation"
+         * for more information.
+         * @see @ref isCaptured()
+         */
+        bool hasOverflow();
+
+        /**
+         * @brief Draw the captured vertices
+         *
+         * Expects that @ref capture() was called before and that @p shader
+         * is compatible with @ref mesh(). See
+         * @ref TransformFeedbackCache-vertex-count-and-overflow-checks "class documentation"
+         * for information about how the vertex count is determined.
+         * @see @ref Mesh::draw(AbstractShaderProgram&, TransformFeedback&, UnsignedInt)
+         */
+        void draw(AbstractShaderProgram& shader);
+
+        /** @overload */
+        void draw(AbstractShaderProgram&& shader) {
+            draw(shader);
+        }
+
+    private:
+        UnsignedInt MAGNUM_LOCAL verticesPerPrimitive() const;
+
+        TransformFeedback::PrimitiveMode _primitiveMode;
+        UnsignedInt _vertexStride, _vertexCapacity;
+        bool _captured;
+        Buffer _buffer;
+        Mesh _mesh;
+        TransformFeedback _feedback;
+        PrimitiveQuery _written;
+        #ifndef MAGNUM_TARGET_WEBGL
+        PrimitiveQuery _generated;
+        #endif
+};
+
+}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
@@ -0,0 +1,327 @@
+#ifndef Magnum_UniformBlock_h
+#define Magnum_UniformBlock_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::UniformBlock, @ref Magnum::UniformBlockBuffer
+ */
+#endif
+
+#include <cstring>
+#include <tuple>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Buffer.h"
+#include "Magnum/Math/RectangularMatrix.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum {
+
+namespace Implementation {
+    /* Scalars */
+    struct Std140Scalar {
+        enum: std::size_t { Alignment = 4, Size = 4 };
+
+        template<class T> static void write(char* const out, const T& value) {
+            static_assert(sizeof(T) == 4, "only 32-bit types are supported in uniform blocks");
+            std::memcpy(out, &value, 4);
+        }
+    };
+
+    /* Two-component vectors are aligned to 8 bytes, three- and
+       four-component vectors to 16 bytes */
+    template<std::size_t size> struct Std140Vector {
+        enum: std::size_t {
+            Alignment = size == 1 ? 4 : size == 2 ? 8 : 16,
+            Size = 4*size
+        };
+
+        template<class T> static void write(char* const out, const Math::Vector<size, T>& value) {
+            static_assert(sizeof(T) == 4, "only 32-bit types are supported in uniform blocks");
+            std::memcpy(out, value.data(), 4*size);
+        }
+    };
+
+    /* Column-major matrices are stored as array of columns, each column is
+       padded to four components */
+    template<std::size_t cols, std::size_t rows> struct Std140Matrix {
+        enum: std::size_t { Alignment = 16, Size = 16*cols };
+
+        template<class T> static void write(char* const out, const Math::RectangularMatrix<cols, rows, T>& value) {
+            static_assert(sizeof(T) == 4, "only 32-bit types are supported in uniform blocks");
+            for(std::size_t i = 0; i != cols; ++i)
+                std::memcpy(out + 16*i, value[i].data(), 4*rows);
+        }
+    };
+
+    /* Overloads taking pointers to base classes, so e.g. Color4 or Matrix4
+       pick up the layout of their base type. Used only in unevaluated
+       context. */
+    Std140Scalar std140TraitsFor(const Float*);
+    Std140Scalar std140TraitsFor(const Int*);
+    Std140Scalar std140TraitsFor(const UnsignedInt*);
+    template<std::size_t size, class T> Std140Vector<size> std140TraitsFor(const Math::Vector<size, T>*);
+    template<std::size_t cols, std::size_t rows, class T> Std140Matrix<cols, rows> std140TraitsFor(const Math::RectangularMatrix<cols, rows, T>*);
+
+    template<class T> using Std140Traits = decltype(std140TraitsFor(static_cast<const T*>(nullptr)));
+
+    /* Offset of each member is the end of previous member rounded up to its
+       alignment */
+    template<std::size_t, class...> struct Std140Layout;
+    template<std::size_t offset> struct Std140Layout<offset> {
+        enum: std::size_t { End = offset };
+    };
+    template<std::size_t offset, class First, class ...Next> struct Std140Layout<offset, First, Next...> {
+        enum: std::size_t {
+            Offset = (offset + Std140Traits<First>::Alignment - 1)/Std140Traits<First>::Alignment*Std140Traits<First>::Alignment
+        };
+
+        typedef Std140Layout<Offset + Std140Traits<First>::Size, Next...> NextLayout;
+
+        enum: std::size_t { End = NextLayout::End };
+    };
+
+    template<std::size_t i, class Layout> struct Std140LayoutAt {
+        enum: std::size_t { Offset = Std140LayoutAt<i - 1, typename Layout::NextLayout>::Offset };
+    };
+    template<class Layout> struct Std140LayoutAt<0, Layout> {
+        enum: std::size_t { Offset = Layout::Offset };
+    };
+}
+
+/**
+@brief Uniform block
+
+Data of a uniform block with `std140` layout, with the member types given as
+template parameters in the same order as in the shader. The member offsets are
+calculated at compile time. Supported member types are @ref Float, @ref Int,
+@ref UnsignedInt and vectors and matrices of them, including their subclasses
+such as @ref Color4. Example for a block declared like this:
+@code
+layout(std140) uniform material {
+    mediump mat3 normalMatrix;
+    lowp vec4 diffuseColor;
+    mediump float shininess;
+};
+@endcode
+@code
+typedef UniformBlock<Matrix3x3, Color4, Float> MaterialBlock;
+
+static_assert(MaterialBlock::offset<1>() == 48, "");
+
+MaterialBlock block;
+block.set<0>(transformation.rotation())
+    .set<1>(Color4::fromHSV(216.0_degf, 0.85f, 1.0f))
+    .set<2>(80.0f);
+buffer.setData(block.data(), BufferUsage::DynamicDraw);
+@endcode
+
+Use @ref UniformBlockBuffer to store blocks of many objects in a single buffer.
+See @ref AbstractShaderProgram-uniform-block-binding "AbstractShaderProgram documentation"
+for information about binding the blocks to shaders.
+@requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+@requires_gles30 Uniform buffers are not available in OpenGL ES 2.0.
+@requires_webgl20 Uniform buffers are not available in WebGL 1.0.
+*/
+template<class ...Types> class UniformBlock {
+    static_assert(sizeof...(Types), "uniform block must have at least one member");
+
+    public:
+        enum: std::size_t {
+            /**
+             * Block size in bytes. Rounded up to multiple of 16 bytes, so it
+             * is large enough for binding as @ref Buffer::Target::Uniform.
+             */
+            Size = (Implementation::Std140Layout<0, Types...>::End + 15)/16*16
+        };
+
+        /** @brief Type of member @p i */
+        template<std::size_t i> using Type = typename std::tuple_element<i, std::tuple<Types...>>::type;
+
+        /** @brief Offset of member @p i in bytes */
+        template<std::size_t i> constexpr static std::size_t offset() {
+            return Implementation::Std140LayoutAt<i, Implementation::Std140Layout<0, Types...>>::Offset;
+        }
+
+        /**
+         * @brief Write member @p i to given memory
+         *
+         * The @p data are expected to point to the beginning of the block
+         * and have at least @ref Size bytes.
+         */
+        template<std::size_t i> static void write(char* data, const Type<i>& value) {
+            Implementation::Std140Traits<Type<i>>::write(data + offset<i>(), value);
+        }
+
+        /**
+         * @brief Constructor
+         *
+         * All members are zero-initialized.
+         */
+        constexpr /*implicit*/ UniformBlock(): _data{} {}
+
+        /**
+         * @brief Set member @p i
+         * @return Reference to self (for method chaining)
+         */
+        template<std::size_t i> UniformBlock<Types...>& set(const Type<i>& value) {
+            write<i>(_data, value);
+            return *this;
+        }
+
+        /** @brief Block data */
+        Containers::ArrayView<const char> data() const { return _data; }
+
+    private:
+        char _data[Size];
+};
+
+/**
+@brief Buffer with uniform blocks of many objects
+
+Stores uniform blocks of @p Block type for all objects in a single
+@ref Buffer, with the blocks aligned to @ref Buffer::uniformOffsetAlignment().
+The data are collected on the client side with @ref set(), uploaded using a
+single @ref upload() call and each object then binds its block range before
+drawing with @ref bind(), which is much cheaper than setting all the uniforms
+separately:
+@code
+typedef UniformBlock<Matrix4, Color4> Block;
+UniformBlockBuffer<Block> blocks{objects.size()};
+
+for(std::size_t i = 0; i != objects.size(); ++i)
+    blocks.set<0>(i, objects[i].transformationProjectionMatrix)
+          .set<1>(i, objects[i].color);
+blocks.upload();
+
+for(std::size_t i = 0; i != objects.size(); ++i) {
+    blocks.bind(0, i);
+    objects[i].mesh.draw(shader);
+}
+@endcode
+@requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+@requires_gles30 Uniform buffers are not available in OpenGL ES 2.0.
+@requires_webgl20 Uniform buffers are not available in WebGL 1.0.
+*/
+template<class Block> class UniformBlockBuffer {
+    public:
+        /**
+         * @brief Constructor
+         * @param count     Count of blocks
+         * @param usage     Buffer usage used in @ref upload()
+         *
+         * The client-side data are zero-initialized, the buffer is left
+         * empty until @ref upload() is called.
+         * @see @ref Buffer::uniformOffsetAlignment()
+         */
+        explicit UniformBlockBuffer(std::size_t count, BufferUsage usage = BufferUsage::DynamicDraw);
+
+        /** @brief Count of blocks */
+        std::size_t count() const { return _count; }
+
+        /**
+         * @brief Distance between two consecutive blocks in bytes
+         *
+         * Block size rounded up to @ref Buffer::uniformOffsetAlignment().
+         */
+        std::size_t stride() const { return _stride; }
+
+        /** @brief Underlying buffer */
+        Buffer& buffer() { return _buffer; }
+
+        /**
+         * @brief Set member @p i of block @p index
+         * @return Reference to self (for method chaining)
+         *
+         * Changes only the client-side data, call @ref upload() to make the
+         * change visible to the GL.
+         */
+        template<std::size_t i> UniformBlockBuffer<Block>& set(std::size_t index, const typename Block::template Type<i>& value) {
+            CORRADE_ASSERT(index < _count, "UniformBlockBuffer::set(): index" << index << "out of range for" << _count << "blocks", *this);
+            Block::template write<i>(_data + index*_stride, value);
+            return *this;
+        }
+
+        /**
+         * @brief Set whole block @p index
+         * @return Reference to self (for method chaining)
+         *
+         * Changes only the client-side data, call @ref upload() to make the
+         * change visible to the GL.
+         */
+        UniformBlockBuffer<Block>& set(std::size_t index, const Block& block) {
+            CORRADE_ASSERT(index < _count, "UniformBlockBuffer::set(): index" << index << "out of range for" << _count << "blocks", *this);
+            std::memcpy(_data + index*_stride, block.data().data(), Block::Size);
+            return *this;
+        }
+
+        /**
+         * @brief Upload the data to the buffer
+         * @return Reference to self (for method chaining)
+         *
+         * Uploads data of all blocks in one call, replacing previous buffer
+         * storage.
+         * @see @ref Buffer::setData()
+         */
+        UniformBlockBuffer<Block>& upload() {
+            _buffer.setData(_data, _usage);
+            return *this;
+        }
+
+        /**
+         * @brief Bind block @p index to given uniform buffer binding
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Buffer::bind(Buffer::Target, UnsignedInt, GLintptr, GLsizeiptr),
+         *      @ref AbstractShaderProgram::setUniformBlockBinding()
+         */
+        UniformBlockBuffer<Block>& bind(UnsignedInt binding, std::size_t index) {
+            CORRADE_ASSERT(index < _count, "UniformBlockBuffer::bind(): index" << index << "out of range for" << _count << "blocks", *this);
+            _buffer.bind(Buffer::Target::Uniform, binding, index*_stride, Block::Size);
+            return *this;
+        }
+
+    private:
+        Buffer _buffer;
+        BufferUsage _usage;
+        std::size_t _count, _stride;
+        Containers::Array<char> _data;
+};
+
+template<class Block> UniformBlockBuffer<Block>::UniformBlockBuffer(const std::size_t count, const BufferUsage usage): _buffer{Buffer::TargetHint::Uniform}, _usage{usage}, _count{count} {
+    const std::size_t alignment = Buffer::uniformOffsetAlignment();
+    _stride = (Block::Size + alignment - 1)/alignment*alignment;
+    _data = Containers::Array<char>{Containers::ValueInit, count*_stride};
+}
+
+}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
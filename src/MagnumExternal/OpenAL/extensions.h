@@ -26,6 +26,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <stdint.h>
 #include <al.h>
 #include <alc.h>
 
@@ -86,6 +87,26 @@ extern "C" {
 #define AL_FORMAT_71CHN32                        0x1212
 #endif
 
+/* AL_SOFT_source_latency */
+#ifndef AL_SOFT_source_latency
+#define AL_SOFT_source_latency 1
+#define AL_SAMPLE_OFFSET_LATENCY_SOFT            0x1200
+#define AL_SEC_OFFSET_LATENCY_SOFT               0x1201
+
+typedef void (AL_APIENTRY*LPALGETSOURCEDVSOFT)(ALuint,ALenum,ALdouble*);
+#endif
+
+/* ALC_SOFT_device_clock */
+#ifndef ALC_SOFT_device_clock
+#define ALC_SOFT_device_clock 1
+typedef int64_t ALCint64SOFT;
+#define ALC_DEVICE_CLOCK_SOFT                    0x1600
+#define ALC_DEVICE_LATENCY_SOFT                  0x1601
+#define ALC_DEVICE_CLOCK_LATENCY_SOFT            0x1602
+
+typedef void (AL_APIENTRY*LPALCGETINTEGER64VSOFT)(ALCdevice*,ALCenum,ALsizei,ALCint64SOFT*);
+#endif
+
 /* ALC_SOFTX_HRTF */
 #ifndef ALC_SOFTX_HRTF
 #define ALC_SOFTX_HRTF 1
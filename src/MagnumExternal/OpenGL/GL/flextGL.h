@@ -1753,6 +1753,11 @@ typedef void (APIENTRY *GLDEBUGPROC)(GLenum source,GLenum type,GLuint id,GLenum
 
 #define GL_CONTEXT_FLAG_NO_ERROR_BIT_KHR 0x00000008
 
+/* GL_KHR_parallel_shader_compile */
+
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+
 /* Function prototypes */
 
 /* GL_ARB_bindless_texture */
@@ -994,6 +994,11 @@ typedef khronos_ssize_t GLsizeiptr;
 
 #define GL_CONTEXT_FLAG_NO_ERROR_BIT_KHR 0x00000008
 
+/* GL_KHR_parallel_shader_compile */
+
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+
 /* GL_NV_texture_border_clamp */
 
 #define GL_TEXTURE_BORDER_COLOR_NV 0x1004
@@ -0,0 +1,407 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "CachingImporter.h"
+
+#include <cstring>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Configuration.h>
+#include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/Sha1.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/AbstractMaterialData.h"
+#include "Magnum/Trade/CameraData.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/LightData.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/MeshData2D.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "Magnum/Trade/ObjectData2D.h"
+#include "Magnum/Trade/ObjectData3D.h"
+#include "Magnum/Trade/SceneData.h"
+#include "Magnum/Trade/TextureData.h"
+#include "MagnumPlugins/MagnumMeshConverter/MagnumMeshConverter.h"
+#include "MagnumPlugins/MagnumMeshImporter/MagnumMeshImporter.h"
+
+namespace Magnum { namespace Trade {
+
+namespace {
+    /* Header of the cached image, followed by the pixel data */
+    struct ImageHeader {
+        char magic[4];
+        UnsignedInt format;
+        UnsignedInt type;
+        Int alignment;
+        Vector2i size;
+        UnsignedLong dataSize;
+    };
+
+    constexpr const char ImageMagic[] = {'M', 'G', 'I', 'M'};
+
+    /* Bump when the manifest or the image format changes */
+    constexpr UnsignedInt CacheVersion = 1;
+
+    /* Only the alignment is saved in the cache */
+    bool isCacheable(const ImageData2D& image) {
+        if(image.isCompressed()) return false;
+
+        const PixelStorage storage = image.storage();
+        #ifndef MAGNUM_TARGET_GLES
+        if(storage.swapBytes()) return false;
+        #endif
+        #if !(defined(MAGNUM_TARGET_GLES2) && defined(MAGNUM_TARGET_WEBGL))
+        if(storage.rowLength()) return false;
+        #endif
+        return storage.skip() == Vector3i{};
+    }
+}
+
+struct CachingImporter::State {
+    /* Either the filename or a copy of the data, used for opening the
+       wrapped importer on demand */
+    std::string filename;
+    Containers::Array<char> data;
+
+    std::string path;
+    bool importerOpened{};
+
+    std::vector<std::string> mesh3DNames, image2DNames;
+
+    /* Opened cache entries, kept around so the meshes can reference the
+       mapped memory */
+    std::vector<std::unique_ptr<MagnumMeshImporter>> meshes;
+};
+
+CachingImporter::CachingImporter(): _hits{}, _misses{} {}
+
+CachingImporter::CachingImporter(std::unique_ptr<AbstractImporter> importer, std::string cacheDirectory): CachingImporter{} {
+    setImporter(std::move(importer));
+    setCacheDirectory(std::move(cacheDirectory));
+}
+
+CachingImporter::CachingImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImporter{manager, std::move(plugin)}, _hits{}, _misses{} {}
+
+CachingImporter::~CachingImporter() = default;
+
+CachingImporter& CachingImporter::setImporter(std::unique_ptr<AbstractImporter> importer) {
+    CORRADE_ASSERT(!_state, "Trade::CachingImporter::setImporter(): the importer is in use", *this);
+    _importer = std::move(importer);
+    return *this;
+}
+
+CachingImporter& CachingImporter::setCacheDirectory(std::string directory) {
+    CORRADE_ASSERT(!_state, "Trade::CachingImporter::setCacheDirectory(): the importer is in use", *this);
+    _cacheDirectory = std::move(directory);
+    Utility::Directory::mkpath(_cacheDirectory);
+    return *this;
+}
+
+auto CachingImporter::doFeatures() const -> Features { return Feature::OpenData; }
+
+bool CachingImporter::doIsOpened() const { return !!_state; }
+
+void CachingImporter::doClose() {
+    _state = nullptr;
+    if(_importer) _importer->close();
+}
+
+void CachingImporter::doOpenData(const Containers::ArrayView<const char> data) {
+    CORRADE_ASSERT(_importer && !_cacheDirectory.empty(),
+        "Trade::CachingImporter::openData(): no importer or cache directory set", );
+
+    _state.reset(new State);
+    _state->data = Containers::Array<char>{data.size()};
+    std::copy(data.begin(), data.end(), _state->data.begin());
+    openInternal(data);
+}
+
+void CachingImporter::doOpenFile(const std::string& filename) {
+    CORRADE_ASSERT(_importer && !_cacheDirectory.empty(),
+        "Trade::CachingImporter::openFile(): no importer or cache directory set", );
+
+    /* The data are needed only for computing the key, the wrapped importer
+       gets the file so it can open files referenced from it. */
+    if(!Utility::Directory::fileExists(filename)) {
+        Error() << "Trade::CachingImporter::openFile(): cannot open file" << filename;
+        return;
+    }
+
+    _state.reset(new State);
+    _state->filename = filename;
+    openInternal(Utility::Directory::read(filename));
+}
+
+void CachingImporter::openInternal(const Containers::ArrayView<const char> data) {
+    /* The key includes the importer name so multiple importers can share a
+       cache directory */
+    _state->path = Utility::Directory::join(_cacheDirectory, Utility::Sha1::digest(_importer->plugin() + '\0' + std::string{data, data.size()}).hexString());
+    const std::string manifestFilename = Utility::Directory::join(_state->path, "manifest.conf");
+
+    /* Cache hit */
+    if(Utility::Directory::fileExists(manifestFilename)) {
+        const Utility::Configuration manifest{manifestFilename, Utility::Configuration::Flag::ReadOnly};
+        if(manifest.isValid() && manifest.value<UnsignedInt>("version") == CacheVersion) {
+            _state->mesh3DNames = manifest.values("mesh3D");
+            _state->image2DNames = manifest.values("image2D");
+            _state->meshes.resize(_state->mesh3DNames.size());
+            ++_hits;
+            return;
+        }
+    }
+
+    /* Cache miss, import the file. The wrapped importer prints the message
+       on failure. */
+    ++_misses;
+    if(!openImporter()) {
+        _state = nullptr;
+        return;
+    }
+
+    for(UnsignedInt i = 0; i != _importer->mesh3DCount(); ++i)
+        _state->mesh3DNames.push_back(_importer->mesh3DName(i));
+    for(UnsignedInt i = 0; i != _importer->image2DCount(); ++i)
+        _state->image2DNames.push_back(_importer->image2DName(i));
+    _state->meshes.resize(_state->mesh3DNames.size());
+
+    Utility::Directory::mkpath(_state->path);
+    Utility::Configuration manifest{manifestFilename, Utility::Configuration::Flag::Truncate};
+    manifest.setValue("version", CacheVersion);
+    for(const std::string& name: _state->mesh3DNames)
+        manifest.addValue("mesh3D", name);
+    for(const std::string& name: _state->image2DNames)
+        manifest.addValue("image2D", name);
+    if(!manifest.save())
+        Warning() << "Trade::CachingImporter::openData(): cannot write cache manifest to" << manifestFilename;
+}
+
+bool CachingImporter::openImporter() const {
+    if(_state->importerOpened) return true;
+
+    if(_state->filename.empty())
+        _state->importerOpened = _importer->openData(_state->data);
+    else
+        _state->importerOpened = _importer->openFile(_state->filename);
+    return _state->importerOpened;
+}
+
+AbstractImporter* CachingImporter::cachedMesh(const UnsignedInt id) {
+    std::unique_ptr<MagnumMeshImporter>& mesh = _state->meshes[id];
+    if(mesh) return mesh.get();
+
+    mesh.reset(new MagnumMeshImporter);
+
+    /* Corrupted entries or entries for a different version are silently
+       replaced */
+    const std::string filename = Utility::Directory::join(_state->path, "mesh3D-" + std::to_string(id) + ".mgmesh");
+    if(Utility::Directory::fileExists(filename)) {
+        Error redirectError{nullptr};
+        if(mesh->openFile(filename)) {
+            ++_hits;
+            return mesh.get();
+        }
+    }
+
+    ++_misses;
+    std::optional<MeshData> data;
+    if(!openImporter() || !(data = _importer->mesh(id))) {
+        mesh = nullptr;
+        return nullptr;
+    }
+
+    Containers::Array<char> out = MagnumMeshConverter{}.exportToData(*data);
+    if(!out || !mesh->openData(out)) {
+        mesh = nullptr;
+        return nullptr;
+    }
+
+    if(!Utility::Directory::write(filename, out))
+        Warning() << "Trade::CachingImporter::mesh(): cannot write cache entry to" << filename;
+
+    return mesh.get();
+}
+
+UnsignedInt CachingImporter::doMesh3DCount() const { return _state->mesh3DNames.size(); }
+
+Int CachingImporter::doMesh3DForName(const std::string& name) {
+    for(std::size_t i = 0; i != _state->mesh3DNames.size(); ++i)
+        if(_state->mesh3DNames[i] == name) return i;
+    return -1;
+}
+
+std::string CachingImporter::doMesh3DName(const UnsignedInt id) { return _state->mesh3DNames[id]; }
+
+std::optional<MeshData3D> CachingImporter::doMesh3D(const UnsignedInt id) {
+    AbstractImporter* const mesh = cachedMesh(id);
+    if(!mesh) return std::nullopt;
+    return mesh->mesh3D(0);
+}
+
+std::optional<MeshData> CachingImporter::doMesh(const UnsignedInt id) {
+    AbstractImporter* const mesh = cachedMesh(id);
+    if(!mesh) return std::nullopt;
+    return mesh->mesh(0);
+}
+
+UnsignedInt CachingImporter::doImage2DCount() const { return _state->image2DNames.size(); }
+
+Int CachingImporter::doImage2DForName(const std::string& name) {
+    for(std::size_t i = 0; i != _state->image2DNames.size(); ++i)
+        if(_state->image2DNames[i] == name) return i;
+    return -1;
+}
+
+std::string CachingImporter::doImage2DName(const UnsignedInt id) { return _state->image2DNames[id]; }
+
+std::optional<ImageData2D> CachingImporter::doImage2D(const UnsignedInt id) {
+    const std::string filename = Utility::Directory::join(_state->path, "image2D-" + std::to_string(id) + ".bin");
+
+    /* Cache hit, corrupted entries are silently replaced */
+    if(Utility::Directory::fileExists(filename)) {
+        const Containers::Array<char> data = Utility::Directory::read(filename);
+        ImageHeader header;
+        if(data.size() >= sizeof(ImageHeader)) {
+            std::memcpy(&header, data.data(), sizeof(ImageHeader));
+            if(std::memcmp(header.magic, ImageMagic, sizeof(ImageMagic)) == 0 && data.size() == sizeof(ImageHeader) + header.dataSize) {
+                Containers::Array<char> pixels{std::size_t(header.dataSize)};
+                std::copy(data.begin() + sizeof(ImageHeader), data.end(), pixels.begin());
+                ++_hits;
+                return ImageData2D{PixelStorage{}.setAlignment(header.alignment), PixelFormat(header.format), PixelType(header.type), header.size, std::move(pixels)};
+            }
+        }
+    }
+
+    ++_misses;
+    if(!openImporter()) return std::nullopt;
+
+    std::optional<ImageData2D> image = _importer->image2D(id);
+    if(!image || !isCacheable(*image)) return image;
+
+    ImageHeader header;
+    std::memcpy(header.magic, ImageMagic, sizeof(ImageMagic));
+    header.format = UnsignedInt(image->format());
+    header.type = UnsignedInt(image->type());
+    header.alignment = image->storage().alignment();
+    header.size = image->size();
+    header.dataSize = image->data().size();
+
+    Containers::Array<char> data{Containers::NoInit, sizeof(ImageHeader) + image->data().size()};
+    std::memcpy(data.data(), &header, sizeof(ImageHeader));
+    std::copy(image->data().begin(), image->data().end(), data.begin() + sizeof(ImageHeader));
+    if(!Utility::Directory::write(filename, data))
+        Warning() << "Trade::CachingImporter::image2D(): cannot write cache entry to" << filename;
+
+    return image;
+}
+
+/* Everything else is delegated to the wrapped importer, which is opened on
+   demand. The *Name() and data accessors are called only if the count is
+   nonzero, so the importer is already opened at that point. */
+
+Int CachingImporter::doDefaultScene() { return openImporter() ? _importer->defaultScene() : -1; }
+
+UnsignedInt CachingImporter::doSceneCount() const { return openImporter() ? _importer->sceneCount() : 0; }
+
+Int CachingImporter::doSceneForName(const std::string& name) { return openImporter() ? _importer->sceneForName(name) : -1; }
+
+std::string CachingImporter::doSceneName(const UnsignedInt id) { return _importer->sceneName(id); }
+
+std::optional<SceneData> CachingImporter::doScene(const UnsignedInt id) { return _importer->scene(id); }
+
+UnsignedInt CachingImporter::doLightCount() const { return openImporter() ? _importer->lightCount() : 0; }
+
+Int CachingImporter::doLightForName(const std::string& name) { return openImporter() ? _importer->lightForName(name) : -1; }
+
+std::string CachingImporter::doLightName(const UnsignedInt id) { return _importer->lightName(id); }
+
+std::optional<LightData> CachingImporter::doLight(const UnsignedInt id) { return _importer->light(id); }
+
+UnsignedInt CachingImporter::doCameraCount() const { return openImporter() ? _importer->cameraCount() : 0; }
+
+Int CachingImporter::doCameraForName(const std::string& name) { return openImporter() ? _importer->cameraForName(name) : -1; }
+
+std::string CachingImporter::doCameraName(const UnsignedInt id) { return _importer->cameraName(id); }
+
+std::optional<CameraData> CachingImporter::doCamera(const UnsignedInt id) { return _importer->camera(id); }
+
+UnsignedInt CachingImporter::doObject2DCount() const { return openImporter() ? _importer->object2DCount() : 0; }
+
+Int CachingImporter::doObject2DForName(const std::string& name) { return openImporter() ? _importer->object2DForName(name) : -1; }
+
+std::string CachingImporter::doObject2DName(const UnsignedInt id) { return _importer->object2DName(id); }
+
+std::unique_ptr<ObjectData2D> CachingImporter::doObject2D(const UnsignedInt id) { return _importer->object2D(id); }
+
+UnsignedInt CachingImporter::doObject3DCount() const { return openImporter() ? _importer->object3DCount() : 0; }
+
+Int CachingImporter::doObject3DForName(const std::string& name) { return openImporter() ? _importer->object3DForName(name) : -1; }
+
+std::string CachingImporter::doObject3DName(const UnsignedInt id) { return _importer->object3DName(id); }
+
+std::unique_ptr<ObjectData3D> CachingImporter::doObject3D(const UnsignedInt id) { return _importer->object3D(id); }
+
+UnsignedInt CachingImporter::doMesh2DCount() const { return openImporter() ? _importer->mesh2DCount() : 0; }
+
+Int CachingImporter::doMesh2DForName(const std::string& name) { return openImporter() ? _importer->mesh2DForName(name) : -1; }
+
+std::string CachingImporter::doMesh2DName(const UnsignedInt id) { return _importer->mesh2DName(id); }
+
+std::optional<MeshData2D> CachingImporter::doMesh2D(const UnsignedInt id) { return _importer->mesh2D(id); }
+
+UnsignedInt CachingImporter::doMaterialCount() const { return openImporter() ? _importer->materialCount() : 0; }
+
+Int CachingImporter::doMaterialForName(const std::string& name) { return openImporter() ? _importer->materialForName(name) : -1; }
+
+std::string CachingImporter::doMaterialName(const UnsignedInt id) { return _importer->materialName(id); }
+
+std::unique_ptr<AbstractMaterialData> CachingImporter::doMaterial(const UnsignedInt id) { return _importer->material(id); }
+
+UnsignedInt CachingImporter::doTextureCount() const { return openImporter() ? _importer->textureCount() : 0; }
+
+Int CachingImporter::doTextureForName(const std::string& name) { return openImporter() ? _importer->textureForName(name) : -1; }
+
+std::string CachingImporter::doTextureName(const UnsignedInt id) { return _importer->textureName(id); }
+
+std::optional<TextureData> CachingImporter::doTexture(const UnsignedInt id) { return _importer->texture(id); }
+
+UnsignedInt CachingImporter::doImage1DCount() const { return openImporter() ? _importer->image1DCount() : 0; }
+
+Int CachingImporter::doImage1DForName(const std::string& name) { return openImporter() ? _importer->image1DForName(name) : -1; }
+
+std::string CachingImporter::doImage1DName(const UnsignedInt id) { return _importer->image1DName(id); }
+
+std::optional<ImageData1D> CachingImporter::doImage1D(const UnsignedInt id) { return _importer->image1D(id); }
+
+UnsignedInt CachingImporter::doImage3DCount() const { return openImporter() ? _importer->image3DCount() : 0; }
+
+Int CachingImporter::doImage3DForName(const std::string& name) { return openImporter() ? _importer->image3DForName(name) : -1; }
+
+std::string CachingImporter::doImage3DName(const UnsignedInt id) { return _importer->image3DName(id); }
+
+std::optional<ImageData3D> CachingImporter::doImage3D(const UnsignedInt id) { return _importer->image3D(id); }
+
+}}
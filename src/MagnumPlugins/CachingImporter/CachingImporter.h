@@ -0,0 +1,240 @@
+#ifndef Magnum_Trade_CachingImporter_h
+#define Magnum_Trade_CachingImporter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::CachingImporter
+ */
+
+#include <memory>
+
+#include "Magnum/Trade/AbstractImporter.h"
+
+#include "MagnumPlugins/CachingImporter/configure.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_CACHINGIMPORTER_BUILD_STATIC
+    #if defined(CachingImporter_EXPORTS) || defined(CachingImporterObjects_EXPORTS)
+        #define MAGNUM_CACHINGIMPORTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_CACHINGIMPORTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_CACHINGIMPORTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_CACHINGIMPORTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Caching importer plugin
+
+Wraps another importer and caches the imported meshes and images on disk,
+keyed by SHA-1 of the input data and the name of the wrapped plugin. When the
+same data are opened again, @ref mesh(), @ref mesh3D() and @ref image2D() are
+served directly from the cache without the wrapped importer ever parsing the
+file:
+@code
+PluginManager::Manager<Trade::AbstractImporter> manager{MAGNUM_PLUGINS_IMPORTER_DIR};
+Trade::CachingImporter importer{manager.loadAndInstantiate("ObjImporter"),
+    Utility::Directory::join(Utility::Directory::configurationDir("MyApp"), "meshes")};
+
+importer.openFile("scene.obj"); // parsed only on the first run
+std::optional<Trade::MeshData> mesh = importer.mesh(0);
+@endcode
+
+Meshes are stored in the format of @ref MagnumMeshConverter, so on Unix
+@ref mesh() returns data referencing a memory-mapped cache file directly,
+valid until the importer is closed. Uncompressed images are stored as a raw
+dump of the pixel data with a small header. Counts and names of meshes and
+images are saved in a manifest when the file is first opened, cache entries
+are then written on first access. Compressed images and all other data
+(scenes, objects, materials, ...) are not cached and accessing them opens the
+wrapped importer on demand. Cache entries that fail to load (e.g. because
+they were written by a different version or on a machine with different
+endianness) are treated as a miss and overwritten. The cache effectiveness can
+be checked with @ref hits() and @ref misses().
+
+This plugin depends on @ref MagnumMeshImporter and @ref MagnumMeshConverter
+plugins and is built if `WITH_CACHINGIMPORTER` is enabled when building
+Magnum. To use dynamic plugin, you need to load `CachingImporter` plugin from
+`MAGNUM_PLUGINS_IMPORTER_DIR` and then specify the wrapped importer and cache
+directory using @ref setImporter() and @ref setCacheDirectory() before
+opening any file. To use static plugin or use this as a dependency of another
+plugin, you need to request `CachingImporter` component of `Magnum` package
+in CMake and link to `Magnum::CachingImporter` target. See @ref building,
+@ref cmake and @ref plugins for more information.
+*/
+class MAGNUM_CACHINGIMPORTER_EXPORT CachingImporter: public AbstractImporter {
+    public:
+        /** @brief Default constructor */
+        explicit CachingImporter();
+
+        /**
+         * @brief Constructor
+         * @param importer          Wrapped importer
+         * @param cacheDirectory    Cache directory, created if it doesn't
+         *      exist
+         */
+        explicit CachingImporter(std::unique_ptr<AbstractImporter> importer, std::string cacheDirectory);
+
+        /** @brief Plugin manager constructor */
+        explicit CachingImporter(PluginManager::AbstractManager& manager, std::string plugin);
+
+        ~CachingImporter();
+
+        /** @brief Wrapped importer */
+        AbstractImporter* importer() { return _importer.get(); }
+
+        /**
+         * @brief Set wrapped importer
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that no file is opened.
+         */
+        CachingImporter& setImporter(std::unique_ptr<AbstractImporter> importer);
+
+        /** @brief Cache directory */
+        std::string cacheDirectory() const { return _cacheDirectory; }
+
+        /**
+         * @brief Set cache directory
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that no file is opened. The directory is created if it
+         * doesn't exist.
+         */
+        CachingImporter& setCacheDirectory(std::string directory);
+
+        /**
+         * @brief Count of cache hits
+         *
+         * Count of files whose manifest was found in the cache plus count of
+         * meshes and images loaded from the cache.
+         */
+        UnsignedInt hits() const { return _hits; }
+
+        /**
+         * @brief Count of cache misses
+         *
+         * Count of files, meshes and images that had to be imported using
+         * the wrapped importer.
+         */
+        UnsignedInt misses() const { return _misses; }
+
+    private:
+        struct MAGNUM_CACHINGIMPORTER_LOCAL State;
+
+        MAGNUM_CACHINGIMPORTER_LOCAL Features doFeatures() const override;
+        MAGNUM_CACHINGIMPORTER_LOCAL bool doIsOpened() const override;
+        MAGNUM_CACHINGIMPORTER_LOCAL void doOpenData(Containers::ArrayView<const char> data) override;
+        MAGNUM_CACHINGIMPORTER_LOCAL void doOpenFile(const std::string& filename) override;
+        MAGNUM_CACHINGIMPORTER_LOCAL void doClose() override;
+
+        MAGNUM_CACHINGIMPORTER_LOCAL Int doDefaultScene() override;
+        MAGNUM_CACHINGIMPORTER_LOCAL UnsignedInt doSceneCount() const override;
+        MAGNUM_CACHINGIMPORTER_LOCAL Int doSceneForName(const std::string& name) override;
+        MAGNUM_CACHINGIMPORTER_LOCAL std::string doSceneName(UnsignedInt id) override;
+        MAGNUM_CACHINGIMPORTER_LOCAL std::optional<SceneData> doScene(UnsignedInt id) override;
+
+        MAGNUM_CACHINGIMPORTER_LOCAL UnsignedInt doLightCount() const override;
+        MAGNUM_CACHINGIMPORTER_LOCAL Int doLightForName(const std::string& name) override;
+        MAGNUM_CACHINGIMPORTER_LOCAL std::string doLightName(UnsignedInt id) override;
+        MAGNUM_CACHINGIMPORTER_LOCAL std::optional<LightData> doLight(UnsignedInt id) override;
+
+        MAGNUM_CACHINGIMPORTER_LOCAL UnsignedInt doCameraCount() const override;
+        MAGNUM_CACHINGIMPORTER_LOCAL Int doCameraForName(const std::string& name) override;
+        MAGNUM_CACHINGIMPORTER_LOCAL std::string doCameraName(UnsignedInt id) override;
+        MAGNUM_CACHINGIMPORTER_LOCAL std::optional<CameraData> doCamera(UnsignedInt id) override;
+
+        MAGNUM_CACHINGIMPORTER_LOCAL UnsignedInt doObject2DCount() const override;
+        MAGNUM_CACHINGIMPORTER_LOCAL Int doObject2DForName(const std::string& name) override;
+        MAGNUM_CACHINGIMPORTER_LOCAL std::string doObject2DName(UnsignedInt id) override;
+        MAGNUM_CACHINGIMPORTER_LOCAL std::unique_ptr<ObjectData2D> doObject2D(UnsignedInt id) override;
+
+        MAGNUM_CACHINGIMPORTER_LOCAL UnsignedInt doObject3DCount() const override;
+        MAGNUM_CACHINGIMPORTER_LOCAL Int doObject3DForName(const std::string& name) override;
+        MAGNUM_CACHINGIMPORTER_LOCAL std::string doObject3DName(UnsignedInt id) override;
+        MAGNUM_CACHINGIMPORTER_LOCAL std::unique_ptr<ObjectData3D> doObject3D(UnsignedInt id) override;
+
+        MAGNUM_CACHINGIMPORTER_LOCAL UnsignedInt doMesh2DCount() const override;
+        MAGNUM_CACHINGIMPORTER_LOCAL Int doMesh2DForName(const std::string& name) override;
+        MAGNUM_CACHINGIMPORTER_LOCAL std::string doMesh2DName(UnsignedInt id) override;
+        MAGNUM_CACHINGIMPORTER_LOCAL std::optional<MeshData2D> doMesh2D(UnsignedInt id) override;
+
+        MAGNUM_CACHINGIMPORTER_LOCAL UnsignedInt doMesh3DCount() const override;
+        MAGNUM_CACHINGIMPORTER_LOCAL Int doMesh3DForName(const std::string& name) override;
+        MAGNUM_CACHINGIMPORTER_LOCAL std::string doMesh3DName(UnsignedInt id) override;
+        MAGNUM_CACHINGIMPORTER_LOCAL std::optional<MeshData3D> doMesh3D(UnsignedInt id) override;
+        MAGNUM_CACHINGIMPORTER_LOCAL std::optional<MeshData> doMesh(UnsignedInt id) override;
+
+        MAGNUM_CACHINGIMPORTER_LOCAL UnsignedInt doMaterialCount() const override;
+        MAGNUM_CACHINGIMPORTER_LOCAL Int doMaterialForName(const std::string& name) override;
+        MAGNUM_CACHINGIMPORTER_LOCAL std::string doMaterialName(UnsignedInt id) override;
+        MAGNUM_CACHINGIMPORTER_LOCAL std::unique_ptr<AbstractMaterialData> doMaterial(UnsignedInt id) override;
+
+        MAGNUM_CACHINGIMPORTER_LOCAL UnsignedInt doTextureCount() const override;
+        MAGNUM_CACHINGIMPORTER_LOCAL Int doTextureForName(const std::string& name) override;
+        MAGNUM_CACHINGIMPORTER_LOCAL std::string doTextureName(UnsignedInt id) override;
+        MAGNUM_CACHINGIMPORTER_LOCAL std::optional<TextureData> doTexture(UnsignedInt id) override;
+
+        MAGNUM_CACHINGIMPORTER_LOCAL UnsignedInt doImage1DCount() const override;
+        MAGNUM_CACHINGIMPORTER_LOCAL Int doImage1DForName(const std::string& name) override;
+        MAGNUM_CACHINGIMPORTER_LOCAL std::string doImage1DName(UnsignedInt id) override;
+        MAGNUM_CACHINGIMPORTER_LOCAL std::optional<ImageData1D> doImage1D(UnsignedInt id) override;
+
+        MAGNUM_CACHINGIMPORTER_LOCAL UnsignedInt doImage2DCount() const override;
+        MAGNUM_CACHINGIMPORTER_LOCAL Int doImage2DForName(const std::string& name) override;
+        MAGNUM_CACHINGIMPORTER_LOCAL std::string doImage2DName(UnsignedInt id) override;
+        MAGNUM_CACHINGIMPORTER_LOCAL std::optional<ImageData2D> doImage2D(UnsignedInt id) override;
+
+        MAGNUM_CACHINGIMPORTER_LOCAL UnsignedInt doImage3DCount() const override;
+        MAGNUM_CACHINGIMPORTER_LOCAL Int doImage3DForName(const std::string& name) override;
+        MAGNUM_CACHINGIMPORTER_LOCAL std::string doImage3DName(UnsignedInt id) override;
+        MAGNUM_CACHINGIMPORTER_LOCAL std::optional<ImageData3D> doImage3D(UnsignedInt id) override;
+
+        /* Opens the cache entry for given data, opening the wrapped importer
+           and writing the manifest on a miss */
+        MAGNUM_CACHINGIMPORTER_LOCAL void openInternal(Containers::ArrayView<const char> data);
+
+        /* Opens the wrapped importer if not already, returns false on
+           failure */
+        MAGNUM_CACHINGIMPORTER_LOCAL bool openImporter() const;
+
+        /* Returns importer of the cache entry for given mesh, creating the
+           entry on a miss. Returns nullptr on failure. */
+        MAGNUM_CACHINGIMPORTER_LOCAL AbstractImporter* cachedMesh(UnsignedInt id);
+
+        std::unique_ptr<AbstractImporter> _importer;
+        std::string _cacheDirectory;
+        std::unique_ptr<State> _state;
+        UnsignedInt _hits, _misses;
+};
+
+}}
+
+#endif
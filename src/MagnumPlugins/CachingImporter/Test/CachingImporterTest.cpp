@@ -0,0 +1,315 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "Magnum/Trade/SceneData.h"
+#include "MagnumPlugins/CachingImporter/CachingImporter.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class CachingImporterTest: public TestSuite::Tester {
+    public:
+        explicit CachingImporterTest();
+
+        void openFailed();
+
+        void mesh();
+        void meshDifferentData();
+        void meshCorruptedEntry();
+        void image();
+        void delegated();
+};
+
+CachingImporterTest::CachingImporterTest() {
+    addTests({&CachingImporterTest::openFailed,
+
+              &CachingImporterTest::mesh,
+              &CachingImporterTest::meshDifferentData,
+              &CachingImporterTest::meshCorruptedEntry,
+              &CachingImporterTest::image,
+              &CachingImporterTest::delegated});
+}
+
+namespace {
+    struct Counters {
+        UnsignedInt opened, meshes, images;
+    };
+
+    class CountingImporter: public AbstractImporter {
+        public:
+            explicit CountingImporter(Counters& counters): _counters(counters) {}
+
+        private:
+            Features doFeatures() const override { return Feature::OpenData; }
+            bool doIsOpened() const override { return _opened; }
+            void doClose() override { _opened = false; }
+
+            void doOpenData(Containers::ArrayView<const char> data) override {
+                if(data.size() && data[0] == '!') {
+                    Error() << "CountingImporter: invalid data";
+                    return;
+                }
+                ++_counters.opened;
+                _opened = true;
+                _z = data.size();
+            }
+
+            UnsignedInt doSceneCount() const override { return 1; }
+            std::optional<SceneData> doScene(UnsignedInt) override {
+                return SceneData{{}, {3, 4}};
+            }
+
+            UnsignedInt doMesh3DCount() const override { return 2; }
+            std::string doMesh3DName(UnsignedInt id) override {
+                return id ? "second" : "first";
+            }
+            std::optional<MeshData3D> doMesh3D(UnsignedInt id) override {
+                ++_counters.meshes;
+                return MeshData3D{MeshPrimitive::Triangles, {0, 2, 1}, {{
+                    {1.0f, 2.0f, Float(_z)},
+                    {3.0f, 4.0f, Float(_z)},
+                    {5.0f, 6.0f, Float(id)}}}, {}, {}};
+            }
+
+            UnsignedInt doImage2DCount() const override { return 1; }
+            std::optional<ImageData2D> doImage2D(UnsignedInt) override {
+                ++_counters.images;
+                Containers::Array<char> data{8};
+                for(std::size_t i = 0; i != data.size(); ++i) data[i] = i;
+                return ImageData2D{PixelStorage{}.setAlignment(1), PixelFormat::RGBA, PixelType::UnsignedByte, {2, 1}, std::move(data)};
+            }
+
+            Counters& _counters;
+            bool _opened{};
+            std::size_t _z{};
+    };
+
+    /* Removes all cache entries from given directory */
+    void removeCache(const std::string& directory) {
+        for(const std::string& entry: Utility::Directory::list(directory, Utility::Directory::Flag::SkipFiles|Utility::Directory::Flag::SkipDotAndDotDot)) {
+            const std::string path = Utility::Directory::join(directory, entry);
+            for(const std::string& file: Utility::Directory::list(path, Utility::Directory::Flag::SkipDirectories))
+                Utility::Directory::rm(Utility::Directory::join(path, file));
+            Utility::Directory::rm(path);
+        }
+    }
+
+    constexpr const char Data[] = "hello";
+}
+
+void CachingImporterTest::openFailed() {
+    const std::string directory = Utility::Directory::join(CACHINGIMPORTER_TEST_OUTPUT_DIR, "openFailed");
+    removeCache(directory);
+
+    Counters counters{};
+    CachingImporter importer{std::unique_ptr<AbstractImporter>{new CountingImporter{counters}}, directory};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer.openData(Containers::ArrayView<const char>{"!", 1}));
+    CORRADE_COMPARE(out.str(), "CountingImporter: invalid data\n");
+    CORRADE_VERIFY(!importer.isOpened());
+
+    /* Nothing is stored */
+    CORRADE_VERIFY(Utility::Directory::list(directory, Utility::Directory::Flag::SkipDotAndDotDot).empty());
+}
+
+void CachingImporterTest::mesh() {
+    const std::string directory = Utility::Directory::join(CACHINGIMPORTER_TEST_OUTPUT_DIR, "mesh");
+    removeCache(directory);
+
+    /* First open is a miss, the mesh gets imported */
+    Counters counters{};
+    {
+        CachingImporter importer{std::unique_ptr<AbstractImporter>{new CountingImporter{counters}}, directory};
+        CORRADE_VERIFY(importer.openData(Data));
+        CORRADE_COMPARE(counters.opened, 1);
+        CORRADE_COMPARE(importer.mesh3DCount(), 2);
+        CORRADE_COMPARE(importer.mesh3DName(1), "second");
+        CORRADE_COMPARE(importer.mesh3DForName("second"), 1);
+        CORRADE_COMPARE(importer.mesh3DForName("third"), -1);
+
+        std::optional<MeshData3D> mesh = importer.mesh3D(1);
+        CORRADE_VERIFY(mesh);
+        CORRADE_COMPARE(counters.meshes, 1);
+        CORRADE_COMPARE(mesh->positions(0)[2], (Vector3{5.0f, 6.0f, 1.0f}));
+        CORRADE_COMPARE(importer.misses(), 2);
+        CORRADE_COMPARE(importer.hits(), 0);
+
+        /* Second access is served from the opened entry */
+        CORRADE_VERIFY(importer.mesh(1));
+        CORRADE_COMPARE(counters.meshes, 1);
+    }
+
+    /* Second open is a hit, the wrapped importer is not even opened */
+    counters = {};
+    {
+        CachingImporter importer{std::unique_ptr<AbstractImporter>{new CountingImporter{counters}}, directory};
+        CORRADE_VERIFY(importer.openData(Data));
+        CORRADE_COMPARE(importer.mesh3DCount(), 2);
+        CORRADE_COMPARE(importer.mesh3DName(0), "first");
+
+        std::optional<MeshData3D> mesh = importer.mesh3D(1);
+        CORRADE_VERIFY(mesh);
+        CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Triangles);
+        CORRADE_COMPARE(mesh->indices(), (std::vector<UnsignedInt>{0, 2, 1}));
+        CORRADE_COMPARE(mesh->positions(0), (std::vector<Vector3>{
+            {1.0f, 2.0f, 6.0f}, {3.0f, 4.0f, 6.0f}, {5.0f, 6.0f, 1.0f}}));
+
+        std::optional<MeshData> interleaved = importer.mesh(1);
+        CORRADE_VERIFY(interleaved);
+        CORRADE_COMPARE(interleaved->vertexCount(), 3);
+
+        CORRADE_COMPARE(counters.opened, 0);
+        CORRADE_COMPARE(counters.meshes, 0);
+        CORRADE_COMPARE(importer.misses(), 0);
+        CORRADE_COMPARE(importer.hits(), 2);
+
+        /* The other mesh is not cached yet, so the importer gets opened */
+        CORRADE_VERIFY(importer.mesh3D(0));
+        CORRADE_COMPARE(counters.opened, 1);
+        CORRADE_COMPARE(counters.meshes, 1);
+        CORRADE_COMPARE(importer.misses(), 1);
+    }
+}
+
+void CachingImporterTest::meshDifferentData() {
+    const std::string directory = Utility::Directory::join(CACHINGIMPORTER_TEST_OUTPUT_DIR, "meshDifferentData");
+    removeCache(directory);
+
+    Counters counters{};
+    CachingImporter importer{std::unique_ptr<AbstractImporter>{new CountingImporter{counters}}, directory};
+    CORRADE_VERIFY(importer.openData(Data));
+    CORRADE_VERIFY(importer.mesh3D(0));
+
+    /* Different data with the same size, it's a miss */
+    CORRADE_VERIFY(importer.openData(Containers::ArrayView<const char>{"world", 6}));
+    std::optional<MeshData3D> mesh = importer.mesh3D(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(counters.opened, 2);
+    CORRADE_COMPARE(counters.meshes, 2);
+    CORRADE_COMPARE(importer.hits(), 0);
+    CORRADE_COMPARE(importer.misses(), 4);
+}
+
+void CachingImporterTest::meshCorruptedEntry() {
+    const std::string directory = Utility::Directory::join(CACHINGIMPORTER_TEST_OUTPUT_DIR, "meshCorruptedEntry");
+    removeCache(directory);
+
+    Counters counters{};
+    {
+        CachingImporter importer{std::unique_ptr<AbstractImporter>{new CountingImporter{counters}}, directory};
+        CORRADE_VERIFY(importer.openData(Data));
+        CORRADE_VERIFY(importer.mesh3D(0));
+    }
+
+    /* Overwrite the cached mesh with garbage */
+    const std::vector<std::string> entries = Utility::Directory::list(directory, Utility::Directory::Flag::SkipFiles|Utility::Directory::Flag::SkipDotAndDotDot);
+    CORRADE_COMPARE(entries.size(), 1);
+    const std::string filename = Utility::Directory::join(Utility::Directory::join(directory, entries[0]), "mesh3D-0.mgmesh");
+    CORRADE_VERIFY(Utility::Directory::fileExists(filename));
+    CORRADE_VERIFY(Utility::Directory::write(filename, Containers::ArrayView<const char>{"MGMS", 4}));
+
+    /* It's silently treated as a miss and replaced */
+    counters = {};
+    std::ostringstream out;
+    Error redirectError{&out};
+    {
+        CachingImporter importer{std::unique_ptr<AbstractImporter>{new CountingImporter{counters}}, directory};
+        CORRADE_VERIFY(importer.openData(Data));
+        CORRADE_VERIFY(importer.mesh3D(0));
+        CORRADE_COMPARE(counters.meshes, 1);
+        CORRADE_COMPARE(importer.hits(), 1);
+        CORRADE_COMPARE(importer.misses(), 1);
+    }
+    CORRADE_COMPARE(out.str(), "");
+    CORRADE_VERIFY(Utility::Directory::read(filename).size() > 4);
+}
+
+void CachingImporterTest::image() {
+    const std::string directory = Utility::Directory::join(CACHINGIMPORTER_TEST_OUTPUT_DIR, "image");
+    removeCache(directory);
+
+    Counters counters{};
+    for(std::size_t i = 0; i != 2; ++i) {
+        CachingImporter importer{std::unique_ptr<AbstractImporter>{new CountingImporter{counters}}, directory};
+        CORRADE_VERIFY(importer.openData(Data));
+        CORRADE_COMPARE(importer.image2DCount(), 1);
+
+        std::optional<ImageData2D> image = importer.image2D(0);
+        CORRADE_VERIFY(image);
+        CORRADE_VERIFY(!image->isCompressed());
+        CORRADE_COMPARE(image->storage().alignment(), 1);
+        CORRADE_COMPARE(image->format(), PixelFormat::RGBA);
+        CORRADE_COMPARE(image->type(), PixelType::UnsignedByte);
+        CORRADE_COMPARE(image->size(), (Vector2i{2, 1}));
+        CORRADE_COMPARE(image->data().size(), 8);
+        CORRADE_COMPARE(image->data()[7], 7);
+    }
+
+    /* The second time it was loaded from the cache */
+    CORRADE_COMPARE(counters.opened, 1);
+    CORRADE_COMPARE(counters.images, 1);
+}
+
+void CachingImporterTest::delegated() {
+    const std::string directory = Utility::Directory::join(CACHINGIMPORTER_TEST_OUTPUT_DIR, "delegated");
+    removeCache(directory);
+
+    Counters counters{};
+    {
+        CachingImporter importer{std::unique_ptr<AbstractImporter>{new CountingImporter{counters}}, directory};
+        CORRADE_VERIFY(importer.openData(Data));
+    }
+
+    /* Scenes are not cached, so the wrapped importer is opened on demand */
+    counters = {};
+    CachingImporter importer{std::unique_ptr<AbstractImporter>{new CountingImporter{counters}}, directory};
+    CORRADE_VERIFY(importer.openData(Data));
+    CORRADE_COMPARE(counters.opened, 0);
+    CORRADE_COMPARE(importer.sceneCount(), 1);
+    CORRADE_COMPARE(counters.opened, 1);
+
+    std::optional<SceneData> scene = importer.scene(0);
+    CORRADE_VERIFY(scene);
+    CORRADE_COMPARE(scene->children3D(), (std::vector<UnsignedInt>{3, 4}));
+    CORRADE_COMPARE(counters.opened, 1);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::CachingImporterTest)
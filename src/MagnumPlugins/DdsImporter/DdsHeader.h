@@ -0,0 +1,92 @@
+#ifndef Magnum_Trade_DdsHeader_h
+#define Magnum_Trade_DdsHeader_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::Trade::DdsPixelFormat, @ref Magnum::Trade::DdsHeader, @ref Magnum::Trade::DdsHeaderDxt10
+ */
+
+#include "Magnum/Types.h"
+
+namespace Magnum { namespace Trade {
+
+#pragma pack(1)
+/** @brief DDS pixel format description */
+struct DdsPixelFormat {
+    UnsignedInt size;           /**< @brief Structure size, always `32` */
+    UnsignedInt flags;          /**< @brief Pixel format flags */
+    UnsignedInt fourCC;         /**< @brief Compressed format four-character code */
+    UnsignedInt rgbBitCount;    /**< @brief Bits per pixel of uncompressed data */
+    UnsignedInt rBitMask;       /**< @brief Red channel mask */
+    UnsignedInt gBitMask;       /**< @brief Green channel mask */
+    UnsignedInt bBitMask;       /**< @brief Blue channel mask */
+    UnsignedInt aBitMask;       /**< @brief Alpha channel mask */
+};
+
+/**
+@brief DDS file header
+
+All fields are little-endian.
+*/
+struct DdsHeader {
+    char magic[4];              /**< @brief File magic, `DDS ` */
+    UnsignedInt size;           /**< @brief Header size without the magic, always `124` */
+    UnsignedInt flags;          /**< @brief Header flags */
+    UnsignedInt height;         /**< @brief Image height */
+    UnsignedInt width;          /**< @brief Image width */
+    UnsignedInt pitchOrLinearSize;  /**< @brief Row pitch or base level size */
+    UnsignedInt depth;          /**< @brief Image depth of volume textures */
+    UnsignedInt mipMapCount;    /**< @brief Mip level count */
+    UnsignedInt reserved1[11];  /**< @brief Reserved */
+    DdsPixelFormat pixelFormat; /**< @brief Pixel format */
+    UnsignedInt caps;           /**< @brief Surface complexity flags */
+    UnsignedInt caps2;          /**< @brief Cube map and volume flags */
+    UnsignedInt caps3;          /**< @brief Unused */
+    UnsignedInt caps4;          /**< @brief Unused */
+    UnsignedInt reserved2;      /**< @brief Reserved */
+};
+
+/**
+@brief DDS DX10 header extension
+
+Follows @ref DdsHeader if @ref DdsPixelFormat::fourCC is `DX10`.
+*/
+struct DdsHeaderDxt10 {
+    UnsignedInt dxgiFormat;         /**< @brief DXGI format */
+    UnsignedInt resourceDimension;  /**< @brief Texture dimension */
+    UnsignedInt miscFlag;           /**< @brief Cube map flag */
+    UnsignedInt arraySize;          /**< @brief Array layer count */
+    UnsignedInt miscFlags2;         /**< @brief Alpha mode */
+};
+#pragma pack()
+
+static_assert(sizeof(DdsPixelFormat) == 32, "DdsPixelFormat size is not 32 bytes");
+static_assert(sizeof(DdsHeader) == 128, "DdsHeader size is not 128 bytes");
+static_assert(sizeof(DdsHeaderDxt10) == 20, "DdsHeaderDxt10 size is not 20 bytes");
+
+}}
+
+#endif
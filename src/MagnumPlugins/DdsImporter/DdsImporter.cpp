@@ -0,0 +1,291 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DdsImporter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/Trade/ImageData.h"
+#include "MagnumPlugins/DdsImporter/DdsHeader.h"
+
+namespace Magnum { namespace Trade {
+
+namespace {
+
+constexpr UnsignedInt fourCC(const char a, const char b, const char c, const char d) {
+    return UnsignedInt(a)|(UnsignedInt(b) << 8)|(UnsignedInt(c) << 16)|(UnsignedInt(d) << 24);
+}
+
+enum: UnsignedInt {
+    DdpfFourCC = 0x4,
+    Caps2Cubemap = 0x200,
+    Caps2CubemapAllFaces = 0xfc00,
+    Caps2Volume = 0x200000,
+    Dx10ResourceDimensionTexture1D = 2,
+    Dx10ResourceDimensionTexture3D = 4,
+    Dx10MiscTextureCube = 0x4
+};
+
+/* Returns false if the format is not supported */
+bool formatFromFourCC(const UnsignedInt code, CompressedPixelFormat& format) {
+    switch(code) {
+        case fourCC('D', 'X', 'T', '1'):
+            format = CompressedPixelFormat::RGBAS3tcDxt1;
+            return true;
+        case fourCC('D', 'X', 'T', '3'):
+            format = CompressedPixelFormat::RGBAS3tcDxt3;
+            return true;
+        case fourCC('D', 'X', 'T', '5'):
+            format = CompressedPixelFormat::RGBAS3tcDxt5;
+            return true;
+        #ifndef MAGNUM_TARGET_GLES
+        case fourCC('A', 'T', 'I', '1'):
+        case fourCC('B', 'C', '4', 'U'):
+            format = CompressedPixelFormat::RedRgtc1;
+            return true;
+        case fourCC('B', 'C', '4', 'S'):
+            format = CompressedPixelFormat::SignedRedRgtc1;
+            return true;
+        case fourCC('A', 'T', 'I', '2'):
+        case fourCC('B', 'C', '5', 'U'):
+            format = CompressedPixelFormat::RGRgtc2;
+            return true;
+        case fourCC('B', 'C', '5', 'S'):
+            format = CompressedPixelFormat::SignedRGRgtc2;
+            return true;
+        #endif
+    }
+
+    return false;
+}
+
+/* Returns false if the format is not supported */
+bool formatFromDxgi(const UnsignedInt dxgiFormat, CompressedPixelFormat& format) {
+    switch(dxgiFormat) {
+        case 71: /* DXGI_FORMAT_BC1_UNORM */
+            format = CompressedPixelFormat::RGBAS3tcDxt1;
+            return true;
+        case 74: /* DXGI_FORMAT_BC2_UNORM */
+            format = CompressedPixelFormat::RGBAS3tcDxt3;
+            return true;
+        case 77: /* DXGI_FORMAT_BC3_UNORM */
+            format = CompressedPixelFormat::RGBAS3tcDxt5;
+            return true;
+        #ifndef MAGNUM_TARGET_GLES
+        case 80: /* DXGI_FORMAT_BC4_UNORM */
+            format = CompressedPixelFormat::RedRgtc1;
+            return true;
+        case 81: /* DXGI_FORMAT_BC4_SNORM */
+            format = CompressedPixelFormat::SignedRedRgtc1;
+            return true;
+        case 83: /* DXGI_FORMAT_BC5_UNORM */
+            format = CompressedPixelFormat::RGRgtc2;
+            return true;
+        case 84: /* DXGI_FORMAT_BC5_SNORM */
+            format = CompressedPixelFormat::SignedRGRgtc2;
+            return true;
+        case 95: /* DXGI_FORMAT_BC6H_UF16 */
+            format = CompressedPixelFormat::RGBBptcUnsignedFloat;
+            return true;
+        case 96: /* DXGI_FORMAT_BC6H_SF16 */
+            format = CompressedPixelFormat::RGBBptcSignedFloat;
+            return true;
+        case 98: /* DXGI_FORMAT_BC7_UNORM */
+            format = CompressedPixelFormat::RGBABptcUnorm;
+            return true;
+        case 99: /* DXGI_FORMAT_BC7_UNORM_SRGB */
+            format = CompressedPixelFormat::SRGBAlphaBptcUnorm;
+            return true;
+        #endif
+    }
+
+    return false;
+}
+
+std::size_t blockSize(const CompressedPixelFormat format) {
+    switch(format) {
+        case CompressedPixelFormat::RGBAS3tcDxt1:
+        #ifndef MAGNUM_TARGET_GLES
+        case CompressedPixelFormat::RedRgtc1:
+        case CompressedPixelFormat::SignedRedRgtc1:
+        #endif
+            return 8;
+        default:
+            return 16;
+    }
+}
+
+}
+
+DdsImporter::DdsImporter() = default;
+
+DdsImporter::DdsImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImporter{manager, std::move(plugin)} {}
+
+DdsImporter::~DdsImporter() = default;
+
+auto DdsImporter::doFeatures() const -> Features { return Feature::OpenData|Feature::ThreadSafeInstances; }
+
+bool DdsImporter::doIsOpened() const { return _in; }
+
+void DdsImporter::doClose() {
+    _in = nullptr;
+    _images.clear();
+}
+
+void DdsImporter::doOpenData(const Containers::ArrayView<const char> data) {
+    if(data.size() < sizeof(DdsHeader)) {
+        Error() << "Trade::DdsImporter::openData(): the file is too short:" << data.size() << "bytes";
+        return;
+    }
+
+    DdsHeader header;
+    std::memcpy(&header, data, sizeof(DdsHeader));
+    if(std::strncmp(header.magic, "DDS ", 4) != 0) {
+        Error() << "Trade::DdsImporter::openData(): invalid file signature";
+        return;
+    }
+    if(Utility::Endianness::littleEndian(header.size) != 124) {
+        Error() << "Trade::DdsImporter::openData(): invalid header size" << Utility::Endianness::littleEndian(header.size);
+        return;
+    }
+
+    const UnsignedInt width = Utility::Endianness::littleEndian(header.width);
+    const UnsignedInt height = Utility::Endianness::littleEndian(header.height);
+    const UnsignedInt caps2 = Utility::Endianness::littleEndian(header.caps2);
+    UnsignedInt depth = caps2 & Caps2Volume ? Utility::Endianness::littleEndian(header.depth) : 0;
+    bool cubeMap = caps2 & Caps2Cubemap;
+    UnsignedInt arraySize = 1;
+    std::size_t offset = sizeof(DdsHeader);
+
+    /* Check format */
+    if(!(Utility::Endianness::littleEndian(header.pixelFormat.flags) & DdpfFourCC)) {
+        Error() << "Trade::DdsImporter::openData(): uncompressed formats are not supported";
+        return;
+    }
+    CompressedPixelFormat format;
+    const UnsignedInt code = Utility::Endianness::littleEndian(header.pixelFormat.fourCC);
+    if(code == fourCC('D', 'X', '1', '0')) {
+        if(data.size() < sizeof(DdsHeader) + sizeof(DdsHeaderDxt10)) {
+            Error() << "Trade::DdsImporter::openData(): the file is too short:" << data.size() << "bytes";
+            return;
+        }
+
+        DdsHeaderDxt10 headerDxt10;
+        std::memcpy(&headerDxt10, data + sizeof(DdsHeader), sizeof(DdsHeaderDxt10));
+        offset += sizeof(DdsHeaderDxt10);
+
+        const UnsignedInt dxgiFormat = Utility::Endianness::littleEndian(headerDxt10.dxgiFormat);
+        if(!formatFromDxgi(dxgiFormat, format)) {
+            Error() << "Trade::DdsImporter::openData(): unsupported DXGI format" << dxgiFormat;
+            return;
+        }
+
+        const UnsignedInt resourceDimension = Utility::Endianness::littleEndian(headerDxt10.resourceDimension);
+        if(resourceDimension == Dx10ResourceDimensionTexture1D) {
+            Error() << "Trade::DdsImporter::openData(): 1D images are not supported";
+            return;
+        }
+        if(resourceDimension == Dx10ResourceDimensionTexture3D)
+            depth = Utility::Endianness::littleEndian(header.depth);
+        cubeMap = Utility::Endianness::littleEndian(headerDxt10.miscFlag) & Dx10MiscTextureCube;
+        arraySize = std::max(Utility::Endianness::littleEndian(headerDxt10.arraySize), 1u);
+
+    } else if(!formatFromFourCC(code, format)) {
+        Error() << "Trade::DdsImporter::openData(): unsupported format" << std::string{reinterpret_cast<const char*>(&header.pixelFormat.fourCC), 4};
+        return;
+    }
+
+    /* Check dimensions */
+    if(!width || !height) {
+        Error() << "Trade::DdsImporter::openData(): invalid image size";
+        return;
+    }
+    /* DX10 files don't need to set the cube map face flags */
+    if(cubeMap && (caps2 & Caps2Cubemap) && (caps2 & Caps2CubemapAllFaces) != Caps2CubemapAllFaces) {
+        Error() << "Trade::DdsImporter::openData(): incomplete cube maps are not supported";
+        return;
+    }
+    const Int layerCount = arraySize*(cubeMap ? 6 : 1);
+    if(depth && layerCount != 1) {
+        Error() << "Trade::DdsImporter::openData(): 3D array and cube map images are not supported";
+        return;
+    }
+    const UnsignedInt dimensions = depth || layerCount != 1 || cubeMap ? 3 : 2;
+
+    /* Gather all mip levels of the first layer, every next layer has the
+       same layout */
+    std::vector<Image> images;
+    const std::size_t layerOffset = offset;
+    for(UnsignedInt level = 0, levelCount = std::max(Utility::Endianness::littleEndian(header.mipMapCount), 1u); level != levelCount; ++level) {
+        const Vector3i size{
+            std::max(Int(width >> level), 1),
+            std::max(Int(height >> level), 1),
+            depth ? std::max(Int(depth >> level), 1) : layerCount};
+
+        const std::size_t dataSize = std::size_t((size.x() + 3)/4)*((size.y() + 3)/4)*(depth ? size.z() : 1)*blockSize(format);
+        images.push_back({dimensions == 2 ? Vector3i{size.xy(), 1} : size, offset, dataSize});
+        offset += dataSize;
+    }
+
+    const std::size_t layerStride = offset - layerOffset;
+    if(layerOffset + layerStride*layerCount > data.size()) {
+        Error() << "Trade::DdsImporter::openData(): the file is too short:" << data.size() << "bytes";
+        return;
+    }
+
+    _in = Containers::Array<char>{data.size()};
+    std::copy(data.begin(), data.end(), _in.begin());
+    _images = std::move(images);
+    _dimensions = dimensions;
+    _format = format;
+    _layerCount = layerCount;
+    _layerStride = layerStride;
+}
+
+UnsignedInt DdsImporter::doImage2DCount() const { return _dimensions == 2 ? _images.size() : 0; }
+
+std::optional<ImageData2D> DdsImporter::doImage2D(const UnsignedInt id) {
+    const Image& image = _images[id];
+    Containers::Array<char> data{image.dataSize};
+    std::copy_n(_in + image.offset, image.dataSize, data.begin());
+    return ImageData2D{_format, image.size.xy(), std::move(data)};
+}
+
+UnsignedInt DdsImporter::doImage3DCount() const { return _dimensions == 3 ? _images.size() : 0; }
+
+std::optional<ImageData3D> DdsImporter::doImage3D(const UnsignedInt id) {
+    const Image& image = _images[id];
+
+    /* Gather given mip level of all layers */
+    Containers::Array<char> data{image.dataSize*_layerCount};
+    for(Int layer = 0; layer != _layerCount; ++layer)
+        std::copy_n(_in + image.offset + layer*_layerStride, image.dataSize, data + layer*image.dataSize);
+    return ImageData3D{_format, image.size, std::move(data)};
+}
+
+}}
@@ -0,0 +1,123 @@
+#ifndef Magnum_Trade_DdsImporter_h
+#define Magnum_Trade_DdsImporter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::DdsImporter
+ */
+
+#include <vector>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/VisibilityMacros.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/AbstractImporter.h"
+
+#include "MagnumPlugins/DdsImporter/configure.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_DDSIMPORTER_BUILD_STATIC
+    #if defined(DdsImporter_EXPORTS) || defined(DdsImporterObjects_EXPORTS)
+        #define MAGNUM_DDSIMPORTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_DDSIMPORTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_DDSIMPORTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_DDSIMPORTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief DDS importer plugin
+
+Supports DirectDraw Surface (`*.dds`) 2D, 3D, 2D array and cube map images
+compressed with S3TC/BC1--3 and, on desktop OpenGL, also with RGTC/BC4--5 and
+BPTC/BC6--7, either described by a four-character code or by the DX10 header
+extension. Uncompressed, 1D, incomplete cube map and sRGB BC1--3 images are not
+supported.
+
+This plugin is built if `WITH_DDSIMPORTER` is enabled when building Magnum. To
+use dynamic plugin, you need to load `DdsImporter` plugin from
+`MAGNUM_PLUGINS_IMPORTER_DIR`. To use static plugin or use this as a dependency
+of another plugin, you need to request `DdsImporter` component of `Magnum`
+package in CMake and link to `Magnum::DdsImporter` target. See @ref building,
+@ref cmake and @ref plugins for more information.
+
+Same as in @ref KtxImporter, each mip level is imported as a separate image,
+image with ID `0` being the base level. 2D images are imported using
+@ref image2D(), 3D images, 2D arrays and cube maps using @ref image3D(), with
+array layers or cube map faces (ordered +X, -X, +Y, -Y, +Z, -Z) being the third
+dimension. DDS files store complete mip chains of each layer one after another,
+so the layers of given mip level are gathered into a single image. The block
+data are not decompressed or converted in any way and can be uploaded directly
+using @ref Texture::setCompressedSubImage(). Note that DDS images are stored
+top-down, so texture coordinates need to be flipped in Y when used with
+OpenGL.
+*/
+class MAGNUM_DDSIMPORTER_EXPORT DdsImporter: public AbstractImporter {
+    public:
+        /** @brief Default constructor */
+        explicit DdsImporter();
+
+        /** @brief Plugin manager constructor */
+        explicit DdsImporter(PluginManager::AbstractManager& manager, std::string plugin);
+
+        ~DdsImporter();
+
+    private:
+        /* Offset and size of the first layer, the other layers are
+           _layerStride bytes apart */
+        struct Image {
+            Vector3i size;
+            std::size_t offset, dataSize;
+        };
+
+        Features MAGNUM_DDSIMPORTER_LOCAL doFeatures() const override;
+        bool MAGNUM_DDSIMPORTER_LOCAL doIsOpened() const override;
+        void MAGNUM_DDSIMPORTER_LOCAL doOpenData(Containers::ArrayView<const char> data) override;
+        void MAGNUM_DDSIMPORTER_LOCAL doClose() override;
+
+        UnsignedInt MAGNUM_DDSIMPORTER_LOCAL doImage2DCount() const override;
+        std::optional<ImageData2D> MAGNUM_DDSIMPORTER_LOCAL doImage2D(UnsignedInt id) override;
+
+        UnsignedInt MAGNUM_DDSIMPORTER_LOCAL doImage3DCount() const override;
+        std::optional<ImageData3D> MAGNUM_DDSIMPORTER_LOCAL doImage3D(UnsignedInt id) override;
+
+        Containers::Array<char> _in;
+        std::vector<Image> _images;
+        UnsignedInt _dimensions;
+        CompressedPixelFormat _format;
+        Int _layerCount;
+        std::size_t _layerStride;
+};
+
+}}
+
+#endif
@@ -0,0 +1,287 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Trade/ImageData.h"
+#include "MagnumPlugins/DdsImporter/DdsHeader.h"
+#include "MagnumPlugins/DdsImporter/DdsImporter.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class DdsImporterTest: public TestSuite::Tester {
+    public:
+        explicit DdsImporterTest();
+
+        void openShort();
+        void invalidSignature();
+        void invalidHeaderSize();
+        void unsupportedUncompressed();
+        void unsupportedFormat();
+        void unsupportedDxgiFormat();
+        void incompleteCubeMap();
+        void truncated();
+
+        void compressed();
+        void cubeMap();
+        void volume();
+        void dx10Array();
+
+        void useTwice();
+};
+
+DdsImporterTest::DdsImporterTest() {
+    addTests({&DdsImporterTest::openShort,
+              &DdsImporterTest::invalidSignature,
+              &DdsImporterTest::invalidHeaderSize,
+              &DdsImporterTest::unsupportedUncompressed,
+              &DdsImporterTest::unsupportedFormat,
+              &DdsImporterTest::unsupportedDxgiFormat,
+              &DdsImporterTest::incompleteCubeMap,
+              &DdsImporterTest::truncated,
+
+              &DdsImporterTest::compressed,
+              &DdsImporterTest::cubeMap,
+              &DdsImporterTest::volume,
+              &DdsImporterTest::dx10Array,
+
+              &DdsImporterTest::useTwice});
+}
+
+namespace {
+    Containers::Array<char> testFile(const std::string& filename) {
+        return Utility::Directory::read(Utility::Directory::join(DDSIMPORTER_TEST_DIR, filename));
+    }
+
+    DdsHeader& header(Containers::Array<char>& data) {
+        return *reinterpret_cast<DdsHeader*>(data.data());
+    }
+}
+
+void DdsImporterTest::openShort() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    DdsImporter importer;
+    const char data[] = { 'D', 'D', 'S', ' ', 124, 0, 0, 0 };
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::DdsImporter::openData(): the file is too short: 8 bytes\n");
+}
+
+void DdsImporterTest::invalidSignature() {
+    Containers::Array<char> data = testFile("compressed.dds");
+    CORRADE_VERIFY(data);
+    data[3] = 'X';
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    DdsImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::DdsImporter::openData(): invalid file signature\n");
+}
+
+void DdsImporterTest::invalidHeaderSize() {
+    Containers::Array<char> data = testFile("compressed.dds");
+    CORRADE_VERIFY(data);
+    header(data).size = Utility::Endianness::littleEndian(128u);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    DdsImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::DdsImporter::openData(): invalid header size 128\n");
+}
+
+void DdsImporterTest::unsupportedUncompressed() {
+    Containers::Array<char> data = testFile("compressed.dds");
+    CORRADE_VERIFY(data);
+    /* DDPF_RGB */
+    header(data).pixelFormat.flags = Utility::Endianness::littleEndian(0x40u);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    DdsImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::DdsImporter::openData(): uncompressed formats are not supported\n");
+}
+
+void DdsImporterTest::unsupportedFormat() {
+    Containers::Array<char> data = testFile("compressed.dds");
+    CORRADE_VERIFY(data);
+    std::memcpy(&header(data).pixelFormat.fourCC, "DXT2", 4);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    DdsImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::DdsImporter::openData(): unsupported format DXT2\n");
+}
+
+void DdsImporterTest::unsupportedDxgiFormat() {
+    Containers::Array<char> data = testFile("array.dds");
+    CORRADE_VERIFY(data);
+    /* DXGI_FORMAT_R8G8B8A8_UNORM */
+    reinterpret_cast<DdsHeaderDxt10*>(data + sizeof(DdsHeader))->dxgiFormat = Utility::Endianness::littleEndian(28u);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    DdsImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::DdsImporter::openData(): unsupported DXGI format 28\n");
+}
+
+void DdsImporterTest::incompleteCubeMap() {
+    Containers::Array<char> data = testFile("cube.dds");
+    CORRADE_VERIFY(data);
+    /* Remove the -Z face */
+    header(data).caps2 = Utility::Endianness::littleEndian(0x200u|0x7c00u);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    DdsImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::DdsImporter::openData(): incomplete cube maps are not supported\n");
+}
+
+void DdsImporterTest::truncated() {
+    Containers::Array<char> data = testFile("compressed.dds");
+    CORRADE_VERIFY(data);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    DdsImporter importer;
+    CORRADE_VERIFY(!importer.openData(data.prefix(data.size() - 1)));
+    CORRADE_COMPARE(out.str(), "Trade::DdsImporter::openData(): the file is too short: 151 bytes\n");
+}
+
+void DdsImporterTest::compressed() {
+    DdsImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(DDSIMPORTER_TEST_DIR, "compressed.dds")));
+    CORRADE_COMPARE(importer.image2DCount(), 2);
+    CORRADE_COMPARE(importer.image3DCount(), 0);
+
+    std::optional<ImageData2D> image = importer.image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_VERIFY(image->isCompressed());
+    CORRADE_COMPARE(image->compressedFormat(), CompressedPixelFormat::RGBAS3tcDxt1);
+    CORRADE_COMPARE(image->size(), Vector2i(8, 4));
+    CORRADE_COMPARE_AS(image->data(),
+        (Containers::Array<char>::from(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)),
+        TestSuite::Compare::Container);
+
+    /* Sizes smaller than a block still take a whole block */
+    image = importer.image2D(1);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->size(), Vector2i(4, 2));
+    CORRADE_COMPARE_AS(image->data(),
+        (Containers::Array<char>::from(16, 17, 18, 19, 20, 21, 22, 23)),
+        TestSuite::Compare::Container);
+}
+
+void DdsImporterTest::cubeMap() {
+    DdsImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(DDSIMPORTER_TEST_DIR, "cube.dds")));
+    CORRADE_COMPARE(importer.image2DCount(), 0);
+    CORRADE_COMPARE(importer.image3DCount(), 2);
+
+    /* Each level has all six faces, gathered from the face mip chains */
+    std::optional<ImageData3D> image = importer.image3D(1);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->compressedFormat(), CompressedPixelFormat::RGBAS3tcDxt5);
+    CORRADE_COMPARE(image->size(), Vector3i(2, 2, 6));
+    CORRADE_COMPARE(image->data().size(), 96);
+    CORRADE_COMPARE(image->data()[0], 16);
+    CORRADE_COMPARE(image->data()[16], 48);
+    CORRADE_COMPARE(image->data()[95], char(191));
+}
+
+void DdsImporterTest::volume() {
+    DdsImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(DDSIMPORTER_TEST_DIR, "volume.dds")));
+    CORRADE_COMPARE(importer.image2DCount(), 0);
+    CORRADE_COMPARE(importer.image3DCount(), 2);
+
+    std::optional<ImageData3D> image = importer.image3D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->size(), Vector3i(4, 4, 2));
+    CORRADE_COMPARE(image->data().size(), 16);
+
+    /* Depth is halved as well */
+    image = importer.image3D(1);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->size(), Vector3i(2, 2, 1));
+    CORRADE_COMPARE_AS(image->data(),
+        (Containers::Array<char>::from(16, 17, 18, 19, 20, 21, 22, 23)),
+        TestSuite::Compare::Container);
+}
+
+void DdsImporterTest::dx10Array() {
+    DdsImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(DDSIMPORTER_TEST_DIR, "array.dds")));
+    CORRADE_COMPARE(importer.image3DCount(), 1);
+
+    std::optional<ImageData3D> image = importer.image3D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->compressedFormat(), CompressedPixelFormat::RGBAS3tcDxt1);
+    CORRADE_COMPARE(image->size(), Vector3i(4, 4, 2));
+    CORRADE_COMPARE(image->data().size(), 16);
+    CORRADE_COMPARE(image->data()[8], 8);
+}
+
+void DdsImporterTest::useTwice() {
+    DdsImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(DDSIMPORTER_TEST_DIR, "compressed.dds")));
+
+    /* Verify that the data are copied and not moved out */
+    {
+        std::optional<ImageData2D> image = importer.image2D(0);
+        CORRADE_VERIFY(image);
+        CORRADE_COMPARE(image->size(), Vector2i(8, 4));
+    } {
+        std::optional<ImageData2D> image = importer.image2D(0);
+        CORRADE_VERIFY(image);
+        CORRADE_COMPARE(image->size(), Vector2i(8, 4));
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::DdsImporterTest)
@@ -0,0 +1,236 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "KtxImporter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Trade/ImageData.h"
+#include "MagnumPlugins/KtxImporter/KtxHeader.h"
+
+namespace Magnum { namespace Trade {
+
+namespace {
+
+constexpr char KtxIdentifier[]{'\xab', 'K', 'T', 'X', ' ', '1', '1', '\xbb', '\r', '\n', '\x1a', '\n'};
+
+inline UnsignedInt swapEndianness(const UnsignedInt value) {
+    return (value >> 24)|((value >> 8) & 0xff00)|((value << 8) & 0xff0000)|(value << 24);
+}
+
+/* Size of one pixel of uncompressed data, zero if the format or type is not
+   supported. Raw GL values, as some of the enum values are not available on
+   all targets. */
+std::size_t uncompressedPixelSize(const UnsignedInt format, const UnsignedInt type) {
+    std::size_t channelCount;
+    switch(format) {
+        case 0x1903: /* GL_RED */
+            channelCount = 1;
+            break;
+        case 0x8227: /* GL_RG */
+            channelCount = 2;
+            break;
+        case 0x1907: /* GL_RGB */
+            channelCount = 3;
+            break;
+        case 0x1908: /* GL_RGBA */
+            channelCount = 4;
+            break;
+        default: return 0;
+    }
+
+    switch(type) {
+        case 0x1401: /* GL_UNSIGNED_BYTE */
+            return channelCount;
+        case 0x1406: /* GL_FLOAT */
+            return channelCount*4;
+    }
+
+    return 0;
+}
+
+}
+
+KtxImporter::KtxImporter() = default;
+
+KtxImporter::KtxImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImporter{manager, std::move(plugin)} {}
+
+KtxImporter::~KtxImporter() = default;
+
+auto KtxImporter::doFeatures() const -> Features { return Feature::OpenData|Feature::ThreadSafeInstances; }
+
+bool KtxImporter::doIsOpened() const { return _in; }
+
+void KtxImporter::doClose() {
+    _in = nullptr;
+    _images.clear();
+}
+
+void KtxImporter::doOpenData(const Containers::ArrayView<const char> data) {
+    if(data.size() < sizeof(KtxHeader)) {
+        Error() << "Trade::KtxImporter::openData(): the file is too short:" << data.size() << "bytes";
+        return;
+    }
+
+    KtxHeader header;
+    std::memcpy(&header, data, sizeof(KtxHeader));
+    if(std::memcmp(header.identifier, KtxIdentifier, sizeof(KtxIdentifier)) != 0) {
+        Error() << "Trade::KtxImporter::openData(): invalid file identifier";
+        return;
+    }
+
+    /* Convert the header to machine endianness */
+    bool swap;
+    if(header.endianness == 0x04030201) swap = false;
+    else if(header.endianness == 0x01020304) swap = true;
+    else {
+        Error() << "Trade::KtxImporter::openData(): invalid endianness marker";
+        return;
+    }
+    if(swap) {
+        UnsignedInt* const fields = &header.endianness;
+        for(std::size_t i = 0; i != (sizeof(KtxHeader) - sizeof(header.identifier))/4; ++i)
+            fields[i] = swapEndianness(fields[i]);
+    }
+
+    /* Check format */
+    const bool compressed = header.glType == 0;
+    std::size_t pixelSize = 0;
+    if(!compressed) {
+        pixelSize = uncompressedPixelSize(header.glFormat, header.glType);
+        if(!pixelSize) {
+            Error() << "Trade::KtxImporter::openData(): unsupported format" << reinterpret_cast<void*>(header.glFormat) << "and type" << reinterpret_cast<void*>(header.glType);
+            return;
+        }
+        if(swap && header.glTypeSize != 1) {
+            Error() << "Trade::KtxImporter::openData(): floating-point data with different endianness are not supported";
+            return;
+        }
+    }
+
+    /* Check dimensions */
+    if(!header.pixelWidth || !header.pixelHeight) {
+        Error() << "Trade::KtxImporter::openData(): 1D images are not supported";
+        return;
+    }
+    if(header.numberOfFaces != 1 && header.numberOfFaces != 6) {
+        Error() << "Trade::KtxImporter::openData(): invalid face count" << header.numberOfFaces;
+        return;
+    }
+    if(header.pixelDepth && (header.numberOfArrayElements || header.numberOfFaces != 1)) {
+        Error() << "Trade::KtxImporter::openData(): 3D array and cube map images are not supported";
+        return;
+    }
+    const bool nonArrayCubeMap = header.numberOfFaces == 6 && !header.numberOfArrayElements;
+    const UnsignedInt dimensions = header.pixelDepth || header.numberOfArrayElements || header.numberOfFaces == 6 ? 3 : 2;
+    const Int layerCount = header.pixelDepth ? 0 : std::max(header.numberOfArrayElements, 1u)*header.numberOfFaces;
+
+    /* Gather all mip levels. Level 0 means the mip levels should be
+       generated, so there's just the base level. */
+    std::vector<Image> images;
+    std::size_t offset = sizeof(KtxHeader) + std::size_t(header.bytesOfKeyValueData);
+    for(UnsignedInt level = 0, levelCount = std::max(header.numberOfMipmapLevels, 1u); level != levelCount; ++level) {
+        if(offset + 4 > data.size()) {
+            Error() << "Trade::KtxImporter::openData(): the file is too short:" << data.size() << "bytes";
+            return;
+        }
+
+        UnsignedInt imageSize;
+        std::memcpy(&imageSize, data + offset, 4);
+        if(swap) imageSize = swapEndianness(imageSize);
+        offset += 4;
+
+        const Vector3i size{
+            std::max(Int(header.pixelWidth >> level), 1),
+            std::max(Int(header.pixelHeight >> level), 1),
+            header.pixelDepth ? std::max(Int(header.pixelDepth >> level), 1) : layerCount};
+
+        /* For non-array cube maps the size is of one face and each face is
+           padded to four bytes. That's always the case for compressed and
+           four-byte-aligned uncompressed data, so the faces are contiguous. */
+        std::size_t dataSize = imageSize;
+        if(nonArrayCubeMap) {
+            if(imageSize % 4) {
+                Error() << "Trade::KtxImporter::openData(): unsupported cube map face padding";
+                return;
+            }
+            dataSize *= 6;
+        }
+
+        /* Uncompressed data have rows aligned to four bytes */
+        if(!compressed) {
+            const std::size_t rowSize = (size.x()*pixelSize + 3)/4*4;
+            if(dataSize < rowSize*size.y()*std::max(size.z(), 1)) {
+                Error() << "Trade::KtxImporter::openData(): invalid size of mip level" << level;
+                return;
+            }
+        }
+
+        if(offset + dataSize > data.size()) {
+            Error() << "Trade::KtxImporter::openData(): the file is too short:" << data.size() << "bytes";
+            return;
+        }
+
+        images.push_back({dimensions == 2 ? Vector3i{size.xy(), 1} : size, offset, dataSize});
+        offset += (dataSize + 3)/4*4;
+    }
+
+    _in = Containers::Array<char>{data.size()};
+    std::copy(data.begin(), data.end(), _in.begin());
+    _images = std::move(images);
+    _dimensions = dimensions;
+    _compressed = compressed;
+    _format = compressed ? header.glInternalFormat : header.glFormat;
+    _type = header.glType;
+}
+
+UnsignedInt KtxImporter::doImage2DCount() const { return _dimensions == 2 ? _images.size() : 0; }
+
+std::optional<ImageData2D> KtxImporter::doImage2D(const UnsignedInt id) {
+    const Image& image = _images[id];
+    Containers::Array<char> data{image.dataSize};
+    std::copy_n(_in + image.offset, image.dataSize, data.begin());
+
+    if(_compressed)
+        return ImageData2D{CompressedPixelFormat(_format), image.size.xy(), std::move(data)};
+    return ImageData2D{PixelFormat(_format), PixelType(_type), image.size.xy(), std::move(data)};
+}
+
+UnsignedInt KtxImporter::doImage3DCount() const { return _dimensions == 3 ? _images.size() : 0; }
+
+std::optional<ImageData3D> KtxImporter::doImage3D(const UnsignedInt id) {
+    const Image& image = _images[id];
+    Containers::Array<char> data{image.dataSize};
+    std::copy_n(_in + image.offset, image.dataSize, data.begin());
+
+    if(_compressed)
+        return ImageData3D{CompressedPixelFormat(_format), image.size, std::move(data)};
+    return ImageData3D{PixelFormat(_format), PixelType(_type), image.size, std::move(data)};
+}
+
+}}
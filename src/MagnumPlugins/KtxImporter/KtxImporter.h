@@ -0,0 +1,134 @@
+#ifndef Magnum_Trade_KtxImporter_h
+#define Magnum_Trade_KtxImporter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::KtxImporter
+ */
+
+#include <vector>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/VisibilityMacros.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/AbstractImporter.h"
+
+#include "MagnumPlugins/KtxImporter/configure.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_KTXIMPORTER_BUILD_STATIC
+    #if defined(KtxImporter_EXPORTS) || defined(KtxImporterObjects_EXPORTS)
+        #define MAGNUM_KTXIMPORTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_KTXIMPORTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_KTXIMPORTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_KTXIMPORTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief KTX importer plugin
+
+Supports Khronos KTX 1.1 (`*.ktx`) 2D, 3D, 2D array and cube map images with
+any block-compressed format supported by OpenGL, such as S3TC/BC1--3,
+RGTC/BC4--5, BPTC/BC6--7, ETC2/EAC or ASTC, and uncompressed images with
+one to four channels of @ref PixelType::UnsignedByte or @ref PixelType::Float
+type. Files in both endiannesses are supported, except for uncompressed
+floating-point images in different endianness than the machine. 1D images
+are not supported.
+
+This plugin is built if `WITH_KTXIMPORTER` is enabled when building Magnum. To
+use dynamic plugin, you need to load `KtxImporter` plugin from
+`MAGNUM_PLUGINS_IMPORTER_DIR`. To use static plugin or use this as a dependency
+of another plugin, you need to request `KtxImporter` component of `Magnum`
+package in CMake and link to `Magnum::KtxImporter` target. See @ref building,
+@ref cmake and @ref plugins for more information.
+
+Each mip level is imported as a separate image, image with ID `0` being the
+base level. 2D images are imported using @ref image2D(), 3D images, 2D arrays
+and cube maps using @ref image3D(), with array layers or cube map faces
+(ordered +X, -X, +Y, -Y, +Z, -Z) being the third dimension. The images are
+not decompressed or converted in any way, so they can be uploaded directly
+using @ref Texture::setCompressedSubImage():
+@code
+std::unique_ptr<Trade::AbstractImporter> importer = manager.loadAndInstantiate("KtxImporter");
+importer->openFile("texture.ktx");
+
+Texture2D texture;
+for(UnsignedInt level = 0; level != importer->image2DCount(); ++level) {
+    std::optional<Trade::ImageData2D> image = importer->image2D(level);
+    if(!level) texture.setStorage(importer->image2DCount(), TextureFormat(image->compressedFormat()), image->size());
+    texture.setCompressedSubImage(level, {}, *image);
+}
+@endcode
+
+Compressed images are imported with @ref CompressedPixelFormat equal to the
+`glInternalFormat` field, uncompressed images with @ref PixelFormat and
+@ref PixelType equal to the `glFormat` and `glType` fields and with default
+@ref PixelStorage parameters, which match the four-byte row alignment of KTX
+files. Key/value data are ignored.
+*/
+class MAGNUM_KTXIMPORTER_EXPORT KtxImporter: public AbstractImporter {
+    public:
+        /** @brief Default constructor */
+        explicit KtxImporter();
+
+        /** @brief Plugin manager constructor */
+        explicit KtxImporter(PluginManager::AbstractManager& manager, std::string plugin);
+
+        ~KtxImporter();
+
+    private:
+        struct Image {
+            Vector3i size;
+            std::size_t offset, dataSize;
+        };
+
+        Features MAGNUM_KTXIMPORTER_LOCAL doFeatures() const override;
+        bool MAGNUM_KTXIMPORTER_LOCAL doIsOpened() const override;
+        void MAGNUM_KTXIMPORTER_LOCAL doOpenData(Containers::ArrayView<const char> data) override;
+        void MAGNUM_KTXIMPORTER_LOCAL doClose() override;
+
+        UnsignedInt MAGNUM_KTXIMPORTER_LOCAL doImage2DCount() const override;
+        std::optional<ImageData2D> MAGNUM_KTXIMPORTER_LOCAL doImage2D(UnsignedInt id) override;
+
+        UnsignedInt MAGNUM_KTXIMPORTER_LOCAL doImage3DCount() const override;
+        std::optional<ImageData3D> MAGNUM_KTXIMPORTER_LOCAL doImage3D(UnsignedInt id) override;
+
+        Containers::Array<char> _in;
+        std::vector<Image> _images;
+        UnsignedInt _dimensions;
+        bool _compressed;
+        UnsignedInt _format, _type;
+};
+
+}}
+
+#endif
@@ -0,0 +1,292 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Trade/ImageData.h"
+#include "MagnumPlugins/KtxImporter/KtxHeader.h"
+#include "MagnumPlugins/KtxImporter/KtxImporter.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class KtxImporterTest: public TestSuite::Tester {
+    public:
+        explicit KtxImporterTest();
+
+        void openShort();
+        void invalidIdentifier();
+        void invalidEndianness();
+        void unsupportedFormat();
+        void unsupported1D();
+        void invalidFaceCount();
+        void truncatedLevel();
+
+        void compressed();
+        void compressedDifferentEndianness();
+        void uncompressed();
+        void cubeMap();
+
+        void useTwice();
+};
+
+KtxImporterTest::KtxImporterTest() {
+    addTests({&KtxImporterTest::openShort,
+              &KtxImporterTest::invalidIdentifier,
+              &KtxImporterTest::invalidEndianness,
+              &KtxImporterTest::unsupportedFormat,
+              &KtxImporterTest::unsupported1D,
+              &KtxImporterTest::invalidFaceCount,
+              &KtxImporterTest::truncatedLevel,
+
+              &KtxImporterTest::compressed,
+              &KtxImporterTest::compressedDifferentEndianness,
+              &KtxImporterTest::uncompressed,
+              &KtxImporterTest::cubeMap,
+
+              &KtxImporterTest::useTwice});
+}
+
+namespace {
+    /* The test files are little-endian, except for compressed-be.ktx */
+    Containers::Array<char> testFile(const std::string& filename) {
+        return Utility::Directory::read(Utility::Directory::join(KTXIMPORTER_TEST_DIR, filename));
+    }
+
+    KtxHeader& header(Containers::Array<char>& data) {
+        return *reinterpret_cast<KtxHeader*>(data.data());
+    }
+}
+
+void KtxImporterTest::openShort() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    KtxImporter importer;
+    const char data[] = { '\xab', 'K', 'T', 'X', ' ', '1', '1', '\xbb' };
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::KtxImporter::openData(): the file is too short: 8 bytes\n");
+}
+
+void KtxImporterTest::invalidIdentifier() {
+    Containers::Array<char> data = testFile("compressed.ktx");
+    CORRADE_VERIFY(data);
+    data[6] = '2';
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    KtxImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::KtxImporter::openData(): invalid file identifier\n");
+}
+
+void KtxImporterTest::invalidEndianness() {
+    Containers::Array<char> data = testFile("compressed.ktx");
+    CORRADE_VERIFY(data);
+    header(data).endianness = 0x01020403;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    KtxImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::KtxImporter::openData(): invalid endianness marker\n");
+}
+
+void KtxImporterTest::unsupportedFormat() {
+    if(Utility::Endianness::isBigEndian())
+        CORRADE_SKIP("The test file is little-endian.");
+
+    Containers::Array<char> data = testFile("rgb.ktx");
+    CORRADE_VERIFY(data);
+    /* GL_UNSIGNED_SHORT_5_6_5 */
+    header(data).glType = 0x8363;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    KtxImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::KtxImporter::openData(): unsupported format 0x1907 and type 0x8363\n");
+}
+
+void KtxImporterTest::unsupported1D() {
+    if(Utility::Endianness::isBigEndian())
+        CORRADE_SKIP("The test file is little-endian.");
+
+    Containers::Array<char> data = testFile("compressed.ktx");
+    CORRADE_VERIFY(data);
+    header(data).pixelHeight = 0;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    KtxImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::KtxImporter::openData(): 1D images are not supported\n");
+}
+
+void KtxImporterTest::invalidFaceCount() {
+    if(Utility::Endianness::isBigEndian())
+        CORRADE_SKIP("The test file is little-endian.");
+
+    Containers::Array<char> data = testFile("compressed.ktx");
+    CORRADE_VERIFY(data);
+    header(data).numberOfFaces = 3;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    KtxImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::KtxImporter::openData(): invalid face count 3\n");
+}
+
+void KtxImporterTest::truncatedLevel() {
+    if(Utility::Endianness::isBigEndian())
+        CORRADE_SKIP("The test file is little-endian.");
+
+    Containers::Array<char> data = testFile("compressed.ktx");
+    CORRADE_VERIFY(data);
+    /* One more mip level than there is in the file */
+    header(data).numberOfMipmapLevels = 4;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    KtxImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::KtxImporter::openData(): the file is too short: 120 bytes\n");
+}
+
+void KtxImporterTest::compressed() {
+    KtxImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(KTXIMPORTER_TEST_DIR, "compressed.ktx")));
+    CORRADE_COMPARE(importer.image2DCount(), 3);
+    CORRADE_COMPARE(importer.image3DCount(), 0);
+
+    /* Key/value data are skipped, each mip level is a separate image */
+    std::optional<ImageData2D> image = importer.image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_VERIFY(image->isCompressed());
+    CORRADE_COMPARE(image->compressedFormat(), CompressedPixelFormat::RGBAS3tcDxt1);
+    CORRADE_COMPARE(image->size(), Vector2i(8, 4));
+    CORRADE_COMPARE_AS(image->data(),
+        (Containers::Array<char>::from(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)),
+        TestSuite::Compare::Container);
+
+    image = importer.image2D(1);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->size(), Vector2i(4, 2));
+    CORRADE_COMPARE_AS(image->data(),
+        (Containers::Array<char>::from(16, 17, 18, 19, 20, 21, 22, 23)),
+        TestSuite::Compare::Container);
+
+    /* The smallest level is clamped to one pixel in height */
+    image = importer.image2D(2);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 1));
+    CORRADE_COMPARE_AS(image->data(),
+        (Containers::Array<char>::from(24, 25, 26, 27, 28, 29, 30, 31)),
+        TestSuite::Compare::Container);
+}
+
+void KtxImporterTest::compressedDifferentEndianness() {
+    /* Same as above, only the header and image sizes are big-endian */
+    KtxImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(KTXIMPORTER_TEST_DIR, "compressed-be.ktx")));
+    CORRADE_COMPARE(importer.image2DCount(), 3);
+
+    std::optional<ImageData2D> image = importer.image2D(2);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->compressedFormat(), CompressedPixelFormat::RGBAS3tcDxt1);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 1));
+    CORRADE_COMPARE_AS(image->data(),
+        (Containers::Array<char>::from(24, 25, 26, 27, 28, 29, 30, 31)),
+        TestSuite::Compare::Container);
+}
+
+void KtxImporterTest::uncompressed() {
+    KtxImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(KTXIMPORTER_TEST_DIR, "rgb.ktx")));
+    CORRADE_COMPARE(importer.image2DCount(), 1);
+
+    std::optional<ImageData2D> image = importer.image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_VERIFY(!image->isCompressed());
+    CORRADE_COMPARE(image->format(), PixelFormat::RGB);
+    CORRADE_COMPARE(image->type(), PixelType::UnsignedByte);
+    CORRADE_COMPARE(image->size(), Vector2i(3, 2));
+
+    /* Rows are padded to four bytes, same as the default pixel storage */
+    CORRADE_COMPARE_AS(image->data(),
+        (Containers::Array<char>::from(1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 0, 0,
+                                       10, 11, 12, 13, 14, 15, 16, 17, 18, 0, 0, 0)),
+        TestSuite::Compare::Container);
+}
+
+void KtxImporterTest::cubeMap() {
+    KtxImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(KTXIMPORTER_TEST_DIR, "cube.ktx")));
+    CORRADE_COMPARE(importer.image2DCount(), 0);
+    CORRADE_COMPARE(importer.image3DCount(), 1);
+
+    /* All six faces are in a single image */
+    std::optional<ImageData3D> image = importer.image3D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->compressedFormat(), CompressedPixelFormat::RGBAS3tcDxt1);
+    CORRADE_COMPARE(image->size(), Vector3i(4, 4, 6));
+    CORRADE_COMPARE(image->data().size(), 48);
+    CORRADE_COMPARE(image->data()[8], 8);
+    CORRADE_COMPARE(image->data()[47], 47);
+}
+
+void KtxImporterTest::useTwice() {
+    KtxImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(KTXIMPORTER_TEST_DIR, "compressed.ktx")));
+
+    /* Verify that the data are copied and not moved out */
+    {
+        std::optional<ImageData2D> image = importer.image2D(0);
+        CORRADE_VERIFY(image);
+        CORRADE_COMPARE(image->size(), Vector2i(8, 4));
+    } {
+        std::optional<ImageData2D> image = importer.image2D(0);
+        CORRADE_VERIFY(image);
+        CORRADE_COMPARE(image->size(), Vector2i(8, 4));
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::KtxImporterTest)
@@ -25,37 +25,114 @@
 
 #include "MagnumFont.h"
 
+#include <algorithm>
+#include <cstring>
 #include <sstream>
 #include <Corrade/Containers/ArrayView.h>
 #include <Corrade/Utility/Directory.h>
-#include <Corrade/Utility/Unicode.h>
+#include <Corrade/Utility/Endianness.h>
 
+#include "Magnum/Text/BatchLayouter.h"
 #include "Magnum/Text/GlyphCache.h"
 #include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MapFile.h"
+#include "MagnumPlugins/MagnumFont/MagnumFontHeader.h"
 #include "MagnumPlugins/TgaImporter/TgaImporter.h"
 
 namespace Magnum { namespace Text {
 
 struct MagnumFont::Data {
-    Utility::Configuration conf;
+    explicit Data(Trade::ImageData2D&& image): image{std::move(image)} {}
+
+    /* Binary glyph table, either memory-mapped or copied. Empty if opened
+       from the text file, the tables are in the storage vectors then. */
+    Containers::Array<char> binary;
+    std::vector<MagnumFontCharacter> characterStorage;
+    std::vector<MagnumFontGlyph> glyphStorage;
+
+    /* Sorted by codepoint */
+    Containers::ArrayView<const MagnumFontCharacter> characters;
+    Containers::ArrayView<const MagnumFontGlyph> glyphs;
+
+    Vector2i originalImageSize, padding;
     Trade::ImageData2D image;
-    std::unordered_map<char32_t, UnsignedInt> glyphId;
-    std::vector<Vector2> glyphAdvance;
 };
 
 namespace {
-    class MagnumFontLayouter: public AbstractLayouter {
-        public:
-            explicit MagnumFontLayouter(const std::vector<Vector2>& glyphAdvance, const GlyphCache& cache, Float fontSize, Float textSize, std::vector<UnsignedInt>&& glyphs);
-
-        private:
-            std::tuple<Range2D, Range2D, Vector2> doRenderGlyph(UnsignedInt i) override;
-
-            const std::vector<Vector2>& glyphAdvance;
-            const GlyphCache& cache;
-            const Float fontSize, textSize;
-            const std::vector<UnsignedInt> glyphs;
-    };
+    bool isBinary(const Containers::ArrayView<const char> data) {
+        return data.size() >= 4 && std::strncmp(data, "MGFN", 4) == 0;
+    }
+
+    /* Checks everything so the tables can be used without any further
+       checks. Returns the image filename or empty string on failure. */
+    std::string checkBinary(const Containers::ArrayView<const char> data, const char* const prefix) {
+        if(data.size() < sizeof(MagnumFontHeader)) {
+            Error() << prefix << "the file is too short:" << data.size() << "bytes";
+            return {};
+        }
+
+        const MagnumFontHeader& header = *reinterpret_cast<const MagnumFontHeader*>(data.data());
+        if(header.version != MagnumFontVersion) {
+            Error() << prefix << "unsupported binary file version, expected" << UnsignedInt(MagnumFontVersion) << "but got" << UnsignedInt(header.version);
+            return {};
+        }
+        if(!(header.flags & MagnumFontFlag::BigEndian) != !Utility::Endianness::isBigEndian()) {
+            Error() << prefix << "the file has different endianness than this machine";
+            return {};
+        }
+        if(data.size() < sizeof(MagnumFontHeader) + std::size_t(header.characterCount)*sizeof(MagnumFontCharacter) + std::size_t(header.glyphCount)*sizeof(MagnumFontGlyph) + header.imageFilenameSize || !header.imageFilenameSize) {
+            Error() << prefix << "the file is too short:" << data.size() << "bytes";
+            return {};
+        }
+
+        const MagnumFontCharacter* const characters = reinterpret_cast<const MagnumFontCharacter*>(data.data() + sizeof(MagnumFontHeader));
+        for(std::size_t i = 0; i != header.characterCount; ++i) {
+            if(characters[i].glyph >= header.glyphCount || (i && characters[i].codepoint <= characters[i - 1].codepoint)) {
+                Error() << prefix << "invalid character" << i;
+                return {};
+            }
+        }
+
+        const char* const imageFilename = data.data() + sizeof(MagnumFontHeader) + header.characterCount*sizeof(MagnumFontCharacter) + header.glyphCount*sizeof(MagnumFontGlyph);
+        return {imageFilename, header.imageFilenameSize};
+    }
+
+    /* Check that we have also the image file, open and load it */
+    std::optional<Trade::ImageData2D> openImageData(const std::string& imageFilename, const std::pair<std::string, Containers::ArrayView<const char>>& file) {
+        if(imageFilename != file.first) {
+            Error() << "Text::MagnumFont::openData(): expected file"
+                    << imageFilename << "but got" << file.first;
+            return std::nullopt;
+        }
+
+        Trade::TgaImporter importer;
+        if(!importer.openData(file.second)) {
+            Error() << "Text::MagnumFont::openData(): cannot open image file";
+            return std::nullopt;
+        }
+        std::optional<Trade::ImageData2D> image = importer.image2D(0);
+        if(!image) {
+            Error() << "Text::MagnumFont::openData(): cannot load image file";
+            return std::nullopt;
+        }
+
+        return image;
+    }
+
+    std::optional<Trade::ImageData2D> openImageFile(const std::string& imageFilename) {
+        Trade::TgaImporter importer;
+        if(!importer.openFile(imageFilename)) {
+            Error() << "Text::MagnumFont::openFile(): cannot open image file" << imageFilename;
+            return std::nullopt;
+        }
+        std::optional<Trade::ImageData2D> image = importer.image2D(0);
+        if(!image) {
+            Error() << "Text::MagnumFont::openFile(): cannot load image file";
+            return std::nullopt;
+        }
+
+        return image;
+    }
 }
 
 MagnumFont::MagnumFont(): _opened(nullptr) {}
@@ -69,12 +146,25 @@ auto MagnumFont::doFeatures() const -> Features { return Feature::OpenData|Featu
 bool MagnumFont::doIsOpened() const { return _opened; }
 
 auto MagnumFont::doOpenData(const std::vector<std::pair<std::string, Containers::ArrayView<const char>>>& data, const Float) -> Metrics {
-    /* We need just the configuration file and image file */
+    /* We need just the font file and image file */
     if(data.size() != 2) {
         Error() << "Text::MagnumFont::openData(): wanted two files, got" << data.size();
         return {};
     }
 
+    /* Binary file, copy it so it can be referenced directly */
+    if(isBinary(data[0].second)) {
+        const std::string imageFilename = checkBinary(data[0].second, "Text::MagnumFont::openData():");
+        if(imageFilename.empty()) return {};
+
+        std::optional<Trade::ImageData2D> image = openImageData(imageFilename, data[1]);
+        if(!image) return {};
+
+        Containers::Array<char> binary{data[0].second.size()};
+        std::copy(data[0].second.begin(), data[0].second.end(), binary.begin());
+        return openBinaryInternal(std::move(binary), std::move(*image));
+    }
+
     /* Open the configuration file */
     std::istringstream in({data[0].second.begin(), data[0].second.size()});
     Utility::Configuration conf(in, Utility::Configuration::Flag::SkipComments);
@@ -90,29 +180,30 @@ auto MagnumFont::doOpenData(const std::vector<std::pair<std::string, Containers:
         return {};
     }
 
-    /* Check that we have also the image file */
-    if(conf.value("image") != data[1].first) {
-        Error() << "Text::MagnumFont::openData(): expected file"
-                << conf.value("image") << "but got" << data[1].first;
-        return {};
-    }
-
-    /* Open and load image file */
-    Trade::TgaImporter importer;
-    if(!importer.openData(data[1].second)) {
-        Error() << "Text::MagnumFont::openData(): cannot open image file";
-        return {};
-    }
-    std::optional<Trade::ImageData2D> image = importer.image2D(0);
-    if(!image) {
-        Error() << "Text::MagnumFont::openData(): cannot load image file";
-        return {};
-    }
+    std::optional<Trade::ImageData2D> image = openImageData(conf.value("image"), data[1]);
+    if(!image) return {};
 
     return openInternal(std::move(conf), std::move(*image));
 }
 
 auto MagnumFont::doOpenFile(const std::string& filename, Float) -> Metrics {
+    /* Map the file, if possible, so the binary glyph table can be used
+       directly without ever being read. If it's not a binary file, the data
+       are thrown away and the file is parsed as a configuration file. */
+    std::optional<Containers::Array<char>> mapped = Trade::mapFile(filename);
+    if(!mapped) return {};
+    Containers::Array<char> binary = std::move(*mapped);
+    if(isBinary(binary)) {
+        const std::string imageFilename = checkBinary(binary, "Text::MagnumFont::openFile():");
+        if(imageFilename.empty()) return {};
+
+        std::optional<Trade::ImageData2D> image = openImageFile(Utility::Directory::join(Utility::Directory::path(filename), imageFilename));
+        if(!image) return {};
+
+        return openBinaryInternal(std::move(binary), std::move(*image));
+    }
+    binary = nullptr;
+
     /* Open the configuration file */
     Utility::Configuration conf(filename, Utility::Configuration::Flag::ReadOnly|Utility::Configuration::Flag::SkipComments);
     if(!conf.isValid() || conf.isEmpty()) {
@@ -127,44 +218,65 @@ auto MagnumFont::doOpenFile(const std::string& filename, Float) -> Metrics {
         return {};
     }
 
-    /* Open and load image file */
-    const std::string imageFilename = Utility::Directory::join(Utility::Directory::path(filename), conf.value("image"));
-    Trade::TgaImporter importer;
-    if(!importer.openFile(imageFilename)) {
-        Error() << "Text::MagnumFont::openFile(): cannot open image file" << imageFilename;
-        return {};
-    }
-    std::optional<Trade::ImageData2D> image = importer.image2D(0);
-    if(!image) {
-        Error() << "Text::MagnumFont::openFile(): cannot load image file";
-        return {};
-    }
+    std::optional<Trade::ImageData2D> image = openImageFile(Utility::Directory::join(Utility::Directory::path(filename), conf.value("image")));
+    if(!image) return {};
 
     return openInternal(std::move(conf), std::move(*image));
 }
 
 auto MagnumFont::openInternal(Utility::Configuration&& conf, Trade::ImageData2D&& image) -> Metrics {
     /* Everything okay, save the data internally */
-    _opened = new Data{std::move(conf), std::move(image), std::unordered_map<char32_t, UnsignedInt>{}, {}};
-
-    /* Glyph advances */
-    const std::vector<Utility::ConfigurationGroup*> glyphs = _opened->conf.groups("glyph");
-    _opened->glyphAdvance.reserve(glyphs.size());
-    for(const Utility::ConfigurationGroup* const g: glyphs)
-        _opened->glyphAdvance.push_back(g->value<Vector2>("advance"));
+    _opened = new Data{std::move(image)};
+    _opened->originalImageSize = conf.value<Vector2i>("originalImageSize");
+    _opened->padding = conf.value<Vector2i>("padding");
+
+    /* Glyph properties */
+    const std::vector<Utility::ConfigurationGroup*> glyphs = conf.groups("glyph");
+    _opened->glyphStorage.reserve(glyphs.size());
+    for(const Utility::ConfigurationGroup* const g: glyphs) {
+        const Vector2 advance = g->value<Vector2>("advance");
+        const Vector2i position = g->value<Vector2i>("position");
+        const Range2Di rectangle = g->value<Range2Di>("rectangle");
+        _opened->glyphStorage.push_back({
+            {advance.x(), advance.y()},
+            {position.x(), position.y()},
+            {rectangle.left(), rectangle.bottom(), rectangle.right(), rectangle.top()}});
+    }
 
-    /* Fill character->glyph map */
-    const std::vector<Utility::ConfigurationGroup*> chars = _opened->conf.groups("char");
+    /* Fill character->glyph map, sort it by codepoint for lookup. If a
+       character is there more than once, the first occurence is used. */
+    const std::vector<Utility::ConfigurationGroup*> chars = conf.groups("char");
+    _opened->characterStorage.reserve(chars.size());
     for(const Utility::ConfigurationGroup* const c: chars) {
         const UnsignedInt glyphId = c->value<UnsignedInt>("glyph");
-        CORRADE_INTERNAL_ASSERT(glyphId < _opened->glyphAdvance.size());
-        _opened->glyphId.emplace(c->value<char32_t>("unicode"), glyphId);
+        CORRADE_INTERNAL_ASSERT(glyphId < _opened->glyphStorage.size());
+        _opened->characterStorage.push_back({UnsignedInt(c->value<char32_t>("unicode")), glyphId});
     }
+    std::stable_sort(_opened->characterStorage.begin(), _opened->characterStorage.end(),
+        [](const MagnumFontCharacter& a, const MagnumFontCharacter& b) { return a.codepoint < b.codepoint; });
+    _opened->characterStorage.erase(std::unique(_opened->characterStorage.begin(), _opened->characterStorage.end(),
+        [](const MagnumFontCharacter& a, const MagnumFontCharacter& b) { return a.codepoint == b.codepoint; }), _opened->characterStorage.end());
+
+    _opened->characters = {_opened->characterStorage.data(), _opened->characterStorage.size()};
+    _opened->glyphs = {_opened->glyphStorage.data(), _opened->glyphStorage.size()};
+
+    return {conf.value<Float>("fontSize"),
+            conf.value<Float>("ascent"),
+            conf.value<Float>("descent"),
+            conf.value<Float>("lineHeight")};
+}
 
-    return {_opened->conf.value<Float>("fontSize"),
-            _opened->conf.value<Float>("ascent"),
-            _opened->conf.value<Float>("descent"),
-            _opened->conf.value<Float>("lineHeight")};
+auto MagnumFont::openBinaryInternal(Containers::Array<char>&& data, Trade::ImageData2D&& image) -> Metrics {
+    /* The data were checked already, reference the tables directly */
+    _opened = new Data{std::move(image)};
+    _opened->binary = std::move(data);
+    const MagnumFontHeader& header = *reinterpret_cast<const MagnumFontHeader*>(_opened->binary.data());
+    _opened->originalImageSize = {header.originalImageSize[0], header.originalImageSize[1]};
+    _opened->padding = {header.padding[0], header.padding[1]};
+    _opened->characters = {reinterpret_cast<const MagnumFontCharacter*>(_opened->binary + sizeof(MagnumFontHeader)), header.characterCount};
+    _opened->glyphs = {reinterpret_cast<const MagnumFontGlyph*>(_opened->binary + sizeof(MagnumFontHeader) + header.characterCount*sizeof(MagnumFontCharacter)), header.glyphCount};
+
+    return {header.fontSize, header.ascent, header.descent, header.lineHeight};
 }
 
 void MagnumFont::doClose() {
@@ -173,67 +285,37 @@ void MagnumFont::doClose() {
 }
 
 UnsignedInt MagnumFont::doGlyphId(const char32_t character) {
-    auto it = _opened->glyphId.find(character);
-    return it != _opened->glyphId.end() ? it->second : 0;
+    const MagnumFontCharacter* const found = std::lower_bound(_opened->characters.begin(), _opened->characters.end(), UnsignedInt(character),
+        [](const MagnumFontCharacter& a, const UnsignedInt b) { return a.codepoint < b; });
+    return found != _opened->characters.end() && found->codepoint == character ? found->glyph : 0;
 }
 
 Vector2 MagnumFont::doGlyphAdvance(const UnsignedInt glyph) {
-    return glyph < _opened->glyphAdvance.size() ? _opened->glyphAdvance[glyph] : Vector2();
+    if(glyph >= _opened->glyphs.size()) return {};
+    const MagnumFontGlyph& data = _opened->glyphs[glyph];
+    return {data.advance[0], data.advance[1]};
 }
 
 std::unique_ptr<GlyphCache> MagnumFont::doCreateGlyphCache() {
     /* Set cache image */
     std::unique_ptr<GlyphCache> cache(new Text::GlyphCache(
-        _opened->conf.value<Vector2i>("originalImageSize"),
+        _opened->originalImageSize,
         _opened->image.size(),
-        _opened->conf.value<Vector2i>("padding")));
+        _opened->padding));
     cache->setImage({}, _opened->image);
 
     /* Fill glyph map */
-    const std::vector<Utility::ConfigurationGroup*> glyphs = _opened->conf.groups("glyph");
-    for(std::size_t i = 0; i != glyphs.size(); ++i)
-        cache->insert(i, glyphs[i]->value<Vector2i>("position"), glyphs[i]->value<Range2Di>("rectangle"));
+    for(std::size_t i = 0; i != _opened->glyphs.size(); ++i) {
+        const MagnumFontGlyph& glyph = _opened->glyphs[i];
+        cache->insert(i, {glyph.position[0], glyph.position[1]},
+            {{glyph.rectangle[0], glyph.rectangle[1]}, {glyph.rectangle[2], glyph.rectangle[3]}});
+    }
 
     return cache;
 }
 
 std::unique_ptr<AbstractLayouter> MagnumFont::doLayout(const GlyphCache& cache, Float size, const std::string& text) {
-    /* Get glyph codes from characters */
-    std::vector<UnsignedInt> glyphs;
-    glyphs.reserve(text.size());
-    for(std::size_t i = 0; i != text.size(); ) {
-        UnsignedInt codepoint;
-        std::tie(codepoint, i) = Utility::Unicode::nextChar(text, i);
-        const auto it = _opened->glyphId.find(codepoint);
-        glyphs.push_back(it == _opened->glyphId.end() ? 0 : it->second);
-    }
-
-    return std::unique_ptr<MagnumFontLayouter>(new MagnumFontLayouter(_opened->glyphAdvance, cache, this->size(), size, std::move(glyphs)));
-}
-
-namespace {
-
-MagnumFontLayouter::MagnumFontLayouter(const std::vector<Vector2>& glyphAdvance, const GlyphCache& cache, const Float fontSize, const Float textSize, std::vector<UnsignedInt>&& glyphs): AbstractLayouter(glyphs.size()), glyphAdvance(glyphAdvance), cache(cache), fontSize(fontSize), textSize(textSize), glyphs(std::move(glyphs)) {}
-
-std::tuple<Range2D, Range2D, Vector2> MagnumFontLayouter::doRenderGlyph(const UnsignedInt i) {
-    /* Position of the texture in the resulting glyph, texture coordinates */
-    Vector2i position;
-    Range2Di rectangle;
-    std::tie(position, rectangle) = cache[glyphs[i]];
-
-    /* Normalized texture coordinates */
-    const auto textureCoordinates = Range2D(rectangle).scaled(1.0f/Vector2(cache.textureSize()));
-
-    /* Quad rectangle, computed from texture rectangle, denormalized to
-       requested text size */
-    const auto quadRectangle = Range2D(Range2Di::fromSize(position, rectangle.size())).scaled(Vector2(textSize/fontSize));
-
-    /* Advance for given glyph, denormalized to requested text size */
-    const Vector2 advance = glyphAdvance[glyphs[i]]*(textSize/fontSize);
-
-    return std::make_tuple(quadRectangle, textureCoordinates, advance);
-}
-
+    return std::unique_ptr<AbstractLayouter>(new BatchLayouter(*this, cache, size, text));
 }
 
 }}
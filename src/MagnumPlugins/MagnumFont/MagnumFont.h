@@ -29,6 +29,8 @@
  * @brief Class @ref Magnum::Text::MagnumFont
  */
 
+#include <Corrade/Containers/Array.h>
+
 #include "Magnum/Text/AbstractFont.h"
 #include "Magnum/Trade/Trade.h"
 
@@ -116,6 +118,18 @@ The file syntax is as in following:
 
     # ...
 
+Besides the text file, MagnumFontConverter also writes a binary glyph table
+(`*.mgfont`) with the same information, described by @ref MagnumFontHeader. Opening it
+instead of the text file avoids parsing and allocating a configuration group
+for each glyph and character, which makes a difference for fonts with many
+thousands of glyphs. Where possible, the file is memory-mapped and the
+character and glyph tables are used directly from it, character lookup is
+done using a binary search in the sorted character table. The format is
+detected from the file signature, so the text and binary file can be used
+interchangeably in @ref openFile() and @ref openData(). The binary file is
+in the endianness of the machine that wrote it and files with different
+endianness are rejected.
+
 @see @ref Trade::TgaImporter
 */
 class MAGNUM_MAGNUMFONT_EXPORT MagnumFont: public AbstractFont {
@@ -143,6 +157,7 @@ class MAGNUM_MAGNUMFONT_EXPORT MagnumFont: public AbstractFont {
         MAGNUM_MAGNUMFONT_LOCAL std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache& cache, Float size, const std::string& text) override;
 
         MAGNUM_MAGNUMFONT_LOCAL Metrics openInternal(Utility::Configuration&& conf, Trade::ImageData2D&& image);
+        MAGNUM_MAGNUMFONT_LOCAL Metrics openBinaryInternal(Containers::Array<char>&& data, Trade::ImageData2D&& image);
 
         Data* _opened;
 };
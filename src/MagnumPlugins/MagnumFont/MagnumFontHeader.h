@@ -0,0 +1,87 @@
+#ifndef Magnum_Text_MagnumFontHeader_h
+#define Magnum_Text_MagnumFontHeader_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::Text::MagnumFontHeader, @ref Magnum::Text::MagnumFontCharacter, @ref Magnum::Text::MagnumFontGlyph
+ */
+
+#include "Magnum/Types.h"
+
+namespace Magnum { namespace Text {
+
+/**
+@brief Magnum font binary glyph table header
+
+The file starts with this header, followed by @ref characterCount
+@ref MagnumFontCharacter entries sorted by codepoint, @ref glyphCount
+@ref MagnumFontGlyph entries and @ref imageFilenameSize bytes of glyph image
+filename, which is not null-terminated. All values are in the endianness of
+the machine that wrote the file, see @ref MagnumFontFlag::BigEndian.
+*/
+struct MagnumFontHeader {
+    char            signature[4];       /**< @brief File signature, `MGFN` */
+    UnsignedByte    version;            /**< @brief Format version */
+    UnsignedByte    flags;              /**< @brief @ref MagnumFontFlag values */
+    UnsignedShort   imageFilenameSize;  /**< @brief Image filename length */
+    UnsignedInt     characterCount;     /**< @brief Character count */
+    UnsignedInt     glyphCount;         /**< @brief Glyph count */
+    Int             originalImageSize[2];   /**< @brief Size of unscaled font image */
+    Int             padding[2];         /**< @brief Glyph padding */
+    Float           fontSize;           /**< @brief Font size */
+    Float           ascent;             /**< @brief Font ascent */
+    Float           descent;            /**< @brief Font descent */
+    Float           lineHeight;         /**< @brief Line height */
+};
+
+/** @brief Magnum font character entry */
+struct MagnumFontCharacter {
+    UnsignedInt     codepoint;          /**< @brief UTF-32 codepoint */
+    UnsignedInt     glyph;              /**< @brief Glyph ID */
+};
+
+/** @brief Magnum font glyph entry */
+struct MagnumFontGlyph {
+    Float           advance[2];         /**< @brief Advance in pixels on unscaled font image */
+    Int             position[2];        /**< @brief Glyph texture position relative to baseline */
+    Int             rectangle[4];       /**< @brief Glyph rectangle in font image (left, bottom, right, top) */
+};
+
+/** @brief Magnum font header flags */
+namespace MagnumFontFlag { enum: UnsignedByte {
+    BigEndian = 1 << 0  /**< The file is in big-endian */
+}; }
+
+/** @brief Current Magnum font binary format version */
+constexpr UnsignedByte MagnumFontVersion = 1;
+
+static_assert(sizeof(MagnumFontHeader) == 48, "MagnumFontHeader size is not 48 bytes");
+static_assert(sizeof(MagnumFontCharacter) == 8, "MagnumFontCharacter size is not 8 bytes");
+static_assert(sizeof(MagnumFontGlyph) == 32, "MagnumFontGlyph size is not 32 bytes");
+
+}}
+
+#endif
@@ -23,11 +23,15 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/Endianness.h>
 
 #include "Magnum/Test/AbstractOpenGLTester.h"
 #include "Magnum/Text/GlyphCache.h"
 #include "MagnumPlugins/MagnumFont/MagnumFont.h"
+#include "MagnumPlugins/MagnumFont/MagnumFontHeader.h"
 
 #include "configure.h"
 
@@ -40,12 +44,24 @@ class MagnumFontGLTest: public Magnum::Test::AbstractOpenGLTester {
         void properties();
         void layout();
         void createGlyphCache();
+
+        void propertiesBinary();
+        void openDataBinary();
+        void createGlyphCacheBinary();
+        void binaryDifferentEndianness();
+        void binaryInvalidCharacter();
 };
 
 MagnumFontGLTest::MagnumFontGLTest() {
     addTests({&MagnumFontGLTest::properties,
               &MagnumFontGLTest::layout,
-              &MagnumFontGLTest::createGlyphCache});
+              &MagnumFontGLTest::createGlyphCache,
+
+              &MagnumFontGLTest::propertiesBinary,
+              &MagnumFontGLTest::openDataBinary,
+              &MagnumFontGLTest::createGlyphCacheBinary,
+              &MagnumFontGLTest::binaryDifferentEndianness,
+              &MagnumFontGLTest::binaryInvalidCharacter});
 }
 
 void MagnumFontGLTest::properties() {
@@ -115,6 +131,91 @@ void MagnumFontGLTest::createGlyphCache() {
     /** @todo properly test contents */
 }
 
+void MagnumFontGLTest::propertiesBinary() {
+    if(Utility::Endianness::isBigEndian())
+        CORRADE_SKIP("The test file is little-endian.");
+
+    MagnumFont font;
+    CORRADE_VERIFY(font.openFile(Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.mgfont"), 0.0f));
+    CORRADE_COMPARE(font.size(), 16.0f);
+    CORRADE_COMPARE(font.ascent(), 25.0f);
+    CORRADE_COMPARE(font.descent(), -10.0f);
+    CORRADE_COMPARE(font.lineHeight(), 39.7333f);
+    CORRADE_COMPARE(font.glyphId(U'W'), 2);
+    CORRADE_COMPARE(font.glyphId(U'e'), 1);
+    CORRADE_COMPARE(font.glyphId(U'a'), 0);
+
+    /* Characters not in the table and out-of-range codepoints map to glyph 0 */
+    CORRADE_COMPARE(font.glyphId(U'A'), 0);
+    CORRADE_COMPARE(font.glyphId(U'z'), 0);
+    CORRADE_COMPARE(font.glyphAdvance(font.glyphId(U'W')), Vector2(23.0f, 0.0f));
+}
+
+void MagnumFontGLTest::openDataBinary() {
+    if(Utility::Endianness::isBigEndian())
+        CORRADE_SKIP("The test file is little-endian.");
+
+    Containers::Array<char> fontData = Utility::Directory::read(Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.mgfont"));
+    Containers::Array<char> imageData = Utility::Directory::read(Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.tga"));
+    CORRADE_VERIFY(fontData);
+    CORRADE_VERIFY(imageData);
+
+    MagnumFont font;
+    CORRADE_VERIFY(font.openData({{"font.mgfont", fontData}, {"font.tga", imageData}}, 0.0f));
+    CORRADE_COMPARE(font.size(), 16.0f);
+    CORRADE_COMPARE(font.glyphAdvance(font.glyphId(U'e')), Vector2(12.0f, 0.0f));
+}
+
+void MagnumFontGLTest::createGlyphCacheBinary() {
+    if(Utility::Endianness::isBigEndian())
+        CORRADE_SKIP("The test file is little-endian.");
+
+    MagnumFont font;
+    CORRADE_VERIFY(font.openFile(Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.mgfont"), 0.0f));
+
+    std::unique_ptr<GlyphCache> cache = font.createGlyphCache();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(cache);
+    CORRADE_COMPARE(cache->glyphCount(), 3);
+    CORRADE_COMPARE(cache->padding(), Vector2i(24));
+    CORRADE_VERIFY((*cache)[2] == std::make_pair(Vector2i(25, 34), Range2Di({0, 8}, {16, 128})));
+}
+
+void MagnumFontGLTest::binaryDifferentEndianness() {
+    Containers::Array<char> fontData = Utility::Directory::read(Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.mgfont"));
+    Containers::Array<char> imageData = Utility::Directory::read(Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.tga"));
+    CORRADE_VERIFY(fontData);
+    /* Flip the flag so it doesn't match this machine regardless of what it
+       is */
+    reinterpret_cast<MagnumFontHeader*>(fontData.data())->flags ^= MagnumFontFlag::BigEndian;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MagnumFont font;
+    CORRADE_VERIFY(!font.openData({{"font.mgfont", fontData}, {"font.tga", imageData}}, 0.0f));
+    CORRADE_COMPARE(out.str(), "Text::MagnumFont::openData(): the file has different endianness than this machine\n");
+}
+
+void MagnumFontGLTest::binaryInvalidCharacter() {
+    if(Utility::Endianness::isBigEndian())
+        CORRADE_SKIP("The test file is little-endian.");
+
+    Containers::Array<char> fontData = Utility::Directory::read(Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.mgfont"));
+    Containers::Array<char> imageData = Utility::Directory::read(Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.tga"));
+    CORRADE_VERIFY(fontData);
+    /* Break the codepoint order needed for the lookup */
+    reinterpret_cast<MagnumFontCharacter*>(fontData + sizeof(MagnumFontHeader))[2].codepoint = U'A';
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MagnumFont font;
+    CORRADE_VERIFY(!font.openData({{"font.mgfont", fontData}, {"font.tga", imageData}}, 0.0f));
+    CORRADE_COMPARE(out.str(), "Text::MagnumFont::openData(): invalid character 2\n");
+}
+
 }}}
 
 MAGNUM_GL_TEST_MAIN(Magnum::Text::Test::MagnumFontGLTest)
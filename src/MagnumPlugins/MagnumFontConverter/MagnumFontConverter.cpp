@@ -25,14 +25,18 @@
 
 #include "MagnumFontConverter.h"
 
+#include <algorithm>
+#include <cstring>
 #include <sstream>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/Endianness.h>
 
 #include "Magnum/Image.h"
 #include "Magnum/PixelFormat.h"
 #include "Magnum/Text/GlyphCache.h"
 #include "Magnum/Text/AbstractFont.h"
+#include "MagnumPlugins/MagnumFont/MagnumFontHeader.h"
 #include "MagnumPlugins/TgaImageConverter/TgaImageConverter.h"
 
 namespace Magnum { namespace Text {
@@ -73,6 +77,8 @@ std::vector<std::pair<std::string, Containers::Array<char>>> MagnumFontConverter
         inverseGlyphIdMap[map.second] = map.first;
 
     /* Character->glyph map, map glyph IDs to new ones */
+    std::vector<MagnumFontCharacter> binaryCharacters;
+    binaryCharacters.reserve(characters.size());
     for(const char32_t c: characters) {
         Utility::ConfigurationGroup* group = configuration.addGroup("char");
         const UnsignedInt glyphId = font.glyphId(c);
@@ -80,18 +86,36 @@ std::vector<std::pair<std::string, Containers::Array<char>>> MagnumFontConverter
 
         /* Map old glyph ID to new, if not found, map to glyph 0 */
         auto found = glyphIdMap.find(glyphId);
-        group->setValue("glyph", found == glyphIdMap.end() ? 0 : glyphIdMap.at(glyphId));
+        const UnsignedInt newGlyphId = found == glyphIdMap.end() ? 0 : glyphIdMap.at(glyphId);
+        group->setValue("glyph", newGlyphId);
+        binaryCharacters.push_back({UnsignedInt(c), newGlyphId});
     }
 
+    /* The binary table is sorted by codepoint and without duplicates, keeping
+       the first occurence same as MagnumFont does for the text file */
+    std::stable_sort(binaryCharacters.begin(), binaryCharacters.end(),
+        [](const MagnumFontCharacter& a, const MagnumFontCharacter& b) { return a.codepoint < b.codepoint; });
+    binaryCharacters.erase(std::unique(binaryCharacters.begin(), binaryCharacters.end(),
+        [](const MagnumFontCharacter& a, const MagnumFontCharacter& b) { return a.codepoint == b.codepoint; }), binaryCharacters.end());
+
     /* Save glyph properties in order which preserves their IDs, remove padding
        from the values so they aren't added twice when using the font later */
     /** @todo Some better way to handle this padding stuff */
+    std::vector<MagnumFontGlyph> binaryGlyphs;
+    binaryGlyphs.reserve(inverseGlyphIdMap.size());
     for(UnsignedInt oldGlyphId: inverseGlyphIdMap) {
         std::pair<Vector2i, Range2Di> glyph = cache[oldGlyphId];
+        const Vector2 advance = font.glyphAdvance(oldGlyphId);
+        const Vector2i position = glyph.first+cache.padding();
+        const Range2Di rectangle = glyph.second.padded(-cache.padding());
         Utility::ConfigurationGroup* group = configuration.addGroup("glyph");
-        group->setValue("advance", font.glyphAdvance(oldGlyphId));
-        group->setValue("position", glyph.first+cache.padding());
-        group->setValue("rectangle", glyph.second.padded(-cache.padding()));
+        group->setValue("advance", advance);
+        group->setValue("position", position);
+        group->setValue("rectangle", rectangle);
+        binaryGlyphs.push_back({
+            {advance.x(), advance.y()},
+            {position.x(), position.y()},
+            {rectangle.left(), rectangle.bottom(), rectangle.right(), rectangle.top()}});
     }
 
     std::ostringstream confOut;
@@ -100,6 +124,35 @@ std::vector<std::pair<std::string, Containers::Array<char>>> MagnumFontConverter
     Containers::Array<char> confData{confStr.size()};
     std::copy(confStr.begin(), confStr.end(), confData.begin());
 
+    /* Binary glyph table with the same contents */
+    const std::string imageFilename = configuration.value("image");
+    MagnumFontHeader header{};
+    std::memcpy(header.signature, "MGFN", 4);
+    header.version = MagnumFontVersion;
+    header.flags = Utility::Endianness::isBigEndian() ? MagnumFontFlag::BigEndian : 0;
+    header.imageFilenameSize = imageFilename.size();
+    header.characterCount = binaryCharacters.size();
+    header.glyphCount = binaryGlyphs.size();
+    header.originalImageSize[0] = cache.textureSize().x();
+    header.originalImageSize[1] = cache.textureSize().y();
+    header.padding[0] = cache.padding().x();
+    header.padding[1] = cache.padding().y();
+    header.fontSize = font.size();
+    header.ascent = font.ascent();
+    header.descent = font.descent();
+    header.lineHeight = font.lineHeight();
+
+    const std::size_t charactersSize = binaryCharacters.size()*sizeof(MagnumFontCharacter);
+    const std::size_t glyphsSize = binaryGlyphs.size()*sizeof(MagnumFontGlyph);
+    Containers::Array<char> binaryData{sizeof(MagnumFontHeader) + charactersSize + glyphsSize + imageFilename.size()};
+    std::memcpy(binaryData, &header, sizeof(MagnumFontHeader));
+    /* Empty vectors may have null data() */
+    if(charactersSize)
+        std::memcpy(binaryData + sizeof(MagnumFontHeader), binaryCharacters.data(), charactersSize);
+    if(glyphsSize)
+        std::memcpy(binaryData + sizeof(MagnumFontHeader) + charactersSize, binaryGlyphs.data(), glyphsSize);
+    std::copy(imageFilename.begin(), imageFilename.end(), binaryData + sizeof(MagnumFontHeader) + charactersSize + glyphsSize);
+
     /* Save cache image */
     Image2D image(PixelFormat::Red, PixelType::UnsignedByte);
     cache.texture().image(0, image);
@@ -107,6 +160,7 @@ std::vector<std::pair<std::string, Containers::Array<char>>> MagnumFontConverter
 
     std::vector<std::pair<std::string, Containers::Array<char>>> out;
     out.emplace_back(filename + ".conf", std::move(confData));
+    out.emplace_back(filename + ".mgfont", std::move(binaryData));
     out.emplace_back(filename + ".tga", std::move(tgaData));
     return out;
 }
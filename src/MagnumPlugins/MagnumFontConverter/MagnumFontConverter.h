@@ -51,8 +51,10 @@ namespace Magnum { namespace Text {
 /**
 @brief MagnumFont converter plugin
 
-Expects filename prefix, creates two files, `prefix.conf` and `prefix.tga`. See
-@ref MagnumFont for more information about the font.
+Expects filename prefix, creates three files, `prefix.conf`, `prefix.tga`
+and `prefix.mgfont`. The last one is a binary glyph table with the same
+contents as `prefix.conf`, which is faster to open and can be used in place of
+it. See @ref MagnumFont for more information about the font.
 
 This plugin is available only on desktop OpenGL, as it uses @ref Texture::image()
 to read back the generated data. It depends on
@@ -24,6 +24,7 @@
 */
 
 #include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/Endianness.h>
 #include <Corrade/TestSuite/Compare/File.h>
 
 #include "Magnum/Extensions.h"
@@ -56,6 +57,7 @@ void MagnumFontConverterGLTest::exportFont() {
     /* Remove previously created files */
     Utility::Directory::rm(Utility::Directory::join(MAGNUMFONTCONVERTER_TEST_WRITE_DIR, "font.conf"));
     Utility::Directory::rm(Utility::Directory::join(MAGNUMFONTCONVERTER_TEST_WRITE_DIR, "font.tga"));
+    Utility::Directory::rm(Utility::Directory::join(MAGNUMFONTCONVERTER_TEST_WRITE_DIR, "font.mgfont"));
 
     /* Fake font with fake cache */
     class FakeFont: public Text::AbstractFont {
@@ -111,6 +113,13 @@ void MagnumFontConverterGLTest::exportFont() {
                        Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.conf"),
                        TestSuite::Compare::File);
 
+    /* The binary glyph table has the same contents. The test file is
+       little-endian. */
+    if(!Utility::Endianness::isBigEndian())
+        CORRADE_COMPARE_AS(Utility::Directory::join(MAGNUMFONTCONVERTER_TEST_WRITE_DIR, "font.mgfont"),
+                           Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.mgfont"),
+                           TestSuite::Compare::File);
+
     /* Verify font image, no need to test image contents, as the image is garbage anyway */
     Trade::TgaImporter importer;
     CORRADE_VERIFY(importer.openFile(Utility::Directory::join(MAGNUMFONTCONVERTER_TEST_WRITE_DIR, "font.tga")));
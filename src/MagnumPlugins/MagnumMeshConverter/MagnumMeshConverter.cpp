@@ -0,0 +1,93 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MagnumMeshConverter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Debug.h>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/Trade/MeshData.h"
+#include "MagnumPlugins/MagnumMeshImporter/MagnumMeshHeader.h"
+
+namespace Magnum { namespace Trade {
+
+namespace {
+    std::size_t alignOffset(const std::size_t offset) {
+        return (offset + MagnumMeshDataAlignment - 1)/MagnumMeshDataAlignment*MagnumMeshDataAlignment;
+    }
+}
+
+MagnumMeshConverter::MagnumMeshConverter() = default;
+
+MagnumMeshConverter::MagnumMeshConverter(PluginManager::AbstractManager& manager, std::string plugin): AbstractMeshConverter{manager, std::move(plugin)} {}
+
+auto MagnumMeshConverter::doFeatures() const -> Features { return Feature::ConvertData; }
+
+Containers::Array<char> MagnumMeshConverter::doExportToData(const MeshData& mesh) {
+    if(mesh.attributeCount() > 255) {
+        Error() << "Trade::MagnumMeshConverter::exportToData(): too many attributes, expected at most 255 but got" << mesh.attributeCount();
+        return nullptr;
+    }
+
+    const std::size_t indexDataOffset = alignOffset(sizeof(MagnumMeshHeader) + mesh.attributeCount()*sizeof(MagnumMeshAttribute));
+    const std::size_t vertexDataOffset = alignOffset(indexDataOffset + mesh.indexData().size());
+
+    /* Zero-initialized so the alignment padding is deterministic */
+    Containers::Array<char> data{Containers::ValueInit, vertexDataOffset + mesh.vertexData().size()};
+
+    MagnumMeshHeader& header = *reinterpret_cast<MagnumMeshHeader*>(data.data());
+    std::memcpy(header.signature, "MGMS", 4);
+    header.version = MagnumMeshVersion;
+    header.flags = (mesh.isIndexed() ? MagnumMeshFlag::Indexed : 0)|
+                   (Utility::Endianness::isBigEndian() ? MagnumMeshFlag::BigEndian : 0);
+    header.indexType = mesh.isIndexed() ? UnsignedByte(mesh.indexType()) : 0;
+    header.attributeCount = mesh.attributeCount();
+    header.primitive = UnsignedInt(mesh.primitive());
+    header.vertexCount = mesh.vertexCount();
+    header.indexDataOffset = indexDataOffset;
+    header.indexDataSize = mesh.indexData().size();
+    header.vertexDataOffset = vertexDataOffset;
+    header.vertexDataSize = mesh.vertexData().size();
+
+    MagnumMeshAttribute* const attributes = reinterpret_cast<MagnumMeshAttribute*>(data + sizeof(MagnumMeshHeader));
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        const MeshAttributeData& attribute = mesh.attribute(i);
+        attributes[i].name = UnsignedByte(attribute.name());
+        attributes[i].type = UnsignedByte(attribute.type());
+        attributes[i].components = attribute.components();
+        attributes[i].normalized = attribute.isNormalized();
+        attributes[i].stride = attribute.stride();
+        attributes[i].offset = attribute.offset();
+    }
+
+    std::copy(mesh.indexData().begin(), mesh.indexData().end(), data + indexDataOffset);
+    std::copy(mesh.vertexData().begin(), mesh.vertexData().end(), data + vertexDataOffset);
+    return data;
+}
+
+}}
@@ -0,0 +1,160 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Trade/MeshData.h"
+#include "MagnumPlugins/MagnumMeshConverter/MagnumMeshConverter.h"
+#include "MagnumPlugins/MagnumMeshImporter/MagnumMeshHeader.h"
+#include "MagnumPlugins/MagnumMeshImporter/MagnumMeshImporter.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class MagnumMeshConverterTest: public TestSuite::Tester {
+    public:
+        explicit MagnumMeshConverterTest();
+
+        void tooManyAttributes();
+
+        void indexed();
+        void nonIndexed();
+};
+
+namespace {
+    constexpr UnsignedShort Indices[] = { 0, 2, 1 };
+
+    /* Position and two normalized byte texture coordinates, padded to 16
+       bytes */
+    constexpr Float Vertices[] = {
+        1.0f, 2.0f, 3.0f, 0.0f,
+        4.0f, 5.0f, 6.0f, 0.0f,
+        7.0f, 8.0f, 9.0f, 0.0f
+    };
+
+    std::vector<MeshAttributeData> attributes() {
+        return {
+            MeshAttributeData{MeshAttribute::Position, MeshAttributeType::Float, 3, 0, 16},
+            MeshAttributeData{MeshAttribute::TextureCoordinates, MeshAttributeType::UnsignedByte, 2, 12, 16, true}
+        };
+    }
+}
+
+MagnumMeshConverterTest::MagnumMeshConverterTest() {
+    addTests({&MagnumMeshConverterTest::tooManyAttributes,
+
+              &MagnumMeshConverterTest::indexed,
+              &MagnumMeshConverterTest::nonIndexed});
+}
+
+void MagnumMeshConverterTest::tooManyAttributes() {
+    std::vector<MeshAttributeData> attributes(256, MeshAttributeData{MeshAttribute::Color, MeshAttributeType::UnsignedByte, 4, 0, 4, true});
+    const char vertices[4]{};
+    const MeshData mesh{MeshPrimitive::Points, Containers::ArrayView<const char>{vertices}, std::move(attributes), 1};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    CORRADE_VERIFY(!MagnumMeshConverter{}.exportToData(mesh));
+    CORRADE_COMPARE(out.str(), "Trade::MagnumMeshConverter::exportToData(): too many attributes, expected at most 255 but got 256\n");
+}
+
+void MagnumMeshConverterTest::indexed() {
+    const MeshData mesh{MeshPrimitive::Triangles, MeshIndexType::UnsignedShort,
+        Containers::ArrayView<const char>{reinterpret_cast<const char*>(Indices), sizeof(Indices)},
+        Containers::ArrayView<const char>{reinterpret_cast<const char*>(Vertices), sizeof(Vertices)},
+        attributes(), 3};
+
+    const Containers::Array<char> data = MagnumMeshConverter{}.exportToData(mesh);
+    CORRADE_VERIFY(data);
+
+    /* Header, two attributes, six bytes of indices padded to 16 bytes and
+       the vertex data */
+    CORRADE_COMPARE(data.size(), 48 + 2*16 + 16 + 48);
+    const MagnumMeshHeader& header = *reinterpret_cast<const MagnumMeshHeader*>(data.data());
+    CORRADE_COMPARE(std::string(header.signature, 4), "MGMS");
+    CORRADE_COMPARE(header.version, MagnumMeshVersion);
+    CORRADE_VERIFY(header.flags & MagnumMeshFlag::Indexed);
+    CORRADE_COMPARE(header.attributeCount, 2);
+    CORRADE_COMPARE(header.indexDataOffset, 80);
+    CORRADE_COMPARE(header.indexDataSize, 6);
+    CORRADE_COMPARE(header.vertexDataOffset, 96);
+    CORRADE_COMPARE(header.vertexDataSize, 48);
+
+    /* Import it back */
+    MagnumMeshImporter importer;
+    CORRADE_VERIFY(importer.openData(data));
+    std::optional<MeshData> imported = importer.mesh(0);
+    CORRADE_VERIFY(imported);
+    CORRADE_COMPARE(imported->primitive(), MeshPrimitive::Triangles);
+    CORRADE_VERIFY(imported->isIndexed());
+    CORRADE_COMPARE(imported->indexType(), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE(imported->vertexCount(), 3);
+    CORRADE_COMPARE_AS(imported->indexData(),
+        (Containers::ArrayView<const char>{reinterpret_cast<const char*>(Indices), sizeof(Indices)}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(imported->vertexData(),
+        (Containers::ArrayView<const char>{reinterpret_cast<const char*>(Vertices), sizeof(Vertices)}),
+        TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(imported->attributeCount(), 2);
+    CORRADE_COMPARE(imported->attribute(1).name(), MeshAttribute::TextureCoordinates);
+    CORRADE_COMPARE(imported->attribute(1).type(), MeshAttributeType::UnsignedByte);
+    CORRADE_COMPARE(imported->attribute(1).components(), 2);
+    CORRADE_COMPARE(imported->attribute(1).offset(), 12);
+    CORRADE_COMPARE(imported->attribute(1).stride(), 16);
+    CORRADE_VERIFY(imported->attribute(1).isNormalized());
+}
+
+void MagnumMeshConverterTest::nonIndexed() {
+    const MeshData mesh{MeshPrimitive::Points,
+        Containers::ArrayView<const char>{reinterpret_cast<const char*>(Vertices), sizeof(Vertices)},
+        attributes(), 3};
+
+    const Containers::Array<char> data = MagnumMeshConverter{}.exportToData(mesh);
+    CORRADE_VERIFY(data);
+
+    const MagnumMeshHeader& header = *reinterpret_cast<const MagnumMeshHeader*>(data.data());
+    CORRADE_VERIFY(!(header.flags & MagnumMeshFlag::Indexed));
+    CORRADE_COMPARE(header.indexDataSize, 0);
+    CORRADE_COMPARE(header.vertexDataOffset, 80);
+
+    MagnumMeshImporter importer;
+    CORRADE_VERIFY(importer.openData(data));
+    std::optional<MeshData> imported = importer.mesh(0);
+    CORRADE_VERIFY(imported);
+    CORRADE_COMPARE(imported->primitive(), MeshPrimitive::Points);
+    CORRADE_VERIFY(!imported->isIndexed());
+    CORRADE_COMPARE_AS(imported->vertexData(),
+        (Containers::ArrayView<const char>{reinterpret_cast<const char*>(Vertices), sizeof(Vertices)}),
+        TestSuite::Compare::Container);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MagnumMeshConverterTest)
@@ -0,0 +1,89 @@
+#ifndef Magnum_Trade_MagnumMeshHeader_h
+#define Magnum_Trade_MagnumMeshHeader_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::Trade::MagnumMeshHeader, @ref Magnum::Trade::MagnumMeshAttribute
+ */
+
+#include <cstddef>
+
+#include "Magnum/Types.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Magnum mesh file header
+
+The file starts with this header, followed by @ref attributeCount
+@ref MagnumMeshAttribute entries. Index and vertex data are stored at
+@ref indexDataOffset and @ref vertexDataOffset, both aligned to
+@ref MagnumMeshDataAlignment bytes, so they can be uploaded to GPU buffers
+directly from a memory-mapped file. All values are in the endianness of the
+machine that wrote the file, see @ref MagnumMeshFlag::BigEndian.
+*/
+struct MagnumMeshHeader {
+    char            signature[4];       /**< @brief File signature, `MGMS` */
+    UnsignedByte    version;            /**< @brief Format version */
+    UnsignedByte    flags;              /**< @brief @ref MagnumMeshFlag values */
+    UnsignedByte    indexType;          /**< @brief @ref MeshIndexType */
+    UnsignedByte    attributeCount;     /**< @brief Attribute count */
+    UnsignedInt     primitive;          /**< @brief @ref MeshPrimitive */
+    UnsignedInt     vertexCount;        /**< @brief Vertex count */
+    UnsignedLong    indexDataOffset;    /**< @brief Index data offset */
+    UnsignedLong    indexDataSize;      /**< @brief Index data size */
+    UnsignedLong    vertexDataOffset;   /**< @brief Vertex data offset */
+    UnsignedLong    vertexDataSize;     /**< @brief Vertex data size */
+};
+
+/** @brief Magnum mesh attribute entry */
+struct MagnumMeshAttribute {
+    UnsignedByte    name;               /**< @brief @ref MeshAttribute */
+    UnsignedByte    type;               /**< @brief @ref MeshAttributeType */
+    UnsignedByte    components;         /**< @brief Component count */
+    UnsignedByte    normalized;         /**< @brief Whether the attribute is normalized */
+    UnsignedInt     stride;             /**< @brief Attribute stride */
+    UnsignedLong    offset;             /**< @brief Offset relative to vertex data */
+};
+
+/** @brief Magnum mesh header flags */
+namespace MagnumMeshFlag { enum: UnsignedByte {
+    Indexed = 1 << 0,   /**< The mesh is indexed */
+    BigEndian = 1 << 1  /**< The file is in big-endian */
+}; }
+
+/** @brief Current Magnum mesh format version */
+constexpr UnsignedByte MagnumMeshVersion = 1;
+
+/** @brief Alignment of Magnum mesh index and vertex data */
+constexpr std::size_t MagnumMeshDataAlignment = 16;
+
+static_assert(sizeof(MagnumMeshHeader) == 48, "MagnumMeshHeader size is not 48 bytes");
+static_assert(sizeof(MagnumMeshAttribute) == 16, "MagnumMeshAttribute size is not 16 bytes");
+
+}}
+
+#endif
@@ -0,0 +1,267 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MagnumMeshImporter.h"
+
+#include <cstring>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/MapFile.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "MagnumPlugins/MagnumMeshImporter/MagnumMeshHeader.h"
+
+namespace Magnum { namespace Trade {
+
+namespace {
+
+std::vector<MeshAttributeData> attributes(const char* const data) {
+    const MagnumMeshHeader& header = *reinterpret_cast<const MagnumMeshHeader*>(data);
+    const MagnumMeshAttribute* const attributes = reinterpret_cast<const MagnumMeshAttribute*>(data + sizeof(MagnumMeshHeader));
+
+    std::vector<MeshAttributeData> out;
+    out.reserve(header.attributeCount);
+    for(std::size_t i = 0; i != header.attributeCount; ++i)
+        out.emplace_back(MeshAttribute(attributes[i].name), MeshAttributeType(attributes[i].type), attributes[i].components, attributes[i].offset, attributes[i].stride, attributes[i].normalized);
+    return out;
+}
+
+template<class T> std::vector<T> extractAttribute(const Containers::ArrayView<const char> data, const MeshAttributeData& attribute, const UnsignedInt vertexCount) {
+    std::vector<T> out(vertexCount);
+    for(std::size_t i = 0; i != vertexCount; ++i)
+        std::memcpy(&out[i], data + attribute.offset() + i*attribute.stride(), attribute.size());
+    return out;
+}
+
+bool isMeshPrimitive(const UnsignedInt primitive) {
+    switch(MeshPrimitive(primitive)) {
+        case MeshPrimitive::Points:
+        case MeshPrimitive::LineStrip:
+        case MeshPrimitive::LineLoop:
+        case MeshPrimitive::Lines:
+        #ifndef MAGNUM_TARGET_GLES
+        case MeshPrimitive::LineStripAdjacency:
+        case MeshPrimitive::LinesAdjacency:
+        #endif
+        case MeshPrimitive::TriangleStrip:
+        case MeshPrimitive::TriangleFan:
+        case MeshPrimitive::Triangles:
+        #ifndef MAGNUM_TARGET_GLES
+        case MeshPrimitive::TriangleStripAdjacency:
+        case MeshPrimitive::TrianglesAdjacency:
+        case MeshPrimitive::Patches:
+        #endif
+            return true;
+    }
+
+    return false;
+}
+
+/* Written so that none of the file-controlled values can overflow */
+bool isInRange(const UnsignedLong offset, const UnsignedLong size, const UnsignedLong totalSize) {
+    return offset <= totalSize && size <= totalSize - offset;
+}
+
+template<class T> std::vector<UnsignedInt> extractIndices(const Containers::ArrayView<const char> data) {
+    const T* const indices = reinterpret_cast<const T*>(data.data());
+    return std::vector<UnsignedInt>(indices, indices + data.size()/sizeof(T));
+}
+
+}
+
+MagnumMeshImporter::MagnumMeshImporter() = default;
+
+MagnumMeshImporter::MagnumMeshImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImporter{manager, std::move(plugin)} {}
+
+MagnumMeshImporter::~MagnumMeshImporter() = default;
+
+auto MagnumMeshImporter::doFeatures() const -> Features { return Feature::OpenData; }
+
+bool MagnumMeshImporter::doIsOpened() const { return _in; }
+
+void MagnumMeshImporter::doClose() { _in = nullptr; }
+
+void MagnumMeshImporter::doOpenData(const Containers::ArrayView<const char> data) {
+    Containers::Array<char> copy{data.size()};
+    std::copy(data.begin(), data.end(), copy.begin());
+    openInternal(std::move(copy));
+}
+
+void MagnumMeshImporter::doOpenFile(const std::string& filename) {
+    /* Map the file so the data can be referenced directly without ever being
+       read */
+    std::optional<Containers::Array<char>> data = mapFile(filename);
+    if(!data) return;
+
+    openInternal(std::move(*data));
+}
+
+void MagnumMeshImporter::openInternal(Containers::Array<char>&& data) {
+    /* Check if the file is long enough */
+    if(data.size() < sizeof(MagnumMeshHeader)) {
+        Error() << "Trade::MagnumMeshImporter::openData(): the file is too short:" << data.size() << "bytes";
+        return;
+    }
+
+    const MagnumMeshHeader& header = *reinterpret_cast<const MagnumMeshHeader*>(data.data());
+    if(std::strncmp(header.signature, "MGMS", 4) != 0) {
+        Error() << "Trade::MagnumMeshImporter::openData(): invalid file signature";
+        return;
+    }
+
+    /* Compatibility checks */
+    if(header.version != MagnumMeshVersion) {
+        Error() << "Trade::MagnumMeshImporter::openData(): unsupported version" << UnsignedInt(header.version) << Debug::nospace << ", expected" << UnsignedInt(MagnumMeshVersion);
+        return;
+    }
+    if(!(header.flags & MagnumMeshFlag::BigEndian) != !Utility::Endianness::isBigEndian()) {
+        Error() << "Trade::MagnumMeshImporter::openData(): the file has different endianness than this machine";
+        return;
+    }
+
+    /* Check that everything fits into the file */
+    if(data.size() < sizeof(MagnumMeshHeader) + header.attributeCount*sizeof(MagnumMeshAttribute) ||
+       !isInRange(header.indexDataOffset, header.indexDataSize, data.size()) ||
+       !isInRange(header.vertexDataOffset, header.vertexDataSize, data.size())) {
+        Error() << "Trade::MagnumMeshImporter::openData(): the file is too short:" << data.size() << "bytes";
+        return;
+    }
+
+    if(!isMeshPrimitive(header.primitive)) {
+        Error() << "Trade::MagnumMeshImporter::openData(): invalid primitive" << header.primitive;
+        return;
+    }
+    if(!header.vertexCount) {
+        Error() << "Trade::MagnumMeshImporter::openData(): the mesh has no vertices";
+        return;
+    }
+
+    /* Check attribute bounds and types so mesh() doesn't need to */
+    if(header.flags & MagnumMeshFlag::Indexed && (header.indexType > UnsignedByte(MeshIndexType::UnsignedInt) || header.indexDataSize % meshIndexTypeSize(MeshIndexType(header.indexType)))) {
+        Error() << "Trade::MagnumMeshImporter::openData(): invalid index data";
+        return;
+    }
+    const MagnumMeshAttribute* const attributes = reinterpret_cast<const MagnumMeshAttribute*>(data.data() + sizeof(MagnumMeshHeader));
+    for(std::size_t i = 0; i != header.attributeCount; ++i) {
+        const MagnumMeshAttribute& attribute = attributes[i];
+        if(attribute.name > UnsignedByte(MeshAttribute::Weights) ||
+           attribute.type > UnsignedByte(MeshAttributeType::Float) ||
+           attribute.components < 1 || attribute.components > 4) {
+            Error() << "Trade::MagnumMeshImporter::openData(): invalid attribute" << i;
+            return;
+        }
+
+        /* The last vertex has to fit in, the stride is checked by division
+           so the multiplication can't overflow */
+        const UnsignedLong size = attribute.components*meshAttributeTypeSize(MeshAttributeType(attribute.type));
+        if(!isInRange(attribute.offset, size, header.vertexDataSize) ||
+           (attribute.stride && header.vertexCount - 1 > (header.vertexDataSize - attribute.offset - size)/attribute.stride)) {
+            Error() << "Trade::MagnumMeshImporter::openData(): invalid attribute" << i;
+            return;
+        }
+    }
+
+    _in = std::move(data);
+}
+
+UnsignedInt MagnumMeshImporter::doMesh3DCount() const { return 1; }
+
+std::optional<MeshData> MagnumMeshImporter::doMesh(UnsignedInt) {
+    const MagnumMeshHeader& header = *reinterpret_cast<const MagnumMeshHeader*>(_in.data());
+    const Containers::ArrayView<const char> vertexData{_in + header.vertexDataOffset, std::size_t(header.vertexDataSize)};
+
+    /* Reference the data directly */
+    if(!(header.flags & MagnumMeshFlag::Indexed))
+        return MeshData{MeshPrimitive(header.primitive), vertexData, attributes(_in), header.vertexCount};
+
+    const Containers::ArrayView<const char> indexData{_in + header.indexDataOffset, std::size_t(header.indexDataSize)};
+    return MeshData{MeshPrimitive(header.primitive), MeshIndexType(header.indexType), indexData, vertexData, attributes(_in), header.vertexCount};
+}
+
+std::optional<MeshData3D> MagnumMeshImporter::doMesh3D(UnsignedInt id) {
+    std::optional<MeshData> mesh = doMesh(id);
+
+    std::vector<std::vector<Vector3>> positions;
+    std::vector<std::vector<Vector3>> normals;
+    std::vector<std::vector<Vector2>> textureCoordinates;
+    std::vector<Vector4ui> jointIds;
+    std::vector<Vector4> weights;
+    for(UnsignedInt i = 0; i != mesh->attributeCount(); ++i) {
+        const MeshAttributeData& attribute = mesh->attribute(i);
+        if(attribute.type() != (attribute.name() == MeshAttribute::JointIds ? MeshAttributeType::UnsignedInt : MeshAttributeType::Float)) {
+            Error() << "Trade::MagnumMeshImporter::mesh3D(): unsupported" << attribute.name() << "type" << attribute.type();
+            return std::nullopt;
+        }
+
+        /* Two-component positions get zero Z, three-component texture
+           coordinates and four-component colors are not representable */
+        if(attribute.name() == MeshAttribute::Position && (attribute.components() == 2 || attribute.components() == 3))
+            positions.push_back(extractAttribute<Vector3>(mesh->vertexData(), attribute, mesh->vertexCount()));
+        else if(attribute.name() == MeshAttribute::Normal && attribute.components() == 3)
+            normals.push_back(extractAttribute<Vector3>(mesh->vertexData(), attribute, mesh->vertexCount()));
+        else if(attribute.name() == MeshAttribute::TextureCoordinates && attribute.components() == 2)
+            textureCoordinates.push_back(extractAttribute<Vector2>(mesh->vertexData(), attribute, mesh->vertexCount()));
+        /* Only the first skin influence set is used, unused trailing
+           components get zero joint ID and weight */
+        else if(attribute.name() == MeshAttribute::JointIds) {
+            if(jointIds.empty()) jointIds = extractAttribute<Vector4ui>(mesh->vertexData(), attribute, mesh->vertexCount());
+        } else if(attribute.name() == MeshAttribute::Weights) {
+            if(weights.empty()) weights = extractAttribute<Vector4>(mesh->vertexData(), attribute, mesh->vertexCount());
+        } else if(attribute.name() != MeshAttribute::Color) {
+            Error() << "Trade::MagnumMeshImporter::mesh3D(): unsupported" << attribute.name() << "component count" << attribute.components();
+            return std::nullopt;
+        }
+    }
+
+    if(positions.empty()) {
+        Error() << "Trade::MagnumMeshImporter::mesh3D(): the mesh has no positions";
+        return std::nullopt;
+    }
+
+    if(jointIds.size() != weights.size()) {
+        Error() << "Trade::MagnumMeshImporter::mesh3D(): joint IDs and weights have to be specified together";
+        return std::nullopt;
+    }
+
+    std::vector<UnsignedInt> indices;
+    if(mesh->isIndexed()) switch(mesh->indexType()) {
+        case MeshIndexType::UnsignedByte:
+            indices = extractIndices<UnsignedByte>(mesh->indexData());
+            break;
+        case MeshIndexType::UnsignedShort:
+            indices = extractIndices<UnsignedShort>(mesh->indexData());
+            break;
+        case MeshIndexType::UnsignedInt:
+            indices = extractIndices<UnsignedInt>(mesh->indexData());
+            break;
+    }
+
+    return MeshData3D{mesh->primitive(), std::move(indices), std::move(positions), std::move(normals), std::move(textureCoordinates), std::move(jointIds), std::move(weights)};
+}
+
+}}
@@ -0,0 +1,109 @@
+#ifndef Magnum_Trade_MagnumMeshImporter_h
+#define Magnum_Trade_MagnumMeshImporter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::MagnumMeshImporter
+ */
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/VisibilityMacros.h>
+
+#include "Magnum/Trade/AbstractImporter.h"
+
+#include "MagnumPlugins/MagnumMeshImporter/configure.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_MAGNUMMESHIMPORTER_BUILD_STATIC
+    #if defined(MagnumMeshImporter_EXPORTS) || defined(MagnumMeshImporterObjects_EXPORTS)
+        #define MAGNUM_MAGNUMMESHIMPORTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_MAGNUMMESHIMPORTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_MAGNUMMESHIMPORTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_MAGNUMMESHIMPORTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Magnum mesh importer plugin
+
+Imports binary meshes (`*.mgmesh`) produced by @ref MagnumMeshConverter. The
+file consists of a @ref MagnumMeshHeader, attribute layout and index and
+vertex data aligned for direct upload. The file contains exactly one mesh.
+
+This plugin is built if `WITH_MAGNUMMESHIMPORTER` is enabled when building
+Magnum. To use dynamic plugin, you need to load `MagnumMeshImporter` plugin
+from `MAGNUM_PLUGINS_IMPORTER_DIR`. To use static plugin or use this as a
+dependency of another plugin, you need to request `MagnumMeshImporter`
+component of `Magnum` package in CMake and link to
+`Magnum::MagnumMeshImporter` target. See @ref building, @ref cmake and
+@ref plugins for more information.
+
+The file is memory-mapped in @ref openFile() using @ref mapFile() instead of
+being read, header and layout is validated on opening and @ref mesh() then
+returns @ref MeshData that reference the mapped memory directly without any
+parsing or copying. The returned data are thus valid only until the file is closed.
+@ref openData() copies the data. Files with different format version or
+written on a machine with different endianness are rejected.
+
+@ref mesh3D() is supported for meshes with floating-point positions, normals
+and texture coordinates, optionally with unsigned integer joint IDs and
+floating-point joint weights, and converts the data to the separate-array
+representation.
+*/
+class MAGNUM_MAGNUMMESHIMPORTER_EXPORT MagnumMeshImporter: public AbstractImporter {
+    public:
+        /** @brief Default constructor */
+        explicit MagnumMeshImporter();
+
+        /** @brief Plugin manager constructor */
+        explicit MagnumMeshImporter(PluginManager::AbstractManager& manager, std::string plugin);
+
+        ~MagnumMeshImporter();
+
+    private:
+        MAGNUM_MAGNUMMESHIMPORTER_LOCAL Features doFeatures() const override;
+        MAGNUM_MAGNUMMESHIMPORTER_LOCAL bool doIsOpened() const override;
+        MAGNUM_MAGNUMMESHIMPORTER_LOCAL void doOpenData(Containers::ArrayView<const char> data) override;
+        MAGNUM_MAGNUMMESHIMPORTER_LOCAL void doOpenFile(const std::string& filename) override;
+        MAGNUM_MAGNUMMESHIMPORTER_LOCAL void doClose() override;
+
+        MAGNUM_MAGNUMMESHIMPORTER_LOCAL UnsignedInt doMesh3DCount() const override;
+        MAGNUM_MAGNUMMESHIMPORTER_LOCAL std::optional<MeshData3D> doMesh3D(UnsignedInt id) override;
+        MAGNUM_MAGNUMMESHIMPORTER_LOCAL std::optional<MeshData> doMesh(UnsignedInt id) override;
+
+        MAGNUM_MAGNUMMESHIMPORTER_LOCAL void openInternal(Containers::Array<char>&& data);
+
+        Containers::Array<char> _in;
+};
+
+}}
+
+#endif
@@ -0,0 +1,377 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "MagnumPlugins/MagnumMeshImporter/MagnumMeshHeader.h"
+#include "MagnumPlugins/MagnumMeshImporter/MagnumMeshImporter.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class MagnumMeshImporterTest: public TestSuite::Tester {
+    public:
+        explicit MagnumMeshImporterTest();
+
+        void openNonexistent();
+        void openShort();
+        void invalidSignature();
+        void unsupportedVersion();
+        void differentEndianness();
+        void attributeOutOfBounds();
+        void attributeStrideOutOfBounds();
+        void dataOffsetOverflow();
+        void attributeOffsetOverflow();
+        void zeroVertexCount();
+        void invalidPrimitive();
+
+        void mesh();
+        void meshOpenData();
+        void mesh3D();
+        void mesh3DUnsupportedType();
+
+        void useTwice();
+};
+
+MagnumMeshImporterTest::MagnumMeshImporterTest() {
+    addTests({&MagnumMeshImporterTest::openNonexistent,
+              &MagnumMeshImporterTest::openShort,
+              &MagnumMeshImporterTest::invalidSignature,
+              &MagnumMeshImporterTest::unsupportedVersion,
+              &MagnumMeshImporterTest::differentEndianness,
+              &MagnumMeshImporterTest::attributeOutOfBounds,
+              &MagnumMeshImporterTest::attributeStrideOutOfBounds,
+              &MagnumMeshImporterTest::dataOffsetOverflow,
+              &MagnumMeshImporterTest::attributeOffsetOverflow,
+              &MagnumMeshImporterTest::zeroVertexCount,
+              &MagnumMeshImporterTest::invalidPrimitive,
+
+              &MagnumMeshImporterTest::mesh,
+              &MagnumMeshImporterTest::meshOpenData,
+              &MagnumMeshImporterTest::mesh3D,
+              &MagnumMeshImporterTest::mesh3DUnsupportedType,
+
+              &MagnumMeshImporterTest::useTwice});
+}
+
+namespace {
+    /* The test file is little-endian */
+    Containers::Array<char> testFile() {
+        return Utility::Directory::read(Utility::Directory::join(MAGNUMMESHIMPORTER_TEST_DIR, "mesh.mgmesh"));
+    }
+}
+
+void MagnumMeshImporterTest::openNonexistent() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MagnumMeshImporter importer;
+    CORRADE_VERIFY(!importer.openFile("nonexistent.mgmesh"));
+    CORRADE_COMPARE(out.str(), "Trade::mapFile(): cannot open file nonexistent.mgmesh\n");
+}
+
+void MagnumMeshImporterTest::openShort() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MagnumMeshImporter importer;
+    const char data[] = { 'M', 'G', 'M', 'S', 1, 0, 0, 0 };
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::MagnumMeshImporter::openData(): the file is too short: 8 bytes\n");
+}
+
+void MagnumMeshImporterTest::invalidSignature() {
+    Containers::Array<char> data = testFile();
+    CORRADE_VERIFY(data);
+    data[3] = 'X';
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MagnumMeshImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::MagnumMeshImporter::openData(): invalid file signature\n");
+}
+
+void MagnumMeshImporterTest::unsupportedVersion() {
+    Containers::Array<char> data = testFile();
+    CORRADE_VERIFY(data);
+    reinterpret_cast<MagnumMeshHeader*>(data.data())->version = 133;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MagnumMeshImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::MagnumMeshImporter::openData(): unsupported version 133, expected 1\n");
+}
+
+void MagnumMeshImporterTest::differentEndianness() {
+    Containers::Array<char> data = testFile();
+    CORRADE_VERIFY(data);
+    /* Flip the flag so it doesn't match this machine regardless of what it
+       is */
+    reinterpret_cast<MagnumMeshHeader*>(data.data())->flags ^= MagnumMeshFlag::BigEndian;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MagnumMeshImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::MagnumMeshImporter::openData(): the file has different endianness than this machine\n");
+}
+
+void MagnumMeshImporterTest::attributeOutOfBounds() {
+    if(Utility::Endianness::isBigEndian())
+        CORRADE_SKIP("The test file is little-endian.");
+
+    Containers::Array<char> data = testFile();
+    CORRADE_VERIFY(data);
+    reinterpret_cast<MagnumMeshAttribute*>(data + sizeof(MagnumMeshHeader))[1].offset = 48;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MagnumMeshImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::MagnumMeshImporter::openData(): invalid attribute 1\n");
+}
+
+void MagnumMeshImporterTest::attributeStrideOutOfBounds() {
+    if(Utility::Endianness::isBigEndian())
+        CORRADE_SKIP("The test file is little-endian.");
+
+    Containers::Array<char> data = testFile();
+    CORRADE_VERIFY(data);
+    /* The first vertex fits, the last one is far past the vertex data */
+    reinterpret_cast<MagnumMeshAttribute*>(data + sizeof(MagnumMeshHeader))[0].stride = 0x80000000u;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MagnumMeshImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::MagnumMeshImporter::openData(): invalid attribute 0\n");
+}
+
+void MagnumMeshImporterTest::dataOffsetOverflow() {
+    if(Utility::Endianness::isBigEndian())
+        CORRADE_SKIP("The test file is little-endian.");
+
+    Containers::Array<char> data = testFile();
+    CORRADE_VERIFY(data);
+    /* Offset + size wraps around to a value inside the file */
+    MagnumMeshHeader& header = *reinterpret_cast<MagnumMeshHeader*>(data.data());
+    header.vertexDataOffset = ~UnsignedLong{} - header.vertexDataSize + 2;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MagnumMeshImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::MagnumMeshImporter::openData(): the file is too short: " + std::to_string(data.size()) + " bytes\n");
+}
+
+void MagnumMeshImporterTest::attributeOffsetOverflow() {
+    if(Utility::Endianness::isBigEndian())
+        CORRADE_SKIP("The test file is little-endian.");
+
+    Containers::Array<char> data = testFile();
+    CORRADE_VERIFY(data);
+    /* Offset + attribute size wraps around to zero */
+    reinterpret_cast<MagnumMeshAttribute*>(data + sizeof(MagnumMeshHeader))[1].offset = ~UnsignedLong{} - 7;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MagnumMeshImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::MagnumMeshImporter::openData(): invalid attribute 1\n");
+}
+
+void MagnumMeshImporterTest::zeroVertexCount() {
+    if(Utility::Endianness::isBigEndian())
+        CORRADE_SKIP("The test file is little-endian.");
+
+    Containers::Array<char> data = testFile();
+    CORRADE_VERIFY(data);
+    reinterpret_cast<MagnumMeshHeader*>(data.data())->vertexCount = 0;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MagnumMeshImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::MagnumMeshImporter::openData(): the mesh has no vertices\n");
+}
+
+void MagnumMeshImporterTest::invalidPrimitive() {
+    if(Utility::Endianness::isBigEndian())
+        CORRADE_SKIP("The test file is little-endian.");
+
+    Containers::Array<char> data = testFile();
+    CORRADE_VERIFY(data);
+    reinterpret_cast<MagnumMeshHeader*>(data.data())->primitive = 0xdead;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MagnumMeshImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::MagnumMeshImporter::openData(): invalid primitive 57005\n");
+}
+
+void MagnumMeshImporterTest::mesh() {
+    if(Utility::Endianness::isBigEndian())
+        CORRADE_SKIP("The test file is little-endian.");
+
+    MagnumMeshImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(MAGNUMMESHIMPORTER_TEST_DIR, "mesh.mgmesh")));
+    CORRADE_COMPARE(importer.mesh3DCount(), 1);
+
+    std::optional<MeshData> mesh = importer.mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Triangles);
+    CORRADE_VERIFY(mesh->isIndexed());
+    CORRADE_COMPARE(mesh->indexType(), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE(mesh->indexCount(), 3);
+    CORRADE_COMPARE(mesh->vertexCount(), 3);
+    CORRADE_COMPARE(mesh->vertexData().size(), 60);
+
+    /* Index and vertex data are aligned in the file */
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(mesh->indexData().data()) % MagnumMeshDataAlignment, 0);
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(mesh->vertexData().data()) % MagnumMeshDataAlignment, 0);
+
+    CORRADE_COMPARE_AS((Containers::ArrayView<const UnsignedShort>{reinterpret_cast<const UnsignedShort*>(mesh->indexData().data()), 3}),
+        (Containers::Array<UnsignedShort>::from(0, 2, 1)),
+        TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(mesh->attributeCount(), 2);
+    CORRADE_COMPARE(mesh->attribute(0).name(), MeshAttribute::Position);
+    CORRADE_COMPARE(mesh->attribute(0).type(), MeshAttributeType::Float);
+    CORRADE_COMPARE(mesh->attribute(0).components(), 3);
+    CORRADE_COMPARE(mesh->attribute(0).offset(), 0);
+    CORRADE_COMPARE(mesh->attribute(0).stride(), 20);
+    CORRADE_COMPARE(mesh->attribute(1).name(), MeshAttribute::TextureCoordinates);
+    CORRADE_COMPARE(mesh->attribute(1).components(), 2);
+    CORRADE_COMPARE(mesh->attribute(1).offset(), 12);
+    CORRADE_COMPARE(mesh->attribute(1).stride(), 20);
+
+    /* The data are referenced by the returned mesh, not owned */
+    const char* vertexData = mesh->vertexData().data();
+    Containers::Array<char> released = mesh->releaseVertexData();
+    CORRADE_COMPARE(static_cast<const char*>(released.data()), vertexData);
+    CORRADE_VERIFY(released.deleter());
+}
+
+void MagnumMeshImporterTest::meshOpenData() {
+    if(Utility::Endianness::isBigEndian())
+        CORRADE_SKIP("The test file is little-endian.");
+
+    Containers::Array<char> data = testFile();
+    CORRADE_VERIFY(data);
+
+    MagnumMeshImporter importer;
+    CORRADE_VERIFY(importer.openData(data));
+
+    /* The importer has its own copy */
+    data = nullptr;
+
+    std::optional<MeshData> mesh = importer.mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->indexCount(), 3);
+    CORRADE_COMPARE(mesh->indexRange(), (std::pair<UnsignedInt, UnsignedInt>{0, 2}));
+    CORRADE_COMPARE(mesh->attributeCount(MeshAttribute::TextureCoordinates), 1);
+}
+
+void MagnumMeshImporterTest::mesh3D() {
+    if(Utility::Endianness::isBigEndian())
+        CORRADE_SKIP("The test file is little-endian.");
+
+    MagnumMeshImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(MAGNUMMESHIMPORTER_TEST_DIR, "mesh.mgmesh")));
+
+    std::optional<MeshData3D> mesh = importer.mesh3D(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(mesh->indices(), (std::vector<UnsignedInt>{0, 2, 1}));
+    CORRADE_COMPARE(mesh->positionArrayCount(), 1);
+    CORRADE_COMPARE(mesh->positions(0), (std::vector<Vector3>{
+        {1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}, {7.0f, 8.0f, 9.0f}}));
+    CORRADE_VERIFY(!mesh->hasNormals());
+    CORRADE_COMPARE(mesh->textureCoords2DArrayCount(), 1);
+    CORRADE_COMPARE(mesh->textureCoords2D(0), (std::vector<Vector2>{
+        {0.5f, 1.0f}, {0.0f, 0.25f}, {1.0f, 0.0f}}));
+}
+
+void MagnumMeshImporterTest::mesh3DUnsupportedType() {
+    if(Utility::Endianness::isBigEndian())
+        CORRADE_SKIP("The test file is little-endian.");
+
+    Containers::Array<char> data = testFile();
+    CORRADE_VERIFY(data);
+    reinterpret_cast<MagnumMeshAttribute*>(data + sizeof(MagnumMeshHeader))[1].type = UnsignedByte(MeshAttributeType::UnsignedShort);
+
+    MagnumMeshImporter importer;
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer.mesh3D(0));
+    CORRADE_COMPARE(out.str(), "Trade::MagnumMeshImporter::mesh3D(): unsupported Trade::MeshAttribute::TextureCoordinates type Trade::MeshAttributeType::UnsignedShort\n");
+}
+
+void MagnumMeshImporterTest::useTwice() {
+    if(Utility::Endianness::isBigEndian())
+        CORRADE_SKIP("The test file is little-endian.");
+
+    MagnumMeshImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(MAGNUMMESHIMPORTER_TEST_DIR, "mesh.mgmesh")));
+
+    /* Verify that the mapped data can be referenced repeatedly */
+    {
+        std::optional<MeshData> mesh = importer.mesh(0);
+        CORRADE_VERIFY(mesh);
+        CORRADE_COMPARE(mesh->vertexCount(), 3);
+    } {
+        std::optional<MeshData> mesh = importer.mesh(0);
+        CORRADE_VERIFY(mesh);
+        CORRADE_COMPARE(mesh->vertexCount(), 3);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MagnumMeshImporterTest)
@@ -25,17 +25,21 @@
 
 #include "ObjImporter.h"
 
-#include <fstream>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include <limits>
-#include <sstream>
+#include <thread>
 #include <unordered_map>
-#include <Corrade/Containers/ArrayView.h>
-#include <Corrade/Utility/String.h>
+#include <Corrade/Containers/Array.h>
 
+#include "Magnum/Implementation/parallelFor.h"
 #include "Magnum/Mesh.h"
 #include "Magnum/MeshTools/CombineIndexedArrays.h"
 #include "Magnum/MeshTools/Duplicate.h"
 #include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/MapFile.h"
 #include "Magnum/Trade/MeshData3D.h"
 
 namespace Magnum { namespace Trade {
@@ -43,211 +47,187 @@ namespace Magnum { namespace Trade {
 struct ObjImporter::File {
     std::unordered_map<std::string, UnsignedInt> meshesForName;
     std::vector<std::string> meshNames;
-    std::vector<std::tuple<std::streampos, std::streampos, UnsignedInt, UnsignedInt, UnsignedInt>> meshes;
-    std::unique_ptr<std::istream> in;
-};
-
-namespace {
-
-void ignoreLine(std::istream& in) {
-    in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-}
 
-template<std::size_t size> Math::Vector<size, Float> extractFloatData(std::string str, Float* extra = nullptr) {
-    std::vector<std::string> data = Utility::String::splitWithoutEmptyParts(str, ' ');
-    if(data.size() < size || data.size() > size + (extra ? 1 : 0)) {
-        Error() << "Trade::ObjImporter::mesh3D(): invalid float array size";
-        throw 0;
-    }
+    /* Begin and end offset of mesh data in the file, position, texture
+       coordinate and normal index offset */
+    std::vector<std::tuple<std::size_t, std::size_t, UnsignedInt, UnsignedInt, UnsignedInt>> meshes;
 
-    Math::Vector<size, Float> output;
-
-    for(std::size_t i = 0; i != size; ++i) {
-        #ifndef CORRADE_TARGET_ANDROID
-        output[i] = std::stof(data[i]);
-        #else
-        /* CRAPPY ANDROID GODDAMIT! It's also not exposed in std:: namespace,
-           unlike std::strtoul() and others. WTF! */
-        char* end{};
-        output[i] = strtof(data[i].data(), &end);
-        if(end == data[i].data() || output[i] == HUGE_VALF)
-            throw std::exception{};
-        #endif
-    }
+    /* Either memory-mapped file or copy of the data passed to openData() */
+    Containers::Array<char> data;
+};
 
-    if(data.size() == size+1) {
-        /* This should be obvious from the first if, but add this just to make
-           Clang Analyzer happy */
-        CORRADE_INTERNAL_ASSERT(extra);
+namespace {
 
-        #ifndef CORRADE_TARGET_ANDROID
-        *extra = std::stof(data.back());
-        #else
-        /* CRAPPY ANDROID GODDAMIT! It's also not exposed in std:: namespace,
-           unlike std::strtoul() and others. WTF! */
-        char* end{};
-        *extra = strtof(data.back().data(), &end);
-        if(end == data.back().data() || *extra == HUGE_VALF)
-            throw std::exception{};
-        #endif
-    }
+/* Token in the file, pointing directly to the file data */
+typedef std::pair<const char*, const char*> Token;
 
-    return output;
+inline bool isSpace(const char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
 }
 
-template<class T> void reindex(const std::vector<UnsignedInt>& indices, std::vector<T>& data) {
-    /* Check that indices are in range */
-    for(UnsignedInt i: indices) if(i >= data.size()) {
-        Error() << "Trade::ObjImporter::mesh3D(): index out of range";
-        throw 0;
-    }
-
-    data = MeshTools::duplicate(indices, data);
+inline bool isDigit(const char c) {
+    return c >= '0' && c <= '9';
 }
 
+template<std::size_t size> inline bool equals(const Token& token, const char(&literal)[size]) {
+    return std::size_t(token.second - token.first) == size - 1 && std::memcmp(token.first, literal, size - 1) == 0;
 }
 
-ObjImporter::ObjImporter() = default;
-
-ObjImporter::ObjImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImporter(manager, std::move(plugin)) {}
-
-ObjImporter::~ObjImporter() = default;
-
-auto ObjImporter::doFeatures() const -> Features { return Feature::OpenData; }
-
-void ObjImporter::doClose() { _file.reset(); }
+inline const char* lineEnd(const char* const begin, const char* const end) {
+    const char* const found = static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+    return found ? found : end;
+}
 
-bool ObjImporter::doIsOpened() const { return !!_file; }
+/* Extracts next whitespace-separated token from given range, updating the
+   begin. Returns empty token at the end. */
+inline Token nextToken(const char*& begin, const char* const end) {
+    while(begin != end && isSpace(*begin)) ++begin;
+    const char* const tokenBegin = begin;
+    while(begin != end && !isSpace(*begin)) ++begin;
+    return {tokenBegin, begin};
+}
 
-void ObjImporter::doOpenFile(const std::string& filename) {
-    std::unique_ptr<std::istream> in{new std::ifstream{filename, std::ios::binary}};
-    if(!in->good()) {
-        Error() << "Trade::ObjImporter::openFile(): cannot open file" << filename;
-        return;
+/* Splits the range into tokens, saves at most capacity of them and returns
+   total count. No allocations. */
+std::size_t tokenize(const char* begin, const char* const end, Token* const tokens, const std::size_t capacity) {
+    std::size_t count = 0;
+    for(Token token = nextToken(begin, end); token.first != token.second; token = nextToken(begin, end)) {
+        if(count < capacity) tokens[count] = token;
+        ++count;
     }
-
-    _file.reset(new File);
-    _file->in = std::move(in);
-    parseMeshNames();
+    return count;
 }
 
-void ObjImporter::doOpenData(Containers::ArrayView<const char> data) {
-    _file.reset(new File);
-    _file->in.reset(new std::istringstream{{data.begin(), data.size()}});
-
-    parseMeshNames();
+/* Falls back to strtof() for things the fast path doesn't handle, such as
+   hexadecimal floats, infinities or NaNs */
+bool parseFloatSlow(const Token& token, Float& out) {
+    char buffer[64];
+    const std::size_t size = token.second - token.first;
+    if(size >= sizeof(buffer)) return false;
+    std::memcpy(buffer, token.first, size);
+    buffer[size] = '\0';
+
+    char* end;
+    out = std::strtof(buffer, &end);
+    return end == buffer + size && out != HUGE_VALF && out != -HUGE_VALF;
 }
 
-void ObjImporter::parseMeshNames() {
-    /* First mesh starts at the beginning, its indices start from 1. The end
-       offset will be updated to proper value later. */
-    UnsignedInt positionIndexOffset = 1;
-    UnsignedInt normalIndexOffset = 1;
-    UnsignedInt textureCoordinateIndexOffset = 1;
-    _file->meshes.emplace_back(0, 0, positionIndexOffset, normalIndexOffset, textureCoordinateIndexOffset);
-
-    /* The first mesh doesn't have name by default but we might find it later,
-       so we need to track whether there are any data before first name */
-    bool thisIsFirstMeshAndItHasNoData = true;
-    _file->meshNames.emplace_back();
-
-    while(_file->in->good()) {
-        /* The previous object might end at the beginning of this line */
-        const std::streampos end = _file->in->tellg();
-
-        /* Comment line */
-        if(_file->in->peek() == '#') {
-            ignoreLine(*_file->in);
-            continue;
-        }
+/* Hand-rolled float parser, the whole token is expected to be a number */
+bool parseFloat(const Token& token, Float& out) {
+    /* Powers of ten that are exactly representable in a double */
+    constexpr Double Powers[] = {
+        1.0e0, 1.0e1, 1.0e2, 1.0e3, 1.0e4, 1.0e5, 1.0e6, 1.0e7, 1.0e8, 1.0e9,
+        1.0e10, 1.0e11, 1.0e12, 1.0e13, 1.0e14, 1.0e15, 1.0e16, 1.0e17, 1.0e18,
+        1.0e19, 1.0e20, 1.0e21, 1.0e22};
+
+    const char* c = token.first;
+    const char* const end = token.second;
+
+    bool negative = false;
+    if(c != end && (*c == '-' || *c == '+')) negative = *c++ == '-';
+
+    /* Mantissa digits, at most 19 fit into 64 bits */
+    UnsignedLong mantissa = 0;
+    Int digits = 0, exponent = 0;
+    for(; c != end && isDigit(*c); ++c, ++digits)
+        mantissa = mantissa*10 + (*c - '0');
+    if(c != end && *c == '.') for(++c; c != end && isDigit(*c); ++c, ++digits, --exponent)
+        mantissa = mantissa*10 + (*c - '0');
+    if(!digits || digits > 19) return parseFloatSlow(token, out);
+
+    if(c != end && (*c == 'e' || *c == 'E')) {
+        ++c;
+        bool negativeExponent = false;
+        if(c != end && (*c == '-' || *c == '+')) negativeExponent = *c++ == '-';
+        if(c == end || !isDigit(*c)) return false;
+        Int value = 0;
+        for(; c != end && isDigit(*c); ++c)
+            if(value < 10000) value = value*10 + (*c - '0');
+        exponent += negativeExponent ? -value : value;
+    }
 
-        /* Parse the keyword */
-        std::string keyword;
-        *_file->in >> keyword;
+    if(c != end) return parseFloatSlow(token, out);
 
-        /* Mesh name */
-        if(keyword == "o") {
-            std::string name;
-            std::getline(*_file->in, name);
-            name = Utility::String::trim(name);
+    Double result = Double(mantissa);
+    if(exponent < 0) result = exponent >= -22 ? result/Powers[-exponent] : result*std::pow(10.0, exponent);
+    else if(exponent > 0) result = exponent <= 22 ? result*Powers[exponent] : result*std::pow(10.0, exponent);
 
-            /* This is the name of first mesh */
-            if(thisIsFirstMeshAndItHasNoData) {
-                thisIsFirstMeshAndItHasNoData = false;
-
-                /* Update its name and add it to name map */
-                if(!name.empty())
-                    _file->meshesForName.emplace(name, _file->meshes.size() - 1);
-                _file->meshNames.back() = std::move(name);
+    /* Out of range, similarly to strtof() */
+    out = Float(negative ? -result : result);
+    return !std::isinf(out);
+}
 
-                /* Update its begin offset to be more precise */
-                std::get<0>(_file->meshes.back()) = _file->in->tellg();
+/* The whole token is expected to be an unsigned number */
+bool parseUnsignedInt(const Token& token, UnsignedInt& out) {
+    if(token.first == token.second) return false;
 
-            /* Otherwise this is a name of new mesh */
-            } else {
-                /* Set end of the previous one */
-                std::get<1>(_file->meshes.back()) = end;
+    UnsignedLong value = 0;
+    for(const char* c = token.first; c != token.second; ++c) {
+        if(!isDigit(*c)) return false;
+        value = value*10 + (*c - '0');
+        if(value > std::numeric_limits<UnsignedInt>::max()) return false;
+    }
 
-                /* Save name and offset of the new one. The end offset will be
-                   updated later. */
-                if(!name.empty())
-                    _file->meshesForName.emplace(name, _file->meshes.size());
-                _file->meshNames.emplace_back(std::move(name));
-                _file->meshes.emplace_back(_file->in->tellg(), 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset);
-            }
+    out = UnsignedInt(value);
+    return true;
+}
 
-            continue;
+/* Parses size floats and optionally one extra, returns error message on
+   failure */
+template<std::size_t size> const char* extractFloatData(const char* const begin, const char* const end, Math::Vector<size, Float>& output, Float* const extra = nullptr) {
+    Token tokens[size + 1];
+    const std::size_t count = tokenize(begin, end, tokens, size + 1);
+    if(count < size || count > size + (extra ? 1 : 0)) {
+        return "invalid float array size";
+    }
 
-        /* If there are any data/indices before the first name, it means that
-           the first object is unnamed. We need to check for them. */
+    for(std::size_t i = 0; i != size; ++i) if(!parseFloat(tokens[i], output[i])) {
+        return "error while converting numeric data";
+    }
 
-        /* Vertex data, update index offset for the following meshes */
-        } else if(keyword == "v") {
-            ++positionIndexOffset;
-            thisIsFirstMeshAndItHasNoData = false;
-        } else if(keyword == "vt") {
-            ++textureCoordinateIndexOffset;
-            thisIsFirstMeshAndItHasNoData = false;
-        } else if(keyword == "vn") {
-            ++normalIndexOffset;
-            thisIsFirstMeshAndItHasNoData = false;
+    if(count == size + 1) {
+        /* This should be obvious from the first if, but add this just to make
+           Clang Analyzer happy */
+        CORRADE_INTERNAL_ASSERT(extra);
 
-        /* Index data, just mark that we found something for first unnamed
-           object */
-        } else if(thisIsFirstMeshAndItHasNoData) for(const std::string& data: {"p", "l", "f"}) {
-            if(keyword == data) {
-                thisIsFirstMeshAndItHasNoData = false;
-                break;
-            }
+        if(!parseFloat(tokens[size], *extra)) {
+            return "error while converting numeric data";
         }
-
-        /* Ignore the rest of the line */
-        ignoreLine(*_file->in);
     }
 
-    /* Set end of the last object */
-    _file->in->clear();
-    _file->in->seekg(0, std::ios::end);
-    std::get<1>(_file->meshes.back()) = _file->in->tellg();
+    return nullptr;
 }
 
-UnsignedInt ObjImporter::doMesh3DCount() const { return _file->meshes.size(); }
+template<class T> bool reindex(const std::vector<UnsignedInt>& indices, std::vector<T>& data) {
+    /* Check that indices are in range */
+    for(UnsignedInt i: indices) if(i >= data.size()) return false;
 
-Int ObjImporter::doMesh3DForName(const std::string& name) {
-    const auto it = _file->meshesForName.find(name);
-    return it == _file->meshesForName.end() ? -1 : it->second;
+    data = MeshTools::duplicate(indices, data);
+    return true;
 }
 
-std::string ObjImporter::doMesh3DName(UnsignedInt id) {
-    return _file->meshNames[id];
+/* Result of parsing a single mesh. The parsing doesn't print anything so it
+   can be done from multiple threads at once, the error is printed by the
+   caller afterwards. */
+struct ParseResult {
+    std::optional<MeshData3D> mesh;
+    const char* error = nullptr;
+
+    /* Additional data for "unknown keyword" and "mixed primitive" errors */
+    std::string keyword;
+    MeshPrimitive primitive{}, mixedPrimitive{};
+};
+
+void printError(const ParseResult& result) {
+    Error e;
+    e << "Trade::ObjImporter::mesh3D():" << result.error;
+    if(!result.keyword.empty()) e << result.keyword;
+    else if(result.primitive != result.mixedPrimitive)
+        e << result.primitive << "and" << result.mixedPrimitive;
 }
 
-std::optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
-    /* Seek the file, set mesh parsing parameters */
-    std::streampos begin, end;
-    UnsignedInt positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset;
-    std::tie(begin, end, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset) = _file->meshes[id];
-    _file->in->seekg(begin);
+ParseResult parseMesh(const char* const begin, const char* const end, const UnsignedInt positionIndexOffset, const UnsignedInt textureCoordinateIndexOffset, const UnsignedInt normalIndexOffset) {
+    ParseResult result;
 
     std::optional<MeshPrimitive> primitive;
     std::vector<Vector3> positions;
@@ -257,212 +237,197 @@ std::optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
     std::vector<UnsignedInt> textureCoordinateIndices;
     std::vector<UnsignedInt> normalIndices;
 
-    try { while(_file->in->good() && _file->in->tellg() < end) {
-        /* Ignore comments */
-        if(_file->in->peek() == '#') {
-            ignoreLine(*_file->in);
-            continue;
-        }
-
-        /* Get the line */
-        std::string line;
-        std::getline(*_file->in, line);
-        line = Utility::String::trim(line);
-
-        /* Ignore empty lines */
-        if(line.empty()) continue;
+    /* The data are parsed in place, line by line, without any allocations
+       except for the output arrays */
+    for(const char* line = begin; line < end; ) {
+        const char* const currentLineEnd = lineEnd(line, end);
+        const char* contents = line;
+        line = currentLineEnd == end ? end : currentLineEnd + 1;
 
-        /* Split the line into keyword and contents */
-        const std::size_t keywordEnd = line.find(' ');
-        const std::string keyword = line.substr(0, keywordEnd);
-        const std::string contents = keywordEnd != std::string::npos ?
-            Utility::String::ltrim(line.substr(keywordEnd+1)) : "";
+        /* Ignore empty lines and comments */
+        const Token keyword = nextToken(contents, currentLineEnd);
+        if(keyword.first == keyword.second || *keyword.first == '#') continue;
 
         /* Vertex position */
-        if(keyword == "v") {
+        if(equals(keyword, "v")) {
             Float extra{1.0f};
-            const Vector3 data = extractFloatData<3>(contents, &extra);
+            Vector3 data;
+            if((result.error = extractFloatData<3>(contents, currentLineEnd, data, &extra)))
+                return result;
             if(!Math::TypeTraits<Float>::equals(extra, 1.0f)) {
-                Error() << "Trade::ObjImporter::mesh3D(): homogeneous coordinates are not supported";
-                return std::nullopt;
+                result.error = "homogeneous coordinates are not supported";
+                return result;
             }
 
             positions.push_back(data);
 
         /* Texture coordinate */
-        } else if(keyword == "vt") {
+        } else if(equals(keyword, "vt")) {
             Float extra{0.0f};
-            const auto data = extractFloatData<2>(contents, &extra);
+            Vector2 data;
+            if((result.error = extractFloatData<2>(contents, currentLineEnd, data, &extra)))
+                return result;
             if(!Math::TypeTraits<Float>::equals(extra, 0.0f)) {
-                Error() << "Trade::ObjImporter::mesh3D(): 3D texture coordinates are not supported";
-                return std::nullopt;
+                result.error = "3D texture coordinates are not supported";
+                return result;
             }
 
             if(textureCoordinates.empty()) textureCoordinates.push_back({});
             textureCoordinates.front().push_back(data);
 
         /* Normal */
-        } else if(keyword == "vn") {
+        } else if(equals(keyword, "vn")) {
+            Vector3 data;
+            if((result.error = extractFloatData<3>(contents, currentLineEnd, data)))
+                return result;
+
             if(normals.empty()) normals.push_back({});
-            normals.front().push_back(extractFloatData<3>(contents));
+            normals.front().push_back(data);
 
         /* Indices */
-        } else if(keyword == "p" || keyword == "l" || keyword == "f") {
-            const std::vector<std::string> indexTuples = Utility::String::splitWithoutEmptyParts(contents, ' ');
+        } else if(equals(keyword, "p") || equals(keyword, "l") || equals(keyword, "f")) {
+            /* At most three index tuples are supported, one more to detect
+               polygons */
+            Token indexTuples[4];
+            const std::size_t indexTupleCount = tokenize(contents, currentLineEnd, indexTuples, 4);
 
             /* Points */
-            if(keyword == "p") {
+            if(equals(keyword, "p")) {
                 /* Check that we don't mix the primitives in one mesh */
                 if(primitive && primitive != MeshPrimitive::Points) {
-                    Error() << "Trade::ObjImporter::mesh3D(): mixed primitive" << *primitive << "and" << MeshPrimitive::Points;
-                    return std::nullopt;
+                    result.error = "mixed primitive";
+                    result.primitive = *primitive;
+                    result.mixedPrimitive = MeshPrimitive::Points;
+                    return result;
                 }
 
                 /* Check vertex count per primitive */
-                if(indexTuples.size() != 1) {
-                    Error() << "Trade::ObjImporter::mesh3D(): wrong index count for point";
-                    return std::nullopt;
+                if(indexTupleCount != 1) {
+                    result.error = "wrong index count for point";
+                    return result;
                 }
 
                 primitive = MeshPrimitive::Points;
 
             /* Lines */
-            } else if(keyword == "l") {
+            } else if(equals(keyword, "l")) {
                 /* Check that we don't mix the primitives in one mesh */
                 if(primitive && primitive != MeshPrimitive::Lines) {
-                    Error() << "Trade::ObjImporter::mesh3D(): mixed primitive" << *primitive << "and" << MeshPrimitive::Lines;
-                    return std::nullopt;
+                    result.error = "mixed primitive";
+                    result.primitive = *primitive;
+                    result.mixedPrimitive = MeshPrimitive::Lines;
+                    return result;
                 }
 
                 /* Check vertex count per primitive */
-                if(indexTuples.size() != 2) {
-                    Error() << "Trade::ObjImporter::mesh3D(): wrong index count for line";
-                    return std::nullopt;
+                if(indexTupleCount != 2) {
+                    result.error = "wrong index count for line";
+                    return result;
                 }
 
                 primitive = MeshPrimitive::Lines;
 
             /* Faces */
-            } else if(keyword == "f") {
+            } else if(equals(keyword, "f")) {
                 /* Check that we don't mix the primitives in one mesh */
                 if(primitive && primitive != MeshPrimitive::Triangles) {
-                    Error() << "Trade::ObjImporter::mesh3D(): mixed primitive" << *primitive << "and" << MeshPrimitive::Triangles;
-                    return std::nullopt;
+                    result.error = "mixed primitive";
+                    result.primitive = *primitive;
+                    result.mixedPrimitive = MeshPrimitive::Triangles;
+                    return result;
                 }
 
                 /* Check vertex count per primitive */
-                if(indexTuples.size() < 3) {
-                    Error() << "Trade::ObjImporter::mesh3D(): wrong index count for triangle";
-                    return std::nullopt;
-                } else if(indexTuples.size() != 3) {
-                    Error() << "Trade::ObjImporter::mesh3D(): polygons are not supported";
-                    return std::nullopt;
+                if(indexTupleCount < 3) {
+                    result.error = "wrong index count for triangle";
+                    return result;
+                } else if(indexTupleCount != 3) {
+                    result.error = "polygons are not supported";
+                    return result;
                 }
 
                 primitive = MeshPrimitive::Triangles;
 
             } else CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
 
-            for(const std::string& indexTuple: indexTuples) {
-                std::vector<std::string> indices = Utility::String::split(indexTuple, '/');
-                if(indices.size() > 3) {
-                    Error() << "Trade::ObjImporter::mesh3D(): invalid index data";
-                    return std::nullopt;
+            for(std::size_t i = 0; i != indexTupleCount; ++i) {
+                /* Split the tuple on slashes, one more to detect
+                   invalid data */
+                Token indices[4];
+                std::size_t indexCount = 0;
+                for(const char* c = indexTuples[i].first; ; ++c) {
+                    const char* const indexEnd = static_cast<const char*>(std::memchr(c, '/', indexTuples[i].second - c));
+                    if(indexCount < 4) indices[indexCount] = {c, indexEnd ? indexEnd : indexTuples[i].second};
+                    ++indexCount;
+                    if(!indexEnd) break;
+                    c = indexEnd;
+                }
+                if(indexCount > 3) {
+                    result.error = "invalid index data";
+                    return result;
                 }
-
-                #ifdef CORRADE_TARGET_ANDROID
-                char* end{};
-                #endif
 
                 /* Position indices */
-                positionIndices.push_back(
-                    #ifndef CORRADE_TARGET_ANDROID
-                    std::stoul(indices[0])
-                    #else
-                    std::strtoul(indices[0].data(), &end, 10)
-                    #endif
-                    - positionIndexOffset);
-
-                #ifdef CORRADE_TARGET_ANDROID
-                if(end == indices[0].data()) throw std::exception{};
-                #endif
+                UnsignedInt index;
+                if(!parseUnsignedInt(indices[0], index)) {
+                    result.error = "error while converting numeric data";
+                    return result;
+                }
+                positionIndices.push_back(index - positionIndexOffset);
 
                 /* Texture coordinates */
-                if(indices.size() == 2 || (indices.size() == 3 && !indices[1].empty())) {
-                    textureCoordinateIndices.push_back(
-                        #ifndef CORRADE_TARGET_ANDROID
-                        std::stoul(indices[1])
-                        #else
-                        std::strtoul(indices[1].data(), &end, 10)
-                        #endif
-                        - textureCoordinateIndexOffset);
-
-                    #ifdef CORRADE_TARGET_ANDROID
-                    if(end == indices[1].data()) throw std::exception{};
-                    #endif
+                if(indexCount == 2 || (indexCount == 3 && indices[1].first != indices[1].second)) {
+                    if(!parseUnsignedInt(indices[1], index)) {
+                        result.error = "error while converting numeric data";
+                        return result;
+                    }
+                    textureCoordinateIndices.push_back(index - textureCoordinateIndexOffset);
                 }
 
                 /* Normal indices */
-                if(indices.size() == 3) {
-                    normalIndices.push_back(
-                        #ifndef CORRADE_TARGET_ANDROID
-                        std::stoul(indices[2])
-                        #else
-                        std::strtoul(indices[2].data(), &end, 10)
-                        #endif
-                        - normalIndexOffset);
-
-                    #ifdef CORRADE_TARGET_ANDROID
-                    if(end == indices[2].data()) throw std::exception{};
-                    #endif
+                if(indexCount == 3) {
+                    if(!parseUnsignedInt(indices[2], index)) {
+                        result.error = "error while converting numeric data";
+                        return result;
+                    }
+                    normalIndices.push_back(index - normalIndexOffset);
                 }
             }
 
         /* Ignore unsupported keywords, error out on unknown keywords */
-        } else if(![&keyword](){
-            /* Using lambda to emulate for-else construct like in Python */
-            for(const std::string expected: {"mtllib", "usemtl", "g", "s"})
-                if(keyword == expected) return true;
-            return false;
-        }()) {
-            Error() << "Trade::ObjImporter::mesh3D(): unknown keyword" << keyword;
-            return std::nullopt;
+        } else if(!equals(keyword, "mtllib") && !equals(keyword, "usemtl") && !equals(keyword, "g") && !equals(keyword, "s")) {
+            result.error = "unknown keyword";
+            result.keyword = std::string{keyword.first, keyword.second};
+            return result;
         }
-
-    }} catch(std::exception) {
-        Error() << "Trade::ObjImporter::mesh3D(): error while converting numeric data";
-        return std::nullopt;
-    } catch(...) {
-        /* Error message already printed */
-        return std::nullopt;
     }
 
     /* There should be at least indexed position data */
     if(positions.empty() || positionIndices.empty()) {
-        Error() << "Trade::ObjImporter::mesh3D(): incomplete position data";
-        return std::nullopt;
+        result.error = "incomplete position data";
+        return result;
     }
 
     /* If there are index data, there should be also vertex data (and also the other way) */
     if(normals.empty() != normalIndices.empty()) {
-        Error() << "Trade::ObjImporter::mesh3D(): incomplete normal data";
-        return std::nullopt;
+        result.error = "incomplete normal data";
+        return result;
     }
     if(textureCoordinates.empty() != textureCoordinateIndices.empty()) {
-        Error() << "Trade::ObjImporter::mesh3D(): incomplete texture coordinate data";
-        return std::nullopt;
+        result.error = "incomplete texture coordinate data";
+        return result;
     }
 
     /* All index arrays should have the same length */
     if(!normalIndices.empty() && normalIndices.size() != positionIndices.size()) {
         CORRADE_INTERNAL_ASSERT(normalIndices.size() < positionIndices.size());
-        Error() << "Trade::ObjImporter::mesh3D(): some normal indices are missing";
-        return std::nullopt;
+        result.error = "some normal indices are missing";
+        return result;
     }
     if(!textureCoordinates.empty() && textureCoordinateIndices.size() != positionIndices.size()) {
         CORRADE_INTERNAL_ASSERT(textureCoordinateIndices.size() < positionIndices.size());
-        Error() << "Trade::ObjImporter::mesh3D(): some texture coordinate indices are missing";
-        return std::nullopt;
+        result.error = "some texture coordinate indices are missing";
+        return result;
     }
 
     /* Merge index arrays, if there aren't just the positions */
@@ -476,13 +441,11 @@ std::optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
         indices = MeshTools::combineIndexArrays(arrays);
 
         /* Reindex data arrays */
-        try {
-            reindex(positionIndices, positions);
-            if(!normalIndices.empty()) reindex(normalIndices, normals.front());
-            if(!textureCoordinateIndices.empty()) reindex(textureCoordinateIndices, textureCoordinates.front());
-        } catch(...) {
-            /* Error message already printed */
-            return std::nullopt;
+        if(!reindex(positionIndices, positions) ||
+           (!normalIndices.empty() && !reindex(normalIndices, normals.front())) ||
+           (!textureCoordinateIndices.empty() && !reindex(textureCoordinateIndices, textureCoordinates.front()))) {
+            result.error = "index out of range";
+            return result;
         }
 
     /* Otherwise just use the original position index array. Don't forget to
@@ -490,12 +453,184 @@ std::optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
     } else {
         indices = std::move(positionIndices);
         for(UnsignedInt i: indices) if(i >= positions.size()) {
-            Error() << "Trade::ObjImporter::mesh3D(): index out of range";
-            return std::nullopt;
+            result.error = "index out of range";
+            return result;
         }
     }
 
-    return MeshData3D(*primitive, std::move(indices), {std::move(positions)}, std::move(normals), std::move(textureCoordinates));
+    result.mesh.emplace(*primitive, std::move(indices), std::vector<std::vector<Vector3>>{std::move(positions)}, std::move(normals), std::move(textureCoordinates));
+    return result;
+}
+
+}
+
+ObjImporter::ObjImporter() = default;
+
+ObjImporter::ObjImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImporter(manager, std::move(plugin)) {}
+
+ObjImporter::~ObjImporter() = default;
+
+auto ObjImporter::doFeatures() const -> Features { return Feature::OpenData|Feature::ThreadSafeInstances; }
+
+void ObjImporter::doClose() { _file.reset(); }
+
+bool ObjImporter::doIsOpened() const { return !!_file; }
+
+void ObjImporter::doOpenFile(const std::string& filename) {
+    /* Map the file directly, so it doesn't need to be read in whole to memory
+       first */
+    std::optional<Containers::Array<char>> data = mapFile(filename);
+    if(!data) return;
+
+    _file.reset(new File);
+    _file->data = std::move(*data);
+    parseMeshNames();
+}
+
+void ObjImporter::doOpenData(Containers::ArrayView<const char> data) {
+    _file.reset(new File);
+    _file->data = Containers::Array<char>{data.size()};
+    std::copy(data.begin(), data.end(), _file->data.begin());
+
+    parseMeshNames();
+}
+
+void ObjImporter::parseMeshNames() {
+    /* First mesh starts at the beginning, its indices start from 1. The end
+       offset will be updated to proper value later. */
+    UnsignedInt positionIndexOffset = 1;
+    UnsignedInt normalIndexOffset = 1;
+    UnsignedInt textureCoordinateIndexOffset = 1;
+    _file->meshes.emplace_back(0, 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset);
+
+    /* The first mesh doesn't have name by default but we might find it later,
+       so we need to track whether there are any data before first name */
+    bool thisIsFirstMeshAndItHasNoData = true;
+    _file->meshNames.emplace_back();
+
+    const char* const begin = _file->data.begin();
+    const char* const end = _file->data.end();
+    for(const char* line = begin; line != end; ) {
+        /* The previous object might end at the beginning of this line */
+        const char* const currentLineEnd = lineEnd(line, end);
+        const char* const nextLine = currentLineEnd == end ? end : currentLineEnd + 1;
+        const char* contents = line;
+
+        /* Parse the keyword, ignore empty lines and comments */
+        const Token keyword = nextToken(contents, currentLineEnd);
+        if(keyword.first == keyword.second || *keyword.first == '#') {
+            line = nextLine;
+            continue;
+        }
+
+        /* Mesh name */
+        if(equals(keyword, "o")) {
+            /* Trim the name */
+            while(contents != currentLineEnd && isSpace(*contents)) ++contents;
+            const char* nameEnd = currentLineEnd;
+            while(nameEnd != contents && isSpace(*(nameEnd - 1))) --nameEnd;
+            std::string name{contents, nameEnd};
+
+            /* This is the name of first mesh */
+            if(thisIsFirstMeshAndItHasNoData) {
+                thisIsFirstMeshAndItHasNoData = false;
+
+                /* Update its name and add it to name map */
+                if(!name.empty())
+                    _file->meshesForName.emplace(name, _file->meshes.size() - 1);
+                _file->meshNames.back() = std::move(name);
+
+                /* Update its begin offset to be more precise */
+                std::get<0>(_file->meshes.back()) = nextLine - begin;
+
+            /* Otherwise this is a name of new mesh */
+            } else {
+                /* Set end of the previous one */
+                std::get<1>(_file->meshes.back()) = line - begin;
+
+                /* Save name and offset of the new one. The end offset will be
+                   updated later. */
+                if(!name.empty())
+                    _file->meshesForName.emplace(name, _file->meshes.size());
+                _file->meshNames.emplace_back(std::move(name));
+                _file->meshes.emplace_back(nextLine - begin, 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset);
+            }
+
+        /* If there are any data/indices before the first name, it means that
+           the first object is unnamed. We need to check for them. */
+
+        /* Vertex data, update index offset for the following meshes */
+        } else if(equals(keyword, "v")) {
+            ++positionIndexOffset;
+            thisIsFirstMeshAndItHasNoData = false;
+        } else if(equals(keyword, "vt")) {
+            ++textureCoordinateIndexOffset;
+            thisIsFirstMeshAndItHasNoData = false;
+        } else if(equals(keyword, "vn")) {
+            ++normalIndexOffset;
+            thisIsFirstMeshAndItHasNoData = false;
+
+        /* Index data, just mark that we found something for first unnamed
+           object */
+        } else if(equals(keyword, "p") || equals(keyword, "l") || equals(keyword, "f")) {
+            thisIsFirstMeshAndItHasNoData = false;
+        }
+
+        line = nextLine;
+    }
+
+    /* Set end of the last object */
+    std::get<1>(_file->meshes.back()) = _file->data.size();
+}
+
+UnsignedInt ObjImporter::doMesh3DCount() const { return _file->meshes.size(); }
+
+Int ObjImporter::doMesh3DForName(const std::string& name) {
+    const auto it = _file->meshesForName.find(name);
+    return it == _file->meshesForName.end() ? -1 : it->second;
+}
+
+std::string ObjImporter::doMesh3DName(UnsignedInt id) {
+    return _file->meshNames[id];
+}
+
+std::optional<MeshData3D> ObjImporter::doMesh3D(const UnsignedInt id) {
+    std::size_t begin, end;
+    UnsignedInt positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset;
+    std::tie(begin, end, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset) = _file->meshes[id];
+
+    ParseResult result = parseMesh(_file->data.begin() + begin, _file->data.begin() + end, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset);
+    if(result.error) printError(result);
+    return std::move(result.mesh);
+}
+
+std::vector<std::optional<MeshData3D>> ObjImporter::mesh3D(const std::vector<UnsignedInt>& ids, UnsignedInt threadCount) {
+    CORRADE_ASSERT(isOpened(), "Trade::ObjImporter::mesh3D(): no file opened", {});
+    for(const UnsignedInt id: ids)
+        CORRADE_ASSERT(id < _file->meshes.size(), "Trade::ObjImporter::mesh3D(): index out of range", {});
+
+    if(!threadCount) threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    /* The file data are only read, the results are written to distinct
+       items */
+    std::vector<ParseResult> results(ids.size());
+    Implementation::parallelFor(ids.size(), threadCount, 1, [this, &ids, &results](const std::size_t first, const std::size_t last) {
+        for(std::size_t i = first; i != last; ++i) {
+            std::size_t begin, end;
+            UnsignedInt positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset;
+            std::tie(begin, end, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset) = _file->meshes[ids[i]];
+            results[i] = parseMesh(_file->data.begin() + begin, _file->data.begin() + end, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset);
+        }
+    });
+
+    std::vector<std::optional<MeshData3D>> meshes;
+    meshes.reserve(ids.size());
+    for(ParseResult& result: results) {
+        if(result.error) printError(result);
+        meshes.push_back(std::move(result.mesh));
+    }
+
+    return meshes;
 }
 
 }}
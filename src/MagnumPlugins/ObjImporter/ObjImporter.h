@@ -29,6 +29,8 @@
  * @brief Class @ref Magnum::Trade::ObjImporter
  */
 
+#include <vector>
+
 #include "Magnum/Trade/AbstractImporter.h"
 
 #include "MagnumPlugins/ObjImporter/configure.h"
@@ -59,6 +61,20 @@ Supported features:
 Polygons (quads etc.), automatic normal generation and material properties are
 currently not supported.
 
+When opening a file, it is memory-mapped using @ref mapFile() on platforms
+that support it, otherwise its contents are read to memory. The data are then parsed in place
+without any intermediate per-line allocations.
+
+Vertex index offsets of all meshes are calculated already when opening the
+file, so the meshes are independent of each other and can be parsed
+concurrently. Use @ref mesh3D(const std::vector<UnsignedInt>&, UnsignedInt)
+to import many meshes at once, for example:
+@code
+std::vector<UnsignedInt> ids(importer.mesh3DCount());
+std::iota(ids.begin(), ids.end(), 0);
+std::vector<std::optional<Trade::MeshData3D>> meshes = importer.mesh3D(ids);
+@endcode
+
 This plugin is built if `WITH_OBJIMPORTER` is enabled when building Magnum. To
 use dynamic plugin, you need to load `ObjImporter` plugin from
 `MAGNUM_PLUGINS_IMPORTER_DIR`. To use static plugin or use this as a dependency
@@ -76,6 +92,23 @@ class MAGNUM_OBJIMPORTER_EXPORT ObjImporter: public AbstractImporter {
 
         ~ObjImporter();
 
+        using AbstractImporter::mesh3D;
+
+        /**
+         * @brief Import multiple meshes in parallel
+         * @param ids           Mesh IDs
+         * @param threadCount   Max count of threads to use from
+         *      @ref TaskScheduler::global(). If `0`, uses
+         *      `std::thread::hardware_concurrency()`.
+         *
+         * Equivalent to calling @ref mesh3D(UnsignedInt) for each ID in
+         * @p ids, but the meshes are parsed concurrently. The returned array
+         * has the same order as @p ids, meshes that failed to import are
+         * `std::nullopt`. Error messages are printed after all meshes are
+         * parsed, in the order of @p ids.
+         */
+        std::vector<std::optional<MeshData3D>> mesh3D(const std::vector<UnsignedInt>& ids, UnsignedInt threadCount = 0);
+
     private:
         struct File;
 
@@ -44,6 +44,9 @@ class ObjImporterTest: public TestSuite::Tester {
         void lineMesh();
         void triangleMesh();
         void mixedPrimitives();
+        void openData();
+        void floatFormats();
+        void whitespace();
 
         void positionsOnly();
         void textureCoordinates();
@@ -55,6 +58,8 @@ class ObjImporterTest: public TestSuite::Tester {
         void namedMesh();
         void moreMeshes();
         void unnamedFirstMesh();
+        void multipleMeshesParallel();
+        void multipleMeshesParallelError();
 
         void wrongFloat();
         void wrongInteger();
@@ -96,6 +101,9 @@ ObjImporterTest::ObjImporterTest() {
               &ObjImporterTest::lineMesh,
               &ObjImporterTest::triangleMesh,
               &ObjImporterTest::mixedPrimitives,
+              &ObjImporterTest::openData,
+              &ObjImporterTest::floatFormats,
+              &ObjImporterTest::whitespace,
 
               &ObjImporterTest::positionsOnly,
               &ObjImporterTest::textureCoordinates,
@@ -107,6 +115,8 @@ ObjImporterTest::ObjImporterTest() {
               &ObjImporterTest::namedMesh,
               &ObjImporterTest::moreMeshes,
               &ObjImporterTest::unnamedFirstMesh,
+              &ObjImporterTest::multipleMeshesParallel,
+              &ObjImporterTest::multipleMeshesParallelError,
 
               &ObjImporterTest::wrongFloat,
               &ObjImporterTest::wrongInteger,
@@ -211,6 +221,64 @@ void ObjImporterTest::mixedPrimitives() {
     CORRADE_COMPARE(out.str(), "Trade::ObjImporter::mesh3D(): mixed primitive MeshPrimitive::Points and MeshPrimitive::Lines\n");
 }
 
+void ObjImporterTest::openData() {
+    constexpr const char data[] =
+        "v 1 2 3\n"
+        "p 1\n"
+        "o Named\n"
+        "v 0.5 2 3\n"
+        "v 0 1.5 1\n"
+        "l 3 2";
+
+    ObjImporter importer;
+    CORRADE_VERIFY(importer.openData({data, sizeof(data) - 1}));
+    CORRADE_COMPARE(importer.mesh3DCount(), 2);
+    CORRADE_COMPARE(importer.mesh3DForName("Named"), 1);
+
+    const std::optional<MeshData3D> mesh = importer.mesh3D(1);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Lines);
+    CORRADE_COMPARE(mesh->indices(), (std::vector<UnsignedInt>{1, 0}));
+}
+
+void ObjImporterTest::floatFormats() {
+    constexpr const char data[] =
+        "v 1e2 -2.5E-1 +.5\n"
+        "v 3. 1.25e+1 -0\n"
+        "p 1\n"
+        "p 2\n";
+
+    ObjImporter importer;
+    CORRADE_VERIFY(importer.openData({data, sizeof(data) - 1}));
+
+    const std::optional<MeshData3D> mesh = importer.mesh3D(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->positions(0), (std::vector<Vector3>{
+        {100.0f, -0.25f, 0.5f},
+        {3.0f, 12.5f, 0.0f}
+    }));
+}
+
+void ObjImporterTest::whitespace() {
+    constexpr const char data[] =
+        "\r\n"
+        "  # indented comment\r\n"
+        "o  Mesh name \r\n"
+        "v\t1  2\t3\r\n"
+        "\tp 1 \r\n";
+
+    ObjImporter importer;
+    CORRADE_VERIFY(importer.openData({data, sizeof(data) - 1}));
+    CORRADE_COMPARE(importer.mesh3DCount(), 1);
+    CORRADE_COMPARE(importer.mesh3DName(0), "Mesh name");
+
+    const std::optional<MeshData3D> mesh = importer.mesh3D(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->positions(0), (std::vector<Vector3>{
+        {1.0f, 2.0f, 3.0f}
+    }));
+}
+
 void ObjImporterTest::positionsOnly() {
     ObjImporter importer;
     CORRADE_VERIFY(importer.openFile(Utility::Directory::join(OBJIMPORTER_TEST_DIR, "triangleMesh.obj")));
@@ -399,6 +467,54 @@ void ObjImporterTest::unnamedFirstMesh() {
     CORRADE_COMPARE(importer.mesh3DForName("SecondMesh"), 1);
 }
 
+void ObjImporterTest::multipleMeshesParallel() {
+    ObjImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(OBJIMPORTER_TEST_DIR, "moreMeshes.obj")));
+    CORRADE_COMPARE(importer.mesh3DCount(), 3);
+
+    /* Each mesh twice, in reverse order, more threads than meshes */
+    const std::vector<std::optional<MeshData3D>> meshes = importer.mesh3D({2, 1, 0, 2, 1, 0}, 8);
+    CORRADE_COMPARE(meshes.size(), 6);
+
+    for(std::size_t i = 0; i != meshes.size(); ++i) {
+        CORRADE_VERIFY(meshes[i]);
+
+        /* Compare with serially imported ones */
+        const std::optional<MeshData3D> mesh = importer.mesh3D(2 - i%3);
+        CORRADE_VERIFY(mesh);
+        CORRADE_COMPARE(meshes[i]->primitive(), mesh->primitive());
+        CORRADE_COMPARE(meshes[i]->indices(), mesh->indices());
+        CORRADE_COMPARE(meshes[i]->positions(0), mesh->positions(0));
+        CORRADE_COMPARE(meshes[i]->normalArrayCount(), mesh->normalArrayCount());
+        CORRADE_COMPARE(meshes[i]->textureCoords2DArrayCount(), mesh->textureCoords2DArrayCount());
+    }
+}
+
+void ObjImporterTest::multipleMeshesParallelError() {
+    ObjImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(OBJIMPORTER_TEST_DIR, "wrongNumbers.obj")));
+    const Int wrongFloat = importer.mesh3DForName("WrongFloat");
+    const Int outOfRange = importer.mesh3DForName("PositionIndexOutOfRange");
+    const Int mergedOutOfRange = importer.mesh3DForName("TextureIndexOutOfRange");
+    CORRADE_VERIFY(wrongFloat > -1);
+    CORRADE_VERIFY(outOfRange > -1);
+    CORRADE_VERIFY(mergedOutOfRange > -1);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    const std::vector<std::optional<MeshData3D>> meshes = importer.mesh3D({UnsignedInt(outOfRange), UnsignedInt(wrongFloat), UnsignedInt(mergedOutOfRange)}, 3);
+    CORRADE_COMPARE(meshes.size(), 3);
+    CORRADE_VERIFY(!meshes[0]);
+    CORRADE_VERIFY(!meshes[1]);
+    CORRADE_VERIFY(!meshes[2]);
+
+    /* Messages are printed in order */
+    CORRADE_COMPARE(out.str(),
+        "Trade::ObjImporter::mesh3D(): index out of range\n"
+        "Trade::ObjImporter::mesh3D(): error while converting numeric data\n"
+        "Trade::ObjImporter::mesh3D(): index out of range\n");
+}
+
 void ObjImporterTest::wrongFloat() {
     ObjImporter importer;
     CORRADE_VERIFY(importer.openFile(Utility::Directory::join(OBJIMPORTER_TEST_DIR, "wrongNumbers.obj")));
@@ -36,6 +36,8 @@
 #include "MagnumPlugins/TgaImageConverter/TgaImageConverter.h"
 #include "MagnumPlugins/TgaImporter/TgaImporter.h"
 
+#include "configure.h"
+
 namespace Magnum { namespace Trade { namespace Test {
 
 class TgaImageConverterTest: public TestSuite::Tester {
@@ -47,6 +49,15 @@ class TgaImageConverterTest: public TestSuite::Tester {
 
         void rgb();
         void rgba();
+
+        void rleRgb();
+        void rleRgba();
+        void rleGrayscale();
+        void rleLongRun();
+
+        void file();
+        void fileRle();
+        void fileCannotWrite();
 };
 
 namespace {
@@ -74,6 +85,38 @@ namespace {
         5, 6, 7, 8, 6, 7, 8, 9
     };
     const ImageView2D OriginalRGBA{PixelFormat::RGBA, PixelType::UnsignedByte, {2, 3}, OriginalDataRGBA};
+
+    /* Rows with a run, raw pixels and a mix of both */
+    constexpr char OriginalDataRleRGB[] = {
+        1, 2, 3, 1, 2, 3, 1, 2, 3, 1, 2, 3, 0, 0, 0, 0,
+        1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 1, 2, 0, 0, 0, 0,
+        1, 2, 3, 4, 5, 6, 4, 5, 6, 7, 8, 9, 0, 0, 0, 0
+    };
+    constexpr char ConvertedDataRleRGB[] = {
+        1, 2, 3, 1, 2, 3, 1, 2, 3, 1, 2, 3,
+        1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 1, 2,
+        1, 2, 3, 4, 5, 6, 4, 5, 6, 7, 8, 9
+    };
+    const ImageView2D OriginalRleRGB{PixelStorage{}.setRowLength(5),
+        PixelFormat::RGB, PixelType::UnsignedByte, {4, 3}, OriginalDataRleRGB};
+
+    constexpr char OriginalDataRleRGBA[] = {
+        1, 2, 3, 4, 1, 2, 3, 4, 1, 2, 3, 4, 5, 6, 7, 8,
+        5, 6, 7, 8, 5, 6, 7, 8, 1, 2, 3, 4, 5, 6, 7, 8
+    };
+    const ImageView2D OriginalRleRGBA{PixelFormat::RGBA, PixelType::UnsignedByte, {4, 2}, OriginalDataRleRGBA};
+
+    #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
+    constexpr PixelFormat GrayscaleFormat = PixelFormat::Red;
+    #else
+    constexpr PixelFormat GrayscaleFormat = PixelFormat::Luminance;
+    #endif
+
+    std::optional<Trade::ImageData2D> importData(const Containers::ArrayView<const char> data) {
+        TgaImporter importer;
+        if(!importer.openData(data)) return std::nullopt;
+        return importer.image2D(0);
+    }
 }
 
 TgaImageConverterTest::TgaImageConverterTest() {
@@ -81,7 +124,16 @@ TgaImageConverterTest::TgaImageConverterTest() {
               &TgaImageConverterTest::wrongType,
 
               &TgaImageConverterTest::rgb,
-              &TgaImageConverterTest::rgba});
+              &TgaImageConverterTest::rgba,
+
+              &TgaImageConverterTest::rleRgb,
+              &TgaImageConverterTest::rleRgba,
+              &TgaImageConverterTest::rleGrayscale,
+              &TgaImageConverterTest::rleLongRun,
+
+              &TgaImageConverterTest::file,
+              &TgaImageConverterTest::fileRle,
+              &TgaImageConverterTest::fileCannotWrite});
 }
 
 void TgaImageConverterTest::wrongFormat() {
@@ -154,6 +206,105 @@ void TgaImageConverterTest::rgba() {
         TestSuite::Compare::Container);
 }
 
+void TgaImageConverterTest::rleRgb() {
+    const auto data = TgaImageConverter{}.setFlags(TgaImageConverter::Flag::Rle).exportToData(OriginalRleRGB);
+    CORRADE_VERIFY(data);
+
+    /* Header with image type 10 */
+    CORRADE_COMPARE(data[2], 10);
+
+    /* One run packet, one raw packet and raw + run + raw packets */
+    CORRADE_COMPARE(data.size(), 18 + (1 + 3) + (1 + 12) + (1 + 3 + 1 + 3 + 1 + 3));
+
+    std::optional<Trade::ImageData2D> converted = importData(data);
+    CORRADE_VERIFY(converted);
+    CORRADE_COMPARE(converted->size(), Vector2i(4, 3));
+    CORRADE_COMPARE(converted->format(), PixelFormat::RGB);
+    CORRADE_COMPARE_AS(converted->data(), Containers::ArrayView<const char>{ConvertedDataRleRGB},
+        TestSuite::Compare::Container);
+}
+
+void TgaImageConverterTest::rleRgba() {
+    const auto data = TgaImageConverter{}.setFlags(TgaImageConverter::Flag::Rle).exportToData(OriginalRleRGBA);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data[2], 10);
+
+    std::optional<Trade::ImageData2D> converted = importData(data);
+    CORRADE_VERIFY(converted);
+    CORRADE_COMPARE(converted->size(), Vector2i(4, 2));
+    CORRADE_COMPARE(converted->format(), PixelFormat::RGBA);
+    CORRADE_COMPARE_AS(converted->data(), Containers::ArrayView<const char>{OriginalDataRleRGBA},
+        TestSuite::Compare::Container);
+}
+
+void TgaImageConverterTest::rleGrayscale() {
+    constexpr char original[] = {
+        1, 1, 1, 2,
+        3, 4, 5, 5
+    };
+    const ImageView2D image{GrayscaleFormat, PixelType::UnsignedByte, {4, 2}, original};
+
+    const auto data = TgaImageConverter{}.setFlags(TgaImageConverter::Flag::Rle).exportToData(image);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data[2], 11);
+    CORRADE_COMPARE(data.size(), 18 + (2 + 2) + (3 + 2));
+
+    std::optional<Trade::ImageData2D> converted = importData(data);
+    CORRADE_VERIFY(converted);
+    CORRADE_COMPARE(converted->format(), GrayscaleFormat);
+    CORRADE_COMPARE_AS(converted->data(), Containers::ArrayView<const char>{original},
+        TestSuite::Compare::Container);
+}
+
+void TgaImageConverterTest::rleLongRun() {
+    /* Runs are limited to 128 pixels, so this needs three packets */
+    Containers::Array<char> original{Containers::ValueInit, 300};
+    const ImageView2D image{PixelStorage{}.setAlignment(1), GrayscaleFormat, PixelType::UnsignedByte, {300, 1}, original};
+
+    const auto data = TgaImageConverter{}.setFlags(TgaImageConverter::Flag::Rle).exportToData(image);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data.size(), 18 + 3*2);
+
+    std::optional<Trade::ImageData2D> converted = importData(data);
+    CORRADE_VERIFY(converted);
+    CORRADE_COMPARE(converted->size(), Vector2i(300, 1));
+    CORRADE_COMPARE_AS(converted->data(), Containers::ArrayView<const char>{original},
+        TestSuite::Compare::Container);
+}
+
+void TgaImageConverterTest::file() {
+    const std::string filename = Utility::Directory::join(TGAIMAGECONVERTER_TEST_OUTPUT_DIR, "file.tga");
+    CORRADE_VERIFY(TgaImageConverter{}.exportToFile(OriginalRGB, filename));
+
+    /* The file should be the same as the in-memory output */
+    const auto data = TgaImageConverter{}.exportToData(OriginalRGB);
+    CORRADE_COMPARE_AS(filename, (std::string{data.data(), data.size()}),
+        TestSuite::Compare::FileToString);
+}
+
+void TgaImageConverterTest::fileRle() {
+    const std::string filename = Utility::Directory::join(TGAIMAGECONVERTER_TEST_OUTPUT_DIR, "file-rle.tga");
+    TgaImageConverter converter;
+    converter.setFlags(TgaImageConverter::Flag::Rle);
+    CORRADE_VERIFY(converter.exportToFile(OriginalRleRGB, filename));
+
+    TgaImporter importer;
+    CORRADE_VERIFY(importer.openFile(filename));
+    std::optional<Trade::ImageData2D> converted = importer.image2D(0);
+    CORRADE_VERIFY(converted);
+    CORRADE_COMPARE(converted->size(), Vector2i(4, 3));
+    CORRADE_COMPARE_AS(converted->data(), Containers::ArrayView<const char>{ConvertedDataRleRGB},
+        TestSuite::Compare::Container);
+}
+
+void TgaImageConverterTest::fileCannotWrite() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    CORRADE_VERIFY(!TgaImageConverter{}.exportToFile(OriginalRGB, "/nonexistent/file.tga"));
+    CORRADE_COMPARE(out.str(), "Trade::TgaImageConverter::exportToFile(): cannot write to file /nonexistent/file.tga\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::TgaImageConverterTest)
@@ -32,9 +32,8 @@
 #include <Corrade/Utility/Endianness.h>
 
 #include "Magnum/Image.h"
+#include "Magnum/PixelConversion.h"
 #include "Magnum/PixelFormat.h"
-#include "Magnum/Math/Swizzle.h"
-#include "Magnum/Math/Vector4.h"
 #include "MagnumPlugins/TgaImporter/TgaHeader.h"
 
 namespace Magnum { namespace Trade {
@@ -43,13 +42,15 @@ TgaImageConverter::TgaImageConverter() = default;
 
 TgaImageConverter::TgaImageConverter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImageConverter(manager, std::move(plugin)) {}
 
-auto TgaImageConverter::doFeatures() const -> Features { return Feature::ConvertData; }
+auto TgaImageConverter::doFeatures() const -> Features { return Feature::ConvertData|Feature::ConvertFile; }
 
-Containers::Array<char> TgaImageConverter::doExportToData(const ImageView2D& image) {
+namespace {
+
+bool checkImage(const ImageView2D& image, const char* const prefix) {
     #ifndef MAGNUM_TARGET_GLES
     if(image.storage().swapBytes()) {
-        Error() << "Trade::TgaImageConverter::exportToData(): pixel byte swap is not supported";
-        return nullptr;
+        Error() << prefix << "pixel byte swap is not supported";
+        return false;
     }
     #endif
 
@@ -63,25 +64,24 @@ Containers::Array<char> TgaImageConverter::doExportToData(const ImageView2D& ima
        #endif
        )
     {
-        Error() << "Trade::TgaImageConverter::exportToData(): unsupported color format" << image.format();
-        return nullptr;
+        Error() << prefix << "unsupported color format" << image.format();
+        return false;
     }
 
     if(image.type() != PixelType::UnsignedByte) {
-        Error() << "Trade::TgaImageConverter::exportToData(): unsupported color type" << image.type();
-        return nullptr;
+        Error() << prefix << "unsupported color type" << image.type();
+        return false;
     }
 
-    /* Initialize data buffer */
-    const auto pixelSize = UnsignedByte(image.pixelSize());
-    Containers::Array<char> data{Containers::ValueInit, sizeof(TgaHeader) + pixelSize*image.size().product()};
+    return true;
+}
 
-    /* Fill header */
-    auto header = reinterpret_cast<TgaHeader*>(data.begin());
+TgaHeader header(const ImageView2D& image, const bool rle) {
+    TgaHeader header{};
     switch(image.format()) {
         case PixelFormat::RGB:
         case PixelFormat::RGBA:
-            header->imageType = 2;
+            header.imageType = rle ? 10 : 2;
             break;
         #if !(defined(MAGNUM_TARGET_WEBGL) && defined(MAGNUM_TARGET_GLES2))
         case PixelFormat::Red:
@@ -89,36 +89,141 @@ Containers::Array<char> TgaImageConverter::doExportToData(const ImageView2D& ima
         #ifdef MAGNUM_TARGET_GLES2
         case PixelFormat::Luminance:
         #endif
-            header->imageType = 3;
+            header.imageType = rle ? 11 : 3;
             break;
         default: CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
     }
-    header->bpp = pixelSize*8;
-    header->width = UnsignedShort(Utility::Endianness::littleEndian(image.size().x()));
-    header->height = UnsignedShort(Utility::Endianness::littleEndian(image.size().y()));
+    header.bpp = image.pixelSize()*8;
+    header.width = UnsignedShort(Utility::Endianness::littleEndian(image.size().x()));
+    header.height = UnsignedShort(Utility::Endianness::littleEndian(image.size().y()));
+    return header;
+}
+
+/* Upper bound for size of one RLE-encoded row, with every packet being a
+   raw one */
+std::size_t maxRleRowSize(const std::size_t width, const std::size_t pixelSize) {
+    return width*pixelSize + (width + 127)/128;
+}
+
+/* Encodes one row of pixels, returns size of the output. Packets don't cross
+   row boundaries, as recommended by the TGA 2.0 specification. */
+std::size_t encodeRle(const char* const in, const std::size_t width, const std::size_t pixelSize, char* const out) {
+    const auto same = [&](std::size_t a, std::size_t b) {
+        return std::equal(in + a*pixelSize, in + (a + 1)*pixelSize, in + b*pixelSize);
+    };
+
+    char* o = out;
+    std::size_t i = 0;
+    while(i != width) {
+        /* Count repeated pixels */
+        std::size_t run = 1;
+        while(i + run != width && run != 128 && same(i, i + run)) ++run;
+
+        /* Run-length packet */
+        if(run > 1) {
+            *o++ = char(0x80|(run - 1));
+            std::copy_n(in + i*pixelSize, pixelSize, o);
+            o += pixelSize;
+            i += run;
+            continue;
+        }
+
+        /* Raw packet until the next run of at least two pixels */
+        std::size_t length = 1;
+        while(i + length != width && length != 128 && !(i + length + 1 != width && same(i + length, i + length + 1)))
+            ++length;
+        *o++ = char(length - 1);
+        std::copy_n(in + i*pixelSize, length*pixelSize, o);
+        o += length*pixelSize;
+        i += length;
+    }
+
+    return o - out;
+}
+
+/* Converts the image row by row and passes the output to given function
+   together with its size */
+template<class Write> void exportRows(const ImageView2D& image, const bool rle, Write write) {
+    const std::size_t pixelSize = image.pixelSize();
+    const std::size_t width = image.size().x();
+    const std::size_t rowSize = width*pixelSize;
+    const std::size_t rowStride = std::get<1>(image.dataProperties()).x();
+    const bool swizzle = image.format() == PixelFormat::RGB || image.format() == PixelFormat::RGBA;
 
     /* Image data pointer including skip */
     const char* imageData = image.data() + std::get<0>(image.dataProperties()).sum();
 
-    /* Fill data or copy them row by row if we need to drop the padding */
-    const std::size_t rowSize = image.size().x()*pixelSize;
-    const std::size_t rowStride = std::get<1>(image.dataProperties()).x();
-    if(rowStride != rowSize) {
-        for(std::int_fast32_t y = 0; y != image.size().y(); ++y)
-            std::copy_n(imageData + y*rowStride, rowSize, data.begin() + sizeof(TgaHeader) + y*rowSize);
-    } else std::copy_n(imageData, pixelSize*image.size().product(), data.begin() + sizeof(TgaHeader));
-
-    if(image.format() == PixelFormat::RGB) {
-        auto pixels = reinterpret_cast<Math::Vector3<UnsignedByte>*>(data.begin()+sizeof(TgaHeader));
-        std::transform(pixels, pixels + image.size().product(), pixels,
-            [](Math::Vector3<UnsignedByte> pixel) { return Math::swizzle<'b', 'g', 'r'>(pixel); });
-    } else if(image.format() == PixelFormat::RGBA) {
-        auto pixels = reinterpret_cast<Math::Vector4<UnsignedByte>*>(data.begin()+sizeof(TgaHeader));
-        std::transform(pixels, pixels + image.size().product(), pixels,
-            [](Math::Vector4<UnsignedByte> pixel) { return Math::swizzle<'b', 'g', 'r', 'a'>(pixel); });
+    Containers::Array<char> row{swizzle && rle ? rowSize : 0};
+    Containers::Array<char> encoded{rle ? maxRleRowSize(width, pixelSize) : swizzle ? rowSize : 0};
+    for(std::int_fast32_t y = 0; y != image.size().y(); ++y) {
+        const char* in = imageData + y*rowStride;
+
+        /* Convert RGB(A) to BGR(A) */
+        if(swizzle) {
+            char* const converted = rle ? row.data() : encoded.data();
+            PixelConversion::swapRedBlue(reinterpret_cast<const UnsignedByte*>(in), reinterpret_cast<UnsignedByte*>(converted), width, pixelSize);
+            in = converted;
+        }
+
+        if(rle) write(encoded.data(), encodeRle(in, width, pixelSize, encoded));
+        else write(in, rowSize);
+    }
+}
+
+}
+
+Containers::Array<char> TgaImageConverter::doExportToData(const ImageView2D& image) {
+    if(!checkImage(image, "Trade::TgaImageConverter::exportToData():"))
+        return nullptr;
+
+    const bool rle = bool(_flags & Flag::Rle);
+    const std::size_t pixelSize = image.pixelSize();
+
+    /* Allocate for the worst case and write the rows directly into it */
+    Containers::Array<char> data{Containers::NoInit, sizeof(TgaHeader) + image.size().y()*(rle ?
+        maxRleRowSize(image.size().x(), pixelSize) : image.size().x()*pixelSize)};
+    *reinterpret_cast<TgaHeader*>(data.begin()) = header(image, rle);
+    char* out = data.begin() + sizeof(TgaHeader);
+    exportRows(image, rle, [&out](const char* const row, const std::size_t size) {
+        std::copy_n(row, size, out);
+        out += size;
+    });
+
+    /* Save the unused space of RLE-compressed output */
+    const std::size_t size = out - data.begin();
+    if(size != data.size()) {
+        Containers::Array<char> shrunk{Containers::NoInit, size};
+        std::copy_n(data.begin(), size, shrunk.begin());
+        return shrunk;
     }
 
     return data;
 }
 
+bool TgaImageConverter::doExportToFile(const ImageView2D& image, const std::string& filename) {
+    if(!checkImage(image, "Trade::TgaImageConverter::exportToFile():"))
+        return false;
+
+    std::ofstream out{filename, std::ofstream::binary};
+    if(!out) {
+        Error() << "Trade::TgaImageConverter::exportToFile(): cannot write to file" << filename;
+        return false;
+    }
+
+    /* Stream the rows into the file as they get converted */
+    const bool rle = bool(_flags & Flag::Rle);
+    const TgaHeader fileHeader = header(image, rle);
+    out.write(reinterpret_cast<const char*>(&fileHeader), sizeof(TgaHeader));
+    exportRows(image, rle, [&out](const char* const row, const std::size_t size) {
+        out.write(row, size);
+    });
+
+    if(!out) {
+        Error() << "Trade::TgaImageConverter::exportToFile(): cannot write to file" << filename;
+        return false;
+    }
+
+    return true;
+}
+
 }}
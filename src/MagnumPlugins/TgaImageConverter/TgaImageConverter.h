@@ -29,6 +29,8 @@
  * @brief Class @ref Magnum::Trade::TgaImageConverter
  */
 
+#include <Corrade/Containers/EnumSet.h>
+
 #include "Magnum/Trade/AbstractImageConverter.h"
 
 #include "MagnumPlugins/TgaImageConverter/configure.h"
@@ -63,6 +65,18 @@ from `MAGNUM_PLUGINS_IMAGECONVERTER_DIR`. To use static plugin or use this as a
 dependency of another plugin, you need to request `TgaImageConverter`
 component of `Magnum` package in CMake and link to `Magnum::TgaImageConverter`
 target. See @ref building, @ref cmake and @ref plugins for more information.
+
+The image is converted row by row, BGR(A) swizzling is done using SSE2 or NEON
+instructions if the plugin is compiled with them enabled. The output is
+uncompressed by default, enable @ref Flag::Rle to produce RLE-compressed
+files. @ref exportToFile() writes the rows directly into the file without
+creating the whole output in memory first, which is preferable for large
+images such as screenshots or frame dumps:
+@code
+Trade::TgaImageConverter converter;
+converter.setFlags(Trade::TgaImageConverter::Flag::Rle);
+converter.exportToFile(image, "frame.tga");
+@endcode
 */
 class MAGNUM_TGAIMAGECONVERTER_EXPORT TgaImageConverter: public AbstractImageConverter {
     public:
@@ -72,11 +86,47 @@ class MAGNUM_TGAIMAGECONVERTER_EXPORT TgaImageConverter: public AbstractImageCon
         /** @brief Plugin manager constructor */
         explicit TgaImageConverter(PluginManager::AbstractManager& manager, std::string plugin);
 
+        /**
+         * @brief Conversion flag
+         *
+         * @see @ref Flags, @ref setFlags()
+         */
+        enum class Flag: UnsignedByte {
+            /** Produce RLE-compressed files */
+            Rle = 1 << 0
+        };
+
+        /**
+         * @brief Conversion flags
+         *
+         * @see @ref setFlags()
+         */
+        typedef Containers::EnumSet<Flag> Flags;
+
+        /** @brief Conversion flags */
+        Flags flags() const { return _flags; }
+
+        /**
+         * @brief Set conversion flags
+         * @return Reference to self (for method chaining)
+         *
+         * Default is no flags, i.e. uncompressed output.
+         */
+        TgaImageConverter& setFlags(Flags flags) {
+            _flags = flags;
+            return *this;
+        }
+
     private:
         Features MAGNUM_TGAIMAGECONVERTER_LOCAL doFeatures() const override;
         Containers::Array<char> MAGNUM_TGAIMAGECONVERTER_LOCAL doExportToData(const ImageView2D& image) override;
+        bool MAGNUM_TGAIMAGECONVERTER_LOCAL doExportToFile(const ImageView2D& image, const std::string& filename) override;
+
+        Flags _flags;
 };
 
+CORRADE_ENUMSET_OPERATORS(TgaImageConverter::Flags)
+
 }}
 
 #endif
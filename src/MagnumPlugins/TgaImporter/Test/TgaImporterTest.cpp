@@ -23,7 +23,9 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
 #include <sstream>
+#include <vector>
 #include <Corrade/Containers/ArrayView.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
@@ -44,13 +46,21 @@ class TgaImporterTest: public TestSuite::Tester {
         void openNonexistent();
         void openShort();
         void paletted();
-        void compressed();
+        void unsupportedType();
+        void shortData();
 
         void colorBits16();
         void colorBits24();
         void colorBits32();
+        void colorBits32Long();
+
+        void rleColorBits24();
+        void rleColorBits32();
+        void rleGrayscaleBits8();
+        void rleShort();
 
         void grayscaleBits8();
+        void grayscaleBits8File();
         void grayscaleBits16();
 
         void useTwice();
@@ -59,13 +69,21 @@ class TgaImporterTest: public TestSuite::Tester {
 TgaImporterTest::TgaImporterTest() {
     addTests({&TgaImporterTest::openShort,
               &TgaImporterTest::paletted,
-              &TgaImporterTest::compressed,
+              &TgaImporterTest::unsupportedType,
+              &TgaImporterTest::shortData,
 
               &TgaImporterTest::colorBits16,
               &TgaImporterTest::colorBits24,
               &TgaImporterTest::colorBits32,
+              &TgaImporterTest::colorBits32Long,
+
+              &TgaImporterTest::rleColorBits24,
+              &TgaImporterTest::rleColorBits32,
+              &TgaImporterTest::rleGrayscaleBits8,
+              &TgaImporterTest::rleShort,
 
               &TgaImporterTest::grayscaleBits8,
+              &TgaImporterTest::grayscaleBits8File,
               &TgaImporterTest::grayscaleBits16,
 
               &TgaImporterTest::useTwice});
@@ -93,7 +111,7 @@ void TgaImporterTest::paletted() {
     CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): paletted files are not supported\n");
 }
 
-void TgaImporterTest::compressed() {
+void TgaImporterTest::unsupportedType() {
     TgaImporter importer;
     const char data[] = { 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
     CORRADE_VERIFY(importer.openData(data));
@@ -101,7 +119,23 @@ void TgaImporterTest::compressed() {
     std::ostringstream debug;
     Error redirectError{&debug};
     CORRADE_VERIFY(!importer.image2D(0));
-    CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): unsupported (compressed?) image type: 9\n");
+    CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): unsupported image type: 9\n");
+}
+
+void TgaImporterTest::shortData() {
+    TgaImporter importer;
+    const char data[] = {
+        0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 24, 0,
+        1, 2, 3, 2, 3, 4,
+        3, 4, 5, 4, 5, 6,
+        5, 6, 7, 6, 7
+    };
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::ostringstream debug;
+    Error redirectError{&debug};
+    CORRADE_VERIFY(!importer.image2D(0));
+    CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): the file is too short: 35 bytes\n");
 }
 
 void TgaImporterTest::colorBits16() {
@@ -165,6 +199,125 @@ void TgaImporterTest::colorBits32() {
         TestSuite::Compare::Container);
 }
 
+void TgaImporterTest::colorBits32Long() {
+    TgaImporter importer;
+
+    /* Long enough to go through the SIMD code path with a remainder */
+    Containers::Array<char> data{18 + 19*4};
+    std::fill(data.begin(), data.end(), 0);
+    data[2] = 2;
+    data[12] = 19;
+    data[14] = 1;
+    data[16] = 32;
+    std::vector<char> pixels(19*4);
+    for(std::size_t i = 0; i != 19; ++i) {
+        data[18 + i*4 + 0] = pixels[i*4 + 2] = i;
+        data[18 + i*4 + 1] = pixels[i*4 + 1] = i + 50;
+        data[18 + i*4 + 2] = pixels[i*4 + 0] = i + 100;
+        data[18 + i*4 + 3] = pixels[i*4 + 3] = i + 42;
+    }
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::optional<Trade::ImageData2D> image = importer.image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->size(), Vector2i(19, 1));
+    CORRADE_COMPARE_AS(image->data(), Containers::ArrayView<const char>(pixels.data(), pixels.size()),
+        TestSuite::Compare::Container);
+}
+
+void TgaImporterTest::rleColorBits24() {
+    TgaImporter importer;
+    const char data[] = {
+        0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 24, 0,
+        /* Three raw pixels */
+        2, 1, 2, 3, 2, 3, 4, 3, 4, 5,
+        /* Run of three pixels, crossing the scanline */
+        '\x82', 5, 6, 7
+    };
+    const char pixels[] = {
+        3, 2, 1, 4, 3, 2,
+        5, 4, 3, 7, 6, 5,
+        7, 6, 5, 7, 6, 5
+    };
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::optional<Trade::ImageData2D> image = importer.image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->storage().alignment(), 1);
+    CORRADE_COMPARE(image->format(), PixelFormat::RGB);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    CORRADE_COMPARE(image->type(), PixelType::UnsignedByte);
+    CORRADE_COMPARE_AS(image->data(), Containers::ArrayView<const char>{pixels},
+        TestSuite::Compare::Container);
+}
+
+void TgaImporterTest::rleColorBits32() {
+    TgaImporter importer;
+    const char data[] = {
+        0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 32, 0,
+        /* Run of two pixels, one raw pixel, run of three pixels */
+        '\x81', 1, 2, 3, 1,
+        0, 3, 4, 5, 1,
+        '\x82', 6, 7, 8, 1
+    };
+    const char pixels[] = {
+        3, 2, 1, 1, 3, 2, 1, 1,
+        5, 4, 3, 1, 8, 7, 6, 1,
+        8, 7, 6, 1, 8, 7, 6, 1
+    };
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::optional<Trade::ImageData2D> image = importer.image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->storage().alignment(), 4);
+    CORRADE_COMPARE(image->format(), PixelFormat::RGBA);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    CORRADE_COMPARE_AS(image->data(), Containers::ArrayView<const char>{pixels},
+        TestSuite::Compare::Container);
+}
+
+void TgaImporterTest::rleGrayscaleBits8() {
+    TgaImporter importer;
+    const char data[] = {
+        0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 8, 0,
+        /* Run longer than the image is clamped */
+        1, 1, 2,
+        '\xff', 3
+    };
+    const char pixels[] = {
+        1, 2,
+        3, 3,
+        3, 3
+    };
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::optional<Trade::ImageData2D> image = importer.image2D(0);
+    CORRADE_VERIFY(image);
+    #ifndef MAGNUM_TARGET_GLES2
+    CORRADE_COMPARE(image->format(), PixelFormat::Red);
+    #else
+    CORRADE_COMPARE(image->format(), PixelFormat::Luminance);
+    #endif
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    CORRADE_COMPARE_AS(image->data(), Containers::ArrayView<const char>{pixels},
+        TestSuite::Compare::Container);
+}
+
+void TgaImporterTest::rleShort() {
+    TgaImporter importer;
+    const char data[] = {
+        0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 24, 0,
+        '\x82', 5, 6, 7,
+        2, 1, 2, 3, 2, 3
+    };
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::ostringstream debug;
+    Error redirectError{&debug};
+    CORRADE_VERIFY(!importer.image2D(0));
+    CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): the RLE data are too short\n");
+}
+
 void TgaImporterTest::grayscaleBits8() {
     TgaImporter importer;
     const char data[] = {
@@ -189,6 +342,28 @@ void TgaImporterTest::grayscaleBits8() {
         TestSuite::Compare::Container);
 }
 
+void TgaImporterTest::grayscaleBits8File() {
+    TgaImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(TGAIMPORTER_TEST_DIR, "file.tga")));
+
+    std::optional<Trade::ImageData2D> image = importer.image2D(0);
+    CORRADE_VERIFY(image);
+
+    /* The data are mapped from the file, they should outlive the importer */
+    importer.close();
+
+    CORRADE_COMPARE(image->storage().alignment(), 1);
+    #ifndef MAGNUM_TARGET_GLES2
+    CORRADE_COMPARE(image->format(), PixelFormat::Red);
+    #else
+    CORRADE_COMPARE(image->format(), PixelFormat::Luminance);
+    #endif
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    CORRADE_COMPARE(image->type(), PixelType::UnsignedByte);
+    CORRADE_COMPARE_AS(image->data(), (Containers::ArrayView<const char>{"\x01\x02\x03\x04\x05\x06", 6}),
+        TestSuite::Compare::Container);
+}
+
 void TgaImporterTest::grayscaleBits16() {
     TgaImporter importer;
     const char data[] = { 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0 };
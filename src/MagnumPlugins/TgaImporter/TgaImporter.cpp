@@ -26,15 +26,15 @@
 #include "TgaImporter.h"
 
 #include <algorithm>
-#include <fstream>
-#include <sstream>
+#include <cstring>
 #include <Corrade/Utility/Endianness.h>
 #include <Corrade/Containers/ArrayView.h>
 
+#include "Magnum/PixelConversion.h"
 #include "Magnum/PixelFormat.h"
-#include "Magnum/Math/Swizzle.h"
-#include "Magnum/Math/Vector4.h"
+#include "Magnum/Math/Vector2.h"
 #include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MapFile.h"
 #include "MagnumPlugins/TgaImporter/TgaHeader.h"
 
 #ifdef MAGNUM_TARGET_GLES2
@@ -44,33 +44,91 @@
 
 namespace Magnum { namespace Trade {
 
+namespace {
+
+/* Converts given count of pixels from file layout to output layout */
+void copyPixels(const char* const src, char* const dst, const std::size_t count, const std::size_t pixelSize) {
+    if(pixelSize == 3 || pixelSize == 4)
+        PixelConversion::swapRedBlue(reinterpret_cast<const UnsignedByte*>(src), reinterpret_cast<UnsignedByte*>(dst), count, pixelSize);
+    else std::memcpy(dst, src, count*pixelSize);
+}
+
+/* Returns false if the data are too short */
+bool decodeRle(Containers::ArrayView<const char> in, char* out, std::size_t count, const std::size_t pixelSize) {
+    while(count) {
+        if(in.empty()) return false;
+        const UnsignedByte packet = in[0];
+        const std::size_t length = std::min(std::size_t(packet & 0x7f) + 1, count);
+        in = in.suffix(1);
+
+        /* Run-length packet, convert the pixel once and then replicate it */
+        if(packet & 0x80) {
+            if(in.size() < pixelSize) return false;
+            copyPixels(in, out, 1, pixelSize);
+            for(std::size_t i = 1; i != length; ++i)
+                std::memcpy(out + i*pixelSize, out, pixelSize);
+            in = in.suffix(pixelSize);
+
+        /* Raw packet */
+        } else {
+            if(in.size() < length*pixelSize) return false;
+            copyPixels(in, out, length, pixelSize);
+            in = in.suffix(length*pixelSize);
+        }
+
+        out += length*pixelSize;
+        count -= length;
+    }
+
+    return true;
+}
+
+}
+
 TgaImporter::TgaImporter() = default;
 
 TgaImporter::TgaImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImporter{manager, std::move(plugin)} {}
 
 TgaImporter::~TgaImporter() = default;
 
-auto TgaImporter::doFeatures() const -> Features { return Feature::OpenData; }
+auto TgaImporter::doFeatures() const -> Features { return Feature::OpenData|Feature::ThreadSafeInstances; }
 
 bool TgaImporter::doIsOpened() const { return _in; }
 
-void TgaImporter::doClose() { _in = nullptr; }
+void TgaImporter::doClose() {
+    _in = nullptr;
+    _filename = {};
+}
 
 void TgaImporter::doOpenData(const Containers::ArrayView<const char> data) {
     _in = Containers::Array<char>{data.size()};
     std::copy(data.begin(), data.end(), _in.begin());
 }
 
+void TgaImporter::doOpenFile(const std::string& filename) {
+    /* Map the file instead of reading it into a copy, the mapping is also
+       reused for zero-copy image data in doImage2D() */
+    std::optional<Containers::Array<char>> data = mapFile(filename);
+    if(!data) return;
+
+    _in = std::move(*data);
+    _filename = filename;
+}
+
 UnsignedInt TgaImporter::doImage2DCount() const { return 1; }
 
 std::optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt) {
     /* Check if the file is long enough */
-    if(_in.size() < std::streamoff(sizeof(TgaHeader))) {
+    if(_in.size() < sizeof(TgaHeader)) {
         Error() << "Trade::TgaImporter::image2D(): the file is too short:" << _in.size() << "bytes";
         return std::nullopt;
     }
 
     const TgaHeader& header = *reinterpret_cast<const TgaHeader*>(_in.data());
+    if(_in.size() < sizeof(TgaHeader) + header.identsize) {
+        Error() << "Trade::TgaImporter::image2D(): the file is too short:" << _in.size() << "bytes";
+        return std::nullopt;
+    }
 
     /* Size in machine endian */
     const Vector2i size{Utility::Endianness::littleEndian(header.width),
@@ -83,8 +141,9 @@ std::optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt) {
         return std::nullopt;
     }
 
-    /* Color */
-    if(header.imageType == 2) {
+    /* Color, RLE-compressed color */
+    const bool rle = header.imageType & 8;
+    if(header.imageType == 2 || header.imageType == 10) {
         switch(header.bpp) {
             case 24:
                 format = PixelFormat::RGB;
@@ -97,8 +156,8 @@ std::optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt) {
                 return std::nullopt;
         }
 
-    /* Grayscale */
-    } else if(header.imageType == 3) {
+    /* Grayscale, RLE-compressed grayscale */
+    } else if(header.imageType == 3 || header.imageType == 11) {
         #if defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
         format = Context::hasCurrent() && Context::current().isExtensionSupported<Extensions::GL::EXT::texture_rg>() ?
             PixelFormat::Red : PixelFormat::Luminance;
@@ -112,28 +171,44 @@ std::optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt) {
             return std::nullopt;
         }
 
-    /* Compressed files */
+    /* Paletted RLE and other files */
     } else {
-        Error() << "Trade::TgaImporter::image2D(): unsupported (compressed?) image type:" << header.imageType;
+        Error() << "Trade::TgaImporter::image2D(): unsupported image type:" << header.imageType;
         return std::nullopt;
     }
 
-    Containers::Array<char> data{std::size_t(size.product())*header.bpp/8};
-    std::copy_n(_in + sizeof(TgaHeader), data.size(), data.begin());
-
     /* Adjust pixel storage if row size is not four byte aligned */
     PixelStorage storage;
     if((size.x()*header.bpp/8)%4 != 0)
         storage.setAlignment(1);
 
-    if(format == PixelFormat::RGB) {
-        auto pixels = reinterpret_cast<Math::Vector3<UnsignedByte>*>(data.data());
-        std::transform(pixels, pixels + size.product(), pixels,
-            [](Math::Vector3<UnsignedByte> pixel) { return Math::swizzle<'b', 'g', 'r'>(pixel); });
-    } else if(format == PixelFormat::RGBA) {
-        auto pixels = reinterpret_cast<Math::Vector4<UnsignedByte>*>(data.data());
-        std::transform(pixels, pixels + size.product(), pixels,
-            [](Math::Vector4<UnsignedByte> pixel) { return Math::swizzle<'b', 'g', 'r', 'a'>(pixel); });
+    const std::size_t pixelSize = header.bpp/8;
+    const std::size_t dataOffset = sizeof(TgaHeader) + header.identsize;
+    const std::size_t dataSize = std::size_t(size.product())*pixelSize;
+
+    /* Uncompressed grayscale data opened from a file are already in the
+       output layout, return a view into a mapping of the file instead of
+       copying them */
+    if(!rle && pixelSize == 1 && !_filename.empty() && _in.size() >= dataOffset + dataSize) {
+        std::optional<Containers::Array<char>> data = mapFile(_filename, dataOffset, dataSize);
+        if(data && data->size() == dataSize)
+            return ImageData2D{storage, format, PixelType::UnsignedByte, size, std::move(*data)};
+    }
+
+    /* Decode directly into the output, converting from BGR(A) on the way */
+    const Containers::ArrayView<const char> in = _in.suffix(dataOffset);
+    Containers::Array<char> data{dataSize};
+    if(rle) {
+        if(!decodeRle(in, data, size.product(), pixelSize)) {
+            Error() << "Trade::TgaImporter::image2D(): the RLE data are too short";
+            return std::nullopt;
+        }
+    } else {
+        if(in.size() < data.size()) {
+            Error() << "Trade::TgaImporter::image2D(): the file is too short:" << _in.size() << "bytes";
+            return std::nullopt;
+        }
+        copyPixels(in, data, size.product(), pixelSize);
     }
 
     return ImageData2D{storage, format, PixelType::UnsignedByte, size, std::move(data)};
@@ -54,8 +54,8 @@ namespace Magnum { namespace Trade {
 /**
 @brief TGA importer plugin
 
-Supports Truevision TGA (`*.tga`, `*.vda`, `*.icb`, `*.vst`) uncompressed BGR,
-BGRA or grayscale images with 8 bits per channel.
+Supports Truevision TGA (`*.tga`, `*.vda`, `*.icb`, `*.vst`) uncompressed or
+RLE-compressed BGR, BGRA or grayscale images with 8 bits per channel.
 
 This plugin is built if `WITH_TGAIMPORTER` is enabled when building Magnum. To
 use dynamic plugin, you need to load `TgaImporter` plugin from
@@ -68,7 +68,14 @@ The images are imported with @ref PixelType::UnsignedByte and @ref PixelFormat::
 @ref PixelFormat::RGBA or @ref PixelFormat::Red, respectively. Grayscale images
 require extension @extension{ARB,texture_rg}. Imported images are imported with
 default @ref PixelStorage parameters except for alignment, which may be changed
-to `1` if the data require it.
+to `1` if the data require it. The data are decoded directly into the output
+image, BGR(A) to RGB(A) conversion is done using SSE2 or NEON instructions if
+the plugin is compiled with them enabled.
+
+Files opened with @ref openFile() are memory-mapped using @ref mapFile()
+instead of being read into a copy. Uncompressed grayscale images opened this
+way need no conversion, so the returned @ref ImageData2D points directly into a
+private mapping of the file and the pixel data are never copied.
 
 In OpenGL ES 2.0, if @es_extension{EXT,texture_rg} is not supported and in
 WebGL 1.0, grayscale images use @ref PixelFormat::Luminance instead of
@@ -88,11 +95,13 @@ class MAGNUM_TGAIMPORTER_EXPORT TgaImporter: public AbstractImporter {
         Features MAGNUM_TGAIMPORTER_LOCAL doFeatures() const override;
         bool MAGNUM_TGAIMPORTER_LOCAL doIsOpened() const override;
         void MAGNUM_TGAIMPORTER_LOCAL doOpenData(Containers::ArrayView<const char> data) override;
+        void MAGNUM_TGAIMPORTER_LOCAL doOpenFile(const std::string& filename) override;
         void MAGNUM_TGAIMPORTER_LOCAL doClose() override;
         UnsignedInt MAGNUM_TGAIMPORTER_LOCAL doImage2DCount() const override;
         std::optional<ImageData2D> MAGNUM_TGAIMPORTER_LOCAL doImage2D(UnsignedInt id) override;
 
         Containers::Array<char> _in;
+        std::string _filename;
 };
 
 }}
@@ -26,27 +26,63 @@
 
 #include "WavImporter.h"
 
+#include <cstring>
 #include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Debug.h>
 #include <Corrade/Utility/Endianness.h>
 
+#include "Magnum/Audio/SampleConversion.h"
+#include "Magnum/Trade/MapFile.h"
 #include "MagnumPlugins/WavAudioImporter/WavHeader.h"
 
 namespace Magnum { namespace Audio {
 
-WavImporter::WavImporter() = default;
+WavImporter::WavImporter(): _position{}, _convertPcm24{} {}
 
-WavImporter::WavImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImporter(manager, std::move(plugin)) {}
+WavImporter::WavImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImporter(manager, std::move(plugin)), _position{}, _convertPcm24{} {}
 
-auto WavImporter::doFeatures() const -> Features { return Feature::OpenData; }
+auto WavImporter::doFeatures() const -> Features { return Feature::OpenData|Feature::Streaming; }
 
 bool WavImporter::doIsOpened() const { return _data; }
 
 void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
+    Containers::ArrayView<const char> samples;
+    if(!parse(data, samples)) return;
+
+    /* Convert 24-bit PCM, otherwise copy the data */
+    if(_convertPcm24) _data = convertPcm24ToPcm16(samples);
+    else {
+        _data = Containers::Array<char>(samples.size());
+        std::copy(samples.begin(), samples.end(), _data.begin());
+    }
+    _samples = _data;
+}
+
+void WavImporter::doOpenFile(const std::string& filename) {
+    /* Map the file so only the parts that are actually read need to be in
+       memory */
+    std::optional<Containers::Array<char>> mapped = Trade::mapFile(filename);
+    if(!mapped) return;
+    Containers::Array<char> file = std::move(*mapped);
+
+    Containers::ArrayView<const char> samples;
+    if(!parse(file, samples)) return;
+
+    /* 24-bit PCM is converted, so the mapped file is not needed anymore */
+    if(_convertPcm24) {
+        _data = convertPcm24ToPcm16(samples);
+        _samples = _data;
+    } else {
+        _data = std::move(file);
+        _samples = samples;
+    }
+}
+
+bool WavImporter::parse(const Containers::ArrayView<const char> data, Containers::ArrayView<const char>& samples) {
     /* Check file size */
     if(data.size() < sizeof(WavHeaderChunk) + sizeof(WavFormatChunk) + sizeof(RiffChunk)) {
         Error() << "Audio::WavImporter::openData(): the file is too short:" << data.size() << "bytes";
-        return;
+        return false;
     }
 
     /* Get the RIFF/WAV header */
@@ -56,7 +92,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
     if(std::strncmp(header.chunk.chunkId, "RIFF", 4) != 0 ||
        std::strncmp(header.format, "WAVE", 4) != 0) {
         Error() << "Audio::WavImporter::openData(): the file signature is invalid";
-        return;
+        return false;
     }
 
     Utility::Endianness::littleEndianInPlace(header.chunk.chunkSize);
@@ -65,7 +101,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
     if(header.chunk.chunkSize < 36 || header.chunk.chunkSize + 8 != data.size()) {
         Error() << "Audio::WavImporter::openData(): the file has improper size, expected"
                 << header.chunk.chunkSize + 8 << "but got" << data.size();
-        return;
+        return false;
     }
 
     const RiffChunk* dataChunk = nullptr;
@@ -83,7 +119,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
         if(std::strncmp(currChunk->chunkId, "fmt ", 4) == 0) {
             if(formatChunk != nullptr) {
                 Error() << "Audio::WavImporter::openData(): the file contains too many format chunks";
-                return;
+                return false;
             }
 
             formatChunk = reinterpret_cast<const WavFormatChunk*>(currChunk);
@@ -91,7 +127,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
         } else if(std::strncmp(currChunk->chunkId, "data", 4) == 0) {
             if(dataChunk != nullptr) {
                 Error() << "Audio::WavImporter::openData(): the file contains too many data chunks";
-                return;
+                return false;
             }
 
             dataChunk = currChunk;
@@ -104,13 +140,13 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
     /* Make sure we actually got a format chunk */
     if(formatChunk == nullptr) {
         Error() << "Audio::WavImporter::openData(): the file contains no format chunk";
-        return;
+        return false;
     }
 
     /* Make sure we actually got a data chunk */
     if(dataChunk == nullptr) {
         Error() << "Audio::WavImporter::openData(): the file contains no data chunk";
-        return;
+        return false;
     }
 
     /* Fix endianness on Format chunk */
@@ -119,6 +155,8 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
         formatChunk->sampleRate, formatChunk->byteRate, formatChunk->blockAlign,
         formatChunk->bitsPerSample);
 
+    _convertPcm24 = false;
+
     /* Check PCM format */
     if(formatChunk->audioFormat == WavAudioFormat::Pcm) {
         /* Decide about format */
@@ -130,11 +168,19 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
             _format = Buffer::Format::Stereo8;
         else if(formatChunk->numChannels == 2 && formatChunk->bitsPerSample == 16)
              _format = Buffer::Format::Stereo16;
-        else {
+
+        /* OpenAL has no 24-bit formats, these get converted to 16-bit */
+        else if(formatChunk->numChannels == 1 && formatChunk->bitsPerSample == 24) {
+            _format = Buffer::Format::Mono16;
+            _convertPcm24 = true;
+        } else if(formatChunk->numChannels == 2 && formatChunk->bitsPerSample == 24) {
+            _format = Buffer::Format::Stereo16;
+            _convertPcm24 = true;
+        } else {
             Error() << "Audio::WavImporter::openData(): PCM with unsupported channel count"
                     << formatChunk->numChannels << "with" << formatChunk->bitsPerSample
                     << "bits per sample";
-            return;
+            return false;
         }
 
     /* Check IEEE Float format */
@@ -151,7 +197,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
             Error() << "Audio::WavImporter::openData(): IEEE with unsupported channel count"
                     << formatChunk->numChannels << "with" << formatChunk->bitsPerSample
                     << "bits per sample";
-            return;
+            return false;
         }
 
     /* Check A-Law format */
@@ -164,7 +210,7 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
             Error() << "Audio::WavImporter::openData(): ALaw with unsupported channel count"
                     << formatChunk->numChannels << "with" << formatChunk->bitsPerSample
                     << "bits per sample";
-            return;
+            return false;
         }
 
     /* Check μ-Law format */
@@ -177,26 +223,26 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
             Error() << "Audio::WavImporter::openData(): MuLaw with unsupported channel count"
                     << formatChunk->numChannels << "with" << formatChunk->bitsPerSample
                     << "bits per sample";
-            return;
+            return false;
         }
 
     /* Unknown/unimplemented format */
     } else {
         Error() << "Audio::WavImporter::openData(): unsupported format" << formatChunk->audioFormat;
-        return;
+        return false;
     }
 
     /* Size sanity checks */
     if(headerSize + offset > data.size()) {
         Error() << "Audio::WavImporter::openData(): file size doesn't match computed size";
-        return;
+        return false;
     }
 
     /* Format sanity checks */
     if(formatChunk->blockAlign != formatChunk->numChannels * formatChunk->bitsPerSample / 8 ||
        formatChunk->byteRate != formatChunk->sampleRate * formatChunk->blockAlign) {
         Error() << "Audio::WavImporter::openData(): the file is corrupted";
-        return;
+        return false;
     }
 
     /* Save frequency */
@@ -205,23 +251,41 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
     /** @todo Convert the data from little endian too */
     CORRADE_INTERNAL_ASSERT(!Utility::Endianness::isBigEndian());
 
-    /* Copy the data */
-    const char* dataChunkPtr = reinterpret_cast<const char*>(dataChunk + 1);
-    _data = Containers::Array<char>(dataChunkSize);
-    std::copy(dataChunkPtr, dataChunkPtr+dataChunkSize, _data.begin());
-    return;
+    /* Save frame size for streaming, converted 24-bit samples have two
+       bytes */
+    _frameSize = _convertPcm24 ? formatChunk->numChannels*2 : formatChunk->blockAlign;
+
+    /* Converted samples need to be whole frames */
+    if(_convertPcm24) dataChunkSize -= dataChunkSize % formatChunk->blockAlign;
+
+    samples = {reinterpret_cast<const char*>(dataChunk + 1), dataChunkSize};
+    return true;
 }
 
-void WavImporter::doClose() { _data = nullptr; }
+void WavImporter::doClose() {
+    _data = nullptr;
+    _samples = nullptr;
+    _position = 0;
+}
 
 Buffer::Format WavImporter::doFormat() const { return _format; }
 
 UnsignedInt WavImporter::doFrequency() const { return _frequency; }
 
 Containers::Array<char> WavImporter::doData() {
-    Containers::Array<char> copy(_data.size());
-    std::copy(_data.begin(), _data.end(), copy.begin());
+    Containers::Array<char> copy(_samples.size());
+    std::copy(_samples.begin(), _samples.end(), copy.begin());
     return copy;
 }
 
+std::size_t WavImporter::doRead(const Containers::ArrayView<char> data) {
+    /* Copy only whole frames */
+    const std::size_t size = std::min(data.size()/_frameSize*_frameSize, _samples.size() - _position);
+    std::memcpy(data, _samples + _position, size);
+    _position += size;
+    return size;
+}
+
+void WavImporter::doRewind() { _position = 0; }
+
 }}
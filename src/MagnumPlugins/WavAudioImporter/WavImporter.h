@@ -58,12 +58,23 @@ Supports mono and stereo files of the following formats:
 
 -   8 bit per channel PCM, imported as @ref Buffer::Format::Mono8 and @ref Buffer::Format::Stereo8
 -   16 bit per channel PCM, imported as @ref Buffer::Format::Mono16 and @ref Buffer::Format::Stereo16
+-   24 bit per channel PCM, converted to @ref Buffer::Format::Mono16 and
+    @ref Buffer::Format::Stereo16 using @ref convertPcm24ToPcm16() on open,
+    as OpenAL has no 24-bit formats
 -   32-bit IEEE Float, imported as @ref Buffer::Format::MonoFloat / @ref Buffer::Format::StereoFloat
 -   64-bit IEEE Float, imported as @ref Buffer::Format::MonoDouble / @ref Buffer::Format::StereoDouble
 -   A-Law, imported as @ref Buffer::Format::MonoALaw / @ref Buffer::Format::StereoALaw
 -   μ-Law, imported as @ref Buffer::Format::MonoMuLaw / @ref Buffer::Format::StereoMuLaw
 
-Multi-channel formats are not supported.
+Multi-channel formats are not supported. Use @ref downmixToMono() to make
+stereo data usable for positional sources and @ref resample() to convert the
+data to output device frequency.
+
+Besides importing all data at once using @ref data(), the plugin supports
+streaming using @ref read(). When opening a file using @ref openFile(), the
+file is memory-mapped using @ref Trade::mapFile(), so only the parts that are
+actually read are loaded into memory. The only exception are 24-bit PCM files, which are
+converted as a whole when opened.
 
 This plugin is built if `WITH_WAVAUDIOIMPORTER` is enabled when building
 Magnum. To use dynamic plugin, you need to load `WavAudioImporter` plugin
@@ -84,15 +95,27 @@ class MAGNUM_WAVAUDIOIMPORTER_EXPORT WavImporter: public AbstractImporter {
         MAGNUM_WAVAUDIOIMPORTER_LOCAL Features doFeatures() const override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL bool doIsOpened() const override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL void doOpenData(Containers::ArrayView<const char> data) override;
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL void doOpenFile(const std::string& filename) override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL void doClose() override;
 
         MAGNUM_WAVAUDIOIMPORTER_LOCAL Buffer::Format doFormat() const override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL UnsignedInt doFrequency() const override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL Containers::Array<char> doData() override;
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL std::size_t doRead(Containers::ArrayView<char> data) override;
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL void doRewind() override;
+
+        /* Checks the file and fills the format, frequency and frame size.
+           On success returns true and a view on the sample data. */
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL bool parse(Containers::ArrayView<const char> data, Containers::ArrayView<const char>& samples);
 
+        /* Either a copy of the sample data or the whole memory-mapped file */
         Containers::Array<char> _data;
+        Containers::ArrayView<const char> _samples;
+        std::size_t _position;
+        bool _convertPcm24;
         Buffer::Format _format;
         UnsignedInt _frequency;
+        UnsignedInt _frameSize;
 };
 
 }}